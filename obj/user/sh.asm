@@ -0,0 +1,12253 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 14 2e 80 00 00 	movabs $0x802e14,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 21 4c 80 00 00 	movabs $0x804c21,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 21 4c 80 00 00 	movabs $0x804c21,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 2f 74 80 00 00 	movabs $0x80742f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 34 2c 80 00 00 	movabs $0x802c34,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 10 6d 80 00 00 	movabs $0x806d10,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 34 2c 80 00 00 	movabs $0x802c34,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 12 6d 80 00 00 	movabs $0x806d12,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 34 2c 80 00 00 	movabs $0x802c34,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 15 6d 80 00 00 	movabs $0x806d15,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 34 2c 80 00 00 	movabs $0x802c34,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 b3 63 80 00 00 	movabs $0x8063b3,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 8a 66 80 00 00 	movabs $0x80668a,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 35 43 80 00 00 	movabs $0x804335,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 fe 43 80 00 00 	movabs $0x8043fe,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 04 43 80 00 00 	movabs $0x804304,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb e1 2d 80 00 00 	movabs $0x802de1,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 6d 80 00 00 	movabs $0x806d20,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 e1 2d 80 00 00 	movabs $0x802de1,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 14 2e 80 00 00 	movabs $0x802e14,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc e1 2d 80 00 00 	movabs $0x802de1,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 6f 80 00 00 	movabs $0x806fc0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf e1 2d 80 00 00 	movabs $0x802de1,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf e1 2d 80 00 00 	movabs $0x802de1,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 72 80 00 00 	movabs $0x807240,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 72 80 00 00 	movabs $0x807240,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 39 30 80 00 00 	movabs $0x803039,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 39 30 80 00 00 	movabs $0x803039,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 20 0b 00 00       	call   80201f <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  801501:	48 85 ff             	test   %rdi,%rdi
+  801504:	0f 84 e3 00 00 00    	je     8015ed <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80150a:	55                   	push   %rbp
+  80150b:	48 89 e5             	mov    %rsp,%rbp
+  80150e:	41 57                	push   %r15
+  801510:	41 56                	push   %r14
+  801512:	41 55                	push   %r13
+  801514:	41 54                	push   %r12
+  801516:	53                   	push   %rbx
+  801517:	48 83 ec 08          	sub    $0x8,%rsp
+  80151b:	48 89 fb             	mov    %rdi,%rbx
+  80151e:	49 89 f7             	mov    %rsi,%r15
+  801521:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  801524:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80152b:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  801532:	49 bd 62 72 80 00 00 	movabs $0x807262,%r13
+  801539:	00 00 00 
+  80153c:	49 bc 95 2c 80 00 00 	movabs $0x802c95,%r12
+  801543:	00 00 00 
+  801546:	eb 08                	jmp    801550 <_gettoken+0x4f>
+        *s++ = 0;
+  801548:	48 83 c3 01          	add    $0x1,%rbx
+  80154c:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  801550:	0f be 33             	movsbl (%rbx),%esi
+  801553:	4c 89 ef             	mov    %r13,%rdi
+  801556:	41 ff d4             	call   *%r12
+  801559:	48 85 c0             	test   %rax,%rax
+  80155c:	75 ea                	jne    801548 <_gettoken+0x47>
+    if (*s == 0) {
+  80155e:	0f b6 33             	movzbl (%rbx),%esi
+  801561:	40 84 f6             	test   %sil,%sil
+  801564:	75 0f                	jne    801575 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  801566:	48 83 c4 08          	add    $0x8,%rsp
+  80156a:	5b                   	pop    %rbx
+  80156b:	41 5c                	pop    %r12
+  80156d:	41 5d                	pop    %r13
+  80156f:	41 5e                	pop    %r14
+  801571:	41 5f                	pop    %r15
+  801573:	5d                   	pop    %rbp
+  801574:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  801575:	40 0f be f6          	movsbl %sil,%esi
+  801579:	48 bf 6b 72 80 00 00 	movabs $0x80726b,%rdi
+  801580:	00 00 00 
+  801583:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  80158a:	00 00 00 
+  80158d:	ff d0                	call   *%rax
+  80158f:	48 85 c0             	test   %rax,%rax
+  801592:	74 12                	je     8015a6 <_gettoken+0xa5>
+        t = *s;
+  801594:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  801597:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  80159a:	c6 03 00             	movb   $0x0,(%rbx)
+  80159d:	48 83 c3 01          	add    $0x1,%rbx
+  8015a1:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8015a4:	eb c0                	jmp    801566 <_gettoken+0x65>
+    *p1 = s;
+  8015a6:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8015a9:	0f b6 33             	movzbl (%rbx),%esi
+  8015ac:	49 bd 67 72 80 00 00 	movabs $0x807267,%r13
+  8015b3:	00 00 00 
+  8015b6:	49 bc 95 2c 80 00 00 	movabs $0x802c95,%r12
+  8015bd:	00 00 00 
+  8015c0:	40 84 f6             	test   %sil,%sil
+  8015c3:	74 1b                	je     8015e0 <_gettoken+0xdf>
+  8015c5:	40 0f be f6          	movsbl %sil,%esi
+  8015c9:	4c 89 ef             	mov    %r13,%rdi
+  8015cc:	41 ff d4             	call   *%r12
+  8015cf:	48 85 c0             	test   %rax,%rax
+  8015d2:	75 0c                	jne    8015e0 <_gettoken+0xdf>
+        s++;
+  8015d4:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8015d8:	0f b6 33             	movzbl (%rbx),%esi
+  8015db:	40 84 f6             	test   %sil,%sil
+  8015de:	75 e5                	jne    8015c5 <_gettoken+0xc4>
+    *p2 = s;
+  8015e0:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  8015e3:	b8 77 00 00 00       	mov    $0x77,%eax
+  8015e8:	e9 79 ff ff ff       	jmp    801566 <_gettoken+0x65>
+        return 0;
+  8015ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f2:	c3                   	ret
+
+00000000008015f3 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  8015f3:	55                   	push   %rbp
+  8015f4:	48 89 e5             	mov    %rsp,%rbp
+  8015f7:	41 54                	push   %r12
+  8015f9:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  8015fa:	48 85 ff             	test   %rdi,%rdi
+  8015fd:	74 33                	je     801632 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  8015ff:	48 ba 28 90 80 01 00 	movabs $0x1809028,%rdx
+  801606:	00 00 00 
+  801609:	48 be 30 90 80 01 00 	movabs $0x1809030,%rsi
+  801610:	00 00 00 
+  801613:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80161a:	00 00 00 
+  80161d:	ff d0                	call   *%rax
+  80161f:	a3 24 90 80 01 00 00 	movabs %eax,0x1809024
+  801626:	00 00 
+        return 0;
+  801628:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  80162d:	5b                   	pop    %rbx
+  80162e:	41 5c                	pop    %r12
+  801630:	5d                   	pop    %rbp
+  801631:	c3                   	ret
+    c = nc;
+  801632:	48 bb 20 90 80 01 00 	movabs $0x1809020,%rbx
+  801639:	00 00 00 
+  80163c:	49 bc 24 90 80 01 00 	movabs $0x1809024,%r12
+  801643:	00 00 00 
+  801646:	41 8b 04 24          	mov    (%r12),%eax
+  80164a:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  80164c:	48 b8 30 90 80 01 00 	movabs $0x1809030,%rax
+  801653:	00 00 00 
+  801656:	48 8b 10             	mov    (%rax),%rdx
+  801659:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  80165c:	48 ba 28 90 80 01 00 	movabs $0x1809028,%rdx
+  801663:	00 00 00 
+  801666:	48 8b 3a             	mov    (%rdx),%rdi
+  801669:	48 89 c6             	mov    %rax,%rsi
+  80166c:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801673:	00 00 00 
+  801676:	ff d0                	call   *%rax
+  801678:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  80167c:	8b 03                	mov    (%rbx),%eax
+  80167e:	eb ad                	jmp    80162d <gettoken+0x3a>
+
+0000000000801680 <runcmd>:
+runcmd(char *s) {
+  801680:	55                   	push   %rbp
+  801681:	48 89 e5             	mov    %rsp,%rbp
+  801684:	41 56                	push   %r14
+  801686:	41 55                	push   %r13
+  801688:	41 54                	push   %r12
+  80168a:	53                   	push   %rbx
+  80168b:	48 81 ec 90 04 00 00 	sub    $0x490,%rsp
+    gettoken(s, 0);
+  801692:	be 00 00 00 00       	mov    $0x0,%esi
+  801697:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+        switch ((c = gettoken(0, &t))) {
+  8016a3:	49 bd f3 15 80 00 00 	movabs $0x8015f3,%r13
+  8016aa:	00 00 00 
+    argc = 0;
+  8016ad:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        switch ((c = gettoken(0, &t))) {
+  8016b3:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8016ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016bf:	41 ff d5             	call   *%r13
+  8016c2:	89 c3                	mov    %eax,%ebx
+  8016c4:	83 f8 3e             	cmp    $0x3e,%eax
+  8016c7:	0f 84 93 01 00 00    	je     801860 <runcmd+0x1e0>
+  8016cd:	7f 5e                	jg     80172d <runcmd+0xad>
+  8016cf:	85 c0                	test   %eax,%eax
+  8016d1:	0f 84 c5 02 00 00    	je     80199c <runcmd+0x31c>
+  8016d7:	83 f8 3c             	cmp    $0x3c,%eax
+  8016da:	0f 85 94 03 00 00    	jne    801a74 <runcmd+0x3f4>
+            if (gettoken(0, &t) != 'w') {
+  8016e0:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8016e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ec:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  8016f3:	00 00 00 
+  8016f6:	ff d0                	call   *%rax
+  8016f8:	83 f8 77             	cmp    $0x77,%eax
+  8016fb:	0f 85 e1 00 00 00    	jne    8017e2 <runcmd+0x162>
+            if ((fd = open(t, O_RDONLY)) < 0) {
+  801701:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  801708:	be 00 00 00 00       	mov    $0x0,%esi
+  80170d:	4c 89 f7             	mov    %r14,%rdi
+  801710:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  801717:	00 00 00 
+  80171a:	ff d0                	call   *%rax
+  80171c:	89 c3                	mov    %eax,%ebx
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	0f 88 e8 00 00 00    	js     80180e <runcmd+0x18e>
+            if (fd != 0) {
+  801726:	74 8b                	je     8016b3 <runcmd+0x33>
+  801728:	e9 0d 01 00 00       	jmp    80183a <runcmd+0x1ba>
+        switch ((c = gettoken(0, &t))) {
+  80172d:	83 f8 77             	cmp    $0x77,%eax
+  801730:	74 65                	je     801797 <runcmd+0x117>
+  801732:	83 f8 7c             	cmp    $0x7c,%eax
+  801735:	0f 85 39 03 00 00    	jne    801a74 <runcmd+0x3f4>
+            if ((r = pipe(p)) < 0) {
+  80173b:	48 8d bd 50 fb ff ff 	lea    -0x4b0(%rbp),%rdi
+  801742:	48 b8 a1 58 80 00 00 	movabs $0x8058a1,%rax
+  801749:	00 00 00 
+  80174c:	ff d0                	call   *%rax
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	0f 88 ce 01 00 00    	js     801924 <runcmd+0x2a4>
+            if ((r = fork()) < 0) {
+  801756:	48 b8 7f 3a 80 00 00 	movabs $0x803a7f,%rax
+  80175d:	00 00 00 
+  801760:	ff d0                	call   *%rax
+  801762:	89 c3                	mov    %eax,%ebx
+  801764:	85 c0                	test   %eax,%eax
+  801766:	0f 88 e6 01 00 00    	js     801952 <runcmd+0x2d2>
+            if (r == 0) {
+  80176c:	0f 85 09 02 00 00    	jne    80197b <runcmd+0x2fb>
+                if (p[0] != 0) {
+  801772:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  801778:	85 ff                	test   %edi,%edi
+  80177a:	0f 85 a4 02 00 00    	jne    801a24 <runcmd+0x3a4>
+                close(p[1]);
+  801780:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  801786:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+                goto again;
+  801792:	e9 16 ff ff ff       	jmp    8016ad <runcmd+0x2d>
+            if (argc == MAXARGS) {
+  801797:	41 83 fc 10          	cmp    $0x10,%r12d
+  80179b:	74 1c                	je     8017b9 <runcmd+0x139>
+            argv[argc++] = t;
+  80179d:	49 63 c4             	movslq %r12d,%rax
+  8017a0:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  8017a7:	48 89 94 c5 60 ff ff 	mov    %rdx,-0xa0(%rbp,%rax,8)
+  8017ae:	ff 
+  8017af:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+            break;
+  8017b4:	e9 fa fe ff ff       	jmp    8016b3 <runcmd+0x33>
+                cprintf("too many arguments\n");
+  8017b9:	48 bf 73 72 80 00 00 	movabs $0x807273,%rdi
+  8017c0:	00 00 00 
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  8017cf:	00 00 00 
+  8017d2:	ff d2                	call   *%rdx
+                exit();
+  8017d4:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8017db:	00 00 00 
+  8017de:	ff d0                	call   *%rax
+  8017e0:	eb bb                	jmp    80179d <runcmd+0x11d>
+                cprintf("syntax error: < not followed by word\n");
+  8017e2:	48 bf 20 73 80 00 00 	movabs $0x807320,%rdi
+  8017e9:	00 00 00 
+  8017ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f1:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  8017f8:	00 00 00 
+  8017fb:	ff d2                	call   *%rdx
+                exit();
+  8017fd:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801804:	00 00 00 
+  801807:	ff d0                	call   *%rax
+  801809:	e9 f3 fe ff ff       	jmp    801701 <runcmd+0x81>
+                cprintf("open %s for read: %i", t, fd);
+  80180e:	89 c2                	mov    %eax,%edx
+  801810:	4c 89 f6             	mov    %r14,%rsi
+  801813:	48 bf 87 72 80 00 00 	movabs $0x807287,%rdi
+  80181a:	00 00 00 
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801822:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  801829:	00 00 00 
+  80182c:	ff d1                	call   *%rcx
+                exit();
+  80182e:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801835:	00 00 00 
+  801838:	ff d0                	call   *%rax
+                dup(fd, 0);
+  80183a:	be 00 00 00 00       	mov    $0x0,%esi
+  80183f:	89 df                	mov    %ebx,%edi
+  801841:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+                close(fd);
+  80184d:	89 df                	mov    %ebx,%edi
+  80184f:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  801856:	00 00 00 
+  801859:	ff d0                	call   *%rax
+  80185b:	e9 53 fe ff ff       	jmp    8016b3 <runcmd+0x33>
+            if (gettoken(0, &t) != 'w') {
+  801860:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  801867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186c:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  801873:	00 00 00 
+  801876:	ff d0                	call   *%rax
+  801878:	83 f8 77             	cmp    $0x77,%eax
+  80187b:	75 2c                	jne    8018a9 <runcmd+0x229>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  80187d:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  801884:	be 01 03 00 00       	mov    $0x301,%esi
+  801889:	4c 89 f7             	mov    %r14,%rdi
+  80188c:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+  801898:	89 c3                	mov    %eax,%ebx
+  80189a:	85 c0                	test   %eax,%eax
+  80189c:	78 34                	js     8018d2 <runcmd+0x252>
+            if (fd != 1) {
+  80189e:	83 f8 01             	cmp    $0x1,%eax
+  8018a1:	0f 84 0c fe ff ff    	je     8016b3 <runcmd+0x33>
+  8018a7:	eb 55                	jmp    8018fe <runcmd+0x27e>
+                cprintf("syntax error: > not followed by word\n");
+  8018a9:	48 bf 48 73 80 00 00 	movabs $0x807348,%rdi
+  8018b0:	00 00 00 
+  8018b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b8:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  8018bf:	00 00 00 
+  8018c2:	ff d2                	call   *%rdx
+                exit();
+  8018c4:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	eb ab                	jmp    80187d <runcmd+0x1fd>
+                cprintf("open %s for write: %i", t, fd);
+  8018d2:	89 c2                	mov    %eax,%edx
+  8018d4:	4c 89 f6             	mov    %r14,%rsi
+  8018d7:	48 bf 9c 72 80 00 00 	movabs $0x80729c,%rdi
+  8018de:	00 00 00 
+  8018e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e6:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  8018ed:	00 00 00 
+  8018f0:	ff d1                	call   *%rcx
+                exit();
+  8018f2:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+                dup(fd, 1);
+  8018fe:	be 01 00 00 00       	mov    $0x1,%esi
+  801903:	89 df                	mov    %ebx,%edi
+  801905:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+                close(fd);
+  801911:	89 df                	mov    %ebx,%edi
+  801913:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  80191a:	00 00 00 
+  80191d:	ff d0                	call   *%rax
+  80191f:	e9 8f fd ff ff       	jmp    8016b3 <runcmd+0x33>
+                cprintf("pipe: %i", r);
+  801924:	89 c6                	mov    %eax,%esi
+  801926:	48 bf b2 72 80 00 00 	movabs $0x8072b2,%rdi
+  80192d:	00 00 00 
+  801930:	b8 00 00 00 00       	mov    $0x0,%eax
+  801935:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  80193c:	00 00 00 
+  80193f:	ff d2                	call   *%rdx
+                exit();
+  801941:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801948:	00 00 00 
+  80194b:	ff d0                	call   *%rax
+  80194d:	e9 04 fe ff ff       	jmp    801756 <runcmd+0xd6>
+                cprintf("fork: %i", r);
+  801952:	89 c6                	mov    %eax,%esi
+  801954:	48 bf 2c 79 80 00 00 	movabs $0x80792c,%rdi
+  80195b:	00 00 00 
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  80196a:	00 00 00 
+  80196d:	ff d2                	call   *%rdx
+                exit();
+  80196f:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801976:	00 00 00 
+  801979:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  80197b:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  801981:	83 ff 01             	cmp    $0x1,%edi
+  801984:	0f 85 c2 00 00 00    	jne    801a4c <runcmd+0x3cc>
+                close(p[0]);
+  80198a:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  801990:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  801997:	00 00 00 
+  80199a:	ff d0                	call   *%rax
+    if (argc == 0) {
+  80199c:	45 85 e4             	test   %r12d,%r12d
+  80199f:	74 73                	je     801a14 <runcmd+0x394>
+    if (argv[0][0] != '/') {
+  8019a1:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8019a8:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  8019ab:	0f 85 f0 00 00 00    	jne    801aa1 <runcmd+0x421>
+    argv[argc] = 0;
+  8019b1:	4d 63 e4             	movslq %r12d,%r12
+  8019b4:	4a c7 84 e5 60 ff ff 	movq   $0x0,-0xa0(%rbp,%r12,8)
+  8019bb:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8019c0:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  8019c7:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  8019ce:	48 b8 fd 4d 80 00 00 	movabs $0x804dfd,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+  8019da:	41 89 c4             	mov    %eax,%r12d
+  8019dd:	85 c0                	test   %eax,%eax
+  8019df:	0f 88 e9 00 00 00    	js     801ace <runcmd+0x44e>
+    close_all();
+  8019e5:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  8019ec:	00 00 00 
+  8019ef:	ff d0                	call   *%rax
+        wait(r);
+  8019f1:	44 89 e7             	mov    %r12d,%edi
+  8019f4:	48 b8 00 5b 80 00 00 	movabs $0x805b00,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+    if (pipe_child) {
+  801a00:	85 db                	test   %ebx,%ebx
+  801a02:	0f 85 fb 00 00 00    	jne    801b03 <runcmd+0x483>
+    exit();
+  801a08:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+}
+  801a14:	48 81 c4 90 04 00 00 	add    $0x490,%rsp
+  801a1b:	5b                   	pop    %rbx
+  801a1c:	41 5c                	pop    %r12
+  801a1e:	41 5d                	pop    %r13
+  801a20:	41 5e                	pop    %r14
+  801a22:	5d                   	pop    %rbp
+  801a23:	c3                   	ret
+                    dup(p[0], 0);
+  801a24:	be 00 00 00 00       	mov    $0x0,%esi
+  801a29:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  801a30:	00 00 00 
+  801a33:	ff d0                	call   *%rax
+                    close(p[0]);
+  801a35:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  801a3b:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  801a42:	00 00 00 
+  801a45:	ff d0                	call   *%rax
+  801a47:	e9 34 fd ff ff       	jmp    801780 <runcmd+0x100>
+                    dup(p[1], 1);
+  801a4c:	be 01 00 00 00       	mov    $0x1,%esi
+  801a51:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  801a58:	00 00 00 
+  801a5b:	ff d0                	call   *%rax
+                    close(p[1]);
+  801a5d:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  801a63:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+  801a6f:	e9 16 ff ff ff       	jmp    80198a <runcmd+0x30a>
+            panic("bad return %d from gettoken", c);
+  801a74:	89 d9                	mov    %ebx,%ecx
+  801a76:	48 ba bb 72 80 00 00 	movabs $0x8072bb,%rdx
+  801a7d:	00 00 00 
+  801a80:	be 70 00 00 00       	mov    $0x70,%esi
+  801a85:	48 bf d7 72 80 00 00 	movabs $0x8072d7,%rdi
+  801a8c:	00 00 00 
+  801a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a94:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  801a9b:	00 00 00 
+  801a9e:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  801aa1:	c6 85 58 fb ff ff 2f 	movb   $0x2f,-0x4a8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  801aa8:	4c 8d ad 58 fb ff ff 	lea    -0x4a8(%rbp),%r13
+  801aaf:	48 8d bd 59 fb ff ff 	lea    -0x4a7(%rbp),%rdi
+  801ab6:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  801ac2:	4c 89 ad 60 ff ff ff 	mov    %r13,-0xa0(%rbp)
+  801ac9:	e9 e3 fe ff ff       	jmp    8019b1 <runcmd+0x331>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  801ace:	89 c2                	mov    %eax,%edx
+  801ad0:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  801ad7:	48 bf e1 72 80 00 00 	movabs $0x8072e1,%rdi
+  801ade:	00 00 00 
+  801ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae6:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  801aed:	00 00 00 
+  801af0:	ff d1                	call   *%rcx
+    close_all();
+  801af2:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  801af9:	00 00 00 
+  801afc:	ff d0                	call   *%rax
+    if (r >= 0) {
+  801afe:	e9 fd fe ff ff       	jmp    801a00 <runcmd+0x380>
+        wait(pipe_child);
+  801b03:	89 df                	mov    %ebx,%edi
+  801b05:	48 b8 00 5b 80 00 00 	movabs $0x805b00,%rax
+  801b0c:	00 00 00 
+  801b0f:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  801b11:	e9 f2 fe ff ff       	jmp    801a08 <runcmd+0x388>
+
+0000000000801b16 <usage>:
+
+void
+usage(void) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  801b1a:	48 bf 70 73 80 00 00 	movabs $0x807370,%rdi
+  801b21:	00 00 00 
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b29:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  801b30:	00 00 00 
+  801b33:	ff d2                	call   *%rdx
+    exit();
+  801b35:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  801b3c:	00 00 00 
+  801b3f:	ff d0                	call   *%rax
+}
+  801b41:	5d                   	pop    %rbp
+  801b42:	c3                   	ret
+
+0000000000801b43 <umain>:
+
+void
+umain(int argc, char **argv) {
+  801b43:	55                   	push   %rbp
+  801b44:	48 89 e5             	mov    %rsp,%rbp
+  801b47:	41 57                	push   %r15
+  801b49:	41 56                	push   %r14
+  801b4b:	41 55                	push   %r13
+  801b4d:	41 54                	push   %r12
+  801b4f:	53                   	push   %rbx
+  801b50:	48 83 ec 38          	sub    $0x38,%rsp
+  801b54:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  801b57:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  801b5b:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  801b5f:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  801b63:	48 b8 31 3c 80 00 00 	movabs $0x803c31,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+    echocmds = 0;
+  801b6f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  801b75:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  801b7b:	48 bb 5e 3c 80 00 00 	movabs $0x803c5e,%rbx
+  801b82:	00 00 00 
+        switch (r) {
+  801b85:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  801b8b:	49 bf 16 1b 80 00 00 	movabs $0x801b16,%r15
+  801b92:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  801b95:	eb 08                	jmp    801b9f <umain+0x5c>
+        switch (r) {
+  801b97:	45 89 e6             	mov    %r12d,%r14d
+  801b9a:	eb 03                	jmp    801b9f <umain+0x5c>
+            echocmds = 1;
+  801b9c:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  801b9f:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  801ba3:	ff d3                	call   *%rbx
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 14                	js     801bbd <umain+0x7a>
+        switch (r) {
+  801ba9:	83 f8 69             	cmp    $0x69,%eax
+  801bac:	74 e9                	je     801b97 <umain+0x54>
+  801bae:	83 f8 78             	cmp    $0x78,%eax
+  801bb1:	74 e9                	je     801b9c <umain+0x59>
+  801bb3:	83 f8 64             	cmp    $0x64,%eax
+  801bb6:	74 e7                	je     801b9f <umain+0x5c>
+            usage();
+  801bb8:	41 ff d7             	call   *%r15
+  801bbb:	eb e2                	jmp    801b9f <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  801bbd:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  801bc1:	7f 3f                	jg     801c02 <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  801bc3:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  801bc7:	74 47                	je     801c10 <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  801bc9:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  801bcd:	0f 84 d8 00 00 00    	je     801cab <umain+0x168>
+  801bd3:	45 85 f6             	test   %r14d,%r14d
+  801bd6:	49 bc 10 73 80 00 00 	movabs $0x807310,%r12
+  801bdd:	00 00 00 
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be5:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  801be9:	49 be ef 30 80 00 00 	movabs $0x8030ef,%r14
+  801bf0:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  801bf3:	49 bf c8 20 80 00 00 	movabs $0x8020c8,%r15
+  801bfa:	00 00 00 
+  801bfd:	e9 22 01 00 00       	jmp    801d24 <umain+0x1e1>
+        usage();
+  801c02:	48 b8 16 1b 80 00 00 	movabs $0x801b16,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+  801c0e:	eb b3                	jmp    801bc3 <umain+0x80>
+        close(0);
+  801c10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c15:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  801c1c:	00 00 00 
+  801c1f:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  801c21:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c25:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  801c29:	be 00 00 00 00       	mov    $0x0,%esi
+  801c2e:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+  801c3a:	85 c0                	test   %eax,%eax
+  801c3c:	78 37                	js     801c75 <umain+0x132>
+        assert(r == 0);
+  801c3e:	74 89                	je     801bc9 <umain+0x86>
+  801c40:	48 b9 a4 7b 80 00 00 	movabs $0x807ba4,%rcx
+  801c47:	00 00 00 
+  801c4a:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  801c51:	00 00 00 
+  801c54:	be 16 01 00 00       	mov    $0x116,%esi
+  801c59:	48 bf d7 72 80 00 00 	movabs $0x8072d7,%rdi
+  801c60:	00 00 00 
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  801c6f:	00 00 00 
+  801c72:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  801c75:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801c79:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  801c7d:	41 89 c0             	mov    %eax,%r8d
+  801c80:	48 ba ef 72 80 00 00 	movabs $0x8072ef,%rdx
+  801c87:	00 00 00 
+  801c8a:	be 15 01 00 00       	mov    $0x115,%esi
+  801c8f:	48 bf d7 72 80 00 00 	movabs $0x8072d7,%rdi
+  801c96:	00 00 00 
+  801c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9e:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  801ca5:	00 00 00 
+  801ca8:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  801cab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb0:	48 b8 82 1f 80 00 00 	movabs $0x801f82,%rax
+  801cb7:	00 00 00 
+  801cba:	ff d0                	call   *%rax
+  801cbc:	41 89 c6             	mov    %eax,%r14d
+  801cbf:	e9 0f ff ff ff       	jmp    801bd3 <umain+0x90>
+            exit(); /* end of file */
+  801cc4:	41 ff d7             	call   *%r15
+  801cc7:	eb 69                	jmp    801d32 <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  801cc9:	48 89 de             	mov    %rbx,%rsi
+  801ccc:	48 bf 13 73 80 00 00 	movabs $0x807313,%rdi
+  801cd3:	00 00 00 
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	48 b9 e7 4c 80 00 00 	movabs $0x804ce7,%rcx
+  801ce2:	00 00 00 
+  801ce5:	ff d1                	call   *%rcx
+  801ce7:	eb 53                	jmp    801d3c <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  801ce9:	89 c1                	mov    %eax,%ecx
+  801ceb:	48 ba 2c 79 80 00 00 	movabs $0x80792c,%rdx
+  801cf2:	00 00 00 
+  801cf5:	be 27 01 00 00       	mov    $0x127,%esi
+  801cfa:	48 bf d7 72 80 00 00 	movabs $0x8072d7,%rdi
+  801d01:	00 00 00 
+  801d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d09:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  801d10:	00 00 00 
+  801d13:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  801d16:	89 c7                	mov    %eax,%edi
+  801d18:	48 b8 00 5b 80 00 00 	movabs $0x805b00,%rax
+  801d1f:	00 00 00 
+  801d22:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  801d24:	4c 89 e7             	mov    %r12,%rdi
+  801d27:	41 ff d6             	call   *%r14
+  801d2a:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  801d2d:	48 85 c0             	test   %rax,%rax
+  801d30:	74 92                	je     801cc4 <umain+0x181>
+        if (buf[0] == '#') continue;
+  801d32:	80 3b 23             	cmpb   $0x23,(%rbx)
+  801d35:	74 ed                	je     801d24 <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  801d37:	45 85 ed             	test   %r13d,%r13d
+  801d3a:	75 8d                	jne    801cc9 <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  801d3c:	48 b8 7f 3a 80 00 00 	movabs $0x803a7f,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 9d                	js     801ce9 <umain+0x1a6>
+        if (r == 0) {
+  801d4c:	75 c8                	jne    801d16 <umain+0x1d3>
+            runcmd(buf);
+  801d4e:	48 89 df             	mov    %rbx,%rdi
+  801d51:	48 b8 80 16 80 00 00 	movabs $0x801680,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+            exit();
+  801d5d:	41 ff d7             	call   *%r15
+  801d60:	eb c2                	jmp    801d24 <umain+0x1e1>
+
+0000000000801d62 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d67:	c3                   	ret
+
+0000000000801d68 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  801d68:	55                   	push   %rbp
+  801d69:	48 89 e5             	mov    %rsp,%rbp
+  801d6c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801d6f:	48 be 91 73 80 00 00 	movabs $0x807391,%rsi
+  801d76:	00 00 00 
+  801d79:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  801d80:	00 00 00 
+  801d83:	ff d0                	call   *%rax
+    return 0;
+}
+  801d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8a:	5d                   	pop    %rbp
+  801d8b:	c3                   	ret
+
+0000000000801d8c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  801d8c:	55                   	push   %rbp
+  801d8d:	48 89 e5             	mov    %rsp,%rbp
+  801d90:	41 57                	push   %r15
+  801d92:	41 56                	push   %r14
+  801d94:	41 55                	push   %r13
+  801d96:	41 54                	push   %r12
+  801d98:	53                   	push   %rbx
+  801d99:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801da0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  801da7:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  801dae:	00 00 00 00 
+  801db2:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  801db9:	00 00 00 00 
+  801dbd:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  801dc4:	00 00 00 00 
+  801dc8:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  801dcf:	00 00 00 00 
+  801dd3:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  801dda:	00 00 00 00 
+  801dde:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  801de5:	00 00 00 00 
+  801de9:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  801df0:	00 
+  801df1:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  801df8:	00 
+  801df9:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  801e00:	00 
+  801e01:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  801e08:	00 
+  801e09:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e10:	00 
+  801e11:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801e18:	00 
+  801e19:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801e20:	00 
+  801e21:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801e28:	00 
+  801e29:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801e30:	00 
+  801e31:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801e38:	00 
+    for (res = 0; res < n; res += inc) {
+  801e39:	48 85 d2             	test   %rdx,%rdx
+  801e3c:	74 7a                	je     801eb8 <devcons_write+0x12c>
+  801e3e:	49 89 d6             	mov    %rdx,%r14
+  801e41:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e47:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801e4c:	49 bf c2 2e 80 00 00 	movabs $0x802ec2,%r15
+  801e53:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801e56:	4c 89 f3             	mov    %r14,%rbx
+  801e59:	48 29 f3             	sub    %rsi,%rbx
+  801e5c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801e61:	48 39 c3             	cmp    %rax,%rbx
+  801e64:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801e68:	4c 63 eb             	movslq %ebx,%r13
+  801e6b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801e72:	48 01 c6             	add    %rax,%rsi
+  801e75:	4c 89 ea             	mov    %r13,%rdx
+  801e78:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801e7f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801e82:	4c 89 ee             	mov    %r13,%rsi
+  801e85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801e8c:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801e98:	41 01 dc             	add    %ebx,%r12d
+  801e9b:	49 63 f4             	movslq %r12d,%rsi
+  801e9e:	4c 39 f6             	cmp    %r14,%rsi
+  801ea1:	72 b3                	jb     801e56 <devcons_write+0xca>
+    return res;
+  801ea3:	49 63 c4             	movslq %r12d,%rax
+}
+  801ea6:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801ead:	5b                   	pop    %rbx
+  801eae:	41 5c                	pop    %r12
+  801eb0:	41 5d                	pop    %r13
+  801eb2:	41 5e                	pop    %r14
+  801eb4:	41 5f                	pop    %r15
+  801eb6:	5d                   	pop    %rbp
+  801eb7:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801eb8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ebe:	eb e3                	jmp    801ea3 <devcons_write+0x117>
+
+0000000000801ec0 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ec0:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec8:	48 85 c0             	test   %rax,%rax
+  801ecb:	74 55                	je     801f22 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801ecd:	55                   	push   %rbp
+  801ece:	48 89 e5             	mov    %rsp,%rbp
+  801ed1:	41 55                	push   %r13
+  801ed3:	41 54                	push   %r12
+  801ed5:	53                   	push   %rbx
+  801ed6:	48 83 ec 08          	sub    $0x8,%rsp
+  801eda:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801edd:	48 bb 6c 32 80 00 00 	movabs $0x80326c,%rbx
+  801ee4:	00 00 00 
+  801ee7:	49 bc 80 33 80 00 00 	movabs $0x803380,%r12
+  801eee:	00 00 00 
+  801ef1:	eb 03                	jmp    801ef6 <devcons_read+0x36>
+  801ef3:	41 ff d4             	call   *%r12
+  801ef6:	ff d3                	call   *%rbx
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	74 f7                	je     801ef3 <devcons_read+0x33>
+    if (c < 0) return c;
+  801efc:	48 63 d0             	movslq %eax,%rdx
+  801eff:	78 13                	js     801f14 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801f01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f06:	83 f8 04             	cmp    $0x4,%eax
+  801f09:	74 09                	je     801f14 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801f0b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801f0f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801f14:	48 89 d0             	mov    %rdx,%rax
+  801f17:	48 83 c4 08          	add    $0x8,%rsp
+  801f1b:	5b                   	pop    %rbx
+  801f1c:	41 5c                	pop    %r12
+  801f1e:	41 5d                	pop    %r13
+  801f20:	5d                   	pop    %rbp
+  801f21:	c3                   	ret
+  801f22:	48 89 d0             	mov    %rdx,%rax
+  801f25:	c3                   	ret
+
+0000000000801f26 <cputchar>:
+cputchar(int ch) {
+  801f26:	55                   	push   %rbp
+  801f27:	48 89 e5             	mov    %rsp,%rbp
+  801f2a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801f2e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801f32:	be 01 00 00 00       	mov    $0x1,%esi
+  801f37:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801f3b:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+}
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+0000000000801f49 <getchar>:
+getchar(void) {
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801f51:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f56:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5f:	48 b8 1c 41 80 00 00 	movabs $0x80411c,%rax
+  801f66:	00 00 00 
+  801f69:	ff d0                	call   *%rax
+  801f6b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 06                	js     801f77 <getchar+0x2e>
+  801f71:	74 08                	je     801f7b <getchar+0x32>
+  801f73:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801f77:	89 d0                	mov    %edx,%eax
+  801f79:	c9                   	leave
+  801f7a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801f7b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801f80:	eb f5                	jmp    801f77 <getchar+0x2e>
+
+0000000000801f82 <iscons>:
+iscons(int fdnum) {
+  801f82:	55                   	push   %rbp
+  801f83:	48 89 e5             	mov    %rsp,%rbp
+  801f86:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801f8a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f8e:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	78 18                	js     801fb6 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801f9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801fa2:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  801fa9:	00 00 00 
+  801fac:	8b 00                	mov    (%rax),%eax
+  801fae:	39 02                	cmp    %eax,(%rdx)
+  801fb0:	0f 94 c0             	sete   %al
+  801fb3:	0f b6 c0             	movzbl %al,%eax
+}
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+
+0000000000801fb8 <opencons>:
+opencons(void) {
+  801fb8:	55                   	push   %rbp
+  801fb9:	48 89 e5             	mov    %rsp,%rbp
+  801fbc:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801fc0:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801fc4:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 49                	js     80201d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801fd4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801fd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fde:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801fe2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe7:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	85 c0                	test   %eax,%eax
+  801ff5:	78 26                	js     80201d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801ff7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ffb:	a1 40 80 80 00 00 00 	movabs 0x808040,%eax
+  802002:	00 00 
+  802004:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  802006:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80200a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  802011:	48 b8 ab 3d 80 00 00 	movabs $0x803dab,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+}
+  80201d:	c9                   	leave
+  80201e:	c3                   	ret
+
+000000000080201f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80201f:	55                   	push   %rbp
+  802020:	48 89 e5             	mov    %rsp,%rbp
+  802023:	41 56                	push   %r14
+  802025:	41 55                	push   %r13
+  802027:	41 54                	push   %r12
+  802029:	53                   	push   %rbx
+  80202a:	41 89 fd             	mov    %edi,%r13d
+  80202d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  802030:	48 ba f8 80 80 00 00 	movabs $0x8080f8,%rdx
+  802037:	00 00 00 
+  80203a:	48 b8 f8 80 80 00 00 	movabs $0x8080f8,%rax
+  802041:	00 00 00 
+  802044:	48 39 c2             	cmp    %rax,%rdx
+  802047:	73 17                	jae    802060 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  802049:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80204c:	49 89 c4             	mov    %rax,%r12
+  80204f:	48 83 c3 08          	add    $0x8,%rbx
+  802053:	b8 00 00 00 00       	mov    $0x0,%eax
+  802058:	ff 53 f8             	call   *-0x8(%rbx)
+  80205b:	4c 39 e3             	cmp    %r12,%rbx
+  80205e:	72 ef                	jb     80204f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  802060:	48 b8 49 33 80 00 00 	movabs $0x803349,%rax
+  802067:	00 00 00 
+  80206a:	ff d0                	call   *%rax
+  80206c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802071:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802078:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80207f:	00 00 00 
+  802082:	48 01 d0             	add    %rdx,%rax
+  802085:	48 a3 38 90 80 01 00 	movabs %rax,0x1809038
+  80208c:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80208f:	45 85 ed             	test   %r13d,%r13d
+  802092:	7e 0d                	jle    8020a1 <libmain+0x82>
+  802094:	49 8b 06             	mov    (%r14),%rax
+  802097:	48 a3 78 80 80 00 00 	movabs %rax,0x808078
+  80209e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8020a1:	4c 89 f6             	mov    %r14,%rsi
+  8020a4:	44 89 ef             	mov    %r13d,%edi
+  8020a7:	48 b8 43 1b 80 00 00 	movabs $0x801b43,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8020b3:	48 b8 c8 20 80 00 00 	movabs $0x8020c8,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+#endif
+}
+  8020bf:	5b                   	pop    %rbx
+  8020c0:	41 5c                	pop    %r12
+  8020c2:	41 5d                	pop    %r13
+  8020c4:	41 5e                	pop    %r14
+  8020c6:	5d                   	pop    %rbp
+  8020c7:	c3                   	ret
+
+00000000008020c8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8020c8:	55                   	push   %rbp
+  8020c9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8020cc:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  8020d3:	00 00 00 
+  8020d6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8020d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020dd:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+}
+  8020e9:	5d                   	pop    %rbp
+  8020ea:	c3                   	ret
+
+00000000008020eb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8020eb:	55                   	push   %rbp
+  8020ec:	48 89 e5             	mov    %rsp,%rbp
+  8020ef:	41 56                	push   %r14
+  8020f1:	41 55                	push   %r13
+  8020f3:	41 54                	push   %r12
+  8020f5:	53                   	push   %rbx
+  8020f6:	48 83 ec 50          	sub    $0x50,%rsp
+  8020fa:	49 89 fc             	mov    %rdi,%r12
+  8020fd:	41 89 f5             	mov    %esi,%r13d
+  802100:	48 89 d3             	mov    %rdx,%rbx
+  802103:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802107:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80210b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80210f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802116:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80211a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80211e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  802122:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802126:	48 b8 78 80 80 00 00 	movabs $0x808078,%rax
+  80212d:	00 00 00 
+  802130:	4c 8b 30             	mov    (%rax),%r14
+  802133:	48 b8 49 33 80 00 00 	movabs $0x803349,%rax
+  80213a:	00 00 00 
+  80213d:	ff d0                	call   *%rax
+  80213f:	89 c6                	mov    %eax,%esi
+  802141:	45 89 e8             	mov    %r13d,%r8d
+  802144:	4c 89 e1             	mov    %r12,%rcx
+  802147:	4c 89 f2             	mov    %r14,%rdx
+  80214a:	48 bf a8 73 80 00 00 	movabs $0x8073a8,%rdi
+  802151:	00 00 00 
+  802154:	b8 00 00 00 00       	mov    $0x0,%eax
+  802159:	49 bc 3b 22 80 00 00 	movabs $0x80223b,%r12
+  802160:	00 00 00 
+  802163:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  802166:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80216a:	48 89 df             	mov    %rbx,%rdi
+  80216d:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+    cprintf("\n");
+  802179:	48 bf 65 72 80 00 00 	movabs $0x807265,%rdi
+  802180:	00 00 00 
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+  802188:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80218b:	cc                   	int3
+  80218c:	eb fd                	jmp    80218b <_panic+0xa0>
+
+000000000080218e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80218e:	55                   	push   %rbp
+  80218f:	48 89 e5             	mov    %rsp,%rbp
+  802192:	53                   	push   %rbx
+  802193:	48 83 ec 08          	sub    $0x8,%rsp
+  802197:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80219a:	8b 06                	mov    (%rsi),%eax
+  80219c:	8d 50 01             	lea    0x1(%rax),%edx
+  80219f:	89 16                	mov    %edx,(%rsi)
+  8021a1:	48 98                	cltq
+  8021a3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8021a8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8021ae:	74 0a                	je     8021ba <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8021b0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8021b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8021ba:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8021be:	be ff 00 00 00       	mov    $0xff,%esi
+  8021c3:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  8021ca:	00 00 00 
+  8021cd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8021cf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8021d5:	eb d9                	jmp    8021b0 <putch+0x22>
+
+00000000008021d7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8021d7:	55                   	push   %rbp
+  8021d8:	48 89 e5             	mov    %rsp,%rbp
+  8021db:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8021e2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8021e5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8021ec:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8021f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8021f9:	48 89 f1             	mov    %rsi,%rcx
+  8021fc:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  802203:	48 bf 8e 21 80 00 00 	movabs $0x80218e,%rdi
+  80220a:	00 00 00 
+  80220d:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  802214:	00 00 00 
+  802217:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802219:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  802220:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802227:	48 b8 39 32 80 00 00 	movabs $0x803239,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  802233:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  802239:	c9                   	leave
+  80223a:	c3                   	ret
+
+000000000080223b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80223b:	55                   	push   %rbp
+  80223c:	48 89 e5             	mov    %rsp,%rbp
+  80223f:	48 83 ec 50          	sub    $0x50,%rsp
+  802243:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  802247:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80224b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80224f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802253:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  802257:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80225e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802262:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802266:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80226a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80226e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  802272:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  802279:	00 00 00 
+  80227c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80227e:	c9                   	leave
+  80227f:	c3                   	ret
+
+0000000000802280 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  802280:	55                   	push   %rbp
+  802281:	48 89 e5             	mov    %rsp,%rbp
+  802284:	41 57                	push   %r15
+  802286:	41 56                	push   %r14
+  802288:	41 55                	push   %r13
+  80228a:	41 54                	push   %r12
+  80228c:	53                   	push   %rbx
+  80228d:	48 83 ec 18          	sub    $0x18,%rsp
+  802291:	49 89 fc             	mov    %rdi,%r12
+  802294:	49 89 f5             	mov    %rsi,%r13
+  802297:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80229b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80229e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8022a1:	41 89 cf             	mov    %ecx,%r15d
+  8022a4:	4c 39 fa             	cmp    %r15,%rdx
+  8022a7:	73 5b                	jae    802304 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8022a9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8022ad:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8022b1:	85 db                	test   %ebx,%ebx
+  8022b3:	7e 0e                	jle    8022c3 <print_num+0x43>
+            putch(padc, put_arg);
+  8022b5:	4c 89 ee             	mov    %r13,%rsi
+  8022b8:	44 89 f7             	mov    %r14d,%edi
+  8022bb:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8022be:	83 eb 01             	sub    $0x1,%ebx
+  8022c1:	75 f2                	jne    8022b5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8022c3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8022c7:	48 b9 dc 73 80 00 00 	movabs $0x8073dc,%rcx
+  8022ce:	00 00 00 
+  8022d1:	48 b8 cb 73 80 00 00 	movabs $0x8073cb,%rax
+  8022d8:	00 00 00 
+  8022db:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8022df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e8:	49 f7 f7             	div    %r15
+  8022eb:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8022ef:	4c 89 ee             	mov    %r13,%rsi
+  8022f2:	41 ff d4             	call   *%r12
+}
+  8022f5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8022f9:	5b                   	pop    %rbx
+  8022fa:	41 5c                	pop    %r12
+  8022fc:	41 5d                	pop    %r13
+  8022fe:	41 5e                	pop    %r14
+  802300:	41 5f                	pop    %r15
+  802302:	5d                   	pop    %rbp
+  802303:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  802304:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802308:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230d:	49 f7 f7             	div    %r15
+  802310:	48 83 ec 08          	sub    $0x8,%rsp
+  802314:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802318:	52                   	push   %rdx
+  802319:	45 0f be c9          	movsbl %r9b,%r9d
+  80231d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  802321:	48 89 c2             	mov    %rax,%rdx
+  802324:	48 b8 80 22 80 00 00 	movabs $0x802280,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	48 83 c4 10          	add    $0x10,%rsp
+  802334:	eb 8d                	jmp    8022c3 <print_num+0x43>
+
+0000000000802336 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  802336:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80233a:	48 8b 06             	mov    (%rsi),%rax
+  80233d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  802341:	73 0a                	jae    80234d <sprintputch+0x17>
+        *state->start++ = ch;
+  802343:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802347:	48 89 16             	mov    %rdx,(%rsi)
+  80234a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80234d:	c3                   	ret
+
+000000000080234e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80234e:	55                   	push   %rbp
+  80234f:	48 89 e5             	mov    %rsp,%rbp
+  802352:	48 83 ec 50          	sub    $0x50,%rsp
+  802356:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80235a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80235e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  802362:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802369:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80236d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802371:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802375:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  802379:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80237d:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+}
+  802389:	c9                   	leave
+  80238a:	c3                   	ret
+
+000000000080238b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80238b:	55                   	push   %rbp
+  80238c:	48 89 e5             	mov    %rsp,%rbp
+  80238f:	41 57                	push   %r15
+  802391:	41 56                	push   %r14
+  802393:	41 55                	push   %r13
+  802395:	41 54                	push   %r12
+  802397:	53                   	push   %rbx
+  802398:	48 83 ec 38          	sub    $0x38,%rsp
+  80239c:	49 89 fe             	mov    %rdi,%r14
+  80239f:	49 89 f5             	mov    %rsi,%r13
+  8023a2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8023a5:	48 8b 01             	mov    (%rcx),%rax
+  8023a8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8023ac:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8023b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023b4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8023b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8023bc:	eb 0d                	jmp    8023cb <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8023be:	40 0f b6 ff          	movzbl %dil,%edi
+  8023c2:	4c 89 ee             	mov    %r13,%rsi
+  8023c5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8023c8:	4c 89 e3             	mov    %r12,%rbx
+  8023cb:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8023cf:	0f b6 3b             	movzbl (%rbx),%edi
+  8023d2:	40 80 ff 25          	cmp    $0x25,%dil
+  8023d6:	74 14                	je     8023ec <vprintfmt+0x61>
+            if (!ch) return;
+  8023d8:	40 84 ff             	test   %dil,%dil
+  8023db:	75 e1                	jne    8023be <vprintfmt+0x33>
+}
+  8023dd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8023e1:	5b                   	pop    %rbx
+  8023e2:	41 5c                	pop    %r12
+  8023e4:	41 5d                	pop    %r13
+  8023e6:	41 5e                	pop    %r14
+  8023e8:	41 5f                	pop    %r15
+  8023ea:	5d                   	pop    %rbp
+  8023eb:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8023ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f1:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8023f5:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8023fa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802400:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802407:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80240b:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802410:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802415:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802418:	83 e8 23             	sub    $0x23,%eax
+  80241b:	3c 57                	cmp    $0x57,%al
+  80241d:	0f 87 67 06 00 00    	ja     802a8a <vprintfmt+0x6ff>
+  802423:	0f b6 c0             	movzbl %al,%eax
+  802426:	48 b9 60 75 80 00 00 	movabs $0x807560,%rcx
+  80242d:	00 00 00 
+  802430:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  802433:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  802436:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80243a:	eb cf                	jmp    80240b <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80243c:	49 89 dc             	mov    %rbx,%r12
+  80243f:	be 01 00 00 00       	mov    $0x1,%esi
+  802444:	eb c5                	jmp    80240b <vprintfmt+0x80>
+            padc = ch;
+  802446:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80244a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80244d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802450:	eb b9                	jmp    80240b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  802452:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802455:	83 f8 2f             	cmp    $0x2f,%eax
+  802458:	77 24                	ja     80247e <vprintfmt+0xf3>
+  80245a:	89 c1                	mov    %eax,%ecx
+  80245c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  802460:	83 c0 08             	add    $0x8,%eax
+  802463:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802466:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  802469:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80246c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  802470:	79 99                	jns    80240b <vprintfmt+0x80>
+                width = precision;
+  802472:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  802476:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80247c:	eb 8d                	jmp    80240b <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80247e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802482:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  802486:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80248a:	eb da                	jmp    802466 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  80248c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  802491:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802495:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80249b:	3c 39                	cmp    $0x39,%al
+  80249d:	77 1c                	ja     8024bb <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80249f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8024a3:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8024a7:	0f b6 c0             	movzbl %al,%eax
+  8024aa:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8024af:	0f b6 03             	movzbl (%rbx),%eax
+  8024b2:	3c 39                	cmp    $0x39,%al
+  8024b4:	76 e9                	jbe    80249f <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8024b6:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8024b9:	eb b1                	jmp    80246c <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8024bb:	49 89 dc             	mov    %rbx,%r12
+  8024be:	eb ac                	jmp    80246c <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8024c0:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8024c3:	85 c9                	test   %ecx,%ecx
+  8024c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ca:	0f 49 c1             	cmovns %ecx,%eax
+  8024cd:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8024d0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8024d3:	e9 33 ff ff ff       	jmp    80240b <vprintfmt+0x80>
+            lflag++;
+  8024d8:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8024db:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8024de:	e9 28 ff ff ff       	jmp    80240b <vprintfmt+0x80>
+            lflag--;
+  8024e3:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8024e6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8024e9:	e9 1d ff ff ff       	jmp    80240b <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  8024ee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8024f4:	77 19                	ja     80250f <vprintfmt+0x184>
+  8024f6:	89 c2                	mov    %eax,%edx
+  8024f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024fc:	83 c0 08             	add    $0x8,%eax
+  8024ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802502:	8b 3a                	mov    (%rdx),%edi
+  802504:	4c 89 ee             	mov    %r13,%rsi
+  802507:	41 ff d6             	call   *%r14
+            break;
+  80250a:	e9 bc fe ff ff       	jmp    8023cb <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80250f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802513:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802517:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80251b:	eb e5                	jmp    802502 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  80251d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802520:	83 f8 2f             	cmp    $0x2f,%eax
+  802523:	77 5a                	ja     80257f <vprintfmt+0x1f4>
+  802525:	89 c2                	mov    %eax,%edx
+  802527:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80252b:	83 c0 08             	add    $0x8,%eax
+  80252e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802531:	8b 02                	mov    (%rdx),%eax
+  802533:	89 c1                	mov    %eax,%ecx
+  802535:	f7 d9                	neg    %ecx
+  802537:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80253a:	83 f9 13             	cmp    $0x13,%ecx
+  80253d:	7f 4e                	jg     80258d <vprintfmt+0x202>
+  80253f:	48 63 c1             	movslq %ecx,%rax
+  802542:	48 ba 20 78 80 00 00 	movabs $0x807820,%rdx
+  802549:	00 00 00 
+  80254c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802550:	48 85 c0             	test   %rax,%rax
+  802553:	74 38                	je     80258d <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  802555:	48 89 c1             	mov    %rax,%rcx
+  802558:	48 ba 0d 73 80 00 00 	movabs $0x80730d,%rdx
+  80255f:	00 00 00 
+  802562:	4c 89 ee             	mov    %r13,%rsi
+  802565:	4c 89 f7             	mov    %r14,%rdi
+  802568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256d:	49 b8 4e 23 80 00 00 	movabs $0x80234e,%r8
+  802574:	00 00 00 
+  802577:	41 ff d0             	call   *%r8
+  80257a:	e9 4c fe ff ff       	jmp    8023cb <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  80257f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802583:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802587:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80258b:	eb a4                	jmp    802531 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  80258d:	48 ba f4 73 80 00 00 	movabs $0x8073f4,%rdx
+  802594:	00 00 00 
+  802597:	4c 89 ee             	mov    %r13,%rsi
+  80259a:	4c 89 f7             	mov    %r14,%rdi
+  80259d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a2:	49 b8 4e 23 80 00 00 	movabs $0x80234e,%r8
+  8025a9:	00 00 00 
+  8025ac:	41 ff d0             	call   *%r8
+  8025af:	e9 17 fe ff ff       	jmp    8023cb <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  8025b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8025ba:	77 6c                	ja     802628 <vprintfmt+0x29d>
+  8025bc:	89 c2                	mov    %eax,%edx
+  8025be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8025c2:	83 c0 08             	add    $0x8,%eax
+  8025c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8025c8:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  8025cb:	48 85 f6             	test   %rsi,%rsi
+  8025ce:	48 b8 ed 73 80 00 00 	movabs $0x8073ed,%rax
+  8025d5:	00 00 00 
+  8025d8:	48 0f 45 c6          	cmovne %rsi,%rax
+  8025dc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8025e0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8025e4:	7e 06                	jle    8025ec <vprintfmt+0x261>
+  8025e6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8025ea:	75 4a                	jne    802636 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8025ec:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025f0:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8025f4:	0f b6 00             	movzbl (%rax),%eax
+  8025f7:	84 c0                	test   %al,%al
+  8025f9:	0f 85 9a 00 00 00    	jne    802699 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  8025ff:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802602:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802606:	85 c0                	test   %eax,%eax
+  802608:	0f 8e bd fd ff ff    	jle    8023cb <vprintfmt+0x40>
+  80260e:	4c 89 ee             	mov    %r13,%rsi
+  802611:	bf 20 00 00 00       	mov    $0x20,%edi
+  802616:	41 ff d6             	call   *%r14
+  802619:	41 83 ec 01          	sub    $0x1,%r12d
+  80261d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802621:	75 eb                	jne    80260e <vprintfmt+0x283>
+  802623:	e9 a3 fd ff ff       	jmp    8023cb <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  802628:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80262c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802630:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802634:	eb 92                	jmp    8025c8 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  802636:	49 63 f7             	movslq %r15d,%rsi
+  802639:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80263d:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802644:	00 00 00 
+  802647:	ff d0                	call   *%rax
+  802649:	48 89 c2             	mov    %rax,%rdx
+  80264c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80264f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  802651:	8d 50 ff             	lea    -0x1(%rax),%edx
+  802654:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  802657:	85 c0                	test   %eax,%eax
+  802659:	7e 91                	jle    8025ec <vprintfmt+0x261>
+  80265b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  802660:	4c 89 ee             	mov    %r13,%rsi
+  802663:	44 89 e7             	mov    %r12d,%edi
+  802666:	41 ff d6             	call   *%r14
+  802669:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80266d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802670:	83 f8 ff             	cmp    $0xffffffff,%eax
+  802673:	75 eb                	jne    802660 <vprintfmt+0x2d5>
+  802675:	e9 72 ff ff ff       	jmp    8025ec <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80267a:	0f b6 f8             	movzbl %al,%edi
+  80267d:	4c 89 ee             	mov    %r13,%rsi
+  802680:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802683:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  802687:	49 83 c4 01          	add    $0x1,%r12
+  80268b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  802691:	84 c0                	test   %al,%al
+  802693:	0f 84 66 ff ff ff    	je     8025ff <vprintfmt+0x274>
+  802699:	45 85 ff             	test   %r15d,%r15d
+  80269c:	78 0a                	js     8026a8 <vprintfmt+0x31d>
+  80269e:	41 83 ef 01          	sub    $0x1,%r15d
+  8026a2:	0f 88 57 ff ff ff    	js     8025ff <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8026a8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8026ac:	74 cc                	je     80267a <vprintfmt+0x2ef>
+  8026ae:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8026b1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8026b6:	80 fa 5e             	cmp    $0x5e,%dl
+  8026b9:	77 c2                	ja     80267d <vprintfmt+0x2f2>
+  8026bb:	eb bd                	jmp    80267a <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  8026bd:	40 84 f6             	test   %sil,%sil
+  8026c0:	75 26                	jne    8026e8 <vprintfmt+0x35d>
+    switch (lflag) {
+  8026c2:	85 d2                	test   %edx,%edx
+  8026c4:	74 59                	je     80271f <vprintfmt+0x394>
+  8026c6:	83 fa 01             	cmp    $0x1,%edx
+  8026c9:	74 7b                	je     802746 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  8026cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8026d1:	0f 87 96 00 00 00    	ja     80276d <vprintfmt+0x3e2>
+  8026d7:	89 c2                	mov    %eax,%edx
+  8026d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026dd:	83 c0 08             	add    $0x8,%eax
+  8026e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026e3:	4c 8b 22             	mov    (%rdx),%r12
+  8026e6:	eb 17                	jmp    8026ff <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  8026e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8026ee:	77 21                	ja     802711 <vprintfmt+0x386>
+  8026f0:	89 c2                	mov    %eax,%edx
+  8026f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026f6:	83 c0 08             	add    $0x8,%eax
+  8026f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026fc:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8026ff:	4d 85 e4             	test   %r12,%r12
+  802702:	78 7a                	js     80277e <vprintfmt+0x3f3>
+            num = i;
+  802704:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802707:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80270c:	e9 56 02 00 00       	jmp    802967 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802711:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802715:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802719:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80271d:	eb dd                	jmp    8026fc <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  80271f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802722:	83 f8 2f             	cmp    $0x2f,%eax
+  802725:	77 11                	ja     802738 <vprintfmt+0x3ad>
+  802727:	89 c2                	mov    %eax,%edx
+  802729:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80272d:	83 c0 08             	add    $0x8,%eax
+  802730:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802733:	4c 63 22             	movslq (%rdx),%r12
+  802736:	eb c7                	jmp    8026ff <vprintfmt+0x374>
+  802738:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80273c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802740:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802744:	eb ed                	jmp    802733 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  802746:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802749:	83 f8 2f             	cmp    $0x2f,%eax
+  80274c:	77 11                	ja     80275f <vprintfmt+0x3d4>
+  80274e:	89 c2                	mov    %eax,%edx
+  802750:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802754:	83 c0 08             	add    $0x8,%eax
+  802757:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80275a:	4c 8b 22             	mov    (%rdx),%r12
+  80275d:	eb a0                	jmp    8026ff <vprintfmt+0x374>
+  80275f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802763:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802767:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80276b:	eb ed                	jmp    80275a <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  80276d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802771:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802775:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802779:	e9 65 ff ff ff       	jmp    8026e3 <vprintfmt+0x358>
+                putch('-', put_arg);
+  80277e:	4c 89 ee             	mov    %r13,%rsi
+  802781:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802786:	41 ff d6             	call   *%r14
+                i = -i;
+  802789:	49 f7 dc             	neg    %r12
+  80278c:	e9 73 ff ff ff       	jmp    802704 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802791:	40 84 f6             	test   %sil,%sil
+  802794:	75 2e                	jne    8027c4 <vprintfmt+0x439>
+    switch (lflag) {
+  802796:	85 d2                	test   %edx,%edx
+  802798:	7f 59                	jg     8027f3 <vprintfmt+0x468>
+  80279a:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80279d:	7d 7a                	jge    802819 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  80279f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8027a5:	0f 87 aa 00 00 00    	ja     802855 <vprintfmt+0x4ca>
+  8027ab:	89 c2                	mov    %eax,%edx
+  8027ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8027b1:	83 c0 08             	add    $0x8,%eax
+  8027b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8027b7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8027ba:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8027bf:	e9 a3 01 00 00       	jmp    802967 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8027c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8027ca:	77 19                	ja     8027e5 <vprintfmt+0x45a>
+  8027cc:	89 c2                	mov    %eax,%edx
+  8027ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8027d2:	83 c0 08             	add    $0x8,%eax
+  8027d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8027d8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8027db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8027e0:	e9 82 01 00 00       	jmp    802967 <vprintfmt+0x5dc>
+  8027e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8027ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027f1:	eb e5                	jmp    8027d8 <vprintfmt+0x44d>
+    switch (lflag) {
+  8027f3:	83 fa 01             	cmp    $0x1,%edx
+  8027f6:	75 a7                	jne    80279f <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  8027f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8027fe:	77 47                	ja     802847 <vprintfmt+0x4bc>
+  802800:	89 c2                	mov    %eax,%edx
+  802802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802806:	83 c0 08             	add    $0x8,%eax
+  802809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80280c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80280f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802814:	e9 4e 01 00 00       	jmp    802967 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802819:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80281c:	83 f8 2f             	cmp    $0x2f,%eax
+  80281f:	77 18                	ja     802839 <vprintfmt+0x4ae>
+  802821:	89 c2                	mov    %eax,%edx
+  802823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802827:	83 c0 08             	add    $0x8,%eax
+  80282a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80282d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80282f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802834:	e9 2e 01 00 00       	jmp    802967 <vprintfmt+0x5dc>
+  802839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80283d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802845:	eb e6                	jmp    80282d <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802847:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80284b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80284f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802853:	eb b7                	jmp    80280c <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802855:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802859:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80285d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802861:	e9 51 ff ff ff       	jmp    8027b7 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802866:	40 84 f6             	test   %sil,%sil
+  802869:	75 2e                	jne    802899 <vprintfmt+0x50e>
+    switch (lflag) {
+  80286b:	85 d2                	test   %edx,%edx
+  80286d:	7f 59                	jg     8028c8 <vprintfmt+0x53d>
+  80286f:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802872:	7d 77                	jge    8028eb <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802874:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802877:	83 f8 2f             	cmp    $0x2f,%eax
+  80287a:	0f 87 a4 00 00 00    	ja     802924 <vprintfmt+0x599>
+  802880:	89 c2                	mov    %eax,%edx
+  802882:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802886:	83 c0 08             	add    $0x8,%eax
+  802889:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80288c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80288f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802894:	e9 ce 00 00 00       	jmp    802967 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802899:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80289c:	83 f8 2f             	cmp    $0x2f,%eax
+  80289f:	77 19                	ja     8028ba <vprintfmt+0x52f>
+  8028a1:	89 c2                	mov    %eax,%edx
+  8028a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028a7:	83 c0 08             	add    $0x8,%eax
+  8028aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8028b0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8028b5:	e9 ad 00 00 00       	jmp    802967 <vprintfmt+0x5dc>
+  8028ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8028be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8028c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028c6:	eb e5                	jmp    8028ad <vprintfmt+0x522>
+    switch (lflag) {
+  8028c8:	83 fa 01             	cmp    $0x1,%edx
+  8028cb:	75 a7                	jne    802874 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8028cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8028d3:	77 41                	ja     802916 <vprintfmt+0x58b>
+  8028d5:	89 c2                	mov    %eax,%edx
+  8028d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028db:	83 c0 08             	add    $0x8,%eax
+  8028de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028e1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8028e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8028e9:	eb 7c                	jmp    802967 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8028eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8028f1:	77 15                	ja     802908 <vprintfmt+0x57d>
+  8028f3:	89 c2                	mov    %eax,%edx
+  8028f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028f9:	83 c0 08             	add    $0x8,%eax
+  8028fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028ff:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802901:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802906:	eb 5f                	jmp    802967 <vprintfmt+0x5dc>
+  802908:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80290c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802914:	eb e9                	jmp    8028ff <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80291a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80291e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802922:	eb bd                	jmp    8028e1 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802924:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802928:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80292c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802930:	e9 57 ff ff ff       	jmp    80288c <vprintfmt+0x501>
+            putch('0', put_arg);
+  802935:	4c 89 ee             	mov    %r13,%rsi
+  802938:	bf 30 00 00 00       	mov    $0x30,%edi
+  80293d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802940:	4c 89 ee             	mov    %r13,%rsi
+  802943:	bf 78 00 00 00       	mov    $0x78,%edi
+  802948:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80294b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80294e:	83 f8 2f             	cmp    $0x2f,%eax
+  802951:	77 47                	ja     80299a <vprintfmt+0x60f>
+  802953:	89 c2                	mov    %eax,%edx
+  802955:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802959:	83 c0 08             	add    $0x8,%eax
+  80295c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80295f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802962:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802967:	48 83 ec 08          	sub    $0x8,%rsp
+  80296b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80296f:	0f 94 c0             	sete   %al
+  802972:	0f b6 c0             	movzbl %al,%eax
+  802975:	50                   	push   %rax
+  802976:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80297b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80297f:	4c 89 ee             	mov    %r13,%rsi
+  802982:	4c 89 f7             	mov    %r14,%rdi
+  802985:	48 b8 80 22 80 00 00 	movabs $0x802280,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+            break;
+  802991:	48 83 c4 10          	add    $0x10,%rsp
+  802995:	e9 31 fa ff ff       	jmp    8023cb <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80299a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80299e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029a6:	eb b7                	jmp    80295f <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8029a8:	40 84 f6             	test   %sil,%sil
+  8029ab:	75 2b                	jne    8029d8 <vprintfmt+0x64d>
+    switch (lflag) {
+  8029ad:	85 d2                	test   %edx,%edx
+  8029af:	7f 56                	jg     802a07 <vprintfmt+0x67c>
+  8029b1:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8029b4:	7d 77                	jge    802a2d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8029b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8029bc:	0f 87 a7 00 00 00    	ja     802a69 <vprintfmt+0x6de>
+  8029c2:	89 c2                	mov    %eax,%edx
+  8029c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029c8:	83 c0 08             	add    $0x8,%eax
+  8029cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8029d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8029d6:	eb 8f                	jmp    802967 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8029d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8029db:	83 f8 2f             	cmp    $0x2f,%eax
+  8029de:	77 19                	ja     8029f9 <vprintfmt+0x66e>
+  8029e0:	89 c2                	mov    %eax,%edx
+  8029e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029e6:	83 c0 08             	add    $0x8,%eax
+  8029e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029ec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8029ef:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8029f4:	e9 6e ff ff ff       	jmp    802967 <vprintfmt+0x5dc>
+  8029f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a01:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a05:	eb e5                	jmp    8029ec <vprintfmt+0x661>
+    switch (lflag) {
+  802a07:	83 fa 01             	cmp    $0x1,%edx
+  802a0a:	75 aa                	jne    8029b6 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802a0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a0f:	83 f8 2f             	cmp    $0x2f,%eax
+  802a12:	77 47                	ja     802a5b <vprintfmt+0x6d0>
+  802a14:	89 c2                	mov    %eax,%edx
+  802a16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a1a:	83 c0 08             	add    $0x8,%eax
+  802a1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802a23:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802a28:	e9 3a ff ff ff       	jmp    802967 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802a2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802a30:	83 f8 2f             	cmp    $0x2f,%eax
+  802a33:	77 18                	ja     802a4d <vprintfmt+0x6c2>
+  802a35:	89 c2                	mov    %eax,%edx
+  802a37:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802a3b:	83 c0 08             	add    $0x8,%eax
+  802a3e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802a41:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802a43:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802a48:	e9 1a ff ff ff       	jmp    802967 <vprintfmt+0x5dc>
+  802a4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a59:	eb e6                	jmp    802a41 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a67:	eb b7                	jmp    802a20 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a75:	e9 54 ff ff ff       	jmp    8029ce <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802a7a:	4c 89 ee             	mov    %r13,%rsi
+  802a7d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802a82:	41 ff d6             	call   *%r14
+            break;
+  802a85:	e9 41 f9 ff ff       	jmp    8023cb <vprintfmt+0x40>
+            putch('%', put_arg);
+  802a8a:	4c 89 ee             	mov    %r13,%rsi
+  802a8d:	bf 25 00 00 00       	mov    $0x25,%edi
+  802a92:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802a95:	48 83 eb 01          	sub    $0x1,%rbx
+  802a99:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802a9d:	75 f6                	jne    802a95 <vprintfmt+0x70a>
+  802a9f:	e9 27 f9 ff ff       	jmp    8023cb <vprintfmt+0x40>
+
+0000000000802aa4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802aa4:	55                   	push   %rbp
+  802aa5:	48 89 e5             	mov    %rsp,%rbp
+  802aa8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802aac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802ab0:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802ab5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802ab9:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802ac0:	48 85 ff             	test   %rdi,%rdi
+  802ac3:	74 2b                	je     802af0 <vsnprintf+0x4c>
+  802ac5:	48 85 f6             	test   %rsi,%rsi
+  802ac8:	74 26                	je     802af0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802aca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802ace:	48 bf 36 23 80 00 00 	movabs $0x802336,%rdi
+  802ad5:	00 00 00 
+  802ad8:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802ae4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ae8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802aeb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802aee:	c9                   	leave
+  802aef:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802af0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af5:	eb f7                	jmp    802aee <vsnprintf+0x4a>
+
+0000000000802af7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802af7:	55                   	push   %rbp
+  802af8:	48 89 e5             	mov    %rsp,%rbp
+  802afb:	48 83 ec 50          	sub    $0x50,%rsp
+  802aff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802b03:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802b07:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802b0b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802b12:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802b16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b1a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802b1e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802b22:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802b26:	48 b8 a4 2a 80 00 00 	movabs $0x802aa4,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802b32:	c9                   	leave
+  802b33:	c3                   	ret
+
+0000000000802b34 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802b34:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802b37:	74 10                	je     802b49 <strlen+0x15>
+    size_t n = 0;
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802b3e:	48 83 c0 01          	add    $0x1,%rax
+  802b42:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802b46:	75 f6                	jne    802b3e <strlen+0xa>
+  802b48:	c3                   	ret
+    size_t n = 0;
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802b4e:	c3                   	ret
+
+0000000000802b4f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802b4f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802b52:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802b57:	48 85 f6             	test   %rsi,%rsi
+  802b5a:	74 11                	je     802b6d <strnlen+0x1e>
+  802b5c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802b60:	74 0c                	je     802b6e <strnlen+0x1f>
+  802b62:	48 83 c2 01          	add    $0x1,%rdx
+  802b66:	48 39 d0             	cmp    %rdx,%rax
+  802b69:	75 f1                	jne    802b5c <strnlen+0xd>
+  802b6b:	eb 04                	jmp    802b71 <strnlen+0x22>
+  802b6d:	c3                   	ret
+  802b6e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802b71:	c3                   	ret
+
+0000000000802b72 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802b72:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b7a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802b7e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802b81:	48 83 c2 01          	add    $0x1,%rdx
+  802b85:	84 c9                	test   %cl,%cl
+  802b87:	75 f1                	jne    802b7a <strcpy+0x8>
+        ;
+    return res;
+}
+  802b89:	c3                   	ret
+
+0000000000802b8a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802b8a:	55                   	push   %rbp
+  802b8b:	48 89 e5             	mov    %rsp,%rbp
+  802b8e:	41 54                	push   %r12
+  802b90:	53                   	push   %rbx
+  802b91:	48 89 fb             	mov    %rdi,%rbx
+  802b94:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802b97:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802ba3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802ba7:	4c 89 e6             	mov    %r12,%rsi
+  802baa:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  802bb1:	00 00 00 
+  802bb4:	ff d0                	call   *%rax
+    return dst;
+}
+  802bb6:	48 89 d8             	mov    %rbx,%rax
+  802bb9:	5b                   	pop    %rbx
+  802bba:	41 5c                	pop    %r12
+  802bbc:	5d                   	pop    %rbp
+  802bbd:	c3                   	ret
+
+0000000000802bbe <toupper>:
+
+int
+toupper(int ch) {
+  802bbe:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802bc0:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802bc3:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802bc6:	83 f9 1a             	cmp    $0x1a,%ecx
+  802bc9:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802bcc:	c3                   	ret
+
+0000000000802bcd <tolower>:
+
+int
+tolower(int ch) {
+  802bcd:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802bcf:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802bd2:	8d 57 20             	lea    0x20(%rdi),%edx
+  802bd5:	83 f9 1a             	cmp    $0x1a,%ecx
+  802bd8:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802bdb:	c3                   	ret
+
+0000000000802bdc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802bdc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802bdf:	48 85 d2             	test   %rdx,%rdx
+  802be2:	74 1f                	je     802c03 <strncpy+0x27>
+  802be4:	48 01 fa             	add    %rdi,%rdx
+  802be7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802bea:	48 83 c1 01          	add    $0x1,%rcx
+  802bee:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802bf2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802bf6:	41 80 f8 01          	cmp    $0x1,%r8b
+  802bfa:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802bfe:	48 39 ca             	cmp    %rcx,%rdx
+  802c01:	75 e7                	jne    802bea <strncpy+0xe>
+    }
+    return ret;
+}
+  802c03:	c3                   	ret
+
+0000000000802c04 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802c04:	48 89 f8             	mov    %rdi,%rax
+  802c07:	48 85 d2             	test   %rdx,%rdx
+  802c0a:	74 24                	je     802c30 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802c0c:	48 83 ea 01          	sub    $0x1,%rdx
+  802c10:	74 1b                	je     802c2d <strlcpy+0x29>
+  802c12:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802c16:	0f b6 16             	movzbl (%rsi),%edx
+  802c19:	84 d2                	test   %dl,%dl
+  802c1b:	74 10                	je     802c2d <strlcpy+0x29>
+            *dst++ = *src++;
+  802c1d:	48 83 c6 01          	add    $0x1,%rsi
+  802c21:	48 83 c0 01          	add    $0x1,%rax
+  802c25:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802c28:	48 39 c8             	cmp    %rcx,%rax
+  802c2b:	75 e9                	jne    802c16 <strlcpy+0x12>
+        *dst = '\0';
+  802c2d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802c30:	48 29 f8             	sub    %rdi,%rax
+}
+  802c33:	c3                   	ret
+
+0000000000802c34 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802c34:	0f b6 07             	movzbl (%rdi),%eax
+  802c37:	84 c0                	test   %al,%al
+  802c39:	74 13                	je     802c4e <strcmp+0x1a>
+  802c3b:	38 06                	cmp    %al,(%rsi)
+  802c3d:	75 0f                	jne    802c4e <strcmp+0x1a>
+  802c3f:	48 83 c7 01          	add    $0x1,%rdi
+  802c43:	48 83 c6 01          	add    $0x1,%rsi
+  802c47:	0f b6 07             	movzbl (%rdi),%eax
+  802c4a:	84 c0                	test   %al,%al
+  802c4c:	75 ed                	jne    802c3b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802c4e:	0f b6 c0             	movzbl %al,%eax
+  802c51:	0f b6 16             	movzbl (%rsi),%edx
+  802c54:	29 d0                	sub    %edx,%eax
+}
+  802c56:	c3                   	ret
+
+0000000000802c57 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802c57:	48 85 d2             	test   %rdx,%rdx
+  802c5a:	74 1f                	je     802c7b <strncmp+0x24>
+  802c5c:	0f b6 07             	movzbl (%rdi),%eax
+  802c5f:	84 c0                	test   %al,%al
+  802c61:	74 1e                	je     802c81 <strncmp+0x2a>
+  802c63:	3a 06                	cmp    (%rsi),%al
+  802c65:	75 1a                	jne    802c81 <strncmp+0x2a>
+  802c67:	48 83 c7 01          	add    $0x1,%rdi
+  802c6b:	48 83 c6 01          	add    $0x1,%rsi
+  802c6f:	48 83 ea 01          	sub    $0x1,%rdx
+  802c73:	75 e7                	jne    802c5c <strncmp+0x5>
+
+    if (!n) return 0;
+  802c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7a:	c3                   	ret
+  802c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c80:	c3                   	ret
+  802c81:	48 85 d2             	test   %rdx,%rdx
+  802c84:	74 09                	je     802c8f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802c86:	0f b6 07             	movzbl (%rdi),%eax
+  802c89:	0f b6 16             	movzbl (%rsi),%edx
+  802c8c:	29 d0                	sub    %edx,%eax
+  802c8e:	c3                   	ret
+    if (!n) return 0;
+  802c8f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c94:	c3                   	ret
+
+0000000000802c95 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802c95:	0f b6 17             	movzbl (%rdi),%edx
+  802c98:	84 d2                	test   %dl,%dl
+  802c9a:	74 18                	je     802cb4 <strchr+0x1f>
+        if (*str == c) {
+  802c9c:	0f be d2             	movsbl %dl,%edx
+  802c9f:	39 f2                	cmp    %esi,%edx
+  802ca1:	74 17                	je     802cba <strchr+0x25>
+    for (; *str; str++) {
+  802ca3:	48 83 c7 01          	add    $0x1,%rdi
+  802ca7:	0f b6 17             	movzbl (%rdi),%edx
+  802caa:	84 d2                	test   %dl,%dl
+  802cac:	75 ee                	jne    802c9c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb3:	c3                   	ret
+  802cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb9:	c3                   	ret
+  802cba:	48 89 f8             	mov    %rdi,%rax
+}
+  802cbd:	c3                   	ret
+
+0000000000802cbe <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802cbe:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802cc1:	0f b6 17             	movzbl (%rdi),%edx
+  802cc4:	84 d2                	test   %dl,%dl
+  802cc6:	74 13                	je     802cdb <strfind+0x1d>
+  802cc8:	0f be d2             	movsbl %dl,%edx
+  802ccb:	39 f2                	cmp    %esi,%edx
+  802ccd:	74 0b                	je     802cda <strfind+0x1c>
+  802ccf:	48 83 c0 01          	add    $0x1,%rax
+  802cd3:	0f b6 10             	movzbl (%rax),%edx
+  802cd6:	84 d2                	test   %dl,%dl
+  802cd8:	75 ee                	jne    802cc8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802cda:	c3                   	ret
+  802cdb:	c3                   	ret
+
+0000000000802cdc <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802cdc:	48 39 f7             	cmp    %rsi,%rdi
+  802cdf:	74 65                	je     802d46 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802ce1:	55                   	push   %rbp
+  802ce2:	48 89 e5             	mov    %rsp,%rbp
+  802ce5:	41 57                	push   %r15
+  802ce7:	41 56                	push   %r14
+  802ce9:	41 55                	push   %r13
+  802ceb:	41 54                	push   %r12
+  802ced:	53                   	push   %rbx
+  802cee:	48 83 ec 18          	sub    $0x18,%rsp
+  802cf2:	48 89 fb             	mov    %rdi,%rbx
+  802cf5:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802cf8:	49 bf cd 2b 80 00 00 	movabs $0x802bcd,%r15
+  802cff:	00 00 00 
+  802d02:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802d06:	41 0f b6 fd          	movzbl %r13b,%edi
+  802d0a:	41 ff d7             	call   *%r15
+  802d0d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802d10:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802d15:	41 0f b6 fe          	movzbl %r14b,%edi
+  802d19:	41 ff d7             	call   *%r15
+  802d1c:	89 c2                	mov    %eax,%edx
+  802d1e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802d21:	29 d0                	sub    %edx,%eax
+  802d23:	75 12                	jne    802d37 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802d25:	48 83 c3 01          	add    $0x1,%rbx
+  802d29:	45 84 ed             	test   %r13b,%r13b
+  802d2c:	74 09                	je     802d37 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802d2e:	49 83 c4 01          	add    $0x1,%r12
+  802d32:	45 84 f6             	test   %r14b,%r14b
+  802d35:	75 cb                	jne    802d02 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802d37:	48 83 c4 18          	add    $0x18,%rsp
+  802d3b:	5b                   	pop    %rbx
+  802d3c:	41 5c                	pop    %r12
+  802d3e:	41 5d                	pop    %r13
+  802d40:	41 5e                	pop    %r14
+  802d42:	41 5f                	pop    %r15
+  802d44:	5d                   	pop    %rbp
+  802d45:	c3                   	ret
+    if (p1 == p2) return 0;
+  802d46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d4b:	c3                   	ret
+
+0000000000802d4c <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802d4c:	48 39 f7             	cmp    %rsi,%rdi
+  802d4f:	74 7d                	je     802dce <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802d51:	55                   	push   %rbp
+  802d52:	48 89 e5             	mov    %rsp,%rbp
+  802d55:	41 57                	push   %r15
+  802d57:	41 56                	push   %r14
+  802d59:	41 55                	push   %r13
+  802d5b:	41 54                	push   %r12
+  802d5d:	53                   	push   %rbx
+  802d5e:	48 83 ec 18          	sub    $0x18,%rsp
+  802d62:	48 89 fb             	mov    %rdi,%rbx
+  802d65:	49 89 f4             	mov    %rsi,%r12
+  802d68:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802d6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802d70:	49 bf cd 2b 80 00 00 	movabs $0x802bcd,%r15
+  802d77:	00 00 00 
+    while (n--) {
+  802d7a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d7e:	48 39 c3             	cmp    %rax,%rbx
+  802d81:	74 37                	je     802dba <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802d83:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802d87:	41 0f b6 fd          	movzbl %r13b,%edi
+  802d8b:	41 ff d7             	call   *%r15
+  802d8e:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802d91:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802d96:	41 0f b6 fe          	movzbl %r14b,%edi
+  802d9a:	41 ff d7             	call   *%r15
+  802d9d:	89 c2                	mov    %eax,%edx
+  802d9f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802da2:	29 d0                	sub    %edx,%eax
+  802da4:	75 19                	jne    802dbf <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802da6:	48 83 c3 01          	add    $0x1,%rbx
+  802daa:	45 84 ed             	test   %r13b,%r13b
+  802dad:	74 10                	je     802dbf <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802daf:	49 83 c4 01          	add    $0x1,%r12
+  802db3:	45 84 f6             	test   %r14b,%r14b
+  802db6:	75 c2                	jne    802d7a <strncasecmp+0x2e>
+  802db8:	eb 05                	jmp    802dbf <strncasecmp+0x73>
+  802dba:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802dbf:	48 83 c4 18          	add    $0x18,%rsp
+  802dc3:	5b                   	pop    %rbx
+  802dc4:	41 5c                	pop    %r12
+  802dc6:	41 5d                	pop    %r13
+  802dc8:	41 5e                	pop    %r14
+  802dca:	41 5f                	pop    %r15
+  802dcc:	5d                   	pop    %rbp
+  802dcd:	c3                   	ret
+    if (p1 == p2) return 0;
+  802dce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dd3:	c3                   	ret
+
+0000000000802dd4 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802dd4:	83 e7 df             	and    $0xffffffdf,%edi
+  802dd7:	83 ef 41             	sub    $0x41,%edi
+  802dda:	83 ff 19             	cmp    $0x19,%edi
+  802ddd:	0f 96 c0             	setbe  %al
+}
+  802de0:	c3                   	ret
+
+0000000000802de1 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802de1:	83 ff 20             	cmp    $0x20,%edi
+  802de4:	0f 94 c0             	sete   %al
+  802de7:	83 ff 09             	cmp    $0x9,%edi
+  802dea:	0f 94 c2             	sete   %dl
+  802ded:	09 d0                	or     %edx,%eax
+}
+  802def:	c3                   	ret
+
+0000000000802df0 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802df0:	55                   	push   %rbp
+  802df1:	48 89 e5             	mov    %rsp,%rbp
+  802df4:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802df6:	48 bf df 78 80 00 00 	movabs $0x8078df,%rdi
+  802dfd:	00 00 00 
+  802e00:	48 b8 95 2c 80 00 00 	movabs $0x802c95,%rax
+  802e07:	00 00 00 
+  802e0a:	ff d0                	call   *%rax
+  802e0c:	48 85 c0             	test   %rax,%rax
+  802e0f:	0f 95 c0             	setne  %al
+}
+  802e12:	5d                   	pop    %rbp
+  802e13:	c3                   	ret
+
+0000000000802e14 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802e14:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802e17:	48 89 f8             	mov    %rdi,%rax
+  802e1a:	48 f7 d8             	neg    %rax
+  802e1d:	83 e0 07             	and    $0x7,%eax
+  802e20:	49 89 d1             	mov    %rdx,%r9
+  802e23:	49 29 c1             	sub    %rax,%r9
+  802e26:	78 36                	js     802e5e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802e28:	40 0f b6 c6          	movzbl %sil,%eax
+  802e2c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802e33:	01 01 01 
+  802e36:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802e3a:	40 f6 c7 07          	test   $0x7,%dil
+  802e3e:	75 38                	jne    802e78 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802e40:	4c 89 c9             	mov    %r9,%rcx
+  802e43:	48 c1 f9 03          	sar    $0x3,%rcx
+  802e47:	74 0c                	je     802e55 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802e49:	fc                   	cld
+  802e4a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802e4d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802e51:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802e55:	4d 85 c9             	test   %r9,%r9
+  802e58:	75 45                	jne    802e9f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802e5a:	4c 89 c0             	mov    %r8,%rax
+  802e5d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802e5e:	48 85 d2             	test   %rdx,%rdx
+  802e61:	74 f7                	je     802e5a <memset+0x46>
+  802e63:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802e66:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802e69:	48 83 c0 01          	add    $0x1,%rax
+  802e6d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802e71:	48 39 c2             	cmp    %rax,%rdx
+  802e74:	75 f3                	jne    802e69 <memset+0x55>
+  802e76:	eb e2                	jmp    802e5a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802e78:	40 f6 c7 01          	test   $0x1,%dil
+  802e7c:	74 06                	je     802e84 <memset+0x70>
+  802e7e:	88 07                	mov    %al,(%rdi)
+  802e80:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802e84:	40 f6 c7 02          	test   $0x2,%dil
+  802e88:	74 07                	je     802e91 <memset+0x7d>
+  802e8a:	66 89 07             	mov    %ax,(%rdi)
+  802e8d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802e91:	40 f6 c7 04          	test   $0x4,%dil
+  802e95:	74 a9                	je     802e40 <memset+0x2c>
+  802e97:	89 07                	mov    %eax,(%rdi)
+  802e99:	48 83 c7 04          	add    $0x4,%rdi
+  802e9d:	eb a1                	jmp    802e40 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802e9f:	41 f6 c1 04          	test   $0x4,%r9b
+  802ea3:	74 06                	je     802eab <memset+0x97>
+  802ea5:	89 07                	mov    %eax,(%rdi)
+  802ea7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802eab:	41 f6 c1 02          	test   $0x2,%r9b
+  802eaf:	74 07                	je     802eb8 <memset+0xa4>
+  802eb1:	66 89 07             	mov    %ax,(%rdi)
+  802eb4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802eb8:	41 f6 c1 01          	test   $0x1,%r9b
+  802ebc:	74 9c                	je     802e5a <memset+0x46>
+  802ebe:	88 07                	mov    %al,(%rdi)
+  802ec0:	eb 98                	jmp    802e5a <memset+0x46>
+
+0000000000802ec2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802ec2:	48 89 f8             	mov    %rdi,%rax
+  802ec5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802ec8:	48 39 fe             	cmp    %rdi,%rsi
+  802ecb:	73 3b                	jae    802f08 <memmove+0x46>
+  802ecd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802ed1:	48 39 d7             	cmp    %rdx,%rdi
+  802ed4:	73 32                	jae    802f08 <memmove+0x46>
+        s += n;
+        d += n;
+  802ed6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802eda:	48 89 d6             	mov    %rdx,%rsi
+  802edd:	48 09 fe             	or     %rdi,%rsi
+  802ee0:	48 09 ce             	or     %rcx,%rsi
+  802ee3:	40 f6 c6 07          	test   $0x7,%sil
+  802ee7:	75 12                	jne    802efb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802ee9:	48 83 ef 08          	sub    $0x8,%rdi
+  802eed:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802ef1:	48 c1 e9 03          	shr    $0x3,%rcx
+  802ef5:	fd                   	std
+  802ef6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802ef9:	fc                   	cld
+  802efa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802efb:	48 83 ef 01          	sub    $0x1,%rdi
+  802eff:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802f03:	fd                   	std
+  802f04:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802f06:	eb f1                	jmp    802ef9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802f08:	48 89 f2             	mov    %rsi,%rdx
+  802f0b:	48 09 c2             	or     %rax,%rdx
+  802f0e:	48 09 ca             	or     %rcx,%rdx
+  802f11:	f6 c2 07             	test   $0x7,%dl
+  802f14:	75 0c                	jne    802f22 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802f16:	48 c1 e9 03          	shr    $0x3,%rcx
+  802f1a:	48 89 c7             	mov    %rax,%rdi
+  802f1d:	fc                   	cld
+  802f1e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802f21:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802f22:	48 89 c7             	mov    %rax,%rdi
+  802f25:	fc                   	cld
+  802f26:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802f28:	c3                   	ret
+
+0000000000802f29 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802f29:	55                   	push   %rbp
+  802f2a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802f2d:	48 b8 c2 2e 80 00 00 	movabs $0x802ec2,%rax
+  802f34:	00 00 00 
+  802f37:	ff d0                	call   *%rax
+}
+  802f39:	5d                   	pop    %rbp
+  802f3a:	c3                   	ret
+
+0000000000802f3b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802f3b:	55                   	push   %rbp
+  802f3c:	48 89 e5             	mov    %rsp,%rbp
+  802f3f:	41 57                	push   %r15
+  802f41:	41 56                	push   %r14
+  802f43:	41 55                	push   %r13
+  802f45:	41 54                	push   %r12
+  802f47:	53                   	push   %rbx
+  802f48:	48 83 ec 08          	sub    $0x8,%rsp
+  802f4c:	49 89 fe             	mov    %rdi,%r14
+  802f4f:	49 89 f7             	mov    %rsi,%r15
+  802f52:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802f55:	48 89 f7             	mov    %rsi,%rdi
+  802f58:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  802f5f:	00 00 00 
+  802f62:	ff d0                	call   *%rax
+  802f64:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802f67:	48 89 de             	mov    %rbx,%rsi
+  802f6a:	4c 89 f7             	mov    %r14,%rdi
+  802f6d:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+  802f79:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802f7c:	48 39 c3             	cmp    %rax,%rbx
+  802f7f:	74 36                	je     802fb7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802f81:	48 89 d8             	mov    %rbx,%rax
+  802f84:	4c 29 e8             	sub    %r13,%rax
+  802f87:	49 39 c4             	cmp    %rax,%r12
+  802f8a:	73 31                	jae    802fbd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802f8c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802f91:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802f95:	4c 89 fe             	mov    %r15,%rsi
+  802f98:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  802f9f:	00 00 00 
+  802fa2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802fa4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802fa8:	48 83 c4 08          	add    $0x8,%rsp
+  802fac:	5b                   	pop    %rbx
+  802fad:	41 5c                	pop    %r12
+  802faf:	41 5d                	pop    %r13
+  802fb1:	41 5e                	pop    %r14
+  802fb3:	41 5f                	pop    %r15
+  802fb5:	5d                   	pop    %rbp
+  802fb6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802fb7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802fbb:	eb eb                	jmp    802fa8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802fbd:	48 83 eb 01          	sub    $0x1,%rbx
+  802fc1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802fc5:	48 89 da             	mov    %rbx,%rdx
+  802fc8:	4c 89 fe             	mov    %r15,%rsi
+  802fcb:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802fd7:	49 01 de             	add    %rbx,%r14
+  802fda:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802fdf:	eb c3                	jmp    802fa4 <strlcat+0x69>
+
+0000000000802fe1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802fe1:	48 85 d2             	test   %rdx,%rdx
+  802fe4:	74 2d                	je     803013 <memcmp+0x32>
+  802fe6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802feb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802fef:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802ff4:	44 38 c1             	cmp    %r8b,%cl
+  802ff7:	75 0f                	jne    803008 <memcmp+0x27>
+    while (n-- > 0) {
+  802ff9:	48 83 c0 01          	add    $0x1,%rax
+  802ffd:	48 39 c2             	cmp    %rax,%rdx
+  803000:	75 e9                	jne    802feb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  803002:	b8 00 00 00 00       	mov    $0x0,%eax
+  803007:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  803008:	0f b6 c1             	movzbl %cl,%eax
+  80300b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80300f:	44 29 c0             	sub    %r8d,%eax
+  803012:	c3                   	ret
+    return 0;
+  803013:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803018:	c3                   	ret
+
+0000000000803019 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  803019:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80301d:	48 39 c7             	cmp    %rax,%rdi
+  803020:	73 0f                	jae    803031 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  803022:	40 38 37             	cmp    %sil,(%rdi)
+  803025:	74 0e                	je     803035 <memfind+0x1c>
+    for (; src < end; src++) {
+  803027:	48 83 c7 01          	add    $0x1,%rdi
+  80302b:	48 39 f8             	cmp    %rdi,%rax
+  80302e:	75 f2                	jne    803022 <memfind+0x9>
+  803030:	c3                   	ret
+  803031:	48 89 f8             	mov    %rdi,%rax
+  803034:	c3                   	ret
+  803035:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  803038:	c3                   	ret
+
+0000000000803039 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  803039:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80303c:	0f b6 37             	movzbl (%rdi),%esi
+  80303f:	40 80 fe 20          	cmp    $0x20,%sil
+  803043:	74 06                	je     80304b <strtol+0x12>
+  803045:	40 80 fe 09          	cmp    $0x9,%sil
+  803049:	75 13                	jne    80305e <strtol+0x25>
+  80304b:	48 83 c7 01          	add    $0x1,%rdi
+  80304f:	0f b6 37             	movzbl (%rdi),%esi
+  803052:	40 80 fe 20          	cmp    $0x20,%sil
+  803056:	74 f3                	je     80304b <strtol+0x12>
+  803058:	40 80 fe 09          	cmp    $0x9,%sil
+  80305c:	74 ed                	je     80304b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80305e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  803061:	83 e0 fd             	and    $0xfffffffd,%eax
+  803064:	3c 01                	cmp    $0x1,%al
+  803066:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80306a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  803070:	75 0f                	jne    803081 <strtol+0x48>
+  803072:	80 3f 30             	cmpb   $0x30,(%rdi)
+  803075:	74 14                	je     80308b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  803077:	85 d2                	test   %edx,%edx
+  803079:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80307e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  803081:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  803086:	4c 63 ca             	movslq %edx,%r9
+  803089:	eb 36                	jmp    8030c1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80308b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80308f:	74 0f                	je     8030a0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  803091:	85 d2                	test   %edx,%edx
+  803093:	75 ec                	jne    803081 <strtol+0x48>
+        s++;
+  803095:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803099:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80309e:	eb e1                	jmp    803081 <strtol+0x48>
+        s += 2;
+  8030a0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8030a4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8030a9:	eb d6                	jmp    803081 <strtol+0x48>
+            dig -= '0';
+  8030ab:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8030ae:	44 0f b6 c1          	movzbl %cl,%r8d
+  8030b2:	41 39 d0             	cmp    %edx,%r8d
+  8030b5:	7d 21                	jge    8030d8 <strtol+0x9f>
+        val = val * base + dig;
+  8030b7:	49 0f af c1          	imul   %r9,%rax
+  8030bb:	0f b6 c9             	movzbl %cl,%ecx
+  8030be:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8030c1:	48 83 c7 01          	add    $0x1,%rdi
+  8030c5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8030c9:	80 f9 39             	cmp    $0x39,%cl
+  8030cc:	76 dd                	jbe    8030ab <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8030ce:	80 f9 7b             	cmp    $0x7b,%cl
+  8030d1:	77 05                	ja     8030d8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8030d3:	83 e9 57             	sub    $0x57,%ecx
+  8030d6:	eb d6                	jmp    8030ae <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8030d8:	4d 85 d2             	test   %r10,%r10
+  8030db:	74 03                	je     8030e0 <strtol+0xa7>
+  8030dd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8030e0:	48 89 c2             	mov    %rax,%rdx
+  8030e3:	48 f7 da             	neg    %rdx
+  8030e6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8030ea:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8030ee:	c3                   	ret
+
+00000000008030ef <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+  8030f3:	41 57                	push   %r15
+  8030f5:	41 56                	push   %r14
+  8030f7:	41 55                	push   %r13
+  8030f9:	41 54                	push   %r12
+  8030fb:	53                   	push   %rbx
+  8030fc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  803100:	48 85 ff             	test   %rdi,%rdi
+  803103:	74 23                	je     803128 <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  803105:	48 89 fa             	mov    %rdi,%rdx
+  803108:	48 be 0d 73 80 00 00 	movabs $0x80730d,%rsi
+  80310f:	00 00 00 
+  803112:	bf 01 00 00 00       	mov    $0x1,%edi
+  803117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311c:	48 b9 a6 4c 80 00 00 	movabs $0x804ca6,%rcx
+  803123:	00 00 00 
+  803126:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  803128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312d:	48 b8 82 1f 80 00 00 	movabs $0x801f82,%rax
+  803134:	00 00 00 
+  803137:	ff d0                	call   *%rax
+  803139:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  80313c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  803142:	49 bd 49 1f 80 00 00 	movabs $0x801f49,%r13
+  803149:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  80314c:	49 bf 26 1f 80 00 00 	movabs $0x801f26,%r15
+  803153:	00 00 00 
+  803156:	eb 46                	jmp    80319e <readline+0xaf>
+            return NULL;
+  803158:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  80315d:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  803160:	75 0f                	jne    803171 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  803162:	48 83 c4 08          	add    $0x8,%rsp
+  803166:	5b                   	pop    %rbx
+  803167:	41 5c                	pop    %r12
+  803169:	41 5d                	pop    %r13
+  80316b:	41 5e                	pop    %r14
+  80316d:	41 5f                	pop    %r15
+  80316f:	5d                   	pop    %rbp
+  803170:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  803171:	89 de                	mov    %ebx,%esi
+  803173:	48 bf e7 78 80 00 00 	movabs $0x8078e7,%rdi
+  80317a:	00 00 00 
+  80317d:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  803184:	00 00 00 
+  803187:	ff d2                	call   *%rdx
+            return NULL;
+  803189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80318e:	eb d2                	jmp    803162 <readline+0x73>
+            if (i) {
+  803190:	4d 85 e4             	test   %r12,%r12
+  803193:	74 09                	je     80319e <readline+0xaf>
+                if (echo) {
+  803195:	45 85 f6             	test   %r14d,%r14d
+  803198:	75 3f                	jne    8031d9 <readline+0xea>
+                i--;
+  80319a:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  80319e:	41 ff d5             	call   *%r13
+  8031a1:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8031a3:	85 c0                	test   %eax,%eax
+  8031a5:	78 b1                	js     803158 <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  8031a7:	83 f8 08             	cmp    $0x8,%eax
+  8031aa:	74 e4                	je     803190 <readline+0xa1>
+  8031ac:	83 f8 7f             	cmp    $0x7f,%eax
+  8031af:	74 df                	je     803190 <readline+0xa1>
+        } else if (c >= ' ') {
+  8031b1:	83 f8 1f             	cmp    $0x1f,%eax
+  8031b4:	7e 4d                	jle    803203 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8031b6:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8031bd:	77 df                	ja     80319e <readline+0xaf>
+                if (echo) {
+  8031bf:	45 85 f6             	test   %r14d,%r14d
+  8031c2:	75 2f                	jne    8031f3 <readline+0x104>
+                buf[i++] = (char)c;
+  8031c4:	48 b8 40 90 80 01 00 	movabs $0x1809040,%rax
+  8031cb:	00 00 00 
+  8031ce:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8031d2:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8031d7:	eb c5                	jmp    80319e <readline+0xaf>
+                    cputchar('\b');
+  8031d9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031de:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8031e1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8031e6:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  8031e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031ee:	41 ff d7             	call   *%r15
+  8031f1:	eb a7                	jmp    80319a <readline+0xab>
+                    cputchar(c);
+  8031f3:	89 c7                	mov    %eax,%edi
+  8031f5:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+  803201:	eb c1                	jmp    8031c4 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  803203:	83 f8 0a             	cmp    $0xa,%eax
+  803206:	74 05                	je     80320d <readline+0x11e>
+  803208:	83 f8 0d             	cmp    $0xd,%eax
+  80320b:	75 91                	jne    80319e <readline+0xaf>
+            if (echo) {
+  80320d:	45 85 f6             	test   %r14d,%r14d
+  803210:	75 14                	jne    803226 <readline+0x137>
+            buf[i] = 0;
+  803212:	48 b8 40 90 80 01 00 	movabs $0x1809040,%rax
+  803219:	00 00 00 
+  80321c:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  803221:	e9 3c ff ff ff       	jmp    803162 <readline+0x73>
+                cputchar('\n');
+  803226:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80322b:	48 b8 26 1f 80 00 00 	movabs $0x801f26,%rax
+  803232:	00 00 00 
+  803235:	ff d0                	call   *%rax
+  803237:	eb d9                	jmp    803212 <readline+0x123>
+
+0000000000803239 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  803239:	55                   	push   %rbp
+  80323a:	48 89 e5             	mov    %rsp,%rbp
+  80323d:	53                   	push   %rbx
+  80323e:	48 89 fa             	mov    %rdi,%rdx
+  803241:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803244:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803249:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80324e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803253:	be 00 00 00 00       	mov    $0x0,%esi
+  803258:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80325e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803264:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  803266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80326a:	c9                   	leave
+  80326b:	c3                   	ret
+
+000000000080326c <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80326c:	55                   	push   %rbp
+  80326d:	48 89 e5             	mov    %rsp,%rbp
+  803270:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803271:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803280:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803285:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80328a:	be 00 00 00 00       	mov    $0x0,%esi
+  80328f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803295:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80329b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80329d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032a1:	c9                   	leave
+  8032a2:	c3                   	ret
+
+00000000008032a3 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8032a3:	55                   	push   %rbp
+  8032a4:	48 89 e5             	mov    %rsp,%rbp
+  8032a7:	53                   	push   %rbx
+  8032a8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032ab:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8032c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032d0:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8032d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032d6:	c9                   	leave
+  8032d7:	c3                   	ret
+
+00000000008032d8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8032d8:	55                   	push   %rbp
+  8032d9:	48 89 e5             	mov    %rsp,%rbp
+  8032dc:	53                   	push   %rbx
+  8032dd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8032e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032e4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032f3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803303:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803309:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80330b:	48 85 c0             	test   %rax,%rax
+  80330e:	7f 06                	jg     803316 <sys_env_destroy+0x3e>
+}
+  803310:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803314:	c9                   	leave
+  803315:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803316:	49 89 c0             	mov    %rax,%r8
+  803319:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80331e:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  803325:	00 00 00 
+  803328:	be 27 00 00 00       	mov    $0x27,%esi
+  80332d:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  803334:	00 00 00 
+  803337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80333c:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  803343:	00 00 00 
+  803346:	41 ff d1             	call   *%r9
+
+0000000000803349 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  803349:	55                   	push   %rbp
+  80334a:	48 89 e5             	mov    %rsp,%rbp
+  80334d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80334e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803353:	ba 00 00 00 00       	mov    $0x0,%edx
+  803358:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80335d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803362:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803367:	be 00 00 00 00       	mov    $0x0,%esi
+  80336c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803372:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803378:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80337a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80337e:	c9                   	leave
+  80337f:	c3                   	ret
+
+0000000000803380 <sys_yield>:
+
+void
+sys_yield(void) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+  803384:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803385:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80338a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80338f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803394:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803399:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80339e:	be 00 00 00 00       	mov    $0x0,%esi
+  8033a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033af:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8033b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033b5:	c9                   	leave
+  8033b6:	c3                   	ret
+
+00000000008033b7 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8033b7:	55                   	push   %rbp
+  8033b8:	48 89 e5             	mov    %rsp,%rbp
+  8033bb:	53                   	push   %rbx
+  8033bc:	48 89 fa             	mov    %rdi,%rdx
+  8033bf:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8033c2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033c7:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8033ce:	00 00 00 
+  8033d1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8033db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033e7:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8033e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+
+00000000008033ef <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8033ef:	55                   	push   %rbp
+  8033f0:	48 89 e5             	mov    %rsp,%rbp
+  8033f3:	53                   	push   %rbx
+  8033f4:	49 89 f8             	mov    %rdi,%r8
+  8033f7:	48 89 d3             	mov    %rdx,%rbx
+  8033fa:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8033fd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803402:	4c 89 c2             	mov    %r8,%rdx
+  803405:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803408:	be 00 00 00 00       	mov    $0x0,%esi
+  80340d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803413:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803419:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80341b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80341f:	c9                   	leave
+  803420:	c3                   	ret
+
+0000000000803421 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  803421:	55                   	push   %rbp
+  803422:	48 89 e5             	mov    %rsp,%rbp
+  803425:	53                   	push   %rbx
+  803426:	48 83 ec 08          	sub    $0x8,%rsp
+  80342a:	89 f8                	mov    %edi,%eax
+  80342c:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80342f:	48 63 f9             	movslq %ecx,%rdi
+  803432:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803435:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80343a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80343d:	be 00 00 00 00       	mov    $0x0,%esi
+  803442:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803448:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80344e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803450:	48 85 c0             	test   %rax,%rax
+  803453:	7f 06                	jg     80345b <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  803455:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803459:	c9                   	leave
+  80345a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80345b:	49 89 c0             	mov    %rax,%r8
+  80345e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  803463:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  80346a:	00 00 00 
+  80346d:	be 27 00 00 00       	mov    $0x27,%esi
+  803472:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  803479:	00 00 00 
+  80347c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803481:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  803488:	00 00 00 
+  80348b:	41 ff d1             	call   *%r9
+
+000000000080348e <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80348e:	55                   	push   %rbp
+  80348f:	48 89 e5             	mov    %rsp,%rbp
+  803492:	53                   	push   %rbx
+  803493:	48 83 ec 08          	sub    $0x8,%rsp
+  803497:	89 f8                	mov    %edi,%eax
+  803499:	49 89 f2             	mov    %rsi,%r10
+  80349c:	48 89 cf             	mov    %rcx,%rdi
+  80349f:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8034a2:	48 63 da             	movslq %edx,%rbx
+  8034a5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8034a8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8034ad:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8034b0:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8034b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8034b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8034bb:	48 85 c0             	test   %rax,%rax
+  8034be:	7f 06                	jg     8034c6 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8034c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034c4:	c9                   	leave
+  8034c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8034c6:	49 89 c0             	mov    %rax,%r8
+  8034c9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8034ce:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  8034d5:	00 00 00 
+  8034d8:	be 27 00 00 00       	mov    $0x27,%esi
+  8034dd:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  8034e4:	00 00 00 
+  8034e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ec:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  8034f3:	00 00 00 
+  8034f6:	41 ff d1             	call   *%r9
+
+00000000008034f9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8034f9:	55                   	push   %rbp
+  8034fa:	48 89 e5             	mov    %rsp,%rbp
+  8034fd:	53                   	push   %rbx
+  8034fe:	48 83 ec 08          	sub    $0x8,%rsp
+  803502:	48 89 f1             	mov    %rsi,%rcx
+  803505:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  803508:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80350b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803510:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803515:	be 00 00 00 00       	mov    $0x0,%esi
+  80351a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803520:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803526:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803528:	48 85 c0             	test   %rax,%rax
+  80352b:	7f 06                	jg     803533 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80352d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803531:	c9                   	leave
+  803532:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803533:	49 89 c0             	mov    %rax,%r8
+  803536:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80353b:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  803542:	00 00 00 
+  803545:	be 27 00 00 00       	mov    $0x27,%esi
+  80354a:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  803551:	00 00 00 
+  803554:	b8 00 00 00 00       	mov    $0x0,%eax
+  803559:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  803560:	00 00 00 
+  803563:	41 ff d1             	call   *%r9
+
+0000000000803566 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  803566:	55                   	push   %rbp
+  803567:	48 89 e5             	mov    %rsp,%rbp
+  80356a:	53                   	push   %rbx
+  80356b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80356f:	48 63 ce             	movslq %esi,%rcx
+  803572:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803575:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80357a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80357f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803584:	be 00 00 00 00       	mov    $0x0,%esi
+  803589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80358f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803595:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803597:	48 85 c0             	test   %rax,%rax
+  80359a:	7f 06                	jg     8035a2 <sys_env_set_status+0x3c>
+}
+  80359c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035a0:	c9                   	leave
+  8035a1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8035a2:	49 89 c0             	mov    %rax,%r8
+  8035a5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8035aa:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  8035b1:	00 00 00 
+  8035b4:	be 27 00 00 00       	mov    $0x27,%esi
+  8035b9:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  8035c0:	00 00 00 
+  8035c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c8:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  8035cf:	00 00 00 
+  8035d2:	41 ff d1             	call   *%r9
+
+00000000008035d5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8035d5:	55                   	push   %rbp
+  8035d6:	48 89 e5             	mov    %rsp,%rbp
+  8035d9:	53                   	push   %rbx
+  8035da:	48 83 ec 08          	sub    $0x8,%rsp
+  8035de:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8035e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8035e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8035e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8035f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8035f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8035fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803604:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803606:	48 85 c0             	test   %rax,%rax
+  803609:	7f 06                	jg     803611 <sys_env_set_trapframe+0x3c>
+}
+  80360b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80360f:	c9                   	leave
+  803610:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803611:	49 89 c0             	mov    %rax,%r8
+  803614:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  803619:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  803620:	00 00 00 
+  803623:	be 27 00 00 00       	mov    $0x27,%esi
+  803628:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  80362f:	00 00 00 
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+  803637:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  80363e:	00 00 00 
+  803641:	41 ff d1             	call   *%r9
+
+0000000000803644 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803644:	55                   	push   %rbp
+  803645:	48 89 e5             	mov    %rsp,%rbp
+  803648:	53                   	push   %rbx
+  803649:	48 83 ec 08          	sub    $0x8,%rsp
+  80364d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  803650:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803653:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803658:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80365d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803662:	be 00 00 00 00       	mov    $0x0,%esi
+  803667:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80366d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803673:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803675:	48 85 c0             	test   %rax,%rax
+  803678:	7f 06                	jg     803680 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80367a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803680:	49 89 c0             	mov    %rax,%r8
+  803683:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  803688:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  80368f:	00 00 00 
+  803692:	be 27 00 00 00       	mov    $0x27,%esi
+  803697:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  80369e:	00 00 00 
+  8036a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a6:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  8036ad:	00 00 00 
+  8036b0:	41 ff d1             	call   *%r9
+
+00000000008036b3 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8036b3:	55                   	push   %rbp
+  8036b4:	48 89 e5             	mov    %rsp,%rbp
+  8036b7:	53                   	push   %rbx
+  8036b8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8036bc:	40 0f b6 ce          	movzbl %sil,%ecx
+  8036c0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8036c3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8036c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036cd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8036d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8036dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8036e3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8036e5:	48 85 c0             	test   %rax,%rax
+  8036e8:	7f 06                	jg     8036f0 <sys_env_set_reclaim+0x3d>
+}
+  8036ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ee:	c9                   	leave
+  8036ef:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8036f0:	49 89 c0             	mov    %rax,%r8
+  8036f3:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8036f8:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  8036ff:	00 00 00 
+  803702:	be 27 00 00 00       	mov    $0x27,%esi
+  803707:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  80370e:	00 00 00 
+  803711:	b8 00 00 00 00       	mov    $0x0,%eax
+  803716:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  80371d:	00 00 00 
+  803720:	41 ff d1             	call   *%r9
+
+0000000000803723 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803723:	55                   	push   %rbp
+  803724:	48 89 e5             	mov    %rsp,%rbp
+  803727:	53                   	push   %rbx
+  803728:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  80372c:	48 63 ce             	movslq %esi,%rcx
+  80372f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803732:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803737:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80373c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803741:	be 00 00 00 00       	mov    $0x0,%esi
+  803746:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80374c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803752:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803754:	48 85 c0             	test   %rax,%rax
+  803757:	7f 06                	jg     80375f <sys_env_set_nice+0x3c>
+}
+  803759:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80375d:	c9                   	leave
+  80375e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80375f:	49 89 c0             	mov    %rax,%r8
+  803762:	b9 18 00 00 00       	mov    $0x18,%ecx
+  803767:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  80376e:	00 00 00 
+  803771:	be 27 00 00 00       	mov    $0x27,%esi
+  803776:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  80377d:	00 00 00 
+  803780:	b8 00 00 00 00       	mov    $0x0,%eax
+  803785:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  80378c:	00 00 00 
+  80378f:	41 ff d1             	call   *%r9
+
+0000000000803792 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  803792:	55                   	push   %rbp
+  803793:	48 89 e5             	mov    %rsp,%rbp
+  803796:	53                   	push   %rbx
+  803797:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80379a:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80379f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8037a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037a9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8037ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8037b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8037bf:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  8037c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037c5:	c9                   	leave
+  8037c6:	c3                   	ret
+
+00000000008037c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8037c7:	55                   	push   %rbp
+  8037c8:	48 89 e5             	mov    %rsp,%rbp
+  8037cb:	53                   	push   %rbx
+  8037cc:	89 f8                	mov    %edi,%eax
+  8037ce:	49 89 f1             	mov    %rsi,%r9
+  8037d1:	48 89 d3             	mov    %rdx,%rbx
+  8037d4:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8037d7:	49 63 f0             	movslq %r8d,%rsi
+  8037da:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8037dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8037e2:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8037e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8037eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8037f1:	cd 30                	int    $0x30
+}
+  8037f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037f7:	c9                   	leave
+  8037f8:	c3                   	ret
+
+00000000008037f9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8037f9:	55                   	push   %rbp
+  8037fa:	48 89 e5             	mov    %rsp,%rbp
+  8037fd:	53                   	push   %rbx
+  8037fe:	89 f8                	mov    %edi,%eax
+  803800:	49 89 f1             	mov    %rsi,%r9
+  803803:	48 89 d3             	mov    %rdx,%rbx
+  803806:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803809:	49 63 f0             	movslq %r8d,%rsi
+  80380c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80380f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803814:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803817:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80381d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803823:	cd 30                	int    $0x30
+}
+  803825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803829:	c9                   	leave
+  80382a:	c3                   	ret
+
+000000000080382b <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80382b:	55                   	push   %rbp
+  80382c:	48 89 e5             	mov    %rsp,%rbp
+  80382f:	53                   	push   %rbx
+  803830:	48 83 ec 08          	sub    $0x8,%rsp
+  803834:	89 f8                	mov    %edi,%eax
+  803836:	49 89 f2             	mov    %rsi,%r10
+  803839:	48 89 d3             	mov    %rdx,%rbx
+  80383c:	48 89 cf             	mov    %rcx,%rdi
+  80383f:	44 89 c6             	mov    %r8d,%esi
+  803842:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803845:	48 63 f6             	movslq %esi,%rsi
+  803848:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80384b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803850:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803853:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803857:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803859:	48 85 c0             	test   %rax,%rax
+  80385c:	7f 06                	jg     803864 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80385e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803862:	c9                   	leave
+  803863:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803864:	49 89 c0             	mov    %rax,%r8
+  803867:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80386c:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  803873:	00 00 00 
+  803876:	be 27 00 00 00       	mov    $0x27,%esi
+  80387b:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  803882:	00 00 00 
+  803885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388a:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  803891:	00 00 00 
+  803894:	41 ff d1             	call   *%r9
+
+0000000000803897 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  803897:	55                   	push   %rbp
+  803898:	48 89 e5             	mov    %rsp,%rbp
+  80389b:	53                   	push   %rbx
+  80389c:	48 83 ec 08          	sub    $0x8,%rsp
+  8038a0:	48 89 f1             	mov    %rsi,%rcx
+  8038a3:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  8038a6:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  8038aa:	48 8b 1a             	mov    (%rdx),%rbx
+  8038ad:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8038b0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8038b5:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8038b9:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  8038bd:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  8038c1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8038c3:	48 85 c0             	test   %rax,%rax
+  8038c6:	7f 06                	jg     8038ce <sys_ipc_call_short+0x37>
+}
+  8038c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038cc:	c9                   	leave
+  8038cd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8038ce:	49 89 c0             	mov    %rax,%r8
+  8038d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8038d6:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  8038dd:	00 00 00 
+  8038e0:	be 27 00 00 00       	mov    $0x27,%esi
+  8038e5:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  8038ec:	00 00 00 
+  8038ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f4:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  8038fb:	00 00 00 
+  8038fe:	41 ff d1             	call   *%r9
+
+0000000000803901 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803901:	55                   	push   %rbp
+  803902:	48 89 e5             	mov    %rsp,%rbp
+  803905:	53                   	push   %rbx
+  803906:	48 83 ec 08          	sub    $0x8,%rsp
+  80390a:	89 f8                	mov    %edi,%eax
+  80390c:	49 89 f2             	mov    %rsi,%r10
+  80390f:	48 89 d3             	mov    %rdx,%rbx
+  803912:	48 89 cf             	mov    %rcx,%rdi
+  803915:	44 89 c6             	mov    %r8d,%esi
+  803918:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  80391b:	48 63 f6             	movslq %esi,%rsi
+  80391e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803921:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803926:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803929:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  80392d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80392f:	48 85 c0             	test   %rax,%rax
+  803932:	7f 06                	jg     80393a <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803934:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803938:	c9                   	leave
+  803939:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80393a:	49 89 c0             	mov    %rax,%r8
+  80393d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803942:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  803949:	00 00 00 
+  80394c:	be 27 00 00 00       	mov    $0x27,%esi
+  803951:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  803958:	00 00 00 
+  80395b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803960:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  803967:	00 00 00 
+  80396a:	41 ff d1             	call   *%r9
+
+000000000080396d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80396d:	55                   	push   %rbp
+  80396e:	48 89 e5             	mov    %rsp,%rbp
+  803971:	53                   	push   %rbx
+  803972:	48 83 ec 08          	sub    $0x8,%rsp
+  803976:	48 89 fa             	mov    %rdi,%rdx
+  803979:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80397c:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803981:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803986:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80398b:	be 00 00 00 00       	mov    $0x0,%esi
+  803990:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803996:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80399c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80399e:	48 85 c0             	test   %rax,%rax
+  8039a1:	7f 06                	jg     8039a9 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8039a3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039a7:	c9                   	leave
+  8039a8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8039a9:	49 89 c0             	mov    %rax,%r8
+  8039ac:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8039b1:	48 ba f8 78 80 00 00 	movabs $0x8078f8,%rdx
+  8039b8:	00 00 00 
+  8039bb:	be 27 00 00 00       	mov    $0x27,%esi
+  8039c0:	48 bf 17 79 80 00 00 	movabs $0x807917,%rdi
+  8039c7:	00 00 00 
+  8039ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039cf:	49 b9 eb 20 80 00 00 	movabs $0x8020eb,%r9
+  8039d6:	00 00 00 
+  8039d9:	41 ff d1             	call   *%r9
+
+00000000008039dc <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8039dc:	55                   	push   %rbp
+  8039dd:	48 89 e5             	mov    %rsp,%rbp
+  8039e0:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8039e1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8039e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8039f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039f5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8039fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803a05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803a0b:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803a0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a11:	c9                   	leave
+  803a12:	c3                   	ret
+
+0000000000803a13 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803a13:	55                   	push   %rbp
+  803a14:	48 89 e5             	mov    %rsp,%rbp
+  803a17:	53                   	push   %rbx
+  803a18:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803a1b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a20:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803a2f:	be 00 00 00 00       	mov    $0x0,%esi
+  803a34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803a3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803a40:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803a42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a46:	c9                   	leave
+  803a47:	c3                   	ret
+
+0000000000803a48 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803a48:	55                   	push   %rbp
+  803a49:	48 89 e5             	mov    %rsp,%rbp
+  803a4c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803a4d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803a52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a57:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803a5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a61:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803a66:	be 00 00 00 00       	mov    $0x0,%esi
+  803a6b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803a71:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803a77:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803a79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a7d:	c9                   	leave
+  803a7e:	c3                   	ret
+
+0000000000803a7f <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  803a7f:	55                   	push   %rbp
+  803a80:	48 89 e5             	mov    %rsp,%rbp
+  803a83:	53                   	push   %rbx
+  803a84:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803a88:	b8 08 00 00 00       	mov    $0x8,%eax
+  803a8d:	cd 30                	int    $0x30
+  803a8f:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  803a91:	85 c0                	test   %eax,%eax
+  803a93:	0f 88 85 00 00 00    	js     803b1e <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803a99:	0f 84 ac 00 00 00    	je     803b4b <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803a9f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  803aa5:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803aac:	00 00 00 
+  803aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ab4:	89 c2                	mov    %eax,%edx
+  803ab6:	be 00 00 00 00       	mov    $0x0,%esi
+  803abb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ac0:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+  803acc:	85 c0                	test   %eax,%eax
+  803ace:	0f 88 a8 00 00 00    	js     803b7c <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  803ad4:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  803adb:	00 00 00 
+  803ade:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  803ae5:	89 df                	mov    %ebx,%edi
+  803ae7:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	0f 88 ae 00 00 00    	js     803ba9 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803afb:	be 02 00 00 00       	mov    $0x2,%esi
+  803b00:	89 df                	mov    %ebx,%edi
+  803b02:	48 b8 66 35 80 00 00 	movabs $0x803566,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	85 c0                	test   %eax,%eax
+  803b10:	0f 88 c0 00 00 00    	js     803bd6 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803b16:	89 d8                	mov    %ebx,%eax
+  803b18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b1c:	c9                   	leave
+  803b1d:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803b1e:	89 c1                	mov    %eax,%ecx
+  803b20:	48 ba 25 79 80 00 00 	movabs $0x807925,%rdx
+  803b27:	00 00 00 
+  803b2a:	be 20 00 00 00       	mov    $0x20,%esi
+  803b2f:	48 bf 35 79 80 00 00 	movabs $0x807935,%rdi
+  803b36:	00 00 00 
+  803b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3e:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  803b45:	00 00 00 
+  803b48:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803b4b:	48 b8 49 33 80 00 00 	movabs $0x803349,%rax
+  803b52:	00 00 00 
+  803b55:	ff d0                	call   *%rax
+  803b57:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b5c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803b63:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803b6a:	00 00 00 
+  803b6d:	48 01 d0             	add    %rdx,%rax
+  803b70:	48 a3 38 90 80 01 00 	movabs %rax,0x1809038
+  803b77:	00 00 00 
+        return 0;
+  803b7a:	eb 9a                	jmp    803b16 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803b7c:	89 c1                	mov    %eax,%ecx
+  803b7e:	48 ba 40 79 80 00 00 	movabs $0x807940,%rdx
+  803b85:	00 00 00 
+  803b88:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803b8d:	48 bf 35 79 80 00 00 	movabs $0x807935,%rdi
+  803b94:	00 00 00 
+  803b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9c:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  803ba3:	00 00 00 
+  803ba6:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803ba9:	89 c1                	mov    %eax,%ecx
+  803bab:	48 ba 88 79 80 00 00 	movabs $0x807988,%rdx
+  803bb2:	00 00 00 
+  803bb5:	be 32 00 00 00       	mov    $0x32,%esi
+  803bba:	48 bf 35 79 80 00 00 	movabs $0x807935,%rdi
+  803bc1:	00 00 00 
+  803bc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc9:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  803bd0:	00 00 00 
+  803bd3:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803bd6:	89 c1                	mov    %eax,%ecx
+  803bd8:	48 ba 53 79 80 00 00 	movabs $0x807953,%rdx
+  803bdf:	00 00 00 
+  803be2:	be 37 00 00 00       	mov    $0x37,%esi
+  803be7:	48 bf 35 79 80 00 00 	movabs $0x807935,%rdi
+  803bee:	00 00 00 
+  803bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf6:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  803bfd:	00 00 00 
+  803c00:	41 ff d0             	call   *%r8
+
+0000000000803c03 <sfork>:
+
+envid_t
+sfork() {
+  803c03:	55                   	push   %rbp
+  803c04:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803c07:	48 ba 6a 79 80 00 00 	movabs $0x80796a,%rdx
+  803c0e:	00 00 00 
+  803c11:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803c16:	48 bf 35 79 80 00 00 	movabs $0x807935,%rdi
+  803c1d:	00 00 00 
+  803c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c25:	48 b9 eb 20 80 00 00 	movabs $0x8020eb,%rcx
+  803c2c:	00 00 00 
+  803c2f:	ff d1                	call   *%rcx
+
+0000000000803c31 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  803c31:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  803c34:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  803c38:	83 3f 01             	cmpl   $0x1,(%rdi)
+  803c3b:	7e 0f                	jle    803c4c <argstart+0x1b>
+  803c3d:	48 b8 66 72 80 00 00 	movabs $0x807266,%rax
+  803c44:	00 00 00 
+  803c47:	48 85 f6             	test   %rsi,%rsi
+  803c4a:	75 05                	jne    803c51 <argstart+0x20>
+  803c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c51:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  803c55:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  803c5c:	00 
+}
+  803c5d:	c3                   	ret
+
+0000000000803c5e <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  803c5e:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  803c65:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  803c66:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  803c6a:	48 85 c0             	test   %rax,%rax
+  803c6d:	0f 84 8f 00 00 00    	je     803d02 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  803c73:	55                   	push   %rbp
+  803c74:	48 89 e5             	mov    %rsp,%rbp
+  803c77:	53                   	push   %rbx
+  803c78:	48 83 ec 08          	sub    $0x8,%rsp
+  803c7c:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  803c7f:	80 38 00             	cmpb   $0x0,(%rax)
+  803c82:	75 52                	jne    803cd6 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  803c84:	48 8b 17             	mov    (%rdi),%rdx
+  803c87:	83 3a 01             	cmpl   $0x1,(%rdx)
+  803c8a:	74 67                	je     803cf3 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  803c8c:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  803c90:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  803c94:	80 38 2d             	cmpb   $0x2d,(%rax)
+  803c97:	75 5a                	jne    803cf3 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  803c99:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  803c9d:	74 54                	je     803cf3 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  803c9f:	48 83 c0 01          	add    $0x1,%rax
+  803ca3:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  803ca7:	8b 12                	mov    (%rdx),%edx
+  803ca9:	83 ea 01             	sub    $0x1,%edx
+  803cac:	48 63 d2             	movslq %edx,%rdx
+  803caf:	48 c1 e2 03          	shl    $0x3,%rdx
+  803cb3:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  803cb7:	48 83 c7 08          	add    $0x8,%rdi
+  803cbb:	48 b8 c2 2e 80 00 00 	movabs $0x802ec2,%rax
+  803cc2:	00 00 00 
+  803cc5:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  803cc7:	48 8b 03             	mov    (%rbx),%rax
+  803cca:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  803ccd:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  803cd1:	80 38 2d             	cmpb   $0x2d,(%rax)
+  803cd4:	74 17                	je     803ced <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  803cd6:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  803cda:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  803cdd:	48 83 c0 01          	add    $0x1,%rax
+  803ce1:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  803ce5:	89 d0                	mov    %edx,%eax
+  803ce7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ceb:	c9                   	leave
+  803cec:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  803ced:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  803cf1:	75 e3                	jne    803cd6 <argnext+0x78>
+    args->curarg = 0;
+  803cf3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803cfa:	00 
+    return -1;
+  803cfb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  803d00:	eb e3                	jmp    803ce5 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  803d02:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  803d07:	89 d0                	mov    %edx,%eax
+  803d09:	c3                   	ret
+
+0000000000803d0a <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  803d0a:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  803d0e:	48 85 c0             	test   %rax,%rax
+  803d11:	74 7b                	je     803d8e <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  803d13:	55                   	push   %rbp
+  803d14:	48 89 e5             	mov    %rsp,%rbp
+  803d17:	53                   	push   %rbx
+  803d18:	48 83 ec 08          	sub    $0x8,%rsp
+  803d1c:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  803d1f:	80 38 00             	cmpb   $0x0,(%rax)
+  803d22:	74 1c                	je     803d40 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  803d24:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  803d28:	48 b8 66 72 80 00 00 	movabs $0x807266,%rax
+  803d2f:	00 00 00 
+  803d32:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  803d36:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  803d3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d3e:	c9                   	leave
+  803d3f:	c3                   	ret
+    } else if (*args->argc > 1) {
+  803d40:	48 8b 07             	mov    (%rdi),%rax
+  803d43:	83 38 01             	cmpl   $0x1,(%rax)
+  803d46:	7f 12                	jg     803d5a <argnextvalue+0x50>
+        args->argvalue = 0;
+  803d48:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  803d4f:	00 
+        args->curarg = 0;
+  803d50:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  803d57:	00 
+  803d58:	eb dc                	jmp    803d36 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  803d5a:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  803d5e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  803d62:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  803d66:	8b 10                	mov    (%rax),%edx
+  803d68:	83 ea 01             	sub    $0x1,%edx
+  803d6b:	48 63 d2             	movslq %edx,%rdx
+  803d6e:	48 c1 e2 03          	shl    $0x3,%rdx
+  803d72:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  803d76:	48 83 c7 08          	add    $0x8,%rdi
+  803d7a:	48 b8 c2 2e 80 00 00 	movabs $0x802ec2,%rax
+  803d81:	00 00 00 
+  803d84:	ff d0                	call   *%rax
+        (*args->argc)--;
+  803d86:	48 8b 03             	mov    (%rbx),%rax
+  803d89:	83 28 01             	subl   $0x1,(%rax)
+  803d8c:	eb a8                	jmp    803d36 <argnextvalue+0x2c>
+}
+  803d8e:	c3                   	ret
+
+0000000000803d8f <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  803d8f:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  803d93:	48 85 c0             	test   %rax,%rax
+  803d96:	74 01                	je     803d99 <argvalue+0xa>
+}
+  803d98:	c3                   	ret
+argvalue(struct Argstate *args) {
+  803d99:	55                   	push   %rbp
+  803d9a:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  803d9d:	48 b8 0a 3d 80 00 00 	movabs $0x803d0a,%rax
+  803da4:	00 00 00 
+  803da7:	ff d0                	call   *%rax
+}
+  803da9:	5d                   	pop    %rbp
+  803daa:	c3                   	ret
+
+0000000000803dab <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803dab:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803db2:	ff ff ff 
+  803db5:	48 01 f8             	add    %rdi,%rax
+  803db8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803dbc:	c3                   	ret
+
+0000000000803dbd <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803dbd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803dc4:	ff ff ff 
+  803dc7:	48 01 f8             	add    %rdi,%rax
+  803dca:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803dce:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803dd4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803dd8:	c3                   	ret
+
+0000000000803dd9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803dd9:	55                   	push   %rbp
+  803dda:	48 89 e5             	mov    %rsp,%rbp
+  803ddd:	41 57                	push   %r15
+  803ddf:	41 56                	push   %r14
+  803de1:	41 55                	push   %r13
+  803de3:	41 54                	push   %r12
+  803de5:	53                   	push   %rbx
+  803de6:	48 83 ec 08          	sub    $0x8,%rsp
+  803dea:	49 89 ff             	mov    %rdi,%r15
+  803ded:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803df2:	49 bd 6d 5c 80 00 00 	movabs $0x805c6d,%r13
+  803df9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803dfc:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803e02:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803e05:	48 89 df             	mov    %rbx,%rdi
+  803e08:	41 ff d5             	call   *%r13
+  803e0b:	83 e0 04             	and    $0x4,%eax
+  803e0e:	74 17                	je     803e27 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803e10:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e17:	4c 39 f3             	cmp    %r14,%rbx
+  803e1a:	75 e6                	jne    803e02 <fd_alloc+0x29>
+  803e1c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803e22:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803e27:	4d 89 27             	mov    %r12,(%r15)
+}
+  803e2a:	48 83 c4 08          	add    $0x8,%rsp
+  803e2e:	5b                   	pop    %rbx
+  803e2f:	41 5c                	pop    %r12
+  803e31:	41 5d                	pop    %r13
+  803e33:	41 5e                	pop    %r14
+  803e35:	41 5f                	pop    %r15
+  803e37:	5d                   	pop    %rbp
+  803e38:	c3                   	ret
+
+0000000000803e39 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803e39:	83 ff 1f             	cmp    $0x1f,%edi
+  803e3c:	77 39                	ja     803e77 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803e3e:	55                   	push   %rbp
+  803e3f:	48 89 e5             	mov    %rsp,%rbp
+  803e42:	41 54                	push   %r12
+  803e44:	53                   	push   %rbx
+  803e45:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803e48:	48 63 df             	movslq %edi,%rbx
+  803e4b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803e52:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803e56:	48 89 df             	mov    %rbx,%rdi
+  803e59:	48 b8 6d 5c 80 00 00 	movabs $0x805c6d,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+  803e65:	a8 04                	test   $0x4,%al
+  803e67:	74 14                	je     803e7d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803e69:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803e6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e72:	5b                   	pop    %rbx
+  803e73:	41 5c                	pop    %r12
+  803e75:	5d                   	pop    %rbp
+  803e76:	c3                   	ret
+        return -E_INVAL;
+  803e77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803e7c:	c3                   	ret
+        return -E_INVAL;
+  803e7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e82:	eb ee                	jmp    803e72 <fd_lookup+0x39>
+
+0000000000803e84 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803e84:	55                   	push   %rbp
+  803e85:	48 89 e5             	mov    %rsp,%rbp
+  803e88:	41 54                	push   %r12
+  803e8a:	53                   	push   %rbx
+  803e8b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803e8e:	48 b8 40 7a 80 00 00 	movabs $0x807a40,%rax
+  803e95:	00 00 00 
+  803e98:	48 bb 80 80 80 00 00 	movabs $0x808080,%rbx
+  803e9f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803ea2:	39 3b                	cmp    %edi,(%rbx)
+  803ea4:	74 47                	je     803eed <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803ea6:	48 83 c0 08          	add    $0x8,%rax
+  803eaa:	48 8b 18             	mov    (%rax),%rbx
+  803ead:	48 85 db             	test   %rbx,%rbx
+  803eb0:	75 f0                	jne    803ea2 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803eb2:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  803eb9:	00 00 00 
+  803ebc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803ec2:	89 fa                	mov    %edi,%edx
+  803ec4:	48 bf a8 79 80 00 00 	movabs $0x8079a8,%rdi
+  803ecb:	00 00 00 
+  803ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed3:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  803eda:	00 00 00 
+  803edd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803ee4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803ee8:	5b                   	pop    %rbx
+  803ee9:	41 5c                	pop    %r12
+  803eeb:	5d                   	pop    %rbp
+  803eec:	c3                   	ret
+            return 0;
+  803eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef2:	eb f0                	jmp    803ee4 <dev_lookup+0x60>
+
+0000000000803ef4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803ef4:	55                   	push   %rbp
+  803ef5:	48 89 e5             	mov    %rsp,%rbp
+  803ef8:	41 55                	push   %r13
+  803efa:	41 54                	push   %r12
+  803efc:	53                   	push   %rbx
+  803efd:	48 83 ec 18          	sub    $0x18,%rsp
+  803f01:	48 89 fb             	mov    %rdi,%rbx
+  803f04:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803f07:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803f0e:	ff ff ff 
+  803f11:	48 01 df             	add    %rbx,%rdi
+  803f14:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803f18:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f1c:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  803f23:	00 00 00 
+  803f26:	ff d0                	call   *%rax
+  803f28:	41 89 c5             	mov    %eax,%r13d
+  803f2b:	85 c0                	test   %eax,%eax
+  803f2d:	78 06                	js     803f35 <fd_close+0x41>
+  803f2f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803f33:	74 1a                	je     803f4f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803f35:	45 84 e4             	test   %r12b,%r12b
+  803f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803f41:	44 89 e8             	mov    %r13d,%eax
+  803f44:	48 83 c4 18          	add    $0x18,%rsp
+  803f48:	5b                   	pop    %rbx
+  803f49:	41 5c                	pop    %r12
+  803f4b:	41 5d                	pop    %r13
+  803f4d:	5d                   	pop    %rbp
+  803f4e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803f4f:	8b 3b                	mov    (%rbx),%edi
+  803f51:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803f55:	48 b8 84 3e 80 00 00 	movabs $0x803e84,%rax
+  803f5c:	00 00 00 
+  803f5f:	ff d0                	call   *%rax
+  803f61:	41 89 c5             	mov    %eax,%r13d
+  803f64:	85 c0                	test   %eax,%eax
+  803f66:	78 1b                	js     803f83 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803f68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f6c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803f70:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803f76:	48 85 c0             	test   %rax,%rax
+  803f79:	74 08                	je     803f83 <fd_close+0x8f>
+  803f7b:	48 89 df             	mov    %rbx,%rdi
+  803f7e:	ff d0                	call   *%rax
+  803f80:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803f83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f88:	48 89 de             	mov    %rbx,%rsi
+  803f8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f90:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  803f97:	00 00 00 
+  803f9a:	ff d0                	call   *%rax
+    return res;
+  803f9c:	eb a3                	jmp    803f41 <fd_close+0x4d>
+
+0000000000803f9e <close>:
+
+int
+close(int fdnum) {
+  803f9e:	55                   	push   %rbp
+  803f9f:	48 89 e5             	mov    %rsp,%rbp
+  803fa2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fa6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803faa:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  803fb1:	00 00 00 
+  803fb4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fb6:	85 c0                	test   %eax,%eax
+  803fb8:	78 15                	js     803fcf <close+0x31>
+
+    return fd_close(fd, 1);
+  803fba:	be 01 00 00 00       	mov    $0x1,%esi
+  803fbf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fc3:	48 b8 f4 3e 80 00 00 	movabs $0x803ef4,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+}
+  803fcf:	c9                   	leave
+  803fd0:	c3                   	ret
+
+0000000000803fd1 <close_all>:
+
+void
+close_all(void) {
+  803fd1:	55                   	push   %rbp
+  803fd2:	48 89 e5             	mov    %rsp,%rbp
+  803fd5:	41 54                	push   %r12
+  803fd7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fdd:	49 bc 9e 3f 80 00 00 	movabs $0x803f9e,%r12
+  803fe4:	00 00 00 
+  803fe7:	89 df                	mov    %ebx,%edi
+  803fe9:	41 ff d4             	call   *%r12
+  803fec:	83 c3 01             	add    $0x1,%ebx
+  803fef:	83 fb 20             	cmp    $0x20,%ebx
+  803ff2:	75 f3                	jne    803fe7 <close_all+0x16>
+}
+  803ff4:	5b                   	pop    %rbx
+  803ff5:	41 5c                	pop    %r12
+  803ff7:	5d                   	pop    %rbp
+  803ff8:	c3                   	ret
+
+0000000000803ff9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803ff9:	55                   	push   %rbp
+  803ffa:	48 89 e5             	mov    %rsp,%rbp
+  803ffd:	41 57                	push   %r15
+  803fff:	41 56                	push   %r14
+  804001:	41 55                	push   %r13
+  804003:	41 54                	push   %r12
+  804005:	53                   	push   %rbx
+  804006:	48 83 ec 18          	sub    $0x18,%rsp
+  80400a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80400d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804011:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 c3                	mov    %eax,%ebx
+  80401f:	85 c0                	test   %eax,%eax
+  804021:	0f 88 b8 00 00 00    	js     8040df <dup+0xe6>
+    close(newfdnum);
+  804027:	44 89 e7             	mov    %r12d,%edi
+  80402a:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  804031:	00 00 00 
+  804034:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  804036:	4d 63 ec             	movslq %r12d,%r13
+  804039:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  804040:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  804044:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  804048:	4c 89 ff             	mov    %r15,%rdi
+  80404b:	49 be bd 3d 80 00 00 	movabs $0x803dbd,%r14
+  804052:	00 00 00 
+  804055:	41 ff d6             	call   *%r14
+  804058:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80405b:	4c 89 ef             	mov    %r13,%rdi
+  80405e:	41 ff d6             	call   *%r14
+  804061:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  804064:	48 89 df             	mov    %rbx,%rdi
+  804067:	48 b8 6d 5c 80 00 00 	movabs $0x805c6d,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  804073:	a8 04                	test   $0x4,%al
+  804075:	74 2b                	je     8040a2 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  804077:	41 89 c1             	mov    %eax,%r9d
+  80407a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804080:	4c 89 f1             	mov    %r14,%rcx
+  804083:	ba 00 00 00 00       	mov    $0x0,%edx
+  804088:	48 89 de             	mov    %rbx,%rsi
+  80408b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804090:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  804097:	00 00 00 
+  80409a:	ff d0                	call   *%rax
+  80409c:	89 c3                	mov    %eax,%ebx
+  80409e:	85 c0                	test   %eax,%eax
+  8040a0:	78 4e                	js     8040f0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8040a2:	4c 89 ff             	mov    %r15,%rdi
+  8040a5:	48 b8 6d 5c 80 00 00 	movabs $0x805c6d,%rax
+  8040ac:	00 00 00 
+  8040af:	ff d0                	call   *%rax
+  8040b1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8040b4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040ba:	4c 89 e9             	mov    %r13,%rcx
+  8040bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040c2:	4c 89 fe             	mov    %r15,%rsi
+  8040c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040ca:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+  8040d6:	89 c3                	mov    %eax,%ebx
+  8040d8:	85 c0                	test   %eax,%eax
+  8040da:	78 14                	js     8040f0 <dup+0xf7>
+
+    return newfdnum;
+  8040dc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8040df:	89 d8                	mov    %ebx,%eax
+  8040e1:	48 83 c4 18          	add    $0x18,%rsp
+  8040e5:	5b                   	pop    %rbx
+  8040e6:	41 5c                	pop    %r12
+  8040e8:	41 5d                	pop    %r13
+  8040ea:	41 5e                	pop    %r14
+  8040ec:	41 5f                	pop    %r15
+  8040ee:	5d                   	pop    %rbp
+  8040ef:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8040f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040f5:	4c 89 ee             	mov    %r13,%rsi
+  8040f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040fd:	49 bc f9 34 80 00 00 	movabs $0x8034f9,%r12
+  804104:	00 00 00 
+  804107:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80410a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80410f:	4c 89 f6             	mov    %r14,%rsi
+  804112:	bf 00 00 00 00       	mov    $0x0,%edi
+  804117:	41 ff d4             	call   *%r12
+    return res;
+  80411a:	eb c3                	jmp    8040df <dup+0xe6>
+
+000000000080411c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80411c:	55                   	push   %rbp
+  80411d:	48 89 e5             	mov    %rsp,%rbp
+  804120:	41 56                	push   %r14
+  804122:	41 55                	push   %r13
+  804124:	41 54                	push   %r12
+  804126:	53                   	push   %rbx
+  804127:	48 83 ec 10          	sub    $0x10,%rsp
+  80412b:	89 fb                	mov    %edi,%ebx
+  80412d:	49 89 f4             	mov    %rsi,%r12
+  804130:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804133:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804137:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80413e:	00 00 00 
+  804141:	ff d0                	call   *%rax
+  804143:	85 c0                	test   %eax,%eax
+  804145:	78 4c                	js     804193 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804147:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80414b:	41 8b 3e             	mov    (%r14),%edi
+  80414e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804152:	48 b8 84 3e 80 00 00 	movabs $0x803e84,%rax
+  804159:	00 00 00 
+  80415c:	ff d0                	call   *%rax
+  80415e:	85 c0                	test   %eax,%eax
+  804160:	78 35                	js     804197 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  804162:	41 8b 46 08          	mov    0x8(%r14),%eax
+  804166:	83 e0 03             	and    $0x3,%eax
+  804169:	83 f8 01             	cmp    $0x1,%eax
+  80416c:	74 2d                	je     80419b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80416e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804172:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804176:	48 85 c0             	test   %rax,%rax
+  804179:	74 56                	je     8041d1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80417b:	4c 89 ea             	mov    %r13,%rdx
+  80417e:	4c 89 e6             	mov    %r12,%rsi
+  804181:	4c 89 f7             	mov    %r14,%rdi
+  804184:	ff d0                	call   *%rax
+}
+  804186:	48 83 c4 10          	add    $0x10,%rsp
+  80418a:	5b                   	pop    %rbx
+  80418b:	41 5c                	pop    %r12
+  80418d:	41 5d                	pop    %r13
+  80418f:	41 5e                	pop    %r14
+  804191:	5d                   	pop    %rbp
+  804192:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804193:	48 98                	cltq
+  804195:	eb ef                	jmp    804186 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804197:	48 98                	cltq
+  804199:	eb eb                	jmp    804186 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80419b:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  8041a2:	00 00 00 
+  8041a5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8041ab:	89 da                	mov    %ebx,%edx
+  8041ad:	48 bf e9 79 80 00 00 	movabs $0x8079e9,%rdi
+  8041b4:	00 00 00 
+  8041b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041bc:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  8041c3:	00 00 00 
+  8041c6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8041c8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8041cf:	eb b5                	jmp    804186 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8041d1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8041d8:	eb ac                	jmp    804186 <read+0x6a>
+
+00000000008041da <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8041da:	55                   	push   %rbp
+  8041db:	48 89 e5             	mov    %rsp,%rbp
+  8041de:	41 57                	push   %r15
+  8041e0:	41 56                	push   %r14
+  8041e2:	41 55                	push   %r13
+  8041e4:	41 54                	push   %r12
+  8041e6:	53                   	push   %rbx
+  8041e7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8041eb:	48 85 d2             	test   %rdx,%rdx
+  8041ee:	74 54                	je     804244 <readn+0x6a>
+  8041f0:	41 89 fd             	mov    %edi,%r13d
+  8041f3:	49 89 f6             	mov    %rsi,%r14
+  8041f6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8041f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8041fe:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  804203:	49 bf 1c 41 80 00 00 	movabs $0x80411c,%r15
+  80420a:	00 00 00 
+  80420d:	4c 89 e2             	mov    %r12,%rdx
+  804210:	48 29 f2             	sub    %rsi,%rdx
+  804213:	4c 01 f6             	add    %r14,%rsi
+  804216:	44 89 ef             	mov    %r13d,%edi
+  804219:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80421c:	85 c0                	test   %eax,%eax
+  80421e:	78 20                	js     804240 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  804220:	01 c3                	add    %eax,%ebx
+  804222:	85 c0                	test   %eax,%eax
+  804224:	74 08                	je     80422e <readn+0x54>
+  804226:	48 63 f3             	movslq %ebx,%rsi
+  804229:	4c 39 e6             	cmp    %r12,%rsi
+  80422c:	72 df                	jb     80420d <readn+0x33>
+    }
+    return res;
+  80422e:	48 63 c3             	movslq %ebx,%rax
+}
+  804231:	48 83 c4 08          	add    $0x8,%rsp
+  804235:	5b                   	pop    %rbx
+  804236:	41 5c                	pop    %r12
+  804238:	41 5d                	pop    %r13
+  80423a:	41 5e                	pop    %r14
+  80423c:	41 5f                	pop    %r15
+  80423e:	5d                   	pop    %rbp
+  80423f:	c3                   	ret
+        if (inc < 0) return inc;
+  804240:	48 98                	cltq
+  804242:	eb ed                	jmp    804231 <readn+0x57>
+    int inc = 1, res = 0;
+  804244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804249:	eb e3                	jmp    80422e <readn+0x54>
+
+000000000080424b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80424b:	55                   	push   %rbp
+  80424c:	48 89 e5             	mov    %rsp,%rbp
+  80424f:	41 56                	push   %r14
+  804251:	41 55                	push   %r13
+  804253:	41 54                	push   %r12
+  804255:	53                   	push   %rbx
+  804256:	48 83 ec 10          	sub    $0x10,%rsp
+  80425a:	89 fb                	mov    %edi,%ebx
+  80425c:	49 89 f4             	mov    %rsi,%r12
+  80425f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804262:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804266:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+  804272:	85 c0                	test   %eax,%eax
+  804274:	78 47                	js     8042bd <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804276:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80427a:	41 8b 3e             	mov    (%r14),%edi
+  80427d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804281:	48 b8 84 3e 80 00 00 	movabs $0x803e84,%rax
+  804288:	00 00 00 
+  80428b:	ff d0                	call   *%rax
+  80428d:	85 c0                	test   %eax,%eax
+  80428f:	78 30                	js     8042c1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804291:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  804296:	74 2d                	je     8042c5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  804298:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80429c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8042a0:	48 85 c0             	test   %rax,%rax
+  8042a3:	74 56                	je     8042fb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8042a5:	4c 89 ea             	mov    %r13,%rdx
+  8042a8:	4c 89 e6             	mov    %r12,%rsi
+  8042ab:	4c 89 f7             	mov    %r14,%rdi
+  8042ae:	ff d0                	call   *%rax
+}
+  8042b0:	48 83 c4 10          	add    $0x10,%rsp
+  8042b4:	5b                   	pop    %rbx
+  8042b5:	41 5c                	pop    %r12
+  8042b7:	41 5d                	pop    %r13
+  8042b9:	41 5e                	pop    %r14
+  8042bb:	5d                   	pop    %rbp
+  8042bc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8042bd:	48 98                	cltq
+  8042bf:	eb ef                	jmp    8042b0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8042c1:	48 98                	cltq
+  8042c3:	eb eb                	jmp    8042b0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8042c5:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  8042cc:	00 00 00 
+  8042cf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8042d5:	89 da                	mov    %ebx,%edx
+  8042d7:	48 bf 05 7a 80 00 00 	movabs $0x807a05,%rdi
+  8042de:	00 00 00 
+  8042e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e6:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  8042ed:	00 00 00 
+  8042f0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8042f2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042f9:	eb b5                	jmp    8042b0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8042fb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  804302:	eb ac                	jmp    8042b0 <write+0x65>
+
+0000000000804304 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  804304:	55                   	push   %rbp
+  804305:	48 89 e5             	mov    %rsp,%rbp
+  804308:	53                   	push   %rbx
+  804309:	48 83 ec 18          	sub    $0x18,%rsp
+  80430d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80430f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804313:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80431a:	00 00 00 
+  80431d:	ff d0                	call   *%rax
+  80431f:	85 c0                	test   %eax,%eax
+  804321:	78 0c                	js     80432f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  804323:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804327:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80432a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80432f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804333:	c9                   	leave
+  804334:	c3                   	ret
+
+0000000000804335 <tell>:
+
+int tell(int fdnum) {
+  804335:	55                   	push   %rbp
+  804336:	48 89 e5             	mov    %rsp,%rbp
+  804339:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80433d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804341:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804348:	00 00 00 
+  80434b:	ff d0                	call   *%rax
+  80434d:	85 c0                	test   %eax,%eax
+  80434f:	78 07                	js     804358 <tell+0x23>
+
+    return fd->fd_offset;
+  804351:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804355:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  804358:	c9                   	leave
+  804359:	c3                   	ret
+
+000000000080435a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80435a:	55                   	push   %rbp
+  80435b:	48 89 e5             	mov    %rsp,%rbp
+  80435e:	41 55                	push   %r13
+  804360:	41 54                	push   %r12
+  804362:	53                   	push   %rbx
+  804363:	48 83 ec 18          	sub    $0x18,%rsp
+  804367:	89 fb                	mov    %edi,%ebx
+  804369:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80436c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804370:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804377:	00 00 00 
+  80437a:	ff d0                	call   *%rax
+  80437c:	85 c0                	test   %eax,%eax
+  80437e:	78 38                	js     8043b8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804380:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  804384:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  804388:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80438c:	48 b8 84 3e 80 00 00 	movabs $0x803e84,%rax
+  804393:	00 00 00 
+  804396:	ff d0                	call   *%rax
+  804398:	85 c0                	test   %eax,%eax
+  80439a:	78 1c                	js     8043b8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80439c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8043a1:	74 20                	je     8043c3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8043a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043a7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8043ab:	48 85 c0             	test   %rax,%rax
+  8043ae:	74 47                	je     8043f7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8043b0:	44 89 e6             	mov    %r12d,%esi
+  8043b3:	4c 89 ef             	mov    %r13,%rdi
+  8043b6:	ff d0                	call   *%rax
+}
+  8043b8:	48 83 c4 18          	add    $0x18,%rsp
+  8043bc:	5b                   	pop    %rbx
+  8043bd:	41 5c                	pop    %r12
+  8043bf:	41 5d                	pop    %r13
+  8043c1:	5d                   	pop    %rbp
+  8043c2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8043c3:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  8043ca:	00 00 00 
+  8043cd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8043d3:	89 da                	mov    %ebx,%edx
+  8043d5:	48 bf c8 79 80 00 00 	movabs $0x8079c8,%rdi
+  8043dc:	00 00 00 
+  8043df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e4:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  8043eb:	00 00 00 
+  8043ee:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8043f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8043f5:	eb c1                	jmp    8043b8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8043f7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8043fc:	eb ba                	jmp    8043b8 <ftruncate+0x5e>
+
+00000000008043fe <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8043fe:	55                   	push   %rbp
+  8043ff:	48 89 e5             	mov    %rsp,%rbp
+  804402:	41 54                	push   %r12
+  804404:	53                   	push   %rbx
+  804405:	48 83 ec 10          	sub    $0x10,%rsp
+  804409:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80440c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804410:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804417:	00 00 00 
+  80441a:	ff d0                	call   *%rax
+  80441c:	85 c0                	test   %eax,%eax
+  80441e:	78 63                	js     804483 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804420:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  804424:	41 8b 3c 24          	mov    (%r12),%edi
+  804428:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80442c:	48 b8 84 3e 80 00 00 	movabs $0x803e84,%rax
+  804433:	00 00 00 
+  804436:	ff d0                	call   *%rax
+  804438:	85 c0                	test   %eax,%eax
+  80443a:	78 47                	js     804483 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80443c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804440:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  804445:	74 45                	je     80448c <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  804447:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80444a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  804451:	00 00 00 
+    stat->st_isdir = 0;
+  804454:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80445b:	00 00 00 
+    stat->st_ino = 0;
+  80445e:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  804465:	00 00 00 00 
+    stat->st_version = 0;
+  804469:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  804470:	00 00 00 
+    stat->st_dev = dev;
+  804473:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80447a:	48 89 de             	mov    %rbx,%rsi
+  80447d:	4c 89 e7             	mov    %r12,%rdi
+  804480:	ff 50 28             	call   *0x28(%rax)
+}
+  804483:	48 83 c4 10          	add    $0x10,%rsp
+  804487:	5b                   	pop    %rbx
+  804488:	41 5c                	pop    %r12
+  80448a:	5d                   	pop    %rbp
+  80448b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80448c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804491:	eb f0                	jmp    804483 <fstat+0x85>
+
+0000000000804493 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804493:	55                   	push   %rbp
+  804494:	48 89 e5             	mov    %rsp,%rbp
+  804497:	41 54                	push   %r12
+  804499:	53                   	push   %rbx
+  80449a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80449d:	be 00 00 00 00       	mov    $0x0,%esi
+  8044a2:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  8044a9:	00 00 00 
+  8044ac:	ff d0                	call   *%rax
+  8044ae:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8044b0:	85 c0                	test   %eax,%eax
+  8044b2:	78 25                	js     8044d9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8044b4:	4c 89 e6             	mov    %r12,%rsi
+  8044b7:	89 c7                	mov    %eax,%edi
+  8044b9:	48 b8 fe 43 80 00 00 	movabs $0x8043fe,%rax
+  8044c0:	00 00 00 
+  8044c3:	ff d0                	call   *%rax
+  8044c5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8044c8:	89 df                	mov    %ebx,%edi
+  8044ca:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  8044d1:	00 00 00 
+  8044d4:	ff d0                	call   *%rax
+
+    return res;
+  8044d6:	44 89 e3             	mov    %r12d,%ebx
+}
+  8044d9:	89 d8                	mov    %ebx,%eax
+  8044db:	5b                   	pop    %rbx
+  8044dc:	41 5c                	pop    %r12
+  8044de:	5d                   	pop    %rbp
+  8044df:	c3                   	ret
+
+00000000008044e0 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8044e0:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  8044e7:	00 00 00 
+  8044ea:	83 38 00             	cmpl   $0x0,(%rax)
+  8044ed:	74 0a                	je     8044f9 <fsipc_env+0x19>
+    return fsenv;
+}
+  8044ef:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  8044f6:	00 00 
+  8044f8:	c3                   	ret
+fsipc_env(void) {
+  8044f9:	55                   	push   %rbp
+  8044fa:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8044fd:	bf 03 00 00 00       	mov    $0x3,%edi
+  804502:	48 b8 ba 6c 80 00 00 	movabs $0x806cba,%rax
+  804509:	00 00 00 
+  80450c:	ff d0                	call   *%rax
+  80450e:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  804515:	00 00 
+}
+  804517:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  80451e:	00 00 
+  804520:	5d                   	pop    %rbp
+  804521:	c3                   	ret
+
+0000000000804522 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  804522:	55                   	push   %rbp
+  804523:	48 89 e5             	mov    %rsp,%rbp
+  804526:	53                   	push   %rbx
+  804527:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80452b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804532:	00 
+  804533:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80453a:	00 
+  80453b:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  804542:	00 
+  804543:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80454a:	00 
+  80454b:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  804552:	00 
+
+    assert(size <= sizeof(words));
+  804553:	48 83 fa 28          	cmp    $0x28,%rdx
+  804557:	77 38                	ja     804591 <fsipc_short+0x6f>
+  804559:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80455b:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80455f:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  804566:	00 00 00 
+  804569:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80456b:	48 b8 e0 44 80 00 00 	movabs $0x8044e0,%rax
+  804572:	00 00 00 
+  804575:	ff d0                	call   *%rax
+  804577:	89 c7                	mov    %eax,%edi
+  804579:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80457d:	89 de                	mov    %ebx,%esi
+  80457f:	48 b8 1d 6c 80 00 00 	movabs $0x806c1d,%rax
+  804586:	00 00 00 
+  804589:	ff d0                	call   *%rax
+}
+  80458b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80458f:	c9                   	leave
+  804590:	c3                   	ret
+    assert(size <= sizeof(words));
+  804591:	48 b9 60 7a 80 00 00 	movabs $0x807a60,%rcx
+  804598:	00 00 00 
+  80459b:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  8045a2:	00 00 00 
+  8045a5:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8045aa:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  8045b1:	00 00 00 
+  8045b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b9:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  8045c0:	00 00 00 
+  8045c3:	41 ff d0             	call   *%r8
+
+00000000008045c6 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8045c6:	55                   	push   %rbp
+  8045c7:	48 89 e5             	mov    %rsp,%rbp
+  8045ca:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8045ce:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8045d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8045d4:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8045d7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8045dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045e0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8045e5:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  8045ec:	00 00 00 
+  8045ef:	ff d0                	call   *%rax
+}
+  8045f1:	c9                   	leave
+  8045f2:	c3                   	ret
+
+00000000008045f3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+  8045f7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8045fb:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8045fe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  804601:	ba 04 00 00 00       	mov    $0x4,%edx
+  804606:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80460a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80460f:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  804616:	00 00 00 
+  804619:	ff d0                	call   *%rax
+}
+  80461b:	c9                   	leave
+  80461c:	c3                   	ret
+
+000000000080461d <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80461d:	55                   	push   %rbp
+  80461e:	48 89 e5             	mov    %rsp,%rbp
+  804621:	41 54                	push   %r12
+  804623:	53                   	push   %rbx
+  804624:	48 83 ec 10          	sub    $0x10,%rsp
+  804628:	89 fb                	mov    %edi,%ebx
+  80462a:	49 89 f4             	mov    %rsi,%r12
+  80462d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  804631:	48 b8 e0 44 80 00 00 	movabs $0x8044e0,%rax
+  804638:	00 00 00 
+  80463b:	ff d0                	call   *%rax
+  80463d:	89 c7                	mov    %eax,%edi
+  80463f:	6a 00                	push   $0x0
+  804641:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  804645:	50                   	push   %rax
+  804646:	4d 89 e1             	mov    %r12,%r9
+  804649:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80464f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804654:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  80465b:	00 00 00 
+  80465e:	89 de                	mov    %ebx,%esi
+  804660:	48 b8 b8 6b 80 00 00 	movabs $0x806bb8,%rax
+  804667:	00 00 00 
+  80466a:	ff d0                	call   *%rax
+}
+  80466c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804670:	5b                   	pop    %rbx
+  804671:	41 5c                	pop    %r12
+  804673:	5d                   	pop    %rbp
+  804674:	c3                   	ret
+
+0000000000804675 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804675:	55                   	push   %rbp
+  804676:	48 89 e5             	mov    %rsp,%rbp
+  804679:	41 54                	push   %r12
+  80467b:	53                   	push   %rbx
+  80467c:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80467f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804682:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  804689:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80468b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804690:	be 00 00 00 00       	mov    $0x0,%esi
+  804695:	bf 05 00 00 00       	mov    $0x5,%edi
+  80469a:	48 b8 1d 46 80 00 00 	movabs $0x80461d,%rax
+  8046a1:	00 00 00 
+  8046a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8046a6:	85 c0                	test   %eax,%eax
+  8046a8:	78 5a                	js     804704 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8046aa:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  8046b1:	00 00 00 
+  8046b4:	4c 89 e6             	mov    %r12,%rsi
+  8046b7:	48 89 df             	mov    %rbx,%rdi
+  8046ba:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  8046c1:	00 00 00 
+  8046c4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8046c6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8046cd:	00 
+  8046ce:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8046d4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8046db:	00 
+  8046dc:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8046e2:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8046e9:	00 
+  8046ea:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8046f1:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8046f8:	00 
+  8046f9:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8046ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804704:	5b                   	pop    %rbx
+  804705:	41 5c                	pop    %r12
+  804707:	5d                   	pop    %rbp
+  804708:	c3                   	ret
+
+0000000000804709 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804709:	55                   	push   %rbp
+  80470a:	48 89 e5             	mov    %rsp,%rbp
+  80470d:	41 57                	push   %r15
+  80470f:	41 56                	push   %r14
+  804711:	41 55                	push   %r13
+  804713:	41 54                	push   %r12
+  804715:	53                   	push   %rbx
+  804716:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80471a:	48 85 ff             	test   %rdi,%rdi
+  80471d:	0f 84 a1 00 00 00    	je     8047c4 <devfile_read+0xbb>
+  804723:	49 89 ff             	mov    %rdi,%r15
+  804726:	49 89 f5             	mov    %rsi,%r13
+  804729:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80472c:	48 85 f6             	test   %rsi,%rsi
+  80472f:	0f 84 c4 00 00 00    	je     8047f9 <devfile_read+0xf0>
+    size_t total_read = 0;
+  804735:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80473c:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80473d:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  804744:	00 00 00 
+  804747:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80474b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80474e:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804752:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804757:	be 00 00 00 00       	mov    $0x0,%esi
+  80475c:	bf 03 00 00 00       	mov    $0x3,%edi
+  804761:	48 b8 1d 46 80 00 00 	movabs $0x80461d,%rax
+  804768:	00 00 00 
+  80476b:	ff d0                	call   *%rax
+        if (res < 0) {
+  80476d:	85 c0                	test   %eax,%eax
+  80476f:	0f 88 b9 00 00 00    	js     80482e <devfile_read+0x125>
+        assert(res <= n);
+  804775:	48 63 d8             	movslq %eax,%rbx
+  804778:	49 39 dc             	cmp    %rbx,%r12
+  80477b:	0f 82 b1 00 00 00    	jb     804832 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  804781:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  804786:	0f 87 db 00 00 00    	ja     804867 <devfile_read+0x15e>
+        if (!res) {
+  80478c:	85 c0                	test   %eax,%eax
+  80478e:	74 21                	je     8047b1 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804790:	48 89 da             	mov    %rbx,%rdx
+  804793:	4c 89 f6             	mov    %r14,%rsi
+  804796:	4c 89 ef             	mov    %r13,%rdi
+  804799:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  8047a0:	00 00 00 
+  8047a3:	ff d0                	call   *%rax
+        total_read += res;
+  8047a5:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8047a9:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8047ac:	49 29 dc             	sub    %rbx,%r12
+  8047af:	75 96                	jne    804747 <devfile_read+0x3e>
+    return total_read;
+  8047b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8047b5:	48 83 c4 18          	add    $0x18,%rsp
+  8047b9:	5b                   	pop    %rbx
+  8047ba:	41 5c                	pop    %r12
+  8047bc:	41 5d                	pop    %r13
+  8047be:	41 5e                	pop    %r14
+  8047c0:	41 5f                	pop    %r15
+  8047c2:	5d                   	pop    %rbp
+  8047c3:	c3                   	ret
+    assert(fd);
+  8047c4:	48 b9 81 7a 80 00 00 	movabs $0x807a81,%rcx
+  8047cb:	00 00 00 
+  8047ce:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  8047d5:	00 00 00 
+  8047d8:	be 91 00 00 00       	mov    $0x91,%esi
+  8047dd:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  8047e4:	00 00 00 
+  8047e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ec:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  8047f3:	00 00 00 
+  8047f6:	41 ff d0             	call   *%r8
+    assert(buf);
+  8047f9:	48 b9 84 7a 80 00 00 	movabs $0x807a84,%rcx
+  804800:	00 00 00 
+  804803:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  80480a:	00 00 00 
+  80480d:	be 92 00 00 00       	mov    $0x92,%esi
+  804812:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  804819:	00 00 00 
+  80481c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804821:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  804828:	00 00 00 
+  80482b:	41 ff d0             	call   *%r8
+            return res;
+  80482e:	48 98                	cltq
+  804830:	eb 83                	jmp    8047b5 <devfile_read+0xac>
+        assert(res <= n);
+  804832:	48 b9 88 7a 80 00 00 	movabs $0x807a88,%rcx
+  804839:	00 00 00 
+  80483c:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  804843:	00 00 00 
+  804846:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80484b:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  804852:	00 00 00 
+  804855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80485a:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  804861:	00 00 00 
+  804864:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  804867:	48 b9 98 7a 80 00 00 	movabs $0x807a98,%rcx
+  80486e:	00 00 00 
+  804871:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  804878:	00 00 00 
+  80487b:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804880:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  804887:	00 00 00 
+  80488a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80488f:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  804896:	00 00 00 
+  804899:	41 ff d0             	call   *%r8
+
+000000000080489c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80489c:	55                   	push   %rbp
+  80489d:	48 89 e5             	mov    %rsp,%rbp
+  8048a0:	41 57                	push   %r15
+  8048a2:	41 56                	push   %r14
+  8048a4:	41 55                	push   %r13
+  8048a6:	41 54                	push   %r12
+  8048a8:	53                   	push   %rbx
+  8048a9:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  8048ad:	48 85 ff             	test   %rdi,%rdi
+  8048b0:	0f 84 83 00 00 00    	je     804939 <devfile_write+0x9d>
+  8048b6:	49 89 ff             	mov    %rdi,%r15
+  8048b9:	49 89 f4             	mov    %rsi,%r12
+  8048bc:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8048bf:	48 85 f6             	test   %rsi,%rsi
+  8048c2:	0f 84 a6 00 00 00    	je     80496e <devfile_write+0xd2>
+    size_t total_written = 0;
+  8048c8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8048ce:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  8048d5:	00 00 00 
+  8048d8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8048dc:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8048df:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8048e3:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8048e8:	48 39 d3             	cmp    %rdx,%rbx
+  8048eb:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8048ef:	4c 89 e6             	mov    %r12,%rsi
+  8048f2:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  8048f9:	00 00 00 
+  8048fc:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  804903:	00 00 00 
+  804906:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804908:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80490d:	be 00 00 00 00       	mov    $0x0,%esi
+  804912:	bf 04 00 00 00       	mov    $0x4,%edi
+  804917:	48 b8 1d 46 80 00 00 	movabs $0x80461d,%rax
+  80491e:	00 00 00 
+  804921:	ff d0                	call   *%rax
+        if (res < 0) {
+  804923:	85 c0                	test   %eax,%eax
+  804925:	78 7c                	js     8049a3 <devfile_write+0x107>
+        total_written += res;
+  804927:	48 98                	cltq
+  804929:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80492c:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  80492f:	48 29 c3             	sub    %rax,%rbx
+  804932:	75 a4                	jne    8048d8 <devfile_write+0x3c>
+    return total_written;
+  804934:	4c 89 e8             	mov    %r13,%rax
+  804937:	eb 6c                	jmp    8049a5 <devfile_write+0x109>
+    assert(fd);
+  804939:	48 b9 81 7a 80 00 00 	movabs $0x807a81,%rcx
+  804940:	00 00 00 
+  804943:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  80494a:	00 00 00 
+  80494d:	be bd 00 00 00       	mov    $0xbd,%esi
+  804952:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  804959:	00 00 00 
+  80495c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804961:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  804968:	00 00 00 
+  80496b:	41 ff d0             	call   *%r8
+    assert(buf);
+  80496e:	48 b9 84 7a 80 00 00 	movabs $0x807a84,%rcx
+  804975:	00 00 00 
+  804978:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  80497f:	00 00 00 
+  804982:	be be 00 00 00       	mov    $0xbe,%esi
+  804987:	48 bf 76 7a 80 00 00 	movabs $0x807a76,%rdi
+  80498e:	00 00 00 
+  804991:	b8 00 00 00 00       	mov    $0x0,%eax
+  804996:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  80499d:	00 00 00 
+  8049a0:	41 ff d0             	call   *%r8
+            return res;
+  8049a3:	48 98                	cltq
+}
+  8049a5:	48 83 c4 08          	add    $0x8,%rsp
+  8049a9:	5b                   	pop    %rbx
+  8049aa:	41 5c                	pop    %r12
+  8049ac:	41 5d                	pop    %r13
+  8049ae:	41 5e                	pop    %r14
+  8049b0:	41 5f                	pop    %r15
+  8049b2:	5d                   	pop    %rbp
+  8049b3:	c3                   	ret
+
+00000000008049b4 <open>:
+open(const char *path, int mode) {
+  8049b4:	55                   	push   %rbp
+  8049b5:	48 89 e5             	mov    %rsp,%rbp
+  8049b8:	41 55                	push   %r13
+  8049ba:	41 54                	push   %r12
+  8049bc:	53                   	push   %rbx
+  8049bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8049c1:	49 89 fc             	mov    %rdi,%r12
+  8049c4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8049c7:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  8049ce:	00 00 00 
+  8049d1:	ff d0                	call   *%rax
+  8049d3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8049d9:	0f 87 8f 00 00 00    	ja     804a6e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8049df:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8049e3:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  8049ea:	00 00 00 
+  8049ed:	ff d0                	call   *%rax
+  8049ef:	89 c3                	mov    %eax,%ebx
+  8049f1:	85 c0                	test   %eax,%eax
+  8049f3:	78 55                	js     804a4a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8049f5:	4c 89 e6             	mov    %r12,%rsi
+  8049f8:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  8049ff:	00 00 00 
+  804a02:	48 89 df             	mov    %rbx,%rdi
+  804a05:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  804a0c:	00 00 00 
+  804a0f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804a11:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804a18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a1d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804a21:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a26:	48 b8 1d 46 80 00 00 	movabs $0x80461d,%rax
+  804a2d:	00 00 00 
+  804a30:	ff d0                	call   *%rax
+  804a32:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804a34:	85 c0                	test   %eax,%eax
+  804a36:	78 1f                	js     804a57 <open+0xa3>
+    return fd2num(fd);
+  804a38:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a3c:	48 b8 ab 3d 80 00 00 	movabs $0x803dab,%rax
+  804a43:	00 00 00 
+  804a46:	ff d0                	call   *%rax
+  804a48:	89 c3                	mov    %eax,%ebx
+}
+  804a4a:	89 d8                	mov    %ebx,%eax
+  804a4c:	48 83 c4 18          	add    $0x18,%rsp
+  804a50:	5b                   	pop    %rbx
+  804a51:	41 5c                	pop    %r12
+  804a53:	41 5d                	pop    %r13
+  804a55:	5d                   	pop    %rbp
+  804a56:	c3                   	ret
+        fd_close(fd, 0);
+  804a57:	be 00 00 00 00       	mov    $0x0,%esi
+  804a5c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a60:	48 b8 f4 3e 80 00 00 	movabs $0x803ef4,%rax
+  804a67:	00 00 00 
+  804a6a:	ff d0                	call   *%rax
+        return res;
+  804a6c:	eb dc                	jmp    804a4a <open+0x96>
+        return -E_BAD_PATH;
+  804a6e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804a73:	eb d5                	jmp    804a4a <open+0x96>
+
+0000000000804a75 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804a75:	55                   	push   %rbp
+  804a76:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804a79:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a7e:	be 00 00 00 00       	mov    $0x0,%esi
+  804a83:	bf 08 00 00 00       	mov    $0x8,%edi
+  804a88:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  804a8f:	00 00 00 
+  804a92:	ff d0                	call   *%rax
+}
+  804a94:	5d                   	pop    %rbp
+  804a95:	c3                   	ret
+
+0000000000804a96 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804a96:	55                   	push   %rbp
+  804a97:	48 89 e5             	mov    %rsp,%rbp
+  804a9a:	41 56                	push   %r14
+  804a9c:	41 55                	push   %r13
+  804a9e:	41 54                	push   %r12
+  804aa0:	53                   	push   %rbx
+  804aa1:	48 83 ec 10          	sub    $0x10,%rsp
+  804aa5:	41 89 f6             	mov    %esi,%r14d
+  804aa8:	49 89 d4             	mov    %rdx,%r12
+  804aab:	48 89 cb             	mov    %rcx,%rbx
+  804aae:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804ab1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804ab5:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804ac1:	85 c0                	test   %eax,%eax
+  804ac3:	78 46                	js     804b0b <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804ac5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ac9:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  804ad0:	00 00 00 
+  804ad3:	8b 00                	mov    (%rax),%eax
+  804ad5:	39 02                	cmp    %eax,(%rdx)
+  804ad7:	75 3f                	jne    804b18 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804ad9:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  804ae0:	00 00 00 
+  804ae3:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804ae6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804ae8:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804aec:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804af0:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804af4:	48 89 da             	mov    %rbx,%rdx
+  804af7:	4c 89 e6             	mov    %r12,%rsi
+  804afa:	bf 09 00 00 00       	mov    $0x9,%edi
+  804aff:	48 b8 1d 46 80 00 00 	movabs $0x80461d,%rax
+  804b06:	00 00 00 
+  804b09:	ff d0                	call   *%rax
+}
+  804b0b:	48 83 c4 10          	add    $0x10,%rsp
+  804b0f:	5b                   	pop    %rbx
+  804b10:	41 5c                	pop    %r12
+  804b12:	41 5d                	pop    %r13
+  804b14:	41 5e                	pop    %r14
+  804b16:	5d                   	pop    %rbp
+  804b17:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804b18:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804b1d:	eb ec                	jmp    804b0b <file_map+0x75>
+
+0000000000804b1f <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804b1f:	55                   	push   %rbp
+  804b20:	48 89 e5             	mov    %rsp,%rbp
+  804b23:	41 54                	push   %r12
+  804b25:	53                   	push   %rbx
+  804b26:	48 83 ec 20          	sub    $0x20,%rsp
+  804b2a:	41 89 f4             	mov    %esi,%r12d
+  804b2d:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804b30:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804b34:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  804b3b:	00 00 00 
+  804b3e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b40:	85 c0                	test   %eax,%eax
+  804b42:	78 3c                	js     804b80 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804b44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b48:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804b4f:	00 00 00 
+  804b52:	8b 0a                	mov    (%rdx),%ecx
+  804b54:	39 08                	cmp    %ecx,(%rax)
+  804b56:	75 31                	jne    804b89 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804b58:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b5b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804b5e:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804b62:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804b66:	ba 10 00 00 00       	mov    $0x10,%edx
+  804b6b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804b6f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804b74:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+}
+  804b80:	48 83 c4 20          	add    $0x20,%rsp
+  804b84:	5b                   	pop    %rbx
+  804b85:	41 5c                	pop    %r12
+  804b87:	5d                   	pop    %rbp
+  804b88:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804b89:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804b8e:	eb f0                	jmp    804b80 <file_msync+0x61>
+
+0000000000804b90 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804b90:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804b94:	7f 01                	jg     804b97 <writebuf+0x7>
+  804b96:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804b97:	55                   	push   %rbp
+  804b98:	48 89 e5             	mov    %rsp,%rbp
+  804b9b:	53                   	push   %rbx
+  804b9c:	48 83 ec 08          	sub    $0x8,%rsp
+  804ba0:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804ba3:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804ba7:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804bab:	8b 3f                	mov    (%rdi),%edi
+  804bad:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  804bb4:	00 00 00 
+  804bb7:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804bb9:	48 85 c0             	test   %rax,%rax
+  804bbc:	7e 04                	jle    804bc2 <writebuf+0x32>
+  804bbe:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804bc2:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804bc6:	48 39 c2             	cmp    %rax,%rdx
+  804bc9:	74 0f                	je     804bda <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804bcb:	48 85 c0             	test   %rax,%rax
+  804bce:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bd3:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804bd7:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804bda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804bde:	c9                   	leave
+  804bdf:	c3                   	ret
+
+0000000000804be0 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804be0:	8b 46 04             	mov    0x4(%rsi),%eax
+  804be3:	8d 50 01             	lea    0x1(%rax),%edx
+  804be6:	89 56 04             	mov    %edx,0x4(%rsi)
+  804be9:	48 98                	cltq
+  804beb:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804bf0:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804bf6:	74 01                	je     804bf9 <putch+0x19>
+  804bf8:	c3                   	ret
+putch(int ch, void *arg) {
+  804bf9:	55                   	push   %rbp
+  804bfa:	48 89 e5             	mov    %rsp,%rbp
+  804bfd:	53                   	push   %rbx
+  804bfe:	48 83 ec 08          	sub    $0x8,%rsp
+  804c02:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804c05:	48 89 f7             	mov    %rsi,%rdi
+  804c08:	48 b8 90 4b 80 00 00 	movabs $0x804b90,%rax
+  804c0f:	00 00 00 
+  804c12:	ff d0                	call   *%rax
+        state->offset = 0;
+  804c14:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804c1b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c1f:	c9                   	leave
+  804c20:	c3                   	ret
+
+0000000000804c21 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804c21:	55                   	push   %rbp
+  804c22:	48 89 e5             	mov    %rsp,%rbp
+  804c25:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804c2c:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804c2f:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804c35:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804c3c:	00 00 00 
+    state.result = 0;
+  804c3f:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804c46:	00 00 00 00 
+    state.error = 1;
+  804c4a:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804c51:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804c54:	48 89 f2             	mov    %rsi,%rdx
+  804c57:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804c5e:	48 bf e0 4b 80 00 00 	movabs $0x804be0,%rdi
+  804c65:	00 00 00 
+  804c68:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  804c6f:	00 00 00 
+  804c72:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804c74:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804c7b:	7f 14                	jg     804c91 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804c7d:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804c84:	48 85 c0             	test   %rax,%rax
+  804c87:	75 06                	jne    804c8f <vfprintf+0x6e>
+  804c89:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804c8f:	c9                   	leave
+  804c90:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804c91:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804c98:	48 b8 90 4b 80 00 00 	movabs $0x804b90,%rax
+  804c9f:	00 00 00 
+  804ca2:	ff d0                	call   *%rax
+  804ca4:	eb d7                	jmp    804c7d <vfprintf+0x5c>
+
+0000000000804ca6 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804ca6:	55                   	push   %rbp
+  804ca7:	48 89 e5             	mov    %rsp,%rbp
+  804caa:	48 83 ec 50          	sub    $0x50,%rsp
+  804cae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804cb2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804cb6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804cba:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804cbe:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804cc5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804cc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ccd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804cd1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804cd5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804cd9:	48 b8 21 4c 80 00 00 	movabs $0x804c21,%rax
+  804ce0:	00 00 00 
+  804ce3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804ce5:	c9                   	leave
+  804ce6:	c3                   	ret
+
+0000000000804ce7 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804ce7:	55                   	push   %rbp
+  804ce8:	48 89 e5             	mov    %rsp,%rbp
+  804ceb:	48 83 ec 50          	sub    $0x50,%rsp
+  804cef:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804cf3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804cf7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804cfb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804cff:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804d03:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804d0a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d12:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804d16:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804d1a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804d1e:	48 89 fe             	mov    %rdi,%rsi
+  804d21:	bf 01 00 00 00       	mov    $0x1,%edi
+  804d26:	48 b8 21 4c 80 00 00 	movabs $0x804c21,%rax
+  804d2d:	00 00 00 
+  804d30:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804d32:	c9                   	leave
+  804d33:	c3                   	ret
+
+0000000000804d34 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  804d34:	55                   	push   %rbp
+  804d35:	48 89 e5             	mov    %rsp,%rbp
+  804d38:	41 55                	push   %r13
+  804d3a:	41 54                	push   %r12
+  804d3c:	53                   	push   %rbx
+  804d3d:	48 83 ec 08          	sub    $0x8,%rsp
+  804d41:	48 89 fb             	mov    %rdi,%rbx
+  804d44:	49 89 f5             	mov    %rsi,%r13
+  804d47:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  804d4a:	48 b8 6d 5c 80 00 00 	movabs $0x805c6d,%rax
+  804d51:	00 00 00 
+  804d54:	ff d0                	call   *%rax
+  804d56:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  804d58:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  804d5f:	ff ff ff 
+  804d62:	48 01 d8             	add    %rbx,%rax
+  804d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d6a:	48 c1 e8 24          	shr    $0x24,%rax
+  804d6e:	74 5c                	je     804dcc <collect_shared_region+0x98>
+
+    if (list->count) {
+  804d70:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  804d77:	00 
+  804d78:	48 85 c0             	test   %rax,%rax
+  804d7b:	74 20                	je     804d9d <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  804d7d:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  804d81:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  804d85:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  804d89:	48 89 f7             	mov    %rsi,%rdi
+  804d8c:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  804d90:	48 39 fb             	cmp    %rdi,%rbx
+  804d93:	74 44                	je     804dd9 <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804d95:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  804d9b:	74 59                	je     804df6 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  804d9d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804da1:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  804da8:	00 
+  804da9:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  804dad:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804db1:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  804db5:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  804db8:	49 29 dd             	sub    %rbx,%r13
+  804dbb:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  804dbf:	48 01 c2             	add    %rax,%rdx
+  804dc2:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  804dc7:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  804dcc:	89 d0                	mov    %edx,%eax
+  804dce:	48 83 c4 08          	add    $0x8,%rsp
+  804dd2:	5b                   	pop    %rbx
+  804dd3:	41 5c                	pop    %r12
+  804dd5:	41 5d                	pop    %r13
+  804dd7:	5d                   	pop    %rbp
+  804dd8:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  804dd9:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  804dde:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804de3:	75 b0                	jne    804d95 <collect_shared_region+0x61>
+            last->size += end - start;
+  804de5:	49 29 dd             	sub    %rbx,%r13
+  804de8:	49 01 f5             	add    %rsi,%r13
+  804deb:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  804def:	ba 00 00 00 00       	mov    $0x0,%edx
+  804df4:	eb d6                	jmp    804dcc <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804df6:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  804dfb:	eb cf                	jmp    804dcc <collect_shared_region+0x98>
+
+0000000000804dfd <spawn>:
+spawn(const char *prog, const char **argv) {
+  804dfd:	55                   	push   %rbp
+  804dfe:	48 89 e5             	mov    %rsp,%rbp
+  804e01:	41 57                	push   %r15
+  804e03:	41 56                	push   %r14
+  804e05:	41 55                	push   %r13
+  804e07:	41 54                	push   %r12
+  804e09:	53                   	push   %rbx
+  804e0a:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  804e11:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  804e14:	be 00 00 00 00       	mov    $0x0,%esi
+  804e19:	48 b8 b4 49 80 00 00 	movabs $0x8049b4,%rax
+  804e20:	00 00 00 
+  804e23:	ff d0                	call   *%rax
+  804e25:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  804e28:	85 c0                	test   %eax,%eax
+  804e2a:	0f 88 8f 06 00 00    	js     8054bf <spawn+0x6c2>
+    struct SpawnImage img = {
+  804e30:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804e37:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  804e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e41:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804e44:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804e4b:	00 00 00 
+  804e4e:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  804e55:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  804e5c:	00 00 00 
+  804e5f:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  804e66:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  804e6d:	44 89 f7             	mov    %r14d,%edi
+  804e70:	48 b8 fe 43 80 00 00 	movabs $0x8043fe,%rax
+  804e77:	00 00 00 
+  804e7a:	ff d0                	call   *%rax
+  804e7c:	41 89 c4             	mov    %eax,%r12d
+  804e7f:	85 c0                	test   %eax,%eax
+  804e81:	0f 88 26 06 00 00    	js     8054ad <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  804e87:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804e8e:	48 85 c0             	test   %rax,%rax
+  804e91:	74 22                	je     804eb5 <spawn+0xb8>
+  804e93:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  804e9a:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  804ea1:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  804ea8:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  804eae:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  804eb5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804eba:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804ebf:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804ec6:	00 00 00 
+  804ec9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ece:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  804ed5:	00 00 00 
+  804ed8:	ff d0                	call   *%rax
+  804eda:	41 89 c4             	mov    %eax,%r12d
+  804edd:	85 c0                	test   %eax,%eax
+  804edf:	0f 88 c8 05 00 00    	js     8054ad <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804ee5:	48 8b 3b             	mov    (%rbx),%rdi
+  804ee8:	48 85 ff             	test   %rdi,%rdi
+  804eeb:	0f 84 61 02 00 00    	je     805152 <spawn+0x355>
+  804ef1:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  804ef7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  804efd:	49 bf 34 2b 80 00 00 	movabs $0x802b34,%r15
+  804f04:	00 00 00 
+  804f07:	41 ff d7             	call   *%r15
+  804f0a:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  804f0f:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  804f16:	49 83 c4 01          	add    $0x1,%r12
+  804f1a:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  804f1f:	48 85 ff             	test   %rdi,%rdi
+  804f22:	75 e3                	jne    804f07 <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804f24:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  804f2a:	4d 29 ec             	sub    %r13,%r12
+  804f2d:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804f34:	00 00 00 
+  804f37:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804f3a:	4c 89 e1             	mov    %r12,%rcx
+  804f3d:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  804f41:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  804f48:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  804f4f:	89 f0                	mov    %esi,%eax
+  804f51:	83 c0 01             	add    $0x1,%eax
+  804f54:	48 98                	cltq
+  804f56:	48 c1 e0 03          	shl    $0x3,%rax
+  804f5a:	48 29 c1             	sub    %rax,%rcx
+  804f5d:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804f64:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  804f68:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  804f6f:	00 00 00 
+  804f72:	48 39 c2             	cmp    %rax,%rdx
+  804f75:	0f 83 f2 04 00 00    	jae    80546d <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  804f7b:	85 f6                	test   %esi,%esi
+  804f7d:	7e 4e                	jle    804fcd <spawn+0x1d0>
+  804f7f:	49 89 cd             	mov    %rcx,%r13
+  804f82:	48 63 c6             	movslq %esi,%rax
+  804f85:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  804f89:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804f90:	00 00 00 
+  804f93:	4c 01 e0             	add    %r12,%rax
+  804f96:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  804f9a:	48 8b 33             	mov    (%rbx),%rsi
+  804f9d:	4c 89 e7             	mov    %r12,%rdi
+  804fa0:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  804fa7:	00 00 00 
+  804faa:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  804fac:	48 8b 3b             	mov    (%rbx),%rdi
+  804faf:	48 b8 34 2b 80 00 00 	movabs $0x802b34,%rax
+  804fb6:	00 00 00 
+  804fb9:	ff d0                	call   *%rax
+  804fbb:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  804fc0:	49 83 c5 08          	add    $0x8,%r13
+  804fc4:	48 83 c3 08          	add    $0x8,%rbx
+  804fc8:	4d 39 fd             	cmp    %r15,%r13
+  804fcb:	75 bc                	jne    804f89 <spawn+0x18c>
+    argv_store[argc] = 0;
+  804fcd:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804fd4:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  804fdb:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  804fdc:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804fe3:	00 00 00 
+  804fe6:	49 39 c4             	cmp    %rax,%r12
+  804fe9:	0f 85 92 01 00 00    	jne    805181 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  804fef:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804ff6:	00 00 00 
+  804ff9:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  805000:	48 01 d0             	add    %rdx,%rax
+  805003:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  805007:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80500e:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  805012:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  805019:	00 00 00 
+  80501c:	48 01 d0             	add    %rdx,%rax
+  80501f:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  805026:	48 be 20 b0 80 01 00 	movabs $0x180b020,%rsi
+  80502d:	00 00 00 
+  805030:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  805037:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  80503b:	48 bf 34 4d 80 00 00 	movabs $0x804d34,%rdi
+  805042:	00 00 00 
+  805045:	48 b8 e1 5c 80 00 00 	movabs $0x805ce1,%rax
+  80504c:	00 00 00 
+  80504f:	ff d0                	call   *%rax
+  805051:	41 89 c4             	mov    %eax,%r12d
+  805054:	85 c0                	test   %eax,%eax
+  805056:	0f 88 24 04 00 00    	js     805480 <spawn+0x683>
+    img.nshared = shared.count;
+  80505c:	48 a1 20 c8 80 01 00 	movabs 0x180c820,%rax
+  805063:	00 00 00 
+  805066:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  80506d:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  805074:	00 
+  805075:	74 1f                	je     805096 <spawn+0x299>
+        res = sys_spawn(&img);
+  805077:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80507e:	48 b8 92 37 80 00 00 	movabs $0x803792,%rax
+  805085:	00 00 00 
+  805088:	ff d0                	call   *%rax
+  80508a:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  80508d:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  805090:	0f 85 ca 03 00 00    	jne    805460 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  805096:	ba 00 02 00 00       	mov    $0x200,%edx
+  80509b:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  8050a2:	44 89 f7             	mov    %r14d,%edi
+  8050a5:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  8050ac:	00 00 00 
+  8050af:	ff d0                	call   *%rax
+  8050b1:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8050b3:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8050b8:	0f 85 f8 00 00 00    	jne    8051b6 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8050be:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8050c5:	ff ff 00 
+  8050c8:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8050cf:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8050d6:	01 01 00 
+  8050d9:	48 39 d0             	cmp    %rdx,%rax
+  8050dc:	0f 85 f7 00 00 00    	jne    8051d9 <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8050e2:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  8050e9:	00 3e 00 
+  8050ec:	0f 85 e7 00 00 00    	jne    8051d9 <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  8050f2:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  8050f9:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  805100:	ff 
+  805101:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  805108:	00 
+  805109:	4c 29 c0             	sub    %r8,%rax
+  80510c:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  805110:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  805116:	0f 87 bd 00 00 00    	ja     8051d9 <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80511c:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  805123:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  805124:	4d 85 c0             	test   %r8,%r8
+  805127:	0f 84 1b 02 00 00    	je     805348 <spawn+0x54b>
+  80512d:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  805132:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  805139:	00 00 01 00 
+  80513d:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  805143:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  80514a:	00 00 00 
+  80514d:	e9 d4 00 00 00       	jmp    805226 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  805152:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  805159:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80515d:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  805164:	00 00 00 
+  805167:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  80516e:	48 8d 40 08          	lea    0x8(%rax),%rax
+  805172:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  805179:	49 89 c4             	mov    %rax,%r12
+  80517c:	e9 4c fe ff ff       	jmp    804fcd <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  805181:	48 b9 c0 7a 80 00 00 	movabs $0x807ac0,%rcx
+  805188:	00 00 00 
+  80518b:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  805192:	00 00 00 
+  805195:	be e2 00 00 00       	mov    $0xe2,%esi
+  80519a:	48 bf 19 7b 80 00 00 	movabs $0x807b19,%rdi
+  8051a1:	00 00 00 
+  8051a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a9:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  8051b0:	00 00 00 
+  8051b3:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8051b6:	48 bf f0 7a 80 00 00 	movabs $0x807af0,%rdi
+  8051bd:	00 00 00 
+  8051c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c5:	48 ba 3b 22 80 00 00 	movabs $0x80223b,%rdx
+  8051cc:	00 00 00 
+  8051cf:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  8051d1:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8051d7:	eb 2c                	jmp    805205 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8051d9:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8051de:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  8051e4:	48 bf 25 7b 80 00 00 	movabs $0x807b25,%rdi
+  8051eb:	00 00 00 
+  8051ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f3:	48 b9 3b 22 80 00 00 	movabs $0x80223b,%rcx
+  8051fa:	00 00 00 
+  8051fd:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  8051ff:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  805205:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80520c:	00 00 01 00 
+  805210:	e9 76 02 00 00       	jmp    80548b <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  805215:	48 83 c2 01          	add    $0x1,%rdx
+  805219:	48 83 c0 38          	add    $0x38,%rax
+  80521d:	49 39 d0             	cmp    %rdx,%r8
+  805220:	0f 84 a5 00 00 00    	je     8052cb <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  805226:	83 38 01             	cmpl   $0x1,(%rax)
+  805229:	75 ea                	jne    805215 <spawn+0x418>
+  80522b:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  80522f:	48 85 f6             	test   %rsi,%rsi
+  805232:	74 e1                	je     805215 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  805234:	49 83 ff 10          	cmp    $0x10,%r15
+  805238:	0f 84 a1 02 00 00    	je     8054df <spawn+0x6e2>
+  80523e:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  805242:	0f 82 aa 02 00 00    	jb     8054f2 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  805248:	8b 78 04             	mov    0x4(%rax),%edi
+  80524b:	89 f9                	mov    %edi,%ecx
+  80524d:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  805250:	41 89 c9             	mov    %ecx,%r9d
+  805253:	41 83 c9 04          	or     $0x4,%r9d
+  805257:	40 f6 c7 04          	test   $0x4,%dil
+  80525b:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  80525f:	41 89 c9             	mov    %ecx,%r9d
+  805262:	41 83 c9 01          	or     $0x1,%r9d
+  805266:	40 f6 c7 01          	test   $0x1,%dil
+  80526a:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  80526e:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  805272:	49 89 f9             	mov    %rdi,%r9
+  805275:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  80527c:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  805283:	00 
+  805284:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80528b:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  80528e:	4c 89 ff             	mov    %r15,%rdi
+  805291:	48 c1 e7 05          	shl    $0x5,%rdi
+  805295:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  80529c:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  80529f:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  8052a6:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  8052aa:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  8052ad:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  8052b1:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  8052b5:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  8052b8:	48 01 f3             	add    %rsi,%rbx
+  8052bb:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  8052c2:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  8052c6:	e9 4a ff ff ff       	jmp    805215 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  8052cb:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  8052d2:	00 00 00 
+  8052d5:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  8052dc:	48 39 c8             	cmp    %rcx,%rax
+  8052df:	0f 82 ef 01 00 00    	jb     8054d4 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  8052e5:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  8052ec:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  8052f3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052f8:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  8052ff:	00 00 00 
+  805302:	bf 00 00 00 00       	mov    $0x0,%edi
+  805307:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  80530e:	00 00 00 
+  805311:	ff d0                	call   *%rax
+  805313:	41 89 c4             	mov    %eax,%r12d
+  805316:	85 c0                	test   %eax,%eax
+  805318:	0f 88 e7 fe ff ff    	js     805205 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80531e:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  805325:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  80532c:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  80532d:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  805334:	00 
+  805335:	0f 84 d3 00 00 00    	je     80540e <spawn+0x611>
+  80533b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  805341:	ba 00 00 00 00       	mov    $0x0,%edx
+  805346:	eb 46                	jmp    80538e <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  805348:	4d 89 c7             	mov    %r8,%r15
+  80534b:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  805352:	00 00 01 00 
+  805356:	eb 8d                	jmp    8052e5 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  805358:	48 85 c0             	test   %rax,%rax
+  80535b:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  805362:	48 0f 49 c2          	cmovns %rdx,%rax
+  805366:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  805369:	85 c0                	test   %eax,%eax
+  80536b:	0f 89 c0 00 00 00    	jns    805431 <spawn+0x634>
+  805371:	e9 15 01 00 00       	jmp    80548b <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  805376:	49 83 c5 01          	add    $0x1,%r13
+  80537a:	48 83 c3 38          	add    $0x38,%rbx
+  80537e:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  805385:	49 39 c5             	cmp    %rax,%r13
+  805388:	0f 83 80 00 00 00    	jae    80540e <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  80538e:	83 3b 01             	cmpl   $0x1,(%rbx)
+  805391:	75 e3                	jne    805376 <spawn+0x579>
+  805393:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  805398:	74 dc                	je     805376 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  80539a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80539e:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8053a5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8053a9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8053ad:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8053b2:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  8053b9:	ff 
+  8053ba:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  8053c1:	8b 73 08             	mov    0x8(%rbx),%esi
+  8053c4:	44 89 f7             	mov    %r14d,%edi
+  8053c7:	48 ba 04 43 80 00 00 	movabs $0x804304,%rdx
+  8053ce:	00 00 00 
+  8053d1:	ff d2                	call   *%rdx
+  8053d3:	41 89 c4             	mov    %eax,%r12d
+  8053d6:	85 c0                	test   %eax,%eax
+  8053d8:	0f 88 ad 00 00 00    	js     80548b <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  8053de:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8053e2:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  8053e9:	44 89 f7             	mov    %r14d,%edi
+  8053ec:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  8053f3:	00 00 00 
+  8053f6:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  8053f8:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  8053fc:	0f 85 56 ff ff ff    	jne    805358 <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  805402:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  805409:	e9 68 ff ff ff       	jmp    805376 <spawn+0x579>
+    img->entry = elf->e_entry;
+  80540e:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  805415:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  80541c:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  805423:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  80542a:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  805431:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  805438:	48 b8 92 37 80 00 00 	movabs $0x803792,%rax
+  80543f:	00 00 00 
+  805442:	ff d0                	call   *%rax
+  805444:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  805447:	45 85 e4             	test   %r12d,%r12d
+  80544a:	78 3f                	js     80548b <spawn+0x68e>
+    close(fd);
+  80544c:	44 89 f7             	mov    %r14d,%edi
+  80544f:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  805456:	00 00 00 
+  805459:	ff d0                	call   *%rax
+    return res;
+  80545b:	45 89 e6             	mov    %r12d,%r14d
+  80545e:	eb 5f                	jmp    8054bf <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  805460:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  805467:	00 00 01 00 
+  80546b:	eb da                	jmp    805447 <spawn+0x64a>
+  80546d:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  805474:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  805478:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  80547e:	eb 0b                	jmp    80548b <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  805480:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  805487:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  80548b:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  805492:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  805499:	00 00 00 
+  80549c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054a1:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  8054a8:	00 00 00 
+  8054ab:	ff d0                	call   *%rax
+    close(fd);
+  8054ad:	44 89 f7             	mov    %r14d,%edi
+  8054b0:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  8054b7:	00 00 00 
+  8054ba:	ff d0                	call   *%rax
+    return res;
+  8054bc:	45 89 e6             	mov    %r12d,%r14d
+}
+  8054bf:	44 89 f0             	mov    %r14d,%eax
+  8054c2:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  8054c9:	5b                   	pop    %rbx
+  8054ca:	41 5c                	pop    %r12
+  8054cc:	41 5d                	pop    %r13
+  8054ce:	41 5e                	pop    %r14
+  8054d0:	41 5f                	pop    %r15
+  8054d2:	5d                   	pop    %rbp
+  8054d3:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  8054d4:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  8054da:	e9 26 fd ff ff       	jmp    805205 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  8054df:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8054e6:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  8054ea:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8054f0:	eb 99                	jmp    80548b <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  8054f2:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8054f9:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  8054fd:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  805503:	eb 86                	jmp    80548b <spawn+0x68e>
+
+0000000000805505 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  805505:	55                   	push   %rbp
+  805506:	48 89 e5             	mov    %rsp,%rbp
+  805509:	48 83 ec 50          	sub    $0x50,%rsp
+  80550d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805511:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  805515:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  805519:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80551d:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  805524:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805528:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80552c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805530:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  805534:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  805539:	eb 15                	jmp    805550 <spawnl+0x4b>
+  80553b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80553f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  805543:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805547:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80554b:	74 1c                	je     805569 <spawnl+0x64>
+  80554d:	83 c1 01             	add    $0x1,%ecx
+  805550:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  805553:	83 f8 2f             	cmp    $0x2f,%eax
+  805556:	77 e3                	ja     80553b <spawnl+0x36>
+  805558:	89 c2                	mov    %eax,%edx
+  80555a:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80555e:	4c 01 d2             	add    %r10,%rdx
+  805561:	83 c0 08             	add    $0x8,%eax
+  805564:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  805567:	eb de                	jmp    805547 <spawnl+0x42>
+    const char *argv[argc + 2];
+  805569:	8d 41 02             	lea    0x2(%rcx),%eax
+  80556c:	48 98                	cltq
+  80556e:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  805575:	00 
+  805576:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  80557a:	48 29 c4             	sub    %rax,%rsp
+  80557d:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  805582:	4c 89 c0             	mov    %r8,%rax
+  805585:	48 c1 e8 03          	shr    $0x3,%rax
+  805589:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80558d:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  805594:	00 
+    argv[argc + 1] = NULL;
+  805595:	8d 41 01             	lea    0x1(%rcx),%eax
+  805598:	48 98                	cltq
+  80559a:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8055a1:	00 
+    va_start(vl, arg0);
+  8055a2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8055a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8055ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8055b1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8055b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8055b9:	85 c9                	test   %ecx,%ecx
+  8055bb:	74 41                	je     8055fe <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8055bd:	49 89 c1             	mov    %rax,%r9
+  8055c0:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8055c4:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8055c7:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8055cc:	eb 1b                	jmp    8055e9 <spawnl+0xe4>
+  8055ce:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8055d2:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8055d6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8055da:	48 8b 11             	mov    (%rcx),%rdx
+  8055dd:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8055e0:	48 83 c0 08          	add    $0x8,%rax
+  8055e4:	48 39 f0             	cmp    %rsi,%rax
+  8055e7:	74 15                	je     8055fe <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8055e9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8055ec:	83 fa 2f             	cmp    $0x2f,%edx
+  8055ef:	77 dd                	ja     8055ce <spawnl+0xc9>
+  8055f1:	89 d1                	mov    %edx,%ecx
+  8055f3:	4c 01 c9             	add    %r9,%rcx
+  8055f6:	83 c2 08             	add    $0x8,%edx
+  8055f9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8055fc:	eb dc                	jmp    8055da <spawnl+0xd5>
+    return spawn(prog, argv);
+  8055fe:	4c 89 c6             	mov    %r8,%rsi
+  805601:	48 b8 fd 4d 80 00 00 	movabs $0x804dfd,%rax
+  805608:	00 00 00 
+  80560b:	ff d0                	call   *%rax
+}
+  80560d:	c9                   	leave
+  80560e:	c3                   	ret
+
+000000000080560f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80560f:	55                   	push   %rbp
+  805610:	48 89 e5             	mov    %rsp,%rbp
+  805613:	41 54                	push   %r12
+  805615:	53                   	push   %rbx
+  805616:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805619:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  805620:	00 00 00 
+  805623:	ff d0                	call   *%rax
+  805625:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  805628:	48 be 3f 7b 80 00 00 	movabs $0x807b3f,%rsi
+  80562f:	00 00 00 
+  805632:	48 89 df             	mov    %rbx,%rdi
+  805635:	48 b8 72 2b 80 00 00 	movabs $0x802b72,%rax
+  80563c:	00 00 00 
+  80563f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  805641:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  805646:	41 2b 04 24          	sub    (%r12),%eax
+  80564a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  805650:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  805657:	00 00 00 
+    stat->st_dev = &devpipe;
+  80565a:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805661:	00 00 00 
+  805664:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80566b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805670:	5b                   	pop    %rbx
+  805671:	41 5c                	pop    %r12
+  805673:	5d                   	pop    %rbp
+  805674:	c3                   	ret
+
+0000000000805675 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805675:	55                   	push   %rbp
+  805676:	48 89 e5             	mov    %rsp,%rbp
+  805679:	41 54                	push   %r12
+  80567b:	53                   	push   %rbx
+  80567c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80567f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805684:	48 89 fe             	mov    %rdi,%rsi
+  805687:	bf 00 00 00 00       	mov    $0x0,%edi
+  80568c:	49 bc f9 34 80 00 00 	movabs $0x8034f9,%r12
+  805693:	00 00 00 
+  805696:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  805699:	48 89 df             	mov    %rbx,%rdi
+  80569c:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  8056a3:	00 00 00 
+  8056a6:	ff d0                	call   *%rax
+  8056a8:	48 89 c6             	mov    %rax,%rsi
+  8056ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8056b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056b5:	41 ff d4             	call   *%r12
+}
+  8056b8:	5b                   	pop    %rbx
+  8056b9:	41 5c                	pop    %r12
+  8056bb:	5d                   	pop    %rbp
+  8056bc:	c3                   	ret
+
+00000000008056bd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8056bd:	55                   	push   %rbp
+  8056be:	48 89 e5             	mov    %rsp,%rbp
+  8056c1:	41 57                	push   %r15
+  8056c3:	41 56                	push   %r14
+  8056c5:	41 55                	push   %r13
+  8056c7:	41 54                	push   %r12
+  8056c9:	53                   	push   %rbx
+  8056ca:	48 83 ec 18          	sub    $0x18,%rsp
+  8056ce:	49 89 fc             	mov    %rdi,%r12
+  8056d1:	49 89 f5             	mov    %rsi,%r13
+  8056d4:	49 89 d7             	mov    %rdx,%r15
+  8056d7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8056db:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  8056e2:	00 00 00 
+  8056e5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8056e7:	4d 85 ff             	test   %r15,%r15
+  8056ea:	0f 84 af 00 00 00    	je     80579f <devpipe_write+0xe2>
+  8056f0:	48 89 c3             	mov    %rax,%rbx
+  8056f3:	4c 89 f8             	mov    %r15,%rax
+  8056f6:	4d 89 ef             	mov    %r13,%r15
+  8056f9:	4c 01 e8             	add    %r13,%rax
+  8056fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805700:	49 bd ef 33 80 00 00 	movabs $0x8033ef,%r13
+  805707:	00 00 00 
+            sys_yield();
+  80570a:	49 be 80 33 80 00 00 	movabs $0x803380,%r14
+  805711:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  805714:	8b 73 04             	mov    0x4(%rbx),%esi
+  805717:	48 63 ce             	movslq %esi,%rcx
+  80571a:	48 63 03             	movslq (%rbx),%rax
+  80571d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  805723:	48 39 c1             	cmp    %rax,%rcx
+  805726:	72 2e                	jb     805756 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805728:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80572d:	48 89 da             	mov    %rbx,%rdx
+  805730:	be 00 10 00 00       	mov    $0x1000,%esi
+  805735:	4c 89 e7             	mov    %r12,%rdi
+  805738:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80573b:	85 c0                	test   %eax,%eax
+  80573d:	74 66                	je     8057a5 <devpipe_write+0xe8>
+            sys_yield();
+  80573f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  805742:	8b 73 04             	mov    0x4(%rbx),%esi
+  805745:	48 63 ce             	movslq %esi,%rcx
+  805748:	48 63 03             	movslq (%rbx),%rax
+  80574b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  805751:	48 39 c1             	cmp    %rax,%rcx
+  805754:	73 d2                	jae    805728 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805756:	41 0f b6 3f          	movzbl (%r15),%edi
+  80575a:	48 89 ca             	mov    %rcx,%rdx
+  80575d:	48 c1 ea 03          	shr    $0x3,%rdx
+  805761:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  805768:	08 10 20 
+  80576b:	48 f7 e2             	mul    %rdx
+  80576e:	48 c1 ea 06          	shr    $0x6,%rdx
+  805772:	48 89 d0             	mov    %rdx,%rax
+  805775:	48 c1 e0 09          	shl    $0x9,%rax
+  805779:	48 29 d0             	sub    %rdx,%rax
+  80577c:	48 c1 e0 03          	shl    $0x3,%rax
+  805780:	48 29 c1             	sub    %rax,%rcx
+  805783:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  805788:	83 c6 01             	add    $0x1,%esi
+  80578b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80578e:	49 83 c7 01          	add    $0x1,%r15
+  805792:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805796:	49 39 c7             	cmp    %rax,%r15
+  805799:	0f 85 75 ff ff ff    	jne    805714 <devpipe_write+0x57>
+    return n;
+  80579f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8057a3:	eb 05                	jmp    8057aa <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8057a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057aa:	48 83 c4 18          	add    $0x18,%rsp
+  8057ae:	5b                   	pop    %rbx
+  8057af:	41 5c                	pop    %r12
+  8057b1:	41 5d                	pop    %r13
+  8057b3:	41 5e                	pop    %r14
+  8057b5:	41 5f                	pop    %r15
+  8057b7:	5d                   	pop    %rbp
+  8057b8:	c3                   	ret
+
+00000000008057b9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8057b9:	55                   	push   %rbp
+  8057ba:	48 89 e5             	mov    %rsp,%rbp
+  8057bd:	41 57                	push   %r15
+  8057bf:	41 56                	push   %r14
+  8057c1:	41 55                	push   %r13
+  8057c3:	41 54                	push   %r12
+  8057c5:	53                   	push   %rbx
+  8057c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8057ca:	49 89 fc             	mov    %rdi,%r12
+  8057cd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8057d1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8057d5:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  8057dc:	00 00 00 
+  8057df:	ff d0                	call   *%rax
+  8057e1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8057e4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8057ea:	49 bd ef 33 80 00 00 	movabs $0x8033ef,%r13
+  8057f1:	00 00 00 
+            sys_yield();
+  8057f4:	49 be 80 33 80 00 00 	movabs $0x803380,%r14
+  8057fb:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8057fe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805803:	74 7d                	je     805882 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805805:	8b 03                	mov    (%rbx),%eax
+  805807:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80580a:	75 26                	jne    805832 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80580c:	4d 85 ff             	test   %r15,%r15
+  80580f:	75 77                	jne    805888 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805811:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805816:	48 89 da             	mov    %rbx,%rdx
+  805819:	be 00 10 00 00       	mov    $0x1000,%esi
+  80581e:	4c 89 e7             	mov    %r12,%rdi
+  805821:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  805824:	85 c0                	test   %eax,%eax
+  805826:	74 72                	je     80589a <devpipe_read+0xe1>
+            sys_yield();
+  805828:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80582b:	8b 03                	mov    (%rbx),%eax
+  80582d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  805830:	74 df                	je     805811 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  805832:	48 63 c8             	movslq %eax,%rcx
+  805835:	48 89 ca             	mov    %rcx,%rdx
+  805838:	48 c1 ea 03          	shr    $0x3,%rdx
+  80583c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  805843:	08 10 20 
+  805846:	48 89 d0             	mov    %rdx,%rax
+  805849:	48 f7 e6             	mul    %rsi
+  80584c:	48 c1 ea 06          	shr    $0x6,%rdx
+  805850:	48 89 d0             	mov    %rdx,%rax
+  805853:	48 c1 e0 09          	shl    $0x9,%rax
+  805857:	48 29 d0             	sub    %rdx,%rax
+  80585a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805861:	00 
+  805862:	48 89 c8             	mov    %rcx,%rax
+  805865:	48 29 d0             	sub    %rdx,%rax
+  805868:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80586d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805871:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  805875:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  805878:	49 83 c7 01          	add    $0x1,%r15
+  80587c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  805880:	75 83                	jne    805805 <devpipe_read+0x4c>
+    return n;
+  805882:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805886:	eb 03                	jmp    80588b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  805888:	4c 89 f8             	mov    %r15,%rax
+}
+  80588b:	48 83 c4 18          	add    $0x18,%rsp
+  80588f:	5b                   	pop    %rbx
+  805890:	41 5c                	pop    %r12
+  805892:	41 5d                	pop    %r13
+  805894:	41 5e                	pop    %r14
+  805896:	41 5f                	pop    %r15
+  805898:	5d                   	pop    %rbp
+  805899:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80589a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80589f:	eb ea                	jmp    80588b <devpipe_read+0xd2>
+
+00000000008058a1 <pipe>:
+pipe(int pfd[2]) {
+  8058a1:	55                   	push   %rbp
+  8058a2:	48 89 e5             	mov    %rsp,%rbp
+  8058a5:	41 55                	push   %r13
+  8058a7:	41 54                	push   %r12
+  8058a9:	53                   	push   %rbx
+  8058aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8058ae:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8058b1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8058b5:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  8058bc:	00 00 00 
+  8058bf:	ff d0                	call   *%rax
+  8058c1:	89 c3                	mov    %eax,%ebx
+  8058c3:	85 c0                	test   %eax,%eax
+  8058c5:	0f 88 a0 01 00 00    	js     805a6b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8058cb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8058d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8058d5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8058d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058de:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  8058e5:	00 00 00 
+  8058e8:	ff d0                	call   *%rax
+  8058ea:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8058ec:	85 c0                	test   %eax,%eax
+  8058ee:	0f 88 77 01 00 00    	js     805a6b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8058f4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8058f8:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  8058ff:	00 00 00 
+  805902:	ff d0                	call   *%rax
+  805904:	89 c3                	mov    %eax,%ebx
+  805906:	85 c0                	test   %eax,%eax
+  805908:	0f 88 43 01 00 00    	js     805a51 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80590e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805913:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805918:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80591c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805921:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  805928:	00 00 00 
+  80592b:	ff d0                	call   *%rax
+  80592d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80592f:	85 c0                	test   %eax,%eax
+  805931:	0f 88 1a 01 00 00    	js     805a51 <pipe+0x1b0>
+    va = fd2data(fd0);
+  805937:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80593b:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  805942:	00 00 00 
+  805945:	ff d0                	call   *%rax
+  805947:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80594a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80594f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805954:	48 89 c6             	mov    %rax,%rsi
+  805957:	bf 00 00 00 00       	mov    $0x0,%edi
+  80595c:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  805963:	00 00 00 
+  805966:	ff d0                	call   *%rax
+  805968:	89 c3                	mov    %eax,%ebx
+  80596a:	85 c0                	test   %eax,%eax
+  80596c:	0f 88 c5 00 00 00    	js     805a37 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  805972:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805976:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  80597d:	00 00 00 
+  805980:	ff d0                	call   *%rax
+  805982:	48 89 c1             	mov    %rax,%rcx
+  805985:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80598b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805991:	ba 00 00 00 00       	mov    $0x0,%edx
+  805996:	4c 89 ee             	mov    %r13,%rsi
+  805999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80599e:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  8059a5:	00 00 00 
+  8059a8:	ff d0                	call   *%rax
+  8059aa:	89 c3                	mov    %eax,%ebx
+  8059ac:	85 c0                	test   %eax,%eax
+  8059ae:	78 6e                	js     805a1e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8059b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8059b5:	4c 89 ef             	mov    %r13,%rdi
+  8059b8:	48 b8 b7 33 80 00 00 	movabs $0x8033b7,%rax
+  8059bf:	00 00 00 
+  8059c2:	ff d0                	call   *%rax
+  8059c4:	83 f8 02             	cmp    $0x2,%eax
+  8059c7:	0f 85 ab 00 00 00    	jne    805a78 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8059cd:	a1 c0 80 80 00 00 00 	movabs 0x8080c0,%eax
+  8059d4:	00 00 
+  8059d6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8059da:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8059dc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8059e0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8059e7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8059eb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8059ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8059f1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8059f8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8059fc:	48 bb ab 3d 80 00 00 	movabs $0x803dab,%rbx
+  805a03:	00 00 00 
+  805a06:	ff d3                	call   *%rbx
+  805a08:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  805a0c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805a10:	ff d3                	call   *%rbx
+  805a12:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  805a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805a1c:	eb 4d                	jmp    805a6b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805a1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a23:	4c 89 ee             	mov    %r13,%rsi
+  805a26:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a2b:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  805a32:	00 00 00 
+  805a35:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  805a37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a3c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a45:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  805a4c:	00 00 00 
+  805a4f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  805a51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a56:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a5f:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  805a66:	00 00 00 
+  805a69:	ff d0                	call   *%rax
+}
+  805a6b:	89 d8                	mov    %ebx,%eax
+  805a6d:	48 83 c4 18          	add    $0x18,%rsp
+  805a71:	5b                   	pop    %rbx
+  805a72:	41 5c                	pop    %r12
+  805a74:	41 5d                	pop    %r13
+  805a76:	5d                   	pop    %rbp
+  805a77:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  805a78:	48 b9 58 7b 80 00 00 	movabs $0x807b58,%rcx
+  805a7f:	00 00 00 
+  805a82:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  805a89:	00 00 00 
+  805a8c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  805a91:	48 bf 46 7b 80 00 00 	movabs $0x807b46,%rdi
+  805a98:	00 00 00 
+  805a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aa0:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  805aa7:	00 00 00 
+  805aaa:	41 ff d0             	call   *%r8
+
+0000000000805aad <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805aad:	55                   	push   %rbp
+  805aae:	48 89 e5             	mov    %rsp,%rbp
+  805ab1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805ab5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805ab9:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  805ac0:	00 00 00 
+  805ac3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805ac5:	85 c0                	test   %eax,%eax
+  805ac7:	78 35                	js     805afe <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  805ac9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805acd:	48 b8 bd 3d 80 00 00 	movabs $0x803dbd,%rax
+  805ad4:	00 00 00 
+  805ad7:	ff d0                	call   *%rax
+  805ad9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805adc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805ae1:	be 00 10 00 00       	mov    $0x1000,%esi
+  805ae6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805aea:	48 b8 ef 33 80 00 00 	movabs $0x8033ef,%rax
+  805af1:	00 00 00 
+  805af4:	ff d0                	call   *%rax
+  805af6:	85 c0                	test   %eax,%eax
+  805af8:	0f 94 c0             	sete   %al
+  805afb:	0f b6 c0             	movzbl %al,%eax
+}
+  805afe:	c9                   	leave
+  805aff:	c3                   	ret
+
+0000000000805b00 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  805b00:	55                   	push   %rbp
+  805b01:	48 89 e5             	mov    %rsp,%rbp
+  805b04:	41 55                	push   %r13
+  805b06:	41 54                	push   %r12
+  805b08:	53                   	push   %rbx
+  805b09:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  805b0d:	85 ff                	test   %edi,%edi
+  805b0f:	74 73                	je     805b84 <wait+0x84>
+  805b11:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  805b14:	89 f8                	mov    %edi,%eax
+  805b16:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  805b1b:	89 f9                	mov    %edi,%ecx
+  805b1d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  805b23:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  805b2a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805b31:	00 00 00 
+  805b34:	48 01 ca             	add    %rcx,%rdx
+  805b37:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  805b3d:	39 d7                	cmp    %edx,%edi
+  805b3f:	75 38                	jne    805b79 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  805b41:	48 98                	cltq
+  805b43:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805b4a:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  805b51:	00 00 00 
+  805b54:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  805b57:	49 bd 80 33 80 00 00 	movabs $0x803380,%r13
+  805b5e:	00 00 00 
+           env->env_status != ENV_FREE) {
+  805b61:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  805b67:	85 c0                	test   %eax,%eax
+  805b69:	74 0e                	je     805b79 <wait+0x79>
+        sys_yield();
+  805b6b:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  805b6e:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  805b74:	44 39 e0             	cmp    %r12d,%eax
+  805b77:	74 e8                	je     805b61 <wait+0x61>
+    }
+}
+  805b79:	48 83 c4 08          	add    $0x8,%rsp
+  805b7d:	5b                   	pop    %rbx
+  805b7e:	41 5c                	pop    %r12
+  805b80:	41 5d                	pop    %r13
+  805b82:	5d                   	pop    %rbp
+  805b83:	c3                   	ret
+    assert(envid != 0);
+  805b84:	48 b9 7c 7b 80 00 00 	movabs $0x807b7c,%rcx
+  805b8b:	00 00 00 
+  805b8e:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  805b95:	00 00 00 
+  805b98:	be 06 00 00 00       	mov    $0x6,%esi
+  805b9d:	48 bf 87 7b 80 00 00 	movabs $0x807b87,%rdi
+  805ba4:	00 00 00 
+  805ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bac:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  805bb3:	00 00 00 
+  805bb6:	41 ff d0             	call   *%r8
+
+0000000000805bb9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805bb9:	48 89 f8             	mov    %rdi,%rax
+  805bbc:	48 c1 e8 27          	shr    $0x27,%rax
+  805bc0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805bc7:	01 00 00 
+  805bca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805bce:	f6 c2 01             	test   $0x1,%dl
+  805bd1:	74 6d                	je     805c40 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805bd3:	48 89 f8             	mov    %rdi,%rax
+  805bd6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805bda:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805be1:	01 00 00 
+  805be4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805be8:	f6 c2 01             	test   $0x1,%dl
+  805beb:	74 62                	je     805c4f <get_uvpt_entry+0x96>
+  805bed:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805bf4:	01 00 00 
+  805bf7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805bfb:	f6 c2 80             	test   $0x80,%dl
+  805bfe:	75 4f                	jne    805c4f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805c00:	48 89 f8             	mov    %rdi,%rax
+  805c03:	48 c1 e8 15          	shr    $0x15,%rax
+  805c07:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805c0e:	01 00 00 
+  805c11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805c15:	f6 c2 01             	test   $0x1,%dl
+  805c18:	74 44                	je     805c5e <get_uvpt_entry+0xa5>
+  805c1a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805c21:	01 00 00 
+  805c24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805c28:	f6 c2 80             	test   $0x80,%dl
+  805c2b:	75 31                	jne    805c5e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  805c2d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  805c31:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805c38:	01 00 00 
+  805c3b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  805c3f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805c40:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805c47:	01 00 00 
+  805c4a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805c4e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805c4f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805c56:	01 00 00 
+  805c59:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805c5d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805c5e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805c65:	01 00 00 
+  805c68:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805c6c:	c3                   	ret
+
+0000000000805c6d <get_prot>:
+
+int
+get_prot(void *va) {
+  805c6d:	55                   	push   %rbp
+  805c6e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805c71:	48 b8 b9 5b 80 00 00 	movabs $0x805bb9,%rax
+  805c78:	00 00 00 
+  805c7b:	ff d0                	call   *%rax
+  805c7d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805c80:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805c85:	89 c1                	mov    %eax,%ecx
+  805c87:	83 c9 04             	or     $0x4,%ecx
+  805c8a:	f6 c2 01             	test   $0x1,%dl
+  805c8d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805c90:	89 c1                	mov    %eax,%ecx
+  805c92:	83 c9 02             	or     $0x2,%ecx
+  805c95:	f6 c2 02             	test   $0x2,%dl
+  805c98:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  805c9b:	89 c1                	mov    %eax,%ecx
+  805c9d:	83 c9 01             	or     $0x1,%ecx
+  805ca0:	48 85 d2             	test   %rdx,%rdx
+  805ca3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805ca6:	89 c1                	mov    %eax,%ecx
+  805ca8:	83 c9 40             	or     $0x40,%ecx
+  805cab:	f6 c6 04             	test   $0x4,%dh
+  805cae:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805cb1:	5d                   	pop    %rbp
+  805cb2:	c3                   	ret
+
+0000000000805cb3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805cb3:	55                   	push   %rbp
+  805cb4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805cb7:	48 b8 b9 5b 80 00 00 	movabs $0x805bb9,%rax
+  805cbe:	00 00 00 
+  805cc1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805cc3:	48 c1 e8 06          	shr    $0x6,%rax
+  805cc7:	83 e0 01             	and    $0x1,%eax
+}
+  805cca:	5d                   	pop    %rbp
+  805ccb:	c3                   	ret
+
+0000000000805ccc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  805ccc:	55                   	push   %rbp
+  805ccd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805cd0:	48 b8 b9 5b 80 00 00 	movabs $0x805bb9,%rax
+  805cd7:	00 00 00 
+  805cda:	ff d0                	call   *%rax
+  805cdc:	83 e0 01             	and    $0x1,%eax
+}
+  805cdf:	5d                   	pop    %rbp
+  805ce0:	c3                   	ret
+
+0000000000805ce1 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805ce1:	55                   	push   %rbp
+  805ce2:	48 89 e5             	mov    %rsp,%rbp
+  805ce5:	41 57                	push   %r15
+  805ce7:	41 56                	push   %r14
+  805ce9:	41 55                	push   %r13
+  805ceb:	41 54                	push   %r12
+  805ced:	53                   	push   %rbx
+  805cee:	48 83 ec 28          	sub    $0x28,%rsp
+  805cf2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  805cf6:	48 85 ff             	test   %rdi,%rdi
+  805cf9:	74 1e                	je     805d19 <foreach_shared_region+0x38>
+  805cfb:	49 89 ff             	mov    %rdi,%r15
+  805cfe:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  805d04:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  805d0a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  805d11:	01 00 00 
+  805d14:	e9 72 02 00 00       	jmp    805f8b <foreach_shared_region+0x2aa>
+    assert(fun);
+  805d19:	48 b9 92 7b 80 00 00 	movabs $0x807b92,%rcx
+  805d20:	00 00 00 
+  805d23:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  805d2a:	00 00 00 
+  805d2d:	be 2d 00 00 00       	mov    $0x2d,%esi
+  805d32:	48 bf 96 7b 80 00 00 	movabs $0x807b96,%rdi
+  805d39:	00 00 00 
+  805d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d41:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  805d48:	00 00 00 
+  805d4b:	41 ff d0             	call   *%r8
+  805d4e:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  805d55:	eb 6c                	jmp    805dc3 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  805d57:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805d5e:	ff ff ff 
+  805d61:	4c 21 e2             	and    %r12,%rdx
+  805d64:	48 89 d8             	mov    %rbx,%rax
+  805d67:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d6c:	48 83 c0 01          	add    $0x1,%rax
+  805d70:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805d74:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  805d7b:	00 00 00 
+  805d7e:	48 21 c8             	and    %rcx,%rax
+  805d81:	48 09 d0             	or     %rdx,%rax
+  805d84:	49 89 c4             	mov    %rax,%r12
+  805d87:	eb 30                	jmp    805db9 <foreach_shared_region+0xd8>
+  805d89:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805d90:	ff ff ff 
+  805d93:	4c 21 e2             	and    %r12,%rdx
+  805d96:	48 89 d8             	mov    %rbx,%rax
+  805d99:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805d9e:	48 83 c0 01          	add    $0x1,%rax
+  805da2:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805da6:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  805dad:	00 00 00 
+  805db0:	48 21 c8             	and    %rcx,%rax
+  805db3:	48 09 d0             	or     %rdx,%rax
+  805db6:	49 89 c4             	mov    %rax,%r12
+  805db9:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  805dbd:	0f 84 99 01 00 00    	je     805f5c <foreach_shared_region+0x27b>
+  805dc3:	4c 89 e3             	mov    %r12,%rbx
+  805dc6:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  805dca:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805dd1:	01 00 00 
+  805dd4:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805dd8:	a8 01                	test   $0x1,%al
+  805dda:	0f 84 77 ff ff ff    	je     805d57 <foreach_shared_region+0x76>
+  805de0:	a8 80                	test   $0x80,%al
+  805de2:	74 19                	je     805dfd <foreach_shared_region+0x11c>
+  805de4:	f6 c4 04             	test   $0x4,%ah
+  805de7:	74 a0                	je     805d89 <foreach_shared_region+0xa8>
+  805de9:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  805df0:	40 
+  805df1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805df5:	4c 89 e7             	mov    %r12,%rdi
+  805df8:	41 ff d7             	call   *%r15
+  805dfb:	eb 8c                	jmp    805d89 <foreach_shared_region+0xa8>
+  805dfd:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  805e04:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  805e08:	eb 46                	jmp    805e50 <foreach_shared_region+0x16f>
+  805e0a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805e11:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805e17:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  805e1b:	48 c1 e0 15          	shl    $0x15,%rax
+  805e1f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805e24:	49 09 c4             	or     %rax,%r12
+  805e27:	eb 1d                	jmp    805e46 <foreach_shared_region+0x165>
+  805e29:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805e30:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805e36:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  805e3a:	48 c1 e0 15          	shl    $0x15,%rax
+  805e3e:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805e43:	49 09 c4             	or     %rax,%r12
+  805e46:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  805e4a:	0f 84 d3 00 00 00    	je     805f23 <foreach_shared_region+0x242>
+  805e50:	4c 89 e3             	mov    %r12,%rbx
+  805e53:	48 c1 eb 15          	shr    $0x15,%rbx
+  805e57:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805e5e:	01 00 00 
+  805e61:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805e65:	a8 01                	test   $0x1,%al
+  805e67:	74 a1                	je     805e0a <foreach_shared_region+0x129>
+  805e69:	a8 80                	test   $0x80,%al
+  805e6b:	74 19                	je     805e86 <foreach_shared_region+0x1a5>
+  805e6d:	f6 c4 04             	test   $0x4,%ah
+  805e70:	74 b7                	je     805e29 <foreach_shared_region+0x148>
+  805e72:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  805e79:	00 
+  805e7a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805e7e:	4c 89 e7             	mov    %r12,%rdi
+  805e81:	41 ff d7             	call   *%r15
+  805e84:	eb a3                	jmp    805e29 <foreach_shared_region+0x148>
+  805e86:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  805e8c:	eb 3b                	jmp    805ec9 <foreach_shared_region+0x1e8>
+  805e8e:	f6 c4 04             	test   $0x4,%ah
+  805e91:	74 12                	je     805ea5 <foreach_shared_region+0x1c4>
+  805e93:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  805e9a:	00 
+  805e9b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805e9f:	4c 89 e7             	mov    %r12,%rdi
+  805ea2:	41 ff d7             	call   *%r15
+  805ea5:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805eac:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805eb2:	48 83 c3 01          	add    $0x1,%rbx
+  805eb6:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805eba:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805ec0:	49 09 dc             	or     %rbx,%r12
+  805ec3:	41 83 ed 01          	sub    $0x1,%r13d
+  805ec7:	74 2f                	je     805ef8 <foreach_shared_region+0x217>
+  805ec9:	4c 89 e3             	mov    %r12,%rbx
+  805ecc:	48 c1 eb 0c          	shr    $0xc,%rbx
+  805ed0:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805ed4:	a8 01                	test   $0x1,%al
+  805ed6:	75 b6                	jne    805e8e <foreach_shared_region+0x1ad>
+  805ed8:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805edf:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805ee5:	48 83 c3 01          	add    $0x1,%rbx
+  805ee9:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805eed:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805ef3:	49 09 dc             	or     %rbx,%r12
+  805ef6:	eb cb                	jmp    805ec3 <foreach_shared_region+0x1e2>
+  805ef8:	4c 89 e0             	mov    %r12,%rax
+  805efb:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  805f01:	49 c1 ec 15          	shr    $0x15,%r12
+  805f05:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805f0c:	49 83 c4 01          	add    $0x1,%r12
+  805f10:	49 c1 e4 15          	shl    $0x15,%r12
+  805f14:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  805f1b:	49 09 c4             	or     %rax,%r12
+  805f1e:	e9 23 ff ff ff       	jmp    805e46 <foreach_shared_region+0x165>
+  805f23:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  805f27:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  805f2e:	ff ff ff 
+  805f31:	4c 21 e0             	and    %r12,%rax
+  805f34:	49 c1 ec 1e          	shr    $0x1e,%r12
+  805f38:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805f3f:	49 83 c4 01          	add    $0x1,%r12
+  805f43:	49 c1 e4 1e          	shl    $0x1e,%r12
+  805f47:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  805f4e:	00 00 00 
+  805f51:	49 21 d4             	and    %rdx,%r12
+  805f54:	49 09 c4             	or     %rax,%r12
+  805f57:	e9 5d fe ff ff       	jmp    805db9 <foreach_shared_region+0xd8>
+  805f5c:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  805f63:	00 ff ff 
+  805f66:	4c 21 e0             	and    %r12,%rax
+  805f69:	49 c1 ec 27          	shr    $0x27,%r12
+  805f6d:	49 83 c4 01          	add    $0x1,%r12
+  805f71:	49 c1 e4 27          	shl    $0x27,%r12
+  805f75:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  805f7c:	ff 00 00 
+  805f7f:	49 21 d4             	and    %rdx,%r12
+  805f82:	49 09 c4             	or     %rax,%r12
+  805f85:	41 83 ed 01          	sub    $0x1,%r13d
+  805f89:	74 48                	je     805fd3 <foreach_shared_region+0x2f2>
+  805f8b:	4c 89 e0             	mov    %r12,%rax
+  805f8e:	48 c1 e8 27          	shr    $0x27,%rax
+  805f92:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  805f99:	01 00 00 
+  805f9c:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  805fa0:	f6 c2 01             	test   $0x1,%dl
+  805fa3:	0f 85 a5 fd ff ff    	jne    805d4e <foreach_shared_region+0x6d>
+  805fa9:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805fb0:	00 ff ff 
+  805fb3:	4c 21 e2             	and    %r12,%rdx
+  805fb6:	48 83 c0 01          	add    $0x1,%rax
+  805fba:	48 c1 e0 27          	shl    $0x27,%rax
+  805fbe:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  805fc5:	ff 00 00 
+  805fc8:	48 21 c8             	and    %rcx,%rax
+  805fcb:	48 09 d0             	or     %rdx,%rax
+  805fce:	49 89 c4             	mov    %rax,%r12
+  805fd1:	eb b2                	jmp    805f85 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805fd3:	4d 85 e4             	test   %r12,%r12
+  805fd6:	75 14                	jne    805fec <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  805fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fdd:	48 83 c4 28          	add    $0x28,%rsp
+  805fe1:	5b                   	pop    %rbx
+  805fe2:	41 5c                	pop    %r12
+  805fe4:	41 5d                	pop    %r13
+  805fe6:	41 5e                	pop    %r14
+  805fe8:	41 5f                	pop    %r15
+  805fea:	5d                   	pop    %rbp
+  805feb:	c3                   	ret
+    assert(addr == 0);
+  805fec:	48 b9 a1 7b 80 00 00 	movabs $0x807ba1,%rcx
+  805ff3:	00 00 00 
+  805ff6:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  805ffd:	00 00 00 
+  806000:	be 67 00 00 00       	mov    $0x67,%esi
+  806005:	48 bf 96 7b 80 00 00 	movabs $0x807b96,%rdi
+  80600c:	00 00 00 
+  80600f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806014:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  80601b:	00 00 00 
+  80601e:	41 ff d0             	call   *%r8
+
+0000000000806021 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  806021:	49 b8 40 cc 80 01 00 	movabs $0x180cc40,%r8
+  806028:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80602b:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  806031:	eb 33                	jmp    806066 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  806033:	48 83 c0 20          	add    $0x20,%rax
+  806037:	4c 39 c0             	cmp    %r8,%rax
+  80603a:	74 25                	je     806061 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80603c:	48 8b 10             	mov    (%rax),%rdx
+  80603f:	48 85 d2             	test   %rdx,%rdx
+  806042:	74 ef                	je     806033 <mmap_place+0x12>
+  806044:	48 89 d1             	mov    %rdx,%rcx
+  806047:	48 03 48 08          	add    0x8(%rax),%rcx
+  80604b:	48 39 cf             	cmp    %rcx,%rdi
+  80604e:	73 e3                	jae    806033 <mmap_place+0x12>
+  806050:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  806054:	4c 39 ca             	cmp    %r9,%rdx
+  806057:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80605b:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  80605f:	eb d2                	jmp    806033 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  806061:	45 84 d2             	test   %r10b,%r10b
+  806064:	74 12                	je     806078 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  806066:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  80606d:	00 00 00 
+        moved = 0;
+  806070:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  806076:	eb c4                	jmp    80603c <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  806078:	48 01 fe             	add    %rdi,%rsi
+  80607b:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  806082:	00 00 00 
+  806085:	48 39 f0             	cmp    %rsi,%rax
+  806088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80608d:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  806091:	c3                   	ret
+
+0000000000806092 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  806092:	55                   	push   %rbp
+  806093:	48 89 e5             	mov    %rsp,%rbp
+  806096:	41 57                	push   %r15
+  806098:	41 56                	push   %r14
+  80609a:	41 55                	push   %r13
+  80609c:	41 54                	push   %r12
+  80609e:	53                   	push   %rbx
+  80609f:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8060a3:	48 8b 1f             	mov    (%rdi),%rbx
+  8060a6:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8060ad:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  8060b4:	00 00 00 
+  8060b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060bc:	eb 12                	jmp    8060d0 <mmap_pgfault+0x3e>
+  8060be:	48 83 c2 01          	add    $0x1,%rdx
+  8060c2:	48 83 c0 20          	add    $0x20,%rax
+  8060c6:	48 83 fa 20          	cmp    $0x20,%rdx
+  8060ca:	0f 84 04 01 00 00    	je     8061d4 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8060d0:	48 8b 08             	mov    (%rax),%rcx
+  8060d3:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8060d7:	48 39 de             	cmp    %rbx,%rsi
+  8060da:	73 e2                	jae    8060be <mmap_pgfault+0x2c>
+  8060dc:	48 03 48 08          	add    0x8(%rax),%rcx
+  8060e0:	48 39 cb             	cmp    %rcx,%rbx
+  8060e3:	73 d9                	jae    8060be <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8060e5:	48 c1 e2 05          	shl    $0x5,%rdx
+  8060e9:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  8060f0:	00 00 00 
+  8060f3:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8060f7:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8060fb:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8060ff:	f6 c2 01             	test   $0x1,%dl
+  806102:	0f 84 e0 00 00 00    	je     8061e8 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  806108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80610d:	f6 c2 02             	test   $0x2,%dl
+  806110:	0f 84 c3 00 00 00    	je     8061d9 <mmap_pgfault+0x147>
+  806116:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80611d:	ff ff ff 
+  806120:	48 23 56 10          	and    0x10(%rsi),%rdx
+  806124:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80612b:	00 00 00 
+  80612e:	48 39 ca             	cmp    %rcx,%rdx
+  806131:	0f 85 a2 00 00 00    	jne    8061d9 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  806137:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80613c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  806141:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  806148:	00 00 00 
+  80614b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806150:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  806157:	00 00 00 
+  80615a:	ff d0                	call   *%rax
+  80615c:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  80615e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806163:	85 d2                	test   %edx,%edx
+  806165:	78 72                	js     8061d9 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  806167:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80616c:	48 89 de             	mov    %rbx,%rsi
+  80616f:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  806176:	00 00 00 
+  806179:	4c 89 e7             	mov    %r12,%rdi
+  80617c:	48 b8 29 2f 80 00 00 	movabs $0x802f29,%rax
+  806183:	00 00 00 
+  806186:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  806188:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  80618e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  806194:	48 89 d9             	mov    %rbx,%rcx
+  806197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80619c:	4c 89 e6             	mov    %r12,%rsi
+  80619f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061a4:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  8061ab:	00 00 00 
+  8061ae:	ff d0                	call   *%rax
+  8061b0:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8061b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8061b7:	4c 89 e6             	mov    %r12,%rsi
+  8061ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8061bf:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  8061c6:	00 00 00 
+  8061c9:	ff d0                	call   *%rax
+    return res >= 0;
+  8061cb:	89 d8                	mov    %ebx,%eax
+  8061cd:	f7 d0                	not    %eax
+  8061cf:	c1 e8 1f             	shr    $0x1f,%eax
+  8061d2:	eb 05                	jmp    8061d9 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8061d4:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8061d9:	48 83 c4 18          	add    $0x18,%rsp
+  8061dd:	5b                   	pop    %rbx
+  8061de:	41 5c                	pop    %r12
+  8061e0:	41 5d                	pop    %r13
+  8061e2:	41 5e                	pop    %r14
+  8061e4:	41 5f                	pop    %r15
+  8061e6:	5d                   	pop    %rbp
+  8061e7:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  8061e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8061ec:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  8061f0:	4c 03 30             	add    (%rax),%r14
+  8061f3:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  8061fa:	49 39 c6             	cmp    %rax,%r14
+  8061fd:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  806201:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  806208:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80620e:	49 bf cc 5c 80 00 00 	movabs $0x805ccc,%r15
+  806215:	00 00 00 
+  806218:	4d 39 f4             	cmp    %r14,%r12
+  80621b:	73 1d                	jae    80623a <mmap_pgfault+0x1a8>
+  80621d:	4c 89 e7             	mov    %r12,%rdi
+  806220:	41 ff d7             	call   *%r15
+  806223:	84 c0                	test   %al,%al
+  806225:	75 13                	jne    80623a <mmap_pgfault+0x1a8>
+  806227:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80622e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  806235:	4d 39 f4             	cmp    %r14,%r12
+  806238:	72 e3                	jb     80621d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80623a:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  806240:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806244:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  806248:	74 2a                	je     806274 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80624a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80624e:	89 de                	mov    %ebx,%esi
+  806250:	2b 30                	sub    (%rax),%esi
+  806252:	03 70 1c             	add    0x1c(%rax),%esi
+  806255:	8b 78 18             	mov    0x18(%rax),%edi
+  806258:	4c 89 e9             	mov    %r13,%rcx
+  80625b:	48 89 da             	mov    %rbx,%rdx
+  80625e:	48 b8 96 4a 80 00 00 	movabs $0x804a96,%rax
+  806265:	00 00 00 
+  806268:	ff d0                	call   *%rax
+    return res > 0;
+  80626a:	85 c0                	test   %eax,%eax
+  80626c:	0f 9f c0             	setg   %al
+  80626f:	e9 65 ff ff ff       	jmp    8061d9 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  806274:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  806278:	eb d0                	jmp    80624a <mmap_pgfault+0x1b8>
+
+000000000080627a <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  80627a:	55                   	push   %rbp
+  80627b:	48 89 e5             	mov    %rsp,%rbp
+  80627e:	41 57                	push   %r15
+  806280:	41 56                	push   %r14
+  806282:	41 55                	push   %r13
+  806284:	41 54                	push   %r12
+  806286:	53                   	push   %rbx
+  806287:	48 83 ec 28          	sub    $0x28,%rsp
+  80628b:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  80628f:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  806292:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  806299:	ff ff ff 
+  80629c:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8062a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062a5:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8062ac:	00 00 00 
+  8062af:	48 39 ca             	cmp    %rcx,%rdx
+  8062b2:	0f 85 e5 00 00 00    	jne    80639d <mmap_writeback+0x123>
+  8062b8:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8062bb:	4c 39 ee             	cmp    %r13,%rsi
+  8062be:	0f 83 e8 00 00 00    	jae    8063ac <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8062c4:	49 be cc 5c 80 00 00 	movabs $0x805ccc,%r14
+  8062cb:	00 00 00 
+  8062ce:	49 bf b3 5c 80 00 00 	movabs $0x805cb3,%r15
+  8062d5:	00 00 00 
+  8062d8:	eb 10                	jmp    8062ea <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8062da:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  8062e1:	4d 39 ec             	cmp    %r13,%r12
+  8062e4:	0f 83 ae 00 00 00    	jae    806398 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8062ea:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8062ee:	4c 89 e7             	mov    %r12,%rdi
+  8062f1:	41 ff d6             	call   *%r14
+  8062f4:	84 c0                	test   %al,%al
+  8062f6:	74 e2                	je     8062da <mmap_writeback+0x60>
+  8062f8:	4c 89 e7             	mov    %r12,%rdi
+  8062fb:	41 ff d7             	call   *%r15
+  8062fe:	84 c0                	test   %al,%al
+  806300:	74 d8                	je     8062da <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  806302:	4c 89 e3             	mov    %r12,%rbx
+  806305:	4d 39 ec             	cmp    %r13,%r12
+  806308:	73 20                	jae    80632a <mmap_writeback+0xb0>
+  80630a:	48 89 df             	mov    %rbx,%rdi
+  80630d:	41 ff d6             	call   *%r14
+  806310:	84 c0                	test   %al,%al
+  806312:	74 16                	je     80632a <mmap_writeback+0xb0>
+  806314:	48 89 df             	mov    %rbx,%rdi
+  806317:	41 ff d7             	call   *%r15
+  80631a:	84 c0                	test   %al,%al
+  80631c:	74 0c                	je     80632a <mmap_writeback+0xb0>
+  80631e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  806325:	4c 39 eb             	cmp    %r13,%rbx
+  806328:	72 e0                	jb     80630a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80632a:	48 89 d9             	mov    %rbx,%rcx
+  80632d:	4c 29 e1             	sub    %r12,%rcx
+  806330:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806334:	44 89 e6             	mov    %r12d,%esi
+  806337:	2b 30                	sub    (%rax),%esi
+  806339:	49 89 c4             	mov    %rax,%r12
+  80633c:	03 70 1c             	add    0x1c(%rax),%esi
+  80633f:	8b 78 18             	mov    0x18(%rax),%edi
+  806342:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  806346:	48 89 ca             	mov    %rcx,%rdx
+  806349:	48 b8 1f 4b 80 00 00 	movabs $0x804b1f,%rax
+  806350:	00 00 00 
+  806353:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  806355:	85 c0                	test   %eax,%eax
+  806357:	78 44                	js     80639d <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  806359:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  80635e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  806361:	41 89 c1             	mov    %eax,%r9d
+  806364:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  80636b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  80636f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  806373:	ba 00 00 00 00       	mov    $0x0,%edx
+  806378:	48 89 ce             	mov    %rcx,%rsi
+  80637b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806380:	48 b8 8e 34 80 00 00 	movabs $0x80348e,%rax
+  806387:	00 00 00 
+  80638a:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  80638c:	85 c0                	test   %eax,%eax
+  80638e:	78 0d                	js     80639d <mmap_writeback+0x123>
+  806390:	49 89 dc             	mov    %rbx,%r12
+  806393:	e9 49 ff ff ff       	jmp    8062e1 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  806398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80639d:	48 83 c4 28          	add    $0x28,%rsp
+  8063a1:	5b                   	pop    %rbx
+  8063a2:	41 5c                	pop    %r12
+  8063a4:	41 5d                	pop    %r13
+  8063a6:	41 5e                	pop    %r14
+  8063a8:	41 5f                	pop    %r15
+  8063aa:	5d                   	pop    %rbp
+  8063ab:	c3                   	ret
+    return 0;
+  8063ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063b1:	eb ea                	jmp    80639d <mmap_writeback+0x123>
+
+00000000008063b3 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8063b3:	55                   	push   %rbp
+  8063b4:	48 89 e5             	mov    %rsp,%rbp
+  8063b7:	41 57                	push   %r15
+  8063b9:	41 56                	push   %r14
+  8063bb:	41 55                	push   %r13
+  8063bd:	41 54                	push   %r12
+  8063bf:	53                   	push   %rbx
+  8063c0:	48 83 ec 38          	sub    $0x38,%rsp
+  8063c4:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8063c8:	48 85 f6             	test   %rsi,%rsi
+  8063cb:	0f 84 0c 02 00 00    	je     8065dd <mmap+0x22a>
+  8063d1:	49 89 ff             	mov    %rdi,%r15
+  8063d4:	49 89 f4             	mov    %rsi,%r12
+  8063d7:	41 89 d5             	mov    %edx,%r13d
+  8063da:	41 89 ce             	mov    %ecx,%r14d
+  8063dd:	44 89 cb             	mov    %r9d,%ebx
+  8063e0:	45 85 c9             	test   %r9d,%r9d
+  8063e3:	0f 88 f4 01 00 00    	js     8065dd <mmap+0x22a>
+  8063e9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8063f0:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  8063f7:	0f 85 e7 01 00 00    	jne    8065e4 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  8063fd:	83 e2 fd             	and    $0xfffffffd,%edx
+  806400:	83 fa 04             	cmp    $0x4,%edx
+  806403:	0f 85 db 01 00 00    	jne    8065e4 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  806409:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80640c:	83 fa 01             	cmp    $0x1,%edx
+  80640f:	0f 87 cf 01 00 00    	ja     8065e4 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  806415:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  806419:	44 89 c7             	mov    %r8d,%edi
+  80641c:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  806423:	00 00 00 
+  806426:	ff d0                	call   *%rax
+  806428:	89 c2                	mov    %eax,%edx
+  80642a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  806431:	85 d2                	test   %edx,%edx
+  806433:	0f 88 ab 01 00 00    	js     8065e4 <mmap+0x231>
+  806439:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80643d:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  806444:	00 00 00 
+  806447:	8b 09                	mov    (%rcx),%ecx
+  806449:	39 0a                	cmp    %ecx,(%rdx)
+  80644b:	0f 85 93 01 00 00    	jne    8065e4 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  806451:	8b 52 08             	mov    0x8(%rdx),%edx
+  806454:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  806457:	83 fa 01             	cmp    $0x1,%edx
+  80645a:	0f 84 84 01 00 00    	je     8065e4 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  806460:	41 83 fe 01          	cmp    $0x1,%r14d
+  806464:	74 42                	je     8064a8 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  806466:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  80646d:	4c 89 e6             	mov    %r12,%rsi
+  806470:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  806477:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  80647b:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  80647f:	4d 85 ff             	test   %r15,%r15
+  806482:	74 67                	je     8064eb <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  806484:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  80648b:	75 0f                	jne    80649c <mmap+0xe9>
+  80648d:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  806494:	00 00 00 
+  806497:	49 39 c7             	cmp    %rax,%r15
+  80649a:	77 1b                	ja     8064b7 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80649c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8064a3:	e9 3c 01 00 00       	jmp    8065e4 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8064a8:	41 f6 c5 02          	test   $0x2,%r13b
+  8064ac:	74 b8                	je     806466 <mmap+0xb3>
+  8064ae:	85 d2                	test   %edx,%edx
+  8064b0:	75 b4                	jne    806466 <mmap+0xb3>
+  8064b2:	e9 2d 01 00 00       	jmp    8065e4 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8064b7:	4c 89 ff             	mov    %r15,%rdi
+  8064ba:	48 b8 21 60 80 00 00 	movabs $0x806021,%rax
+  8064c1:	00 00 00 
+  8064c4:	ff d0                	call   *%rax
+  8064c6:	48 89 c2             	mov    %rax,%rdx
+  8064c9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8064d0:	49 39 d7             	cmp    %rdx,%r15
+  8064d3:	0f 85 0b 01 00 00    	jne    8065e4 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8064d9:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  8064e0:	00 00 00 
+  8064e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8064e9:	eb 44                	jmp    80652f <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8064eb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8064ef:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8064f6:	00 00 00 
+  8064f9:	48 b8 21 60 80 00 00 	movabs $0x806021,%rax
+  806500:	00 00 00 
+  806503:	ff d0                	call   *%rax
+  806505:	48 89 c7             	mov    %rax,%rdi
+  806508:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80650c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  806513:	48 85 ff             	test   %rdi,%rdi
+  806516:	75 c1                	jne    8064d9 <mmap+0x126>
+  806518:	e9 c7 00 00 00       	jmp    8065e4 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80651d:	49 83 c4 01          	add    $0x1,%r12
+  806521:	48 83 c0 20          	add    $0x20,%rax
+  806525:	49 83 fc 20          	cmp    $0x20,%r12
+  806529:	0f 84 a5 00 00 00    	je     8065d4 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80652f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  806533:	75 e8                	jne    80651d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  806535:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  806539:	48 b8 d9 3d 80 00 00 	movabs $0x803dd9,%rax
+  806540:	00 00 00 
+  806543:	ff d0                	call   *%rax
+  806545:	89 c2                	mov    %eax,%edx
+  806547:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80654e:	85 d2                	test   %edx,%edx
+  806550:	0f 88 8e 00 00 00    	js     8065e4 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  806556:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80655a:	48 b8 ab 3d 80 00 00 	movabs $0x803dab,%rax
+  806561:	00 00 00 
+  806564:	ff d0                	call   *%rax
+  806566:	89 c6                	mov    %eax,%esi
+  806568:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80656b:	48 b8 f9 3f 80 00 00 	movabs $0x803ff9,%rax
+  806572:	00 00 00 
+  806575:	ff d0                	call   *%rax
+  806577:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80657a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  806581:	45 85 ff             	test   %r15d,%r15d
+  806584:	78 5e                	js     8065e4 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  806586:	49 c1 e4 05          	shl    $0x5,%r12
+  80658a:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  806591:	00 00 00 
+  806594:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  806597:	48 bf 92 60 80 00 00 	movabs $0x806092,%rdi
+  80659e:	00 00 00 
+  8065a1:	48 b8 00 68 80 00 00 	movabs $0x806800,%rax
+  8065a8:	00 00 00 
+  8065ab:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8065ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8065b1:	49 89 04 24          	mov    %rax,(%r12)
+  8065b5:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8065b9:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8065be:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8065c3:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8065c8:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8065cd:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8065d2:	eb 10                	jmp    8065e4 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8065d4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8065db:	eb 07                	jmp    8065e4 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8065dd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8065e4:	48 83 c4 38          	add    $0x38,%rsp
+  8065e8:	5b                   	pop    %rbx
+  8065e9:	41 5c                	pop    %r12
+  8065eb:	41 5d                	pop    %r13
+  8065ed:	41 5e                	pop    %r14
+  8065ef:	41 5f                	pop    %r15
+  8065f1:	5d                   	pop    %rbp
+  8065f2:	c3                   	ret
+
+00000000008065f3 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8065f3:	55                   	push   %rbp
+  8065f4:	48 89 e5             	mov    %rsp,%rbp
+  8065f7:	41 57                	push   %r15
+  8065f9:	41 56                	push   %r14
+  8065fb:	41 55                	push   %r13
+  8065fd:	41 54                	push   %r12
+  8065ff:	53                   	push   %rbx
+  806600:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  806604:	49 89 fe             	mov    %rdi,%r14
+  806607:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80660e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  806615:	00 
+  806616:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80661d:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  806624:	00 00 00 
+  806627:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80662e:	49 bf 7a 62 80 00 00 	movabs $0x80627a,%r15
+  806635:	00 00 00 
+  806638:	eb 09                	jmp    806643 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80663a:	48 83 c3 20          	add    $0x20,%rbx
+  80663e:	4c 39 eb             	cmp    %r13,%rbx
+  806641:	74 33                	je     806676 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  806643:	48 89 df             	mov    %rbx,%rdi
+  806646:	48 8b 33             	mov    (%rbx),%rsi
+  806649:	4c 39 e6             	cmp    %r12,%rsi
+  80664c:	73 ec                	jae    80663a <msync+0x47>
+  80664e:	48 85 f6             	test   %rsi,%rsi
+  806651:	74 e7                	je     80663a <msync+0x47>
+  806653:	48 89 f2             	mov    %rsi,%rdx
+  806656:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80665a:	49 39 d6             	cmp    %rdx,%r14
+  80665d:	73 db                	jae    80663a <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80665f:	4c 39 e2             	cmp    %r12,%rdx
+  806662:	49 0f 47 d4          	cmova  %r12,%rdx
+  806666:	4c 39 f6             	cmp    %r14,%rsi
+  806669:	49 0f 42 f6          	cmovb  %r14,%rsi
+  80666d:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  806670:	85 c0                	test   %eax,%eax
+  806672:	79 c6                	jns    80663a <msync+0x47>
+  806674:	eb 05                	jmp    80667b <msync+0x88>
+    }
+
+    return 0;
+  806676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80667b:	48 83 c4 08          	add    $0x8,%rsp
+  80667f:	5b                   	pop    %rbx
+  806680:	41 5c                	pop    %r12
+  806682:	41 5d                	pop    %r13
+  806684:	41 5e                	pop    %r14
+  806686:	41 5f                	pop    %r15
+  806688:	5d                   	pop    %rbp
+  806689:	c3                   	ret
+
+000000000080668a <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80668a:	55                   	push   %rbp
+  80668b:	48 89 e5             	mov    %rsp,%rbp
+  80668e:	41 57                	push   %r15
+  806690:	41 56                	push   %r14
+  806692:	41 55                	push   %r13
+  806694:	41 54                	push   %r12
+  806696:	53                   	push   %rbx
+  806697:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80669b:	49 89 ff             	mov    %rdi,%r15
+  80669e:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8066a5:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8066ac:	00 
+  8066ad:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8066b4:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  8066bb:	00 00 00 
+  8066be:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8066c5:	48 89 d8             	mov    %rbx,%rax
+  8066c8:	eb 09                	jmp    8066d3 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8066ca:	48 83 c0 20          	add    $0x20,%rax
+  8066ce:	4c 39 f0             	cmp    %r14,%rax
+  8066d1:	74 40                	je     806713 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8066d3:	48 8b 10             	mov    (%rax),%rdx
+  8066d6:	4c 39 e2             	cmp    %r12,%rdx
+  8066d9:	73 ef                	jae    8066ca <munmap+0x40>
+  8066db:	48 85 d2             	test   %rdx,%rdx
+  8066de:	74 ea                	je     8066ca <munmap+0x40>
+  8066e0:	48 89 d7             	mov    %rdx,%rdi
+  8066e3:	48 03 78 08          	add    0x8(%rax),%rdi
+  8066e7:	49 39 ff             	cmp    %rdi,%r15
+  8066ea:	73 de                	jae    8066ca <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8066ec:	49 39 fc             	cmp    %rdi,%r12
+  8066ef:	72 05                	jb     8066f6 <munmap+0x6c>
+  8066f1:	4c 39 fa             	cmp    %r15,%rdx
+  8066f4:	73 d4                	jae    8066ca <munmap+0x40>
+  8066f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8066fb:	48 83 c4 08          	add    $0x8,%rsp
+  8066ff:	5b                   	pop    %rbx
+  806700:	41 5c                	pop    %r12
+  806702:	41 5d                	pop    %r13
+  806704:	41 5e                	pop    %r14
+  806706:	41 5f                	pop    %r15
+  806708:	5d                   	pop    %rbp
+  806709:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80670a:	48 83 c3 20          	add    $0x20,%rbx
+  80670e:	4c 39 f3             	cmp    %r14,%rbx
+  806711:	74 5c                	je     80676f <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  806713:	48 8b 33             	mov    (%rbx),%rsi
+  806716:	4c 39 e6             	cmp    %r12,%rsi
+  806719:	73 ef                	jae    80670a <munmap+0x80>
+  80671b:	48 85 f6             	test   %rsi,%rsi
+  80671e:	74 ea                	je     80670a <munmap+0x80>
+  806720:	48 89 f2             	mov    %rsi,%rdx
+  806723:	48 03 53 08          	add    0x8(%rbx),%rdx
+  806727:	49 39 d7             	cmp    %rdx,%r15
+  80672a:	73 de                	jae    80670a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80672c:	48 89 df             	mov    %rbx,%rdi
+  80672f:	48 b8 7a 62 80 00 00 	movabs $0x80627a,%rax
+  806736:	00 00 00 
+  806739:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80673b:	85 c0                	test   %eax,%eax
+  80673d:	78 bc                	js     8066fb <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  80673f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  806743:	48 8b 33             	mov    (%rbx),%rsi
+  806746:	bf 00 00 00 00       	mov    $0x0,%edi
+  80674b:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  806752:	00 00 00 
+  806755:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  806757:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80675a:	48 b8 9e 3f 80 00 00 	movabs $0x803f9e,%rax
+  806761:	00 00 00 
+  806764:	ff d0                	call   *%rax
+        reg->start = 0;
+  806766:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80676d:	eb 9b                	jmp    80670a <munmap+0x80>
+    return 0;
+  80676f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806774:	eb 85                	jmp    8066fb <munmap+0x71>
+
+0000000000806776 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  806776:	55                   	push   %rbp
+  806777:	48 89 e5             	mov    %rsp,%rbp
+  80677a:	41 56                	push   %r14
+  80677c:	41 55                	push   %r13
+  80677e:	41 54                	push   %r12
+  806780:	53                   	push   %rbx
+  806781:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806784:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80678b:	00 00 00 
+  80678e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  806792:	74 27                	je     8067bb <_handle_vectored_pagefault+0x45>
+  806794:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  806799:	49 bd 40 cc 80 01 00 	movabs $0x180cc40,%r13
+  8067a0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8067a3:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8067a6:	4c 89 e7             	mov    %r12,%rdi
+  8067a9:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8067ae:	84 c0                	test   %al,%al
+  8067b0:	75 45                	jne    8067f7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8067b2:	48 83 c3 01          	add    $0x1,%rbx
+  8067b6:	49 3b 1e             	cmp    (%r14),%rbx
+  8067b9:	72 eb                	jb     8067a6 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8067bb:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8067c2:	00 
+  8067c3:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8067c8:	4d 8b 04 24          	mov    (%r12),%r8
+  8067cc:	48 ba b0 7b 80 00 00 	movabs $0x807bb0,%rdx
+  8067d3:	00 00 00 
+  8067d6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8067db:	48 bf e0 7b 80 00 00 	movabs $0x807be0,%rdi
+  8067e2:	00 00 00 
+  8067e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067ea:	49 ba eb 20 80 00 00 	movabs $0x8020eb,%r10
+  8067f1:	00 00 00 
+  8067f4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8067f7:	5b                   	pop    %rbx
+  8067f8:	41 5c                	pop    %r12
+  8067fa:	41 5d                	pop    %r13
+  8067fc:	41 5e                	pop    %r14
+  8067fe:	5d                   	pop    %rbp
+  8067ff:	c3                   	ret
+
+0000000000806800 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  806800:	55                   	push   %rbp
+  806801:	48 89 e5             	mov    %rsp,%rbp
+  806804:	53                   	push   %rbx
+  806805:	48 83 ec 08          	sub    $0x8,%rsp
+  806809:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80680c:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  806811:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  806818:	00 00 00 
+  80681b:	80 38 00             	cmpb   $0x0,(%rax)
+  80681e:	74 68                	je     806888 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806820:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  806827:	00 00 00 
+  80682a:	48 8b 08             	mov    (%rax),%rcx
+  80682d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  806832:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  806839:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80683c:	48 85 c9             	test   %rcx,%rcx
+  80683f:	0f 84 e0 00 00 00    	je     806925 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  806845:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  806849:	0f 84 c9 00 00 00    	je     806918 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80684f:	48 83 c2 01          	add    $0x1,%rdx
+  806853:	48 39 ca             	cmp    %rcx,%rdx
+  806856:	75 ed                	jne    806845 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  806858:	48 83 f9 08          	cmp    $0x8,%rcx
+  80685c:	0f 84 84 00 00 00    	je     8068e6 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  806862:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  806866:	48 a3 88 cc 80 01 00 	movabs %rax,0x180cc88
+  80686d:	00 00 00 
+  806870:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  806877:	00 00 00 
+  80687a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80687e:	85 f6                	test   %esi,%esi
+  806880:	0f 89 97 00 00 00    	jns    80691d <add_pgfault_handler+0x11d>
+  806886:	eb 63                	jmp    8068eb <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  806888:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80688d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  806892:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  806899:	00 00 00 
+  80689c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068a1:	48 b8 21 34 80 00 00 	movabs $0x803421,%rax
+  8068a8:	00 00 00 
+  8068ab:	ff d0                	call   *%rax
+  8068ad:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8068af:	85 c0                	test   %eax,%eax
+  8068b1:	78 38                	js     8068eb <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8068b3:	48 be 01 6a 80 00 00 	movabs $0x806a01,%rsi
+  8068ba:	00 00 00 
+  8068bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8068c2:	48 b8 44 36 80 00 00 	movabs $0x803644,%rax
+  8068c9:	00 00 00 
+  8068cc:	ff d0                	call   *%rax
+  8068ce:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8068d0:	85 c0                	test   %eax,%eax
+  8068d2:	78 17                	js     8068eb <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8068d4:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  8068db:	00 00 00 
+  8068de:	c6 00 01             	movb   $0x1,(%rax)
+  8068e1:	e9 3a ff ff ff       	jmp    806820 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8068e6:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8068eb:	89 f1                	mov    %esi,%ecx
+  8068ed:	48 ba ee 7b 80 00 00 	movabs $0x807bee,%rdx
+  8068f4:	00 00 00 
+  8068f7:	be 42 00 00 00       	mov    $0x42,%esi
+  8068fc:	48 bf e0 7b 80 00 00 	movabs $0x807be0,%rdi
+  806903:	00 00 00 
+  806906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80690b:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  806912:	00 00 00 
+  806915:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  806918:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80691d:	89 f0                	mov    %esi,%eax
+  80691f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806923:	c9                   	leave
+  806924:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  806925:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80692c:	00 00 00 
+  80692f:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  806936:	48 89 d8             	mov    %rbx,%rax
+  806939:	48 a3 40 cc 80 01 00 	movabs %rax,0x180cc40
+  806940:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806943:	eb d8                	jmp    80691d <add_pgfault_handler+0x11d>
+
+0000000000806945 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  806945:	55                   	push   %rbp
+  806946:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  806949:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  806950:	00 00 00 
+  806953:	80 38 00             	cmpb   $0x0,(%rax)
+  806956:	74 33                	je     80698b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806958:	48 a1 88 cc 80 01 00 	movabs 0x180cc88,%rax
+  80695f:	00 00 00 
+  806962:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  806967:	48 ba 40 cc 80 01 00 	movabs $0x180cc40,%rdx
+  80696e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806971:	48 85 c0             	test   %rax,%rax
+  806974:	0f 84 85 00 00 00    	je     8069ff <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80697a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80697e:	74 40                	je     8069c0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806980:	48 83 c1 01          	add    $0x1,%rcx
+  806984:	48 39 c1             	cmp    %rax,%rcx
+  806987:	75 f1                	jne    80697a <remove_pgfault_handler+0x35>
+  806989:	eb 74                	jmp    8069ff <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80698b:	48 b9 06 7c 80 00 00 	movabs $0x807c06,%rcx
+  806992:	00 00 00 
+  806995:	48 ba fb 72 80 00 00 	movabs $0x8072fb,%rdx
+  80699c:	00 00 00 
+  80699f:	be 48 00 00 00       	mov    $0x48,%esi
+  8069a4:	48 bf e0 7b 80 00 00 	movabs $0x807be0,%rdi
+  8069ab:	00 00 00 
+  8069ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069b3:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  8069ba:	00 00 00 
+  8069bd:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8069c0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8069c7:	00 
+  8069c8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8069cc:	48 29 ca             	sub    %rcx,%rdx
+  8069cf:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  8069d6:	00 00 00 
+  8069d9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8069dd:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8069e2:	48 89 ce             	mov    %rcx,%rsi
+  8069e5:	48 b8 c2 2e 80 00 00 	movabs $0x802ec2,%rax
+  8069ec:	00 00 00 
+  8069ef:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8069f1:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  8069f8:	00 00 00 
+  8069fb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8069ff:	5d                   	pop    %rbp
+  806a00:	c3                   	ret
+
+0000000000806a01 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  806a01:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  806a04:	48 b8 76 67 80 00 00 	movabs $0x806776,%rax
+  806a0b:	00 00 00 
+    call *%rax
+  806a0e:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  806a10:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  806a17:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  806a18:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  806a1f:	00 
+    subq $8, %rcx
+  806a20:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  806a24:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  806a27:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  806a2e:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  806a2f:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  806a33:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806a37:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806a3c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806a41:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806a46:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806a4b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806a50:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806a55:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806a5a:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806a5f:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806a64:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806a69:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806a6e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806a73:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806a78:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806a7d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  806a81:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  806a85:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  806a86:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  806a87:	c3                   	ret
+
+0000000000806a88 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  806a88:	85 ff                	test   %edi,%edi
+  806a8a:	78 58                	js     806ae4 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  806a8c:	48 85 f6             	test   %rsi,%rsi
+  806a8f:	74 12                	je     806aa3 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  806a91:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  806a98:	00 00 00 
+  806a9b:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  806aa1:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  806aa3:	48 85 c9             	test   %rcx,%rcx
+  806aa6:	74 12                	je     806aba <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  806aa8:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  806aaf:	00 00 00 
+  806ab2:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  806ab8:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  806aba:	48 85 d2             	test   %rdx,%rdx
+  806abd:	74 14                	je     806ad3 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  806abf:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  806ac6:	00 00 00 
+  806ac9:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  806ad0:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  806ad3:	48 a1 38 90 80 01 00 	movabs 0x1809038,%rax
+  806ada:	00 00 00 
+  806add:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  806ae3:	c3                   	ret
+        if (from_env_store) {
+  806ae4:	48 85 f6             	test   %rsi,%rsi
+  806ae7:	74 06                	je     806aef <ipc_result+0x67>
+            *from_env_store = 0;
+  806ae9:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  806aef:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  806af1:	48 85 c9             	test   %rcx,%rcx
+  806af4:	74 ed                	je     806ae3 <ipc_result+0x5b>
+            *perm_store = 0;
+  806af6:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  806afc:	c3                   	ret
+
+0000000000806afd <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  806afd:	55                   	push   %rbp
+  806afe:	48 89 e5             	mov    %rsp,%rbp
+  806b01:	41 55                	push   %r13
+  806b03:	41 54                	push   %r12
+  806b05:	53                   	push   %rbx
+  806b06:	48 83 ec 08          	sub    $0x8,%rsp
+  806b0a:	49 89 fc             	mov    %rdi,%r12
+  806b0d:	48 89 f7             	mov    %rsi,%rdi
+  806b10:	48 89 d3             	mov    %rdx,%rbx
+  806b13:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806b16:	48 85 f6             	test   %rsi,%rsi
+  806b19:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806b20:	00 00 00 
+  806b23:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  806b27:	be 00 00 00 00       	mov    $0x0,%esi
+  806b2c:	48 85 d2             	test   %rdx,%rdx
+  806b2f:	74 03                	je     806b34 <ipc_recv+0x37>
+  806b31:	48 8b 32             	mov    (%rdx),%rsi
+  806b34:	48 b8 6d 39 80 00 00 	movabs $0x80396d,%rax
+  806b3b:	00 00 00 
+  806b3e:	ff d0                	call   *%rax
+  806b40:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  806b42:	4c 89 e9             	mov    %r13,%rcx
+  806b45:	48 89 da             	mov    %rbx,%rdx
+  806b48:	4c 89 e6             	mov    %r12,%rsi
+  806b4b:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  806b52:	00 00 00 
+  806b55:	ff d0                	call   *%rax
+}
+  806b57:	48 83 c4 08          	add    $0x8,%rsp
+  806b5b:	5b                   	pop    %rbx
+  806b5c:	41 5c                	pop    %r12
+  806b5e:	41 5d                	pop    %r13
+  806b60:	5d                   	pop    %rbp
+  806b61:	c3                   	ret
+
+0000000000806b62 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  806b62:	55                   	push   %rbp
+  806b63:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806b66:	48 85 d2             	test   %rdx,%rdx
+  806b69:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806b70:	00 00 00 
+  806b73:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  806b77:	89 f6                	mov    %esi,%esi
+  806b79:	48 b8 f9 37 80 00 00 	movabs $0x8037f9,%rax
+  806b80:	00 00 00 
+  806b83:	ff d0                	call   *%rax
+    if (res < 0) {
+  806b85:	85 c0                	test   %eax,%eax
+  806b87:	78 02                	js     806b8b <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  806b89:	5d                   	pop    %rbp
+  806b8a:	c3                   	ret
+        panic("ipc_send: %i", res);
+  806b8b:	89 c1                	mov    %eax,%ecx
+  806b8d:	48 ba 20 7c 80 00 00 	movabs $0x807c20,%rdx
+  806b94:	00 00 00 
+  806b97:	be 4f 00 00 00       	mov    $0x4f,%esi
+  806b9c:	48 bf 2d 7c 80 00 00 	movabs $0x807c2d,%rdi
+  806ba3:	00 00 00 
+  806ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bab:	49 b8 eb 20 80 00 00 	movabs $0x8020eb,%r8
+  806bb2:	00 00 00 
+  806bb5:	41 ff d0             	call   *%r8
+
+0000000000806bb8 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  806bb8:	55                   	push   %rbp
+  806bb9:	48 89 e5             	mov    %rsp,%rbp
+  806bbc:	53                   	push   %rbx
+  806bbd:	48 83 ec 08          	sub    $0x8,%rsp
+  806bc1:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806bc5:	48 85 d2             	test   %rdx,%rdx
+  806bc8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806bcf:	00 00 00 
+  806bd2:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806bd6:	4d 85 c9             	test   %r9,%r9
+  806bd9:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  806bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  806be2:	48 85 db             	test   %rbx,%rbx
+  806be5:	74 03                	je     806bea <ipc_call+0x32>
+  806be7:	48 8b 03             	mov    (%rbx),%rax
+  806bea:	89 f6                	mov    %esi,%esi
+  806bec:	48 83 ec 08          	sub    $0x8,%rsp
+  806bf0:	50                   	push   %rax
+  806bf1:	48 b8 2b 38 80 00 00 	movabs $0x80382b,%rax
+  806bf8:	00 00 00 
+  806bfb:	ff d0                	call   *%rax
+  806bfd:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  806bff:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806c03:	48 89 da             	mov    %rbx,%rdx
+  806c06:	be 00 00 00 00       	mov    $0x0,%esi
+  806c0b:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  806c12:	00 00 00 
+  806c15:	ff d0                	call   *%rax
+}
+  806c17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806c1b:	c9                   	leave
+  806c1c:	c3                   	ret
+
+0000000000806c1d <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  806c1d:	55                   	push   %rbp
+  806c1e:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  806c21:	89 f6                	mov    %esi,%esi
+  806c23:	48 b8 97 38 80 00 00 	movabs $0x803897,%rax
+  806c2a:	00 00 00 
+  806c2d:	ff d0                	call   *%rax
+  806c2f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  806c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  806c3b:	be 00 00 00 00       	mov    $0x0,%esi
+  806c40:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  806c47:	00 00 00 
+  806c4a:	ff d0                	call   *%rax
+}
+  806c4c:	5d                   	pop    %rbp
+  806c4d:	c3                   	ret
+
+0000000000806c4e <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  806c4e:	55                   	push   %rbp
+  806c4f:	48 89 e5             	mov    %rsp,%rbp
+  806c52:	41 54                	push   %r12
+  806c54:	53                   	push   %rbx
+  806c55:	4c 89 cb             	mov    %r9,%rbx
+  806c58:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  806c5c:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806c60:	48 85 d2             	test   %rdx,%rdx
+  806c63:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806c6a:	00 00 00 
+  806c6d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806c71:	4d 85 c9             	test   %r9,%r9
+  806c74:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  806c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c7d:	4d 85 e4             	test   %r12,%r12
+  806c80:	74 04                	je     806c86 <ipc_reply_wait+0x38>
+  806c82:	49 8b 04 24          	mov    (%r12),%rax
+  806c86:	89 f6                	mov    %esi,%esi
+  806c88:	48 83 ec 08          	sub    $0x8,%rsp
+  806c8c:	50                   	push   %rax
+  806c8d:	48 b8 01 39 80 00 00 	movabs $0x803901,%rax
+  806c94:	00 00 00 
+  806c97:	ff d0                	call   *%rax
+  806c99:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  806c9b:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  806c9f:	4c 89 e2             	mov    %r12,%rdx
+  806ca2:	48 89 de             	mov    %rbx,%rsi
+  806ca5:	48 b8 88 6a 80 00 00 	movabs $0x806a88,%rax
+  806cac:	00 00 00 
+  806caf:	ff d0                	call   *%rax
+}
+  806cb1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806cb5:	5b                   	pop    %rbx
+  806cb6:	41 5c                	pop    %r12
+  806cb8:	5d                   	pop    %rbp
+  806cb9:	c3                   	ret
+
+0000000000806cba <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  806cba:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  806cbf:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  806cc6:	00 00 00 
+  806cc9:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  806cd0:	48 01 ca             	add    %rcx,%rdx
+  806cd3:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  806cd9:	39 fa                	cmp    %edi,%edx
+  806cdb:	74 12                	je     806cef <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  806cdd:	48 83 c0 01          	add    $0x1,%rax
+  806ce1:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  806ce7:	75 e0                	jne    806cc9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  806ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806cee:	c3                   	ret
+            return envs[i].env_id;
+  806cef:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806cf6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  806cfd:	00 00 00 
+  806d00:	48 01 d0             	add    %rdx,%rax
+  806d03:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806d09:	c3                   	ret
+  806d0a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000806d10 <__rodata_start>:
+  806d10:	77 00                	ja     806d12 <__rodata_start+0x2>
+  806d12:	72 62                	jb     806d76 <__rodata_start+0x66>
+  806d14:	00 77 62             	add    %dh,0x62(%rdi)
+  806d17:	00 0f                	add    %cl,(%rdi)
+  806d19:	1f                   	(bad)
+  806d1a:	84 00                	test   %al,(%rax)
+  806d1c:	00 00                	add    %al,(%rax)
+  806d1e:	00 00                	add    %al,(%rax)
+  806d20:	b3 09                	mov    $0x9,%bl
+  806d22:	80 00 00             	addb   $0x0,(%rax)
+  806d25:	00 00                	add    %al,(%rax)
+  806d27:	00 ed                	add    %ch,%ch
+  806d29:	0d 80 00 00 00       	or     $0x80,%eax
+  806d2e:	00 00                	add    %al,(%rax)
+  806d30:	ed                   	in     (%dx),%eax
+  806d31:	0d 80 00 00 00       	or     $0x80,%eax
+  806d36:	00 00                	add    %al,(%rax)
+  806d38:	ed                   	in     (%dx),%eax
+  806d39:	0d 80 00 00 00       	or     $0x80,%eax
+  806d3e:	00 00                	add    %al,(%rax)
+  806d40:	ed                   	in     (%dx),%eax
+  806d41:	0d 80 00 00 00       	or     $0x80,%eax
+  806d46:	00 00                	add    %al,(%rax)
+  806d48:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  806d4d:	00 00                	add    %al,(%rax)
+  806d4f:	00 ed                	add    %ch,%ch
+  806d51:	0d 80 00 00 00       	or     $0x80,%eax
+  806d56:	00 00                	add    %al,(%rax)
+  806d58:	ed                   	in     (%dx),%eax
+  806d59:	0d 80 00 00 00       	or     $0x80,%eax
+  806d5e:	00 00                	add    %al,(%rax)
+  806d60:	ed                   	in     (%dx),%eax
+  806d61:	0d 80 00 00 00       	or     $0x80,%eax
+  806d66:	00 00                	add    %al,(%rax)
+  806d68:	ed                   	in     (%dx),%eax
+  806d69:	0d 80 00 00 00       	or     $0x80,%eax
+  806d6e:	00 00                	add    %al,(%rax)
+  806d70:	ed                   	in     (%dx),%eax
+  806d71:	0d 80 00 00 00       	or     $0x80,%eax
+  806d76:	00 00                	add    %al,(%rax)
+  806d78:	8c 0a                	mov    %cs,(%rdx)
+  806d7a:	80 00 00             	addb   $0x0,(%rax)
+  806d7d:	00 00                	add    %al,(%rax)
+  806d7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806d86:	00 00                	add    %al,(%rax)
+  806d88:	8c 0a                	mov    %cs,(%rdx)
+  806d8a:	80 00 00             	addb   $0x0,(%rax)
+  806d8d:	00 00                	add    %al,(%rax)
+  806d8f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806d96:	00 00                	add    %al,(%rax)
+  806d98:	8c 0a                	mov    %cs,(%rdx)
+  806d9a:	80 00 00             	addb   $0x0,(%rax)
+  806d9d:	00 00                	add    %al,(%rax)
+  806d9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806da6:	00 00                	add    %al,(%rax)
+  806da8:	8c 0a                	mov    %cs,(%rdx)
+  806daa:	80 00 00             	addb   $0x0,(%rax)
+  806dad:	00 00                	add    %al,(%rax)
+  806daf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806db6:	00 00                	add    %al,(%rax)
+  806db8:	8c 0a                	mov    %cs,(%rdx)
+  806dba:	80 00 00             	addb   $0x0,(%rax)
+  806dbd:	00 00                	add    %al,(%rax)
+  806dbf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806dc6:	00 00                	add    %al,(%rax)
+  806dc8:	ed                   	in     (%dx),%eax
+  806dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  806dce:	00 00                	add    %al,(%rax)
+  806dd0:	ed                   	in     (%dx),%eax
+  806dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  806dd6:	00 00                	add    %al,(%rax)
+  806dd8:	ed                   	in     (%dx),%eax
+  806dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  806dde:	00 00                	add    %al,(%rax)
+  806de0:	ed                   	in     (%dx),%eax
+  806de1:	0d 80 00 00 00       	or     $0x80,%eax
+  806de6:	00 00                	add    %al,(%rax)
+  806de8:	ed                   	in     (%dx),%eax
+  806de9:	0d 80 00 00 00       	or     $0x80,%eax
+  806dee:	00 00                	add    %al,(%rax)
+  806df0:	ed                   	in     (%dx),%eax
+  806df1:	0d 80 00 00 00       	or     $0x80,%eax
+  806df6:	00 00                	add    %al,(%rax)
+  806df8:	ed                   	in     (%dx),%eax
+  806df9:	0d 80 00 00 00       	or     $0x80,%eax
+  806dfe:	00 00                	add    %al,(%rax)
+  806e00:	ed                   	in     (%dx),%eax
+  806e01:	0d 80 00 00 00       	or     $0x80,%eax
+  806e06:	00 00                	add    %al,(%rax)
+  806e08:	ed                   	in     (%dx),%eax
+  806e09:	0d 80 00 00 00       	or     $0x80,%eax
+  806e0e:	00 00                	add    %al,(%rax)
+  806e10:	ed                   	in     (%dx),%eax
+  806e11:	0d 80 00 00 00       	or     $0x80,%eax
+  806e16:	00 00                	add    %al,(%rax)
+  806e18:	ed                   	in     (%dx),%eax
+  806e19:	0d 80 00 00 00       	or     $0x80,%eax
+  806e1e:	00 00                	add    %al,(%rax)
+  806e20:	ed                   	in     (%dx),%eax
+  806e21:	0d 80 00 00 00       	or     $0x80,%eax
+  806e26:	00 00                	add    %al,(%rax)
+  806e28:	ed                   	in     (%dx),%eax
+  806e29:	0d 80 00 00 00       	or     $0x80,%eax
+  806e2e:	00 00                	add    %al,(%rax)
+  806e30:	ed                   	in     (%dx),%eax
+  806e31:	0d 80 00 00 00       	or     $0x80,%eax
+  806e36:	00 00                	add    %al,(%rax)
+  806e38:	ed                   	in     (%dx),%eax
+  806e39:	0d 80 00 00 00       	or     $0x80,%eax
+  806e3e:	00 00                	add    %al,(%rax)
+  806e40:	ed                   	in     (%dx),%eax
+  806e41:	0d 80 00 00 00       	or     $0x80,%eax
+  806e46:	00 00                	add    %al,(%rax)
+  806e48:	ed                   	in     (%dx),%eax
+  806e49:	0d 80 00 00 00       	or     $0x80,%eax
+  806e4e:	00 00                	add    %al,(%rax)
+  806e50:	ed                   	in     (%dx),%eax
+  806e51:	0d 80 00 00 00       	or     $0x80,%eax
+  806e56:	00 00                	add    %al,(%rax)
+  806e58:	ed                   	in     (%dx),%eax
+  806e59:	0d 80 00 00 00       	or     $0x80,%eax
+  806e5e:	00 00                	add    %al,(%rax)
+  806e60:	ed                   	in     (%dx),%eax
+  806e61:	0d 80 00 00 00       	or     $0x80,%eax
+  806e66:	00 00                	add    %al,(%rax)
+  806e68:	ed                   	in     (%dx),%eax
+  806e69:	0d 80 00 00 00       	or     $0x80,%eax
+  806e6e:	00 00                	add    %al,(%rax)
+  806e70:	ed                   	in     (%dx),%eax
+  806e71:	0d 80 00 00 00       	or     $0x80,%eax
+  806e76:	00 00                	add    %al,(%rax)
+  806e78:	ed                   	in     (%dx),%eax
+  806e79:	0d 80 00 00 00       	or     $0x80,%eax
+  806e7e:	00 00                	add    %al,(%rax)
+  806e80:	ed                   	in     (%dx),%eax
+  806e81:	0d 80 00 00 00       	or     $0x80,%eax
+  806e86:	00 00                	add    %al,(%rax)
+  806e88:	ed                   	in     (%dx),%eax
+  806e89:	0d 80 00 00 00       	or     $0x80,%eax
+  806e8e:	00 00                	add    %al,(%rax)
+  806e90:	ed                   	in     (%dx),%eax
+  806e91:	0d 80 00 00 00       	or     $0x80,%eax
+  806e96:	00 00                	add    %al,(%rax)
+  806e98:	ed                   	in     (%dx),%eax
+  806e99:	0d 80 00 00 00       	or     $0x80,%eax
+  806e9e:	00 00                	add    %al,(%rax)
+  806ea0:	ed                   	in     (%dx),%eax
+  806ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  806ea6:	00 00                	add    %al,(%rax)
+  806ea8:	ed                   	in     (%dx),%eax
+  806ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  806eae:	00 00                	add    %al,(%rax)
+  806eb0:	ed                   	in     (%dx),%eax
+  806eb1:	0d 80 00 00 00       	or     $0x80,%eax
+  806eb6:	00 00                	add    %al,(%rax)
+  806eb8:	f4                   	hlt
+  806eb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  806ebf:	00 ed                	add    %ch,%ch
+  806ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  806ec6:	00 00                	add    %al,(%rax)
+  806ec8:	ed                   	in     (%dx),%eax
+  806ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  806ece:	00 00                	add    %al,(%rax)
+  806ed0:	2c 0b                	sub    $0xb,%al
+  806ed2:	80 00 00             	addb   $0x0,(%rax)
+  806ed5:	00 00                	add    %al,(%rax)
+  806ed7:	00 ed                	add    %ch,%ch
+  806ed9:	0d 80 00 00 00       	or     $0x80,%eax
+  806ede:	00 00                	add    %al,(%rax)
+  806ee0:	ed                   	in     (%dx),%eax
+  806ee1:	0d 80 00 00 00       	or     $0x80,%eax
+  806ee6:	00 00                	add    %al,(%rax)
+  806ee8:	ed                   	in     (%dx),%eax
+  806ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  806eee:	00 00                	add    %al,(%rax)
+  806ef0:	ed                   	in     (%dx),%eax
+  806ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  806ef6:	00 00                	add    %al,(%rax)
+  806ef8:	ed                   	in     (%dx),%eax
+  806ef9:	0d 80 00 00 00       	or     $0x80,%eax
+  806efe:	00 00                	add    %al,(%rax)
+  806f00:	ed                   	in     (%dx),%eax
+  806f01:	0d 80 00 00 00       	or     $0x80,%eax
+  806f06:	00 00                	add    %al,(%rax)
+  806f08:	ed                   	in     (%dx),%eax
+  806f09:	0d 80 00 00 00       	or     $0x80,%eax
+  806f0e:	00 00                	add    %al,(%rax)
+  806f10:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806f13:	00 00                	add    %al,(%rax)
+  806f15:	00 00                	add    %al,(%rax)
+  806f17:	00 cb                	add    %cl,%bl
+  806f19:	0d 80 00 00 00       	or     $0x80,%eax
+  806f1e:	00 00                	add    %al,(%rax)
+  806f20:	ed                   	in     (%dx),%eax
+  806f21:	0d 80 00 00 00       	or     $0x80,%eax
+  806f26:	00 00                	add    %al,(%rax)
+  806f28:	ed                   	in     (%dx),%eax
+  806f29:	0d 80 00 00 00       	or     $0x80,%eax
+  806f2e:	00 00                	add    %al,(%rax)
+  806f30:	ed                   	in     (%dx),%eax
+  806f31:	0d 80 00 00 00       	or     $0x80,%eax
+  806f36:	00 00                	add    %al,(%rax)
+  806f38:	6a 0a                	push   $0xa
+  806f3a:	80 00 00             	addb   $0x0,(%rax)
+  806f3d:	00 00                	add    %al,(%rax)
+  806f3f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806f45:	00 00                	add    %al,(%rax)
+  806f47:	00 ed                	add    %ch,%ch
+  806f49:	0d 80 00 00 00       	or     $0x80,%eax
+  806f4e:	00 00                	add    %al,(%rax)
+  806f50:	ed                   	in     (%dx),%eax
+  806f51:	0d 80 00 00 00       	or     $0x80,%eax
+  806f56:	00 00                	add    %al,(%rax)
+  806f58:	3c 0a                	cmp    $0xa,%al
+  806f5a:	80 00 00             	addb   $0x0,(%rax)
+  806f5d:	00 00                	add    %al,(%rax)
+  806f5f:	00 ed                	add    %ch,%ch
+  806f61:	0d 80 00 00 00       	or     $0x80,%eax
+  806f66:	00 00                	add    %al,(%rax)
+  806f68:	4f 0c 80             	rex.WRXB or $0x80,%al
+  806f6b:	00 00                	add    %al,(%rax)
+  806f6d:	00 00                	add    %al,(%rax)
+  806f6f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806f75:	00 00                	add    %al,(%rax)
+  806f77:	00 29                	add    %ch,(%rcx)
+  806f79:	0c 80                	or     $0x80,%al
+  806f7b:	00 00                	add    %al,(%rax)
+  806f7d:	00 00                	add    %al,(%rax)
+  806f7f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  806f82:	80 00 00             	addb   $0x0,(%rax)
+  806f85:	00 00                	add    %al,(%rax)
+  806f87:	00 ed                	add    %ch,%ch
+  806f89:	0d 80 00 00 00       	or     $0x80,%eax
+  806f8e:	00 00                	add    %al,(%rax)
+  806f90:	1a 0b                	sbb    (%rbx),%cl
+  806f92:	80 00 00             	addb   $0x0,(%rax)
+  806f95:	00 00                	add    %al,(%rax)
+  806f97:	00 ed                	add    %ch,%ch
+  806f99:	0d 80 00 00 00       	or     $0x80,%eax
+  806f9e:	00 00                	add    %al,(%rax)
+  806fa0:	ce                   	(bad)
+  806fa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  806fa7:	00 ed                	add    %ch,%ch
+  806fa9:	0d 80 00 00 00       	or     $0x80,%eax
+  806fae:	00 00                	add    %al,(%rax)
+  806fb0:	ed                   	in     (%dx),%eax
+  806fb1:	0d 80 00 00 00       	or     $0x80,%eax
+  806fb6:	00 00                	add    %al,(%rax)
+  806fb8:	f4                   	hlt
+  806fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  806fbf:	00 37                	add    %dh,(%rdi)
+  806fc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806fca:	80 00 00             	addb   $0x0,(%rax)
+  806fcd:	00 00                	add    %al,(%rax)
+  806fcf:	00 37                	add    %dh,(%rdi)
+  806fd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806fda:	80 00 00             	addb   $0x0,(%rax)
+  806fdd:	00 00                	add    %al,(%rax)
+  806fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806fe2:	80 00 00             	addb   $0x0,(%rax)
+  806fe5:	00 00                	add    %al,(%rax)
+  806fe7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  806feb:	00 00                	add    %al,(%rax)
+  806fed:	00 00                	add    %al,(%rax)
+  806fef:	00 d2                	add    %dl,%dl
+  806ff1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806ff7:	00 d2                	add    %dl,%dl
+  806ff9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806fff:	00 d2                	add    %dl,%dl
+  807001:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  807007:	00 d2                	add    %dl,%dl
+  807009:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80700f:	00 d2                	add    %dl,%dl
+  807011:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  807017:	00 d2                	add    %dl,%dl
+  807019:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80701f:	00 d2                	add    %dl,%dl
+  807021:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  807027:	00 f6                	add    %dh,%dh
+  807029:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80702f:	00 f6                	add    %dh,%dh
+  807031:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  807037:	00 5f 12             	add    %bl,0x12(%rdi)
+  80703a:	80 00 00             	addb   $0x0,(%rax)
+  80703d:	00 00                	add    %al,(%rax)
+  80703f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807042:	80 00 00             	addb   $0x0,(%rax)
+  807045:	00 00                	add    %al,(%rax)
+  807047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80704a:	80 00 00             	addb   $0x0,(%rax)
+  80704d:	00 00                	add    %al,(%rax)
+  80704f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807052:	80 00 00             	addb   $0x0,(%rax)
+  807055:	00 00                	add    %al,(%rax)
+  807057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80705a:	80 00 00             	addb   $0x0,(%rax)
+  80705d:	00 00                	add    %al,(%rax)
+  80705f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807062:	80 00 00             	addb   $0x0,(%rax)
+  807065:	00 00                	add    %al,(%rax)
+  807067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80706a:	80 00 00             	addb   $0x0,(%rax)
+  80706d:	00 00                	add    %al,(%rax)
+  80706f:	00 22                	add    %ah,(%rdx)
+  807071:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807077:	00 22                	add    %ah,(%rdx)
+  807079:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80707f:	00 22                	add    %ah,(%rdx)
+  807081:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807087:	00 22                	add    %ah,(%rdx)
+  807089:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80708f:	00 22                	add    %ah,(%rdx)
+  807091:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807097:	00 22                	add    %ah,(%rdx)
+  807099:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80709f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070a2:	80 00 00             	addb   $0x0,(%rax)
+  8070a5:	00 00                	add    %al,(%rax)
+  8070a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070aa:	80 00 00             	addb   $0x0,(%rax)
+  8070ad:	00 00                	add    %al,(%rax)
+  8070af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070b2:	80 00 00             	addb   $0x0,(%rax)
+  8070b5:	00 00                	add    %al,(%rax)
+  8070b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070ba:	80 00 00             	addb   $0x0,(%rax)
+  8070bd:	00 00                	add    %al,(%rax)
+  8070bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070c2:	80 00 00             	addb   $0x0,(%rax)
+  8070c5:	00 00                	add    %al,(%rax)
+  8070c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070ca:	80 00 00             	addb   $0x0,(%rax)
+  8070cd:	00 00                	add    %al,(%rax)
+  8070cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070d2:	80 00 00             	addb   $0x0,(%rax)
+  8070d5:	00 00                	add    %al,(%rax)
+  8070d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070da:	80 00 00             	addb   $0x0,(%rax)
+  8070dd:	00 00                	add    %al,(%rax)
+  8070df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070e2:	80 00 00             	addb   $0x0,(%rax)
+  8070e5:	00 00                	add    %al,(%rax)
+  8070e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070ea:	80 00 00             	addb   $0x0,(%rax)
+  8070ed:	00 00                	add    %al,(%rax)
+  8070ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070f2:	80 00 00             	addb   $0x0,(%rax)
+  8070f5:	00 00                	add    %al,(%rax)
+  8070f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8070fa:	80 00 00             	addb   $0x0,(%rax)
+  8070fd:	00 00                	add    %al,(%rax)
+  8070ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  807102:	80 00 00             	addb   $0x0,(%rax)
+  807105:	00 00                	add    %al,(%rax)
+  807107:	00 5f 12             	add    %bl,0x12(%rdi)
+  80710a:	80 00 00             	addb   $0x0,(%rax)
+  80710d:	00 00                	add    %al,(%rax)
+  80710f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807112:	80 00 00             	addb   $0x0,(%rax)
+  807115:	00 00                	add    %al,(%rax)
+  807117:	00 5f 12             	add    %bl,0x12(%rdi)
+  80711a:	80 00 00             	addb   $0x0,(%rax)
+  80711d:	00 00                	add    %al,(%rax)
+  80711f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807122:	80 00 00             	addb   $0x0,(%rax)
+  807125:	00 00                	add    %al,(%rax)
+  807127:	00 46 12             	add    %al,0x12(%rsi)
+  80712a:	80 00 00             	addb   $0x0,(%rax)
+  80712d:	00 00                	add    %al,(%rax)
+  80712f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807132:	80 00 00             	addb   $0x0,(%rax)
+  807135:	00 00                	add    %al,(%rax)
+  807137:	00 5f 12             	add    %bl,0x12(%rdi)
+  80713a:	80 00 00             	addb   $0x0,(%rax)
+  80713d:	00 00                	add    %al,(%rax)
+  80713f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807142:	80 00 00             	addb   $0x0,(%rax)
+  807145:	00 00                	add    %al,(%rax)
+  807147:	00 5f 12             	add    %bl,0x12(%rdi)
+  80714a:	80 00 00             	addb   $0x0,(%rax)
+  80714d:	00 00                	add    %al,(%rax)
+  80714f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807152:	80 00 00             	addb   $0x0,(%rax)
+  807155:	00 00                	add    %al,(%rax)
+  807157:	00 5f 12             	add    %bl,0x12(%rdi)
+  80715a:	80 00 00             	addb   $0x0,(%rax)
+  80715d:	00 00                	add    %al,(%rax)
+  80715f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807162:	80 00 00             	addb   $0x0,(%rax)
+  807165:	00 00                	add    %al,(%rax)
+  807167:	00 5f 12             	add    %bl,0x12(%rdi)
+  80716a:	80 00 00             	addb   $0x0,(%rax)
+  80716d:	00 00                	add    %al,(%rax)
+  80716f:	00 22                	add    %ah,(%rdx)
+  807171:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807177:	00 22                	add    %ah,(%rdx)
+  807179:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80717f:	00 22                	add    %ah,(%rdx)
+  807181:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807187:	00 22                	add    %ah,(%rdx)
+  807189:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80718f:	00 22                	add    %ah,(%rdx)
+  807191:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  807197:	00 22                	add    %ah,(%rdx)
+  807199:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80719f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071a2:	80 00 00             	addb   $0x0,(%rax)
+  8071a5:	00 00                	add    %al,(%rax)
+  8071a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071aa:	80 00 00             	addb   $0x0,(%rax)
+  8071ad:	00 00                	add    %al,(%rax)
+  8071af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071b2:	80 00 00             	addb   $0x0,(%rax)
+  8071b5:	00 00                	add    %al,(%rax)
+  8071b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071ba:	80 00 00             	addb   $0x0,(%rax)
+  8071bd:	00 00                	add    %al,(%rax)
+  8071bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071c2:	80 00 00             	addb   $0x0,(%rax)
+  8071c5:	00 00                	add    %al,(%rax)
+  8071c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071ca:	80 00 00             	addb   $0x0,(%rax)
+  8071cd:	00 00                	add    %al,(%rax)
+  8071cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071d2:	80 00 00             	addb   $0x0,(%rax)
+  8071d5:	00 00                	add    %al,(%rax)
+  8071d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071da:	80 00 00             	addb   $0x0,(%rax)
+  8071dd:	00 00                	add    %al,(%rax)
+  8071df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071e2:	80 00 00             	addb   $0x0,(%rax)
+  8071e5:	00 00                	add    %al,(%rax)
+  8071e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071ea:	80 00 00             	addb   $0x0,(%rax)
+  8071ed:	00 00                	add    %al,(%rax)
+  8071ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071f2:	80 00 00             	addb   $0x0,(%rax)
+  8071f5:	00 00                	add    %al,(%rax)
+  8071f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8071fa:	80 00 00             	addb   $0x0,(%rax)
+  8071fd:	00 00                	add    %al,(%rax)
+  8071ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  807202:	80 00 00             	addb   $0x0,(%rax)
+  807205:	00 00                	add    %al,(%rax)
+  807207:	00 5f 12             	add    %bl,0x12(%rdi)
+  80720a:	80 00 00             	addb   $0x0,(%rax)
+  80720d:	00 00                	add    %al,(%rax)
+  80720f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807212:	80 00 00             	addb   $0x0,(%rax)
+  807215:	00 00                	add    %al,(%rax)
+  807217:	00 5f 12             	add    %bl,0x12(%rdi)
+  80721a:	80 00 00             	addb   $0x0,(%rax)
+  80721d:	00 00                	add    %al,(%rax)
+  80721f:	00 5f 12             	add    %bl,0x12(%rdi)
+  807222:	80 00 00             	addb   $0x0,(%rax)
+  807225:	00 00                	add    %al,(%rax)
+  807227:	00 46 12             	add    %al,0x12(%rsi)
+  80722a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000807240 <basefix.0>:
+  807240:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  807250:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  807260:	10 00 20 09 0d 0a 00 20 09 0d 0a 3c 7c 3e 26 3b     .. .... ...<|>&;
+  807270:	28 29 00 74 6f 6f 20 6d 61 6e 79 20 61 72 67 75     ().too many argu
+  807280:	6d 65 6e 74 73 0a 00 6f 70 65 6e 20 25 73 20 66     ments..open %s f
+  807290:	6f 72 20 72 65 61 64 3a 20 25 69 00 6f 70 65 6e     or read: %i.open
+  8072a0:	20 25 73 20 66 6f 72 20 77 72 69 74 65 3a 20 25      %s for write: %
+  8072b0:	69 00 70 69 70 65 3a 20 25 69 00 62 61 64 20 72     i.pipe: %i.bad r
+  8072c0:	65 74 75 72 6e 20 25 64 20 66 72 6f 6d 20 67 65     eturn %d from ge
+  8072d0:	74 74 6f 6b 65 6e 00 75 73 65 72 2f 73 68 2e 63     ttoken.user/sh.c
+  8072e0:	00 73 70 61 77 6e 20 25 73 3a 20 25 69 0a 00 6f     .spawn %s: %i..o
+  8072f0:	70 65 6e 20 25 73 3a 20 25 69 00 61 73 73 65 72     pen %s: %i.asser
+  807300:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  807310:	24 20 00 23 20 25 73 0a 00 0f 1f 80 00 00 00 00     $ .# %s.........
+  807320:	73 79 6e 74 61 78 20 65 72 72 6f 72 3a 20 3c 20     syntax error: < 
+  807330:	6e 6f 74 20 66 6f 6c 6c 6f 77 65 64 20 62 79 20     not followed by 
+  807340:	77 6f 72 64 0a 00 00 00 73 79 6e 74 61 78 20 65     word....syntax e
+  807350:	72 72 6f 72 3a 20 3e 20 6e 6f 74 20 66 6f 6c 6c     rror: > not foll
+  807360:	6f 77 65 64 20 62 79 20 77 6f 72 64 0a 00 00 00     owed by word....
+  807370:	75 73 61 67 65 3a 20 73 68 20 5b 2d 64 69 78 5d     usage: sh [-dix]
+  807380:	20 5b 63 6f 6d 6d 61 6e 64 2d 66 69 6c 65 5d 0a      [command-file].
+  807390:	00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 3c 75 6e     .<cons>.cons.<un
+  8073a0:	6b 6e 6f 77 6e 3e 00 90 5b 25 30 38 78 5d 20 75     known>..[%08x] u
+  8073b0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8073c0:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  8073d0:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  8073e0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  8073f0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  807400:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  807410:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  807420:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  807430:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  807440:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  807450:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  807460:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  807470:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  807480:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  807490:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  8074a0:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  8074b0:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  8074c0:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  8074d0:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  8074e0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  8074f0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  807500:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  807510:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  807520:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  807530:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  807540:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  807550:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  807560:	33 24 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     3$.......*......
+  807570:	7a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     z*.......*......
+  807580:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807590:	8a 2a 80 00 00 00 00 00 52 24 80 00 00 00 00 00     .*......R$......
+  8075a0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8075b0:	46 24 80 00 00 00 00 00 c0 24 80 00 00 00 00 00     F$.......$......
+  8075c0:	8a 2a 80 00 00 00 00 00 46 24 80 00 00 00 00 00     .*......F$......
+  8075d0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  8075e0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  8075f0:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  807600:	8c 24 80 00 00 00 00 00 8c 24 80 00 00 00 00 00     .$.......$......
+  807610:	8c 24 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .$.......*......
+  807620:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807630:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807640:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807650:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807660:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807670:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807680:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807690:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076a0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076b0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076c0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076d0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076e0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8076f0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807700:	8a 2a 80 00 00 00 00 00 a8 29 80 00 00 00 00 00     .*.......)......
+  807710:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807720:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807730:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807740:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807750:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807760:	ee 24 80 00 00 00 00 00 bd 26 80 00 00 00 00 00     .$.......&......
+  807770:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  807780:	8a 2a 80 00 00 00 00 00 e3 24 80 00 00 00 00 00     .*.......$......
+  807790:	1d 25 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .%.......*......
+  8077a0:	8a 2a 80 00 00 00 00 00 d8 24 80 00 00 00 00 00     .*.......$......
+  8077b0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8077c0:	66 28 80 00 00 00 00 00 35 29 80 00 00 00 00 00     f(......5)......
+  8077d0:	8a 2a 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .*.......*......
+  8077e0:	b4 25 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .%.......*......
+  8077f0:	91 27 80 00 00 00 00 00 8a 2a 80 00 00 00 00 00     .'.......*......
+  807800:	8a 2a 80 00 00 00 00 00 a8 29 80 00 00 00 00 00     .*.......)......
+  807810:	8a 2a 80 00 00 00 00 00 3c 24 80 00 00 00 00 00     .*......<$......
+
+0000000000807820 <error_string>:
+	...
+  807828:	fd 73 80 00 00 00 00 00 0f 74 80 00 00 00 00 00     .s.......t......
+  807838:	1f 74 80 00 00 00 00 00 31 74 80 00 00 00 00 00     .t......1t......
+  807848:	3f 74 80 00 00 00 00 00 53 74 80 00 00 00 00 00     ?t......St......
+  807858:	68 74 80 00 00 00 00 00 7b 74 80 00 00 00 00 00     ht......{t......
+  807868:	8d 74 80 00 00 00 00 00 a1 74 80 00 00 00 00 00     .t.......t......
+  807878:	b1 74 80 00 00 00 00 00 c4 74 80 00 00 00 00 00     .t.......t......
+  807888:	db 74 80 00 00 00 00 00 f1 74 80 00 00 00 00 00     .t.......t......
+  807898:	09 75 80 00 00 00 00 00 21 75 80 00 00 00 00 00     .u......!u......
+  8078a8:	2e 75 80 00 00 00 00 00 c0 78 80 00 00 00 00 00     .u.......x......
+  8078b8:	42 75 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Bu......file is 
+  8078c8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8078d8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 72     utable..;!?....r
+  8078e8:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 90     ead error: %i...
+  8078f8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  807908:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  807918:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  807928:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  807938:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  807948:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  807958:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  807968:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  807978:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  807988:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  807998:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  8079a8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8079b8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8079c8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8079d8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8079e8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8079f8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  807a08:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  807a18:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  807a28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807a38:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000807a40 <devtab>:
+  807a40:	80 80 80 00 00 00 00 00 c0 80 80 00 00 00 00 00     ................
+  807a50:	40 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     @...............
+  807a60:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  807a70:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  807a80:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  807a90:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  807aa0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807ab0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807ac0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  807ad0:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  807ae0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  807af0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  807b00:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  807b10:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  807b20:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  807b30:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  807b40:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  807b50:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  807b60:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807b70:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  807b80:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  807b90:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  807ba0:	00 61 64 64 72 20 3d 3d 20 30 00 0f 1f 44 00 00     .addr == 0...D..
+  807bb0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  807bc0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  807bd0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  807be0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  807bf0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  807c00:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  807c10:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  807c20:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  807c30:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  807c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,10323 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 79 22 80 00 00 	movabs $0x802279,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 3a 32 80 00 00 	movabs $0x80323a,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 3a 32 80 00 00 	movabs $0x80323a,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 10 3c 80 00 00 	movabs $0x803c10,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 09 1f 80 00 00 	movabs $0x801f09,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 10 3c 80 00 00 	movabs $0x803c10,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 09 1f 80 00 00 	movabs $0x801f09,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 94 5c 80 00 00 	movabs $0x805c94,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 99 20 80 00 00 	movabs $0x802099,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be c8 56 80 00 00 	movabs $0x8056c8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 99 20 80 00 00 	movabs $0x802099,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be ca 56 80 00 00 	movabs $0x8056ca,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 99 20 80 00 00 	movabs $0x802099,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be cd 56 80 00 00 	movabs $0x8056cd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 99 20 80 00 00 	movabs $0x802099,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 0e 4a 80 00 00 	movabs $0x804a0e,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 e5 4c 80 00 00 	movabs $0x804ce5,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 8d 2f 80 00 00 	movabs $0x802f8d,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ed 33 80 00 00 	movabs $0x8033ed,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 f3 32 80 00 00 	movabs $0x8032f3,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 0b 31 80 00 00 	movabs $0x80310b,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 3a 32 80 00 00 	movabs $0x80323a,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 8d 2f 80 00 00 	movabs $0x802f8d,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 46 22 80 00 00 	movabs $0x802246,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 56 80 00 00 	movabs $0x8056e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 46 22 80 00 00 	movabs $0x802246,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 79 22 80 00 00 	movabs $0x802279,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 46 22 80 00 00 	movabs $0x802246,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 46 22 80 00 00 	movabs $0x802246,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 46 22 80 00 00 	movabs $0x802246,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5c 80 00 00 	movabs $0x805c00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 9e 24 80 00 00 	movabs $0x80249e,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 9e 24 80 00 00 	movabs $0x80249e,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 28 00 00 00       	call   801527 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  801505:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80150a:	48 bf 22 5c 80 00 00 	movabs $0x805c22,%rdi
+  801511:	00 00 00 
+  801514:	b8 00 00 00 00       	mov    $0x0,%eax
+  801519:	48 ba a0 16 80 00 00 	movabs $0x8016a0,%rdx
+  801520:	00 00 00 
+  801523:	ff d2                	call   *%rdx
+}
+  801525:	5d                   	pop    %rbp
+  801526:	c3                   	ret
+
+0000000000801527 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801527:	55                   	push   %rbp
+  801528:	48 89 e5             	mov    %rsp,%rbp
+  80152b:	41 56                	push   %r14
+  80152d:	41 55                	push   %r13
+  80152f:	41 54                	push   %r12
+  801531:	53                   	push   %rbx
+  801532:	41 89 fd             	mov    %edi,%r13d
+  801535:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801538:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80153f:	00 00 00 
+  801542:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801549:	00 00 00 
+  80154c:	48 39 c2             	cmp    %rax,%rdx
+  80154f:	73 17                	jae    801568 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801551:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801554:	49 89 c4             	mov    %rax,%r12
+  801557:	48 83 c3 08          	add    $0x8,%rbx
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	ff 53 f8             	call   *-0x8(%rbx)
+  801563:	4c 39 e3             	cmp    %r12,%rbx
+  801566:	72 ef                	jb     801557 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801568:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  80156f:	00 00 00 
+  801572:	ff d0                	call   *%rax
+  801574:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801579:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801580:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801587:	00 00 00 
+  80158a:	48 01 d0             	add    %rdx,%rax
+  80158d:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801594:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801597:	45 85 ed             	test   %r13d,%r13d
+  80159a:	7e 0d                	jle    8015a9 <libmain+0x82>
+  80159c:	49 8b 06             	mov    (%r14),%rax
+  80159f:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8015a6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8015a9:	4c 89 f6             	mov    %r14,%rsi
+  8015ac:	44 89 ef             	mov    %r13d,%edi
+  8015af:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015b6:	00 00 00 
+  8015b9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8015bb:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  8015c2:	00 00 00 
+  8015c5:	ff d0                	call   *%rax
+#endif
+}
+  8015c7:	5b                   	pop    %rbx
+  8015c8:	41 5c                	pop    %r12
+  8015ca:	41 5d                	pop    %r13
+  8015cc:	41 5e                	pop    %r14
+  8015ce:	5d                   	pop    %rbp
+  8015cf:	c3                   	ret
+
+00000000008015d0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8015d4:	48 b8 c0 2f 80 00 00 	movabs $0x802fc0,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8015e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e5:	48 b8 f3 25 80 00 00 	movabs $0x8025f3,%rax
+  8015ec:	00 00 00 
+  8015ef:	ff d0                	call   *%rax
+}
+  8015f1:	5d                   	pop    %rbp
+  8015f2:	c3                   	ret
+
+00000000008015f3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8015f3:	55                   	push   %rbp
+  8015f4:	48 89 e5             	mov    %rsp,%rbp
+  8015f7:	53                   	push   %rbx
+  8015f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8015fc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8015ff:	8b 06                	mov    (%rsi),%eax
+  801601:	8d 50 01             	lea    0x1(%rax),%edx
+  801604:	89 16                	mov    %edx,(%rsi)
+  801606:	48 98                	cltq
+  801608:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80160d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801613:	74 0a                	je     80161f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801615:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801619:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80161d:	c9                   	leave
+  80161e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80161f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801623:	be ff 00 00 00       	mov    $0xff,%esi
+  801628:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  80162f:	00 00 00 
+  801632:	ff d0                	call   *%rax
+        state->offset = 0;
+  801634:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80163a:	eb d9                	jmp    801615 <putch+0x22>
+
+000000000080163c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80163c:	55                   	push   %rbp
+  80163d:	48 89 e5             	mov    %rsp,%rbp
+  801640:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801647:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80164a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801651:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80165e:	48 89 f1             	mov    %rsi,%rcx
+  801661:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801668:	48 bf f3 15 80 00 00 	movabs $0x8015f3,%rdi
+  80166f:	00 00 00 
+  801672:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80167e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801685:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80168c:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  801693:	00 00 00 
+  801696:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801698:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80169e:	c9                   	leave
+  80169f:	c3                   	ret
+
+00000000008016a0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8016a0:	55                   	push   %rbp
+  8016a1:	48 89 e5             	mov    %rsp,%rbp
+  8016a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8016a8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016ac:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8016b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8016b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8016bc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8016c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8016c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8016cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8016d3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8016d7:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8016e3:	c9                   	leave
+  8016e4:	c3                   	ret
+
+00000000008016e5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+  8016e9:	41 57                	push   %r15
+  8016eb:	41 56                	push   %r14
+  8016ed:	41 55                	push   %r13
+  8016ef:	41 54                	push   %r12
+  8016f1:	53                   	push   %rbx
+  8016f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f6:	49 89 fc             	mov    %rdi,%r12
+  8016f9:	49 89 f5             	mov    %rsi,%r13
+  8016fc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801700:	8b 45 10             	mov    0x10(%rbp),%eax
+  801703:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801706:	41 89 cf             	mov    %ecx,%r15d
+  801709:	4c 39 fa             	cmp    %r15,%rdx
+  80170c:	73 5b                	jae    801769 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80170e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801712:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801716:	85 db                	test   %ebx,%ebx
+  801718:	7e 0e                	jle    801728 <print_num+0x43>
+            putch(padc, put_arg);
+  80171a:	4c 89 ee             	mov    %r13,%rsi
+  80171d:	44 89 f7             	mov    %r14d,%edi
+  801720:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801723:	83 eb 01             	sub    $0x1,%ebx
+  801726:	75 f2                	jne    80171a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801728:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80172c:	48 b9 41 5c 80 00 00 	movabs $0x805c41,%rcx
+  801733:	00 00 00 
+  801736:	48 b8 30 5c 80 00 00 	movabs $0x805c30,%rax
+  80173d:	00 00 00 
+  801740:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801744:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174d:	49 f7 f7             	div    %r15
+  801750:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801754:	4c 89 ee             	mov    %r13,%rsi
+  801757:	41 ff d4             	call   *%r12
+}
+  80175a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80175e:	5b                   	pop    %rbx
+  80175f:	41 5c                	pop    %r12
+  801761:	41 5d                	pop    %r13
+  801763:	41 5e                	pop    %r14
+  801765:	41 5f                	pop    %r15
+  801767:	5d                   	pop    %rbp
+  801768:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801769:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801772:	49 f7 f7             	div    %r15
+  801775:	48 83 ec 08          	sub    $0x8,%rsp
+  801779:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80177d:	52                   	push   %rdx
+  80177e:	45 0f be c9          	movsbl %r9b,%r9d
+  801782:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801786:	48 89 c2             	mov    %rax,%rdx
+  801789:	48 b8 e5 16 80 00 00 	movabs $0x8016e5,%rax
+  801790:	00 00 00 
+  801793:	ff d0                	call   *%rax
+  801795:	48 83 c4 10          	add    $0x10,%rsp
+  801799:	eb 8d                	jmp    801728 <print_num+0x43>
+
+000000000080179b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80179b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80179f:	48 8b 06             	mov    (%rsi),%rax
+  8017a2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8017a6:	73 0a                	jae    8017b2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8017a8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017ac:	48 89 16             	mov    %rdx,(%rsi)
+  8017af:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8017b2:	c3                   	ret
+
+00000000008017b3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8017b3:	55                   	push   %rbp
+  8017b4:	48 89 e5             	mov    %rsp,%rbp
+  8017b7:	48 83 ec 50          	sub    $0x50,%rsp
+  8017bb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017bf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017c3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8017c7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8017de:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017e2:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  8017e9:	00 00 00 
+  8017ec:	ff d0                	call   *%rax
+}
+  8017ee:	c9                   	leave
+  8017ef:	c3                   	ret
+
+00000000008017f0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8017f0:	55                   	push   %rbp
+  8017f1:	48 89 e5             	mov    %rsp,%rbp
+  8017f4:	41 57                	push   %r15
+  8017f6:	41 56                	push   %r14
+  8017f8:	41 55                	push   %r13
+  8017fa:	41 54                	push   %r12
+  8017fc:	53                   	push   %rbx
+  8017fd:	48 83 ec 38          	sub    $0x38,%rsp
+  801801:	49 89 fe             	mov    %rdi,%r14
+  801804:	49 89 f5             	mov    %rsi,%r13
+  801807:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80180a:	48 8b 01             	mov    (%rcx),%rax
+  80180d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801811:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801819:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80181d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801821:	eb 0d                	jmp    801830 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801823:	40 0f b6 ff          	movzbl %dil,%edi
+  801827:	4c 89 ee             	mov    %r13,%rsi
+  80182a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80182d:	4c 89 e3             	mov    %r12,%rbx
+  801830:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801834:	0f b6 3b             	movzbl (%rbx),%edi
+  801837:	40 80 ff 25          	cmp    $0x25,%dil
+  80183b:	74 14                	je     801851 <vprintfmt+0x61>
+            if (!ch) return;
+  80183d:	40 84 ff             	test   %dil,%dil
+  801840:	75 e1                	jne    801823 <vprintfmt+0x33>
+}
+  801842:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801846:	5b                   	pop    %rbx
+  801847:	41 5c                	pop    %r12
+  801849:	41 5d                	pop    %r13
+  80184b:	41 5e                	pop    %r14
+  80184d:	41 5f                	pop    %r15
+  80184f:	5d                   	pop    %rbp
+  801850:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801851:	be 00 00 00 00       	mov    $0x0,%esi
+  801856:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80185a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80185f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801865:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80186c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801870:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801875:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80187a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80187d:	83 e8 23             	sub    $0x23,%eax
+  801880:	3c 57                	cmp    $0x57,%al
+  801882:	0f 87 67 06 00 00    	ja     801eef <vprintfmt+0x6ff>
+  801888:	0f b6 c0             	movzbl %al,%eax
+  80188b:	48 b9 c0 5d 80 00 00 	movabs $0x805dc0,%rcx
+  801892:	00 00 00 
+  801895:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801898:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80189b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80189f:	eb cf                	jmp    801870 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8018a1:	49 89 dc             	mov    %rbx,%r12
+  8018a4:	be 01 00 00 00       	mov    $0x1,%esi
+  8018a9:	eb c5                	jmp    801870 <vprintfmt+0x80>
+            padc = ch;
+  8018ab:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8018af:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8018b2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8018b5:	eb b9                	jmp    801870 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8018ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8018bd:	77 24                	ja     8018e3 <vprintfmt+0xf3>
+  8018bf:	89 c1                	mov    %eax,%ecx
+  8018c1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8018c5:	83 c0 08             	add    $0x8,%eax
+  8018c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8018cb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8018ce:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8018d1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8018d5:	79 99                	jns    801870 <vprintfmt+0x80>
+                width = precision;
+  8018d7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8018db:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018e1:	eb 8d                	jmp    801870 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8018e3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8018e7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8018eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ef:	eb da                	jmp    8018cb <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8018f1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8018f6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8018fa:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801900:	3c 39                	cmp    $0x39,%al
+  801902:	77 1c                	ja     801920 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801904:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801908:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80190c:	0f b6 c0             	movzbl %al,%eax
+  80190f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801914:	0f b6 03             	movzbl (%rbx),%eax
+  801917:	3c 39                	cmp    $0x39,%al
+  801919:	76 e9                	jbe    801904 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  80191b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80191e:	eb b1                	jmp    8018d1 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801920:	49 89 dc             	mov    %rbx,%r12
+  801923:	eb ac                	jmp    8018d1 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801925:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801928:	85 c9                	test   %ecx,%ecx
+  80192a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192f:	0f 49 c1             	cmovns %ecx,%eax
+  801932:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801935:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801938:	e9 33 ff ff ff       	jmp    801870 <vprintfmt+0x80>
+            lflag++;
+  80193d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801940:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801943:	e9 28 ff ff ff       	jmp    801870 <vprintfmt+0x80>
+            lflag--;
+  801948:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80194b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194e:	e9 1d ff ff ff       	jmp    801870 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801953:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801956:	83 f8 2f             	cmp    $0x2f,%eax
+  801959:	77 19                	ja     801974 <vprintfmt+0x184>
+  80195b:	89 c2                	mov    %eax,%edx
+  80195d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801961:	83 c0 08             	add    $0x8,%eax
+  801964:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801967:	8b 3a                	mov    (%rdx),%edi
+  801969:	4c 89 ee             	mov    %r13,%rsi
+  80196c:	41 ff d6             	call   *%r14
+            break;
+  80196f:	e9 bc fe ff ff       	jmp    801830 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801974:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801978:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80197c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801980:	eb e5                	jmp    801967 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801982:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801985:	83 f8 2f             	cmp    $0x2f,%eax
+  801988:	77 5a                	ja     8019e4 <vprintfmt+0x1f4>
+  80198a:	89 c2                	mov    %eax,%edx
+  80198c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801990:	83 c0 08             	add    $0x8,%eax
+  801993:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801996:	8b 02                	mov    (%rdx),%eax
+  801998:	89 c1                	mov    %eax,%ecx
+  80199a:	f7 d9                	neg    %ecx
+  80199c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80199f:	83 f9 13             	cmp    $0x13,%ecx
+  8019a2:	7f 4e                	jg     8019f2 <vprintfmt+0x202>
+  8019a4:	48 63 c1             	movslq %ecx,%rax
+  8019a7:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  8019ae:	00 00 00 
+  8019b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8019b5:	48 85 c0             	test   %rax,%rax
+  8019b8:	74 38                	je     8019f2 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8019ba:	48 89 c1             	mov    %rax,%rcx
+  8019bd:	48 ba 48 62 80 00 00 	movabs $0x806248,%rdx
+  8019c4:	00 00 00 
+  8019c7:	4c 89 ee             	mov    %r13,%rsi
+  8019ca:	4c 89 f7             	mov    %r14,%rdi
+  8019cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d2:	49 b8 b3 17 80 00 00 	movabs $0x8017b3,%r8
+  8019d9:	00 00 00 
+  8019dc:	41 ff d0             	call   *%r8
+  8019df:	e9 4c fe ff ff       	jmp    801830 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8019e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8019e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8019ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f0:	eb a4                	jmp    801996 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8019f2:	48 ba 59 5c 80 00 00 	movabs $0x805c59,%rdx
+  8019f9:	00 00 00 
+  8019fc:	4c 89 ee             	mov    %r13,%rsi
+  8019ff:	4c 89 f7             	mov    %r14,%rdi
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	49 b8 b3 17 80 00 00 	movabs $0x8017b3,%r8
+  801a0e:	00 00 00 
+  801a11:	41 ff d0             	call   *%r8
+  801a14:	e9 17 fe ff ff       	jmp    801830 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1c:	83 f8 2f             	cmp    $0x2f,%eax
+  801a1f:	77 6c                	ja     801a8d <vprintfmt+0x29d>
+  801a21:	89 c2                	mov    %eax,%edx
+  801a23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a27:	83 c0 08             	add    $0x8,%eax
+  801a2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a2d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801a30:	48 85 f6             	test   %rsi,%rsi
+  801a33:	48 b8 52 5c 80 00 00 	movabs $0x805c52,%rax
+  801a3a:	00 00 00 
+  801a3d:	48 0f 45 c6          	cmovne %rsi,%rax
+  801a41:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801a45:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a49:	7e 06                	jle    801a51 <vprintfmt+0x261>
+  801a4b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801a4f:	75 4a                	jne    801a9b <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801a51:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801a55:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801a59:	0f b6 00             	movzbl (%rax),%eax
+  801a5c:	84 c0                	test   %al,%al
+  801a5e:	0f 85 9a 00 00 00    	jne    801afe <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801a64:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801a67:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	0f 8e bd fd ff ff    	jle    801830 <vprintfmt+0x40>
+  801a73:	4c 89 ee             	mov    %r13,%rsi
+  801a76:	bf 20 00 00 00       	mov    $0x20,%edi
+  801a7b:	41 ff d6             	call   *%r14
+  801a7e:	41 83 ec 01          	sub    $0x1,%r12d
+  801a82:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801a86:	75 eb                	jne    801a73 <vprintfmt+0x283>
+  801a88:	e9 a3 fd ff ff       	jmp    801830 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801a8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a99:	eb 92                	jmp    801a2d <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801a9b:	49 63 f7             	movslq %r15d,%rsi
+  801a9e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801aa2:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  801aa9:	00 00 00 
+  801aac:	ff d0                	call   *%rax
+  801aae:	48 89 c2             	mov    %rax,%rdx
+  801ab1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ab4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ab6:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801ab9:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	7e 91                	jle    801a51 <vprintfmt+0x261>
+  801ac0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801ac5:	4c 89 ee             	mov    %r13,%rsi
+  801ac8:	44 89 e7             	mov    %r12d,%edi
+  801acb:	41 ff d6             	call   *%r14
+  801ace:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ad2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ad5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ad8:	75 eb                	jne    801ac5 <vprintfmt+0x2d5>
+  801ada:	e9 72 ff ff ff       	jmp    801a51 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801adf:	0f b6 f8             	movzbl %al,%edi
+  801ae2:	4c 89 ee             	mov    %r13,%rsi
+  801ae5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ae8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801aec:	49 83 c4 01          	add    $0x1,%r12
+  801af0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801af6:	84 c0                	test   %al,%al
+  801af8:	0f 84 66 ff ff ff    	je     801a64 <vprintfmt+0x274>
+  801afe:	45 85 ff             	test   %r15d,%r15d
+  801b01:	78 0a                	js     801b0d <vprintfmt+0x31d>
+  801b03:	41 83 ef 01          	sub    $0x1,%r15d
+  801b07:	0f 88 57 ff ff ff    	js     801a64 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b0d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801b11:	74 cc                	je     801adf <vprintfmt+0x2ef>
+  801b13:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801b16:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801b1b:	80 fa 5e             	cmp    $0x5e,%dl
+  801b1e:	77 c2                	ja     801ae2 <vprintfmt+0x2f2>
+  801b20:	eb bd                	jmp    801adf <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801b22:	40 84 f6             	test   %sil,%sil
+  801b25:	75 26                	jne    801b4d <vprintfmt+0x35d>
+    switch (lflag) {
+  801b27:	85 d2                	test   %edx,%edx
+  801b29:	74 59                	je     801b84 <vprintfmt+0x394>
+  801b2b:	83 fa 01             	cmp    $0x1,%edx
+  801b2e:	74 7b                	je     801bab <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801b30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b33:	83 f8 2f             	cmp    $0x2f,%eax
+  801b36:	0f 87 96 00 00 00    	ja     801bd2 <vprintfmt+0x3e2>
+  801b3c:	89 c2                	mov    %eax,%edx
+  801b3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b42:	83 c0 08             	add    $0x8,%eax
+  801b45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b48:	4c 8b 22             	mov    (%rdx),%r12
+  801b4b:	eb 17                	jmp    801b64 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801b4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b50:	83 f8 2f             	cmp    $0x2f,%eax
+  801b53:	77 21                	ja     801b76 <vprintfmt+0x386>
+  801b55:	89 c2                	mov    %eax,%edx
+  801b57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b5b:	83 c0 08             	add    $0x8,%eax
+  801b5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b61:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801b64:	4d 85 e4             	test   %r12,%r12
+  801b67:	78 7a                	js     801be3 <vprintfmt+0x3f3>
+            num = i;
+  801b69:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801b6c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801b71:	e9 56 02 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b82:	eb dd                	jmp    801b61 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b87:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8a:	77 11                	ja     801b9d <vprintfmt+0x3ad>
+  801b8c:	89 c2                	mov    %eax,%edx
+  801b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b92:	83 c0 08             	add    $0x8,%eax
+  801b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b98:	4c 63 22             	movslq (%rdx),%r12
+  801b9b:	eb c7                	jmp    801b64 <vprintfmt+0x374>
+  801b9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ba1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ba5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba9:	eb ed                	jmp    801b98 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801bab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bae:	83 f8 2f             	cmp    $0x2f,%eax
+  801bb1:	77 11                	ja     801bc4 <vprintfmt+0x3d4>
+  801bb3:	89 c2                	mov    %eax,%edx
+  801bb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bb9:	83 c0 08             	add    $0x8,%eax
+  801bbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bbf:	4c 8b 22             	mov    (%rdx),%r12
+  801bc2:	eb a0                	jmp    801b64 <vprintfmt+0x374>
+  801bc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bd0:	eb ed                	jmp    801bbf <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bde:	e9 65 ff ff ff       	jmp    801b48 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801be3:	4c 89 ee             	mov    %r13,%rsi
+  801be6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801beb:	41 ff d6             	call   *%r14
+                i = -i;
+  801bee:	49 f7 dc             	neg    %r12
+  801bf1:	e9 73 ff ff ff       	jmp    801b69 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801bf6:	40 84 f6             	test   %sil,%sil
+  801bf9:	75 2e                	jne    801c29 <vprintfmt+0x439>
+    switch (lflag) {
+  801bfb:	85 d2                	test   %edx,%edx
+  801bfd:	7f 59                	jg     801c58 <vprintfmt+0x468>
+  801bff:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c02:	7d 7a                	jge    801c7e <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c07:	83 f8 2f             	cmp    $0x2f,%eax
+  801c0a:	0f 87 aa 00 00 00    	ja     801cba <vprintfmt+0x4ca>
+  801c10:	89 c2                	mov    %eax,%edx
+  801c12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c16:	83 c0 08             	add    $0x8,%eax
+  801c19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801c24:	e9 a3 01 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c2c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c2f:	77 19                	ja     801c4a <vprintfmt+0x45a>
+  801c31:	89 c2                	mov    %eax,%edx
+  801c33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c37:	83 c0 08             	add    $0x8,%eax
+  801c3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c3d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c40:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801c45:	e9 82 01 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+  801c4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c56:	eb e5                	jmp    801c3d <vprintfmt+0x44d>
+    switch (lflag) {
+  801c58:	83 fa 01             	cmp    $0x1,%edx
+  801c5b:	75 a7                	jne    801c04 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c60:	83 f8 2f             	cmp    $0x2f,%eax
+  801c63:	77 47                	ja     801cac <vprintfmt+0x4bc>
+  801c65:	89 c2                	mov    %eax,%edx
+  801c67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c6b:	83 c0 08             	add    $0x8,%eax
+  801c6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c71:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801c74:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801c79:	e9 4e 01 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801c7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c81:	83 f8 2f             	cmp    $0x2f,%eax
+  801c84:	77 18                	ja     801c9e <vprintfmt+0x4ae>
+  801c86:	89 c2                	mov    %eax,%edx
+  801c88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c8c:	83 c0 08             	add    $0x8,%eax
+  801c8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c92:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801c94:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801c99:	e9 2e 01 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+  801c9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801caa:	eb e6                	jmp    801c92 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801cac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb8:	eb b7                	jmp    801c71 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801cba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cc6:	e9 51 ff ff ff       	jmp    801c1c <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ccb:	40 84 f6             	test   %sil,%sil
+  801cce:	75 2e                	jne    801cfe <vprintfmt+0x50e>
+    switch (lflag) {
+  801cd0:	85 d2                	test   %edx,%edx
+  801cd2:	7f 59                	jg     801d2d <vprintfmt+0x53d>
+  801cd4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801cd7:	7d 77                	jge    801d50 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801cd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cdc:	83 f8 2f             	cmp    $0x2f,%eax
+  801cdf:	0f 87 a4 00 00 00    	ja     801d89 <vprintfmt+0x599>
+  801ce5:	89 c2                	mov    %eax,%edx
+  801ce7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ceb:	83 c0 08             	add    $0x8,%eax
+  801cee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801cf4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cf9:	e9 ce 00 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cfe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d01:	83 f8 2f             	cmp    $0x2f,%eax
+  801d04:	77 19                	ja     801d1f <vprintfmt+0x52f>
+  801d06:	89 c2                	mov    %eax,%edx
+  801d08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d0c:	83 c0 08             	add    $0x8,%eax
+  801d0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d15:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d1a:	e9 ad 00 00 00       	jmp    801dcc <vprintfmt+0x5dc>
+  801d1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d2b:	eb e5                	jmp    801d12 <vprintfmt+0x522>
+    switch (lflag) {
+  801d2d:	83 fa 01             	cmp    $0x1,%edx
+  801d30:	75 a7                	jne    801cd9 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801d32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d35:	83 f8 2f             	cmp    $0x2f,%eax
+  801d38:	77 41                	ja     801d7b <vprintfmt+0x58b>
+  801d3a:	89 c2                	mov    %eax,%edx
+  801d3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d40:	83 c0 08             	add    $0x8,%eax
+  801d43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801d4e:	eb 7c                	jmp    801dcc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d53:	83 f8 2f             	cmp    $0x2f,%eax
+  801d56:	77 15                	ja     801d6d <vprintfmt+0x57d>
+  801d58:	89 c2                	mov    %eax,%edx
+  801d5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5e:	83 c0 08             	add    $0x8,%eax
+  801d61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d64:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801d66:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801d6b:	eb 5f                	jmp    801dcc <vprintfmt+0x5dc>
+  801d6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d79:	eb e9                	jmp    801d64 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801d7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d87:	eb bd                	jmp    801d46 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801d89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d95:	e9 57 ff ff ff       	jmp    801cf1 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801d9a:	4c 89 ee             	mov    %r13,%rsi
+  801d9d:	bf 30 00 00 00       	mov    $0x30,%edi
+  801da2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801da5:	4c 89 ee             	mov    %r13,%rsi
+  801da8:	bf 78 00 00 00       	mov    $0x78,%edi
+  801dad:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801db0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db3:	83 f8 2f             	cmp    $0x2f,%eax
+  801db6:	77 47                	ja     801dff <vprintfmt+0x60f>
+  801db8:	89 c2                	mov    %eax,%edx
+  801dba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dbe:	83 c0 08             	add    $0x8,%eax
+  801dc1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dc4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801dc7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801dcc:	48 83 ec 08          	sub    $0x8,%rsp
+  801dd0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801dd4:	0f 94 c0             	sete   %al
+  801dd7:	0f b6 c0             	movzbl %al,%eax
+  801dda:	50                   	push   %rax
+  801ddb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801de0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801de4:	4c 89 ee             	mov    %r13,%rsi
+  801de7:	4c 89 f7             	mov    %r14,%rdi
+  801dea:	48 b8 e5 16 80 00 00 	movabs $0x8016e5,%rax
+  801df1:	00 00 00 
+  801df4:	ff d0                	call   *%rax
+            break;
+  801df6:	48 83 c4 10          	add    $0x10,%rsp
+  801dfa:	e9 31 fa ff ff       	jmp    801830 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801dff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e0b:	eb b7                	jmp    801dc4 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801e0d:	40 84 f6             	test   %sil,%sil
+  801e10:	75 2b                	jne    801e3d <vprintfmt+0x64d>
+    switch (lflag) {
+  801e12:	85 d2                	test   %edx,%edx
+  801e14:	7f 56                	jg     801e6c <vprintfmt+0x67c>
+  801e16:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e19:	7d 77                	jge    801e92 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801e1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801e21:	0f 87 a7 00 00 00    	ja     801ece <vprintfmt+0x6de>
+  801e27:	89 c2                	mov    %eax,%edx
+  801e29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2d:	83 c0 08             	add    $0x8,%eax
+  801e30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e36:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e3b:	eb 8f                	jmp    801dcc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e3d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e40:	83 f8 2f             	cmp    $0x2f,%eax
+  801e43:	77 19                	ja     801e5e <vprintfmt+0x66e>
+  801e45:	89 c2                	mov    %eax,%edx
+  801e47:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e4b:	83 c0 08             	add    $0x8,%eax
+  801e4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e51:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e54:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e59:	e9 6e ff ff ff       	jmp    801dcc <vprintfmt+0x5dc>
+  801e5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e6a:	eb e5                	jmp    801e51 <vprintfmt+0x661>
+    switch (lflag) {
+  801e6c:	83 fa 01             	cmp    $0x1,%edx
+  801e6f:	75 aa                	jne    801e1b <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801e71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e74:	83 f8 2f             	cmp    $0x2f,%eax
+  801e77:	77 47                	ja     801ec0 <vprintfmt+0x6d0>
+  801e79:	89 c2                	mov    %eax,%edx
+  801e7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e7f:	83 c0 08             	add    $0x8,%eax
+  801e82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801e8d:	e9 3a ff ff ff       	jmp    801dcc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e95:	83 f8 2f             	cmp    $0x2f,%eax
+  801e98:	77 18                	ja     801eb2 <vprintfmt+0x6c2>
+  801e9a:	89 c2                	mov    %eax,%edx
+  801e9c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea0:	83 c0 08             	add    $0x8,%eax
+  801ea3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801ea8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801ead:	e9 1a ff ff ff       	jmp    801dcc <vprintfmt+0x5dc>
+  801eb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebe:	eb e6                	jmp    801ea6 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801ec0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecc:	eb b7                	jmp    801e85 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801ece:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eda:	e9 54 ff ff ff       	jmp    801e33 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801edf:	4c 89 ee             	mov    %r13,%rsi
+  801ee2:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ee7:	41 ff d6             	call   *%r14
+            break;
+  801eea:	e9 41 f9 ff ff       	jmp    801830 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801eef:	4c 89 ee             	mov    %r13,%rsi
+  801ef2:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ef7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801efa:	48 83 eb 01          	sub    $0x1,%rbx
+  801efe:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f02:	75 f6                	jne    801efa <vprintfmt+0x70a>
+  801f04:	e9 27 f9 ff ff       	jmp    801830 <vprintfmt+0x40>
+
+0000000000801f09 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801f09:	55                   	push   %rbp
+  801f0a:	48 89 e5             	mov    %rsp,%rbp
+  801f0d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801f11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801f15:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801f1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801f1e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801f25:	48 85 ff             	test   %rdi,%rdi
+  801f28:	74 2b                	je     801f55 <vsnprintf+0x4c>
+  801f2a:	48 85 f6             	test   %rsi,%rsi
+  801f2d:	74 26                	je     801f55 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801f2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f33:	48 bf 9b 17 80 00 00 	movabs $0x80179b,%rdi
+  801f3a:	00 00 00 
+  801f3d:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  801f44:	00 00 00 
+  801f47:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f4d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801f50:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801f53:	c9                   	leave
+  801f54:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801f55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f5a:	eb f7                	jmp    801f53 <vsnprintf+0x4a>
+
+0000000000801f5c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801f5c:	55                   	push   %rbp
+  801f5d:	48 89 e5             	mov    %rsp,%rbp
+  801f60:	48 83 ec 50          	sub    $0x50,%rsp
+  801f64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801f68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801f6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801f70:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801f77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801f7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801f83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801f87:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801f8b:	48 b8 09 1f 80 00 00 	movabs $0x801f09,%rax
+  801f92:	00 00 00 
+  801f95:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+
+0000000000801f99 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801f99:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801f9c:	74 10                	je     801fae <strlen+0x15>
+    size_t n = 0;
+  801f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801fa3:	48 83 c0 01          	add    $0x1,%rax
+  801fa7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801fab:	75 f6                	jne    801fa3 <strlen+0xa>
+  801fad:	c3                   	ret
+    size_t n = 0;
+  801fae:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801fb3:	c3                   	ret
+
+0000000000801fb4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801fb4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801fbc:	48 85 f6             	test   %rsi,%rsi
+  801fbf:	74 11                	je     801fd2 <strnlen+0x1e>
+  801fc1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801fc5:	74 0c                	je     801fd3 <strnlen+0x1f>
+  801fc7:	48 83 c2 01          	add    $0x1,%rdx
+  801fcb:	48 39 d0             	cmp    %rdx,%rax
+  801fce:	75 f1                	jne    801fc1 <strnlen+0xd>
+  801fd0:	eb 04                	jmp    801fd6 <strnlen+0x22>
+  801fd2:	c3                   	ret
+  801fd3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801fd6:	c3                   	ret
+
+0000000000801fd7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801fd7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdf:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801fe3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801fe6:	48 83 c2 01          	add    $0x1,%rdx
+  801fea:	84 c9                	test   %cl,%cl
+  801fec:	75 f1                	jne    801fdf <strcpy+0x8>
+        ;
+    return res;
+}
+  801fee:	c3                   	ret
+
+0000000000801fef <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801fef:	55                   	push   %rbp
+  801ff0:	48 89 e5             	mov    %rsp,%rbp
+  801ff3:	41 54                	push   %r12
+  801ff5:	53                   	push   %rbx
+  801ff6:	48 89 fb             	mov    %rdi,%rbx
+  801ff9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801ffc:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  802003:	00 00 00 
+  802006:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802008:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80200c:	4c 89 e6             	mov    %r12,%rsi
+  80200f:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+    return dst;
+}
+  80201b:	48 89 d8             	mov    %rbx,%rax
+  80201e:	5b                   	pop    %rbx
+  80201f:	41 5c                	pop    %r12
+  802021:	5d                   	pop    %rbp
+  802022:	c3                   	ret
+
+0000000000802023 <toupper>:
+
+int
+toupper(int ch) {
+  802023:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802025:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802028:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80202b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80202e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802031:	c3                   	ret
+
+0000000000802032 <tolower>:
+
+int
+tolower(int ch) {
+  802032:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802034:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802037:	8d 57 20             	lea    0x20(%rdi),%edx
+  80203a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80203d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802040:	c3                   	ret
+
+0000000000802041 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802041:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802044:	48 85 d2             	test   %rdx,%rdx
+  802047:	74 1f                	je     802068 <strncpy+0x27>
+  802049:	48 01 fa             	add    %rdi,%rdx
+  80204c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80204f:	48 83 c1 01          	add    $0x1,%rcx
+  802053:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802057:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80205b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80205f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802063:	48 39 ca             	cmp    %rcx,%rdx
+  802066:	75 e7                	jne    80204f <strncpy+0xe>
+    }
+    return ret;
+}
+  802068:	c3                   	ret
+
+0000000000802069 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802069:	48 89 f8             	mov    %rdi,%rax
+  80206c:	48 85 d2             	test   %rdx,%rdx
+  80206f:	74 24                	je     802095 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802071:	48 83 ea 01          	sub    $0x1,%rdx
+  802075:	74 1b                	je     802092 <strlcpy+0x29>
+  802077:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80207b:	0f b6 16             	movzbl (%rsi),%edx
+  80207e:	84 d2                	test   %dl,%dl
+  802080:	74 10                	je     802092 <strlcpy+0x29>
+            *dst++ = *src++;
+  802082:	48 83 c6 01          	add    $0x1,%rsi
+  802086:	48 83 c0 01          	add    $0x1,%rax
+  80208a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80208d:	48 39 c8             	cmp    %rcx,%rax
+  802090:	75 e9                	jne    80207b <strlcpy+0x12>
+        *dst = '\0';
+  802092:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802095:	48 29 f8             	sub    %rdi,%rax
+}
+  802098:	c3                   	ret
+
+0000000000802099 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802099:	0f b6 07             	movzbl (%rdi),%eax
+  80209c:	84 c0                	test   %al,%al
+  80209e:	74 13                	je     8020b3 <strcmp+0x1a>
+  8020a0:	38 06                	cmp    %al,(%rsi)
+  8020a2:	75 0f                	jne    8020b3 <strcmp+0x1a>
+  8020a4:	48 83 c7 01          	add    $0x1,%rdi
+  8020a8:	48 83 c6 01          	add    $0x1,%rsi
+  8020ac:	0f b6 07             	movzbl (%rdi),%eax
+  8020af:	84 c0                	test   %al,%al
+  8020b1:	75 ed                	jne    8020a0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020b3:	0f b6 c0             	movzbl %al,%eax
+  8020b6:	0f b6 16             	movzbl (%rsi),%edx
+  8020b9:	29 d0                	sub    %edx,%eax
+}
+  8020bb:	c3                   	ret
+
+00000000008020bc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8020bc:	48 85 d2             	test   %rdx,%rdx
+  8020bf:	74 1f                	je     8020e0 <strncmp+0x24>
+  8020c1:	0f b6 07             	movzbl (%rdi),%eax
+  8020c4:	84 c0                	test   %al,%al
+  8020c6:	74 1e                	je     8020e6 <strncmp+0x2a>
+  8020c8:	3a 06                	cmp    (%rsi),%al
+  8020ca:	75 1a                	jne    8020e6 <strncmp+0x2a>
+  8020cc:	48 83 c7 01          	add    $0x1,%rdi
+  8020d0:	48 83 c6 01          	add    $0x1,%rsi
+  8020d4:	48 83 ea 01          	sub    $0x1,%rdx
+  8020d8:	75 e7                	jne    8020c1 <strncmp+0x5>
+
+    if (!n) return 0;
+  8020da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020df:	c3                   	ret
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	c3                   	ret
+  8020e6:	48 85 d2             	test   %rdx,%rdx
+  8020e9:	74 09                	je     8020f4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8020eb:	0f b6 07             	movzbl (%rdi),%eax
+  8020ee:	0f b6 16             	movzbl (%rsi),%edx
+  8020f1:	29 d0                	sub    %edx,%eax
+  8020f3:	c3                   	ret
+    if (!n) return 0;
+  8020f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f9:	c3                   	ret
+
+00000000008020fa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8020fa:	0f b6 17             	movzbl (%rdi),%edx
+  8020fd:	84 d2                	test   %dl,%dl
+  8020ff:	74 18                	je     802119 <strchr+0x1f>
+        if (*str == c) {
+  802101:	0f be d2             	movsbl %dl,%edx
+  802104:	39 f2                	cmp    %esi,%edx
+  802106:	74 17                	je     80211f <strchr+0x25>
+    for (; *str; str++) {
+  802108:	48 83 c7 01          	add    $0x1,%rdi
+  80210c:	0f b6 17             	movzbl (%rdi),%edx
+  80210f:	84 d2                	test   %dl,%dl
+  802111:	75 ee                	jne    802101 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802113:	b8 00 00 00 00       	mov    $0x0,%eax
+  802118:	c3                   	ret
+  802119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211e:	c3                   	ret
+  80211f:	48 89 f8             	mov    %rdi,%rax
+}
+  802122:	c3                   	ret
+
+0000000000802123 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802123:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802126:	0f b6 17             	movzbl (%rdi),%edx
+  802129:	84 d2                	test   %dl,%dl
+  80212b:	74 13                	je     802140 <strfind+0x1d>
+  80212d:	0f be d2             	movsbl %dl,%edx
+  802130:	39 f2                	cmp    %esi,%edx
+  802132:	74 0b                	je     80213f <strfind+0x1c>
+  802134:	48 83 c0 01          	add    $0x1,%rax
+  802138:	0f b6 10             	movzbl (%rax),%edx
+  80213b:	84 d2                	test   %dl,%dl
+  80213d:	75 ee                	jne    80212d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80213f:	c3                   	ret
+  802140:	c3                   	ret
+
+0000000000802141 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802141:	48 39 f7             	cmp    %rsi,%rdi
+  802144:	74 65                	je     8021ab <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802146:	55                   	push   %rbp
+  802147:	48 89 e5             	mov    %rsp,%rbp
+  80214a:	41 57                	push   %r15
+  80214c:	41 56                	push   %r14
+  80214e:	41 55                	push   %r13
+  802150:	41 54                	push   %r12
+  802152:	53                   	push   %rbx
+  802153:	48 83 ec 18          	sub    $0x18,%rsp
+  802157:	48 89 fb             	mov    %rdi,%rbx
+  80215a:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80215d:	49 bf 32 20 80 00 00 	movabs $0x802032,%r15
+  802164:	00 00 00 
+  802167:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80216b:	41 0f b6 fd          	movzbl %r13b,%edi
+  80216f:	41 ff d7             	call   *%r15
+  802172:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802175:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80217a:	41 0f b6 fe          	movzbl %r14b,%edi
+  80217e:	41 ff d7             	call   *%r15
+  802181:	89 c2                	mov    %eax,%edx
+  802183:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802186:	29 d0                	sub    %edx,%eax
+  802188:	75 12                	jne    80219c <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80218a:	48 83 c3 01          	add    $0x1,%rbx
+  80218e:	45 84 ed             	test   %r13b,%r13b
+  802191:	74 09                	je     80219c <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802193:	49 83 c4 01          	add    $0x1,%r12
+  802197:	45 84 f6             	test   %r14b,%r14b
+  80219a:	75 cb                	jne    802167 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80219c:	48 83 c4 18          	add    $0x18,%rsp
+  8021a0:	5b                   	pop    %rbx
+  8021a1:	41 5c                	pop    %r12
+  8021a3:	41 5d                	pop    %r13
+  8021a5:	41 5e                	pop    %r14
+  8021a7:	41 5f                	pop    %r15
+  8021a9:	5d                   	pop    %rbp
+  8021aa:	c3                   	ret
+    if (p1 == p2) return 0;
+  8021ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b0:	c3                   	ret
+
+00000000008021b1 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021b1:	48 39 f7             	cmp    %rsi,%rdi
+  8021b4:	74 7d                	je     802233 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8021b6:	55                   	push   %rbp
+  8021b7:	48 89 e5             	mov    %rsp,%rbp
+  8021ba:	41 57                	push   %r15
+  8021bc:	41 56                	push   %r14
+  8021be:	41 55                	push   %r13
+  8021c0:	41 54                	push   %r12
+  8021c2:	53                   	push   %rbx
+  8021c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8021c7:	48 89 fb             	mov    %rdi,%rbx
+  8021ca:	49 89 f4             	mov    %rsi,%r12
+  8021cd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8021d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021d5:	49 bf 32 20 80 00 00 	movabs $0x802032,%r15
+  8021dc:	00 00 00 
+    while (n--) {
+  8021df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8021e3:	48 39 c3             	cmp    %rax,%rbx
+  8021e6:	74 37                	je     80221f <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8021e8:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8021ec:	41 0f b6 fd          	movzbl %r13b,%edi
+  8021f0:	41 ff d7             	call   *%r15
+  8021f3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8021f6:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8021fb:	41 0f b6 fe          	movzbl %r14b,%edi
+  8021ff:	41 ff d7             	call   *%r15
+  802202:	89 c2                	mov    %eax,%edx
+  802204:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802207:	29 d0                	sub    %edx,%eax
+  802209:	75 19                	jne    802224 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80220b:	48 83 c3 01          	add    $0x1,%rbx
+  80220f:	45 84 ed             	test   %r13b,%r13b
+  802212:	74 10                	je     802224 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802214:	49 83 c4 01          	add    $0x1,%r12
+  802218:	45 84 f6             	test   %r14b,%r14b
+  80221b:	75 c2                	jne    8021df <strncasecmp+0x2e>
+  80221d:	eb 05                	jmp    802224 <strncasecmp+0x73>
+  80221f:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802224:	48 83 c4 18          	add    $0x18,%rsp
+  802228:	5b                   	pop    %rbx
+  802229:	41 5c                	pop    %r12
+  80222b:	41 5d                	pop    %r13
+  80222d:	41 5e                	pop    %r14
+  80222f:	41 5f                	pop    %r15
+  802231:	5d                   	pop    %rbp
+  802232:	c3                   	ret
+    if (p1 == p2) return 0;
+  802233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802238:	c3                   	ret
+
+0000000000802239 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802239:	83 e7 df             	and    $0xffffffdf,%edi
+  80223c:	83 ef 41             	sub    $0x41,%edi
+  80223f:	83 ff 19             	cmp    $0x19,%edi
+  802242:	0f 96 c0             	setbe  %al
+}
+  802245:	c3                   	ret
+
+0000000000802246 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802246:	83 ff 20             	cmp    $0x20,%edi
+  802249:	0f 94 c0             	sete   %al
+  80224c:	83 ff 09             	cmp    $0x9,%edi
+  80224f:	0f 94 c2             	sete   %dl
+  802252:	09 d0                	or     %edx,%eax
+}
+  802254:	c3                   	ret
+
+0000000000802255 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802255:	55                   	push   %rbp
+  802256:	48 89 e5             	mov    %rsp,%rbp
+  802259:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80225b:	48 bf 3f 61 80 00 00 	movabs $0x80613f,%rdi
+  802262:	00 00 00 
+  802265:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+  802271:	48 85 c0             	test   %rax,%rax
+  802274:	0f 95 c0             	setne  %al
+}
+  802277:	5d                   	pop    %rbp
+  802278:	c3                   	ret
+
+0000000000802279 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802279:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80227c:	48 89 f8             	mov    %rdi,%rax
+  80227f:	48 f7 d8             	neg    %rax
+  802282:	83 e0 07             	and    $0x7,%eax
+  802285:	49 89 d1             	mov    %rdx,%r9
+  802288:	49 29 c1             	sub    %rax,%r9
+  80228b:	78 36                	js     8022c3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80228d:	40 0f b6 c6          	movzbl %sil,%eax
+  802291:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802298:	01 01 01 
+  80229b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80229f:	40 f6 c7 07          	test   $0x7,%dil
+  8022a3:	75 38                	jne    8022dd <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8022a5:	4c 89 c9             	mov    %r9,%rcx
+  8022a8:	48 c1 f9 03          	sar    $0x3,%rcx
+  8022ac:	74 0c                	je     8022ba <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8022ae:	fc                   	cld
+  8022af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8022b2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8022b6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8022ba:	4d 85 c9             	test   %r9,%r9
+  8022bd:	75 45                	jne    802304 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8022bf:	4c 89 c0             	mov    %r8,%rax
+  8022c2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8022c3:	48 85 d2             	test   %rdx,%rdx
+  8022c6:	74 f7                	je     8022bf <memset+0x46>
+  8022c8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8022cb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8022ce:	48 83 c0 01          	add    $0x1,%rax
+  8022d2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8022d6:	48 39 c2             	cmp    %rax,%rdx
+  8022d9:	75 f3                	jne    8022ce <memset+0x55>
+  8022db:	eb e2                	jmp    8022bf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8022dd:	40 f6 c7 01          	test   $0x1,%dil
+  8022e1:	74 06                	je     8022e9 <memset+0x70>
+  8022e3:	88 07                	mov    %al,(%rdi)
+  8022e5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8022e9:	40 f6 c7 02          	test   $0x2,%dil
+  8022ed:	74 07                	je     8022f6 <memset+0x7d>
+  8022ef:	66 89 07             	mov    %ax,(%rdi)
+  8022f2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8022f6:	40 f6 c7 04          	test   $0x4,%dil
+  8022fa:	74 a9                	je     8022a5 <memset+0x2c>
+  8022fc:	89 07                	mov    %eax,(%rdi)
+  8022fe:	48 83 c7 04          	add    $0x4,%rdi
+  802302:	eb a1                	jmp    8022a5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802304:	41 f6 c1 04          	test   $0x4,%r9b
+  802308:	74 06                	je     802310 <memset+0x97>
+  80230a:	89 07                	mov    %eax,(%rdi)
+  80230c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802310:	41 f6 c1 02          	test   $0x2,%r9b
+  802314:	74 07                	je     80231d <memset+0xa4>
+  802316:	66 89 07             	mov    %ax,(%rdi)
+  802319:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80231d:	41 f6 c1 01          	test   $0x1,%r9b
+  802321:	74 9c                	je     8022bf <memset+0x46>
+  802323:	88 07                	mov    %al,(%rdi)
+  802325:	eb 98                	jmp    8022bf <memset+0x46>
+
+0000000000802327 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802327:	48 89 f8             	mov    %rdi,%rax
+  80232a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80232d:	48 39 fe             	cmp    %rdi,%rsi
+  802330:	73 3b                	jae    80236d <memmove+0x46>
+  802332:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802336:	48 39 d7             	cmp    %rdx,%rdi
+  802339:	73 32                	jae    80236d <memmove+0x46>
+        s += n;
+        d += n;
+  80233b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80233f:	48 89 d6             	mov    %rdx,%rsi
+  802342:	48 09 fe             	or     %rdi,%rsi
+  802345:	48 09 ce             	or     %rcx,%rsi
+  802348:	40 f6 c6 07          	test   $0x7,%sil
+  80234c:	75 12                	jne    802360 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80234e:	48 83 ef 08          	sub    $0x8,%rdi
+  802352:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802356:	48 c1 e9 03          	shr    $0x3,%rcx
+  80235a:	fd                   	std
+  80235b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80235e:	fc                   	cld
+  80235f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802360:	48 83 ef 01          	sub    $0x1,%rdi
+  802364:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802368:	fd                   	std
+  802369:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80236b:	eb f1                	jmp    80235e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80236d:	48 89 f2             	mov    %rsi,%rdx
+  802370:	48 09 c2             	or     %rax,%rdx
+  802373:	48 09 ca             	or     %rcx,%rdx
+  802376:	f6 c2 07             	test   $0x7,%dl
+  802379:	75 0c                	jne    802387 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80237b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80237f:	48 89 c7             	mov    %rax,%rdi
+  802382:	fc                   	cld
+  802383:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802386:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802387:	48 89 c7             	mov    %rax,%rdi
+  80238a:	fc                   	cld
+  80238b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80238d:	c3                   	ret
+
+000000000080238e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802392:	48 b8 27 23 80 00 00 	movabs $0x802327,%rax
+  802399:	00 00 00 
+  80239c:	ff d0                	call   *%rax
+}
+  80239e:	5d                   	pop    %rbp
+  80239f:	c3                   	ret
+
+00000000008023a0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8023a0:	55                   	push   %rbp
+  8023a1:	48 89 e5             	mov    %rsp,%rbp
+  8023a4:	41 57                	push   %r15
+  8023a6:	41 56                	push   %r14
+  8023a8:	41 55                	push   %r13
+  8023aa:	41 54                	push   %r12
+  8023ac:	53                   	push   %rbx
+  8023ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b1:	49 89 fe             	mov    %rdi,%r14
+  8023b4:	49 89 f7             	mov    %rsi,%r15
+  8023b7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8023ba:	48 89 f7             	mov    %rsi,%rdi
+  8023bd:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  8023c4:	00 00 00 
+  8023c7:	ff d0                	call   *%rax
+  8023c9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8023cc:	48 89 de             	mov    %rbx,%rsi
+  8023cf:	4c 89 f7             	mov    %r14,%rdi
+  8023d2:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  8023d9:	00 00 00 
+  8023dc:	ff d0                	call   *%rax
+  8023de:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8023e1:	48 39 c3             	cmp    %rax,%rbx
+  8023e4:	74 36                	je     80241c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8023e6:	48 89 d8             	mov    %rbx,%rax
+  8023e9:	4c 29 e8             	sub    %r13,%rax
+  8023ec:	49 39 c4             	cmp    %rax,%r12
+  8023ef:	73 31                	jae    802422 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8023f1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8023f6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8023fa:	4c 89 fe             	mov    %r15,%rsi
+  8023fd:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  802404:	00 00 00 
+  802407:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802409:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80240d:	48 83 c4 08          	add    $0x8,%rsp
+  802411:	5b                   	pop    %rbx
+  802412:	41 5c                	pop    %r12
+  802414:	41 5d                	pop    %r13
+  802416:	41 5e                	pop    %r14
+  802418:	41 5f                	pop    %r15
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80241c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802420:	eb eb                	jmp    80240d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802422:	48 83 eb 01          	sub    $0x1,%rbx
+  802426:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80242a:	48 89 da             	mov    %rbx,%rdx
+  80242d:	4c 89 fe             	mov    %r15,%rsi
+  802430:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80243c:	49 01 de             	add    %rbx,%r14
+  80243f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802444:	eb c3                	jmp    802409 <strlcat+0x69>
+
+0000000000802446 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802446:	48 85 d2             	test   %rdx,%rdx
+  802449:	74 2d                	je     802478 <memcmp+0x32>
+  80244b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802450:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802454:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802459:	44 38 c1             	cmp    %r8b,%cl
+  80245c:	75 0f                	jne    80246d <memcmp+0x27>
+    while (n-- > 0) {
+  80245e:	48 83 c0 01          	add    $0x1,%rax
+  802462:	48 39 c2             	cmp    %rax,%rdx
+  802465:	75 e9                	jne    802450 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80246d:	0f b6 c1             	movzbl %cl,%eax
+  802470:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802474:	44 29 c0             	sub    %r8d,%eax
+  802477:	c3                   	ret
+    return 0;
+  802478:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247d:	c3                   	ret
+
+000000000080247e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80247e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802482:	48 39 c7             	cmp    %rax,%rdi
+  802485:	73 0f                	jae    802496 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802487:	40 38 37             	cmp    %sil,(%rdi)
+  80248a:	74 0e                	je     80249a <memfind+0x1c>
+    for (; src < end; src++) {
+  80248c:	48 83 c7 01          	add    $0x1,%rdi
+  802490:	48 39 f8             	cmp    %rdi,%rax
+  802493:	75 f2                	jne    802487 <memfind+0x9>
+  802495:	c3                   	ret
+  802496:	48 89 f8             	mov    %rdi,%rax
+  802499:	c3                   	ret
+  80249a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80249d:	c3                   	ret
+
+000000000080249e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80249e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8024a1:	0f b6 37             	movzbl (%rdi),%esi
+  8024a4:	40 80 fe 20          	cmp    $0x20,%sil
+  8024a8:	74 06                	je     8024b0 <strtol+0x12>
+  8024aa:	40 80 fe 09          	cmp    $0x9,%sil
+  8024ae:	75 13                	jne    8024c3 <strtol+0x25>
+  8024b0:	48 83 c7 01          	add    $0x1,%rdi
+  8024b4:	0f b6 37             	movzbl (%rdi),%esi
+  8024b7:	40 80 fe 20          	cmp    $0x20,%sil
+  8024bb:	74 f3                	je     8024b0 <strtol+0x12>
+  8024bd:	40 80 fe 09          	cmp    $0x9,%sil
+  8024c1:	74 ed                	je     8024b0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8024c3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8024c6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024c9:	3c 01                	cmp    $0x1,%al
+  8024cb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024cf:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8024d5:	75 0f                	jne    8024e6 <strtol+0x48>
+  8024d7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8024da:	74 14                	je     8024f0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8024dc:	85 d2                	test   %edx,%edx
+  8024de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024e3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8024e6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8024eb:	4c 63 ca             	movslq %edx,%r9
+  8024ee:	eb 36                	jmp    802526 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8024f0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8024f4:	74 0f                	je     802505 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8024f6:	85 d2                	test   %edx,%edx
+  8024f8:	75 ec                	jne    8024e6 <strtol+0x48>
+        s++;
+  8024fa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8024fe:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802503:	eb e1                	jmp    8024e6 <strtol+0x48>
+        s += 2;
+  802505:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802509:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80250e:	eb d6                	jmp    8024e6 <strtol+0x48>
+            dig -= '0';
+  802510:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802513:	44 0f b6 c1          	movzbl %cl,%r8d
+  802517:	41 39 d0             	cmp    %edx,%r8d
+  80251a:	7d 21                	jge    80253d <strtol+0x9f>
+        val = val * base + dig;
+  80251c:	49 0f af c1          	imul   %r9,%rax
+  802520:	0f b6 c9             	movzbl %cl,%ecx
+  802523:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802526:	48 83 c7 01          	add    $0x1,%rdi
+  80252a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80252e:	80 f9 39             	cmp    $0x39,%cl
+  802531:	76 dd                	jbe    802510 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802533:	80 f9 7b             	cmp    $0x7b,%cl
+  802536:	77 05                	ja     80253d <strtol+0x9f>
+            dig -= 'a' - 10;
+  802538:	83 e9 57             	sub    $0x57,%ecx
+  80253b:	eb d6                	jmp    802513 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80253d:	4d 85 d2             	test   %r10,%r10
+  802540:	74 03                	je     802545 <strtol+0xa7>
+  802542:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802545:	48 89 c2             	mov    %rax,%rdx
+  802548:	48 f7 da             	neg    %rdx
+  80254b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80254f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802553:	c3                   	ret
+
+0000000000802554 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802554:	55                   	push   %rbp
+  802555:	48 89 e5             	mov    %rsp,%rbp
+  802558:	53                   	push   %rbx
+  802559:	48 89 fa             	mov    %rdi,%rdx
+  80255c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80255f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802564:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802569:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80256e:	be 00 00 00 00       	mov    $0x0,%esi
+  802573:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802579:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80257f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802581:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+0000000000802587 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802587:	55                   	push   %rbp
+  802588:	48 89 e5             	mov    %rsp,%rbp
+  80258b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80258c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802591:	ba 00 00 00 00       	mov    $0x0,%edx
+  802596:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80259b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025b6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8025b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025bc:	c9                   	leave
+  8025bd:	c3                   	ret
+
+00000000008025be <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8025be:	55                   	push   %rbp
+  8025bf:	48 89 e5             	mov    %rsp,%rbp
+  8025c2:	53                   	push   %rbx
+  8025c3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025c6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8025cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8025da:	be 00 00 00 00       	mov    $0x0,%esi
+  8025df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8025e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8025eb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8025ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025f1:	c9                   	leave
+  8025f2:	c3                   	ret
+
+00000000008025f3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8025f3:	55                   	push   %rbp
+  8025f4:	48 89 e5             	mov    %rsp,%rbp
+  8025f7:	53                   	push   %rbx
+  8025f8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8025fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8025ff:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802604:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80260e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802613:	be 00 00 00 00       	mov    $0x0,%esi
+  802618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80261e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802624:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802626:	48 85 c0             	test   %rax,%rax
+  802629:	7f 06                	jg     802631 <sys_env_destroy+0x3e>
+}
+  80262b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80262f:	c9                   	leave
+  802630:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802631:	49 89 c0             	mov    %rax,%r8
+  802634:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802639:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802640:	00 00 00 
+  802643:	be 27 00 00 00       	mov    $0x27,%esi
+  802648:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80264f:	00 00 00 
+  802652:	b8 00 00 00 00       	mov    $0x0,%eax
+  802657:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  80265e:	00 00 00 
+  802661:	41 ff d1             	call   *%r9
+
+0000000000802664 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802664:	55                   	push   %rbp
+  802665:	48 89 e5             	mov    %rsp,%rbp
+  802668:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802669:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80266e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802673:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802678:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80267d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802682:	be 00 00 00 00       	mov    $0x0,%esi
+  802687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80268d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802693:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802695:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802699:	c9                   	leave
+  80269a:	c3                   	ret
+
+000000000080269b <sys_yield>:
+
+void
+sys_yield(void) {
+  80269b:	55                   	push   %rbp
+  80269c:	48 89 e5             	mov    %rsp,%rbp
+  80269f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8026a0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ca:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026d0:	c9                   	leave
+  8026d1:	c3                   	ret
+
+00000000008026d2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8026d2:	55                   	push   %rbp
+  8026d3:	48 89 e5             	mov    %rsp,%rbp
+  8026d6:	53                   	push   %rbx
+  8026d7:	48 89 fa             	mov    %rdi,%rdx
+  8026da:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026dd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026e2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8026e9:	00 00 00 
+  8026ec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802702:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+
+000000000080270a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80270a:	55                   	push   %rbp
+  80270b:	48 89 e5             	mov    %rsp,%rbp
+  80270e:	53                   	push   %rbx
+  80270f:	49 89 f8             	mov    %rdi,%r8
+  802712:	48 89 d3             	mov    %rdx,%rbx
+  802715:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802718:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80271d:	4c 89 c2             	mov    %r8,%rdx
+  802720:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802723:	be 00 00 00 00       	mov    $0x0,%esi
+  802728:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80272e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802734:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802736:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80273a:	c9                   	leave
+  80273b:	c3                   	ret
+
+000000000080273c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80273c:	55                   	push   %rbp
+  80273d:	48 89 e5             	mov    %rsp,%rbp
+  802740:	53                   	push   %rbx
+  802741:	48 83 ec 08          	sub    $0x8,%rsp
+  802745:	89 f8                	mov    %edi,%eax
+  802747:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80274a:	48 63 f9             	movslq %ecx,%rdi
+  80274d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802750:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802755:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802758:	be 00 00 00 00       	mov    $0x0,%esi
+  80275d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802769:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80276b:	48 85 c0             	test   %rax,%rax
+  80276e:	7f 06                	jg     802776 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802770:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802774:	c9                   	leave
+  802775:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802776:	49 89 c0             	mov    %rax,%r8
+  802779:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80277e:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802785:	00 00 00 
+  802788:	be 27 00 00 00       	mov    $0x27,%esi
+  80278d:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802794:	00 00 00 
+  802797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279c:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  8027a3:	00 00 00 
+  8027a6:	41 ff d1             	call   *%r9
+
+00000000008027a9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8027a9:	55                   	push   %rbp
+  8027aa:	48 89 e5             	mov    %rsp,%rbp
+  8027ad:	53                   	push   %rbx
+  8027ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b2:	89 f8                	mov    %edi,%eax
+  8027b4:	49 89 f2             	mov    %rsi,%r10
+  8027b7:	48 89 cf             	mov    %rcx,%rdi
+  8027ba:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8027bd:	48 63 da             	movslq %edx,%rbx
+  8027c0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027c3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027c8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027cb:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8027ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027d6:	48 85 c0             	test   %rax,%rax
+  8027d9:	7f 06                	jg     8027e1 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8027db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e1:	49 89 c0             	mov    %rax,%r8
+  8027e4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8027e9:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8027f0:	00 00 00 
+  8027f3:	be 27 00 00 00       	mov    $0x27,%esi
+  8027f8:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8027ff:	00 00 00 
+  802802:	b8 00 00 00 00       	mov    $0x0,%eax
+  802807:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  80280e:	00 00 00 
+  802811:	41 ff d1             	call   *%r9
+
+0000000000802814 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802814:	55                   	push   %rbp
+  802815:	48 89 e5             	mov    %rsp,%rbp
+  802818:	53                   	push   %rbx
+  802819:	48 83 ec 08          	sub    $0x8,%rsp
+  80281d:	48 89 f1             	mov    %rsi,%rcx
+  802820:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802823:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802826:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80282b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802830:	be 00 00 00 00       	mov    $0x0,%esi
+  802835:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80283b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802841:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802843:	48 85 c0             	test   %rax,%rax
+  802846:	7f 06                	jg     80284e <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802848:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80284e:	49 89 c0             	mov    %rax,%r8
+  802851:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802856:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80285d:	00 00 00 
+  802860:	be 27 00 00 00       	mov    $0x27,%esi
+  802865:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80286c:	00 00 00 
+  80286f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802874:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  80287b:	00 00 00 
+  80287e:	41 ff d1             	call   *%r9
+
+0000000000802881 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802881:	55                   	push   %rbp
+  802882:	48 89 e5             	mov    %rsp,%rbp
+  802885:	53                   	push   %rbx
+  802886:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80288a:	48 63 ce             	movslq %esi,%rcx
+  80288d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802890:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80289a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289f:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028b2:	48 85 c0             	test   %rax,%rax
+  8028b5:	7f 06                	jg     8028bd <sys_env_set_status+0x3c>
+}
+  8028b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028bb:	c9                   	leave
+  8028bc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028bd:	49 89 c0             	mov    %rax,%r8
+  8028c0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8028c5:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8028cc:	00 00 00 
+  8028cf:	be 27 00 00 00       	mov    $0x27,%esi
+  8028d4:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8028db:	00 00 00 
+  8028de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e3:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  8028ea:	00 00 00 
+  8028ed:	41 ff d1             	call   *%r9
+
+00000000008028f0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8028f0:	55                   	push   %rbp
+  8028f1:	48 89 e5             	mov    %rsp,%rbp
+  8028f4:	53                   	push   %rbx
+  8028f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8028fc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802909:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80290e:	be 00 00 00 00       	mov    $0x0,%esi
+  802913:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802919:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80291f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802921:	48 85 c0             	test   %rax,%rax
+  802924:	7f 06                	jg     80292c <sys_env_set_trapframe+0x3c>
+}
+  802926:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80292a:	c9                   	leave
+  80292b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80292c:	49 89 c0             	mov    %rax,%r8
+  80292f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802934:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  80293b:	00 00 00 
+  80293e:	be 27 00 00 00       	mov    $0x27,%esi
+  802943:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  80294a:	00 00 00 
+  80294d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802952:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802959:	00 00 00 
+  80295c:	41 ff d1             	call   *%r9
+
+000000000080295f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80295f:	55                   	push   %rbp
+  802960:	48 89 e5             	mov    %rsp,%rbp
+  802963:	53                   	push   %rbx
+  802964:	48 83 ec 08          	sub    $0x8,%rsp
+  802968:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  80296b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80296e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802973:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802978:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297d:	be 00 00 00 00       	mov    $0x0,%esi
+  802982:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802988:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802990:	48 85 c0             	test   %rax,%rax
+  802993:	7f 06                	jg     80299b <sys_env_set_pgfault_upcall+0x3c>
+}
+  802995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80299b:	49 89 c0             	mov    %rax,%r8
+  80299e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8029a3:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  8029aa:	00 00 00 
+  8029ad:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b2:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  8029b9:	00 00 00 
+  8029bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c1:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  8029c8:	00 00 00 
+  8029cb:	41 ff d1             	call   *%r9
+
+00000000008029ce <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8029ce:	55                   	push   %rbp
+  8029cf:	48 89 e5             	mov    %rsp,%rbp
+  8029d2:	53                   	push   %rbx
+  8029d3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8029d7:	40 0f b6 ce          	movzbl %sil,%ecx
+  8029db:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029de:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029fe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a00:	48 85 c0             	test   %rax,%rax
+  802a03:	7f 06                	jg     802a0b <sys_env_set_reclaim+0x3d>
+}
+  802a05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a0b:	49 89 c0             	mov    %rax,%r8
+  802a0e:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802a13:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a1a:	00 00 00 
+  802a1d:	be 27 00 00 00       	mov    $0x27,%esi
+  802a22:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a29:	00 00 00 
+  802a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a31:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802a38:	00 00 00 
+  802a3b:	41 ff d1             	call   *%r9
+
+0000000000802a3e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802a3e:	55                   	push   %rbp
+  802a3f:	48 89 e5             	mov    %rsp,%rbp
+  802a42:	53                   	push   %rbx
+  802a43:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802a47:	48 63 ce             	movslq %esi,%rcx
+  802a4a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a4d:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a57:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a6f:	48 85 c0             	test   %rax,%rax
+  802a72:	7f 06                	jg     802a7a <sys_env_set_nice+0x3c>
+}
+  802a74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a7a:	49 89 c0             	mov    %rax,%r8
+  802a7d:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802a82:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802a89:	00 00 00 
+  802a8c:	be 27 00 00 00       	mov    $0x27,%esi
+  802a91:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802a98:	00 00 00 
+  802a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa0:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802aa7:	00 00 00 
+  802aaa:	41 ff d1             	call   *%r9
+
+0000000000802aad <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802aad:	55                   	push   %rbp
+  802aae:	48 89 e5             	mov    %rsp,%rbp
+  802ab1:	53                   	push   %rbx
+  802ab2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ab5:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ace:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ada:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802adc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ae0:	c9                   	leave
+  802ae1:	c3                   	ret
+
+0000000000802ae2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ae2:	55                   	push   %rbp
+  802ae3:	48 89 e5             	mov    %rsp,%rbp
+  802ae6:	53                   	push   %rbx
+  802ae7:	89 f8                	mov    %edi,%eax
+  802ae9:	49 89 f1             	mov    %rsi,%r9
+  802aec:	48 89 d3             	mov    %rdx,%rbx
+  802aef:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802af2:	49 63 f0             	movslq %r8d,%rsi
+  802af5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802afd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b00:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0c:	cd 30                	int    $0x30
+}
+  802b0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+
+0000000000802b14 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b14:	55                   	push   %rbp
+  802b15:	48 89 e5             	mov    %rsp,%rbp
+  802b18:	53                   	push   %rbx
+  802b19:	89 f8                	mov    %edi,%eax
+  802b1b:	49 89 f1             	mov    %rsi,%r9
+  802b1e:	48 89 d3             	mov    %rdx,%rbx
+  802b21:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b24:	49 63 f0             	movslq %r8d,%rsi
+  802b27:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b2f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b3e:	cd 30                	int    $0x30
+}
+  802b40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b44:	c9                   	leave
+  802b45:	c3                   	ret
+
+0000000000802b46 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802b46:	55                   	push   %rbp
+  802b47:	48 89 e5             	mov    %rsp,%rbp
+  802b4a:	53                   	push   %rbx
+  802b4b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4f:	89 f8                	mov    %edi,%eax
+  802b51:	49 89 f2             	mov    %rsi,%r10
+  802b54:	48 89 d3             	mov    %rdx,%rbx
+  802b57:	48 89 cf             	mov    %rcx,%rdi
+  802b5a:	44 89 c6             	mov    %r8d,%esi
+  802b5d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802b60:	48 63 f6             	movslq %esi,%rsi
+  802b63:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b66:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b6b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802b6e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802b72:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b74:	48 85 c0             	test   %rax,%rax
+  802b77:	7f 06                	jg     802b7f <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802b79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7d:	c9                   	leave
+  802b7e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7f:	49 89 c0             	mov    %rax,%r8
+  802b82:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802b87:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802b8e:	00 00 00 
+  802b91:	be 27 00 00 00       	mov    $0x27,%esi
+  802b96:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802b9d:	00 00 00 
+  802ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba5:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802bac:	00 00 00 
+  802baf:	41 ff d1             	call   *%r9
+
+0000000000802bb2 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	53                   	push   %rbx
+  802bb7:	48 83 ec 08          	sub    $0x8,%rsp
+  802bbb:	48 89 f1             	mov    %rsi,%rcx
+  802bbe:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802bc1:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802bc5:	48 8b 1a             	mov    (%rdx),%rbx
+  802bc8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bcb:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd0:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd4:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802bd8:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802bdc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bde:	48 85 c0             	test   %rax,%rax
+  802be1:	7f 06                	jg     802be9 <sys_ipc_call_short+0x37>
+}
+  802be3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be7:	c9                   	leave
+  802be8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802be9:	49 89 c0             	mov    %rax,%r8
+  802bec:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802bf1:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802bf8:	00 00 00 
+  802bfb:	be 27 00 00 00       	mov    $0x27,%esi
+  802c00:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c07:	00 00 00 
+  802c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0f:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802c16:	00 00 00 
+  802c19:	41 ff d1             	call   *%r9
+
+0000000000802c1c <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c1c:	55                   	push   %rbp
+  802c1d:	48 89 e5             	mov    %rsp,%rbp
+  802c20:	53                   	push   %rbx
+  802c21:	48 83 ec 08          	sub    $0x8,%rsp
+  802c25:	89 f8                	mov    %edi,%eax
+  802c27:	49 89 f2             	mov    %rsi,%r10
+  802c2a:	48 89 d3             	mov    %rdx,%rbx
+  802c2d:	48 89 cf             	mov    %rcx,%rdi
+  802c30:	44 89 c6             	mov    %r8d,%esi
+  802c33:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c36:	48 63 f6             	movslq %esi,%rsi
+  802c39:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c41:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c44:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c48:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c4a:	48 85 c0             	test   %rax,%rax
+  802c4d:	7f 06                	jg     802c55 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c53:	c9                   	leave
+  802c54:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c55:	49 89 c0             	mov    %rax,%r8
+  802c58:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802c5d:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802c64:	00 00 00 
+  802c67:	be 27 00 00 00       	mov    $0x27,%esi
+  802c6c:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802c73:	00 00 00 
+  802c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7b:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802c82:	00 00 00 
+  802c85:	41 ff d1             	call   *%r9
+
+0000000000802c88 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802c88:	55                   	push   %rbp
+  802c89:	48 89 e5             	mov    %rsp,%rbp
+  802c8c:	53                   	push   %rbx
+  802c8d:	48 83 ec 08          	sub    $0x8,%rsp
+  802c91:	48 89 fa             	mov    %rdi,%rdx
+  802c94:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802c97:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ca6:	be 00 00 00 00       	mov    $0x0,%esi
+  802cab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cb7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cb9:	48 85 c0             	test   %rax,%rax
+  802cbc:	7f 06                	jg     802cc4 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802cbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc2:	c9                   	leave
+  802cc3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cc4:	49 89 c0             	mov    %rax,%r8
+  802cc7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ccc:	48 ba 48 61 80 00 00 	movabs $0x806148,%rdx
+  802cd3:	00 00 00 
+  802cd6:	be 27 00 00 00       	mov    $0x27,%esi
+  802cdb:	48 bf 67 61 80 00 00 	movabs $0x806167,%rdi
+  802ce2:	00 00 00 
+  802ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cea:	49 b9 8e 50 80 00 00 	movabs $0x80508e,%r9
+  802cf1:	00 00 00 
+  802cf4:	41 ff d1             	call   *%r9
+
+0000000000802cf7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802cf7:	55                   	push   %rbp
+  802cf8:	48 89 e5             	mov    %rsp,%rbp
+  802cfb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802cfc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d01:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d06:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d10:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d15:	be 00 00 00 00       	mov    $0x0,%esi
+  802d1a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d20:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d26:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2c:	c9                   	leave
+  802d2d:	c3                   	ret
+
+0000000000802d2e <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802d2e:	55                   	push   %rbp
+  802d2f:	48 89 e5             	mov    %rsp,%rbp
+  802d32:	53                   	push   %rbx
+  802d33:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d36:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d5b:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802d5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d61:	c9                   	leave
+  802d62:	c3                   	ret
+
+0000000000802d63 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802d63:	55                   	push   %rbp
+  802d64:	48 89 e5             	mov    %rsp,%rbp
+  802d67:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d68:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d81:	be 00 00 00 00       	mov    $0x0,%esi
+  802d86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d8c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d92:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802d94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+
+0000000000802d9a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802d9a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802da1:	ff ff ff 
+  802da4:	48 01 f8             	add    %rdi,%rax
+  802da7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802dab:	c3                   	ret
+
+0000000000802dac <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802dac:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802db3:	ff ff ff 
+  802db6:	48 01 f8             	add    %rdi,%rax
+  802db9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802dbd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802dc3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802dc7:	c3                   	ret
+
+0000000000802dc8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802dc8:	55                   	push   %rbp
+  802dc9:	48 89 e5             	mov    %rsp,%rbp
+  802dcc:	41 57                	push   %r15
+  802dce:	41 56                	push   %r14
+  802dd0:	41 55                	push   %r13
+  802dd2:	41 54                	push   %r12
+  802dd4:	53                   	push   %rbx
+  802dd5:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd9:	49 89 ff             	mov    %rdi,%r15
+  802ddc:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802de1:	49 bd c8 42 80 00 00 	movabs $0x8042c8,%r13
+  802de8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802deb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802df1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802df4:	48 89 df             	mov    %rbx,%rdi
+  802df7:	41 ff d5             	call   *%r13
+  802dfa:	83 e0 04             	and    $0x4,%eax
+  802dfd:	74 17                	je     802e16 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802dff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802e06:	4c 39 f3             	cmp    %r14,%rbx
+  802e09:	75 e6                	jne    802df1 <fd_alloc+0x29>
+  802e0b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802e11:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802e16:	4d 89 27             	mov    %r12,(%r15)
+}
+  802e19:	48 83 c4 08          	add    $0x8,%rsp
+  802e1d:	5b                   	pop    %rbx
+  802e1e:	41 5c                	pop    %r12
+  802e20:	41 5d                	pop    %r13
+  802e22:	41 5e                	pop    %r14
+  802e24:	41 5f                	pop    %r15
+  802e26:	5d                   	pop    %rbp
+  802e27:	c3                   	ret
+
+0000000000802e28 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802e28:	83 ff 1f             	cmp    $0x1f,%edi
+  802e2b:	77 39                	ja     802e66 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802e2d:	55                   	push   %rbp
+  802e2e:	48 89 e5             	mov    %rsp,%rbp
+  802e31:	41 54                	push   %r12
+  802e33:	53                   	push   %rbx
+  802e34:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802e37:	48 63 df             	movslq %edi,%rbx
+  802e3a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802e41:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802e45:	48 89 df             	mov    %rbx,%rdi
+  802e48:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+  802e54:	a8 04                	test   $0x4,%al
+  802e56:	74 14                	je     802e6c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802e58:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e61:	5b                   	pop    %rbx
+  802e62:	41 5c                	pop    %r12
+  802e64:	5d                   	pop    %rbp
+  802e65:	c3                   	ret
+        return -E_INVAL;
+  802e66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802e6b:	c3                   	ret
+        return -E_INVAL;
+  802e6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e71:	eb ee                	jmp    802e61 <fd_lookup+0x39>
+
+0000000000802e73 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e73:	55                   	push   %rbp
+  802e74:	48 89 e5             	mov    %rsp,%rbp
+  802e77:	41 54                	push   %r12
+  802e79:	53                   	push   %rbx
+  802e7a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802e7d:	48 b8 00 62 80 00 00 	movabs $0x806200,%rax
+  802e84:	00 00 00 
+  802e87:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802e8e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802e91:	39 3b                	cmp    %edi,(%rbx)
+  802e93:	74 47                	je     802edc <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802e95:	48 83 c0 08          	add    $0x8,%rax
+  802e99:	48 8b 18             	mov    (%rax),%rbx
+  802e9c:	48 85 db             	test   %rbx,%rbx
+  802e9f:	75 f0                	jne    802e91 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802ea1:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802ea8:	00 00 00 
+  802eab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802eb1:	89 fa                	mov    %edi,%edx
+  802eb3:	48 bf 78 61 80 00 00 	movabs $0x806178,%rdi
+  802eba:	00 00 00 
+  802ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec2:	48 b9 a0 16 80 00 00 	movabs $0x8016a0,%rcx
+  802ec9:	00 00 00 
+  802ecc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802ece:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802ed3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802ed7:	5b                   	pop    %rbx
+  802ed8:	41 5c                	pop    %r12
+  802eda:	5d                   	pop    %rbp
+  802edb:	c3                   	ret
+            return 0;
+  802edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ee1:	eb f0                	jmp    802ed3 <dev_lookup+0x60>
+
+0000000000802ee3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802ee3:	55                   	push   %rbp
+  802ee4:	48 89 e5             	mov    %rsp,%rbp
+  802ee7:	41 55                	push   %r13
+  802ee9:	41 54                	push   %r12
+  802eeb:	53                   	push   %rbx
+  802eec:	48 83 ec 18          	sub    $0x18,%rsp
+  802ef0:	48 89 fb             	mov    %rdi,%rbx
+  802ef3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ef6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802efd:	ff ff ff 
+  802f00:	48 01 df             	add    %rbx,%rdi
+  802f03:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802f07:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f0b:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	41 89 c5             	mov    %eax,%r13d
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	78 06                	js     802f24 <fd_close+0x41>
+  802f1e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802f22:	74 1a                	je     802f3e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802f24:	45 84 e4             	test   %r12b,%r12b
+  802f27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802f30:	44 89 e8             	mov    %r13d,%eax
+  802f33:	48 83 c4 18          	add    $0x18,%rsp
+  802f37:	5b                   	pop    %rbx
+  802f38:	41 5c                	pop    %r12
+  802f3a:	41 5d                	pop    %r13
+  802f3c:	5d                   	pop    %rbp
+  802f3d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f3e:	8b 3b                	mov    (%rbx),%edi
+  802f40:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802f44:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  802f50:	41 89 c5             	mov    %eax,%r13d
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	78 1b                	js     802f72 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802f57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f5b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f5f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802f65:	48 85 c0             	test   %rax,%rax
+  802f68:	74 08                	je     802f72 <fd_close+0x8f>
+  802f6a:	48 89 df             	mov    %rbx,%rdi
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802f72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f77:	48 89 de             	mov    %rbx,%rsi
+  802f7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7f:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  802f86:	00 00 00 
+  802f89:	ff d0                	call   *%rax
+    return res;
+  802f8b:	eb a3                	jmp    802f30 <fd_close+0x4d>
+
+0000000000802f8d <close>:
+
+int
+close(int fdnum) {
+  802f8d:	55                   	push   %rbp
+  802f8e:	48 89 e5             	mov    %rsp,%rbp
+  802f91:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802f95:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f99:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  802fa0:	00 00 00 
+  802fa3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa5:	85 c0                	test   %eax,%eax
+  802fa7:	78 15                	js     802fbe <close+0x31>
+
+    return fd_close(fd, 1);
+  802fa9:	be 01 00 00 00       	mov    $0x1,%esi
+  802fae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802fb2:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  802fb9:	00 00 00 
+  802fbc:	ff d0                	call   *%rax
+}
+  802fbe:	c9                   	leave
+  802fbf:	c3                   	ret
+
+0000000000802fc0 <close_all>:
+
+void
+close_all(void) {
+  802fc0:	55                   	push   %rbp
+  802fc1:	48 89 e5             	mov    %rsp,%rbp
+  802fc4:	41 54                	push   %r12
+  802fc6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802fc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fcc:	49 bc 8d 2f 80 00 00 	movabs $0x802f8d,%r12
+  802fd3:	00 00 00 
+  802fd6:	89 df                	mov    %ebx,%edi
+  802fd8:	41 ff d4             	call   *%r12
+  802fdb:	83 c3 01             	add    $0x1,%ebx
+  802fde:	83 fb 20             	cmp    $0x20,%ebx
+  802fe1:	75 f3                	jne    802fd6 <close_all+0x16>
+}
+  802fe3:	5b                   	pop    %rbx
+  802fe4:	41 5c                	pop    %r12
+  802fe6:	5d                   	pop    %rbp
+  802fe7:	c3                   	ret
+
+0000000000802fe8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802fe8:	55                   	push   %rbp
+  802fe9:	48 89 e5             	mov    %rsp,%rbp
+  802fec:	41 57                	push   %r15
+  802fee:	41 56                	push   %r14
+  802ff0:	41 55                	push   %r13
+  802ff2:	41 54                	push   %r12
+  802ff4:	53                   	push   %rbx
+  802ff5:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802ffc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803000:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+  80300c:	89 c3                	mov    %eax,%ebx
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	0f 88 b8 00 00 00    	js     8030ce <dup+0xe6>
+    close(newfdnum);
+  803016:	44 89 e7             	mov    %r12d,%edi
+  803019:	48 b8 8d 2f 80 00 00 	movabs $0x802f8d,%rax
+  803020:	00 00 00 
+  803023:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803025:	4d 63 ec             	movslq %r12d,%r13
+  803028:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80302f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803033:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803037:	4c 89 ff             	mov    %r15,%rdi
+  80303a:	49 be ac 2d 80 00 00 	movabs $0x802dac,%r14
+  803041:	00 00 00 
+  803044:	41 ff d6             	call   *%r14
+  803047:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80304a:	4c 89 ef             	mov    %r13,%rdi
+  80304d:	41 ff d6             	call   *%r14
+  803050:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803053:	48 89 df             	mov    %rbx,%rdi
+  803056:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  80305d:	00 00 00 
+  803060:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803062:	a8 04                	test   $0x4,%al
+  803064:	74 2b                	je     803091 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803066:	41 89 c1             	mov    %eax,%r9d
+  803069:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80306f:	4c 89 f1             	mov    %r14,%rcx
+  803072:	ba 00 00 00 00       	mov    $0x0,%edx
+  803077:	48 89 de             	mov    %rbx,%rsi
+  80307a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307f:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+  80308b:	89 c3                	mov    %eax,%ebx
+  80308d:	85 c0                	test   %eax,%eax
+  80308f:	78 4e                	js     8030df <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803091:	4c 89 ff             	mov    %r15,%rdi
+  803094:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+  8030a0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8030a3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8030a9:	4c 89 e9             	mov    %r13,%rcx
+  8030ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b1:	4c 89 fe             	mov    %r15,%rsi
+  8030b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b9:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+  8030c5:	89 c3                	mov    %eax,%ebx
+  8030c7:	85 c0                	test   %eax,%eax
+  8030c9:	78 14                	js     8030df <dup+0xf7>
+
+    return newfdnum;
+  8030cb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8030ce:	89 d8                	mov    %ebx,%eax
+  8030d0:	48 83 c4 18          	add    $0x18,%rsp
+  8030d4:	5b                   	pop    %rbx
+  8030d5:	41 5c                	pop    %r12
+  8030d7:	41 5d                	pop    %r13
+  8030d9:	41 5e                	pop    %r14
+  8030db:	41 5f                	pop    %r15
+  8030dd:	5d                   	pop    %rbp
+  8030de:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8030df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030e4:	4c 89 ee             	mov    %r13,%rsi
+  8030e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030ec:	49 bc 14 28 80 00 00 	movabs $0x802814,%r12
+  8030f3:	00 00 00 
+  8030f6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8030f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030fe:	4c 89 f6             	mov    %r14,%rsi
+  803101:	bf 00 00 00 00       	mov    $0x0,%edi
+  803106:	41 ff d4             	call   *%r12
+    return res;
+  803109:	eb c3                	jmp    8030ce <dup+0xe6>
+
+000000000080310b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80310b:	55                   	push   %rbp
+  80310c:	48 89 e5             	mov    %rsp,%rbp
+  80310f:	41 56                	push   %r14
+  803111:	41 55                	push   %r13
+  803113:	41 54                	push   %r12
+  803115:	53                   	push   %rbx
+  803116:	48 83 ec 10          	sub    $0x10,%rsp
+  80311a:	89 fb                	mov    %edi,%ebx
+  80311c:	49 89 f4             	mov    %rsi,%r12
+  80311f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803122:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803126:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  80312d:	00 00 00 
+  803130:	ff d0                	call   *%rax
+  803132:	85 c0                	test   %eax,%eax
+  803134:	78 4c                	js     803182 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803136:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80313a:	41 8b 3e             	mov    (%r14),%edi
+  80313d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803141:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  803148:	00 00 00 
+  80314b:	ff d0                	call   *%rax
+  80314d:	85 c0                	test   %eax,%eax
+  80314f:	78 35                	js     803186 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803151:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803155:	83 e0 03             	and    $0x3,%eax
+  803158:	83 f8 01             	cmp    $0x1,%eax
+  80315b:	74 2d                	je     80318a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80315d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803161:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803165:	48 85 c0             	test   %rax,%rax
+  803168:	74 56                	je     8031c0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80316a:	4c 89 ea             	mov    %r13,%rdx
+  80316d:	4c 89 e6             	mov    %r12,%rsi
+  803170:	4c 89 f7             	mov    %r14,%rdi
+  803173:	ff d0                	call   *%rax
+}
+  803175:	48 83 c4 10          	add    $0x10,%rsp
+  803179:	5b                   	pop    %rbx
+  80317a:	41 5c                	pop    %r12
+  80317c:	41 5d                	pop    %r13
+  80317e:	41 5e                	pop    %r14
+  803180:	5d                   	pop    %rbp
+  803181:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803182:	48 98                	cltq
+  803184:	eb ef                	jmp    803175 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803186:	48 98                	cltq
+  803188:	eb eb                	jmp    803175 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80318a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803191:	00 00 00 
+  803194:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80319a:	89 da                	mov    %ebx,%edx
+  80319c:	48 bf b9 61 80 00 00 	movabs $0x8061b9,%rdi
+  8031a3:	00 00 00 
+  8031a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ab:	48 b9 a0 16 80 00 00 	movabs $0x8016a0,%rcx
+  8031b2:	00 00 00 
+  8031b5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8031b7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8031be:	eb b5                	jmp    803175 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031c0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8031c7:	eb ac                	jmp    803175 <read+0x6a>
+
+00000000008031c9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8031c9:	55                   	push   %rbp
+  8031ca:	48 89 e5             	mov    %rsp,%rbp
+  8031cd:	41 57                	push   %r15
+  8031cf:	41 56                	push   %r14
+  8031d1:	41 55                	push   %r13
+  8031d3:	41 54                	push   %r12
+  8031d5:	53                   	push   %rbx
+  8031d6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8031da:	48 85 d2             	test   %rdx,%rdx
+  8031dd:	74 54                	je     803233 <readn+0x6a>
+  8031df:	41 89 fd             	mov    %edi,%r13d
+  8031e2:	49 89 f6             	mov    %rsi,%r14
+  8031e5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8031e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8031ed:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8031f2:	49 bf 0b 31 80 00 00 	movabs $0x80310b,%r15
+  8031f9:	00 00 00 
+  8031fc:	4c 89 e2             	mov    %r12,%rdx
+  8031ff:	48 29 f2             	sub    %rsi,%rdx
+  803202:	4c 01 f6             	add    %r14,%rsi
+  803205:	44 89 ef             	mov    %r13d,%edi
+  803208:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80320b:	85 c0                	test   %eax,%eax
+  80320d:	78 20                	js     80322f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80320f:	01 c3                	add    %eax,%ebx
+  803211:	85 c0                	test   %eax,%eax
+  803213:	74 08                	je     80321d <readn+0x54>
+  803215:	48 63 f3             	movslq %ebx,%rsi
+  803218:	4c 39 e6             	cmp    %r12,%rsi
+  80321b:	72 df                	jb     8031fc <readn+0x33>
+    }
+    return res;
+  80321d:	48 63 c3             	movslq %ebx,%rax
+}
+  803220:	48 83 c4 08          	add    $0x8,%rsp
+  803224:	5b                   	pop    %rbx
+  803225:	41 5c                	pop    %r12
+  803227:	41 5d                	pop    %r13
+  803229:	41 5e                	pop    %r14
+  80322b:	41 5f                	pop    %r15
+  80322d:	5d                   	pop    %rbp
+  80322e:	c3                   	ret
+        if (inc < 0) return inc;
+  80322f:	48 98                	cltq
+  803231:	eb ed                	jmp    803220 <readn+0x57>
+    int inc = 1, res = 0;
+  803233:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803238:	eb e3                	jmp    80321d <readn+0x54>
+
+000000000080323a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80323a:	55                   	push   %rbp
+  80323b:	48 89 e5             	mov    %rsp,%rbp
+  80323e:	41 56                	push   %r14
+  803240:	41 55                	push   %r13
+  803242:	41 54                	push   %r12
+  803244:	53                   	push   %rbx
+  803245:	48 83 ec 10          	sub    $0x10,%rsp
+  803249:	89 fb                	mov    %edi,%ebx
+  80324b:	49 89 f4             	mov    %rsi,%r12
+  80324e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803251:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803255:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  80325c:	00 00 00 
+  80325f:	ff d0                	call   *%rax
+  803261:	85 c0                	test   %eax,%eax
+  803263:	78 47                	js     8032ac <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803265:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803269:	41 8b 3e             	mov    (%r14),%edi
+  80326c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803270:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+  80327c:	85 c0                	test   %eax,%eax
+  80327e:	78 30                	js     8032b0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803280:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803285:	74 2d                	je     8032b4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803287:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80328b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80328f:	48 85 c0             	test   %rax,%rax
+  803292:	74 56                	je     8032ea <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803294:	4c 89 ea             	mov    %r13,%rdx
+  803297:	4c 89 e6             	mov    %r12,%rsi
+  80329a:	4c 89 f7             	mov    %r14,%rdi
+  80329d:	ff d0                	call   *%rax
+}
+  80329f:	48 83 c4 10          	add    $0x10,%rsp
+  8032a3:	5b                   	pop    %rbx
+  8032a4:	41 5c                	pop    %r12
+  8032a6:	41 5d                	pop    %r13
+  8032a8:	41 5e                	pop    %r14
+  8032aa:	5d                   	pop    %rbp
+  8032ab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032ac:	48 98                	cltq
+  8032ae:	eb ef                	jmp    80329f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032b0:	48 98                	cltq
+  8032b2:	eb eb                	jmp    80329f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8032b4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032bb:	00 00 00 
+  8032be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8032c4:	89 da                	mov    %ebx,%edx
+  8032c6:	48 bf d5 61 80 00 00 	movabs $0x8061d5,%rdi
+  8032cd:	00 00 00 
+  8032d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d5:	48 b9 a0 16 80 00 00 	movabs $0x8016a0,%rcx
+  8032dc:	00 00 00 
+  8032df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032e1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032e8:	eb b5                	jmp    80329f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8032ea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032f1:	eb ac                	jmp    80329f <write+0x65>
+
+00000000008032f3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8032f3:	55                   	push   %rbp
+  8032f4:	48 89 e5             	mov    %rsp,%rbp
+  8032f7:	53                   	push   %rbx
+  8032f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8032fc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032fe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803302:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	78 0c                	js     80331e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803312:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803316:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803319:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803322:	c9                   	leave
+  803323:	c3                   	ret
+
+0000000000803324 <tell>:
+
+int tell(int fdnum) {
+  803324:	55                   	push   %rbp
+  803325:	48 89 e5             	mov    %rsp,%rbp
+  803328:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80332c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803330:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803337:	00 00 00 
+  80333a:	ff d0                	call   *%rax
+  80333c:	85 c0                	test   %eax,%eax
+  80333e:	78 07                	js     803347 <tell+0x23>
+
+    return fd->fd_offset;
+  803340:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803344:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803347:	c9                   	leave
+  803348:	c3                   	ret
+
+0000000000803349 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803349:	55                   	push   %rbp
+  80334a:	48 89 e5             	mov    %rsp,%rbp
+  80334d:	41 55                	push   %r13
+  80334f:	41 54                	push   %r12
+  803351:	53                   	push   %rbx
+  803352:	48 83 ec 18          	sub    $0x18,%rsp
+  803356:	89 fb                	mov    %edi,%ebx
+  803358:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80335b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80335f:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803366:	00 00 00 
+  803369:	ff d0                	call   *%rax
+  80336b:	85 c0                	test   %eax,%eax
+  80336d:	78 38                	js     8033a7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80336f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803373:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803377:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80337b:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+  803387:	85 c0                	test   %eax,%eax
+  803389:	78 1c                	js     8033a7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80338b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803390:	74 20                	je     8033b2 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803392:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803396:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80339a:	48 85 c0             	test   %rax,%rax
+  80339d:	74 47                	je     8033e6 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80339f:	44 89 e6             	mov    %r12d,%esi
+  8033a2:	4c 89 ef             	mov    %r13,%rdi
+  8033a5:	ff d0                	call   *%rax
+}
+  8033a7:	48 83 c4 18          	add    $0x18,%rsp
+  8033ab:	5b                   	pop    %rbx
+  8033ac:	41 5c                	pop    %r12
+  8033ae:	41 5d                	pop    %r13
+  8033b0:	5d                   	pop    %rbp
+  8033b1:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8033b2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033b9:	00 00 00 
+  8033bc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8033c2:	89 da                	mov    %ebx,%edx
+  8033c4:	48 bf 98 61 80 00 00 	movabs $0x806198,%rdi
+  8033cb:	00 00 00 
+  8033ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d3:	48 b9 a0 16 80 00 00 	movabs $0x8016a0,%rcx
+  8033da:	00 00 00 
+  8033dd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e4:	eb c1                	jmp    8033a7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8033e6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8033eb:	eb ba                	jmp    8033a7 <ftruncate+0x5e>
+
+00000000008033ed <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8033ed:	55                   	push   %rbp
+  8033ee:	48 89 e5             	mov    %rsp,%rbp
+  8033f1:	41 54                	push   %r12
+  8033f3:	53                   	push   %rbx
+  8033f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8033f8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033fb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033ff:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+  80340b:	85 c0                	test   %eax,%eax
+  80340d:	78 63                	js     803472 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80340f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803413:	41 8b 3c 24          	mov    (%r12),%edi
+  803417:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80341b:	48 b8 73 2e 80 00 00 	movabs $0x802e73,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+  803427:	85 c0                	test   %eax,%eax
+  803429:	78 47                	js     803472 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80342b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80342f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803434:	74 45                	je     80347b <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803436:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803439:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803440:	00 00 00 
+    stat->st_isdir = 0;
+  803443:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80344a:	00 00 00 
+    stat->st_ino = 0;
+  80344d:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803454:	00 00 00 00 
+    stat->st_version = 0;
+  803458:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80345f:	00 00 00 
+    stat->st_dev = dev;
+  803462:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803469:	48 89 de             	mov    %rbx,%rsi
+  80346c:	4c 89 e7             	mov    %r12,%rdi
+  80346f:	ff 50 28             	call   *0x28(%rax)
+}
+  803472:	48 83 c4 10          	add    $0x10,%rsp
+  803476:	5b                   	pop    %rbx
+  803477:	41 5c                	pop    %r12
+  803479:	5d                   	pop    %rbp
+  80347a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80347b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803480:	eb f0                	jmp    803472 <fstat+0x85>
+
+0000000000803482 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803482:	55                   	push   %rbp
+  803483:	48 89 e5             	mov    %rsp,%rbp
+  803486:	41 54                	push   %r12
+  803488:	53                   	push   %rbx
+  803489:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80348c:	be 00 00 00 00       	mov    $0x0,%esi
+  803491:	48 b8 a3 39 80 00 00 	movabs $0x8039a3,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80349f:	85 c0                	test   %eax,%eax
+  8034a1:	78 25                	js     8034c8 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8034a3:	4c 89 e6             	mov    %r12,%rsi
+  8034a6:	89 c7                	mov    %eax,%edi
+  8034a8:	48 b8 ed 33 80 00 00 	movabs $0x8033ed,%rax
+  8034af:	00 00 00 
+  8034b2:	ff d0                	call   *%rax
+  8034b4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8034b7:	89 df                	mov    %ebx,%edi
+  8034b9:	48 b8 8d 2f 80 00 00 	movabs $0x802f8d,%rax
+  8034c0:	00 00 00 
+  8034c3:	ff d0                	call   *%rax
+
+    return res;
+  8034c5:	44 89 e3             	mov    %r12d,%ebx
+}
+  8034c8:	89 d8                	mov    %ebx,%eax
+  8034ca:	5b                   	pop    %rbx
+  8034cb:	41 5c                	pop    %r12
+  8034cd:	5d                   	pop    %rbp
+  8034ce:	c3                   	ret
+
+00000000008034cf <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034cf:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8034d6:	00 00 00 
+  8034d9:	83 38 00             	cmpl   $0x0,(%rax)
+  8034dc:	74 0a                	je     8034e8 <fsipc_env+0x19>
+    return fsenv;
+}
+  8034de:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8034e5:	00 00 
+  8034e7:	c3                   	ret
+fsipc_env(void) {
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8034ec:	bf 03 00 00 00       	mov    $0x3,%edi
+  8034f1:	48 b8 75 56 80 00 00 	movabs $0x805675,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803504:	00 00 
+}
+  803506:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80350d:	00 00 
+  80350f:	5d                   	pop    %rbp
+  803510:	c3                   	ret
+
+0000000000803511 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803511:	55                   	push   %rbp
+  803512:	48 89 e5             	mov    %rsp,%rbp
+  803515:	53                   	push   %rbx
+  803516:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80351a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803521:	00 
+  803522:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803529:	00 
+  80352a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803531:	00 
+  803532:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803539:	00 
+  80353a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803541:	00 
+
+    assert(size <= sizeof(words));
+  803542:	48 83 fa 28          	cmp    $0x28,%rdx
+  803546:	77 38                	ja     803580 <fsipc_short+0x6f>
+  803548:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80354a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80354e:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  803555:	00 00 00 
+  803558:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80355a:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  803561:	00 00 00 
+  803564:	ff d0                	call   *%rax
+  803566:	89 c7                	mov    %eax,%edi
+  803568:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80356c:	89 de                	mov    %ebx,%esi
+  80356e:	48 b8 d8 55 80 00 00 	movabs $0x8055d8,%rax
+  803575:	00 00 00 
+  803578:	ff d0                	call   *%rax
+}
+  80357a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80357e:	c9                   	leave
+  80357f:	c3                   	ret
+    assert(size <= sizeof(words));
+  803580:	48 b9 20 62 80 00 00 	movabs $0x806220,%rcx
+  803587:	00 00 00 
+  80358a:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803591:	00 00 00 
+  803594:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803599:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8035a0:	00 00 00 
+  8035a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a8:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  8035af:	00 00 00 
+  8035b2:	41 ff d0             	call   *%r8
+
+00000000008035b5 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8035b5:	55                   	push   %rbp
+  8035b6:	48 89 e5             	mov    %rsp,%rbp
+  8035b9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8035bd:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035c0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8035c3:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8035c6:	ba 08 00 00 00       	mov    $0x8,%edx
+  8035cb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8035cf:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035d4:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  8035db:	00 00 00 
+  8035de:	ff d0                	call   *%rax
+}
+  8035e0:	c9                   	leave
+  8035e1:	c3                   	ret
+
+00000000008035e2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8035e2:	55                   	push   %rbp
+  8035e3:	48 89 e5             	mov    %rsp,%rbp
+  8035e6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8035ea:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8035ed:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8035f0:	ba 04 00 00 00       	mov    $0x4,%edx
+  8035f5:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8035f9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8035fe:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+}
+  80360a:	c9                   	leave
+  80360b:	c3                   	ret
+
+000000000080360c <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80360c:	55                   	push   %rbp
+  80360d:	48 89 e5             	mov    %rsp,%rbp
+  803610:	41 54                	push   %r12
+  803612:	53                   	push   %rbx
+  803613:	48 83 ec 10          	sub    $0x10,%rsp
+  803617:	89 fb                	mov    %edi,%ebx
+  803619:	49 89 f4             	mov    %rsi,%r12
+  80361c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803620:	48 b8 cf 34 80 00 00 	movabs $0x8034cf,%rax
+  803627:	00 00 00 
+  80362a:	ff d0                	call   *%rax
+  80362c:	89 c7                	mov    %eax,%edi
+  80362e:	6a 00                	push   $0x0
+  803630:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803634:	50                   	push   %rax
+  803635:	4d 89 e1             	mov    %r12,%r9
+  803638:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80363e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803643:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80364a:	00 00 00 
+  80364d:	89 de                	mov    %ebx,%esi
+  80364f:	48 b8 73 55 80 00 00 	movabs $0x805573,%rax
+  803656:	00 00 00 
+  803659:	ff d0                	call   *%rax
+}
+  80365b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80365f:	5b                   	pop    %rbx
+  803660:	41 5c                	pop    %r12
+  803662:	5d                   	pop    %rbp
+  803663:	c3                   	ret
+
+0000000000803664 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803664:	55                   	push   %rbp
+  803665:	48 89 e5             	mov    %rsp,%rbp
+  803668:	41 54                	push   %r12
+  80366a:	53                   	push   %rbx
+  80366b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80366e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803671:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803678:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80367a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80367f:	be 00 00 00 00       	mov    $0x0,%esi
+  803684:	bf 05 00 00 00       	mov    $0x5,%edi
+  803689:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803695:	85 c0                	test   %eax,%eax
+  803697:	78 5a                	js     8036f3 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803699:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8036a0:	00 00 00 
+  8036a3:	4c 89 e6             	mov    %r12,%rsi
+  8036a6:	48 89 df             	mov    %rbx,%rdi
+  8036a9:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  8036b0:	00 00 00 
+  8036b3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8036b5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8036bc:	00 
+  8036bd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8036c3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8036ca:	00 
+  8036cb:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8036d1:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8036d8:	00 
+  8036d9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8036e0:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8036e7:	00 
+  8036e8:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8036ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036f3:	5b                   	pop    %rbx
+  8036f4:	41 5c                	pop    %r12
+  8036f6:	5d                   	pop    %rbp
+  8036f7:	c3                   	ret
+
+00000000008036f8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8036f8:	55                   	push   %rbp
+  8036f9:	48 89 e5             	mov    %rsp,%rbp
+  8036fc:	41 57                	push   %r15
+  8036fe:	41 56                	push   %r14
+  803700:	41 55                	push   %r13
+  803702:	41 54                	push   %r12
+  803704:	53                   	push   %rbx
+  803705:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803709:	48 85 ff             	test   %rdi,%rdi
+  80370c:	0f 84 a1 00 00 00    	je     8037b3 <devfile_read+0xbb>
+  803712:	49 89 ff             	mov    %rdi,%r15
+  803715:	49 89 f5             	mov    %rsi,%r13
+  803718:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80371b:	48 85 f6             	test   %rsi,%rsi
+  80371e:	0f 84 c4 00 00 00    	je     8037e8 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803724:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80372b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80372c:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803733:	00 00 00 
+  803736:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80373a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80373d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803741:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803746:	be 00 00 00 00       	mov    $0x0,%esi
+  80374b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803750:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  803757:	00 00 00 
+  80375a:	ff d0                	call   *%rax
+        if (res < 0) {
+  80375c:	85 c0                	test   %eax,%eax
+  80375e:	0f 88 b9 00 00 00    	js     80381d <devfile_read+0x125>
+        assert(res <= n);
+  803764:	48 63 d8             	movslq %eax,%rbx
+  803767:	49 39 dc             	cmp    %rbx,%r12
+  80376a:	0f 82 b1 00 00 00    	jb     803821 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803770:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803775:	0f 87 db 00 00 00    	ja     803856 <devfile_read+0x15e>
+        if (!res) {
+  80377b:	85 c0                	test   %eax,%eax
+  80377d:	74 21                	je     8037a0 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80377f:	48 89 da             	mov    %rbx,%rdx
+  803782:	4c 89 f6             	mov    %r14,%rsi
+  803785:	4c 89 ef             	mov    %r13,%rdi
+  803788:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  80378f:	00 00 00 
+  803792:	ff d0                	call   *%rax
+        total_read += res;
+  803794:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803798:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80379b:	49 29 dc             	sub    %rbx,%r12
+  80379e:	75 96                	jne    803736 <devfile_read+0x3e>
+    return total_read;
+  8037a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8037a4:	48 83 c4 18          	add    $0x18,%rsp
+  8037a8:	5b                   	pop    %rbx
+  8037a9:	41 5c                	pop    %r12
+  8037ab:	41 5d                	pop    %r13
+  8037ad:	41 5e                	pop    %r14
+  8037af:	41 5f                	pop    %r15
+  8037b1:	5d                   	pop    %rbp
+  8037b2:	c3                   	ret
+    assert(fd);
+  8037b3:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  8037ba:	00 00 00 
+  8037bd:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037c4:	00 00 00 
+  8037c7:	be 91 00 00 00       	mov    $0x91,%esi
+  8037cc:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  8037d3:	00 00 00 
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  8037e2:	00 00 00 
+  8037e5:	41 ff d0             	call   *%r8
+    assert(buf);
+  8037e8:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  8037ef:	00 00 00 
+  8037f2:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  8037f9:	00 00 00 
+  8037fc:	be 92 00 00 00       	mov    $0x92,%esi
+  803801:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803808:	00 00 00 
+  80380b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803810:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  803817:	00 00 00 
+  80381a:	41 ff d0             	call   *%r8
+            return res;
+  80381d:	48 98                	cltq
+  80381f:	eb 83                	jmp    8037a4 <devfile_read+0xac>
+        assert(res <= n);
+  803821:	48 b9 5d 62 80 00 00 	movabs $0x80625d,%rcx
+  803828:	00 00 00 
+  80382b:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803832:	00 00 00 
+  803835:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80383a:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803841:	00 00 00 
+  803844:	b8 00 00 00 00       	mov    $0x0,%eax
+  803849:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  803850:	00 00 00 
+  803853:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803856:	48 b9 68 62 80 00 00 	movabs $0x806268,%rcx
+  80385d:	00 00 00 
+  803860:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803867:	00 00 00 
+  80386a:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80386f:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803876:	00 00 00 
+  803879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387e:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  803885:	00 00 00 
+  803888:	41 ff d0             	call   *%r8
+
+000000000080388b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80388b:	55                   	push   %rbp
+  80388c:	48 89 e5             	mov    %rsp,%rbp
+  80388f:	41 57                	push   %r15
+  803891:	41 56                	push   %r14
+  803893:	41 55                	push   %r13
+  803895:	41 54                	push   %r12
+  803897:	53                   	push   %rbx
+  803898:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80389c:	48 85 ff             	test   %rdi,%rdi
+  80389f:	0f 84 83 00 00 00    	je     803928 <devfile_write+0x9d>
+  8038a5:	49 89 ff             	mov    %rdi,%r15
+  8038a8:	49 89 f4             	mov    %rsi,%r12
+  8038ab:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8038ae:	48 85 f6             	test   %rsi,%rsi
+  8038b1:	0f 84 a6 00 00 00    	je     80395d <devfile_write+0xd2>
+    size_t total_written = 0;
+  8038b7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8038bd:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8038c4:	00 00 00 
+  8038c7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038cb:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8038ce:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8038d2:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8038d7:	48 39 d3             	cmp    %rdx,%rbx
+  8038da:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8038de:	4c 89 e6             	mov    %r12,%rsi
+  8038e1:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8038e8:	00 00 00 
+  8038eb:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803901:	bf 04 00 00 00       	mov    $0x4,%edi
+  803906:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  80390d:	00 00 00 
+  803910:	ff d0                	call   *%rax
+        if (res < 0) {
+  803912:	85 c0                	test   %eax,%eax
+  803914:	78 7c                	js     803992 <devfile_write+0x107>
+        total_written += res;
+  803916:	48 98                	cltq
+  803918:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  80391b:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  80391e:	48 29 c3             	sub    %rax,%rbx
+  803921:	75 a4                	jne    8038c7 <devfile_write+0x3c>
+    return total_written;
+  803923:	4c 89 e8             	mov    %r13,%rax
+  803926:	eb 6c                	jmp    803994 <devfile_write+0x109>
+    assert(fd);
+  803928:	48 b9 56 62 80 00 00 	movabs $0x806256,%rcx
+  80392f:	00 00 00 
+  803932:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  803939:	00 00 00 
+  80393c:	be bd 00 00 00       	mov    $0xbd,%esi
+  803941:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  803948:	00 00 00 
+  80394b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803950:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  803957:	00 00 00 
+  80395a:	41 ff d0             	call   *%r8
+    assert(buf);
+  80395d:	48 b9 59 62 80 00 00 	movabs $0x806259,%rcx
+  803964:	00 00 00 
+  803967:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80396e:	00 00 00 
+  803971:	be be 00 00 00       	mov    $0xbe,%esi
+  803976:	48 bf 4b 62 80 00 00 	movabs $0x80624b,%rdi
+  80397d:	00 00 00 
+  803980:	b8 00 00 00 00       	mov    $0x0,%eax
+  803985:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  80398c:	00 00 00 
+  80398f:	41 ff d0             	call   *%r8
+            return res;
+  803992:	48 98                	cltq
+}
+  803994:	48 83 c4 08          	add    $0x8,%rsp
+  803998:	5b                   	pop    %rbx
+  803999:	41 5c                	pop    %r12
+  80399b:	41 5d                	pop    %r13
+  80399d:	41 5e                	pop    %r14
+  80399f:	41 5f                	pop    %r15
+  8039a1:	5d                   	pop    %rbp
+  8039a2:	c3                   	ret
+
+00000000008039a3 <open>:
+open(const char *path, int mode) {
+  8039a3:	55                   	push   %rbp
+  8039a4:	48 89 e5             	mov    %rsp,%rbp
+  8039a7:	41 55                	push   %r13
+  8039a9:	41 54                	push   %r12
+  8039ab:	53                   	push   %rbx
+  8039ac:	48 83 ec 18          	sub    $0x18,%rsp
+  8039b0:	49 89 fc             	mov    %rdi,%r12
+  8039b3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8039b6:	48 b8 99 1f 80 00 00 	movabs $0x801f99,%rax
+  8039bd:	00 00 00 
+  8039c0:	ff d0                	call   *%rax
+  8039c2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8039c8:	0f 87 8f 00 00 00    	ja     803a5d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8039ce:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039d2:	48 b8 c8 2d 80 00 00 	movabs $0x802dc8,%rax
+  8039d9:	00 00 00 
+  8039dc:	ff d0                	call   *%rax
+  8039de:	89 c3                	mov    %eax,%ebx
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	78 55                	js     803a39 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8039e4:	4c 89 e6             	mov    %r12,%rsi
+  8039e7:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8039ee:	00 00 00 
+  8039f1:	48 89 df             	mov    %rbx,%rdi
+  8039f4:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  8039fb:	00 00 00 
+  8039fe:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a00:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a0c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a10:	bf 01 00 00 00       	mov    $0x1,%edi
+  803a15:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  803a1c:	00 00 00 
+  803a1f:	ff d0                	call   *%rax
+  803a21:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803a23:	85 c0                	test   %eax,%eax
+  803a25:	78 1f                	js     803a46 <open+0xa3>
+    return fd2num(fd);
+  803a27:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a2b:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  803a32:	00 00 00 
+  803a35:	ff d0                	call   *%rax
+  803a37:	89 c3                	mov    %eax,%ebx
+}
+  803a39:	89 d8                	mov    %ebx,%eax
+  803a3b:	48 83 c4 18          	add    $0x18,%rsp
+  803a3f:	5b                   	pop    %rbx
+  803a40:	41 5c                	pop    %r12
+  803a42:	41 5d                	pop    %r13
+  803a44:	5d                   	pop    %rbp
+  803a45:	c3                   	ret
+        fd_close(fd, 0);
+  803a46:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a4f:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  803a56:	00 00 00 
+  803a59:	ff d0                	call   *%rax
+        return res;
+  803a5b:	eb dc                	jmp    803a39 <open+0x96>
+        return -E_BAD_PATH;
+  803a5d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803a62:	eb d5                	jmp    803a39 <open+0x96>
+
+0000000000803a64 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803a64:	55                   	push   %rbp
+  803a65:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a72:	bf 08 00 00 00       	mov    $0x8,%edi
+  803a77:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  803a7e:	00 00 00 
+  803a81:	ff d0                	call   *%rax
+}
+  803a83:	5d                   	pop    %rbp
+  803a84:	c3                   	ret
+
+0000000000803a85 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803a85:	55                   	push   %rbp
+  803a86:	48 89 e5             	mov    %rsp,%rbp
+  803a89:	41 56                	push   %r14
+  803a8b:	41 55                	push   %r13
+  803a8d:	41 54                	push   %r12
+  803a8f:	53                   	push   %rbx
+  803a90:	48 83 ec 10          	sub    $0x10,%rsp
+  803a94:	41 89 f6             	mov    %esi,%r14d
+  803a97:	49 89 d4             	mov    %rdx,%r12
+  803a9a:	48 89 cb             	mov    %rcx,%rbx
+  803a9d:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803aa0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aa4:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803aab:	00 00 00 
+  803aae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ab0:	85 c0                	test   %eax,%eax
+  803ab2:	78 46                	js     803afa <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ab4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ab8:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803abf:	00 00 00 
+  803ac2:	8b 00                	mov    (%rax),%eax
+  803ac4:	39 02                	cmp    %eax,(%rdx)
+  803ac6:	75 3f                	jne    803b07 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803ac8:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803acf:	00 00 00 
+  803ad2:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803ad5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ad7:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803adb:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803adf:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ae3:	48 89 da             	mov    %rbx,%rdx
+  803ae6:	4c 89 e6             	mov    %r12,%rsi
+  803ae9:	bf 09 00 00 00       	mov    $0x9,%edi
+  803aee:	48 b8 0c 36 80 00 00 	movabs $0x80360c,%rax
+  803af5:	00 00 00 
+  803af8:	ff d0                	call   *%rax
+}
+  803afa:	48 83 c4 10          	add    $0x10,%rsp
+  803afe:	5b                   	pop    %rbx
+  803aff:	41 5c                	pop    %r12
+  803b01:	41 5d                	pop    %r13
+  803b03:	41 5e                	pop    %r14
+  803b05:	5d                   	pop    %rbp
+  803b06:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b07:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b0c:	eb ec                	jmp    803afa <file_map+0x75>
+
+0000000000803b0e <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803b0e:	55                   	push   %rbp
+  803b0f:	48 89 e5             	mov    %rsp,%rbp
+  803b12:	41 54                	push   %r12
+  803b14:	53                   	push   %rbx
+  803b15:	48 83 ec 20          	sub    $0x20,%rsp
+  803b19:	41 89 f4             	mov    %esi,%r12d
+  803b1c:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b1f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803b23:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  803b2a:	00 00 00 
+  803b2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b2f:	85 c0                	test   %eax,%eax
+  803b31:	78 3c                	js     803b6f <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b37:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803b3e:	00 00 00 
+  803b41:	8b 0a                	mov    (%rdx),%ecx
+  803b43:	39 08                	cmp    %ecx,(%rax)
+  803b45:	75 31                	jne    803b78 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803b47:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b4a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803b4d:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803b51:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803b55:	ba 10 00 00 00       	mov    $0x10,%edx
+  803b5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b5e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803b63:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  803b6a:	00 00 00 
+  803b6d:	ff d0                	call   *%rax
+}
+  803b6f:	48 83 c4 20          	add    $0x20,%rsp
+  803b73:	5b                   	pop    %rbx
+  803b74:	41 5c                	pop    %r12
+  803b76:	5d                   	pop    %rbp
+  803b77:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b78:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b7d:	eb f0                	jmp    803b6f <file_msync+0x61>
+
+0000000000803b7f <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b7f:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b83:	7f 01                	jg     803b86 <writebuf+0x7>
+  803b85:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b86:	55                   	push   %rbp
+  803b87:	48 89 e5             	mov    %rsp,%rbp
+  803b8a:	53                   	push   %rbx
+  803b8b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8f:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b92:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803b96:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803b9a:	8b 3f                	mov    (%rdi),%edi
+  803b9c:	48 b8 3a 32 80 00 00 	movabs $0x80323a,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803ba8:	48 85 c0             	test   %rax,%rax
+  803bab:	7e 04                	jle    803bb1 <writebuf+0x32>
+  803bad:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bb1:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bb5:	48 39 c2             	cmp    %rax,%rdx
+  803bb8:	74 0f                	je     803bc9 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bba:	48 85 c0             	test   %rax,%rax
+  803bbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc2:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bc6:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bcd:	c9                   	leave
+  803bce:	c3                   	ret
+
+0000000000803bcf <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bcf:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bd2:	8d 50 01             	lea    0x1(%rax),%edx
+  803bd5:	89 56 04             	mov    %edx,0x4(%rsi)
+  803bd8:	48 98                	cltq
+  803bda:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803bdf:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803be5:	74 01                	je     803be8 <putch+0x19>
+  803be7:	c3                   	ret
+putch(int ch, void *arg) {
+  803be8:	55                   	push   %rbp
+  803be9:	48 89 e5             	mov    %rsp,%rbp
+  803bec:	53                   	push   %rbx
+  803bed:	48 83 ec 08          	sub    $0x8,%rsp
+  803bf1:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803bf4:	48 89 f7             	mov    %rsi,%rdi
+  803bf7:	48 b8 7f 3b 80 00 00 	movabs $0x803b7f,%rax
+  803bfe:	00 00 00 
+  803c01:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c03:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c0e:	c9                   	leave
+  803c0f:	c3                   	ret
+
+0000000000803c10 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c10:	55                   	push   %rbp
+  803c11:	48 89 e5             	mov    %rsp,%rbp
+  803c14:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c1b:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c1e:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c24:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c2b:	00 00 00 
+    state.result = 0;
+  803c2e:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c35:	00 00 00 00 
+    state.error = 1;
+  803c39:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c40:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c43:	48 89 f2             	mov    %rsi,%rdx
+  803c46:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c4d:	48 bf cf 3b 80 00 00 	movabs $0x803bcf,%rdi
+  803c54:	00 00 00 
+  803c57:	48 b8 f0 17 80 00 00 	movabs $0x8017f0,%rax
+  803c5e:	00 00 00 
+  803c61:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c63:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c6a:	7f 14                	jg     803c80 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c6c:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c73:	48 85 c0             	test   %rax,%rax
+  803c76:	75 06                	jne    803c7e <vfprintf+0x6e>
+  803c78:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c7e:	c9                   	leave
+  803c7f:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c80:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c87:	48 b8 7f 3b 80 00 00 	movabs $0x803b7f,%rax
+  803c8e:	00 00 00 
+  803c91:	ff d0                	call   *%rax
+  803c93:	eb d7                	jmp    803c6c <vfprintf+0x5c>
+
+0000000000803c95 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803c95:	55                   	push   %rbp
+  803c96:	48 89 e5             	mov    %rsp,%rbp
+  803c99:	48 83 ec 50          	sub    $0x50,%rsp
+  803c9d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ca1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ca5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ca9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cad:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cb4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803cc0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cc4:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cc8:	48 b8 10 3c 80 00 00 	movabs $0x803c10,%rax
+  803ccf:	00 00 00 
+  803cd2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803cd4:	c9                   	leave
+  803cd5:	c3                   	ret
+
+0000000000803cd6 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803cd6:	55                   	push   %rbp
+  803cd7:	48 89 e5             	mov    %rsp,%rbp
+  803cda:	48 83 ec 50          	sub    $0x50,%rsp
+  803cde:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803ce2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ce6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cf2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803cf9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d01:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d05:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d09:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d0d:	48 89 fe             	mov    %rdi,%rsi
+  803d10:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d15:	48 b8 10 3c 80 00 00 	movabs $0x803c10,%rax
+  803d1c:	00 00 00 
+  803d1f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d21:	c9                   	leave
+  803d22:	c3                   	ret
+
+0000000000803d23 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d23:	55                   	push   %rbp
+  803d24:	48 89 e5             	mov    %rsp,%rbp
+  803d27:	41 54                	push   %r12
+  803d29:	53                   	push   %rbx
+  803d2a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d2d:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  803d34:	00 00 00 
+  803d37:	ff d0                	call   *%rax
+  803d39:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d3c:	48 be 90 62 80 00 00 	movabs $0x806290,%rsi
+  803d43:	00 00 00 
+  803d46:	48 89 df             	mov    %rbx,%rdi
+  803d49:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  803d50:	00 00 00 
+  803d53:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d55:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d5a:	41 2b 04 24          	sub    (%r12),%eax
+  803d5e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d64:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d6b:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d6e:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803d75:	00 00 00 
+  803d78:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d84:	5b                   	pop    %rbx
+  803d85:	41 5c                	pop    %r12
+  803d87:	5d                   	pop    %rbp
+  803d88:	c3                   	ret
+
+0000000000803d89 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d89:	55                   	push   %rbp
+  803d8a:	48 89 e5             	mov    %rsp,%rbp
+  803d8d:	41 54                	push   %r12
+  803d8f:	53                   	push   %rbx
+  803d90:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803d93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d98:	48 89 fe             	mov    %rdi,%rsi
+  803d9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803da0:	49 bc 14 28 80 00 00 	movabs $0x802814,%r12
+  803da7:	00 00 00 
+  803daa:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803dad:	48 89 df             	mov    %rbx,%rdi
+  803db0:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  803db7:	00 00 00 
+  803dba:	ff d0                	call   *%rax
+  803dbc:	48 89 c6             	mov    %rax,%rsi
+  803dbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc9:	41 ff d4             	call   *%r12
+}
+  803dcc:	5b                   	pop    %rbx
+  803dcd:	41 5c                	pop    %r12
+  803dcf:	5d                   	pop    %rbp
+  803dd0:	c3                   	ret
+
+0000000000803dd1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803dd1:	55                   	push   %rbp
+  803dd2:	48 89 e5             	mov    %rsp,%rbp
+  803dd5:	41 57                	push   %r15
+  803dd7:	41 56                	push   %r14
+  803dd9:	41 55                	push   %r13
+  803ddb:	41 54                	push   %r12
+  803ddd:	53                   	push   %rbx
+  803dde:	48 83 ec 18          	sub    $0x18,%rsp
+  803de2:	49 89 fc             	mov    %rdi,%r12
+  803de5:	49 89 f5             	mov    %rsi,%r13
+  803de8:	49 89 d7             	mov    %rdx,%r15
+  803deb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803def:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  803df6:	00 00 00 
+  803df9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803dfb:	4d 85 ff             	test   %r15,%r15
+  803dfe:	0f 84 af 00 00 00    	je     803eb3 <devpipe_write+0xe2>
+  803e04:	48 89 c3             	mov    %rax,%rbx
+  803e07:	4c 89 f8             	mov    %r15,%rax
+  803e0a:	4d 89 ef             	mov    %r13,%r15
+  803e0d:	4c 01 e8             	add    %r13,%rax
+  803e10:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e14:	49 bd 0a 27 80 00 00 	movabs $0x80270a,%r13
+  803e1b:	00 00 00 
+            sys_yield();
+  803e1e:	49 be 9b 26 80 00 00 	movabs $0x80269b,%r14
+  803e25:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e28:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e2b:	48 63 ce             	movslq %esi,%rcx
+  803e2e:	48 63 03             	movslq (%rbx),%rax
+  803e31:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e37:	48 39 c1             	cmp    %rax,%rcx
+  803e3a:	72 2e                	jb     803e6a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e3c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e41:	48 89 da             	mov    %rbx,%rdx
+  803e44:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e49:	4c 89 e7             	mov    %r12,%rdi
+  803e4c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	74 66                	je     803eb9 <devpipe_write+0xe8>
+            sys_yield();
+  803e53:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e56:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e59:	48 63 ce             	movslq %esi,%rcx
+  803e5c:	48 63 03             	movslq (%rbx),%rax
+  803e5f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803e65:	48 39 c1             	cmp    %rax,%rcx
+  803e68:	73 d2                	jae    803e3c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e6a:	41 0f b6 3f          	movzbl (%r15),%edi
+  803e6e:	48 89 ca             	mov    %rcx,%rdx
+  803e71:	48 c1 ea 03          	shr    $0x3,%rdx
+  803e75:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803e7c:	08 10 20 
+  803e7f:	48 f7 e2             	mul    %rdx
+  803e82:	48 c1 ea 06          	shr    $0x6,%rdx
+  803e86:	48 89 d0             	mov    %rdx,%rax
+  803e89:	48 c1 e0 09          	shl    $0x9,%rax
+  803e8d:	48 29 d0             	sub    %rdx,%rax
+  803e90:	48 c1 e0 03          	shl    $0x3,%rax
+  803e94:	48 29 c1             	sub    %rax,%rcx
+  803e97:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e9c:	83 c6 01             	add    $0x1,%esi
+  803e9f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ea2:	49 83 c7 01          	add    $0x1,%r15
+  803ea6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eaa:	49 39 c7             	cmp    %rax,%r15
+  803ead:	0f 85 75 ff ff ff    	jne    803e28 <devpipe_write+0x57>
+    return n;
+  803eb3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb7:	eb 05                	jmp    803ebe <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebe:	48 83 c4 18          	add    $0x18,%rsp
+  803ec2:	5b                   	pop    %rbx
+  803ec3:	41 5c                	pop    %r12
+  803ec5:	41 5d                	pop    %r13
+  803ec7:	41 5e                	pop    %r14
+  803ec9:	41 5f                	pop    %r15
+  803ecb:	5d                   	pop    %rbp
+  803ecc:	c3                   	ret
+
+0000000000803ecd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ecd:	55                   	push   %rbp
+  803ece:	48 89 e5             	mov    %rsp,%rbp
+  803ed1:	41 57                	push   %r15
+  803ed3:	41 56                	push   %r14
+  803ed5:	41 55                	push   %r13
+  803ed7:	41 54                	push   %r12
+  803ed9:	53                   	push   %rbx
+  803eda:	48 83 ec 18          	sub    $0x18,%rsp
+  803ede:	49 89 fc             	mov    %rdi,%r12
+  803ee1:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ee5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ee9:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+  803ef5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ef8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803efe:	49 bd 0a 27 80 00 00 	movabs $0x80270a,%r13
+  803f05:	00 00 00 
+            sys_yield();
+  803f08:	49 be 9b 26 80 00 00 	movabs $0x80269b,%r14
+  803f0f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803f12:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803f17:	74 7d                	je     803f96 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f19:	8b 03                	mov    (%rbx),%eax
+  803f1b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f1e:	75 26                	jne    803f46 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803f20:	4d 85 ff             	test   %r15,%r15
+  803f23:	75 77                	jne    803f9c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f25:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803f2a:	48 89 da             	mov    %rbx,%rdx
+  803f2d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f32:	4c 89 e7             	mov    %r12,%rdi
+  803f35:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803f38:	85 c0                	test   %eax,%eax
+  803f3a:	74 72                	je     803fae <devpipe_read+0xe1>
+            sys_yield();
+  803f3c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803f3f:	8b 03                	mov    (%rbx),%eax
+  803f41:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803f44:	74 df                	je     803f25 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f46:	48 63 c8             	movslq %eax,%rcx
+  803f49:	48 89 ca             	mov    %rcx,%rdx
+  803f4c:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f50:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803f57:	08 10 20 
+  803f5a:	48 89 d0             	mov    %rdx,%rax
+  803f5d:	48 f7 e6             	mul    %rsi
+  803f60:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f64:	48 89 d0             	mov    %rdx,%rax
+  803f67:	48 c1 e0 09          	shl    $0x9,%rax
+  803f6b:	48 29 d0             	sub    %rdx,%rax
+  803f6e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  803f75:	00 
+  803f76:	48 89 c8             	mov    %rcx,%rax
+  803f79:	48 29 d0             	sub    %rdx,%rax
+  803f7c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  803f81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803f85:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  803f89:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f8c:	49 83 c7 01          	add    $0x1,%r15
+  803f90:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  803f94:	75 83                	jne    803f19 <devpipe_read+0x4c>
+    return n;
+  803f96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f9a:	eb 03                	jmp    803f9f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  803f9c:	4c 89 f8             	mov    %r15,%rax
+}
+  803f9f:	48 83 c4 18          	add    $0x18,%rsp
+  803fa3:	5b                   	pop    %rbx
+  803fa4:	41 5c                	pop    %r12
+  803fa6:	41 5d                	pop    %r13
+  803fa8:	41 5e                	pop    %r14
+  803faa:	41 5f                	pop    %r15
+  803fac:	5d                   	pop    %rbp
+  803fad:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  803fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb3:	eb ea                	jmp    803f9f <devpipe_read+0xd2>
+
+0000000000803fb5 <pipe>:
+pipe(int pfd[2]) {
+  803fb5:	55                   	push   %rbp
+  803fb6:	48 89 e5             	mov    %rsp,%rbp
+  803fb9:	41 55                	push   %r13
+  803fbb:	41 54                	push   %r12
+  803fbd:	53                   	push   %rbx
+  803fbe:	48 83 ec 18          	sub    $0x18,%rsp
+  803fc2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fc5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803fc9:	48 b8 c8 2d 80 00 00 	movabs $0x802dc8,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+  803fd5:	89 c3                	mov    %eax,%ebx
+  803fd7:	85 c0                	test   %eax,%eax
+  803fd9:	0f 88 a0 01 00 00    	js     80417f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803fdf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fe4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ff2:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+  803ffe:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804000:	85 c0                	test   %eax,%eax
+  804002:	0f 88 77 01 00 00    	js     80417f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804008:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80400c:	48 b8 c8 2d 80 00 00 	movabs $0x802dc8,%rax
+  804013:	00 00 00 
+  804016:	ff d0                	call   *%rax
+  804018:	89 c3                	mov    %eax,%ebx
+  80401a:	85 c0                	test   %eax,%eax
+  80401c:	0f 88 43 01 00 00    	js     804165 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804022:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804027:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804030:	bf 00 00 00 00       	mov    $0x0,%edi
+  804035:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  80403c:	00 00 00 
+  80403f:	ff d0                	call   *%rax
+  804041:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804043:	85 c0                	test   %eax,%eax
+  804045:	0f 88 1a 01 00 00    	js     804165 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80404b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80404f:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  804056:	00 00 00 
+  804059:	ff d0                	call   *%rax
+  80405b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80405e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804063:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804068:	48 89 c6             	mov    %rax,%rsi
+  80406b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804070:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  804077:	00 00 00 
+  80407a:	ff d0                	call   *%rax
+  80407c:	89 c3                	mov    %eax,%ebx
+  80407e:	85 c0                	test   %eax,%eax
+  804080:	0f 88 c5 00 00 00    	js     80414b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804086:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80408a:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  804091:	00 00 00 
+  804094:	ff d0                	call   *%rax
+  804096:	48 89 c1             	mov    %rax,%rcx
+  804099:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80409f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040aa:	4c 89 ee             	mov    %r13,%rsi
+  8040ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b2:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  8040b9:	00 00 00 
+  8040bc:	ff d0                	call   *%rax
+  8040be:	89 c3                	mov    %eax,%ebx
+  8040c0:	85 c0                	test   %eax,%eax
+  8040c2:	78 6e                	js     804132 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040c4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040c9:	4c 89 ef             	mov    %r13,%rdi
+  8040cc:	48 b8 d2 26 80 00 00 	movabs $0x8026d2,%rax
+  8040d3:	00 00 00 
+  8040d6:	ff d0                	call   *%rax
+  8040d8:	83 f8 02             	cmp    $0x2,%eax
+  8040db:	0f 85 ab 00 00 00    	jne    80418c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8040e1:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8040e8:	00 00 
+  8040ea:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040ee:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8040f0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040f4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040fb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040ff:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804101:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804105:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80410c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804110:	48 bb 9a 2d 80 00 00 	movabs $0x802d9a,%rbx
+  804117:	00 00 00 
+  80411a:	ff d3                	call   *%rbx
+  80411c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804120:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804124:	ff d3                	call   *%rbx
+  804126:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80412b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804130:	eb 4d                	jmp    80417f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804132:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804137:	4c 89 ee             	mov    %r13,%rsi
+  80413a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413f:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80414b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804150:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804154:	bf 00 00 00 00       	mov    $0x0,%edi
+  804159:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804165:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80416e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804173:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  80417a:	00 00 00 
+  80417d:	ff d0                	call   *%rax
+}
+  80417f:	89 d8                	mov    %ebx,%eax
+  804181:	48 83 c4 18          	add    $0x18,%rsp
+  804185:	5b                   	pop    %rbx
+  804186:	41 5c                	pop    %r12
+  804188:	41 5d                	pop    %r13
+  80418a:	5d                   	pop    %rbp
+  80418b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80418c:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  804193:	00 00 00 
+  804196:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  80419d:	00 00 00 
+  8041a0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8041a5:	48 bf 97 62 80 00 00 	movabs $0x806297,%rdi
+  8041ac:	00 00 00 
+  8041af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b4:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  8041bb:	00 00 00 
+  8041be:	41 ff d0             	call   *%r8
+
+00000000008041c1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041c1:	55                   	push   %rbp
+  8041c2:	48 89 e5             	mov    %rsp,%rbp
+  8041c5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041c9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041cd:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  8041d4:	00 00 00 
+  8041d7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041d9:	85 c0                	test   %eax,%eax
+  8041db:	78 35                	js     804212 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8041dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041e1:	48 b8 ac 2d 80 00 00 	movabs $0x802dac,%rax
+  8041e8:	00 00 00 
+  8041eb:	ff d0                	call   *%rax
+  8041ed:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041f0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041fe:	48 b8 0a 27 80 00 00 	movabs $0x80270a,%rax
+  804205:	00 00 00 
+  804208:	ff d0                	call   *%rax
+  80420a:	85 c0                	test   %eax,%eax
+  80420c:	0f 94 c0             	sete   %al
+  80420f:	0f b6 c0             	movzbl %al,%eax
+}
+  804212:	c9                   	leave
+  804213:	c3                   	ret
+
+0000000000804214 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804214:	48 89 f8             	mov    %rdi,%rax
+  804217:	48 c1 e8 27          	shr    $0x27,%rax
+  80421b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804222:	01 00 00 
+  804225:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804229:	f6 c2 01             	test   $0x1,%dl
+  80422c:	74 6d                	je     80429b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80422e:	48 89 f8             	mov    %rdi,%rax
+  804231:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804235:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80423c:	01 00 00 
+  80423f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804243:	f6 c2 01             	test   $0x1,%dl
+  804246:	74 62                	je     8042aa <get_uvpt_entry+0x96>
+  804248:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80424f:	01 00 00 
+  804252:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804256:	f6 c2 80             	test   $0x80,%dl
+  804259:	75 4f                	jne    8042aa <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80425b:	48 89 f8             	mov    %rdi,%rax
+  80425e:	48 c1 e8 15          	shr    $0x15,%rax
+  804262:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804269:	01 00 00 
+  80426c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804270:	f6 c2 01             	test   $0x1,%dl
+  804273:	74 44                	je     8042b9 <get_uvpt_entry+0xa5>
+  804275:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427c:	01 00 00 
+  80427f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804283:	f6 c2 80             	test   $0x80,%dl
+  804286:	75 31                	jne    8042b9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804288:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80428c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804293:	01 00 00 
+  804296:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80429a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80429b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042a2:	01 00 00 
+  8042a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042a9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042aa:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042b1:	01 00 00 
+  8042b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042b8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042b9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042c0:	01 00 00 
+  8042c3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042c7:	c3                   	ret
+
+00000000008042c8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8042c8:	55                   	push   %rbp
+  8042c9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042cc:	48 b8 14 42 80 00 00 	movabs $0x804214,%rax
+  8042d3:	00 00 00 
+  8042d6:	ff d0                	call   *%rax
+  8042d8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042db:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042e0:	89 c1                	mov    %eax,%ecx
+  8042e2:	83 c9 04             	or     $0x4,%ecx
+  8042e5:	f6 c2 01             	test   $0x1,%dl
+  8042e8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042eb:	89 c1                	mov    %eax,%ecx
+  8042ed:	83 c9 02             	or     $0x2,%ecx
+  8042f0:	f6 c2 02             	test   $0x2,%dl
+  8042f3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042f6:	89 c1                	mov    %eax,%ecx
+  8042f8:	83 c9 01             	or     $0x1,%ecx
+  8042fb:	48 85 d2             	test   %rdx,%rdx
+  8042fe:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804301:	89 c1                	mov    %eax,%ecx
+  804303:	83 c9 40             	or     $0x40,%ecx
+  804306:	f6 c6 04             	test   $0x4,%dh
+  804309:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80430c:	5d                   	pop    %rbp
+  80430d:	c3                   	ret
+
+000000000080430e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80430e:	55                   	push   %rbp
+  80430f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804312:	48 b8 14 42 80 00 00 	movabs $0x804214,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80431e:	48 c1 e8 06          	shr    $0x6,%rax
+  804322:	83 e0 01             	and    $0x1,%eax
+}
+  804325:	5d                   	pop    %rbp
+  804326:	c3                   	ret
+
+0000000000804327 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804327:	55                   	push   %rbp
+  804328:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80432b:	48 b8 14 42 80 00 00 	movabs $0x804214,%rax
+  804332:	00 00 00 
+  804335:	ff d0                	call   *%rax
+  804337:	83 e0 01             	and    $0x1,%eax
+}
+  80433a:	5d                   	pop    %rbp
+  80433b:	c3                   	ret
+
+000000000080433c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80433c:	55                   	push   %rbp
+  80433d:	48 89 e5             	mov    %rsp,%rbp
+  804340:	41 57                	push   %r15
+  804342:	41 56                	push   %r14
+  804344:	41 55                	push   %r13
+  804346:	41 54                	push   %r12
+  804348:	53                   	push   %rbx
+  804349:	48 83 ec 28          	sub    $0x28,%rsp
+  80434d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804351:	48 85 ff             	test   %rdi,%rdi
+  804354:	74 1e                	je     804374 <foreach_shared_region+0x38>
+  804356:	49 89 ff             	mov    %rdi,%r15
+  804359:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80435f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804365:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80436c:	01 00 00 
+  80436f:	e9 72 02 00 00       	jmp    8045e6 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804374:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  80437b:	00 00 00 
+  80437e:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804385:	00 00 00 
+  804388:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80438d:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804394:	00 00 00 
+  804397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439c:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  8043a3:	00 00 00 
+  8043a6:	41 ff d0             	call   *%r8
+  8043a9:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8043b0:	eb 6c                	jmp    80441e <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8043b2:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043b9:	ff ff ff 
+  8043bc:	4c 21 e2             	and    %r12,%rdx
+  8043bf:	48 89 d8             	mov    %rbx,%rax
+  8043c2:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043c7:	48 83 c0 01          	add    $0x1,%rax
+  8043cb:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8043cf:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8043d6:	00 00 00 
+  8043d9:	48 21 c8             	and    %rcx,%rax
+  8043dc:	48 09 d0             	or     %rdx,%rax
+  8043df:	49 89 c4             	mov    %rax,%r12
+  8043e2:	eb 30                	jmp    804414 <foreach_shared_region+0xd8>
+  8043e4:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8043eb:	ff ff ff 
+  8043ee:	4c 21 e2             	and    %r12,%rdx
+  8043f1:	48 89 d8             	mov    %rbx,%rax
+  8043f4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8043f9:	48 83 c0 01          	add    $0x1,%rax
+  8043fd:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804401:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804408:	00 00 00 
+  80440b:	48 21 c8             	and    %rcx,%rax
+  80440e:	48 09 d0             	or     %rdx,%rax
+  804411:	49 89 c4             	mov    %rax,%r12
+  804414:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804418:	0f 84 99 01 00 00    	je     8045b7 <foreach_shared_region+0x27b>
+  80441e:	4c 89 e3             	mov    %r12,%rbx
+  804421:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804425:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80442c:	01 00 00 
+  80442f:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804433:	a8 01                	test   $0x1,%al
+  804435:	0f 84 77 ff ff ff    	je     8043b2 <foreach_shared_region+0x76>
+  80443b:	a8 80                	test   $0x80,%al
+  80443d:	74 19                	je     804458 <foreach_shared_region+0x11c>
+  80443f:	f6 c4 04             	test   $0x4,%ah
+  804442:	74 a0                	je     8043e4 <foreach_shared_region+0xa8>
+  804444:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80444b:	40 
+  80444c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804450:	4c 89 e7             	mov    %r12,%rdi
+  804453:	41 ff d7             	call   *%r15
+  804456:	eb 8c                	jmp    8043e4 <foreach_shared_region+0xa8>
+  804458:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80445f:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804463:	eb 46                	jmp    8044ab <foreach_shared_region+0x16f>
+  804465:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80446c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804472:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804476:	48 c1 e0 15          	shl    $0x15,%rax
+  80447a:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80447f:	49 09 c4             	or     %rax,%r12
+  804482:	eb 1d                	jmp    8044a1 <foreach_shared_region+0x165>
+  804484:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80448b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804491:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804495:	48 c1 e0 15          	shl    $0x15,%rax
+  804499:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80449e:	49 09 c4             	or     %rax,%r12
+  8044a1:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8044a5:	0f 84 d3 00 00 00    	je     80457e <foreach_shared_region+0x242>
+  8044ab:	4c 89 e3             	mov    %r12,%rbx
+  8044ae:	48 c1 eb 15          	shr    $0x15,%rbx
+  8044b2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8044b9:	01 00 00 
+  8044bc:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044c0:	a8 01                	test   $0x1,%al
+  8044c2:	74 a1                	je     804465 <foreach_shared_region+0x129>
+  8044c4:	a8 80                	test   $0x80,%al
+  8044c6:	74 19                	je     8044e1 <foreach_shared_region+0x1a5>
+  8044c8:	f6 c4 04             	test   $0x4,%ah
+  8044cb:	74 b7                	je     804484 <foreach_shared_region+0x148>
+  8044cd:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8044d4:	00 
+  8044d5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044d9:	4c 89 e7             	mov    %r12,%rdi
+  8044dc:	41 ff d7             	call   *%r15
+  8044df:	eb a3                	jmp    804484 <foreach_shared_region+0x148>
+  8044e1:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8044e7:	eb 3b                	jmp    804524 <foreach_shared_region+0x1e8>
+  8044e9:	f6 c4 04             	test   $0x4,%ah
+  8044ec:	74 12                	je     804500 <foreach_shared_region+0x1c4>
+  8044ee:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8044f5:	00 
+  8044f6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044fa:	4c 89 e7             	mov    %r12,%rdi
+  8044fd:	41 ff d7             	call   *%r15
+  804500:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804507:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80450d:	48 83 c3 01          	add    $0x1,%rbx
+  804511:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804515:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80451b:	49 09 dc             	or     %rbx,%r12
+  80451e:	41 83 ed 01          	sub    $0x1,%r13d
+  804522:	74 2f                	je     804553 <foreach_shared_region+0x217>
+  804524:	4c 89 e3             	mov    %r12,%rbx
+  804527:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80452b:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80452f:	a8 01                	test   $0x1,%al
+  804531:	75 b6                	jne    8044e9 <foreach_shared_region+0x1ad>
+  804533:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80453a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804540:	48 83 c3 01          	add    $0x1,%rbx
+  804544:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804548:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80454e:	49 09 dc             	or     %rbx,%r12
+  804551:	eb cb                	jmp    80451e <foreach_shared_region+0x1e2>
+  804553:	4c 89 e0             	mov    %r12,%rax
+  804556:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80455c:	49 c1 ec 15          	shr    $0x15,%r12
+  804560:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804567:	49 83 c4 01          	add    $0x1,%r12
+  80456b:	49 c1 e4 15          	shl    $0x15,%r12
+  80456f:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804576:	49 09 c4             	or     %rax,%r12
+  804579:	e9 23 ff ff ff       	jmp    8044a1 <foreach_shared_region+0x165>
+  80457e:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804582:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804589:	ff ff ff 
+  80458c:	4c 21 e0             	and    %r12,%rax
+  80458f:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804593:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80459a:	49 83 c4 01          	add    $0x1,%r12
+  80459e:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8045a2:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8045a9:	00 00 00 
+  8045ac:	49 21 d4             	and    %rdx,%r12
+  8045af:	49 09 c4             	or     %rax,%r12
+  8045b2:	e9 5d fe ff ff       	jmp    804414 <foreach_shared_region+0xd8>
+  8045b7:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8045be:	00 ff ff 
+  8045c1:	4c 21 e0             	and    %r12,%rax
+  8045c4:	49 c1 ec 27          	shr    $0x27,%r12
+  8045c8:	49 83 c4 01          	add    $0x1,%r12
+  8045cc:	49 c1 e4 27          	shl    $0x27,%r12
+  8045d0:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8045d7:	ff 00 00 
+  8045da:	49 21 d4             	and    %rdx,%r12
+  8045dd:	49 09 c4             	or     %rax,%r12
+  8045e0:	41 83 ed 01          	sub    $0x1,%r13d
+  8045e4:	74 48                	je     80462e <foreach_shared_region+0x2f2>
+  8045e6:	4c 89 e0             	mov    %r12,%rax
+  8045e9:	48 c1 e8 27          	shr    $0x27,%rax
+  8045ed:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8045f4:	01 00 00 
+  8045f7:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8045fb:	f6 c2 01             	test   $0x1,%dl
+  8045fe:	0f 85 a5 fd ff ff    	jne    8043a9 <foreach_shared_region+0x6d>
+  804604:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80460b:	00 ff ff 
+  80460e:	4c 21 e2             	and    %r12,%rdx
+  804611:	48 83 c0 01          	add    $0x1,%rax
+  804615:	48 c1 e0 27          	shl    $0x27,%rax
+  804619:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804620:	ff 00 00 
+  804623:	48 21 c8             	and    %rcx,%rax
+  804626:	48 09 d0             	or     %rdx,%rax
+  804629:	49 89 c4             	mov    %rax,%r12
+  80462c:	eb b2                	jmp    8045e0 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80462e:	4d 85 e4             	test   %r12,%r12
+  804631:	75 14                	jne    804647 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804633:	b8 00 00 00 00       	mov    $0x0,%eax
+  804638:	48 83 c4 28          	add    $0x28,%rsp
+  80463c:	5b                   	pop    %rbx
+  80463d:	41 5c                	pop    %r12
+  80463f:	41 5d                	pop    %r13
+  804641:	41 5e                	pop    %r14
+  804643:	41 5f                	pop    %r15
+  804645:	5d                   	pop    %rbp
+  804646:	c3                   	ret
+    assert(addr == 0);
+  804647:	48 b9 db 62 80 00 00 	movabs $0x8062db,%rcx
+  80464e:	00 00 00 
+  804651:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  804658:	00 00 00 
+  80465b:	be 67 00 00 00       	mov    $0x67,%esi
+  804660:	48 bf d0 62 80 00 00 	movabs $0x8062d0,%rdi
+  804667:	00 00 00 
+  80466a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466f:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  804676:	00 00 00 
+  804679:	41 ff d0             	call   *%r8
+
+000000000080467c <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80467c:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804683:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804686:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80468c:	eb 33                	jmp    8046c1 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80468e:	48 83 c0 20          	add    $0x20,%rax
+  804692:	4c 39 c0             	cmp    %r8,%rax
+  804695:	74 25                	je     8046bc <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804697:	48 8b 10             	mov    (%rax),%rdx
+  80469a:	48 85 d2             	test   %rdx,%rdx
+  80469d:	74 ef                	je     80468e <mmap_place+0x12>
+  80469f:	48 89 d1             	mov    %rdx,%rcx
+  8046a2:	48 03 48 08          	add    0x8(%rax),%rcx
+  8046a6:	48 39 cf             	cmp    %rcx,%rdi
+  8046a9:	73 e3                	jae    80468e <mmap_place+0x12>
+  8046ab:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8046af:	4c 39 ca             	cmp    %r9,%rdx
+  8046b2:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8046b6:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8046ba:	eb d2                	jmp    80468e <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8046bc:	45 84 d2             	test   %r10b,%r10b
+  8046bf:	74 12                	je     8046d3 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8046c1:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8046c8:	00 00 00 
+        moved = 0;
+  8046cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8046d1:	eb c4                	jmp    804697 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8046d3:	48 01 fe             	add    %rdi,%rsi
+  8046d6:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8046dd:	00 00 00 
+  8046e0:	48 39 f0             	cmp    %rsi,%rax
+  8046e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e8:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8046ec:	c3                   	ret
+
+00000000008046ed <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8046ed:	55                   	push   %rbp
+  8046ee:	48 89 e5             	mov    %rsp,%rbp
+  8046f1:	41 57                	push   %r15
+  8046f3:	41 56                	push   %r14
+  8046f5:	41 55                	push   %r13
+  8046f7:	41 54                	push   %r12
+  8046f9:	53                   	push   %rbx
+  8046fa:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8046fe:	48 8b 1f             	mov    (%rdi),%rbx
+  804701:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804708:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80470f:	00 00 00 
+  804712:	ba 00 00 00 00       	mov    $0x0,%edx
+  804717:	eb 12                	jmp    80472b <mmap_pgfault+0x3e>
+  804719:	48 83 c2 01          	add    $0x1,%rdx
+  80471d:	48 83 c0 20          	add    $0x20,%rax
+  804721:	48 83 fa 20          	cmp    $0x20,%rdx
+  804725:	0f 84 04 01 00 00    	je     80482f <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  80472b:	48 8b 08             	mov    (%rax),%rcx
+  80472e:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804732:	48 39 de             	cmp    %rbx,%rsi
+  804735:	73 e2                	jae    804719 <mmap_pgfault+0x2c>
+  804737:	48 03 48 08          	add    0x8(%rax),%rcx
+  80473b:	48 39 cb             	cmp    %rcx,%rbx
+  80473e:	73 d9                	jae    804719 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804740:	48 c1 e2 05          	shl    $0x5,%rdx
+  804744:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80474b:	00 00 00 
+  80474e:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804752:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804756:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80475a:	f6 c2 01             	test   $0x1,%dl
+  80475d:	0f 84 e0 00 00 00    	je     804843 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804763:	b8 00 00 00 00       	mov    $0x0,%eax
+  804768:	f6 c2 02             	test   $0x2,%dl
+  80476b:	0f 84 c3 00 00 00    	je     804834 <mmap_pgfault+0x147>
+  804771:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804778:	ff ff ff 
+  80477b:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80477f:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804786:	00 00 00 
+  804789:	48 39 ca             	cmp    %rcx,%rdx
+  80478c:	0f 85 a2 00 00 00    	jne    804834 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804792:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804797:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80479c:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8047a3:	00 00 00 
+  8047a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ab:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  8047b2:	00 00 00 
+  8047b5:	ff d0                	call   *%rax
+  8047b7:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8047b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047be:	85 d2                	test   %edx,%edx
+  8047c0:	78 72                	js     804834 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8047c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c7:	48 89 de             	mov    %rbx,%rsi
+  8047ca:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8047d1:	00 00 00 
+  8047d4:	4c 89 e7             	mov    %r12,%rdi
+  8047d7:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  8047de:	00 00 00 
+  8047e1:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8047e3:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8047e9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8047ef:	48 89 d9             	mov    %rbx,%rcx
+  8047f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f7:	4c 89 e6             	mov    %r12,%rsi
+  8047fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ff:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  804806:	00 00 00 
+  804809:	ff d0                	call   *%rax
+  80480b:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  80480d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804812:	4c 89 e6             	mov    %r12,%rsi
+  804815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80481a:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  804821:	00 00 00 
+  804824:	ff d0                	call   *%rax
+    return res >= 0;
+  804826:	89 d8                	mov    %ebx,%eax
+  804828:	f7 d0                	not    %eax
+  80482a:	c1 e8 1f             	shr    $0x1f,%eax
+  80482d:	eb 05                	jmp    804834 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80482f:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804834:	48 83 c4 18          	add    $0x18,%rsp
+  804838:	5b                   	pop    %rbx
+  804839:	41 5c                	pop    %r12
+  80483b:	41 5d                	pop    %r13
+  80483d:	41 5e                	pop    %r14
+  80483f:	41 5f                	pop    %r15
+  804841:	5d                   	pop    %rbp
+  804842:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804843:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804847:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  80484b:	4c 03 30             	add    (%rax),%r14
+  80484e:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804855:	49 39 c6             	cmp    %rax,%r14
+  804858:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80485c:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804863:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804869:	49 bf 27 43 80 00 00 	movabs $0x804327,%r15
+  804870:	00 00 00 
+  804873:	4d 39 f4             	cmp    %r14,%r12
+  804876:	73 1d                	jae    804895 <mmap_pgfault+0x1a8>
+  804878:	4c 89 e7             	mov    %r12,%rdi
+  80487b:	41 ff d7             	call   *%r15
+  80487e:	84 c0                	test   %al,%al
+  804880:	75 13                	jne    804895 <mmap_pgfault+0x1a8>
+  804882:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804889:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804890:	4d 39 f4             	cmp    %r14,%r12
+  804893:	72 e3                	jb     804878 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804895:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  80489b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80489f:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8048a3:	74 2a                	je     8048cf <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8048a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a9:	89 de                	mov    %ebx,%esi
+  8048ab:	2b 30                	sub    (%rax),%esi
+  8048ad:	03 70 1c             	add    0x1c(%rax),%esi
+  8048b0:	8b 78 18             	mov    0x18(%rax),%edi
+  8048b3:	4c 89 e9             	mov    %r13,%rcx
+  8048b6:	48 89 da             	mov    %rbx,%rdx
+  8048b9:	48 b8 85 3a 80 00 00 	movabs $0x803a85,%rax
+  8048c0:	00 00 00 
+  8048c3:	ff d0                	call   *%rax
+    return res > 0;
+  8048c5:	85 c0                	test   %eax,%eax
+  8048c7:	0f 9f c0             	setg   %al
+  8048ca:	e9 65 ff ff ff       	jmp    804834 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8048cf:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8048d3:	eb d0                	jmp    8048a5 <mmap_pgfault+0x1b8>
+
+00000000008048d5 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8048d5:	55                   	push   %rbp
+  8048d6:	48 89 e5             	mov    %rsp,%rbp
+  8048d9:	41 57                	push   %r15
+  8048db:	41 56                	push   %r14
+  8048dd:	41 55                	push   %r13
+  8048df:	41 54                	push   %r12
+  8048e1:	53                   	push   %rbx
+  8048e2:	48 83 ec 28          	sub    $0x28,%rsp
+  8048e6:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8048ea:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8048ed:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8048f4:	ff ff ff 
+  8048f7:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8048fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804900:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804907:	00 00 00 
+  80490a:	48 39 ca             	cmp    %rcx,%rdx
+  80490d:	0f 85 e5 00 00 00    	jne    8049f8 <mmap_writeback+0x123>
+  804913:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804916:	4c 39 ee             	cmp    %r13,%rsi
+  804919:	0f 83 e8 00 00 00    	jae    804a07 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80491f:	49 be 27 43 80 00 00 	movabs $0x804327,%r14
+  804926:	00 00 00 
+  804929:	49 bf 0e 43 80 00 00 	movabs $0x80430e,%r15
+  804930:	00 00 00 
+  804933:	eb 10                	jmp    804945 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804935:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  80493c:	4d 39 ec             	cmp    %r13,%r12
+  80493f:	0f 83 ae 00 00 00    	jae    8049f3 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804945:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804949:	4c 89 e7             	mov    %r12,%rdi
+  80494c:	41 ff d6             	call   *%r14
+  80494f:	84 c0                	test   %al,%al
+  804951:	74 e2                	je     804935 <mmap_writeback+0x60>
+  804953:	4c 89 e7             	mov    %r12,%rdi
+  804956:	41 ff d7             	call   *%r15
+  804959:	84 c0                	test   %al,%al
+  80495b:	74 d8                	je     804935 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80495d:	4c 89 e3             	mov    %r12,%rbx
+  804960:	4d 39 ec             	cmp    %r13,%r12
+  804963:	73 20                	jae    804985 <mmap_writeback+0xb0>
+  804965:	48 89 df             	mov    %rbx,%rdi
+  804968:	41 ff d6             	call   *%r14
+  80496b:	84 c0                	test   %al,%al
+  80496d:	74 16                	je     804985 <mmap_writeback+0xb0>
+  80496f:	48 89 df             	mov    %rbx,%rdi
+  804972:	41 ff d7             	call   *%r15
+  804975:	84 c0                	test   %al,%al
+  804977:	74 0c                	je     804985 <mmap_writeback+0xb0>
+  804979:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804980:	4c 39 eb             	cmp    %r13,%rbx
+  804983:	72 e0                	jb     804965 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804985:	48 89 d9             	mov    %rbx,%rcx
+  804988:	4c 29 e1             	sub    %r12,%rcx
+  80498b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80498f:	44 89 e6             	mov    %r12d,%esi
+  804992:	2b 30                	sub    (%rax),%esi
+  804994:	49 89 c4             	mov    %rax,%r12
+  804997:	03 70 1c             	add    0x1c(%rax),%esi
+  80499a:	8b 78 18             	mov    0x18(%rax),%edi
+  80499d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8049a1:	48 89 ca             	mov    %rcx,%rdx
+  8049a4:	48 b8 0e 3b 80 00 00 	movabs $0x803b0e,%rax
+  8049ab:	00 00 00 
+  8049ae:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8049b0:	85 c0                	test   %eax,%eax
+  8049b2:	78 44                	js     8049f8 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8049b4:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8049b9:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8049bc:	41 89 c1             	mov    %eax,%r9d
+  8049bf:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8049c6:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8049ca:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8049ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d3:	48 89 ce             	mov    %rcx,%rsi
+  8049d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049db:	48 b8 a9 27 80 00 00 	movabs $0x8027a9,%rax
+  8049e2:	00 00 00 
+  8049e5:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8049e7:	85 c0                	test   %eax,%eax
+  8049e9:	78 0d                	js     8049f8 <mmap_writeback+0x123>
+  8049eb:	49 89 dc             	mov    %rbx,%r12
+  8049ee:	e9 49 ff ff ff       	jmp    80493c <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8049f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f8:	48 83 c4 28          	add    $0x28,%rsp
+  8049fc:	5b                   	pop    %rbx
+  8049fd:	41 5c                	pop    %r12
+  8049ff:	41 5d                	pop    %r13
+  804a01:	41 5e                	pop    %r14
+  804a03:	41 5f                	pop    %r15
+  804a05:	5d                   	pop    %rbp
+  804a06:	c3                   	ret
+    return 0;
+  804a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a0c:	eb ea                	jmp    8049f8 <mmap_writeback+0x123>
+
+0000000000804a0e <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804a0e:	55                   	push   %rbp
+  804a0f:	48 89 e5             	mov    %rsp,%rbp
+  804a12:	41 57                	push   %r15
+  804a14:	41 56                	push   %r14
+  804a16:	41 55                	push   %r13
+  804a18:	41 54                	push   %r12
+  804a1a:	53                   	push   %rbx
+  804a1b:	48 83 ec 38          	sub    $0x38,%rsp
+  804a1f:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804a23:	48 85 f6             	test   %rsi,%rsi
+  804a26:	0f 84 0c 02 00 00    	je     804c38 <mmap+0x22a>
+  804a2c:	49 89 ff             	mov    %rdi,%r15
+  804a2f:	49 89 f4             	mov    %rsi,%r12
+  804a32:	41 89 d5             	mov    %edx,%r13d
+  804a35:	41 89 ce             	mov    %ecx,%r14d
+  804a38:	44 89 cb             	mov    %r9d,%ebx
+  804a3b:	45 85 c9             	test   %r9d,%r9d
+  804a3e:	0f 88 f4 01 00 00    	js     804c38 <mmap+0x22a>
+  804a44:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a4b:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804a52:	0f 85 e7 01 00 00    	jne    804c3f <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804a58:	83 e2 fd             	and    $0xfffffffd,%edx
+  804a5b:	83 fa 04             	cmp    $0x4,%edx
+  804a5e:	0f 85 db 01 00 00    	jne    804c3f <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804a64:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a67:	83 fa 01             	cmp    $0x1,%edx
+  804a6a:	0f 87 cf 01 00 00    	ja     804c3f <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804a70:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804a74:	44 89 c7             	mov    %r8d,%edi
+  804a77:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  804a7e:	00 00 00 
+  804a81:	ff d0                	call   *%rax
+  804a83:	89 c2                	mov    %eax,%edx
+  804a85:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804a8c:	85 d2                	test   %edx,%edx
+  804a8e:	0f 88 ab 01 00 00    	js     804c3f <mmap+0x231>
+  804a94:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a98:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804a9f:	00 00 00 
+  804aa2:	8b 09                	mov    (%rcx),%ecx
+  804aa4:	39 0a                	cmp    %ecx,(%rdx)
+  804aa6:	0f 85 93 01 00 00    	jne    804c3f <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804aac:	8b 52 08             	mov    0x8(%rdx),%edx
+  804aaf:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804ab2:	83 fa 01             	cmp    $0x1,%edx
+  804ab5:	0f 84 84 01 00 00    	je     804c3f <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804abb:	41 83 fe 01          	cmp    $0x1,%r14d
+  804abf:	74 42                	je     804b03 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804ac1:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804ac8:	4c 89 e6             	mov    %r12,%rsi
+  804acb:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804ad2:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ad6:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ada:	4d 85 ff             	test   %r15,%r15
+  804add:	74 67                	je     804b46 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804adf:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804ae6:	75 0f                	jne    804af7 <mmap+0xe9>
+  804ae8:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804aef:	00 00 00 
+  804af2:	49 39 c7             	cmp    %rax,%r15
+  804af5:	77 1b                	ja     804b12 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804af7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804afe:	e9 3c 01 00 00       	jmp    804c3f <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b03:	41 f6 c5 02          	test   $0x2,%r13b
+  804b07:	74 b8                	je     804ac1 <mmap+0xb3>
+  804b09:	85 d2                	test   %edx,%edx
+  804b0b:	75 b4                	jne    804ac1 <mmap+0xb3>
+  804b0d:	e9 2d 01 00 00       	jmp    804c3f <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b12:	4c 89 ff             	mov    %r15,%rdi
+  804b15:	48 b8 7c 46 80 00 00 	movabs $0x80467c,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  804b21:	48 89 c2             	mov    %rax,%rdx
+  804b24:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b2b:	49 39 d7             	cmp    %rdx,%r15
+  804b2e:	0f 85 0b 01 00 00    	jne    804c3f <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b34:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b3b:	00 00 00 
+  804b3e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804b44:	eb 44                	jmp    804b8a <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b46:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804b4a:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804b51:	00 00 00 
+  804b54:	48 b8 7c 46 80 00 00 	movabs $0x80467c,%rax
+  804b5b:	00 00 00 
+  804b5e:	ff d0                	call   *%rax
+  804b60:	48 89 c7             	mov    %rax,%rdi
+  804b63:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804b67:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804b6e:	48 85 ff             	test   %rdi,%rdi
+  804b71:	75 c1                	jne    804b34 <mmap+0x126>
+  804b73:	e9 c7 00 00 00       	jmp    804c3f <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804b78:	49 83 c4 01          	add    $0x1,%r12
+  804b7c:	48 83 c0 20          	add    $0x20,%rax
+  804b80:	49 83 fc 20          	cmp    $0x20,%r12
+  804b84:	0f 84 a5 00 00 00    	je     804c2f <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804b8a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804b8e:	75 e8                	jne    804b78 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804b90:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804b94:	48 b8 c8 2d 80 00 00 	movabs $0x802dc8,%rax
+  804b9b:	00 00 00 
+  804b9e:	ff d0                	call   *%rax
+  804ba0:	89 c2                	mov    %eax,%edx
+  804ba2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ba9:	85 d2                	test   %edx,%edx
+  804bab:	0f 88 8e 00 00 00    	js     804c3f <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804bb1:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804bb5:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  804bbc:	00 00 00 
+  804bbf:	ff d0                	call   *%rax
+  804bc1:	89 c6                	mov    %eax,%esi
+  804bc3:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804bc6:	48 b8 e8 2f 80 00 00 	movabs $0x802fe8,%rax
+  804bcd:	00 00 00 
+  804bd0:	ff d0                	call   *%rax
+  804bd2:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804bd5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bdc:	45 85 ff             	test   %r15d,%r15d
+  804bdf:	78 5e                	js     804c3f <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804be1:	49 c1 e4 05          	shl    $0x5,%r12
+  804be5:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bec:	00 00 00 
+  804bef:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804bf2:	48 bf ed 46 80 00 00 	movabs $0x8046ed,%rdi
+  804bf9:	00 00 00 
+  804bfc:	48 b8 bb 51 80 00 00 	movabs $0x8051bb,%rax
+  804c03:	00 00 00 
+  804c06:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804c08:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804c0c:	49 89 04 24          	mov    %rax,(%r12)
+  804c10:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804c14:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804c19:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804c1e:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804c23:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804c28:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804c2d:	eb 10                	jmp    804c3f <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804c2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c36:	eb 07                	jmp    804c3f <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c38:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804c3f:	48 83 c4 38          	add    $0x38,%rsp
+  804c43:	5b                   	pop    %rbx
+  804c44:	41 5c                	pop    %r12
+  804c46:	41 5d                	pop    %r13
+  804c48:	41 5e                	pop    %r14
+  804c4a:	41 5f                	pop    %r15
+  804c4c:	5d                   	pop    %rbp
+  804c4d:	c3                   	ret
+
+0000000000804c4e <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804c4e:	55                   	push   %rbp
+  804c4f:	48 89 e5             	mov    %rsp,%rbp
+  804c52:	41 57                	push   %r15
+  804c54:	41 56                	push   %r14
+  804c56:	41 55                	push   %r13
+  804c58:	41 54                	push   %r12
+  804c5a:	53                   	push   %rbx
+  804c5b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804c5f:	49 89 fe             	mov    %rdi,%r14
+  804c62:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804c69:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804c70:	00 
+  804c71:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c78:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804c7f:	00 00 00 
+  804c82:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804c89:	49 bf d5 48 80 00 00 	movabs $0x8048d5,%r15
+  804c90:	00 00 00 
+  804c93:	eb 09                	jmp    804c9e <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c95:	48 83 c3 20          	add    $0x20,%rbx
+  804c99:	4c 39 eb             	cmp    %r13,%rbx
+  804c9c:	74 33                	je     804cd1 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804c9e:	48 89 df             	mov    %rbx,%rdi
+  804ca1:	48 8b 33             	mov    (%rbx),%rsi
+  804ca4:	4c 39 e6             	cmp    %r12,%rsi
+  804ca7:	73 ec                	jae    804c95 <msync+0x47>
+  804ca9:	48 85 f6             	test   %rsi,%rsi
+  804cac:	74 e7                	je     804c95 <msync+0x47>
+  804cae:	48 89 f2             	mov    %rsi,%rdx
+  804cb1:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804cb5:	49 39 d6             	cmp    %rdx,%r14
+  804cb8:	73 db                	jae    804c95 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804cba:	4c 39 e2             	cmp    %r12,%rdx
+  804cbd:	49 0f 47 d4          	cmova  %r12,%rdx
+  804cc1:	4c 39 f6             	cmp    %r14,%rsi
+  804cc4:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804cc8:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804ccb:	85 c0                	test   %eax,%eax
+  804ccd:	79 c6                	jns    804c95 <msync+0x47>
+  804ccf:	eb 05                	jmp    804cd6 <msync+0x88>
+    }
+
+    return 0;
+  804cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cd6:	48 83 c4 08          	add    $0x8,%rsp
+  804cda:	5b                   	pop    %rbx
+  804cdb:	41 5c                	pop    %r12
+  804cdd:	41 5d                	pop    %r13
+  804cdf:	41 5e                	pop    %r14
+  804ce1:	41 5f                	pop    %r15
+  804ce3:	5d                   	pop    %rbp
+  804ce4:	c3                   	ret
+
+0000000000804ce5 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804ce5:	55                   	push   %rbp
+  804ce6:	48 89 e5             	mov    %rsp,%rbp
+  804ce9:	41 57                	push   %r15
+  804ceb:	41 56                	push   %r14
+  804ced:	41 55                	push   %r13
+  804cef:	41 54                	push   %r12
+  804cf1:	53                   	push   %rbx
+  804cf2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cf6:	49 89 ff             	mov    %rdi,%r15
+  804cf9:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d00:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d07:	00 
+  804d08:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d0f:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d16:	00 00 00 
+  804d19:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d20:	48 89 d8             	mov    %rbx,%rax
+  804d23:	eb 09                	jmp    804d2e <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d25:	48 83 c0 20          	add    $0x20,%rax
+  804d29:	4c 39 f0             	cmp    %r14,%rax
+  804d2c:	74 40                	je     804d6e <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d2e:	48 8b 10             	mov    (%rax),%rdx
+  804d31:	4c 39 e2             	cmp    %r12,%rdx
+  804d34:	73 ef                	jae    804d25 <munmap+0x40>
+  804d36:	48 85 d2             	test   %rdx,%rdx
+  804d39:	74 ea                	je     804d25 <munmap+0x40>
+  804d3b:	48 89 d7             	mov    %rdx,%rdi
+  804d3e:	48 03 78 08          	add    0x8(%rax),%rdi
+  804d42:	49 39 ff             	cmp    %rdi,%r15
+  804d45:	73 de                	jae    804d25 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804d47:	49 39 fc             	cmp    %rdi,%r12
+  804d4a:	72 05                	jb     804d51 <munmap+0x6c>
+  804d4c:	4c 39 fa             	cmp    %r15,%rdx
+  804d4f:	73 d4                	jae    804d25 <munmap+0x40>
+  804d51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804d56:	48 83 c4 08          	add    $0x8,%rsp
+  804d5a:	5b                   	pop    %rbx
+  804d5b:	41 5c                	pop    %r12
+  804d5d:	41 5d                	pop    %r13
+  804d5f:	41 5e                	pop    %r14
+  804d61:	41 5f                	pop    %r15
+  804d63:	5d                   	pop    %rbp
+  804d64:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d65:	48 83 c3 20          	add    $0x20,%rbx
+  804d69:	4c 39 f3             	cmp    %r14,%rbx
+  804d6c:	74 5c                	je     804dca <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d6e:	48 8b 33             	mov    (%rbx),%rsi
+  804d71:	4c 39 e6             	cmp    %r12,%rsi
+  804d74:	73 ef                	jae    804d65 <munmap+0x80>
+  804d76:	48 85 f6             	test   %rsi,%rsi
+  804d79:	74 ea                	je     804d65 <munmap+0x80>
+  804d7b:	48 89 f2             	mov    %rsi,%rdx
+  804d7e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d82:	49 39 d7             	cmp    %rdx,%r15
+  804d85:	73 de                	jae    804d65 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804d87:	48 89 df             	mov    %rbx,%rdi
+  804d8a:	48 b8 d5 48 80 00 00 	movabs $0x8048d5,%rax
+  804d91:	00 00 00 
+  804d94:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d96:	85 c0                	test   %eax,%eax
+  804d98:	78 bc                	js     804d56 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804d9a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804d9e:	48 8b 33             	mov    (%rbx),%rsi
+  804da1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da6:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  804dad:	00 00 00 
+  804db0:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804db2:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804db5:	48 b8 8d 2f 80 00 00 	movabs $0x802f8d,%rax
+  804dbc:	00 00 00 
+  804dbf:	ff d0                	call   *%rax
+        reg->start = 0;
+  804dc1:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804dc8:	eb 9b                	jmp    804d65 <munmap+0x80>
+    return 0;
+  804dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcf:	eb 85                	jmp    804d56 <munmap+0x71>
+
+0000000000804dd1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd6:	c3                   	ret
+
+0000000000804dd7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804dd7:	55                   	push   %rbp
+  804dd8:	48 89 e5             	mov    %rsp,%rbp
+  804ddb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804dde:	48 be e5 62 80 00 00 	movabs $0x8062e5,%rsi
+  804de5:	00 00 00 
+  804de8:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  804def:	00 00 00 
+  804df2:	ff d0                	call   *%rax
+    return 0;
+}
+  804df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df9:	5d                   	pop    %rbp
+  804dfa:	c3                   	ret
+
+0000000000804dfb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804dfb:	55                   	push   %rbp
+  804dfc:	48 89 e5             	mov    %rsp,%rbp
+  804dff:	41 57                	push   %r15
+  804e01:	41 56                	push   %r14
+  804e03:	41 55                	push   %r13
+  804e05:	41 54                	push   %r12
+  804e07:	53                   	push   %rbx
+  804e08:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804e0f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804e16:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804e1d:	00 00 00 00 
+  804e21:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804e28:	00 00 00 00 
+  804e2c:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804e33:	00 00 00 00 
+  804e37:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804e3e:	00 00 00 00 
+  804e42:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804e49:	00 00 00 00 
+  804e4d:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804e54:	00 00 00 00 
+  804e58:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804e5f:	00 
+  804e60:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804e67:	00 
+  804e68:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804e6f:	00 
+  804e70:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804e77:	00 
+  804e78:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804e7f:	00 
+  804e80:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804e87:	00 
+  804e88:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804e8f:	00 
+  804e90:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804e97:	00 
+  804e98:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804e9f:	00 
+  804ea0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804ea7:	00 
+    for (res = 0; res < n; res += inc) {
+  804ea8:	48 85 d2             	test   %rdx,%rdx
+  804eab:	74 7a                	je     804f27 <devcons_write+0x12c>
+  804ead:	49 89 d6             	mov    %rdx,%r14
+  804eb0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804eb6:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804ebb:	49 bf 27 23 80 00 00 	movabs $0x802327,%r15
+  804ec2:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804ec5:	4c 89 f3             	mov    %r14,%rbx
+  804ec8:	48 29 f3             	sub    %rsi,%rbx
+  804ecb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804ed0:	48 39 c3             	cmp    %rax,%rbx
+  804ed3:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ed7:	4c 63 eb             	movslq %ebx,%r13
+  804eda:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ee1:	48 01 c6             	add    %rax,%rsi
+  804ee4:	4c 89 ea             	mov    %r13,%rdx
+  804ee7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804eee:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804ef1:	4c 89 ee             	mov    %r13,%rsi
+  804ef4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804efb:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  804f02:	00 00 00 
+  804f05:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804f07:	41 01 dc             	add    %ebx,%r12d
+  804f0a:	49 63 f4             	movslq %r12d,%rsi
+  804f0d:	4c 39 f6             	cmp    %r14,%rsi
+  804f10:	72 b3                	jb     804ec5 <devcons_write+0xca>
+    return res;
+  804f12:	49 63 c4             	movslq %r12d,%rax
+}
+  804f15:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804f1c:	5b                   	pop    %rbx
+  804f1d:	41 5c                	pop    %r12
+  804f1f:	41 5d                	pop    %r13
+  804f21:	41 5e                	pop    %r14
+  804f23:	41 5f                	pop    %r15
+  804f25:	5d                   	pop    %rbp
+  804f26:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804f27:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f2d:	eb e3                	jmp    804f12 <devcons_write+0x117>
+
+0000000000804f2f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f2f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804f32:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f37:	48 85 c0             	test   %rax,%rax
+  804f3a:	74 55                	je     804f91 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f3c:	55                   	push   %rbp
+  804f3d:	48 89 e5             	mov    %rsp,%rbp
+  804f40:	41 55                	push   %r13
+  804f42:	41 54                	push   %r12
+  804f44:	53                   	push   %rbx
+  804f45:	48 83 ec 08          	sub    $0x8,%rsp
+  804f49:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804f4c:	48 bb 87 25 80 00 00 	movabs $0x802587,%rbx
+  804f53:	00 00 00 
+  804f56:	49 bc 9b 26 80 00 00 	movabs $0x80269b,%r12
+  804f5d:	00 00 00 
+  804f60:	eb 03                	jmp    804f65 <devcons_read+0x36>
+  804f62:	41 ff d4             	call   *%r12
+  804f65:	ff d3                	call   *%rbx
+  804f67:	85 c0                	test   %eax,%eax
+  804f69:	74 f7                	je     804f62 <devcons_read+0x33>
+    if (c < 0) return c;
+  804f6b:	48 63 d0             	movslq %eax,%rdx
+  804f6e:	78 13                	js     804f83 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f75:	83 f8 04             	cmp    $0x4,%eax
+  804f78:	74 09                	je     804f83 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804f7a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804f7e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804f83:	48 89 d0             	mov    %rdx,%rax
+  804f86:	48 83 c4 08          	add    $0x8,%rsp
+  804f8a:	5b                   	pop    %rbx
+  804f8b:	41 5c                	pop    %r12
+  804f8d:	41 5d                	pop    %r13
+  804f8f:	5d                   	pop    %rbp
+  804f90:	c3                   	ret
+  804f91:	48 89 d0             	mov    %rdx,%rax
+  804f94:	c3                   	ret
+
+0000000000804f95 <cputchar>:
+cputchar(int ch) {
+  804f95:	55                   	push   %rbp
+  804f96:	48 89 e5             	mov    %rsp,%rbp
+  804f99:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804f9d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804fa1:	be 01 00 00 00       	mov    $0x1,%esi
+  804fa6:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804faa:	48 b8 54 25 80 00 00 	movabs $0x802554,%rax
+  804fb1:	00 00 00 
+  804fb4:	ff d0                	call   *%rax
+}
+  804fb6:	c9                   	leave
+  804fb7:	c3                   	ret
+
+0000000000804fb8 <getchar>:
+getchar(void) {
+  804fb8:	55                   	push   %rbp
+  804fb9:	48 89 e5             	mov    %rsp,%rbp
+  804fbc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804fc0:	ba 01 00 00 00       	mov    $0x1,%edx
+  804fc5:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fce:	48 b8 0b 31 80 00 00 	movabs $0x80310b,%rax
+  804fd5:	00 00 00 
+  804fd8:	ff d0                	call   *%rax
+  804fda:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804fdc:	85 c0                	test   %eax,%eax
+  804fde:	78 06                	js     804fe6 <getchar+0x2e>
+  804fe0:	74 08                	je     804fea <getchar+0x32>
+  804fe2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804fe6:	89 d0                	mov    %edx,%eax
+  804fe8:	c9                   	leave
+  804fe9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804fea:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804fef:	eb f5                	jmp    804fe6 <getchar+0x2e>
+
+0000000000804ff1 <iscons>:
+iscons(int fdnum) {
+  804ff1:	55                   	push   %rbp
+  804ff2:	48 89 e5             	mov    %rsp,%rbp
+  804ff5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ff9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804ffd:	48 b8 28 2e 80 00 00 	movabs $0x802e28,%rax
+  805004:	00 00 00 
+  805007:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805009:	85 c0                	test   %eax,%eax
+  80500b:	78 18                	js     805025 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80500d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805011:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805018:	00 00 00 
+  80501b:	8b 00                	mov    (%rax),%eax
+  80501d:	39 02                	cmp    %eax,(%rdx)
+  80501f:	0f 94 c0             	sete   %al
+  805022:	0f b6 c0             	movzbl %al,%eax
+}
+  805025:	c9                   	leave
+  805026:	c3                   	ret
+
+0000000000805027 <opencons>:
+opencons(void) {
+  805027:	55                   	push   %rbp
+  805028:	48 89 e5             	mov    %rsp,%rbp
+  80502b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80502f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805033:	48 b8 c8 2d 80 00 00 	movabs $0x802dc8,%rax
+  80503a:	00 00 00 
+  80503d:	ff d0                	call   *%rax
+  80503f:	85 c0                	test   %eax,%eax
+  805041:	78 49                	js     80508c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805043:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805048:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80504d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805051:	bf 00 00 00 00       	mov    $0x0,%edi
+  805056:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  80505d:	00 00 00 
+  805060:	ff d0                	call   *%rax
+  805062:	85 c0                	test   %eax,%eax
+  805064:	78 26                	js     80508c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805066:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80506a:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805071:	00 00 
+  805073:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805075:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805079:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805080:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  805087:	00 00 00 
+  80508a:	ff d0                	call   *%rax
+}
+  80508c:	c9                   	leave
+  80508d:	c3                   	ret
+
+000000000080508e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80508e:	55                   	push   %rbp
+  80508f:	48 89 e5             	mov    %rsp,%rbp
+  805092:	41 56                	push   %r14
+  805094:	41 55                	push   %r13
+  805096:	41 54                	push   %r12
+  805098:	53                   	push   %rbx
+  805099:	48 83 ec 50          	sub    $0x50,%rsp
+  80509d:	49 89 fc             	mov    %rdi,%r12
+  8050a0:	41 89 f5             	mov    %esi,%r13d
+  8050a3:	48 89 d3             	mov    %rdx,%rbx
+  8050a6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8050aa:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8050ae:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8050b2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8050b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8050bd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8050c1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8050c5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8050c9:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8050d0:	00 00 00 
+  8050d3:	4c 8b 30             	mov    (%rax),%r14
+  8050d6:	48 b8 64 26 80 00 00 	movabs $0x802664,%rax
+  8050dd:	00 00 00 
+  8050e0:	ff d0                	call   *%rax
+  8050e2:	89 c6                	mov    %eax,%esi
+  8050e4:	45 89 e8             	mov    %r13d,%r8d
+  8050e7:	4c 89 e1             	mov    %r12,%rcx
+  8050ea:	4c 89 f2             	mov    %r14,%rdx
+  8050ed:	48 bf f8 62 80 00 00 	movabs $0x8062f8,%rdi
+  8050f4:	00 00 00 
+  8050f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050fc:	49 bc a0 16 80 00 00 	movabs $0x8016a0,%r12
+  805103:	00 00 00 
+  805106:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805109:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80510d:	48 89 df             	mov    %rbx,%rdi
+  805110:	48 b8 3c 16 80 00 00 	movabs $0x80163c,%rax
+  805117:	00 00 00 
+  80511a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80511c:	48 bf 24 5c 80 00 00 	movabs $0x805c24,%rdi
+  805123:	00 00 00 
+  805126:	b8 00 00 00 00       	mov    $0x0,%eax
+  80512b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80512e:	cc                   	int3
+  80512f:	eb fd                	jmp    80512e <_panic+0xa0>
+
+0000000000805131 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805131:	55                   	push   %rbp
+  805132:	48 89 e5             	mov    %rsp,%rbp
+  805135:	41 56                	push   %r14
+  805137:	41 55                	push   %r13
+  805139:	41 54                	push   %r12
+  80513b:	53                   	push   %rbx
+  80513c:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80513f:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805146:	00 00 00 
+  805149:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80514d:	74 27                	je     805176 <_handle_vectored_pagefault+0x45>
+  80514f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805154:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80515b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80515e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805161:	4c 89 e7             	mov    %r12,%rdi
+  805164:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805169:	84 c0                	test   %al,%al
+  80516b:	75 45                	jne    8051b2 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80516d:	48 83 c3 01          	add    $0x1,%rbx
+  805171:	49 3b 1e             	cmp    (%r14),%rbx
+  805174:	72 eb                	jb     805161 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805176:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80517d:	00 
+  80517e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805183:	4d 8b 04 24          	mov    (%r12),%r8
+  805187:	48 ba 20 63 80 00 00 	movabs $0x806320,%rdx
+  80518e:	00 00 00 
+  805191:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805196:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  80519d:	00 00 00 
+  8051a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a5:	49 ba 8e 50 80 00 00 	movabs $0x80508e,%r10
+  8051ac:	00 00 00 
+  8051af:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051b2:	5b                   	pop    %rbx
+  8051b3:	41 5c                	pop    %r12
+  8051b5:	41 5d                	pop    %r13
+  8051b7:	41 5e                	pop    %r14
+  8051b9:	5d                   	pop    %rbp
+  8051ba:	c3                   	ret
+
+00000000008051bb <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051bb:	55                   	push   %rbp
+  8051bc:	48 89 e5             	mov    %rsp,%rbp
+  8051bf:	53                   	push   %rbx
+  8051c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8051c4:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8051c7:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8051cc:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8051d3:	00 00 00 
+  8051d6:	80 38 00             	cmpb   $0x0,(%rax)
+  8051d9:	74 68                	je     805243 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051db:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e2:	00 00 00 
+  8051e5:	48 8b 08             	mov    (%rax),%rcx
+  8051e8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8051ed:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8051f4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f7:	48 85 c9             	test   %rcx,%rcx
+  8051fa:	0f 84 e0 00 00 00    	je     8052e0 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805200:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805204:	0f 84 c9 00 00 00    	je     8052d3 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520a:	48 83 c2 01          	add    $0x1,%rdx
+  80520e:	48 39 ca             	cmp    %rcx,%rdx
+  805211:	75 ed                	jne    805200 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805213:	48 83 f9 08          	cmp    $0x8,%rcx
+  805217:	0f 84 84 00 00 00    	je     8052a1 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80521d:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805221:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805228:	00 00 00 
+  80522b:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805232:	00 00 00 
+  805235:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805239:	85 f6                	test   %esi,%esi
+  80523b:	0f 89 97 00 00 00    	jns    8052d8 <add_pgfault_handler+0x11d>
+  805241:	eb 63                	jmp    8052a6 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805243:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805248:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80524d:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805254:	00 00 00 
+  805257:	bf 00 00 00 00       	mov    $0x0,%edi
+  80525c:	48 b8 3c 27 80 00 00 	movabs $0x80273c,%rax
+  805263:	00 00 00 
+  805266:	ff d0                	call   *%rax
+  805268:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80526a:	85 c0                	test   %eax,%eax
+  80526c:	78 38                	js     8052a6 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80526e:	48 be bc 53 80 00 00 	movabs $0x8053bc,%rsi
+  805275:	00 00 00 
+  805278:	bf 00 00 00 00       	mov    $0x0,%edi
+  80527d:	48 b8 5f 29 80 00 00 	movabs $0x80295f,%rax
+  805284:	00 00 00 
+  805287:	ff d0                	call   *%rax
+  805289:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80528b:	85 c0                	test   %eax,%eax
+  80528d:	78 17                	js     8052a6 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80528f:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805296:	00 00 00 
+  805299:	c6 00 01             	movb   $0x1,(%rax)
+  80529c:	e9 3a ff ff ff       	jmp    8051db <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8052a1:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052a6:	89 f1                	mov    %esi,%ecx
+  8052a8:	48 ba 5e 63 80 00 00 	movabs $0x80635e,%rdx
+  8052af:	00 00 00 
+  8052b2:	be 42 00 00 00       	mov    $0x42,%esi
+  8052b7:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  8052be:	00 00 00 
+  8052c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c6:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  8052cd:	00 00 00 
+  8052d0:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052d3:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8052d8:	89 f0                	mov    %esi,%eax
+  8052da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052de:	c9                   	leave
+  8052df:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e0:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8052e7:	00 00 00 
+  8052ea:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8052f1:	48 89 d8             	mov    %rbx,%rax
+  8052f4:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8052fb:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052fe:	eb d8                	jmp    8052d8 <add_pgfault_handler+0x11d>
+
+0000000000805300 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805300:	55                   	push   %rbp
+  805301:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805304:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80530b:	00 00 00 
+  80530e:	80 38 00             	cmpb   $0x0,(%rax)
+  805311:	74 33                	je     805346 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805313:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80531a:	00 00 00 
+  80531d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805322:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805329:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80532c:	48 85 c0             	test   %rax,%rax
+  80532f:	0f 84 85 00 00 00    	je     8053ba <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805335:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805339:	74 40                	je     80537b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80533b:	48 83 c1 01          	add    $0x1,%rcx
+  80533f:	48 39 c1             	cmp    %rax,%rcx
+  805342:	75 f1                	jne    805335 <remove_pgfault_handler+0x35>
+  805344:	eb 74                	jmp    8053ba <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805346:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  80534d:	00 00 00 
+  805350:	48 ba 36 62 80 00 00 	movabs $0x806236,%rdx
+  805357:	00 00 00 
+  80535a:	be 48 00 00 00       	mov    $0x48,%esi
+  80535f:	48 bf 50 63 80 00 00 	movabs $0x806350,%rdi
+  805366:	00 00 00 
+  805369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80536e:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  805375:	00 00 00 
+  805378:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80537b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805382:	00 
+  805383:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805387:	48 29 ca             	sub    %rcx,%rdx
+  80538a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805391:	00 00 00 
+  805394:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805398:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80539d:	48 89 ce             	mov    %rcx,%rsi
+  8053a0:	48 b8 27 23 80 00 00 	movabs $0x802327,%rax
+  8053a7:	00 00 00 
+  8053aa:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053ac:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053b3:	00 00 00 
+  8053b6:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053ba:	5d                   	pop    %rbp
+  8053bb:	c3                   	ret
+
+00000000008053bc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053bc:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053bf:	48 b8 31 51 80 00 00 	movabs $0x805131,%rax
+  8053c6:	00 00 00 
+    call *%rax
+  8053c9:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8053cb:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8053d2:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8053d3:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8053da:	00 
+    subq $8, %rcx
+  8053db:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8053df:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8053e2:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8053e9:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8053ea:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8053ee:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8053f2:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8053f7:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8053fc:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805401:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805406:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80540b:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805410:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805415:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80541a:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80541f:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805424:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805429:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80542e:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805433:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805438:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80543c:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805440:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805441:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805442:	c3                   	ret
+
+0000000000805443 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805443:	85 ff                	test   %edi,%edi
+  805445:	78 58                	js     80549f <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805447:	48 85 f6             	test   %rsi,%rsi
+  80544a:	74 12                	je     80545e <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80544c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805453:	00 00 00 
+  805456:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80545c:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80545e:	48 85 c9             	test   %rcx,%rcx
+  805461:	74 12                	je     805475 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805463:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80546a:	00 00 00 
+  80546d:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805473:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805475:	48 85 d2             	test   %rdx,%rdx
+  805478:	74 14                	je     80548e <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80547a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805481:	00 00 00 
+  805484:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80548b:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80548e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805495:	00 00 00 
+  805498:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80549e:	c3                   	ret
+        if (from_env_store) {
+  80549f:	48 85 f6             	test   %rsi,%rsi
+  8054a2:	74 06                	je     8054aa <ipc_result+0x67>
+            *from_env_store = 0;
+  8054a4:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8054aa:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8054ac:	48 85 c9             	test   %rcx,%rcx
+  8054af:	74 ed                	je     80549e <ipc_result+0x5b>
+            *perm_store = 0;
+  8054b1:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8054b7:	c3                   	ret
+
+00000000008054b8 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8054b8:	55                   	push   %rbp
+  8054b9:	48 89 e5             	mov    %rsp,%rbp
+  8054bc:	41 55                	push   %r13
+  8054be:	41 54                	push   %r12
+  8054c0:	53                   	push   %rbx
+  8054c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8054c5:	49 89 fc             	mov    %rdi,%r12
+  8054c8:	48 89 f7             	mov    %rsi,%rdi
+  8054cb:	48 89 d3             	mov    %rdx,%rbx
+  8054ce:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8054d1:	48 85 f6             	test   %rsi,%rsi
+  8054d4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054db:	00 00 00 
+  8054de:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8054e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8054e7:	48 85 d2             	test   %rdx,%rdx
+  8054ea:	74 03                	je     8054ef <ipc_recv+0x37>
+  8054ec:	48 8b 32             	mov    (%rdx),%rsi
+  8054ef:	48 b8 88 2c 80 00 00 	movabs $0x802c88,%rax
+  8054f6:	00 00 00 
+  8054f9:	ff d0                	call   *%rax
+  8054fb:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8054fd:	4c 89 e9             	mov    %r13,%rcx
+  805500:	48 89 da             	mov    %rbx,%rdx
+  805503:	4c 89 e6             	mov    %r12,%rsi
+  805506:	48 b8 43 54 80 00 00 	movabs $0x805443,%rax
+  80550d:	00 00 00 
+  805510:	ff d0                	call   *%rax
+}
+  805512:	48 83 c4 08          	add    $0x8,%rsp
+  805516:	5b                   	pop    %rbx
+  805517:	41 5c                	pop    %r12
+  805519:	41 5d                	pop    %r13
+  80551b:	5d                   	pop    %rbp
+  80551c:	c3                   	ret
+
+000000000080551d <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80551d:	55                   	push   %rbp
+  80551e:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805521:	48 85 d2             	test   %rdx,%rdx
+  805524:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80552b:	00 00 00 
+  80552e:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805532:	89 f6                	mov    %esi,%esi
+  805534:	48 b8 14 2b 80 00 00 	movabs $0x802b14,%rax
+  80553b:	00 00 00 
+  80553e:	ff d0                	call   *%rax
+    if (res < 0) {
+  805540:	85 c0                	test   %eax,%eax
+  805542:	78 02                	js     805546 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805544:	5d                   	pop    %rbp
+  805545:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805546:	89 c1                	mov    %eax,%ecx
+  805548:	48 ba 90 63 80 00 00 	movabs $0x806390,%rdx
+  80554f:	00 00 00 
+  805552:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805557:	48 bf 9d 63 80 00 00 	movabs $0x80639d,%rdi
+  80555e:	00 00 00 
+  805561:	b8 00 00 00 00       	mov    $0x0,%eax
+  805566:	49 b8 8e 50 80 00 00 	movabs $0x80508e,%r8
+  80556d:	00 00 00 
+  805570:	41 ff d0             	call   *%r8
+
+0000000000805573 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805573:	55                   	push   %rbp
+  805574:	48 89 e5             	mov    %rsp,%rbp
+  805577:	53                   	push   %rbx
+  805578:	48 83 ec 08          	sub    $0x8,%rsp
+  80557c:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805580:	48 85 d2             	test   %rdx,%rdx
+  805583:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80558a:	00 00 00 
+  80558d:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805591:	4d 85 c9             	test   %r9,%r9
+  805594:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805598:	b8 00 00 00 00       	mov    $0x0,%eax
+  80559d:	48 85 db             	test   %rbx,%rbx
+  8055a0:	74 03                	je     8055a5 <ipc_call+0x32>
+  8055a2:	48 8b 03             	mov    (%rbx),%rax
+  8055a5:	89 f6                	mov    %esi,%esi
+  8055a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8055ab:	50                   	push   %rax
+  8055ac:	48 b8 46 2b 80 00 00 	movabs $0x802b46,%rax
+  8055b3:	00 00 00 
+  8055b6:	ff d0                	call   *%rax
+  8055b8:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8055ba:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8055be:	48 89 da             	mov    %rbx,%rdx
+  8055c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8055c6:	48 b8 43 54 80 00 00 	movabs $0x805443,%rax
+  8055cd:	00 00 00 
+  8055d0:	ff d0                	call   *%rax
+}
+  8055d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055d6:	c9                   	leave
+  8055d7:	c3                   	ret
+
+00000000008055d8 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8055d8:	55                   	push   %rbp
+  8055d9:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8055dc:	89 f6                	mov    %esi,%esi
+  8055de:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8055e5:	00 00 00 
+  8055e8:	ff d0                	call   *%rax
+  8055ea:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8055ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8055f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8055fb:	48 b8 43 54 80 00 00 	movabs $0x805443,%rax
+  805602:	00 00 00 
+  805605:	ff d0                	call   *%rax
+}
+  805607:	5d                   	pop    %rbp
+  805608:	c3                   	ret
+
+0000000000805609 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805609:	55                   	push   %rbp
+  80560a:	48 89 e5             	mov    %rsp,%rbp
+  80560d:	41 54                	push   %r12
+  80560f:	53                   	push   %rbx
+  805610:	4c 89 cb             	mov    %r9,%rbx
+  805613:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805617:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80561b:	48 85 d2             	test   %rdx,%rdx
+  80561e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805625:	00 00 00 
+  805628:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80562c:	4d 85 c9             	test   %r9,%r9
+  80562f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805633:	b8 00 00 00 00       	mov    $0x0,%eax
+  805638:	4d 85 e4             	test   %r12,%r12
+  80563b:	74 04                	je     805641 <ipc_reply_wait+0x38>
+  80563d:	49 8b 04 24          	mov    (%r12),%rax
+  805641:	89 f6                	mov    %esi,%esi
+  805643:	48 83 ec 08          	sub    $0x8,%rsp
+  805647:	50                   	push   %rax
+  805648:	48 b8 1c 2c 80 00 00 	movabs $0x802c1c,%rax
+  80564f:	00 00 00 
+  805652:	ff d0                	call   *%rax
+  805654:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805656:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  80565a:	4c 89 e2             	mov    %r12,%rdx
+  80565d:	48 89 de             	mov    %rbx,%rsi
+  805660:	48 b8 43 54 80 00 00 	movabs $0x805443,%rax
+  805667:	00 00 00 
+  80566a:	ff d0                	call   *%rax
+}
+  80566c:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805670:	5b                   	pop    %rbx
+  805671:	41 5c                	pop    %r12
+  805673:	5d                   	pop    %rbp
+  805674:	c3                   	ret
+
+0000000000805675 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805675:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  80567a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805681:	00 00 00 
+  805684:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  80568b:	48 01 ca             	add    %rcx,%rdx
+  80568e:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805694:	39 fa                	cmp    %edi,%edx
+  805696:	74 12                	je     8056aa <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805698:	48 83 c0 01          	add    $0x1,%rax
+  80569c:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8056a2:	75 e0                	jne    805684 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8056a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056a9:	c3                   	ret
+            return envs[i].env_id;
+  8056aa:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8056b1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8056b8:	00 00 00 
+  8056bb:	48 01 d0             	add    %rdx,%rax
+  8056be:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8056c4:	c3                   	ret
+  8056c5:	0f 1f 00             	nopl   (%rax)
+
+00000000008056c8 <__rodata_start>:
+  8056c8:	77 00                	ja     8056ca <__rodata_start+0x2>
+  8056ca:	72 62                	jb     80572e <__rodata_start+0x66>
+  8056cc:	00 77 62             	add    %dh,0x62(%rdi)
+  8056cf:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8056d2:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8056d9:	00 
+  8056da:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  8056e0:	b3 09                	mov    $0x9,%bl
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 ed                	add    %ch,%ch
+  8056e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	ed                   	in     (%dx),%eax
+  8056f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8056f6:	00 00                	add    %al,(%rax)
+  8056f8:	ed                   	in     (%dx),%eax
+  8056f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8056fe:	00 00                	add    %al,(%rax)
+  805700:	ed                   	in     (%dx),%eax
+  805701:	0d 80 00 00 00       	or     $0x80,%eax
+  805706:	00 00                	add    %al,(%rax)
+  805708:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 ed                	add    %ch,%ch
+  805711:	0d 80 00 00 00       	or     $0x80,%eax
+  805716:	00 00                	add    %al,(%rax)
+  805718:	ed                   	in     (%dx),%eax
+  805719:	0d 80 00 00 00       	or     $0x80,%eax
+  80571e:	00 00                	add    %al,(%rax)
+  805720:	ed                   	in     (%dx),%eax
+  805721:	0d 80 00 00 00       	or     $0x80,%eax
+  805726:	00 00                	add    %al,(%rax)
+  805728:	ed                   	in     (%dx),%eax
+  805729:	0d 80 00 00 00       	or     $0x80,%eax
+  80572e:	00 00                	add    %al,(%rax)
+  805730:	ed                   	in     (%dx),%eax
+  805731:	0d 80 00 00 00       	or     $0x80,%eax
+  805736:	00 00                	add    %al,(%rax)
+  805738:	8c 0a                	mov    %cs,(%rdx)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805746:	00 00                	add    %al,(%rax)
+  805748:	8c 0a                	mov    %cs,(%rdx)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805756:	00 00                	add    %al,(%rax)
+  805758:	8c 0a                	mov    %cs,(%rdx)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805766:	00 00                	add    %al,(%rax)
+  805768:	8c 0a                	mov    %cs,(%rdx)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805776:	00 00                	add    %al,(%rax)
+  805778:	8c 0a                	mov    %cs,(%rdx)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805786:	00 00                	add    %al,(%rax)
+  805788:	ed                   	in     (%dx),%eax
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	ed                   	in     (%dx),%eax
+  8057a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ae:	00 00                	add    %al,(%rax)
+  8057b0:	ed                   	in     (%dx),%eax
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	ed                   	in     (%dx),%eax
+  8057d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057de:	00 00                	add    %al,(%rax)
+  8057e0:	ed                   	in     (%dx),%eax
+  8057e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	ed                   	in     (%dx),%eax
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	ed                   	in     (%dx),%eax
+  805809:	0d 80 00 00 00       	or     $0x80,%eax
+  80580e:	00 00                	add    %al,(%rax)
+  805810:	ed                   	in     (%dx),%eax
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	f4                   	hlt
+  805879:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80587f:	00 ed                	add    %ch,%ch
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	2c 0b                	sub    $0xb,%al
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 ed                	add    %ch,%ch
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8058d3:	00 00                	add    %al,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 cb                	add    %cl,%bl
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	6a 0a                	push   $0xa
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ed                	add    %ch,%ch
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	3c 0a                	cmp    $0xa,%al
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 29                	add    %ch,(%rcx)
+  805939:	0c 80                	or     $0x80,%al
+  80593b:	00 00                	add    %al,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	1a 0b                	sbb    (%rbx),%cl
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 ed                	add    %ch,%ch
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ce                   	(bad)
+  805961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805967:	00 ed                	add    %ch,%ch
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 37                	add    %dh,(%rdi)
+  805981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 37                	add    %dh,(%rdi)
+  805991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805997:	00 5f 12             	add    %bl,0x12(%rdi)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059a2:	80 00 00             	addb   $0x0,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 d2                	add    %dl,%dl
+  8059b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059b7:	00 d2                	add    %dl,%dl
+  8059b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059bf:	00 d2                	add    %dl,%dl
+  8059c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059c7:	00 d2                	add    %dl,%dl
+  8059c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059cf:	00 d2                	add    %dl,%dl
+  8059d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059d7:	00 d2                	add    %dl,%dl
+  8059d9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059df:	00 d2                	add    %dl,%dl
+  8059e1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059e7:	00 f6                	add    %dh,%dh
+  8059e9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059ef:	00 f6                	add    %dh,%dh
+  8059f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8059f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a12:	80 00 00             	addb   $0x0,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 22                	add    %ah,(%rdx)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 22                	add    %ah,(%rdx)
+  805a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a3f:	00 22                	add    %ah,(%rdx)
+  805a41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a47:	00 22                	add    %ah,(%rdx)
+  805a49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a4f:	00 22                	add    %ah,(%rdx)
+  805a51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a57:	00 22                	add    %ah,(%rdx)
+  805a59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 46 12             	add    %al,0x12(%rsi)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805c00 <basefix.0>:
+  805c00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805c10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805c20:	10 00 25 64 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     ..%d..<unknown>.
+  805c30:	30 31 32 33 34 35 36 37 38 39 41 42 43 44 45 46     0123456789ABCDEF
+  805c40:	00 30 31 32 33 34 35 36 37 38 39 61 62 63 64 65     .0123456789abcde
+  805c50:	66 00 28 6e 75 6c 6c 29 00 65 72 72 6f 72 20 25     f.(null).error %
+  805c60:	64 00 75 6e 73 70 65 63 69 66 69 65 64 20 65 72     d.unspecified er
+  805c70:	72 6f 72 00 62 61 64 20 65 6e 76 69 72 6f 6e 6d     ror.bad environm
+  805c80:	65 6e 74 00 69 6e 76 61 6c 69 64 20 70 61 72 61     ent.invalid para
+  805c90:	6d 65 74 65 72 00 6f 75 74 20 6f 66 20 6d 65 6d     meter.out of mem
+  805ca0:	6f 72 79 00 6f 75 74 20 6f 66 20 65 6e 76 69 72     ory.out of envir
+  805cb0:	6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75 70 74 65     onments.corrupte
+  805cc0:	64 20 64 65 62 75 67 20 69 6e 66 6f 00 73 65 67     d debug info.seg
+  805cd0:	6d 65 6e 74 61 74 69 6f 6e 20 66 61 75 6c 74 00     mentation fault.
+  805ce0:	69 6e 76 61 6c 69 64 20 45 4c 46 20 69 6d 61 67     invalid ELF imag
+  805cf0:	65 00 6e 6f 20 73 75 63 68 20 73 79 73 74 65 6d     e.no such system
+  805d00:	20 63 61 6c 6c 00 65 6e 74 72 79 20 6e 6f 74 20      call.entry not 
+  805d10:	66 6f 75 6e 64 00 65 6e 76 20 69 73 20 6e 6f 74     found.env is not
+  805d20:	20 72 65 63 76 69 6e 67 00 75 6e 65 78 70 65 63      recving.unexpec
+  805d30:	74 65 64 20 65 6e 64 20 6f 66 20 66 69 6c 65 00     ted end of file.
+  805d40:	6e 6f 20 66 72 65 65 20 73 70 61 63 65 20 6f 6e     no free space on
+  805d50:	20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e 79 20 66      disk.too many f
+  805d60:	69 6c 65 73 20 61 72 65 20 6f 70 65 6e 00 66 69     iles are open.fi
+  805d70:	6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e 6f 74 20     le or block not 
+  805d80:	66 6f 75 6e 64 00 69 6e 76 61 6c 69 64 20 70 61     found.invalid pa
+  805d90:	74 68 00 66 69 6c 65 20 61 6c 72 65 61 64 79 20     th.file already 
+  805da0:	65 78 69 73 74 73 00 6f 70 65 72 61 74 69 6f 6e     exists.operation
+  805db0:	20 6e 6f 74 20 73 75 70 70 6f 72 74 65 64 00 90      not supported..
+  805dc0:	98 18 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805dd0:	df 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805de0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805df0:	ef 1e 80 00 00 00 00 00 b7 18 80 00 00 00 00 00     ................
+  805e00:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805e10:	ab 18 80 00 00 00 00 00 25 19 80 00 00 00 00 00     ........%.......
+  805e20:	ef 1e 80 00 00 00 00 00 ab 18 80 00 00 00 00 00     ................
+  805e30:	f1 18 80 00 00 00 00 00 f1 18 80 00 00 00 00 00     ................
+  805e40:	f1 18 80 00 00 00 00 00 f1 18 80 00 00 00 00 00     ................
+  805e50:	f1 18 80 00 00 00 00 00 f1 18 80 00 00 00 00 00     ................
+  805e60:	f1 18 80 00 00 00 00 00 f1 18 80 00 00 00 00 00     ................
+  805e70:	f1 18 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805e80:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805e90:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805ea0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805eb0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805ec0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805ed0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805ee0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805ef0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f00:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f10:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f20:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f30:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f40:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f50:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f60:	ef 1e 80 00 00 00 00 00 0d 1e 80 00 00 00 00 00     ................
+  805f70:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f80:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805f90:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805fa0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805fb0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805fc0:	53 19 80 00 00 00 00 00 22 1b 80 00 00 00 00 00     S.......".......
+  805fd0:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  805fe0:	ef 1e 80 00 00 00 00 00 48 19 80 00 00 00 00 00     ........H.......
+  805ff0:	82 19 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  806000:	ef 1e 80 00 00 00 00 00 3d 19 80 00 00 00 00 00     ........=.......
+  806010:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  806020:	cb 1c 80 00 00 00 00 00 9a 1d 80 00 00 00 00 00     ................
+  806030:	ef 1e 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  806040:	19 1a 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  806050:	f6 1b 80 00 00 00 00 00 ef 1e 80 00 00 00 00 00     ................
+  806060:	ef 1e 80 00 00 00 00 00 0d 1e 80 00 00 00 00 00     ................
+  806070:	ef 1e 80 00 00 00 00 00 a1 18 80 00 00 00 00 00     ................
+
+0000000000806080 <error_string>:
+	...
+  806088:	62 5c 80 00 00 00 00 00 74 5c 80 00 00 00 00 00     b\......t\......
+  806098:	84 5c 80 00 00 00 00 00 96 5c 80 00 00 00 00 00     .\.......\......
+  8060a8:	a4 5c 80 00 00 00 00 00 b8 5c 80 00 00 00 00 00     .\.......\......
+  8060b8:	cd 5c 80 00 00 00 00 00 e0 5c 80 00 00 00 00 00     .\.......\......
+  8060c8:	f2 5c 80 00 00 00 00 00 06 5d 80 00 00 00 00 00     .\.......]......
+  8060d8:	16 5d 80 00 00 00 00 00 29 5d 80 00 00 00 00 00     .]......)]......
+  8060e8:	40 5d 80 00 00 00 00 00 56 5d 80 00 00 00 00 00     @]......V]......
+  8060f8:	6e 5d 80 00 00 00 00 00 86 5d 80 00 00 00 00 00     n].......]......
+  806108:	93 5d 80 00 00 00 00 00 20 61 80 00 00 00 00 00     .]...... a......
+  806118:	a7 5d 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .]......file is 
+  806128:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806138:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806148:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806158:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806168:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806178:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806188:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806198:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8061a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8061b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8061c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8061d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8061e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8061f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806200 <devtab>:
+  806200:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806210:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806220:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806230:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806240:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806250:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806260:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806270:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806280:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806290:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8062a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8062d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8062e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8062f0:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806300:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806310:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806320:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806330:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806340:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806350:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806360:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806370:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806380:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806390:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8063a0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8063b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8063c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8063d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8063e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8063f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8064d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8064e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8064f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,11520 @@
+
+obj/user/spawncache:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 2d 26 80 00 00 	movabs $0x80262d,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 76 41 80 00 00 	movabs $0x804176,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 bd 22 80 00 00 	movabs $0x8022bd,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 76 41 80 00 00 	movabs $0x804176,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 bd 22 80 00 00 	movabs $0x8022bd,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be c7 6b 80 00 00 	movabs $0x806bc7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 20 65 80 00 00 	movabs $0x806520,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 22 65 80 00 00 	movabs $0x806522,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 25 65 80 00 00 	movabs $0x806525,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 4d 24 80 00 00 	movabs $0x80244d,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 08 59 80 00 00 	movabs $0x805908,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 df 5b 80 00 00 	movabs $0x805bdf,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 8a 38 80 00 00 	movabs $0x80388a,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 53 39 80 00 00 	movabs $0x803953,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 59 38 80 00 00 	movabs $0x803859,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 59 38 80 00 00 	movabs $0x803859,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb fa 25 80 00 00 	movabs $0x8025fa,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 65 80 00 00 	movabs $0x806540,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 2d 26 80 00 00 	movabs $0x80262d,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc fa 25 80 00 00 	movabs $0x8025fa,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 67 80 00 00 	movabs $0x8067e0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf fa 25 80 00 00 	movabs $0x8025fa,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf fa 25 80 00 00 	movabs $0x8025fa,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 6a 80 00 00 	movabs $0x806a60,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 6a 80 00 00 	movabs $0x806a60,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 52 28 80 00 00 	movabs $0x802852,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 52 28 80 00 00 	movabs $0x802852,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 39 03 00 00       	call   801838 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <spawn_loaded>:
+    }
+    wait(child);
+}
+
+static void
+spawn_loaded(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    int res = spawnl(PROG, "hello", 0);
+  801505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150a:	48 be 83 6a 80 00 00 	movabs $0x806a83,%rsi
+  801511:	00 00 00 
+  801514:	48 bf 82 6a 80 00 00 	movabs $0x806a82,%rdi
+  80151b:	00 00 00 
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801523:	48 b9 5a 4a 80 00 00 	movabs $0x804a5a,%rcx
+  80152a:	00 00 00 
+  80152d:	ff d1                	call   *%rcx
+  80152f:	89 c7                	mov    %eax,%edi
+    if (res < 0) panic("spawn %s: %i", PROG, res);
+  801531:	85 c0                	test   %eax,%eax
+  801533:	78 0e                	js     801543 <spawn_loaded+0x42>
+    wait(res);
+  801535:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+}
+  801541:	5d                   	pop    %rbp
+  801542:	c3                   	ret
+    if (res < 0) panic("spawn %s: %i", PROG, res);
+  801543:	41 89 c0             	mov    %eax,%r8d
+  801546:	48 b9 82 6a 80 00 00 	movabs $0x806a82,%rcx
+  80154d:	00 00 00 
+  801550:	48 ba 89 6a 80 00 00 	movabs $0x806a89,%rdx
+  801557:	00 00 00 
+  80155a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80155f:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  801566:	00 00 00 
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  801575:	00 00 00 
+  801578:	41 ff d1             	call   *%r9
+
+000000000080157b <spawn_cached>:
+spawn_cached(void) {
+  80157b:	55                   	push   %rbp
+  80157c:	48 89 e5             	mov    %rsp,%rbp
+  80157f:	53                   	push   %rbx
+  801580:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+    if ((res = stat(PROG, &st)) < 0) panic("stat %s: %i", PROG, res);
+  801587:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  80158e:	48 bf 82 6a 80 00 00 	movabs $0x806a82,%rdi
+  801595:	00 00 00 
+  801598:	48 b8 e8 39 80 00 00 	movabs $0x8039e8,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	0f 88 a4 00 00 00    	js     801650 <spawn_cached+0xd5>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, USER_STACK_SIZE, PROT_RW)) < 0)
+  8015ac:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8015b6:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  8015bd:	00 00 00 
+  8015c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c5:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	85 c0                	test   %eax,%eax
+  8015d3:	0f 88 af 00 00 00    	js     801688 <spawn_cached+0x10d>
+    struct SpawnImage img = {
+  8015d9:	48 8d bd 18 ff ff ff 	lea    -0xe8(%rbp),%rdi
+  8015e0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8015ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8015f1:	48 89 85 00 ff ff ff 	mov    %rax,-0x100(%rbp)
+            .key = {st.st_ino, st.st_size, st.st_version},
+  8015f8:	48 63 45 d0          	movslq -0x30(%rbp),%rax
+  8015fc:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  801603:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  801606:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+    struct SpawnImage img = {
+  80160d:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  801614:	00 00 00 
+  801617:	48 89 85 20 ff ff ff 	mov    %rax,-0xe0(%rbp)
+  80161e:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  801625:	00 00 00 
+  801628:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    res = sys_spawn(&img);
+  80162f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801636:	48 b8 61 2e 80 00 00 	movabs $0x802e61,%rax
+  80163d:	00 00 00 
+  801640:	ff d0                	call   *%rax
+  801642:	89 c3                	mov    %eax,%ebx
+    if (res < 0) sys_unmap_region(0, USPAWN_STAGING, USER_STACK_SIZE);
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 6d                	js     8016b5 <spawn_cached+0x13a>
+}
+  801648:	89 d8                	mov    %ebx,%eax
+  80164a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80164e:	c9                   	leave
+  80164f:	c3                   	ret
+    if ((res = stat(PROG, &st)) < 0) panic("stat %s: %i", PROG, res);
+  801650:	41 89 c0             	mov    %eax,%r8d
+  801653:	48 b9 82 6a 80 00 00 	movabs $0x806a82,%rcx
+  80165a:	00 00 00 
+  80165d:	48 ba a8 6a 80 00 00 	movabs $0x806aa8,%rdx
+  801664:	00 00 00 
+  801667:	be 0f 00 00 00       	mov    $0xf,%esi
+  80166c:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  801673:	00 00 00 
+  801676:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167b:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  801682:	00 00 00 
+  801685:	41 ff d1             	call   *%r9
+        panic("sys_alloc_region: %i", res);
+  801688:	89 c1                	mov    %eax,%ecx
+  80168a:	48 ba b4 6a 80 00 00 	movabs $0x806ab4,%rdx
+  801691:	00 00 00 
+  801694:	be 11 00 00 00       	mov    $0x11,%esi
+  801699:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  8016a0:	00 00 00 
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a8:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  8016af:	00 00 00 
+  8016b2:	41 ff d0             	call   *%r8
+    if (res < 0) sys_unmap_region(0, USPAWN_STAGING, USER_STACK_SIZE);
+  8016b5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8016ba:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  8016c1:	00 00 00 
+  8016c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c9:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  8016d0:	00 00 00 
+  8016d3:	ff d0                	call   *%rax
+    return res;
+  8016d5:	e9 6e ff ff ff       	jmp    801648 <spawn_cached+0xcd>
+
+00000000008016da <spawn_sibling>:
+
+static void
+spawn_sibling(void) {
+  8016da:	55                   	push   %rbp
+  8016db:	48 89 e5             	mov    %rsp,%rbp
+    int res = spawn_cached();
+  8016de:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  8016e5:	00 00 00 
+  8016e8:	ff d0                	call   *%rax
+  8016ea:	89 c7                	mov    %eax,%edi
+    if (res < 0) panic("%s is not cached for a sibling fork: %i", PROG, res);
+  8016ec:	85 c0                	test   %eax,%eax
+  8016ee:	78 0e                	js     8016fe <spawn_sibling+0x24>
+    wait(res);
+  8016f0:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+}
+  8016fc:	5d                   	pop    %rbp
+  8016fd:	c3                   	ret
+    if (res < 0) panic("%s is not cached for a sibling fork: %i", PROG, res);
+  8016fe:	41 89 c0             	mov    %eax,%r8d
+  801701:	48 b9 82 6a 80 00 00 	movabs $0x806a82,%rcx
+  801708:	00 00 00 
+  80170b:	48 ba e0 6a 80 00 00 	movabs $0x806ae0,%rdx
+  801712:	00 00 00 
+  801715:	be 34 00 00 00       	mov    $0x34,%esi
+  80171a:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  801721:	00 00 00 
+  801724:	b8 00 00 00 00       	mov    $0x0,%eax
+  801729:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  801730:	00 00 00 
+  801733:	41 ff d1             	call   *%r9
+
+0000000000801736 <run_forked>:
+run_forked(void (*fn)(void)) {
+  801736:	55                   	push   %rbp
+  801737:	48 89 e5             	mov    %rsp,%rbp
+  80173a:	41 54                	push   %r12
+  80173c:	53                   	push   %rbx
+  80173d:	49 89 fc             	mov    %rdi,%r12
+    envid_t child = fork();
+  801740:	48 b8 4e 31 80 00 00 	movabs $0x80314e,%rax
+  801747:	00 00 00 
+  80174a:	ff d0                	call   *%rax
+  80174c:	89 c3                	mov    %eax,%ebx
+    if (child < 0) panic("fork: %i", child);
+  80174e:	85 c0                	test   %eax,%eax
+  801750:	78 24                	js     801776 <run_forked+0x40>
+    if (!child) {
+  801752:	75 0f                	jne    801763 <run_forked+0x2d>
+        fn();
+  801754:	41 ff d4             	call   *%r12
+        exit();
+  801757:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  80175e:	00 00 00 
+  801761:	ff d0                	call   *%rax
+    wait(child);
+  801763:	89 df                	mov    %ebx,%edi
+  801765:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  80176c:	00 00 00 
+  80176f:	ff d0                	call   *%rax
+}
+  801771:	5b                   	pop    %rbx
+  801772:	41 5c                	pop    %r12
+  801774:	5d                   	pop    %rbp
+  801775:	c3                   	ret
+    if (child < 0) panic("fork: %i", child);
+  801776:	89 c1                	mov    %eax,%ecx
+  801778:	48 ba bc 70 80 00 00 	movabs $0x8070bc,%rdx
+  80177f:	00 00 00 
+  801782:	be 22 00 00 00       	mov    $0x22,%esi
+  801787:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  80179d:	00 00 00 
+  8017a0:	41 ff d0             	call   *%r8
+
+00000000008017a3 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	53                   	push   %rbx
+  8017a8:	48 83 ec 08          	sub    $0x8,%rsp
+    int res = spawn_cached();
+  8017ac:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+    if (res != -E_NOT_FOUND) panic("%s is cached before it was spawned: %i", PROG, res);
+  8017b8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8017bb:	75 43                	jne    801800 <umain+0x5d>
+
+    run_forked(spawn_loaded);
+  8017bd:	48 bf 01 15 80 00 00 	movabs $0x801501,%rdi
+  8017c4:	00 00 00 
+  8017c7:	48 bb 36 17 80 00 00 	movabs $0x801736,%rbx
+  8017ce:	00 00 00 
+  8017d1:	ff d3                	call   *%rbx
+    run_forked(spawn_sibling);
+  8017d3:	48 bf da 16 80 00 00 	movabs $0x8016da,%rdi
+  8017da:	00 00 00 
+  8017dd:	ff d3                	call   *%rbx
+
+    cprintf("spawncache: OK\n");
+  8017df:	48 bf c9 6a 80 00 00 	movabs $0x806ac9,%rdi
+  8017e6:	00 00 00 
+  8017e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ee:	48 ba 54 1a 80 00 00 	movabs $0x801a54,%rdx
+  8017f5:	00 00 00 
+  8017f8:	ff d2                	call   *%rdx
+}
+  8017fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017fe:	c9                   	leave
+  8017ff:	c3                   	ret
+    if (res != -E_NOT_FOUND) panic("%s is cached before it was spawned: %i", PROG, res);
+  801800:	41 89 c0             	mov    %eax,%r8d
+  801803:	48 b9 82 6a 80 00 00 	movabs $0x806a82,%rcx
+  80180a:	00 00 00 
+  80180d:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  801814:	00 00 00 
+  801817:	be 3b 00 00 00       	mov    $0x3b,%esi
+  80181c:	48 bf 96 6a 80 00 00 	movabs $0x806a96,%rdi
+  801823:	00 00 00 
+  801826:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182b:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  801832:	00 00 00 
+  801835:	41 ff d1             	call   *%r9
+
+0000000000801838 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801838:	55                   	push   %rbp
+  801839:	48 89 e5             	mov    %rsp,%rbp
+  80183c:	41 56                	push   %r14
+  80183e:	41 55                	push   %r13
+  801840:	41 54                	push   %r12
+  801842:	53                   	push   %rbx
+  801843:	41 89 fd             	mov    %edi,%r13d
+  801846:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801849:	48 ba f8 80 80 00 00 	movabs $0x8080f8,%rdx
+  801850:	00 00 00 
+  801853:	48 b8 f8 80 80 00 00 	movabs $0x8080f8,%rax
+  80185a:	00 00 00 
+  80185d:	48 39 c2             	cmp    %rax,%rdx
+  801860:	73 17                	jae    801879 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801862:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801865:	49 89 c4             	mov    %rax,%r12
+  801868:	48 83 c3 08          	add    $0x8,%rbx
+  80186c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801871:	ff 53 f8             	call   *-0x8(%rbx)
+  801874:	4c 39 e3             	cmp    %r12,%rbx
+  801877:	72 ef                	jb     801868 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801879:	48 b8 18 2a 80 00 00 	movabs $0x802a18,%rax
+  801880:	00 00 00 
+  801883:	ff d0                	call   *%rax
+  801885:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80188a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801891:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801898:	00 00 00 
+  80189b:	48 01 d0             	add    %rdx,%rax
+  80189e:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  8018a5:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8018a8:	45 85 ed             	test   %r13d,%r13d
+  8018ab:	7e 0d                	jle    8018ba <libmain+0x82>
+  8018ad:	49 8b 06             	mov    (%r14),%rax
+  8018b0:	48 a3 38 80 80 00 00 	movabs %rax,0x808038
+  8018b7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018ba:	4c 89 f6             	mov    %r14,%rsi
+  8018bd:	44 89 ef             	mov    %r13d,%edi
+  8018c0:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  8018c7:	00 00 00 
+  8018ca:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018cc:	48 b8 e1 18 80 00 00 	movabs $0x8018e1,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+#endif
+}
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	41 5d                	pop    %r13
+  8018dd:	41 5e                	pop    %r14
+  8018df:	5d                   	pop    %rbp
+  8018e0:	c3                   	ret
+
+00000000008018e1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018e1:	55                   	push   %rbp
+  8018e2:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018e5:	48 b8 26 35 80 00 00 	movabs $0x803526,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8018f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018f6:	48 b8 a7 29 80 00 00 	movabs $0x8029a7,%rax
+  8018fd:	00 00 00 
+  801900:	ff d0                	call   *%rax
+}
+  801902:	5d                   	pop    %rbp
+  801903:	c3                   	ret
+
+0000000000801904 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801904:	55                   	push   %rbp
+  801905:	48 89 e5             	mov    %rsp,%rbp
+  801908:	41 56                	push   %r14
+  80190a:	41 55                	push   %r13
+  80190c:	41 54                	push   %r12
+  80190e:	53                   	push   %rbx
+  80190f:	48 83 ec 50          	sub    $0x50,%rsp
+  801913:	49 89 fc             	mov    %rdi,%r12
+  801916:	41 89 f5             	mov    %esi,%r13d
+  801919:	48 89 d3             	mov    %rdx,%rbx
+  80191c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801920:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801924:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801928:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80192f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801933:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801937:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80193b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80193f:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  801946:	00 00 00 
+  801949:	4c 8b 30             	mov    (%rax),%r14
+  80194c:	48 b8 18 2a 80 00 00 	movabs $0x802a18,%rax
+  801953:	00 00 00 
+  801956:	ff d0                	call   *%rax
+  801958:	89 c6                	mov    %eax,%esi
+  80195a:	45 89 e8             	mov    %r13d,%r8d
+  80195d:	4c 89 e1             	mov    %r12,%rcx
+  801960:	4c 89 f2             	mov    %r14,%rdx
+  801963:	48 bf 40 6b 80 00 00 	movabs $0x806b40,%rdi
+  80196a:	00 00 00 
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801972:	49 bc 54 1a 80 00 00 	movabs $0x801a54,%r12
+  801979:	00 00 00 
+  80197c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80197f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801983:	48 89 df             	mov    %rbx,%rdi
+  801986:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  80198d:	00 00 00 
+  801990:	ff d0                	call   *%rax
+    cprintf("\n");
+  801992:	48 bf d7 6a 80 00 00 	movabs $0x806ad7,%rdi
+  801999:	00 00 00 
+  80199c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019a4:	cc                   	int3
+  8019a5:	eb fd                	jmp    8019a4 <_panic+0xa0>
+
+00000000008019a7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8019a7:	55                   	push   %rbp
+  8019a8:	48 89 e5             	mov    %rsp,%rbp
+  8019ab:	53                   	push   %rbx
+  8019ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8019b3:	8b 06                	mov    (%rsi),%eax
+  8019b5:	8d 50 01             	lea    0x1(%rax),%edx
+  8019b8:	89 16                	mov    %edx,(%rsi)
+  8019ba:	48 98                	cltq
+  8019bc:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019c1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019c7:	74 0a                	je     8019d3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019c9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019d3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019d7:	be ff 00 00 00       	mov    $0xff,%esi
+  8019dc:	48 b8 08 29 80 00 00 	movabs $0x802908,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8019e8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8019ee:	eb d9                	jmp    8019c9 <putch+0x22>
+
+00000000008019f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8019f0:	55                   	push   %rbp
+  8019f1:	48 89 e5             	mov    %rsp,%rbp
+  8019f4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8019fb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8019fe:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a05:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a12:	48 89 f1             	mov    %rsi,%rcx
+  801a15:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a1c:	48 bf a7 19 80 00 00 	movabs $0x8019a7,%rdi
+  801a23:	00 00 00 
+  801a26:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a32:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a39:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a40:	48 b8 08 29 80 00 00 	movabs $0x802908,%rax
+  801a47:	00 00 00 
+  801a4a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a4c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a52:	c9                   	leave
+  801a53:	c3                   	ret
+
+0000000000801a54 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a54:	55                   	push   %rbp
+  801a55:	48 89 e5             	mov    %rsp,%rbp
+  801a58:	48 83 ec 50          	sub    $0x50,%rsp
+  801a5c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a60:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a70:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a87:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a8b:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801a92:	00 00 00 
+  801a95:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a97:	c9                   	leave
+  801a98:	c3                   	ret
+
+0000000000801a99 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a99:	55                   	push   %rbp
+  801a9a:	48 89 e5             	mov    %rsp,%rbp
+  801a9d:	41 57                	push   %r15
+  801a9f:	41 56                	push   %r14
+  801aa1:	41 55                	push   %r13
+  801aa3:	41 54                	push   %r12
+  801aa5:	53                   	push   %rbx
+  801aa6:	48 83 ec 18          	sub    $0x18,%rsp
+  801aaa:	49 89 fc             	mov    %rdi,%r12
+  801aad:	49 89 f5             	mov    %rsi,%r13
+  801ab0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ab4:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ab7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801aba:	41 89 cf             	mov    %ecx,%r15d
+  801abd:	4c 39 fa             	cmp    %r15,%rdx
+  801ac0:	73 5b                	jae    801b1d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ac2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ac6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801aca:	85 db                	test   %ebx,%ebx
+  801acc:	7e 0e                	jle    801adc <print_num+0x43>
+            putch(padc, put_arg);
+  801ace:	4c 89 ee             	mov    %r13,%rsi
+  801ad1:	44 89 f7             	mov    %r14d,%edi
+  801ad4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ad7:	83 eb 01             	sub    $0x1,%ebx
+  801ada:	75 f2                	jne    801ace <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801adc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ae0:	48 b9 74 6b 80 00 00 	movabs $0x806b74,%rcx
+  801ae7:	00 00 00 
+  801aea:	48 b8 63 6b 80 00 00 	movabs $0x806b63,%rax
+  801af1:	00 00 00 
+  801af4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801af8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801afc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b01:	49 f7 f7             	div    %r15
+  801b04:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b08:	4c 89 ee             	mov    %r13,%rsi
+  801b0b:	41 ff d4             	call   *%r12
+}
+  801b0e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b12:	5b                   	pop    %rbx
+  801b13:	41 5c                	pop    %r12
+  801b15:	41 5d                	pop    %r13
+  801b17:	41 5e                	pop    %r14
+  801b19:	41 5f                	pop    %r15
+  801b1b:	5d                   	pop    %rbp
+  801b1c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b26:	49 f7 f7             	div    %r15
+  801b29:	48 83 ec 08          	sub    $0x8,%rsp
+  801b2d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b31:	52                   	push   %rdx
+  801b32:	45 0f be c9          	movsbl %r9b,%r9d
+  801b36:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b3a:	48 89 c2             	mov    %rax,%rdx
+  801b3d:	48 b8 99 1a 80 00 00 	movabs $0x801a99,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+  801b49:	48 83 c4 10          	add    $0x10,%rsp
+  801b4d:	eb 8d                	jmp    801adc <print_num+0x43>
+
+0000000000801b4f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b4f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b53:	48 8b 06             	mov    (%rsi),%rax
+  801b56:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b5a:	73 0a                	jae    801b66 <sprintputch+0x17>
+        *state->start++ = ch;
+  801b5c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b60:	48 89 16             	mov    %rdx,(%rsi)
+  801b63:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b66:	c3                   	ret
+
+0000000000801b67 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b67:	55                   	push   %rbp
+  801b68:	48 89 e5             	mov    %rsp,%rbp
+  801b6b:	48 83 ec 50          	sub    $0x50,%rsp
+  801b6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b7b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b8a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b92:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b96:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  801b9d:	00 00 00 
+  801ba0:	ff d0                	call   *%rax
+}
+  801ba2:	c9                   	leave
+  801ba3:	c3                   	ret
+
+0000000000801ba4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	41 57                	push   %r15
+  801baa:	41 56                	push   %r14
+  801bac:	41 55                	push   %r13
+  801bae:	41 54                	push   %r12
+  801bb0:	53                   	push   %rbx
+  801bb1:	48 83 ec 38          	sub    $0x38,%rsp
+  801bb5:	49 89 fe             	mov    %rdi,%r14
+  801bb8:	49 89 f5             	mov    %rsi,%r13
+  801bbb:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801bbe:	48 8b 01             	mov    (%rcx),%rax
+  801bc1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801bc5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801bc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bcd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801bd1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801bd5:	eb 0d                	jmp    801be4 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bd7:	40 0f b6 ff          	movzbl %dil,%edi
+  801bdb:	4c 89 ee             	mov    %r13,%rsi
+  801bde:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801be1:	4c 89 e3             	mov    %r12,%rbx
+  801be4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801be8:	0f b6 3b             	movzbl (%rbx),%edi
+  801beb:	40 80 ff 25          	cmp    $0x25,%dil
+  801bef:	74 14                	je     801c05 <vprintfmt+0x61>
+            if (!ch) return;
+  801bf1:	40 84 ff             	test   %dil,%dil
+  801bf4:	75 e1                	jne    801bd7 <vprintfmt+0x33>
+}
+  801bf6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bfa:	5b                   	pop    %rbx
+  801bfb:	41 5c                	pop    %r12
+  801bfd:	41 5d                	pop    %r13
+  801bff:	41 5e                	pop    %r14
+  801c01:	41 5f                	pop    %r15
+  801c03:	5d                   	pop    %rbp
+  801c04:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c05:	be 00 00 00 00       	mov    $0x0,%esi
+  801c0a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c0e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c13:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c19:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c20:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c24:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c29:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c2e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c31:	83 e8 23             	sub    $0x23,%eax
+  801c34:	3c 57                	cmp    $0x57,%al
+  801c36:	0f 87 67 06 00 00    	ja     8022a3 <vprintfmt+0x6ff>
+  801c3c:	0f b6 c0             	movzbl %al,%eax
+  801c3f:	48 b9 00 6d 80 00 00 	movabs $0x806d00,%rcx
+  801c46:	00 00 00 
+  801c49:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c4c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c4f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c53:	eb cf                	jmp    801c24 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c55:	49 89 dc             	mov    %rbx,%r12
+  801c58:	be 01 00 00 00       	mov    $0x1,%esi
+  801c5d:	eb c5                	jmp    801c24 <vprintfmt+0x80>
+            padc = ch;
+  801c5f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c63:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c66:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c69:	eb b9                	jmp    801c24 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c6e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c71:	77 24                	ja     801c97 <vprintfmt+0xf3>
+  801c73:	89 c1                	mov    %eax,%ecx
+  801c75:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c79:	83 c0 08             	add    $0x8,%eax
+  801c7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c7f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c82:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c85:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c89:	79 99                	jns    801c24 <vprintfmt+0x80>
+                width = precision;
+  801c8b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c8f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c95:	eb 8d                	jmp    801c24 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c97:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c9b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ca3:	eb da                	jmp    801c7f <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801ca5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801caa:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cae:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801cb4:	3c 39                	cmp    $0x39,%al
+  801cb6:	77 1c                	ja     801cd4 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801cb8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801cbc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801cc0:	0f b6 c0             	movzbl %al,%eax
+  801cc3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cc8:	0f b6 03             	movzbl (%rbx),%eax
+  801ccb:	3c 39                	cmp    $0x39,%al
+  801ccd:	76 e9                	jbe    801cb8 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801ccf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801cd2:	eb b1                	jmp    801c85 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801cd4:	49 89 dc             	mov    %rbx,%r12
+  801cd7:	eb ac                	jmp    801c85 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cd9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801cdc:	85 c9                	test   %ecx,%ecx
+  801cde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce3:	0f 49 c1             	cmovns %ecx,%eax
+  801ce6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ce9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cec:	e9 33 ff ff ff       	jmp    801c24 <vprintfmt+0x80>
+            lflag++;
+  801cf1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cf4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cf7:	e9 28 ff ff ff       	jmp    801c24 <vprintfmt+0x80>
+            lflag--;
+  801cfc:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d02:	e9 1d ff ff ff       	jmp    801c24 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d0a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d0d:	77 19                	ja     801d28 <vprintfmt+0x184>
+  801d0f:	89 c2                	mov    %eax,%edx
+  801d11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d15:	83 c0 08             	add    $0x8,%eax
+  801d18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d1b:	8b 3a                	mov    (%rdx),%edi
+  801d1d:	4c 89 ee             	mov    %r13,%rsi
+  801d20:	41 ff d6             	call   *%r14
+            break;
+  801d23:	e9 bc fe ff ff       	jmp    801be4 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d34:	eb e5                	jmp    801d1b <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d39:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3c:	77 5a                	ja     801d98 <vprintfmt+0x1f4>
+  801d3e:	89 c2                	mov    %eax,%edx
+  801d40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d44:	83 c0 08             	add    $0x8,%eax
+  801d47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d4a:	8b 02                	mov    (%rdx),%eax
+  801d4c:	89 c1                	mov    %eax,%ecx
+  801d4e:	f7 d9                	neg    %ecx
+  801d50:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d53:	83 f9 13             	cmp    $0x13,%ecx
+  801d56:	7f 4e                	jg     801da6 <vprintfmt+0x202>
+  801d58:	48 63 c1             	movslq %ecx,%rax
+  801d5b:	48 ba c0 6f 80 00 00 	movabs $0x806fc0,%rdx
+  801d62:	00 00 00 
+  801d65:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d69:	48 85 c0             	test   %rax,%rax
+  801d6c:	74 38                	je     801da6 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d6e:	48 89 c1             	mov    %rax,%rcx
+  801d71:	48 ba 08 72 80 00 00 	movabs $0x807208,%rdx
+  801d78:	00 00 00 
+  801d7b:	4c 89 ee             	mov    %r13,%rsi
+  801d7e:	4c 89 f7             	mov    %r14,%rdi
+  801d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d86:	49 b8 67 1b 80 00 00 	movabs $0x801b67,%r8
+  801d8d:	00 00 00 
+  801d90:	41 ff d0             	call   *%r8
+  801d93:	e9 4c fe ff ff       	jmp    801be4 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801da4:	eb a4                	jmp    801d4a <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801da6:	48 ba 8c 6b 80 00 00 	movabs $0x806b8c,%rdx
+  801dad:	00 00 00 
+  801db0:	4c 89 ee             	mov    %r13,%rsi
+  801db3:	4c 89 f7             	mov    %r14,%rdi
+  801db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbb:	49 b8 67 1b 80 00 00 	movabs $0x801b67,%r8
+  801dc2:	00 00 00 
+  801dc5:	41 ff d0             	call   *%r8
+  801dc8:	e9 17 fe ff ff       	jmp    801be4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd0:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd3:	77 6c                	ja     801e41 <vprintfmt+0x29d>
+  801dd5:	89 c2                	mov    %eax,%edx
+  801dd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ddb:	83 c0 08             	add    $0x8,%eax
+  801dde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de1:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801de4:	48 85 f6             	test   %rsi,%rsi
+  801de7:	48 b8 85 6b 80 00 00 	movabs $0x806b85,%rax
+  801dee:	00 00 00 
+  801df1:	48 0f 45 c6          	cmovne %rsi,%rax
+  801df5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801df9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801dfd:	7e 06                	jle    801e05 <vprintfmt+0x261>
+  801dff:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e03:	75 4a                	jne    801e4f <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e05:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e09:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e0d:	0f b6 00             	movzbl (%rax),%eax
+  801e10:	84 c0                	test   %al,%al
+  801e12:	0f 85 9a 00 00 00    	jne    801eb2 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e18:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e1b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	0f 8e bd fd ff ff    	jle    801be4 <vprintfmt+0x40>
+  801e27:	4c 89 ee             	mov    %r13,%rsi
+  801e2a:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e2f:	41 ff d6             	call   *%r14
+  801e32:	41 83 ec 01          	sub    $0x1,%r12d
+  801e36:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e3a:	75 eb                	jne    801e27 <vprintfmt+0x283>
+  801e3c:	e9 a3 fd ff ff       	jmp    801be4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e4d:	eb 92                	jmp    801de1 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e4f:	49 63 f7             	movslq %r15d,%rsi
+  801e52:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e56:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+  801e62:	48 89 c2             	mov    %rax,%rdx
+  801e65:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e68:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e6a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e6d:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	7e 91                	jle    801e05 <vprintfmt+0x261>
+  801e74:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e79:	4c 89 ee             	mov    %r13,%rsi
+  801e7c:	44 89 e7             	mov    %r12d,%edi
+  801e7f:	41 ff d6             	call   *%r14
+  801e82:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e86:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e89:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e8c:	75 eb                	jne    801e79 <vprintfmt+0x2d5>
+  801e8e:	e9 72 ff ff ff       	jmp    801e05 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e93:	0f b6 f8             	movzbl %al,%edi
+  801e96:	4c 89 ee             	mov    %r13,%rsi
+  801e99:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e9c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801ea0:	49 83 c4 01          	add    $0x1,%r12
+  801ea4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801eaa:	84 c0                	test   %al,%al
+  801eac:	0f 84 66 ff ff ff    	je     801e18 <vprintfmt+0x274>
+  801eb2:	45 85 ff             	test   %r15d,%r15d
+  801eb5:	78 0a                	js     801ec1 <vprintfmt+0x31d>
+  801eb7:	41 83 ef 01          	sub    $0x1,%r15d
+  801ebb:	0f 88 57 ff ff ff    	js     801e18 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ec1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801ec5:	74 cc                	je     801e93 <vprintfmt+0x2ef>
+  801ec7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801eca:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ecf:	80 fa 5e             	cmp    $0x5e,%dl
+  801ed2:	77 c2                	ja     801e96 <vprintfmt+0x2f2>
+  801ed4:	eb bd                	jmp    801e93 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed6:	40 84 f6             	test   %sil,%sil
+  801ed9:	75 26                	jne    801f01 <vprintfmt+0x35d>
+    switch (lflag) {
+  801edb:	85 d2                	test   %edx,%edx
+  801edd:	74 59                	je     801f38 <vprintfmt+0x394>
+  801edf:	83 fa 01             	cmp    $0x1,%edx
+  801ee2:	74 7b                	je     801f5f <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801ee4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee7:	83 f8 2f             	cmp    $0x2f,%eax
+  801eea:	0f 87 96 00 00 00    	ja     801f86 <vprintfmt+0x3e2>
+  801ef0:	89 c2                	mov    %eax,%edx
+  801ef2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef6:	83 c0 08             	add    $0x8,%eax
+  801ef9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801efc:	4c 8b 22             	mov    (%rdx),%r12
+  801eff:	eb 17                	jmp    801f18 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801f01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f04:	83 f8 2f             	cmp    $0x2f,%eax
+  801f07:	77 21                	ja     801f2a <vprintfmt+0x386>
+  801f09:	89 c2                	mov    %eax,%edx
+  801f0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0f:	83 c0 08             	add    $0x8,%eax
+  801f12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f15:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f18:	4d 85 e4             	test   %r12,%r12
+  801f1b:	78 7a                	js     801f97 <vprintfmt+0x3f3>
+            num = i;
+  801f1d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f20:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f25:	e9 56 02 00 00       	jmp    802180 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f36:	eb dd                	jmp    801f15 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3e:	77 11                	ja     801f51 <vprintfmt+0x3ad>
+  801f40:	89 c2                	mov    %eax,%edx
+  801f42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f46:	83 c0 08             	add    $0x8,%eax
+  801f49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4c:	4c 63 22             	movslq (%rdx),%r12
+  801f4f:	eb c7                	jmp    801f18 <vprintfmt+0x374>
+  801f51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5d:	eb ed                	jmp    801f4c <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f62:	83 f8 2f             	cmp    $0x2f,%eax
+  801f65:	77 11                	ja     801f78 <vprintfmt+0x3d4>
+  801f67:	89 c2                	mov    %eax,%edx
+  801f69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6d:	83 c0 08             	add    $0x8,%eax
+  801f70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f73:	4c 8b 22             	mov    (%rdx),%r12
+  801f76:	eb a0                	jmp    801f18 <vprintfmt+0x374>
+  801f78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f84:	eb ed                	jmp    801f73 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f92:	e9 65 ff ff ff       	jmp    801efc <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f97:	4c 89 ee             	mov    %r13,%rsi
+  801f9a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f9f:	41 ff d6             	call   *%r14
+                i = -i;
+  801fa2:	49 f7 dc             	neg    %r12
+  801fa5:	e9 73 ff ff ff       	jmp    801f1d <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801faa:	40 84 f6             	test   %sil,%sil
+  801fad:	75 2e                	jne    801fdd <vprintfmt+0x439>
+    switch (lflag) {
+  801faf:	85 d2                	test   %edx,%edx
+  801fb1:	7f 59                	jg     80200c <vprintfmt+0x468>
+  801fb3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fb6:	7d 7a                	jge    802032 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbb:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbe:	0f 87 aa 00 00 00    	ja     80206e <vprintfmt+0x4ca>
+  801fc4:	89 c2                	mov    %eax,%edx
+  801fc6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fca:	83 c0 08             	add    $0x8,%eax
+  801fcd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fd3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fd8:	e9 a3 01 00 00       	jmp    802180 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fe0:	83 f8 2f             	cmp    $0x2f,%eax
+  801fe3:	77 19                	ja     801ffe <vprintfmt+0x45a>
+  801fe5:	89 c2                	mov    %eax,%edx
+  801fe7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801feb:	83 c0 08             	add    $0x8,%eax
+  801fee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ff1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801ff4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ff9:	e9 82 01 00 00       	jmp    802180 <vprintfmt+0x5dc>
+  801ffe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802002:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802006:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80200a:	eb e5                	jmp    801ff1 <vprintfmt+0x44d>
+    switch (lflag) {
+  80200c:	83 fa 01             	cmp    $0x1,%edx
+  80200f:	75 a7                	jne    801fb8 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802011:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802014:	83 f8 2f             	cmp    $0x2f,%eax
+  802017:	77 47                	ja     802060 <vprintfmt+0x4bc>
+  802019:	89 c2                	mov    %eax,%edx
+  80201b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80201f:	83 c0 08             	add    $0x8,%eax
+  802022:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802025:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802028:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80202d:	e9 4e 01 00 00       	jmp    802180 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802032:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802035:	83 f8 2f             	cmp    $0x2f,%eax
+  802038:	77 18                	ja     802052 <vprintfmt+0x4ae>
+  80203a:	89 c2                	mov    %eax,%edx
+  80203c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802040:	83 c0 08             	add    $0x8,%eax
+  802043:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802046:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802048:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80204d:	e9 2e 01 00 00       	jmp    802180 <vprintfmt+0x5dc>
+  802052:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802056:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80205a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205e:	eb e6                	jmp    802046 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802060:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802064:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802068:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206c:	eb b7                	jmp    802025 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  80206e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802072:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802076:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80207a:	e9 51 ff ff ff       	jmp    801fd0 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  80207f:	40 84 f6             	test   %sil,%sil
+  802082:	75 2e                	jne    8020b2 <vprintfmt+0x50e>
+    switch (lflag) {
+  802084:	85 d2                	test   %edx,%edx
+  802086:	7f 59                	jg     8020e1 <vprintfmt+0x53d>
+  802088:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80208b:	7d 77                	jge    802104 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  80208d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802090:	83 f8 2f             	cmp    $0x2f,%eax
+  802093:	0f 87 a4 00 00 00    	ja     80213d <vprintfmt+0x599>
+  802099:	89 c2                	mov    %eax,%edx
+  80209b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80209f:	83 c0 08             	add    $0x8,%eax
+  8020a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020a5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020a8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020ad:	e9 ce 00 00 00       	jmp    802180 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b8:	77 19                	ja     8020d3 <vprintfmt+0x52f>
+  8020ba:	89 c2                	mov    %eax,%edx
+  8020bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c0:	83 c0 08             	add    $0x8,%eax
+  8020c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020c6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020c9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020ce:	e9 ad 00 00 00       	jmp    802180 <vprintfmt+0x5dc>
+  8020d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020df:	eb e5                	jmp    8020c6 <vprintfmt+0x522>
+    switch (lflag) {
+  8020e1:	83 fa 01             	cmp    $0x1,%edx
+  8020e4:	75 a7                	jne    80208d <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ec:	77 41                	ja     80212f <vprintfmt+0x58b>
+  8020ee:	89 c2                	mov    %eax,%edx
+  8020f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f4:	83 c0 08             	add    $0x8,%eax
+  8020f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020fa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020fd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802102:	eb 7c                	jmp    802180 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802104:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802107:	83 f8 2f             	cmp    $0x2f,%eax
+  80210a:	77 15                	ja     802121 <vprintfmt+0x57d>
+  80210c:	89 c2                	mov    %eax,%edx
+  80210e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802112:	83 c0 08             	add    $0x8,%eax
+  802115:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802118:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80211a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80211f:	eb 5f                	jmp    802180 <vprintfmt+0x5dc>
+  802121:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802125:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802129:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212d:	eb e9                	jmp    802118 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80212f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802133:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802137:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80213b:	eb bd                	jmp    8020fa <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80213d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802141:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802145:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802149:	e9 57 ff ff ff       	jmp    8020a5 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80214e:	4c 89 ee             	mov    %r13,%rsi
+  802151:	bf 30 00 00 00       	mov    $0x30,%edi
+  802156:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802159:	4c 89 ee             	mov    %r13,%rsi
+  80215c:	bf 78 00 00 00       	mov    $0x78,%edi
+  802161:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802164:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802167:	83 f8 2f             	cmp    $0x2f,%eax
+  80216a:	77 47                	ja     8021b3 <vprintfmt+0x60f>
+  80216c:	89 c2                	mov    %eax,%edx
+  80216e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802172:	83 c0 08             	add    $0x8,%eax
+  802175:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802178:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80217b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802180:	48 83 ec 08          	sub    $0x8,%rsp
+  802184:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802188:	0f 94 c0             	sete   %al
+  80218b:	0f b6 c0             	movzbl %al,%eax
+  80218e:	50                   	push   %rax
+  80218f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802194:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802198:	4c 89 ee             	mov    %r13,%rsi
+  80219b:	4c 89 f7             	mov    %r14,%rdi
+  80219e:	48 b8 99 1a 80 00 00 	movabs $0x801a99,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+            break;
+  8021aa:	48 83 c4 10          	add    $0x10,%rsp
+  8021ae:	e9 31 fa ff ff       	jmp    801be4 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8021b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021bf:	eb b7                	jmp    802178 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021c1:	40 84 f6             	test   %sil,%sil
+  8021c4:	75 2b                	jne    8021f1 <vprintfmt+0x64d>
+    switch (lflag) {
+  8021c6:	85 d2                	test   %edx,%edx
+  8021c8:	7f 56                	jg     802220 <vprintfmt+0x67c>
+  8021ca:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021cd:	7d 77                	jge    802246 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d5:	0f 87 a7 00 00 00    	ja     802282 <vprintfmt+0x6de>
+  8021db:	89 c2                	mov    %eax,%edx
+  8021dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e1:	83 c0 08             	add    $0x8,%eax
+  8021e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021ea:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021ef:	eb 8f                	jmp    802180 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8021f7:	77 19                	ja     802212 <vprintfmt+0x66e>
+  8021f9:	89 c2                	mov    %eax,%edx
+  8021fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ff:	83 c0 08             	add    $0x8,%eax
+  802202:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802205:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802208:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80220d:	e9 6e ff ff ff       	jmp    802180 <vprintfmt+0x5dc>
+  802212:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802216:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80221a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80221e:	eb e5                	jmp    802205 <vprintfmt+0x661>
+    switch (lflag) {
+  802220:	83 fa 01             	cmp    $0x1,%edx
+  802223:	75 aa                	jne    8021cf <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802225:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802228:	83 f8 2f             	cmp    $0x2f,%eax
+  80222b:	77 47                	ja     802274 <vprintfmt+0x6d0>
+  80222d:	89 c2                	mov    %eax,%edx
+  80222f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802233:	83 c0 08             	add    $0x8,%eax
+  802236:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802239:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80223c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802241:	e9 3a ff ff ff       	jmp    802180 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802246:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802249:	83 f8 2f             	cmp    $0x2f,%eax
+  80224c:	77 18                	ja     802266 <vprintfmt+0x6c2>
+  80224e:	89 c2                	mov    %eax,%edx
+  802250:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802254:	83 c0 08             	add    $0x8,%eax
+  802257:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80225a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80225c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802261:	e9 1a ff ff ff       	jmp    802180 <vprintfmt+0x5dc>
+  802266:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80226a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802272:	eb e6                	jmp    80225a <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802274:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802278:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80227c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802280:	eb b7                	jmp    802239 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802282:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802286:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80228a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228e:	e9 54 ff ff ff       	jmp    8021e7 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802293:	4c 89 ee             	mov    %r13,%rsi
+  802296:	bf 25 00 00 00       	mov    $0x25,%edi
+  80229b:	41 ff d6             	call   *%r14
+            break;
+  80229e:	e9 41 f9 ff ff       	jmp    801be4 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022a3:	4c 89 ee             	mov    %r13,%rsi
+  8022a6:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022ab:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8022ae:	48 83 eb 01          	sub    $0x1,%rbx
+  8022b2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022b6:	75 f6                	jne    8022ae <vprintfmt+0x70a>
+  8022b8:	e9 27 f9 ff ff       	jmp    801be4 <vprintfmt+0x40>
+
+00000000008022bd <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022bd:	55                   	push   %rbp
+  8022be:	48 89 e5             	mov    %rsp,%rbp
+  8022c1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022c5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022c9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022d2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022d9:	48 85 ff             	test   %rdi,%rdi
+  8022dc:	74 2b                	je     802309 <vsnprintf+0x4c>
+  8022de:	48 85 f6             	test   %rsi,%rsi
+  8022e1:	74 26                	je     802309 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022e3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022e7:	48 bf 4f 1b 80 00 00 	movabs $0x801b4f,%rdi
+  8022ee:	00 00 00 
+  8022f1:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8022fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802301:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802304:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802307:	c9                   	leave
+  802308:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80230e:	eb f7                	jmp    802307 <vsnprintf+0x4a>
+
+0000000000802310 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802310:	55                   	push   %rbp
+  802311:	48 89 e5             	mov    %rsp,%rbp
+  802314:	48 83 ec 50          	sub    $0x50,%rsp
+  802318:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80231c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802320:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802324:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80232b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80232f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802333:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802337:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80233b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80233f:	48 b8 bd 22 80 00 00 	movabs $0x8022bd,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+000000000080234d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80234d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802350:	74 10                	je     802362 <strlen+0x15>
+    size_t n = 0;
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802357:	48 83 c0 01          	add    $0x1,%rax
+  80235b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80235f:	75 f6                	jne    802357 <strlen+0xa>
+  802361:	c3                   	ret
+    size_t n = 0;
+  802362:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802367:	c3                   	ret
+
+0000000000802368 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802368:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80236b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802370:	48 85 f6             	test   %rsi,%rsi
+  802373:	74 11                	je     802386 <strnlen+0x1e>
+  802375:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802379:	74 0c                	je     802387 <strnlen+0x1f>
+  80237b:	48 83 c2 01          	add    $0x1,%rdx
+  80237f:	48 39 d0             	cmp    %rdx,%rax
+  802382:	75 f1                	jne    802375 <strnlen+0xd>
+  802384:	eb 04                	jmp    80238a <strnlen+0x22>
+  802386:	c3                   	ret
+  802387:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80238a:	c3                   	ret
+
+000000000080238b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80238b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80238e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802393:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802397:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80239a:	48 83 c2 01          	add    $0x1,%rdx
+  80239e:	84 c9                	test   %cl,%cl
+  8023a0:	75 f1                	jne    802393 <strcpy+0x8>
+        ;
+    return res;
+}
+  8023a2:	c3                   	ret
+
+00000000008023a3 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+  8023a7:	41 54                	push   %r12
+  8023a9:	53                   	push   %rbx
+  8023aa:	48 89 fb             	mov    %rdi,%rbx
+  8023ad:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8023b0:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8023b7:	00 00 00 
+  8023ba:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023bc:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023c0:	4c 89 e6             	mov    %r12,%rsi
+  8023c3:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+    return dst;
+}
+  8023cf:	48 89 d8             	mov    %rbx,%rax
+  8023d2:	5b                   	pop    %rbx
+  8023d3:	41 5c                	pop    %r12
+  8023d5:	5d                   	pop    %rbp
+  8023d6:	c3                   	ret
+
+00000000008023d7 <toupper>:
+
+int
+toupper(int ch) {
+  8023d7:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023d9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023dc:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023df:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023e2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023e5:	c3                   	ret
+
+00000000008023e6 <tolower>:
+
+int
+tolower(int ch) {
+  8023e6:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8023e8:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8023eb:	8d 57 20             	lea    0x20(%rdi),%edx
+  8023ee:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023f1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023f4:	c3                   	ret
+
+00000000008023f5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8023f5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8023f8:	48 85 d2             	test   %rdx,%rdx
+  8023fb:	74 1f                	je     80241c <strncpy+0x27>
+  8023fd:	48 01 fa             	add    %rdi,%rdx
+  802400:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802403:	48 83 c1 01          	add    $0x1,%rcx
+  802407:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80240b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80240f:	41 80 f8 01          	cmp    $0x1,%r8b
+  802413:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802417:	48 39 ca             	cmp    %rcx,%rdx
+  80241a:	75 e7                	jne    802403 <strncpy+0xe>
+    }
+    return ret;
+}
+  80241c:	c3                   	ret
+
+000000000080241d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80241d:	48 89 f8             	mov    %rdi,%rax
+  802420:	48 85 d2             	test   %rdx,%rdx
+  802423:	74 24                	je     802449 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802425:	48 83 ea 01          	sub    $0x1,%rdx
+  802429:	74 1b                	je     802446 <strlcpy+0x29>
+  80242b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80242f:	0f b6 16             	movzbl (%rsi),%edx
+  802432:	84 d2                	test   %dl,%dl
+  802434:	74 10                	je     802446 <strlcpy+0x29>
+            *dst++ = *src++;
+  802436:	48 83 c6 01          	add    $0x1,%rsi
+  80243a:	48 83 c0 01          	add    $0x1,%rax
+  80243e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802441:	48 39 c8             	cmp    %rcx,%rax
+  802444:	75 e9                	jne    80242f <strlcpy+0x12>
+        *dst = '\0';
+  802446:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802449:	48 29 f8             	sub    %rdi,%rax
+}
+  80244c:	c3                   	ret
+
+000000000080244d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80244d:	0f b6 07             	movzbl (%rdi),%eax
+  802450:	84 c0                	test   %al,%al
+  802452:	74 13                	je     802467 <strcmp+0x1a>
+  802454:	38 06                	cmp    %al,(%rsi)
+  802456:	75 0f                	jne    802467 <strcmp+0x1a>
+  802458:	48 83 c7 01          	add    $0x1,%rdi
+  80245c:	48 83 c6 01          	add    $0x1,%rsi
+  802460:	0f b6 07             	movzbl (%rdi),%eax
+  802463:	84 c0                	test   %al,%al
+  802465:	75 ed                	jne    802454 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802467:	0f b6 c0             	movzbl %al,%eax
+  80246a:	0f b6 16             	movzbl (%rsi),%edx
+  80246d:	29 d0                	sub    %edx,%eax
+}
+  80246f:	c3                   	ret
+
+0000000000802470 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802470:	48 85 d2             	test   %rdx,%rdx
+  802473:	74 1f                	je     802494 <strncmp+0x24>
+  802475:	0f b6 07             	movzbl (%rdi),%eax
+  802478:	84 c0                	test   %al,%al
+  80247a:	74 1e                	je     80249a <strncmp+0x2a>
+  80247c:	3a 06                	cmp    (%rsi),%al
+  80247e:	75 1a                	jne    80249a <strncmp+0x2a>
+  802480:	48 83 c7 01          	add    $0x1,%rdi
+  802484:	48 83 c6 01          	add    $0x1,%rsi
+  802488:	48 83 ea 01          	sub    $0x1,%rdx
+  80248c:	75 e7                	jne    802475 <strncmp+0x5>
+
+    if (!n) return 0;
+  80248e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802493:	c3                   	ret
+  802494:	b8 00 00 00 00       	mov    $0x0,%eax
+  802499:	c3                   	ret
+  80249a:	48 85 d2             	test   %rdx,%rdx
+  80249d:	74 09                	je     8024a8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80249f:	0f b6 07             	movzbl (%rdi),%eax
+  8024a2:	0f b6 16             	movzbl (%rsi),%edx
+  8024a5:	29 d0                	sub    %edx,%eax
+  8024a7:	c3                   	ret
+    if (!n) return 0;
+  8024a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ad:	c3                   	ret
+
+00000000008024ae <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8024ae:	0f b6 17             	movzbl (%rdi),%edx
+  8024b1:	84 d2                	test   %dl,%dl
+  8024b3:	74 18                	je     8024cd <strchr+0x1f>
+        if (*str == c) {
+  8024b5:	0f be d2             	movsbl %dl,%edx
+  8024b8:	39 f2                	cmp    %esi,%edx
+  8024ba:	74 17                	je     8024d3 <strchr+0x25>
+    for (; *str; str++) {
+  8024bc:	48 83 c7 01          	add    $0x1,%rdi
+  8024c0:	0f b6 17             	movzbl (%rdi),%edx
+  8024c3:	84 d2                	test   %dl,%dl
+  8024c5:	75 ee                	jne    8024b5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cc:	c3                   	ret
+  8024cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d2:	c3                   	ret
+  8024d3:	48 89 f8             	mov    %rdi,%rax
+}
+  8024d6:	c3                   	ret
+
+00000000008024d7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024d7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024da:	0f b6 17             	movzbl (%rdi),%edx
+  8024dd:	84 d2                	test   %dl,%dl
+  8024df:	74 13                	je     8024f4 <strfind+0x1d>
+  8024e1:	0f be d2             	movsbl %dl,%edx
+  8024e4:	39 f2                	cmp    %esi,%edx
+  8024e6:	74 0b                	je     8024f3 <strfind+0x1c>
+  8024e8:	48 83 c0 01          	add    $0x1,%rax
+  8024ec:	0f b6 10             	movzbl (%rax),%edx
+  8024ef:	84 d2                	test   %dl,%dl
+  8024f1:	75 ee                	jne    8024e1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8024f3:	c3                   	ret
+  8024f4:	c3                   	ret
+
+00000000008024f5 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024f5:	48 39 f7             	cmp    %rsi,%rdi
+  8024f8:	74 65                	je     80255f <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8024fa:	55                   	push   %rbp
+  8024fb:	48 89 e5             	mov    %rsp,%rbp
+  8024fe:	41 57                	push   %r15
+  802500:	41 56                	push   %r14
+  802502:	41 55                	push   %r13
+  802504:	41 54                	push   %r12
+  802506:	53                   	push   %rbx
+  802507:	48 83 ec 18          	sub    $0x18,%rsp
+  80250b:	48 89 fb             	mov    %rdi,%rbx
+  80250e:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802511:	49 bf e6 23 80 00 00 	movabs $0x8023e6,%r15
+  802518:	00 00 00 
+  80251b:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80251f:	41 0f b6 fd          	movzbl %r13b,%edi
+  802523:	41 ff d7             	call   *%r15
+  802526:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802529:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80252e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802532:	41 ff d7             	call   *%r15
+  802535:	89 c2                	mov    %eax,%edx
+  802537:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80253a:	29 d0                	sub    %edx,%eax
+  80253c:	75 12                	jne    802550 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80253e:	48 83 c3 01          	add    $0x1,%rbx
+  802542:	45 84 ed             	test   %r13b,%r13b
+  802545:	74 09                	je     802550 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802547:	49 83 c4 01          	add    $0x1,%r12
+  80254b:	45 84 f6             	test   %r14b,%r14b
+  80254e:	75 cb                	jne    80251b <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802550:	48 83 c4 18          	add    $0x18,%rsp
+  802554:	5b                   	pop    %rbx
+  802555:	41 5c                	pop    %r12
+  802557:	41 5d                	pop    %r13
+  802559:	41 5e                	pop    %r14
+  80255b:	41 5f                	pop    %r15
+  80255d:	5d                   	pop    %rbp
+  80255e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80255f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802564:	c3                   	ret
+
+0000000000802565 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802565:	48 39 f7             	cmp    %rsi,%rdi
+  802568:	74 7d                	je     8025e7 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80256a:	55                   	push   %rbp
+  80256b:	48 89 e5             	mov    %rsp,%rbp
+  80256e:	41 57                	push   %r15
+  802570:	41 56                	push   %r14
+  802572:	41 55                	push   %r13
+  802574:	41 54                	push   %r12
+  802576:	53                   	push   %rbx
+  802577:	48 83 ec 18          	sub    $0x18,%rsp
+  80257b:	48 89 fb             	mov    %rdi,%rbx
+  80257e:	49 89 f4             	mov    %rsi,%r12
+  802581:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802585:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802589:	49 bf e6 23 80 00 00 	movabs $0x8023e6,%r15
+  802590:	00 00 00 
+    while (n--) {
+  802593:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802597:	48 39 c3             	cmp    %rax,%rbx
+  80259a:	74 37                	je     8025d3 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80259c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025a0:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025a4:	41 ff d7             	call   *%r15
+  8025a7:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8025aa:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8025af:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025b3:	41 ff d7             	call   *%r15
+  8025b6:	89 c2                	mov    %eax,%edx
+  8025b8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025bb:	29 d0                	sub    %edx,%eax
+  8025bd:	75 19                	jne    8025d8 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025bf:	48 83 c3 01          	add    $0x1,%rbx
+  8025c3:	45 84 ed             	test   %r13b,%r13b
+  8025c6:	74 10                	je     8025d8 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025c8:	49 83 c4 01          	add    $0x1,%r12
+  8025cc:	45 84 f6             	test   %r14b,%r14b
+  8025cf:	75 c2                	jne    802593 <strncasecmp+0x2e>
+  8025d1:	eb 05                	jmp    8025d8 <strncasecmp+0x73>
+  8025d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025d8:	48 83 c4 18          	add    $0x18,%rsp
+  8025dc:	5b                   	pop    %rbx
+  8025dd:	41 5c                	pop    %r12
+  8025df:	41 5d                	pop    %r13
+  8025e1:	41 5e                	pop    %r14
+  8025e3:	41 5f                	pop    %r15
+  8025e5:	5d                   	pop    %rbp
+  8025e6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025ec:	c3                   	ret
+
+00000000008025ed <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8025ed:	83 e7 df             	and    $0xffffffdf,%edi
+  8025f0:	83 ef 41             	sub    $0x41,%edi
+  8025f3:	83 ff 19             	cmp    $0x19,%edi
+  8025f6:	0f 96 c0             	setbe  %al
+}
+  8025f9:	c3                   	ret
+
+00000000008025fa <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8025fa:	83 ff 20             	cmp    $0x20,%edi
+  8025fd:	0f 94 c0             	sete   %al
+  802600:	83 ff 09             	cmp    $0x9,%edi
+  802603:	0f 94 c2             	sete   %dl
+  802606:	09 d0                	or     %edx,%eax
+}
+  802608:	c3                   	ret
+
+0000000000802609 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802609:	55                   	push   %rbp
+  80260a:	48 89 e5             	mov    %rsp,%rbp
+  80260d:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80260f:	48 bf 7f 70 80 00 00 	movabs $0x80707f,%rdi
+  802616:	00 00 00 
+  802619:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  802620:	00 00 00 
+  802623:	ff d0                	call   *%rax
+  802625:	48 85 c0             	test   %rax,%rax
+  802628:	0f 95 c0             	setne  %al
+}
+  80262b:	5d                   	pop    %rbp
+  80262c:	c3                   	ret
+
+000000000080262d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80262d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802630:	48 89 f8             	mov    %rdi,%rax
+  802633:	48 f7 d8             	neg    %rax
+  802636:	83 e0 07             	and    $0x7,%eax
+  802639:	49 89 d1             	mov    %rdx,%r9
+  80263c:	49 29 c1             	sub    %rax,%r9
+  80263f:	78 36                	js     802677 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802641:	40 0f b6 c6          	movzbl %sil,%eax
+  802645:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80264c:	01 01 01 
+  80264f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802653:	40 f6 c7 07          	test   $0x7,%dil
+  802657:	75 38                	jne    802691 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802659:	4c 89 c9             	mov    %r9,%rcx
+  80265c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802660:	74 0c                	je     80266e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802662:	fc                   	cld
+  802663:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802666:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80266a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80266e:	4d 85 c9             	test   %r9,%r9
+  802671:	75 45                	jne    8026b8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802673:	4c 89 c0             	mov    %r8,%rax
+  802676:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802677:	48 85 d2             	test   %rdx,%rdx
+  80267a:	74 f7                	je     802673 <memset+0x46>
+  80267c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80267f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802682:	48 83 c0 01          	add    $0x1,%rax
+  802686:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80268a:	48 39 c2             	cmp    %rax,%rdx
+  80268d:	75 f3                	jne    802682 <memset+0x55>
+  80268f:	eb e2                	jmp    802673 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802691:	40 f6 c7 01          	test   $0x1,%dil
+  802695:	74 06                	je     80269d <memset+0x70>
+  802697:	88 07                	mov    %al,(%rdi)
+  802699:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80269d:	40 f6 c7 02          	test   $0x2,%dil
+  8026a1:	74 07                	je     8026aa <memset+0x7d>
+  8026a3:	66 89 07             	mov    %ax,(%rdi)
+  8026a6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026aa:	40 f6 c7 04          	test   $0x4,%dil
+  8026ae:	74 a9                	je     802659 <memset+0x2c>
+  8026b0:	89 07                	mov    %eax,(%rdi)
+  8026b2:	48 83 c7 04          	add    $0x4,%rdi
+  8026b6:	eb a1                	jmp    802659 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026b8:	41 f6 c1 04          	test   $0x4,%r9b
+  8026bc:	74 06                	je     8026c4 <memset+0x97>
+  8026be:	89 07                	mov    %eax,(%rdi)
+  8026c0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026c4:	41 f6 c1 02          	test   $0x2,%r9b
+  8026c8:	74 07                	je     8026d1 <memset+0xa4>
+  8026ca:	66 89 07             	mov    %ax,(%rdi)
+  8026cd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026d1:	41 f6 c1 01          	test   $0x1,%r9b
+  8026d5:	74 9c                	je     802673 <memset+0x46>
+  8026d7:	88 07                	mov    %al,(%rdi)
+  8026d9:	eb 98                	jmp    802673 <memset+0x46>
+
+00000000008026db <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026db:	48 89 f8             	mov    %rdi,%rax
+  8026de:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026e1:	48 39 fe             	cmp    %rdi,%rsi
+  8026e4:	73 3b                	jae    802721 <memmove+0x46>
+  8026e6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8026ea:	48 39 d7             	cmp    %rdx,%rdi
+  8026ed:	73 32                	jae    802721 <memmove+0x46>
+        s += n;
+        d += n;
+  8026ef:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026f3:	48 89 d6             	mov    %rdx,%rsi
+  8026f6:	48 09 fe             	or     %rdi,%rsi
+  8026f9:	48 09 ce             	or     %rcx,%rsi
+  8026fc:	40 f6 c6 07          	test   $0x7,%sil
+  802700:	75 12                	jne    802714 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802702:	48 83 ef 08          	sub    $0x8,%rdi
+  802706:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80270a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80270e:	fd                   	std
+  80270f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802712:	fc                   	cld
+  802713:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802714:	48 83 ef 01          	sub    $0x1,%rdi
+  802718:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80271c:	fd                   	std
+  80271d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80271f:	eb f1                	jmp    802712 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802721:	48 89 f2             	mov    %rsi,%rdx
+  802724:	48 09 c2             	or     %rax,%rdx
+  802727:	48 09 ca             	or     %rcx,%rdx
+  80272a:	f6 c2 07             	test   $0x7,%dl
+  80272d:	75 0c                	jne    80273b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80272f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802733:	48 89 c7             	mov    %rax,%rdi
+  802736:	fc                   	cld
+  802737:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80273a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80273b:	48 89 c7             	mov    %rax,%rdi
+  80273e:	fc                   	cld
+  80273f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802741:	c3                   	ret
+
+0000000000802742 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802742:	55                   	push   %rbp
+  802743:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802746:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  80274d:	00 00 00 
+  802750:	ff d0                	call   *%rax
+}
+  802752:	5d                   	pop    %rbp
+  802753:	c3                   	ret
+
+0000000000802754 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802754:	55                   	push   %rbp
+  802755:	48 89 e5             	mov    %rsp,%rbp
+  802758:	41 57                	push   %r15
+  80275a:	41 56                	push   %r14
+  80275c:	41 55                	push   %r13
+  80275e:	41 54                	push   %r12
+  802760:	53                   	push   %rbx
+  802761:	48 83 ec 08          	sub    $0x8,%rsp
+  802765:	49 89 fe             	mov    %rdi,%r14
+  802768:	49 89 f7             	mov    %rsi,%r15
+  80276b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80276e:	48 89 f7             	mov    %rsi,%rdi
+  802771:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+  80277d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802780:	48 89 de             	mov    %rbx,%rsi
+  802783:	4c 89 f7             	mov    %r14,%rdi
+  802786:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+  802792:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802795:	48 39 c3             	cmp    %rax,%rbx
+  802798:	74 36                	je     8027d0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80279a:	48 89 d8             	mov    %rbx,%rax
+  80279d:	4c 29 e8             	sub    %r13,%rax
+  8027a0:	49 39 c4             	cmp    %rax,%r12
+  8027a3:	73 31                	jae    8027d6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027a5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8027aa:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027ae:	4c 89 fe             	mov    %r15,%rsi
+  8027b1:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8027b8:	00 00 00 
+  8027bb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027bd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027c1:	48 83 c4 08          	add    $0x8,%rsp
+  8027c5:	5b                   	pop    %rbx
+  8027c6:	41 5c                	pop    %r12
+  8027c8:	41 5d                	pop    %r13
+  8027ca:	41 5e                	pop    %r14
+  8027cc:	41 5f                	pop    %r15
+  8027ce:	5d                   	pop    %rbp
+  8027cf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027d0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027d4:	eb eb                	jmp    8027c1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027d6:	48 83 eb 01          	sub    $0x1,%rbx
+  8027da:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027de:	48 89 da             	mov    %rbx,%rdx
+  8027e1:	4c 89 fe             	mov    %r15,%rsi
+  8027e4:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8027eb:	00 00 00 
+  8027ee:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8027f0:	49 01 de             	add    %rbx,%r14
+  8027f3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8027f8:	eb c3                	jmp    8027bd <strlcat+0x69>
+
+00000000008027fa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8027fa:	48 85 d2             	test   %rdx,%rdx
+  8027fd:	74 2d                	je     80282c <memcmp+0x32>
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802804:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802808:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80280d:	44 38 c1             	cmp    %r8b,%cl
+  802810:	75 0f                	jne    802821 <memcmp+0x27>
+    while (n-- > 0) {
+  802812:	48 83 c0 01          	add    $0x1,%rax
+  802816:	48 39 c2             	cmp    %rax,%rdx
+  802819:	75 e9                	jne    802804 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80281b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802820:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802821:	0f b6 c1             	movzbl %cl,%eax
+  802824:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802828:	44 29 c0             	sub    %r8d,%eax
+  80282b:	c3                   	ret
+    return 0;
+  80282c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802831:	c3                   	ret
+
+0000000000802832 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802832:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802836:	48 39 c7             	cmp    %rax,%rdi
+  802839:	73 0f                	jae    80284a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80283b:	40 38 37             	cmp    %sil,(%rdi)
+  80283e:	74 0e                	je     80284e <memfind+0x1c>
+    for (; src < end; src++) {
+  802840:	48 83 c7 01          	add    $0x1,%rdi
+  802844:	48 39 f8             	cmp    %rdi,%rax
+  802847:	75 f2                	jne    80283b <memfind+0x9>
+  802849:	c3                   	ret
+  80284a:	48 89 f8             	mov    %rdi,%rax
+  80284d:	c3                   	ret
+  80284e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802851:	c3                   	ret
+
+0000000000802852 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802852:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802855:	0f b6 37             	movzbl (%rdi),%esi
+  802858:	40 80 fe 20          	cmp    $0x20,%sil
+  80285c:	74 06                	je     802864 <strtol+0x12>
+  80285e:	40 80 fe 09          	cmp    $0x9,%sil
+  802862:	75 13                	jne    802877 <strtol+0x25>
+  802864:	48 83 c7 01          	add    $0x1,%rdi
+  802868:	0f b6 37             	movzbl (%rdi),%esi
+  80286b:	40 80 fe 20          	cmp    $0x20,%sil
+  80286f:	74 f3                	je     802864 <strtol+0x12>
+  802871:	40 80 fe 09          	cmp    $0x9,%sil
+  802875:	74 ed                	je     802864 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802877:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80287a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80287d:	3c 01                	cmp    $0x1,%al
+  80287f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802883:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802889:	75 0f                	jne    80289a <strtol+0x48>
+  80288b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80288e:	74 14                	je     8028a4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802890:	85 d2                	test   %edx,%edx
+  802892:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802897:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80289a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80289f:	4c 63 ca             	movslq %edx,%r9
+  8028a2:	eb 36                	jmp    8028da <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028a4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8028a8:	74 0f                	je     8028b9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8028aa:	85 d2                	test   %edx,%edx
+  8028ac:	75 ec                	jne    80289a <strtol+0x48>
+        s++;
+  8028ae:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8028b2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028b7:	eb e1                	jmp    80289a <strtol+0x48>
+        s += 2;
+  8028b9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028bd:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028c2:	eb d6                	jmp    80289a <strtol+0x48>
+            dig -= '0';
+  8028c4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028c7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028cb:	41 39 d0             	cmp    %edx,%r8d
+  8028ce:	7d 21                	jge    8028f1 <strtol+0x9f>
+        val = val * base + dig;
+  8028d0:	49 0f af c1          	imul   %r9,%rax
+  8028d4:	0f b6 c9             	movzbl %cl,%ecx
+  8028d7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028da:	48 83 c7 01          	add    $0x1,%rdi
+  8028de:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028e2:	80 f9 39             	cmp    $0x39,%cl
+  8028e5:	76 dd                	jbe    8028c4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8028e7:	80 f9 7b             	cmp    $0x7b,%cl
+  8028ea:	77 05                	ja     8028f1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8028ec:	83 e9 57             	sub    $0x57,%ecx
+  8028ef:	eb d6                	jmp    8028c7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8028f1:	4d 85 d2             	test   %r10,%r10
+  8028f4:	74 03                	je     8028f9 <strtol+0xa7>
+  8028f6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8028f9:	48 89 c2             	mov    %rax,%rdx
+  8028fc:	48 f7 da             	neg    %rdx
+  8028ff:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802903:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802907:	c3                   	ret
+
+0000000000802908 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802908:	55                   	push   %rbp
+  802909:	48 89 e5             	mov    %rsp,%rbp
+  80290c:	53                   	push   %rbx
+  80290d:	48 89 fa             	mov    %rdi,%rdx
+  802910:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802913:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802918:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802922:	be 00 00 00 00       	mov    $0x0,%esi
+  802927:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802933:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802935:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+
+000000000080293b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80293b:	55                   	push   %rbp
+  80293c:	48 89 e5             	mov    %rsp,%rbp
+  80293f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802940:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80294f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802954:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802959:	be 00 00 00 00       	mov    $0x0,%esi
+  80295e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802964:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80296a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80296c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802970:	c9                   	leave
+  802971:	c3                   	ret
+
+0000000000802972 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802972:	55                   	push   %rbp
+  802973:	48 89 e5             	mov    %rsp,%rbp
+  802976:	53                   	push   %rbx
+  802977:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80297a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80297f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802984:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802989:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80298e:	be 00 00 00 00       	mov    $0x0,%esi
+  802993:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802999:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80299f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8029a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029a5:	c9                   	leave
+  8029a6:	c3                   	ret
+
+00000000008029a7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8029a7:	55                   	push   %rbp
+  8029a8:	48 89 e5             	mov    %rsp,%rbp
+  8029ab:	53                   	push   %rbx
+  8029ac:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8029b0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029da:	48 85 c0             	test   %rax,%rax
+  8029dd:	7f 06                	jg     8029e5 <sys_env_destroy+0x3e>
+}
+  8029df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e3:	c9                   	leave
+  8029e4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029e5:	49 89 c0             	mov    %rax,%r8
+  8029e8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8029ed:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  8029f4:	00 00 00 
+  8029f7:	be 27 00 00 00       	mov    $0x27,%esi
+  8029fc:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802a03:	00 00 00 
+  802a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0b:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802a12:	00 00 00 
+  802a15:	41 ff d1             	call   *%r9
+
+0000000000802a18 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a18:	55                   	push   %rbp
+  802a19:	48 89 e5             	mov    %rsp,%rbp
+  802a1c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a1d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a27:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a36:	be 00 00 00 00       	mov    $0x0,%esi
+  802a3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a47:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+
+0000000000802a4f <sys_yield>:
+
+void
+sys_yield(void) {
+  802a4f:	55                   	push   %rbp
+  802a50:	48 89 e5             	mov    %rsp,%rbp
+  802a53:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a54:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+
+0000000000802a86 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a86:	55                   	push   %rbp
+  802a87:	48 89 e5             	mov    %rsp,%rbp
+  802a8a:	53                   	push   %rbx
+  802a8b:	48 89 fa             	mov    %rdi,%rdx
+  802a8e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a91:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a96:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a9d:	00 00 00 
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ab8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+0000000000802abe <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802abe:	55                   	push   %rbp
+  802abf:	48 89 e5             	mov    %rsp,%rbp
+  802ac2:	53                   	push   %rbx
+  802ac3:	49 89 f8             	mov    %rdi,%r8
+  802ac6:	48 89 d3             	mov    %rdx,%rbx
+  802ac9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802acc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ad1:	4c 89 c2             	mov    %r8,%rdx
+  802ad4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ad7:	be 00 00 00 00       	mov    $0x0,%esi
+  802adc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ae8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802aea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aee:	c9                   	leave
+  802aef:	c3                   	ret
+
+0000000000802af0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802af0:	55                   	push   %rbp
+  802af1:	48 89 e5             	mov    %rsp,%rbp
+  802af4:	53                   	push   %rbx
+  802af5:	48 83 ec 08          	sub    $0x8,%rsp
+  802af9:	89 f8                	mov    %edi,%eax
+  802afb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802afe:	48 63 f9             	movslq %ecx,%rdi
+  802b01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b04:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b09:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b1f:	48 85 c0             	test   %rax,%rax
+  802b22:	7f 06                	jg     802b2a <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b2a:	49 89 c0             	mov    %rax,%r8
+  802b2d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b32:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802b39:	00 00 00 
+  802b3c:	be 27 00 00 00       	mov    $0x27,%esi
+  802b41:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802b48:	00 00 00 
+  802b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b50:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802b57:	00 00 00 
+  802b5a:	41 ff d1             	call   *%r9
+
+0000000000802b5d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b5d:	55                   	push   %rbp
+  802b5e:	48 89 e5             	mov    %rsp,%rbp
+  802b61:	53                   	push   %rbx
+  802b62:	48 83 ec 08          	sub    $0x8,%rsp
+  802b66:	89 f8                	mov    %edi,%eax
+  802b68:	49 89 f2             	mov    %rsi,%r10
+  802b6b:	48 89 cf             	mov    %rcx,%rdi
+  802b6e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b71:	48 63 da             	movslq %edx,%rbx
+  802b74:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b77:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b7c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7f:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b88:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b8a:	48 85 c0             	test   %rax,%rax
+  802b8d:	7f 06                	jg     802b95 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b8f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b93:	c9                   	leave
+  802b94:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b95:	49 89 c0             	mov    %rax,%r8
+  802b98:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b9d:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802ba4:	00 00 00 
+  802ba7:	be 27 00 00 00       	mov    $0x27,%esi
+  802bac:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802bb3:	00 00 00 
+  802bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbb:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802bc2:	00 00 00 
+  802bc5:	41 ff d1             	call   *%r9
+
+0000000000802bc8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802bc8:	55                   	push   %rbp
+  802bc9:	48 89 e5             	mov    %rsp,%rbp
+  802bcc:	53                   	push   %rbx
+  802bcd:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd1:	48 89 f1             	mov    %rsi,%rcx
+  802bd4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bd7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bda:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be4:	be 00 00 00 00       	mov    $0x0,%esi
+  802be9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bf5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf7:	48 85 c0             	test   %rax,%rax
+  802bfa:	7f 06                	jg     802c02 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802bfc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c00:	c9                   	leave
+  802c01:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c02:	49 89 c0             	mov    %rax,%r8
+  802c05:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c0a:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802c11:	00 00 00 
+  802c14:	be 27 00 00 00       	mov    $0x27,%esi
+  802c19:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802c20:	00 00 00 
+  802c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c28:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802c2f:	00 00 00 
+  802c32:	41 ff d1             	call   *%r9
+
+0000000000802c35 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c35:	55                   	push   %rbp
+  802c36:	48 89 e5             	mov    %rsp,%rbp
+  802c39:	53                   	push   %rbx
+  802c3a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c3e:	48 63 ce             	movslq %esi,%rcx
+  802c41:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c44:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c4e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c53:	be 00 00 00 00       	mov    $0x0,%esi
+  802c58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c64:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c66:	48 85 c0             	test   %rax,%rax
+  802c69:	7f 06                	jg     802c71 <sys_env_set_status+0x3c>
+}
+  802c6b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c6f:	c9                   	leave
+  802c70:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c71:	49 89 c0             	mov    %rax,%r8
+  802c74:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c79:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802c80:	00 00 00 
+  802c83:	be 27 00 00 00       	mov    $0x27,%esi
+  802c88:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802c8f:	00 00 00 
+  802c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c97:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802c9e:	00 00 00 
+  802ca1:	41 ff d1             	call   *%r9
+
+0000000000802ca4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802ca4:	55                   	push   %rbp
+  802ca5:	48 89 e5             	mov    %rsp,%rbp
+  802ca8:	53                   	push   %rbx
+  802ca9:	48 83 ec 08          	sub    $0x8,%rsp
+  802cad:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802cb0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ccd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cd5:	48 85 c0             	test   %rax,%rax
+  802cd8:	7f 06                	jg     802ce0 <sys_env_set_trapframe+0x3c>
+}
+  802cda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce0:	49 89 c0             	mov    %rax,%r8
+  802ce3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802ce8:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802cef:	00 00 00 
+  802cf2:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf7:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802cfe:	00 00 00 
+  802d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d06:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802d0d:	00 00 00 
+  802d10:	41 ff d1             	call   *%r9
+
+0000000000802d13 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d13:	55                   	push   %rbp
+  802d14:	48 89 e5             	mov    %rsp,%rbp
+  802d17:	53                   	push   %rbx
+  802d18:	48 83 ec 08          	sub    $0x8,%rsp
+  802d1c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d1f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d22:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d31:	be 00 00 00 00       	mov    $0x0,%esi
+  802d36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d42:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d44:	48 85 c0             	test   %rax,%rax
+  802d47:	7f 06                	jg     802d4f <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4d:	c9                   	leave
+  802d4e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d4f:	49 89 c0             	mov    %rax,%r8
+  802d52:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d57:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802d5e:	00 00 00 
+  802d61:	be 27 00 00 00       	mov    $0x27,%esi
+  802d66:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802d6d:	00 00 00 
+  802d70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d75:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802d7c:	00 00 00 
+  802d7f:	41 ff d1             	call   *%r9
+
+0000000000802d82 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d82:	55                   	push   %rbp
+  802d83:	48 89 e5             	mov    %rsp,%rbp
+  802d86:	53                   	push   %rbx
+  802d87:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d8b:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d8f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d92:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d9c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da1:	be 00 00 00 00       	mov    $0x0,%esi
+  802da6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db4:	48 85 c0             	test   %rax,%rax
+  802db7:	7f 06                	jg     802dbf <sys_env_set_reclaim+0x3d>
+}
+  802db9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dbd:	c9                   	leave
+  802dbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dbf:	49 89 c0             	mov    %rax,%r8
+  802dc2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802dc7:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802dce:	00 00 00 
+  802dd1:	be 27 00 00 00       	mov    $0x27,%esi
+  802dd6:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802ddd:	00 00 00 
+  802de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de5:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802dec:	00 00 00 
+  802def:	41 ff d1             	call   *%r9
+
+0000000000802df2 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802df2:	55                   	push   %rbp
+  802df3:	48 89 e5             	mov    %rsp,%rbp
+  802df6:	53                   	push   %rbx
+  802df7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802dfb:	48 63 ce             	movslq %esi,%rcx
+  802dfe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e01:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e10:	be 00 00 00 00       	mov    $0x0,%esi
+  802e15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e23:	48 85 c0             	test   %rax,%rax
+  802e26:	7f 06                	jg     802e2e <sys_env_set_nice+0x3c>
+}
+  802e28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2c:	c9                   	leave
+  802e2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e2e:	49 89 c0             	mov    %rax,%r8
+  802e31:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e36:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802e3d:	00 00 00 
+  802e40:	be 27 00 00 00       	mov    $0x27,%esi
+  802e45:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802e4c:	00 00 00 
+  802e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e54:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802e5b:	00 00 00 
+  802e5e:	41 ff d1             	call   *%r9
+
+0000000000802e61 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e61:	55                   	push   %rbp
+  802e62:	48 89 e5             	mov    %rsp,%rbp
+  802e65:	53                   	push   %rbx
+  802e66:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e69:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e8e:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+0000000000802e96 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e96:	55                   	push   %rbp
+  802e97:	48 89 e5             	mov    %rsp,%rbp
+  802e9a:	53                   	push   %rbx
+  802e9b:	89 f8                	mov    %edi,%eax
+  802e9d:	49 89 f1             	mov    %rsi,%r9
+  802ea0:	48 89 d3             	mov    %rdx,%rbx
+  802ea3:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ea6:	49 63 f0             	movslq %r8d,%rsi
+  802ea9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802eac:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eb1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eb4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ec0:	cd 30                	int    $0x30
+}
+  802ec2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ec6:	c9                   	leave
+  802ec7:	c3                   	ret
+
+0000000000802ec8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	53                   	push   %rbx
+  802ecd:	89 f8                	mov    %edi,%eax
+  802ecf:	49 89 f1             	mov    %rsi,%r9
+  802ed2:	48 89 d3             	mov    %rdx,%rbx
+  802ed5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ed8:	49 63 f0             	movslq %r8d,%rsi
+  802edb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ede:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ee3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ee6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ef2:	cd 30                	int    $0x30
+}
+  802ef4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ef8:	c9                   	leave
+  802ef9:	c3                   	ret
+
+0000000000802efa <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802efa:	55                   	push   %rbp
+  802efb:	48 89 e5             	mov    %rsp,%rbp
+  802efe:	53                   	push   %rbx
+  802eff:	48 83 ec 08          	sub    $0x8,%rsp
+  802f03:	89 f8                	mov    %edi,%eax
+  802f05:	49 89 f2             	mov    %rsi,%r10
+  802f08:	48 89 d3             	mov    %rdx,%rbx
+  802f0b:	48 89 cf             	mov    %rcx,%rdi
+  802f0e:	44 89 c6             	mov    %r8d,%esi
+  802f11:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f14:	48 63 f6             	movslq %esi,%rsi
+  802f17:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f1a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f1f:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f22:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f28:	48 85 c0             	test   %rax,%rax
+  802f2b:	7f 06                	jg     802f33 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f33:	49 89 c0             	mov    %rax,%r8
+  802f36:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f3b:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802f42:	00 00 00 
+  802f45:	be 27 00 00 00       	mov    $0x27,%esi
+  802f4a:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802f51:	00 00 00 
+  802f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f59:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802f60:	00 00 00 
+  802f63:	41 ff d1             	call   *%r9
+
+0000000000802f66 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f66:	55                   	push   %rbp
+  802f67:	48 89 e5             	mov    %rsp,%rbp
+  802f6a:	53                   	push   %rbx
+  802f6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f6f:	48 89 f1             	mov    %rsi,%rcx
+  802f72:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f75:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f79:	48 8b 1a             	mov    (%rdx),%rbx
+  802f7c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f7f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f84:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f88:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f8c:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f92:	48 85 c0             	test   %rax,%rax
+  802f95:	7f 06                	jg     802f9d <sys_ipc_call_short+0x37>
+}
+  802f97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f9b:	c9                   	leave
+  802f9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f9d:	49 89 c0             	mov    %rax,%r8
+  802fa0:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802fa5:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  802fac:	00 00 00 
+  802faf:	be 27 00 00 00       	mov    $0x27,%esi
+  802fb4:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  802fbb:	00 00 00 
+  802fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc3:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  802fca:	00 00 00 
+  802fcd:	41 ff d1             	call   *%r9
+
+0000000000802fd0 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fd0:	55                   	push   %rbp
+  802fd1:	48 89 e5             	mov    %rsp,%rbp
+  802fd4:	53                   	push   %rbx
+  802fd5:	48 83 ec 08          	sub    $0x8,%rsp
+  802fd9:	89 f8                	mov    %edi,%eax
+  802fdb:	49 89 f2             	mov    %rsi,%r10
+  802fde:	48 89 d3             	mov    %rdx,%rbx
+  802fe1:	48 89 cf             	mov    %rcx,%rdi
+  802fe4:	44 89 c6             	mov    %r8d,%esi
+  802fe7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802fea:	48 63 f6             	movslq %esi,%rsi
+  802fed:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ff0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ff5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ff8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ffc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ffe:	48 85 c0             	test   %rax,%rax
+  803001:	7f 06                	jg     803009 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803003:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803007:	c9                   	leave
+  803008:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803009:	49 89 c0             	mov    %rax,%r8
+  80300c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803011:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  803018:	00 00 00 
+  80301b:	be 27 00 00 00       	mov    $0x27,%esi
+  803020:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  803027:	00 00 00 
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  803036:	00 00 00 
+  803039:	41 ff d1             	call   *%r9
+
+000000000080303c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80303c:	55                   	push   %rbp
+  80303d:	48 89 e5             	mov    %rsp,%rbp
+  803040:	53                   	push   %rbx
+  803041:	48 83 ec 08          	sub    $0x8,%rsp
+  803045:	48 89 fa             	mov    %rdi,%rdx
+  803048:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80304b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803050:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803055:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80305a:	be 00 00 00 00       	mov    $0x0,%esi
+  80305f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803065:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80306b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80306d:	48 85 c0             	test   %rax,%rax
+  803070:	7f 06                	jg     803078 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803072:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803078:	49 89 c0             	mov    %rax,%r8
+  80307b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803080:	48 ba 88 70 80 00 00 	movabs $0x807088,%rdx
+  803087:	00 00 00 
+  80308a:	be 27 00 00 00       	mov    $0x27,%esi
+  80308f:	48 bf a7 70 80 00 00 	movabs $0x8070a7,%rdi
+  803096:	00 00 00 
+  803099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80309e:	49 b9 04 19 80 00 00 	movabs $0x801904,%r9
+  8030a5:	00 00 00 
+  8030a8:	41 ff d1             	call   *%r9
+
+00000000008030ab <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8030ab:	55                   	push   %rbp
+  8030ac:	48 89 e5             	mov    %rsp,%rbp
+  8030af:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030b0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030c4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030da:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030dc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e0:	c9                   	leave
+  8030e1:	c3                   	ret
+
+00000000008030e2 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030e2:	55                   	push   %rbp
+  8030e3:	48 89 e5             	mov    %rsp,%rbp
+  8030e6:	53                   	push   %rbx
+  8030e7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030ea:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030f9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803103:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803109:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80310f:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803111:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803115:	c9                   	leave
+  803116:	c3                   	ret
+
+0000000000803117 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803117:	55                   	push   %rbp
+  803118:	48 89 e5             	mov    %rsp,%rbp
+  80311b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80311c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803121:	ba 00 00 00 00       	mov    $0x0,%edx
+  803126:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80312b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803130:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803135:	be 00 00 00 00       	mov    $0x0,%esi
+  80313a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803140:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803146:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803148:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80314c:	c9                   	leave
+  80314d:	c3                   	ret
+
+000000000080314e <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80314e:	55                   	push   %rbp
+  80314f:	48 89 e5             	mov    %rsp,%rbp
+  803152:	53                   	push   %rbx
+  803153:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803157:	b8 08 00 00 00       	mov    $0x8,%eax
+  80315c:	cd 30                	int    $0x30
+  80315e:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  803160:	85 c0                	test   %eax,%eax
+  803162:	0f 88 85 00 00 00    	js     8031ed <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803168:	0f 84 ac 00 00 00    	je     80321a <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  80316e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  803174:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80317b:	00 00 00 
+  80317e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803183:	89 c2                	mov    %eax,%edx
+  803185:	be 00 00 00 00       	mov    $0x0,%esi
+  80318a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318f:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  803196:	00 00 00 
+  803199:	ff d0                	call   *%rax
+  80319b:	85 c0                	test   %eax,%eax
+  80319d:	0f 88 a8 00 00 00    	js     80324b <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8031a3:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8031aa:	00 00 00 
+  8031ad:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8031b4:	89 df                	mov    %ebx,%edi
+  8031b6:	48 b8 13 2d 80 00 00 	movabs $0x802d13,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+  8031c2:	85 c0                	test   %eax,%eax
+  8031c4:	0f 88 ae 00 00 00    	js     803278 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8031ca:	be 02 00 00 00       	mov    $0x2,%esi
+  8031cf:	89 df                	mov    %ebx,%edi
+  8031d1:	48 b8 35 2c 80 00 00 	movabs $0x802c35,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	85 c0                	test   %eax,%eax
+  8031df:	0f 88 c0 00 00 00    	js     8032a5 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8031e5:	89 d8                	mov    %ebx,%eax
+  8031e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  8031ed:	89 c1                	mov    %eax,%ecx
+  8031ef:	48 ba b5 70 80 00 00 	movabs $0x8070b5,%rdx
+  8031f6:	00 00 00 
+  8031f9:	be 20 00 00 00       	mov    $0x20,%esi
+  8031fe:	48 bf c5 70 80 00 00 	movabs $0x8070c5,%rdi
+  803205:	00 00 00 
+  803208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320d:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803214:	00 00 00 
+  803217:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80321a:	48 b8 18 2a 80 00 00 	movabs $0x802a18,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+  803226:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80322b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803232:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803239:	00 00 00 
+  80323c:	48 01 d0             	add    %rdx,%rax
+  80323f:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  803246:	00 00 00 
+        return 0;
+  803249:	eb 9a                	jmp    8031e5 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  80324b:	89 c1                	mov    %eax,%ecx
+  80324d:	48 ba d0 70 80 00 00 	movabs $0x8070d0,%rdx
+  803254:	00 00 00 
+  803257:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80325c:	48 bf c5 70 80 00 00 	movabs $0x8070c5,%rdi
+  803263:	00 00 00 
+  803266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326b:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803272:	00 00 00 
+  803275:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803278:	89 c1                	mov    %eax,%ecx
+  80327a:	48 ba 18 71 80 00 00 	movabs $0x807118,%rdx
+  803281:	00 00 00 
+  803284:	be 32 00 00 00       	mov    $0x32,%esi
+  803289:	48 bf c5 70 80 00 00 	movabs $0x8070c5,%rdi
+  803290:	00 00 00 
+  803293:	b8 00 00 00 00       	mov    $0x0,%eax
+  803298:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  80329f:	00 00 00 
+  8032a2:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8032a5:	89 c1                	mov    %eax,%ecx
+  8032a7:	48 ba e3 70 80 00 00 	movabs $0x8070e3,%rdx
+  8032ae:	00 00 00 
+  8032b1:	be 37 00 00 00       	mov    $0x37,%esi
+  8032b6:	48 bf c5 70 80 00 00 	movabs $0x8070c5,%rdi
+  8032bd:	00 00 00 
+  8032c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032c5:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  8032cc:	00 00 00 
+  8032cf:	41 ff d0             	call   *%r8
+
+00000000008032d2 <sfork>:
+
+envid_t
+sfork() {
+  8032d2:	55                   	push   %rbp
+  8032d3:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8032d6:	48 ba fa 70 80 00 00 	movabs $0x8070fa,%rdx
+  8032dd:	00 00 00 
+  8032e0:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8032e5:	48 bf c5 70 80 00 00 	movabs $0x8070c5,%rdi
+  8032ec:	00 00 00 
+  8032ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f4:	48 b9 04 19 80 00 00 	movabs $0x801904,%rcx
+  8032fb:	00 00 00 
+  8032fe:	ff d1                	call   *%rcx
+
+0000000000803300 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803300:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803307:	ff ff ff 
+  80330a:	48 01 f8             	add    %rdi,%rax
+  80330d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803311:	c3                   	ret
+
+0000000000803312 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803312:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803319:	ff ff ff 
+  80331c:	48 01 f8             	add    %rdi,%rax
+  80331f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803323:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803329:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80332d:	c3                   	ret
+
+000000000080332e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80332e:	55                   	push   %rbp
+  80332f:	48 89 e5             	mov    %rsp,%rbp
+  803332:	41 57                	push   %r15
+  803334:	41 56                	push   %r14
+  803336:	41 55                	push   %r13
+  803338:	41 54                	push   %r12
+  80333a:	53                   	push   %rbx
+  80333b:	48 83 ec 08          	sub    $0x8,%rsp
+  80333f:	49 89 ff             	mov    %rdi,%r15
+  803342:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803347:	49 bd c2 51 80 00 00 	movabs $0x8051c2,%r13
+  80334e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803351:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803357:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80335a:	48 89 df             	mov    %rbx,%rdi
+  80335d:	41 ff d5             	call   *%r13
+  803360:	83 e0 04             	and    $0x4,%eax
+  803363:	74 17                	je     80337c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803365:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80336c:	4c 39 f3             	cmp    %r14,%rbx
+  80336f:	75 e6                	jne    803357 <fd_alloc+0x29>
+  803371:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803377:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80337c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80337f:	48 83 c4 08          	add    $0x8,%rsp
+  803383:	5b                   	pop    %rbx
+  803384:	41 5c                	pop    %r12
+  803386:	41 5d                	pop    %r13
+  803388:	41 5e                	pop    %r14
+  80338a:	41 5f                	pop    %r15
+  80338c:	5d                   	pop    %rbp
+  80338d:	c3                   	ret
+
+000000000080338e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80338e:	83 ff 1f             	cmp    $0x1f,%edi
+  803391:	77 39                	ja     8033cc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803393:	55                   	push   %rbp
+  803394:	48 89 e5             	mov    %rsp,%rbp
+  803397:	41 54                	push   %r12
+  803399:	53                   	push   %rbx
+  80339a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80339d:	48 63 df             	movslq %edi,%rbx
+  8033a0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8033a7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8033ab:	48 89 df             	mov    %rbx,%rdi
+  8033ae:	48 b8 c2 51 80 00 00 	movabs $0x8051c2,%rax
+  8033b5:	00 00 00 
+  8033b8:	ff d0                	call   *%rax
+  8033ba:	a8 04                	test   $0x4,%al
+  8033bc:	74 14                	je     8033d2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8033be:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8033c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c7:	5b                   	pop    %rbx
+  8033c8:	41 5c                	pop    %r12
+  8033ca:	5d                   	pop    %rbp
+  8033cb:	c3                   	ret
+        return -E_INVAL;
+  8033cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8033d1:	c3                   	ret
+        return -E_INVAL;
+  8033d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d7:	eb ee                	jmp    8033c7 <fd_lookup+0x39>
+
+00000000008033d9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8033d9:	55                   	push   %rbp
+  8033da:	48 89 e5             	mov    %rsp,%rbp
+  8033dd:	41 54                	push   %r12
+  8033df:	53                   	push   %rbx
+  8033e0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8033e3:	48 b8 c0 71 80 00 00 	movabs $0x8071c0,%rax
+  8033ea:	00 00 00 
+  8033ed:	48 bb 40 80 80 00 00 	movabs $0x808040,%rbx
+  8033f4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8033f7:	39 3b                	cmp    %edi,(%rbx)
+  8033f9:	74 47                	je     803442 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8033fb:	48 83 c0 08          	add    $0x8,%rax
+  8033ff:	48 8b 18             	mov    (%rax),%rbx
+  803402:	48 85 db             	test   %rbx,%rbx
+  803405:	75 f0                	jne    8033f7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803407:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80340e:	00 00 00 
+  803411:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803417:	89 fa                	mov    %edi,%edx
+  803419:	48 bf 38 71 80 00 00 	movabs $0x807138,%rdi
+  803420:	00 00 00 
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+  803428:	48 b9 54 1a 80 00 00 	movabs $0x801a54,%rcx
+  80342f:	00 00 00 
+  803432:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803434:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803439:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80343d:	5b                   	pop    %rbx
+  80343e:	41 5c                	pop    %r12
+  803440:	5d                   	pop    %rbp
+  803441:	c3                   	ret
+            return 0;
+  803442:	b8 00 00 00 00       	mov    $0x0,%eax
+  803447:	eb f0                	jmp    803439 <dev_lookup+0x60>
+
+0000000000803449 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803449:	55                   	push   %rbp
+  80344a:	48 89 e5             	mov    %rsp,%rbp
+  80344d:	41 55                	push   %r13
+  80344f:	41 54                	push   %r12
+  803451:	53                   	push   %rbx
+  803452:	48 83 ec 18          	sub    $0x18,%rsp
+  803456:	48 89 fb             	mov    %rdi,%rbx
+  803459:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80345c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803463:	ff ff ff 
+  803466:	48 01 df             	add    %rbx,%rdi
+  803469:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80346d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803471:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  803478:	00 00 00 
+  80347b:	ff d0                	call   *%rax
+  80347d:	41 89 c5             	mov    %eax,%r13d
+  803480:	85 c0                	test   %eax,%eax
+  803482:	78 06                	js     80348a <fd_close+0x41>
+  803484:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803488:	74 1a                	je     8034a4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80348a:	45 84 e4             	test   %r12b,%r12b
+  80348d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803492:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803496:	44 89 e8             	mov    %r13d,%eax
+  803499:	48 83 c4 18          	add    $0x18,%rsp
+  80349d:	5b                   	pop    %rbx
+  80349e:	41 5c                	pop    %r12
+  8034a0:	41 5d                	pop    %r13
+  8034a2:	5d                   	pop    %rbp
+  8034a3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034a4:	8b 3b                	mov    (%rbx),%edi
+  8034a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034aa:	48 b8 d9 33 80 00 00 	movabs $0x8033d9,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+  8034b6:	41 89 c5             	mov    %eax,%r13d
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	78 1b                	js     8034d8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8034bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034c1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034c5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8034cb:	48 85 c0             	test   %rax,%rax
+  8034ce:	74 08                	je     8034d8 <fd_close+0x8f>
+  8034d0:	48 89 df             	mov    %rbx,%rdi
+  8034d3:	ff d0                	call   *%rax
+  8034d5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8034d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034dd:	48 89 de             	mov    %rbx,%rsi
+  8034e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034e5:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  8034ec:	00 00 00 
+  8034ef:	ff d0                	call   *%rax
+    return res;
+  8034f1:	eb a3                	jmp    803496 <fd_close+0x4d>
+
+00000000008034f3 <close>:
+
+int
+close(int fdnum) {
+  8034f3:	55                   	push   %rbp
+  8034f4:	48 89 e5             	mov    %rsp,%rbp
+  8034f7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8034fb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034ff:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  803506:	00 00 00 
+  803509:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80350b:	85 c0                	test   %eax,%eax
+  80350d:	78 15                	js     803524 <close+0x31>
+
+    return fd_close(fd, 1);
+  80350f:	be 01 00 00 00       	mov    $0x1,%esi
+  803514:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803518:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+}
+  803524:	c9                   	leave
+  803525:	c3                   	ret
+
+0000000000803526 <close_all>:
+
+void
+close_all(void) {
+  803526:	55                   	push   %rbp
+  803527:	48 89 e5             	mov    %rsp,%rbp
+  80352a:	41 54                	push   %r12
+  80352c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80352d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803532:	49 bc f3 34 80 00 00 	movabs $0x8034f3,%r12
+  803539:	00 00 00 
+  80353c:	89 df                	mov    %ebx,%edi
+  80353e:	41 ff d4             	call   *%r12
+  803541:	83 c3 01             	add    $0x1,%ebx
+  803544:	83 fb 20             	cmp    $0x20,%ebx
+  803547:	75 f3                	jne    80353c <close_all+0x16>
+}
+  803549:	5b                   	pop    %rbx
+  80354a:	41 5c                	pop    %r12
+  80354c:	5d                   	pop    %rbp
+  80354d:	c3                   	ret
+
+000000000080354e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80354e:	55                   	push   %rbp
+  80354f:	48 89 e5             	mov    %rsp,%rbp
+  803552:	41 57                	push   %r15
+  803554:	41 56                	push   %r14
+  803556:	41 55                	push   %r13
+  803558:	41 54                	push   %r12
+  80355a:	53                   	push   %rbx
+  80355b:	48 83 ec 18          	sub    $0x18,%rsp
+  80355f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803562:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803566:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  80356d:	00 00 00 
+  803570:	ff d0                	call   *%rax
+  803572:	89 c3                	mov    %eax,%ebx
+  803574:	85 c0                	test   %eax,%eax
+  803576:	0f 88 b8 00 00 00    	js     803634 <dup+0xe6>
+    close(newfdnum);
+  80357c:	44 89 e7             	mov    %r12d,%edi
+  80357f:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80358b:	4d 63 ec             	movslq %r12d,%r13
+  80358e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803595:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803599:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80359d:	4c 89 ff             	mov    %r15,%rdi
+  8035a0:	49 be 12 33 80 00 00 	movabs $0x803312,%r14
+  8035a7:	00 00 00 
+  8035aa:	41 ff d6             	call   *%r14
+  8035ad:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8035b0:	4c 89 ef             	mov    %r13,%rdi
+  8035b3:	41 ff d6             	call   *%r14
+  8035b6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8035b9:	48 89 df             	mov    %rbx,%rdi
+  8035bc:	48 b8 c2 51 80 00 00 	movabs $0x8051c2,%rax
+  8035c3:	00 00 00 
+  8035c6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8035c8:	a8 04                	test   $0x4,%al
+  8035ca:	74 2b                	je     8035f7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8035cc:	41 89 c1             	mov    %eax,%r9d
+  8035cf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035d5:	4c 89 f1             	mov    %r14,%rcx
+  8035d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035dd:	48 89 de             	mov    %rbx,%rsi
+  8035e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e5:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+  8035f1:	89 c3                	mov    %eax,%ebx
+  8035f3:	85 c0                	test   %eax,%eax
+  8035f5:	78 4e                	js     803645 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8035f7:	4c 89 ff             	mov    %r15,%rdi
+  8035fa:	48 b8 c2 51 80 00 00 	movabs $0x8051c2,%rax
+  803601:	00 00 00 
+  803604:	ff d0                	call   *%rax
+  803606:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803609:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80360f:	4c 89 e9             	mov    %r13,%rcx
+  803612:	ba 00 00 00 00       	mov    $0x0,%edx
+  803617:	4c 89 fe             	mov    %r15,%rsi
+  80361a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80361f:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+  80362b:	89 c3                	mov    %eax,%ebx
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	78 14                	js     803645 <dup+0xf7>
+
+    return newfdnum;
+  803631:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803634:	89 d8                	mov    %ebx,%eax
+  803636:	48 83 c4 18          	add    $0x18,%rsp
+  80363a:	5b                   	pop    %rbx
+  80363b:	41 5c                	pop    %r12
+  80363d:	41 5d                	pop    %r13
+  80363f:	41 5e                	pop    %r14
+  803641:	41 5f                	pop    %r15
+  803643:	5d                   	pop    %rbp
+  803644:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803645:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80364a:	4c 89 ee             	mov    %r13,%rsi
+  80364d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803652:	49 bc c8 2b 80 00 00 	movabs $0x802bc8,%r12
+  803659:	00 00 00 
+  80365c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80365f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803664:	4c 89 f6             	mov    %r14,%rsi
+  803667:	bf 00 00 00 00       	mov    $0x0,%edi
+  80366c:	41 ff d4             	call   *%r12
+    return res;
+  80366f:	eb c3                	jmp    803634 <dup+0xe6>
+
+0000000000803671 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803671:	55                   	push   %rbp
+  803672:	48 89 e5             	mov    %rsp,%rbp
+  803675:	41 56                	push   %r14
+  803677:	41 55                	push   %r13
+  803679:	41 54                	push   %r12
+  80367b:	53                   	push   %rbx
+  80367c:	48 83 ec 10          	sub    $0x10,%rsp
+  803680:	89 fb                	mov    %edi,%ebx
+  803682:	49 89 f4             	mov    %rsi,%r12
+  803685:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803688:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80368c:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 4c                	js     8036e8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80369c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036a0:	41 8b 3e             	mov    (%r14),%edi
+  8036a3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036a7:	48 b8 d9 33 80 00 00 	movabs $0x8033d9,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+  8036b3:	85 c0                	test   %eax,%eax
+  8036b5:	78 35                	js     8036ec <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8036b7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8036bb:	83 e0 03             	and    $0x3,%eax
+  8036be:	83 f8 01             	cmp    $0x1,%eax
+  8036c1:	74 2d                	je     8036f0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036c7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8036cb:	48 85 c0             	test   %rax,%rax
+  8036ce:	74 56                	je     803726 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8036d0:	4c 89 ea             	mov    %r13,%rdx
+  8036d3:	4c 89 e6             	mov    %r12,%rsi
+  8036d6:	4c 89 f7             	mov    %r14,%rdi
+  8036d9:	ff d0                	call   *%rax
+}
+  8036db:	48 83 c4 10          	add    $0x10,%rsp
+  8036df:	5b                   	pop    %rbx
+  8036e0:	41 5c                	pop    %r12
+  8036e2:	41 5d                	pop    %r13
+  8036e4:	41 5e                	pop    %r14
+  8036e6:	5d                   	pop    %rbp
+  8036e7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036e8:	48 98                	cltq
+  8036ea:	eb ef                	jmp    8036db <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036ec:	48 98                	cltq
+  8036ee:	eb eb                	jmp    8036db <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8036f0:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8036f7:	00 00 00 
+  8036fa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803700:	89 da                	mov    %ebx,%edx
+  803702:	48 bf 79 71 80 00 00 	movabs $0x807179,%rdi
+  803709:	00 00 00 
+  80370c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803711:	48 b9 54 1a 80 00 00 	movabs $0x801a54,%rcx
+  803718:	00 00 00 
+  80371b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80371d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803724:	eb b5                	jmp    8036db <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803726:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80372d:	eb ac                	jmp    8036db <read+0x6a>
+
+000000000080372f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80372f:	55                   	push   %rbp
+  803730:	48 89 e5             	mov    %rsp,%rbp
+  803733:	41 57                	push   %r15
+  803735:	41 56                	push   %r14
+  803737:	41 55                	push   %r13
+  803739:	41 54                	push   %r12
+  80373b:	53                   	push   %rbx
+  80373c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803740:	48 85 d2             	test   %rdx,%rdx
+  803743:	74 54                	je     803799 <readn+0x6a>
+  803745:	41 89 fd             	mov    %edi,%r13d
+  803748:	49 89 f6             	mov    %rsi,%r14
+  80374b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80374e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803753:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803758:	49 bf 71 36 80 00 00 	movabs $0x803671,%r15
+  80375f:	00 00 00 
+  803762:	4c 89 e2             	mov    %r12,%rdx
+  803765:	48 29 f2             	sub    %rsi,%rdx
+  803768:	4c 01 f6             	add    %r14,%rsi
+  80376b:	44 89 ef             	mov    %r13d,%edi
+  80376e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803771:	85 c0                	test   %eax,%eax
+  803773:	78 20                	js     803795 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803775:	01 c3                	add    %eax,%ebx
+  803777:	85 c0                	test   %eax,%eax
+  803779:	74 08                	je     803783 <readn+0x54>
+  80377b:	48 63 f3             	movslq %ebx,%rsi
+  80377e:	4c 39 e6             	cmp    %r12,%rsi
+  803781:	72 df                	jb     803762 <readn+0x33>
+    }
+    return res;
+  803783:	48 63 c3             	movslq %ebx,%rax
+}
+  803786:	48 83 c4 08          	add    $0x8,%rsp
+  80378a:	5b                   	pop    %rbx
+  80378b:	41 5c                	pop    %r12
+  80378d:	41 5d                	pop    %r13
+  80378f:	41 5e                	pop    %r14
+  803791:	41 5f                	pop    %r15
+  803793:	5d                   	pop    %rbp
+  803794:	c3                   	ret
+        if (inc < 0) return inc;
+  803795:	48 98                	cltq
+  803797:	eb ed                	jmp    803786 <readn+0x57>
+    int inc = 1, res = 0;
+  803799:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80379e:	eb e3                	jmp    803783 <readn+0x54>
+
+00000000008037a0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8037a0:	55                   	push   %rbp
+  8037a1:	48 89 e5             	mov    %rsp,%rbp
+  8037a4:	41 56                	push   %r14
+  8037a6:	41 55                	push   %r13
+  8037a8:	41 54                	push   %r12
+  8037aa:	53                   	push   %rbx
+  8037ab:	48 83 ec 10          	sub    $0x10,%rsp
+  8037af:	89 fb                	mov    %edi,%ebx
+  8037b1:	49 89 f4             	mov    %rsi,%r12
+  8037b4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037bb:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  8037c2:	00 00 00 
+  8037c5:	ff d0                	call   *%rax
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	78 47                	js     803812 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037cb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037cf:	41 8b 3e             	mov    (%r14),%edi
+  8037d2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037d6:	48 b8 d9 33 80 00 00 	movabs $0x8033d9,%rax
+  8037dd:	00 00 00 
+  8037e0:	ff d0                	call   *%rax
+  8037e2:	85 c0                	test   %eax,%eax
+  8037e4:	78 30                	js     803816 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8037e6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8037eb:	74 2d                	je     80381a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037f1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8037f5:	48 85 c0             	test   %rax,%rax
+  8037f8:	74 56                	je     803850 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8037fa:	4c 89 ea             	mov    %r13,%rdx
+  8037fd:	4c 89 e6             	mov    %r12,%rsi
+  803800:	4c 89 f7             	mov    %r14,%rdi
+  803803:	ff d0                	call   *%rax
+}
+  803805:	48 83 c4 10          	add    $0x10,%rsp
+  803809:	5b                   	pop    %rbx
+  80380a:	41 5c                	pop    %r12
+  80380c:	41 5d                	pop    %r13
+  80380e:	41 5e                	pop    %r14
+  803810:	5d                   	pop    %rbp
+  803811:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803812:	48 98                	cltq
+  803814:	eb ef                	jmp    803805 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803816:	48 98                	cltq
+  803818:	eb eb                	jmp    803805 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80381a:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803821:	00 00 00 
+  803824:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80382a:	89 da                	mov    %ebx,%edx
+  80382c:	48 bf 95 71 80 00 00 	movabs $0x807195,%rdi
+  803833:	00 00 00 
+  803836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383b:	48 b9 54 1a 80 00 00 	movabs $0x801a54,%rcx
+  803842:	00 00 00 
+  803845:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803847:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80384e:	eb b5                	jmp    803805 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803850:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803857:	eb ac                	jmp    803805 <write+0x65>
+
+0000000000803859 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803859:	55                   	push   %rbp
+  80385a:	48 89 e5             	mov    %rsp,%rbp
+  80385d:	53                   	push   %rbx
+  80385e:	48 83 ec 18          	sub    $0x18,%rsp
+  803862:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803864:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803868:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  80386f:	00 00 00 
+  803872:	ff d0                	call   *%rax
+  803874:	85 c0                	test   %eax,%eax
+  803876:	78 0c                	js     803884 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803878:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80387c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80387f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803884:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803888:	c9                   	leave
+  803889:	c3                   	ret
+
+000000000080388a <tell>:
+
+int tell(int fdnum) {
+  80388a:	55                   	push   %rbp
+  80388b:	48 89 e5             	mov    %rsp,%rbp
+  80388e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803892:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803896:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  80389d:	00 00 00 
+  8038a0:	ff d0                	call   *%rax
+  8038a2:	85 c0                	test   %eax,%eax
+  8038a4:	78 07                	js     8038ad <tell+0x23>
+
+    return fd->fd_offset;
+  8038a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038aa:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8038ad:	c9                   	leave
+  8038ae:	c3                   	ret
+
+00000000008038af <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8038af:	55                   	push   %rbp
+  8038b0:	48 89 e5             	mov    %rsp,%rbp
+  8038b3:	41 55                	push   %r13
+  8038b5:	41 54                	push   %r12
+  8038b7:	53                   	push   %rbx
+  8038b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8038bc:	89 fb                	mov    %edi,%ebx
+  8038be:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038c1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038c5:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  8038cc:	00 00 00 
+  8038cf:	ff d0                	call   *%rax
+  8038d1:	85 c0                	test   %eax,%eax
+  8038d3:	78 38                	js     80390d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038d5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8038d9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8038dd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038e1:	48 b8 d9 33 80 00 00 	movabs $0x8033d9,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+  8038ed:	85 c0                	test   %eax,%eax
+  8038ef:	78 1c                	js     80390d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8038f1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8038f6:	74 20                	je     803918 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038fc:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803900:	48 85 c0             	test   %rax,%rax
+  803903:	74 47                	je     80394c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803905:	44 89 e6             	mov    %r12d,%esi
+  803908:	4c 89 ef             	mov    %r13,%rdi
+  80390b:	ff d0                	call   *%rax
+}
+  80390d:	48 83 c4 18          	add    $0x18,%rsp
+  803911:	5b                   	pop    %rbx
+  803912:	41 5c                	pop    %r12
+  803914:	41 5d                	pop    %r13
+  803916:	5d                   	pop    %rbp
+  803917:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803918:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80391f:	00 00 00 
+  803922:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803928:	89 da                	mov    %ebx,%edx
+  80392a:	48 bf 58 71 80 00 00 	movabs $0x807158,%rdi
+  803931:	00 00 00 
+  803934:	b8 00 00 00 00       	mov    $0x0,%eax
+  803939:	48 b9 54 1a 80 00 00 	movabs $0x801a54,%rcx
+  803940:	00 00 00 
+  803943:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803945:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80394a:	eb c1                	jmp    80390d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80394c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803951:	eb ba                	jmp    80390d <ftruncate+0x5e>
+
+0000000000803953 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	41 54                	push   %r12
+  803959:	53                   	push   %rbx
+  80395a:	48 83 ec 10          	sub    $0x10,%rsp
+  80395e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803961:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803965:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+  803971:	85 c0                	test   %eax,%eax
+  803973:	78 63                	js     8039d8 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803975:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803979:	41 8b 3c 24          	mov    (%r12),%edi
+  80397d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803981:	48 b8 d9 33 80 00 00 	movabs $0x8033d9,%rax
+  803988:	00 00 00 
+  80398b:	ff d0                	call   *%rax
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	78 47                	js     8039d8 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803991:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803995:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80399a:	74 45                	je     8039e1 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80399c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80399f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8039a6:	00 00 00 
+    stat->st_isdir = 0;
+  8039a9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039b0:	00 00 00 
+    stat->st_ino = 0;
+  8039b3:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8039ba:	00 00 00 00 
+    stat->st_version = 0;
+  8039be:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8039c5:	00 00 00 
+    stat->st_dev = dev;
+  8039c8:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8039cf:	48 89 de             	mov    %rbx,%rsi
+  8039d2:	4c 89 e7             	mov    %r12,%rdi
+  8039d5:	ff 50 28             	call   *0x28(%rax)
+}
+  8039d8:	48 83 c4 10          	add    $0x10,%rsp
+  8039dc:	5b                   	pop    %rbx
+  8039dd:	41 5c                	pop    %r12
+  8039df:	5d                   	pop    %rbp
+  8039e0:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039e1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039e6:	eb f0                	jmp    8039d8 <fstat+0x85>
+
+00000000008039e8 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8039e8:	55                   	push   %rbp
+  8039e9:	48 89 e5             	mov    %rsp,%rbp
+  8039ec:	41 54                	push   %r12
+  8039ee:	53                   	push   %rbx
+  8039ef:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8039f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8039f7:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  8039fe:	00 00 00 
+  803a01:	ff d0                	call   *%rax
+  803a03:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a05:	85 c0                	test   %eax,%eax
+  803a07:	78 25                	js     803a2e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a09:	4c 89 e6             	mov    %r12,%rsi
+  803a0c:	89 c7                	mov    %eax,%edi
+  803a0e:	48 b8 53 39 80 00 00 	movabs $0x803953,%rax
+  803a15:	00 00 00 
+  803a18:	ff d0                	call   *%rax
+  803a1a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a1d:	89 df                	mov    %ebx,%edi
+  803a1f:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  803a26:	00 00 00 
+  803a29:	ff d0                	call   *%rax
+
+    return res;
+  803a2b:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a2e:	89 d8                	mov    %ebx,%eax
+  803a30:	5b                   	pop    %rbx
+  803a31:	41 5c                	pop    %r12
+  803a33:	5d                   	pop    %rbp
+  803a34:	c3                   	ret
+
+0000000000803a35 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a35:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  803a3c:	00 00 00 
+  803a3f:	83 38 00             	cmpl   $0x0,(%rax)
+  803a42:	74 0a                	je     803a4e <fsipc_env+0x19>
+    return fsenv;
+}
+  803a44:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803a4b:	00 00 
+  803a4d:	c3                   	ret
+fsipc_env(void) {
+  803a4e:	55                   	push   %rbp
+  803a4f:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a52:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a57:	48 b8 cc 64 80 00 00 	movabs $0x8064cc,%rax
+  803a5e:	00 00 00 
+  803a61:	ff d0                	call   *%rax
+  803a63:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  803a6a:	00 00 
+}
+  803a6c:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803a73:	00 00 
+  803a75:	5d                   	pop    %rbp
+  803a76:	c3                   	ret
+
+0000000000803a77 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a77:	55                   	push   %rbp
+  803a78:	48 89 e5             	mov    %rsp,%rbp
+  803a7b:	53                   	push   %rbx
+  803a7c:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a80:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a87:	00 
+  803a88:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a8f:	00 
+  803a90:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a97:	00 
+  803a98:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a9f:	00 
+  803aa0:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803aa7:	00 
+
+    assert(size <= sizeof(words));
+  803aa8:	48 83 fa 28          	cmp    $0x28,%rdx
+  803aac:	77 38                	ja     803ae6 <fsipc_short+0x6f>
+  803aae:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803ab0:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803ab4:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  803abb:	00 00 00 
+  803abe:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803ac0:	48 b8 35 3a 80 00 00 	movabs $0x803a35,%rax
+  803ac7:	00 00 00 
+  803aca:	ff d0                	call   *%rax
+  803acc:	89 c7                	mov    %eax,%edi
+  803ace:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803ad2:	89 de                	mov    %ebx,%esi
+  803ad4:	48 b8 2f 64 80 00 00 	movabs $0x80642f,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+}
+  803ae0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ae4:	c9                   	leave
+  803ae5:	c3                   	ret
+    assert(size <= sizeof(words));
+  803ae6:	48 b9 e0 71 80 00 00 	movabs $0x8071e0,%rcx
+  803aed:	00 00 00 
+  803af0:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803af7:	00 00 00 
+  803afa:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803aff:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803b06:	00 00 00 
+  803b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0e:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803b15:	00 00 00 
+  803b18:	41 ff d0             	call   *%r8
+
+0000000000803b1b <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b1b:	55                   	push   %rbp
+  803b1c:	48 89 e5             	mov    %rsp,%rbp
+  803b1f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b23:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b26:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b29:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b2c:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b31:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b35:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b3a:	48 b8 77 3a 80 00 00 	movabs $0x803a77,%rax
+  803b41:	00 00 00 
+  803b44:	ff d0                	call   *%rax
+}
+  803b46:	c9                   	leave
+  803b47:	c3                   	ret
+
+0000000000803b48 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803b48:	55                   	push   %rbp
+  803b49:	48 89 e5             	mov    %rsp,%rbp
+  803b4c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803b50:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803b56:	ba 04 00 00 00       	mov    $0x4,%edx
+  803b5b:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803b5f:	bf 06 00 00 00       	mov    $0x6,%edi
+  803b64:	48 b8 77 3a 80 00 00 	movabs $0x803a77,%rax
+  803b6b:	00 00 00 
+  803b6e:	ff d0                	call   *%rax
+}
+  803b70:	c9                   	leave
+  803b71:	c3                   	ret
+
+0000000000803b72 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b72:	55                   	push   %rbp
+  803b73:	48 89 e5             	mov    %rsp,%rbp
+  803b76:	41 54                	push   %r12
+  803b78:	53                   	push   %rbx
+  803b79:	48 83 ec 10          	sub    $0x10,%rsp
+  803b7d:	89 fb                	mov    %edi,%ebx
+  803b7f:	49 89 f4             	mov    %rsi,%r12
+  803b82:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b86:	48 b8 35 3a 80 00 00 	movabs $0x803a35,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	89 c7                	mov    %eax,%edi
+  803b94:	6a 00                	push   $0x0
+  803b96:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b9a:	50                   	push   %rax
+  803b9b:	4d 89 e1             	mov    %r12,%r9
+  803b9e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803ba4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ba9:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  803bb0:	00 00 00 
+  803bb3:	89 de                	mov    %ebx,%esi
+  803bb5:	48 b8 ca 63 80 00 00 	movabs $0x8063ca,%rax
+  803bbc:	00 00 00 
+  803bbf:	ff d0                	call   *%rax
+}
+  803bc1:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803bc5:	5b                   	pop    %rbx
+  803bc6:	41 5c                	pop    %r12
+  803bc8:	5d                   	pop    %rbp
+  803bc9:	c3                   	ret
+
+0000000000803bca <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803bca:	55                   	push   %rbp
+  803bcb:	48 89 e5             	mov    %rsp,%rbp
+  803bce:	41 54                	push   %r12
+  803bd0:	53                   	push   %rbx
+  803bd1:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803bd4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bd7:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803bde:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803be5:	be 00 00 00 00       	mov    $0x0,%esi
+  803bea:	bf 05 00 00 00       	mov    $0x5,%edi
+  803bef:	48 b8 72 3b 80 00 00 	movabs $0x803b72,%rax
+  803bf6:	00 00 00 
+  803bf9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bfb:	85 c0                	test   %eax,%eax
+  803bfd:	78 5a                	js     803c59 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803bff:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  803c06:	00 00 00 
+  803c09:	4c 89 e6             	mov    %r12,%rsi
+  803c0c:	48 89 df             	mov    %rbx,%rdi
+  803c0f:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  803c16:	00 00 00 
+  803c19:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c1b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c22:	00 
+  803c23:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c29:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c30:	00 
+  803c31:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c37:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803c3e:	00 
+  803c3f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803c46:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803c4d:	00 
+  803c4e:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803c54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c59:	5b                   	pop    %rbx
+  803c5a:	41 5c                	pop    %r12
+  803c5c:	5d                   	pop    %rbp
+  803c5d:	c3                   	ret
+
+0000000000803c5e <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c5e:	55                   	push   %rbp
+  803c5f:	48 89 e5             	mov    %rsp,%rbp
+  803c62:	41 57                	push   %r15
+  803c64:	41 56                	push   %r14
+  803c66:	41 55                	push   %r13
+  803c68:	41 54                	push   %r12
+  803c6a:	53                   	push   %rbx
+  803c6b:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c6f:	48 85 ff             	test   %rdi,%rdi
+  803c72:	0f 84 a1 00 00 00    	je     803d19 <devfile_read+0xbb>
+  803c78:	49 89 ff             	mov    %rdi,%r15
+  803c7b:	49 89 f5             	mov    %rsi,%r13
+  803c7e:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c81:	48 85 f6             	test   %rsi,%rsi
+  803c84:	0f 84 c4 00 00 00    	je     803d4e <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c8a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c91:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c92:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  803c99:	00 00 00 
+  803c9c:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803ca0:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803ca3:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ca7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cac:	be 00 00 00 00       	mov    $0x0,%esi
+  803cb1:	bf 03 00 00 00       	mov    $0x3,%edi
+  803cb6:	48 b8 72 3b 80 00 00 	movabs $0x803b72,%rax
+  803cbd:	00 00 00 
+  803cc0:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cc2:	85 c0                	test   %eax,%eax
+  803cc4:	0f 88 b9 00 00 00    	js     803d83 <devfile_read+0x125>
+        assert(res <= n);
+  803cca:	48 63 d8             	movslq %eax,%rbx
+  803ccd:	49 39 dc             	cmp    %rbx,%r12
+  803cd0:	0f 82 b1 00 00 00    	jb     803d87 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cd6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803cdb:	0f 87 db 00 00 00    	ja     803dbc <devfile_read+0x15e>
+        if (!res) {
+  803ce1:	85 c0                	test   %eax,%eax
+  803ce3:	74 21                	je     803d06 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ce5:	48 89 da             	mov    %rbx,%rdx
+  803ce8:	4c 89 f6             	mov    %r14,%rsi
+  803ceb:	4c 89 ef             	mov    %r13,%rdi
+  803cee:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  803cf5:	00 00 00 
+  803cf8:	ff d0                	call   *%rax
+        total_read += res;
+  803cfa:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803cfe:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803d01:	49 29 dc             	sub    %rbx,%r12
+  803d04:	75 96                	jne    803c9c <devfile_read+0x3e>
+    return total_read;
+  803d06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d0a:	48 83 c4 18          	add    $0x18,%rsp
+  803d0e:	5b                   	pop    %rbx
+  803d0f:	41 5c                	pop    %r12
+  803d11:	41 5d                	pop    %r13
+  803d13:	41 5e                	pop    %r14
+  803d15:	41 5f                	pop    %r15
+  803d17:	5d                   	pop    %rbp
+  803d18:	c3                   	ret
+    assert(fd);
+  803d19:	48 b9 16 72 80 00 00 	movabs $0x807216,%rcx
+  803d20:	00 00 00 
+  803d23:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803d2a:	00 00 00 
+  803d2d:	be 91 00 00 00       	mov    $0x91,%esi
+  803d32:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803d39:	00 00 00 
+  803d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d41:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803d48:	00 00 00 
+  803d4b:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d4e:	48 b9 19 72 80 00 00 	movabs $0x807219,%rcx
+  803d55:	00 00 00 
+  803d58:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803d5f:	00 00 00 
+  803d62:	be 92 00 00 00       	mov    $0x92,%esi
+  803d67:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803d6e:	00 00 00 
+  803d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d76:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803d7d:	00 00 00 
+  803d80:	41 ff d0             	call   *%r8
+            return res;
+  803d83:	48 98                	cltq
+  803d85:	eb 83                	jmp    803d0a <devfile_read+0xac>
+        assert(res <= n);
+  803d87:	48 b9 1d 72 80 00 00 	movabs $0x80721d,%rcx
+  803d8e:	00 00 00 
+  803d91:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803d98:	00 00 00 
+  803d9b:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803da0:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803da7:	00 00 00 
+  803daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803daf:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803db6:	00 00 00 
+  803db9:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803dbc:	48 b9 28 72 80 00 00 	movabs $0x807228,%rcx
+  803dc3:	00 00 00 
+  803dc6:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803dcd:	00 00 00 
+  803dd0:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803dd5:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803ddc:	00 00 00 
+  803ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de4:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803deb:	00 00 00 
+  803dee:	41 ff d0             	call   *%r8
+
+0000000000803df1 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803df1:	55                   	push   %rbp
+  803df2:	48 89 e5             	mov    %rsp,%rbp
+  803df5:	41 57                	push   %r15
+  803df7:	41 56                	push   %r14
+  803df9:	41 55                	push   %r13
+  803dfb:	41 54                	push   %r12
+  803dfd:	53                   	push   %rbx
+  803dfe:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803e02:	48 85 ff             	test   %rdi,%rdi
+  803e05:	0f 84 83 00 00 00    	je     803e8e <devfile_write+0x9d>
+  803e0b:	49 89 ff             	mov    %rdi,%r15
+  803e0e:	49 89 f4             	mov    %rsi,%r12
+  803e11:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e14:	48 85 f6             	test   %rsi,%rsi
+  803e17:	0f 84 a6 00 00 00    	je     803ec3 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e1d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e23:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  803e2a:	00 00 00 
+  803e2d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e31:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e34:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e38:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e3d:	48 39 d3             	cmp    %rdx,%rbx
+  803e40:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803e44:	4c 89 e6             	mov    %r12,%rsi
+  803e47:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  803e4e:	00 00 00 
+  803e51:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e62:	be 00 00 00 00       	mov    $0x0,%esi
+  803e67:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e6c:	48 b8 72 3b 80 00 00 	movabs $0x803b72,%rax
+  803e73:	00 00 00 
+  803e76:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e78:	85 c0                	test   %eax,%eax
+  803e7a:	78 7c                	js     803ef8 <devfile_write+0x107>
+        total_written += res;
+  803e7c:	48 98                	cltq
+  803e7e:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e81:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e84:	48 29 c3             	sub    %rax,%rbx
+  803e87:	75 a4                	jne    803e2d <devfile_write+0x3c>
+    return total_written;
+  803e89:	4c 89 e8             	mov    %r13,%rax
+  803e8c:	eb 6c                	jmp    803efa <devfile_write+0x109>
+    assert(fd);
+  803e8e:	48 b9 16 72 80 00 00 	movabs $0x807216,%rcx
+  803e95:	00 00 00 
+  803e98:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803e9f:	00 00 00 
+  803ea2:	be bd 00 00 00       	mov    $0xbd,%esi
+  803ea7:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803eae:	00 00 00 
+  803eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb6:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803ebd:	00 00 00 
+  803ec0:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ec3:	48 b9 19 72 80 00 00 	movabs $0x807219,%rcx
+  803eca:	00 00 00 
+  803ecd:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  803ed4:	00 00 00 
+  803ed7:	be be 00 00 00       	mov    $0xbe,%esi
+  803edc:	48 bf 0b 72 80 00 00 	movabs $0x80720b,%rdi
+  803ee3:	00 00 00 
+  803ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eeb:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  803ef2:	00 00 00 
+  803ef5:	41 ff d0             	call   *%r8
+            return res;
+  803ef8:	48 98                	cltq
+}
+  803efa:	48 83 c4 08          	add    $0x8,%rsp
+  803efe:	5b                   	pop    %rbx
+  803eff:	41 5c                	pop    %r12
+  803f01:	41 5d                	pop    %r13
+  803f03:	41 5e                	pop    %r14
+  803f05:	41 5f                	pop    %r15
+  803f07:	5d                   	pop    %rbp
+  803f08:	c3                   	ret
+
+0000000000803f09 <open>:
+open(const char *path, int mode) {
+  803f09:	55                   	push   %rbp
+  803f0a:	48 89 e5             	mov    %rsp,%rbp
+  803f0d:	41 55                	push   %r13
+  803f0f:	41 54                	push   %r12
+  803f11:	53                   	push   %rbx
+  803f12:	48 83 ec 18          	sub    $0x18,%rsp
+  803f16:	49 89 fc             	mov    %rdi,%r12
+  803f19:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f1c:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  803f23:	00 00 00 
+  803f26:	ff d0                	call   *%rax
+  803f28:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f2e:	0f 87 8f 00 00 00    	ja     803fc3 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f34:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f38:	48 b8 2e 33 80 00 00 	movabs $0x80332e,%rax
+  803f3f:	00 00 00 
+  803f42:	ff d0                	call   *%rax
+  803f44:	89 c3                	mov    %eax,%ebx
+  803f46:	85 c0                	test   %eax,%eax
+  803f48:	78 55                	js     803f9f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f4a:	4c 89 e6             	mov    %r12,%rsi
+  803f4d:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  803f54:	00 00 00 
+  803f57:	48 89 df             	mov    %rbx,%rdi
+  803f5a:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  803f61:	00 00 00 
+  803f64:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f66:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f72:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f76:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f7b:	48 b8 72 3b 80 00 00 	movabs $0x803b72,%rax
+  803f82:	00 00 00 
+  803f85:	ff d0                	call   *%rax
+  803f87:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f89:	85 c0                	test   %eax,%eax
+  803f8b:	78 1f                	js     803fac <open+0xa3>
+    return fd2num(fd);
+  803f8d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f91:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  803f98:	00 00 00 
+  803f9b:	ff d0                	call   *%rax
+  803f9d:	89 c3                	mov    %eax,%ebx
+}
+  803f9f:	89 d8                	mov    %ebx,%eax
+  803fa1:	48 83 c4 18          	add    $0x18,%rsp
+  803fa5:	5b                   	pop    %rbx
+  803fa6:	41 5c                	pop    %r12
+  803fa8:	41 5d                	pop    %r13
+  803faa:	5d                   	pop    %rbp
+  803fab:	c3                   	ret
+        fd_close(fd, 0);
+  803fac:	be 00 00 00 00       	mov    $0x0,%esi
+  803fb1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fb5:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  803fbc:	00 00 00 
+  803fbf:	ff d0                	call   *%rax
+        return res;
+  803fc1:	eb dc                	jmp    803f9f <open+0x96>
+        return -E_BAD_PATH;
+  803fc3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fc8:	eb d5                	jmp    803f9f <open+0x96>
+
+0000000000803fca <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803fca:	55                   	push   %rbp
+  803fcb:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803fce:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fd3:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd8:	bf 08 00 00 00       	mov    $0x8,%edi
+  803fdd:	48 b8 77 3a 80 00 00 	movabs $0x803a77,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+}
+  803fe9:	5d                   	pop    %rbp
+  803fea:	c3                   	ret
+
+0000000000803feb <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803feb:	55                   	push   %rbp
+  803fec:	48 89 e5             	mov    %rsp,%rbp
+  803fef:	41 56                	push   %r14
+  803ff1:	41 55                	push   %r13
+  803ff3:	41 54                	push   %r12
+  803ff5:	53                   	push   %rbx
+  803ff6:	48 83 ec 10          	sub    $0x10,%rsp
+  803ffa:	41 89 f6             	mov    %esi,%r14d
+  803ffd:	49 89 d4             	mov    %rdx,%r12
+  804000:	48 89 cb             	mov    %rcx,%rbx
+  804003:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804006:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80400a:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  804011:	00 00 00 
+  804014:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804016:	85 c0                	test   %eax,%eax
+  804018:	78 46                	js     804060 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80401a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80401e:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  804025:	00 00 00 
+  804028:	8b 00                	mov    (%rax),%eax
+  80402a:	39 02                	cmp    %eax,(%rdx)
+  80402c:	75 3f                	jne    80406d <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80402e:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  804035:	00 00 00 
+  804038:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80403b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  80403d:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804041:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804045:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804049:	48 89 da             	mov    %rbx,%rdx
+  80404c:	4c 89 e6             	mov    %r12,%rsi
+  80404f:	bf 09 00 00 00       	mov    $0x9,%edi
+  804054:	48 b8 72 3b 80 00 00 	movabs $0x803b72,%rax
+  80405b:	00 00 00 
+  80405e:	ff d0                	call   *%rax
+}
+  804060:	48 83 c4 10          	add    $0x10,%rsp
+  804064:	5b                   	pop    %rbx
+  804065:	41 5c                	pop    %r12
+  804067:	41 5d                	pop    %r13
+  804069:	41 5e                	pop    %r14
+  80406b:	5d                   	pop    %rbp
+  80406c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80406d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804072:	eb ec                	jmp    804060 <file_map+0x75>
+
+0000000000804074 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804074:	55                   	push   %rbp
+  804075:	48 89 e5             	mov    %rsp,%rbp
+  804078:	41 54                	push   %r12
+  80407a:	53                   	push   %rbx
+  80407b:	48 83 ec 20          	sub    $0x20,%rsp
+  80407f:	41 89 f4             	mov    %esi,%r12d
+  804082:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804085:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804089:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  804090:	00 00 00 
+  804093:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804095:	85 c0                	test   %eax,%eax
+  804097:	78 3c                	js     8040d5 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804099:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80409d:	48 ba 40 80 80 00 00 	movabs $0x808040,%rdx
+  8040a4:	00 00 00 
+  8040a7:	8b 0a                	mov    (%rdx),%ecx
+  8040a9:	39 08                	cmp    %ecx,(%rax)
+  8040ab:	75 31                	jne    8040de <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8040ad:	8b 40 0c             	mov    0xc(%rax),%eax
+  8040b0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8040b3:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8040b7:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8040bb:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040c0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8040c9:	48 b8 77 3a 80 00 00 	movabs $0x803a77,%rax
+  8040d0:	00 00 00 
+  8040d3:	ff d0                	call   *%rax
+}
+  8040d5:	48 83 c4 20          	add    $0x20,%rsp
+  8040d9:	5b                   	pop    %rbx
+  8040da:	41 5c                	pop    %r12
+  8040dc:	5d                   	pop    %rbp
+  8040dd:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040de:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040e3:	eb f0                	jmp    8040d5 <file_msync+0x61>
+
+00000000008040e5 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8040e5:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8040e9:	7f 01                	jg     8040ec <writebuf+0x7>
+  8040eb:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8040ec:	55                   	push   %rbp
+  8040ed:	48 89 e5             	mov    %rsp,%rbp
+  8040f0:	53                   	push   %rbx
+  8040f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8040f5:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8040f8:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8040fc:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804100:	8b 3f                	mov    (%rdi),%edi
+  804102:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  804109:	00 00 00 
+  80410c:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80410e:	48 85 c0             	test   %rax,%rax
+  804111:	7e 04                	jle    804117 <writebuf+0x32>
+  804113:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804117:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80411b:	48 39 c2             	cmp    %rax,%rdx
+  80411e:	74 0f                	je     80412f <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804120:	48 85 c0             	test   %rax,%rax
+  804123:	ba 00 00 00 00       	mov    $0x0,%edx
+  804128:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80412c:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80412f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804133:	c9                   	leave
+  804134:	c3                   	ret
+
+0000000000804135 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804135:	8b 46 04             	mov    0x4(%rsi),%eax
+  804138:	8d 50 01             	lea    0x1(%rax),%edx
+  80413b:	89 56 04             	mov    %edx,0x4(%rsi)
+  80413e:	48 98                	cltq
+  804140:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804145:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80414b:	74 01                	je     80414e <putch+0x19>
+  80414d:	c3                   	ret
+putch(int ch, void *arg) {
+  80414e:	55                   	push   %rbp
+  80414f:	48 89 e5             	mov    %rsp,%rbp
+  804152:	53                   	push   %rbx
+  804153:	48 83 ec 08          	sub    $0x8,%rsp
+  804157:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80415a:	48 89 f7             	mov    %rsi,%rdi
+  80415d:	48 b8 e5 40 80 00 00 	movabs $0x8040e5,%rax
+  804164:	00 00 00 
+  804167:	ff d0                	call   *%rax
+        state->offset = 0;
+  804169:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804170:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804174:	c9                   	leave
+  804175:	c3                   	ret
+
+0000000000804176 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804176:	55                   	push   %rbp
+  804177:	48 89 e5             	mov    %rsp,%rbp
+  80417a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804181:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804184:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80418a:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804191:	00 00 00 
+    state.result = 0;
+  804194:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80419b:	00 00 00 00 
+    state.error = 1;
+  80419f:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8041a6:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8041a9:	48 89 f2             	mov    %rsi,%rdx
+  8041ac:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8041b3:	48 bf 35 41 80 00 00 	movabs $0x804135,%rdi
+  8041ba:	00 00 00 
+  8041bd:	48 b8 a4 1b 80 00 00 	movabs $0x801ba4,%rax
+  8041c4:	00 00 00 
+  8041c7:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8041c9:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8041d0:	7f 14                	jg     8041e6 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8041d2:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8041d9:	48 85 c0             	test   %rax,%rax
+  8041dc:	75 06                	jne    8041e4 <vfprintf+0x6e>
+  8041de:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8041e4:	c9                   	leave
+  8041e5:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8041e6:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8041ed:	48 b8 e5 40 80 00 00 	movabs $0x8040e5,%rax
+  8041f4:	00 00 00 
+  8041f7:	ff d0                	call   *%rax
+  8041f9:	eb d7                	jmp    8041d2 <vfprintf+0x5c>
+
+00000000008041fb <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8041fb:	55                   	push   %rbp
+  8041fc:	48 89 e5             	mov    %rsp,%rbp
+  8041ff:	48 83 ec 50          	sub    $0x50,%rsp
+  804203:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804207:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80420b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80420f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804213:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80421a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80421e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804222:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804226:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80422a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80422e:	48 b8 76 41 80 00 00 	movabs $0x804176,%rax
+  804235:	00 00 00 
+  804238:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80423a:	c9                   	leave
+  80423b:	c3                   	ret
+
+000000000080423c <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80423c:	55                   	push   %rbp
+  80423d:	48 89 e5             	mov    %rsp,%rbp
+  804240:	48 83 ec 50          	sub    $0x50,%rsp
+  804244:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804248:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80424c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804250:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804254:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804258:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80425f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804263:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804267:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80426b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80426f:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804273:	48 89 fe             	mov    %rdi,%rsi
+  804276:	bf 01 00 00 00       	mov    $0x1,%edi
+  80427b:	48 b8 76 41 80 00 00 	movabs $0x804176,%rax
+  804282:	00 00 00 
+  804285:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804287:	c9                   	leave
+  804288:	c3                   	ret
+
+0000000000804289 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  804289:	55                   	push   %rbp
+  80428a:	48 89 e5             	mov    %rsp,%rbp
+  80428d:	41 55                	push   %r13
+  80428f:	41 54                	push   %r12
+  804291:	53                   	push   %rbx
+  804292:	48 83 ec 08          	sub    $0x8,%rsp
+  804296:	48 89 fb             	mov    %rdi,%rbx
+  804299:	49 89 f5             	mov    %rsi,%r13
+  80429c:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  80429f:	48 b8 c2 51 80 00 00 	movabs $0x8051c2,%rax
+  8042a6:	00 00 00 
+  8042a9:	ff d0                	call   *%rax
+  8042ab:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  8042ad:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  8042b4:	ff ff ff 
+  8042b7:	48 01 d8             	add    %rbx,%rax
+  8042ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042bf:	48 c1 e8 24          	shr    $0x24,%rax
+  8042c3:	74 5c                	je     804321 <collect_shared_region+0x98>
+
+    if (list->count) {
+  8042c5:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  8042cc:	00 
+  8042cd:	48 85 c0             	test   %rax,%rax
+  8042d0:	74 20                	je     8042f2 <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  8042d2:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8042d6:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  8042da:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  8042de:	48 89 f7             	mov    %rsi,%rdi
+  8042e1:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  8042e5:	48 39 fb             	cmp    %rdi,%rbx
+  8042e8:	74 44                	je     80432e <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  8042ea:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  8042f0:	74 59                	je     80434b <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  8042f2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8042f6:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  8042fd:	00 
+  8042fe:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  804302:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804306:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  80430a:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  80430d:	49 29 dd             	sub    %rbx,%r13
+  804310:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  804314:	48 01 c2             	add    %rax,%rdx
+  804317:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  80431c:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  804321:	89 d0                	mov    %edx,%eax
+  804323:	48 83 c4 08          	add    $0x8,%rsp
+  804327:	5b                   	pop    %rbx
+  804328:	41 5c                	pop    %r12
+  80432a:	41 5d                	pop    %r13
+  80432c:	5d                   	pop    %rbp
+  80432d:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  80432e:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  804333:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804338:	75 b0                	jne    8042ea <collect_shared_region+0x61>
+            last->size += end - start;
+  80433a:	49 29 dd             	sub    %rbx,%r13
+  80433d:	49 01 f5             	add    %rsi,%r13
+  804340:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  804344:	ba 00 00 00 00       	mov    $0x0,%edx
+  804349:	eb d6                	jmp    804321 <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  80434b:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  804350:	eb cf                	jmp    804321 <collect_shared_region+0x98>
+
+0000000000804352 <spawn>:
+spawn(const char *prog, const char **argv) {
+  804352:	55                   	push   %rbp
+  804353:	48 89 e5             	mov    %rsp,%rbp
+  804356:	41 57                	push   %r15
+  804358:	41 56                	push   %r14
+  80435a:	41 55                	push   %r13
+  80435c:	41 54                	push   %r12
+  80435e:	53                   	push   %rbx
+  80435f:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  804366:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  804369:	be 00 00 00 00       	mov    $0x0,%esi
+  80436e:	48 b8 09 3f 80 00 00 	movabs $0x803f09,%rax
+  804375:	00 00 00 
+  804378:	ff d0                	call   *%rax
+  80437a:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  80437d:	85 c0                	test   %eax,%eax
+  80437f:	0f 88 8f 06 00 00    	js     804a14 <spawn+0x6c2>
+    struct SpawnImage img = {
+  804385:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80438c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  804391:	b8 00 00 00 00       	mov    $0x0,%eax
+  804396:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  804399:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  8043a0:	00 00 00 
+  8043a3:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  8043aa:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8043b1:	00 00 00 
+  8043b4:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  8043bb:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8043c2:	44 89 f7             	mov    %r14d,%edi
+  8043c5:	48 b8 53 39 80 00 00 	movabs $0x803953,%rax
+  8043cc:	00 00 00 
+  8043cf:	ff d0                	call   *%rax
+  8043d1:	41 89 c4             	mov    %eax,%r12d
+  8043d4:	85 c0                	test   %eax,%eax
+  8043d6:	0f 88 26 06 00 00    	js     804a02 <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  8043dc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8043e3:	48 85 c0             	test   %rax,%rax
+  8043e6:	74 22                	je     80440a <spawn+0xb8>
+  8043e8:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  8043ef:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  8043f6:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  8043fd:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  804403:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  80440a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80440f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804414:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  80441b:	00 00 00 
+  80441e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804423:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  80442a:	00 00 00 
+  80442d:	ff d0                	call   *%rax
+  80442f:	41 89 c4             	mov    %eax,%r12d
+  804432:	85 c0                	test   %eax,%eax
+  804434:	0f 88 c8 05 00 00    	js     804a02 <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  80443a:	48 8b 3b             	mov    (%rbx),%rdi
+  80443d:	48 85 ff             	test   %rdi,%rdi
+  804440:	0f 84 61 02 00 00    	je     8046a7 <spawn+0x355>
+  804446:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  80444c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  804452:	49 bf 4d 23 80 00 00 	movabs $0x80234d,%r15
+  804459:	00 00 00 
+  80445c:	41 ff d7             	call   *%r15
+  80445f:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  804464:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  80446b:	49 83 c4 01          	add    $0x1,%r12
+  80446f:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  804474:	48 85 ff             	test   %rdi,%rdi
+  804477:	75 e3                	jne    80445c <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804479:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  80447f:	4d 29 ec             	sub    %r13,%r12
+  804482:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804489:	00 00 00 
+  80448c:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80448f:	4c 89 e1             	mov    %r12,%rcx
+  804492:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  804496:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  80449d:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  8044a4:	89 f0                	mov    %esi,%eax
+  8044a6:	83 c0 01             	add    $0x1,%eax
+  8044a9:	48 98                	cltq
+  8044ab:	48 c1 e0 03          	shl    $0x3,%rax
+  8044af:	48 29 c1             	sub    %rax,%rcx
+  8044b2:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8044b9:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8044bd:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  8044c4:	00 00 00 
+  8044c7:	48 39 c2             	cmp    %rax,%rdx
+  8044ca:	0f 83 f2 04 00 00    	jae    8049c2 <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  8044d0:	85 f6                	test   %esi,%esi
+  8044d2:	7e 4e                	jle    804522 <spawn+0x1d0>
+  8044d4:	49 89 cd             	mov    %rcx,%r13
+  8044d7:	48 63 c6             	movslq %esi,%rax
+  8044da:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  8044de:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  8044e5:	00 00 00 
+  8044e8:	4c 01 e0             	add    %r12,%rax
+  8044eb:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8044ef:	48 8b 33             	mov    (%rbx),%rsi
+  8044f2:	4c 89 e7             	mov    %r12,%rdi
+  8044f5:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  8044fc:	00 00 00 
+  8044ff:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  804501:	48 8b 3b             	mov    (%rbx),%rdi
+  804504:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+  804510:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  804515:	49 83 c5 08          	add    $0x8,%r13
+  804519:	48 83 c3 08          	add    $0x8,%rbx
+  80451d:	4d 39 fd             	cmp    %r15,%r13
+  804520:	75 bc                	jne    8044de <spawn+0x18c>
+    argv_store[argc] = 0;
+  804522:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804529:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  804530:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  804531:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804538:	00 00 00 
+  80453b:	49 39 c4             	cmp    %rax,%r12
+  80453e:	0f 85 92 01 00 00    	jne    8046d6 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  804544:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  80454b:	00 00 00 
+  80454e:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804555:	48 01 d0             	add    %rdx,%rax
+  804558:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  80455c:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  804563:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  804567:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  80456e:	00 00 00 
+  804571:	48 01 d0             	add    %rdx,%rax
+  804574:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  80457b:	48 be 20 b0 80 01 00 	movabs $0x180b020,%rsi
+  804582:	00 00 00 
+  804585:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  80458c:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  804590:	48 bf 89 42 80 00 00 	movabs $0x804289,%rdi
+  804597:	00 00 00 
+  80459a:	48 b8 36 52 80 00 00 	movabs $0x805236,%rax
+  8045a1:	00 00 00 
+  8045a4:	ff d0                	call   *%rax
+  8045a6:	41 89 c4             	mov    %eax,%r12d
+  8045a9:	85 c0                	test   %eax,%eax
+  8045ab:	0f 88 24 04 00 00    	js     8049d5 <spawn+0x683>
+    img.nshared = shared.count;
+  8045b1:	48 a1 20 c8 80 01 00 	movabs 0x180c820,%rax
+  8045b8:	00 00 00 
+  8045bb:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  8045c2:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  8045c9:	00 
+  8045ca:	74 1f                	je     8045eb <spawn+0x299>
+        res = sys_spawn(&img);
+  8045cc:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8045d3:	48 b8 61 2e 80 00 00 	movabs $0x802e61,%rax
+  8045da:	00 00 00 
+  8045dd:	ff d0                	call   *%rax
+  8045df:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  8045e2:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8045e5:	0f 85 ca 03 00 00    	jne    8049b5 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8045eb:	ba 00 02 00 00       	mov    $0x200,%edx
+  8045f0:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  8045f7:	44 89 f7             	mov    %r14d,%edi
+  8045fa:	48 b8 2f 37 80 00 00 	movabs $0x80372f,%rax
+  804601:	00 00 00 
+  804604:	ff d0                	call   *%rax
+  804606:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  804608:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80460d:	0f 85 f8 00 00 00    	jne    80470b <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  804613:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  80461a:	ff ff 00 
+  80461d:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  804624:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  80462b:	01 01 00 
+  80462e:	48 39 d0             	cmp    %rdx,%rax
+  804631:	0f 85 f7 00 00 00    	jne    80472e <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804637:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  80463e:	00 3e 00 
+  804641:	0f 85 e7 00 00 00    	jne    80472e <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  804647:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  80464e:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  804655:	ff 
+  804656:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  80465d:	00 
+  80465e:	4c 29 c0             	sub    %r8,%rax
+  804661:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  804665:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  80466b:	0f 87 bd 00 00 00    	ja     80472e <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804671:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804678:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804679:	4d 85 c0             	test   %r8,%r8
+  80467c:	0f 84 1b 02 00 00    	je     80489d <spawn+0x54b>
+  804682:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  804687:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80468e:	00 00 01 00 
+  804692:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804698:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  80469f:	00 00 00 
+  8046a2:	e9 d4 00 00 00       	jmp    80477b <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8046a7:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  8046ae:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8046b2:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  8046b9:	00 00 00 
+  8046bc:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8046c3:	48 8d 40 08          	lea    0x8(%rax),%rax
+  8046c7:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  8046ce:	49 89 c4             	mov    %rax,%r12
+  8046d1:	e9 4c fe ff ff       	jmp    804522 <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  8046d6:	48 b9 50 72 80 00 00 	movabs $0x807250,%rcx
+  8046dd:	00 00 00 
+  8046e0:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  8046e7:	00 00 00 
+  8046ea:	be e2 00 00 00       	mov    $0xe2,%esi
+  8046ef:	48 bf a9 72 80 00 00 	movabs $0x8072a9,%rdi
+  8046f6:	00 00 00 
+  8046f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fe:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  804705:	00 00 00 
+  804708:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  80470b:	48 bf 80 72 80 00 00 	movabs $0x807280,%rdi
+  804712:	00 00 00 
+  804715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80471a:	48 ba 54 1a 80 00 00 	movabs $0x801a54,%rdx
+  804721:	00 00 00 
+  804724:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  804726:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  80472c:	eb 2c                	jmp    80475a <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80472e:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804733:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  804739:	48 bf b5 72 80 00 00 	movabs $0x8072b5,%rdi
+  804740:	00 00 00 
+  804743:	b8 00 00 00 00       	mov    $0x0,%eax
+  804748:	48 b9 54 1a 80 00 00 	movabs $0x801a54,%rcx
+  80474f:	00 00 00 
+  804752:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  804754:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  80475a:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804761:	00 00 01 00 
+  804765:	e9 76 02 00 00       	jmp    8049e0 <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80476a:	48 83 c2 01          	add    $0x1,%rdx
+  80476e:	48 83 c0 38          	add    $0x38,%rax
+  804772:	49 39 d0             	cmp    %rdx,%r8
+  804775:	0f 84 a5 00 00 00    	je     804820 <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  80477b:	83 38 01             	cmpl   $0x1,(%rax)
+  80477e:	75 ea                	jne    80476a <spawn+0x418>
+  804780:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  804784:	48 85 f6             	test   %rsi,%rsi
+  804787:	74 e1                	je     80476a <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804789:	49 83 ff 10          	cmp    $0x10,%r15
+  80478d:	0f 84 a1 02 00 00    	je     804a34 <spawn+0x6e2>
+  804793:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  804797:	0f 82 aa 02 00 00    	jb     804a47 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  80479d:	8b 78 04             	mov    0x4(%rax),%edi
+  8047a0:	89 f9                	mov    %edi,%ecx
+  8047a2:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  8047a5:	41 89 c9             	mov    %ecx,%r9d
+  8047a8:	41 83 c9 04          	or     $0x4,%r9d
+  8047ac:	40 f6 c7 04          	test   $0x4,%dil
+  8047b0:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  8047b4:	41 89 c9             	mov    %ecx,%r9d
+  8047b7:	41 83 c9 01          	or     $0x1,%r9d
+  8047bb:	40 f6 c7 01          	test   $0x1,%dil
+  8047bf:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  8047c3:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  8047c7:	49 89 f9             	mov    %rdi,%r9
+  8047ca:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  8047d1:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  8047d8:	00 
+  8047d9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8047e0:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  8047e3:	4c 89 ff             	mov    %r15,%rdi
+  8047e6:	48 c1 e7 05          	shl    $0x5,%rdi
+  8047ea:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  8047f1:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  8047f4:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  8047fb:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  8047ff:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  804802:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  804806:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  80480a:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  80480d:	48 01 f3             	add    %rsi,%rbx
+  804810:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  804817:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  80481b:	e9 4a ff ff ff       	jmp    80476a <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804820:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  804827:	00 00 00 
+  80482a:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  804831:	48 39 c8             	cmp    %rcx,%rax
+  804834:	0f 82 ef 01 00 00    	jb     804a29 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  80483a:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  804841:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  804848:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80484d:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  804854:	00 00 00 
+  804857:	bf 00 00 00 00       	mov    $0x0,%edi
+  80485c:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  804863:	00 00 00 
+  804866:	ff d0                	call   *%rax
+  804868:	41 89 c4             	mov    %eax,%r12d
+  80486b:	85 c0                	test   %eax,%eax
+  80486d:	0f 88 e7 fe ff ff    	js     80475a <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804873:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  80487a:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  804881:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  804882:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  804889:	00 
+  80488a:	0f 84 d3 00 00 00    	je     804963 <spawn+0x611>
+  804890:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804896:	ba 00 00 00 00       	mov    $0x0,%edx
+  80489b:	eb 46                	jmp    8048e3 <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  80489d:	4d 89 c7             	mov    %r8,%r15
+  8048a0:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8048a7:	00 00 01 00 
+  8048ab:	eb 8d                	jmp    80483a <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  8048ad:	48 85 c0             	test   %rax,%rax
+  8048b0:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  8048b7:	48 0f 49 c2          	cmovns %rdx,%rax
+  8048bb:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  8048be:	85 c0                	test   %eax,%eax
+  8048c0:	0f 89 c0 00 00 00    	jns    804986 <spawn+0x634>
+  8048c6:	e9 15 01 00 00       	jmp    8049e0 <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  8048cb:	49 83 c5 01          	add    $0x1,%r13
+  8048cf:	48 83 c3 38          	add    $0x38,%rbx
+  8048d3:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  8048da:	49 39 c5             	cmp    %rax,%r13
+  8048dd:	0f 83 80 00 00 00    	jae    804963 <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  8048e3:	83 3b 01             	cmpl   $0x1,(%rbx)
+  8048e6:	75 e3                	jne    8048cb <spawn+0x579>
+  8048e8:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  8048ed:	74 dc                	je     8048cb <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  8048ef:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8048f3:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8048fa:	48 c1 e2 05          	shl    $0x5,%rdx
+  8048fe:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  804902:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804907:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  80490e:	ff 
+  80490f:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  804916:	8b 73 08             	mov    0x8(%rbx),%esi
+  804919:	44 89 f7             	mov    %r14d,%edi
+  80491c:	48 ba 59 38 80 00 00 	movabs $0x803859,%rdx
+  804923:	00 00 00 
+  804926:	ff d2                	call   *%rdx
+  804928:	41 89 c4             	mov    %eax,%r12d
+  80492b:	85 c0                	test   %eax,%eax
+  80492d:	0f 88 ad 00 00 00    	js     8049e0 <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  804933:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  804937:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  80493e:	44 89 f7             	mov    %r14d,%edi
+  804941:	48 b8 2f 37 80 00 00 	movabs $0x80372f,%rax
+  804948:	00 00 00 
+  80494b:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  80494d:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  804951:	0f 85 56 ff ff ff    	jne    8048ad <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804957:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  80495e:	e9 68 ff ff ff       	jmp    8048cb <spawn+0x579>
+    img->entry = elf->e_entry;
+  804963:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  80496a:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  804971:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804978:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  80497f:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  804986:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80498d:	48 b8 61 2e 80 00 00 	movabs $0x802e61,%rax
+  804994:	00 00 00 
+  804997:	ff d0                	call   *%rax
+  804999:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  80499c:	45 85 e4             	test   %r12d,%r12d
+  80499f:	78 3f                	js     8049e0 <spawn+0x68e>
+    close(fd);
+  8049a1:	44 89 f7             	mov    %r14d,%edi
+  8049a4:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  8049ab:	00 00 00 
+  8049ae:	ff d0                	call   *%rax
+    return res;
+  8049b0:	45 89 e6             	mov    %r12d,%r14d
+  8049b3:	eb 5f                	jmp    804a14 <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  8049b5:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8049bc:	00 00 01 00 
+  8049c0:	eb da                	jmp    80499c <spawn+0x64a>
+  8049c2:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8049c9:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8049cd:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  8049d3:	eb 0b                	jmp    8049e0 <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  8049d5:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8049dc:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  8049e0:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  8049e7:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  8049ee:	00 00 00 
+  8049f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049f6:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  8049fd:	00 00 00 
+  804a00:	ff d0                	call   *%rax
+    close(fd);
+  804a02:	44 89 f7             	mov    %r14d,%edi
+  804a05:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  804a0c:	00 00 00 
+  804a0f:	ff d0                	call   *%rax
+    return res;
+  804a11:	45 89 e6             	mov    %r12d,%r14d
+}
+  804a14:	44 89 f0             	mov    %r14d,%eax
+  804a17:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  804a1e:	5b                   	pop    %rbx
+  804a1f:	41 5c                	pop    %r12
+  804a21:	41 5d                	pop    %r13
+  804a23:	41 5e                	pop    %r14
+  804a25:	41 5f                	pop    %r15
+  804a27:	5d                   	pop    %rbp
+  804a28:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804a29:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  804a2f:	e9 26 fd ff ff       	jmp    80475a <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  804a34:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804a3b:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804a3f:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804a45:	eb 99                	jmp    8049e0 <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804a47:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804a4e:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804a52:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804a58:	eb 86                	jmp    8049e0 <spawn+0x68e>
+
+0000000000804a5a <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804a5a:	55                   	push   %rbp
+  804a5b:	48 89 e5             	mov    %rsp,%rbp
+  804a5e:	48 83 ec 50          	sub    $0x50,%rsp
+  804a62:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804a66:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804a6a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804a6e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804a72:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804a79:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a81:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804a85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804a89:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804a8e:	eb 15                	jmp    804aa5 <spawnl+0x4b>
+  804a90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804a98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a9c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804aa0:	74 1c                	je     804abe <spawnl+0x64>
+  804aa2:	83 c1 01             	add    $0x1,%ecx
+  804aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  804aab:	77 e3                	ja     804a90 <spawnl+0x36>
+  804aad:	89 c2                	mov    %eax,%edx
+  804aaf:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804ab3:	4c 01 d2             	add    %r10,%rdx
+  804ab6:	83 c0 08             	add    $0x8,%eax
+  804ab9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804abc:	eb de                	jmp    804a9c <spawnl+0x42>
+    const char *argv[argc + 2];
+  804abe:	8d 41 02             	lea    0x2(%rcx),%eax
+  804ac1:	48 98                	cltq
+  804ac3:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804aca:	00 
+  804acb:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804acf:	48 29 c4             	sub    %rax,%rsp
+  804ad2:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804ad7:	4c 89 c0             	mov    %r8,%rax
+  804ada:	48 c1 e8 03          	shr    $0x3,%rax
+  804ade:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804ae2:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804ae9:	00 
+    argv[argc + 1] = NULL;
+  804aea:	8d 41 01             	lea    0x1(%rcx),%eax
+  804aed:	48 98                	cltq
+  804aef:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804af6:	00 
+    va_start(vl, arg0);
+  804af7:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804afe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b06:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804b0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804b0e:	85 c9                	test   %ecx,%ecx
+  804b10:	74 41                	je     804b53 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804b12:	49 89 c1             	mov    %rax,%r9
+  804b15:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804b19:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804b1c:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804b21:	eb 1b                	jmp    804b3e <spawnl+0xe4>
+  804b23:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804b27:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804b2b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804b2f:	48 8b 11             	mov    (%rcx),%rdx
+  804b32:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804b35:	48 83 c0 08          	add    $0x8,%rax
+  804b39:	48 39 f0             	cmp    %rsi,%rax
+  804b3c:	74 15                	je     804b53 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804b3e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804b41:	83 fa 2f             	cmp    $0x2f,%edx
+  804b44:	77 dd                	ja     804b23 <spawnl+0xc9>
+  804b46:	89 d1                	mov    %edx,%ecx
+  804b48:	4c 01 c9             	add    %r9,%rcx
+  804b4b:	83 c2 08             	add    $0x8,%edx
+  804b4e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804b51:	eb dc                	jmp    804b2f <spawnl+0xd5>
+    return spawn(prog, argv);
+  804b53:	4c 89 c6             	mov    %r8,%rsi
+  804b56:	48 b8 52 43 80 00 00 	movabs $0x804352,%rax
+  804b5d:	00 00 00 
+  804b60:	ff d0                	call   *%rax
+}
+  804b62:	c9                   	leave
+  804b63:	c3                   	ret
+
+0000000000804b64 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804b64:	55                   	push   %rbp
+  804b65:	48 89 e5             	mov    %rsp,%rbp
+  804b68:	41 54                	push   %r12
+  804b6a:	53                   	push   %rbx
+  804b6b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b6e:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804b75:	00 00 00 
+  804b78:	ff d0                	call   *%rax
+  804b7a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804b7d:	48 be cf 72 80 00 00 	movabs $0x8072cf,%rsi
+  804b84:	00 00 00 
+  804b87:	48 89 df             	mov    %rbx,%rdi
+  804b8a:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  804b91:	00 00 00 
+  804b94:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804b96:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804b9b:	41 2b 04 24          	sub    (%r12),%eax
+  804b9f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804ba5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804bac:	00 00 00 
+    stat->st_dev = &devpipe;
+  804baf:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  804bb6:	00 00 00 
+  804bb9:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bc5:	5b                   	pop    %rbx
+  804bc6:	41 5c                	pop    %r12
+  804bc8:	5d                   	pop    %rbp
+  804bc9:	c3                   	ret
+
+0000000000804bca <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804bca:	55                   	push   %rbp
+  804bcb:	48 89 e5             	mov    %rsp,%rbp
+  804bce:	41 54                	push   %r12
+  804bd0:	53                   	push   %rbx
+  804bd1:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804bd4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804bd9:	48 89 fe             	mov    %rdi,%rsi
+  804bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804be1:	49 bc c8 2b 80 00 00 	movabs $0x802bc8,%r12
+  804be8:	00 00 00 
+  804beb:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804bee:	48 89 df             	mov    %rbx,%rdi
+  804bf1:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804bf8:	00 00 00 
+  804bfb:	ff d0                	call   *%rax
+  804bfd:	48 89 c6             	mov    %rax,%rsi
+  804c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c05:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c0a:	41 ff d4             	call   *%r12
+}
+  804c0d:	5b                   	pop    %rbx
+  804c0e:	41 5c                	pop    %r12
+  804c10:	5d                   	pop    %rbp
+  804c11:	c3                   	ret
+
+0000000000804c12 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804c12:	55                   	push   %rbp
+  804c13:	48 89 e5             	mov    %rsp,%rbp
+  804c16:	41 57                	push   %r15
+  804c18:	41 56                	push   %r14
+  804c1a:	41 55                	push   %r13
+  804c1c:	41 54                	push   %r12
+  804c1e:	53                   	push   %rbx
+  804c1f:	48 83 ec 18          	sub    $0x18,%rsp
+  804c23:	49 89 fc             	mov    %rdi,%r12
+  804c26:	49 89 f5             	mov    %rsi,%r13
+  804c29:	49 89 d7             	mov    %rdx,%r15
+  804c2c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c30:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804c37:	00 00 00 
+  804c3a:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804c3c:	4d 85 ff             	test   %r15,%r15
+  804c3f:	0f 84 af 00 00 00    	je     804cf4 <devpipe_write+0xe2>
+  804c45:	48 89 c3             	mov    %rax,%rbx
+  804c48:	4c 89 f8             	mov    %r15,%rax
+  804c4b:	4d 89 ef             	mov    %r13,%r15
+  804c4e:	4c 01 e8             	add    %r13,%rax
+  804c51:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c55:	49 bd be 2a 80 00 00 	movabs $0x802abe,%r13
+  804c5c:	00 00 00 
+            sys_yield();
+  804c5f:	49 be 4f 2a 80 00 00 	movabs $0x802a4f,%r14
+  804c66:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804c69:	8b 73 04             	mov    0x4(%rbx),%esi
+  804c6c:	48 63 ce             	movslq %esi,%rcx
+  804c6f:	48 63 03             	movslq (%rbx),%rax
+  804c72:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804c78:	48 39 c1             	cmp    %rax,%rcx
+  804c7b:	72 2e                	jb     804cab <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c7d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804c82:	48 89 da             	mov    %rbx,%rdx
+  804c85:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c8a:	4c 89 e7             	mov    %r12,%rdi
+  804c8d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804c90:	85 c0                	test   %eax,%eax
+  804c92:	74 66                	je     804cfa <devpipe_write+0xe8>
+            sys_yield();
+  804c94:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804c97:	8b 73 04             	mov    0x4(%rbx),%esi
+  804c9a:	48 63 ce             	movslq %esi,%rcx
+  804c9d:	48 63 03             	movslq (%rbx),%rax
+  804ca0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804ca6:	48 39 c1             	cmp    %rax,%rcx
+  804ca9:	73 d2                	jae    804c7d <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804cab:	41 0f b6 3f          	movzbl (%r15),%edi
+  804caf:	48 89 ca             	mov    %rcx,%rdx
+  804cb2:	48 c1 ea 03          	shr    $0x3,%rdx
+  804cb6:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804cbd:	08 10 20 
+  804cc0:	48 f7 e2             	mul    %rdx
+  804cc3:	48 c1 ea 06          	shr    $0x6,%rdx
+  804cc7:	48 89 d0             	mov    %rdx,%rax
+  804cca:	48 c1 e0 09          	shl    $0x9,%rax
+  804cce:	48 29 d0             	sub    %rdx,%rax
+  804cd1:	48 c1 e0 03          	shl    $0x3,%rax
+  804cd5:	48 29 c1             	sub    %rax,%rcx
+  804cd8:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804cdd:	83 c6 01             	add    $0x1,%esi
+  804ce0:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804ce3:	49 83 c7 01          	add    $0x1,%r15
+  804ce7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ceb:	49 39 c7             	cmp    %rax,%r15
+  804cee:	0f 85 75 ff ff ff    	jne    804c69 <devpipe_write+0x57>
+    return n;
+  804cf4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cf8:	eb 05                	jmp    804cff <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cff:	48 83 c4 18          	add    $0x18,%rsp
+  804d03:	5b                   	pop    %rbx
+  804d04:	41 5c                	pop    %r12
+  804d06:	41 5d                	pop    %r13
+  804d08:	41 5e                	pop    %r14
+  804d0a:	41 5f                	pop    %r15
+  804d0c:	5d                   	pop    %rbp
+  804d0d:	c3                   	ret
+
+0000000000804d0e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d0e:	55                   	push   %rbp
+  804d0f:	48 89 e5             	mov    %rsp,%rbp
+  804d12:	41 57                	push   %r15
+  804d14:	41 56                	push   %r14
+  804d16:	41 55                	push   %r13
+  804d18:	41 54                	push   %r12
+  804d1a:	53                   	push   %rbx
+  804d1b:	48 83 ec 18          	sub    $0x18,%rsp
+  804d1f:	49 89 fc             	mov    %rdi,%r12
+  804d22:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804d26:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804d2a:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804d31:	00 00 00 
+  804d34:	ff d0                	call   *%rax
+  804d36:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804d39:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d3f:	49 bd be 2a 80 00 00 	movabs $0x802abe,%r13
+  804d46:	00 00 00 
+            sys_yield();
+  804d49:	49 be 4f 2a 80 00 00 	movabs $0x802a4f,%r14
+  804d50:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804d53:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804d58:	74 7d                	je     804dd7 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d5a:	8b 03                	mov    (%rbx),%eax
+  804d5c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d5f:	75 26                	jne    804d87 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804d61:	4d 85 ff             	test   %r15,%r15
+  804d64:	75 77                	jne    804ddd <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804d66:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804d6b:	48 89 da             	mov    %rbx,%rdx
+  804d6e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804d73:	4c 89 e7             	mov    %r12,%rdi
+  804d76:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804d79:	85 c0                	test   %eax,%eax
+  804d7b:	74 72                	je     804def <devpipe_read+0xe1>
+            sys_yield();
+  804d7d:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804d80:	8b 03                	mov    (%rbx),%eax
+  804d82:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804d85:	74 df                	je     804d66 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804d87:	48 63 c8             	movslq %eax,%rcx
+  804d8a:	48 89 ca             	mov    %rcx,%rdx
+  804d8d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804d91:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804d98:	08 10 20 
+  804d9b:	48 89 d0             	mov    %rdx,%rax
+  804d9e:	48 f7 e6             	mul    %rsi
+  804da1:	48 c1 ea 06          	shr    $0x6,%rdx
+  804da5:	48 89 d0             	mov    %rdx,%rax
+  804da8:	48 c1 e0 09          	shl    $0x9,%rax
+  804dac:	48 29 d0             	sub    %rdx,%rax
+  804daf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804db6:	00 
+  804db7:	48 89 c8             	mov    %rcx,%rax
+  804dba:	48 29 d0             	sub    %rdx,%rax
+  804dbd:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804dc2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804dc6:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804dca:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804dcd:	49 83 c7 01          	add    $0x1,%r15
+  804dd1:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804dd5:	75 83                	jne    804d5a <devpipe_read+0x4c>
+    return n;
+  804dd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ddb:	eb 03                	jmp    804de0 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804ddd:	4c 89 f8             	mov    %r15,%rax
+}
+  804de0:	48 83 c4 18          	add    $0x18,%rsp
+  804de4:	5b                   	pop    %rbx
+  804de5:	41 5c                	pop    %r12
+  804de7:	41 5d                	pop    %r13
+  804de9:	41 5e                	pop    %r14
+  804deb:	41 5f                	pop    %r15
+  804ded:	5d                   	pop    %rbp
+  804dee:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804def:	b8 00 00 00 00       	mov    $0x0,%eax
+  804df4:	eb ea                	jmp    804de0 <devpipe_read+0xd2>
+
+0000000000804df6 <pipe>:
+pipe(int pfd[2]) {
+  804df6:	55                   	push   %rbp
+  804df7:	48 89 e5             	mov    %rsp,%rbp
+  804dfa:	41 55                	push   %r13
+  804dfc:	41 54                	push   %r12
+  804dfe:	53                   	push   %rbx
+  804dff:	48 83 ec 18          	sub    $0x18,%rsp
+  804e03:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804e06:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804e0a:	48 b8 2e 33 80 00 00 	movabs $0x80332e,%rax
+  804e11:	00 00 00 
+  804e14:	ff d0                	call   *%rax
+  804e16:	89 c3                	mov    %eax,%ebx
+  804e18:	85 c0                	test   %eax,%eax
+  804e1a:	0f 88 a0 01 00 00    	js     804fc0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804e20:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804e25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e2a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e33:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  804e3a:	00 00 00 
+  804e3d:	ff d0                	call   *%rax
+  804e3f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804e41:	85 c0                	test   %eax,%eax
+  804e43:	0f 88 77 01 00 00    	js     804fc0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804e49:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804e4d:	48 b8 2e 33 80 00 00 	movabs $0x80332e,%rax
+  804e54:	00 00 00 
+  804e57:	ff d0                	call   *%rax
+  804e59:	89 c3                	mov    %eax,%ebx
+  804e5b:	85 c0                	test   %eax,%eax
+  804e5d:	0f 88 43 01 00 00    	js     804fa6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804e63:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804e68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e6d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804e71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e76:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  804e7d:	00 00 00 
+  804e80:	ff d0                	call   *%rax
+  804e82:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804e84:	85 c0                	test   %eax,%eax
+  804e86:	0f 88 1a 01 00 00    	js     804fa6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804e8c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804e90:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804e97:	00 00 00 
+  804e9a:	ff d0                	call   *%rax
+  804e9c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804e9f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804ea4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ea9:	48 89 c6             	mov    %rax,%rsi
+  804eac:	bf 00 00 00 00       	mov    $0x0,%edi
+  804eb1:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  804eb8:	00 00 00 
+  804ebb:	ff d0                	call   *%rax
+  804ebd:	89 c3                	mov    %eax,%ebx
+  804ebf:	85 c0                	test   %eax,%eax
+  804ec1:	0f 88 c5 00 00 00    	js     804f8c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804ec7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804ecb:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  804ed2:	00 00 00 
+  804ed5:	ff d0                	call   *%rax
+  804ed7:	48 89 c1             	mov    %rax,%rcx
+  804eda:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804ee0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eeb:	4c 89 ee             	mov    %r13,%rsi
+  804eee:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ef3:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  804efa:	00 00 00 
+  804efd:	ff d0                	call   *%rax
+  804eff:	89 c3                	mov    %eax,%ebx
+  804f01:	85 c0                	test   %eax,%eax
+  804f03:	78 6e                	js     804f73 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804f05:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f0a:	4c 89 ef             	mov    %r13,%rdi
+  804f0d:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  804f14:	00 00 00 
+  804f17:	ff d0                	call   *%rax
+  804f19:	83 f8 02             	cmp    $0x2,%eax
+  804f1c:	0f 85 ab 00 00 00    	jne    804fcd <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804f22:	a1 80 80 80 00 00 00 	movabs 0x808080,%eax
+  804f29:	00 00 
+  804f2b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f2f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804f31:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804f35:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804f3c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f40:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804f42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f46:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804f4d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804f51:	48 bb 00 33 80 00 00 	movabs $0x803300,%rbx
+  804f58:	00 00 00 
+  804f5b:	ff d3                	call   *%rbx
+  804f5d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804f61:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804f65:	ff d3                	call   *%rbx
+  804f67:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804f71:	eb 4d                	jmp    804fc0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804f73:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f78:	4c 89 ee             	mov    %r13,%rsi
+  804f7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f80:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  804f87:	00 00 00 
+  804f8a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804f8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f91:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804f95:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f9a:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  804fa1:	00 00 00 
+  804fa4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804fa6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804fab:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804faf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fb4:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  804fbb:	00 00 00 
+  804fbe:	ff d0                	call   *%rax
+}
+  804fc0:	89 d8                	mov    %ebx,%eax
+  804fc2:	48 83 c4 18          	add    $0x18,%rsp
+  804fc6:	5b                   	pop    %rbx
+  804fc7:	41 5c                	pop    %r12
+  804fc9:	41 5d                	pop    %r13
+  804fcb:	5d                   	pop    %rbp
+  804fcc:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804fcd:	48 b9 e8 72 80 00 00 	movabs $0x8072e8,%rcx
+  804fd4:	00 00 00 
+  804fd7:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  804fde:	00 00 00 
+  804fe1:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804fe6:	48 bf d6 72 80 00 00 	movabs $0x8072d6,%rdi
+  804fed:	00 00 00 
+  804ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff5:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  804ffc:	00 00 00 
+  804fff:	41 ff d0             	call   *%r8
+
+0000000000805002 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805002:	55                   	push   %rbp
+  805003:	48 89 e5             	mov    %rsp,%rbp
+  805006:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80500a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80500e:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  805015:	00 00 00 
+  805018:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80501a:	85 c0                	test   %eax,%eax
+  80501c:	78 35                	js     805053 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80501e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805022:	48 b8 12 33 80 00 00 	movabs $0x803312,%rax
+  805029:	00 00 00 
+  80502c:	ff d0                	call   *%rax
+  80502e:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805031:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805036:	be 00 10 00 00       	mov    $0x1000,%esi
+  80503b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80503f:	48 b8 be 2a 80 00 00 	movabs $0x802abe,%rax
+  805046:	00 00 00 
+  805049:	ff d0                	call   *%rax
+  80504b:	85 c0                	test   %eax,%eax
+  80504d:	0f 94 c0             	sete   %al
+  805050:	0f b6 c0             	movzbl %al,%eax
+}
+  805053:	c9                   	leave
+  805054:	c3                   	ret
+
+0000000000805055 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 55                	push   %r13
+  80505b:	41 54                	push   %r12
+  80505d:	53                   	push   %rbx
+  80505e:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  805062:	85 ff                	test   %edi,%edi
+  805064:	74 73                	je     8050d9 <wait+0x84>
+  805066:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  805069:	89 f8                	mov    %edi,%eax
+  80506b:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  805070:	89 f9                	mov    %edi,%ecx
+  805072:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  805078:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  80507f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805086:	00 00 00 
+  805089:	48 01 ca             	add    %rcx,%rdx
+  80508c:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  805092:	39 d7                	cmp    %edx,%edi
+  805094:	75 38                	jne    8050ce <wait+0x79>
+           env->env_status != ENV_FREE) {
+  805096:	48 98                	cltq
+  805098:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80509f:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8050a6:	00 00 00 
+  8050a9:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8050ac:	49 bd 4f 2a 80 00 00 	movabs $0x802a4f,%r13
+  8050b3:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8050b6:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  8050bc:	85 c0                	test   %eax,%eax
+  8050be:	74 0e                	je     8050ce <wait+0x79>
+        sys_yield();
+  8050c0:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  8050c3:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8050c9:	44 39 e0             	cmp    %r12d,%eax
+  8050cc:	74 e8                	je     8050b6 <wait+0x61>
+    }
+}
+  8050ce:	48 83 c4 08          	add    $0x8,%rsp
+  8050d2:	5b                   	pop    %rbx
+  8050d3:	41 5c                	pop    %r12
+  8050d5:	41 5d                	pop    %r13
+  8050d7:	5d                   	pop    %rbp
+  8050d8:	c3                   	ret
+    assert(envid != 0);
+  8050d9:	48 b9 0c 73 80 00 00 	movabs $0x80730c,%rcx
+  8050e0:	00 00 00 
+  8050e3:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  8050ea:	00 00 00 
+  8050ed:	be 06 00 00 00       	mov    $0x6,%esi
+  8050f2:	48 bf 17 73 80 00 00 	movabs $0x807317,%rdi
+  8050f9:	00 00 00 
+  8050fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805101:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  805108:	00 00 00 
+  80510b:	41 ff d0             	call   *%r8
+
+000000000080510e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80510e:	48 89 f8             	mov    %rdi,%rax
+  805111:	48 c1 e8 27          	shr    $0x27,%rax
+  805115:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80511c:	01 00 00 
+  80511f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805123:	f6 c2 01             	test   $0x1,%dl
+  805126:	74 6d                	je     805195 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805128:	48 89 f8             	mov    %rdi,%rax
+  80512b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80512f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805136:	01 00 00 
+  805139:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80513d:	f6 c2 01             	test   $0x1,%dl
+  805140:	74 62                	je     8051a4 <get_uvpt_entry+0x96>
+  805142:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805149:	01 00 00 
+  80514c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805150:	f6 c2 80             	test   $0x80,%dl
+  805153:	75 4f                	jne    8051a4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805155:	48 89 f8             	mov    %rdi,%rax
+  805158:	48 c1 e8 15          	shr    $0x15,%rax
+  80515c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805163:	01 00 00 
+  805166:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80516a:	f6 c2 01             	test   $0x1,%dl
+  80516d:	74 44                	je     8051b3 <get_uvpt_entry+0xa5>
+  80516f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805176:	01 00 00 
+  805179:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80517d:	f6 c2 80             	test   $0x80,%dl
+  805180:	75 31                	jne    8051b3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  805182:	48 c1 ef 0c          	shr    $0xc,%rdi
+  805186:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80518d:	01 00 00 
+  805190:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  805194:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805195:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80519c:	01 00 00 
+  80519f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8051a3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8051a4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8051ab:	01 00 00 
+  8051ae:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8051b2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8051b3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8051ba:	01 00 00 
+  8051bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8051c1:	c3                   	ret
+
+00000000008051c2 <get_prot>:
+
+int
+get_prot(void *va) {
+  8051c2:	55                   	push   %rbp
+  8051c3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8051c6:	48 b8 0e 51 80 00 00 	movabs $0x80510e,%rax
+  8051cd:	00 00 00 
+  8051d0:	ff d0                	call   *%rax
+  8051d2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8051d5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8051da:	89 c1                	mov    %eax,%ecx
+  8051dc:	83 c9 04             	or     $0x4,%ecx
+  8051df:	f6 c2 01             	test   $0x1,%dl
+  8051e2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8051e5:	89 c1                	mov    %eax,%ecx
+  8051e7:	83 c9 02             	or     $0x2,%ecx
+  8051ea:	f6 c2 02             	test   $0x2,%dl
+  8051ed:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8051f0:	89 c1                	mov    %eax,%ecx
+  8051f2:	83 c9 01             	or     $0x1,%ecx
+  8051f5:	48 85 d2             	test   %rdx,%rdx
+  8051f8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8051fb:	89 c1                	mov    %eax,%ecx
+  8051fd:	83 c9 40             	or     $0x40,%ecx
+  805200:	f6 c6 04             	test   $0x4,%dh
+  805203:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805206:	5d                   	pop    %rbp
+  805207:	c3                   	ret
+
+0000000000805208 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805208:	55                   	push   %rbp
+  805209:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80520c:	48 b8 0e 51 80 00 00 	movabs $0x80510e,%rax
+  805213:	00 00 00 
+  805216:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805218:	48 c1 e8 06          	shr    $0x6,%rax
+  80521c:	83 e0 01             	and    $0x1,%eax
+}
+  80521f:	5d                   	pop    %rbp
+  805220:	c3                   	ret
+
+0000000000805221 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  805221:	55                   	push   %rbp
+  805222:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805225:	48 b8 0e 51 80 00 00 	movabs $0x80510e,%rax
+  80522c:	00 00 00 
+  80522f:	ff d0                	call   *%rax
+  805231:	83 e0 01             	and    $0x1,%eax
+}
+  805234:	5d                   	pop    %rbp
+  805235:	c3                   	ret
+
+0000000000805236 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805236:	55                   	push   %rbp
+  805237:	48 89 e5             	mov    %rsp,%rbp
+  80523a:	41 57                	push   %r15
+  80523c:	41 56                	push   %r14
+  80523e:	41 55                	push   %r13
+  805240:	41 54                	push   %r12
+  805242:	53                   	push   %rbx
+  805243:	48 83 ec 28          	sub    $0x28,%rsp
+  805247:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80524b:	48 85 ff             	test   %rdi,%rdi
+  80524e:	74 1e                	je     80526e <foreach_shared_region+0x38>
+  805250:	49 89 ff             	mov    %rdi,%r15
+  805253:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  805259:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80525f:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  805266:	01 00 00 
+  805269:	e9 72 02 00 00       	jmp    8054e0 <foreach_shared_region+0x2aa>
+    assert(fun);
+  80526e:	48 b9 22 73 80 00 00 	movabs $0x807322,%rcx
+  805275:	00 00 00 
+  805278:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  80527f:	00 00 00 
+  805282:	be 2d 00 00 00       	mov    $0x2d,%esi
+  805287:	48 bf 26 73 80 00 00 	movabs $0x807326,%rdi
+  80528e:	00 00 00 
+  805291:	b8 00 00 00 00       	mov    $0x0,%eax
+  805296:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  80529d:	00 00 00 
+  8052a0:	41 ff d0             	call   *%r8
+  8052a3:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8052aa:	eb 6c                	jmp    805318 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8052ac:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8052b3:	ff ff ff 
+  8052b6:	4c 21 e2             	and    %r12,%rdx
+  8052b9:	48 89 d8             	mov    %rbx,%rax
+  8052bc:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8052c1:	48 83 c0 01          	add    $0x1,%rax
+  8052c5:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8052c9:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8052d0:	00 00 00 
+  8052d3:	48 21 c8             	and    %rcx,%rax
+  8052d6:	48 09 d0             	or     %rdx,%rax
+  8052d9:	49 89 c4             	mov    %rax,%r12
+  8052dc:	eb 30                	jmp    80530e <foreach_shared_region+0xd8>
+  8052de:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8052e5:	ff ff ff 
+  8052e8:	4c 21 e2             	and    %r12,%rdx
+  8052eb:	48 89 d8             	mov    %rbx,%rax
+  8052ee:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8052f3:	48 83 c0 01          	add    $0x1,%rax
+  8052f7:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8052fb:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  805302:	00 00 00 
+  805305:	48 21 c8             	and    %rcx,%rax
+  805308:	48 09 d0             	or     %rdx,%rax
+  80530b:	49 89 c4             	mov    %rax,%r12
+  80530e:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  805312:	0f 84 99 01 00 00    	je     8054b1 <foreach_shared_region+0x27b>
+  805318:	4c 89 e3             	mov    %r12,%rbx
+  80531b:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80531f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805326:	01 00 00 
+  805329:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80532d:	a8 01                	test   $0x1,%al
+  80532f:	0f 84 77 ff ff ff    	je     8052ac <foreach_shared_region+0x76>
+  805335:	a8 80                	test   $0x80,%al
+  805337:	74 19                	je     805352 <foreach_shared_region+0x11c>
+  805339:	f6 c4 04             	test   $0x4,%ah
+  80533c:	74 a0                	je     8052de <foreach_shared_region+0xa8>
+  80533e:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  805345:	40 
+  805346:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80534a:	4c 89 e7             	mov    %r12,%rdi
+  80534d:	41 ff d7             	call   *%r15
+  805350:	eb 8c                	jmp    8052de <foreach_shared_region+0xa8>
+  805352:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  805359:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80535d:	eb 46                	jmp    8053a5 <foreach_shared_region+0x16f>
+  80535f:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805366:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80536c:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  805370:	48 c1 e0 15          	shl    $0x15,%rax
+  805374:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805379:	49 09 c4             	or     %rax,%r12
+  80537c:	eb 1d                	jmp    80539b <foreach_shared_region+0x165>
+  80537e:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805385:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80538b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80538f:	48 c1 e0 15          	shl    $0x15,%rax
+  805393:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805398:	49 09 c4             	or     %rax,%r12
+  80539b:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80539f:	0f 84 d3 00 00 00    	je     805478 <foreach_shared_region+0x242>
+  8053a5:	4c 89 e3             	mov    %r12,%rbx
+  8053a8:	48 c1 eb 15          	shr    $0x15,%rbx
+  8053ac:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8053b3:	01 00 00 
+  8053b6:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8053ba:	a8 01                	test   $0x1,%al
+  8053bc:	74 a1                	je     80535f <foreach_shared_region+0x129>
+  8053be:	a8 80                	test   $0x80,%al
+  8053c0:	74 19                	je     8053db <foreach_shared_region+0x1a5>
+  8053c2:	f6 c4 04             	test   $0x4,%ah
+  8053c5:	74 b7                	je     80537e <foreach_shared_region+0x148>
+  8053c7:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8053ce:	00 
+  8053cf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053d3:	4c 89 e7             	mov    %r12,%rdi
+  8053d6:	41 ff d7             	call   *%r15
+  8053d9:	eb a3                	jmp    80537e <foreach_shared_region+0x148>
+  8053db:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8053e1:	eb 3b                	jmp    80541e <foreach_shared_region+0x1e8>
+  8053e3:	f6 c4 04             	test   $0x4,%ah
+  8053e6:	74 12                	je     8053fa <foreach_shared_region+0x1c4>
+  8053e8:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8053ef:	00 
+  8053f0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8053f4:	4c 89 e7             	mov    %r12,%rdi
+  8053f7:	41 ff d7             	call   *%r15
+  8053fa:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805401:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805407:	48 83 c3 01          	add    $0x1,%rbx
+  80540b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80540f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805415:	49 09 dc             	or     %rbx,%r12
+  805418:	41 83 ed 01          	sub    $0x1,%r13d
+  80541c:	74 2f                	je     80544d <foreach_shared_region+0x217>
+  80541e:	4c 89 e3             	mov    %r12,%rbx
+  805421:	48 c1 eb 0c          	shr    $0xc,%rbx
+  805425:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805429:	a8 01                	test   $0x1,%al
+  80542b:	75 b6                	jne    8053e3 <foreach_shared_region+0x1ad>
+  80542d:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805434:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80543a:	48 83 c3 01          	add    $0x1,%rbx
+  80543e:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805442:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805448:	49 09 dc             	or     %rbx,%r12
+  80544b:	eb cb                	jmp    805418 <foreach_shared_region+0x1e2>
+  80544d:	4c 89 e0             	mov    %r12,%rax
+  805450:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  805456:	49 c1 ec 15          	shr    $0x15,%r12
+  80545a:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805461:	49 83 c4 01          	add    $0x1,%r12
+  805465:	49 c1 e4 15          	shl    $0x15,%r12
+  805469:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  805470:	49 09 c4             	or     %rax,%r12
+  805473:	e9 23 ff ff ff       	jmp    80539b <foreach_shared_region+0x165>
+  805478:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80547c:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  805483:	ff ff ff 
+  805486:	4c 21 e0             	and    %r12,%rax
+  805489:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80548d:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805494:	49 83 c4 01          	add    $0x1,%r12
+  805498:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80549c:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8054a3:	00 00 00 
+  8054a6:	49 21 d4             	and    %rdx,%r12
+  8054a9:	49 09 c4             	or     %rax,%r12
+  8054ac:	e9 5d fe ff ff       	jmp    80530e <foreach_shared_region+0xd8>
+  8054b1:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8054b8:	00 ff ff 
+  8054bb:	4c 21 e0             	and    %r12,%rax
+  8054be:	49 c1 ec 27          	shr    $0x27,%r12
+  8054c2:	49 83 c4 01          	add    $0x1,%r12
+  8054c6:	49 c1 e4 27          	shl    $0x27,%r12
+  8054ca:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8054d1:	ff 00 00 
+  8054d4:	49 21 d4             	and    %rdx,%r12
+  8054d7:	49 09 c4             	or     %rax,%r12
+  8054da:	41 83 ed 01          	sub    $0x1,%r13d
+  8054de:	74 48                	je     805528 <foreach_shared_region+0x2f2>
+  8054e0:	4c 89 e0             	mov    %r12,%rax
+  8054e3:	48 c1 e8 27          	shr    $0x27,%rax
+  8054e7:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8054ee:	01 00 00 
+  8054f1:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8054f5:	f6 c2 01             	test   $0x1,%dl
+  8054f8:	0f 85 a5 fd ff ff    	jne    8052a3 <foreach_shared_region+0x6d>
+  8054fe:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805505:	00 ff ff 
+  805508:	4c 21 e2             	and    %r12,%rdx
+  80550b:	48 83 c0 01          	add    $0x1,%rax
+  80550f:	48 c1 e0 27          	shl    $0x27,%rax
+  805513:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80551a:	ff 00 00 
+  80551d:	48 21 c8             	and    %rcx,%rax
+  805520:	48 09 d0             	or     %rdx,%rax
+  805523:	49 89 c4             	mov    %rax,%r12
+  805526:	eb b2                	jmp    8054da <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805528:	4d 85 e4             	test   %r12,%r12
+  80552b:	75 14                	jne    805541 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80552d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805532:	48 83 c4 28          	add    $0x28,%rsp
+  805536:	5b                   	pop    %rbx
+  805537:	41 5c                	pop    %r12
+  805539:	41 5d                	pop    %r13
+  80553b:	41 5e                	pop    %r14
+  80553d:	41 5f                	pop    %r15
+  80553f:	5d                   	pop    %rbp
+  805540:	c3                   	ret
+    assert(addr == 0);
+  805541:	48 b9 31 73 80 00 00 	movabs $0x807331,%rcx
+  805548:	00 00 00 
+  80554b:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  805552:	00 00 00 
+  805555:	be 67 00 00 00       	mov    $0x67,%esi
+  80555a:	48 bf 26 73 80 00 00 	movabs $0x807326,%rdi
+  805561:	00 00 00 
+  805564:	b8 00 00 00 00       	mov    $0x0,%eax
+  805569:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  805570:	00 00 00 
+  805573:	41 ff d0             	call   *%r8
+
+0000000000805576 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  805576:	49 b8 40 cc 80 01 00 	movabs $0x180cc40,%r8
+  80557d:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  805580:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  805586:	eb 33                	jmp    8055bb <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805588:	48 83 c0 20          	add    $0x20,%rax
+  80558c:	4c 39 c0             	cmp    %r8,%rax
+  80558f:	74 25                	je     8055b6 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  805591:	48 8b 10             	mov    (%rax),%rdx
+  805594:	48 85 d2             	test   %rdx,%rdx
+  805597:	74 ef                	je     805588 <mmap_place+0x12>
+  805599:	48 89 d1             	mov    %rdx,%rcx
+  80559c:	48 03 48 08          	add    0x8(%rax),%rcx
+  8055a0:	48 39 cf             	cmp    %rcx,%rdi
+  8055a3:	73 e3                	jae    805588 <mmap_place+0x12>
+  8055a5:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8055a9:	4c 39 ca             	cmp    %r9,%rdx
+  8055ac:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8055b0:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8055b4:	eb d2                	jmp    805588 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8055b6:	45 84 d2             	test   %r10b,%r10b
+  8055b9:	74 12                	je     8055cd <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8055bb:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  8055c2:	00 00 00 
+        moved = 0;
+  8055c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8055cb:	eb c4                	jmp    805591 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8055cd:	48 01 fe             	add    %rdi,%rsi
+  8055d0:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8055d7:	00 00 00 
+  8055da:	48 39 f0             	cmp    %rsi,%rax
+  8055dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055e2:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8055e6:	c3                   	ret
+
+00000000008055e7 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8055e7:	55                   	push   %rbp
+  8055e8:	48 89 e5             	mov    %rsp,%rbp
+  8055eb:	41 57                	push   %r15
+  8055ed:	41 56                	push   %r14
+  8055ef:	41 55                	push   %r13
+  8055f1:	41 54                	push   %r12
+  8055f3:	53                   	push   %rbx
+  8055f4:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8055f8:	48 8b 1f             	mov    (%rdi),%rbx
+  8055fb:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805602:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805609:	00 00 00 
+  80560c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805611:	eb 12                	jmp    805625 <mmap_pgfault+0x3e>
+  805613:	48 83 c2 01          	add    $0x1,%rdx
+  805617:	48 83 c0 20          	add    $0x20,%rax
+  80561b:	48 83 fa 20          	cmp    $0x20,%rdx
+  80561f:	0f 84 04 01 00 00    	je     805729 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805625:	48 8b 08             	mov    (%rax),%rcx
+  805628:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80562c:	48 39 de             	cmp    %rbx,%rsi
+  80562f:	73 e2                	jae    805613 <mmap_pgfault+0x2c>
+  805631:	48 03 48 08          	add    0x8(%rax),%rcx
+  805635:	48 39 cb             	cmp    %rcx,%rbx
+  805638:	73 d9                	jae    805613 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80563a:	48 c1 e2 05          	shl    $0x5,%rdx
+  80563e:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805645:	00 00 00 
+  805648:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80564c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805650:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805654:	f6 c2 01             	test   $0x1,%dl
+  805657:	0f 84 e0 00 00 00    	je     80573d <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  80565d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805662:	f6 c2 02             	test   $0x2,%dl
+  805665:	0f 84 c3 00 00 00    	je     80572e <mmap_pgfault+0x147>
+  80566b:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805672:	ff ff ff 
+  805675:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805679:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  805680:	00 00 00 
+  805683:	48 39 ca             	cmp    %rcx,%rdx
+  805686:	0f 85 a2 00 00 00    	jne    80572e <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80568c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805691:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805696:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80569d:	00 00 00 
+  8056a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056a5:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  8056ac:	00 00 00 
+  8056af:	ff d0                	call   *%rax
+  8056b1:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8056b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056b8:	85 d2                	test   %edx,%edx
+  8056ba:	78 72                	js     80572e <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8056bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8056c1:	48 89 de             	mov    %rbx,%rsi
+  8056c4:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8056cb:	00 00 00 
+  8056ce:	4c 89 e7             	mov    %r12,%rdi
+  8056d1:	48 b8 42 27 80 00 00 	movabs $0x802742,%rax
+  8056d8:	00 00 00 
+  8056db:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8056dd:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8056e3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8056e9:	48 89 d9             	mov    %rbx,%rcx
+  8056ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056f1:	4c 89 e6             	mov    %r12,%rsi
+  8056f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056f9:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  805700:	00 00 00 
+  805703:	ff d0                	call   *%rax
+  805705:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805707:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80570c:	4c 89 e6             	mov    %r12,%rsi
+  80570f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805714:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  80571b:	00 00 00 
+  80571e:	ff d0                	call   *%rax
+    return res >= 0;
+  805720:	89 d8                	mov    %ebx,%eax
+  805722:	f7 d0                	not    %eax
+  805724:	c1 e8 1f             	shr    $0x1f,%eax
+  805727:	eb 05                	jmp    80572e <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805729:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80572e:	48 83 c4 18          	add    $0x18,%rsp
+  805732:	5b                   	pop    %rbx
+  805733:	41 5c                	pop    %r12
+  805735:	41 5d                	pop    %r13
+  805737:	41 5e                	pop    %r14
+  805739:	41 5f                	pop    %r15
+  80573b:	5d                   	pop    %rbp
+  80573c:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80573d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805741:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805745:	4c 03 30             	add    (%rax),%r14
+  805748:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80574f:	49 39 c6             	cmp    %rax,%r14
+  805752:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805756:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80575d:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805763:	49 bf 21 52 80 00 00 	movabs $0x805221,%r15
+  80576a:	00 00 00 
+  80576d:	4d 39 f4             	cmp    %r14,%r12
+  805770:	73 1d                	jae    80578f <mmap_pgfault+0x1a8>
+  805772:	4c 89 e7             	mov    %r12,%rdi
+  805775:	41 ff d7             	call   *%r15
+  805778:	84 c0                	test   %al,%al
+  80577a:	75 13                	jne    80578f <mmap_pgfault+0x1a8>
+  80577c:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805783:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80578a:	4d 39 f4             	cmp    %r14,%r12
+  80578d:	72 e3                	jb     805772 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80578f:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805795:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805799:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80579d:	74 2a                	je     8057c9 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80579f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8057a3:	89 de                	mov    %ebx,%esi
+  8057a5:	2b 30                	sub    (%rax),%esi
+  8057a7:	03 70 1c             	add    0x1c(%rax),%esi
+  8057aa:	8b 78 18             	mov    0x18(%rax),%edi
+  8057ad:	4c 89 e9             	mov    %r13,%rcx
+  8057b0:	48 89 da             	mov    %rbx,%rdx
+  8057b3:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  8057ba:	00 00 00 
+  8057bd:	ff d0                	call   *%rax
+    return res > 0;
+  8057bf:	85 c0                	test   %eax,%eax
+  8057c1:	0f 9f c0             	setg   %al
+  8057c4:	e9 65 ff ff ff       	jmp    80572e <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8057c9:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8057cd:	eb d0                	jmp    80579f <mmap_pgfault+0x1b8>
+
+00000000008057cf <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8057cf:	55                   	push   %rbp
+  8057d0:	48 89 e5             	mov    %rsp,%rbp
+  8057d3:	41 57                	push   %r15
+  8057d5:	41 56                	push   %r14
+  8057d7:	41 55                	push   %r13
+  8057d9:	41 54                	push   %r12
+  8057db:	53                   	push   %rbx
+  8057dc:	48 83 ec 28          	sub    $0x28,%rsp
+  8057e0:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8057e4:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8057e7:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8057ee:	ff ff ff 
+  8057f1:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8057f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057fa:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805801:	00 00 00 
+  805804:	48 39 ca             	cmp    %rcx,%rdx
+  805807:	0f 85 e5 00 00 00    	jne    8058f2 <mmap_writeback+0x123>
+  80580d:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  805810:	4c 39 ee             	cmp    %r13,%rsi
+  805813:	0f 83 e8 00 00 00    	jae    805901 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805819:	49 be 21 52 80 00 00 	movabs $0x805221,%r14
+  805820:	00 00 00 
+  805823:	49 bf 08 52 80 00 00 	movabs $0x805208,%r15
+  80582a:	00 00 00 
+  80582d:	eb 10                	jmp    80583f <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80582f:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805836:	4d 39 ec             	cmp    %r13,%r12
+  805839:	0f 83 ae 00 00 00    	jae    8058ed <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80583f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805843:	4c 89 e7             	mov    %r12,%rdi
+  805846:	41 ff d6             	call   *%r14
+  805849:	84 c0                	test   %al,%al
+  80584b:	74 e2                	je     80582f <mmap_writeback+0x60>
+  80584d:	4c 89 e7             	mov    %r12,%rdi
+  805850:	41 ff d7             	call   *%r15
+  805853:	84 c0                	test   %al,%al
+  805855:	74 d8                	je     80582f <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805857:	4c 89 e3             	mov    %r12,%rbx
+  80585a:	4d 39 ec             	cmp    %r13,%r12
+  80585d:	73 20                	jae    80587f <mmap_writeback+0xb0>
+  80585f:	48 89 df             	mov    %rbx,%rdi
+  805862:	41 ff d6             	call   *%r14
+  805865:	84 c0                	test   %al,%al
+  805867:	74 16                	je     80587f <mmap_writeback+0xb0>
+  805869:	48 89 df             	mov    %rbx,%rdi
+  80586c:	41 ff d7             	call   *%r15
+  80586f:	84 c0                	test   %al,%al
+  805871:	74 0c                	je     80587f <mmap_writeback+0xb0>
+  805873:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80587a:	4c 39 eb             	cmp    %r13,%rbx
+  80587d:	72 e0                	jb     80585f <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80587f:	48 89 d9             	mov    %rbx,%rcx
+  805882:	4c 29 e1             	sub    %r12,%rcx
+  805885:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805889:	44 89 e6             	mov    %r12d,%esi
+  80588c:	2b 30                	sub    (%rax),%esi
+  80588e:	49 89 c4             	mov    %rax,%r12
+  805891:	03 70 1c             	add    0x1c(%rax),%esi
+  805894:	8b 78 18             	mov    0x18(%rax),%edi
+  805897:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80589b:	48 89 ca             	mov    %rcx,%rdx
+  80589e:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  8058a5:	00 00 00 
+  8058a8:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8058aa:	85 c0                	test   %eax,%eax
+  8058ac:	78 44                	js     8058f2 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8058ae:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8058b3:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8058b6:	41 89 c1             	mov    %eax,%r9d
+  8058b9:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8058c0:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8058c4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8058c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058cd:	48 89 ce             	mov    %rcx,%rsi
+  8058d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058d5:	48 b8 5d 2b 80 00 00 	movabs $0x802b5d,%rax
+  8058dc:	00 00 00 
+  8058df:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8058e1:	85 c0                	test   %eax,%eax
+  8058e3:	78 0d                	js     8058f2 <mmap_writeback+0x123>
+  8058e5:	49 89 dc             	mov    %rbx,%r12
+  8058e8:	e9 49 ff ff ff       	jmp    805836 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8058ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058f2:	48 83 c4 28          	add    $0x28,%rsp
+  8058f6:	5b                   	pop    %rbx
+  8058f7:	41 5c                	pop    %r12
+  8058f9:	41 5d                	pop    %r13
+  8058fb:	41 5e                	pop    %r14
+  8058fd:	41 5f                	pop    %r15
+  8058ff:	5d                   	pop    %rbp
+  805900:	c3                   	ret
+    return 0;
+  805901:	b8 00 00 00 00       	mov    $0x0,%eax
+  805906:	eb ea                	jmp    8058f2 <mmap_writeback+0x123>
+
+0000000000805908 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805908:	55                   	push   %rbp
+  805909:	48 89 e5             	mov    %rsp,%rbp
+  80590c:	41 57                	push   %r15
+  80590e:	41 56                	push   %r14
+  805910:	41 55                	push   %r13
+  805912:	41 54                	push   %r12
+  805914:	53                   	push   %rbx
+  805915:	48 83 ec 38          	sub    $0x38,%rsp
+  805919:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80591d:	48 85 f6             	test   %rsi,%rsi
+  805920:	0f 84 0c 02 00 00    	je     805b32 <mmap+0x22a>
+  805926:	49 89 ff             	mov    %rdi,%r15
+  805929:	49 89 f4             	mov    %rsi,%r12
+  80592c:	41 89 d5             	mov    %edx,%r13d
+  80592f:	41 89 ce             	mov    %ecx,%r14d
+  805932:	44 89 cb             	mov    %r9d,%ebx
+  805935:	45 85 c9             	test   %r9d,%r9d
+  805938:	0f 88 f4 01 00 00    	js     805b32 <mmap+0x22a>
+  80593e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805945:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80594c:	0f 85 e7 01 00 00    	jne    805b39 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805952:	83 e2 fd             	and    $0xfffffffd,%edx
+  805955:	83 fa 04             	cmp    $0x4,%edx
+  805958:	0f 85 db 01 00 00    	jne    805b39 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80595e:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805961:	83 fa 01             	cmp    $0x1,%edx
+  805964:	0f 87 cf 01 00 00    	ja     805b39 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  80596a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80596e:	44 89 c7             	mov    %r8d,%edi
+  805971:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  805978:	00 00 00 
+  80597b:	ff d0                	call   *%rax
+  80597d:	89 c2                	mov    %eax,%edx
+  80597f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805986:	85 d2                	test   %edx,%edx
+  805988:	0f 88 ab 01 00 00    	js     805b39 <mmap+0x231>
+  80598e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805992:	48 b9 40 80 80 00 00 	movabs $0x808040,%rcx
+  805999:	00 00 00 
+  80599c:	8b 09                	mov    (%rcx),%ecx
+  80599e:	39 0a                	cmp    %ecx,(%rdx)
+  8059a0:	0f 85 93 01 00 00    	jne    805b39 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8059a6:	8b 52 08             	mov    0x8(%rdx),%edx
+  8059a9:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8059ac:	83 fa 01             	cmp    $0x1,%edx
+  8059af:	0f 84 84 01 00 00    	je     805b39 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8059b5:	41 83 fe 01          	cmp    $0x1,%r14d
+  8059b9:	74 42                	je     8059fd <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8059bb:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8059c2:	4c 89 e6             	mov    %r12,%rsi
+  8059c5:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8059cc:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8059d0:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8059d4:	4d 85 ff             	test   %r15,%r15
+  8059d7:	74 67                	je     805a40 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8059d9:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8059e0:	75 0f                	jne    8059f1 <mmap+0xe9>
+  8059e2:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8059e9:	00 00 00 
+  8059ec:	49 39 c7             	cmp    %rax,%r15
+  8059ef:	77 1b                	ja     805a0c <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8059f1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8059f8:	e9 3c 01 00 00       	jmp    805b39 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8059fd:	41 f6 c5 02          	test   $0x2,%r13b
+  805a01:	74 b8                	je     8059bb <mmap+0xb3>
+  805a03:	85 d2                	test   %edx,%edx
+  805a05:	75 b4                	jne    8059bb <mmap+0xb3>
+  805a07:	e9 2d 01 00 00       	jmp    805b39 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805a0c:	4c 89 ff             	mov    %r15,%rdi
+  805a0f:	48 b8 76 55 80 00 00 	movabs $0x805576,%rax
+  805a16:	00 00 00 
+  805a19:	ff d0                	call   *%rax
+  805a1b:	48 89 c2             	mov    %rax,%rdx
+  805a1e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805a25:	49 39 d7             	cmp    %rdx,%r15
+  805a28:	0f 85 0b 01 00 00    	jne    805b39 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805a2e:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805a35:	00 00 00 
+  805a38:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805a3e:	eb 44                	jmp    805a84 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805a40:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805a44:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805a4b:	00 00 00 
+  805a4e:	48 b8 76 55 80 00 00 	movabs $0x805576,%rax
+  805a55:	00 00 00 
+  805a58:	ff d0                	call   *%rax
+  805a5a:	48 89 c7             	mov    %rax,%rdi
+  805a5d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805a61:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805a68:	48 85 ff             	test   %rdi,%rdi
+  805a6b:	75 c1                	jne    805a2e <mmap+0x126>
+  805a6d:	e9 c7 00 00 00       	jmp    805b39 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805a72:	49 83 c4 01          	add    $0x1,%r12
+  805a76:	48 83 c0 20          	add    $0x20,%rax
+  805a7a:	49 83 fc 20          	cmp    $0x20,%r12
+  805a7e:	0f 84 a5 00 00 00    	je     805b29 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805a84:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805a88:	75 e8                	jne    805a72 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805a8a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805a8e:	48 b8 2e 33 80 00 00 	movabs $0x80332e,%rax
+  805a95:	00 00 00 
+  805a98:	ff d0                	call   *%rax
+  805a9a:	89 c2                	mov    %eax,%edx
+  805a9c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805aa3:	85 d2                	test   %edx,%edx
+  805aa5:	0f 88 8e 00 00 00    	js     805b39 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805aab:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805aaf:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  805ab6:	00 00 00 
+  805ab9:	ff d0                	call   *%rax
+  805abb:	89 c6                	mov    %eax,%esi
+  805abd:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805ac0:	48 b8 4e 35 80 00 00 	movabs $0x80354e,%rax
+  805ac7:	00 00 00 
+  805aca:	ff d0                	call   *%rax
+  805acc:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805acf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805ad6:	45 85 ff             	test   %r15d,%r15d
+  805ad9:	78 5e                	js     805b39 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805adb:	49 c1 e4 05          	shl    $0x5,%r12
+  805adf:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805ae6:	00 00 00 
+  805ae9:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805aec:	48 bf e7 55 80 00 00 	movabs $0x8055e7,%rdi
+  805af3:	00 00 00 
+  805af6:	48 b8 12 60 80 00 00 	movabs $0x806012,%rax
+  805afd:	00 00 00 
+  805b00:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805b02:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805b06:	49 89 04 24          	mov    %rax,(%r12)
+  805b0a:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805b0e:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805b13:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805b18:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805b1d:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805b22:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805b27:	eb 10                	jmp    805b39 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805b29:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805b30:	eb 07                	jmp    805b39 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805b32:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805b39:	48 83 c4 38          	add    $0x38,%rsp
+  805b3d:	5b                   	pop    %rbx
+  805b3e:	41 5c                	pop    %r12
+  805b40:	41 5d                	pop    %r13
+  805b42:	41 5e                	pop    %r14
+  805b44:	41 5f                	pop    %r15
+  805b46:	5d                   	pop    %rbp
+  805b47:	c3                   	ret
+
+0000000000805b48 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805b48:	55                   	push   %rbp
+  805b49:	48 89 e5             	mov    %rsp,%rbp
+  805b4c:	41 57                	push   %r15
+  805b4e:	41 56                	push   %r14
+  805b50:	41 55                	push   %r13
+  805b52:	41 54                	push   %r12
+  805b54:	53                   	push   %rbx
+  805b55:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805b59:	49 89 fe             	mov    %rdi,%r14
+  805b5c:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805b63:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805b6a:	00 
+  805b6b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805b72:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  805b79:	00 00 00 
+  805b7c:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805b83:	49 bf cf 57 80 00 00 	movabs $0x8057cf,%r15
+  805b8a:	00 00 00 
+  805b8d:	eb 09                	jmp    805b98 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805b8f:	48 83 c3 20          	add    $0x20,%rbx
+  805b93:	4c 39 eb             	cmp    %r13,%rbx
+  805b96:	74 33                	je     805bcb <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805b98:	48 89 df             	mov    %rbx,%rdi
+  805b9b:	48 8b 33             	mov    (%rbx),%rsi
+  805b9e:	4c 39 e6             	cmp    %r12,%rsi
+  805ba1:	73 ec                	jae    805b8f <msync+0x47>
+  805ba3:	48 85 f6             	test   %rsi,%rsi
+  805ba6:	74 e7                	je     805b8f <msync+0x47>
+  805ba8:	48 89 f2             	mov    %rsi,%rdx
+  805bab:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805baf:	49 39 d6             	cmp    %rdx,%r14
+  805bb2:	73 db                	jae    805b8f <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805bb4:	4c 39 e2             	cmp    %r12,%rdx
+  805bb7:	49 0f 47 d4          	cmova  %r12,%rdx
+  805bbb:	4c 39 f6             	cmp    %r14,%rsi
+  805bbe:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805bc2:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805bc5:	85 c0                	test   %eax,%eax
+  805bc7:	79 c6                	jns    805b8f <msync+0x47>
+  805bc9:	eb 05                	jmp    805bd0 <msync+0x88>
+    }
+
+    return 0;
+  805bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805bd0:	48 83 c4 08          	add    $0x8,%rsp
+  805bd4:	5b                   	pop    %rbx
+  805bd5:	41 5c                	pop    %r12
+  805bd7:	41 5d                	pop    %r13
+  805bd9:	41 5e                	pop    %r14
+  805bdb:	41 5f                	pop    %r15
+  805bdd:	5d                   	pop    %rbp
+  805bde:	c3                   	ret
+
+0000000000805bdf <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805bdf:	55                   	push   %rbp
+  805be0:	48 89 e5             	mov    %rsp,%rbp
+  805be3:	41 57                	push   %r15
+  805be5:	41 56                	push   %r14
+  805be7:	41 55                	push   %r13
+  805be9:	41 54                	push   %r12
+  805beb:	53                   	push   %rbx
+  805bec:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805bf0:	49 89 ff             	mov    %rdi,%r15
+  805bf3:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805bfa:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805c01:	00 
+  805c02:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805c09:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  805c10:	00 00 00 
+  805c13:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805c1a:	48 89 d8             	mov    %rbx,%rax
+  805c1d:	eb 09                	jmp    805c28 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805c1f:	48 83 c0 20          	add    $0x20,%rax
+  805c23:	4c 39 f0             	cmp    %r14,%rax
+  805c26:	74 40                	je     805c68 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805c28:	48 8b 10             	mov    (%rax),%rdx
+  805c2b:	4c 39 e2             	cmp    %r12,%rdx
+  805c2e:	73 ef                	jae    805c1f <munmap+0x40>
+  805c30:	48 85 d2             	test   %rdx,%rdx
+  805c33:	74 ea                	je     805c1f <munmap+0x40>
+  805c35:	48 89 d7             	mov    %rdx,%rdi
+  805c38:	48 03 78 08          	add    0x8(%rax),%rdi
+  805c3c:	49 39 ff             	cmp    %rdi,%r15
+  805c3f:	73 de                	jae    805c1f <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805c41:	49 39 fc             	cmp    %rdi,%r12
+  805c44:	72 05                	jb     805c4b <munmap+0x6c>
+  805c46:	4c 39 fa             	cmp    %r15,%rdx
+  805c49:	73 d4                	jae    805c1f <munmap+0x40>
+  805c4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805c50:	48 83 c4 08          	add    $0x8,%rsp
+  805c54:	5b                   	pop    %rbx
+  805c55:	41 5c                	pop    %r12
+  805c57:	41 5d                	pop    %r13
+  805c59:	41 5e                	pop    %r14
+  805c5b:	41 5f                	pop    %r15
+  805c5d:	5d                   	pop    %rbp
+  805c5e:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805c5f:	48 83 c3 20          	add    $0x20,%rbx
+  805c63:	4c 39 f3             	cmp    %r14,%rbx
+  805c66:	74 5c                	je     805cc4 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805c68:	48 8b 33             	mov    (%rbx),%rsi
+  805c6b:	4c 39 e6             	cmp    %r12,%rsi
+  805c6e:	73 ef                	jae    805c5f <munmap+0x80>
+  805c70:	48 85 f6             	test   %rsi,%rsi
+  805c73:	74 ea                	je     805c5f <munmap+0x80>
+  805c75:	48 89 f2             	mov    %rsi,%rdx
+  805c78:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805c7c:	49 39 d7             	cmp    %rdx,%r15
+  805c7f:	73 de                	jae    805c5f <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805c81:	48 89 df             	mov    %rbx,%rdi
+  805c84:	48 b8 cf 57 80 00 00 	movabs $0x8057cf,%rax
+  805c8b:	00 00 00 
+  805c8e:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805c90:	85 c0                	test   %eax,%eax
+  805c92:	78 bc                	js     805c50 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805c94:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805c98:	48 8b 33             	mov    (%rbx),%rsi
+  805c9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ca0:	48 b8 c8 2b 80 00 00 	movabs $0x802bc8,%rax
+  805ca7:	00 00 00 
+  805caa:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805cac:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805caf:	48 b8 f3 34 80 00 00 	movabs $0x8034f3,%rax
+  805cb6:	00 00 00 
+  805cb9:	ff d0                	call   *%rax
+        reg->start = 0;
+  805cbb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805cc2:	eb 9b                	jmp    805c5f <munmap+0x80>
+    return 0;
+  805cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cc9:	eb 85                	jmp    805c50 <munmap+0x71>
+
+0000000000805ccb <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cd0:	c3                   	ret
+
+0000000000805cd1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805cd1:	55                   	push   %rbp
+  805cd2:	48 89 e5             	mov    %rsp,%rbp
+  805cd5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805cd8:	48 be 3b 73 80 00 00 	movabs $0x80733b,%rsi
+  805cdf:	00 00 00 
+  805ce2:	48 b8 8b 23 80 00 00 	movabs $0x80238b,%rax
+  805ce9:	00 00 00 
+  805cec:	ff d0                	call   *%rax
+    return 0;
+}
+  805cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cf3:	5d                   	pop    %rbp
+  805cf4:	c3                   	ret
+
+0000000000805cf5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805cf5:	55                   	push   %rbp
+  805cf6:	48 89 e5             	mov    %rsp,%rbp
+  805cf9:	41 57                	push   %r15
+  805cfb:	41 56                	push   %r14
+  805cfd:	41 55                	push   %r13
+  805cff:	41 54                	push   %r12
+  805d01:	53                   	push   %rbx
+  805d02:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805d09:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805d10:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805d17:	00 00 00 00 
+  805d1b:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805d22:	00 00 00 00 
+  805d26:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805d2d:	00 00 00 00 
+  805d31:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805d38:	00 00 00 00 
+  805d3c:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805d43:	00 00 00 00 
+  805d47:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805d4e:	00 00 00 00 
+  805d52:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805d59:	00 
+  805d5a:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805d61:	00 
+  805d62:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805d69:	00 
+  805d6a:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805d71:	00 
+  805d72:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805d79:	00 
+  805d7a:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805d81:	00 
+  805d82:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805d89:	00 
+  805d8a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805d91:	00 
+  805d92:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805d99:	00 
+  805d9a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805da1:	00 
+    for (res = 0; res < n; res += inc) {
+  805da2:	48 85 d2             	test   %rdx,%rdx
+  805da5:	74 7a                	je     805e21 <devcons_write+0x12c>
+  805da7:	49 89 d6             	mov    %rdx,%r14
+  805daa:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805db0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805db5:	49 bf db 26 80 00 00 	movabs $0x8026db,%r15
+  805dbc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805dbf:	4c 89 f3             	mov    %r14,%rbx
+  805dc2:	48 29 f3             	sub    %rsi,%rbx
+  805dc5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805dca:	48 39 c3             	cmp    %rax,%rbx
+  805dcd:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805dd1:	4c 63 eb             	movslq %ebx,%r13
+  805dd4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805ddb:	48 01 c6             	add    %rax,%rsi
+  805dde:	4c 89 ea             	mov    %r13,%rdx
+  805de1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805de8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805deb:	4c 89 ee             	mov    %r13,%rsi
+  805dee:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805df5:	48 b8 08 29 80 00 00 	movabs $0x802908,%rax
+  805dfc:	00 00 00 
+  805dff:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805e01:	41 01 dc             	add    %ebx,%r12d
+  805e04:	49 63 f4             	movslq %r12d,%rsi
+  805e07:	4c 39 f6             	cmp    %r14,%rsi
+  805e0a:	72 b3                	jb     805dbf <devcons_write+0xca>
+    return res;
+  805e0c:	49 63 c4             	movslq %r12d,%rax
+}
+  805e0f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805e16:	5b                   	pop    %rbx
+  805e17:	41 5c                	pop    %r12
+  805e19:	41 5d                	pop    %r13
+  805e1b:	41 5e                	pop    %r14
+  805e1d:	41 5f                	pop    %r15
+  805e1f:	5d                   	pop    %rbp
+  805e20:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805e21:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805e27:	eb e3                	jmp    805e0c <devcons_write+0x117>
+
+0000000000805e29 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805e29:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805e2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e31:	48 85 c0             	test   %rax,%rax
+  805e34:	74 55                	je     805e8b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805e36:	55                   	push   %rbp
+  805e37:	48 89 e5             	mov    %rsp,%rbp
+  805e3a:	41 55                	push   %r13
+  805e3c:	41 54                	push   %r12
+  805e3e:	53                   	push   %rbx
+  805e3f:	48 83 ec 08          	sub    $0x8,%rsp
+  805e43:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805e46:	48 bb 3b 29 80 00 00 	movabs $0x80293b,%rbx
+  805e4d:	00 00 00 
+  805e50:	49 bc 4f 2a 80 00 00 	movabs $0x802a4f,%r12
+  805e57:	00 00 00 
+  805e5a:	eb 03                	jmp    805e5f <devcons_read+0x36>
+  805e5c:	41 ff d4             	call   *%r12
+  805e5f:	ff d3                	call   *%rbx
+  805e61:	85 c0                	test   %eax,%eax
+  805e63:	74 f7                	je     805e5c <devcons_read+0x33>
+    if (c < 0) return c;
+  805e65:	48 63 d0             	movslq %eax,%rdx
+  805e68:	78 13                	js     805e7d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e6f:	83 f8 04             	cmp    $0x4,%eax
+  805e72:	74 09                	je     805e7d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805e74:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805e78:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805e7d:	48 89 d0             	mov    %rdx,%rax
+  805e80:	48 83 c4 08          	add    $0x8,%rsp
+  805e84:	5b                   	pop    %rbx
+  805e85:	41 5c                	pop    %r12
+  805e87:	41 5d                	pop    %r13
+  805e89:	5d                   	pop    %rbp
+  805e8a:	c3                   	ret
+  805e8b:	48 89 d0             	mov    %rdx,%rax
+  805e8e:	c3                   	ret
+
+0000000000805e8f <cputchar>:
+cputchar(int ch) {
+  805e8f:	55                   	push   %rbp
+  805e90:	48 89 e5             	mov    %rsp,%rbp
+  805e93:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805e97:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805e9b:	be 01 00 00 00       	mov    $0x1,%esi
+  805ea0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805ea4:	48 b8 08 29 80 00 00 	movabs $0x802908,%rax
+  805eab:	00 00 00 
+  805eae:	ff d0                	call   *%rax
+}
+  805eb0:	c9                   	leave
+  805eb1:	c3                   	ret
+
+0000000000805eb2 <getchar>:
+getchar(void) {
+  805eb2:	55                   	push   %rbp
+  805eb3:	48 89 e5             	mov    %rsp,%rbp
+  805eb6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805eba:	ba 01 00 00 00       	mov    $0x1,%edx
+  805ebf:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ec8:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  805ecf:	00 00 00 
+  805ed2:	ff d0                	call   *%rax
+  805ed4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805ed6:	85 c0                	test   %eax,%eax
+  805ed8:	78 06                	js     805ee0 <getchar+0x2e>
+  805eda:	74 08                	je     805ee4 <getchar+0x32>
+  805edc:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805ee0:	89 d0                	mov    %edx,%eax
+  805ee2:	c9                   	leave
+  805ee3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805ee4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805ee9:	eb f5                	jmp    805ee0 <getchar+0x2e>
+
+0000000000805eeb <iscons>:
+iscons(int fdnum) {
+  805eeb:	55                   	push   %rbp
+  805eec:	48 89 e5             	mov    %rsp,%rbp
+  805eef:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805ef3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805ef7:	48 b8 8e 33 80 00 00 	movabs $0x80338e,%rax
+  805efe:	00 00 00 
+  805f01:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805f03:	85 c0                	test   %eax,%eax
+  805f05:	78 18                	js     805f1f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805f07:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f0b:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805f12:	00 00 00 
+  805f15:	8b 00                	mov    (%rax),%eax
+  805f17:	39 02                	cmp    %eax,(%rdx)
+  805f19:	0f 94 c0             	sete   %al
+  805f1c:	0f b6 c0             	movzbl %al,%eax
+}
+  805f1f:	c9                   	leave
+  805f20:	c3                   	ret
+
+0000000000805f21 <opencons>:
+opencons(void) {
+  805f21:	55                   	push   %rbp
+  805f22:	48 89 e5             	mov    %rsp,%rbp
+  805f25:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805f29:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805f2d:	48 b8 2e 33 80 00 00 	movabs $0x80332e,%rax
+  805f34:	00 00 00 
+  805f37:	ff d0                	call   *%rax
+  805f39:	85 c0                	test   %eax,%eax
+  805f3b:	78 49                	js     805f86 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805f3d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805f42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805f47:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805f4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f50:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  805f57:	00 00 00 
+  805f5a:	ff d0                	call   *%rax
+  805f5c:	85 c0                	test   %eax,%eax
+  805f5e:	78 26                	js     805f86 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805f60:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805f64:	a1 c0 80 80 00 00 00 	movabs 0x8080c0,%eax
+  805f6b:	00 00 
+  805f6d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805f6f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805f73:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805f7a:	48 b8 00 33 80 00 00 	movabs $0x803300,%rax
+  805f81:	00 00 00 
+  805f84:	ff d0                	call   *%rax
+}
+  805f86:	c9                   	leave
+  805f87:	c3                   	ret
+
+0000000000805f88 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805f88:	55                   	push   %rbp
+  805f89:	48 89 e5             	mov    %rsp,%rbp
+  805f8c:	41 56                	push   %r14
+  805f8e:	41 55                	push   %r13
+  805f90:	41 54                	push   %r12
+  805f92:	53                   	push   %rbx
+  805f93:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f96:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  805f9d:	00 00 00 
+  805fa0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805fa4:	74 27                	je     805fcd <_handle_vectored_pagefault+0x45>
+  805fa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805fab:	49 bd 40 cc 80 01 00 	movabs $0x180cc40,%r13
+  805fb2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805fb5:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805fb8:	4c 89 e7             	mov    %r12,%rdi
+  805fbb:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805fc0:	84 c0                	test   %al,%al
+  805fc2:	75 45                	jne    806009 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805fc4:	48 83 c3 01          	add    $0x1,%rbx
+  805fc8:	49 3b 1e             	cmp    (%r14),%rbx
+  805fcb:	72 eb                	jb     805fb8 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805fcd:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805fd4:	00 
+  805fd5:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805fda:	4d 8b 04 24          	mov    (%r12),%r8
+  805fde:	48 ba 48 73 80 00 00 	movabs $0x807348,%rdx
+  805fe5:	00 00 00 
+  805fe8:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805fed:	48 bf 78 73 80 00 00 	movabs $0x807378,%rdi
+  805ff4:	00 00 00 
+  805ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ffc:	49 ba 04 19 80 00 00 	movabs $0x801904,%r10
+  806003:	00 00 00 
+  806006:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  806009:	5b                   	pop    %rbx
+  80600a:	41 5c                	pop    %r12
+  80600c:	41 5d                	pop    %r13
+  80600e:	41 5e                	pop    %r14
+  806010:	5d                   	pop    %rbp
+  806011:	c3                   	ret
+
+0000000000806012 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  806012:	55                   	push   %rbp
+  806013:	48 89 e5             	mov    %rsp,%rbp
+  806016:	53                   	push   %rbx
+  806017:	48 83 ec 08          	sub    $0x8,%rsp
+  80601b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80601e:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  806023:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  80602a:	00 00 00 
+  80602d:	80 38 00             	cmpb   $0x0,(%rax)
+  806030:	74 68                	je     80609a <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806032:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  806039:	00 00 00 
+  80603c:	48 8b 08             	mov    (%rax),%rcx
+  80603f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  806044:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  80604b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80604e:	48 85 c9             	test   %rcx,%rcx
+  806051:	0f 84 e0 00 00 00    	je     806137 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  806057:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80605b:	0f 84 c9 00 00 00    	je     80612a <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806061:	48 83 c2 01          	add    $0x1,%rdx
+  806065:	48 39 ca             	cmp    %rcx,%rdx
+  806068:	75 ed                	jne    806057 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80606a:	48 83 f9 08          	cmp    $0x8,%rcx
+  80606e:	0f 84 84 00 00 00    	je     8060f8 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  806074:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  806078:	48 a3 88 cc 80 01 00 	movabs %rax,0x180cc88
+  80607f:	00 00 00 
+  806082:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  806089:	00 00 00 
+  80608c:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806090:	85 f6                	test   %esi,%esi
+  806092:	0f 89 97 00 00 00    	jns    80612f <add_pgfault_handler+0x11d>
+  806098:	eb 63                	jmp    8060fd <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80609a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80609f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8060a4:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8060ab:	00 00 00 
+  8060ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060b3:	48 b8 f0 2a 80 00 00 	movabs $0x802af0,%rax
+  8060ba:	00 00 00 
+  8060bd:	ff d0                	call   *%rax
+  8060bf:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8060c1:	85 c0                	test   %eax,%eax
+  8060c3:	78 38                	js     8060fd <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8060c5:	48 be 13 62 80 00 00 	movabs $0x806213,%rsi
+  8060cc:	00 00 00 
+  8060cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060d4:	48 b8 13 2d 80 00 00 	movabs $0x802d13,%rax
+  8060db:	00 00 00 
+  8060de:	ff d0                	call   *%rax
+  8060e0:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8060e2:	85 c0                	test   %eax,%eax
+  8060e4:	78 17                	js     8060fd <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8060e6:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  8060ed:	00 00 00 
+  8060f0:	c6 00 01             	movb   $0x1,(%rax)
+  8060f3:	e9 3a ff ff ff       	jmp    806032 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8060f8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8060fd:	89 f1                	mov    %esi,%ecx
+  8060ff:	48 ba 86 73 80 00 00 	movabs $0x807386,%rdx
+  806106:	00 00 00 
+  806109:	be 42 00 00 00       	mov    $0x42,%esi
+  80610e:	48 bf 78 73 80 00 00 	movabs $0x807378,%rdi
+  806115:	00 00 00 
+  806118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80611d:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  806124:	00 00 00 
+  806127:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80612a:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80612f:	89 f0                	mov    %esi,%eax
+  806131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806135:	c9                   	leave
+  806136:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  806137:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80613e:	00 00 00 
+  806141:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  806148:	48 89 d8             	mov    %rbx,%rax
+  80614b:	48 a3 40 cc 80 01 00 	movabs %rax,0x180cc40
+  806152:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806155:	eb d8                	jmp    80612f <add_pgfault_handler+0x11d>
+
+0000000000806157 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  806157:	55                   	push   %rbp
+  806158:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80615b:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  806162:	00 00 00 
+  806165:	80 38 00             	cmpb   $0x0,(%rax)
+  806168:	74 33                	je     80619d <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80616a:	48 a1 88 cc 80 01 00 	movabs 0x180cc88,%rax
+  806171:	00 00 00 
+  806174:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  806179:	48 ba 40 cc 80 01 00 	movabs $0x180cc40,%rdx
+  806180:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806183:	48 85 c0             	test   %rax,%rax
+  806186:	0f 84 85 00 00 00    	je     806211 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80618c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  806190:	74 40                	je     8061d2 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806192:	48 83 c1 01          	add    $0x1,%rcx
+  806196:	48 39 c1             	cmp    %rax,%rcx
+  806199:	75 f1                	jne    80618c <remove_pgfault_handler+0x35>
+  80619b:	eb 74                	jmp    806211 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80619d:	48 b9 9e 73 80 00 00 	movabs $0x80739e,%rcx
+  8061a4:	00 00 00 
+  8061a7:	48 ba f6 71 80 00 00 	movabs $0x8071f6,%rdx
+  8061ae:	00 00 00 
+  8061b1:	be 48 00 00 00       	mov    $0x48,%esi
+  8061b6:	48 bf 78 73 80 00 00 	movabs $0x807378,%rdi
+  8061bd:	00 00 00 
+  8061c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061c5:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  8061cc:	00 00 00 
+  8061cf:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8061d2:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8061d9:	00 
+  8061da:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8061de:	48 29 ca             	sub    %rcx,%rdx
+  8061e1:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  8061e8:	00 00 00 
+  8061eb:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8061ef:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8061f4:	48 89 ce             	mov    %rcx,%rsi
+  8061f7:	48 b8 db 26 80 00 00 	movabs $0x8026db,%rax
+  8061fe:	00 00 00 
+  806201:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  806203:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80620a:	00 00 00 
+  80620d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  806211:	5d                   	pop    %rbp
+  806212:	c3                   	ret
+
+0000000000806213 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  806213:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  806216:	48 b8 88 5f 80 00 00 	movabs $0x805f88,%rax
+  80621d:	00 00 00 
+    call *%rax
+  806220:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  806222:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  806229:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80622a:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  806231:	00 
+    subq $8, %rcx
+  806232:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  806236:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  806239:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  806240:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  806241:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  806245:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806249:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80624e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  806253:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806258:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80625d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  806262:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806267:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80626c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  806271:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806276:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80627b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806280:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806285:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80628a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80628f:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  806293:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  806297:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  806298:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  806299:	c3                   	ret
+
+000000000080629a <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80629a:	85 ff                	test   %edi,%edi
+  80629c:	78 58                	js     8062f6 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80629e:	48 85 f6             	test   %rsi,%rsi
+  8062a1:	74 12                	je     8062b5 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8062a3:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8062aa:	00 00 00 
+  8062ad:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8062b3:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8062b5:	48 85 c9             	test   %rcx,%rcx
+  8062b8:	74 12                	je     8062cc <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8062ba:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8062c1:	00 00 00 
+  8062c4:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8062ca:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8062cc:	48 85 d2             	test   %rdx,%rdx
+  8062cf:	74 14                	je     8062e5 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8062d1:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8062d8:	00 00 00 
+  8062db:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8062e2:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8062e5:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8062ec:	00 00 00 
+  8062ef:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8062f5:	c3                   	ret
+        if (from_env_store) {
+  8062f6:	48 85 f6             	test   %rsi,%rsi
+  8062f9:	74 06                	je     806301 <ipc_result+0x67>
+            *from_env_store = 0;
+  8062fb:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  806301:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  806303:	48 85 c9             	test   %rcx,%rcx
+  806306:	74 ed                	je     8062f5 <ipc_result+0x5b>
+            *perm_store = 0;
+  806308:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80630e:	c3                   	ret
+
+000000000080630f <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80630f:	55                   	push   %rbp
+  806310:	48 89 e5             	mov    %rsp,%rbp
+  806313:	41 55                	push   %r13
+  806315:	41 54                	push   %r12
+  806317:	53                   	push   %rbx
+  806318:	48 83 ec 08          	sub    $0x8,%rsp
+  80631c:	49 89 fc             	mov    %rdi,%r12
+  80631f:	48 89 f7             	mov    %rsi,%rdi
+  806322:	48 89 d3             	mov    %rdx,%rbx
+  806325:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806328:	48 85 f6             	test   %rsi,%rsi
+  80632b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806332:	00 00 00 
+  806335:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  806339:	be 00 00 00 00       	mov    $0x0,%esi
+  80633e:	48 85 d2             	test   %rdx,%rdx
+  806341:	74 03                	je     806346 <ipc_recv+0x37>
+  806343:	48 8b 32             	mov    (%rdx),%rsi
+  806346:	48 b8 3c 30 80 00 00 	movabs $0x80303c,%rax
+  80634d:	00 00 00 
+  806350:	ff d0                	call   *%rax
+  806352:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  806354:	4c 89 e9             	mov    %r13,%rcx
+  806357:	48 89 da             	mov    %rbx,%rdx
+  80635a:	4c 89 e6             	mov    %r12,%rsi
+  80635d:	48 b8 9a 62 80 00 00 	movabs $0x80629a,%rax
+  806364:	00 00 00 
+  806367:	ff d0                	call   *%rax
+}
+  806369:	48 83 c4 08          	add    $0x8,%rsp
+  80636d:	5b                   	pop    %rbx
+  80636e:	41 5c                	pop    %r12
+  806370:	41 5d                	pop    %r13
+  806372:	5d                   	pop    %rbp
+  806373:	c3                   	ret
+
+0000000000806374 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  806374:	55                   	push   %rbp
+  806375:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806378:	48 85 d2             	test   %rdx,%rdx
+  80637b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806382:	00 00 00 
+  806385:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  806389:	89 f6                	mov    %esi,%esi
+  80638b:	48 b8 c8 2e 80 00 00 	movabs $0x802ec8,%rax
+  806392:	00 00 00 
+  806395:	ff d0                	call   *%rax
+    if (res < 0) {
+  806397:	85 c0                	test   %eax,%eax
+  806399:	78 02                	js     80639d <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80639b:	5d                   	pop    %rbp
+  80639c:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80639d:	89 c1                	mov    %eax,%ecx
+  80639f:	48 ba b8 73 80 00 00 	movabs $0x8073b8,%rdx
+  8063a6:	00 00 00 
+  8063a9:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8063ae:	48 bf c5 73 80 00 00 	movabs $0x8073c5,%rdi
+  8063b5:	00 00 00 
+  8063b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063bd:	49 b8 04 19 80 00 00 	movabs $0x801904,%r8
+  8063c4:	00 00 00 
+  8063c7:	41 ff d0             	call   *%r8
+
+00000000008063ca <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8063ca:	55                   	push   %rbp
+  8063cb:	48 89 e5             	mov    %rsp,%rbp
+  8063ce:	53                   	push   %rbx
+  8063cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8063d3:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8063d7:	48 85 d2             	test   %rdx,%rdx
+  8063da:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8063e1:	00 00 00 
+  8063e4:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8063e8:	4d 85 c9             	test   %r9,%r9
+  8063eb:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8063ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063f4:	48 85 db             	test   %rbx,%rbx
+  8063f7:	74 03                	je     8063fc <ipc_call+0x32>
+  8063f9:	48 8b 03             	mov    (%rbx),%rax
+  8063fc:	89 f6                	mov    %esi,%esi
+  8063fe:	48 83 ec 08          	sub    $0x8,%rsp
+  806402:	50                   	push   %rax
+  806403:	48 b8 fa 2e 80 00 00 	movabs $0x802efa,%rax
+  80640a:	00 00 00 
+  80640d:	ff d0                	call   *%rax
+  80640f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  806411:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806415:	48 89 da             	mov    %rbx,%rdx
+  806418:	be 00 00 00 00       	mov    $0x0,%esi
+  80641d:	48 b8 9a 62 80 00 00 	movabs $0x80629a,%rax
+  806424:	00 00 00 
+  806427:	ff d0                	call   *%rax
+}
+  806429:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80642d:	c9                   	leave
+  80642e:	c3                   	ret
+
+000000000080642f <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  80642f:	55                   	push   %rbp
+  806430:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  806433:	89 f6                	mov    %esi,%esi
+  806435:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  80643c:	00 00 00 
+  80643f:	ff d0                	call   *%rax
+  806441:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  806443:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806448:	ba 00 00 00 00       	mov    $0x0,%edx
+  80644d:	be 00 00 00 00       	mov    $0x0,%esi
+  806452:	48 b8 9a 62 80 00 00 	movabs $0x80629a,%rax
+  806459:	00 00 00 
+  80645c:	ff d0                	call   *%rax
+}
+  80645e:	5d                   	pop    %rbp
+  80645f:	c3                   	ret
+
+0000000000806460 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  806460:	55                   	push   %rbp
+  806461:	48 89 e5             	mov    %rsp,%rbp
+  806464:	41 54                	push   %r12
+  806466:	53                   	push   %rbx
+  806467:	4c 89 cb             	mov    %r9,%rbx
+  80646a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80646e:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806472:	48 85 d2             	test   %rdx,%rdx
+  806475:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80647c:	00 00 00 
+  80647f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806483:	4d 85 c9             	test   %r9,%r9
+  806486:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80648a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80648f:	4d 85 e4             	test   %r12,%r12
+  806492:	74 04                	je     806498 <ipc_reply_wait+0x38>
+  806494:	49 8b 04 24          	mov    (%r12),%rax
+  806498:	89 f6                	mov    %esi,%esi
+  80649a:	48 83 ec 08          	sub    $0x8,%rsp
+  80649e:	50                   	push   %rax
+  80649f:	48 b8 d0 2f 80 00 00 	movabs $0x802fd0,%rax
+  8064a6:	00 00 00 
+  8064a9:	ff d0                	call   *%rax
+  8064ab:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8064ad:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8064b1:	4c 89 e2             	mov    %r12,%rdx
+  8064b4:	48 89 de             	mov    %rbx,%rsi
+  8064b7:	48 b8 9a 62 80 00 00 	movabs $0x80629a,%rax
+  8064be:	00 00 00 
+  8064c1:	ff d0                	call   *%rax
+}
+  8064c3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8064c7:	5b                   	pop    %rbx
+  8064c8:	41 5c                	pop    %r12
+  8064ca:	5d                   	pop    %rbp
+  8064cb:	c3                   	ret
+
+00000000008064cc <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8064cc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8064d1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8064d8:	00 00 00 
+  8064db:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8064e2:	48 01 ca             	add    %rcx,%rdx
+  8064e5:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8064eb:	39 fa                	cmp    %edi,%edx
+  8064ed:	74 12                	je     806501 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8064ef:	48 83 c0 01          	add    $0x1,%rax
+  8064f3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8064f9:	75 e0                	jne    8064db <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8064fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806500:	c3                   	ret
+            return envs[i].env_id;
+  806501:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806508:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80650f:	00 00 00 
+  806512:	48 01 d0             	add    %rdx,%rax
+  806515:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80651b:	c3                   	ret
+  80651c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000806520 <__rodata_start>:
+  806520:	77 00                	ja     806522 <__rodata_start+0x2>
+  806522:	72 62                	jb     806586 <__rodata_start+0x66>
+  806524:	00 77 62             	add    %dh,0x62(%rdi)
+  806527:	00 66 2e             	add    %ah,0x2e(%rsi)
+  80652a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  806531:	00 
+  806532:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  806539:	00 00 00 
+  80653c:	0f 1f 40 00          	nopl   0x0(%rax)
+  806540:	b3 09                	mov    $0x9,%bl
+  806542:	80 00 00             	addb   $0x0,(%rax)
+  806545:	00 00                	add    %al,(%rax)
+  806547:	00 ed                	add    %ch,%ch
+  806549:	0d 80 00 00 00       	or     $0x80,%eax
+  80654e:	00 00                	add    %al,(%rax)
+  806550:	ed                   	in     (%dx),%eax
+  806551:	0d 80 00 00 00       	or     $0x80,%eax
+  806556:	00 00                	add    %al,(%rax)
+  806558:	ed                   	in     (%dx),%eax
+  806559:	0d 80 00 00 00       	or     $0x80,%eax
+  80655e:	00 00                	add    %al,(%rax)
+  806560:	ed                   	in     (%dx),%eax
+  806561:	0d 80 00 00 00       	or     $0x80,%eax
+  806566:	00 00                	add    %al,(%rax)
+  806568:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80656d:	00 00                	add    %al,(%rax)
+  80656f:	00 ed                	add    %ch,%ch
+  806571:	0d 80 00 00 00       	or     $0x80,%eax
+  806576:	00 00                	add    %al,(%rax)
+  806578:	ed                   	in     (%dx),%eax
+  806579:	0d 80 00 00 00       	or     $0x80,%eax
+  80657e:	00 00                	add    %al,(%rax)
+  806580:	ed                   	in     (%dx),%eax
+  806581:	0d 80 00 00 00       	or     $0x80,%eax
+  806586:	00 00                	add    %al,(%rax)
+  806588:	ed                   	in     (%dx),%eax
+  806589:	0d 80 00 00 00       	or     $0x80,%eax
+  80658e:	00 00                	add    %al,(%rax)
+  806590:	ed                   	in     (%dx),%eax
+  806591:	0d 80 00 00 00       	or     $0x80,%eax
+  806596:	00 00                	add    %al,(%rax)
+  806598:	8c 0a                	mov    %cs,(%rdx)
+  80659a:	80 00 00             	addb   $0x0,(%rax)
+  80659d:	00 00                	add    %al,(%rax)
+  80659f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8065a6:	00 00                	add    %al,(%rax)
+  8065a8:	8c 0a                	mov    %cs,(%rdx)
+  8065aa:	80 00 00             	addb   $0x0,(%rax)
+  8065ad:	00 00                	add    %al,(%rax)
+  8065af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8065b6:	00 00                	add    %al,(%rax)
+  8065b8:	8c 0a                	mov    %cs,(%rdx)
+  8065ba:	80 00 00             	addb   $0x0,(%rax)
+  8065bd:	00 00                	add    %al,(%rax)
+  8065bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8065c6:	00 00                	add    %al,(%rax)
+  8065c8:	8c 0a                	mov    %cs,(%rdx)
+  8065ca:	80 00 00             	addb   $0x0,(%rax)
+  8065cd:	00 00                	add    %al,(%rax)
+  8065cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8065d6:	00 00                	add    %al,(%rax)
+  8065d8:	8c 0a                	mov    %cs,(%rdx)
+  8065da:	80 00 00             	addb   $0x0,(%rax)
+  8065dd:	00 00                	add    %al,(%rax)
+  8065df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8065e6:	00 00                	add    %al,(%rax)
+  8065e8:	ed                   	in     (%dx),%eax
+  8065e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ee:	00 00                	add    %al,(%rax)
+  8065f0:	ed                   	in     (%dx),%eax
+  8065f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065f6:	00 00                	add    %al,(%rax)
+  8065f8:	ed                   	in     (%dx),%eax
+  8065f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065fe:	00 00                	add    %al,(%rax)
+  806600:	ed                   	in     (%dx),%eax
+  806601:	0d 80 00 00 00       	or     $0x80,%eax
+  806606:	00 00                	add    %al,(%rax)
+  806608:	ed                   	in     (%dx),%eax
+  806609:	0d 80 00 00 00       	or     $0x80,%eax
+  80660e:	00 00                	add    %al,(%rax)
+  806610:	ed                   	in     (%dx),%eax
+  806611:	0d 80 00 00 00       	or     $0x80,%eax
+  806616:	00 00                	add    %al,(%rax)
+  806618:	ed                   	in     (%dx),%eax
+  806619:	0d 80 00 00 00       	or     $0x80,%eax
+  80661e:	00 00                	add    %al,(%rax)
+  806620:	ed                   	in     (%dx),%eax
+  806621:	0d 80 00 00 00       	or     $0x80,%eax
+  806626:	00 00                	add    %al,(%rax)
+  806628:	ed                   	in     (%dx),%eax
+  806629:	0d 80 00 00 00       	or     $0x80,%eax
+  80662e:	00 00                	add    %al,(%rax)
+  806630:	ed                   	in     (%dx),%eax
+  806631:	0d 80 00 00 00       	or     $0x80,%eax
+  806636:	00 00                	add    %al,(%rax)
+  806638:	ed                   	in     (%dx),%eax
+  806639:	0d 80 00 00 00       	or     $0x80,%eax
+  80663e:	00 00                	add    %al,(%rax)
+  806640:	ed                   	in     (%dx),%eax
+  806641:	0d 80 00 00 00       	or     $0x80,%eax
+  806646:	00 00                	add    %al,(%rax)
+  806648:	ed                   	in     (%dx),%eax
+  806649:	0d 80 00 00 00       	or     $0x80,%eax
+  80664e:	00 00                	add    %al,(%rax)
+  806650:	ed                   	in     (%dx),%eax
+  806651:	0d 80 00 00 00       	or     $0x80,%eax
+  806656:	00 00                	add    %al,(%rax)
+  806658:	ed                   	in     (%dx),%eax
+  806659:	0d 80 00 00 00       	or     $0x80,%eax
+  80665e:	00 00                	add    %al,(%rax)
+  806660:	ed                   	in     (%dx),%eax
+  806661:	0d 80 00 00 00       	or     $0x80,%eax
+  806666:	00 00                	add    %al,(%rax)
+  806668:	ed                   	in     (%dx),%eax
+  806669:	0d 80 00 00 00       	or     $0x80,%eax
+  80666e:	00 00                	add    %al,(%rax)
+  806670:	ed                   	in     (%dx),%eax
+  806671:	0d 80 00 00 00       	or     $0x80,%eax
+  806676:	00 00                	add    %al,(%rax)
+  806678:	ed                   	in     (%dx),%eax
+  806679:	0d 80 00 00 00       	or     $0x80,%eax
+  80667e:	00 00                	add    %al,(%rax)
+  806680:	ed                   	in     (%dx),%eax
+  806681:	0d 80 00 00 00       	or     $0x80,%eax
+  806686:	00 00                	add    %al,(%rax)
+  806688:	ed                   	in     (%dx),%eax
+  806689:	0d 80 00 00 00       	or     $0x80,%eax
+  80668e:	00 00                	add    %al,(%rax)
+  806690:	ed                   	in     (%dx),%eax
+  806691:	0d 80 00 00 00       	or     $0x80,%eax
+  806696:	00 00                	add    %al,(%rax)
+  806698:	ed                   	in     (%dx),%eax
+  806699:	0d 80 00 00 00       	or     $0x80,%eax
+  80669e:	00 00                	add    %al,(%rax)
+  8066a0:	ed                   	in     (%dx),%eax
+  8066a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066a6:	00 00                	add    %al,(%rax)
+  8066a8:	ed                   	in     (%dx),%eax
+  8066a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ae:	00 00                	add    %al,(%rax)
+  8066b0:	ed                   	in     (%dx),%eax
+  8066b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066b6:	00 00                	add    %al,(%rax)
+  8066b8:	ed                   	in     (%dx),%eax
+  8066b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066be:	00 00                	add    %al,(%rax)
+  8066c0:	ed                   	in     (%dx),%eax
+  8066c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066c6:	00 00                	add    %al,(%rax)
+  8066c8:	ed                   	in     (%dx),%eax
+  8066c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ce:	00 00                	add    %al,(%rax)
+  8066d0:	ed                   	in     (%dx),%eax
+  8066d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066d6:	00 00                	add    %al,(%rax)
+  8066d8:	f4                   	hlt
+  8066d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8066df:	00 ed                	add    %ch,%ch
+  8066e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066e6:	00 00                	add    %al,(%rax)
+  8066e8:	ed                   	in     (%dx),%eax
+  8066e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ee:	00 00                	add    %al,(%rax)
+  8066f0:	2c 0b                	sub    $0xb,%al
+  8066f2:	80 00 00             	addb   $0x0,(%rax)
+  8066f5:	00 00                	add    %al,(%rax)
+  8066f7:	00 ed                	add    %ch,%ch
+  8066f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066fe:	00 00                	add    %al,(%rax)
+  806700:	ed                   	in     (%dx),%eax
+  806701:	0d 80 00 00 00       	or     $0x80,%eax
+  806706:	00 00                	add    %al,(%rax)
+  806708:	ed                   	in     (%dx),%eax
+  806709:	0d 80 00 00 00       	or     $0x80,%eax
+  80670e:	00 00                	add    %al,(%rax)
+  806710:	ed                   	in     (%dx),%eax
+  806711:	0d 80 00 00 00       	or     $0x80,%eax
+  806716:	00 00                	add    %al,(%rax)
+  806718:	ed                   	in     (%dx),%eax
+  806719:	0d 80 00 00 00       	or     $0x80,%eax
+  80671e:	00 00                	add    %al,(%rax)
+  806720:	ed                   	in     (%dx),%eax
+  806721:	0d 80 00 00 00       	or     $0x80,%eax
+  806726:	00 00                	add    %al,(%rax)
+  806728:	ed                   	in     (%dx),%eax
+  806729:	0d 80 00 00 00       	or     $0x80,%eax
+  80672e:	00 00                	add    %al,(%rax)
+  806730:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806733:	00 00                	add    %al,(%rax)
+  806735:	00 00                	add    %al,(%rax)
+  806737:	00 cb                	add    %cl,%bl
+  806739:	0d 80 00 00 00       	or     $0x80,%eax
+  80673e:	00 00                	add    %al,(%rax)
+  806740:	ed                   	in     (%dx),%eax
+  806741:	0d 80 00 00 00       	or     $0x80,%eax
+  806746:	00 00                	add    %al,(%rax)
+  806748:	ed                   	in     (%dx),%eax
+  806749:	0d 80 00 00 00       	or     $0x80,%eax
+  80674e:	00 00                	add    %al,(%rax)
+  806750:	ed                   	in     (%dx),%eax
+  806751:	0d 80 00 00 00       	or     $0x80,%eax
+  806756:	00 00                	add    %al,(%rax)
+  806758:	6a 0a                	push   $0xa
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806765:	00 00                	add    %al,(%rax)
+  806767:	00 ed                	add    %ch,%ch
+  806769:	0d 80 00 00 00       	or     $0x80,%eax
+  80676e:	00 00                	add    %al,(%rax)
+  806770:	ed                   	in     (%dx),%eax
+  806771:	0d 80 00 00 00       	or     $0x80,%eax
+  806776:	00 00                	add    %al,(%rax)
+  806778:	3c 0a                	cmp    $0xa,%al
+  80677a:	80 00 00             	addb   $0x0,(%rax)
+  80677d:	00 00                	add    %al,(%rax)
+  80677f:	00 ed                	add    %ch,%ch
+  806781:	0d 80 00 00 00       	or     $0x80,%eax
+  806786:	00 00                	add    %al,(%rax)
+  806788:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80678b:	00 00                	add    %al,(%rax)
+  80678d:	00 00                	add    %al,(%rax)
+  80678f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806795:	00 00                	add    %al,(%rax)
+  806797:	00 29                	add    %ch,(%rcx)
+  806799:	0c 80                	or     $0x80,%al
+  80679b:	00 00                	add    %al,(%rax)
+  80679d:	00 00                	add    %al,(%rax)
+  80679f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8067a2:	80 00 00             	addb   $0x0,(%rax)
+  8067a5:	00 00                	add    %al,(%rax)
+  8067a7:	00 ed                	add    %ch,%ch
+  8067a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067ae:	00 00                	add    %al,(%rax)
+  8067b0:	1a 0b                	sbb    (%rbx),%cl
+  8067b2:	80 00 00             	addb   $0x0,(%rax)
+  8067b5:	00 00                	add    %al,(%rax)
+  8067b7:	00 ed                	add    %ch,%ch
+  8067b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067be:	00 00                	add    %al,(%rax)
+  8067c0:	ce                   	(bad)
+  8067c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8067c7:	00 ed                	add    %ch,%ch
+  8067c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067ce:	00 00                	add    %al,(%rax)
+  8067d0:	ed                   	in     (%dx),%eax
+  8067d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067d6:	00 00                	add    %al,(%rax)
+  8067d8:	f4                   	hlt
+  8067d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8067df:	00 37                	add    %dh,(%rdi)
+  8067e1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067ea:	80 00 00             	addb   $0x0,(%rax)
+  8067ed:	00 00                	add    %al,(%rax)
+  8067ef:	00 37                	add    %dh,(%rdi)
+  8067f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067fa:	80 00 00             	addb   $0x0,(%rax)
+  8067fd:	00 00                	add    %al,(%rax)
+  8067ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806802:	80 00 00             	addb   $0x0,(%rax)
+  806805:	00 00                	add    %al,(%rax)
+  806807:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80680b:	00 00                	add    %al,(%rax)
+  80680d:	00 00                	add    %al,(%rax)
+  80680f:	00 d2                	add    %dl,%dl
+  806811:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806817:	00 d2                	add    %dl,%dl
+  806819:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80681f:	00 d2                	add    %dl,%dl
+  806821:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806827:	00 d2                	add    %dl,%dl
+  806829:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80682f:	00 d2                	add    %dl,%dl
+  806831:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806837:	00 d2                	add    %dl,%dl
+  806839:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80683f:	00 d2                	add    %dl,%dl
+  806841:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806847:	00 f6                	add    %dh,%dh
+  806849:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80684f:	00 f6                	add    %dh,%dh
+  806851:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806857:	00 5f 12             	add    %bl,0x12(%rdi)
+  80685a:	80 00 00             	addb   $0x0,(%rax)
+  80685d:	00 00                	add    %al,(%rax)
+  80685f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806862:	80 00 00             	addb   $0x0,(%rax)
+  806865:	00 00                	add    %al,(%rax)
+  806867:	00 5f 12             	add    %bl,0x12(%rdi)
+  80686a:	80 00 00             	addb   $0x0,(%rax)
+  80686d:	00 00                	add    %al,(%rax)
+  80686f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806872:	80 00 00             	addb   $0x0,(%rax)
+  806875:	00 00                	add    %al,(%rax)
+  806877:	00 5f 12             	add    %bl,0x12(%rdi)
+  80687a:	80 00 00             	addb   $0x0,(%rax)
+  80687d:	00 00                	add    %al,(%rax)
+  80687f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806882:	80 00 00             	addb   $0x0,(%rax)
+  806885:	00 00                	add    %al,(%rax)
+  806887:	00 5f 12             	add    %bl,0x12(%rdi)
+  80688a:	80 00 00             	addb   $0x0,(%rax)
+  80688d:	00 00                	add    %al,(%rax)
+  80688f:	00 22                	add    %ah,(%rdx)
+  806891:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806897:	00 22                	add    %ah,(%rdx)
+  806899:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80689f:	00 22                	add    %ah,(%rdx)
+  8068a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068a7:	00 22                	add    %ah,(%rdx)
+  8068a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068af:	00 22                	add    %ah,(%rdx)
+  8068b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068b7:	00 22                	add    %ah,(%rdx)
+  8068b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068c2:	80 00 00             	addb   $0x0,(%rax)
+  8068c5:	00 00                	add    %al,(%rax)
+  8068c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068ca:	80 00 00             	addb   $0x0,(%rax)
+  8068cd:	00 00                	add    %al,(%rax)
+  8068cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068d2:	80 00 00             	addb   $0x0,(%rax)
+  8068d5:	00 00                	add    %al,(%rax)
+  8068d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068da:	80 00 00             	addb   $0x0,(%rax)
+  8068dd:	00 00                	add    %al,(%rax)
+  8068df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068e2:	80 00 00             	addb   $0x0,(%rax)
+  8068e5:	00 00                	add    %al,(%rax)
+  8068e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068ea:	80 00 00             	addb   $0x0,(%rax)
+  8068ed:	00 00                	add    %al,(%rax)
+  8068ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068f2:	80 00 00             	addb   $0x0,(%rax)
+  8068f5:	00 00                	add    %al,(%rax)
+  8068f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068fa:	80 00 00             	addb   $0x0,(%rax)
+  8068fd:	00 00                	add    %al,(%rax)
+  8068ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806902:	80 00 00             	addb   $0x0,(%rax)
+  806905:	00 00                	add    %al,(%rax)
+  806907:	00 5f 12             	add    %bl,0x12(%rdi)
+  80690a:	80 00 00             	addb   $0x0,(%rax)
+  80690d:	00 00                	add    %al,(%rax)
+  80690f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806912:	80 00 00             	addb   $0x0,(%rax)
+  806915:	00 00                	add    %al,(%rax)
+  806917:	00 5f 12             	add    %bl,0x12(%rdi)
+  80691a:	80 00 00             	addb   $0x0,(%rax)
+  80691d:	00 00                	add    %al,(%rax)
+  80691f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806922:	80 00 00             	addb   $0x0,(%rax)
+  806925:	00 00                	add    %al,(%rax)
+  806927:	00 5f 12             	add    %bl,0x12(%rdi)
+  80692a:	80 00 00             	addb   $0x0,(%rax)
+  80692d:	00 00                	add    %al,(%rax)
+  80692f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806932:	80 00 00             	addb   $0x0,(%rax)
+  806935:	00 00                	add    %al,(%rax)
+  806937:	00 5f 12             	add    %bl,0x12(%rdi)
+  80693a:	80 00 00             	addb   $0x0,(%rax)
+  80693d:	00 00                	add    %al,(%rax)
+  80693f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806942:	80 00 00             	addb   $0x0,(%rax)
+  806945:	00 00                	add    %al,(%rax)
+  806947:	00 46 12             	add    %al,0x12(%rsi)
+  80694a:	80 00 00             	addb   $0x0,(%rax)
+  80694d:	00 00                	add    %al,(%rax)
+  80694f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806952:	80 00 00             	addb   $0x0,(%rax)
+  806955:	00 00                	add    %al,(%rax)
+  806957:	00 5f 12             	add    %bl,0x12(%rdi)
+  80695a:	80 00 00             	addb   $0x0,(%rax)
+  80695d:	00 00                	add    %al,(%rax)
+  80695f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806962:	80 00 00             	addb   $0x0,(%rax)
+  806965:	00 00                	add    %al,(%rax)
+  806967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80696a:	80 00 00             	addb   $0x0,(%rax)
+  80696d:	00 00                	add    %al,(%rax)
+  80696f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806972:	80 00 00             	addb   $0x0,(%rax)
+  806975:	00 00                	add    %al,(%rax)
+  806977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80697a:	80 00 00             	addb   $0x0,(%rax)
+  80697d:	00 00                	add    %al,(%rax)
+  80697f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806982:	80 00 00             	addb   $0x0,(%rax)
+  806985:	00 00                	add    %al,(%rax)
+  806987:	00 5f 12             	add    %bl,0x12(%rdi)
+  80698a:	80 00 00             	addb   $0x0,(%rax)
+  80698d:	00 00                	add    %al,(%rax)
+  80698f:	00 22                	add    %ah,(%rdx)
+  806991:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806997:	00 22                	add    %ah,(%rdx)
+  806999:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80699f:	00 22                	add    %ah,(%rdx)
+  8069a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8069a7:	00 22                	add    %ah,(%rdx)
+  8069a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8069af:	00 22                	add    %ah,(%rdx)
+  8069b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8069b7:	00 22                	add    %ah,(%rdx)
+  8069b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8069bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069c2:	80 00 00             	addb   $0x0,(%rax)
+  8069c5:	00 00                	add    %al,(%rax)
+  8069c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069ca:	80 00 00             	addb   $0x0,(%rax)
+  8069cd:	00 00                	add    %al,(%rax)
+  8069cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069d2:	80 00 00             	addb   $0x0,(%rax)
+  8069d5:	00 00                	add    %al,(%rax)
+  8069d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069da:	80 00 00             	addb   $0x0,(%rax)
+  8069dd:	00 00                	add    %al,(%rax)
+  8069df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069e2:	80 00 00             	addb   $0x0,(%rax)
+  8069e5:	00 00                	add    %al,(%rax)
+  8069e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069ea:	80 00 00             	addb   $0x0,(%rax)
+  8069ed:	00 00                	add    %al,(%rax)
+  8069ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069f2:	80 00 00             	addb   $0x0,(%rax)
+  8069f5:	00 00                	add    %al,(%rax)
+  8069f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069fa:	80 00 00             	addb   $0x0,(%rax)
+  8069fd:	00 00                	add    %al,(%rax)
+  8069ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a02:	80 00 00             	addb   $0x0,(%rax)
+  806a05:	00 00                	add    %al,(%rax)
+  806a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a0a:	80 00 00             	addb   $0x0,(%rax)
+  806a0d:	00 00                	add    %al,(%rax)
+  806a0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a12:	80 00 00             	addb   $0x0,(%rax)
+  806a15:	00 00                	add    %al,(%rax)
+  806a17:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a1a:	80 00 00             	addb   $0x0,(%rax)
+  806a1d:	00 00                	add    %al,(%rax)
+  806a1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a22:	80 00 00             	addb   $0x0,(%rax)
+  806a25:	00 00                	add    %al,(%rax)
+  806a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a2a:	80 00 00             	addb   $0x0,(%rax)
+  806a2d:	00 00                	add    %al,(%rax)
+  806a2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a32:	80 00 00             	addb   $0x0,(%rax)
+  806a35:	00 00                	add    %al,(%rax)
+  806a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a3a:	80 00 00             	addb   $0x0,(%rax)
+  806a3d:	00 00                	add    %al,(%rax)
+  806a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a42:	80 00 00             	addb   $0x0,(%rax)
+  806a45:	00 00                	add    %al,(%rax)
+  806a47:	00 46 12             	add    %al,0x12(%rsi)
+  806a4a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806a60 <basefix.0>:
+  806a60:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806a70:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806a80:	10 00 2f 68 65 6c 6c 6f 00 73 70 61 77 6e 20 25     ../hello.spawn %
+  806a90:	73 3a 20 25 69 00 75 73 65 72 2f 73 70 61 77 6e     s: %i.user/spawn
+  806aa0:	63 61 63 68 65 2e 63 00 73 74 61 74 20 25 73 3a     cache.c.stat %s:
+  806ab0:	20 25 69 00 73 79 73 5f 61 6c 6c 6f 63 5f 72 65      %i.sys_alloc_re
+  806ac0:	67 69 6f 6e 3a 20 25 69 00 73 70 61 77 6e 63 61     gion: %i.spawnca
+  806ad0:	63 68 65 3a 20 4f 4b 0a 00 0f 1f 80 00 00 00 00     che: OK.........
+  806ae0:	25 73 20 69 73 20 6e 6f 74 20 63 61 63 68 65 64     %s is not cached
+  806af0:	20 66 6f 72 20 61 20 73 69 62 6c 69 6e 67 20 66      for a sibling f
+  806b00:	6f 72 6b 3a 20 25 69 00 25 73 20 69 73 20 63 61     ork: %i.%s is ca
+  806b10:	63 68 65 64 20 62 65 66 6f 72 65 20 69 74 20 77     ched before it w
+  806b20:	61 73 20 73 70 61 77 6e 65 64 3a 20 25 69 00 3c     as spawned: %i.<
+  806b30:	75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 80 00 00 00 00     unknown>........
+  806b40:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806b50:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806b60:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806b70:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806b80:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806b90:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806ba0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806bb0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806bc0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806bd0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806be0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806bf0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806c00:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806c10:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806c20:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806c30:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806c40:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806c50:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806c60:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806c70:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806c80:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806c90:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806ca0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806cb0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806cc0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806cd0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806ce0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806cf0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  806d00:	4c 1c 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     L........"......
+  806d10:	93 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806d20:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806d30:	a3 22 80 00 00 00 00 00 6b 1c 80 00 00 00 00 00     ."......k.......
+  806d40:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806d50:	5f 1c 80 00 00 00 00 00 d9 1c 80 00 00 00 00 00     _...............
+  806d60:	a3 22 80 00 00 00 00 00 5f 1c 80 00 00 00 00 00     ."......_.......
+  806d70:	a5 1c 80 00 00 00 00 00 a5 1c 80 00 00 00 00 00     ................
+  806d80:	a5 1c 80 00 00 00 00 00 a5 1c 80 00 00 00 00 00     ................
+  806d90:	a5 1c 80 00 00 00 00 00 a5 1c 80 00 00 00 00 00     ................
+  806da0:	a5 1c 80 00 00 00 00 00 a5 1c 80 00 00 00 00 00     ................
+  806db0:	a5 1c 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ........."......
+  806dc0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806dd0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806de0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806df0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e00:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e10:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e20:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e30:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e40:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e50:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e60:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e70:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e80:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806e90:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806ea0:	a3 22 80 00 00 00 00 00 c1 21 80 00 00 00 00 00     .".......!......
+  806eb0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806ec0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806ed0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806ee0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806ef0:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806f00:	07 1d 80 00 00 00 00 00 d6 1e 80 00 00 00 00 00     ................
+  806f10:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806f20:	a3 22 80 00 00 00 00 00 fc 1c 80 00 00 00 00 00     ."..............
+  806f30:	36 1d 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     6........"......
+  806f40:	a3 22 80 00 00 00 00 00 f1 1c 80 00 00 00 00 00     ."..............
+  806f50:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806f60:	7f 20 80 00 00 00 00 00 4e 21 80 00 00 00 00 00     . ......N!......
+  806f70:	a3 22 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ."......."......
+  806f80:	cd 1d 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ........."......
+  806f90:	aa 1f 80 00 00 00 00 00 a3 22 80 00 00 00 00 00     ........."......
+  806fa0:	a3 22 80 00 00 00 00 00 c1 21 80 00 00 00 00 00     .".......!......
+  806fb0:	a3 22 80 00 00 00 00 00 55 1c 80 00 00 00 00 00     ."......U.......
+
+0000000000806fc0 <error_string>:
+	...
+  806fc8:	95 6b 80 00 00 00 00 00 a7 6b 80 00 00 00 00 00     .k.......k......
+  806fd8:	b7 6b 80 00 00 00 00 00 c9 6b 80 00 00 00 00 00     .k.......k......
+  806fe8:	d7 6b 80 00 00 00 00 00 eb 6b 80 00 00 00 00 00     .k.......k......
+  806ff8:	00 6c 80 00 00 00 00 00 13 6c 80 00 00 00 00 00     .l.......l......
+  807008:	25 6c 80 00 00 00 00 00 39 6c 80 00 00 00 00 00     %l......9l......
+  807018:	49 6c 80 00 00 00 00 00 5c 6c 80 00 00 00 00 00     Il......\l......
+  807028:	73 6c 80 00 00 00 00 00 89 6c 80 00 00 00 00 00     sl.......l......
+  807038:	a1 6c 80 00 00 00 00 00 b9 6c 80 00 00 00 00 00     .l.......l......
+  807048:	c6 6c 80 00 00 00 00 00 60 70 80 00 00 00 00 00     .l......`p......
+  807058:	da 6c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .l......file is 
+  807068:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  807078:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  807088:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  807098:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8070a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8070b8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8070c8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8070d8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8070e8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8070f8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  807108:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  807118:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  807128:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  807138:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  807148:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  807158:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  807168:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  807178:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  807188:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  807198:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8071a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8071b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008071c0 <devtab>:
+  8071c0:	40 80 80 00 00 00 00 00 80 80 80 00 00 00 00 00     @...............
+  8071d0:	c0 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8071e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8071f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  807200:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  807210:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  807220:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  807230:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807240:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807250:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  807260:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  807270:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  807280:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  807290:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8072a0:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  8072b0:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  8072c0:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  8072d0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  8072e0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  8072f0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807300:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  807310:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  807320:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  807330:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  807340:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  807350:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  807360:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  807370:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  807380:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  807390:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8073a0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8073b0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8073c0:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  8073d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8073e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8073f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807400:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807410:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807420:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807430:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807440:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807450:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807460:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807470:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807480:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807490:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8074a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8074b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8074c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8074d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8074e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8074f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807500:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807510:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807520:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807530:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807540:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807550:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807560:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807570:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807580:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807590:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8075c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8075d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8075e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807600:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807610:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807620:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807630:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807640:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807650:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807660:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807670:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807680:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807690:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8076c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8076d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807700:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807710:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807720:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807730:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8077c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8077d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8078c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8078d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8079c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8079d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
@@ -0,0 +1,10891 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 3c 33 80 00 00 	movabs $0x80333c,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 3c 33 80 00 00 	movabs $0x80333c,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 3e 17 80 00 00 	movabs $0x80173e,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 2f 16 80 00 00 	movabs $0x80162f,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 47 66 80 00 00 	movabs $0x806647,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 00 60 80 00 00 	movabs $0x806000,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 02 60 80 00 00 	movabs $0x806002,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 05 60 80 00 00 	movabs $0x806005,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 9b 21 80 00 00 	movabs $0x80219b,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 eb 53 80 00 00 	movabs $0x8053eb,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c2 56 80 00 00 	movabs $0x8056c2,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 26 34 80 00 00 	movabs $0x803426,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 f5 33 80 00 00 	movabs $0x8033f5,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 f5 33 80 00 00 	movabs $0x8033f5,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 0d 32 80 00 00 	movabs $0x80320d,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 3c 33 80 00 00 	movabs $0x80333c,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 48 23 80 00 00 	movabs $0x802348,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 60 80 00 00 	movabs $0x806020,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 48 23 80 00 00 	movabs $0x802348,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 48 23 80 00 00 	movabs $0x802348,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 62 80 00 00 	movabs $0x8062c0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 48 23 80 00 00 	movabs $0x802348,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 48 23 80 00 00 	movabs $0x802348,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 65 80 00 00 	movabs $0x806540,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 65 80 00 00 	movabs $0x806540,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a0 25 80 00 00 	movabs $0x8025a0,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a0 25 80 00 00 	movabs $0x8025a0,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 87 00 00 00       	call   801586 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  801505:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80150c:	00 00 00 
+  80150f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801515:	48 bf 62 65 80 00 00 	movabs $0x806562,%rdi
+  80151c:	00 00 00 
+  80151f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801524:	48 ba a2 17 80 00 00 	movabs $0x8017a2,%rdx
+  80152b:	00 00 00 
+  80152e:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  801530:	ba 00 00 00 00       	mov    $0x0,%edx
+  801535:	48 bf 80 65 80 00 00 	movabs $0x806580,%rdi
+  80153c:	00 00 00 
+  80153f:	48 89 fe             	mov    %rdi,%rsi
+  801542:	b8 00 00 00 00       	mov    $0x0,%eax
+  801547:	48 b9 f6 45 80 00 00 	movabs $0x8045f6,%rcx
+  80154e:	00 00 00 
+  801551:	ff d1                	call   *%rcx
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 02                	js     801559 <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  801557:	5d                   	pop    %rbp
+  801558:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  801559:	89 c1                	mov    %eax,%ecx
+  80155b:	48 ba 86 65 80 00 00 	movabs $0x806586,%rdx
+  801562:	00 00 00 
+  801565:	be 08 00 00 00       	mov    $0x8,%esi
+  80156a:	48 bf 9e 65 80 00 00 	movabs $0x80659e,%rdi
+  801571:	00 00 00 
+  801574:	b8 00 00 00 00       	mov    $0x0,%eax
+  801579:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  801580:	00 00 00 
+  801583:	41 ff d0             	call   *%r8
+
+0000000000801586 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801586:	55                   	push   %rbp
+  801587:	48 89 e5             	mov    %rsp,%rbp
+  80158a:	41 56                	push   %r14
+  80158c:	41 55                	push   %r13
+  80158e:	41 54                	push   %r12
+  801590:	53                   	push   %rbx
+  801591:	41 89 fd             	mov    %edi,%r13d
+  801594:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801597:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80159e:	00 00 00 
+  8015a1:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8015a8:	00 00 00 
+  8015ab:	48 39 c2             	cmp    %rax,%rdx
+  8015ae:	73 17                	jae    8015c7 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8015b0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015b3:	49 89 c4             	mov    %rax,%r12
+  8015b6:	48 83 c3 08          	add    $0x8,%rbx
+  8015ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bf:	ff 53 f8             	call   *-0x8(%rbx)
+  8015c2:	4c 39 e3             	cmp    %r12,%rbx
+  8015c5:	72 ef                	jb     8015b6 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8015c7:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  8015ce:	00 00 00 
+  8015d1:	ff d0                	call   *%rax
+  8015d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015d8:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015df:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015e6:	00 00 00 
+  8015e9:	48 01 d0             	add    %rdx,%rax
+  8015ec:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8015f3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8015f6:	45 85 ed             	test   %r13d,%r13d
+  8015f9:	7e 0d                	jle    801608 <libmain+0x82>
+  8015fb:	49 8b 06             	mov    (%r14),%rax
+  8015fe:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801605:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801608:	4c 89 f6             	mov    %r14,%rsi
+  80160b:	44 89 ef             	mov    %r13d,%edi
+  80160e:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801615:	00 00 00 
+  801618:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80161a:	48 b8 2f 16 80 00 00 	movabs $0x80162f,%rax
+  801621:	00 00 00 
+  801624:	ff d0                	call   *%rax
+#endif
+}
+  801626:	5b                   	pop    %rbx
+  801627:	41 5c                	pop    %r12
+  801629:	41 5d                	pop    %r13
+  80162b:	41 5e                	pop    %r14
+  80162d:	5d                   	pop    %rbp
+  80162e:	c3                   	ret
+
+000000000080162f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801633:	48 b8 c2 30 80 00 00 	movabs $0x8030c2,%rax
+  80163a:	00 00 00 
+  80163d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80163f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801644:	48 b8 f5 26 80 00 00 	movabs $0x8026f5,%rax
+  80164b:	00 00 00 
+  80164e:	ff d0                	call   *%rax
+}
+  801650:	5d                   	pop    %rbp
+  801651:	c3                   	ret
+
+0000000000801652 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801652:	55                   	push   %rbp
+  801653:	48 89 e5             	mov    %rsp,%rbp
+  801656:	41 56                	push   %r14
+  801658:	41 55                	push   %r13
+  80165a:	41 54                	push   %r12
+  80165c:	53                   	push   %rbx
+  80165d:	48 83 ec 50          	sub    $0x50,%rsp
+  801661:	49 89 fc             	mov    %rdi,%r12
+  801664:	41 89 f5             	mov    %esi,%r13d
+  801667:	48 89 d3             	mov    %rdx,%rbx
+  80166a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80166e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801672:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801676:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80167d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801681:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801685:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801689:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80168d:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801694:	00 00 00 
+  801697:	4c 8b 30             	mov    (%rax),%r14
+  80169a:	48 b8 66 27 80 00 00 	movabs $0x802766,%rax
+  8016a1:	00 00 00 
+  8016a4:	ff d0                	call   *%rax
+  8016a6:	89 c6                	mov    %eax,%esi
+  8016a8:	45 89 e8             	mov    %r13d,%r8d
+  8016ab:	4c 89 e1             	mov    %r12,%rcx
+  8016ae:	4c 89 f2             	mov    %r14,%rdx
+  8016b1:	48 bf c0 65 80 00 00 	movabs $0x8065c0,%rdi
+  8016b8:	00 00 00 
+  8016bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c0:	49 bc a2 17 80 00 00 	movabs $0x8017a2,%r12
+  8016c7:	00 00 00 
+  8016ca:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8016cd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8016d1:	48 89 df             	mov    %rbx,%rdi
+  8016d4:	48 b8 3e 17 80 00 00 	movabs $0x80173e,%rax
+  8016db:	00 00 00 
+  8016de:	ff d0                	call   *%rax
+    cprintf("\n");
+  8016e0:	48 bf 93 6b 80 00 00 	movabs $0x806b93,%rdi
+  8016e7:	00 00 00 
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ef:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8016f2:	cc                   	int3
+  8016f3:	eb fd                	jmp    8016f2 <_panic+0xa0>
+
+00000000008016f5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8016f5:	55                   	push   %rbp
+  8016f6:	48 89 e5             	mov    %rsp,%rbp
+  8016f9:	53                   	push   %rbx
+  8016fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8016fe:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801701:	8b 06                	mov    (%rsi),%eax
+  801703:	8d 50 01             	lea    0x1(%rax),%edx
+  801706:	89 16                	mov    %edx,(%rsi)
+  801708:	48 98                	cltq
+  80170a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80170f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801715:	74 0a                	je     801721 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801717:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80171b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80171f:	c9                   	leave
+  801720:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801721:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801725:	be ff 00 00 00       	mov    $0xff,%esi
+  80172a:	48 b8 56 26 80 00 00 	movabs $0x802656,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+        state->offset = 0;
+  801736:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80173c:	eb d9                	jmp    801717 <putch+0x22>
+
+000000000080173e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80173e:	55                   	push   %rbp
+  80173f:	48 89 e5             	mov    %rsp,%rbp
+  801742:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801749:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80174c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801753:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801760:	48 89 f1             	mov    %rsi,%rcx
+  801763:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80176a:	48 bf f5 16 80 00 00 	movabs $0x8016f5,%rdi
+  801771:	00 00 00 
+  801774:	48 b8 f2 18 80 00 00 	movabs $0x8018f2,%rax
+  80177b:	00 00 00 
+  80177e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801780:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801787:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80178e:	48 b8 56 26 80 00 00 	movabs $0x802656,%rax
+  801795:	00 00 00 
+  801798:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80179a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+
+00000000008017a2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+  8017a6:	48 83 ec 50          	sub    $0x50,%rsp
+  8017aa:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8017ae:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8017b2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017b6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017ba:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8017be:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8017c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017cd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8017d5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8017d9:	48 b8 3e 17 80 00 00 	movabs $0x80173e,%rax
+  8017e0:	00 00 00 
+  8017e3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8017e5:	c9                   	leave
+  8017e6:	c3                   	ret
+
+00000000008017e7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8017e7:	55                   	push   %rbp
+  8017e8:	48 89 e5             	mov    %rsp,%rbp
+  8017eb:	41 57                	push   %r15
+  8017ed:	41 56                	push   %r14
+  8017ef:	41 55                	push   %r13
+  8017f1:	41 54                	push   %r12
+  8017f3:	53                   	push   %rbx
+  8017f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8017f8:	49 89 fc             	mov    %rdi,%r12
+  8017fb:	49 89 f5             	mov    %rsi,%r13
+  8017fe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801802:	8b 45 10             	mov    0x10(%rbp),%eax
+  801805:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801808:	41 89 cf             	mov    %ecx,%r15d
+  80180b:	4c 39 fa             	cmp    %r15,%rdx
+  80180e:	73 5b                	jae    80186b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801810:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801814:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801818:	85 db                	test   %ebx,%ebx
+  80181a:	7e 0e                	jle    80182a <print_num+0x43>
+            putch(padc, put_arg);
+  80181c:	4c 89 ee             	mov    %r13,%rsi
+  80181f:	44 89 f7             	mov    %r14d,%edi
+  801822:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801825:	83 eb 01             	sub    $0x1,%ebx
+  801828:	75 f2                	jne    80181c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80182a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80182e:	48 b9 f4 65 80 00 00 	movabs $0x8065f4,%rcx
+  801835:	00 00 00 
+  801838:	48 b8 e3 65 80 00 00 	movabs $0x8065e3,%rax
+  80183f:	00 00 00 
+  801842:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801846:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80184a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184f:	49 f7 f7             	div    %r15
+  801852:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801856:	4c 89 ee             	mov    %r13,%rsi
+  801859:	41 ff d4             	call   *%r12
+}
+  80185c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801860:	5b                   	pop    %rbx
+  801861:	41 5c                	pop    %r12
+  801863:	41 5d                	pop    %r13
+  801865:	41 5e                	pop    %r14
+  801867:	41 5f                	pop    %r15
+  801869:	5d                   	pop    %rbp
+  80186a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80186b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80186f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801874:	49 f7 f7             	div    %r15
+  801877:	48 83 ec 08          	sub    $0x8,%rsp
+  80187b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80187f:	52                   	push   %rdx
+  801880:	45 0f be c9          	movsbl %r9b,%r9d
+  801884:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801888:	48 89 c2             	mov    %rax,%rdx
+  80188b:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  801892:	00 00 00 
+  801895:	ff d0                	call   *%rax
+  801897:	48 83 c4 10          	add    $0x10,%rsp
+  80189b:	eb 8d                	jmp    80182a <print_num+0x43>
+
+000000000080189d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80189d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8018a1:	48 8b 06             	mov    (%rsi),%rax
+  8018a4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8018a8:	73 0a                	jae    8018b4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8018aa:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018ae:	48 89 16             	mov    %rdx,(%rsi)
+  8018b1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8018b4:	c3                   	ret
+
+00000000008018b5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8018b5:	55                   	push   %rbp
+  8018b6:	48 89 e5             	mov    %rsp,%rbp
+  8018b9:	48 83 ec 50          	sub    $0x50,%rsp
+  8018bd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018c1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018c5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8018c9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8018d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018d8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8018e0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8018e4:	48 b8 f2 18 80 00 00 	movabs $0x8018f2,%rax
+  8018eb:	00 00 00 
+  8018ee:	ff d0                	call   *%rax
+}
+  8018f0:	c9                   	leave
+  8018f1:	c3                   	ret
+
+00000000008018f2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8018f2:	55                   	push   %rbp
+  8018f3:	48 89 e5             	mov    %rsp,%rbp
+  8018f6:	41 57                	push   %r15
+  8018f8:	41 56                	push   %r14
+  8018fa:	41 55                	push   %r13
+  8018fc:	41 54                	push   %r12
+  8018fe:	53                   	push   %rbx
+  8018ff:	48 83 ec 38          	sub    $0x38,%rsp
+  801903:	49 89 fe             	mov    %rdi,%r14
+  801906:	49 89 f5             	mov    %rsi,%r13
+  801909:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80190c:	48 8b 01             	mov    (%rcx),%rax
+  80190f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801913:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801917:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80191b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80191f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801923:	eb 0d                	jmp    801932 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801925:	40 0f b6 ff          	movzbl %dil,%edi
+  801929:	4c 89 ee             	mov    %r13,%rsi
+  80192c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80192f:	4c 89 e3             	mov    %r12,%rbx
+  801932:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801936:	0f b6 3b             	movzbl (%rbx),%edi
+  801939:	40 80 ff 25          	cmp    $0x25,%dil
+  80193d:	74 14                	je     801953 <vprintfmt+0x61>
+            if (!ch) return;
+  80193f:	40 84 ff             	test   %dil,%dil
+  801942:	75 e1                	jne    801925 <vprintfmt+0x33>
+}
+  801944:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801948:	5b                   	pop    %rbx
+  801949:	41 5c                	pop    %r12
+  80194b:	41 5d                	pop    %r13
+  80194d:	41 5e                	pop    %r14
+  80194f:	41 5f                	pop    %r15
+  801951:	5d                   	pop    %rbp
+  801952:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801953:	be 00 00 00 00       	mov    $0x0,%esi
+  801958:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80195c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801961:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801967:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80196e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801972:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801977:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80197c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80197f:	83 e8 23             	sub    $0x23,%eax
+  801982:	3c 57                	cmp    $0x57,%al
+  801984:	0f 87 67 06 00 00    	ja     801ff1 <vprintfmt+0x6ff>
+  80198a:	0f b6 c0             	movzbl %al,%eax
+  80198d:	48 b9 80 67 80 00 00 	movabs $0x806780,%rcx
+  801994:	00 00 00 
+  801997:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80199a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80199d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8019a1:	eb cf                	jmp    801972 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8019a3:	49 89 dc             	mov    %rbx,%r12
+  8019a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8019ab:	eb c5                	jmp    801972 <vprintfmt+0x80>
+            padc = ch;
+  8019ad:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8019b1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8019b4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019b7:	eb b9                	jmp    801972 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8019bf:	77 24                	ja     8019e5 <vprintfmt+0xf3>
+  8019c1:	89 c1                	mov    %eax,%ecx
+  8019c3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8019c7:	83 c0 08             	add    $0x8,%eax
+  8019ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8019cd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8019d0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8019d3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8019d7:	79 99                	jns    801972 <vprintfmt+0x80>
+                width = precision;
+  8019d9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8019dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8019e3:	eb 8d                	jmp    801972 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8019e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8019e9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8019ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019f1:	eb da                	jmp    8019cd <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8019f3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8019f8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019fc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a02:	3c 39                	cmp    $0x39,%al
+  801a04:	77 1c                	ja     801a22 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801a06:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801a0a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801a0e:	0f b6 c0             	movzbl %al,%eax
+  801a11:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a16:	0f b6 03             	movzbl (%rbx),%eax
+  801a19:	3c 39                	cmp    $0x39,%al
+  801a1b:	76 e9                	jbe    801a06 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801a1d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801a20:	eb b1                	jmp    8019d3 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801a22:	49 89 dc             	mov    %rbx,%r12
+  801a25:	eb ac                	jmp    8019d3 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801a27:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801a2a:	85 c9                	test   %ecx,%ecx
+  801a2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a31:	0f 49 c1             	cmovns %ecx,%eax
+  801a34:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801a37:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a3a:	e9 33 ff ff ff       	jmp    801972 <vprintfmt+0x80>
+            lflag++;
+  801a3f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a42:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a45:	e9 28 ff ff ff       	jmp    801972 <vprintfmt+0x80>
+            lflag--;
+  801a4a:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801a4d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a50:	e9 1d ff ff ff       	jmp    801972 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a58:	83 f8 2f             	cmp    $0x2f,%eax
+  801a5b:	77 19                	ja     801a76 <vprintfmt+0x184>
+  801a5d:	89 c2                	mov    %eax,%edx
+  801a5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a63:	83 c0 08             	add    $0x8,%eax
+  801a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a69:	8b 3a                	mov    (%rdx),%edi
+  801a6b:	4c 89 ee             	mov    %r13,%rsi
+  801a6e:	41 ff d6             	call   *%r14
+            break;
+  801a71:	e9 bc fe ff ff       	jmp    801932 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a82:	eb e5                	jmp    801a69 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a87:	83 f8 2f             	cmp    $0x2f,%eax
+  801a8a:	77 5a                	ja     801ae6 <vprintfmt+0x1f4>
+  801a8c:	89 c2                	mov    %eax,%edx
+  801a8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a92:	83 c0 08             	add    $0x8,%eax
+  801a95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a98:	8b 02                	mov    (%rdx),%eax
+  801a9a:	89 c1                	mov    %eax,%ecx
+  801a9c:	f7 d9                	neg    %ecx
+  801a9e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801aa1:	83 f9 13             	cmp    $0x13,%ecx
+  801aa4:	7f 4e                	jg     801af4 <vprintfmt+0x202>
+  801aa6:	48 63 c1             	movslq %ecx,%rax
+  801aa9:	48 ba 40 6a 80 00 00 	movabs $0x806a40,%rdx
+  801ab0:	00 00 00 
+  801ab3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ab7:	48 85 c0             	test   %rax,%rax
+  801aba:	74 38                	je     801af4 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801abc:	48 89 c1             	mov    %rax,%rcx
+  801abf:	48 ba 08 6c 80 00 00 	movabs $0x806c08,%rdx
+  801ac6:	00 00 00 
+  801ac9:	4c 89 ee             	mov    %r13,%rsi
+  801acc:	4c 89 f7             	mov    %r14,%rdi
+  801acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad4:	49 b8 b5 18 80 00 00 	movabs $0x8018b5,%r8
+  801adb:	00 00 00 
+  801ade:	41 ff d0             	call   *%r8
+  801ae1:	e9 4c fe ff ff       	jmp    801932 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801ae6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801aea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801aee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801af2:	eb a4                	jmp    801a98 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801af4:	48 ba 0c 66 80 00 00 	movabs $0x80660c,%rdx
+  801afb:	00 00 00 
+  801afe:	4c 89 ee             	mov    %r13,%rsi
+  801b01:	4c 89 f7             	mov    %r14,%rdi
+  801b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b09:	49 b8 b5 18 80 00 00 	movabs $0x8018b5,%r8
+  801b10:	00 00 00 
+  801b13:	41 ff d0             	call   *%r8
+  801b16:	e9 17 fe ff ff       	jmp    801932 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b1e:	83 f8 2f             	cmp    $0x2f,%eax
+  801b21:	77 6c                	ja     801b8f <vprintfmt+0x29d>
+  801b23:	89 c2                	mov    %eax,%edx
+  801b25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b29:	83 c0 08             	add    $0x8,%eax
+  801b2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b2f:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801b32:	48 85 f6             	test   %rsi,%rsi
+  801b35:	48 b8 05 66 80 00 00 	movabs $0x806605,%rax
+  801b3c:	00 00 00 
+  801b3f:	48 0f 45 c6          	cmovne %rsi,%rax
+  801b43:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801b47:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801b4b:	7e 06                	jle    801b53 <vprintfmt+0x261>
+  801b4d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801b51:	75 4a                	jne    801b9d <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b53:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801b57:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801b5b:	0f b6 00             	movzbl (%rax),%eax
+  801b5e:	84 c0                	test   %al,%al
+  801b60:	0f 85 9a 00 00 00    	jne    801c00 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b66:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b69:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	0f 8e bd fd ff ff    	jle    801932 <vprintfmt+0x40>
+  801b75:	4c 89 ee             	mov    %r13,%rsi
+  801b78:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b7d:	41 ff d6             	call   *%r14
+  801b80:	41 83 ec 01          	sub    $0x1,%r12d
+  801b84:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b88:	75 eb                	jne    801b75 <vprintfmt+0x283>
+  801b8a:	e9 a3 fd ff ff       	jmp    801932 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b9b:	eb 92                	jmp    801b2f <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b9d:	49 63 f7             	movslq %r15d,%rsi
+  801ba0:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801ba4:	48 b8 b6 20 80 00 00 	movabs $0x8020b6,%rax
+  801bab:	00 00 00 
+  801bae:	ff d0                	call   *%rax
+  801bb0:	48 89 c2             	mov    %rax,%rdx
+  801bb3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bb6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801bb8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801bbb:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801bbe:	85 c0                	test   %eax,%eax
+  801bc0:	7e 91                	jle    801b53 <vprintfmt+0x261>
+  801bc2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801bc7:	4c 89 ee             	mov    %r13,%rsi
+  801bca:	44 89 e7             	mov    %r12d,%edi
+  801bcd:	41 ff d6             	call   *%r14
+  801bd0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bd4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801bd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801bda:	75 eb                	jne    801bc7 <vprintfmt+0x2d5>
+  801bdc:	e9 72 ff ff ff       	jmp    801b53 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801be1:	0f b6 f8             	movzbl %al,%edi
+  801be4:	4c 89 ee             	mov    %r13,%rsi
+  801be7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bea:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801bee:	49 83 c4 01          	add    $0x1,%r12
+  801bf2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801bf8:	84 c0                	test   %al,%al
+  801bfa:	0f 84 66 ff ff ff    	je     801b66 <vprintfmt+0x274>
+  801c00:	45 85 ff             	test   %r15d,%r15d
+  801c03:	78 0a                	js     801c0f <vprintfmt+0x31d>
+  801c05:	41 83 ef 01          	sub    $0x1,%r15d
+  801c09:	0f 88 57 ff ff ff    	js     801b66 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c0f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801c13:	74 cc                	je     801be1 <vprintfmt+0x2ef>
+  801c15:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801c18:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801c1d:	80 fa 5e             	cmp    $0x5e,%dl
+  801c20:	77 c2                	ja     801be4 <vprintfmt+0x2f2>
+  801c22:	eb bd                	jmp    801be1 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801c24:	40 84 f6             	test   %sil,%sil
+  801c27:	75 26                	jne    801c4f <vprintfmt+0x35d>
+    switch (lflag) {
+  801c29:	85 d2                	test   %edx,%edx
+  801c2b:	74 59                	je     801c86 <vprintfmt+0x394>
+  801c2d:	83 fa 01             	cmp    $0x1,%edx
+  801c30:	74 7b                	je     801cad <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801c32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c35:	83 f8 2f             	cmp    $0x2f,%eax
+  801c38:	0f 87 96 00 00 00    	ja     801cd4 <vprintfmt+0x3e2>
+  801c3e:	89 c2                	mov    %eax,%edx
+  801c40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c44:	83 c0 08             	add    $0x8,%eax
+  801c47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c4a:	4c 8b 22             	mov    (%rdx),%r12
+  801c4d:	eb 17                	jmp    801c66 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c52:	83 f8 2f             	cmp    $0x2f,%eax
+  801c55:	77 21                	ja     801c78 <vprintfmt+0x386>
+  801c57:	89 c2                	mov    %eax,%edx
+  801c59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c5d:	83 c0 08             	add    $0x8,%eax
+  801c60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c63:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c66:	4d 85 e4             	test   %r12,%r12
+  801c69:	78 7a                	js     801ce5 <vprintfmt+0x3f3>
+            num = i;
+  801c6b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c73:	e9 56 02 00 00       	jmp    801ece <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c84:	eb dd                	jmp    801c63 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c89:	83 f8 2f             	cmp    $0x2f,%eax
+  801c8c:	77 11                	ja     801c9f <vprintfmt+0x3ad>
+  801c8e:	89 c2                	mov    %eax,%edx
+  801c90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c94:	83 c0 08             	add    $0x8,%eax
+  801c97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c9a:	4c 63 22             	movslq (%rdx),%r12
+  801c9d:	eb c7                	jmp    801c66 <vprintfmt+0x374>
+  801c9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ca7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cab:	eb ed                	jmp    801c9a <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801cad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb0:	83 f8 2f             	cmp    $0x2f,%eax
+  801cb3:	77 11                	ja     801cc6 <vprintfmt+0x3d4>
+  801cb5:	89 c2                	mov    %eax,%edx
+  801cb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cbb:	83 c0 08             	add    $0x8,%eax
+  801cbe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cc1:	4c 8b 22             	mov    (%rdx),%r12
+  801cc4:	eb a0                	jmp    801c66 <vprintfmt+0x374>
+  801cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cd2:	eb ed                	jmp    801cc1 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801cd4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cd8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ce0:	e9 65 ff ff ff       	jmp    801c4a <vprintfmt+0x358>
+                putch('-', put_arg);
+  801ce5:	4c 89 ee             	mov    %r13,%rsi
+  801ce8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801ced:	41 ff d6             	call   *%r14
+                i = -i;
+  801cf0:	49 f7 dc             	neg    %r12
+  801cf3:	e9 73 ff ff ff       	jmp    801c6b <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801cf8:	40 84 f6             	test   %sil,%sil
+  801cfb:	75 2e                	jne    801d2b <vprintfmt+0x439>
+    switch (lflag) {
+  801cfd:	85 d2                	test   %edx,%edx
+  801cff:	7f 59                	jg     801d5a <vprintfmt+0x468>
+  801d01:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d04:	7d 7a                	jge    801d80 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801d06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d09:	83 f8 2f             	cmp    $0x2f,%eax
+  801d0c:	0f 87 aa 00 00 00    	ja     801dbc <vprintfmt+0x4ca>
+  801d12:	89 c2                	mov    %eax,%edx
+  801d14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d18:	83 c0 08             	add    $0x8,%eax
+  801d1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d26:	e9 a3 01 00 00       	jmp    801ece <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d2e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d31:	77 19                	ja     801d4c <vprintfmt+0x45a>
+  801d33:	89 c2                	mov    %eax,%edx
+  801d35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d39:	83 c0 08             	add    $0x8,%eax
+  801d3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d3f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801d47:	e9 82 01 00 00       	jmp    801ece <vprintfmt+0x5dc>
+  801d4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d58:	eb e5                	jmp    801d3f <vprintfmt+0x44d>
+    switch (lflag) {
+  801d5a:	83 fa 01             	cmp    $0x1,%edx
+  801d5d:	75 a7                	jne    801d06 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801d5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d62:	83 f8 2f             	cmp    $0x2f,%eax
+  801d65:	77 47                	ja     801dae <vprintfmt+0x4bc>
+  801d67:	89 c2                	mov    %eax,%edx
+  801d69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d6d:	83 c0 08             	add    $0x8,%eax
+  801d70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d73:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d7b:	e9 4e 01 00 00       	jmp    801ece <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d83:	83 f8 2f             	cmp    $0x2f,%eax
+  801d86:	77 18                	ja     801da0 <vprintfmt+0x4ae>
+  801d88:	89 c2                	mov    %eax,%edx
+  801d8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d8e:	83 c0 08             	add    $0x8,%eax
+  801d91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d94:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d9b:	e9 2e 01 00 00       	jmp    801ece <vprintfmt+0x5dc>
+  801da0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801da4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801da8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dac:	eb e6                	jmp    801d94 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801dae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dba:	eb b7                	jmp    801d73 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801dbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc8:	e9 51 ff ff ff       	jmp    801d1e <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801dcd:	40 84 f6             	test   %sil,%sil
+  801dd0:	75 2e                	jne    801e00 <vprintfmt+0x50e>
+    switch (lflag) {
+  801dd2:	85 d2                	test   %edx,%edx
+  801dd4:	7f 59                	jg     801e2f <vprintfmt+0x53d>
+  801dd6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801dd9:	7d 77                	jge    801e52 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801ddb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dde:	83 f8 2f             	cmp    $0x2f,%eax
+  801de1:	0f 87 a4 00 00 00    	ja     801e8b <vprintfmt+0x599>
+  801de7:	89 c2                	mov    %eax,%edx
+  801de9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ded:	83 c0 08             	add    $0x8,%eax
+  801df0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801df6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dfb:	e9 ce 00 00 00       	jmp    801ece <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e03:	83 f8 2f             	cmp    $0x2f,%eax
+  801e06:	77 19                	ja     801e21 <vprintfmt+0x52f>
+  801e08:	89 c2                	mov    %eax,%edx
+  801e0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e0e:	83 c0 08             	add    $0x8,%eax
+  801e11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e17:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801e1c:	e9 ad 00 00 00       	jmp    801ece <vprintfmt+0x5dc>
+  801e21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e2d:	eb e5                	jmp    801e14 <vprintfmt+0x522>
+    switch (lflag) {
+  801e2f:	83 fa 01             	cmp    $0x1,%edx
+  801e32:	75 a7                	jne    801ddb <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801e34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e37:	83 f8 2f             	cmp    $0x2f,%eax
+  801e3a:	77 41                	ja     801e7d <vprintfmt+0x58b>
+  801e3c:	89 c2                	mov    %eax,%edx
+  801e3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e42:	83 c0 08             	add    $0x8,%eax
+  801e45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801e50:	eb 7c                	jmp    801ece <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e55:	83 f8 2f             	cmp    $0x2f,%eax
+  801e58:	77 15                	ja     801e6f <vprintfmt+0x57d>
+  801e5a:	89 c2                	mov    %eax,%edx
+  801e5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e60:	83 c0 08             	add    $0x8,%eax
+  801e63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e66:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e68:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e6d:	eb 5f                	jmp    801ece <vprintfmt+0x5dc>
+  801e6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e7b:	eb e9                	jmp    801e66 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e89:	eb bd                	jmp    801e48 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e97:	e9 57 ff ff ff       	jmp    801df3 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e9c:	4c 89 ee             	mov    %r13,%rsi
+  801e9f:	bf 30 00 00 00       	mov    $0x30,%edi
+  801ea4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801ea7:	4c 89 ee             	mov    %r13,%rsi
+  801eaa:	bf 78 00 00 00       	mov    $0x78,%edi
+  801eaf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801eb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eb5:	83 f8 2f             	cmp    $0x2f,%eax
+  801eb8:	77 47                	ja     801f01 <vprintfmt+0x60f>
+  801eba:	89 c2                	mov    %eax,%edx
+  801ebc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec0:	83 c0 08             	add    $0x8,%eax
+  801ec3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ec6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ec9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801ece:	48 83 ec 08          	sub    $0x8,%rsp
+  801ed2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801ed6:	0f 94 c0             	sete   %al
+  801ed9:	0f b6 c0             	movzbl %al,%eax
+  801edc:	50                   	push   %rax
+  801edd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801ee2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801ee6:	4c 89 ee             	mov    %r13,%rsi
+  801ee9:	4c 89 f7             	mov    %r14,%rdi
+  801eec:	48 b8 e7 17 80 00 00 	movabs $0x8017e7,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+            break;
+  801ef8:	48 83 c4 10          	add    $0x10,%rsp
+  801efc:	e9 31 fa ff ff       	jmp    801932 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0d:	eb b7                	jmp    801ec6 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801f0f:	40 84 f6             	test   %sil,%sil
+  801f12:	75 2b                	jne    801f3f <vprintfmt+0x64d>
+    switch (lflag) {
+  801f14:	85 d2                	test   %edx,%edx
+  801f16:	7f 56                	jg     801f6e <vprintfmt+0x67c>
+  801f18:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f1b:	7d 77                	jge    801f94 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801f1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f20:	83 f8 2f             	cmp    $0x2f,%eax
+  801f23:	0f 87 a7 00 00 00    	ja     801fd0 <vprintfmt+0x6de>
+  801f29:	89 c2                	mov    %eax,%edx
+  801f2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f2f:	83 c0 08             	add    $0x8,%eax
+  801f32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f38:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f3d:	eb 8f                	jmp    801ece <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f42:	83 f8 2f             	cmp    $0x2f,%eax
+  801f45:	77 19                	ja     801f60 <vprintfmt+0x66e>
+  801f47:	89 c2                	mov    %eax,%edx
+  801f49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f4d:	83 c0 08             	add    $0x8,%eax
+  801f50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f56:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f5b:	e9 6e ff ff ff       	jmp    801ece <vprintfmt+0x5dc>
+  801f60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6c:	eb e5                	jmp    801f53 <vprintfmt+0x661>
+    switch (lflag) {
+  801f6e:	83 fa 01             	cmp    $0x1,%edx
+  801f71:	75 aa                	jne    801f1d <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f76:	83 f8 2f             	cmp    $0x2f,%eax
+  801f79:	77 47                	ja     801fc2 <vprintfmt+0x6d0>
+  801f7b:	89 c2                	mov    %eax,%edx
+  801f7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f81:	83 c0 08             	add    $0x8,%eax
+  801f84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f8f:	e9 3a ff ff ff       	jmp    801ece <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f97:	83 f8 2f             	cmp    $0x2f,%eax
+  801f9a:	77 18                	ja     801fb4 <vprintfmt+0x6c2>
+  801f9c:	89 c2                	mov    %eax,%edx
+  801f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa2:	83 c0 08             	add    $0x8,%eax
+  801fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801faa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801faf:	e9 1a ff ff ff       	jmp    801ece <vprintfmt+0x5dc>
+  801fb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc0:	eb e6                	jmp    801fa8 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801fc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fce:	eb b7                	jmp    801f87 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801fd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fdc:	e9 54 ff ff ff       	jmp    801f35 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801fe1:	4c 89 ee             	mov    %r13,%rsi
+  801fe4:	bf 25 00 00 00       	mov    $0x25,%edi
+  801fe9:	41 ff d6             	call   *%r14
+            break;
+  801fec:	e9 41 f9 ff ff       	jmp    801932 <vprintfmt+0x40>
+            putch('%', put_arg);
+  801ff1:	4c 89 ee             	mov    %r13,%rsi
+  801ff4:	bf 25 00 00 00       	mov    $0x25,%edi
+  801ff9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801ffc:	48 83 eb 01          	sub    $0x1,%rbx
+  802000:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802004:	75 f6                	jne    801ffc <vprintfmt+0x70a>
+  802006:	e9 27 f9 ff ff       	jmp    801932 <vprintfmt+0x40>
+
+000000000080200b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80200b:	55                   	push   %rbp
+  80200c:	48 89 e5             	mov    %rsp,%rbp
+  80200f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802013:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802017:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80201c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802020:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802027:	48 85 ff             	test   %rdi,%rdi
+  80202a:	74 2b                	je     802057 <vsnprintf+0x4c>
+  80202c:	48 85 f6             	test   %rsi,%rsi
+  80202f:	74 26                	je     802057 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802031:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802035:	48 bf 9d 18 80 00 00 	movabs $0x80189d,%rdi
+  80203c:	00 00 00 
+  80203f:	48 b8 f2 18 80 00 00 	movabs $0x8018f2,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80204b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80204f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802052:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802057:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205c:	eb f7                	jmp    802055 <vsnprintf+0x4a>
+
+000000000080205e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80205e:	55                   	push   %rbp
+  80205f:	48 89 e5             	mov    %rsp,%rbp
+  802062:	48 83 ec 50          	sub    $0x50,%rsp
+  802066:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80206a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80206e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802072:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802079:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80207d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802081:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802085:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802089:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80208d:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802099:	c9                   	leave
+  80209a:	c3                   	ret
+
+000000000080209b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80209b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80209e:	74 10                	je     8020b0 <strlen+0x15>
+    size_t n = 0;
+  8020a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8020a5:	48 83 c0 01          	add    $0x1,%rax
+  8020a9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8020ad:	75 f6                	jne    8020a5 <strlen+0xa>
+  8020af:	c3                   	ret
+    size_t n = 0;
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8020b5:	c3                   	ret
+
+00000000008020b6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8020b6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8020b9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8020be:	48 85 f6             	test   %rsi,%rsi
+  8020c1:	74 11                	je     8020d4 <strnlen+0x1e>
+  8020c3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8020c7:	74 0c                	je     8020d5 <strnlen+0x1f>
+  8020c9:	48 83 c2 01          	add    $0x1,%rdx
+  8020cd:	48 39 d0             	cmp    %rdx,%rax
+  8020d0:	75 f1                	jne    8020c3 <strnlen+0xd>
+  8020d2:	eb 04                	jmp    8020d8 <strnlen+0x22>
+  8020d4:	c3                   	ret
+  8020d5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8020d8:	c3                   	ret
+
+00000000008020d9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8020d9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8020e5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8020e8:	48 83 c2 01          	add    $0x1,%rdx
+  8020ec:	84 c9                	test   %cl,%cl
+  8020ee:	75 f1                	jne    8020e1 <strcpy+0x8>
+        ;
+    return res;
+}
+  8020f0:	c3                   	ret
+
+00000000008020f1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8020f1:	55                   	push   %rbp
+  8020f2:	48 89 e5             	mov    %rsp,%rbp
+  8020f5:	41 54                	push   %r12
+  8020f7:	53                   	push   %rbx
+  8020f8:	48 89 fb             	mov    %rdi,%rbx
+  8020fb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8020fe:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  802105:	00 00 00 
+  802108:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80210a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80210e:	4c 89 e6             	mov    %r12,%rsi
+  802111:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+    return dst;
+}
+  80211d:	48 89 d8             	mov    %rbx,%rax
+  802120:	5b                   	pop    %rbx
+  802121:	41 5c                	pop    %r12
+  802123:	5d                   	pop    %rbp
+  802124:	c3                   	ret
+
+0000000000802125 <toupper>:
+
+int
+toupper(int ch) {
+  802125:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802127:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80212a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80212d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802130:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802133:	c3                   	ret
+
+0000000000802134 <tolower>:
+
+int
+tolower(int ch) {
+  802134:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802136:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802139:	8d 57 20             	lea    0x20(%rdi),%edx
+  80213c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80213f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802142:	c3                   	ret
+
+0000000000802143 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802143:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802146:	48 85 d2             	test   %rdx,%rdx
+  802149:	74 1f                	je     80216a <strncpy+0x27>
+  80214b:	48 01 fa             	add    %rdi,%rdx
+  80214e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802151:	48 83 c1 01          	add    $0x1,%rcx
+  802155:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802159:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80215d:	41 80 f8 01          	cmp    $0x1,%r8b
+  802161:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802165:	48 39 ca             	cmp    %rcx,%rdx
+  802168:	75 e7                	jne    802151 <strncpy+0xe>
+    }
+    return ret;
+}
+  80216a:	c3                   	ret
+
+000000000080216b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80216b:	48 89 f8             	mov    %rdi,%rax
+  80216e:	48 85 d2             	test   %rdx,%rdx
+  802171:	74 24                	je     802197 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802173:	48 83 ea 01          	sub    $0x1,%rdx
+  802177:	74 1b                	je     802194 <strlcpy+0x29>
+  802179:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80217d:	0f b6 16             	movzbl (%rsi),%edx
+  802180:	84 d2                	test   %dl,%dl
+  802182:	74 10                	je     802194 <strlcpy+0x29>
+            *dst++ = *src++;
+  802184:	48 83 c6 01          	add    $0x1,%rsi
+  802188:	48 83 c0 01          	add    $0x1,%rax
+  80218c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80218f:	48 39 c8             	cmp    %rcx,%rax
+  802192:	75 e9                	jne    80217d <strlcpy+0x12>
+        *dst = '\0';
+  802194:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802197:	48 29 f8             	sub    %rdi,%rax
+}
+  80219a:	c3                   	ret
+
+000000000080219b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80219b:	0f b6 07             	movzbl (%rdi),%eax
+  80219e:	84 c0                	test   %al,%al
+  8021a0:	74 13                	je     8021b5 <strcmp+0x1a>
+  8021a2:	38 06                	cmp    %al,(%rsi)
+  8021a4:	75 0f                	jne    8021b5 <strcmp+0x1a>
+  8021a6:	48 83 c7 01          	add    $0x1,%rdi
+  8021aa:	48 83 c6 01          	add    $0x1,%rsi
+  8021ae:	0f b6 07             	movzbl (%rdi),%eax
+  8021b1:	84 c0                	test   %al,%al
+  8021b3:	75 ed                	jne    8021a2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021b5:	0f b6 c0             	movzbl %al,%eax
+  8021b8:	0f b6 16             	movzbl (%rsi),%edx
+  8021bb:	29 d0                	sub    %edx,%eax
+}
+  8021bd:	c3                   	ret
+
+00000000008021be <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8021be:	48 85 d2             	test   %rdx,%rdx
+  8021c1:	74 1f                	je     8021e2 <strncmp+0x24>
+  8021c3:	0f b6 07             	movzbl (%rdi),%eax
+  8021c6:	84 c0                	test   %al,%al
+  8021c8:	74 1e                	je     8021e8 <strncmp+0x2a>
+  8021ca:	3a 06                	cmp    (%rsi),%al
+  8021cc:	75 1a                	jne    8021e8 <strncmp+0x2a>
+  8021ce:	48 83 c7 01          	add    $0x1,%rdi
+  8021d2:	48 83 c6 01          	add    $0x1,%rsi
+  8021d6:	48 83 ea 01          	sub    $0x1,%rdx
+  8021da:	75 e7                	jne    8021c3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8021dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e1:	c3                   	ret
+  8021e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e7:	c3                   	ret
+  8021e8:	48 85 d2             	test   %rdx,%rdx
+  8021eb:	74 09                	je     8021f6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8021ed:	0f b6 07             	movzbl (%rdi),%eax
+  8021f0:	0f b6 16             	movzbl (%rsi),%edx
+  8021f3:	29 d0                	sub    %edx,%eax
+  8021f5:	c3                   	ret
+    if (!n) return 0;
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fb:	c3                   	ret
+
+00000000008021fc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8021fc:	0f b6 17             	movzbl (%rdi),%edx
+  8021ff:	84 d2                	test   %dl,%dl
+  802201:	74 18                	je     80221b <strchr+0x1f>
+        if (*str == c) {
+  802203:	0f be d2             	movsbl %dl,%edx
+  802206:	39 f2                	cmp    %esi,%edx
+  802208:	74 17                	je     802221 <strchr+0x25>
+    for (; *str; str++) {
+  80220a:	48 83 c7 01          	add    $0x1,%rdi
+  80220e:	0f b6 17             	movzbl (%rdi),%edx
+  802211:	84 d2                	test   %dl,%dl
+  802213:	75 ee                	jne    802203 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221a:	c3                   	ret
+  80221b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802220:	c3                   	ret
+  802221:	48 89 f8             	mov    %rdi,%rax
+}
+  802224:	c3                   	ret
+
+0000000000802225 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802225:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802228:	0f b6 17             	movzbl (%rdi),%edx
+  80222b:	84 d2                	test   %dl,%dl
+  80222d:	74 13                	je     802242 <strfind+0x1d>
+  80222f:	0f be d2             	movsbl %dl,%edx
+  802232:	39 f2                	cmp    %esi,%edx
+  802234:	74 0b                	je     802241 <strfind+0x1c>
+  802236:	48 83 c0 01          	add    $0x1,%rax
+  80223a:	0f b6 10             	movzbl (%rax),%edx
+  80223d:	84 d2                	test   %dl,%dl
+  80223f:	75 ee                	jne    80222f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802241:	c3                   	ret
+  802242:	c3                   	ret
+
+0000000000802243 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802243:	48 39 f7             	cmp    %rsi,%rdi
+  802246:	74 65                	je     8022ad <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802248:	55                   	push   %rbp
+  802249:	48 89 e5             	mov    %rsp,%rbp
+  80224c:	41 57                	push   %r15
+  80224e:	41 56                	push   %r14
+  802250:	41 55                	push   %r13
+  802252:	41 54                	push   %r12
+  802254:	53                   	push   %rbx
+  802255:	48 83 ec 18          	sub    $0x18,%rsp
+  802259:	48 89 fb             	mov    %rdi,%rbx
+  80225c:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80225f:	49 bf 34 21 80 00 00 	movabs $0x802134,%r15
+  802266:	00 00 00 
+  802269:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80226d:	41 0f b6 fd          	movzbl %r13b,%edi
+  802271:	41 ff d7             	call   *%r15
+  802274:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802277:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80227c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802280:	41 ff d7             	call   *%r15
+  802283:	89 c2                	mov    %eax,%edx
+  802285:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802288:	29 d0                	sub    %edx,%eax
+  80228a:	75 12                	jne    80229e <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80228c:	48 83 c3 01          	add    $0x1,%rbx
+  802290:	45 84 ed             	test   %r13b,%r13b
+  802293:	74 09                	je     80229e <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802295:	49 83 c4 01          	add    $0x1,%r12
+  802299:	45 84 f6             	test   %r14b,%r14b
+  80229c:	75 cb                	jne    802269 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80229e:	48 83 c4 18          	add    $0x18,%rsp
+  8022a2:	5b                   	pop    %rbx
+  8022a3:	41 5c                	pop    %r12
+  8022a5:	41 5d                	pop    %r13
+  8022a7:	41 5e                	pop    %r14
+  8022a9:	41 5f                	pop    %r15
+  8022ab:	5d                   	pop    %rbp
+  8022ac:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b2:	c3                   	ret
+
+00000000008022b3 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022b3:	48 39 f7             	cmp    %rsi,%rdi
+  8022b6:	74 7d                	je     802335 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8022b8:	55                   	push   %rbp
+  8022b9:	48 89 e5             	mov    %rsp,%rbp
+  8022bc:	41 57                	push   %r15
+  8022be:	41 56                	push   %r14
+  8022c0:	41 55                	push   %r13
+  8022c2:	41 54                	push   %r12
+  8022c4:	53                   	push   %rbx
+  8022c5:	48 83 ec 18          	sub    $0x18,%rsp
+  8022c9:	48 89 fb             	mov    %rdi,%rbx
+  8022cc:	49 89 f4             	mov    %rsi,%r12
+  8022cf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8022d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022d7:	49 bf 34 21 80 00 00 	movabs $0x802134,%r15
+  8022de:	00 00 00 
+    while (n--) {
+  8022e1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8022e5:	48 39 c3             	cmp    %rax,%rbx
+  8022e8:	74 37                	je     802321 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8022ea:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8022ee:	41 0f b6 fd          	movzbl %r13b,%edi
+  8022f2:	41 ff d7             	call   *%r15
+  8022f5:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8022f8:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8022fd:	41 0f b6 fe          	movzbl %r14b,%edi
+  802301:	41 ff d7             	call   *%r15
+  802304:	89 c2                	mov    %eax,%edx
+  802306:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802309:	29 d0                	sub    %edx,%eax
+  80230b:	75 19                	jne    802326 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80230d:	48 83 c3 01          	add    $0x1,%rbx
+  802311:	45 84 ed             	test   %r13b,%r13b
+  802314:	74 10                	je     802326 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802316:	49 83 c4 01          	add    $0x1,%r12
+  80231a:	45 84 f6             	test   %r14b,%r14b
+  80231d:	75 c2                	jne    8022e1 <strncasecmp+0x2e>
+  80231f:	eb 05                	jmp    802326 <strncasecmp+0x73>
+  802321:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802326:	48 83 c4 18          	add    $0x18,%rsp
+  80232a:	5b                   	pop    %rbx
+  80232b:	41 5c                	pop    %r12
+  80232d:	41 5d                	pop    %r13
+  80232f:	41 5e                	pop    %r14
+  802331:	41 5f                	pop    %r15
+  802333:	5d                   	pop    %rbp
+  802334:	c3                   	ret
+    if (p1 == p2) return 0;
+  802335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80233a:	c3                   	ret
+
+000000000080233b <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  80233b:	83 e7 df             	and    $0xffffffdf,%edi
+  80233e:	83 ef 41             	sub    $0x41,%edi
+  802341:	83 ff 19             	cmp    $0x19,%edi
+  802344:	0f 96 c0             	setbe  %al
+}
+  802347:	c3                   	ret
+
+0000000000802348 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802348:	83 ff 20             	cmp    $0x20,%edi
+  80234b:	0f 94 c0             	sete   %al
+  80234e:	83 ff 09             	cmp    $0x9,%edi
+  802351:	0f 94 c2             	sete   %dl
+  802354:	09 d0                	or     %edx,%eax
+}
+  802356:	c3                   	ret
+
+0000000000802357 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80235d:	48 bf ff 6a 80 00 00 	movabs $0x806aff,%rdi
+  802364:	00 00 00 
+  802367:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+  802373:	48 85 c0             	test   %rax,%rax
+  802376:	0f 95 c0             	setne  %al
+}
+  802379:	5d                   	pop    %rbp
+  80237a:	c3                   	ret
+
+000000000080237b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80237b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80237e:	48 89 f8             	mov    %rdi,%rax
+  802381:	48 f7 d8             	neg    %rax
+  802384:	83 e0 07             	and    $0x7,%eax
+  802387:	49 89 d1             	mov    %rdx,%r9
+  80238a:	49 29 c1             	sub    %rax,%r9
+  80238d:	78 36                	js     8023c5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80238f:	40 0f b6 c6          	movzbl %sil,%eax
+  802393:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80239a:	01 01 01 
+  80239d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8023a1:	40 f6 c7 07          	test   $0x7,%dil
+  8023a5:	75 38                	jne    8023df <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8023a7:	4c 89 c9             	mov    %r9,%rcx
+  8023aa:	48 c1 f9 03          	sar    $0x3,%rcx
+  8023ae:	74 0c                	je     8023bc <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8023b0:	fc                   	cld
+  8023b1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8023b4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8023b8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8023bc:	4d 85 c9             	test   %r9,%r9
+  8023bf:	75 45                	jne    802406 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8023c1:	4c 89 c0             	mov    %r8,%rax
+  8023c4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8023c5:	48 85 d2             	test   %rdx,%rdx
+  8023c8:	74 f7                	je     8023c1 <memset+0x46>
+  8023ca:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8023cd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8023d0:	48 83 c0 01          	add    $0x1,%rax
+  8023d4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8023d8:	48 39 c2             	cmp    %rax,%rdx
+  8023db:	75 f3                	jne    8023d0 <memset+0x55>
+  8023dd:	eb e2                	jmp    8023c1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8023df:	40 f6 c7 01          	test   $0x1,%dil
+  8023e3:	74 06                	je     8023eb <memset+0x70>
+  8023e5:	88 07                	mov    %al,(%rdi)
+  8023e7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023eb:	40 f6 c7 02          	test   $0x2,%dil
+  8023ef:	74 07                	je     8023f8 <memset+0x7d>
+  8023f1:	66 89 07             	mov    %ax,(%rdi)
+  8023f4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023f8:	40 f6 c7 04          	test   $0x4,%dil
+  8023fc:	74 a9                	je     8023a7 <memset+0x2c>
+  8023fe:	89 07                	mov    %eax,(%rdi)
+  802400:	48 83 c7 04          	add    $0x4,%rdi
+  802404:	eb a1                	jmp    8023a7 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802406:	41 f6 c1 04          	test   $0x4,%r9b
+  80240a:	74 06                	je     802412 <memset+0x97>
+  80240c:	89 07                	mov    %eax,(%rdi)
+  80240e:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802412:	41 f6 c1 02          	test   $0x2,%r9b
+  802416:	74 07                	je     80241f <memset+0xa4>
+  802418:	66 89 07             	mov    %ax,(%rdi)
+  80241b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80241f:	41 f6 c1 01          	test   $0x1,%r9b
+  802423:	74 9c                	je     8023c1 <memset+0x46>
+  802425:	88 07                	mov    %al,(%rdi)
+  802427:	eb 98                	jmp    8023c1 <memset+0x46>
+
+0000000000802429 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802429:	48 89 f8             	mov    %rdi,%rax
+  80242c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80242f:	48 39 fe             	cmp    %rdi,%rsi
+  802432:	73 3b                	jae    80246f <memmove+0x46>
+  802434:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802438:	48 39 d7             	cmp    %rdx,%rdi
+  80243b:	73 32                	jae    80246f <memmove+0x46>
+        s += n;
+        d += n;
+  80243d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802441:	48 89 d6             	mov    %rdx,%rsi
+  802444:	48 09 fe             	or     %rdi,%rsi
+  802447:	48 09 ce             	or     %rcx,%rsi
+  80244a:	40 f6 c6 07          	test   $0x7,%sil
+  80244e:	75 12                	jne    802462 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802450:	48 83 ef 08          	sub    $0x8,%rdi
+  802454:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802458:	48 c1 e9 03          	shr    $0x3,%rcx
+  80245c:	fd                   	std
+  80245d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802460:	fc                   	cld
+  802461:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802462:	48 83 ef 01          	sub    $0x1,%rdi
+  802466:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80246a:	fd                   	std
+  80246b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80246d:	eb f1                	jmp    802460 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80246f:	48 89 f2             	mov    %rsi,%rdx
+  802472:	48 09 c2             	or     %rax,%rdx
+  802475:	48 09 ca             	or     %rcx,%rdx
+  802478:	f6 c2 07             	test   $0x7,%dl
+  80247b:	75 0c                	jne    802489 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80247d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802481:	48 89 c7             	mov    %rax,%rdi
+  802484:	fc                   	cld
+  802485:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802488:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802489:	48 89 c7             	mov    %rax,%rdi
+  80248c:	fc                   	cld
+  80248d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80248f:	c3                   	ret
+
+0000000000802490 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802490:	55                   	push   %rbp
+  802491:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802494:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+}
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+
+00000000008024a2 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8024a2:	55                   	push   %rbp
+  8024a3:	48 89 e5             	mov    %rsp,%rbp
+  8024a6:	41 57                	push   %r15
+  8024a8:	41 56                	push   %r14
+  8024aa:	41 55                	push   %r13
+  8024ac:	41 54                	push   %r12
+  8024ae:	53                   	push   %rbx
+  8024af:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b3:	49 89 fe             	mov    %rdi,%r14
+  8024b6:	49 89 f7             	mov    %rsi,%r15
+  8024b9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8024bc:	48 89 f7             	mov    %rsi,%rdi
+  8024bf:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8024ce:	48 89 de             	mov    %rbx,%rsi
+  8024d1:	4c 89 f7             	mov    %r14,%rdi
+  8024d4:	48 b8 b6 20 80 00 00 	movabs $0x8020b6,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+  8024e0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024e3:	48 39 c3             	cmp    %rax,%rbx
+  8024e6:	74 36                	je     80251e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8024e8:	48 89 d8             	mov    %rbx,%rax
+  8024eb:	4c 29 e8             	sub    %r13,%rax
+  8024ee:	49 39 c4             	cmp    %rax,%r12
+  8024f1:	73 31                	jae    802524 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8024f3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8024f8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024fc:	4c 89 fe             	mov    %r15,%rsi
+  8024ff:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80250b:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80250f:	48 83 c4 08          	add    $0x8,%rsp
+  802513:	5b                   	pop    %rbx
+  802514:	41 5c                	pop    %r12
+  802516:	41 5d                	pop    %r13
+  802518:	41 5e                	pop    %r14
+  80251a:	41 5f                	pop    %r15
+  80251c:	5d                   	pop    %rbp
+  80251d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80251e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802522:	eb eb                	jmp    80250f <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802524:	48 83 eb 01          	sub    $0x1,%rbx
+  802528:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80252c:	48 89 da             	mov    %rbx,%rdx
+  80252f:	4c 89 fe             	mov    %r15,%rsi
+  802532:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  802539:	00 00 00 
+  80253c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80253e:	49 01 de             	add    %rbx,%r14
+  802541:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802546:	eb c3                	jmp    80250b <strlcat+0x69>
+
+0000000000802548 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802548:	48 85 d2             	test   %rdx,%rdx
+  80254b:	74 2d                	je     80257a <memcmp+0x32>
+  80254d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802552:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802556:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80255b:	44 38 c1             	cmp    %r8b,%cl
+  80255e:	75 0f                	jne    80256f <memcmp+0x27>
+    while (n-- > 0) {
+  802560:	48 83 c0 01          	add    $0x1,%rax
+  802564:	48 39 c2             	cmp    %rax,%rdx
+  802567:	75 e9                	jne    802552 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80256f:	0f b6 c1             	movzbl %cl,%eax
+  802572:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802576:	44 29 c0             	sub    %r8d,%eax
+  802579:	c3                   	ret
+    return 0;
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257f:	c3                   	ret
+
+0000000000802580 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802580:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802584:	48 39 c7             	cmp    %rax,%rdi
+  802587:	73 0f                	jae    802598 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802589:	40 38 37             	cmp    %sil,(%rdi)
+  80258c:	74 0e                	je     80259c <memfind+0x1c>
+    for (; src < end; src++) {
+  80258e:	48 83 c7 01          	add    $0x1,%rdi
+  802592:	48 39 f8             	cmp    %rdi,%rax
+  802595:	75 f2                	jne    802589 <memfind+0x9>
+  802597:	c3                   	ret
+  802598:	48 89 f8             	mov    %rdi,%rax
+  80259b:	c3                   	ret
+  80259c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80259f:	c3                   	ret
+
+00000000008025a0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8025a0:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8025a3:	0f b6 37             	movzbl (%rdi),%esi
+  8025a6:	40 80 fe 20          	cmp    $0x20,%sil
+  8025aa:	74 06                	je     8025b2 <strtol+0x12>
+  8025ac:	40 80 fe 09          	cmp    $0x9,%sil
+  8025b0:	75 13                	jne    8025c5 <strtol+0x25>
+  8025b2:	48 83 c7 01          	add    $0x1,%rdi
+  8025b6:	0f b6 37             	movzbl (%rdi),%esi
+  8025b9:	40 80 fe 20          	cmp    $0x20,%sil
+  8025bd:	74 f3                	je     8025b2 <strtol+0x12>
+  8025bf:	40 80 fe 09          	cmp    $0x9,%sil
+  8025c3:	74 ed                	je     8025b2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8025c5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8025c8:	83 e0 fd             	and    $0xfffffffd,%eax
+  8025cb:	3c 01                	cmp    $0x1,%al
+  8025cd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025d1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8025d7:	75 0f                	jne    8025e8 <strtol+0x48>
+  8025d9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8025dc:	74 14                	je     8025f2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8025de:	85 d2                	test   %edx,%edx
+  8025e0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025e5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8025e8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8025ed:	4c 63 ca             	movslq %edx,%r9
+  8025f0:	eb 36                	jmp    802628 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8025f2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8025f6:	74 0f                	je     802607 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8025f8:	85 d2                	test   %edx,%edx
+  8025fa:	75 ec                	jne    8025e8 <strtol+0x48>
+        s++;
+  8025fc:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802600:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802605:	eb e1                	jmp    8025e8 <strtol+0x48>
+        s += 2;
+  802607:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80260b:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802610:	eb d6                	jmp    8025e8 <strtol+0x48>
+            dig -= '0';
+  802612:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802615:	44 0f b6 c1          	movzbl %cl,%r8d
+  802619:	41 39 d0             	cmp    %edx,%r8d
+  80261c:	7d 21                	jge    80263f <strtol+0x9f>
+        val = val * base + dig;
+  80261e:	49 0f af c1          	imul   %r9,%rax
+  802622:	0f b6 c9             	movzbl %cl,%ecx
+  802625:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802628:	48 83 c7 01          	add    $0x1,%rdi
+  80262c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802630:	80 f9 39             	cmp    $0x39,%cl
+  802633:	76 dd                	jbe    802612 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802635:	80 f9 7b             	cmp    $0x7b,%cl
+  802638:	77 05                	ja     80263f <strtol+0x9f>
+            dig -= 'a' - 10;
+  80263a:	83 e9 57             	sub    $0x57,%ecx
+  80263d:	eb d6                	jmp    802615 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80263f:	4d 85 d2             	test   %r10,%r10
+  802642:	74 03                	je     802647 <strtol+0xa7>
+  802644:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802647:	48 89 c2             	mov    %rax,%rdx
+  80264a:	48 f7 da             	neg    %rdx
+  80264d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802651:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802655:	c3                   	ret
+
+0000000000802656 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802656:	55                   	push   %rbp
+  802657:	48 89 e5             	mov    %rsp,%rbp
+  80265a:	53                   	push   %rbx
+  80265b:	48 89 fa             	mov    %rdi,%rdx
+  80265e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802661:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802666:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80266b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802670:	be 00 00 00 00       	mov    $0x0,%esi
+  802675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80267b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802681:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802683:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802687:	c9                   	leave
+  802688:	c3                   	ret
+
+0000000000802689 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802689:	55                   	push   %rbp
+  80268a:	48 89 e5             	mov    %rsp,%rbp
+  80268d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80268e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802693:	ba 00 00 00 00       	mov    $0x0,%edx
+  802698:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80269d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026a2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026b8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8026ba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+00000000008026c0 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8026c0:	55                   	push   %rbp
+  8026c1:	48 89 e5             	mov    %rsp,%rbp
+  8026c4:	53                   	push   %rbx
+  8026c5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8026c8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026ed:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8026ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026f3:	c9                   	leave
+  8026f4:	c3                   	ret
+
+00000000008026f5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8026f5:	55                   	push   %rbp
+  8026f6:	48 89 e5             	mov    %rsp,%rbp
+  8026f9:	53                   	push   %rbx
+  8026fa:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8026fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802701:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802706:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80270b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802710:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802715:	be 00 00 00 00       	mov    $0x0,%esi
+  80271a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802720:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802726:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802728:	48 85 c0             	test   %rax,%rax
+  80272b:	7f 06                	jg     802733 <sys_env_destroy+0x3e>
+}
+  80272d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802731:	c9                   	leave
+  802732:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802733:	49 89 c0             	mov    %rax,%r8
+  802736:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80273b:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802742:	00 00 00 
+  802745:	be 27 00 00 00       	mov    $0x27,%esi
+  80274a:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802751:	00 00 00 
+  802754:	b8 00 00 00 00       	mov    $0x0,%eax
+  802759:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802760:	00 00 00 
+  802763:	41 ff d1             	call   *%r9
+
+0000000000802766 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802766:	55                   	push   %rbp
+  802767:	48 89 e5             	mov    %rsp,%rbp
+  80276a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80276b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802770:	ba 00 00 00 00       	mov    $0x0,%edx
+  802775:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80277a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80277f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802784:	be 00 00 00 00       	mov    $0x0,%esi
+  802789:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80278f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802795:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802797:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80279b:	c9                   	leave
+  80279c:	c3                   	ret
+
+000000000080279d <sys_yield>:
+
+void
+sys_yield(void) {
+  80279d:	55                   	push   %rbp
+  80279e:	48 89 e5             	mov    %rsp,%rbp
+  8027a1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8027a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027cc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8027ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d2:	c9                   	leave
+  8027d3:	c3                   	ret
+
+00000000008027d4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8027d4:	55                   	push   %rbp
+  8027d5:	48 89 e5             	mov    %rsp,%rbp
+  8027d8:	53                   	push   %rbx
+  8027d9:	48 89 fa             	mov    %rdi,%rdx
+  8027dc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8027df:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027e4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8027eb:	00 00 00 
+  8027ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802804:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802806:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80280a:	c9                   	leave
+  80280b:	c3                   	ret
+
+000000000080280c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80280c:	55                   	push   %rbp
+  80280d:	48 89 e5             	mov    %rsp,%rbp
+  802810:	53                   	push   %rbx
+  802811:	49 89 f8             	mov    %rdi,%r8
+  802814:	48 89 d3             	mov    %rdx,%rbx
+  802817:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80281a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80281f:	4c 89 c2             	mov    %r8,%rdx
+  802822:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802825:	be 00 00 00 00       	mov    $0x0,%esi
+  80282a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802830:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802836:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802838:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+
+000000000080283e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80283e:	55                   	push   %rbp
+  80283f:	48 89 e5             	mov    %rsp,%rbp
+  802842:	53                   	push   %rbx
+  802843:	48 83 ec 08          	sub    $0x8,%rsp
+  802847:	89 f8                	mov    %edi,%eax
+  802849:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  80284c:	48 63 f9             	movslq %ecx,%rdi
+  80284f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802852:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802857:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80285a:	be 00 00 00 00       	mov    $0x0,%esi
+  80285f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802865:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80286b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80286d:	48 85 c0             	test   %rax,%rax
+  802870:	7f 06                	jg     802878 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802872:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802876:	c9                   	leave
+  802877:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802878:	49 89 c0             	mov    %rax,%r8
+  80287b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802880:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802887:	00 00 00 
+  80288a:	be 27 00 00 00       	mov    $0x27,%esi
+  80288f:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802896:	00 00 00 
+  802899:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289e:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  8028a5:	00 00 00 
+  8028a8:	41 ff d1             	call   *%r9
+
+00000000008028ab <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8028ab:	55                   	push   %rbp
+  8028ac:	48 89 e5             	mov    %rsp,%rbp
+  8028af:	53                   	push   %rbx
+  8028b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b4:	89 f8                	mov    %edi,%eax
+  8028b6:	49 89 f2             	mov    %rsi,%r10
+  8028b9:	48 89 cf             	mov    %rcx,%rdi
+  8028bc:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8028bf:	48 63 da             	movslq %edx,%rbx
+  8028c2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028ca:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028cd:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8028d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028d8:	48 85 c0             	test   %rax,%rax
+  8028db:	7f 06                	jg     8028e3 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8028dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028e1:	c9                   	leave
+  8028e2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028e3:	49 89 c0             	mov    %rax,%r8
+  8028e6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028eb:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  8028f2:	00 00 00 
+  8028f5:	be 27 00 00 00       	mov    $0x27,%esi
+  8028fa:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802901:	00 00 00 
+  802904:	b8 00 00 00 00       	mov    $0x0,%eax
+  802909:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802910:	00 00 00 
+  802913:	41 ff d1             	call   *%r9
+
+0000000000802916 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802916:	55                   	push   %rbp
+  802917:	48 89 e5             	mov    %rsp,%rbp
+  80291a:	53                   	push   %rbx
+  80291b:	48 83 ec 08          	sub    $0x8,%rsp
+  80291f:	48 89 f1             	mov    %rsi,%rcx
+  802922:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802925:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802928:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80292d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802932:	be 00 00 00 00       	mov    $0x0,%esi
+  802937:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80293d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802943:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802945:	48 85 c0             	test   %rax,%rax
+  802948:	7f 06                	jg     802950 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80294a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80294e:	c9                   	leave
+  80294f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802950:	49 89 c0             	mov    %rax,%r8
+  802953:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802958:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  80295f:	00 00 00 
+  802962:	be 27 00 00 00       	mov    $0x27,%esi
+  802967:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  80296e:	00 00 00 
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  80297d:	00 00 00 
+  802980:	41 ff d1             	call   *%r9
+
+0000000000802983 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802983:	55                   	push   %rbp
+  802984:	48 89 e5             	mov    %rsp,%rbp
+  802987:	53                   	push   %rbx
+  802988:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80298c:	48 63 ce             	movslq %esi,%rcx
+  80298f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802992:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802997:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80299c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029b4:	48 85 c0             	test   %rax,%rax
+  8029b7:	7f 06                	jg     8029bf <sys_env_set_status+0x3c>
+}
+  8029b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029bd:	c9                   	leave
+  8029be:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029bf:	49 89 c0             	mov    %rax,%r8
+  8029c2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8029c7:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  8029ce:	00 00 00 
+  8029d1:	be 27 00 00 00       	mov    $0x27,%esi
+  8029d6:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  8029dd:	00 00 00 
+  8029e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e5:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  8029ec:	00 00 00 
+  8029ef:	41 ff d1             	call   *%r9
+
+00000000008029f2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	53                   	push   %rbx
+  8029f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8029fe:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a01:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a10:	be 00 00 00 00       	mov    $0x0,%esi
+  802a15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a21:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a23:	48 85 c0             	test   %rax,%rax
+  802a26:	7f 06                	jg     802a2e <sys_env_set_trapframe+0x3c>
+}
+  802a28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a2c:	c9                   	leave
+  802a2d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a2e:	49 89 c0             	mov    %rax,%r8
+  802a31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802a36:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802a3d:	00 00 00 
+  802a40:	be 27 00 00 00       	mov    $0x27,%esi
+  802a45:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802a4c:	00 00 00 
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a54:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802a5b:	00 00 00 
+  802a5e:	41 ff d1             	call   *%r9
+
+0000000000802a61 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802a61:	55                   	push   %rbp
+  802a62:	48 89 e5             	mov    %rsp,%rbp
+  802a65:	53                   	push   %rbx
+  802a66:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a6d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a70:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a75:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a7a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a84:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a8a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a90:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a92:	48 85 c0             	test   %rax,%rax
+  802a95:	7f 06                	jg     802a9d <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9b:	c9                   	leave
+  802a9c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a9d:	49 89 c0             	mov    %rax,%r8
+  802aa0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802aa5:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802aac:	00 00 00 
+  802aaf:	be 27 00 00 00       	mov    $0x27,%esi
+  802ab4:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802abb:	00 00 00 
+  802abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac3:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802aca:	00 00 00 
+  802acd:	41 ff d1             	call   *%r9
+
+0000000000802ad0 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802ad0:	55                   	push   %rbp
+  802ad1:	48 89 e5             	mov    %rsp,%rbp
+  802ad4:	53                   	push   %rbx
+  802ad5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802ad9:	40 0f b6 ce          	movzbl %sil,%ecx
+  802add:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ae0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ae5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aef:	be 00 00 00 00       	mov    $0x0,%esi
+  802af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802afa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b00:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b02:	48 85 c0             	test   %rax,%rax
+  802b05:	7f 06                	jg     802b0d <sys_env_set_reclaim+0x3d>
+}
+  802b07:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b0b:	c9                   	leave
+  802b0c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b0d:	49 89 c0             	mov    %rax,%r8
+  802b10:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802b15:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802b1c:	00 00 00 
+  802b1f:	be 27 00 00 00       	mov    $0x27,%esi
+  802b24:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802b2b:	00 00 00 
+  802b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b33:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802b3a:	00 00 00 
+  802b3d:	41 ff d1             	call   *%r9
+
+0000000000802b40 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802b40:	55                   	push   %rbp
+  802b41:	48 89 e5             	mov    %rsp,%rbp
+  802b44:	53                   	push   %rbx
+  802b45:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802b49:	48 63 ce             	movslq %esi,%rcx
+  802b4c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b4f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b59:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802b63:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b69:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b6f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b71:	48 85 c0             	test   %rax,%rax
+  802b74:	7f 06                	jg     802b7c <sys_env_set_nice+0x3c>
+}
+  802b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7c:	49 89 c0             	mov    %rax,%r8
+  802b7f:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b84:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802b8b:	00 00 00 
+  802b8e:	be 27 00 00 00       	mov    $0x27,%esi
+  802b93:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802b9a:	00 00 00 
+  802b9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba2:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802ba9:	00 00 00 
+  802bac:	41 ff d1             	call   *%r9
+
+0000000000802baf <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802baf:	55                   	push   %rbp
+  802bb0:	48 89 e5             	mov    %rsp,%rbp
+  802bb3:	53                   	push   %rbx
+  802bb4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bb7:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bc6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bcb:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bd6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bdc:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802bde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be2:	c9                   	leave
+  802be3:	c3                   	ret
+
+0000000000802be4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802be4:	55                   	push   %rbp
+  802be5:	48 89 e5             	mov    %rsp,%rbp
+  802be8:	53                   	push   %rbx
+  802be9:	89 f8                	mov    %edi,%eax
+  802beb:	49 89 f1             	mov    %rsi,%r9
+  802bee:	48 89 d3             	mov    %rdx,%rbx
+  802bf1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bf4:	49 63 f0             	movslq %r8d,%rsi
+  802bf7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bfa:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bff:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c02:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c0e:	cd 30                	int    $0x30
+}
+  802c10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+
+0000000000802c16 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c16:	55                   	push   %rbp
+  802c17:	48 89 e5             	mov    %rsp,%rbp
+  802c1a:	53                   	push   %rbx
+  802c1b:	89 f8                	mov    %edi,%eax
+  802c1d:	49 89 f1             	mov    %rsi,%r9
+  802c20:	48 89 d3             	mov    %rdx,%rbx
+  802c23:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c26:	49 63 f0             	movslq %r8d,%rsi
+  802c29:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c2c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c31:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c40:	cd 30                	int    $0x30
+}
+  802c42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c46:	c9                   	leave
+  802c47:	c3                   	ret
+
+0000000000802c48 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802c48:	55                   	push   %rbp
+  802c49:	48 89 e5             	mov    %rsp,%rbp
+  802c4c:	53                   	push   %rbx
+  802c4d:	48 83 ec 08          	sub    $0x8,%rsp
+  802c51:	89 f8                	mov    %edi,%eax
+  802c53:	49 89 f2             	mov    %rsi,%r10
+  802c56:	48 89 d3             	mov    %rdx,%rbx
+  802c59:	48 89 cf             	mov    %rcx,%rdi
+  802c5c:	44 89 c6             	mov    %r8d,%esi
+  802c5f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802c62:	48 63 f6             	movslq %esi,%rsi
+  802c65:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c68:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c6d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c70:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c74:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c76:	48 85 c0             	test   %rax,%rax
+  802c79:	7f 06                	jg     802c81 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c7b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c81:	49 89 c0             	mov    %rax,%r8
+  802c84:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c89:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802c90:	00 00 00 
+  802c93:	be 27 00 00 00       	mov    $0x27,%esi
+  802c98:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802c9f:	00 00 00 
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802cae:	00 00 00 
+  802cb1:	41 ff d1             	call   *%r9
+
+0000000000802cb4 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802cb4:	55                   	push   %rbp
+  802cb5:	48 89 e5             	mov    %rsp,%rbp
+  802cb8:	53                   	push   %rbx
+  802cb9:	48 83 ec 08          	sub    $0x8,%rsp
+  802cbd:	48 89 f1             	mov    %rsi,%rcx
+  802cc0:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802cc3:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802cc7:	48 8b 1a             	mov    (%rdx),%rbx
+  802cca:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ccd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cd2:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd6:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802cda:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802cde:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ce0:	48 85 c0             	test   %rax,%rax
+  802ce3:	7f 06                	jg     802ceb <sys_ipc_call_short+0x37>
+}
+  802ce5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce9:	c9                   	leave
+  802cea:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ceb:	49 89 c0             	mov    %rax,%r8
+  802cee:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802cf3:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802cfa:	00 00 00 
+  802cfd:	be 27 00 00 00       	mov    $0x27,%esi
+  802d02:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802d09:	00 00 00 
+  802d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d11:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802d18:	00 00 00 
+  802d1b:	41 ff d1             	call   *%r9
+
+0000000000802d1e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802d1e:	55                   	push   %rbp
+  802d1f:	48 89 e5             	mov    %rsp,%rbp
+  802d22:	53                   	push   %rbx
+  802d23:	48 83 ec 08          	sub    $0x8,%rsp
+  802d27:	89 f8                	mov    %edi,%eax
+  802d29:	49 89 f2             	mov    %rsi,%r10
+  802d2c:	48 89 d3             	mov    %rdx,%rbx
+  802d2f:	48 89 cf             	mov    %rcx,%rdi
+  802d32:	44 89 c6             	mov    %r8d,%esi
+  802d35:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d38:	48 63 f6             	movslq %esi,%rsi
+  802d3b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d3e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d43:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d46:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d4a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d4c:	48 85 c0             	test   %rax,%rax
+  802d4f:	7f 06                	jg     802d57 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d51:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d57:	49 89 c0             	mov    %rax,%r8
+  802d5a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802d5f:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802d66:	00 00 00 
+  802d69:	be 27 00 00 00       	mov    $0x27,%esi
+  802d6e:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802d75:	00 00 00 
+  802d78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d7d:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802d84:	00 00 00 
+  802d87:	41 ff d1             	call   *%r9
+
+0000000000802d8a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d8a:	55                   	push   %rbp
+  802d8b:	48 89 e5             	mov    %rsp,%rbp
+  802d8e:	53                   	push   %rbx
+  802d8f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d93:	48 89 fa             	mov    %rdi,%rdx
+  802d96:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d99:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da8:	be 00 00 00 00       	mov    $0x0,%esi
+  802dad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802db3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dbb:	48 85 c0             	test   %rax,%rax
+  802dbe:	7f 06                	jg     802dc6 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802dc0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc4:	c9                   	leave
+  802dc5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dc6:	49 89 c0             	mov    %rax,%r8
+  802dc9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802dce:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  802dd5:	00 00 00 
+  802dd8:	be 27 00 00 00       	mov    $0x27,%esi
+  802ddd:	48 bf 27 6b 80 00 00 	movabs $0x806b27,%rdi
+  802de4:	00 00 00 
+  802de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dec:	49 b9 52 16 80 00 00 	movabs $0x801652,%r9
+  802df3:	00 00 00 
+  802df6:	41 ff d1             	call   *%r9
+
+0000000000802df9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802df9:	55                   	push   %rbp
+  802dfa:	48 89 e5             	mov    %rsp,%rbp
+  802dfd:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802dfe:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e08:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e17:	be 00 00 00 00       	mov    $0x0,%esi
+  802e1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e28:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e2a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2e:	c9                   	leave
+  802e2f:	c3                   	ret
+
+0000000000802e30 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802e30:	55                   	push   %rbp
+  802e31:	48 89 e5             	mov    %rsp,%rbp
+  802e34:	53                   	push   %rbx
+  802e35:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e38:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e5d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802e5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e63:	c9                   	leave
+  802e64:	c3                   	ret
+
+0000000000802e65 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e65:	55                   	push   %rbp
+  802e66:	48 89 e5             	mov    %rsp,%rbp
+  802e69:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e6a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e74:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e83:	be 00 00 00 00       	mov    $0x0,%esi
+  802e88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e94:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e9a:	c9                   	leave
+  802e9b:	c3                   	ret
+
+0000000000802e9c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e9c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802ea3:	ff ff ff 
+  802ea6:	48 01 f8             	add    %rdi,%rax
+  802ea9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802ead:	c3                   	ret
+
+0000000000802eae <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802eae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802eb5:	ff ff ff 
+  802eb8:	48 01 f8             	add    %rdi,%rax
+  802ebb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802ebf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802ec5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802ec9:	c3                   	ret
+
+0000000000802eca <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802eca:	55                   	push   %rbp
+  802ecb:	48 89 e5             	mov    %rsp,%rbp
+  802ece:	41 57                	push   %r15
+  802ed0:	41 56                	push   %r14
+  802ed2:	41 55                	push   %r13
+  802ed4:	41 54                	push   %r12
+  802ed6:	53                   	push   %rbx
+  802ed7:	48 83 ec 08          	sub    $0x8,%rsp
+  802edb:	49 89 ff             	mov    %rdi,%r15
+  802ede:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802ee3:	49 bd a5 4c 80 00 00 	movabs $0x804ca5,%r13
+  802eea:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802eed:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802ef3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802ef6:	48 89 df             	mov    %rbx,%rdi
+  802ef9:	41 ff d5             	call   *%r13
+  802efc:	83 e0 04             	and    $0x4,%eax
+  802eff:	74 17                	je     802f18 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802f01:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f08:	4c 39 f3             	cmp    %r14,%rbx
+  802f0b:	75 e6                	jne    802ef3 <fd_alloc+0x29>
+  802f0d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802f13:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802f18:	4d 89 27             	mov    %r12,(%r15)
+}
+  802f1b:	48 83 c4 08          	add    $0x8,%rsp
+  802f1f:	5b                   	pop    %rbx
+  802f20:	41 5c                	pop    %r12
+  802f22:	41 5d                	pop    %r13
+  802f24:	41 5e                	pop    %r14
+  802f26:	41 5f                	pop    %r15
+  802f28:	5d                   	pop    %rbp
+  802f29:	c3                   	ret
+
+0000000000802f2a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802f2a:	83 ff 1f             	cmp    $0x1f,%edi
+  802f2d:	77 39                	ja     802f68 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802f2f:	55                   	push   %rbp
+  802f30:	48 89 e5             	mov    %rsp,%rbp
+  802f33:	41 54                	push   %r12
+  802f35:	53                   	push   %rbx
+  802f36:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802f39:	48 63 df             	movslq %edi,%rbx
+  802f3c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802f43:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802f47:	48 89 df             	mov    %rbx,%rdi
+  802f4a:	48 b8 a5 4c 80 00 00 	movabs $0x804ca5,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+  802f56:	a8 04                	test   $0x4,%al
+  802f58:	74 14                	je     802f6e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802f5a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f63:	5b                   	pop    %rbx
+  802f64:	41 5c                	pop    %r12
+  802f66:	5d                   	pop    %rbp
+  802f67:	c3                   	ret
+        return -E_INVAL;
+  802f68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f6d:	c3                   	ret
+        return -E_INVAL;
+  802f6e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f73:	eb ee                	jmp    802f63 <fd_lookup+0x39>
+
+0000000000802f75 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	41 54                	push   %r12
+  802f7b:	53                   	push   %rbx
+  802f7c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802f7f:	48 b8 c0 6b 80 00 00 	movabs $0x806bc0,%rax
+  802f86:	00 00 00 
+  802f89:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802f90:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802f93:	39 3b                	cmp    %edi,(%rbx)
+  802f95:	74 47                	je     802fde <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802f97:	48 83 c0 08          	add    $0x8,%rax
+  802f9b:	48 8b 18             	mov    (%rax),%rbx
+  802f9e:	48 85 db             	test   %rbx,%rbx
+  802fa1:	75 f0                	jne    802f93 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802fa3:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802faa:	00 00 00 
+  802fad:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802fb3:	89 fa                	mov    %edi,%edx
+  802fb5:	48 bf 38 6b 80 00 00 	movabs $0x806b38,%rdi
+  802fbc:	00 00 00 
+  802fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc4:	48 b9 a2 17 80 00 00 	movabs $0x8017a2,%rcx
+  802fcb:	00 00 00 
+  802fce:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802fd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802fd5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802fd9:	5b                   	pop    %rbx
+  802fda:	41 5c                	pop    %r12
+  802fdc:	5d                   	pop    %rbp
+  802fdd:	c3                   	ret
+            return 0;
+  802fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe3:	eb f0                	jmp    802fd5 <dev_lookup+0x60>
+
+0000000000802fe5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802fe5:	55                   	push   %rbp
+  802fe6:	48 89 e5             	mov    %rsp,%rbp
+  802fe9:	41 55                	push   %r13
+  802feb:	41 54                	push   %r12
+  802fed:	53                   	push   %rbx
+  802fee:	48 83 ec 18          	sub    $0x18,%rsp
+  802ff2:	48 89 fb             	mov    %rdi,%rbx
+  802ff5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ff8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802fff:	ff ff ff 
+  803002:	48 01 df             	add    %rbx,%rdi
+  803005:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803009:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80300d:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803014:	00 00 00 
+  803017:	ff d0                	call   *%rax
+  803019:	41 89 c5             	mov    %eax,%r13d
+  80301c:	85 c0                	test   %eax,%eax
+  80301e:	78 06                	js     803026 <fd_close+0x41>
+  803020:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803024:	74 1a                	je     803040 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803026:	45 84 e4             	test   %r12b,%r12b
+  803029:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803032:	44 89 e8             	mov    %r13d,%eax
+  803035:	48 83 c4 18          	add    $0x18,%rsp
+  803039:	5b                   	pop    %rbx
+  80303a:	41 5c                	pop    %r12
+  80303c:	41 5d                	pop    %r13
+  80303e:	5d                   	pop    %rbp
+  80303f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803040:	8b 3b                	mov    (%rbx),%edi
+  803042:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803046:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	41 89 c5             	mov    %eax,%r13d
+  803055:	85 c0                	test   %eax,%eax
+  803057:	78 1b                	js     803074 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803059:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80305d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803061:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803067:	48 85 c0             	test   %rax,%rax
+  80306a:	74 08                	je     803074 <fd_close+0x8f>
+  80306c:	48 89 df             	mov    %rbx,%rdi
+  80306f:	ff d0                	call   *%rax
+  803071:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803074:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803079:	48 89 de             	mov    %rbx,%rsi
+  80307c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803081:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+    return res;
+  80308d:	eb a3                	jmp    803032 <fd_close+0x4d>
+
+000000000080308f <close>:
+
+int
+close(int fdnum) {
+  80308f:	55                   	push   %rbp
+  803090:	48 89 e5             	mov    %rsp,%rbp
+  803093:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803097:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80309b:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030a7:	85 c0                	test   %eax,%eax
+  8030a9:	78 15                	js     8030c0 <close+0x31>
+
+    return fd_close(fd, 1);
+  8030ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8030b0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8030b4:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+}
+  8030c0:	c9                   	leave
+  8030c1:	c3                   	ret
+
+00000000008030c2 <close_all>:
+
+void
+close_all(void) {
+  8030c2:	55                   	push   %rbp
+  8030c3:	48 89 e5             	mov    %rsp,%rbp
+  8030c6:	41 54                	push   %r12
+  8030c8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8030c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ce:	49 bc 8f 30 80 00 00 	movabs $0x80308f,%r12
+  8030d5:	00 00 00 
+  8030d8:	89 df                	mov    %ebx,%edi
+  8030da:	41 ff d4             	call   *%r12
+  8030dd:	83 c3 01             	add    $0x1,%ebx
+  8030e0:	83 fb 20             	cmp    $0x20,%ebx
+  8030e3:	75 f3                	jne    8030d8 <close_all+0x16>
+}
+  8030e5:	5b                   	pop    %rbx
+  8030e6:	41 5c                	pop    %r12
+  8030e8:	5d                   	pop    %rbp
+  8030e9:	c3                   	ret
+
+00000000008030ea <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8030ea:	55                   	push   %rbp
+  8030eb:	48 89 e5             	mov    %rsp,%rbp
+  8030ee:	41 57                	push   %r15
+  8030f0:	41 56                	push   %r14
+  8030f2:	41 55                	push   %r13
+  8030f4:	41 54                	push   %r12
+  8030f6:	53                   	push   %rbx
+  8030f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8030fb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8030fe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803102:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+  80310e:	89 c3                	mov    %eax,%ebx
+  803110:	85 c0                	test   %eax,%eax
+  803112:	0f 88 b8 00 00 00    	js     8031d0 <dup+0xe6>
+    close(newfdnum);
+  803118:	44 89 e7             	mov    %r12d,%edi
+  80311b:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803127:	4d 63 ec             	movslq %r12d,%r13
+  80312a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803131:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803135:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803139:	4c 89 ff             	mov    %r15,%rdi
+  80313c:	49 be ae 2e 80 00 00 	movabs $0x802eae,%r14
+  803143:	00 00 00 
+  803146:	41 ff d6             	call   *%r14
+  803149:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80314c:	4c 89 ef             	mov    %r13,%rdi
+  80314f:	41 ff d6             	call   *%r14
+  803152:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803155:	48 89 df             	mov    %rbx,%rdi
+  803158:	48 b8 a5 4c 80 00 00 	movabs $0x804ca5,%rax
+  80315f:	00 00 00 
+  803162:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803164:	a8 04                	test   $0x4,%al
+  803166:	74 2b                	je     803193 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803168:	41 89 c1             	mov    %eax,%r9d
+  80316b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803171:	4c 89 f1             	mov    %r14,%rcx
+  803174:	ba 00 00 00 00       	mov    $0x0,%edx
+  803179:	48 89 de             	mov    %rbx,%rsi
+  80317c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803181:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  803188:	00 00 00 
+  80318b:	ff d0                	call   *%rax
+  80318d:	89 c3                	mov    %eax,%ebx
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	78 4e                	js     8031e1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803193:	4c 89 ff             	mov    %r15,%rdi
+  803196:	48 b8 a5 4c 80 00 00 	movabs $0x804ca5,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8031a5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8031ab:	4c 89 e9             	mov    %r13,%rcx
+  8031ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b3:	4c 89 fe             	mov    %r15,%rsi
+  8031b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031bb:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  8031c2:	00 00 00 
+  8031c5:	ff d0                	call   *%rax
+  8031c7:	89 c3                	mov    %eax,%ebx
+  8031c9:	85 c0                	test   %eax,%eax
+  8031cb:	78 14                	js     8031e1 <dup+0xf7>
+
+    return newfdnum;
+  8031cd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8031d0:	89 d8                	mov    %ebx,%eax
+  8031d2:	48 83 c4 18          	add    $0x18,%rsp
+  8031d6:	5b                   	pop    %rbx
+  8031d7:	41 5c                	pop    %r12
+  8031d9:	41 5d                	pop    %r13
+  8031db:	41 5e                	pop    %r14
+  8031dd:	41 5f                	pop    %r15
+  8031df:	5d                   	pop    %rbp
+  8031e0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8031e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031e6:	4c 89 ee             	mov    %r13,%rsi
+  8031e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ee:	49 bc 16 29 80 00 00 	movabs $0x802916,%r12
+  8031f5:	00 00 00 
+  8031f8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8031fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803200:	4c 89 f6             	mov    %r14,%rsi
+  803203:	bf 00 00 00 00       	mov    $0x0,%edi
+  803208:	41 ff d4             	call   *%r12
+    return res;
+  80320b:	eb c3                	jmp    8031d0 <dup+0xe6>
+
+000000000080320d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80320d:	55                   	push   %rbp
+  80320e:	48 89 e5             	mov    %rsp,%rbp
+  803211:	41 56                	push   %r14
+  803213:	41 55                	push   %r13
+  803215:	41 54                	push   %r12
+  803217:	53                   	push   %rbx
+  803218:	48 83 ec 10          	sub    $0x10,%rsp
+  80321c:	89 fb                	mov    %edi,%ebx
+  80321e:	49 89 f4             	mov    %rsi,%r12
+  803221:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803224:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803228:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  80322f:	00 00 00 
+  803232:	ff d0                	call   *%rax
+  803234:	85 c0                	test   %eax,%eax
+  803236:	78 4c                	js     803284 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803238:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80323c:	41 8b 3e             	mov    (%r14),%edi
+  80323f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803243:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  80324a:	00 00 00 
+  80324d:	ff d0                	call   *%rax
+  80324f:	85 c0                	test   %eax,%eax
+  803251:	78 35                	js     803288 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803253:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803257:	83 e0 03             	and    $0x3,%eax
+  80325a:	83 f8 01             	cmp    $0x1,%eax
+  80325d:	74 2d                	je     80328c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80325f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803263:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803267:	48 85 c0             	test   %rax,%rax
+  80326a:	74 56                	je     8032c2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80326c:	4c 89 ea             	mov    %r13,%rdx
+  80326f:	4c 89 e6             	mov    %r12,%rsi
+  803272:	4c 89 f7             	mov    %r14,%rdi
+  803275:	ff d0                	call   *%rax
+}
+  803277:	48 83 c4 10          	add    $0x10,%rsp
+  80327b:	5b                   	pop    %rbx
+  80327c:	41 5c                	pop    %r12
+  80327e:	41 5d                	pop    %r13
+  803280:	41 5e                	pop    %r14
+  803282:	5d                   	pop    %rbp
+  803283:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803284:	48 98                	cltq
+  803286:	eb ef                	jmp    803277 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803288:	48 98                	cltq
+  80328a:	eb eb                	jmp    803277 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80328c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803293:	00 00 00 
+  803296:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80329c:	89 da                	mov    %ebx,%edx
+  80329e:	48 bf 79 6b 80 00 00 	movabs $0x806b79,%rdi
+  8032a5:	00 00 00 
+  8032a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ad:	48 b9 a2 17 80 00 00 	movabs $0x8017a2,%rcx
+  8032b4:	00 00 00 
+  8032b7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8032b9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8032c0:	eb b5                	jmp    803277 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8032c2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8032c9:	eb ac                	jmp    803277 <read+0x6a>
+
+00000000008032cb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8032cb:	55                   	push   %rbp
+  8032cc:	48 89 e5             	mov    %rsp,%rbp
+  8032cf:	41 57                	push   %r15
+  8032d1:	41 56                	push   %r14
+  8032d3:	41 55                	push   %r13
+  8032d5:	41 54                	push   %r12
+  8032d7:	53                   	push   %rbx
+  8032d8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8032dc:	48 85 d2             	test   %rdx,%rdx
+  8032df:	74 54                	je     803335 <readn+0x6a>
+  8032e1:	41 89 fd             	mov    %edi,%r13d
+  8032e4:	49 89 f6             	mov    %rsi,%r14
+  8032e7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8032ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8032ef:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8032f4:	49 bf 0d 32 80 00 00 	movabs $0x80320d,%r15
+  8032fb:	00 00 00 
+  8032fe:	4c 89 e2             	mov    %r12,%rdx
+  803301:	48 29 f2             	sub    %rsi,%rdx
+  803304:	4c 01 f6             	add    %r14,%rsi
+  803307:	44 89 ef             	mov    %r13d,%edi
+  80330a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	78 20                	js     803331 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803311:	01 c3                	add    %eax,%ebx
+  803313:	85 c0                	test   %eax,%eax
+  803315:	74 08                	je     80331f <readn+0x54>
+  803317:	48 63 f3             	movslq %ebx,%rsi
+  80331a:	4c 39 e6             	cmp    %r12,%rsi
+  80331d:	72 df                	jb     8032fe <readn+0x33>
+    }
+    return res;
+  80331f:	48 63 c3             	movslq %ebx,%rax
+}
+  803322:	48 83 c4 08          	add    $0x8,%rsp
+  803326:	5b                   	pop    %rbx
+  803327:	41 5c                	pop    %r12
+  803329:	41 5d                	pop    %r13
+  80332b:	41 5e                	pop    %r14
+  80332d:	41 5f                	pop    %r15
+  80332f:	5d                   	pop    %rbp
+  803330:	c3                   	ret
+        if (inc < 0) return inc;
+  803331:	48 98                	cltq
+  803333:	eb ed                	jmp    803322 <readn+0x57>
+    int inc = 1, res = 0;
+  803335:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80333a:	eb e3                	jmp    80331f <readn+0x54>
+
+000000000080333c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80333c:	55                   	push   %rbp
+  80333d:	48 89 e5             	mov    %rsp,%rbp
+  803340:	41 56                	push   %r14
+  803342:	41 55                	push   %r13
+  803344:	41 54                	push   %r12
+  803346:	53                   	push   %rbx
+  803347:	48 83 ec 10          	sub    $0x10,%rsp
+  80334b:	89 fb                	mov    %edi,%ebx
+  80334d:	49 89 f4             	mov    %rsi,%r12
+  803350:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803353:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803357:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  80335e:	00 00 00 
+  803361:	ff d0                	call   *%rax
+  803363:	85 c0                	test   %eax,%eax
+  803365:	78 47                	js     8033ae <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803367:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80336b:	41 8b 3e             	mov    (%r14),%edi
+  80336e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803372:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	78 30                	js     8033b2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803382:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803387:	74 2d                	je     8033b6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803389:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80338d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803391:	48 85 c0             	test   %rax,%rax
+  803394:	74 56                	je     8033ec <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803396:	4c 89 ea             	mov    %r13,%rdx
+  803399:	4c 89 e6             	mov    %r12,%rsi
+  80339c:	4c 89 f7             	mov    %r14,%rdi
+  80339f:	ff d0                	call   *%rax
+}
+  8033a1:	48 83 c4 10          	add    $0x10,%rsp
+  8033a5:	5b                   	pop    %rbx
+  8033a6:	41 5c                	pop    %r12
+  8033a8:	41 5d                	pop    %r13
+  8033aa:	41 5e                	pop    %r14
+  8033ac:	5d                   	pop    %rbp
+  8033ad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033ae:	48 98                	cltq
+  8033b0:	eb ef                	jmp    8033a1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033b2:	48 98                	cltq
+  8033b4:	eb eb                	jmp    8033a1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033b6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033bd:	00 00 00 
+  8033c0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033c6:	89 da                	mov    %ebx,%edx
+  8033c8:	48 bf 95 6b 80 00 00 	movabs $0x806b95,%rdi
+  8033cf:	00 00 00 
+  8033d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d7:	48 b9 a2 17 80 00 00 	movabs $0x8017a2,%rcx
+  8033de:	00 00 00 
+  8033e1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8033e3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8033ea:	eb b5                	jmp    8033a1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8033ec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8033f3:	eb ac                	jmp    8033a1 <write+0x65>
+
+00000000008033f5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8033f5:	55                   	push   %rbp
+  8033f6:	48 89 e5             	mov    %rsp,%rbp
+  8033f9:	53                   	push   %rbx
+  8033fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8033fe:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803400:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803404:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  80340b:	00 00 00 
+  80340e:	ff d0                	call   *%rax
+  803410:	85 c0                	test   %eax,%eax
+  803412:	78 0c                	js     803420 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803414:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803418:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80341b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803420:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803424:	c9                   	leave
+  803425:	c3                   	ret
+
+0000000000803426 <tell>:
+
+int tell(int fdnum) {
+  803426:	55                   	push   %rbp
+  803427:	48 89 e5             	mov    %rsp,%rbp
+  80342a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80342e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803432:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803439:	00 00 00 
+  80343c:	ff d0                	call   *%rax
+  80343e:	85 c0                	test   %eax,%eax
+  803440:	78 07                	js     803449 <tell+0x23>
+
+    return fd->fd_offset;
+  803442:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803446:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803449:	c9                   	leave
+  80344a:	c3                   	ret
+
+000000000080344b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80344b:	55                   	push   %rbp
+  80344c:	48 89 e5             	mov    %rsp,%rbp
+  80344f:	41 55                	push   %r13
+  803451:	41 54                	push   %r12
+  803453:	53                   	push   %rbx
+  803454:	48 83 ec 18          	sub    $0x18,%rsp
+  803458:	89 fb                	mov    %edi,%ebx
+  80345a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80345d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803461:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803468:	00 00 00 
+  80346b:	ff d0                	call   *%rax
+  80346d:	85 c0                	test   %eax,%eax
+  80346f:	78 38                	js     8034a9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803471:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803475:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803479:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80347d:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  803484:	00 00 00 
+  803487:	ff d0                	call   *%rax
+  803489:	85 c0                	test   %eax,%eax
+  80348b:	78 1c                	js     8034a9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80348d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803492:	74 20                	je     8034b4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803494:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803498:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80349c:	48 85 c0             	test   %rax,%rax
+  80349f:	74 47                	je     8034e8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8034a1:	44 89 e6             	mov    %r12d,%esi
+  8034a4:	4c 89 ef             	mov    %r13,%rdi
+  8034a7:	ff d0                	call   *%rax
+}
+  8034a9:	48 83 c4 18          	add    $0x18,%rsp
+  8034ad:	5b                   	pop    %rbx
+  8034ae:	41 5c                	pop    %r12
+  8034b0:	41 5d                	pop    %r13
+  8034b2:	5d                   	pop    %rbp
+  8034b3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8034b4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034bb:	00 00 00 
+  8034be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8034c4:	89 da                	mov    %ebx,%edx
+  8034c6:	48 bf 58 6b 80 00 00 	movabs $0x806b58,%rdi
+  8034cd:	00 00 00 
+  8034d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d5:	48 b9 a2 17 80 00 00 	movabs $0x8017a2,%rcx
+  8034dc:	00 00 00 
+  8034df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034e6:	eb c1                	jmp    8034a9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8034e8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8034ed:	eb ba                	jmp    8034a9 <ftruncate+0x5e>
+
+00000000008034ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8034ef:	55                   	push   %rbp
+  8034f0:	48 89 e5             	mov    %rsp,%rbp
+  8034f3:	41 54                	push   %r12
+  8034f5:	53                   	push   %rbx
+  8034f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8034fa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803501:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803508:	00 00 00 
+  80350b:	ff d0                	call   *%rax
+  80350d:	85 c0                	test   %eax,%eax
+  80350f:	78 63                	js     803574 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803511:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803515:	41 8b 3c 24          	mov    (%r12),%edi
+  803519:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80351d:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  803524:	00 00 00 
+  803527:	ff d0                	call   *%rax
+  803529:	85 c0                	test   %eax,%eax
+  80352b:	78 47                	js     803574 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80352d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803531:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803536:	74 45                	je     80357d <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803538:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80353b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803542:	00 00 00 
+    stat->st_isdir = 0;
+  803545:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80354c:	00 00 00 
+    stat->st_ino = 0;
+  80354f:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803556:	00 00 00 00 
+    stat->st_version = 0;
+  80355a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803561:	00 00 00 
+    stat->st_dev = dev;
+  803564:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80356b:	48 89 de             	mov    %rbx,%rsi
+  80356e:	4c 89 e7             	mov    %r12,%rdi
+  803571:	ff 50 28             	call   *0x28(%rax)
+}
+  803574:	48 83 c4 10          	add    $0x10,%rsp
+  803578:	5b                   	pop    %rbx
+  803579:	41 5c                	pop    %r12
+  80357b:	5d                   	pop    %rbp
+  80357c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80357d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803582:	eb f0                	jmp    803574 <fstat+0x85>
+
+0000000000803584 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803584:	55                   	push   %rbp
+  803585:	48 89 e5             	mov    %rsp,%rbp
+  803588:	41 54                	push   %r12
+  80358a:	53                   	push   %rbx
+  80358b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80358e:	be 00 00 00 00       	mov    $0x0,%esi
+  803593:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+  80359f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8035a1:	85 c0                	test   %eax,%eax
+  8035a3:	78 25                	js     8035ca <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8035a5:	4c 89 e6             	mov    %r12,%rsi
+  8035a8:	89 c7                	mov    %eax,%edi
+  8035aa:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+  8035b6:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8035b9:	89 df                	mov    %ebx,%edi
+  8035bb:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+
+    return res;
+  8035c7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8035ca:	89 d8                	mov    %ebx,%eax
+  8035cc:	5b                   	pop    %rbx
+  8035cd:	41 5c                	pop    %r12
+  8035cf:	5d                   	pop    %rbp
+  8035d0:	c3                   	ret
+
+00000000008035d1 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035d1:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8035d8:	00 00 00 
+  8035db:	83 38 00             	cmpl   $0x0,(%rax)
+  8035de:	74 0a                	je     8035ea <fsipc_env+0x19>
+    return fsenv;
+}
+  8035e0:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8035e7:	00 00 
+  8035e9:	c3                   	ret
+fsipc_env(void) {
+  8035ea:	55                   	push   %rbp
+  8035eb:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8035ee:	bf 03 00 00 00       	mov    $0x3,%edi
+  8035f3:	48 b8 af 5f 80 00 00 	movabs $0x805faf,%rax
+  8035fa:	00 00 00 
+  8035fd:	ff d0                	call   *%rax
+  8035ff:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803606:	00 00 
+}
+  803608:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80360f:	00 00 
+  803611:	5d                   	pop    %rbp
+  803612:	c3                   	ret
+
+0000000000803613 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803613:	55                   	push   %rbp
+  803614:	48 89 e5             	mov    %rsp,%rbp
+  803617:	53                   	push   %rbx
+  803618:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80361c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803623:	00 
+  803624:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  80362b:	00 
+  80362c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803633:	00 
+  803634:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  80363b:	00 
+  80363c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803643:	00 
+
+    assert(size <= sizeof(words));
+  803644:	48 83 fa 28          	cmp    $0x28,%rdx
+  803648:	77 38                	ja     803682 <fsipc_short+0x6f>
+  80364a:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80364c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803650:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80365c:	48 b8 d1 35 80 00 00 	movabs $0x8035d1,%rax
+  803663:	00 00 00 
+  803666:	ff d0                	call   *%rax
+  803668:	89 c7                	mov    %eax,%edi
+  80366a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80366e:	89 de                	mov    %ebx,%esi
+  803670:	48 b8 12 5f 80 00 00 	movabs $0x805f12,%rax
+  803677:	00 00 00 
+  80367a:	ff d0                	call   *%rax
+}
+  80367c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803680:	c9                   	leave
+  803681:	c3                   	ret
+    assert(size <= sizeof(words));
+  803682:	48 b9 e0 6b 80 00 00 	movabs $0x806be0,%rcx
+  803689:	00 00 00 
+  80368c:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  803693:	00 00 00 
+  803696:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80369b:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  8036a2:	00 00 00 
+  8036a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036aa:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  8036b1:	00 00 00 
+  8036b4:	41 ff d0             	call   *%r8
+
+00000000008036b7 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8036b7:	55                   	push   %rbp
+  8036b8:	48 89 e5             	mov    %rsp,%rbp
+  8036bb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8036bf:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8036c2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8036c5:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8036c8:	ba 08 00 00 00       	mov    $0x8,%edx
+  8036cd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036d1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8036d6:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  8036dd:	00 00 00 
+  8036e0:	ff d0                	call   *%rax
+}
+  8036e2:	c9                   	leave
+  8036e3:	c3                   	ret
+
+00000000008036e4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8036e4:	55                   	push   %rbp
+  8036e5:	48 89 e5             	mov    %rsp,%rbp
+  8036e8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8036ec:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8036ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8036f2:	ba 04 00 00 00       	mov    $0x4,%edx
+  8036f7:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8036fb:	bf 06 00 00 00       	mov    $0x6,%edi
+  803700:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803707:	00 00 00 
+  80370a:	ff d0                	call   *%rax
+}
+  80370c:	c9                   	leave
+  80370d:	c3                   	ret
+
+000000000080370e <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80370e:	55                   	push   %rbp
+  80370f:	48 89 e5             	mov    %rsp,%rbp
+  803712:	41 54                	push   %r12
+  803714:	53                   	push   %rbx
+  803715:	48 83 ec 10          	sub    $0x10,%rsp
+  803719:	89 fb                	mov    %edi,%ebx
+  80371b:	49 89 f4             	mov    %rsi,%r12
+  80371e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803722:	48 b8 d1 35 80 00 00 	movabs $0x8035d1,%rax
+  803729:	00 00 00 
+  80372c:	ff d0                	call   *%rax
+  80372e:	89 c7                	mov    %eax,%edi
+  803730:	6a 00                	push   $0x0
+  803732:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803736:	50                   	push   %rax
+  803737:	4d 89 e1             	mov    %r12,%r9
+  80373a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803740:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803745:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80374c:	00 00 00 
+  80374f:	89 de                	mov    %ebx,%esi
+  803751:	48 b8 ad 5e 80 00 00 	movabs $0x805ead,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+}
+  80375d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803761:	5b                   	pop    %rbx
+  803762:	41 5c                	pop    %r12
+  803764:	5d                   	pop    %rbp
+  803765:	c3                   	ret
+
+0000000000803766 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803766:	55                   	push   %rbp
+  803767:	48 89 e5             	mov    %rsp,%rbp
+  80376a:	41 54                	push   %r12
+  80376c:	53                   	push   %rbx
+  80376d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803770:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803773:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  80377a:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80377c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803781:	be 00 00 00 00       	mov    $0x0,%esi
+  803786:	bf 05 00 00 00       	mov    $0x5,%edi
+  80378b:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803797:	85 c0                	test   %eax,%eax
+  803799:	78 5a                	js     8037f5 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80379b:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8037a2:	00 00 00 
+  8037a5:	4c 89 e6             	mov    %r12,%rsi
+  8037a8:	48 89 df             	mov    %rbx,%rdi
+  8037ab:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  8037b2:	00 00 00 
+  8037b5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8037b7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8037be:	00 
+  8037bf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8037c5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8037cc:	00 
+  8037cd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  8037d3:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  8037da:	00 
+  8037db:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  8037e2:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  8037e9:	00 
+  8037ea:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f5:	5b                   	pop    %rbx
+  8037f6:	41 5c                	pop    %r12
+  8037f8:	5d                   	pop    %rbp
+  8037f9:	c3                   	ret
+
+00000000008037fa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8037fa:	55                   	push   %rbp
+  8037fb:	48 89 e5             	mov    %rsp,%rbp
+  8037fe:	41 57                	push   %r15
+  803800:	41 56                	push   %r14
+  803802:	41 55                	push   %r13
+  803804:	41 54                	push   %r12
+  803806:	53                   	push   %rbx
+  803807:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  80380b:	48 85 ff             	test   %rdi,%rdi
+  80380e:	0f 84 a1 00 00 00    	je     8038b5 <devfile_read+0xbb>
+  803814:	49 89 ff             	mov    %rdi,%r15
+  803817:	49 89 f5             	mov    %rsi,%r13
+  80381a:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  80381d:	48 85 f6             	test   %rsi,%rsi
+  803820:	0f 84 c4 00 00 00    	je     8038ea <devfile_read+0xf0>
+    size_t total_read = 0;
+  803826:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80382d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80382e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803835:	00 00 00 
+  803838:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80383c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  80383f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803843:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803848:	be 00 00 00 00       	mov    $0x0,%esi
+  80384d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803852:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+        if (res < 0) {
+  80385e:	85 c0                	test   %eax,%eax
+  803860:	0f 88 b9 00 00 00    	js     80391f <devfile_read+0x125>
+        assert(res <= n);
+  803866:	48 63 d8             	movslq %eax,%rbx
+  803869:	49 39 dc             	cmp    %rbx,%r12
+  80386c:	0f 82 b1 00 00 00    	jb     803923 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803872:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803877:	0f 87 db 00 00 00    	ja     803958 <devfile_read+0x15e>
+        if (!res) {
+  80387d:	85 c0                	test   %eax,%eax
+  80387f:	74 21                	je     8038a2 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803881:	48 89 da             	mov    %rbx,%rdx
+  803884:	4c 89 f6             	mov    %r14,%rsi
+  803887:	4c 89 ef             	mov    %r13,%rdi
+  80388a:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  803891:	00 00 00 
+  803894:	ff d0                	call   *%rax
+        total_read += res;
+  803896:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80389a:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80389d:	49 29 dc             	sub    %rbx,%r12
+  8038a0:	75 96                	jne    803838 <devfile_read+0x3e>
+    return total_read;
+  8038a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8038a6:	48 83 c4 18          	add    $0x18,%rsp
+  8038aa:	5b                   	pop    %rbx
+  8038ab:	41 5c                	pop    %r12
+  8038ad:	41 5d                	pop    %r13
+  8038af:	41 5e                	pop    %r14
+  8038b1:	41 5f                	pop    %r15
+  8038b3:	5d                   	pop    %rbp
+  8038b4:	c3                   	ret
+    assert(fd);
+  8038b5:	48 b9 16 6c 80 00 00 	movabs $0x806c16,%rcx
+  8038bc:	00 00 00 
+  8038bf:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  8038c6:	00 00 00 
+  8038c9:	be 91 00 00 00       	mov    $0x91,%esi
+  8038ce:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  8038d5:	00 00 00 
+  8038d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038dd:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  8038e4:	00 00 00 
+  8038e7:	41 ff d0             	call   *%r8
+    assert(buf);
+  8038ea:	48 b9 19 6c 80 00 00 	movabs $0x806c19,%rcx
+  8038f1:	00 00 00 
+  8038f4:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  8038fb:	00 00 00 
+  8038fe:	be 92 00 00 00       	mov    $0x92,%esi
+  803903:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  80390a:	00 00 00 
+  80390d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803912:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  803919:	00 00 00 
+  80391c:	41 ff d0             	call   *%r8
+            return res;
+  80391f:	48 98                	cltq
+  803921:	eb 83                	jmp    8038a6 <devfile_read+0xac>
+        assert(res <= n);
+  803923:	48 b9 1d 6c 80 00 00 	movabs $0x806c1d,%rcx
+  80392a:	00 00 00 
+  80392d:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  803934:	00 00 00 
+  803937:	be 9e 00 00 00       	mov    $0x9e,%esi
+  80393c:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  803943:	00 00 00 
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  803952:	00 00 00 
+  803955:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803958:	48 b9 28 6c 80 00 00 	movabs $0x806c28,%rcx
+  80395f:	00 00 00 
+  803962:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  803969:	00 00 00 
+  80396c:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803971:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  803978:	00 00 00 
+  80397b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803980:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  803987:	00 00 00 
+  80398a:	41 ff d0             	call   *%r8
+
+000000000080398d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80398d:	55                   	push   %rbp
+  80398e:	48 89 e5             	mov    %rsp,%rbp
+  803991:	41 57                	push   %r15
+  803993:	41 56                	push   %r14
+  803995:	41 55                	push   %r13
+  803997:	41 54                	push   %r12
+  803999:	53                   	push   %rbx
+  80399a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80399e:	48 85 ff             	test   %rdi,%rdi
+  8039a1:	0f 84 83 00 00 00    	je     803a2a <devfile_write+0x9d>
+  8039a7:	49 89 ff             	mov    %rdi,%r15
+  8039aa:	49 89 f4             	mov    %rsi,%r12
+  8039ad:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  8039b0:	48 85 f6             	test   %rsi,%rsi
+  8039b3:	0f 84 a6 00 00 00    	je     803a5f <devfile_write+0xd2>
+    size_t total_written = 0;
+  8039b9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8039bf:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8039c6:	00 00 00 
+  8039c9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8039cd:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8039d0:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8039d4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8039d9:	48 39 d3             	cmp    %rdx,%rbx
+  8039dc:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8039e0:	4c 89 e6             	mov    %r12,%rsi
+  8039e3:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8039ea:	00 00 00 
+  8039ed:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803a03:	bf 04 00 00 00       	mov    $0x4,%edi
+  803a08:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  803a0f:	00 00 00 
+  803a12:	ff d0                	call   *%rax
+        if (res < 0) {
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	78 7c                	js     803a94 <devfile_write+0x107>
+        total_written += res;
+  803a18:	48 98                	cltq
+  803a1a:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803a1d:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803a20:	48 29 c3             	sub    %rax,%rbx
+  803a23:	75 a4                	jne    8039c9 <devfile_write+0x3c>
+    return total_written;
+  803a25:	4c 89 e8             	mov    %r13,%rax
+  803a28:	eb 6c                	jmp    803a96 <devfile_write+0x109>
+    assert(fd);
+  803a2a:	48 b9 16 6c 80 00 00 	movabs $0x806c16,%rcx
+  803a31:	00 00 00 
+  803a34:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  803a3b:	00 00 00 
+  803a3e:	be bd 00 00 00       	mov    $0xbd,%esi
+  803a43:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  803a4a:	00 00 00 
+  803a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a52:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  803a59:	00 00 00 
+  803a5c:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a5f:	48 b9 19 6c 80 00 00 	movabs $0x806c19,%rcx
+  803a66:	00 00 00 
+  803a69:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  803a70:	00 00 00 
+  803a73:	be be 00 00 00       	mov    $0xbe,%esi
+  803a78:	48 bf 0b 6c 80 00 00 	movabs $0x806c0b,%rdi
+  803a7f:	00 00 00 
+  803a82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a87:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  803a8e:	00 00 00 
+  803a91:	41 ff d0             	call   *%r8
+            return res;
+  803a94:	48 98                	cltq
+}
+  803a96:	48 83 c4 08          	add    $0x8,%rsp
+  803a9a:	5b                   	pop    %rbx
+  803a9b:	41 5c                	pop    %r12
+  803a9d:	41 5d                	pop    %r13
+  803a9f:	41 5e                	pop    %r14
+  803aa1:	41 5f                	pop    %r15
+  803aa3:	5d                   	pop    %rbp
+  803aa4:	c3                   	ret
+
+0000000000803aa5 <open>:
+open(const char *path, int mode) {
+  803aa5:	55                   	push   %rbp
+  803aa6:	48 89 e5             	mov    %rsp,%rbp
+  803aa9:	41 55                	push   %r13
+  803aab:	41 54                	push   %r12
+  803aad:	53                   	push   %rbx
+  803aae:	48 83 ec 18          	sub    $0x18,%rsp
+  803ab2:	49 89 fc             	mov    %rdi,%r12
+  803ab5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ab8:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  803abf:	00 00 00 
+  803ac2:	ff d0                	call   *%rax
+  803ac4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803aca:	0f 87 8f 00 00 00    	ja     803b5f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803ad0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ad4:	48 b8 ca 2e 80 00 00 	movabs $0x802eca,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+  803ae0:	89 c3                	mov    %eax,%ebx
+  803ae2:	85 c0                	test   %eax,%eax
+  803ae4:	78 55                	js     803b3b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803ae6:	4c 89 e6             	mov    %r12,%rsi
+  803ae9:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803af0:	00 00 00 
+  803af3:	48 89 df             	mov    %rbx,%rdi
+  803af6:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  803afd:	00 00 00 
+  803b00:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803b02:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b0e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b12:	bf 01 00 00 00       	mov    $0x1,%edi
+  803b17:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  803b1e:	00 00 00 
+  803b21:	ff d0                	call   *%rax
+  803b23:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803b25:	85 c0                	test   %eax,%eax
+  803b27:	78 1f                	js     803b48 <open+0xa3>
+    return fd2num(fd);
+  803b29:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b2d:	48 b8 9c 2e 80 00 00 	movabs $0x802e9c,%rax
+  803b34:	00 00 00 
+  803b37:	ff d0                	call   *%rax
+  803b39:	89 c3                	mov    %eax,%ebx
+}
+  803b3b:	89 d8                	mov    %ebx,%eax
+  803b3d:	48 83 c4 18          	add    $0x18,%rsp
+  803b41:	5b                   	pop    %rbx
+  803b42:	41 5c                	pop    %r12
+  803b44:	41 5d                	pop    %r13
+  803b46:	5d                   	pop    %rbp
+  803b47:	c3                   	ret
+        fd_close(fd, 0);
+  803b48:	be 00 00 00 00       	mov    $0x0,%esi
+  803b4d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b51:	48 b8 e5 2f 80 00 00 	movabs $0x802fe5,%rax
+  803b58:	00 00 00 
+  803b5b:	ff d0                	call   *%rax
+        return res;
+  803b5d:	eb dc                	jmp    803b3b <open+0x96>
+        return -E_BAD_PATH;
+  803b5f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b64:	eb d5                	jmp    803b3b <open+0x96>
+
+0000000000803b66 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803b66:	55                   	push   %rbp
+  803b67:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803b6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b6f:	be 00 00 00 00       	mov    $0x0,%esi
+  803b74:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b79:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803b80:	00 00 00 
+  803b83:	ff d0                	call   *%rax
+}
+  803b85:	5d                   	pop    %rbp
+  803b86:	c3                   	ret
+
+0000000000803b87 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803b87:	55                   	push   %rbp
+  803b88:	48 89 e5             	mov    %rsp,%rbp
+  803b8b:	41 56                	push   %r14
+  803b8d:	41 55                	push   %r13
+  803b8f:	41 54                	push   %r12
+  803b91:	53                   	push   %rbx
+  803b92:	48 83 ec 10          	sub    $0x10,%rsp
+  803b96:	41 89 f6             	mov    %esi,%r14d
+  803b99:	49 89 d4             	mov    %rdx,%r12
+  803b9c:	48 89 cb             	mov    %rcx,%rbx
+  803b9f:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ba2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ba6:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803bad:	00 00 00 
+  803bb0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bb2:	85 c0                	test   %eax,%eax
+  803bb4:	78 46                	js     803bfc <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bb6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803bba:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803bc1:	00 00 00 
+  803bc4:	8b 00                	mov    (%rax),%eax
+  803bc6:	39 02                	cmp    %eax,(%rdx)
+  803bc8:	75 3f                	jne    803c09 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803bca:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803bd1:	00 00 00 
+  803bd4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803bd7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803bd9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803bdd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803be1:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803be5:	48 89 da             	mov    %rbx,%rdx
+  803be8:	4c 89 e6             	mov    %r12,%rsi
+  803beb:	bf 09 00 00 00       	mov    $0x9,%edi
+  803bf0:	48 b8 0e 37 80 00 00 	movabs $0x80370e,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+}
+  803bfc:	48 83 c4 10          	add    $0x10,%rsp
+  803c00:	5b                   	pop    %rbx
+  803c01:	41 5c                	pop    %r12
+  803c03:	41 5d                	pop    %r13
+  803c05:	41 5e                	pop    %r14
+  803c07:	5d                   	pop    %rbp
+  803c08:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c09:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c0e:	eb ec                	jmp    803bfc <file_map+0x75>
+
+0000000000803c10 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803c10:	55                   	push   %rbp
+  803c11:	48 89 e5             	mov    %rsp,%rbp
+  803c14:	41 54                	push   %r12
+  803c16:	53                   	push   %rbx
+  803c17:	48 83 ec 20          	sub    $0x20,%rsp
+  803c1b:	41 89 f4             	mov    %esi,%r12d
+  803c1e:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803c21:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803c25:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  803c2c:	00 00 00 
+  803c2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c31:	85 c0                	test   %eax,%eax
+  803c33:	78 3c                	js     803c71 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c39:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803c40:	00 00 00 
+  803c43:	8b 0a                	mov    (%rdx),%ecx
+  803c45:	39 08                	cmp    %ecx,(%rax)
+  803c47:	75 31                	jne    803c7a <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803c49:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c4c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803c4f:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803c53:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803c57:	ba 10 00 00 00       	mov    $0x10,%edx
+  803c5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803c60:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c65:	48 b8 13 36 80 00 00 	movabs $0x803613,%rax
+  803c6c:	00 00 00 
+  803c6f:	ff d0                	call   *%rax
+}
+  803c71:	48 83 c4 20          	add    $0x20,%rsp
+  803c75:	5b                   	pop    %rbx
+  803c76:	41 5c                	pop    %r12
+  803c78:	5d                   	pop    %rbp
+  803c79:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c7a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c7f:	eb f0                	jmp    803c71 <file_msync+0x61>
+
+0000000000803c81 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803c81:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803c85:	7f 01                	jg     803c88 <writebuf+0x7>
+  803c87:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+  803c8c:	53                   	push   %rbx
+  803c8d:	48 83 ec 08          	sub    $0x8,%rsp
+  803c91:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803c94:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803c98:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803c9c:	8b 3f                	mov    (%rdi),%edi
+  803c9e:	48 b8 3c 33 80 00 00 	movabs $0x80333c,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803caa:	48 85 c0             	test   %rax,%rax
+  803cad:	7e 04                	jle    803cb3 <writebuf+0x32>
+  803caf:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803cb3:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803cb7:	48 39 c2             	cmp    %rax,%rdx
+  803cba:	74 0f                	je     803ccb <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803cbc:	48 85 c0             	test   %rax,%rax
+  803cbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cc4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803cc8:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803ccb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ccf:	c9                   	leave
+  803cd0:	c3                   	ret
+
+0000000000803cd1 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803cd1:	8b 46 04             	mov    0x4(%rsi),%eax
+  803cd4:	8d 50 01             	lea    0x1(%rax),%edx
+  803cd7:	89 56 04             	mov    %edx,0x4(%rsi)
+  803cda:	48 98                	cltq
+  803cdc:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803ce1:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803ce7:	74 01                	je     803cea <putch+0x19>
+  803ce9:	c3                   	ret
+putch(int ch, void *arg) {
+  803cea:	55                   	push   %rbp
+  803ceb:	48 89 e5             	mov    %rsp,%rbp
+  803cee:	53                   	push   %rbx
+  803cef:	48 83 ec 08          	sub    $0x8,%rsp
+  803cf3:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803cf6:	48 89 f7             	mov    %rsi,%rdi
+  803cf9:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  803d00:	00 00 00 
+  803d03:	ff d0                	call   *%rax
+        state->offset = 0;
+  803d05:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803d0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d10:	c9                   	leave
+  803d11:	c3                   	ret
+
+0000000000803d12 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803d12:	55                   	push   %rbp
+  803d13:	48 89 e5             	mov    %rsp,%rbp
+  803d16:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803d1d:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803d20:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803d26:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803d2d:	00 00 00 
+    state.result = 0;
+  803d30:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803d37:	00 00 00 00 
+    state.error = 1;
+  803d3b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803d42:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803d45:	48 89 f2             	mov    %rsi,%rdx
+  803d48:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803d4f:	48 bf d1 3c 80 00 00 	movabs $0x803cd1,%rdi
+  803d56:	00 00 00 
+  803d59:	48 b8 f2 18 80 00 00 	movabs $0x8018f2,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803d65:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803d6c:	7f 14                	jg     803d82 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803d6e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803d75:	48 85 c0             	test   %rax,%rax
+  803d78:	75 06                	jne    803d80 <vfprintf+0x6e>
+  803d7a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803d80:	c9                   	leave
+  803d81:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803d82:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803d89:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  803d90:	00 00 00 
+  803d93:	ff d0                	call   *%rax
+  803d95:	eb d7                	jmp    803d6e <vfprintf+0x5c>
+
+0000000000803d97 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803d97:	55                   	push   %rbp
+  803d98:	48 89 e5             	mov    %rsp,%rbp
+  803d9b:	48 83 ec 50          	sub    $0x50,%rsp
+  803d9f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803da3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803da7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803dab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803daf:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803db6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803dba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dbe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803dc2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803dc6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803dca:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  803dd1:	00 00 00 
+  803dd4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803dd6:	c9                   	leave
+  803dd7:	c3                   	ret
+
+0000000000803dd8 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803dd8:	55                   	push   %rbp
+  803dd9:	48 89 e5             	mov    %rsp,%rbp
+  803ddc:	48 83 ec 50          	sub    $0x50,%rsp
+  803de0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803de4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803de8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803dec:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803df0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803df4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803dfb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e03:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803e07:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803e0b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803e0f:	48 89 fe             	mov    %rdi,%rsi
+  803e12:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e17:	48 b8 12 3d 80 00 00 	movabs $0x803d12,%rax
+  803e1e:	00 00 00 
+  803e21:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803e23:	c9                   	leave
+  803e24:	c3                   	ret
+
+0000000000803e25 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  803e25:	55                   	push   %rbp
+  803e26:	48 89 e5             	mov    %rsp,%rbp
+  803e29:	41 55                	push   %r13
+  803e2b:	41 54                	push   %r12
+  803e2d:	53                   	push   %rbx
+  803e2e:	48 83 ec 08          	sub    $0x8,%rsp
+  803e32:	48 89 fb             	mov    %rdi,%rbx
+  803e35:	49 89 f5             	mov    %rsi,%r13
+  803e38:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  803e3b:	48 b8 a5 4c 80 00 00 	movabs $0x804ca5,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+  803e47:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  803e49:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  803e50:	ff ff ff 
+  803e53:	48 01 d8             	add    %rbx,%rax
+  803e56:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e5b:	48 c1 e8 24          	shr    $0x24,%rax
+  803e5f:	74 5c                	je     803ebd <collect_shared_region+0x98>
+
+    if (list->count) {
+  803e61:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  803e68:	00 
+  803e69:	48 85 c0             	test   %rax,%rax
+  803e6c:	74 20                	je     803e8e <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  803e6e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803e72:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  803e76:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  803e7a:	48 89 f7             	mov    %rsi,%rdi
+  803e7d:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  803e81:	48 39 fb             	cmp    %rdi,%rbx
+  803e84:	74 44                	je     803eca <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  803e86:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  803e8c:	74 59                	je     803ee7 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  803e8e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803e92:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  803e99:	00 
+  803e9a:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  803e9e:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  803ea2:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  803ea6:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  803ea9:	49 29 dd             	sub    %rbx,%r13
+  803eac:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  803eb0:	48 01 c2             	add    %rax,%rdx
+  803eb3:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  803eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  803ebd:	89 d0                	mov    %edx,%eax
+  803ebf:	48 83 c4 08          	add    $0x8,%rsp
+  803ec3:	5b                   	pop    %rbx
+  803ec4:	41 5c                	pop    %r12
+  803ec6:	41 5d                	pop    %r13
+  803ec8:	5d                   	pop    %rbp
+  803ec9:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  803eca:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  803ecf:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  803ed4:	75 b0                	jne    803e86 <collect_shared_region+0x61>
+            last->size += end - start;
+  803ed6:	49 29 dd             	sub    %rbx,%r13
+  803ed9:	49 01 f5             	add    %rsi,%r13
+  803edc:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  803ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ee5:	eb d6                	jmp    803ebd <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  803ee7:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  803eec:	eb cf                	jmp    803ebd <collect_shared_region+0x98>
+
+0000000000803eee <spawn>:
+spawn(const char *prog, const char **argv) {
+  803eee:	55                   	push   %rbp
+  803eef:	48 89 e5             	mov    %rsp,%rbp
+  803ef2:	41 57                	push   %r15
+  803ef4:	41 56                	push   %r14
+  803ef6:	41 55                	push   %r13
+  803ef8:	41 54                	push   %r12
+  803efa:	53                   	push   %rbx
+  803efb:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  803f02:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  803f05:	be 00 00 00 00       	mov    $0x0,%esi
+  803f0a:	48 b8 a5 3a 80 00 00 	movabs $0x803aa5,%rax
+  803f11:	00 00 00 
+  803f14:	ff d0                	call   *%rax
+  803f16:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  803f19:	85 c0                	test   %eax,%eax
+  803f1b:	0f 88 8f 06 00 00    	js     8045b0 <spawn+0x6c2>
+    struct SpawnImage img = {
+  803f21:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  803f28:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  803f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f32:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  803f35:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  803f3c:	00 00 00 
+  803f3f:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  803f46:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  803f4d:	00 00 00 
+  803f50:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  803f57:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  803f5e:	44 89 f7             	mov    %r14d,%edi
+  803f61:	48 b8 ef 34 80 00 00 	movabs $0x8034ef,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+  803f6d:	41 89 c4             	mov    %eax,%r12d
+  803f70:	85 c0                	test   %eax,%eax
+  803f72:	0f 88 26 06 00 00    	js     80459e <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  803f78:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f7f:	48 85 c0             	test   %rax,%rax
+  803f82:	74 22                	je     803fa6 <spawn+0xb8>
+  803f84:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  803f8b:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  803f92:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  803f99:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  803f9f:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  803fa6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803fab:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803fb0:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  803fb7:	00 00 00 
+  803fba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fbf:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  803fc6:	00 00 00 
+  803fc9:	ff d0                	call   *%rax
+  803fcb:	41 89 c4             	mov    %eax,%r12d
+  803fce:	85 c0                	test   %eax,%eax
+  803fd0:	0f 88 c8 05 00 00    	js     80459e <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803fd6:	48 8b 3b             	mov    (%rbx),%rdi
+  803fd9:	48 85 ff             	test   %rdi,%rdi
+  803fdc:	0f 84 61 02 00 00    	je     804243 <spawn+0x355>
+  803fe2:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  803fe8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  803fee:	49 bf 9b 20 80 00 00 	movabs $0x80209b,%r15
+  803ff5:	00 00 00 
+  803ff8:	41 ff d7             	call   *%r15
+  803ffb:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  804000:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  804007:	49 83 c4 01          	add    $0x1,%r12
+  80400b:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  804010:	48 85 ff             	test   %rdi,%rdi
+  804013:	75 e3                	jne    803ff8 <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804015:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  80401b:	4d 29 ec             	sub    %r13,%r12
+  80401e:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  804025:	00 00 00 
+  804028:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80402b:	4c 89 e1             	mov    %r12,%rcx
+  80402e:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  804032:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  804039:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  804040:	89 f0                	mov    %esi,%eax
+  804042:	83 c0 01             	add    $0x1,%eax
+  804045:	48 98                	cltq
+  804047:	48 c1 e0 03          	shl    $0x3,%rax
+  80404b:	48 29 c1             	sub    %rax,%rcx
+  80404e:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804055:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  804059:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  804060:	00 00 00 
+  804063:	48 39 c2             	cmp    %rax,%rdx
+  804066:	0f 83 f2 04 00 00    	jae    80455e <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  80406c:	85 f6                	test   %esi,%esi
+  80406e:	7e 4e                	jle    8040be <spawn+0x1d0>
+  804070:	49 89 cd             	mov    %rcx,%r13
+  804073:	48 63 c6             	movslq %esi,%rax
+  804076:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  80407a:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804081:	00 00 00 
+  804084:	4c 01 e0             	add    %r12,%rax
+  804087:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  80408b:	48 8b 33             	mov    (%rbx),%rsi
+  80408e:	4c 89 e7             	mov    %r12,%rdi
+  804091:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  804098:	00 00 00 
+  80409b:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80409d:	48 8b 3b             	mov    (%rbx),%rdi
+  8040a0:	48 b8 9b 20 80 00 00 	movabs $0x80209b,%rax
+  8040a7:	00 00 00 
+  8040aa:	ff d0                	call   *%rax
+  8040ac:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  8040b1:	49 83 c5 08          	add    $0x8,%r13
+  8040b5:	48 83 c3 08          	add    $0x8,%rbx
+  8040b9:	4d 39 fd             	cmp    %r15,%r13
+  8040bc:	75 bc                	jne    80407a <spawn+0x18c>
+    argv_store[argc] = 0;
+  8040be:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  8040c5:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8040cc:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  8040cd:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  8040d4:	00 00 00 
+  8040d7:	49 39 c4             	cmp    %rax,%r12
+  8040da:	0f 85 92 01 00 00    	jne    804272 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  8040e0:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  8040e7:	00 00 00 
+  8040ea:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  8040f1:	48 01 d0             	add    %rdx,%rax
+  8040f4:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  8040f8:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  8040ff:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  804103:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  80410a:	00 00 00 
+  80410d:	48 01 d0             	add    %rdx,%rax
+  804110:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  804117:	48 be 20 a0 80 01 00 	movabs $0x180a020,%rsi
+  80411e:	00 00 00 
+  804121:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  804128:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  80412c:	48 bf 25 3e 80 00 00 	movabs $0x803e25,%rdi
+  804133:	00 00 00 
+  804136:	48 b8 19 4d 80 00 00 	movabs $0x804d19,%rax
+  80413d:	00 00 00 
+  804140:	ff d0                	call   *%rax
+  804142:	41 89 c4             	mov    %eax,%r12d
+  804145:	85 c0                	test   %eax,%eax
+  804147:	0f 88 24 04 00 00    	js     804571 <spawn+0x683>
+    img.nshared = shared.count;
+  80414d:	48 a1 20 b8 80 01 00 	movabs 0x180b820,%rax
+  804154:	00 00 00 
+  804157:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  80415e:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  804165:	00 
+  804166:	74 1f                	je     804187 <spawn+0x299>
+        res = sys_spawn(&img);
+  804168:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  80416f:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+  80417b:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  80417e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  804181:	0f 85 ca 03 00 00    	jne    804551 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  804187:	ba 00 02 00 00       	mov    $0x200,%edx
+  80418c:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  804193:	44 89 f7             	mov    %r14d,%edi
+  804196:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  80419d:	00 00 00 
+  8041a0:	ff d0                	call   *%rax
+  8041a2:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8041a4:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8041a9:	0f 85 f8 00 00 00    	jne    8042a7 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8041af:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8041b6:	ff ff 00 
+  8041b9:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8041c0:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  8041c7:	01 01 00 
+  8041ca:	48 39 d0             	cmp    %rdx,%rax
+  8041cd:	0f 85 f7 00 00 00    	jne    8042ca <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8041d3:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  8041da:	00 3e 00 
+  8041dd:	0f 85 e7 00 00 00    	jne    8042ca <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  8041e3:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  8041ea:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  8041f1:	ff 
+  8041f2:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  8041f9:	00 
+  8041fa:	4c 29 c0             	sub    %r8,%rax
+  8041fd:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  804201:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804207:	0f 87 bd 00 00 00    	ja     8042ca <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80420d:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804214:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804215:	4d 85 c0             	test   %r8,%r8
+  804218:	0f 84 1b 02 00 00    	je     804439 <spawn+0x54b>
+  80421e:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  804223:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80422a:	00 00 01 00 
+  80422e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804234:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  80423b:	00 00 00 
+  80423e:	e9 d4 00 00 00       	jmp    804317 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804243:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  80424a:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80424e:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  804255:	00 00 00 
+  804258:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  80425f:	48 8d 40 08          	lea    0x8(%rax),%rax
+  804263:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  80426a:	49 89 c4             	mov    %rax,%r12
+  80426d:	e9 4c fe ff ff       	jmp    8040be <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  804272:	48 b9 50 6c 80 00 00 	movabs $0x806c50,%rcx
+  804279:	00 00 00 
+  80427c:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  804283:	00 00 00 
+  804286:	be e2 00 00 00       	mov    $0xe2,%esi
+  80428b:	48 bf a9 6c 80 00 00 	movabs $0x806ca9,%rdi
+  804292:	00 00 00 
+  804295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429a:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  8042a1:	00 00 00 
+  8042a4:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8042a7:	48 bf 80 6c 80 00 00 	movabs $0x806c80,%rdi
+  8042ae:	00 00 00 
+  8042b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b6:	48 ba a2 17 80 00 00 	movabs $0x8017a2,%rdx
+  8042bd:	00 00 00 
+  8042c0:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  8042c2:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8042c8:	eb 2c                	jmp    8042f6 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8042ca:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  8042cf:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  8042d5:	48 bf b5 6c 80 00 00 	movabs $0x806cb5,%rdi
+  8042dc:	00 00 00 
+  8042df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e4:	48 b9 a2 17 80 00 00 	movabs $0x8017a2,%rcx
+  8042eb:	00 00 00 
+  8042ee:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  8042f0:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8042f6:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8042fd:	00 00 01 00 
+  804301:	e9 76 02 00 00       	jmp    80457c <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804306:	48 83 c2 01          	add    $0x1,%rdx
+  80430a:	48 83 c0 38          	add    $0x38,%rax
+  80430e:	49 39 d0             	cmp    %rdx,%r8
+  804311:	0f 84 a5 00 00 00    	je     8043bc <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804317:	83 38 01             	cmpl   $0x1,(%rax)
+  80431a:	75 ea                	jne    804306 <spawn+0x418>
+  80431c:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  804320:	48 85 f6             	test   %rsi,%rsi
+  804323:	74 e1                	je     804306 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804325:	49 83 ff 10          	cmp    $0x10,%r15
+  804329:	0f 84 a1 02 00 00    	je     8045d0 <spawn+0x6e2>
+  80432f:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  804333:	0f 82 aa 02 00 00    	jb     8045e3 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  804339:	8b 78 04             	mov    0x4(%rax),%edi
+  80433c:	89 f9                	mov    %edi,%ecx
+  80433e:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  804341:	41 89 c9             	mov    %ecx,%r9d
+  804344:	41 83 c9 04          	or     $0x4,%r9d
+  804348:	40 f6 c7 04          	test   $0x4,%dil
+  80434c:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  804350:	41 89 c9             	mov    %ecx,%r9d
+  804353:	41 83 c9 01          	or     $0x1,%r9d
+  804357:	40 f6 c7 01          	test   $0x1,%dil
+  80435b:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  80435f:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  804363:	49 89 f9             	mov    %rdi,%r9
+  804366:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  80436d:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  804374:	00 
+  804375:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80437c:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  80437f:	4c 89 ff             	mov    %r15,%rdi
+  804382:	48 c1 e7 05          	shl    $0x5,%rdi
+  804386:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  80438d:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804390:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  804397:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  80439b:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  80439e:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  8043a2:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  8043a6:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  8043a9:	48 01 f3             	add    %rsi,%rbx
+  8043ac:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  8043b3:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  8043b7:	e9 4a ff ff ff       	jmp    804306 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  8043bc:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  8043c3:	00 00 00 
+  8043c6:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  8043cd:	48 39 c8             	cmp    %rcx,%rax
+  8043d0:	0f 82 ef 01 00 00    	jb     8045c5 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  8043d6:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  8043dd:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  8043e4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8043e9:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  8043f0:	00 00 00 
+  8043f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043f8:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  8043ff:	00 00 00 
+  804402:	ff d0                	call   *%rax
+  804404:	41 89 c4             	mov    %eax,%r12d
+  804407:	85 c0                	test   %eax,%eax
+  804409:	0f 88 e7 fe ff ff    	js     8042f6 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80440f:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  804416:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  80441d:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  80441e:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  804425:	00 
+  804426:	0f 84 d3 00 00 00    	je     8044ff <spawn+0x611>
+  80442c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804432:	ba 00 00 00 00       	mov    $0x0,%edx
+  804437:	eb 46                	jmp    80447f <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  804439:	4d 89 c7             	mov    %r8,%r15
+  80443c:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804443:	00 00 01 00 
+  804447:	eb 8d                	jmp    8043d6 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804449:	48 85 c0             	test   %rax,%rax
+  80444c:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  804453:	48 0f 49 c2          	cmovns %rdx,%rax
+  804457:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  80445a:	85 c0                	test   %eax,%eax
+  80445c:	0f 89 c0 00 00 00    	jns    804522 <spawn+0x634>
+  804462:	e9 15 01 00 00       	jmp    80457c <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  804467:	49 83 c5 01          	add    $0x1,%r13
+  80446b:	48 83 c3 38          	add    $0x38,%rbx
+  80446f:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  804476:	49 39 c5             	cmp    %rax,%r13
+  804479:	0f 83 80 00 00 00    	jae    8044ff <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  80447f:	83 3b 01             	cmpl   $0x1,(%rbx)
+  804482:	75 e3                	jne    804467 <spawn+0x579>
+  804484:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  804489:	74 dc                	je     804467 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  80448b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80448f:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  804496:	48 c1 e2 05          	shl    $0x5,%rdx
+  80449a:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80449e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8044a3:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  8044aa:	ff 
+  8044ab:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  8044b2:	8b 73 08             	mov    0x8(%rbx),%esi
+  8044b5:	44 89 f7             	mov    %r14d,%edi
+  8044b8:	48 ba f5 33 80 00 00 	movabs $0x8033f5,%rdx
+  8044bf:	00 00 00 
+  8044c2:	ff d2                	call   *%rdx
+  8044c4:	41 89 c4             	mov    %eax,%r12d
+  8044c7:	85 c0                	test   %eax,%eax
+  8044c9:	0f 88 ad 00 00 00    	js     80457c <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  8044cf:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  8044d3:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  8044da:	44 89 f7             	mov    %r14d,%edi
+  8044dd:	48 b8 cb 32 80 00 00 	movabs $0x8032cb,%rax
+  8044e4:	00 00 00 
+  8044e7:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  8044e9:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  8044ed:	0f 85 56 ff ff ff    	jne    804449 <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  8044f3:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  8044fa:	e9 68 ff ff ff       	jmp    804467 <spawn+0x579>
+    img->entry = elf->e_entry;
+  8044ff:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  804506:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  80450d:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804514:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  80451b:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  804522:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804529:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+  804535:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  804538:	45 85 e4             	test   %r12d,%r12d
+  80453b:	78 3f                	js     80457c <spawn+0x68e>
+    close(fd);
+  80453d:	44 89 f7             	mov    %r14d,%edi
+  804540:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  804547:	00 00 00 
+  80454a:	ff d0                	call   *%rax
+    return res;
+  80454c:	45 89 e6             	mov    %r12d,%r14d
+  80454f:	eb 5f                	jmp    8045b0 <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  804551:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804558:	00 00 01 00 
+  80455c:	eb da                	jmp    804538 <spawn+0x64a>
+  80455e:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804565:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804569:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  80456f:	eb 0b                	jmp    80457c <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804571:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804578:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  80457c:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  804583:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  80458a:	00 00 00 
+  80458d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804592:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  804599:	00 00 00 
+  80459c:	ff d0                	call   *%rax
+    close(fd);
+  80459e:	44 89 f7             	mov    %r14d,%edi
+  8045a1:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  8045a8:	00 00 00 
+  8045ab:	ff d0                	call   *%rax
+    return res;
+  8045ad:	45 89 e6             	mov    %r12d,%r14d
+}
+  8045b0:	44 89 f0             	mov    %r14d,%eax
+  8045b3:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  8045ba:	5b                   	pop    %rbx
+  8045bb:	41 5c                	pop    %r12
+  8045bd:	41 5d                	pop    %r13
+  8045bf:	41 5e                	pop    %r14
+  8045c1:	41 5f                	pop    %r15
+  8045c3:	5d                   	pop    %rbp
+  8045c4:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  8045c5:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  8045cb:	e9 26 fd ff ff       	jmp    8042f6 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  8045d0:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8045d7:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  8045db:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8045e1:	eb 99                	jmp    80457c <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  8045e3:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8045ea:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  8045ee:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  8045f4:	eb 86                	jmp    80457c <spawn+0x68e>
+
+00000000008045f6 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	48 83 ec 50          	sub    $0x50,%rsp
+  8045fe:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804602:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804606:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80460a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80460e:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804615:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804619:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80461d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804621:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804625:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80462a:	eb 15                	jmp    804641 <spawnl+0x4b>
+  80462c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804630:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804634:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804638:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80463c:	74 1c                	je     80465a <spawnl+0x64>
+  80463e:	83 c1 01             	add    $0x1,%ecx
+  804641:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804644:	83 f8 2f             	cmp    $0x2f,%eax
+  804647:	77 e3                	ja     80462c <spawnl+0x36>
+  804649:	89 c2                	mov    %eax,%edx
+  80464b:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  80464f:	4c 01 d2             	add    %r10,%rdx
+  804652:	83 c0 08             	add    $0x8,%eax
+  804655:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804658:	eb de                	jmp    804638 <spawnl+0x42>
+    const char *argv[argc + 2];
+  80465a:	8d 41 02             	lea    0x2(%rcx),%eax
+  80465d:	48 98                	cltq
+  80465f:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804666:	00 
+  804667:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  80466b:	48 29 c4             	sub    %rax,%rsp
+  80466e:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804673:	4c 89 c0             	mov    %r8,%rax
+  804676:	48 c1 e8 03          	shr    $0x3,%rax
+  80467a:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  80467e:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804685:	00 
+    argv[argc + 1] = NULL;
+  804686:	8d 41 01             	lea    0x1(%rcx),%eax
+  804689:	48 98                	cltq
+  80468b:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804692:	00 
+    va_start(vl, arg0);
+  804693:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80469a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80469e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8046a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8046aa:	85 c9                	test   %ecx,%ecx
+  8046ac:	74 41                	je     8046ef <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8046ae:	49 89 c1             	mov    %rax,%r9
+  8046b1:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8046b5:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8046b8:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8046bd:	eb 1b                	jmp    8046da <spawnl+0xe4>
+  8046bf:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8046c3:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8046c7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8046cb:	48 8b 11             	mov    (%rcx),%rdx
+  8046ce:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8046d1:	48 83 c0 08          	add    $0x8,%rax
+  8046d5:	48 39 f0             	cmp    %rsi,%rax
+  8046d8:	74 15                	je     8046ef <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8046da:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8046dd:	83 fa 2f             	cmp    $0x2f,%edx
+  8046e0:	77 dd                	ja     8046bf <spawnl+0xc9>
+  8046e2:	89 d1                	mov    %edx,%ecx
+  8046e4:	4c 01 c9             	add    %r9,%rcx
+  8046e7:	83 c2 08             	add    $0x8,%edx
+  8046ea:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8046ed:	eb dc                	jmp    8046cb <spawnl+0xd5>
+    return spawn(prog, argv);
+  8046ef:	4c 89 c6             	mov    %r8,%rsi
+  8046f2:	48 b8 ee 3e 80 00 00 	movabs $0x803eee,%rax
+  8046f9:	00 00 00 
+  8046fc:	ff d0                	call   *%rax
+}
+  8046fe:	c9                   	leave
+  8046ff:	c3                   	ret
+
+0000000000804700 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804700:	55                   	push   %rbp
+  804701:	48 89 e5             	mov    %rsp,%rbp
+  804704:	41 54                	push   %r12
+  804706:	53                   	push   %rbx
+  804707:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80470a:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  804711:	00 00 00 
+  804714:	ff d0                	call   *%rax
+  804716:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804719:	48 be cf 6c 80 00 00 	movabs $0x806ccf,%rsi
+  804720:	00 00 00 
+  804723:	48 89 df             	mov    %rbx,%rdi
+  804726:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  80472d:	00 00 00 
+  804730:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804732:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804737:	41 2b 04 24          	sub    (%r12),%eax
+  80473b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804741:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804748:	00 00 00 
+    stat->st_dev = &devpipe;
+  80474b:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804752:	00 00 00 
+  804755:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80475c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804761:	5b                   	pop    %rbx
+  804762:	41 5c                	pop    %r12
+  804764:	5d                   	pop    %rbp
+  804765:	c3                   	ret
+
+0000000000804766 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804766:	55                   	push   %rbp
+  804767:	48 89 e5             	mov    %rsp,%rbp
+  80476a:	41 54                	push   %r12
+  80476c:	53                   	push   %rbx
+  80476d:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804770:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804775:	48 89 fe             	mov    %rdi,%rsi
+  804778:	bf 00 00 00 00       	mov    $0x0,%edi
+  80477d:	49 bc 16 29 80 00 00 	movabs $0x802916,%r12
+  804784:	00 00 00 
+  804787:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80478a:	48 89 df             	mov    %rbx,%rdi
+  80478d:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  804794:	00 00 00 
+  804797:	ff d0                	call   *%rax
+  804799:	48 89 c6             	mov    %rax,%rsi
+  80479c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a6:	41 ff d4             	call   *%r12
+}
+  8047a9:	5b                   	pop    %rbx
+  8047aa:	41 5c                	pop    %r12
+  8047ac:	5d                   	pop    %rbp
+  8047ad:	c3                   	ret
+
+00000000008047ae <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8047ae:	55                   	push   %rbp
+  8047af:	48 89 e5             	mov    %rsp,%rbp
+  8047b2:	41 57                	push   %r15
+  8047b4:	41 56                	push   %r14
+  8047b6:	41 55                	push   %r13
+  8047b8:	41 54                	push   %r12
+  8047ba:	53                   	push   %rbx
+  8047bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8047bf:	49 89 fc             	mov    %rdi,%r12
+  8047c2:	49 89 f5             	mov    %rsi,%r13
+  8047c5:	49 89 d7             	mov    %rdx,%r15
+  8047c8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8047cc:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  8047d3:	00 00 00 
+  8047d6:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8047d8:	4d 85 ff             	test   %r15,%r15
+  8047db:	0f 84 af 00 00 00    	je     804890 <devpipe_write+0xe2>
+  8047e1:	48 89 c3             	mov    %rax,%rbx
+  8047e4:	4c 89 f8             	mov    %r15,%rax
+  8047e7:	4d 89 ef             	mov    %r13,%r15
+  8047ea:	4c 01 e8             	add    %r13,%rax
+  8047ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047f1:	49 bd 0c 28 80 00 00 	movabs $0x80280c,%r13
+  8047f8:	00 00 00 
+            sys_yield();
+  8047fb:	49 be 9d 27 80 00 00 	movabs $0x80279d,%r14
+  804802:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804805:	8b 73 04             	mov    0x4(%rbx),%esi
+  804808:	48 63 ce             	movslq %esi,%rcx
+  80480b:	48 63 03             	movslq (%rbx),%rax
+  80480e:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804814:	48 39 c1             	cmp    %rax,%rcx
+  804817:	72 2e                	jb     804847 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804819:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80481e:	48 89 da             	mov    %rbx,%rdx
+  804821:	be 00 10 00 00       	mov    $0x1000,%esi
+  804826:	4c 89 e7             	mov    %r12,%rdi
+  804829:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80482c:	85 c0                	test   %eax,%eax
+  80482e:	74 66                	je     804896 <devpipe_write+0xe8>
+            sys_yield();
+  804830:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804833:	8b 73 04             	mov    0x4(%rbx),%esi
+  804836:	48 63 ce             	movslq %esi,%rcx
+  804839:	48 63 03             	movslq (%rbx),%rax
+  80483c:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804842:	48 39 c1             	cmp    %rax,%rcx
+  804845:	73 d2                	jae    804819 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804847:	41 0f b6 3f          	movzbl (%r15),%edi
+  80484b:	48 89 ca             	mov    %rcx,%rdx
+  80484e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804852:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804859:	08 10 20 
+  80485c:	48 f7 e2             	mul    %rdx
+  80485f:	48 c1 ea 06          	shr    $0x6,%rdx
+  804863:	48 89 d0             	mov    %rdx,%rax
+  804866:	48 c1 e0 09          	shl    $0x9,%rax
+  80486a:	48 29 d0             	sub    %rdx,%rax
+  80486d:	48 c1 e0 03          	shl    $0x3,%rax
+  804871:	48 29 c1             	sub    %rax,%rcx
+  804874:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804879:	83 c6 01             	add    $0x1,%esi
+  80487c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80487f:	49 83 c7 01          	add    $0x1,%r15
+  804883:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804887:	49 39 c7             	cmp    %rax,%r15
+  80488a:	0f 85 75 ff ff ff    	jne    804805 <devpipe_write+0x57>
+    return n;
+  804890:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804894:	eb 05                	jmp    80489b <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804896:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80489b:	48 83 c4 18          	add    $0x18,%rsp
+  80489f:	5b                   	pop    %rbx
+  8048a0:	41 5c                	pop    %r12
+  8048a2:	41 5d                	pop    %r13
+  8048a4:	41 5e                	pop    %r14
+  8048a6:	41 5f                	pop    %r15
+  8048a8:	5d                   	pop    %rbp
+  8048a9:	c3                   	ret
+
+00000000008048aa <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8048aa:	55                   	push   %rbp
+  8048ab:	48 89 e5             	mov    %rsp,%rbp
+  8048ae:	41 57                	push   %r15
+  8048b0:	41 56                	push   %r14
+  8048b2:	41 55                	push   %r13
+  8048b4:	41 54                	push   %r12
+  8048b6:	53                   	push   %rbx
+  8048b7:	48 83 ec 18          	sub    $0x18,%rsp
+  8048bb:	49 89 fc             	mov    %rdi,%r12
+  8048be:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8048c2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8048c6:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  8048cd:	00 00 00 
+  8048d0:	ff d0                	call   *%rax
+  8048d2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8048d5:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8048db:	49 bd 0c 28 80 00 00 	movabs $0x80280c,%r13
+  8048e2:	00 00 00 
+            sys_yield();
+  8048e5:	49 be 9d 27 80 00 00 	movabs $0x80279d,%r14
+  8048ec:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8048ef:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8048f4:	74 7d                	je     804973 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8048f6:	8b 03                	mov    (%rbx),%eax
+  8048f8:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8048fb:	75 26                	jne    804923 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8048fd:	4d 85 ff             	test   %r15,%r15
+  804900:	75 77                	jne    804979 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804902:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804907:	48 89 da             	mov    %rbx,%rdx
+  80490a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80490f:	4c 89 e7             	mov    %r12,%rdi
+  804912:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804915:	85 c0                	test   %eax,%eax
+  804917:	74 72                	je     80498b <devpipe_read+0xe1>
+            sys_yield();
+  804919:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80491c:	8b 03                	mov    (%rbx),%eax
+  80491e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804921:	74 df                	je     804902 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804923:	48 63 c8             	movslq %eax,%rcx
+  804926:	48 89 ca             	mov    %rcx,%rdx
+  804929:	48 c1 ea 03          	shr    $0x3,%rdx
+  80492d:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804934:	08 10 20 
+  804937:	48 89 d0             	mov    %rdx,%rax
+  80493a:	48 f7 e6             	mul    %rsi
+  80493d:	48 c1 ea 06          	shr    $0x6,%rdx
+  804941:	48 89 d0             	mov    %rdx,%rax
+  804944:	48 c1 e0 09          	shl    $0x9,%rax
+  804948:	48 29 d0             	sub    %rdx,%rax
+  80494b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804952:	00 
+  804953:	48 89 c8             	mov    %rcx,%rax
+  804956:	48 29 d0             	sub    %rdx,%rax
+  804959:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80495e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804962:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804966:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804969:	49 83 c7 01          	add    $0x1,%r15
+  80496d:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804971:	75 83                	jne    8048f6 <devpipe_read+0x4c>
+    return n;
+  804973:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804977:	eb 03                	jmp    80497c <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804979:	4c 89 f8             	mov    %r15,%rax
+}
+  80497c:	48 83 c4 18          	add    $0x18,%rsp
+  804980:	5b                   	pop    %rbx
+  804981:	41 5c                	pop    %r12
+  804983:	41 5d                	pop    %r13
+  804985:	41 5e                	pop    %r14
+  804987:	41 5f                	pop    %r15
+  804989:	5d                   	pop    %rbp
+  80498a:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80498b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804990:	eb ea                	jmp    80497c <devpipe_read+0xd2>
+
+0000000000804992 <pipe>:
+pipe(int pfd[2]) {
+  804992:	55                   	push   %rbp
+  804993:	48 89 e5             	mov    %rsp,%rbp
+  804996:	41 55                	push   %r13
+  804998:	41 54                	push   %r12
+  80499a:	53                   	push   %rbx
+  80499b:	48 83 ec 18          	sub    $0x18,%rsp
+  80499f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8049a2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8049a6:	48 b8 ca 2e 80 00 00 	movabs $0x802eca,%rax
+  8049ad:	00 00 00 
+  8049b0:	ff d0                	call   *%rax
+  8049b2:	89 c3                	mov    %eax,%ebx
+  8049b4:	85 c0                	test   %eax,%eax
+  8049b6:	0f 88 a0 01 00 00    	js     804b5c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8049bc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049c6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8049ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049cf:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  8049d6:	00 00 00 
+  8049d9:	ff d0                	call   *%rax
+  8049db:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8049dd:	85 c0                	test   %eax,%eax
+  8049df:	0f 88 77 01 00 00    	js     804b5c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049e5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8049e9:	48 b8 ca 2e 80 00 00 	movabs $0x802eca,%rax
+  8049f0:	00 00 00 
+  8049f3:	ff d0                	call   *%rax
+  8049f5:	89 c3                	mov    %eax,%ebx
+  8049f7:	85 c0                	test   %eax,%eax
+  8049f9:	0f 88 43 01 00 00    	js     804b42 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8049ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a09:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a12:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  804a19:	00 00 00 
+  804a1c:	ff d0                	call   *%rax
+  804a1e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804a20:	85 c0                	test   %eax,%eax
+  804a22:	0f 88 1a 01 00 00    	js     804b42 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804a28:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a2c:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  804a33:	00 00 00 
+  804a36:	ff d0                	call   *%rax
+  804a38:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804a3b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a40:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a45:	48 89 c6             	mov    %rax,%rsi
+  804a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a4d:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  804a54:	00 00 00 
+  804a57:	ff d0                	call   *%rax
+  804a59:	89 c3                	mov    %eax,%ebx
+  804a5b:	85 c0                	test   %eax,%eax
+  804a5d:	0f 88 c5 00 00 00    	js     804b28 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804a63:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804a67:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  804a6e:	00 00 00 
+  804a71:	ff d0                	call   *%rax
+  804a73:	48 89 c1             	mov    %rax,%rcx
+  804a76:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804a7c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a82:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a87:	4c 89 ee             	mov    %r13,%rsi
+  804a8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a8f:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  804a96:	00 00 00 
+  804a99:	ff d0                	call   *%rax
+  804a9b:	89 c3                	mov    %eax,%ebx
+  804a9d:	85 c0                	test   %eax,%eax
+  804a9f:	78 6e                	js     804b0f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804aa1:	be 00 10 00 00       	mov    $0x1000,%esi
+  804aa6:	4c 89 ef             	mov    %r13,%rdi
+  804aa9:	48 b8 d4 27 80 00 00 	movabs $0x8027d4,%rax
+  804ab0:	00 00 00 
+  804ab3:	ff d0                	call   *%rax
+  804ab5:	83 f8 02             	cmp    $0x2,%eax
+  804ab8:	0f 85 ab 00 00 00    	jne    804b69 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804abe:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804ac5:	00 00 
+  804ac7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804acb:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804acd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804ad1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804ad8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804adc:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804ade:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ae2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804ae9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804aed:	48 bb 9c 2e 80 00 00 	movabs $0x802e9c,%rbx
+  804af4:	00 00 00 
+  804af7:	ff d3                	call   *%rbx
+  804af9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804afd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804b01:	ff d3                	call   *%rbx
+  804b03:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804b08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804b0d:	eb 4d                	jmp    804b5c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804b0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b14:	4c 89 ee             	mov    %r13,%rsi
+  804b17:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b1c:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  804b23:	00 00 00 
+  804b26:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804b28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b2d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804b31:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b36:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  804b3d:	00 00 00 
+  804b40:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804b42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804b4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b50:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  804b57:	00 00 00 
+  804b5a:	ff d0                	call   *%rax
+}
+  804b5c:	89 d8                	mov    %ebx,%eax
+  804b5e:	48 83 c4 18          	add    $0x18,%rsp
+  804b62:	5b                   	pop    %rbx
+  804b63:	41 5c                	pop    %r12
+  804b65:	41 5d                	pop    %r13
+  804b67:	5d                   	pop    %rbp
+  804b68:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804b69:	48 b9 e8 6c 80 00 00 	movabs $0x806ce8,%rcx
+  804b70:	00 00 00 
+  804b73:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  804b7a:	00 00 00 
+  804b7d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804b82:	48 bf d6 6c 80 00 00 	movabs $0x806cd6,%rdi
+  804b89:	00 00 00 
+  804b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b91:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  804b98:	00 00 00 
+  804b9b:	41 ff d0             	call   *%r8
+
+0000000000804b9e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804b9e:	55                   	push   %rbp
+  804b9f:	48 89 e5             	mov    %rsp,%rbp
+  804ba2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ba6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804baa:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  804bb1:	00 00 00 
+  804bb4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804bb6:	85 c0                	test   %eax,%eax
+  804bb8:	78 35                	js     804bef <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804bba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804bbe:	48 b8 ae 2e 80 00 00 	movabs $0x802eae,%rax
+  804bc5:	00 00 00 
+  804bc8:	ff d0                	call   *%rax
+  804bca:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804bcd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804bd2:	be 00 10 00 00       	mov    $0x1000,%esi
+  804bd7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804bdb:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  804be2:	00 00 00 
+  804be5:	ff d0                	call   *%rax
+  804be7:	85 c0                	test   %eax,%eax
+  804be9:	0f 94 c0             	sete   %al
+  804bec:	0f b6 c0             	movzbl %al,%eax
+}
+  804bef:	c9                   	leave
+  804bf0:	c3                   	ret
+
+0000000000804bf1 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804bf1:	48 89 f8             	mov    %rdi,%rax
+  804bf4:	48 c1 e8 27          	shr    $0x27,%rax
+  804bf8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804bff:	01 00 00 
+  804c02:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c06:	f6 c2 01             	test   $0x1,%dl
+  804c09:	74 6d                	je     804c78 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c0b:	48 89 f8             	mov    %rdi,%rax
+  804c0e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804c12:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c19:	01 00 00 
+  804c1c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c20:	f6 c2 01             	test   $0x1,%dl
+  804c23:	74 62                	je     804c87 <get_uvpt_entry+0x96>
+  804c25:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c2c:	01 00 00 
+  804c2f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c33:	f6 c2 80             	test   $0x80,%dl
+  804c36:	75 4f                	jne    804c87 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804c38:	48 89 f8             	mov    %rdi,%rax
+  804c3b:	48 c1 e8 15          	shr    $0x15,%rax
+  804c3f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c46:	01 00 00 
+  804c49:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c4d:	f6 c2 01             	test   $0x1,%dl
+  804c50:	74 44                	je     804c96 <get_uvpt_entry+0xa5>
+  804c52:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c59:	01 00 00 
+  804c5c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c60:	f6 c2 80             	test   $0x80,%dl
+  804c63:	75 31                	jne    804c96 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804c65:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804c69:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804c70:	01 00 00 
+  804c73:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804c77:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804c78:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804c7f:	01 00 00 
+  804c82:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c86:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c87:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c8e:	01 00 00 
+  804c91:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c95:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804c96:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c9d:	01 00 00 
+  804ca0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ca4:	c3                   	ret
+
+0000000000804ca5 <get_prot>:
+
+int
+get_prot(void *va) {
+  804ca5:	55                   	push   %rbp
+  804ca6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804ca9:	48 b8 f1 4b 80 00 00 	movabs $0x804bf1,%rax
+  804cb0:	00 00 00 
+  804cb3:	ff d0                	call   *%rax
+  804cb5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804cb8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804cbd:	89 c1                	mov    %eax,%ecx
+  804cbf:	83 c9 04             	or     $0x4,%ecx
+  804cc2:	f6 c2 01             	test   $0x1,%dl
+  804cc5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804cc8:	89 c1                	mov    %eax,%ecx
+  804cca:	83 c9 02             	or     $0x2,%ecx
+  804ccd:	f6 c2 02             	test   $0x2,%dl
+  804cd0:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804cd3:	89 c1                	mov    %eax,%ecx
+  804cd5:	83 c9 01             	or     $0x1,%ecx
+  804cd8:	48 85 d2             	test   %rdx,%rdx
+  804cdb:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804cde:	89 c1                	mov    %eax,%ecx
+  804ce0:	83 c9 40             	or     $0x40,%ecx
+  804ce3:	f6 c6 04             	test   $0x4,%dh
+  804ce6:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804ce9:	5d                   	pop    %rbp
+  804cea:	c3                   	ret
+
+0000000000804ceb <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804ceb:	55                   	push   %rbp
+  804cec:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804cef:	48 b8 f1 4b 80 00 00 	movabs $0x804bf1,%rax
+  804cf6:	00 00 00 
+  804cf9:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804cfb:	48 c1 e8 06          	shr    $0x6,%rax
+  804cff:	83 e0 01             	and    $0x1,%eax
+}
+  804d02:	5d                   	pop    %rbp
+  804d03:	c3                   	ret
+
+0000000000804d04 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804d04:	55                   	push   %rbp
+  804d05:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804d08:	48 b8 f1 4b 80 00 00 	movabs $0x804bf1,%rax
+  804d0f:	00 00 00 
+  804d12:	ff d0                	call   *%rax
+  804d14:	83 e0 01             	and    $0x1,%eax
+}
+  804d17:	5d                   	pop    %rbp
+  804d18:	c3                   	ret
+
+0000000000804d19 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804d19:	55                   	push   %rbp
+  804d1a:	48 89 e5             	mov    %rsp,%rbp
+  804d1d:	41 57                	push   %r15
+  804d1f:	41 56                	push   %r14
+  804d21:	41 55                	push   %r13
+  804d23:	41 54                	push   %r12
+  804d25:	53                   	push   %rbx
+  804d26:	48 83 ec 28          	sub    $0x28,%rsp
+  804d2a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804d2e:	48 85 ff             	test   %rdi,%rdi
+  804d31:	74 1e                	je     804d51 <foreach_shared_region+0x38>
+  804d33:	49 89 ff             	mov    %rdi,%r15
+  804d36:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804d3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804d42:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804d49:	01 00 00 
+  804d4c:	e9 72 02 00 00       	jmp    804fc3 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804d51:	48 b9 0c 6d 80 00 00 	movabs $0x806d0c,%rcx
+  804d58:	00 00 00 
+  804d5b:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  804d62:	00 00 00 
+  804d65:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804d6a:	48 bf 10 6d 80 00 00 	movabs $0x806d10,%rdi
+  804d71:	00 00 00 
+  804d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d79:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  804d80:	00 00 00 
+  804d83:	41 ff d0             	call   *%r8
+  804d86:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804d8d:	eb 6c                	jmp    804dfb <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804d8f:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804d96:	ff ff ff 
+  804d99:	4c 21 e2             	and    %r12,%rdx
+  804d9c:	48 89 d8             	mov    %rbx,%rax
+  804d9f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804da4:	48 83 c0 01          	add    $0x1,%rax
+  804da8:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804dac:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804db3:	00 00 00 
+  804db6:	48 21 c8             	and    %rcx,%rax
+  804db9:	48 09 d0             	or     %rdx,%rax
+  804dbc:	49 89 c4             	mov    %rax,%r12
+  804dbf:	eb 30                	jmp    804df1 <foreach_shared_region+0xd8>
+  804dc1:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804dc8:	ff ff ff 
+  804dcb:	4c 21 e2             	and    %r12,%rdx
+  804dce:	48 89 d8             	mov    %rbx,%rax
+  804dd1:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804dd6:	48 83 c0 01          	add    $0x1,%rax
+  804dda:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804dde:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804de5:	00 00 00 
+  804de8:	48 21 c8             	and    %rcx,%rax
+  804deb:	48 09 d0             	or     %rdx,%rax
+  804dee:	49 89 c4             	mov    %rax,%r12
+  804df1:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804df5:	0f 84 99 01 00 00    	je     804f94 <foreach_shared_region+0x27b>
+  804dfb:	4c 89 e3             	mov    %r12,%rbx
+  804dfe:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804e02:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804e09:	01 00 00 
+  804e0c:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804e10:	a8 01                	test   $0x1,%al
+  804e12:	0f 84 77 ff ff ff    	je     804d8f <foreach_shared_region+0x76>
+  804e18:	a8 80                	test   $0x80,%al
+  804e1a:	74 19                	je     804e35 <foreach_shared_region+0x11c>
+  804e1c:	f6 c4 04             	test   $0x4,%ah
+  804e1f:	74 a0                	je     804dc1 <foreach_shared_region+0xa8>
+  804e21:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804e28:	40 
+  804e29:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e2d:	4c 89 e7             	mov    %r12,%rdi
+  804e30:	41 ff d7             	call   *%r15
+  804e33:	eb 8c                	jmp    804dc1 <foreach_shared_region+0xa8>
+  804e35:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804e3c:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804e40:	eb 46                	jmp    804e88 <foreach_shared_region+0x16f>
+  804e42:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804e49:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e4f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804e53:	48 c1 e0 15          	shl    $0x15,%rax
+  804e57:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804e5c:	49 09 c4             	or     %rax,%r12
+  804e5f:	eb 1d                	jmp    804e7e <foreach_shared_region+0x165>
+  804e61:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804e68:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804e6e:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804e72:	48 c1 e0 15          	shl    $0x15,%rax
+  804e76:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804e7b:	49 09 c4             	or     %rax,%r12
+  804e7e:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804e82:	0f 84 d3 00 00 00    	je     804f5b <foreach_shared_region+0x242>
+  804e88:	4c 89 e3             	mov    %r12,%rbx
+  804e8b:	48 c1 eb 15          	shr    $0x15,%rbx
+  804e8f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804e96:	01 00 00 
+  804e99:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804e9d:	a8 01                	test   $0x1,%al
+  804e9f:	74 a1                	je     804e42 <foreach_shared_region+0x129>
+  804ea1:	a8 80                	test   $0x80,%al
+  804ea3:	74 19                	je     804ebe <foreach_shared_region+0x1a5>
+  804ea5:	f6 c4 04             	test   $0x4,%ah
+  804ea8:	74 b7                	je     804e61 <foreach_shared_region+0x148>
+  804eaa:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804eb1:	00 
+  804eb2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804eb6:	4c 89 e7             	mov    %r12,%rdi
+  804eb9:	41 ff d7             	call   *%r15
+  804ebc:	eb a3                	jmp    804e61 <foreach_shared_region+0x148>
+  804ebe:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804ec4:	eb 3b                	jmp    804f01 <foreach_shared_region+0x1e8>
+  804ec6:	f6 c4 04             	test   $0x4,%ah
+  804ec9:	74 12                	je     804edd <foreach_shared_region+0x1c4>
+  804ecb:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804ed2:	00 
+  804ed3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ed7:	4c 89 e7             	mov    %r12,%rdi
+  804eda:	41 ff d7             	call   *%r15
+  804edd:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804ee4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804eea:	48 83 c3 01          	add    $0x1,%rbx
+  804eee:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804ef2:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804ef8:	49 09 dc             	or     %rbx,%r12
+  804efb:	41 83 ed 01          	sub    $0x1,%r13d
+  804eff:	74 2f                	je     804f30 <foreach_shared_region+0x217>
+  804f01:	4c 89 e3             	mov    %r12,%rbx
+  804f04:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804f08:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804f0c:	a8 01                	test   $0x1,%al
+  804f0e:	75 b6                	jne    804ec6 <foreach_shared_region+0x1ad>
+  804f10:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804f17:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804f1d:	48 83 c3 01          	add    $0x1,%rbx
+  804f21:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804f25:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804f2b:	49 09 dc             	or     %rbx,%r12
+  804f2e:	eb cb                	jmp    804efb <foreach_shared_region+0x1e2>
+  804f30:	4c 89 e0             	mov    %r12,%rax
+  804f33:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804f39:	49 c1 ec 15          	shr    $0x15,%r12
+  804f3d:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804f44:	49 83 c4 01          	add    $0x1,%r12
+  804f48:	49 c1 e4 15          	shl    $0x15,%r12
+  804f4c:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804f53:	49 09 c4             	or     %rax,%r12
+  804f56:	e9 23 ff ff ff       	jmp    804e7e <foreach_shared_region+0x165>
+  804f5b:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804f5f:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804f66:	ff ff ff 
+  804f69:	4c 21 e0             	and    %r12,%rax
+  804f6c:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804f70:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804f77:	49 83 c4 01          	add    $0x1,%r12
+  804f7b:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804f7f:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804f86:	00 00 00 
+  804f89:	49 21 d4             	and    %rdx,%r12
+  804f8c:	49 09 c4             	or     %rax,%r12
+  804f8f:	e9 5d fe ff ff       	jmp    804df1 <foreach_shared_region+0xd8>
+  804f94:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804f9b:	00 ff ff 
+  804f9e:	4c 21 e0             	and    %r12,%rax
+  804fa1:	49 c1 ec 27          	shr    $0x27,%r12
+  804fa5:	49 83 c4 01          	add    $0x1,%r12
+  804fa9:	49 c1 e4 27          	shl    $0x27,%r12
+  804fad:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804fb4:	ff 00 00 
+  804fb7:	49 21 d4             	and    %rdx,%r12
+  804fba:	49 09 c4             	or     %rax,%r12
+  804fbd:	41 83 ed 01          	sub    $0x1,%r13d
+  804fc1:	74 48                	je     80500b <foreach_shared_region+0x2f2>
+  804fc3:	4c 89 e0             	mov    %r12,%rax
+  804fc6:	48 c1 e8 27          	shr    $0x27,%rax
+  804fca:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804fd1:	01 00 00 
+  804fd4:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804fd8:	f6 c2 01             	test   $0x1,%dl
+  804fdb:	0f 85 a5 fd ff ff    	jne    804d86 <foreach_shared_region+0x6d>
+  804fe1:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804fe8:	00 ff ff 
+  804feb:	4c 21 e2             	and    %r12,%rdx
+  804fee:	48 83 c0 01          	add    $0x1,%rax
+  804ff2:	48 c1 e0 27          	shl    $0x27,%rax
+  804ff6:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804ffd:	ff 00 00 
+  805000:	48 21 c8             	and    %rcx,%rax
+  805003:	48 09 d0             	or     %rdx,%rax
+  805006:	49 89 c4             	mov    %rax,%r12
+  805009:	eb b2                	jmp    804fbd <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80500b:	4d 85 e4             	test   %r12,%r12
+  80500e:	75 14                	jne    805024 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  805010:	b8 00 00 00 00       	mov    $0x0,%eax
+  805015:	48 83 c4 28          	add    $0x28,%rsp
+  805019:	5b                   	pop    %rbx
+  80501a:	41 5c                	pop    %r12
+  80501c:	41 5d                	pop    %r13
+  80501e:	41 5e                	pop    %r14
+  805020:	41 5f                	pop    %r15
+  805022:	5d                   	pop    %rbp
+  805023:	c3                   	ret
+    assert(addr == 0);
+  805024:	48 b9 1b 6d 80 00 00 	movabs $0x806d1b,%rcx
+  80502b:	00 00 00 
+  80502e:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  805035:	00 00 00 
+  805038:	be 67 00 00 00       	mov    $0x67,%esi
+  80503d:	48 bf 10 6d 80 00 00 	movabs $0x806d10,%rdi
+  805044:	00 00 00 
+  805047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80504c:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  805053:	00 00 00 
+  805056:	41 ff d0             	call   *%r8
+
+0000000000805059 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  805059:	49 b8 40 bc 80 01 00 	movabs $0x180bc40,%r8
+  805060:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  805063:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  805069:	eb 33                	jmp    80509e <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80506b:	48 83 c0 20          	add    $0x20,%rax
+  80506f:	4c 39 c0             	cmp    %r8,%rax
+  805072:	74 25                	je     805099 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  805074:	48 8b 10             	mov    (%rax),%rdx
+  805077:	48 85 d2             	test   %rdx,%rdx
+  80507a:	74 ef                	je     80506b <mmap_place+0x12>
+  80507c:	48 89 d1             	mov    %rdx,%rcx
+  80507f:	48 03 48 08          	add    0x8(%rax),%rcx
+  805083:	48 39 cf             	cmp    %rcx,%rdi
+  805086:	73 e3                	jae    80506b <mmap_place+0x12>
+  805088:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80508c:	4c 39 ca             	cmp    %r9,%rdx
+  80508f:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  805093:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  805097:	eb d2                	jmp    80506b <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  805099:	45 84 d2             	test   %r10b,%r10b
+  80509c:	74 12                	je     8050b0 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80509e:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  8050a5:	00 00 00 
+        moved = 0;
+  8050a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8050ae:	eb c4                	jmp    805074 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8050b0:	48 01 fe             	add    %rdi,%rsi
+  8050b3:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8050ba:	00 00 00 
+  8050bd:	48 39 f0             	cmp    %rsi,%rax
+  8050c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050c5:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  8050c9:	c3                   	ret
+
+00000000008050ca <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  8050ca:	55                   	push   %rbp
+  8050cb:	48 89 e5             	mov    %rsp,%rbp
+  8050ce:	41 57                	push   %r15
+  8050d0:	41 56                	push   %r14
+  8050d2:	41 55                	push   %r13
+  8050d4:	41 54                	push   %r12
+  8050d6:	53                   	push   %rbx
+  8050d7:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8050db:	48 8b 1f             	mov    (%rdi),%rbx
+  8050de:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050e5:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  8050ec:	00 00 00 
+  8050ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050f4:	eb 12                	jmp    805108 <mmap_pgfault+0x3e>
+  8050f6:	48 83 c2 01          	add    $0x1,%rdx
+  8050fa:	48 83 c0 20          	add    $0x20,%rax
+  8050fe:	48 83 fa 20          	cmp    $0x20,%rdx
+  805102:	0f 84 04 01 00 00    	je     80520c <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805108:	48 8b 08             	mov    (%rax),%rcx
+  80510b:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80510f:	48 39 de             	cmp    %rbx,%rsi
+  805112:	73 e2                	jae    8050f6 <mmap_pgfault+0x2c>
+  805114:	48 03 48 08          	add    0x8(%rax),%rcx
+  805118:	48 39 cb             	cmp    %rcx,%rbx
+  80511b:	73 d9                	jae    8050f6 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80511d:	48 c1 e2 05          	shl    $0x5,%rdx
+  805121:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  805128:	00 00 00 
+  80512b:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80512f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805133:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805137:	f6 c2 01             	test   $0x1,%dl
+  80513a:	0f 84 e0 00 00 00    	je     805220 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805140:	b8 00 00 00 00       	mov    $0x0,%eax
+  805145:	f6 c2 02             	test   $0x2,%dl
+  805148:	0f 84 c3 00 00 00    	je     805211 <mmap_pgfault+0x147>
+  80514e:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805155:	ff ff ff 
+  805158:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80515c:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  805163:	00 00 00 
+  805166:	48 39 ca             	cmp    %rcx,%rdx
+  805169:	0f 85 a2 00 00 00    	jne    805211 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80516f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805174:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805179:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  805180:	00 00 00 
+  805183:	bf 00 00 00 00       	mov    $0x0,%edi
+  805188:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  80518f:	00 00 00 
+  805192:	ff d0                	call   *%rax
+  805194:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  805196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80519b:	85 d2                	test   %edx,%edx
+  80519d:	78 72                	js     805211 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80519f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051a4:	48 89 de             	mov    %rbx,%rsi
+  8051a7:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8051ae:	00 00 00 
+  8051b1:	4c 89 e7             	mov    %r12,%rdi
+  8051b4:	48 b8 90 24 80 00 00 	movabs $0x802490,%rax
+  8051bb:	00 00 00 
+  8051be:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8051c0:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8051c6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8051cc:	48 89 d9             	mov    %rbx,%rcx
+  8051cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051d4:	4c 89 e6             	mov    %r12,%rsi
+  8051d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051dc:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  8051e3:	00 00 00 
+  8051e6:	ff d0                	call   *%rax
+  8051e8:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8051ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051ef:	4c 89 e6             	mov    %r12,%rsi
+  8051f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051f7:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  8051fe:	00 00 00 
+  805201:	ff d0                	call   *%rax
+    return res >= 0;
+  805203:	89 d8                	mov    %ebx,%eax
+  805205:	f7 d0                	not    %eax
+  805207:	c1 e8 1f             	shr    $0x1f,%eax
+  80520a:	eb 05                	jmp    805211 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  80520c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805211:	48 83 c4 18          	add    $0x18,%rsp
+  805215:	5b                   	pop    %rbx
+  805216:	41 5c                	pop    %r12
+  805218:	41 5d                	pop    %r13
+  80521a:	41 5e                	pop    %r14
+  80521c:	41 5f                	pop    %r15
+  80521e:	5d                   	pop    %rbp
+  80521f:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805220:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805224:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805228:	4c 03 30             	add    (%rax),%r14
+  80522b:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  805232:	49 39 c6             	cmp    %rax,%r14
+  805235:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805239:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805240:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805246:	49 bf 04 4d 80 00 00 	movabs $0x804d04,%r15
+  80524d:	00 00 00 
+  805250:	4d 39 f4             	cmp    %r14,%r12
+  805253:	73 1d                	jae    805272 <mmap_pgfault+0x1a8>
+  805255:	4c 89 e7             	mov    %r12,%rdi
+  805258:	41 ff d7             	call   *%r15
+  80525b:	84 c0                	test   %al,%al
+  80525d:	75 13                	jne    805272 <mmap_pgfault+0x1a8>
+  80525f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805266:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80526d:	4d 39 f4             	cmp    %r14,%r12
+  805270:	72 e3                	jb     805255 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805272:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805278:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80527c:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  805280:	74 2a                	je     8052ac <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  805282:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805286:	89 de                	mov    %ebx,%esi
+  805288:	2b 30                	sub    (%rax),%esi
+  80528a:	03 70 1c             	add    0x1c(%rax),%esi
+  80528d:	8b 78 18             	mov    0x18(%rax),%edi
+  805290:	4c 89 e9             	mov    %r13,%rcx
+  805293:	48 89 da             	mov    %rbx,%rdx
+  805296:	48 b8 87 3b 80 00 00 	movabs $0x803b87,%rax
+  80529d:	00 00 00 
+  8052a0:	ff d0                	call   *%rax
+    return res > 0;
+  8052a2:	85 c0                	test   %eax,%eax
+  8052a4:	0f 9f c0             	setg   %al
+  8052a7:	e9 65 ff ff ff       	jmp    805211 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8052ac:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8052b0:	eb d0                	jmp    805282 <mmap_pgfault+0x1b8>
+
+00000000008052b2 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8052b2:	55                   	push   %rbp
+  8052b3:	48 89 e5             	mov    %rsp,%rbp
+  8052b6:	41 57                	push   %r15
+  8052b8:	41 56                	push   %r14
+  8052ba:	41 55                	push   %r13
+  8052bc:	41 54                	push   %r12
+  8052be:	53                   	push   %rbx
+  8052bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8052c3:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8052c7:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8052ca:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8052d1:	ff ff ff 
+  8052d4:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8052d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052dd:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8052e4:	00 00 00 
+  8052e7:	48 39 ca             	cmp    %rcx,%rdx
+  8052ea:	0f 85 e5 00 00 00    	jne    8053d5 <mmap_writeback+0x123>
+  8052f0:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8052f3:	4c 39 ee             	cmp    %r13,%rsi
+  8052f6:	0f 83 e8 00 00 00    	jae    8053e4 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8052fc:	49 be 04 4d 80 00 00 	movabs $0x804d04,%r14
+  805303:	00 00 00 
+  805306:	49 bf eb 4c 80 00 00 	movabs $0x804ceb,%r15
+  80530d:	00 00 00 
+  805310:	eb 10                	jmp    805322 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  805312:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805319:	4d 39 ec             	cmp    %r13,%r12
+  80531c:	0f 83 ae 00 00 00    	jae    8053d0 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805322:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805326:	4c 89 e7             	mov    %r12,%rdi
+  805329:	41 ff d6             	call   *%r14
+  80532c:	84 c0                	test   %al,%al
+  80532e:	74 e2                	je     805312 <mmap_writeback+0x60>
+  805330:	4c 89 e7             	mov    %r12,%rdi
+  805333:	41 ff d7             	call   *%r15
+  805336:	84 c0                	test   %al,%al
+  805338:	74 d8                	je     805312 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  80533a:	4c 89 e3             	mov    %r12,%rbx
+  80533d:	4d 39 ec             	cmp    %r13,%r12
+  805340:	73 20                	jae    805362 <mmap_writeback+0xb0>
+  805342:	48 89 df             	mov    %rbx,%rdi
+  805345:	41 ff d6             	call   *%r14
+  805348:	84 c0                	test   %al,%al
+  80534a:	74 16                	je     805362 <mmap_writeback+0xb0>
+  80534c:	48 89 df             	mov    %rbx,%rdi
+  80534f:	41 ff d7             	call   *%r15
+  805352:	84 c0                	test   %al,%al
+  805354:	74 0c                	je     805362 <mmap_writeback+0xb0>
+  805356:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80535d:	4c 39 eb             	cmp    %r13,%rbx
+  805360:	72 e0                	jb     805342 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  805362:	48 89 d9             	mov    %rbx,%rcx
+  805365:	4c 29 e1             	sub    %r12,%rcx
+  805368:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80536c:	44 89 e6             	mov    %r12d,%esi
+  80536f:	2b 30                	sub    (%rax),%esi
+  805371:	49 89 c4             	mov    %rax,%r12
+  805374:	03 70 1c             	add    0x1c(%rax),%esi
+  805377:	8b 78 18             	mov    0x18(%rax),%edi
+  80537a:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80537e:	48 89 ca             	mov    %rcx,%rdx
+  805381:	48 b8 10 3c 80 00 00 	movabs $0x803c10,%rax
+  805388:	00 00 00 
+  80538b:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80538d:	85 c0                	test   %eax,%eax
+  80538f:	78 44                	js     8053d5 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  805391:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805396:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805399:	41 89 c1             	mov    %eax,%r9d
+  80539c:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8053a3:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8053a7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8053ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053b0:	48 89 ce             	mov    %rcx,%rsi
+  8053b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053b8:	48 b8 ab 28 80 00 00 	movabs $0x8028ab,%rax
+  8053bf:	00 00 00 
+  8053c2:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8053c4:	85 c0                	test   %eax,%eax
+  8053c6:	78 0d                	js     8053d5 <mmap_writeback+0x123>
+  8053c8:	49 89 dc             	mov    %rbx,%r12
+  8053cb:	e9 49 ff ff ff       	jmp    805319 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8053d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053d5:	48 83 c4 28          	add    $0x28,%rsp
+  8053d9:	5b                   	pop    %rbx
+  8053da:	41 5c                	pop    %r12
+  8053dc:	41 5d                	pop    %r13
+  8053de:	41 5e                	pop    %r14
+  8053e0:	41 5f                	pop    %r15
+  8053e2:	5d                   	pop    %rbp
+  8053e3:	c3                   	ret
+    return 0;
+  8053e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053e9:	eb ea                	jmp    8053d5 <mmap_writeback+0x123>
+
+00000000008053eb <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8053eb:	55                   	push   %rbp
+  8053ec:	48 89 e5             	mov    %rsp,%rbp
+  8053ef:	41 57                	push   %r15
+  8053f1:	41 56                	push   %r14
+  8053f3:	41 55                	push   %r13
+  8053f5:	41 54                	push   %r12
+  8053f7:	53                   	push   %rbx
+  8053f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8053fc:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805400:	48 85 f6             	test   %rsi,%rsi
+  805403:	0f 84 0c 02 00 00    	je     805615 <mmap+0x22a>
+  805409:	49 89 ff             	mov    %rdi,%r15
+  80540c:	49 89 f4             	mov    %rsi,%r12
+  80540f:	41 89 d5             	mov    %edx,%r13d
+  805412:	41 89 ce             	mov    %ecx,%r14d
+  805415:	44 89 cb             	mov    %r9d,%ebx
+  805418:	45 85 c9             	test   %r9d,%r9d
+  80541b:	0f 88 f4 01 00 00    	js     805615 <mmap+0x22a>
+  805421:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805428:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80542f:	0f 85 e7 01 00 00    	jne    80561c <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805435:	83 e2 fd             	and    $0xfffffffd,%edx
+  805438:	83 fa 04             	cmp    $0x4,%edx
+  80543b:	0f 85 db 01 00 00    	jne    80561c <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805441:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805444:	83 fa 01             	cmp    $0x1,%edx
+  805447:	0f 87 cf 01 00 00    	ja     80561c <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  80544d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805451:	44 89 c7             	mov    %r8d,%edi
+  805454:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  80545b:	00 00 00 
+  80545e:	ff d0                	call   *%rax
+  805460:	89 c2                	mov    %eax,%edx
+  805462:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805469:	85 d2                	test   %edx,%edx
+  80546b:	0f 88 ab 01 00 00    	js     80561c <mmap+0x231>
+  805471:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805475:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  80547c:	00 00 00 
+  80547f:	8b 09                	mov    (%rcx),%ecx
+  805481:	39 0a                	cmp    %ecx,(%rdx)
+  805483:	0f 85 93 01 00 00    	jne    80561c <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805489:	8b 52 08             	mov    0x8(%rdx),%edx
+  80548c:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80548f:	83 fa 01             	cmp    $0x1,%edx
+  805492:	0f 84 84 01 00 00    	je     80561c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805498:	41 83 fe 01          	cmp    $0x1,%r14d
+  80549c:	74 42                	je     8054e0 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  80549e:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8054a5:	4c 89 e6             	mov    %r12,%rsi
+  8054a8:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8054af:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8054b3:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8054b7:	4d 85 ff             	test   %r15,%r15
+  8054ba:	74 67                	je     805523 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8054bc:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8054c3:	75 0f                	jne    8054d4 <mmap+0xe9>
+  8054c5:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8054cc:	00 00 00 
+  8054cf:	49 39 c7             	cmp    %rax,%r15
+  8054d2:	77 1b                	ja     8054ef <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8054d4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8054db:	e9 3c 01 00 00       	jmp    80561c <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8054e0:	41 f6 c5 02          	test   $0x2,%r13b
+  8054e4:	74 b8                	je     80549e <mmap+0xb3>
+  8054e6:	85 d2                	test   %edx,%edx
+  8054e8:	75 b4                	jne    80549e <mmap+0xb3>
+  8054ea:	e9 2d 01 00 00       	jmp    80561c <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8054ef:	4c 89 ff             	mov    %r15,%rdi
+  8054f2:	48 b8 59 50 80 00 00 	movabs $0x805059,%rax
+  8054f9:	00 00 00 
+  8054fc:	ff d0                	call   *%rax
+  8054fe:	48 89 c2             	mov    %rax,%rdx
+  805501:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805508:	49 39 d7             	cmp    %rdx,%r15
+  80550b:	0f 85 0b 01 00 00    	jne    80561c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805511:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  805518:	00 00 00 
+  80551b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805521:	eb 44                	jmp    805567 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805523:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805527:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  80552e:	00 00 00 
+  805531:	48 b8 59 50 80 00 00 	movabs $0x805059,%rax
+  805538:	00 00 00 
+  80553b:	ff d0                	call   *%rax
+  80553d:	48 89 c7             	mov    %rax,%rdi
+  805540:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805544:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80554b:	48 85 ff             	test   %rdi,%rdi
+  80554e:	75 c1                	jne    805511 <mmap+0x126>
+  805550:	e9 c7 00 00 00       	jmp    80561c <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805555:	49 83 c4 01          	add    $0x1,%r12
+  805559:	48 83 c0 20          	add    $0x20,%rax
+  80555d:	49 83 fc 20          	cmp    $0x20,%r12
+  805561:	0f 84 a5 00 00 00    	je     80560c <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805567:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80556b:	75 e8                	jne    805555 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  80556d:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805571:	48 b8 ca 2e 80 00 00 	movabs $0x802eca,%rax
+  805578:	00 00 00 
+  80557b:	ff d0                	call   *%rax
+  80557d:	89 c2                	mov    %eax,%edx
+  80557f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805586:	85 d2                	test   %edx,%edx
+  805588:	0f 88 8e 00 00 00    	js     80561c <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  80558e:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805592:	48 b8 9c 2e 80 00 00 	movabs $0x802e9c,%rax
+  805599:	00 00 00 
+  80559c:	ff d0                	call   *%rax
+  80559e:	89 c6                	mov    %eax,%esi
+  8055a0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8055a3:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  8055aa:	00 00 00 
+  8055ad:	ff d0                	call   *%rax
+  8055af:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8055b2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8055b9:	45 85 ff             	test   %r15d,%r15d
+  8055bc:	78 5e                	js     80561c <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8055be:	49 c1 e4 05          	shl    $0x5,%r12
+  8055c2:	48 b8 40 b8 80 01 00 	movabs $0x180b840,%rax
+  8055c9:	00 00 00 
+  8055cc:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8055cf:	48 bf ca 50 80 00 00 	movabs $0x8050ca,%rdi
+  8055d6:	00 00 00 
+  8055d9:	48 b8 f5 5a 80 00 00 	movabs $0x805af5,%rax
+  8055e0:	00 00 00 
+  8055e3:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8055e5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8055e9:	49 89 04 24          	mov    %rax,(%r12)
+  8055ed:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8055f1:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8055f6:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8055fb:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805600:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805605:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  80560a:	eb 10                	jmp    80561c <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80560c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805613:	eb 07                	jmp    80561c <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805615:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  80561c:	48 83 c4 38          	add    $0x38,%rsp
+  805620:	5b                   	pop    %rbx
+  805621:	41 5c                	pop    %r12
+  805623:	41 5d                	pop    %r13
+  805625:	41 5e                	pop    %r14
+  805627:	41 5f                	pop    %r15
+  805629:	5d                   	pop    %rbp
+  80562a:	c3                   	ret
+
+000000000080562b <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  80562b:	55                   	push   %rbp
+  80562c:	48 89 e5             	mov    %rsp,%rbp
+  80562f:	41 57                	push   %r15
+  805631:	41 56                	push   %r14
+  805633:	41 55                	push   %r13
+  805635:	41 54                	push   %r12
+  805637:	53                   	push   %rbx
+  805638:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80563c:	49 89 fe             	mov    %rdi,%r14
+  80563f:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805646:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80564d:	00 
+  80564e:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805655:	48 bb 40 b8 80 01 00 	movabs $0x180b840,%rbx
+  80565c:	00 00 00 
+  80565f:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805666:	49 bf b2 52 80 00 00 	movabs $0x8052b2,%r15
+  80566d:	00 00 00 
+  805670:	eb 09                	jmp    80567b <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805672:	48 83 c3 20          	add    $0x20,%rbx
+  805676:	4c 39 eb             	cmp    %r13,%rbx
+  805679:	74 33                	je     8056ae <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80567b:	48 89 df             	mov    %rbx,%rdi
+  80567e:	48 8b 33             	mov    (%rbx),%rsi
+  805681:	4c 39 e6             	cmp    %r12,%rsi
+  805684:	73 ec                	jae    805672 <msync+0x47>
+  805686:	48 85 f6             	test   %rsi,%rsi
+  805689:	74 e7                	je     805672 <msync+0x47>
+  80568b:	48 89 f2             	mov    %rsi,%rdx
+  80568e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805692:	49 39 d6             	cmp    %rdx,%r14
+  805695:	73 db                	jae    805672 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805697:	4c 39 e2             	cmp    %r12,%rdx
+  80569a:	49 0f 47 d4          	cmova  %r12,%rdx
+  80569e:	4c 39 f6             	cmp    %r14,%rsi
+  8056a1:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8056a5:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8056a8:	85 c0                	test   %eax,%eax
+  8056aa:	79 c6                	jns    805672 <msync+0x47>
+  8056ac:	eb 05                	jmp    8056b3 <msync+0x88>
+    }
+
+    return 0;
+  8056ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056b3:	48 83 c4 08          	add    $0x8,%rsp
+  8056b7:	5b                   	pop    %rbx
+  8056b8:	41 5c                	pop    %r12
+  8056ba:	41 5d                	pop    %r13
+  8056bc:	41 5e                	pop    %r14
+  8056be:	41 5f                	pop    %r15
+  8056c0:	5d                   	pop    %rbp
+  8056c1:	c3                   	ret
+
+00000000008056c2 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8056c2:	55                   	push   %rbp
+  8056c3:	48 89 e5             	mov    %rsp,%rbp
+  8056c6:	41 57                	push   %r15
+  8056c8:	41 56                	push   %r14
+  8056ca:	41 55                	push   %r13
+  8056cc:	41 54                	push   %r12
+  8056ce:	53                   	push   %rbx
+  8056cf:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8056d3:	49 89 ff             	mov    %rdi,%r15
+  8056d6:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8056dd:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8056e4:	00 
+  8056e5:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8056ec:	48 bb 40 b8 80 01 00 	movabs $0x180b840,%rbx
+  8056f3:	00 00 00 
+  8056f6:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8056fd:	48 89 d8             	mov    %rbx,%rax
+  805700:	eb 09                	jmp    80570b <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805702:	48 83 c0 20          	add    $0x20,%rax
+  805706:	4c 39 f0             	cmp    %r14,%rax
+  805709:	74 40                	je     80574b <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80570b:	48 8b 10             	mov    (%rax),%rdx
+  80570e:	4c 39 e2             	cmp    %r12,%rdx
+  805711:	73 ef                	jae    805702 <munmap+0x40>
+  805713:	48 85 d2             	test   %rdx,%rdx
+  805716:	74 ea                	je     805702 <munmap+0x40>
+  805718:	48 89 d7             	mov    %rdx,%rdi
+  80571b:	48 03 78 08          	add    0x8(%rax),%rdi
+  80571f:	49 39 ff             	cmp    %rdi,%r15
+  805722:	73 de                	jae    805702 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805724:	49 39 fc             	cmp    %rdi,%r12
+  805727:	72 05                	jb     80572e <munmap+0x6c>
+  805729:	4c 39 fa             	cmp    %r15,%rdx
+  80572c:	73 d4                	jae    805702 <munmap+0x40>
+  80572e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805733:	48 83 c4 08          	add    $0x8,%rsp
+  805737:	5b                   	pop    %rbx
+  805738:	41 5c                	pop    %r12
+  80573a:	41 5d                	pop    %r13
+  80573c:	41 5e                	pop    %r14
+  80573e:	41 5f                	pop    %r15
+  805740:	5d                   	pop    %rbp
+  805741:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805742:	48 83 c3 20          	add    $0x20,%rbx
+  805746:	4c 39 f3             	cmp    %r14,%rbx
+  805749:	74 5c                	je     8057a7 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80574b:	48 8b 33             	mov    (%rbx),%rsi
+  80574e:	4c 39 e6             	cmp    %r12,%rsi
+  805751:	73 ef                	jae    805742 <munmap+0x80>
+  805753:	48 85 f6             	test   %rsi,%rsi
+  805756:	74 ea                	je     805742 <munmap+0x80>
+  805758:	48 89 f2             	mov    %rsi,%rdx
+  80575b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80575f:	49 39 d7             	cmp    %rdx,%r15
+  805762:	73 de                	jae    805742 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805764:	48 89 df             	mov    %rbx,%rdi
+  805767:	48 b8 b2 52 80 00 00 	movabs $0x8052b2,%rax
+  80576e:	00 00 00 
+  805771:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805773:	85 c0                	test   %eax,%eax
+  805775:	78 bc                	js     805733 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805777:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80577b:	48 8b 33             	mov    (%rbx),%rsi
+  80577e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805783:	48 b8 16 29 80 00 00 	movabs $0x802916,%rax
+  80578a:	00 00 00 
+  80578d:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80578f:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805792:	48 b8 8f 30 80 00 00 	movabs $0x80308f,%rax
+  805799:	00 00 00 
+  80579c:	ff d0                	call   *%rax
+        reg->start = 0;
+  80579e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8057a5:	eb 9b                	jmp    805742 <munmap+0x80>
+    return 0;
+  8057a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ac:	eb 85                	jmp    805733 <munmap+0x71>
+
+00000000008057ae <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8057ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057b3:	c3                   	ret
+
+00000000008057b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8057b4:	55                   	push   %rbp
+  8057b5:	48 89 e5             	mov    %rsp,%rbp
+  8057b8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8057bb:	48 be 25 6d 80 00 00 	movabs $0x806d25,%rsi
+  8057c2:	00 00 00 
+  8057c5:	48 b8 d9 20 80 00 00 	movabs $0x8020d9,%rax
+  8057cc:	00 00 00 
+  8057cf:	ff d0                	call   *%rax
+    return 0;
+}
+  8057d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057d6:	5d                   	pop    %rbp
+  8057d7:	c3                   	ret
+
+00000000008057d8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8057d8:	55                   	push   %rbp
+  8057d9:	48 89 e5             	mov    %rsp,%rbp
+  8057dc:	41 57                	push   %r15
+  8057de:	41 56                	push   %r14
+  8057e0:	41 55                	push   %r13
+  8057e2:	41 54                	push   %r12
+  8057e4:	53                   	push   %rbx
+  8057e5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8057ec:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8057f3:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8057fa:	00 00 00 00 
+  8057fe:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805805:	00 00 00 00 
+  805809:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805810:	00 00 00 00 
+  805814:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80581b:	00 00 00 00 
+  80581f:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805826:	00 00 00 00 
+  80582a:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805831:	00 00 00 00 
+  805835:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80583c:	00 
+  80583d:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805844:	00 
+  805845:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80584c:	00 
+  80584d:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805854:	00 
+  805855:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80585c:	00 
+  80585d:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805864:	00 
+  805865:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80586c:	00 
+  80586d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805874:	00 
+  805875:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80587c:	00 
+  80587d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805884:	00 
+    for (res = 0; res < n; res += inc) {
+  805885:	48 85 d2             	test   %rdx,%rdx
+  805888:	74 7a                	je     805904 <devcons_write+0x12c>
+  80588a:	49 89 d6             	mov    %rdx,%r14
+  80588d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805893:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805898:	49 bf 29 24 80 00 00 	movabs $0x802429,%r15
+  80589f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8058a2:	4c 89 f3             	mov    %r14,%rbx
+  8058a5:	48 29 f3             	sub    %rsi,%rbx
+  8058a8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8058ad:	48 39 c3             	cmp    %rax,%rbx
+  8058b0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8058b4:	4c 63 eb             	movslq %ebx,%r13
+  8058b7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8058be:	48 01 c6             	add    %rax,%rsi
+  8058c1:	4c 89 ea             	mov    %r13,%rdx
+  8058c4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8058cb:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8058ce:	4c 89 ee             	mov    %r13,%rsi
+  8058d1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8058d8:	48 b8 56 26 80 00 00 	movabs $0x802656,%rax
+  8058df:	00 00 00 
+  8058e2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8058e4:	41 01 dc             	add    %ebx,%r12d
+  8058e7:	49 63 f4             	movslq %r12d,%rsi
+  8058ea:	4c 39 f6             	cmp    %r14,%rsi
+  8058ed:	72 b3                	jb     8058a2 <devcons_write+0xca>
+    return res;
+  8058ef:	49 63 c4             	movslq %r12d,%rax
+}
+  8058f2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8058f9:	5b                   	pop    %rbx
+  8058fa:	41 5c                	pop    %r12
+  8058fc:	41 5d                	pop    %r13
+  8058fe:	41 5e                	pop    %r14
+  805900:	41 5f                	pop    %r15
+  805902:	5d                   	pop    %rbp
+  805903:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805904:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80590a:	eb e3                	jmp    8058ef <devcons_write+0x117>
+
+000000000080590c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80590c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80590f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805914:	48 85 c0             	test   %rax,%rax
+  805917:	74 55                	je     80596e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805919:	55                   	push   %rbp
+  80591a:	48 89 e5             	mov    %rsp,%rbp
+  80591d:	41 55                	push   %r13
+  80591f:	41 54                	push   %r12
+  805921:	53                   	push   %rbx
+  805922:	48 83 ec 08          	sub    $0x8,%rsp
+  805926:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805929:	48 bb 89 26 80 00 00 	movabs $0x802689,%rbx
+  805930:	00 00 00 
+  805933:	49 bc 9d 27 80 00 00 	movabs $0x80279d,%r12
+  80593a:	00 00 00 
+  80593d:	eb 03                	jmp    805942 <devcons_read+0x36>
+  80593f:	41 ff d4             	call   *%r12
+  805942:	ff d3                	call   *%rbx
+  805944:	85 c0                	test   %eax,%eax
+  805946:	74 f7                	je     80593f <devcons_read+0x33>
+    if (c < 0) return c;
+  805948:	48 63 d0             	movslq %eax,%rdx
+  80594b:	78 13                	js     805960 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80594d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805952:	83 f8 04             	cmp    $0x4,%eax
+  805955:	74 09                	je     805960 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805957:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80595b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805960:	48 89 d0             	mov    %rdx,%rax
+  805963:	48 83 c4 08          	add    $0x8,%rsp
+  805967:	5b                   	pop    %rbx
+  805968:	41 5c                	pop    %r12
+  80596a:	41 5d                	pop    %r13
+  80596c:	5d                   	pop    %rbp
+  80596d:	c3                   	ret
+  80596e:	48 89 d0             	mov    %rdx,%rax
+  805971:	c3                   	ret
+
+0000000000805972 <cputchar>:
+cputchar(int ch) {
+  805972:	55                   	push   %rbp
+  805973:	48 89 e5             	mov    %rsp,%rbp
+  805976:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80597a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80597e:	be 01 00 00 00       	mov    $0x1,%esi
+  805983:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805987:	48 b8 56 26 80 00 00 	movabs $0x802656,%rax
+  80598e:	00 00 00 
+  805991:	ff d0                	call   *%rax
+}
+  805993:	c9                   	leave
+  805994:	c3                   	ret
+
+0000000000805995 <getchar>:
+getchar(void) {
+  805995:	55                   	push   %rbp
+  805996:	48 89 e5             	mov    %rsp,%rbp
+  805999:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80599d:	ba 01 00 00 00       	mov    $0x1,%edx
+  8059a2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8059a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059ab:	48 b8 0d 32 80 00 00 	movabs $0x80320d,%rax
+  8059b2:	00 00 00 
+  8059b5:	ff d0                	call   *%rax
+  8059b7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8059b9:	85 c0                	test   %eax,%eax
+  8059bb:	78 06                	js     8059c3 <getchar+0x2e>
+  8059bd:	74 08                	je     8059c7 <getchar+0x32>
+  8059bf:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8059c3:	89 d0                	mov    %edx,%eax
+  8059c5:	c9                   	leave
+  8059c6:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8059c7:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8059cc:	eb f5                	jmp    8059c3 <getchar+0x2e>
+
+00000000008059ce <iscons>:
+iscons(int fdnum) {
+  8059ce:	55                   	push   %rbp
+  8059cf:	48 89 e5             	mov    %rsp,%rbp
+  8059d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8059d6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8059da:	48 b8 2a 2f 80 00 00 	movabs $0x802f2a,%rax
+  8059e1:	00 00 00 
+  8059e4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8059e6:	85 c0                	test   %eax,%eax
+  8059e8:	78 18                	js     805a02 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8059ea:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8059ee:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8059f5:	00 00 00 
+  8059f8:	8b 00                	mov    (%rax),%eax
+  8059fa:	39 02                	cmp    %eax,(%rdx)
+  8059fc:	0f 94 c0             	sete   %al
+  8059ff:	0f b6 c0             	movzbl %al,%eax
+}
+  805a02:	c9                   	leave
+  805a03:	c3                   	ret
+
+0000000000805a04 <opencons>:
+opencons(void) {
+  805a04:	55                   	push   %rbp
+  805a05:	48 89 e5             	mov    %rsp,%rbp
+  805a08:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805a0c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805a10:	48 b8 ca 2e 80 00 00 	movabs $0x802eca,%rax
+  805a17:	00 00 00 
+  805a1a:	ff d0                	call   *%rax
+  805a1c:	85 c0                	test   %eax,%eax
+  805a1e:	78 49                	js     805a69 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805a20:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805a25:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a2a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805a2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a33:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  805a3a:	00 00 00 
+  805a3d:	ff d0                	call   *%rax
+  805a3f:	85 c0                	test   %eax,%eax
+  805a41:	78 26                	js     805a69 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805a43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805a47:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805a4e:	00 00 
+  805a50:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805a52:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805a56:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805a5d:	48 b8 9c 2e 80 00 00 	movabs $0x802e9c,%rax
+  805a64:	00 00 00 
+  805a67:	ff d0                	call   *%rax
+}
+  805a69:	c9                   	leave
+  805a6a:	c3                   	ret
+
+0000000000805a6b <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805a6b:	55                   	push   %rbp
+  805a6c:	48 89 e5             	mov    %rsp,%rbp
+  805a6f:	41 56                	push   %r14
+  805a71:	41 55                	push   %r13
+  805a73:	41 54                	push   %r12
+  805a75:	53                   	push   %rbx
+  805a76:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a79:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805a80:	00 00 00 
+  805a83:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805a87:	74 27                	je     805ab0 <_handle_vectored_pagefault+0x45>
+  805a89:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805a8e:	49 bd 40 bc 80 01 00 	movabs $0x180bc40,%r13
+  805a95:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805a98:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805a9b:	4c 89 e7             	mov    %r12,%rdi
+  805a9e:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805aa3:	84 c0                	test   %al,%al
+  805aa5:	75 45                	jne    805aec <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805aa7:	48 83 c3 01          	add    $0x1,%rbx
+  805aab:	49 3b 1e             	cmp    (%r14),%rbx
+  805aae:	72 eb                	jb     805a9b <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805ab0:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805ab7:	00 
+  805ab8:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805abd:	4d 8b 04 24          	mov    (%r12),%r8
+  805ac1:	48 ba 38 6d 80 00 00 	movabs $0x806d38,%rdx
+  805ac8:	00 00 00 
+  805acb:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805ad0:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  805ad7:	00 00 00 
+  805ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  805adf:	49 ba 52 16 80 00 00 	movabs $0x801652,%r10
+  805ae6:	00 00 00 
+  805ae9:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805aec:	5b                   	pop    %rbx
+  805aed:	41 5c                	pop    %r12
+  805aef:	41 5d                	pop    %r13
+  805af1:	41 5e                	pop    %r14
+  805af3:	5d                   	pop    %rbp
+  805af4:	c3                   	ret
+
+0000000000805af5 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805af5:	55                   	push   %rbp
+  805af6:	48 89 e5             	mov    %rsp,%rbp
+  805af9:	53                   	push   %rbx
+  805afa:	48 83 ec 08          	sub    $0x8,%rsp
+  805afe:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805b01:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805b06:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805b0d:	00 00 00 
+  805b10:	80 38 00             	cmpb   $0x0,(%rax)
+  805b13:	74 68                	je     805b7d <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805b15:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805b1c:	00 00 00 
+  805b1f:	48 8b 08             	mov    (%rax),%rcx
+  805b22:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805b27:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805b2e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805b31:	48 85 c9             	test   %rcx,%rcx
+  805b34:	0f 84 e0 00 00 00    	je     805c1a <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805b3a:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805b3e:	0f 84 c9 00 00 00    	je     805c0d <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805b44:	48 83 c2 01          	add    $0x1,%rdx
+  805b48:	48 39 ca             	cmp    %rcx,%rdx
+  805b4b:	75 ed                	jne    805b3a <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805b4d:	48 83 f9 08          	cmp    $0x8,%rcx
+  805b51:	0f 84 84 00 00 00    	je     805bdb <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805b57:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805b5b:	48 a3 88 bc 80 01 00 	movabs %rax,0x180bc88
+  805b62:	00 00 00 
+  805b65:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805b6c:	00 00 00 
+  805b6f:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805b73:	85 f6                	test   %esi,%esi
+  805b75:	0f 89 97 00 00 00    	jns    805c12 <add_pgfault_handler+0x11d>
+  805b7b:	eb 63                	jmp    805be0 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805b7d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805b82:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805b87:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805b8e:	00 00 00 
+  805b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b96:	48 b8 3e 28 80 00 00 	movabs $0x80283e,%rax
+  805b9d:	00 00 00 
+  805ba0:	ff d0                	call   *%rax
+  805ba2:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ba4:	85 c0                	test   %eax,%eax
+  805ba6:	78 38                	js     805be0 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805ba8:	48 be f6 5c 80 00 00 	movabs $0x805cf6,%rsi
+  805baf:	00 00 00 
+  805bb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bb7:	48 b8 61 2a 80 00 00 	movabs $0x802a61,%rax
+  805bbe:	00 00 00 
+  805bc1:	ff d0                	call   *%rax
+  805bc3:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805bc5:	85 c0                	test   %eax,%eax
+  805bc7:	78 17                	js     805be0 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805bc9:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805bd0:	00 00 00 
+  805bd3:	c6 00 01             	movb   $0x1,(%rax)
+  805bd6:	e9 3a ff ff ff       	jmp    805b15 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805bdb:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805be0:	89 f1                	mov    %esi,%ecx
+  805be2:	48 ba 76 6d 80 00 00 	movabs $0x806d76,%rdx
+  805be9:	00 00 00 
+  805bec:	be 42 00 00 00       	mov    $0x42,%esi
+  805bf1:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  805bf8:	00 00 00 
+  805bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c00:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  805c07:	00 00 00 
+  805c0a:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805c0d:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805c12:	89 f0                	mov    %esi,%eax
+  805c14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805c18:	c9                   	leave
+  805c19:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805c1a:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805c21:	00 00 00 
+  805c24:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805c2b:	48 89 d8             	mov    %rbx,%rax
+  805c2e:	48 a3 40 bc 80 01 00 	movabs %rax,0x180bc40
+  805c35:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805c38:	eb d8                	jmp    805c12 <add_pgfault_handler+0x11d>
+
+0000000000805c3a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805c3a:	55                   	push   %rbp
+  805c3b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805c3e:	48 b8 80 bc 80 01 00 	movabs $0x180bc80,%rax
+  805c45:	00 00 00 
+  805c48:	80 38 00             	cmpb   $0x0,(%rax)
+  805c4b:	74 33                	je     805c80 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805c4d:	48 a1 88 bc 80 01 00 	movabs 0x180bc88,%rax
+  805c54:	00 00 00 
+  805c57:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805c5c:	48 ba 40 bc 80 01 00 	movabs $0x180bc40,%rdx
+  805c63:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805c66:	48 85 c0             	test   %rax,%rax
+  805c69:	0f 84 85 00 00 00    	je     805cf4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805c6f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805c73:	74 40                	je     805cb5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805c75:	48 83 c1 01          	add    $0x1,%rcx
+  805c79:	48 39 c1             	cmp    %rax,%rcx
+  805c7c:	75 f1                	jne    805c6f <remove_pgfault_handler+0x35>
+  805c7e:	eb 74                	jmp    805cf4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805c80:	48 b9 8e 6d 80 00 00 	movabs $0x806d8e,%rcx
+  805c87:	00 00 00 
+  805c8a:	48 ba f6 6b 80 00 00 	movabs $0x806bf6,%rdx
+  805c91:	00 00 00 
+  805c94:	be 48 00 00 00       	mov    $0x48,%esi
+  805c99:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  805ca0:	00 00 00 
+  805ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ca8:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  805caf:	00 00 00 
+  805cb2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805cb5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805cbc:	00 
+  805cbd:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805cc1:	48 29 ca             	sub    %rcx,%rdx
+  805cc4:	48 b8 40 bc 80 01 00 	movabs $0x180bc40,%rax
+  805ccb:	00 00 00 
+  805cce:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805cd2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805cd7:	48 89 ce             	mov    %rcx,%rsi
+  805cda:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  805ce1:	00 00 00 
+  805ce4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805ce6:	48 b8 88 bc 80 01 00 	movabs $0x180bc88,%rax
+  805ced:	00 00 00 
+  805cf0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805cf4:	5d                   	pop    %rbp
+  805cf5:	c3                   	ret
+
+0000000000805cf6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805cf6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805cf9:	48 b8 6b 5a 80 00 00 	movabs $0x805a6b,%rax
+  805d00:	00 00 00 
+    call *%rax
+  805d03:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805d05:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805d0c:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805d0d:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805d14:	00 
+    subq $8, %rcx
+  805d15:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805d19:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805d1c:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805d23:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805d24:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805d28:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805d2c:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805d31:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805d36:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805d3b:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805d40:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805d45:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805d4a:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805d4f:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805d54:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805d59:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805d5e:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805d63:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805d68:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805d6d:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805d72:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805d76:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805d7a:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805d7b:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805d7c:	c3                   	ret
+
+0000000000805d7d <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805d7d:	85 ff                	test   %edi,%edi
+  805d7f:	78 58                	js     805dd9 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805d81:	48 85 f6             	test   %rsi,%rsi
+  805d84:	74 12                	je     805d98 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805d86:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805d8d:	00 00 00 
+  805d90:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805d96:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805d98:	48 85 c9             	test   %rcx,%rcx
+  805d9b:	74 12                	je     805daf <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805d9d:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805da4:	00 00 00 
+  805da7:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805dad:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805daf:	48 85 d2             	test   %rdx,%rdx
+  805db2:	74 14                	je     805dc8 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805db4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805dbb:	00 00 00 
+  805dbe:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805dc5:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805dc8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805dcf:	00 00 00 
+  805dd2:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805dd8:	c3                   	ret
+        if (from_env_store) {
+  805dd9:	48 85 f6             	test   %rsi,%rsi
+  805ddc:	74 06                	je     805de4 <ipc_result+0x67>
+            *from_env_store = 0;
+  805dde:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805de4:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805de6:	48 85 c9             	test   %rcx,%rcx
+  805de9:	74 ed                	je     805dd8 <ipc_result+0x5b>
+            *perm_store = 0;
+  805deb:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805df1:	c3                   	ret
+
+0000000000805df2 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805df2:	55                   	push   %rbp
+  805df3:	48 89 e5             	mov    %rsp,%rbp
+  805df6:	41 55                	push   %r13
+  805df8:	41 54                	push   %r12
+  805dfa:	53                   	push   %rbx
+  805dfb:	48 83 ec 08          	sub    $0x8,%rsp
+  805dff:	49 89 fc             	mov    %rdi,%r12
+  805e02:	48 89 f7             	mov    %rsi,%rdi
+  805e05:	48 89 d3             	mov    %rdx,%rbx
+  805e08:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805e0b:	48 85 f6             	test   %rsi,%rsi
+  805e0e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e15:	00 00 00 
+  805e18:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805e1c:	be 00 00 00 00       	mov    $0x0,%esi
+  805e21:	48 85 d2             	test   %rdx,%rdx
+  805e24:	74 03                	je     805e29 <ipc_recv+0x37>
+  805e26:	48 8b 32             	mov    (%rdx),%rsi
+  805e29:	48 b8 8a 2d 80 00 00 	movabs $0x802d8a,%rax
+  805e30:	00 00 00 
+  805e33:	ff d0                	call   *%rax
+  805e35:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805e37:	4c 89 e9             	mov    %r13,%rcx
+  805e3a:	48 89 da             	mov    %rbx,%rdx
+  805e3d:	4c 89 e6             	mov    %r12,%rsi
+  805e40:	48 b8 7d 5d 80 00 00 	movabs $0x805d7d,%rax
+  805e47:	00 00 00 
+  805e4a:	ff d0                	call   *%rax
+}
+  805e4c:	48 83 c4 08          	add    $0x8,%rsp
+  805e50:	5b                   	pop    %rbx
+  805e51:	41 5c                	pop    %r12
+  805e53:	41 5d                	pop    %r13
+  805e55:	5d                   	pop    %rbp
+  805e56:	c3                   	ret
+
+0000000000805e57 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805e57:	55                   	push   %rbp
+  805e58:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805e5b:	48 85 d2             	test   %rdx,%rdx
+  805e5e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e65:	00 00 00 
+  805e68:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805e6c:	89 f6                	mov    %esi,%esi
+  805e6e:	48 b8 16 2c 80 00 00 	movabs $0x802c16,%rax
+  805e75:	00 00 00 
+  805e78:	ff d0                	call   *%rax
+    if (res < 0) {
+  805e7a:	85 c0                	test   %eax,%eax
+  805e7c:	78 02                	js     805e80 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805e7e:	5d                   	pop    %rbp
+  805e7f:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805e80:	89 c1                	mov    %eax,%ecx
+  805e82:	48 ba a8 6d 80 00 00 	movabs $0x806da8,%rdx
+  805e89:	00 00 00 
+  805e8c:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805e91:	48 bf b5 6d 80 00 00 	movabs $0x806db5,%rdi
+  805e98:	00 00 00 
+  805e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ea0:	49 b8 52 16 80 00 00 	movabs $0x801652,%r8
+  805ea7:	00 00 00 
+  805eaa:	41 ff d0             	call   *%r8
+
+0000000000805ead <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805ead:	55                   	push   %rbp
+  805eae:	48 89 e5             	mov    %rsp,%rbp
+  805eb1:	53                   	push   %rbx
+  805eb2:	48 83 ec 08          	sub    $0x8,%rsp
+  805eb6:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805eba:	48 85 d2             	test   %rdx,%rdx
+  805ebd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ec4:	00 00 00 
+  805ec7:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805ecb:	4d 85 c9             	test   %r9,%r9
+  805ece:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ed7:	48 85 db             	test   %rbx,%rbx
+  805eda:	74 03                	je     805edf <ipc_call+0x32>
+  805edc:	48 8b 03             	mov    (%rbx),%rax
+  805edf:	89 f6                	mov    %esi,%esi
+  805ee1:	48 83 ec 08          	sub    $0x8,%rsp
+  805ee5:	50                   	push   %rax
+  805ee6:	48 b8 48 2c 80 00 00 	movabs $0x802c48,%rax
+  805eed:	00 00 00 
+  805ef0:	ff d0                	call   *%rax
+  805ef2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805ef4:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805ef8:	48 89 da             	mov    %rbx,%rdx
+  805efb:	be 00 00 00 00       	mov    $0x0,%esi
+  805f00:	48 b8 7d 5d 80 00 00 	movabs $0x805d7d,%rax
+  805f07:	00 00 00 
+  805f0a:	ff d0                	call   *%rax
+}
+  805f0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805f10:	c9                   	leave
+  805f11:	c3                   	ret
+
+0000000000805f12 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805f12:	55                   	push   %rbp
+  805f13:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805f16:	89 f6                	mov    %esi,%esi
+  805f18:	48 b8 b4 2c 80 00 00 	movabs $0x802cb4,%rax
+  805f1f:	00 00 00 
+  805f22:	ff d0                	call   *%rax
+  805f24:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805f26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f30:	be 00 00 00 00       	mov    $0x0,%esi
+  805f35:	48 b8 7d 5d 80 00 00 	movabs $0x805d7d,%rax
+  805f3c:	00 00 00 
+  805f3f:	ff d0                	call   *%rax
+}
+  805f41:	5d                   	pop    %rbp
+  805f42:	c3                   	ret
+
+0000000000805f43 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805f43:	55                   	push   %rbp
+  805f44:	48 89 e5             	mov    %rsp,%rbp
+  805f47:	41 54                	push   %r12
+  805f49:	53                   	push   %rbx
+  805f4a:	4c 89 cb             	mov    %r9,%rbx
+  805f4d:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805f51:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805f55:	48 85 d2             	test   %rdx,%rdx
+  805f58:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805f5f:	00 00 00 
+  805f62:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805f66:	4d 85 c9             	test   %r9,%r9
+  805f69:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f72:	4d 85 e4             	test   %r12,%r12
+  805f75:	74 04                	je     805f7b <ipc_reply_wait+0x38>
+  805f77:	49 8b 04 24          	mov    (%r12),%rax
+  805f7b:	89 f6                	mov    %esi,%esi
+  805f7d:	48 83 ec 08          	sub    $0x8,%rsp
+  805f81:	50                   	push   %rax
+  805f82:	48 b8 1e 2d 80 00 00 	movabs $0x802d1e,%rax
+  805f89:	00 00 00 
+  805f8c:	ff d0                	call   *%rax
+  805f8e:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805f90:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805f94:	4c 89 e2             	mov    %r12,%rdx
+  805f97:	48 89 de             	mov    %rbx,%rsi
+  805f9a:	48 b8 7d 5d 80 00 00 	movabs $0x805d7d,%rax
+  805fa1:	00 00 00 
+  805fa4:	ff d0                	call   *%rax
+}
+  805fa6:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805faa:	5b                   	pop    %rbx
+  805fab:	41 5c                	pop    %r12
+  805fad:	5d                   	pop    %rbp
+  805fae:	c3                   	ret
+
+0000000000805faf <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805faf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805fb4:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805fbb:	00 00 00 
+  805fbe:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805fc5:	48 01 ca             	add    %rcx,%rdx
+  805fc8:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805fce:	39 fa                	cmp    %edi,%edx
+  805fd0:	74 12                	je     805fe4 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805fd2:	48 83 c0 01          	add    $0x1,%rax
+  805fd6:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805fdc:	75 e0                	jne    805fbe <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805fde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805fe3:	c3                   	ret
+            return envs[i].env_id;
+  805fe4:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805feb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805ff2:	00 00 00 
+  805ff5:	48 01 d0             	add    %rdx,%rax
+  805ff8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805ffe:	c3                   	ret
+  805fff:	90                   	nop
+
+0000000000806000 <__rodata_start>:
+  806000:	77 00                	ja     806002 <__rodata_start+0x2>
+  806002:	72 62                	jb     806066 <__rodata_start+0x66>
+  806004:	00 77 62             	add    %dh,0x62(%rdi)
+  806007:	00 66 2e             	add    %ah,0x2e(%rsi)
+  80600a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  806011:	00 
+  806012:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  806019:	00 00 00 
+  80601c:	0f 1f 40 00          	nopl   0x0(%rax)
+  806020:	b3 09                	mov    $0x9,%bl
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 ed                	add    %ch,%ch
+  806029:	0d 80 00 00 00       	or     $0x80,%eax
+  80602e:	00 00                	add    %al,(%rax)
+  806030:	ed                   	in     (%dx),%eax
+  806031:	0d 80 00 00 00       	or     $0x80,%eax
+  806036:	00 00                	add    %al,(%rax)
+  806038:	ed                   	in     (%dx),%eax
+  806039:	0d 80 00 00 00       	or     $0x80,%eax
+  80603e:	00 00                	add    %al,(%rax)
+  806040:	ed                   	in     (%dx),%eax
+  806041:	0d 80 00 00 00       	or     $0x80,%eax
+  806046:	00 00                	add    %al,(%rax)
+  806048:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 ed                	add    %ch,%ch
+  806051:	0d 80 00 00 00       	or     $0x80,%eax
+  806056:	00 00                	add    %al,(%rax)
+  806058:	ed                   	in     (%dx),%eax
+  806059:	0d 80 00 00 00       	or     $0x80,%eax
+  80605e:	00 00                	add    %al,(%rax)
+  806060:	ed                   	in     (%dx),%eax
+  806061:	0d 80 00 00 00       	or     $0x80,%eax
+  806066:	00 00                	add    %al,(%rax)
+  806068:	ed                   	in     (%dx),%eax
+  806069:	0d 80 00 00 00       	or     $0x80,%eax
+  80606e:	00 00                	add    %al,(%rax)
+  806070:	ed                   	in     (%dx),%eax
+  806071:	0d 80 00 00 00       	or     $0x80,%eax
+  806076:	00 00                	add    %al,(%rax)
+  806078:	8c 0a                	mov    %cs,(%rdx)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806086:	00 00                	add    %al,(%rax)
+  806088:	8c 0a                	mov    %cs,(%rdx)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806096:	00 00                	add    %al,(%rax)
+  806098:	8c 0a                	mov    %cs,(%rdx)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8060a6:	00 00                	add    %al,(%rax)
+  8060a8:	8c 0a                	mov    %cs,(%rdx)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+  8060ad:	00 00                	add    %al,(%rax)
+  8060af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8060b6:	00 00                	add    %al,(%rax)
+  8060b8:	8c 0a                	mov    %cs,(%rdx)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8060c6:	00 00                	add    %al,(%rax)
+  8060c8:	ed                   	in     (%dx),%eax
+  8060c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060ce:	00 00                	add    %al,(%rax)
+  8060d0:	ed                   	in     (%dx),%eax
+  8060d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060d6:	00 00                	add    %al,(%rax)
+  8060d8:	ed                   	in     (%dx),%eax
+  8060d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060de:	00 00                	add    %al,(%rax)
+  8060e0:	ed                   	in     (%dx),%eax
+  8060e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060e6:	00 00                	add    %al,(%rax)
+  8060e8:	ed                   	in     (%dx),%eax
+  8060e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060ee:	00 00                	add    %al,(%rax)
+  8060f0:	ed                   	in     (%dx),%eax
+  8060f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8060f6:	00 00                	add    %al,(%rax)
+  8060f8:	ed                   	in     (%dx),%eax
+  8060f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8060fe:	00 00                	add    %al,(%rax)
+  806100:	ed                   	in     (%dx),%eax
+  806101:	0d 80 00 00 00       	or     $0x80,%eax
+  806106:	00 00                	add    %al,(%rax)
+  806108:	ed                   	in     (%dx),%eax
+  806109:	0d 80 00 00 00       	or     $0x80,%eax
+  80610e:	00 00                	add    %al,(%rax)
+  806110:	ed                   	in     (%dx),%eax
+  806111:	0d 80 00 00 00       	or     $0x80,%eax
+  806116:	00 00                	add    %al,(%rax)
+  806118:	ed                   	in     (%dx),%eax
+  806119:	0d 80 00 00 00       	or     $0x80,%eax
+  80611e:	00 00                	add    %al,(%rax)
+  806120:	ed                   	in     (%dx),%eax
+  806121:	0d 80 00 00 00       	or     $0x80,%eax
+  806126:	00 00                	add    %al,(%rax)
+  806128:	ed                   	in     (%dx),%eax
+  806129:	0d 80 00 00 00       	or     $0x80,%eax
+  80612e:	00 00                	add    %al,(%rax)
+  806130:	ed                   	in     (%dx),%eax
+  806131:	0d 80 00 00 00       	or     $0x80,%eax
+  806136:	00 00                	add    %al,(%rax)
+  806138:	ed                   	in     (%dx),%eax
+  806139:	0d 80 00 00 00       	or     $0x80,%eax
+  80613e:	00 00                	add    %al,(%rax)
+  806140:	ed                   	in     (%dx),%eax
+  806141:	0d 80 00 00 00       	or     $0x80,%eax
+  806146:	00 00                	add    %al,(%rax)
+  806148:	ed                   	in     (%dx),%eax
+  806149:	0d 80 00 00 00       	or     $0x80,%eax
+  80614e:	00 00                	add    %al,(%rax)
+  806150:	ed                   	in     (%dx),%eax
+  806151:	0d 80 00 00 00       	or     $0x80,%eax
+  806156:	00 00                	add    %al,(%rax)
+  806158:	ed                   	in     (%dx),%eax
+  806159:	0d 80 00 00 00       	or     $0x80,%eax
+  80615e:	00 00                	add    %al,(%rax)
+  806160:	ed                   	in     (%dx),%eax
+  806161:	0d 80 00 00 00       	or     $0x80,%eax
+  806166:	00 00                	add    %al,(%rax)
+  806168:	ed                   	in     (%dx),%eax
+  806169:	0d 80 00 00 00       	or     $0x80,%eax
+  80616e:	00 00                	add    %al,(%rax)
+  806170:	ed                   	in     (%dx),%eax
+  806171:	0d 80 00 00 00       	or     $0x80,%eax
+  806176:	00 00                	add    %al,(%rax)
+  806178:	ed                   	in     (%dx),%eax
+  806179:	0d 80 00 00 00       	or     $0x80,%eax
+  80617e:	00 00                	add    %al,(%rax)
+  806180:	ed                   	in     (%dx),%eax
+  806181:	0d 80 00 00 00       	or     $0x80,%eax
+  806186:	00 00                	add    %al,(%rax)
+  806188:	ed                   	in     (%dx),%eax
+  806189:	0d 80 00 00 00       	or     $0x80,%eax
+  80618e:	00 00                	add    %al,(%rax)
+  806190:	ed                   	in     (%dx),%eax
+  806191:	0d 80 00 00 00       	or     $0x80,%eax
+  806196:	00 00                	add    %al,(%rax)
+  806198:	ed                   	in     (%dx),%eax
+  806199:	0d 80 00 00 00       	or     $0x80,%eax
+  80619e:	00 00                	add    %al,(%rax)
+  8061a0:	ed                   	in     (%dx),%eax
+  8061a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061a6:	00 00                	add    %al,(%rax)
+  8061a8:	ed                   	in     (%dx),%eax
+  8061a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ae:	00 00                	add    %al,(%rax)
+  8061b0:	ed                   	in     (%dx),%eax
+  8061b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061b6:	00 00                	add    %al,(%rax)
+  8061b8:	f4                   	hlt
+  8061b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8061bf:	00 ed                	add    %ch,%ch
+  8061c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061c6:	00 00                	add    %al,(%rax)
+  8061c8:	ed                   	in     (%dx),%eax
+  8061c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ce:	00 00                	add    %al,(%rax)
+  8061d0:	2c 0b                	sub    $0xb,%al
+  8061d2:	80 00 00             	addb   $0x0,(%rax)
+  8061d5:	00 00                	add    %al,(%rax)
+  8061d7:	00 ed                	add    %ch,%ch
+  8061d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061de:	00 00                	add    %al,(%rax)
+  8061e0:	ed                   	in     (%dx),%eax
+  8061e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061e6:	00 00                	add    %al,(%rax)
+  8061e8:	ed                   	in     (%dx),%eax
+  8061e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ee:	00 00                	add    %al,(%rax)
+  8061f0:	ed                   	in     (%dx),%eax
+  8061f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061f6:	00 00                	add    %al,(%rax)
+  8061f8:	ed                   	in     (%dx),%eax
+  8061f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061fe:	00 00                	add    %al,(%rax)
+  806200:	ed                   	in     (%dx),%eax
+  806201:	0d 80 00 00 00       	or     $0x80,%eax
+  806206:	00 00                	add    %al,(%rax)
+  806208:	ed                   	in     (%dx),%eax
+  806209:	0d 80 00 00 00       	or     $0x80,%eax
+  80620e:	00 00                	add    %al,(%rax)
+  806210:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806213:	00 00                	add    %al,(%rax)
+  806215:	00 00                	add    %al,(%rax)
+  806217:	00 cb                	add    %cl,%bl
+  806219:	0d 80 00 00 00       	or     $0x80,%eax
+  80621e:	00 00                	add    %al,(%rax)
+  806220:	ed                   	in     (%dx),%eax
+  806221:	0d 80 00 00 00       	or     $0x80,%eax
+  806226:	00 00                	add    %al,(%rax)
+  806228:	ed                   	in     (%dx),%eax
+  806229:	0d 80 00 00 00       	or     $0x80,%eax
+  80622e:	00 00                	add    %al,(%rax)
+  806230:	ed                   	in     (%dx),%eax
+  806231:	0d 80 00 00 00       	or     $0x80,%eax
+  806236:	00 00                	add    %al,(%rax)
+  806238:	6a 0a                	push   $0xa
+  80623a:	80 00 00             	addb   $0x0,(%rax)
+  80623d:	00 00                	add    %al,(%rax)
+  80623f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806245:	00 00                	add    %al,(%rax)
+  806247:	00 ed                	add    %ch,%ch
+  806249:	0d 80 00 00 00       	or     $0x80,%eax
+  80624e:	00 00                	add    %al,(%rax)
+  806250:	ed                   	in     (%dx),%eax
+  806251:	0d 80 00 00 00       	or     $0x80,%eax
+  806256:	00 00                	add    %al,(%rax)
+  806258:	3c 0a                	cmp    $0xa,%al
+  80625a:	80 00 00             	addb   $0x0,(%rax)
+  80625d:	00 00                	add    %al,(%rax)
+  80625f:	00 ed                	add    %ch,%ch
+  806261:	0d 80 00 00 00       	or     $0x80,%eax
+  806266:	00 00                	add    %al,(%rax)
+  806268:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80626b:	00 00                	add    %al,(%rax)
+  80626d:	00 00                	add    %al,(%rax)
+  80626f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806275:	00 00                	add    %al,(%rax)
+  806277:	00 29                	add    %ch,(%rcx)
+  806279:	0c 80                	or     $0x80,%al
+  80627b:	00 00                	add    %al,(%rax)
+  80627d:	00 00                	add    %al,(%rax)
+  80627f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  806282:	80 00 00             	addb   $0x0,(%rax)
+  806285:	00 00                	add    %al,(%rax)
+  806287:	00 ed                	add    %ch,%ch
+  806289:	0d 80 00 00 00       	or     $0x80,%eax
+  80628e:	00 00                	add    %al,(%rax)
+  806290:	1a 0b                	sbb    (%rbx),%cl
+  806292:	80 00 00             	addb   $0x0,(%rax)
+  806295:	00 00                	add    %al,(%rax)
+  806297:	00 ed                	add    %ch,%ch
+  806299:	0d 80 00 00 00       	or     $0x80,%eax
+  80629e:	00 00                	add    %al,(%rax)
+  8062a0:	ce                   	(bad)
+  8062a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8062a7:	00 ed                	add    %ch,%ch
+  8062a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ae:	00 00                	add    %al,(%rax)
+  8062b0:	ed                   	in     (%dx),%eax
+  8062b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062b6:	00 00                	add    %al,(%rax)
+  8062b8:	f4                   	hlt
+  8062b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8062bf:	00 37                	add    %dh,(%rdi)
+  8062c1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062ca:	80 00 00             	addb   $0x0,(%rax)
+  8062cd:	00 00                	add    %al,(%rax)
+  8062cf:	00 37                	add    %dh,(%rdi)
+  8062d1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8062d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062da:	80 00 00             	addb   $0x0,(%rax)
+  8062dd:	00 00                	add    %al,(%rax)
+  8062df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062e2:	80 00 00             	addb   $0x0,(%rax)
+  8062e5:	00 00                	add    %al,(%rax)
+  8062e7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  8062eb:	00 00                	add    %al,(%rax)
+  8062ed:	00 00                	add    %al,(%rax)
+  8062ef:	00 d2                	add    %dl,%dl
+  8062f1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8062f7:	00 d2                	add    %dl,%dl
+  8062f9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8062ff:	00 d2                	add    %dl,%dl
+  806301:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806307:	00 d2                	add    %dl,%dl
+  806309:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80630f:	00 d2                	add    %dl,%dl
+  806311:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806317:	00 d2                	add    %dl,%dl
+  806319:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80631f:	00 d2                	add    %dl,%dl
+  806321:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806327:	00 f6                	add    %dh,%dh
+  806329:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80632f:	00 f6                	add    %dh,%dh
+  806331:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806337:	00 5f 12             	add    %bl,0x12(%rdi)
+  80633a:	80 00 00             	addb   $0x0,(%rax)
+  80633d:	00 00                	add    %al,(%rax)
+  80633f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806342:	80 00 00             	addb   $0x0,(%rax)
+  806345:	00 00                	add    %al,(%rax)
+  806347:	00 5f 12             	add    %bl,0x12(%rdi)
+  80634a:	80 00 00             	addb   $0x0,(%rax)
+  80634d:	00 00                	add    %al,(%rax)
+  80634f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806352:	80 00 00             	addb   $0x0,(%rax)
+  806355:	00 00                	add    %al,(%rax)
+  806357:	00 5f 12             	add    %bl,0x12(%rdi)
+  80635a:	80 00 00             	addb   $0x0,(%rax)
+  80635d:	00 00                	add    %al,(%rax)
+  80635f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806362:	80 00 00             	addb   $0x0,(%rax)
+  806365:	00 00                	add    %al,(%rax)
+  806367:	00 5f 12             	add    %bl,0x12(%rdi)
+  80636a:	80 00 00             	addb   $0x0,(%rax)
+  80636d:	00 00                	add    %al,(%rax)
+  80636f:	00 22                	add    %ah,(%rdx)
+  806371:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806377:	00 22                	add    %ah,(%rdx)
+  806379:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80637f:	00 22                	add    %ah,(%rdx)
+  806381:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806387:	00 22                	add    %ah,(%rdx)
+  806389:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80638f:	00 22                	add    %ah,(%rdx)
+  806391:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806397:	00 22                	add    %ah,(%rdx)
+  806399:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80639f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063a2:	80 00 00             	addb   $0x0,(%rax)
+  8063a5:	00 00                	add    %al,(%rax)
+  8063a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063aa:	80 00 00             	addb   $0x0,(%rax)
+  8063ad:	00 00                	add    %al,(%rax)
+  8063af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063b2:	80 00 00             	addb   $0x0,(%rax)
+  8063b5:	00 00                	add    %al,(%rax)
+  8063b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ba:	80 00 00             	addb   $0x0,(%rax)
+  8063bd:	00 00                	add    %al,(%rax)
+  8063bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063c2:	80 00 00             	addb   $0x0,(%rax)
+  8063c5:	00 00                	add    %al,(%rax)
+  8063c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ca:	80 00 00             	addb   $0x0,(%rax)
+  8063cd:	00 00                	add    %al,(%rax)
+  8063cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063d2:	80 00 00             	addb   $0x0,(%rax)
+  8063d5:	00 00                	add    %al,(%rax)
+  8063d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063da:	80 00 00             	addb   $0x0,(%rax)
+  8063dd:	00 00                	add    %al,(%rax)
+  8063df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063e2:	80 00 00             	addb   $0x0,(%rax)
+  8063e5:	00 00                	add    %al,(%rax)
+  8063e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ea:	80 00 00             	addb   $0x0,(%rax)
+  8063ed:	00 00                	add    %al,(%rax)
+  8063ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063f2:	80 00 00             	addb   $0x0,(%rax)
+  8063f5:	00 00                	add    %al,(%rax)
+  8063f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063fa:	80 00 00             	addb   $0x0,(%rax)
+  8063fd:	00 00                	add    %al,(%rax)
+  8063ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806402:	80 00 00             	addb   $0x0,(%rax)
+  806405:	00 00                	add    %al,(%rax)
+  806407:	00 5f 12             	add    %bl,0x12(%rdi)
+  80640a:	80 00 00             	addb   $0x0,(%rax)
+  80640d:	00 00                	add    %al,(%rax)
+  80640f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806412:	80 00 00             	addb   $0x0,(%rax)
+  806415:	00 00                	add    %al,(%rax)
+  806417:	00 5f 12             	add    %bl,0x12(%rdi)
+  80641a:	80 00 00             	addb   $0x0,(%rax)
+  80641d:	00 00                	add    %al,(%rax)
+  80641f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806422:	80 00 00             	addb   $0x0,(%rax)
+  806425:	00 00                	add    %al,(%rax)
+  806427:	00 46 12             	add    %al,0x12(%rsi)
+  80642a:	80 00 00             	addb   $0x0,(%rax)
+  80642d:	00 00                	add    %al,(%rax)
+  80642f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806432:	80 00 00             	addb   $0x0,(%rax)
+  806435:	00 00                	add    %al,(%rax)
+  806437:	00 5f 12             	add    %bl,0x12(%rdi)
+  80643a:	80 00 00             	addb   $0x0,(%rax)
+  80643d:	00 00                	add    %al,(%rax)
+  80643f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806442:	80 00 00             	addb   $0x0,(%rax)
+  806445:	00 00                	add    %al,(%rax)
+  806447:	00 5f 12             	add    %bl,0x12(%rdi)
+  80644a:	80 00 00             	addb   $0x0,(%rax)
+  80644d:	00 00                	add    %al,(%rax)
+  80644f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806452:	80 00 00             	addb   $0x0,(%rax)
+  806455:	00 00                	add    %al,(%rax)
+  806457:	00 5f 12             	add    %bl,0x12(%rdi)
+  80645a:	80 00 00             	addb   $0x0,(%rax)
+  80645d:	00 00                	add    %al,(%rax)
+  80645f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806462:	80 00 00             	addb   $0x0,(%rax)
+  806465:	00 00                	add    %al,(%rax)
+  806467:	00 5f 12             	add    %bl,0x12(%rdi)
+  80646a:	80 00 00             	addb   $0x0,(%rax)
+  80646d:	00 00                	add    %al,(%rax)
+  80646f:	00 22                	add    %ah,(%rdx)
+  806471:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806477:	00 22                	add    %ah,(%rdx)
+  806479:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80647f:	00 22                	add    %ah,(%rdx)
+  806481:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806487:	00 22                	add    %ah,(%rdx)
+  806489:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80648f:	00 22                	add    %ah,(%rdx)
+  806491:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806497:	00 22                	add    %ah,(%rdx)
+  806499:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80649f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064a2:	80 00 00             	addb   $0x0,(%rax)
+  8064a5:	00 00                	add    %al,(%rax)
+  8064a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064aa:	80 00 00             	addb   $0x0,(%rax)
+  8064ad:	00 00                	add    %al,(%rax)
+  8064af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064b2:	80 00 00             	addb   $0x0,(%rax)
+  8064b5:	00 00                	add    %al,(%rax)
+  8064b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ba:	80 00 00             	addb   $0x0,(%rax)
+  8064bd:	00 00                	add    %al,(%rax)
+  8064bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064c2:	80 00 00             	addb   $0x0,(%rax)
+  8064c5:	00 00                	add    %al,(%rax)
+  8064c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ca:	80 00 00             	addb   $0x0,(%rax)
+  8064cd:	00 00                	add    %al,(%rax)
+  8064cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064d2:	80 00 00             	addb   $0x0,(%rax)
+  8064d5:	00 00                	add    %al,(%rax)
+  8064d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064da:	80 00 00             	addb   $0x0,(%rax)
+  8064dd:	00 00                	add    %al,(%rax)
+  8064df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064e2:	80 00 00             	addb   $0x0,(%rax)
+  8064e5:	00 00                	add    %al,(%rax)
+  8064e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ea:	80 00 00             	addb   $0x0,(%rax)
+  8064ed:	00 00                	add    %al,(%rax)
+  8064ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064f2:	80 00 00             	addb   $0x0,(%rax)
+  8064f5:	00 00                	add    %al,(%rax)
+  8064f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064fa:	80 00 00             	addb   $0x0,(%rax)
+  8064fd:	00 00                	add    %al,(%rax)
+  8064ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806502:	80 00 00             	addb   $0x0,(%rax)
+  806505:	00 00                	add    %al,(%rax)
+  806507:	00 5f 12             	add    %bl,0x12(%rdi)
+  80650a:	80 00 00             	addb   $0x0,(%rax)
+  80650d:	00 00                	add    %al,(%rax)
+  80650f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806512:	80 00 00             	addb   $0x0,(%rax)
+  806515:	00 00                	add    %al,(%rax)
+  806517:	00 5f 12             	add    %bl,0x12(%rdi)
+  80651a:	80 00 00             	addb   $0x0,(%rax)
+  80651d:	00 00                	add    %al,(%rax)
+  80651f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806522:	80 00 00             	addb   $0x0,(%rax)
+  806525:	00 00                	add    %al,(%rax)
+  806527:	00 46 12             	add    %al,0x12(%rsi)
+  80652a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806540 <basefix.0>:
+  806540:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806550:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806560:	10 00 69 20 61 6d 20 70 61 72 65 6e 74 20 65 6e     ..i am parent en
+  806570:	76 69 72 6f 6e 6d 65 6e 74 20 25 30 38 78 0a 00     vironment %08x..
+  806580:	68 65 6c 6c 6f 00 73 70 61 77 6e 28 68 65 6c 6c     hello.spawn(hell
+  806590:	6f 29 20 66 61 69 6c 65 64 3a 20 25 69 00 75 73     o) failed: %i.us
+  8065a0:	65 72 2f 73 70 61 77 6e 68 65 6c 6c 6f 2e 63 00     er/spawnhello.c.
+  8065b0:	3c 75 6e 6b 6e 6f 77 6e 3e 00 66 0f 1f 44 00 00     <unknown>.f..D..
+  8065c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8065d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8065e0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8065f0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806600:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806610:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806620:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806630:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806640:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806650:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806660:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806670:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806680:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806690:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8066a0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8066b0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8066c0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8066d0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8066e0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8066f0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806700:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806710:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806720:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806730:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806740:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806750:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806760:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806770:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  806780:	9a 19 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806790:	e1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8067a0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8067b0:	f1 1f 80 00 00 00 00 00 b9 19 80 00 00 00 00 00     ................
+  8067c0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8067d0:	ad 19 80 00 00 00 00 00 27 1a 80 00 00 00 00 00     ........'.......
+  8067e0:	f1 1f 80 00 00 00 00 00 ad 19 80 00 00 00 00 00     ................
+  8067f0:	f3 19 80 00 00 00 00 00 f3 19 80 00 00 00 00 00     ................
+  806800:	f3 19 80 00 00 00 00 00 f3 19 80 00 00 00 00 00     ................
+  806810:	f3 19 80 00 00 00 00 00 f3 19 80 00 00 00 00 00     ................
+  806820:	f3 19 80 00 00 00 00 00 f3 19 80 00 00 00 00 00     ................
+  806830:	f3 19 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806840:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806850:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806860:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806870:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806880:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806890:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068a0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068b0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068c0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068d0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068e0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8068f0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806900:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806910:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806920:	f1 1f 80 00 00 00 00 00 0f 1f 80 00 00 00 00 00     ................
+  806930:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806940:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806950:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806960:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806970:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806980:	55 1a 80 00 00 00 00 00 24 1c 80 00 00 00 00 00     U.......$.......
+  806990:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8069a0:	f1 1f 80 00 00 00 00 00 4a 1a 80 00 00 00 00 00     ........J.......
+  8069b0:	84 1a 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8069c0:	f1 1f 80 00 00 00 00 00 3f 1a 80 00 00 00 00 00     ........?.......
+  8069d0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  8069e0:	cd 1d 80 00 00 00 00 00 9c 1e 80 00 00 00 00 00     ................
+  8069f0:	f1 1f 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806a00:	1b 1b 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806a10:	f8 1c 80 00 00 00 00 00 f1 1f 80 00 00 00 00 00     ................
+  806a20:	f1 1f 80 00 00 00 00 00 0f 1f 80 00 00 00 00 00     ................
+  806a30:	f1 1f 80 00 00 00 00 00 a3 19 80 00 00 00 00 00     ................
+
+0000000000806a40 <error_string>:
+	...
+  806a48:	15 66 80 00 00 00 00 00 27 66 80 00 00 00 00 00     .f......'f......
+  806a58:	37 66 80 00 00 00 00 00 49 66 80 00 00 00 00 00     7f......If......
+  806a68:	57 66 80 00 00 00 00 00 6b 66 80 00 00 00 00 00     Wf......kf......
+  806a78:	80 66 80 00 00 00 00 00 93 66 80 00 00 00 00 00     .f.......f......
+  806a88:	a5 66 80 00 00 00 00 00 b9 66 80 00 00 00 00 00     .f.......f......
+  806a98:	c9 66 80 00 00 00 00 00 dc 66 80 00 00 00 00 00     .f.......f......
+  806aa8:	f3 66 80 00 00 00 00 00 09 67 80 00 00 00 00 00     .f.......g......
+  806ab8:	21 67 80 00 00 00 00 00 39 67 80 00 00 00 00 00     !g......9g......
+  806ac8:	46 67 80 00 00 00 00 00 e0 6a 80 00 00 00 00 00     Fg.......j......
+  806ad8:	5a 67 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Zg......file is 
+  806ae8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806af8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806b08:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806b18:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806b28:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806b38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806b48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806b58:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806b68:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806b78:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806b88:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806b98:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806ba8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806bb8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806bc0 <devtab>:
+  806bc0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806bd0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806be0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806bf0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806c00:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806c10:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806c20:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806c30:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806c40:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806c50:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  806c60:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  806c70:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  806c80:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806c90:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  806ca0:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  806cb0:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  806cc0:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  806cd0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  806ce0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  806cf0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806d00:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806d10:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806d20:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806d30:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806d40:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806d50:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806d60:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806d70:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806d80:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806d90:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806da0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806db0:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
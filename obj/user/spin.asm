@@ -0,0 +1,10500 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 13 23 80 00 00 	movabs $0x802313,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 86 34 80 00 00 	movabs $0x803486,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 86 34 80 00 00 	movabs $0x803486,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 5c 3e 80 00 00 	movabs $0x803e5c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 5c 3e 80 00 00 	movabs $0x803e5c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 6a 16 80 00 00 	movabs $0x80166a,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 6c 5f 80 00 00 	movabs $0x805f6c,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 18 59 80 00 00 	movabs $0x805918,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 1a 59 80 00 00 	movabs $0x80591a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 1d 59 80 00 00 	movabs $0x80591d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 33 21 80 00 00 	movabs $0x802133,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 5a 4c 80 00 00 	movabs $0x804c5a,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 31 4f 80 00 00 	movabs $0x804f31,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 d9 31 80 00 00 	movabs $0x8031d9,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 70 35 80 00 00 	movabs $0x803570,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 3f 35 80 00 00 	movabs $0x80353f,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 3f 35 80 00 00 	movabs $0x80353f,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 86 34 80 00 00 	movabs $0x803486,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 d9 31 80 00 00 	movabs $0x8031d9,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb e0 22 80 00 00 	movabs $0x8022e0,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 59 80 00 00 	movabs $0x805920,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 e0 22 80 00 00 	movabs $0x8022e0,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 13 23 80 00 00 	movabs $0x802313,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc e0 22 80 00 00 	movabs $0x8022e0,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 5b 80 00 00 	movabs $0x805bc0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf e0 22 80 00 00 	movabs $0x8022e0,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf e0 22 80 00 00 	movabs $0x8022e0,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 5e 80 00 00 	movabs $0x805e40,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 5e 80 00 00 	movabs $0x805e40,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 38 25 80 00 00 	movabs $0x802538,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 c2 00 00 00       	call   8015c1 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 55                	push   %r13
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  80150e:	48 bf 68 5e 80 00 00 	movabs $0x805e68,%rdi
+  801515:	00 00 00 
+  801518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151d:	48 ba 3a 17 80 00 00 	movabs $0x80173a,%rdx
+  801524:	00 00 00 
+  801527:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  801529:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+  801535:	85 c0                	test   %eax,%eax
+  801537:	75 1d                	jne    801556 <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  801539:	48 bf e0 5e 80 00 00 	movabs $0x805ee0,%rdi
+  801540:	00 00 00 
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	48 ba 3a 17 80 00 00 	movabs $0x80173a,%rdx
+  80154f:	00 00 00 
+  801552:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  801554:	eb fe                	jmp    801554 <umain+0x53>
+  801556:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  801558:	48 bf 90 5e 80 00 00 	movabs $0x805e90,%rdi
+  80155f:	00 00 00 
+  801562:	b8 00 00 00 00       	mov    $0x0,%eax
+  801567:	49 bd 3a 17 80 00 00 	movabs $0x80173a,%r13
+  80156e:	00 00 00 
+  801571:	41 ff d5             	call   *%r13
+    sys_yield();
+  801574:	49 bc 35 27 80 00 00 	movabs $0x802735,%r12
+  80157b:	00 00 00 
+  80157e:	41 ff d4             	call   *%r12
+    sys_yield();
+  801581:	41 ff d4             	call   *%r12
+    sys_yield();
+  801584:	41 ff d4             	call   *%r12
+    sys_yield();
+  801587:	41 ff d4             	call   *%r12
+    sys_yield();
+  80158a:	41 ff d4             	call   *%r12
+    sys_yield();
+  80158d:	41 ff d4             	call   *%r12
+    sys_yield();
+  801590:	41 ff d4             	call   *%r12
+    sys_yield();
+  801593:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  801596:	48 bf b8 5e 80 00 00 	movabs $0x805eb8,%rdi
+  80159d:	00 00 00 
+  8015a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a5:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8015a8:	89 df                	mov    %ebx,%edi
+  8015aa:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  8015b1:	00 00 00 
+  8015b4:	ff d0                	call   *%rax
+}
+  8015b6:	48 83 c4 08          	add    $0x8,%rsp
+  8015ba:	5b                   	pop    %rbx
+  8015bb:	41 5c                	pop    %r12
+  8015bd:	41 5d                	pop    %r13
+  8015bf:	5d                   	pop    %rbp
+  8015c0:	c3                   	ret
+
+00000000008015c1 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	41 56                	push   %r14
+  8015c7:	41 55                	push   %r13
+  8015c9:	41 54                	push   %r12
+  8015cb:	53                   	push   %rbx
+  8015cc:	41 89 fd             	mov    %edi,%r13d
+  8015cf:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015d2:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8015d9:	00 00 00 
+  8015dc:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8015e3:	00 00 00 
+  8015e6:	48 39 c2             	cmp    %rax,%rdx
+  8015e9:	73 17                	jae    801602 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8015eb:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015ee:	49 89 c4             	mov    %rax,%r12
+  8015f1:	48 83 c3 08          	add    $0x8,%rbx
+  8015f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fa:	ff 53 f8             	call   *-0x8(%rbx)
+  8015fd:	4c 39 e3             	cmp    %r12,%rbx
+  801600:	72 ef                	jb     8015f1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801602:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  801609:	00 00 00 
+  80160c:	ff d0                	call   *%rax
+  80160e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801613:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80161a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801621:	00 00 00 
+  801624:	48 01 d0             	add    %rdx,%rax
+  801627:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80162e:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801631:	45 85 ed             	test   %r13d,%r13d
+  801634:	7e 0d                	jle    801643 <libmain+0x82>
+  801636:	49 8b 06             	mov    (%r14),%rax
+  801639:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801640:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801643:	4c 89 f6             	mov    %r14,%rsi
+  801646:	44 89 ef             	mov    %r13d,%edi
+  801649:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801655:	48 b8 6a 16 80 00 00 	movabs $0x80166a,%rax
+  80165c:	00 00 00 
+  80165f:	ff d0                	call   *%rax
+#endif
+}
+  801661:	5b                   	pop    %rbx
+  801662:	41 5c                	pop    %r12
+  801664:	41 5d                	pop    %r13
+  801666:	41 5e                	pop    %r14
+  801668:	5d                   	pop    %rbp
+  801669:	c3                   	ret
+
+000000000080166a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80166e:	48 b8 0c 32 80 00 00 	movabs $0x80320c,%rax
+  801675:	00 00 00 
+  801678:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80167a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167f:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  801686:	00 00 00 
+  801689:	ff d0                	call   *%rax
+}
+  80168b:	5d                   	pop    %rbp
+  80168c:	c3                   	ret
+
+000000000080168d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	53                   	push   %rbx
+  801692:	48 83 ec 08          	sub    $0x8,%rsp
+  801696:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801699:	8b 06                	mov    (%rsi),%eax
+  80169b:	8d 50 01             	lea    0x1(%rax),%edx
+  80169e:	89 16                	mov    %edx,(%rsi)
+  8016a0:	48 98                	cltq
+  8016a2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016a7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016ad:	74 0a                	je     8016b9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8016af:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8016b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b7:	c9                   	leave
+  8016b8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8016b9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8016bd:	be ff 00 00 00       	mov    $0xff,%esi
+  8016c2:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+        state->offset = 0;
+  8016ce:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8016d4:	eb d9                	jmp    8016af <putch+0x22>
+
+00000000008016d6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8016e1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8016e4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8016eb:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8016f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8016f8:	48 89 f1             	mov    %rsi,%rcx
+  8016fb:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801702:	48 bf 8d 16 80 00 00 	movabs $0x80168d,%rdi
+  801709:	00 00 00 
+  80170c:	48 b8 8a 18 80 00 00 	movabs $0x80188a,%rax
+  801713:	00 00 00 
+  801716:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801718:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80171f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801726:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801732:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801738:	c9                   	leave
+  801739:	c3                   	ret
+
+000000000080173a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80173a:	55                   	push   %rbp
+  80173b:	48 89 e5             	mov    %rsp,%rbp
+  80173e:	48 83 ec 50          	sub    $0x50,%rsp
+  801742:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801746:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80174a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80174e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801752:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801756:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80175d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801761:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801765:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801769:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80176d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801771:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+
+000000000080177f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80177f:	55                   	push   %rbp
+  801780:	48 89 e5             	mov    %rsp,%rbp
+  801783:	41 57                	push   %r15
+  801785:	41 56                	push   %r14
+  801787:	41 55                	push   %r13
+  801789:	41 54                	push   %r12
+  80178b:	53                   	push   %rbx
+  80178c:	48 83 ec 18          	sub    $0x18,%rsp
+  801790:	49 89 fc             	mov    %rdi,%r12
+  801793:	49 89 f5             	mov    %rsi,%r13
+  801796:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80179a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80179d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017a0:	41 89 cf             	mov    %ecx,%r15d
+  8017a3:	4c 39 fa             	cmp    %r15,%rdx
+  8017a6:	73 5b                	jae    801803 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017a8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017ac:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8017b0:	85 db                	test   %ebx,%ebx
+  8017b2:	7e 0e                	jle    8017c2 <print_num+0x43>
+            putch(padc, put_arg);
+  8017b4:	4c 89 ee             	mov    %r13,%rsi
+  8017b7:	44 89 f7             	mov    %r14d,%edi
+  8017ba:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8017bd:	83 eb 01             	sub    $0x1,%ebx
+  8017c0:	75 f2                	jne    8017b4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8017c2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8017c6:	48 b9 19 5f 80 00 00 	movabs $0x805f19,%rcx
+  8017cd:	00 00 00 
+  8017d0:	48 b8 08 5f 80 00 00 	movabs $0x805f08,%rax
+  8017d7:	00 00 00 
+  8017da:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8017de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e7:	49 f7 f7             	div    %r15
+  8017ea:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8017ee:	4c 89 ee             	mov    %r13,%rsi
+  8017f1:	41 ff d4             	call   *%r12
+}
+  8017f4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8017f8:	5b                   	pop    %rbx
+  8017f9:	41 5c                	pop    %r12
+  8017fb:	41 5d                	pop    %r13
+  8017fd:	41 5e                	pop    %r14
+  8017ff:	41 5f                	pop    %r15
+  801801:	5d                   	pop    %rbp
+  801802:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801803:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180c:	49 f7 f7             	div    %r15
+  80180f:	48 83 ec 08          	sub    $0x8,%rsp
+  801813:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801817:	52                   	push   %rdx
+  801818:	45 0f be c9          	movsbl %r9b,%r9d
+  80181c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801820:	48 89 c2             	mov    %rax,%rdx
+  801823:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	48 83 c4 10          	add    $0x10,%rsp
+  801833:	eb 8d                	jmp    8017c2 <print_num+0x43>
+
+0000000000801835 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801835:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801839:	48 8b 06             	mov    (%rsi),%rax
+  80183c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801840:	73 0a                	jae    80184c <sprintputch+0x17>
+        *state->start++ = ch;
+  801842:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801846:	48 89 16             	mov    %rdx,(%rsi)
+  801849:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80184c:	c3                   	ret
+
+000000000080184d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80184d:	55                   	push   %rbp
+  80184e:	48 89 e5             	mov    %rsp,%rbp
+  801851:	48 83 ec 50          	sub    $0x50,%rsp
+  801855:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801859:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80185d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801861:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801868:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80186c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801870:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801874:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801878:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80187c:	48 b8 8a 18 80 00 00 	movabs $0x80188a,%rax
+  801883:	00 00 00 
+  801886:	ff d0                	call   *%rax
+}
+  801888:	c9                   	leave
+  801889:	c3                   	ret
+
+000000000080188a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80188a:	55                   	push   %rbp
+  80188b:	48 89 e5             	mov    %rsp,%rbp
+  80188e:	41 57                	push   %r15
+  801890:	41 56                	push   %r14
+  801892:	41 55                	push   %r13
+  801894:	41 54                	push   %r12
+  801896:	53                   	push   %rbx
+  801897:	48 83 ec 38          	sub    $0x38,%rsp
+  80189b:	49 89 fe             	mov    %rdi,%r14
+  80189e:	49 89 f5             	mov    %rsi,%r13
+  8018a1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018a4:	48 8b 01             	mov    (%rcx),%rax
+  8018a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018ab:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8018af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018b3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8018b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018bb:	eb 0d                	jmp    8018ca <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8018bd:	40 0f b6 ff          	movzbl %dil,%edi
+  8018c1:	4c 89 ee             	mov    %r13,%rsi
+  8018c4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8018c7:	4c 89 e3             	mov    %r12,%rbx
+  8018ca:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8018ce:	0f b6 3b             	movzbl (%rbx),%edi
+  8018d1:	40 80 ff 25          	cmp    $0x25,%dil
+  8018d5:	74 14                	je     8018eb <vprintfmt+0x61>
+            if (!ch) return;
+  8018d7:	40 84 ff             	test   %dil,%dil
+  8018da:	75 e1                	jne    8018bd <vprintfmt+0x33>
+}
+  8018dc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018e0:	5b                   	pop    %rbx
+  8018e1:	41 5c                	pop    %r12
+  8018e3:	41 5d                	pop    %r13
+  8018e5:	41 5e                	pop    %r14
+  8018e7:	41 5f                	pop    %r15
+  8018e9:	5d                   	pop    %rbp
+  8018ea:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8018eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8018f4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8018f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8018ff:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801906:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80190a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80190f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801914:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801917:	83 e8 23             	sub    $0x23,%eax
+  80191a:	3c 57                	cmp    $0x57,%al
+  80191c:	0f 87 67 06 00 00    	ja     801f89 <vprintfmt+0x6ff>
+  801922:	0f b6 c0             	movzbl %al,%eax
+  801925:	48 b9 a0 60 80 00 00 	movabs $0x8060a0,%rcx
+  80192c:	00 00 00 
+  80192f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801932:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801935:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801939:	eb cf                	jmp    80190a <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80193b:	49 89 dc             	mov    %rbx,%r12
+  80193e:	be 01 00 00 00       	mov    $0x1,%esi
+  801943:	eb c5                	jmp    80190a <vprintfmt+0x80>
+            padc = ch;
+  801945:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801949:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80194c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80194f:	eb b9                	jmp    80190a <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801954:	83 f8 2f             	cmp    $0x2f,%eax
+  801957:	77 24                	ja     80197d <vprintfmt+0xf3>
+  801959:	89 c1                	mov    %eax,%ecx
+  80195b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80195f:	83 c0 08             	add    $0x8,%eax
+  801962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801965:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801968:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80196b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80196f:	79 99                	jns    80190a <vprintfmt+0x80>
+                width = precision;
+  801971:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801975:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80197b:	eb 8d                	jmp    80190a <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  80197d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801981:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801989:	eb da                	jmp    801965 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  80198b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801990:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801994:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80199a:	3c 39                	cmp    $0x39,%al
+  80199c:	77 1c                	ja     8019ba <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80199e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019a2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019a6:	0f b6 c0             	movzbl %al,%eax
+  8019a9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019ae:	0f b6 03             	movzbl (%rbx),%eax
+  8019b1:	3c 39                	cmp    $0x39,%al
+  8019b3:	76 e9                	jbe    80199e <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8019b5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8019b8:	eb b1                	jmp    80196b <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8019ba:	49 89 dc             	mov    %rbx,%r12
+  8019bd:	eb ac                	jmp    80196b <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8019bf:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8019c2:	85 c9                	test   %ecx,%ecx
+  8019c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c9:	0f 49 c1             	cmovns %ecx,%eax
+  8019cc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8019cf:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019d2:	e9 33 ff ff ff       	jmp    80190a <vprintfmt+0x80>
+            lflag++;
+  8019d7:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019da:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019dd:	e9 28 ff ff ff       	jmp    80190a <vprintfmt+0x80>
+            lflag--;
+  8019e2:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019e5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019e8:	e9 1d ff ff ff       	jmp    80190a <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  8019ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8019f3:	77 19                	ja     801a0e <vprintfmt+0x184>
+  8019f5:	89 c2                	mov    %eax,%edx
+  8019f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019fb:	83 c0 08             	add    $0x8,%eax
+  8019fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a01:	8b 3a                	mov    (%rdx),%edi
+  801a03:	4c 89 ee             	mov    %r13,%rsi
+  801a06:	41 ff d6             	call   *%r14
+            break;
+  801a09:	e9 bc fe ff ff       	jmp    8018ca <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a1a:	eb e5                	jmp    801a01 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  801a22:	77 5a                	ja     801a7e <vprintfmt+0x1f4>
+  801a24:	89 c2                	mov    %eax,%edx
+  801a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a2a:	83 c0 08             	add    $0x8,%eax
+  801a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a30:	8b 02                	mov    (%rdx),%eax
+  801a32:	89 c1                	mov    %eax,%ecx
+  801a34:	f7 d9                	neg    %ecx
+  801a36:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a39:	83 f9 13             	cmp    $0x13,%ecx
+  801a3c:	7f 4e                	jg     801a8c <vprintfmt+0x202>
+  801a3e:	48 63 c1             	movslq %ecx,%rax
+  801a41:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  801a48:	00 00 00 
+  801a4b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a4f:	48 85 c0             	test   %rax,%rax
+  801a52:	74 38                	je     801a8c <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a54:	48 89 c1             	mov    %rax,%rcx
+  801a57:	48 ba a8 65 80 00 00 	movabs $0x8065a8,%rdx
+  801a5e:	00 00 00 
+  801a61:	4c 89 ee             	mov    %r13,%rsi
+  801a64:	4c 89 f7             	mov    %r14,%rdi
+  801a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6c:	49 b8 4d 18 80 00 00 	movabs $0x80184d,%r8
+  801a73:	00 00 00 
+  801a76:	41 ff d0             	call   *%r8
+  801a79:	e9 4c fe ff ff       	jmp    8018ca <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a8a:	eb a4                	jmp    801a30 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a8c:	48 ba 31 5f 80 00 00 	movabs $0x805f31,%rdx
+  801a93:	00 00 00 
+  801a96:	4c 89 ee             	mov    %r13,%rsi
+  801a99:	4c 89 f7             	mov    %r14,%rdi
+  801a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa1:	49 b8 4d 18 80 00 00 	movabs $0x80184d,%r8
+  801aa8:	00 00 00 
+  801aab:	41 ff d0             	call   *%r8
+  801aae:	e9 17 fe ff ff       	jmp    8018ca <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ab6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ab9:	77 6c                	ja     801b27 <vprintfmt+0x29d>
+  801abb:	89 c2                	mov    %eax,%edx
+  801abd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ac1:	83 c0 08             	add    $0x8,%eax
+  801ac4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ac7:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801aca:	48 85 f6             	test   %rsi,%rsi
+  801acd:	48 b8 2a 5f 80 00 00 	movabs $0x805f2a,%rax
+  801ad4:	00 00 00 
+  801ad7:	48 0f 45 c6          	cmovne %rsi,%rax
+  801adb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801adf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ae3:	7e 06                	jle    801aeb <vprintfmt+0x261>
+  801ae5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ae9:	75 4a                	jne    801b35 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aeb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801aef:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801af3:	0f b6 00             	movzbl (%rax),%eax
+  801af6:	84 c0                	test   %al,%al
+  801af8:	0f 85 9a 00 00 00    	jne    801b98 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801afe:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b01:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	0f 8e bd fd ff ff    	jle    8018ca <vprintfmt+0x40>
+  801b0d:	4c 89 ee             	mov    %r13,%rsi
+  801b10:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b15:	41 ff d6             	call   *%r14
+  801b18:	41 83 ec 01          	sub    $0x1,%r12d
+  801b1c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b20:	75 eb                	jne    801b0d <vprintfmt+0x283>
+  801b22:	e9 a3 fd ff ff       	jmp    8018ca <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b33:	eb 92                	jmp    801ac7 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b35:	49 63 f7             	movslq %r15d,%rsi
+  801b38:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b3c:	48 b8 4e 20 80 00 00 	movabs $0x80204e,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+  801b48:	48 89 c2             	mov    %rax,%rdx
+  801b4b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b4e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b50:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b53:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	7e 91                	jle    801aeb <vprintfmt+0x261>
+  801b5a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b5f:	4c 89 ee             	mov    %r13,%rsi
+  801b62:	44 89 e7             	mov    %r12d,%edi
+  801b65:	41 ff d6             	call   *%r14
+  801b68:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b6c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801b72:	75 eb                	jne    801b5f <vprintfmt+0x2d5>
+  801b74:	e9 72 ff ff ff       	jmp    801aeb <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b79:	0f b6 f8             	movzbl %al,%edi
+  801b7c:	4c 89 ee             	mov    %r13,%rsi
+  801b7f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b82:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b86:	49 83 c4 01          	add    $0x1,%r12
+  801b8a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b90:	84 c0                	test   %al,%al
+  801b92:	0f 84 66 ff ff ff    	je     801afe <vprintfmt+0x274>
+  801b98:	45 85 ff             	test   %r15d,%r15d
+  801b9b:	78 0a                	js     801ba7 <vprintfmt+0x31d>
+  801b9d:	41 83 ef 01          	sub    $0x1,%r15d
+  801ba1:	0f 88 57 ff ff ff    	js     801afe <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ba7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801bab:	74 cc                	je     801b79 <vprintfmt+0x2ef>
+  801bad:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801bb0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801bb5:	80 fa 5e             	cmp    $0x5e,%dl
+  801bb8:	77 c2                	ja     801b7c <vprintfmt+0x2f2>
+  801bba:	eb bd                	jmp    801b79 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801bbc:	40 84 f6             	test   %sil,%sil
+  801bbf:	75 26                	jne    801be7 <vprintfmt+0x35d>
+    switch (lflag) {
+  801bc1:	85 d2                	test   %edx,%edx
+  801bc3:	74 59                	je     801c1e <vprintfmt+0x394>
+  801bc5:	83 fa 01             	cmp    $0x1,%edx
+  801bc8:	74 7b                	je     801c45 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801bca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bcd:	83 f8 2f             	cmp    $0x2f,%eax
+  801bd0:	0f 87 96 00 00 00    	ja     801c6c <vprintfmt+0x3e2>
+  801bd6:	89 c2                	mov    %eax,%edx
+  801bd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bdc:	83 c0 08             	add    $0x8,%eax
+  801bdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801be2:	4c 8b 22             	mov    (%rdx),%r12
+  801be5:	eb 17                	jmp    801bfe <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801be7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bea:	83 f8 2f             	cmp    $0x2f,%eax
+  801bed:	77 21                	ja     801c10 <vprintfmt+0x386>
+  801bef:	89 c2                	mov    %eax,%edx
+  801bf1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf5:	83 c0 08             	add    $0x8,%eax
+  801bf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bfb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801bfe:	4d 85 e4             	test   %r12,%r12
+  801c01:	78 7a                	js     801c7d <vprintfmt+0x3f3>
+            num = i;
+  801c03:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c0b:	e9 56 02 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c1c:	eb dd                	jmp    801bfb <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c21:	83 f8 2f             	cmp    $0x2f,%eax
+  801c24:	77 11                	ja     801c37 <vprintfmt+0x3ad>
+  801c26:	89 c2                	mov    %eax,%edx
+  801c28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c2c:	83 c0 08             	add    $0x8,%eax
+  801c2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c32:	4c 63 22             	movslq (%rdx),%r12
+  801c35:	eb c7                	jmp    801bfe <vprintfmt+0x374>
+  801c37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c43:	eb ed                	jmp    801c32 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c48:	83 f8 2f             	cmp    $0x2f,%eax
+  801c4b:	77 11                	ja     801c5e <vprintfmt+0x3d4>
+  801c4d:	89 c2                	mov    %eax,%edx
+  801c4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c53:	83 c0 08             	add    $0x8,%eax
+  801c56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c59:	4c 8b 22             	mov    (%rdx),%r12
+  801c5c:	eb a0                	jmp    801bfe <vprintfmt+0x374>
+  801c5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6a:	eb ed                	jmp    801c59 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801c6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c78:	e9 65 ff ff ff       	jmp    801be2 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c7d:	4c 89 ee             	mov    %r13,%rsi
+  801c80:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c85:	41 ff d6             	call   *%r14
+                i = -i;
+  801c88:	49 f7 dc             	neg    %r12
+  801c8b:	e9 73 ff ff ff       	jmp    801c03 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c90:	40 84 f6             	test   %sil,%sil
+  801c93:	75 2e                	jne    801cc3 <vprintfmt+0x439>
+    switch (lflag) {
+  801c95:	85 d2                	test   %edx,%edx
+  801c97:	7f 59                	jg     801cf2 <vprintfmt+0x468>
+  801c99:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801c9c:	7d 7a                	jge    801d18 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801c9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ca1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ca4:	0f 87 aa 00 00 00    	ja     801d54 <vprintfmt+0x4ca>
+  801caa:	89 c2                	mov    %eax,%edx
+  801cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb0:	83 c0 08             	add    $0x8,%eax
+  801cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cb6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cb9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cbe:	e9 a3 01 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc6:	83 f8 2f             	cmp    $0x2f,%eax
+  801cc9:	77 19                	ja     801ce4 <vprintfmt+0x45a>
+  801ccb:	89 c2                	mov    %eax,%edx
+  801ccd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd1:	83 c0 08             	add    $0x8,%eax
+  801cd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cda:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801cdf:	e9 82 01 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+  801ce4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ce8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cf0:	eb e5                	jmp    801cd7 <vprintfmt+0x44d>
+    switch (lflag) {
+  801cf2:	83 fa 01             	cmp    $0x1,%edx
+  801cf5:	75 a7                	jne    801c9e <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801cf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cfa:	83 f8 2f             	cmp    $0x2f,%eax
+  801cfd:	77 47                	ja     801d46 <vprintfmt+0x4bc>
+  801cff:	89 c2                	mov    %eax,%edx
+  801d01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d05:	83 c0 08             	add    $0x8,%eax
+  801d08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d0b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d0e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d13:	e9 4e 01 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d1b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d1e:	77 18                	ja     801d38 <vprintfmt+0x4ae>
+  801d20:	89 c2                	mov    %eax,%edx
+  801d22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d26:	83 c0 08             	add    $0x8,%eax
+  801d29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d2c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d2e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d33:	e9 2e 01 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+  801d38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d44:	eb e6                	jmp    801d2c <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d52:	eb b7                	jmp    801d0b <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d60:	e9 51 ff ff ff       	jmp    801cb6 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801d65:	40 84 f6             	test   %sil,%sil
+  801d68:	75 2e                	jne    801d98 <vprintfmt+0x50e>
+    switch (lflag) {
+  801d6a:	85 d2                	test   %edx,%edx
+  801d6c:	7f 59                	jg     801dc7 <vprintfmt+0x53d>
+  801d6e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d71:	7d 77                	jge    801dea <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801d73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d76:	83 f8 2f             	cmp    $0x2f,%eax
+  801d79:	0f 87 a4 00 00 00    	ja     801e23 <vprintfmt+0x599>
+  801d7f:	89 c2                	mov    %eax,%edx
+  801d81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d85:	83 c0 08             	add    $0x8,%eax
+  801d88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d8e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d93:	e9 ce 00 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d9b:	83 f8 2f             	cmp    $0x2f,%eax
+  801d9e:	77 19                	ja     801db9 <vprintfmt+0x52f>
+  801da0:	89 c2                	mov    %eax,%edx
+  801da2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801da6:	83 c0 08             	add    $0x8,%eax
+  801da9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801daf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801db4:	e9 ad 00 00 00       	jmp    801e66 <vprintfmt+0x5dc>
+  801db9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc5:	eb e5                	jmp    801dac <vprintfmt+0x522>
+    switch (lflag) {
+  801dc7:	83 fa 01             	cmp    $0x1,%edx
+  801dca:	75 a7                	jne    801d73 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801dcc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dcf:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd2:	77 41                	ja     801e15 <vprintfmt+0x58b>
+  801dd4:	89 c2                	mov    %eax,%edx
+  801dd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dda:	83 c0 08             	add    $0x8,%eax
+  801ddd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801de3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801de8:	eb 7c                	jmp    801e66 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801dea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ded:	83 f8 2f             	cmp    $0x2f,%eax
+  801df0:	77 15                	ja     801e07 <vprintfmt+0x57d>
+  801df2:	89 c2                	mov    %eax,%edx
+  801df4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df8:	83 c0 08             	add    $0x8,%eax
+  801dfb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dfe:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e00:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e05:	eb 5f                	jmp    801e66 <vprintfmt+0x5dc>
+  801e07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e13:	eb e9                	jmp    801dfe <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e21:	eb bd                	jmp    801de0 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e2f:	e9 57 ff ff ff       	jmp    801d8b <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e34:	4c 89 ee             	mov    %r13,%rsi
+  801e37:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e3c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e3f:	4c 89 ee             	mov    %r13,%rsi
+  801e42:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e47:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e4d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e50:	77 47                	ja     801e99 <vprintfmt+0x60f>
+  801e52:	89 c2                	mov    %eax,%edx
+  801e54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e58:	83 c0 08             	add    $0x8,%eax
+  801e5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e61:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801e66:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801e6e:	0f 94 c0             	sete   %al
+  801e71:	0f b6 c0             	movzbl %al,%eax
+  801e74:	50                   	push   %rax
+  801e75:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e7a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e7e:	4c 89 ee             	mov    %r13,%rsi
+  801e81:	4c 89 f7             	mov    %r14,%rdi
+  801e84:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801e8b:	00 00 00 
+  801e8e:	ff d0                	call   *%rax
+            break;
+  801e90:	48 83 c4 10          	add    $0x10,%rsp
+  801e94:	e9 31 fa ff ff       	jmp    8018ca <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea5:	eb b7                	jmp    801e5e <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801ea7:	40 84 f6             	test   %sil,%sil
+  801eaa:	75 2b                	jne    801ed7 <vprintfmt+0x64d>
+    switch (lflag) {
+  801eac:	85 d2                	test   %edx,%edx
+  801eae:	7f 56                	jg     801f06 <vprintfmt+0x67c>
+  801eb0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801eb3:	7d 77                	jge    801f2c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801eb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebb:	0f 87 a7 00 00 00    	ja     801f68 <vprintfmt+0x6de>
+  801ec1:	89 c2                	mov    %eax,%edx
+  801ec3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec7:	83 c0 08             	add    $0x8,%eax
+  801eca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ed0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ed5:	eb 8f                	jmp    801e66 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ed7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eda:	83 f8 2f             	cmp    $0x2f,%eax
+  801edd:	77 19                	ja     801ef8 <vprintfmt+0x66e>
+  801edf:	89 c2                	mov    %eax,%edx
+  801ee1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee5:	83 c0 08             	add    $0x8,%eax
+  801ee8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eeb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801eee:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ef3:	e9 6e ff ff ff       	jmp    801e66 <vprintfmt+0x5dc>
+  801ef8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801efc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f04:	eb e5                	jmp    801eeb <vprintfmt+0x661>
+    switch (lflag) {
+  801f06:	83 fa 01             	cmp    $0x1,%edx
+  801f09:	75 aa                	jne    801eb5 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f0e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f11:	77 47                	ja     801f5a <vprintfmt+0x6d0>
+  801f13:	89 c2                	mov    %eax,%edx
+  801f15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f19:	83 c0 08             	add    $0x8,%eax
+  801f1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f27:	e9 3a ff ff ff       	jmp    801e66 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f2f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f32:	77 18                	ja     801f4c <vprintfmt+0x6c2>
+  801f34:	89 c2                	mov    %eax,%edx
+  801f36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3a:	83 c0 08             	add    $0x8,%eax
+  801f3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f40:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f42:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f47:	e9 1a ff ff ff       	jmp    801e66 <vprintfmt+0x5dc>
+  801f4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f58:	eb e6                	jmp    801f40 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f66:	eb b7                	jmp    801f1f <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801f68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f74:	e9 54 ff ff ff       	jmp    801ecd <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f79:	4c 89 ee             	mov    %r13,%rsi
+  801f7c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f81:	41 ff d6             	call   *%r14
+            break;
+  801f84:	e9 41 f9 ff ff       	jmp    8018ca <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f89:	4c 89 ee             	mov    %r13,%rsi
+  801f8c:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f91:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f94:	48 83 eb 01          	sub    $0x1,%rbx
+  801f98:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801f9c:	75 f6                	jne    801f94 <vprintfmt+0x70a>
+  801f9e:	e9 27 f9 ff ff       	jmp    8018ca <vprintfmt+0x40>
+
+0000000000801fa3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801fab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801faf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801fb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801fb8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801fbf:	48 85 ff             	test   %rdi,%rdi
+  801fc2:	74 2b                	je     801fef <vsnprintf+0x4c>
+  801fc4:	48 85 f6             	test   %rsi,%rsi
+  801fc7:	74 26                	je     801fef <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801fc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fcd:	48 bf 35 18 80 00 00 	movabs $0x801835,%rdi
+  801fd4:	00 00 00 
+  801fd7:	48 b8 8a 18 80 00 00 	movabs $0x80188a,%rax
+  801fde:	00 00 00 
+  801fe1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801fe3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801fe7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801fea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801fed:	c9                   	leave
+  801fee:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801fef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff4:	eb f7                	jmp    801fed <vsnprintf+0x4a>
+
+0000000000801ff6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801ff6:	55                   	push   %rbp
+  801ff7:	48 89 e5             	mov    %rsp,%rbp
+  801ffa:	48 83 ec 50          	sub    $0x50,%rsp
+  801ffe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802002:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802006:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80200a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802011:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802015:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802019:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80201d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802021:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802025:	48 b8 a3 1f 80 00 00 	movabs $0x801fa3,%rax
+  80202c:	00 00 00 
+  80202f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802031:	c9                   	leave
+  802032:	c3                   	ret
+
+0000000000802033 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802033:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802036:	74 10                	je     802048 <strlen+0x15>
+    size_t n = 0;
+  802038:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80203d:	48 83 c0 01          	add    $0x1,%rax
+  802041:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802045:	75 f6                	jne    80203d <strlen+0xa>
+  802047:	c3                   	ret
+    size_t n = 0;
+  802048:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80204d:	c3                   	ret
+
+000000000080204e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80204e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802051:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802056:	48 85 f6             	test   %rsi,%rsi
+  802059:	74 11                	je     80206c <strnlen+0x1e>
+  80205b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80205f:	74 0c                	je     80206d <strnlen+0x1f>
+  802061:	48 83 c2 01          	add    $0x1,%rdx
+  802065:	48 39 d0             	cmp    %rdx,%rax
+  802068:	75 f1                	jne    80205b <strnlen+0xd>
+  80206a:	eb 04                	jmp    802070 <strnlen+0x22>
+  80206c:	c3                   	ret
+  80206d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802070:	c3                   	ret
+
+0000000000802071 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802071:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802074:	ba 00 00 00 00       	mov    $0x0,%edx
+  802079:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80207d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802080:	48 83 c2 01          	add    $0x1,%rdx
+  802084:	84 c9                	test   %cl,%cl
+  802086:	75 f1                	jne    802079 <strcpy+0x8>
+        ;
+    return res;
+}
+  802088:	c3                   	ret
+
+0000000000802089 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802089:	55                   	push   %rbp
+  80208a:	48 89 e5             	mov    %rsp,%rbp
+  80208d:	41 54                	push   %r12
+  80208f:	53                   	push   %rbx
+  802090:	48 89 fb             	mov    %rdi,%rbx
+  802093:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802096:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020a2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020a6:	4c 89 e6             	mov    %r12,%rsi
+  8020a9:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  8020b0:	00 00 00 
+  8020b3:	ff d0                	call   *%rax
+    return dst;
+}
+  8020b5:	48 89 d8             	mov    %rbx,%rax
+  8020b8:	5b                   	pop    %rbx
+  8020b9:	41 5c                	pop    %r12
+  8020bb:	5d                   	pop    %rbp
+  8020bc:	c3                   	ret
+
+00000000008020bd <toupper>:
+
+int
+toupper(int ch) {
+  8020bd:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8020bf:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8020c2:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8020c5:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020c8:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020cb:	c3                   	ret
+
+00000000008020cc <tolower>:
+
+int
+tolower(int ch) {
+  8020cc:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8020ce:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8020d1:	8d 57 20             	lea    0x20(%rdi),%edx
+  8020d4:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020d7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020da:	c3                   	ret
+
+00000000008020db <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8020db:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8020de:	48 85 d2             	test   %rdx,%rdx
+  8020e1:	74 1f                	je     802102 <strncpy+0x27>
+  8020e3:	48 01 fa             	add    %rdi,%rdx
+  8020e6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8020e9:	48 83 c1 01          	add    $0x1,%rcx
+  8020ed:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8020f1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8020f5:	41 80 f8 01          	cmp    $0x1,%r8b
+  8020f9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8020fd:	48 39 ca             	cmp    %rcx,%rdx
+  802100:	75 e7                	jne    8020e9 <strncpy+0xe>
+    }
+    return ret;
+}
+  802102:	c3                   	ret
+
+0000000000802103 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802103:	48 89 f8             	mov    %rdi,%rax
+  802106:	48 85 d2             	test   %rdx,%rdx
+  802109:	74 24                	je     80212f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80210b:	48 83 ea 01          	sub    $0x1,%rdx
+  80210f:	74 1b                	je     80212c <strlcpy+0x29>
+  802111:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802115:	0f b6 16             	movzbl (%rsi),%edx
+  802118:	84 d2                	test   %dl,%dl
+  80211a:	74 10                	je     80212c <strlcpy+0x29>
+            *dst++ = *src++;
+  80211c:	48 83 c6 01          	add    $0x1,%rsi
+  802120:	48 83 c0 01          	add    $0x1,%rax
+  802124:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802127:	48 39 c8             	cmp    %rcx,%rax
+  80212a:	75 e9                	jne    802115 <strlcpy+0x12>
+        *dst = '\0';
+  80212c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80212f:	48 29 f8             	sub    %rdi,%rax
+}
+  802132:	c3                   	ret
+
+0000000000802133 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802133:	0f b6 07             	movzbl (%rdi),%eax
+  802136:	84 c0                	test   %al,%al
+  802138:	74 13                	je     80214d <strcmp+0x1a>
+  80213a:	38 06                	cmp    %al,(%rsi)
+  80213c:	75 0f                	jne    80214d <strcmp+0x1a>
+  80213e:	48 83 c7 01          	add    $0x1,%rdi
+  802142:	48 83 c6 01          	add    $0x1,%rsi
+  802146:	0f b6 07             	movzbl (%rdi),%eax
+  802149:	84 c0                	test   %al,%al
+  80214b:	75 ed                	jne    80213a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80214d:	0f b6 c0             	movzbl %al,%eax
+  802150:	0f b6 16             	movzbl (%rsi),%edx
+  802153:	29 d0                	sub    %edx,%eax
+}
+  802155:	c3                   	ret
+
+0000000000802156 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802156:	48 85 d2             	test   %rdx,%rdx
+  802159:	74 1f                	je     80217a <strncmp+0x24>
+  80215b:	0f b6 07             	movzbl (%rdi),%eax
+  80215e:	84 c0                	test   %al,%al
+  802160:	74 1e                	je     802180 <strncmp+0x2a>
+  802162:	3a 06                	cmp    (%rsi),%al
+  802164:	75 1a                	jne    802180 <strncmp+0x2a>
+  802166:	48 83 c7 01          	add    $0x1,%rdi
+  80216a:	48 83 c6 01          	add    $0x1,%rsi
+  80216e:	48 83 ea 01          	sub    $0x1,%rdx
+  802172:	75 e7                	jne    80215b <strncmp+0x5>
+
+    if (!n) return 0;
+  802174:	b8 00 00 00 00       	mov    $0x0,%eax
+  802179:	c3                   	ret
+  80217a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217f:	c3                   	ret
+  802180:	48 85 d2             	test   %rdx,%rdx
+  802183:	74 09                	je     80218e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802185:	0f b6 07             	movzbl (%rdi),%eax
+  802188:	0f b6 16             	movzbl (%rsi),%edx
+  80218b:	29 d0                	sub    %edx,%eax
+  80218d:	c3                   	ret
+    if (!n) return 0;
+  80218e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802193:	c3                   	ret
+
+0000000000802194 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802194:	0f b6 17             	movzbl (%rdi),%edx
+  802197:	84 d2                	test   %dl,%dl
+  802199:	74 18                	je     8021b3 <strchr+0x1f>
+        if (*str == c) {
+  80219b:	0f be d2             	movsbl %dl,%edx
+  80219e:	39 f2                	cmp    %esi,%edx
+  8021a0:	74 17                	je     8021b9 <strchr+0x25>
+    for (; *str; str++) {
+  8021a2:	48 83 c7 01          	add    $0x1,%rdi
+  8021a6:	0f b6 17             	movzbl (%rdi),%edx
+  8021a9:	84 d2                	test   %dl,%dl
+  8021ab:	75 ee                	jne    80219b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b2:	c3                   	ret
+  8021b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b8:	c3                   	ret
+  8021b9:	48 89 f8             	mov    %rdi,%rax
+}
+  8021bc:	c3                   	ret
+
+00000000008021bd <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8021bd:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8021c0:	0f b6 17             	movzbl (%rdi),%edx
+  8021c3:	84 d2                	test   %dl,%dl
+  8021c5:	74 13                	je     8021da <strfind+0x1d>
+  8021c7:	0f be d2             	movsbl %dl,%edx
+  8021ca:	39 f2                	cmp    %esi,%edx
+  8021cc:	74 0b                	je     8021d9 <strfind+0x1c>
+  8021ce:	48 83 c0 01          	add    $0x1,%rax
+  8021d2:	0f b6 10             	movzbl (%rax),%edx
+  8021d5:	84 d2                	test   %dl,%dl
+  8021d7:	75 ee                	jne    8021c7 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8021d9:	c3                   	ret
+  8021da:	c3                   	ret
+
+00000000008021db <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021db:	48 39 f7             	cmp    %rsi,%rdi
+  8021de:	74 65                	je     802245 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8021e0:	55                   	push   %rbp
+  8021e1:	48 89 e5             	mov    %rsp,%rbp
+  8021e4:	41 57                	push   %r15
+  8021e6:	41 56                	push   %r14
+  8021e8:	41 55                	push   %r13
+  8021ea:	41 54                	push   %r12
+  8021ec:	53                   	push   %rbx
+  8021ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8021f1:	48 89 fb             	mov    %rdi,%rbx
+  8021f4:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8021f7:	49 bf cc 20 80 00 00 	movabs $0x8020cc,%r15
+  8021fe:	00 00 00 
+  802201:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802205:	41 0f b6 fd          	movzbl %r13b,%edi
+  802209:	41 ff d7             	call   *%r15
+  80220c:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80220f:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802214:	41 0f b6 fe          	movzbl %r14b,%edi
+  802218:	41 ff d7             	call   *%r15
+  80221b:	89 c2                	mov    %eax,%edx
+  80221d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802220:	29 d0                	sub    %edx,%eax
+  802222:	75 12                	jne    802236 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802224:	48 83 c3 01          	add    $0x1,%rbx
+  802228:	45 84 ed             	test   %r13b,%r13b
+  80222b:	74 09                	je     802236 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80222d:	49 83 c4 01          	add    $0x1,%r12
+  802231:	45 84 f6             	test   %r14b,%r14b
+  802234:	75 cb                	jne    802201 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802236:	48 83 c4 18          	add    $0x18,%rsp
+  80223a:	5b                   	pop    %rbx
+  80223b:	41 5c                	pop    %r12
+  80223d:	41 5d                	pop    %r13
+  80223f:	41 5e                	pop    %r14
+  802241:	41 5f                	pop    %r15
+  802243:	5d                   	pop    %rbp
+  802244:	c3                   	ret
+    if (p1 == p2) return 0;
+  802245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224a:	c3                   	ret
+
+000000000080224b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80224b:	48 39 f7             	cmp    %rsi,%rdi
+  80224e:	74 7d                	je     8022cd <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+  802254:	41 57                	push   %r15
+  802256:	41 56                	push   %r14
+  802258:	41 55                	push   %r13
+  80225a:	41 54                	push   %r12
+  80225c:	53                   	push   %rbx
+  80225d:	48 83 ec 18          	sub    $0x18,%rsp
+  802261:	48 89 fb             	mov    %rdi,%rbx
+  802264:	49 89 f4             	mov    %rsi,%r12
+  802267:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80226b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80226f:	49 bf cc 20 80 00 00 	movabs $0x8020cc,%r15
+  802276:	00 00 00 
+    while (n--) {
+  802279:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80227d:	48 39 c3             	cmp    %rax,%rbx
+  802280:	74 37                	je     8022b9 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802282:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802286:	41 0f b6 fd          	movzbl %r13b,%edi
+  80228a:	41 ff d7             	call   *%r15
+  80228d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802290:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802295:	41 0f b6 fe          	movzbl %r14b,%edi
+  802299:	41 ff d7             	call   *%r15
+  80229c:	89 c2                	mov    %eax,%edx
+  80229e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022a1:	29 d0                	sub    %edx,%eax
+  8022a3:	75 19                	jne    8022be <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022a5:	48 83 c3 01          	add    $0x1,%rbx
+  8022a9:	45 84 ed             	test   %r13b,%r13b
+  8022ac:	74 10                	je     8022be <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022ae:	49 83 c4 01          	add    $0x1,%r12
+  8022b2:	45 84 f6             	test   %r14b,%r14b
+  8022b5:	75 c2                	jne    802279 <strncasecmp+0x2e>
+  8022b7:	eb 05                	jmp    8022be <strncasecmp+0x73>
+  8022b9:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8022be:	48 83 c4 18          	add    $0x18,%rsp
+  8022c2:	5b                   	pop    %rbx
+  8022c3:	41 5c                	pop    %r12
+  8022c5:	41 5d                	pop    %r13
+  8022c7:	41 5e                	pop    %r14
+  8022c9:	41 5f                	pop    %r15
+  8022cb:	5d                   	pop    %rbp
+  8022cc:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d2:	c3                   	ret
+
+00000000008022d3 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8022d3:	83 e7 df             	and    $0xffffffdf,%edi
+  8022d6:	83 ef 41             	sub    $0x41,%edi
+  8022d9:	83 ff 19             	cmp    $0x19,%edi
+  8022dc:	0f 96 c0             	setbe  %al
+}
+  8022df:	c3                   	ret
+
+00000000008022e0 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8022e0:	83 ff 20             	cmp    $0x20,%edi
+  8022e3:	0f 94 c0             	sete   %al
+  8022e6:	83 ff 09             	cmp    $0x9,%edi
+  8022e9:	0f 94 c2             	sete   %dl
+  8022ec:	09 d0                	or     %edx,%eax
+}
+  8022ee:	c3                   	ret
+
+00000000008022ef <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8022ef:	55                   	push   %rbp
+  8022f0:	48 89 e5             	mov    %rsp,%rbp
+  8022f3:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8022f5:	48 bf 1f 64 80 00 00 	movabs $0x80641f,%rdi
+  8022fc:	00 00 00 
+  8022ff:	48 b8 94 21 80 00 00 	movabs $0x802194,%rax
+  802306:	00 00 00 
+  802309:	ff d0                	call   *%rax
+  80230b:	48 85 c0             	test   %rax,%rax
+  80230e:	0f 95 c0             	setne  %al
+}
+  802311:	5d                   	pop    %rbp
+  802312:	c3                   	ret
+
+0000000000802313 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802313:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802316:	48 89 f8             	mov    %rdi,%rax
+  802319:	48 f7 d8             	neg    %rax
+  80231c:	83 e0 07             	and    $0x7,%eax
+  80231f:	49 89 d1             	mov    %rdx,%r9
+  802322:	49 29 c1             	sub    %rax,%r9
+  802325:	78 36                	js     80235d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802327:	40 0f b6 c6          	movzbl %sil,%eax
+  80232b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802332:	01 01 01 
+  802335:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802339:	40 f6 c7 07          	test   $0x7,%dil
+  80233d:	75 38                	jne    802377 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80233f:	4c 89 c9             	mov    %r9,%rcx
+  802342:	48 c1 f9 03          	sar    $0x3,%rcx
+  802346:	74 0c                	je     802354 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802348:	fc                   	cld
+  802349:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80234c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802350:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802354:	4d 85 c9             	test   %r9,%r9
+  802357:	75 45                	jne    80239e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802359:	4c 89 c0             	mov    %r8,%rax
+  80235c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80235d:	48 85 d2             	test   %rdx,%rdx
+  802360:	74 f7                	je     802359 <memset+0x46>
+  802362:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802365:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802368:	48 83 c0 01          	add    $0x1,%rax
+  80236c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802370:	48 39 c2             	cmp    %rax,%rdx
+  802373:	75 f3                	jne    802368 <memset+0x55>
+  802375:	eb e2                	jmp    802359 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802377:	40 f6 c7 01          	test   $0x1,%dil
+  80237b:	74 06                	je     802383 <memset+0x70>
+  80237d:	88 07                	mov    %al,(%rdi)
+  80237f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802383:	40 f6 c7 02          	test   $0x2,%dil
+  802387:	74 07                	je     802390 <memset+0x7d>
+  802389:	66 89 07             	mov    %ax,(%rdi)
+  80238c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802390:	40 f6 c7 04          	test   $0x4,%dil
+  802394:	74 a9                	je     80233f <memset+0x2c>
+  802396:	89 07                	mov    %eax,(%rdi)
+  802398:	48 83 c7 04          	add    $0x4,%rdi
+  80239c:	eb a1                	jmp    80233f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80239e:	41 f6 c1 04          	test   $0x4,%r9b
+  8023a2:	74 06                	je     8023aa <memset+0x97>
+  8023a4:	89 07                	mov    %eax,(%rdi)
+  8023a6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023aa:	41 f6 c1 02          	test   $0x2,%r9b
+  8023ae:	74 07                	je     8023b7 <memset+0xa4>
+  8023b0:	66 89 07             	mov    %ax,(%rdi)
+  8023b3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8023b7:	41 f6 c1 01          	test   $0x1,%r9b
+  8023bb:	74 9c                	je     802359 <memset+0x46>
+  8023bd:	88 07                	mov    %al,(%rdi)
+  8023bf:	eb 98                	jmp    802359 <memset+0x46>
+
+00000000008023c1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8023c1:	48 89 f8             	mov    %rdi,%rax
+  8023c4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8023c7:	48 39 fe             	cmp    %rdi,%rsi
+  8023ca:	73 3b                	jae    802407 <memmove+0x46>
+  8023cc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8023d0:	48 39 d7             	cmp    %rdx,%rdi
+  8023d3:	73 32                	jae    802407 <memmove+0x46>
+        s += n;
+        d += n;
+  8023d5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8023d9:	48 89 d6             	mov    %rdx,%rsi
+  8023dc:	48 09 fe             	or     %rdi,%rsi
+  8023df:	48 09 ce             	or     %rcx,%rsi
+  8023e2:	40 f6 c6 07          	test   $0x7,%sil
+  8023e6:	75 12                	jne    8023fa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8023e8:	48 83 ef 08          	sub    $0x8,%rdi
+  8023ec:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8023f0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023f4:	fd                   	std
+  8023f5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8023f8:	fc                   	cld
+  8023f9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8023fa:	48 83 ef 01          	sub    $0x1,%rdi
+  8023fe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802402:	fd                   	std
+  802403:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802405:	eb f1                	jmp    8023f8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802407:	48 89 f2             	mov    %rsi,%rdx
+  80240a:	48 09 c2             	or     %rax,%rdx
+  80240d:	48 09 ca             	or     %rcx,%rdx
+  802410:	f6 c2 07             	test   $0x7,%dl
+  802413:	75 0c                	jne    802421 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802415:	48 c1 e9 03          	shr    $0x3,%rcx
+  802419:	48 89 c7             	mov    %rax,%rdi
+  80241c:	fc                   	cld
+  80241d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802420:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802421:	48 89 c7             	mov    %rax,%rdi
+  802424:	fc                   	cld
+  802425:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802427:	c3                   	ret
+
+0000000000802428 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80242c:	48 b8 c1 23 80 00 00 	movabs $0x8023c1,%rax
+  802433:	00 00 00 
+  802436:	ff d0                	call   *%rax
+}
+  802438:	5d                   	pop    %rbp
+  802439:	c3                   	ret
+
+000000000080243a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80243a:	55                   	push   %rbp
+  80243b:	48 89 e5             	mov    %rsp,%rbp
+  80243e:	41 57                	push   %r15
+  802440:	41 56                	push   %r14
+  802442:	41 55                	push   %r13
+  802444:	41 54                	push   %r12
+  802446:	53                   	push   %rbx
+  802447:	48 83 ec 08          	sub    $0x8,%rsp
+  80244b:	49 89 fe             	mov    %rdi,%r14
+  80244e:	49 89 f7             	mov    %rsi,%r15
+  802451:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802454:	48 89 f7             	mov    %rsi,%rdi
+  802457:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80245e:	00 00 00 
+  802461:	ff d0                	call   *%rax
+  802463:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802466:	48 89 de             	mov    %rbx,%rsi
+  802469:	4c 89 f7             	mov    %r14,%rdi
+  80246c:	48 b8 4e 20 80 00 00 	movabs $0x80204e,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+  802478:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80247b:	48 39 c3             	cmp    %rax,%rbx
+  80247e:	74 36                	je     8024b6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802480:	48 89 d8             	mov    %rbx,%rax
+  802483:	4c 29 e8             	sub    %r13,%rax
+  802486:	49 39 c4             	cmp    %rax,%r12
+  802489:	73 31                	jae    8024bc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80248b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802490:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802494:	4c 89 fe             	mov    %r15,%rsi
+  802497:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024a3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024a7:	48 83 c4 08          	add    $0x8,%rsp
+  8024ab:	5b                   	pop    %rbx
+  8024ac:	41 5c                	pop    %r12
+  8024ae:	41 5d                	pop    %r13
+  8024b0:	41 5e                	pop    %r14
+  8024b2:	41 5f                	pop    %r15
+  8024b4:	5d                   	pop    %rbp
+  8024b5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024b6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8024ba:	eb eb                	jmp    8024a7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8024bc:	48 83 eb 01          	sub    $0x1,%rbx
+  8024c0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024c4:	48 89 da             	mov    %rbx,%rdx
+  8024c7:	4c 89 fe             	mov    %r15,%rsi
+  8024ca:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8024d6:	49 01 de             	add    %rbx,%r14
+  8024d9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8024de:	eb c3                	jmp    8024a3 <strlcat+0x69>
+
+00000000008024e0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8024e0:	48 85 d2             	test   %rdx,%rdx
+  8024e3:	74 2d                	je     802512 <memcmp+0x32>
+  8024e5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8024ea:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8024ee:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8024f3:	44 38 c1             	cmp    %r8b,%cl
+  8024f6:	75 0f                	jne    802507 <memcmp+0x27>
+    while (n-- > 0) {
+  8024f8:	48 83 c0 01          	add    $0x1,%rax
+  8024fc:	48 39 c2             	cmp    %rax,%rdx
+  8024ff:	75 e9                	jne    8024ea <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802501:	b8 00 00 00 00       	mov    $0x0,%eax
+  802506:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802507:	0f b6 c1             	movzbl %cl,%eax
+  80250a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80250e:	44 29 c0             	sub    %r8d,%eax
+  802511:	c3                   	ret
+    return 0;
+  802512:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802517:	c3                   	ret
+
+0000000000802518 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802518:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80251c:	48 39 c7             	cmp    %rax,%rdi
+  80251f:	73 0f                	jae    802530 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802521:	40 38 37             	cmp    %sil,(%rdi)
+  802524:	74 0e                	je     802534 <memfind+0x1c>
+    for (; src < end; src++) {
+  802526:	48 83 c7 01          	add    $0x1,%rdi
+  80252a:	48 39 f8             	cmp    %rdi,%rax
+  80252d:	75 f2                	jne    802521 <memfind+0x9>
+  80252f:	c3                   	ret
+  802530:	48 89 f8             	mov    %rdi,%rax
+  802533:	c3                   	ret
+  802534:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802537:	c3                   	ret
+
+0000000000802538 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802538:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80253b:	0f b6 37             	movzbl (%rdi),%esi
+  80253e:	40 80 fe 20          	cmp    $0x20,%sil
+  802542:	74 06                	je     80254a <strtol+0x12>
+  802544:	40 80 fe 09          	cmp    $0x9,%sil
+  802548:	75 13                	jne    80255d <strtol+0x25>
+  80254a:	48 83 c7 01          	add    $0x1,%rdi
+  80254e:	0f b6 37             	movzbl (%rdi),%esi
+  802551:	40 80 fe 20          	cmp    $0x20,%sil
+  802555:	74 f3                	je     80254a <strtol+0x12>
+  802557:	40 80 fe 09          	cmp    $0x9,%sil
+  80255b:	74 ed                	je     80254a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80255d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802560:	83 e0 fd             	and    $0xfffffffd,%eax
+  802563:	3c 01                	cmp    $0x1,%al
+  802565:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802569:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80256f:	75 0f                	jne    802580 <strtol+0x48>
+  802571:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802574:	74 14                	je     80258a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802576:	85 d2                	test   %edx,%edx
+  802578:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80257d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802580:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802585:	4c 63 ca             	movslq %edx,%r9
+  802588:	eb 36                	jmp    8025c0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80258a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80258e:	74 0f                	je     80259f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802590:	85 d2                	test   %edx,%edx
+  802592:	75 ec                	jne    802580 <strtol+0x48>
+        s++;
+  802594:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802598:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80259d:	eb e1                	jmp    802580 <strtol+0x48>
+        s += 2;
+  80259f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025a3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025a8:	eb d6                	jmp    802580 <strtol+0x48>
+            dig -= '0';
+  8025aa:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025ad:	44 0f b6 c1          	movzbl %cl,%r8d
+  8025b1:	41 39 d0             	cmp    %edx,%r8d
+  8025b4:	7d 21                	jge    8025d7 <strtol+0x9f>
+        val = val * base + dig;
+  8025b6:	49 0f af c1          	imul   %r9,%rax
+  8025ba:	0f b6 c9             	movzbl %cl,%ecx
+  8025bd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8025c0:	48 83 c7 01          	add    $0x1,%rdi
+  8025c4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8025c8:	80 f9 39             	cmp    $0x39,%cl
+  8025cb:	76 dd                	jbe    8025aa <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8025cd:	80 f9 7b             	cmp    $0x7b,%cl
+  8025d0:	77 05                	ja     8025d7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8025d2:	83 e9 57             	sub    $0x57,%ecx
+  8025d5:	eb d6                	jmp    8025ad <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8025d7:	4d 85 d2             	test   %r10,%r10
+  8025da:	74 03                	je     8025df <strtol+0xa7>
+  8025dc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8025df:	48 89 c2             	mov    %rax,%rdx
+  8025e2:	48 f7 da             	neg    %rdx
+  8025e5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8025e9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8025ed:	c3                   	ret
+
+00000000008025ee <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8025ee:	55                   	push   %rbp
+  8025ef:	48 89 e5             	mov    %rsp,%rbp
+  8025f2:	53                   	push   %rbx
+  8025f3:	48 89 fa             	mov    %rdi,%rdx
+  8025f6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8025f9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8025fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802603:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802608:	be 00 00 00 00       	mov    $0x0,%esi
+  80260d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802613:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802619:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80261b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80261f:	c9                   	leave
+  802620:	c3                   	ret
+
+0000000000802621 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802621:	55                   	push   %rbp
+  802622:	48 89 e5             	mov    %rsp,%rbp
+  802625:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802626:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80262b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802630:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802635:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80263a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80263f:	be 00 00 00 00       	mov    $0x0,%esi
+  802644:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80264a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802650:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802652:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802656:	c9                   	leave
+  802657:	c3                   	ret
+
+0000000000802658 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802658:	55                   	push   %rbp
+  802659:	48 89 e5             	mov    %rsp,%rbp
+  80265c:	53                   	push   %rbx
+  80265d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802660:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802665:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80266a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80266f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802674:	be 00 00 00 00       	mov    $0x0,%esi
+  802679:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80267f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802685:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802687:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+000000000080268d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	53                   	push   %rbx
+  802692:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802696:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802699:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80269e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026a8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026be:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8026c0:	48 85 c0             	test   %rax,%rax
+  8026c3:	7f 06                	jg     8026cb <sys_env_destroy+0x3e>
+}
+  8026c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026c9:	c9                   	leave
+  8026ca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8026cb:	49 89 c0             	mov    %rax,%r8
+  8026ce:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8026d3:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8026da:	00 00 00 
+  8026dd:	be 27 00 00 00       	mov    $0x27,%esi
+  8026e2:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8026e9:	00 00 00 
+  8026ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f1:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  8026f8:	00 00 00 
+  8026fb:	41 ff d1             	call   *%r9
+
+00000000008026fe <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8026fe:	55                   	push   %rbp
+  8026ff:	48 89 e5             	mov    %rsp,%rbp
+  802702:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802703:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802712:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802717:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80271c:	be 00 00 00 00       	mov    $0x0,%esi
+  802721:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802727:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80272d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80272f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802733:	c9                   	leave
+  802734:	c3                   	ret
+
+0000000000802735 <sys_yield>:
+
+void
+sys_yield(void) {
+  802735:	55                   	push   %rbp
+  802736:	48 89 e5             	mov    %rsp,%rbp
+  802739:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80273a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80273f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802744:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802749:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80274e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802753:	be 00 00 00 00       	mov    $0x0,%esi
+  802758:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80275e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802764:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802766:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276a:	c9                   	leave
+  80276b:	c3                   	ret
+
+000000000080276c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+  802770:	53                   	push   %rbx
+  802771:	48 89 fa             	mov    %rdi,%rdx
+  802774:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802777:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80277c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802783:	00 00 00 
+  802786:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80278b:	be 00 00 00 00       	mov    $0x0,%esi
+  802790:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802796:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80279c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80279e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a2:	c9                   	leave
+  8027a3:	c3                   	ret
+
+00000000008027a4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027a4:	55                   	push   %rbp
+  8027a5:	48 89 e5             	mov    %rsp,%rbp
+  8027a8:	53                   	push   %rbx
+  8027a9:	49 89 f8             	mov    %rdi,%r8
+  8027ac:	48 89 d3             	mov    %rdx,%rbx
+  8027af:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8027b2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b7:	4c 89 c2             	mov    %r8,%rdx
+  8027ba:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027ce:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8027d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d4:	c9                   	leave
+  8027d5:	c3                   	ret
+
+00000000008027d6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8027d6:	55                   	push   %rbp
+  8027d7:	48 89 e5             	mov    %rsp,%rbp
+  8027da:	53                   	push   %rbx
+  8027db:	48 83 ec 08          	sub    $0x8,%rsp
+  8027df:	89 f8                	mov    %edi,%eax
+  8027e1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8027e4:	48 63 f9             	movslq %ecx,%rdi
+  8027e7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ea:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027ef:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802803:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802805:	48 85 c0             	test   %rax,%rax
+  802808:	7f 06                	jg     802810 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80280a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80280e:	c9                   	leave
+  80280f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802810:	49 89 c0             	mov    %rax,%r8
+  802813:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802818:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  80281f:	00 00 00 
+  802822:	be 27 00 00 00       	mov    $0x27,%esi
+  802827:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  80282e:	00 00 00 
+  802831:	b8 00 00 00 00       	mov    $0x0,%eax
+  802836:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  80283d:	00 00 00 
+  802840:	41 ff d1             	call   *%r9
+
+0000000000802843 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802843:	55                   	push   %rbp
+  802844:	48 89 e5             	mov    %rsp,%rbp
+  802847:	53                   	push   %rbx
+  802848:	48 83 ec 08          	sub    $0x8,%rsp
+  80284c:	89 f8                	mov    %edi,%eax
+  80284e:	49 89 f2             	mov    %rsi,%r10
+  802851:	48 89 cf             	mov    %rcx,%rdi
+  802854:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802857:	48 63 da             	movslq %edx,%rbx
+  80285a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80285d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802862:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802865:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802868:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80286e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802870:	48 85 c0             	test   %rax,%rax
+  802873:	7f 06                	jg     80287b <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802875:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802879:	c9                   	leave
+  80287a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80287b:	49 89 c0             	mov    %rax,%r8
+  80287e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802883:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  80288a:	00 00 00 
+  80288d:	be 27 00 00 00       	mov    $0x27,%esi
+  802892:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802899:	00 00 00 
+  80289c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a1:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  8028a8:	00 00 00 
+  8028ab:	41 ff d1             	call   *%r9
+
+00000000008028ae <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028ae:	55                   	push   %rbp
+  8028af:	48 89 e5             	mov    %rsp,%rbp
+  8028b2:	53                   	push   %rbx
+  8028b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b7:	48 89 f1             	mov    %rsi,%rcx
+  8028ba:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8028bd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028c5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028db:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028dd:	48 85 c0             	test   %rax,%rax
+  8028e0:	7f 06                	jg     8028e8 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8028e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028e6:	c9                   	leave
+  8028e7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028e8:	49 89 c0             	mov    %rax,%r8
+  8028eb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028f0:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8028f7:	00 00 00 
+  8028fa:	be 27 00 00 00       	mov    $0x27,%esi
+  8028ff:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802906:	00 00 00 
+  802909:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290e:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802915:	00 00 00 
+  802918:	41 ff d1             	call   *%r9
+
+000000000080291b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80291b:	55                   	push   %rbp
+  80291c:	48 89 e5             	mov    %rsp,%rbp
+  80291f:	53                   	push   %rbx
+  802920:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802924:	48 63 ce             	movslq %esi,%rcx
+  802927:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80292a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80292f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802934:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802939:	be 00 00 00 00       	mov    $0x0,%esi
+  80293e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802944:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80294a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80294c:	48 85 c0             	test   %rax,%rax
+  80294f:	7f 06                	jg     802957 <sys_env_set_status+0x3c>
+}
+  802951:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802957:	49 89 c0             	mov    %rax,%r8
+  80295a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80295f:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802966:	00 00 00 
+  802969:	be 27 00 00 00       	mov    $0x27,%esi
+  80296e:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802975:	00 00 00 
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297d:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802984:	00 00 00 
+  802987:	41 ff d1             	call   *%r9
+
+000000000080298a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80298a:	55                   	push   %rbp
+  80298b:	48 89 e5             	mov    %rsp,%rbp
+  80298e:	53                   	push   %rbx
+  80298f:	48 83 ec 08          	sub    $0x8,%rsp
+  802993:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802996:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802999:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80299e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029bb:	48 85 c0             	test   %rax,%rax
+  8029be:	7f 06                	jg     8029c6 <sys_env_set_trapframe+0x3c>
+}
+  8029c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c4:	c9                   	leave
+  8029c5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029c6:	49 89 c0             	mov    %rax,%r8
+  8029c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8029ce:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  8029d5:	00 00 00 
+  8029d8:	be 27 00 00 00       	mov    $0x27,%esi
+  8029dd:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  8029e4:	00 00 00 
+  8029e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ec:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  8029f3:	00 00 00 
+  8029f6:	41 ff d1             	call   *%r9
+
+00000000008029f9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8029f9:	55                   	push   %rbp
+  8029fa:	48 89 e5             	mov    %rsp,%rbp
+  8029fd:	53                   	push   %rbx
+  8029fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802a02:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a05:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a08:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a12:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a17:	be 00 00 00 00       	mov    $0x0,%esi
+  802a1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a28:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a2a:	48 85 c0             	test   %rax,%rax
+  802a2d:	7f 06                	jg     802a35 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a35:	49 89 c0             	mov    %rax,%r8
+  802a38:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a3d:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802a44:	00 00 00 
+  802a47:	be 27 00 00 00       	mov    $0x27,%esi
+  802a4c:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802a53:	00 00 00 
+  802a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5b:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802a62:	00 00 00 
+  802a65:	41 ff d1             	call   *%r9
+
+0000000000802a68 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802a68:	55                   	push   %rbp
+  802a69:	48 89 e5             	mov    %rsp,%rbp
+  802a6c:	53                   	push   %rbx
+  802a6d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802a71:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a75:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a78:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a82:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a87:	be 00 00 00 00       	mov    $0x0,%esi
+  802a8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a98:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a9a:	48 85 c0             	test   %rax,%rax
+  802a9d:	7f 06                	jg     802aa5 <sys_env_set_reclaim+0x3d>
+}
+  802a9f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aa5:	49 89 c0             	mov    %rax,%r8
+  802aa8:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802aad:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802ab4:	00 00 00 
+  802ab7:	be 27 00 00 00       	mov    $0x27,%esi
+  802abc:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802ac3:	00 00 00 
+  802ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acb:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802ad2:	00 00 00 
+  802ad5:	41 ff d1             	call   *%r9
+
+0000000000802ad8 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802ad8:	55                   	push   %rbp
+  802ad9:	48 89 e5             	mov    %rsp,%rbp
+  802adc:	53                   	push   %rbx
+  802add:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802ae1:	48 63 ce             	movslq %esi,%rcx
+  802ae4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ae7:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802af1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802af6:	be 00 00 00 00       	mov    $0x0,%esi
+  802afb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b07:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b09:	48 85 c0             	test   %rax,%rax
+  802b0c:	7f 06                	jg     802b14 <sys_env_set_nice+0x3c>
+}
+  802b0e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b14:	49 89 c0             	mov    %rax,%r8
+  802b17:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b1c:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802b23:	00 00 00 
+  802b26:	be 27 00 00 00       	mov    $0x27,%esi
+  802b2b:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802b32:	00 00 00 
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3a:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802b41:	00 00 00 
+  802b44:	41 ff d1             	call   *%r9
+
+0000000000802b47 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b47:	55                   	push   %rbp
+  802b48:	48 89 e5             	mov    %rsp,%rbp
+  802b4b:	53                   	push   %rbx
+  802b4c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b4f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b5e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b63:	be 00 00 00 00       	mov    $0x0,%esi
+  802b68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b74:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7a:	c9                   	leave
+  802b7b:	c3                   	ret
+
+0000000000802b7c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b7c:	55                   	push   %rbp
+  802b7d:	48 89 e5             	mov    %rsp,%rbp
+  802b80:	53                   	push   %rbx
+  802b81:	89 f8                	mov    %edi,%eax
+  802b83:	49 89 f1             	mov    %rsi,%r9
+  802b86:	48 89 d3             	mov    %rdx,%rbx
+  802b89:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b8c:	49 63 f0             	movslq %r8d,%rsi
+  802b8f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b92:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b97:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ba0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ba6:	cd 30                	int    $0x30
+}
+  802ba8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+
+0000000000802bae <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	53                   	push   %rbx
+  802bb3:	89 f8                	mov    %edi,%eax
+  802bb5:	49 89 f1             	mov    %rsi,%r9
+  802bb8:	48 89 d3             	mov    %rdx,%rbx
+  802bbb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bbe:	49 63 f0             	movslq %r8d,%rsi
+  802bc1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bc9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bcc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bd8:	cd 30                	int    $0x30
+}
+  802bda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bde:	c9                   	leave
+  802bdf:	c3                   	ret
+
+0000000000802be0 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802be0:	55                   	push   %rbp
+  802be1:	48 89 e5             	mov    %rsp,%rbp
+  802be4:	53                   	push   %rbx
+  802be5:	48 83 ec 08          	sub    $0x8,%rsp
+  802be9:	89 f8                	mov    %edi,%eax
+  802beb:	49 89 f2             	mov    %rsi,%r10
+  802bee:	48 89 d3             	mov    %rdx,%rbx
+  802bf1:	48 89 cf             	mov    %rcx,%rdi
+  802bf4:	44 89 c6             	mov    %r8d,%esi
+  802bf7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802bfa:	48 63 f6             	movslq %esi,%rsi
+  802bfd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c00:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c05:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c08:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c0c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c0e:	48 85 c0             	test   %rax,%rax
+  802c11:	7f 06                	jg     802c19 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c17:	c9                   	leave
+  802c18:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c19:	49 89 c0             	mov    %rax,%r8
+  802c1c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c21:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802c28:	00 00 00 
+  802c2b:	be 27 00 00 00       	mov    $0x27,%esi
+  802c30:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802c37:	00 00 00 
+  802c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3f:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802c46:	00 00 00 
+  802c49:	41 ff d1             	call   *%r9
+
+0000000000802c4c <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	53                   	push   %rbx
+  802c51:	48 83 ec 08          	sub    $0x8,%rsp
+  802c55:	48 89 f1             	mov    %rsi,%rcx
+  802c58:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c5b:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c5f:	48 8b 1a             	mov    (%rdx),%rbx
+  802c62:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c65:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c6a:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c6e:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802c72:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c76:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c78:	48 85 c0             	test   %rax,%rax
+  802c7b:	7f 06                	jg     802c83 <sys_ipc_call_short+0x37>
+}
+  802c7d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c81:	c9                   	leave
+  802c82:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c83:	49 89 c0             	mov    %rax,%r8
+  802c86:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c8b:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802c92:	00 00 00 
+  802c95:	be 27 00 00 00       	mov    $0x27,%esi
+  802c9a:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802ca1:	00 00 00 
+  802ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca9:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802cb0:	00 00 00 
+  802cb3:	41 ff d1             	call   *%r9
+
+0000000000802cb6 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cb6:	55                   	push   %rbp
+  802cb7:	48 89 e5             	mov    %rsp,%rbp
+  802cba:	53                   	push   %rbx
+  802cbb:	48 83 ec 08          	sub    $0x8,%rsp
+  802cbf:	89 f8                	mov    %edi,%eax
+  802cc1:	49 89 f2             	mov    %rsi,%r10
+  802cc4:	48 89 d3             	mov    %rdx,%rbx
+  802cc7:	48 89 cf             	mov    %rcx,%rdi
+  802cca:	44 89 c6             	mov    %r8d,%esi
+  802ccd:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cd0:	48 63 f6             	movslq %esi,%rsi
+  802cd3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cd6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cdb:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802cde:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ce2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ce4:	48 85 c0             	test   %rax,%rax
+  802ce7:	7f 06                	jg     802cef <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ce9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ced:	c9                   	leave
+  802cee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cef:	49 89 c0             	mov    %rax,%r8
+  802cf2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802cf7:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802cfe:	00 00 00 
+  802d01:	be 27 00 00 00       	mov    $0x27,%esi
+  802d06:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802d0d:	00 00 00 
+  802d10:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d15:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802d1c:	00 00 00 
+  802d1f:	41 ff d1             	call   *%r9
+
+0000000000802d22 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d22:	55                   	push   %rbp
+  802d23:	48 89 e5             	mov    %rsp,%rbp
+  802d26:	53                   	push   %rbx
+  802d27:	48 83 ec 08          	sub    $0x8,%rsp
+  802d2b:	48 89 fa             	mov    %rdi,%rdx
+  802d2e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d31:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d3b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d40:	be 00 00 00 00       	mov    $0x0,%esi
+  802d45:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d4b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d51:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d53:	48 85 c0             	test   %rax,%rax
+  802d56:	7f 06                	jg     802d5e <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d5c:	c9                   	leave
+  802d5d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d5e:	49 89 c0             	mov    %rax,%r8
+  802d61:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802d66:	48 ba 28 64 80 00 00 	movabs $0x806428,%rdx
+  802d6d:	00 00 00 
+  802d70:	be 27 00 00 00       	mov    $0x27,%esi
+  802d75:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802d7c:	00 00 00 
+  802d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d84:	49 b9 da 52 80 00 00 	movabs $0x8052da,%r9
+  802d8b:	00 00 00 
+  802d8e:	41 ff d1             	call   *%r9
+
+0000000000802d91 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d91:	55                   	push   %rbp
+  802d92:	48 89 e5             	mov    %rsp,%rbp
+  802d95:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d96:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802da5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802daa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802daf:	be 00 00 00 00       	mov    $0x0,%esi
+  802db4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dc0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802dc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc6:	c9                   	leave
+  802dc7:	c3                   	ret
+
+0000000000802dc8 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802dc8:	55                   	push   %rbp
+  802dc9:	48 89 e5             	mov    %rsp,%rbp
+  802dcc:	53                   	push   %rbx
+  802dcd:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dd0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ddf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802de4:	be 00 00 00 00       	mov    $0x0,%esi
+  802de9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802def:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802df5:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802df7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dfb:	c9                   	leave
+  802dfc:	c3                   	ret
+
+0000000000802dfd <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802dfd:	55                   	push   %rbp
+  802dfe:	48 89 e5             	mov    %rsp,%rbp
+  802e01:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e02:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e2c:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e2e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+0000000000802e34 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+  802e38:	53                   	push   %rbx
+  802e39:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802e3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802e42:	cd 30                	int    $0x30
+  802e44:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802e46:	85 c0                	test   %eax,%eax
+  802e48:	0f 88 85 00 00 00    	js     802ed3 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802e4e:	0f 84 ac 00 00 00    	je     802f00 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802e54:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802e5a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802e61:	00 00 00 
+  802e64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e69:	89 c2                	mov    %eax,%edx
+  802e6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e75:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  802e7c:	00 00 00 
+  802e7f:	ff d0                	call   *%rax
+  802e81:	85 c0                	test   %eax,%eax
+  802e83:	0f 88 a8 00 00 00    	js     802f31 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802e89:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802e90:	00 00 00 
+  802e93:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802e9a:	89 df                	mov    %ebx,%edi
+  802e9c:	48 b8 f9 29 80 00 00 	movabs $0x8029f9,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	0f 88 ae 00 00 00    	js     802f5e <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802eb0:	be 02 00 00 00       	mov    $0x2,%esi
+  802eb5:	89 df                	mov    %ebx,%edi
+  802eb7:	48 b8 1b 29 80 00 00 	movabs $0x80291b,%rax
+  802ebe:	00 00 00 
+  802ec1:	ff d0                	call   *%rax
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	0f 88 c0 00 00 00    	js     802f8b <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  802ecb:	89 d8                	mov    %ebx,%eax
+  802ecd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ed1:	c9                   	leave
+  802ed2:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  802ed3:	89 c1                	mov    %eax,%ecx
+  802ed5:	48 ba 55 64 80 00 00 	movabs $0x806455,%rdx
+  802edc:	00 00 00 
+  802edf:	be 20 00 00 00       	mov    $0x20,%esi
+  802ee4:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802eeb:	00 00 00 
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef3:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  802efa:	00 00 00 
+  802efd:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  802f00:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  802f07:	00 00 00 
+  802f0a:	ff d0                	call   *%rax
+  802f0c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802f11:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  802f18:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  802f1f:	00 00 00 
+  802f22:	48 01 d0             	add    %rdx,%rax
+  802f25:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  802f2c:	00 00 00 
+        return 0;
+  802f2f:	eb 9a                	jmp    802ecb <fork+0x97>
+        panic("sys_map_region: %i", res);
+  802f31:	89 c1                	mov    %eax,%ecx
+  802f33:	48 ba 70 64 80 00 00 	movabs $0x806470,%rdx
+  802f3a:	00 00 00 
+  802f3d:	be 2e 00 00 00       	mov    $0x2e,%esi
+  802f42:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802f49:	00 00 00 
+  802f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f51:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  802f58:	00 00 00 
+  802f5b:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  802f5e:	89 c1                	mov    %eax,%ecx
+  802f60:	48 ba b8 64 80 00 00 	movabs $0x8064b8,%rdx
+  802f67:	00 00 00 
+  802f6a:	be 32 00 00 00       	mov    $0x32,%esi
+  802f6f:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802f76:	00 00 00 
+  802f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7e:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  802f85:	00 00 00 
+  802f88:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  802f8b:	89 c1                	mov    %eax,%ecx
+  802f8d:	48 ba 83 64 80 00 00 	movabs $0x806483,%rdx
+  802f94:	00 00 00 
+  802f97:	be 37 00 00 00       	mov    $0x37,%esi
+  802f9c:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802fa3:	00 00 00 
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  802fb2:	00 00 00 
+  802fb5:	41 ff d0             	call   *%r8
+
+0000000000802fb8 <sfork>:
+
+envid_t
+sfork() {
+  802fb8:	55                   	push   %rbp
+  802fb9:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  802fbc:	48 ba 9a 64 80 00 00 	movabs $0x80649a,%rdx
+  802fc3:	00 00 00 
+  802fc6:	be 3e 00 00 00       	mov    $0x3e,%esi
+  802fcb:	48 bf 65 64 80 00 00 	movabs $0x806465,%rdi
+  802fd2:	00 00 00 
+  802fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fda:	48 b9 da 52 80 00 00 	movabs $0x8052da,%rcx
+  802fe1:	00 00 00 
+  802fe4:	ff d1                	call   *%rcx
+
+0000000000802fe6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802fe6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fed:	ff ff ff 
+  802ff0:	48 01 f8             	add    %rdi,%rax
+  802ff3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802ff7:	c3                   	ret
+
+0000000000802ff8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802ff8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802fff:	ff ff ff 
+  803002:	48 01 f8             	add    %rdi,%rax
+  803005:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803009:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80300f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803013:	c3                   	ret
+
+0000000000803014 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	41 57                	push   %r15
+  80301a:	41 56                	push   %r14
+  80301c:	41 55                	push   %r13
+  80301e:	41 54                	push   %r12
+  803020:	53                   	push   %rbx
+  803021:	48 83 ec 08          	sub    $0x8,%rsp
+  803025:	49 89 ff             	mov    %rdi,%r15
+  803028:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80302d:	49 bd 14 45 80 00 00 	movabs $0x804514,%r13
+  803034:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803037:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80303d:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803040:	48 89 df             	mov    %rbx,%rdi
+  803043:	41 ff d5             	call   *%r13
+  803046:	83 e0 04             	and    $0x4,%eax
+  803049:	74 17                	je     803062 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80304b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803052:	4c 39 f3             	cmp    %r14,%rbx
+  803055:	75 e6                	jne    80303d <fd_alloc+0x29>
+  803057:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80305d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803062:	4d 89 27             	mov    %r12,(%r15)
+}
+  803065:	48 83 c4 08          	add    $0x8,%rsp
+  803069:	5b                   	pop    %rbx
+  80306a:	41 5c                	pop    %r12
+  80306c:	41 5d                	pop    %r13
+  80306e:	41 5e                	pop    %r14
+  803070:	41 5f                	pop    %r15
+  803072:	5d                   	pop    %rbp
+  803073:	c3                   	ret
+
+0000000000803074 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803074:	83 ff 1f             	cmp    $0x1f,%edi
+  803077:	77 39                	ja     8030b2 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803079:	55                   	push   %rbp
+  80307a:	48 89 e5             	mov    %rsp,%rbp
+  80307d:	41 54                	push   %r12
+  80307f:	53                   	push   %rbx
+  803080:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803083:	48 63 df             	movslq %edi,%rbx
+  803086:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80308d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803091:	48 89 df             	mov    %rbx,%rdi
+  803094:	48 b8 14 45 80 00 00 	movabs $0x804514,%rax
+  80309b:	00 00 00 
+  80309e:	ff d0                	call   *%rax
+  8030a0:	a8 04                	test   $0x4,%al
+  8030a2:	74 14                	je     8030b8 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8030a4:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8030a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ad:	5b                   	pop    %rbx
+  8030ae:	41 5c                	pop    %r12
+  8030b0:	5d                   	pop    %rbp
+  8030b1:	c3                   	ret
+        return -E_INVAL;
+  8030b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8030b7:	c3                   	ret
+        return -E_INVAL;
+  8030b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030bd:	eb ee                	jmp    8030ad <fd_lookup+0x39>
+
+00000000008030bf <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8030bf:	55                   	push   %rbp
+  8030c0:	48 89 e5             	mov    %rsp,%rbp
+  8030c3:	41 54                	push   %r12
+  8030c5:	53                   	push   %rbx
+  8030c6:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8030c9:	48 b8 60 65 80 00 00 	movabs $0x806560,%rax
+  8030d0:	00 00 00 
+  8030d3:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8030da:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8030dd:	39 3b                	cmp    %edi,(%rbx)
+  8030df:	74 47                	je     803128 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8030e1:	48 83 c0 08          	add    $0x8,%rax
+  8030e5:	48 8b 18             	mov    (%rax),%rbx
+  8030e8:	48 85 db             	test   %rbx,%rbx
+  8030eb:	75 f0                	jne    8030dd <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8030ed:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8030f4:	00 00 00 
+  8030f7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8030fd:	89 fa                	mov    %edi,%edx
+  8030ff:	48 bf d8 64 80 00 00 	movabs $0x8064d8,%rdi
+  803106:	00 00 00 
+  803109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310e:	48 b9 3a 17 80 00 00 	movabs $0x80173a,%rcx
+  803115:	00 00 00 
+  803118:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80311a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80311f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803123:	5b                   	pop    %rbx
+  803124:	41 5c                	pop    %r12
+  803126:	5d                   	pop    %rbp
+  803127:	c3                   	ret
+            return 0;
+  803128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312d:	eb f0                	jmp    80311f <dev_lookup+0x60>
+
+000000000080312f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80312f:	55                   	push   %rbp
+  803130:	48 89 e5             	mov    %rsp,%rbp
+  803133:	41 55                	push   %r13
+  803135:	41 54                	push   %r12
+  803137:	53                   	push   %rbx
+  803138:	48 83 ec 18          	sub    $0x18,%rsp
+  80313c:	48 89 fb             	mov    %rdi,%rbx
+  80313f:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803142:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803149:	ff ff ff 
+  80314c:	48 01 df             	add    %rbx,%rdi
+  80314f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803153:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803157:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	41 89 c5             	mov    %eax,%r13d
+  803166:	85 c0                	test   %eax,%eax
+  803168:	78 06                	js     803170 <fd_close+0x41>
+  80316a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80316e:	74 1a                	je     80318a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803170:	45 84 e4             	test   %r12b,%r12b
+  803173:	b8 00 00 00 00       	mov    $0x0,%eax
+  803178:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80317c:	44 89 e8             	mov    %r13d,%eax
+  80317f:	48 83 c4 18          	add    $0x18,%rsp
+  803183:	5b                   	pop    %rbx
+  803184:	41 5c                	pop    %r12
+  803186:	41 5d                	pop    %r13
+  803188:	5d                   	pop    %rbp
+  803189:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80318a:	8b 3b                	mov    (%rbx),%edi
+  80318c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803190:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  803197:	00 00 00 
+  80319a:	ff d0                	call   *%rax
+  80319c:	41 89 c5             	mov    %eax,%r13d
+  80319f:	85 c0                	test   %eax,%eax
+  8031a1:	78 1b                	js     8031be <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8031a3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031a7:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8031ab:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8031b1:	48 85 c0             	test   %rax,%rax
+  8031b4:	74 08                	je     8031be <fd_close+0x8f>
+  8031b6:	48 89 df             	mov    %rbx,%rdi
+  8031b9:	ff d0                	call   *%rax
+  8031bb:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8031be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031c3:	48 89 de             	mov    %rbx,%rsi
+  8031c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031cb:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  8031d2:	00 00 00 
+  8031d5:	ff d0                	call   *%rax
+    return res;
+  8031d7:	eb a3                	jmp    80317c <fd_close+0x4d>
+
+00000000008031d9 <close>:
+
+int
+close(int fdnum) {
+  8031d9:	55                   	push   %rbp
+  8031da:	48 89 e5             	mov    %rsp,%rbp
+  8031dd:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8031e1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031e5:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  8031ec:	00 00 00 
+  8031ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031f1:	85 c0                	test   %eax,%eax
+  8031f3:	78 15                	js     80320a <close+0x31>
+
+    return fd_close(fd, 1);
+  8031f5:	be 01 00 00 00       	mov    $0x1,%esi
+  8031fa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8031fe:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  803205:	00 00 00 
+  803208:	ff d0                	call   *%rax
+}
+  80320a:	c9                   	leave
+  80320b:	c3                   	ret
+
+000000000080320c <close_all>:
+
+void
+close_all(void) {
+  80320c:	55                   	push   %rbp
+  80320d:	48 89 e5             	mov    %rsp,%rbp
+  803210:	41 54                	push   %r12
+  803212:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803213:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803218:	49 bc d9 31 80 00 00 	movabs $0x8031d9,%r12
+  80321f:	00 00 00 
+  803222:	89 df                	mov    %ebx,%edi
+  803224:	41 ff d4             	call   *%r12
+  803227:	83 c3 01             	add    $0x1,%ebx
+  80322a:	83 fb 20             	cmp    $0x20,%ebx
+  80322d:	75 f3                	jne    803222 <close_all+0x16>
+}
+  80322f:	5b                   	pop    %rbx
+  803230:	41 5c                	pop    %r12
+  803232:	5d                   	pop    %rbp
+  803233:	c3                   	ret
+
+0000000000803234 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803234:	55                   	push   %rbp
+  803235:	48 89 e5             	mov    %rsp,%rbp
+  803238:	41 57                	push   %r15
+  80323a:	41 56                	push   %r14
+  80323c:	41 55                	push   %r13
+  80323e:	41 54                	push   %r12
+  803240:	53                   	push   %rbx
+  803241:	48 83 ec 18          	sub    $0x18,%rsp
+  803245:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803248:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80324c:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803253:	00 00 00 
+  803256:	ff d0                	call   *%rax
+  803258:	89 c3                	mov    %eax,%ebx
+  80325a:	85 c0                	test   %eax,%eax
+  80325c:	0f 88 b8 00 00 00    	js     80331a <dup+0xe6>
+    close(newfdnum);
+  803262:	44 89 e7             	mov    %r12d,%edi
+  803265:	48 b8 d9 31 80 00 00 	movabs $0x8031d9,%rax
+  80326c:	00 00 00 
+  80326f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803271:	4d 63 ec             	movslq %r12d,%r13
+  803274:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80327b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80327f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803283:	4c 89 ff             	mov    %r15,%rdi
+  803286:	49 be f8 2f 80 00 00 	movabs $0x802ff8,%r14
+  80328d:	00 00 00 
+  803290:	41 ff d6             	call   *%r14
+  803293:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803296:	4c 89 ef             	mov    %r13,%rdi
+  803299:	41 ff d6             	call   *%r14
+  80329c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80329f:	48 89 df             	mov    %rbx,%rdi
+  8032a2:	48 b8 14 45 80 00 00 	movabs $0x804514,%rax
+  8032a9:	00 00 00 
+  8032ac:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8032ae:	a8 04                	test   $0x4,%al
+  8032b0:	74 2b                	je     8032dd <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8032b2:	41 89 c1             	mov    %eax,%r9d
+  8032b5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032bb:	4c 89 f1             	mov    %r14,%rcx
+  8032be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032c3:	48 89 de             	mov    %rbx,%rsi
+  8032c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cb:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  8032d2:	00 00 00 
+  8032d5:	ff d0                	call   *%rax
+  8032d7:	89 c3                	mov    %eax,%ebx
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	78 4e                	js     80332b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8032dd:	4c 89 ff             	mov    %r15,%rdi
+  8032e0:	48 b8 14 45 80 00 00 	movabs $0x804514,%rax
+  8032e7:	00 00 00 
+  8032ea:	ff d0                	call   *%rax
+  8032ec:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8032ef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8032f5:	4c 89 e9             	mov    %r13,%rcx
+  8032f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032fd:	4c 89 fe             	mov    %r15,%rsi
+  803300:	bf 00 00 00 00       	mov    $0x0,%edi
+  803305:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  80330c:	00 00 00 
+  80330f:	ff d0                	call   *%rax
+  803311:	89 c3                	mov    %eax,%ebx
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 14                	js     80332b <dup+0xf7>
+
+    return newfdnum;
+  803317:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80331a:	89 d8                	mov    %ebx,%eax
+  80331c:	48 83 c4 18          	add    $0x18,%rsp
+  803320:	5b                   	pop    %rbx
+  803321:	41 5c                	pop    %r12
+  803323:	41 5d                	pop    %r13
+  803325:	41 5e                	pop    %r14
+  803327:	41 5f                	pop    %r15
+  803329:	5d                   	pop    %rbp
+  80332a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80332b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803330:	4c 89 ee             	mov    %r13,%rsi
+  803333:	bf 00 00 00 00       	mov    $0x0,%edi
+  803338:	49 bc ae 28 80 00 00 	movabs $0x8028ae,%r12
+  80333f:	00 00 00 
+  803342:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803345:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80334a:	4c 89 f6             	mov    %r14,%rsi
+  80334d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803352:	41 ff d4             	call   *%r12
+    return res;
+  803355:	eb c3                	jmp    80331a <dup+0xe6>
+
+0000000000803357 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803357:	55                   	push   %rbp
+  803358:	48 89 e5             	mov    %rsp,%rbp
+  80335b:	41 56                	push   %r14
+  80335d:	41 55                	push   %r13
+  80335f:	41 54                	push   %r12
+  803361:	53                   	push   %rbx
+  803362:	48 83 ec 10          	sub    $0x10,%rsp
+  803366:	89 fb                	mov    %edi,%ebx
+  803368:	49 89 f4             	mov    %rsi,%r12
+  80336b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80336e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803372:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	78 4c                	js     8033ce <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803382:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803386:	41 8b 3e             	mov    (%r14),%edi
+  803389:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80338d:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+  803399:	85 c0                	test   %eax,%eax
+  80339b:	78 35                	js     8033d2 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80339d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8033a1:	83 e0 03             	and    $0x3,%eax
+  8033a4:	83 f8 01             	cmp    $0x1,%eax
+  8033a7:	74 2d                	je     8033d6 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8033a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033ad:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8033b1:	48 85 c0             	test   %rax,%rax
+  8033b4:	74 56                	je     80340c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8033b6:	4c 89 ea             	mov    %r13,%rdx
+  8033b9:	4c 89 e6             	mov    %r12,%rsi
+  8033bc:	4c 89 f7             	mov    %r14,%rdi
+  8033bf:	ff d0                	call   *%rax
+}
+  8033c1:	48 83 c4 10          	add    $0x10,%rsp
+  8033c5:	5b                   	pop    %rbx
+  8033c6:	41 5c                	pop    %r12
+  8033c8:	41 5d                	pop    %r13
+  8033ca:	41 5e                	pop    %r14
+  8033cc:	5d                   	pop    %rbp
+  8033cd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033ce:	48 98                	cltq
+  8033d0:	eb ef                	jmp    8033c1 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8033d2:	48 98                	cltq
+  8033d4:	eb eb                	jmp    8033c1 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033d6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8033dd:	00 00 00 
+  8033e0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033e6:	89 da                	mov    %ebx,%edx
+  8033e8:	48 bf 19 65 80 00 00 	movabs $0x806519,%rdi
+  8033ef:	00 00 00 
+  8033f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f7:	48 b9 3a 17 80 00 00 	movabs $0x80173a,%rcx
+  8033fe:	00 00 00 
+  803401:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803403:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80340a:	eb b5                	jmp    8033c1 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80340c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803413:	eb ac                	jmp    8033c1 <read+0x6a>
+
+0000000000803415 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+  803419:	41 57                	push   %r15
+  80341b:	41 56                	push   %r14
+  80341d:	41 55                	push   %r13
+  80341f:	41 54                	push   %r12
+  803421:	53                   	push   %rbx
+  803422:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803426:	48 85 d2             	test   %rdx,%rdx
+  803429:	74 54                	je     80347f <readn+0x6a>
+  80342b:	41 89 fd             	mov    %edi,%r13d
+  80342e:	49 89 f6             	mov    %rsi,%r14
+  803431:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803434:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803439:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80343e:	49 bf 57 33 80 00 00 	movabs $0x803357,%r15
+  803445:	00 00 00 
+  803448:	4c 89 e2             	mov    %r12,%rdx
+  80344b:	48 29 f2             	sub    %rsi,%rdx
+  80344e:	4c 01 f6             	add    %r14,%rsi
+  803451:	44 89 ef             	mov    %r13d,%edi
+  803454:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803457:	85 c0                	test   %eax,%eax
+  803459:	78 20                	js     80347b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80345b:	01 c3                	add    %eax,%ebx
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	74 08                	je     803469 <readn+0x54>
+  803461:	48 63 f3             	movslq %ebx,%rsi
+  803464:	4c 39 e6             	cmp    %r12,%rsi
+  803467:	72 df                	jb     803448 <readn+0x33>
+    }
+    return res;
+  803469:	48 63 c3             	movslq %ebx,%rax
+}
+  80346c:	48 83 c4 08          	add    $0x8,%rsp
+  803470:	5b                   	pop    %rbx
+  803471:	41 5c                	pop    %r12
+  803473:	41 5d                	pop    %r13
+  803475:	41 5e                	pop    %r14
+  803477:	41 5f                	pop    %r15
+  803479:	5d                   	pop    %rbp
+  80347a:	c3                   	ret
+        if (inc < 0) return inc;
+  80347b:	48 98                	cltq
+  80347d:	eb ed                	jmp    80346c <readn+0x57>
+    int inc = 1, res = 0;
+  80347f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803484:	eb e3                	jmp    803469 <readn+0x54>
+
+0000000000803486 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803486:	55                   	push   %rbp
+  803487:	48 89 e5             	mov    %rsp,%rbp
+  80348a:	41 56                	push   %r14
+  80348c:	41 55                	push   %r13
+  80348e:	41 54                	push   %r12
+  803490:	53                   	push   %rbx
+  803491:	48 83 ec 10          	sub    $0x10,%rsp
+  803495:	89 fb                	mov    %edi,%ebx
+  803497:	49 89 f4             	mov    %rsi,%r12
+  80349a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80349d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034a1:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  8034a8:	00 00 00 
+  8034ab:	ff d0                	call   *%rax
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	78 47                	js     8034f8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034b1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8034b5:	41 8b 3e             	mov    (%r14),%edi
+  8034b8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034bc:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  8034c3:	00 00 00 
+  8034c6:	ff d0                	call   *%rax
+  8034c8:	85 c0                	test   %eax,%eax
+  8034ca:	78 30                	js     8034fc <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034cc:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8034d1:	74 2d                	je     803500 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8034d3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034d7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8034db:	48 85 c0             	test   %rax,%rax
+  8034de:	74 56                	je     803536 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8034e0:	4c 89 ea             	mov    %r13,%rdx
+  8034e3:	4c 89 e6             	mov    %r12,%rsi
+  8034e6:	4c 89 f7             	mov    %r14,%rdi
+  8034e9:	ff d0                	call   *%rax
+}
+  8034eb:	48 83 c4 10          	add    $0x10,%rsp
+  8034ef:	5b                   	pop    %rbx
+  8034f0:	41 5c                	pop    %r12
+  8034f2:	41 5d                	pop    %r13
+  8034f4:	41 5e                	pop    %r14
+  8034f6:	5d                   	pop    %rbp
+  8034f7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034f8:	48 98                	cltq
+  8034fa:	eb ef                	jmp    8034eb <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034fc:	48 98                	cltq
+  8034fe:	eb eb                	jmp    8034eb <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803500:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803507:	00 00 00 
+  80350a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803510:	89 da                	mov    %ebx,%edx
+  803512:	48 bf 35 65 80 00 00 	movabs $0x806535,%rdi
+  803519:	00 00 00 
+  80351c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803521:	48 b9 3a 17 80 00 00 	movabs $0x80173a,%rcx
+  803528:	00 00 00 
+  80352b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80352d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803534:	eb b5                	jmp    8034eb <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803536:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80353d:	eb ac                	jmp    8034eb <write+0x65>
+
+000000000080353f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80353f:	55                   	push   %rbp
+  803540:	48 89 e5             	mov    %rsp,%rbp
+  803543:	53                   	push   %rbx
+  803544:	48 83 ec 18          	sub    $0x18,%rsp
+  803548:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80354a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80354e:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803555:	00 00 00 
+  803558:	ff d0                	call   *%rax
+  80355a:	85 c0                	test   %eax,%eax
+  80355c:	78 0c                	js     80356a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80355e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803562:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803565:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80356e:	c9                   	leave
+  80356f:	c3                   	ret
+
+0000000000803570 <tell>:
+
+int tell(int fdnum) {
+  803570:	55                   	push   %rbp
+  803571:	48 89 e5             	mov    %rsp,%rbp
+  803574:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803578:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80357c:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+  803588:	85 c0                	test   %eax,%eax
+  80358a:	78 07                	js     803593 <tell+0x23>
+
+    return fd->fd_offset;
+  80358c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803590:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803593:	c9                   	leave
+  803594:	c3                   	ret
+
+0000000000803595 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803595:	55                   	push   %rbp
+  803596:	48 89 e5             	mov    %rsp,%rbp
+  803599:	41 55                	push   %r13
+  80359b:	41 54                	push   %r12
+  80359d:	53                   	push   %rbx
+  80359e:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a2:	89 fb                	mov    %edi,%ebx
+  8035a4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035a7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035ab:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+  8035b7:	85 c0                	test   %eax,%eax
+  8035b9:	78 38                	js     8035f3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035bb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8035bf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8035c3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035c7:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  8035ce:	00 00 00 
+  8035d1:	ff d0                	call   *%rax
+  8035d3:	85 c0                	test   %eax,%eax
+  8035d5:	78 1c                	js     8035f3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035d7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8035dc:	74 20                	je     8035fe <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8035de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035e2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8035e6:	48 85 c0             	test   %rax,%rax
+  8035e9:	74 47                	je     803632 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8035eb:	44 89 e6             	mov    %r12d,%esi
+  8035ee:	4c 89 ef             	mov    %r13,%rdi
+  8035f1:	ff d0                	call   *%rax
+}
+  8035f3:	48 83 c4 18          	add    $0x18,%rsp
+  8035f7:	5b                   	pop    %rbx
+  8035f8:	41 5c                	pop    %r12
+  8035fa:	41 5d                	pop    %r13
+  8035fc:	5d                   	pop    %rbp
+  8035fd:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8035fe:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803605:	00 00 00 
+  803608:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80360e:	89 da                	mov    %ebx,%edx
+  803610:	48 bf f8 64 80 00 00 	movabs $0x8064f8,%rdi
+  803617:	00 00 00 
+  80361a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361f:	48 b9 3a 17 80 00 00 	movabs $0x80173a,%rcx
+  803626:	00 00 00 
+  803629:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80362b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803630:	eb c1                	jmp    8035f3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803632:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803637:	eb ba                	jmp    8035f3 <ftruncate+0x5e>
+
+0000000000803639 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803639:	55                   	push   %rbp
+  80363a:	48 89 e5             	mov    %rsp,%rbp
+  80363d:	41 54                	push   %r12
+  80363f:	53                   	push   %rbx
+  803640:	48 83 ec 10          	sub    $0x10,%rsp
+  803644:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803647:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80364b:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+  803657:	85 c0                	test   %eax,%eax
+  803659:	78 63                	js     8036be <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80365b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80365f:	41 8b 3c 24          	mov    (%r12),%edi
+  803663:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803667:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+  803673:	85 c0                	test   %eax,%eax
+  803675:	78 47                	js     8036be <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803677:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80367b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803680:	74 45                	je     8036c7 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803682:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803685:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80368c:	00 00 00 
+    stat->st_isdir = 0;
+  80368f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803696:	00 00 00 
+    stat->st_ino = 0;
+  803699:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8036a0:	00 00 00 00 
+    stat->st_version = 0;
+  8036a4:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8036ab:	00 00 00 
+    stat->st_dev = dev;
+  8036ae:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8036b5:	48 89 de             	mov    %rbx,%rsi
+  8036b8:	4c 89 e7             	mov    %r12,%rdi
+  8036bb:	ff 50 28             	call   *0x28(%rax)
+}
+  8036be:	48 83 c4 10          	add    $0x10,%rsp
+  8036c2:	5b                   	pop    %rbx
+  8036c3:	41 5c                	pop    %r12
+  8036c5:	5d                   	pop    %rbp
+  8036c6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8036c7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8036cc:	eb f0                	jmp    8036be <fstat+0x85>
+
+00000000008036ce <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8036ce:	55                   	push   %rbp
+  8036cf:	48 89 e5             	mov    %rsp,%rbp
+  8036d2:	41 54                	push   %r12
+  8036d4:	53                   	push   %rbx
+  8036d5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8036d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8036dd:	48 b8 ef 3b 80 00 00 	movabs $0x803bef,%rax
+  8036e4:	00 00 00 
+  8036e7:	ff d0                	call   *%rax
+  8036e9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8036eb:	85 c0                	test   %eax,%eax
+  8036ed:	78 25                	js     803714 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8036ef:	4c 89 e6             	mov    %r12,%rsi
+  8036f2:	89 c7                	mov    %eax,%edi
+  8036f4:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  8036fb:	00 00 00 
+  8036fe:	ff d0                	call   *%rax
+  803700:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803703:	89 df                	mov    %ebx,%edi
+  803705:	48 b8 d9 31 80 00 00 	movabs $0x8031d9,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+
+    return res;
+  803711:	44 89 e3             	mov    %r12d,%ebx
+}
+  803714:	89 d8                	mov    %ebx,%eax
+  803716:	5b                   	pop    %rbx
+  803717:	41 5c                	pop    %r12
+  803719:	5d                   	pop    %rbp
+  80371a:	c3                   	ret
+
+000000000080371b <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80371b:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803722:	00 00 00 
+  803725:	83 38 00             	cmpl   $0x0,(%rax)
+  803728:	74 0a                	je     803734 <fsipc_env+0x19>
+    return fsenv;
+}
+  80372a:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803731:	00 00 
+  803733:	c3                   	ret
+fsipc_env(void) {
+  803734:	55                   	push   %rbp
+  803735:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803738:	bf 03 00 00 00       	mov    $0x3,%edi
+  80373d:	48 b8 c1 58 80 00 00 	movabs $0x8058c1,%rax
+  803744:	00 00 00 
+  803747:	ff d0                	call   *%rax
+  803749:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803750:	00 00 
+}
+  803752:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803759:	00 00 
+  80375b:	5d                   	pop    %rbp
+  80375c:	c3                   	ret
+
+000000000080375d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80375d:	55                   	push   %rbp
+  80375e:	48 89 e5             	mov    %rsp,%rbp
+  803761:	53                   	push   %rbx
+  803762:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803766:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80376d:	00 
+  80376e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803775:	00 
+  803776:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80377d:	00 
+  80377e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803785:	00 
+  803786:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80378d:	00 
+
+    assert(size <= sizeof(words));
+  80378e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803792:	77 38                	ja     8037cc <fsipc_short+0x6f>
+  803794:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803796:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80379a:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  8037a1:	00 00 00 
+  8037a4:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8037a6:	48 b8 1b 37 80 00 00 	movabs $0x80371b,%rax
+  8037ad:	00 00 00 
+  8037b0:	ff d0                	call   *%rax
+  8037b2:	89 c7                	mov    %eax,%edi
+  8037b4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8037b8:	89 de                	mov    %ebx,%esi
+  8037ba:	48 b8 24 58 80 00 00 	movabs $0x805824,%rax
+  8037c1:	00 00 00 
+  8037c4:	ff d0                	call   *%rax
+}
+  8037c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ca:	c9                   	leave
+  8037cb:	c3                   	ret
+    assert(size <= sizeof(words));
+  8037cc:	48 b9 80 65 80 00 00 	movabs $0x806580,%rcx
+  8037d3:	00 00 00 
+  8037d6:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  8037dd:	00 00 00 
+  8037e0:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8037e5:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  8037ec:	00 00 00 
+  8037ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f4:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  8037fb:	00 00 00 
+  8037fe:	41 ff d0             	call   *%r8
+
+0000000000803801 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803801:	55                   	push   %rbp
+  803802:	48 89 e5             	mov    %rsp,%rbp
+  803805:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803809:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80380c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80380f:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803812:	ba 08 00 00 00       	mov    $0x8,%edx
+  803817:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80381b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803820:	48 b8 5d 37 80 00 00 	movabs $0x80375d,%rax
+  803827:	00 00 00 
+  80382a:	ff d0                	call   *%rax
+}
+  80382c:	c9                   	leave
+  80382d:	c3                   	ret
+
+000000000080382e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80382e:	55                   	push   %rbp
+  80382f:	48 89 e5             	mov    %rsp,%rbp
+  803832:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803836:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803839:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80383c:	ba 04 00 00 00       	mov    $0x4,%edx
+  803841:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803845:	bf 06 00 00 00       	mov    $0x6,%edi
+  80384a:	48 b8 5d 37 80 00 00 	movabs $0x80375d,%rax
+  803851:	00 00 00 
+  803854:	ff d0                	call   *%rax
+}
+  803856:	c9                   	leave
+  803857:	c3                   	ret
+
+0000000000803858 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803858:	55                   	push   %rbp
+  803859:	48 89 e5             	mov    %rsp,%rbp
+  80385c:	41 54                	push   %r12
+  80385e:	53                   	push   %rbx
+  80385f:	48 83 ec 10          	sub    $0x10,%rsp
+  803863:	89 fb                	mov    %edi,%ebx
+  803865:	49 89 f4             	mov    %rsi,%r12
+  803868:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80386c:	48 b8 1b 37 80 00 00 	movabs $0x80371b,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+  803878:	89 c7                	mov    %eax,%edi
+  80387a:	6a 00                	push   $0x0
+  80387c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803880:	50                   	push   %rax
+  803881:	4d 89 e1             	mov    %r12,%r9
+  803884:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80388a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80388f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803896:	00 00 00 
+  803899:	89 de                	mov    %ebx,%esi
+  80389b:	48 b8 bf 57 80 00 00 	movabs $0x8057bf,%rax
+  8038a2:	00 00 00 
+  8038a5:	ff d0                	call   *%rax
+}
+  8038a7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8038ab:	5b                   	pop    %rbx
+  8038ac:	41 5c                	pop    %r12
+  8038ae:	5d                   	pop    %rbp
+  8038af:	c3                   	ret
+
+00000000008038b0 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8038b0:	55                   	push   %rbp
+  8038b1:	48 89 e5             	mov    %rsp,%rbp
+  8038b4:	41 54                	push   %r12
+  8038b6:	53                   	push   %rbx
+  8038b7:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8038ba:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8038bd:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8038c4:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8038d5:	48 b8 58 38 80 00 00 	movabs $0x803858,%rax
+  8038dc:	00 00 00 
+  8038df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038e1:	85 c0                	test   %eax,%eax
+  8038e3:	78 5a                	js     80393f <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8038e5:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8038ec:	00 00 00 
+  8038ef:	4c 89 e6             	mov    %r12,%rsi
+  8038f2:	48 89 df             	mov    %rbx,%rdi
+  8038f5:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  8038fc:	00 00 00 
+  8038ff:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803901:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803908:	00 
+  803909:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80390f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803916:	00 
+  803917:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80391d:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803924:	00 
+  803925:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  80392c:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803933:	00 
+  803934:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80393a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80393f:	5b                   	pop    %rbx
+  803940:	41 5c                	pop    %r12
+  803942:	5d                   	pop    %rbp
+  803943:	c3                   	ret
+
+0000000000803944 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803944:	55                   	push   %rbp
+  803945:	48 89 e5             	mov    %rsp,%rbp
+  803948:	41 57                	push   %r15
+  80394a:	41 56                	push   %r14
+  80394c:	41 55                	push   %r13
+  80394e:	41 54                	push   %r12
+  803950:	53                   	push   %rbx
+  803951:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803955:	48 85 ff             	test   %rdi,%rdi
+  803958:	0f 84 a1 00 00 00    	je     8039ff <devfile_read+0xbb>
+  80395e:	49 89 ff             	mov    %rdi,%r15
+  803961:	49 89 f5             	mov    %rsi,%r13
+  803964:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803967:	48 85 f6             	test   %rsi,%rsi
+  80396a:	0f 84 c4 00 00 00    	je     803a34 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803970:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803977:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803978:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80397f:	00 00 00 
+  803982:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803986:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803989:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80398d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803992:	be 00 00 00 00       	mov    $0x0,%esi
+  803997:	bf 03 00 00 00       	mov    $0x3,%edi
+  80399c:	48 b8 58 38 80 00 00 	movabs $0x803858,%rax
+  8039a3:	00 00 00 
+  8039a6:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039a8:	85 c0                	test   %eax,%eax
+  8039aa:	0f 88 b9 00 00 00    	js     803a69 <devfile_read+0x125>
+        assert(res <= n);
+  8039b0:	48 63 d8             	movslq %eax,%rbx
+  8039b3:	49 39 dc             	cmp    %rbx,%r12
+  8039b6:	0f 82 b1 00 00 00    	jb     803a6d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8039bc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8039c1:	0f 87 db 00 00 00    	ja     803aa2 <devfile_read+0x15e>
+        if (!res) {
+  8039c7:	85 c0                	test   %eax,%eax
+  8039c9:	74 21                	je     8039ec <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8039cb:	48 89 da             	mov    %rbx,%rdx
+  8039ce:	4c 89 f6             	mov    %r14,%rsi
+  8039d1:	4c 89 ef             	mov    %r13,%rdi
+  8039d4:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+        total_read += res;
+  8039e0:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  8039e4:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  8039e7:	49 29 dc             	sub    %rbx,%r12
+  8039ea:	75 96                	jne    803982 <devfile_read+0x3e>
+    return total_read;
+  8039ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8039f0:	48 83 c4 18          	add    $0x18,%rsp
+  8039f4:	5b                   	pop    %rbx
+  8039f5:	41 5c                	pop    %r12
+  8039f7:	41 5d                	pop    %r13
+  8039f9:	41 5e                	pop    %r14
+  8039fb:	41 5f                	pop    %r15
+  8039fd:	5d                   	pop    %rbp
+  8039fe:	c3                   	ret
+    assert(fd);
+  8039ff:	48 b9 b6 65 80 00 00 	movabs $0x8065b6,%rcx
+  803a06:	00 00 00 
+  803a09:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803a10:	00 00 00 
+  803a13:	be 91 00 00 00       	mov    $0x91,%esi
+  803a18:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803a1f:	00 00 00 
+  803a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a27:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803a2e:	00 00 00 
+  803a31:	41 ff d0             	call   *%r8
+    assert(buf);
+  803a34:	48 b9 b9 65 80 00 00 	movabs $0x8065b9,%rcx
+  803a3b:	00 00 00 
+  803a3e:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803a45:	00 00 00 
+  803a48:	be 92 00 00 00       	mov    $0x92,%esi
+  803a4d:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803a54:	00 00 00 
+  803a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5c:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803a63:	00 00 00 
+  803a66:	41 ff d0             	call   *%r8
+            return res;
+  803a69:	48 98                	cltq
+  803a6b:	eb 83                	jmp    8039f0 <devfile_read+0xac>
+        assert(res <= n);
+  803a6d:	48 b9 bd 65 80 00 00 	movabs $0x8065bd,%rcx
+  803a74:	00 00 00 
+  803a77:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803a7e:	00 00 00 
+  803a81:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803a86:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803a8d:	00 00 00 
+  803a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a95:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803a9c:	00 00 00 
+  803a9f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803aa2:	48 b9 c8 65 80 00 00 	movabs $0x8065c8,%rcx
+  803aa9:	00 00 00 
+  803aac:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803ab3:	00 00 00 
+  803ab6:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803abb:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803ac2:	00 00 00 
+  803ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aca:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803ad1:	00 00 00 
+  803ad4:	41 ff d0             	call   *%r8
+
+0000000000803ad7 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803ad7:	55                   	push   %rbp
+  803ad8:	48 89 e5             	mov    %rsp,%rbp
+  803adb:	41 57                	push   %r15
+  803add:	41 56                	push   %r14
+  803adf:	41 55                	push   %r13
+  803ae1:	41 54                	push   %r12
+  803ae3:	53                   	push   %rbx
+  803ae4:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803ae8:	48 85 ff             	test   %rdi,%rdi
+  803aeb:	0f 84 83 00 00 00    	je     803b74 <devfile_write+0x9d>
+  803af1:	49 89 ff             	mov    %rdi,%r15
+  803af4:	49 89 f4             	mov    %rsi,%r12
+  803af7:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803afa:	48 85 f6             	test   %rsi,%rsi
+  803afd:	0f 84 a6 00 00 00    	je     803ba9 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803b03:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803b09:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803b10:	00 00 00 
+  803b13:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b17:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803b1a:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803b1e:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803b23:	48 39 d3             	cmp    %rdx,%rbx
+  803b26:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803b2a:	4c 89 e6             	mov    %r12,%rsi
+  803b2d:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803b34:	00 00 00 
+  803b37:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  803b3e:	00 00 00 
+  803b41:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b48:	be 00 00 00 00       	mov    $0x0,%esi
+  803b4d:	bf 04 00 00 00       	mov    $0x4,%edi
+  803b52:	48 b8 58 38 80 00 00 	movabs $0x803858,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b5e:	85 c0                	test   %eax,%eax
+  803b60:	78 7c                	js     803bde <devfile_write+0x107>
+        total_written += res;
+  803b62:	48 98                	cltq
+  803b64:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803b67:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803b6a:	48 29 c3             	sub    %rax,%rbx
+  803b6d:	75 a4                	jne    803b13 <devfile_write+0x3c>
+    return total_written;
+  803b6f:	4c 89 e8             	mov    %r13,%rax
+  803b72:	eb 6c                	jmp    803be0 <devfile_write+0x109>
+    assert(fd);
+  803b74:	48 b9 b6 65 80 00 00 	movabs $0x8065b6,%rcx
+  803b7b:	00 00 00 
+  803b7e:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803b85:	00 00 00 
+  803b88:	be bd 00 00 00       	mov    $0xbd,%esi
+  803b8d:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803b94:	00 00 00 
+  803b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9c:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803ba3:	00 00 00 
+  803ba6:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ba9:	48 b9 b9 65 80 00 00 	movabs $0x8065b9,%rcx
+  803bb0:	00 00 00 
+  803bb3:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  803bba:	00 00 00 
+  803bbd:	be be 00 00 00       	mov    $0xbe,%esi
+  803bc2:	48 bf ab 65 80 00 00 	movabs $0x8065ab,%rdi
+  803bc9:	00 00 00 
+  803bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bd1:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  803bd8:	00 00 00 
+  803bdb:	41 ff d0             	call   *%r8
+            return res;
+  803bde:	48 98                	cltq
+}
+  803be0:	48 83 c4 08          	add    $0x8,%rsp
+  803be4:	5b                   	pop    %rbx
+  803be5:	41 5c                	pop    %r12
+  803be7:	41 5d                	pop    %r13
+  803be9:	41 5e                	pop    %r14
+  803beb:	41 5f                	pop    %r15
+  803bed:	5d                   	pop    %rbp
+  803bee:	c3                   	ret
+
+0000000000803bef <open>:
+open(const char *path, int mode) {
+  803bef:	55                   	push   %rbp
+  803bf0:	48 89 e5             	mov    %rsp,%rbp
+  803bf3:	41 55                	push   %r13
+  803bf5:	41 54                	push   %r12
+  803bf7:	53                   	push   %rbx
+  803bf8:	48 83 ec 18          	sub    $0x18,%rsp
+  803bfc:	49 89 fc             	mov    %rdi,%r12
+  803bff:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803c02:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+  803c0e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803c14:	0f 87 8f 00 00 00    	ja     803ca9 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803c1a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c1e:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+  803c2a:	89 c3                	mov    %eax,%ebx
+  803c2c:	85 c0                	test   %eax,%eax
+  803c2e:	78 55                	js     803c85 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803c30:	4c 89 e6             	mov    %r12,%rsi
+  803c33:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803c3a:	00 00 00 
+  803c3d:	48 89 df             	mov    %rbx,%rdi
+  803c40:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  803c47:	00 00 00 
+  803c4a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803c4c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c58:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803c61:	48 b8 58 38 80 00 00 	movabs $0x803858,%rax
+  803c68:	00 00 00 
+  803c6b:	ff d0                	call   *%rax
+  803c6d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	78 1f                	js     803c92 <open+0xa3>
+    return fd2num(fd);
+  803c73:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c77:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803c7e:	00 00 00 
+  803c81:	ff d0                	call   *%rax
+  803c83:	89 c3                	mov    %eax,%ebx
+}
+  803c85:	89 d8                	mov    %ebx,%eax
+  803c87:	48 83 c4 18          	add    $0x18,%rsp
+  803c8b:	5b                   	pop    %rbx
+  803c8c:	41 5c                	pop    %r12
+  803c8e:	41 5d                	pop    %r13
+  803c90:	5d                   	pop    %rbp
+  803c91:	c3                   	ret
+        fd_close(fd, 0);
+  803c92:	be 00 00 00 00       	mov    $0x0,%esi
+  803c97:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c9b:	48 b8 2f 31 80 00 00 	movabs $0x80312f,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+        return res;
+  803ca7:	eb dc                	jmp    803c85 <open+0x96>
+        return -E_BAD_PATH;
+  803ca9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803cae:	eb d5                	jmp    803c85 <open+0x96>
+
+0000000000803cb0 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803cb0:	55                   	push   %rbp
+  803cb1:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  803cbe:	bf 08 00 00 00       	mov    $0x8,%edi
+  803cc3:	48 b8 5d 37 80 00 00 	movabs $0x80375d,%rax
+  803cca:	00 00 00 
+  803ccd:	ff d0                	call   *%rax
+}
+  803ccf:	5d                   	pop    %rbp
+  803cd0:	c3                   	ret
+
+0000000000803cd1 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803cd1:	55                   	push   %rbp
+  803cd2:	48 89 e5             	mov    %rsp,%rbp
+  803cd5:	41 56                	push   %r14
+  803cd7:	41 55                	push   %r13
+  803cd9:	41 54                	push   %r12
+  803cdb:	53                   	push   %rbx
+  803cdc:	48 83 ec 10          	sub    $0x10,%rsp
+  803ce0:	41 89 f6             	mov    %esi,%r14d
+  803ce3:	49 89 d4             	mov    %rdx,%r12
+  803ce6:	48 89 cb             	mov    %rcx,%rbx
+  803ce9:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803cec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803cf0:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803cf7:	00 00 00 
+  803cfa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cfc:	85 c0                	test   %eax,%eax
+  803cfe:	78 46                	js     803d46 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d00:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d04:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803d0b:	00 00 00 
+  803d0e:	8b 00                	mov    (%rax),%eax
+  803d10:	39 02                	cmp    %eax,(%rdx)
+  803d12:	75 3f                	jne    803d53 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803d14:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803d1b:	00 00 00 
+  803d1e:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803d21:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803d23:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803d27:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803d2b:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803d2f:	48 89 da             	mov    %rbx,%rdx
+  803d32:	4c 89 e6             	mov    %r12,%rsi
+  803d35:	bf 09 00 00 00       	mov    $0x9,%edi
+  803d3a:	48 b8 58 38 80 00 00 	movabs $0x803858,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+}
+  803d46:	48 83 c4 10          	add    $0x10,%rsp
+  803d4a:	5b                   	pop    %rbx
+  803d4b:	41 5c                	pop    %r12
+  803d4d:	41 5d                	pop    %r13
+  803d4f:	41 5e                	pop    %r14
+  803d51:	5d                   	pop    %rbp
+  803d52:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d58:	eb ec                	jmp    803d46 <file_map+0x75>
+
+0000000000803d5a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803d5a:	55                   	push   %rbp
+  803d5b:	48 89 e5             	mov    %rsp,%rbp
+  803d5e:	41 54                	push   %r12
+  803d60:	53                   	push   %rbx
+  803d61:	48 83 ec 20          	sub    $0x20,%rsp
+  803d65:	41 89 f4             	mov    %esi,%r12d
+  803d68:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d6b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d6f:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d7b:	85 c0                	test   %eax,%eax
+  803d7d:	78 3c                	js     803dbb <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d83:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803d8a:	00 00 00 
+  803d8d:	8b 0a                	mov    (%rdx),%ecx
+  803d8f:	39 08                	cmp    %ecx,(%rax)
+  803d91:	75 31                	jne    803dc4 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803d93:	8b 40 0c             	mov    0xc(%rax),%eax
+  803d96:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803d99:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d9d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803da1:	ba 10 00 00 00       	mov    $0x10,%edx
+  803da6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803daa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803daf:	48 b8 5d 37 80 00 00 	movabs $0x80375d,%rax
+  803db6:	00 00 00 
+  803db9:	ff d0                	call   *%rax
+}
+  803dbb:	48 83 c4 20          	add    $0x20,%rsp
+  803dbf:	5b                   	pop    %rbx
+  803dc0:	41 5c                	pop    %r12
+  803dc2:	5d                   	pop    %rbp
+  803dc3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803dc4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803dc9:	eb f0                	jmp    803dbb <file_msync+0x61>
+
+0000000000803dcb <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803dcb:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803dcf:	7f 01                	jg     803dd2 <writebuf+0x7>
+  803dd1:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803dd2:	55                   	push   %rbp
+  803dd3:	48 89 e5             	mov    %rsp,%rbp
+  803dd6:	53                   	push   %rbx
+  803dd7:	48 83 ec 08          	sub    $0x8,%rsp
+  803ddb:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803dde:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803de2:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803de6:	8b 3f                	mov    (%rdi),%edi
+  803de8:	48 b8 86 34 80 00 00 	movabs $0x803486,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803df4:	48 85 c0             	test   %rax,%rax
+  803df7:	7e 04                	jle    803dfd <writebuf+0x32>
+  803df9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803dfd:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803e01:	48 39 c2             	cmp    %rax,%rdx
+  803e04:	74 0f                	je     803e15 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803e06:	48 85 c0             	test   %rax,%rax
+  803e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e0e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e12:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e15:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e19:	c9                   	leave
+  803e1a:	c3                   	ret
+
+0000000000803e1b <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e1b:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e1e:	8d 50 01             	lea    0x1(%rax),%edx
+  803e21:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e24:	48 98                	cltq
+  803e26:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e2b:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e31:	74 01                	je     803e34 <putch+0x19>
+  803e33:	c3                   	ret
+putch(int ch, void *arg) {
+  803e34:	55                   	push   %rbp
+  803e35:	48 89 e5             	mov    %rsp,%rbp
+  803e38:	53                   	push   %rbx
+  803e39:	48 83 ec 08          	sub    $0x8,%rsp
+  803e3d:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e40:	48 89 f7             	mov    %rsi,%rdi
+  803e43:	48 b8 cb 3d 80 00 00 	movabs $0x803dcb,%rax
+  803e4a:	00 00 00 
+  803e4d:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e4f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e5a:	c9                   	leave
+  803e5b:	c3                   	ret
+
+0000000000803e5c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e5c:	55                   	push   %rbp
+  803e5d:	48 89 e5             	mov    %rsp,%rbp
+  803e60:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e67:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e6a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e70:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e77:	00 00 00 
+    state.result = 0;
+  803e7a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e81:	00 00 00 00 
+    state.error = 1;
+  803e85:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803e8c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803e8f:	48 89 f2             	mov    %rsi,%rdx
+  803e92:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803e99:	48 bf 1b 3e 80 00 00 	movabs $0x803e1b,%rdi
+  803ea0:	00 00 00 
+  803ea3:	48 b8 8a 18 80 00 00 	movabs $0x80188a,%rax
+  803eaa:	00 00 00 
+  803ead:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803eaf:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803eb6:	7f 14                	jg     803ecc <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803eb8:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803ebf:	48 85 c0             	test   %rax,%rax
+  803ec2:	75 06                	jne    803eca <vfprintf+0x6e>
+  803ec4:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803eca:	c9                   	leave
+  803ecb:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ecc:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ed3:	48 b8 cb 3d 80 00 00 	movabs $0x803dcb,%rax
+  803eda:	00 00 00 
+  803edd:	ff d0                	call   *%rax
+  803edf:	eb d7                	jmp    803eb8 <vfprintf+0x5c>
+
+0000000000803ee1 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ee1:	55                   	push   %rbp
+  803ee2:	48 89 e5             	mov    %rsp,%rbp
+  803ee5:	48 83 ec 50          	sub    $0x50,%rsp
+  803ee9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803eed:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ef1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ef5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ef9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f00:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f08:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f0c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f10:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f14:	48 b8 5c 3e 80 00 00 	movabs $0x803e5c,%rax
+  803f1b:	00 00 00 
+  803f1e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f20:	c9                   	leave
+  803f21:	c3                   	ret
+
+0000000000803f22 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f22:	55                   	push   %rbp
+  803f23:	48 89 e5             	mov    %rsp,%rbp
+  803f26:	48 83 ec 50          	sub    $0x50,%rsp
+  803f2a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f2e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f32:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f36:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f3a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f3e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f45:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f4d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f51:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f55:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f59:	48 89 fe             	mov    %rdi,%rsi
+  803f5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f61:	48 b8 5c 3e 80 00 00 	movabs $0x803e5c,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f6d:	c9                   	leave
+  803f6e:	c3                   	ret
+
+0000000000803f6f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f6f:	55                   	push   %rbp
+  803f70:	48 89 e5             	mov    %rsp,%rbp
+  803f73:	41 54                	push   %r12
+  803f75:	53                   	push   %rbx
+  803f76:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f79:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  803f80:	00 00 00 
+  803f83:	ff d0                	call   *%rax
+  803f85:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f88:	48 be f0 65 80 00 00 	movabs $0x8065f0,%rsi
+  803f8f:	00 00 00 
+  803f92:	48 89 df             	mov    %rbx,%rdi
+  803f95:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  803f9c:	00 00 00 
+  803f9f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803fa1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803fa6:	41 2b 04 24          	sub    (%r12),%eax
+  803faa:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803fb0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803fb7:	00 00 00 
+    stat->st_dev = &devpipe;
+  803fba:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803fc1:	00 00 00 
+  803fc4:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd0:	5b                   	pop    %rbx
+  803fd1:	41 5c                	pop    %r12
+  803fd3:	5d                   	pop    %rbp
+  803fd4:	c3                   	ret
+
+0000000000803fd5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803fd5:	55                   	push   %rbp
+  803fd6:	48 89 e5             	mov    %rsp,%rbp
+  803fd9:	41 54                	push   %r12
+  803fdb:	53                   	push   %rbx
+  803fdc:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803fdf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe4:	48 89 fe             	mov    %rdi,%rsi
+  803fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fec:	49 bc ae 28 80 00 00 	movabs $0x8028ae,%r12
+  803ff3:	00 00 00 
+  803ff6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803ff9:	48 89 df             	mov    %rbx,%rdi
+  803ffc:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  804003:	00 00 00 
+  804006:	ff d0                	call   *%rax
+  804008:	48 89 c6             	mov    %rax,%rsi
+  80400b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804010:	bf 00 00 00 00       	mov    $0x0,%edi
+  804015:	41 ff d4             	call   *%r12
+}
+  804018:	5b                   	pop    %rbx
+  804019:	41 5c                	pop    %r12
+  80401b:	5d                   	pop    %rbp
+  80401c:	c3                   	ret
+
+000000000080401d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80401d:	55                   	push   %rbp
+  80401e:	48 89 e5             	mov    %rsp,%rbp
+  804021:	41 57                	push   %r15
+  804023:	41 56                	push   %r14
+  804025:	41 55                	push   %r13
+  804027:	41 54                	push   %r12
+  804029:	53                   	push   %rbx
+  80402a:	48 83 ec 18          	sub    $0x18,%rsp
+  80402e:	49 89 fc             	mov    %rdi,%r12
+  804031:	49 89 f5             	mov    %rsi,%r13
+  804034:	49 89 d7             	mov    %rdx,%r15
+  804037:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80403b:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  804042:	00 00 00 
+  804045:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804047:	4d 85 ff             	test   %r15,%r15
+  80404a:	0f 84 af 00 00 00    	je     8040ff <devpipe_write+0xe2>
+  804050:	48 89 c3             	mov    %rax,%rbx
+  804053:	4c 89 f8             	mov    %r15,%rax
+  804056:	4d 89 ef             	mov    %r13,%r15
+  804059:	4c 01 e8             	add    %r13,%rax
+  80405c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804060:	49 bd a4 27 80 00 00 	movabs $0x8027a4,%r13
+  804067:	00 00 00 
+            sys_yield();
+  80406a:	49 be 35 27 80 00 00 	movabs $0x802735,%r14
+  804071:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804074:	8b 73 04             	mov    0x4(%rbx),%esi
+  804077:	48 63 ce             	movslq %esi,%rcx
+  80407a:	48 63 03             	movslq (%rbx),%rax
+  80407d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804083:	48 39 c1             	cmp    %rax,%rcx
+  804086:	72 2e                	jb     8040b6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804088:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80408d:	48 89 da             	mov    %rbx,%rdx
+  804090:	be 00 10 00 00       	mov    $0x1000,%esi
+  804095:	4c 89 e7             	mov    %r12,%rdi
+  804098:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80409b:	85 c0                	test   %eax,%eax
+  80409d:	74 66                	je     804105 <devpipe_write+0xe8>
+            sys_yield();
+  80409f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040a2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040a5:	48 63 ce             	movslq %esi,%rcx
+  8040a8:	48 63 03             	movslq (%rbx),%rax
+  8040ab:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8040b1:	48 39 c1             	cmp    %rax,%rcx
+  8040b4:	73 d2                	jae    804088 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040b6:	41 0f b6 3f          	movzbl (%r15),%edi
+  8040ba:	48 89 ca             	mov    %rcx,%rdx
+  8040bd:	48 c1 ea 03          	shr    $0x3,%rdx
+  8040c1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8040c8:	08 10 20 
+  8040cb:	48 f7 e2             	mul    %rdx
+  8040ce:	48 c1 ea 06          	shr    $0x6,%rdx
+  8040d2:	48 89 d0             	mov    %rdx,%rax
+  8040d5:	48 c1 e0 09          	shl    $0x9,%rax
+  8040d9:	48 29 d0             	sub    %rdx,%rax
+  8040dc:	48 c1 e0 03          	shl    $0x3,%rax
+  8040e0:	48 29 c1             	sub    %rax,%rcx
+  8040e3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8040e8:	83 c6 01             	add    $0x1,%esi
+  8040eb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040ee:	49 83 c7 01          	add    $0x1,%r15
+  8040f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040f6:	49 39 c7             	cmp    %rax,%r15
+  8040f9:	0f 85 75 ff ff ff    	jne    804074 <devpipe_write+0x57>
+    return n;
+  8040ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804103:	eb 05                	jmp    80410a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804105:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80410a:	48 83 c4 18          	add    $0x18,%rsp
+  80410e:	5b                   	pop    %rbx
+  80410f:	41 5c                	pop    %r12
+  804111:	41 5d                	pop    %r13
+  804113:	41 5e                	pop    %r14
+  804115:	41 5f                	pop    %r15
+  804117:	5d                   	pop    %rbp
+  804118:	c3                   	ret
+
+0000000000804119 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804119:	55                   	push   %rbp
+  80411a:	48 89 e5             	mov    %rsp,%rbp
+  80411d:	41 57                	push   %r15
+  80411f:	41 56                	push   %r14
+  804121:	41 55                	push   %r13
+  804123:	41 54                	push   %r12
+  804125:	53                   	push   %rbx
+  804126:	48 83 ec 18          	sub    $0x18,%rsp
+  80412a:	49 89 fc             	mov    %rdi,%r12
+  80412d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804131:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804135:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  80413c:	00 00 00 
+  80413f:	ff d0                	call   *%rax
+  804141:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804144:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80414a:	49 bd a4 27 80 00 00 	movabs $0x8027a4,%r13
+  804151:	00 00 00 
+            sys_yield();
+  804154:	49 be 35 27 80 00 00 	movabs $0x802735,%r14
+  80415b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80415e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804163:	74 7d                	je     8041e2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804165:	8b 03                	mov    (%rbx),%eax
+  804167:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80416a:	75 26                	jne    804192 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80416c:	4d 85 ff             	test   %r15,%r15
+  80416f:	75 77                	jne    8041e8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804171:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804176:	48 89 da             	mov    %rbx,%rdx
+  804179:	be 00 10 00 00       	mov    $0x1000,%esi
+  80417e:	4c 89 e7             	mov    %r12,%rdi
+  804181:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804184:	85 c0                	test   %eax,%eax
+  804186:	74 72                	je     8041fa <devpipe_read+0xe1>
+            sys_yield();
+  804188:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80418b:	8b 03                	mov    (%rbx),%eax
+  80418d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804190:	74 df                	je     804171 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804192:	48 63 c8             	movslq %eax,%rcx
+  804195:	48 89 ca             	mov    %rcx,%rdx
+  804198:	48 c1 ea 03          	shr    $0x3,%rdx
+  80419c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8041a3:	08 10 20 
+  8041a6:	48 89 d0             	mov    %rdx,%rax
+  8041a9:	48 f7 e6             	mul    %rsi
+  8041ac:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041b0:	48 89 d0             	mov    %rdx,%rax
+  8041b3:	48 c1 e0 09          	shl    $0x9,%rax
+  8041b7:	48 29 d0             	sub    %rdx,%rax
+  8041ba:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8041c1:	00 
+  8041c2:	48 89 c8             	mov    %rcx,%rax
+  8041c5:	48 29 d0             	sub    %rdx,%rax
+  8041c8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8041cd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041d1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8041d5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041d8:	49 83 c7 01          	add    $0x1,%r15
+  8041dc:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8041e0:	75 83                	jne    804165 <devpipe_read+0x4c>
+    return n;
+  8041e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041e6:	eb 03                	jmp    8041eb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8041e8:	4c 89 f8             	mov    %r15,%rax
+}
+  8041eb:	48 83 c4 18          	add    $0x18,%rsp
+  8041ef:	5b                   	pop    %rbx
+  8041f0:	41 5c                	pop    %r12
+  8041f2:	41 5d                	pop    %r13
+  8041f4:	41 5e                	pop    %r14
+  8041f6:	41 5f                	pop    %r15
+  8041f8:	5d                   	pop    %rbp
+  8041f9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8041fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ff:	eb ea                	jmp    8041eb <devpipe_read+0xd2>
+
+0000000000804201 <pipe>:
+pipe(int pfd[2]) {
+  804201:	55                   	push   %rbp
+  804202:	48 89 e5             	mov    %rsp,%rbp
+  804205:	41 55                	push   %r13
+  804207:	41 54                	push   %r12
+  804209:	53                   	push   %rbx
+  80420a:	48 83 ec 18          	sub    $0x18,%rsp
+  80420e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804211:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804215:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  80421c:	00 00 00 
+  80421f:	ff d0                	call   *%rax
+  804221:	89 c3                	mov    %eax,%ebx
+  804223:	85 c0                	test   %eax,%eax
+  804225:	0f 88 a0 01 00 00    	js     8043cb <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80422b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804230:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804235:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80423e:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  804245:	00 00 00 
+  804248:	ff d0                	call   *%rax
+  80424a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80424c:	85 c0                	test   %eax,%eax
+  80424e:	0f 88 77 01 00 00    	js     8043cb <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804254:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804258:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  80425f:	00 00 00 
+  804262:	ff d0                	call   *%rax
+  804264:	89 c3                	mov    %eax,%ebx
+  804266:	85 c0                	test   %eax,%eax
+  804268:	0f 88 43 01 00 00    	js     8043b1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80426e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804273:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804278:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80427c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804281:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  804288:	00 00 00 
+  80428b:	ff d0                	call   *%rax
+  80428d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80428f:	85 c0                	test   %eax,%eax
+  804291:	0f 88 1a 01 00 00    	js     8043b1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804297:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80429b:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  8042a2:	00 00 00 
+  8042a5:	ff d0                	call   *%rax
+  8042a7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8042aa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042b4:	48 89 c6             	mov    %rax,%rsi
+  8042b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042bc:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  8042c3:	00 00 00 
+  8042c6:	ff d0                	call   *%rax
+  8042c8:	89 c3                	mov    %eax,%ebx
+  8042ca:	85 c0                	test   %eax,%eax
+  8042cc:	0f 88 c5 00 00 00    	js     804397 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8042d2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8042d6:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+  8042e2:	48 89 c1             	mov    %rax,%rcx
+  8042e5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8042eb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8042f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042f6:	4c 89 ee             	mov    %r13,%rsi
+  8042f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042fe:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  804305:	00 00 00 
+  804308:	ff d0                	call   *%rax
+  80430a:	89 c3                	mov    %eax,%ebx
+  80430c:	85 c0                	test   %eax,%eax
+  80430e:	78 6e                	js     80437e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804310:	be 00 10 00 00       	mov    $0x1000,%esi
+  804315:	4c 89 ef             	mov    %r13,%rdi
+  804318:	48 b8 6c 27 80 00 00 	movabs $0x80276c,%rax
+  80431f:	00 00 00 
+  804322:	ff d0                	call   *%rax
+  804324:	83 f8 02             	cmp    $0x2,%eax
+  804327:	0f 85 ab 00 00 00    	jne    8043d8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80432d:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804334:	00 00 
+  804336:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80433a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80433c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804340:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804347:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80434b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80434d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804351:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804358:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80435c:	48 bb e6 2f 80 00 00 	movabs $0x802fe6,%rbx
+  804363:	00 00 00 
+  804366:	ff d3                	call   *%rbx
+  804368:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80436c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804370:	ff d3                	call   *%rbx
+  804372:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804377:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80437c:	eb 4d                	jmp    8043cb <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80437e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804383:	4c 89 ee             	mov    %r13,%rsi
+  804386:	bf 00 00 00 00       	mov    $0x0,%edi
+  80438b:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  804392:	00 00 00 
+  804395:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804397:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80439c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a5:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  8043ac:	00 00 00 
+  8043af:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8043b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043bf:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  8043c6:	00 00 00 
+  8043c9:	ff d0                	call   *%rax
+}
+  8043cb:	89 d8                	mov    %ebx,%eax
+  8043cd:	48 83 c4 18          	add    $0x18,%rsp
+  8043d1:	5b                   	pop    %rbx
+  8043d2:	41 5c                	pop    %r12
+  8043d4:	41 5d                	pop    %r13
+  8043d6:	5d                   	pop    %rbp
+  8043d7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043d8:	48 b9 08 66 80 00 00 	movabs $0x806608,%rcx
+  8043df:	00 00 00 
+  8043e2:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  8043e9:	00 00 00 
+  8043ec:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8043f1:	48 bf f7 65 80 00 00 	movabs $0x8065f7,%rdi
+  8043f8:	00 00 00 
+  8043fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804400:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  804407:	00 00 00 
+  80440a:	41 ff d0             	call   *%r8
+
+000000000080440d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80440d:	55                   	push   %rbp
+  80440e:	48 89 e5             	mov    %rsp,%rbp
+  804411:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804415:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804419:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  804420:	00 00 00 
+  804423:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804425:	85 c0                	test   %eax,%eax
+  804427:	78 35                	js     80445e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804429:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80442d:	48 b8 f8 2f 80 00 00 	movabs $0x802ff8,%rax
+  804434:	00 00 00 
+  804437:	ff d0                	call   *%rax
+  804439:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80443c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804441:	be 00 10 00 00       	mov    $0x1000,%esi
+  804446:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80444a:	48 b8 a4 27 80 00 00 	movabs $0x8027a4,%rax
+  804451:	00 00 00 
+  804454:	ff d0                	call   *%rax
+  804456:	85 c0                	test   %eax,%eax
+  804458:	0f 94 c0             	sete   %al
+  80445b:	0f b6 c0             	movzbl %al,%eax
+}
+  80445e:	c9                   	leave
+  80445f:	c3                   	ret
+
+0000000000804460 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804460:	48 89 f8             	mov    %rdi,%rax
+  804463:	48 c1 e8 27          	shr    $0x27,%rax
+  804467:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80446e:	01 00 00 
+  804471:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804475:	f6 c2 01             	test   $0x1,%dl
+  804478:	74 6d                	je     8044e7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80447a:	48 89 f8             	mov    %rdi,%rax
+  80447d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804481:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804488:	01 00 00 
+  80448b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80448f:	f6 c2 01             	test   $0x1,%dl
+  804492:	74 62                	je     8044f6 <get_uvpt_entry+0x96>
+  804494:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80449b:	01 00 00 
+  80449e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044a2:	f6 c2 80             	test   $0x80,%dl
+  8044a5:	75 4f                	jne    8044f6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044a7:	48 89 f8             	mov    %rdi,%rax
+  8044aa:	48 c1 e8 15          	shr    $0x15,%rax
+  8044ae:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044b5:	01 00 00 
+  8044b8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044bc:	f6 c2 01             	test   $0x1,%dl
+  8044bf:	74 44                	je     804505 <get_uvpt_entry+0xa5>
+  8044c1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044c8:	01 00 00 
+  8044cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044cf:	f6 c2 80             	test   $0x80,%dl
+  8044d2:	75 31                	jne    804505 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8044d4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8044d8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8044df:	01 00 00 
+  8044e2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8044e6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044e7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044ee:	01 00 00 
+  8044f1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044f5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044f6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044fd:	01 00 00 
+  804500:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804504:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804505:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80450c:	01 00 00 
+  80450f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804513:	c3                   	ret
+
+0000000000804514 <get_prot>:
+
+int
+get_prot(void *va) {
+  804514:	55                   	push   %rbp
+  804515:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804518:	48 b8 60 44 80 00 00 	movabs $0x804460,%rax
+  80451f:	00 00 00 
+  804522:	ff d0                	call   *%rax
+  804524:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804527:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80452c:	89 c1                	mov    %eax,%ecx
+  80452e:	83 c9 04             	or     $0x4,%ecx
+  804531:	f6 c2 01             	test   $0x1,%dl
+  804534:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804537:	89 c1                	mov    %eax,%ecx
+  804539:	83 c9 02             	or     $0x2,%ecx
+  80453c:	f6 c2 02             	test   $0x2,%dl
+  80453f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804542:	89 c1                	mov    %eax,%ecx
+  804544:	83 c9 01             	or     $0x1,%ecx
+  804547:	48 85 d2             	test   %rdx,%rdx
+  80454a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80454d:	89 c1                	mov    %eax,%ecx
+  80454f:	83 c9 40             	or     $0x40,%ecx
+  804552:	f6 c6 04             	test   $0x4,%dh
+  804555:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804558:	5d                   	pop    %rbp
+  804559:	c3                   	ret
+
+000000000080455a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80455a:	55                   	push   %rbp
+  80455b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80455e:	48 b8 60 44 80 00 00 	movabs $0x804460,%rax
+  804565:	00 00 00 
+  804568:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80456a:	48 c1 e8 06          	shr    $0x6,%rax
+  80456e:	83 e0 01             	and    $0x1,%eax
+}
+  804571:	5d                   	pop    %rbp
+  804572:	c3                   	ret
+
+0000000000804573 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804573:	55                   	push   %rbp
+  804574:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804577:	48 b8 60 44 80 00 00 	movabs $0x804460,%rax
+  80457e:	00 00 00 
+  804581:	ff d0                	call   *%rax
+  804583:	83 e0 01             	and    $0x1,%eax
+}
+  804586:	5d                   	pop    %rbp
+  804587:	c3                   	ret
+
+0000000000804588 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804588:	55                   	push   %rbp
+  804589:	48 89 e5             	mov    %rsp,%rbp
+  80458c:	41 57                	push   %r15
+  80458e:	41 56                	push   %r14
+  804590:	41 55                	push   %r13
+  804592:	41 54                	push   %r12
+  804594:	53                   	push   %rbx
+  804595:	48 83 ec 28          	sub    $0x28,%rsp
+  804599:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80459d:	48 85 ff             	test   %rdi,%rdi
+  8045a0:	74 1e                	je     8045c0 <foreach_shared_region+0x38>
+  8045a2:	49 89 ff             	mov    %rdi,%r15
+  8045a5:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8045ab:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8045b1:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8045b8:	01 00 00 
+  8045bb:	e9 72 02 00 00       	jmp    804832 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8045c0:	48 b9 2c 66 80 00 00 	movabs $0x80662c,%rcx
+  8045c7:	00 00 00 
+  8045ca:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  8045d1:	00 00 00 
+  8045d4:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8045d9:	48 bf 30 66 80 00 00 	movabs $0x806630,%rdi
+  8045e0:	00 00 00 
+  8045e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e8:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  8045ef:	00 00 00 
+  8045f2:	41 ff d0             	call   *%r8
+  8045f5:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8045fc:	eb 6c                	jmp    80466a <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8045fe:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804605:	ff ff ff 
+  804608:	4c 21 e2             	and    %r12,%rdx
+  80460b:	48 89 d8             	mov    %rbx,%rax
+  80460e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804613:	48 83 c0 01          	add    $0x1,%rax
+  804617:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80461b:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804622:	00 00 00 
+  804625:	48 21 c8             	and    %rcx,%rax
+  804628:	48 09 d0             	or     %rdx,%rax
+  80462b:	49 89 c4             	mov    %rax,%r12
+  80462e:	eb 30                	jmp    804660 <foreach_shared_region+0xd8>
+  804630:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804637:	ff ff ff 
+  80463a:	4c 21 e2             	and    %r12,%rdx
+  80463d:	48 89 d8             	mov    %rbx,%rax
+  804640:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804645:	48 83 c0 01          	add    $0x1,%rax
+  804649:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80464d:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804654:	00 00 00 
+  804657:	48 21 c8             	and    %rcx,%rax
+  80465a:	48 09 d0             	or     %rdx,%rax
+  80465d:	49 89 c4             	mov    %rax,%r12
+  804660:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804664:	0f 84 99 01 00 00    	je     804803 <foreach_shared_region+0x27b>
+  80466a:	4c 89 e3             	mov    %r12,%rbx
+  80466d:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804671:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804678:	01 00 00 
+  80467b:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80467f:	a8 01                	test   $0x1,%al
+  804681:	0f 84 77 ff ff ff    	je     8045fe <foreach_shared_region+0x76>
+  804687:	a8 80                	test   $0x80,%al
+  804689:	74 19                	je     8046a4 <foreach_shared_region+0x11c>
+  80468b:	f6 c4 04             	test   $0x4,%ah
+  80468e:	74 a0                	je     804630 <foreach_shared_region+0xa8>
+  804690:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804697:	40 
+  804698:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80469c:	4c 89 e7             	mov    %r12,%rdi
+  80469f:	41 ff d7             	call   *%r15
+  8046a2:	eb 8c                	jmp    804630 <foreach_shared_region+0xa8>
+  8046a4:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8046ab:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8046af:	eb 46                	jmp    8046f7 <foreach_shared_region+0x16f>
+  8046b1:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8046b8:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046be:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8046c2:	48 c1 e0 15          	shl    $0x15,%rax
+  8046c6:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8046cb:	49 09 c4             	or     %rax,%r12
+  8046ce:	eb 1d                	jmp    8046ed <foreach_shared_region+0x165>
+  8046d0:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8046d7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046dd:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8046e1:	48 c1 e0 15          	shl    $0x15,%rax
+  8046e5:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8046ea:	49 09 c4             	or     %rax,%r12
+  8046ed:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8046f1:	0f 84 d3 00 00 00    	je     8047ca <foreach_shared_region+0x242>
+  8046f7:	4c 89 e3             	mov    %r12,%rbx
+  8046fa:	48 c1 eb 15          	shr    $0x15,%rbx
+  8046fe:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804705:	01 00 00 
+  804708:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80470c:	a8 01                	test   $0x1,%al
+  80470e:	74 a1                	je     8046b1 <foreach_shared_region+0x129>
+  804710:	a8 80                	test   $0x80,%al
+  804712:	74 19                	je     80472d <foreach_shared_region+0x1a5>
+  804714:	f6 c4 04             	test   $0x4,%ah
+  804717:	74 b7                	je     8046d0 <foreach_shared_region+0x148>
+  804719:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804720:	00 
+  804721:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804725:	4c 89 e7             	mov    %r12,%rdi
+  804728:	41 ff d7             	call   *%r15
+  80472b:	eb a3                	jmp    8046d0 <foreach_shared_region+0x148>
+  80472d:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804733:	eb 3b                	jmp    804770 <foreach_shared_region+0x1e8>
+  804735:	f6 c4 04             	test   $0x4,%ah
+  804738:	74 12                	je     80474c <foreach_shared_region+0x1c4>
+  80473a:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804741:	00 
+  804742:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804746:	4c 89 e7             	mov    %r12,%rdi
+  804749:	41 ff d7             	call   *%r15
+  80474c:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804753:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804759:	48 83 c3 01          	add    $0x1,%rbx
+  80475d:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804761:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804767:	49 09 dc             	or     %rbx,%r12
+  80476a:	41 83 ed 01          	sub    $0x1,%r13d
+  80476e:	74 2f                	je     80479f <foreach_shared_region+0x217>
+  804770:	4c 89 e3             	mov    %r12,%rbx
+  804773:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804777:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80477b:	a8 01                	test   $0x1,%al
+  80477d:	75 b6                	jne    804735 <foreach_shared_region+0x1ad>
+  80477f:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804786:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80478c:	48 83 c3 01          	add    $0x1,%rbx
+  804790:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804794:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80479a:	49 09 dc             	or     %rbx,%r12
+  80479d:	eb cb                	jmp    80476a <foreach_shared_region+0x1e2>
+  80479f:	4c 89 e0             	mov    %r12,%rax
+  8047a2:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8047a8:	49 c1 ec 15          	shr    $0x15,%r12
+  8047ac:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047b3:	49 83 c4 01          	add    $0x1,%r12
+  8047b7:	49 c1 e4 15          	shl    $0x15,%r12
+  8047bb:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8047c2:	49 09 c4             	or     %rax,%r12
+  8047c5:	e9 23 ff ff ff       	jmp    8046ed <foreach_shared_region+0x165>
+  8047ca:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8047ce:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8047d5:	ff ff ff 
+  8047d8:	4c 21 e0             	and    %r12,%rax
+  8047db:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8047df:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8047e6:	49 83 c4 01          	add    $0x1,%r12
+  8047ea:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8047ee:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8047f5:	00 00 00 
+  8047f8:	49 21 d4             	and    %rdx,%r12
+  8047fb:	49 09 c4             	or     %rax,%r12
+  8047fe:	e9 5d fe ff ff       	jmp    804660 <foreach_shared_region+0xd8>
+  804803:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80480a:	00 ff ff 
+  80480d:	4c 21 e0             	and    %r12,%rax
+  804810:	49 c1 ec 27          	shr    $0x27,%r12
+  804814:	49 83 c4 01          	add    $0x1,%r12
+  804818:	49 c1 e4 27          	shl    $0x27,%r12
+  80481c:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804823:	ff 00 00 
+  804826:	49 21 d4             	and    %rdx,%r12
+  804829:	49 09 c4             	or     %rax,%r12
+  80482c:	41 83 ed 01          	sub    $0x1,%r13d
+  804830:	74 48                	je     80487a <foreach_shared_region+0x2f2>
+  804832:	4c 89 e0             	mov    %r12,%rax
+  804835:	48 c1 e8 27          	shr    $0x27,%rax
+  804839:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804840:	01 00 00 
+  804843:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804847:	f6 c2 01             	test   $0x1,%dl
+  80484a:	0f 85 a5 fd ff ff    	jne    8045f5 <foreach_shared_region+0x6d>
+  804850:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804857:	00 ff ff 
+  80485a:	4c 21 e2             	and    %r12,%rdx
+  80485d:	48 83 c0 01          	add    $0x1,%rax
+  804861:	48 c1 e0 27          	shl    $0x27,%rax
+  804865:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80486c:	ff 00 00 
+  80486f:	48 21 c8             	and    %rcx,%rax
+  804872:	48 09 d0             	or     %rdx,%rax
+  804875:	49 89 c4             	mov    %rax,%r12
+  804878:	eb b2                	jmp    80482c <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80487a:	4d 85 e4             	test   %r12,%r12
+  80487d:	75 14                	jne    804893 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80487f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804884:	48 83 c4 28          	add    $0x28,%rsp
+  804888:	5b                   	pop    %rbx
+  804889:	41 5c                	pop    %r12
+  80488b:	41 5d                	pop    %r13
+  80488d:	41 5e                	pop    %r14
+  80488f:	41 5f                	pop    %r15
+  804891:	5d                   	pop    %rbp
+  804892:	c3                   	ret
+    assert(addr == 0);
+  804893:	48 b9 3b 66 80 00 00 	movabs $0x80663b,%rcx
+  80489a:	00 00 00 
+  80489d:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  8048a4:	00 00 00 
+  8048a7:	be 67 00 00 00       	mov    $0x67,%esi
+  8048ac:	48 bf 30 66 80 00 00 	movabs $0x806630,%rdi
+  8048b3:	00 00 00 
+  8048b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bb:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  8048c2:	00 00 00 
+  8048c5:	41 ff d0             	call   *%r8
+
+00000000008048c8 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8048c8:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8048cf:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8048d2:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8048d8:	eb 33                	jmp    80490d <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048da:	48 83 c0 20          	add    $0x20,%rax
+  8048de:	4c 39 c0             	cmp    %r8,%rax
+  8048e1:	74 25                	je     804908 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8048e3:	48 8b 10             	mov    (%rax),%rdx
+  8048e6:	48 85 d2             	test   %rdx,%rdx
+  8048e9:	74 ef                	je     8048da <mmap_place+0x12>
+  8048eb:	48 89 d1             	mov    %rdx,%rcx
+  8048ee:	48 03 48 08          	add    0x8(%rax),%rcx
+  8048f2:	48 39 cf             	cmp    %rcx,%rdi
+  8048f5:	73 e3                	jae    8048da <mmap_place+0x12>
+  8048f7:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8048fb:	4c 39 ca             	cmp    %r9,%rdx
+  8048fe:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804902:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804906:	eb d2                	jmp    8048da <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804908:	45 84 d2             	test   %r10b,%r10b
+  80490b:	74 12                	je     80491f <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80490d:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804914:	00 00 00 
+        moved = 0;
+  804917:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80491d:	eb c4                	jmp    8048e3 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  80491f:	48 01 fe             	add    %rdi,%rsi
+  804922:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804929:	00 00 00 
+  80492c:	48 39 f0             	cmp    %rsi,%rax
+  80492f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804934:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804938:	c3                   	ret
+
+0000000000804939 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804939:	55                   	push   %rbp
+  80493a:	48 89 e5             	mov    %rsp,%rbp
+  80493d:	41 57                	push   %r15
+  80493f:	41 56                	push   %r14
+  804941:	41 55                	push   %r13
+  804943:	41 54                	push   %r12
+  804945:	53                   	push   %rbx
+  804946:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80494a:	48 8b 1f             	mov    (%rdi),%rbx
+  80494d:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804954:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80495b:	00 00 00 
+  80495e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804963:	eb 12                	jmp    804977 <mmap_pgfault+0x3e>
+  804965:	48 83 c2 01          	add    $0x1,%rdx
+  804969:	48 83 c0 20          	add    $0x20,%rax
+  80496d:	48 83 fa 20          	cmp    $0x20,%rdx
+  804971:	0f 84 04 01 00 00    	je     804a7b <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804977:	48 8b 08             	mov    (%rax),%rcx
+  80497a:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  80497e:	48 39 de             	cmp    %rbx,%rsi
+  804981:	73 e2                	jae    804965 <mmap_pgfault+0x2c>
+  804983:	48 03 48 08          	add    0x8(%rax),%rcx
+  804987:	48 39 cb             	cmp    %rcx,%rbx
+  80498a:	73 d9                	jae    804965 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  80498c:	48 c1 e2 05          	shl    $0x5,%rdx
+  804990:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804997:	00 00 00 
+  80499a:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  80499e:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8049a2:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8049a6:	f6 c2 01             	test   $0x1,%dl
+  8049a9:	0f 84 e0 00 00 00    	je     804a8f <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8049af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b4:	f6 c2 02             	test   $0x2,%dl
+  8049b7:	0f 84 c3 00 00 00    	je     804a80 <mmap_pgfault+0x147>
+  8049bd:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8049c4:	ff ff ff 
+  8049c7:	48 23 56 10          	and    0x10(%rsi),%rdx
+  8049cb:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  8049d2:	00 00 00 
+  8049d5:	48 39 ca             	cmp    %rcx,%rdx
+  8049d8:	0f 85 a2 00 00 00    	jne    804a80 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8049de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8049e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049e8:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8049ef:	00 00 00 
+  8049f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049f7:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  8049fe:	00 00 00 
+  804a01:	ff d0                	call   *%rax
+  804a03:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804a05:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a0a:	85 d2                	test   %edx,%edx
+  804a0c:	78 72                	js     804a80 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a13:	48 89 de             	mov    %rbx,%rsi
+  804a16:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804a1d:	00 00 00 
+  804a20:	4c 89 e7             	mov    %r12,%rdi
+  804a23:	48 b8 28 24 80 00 00 	movabs $0x802428,%rax
+  804a2a:	00 00 00 
+  804a2d:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804a2f:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804a35:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a3b:	48 89 d9             	mov    %rbx,%rcx
+  804a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a43:	4c 89 e6             	mov    %r12,%rsi
+  804a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a4b:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  804a52:	00 00 00 
+  804a55:	ff d0                	call   *%rax
+  804a57:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804a59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a5e:	4c 89 e6             	mov    %r12,%rsi
+  804a61:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a66:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  804a6d:	00 00 00 
+  804a70:	ff d0                	call   *%rax
+    return res >= 0;
+  804a72:	89 d8                	mov    %ebx,%eax
+  804a74:	f7 d0                	not    %eax
+  804a76:	c1 e8 1f             	shr    $0x1f,%eax
+  804a79:	eb 05                	jmp    804a80 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804a7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804a80:	48 83 c4 18          	add    $0x18,%rsp
+  804a84:	5b                   	pop    %rbx
+  804a85:	41 5c                	pop    %r12
+  804a87:	41 5d                	pop    %r13
+  804a89:	41 5e                	pop    %r14
+  804a8b:	41 5f                	pop    %r15
+  804a8d:	5d                   	pop    %rbp
+  804a8e:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804a8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a93:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804a97:	4c 03 30             	add    (%rax),%r14
+  804a9a:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804aa1:	49 39 c6             	cmp    %rax,%r14
+  804aa4:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804aa8:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804aaf:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ab5:	49 bf 73 45 80 00 00 	movabs $0x804573,%r15
+  804abc:	00 00 00 
+  804abf:	4d 39 f4             	cmp    %r14,%r12
+  804ac2:	73 1d                	jae    804ae1 <mmap_pgfault+0x1a8>
+  804ac4:	4c 89 e7             	mov    %r12,%rdi
+  804ac7:	41 ff d7             	call   *%r15
+  804aca:	84 c0                	test   %al,%al
+  804acc:	75 13                	jne    804ae1 <mmap_pgfault+0x1a8>
+  804ace:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804ad5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804adc:	4d 39 f4             	cmp    %r14,%r12
+  804adf:	72 e3                	jb     804ac4 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804ae1:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804ae7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aeb:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804aef:	74 2a                	je     804b1b <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804af1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804af5:	89 de                	mov    %ebx,%esi
+  804af7:	2b 30                	sub    (%rax),%esi
+  804af9:	03 70 1c             	add    0x1c(%rax),%esi
+  804afc:	8b 78 18             	mov    0x18(%rax),%edi
+  804aff:	4c 89 e9             	mov    %r13,%rcx
+  804b02:	48 89 da             	mov    %rbx,%rdx
+  804b05:	48 b8 d1 3c 80 00 00 	movabs $0x803cd1,%rax
+  804b0c:	00 00 00 
+  804b0f:	ff d0                	call   *%rax
+    return res > 0;
+  804b11:	85 c0                	test   %eax,%eax
+  804b13:	0f 9f c0             	setg   %al
+  804b16:	e9 65 ff ff ff       	jmp    804a80 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804b1b:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804b1f:	eb d0                	jmp    804af1 <mmap_pgfault+0x1b8>
+
+0000000000804b21 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804b21:	55                   	push   %rbp
+  804b22:	48 89 e5             	mov    %rsp,%rbp
+  804b25:	41 57                	push   %r15
+  804b27:	41 56                	push   %r14
+  804b29:	41 55                	push   %r13
+  804b2b:	41 54                	push   %r12
+  804b2d:	53                   	push   %rbx
+  804b2e:	48 83 ec 28          	sub    $0x28,%rsp
+  804b32:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804b36:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804b39:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b40:	ff ff ff 
+  804b43:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b4c:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804b53:	00 00 00 
+  804b56:	48 39 ca             	cmp    %rcx,%rdx
+  804b59:	0f 85 e5 00 00 00    	jne    804c44 <mmap_writeback+0x123>
+  804b5f:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804b62:	4c 39 ee             	cmp    %r13,%rsi
+  804b65:	0f 83 e8 00 00 00    	jae    804c53 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b6b:	49 be 73 45 80 00 00 	movabs $0x804573,%r14
+  804b72:	00 00 00 
+  804b75:	49 bf 5a 45 80 00 00 	movabs $0x80455a,%r15
+  804b7c:	00 00 00 
+  804b7f:	eb 10                	jmp    804b91 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804b81:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804b88:	4d 39 ec             	cmp    %r13,%r12
+  804b8b:	0f 83 ae 00 00 00    	jae    804c3f <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804b91:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804b95:	4c 89 e7             	mov    %r12,%rdi
+  804b98:	41 ff d6             	call   *%r14
+  804b9b:	84 c0                	test   %al,%al
+  804b9d:	74 e2                	je     804b81 <mmap_writeback+0x60>
+  804b9f:	4c 89 e7             	mov    %r12,%rdi
+  804ba2:	41 ff d7             	call   *%r15
+  804ba5:	84 c0                	test   %al,%al
+  804ba7:	74 d8                	je     804b81 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804ba9:	4c 89 e3             	mov    %r12,%rbx
+  804bac:	4d 39 ec             	cmp    %r13,%r12
+  804baf:	73 20                	jae    804bd1 <mmap_writeback+0xb0>
+  804bb1:	48 89 df             	mov    %rbx,%rdi
+  804bb4:	41 ff d6             	call   *%r14
+  804bb7:	84 c0                	test   %al,%al
+  804bb9:	74 16                	je     804bd1 <mmap_writeback+0xb0>
+  804bbb:	48 89 df             	mov    %rbx,%rdi
+  804bbe:	41 ff d7             	call   *%r15
+  804bc1:	84 c0                	test   %al,%al
+  804bc3:	74 0c                	je     804bd1 <mmap_writeback+0xb0>
+  804bc5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804bcc:	4c 39 eb             	cmp    %r13,%rbx
+  804bcf:	72 e0                	jb     804bb1 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804bd1:	48 89 d9             	mov    %rbx,%rcx
+  804bd4:	4c 29 e1             	sub    %r12,%rcx
+  804bd7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804bdb:	44 89 e6             	mov    %r12d,%esi
+  804bde:	2b 30                	sub    (%rax),%esi
+  804be0:	49 89 c4             	mov    %rax,%r12
+  804be3:	03 70 1c             	add    0x1c(%rax),%esi
+  804be6:	8b 78 18             	mov    0x18(%rax),%edi
+  804be9:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804bed:	48 89 ca             	mov    %rcx,%rdx
+  804bf0:	48 b8 5a 3d 80 00 00 	movabs $0x803d5a,%rax
+  804bf7:	00 00 00 
+  804bfa:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804bfc:	85 c0                	test   %eax,%eax
+  804bfe:	78 44                	js     804c44 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804c00:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804c05:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804c08:	41 89 c1             	mov    %eax,%r9d
+  804c0b:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804c12:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804c16:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804c1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c1f:	48 89 ce             	mov    %rcx,%rsi
+  804c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c27:	48 b8 43 28 80 00 00 	movabs $0x802843,%rax
+  804c2e:	00 00 00 
+  804c31:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804c33:	85 c0                	test   %eax,%eax
+  804c35:	78 0d                	js     804c44 <mmap_writeback+0x123>
+  804c37:	49 89 dc             	mov    %rbx,%r12
+  804c3a:	e9 49 ff ff ff       	jmp    804b88 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c44:	48 83 c4 28          	add    $0x28,%rsp
+  804c48:	5b                   	pop    %rbx
+  804c49:	41 5c                	pop    %r12
+  804c4b:	41 5d                	pop    %r13
+  804c4d:	41 5e                	pop    %r14
+  804c4f:	41 5f                	pop    %r15
+  804c51:	5d                   	pop    %rbp
+  804c52:	c3                   	ret
+    return 0;
+  804c53:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c58:	eb ea                	jmp    804c44 <mmap_writeback+0x123>
+
+0000000000804c5a <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804c5a:	55                   	push   %rbp
+  804c5b:	48 89 e5             	mov    %rsp,%rbp
+  804c5e:	41 57                	push   %r15
+  804c60:	41 56                	push   %r14
+  804c62:	41 55                	push   %r13
+  804c64:	41 54                	push   %r12
+  804c66:	53                   	push   %rbx
+  804c67:	48 83 ec 38          	sub    $0x38,%rsp
+  804c6b:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804c6f:	48 85 f6             	test   %rsi,%rsi
+  804c72:	0f 84 0c 02 00 00    	je     804e84 <mmap+0x22a>
+  804c78:	49 89 ff             	mov    %rdi,%r15
+  804c7b:	49 89 f4             	mov    %rsi,%r12
+  804c7e:	41 89 d5             	mov    %edx,%r13d
+  804c81:	41 89 ce             	mov    %ecx,%r14d
+  804c84:	44 89 cb             	mov    %r9d,%ebx
+  804c87:	45 85 c9             	test   %r9d,%r9d
+  804c8a:	0f 88 f4 01 00 00    	js     804e84 <mmap+0x22a>
+  804c90:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c97:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804c9e:	0f 85 e7 01 00 00    	jne    804e8b <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804ca4:	83 e2 fd             	and    $0xfffffffd,%edx
+  804ca7:	83 fa 04             	cmp    $0x4,%edx
+  804caa:	0f 85 db 01 00 00    	jne    804e8b <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804cb0:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804cb3:	83 fa 01             	cmp    $0x1,%edx
+  804cb6:	0f 87 cf 01 00 00    	ja     804e8b <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804cbc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804cc0:	44 89 c7             	mov    %r8d,%edi
+  804cc3:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  804cca:	00 00 00 
+  804ccd:	ff d0                	call   *%rax
+  804ccf:	89 c2                	mov    %eax,%edx
+  804cd1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cd8:	85 d2                	test   %edx,%edx
+  804cda:	0f 88 ab 01 00 00    	js     804e8b <mmap+0x231>
+  804ce0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ce4:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804ceb:	00 00 00 
+  804cee:	8b 09                	mov    (%rcx),%ecx
+  804cf0:	39 0a                	cmp    %ecx,(%rdx)
+  804cf2:	0f 85 93 01 00 00    	jne    804e8b <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804cf8:	8b 52 08             	mov    0x8(%rdx),%edx
+  804cfb:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804cfe:	83 fa 01             	cmp    $0x1,%edx
+  804d01:	0f 84 84 01 00 00    	je     804e8b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d07:	41 83 fe 01          	cmp    $0x1,%r14d
+  804d0b:	74 42                	je     804d4f <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804d0d:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804d14:	4c 89 e6             	mov    %r12,%rsi
+  804d17:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804d1e:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804d22:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804d26:	4d 85 ff             	test   %r15,%r15
+  804d29:	74 67                	je     804d92 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d2b:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804d32:	75 0f                	jne    804d43 <mmap+0xe9>
+  804d34:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804d3b:	00 00 00 
+  804d3e:	49 39 c7             	cmp    %rax,%r15
+  804d41:	77 1b                	ja     804d5e <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d43:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d4a:	e9 3c 01 00 00       	jmp    804e8b <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804d4f:	41 f6 c5 02          	test   $0x2,%r13b
+  804d53:	74 b8                	je     804d0d <mmap+0xb3>
+  804d55:	85 d2                	test   %edx,%edx
+  804d57:	75 b4                	jne    804d0d <mmap+0xb3>
+  804d59:	e9 2d 01 00 00       	jmp    804e8b <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804d5e:	4c 89 ff             	mov    %r15,%rdi
+  804d61:	48 b8 c8 48 80 00 00 	movabs $0x8048c8,%rax
+  804d68:	00 00 00 
+  804d6b:	ff d0                	call   *%rax
+  804d6d:	48 89 c2             	mov    %rax,%rdx
+  804d70:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804d77:	49 39 d7             	cmp    %rdx,%r15
+  804d7a:	0f 85 0b 01 00 00    	jne    804e8b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d80:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d87:	00 00 00 
+  804d8a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d90:	eb 44                	jmp    804dd6 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d92:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804d96:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804d9d:	00 00 00 
+  804da0:	48 b8 c8 48 80 00 00 	movabs $0x8048c8,%rax
+  804da7:	00 00 00 
+  804daa:	ff d0                	call   *%rax
+  804dac:	48 89 c7             	mov    %rax,%rdi
+  804daf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804db3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804dba:	48 85 ff             	test   %rdi,%rdi
+  804dbd:	75 c1                	jne    804d80 <mmap+0x126>
+  804dbf:	e9 c7 00 00 00       	jmp    804e8b <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804dc4:	49 83 c4 01          	add    $0x1,%r12
+  804dc8:	48 83 c0 20          	add    $0x20,%rax
+  804dcc:	49 83 fc 20          	cmp    $0x20,%r12
+  804dd0:	0f 84 a5 00 00 00    	je     804e7b <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804dd6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804dda:	75 e8                	jne    804dc4 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804ddc:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804de0:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  804de7:	00 00 00 
+  804dea:	ff d0                	call   *%rax
+  804dec:	89 c2                	mov    %eax,%edx
+  804dee:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804df5:	85 d2                	test   %edx,%edx
+  804df7:	0f 88 8e 00 00 00    	js     804e8b <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804dfd:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804e01:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  804e08:	00 00 00 
+  804e0b:	ff d0                	call   *%rax
+  804e0d:	89 c6                	mov    %eax,%esi
+  804e0f:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804e12:	48 b8 34 32 80 00 00 	movabs $0x803234,%rax
+  804e19:	00 00 00 
+  804e1c:	ff d0                	call   *%rax
+  804e1e:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804e21:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e28:	45 85 ff             	test   %r15d,%r15d
+  804e2b:	78 5e                	js     804e8b <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804e2d:	49 c1 e4 05          	shl    $0x5,%r12
+  804e31:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e38:	00 00 00 
+  804e3b:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804e3e:	48 bf 39 49 80 00 00 	movabs $0x804939,%rdi
+  804e45:	00 00 00 
+  804e48:	48 b8 07 54 80 00 00 	movabs $0x805407,%rax
+  804e4f:	00 00 00 
+  804e52:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804e54:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e58:	49 89 04 24          	mov    %rax,(%r12)
+  804e5c:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804e60:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804e65:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804e6a:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804e6f:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804e74:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804e79:	eb 10                	jmp    804e8b <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804e7b:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e82:	eb 07                	jmp    804e8b <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804e84:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804e8b:	48 83 c4 38          	add    $0x38,%rsp
+  804e8f:	5b                   	pop    %rbx
+  804e90:	41 5c                	pop    %r12
+  804e92:	41 5d                	pop    %r13
+  804e94:	41 5e                	pop    %r14
+  804e96:	41 5f                	pop    %r15
+  804e98:	5d                   	pop    %rbp
+  804e99:	c3                   	ret
+
+0000000000804e9a <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804e9a:	55                   	push   %rbp
+  804e9b:	48 89 e5             	mov    %rsp,%rbp
+  804e9e:	41 57                	push   %r15
+  804ea0:	41 56                	push   %r14
+  804ea2:	41 55                	push   %r13
+  804ea4:	41 54                	push   %r12
+  804ea6:	53                   	push   %rbx
+  804ea7:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804eab:	49 89 fe             	mov    %rdi,%r14
+  804eae:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804eb5:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804ebc:	00 
+  804ebd:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ec4:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804ecb:	00 00 00 
+  804ece:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804ed5:	49 bf 21 4b 80 00 00 	movabs $0x804b21,%r15
+  804edc:	00 00 00 
+  804edf:	eb 09                	jmp    804eea <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ee1:	48 83 c3 20          	add    $0x20,%rbx
+  804ee5:	4c 39 eb             	cmp    %r13,%rbx
+  804ee8:	74 33                	je     804f1d <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804eea:	48 89 df             	mov    %rbx,%rdi
+  804eed:	48 8b 33             	mov    (%rbx),%rsi
+  804ef0:	4c 39 e6             	cmp    %r12,%rsi
+  804ef3:	73 ec                	jae    804ee1 <msync+0x47>
+  804ef5:	48 85 f6             	test   %rsi,%rsi
+  804ef8:	74 e7                	je     804ee1 <msync+0x47>
+  804efa:	48 89 f2             	mov    %rsi,%rdx
+  804efd:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f01:	49 39 d6             	cmp    %rdx,%r14
+  804f04:	73 db                	jae    804ee1 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804f06:	4c 39 e2             	cmp    %r12,%rdx
+  804f09:	49 0f 47 d4          	cmova  %r12,%rdx
+  804f0d:	4c 39 f6             	cmp    %r14,%rsi
+  804f10:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804f14:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804f17:	85 c0                	test   %eax,%eax
+  804f19:	79 c6                	jns    804ee1 <msync+0x47>
+  804f1b:	eb 05                	jmp    804f22 <msync+0x88>
+    }
+
+    return 0;
+  804f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f22:	48 83 c4 08          	add    $0x8,%rsp
+  804f26:	5b                   	pop    %rbx
+  804f27:	41 5c                	pop    %r12
+  804f29:	41 5d                	pop    %r13
+  804f2b:	41 5e                	pop    %r14
+  804f2d:	41 5f                	pop    %r15
+  804f2f:	5d                   	pop    %rbp
+  804f30:	c3                   	ret
+
+0000000000804f31 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804f31:	55                   	push   %rbp
+  804f32:	48 89 e5             	mov    %rsp,%rbp
+  804f35:	41 57                	push   %r15
+  804f37:	41 56                	push   %r14
+  804f39:	41 55                	push   %r13
+  804f3b:	41 54                	push   %r12
+  804f3d:	53                   	push   %rbx
+  804f3e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804f42:	49 89 ff             	mov    %rdi,%r15
+  804f45:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f4c:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804f53:	00 
+  804f54:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f5b:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804f62:	00 00 00 
+  804f65:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804f6c:	48 89 d8             	mov    %rbx,%rax
+  804f6f:	eb 09                	jmp    804f7a <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f71:	48 83 c0 20          	add    $0x20,%rax
+  804f75:	4c 39 f0             	cmp    %r14,%rax
+  804f78:	74 40                	je     804fba <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f7a:	48 8b 10             	mov    (%rax),%rdx
+  804f7d:	4c 39 e2             	cmp    %r12,%rdx
+  804f80:	73 ef                	jae    804f71 <munmap+0x40>
+  804f82:	48 85 d2             	test   %rdx,%rdx
+  804f85:	74 ea                	je     804f71 <munmap+0x40>
+  804f87:	48 89 d7             	mov    %rdx,%rdi
+  804f8a:	48 03 78 08          	add    0x8(%rax),%rdi
+  804f8e:	49 39 ff             	cmp    %rdi,%r15
+  804f91:	73 de                	jae    804f71 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804f93:	49 39 fc             	cmp    %rdi,%r12
+  804f96:	72 05                	jb     804f9d <munmap+0x6c>
+  804f98:	4c 39 fa             	cmp    %r15,%rdx
+  804f9b:	73 d4                	jae    804f71 <munmap+0x40>
+  804f9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804fa2:	48 83 c4 08          	add    $0x8,%rsp
+  804fa6:	5b                   	pop    %rbx
+  804fa7:	41 5c                	pop    %r12
+  804fa9:	41 5d                	pop    %r13
+  804fab:	41 5e                	pop    %r14
+  804fad:	41 5f                	pop    %r15
+  804faf:	5d                   	pop    %rbp
+  804fb0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fb1:	48 83 c3 20          	add    $0x20,%rbx
+  804fb5:	4c 39 f3             	cmp    %r14,%rbx
+  804fb8:	74 5c                	je     805016 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fba:	48 8b 33             	mov    (%rbx),%rsi
+  804fbd:	4c 39 e6             	cmp    %r12,%rsi
+  804fc0:	73 ef                	jae    804fb1 <munmap+0x80>
+  804fc2:	48 85 f6             	test   %rsi,%rsi
+  804fc5:	74 ea                	je     804fb1 <munmap+0x80>
+  804fc7:	48 89 f2             	mov    %rsi,%rdx
+  804fca:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804fce:	49 39 d7             	cmp    %rdx,%r15
+  804fd1:	73 de                	jae    804fb1 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804fd3:	48 89 df             	mov    %rbx,%rdi
+  804fd6:	48 b8 21 4b 80 00 00 	movabs $0x804b21,%rax
+  804fdd:	00 00 00 
+  804fe0:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804fe2:	85 c0                	test   %eax,%eax
+  804fe4:	78 bc                	js     804fa2 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804fe6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804fea:	48 8b 33             	mov    (%rbx),%rsi
+  804fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff2:	48 b8 ae 28 80 00 00 	movabs $0x8028ae,%rax
+  804ff9:	00 00 00 
+  804ffc:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804ffe:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805001:	48 b8 d9 31 80 00 00 	movabs $0x8031d9,%rax
+  805008:	00 00 00 
+  80500b:	ff d0                	call   *%rax
+        reg->start = 0;
+  80500d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805014:	eb 9b                	jmp    804fb1 <munmap+0x80>
+    return 0;
+  805016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501b:	eb 85                	jmp    804fa2 <munmap+0x71>
+
+000000000080501d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80501d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805022:	c3                   	ret
+
+0000000000805023 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805023:	55                   	push   %rbp
+  805024:	48 89 e5             	mov    %rsp,%rbp
+  805027:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80502a:	48 be 45 66 80 00 00 	movabs $0x806645,%rsi
+  805031:	00 00 00 
+  805034:	48 b8 71 20 80 00 00 	movabs $0x802071,%rax
+  80503b:	00 00 00 
+  80503e:	ff d0                	call   *%rax
+    return 0;
+}
+  805040:	b8 00 00 00 00       	mov    $0x0,%eax
+  805045:	5d                   	pop    %rbp
+  805046:	c3                   	ret
+
+0000000000805047 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805047:	55                   	push   %rbp
+  805048:	48 89 e5             	mov    %rsp,%rbp
+  80504b:	41 57                	push   %r15
+  80504d:	41 56                	push   %r14
+  80504f:	41 55                	push   %r13
+  805051:	41 54                	push   %r12
+  805053:	53                   	push   %rbx
+  805054:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80505b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805062:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805069:	00 00 00 00 
+  80506d:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805074:	00 00 00 00 
+  805078:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80507f:	00 00 00 00 
+  805083:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80508a:	00 00 00 00 
+  80508e:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805095:	00 00 00 00 
+  805099:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8050a0:	00 00 00 00 
+  8050a4:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8050ab:	00 
+  8050ac:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8050b3:	00 
+  8050b4:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8050bb:	00 
+  8050bc:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8050c3:	00 
+  8050c4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8050cb:	00 
+  8050cc:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8050d3:	00 
+  8050d4:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8050db:	00 
+  8050dc:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8050e3:	00 
+  8050e4:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8050eb:	00 
+  8050ec:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8050f3:	00 
+    for (res = 0; res < n; res += inc) {
+  8050f4:	48 85 d2             	test   %rdx,%rdx
+  8050f7:	74 7a                	je     805173 <devcons_write+0x12c>
+  8050f9:	49 89 d6             	mov    %rdx,%r14
+  8050fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805102:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805107:	49 bf c1 23 80 00 00 	movabs $0x8023c1,%r15
+  80510e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805111:	4c 89 f3             	mov    %r14,%rbx
+  805114:	48 29 f3             	sub    %rsi,%rbx
+  805117:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80511c:	48 39 c3             	cmp    %rax,%rbx
+  80511f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805123:	4c 63 eb             	movslq %ebx,%r13
+  805126:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80512d:	48 01 c6             	add    %rax,%rsi
+  805130:	4c 89 ea             	mov    %r13,%rdx
+  805133:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80513a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80513d:	4c 89 ee             	mov    %r13,%rsi
+  805140:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805147:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  80514e:	00 00 00 
+  805151:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805153:	41 01 dc             	add    %ebx,%r12d
+  805156:	49 63 f4             	movslq %r12d,%rsi
+  805159:	4c 39 f6             	cmp    %r14,%rsi
+  80515c:	72 b3                	jb     805111 <devcons_write+0xca>
+    return res;
+  80515e:	49 63 c4             	movslq %r12d,%rax
+}
+  805161:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805168:	5b                   	pop    %rbx
+  805169:	41 5c                	pop    %r12
+  80516b:	41 5d                	pop    %r13
+  80516d:	41 5e                	pop    %r14
+  80516f:	41 5f                	pop    %r15
+  805171:	5d                   	pop    %rbp
+  805172:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805173:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805179:	eb e3                	jmp    80515e <devcons_write+0x117>
+
+000000000080517b <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80517b:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80517e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805183:	48 85 c0             	test   %rax,%rax
+  805186:	74 55                	je     8051dd <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805188:	55                   	push   %rbp
+  805189:	48 89 e5             	mov    %rsp,%rbp
+  80518c:	41 55                	push   %r13
+  80518e:	41 54                	push   %r12
+  805190:	53                   	push   %rbx
+  805191:	48 83 ec 08          	sub    $0x8,%rsp
+  805195:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805198:	48 bb 21 26 80 00 00 	movabs $0x802621,%rbx
+  80519f:	00 00 00 
+  8051a2:	49 bc 35 27 80 00 00 	movabs $0x802735,%r12
+  8051a9:	00 00 00 
+  8051ac:	eb 03                	jmp    8051b1 <devcons_read+0x36>
+  8051ae:	41 ff d4             	call   *%r12
+  8051b1:	ff d3                	call   *%rbx
+  8051b3:	85 c0                	test   %eax,%eax
+  8051b5:	74 f7                	je     8051ae <devcons_read+0x33>
+    if (c < 0) return c;
+  8051b7:	48 63 d0             	movslq %eax,%rdx
+  8051ba:	78 13                	js     8051cf <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8051bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051c1:	83 f8 04             	cmp    $0x4,%eax
+  8051c4:	74 09                	je     8051cf <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8051c6:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8051ca:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8051cf:	48 89 d0             	mov    %rdx,%rax
+  8051d2:	48 83 c4 08          	add    $0x8,%rsp
+  8051d6:	5b                   	pop    %rbx
+  8051d7:	41 5c                	pop    %r12
+  8051d9:	41 5d                	pop    %r13
+  8051db:	5d                   	pop    %rbp
+  8051dc:	c3                   	ret
+  8051dd:	48 89 d0             	mov    %rdx,%rax
+  8051e0:	c3                   	ret
+
+00000000008051e1 <cputchar>:
+cputchar(int ch) {
+  8051e1:	55                   	push   %rbp
+  8051e2:	48 89 e5             	mov    %rsp,%rbp
+  8051e5:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8051e9:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8051ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8051f2:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8051f6:	48 b8 ee 25 80 00 00 	movabs $0x8025ee,%rax
+  8051fd:	00 00 00 
+  805200:	ff d0                	call   *%rax
+}
+  805202:	c9                   	leave
+  805203:	c3                   	ret
+
+0000000000805204 <getchar>:
+getchar(void) {
+  805204:	55                   	push   %rbp
+  805205:	48 89 e5             	mov    %rsp,%rbp
+  805208:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80520c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805211:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80521a:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  805221:	00 00 00 
+  805224:	ff d0                	call   *%rax
+  805226:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805228:	85 c0                	test   %eax,%eax
+  80522a:	78 06                	js     805232 <getchar+0x2e>
+  80522c:	74 08                	je     805236 <getchar+0x32>
+  80522e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805232:	89 d0                	mov    %edx,%eax
+  805234:	c9                   	leave
+  805235:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805236:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80523b:	eb f5                	jmp    805232 <getchar+0x2e>
+
+000000000080523d <iscons>:
+iscons(int fdnum) {
+  80523d:	55                   	push   %rbp
+  80523e:	48 89 e5             	mov    %rsp,%rbp
+  805241:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805245:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805249:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  805250:	00 00 00 
+  805253:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805255:	85 c0                	test   %eax,%eax
+  805257:	78 18                	js     805271 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805259:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80525d:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805264:	00 00 00 
+  805267:	8b 00                	mov    (%rax),%eax
+  805269:	39 02                	cmp    %eax,(%rdx)
+  80526b:	0f 94 c0             	sete   %al
+  80526e:	0f b6 c0             	movzbl %al,%eax
+}
+  805271:	c9                   	leave
+  805272:	c3                   	ret
+
+0000000000805273 <opencons>:
+opencons(void) {
+  805273:	55                   	push   %rbp
+  805274:	48 89 e5             	mov    %rsp,%rbp
+  805277:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80527b:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80527f:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  805286:	00 00 00 
+  805289:	ff d0                	call   *%rax
+  80528b:	85 c0                	test   %eax,%eax
+  80528d:	78 49                	js     8052d8 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80528f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805294:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805299:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80529d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052a2:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  8052a9:	00 00 00 
+  8052ac:	ff d0                	call   *%rax
+  8052ae:	85 c0                	test   %eax,%eax
+  8052b0:	78 26                	js     8052d8 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8052b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052b6:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8052bd:	00 00 
+  8052bf:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8052c1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8052c5:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8052cc:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  8052d3:	00 00 00 
+  8052d6:	ff d0                	call   *%rax
+}
+  8052d8:	c9                   	leave
+  8052d9:	c3                   	ret
+
+00000000008052da <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8052da:	55                   	push   %rbp
+  8052db:	48 89 e5             	mov    %rsp,%rbp
+  8052de:	41 56                	push   %r14
+  8052e0:	41 55                	push   %r13
+  8052e2:	41 54                	push   %r12
+  8052e4:	53                   	push   %rbx
+  8052e5:	48 83 ec 50          	sub    $0x50,%rsp
+  8052e9:	49 89 fc             	mov    %rdi,%r12
+  8052ec:	41 89 f5             	mov    %esi,%r13d
+  8052ef:	48 89 d3             	mov    %rdx,%rbx
+  8052f2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8052f6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8052fa:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8052fe:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805305:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805309:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80530d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805311:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805315:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80531c:	00 00 00 
+  80531f:	4c 8b 30             	mov    (%rax),%r14
+  805322:	48 b8 fe 26 80 00 00 	movabs $0x8026fe,%rax
+  805329:	00 00 00 
+  80532c:	ff d0                	call   *%rax
+  80532e:	89 c6                	mov    %eax,%esi
+  805330:	45 89 e8             	mov    %r13d,%r8d
+  805333:	4c 89 e1             	mov    %r12,%rcx
+  805336:	4c 89 f2             	mov    %r14,%rdx
+  805339:	48 bf 58 66 80 00 00 	movabs $0x806658,%rdi
+  805340:	00 00 00 
+  805343:	b8 00 00 00 00       	mov    $0x0,%eax
+  805348:	49 bc 3a 17 80 00 00 	movabs $0x80173a,%r12
+  80534f:	00 00 00 
+  805352:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805355:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805359:	48 89 df             	mov    %rbx,%rdi
+  80535c:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  805363:	00 00 00 
+  805366:	ff d0                	call   *%rax
+    cprintf("\n");
+  805368:	48 bf fc 5e 80 00 00 	movabs $0x805efc,%rdi
+  80536f:	00 00 00 
+  805372:	b8 00 00 00 00       	mov    $0x0,%eax
+  805377:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80537a:	cc                   	int3
+  80537b:	eb fd                	jmp    80537a <_panic+0xa0>
+
+000000000080537d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80537d:	55                   	push   %rbp
+  80537e:	48 89 e5             	mov    %rsp,%rbp
+  805381:	41 56                	push   %r14
+  805383:	41 55                	push   %r13
+  805385:	41 54                	push   %r12
+  805387:	53                   	push   %rbx
+  805388:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80538b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805392:	00 00 00 
+  805395:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805399:	74 27                	je     8053c2 <_handle_vectored_pagefault+0x45>
+  80539b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8053a0:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8053a7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053aa:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8053ad:	4c 89 e7             	mov    %r12,%rdi
+  8053b0:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8053b5:	84 c0                	test   %al,%al
+  8053b7:	75 45                	jne    8053fe <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053b9:	48 83 c3 01          	add    $0x1,%rbx
+  8053bd:	49 3b 1e             	cmp    (%r14),%rbx
+  8053c0:	72 eb                	jb     8053ad <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8053c2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8053c9:	00 
+  8053ca:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8053cf:	4d 8b 04 24          	mov    (%r12),%r8
+  8053d3:	48 ba 80 66 80 00 00 	movabs $0x806680,%rdx
+  8053da:	00 00 00 
+  8053dd:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8053e2:	48 bf b0 66 80 00 00 	movabs $0x8066b0,%rdi
+  8053e9:	00 00 00 
+  8053ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053f1:	49 ba da 52 80 00 00 	movabs $0x8052da,%r10
+  8053f8:	00 00 00 
+  8053fb:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8053fe:	5b                   	pop    %rbx
+  8053ff:	41 5c                	pop    %r12
+  805401:	41 5d                	pop    %r13
+  805403:	41 5e                	pop    %r14
+  805405:	5d                   	pop    %rbp
+  805406:	c3                   	ret
+
+0000000000805407 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805407:	55                   	push   %rbp
+  805408:	48 89 e5             	mov    %rsp,%rbp
+  80540b:	53                   	push   %rbx
+  80540c:	48 83 ec 08          	sub    $0x8,%rsp
+  805410:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805413:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805418:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80541f:	00 00 00 
+  805422:	80 38 00             	cmpb   $0x0,(%rax)
+  805425:	74 68                	je     80548f <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805427:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80542e:	00 00 00 
+  805431:	48 8b 08             	mov    (%rax),%rcx
+  805434:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805439:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805440:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805443:	48 85 c9             	test   %rcx,%rcx
+  805446:	0f 84 e0 00 00 00    	je     80552c <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80544c:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805450:	0f 84 c9 00 00 00    	je     80551f <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805456:	48 83 c2 01          	add    $0x1,%rdx
+  80545a:	48 39 ca             	cmp    %rcx,%rdx
+  80545d:	75 ed                	jne    80544c <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80545f:	48 83 f9 08          	cmp    $0x8,%rcx
+  805463:	0f 84 84 00 00 00    	je     8054ed <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805469:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80546d:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805474:	00 00 00 
+  805477:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80547e:	00 00 00 
+  805481:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805485:	85 f6                	test   %esi,%esi
+  805487:	0f 89 97 00 00 00    	jns    805524 <add_pgfault_handler+0x11d>
+  80548d:	eb 63                	jmp    8054f2 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80548f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805494:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805499:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8054a0:	00 00 00 
+  8054a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054a8:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  8054af:	00 00 00 
+  8054b2:	ff d0                	call   *%rax
+  8054b4:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8054b6:	85 c0                	test   %eax,%eax
+  8054b8:	78 38                	js     8054f2 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8054ba:	48 be 08 56 80 00 00 	movabs $0x805608,%rsi
+  8054c1:	00 00 00 
+  8054c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c9:	48 b8 f9 29 80 00 00 	movabs $0x8029f9,%rax
+  8054d0:	00 00 00 
+  8054d3:	ff d0                	call   *%rax
+  8054d5:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8054d7:	85 c0                	test   %eax,%eax
+  8054d9:	78 17                	js     8054f2 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8054db:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8054e2:	00 00 00 
+  8054e5:	c6 00 01             	movb   $0x1,(%rax)
+  8054e8:	e9 3a ff ff ff       	jmp    805427 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8054ed:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054f2:	89 f1                	mov    %esi,%ecx
+  8054f4:	48 ba be 66 80 00 00 	movabs $0x8066be,%rdx
+  8054fb:	00 00 00 
+  8054fe:	be 42 00 00 00       	mov    $0x42,%esi
+  805503:	48 bf b0 66 80 00 00 	movabs $0x8066b0,%rdi
+  80550a:	00 00 00 
+  80550d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805512:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  805519:	00 00 00 
+  80551c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80551f:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805524:	89 f0                	mov    %esi,%eax
+  805526:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80552a:	c9                   	leave
+  80552b:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80552c:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805533:	00 00 00 
+  805536:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80553d:	48 89 d8             	mov    %rbx,%rax
+  805540:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805547:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80554a:	eb d8                	jmp    805524 <add_pgfault_handler+0x11d>
+
+000000000080554c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80554c:	55                   	push   %rbp
+  80554d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805550:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805557:	00 00 00 
+  80555a:	80 38 00             	cmpb   $0x0,(%rax)
+  80555d:	74 33                	je     805592 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80555f:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805566:	00 00 00 
+  805569:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80556e:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805575:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805578:	48 85 c0             	test   %rax,%rax
+  80557b:	0f 84 85 00 00 00    	je     805606 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805581:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805585:	74 40                	je     8055c7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805587:	48 83 c1 01          	add    $0x1,%rcx
+  80558b:	48 39 c1             	cmp    %rax,%rcx
+  80558e:	75 f1                	jne    805581 <remove_pgfault_handler+0x35>
+  805590:	eb 74                	jmp    805606 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805592:	48 b9 d6 66 80 00 00 	movabs $0x8066d6,%rcx
+  805599:	00 00 00 
+  80559c:	48 ba 96 65 80 00 00 	movabs $0x806596,%rdx
+  8055a3:	00 00 00 
+  8055a6:	be 48 00 00 00       	mov    $0x48,%esi
+  8055ab:	48 bf b0 66 80 00 00 	movabs $0x8066b0,%rdi
+  8055b2:	00 00 00 
+  8055b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ba:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  8055c1:	00 00 00 
+  8055c4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8055c7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8055ce:	00 
+  8055cf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8055d3:	48 29 ca             	sub    %rcx,%rdx
+  8055d6:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8055dd:	00 00 00 
+  8055e0:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8055e4:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8055e9:	48 89 ce             	mov    %rcx,%rsi
+  8055ec:	48 b8 c1 23 80 00 00 	movabs $0x8023c1,%rax
+  8055f3:	00 00 00 
+  8055f6:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8055f8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8055ff:	00 00 00 
+  805602:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805606:	5d                   	pop    %rbp
+  805607:	c3                   	ret
+
+0000000000805608 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805608:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80560b:	48 b8 7d 53 80 00 00 	movabs $0x80537d,%rax
+  805612:	00 00 00 
+    call *%rax
+  805615:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805617:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80561e:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80561f:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805626:	00 
+    subq $8, %rcx
+  805627:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80562b:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80562e:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805635:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805636:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80563a:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80563e:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805643:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805648:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80564d:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805652:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805657:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80565c:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805661:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805666:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80566b:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805670:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805675:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80567a:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80567f:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805684:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805688:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80568c:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80568d:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80568e:	c3                   	ret
+
+000000000080568f <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80568f:	85 ff                	test   %edi,%edi
+  805691:	78 58                	js     8056eb <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805693:	48 85 f6             	test   %rsi,%rsi
+  805696:	74 12                	je     8056aa <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805698:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80569f:	00 00 00 
+  8056a2:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8056a8:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8056aa:	48 85 c9             	test   %rcx,%rcx
+  8056ad:	74 12                	je     8056c1 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8056af:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056b6:	00 00 00 
+  8056b9:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8056bf:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8056c1:	48 85 d2             	test   %rdx,%rdx
+  8056c4:	74 14                	je     8056da <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8056c6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056cd:	00 00 00 
+  8056d0:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8056d7:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8056da:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056e1:	00 00 00 
+  8056e4:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8056ea:	c3                   	ret
+        if (from_env_store) {
+  8056eb:	48 85 f6             	test   %rsi,%rsi
+  8056ee:	74 06                	je     8056f6 <ipc_result+0x67>
+            *from_env_store = 0;
+  8056f0:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8056f6:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8056f8:	48 85 c9             	test   %rcx,%rcx
+  8056fb:	74 ed                	je     8056ea <ipc_result+0x5b>
+            *perm_store = 0;
+  8056fd:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805703:	c3                   	ret
+
+0000000000805704 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805704:	55                   	push   %rbp
+  805705:	48 89 e5             	mov    %rsp,%rbp
+  805708:	41 55                	push   %r13
+  80570a:	41 54                	push   %r12
+  80570c:	53                   	push   %rbx
+  80570d:	48 83 ec 08          	sub    $0x8,%rsp
+  805711:	49 89 fc             	mov    %rdi,%r12
+  805714:	48 89 f7             	mov    %rsi,%rdi
+  805717:	48 89 d3             	mov    %rdx,%rbx
+  80571a:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80571d:	48 85 f6             	test   %rsi,%rsi
+  805720:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805727:	00 00 00 
+  80572a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80572e:	be 00 00 00 00       	mov    $0x0,%esi
+  805733:	48 85 d2             	test   %rdx,%rdx
+  805736:	74 03                	je     80573b <ipc_recv+0x37>
+  805738:	48 8b 32             	mov    (%rdx),%rsi
+  80573b:	48 b8 22 2d 80 00 00 	movabs $0x802d22,%rax
+  805742:	00 00 00 
+  805745:	ff d0                	call   *%rax
+  805747:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805749:	4c 89 e9             	mov    %r13,%rcx
+  80574c:	48 89 da             	mov    %rbx,%rdx
+  80574f:	4c 89 e6             	mov    %r12,%rsi
+  805752:	48 b8 8f 56 80 00 00 	movabs $0x80568f,%rax
+  805759:	00 00 00 
+  80575c:	ff d0                	call   *%rax
+}
+  80575e:	48 83 c4 08          	add    $0x8,%rsp
+  805762:	5b                   	pop    %rbx
+  805763:	41 5c                	pop    %r12
+  805765:	41 5d                	pop    %r13
+  805767:	5d                   	pop    %rbp
+  805768:	c3                   	ret
+
+0000000000805769 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805769:	55                   	push   %rbp
+  80576a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80576d:	48 85 d2             	test   %rdx,%rdx
+  805770:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805777:	00 00 00 
+  80577a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80577e:	89 f6                	mov    %esi,%esi
+  805780:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  805787:	00 00 00 
+  80578a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80578c:	85 c0                	test   %eax,%eax
+  80578e:	78 02                	js     805792 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805790:	5d                   	pop    %rbp
+  805791:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805792:	89 c1                	mov    %eax,%ecx
+  805794:	48 ba f0 66 80 00 00 	movabs $0x8066f0,%rdx
+  80579b:	00 00 00 
+  80579e:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8057a3:	48 bf fd 66 80 00 00 	movabs $0x8066fd,%rdi
+  8057aa:	00 00 00 
+  8057ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057b2:	49 b8 da 52 80 00 00 	movabs $0x8052da,%r8
+  8057b9:	00 00 00 
+  8057bc:	41 ff d0             	call   *%r8
+
+00000000008057bf <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8057bf:	55                   	push   %rbp
+  8057c0:	48 89 e5             	mov    %rsp,%rbp
+  8057c3:	53                   	push   %rbx
+  8057c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8057c8:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8057cc:	48 85 d2             	test   %rdx,%rdx
+  8057cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057d6:	00 00 00 
+  8057d9:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8057dd:	4d 85 c9             	test   %r9,%r9
+  8057e0:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8057e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057e9:	48 85 db             	test   %rbx,%rbx
+  8057ec:	74 03                	je     8057f1 <ipc_call+0x32>
+  8057ee:	48 8b 03             	mov    (%rbx),%rax
+  8057f1:	89 f6                	mov    %esi,%esi
+  8057f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8057f7:	50                   	push   %rax
+  8057f8:	48 b8 e0 2b 80 00 00 	movabs $0x802be0,%rax
+  8057ff:	00 00 00 
+  805802:	ff d0                	call   *%rax
+  805804:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805806:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80580a:	48 89 da             	mov    %rbx,%rdx
+  80580d:	be 00 00 00 00       	mov    $0x0,%esi
+  805812:	48 b8 8f 56 80 00 00 	movabs $0x80568f,%rax
+  805819:	00 00 00 
+  80581c:	ff d0                	call   *%rax
+}
+  80581e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805822:	c9                   	leave
+  805823:	c3                   	ret
+
+0000000000805824 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805824:	55                   	push   %rbp
+  805825:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805828:	89 f6                	mov    %esi,%esi
+  80582a:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  805831:	00 00 00 
+  805834:	ff d0                	call   *%rax
+  805836:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805838:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80583d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805842:	be 00 00 00 00       	mov    $0x0,%esi
+  805847:	48 b8 8f 56 80 00 00 	movabs $0x80568f,%rax
+  80584e:	00 00 00 
+  805851:	ff d0                	call   *%rax
+}
+  805853:	5d                   	pop    %rbp
+  805854:	c3                   	ret
+
+0000000000805855 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805855:	55                   	push   %rbp
+  805856:	48 89 e5             	mov    %rsp,%rbp
+  805859:	41 54                	push   %r12
+  80585b:	53                   	push   %rbx
+  80585c:	4c 89 cb             	mov    %r9,%rbx
+  80585f:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805863:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805867:	48 85 d2             	test   %rdx,%rdx
+  80586a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805871:	00 00 00 
+  805874:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805878:	4d 85 c9             	test   %r9,%r9
+  80587b:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80587f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805884:	4d 85 e4             	test   %r12,%r12
+  805887:	74 04                	je     80588d <ipc_reply_wait+0x38>
+  805889:	49 8b 04 24          	mov    (%r12),%rax
+  80588d:	89 f6                	mov    %esi,%esi
+  80588f:	48 83 ec 08          	sub    $0x8,%rsp
+  805893:	50                   	push   %rax
+  805894:	48 b8 b6 2c 80 00 00 	movabs $0x802cb6,%rax
+  80589b:	00 00 00 
+  80589e:	ff d0                	call   *%rax
+  8058a0:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8058a2:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8058a6:	4c 89 e2             	mov    %r12,%rdx
+  8058a9:	48 89 de             	mov    %rbx,%rsi
+  8058ac:	48 b8 8f 56 80 00 00 	movabs $0x80568f,%rax
+  8058b3:	00 00 00 
+  8058b6:	ff d0                	call   *%rax
+}
+  8058b8:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8058bc:	5b                   	pop    %rbx
+  8058bd:	41 5c                	pop    %r12
+  8058bf:	5d                   	pop    %rbp
+  8058c0:	c3                   	ret
+
+00000000008058c1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8058c1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8058c6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8058cd:	00 00 00 
+  8058d0:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8058d7:	48 01 ca             	add    %rcx,%rdx
+  8058da:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8058e0:	39 fa                	cmp    %edi,%edx
+  8058e2:	74 12                	je     8058f6 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8058e4:	48 83 c0 01          	add    $0x1,%rax
+  8058e8:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8058ee:	75 e0                	jne    8058d0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8058f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058f5:	c3                   	ret
+            return envs[i].env_id;
+  8058f6:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8058fd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805904:	00 00 00 
+  805907:	48 01 d0             	add    %rdx,%rax
+  80590a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805910:	c3                   	ret
+  805911:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805918 <__rodata_start>:
+  805918:	77 00                	ja     80591a <__rodata_start+0x2>
+  80591a:	72 62                	jb     80597e <__rodata_start+0x66>
+  80591c:	00 77 62             	add    %dh,0x62(%rdi)
+  80591f:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 ed                	add    %ch,%ch
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 ed                	add    %ch,%ch
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	8c 0a                	mov    %cs,(%rdx)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805986:	00 00                	add    %al,(%rax)
+  805988:	8c 0a                	mov    %cs,(%rdx)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805996:	00 00                	add    %al,(%rax)
+  805998:	8c 0a                	mov    %cs,(%rdx)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	8c 0a                	mov    %cs,(%rdx)
+  8059aa:	80 00 00             	addb   $0x0,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	8c 0a                	mov    %cs,(%rdx)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	f4                   	hlt
+  805ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805abf:	00 ed                	add    %ch,%ch
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	2c 0b                	sub    $0xb,%al
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 ed                	add    %ch,%ch
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b13:	00 00                	add    %al,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 cb                	add    %cl,%bl
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	6a 0a                	push   $0xa
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 ed                	add    %ch,%ch
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	3c 0a                	cmp    $0xa,%al
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 ed                	add    %ch,%ch
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805b6b:	00 00                	add    %al,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 29                	add    %ch,(%rcx)
+  805b79:	0c 80                	or     $0x80,%al
+  805b7b:	00 00                	add    %al,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 ed                	add    %ch,%ch
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	1a 0b                	sbb    (%rbx),%cl
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 ed                	add    %ch,%ch
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ce                   	(bad)
+  805ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	f4                   	hlt
+  805bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805bbf:	00 37                	add    %dh,(%rdi)
+  805bc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 37                	add    %dh,(%rdi)
+  805bd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805beb:	00 00                	add    %al,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 d2                	add    %dl,%dl
+  805bf1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bf7:	00 d2                	add    %dl,%dl
+  805bf9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805bff:	00 d2                	add    %dl,%dl
+  805c01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c07:	00 d2                	add    %dl,%dl
+  805c09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c0f:	00 d2                	add    %dl,%dl
+  805c11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c17:	00 d2                	add    %dl,%dl
+  805c19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c1f:	00 d2                	add    %dl,%dl
+  805c21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c27:	00 f6                	add    %dh,%dh
+  805c29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c2f:	00 f6                	add    %dh,%dh
+  805c31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 22                	add    %ah,(%rdx)
+  805c71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c77:	00 22                	add    %ah,(%rdx)
+  805c79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c7f:	00 22                	add    %ah,(%rdx)
+  805c81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c87:	00 22                	add    %ah,(%rdx)
+  805c89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c8f:	00 22                	add    %ah,(%rdx)
+  805c91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c97:	00 22                	add    %ah,(%rdx)
+  805c99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 46 12             	add    %al,0x12(%rsi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 22                	add    %ah,(%rdx)
+  805d71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d77:	00 22                	add    %ah,(%rdx)
+  805d79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d7f:	00 22                	add    %ah,(%rdx)
+  805d81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d87:	00 22                	add    %ah,(%rdx)
+  805d89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d8f:	00 22                	add    %ah,(%rdx)
+  805d91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d97:	00 22                	add    %ah,(%rdx)
+  805d99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 46 12             	add    %al,0x12(%rsi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805e40 <basefix.0>:
+  805e40:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805e50:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805e60:	10 00 66 0f 1f 44 00 00 49 20 61 6d 20 74 68 65     ..f..D..I am the
+  805e70:	20 70 61 72 65 6e 74 2e 20 20 46 6f 72 6b 69 6e      parent.  Forkin
+  805e80:	67 20 74 68 65 20 63 68 69 6c 64 2e 2e 2e 0a 00     g the child.....
+  805e90:	49 20 61 6d 20 74 68 65 20 70 61 72 65 6e 74 2e     I am the parent.
+  805ea0:	20 20 52 75 6e 6e 69 6e 67 20 74 68 65 20 63 68       Running the ch
+  805eb0:	69 6c 64 2e 2e 2e 0a 00 49 20 61 6d 20 74 68 65     ild.....I am the
+  805ec0:	20 70 61 72 65 6e 74 2e 20 20 4b 69 6c 6c 69 6e      parent.  Killin
+  805ed0:	67 20 74 68 65 20 63 68 69 6c 64 2e 2e 2e 0a 00     g the child.....
+  805ee0:	49 20 61 6d 20 74 68 65 20 63 68 69 6c 64 2e 20     I am the child. 
+  805ef0:	20 53 70 69 6e 6e 69 6e 67 2e 2e 2e 0a 00 3c 75      Spinning.....<u
+  805f00:	6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35 36 37     nknown>.01234567
+  805f10:	38 39 41 42 43 44 45 46 00 30 31 32 33 34 35 36     89ABCDEF.0123456
+  805f20:	37 38 39 61 62 63 64 65 66 00 28 6e 75 6c 6c 29     789abcdef.(null)
+  805f30:	00 65 72 72 6f 72 20 25 64 00 75 6e 73 70 65 63     .error %d.unspec
+  805f40:	69 66 69 65 64 20 65 72 72 6f 72 00 62 61 64 20     ified error.bad 
+  805f50:	65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e 76 61     environment.inva
+  805f60:	6c 69 64 20 70 61 72 61 6d 65 74 65 72 00 6f 75     lid parameter.ou
+  805f70:	74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75 74 20     t of memory.out 
+  805f80:	6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 73 00     of environments.
+  805f90:	63 6f 72 72 75 70 74 65 64 20 64 65 62 75 67 20     corrupted debug 
+  805fa0:	69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74 69 6f     info.segmentatio
+  805fb0:	6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69 64 20     n fault.invalid 
+  805fc0:	45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73 75 63     ELF image.no suc
+  805fd0:	68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00 65 6e     h system call.en
+  805fe0:	74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00 65 6e     try not found.en
+  805ff0:	76 20 69 73 20 6e 6f 74 20 72 65 63 76 69 6e 67     v is not recving
+  806000:	00 75 6e 65 78 70 65 63 74 65 64 20 65 6e 64 20     .unexpected end 
+  806010:	6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65 65 20     of file.no free 
+  806020:	73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00 74 6f     space on disk.to
+  806030:	6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61 72 65     o many files are
+  806040:	20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20 62 6c      open.file or bl
+  806050:	6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00 69 6e     ock not found.in
+  806060:	76 61 6c 69 64 20 70 61 74 68 00 66 69 6c 65 20     valid path.file 
+  806070:	61 6c 72 65 61 64 79 20 65 78 69 73 74 73 00 6f     already exists.o
+  806080:	70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73 75 70     peration not sup
+  806090:	70 6f 72 74 65 64 00 66 0f 1f 84 00 00 00 00 00     ported.f........
+  8060a0:	32 19 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     2...............
+  8060b0:	79 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     y...............
+  8060c0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8060d0:	89 1f 80 00 00 00 00 00 51 19 80 00 00 00 00 00     ........Q.......
+  8060e0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8060f0:	45 19 80 00 00 00 00 00 bf 19 80 00 00 00 00 00     E...............
+  806100:	89 1f 80 00 00 00 00 00 45 19 80 00 00 00 00 00     ........E.......
+  806110:	8b 19 80 00 00 00 00 00 8b 19 80 00 00 00 00 00     ................
+  806120:	8b 19 80 00 00 00 00 00 8b 19 80 00 00 00 00 00     ................
+  806130:	8b 19 80 00 00 00 00 00 8b 19 80 00 00 00 00 00     ................
+  806140:	8b 19 80 00 00 00 00 00 8b 19 80 00 00 00 00 00     ................
+  806150:	8b 19 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806160:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806170:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806180:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806190:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061a0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061b0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061c0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061d0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061e0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8061f0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806200:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806210:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806220:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806230:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806240:	89 1f 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  806250:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806260:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806270:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806280:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806290:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8062a0:	ed 19 80 00 00 00 00 00 bc 1b 80 00 00 00 00 00     ................
+  8062b0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8062c0:	89 1f 80 00 00 00 00 00 e2 19 80 00 00 00 00 00     ................
+  8062d0:	1c 1a 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  8062e0:	89 1f 80 00 00 00 00 00 d7 19 80 00 00 00 00 00     ................
+  8062f0:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806300:	65 1d 80 00 00 00 00 00 34 1e 80 00 00 00 00 00     e.......4.......
+  806310:	89 1f 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806320:	b3 1a 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806330:	90 1c 80 00 00 00 00 00 89 1f 80 00 00 00 00 00     ................
+  806340:	89 1f 80 00 00 00 00 00 a7 1e 80 00 00 00 00 00     ................
+  806350:	89 1f 80 00 00 00 00 00 3b 19 80 00 00 00 00 00     ........;.......
+
+0000000000806360 <error_string>:
+	...
+  806368:	3a 5f 80 00 00 00 00 00 4c 5f 80 00 00 00 00 00     :_......L_......
+  806378:	5c 5f 80 00 00 00 00 00 6e 5f 80 00 00 00 00 00     \_......n_......
+  806388:	7c 5f 80 00 00 00 00 00 90 5f 80 00 00 00 00 00     |_......._......
+  806398:	a5 5f 80 00 00 00 00 00 b8 5f 80 00 00 00 00 00     ._......._......
+  8063a8:	ca 5f 80 00 00 00 00 00 de 5f 80 00 00 00 00 00     ._......._......
+  8063b8:	ee 5f 80 00 00 00 00 00 01 60 80 00 00 00 00 00     ._.......`......
+  8063c8:	18 60 80 00 00 00 00 00 2e 60 80 00 00 00 00 00     .`.......`......
+  8063d8:	46 60 80 00 00 00 00 00 5e 60 80 00 00 00 00 00     F`......^`......
+  8063e8:	6b 60 80 00 00 00 00 00 00 64 80 00 00 00 00 00     k`.......d......
+  8063f8:	7f 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806408:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806418:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806428:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806438:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806448:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806458:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806468:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806478:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806488:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806498:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8064a8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8064b8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  8064c8:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  8064d8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8064e8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8064f8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806508:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806518:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806528:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806538:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806548:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806558:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806560 <devtab>:
+  806560:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806570:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806580:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806590:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8065a0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8065b0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8065c0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8065d0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8065e0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8065f0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806600:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806610:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806620:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806630:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806640:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806650:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806660:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806670:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806680:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806690:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8066a0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8066b0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8066c0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8066d0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8066e0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8066f0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806700:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
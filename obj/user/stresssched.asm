@@ -0,0 +1,10535 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 da 17 80 00 00 	movabs $0x8017da,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 cb 16 80 00 00 	movabs $0x8016cb,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 97 5f 80 00 00 	movabs $0x805f97,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 37 22 80 00 00 	movabs $0x802237,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 78 59 80 00 00 	movabs $0x805978,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 37 22 80 00 00 	movabs $0x802237,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 7a 59 80 00 00 	movabs $0x80597a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 37 22 80 00 00 	movabs $0x802237,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 7d 59 80 00 00 	movabs $0x80597d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 37 22 80 00 00 	movabs $0x802237,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 5e 4d 80 00 00 	movabs $0x804d5e,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 35 50 80 00 00 	movabs $0x805035,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 74 36 80 00 00 	movabs $0x803674,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 3d 37 80 00 00 	movabs $0x80373d,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 43 36 80 00 00 	movabs $0x803643,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 43 36 80 00 00 	movabs $0x803643,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb e4 23 80 00 00 	movabs $0x8023e4,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 80 59 80 00 00 	movabs $0x805980,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc e4 23 80 00 00 	movabs $0x8023e4,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 20 5c 80 00 00 	movabs $0x805c20,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf e4 23 80 00 00 	movabs $0x8023e4,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf e4 23 80 00 00 	movabs $0x8023e4,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 23 01 00 00       	call   801622 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 55                	push   %r13
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  80150e:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  801515:	00 00 00 
+  801518:	ff d0                	call   *%rax
+  80151a:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  80151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  801522:	49 bc 38 2f 80 00 00 	movabs $0x802f38,%r12
+  801529:	00 00 00 
+  80152c:	41 ff d4             	call   *%r12
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	74 19                	je     80154c <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  801533:	83 c3 01             	add    $0x1,%ebx
+  801536:	83 fb 14             	cmp    $0x14,%ebx
+  801539:	75 f1                	jne    80152c <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80153b:	48 b8 39 28 80 00 00 	movabs $0x802839,%rax
+  801542:	00 00 00 
+  801545:	ff d0                	call   *%rax
+        return;
+  801547:	e9 94 00 00 00       	jmp    8015e0 <umain+0xdf>
+    if (i == 20) {
+  80154c:	83 fb 14             	cmp    $0x14,%ebx
+  80154f:	74 ea                	je     80153b <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  801551:	44 89 ea             	mov    %r13d,%edx
+  801554:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80155a:	44 89 e8             	mov    %r13d,%eax
+  80155d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801562:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801569:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801570:	00 00 00 
+  801573:	48 01 c8             	add    %rcx,%rax
+  801576:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	74 1c                	je     80159c <umain+0x9b>
+  801580:	48 63 c2             	movslq %edx,%rax
+  801583:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80158a:	48 89 ca             	mov    %rcx,%rdx
+  80158d:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  801590:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  801592:	8b 82 d8 00 00 00    	mov    0xd8(%rdx),%eax
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	75 f4                	jne    801590 <umain+0x8f>
+    for (i = 0; i < 20; i++)
+  80159c:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8015a2:	49 bd 39 28 80 00 00 	movabs $0x802839,%r13
+  8015a9:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8015ac:	48 bb 20 80 80 01 00 	movabs $0x1808020,%rbx
+  8015b3:	00 00 00 
+        sys_yield();
+  8015b6:	41 ff d5             	call   *%r13
+  8015b9:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8015be:	8b 03                	mov    (%rbx),%eax
+  8015c0:	83 c0 01             	add    $0x1,%eax
+  8015c3:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8015c5:	83 ea 01             	sub    $0x1,%edx
+  8015c8:	75 f4                	jne    8015be <umain+0xbd>
+    for (i = 0; i < 10; i++) {
+  8015ca:	41 83 ec 01          	sub    $0x1,%r12d
+  8015ce:	75 e6                	jne    8015b6 <umain+0xb5>
+    }
+
+    if (counter != 10 * 10000)
+  8015d0:	a1 20 80 80 01 00 00 	movabs 0x1808020,%eax
+  8015d7:	00 00 
+  8015d9:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8015de:	75 0b                	jne    8015eb <umain+0xea>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    //cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  8015e0:	48 83 c4 08          	add    $0x8,%rsp
+  8015e4:	5b                   	pop    %rbx
+  8015e5:	41 5c                	pop    %r12
+  8015e7:	41 5d                	pop    %r13
+  8015e9:	5d                   	pop    %rbp
+  8015ea:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  8015eb:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  8015f2:	00 00 00 
+  8015f5:	8b 08                	mov    (%rax),%ecx
+  8015f7:	48 ba c8 5e 80 00 00 	movabs $0x805ec8,%rdx
+  8015fe:	00 00 00 
+  801601:	be 1f 00 00 00       	mov    $0x1f,%esi
+  801606:	48 bf f0 5e 80 00 00 	movabs $0x805ef0,%rdi
+  80160d:	00 00 00 
+  801610:	b8 00 00 00 00       	mov    $0x0,%eax
+  801615:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  80161c:	00 00 00 
+  80161f:	41 ff d0             	call   *%r8
+
+0000000000801622 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801622:	55                   	push   %rbp
+  801623:	48 89 e5             	mov    %rsp,%rbp
+  801626:	41 56                	push   %r14
+  801628:	41 55                	push   %r13
+  80162a:	41 54                	push   %r12
+  80162c:	53                   	push   %rbx
+  80162d:	41 89 fd             	mov    %edi,%r13d
+  801630:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801633:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80163a:	00 00 00 
+  80163d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801644:	00 00 00 
+  801647:	48 39 c2             	cmp    %rax,%rdx
+  80164a:	73 17                	jae    801663 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80164c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80164f:	49 89 c4             	mov    %rax,%r12
+  801652:	48 83 c3 08          	add    $0x8,%rbx
+  801656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165b:	ff 53 f8             	call   *-0x8(%rbx)
+  80165e:	4c 39 e3             	cmp    %r12,%rbx
+  801661:	72 ef                	jb     801652 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801663:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80166a:	00 00 00 
+  80166d:	ff d0                	call   *%rax
+  80166f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801674:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80167b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801682:	00 00 00 
+  801685:	48 01 d0             	add    %rdx,%rax
+  801688:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  80168f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801692:	45 85 ed             	test   %r13d,%r13d
+  801695:	7e 0d                	jle    8016a4 <libmain+0x82>
+  801697:	49 8b 06             	mov    (%r14),%rax
+  80169a:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016a1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8016a4:	4c 89 f6             	mov    %r14,%rsi
+  8016a7:	44 89 ef             	mov    %r13d,%edi
+  8016aa:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016b1:	00 00 00 
+  8016b4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8016b6:	48 b8 cb 16 80 00 00 	movabs $0x8016cb,%rax
+  8016bd:	00 00 00 
+  8016c0:	ff d0                	call   *%rax
+#endif
+}
+  8016c2:	5b                   	pop    %rbx
+  8016c3:	41 5c                	pop    %r12
+  8016c5:	41 5d                	pop    %r13
+  8016c7:	41 5e                	pop    %r14
+  8016c9:	5d                   	pop    %rbp
+  8016ca:	c3                   	ret
+
+00000000008016cb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016cb:	55                   	push   %rbp
+  8016cc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016cf:	48 b8 10 33 80 00 00 	movabs $0x803310,%rax
+  8016d6:	00 00 00 
+  8016d9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016e0:	48 b8 91 27 80 00 00 	movabs $0x802791,%rax
+  8016e7:	00 00 00 
+  8016ea:	ff d0                	call   *%rax
+}
+  8016ec:	5d                   	pop    %rbp
+  8016ed:	c3                   	ret
+
+00000000008016ee <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+  8016f2:	41 56                	push   %r14
+  8016f4:	41 55                	push   %r13
+  8016f6:	41 54                	push   %r12
+  8016f8:	53                   	push   %rbx
+  8016f9:	48 83 ec 50          	sub    $0x50,%rsp
+  8016fd:	49 89 fc             	mov    %rdi,%r12
+  801700:	41 89 f5             	mov    %esi,%r13d
+  801703:	48 89 d3             	mov    %rdx,%rbx
+  801706:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80170a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80170e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801712:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801719:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80171d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801721:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801725:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801729:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801730:	00 00 00 
+  801733:	4c 8b 30             	mov    (%rax),%r14
+  801736:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80173d:	00 00 00 
+  801740:	ff d0                	call   *%rax
+  801742:	89 c6                	mov    %eax,%esi
+  801744:	45 89 e8             	mov    %r13d,%r8d
+  801747:	4c 89 e1             	mov    %r12,%rcx
+  80174a:	4c 89 f2             	mov    %r14,%rdx
+  80174d:	48 bf 10 5f 80 00 00 	movabs $0x805f10,%rdi
+  801754:	00 00 00 
+  801757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175c:	49 bc 3e 18 80 00 00 	movabs $0x80183e,%r12
+  801763:	00 00 00 
+  801766:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801769:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80176d:	48 89 df             	mov    %rbx,%rdi
+  801770:	48 b8 da 17 80 00 00 	movabs $0x8017da,%rax
+  801777:	00 00 00 
+  80177a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80177c:	48 bf 73 65 80 00 00 	movabs $0x806573,%rdi
+  801783:	00 00 00 
+  801786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80178e:	cc                   	int3
+  80178f:	eb fd                	jmp    80178e <_panic+0xa0>
+
+0000000000801791 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801791:	55                   	push   %rbp
+  801792:	48 89 e5             	mov    %rsp,%rbp
+  801795:	53                   	push   %rbx
+  801796:	48 83 ec 08          	sub    $0x8,%rsp
+  80179a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80179d:	8b 06                	mov    (%rsi),%eax
+  80179f:	8d 50 01             	lea    0x1(%rax),%edx
+  8017a2:	89 16                	mov    %edx,(%rsi)
+  8017a4:	48 98                	cltq
+  8017a6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8017ab:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8017b1:	74 0a                	je     8017bd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8017b3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8017b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017bb:	c9                   	leave
+  8017bc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8017bd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8017c1:	be ff 00 00 00       	mov    $0xff,%esi
+  8017c6:	48 b8 f2 26 80 00 00 	movabs $0x8026f2,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8017d2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8017d8:	eb d9                	jmp    8017b3 <putch+0x22>
+
+00000000008017da <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8017da:	55                   	push   %rbp
+  8017db:	48 89 e5             	mov    %rsp,%rbp
+  8017de:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8017e5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8017e8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8017ef:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8017f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8017fc:	48 89 f1             	mov    %rsi,%rcx
+  8017ff:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801806:	48 bf 91 17 80 00 00 	movabs $0x801791,%rdi
+  80180d:	00 00 00 
+  801810:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  801817:	00 00 00 
+  80181a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80181c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801823:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80182a:	48 b8 f2 26 80 00 00 	movabs $0x8026f2,%rax
+  801831:	00 00 00 
+  801834:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801836:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80183c:	c9                   	leave
+  80183d:	c3                   	ret
+
+000000000080183e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	48 83 ec 50          	sub    $0x50,%rsp
+  801846:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80184a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80184e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801852:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801856:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80185a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801861:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801865:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801869:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80186d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801871:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801875:	48 b8 da 17 80 00 00 	movabs $0x8017da,%rax
+  80187c:	00 00 00 
+  80187f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801881:	c9                   	leave
+  801882:	c3                   	ret
+
+0000000000801883 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	41 57                	push   %r15
+  801889:	41 56                	push   %r14
+  80188b:	41 55                	push   %r13
+  80188d:	41 54                	push   %r12
+  80188f:	53                   	push   %rbx
+  801890:	48 83 ec 18          	sub    $0x18,%rsp
+  801894:	49 89 fc             	mov    %rdi,%r12
+  801897:	49 89 f5             	mov    %rsi,%r13
+  80189a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80189e:	8b 45 10             	mov    0x10(%rbp),%eax
+  8018a1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8018a4:	41 89 cf             	mov    %ecx,%r15d
+  8018a7:	4c 39 fa             	cmp    %r15,%rdx
+  8018aa:	73 5b                	jae    801907 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8018ac:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8018b0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8018b4:	85 db                	test   %ebx,%ebx
+  8018b6:	7e 0e                	jle    8018c6 <print_num+0x43>
+            putch(padc, put_arg);
+  8018b8:	4c 89 ee             	mov    %r13,%rsi
+  8018bb:	44 89 f7             	mov    %r14d,%edi
+  8018be:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8018c1:	83 eb 01             	sub    $0x1,%ebx
+  8018c4:	75 f2                	jne    8018b8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8018c6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8018ca:	48 b9 44 5f 80 00 00 	movabs $0x805f44,%rcx
+  8018d1:	00 00 00 
+  8018d4:	48 b8 33 5f 80 00 00 	movabs $0x805f33,%rax
+  8018db:	00 00 00 
+  8018de:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8018e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018eb:	49 f7 f7             	div    %r15
+  8018ee:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8018f2:	4c 89 ee             	mov    %r13,%rsi
+  8018f5:	41 ff d4             	call   *%r12
+}
+  8018f8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018fc:	5b                   	pop    %rbx
+  8018fd:	41 5c                	pop    %r12
+  8018ff:	41 5d                	pop    %r13
+  801901:	41 5e                	pop    %r14
+  801903:	41 5f                	pop    %r15
+  801905:	5d                   	pop    %rbp
+  801906:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801907:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80190b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801910:	49 f7 f7             	div    %r15
+  801913:	48 83 ec 08          	sub    $0x8,%rsp
+  801917:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80191b:	52                   	push   %rdx
+  80191c:	45 0f be c9          	movsbl %r9b,%r9d
+  801920:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801924:	48 89 c2             	mov    %rax,%rdx
+  801927:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  80192e:	00 00 00 
+  801931:	ff d0                	call   *%rax
+  801933:	48 83 c4 10          	add    $0x10,%rsp
+  801937:	eb 8d                	jmp    8018c6 <print_num+0x43>
+
+0000000000801939 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801939:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80193d:	48 8b 06             	mov    (%rsi),%rax
+  801940:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801944:	73 0a                	jae    801950 <sprintputch+0x17>
+        *state->start++ = ch;
+  801946:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80194a:	48 89 16             	mov    %rdx,(%rsi)
+  80194d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801950:	c3                   	ret
+
+0000000000801951 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801951:	55                   	push   %rbp
+  801952:	48 89 e5             	mov    %rsp,%rbp
+  801955:	48 83 ec 50          	sub    $0x50,%rsp
+  801959:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80195d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801961:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801965:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80196c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801974:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801978:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80197c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801980:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  801987:	00 00 00 
+  80198a:	ff d0                	call   *%rax
+}
+  80198c:	c9                   	leave
+  80198d:	c3                   	ret
+
+000000000080198e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80198e:	55                   	push   %rbp
+  80198f:	48 89 e5             	mov    %rsp,%rbp
+  801992:	41 57                	push   %r15
+  801994:	41 56                	push   %r14
+  801996:	41 55                	push   %r13
+  801998:	41 54                	push   %r12
+  80199a:	53                   	push   %rbx
+  80199b:	48 83 ec 38          	sub    $0x38,%rsp
+  80199f:	49 89 fe             	mov    %rdi,%r14
+  8019a2:	49 89 f5             	mov    %rsi,%r13
+  8019a5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8019a8:	48 8b 01             	mov    (%rcx),%rax
+  8019ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019af:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8019b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019b7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8019bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8019bf:	eb 0d                	jmp    8019ce <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8019c1:	40 0f b6 ff          	movzbl %dil,%edi
+  8019c5:	4c 89 ee             	mov    %r13,%rsi
+  8019c8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8019cb:	4c 89 e3             	mov    %r12,%rbx
+  8019ce:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8019d2:	0f b6 3b             	movzbl (%rbx),%edi
+  8019d5:	40 80 ff 25          	cmp    $0x25,%dil
+  8019d9:	74 14                	je     8019ef <vprintfmt+0x61>
+            if (!ch) return;
+  8019db:	40 84 ff             	test   %dil,%dil
+  8019de:	75 e1                	jne    8019c1 <vprintfmt+0x33>
+}
+  8019e0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019e4:	5b                   	pop    %rbx
+  8019e5:	41 5c                	pop    %r12
+  8019e7:	41 5d                	pop    %r13
+  8019e9:	41 5e                	pop    %r14
+  8019eb:	41 5f                	pop    %r15
+  8019ed:	5d                   	pop    %rbp
+  8019ee:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8019ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8019f4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8019f8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8019fd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a03:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a0a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a0e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a13:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a18:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a1b:	83 e8 23             	sub    $0x23,%eax
+  801a1e:	3c 57                	cmp    $0x57,%al
+  801a20:	0f 87 67 06 00 00    	ja     80208d <vprintfmt+0x6ff>
+  801a26:	0f b6 c0             	movzbl %al,%eax
+  801a29:	48 b9 e0 60 80 00 00 	movabs $0x8060e0,%rcx
+  801a30:	00 00 00 
+  801a33:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801a36:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a39:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a3d:	eb cf                	jmp    801a0e <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a3f:	49 89 dc             	mov    %rbx,%r12
+  801a42:	be 01 00 00 00       	mov    $0x1,%esi
+  801a47:	eb c5                	jmp    801a0e <vprintfmt+0x80>
+            padc = ch;
+  801a49:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801a4d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a50:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a53:	eb b9                	jmp    801a0e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a58:	83 f8 2f             	cmp    $0x2f,%eax
+  801a5b:	77 24                	ja     801a81 <vprintfmt+0xf3>
+  801a5d:	89 c1                	mov    %eax,%ecx
+  801a5f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801a63:	83 c0 08             	add    $0x8,%eax
+  801a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a69:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801a6c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801a6f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a73:	79 99                	jns    801a0e <vprintfmt+0x80>
+                width = precision;
+  801a75:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801a79:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a7f:	eb 8d                	jmp    801a0e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a85:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a8d:	eb da                	jmp    801a69 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801a8f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801a94:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801a98:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801a9e:	3c 39                	cmp    $0x39,%al
+  801aa0:	77 1c                	ja     801abe <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801aa2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801aa6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801aaa:	0f b6 c0             	movzbl %al,%eax
+  801aad:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ab2:	0f b6 03             	movzbl (%rbx),%eax
+  801ab5:	3c 39                	cmp    $0x39,%al
+  801ab7:	76 e9                	jbe    801aa2 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801ab9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801abc:	eb b1                	jmp    801a6f <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801abe:	49 89 dc             	mov    %rbx,%r12
+  801ac1:	eb ac                	jmp    801a6f <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801ac3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ac6:	85 c9                	test   %ecx,%ecx
+  801ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acd:	0f 49 c1             	cmovns %ecx,%eax
+  801ad0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ad3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ad6:	e9 33 ff ff ff       	jmp    801a0e <vprintfmt+0x80>
+            lflag++;
+  801adb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ade:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ae1:	e9 28 ff ff ff       	jmp    801a0e <vprintfmt+0x80>
+            lflag--;
+  801ae6:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ae9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801aec:	e9 1d ff ff ff       	jmp    801a0e <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801af4:	83 f8 2f             	cmp    $0x2f,%eax
+  801af7:	77 19                	ja     801b12 <vprintfmt+0x184>
+  801af9:	89 c2                	mov    %eax,%edx
+  801afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801aff:	83 c0 08             	add    $0x8,%eax
+  801b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b05:	8b 3a                	mov    (%rdx),%edi
+  801b07:	4c 89 ee             	mov    %r13,%rsi
+  801b0a:	41 ff d6             	call   *%r14
+            break;
+  801b0d:	e9 bc fe ff ff       	jmp    8019ce <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b1e:	eb e5                	jmp    801b05 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b23:	83 f8 2f             	cmp    $0x2f,%eax
+  801b26:	77 5a                	ja     801b82 <vprintfmt+0x1f4>
+  801b28:	89 c2                	mov    %eax,%edx
+  801b2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b2e:	83 c0 08             	add    $0x8,%eax
+  801b31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b34:	8b 02                	mov    (%rdx),%eax
+  801b36:	89 c1                	mov    %eax,%ecx
+  801b38:	f7 d9                	neg    %ecx
+  801b3a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b3d:	83 f9 13             	cmp    $0x13,%ecx
+  801b40:	7f 4e                	jg     801b90 <vprintfmt+0x202>
+  801b42:	48 63 c1             	movslq %ecx,%rax
+  801b45:	48 ba a0 63 80 00 00 	movabs $0x8063a0,%rdx
+  801b4c:	00 00 00 
+  801b4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b53:	48 85 c0             	test   %rax,%rax
+  801b56:	74 38                	je     801b90 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801b58:	48 89 c1             	mov    %rax,%rcx
+  801b5b:	48 ba e8 65 80 00 00 	movabs $0x8065e8,%rdx
+  801b62:	00 00 00 
+  801b65:	4c 89 ee             	mov    %r13,%rsi
+  801b68:	4c 89 f7             	mov    %r14,%rdi
+  801b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b70:	49 b8 51 19 80 00 00 	movabs $0x801951,%r8
+  801b77:	00 00 00 
+  801b7a:	41 ff d0             	call   *%r8
+  801b7d:	e9 4c fe ff ff       	jmp    8019ce <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b8e:	eb a4                	jmp    801b34 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801b90:	48 ba 5c 5f 80 00 00 	movabs $0x805f5c,%rdx
+  801b97:	00 00 00 
+  801b9a:	4c 89 ee             	mov    %r13,%rsi
+  801b9d:	4c 89 f7             	mov    %r14,%rdi
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba5:	49 b8 51 19 80 00 00 	movabs $0x801951,%r8
+  801bac:	00 00 00 
+  801baf:	41 ff d0             	call   *%r8
+  801bb2:	e9 17 fe ff ff       	jmp    8019ce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bba:	83 f8 2f             	cmp    $0x2f,%eax
+  801bbd:	77 6c                	ja     801c2b <vprintfmt+0x29d>
+  801bbf:	89 c2                	mov    %eax,%edx
+  801bc1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bc5:	83 c0 08             	add    $0x8,%eax
+  801bc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bcb:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801bce:	48 85 f6             	test   %rsi,%rsi
+  801bd1:	48 b8 55 5f 80 00 00 	movabs $0x805f55,%rax
+  801bd8:	00 00 00 
+  801bdb:	48 0f 45 c6          	cmovne %rsi,%rax
+  801bdf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801be3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801be7:	7e 06                	jle    801bef <vprintfmt+0x261>
+  801be9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801bed:	75 4a                	jne    801c39 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801bef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801bf3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801bf7:	0f b6 00             	movzbl (%rax),%eax
+  801bfa:	84 c0                	test   %al,%al
+  801bfc:	0f 85 9a 00 00 00    	jne    801c9c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c05:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	0f 8e bd fd ff ff    	jle    8019ce <vprintfmt+0x40>
+  801c11:	4c 89 ee             	mov    %r13,%rsi
+  801c14:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c19:	41 ff d6             	call   *%r14
+  801c1c:	41 83 ec 01          	sub    $0x1,%r12d
+  801c20:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c24:	75 eb                	jne    801c11 <vprintfmt+0x283>
+  801c26:	e9 a3 fd ff ff       	jmp    8019ce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c37:	eb 92                	jmp    801bcb <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c39:	49 63 f7             	movslq %r15d,%rsi
+  801c3c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c40:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  801c47:	00 00 00 
+  801c4a:	ff d0                	call   *%rax
+  801c4c:	48 89 c2             	mov    %rax,%rdx
+  801c4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c52:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801c54:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801c57:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	7e 91                	jle    801bef <vprintfmt+0x261>
+  801c5e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801c63:	4c 89 ee             	mov    %r13,%rsi
+  801c66:	44 89 e7             	mov    %r12d,%edi
+  801c69:	41 ff d6             	call   *%r14
+  801c6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c73:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801c76:	75 eb                	jne    801c63 <vprintfmt+0x2d5>
+  801c78:	e9 72 ff ff ff       	jmp    801bef <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c7d:	0f b6 f8             	movzbl %al,%edi
+  801c80:	4c 89 ee             	mov    %r13,%rsi
+  801c83:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c86:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c8a:	49 83 c4 01          	add    $0x1,%r12
+  801c8e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801c94:	84 c0                	test   %al,%al
+  801c96:	0f 84 66 ff ff ff    	je     801c02 <vprintfmt+0x274>
+  801c9c:	45 85 ff             	test   %r15d,%r15d
+  801c9f:	78 0a                	js     801cab <vprintfmt+0x31d>
+  801ca1:	41 83 ef 01          	sub    $0x1,%r15d
+  801ca5:	0f 88 57 ff ff ff    	js     801c02 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801cab:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801caf:	74 cc                	je     801c7d <vprintfmt+0x2ef>
+  801cb1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801cb4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801cb9:	80 fa 5e             	cmp    $0x5e,%dl
+  801cbc:	77 c2                	ja     801c80 <vprintfmt+0x2f2>
+  801cbe:	eb bd                	jmp    801c7d <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc0:	40 84 f6             	test   %sil,%sil
+  801cc3:	75 26                	jne    801ceb <vprintfmt+0x35d>
+    switch (lflag) {
+  801cc5:	85 d2                	test   %edx,%edx
+  801cc7:	74 59                	je     801d22 <vprintfmt+0x394>
+  801cc9:	83 fa 01             	cmp    $0x1,%edx
+  801ccc:	74 7b                	je     801d49 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801cce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cd1:	83 f8 2f             	cmp    $0x2f,%eax
+  801cd4:	0f 87 96 00 00 00    	ja     801d70 <vprintfmt+0x3e2>
+  801cda:	89 c2                	mov    %eax,%edx
+  801cdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ce0:	83 c0 08             	add    $0x8,%eax
+  801ce3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ce6:	4c 8b 22             	mov    (%rdx),%r12
+  801ce9:	eb 17                	jmp    801d02 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801ceb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cee:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf1:	77 21                	ja     801d14 <vprintfmt+0x386>
+  801cf3:	89 c2                	mov    %eax,%edx
+  801cf5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf9:	83 c0 08             	add    $0x8,%eax
+  801cfc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cff:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d02:	4d 85 e4             	test   %r12,%r12
+  801d05:	78 7a                	js     801d81 <vprintfmt+0x3f3>
+            num = i;
+  801d07:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d0f:	e9 56 02 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d20:	eb dd                	jmp    801cff <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d25:	83 f8 2f             	cmp    $0x2f,%eax
+  801d28:	77 11                	ja     801d3b <vprintfmt+0x3ad>
+  801d2a:	89 c2                	mov    %eax,%edx
+  801d2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d30:	83 c0 08             	add    $0x8,%eax
+  801d33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d36:	4c 63 22             	movslq (%rdx),%r12
+  801d39:	eb c7                	jmp    801d02 <vprintfmt+0x374>
+  801d3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d47:	eb ed                	jmp    801d36 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4f:	77 11                	ja     801d62 <vprintfmt+0x3d4>
+  801d51:	89 c2                	mov    %eax,%edx
+  801d53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d57:	83 c0 08             	add    $0x8,%eax
+  801d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5d:	4c 8b 22             	mov    (%rdx),%r12
+  801d60:	eb a0                	jmp    801d02 <vprintfmt+0x374>
+  801d62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d6e:	eb ed                	jmp    801d5d <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801d70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d7c:	e9 65 ff ff ff       	jmp    801ce6 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d81:	4c 89 ee             	mov    %r13,%rsi
+  801d84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d89:	41 ff d6             	call   *%r14
+                i = -i;
+  801d8c:	49 f7 dc             	neg    %r12
+  801d8f:	e9 73 ff ff ff       	jmp    801d07 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801d94:	40 84 f6             	test   %sil,%sil
+  801d97:	75 2e                	jne    801dc7 <vprintfmt+0x439>
+    switch (lflag) {
+  801d99:	85 d2                	test   %edx,%edx
+  801d9b:	7f 59                	jg     801df6 <vprintfmt+0x468>
+  801d9d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801da0:	7d 7a                	jge    801e1c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801da2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801da5:	83 f8 2f             	cmp    $0x2f,%eax
+  801da8:	0f 87 aa 00 00 00    	ja     801e58 <vprintfmt+0x4ca>
+  801dae:	89 c2                	mov    %eax,%edx
+  801db0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801db4:	83 c0 08             	add    $0x8,%eax
+  801db7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dbd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dc2:	e9 a3 01 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801dc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dca:	83 f8 2f             	cmp    $0x2f,%eax
+  801dcd:	77 19                	ja     801de8 <vprintfmt+0x45a>
+  801dcf:	89 c2                	mov    %eax,%edx
+  801dd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dd5:	83 c0 08             	add    $0x8,%eax
+  801dd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ddb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801de3:	e9 82 01 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+  801de8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801df0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801df4:	eb e5                	jmp    801ddb <vprintfmt+0x44d>
+    switch (lflag) {
+  801df6:	83 fa 01             	cmp    $0x1,%edx
+  801df9:	75 a7                	jne    801da2 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801dfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dfe:	83 f8 2f             	cmp    $0x2f,%eax
+  801e01:	77 47                	ja     801e4a <vprintfmt+0x4bc>
+  801e03:	89 c2                	mov    %eax,%edx
+  801e05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e09:	83 c0 08             	add    $0x8,%eax
+  801e0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e0f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e17:	e9 4e 01 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e22:	77 18                	ja     801e3c <vprintfmt+0x4ae>
+  801e24:	89 c2                	mov    %eax,%edx
+  801e26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2a:	83 c0 08             	add    $0x8,%eax
+  801e2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e30:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801e37:	e9 2e 01 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+  801e3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e48:	eb e6                	jmp    801e30 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801e4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e56:	eb b7                	jmp    801e0f <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801e58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e64:	e9 51 ff ff ff       	jmp    801dba <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801e69:	40 84 f6             	test   %sil,%sil
+  801e6c:	75 2e                	jne    801e9c <vprintfmt+0x50e>
+    switch (lflag) {
+  801e6e:	85 d2                	test   %edx,%edx
+  801e70:	7f 59                	jg     801ecb <vprintfmt+0x53d>
+  801e72:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e75:	7d 77                	jge    801eee <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801e77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e7d:	0f 87 a4 00 00 00    	ja     801f27 <vprintfmt+0x599>
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e89:	83 c0 08             	add    $0x8,%eax
+  801e8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801e92:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801e97:	e9 ce 00 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9f:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea2:	77 19                	ja     801ebd <vprintfmt+0x52f>
+  801ea4:	89 c2                	mov    %eax,%edx
+  801ea6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eaa:	83 c0 08             	add    $0x8,%eax
+  801ead:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801eb3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801eb8:	e9 ad 00 00 00       	jmp    801f6a <vprintfmt+0x5dc>
+  801ebd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ec9:	eb e5                	jmp    801eb0 <vprintfmt+0x522>
+    switch (lflag) {
+  801ecb:	83 fa 01             	cmp    $0x1,%edx
+  801ece:	75 a7                	jne    801e77 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801ed0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed6:	77 41                	ja     801f19 <vprintfmt+0x58b>
+  801ed8:	89 c2                	mov    %eax,%edx
+  801eda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ede:	83 c0 08             	add    $0x8,%eax
+  801ee1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ee4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ee7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801eec:	eb 7c                	jmp    801f6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801eee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef4:	77 15                	ja     801f0b <vprintfmt+0x57d>
+  801ef6:	89 c2                	mov    %eax,%edx
+  801ef8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801efc:	83 c0 08             	add    $0x8,%eax
+  801eff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f02:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f04:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f09:	eb 5f                	jmp    801f6a <vprintfmt+0x5dc>
+  801f0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f17:	eb e9                	jmp    801f02 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f25:	eb bd                	jmp    801ee4 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f33:	e9 57 ff ff ff       	jmp    801e8f <vprintfmt+0x501>
+            putch('0', put_arg);
+  801f38:	4c 89 ee             	mov    %r13,%rsi
+  801f3b:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f40:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801f43:	4c 89 ee             	mov    %r13,%rsi
+  801f46:	bf 78 00 00 00       	mov    $0x78,%edi
+  801f4b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801f4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f51:	83 f8 2f             	cmp    $0x2f,%eax
+  801f54:	77 47                	ja     801f9d <vprintfmt+0x60f>
+  801f56:	89 c2                	mov    %eax,%edx
+  801f58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5c:	83 c0 08             	add    $0x8,%eax
+  801f5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f65:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801f6a:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801f72:	0f 94 c0             	sete   %al
+  801f75:	0f b6 c0             	movzbl %al,%eax
+  801f78:	50                   	push   %rax
+  801f79:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f7e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f82:	4c 89 ee             	mov    %r13,%rsi
+  801f85:	4c 89 f7             	mov    %r14,%rdi
+  801f88:	48 b8 83 18 80 00 00 	movabs $0x801883,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+            break;
+  801f94:	48 83 c4 10          	add    $0x10,%rsp
+  801f98:	e9 31 fa ff ff       	jmp    8019ce <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801f9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa9:	eb b7                	jmp    801f62 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801fab:	40 84 f6             	test   %sil,%sil
+  801fae:	75 2b                	jne    801fdb <vprintfmt+0x64d>
+    switch (lflag) {
+  801fb0:	85 d2                	test   %edx,%edx
+  801fb2:	7f 56                	jg     80200a <vprintfmt+0x67c>
+  801fb4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fb7:	7d 77                	jge    802030 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801fb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fbc:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbf:	0f 87 a7 00 00 00    	ja     80206c <vprintfmt+0x6de>
+  801fc5:	89 c2                	mov    %eax,%edx
+  801fc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fcb:	83 c0 08             	add    $0x8,%eax
+  801fce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fd1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fd4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fd9:	eb 8f                	jmp    801f6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fdb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fde:	83 f8 2f             	cmp    $0x2f,%eax
+  801fe1:	77 19                	ja     801ffc <vprintfmt+0x66e>
+  801fe3:	89 c2                	mov    %eax,%edx
+  801fe5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe9:	83 c0 08             	add    $0x8,%eax
+  801fec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ff2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ff7:	e9 6e ff ff ff       	jmp    801f6a <vprintfmt+0x5dc>
+  801ffc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802000:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802004:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802008:	eb e5                	jmp    801fef <vprintfmt+0x661>
+    switch (lflag) {
+  80200a:	83 fa 01             	cmp    $0x1,%edx
+  80200d:	75 aa                	jne    801fb9 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80200f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802012:	83 f8 2f             	cmp    $0x2f,%eax
+  802015:	77 47                	ja     80205e <vprintfmt+0x6d0>
+  802017:	89 c2                	mov    %eax,%edx
+  802019:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80201d:	83 c0 08             	add    $0x8,%eax
+  802020:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802023:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802026:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80202b:	e9 3a ff ff ff       	jmp    801f6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802030:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802033:	83 f8 2f             	cmp    $0x2f,%eax
+  802036:	77 18                	ja     802050 <vprintfmt+0x6c2>
+  802038:	89 c2                	mov    %eax,%edx
+  80203a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80203e:	83 c0 08             	add    $0x8,%eax
+  802041:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802044:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802046:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80204b:	e9 1a ff ff ff       	jmp    801f6a <vprintfmt+0x5dc>
+  802050:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802054:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802058:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205c:	eb e6                	jmp    802044 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80205e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802062:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802066:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206a:	eb b7                	jmp    802023 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80206c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802070:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802074:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802078:	e9 54 ff ff ff       	jmp    801fd1 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80207d:	4c 89 ee             	mov    %r13,%rsi
+  802080:	bf 25 00 00 00       	mov    $0x25,%edi
+  802085:	41 ff d6             	call   *%r14
+            break;
+  802088:	e9 41 f9 ff ff       	jmp    8019ce <vprintfmt+0x40>
+            putch('%', put_arg);
+  80208d:	4c 89 ee             	mov    %r13,%rsi
+  802090:	bf 25 00 00 00       	mov    $0x25,%edi
+  802095:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802098:	48 83 eb 01          	sub    $0x1,%rbx
+  80209c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8020a0:	75 f6                	jne    802098 <vprintfmt+0x70a>
+  8020a2:	e9 27 f9 ff ff       	jmp    8019ce <vprintfmt+0x40>
+
+00000000008020a7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8020a7:	55                   	push   %rbp
+  8020a8:	48 89 e5             	mov    %rsp,%rbp
+  8020ab:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8020af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020b3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8020b8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8020bc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8020c3:	48 85 ff             	test   %rdi,%rdi
+  8020c6:	74 2b                	je     8020f3 <vsnprintf+0x4c>
+  8020c8:	48 85 f6             	test   %rsi,%rsi
+  8020cb:	74 26                	je     8020f3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8020cd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020d1:	48 bf 39 19 80 00 00 	movabs $0x801939,%rdi
+  8020d8:	00 00 00 
+  8020db:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8020e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020eb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8020ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8020f1:	c9                   	leave
+  8020f2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8020f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f8:	eb f7                	jmp    8020f1 <vsnprintf+0x4a>
+
+00000000008020fa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8020fa:	55                   	push   %rbp
+  8020fb:	48 89 e5             	mov    %rsp,%rbp
+  8020fe:	48 83 ec 50          	sub    $0x50,%rsp
+  802102:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802106:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80210a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80210e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802115:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802119:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80211d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802121:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802125:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802129:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  802130:	00 00 00 
+  802133:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802135:	c9                   	leave
+  802136:	c3                   	ret
+
+0000000000802137 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802137:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80213a:	74 10                	je     80214c <strlen+0x15>
+    size_t n = 0;
+  80213c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802141:	48 83 c0 01          	add    $0x1,%rax
+  802145:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802149:	75 f6                	jne    802141 <strlen+0xa>
+  80214b:	c3                   	ret
+    size_t n = 0;
+  80214c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802151:	c3                   	ret
+
+0000000000802152 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802152:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802155:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80215a:	48 85 f6             	test   %rsi,%rsi
+  80215d:	74 11                	je     802170 <strnlen+0x1e>
+  80215f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802163:	74 0c                	je     802171 <strnlen+0x1f>
+  802165:	48 83 c2 01          	add    $0x1,%rdx
+  802169:	48 39 d0             	cmp    %rdx,%rax
+  80216c:	75 f1                	jne    80215f <strnlen+0xd>
+  80216e:	eb 04                	jmp    802174 <strnlen+0x22>
+  802170:	c3                   	ret
+  802171:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802174:	c3                   	ret
+
+0000000000802175 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802175:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802178:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802181:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802184:	48 83 c2 01          	add    $0x1,%rdx
+  802188:	84 c9                	test   %cl,%cl
+  80218a:	75 f1                	jne    80217d <strcpy+0x8>
+        ;
+    return res;
+}
+  80218c:	c3                   	ret
+
+000000000080218d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80218d:	55                   	push   %rbp
+  80218e:	48 89 e5             	mov    %rsp,%rbp
+  802191:	41 54                	push   %r12
+  802193:	53                   	push   %rbx
+  802194:	48 89 fb             	mov    %rdi,%rbx
+  802197:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80219a:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8021a6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8021aa:	4c 89 e6             	mov    %r12,%rsi
+  8021ad:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+    return dst;
+}
+  8021b9:	48 89 d8             	mov    %rbx,%rax
+  8021bc:	5b                   	pop    %rbx
+  8021bd:	41 5c                	pop    %r12
+  8021bf:	5d                   	pop    %rbp
+  8021c0:	c3                   	ret
+
+00000000008021c1 <toupper>:
+
+int
+toupper(int ch) {
+  8021c1:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8021c3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8021c6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8021c9:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021cc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021cf:	c3                   	ret
+
+00000000008021d0 <tolower>:
+
+int
+tolower(int ch) {
+  8021d0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8021d2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8021d5:	8d 57 20             	lea    0x20(%rdi),%edx
+  8021d8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021db:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021de:	c3                   	ret
+
+00000000008021df <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8021df:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8021e2:	48 85 d2             	test   %rdx,%rdx
+  8021e5:	74 1f                	je     802206 <strncpy+0x27>
+  8021e7:	48 01 fa             	add    %rdi,%rdx
+  8021ea:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8021ed:	48 83 c1 01          	add    $0x1,%rcx
+  8021f1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8021f5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8021f9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8021fd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802201:	48 39 ca             	cmp    %rcx,%rdx
+  802204:	75 e7                	jne    8021ed <strncpy+0xe>
+    }
+    return ret;
+}
+  802206:	c3                   	ret
+
+0000000000802207 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802207:	48 89 f8             	mov    %rdi,%rax
+  80220a:	48 85 d2             	test   %rdx,%rdx
+  80220d:	74 24                	je     802233 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80220f:	48 83 ea 01          	sub    $0x1,%rdx
+  802213:	74 1b                	je     802230 <strlcpy+0x29>
+  802215:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802219:	0f b6 16             	movzbl (%rsi),%edx
+  80221c:	84 d2                	test   %dl,%dl
+  80221e:	74 10                	je     802230 <strlcpy+0x29>
+            *dst++ = *src++;
+  802220:	48 83 c6 01          	add    $0x1,%rsi
+  802224:	48 83 c0 01          	add    $0x1,%rax
+  802228:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80222b:	48 39 c8             	cmp    %rcx,%rax
+  80222e:	75 e9                	jne    802219 <strlcpy+0x12>
+        *dst = '\0';
+  802230:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802233:	48 29 f8             	sub    %rdi,%rax
+}
+  802236:	c3                   	ret
+
+0000000000802237 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802237:	0f b6 07             	movzbl (%rdi),%eax
+  80223a:	84 c0                	test   %al,%al
+  80223c:	74 13                	je     802251 <strcmp+0x1a>
+  80223e:	38 06                	cmp    %al,(%rsi)
+  802240:	75 0f                	jne    802251 <strcmp+0x1a>
+  802242:	48 83 c7 01          	add    $0x1,%rdi
+  802246:	48 83 c6 01          	add    $0x1,%rsi
+  80224a:	0f b6 07             	movzbl (%rdi),%eax
+  80224d:	84 c0                	test   %al,%al
+  80224f:	75 ed                	jne    80223e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802251:	0f b6 c0             	movzbl %al,%eax
+  802254:	0f b6 16             	movzbl (%rsi),%edx
+  802257:	29 d0                	sub    %edx,%eax
+}
+  802259:	c3                   	ret
+
+000000000080225a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80225a:	48 85 d2             	test   %rdx,%rdx
+  80225d:	74 1f                	je     80227e <strncmp+0x24>
+  80225f:	0f b6 07             	movzbl (%rdi),%eax
+  802262:	84 c0                	test   %al,%al
+  802264:	74 1e                	je     802284 <strncmp+0x2a>
+  802266:	3a 06                	cmp    (%rsi),%al
+  802268:	75 1a                	jne    802284 <strncmp+0x2a>
+  80226a:	48 83 c7 01          	add    $0x1,%rdi
+  80226e:	48 83 c6 01          	add    $0x1,%rsi
+  802272:	48 83 ea 01          	sub    $0x1,%rdx
+  802276:	75 e7                	jne    80225f <strncmp+0x5>
+
+    if (!n) return 0;
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	c3                   	ret
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802283:	c3                   	ret
+  802284:	48 85 d2             	test   %rdx,%rdx
+  802287:	74 09                	je     802292 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802289:	0f b6 07             	movzbl (%rdi),%eax
+  80228c:	0f b6 16             	movzbl (%rsi),%edx
+  80228f:	29 d0                	sub    %edx,%eax
+  802291:	c3                   	ret
+    if (!n) return 0;
+  802292:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802297:	c3                   	ret
+
+0000000000802298 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802298:	0f b6 17             	movzbl (%rdi),%edx
+  80229b:	84 d2                	test   %dl,%dl
+  80229d:	74 18                	je     8022b7 <strchr+0x1f>
+        if (*str == c) {
+  80229f:	0f be d2             	movsbl %dl,%edx
+  8022a2:	39 f2                	cmp    %esi,%edx
+  8022a4:	74 17                	je     8022bd <strchr+0x25>
+    for (; *str; str++) {
+  8022a6:	48 83 c7 01          	add    $0x1,%rdi
+  8022aa:	0f b6 17             	movzbl (%rdi),%edx
+  8022ad:	84 d2                	test   %dl,%dl
+  8022af:	75 ee                	jne    80229f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8022b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022b6:	c3                   	ret
+  8022b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022bc:	c3                   	ret
+  8022bd:	48 89 f8             	mov    %rdi,%rax
+}
+  8022c0:	c3                   	ret
+
+00000000008022c1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8022c1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8022c4:	0f b6 17             	movzbl (%rdi),%edx
+  8022c7:	84 d2                	test   %dl,%dl
+  8022c9:	74 13                	je     8022de <strfind+0x1d>
+  8022cb:	0f be d2             	movsbl %dl,%edx
+  8022ce:	39 f2                	cmp    %esi,%edx
+  8022d0:	74 0b                	je     8022dd <strfind+0x1c>
+  8022d2:	48 83 c0 01          	add    $0x1,%rax
+  8022d6:	0f b6 10             	movzbl (%rax),%edx
+  8022d9:	84 d2                	test   %dl,%dl
+  8022db:	75 ee                	jne    8022cb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8022dd:	c3                   	ret
+  8022de:	c3                   	ret
+
+00000000008022df <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022df:	48 39 f7             	cmp    %rsi,%rdi
+  8022e2:	74 65                	je     802349 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8022e4:	55                   	push   %rbp
+  8022e5:	48 89 e5             	mov    %rsp,%rbp
+  8022e8:	41 57                	push   %r15
+  8022ea:	41 56                	push   %r14
+  8022ec:	41 55                	push   %r13
+  8022ee:	41 54                	push   %r12
+  8022f0:	53                   	push   %rbx
+  8022f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022f5:	48 89 fb             	mov    %rdi,%rbx
+  8022f8:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8022fb:	49 bf d0 21 80 00 00 	movabs $0x8021d0,%r15
+  802302:	00 00 00 
+  802305:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802309:	41 0f b6 fd          	movzbl %r13b,%edi
+  80230d:	41 ff d7             	call   *%r15
+  802310:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802313:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802318:	41 0f b6 fe          	movzbl %r14b,%edi
+  80231c:	41 ff d7             	call   *%r15
+  80231f:	89 c2                	mov    %eax,%edx
+  802321:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802324:	29 d0                	sub    %edx,%eax
+  802326:	75 12                	jne    80233a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802328:	48 83 c3 01          	add    $0x1,%rbx
+  80232c:	45 84 ed             	test   %r13b,%r13b
+  80232f:	74 09                	je     80233a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802331:	49 83 c4 01          	add    $0x1,%r12
+  802335:	45 84 f6             	test   %r14b,%r14b
+  802338:	75 cb                	jne    802305 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80233a:	48 83 c4 18          	add    $0x18,%rsp
+  80233e:	5b                   	pop    %rbx
+  80233f:	41 5c                	pop    %r12
+  802341:	41 5d                	pop    %r13
+  802343:	41 5e                	pop    %r14
+  802345:	41 5f                	pop    %r15
+  802347:	5d                   	pop    %rbp
+  802348:	c3                   	ret
+    if (p1 == p2) return 0;
+  802349:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80234e:	c3                   	ret
+
+000000000080234f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80234f:	48 39 f7             	cmp    %rsi,%rdi
+  802352:	74 7d                	je     8023d1 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802354:	55                   	push   %rbp
+  802355:	48 89 e5             	mov    %rsp,%rbp
+  802358:	41 57                	push   %r15
+  80235a:	41 56                	push   %r14
+  80235c:	41 55                	push   %r13
+  80235e:	41 54                	push   %r12
+  802360:	53                   	push   %rbx
+  802361:	48 83 ec 18          	sub    $0x18,%rsp
+  802365:	48 89 fb             	mov    %rdi,%rbx
+  802368:	49 89 f4             	mov    %rsi,%r12
+  80236b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80236f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802373:	49 bf d0 21 80 00 00 	movabs $0x8021d0,%r15
+  80237a:	00 00 00 
+    while (n--) {
+  80237d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802381:	48 39 c3             	cmp    %rax,%rbx
+  802384:	74 37                	je     8023bd <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802386:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80238a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80238e:	41 ff d7             	call   *%r15
+  802391:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802394:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802399:	41 0f b6 fe          	movzbl %r14b,%edi
+  80239d:	41 ff d7             	call   *%r15
+  8023a0:	89 c2                	mov    %eax,%edx
+  8023a2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8023a5:	29 d0                	sub    %edx,%eax
+  8023a7:	75 19                	jne    8023c2 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8023a9:	48 83 c3 01          	add    $0x1,%rbx
+  8023ad:	45 84 ed             	test   %r13b,%r13b
+  8023b0:	74 10                	je     8023c2 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8023b2:	49 83 c4 01          	add    $0x1,%r12
+  8023b6:	45 84 f6             	test   %r14b,%r14b
+  8023b9:	75 c2                	jne    80237d <strncasecmp+0x2e>
+  8023bb:	eb 05                	jmp    8023c2 <strncasecmp+0x73>
+  8023bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8023c2:	48 83 c4 18          	add    $0x18,%rsp
+  8023c6:	5b                   	pop    %rbx
+  8023c7:	41 5c                	pop    %r12
+  8023c9:	41 5d                	pop    %r13
+  8023cb:	41 5e                	pop    %r14
+  8023cd:	41 5f                	pop    %r15
+  8023cf:	5d                   	pop    %rbp
+  8023d0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023d6:	c3                   	ret
+
+00000000008023d7 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8023d7:	83 e7 df             	and    $0xffffffdf,%edi
+  8023da:	83 ef 41             	sub    $0x41,%edi
+  8023dd:	83 ff 19             	cmp    $0x19,%edi
+  8023e0:	0f 96 c0             	setbe  %al
+}
+  8023e3:	c3                   	ret
+
+00000000008023e4 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8023e4:	83 ff 20             	cmp    $0x20,%edi
+  8023e7:	0f 94 c0             	sete   %al
+  8023ea:	83 ff 09             	cmp    $0x9,%edi
+  8023ed:	0f 94 c2             	sete   %dl
+  8023f0:	09 d0                	or     %edx,%eax
+}
+  8023f2:	c3                   	ret
+
+00000000008023f3 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8023f3:	55                   	push   %rbp
+  8023f4:	48 89 e5             	mov    %rsp,%rbp
+  8023f7:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8023f9:	48 bf 5f 64 80 00 00 	movabs $0x80645f,%rdi
+  802400:	00 00 00 
+  802403:	48 b8 98 22 80 00 00 	movabs $0x802298,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+  80240f:	48 85 c0             	test   %rax,%rax
+  802412:	0f 95 c0             	setne  %al
+}
+  802415:	5d                   	pop    %rbp
+  802416:	c3                   	ret
+
+0000000000802417 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802417:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80241a:	48 89 f8             	mov    %rdi,%rax
+  80241d:	48 f7 d8             	neg    %rax
+  802420:	83 e0 07             	and    $0x7,%eax
+  802423:	49 89 d1             	mov    %rdx,%r9
+  802426:	49 29 c1             	sub    %rax,%r9
+  802429:	78 36                	js     802461 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80242b:	40 0f b6 c6          	movzbl %sil,%eax
+  80242f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802436:	01 01 01 
+  802439:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80243d:	40 f6 c7 07          	test   $0x7,%dil
+  802441:	75 38                	jne    80247b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802443:	4c 89 c9             	mov    %r9,%rcx
+  802446:	48 c1 f9 03          	sar    $0x3,%rcx
+  80244a:	74 0c                	je     802458 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80244c:	fc                   	cld
+  80244d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802450:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802454:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802458:	4d 85 c9             	test   %r9,%r9
+  80245b:	75 45                	jne    8024a2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80245d:	4c 89 c0             	mov    %r8,%rax
+  802460:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802461:	48 85 d2             	test   %rdx,%rdx
+  802464:	74 f7                	je     80245d <memset+0x46>
+  802466:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802469:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80246c:	48 83 c0 01          	add    $0x1,%rax
+  802470:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802474:	48 39 c2             	cmp    %rax,%rdx
+  802477:	75 f3                	jne    80246c <memset+0x55>
+  802479:	eb e2                	jmp    80245d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80247b:	40 f6 c7 01          	test   $0x1,%dil
+  80247f:	74 06                	je     802487 <memset+0x70>
+  802481:	88 07                	mov    %al,(%rdi)
+  802483:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802487:	40 f6 c7 02          	test   $0x2,%dil
+  80248b:	74 07                	je     802494 <memset+0x7d>
+  80248d:	66 89 07             	mov    %ax,(%rdi)
+  802490:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802494:	40 f6 c7 04          	test   $0x4,%dil
+  802498:	74 a9                	je     802443 <memset+0x2c>
+  80249a:	89 07                	mov    %eax,(%rdi)
+  80249c:	48 83 c7 04          	add    $0x4,%rdi
+  8024a0:	eb a1                	jmp    802443 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024a2:	41 f6 c1 04          	test   $0x4,%r9b
+  8024a6:	74 06                	je     8024ae <memset+0x97>
+  8024a8:	89 07                	mov    %eax,(%rdi)
+  8024aa:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024ae:	41 f6 c1 02          	test   $0x2,%r9b
+  8024b2:	74 07                	je     8024bb <memset+0xa4>
+  8024b4:	66 89 07             	mov    %ax,(%rdi)
+  8024b7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8024bb:	41 f6 c1 01          	test   $0x1,%r9b
+  8024bf:	74 9c                	je     80245d <memset+0x46>
+  8024c1:	88 07                	mov    %al,(%rdi)
+  8024c3:	eb 98                	jmp    80245d <memset+0x46>
+
+00000000008024c5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8024c5:	48 89 f8             	mov    %rdi,%rax
+  8024c8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8024cb:	48 39 fe             	cmp    %rdi,%rsi
+  8024ce:	73 3b                	jae    80250b <memmove+0x46>
+  8024d0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8024d4:	48 39 d7             	cmp    %rdx,%rdi
+  8024d7:	73 32                	jae    80250b <memmove+0x46>
+        s += n;
+        d += n;
+  8024d9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024dd:	48 89 d6             	mov    %rdx,%rsi
+  8024e0:	48 09 fe             	or     %rdi,%rsi
+  8024e3:	48 09 ce             	or     %rcx,%rsi
+  8024e6:	40 f6 c6 07          	test   $0x7,%sil
+  8024ea:	75 12                	jne    8024fe <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8024ec:	48 83 ef 08          	sub    $0x8,%rdi
+  8024f0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8024f4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8024f8:	fd                   	std
+  8024f9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8024fc:	fc                   	cld
+  8024fd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8024fe:	48 83 ef 01          	sub    $0x1,%rdi
+  802502:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802506:	fd                   	std
+  802507:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802509:	eb f1                	jmp    8024fc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80250b:	48 89 f2             	mov    %rsi,%rdx
+  80250e:	48 09 c2             	or     %rax,%rdx
+  802511:	48 09 ca             	or     %rcx,%rdx
+  802514:	f6 c2 07             	test   $0x7,%dl
+  802517:	75 0c                	jne    802525 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802519:	48 c1 e9 03          	shr    $0x3,%rcx
+  80251d:	48 89 c7             	mov    %rax,%rdi
+  802520:	fc                   	cld
+  802521:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802524:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802525:	48 89 c7             	mov    %rax,%rdi
+  802528:	fc                   	cld
+  802529:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80252b:	c3                   	ret
+
+000000000080252c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80252c:	55                   	push   %rbp
+  80252d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802530:	48 b8 c5 24 80 00 00 	movabs $0x8024c5,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+}
+  80253c:	5d                   	pop    %rbp
+  80253d:	c3                   	ret
+
+000000000080253e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80253e:	55                   	push   %rbp
+  80253f:	48 89 e5             	mov    %rsp,%rbp
+  802542:	41 57                	push   %r15
+  802544:	41 56                	push   %r14
+  802546:	41 55                	push   %r13
+  802548:	41 54                	push   %r12
+  80254a:	53                   	push   %rbx
+  80254b:	48 83 ec 08          	sub    $0x8,%rsp
+  80254f:	49 89 fe             	mov    %rdi,%r14
+  802552:	49 89 f7             	mov    %rsi,%r15
+  802555:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802558:	48 89 f7             	mov    %rsi,%rdi
+  80255b:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+  802567:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80256a:	48 89 de             	mov    %rbx,%rsi
+  80256d:	4c 89 f7             	mov    %r14,%rdi
+  802570:	48 b8 52 21 80 00 00 	movabs $0x802152,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+  80257c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80257f:	48 39 c3             	cmp    %rax,%rbx
+  802582:	74 36                	je     8025ba <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802584:	48 89 d8             	mov    %rbx,%rax
+  802587:	4c 29 e8             	sub    %r13,%rax
+  80258a:	49 39 c4             	cmp    %rax,%r12
+  80258d:	73 31                	jae    8025c0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80258f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802594:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802598:	4c 89 fe             	mov    %r15,%rsi
+  80259b:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8025a7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8025ab:	48 83 c4 08          	add    $0x8,%rsp
+  8025af:	5b                   	pop    %rbx
+  8025b0:	41 5c                	pop    %r12
+  8025b2:	41 5d                	pop    %r13
+  8025b4:	41 5e                	pop    %r14
+  8025b6:	41 5f                	pop    %r15
+  8025b8:	5d                   	pop    %rbp
+  8025b9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025ba:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8025be:	eb eb                	jmp    8025ab <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8025c0:	48 83 eb 01          	sub    $0x1,%rbx
+  8025c4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025c8:	48 89 da             	mov    %rbx,%rdx
+  8025cb:	4c 89 fe             	mov    %r15,%rsi
+  8025ce:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8025da:	49 01 de             	add    %rbx,%r14
+  8025dd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8025e2:	eb c3                	jmp    8025a7 <strlcat+0x69>
+
+00000000008025e4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8025e4:	48 85 d2             	test   %rdx,%rdx
+  8025e7:	74 2d                	je     802616 <memcmp+0x32>
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8025ee:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8025f2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8025f7:	44 38 c1             	cmp    %r8b,%cl
+  8025fa:	75 0f                	jne    80260b <memcmp+0x27>
+    while (n-- > 0) {
+  8025fc:	48 83 c0 01          	add    $0x1,%rax
+  802600:	48 39 c2             	cmp    %rax,%rdx
+  802603:	75 e9                	jne    8025ee <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80260a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80260b:	0f b6 c1             	movzbl %cl,%eax
+  80260e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802612:	44 29 c0             	sub    %r8d,%eax
+  802615:	c3                   	ret
+    return 0;
+  802616:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80261b:	c3                   	ret
+
+000000000080261c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80261c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802620:	48 39 c7             	cmp    %rax,%rdi
+  802623:	73 0f                	jae    802634 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802625:	40 38 37             	cmp    %sil,(%rdi)
+  802628:	74 0e                	je     802638 <memfind+0x1c>
+    for (; src < end; src++) {
+  80262a:	48 83 c7 01          	add    $0x1,%rdi
+  80262e:	48 39 f8             	cmp    %rdi,%rax
+  802631:	75 f2                	jne    802625 <memfind+0x9>
+  802633:	c3                   	ret
+  802634:	48 89 f8             	mov    %rdi,%rax
+  802637:	c3                   	ret
+  802638:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80263b:	c3                   	ret
+
+000000000080263c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80263c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80263f:	0f b6 37             	movzbl (%rdi),%esi
+  802642:	40 80 fe 20          	cmp    $0x20,%sil
+  802646:	74 06                	je     80264e <strtol+0x12>
+  802648:	40 80 fe 09          	cmp    $0x9,%sil
+  80264c:	75 13                	jne    802661 <strtol+0x25>
+  80264e:	48 83 c7 01          	add    $0x1,%rdi
+  802652:	0f b6 37             	movzbl (%rdi),%esi
+  802655:	40 80 fe 20          	cmp    $0x20,%sil
+  802659:	74 f3                	je     80264e <strtol+0x12>
+  80265b:	40 80 fe 09          	cmp    $0x9,%sil
+  80265f:	74 ed                	je     80264e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802661:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802664:	83 e0 fd             	and    $0xfffffffd,%eax
+  802667:	3c 01                	cmp    $0x1,%al
+  802669:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80266d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802673:	75 0f                	jne    802684 <strtol+0x48>
+  802675:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802678:	74 14                	je     80268e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80267a:	85 d2                	test   %edx,%edx
+  80267c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802681:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802684:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802689:	4c 63 ca             	movslq %edx,%r9
+  80268c:	eb 36                	jmp    8026c4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80268e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802692:	74 0f                	je     8026a3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802694:	85 d2                	test   %edx,%edx
+  802696:	75 ec                	jne    802684 <strtol+0x48>
+        s++;
+  802698:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80269c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8026a1:	eb e1                	jmp    802684 <strtol+0x48>
+        s += 2;
+  8026a3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8026a7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8026ac:	eb d6                	jmp    802684 <strtol+0x48>
+            dig -= '0';
+  8026ae:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8026b1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8026b5:	41 39 d0             	cmp    %edx,%r8d
+  8026b8:	7d 21                	jge    8026db <strtol+0x9f>
+        val = val * base + dig;
+  8026ba:	49 0f af c1          	imul   %r9,%rax
+  8026be:	0f b6 c9             	movzbl %cl,%ecx
+  8026c1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8026c4:	48 83 c7 01          	add    $0x1,%rdi
+  8026c8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8026cc:	80 f9 39             	cmp    $0x39,%cl
+  8026cf:	76 dd                	jbe    8026ae <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8026d1:	80 f9 7b             	cmp    $0x7b,%cl
+  8026d4:	77 05                	ja     8026db <strtol+0x9f>
+            dig -= 'a' - 10;
+  8026d6:	83 e9 57             	sub    $0x57,%ecx
+  8026d9:	eb d6                	jmp    8026b1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8026db:	4d 85 d2             	test   %r10,%r10
+  8026de:	74 03                	je     8026e3 <strtol+0xa7>
+  8026e0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8026e3:	48 89 c2             	mov    %rax,%rdx
+  8026e6:	48 f7 da             	neg    %rdx
+  8026e9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8026ed:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8026f1:	c3                   	ret
+
+00000000008026f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8026f2:	55                   	push   %rbp
+  8026f3:	48 89 e5             	mov    %rsp,%rbp
+  8026f6:	53                   	push   %rbx
+  8026f7:	48 89 fa             	mov    %rdi,%rdx
+  8026fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8026fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802702:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802707:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80270c:	be 00 00 00 00       	mov    $0x0,%esi
+  802711:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802717:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80271d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80271f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802723:	c9                   	leave
+  802724:	c3                   	ret
+
+0000000000802725 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802725:	55                   	push   %rbp
+  802726:	48 89 e5             	mov    %rsp,%rbp
+  802729:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80272a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80272f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802734:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802739:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80273e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802743:	be 00 00 00 00       	mov    $0x0,%esi
+  802748:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80274e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802754:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802756:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80275a:	c9                   	leave
+  80275b:	c3                   	ret
+
+000000000080275c <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80275c:	55                   	push   %rbp
+  80275d:	48 89 e5             	mov    %rsp,%rbp
+  802760:	53                   	push   %rbx
+  802761:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802764:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802769:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80276e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802773:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802778:	be 00 00 00 00       	mov    $0x0,%esi
+  80277d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802783:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802789:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80278b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80278f:	c9                   	leave
+  802790:	c3                   	ret
+
+0000000000802791 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802791:	55                   	push   %rbp
+  802792:	48 89 e5             	mov    %rsp,%rbp
+  802795:	53                   	push   %rbx
+  802796:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80279a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80279d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027c4:	48 85 c0             	test   %rax,%rax
+  8027c7:	7f 06                	jg     8027cf <sys_env_destroy+0x3e>
+}
+  8027c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027cd:	c9                   	leave
+  8027ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027cf:	49 89 c0             	mov    %rax,%r8
+  8027d2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8027d7:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  8027de:	00 00 00 
+  8027e1:	be 27 00 00 00       	mov    $0x27,%esi
+  8027e6:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  8027ed:	00 00 00 
+  8027f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f5:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  8027fc:	00 00 00 
+  8027ff:	41 ff d1             	call   *%r9
+
+0000000000802802 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802807:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80280c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802811:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80281b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802820:	be 00 00 00 00       	mov    $0x0,%esi
+  802825:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80282b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802831:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802833:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802837:	c9                   	leave
+  802838:	c3                   	ret
+
+0000000000802839 <sys_yield>:
+
+void
+sys_yield(void) {
+  802839:	55                   	push   %rbp
+  80283a:	48 89 e5             	mov    %rsp,%rbp
+  80283d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80283e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802843:	ba 00 00 00 00       	mov    $0x0,%edx
+  802848:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80284d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802852:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802857:	be 00 00 00 00       	mov    $0x0,%esi
+  80285c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802862:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802868:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80286a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80286e:	c9                   	leave
+  80286f:	c3                   	ret
+
+0000000000802870 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802870:	55                   	push   %rbp
+  802871:	48 89 e5             	mov    %rsp,%rbp
+  802874:	53                   	push   %rbx
+  802875:	48 89 fa             	mov    %rdi,%rdx
+  802878:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80287b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802880:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802887:	00 00 00 
+  80288a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80288f:	be 00 00 00 00       	mov    $0x0,%esi
+  802894:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80289a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028a0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8028a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028a6:	c9                   	leave
+  8028a7:	c3                   	ret
+
+00000000008028a8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	53                   	push   %rbx
+  8028ad:	49 89 f8             	mov    %rdi,%r8
+  8028b0:	48 89 d3             	mov    %rdx,%rbx
+  8028b3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8028b6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028bb:	4c 89 c2             	mov    %r8,%rdx
+  8028be:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028d2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8028d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028d8:	c9                   	leave
+  8028d9:	c3                   	ret
+
+00000000008028da <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8028da:	55                   	push   %rbp
+  8028db:	48 89 e5             	mov    %rsp,%rbp
+  8028de:	53                   	push   %rbx
+  8028df:	48 83 ec 08          	sub    $0x8,%rsp
+  8028e3:	89 f8                	mov    %edi,%eax
+  8028e5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8028e8:	48 63 f9             	movslq %ecx,%rdi
+  8028eb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ee:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028f3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802901:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802907:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802909:	48 85 c0             	test   %rax,%rax
+  80290c:	7f 06                	jg     802914 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80290e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802912:	c9                   	leave
+  802913:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802914:	49 89 c0             	mov    %rax,%r8
+  802917:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80291c:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802923:	00 00 00 
+  802926:	be 27 00 00 00       	mov    $0x27,%esi
+  80292b:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802932:	00 00 00 
+  802935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293a:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802941:	00 00 00 
+  802944:	41 ff d1             	call   *%r9
+
+0000000000802947 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802947:	55                   	push   %rbp
+  802948:	48 89 e5             	mov    %rsp,%rbp
+  80294b:	53                   	push   %rbx
+  80294c:	48 83 ec 08          	sub    $0x8,%rsp
+  802950:	89 f8                	mov    %edi,%eax
+  802952:	49 89 f2             	mov    %rsi,%r10
+  802955:	48 89 cf             	mov    %rcx,%rdi
+  802958:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80295b:	48 63 da             	movslq %edx,%rbx
+  80295e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802961:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802966:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802969:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  80296c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802972:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802974:	48 85 c0             	test   %rax,%rax
+  802977:	7f 06                	jg     80297f <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802979:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80297f:	49 89 c0             	mov    %rax,%r8
+  802982:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802987:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  80298e:	00 00 00 
+  802991:	be 27 00 00 00       	mov    $0x27,%esi
+  802996:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  80299d:	00 00 00 
+  8029a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a5:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  8029ac:	00 00 00 
+  8029af:	41 ff d1             	call   *%r9
+
+00000000008029b2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8029b2:	55                   	push   %rbp
+  8029b3:	48 89 e5             	mov    %rsp,%rbp
+  8029b6:	53                   	push   %rbx
+  8029b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bb:	48 89 f1             	mov    %rsi,%rcx
+  8029be:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8029c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029c4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029e1:	48 85 c0             	test   %rax,%rax
+  8029e4:	7f 06                	jg     8029ec <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8029e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029ea:	c9                   	leave
+  8029eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ec:	49 89 c0             	mov    %rax,%r8
+  8029ef:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029f4:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  8029fb:	00 00 00 
+  8029fe:	be 27 00 00 00       	mov    $0x27,%esi
+  802a03:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802a0a:	00 00 00 
+  802a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a12:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802a19:	00 00 00 
+  802a1c:	41 ff d1             	call   *%r9
+
+0000000000802a1f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a1f:	55                   	push   %rbp
+  802a20:	48 89 e5             	mov    %rsp,%rbp
+  802a23:	53                   	push   %rbx
+  802a24:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a28:	48 63 ce             	movslq %esi,%rcx
+  802a2b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a2e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a38:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a42:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a4e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a50:	48 85 c0             	test   %rax,%rax
+  802a53:	7f 06                	jg     802a5b <sys_env_set_status+0x3c>
+}
+  802a55:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a5b:	49 89 c0             	mov    %rax,%r8
+  802a5e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802a63:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802a6a:	00 00 00 
+  802a6d:	be 27 00 00 00       	mov    $0x27,%esi
+  802a72:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802a79:	00 00 00 
+  802a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a81:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802a88:	00 00 00 
+  802a8b:	41 ff d1             	call   *%r9
+
+0000000000802a8e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802a8e:	55                   	push   %rbp
+  802a8f:	48 89 e5             	mov    %rsp,%rbp
+  802a92:	53                   	push   %rbx
+  802a93:	48 83 ec 08          	sub    $0x8,%rsp
+  802a97:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802a9a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aac:	be 00 00 00 00       	mov    $0x0,%esi
+  802ab1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802abd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802abf:	48 85 c0             	test   %rax,%rax
+  802ac2:	7f 06                	jg     802aca <sys_env_set_trapframe+0x3c>
+}
+  802ac4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ac8:	c9                   	leave
+  802ac9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aca:	49 89 c0             	mov    %rax,%r8
+  802acd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802ad2:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802ad9:	00 00 00 
+  802adc:	be 27 00 00 00       	mov    $0x27,%esi
+  802ae1:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802ae8:	00 00 00 
+  802aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af0:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802af7:	00 00 00 
+  802afa:	41 ff d1             	call   *%r9
+
+0000000000802afd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802afd:	55                   	push   %rbp
+  802afe:	48 89 e5             	mov    %rsp,%rbp
+  802b01:	53                   	push   %rbx
+  802b02:	48 83 ec 08          	sub    $0x8,%rsp
+  802b06:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b09:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b2c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b2e:	48 85 c0             	test   %rax,%rax
+  802b31:	7f 06                	jg     802b39 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b37:	c9                   	leave
+  802b38:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b39:	49 89 c0             	mov    %rax,%r8
+  802b3c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b41:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802b48:	00 00 00 
+  802b4b:	be 27 00 00 00       	mov    $0x27,%esi
+  802b50:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802b57:	00 00 00 
+  802b5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5f:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802b66:	00 00 00 
+  802b69:	41 ff d1             	call   *%r9
+
+0000000000802b6c <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802b6c:	55                   	push   %rbp
+  802b6d:	48 89 e5             	mov    %rsp,%rbp
+  802b70:	53                   	push   %rbx
+  802b71:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802b75:	40 0f b6 ce          	movzbl %sil,%ecx
+  802b79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b7c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802b90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b9e:	48 85 c0             	test   %rax,%rax
+  802ba1:	7f 06                	jg     802ba9 <sys_env_set_reclaim+0x3d>
+}
+  802ba3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba7:	c9                   	leave
+  802ba8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ba9:	49 89 c0             	mov    %rax,%r8
+  802bac:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802bb1:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802bb8:	00 00 00 
+  802bbb:	be 27 00 00 00       	mov    $0x27,%esi
+  802bc0:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802bc7:	00 00 00 
+  802bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcf:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802bd6:	00 00 00 
+  802bd9:	41 ff d1             	call   *%r9
+
+0000000000802bdc <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802bdc:	55                   	push   %rbp
+  802bdd:	48 89 e5             	mov    %rsp,%rbp
+  802be0:	53                   	push   %rbx
+  802be1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802be5:	48 63 ce             	movslq %esi,%rcx
+  802be8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802beb:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfa:	be 00 00 00 00       	mov    $0x0,%esi
+  802bff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c0d:	48 85 c0             	test   %rax,%rax
+  802c10:	7f 06                	jg     802c18 <sys_env_set_nice+0x3c>
+}
+  802c12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c16:	c9                   	leave
+  802c17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c18:	49 89 c0             	mov    %rax,%r8
+  802c1b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c20:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802c27:	00 00 00 
+  802c2a:	be 27 00 00 00       	mov    $0x27,%esi
+  802c2f:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802c36:	00 00 00 
+  802c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3e:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802c45:	00 00 00 
+  802c48:	41 ff d1             	call   *%r9
+
+0000000000802c4b <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802c4b:	55                   	push   %rbp
+  802c4c:	48 89 e5             	mov    %rsp,%rbp
+  802c4f:	53                   	push   %rbx
+  802c50:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c53:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c67:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c78:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802c7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+0000000000802c80 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c80:	55                   	push   %rbp
+  802c81:	48 89 e5             	mov    %rsp,%rbp
+  802c84:	53                   	push   %rbx
+  802c85:	89 f8                	mov    %edi,%eax
+  802c87:	49 89 f1             	mov    %rsi,%r9
+  802c8a:	48 89 d3             	mov    %rdx,%rbx
+  802c8d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802c90:	49 63 f0             	movslq %r8d,%rsi
+  802c93:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c96:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c9b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ca4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802caa:	cd 30                	int    $0x30
+}
+  802cac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cb0:	c9                   	leave
+  802cb1:	c3                   	ret
+
+0000000000802cb2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cb2:	55                   	push   %rbp
+  802cb3:	48 89 e5             	mov    %rsp,%rbp
+  802cb6:	53                   	push   %rbx
+  802cb7:	89 f8                	mov    %edi,%eax
+  802cb9:	49 89 f1             	mov    %rsi,%r9
+  802cbc:	48 89 d3             	mov    %rdx,%rbx
+  802cbf:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cc2:	49 63 f0             	movslq %r8d,%rsi
+  802cc5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cc8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ccd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cd6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cdc:	cd 30                	int    $0x30
+}
+  802cde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce2:	c9                   	leave
+  802ce3:	c3                   	ret
+
+0000000000802ce4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802ce4:	55                   	push   %rbp
+  802ce5:	48 89 e5             	mov    %rsp,%rbp
+  802ce8:	53                   	push   %rbx
+  802ce9:	48 83 ec 08          	sub    $0x8,%rsp
+  802ced:	89 f8                	mov    %edi,%eax
+  802cef:	49 89 f2             	mov    %rsi,%r10
+  802cf2:	48 89 d3             	mov    %rdx,%rbx
+  802cf5:	48 89 cf             	mov    %rcx,%rdi
+  802cf8:	44 89 c6             	mov    %r8d,%esi
+  802cfb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cfe:	48 63 f6             	movslq %esi,%rsi
+  802d01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d04:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d09:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d0c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d12:	48 85 c0             	test   %rax,%rax
+  802d15:	7f 06                	jg     802d1d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d1d:	49 89 c0             	mov    %rax,%r8
+  802d20:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d25:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802d2c:	00 00 00 
+  802d2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802d34:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802d3b:	00 00 00 
+  802d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d43:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802d4a:	00 00 00 
+  802d4d:	41 ff d1             	call   *%r9
+
+0000000000802d50 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802d50:	55                   	push   %rbp
+  802d51:	48 89 e5             	mov    %rsp,%rbp
+  802d54:	53                   	push   %rbx
+  802d55:	48 83 ec 08          	sub    $0x8,%rsp
+  802d59:	48 89 f1             	mov    %rsi,%rcx
+  802d5c:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802d5f:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802d63:	48 8b 1a             	mov    (%rdx),%rbx
+  802d66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d69:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d6e:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d72:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802d76:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802d7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d7c:	48 85 c0             	test   %rax,%rax
+  802d7f:	7f 06                	jg     802d87 <sys_ipc_call_short+0x37>
+}
+  802d81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d85:	c9                   	leave
+  802d86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d87:	49 89 c0             	mov    %rax,%r8
+  802d8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802d8f:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802d96:	00 00 00 
+  802d99:	be 27 00 00 00       	mov    $0x27,%esi
+  802d9e:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802da5:	00 00 00 
+  802da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dad:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802db4:	00 00 00 
+  802db7:	41 ff d1             	call   *%r9
+
+0000000000802dba <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+  802dbe:	53                   	push   %rbx
+  802dbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc3:	89 f8                	mov    %edi,%eax
+  802dc5:	49 89 f2             	mov    %rsi,%r10
+  802dc8:	48 89 d3             	mov    %rdx,%rbx
+  802dcb:	48 89 cf             	mov    %rcx,%rdi
+  802dce:	44 89 c6             	mov    %r8d,%esi
+  802dd1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802dd4:	48 63 f6             	movslq %esi,%rsi
+  802dd7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dda:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ddf:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802de2:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802de6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802de8:	48 85 c0             	test   %rax,%rax
+  802deb:	7f 06                	jg     802df3 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ded:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802df1:	c9                   	leave
+  802df2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802df3:	49 89 c0             	mov    %rax,%r8
+  802df6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802dfb:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802e02:	00 00 00 
+  802e05:	be 27 00 00 00       	mov    $0x27,%esi
+  802e0a:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802e11:	00 00 00 
+  802e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e19:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802e20:	00 00 00 
+  802e23:	41 ff d1             	call   *%r9
+
+0000000000802e26 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e26:	55                   	push   %rbp
+  802e27:	48 89 e5             	mov    %rsp,%rbp
+  802e2a:	53                   	push   %rbx
+  802e2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e2f:	48 89 fa             	mov    %rdi,%rdx
+  802e32:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e35:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e44:	be 00 00 00 00       	mov    $0x0,%esi
+  802e49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e57:	48 85 c0             	test   %rax,%rax
+  802e5a:	7f 06                	jg     802e62 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e60:	c9                   	leave
+  802e61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e62:	49 89 c0             	mov    %rax,%r8
+  802e65:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802e6a:	48 ba 68 64 80 00 00 	movabs $0x806468,%rdx
+  802e71:	00 00 00 
+  802e74:	be 27 00 00 00       	mov    $0x27,%esi
+  802e79:	48 bf 87 64 80 00 00 	movabs $0x806487,%rdi
+  802e80:	00 00 00 
+  802e83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e88:	49 b9 ee 16 80 00 00 	movabs $0x8016ee,%r9
+  802e8f:	00 00 00 
+  802e92:	41 ff d1             	call   *%r9
+
+0000000000802e95 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802e95:	55                   	push   %rbp
+  802e96:	48 89 e5             	mov    %rsp,%rbp
+  802e99:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ea9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802eae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eb3:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ebe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ec4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ec6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eca:	c9                   	leave
+  802ecb:	c3                   	ret
+
+0000000000802ecc <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802ecc:	55                   	push   %rbp
+  802ecd:	48 89 e5             	mov    %rsp,%rbp
+  802ed0:	53                   	push   %rbx
+  802ed1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ed4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ed9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ede:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ee8:	be 00 00 00 00       	mov    $0x0,%esi
+  802eed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ef9:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802efb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eff:	c9                   	leave
+  802f00:	c3                   	ret
+
+0000000000802f01 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f01:	55                   	push   %rbp
+  802f02:	48 89 e5             	mov    %rsp,%rbp
+  802f05:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f06:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f10:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f30:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f36:	c9                   	leave
+  802f37:	c3                   	ret
+
+0000000000802f38 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802f38:	55                   	push   %rbp
+  802f39:	48 89 e5             	mov    %rsp,%rbp
+  802f3c:	53                   	push   %rbx
+  802f3d:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  802f41:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f46:	cd 30                	int    $0x30
+  802f48:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  802f4a:	85 c0                	test   %eax,%eax
+  802f4c:	0f 88 85 00 00 00    	js     802fd7 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  802f52:	0f 84 ac 00 00 00    	je     803004 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  802f58:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802f5e:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802f65:	00 00 00 
+  802f68:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f6d:	89 c2                	mov    %eax,%edx
+  802f6f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f79:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	0f 88 a8 00 00 00    	js     803035 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  802f8d:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  802f94:	00 00 00 
+  802f97:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  802f9e:	89 df                	mov    %ebx,%edi
+  802fa0:	48 b8 fd 2a 80 00 00 	movabs $0x802afd,%rax
+  802fa7:	00 00 00 
+  802faa:	ff d0                	call   *%rax
+  802fac:	85 c0                	test   %eax,%eax
+  802fae:	0f 88 ae 00 00 00    	js     803062 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  802fb4:	be 02 00 00 00       	mov    $0x2,%esi
+  802fb9:	89 df                	mov    %ebx,%edi
+  802fbb:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  802fc2:	00 00 00 
+  802fc5:	ff d0                	call   *%rax
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	0f 88 c0 00 00 00    	js     80308f <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  802fcf:	89 d8                	mov    %ebx,%eax
+  802fd1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  802fd7:	89 c1                	mov    %eax,%ecx
+  802fd9:	48 ba 95 64 80 00 00 	movabs $0x806495,%rdx
+  802fe0:	00 00 00 
+  802fe3:	be 20 00 00 00       	mov    $0x20,%esi
+  802fe8:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  802fef:	00 00 00 
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  802ffe:	00 00 00 
+  803001:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803004:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80300b:	00 00 00 
+  80300e:	ff d0                	call   *%rax
+  803010:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803015:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80301c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803023:	00 00 00 
+  803026:	48 01 d0             	add    %rdx,%rax
+  803029:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  803030:	00 00 00 
+        return 0;
+  803033:	eb 9a                	jmp    802fcf <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803035:	89 c1                	mov    %eax,%ecx
+  803037:	48 ba b0 64 80 00 00 	movabs $0x8064b0,%rdx
+  80303e:	00 00 00 
+  803041:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803046:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  80304d:	00 00 00 
+  803050:	b8 00 00 00 00       	mov    $0x0,%eax
+  803055:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  80305c:	00 00 00 
+  80305f:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803062:	89 c1                	mov    %eax,%ecx
+  803064:	48 ba f8 64 80 00 00 	movabs $0x8064f8,%rdx
+  80306b:	00 00 00 
+  80306e:	be 32 00 00 00       	mov    $0x32,%esi
+  803073:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  80307a:	00 00 00 
+  80307d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803082:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803089:	00 00 00 
+  80308c:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80308f:	89 c1                	mov    %eax,%ecx
+  803091:	48 ba c3 64 80 00 00 	movabs $0x8064c3,%rdx
+  803098:	00 00 00 
+  80309b:	be 37 00 00 00       	mov    $0x37,%esi
+  8030a0:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  8030a7:	00 00 00 
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030af:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  8030b6:	00 00 00 
+  8030b9:	41 ff d0             	call   *%r8
+
+00000000008030bc <sfork>:
+
+envid_t
+sfork() {
+  8030bc:	55                   	push   %rbp
+  8030bd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8030c0:	48 ba da 64 80 00 00 	movabs $0x8064da,%rdx
+  8030c7:	00 00 00 
+  8030ca:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8030cf:	48 bf a5 64 80 00 00 	movabs $0x8064a5,%rdi
+  8030d6:	00 00 00 
+  8030d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030de:	48 b9 ee 16 80 00 00 	movabs $0x8016ee,%rcx
+  8030e5:	00 00 00 
+  8030e8:	ff d1                	call   *%rcx
+
+00000000008030ea <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030ea:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030f1:	ff ff ff 
+  8030f4:	48 01 f8             	add    %rdi,%rax
+  8030f7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8030fb:	c3                   	ret
+
+00000000008030fc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030fc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803103:	ff ff ff 
+  803106:	48 01 f8             	add    %rdi,%rax
+  803109:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80310d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803113:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803117:	c3                   	ret
+
+0000000000803118 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803118:	55                   	push   %rbp
+  803119:	48 89 e5             	mov    %rsp,%rbp
+  80311c:	41 57                	push   %r15
+  80311e:	41 56                	push   %r14
+  803120:	41 55                	push   %r13
+  803122:	41 54                	push   %r12
+  803124:	53                   	push   %rbx
+  803125:	48 83 ec 08          	sub    $0x8,%rsp
+  803129:	49 89 ff             	mov    %rdi,%r15
+  80312c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803131:	49 bd 18 46 80 00 00 	movabs $0x804618,%r13
+  803138:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80313b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803141:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803144:	48 89 df             	mov    %rbx,%rdi
+  803147:	41 ff d5             	call   *%r13
+  80314a:	83 e0 04             	and    $0x4,%eax
+  80314d:	74 17                	je     803166 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80314f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803156:	4c 39 f3             	cmp    %r14,%rbx
+  803159:	75 e6                	jne    803141 <fd_alloc+0x29>
+  80315b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803161:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803166:	4d 89 27             	mov    %r12,(%r15)
+}
+  803169:	48 83 c4 08          	add    $0x8,%rsp
+  80316d:	5b                   	pop    %rbx
+  80316e:	41 5c                	pop    %r12
+  803170:	41 5d                	pop    %r13
+  803172:	41 5e                	pop    %r14
+  803174:	41 5f                	pop    %r15
+  803176:	5d                   	pop    %rbp
+  803177:	c3                   	ret
+
+0000000000803178 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803178:	83 ff 1f             	cmp    $0x1f,%edi
+  80317b:	77 39                	ja     8031b6 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80317d:	55                   	push   %rbp
+  80317e:	48 89 e5             	mov    %rsp,%rbp
+  803181:	41 54                	push   %r12
+  803183:	53                   	push   %rbx
+  803184:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803187:	48 63 df             	movslq %edi,%rbx
+  80318a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803191:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803195:	48 89 df             	mov    %rbx,%rdi
+  803198:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  80319f:	00 00 00 
+  8031a2:	ff d0                	call   *%rax
+  8031a4:	a8 04                	test   $0x4,%al
+  8031a6:	74 14                	je     8031bc <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8031a8:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8031ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031b1:	5b                   	pop    %rbx
+  8031b2:	41 5c                	pop    %r12
+  8031b4:	5d                   	pop    %rbp
+  8031b5:	c3                   	ret
+        return -E_INVAL;
+  8031b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031bb:	c3                   	ret
+        return -E_INVAL;
+  8031bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031c1:	eb ee                	jmp    8031b1 <fd_lookup+0x39>
+
+00000000008031c3 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031c3:	55                   	push   %rbp
+  8031c4:	48 89 e5             	mov    %rsp,%rbp
+  8031c7:	41 54                	push   %r12
+  8031c9:	53                   	push   %rbx
+  8031ca:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8031cd:	48 b8 a0 65 80 00 00 	movabs $0x8065a0,%rax
+  8031d4:	00 00 00 
+  8031d7:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8031de:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8031e1:	39 3b                	cmp    %edi,(%rbx)
+  8031e3:	74 47                	je     80322c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8031e5:	48 83 c0 08          	add    $0x8,%rax
+  8031e9:	48 8b 18             	mov    (%rax),%rbx
+  8031ec:	48 85 db             	test   %rbx,%rbx
+  8031ef:	75 f0                	jne    8031e1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031f1:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8031f8:	00 00 00 
+  8031fb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803201:	89 fa                	mov    %edi,%edx
+  803203:	48 bf 18 65 80 00 00 	movabs $0x806518,%rdi
+  80320a:	00 00 00 
+  80320d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803212:	48 b9 3e 18 80 00 00 	movabs $0x80183e,%rcx
+  803219:	00 00 00 
+  80321c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80321e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803223:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803227:	5b                   	pop    %rbx
+  803228:	41 5c                	pop    %r12
+  80322a:	5d                   	pop    %rbp
+  80322b:	c3                   	ret
+            return 0;
+  80322c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803231:	eb f0                	jmp    803223 <dev_lookup+0x60>
+
+0000000000803233 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803233:	55                   	push   %rbp
+  803234:	48 89 e5             	mov    %rsp,%rbp
+  803237:	41 55                	push   %r13
+  803239:	41 54                	push   %r12
+  80323b:	53                   	push   %rbx
+  80323c:	48 83 ec 18          	sub    $0x18,%rsp
+  803240:	48 89 fb             	mov    %rdi,%rbx
+  803243:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803246:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80324d:	ff ff ff 
+  803250:	48 01 df             	add    %rbx,%rdi
+  803253:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803257:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80325b:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803262:	00 00 00 
+  803265:	ff d0                	call   *%rax
+  803267:	41 89 c5             	mov    %eax,%r13d
+  80326a:	85 c0                	test   %eax,%eax
+  80326c:	78 06                	js     803274 <fd_close+0x41>
+  80326e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803272:	74 1a                	je     80328e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803274:	45 84 e4             	test   %r12b,%r12b
+  803277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803280:	44 89 e8             	mov    %r13d,%eax
+  803283:	48 83 c4 18          	add    $0x18,%rsp
+  803287:	5b                   	pop    %rbx
+  803288:	41 5c                	pop    %r12
+  80328a:	41 5d                	pop    %r13
+  80328c:	5d                   	pop    %rbp
+  80328d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80328e:	8b 3b                	mov    (%rbx),%edi
+  803290:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803294:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	41 89 c5             	mov    %eax,%r13d
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	78 1b                	js     8032c2 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8032a7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032ab:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8032af:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8032b5:	48 85 c0             	test   %rax,%rax
+  8032b8:	74 08                	je     8032c2 <fd_close+0x8f>
+  8032ba:	48 89 df             	mov    %rbx,%rdi
+  8032bd:	ff d0                	call   *%rax
+  8032bf:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032c7:	48 89 de             	mov    %rbx,%rsi
+  8032ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cf:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+    return res;
+  8032db:	eb a3                	jmp    803280 <fd_close+0x4d>
+
+00000000008032dd <close>:
+
+int
+close(int fdnum) {
+  8032dd:	55                   	push   %rbp
+  8032de:	48 89 e5             	mov    %rsp,%rbp
+  8032e1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032e5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032e9:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f5:	85 c0                	test   %eax,%eax
+  8032f7:	78 15                	js     80330e <close+0x31>
+
+    return fd_close(fd, 1);
+  8032f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8032fe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803302:	48 b8 33 32 80 00 00 	movabs $0x803233,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+}
+  80330e:	c9                   	leave
+  80330f:	c3                   	ret
+
+0000000000803310 <close_all>:
+
+void
+close_all(void) {
+  803310:	55                   	push   %rbp
+  803311:	48 89 e5             	mov    %rsp,%rbp
+  803314:	41 54                	push   %r12
+  803316:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80331c:	49 bc dd 32 80 00 00 	movabs $0x8032dd,%r12
+  803323:	00 00 00 
+  803326:	89 df                	mov    %ebx,%edi
+  803328:	41 ff d4             	call   *%r12
+  80332b:	83 c3 01             	add    $0x1,%ebx
+  80332e:	83 fb 20             	cmp    $0x20,%ebx
+  803331:	75 f3                	jne    803326 <close_all+0x16>
+}
+  803333:	5b                   	pop    %rbx
+  803334:	41 5c                	pop    %r12
+  803336:	5d                   	pop    %rbp
+  803337:	c3                   	ret
+
+0000000000803338 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803338:	55                   	push   %rbp
+  803339:	48 89 e5             	mov    %rsp,%rbp
+  80333c:	41 57                	push   %r15
+  80333e:	41 56                	push   %r14
+  803340:	41 55                	push   %r13
+  803342:	41 54                	push   %r12
+  803344:	53                   	push   %rbx
+  803345:	48 83 ec 18          	sub    $0x18,%rsp
+  803349:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80334c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803350:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803357:	00 00 00 
+  80335a:	ff d0                	call   *%rax
+  80335c:	89 c3                	mov    %eax,%ebx
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	0f 88 b8 00 00 00    	js     80341e <dup+0xe6>
+    close(newfdnum);
+  803366:	44 89 e7             	mov    %r12d,%edi
+  803369:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803375:	4d 63 ec             	movslq %r12d,%r13
+  803378:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80337f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803383:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803387:	4c 89 ff             	mov    %r15,%rdi
+  80338a:	49 be fc 30 80 00 00 	movabs $0x8030fc,%r14
+  803391:	00 00 00 
+  803394:	41 ff d6             	call   *%r14
+  803397:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80339a:	4c 89 ef             	mov    %r13,%rdi
+  80339d:	41 ff d6             	call   *%r14
+  8033a0:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8033a3:	48 89 df             	mov    %rbx,%rdi
+  8033a6:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8033b2:	a8 04                	test   $0x4,%al
+  8033b4:	74 2b                	je     8033e1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8033b6:	41 89 c1             	mov    %eax,%r9d
+  8033b9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033bf:	4c 89 f1             	mov    %r14,%rcx
+  8033c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c7:	48 89 de             	mov    %rbx,%rsi
+  8033ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033cf:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  8033d6:	00 00 00 
+  8033d9:	ff d0                	call   *%rax
+  8033db:	89 c3                	mov    %eax,%ebx
+  8033dd:	85 c0                	test   %eax,%eax
+  8033df:	78 4e                	js     80342f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8033e1:	4c 89 ff             	mov    %r15,%rdi
+  8033e4:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  8033eb:	00 00 00 
+  8033ee:	ff d0                	call   *%rax
+  8033f0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8033f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033f9:	4c 89 e9             	mov    %r13,%rcx
+  8033fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803401:	4c 89 fe             	mov    %r15,%rsi
+  803404:	bf 00 00 00 00       	mov    $0x0,%edi
+  803409:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  803410:	00 00 00 
+  803413:	ff d0                	call   *%rax
+  803415:	89 c3                	mov    %eax,%ebx
+  803417:	85 c0                	test   %eax,%eax
+  803419:	78 14                	js     80342f <dup+0xf7>
+
+    return newfdnum;
+  80341b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80341e:	89 d8                	mov    %ebx,%eax
+  803420:	48 83 c4 18          	add    $0x18,%rsp
+  803424:	5b                   	pop    %rbx
+  803425:	41 5c                	pop    %r12
+  803427:	41 5d                	pop    %r13
+  803429:	41 5e                	pop    %r14
+  80342b:	41 5f                	pop    %r15
+  80342d:	5d                   	pop    %rbp
+  80342e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80342f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803434:	4c 89 ee             	mov    %r13,%rsi
+  803437:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343c:	49 bc b2 29 80 00 00 	movabs $0x8029b2,%r12
+  803443:	00 00 00 
+  803446:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803449:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80344e:	4c 89 f6             	mov    %r14,%rsi
+  803451:	bf 00 00 00 00       	mov    $0x0,%edi
+  803456:	41 ff d4             	call   *%r12
+    return res;
+  803459:	eb c3                	jmp    80341e <dup+0xe6>
+
+000000000080345b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	41 56                	push   %r14
+  803461:	41 55                	push   %r13
+  803463:	41 54                	push   %r12
+  803465:	53                   	push   %rbx
+  803466:	48 83 ec 10          	sub    $0x10,%rsp
+  80346a:	89 fb                	mov    %edi,%ebx
+  80346c:	49 89 f4             	mov    %rsi,%r12
+  80346f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803472:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803476:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+  803482:	85 c0                	test   %eax,%eax
+  803484:	78 4c                	js     8034d2 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803486:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80348a:	41 8b 3e             	mov    (%r14),%edi
+  80348d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803491:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	78 35                	js     8034d6 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8034a1:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8034a5:	83 e0 03             	and    $0x3,%eax
+  8034a8:	83 f8 01             	cmp    $0x1,%eax
+  8034ab:	74 2d                	je     8034da <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8034ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8034b5:	48 85 c0             	test   %rax,%rax
+  8034b8:	74 56                	je     803510 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8034ba:	4c 89 ea             	mov    %r13,%rdx
+  8034bd:	4c 89 e6             	mov    %r12,%rsi
+  8034c0:	4c 89 f7             	mov    %r14,%rdi
+  8034c3:	ff d0                	call   *%rax
+}
+  8034c5:	48 83 c4 10          	add    $0x10,%rsp
+  8034c9:	5b                   	pop    %rbx
+  8034ca:	41 5c                	pop    %r12
+  8034cc:	41 5d                	pop    %r13
+  8034ce:	41 5e                	pop    %r14
+  8034d0:	5d                   	pop    %rbp
+  8034d1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034d2:	48 98                	cltq
+  8034d4:	eb ef                	jmp    8034c5 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034d6:	48 98                	cltq
+  8034d8:	eb eb                	jmp    8034c5 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034da:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8034e1:	00 00 00 
+  8034e4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034ea:	89 da                	mov    %ebx,%edx
+  8034ec:	48 bf 59 65 80 00 00 	movabs $0x806559,%rdi
+  8034f3:	00 00 00 
+  8034f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fb:	48 b9 3e 18 80 00 00 	movabs $0x80183e,%rcx
+  803502:	00 00 00 
+  803505:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803507:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80350e:	eb b5                	jmp    8034c5 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803510:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803517:	eb ac                	jmp    8034c5 <read+0x6a>
+
+0000000000803519 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803519:	55                   	push   %rbp
+  80351a:	48 89 e5             	mov    %rsp,%rbp
+  80351d:	41 57                	push   %r15
+  80351f:	41 56                	push   %r14
+  803521:	41 55                	push   %r13
+  803523:	41 54                	push   %r12
+  803525:	53                   	push   %rbx
+  803526:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80352a:	48 85 d2             	test   %rdx,%rdx
+  80352d:	74 54                	je     803583 <readn+0x6a>
+  80352f:	41 89 fd             	mov    %edi,%r13d
+  803532:	49 89 f6             	mov    %rsi,%r14
+  803535:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803538:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80353d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803542:	49 bf 5b 34 80 00 00 	movabs $0x80345b,%r15
+  803549:	00 00 00 
+  80354c:	4c 89 e2             	mov    %r12,%rdx
+  80354f:	48 29 f2             	sub    %rsi,%rdx
+  803552:	4c 01 f6             	add    %r14,%rsi
+  803555:	44 89 ef             	mov    %r13d,%edi
+  803558:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80355b:	85 c0                	test   %eax,%eax
+  80355d:	78 20                	js     80357f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80355f:	01 c3                	add    %eax,%ebx
+  803561:	85 c0                	test   %eax,%eax
+  803563:	74 08                	je     80356d <readn+0x54>
+  803565:	48 63 f3             	movslq %ebx,%rsi
+  803568:	4c 39 e6             	cmp    %r12,%rsi
+  80356b:	72 df                	jb     80354c <readn+0x33>
+    }
+    return res;
+  80356d:	48 63 c3             	movslq %ebx,%rax
+}
+  803570:	48 83 c4 08          	add    $0x8,%rsp
+  803574:	5b                   	pop    %rbx
+  803575:	41 5c                	pop    %r12
+  803577:	41 5d                	pop    %r13
+  803579:	41 5e                	pop    %r14
+  80357b:	41 5f                	pop    %r15
+  80357d:	5d                   	pop    %rbp
+  80357e:	c3                   	ret
+        if (inc < 0) return inc;
+  80357f:	48 98                	cltq
+  803581:	eb ed                	jmp    803570 <readn+0x57>
+    int inc = 1, res = 0;
+  803583:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803588:	eb e3                	jmp    80356d <readn+0x54>
+
+000000000080358a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80358a:	55                   	push   %rbp
+  80358b:	48 89 e5             	mov    %rsp,%rbp
+  80358e:	41 56                	push   %r14
+  803590:	41 55                	push   %r13
+  803592:	41 54                	push   %r12
+  803594:	53                   	push   %rbx
+  803595:	48 83 ec 10          	sub    $0x10,%rsp
+  803599:	89 fb                	mov    %edi,%ebx
+  80359b:	49 89 f4             	mov    %rsi,%r12
+  80359e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035a1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035a5:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+  8035b1:	85 c0                	test   %eax,%eax
+  8035b3:	78 47                	js     8035fc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035b5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035b9:	41 8b 3e             	mov    (%r14),%edi
+  8035bc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035c0:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	78 30                	js     803600 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035d0:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8035d5:	74 2d                	je     803604 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8035d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035db:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035df:	48 85 c0             	test   %rax,%rax
+  8035e2:	74 56                	je     80363a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8035e4:	4c 89 ea             	mov    %r13,%rdx
+  8035e7:	4c 89 e6             	mov    %r12,%rsi
+  8035ea:	4c 89 f7             	mov    %r14,%rdi
+  8035ed:	ff d0                	call   *%rax
+}
+  8035ef:	48 83 c4 10          	add    $0x10,%rsp
+  8035f3:	5b                   	pop    %rbx
+  8035f4:	41 5c                	pop    %r12
+  8035f6:	41 5d                	pop    %r13
+  8035f8:	41 5e                	pop    %r14
+  8035fa:	5d                   	pop    %rbp
+  8035fb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035fc:	48 98                	cltq
+  8035fe:	eb ef                	jmp    8035ef <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803600:	48 98                	cltq
+  803602:	eb eb                	jmp    8035ef <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803604:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80360b:	00 00 00 
+  80360e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803614:	89 da                	mov    %ebx,%edx
+  803616:	48 bf 75 65 80 00 00 	movabs $0x806575,%rdi
+  80361d:	00 00 00 
+  803620:	b8 00 00 00 00       	mov    $0x0,%eax
+  803625:	48 b9 3e 18 80 00 00 	movabs $0x80183e,%rcx
+  80362c:	00 00 00 
+  80362f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803631:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803638:	eb b5                	jmp    8035ef <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80363a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803641:	eb ac                	jmp    8035ef <write+0x65>
+
+0000000000803643 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803643:	55                   	push   %rbp
+  803644:	48 89 e5             	mov    %rsp,%rbp
+  803647:	53                   	push   %rbx
+  803648:	48 83 ec 18          	sub    $0x18,%rsp
+  80364c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80364e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803652:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803659:	00 00 00 
+  80365c:	ff d0                	call   *%rax
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	78 0c                	js     80366e <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803666:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803669:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80366e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803672:	c9                   	leave
+  803673:	c3                   	ret
+
+0000000000803674 <tell>:
+
+int tell(int fdnum) {
+  803674:	55                   	push   %rbp
+  803675:	48 89 e5             	mov    %rsp,%rbp
+  803678:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80367c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803680:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803687:	00 00 00 
+  80368a:	ff d0                	call   *%rax
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	78 07                	js     803697 <tell+0x23>
+
+    return fd->fd_offset;
+  803690:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803694:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803697:	c9                   	leave
+  803698:	c3                   	ret
+
+0000000000803699 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803699:	55                   	push   %rbp
+  80369a:	48 89 e5             	mov    %rsp,%rbp
+  80369d:	41 55                	push   %r13
+  80369f:	41 54                	push   %r12
+  8036a1:	53                   	push   %rbx
+  8036a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8036a6:	89 fb                	mov    %edi,%ebx
+  8036a8:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036af:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	78 38                	js     8036f7 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036bf:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8036c3:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8036c7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036cb:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  8036d2:	00 00 00 
+  8036d5:	ff d0                	call   *%rax
+  8036d7:	85 c0                	test   %eax,%eax
+  8036d9:	78 1c                	js     8036f7 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036db:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8036e0:	74 20                	je     803702 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8036e2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036e6:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036ea:	48 85 c0             	test   %rax,%rax
+  8036ed:	74 47                	je     803736 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8036ef:	44 89 e6             	mov    %r12d,%esi
+  8036f2:	4c 89 ef             	mov    %r13,%rdi
+  8036f5:	ff d0                	call   *%rax
+}
+  8036f7:	48 83 c4 18          	add    $0x18,%rsp
+  8036fb:	5b                   	pop    %rbx
+  8036fc:	41 5c                	pop    %r12
+  8036fe:	41 5d                	pop    %r13
+  803700:	5d                   	pop    %rbp
+  803701:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803702:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803709:	00 00 00 
+  80370c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803712:	89 da                	mov    %ebx,%edx
+  803714:	48 bf 38 65 80 00 00 	movabs $0x806538,%rdi
+  80371b:	00 00 00 
+  80371e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803723:	48 b9 3e 18 80 00 00 	movabs $0x80183e,%rcx
+  80372a:	00 00 00 
+  80372d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80372f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803734:	eb c1                	jmp    8036f7 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803736:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80373b:	eb ba                	jmp    8036f7 <ftruncate+0x5e>
+
+000000000080373d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80373d:	55                   	push   %rbp
+  80373e:	48 89 e5             	mov    %rsp,%rbp
+  803741:	41 54                	push   %r12
+  803743:	53                   	push   %rbx
+  803744:	48 83 ec 10          	sub    $0x10,%rsp
+  803748:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80374b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80374f:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803756:	00 00 00 
+  803759:	ff d0                	call   *%rax
+  80375b:	85 c0                	test   %eax,%eax
+  80375d:	78 63                	js     8037c2 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80375f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803763:	41 8b 3c 24          	mov    (%r12),%edi
+  803767:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80376b:	48 b8 c3 31 80 00 00 	movabs $0x8031c3,%rax
+  803772:	00 00 00 
+  803775:	ff d0                	call   *%rax
+  803777:	85 c0                	test   %eax,%eax
+  803779:	78 47                	js     8037c2 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80377b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80377f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803784:	74 45                	je     8037cb <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803786:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803789:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803790:	00 00 00 
+    stat->st_isdir = 0;
+  803793:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80379a:	00 00 00 
+    stat->st_ino = 0;
+  80379d:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8037a4:	00 00 00 00 
+    stat->st_version = 0;
+  8037a8:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8037af:	00 00 00 
+    stat->st_dev = dev;
+  8037b2:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8037b9:	48 89 de             	mov    %rbx,%rsi
+  8037bc:	4c 89 e7             	mov    %r12,%rdi
+  8037bf:	ff 50 28             	call   *0x28(%rax)
+}
+  8037c2:	48 83 c4 10          	add    $0x10,%rsp
+  8037c6:	5b                   	pop    %rbx
+  8037c7:	41 5c                	pop    %r12
+  8037c9:	5d                   	pop    %rbp
+  8037ca:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037cb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037d0:	eb f0                	jmp    8037c2 <fstat+0x85>
+
+00000000008037d2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037d2:	55                   	push   %rbp
+  8037d3:	48 89 e5             	mov    %rsp,%rbp
+  8037d6:	41 54                	push   %r12
+  8037d8:	53                   	push   %rbx
+  8037d9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8037dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8037e1:	48 b8 f3 3c 80 00 00 	movabs $0x803cf3,%rax
+  8037e8:	00 00 00 
+  8037eb:	ff d0                	call   *%rax
+  8037ed:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8037ef:	85 c0                	test   %eax,%eax
+  8037f1:	78 25                	js     803818 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8037f3:	4c 89 e6             	mov    %r12,%rsi
+  8037f6:	89 c7                	mov    %eax,%edi
+  8037f8:	48 b8 3d 37 80 00 00 	movabs $0x80373d,%rax
+  8037ff:	00 00 00 
+  803802:	ff d0                	call   *%rax
+  803804:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803807:	89 df                	mov    %ebx,%edi
+  803809:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  803810:	00 00 00 
+  803813:	ff d0                	call   *%rax
+
+    return res;
+  803815:	44 89 e3             	mov    %r12d,%ebx
+}
+  803818:	89 d8                	mov    %ebx,%eax
+  80381a:	5b                   	pop    %rbx
+  80381b:	41 5c                	pop    %r12
+  80381d:	5d                   	pop    %rbp
+  80381e:	c3                   	ret
+
+000000000080381f <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80381f:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803826:	00 00 00 
+  803829:	83 38 00             	cmpl   $0x0,(%rax)
+  80382c:	74 0a                	je     803838 <fsipc_env+0x19>
+    return fsenv;
+}
+  80382e:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803835:	00 00 
+  803837:	c3                   	ret
+fsipc_env(void) {
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80383c:	bf 03 00 00 00       	mov    $0x3,%edi
+  803841:	48 b8 22 59 80 00 00 	movabs $0x805922,%rax
+  803848:	00 00 00 
+  80384b:	ff d0                	call   *%rax
+  80384d:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803854:	00 00 
+}
+  803856:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80385d:	00 00 
+  80385f:	5d                   	pop    %rbp
+  803860:	c3                   	ret
+
+0000000000803861 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803861:	55                   	push   %rbp
+  803862:	48 89 e5             	mov    %rsp,%rbp
+  803865:	53                   	push   %rbx
+  803866:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80386a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803871:	00 
+  803872:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803879:	00 
+  80387a:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803881:	00 
+  803882:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803889:	00 
+  80388a:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803891:	00 
+
+    assert(size <= sizeof(words));
+  803892:	48 83 fa 28          	cmp    $0x28,%rdx
+  803896:	77 38                	ja     8038d0 <fsipc_short+0x6f>
+  803898:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  80389a:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80389e:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8038aa:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  8038b1:	00 00 00 
+  8038b4:	ff d0                	call   *%rax
+  8038b6:	89 c7                	mov    %eax,%edi
+  8038b8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8038bc:	89 de                	mov    %ebx,%esi
+  8038be:	48 b8 85 58 80 00 00 	movabs $0x805885,%rax
+  8038c5:	00 00 00 
+  8038c8:	ff d0                	call   *%rax
+}
+  8038ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038ce:	c9                   	leave
+  8038cf:	c3                   	ret
+    assert(size <= sizeof(words));
+  8038d0:	48 b9 c0 65 80 00 00 	movabs $0x8065c0,%rcx
+  8038d7:	00 00 00 
+  8038da:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  8038e1:	00 00 00 
+  8038e4:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8038e9:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  8038f0:	00 00 00 
+  8038f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f8:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  8038ff:	00 00 00 
+  803902:	41 ff d0             	call   *%r8
+
+0000000000803905 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803905:	55                   	push   %rbp
+  803906:	48 89 e5             	mov    %rsp,%rbp
+  803909:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80390d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803910:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803913:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803916:	ba 08 00 00 00       	mov    $0x8,%edx
+  80391b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80391f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803924:	48 b8 61 38 80 00 00 	movabs $0x803861,%rax
+  80392b:	00 00 00 
+  80392e:	ff d0                	call   *%rax
+}
+  803930:	c9                   	leave
+  803931:	c3                   	ret
+
+0000000000803932 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803932:	55                   	push   %rbp
+  803933:	48 89 e5             	mov    %rsp,%rbp
+  803936:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80393a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80393d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803940:	ba 04 00 00 00       	mov    $0x4,%edx
+  803945:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803949:	bf 06 00 00 00       	mov    $0x6,%edi
+  80394e:	48 b8 61 38 80 00 00 	movabs $0x803861,%rax
+  803955:	00 00 00 
+  803958:	ff d0                	call   *%rax
+}
+  80395a:	c9                   	leave
+  80395b:	c3                   	ret
+
+000000000080395c <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  80395c:	55                   	push   %rbp
+  80395d:	48 89 e5             	mov    %rsp,%rbp
+  803960:	41 54                	push   %r12
+  803962:	53                   	push   %rbx
+  803963:	48 83 ec 10          	sub    $0x10,%rsp
+  803967:	89 fb                	mov    %edi,%ebx
+  803969:	49 89 f4             	mov    %rsi,%r12
+  80396c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803970:	48 b8 1f 38 80 00 00 	movabs $0x80381f,%rax
+  803977:	00 00 00 
+  80397a:	ff d0                	call   *%rax
+  80397c:	89 c7                	mov    %eax,%edi
+  80397e:	6a 00                	push   $0x0
+  803980:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803984:	50                   	push   %rax
+  803985:	4d 89 e1             	mov    %r12,%r9
+  803988:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80398e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803993:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  80399a:	00 00 00 
+  80399d:	89 de                	mov    %ebx,%esi
+  80399f:	48 b8 20 58 80 00 00 	movabs $0x805820,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+}
+  8039ab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8039af:	5b                   	pop    %rbx
+  8039b0:	41 5c                	pop    %r12
+  8039b2:	5d                   	pop    %rbp
+  8039b3:	c3                   	ret
+
+00000000008039b4 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8039b4:	55                   	push   %rbp
+  8039b5:	48 89 e5             	mov    %rsp,%rbp
+  8039b8:	41 54                	push   %r12
+  8039ba:	53                   	push   %rbx
+  8039bb:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039be:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039c1:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8039c8:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8039d4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039d9:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	78 5a                	js     803a43 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039e9:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8039f0:	00 00 00 
+  8039f3:	4c 89 e6             	mov    %r12,%rsi
+  8039f6:	48 89 df             	mov    %rbx,%rdi
+  8039f9:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  803a00:	00 00 00 
+  803a03:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803a05:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803a0c:	00 
+  803a0d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a13:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a1a:	00 
+  803a1b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a21:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803a28:	00 
+  803a29:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803a30:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803a37:	00 
+  803a38:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a43:	5b                   	pop    %rbx
+  803a44:	41 5c                	pop    %r12
+  803a46:	5d                   	pop    %rbp
+  803a47:	c3                   	ret
+
+0000000000803a48 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a48:	55                   	push   %rbp
+  803a49:	48 89 e5             	mov    %rsp,%rbp
+  803a4c:	41 57                	push   %r15
+  803a4e:	41 56                	push   %r14
+  803a50:	41 55                	push   %r13
+  803a52:	41 54                	push   %r12
+  803a54:	53                   	push   %rbx
+  803a55:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803a59:	48 85 ff             	test   %rdi,%rdi
+  803a5c:	0f 84 a1 00 00 00    	je     803b03 <devfile_read+0xbb>
+  803a62:	49 89 ff             	mov    %rdi,%r15
+  803a65:	49 89 f5             	mov    %rsi,%r13
+  803a68:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803a6b:	48 85 f6             	test   %rsi,%rsi
+  803a6e:	0f 84 c4 00 00 00    	je     803b38 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803a74:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a7b:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a7c:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803a83:	00 00 00 
+  803a86:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803a8a:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803a8d:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a96:	be 00 00 00 00       	mov    $0x0,%esi
+  803a9b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803aa0:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  803aa7:	00 00 00 
+  803aaa:	ff d0                	call   *%rax
+        if (res < 0) {
+  803aac:	85 c0                	test   %eax,%eax
+  803aae:	0f 88 b9 00 00 00    	js     803b6d <devfile_read+0x125>
+        assert(res <= n);
+  803ab4:	48 63 d8             	movslq %eax,%rbx
+  803ab7:	49 39 dc             	cmp    %rbx,%r12
+  803aba:	0f 82 b1 00 00 00    	jb     803b71 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ac0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803ac5:	0f 87 db 00 00 00    	ja     803ba6 <devfile_read+0x15e>
+        if (!res) {
+  803acb:	85 c0                	test   %eax,%eax
+  803acd:	74 21                	je     803af0 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803acf:	48 89 da             	mov    %rbx,%rdx
+  803ad2:	4c 89 f6             	mov    %r14,%rsi
+  803ad5:	4c 89 ef             	mov    %r13,%rdi
+  803ad8:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  803adf:	00 00 00 
+  803ae2:	ff d0                	call   *%rax
+        total_read += res;
+  803ae4:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803ae8:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803aeb:	49 29 dc             	sub    %rbx,%r12
+  803aee:	75 96                	jne    803a86 <devfile_read+0x3e>
+    return total_read;
+  803af0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803af4:	48 83 c4 18          	add    $0x18,%rsp
+  803af8:	5b                   	pop    %rbx
+  803af9:	41 5c                	pop    %r12
+  803afb:	41 5d                	pop    %r13
+  803afd:	41 5e                	pop    %r14
+  803aff:	41 5f                	pop    %r15
+  803b01:	5d                   	pop    %rbp
+  803b02:	c3                   	ret
+    assert(fd);
+  803b03:	48 b9 f6 65 80 00 00 	movabs $0x8065f6,%rcx
+  803b0a:	00 00 00 
+  803b0d:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803b14:	00 00 00 
+  803b17:	be 91 00 00 00       	mov    $0x91,%esi
+  803b1c:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803b23:	00 00 00 
+  803b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2b:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803b32:	00 00 00 
+  803b35:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b38:	48 b9 f9 65 80 00 00 	movabs $0x8065f9,%rcx
+  803b3f:	00 00 00 
+  803b42:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803b49:	00 00 00 
+  803b4c:	be 92 00 00 00       	mov    $0x92,%esi
+  803b51:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803b58:	00 00 00 
+  803b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b60:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803b67:	00 00 00 
+  803b6a:	41 ff d0             	call   *%r8
+            return res;
+  803b6d:	48 98                	cltq
+  803b6f:	eb 83                	jmp    803af4 <devfile_read+0xac>
+        assert(res <= n);
+  803b71:	48 b9 fd 65 80 00 00 	movabs $0x8065fd,%rcx
+  803b78:	00 00 00 
+  803b7b:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803b82:	00 00 00 
+  803b85:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803b8a:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803b91:	00 00 00 
+  803b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b99:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803ba0:	00 00 00 
+  803ba3:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ba6:	48 b9 08 66 80 00 00 	movabs $0x806608,%rcx
+  803bad:	00 00 00 
+  803bb0:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803bb7:	00 00 00 
+  803bba:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803bbf:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803bc6:	00 00 00 
+  803bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bce:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803bd5:	00 00 00 
+  803bd8:	41 ff d0             	call   *%r8
+
+0000000000803bdb <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bdb:	55                   	push   %rbp
+  803bdc:	48 89 e5             	mov    %rsp,%rbp
+  803bdf:	41 57                	push   %r15
+  803be1:	41 56                	push   %r14
+  803be3:	41 55                	push   %r13
+  803be5:	41 54                	push   %r12
+  803be7:	53                   	push   %rbx
+  803be8:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803bec:	48 85 ff             	test   %rdi,%rdi
+  803bef:	0f 84 83 00 00 00    	je     803c78 <devfile_write+0x9d>
+  803bf5:	49 89 ff             	mov    %rdi,%r15
+  803bf8:	49 89 f4             	mov    %rsi,%r12
+  803bfb:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803bfe:	48 85 f6             	test   %rsi,%rsi
+  803c01:	0f 84 a6 00 00 00    	je     803cad <devfile_write+0xd2>
+    size_t total_written = 0;
+  803c07:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c0d:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c14:	00 00 00 
+  803c17:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c1b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c1e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c22:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803c27:	48 39 d3             	cmp    %rdx,%rbx
+  803c2a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803c2e:	4c 89 e6             	mov    %r12,%rsi
+  803c31:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803c38:	00 00 00 
+  803c3b:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  803c42:	00 00 00 
+  803c45:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c4c:	be 00 00 00 00       	mov    $0x0,%esi
+  803c51:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c56:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  803c5d:	00 00 00 
+  803c60:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c62:	85 c0                	test   %eax,%eax
+  803c64:	78 7c                	js     803ce2 <devfile_write+0x107>
+        total_written += res;
+  803c66:	48 98                	cltq
+  803c68:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803c6b:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803c6e:	48 29 c3             	sub    %rax,%rbx
+  803c71:	75 a4                	jne    803c17 <devfile_write+0x3c>
+    return total_written;
+  803c73:	4c 89 e8             	mov    %r13,%rax
+  803c76:	eb 6c                	jmp    803ce4 <devfile_write+0x109>
+    assert(fd);
+  803c78:	48 b9 f6 65 80 00 00 	movabs $0x8065f6,%rcx
+  803c7f:	00 00 00 
+  803c82:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803c89:	00 00 00 
+  803c8c:	be bd 00 00 00       	mov    $0xbd,%esi
+  803c91:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803c98:	00 00 00 
+  803c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ca0:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803ca7:	00 00 00 
+  803caa:	41 ff d0             	call   *%r8
+    assert(buf);
+  803cad:	48 b9 f9 65 80 00 00 	movabs $0x8065f9,%rcx
+  803cb4:	00 00 00 
+  803cb7:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  803cbe:	00 00 00 
+  803cc1:	be be 00 00 00       	mov    $0xbe,%esi
+  803cc6:	48 bf eb 65 80 00 00 	movabs $0x8065eb,%rdi
+  803ccd:	00 00 00 
+  803cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd5:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  803cdc:	00 00 00 
+  803cdf:	41 ff d0             	call   *%r8
+            return res;
+  803ce2:	48 98                	cltq
+}
+  803ce4:	48 83 c4 08          	add    $0x8,%rsp
+  803ce8:	5b                   	pop    %rbx
+  803ce9:	41 5c                	pop    %r12
+  803ceb:	41 5d                	pop    %r13
+  803ced:	41 5e                	pop    %r14
+  803cef:	41 5f                	pop    %r15
+  803cf1:	5d                   	pop    %rbp
+  803cf2:	c3                   	ret
+
+0000000000803cf3 <open>:
+open(const char *path, int mode) {
+  803cf3:	55                   	push   %rbp
+  803cf4:	48 89 e5             	mov    %rsp,%rbp
+  803cf7:	41 55                	push   %r13
+  803cf9:	41 54                	push   %r12
+  803cfb:	53                   	push   %rbx
+  803cfc:	48 83 ec 18          	sub    $0x18,%rsp
+  803d00:	49 89 fc             	mov    %rdi,%r12
+  803d03:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803d06:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  803d0d:	00 00 00 
+  803d10:	ff d0                	call   *%rax
+  803d12:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803d18:	0f 87 8f 00 00 00    	ja     803dad <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d1e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d22:	48 b8 18 31 80 00 00 	movabs $0x803118,%rax
+  803d29:	00 00 00 
+  803d2c:	ff d0                	call   *%rax
+  803d2e:	89 c3                	mov    %eax,%ebx
+  803d30:	85 c0                	test   %eax,%eax
+  803d32:	78 55                	js     803d89 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d34:	4c 89 e6             	mov    %r12,%rsi
+  803d37:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803d3e:	00 00 00 
+  803d41:	48 89 df             	mov    %rbx,%rdi
+  803d44:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d50:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d5c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d60:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d65:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  803d6c:	00 00 00 
+  803d6f:	ff d0                	call   *%rax
+  803d71:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d73:	85 c0                	test   %eax,%eax
+  803d75:	78 1f                	js     803d96 <open+0xa3>
+    return fd2num(fd);
+  803d77:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d7b:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  803d82:	00 00 00 
+  803d85:	ff d0                	call   *%rax
+  803d87:	89 c3                	mov    %eax,%ebx
+}
+  803d89:	89 d8                	mov    %ebx,%eax
+  803d8b:	48 83 c4 18          	add    $0x18,%rsp
+  803d8f:	5b                   	pop    %rbx
+  803d90:	41 5c                	pop    %r12
+  803d92:	41 5d                	pop    %r13
+  803d94:	5d                   	pop    %rbp
+  803d95:	c3                   	ret
+        fd_close(fd, 0);
+  803d96:	be 00 00 00 00       	mov    $0x0,%esi
+  803d9b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d9f:	48 b8 33 32 80 00 00 	movabs $0x803233,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+        return res;
+  803dab:	eb dc                	jmp    803d89 <open+0x96>
+        return -E_BAD_PATH;
+  803dad:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803db2:	eb d5                	jmp    803d89 <open+0x96>
+
+0000000000803db4 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803db4:	55                   	push   %rbp
+  803db5:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dbd:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc2:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dc7:	48 b8 61 38 80 00 00 	movabs $0x803861,%rax
+  803dce:	00 00 00 
+  803dd1:	ff d0                	call   *%rax
+}
+  803dd3:	5d                   	pop    %rbp
+  803dd4:	c3                   	ret
+
+0000000000803dd5 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803dd5:	55                   	push   %rbp
+  803dd6:	48 89 e5             	mov    %rsp,%rbp
+  803dd9:	41 56                	push   %r14
+  803ddb:	41 55                	push   %r13
+  803ddd:	41 54                	push   %r12
+  803ddf:	53                   	push   %rbx
+  803de0:	48 83 ec 10          	sub    $0x10,%rsp
+  803de4:	41 89 f6             	mov    %esi,%r14d
+  803de7:	49 89 d4             	mov    %rdx,%r12
+  803dea:	48 89 cb             	mov    %rcx,%rbx
+  803ded:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803df0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803df4:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803dfb:	00 00 00 
+  803dfe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e00:	85 c0                	test   %eax,%eax
+  803e02:	78 46                	js     803e4a <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e04:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e08:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803e0f:	00 00 00 
+  803e12:	8b 00                	mov    (%rax),%eax
+  803e14:	39 02                	cmp    %eax,(%rdx)
+  803e16:	75 3f                	jne    803e57 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803e18:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e1f:	00 00 00 
+  803e22:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e25:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803e27:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803e2b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803e2f:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803e33:	48 89 da             	mov    %rbx,%rdx
+  803e36:	4c 89 e6             	mov    %r12,%rsi
+  803e39:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e3e:	48 b8 5c 39 80 00 00 	movabs $0x80395c,%rax
+  803e45:	00 00 00 
+  803e48:	ff d0                	call   *%rax
+}
+  803e4a:	48 83 c4 10          	add    $0x10,%rsp
+  803e4e:	5b                   	pop    %rbx
+  803e4f:	41 5c                	pop    %r12
+  803e51:	41 5d                	pop    %r13
+  803e53:	41 5e                	pop    %r14
+  803e55:	5d                   	pop    %rbp
+  803e56:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e57:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e5c:	eb ec                	jmp    803e4a <file_map+0x75>
+
+0000000000803e5e <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803e5e:	55                   	push   %rbp
+  803e5f:	48 89 e5             	mov    %rsp,%rbp
+  803e62:	41 54                	push   %r12
+  803e64:	53                   	push   %rbx
+  803e65:	48 83 ec 20          	sub    $0x20,%rsp
+  803e69:	41 89 f4             	mov    %esi,%r12d
+  803e6c:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e6f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803e73:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  803e7a:	00 00 00 
+  803e7d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e7f:	85 c0                	test   %eax,%eax
+  803e81:	78 3c                	js     803ebf <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e87:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803e8e:	00 00 00 
+  803e91:	8b 0a                	mov    (%rdx),%ecx
+  803e93:	39 08                	cmp    %ecx,(%rax)
+  803e95:	75 31                	jne    803ec8 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803e97:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e9a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803e9d:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803ea1:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803ea5:	ba 10 00 00 00       	mov    $0x10,%edx
+  803eaa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803eae:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803eb3:	48 b8 61 38 80 00 00 	movabs $0x803861,%rax
+  803eba:	00 00 00 
+  803ebd:	ff d0                	call   *%rax
+}
+  803ebf:	48 83 c4 20          	add    $0x20,%rsp
+  803ec3:	5b                   	pop    %rbx
+  803ec4:	41 5c                	pop    %r12
+  803ec6:	5d                   	pop    %rbp
+  803ec7:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ec8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ecd:	eb f0                	jmp    803ebf <file_msync+0x61>
+
+0000000000803ecf <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ecf:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803ed3:	7f 01                	jg     803ed6 <writebuf+0x7>
+  803ed5:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ed6:	55                   	push   %rbp
+  803ed7:	48 89 e5             	mov    %rsp,%rbp
+  803eda:	53                   	push   %rbx
+  803edb:	48 83 ec 08          	sub    $0x8,%rsp
+  803edf:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ee2:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ee6:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803eea:	8b 3f                	mov    (%rdi),%edi
+  803eec:	48 b8 8a 35 80 00 00 	movabs $0x80358a,%rax
+  803ef3:	00 00 00 
+  803ef6:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803ef8:	48 85 c0             	test   %rax,%rax
+  803efb:	7e 04                	jle    803f01 <writebuf+0x32>
+  803efd:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803f01:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803f05:	48 39 c2             	cmp    %rax,%rdx
+  803f08:	74 0f                	je     803f19 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803f0a:	48 85 c0             	test   %rax,%rax
+  803f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f12:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803f16:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803f19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f1d:	c9                   	leave
+  803f1e:	c3                   	ret
+
+0000000000803f1f <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f1f:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f22:	8d 50 01             	lea    0x1(%rax),%edx
+  803f25:	89 56 04             	mov    %edx,0x4(%rsi)
+  803f28:	48 98                	cltq
+  803f2a:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803f2f:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803f35:	74 01                	je     803f38 <putch+0x19>
+  803f37:	c3                   	ret
+putch(int ch, void *arg) {
+  803f38:	55                   	push   %rbp
+  803f39:	48 89 e5             	mov    %rsp,%rbp
+  803f3c:	53                   	push   %rbx
+  803f3d:	48 83 ec 08          	sub    $0x8,%rsp
+  803f41:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803f44:	48 89 f7             	mov    %rsi,%rdi
+  803f47:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  803f4e:	00 00 00 
+  803f51:	ff d0                	call   *%rax
+        state->offset = 0;
+  803f53:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803f5a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f5e:	c9                   	leave
+  803f5f:	c3                   	ret
+
+0000000000803f60 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f60:	55                   	push   %rbp
+  803f61:	48 89 e5             	mov    %rsp,%rbp
+  803f64:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803f6b:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803f6e:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803f74:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803f7b:	00 00 00 
+    state.result = 0;
+  803f7e:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803f85:	00 00 00 00 
+    state.error = 1;
+  803f89:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803f90:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803f93:	48 89 f2             	mov    %rsi,%rdx
+  803f96:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803f9d:	48 bf 1f 3f 80 00 00 	movabs $0x803f1f,%rdi
+  803fa4:	00 00 00 
+  803fa7:	48 b8 8e 19 80 00 00 	movabs $0x80198e,%rax
+  803fae:	00 00 00 
+  803fb1:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803fb3:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803fba:	7f 14                	jg     803fd0 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803fbc:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803fc3:	48 85 c0             	test   %rax,%rax
+  803fc6:	75 06                	jne    803fce <vfprintf+0x6e>
+  803fc8:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803fce:	c9                   	leave
+  803fcf:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803fd0:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803fd7:	48 b8 cf 3e 80 00 00 	movabs $0x803ecf,%rax
+  803fde:	00 00 00 
+  803fe1:	ff d0                	call   *%rax
+  803fe3:	eb d7                	jmp    803fbc <vfprintf+0x5c>
+
+0000000000803fe5 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803fe5:	55                   	push   %rbp
+  803fe6:	48 89 e5             	mov    %rsp,%rbp
+  803fe9:	48 83 ec 50          	sub    $0x50,%rsp
+  803fed:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ff1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803ff5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803ff9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ffd:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804004:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804008:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80400c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804010:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804014:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804018:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804024:	c9                   	leave
+  804025:	c3                   	ret
+
+0000000000804026 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804026:	55                   	push   %rbp
+  804027:	48 89 e5             	mov    %rsp,%rbp
+  80402a:	48 83 ec 50          	sub    $0x50,%rsp
+  80402e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804032:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804036:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80403a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80403e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804042:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804049:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80404d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804051:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804055:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804059:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80405d:	48 89 fe             	mov    %rdi,%rsi
+  804060:	bf 01 00 00 00       	mov    $0x1,%edi
+  804065:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  80406c:	00 00 00 
+  80406f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804071:	c9                   	leave
+  804072:	c3                   	ret
+
+0000000000804073 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804073:	55                   	push   %rbp
+  804074:	48 89 e5             	mov    %rsp,%rbp
+  804077:	41 54                	push   %r12
+  804079:	53                   	push   %rbx
+  80407a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80407d:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804084:	00 00 00 
+  804087:	ff d0                	call   *%rax
+  804089:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80408c:	48 be 30 66 80 00 00 	movabs $0x806630,%rsi
+  804093:	00 00 00 
+  804096:	48 89 df             	mov    %rbx,%rdi
+  804099:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  8040a0:	00 00 00 
+  8040a3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8040a5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8040aa:	41 2b 04 24          	sub    (%r12),%eax
+  8040ae:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8040b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040bb:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040be:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8040c5:	00 00 00 
+  8040c8:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8040cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d4:	5b                   	pop    %rbx
+  8040d5:	41 5c                	pop    %r12
+  8040d7:	5d                   	pop    %rbp
+  8040d8:	c3                   	ret
+
+00000000008040d9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8040d9:	55                   	push   %rbp
+  8040da:	48 89 e5             	mov    %rsp,%rbp
+  8040dd:	41 54                	push   %r12
+  8040df:	53                   	push   %rbx
+  8040e0:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8040e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040e8:	48 89 fe             	mov    %rdi,%rsi
+  8040eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040f0:	49 bc b2 29 80 00 00 	movabs $0x8029b2,%r12
+  8040f7:	00 00 00 
+  8040fa:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8040fd:	48 89 df             	mov    %rbx,%rdi
+  804100:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804107:	00 00 00 
+  80410a:	ff d0                	call   *%rax
+  80410c:	48 89 c6             	mov    %rax,%rsi
+  80410f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804114:	bf 00 00 00 00       	mov    $0x0,%edi
+  804119:	41 ff d4             	call   *%r12
+}
+  80411c:	5b                   	pop    %rbx
+  80411d:	41 5c                	pop    %r12
+  80411f:	5d                   	pop    %rbp
+  804120:	c3                   	ret
+
+0000000000804121 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804121:	55                   	push   %rbp
+  804122:	48 89 e5             	mov    %rsp,%rbp
+  804125:	41 57                	push   %r15
+  804127:	41 56                	push   %r14
+  804129:	41 55                	push   %r13
+  80412b:	41 54                	push   %r12
+  80412d:	53                   	push   %rbx
+  80412e:	48 83 ec 18          	sub    $0x18,%rsp
+  804132:	49 89 fc             	mov    %rdi,%r12
+  804135:	49 89 f5             	mov    %rsi,%r13
+  804138:	49 89 d7             	mov    %rdx,%r15
+  80413b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80413f:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80414b:	4d 85 ff             	test   %r15,%r15
+  80414e:	0f 84 af 00 00 00    	je     804203 <devpipe_write+0xe2>
+  804154:	48 89 c3             	mov    %rax,%rbx
+  804157:	4c 89 f8             	mov    %r15,%rax
+  80415a:	4d 89 ef             	mov    %r13,%r15
+  80415d:	4c 01 e8             	add    %r13,%rax
+  804160:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804164:	49 bd a8 28 80 00 00 	movabs $0x8028a8,%r13
+  80416b:	00 00 00 
+            sys_yield();
+  80416e:	49 be 39 28 80 00 00 	movabs $0x802839,%r14
+  804175:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804178:	8b 73 04             	mov    0x4(%rbx),%esi
+  80417b:	48 63 ce             	movslq %esi,%rcx
+  80417e:	48 63 03             	movslq (%rbx),%rax
+  804181:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804187:	48 39 c1             	cmp    %rax,%rcx
+  80418a:	72 2e                	jb     8041ba <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80418c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804191:	48 89 da             	mov    %rbx,%rdx
+  804194:	be 00 10 00 00       	mov    $0x1000,%esi
+  804199:	4c 89 e7             	mov    %r12,%rdi
+  80419c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80419f:	85 c0                	test   %eax,%eax
+  8041a1:	74 66                	je     804209 <devpipe_write+0xe8>
+            sys_yield();
+  8041a3:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8041a6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8041a9:	48 63 ce             	movslq %esi,%rcx
+  8041ac:	48 63 03             	movslq (%rbx),%rax
+  8041af:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8041b5:	48 39 c1             	cmp    %rax,%rcx
+  8041b8:	73 d2                	jae    80418c <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041ba:	41 0f b6 3f          	movzbl (%r15),%edi
+  8041be:	48 89 ca             	mov    %rcx,%rdx
+  8041c1:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041c5:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8041cc:	08 10 20 
+  8041cf:	48 f7 e2             	mul    %rdx
+  8041d2:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041d6:	48 89 d0             	mov    %rdx,%rax
+  8041d9:	48 c1 e0 09          	shl    $0x9,%rax
+  8041dd:	48 29 d0             	sub    %rdx,%rax
+  8041e0:	48 c1 e0 03          	shl    $0x3,%rax
+  8041e4:	48 29 c1             	sub    %rax,%rcx
+  8041e7:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8041ec:	83 c6 01             	add    $0x1,%esi
+  8041ef:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041f2:	49 83 c7 01          	add    $0x1,%r15
+  8041f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041fa:	49 39 c7             	cmp    %rax,%r15
+  8041fd:	0f 85 75 ff ff ff    	jne    804178 <devpipe_write+0x57>
+    return n;
+  804203:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804207:	eb 05                	jmp    80420e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804209:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80420e:	48 83 c4 18          	add    $0x18,%rsp
+  804212:	5b                   	pop    %rbx
+  804213:	41 5c                	pop    %r12
+  804215:	41 5d                	pop    %r13
+  804217:	41 5e                	pop    %r14
+  804219:	41 5f                	pop    %r15
+  80421b:	5d                   	pop    %rbp
+  80421c:	c3                   	ret
+
+000000000080421d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80421d:	55                   	push   %rbp
+  80421e:	48 89 e5             	mov    %rsp,%rbp
+  804221:	41 57                	push   %r15
+  804223:	41 56                	push   %r14
+  804225:	41 55                	push   %r13
+  804227:	41 54                	push   %r12
+  804229:	53                   	push   %rbx
+  80422a:	48 83 ec 18          	sub    $0x18,%rsp
+  80422e:	49 89 fc             	mov    %rdi,%r12
+  804231:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804235:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804239:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804240:	00 00 00 
+  804243:	ff d0                	call   *%rax
+  804245:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804248:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80424e:	49 bd a8 28 80 00 00 	movabs $0x8028a8,%r13
+  804255:	00 00 00 
+            sys_yield();
+  804258:	49 be 39 28 80 00 00 	movabs $0x802839,%r14
+  80425f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804262:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804267:	74 7d                	je     8042e6 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804269:	8b 03                	mov    (%rbx),%eax
+  80426b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80426e:	75 26                	jne    804296 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804270:	4d 85 ff             	test   %r15,%r15
+  804273:	75 77                	jne    8042ec <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804275:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80427a:	48 89 da             	mov    %rbx,%rdx
+  80427d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804282:	4c 89 e7             	mov    %r12,%rdi
+  804285:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804288:	85 c0                	test   %eax,%eax
+  80428a:	74 72                	je     8042fe <devpipe_read+0xe1>
+            sys_yield();
+  80428c:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80428f:	8b 03                	mov    (%rbx),%eax
+  804291:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804294:	74 df                	je     804275 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804296:	48 63 c8             	movslq %eax,%rcx
+  804299:	48 89 ca             	mov    %rcx,%rdx
+  80429c:	48 c1 ea 03          	shr    $0x3,%rdx
+  8042a0:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8042a7:	08 10 20 
+  8042aa:	48 89 d0             	mov    %rdx,%rax
+  8042ad:	48 f7 e6             	mul    %rsi
+  8042b0:	48 c1 ea 06          	shr    $0x6,%rdx
+  8042b4:	48 89 d0             	mov    %rdx,%rax
+  8042b7:	48 c1 e0 09          	shl    $0x9,%rax
+  8042bb:	48 29 d0             	sub    %rdx,%rax
+  8042be:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8042c5:	00 
+  8042c6:	48 89 c8             	mov    %rcx,%rax
+  8042c9:	48 29 d0             	sub    %rdx,%rax
+  8042cc:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8042d1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042d5:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8042d9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042dc:	49 83 c7 01          	add    $0x1,%r15
+  8042e0:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8042e4:	75 83                	jne    804269 <devpipe_read+0x4c>
+    return n;
+  8042e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042ea:	eb 03                	jmp    8042ef <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8042ec:	4c 89 f8             	mov    %r15,%rax
+}
+  8042ef:	48 83 c4 18          	add    $0x18,%rsp
+  8042f3:	5b                   	pop    %rbx
+  8042f4:	41 5c                	pop    %r12
+  8042f6:	41 5d                	pop    %r13
+  8042f8:	41 5e                	pop    %r14
+  8042fa:	41 5f                	pop    %r15
+  8042fc:	5d                   	pop    %rbp
+  8042fd:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8042fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804303:	eb ea                	jmp    8042ef <devpipe_read+0xd2>
+
+0000000000804305 <pipe>:
+pipe(int pfd[2]) {
+  804305:	55                   	push   %rbp
+  804306:	48 89 e5             	mov    %rsp,%rbp
+  804309:	41 55                	push   %r13
+  80430b:	41 54                	push   %r12
+  80430d:	53                   	push   %rbx
+  80430e:	48 83 ec 18          	sub    $0x18,%rsp
+  804312:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804315:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804319:	48 b8 18 31 80 00 00 	movabs $0x803118,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+  804325:	89 c3                	mov    %eax,%ebx
+  804327:	85 c0                	test   %eax,%eax
+  804329:	0f 88 a0 01 00 00    	js     8044cf <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80432f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804334:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804339:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80433d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804342:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  804349:	00 00 00 
+  80434c:	ff d0                	call   *%rax
+  80434e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804350:	85 c0                	test   %eax,%eax
+  804352:	0f 88 77 01 00 00    	js     8044cf <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804358:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80435c:	48 b8 18 31 80 00 00 	movabs $0x803118,%rax
+  804363:	00 00 00 
+  804366:	ff d0                	call   *%rax
+  804368:	89 c3                	mov    %eax,%ebx
+  80436a:	85 c0                	test   %eax,%eax
+  80436c:	0f 88 43 01 00 00    	js     8044b5 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804372:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804377:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804380:	bf 00 00 00 00       	mov    $0x0,%edi
+  804385:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  80438c:	00 00 00 
+  80438f:	ff d0                	call   *%rax
+  804391:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804393:	85 c0                	test   %eax,%eax
+  804395:	0f 88 1a 01 00 00    	js     8044b5 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80439b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80439f:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+  8043ab:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8043ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b8:	48 89 c6             	mov    %rax,%rsi
+  8043bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c0:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  8043c7:	00 00 00 
+  8043ca:	ff d0                	call   *%rax
+  8043cc:	89 c3                	mov    %eax,%ebx
+  8043ce:	85 c0                	test   %eax,%eax
+  8043d0:	0f 88 c5 00 00 00    	js     80449b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043d6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043da:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+  8043e6:	48 89 c1             	mov    %rax,%rcx
+  8043e9:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8043ef:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8043f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043fa:	4c 89 ee             	mov    %r13,%rsi
+  8043fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804402:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+  80440e:	89 c3                	mov    %eax,%ebx
+  804410:	85 c0                	test   %eax,%eax
+  804412:	78 6e                	js     804482 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804414:	be 00 10 00 00       	mov    $0x1000,%esi
+  804419:	4c 89 ef             	mov    %r13,%rdi
+  80441c:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+  804428:	83 f8 02             	cmp    $0x2,%eax
+  80442b:	0f 85 ab 00 00 00    	jne    8044dc <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804431:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804438:	00 00 
+  80443a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80443e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804440:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804444:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80444b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80444f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804451:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804455:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80445c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804460:	48 bb ea 30 80 00 00 	movabs $0x8030ea,%rbx
+  804467:	00 00 00 
+  80446a:	ff d3                	call   *%rbx
+  80446c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804470:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804474:	ff d3                	call   *%rbx
+  804476:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80447b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804480:	eb 4d                	jmp    8044cf <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804482:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804487:	4c 89 ee             	mov    %r13,%rsi
+  80448a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80448f:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  804496:	00 00 00 
+  804499:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80449b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044a0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a9:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8044b0:	00 00 00 
+  8044b3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8044b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044c3:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+}
+  8044cf:	89 d8                	mov    %ebx,%eax
+  8044d1:	48 83 c4 18          	add    $0x18,%rsp
+  8044d5:	5b                   	pop    %rbx
+  8044d6:	41 5c                	pop    %r12
+  8044d8:	41 5d                	pop    %r13
+  8044da:	5d                   	pop    %rbp
+  8044db:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044dc:	48 b9 48 66 80 00 00 	movabs $0x806648,%rcx
+  8044e3:	00 00 00 
+  8044e6:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  8044ed:	00 00 00 
+  8044f0:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8044f5:	48 bf 37 66 80 00 00 	movabs $0x806637,%rdi
+  8044fc:	00 00 00 
+  8044ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804504:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  80450b:	00 00 00 
+  80450e:	41 ff d0             	call   *%r8
+
+0000000000804511 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804511:	55                   	push   %rbp
+  804512:	48 89 e5             	mov    %rsp,%rbp
+  804515:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804519:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80451d:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  804524:	00 00 00 
+  804527:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804529:	85 c0                	test   %eax,%eax
+  80452b:	78 35                	js     804562 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80452d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804531:	48 b8 fc 30 80 00 00 	movabs $0x8030fc,%rax
+  804538:	00 00 00 
+  80453b:	ff d0                	call   *%rax
+  80453d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804540:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804545:	be 00 10 00 00       	mov    $0x1000,%esi
+  80454a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80454e:	48 b8 a8 28 80 00 00 	movabs $0x8028a8,%rax
+  804555:	00 00 00 
+  804558:	ff d0                	call   *%rax
+  80455a:	85 c0                	test   %eax,%eax
+  80455c:	0f 94 c0             	sete   %al
+  80455f:	0f b6 c0             	movzbl %al,%eax
+}
+  804562:	c9                   	leave
+  804563:	c3                   	ret
+
+0000000000804564 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804564:	48 89 f8             	mov    %rdi,%rax
+  804567:	48 c1 e8 27          	shr    $0x27,%rax
+  80456b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804572:	01 00 00 
+  804575:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804579:	f6 c2 01             	test   $0x1,%dl
+  80457c:	74 6d                	je     8045eb <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80457e:	48 89 f8             	mov    %rdi,%rax
+  804581:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804585:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80458c:	01 00 00 
+  80458f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804593:	f6 c2 01             	test   $0x1,%dl
+  804596:	74 62                	je     8045fa <get_uvpt_entry+0x96>
+  804598:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80459f:	01 00 00 
+  8045a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045a6:	f6 c2 80             	test   $0x80,%dl
+  8045a9:	75 4f                	jne    8045fa <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045ab:	48 89 f8             	mov    %rdi,%rax
+  8045ae:	48 c1 e8 15          	shr    $0x15,%rax
+  8045b2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045b9:	01 00 00 
+  8045bc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045c0:	f6 c2 01             	test   $0x1,%dl
+  8045c3:	74 44                	je     804609 <get_uvpt_entry+0xa5>
+  8045c5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045cc:	01 00 00 
+  8045cf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045d3:	f6 c2 80             	test   $0x80,%dl
+  8045d6:	75 31                	jne    804609 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045d8:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045dc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045e3:	01 00 00 
+  8045e6:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8045ea:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045eb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045f2:	01 00 00 
+  8045f5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045f9:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045fa:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804601:	01 00 00 
+  804604:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804608:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804609:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804610:	01 00 00 
+  804613:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804617:	c3                   	ret
+
+0000000000804618 <get_prot>:
+
+int
+get_prot(void *va) {
+  804618:	55                   	push   %rbp
+  804619:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80461c:	48 b8 64 45 80 00 00 	movabs $0x804564,%rax
+  804623:	00 00 00 
+  804626:	ff d0                	call   *%rax
+  804628:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80462b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804630:	89 c1                	mov    %eax,%ecx
+  804632:	83 c9 04             	or     $0x4,%ecx
+  804635:	f6 c2 01             	test   $0x1,%dl
+  804638:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80463b:	89 c1                	mov    %eax,%ecx
+  80463d:	83 c9 02             	or     $0x2,%ecx
+  804640:	f6 c2 02             	test   $0x2,%dl
+  804643:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804646:	89 c1                	mov    %eax,%ecx
+  804648:	83 c9 01             	or     $0x1,%ecx
+  80464b:	48 85 d2             	test   %rdx,%rdx
+  80464e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804651:	89 c1                	mov    %eax,%ecx
+  804653:	83 c9 40             	or     $0x40,%ecx
+  804656:	f6 c6 04             	test   $0x4,%dh
+  804659:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80465c:	5d                   	pop    %rbp
+  80465d:	c3                   	ret
+
+000000000080465e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80465e:	55                   	push   %rbp
+  80465f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804662:	48 b8 64 45 80 00 00 	movabs $0x804564,%rax
+  804669:	00 00 00 
+  80466c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80466e:	48 c1 e8 06          	shr    $0x6,%rax
+  804672:	83 e0 01             	and    $0x1,%eax
+}
+  804675:	5d                   	pop    %rbp
+  804676:	c3                   	ret
+
+0000000000804677 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804677:	55                   	push   %rbp
+  804678:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80467b:	48 b8 64 45 80 00 00 	movabs $0x804564,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+  804687:	83 e0 01             	and    $0x1,%eax
+}
+  80468a:	5d                   	pop    %rbp
+  80468b:	c3                   	ret
+
+000000000080468c <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80468c:	55                   	push   %rbp
+  80468d:	48 89 e5             	mov    %rsp,%rbp
+  804690:	41 57                	push   %r15
+  804692:	41 56                	push   %r14
+  804694:	41 55                	push   %r13
+  804696:	41 54                	push   %r12
+  804698:	53                   	push   %rbx
+  804699:	48 83 ec 28          	sub    $0x28,%rsp
+  80469d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8046a1:	48 85 ff             	test   %rdi,%rdi
+  8046a4:	74 1e                	je     8046c4 <foreach_shared_region+0x38>
+  8046a6:	49 89 ff             	mov    %rdi,%r15
+  8046a9:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8046af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8046b5:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8046bc:	01 00 00 
+  8046bf:	e9 72 02 00 00       	jmp    804936 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8046c4:	48 b9 6c 66 80 00 00 	movabs $0x80666c,%rcx
+  8046cb:	00 00 00 
+  8046ce:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  8046d5:	00 00 00 
+  8046d8:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8046dd:	48 bf 70 66 80 00 00 	movabs $0x806670,%rdi
+  8046e4:	00 00 00 
+  8046e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ec:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  8046f3:	00 00 00 
+  8046f6:	41 ff d0             	call   *%r8
+  8046f9:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804700:	eb 6c                	jmp    80476e <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804702:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804709:	ff ff ff 
+  80470c:	4c 21 e2             	and    %r12,%rdx
+  80470f:	48 89 d8             	mov    %rbx,%rax
+  804712:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804717:	48 83 c0 01          	add    $0x1,%rax
+  80471b:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80471f:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804726:	00 00 00 
+  804729:	48 21 c8             	and    %rcx,%rax
+  80472c:	48 09 d0             	or     %rdx,%rax
+  80472f:	49 89 c4             	mov    %rax,%r12
+  804732:	eb 30                	jmp    804764 <foreach_shared_region+0xd8>
+  804734:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80473b:	ff ff ff 
+  80473e:	4c 21 e2             	and    %r12,%rdx
+  804741:	48 89 d8             	mov    %rbx,%rax
+  804744:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804749:	48 83 c0 01          	add    $0x1,%rax
+  80474d:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804751:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804758:	00 00 00 
+  80475b:	48 21 c8             	and    %rcx,%rax
+  80475e:	48 09 d0             	or     %rdx,%rax
+  804761:	49 89 c4             	mov    %rax,%r12
+  804764:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804768:	0f 84 99 01 00 00    	je     804907 <foreach_shared_region+0x27b>
+  80476e:	4c 89 e3             	mov    %r12,%rbx
+  804771:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804775:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80477c:	01 00 00 
+  80477f:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804783:	a8 01                	test   $0x1,%al
+  804785:	0f 84 77 ff ff ff    	je     804702 <foreach_shared_region+0x76>
+  80478b:	a8 80                	test   $0x80,%al
+  80478d:	74 19                	je     8047a8 <foreach_shared_region+0x11c>
+  80478f:	f6 c4 04             	test   $0x4,%ah
+  804792:	74 a0                	je     804734 <foreach_shared_region+0xa8>
+  804794:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80479b:	40 
+  80479c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8047a0:	4c 89 e7             	mov    %r12,%rdi
+  8047a3:	41 ff d7             	call   *%r15
+  8047a6:	eb 8c                	jmp    804734 <foreach_shared_region+0xa8>
+  8047a8:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8047af:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8047b3:	eb 46                	jmp    8047fb <foreach_shared_region+0x16f>
+  8047b5:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047bc:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047c2:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047c6:	48 c1 e0 15          	shl    $0x15,%rax
+  8047ca:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047cf:	49 09 c4             	or     %rax,%r12
+  8047d2:	eb 1d                	jmp    8047f1 <foreach_shared_region+0x165>
+  8047d4:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047db:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047e1:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047e5:	48 c1 e0 15          	shl    $0x15,%rax
+  8047e9:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047ee:	49 09 c4             	or     %rax,%r12
+  8047f1:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8047f5:	0f 84 d3 00 00 00    	je     8048ce <foreach_shared_region+0x242>
+  8047fb:	4c 89 e3             	mov    %r12,%rbx
+  8047fe:	48 c1 eb 15          	shr    $0x15,%rbx
+  804802:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804809:	01 00 00 
+  80480c:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804810:	a8 01                	test   $0x1,%al
+  804812:	74 a1                	je     8047b5 <foreach_shared_region+0x129>
+  804814:	a8 80                	test   $0x80,%al
+  804816:	74 19                	je     804831 <foreach_shared_region+0x1a5>
+  804818:	f6 c4 04             	test   $0x4,%ah
+  80481b:	74 b7                	je     8047d4 <foreach_shared_region+0x148>
+  80481d:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804824:	00 
+  804825:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804829:	4c 89 e7             	mov    %r12,%rdi
+  80482c:	41 ff d7             	call   *%r15
+  80482f:	eb a3                	jmp    8047d4 <foreach_shared_region+0x148>
+  804831:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804837:	eb 3b                	jmp    804874 <foreach_shared_region+0x1e8>
+  804839:	f6 c4 04             	test   $0x4,%ah
+  80483c:	74 12                	je     804850 <foreach_shared_region+0x1c4>
+  80483e:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804845:	00 
+  804846:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80484a:	4c 89 e7             	mov    %r12,%rdi
+  80484d:	41 ff d7             	call   *%r15
+  804850:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804857:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80485d:	48 83 c3 01          	add    $0x1,%rbx
+  804861:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804865:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80486b:	49 09 dc             	or     %rbx,%r12
+  80486e:	41 83 ed 01          	sub    $0x1,%r13d
+  804872:	74 2f                	je     8048a3 <foreach_shared_region+0x217>
+  804874:	4c 89 e3             	mov    %r12,%rbx
+  804877:	48 c1 eb 0c          	shr    $0xc,%rbx
+  80487b:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  80487f:	a8 01                	test   $0x1,%al
+  804881:	75 b6                	jne    804839 <foreach_shared_region+0x1ad>
+  804883:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80488a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804890:	48 83 c3 01          	add    $0x1,%rbx
+  804894:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804898:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  80489e:	49 09 dc             	or     %rbx,%r12
+  8048a1:	eb cb                	jmp    80486e <foreach_shared_region+0x1e2>
+  8048a3:	4c 89 e0             	mov    %r12,%rax
+  8048a6:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8048ac:	49 c1 ec 15          	shr    $0x15,%r12
+  8048b0:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048b7:	49 83 c4 01          	add    $0x1,%r12
+  8048bb:	49 c1 e4 15          	shl    $0x15,%r12
+  8048bf:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8048c6:	49 09 c4             	or     %rax,%r12
+  8048c9:	e9 23 ff ff ff       	jmp    8047f1 <foreach_shared_region+0x165>
+  8048ce:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8048d2:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8048d9:	ff ff ff 
+  8048dc:	4c 21 e0             	and    %r12,%rax
+  8048df:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8048e3:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048ea:	49 83 c4 01          	add    $0x1,%r12
+  8048ee:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8048f2:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8048f9:	00 00 00 
+  8048fc:	49 21 d4             	and    %rdx,%r12
+  8048ff:	49 09 c4             	or     %rax,%r12
+  804902:	e9 5d fe ff ff       	jmp    804764 <foreach_shared_region+0xd8>
+  804907:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80490e:	00 ff ff 
+  804911:	4c 21 e0             	and    %r12,%rax
+  804914:	49 c1 ec 27          	shr    $0x27,%r12
+  804918:	49 83 c4 01          	add    $0x1,%r12
+  80491c:	49 c1 e4 27          	shl    $0x27,%r12
+  804920:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804927:	ff 00 00 
+  80492a:	49 21 d4             	and    %rdx,%r12
+  80492d:	49 09 c4             	or     %rax,%r12
+  804930:	41 83 ed 01          	sub    $0x1,%r13d
+  804934:	74 48                	je     80497e <foreach_shared_region+0x2f2>
+  804936:	4c 89 e0             	mov    %r12,%rax
+  804939:	48 c1 e8 27          	shr    $0x27,%rax
+  80493d:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804944:	01 00 00 
+  804947:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  80494b:	f6 c2 01             	test   $0x1,%dl
+  80494e:	0f 85 a5 fd ff ff    	jne    8046f9 <foreach_shared_region+0x6d>
+  804954:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  80495b:	00 ff ff 
+  80495e:	4c 21 e2             	and    %r12,%rdx
+  804961:	48 83 c0 01          	add    $0x1,%rax
+  804965:	48 c1 e0 27          	shl    $0x27,%rax
+  804969:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804970:	ff 00 00 
+  804973:	48 21 c8             	and    %rcx,%rax
+  804976:	48 09 d0             	or     %rdx,%rax
+  804979:	49 89 c4             	mov    %rax,%r12
+  80497c:	eb b2                	jmp    804930 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  80497e:	4d 85 e4             	test   %r12,%r12
+  804981:	75 14                	jne    804997 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804983:	b8 00 00 00 00       	mov    $0x0,%eax
+  804988:	48 83 c4 28          	add    $0x28,%rsp
+  80498c:	5b                   	pop    %rbx
+  80498d:	41 5c                	pop    %r12
+  80498f:	41 5d                	pop    %r13
+  804991:	41 5e                	pop    %r14
+  804993:	41 5f                	pop    %r15
+  804995:	5d                   	pop    %rbp
+  804996:	c3                   	ret
+    assert(addr == 0);
+  804997:	48 b9 7b 66 80 00 00 	movabs $0x80667b,%rcx
+  80499e:	00 00 00 
+  8049a1:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  8049a8:	00 00 00 
+  8049ab:	be 67 00 00 00       	mov    $0x67,%esi
+  8049b0:	48 bf 70 66 80 00 00 	movabs $0x806670,%rdi
+  8049b7:	00 00 00 
+  8049ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049bf:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  8049c6:	00 00 00 
+  8049c9:	41 ff d0             	call   *%r8
+
+00000000008049cc <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8049cc:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8049d3:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8049d6:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8049dc:	eb 33                	jmp    804a11 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049de:	48 83 c0 20          	add    $0x20,%rax
+  8049e2:	4c 39 c0             	cmp    %r8,%rax
+  8049e5:	74 25                	je     804a0c <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8049e7:	48 8b 10             	mov    (%rax),%rdx
+  8049ea:	48 85 d2             	test   %rdx,%rdx
+  8049ed:	74 ef                	je     8049de <mmap_place+0x12>
+  8049ef:	48 89 d1             	mov    %rdx,%rcx
+  8049f2:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049f6:	48 39 cf             	cmp    %rcx,%rdi
+  8049f9:	73 e3                	jae    8049de <mmap_place+0x12>
+  8049fb:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8049ff:	4c 39 ca             	cmp    %r9,%rdx
+  804a02:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804a06:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804a0a:	eb d2                	jmp    8049de <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804a0c:	45 84 d2             	test   %r10b,%r10b
+  804a0f:	74 12                	je     804a23 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a11:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a18:	00 00 00 
+        moved = 0;
+  804a1b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a21:	eb c4                	jmp    8049e7 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a23:	48 01 fe             	add    %rdi,%rsi
+  804a26:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804a2d:	00 00 00 
+  804a30:	48 39 f0             	cmp    %rsi,%rax
+  804a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a38:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804a3c:	c3                   	ret
+
+0000000000804a3d <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804a3d:	55                   	push   %rbp
+  804a3e:	48 89 e5             	mov    %rsp,%rbp
+  804a41:	41 57                	push   %r15
+  804a43:	41 56                	push   %r14
+  804a45:	41 55                	push   %r13
+  804a47:	41 54                	push   %r12
+  804a49:	53                   	push   %rbx
+  804a4a:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804a4e:	48 8b 1f             	mov    (%rdi),%rbx
+  804a51:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a58:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a5f:	00 00 00 
+  804a62:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a67:	eb 12                	jmp    804a7b <mmap_pgfault+0x3e>
+  804a69:	48 83 c2 01          	add    $0x1,%rdx
+  804a6d:	48 83 c0 20          	add    $0x20,%rax
+  804a71:	48 83 fa 20          	cmp    $0x20,%rdx
+  804a75:	0f 84 04 01 00 00    	je     804b7f <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804a7b:	48 8b 08             	mov    (%rax),%rcx
+  804a7e:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804a82:	48 39 de             	cmp    %rbx,%rsi
+  804a85:	73 e2                	jae    804a69 <mmap_pgfault+0x2c>
+  804a87:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a8b:	48 39 cb             	cmp    %rcx,%rbx
+  804a8e:	73 d9                	jae    804a69 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804a90:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a94:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a9b:	00 00 00 
+  804a9e:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804aa2:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804aa6:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804aaa:	f6 c2 01             	test   $0x1,%dl
+  804aad:	0f 84 e0 00 00 00    	je     804b93 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804ab3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab8:	f6 c2 02             	test   $0x2,%dl
+  804abb:	0f 84 c3 00 00 00    	je     804b84 <mmap_pgfault+0x147>
+  804ac1:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ac8:	ff ff ff 
+  804acb:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804acf:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ad6:	00 00 00 
+  804ad9:	48 39 ca             	cmp    %rcx,%rdx
+  804adc:	0f 85 a2 00 00 00    	jne    804b84 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804ae2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804ae7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804aec:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804af3:	00 00 00 
+  804af6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afb:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  804b02:	00 00 00 
+  804b05:	ff d0                	call   *%rax
+  804b07:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b0e:	85 d2                	test   %edx,%edx
+  804b10:	78 72                	js     804b84 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804b12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b17:	48 89 de             	mov    %rbx,%rsi
+  804b1a:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b21:	00 00 00 
+  804b24:	4c 89 e7             	mov    %r12,%rdi
+  804b27:	48 b8 2c 25 80 00 00 	movabs $0x80252c,%rax
+  804b2e:	00 00 00 
+  804b31:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804b33:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804b39:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b3f:	48 89 d9             	mov    %rbx,%rcx
+  804b42:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b47:	4c 89 e6             	mov    %r12,%rsi
+  804b4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b4f:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  804b56:	00 00 00 
+  804b59:	ff d0                	call   *%rax
+  804b5b:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804b5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b62:	4c 89 e6             	mov    %r12,%rsi
+  804b65:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b6a:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  804b71:	00 00 00 
+  804b74:	ff d0                	call   *%rax
+    return res >= 0;
+  804b76:	89 d8                	mov    %ebx,%eax
+  804b78:	f7 d0                	not    %eax
+  804b7a:	c1 e8 1f             	shr    $0x1f,%eax
+  804b7d:	eb 05                	jmp    804b84 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804b84:	48 83 c4 18          	add    $0x18,%rsp
+  804b88:	5b                   	pop    %rbx
+  804b89:	41 5c                	pop    %r12
+  804b8b:	41 5d                	pop    %r13
+  804b8d:	41 5e                	pop    %r14
+  804b8f:	41 5f                	pop    %r15
+  804b91:	5d                   	pop    %rbp
+  804b92:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804b93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b97:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804b9b:	4c 03 30             	add    (%rax),%r14
+  804b9e:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ba5:	49 39 c6             	cmp    %rax,%r14
+  804ba8:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bac:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804bb3:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bb9:	49 bf 77 46 80 00 00 	movabs $0x804677,%r15
+  804bc0:	00 00 00 
+  804bc3:	4d 39 f4             	cmp    %r14,%r12
+  804bc6:	73 1d                	jae    804be5 <mmap_pgfault+0x1a8>
+  804bc8:	4c 89 e7             	mov    %r12,%rdi
+  804bcb:	41 ff d7             	call   *%r15
+  804bce:	84 c0                	test   %al,%al
+  804bd0:	75 13                	jne    804be5 <mmap_pgfault+0x1a8>
+  804bd2:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804bd9:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804be0:	4d 39 f4             	cmp    %r14,%r12
+  804be3:	72 e3                	jb     804bc8 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804be5:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804beb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bef:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804bf3:	74 2a                	je     804c1f <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804bf5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bf9:	89 de                	mov    %ebx,%esi
+  804bfb:	2b 30                	sub    (%rax),%esi
+  804bfd:	03 70 1c             	add    0x1c(%rax),%esi
+  804c00:	8b 78 18             	mov    0x18(%rax),%edi
+  804c03:	4c 89 e9             	mov    %r13,%rcx
+  804c06:	48 89 da             	mov    %rbx,%rdx
+  804c09:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  804c10:	00 00 00 
+  804c13:	ff d0                	call   *%rax
+    return res > 0;
+  804c15:	85 c0                	test   %eax,%eax
+  804c17:	0f 9f c0             	setg   %al
+  804c1a:	e9 65 ff ff ff       	jmp    804b84 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c1f:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c23:	eb d0                	jmp    804bf5 <mmap_pgfault+0x1b8>
+
+0000000000804c25 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c25:	55                   	push   %rbp
+  804c26:	48 89 e5             	mov    %rsp,%rbp
+  804c29:	41 57                	push   %r15
+  804c2b:	41 56                	push   %r14
+  804c2d:	41 55                	push   %r13
+  804c2f:	41 54                	push   %r12
+  804c31:	53                   	push   %rbx
+  804c32:	48 83 ec 28          	sub    $0x28,%rsp
+  804c36:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804c3a:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804c3d:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c44:	ff ff ff 
+  804c47:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c50:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804c57:	00 00 00 
+  804c5a:	48 39 ca             	cmp    %rcx,%rdx
+  804c5d:	0f 85 e5 00 00 00    	jne    804d48 <mmap_writeback+0x123>
+  804c63:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804c66:	4c 39 ee             	cmp    %r13,%rsi
+  804c69:	0f 83 e8 00 00 00    	jae    804d57 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c6f:	49 be 77 46 80 00 00 	movabs $0x804677,%r14
+  804c76:	00 00 00 
+  804c79:	49 bf 5e 46 80 00 00 	movabs $0x80465e,%r15
+  804c80:	00 00 00 
+  804c83:	eb 10                	jmp    804c95 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804c85:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804c8c:	4d 39 ec             	cmp    %r13,%r12
+  804c8f:	0f 83 ae 00 00 00    	jae    804d43 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c95:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804c99:	4c 89 e7             	mov    %r12,%rdi
+  804c9c:	41 ff d6             	call   *%r14
+  804c9f:	84 c0                	test   %al,%al
+  804ca1:	74 e2                	je     804c85 <mmap_writeback+0x60>
+  804ca3:	4c 89 e7             	mov    %r12,%rdi
+  804ca6:	41 ff d7             	call   *%r15
+  804ca9:	84 c0                	test   %al,%al
+  804cab:	74 d8                	je     804c85 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804cad:	4c 89 e3             	mov    %r12,%rbx
+  804cb0:	4d 39 ec             	cmp    %r13,%r12
+  804cb3:	73 20                	jae    804cd5 <mmap_writeback+0xb0>
+  804cb5:	48 89 df             	mov    %rbx,%rdi
+  804cb8:	41 ff d6             	call   *%r14
+  804cbb:	84 c0                	test   %al,%al
+  804cbd:	74 16                	je     804cd5 <mmap_writeback+0xb0>
+  804cbf:	48 89 df             	mov    %rbx,%rdi
+  804cc2:	41 ff d7             	call   *%r15
+  804cc5:	84 c0                	test   %al,%al
+  804cc7:	74 0c                	je     804cd5 <mmap_writeback+0xb0>
+  804cc9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804cd0:	4c 39 eb             	cmp    %r13,%rbx
+  804cd3:	72 e0                	jb     804cb5 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804cd5:	48 89 d9             	mov    %rbx,%rcx
+  804cd8:	4c 29 e1             	sub    %r12,%rcx
+  804cdb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804cdf:	44 89 e6             	mov    %r12d,%esi
+  804ce2:	2b 30                	sub    (%rax),%esi
+  804ce4:	49 89 c4             	mov    %rax,%r12
+  804ce7:	03 70 1c             	add    0x1c(%rax),%esi
+  804cea:	8b 78 18             	mov    0x18(%rax),%edi
+  804ced:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804cf1:	48 89 ca             	mov    %rcx,%rdx
+  804cf4:	48 b8 5e 3e 80 00 00 	movabs $0x803e5e,%rax
+  804cfb:	00 00 00 
+  804cfe:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d00:	85 c0                	test   %eax,%eax
+  804d02:	78 44                	js     804d48 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804d04:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804d09:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804d0c:	41 89 c1             	mov    %eax,%r9d
+  804d0f:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804d16:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d1a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d23:	48 89 ce             	mov    %rcx,%rsi
+  804d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d2b:	48 b8 47 29 80 00 00 	movabs $0x802947,%rax
+  804d32:	00 00 00 
+  804d35:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804d37:	85 c0                	test   %eax,%eax
+  804d39:	78 0d                	js     804d48 <mmap_writeback+0x123>
+  804d3b:	49 89 dc             	mov    %rbx,%r12
+  804d3e:	e9 49 ff ff ff       	jmp    804c8c <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804d43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d48:	48 83 c4 28          	add    $0x28,%rsp
+  804d4c:	5b                   	pop    %rbx
+  804d4d:	41 5c                	pop    %r12
+  804d4f:	41 5d                	pop    %r13
+  804d51:	41 5e                	pop    %r14
+  804d53:	41 5f                	pop    %r15
+  804d55:	5d                   	pop    %rbp
+  804d56:	c3                   	ret
+    return 0;
+  804d57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d5c:	eb ea                	jmp    804d48 <mmap_writeback+0x123>
+
+0000000000804d5e <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804d5e:	55                   	push   %rbp
+  804d5f:	48 89 e5             	mov    %rsp,%rbp
+  804d62:	41 57                	push   %r15
+  804d64:	41 56                	push   %r14
+  804d66:	41 55                	push   %r13
+  804d68:	41 54                	push   %r12
+  804d6a:	53                   	push   %rbx
+  804d6b:	48 83 ec 38          	sub    $0x38,%rsp
+  804d6f:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804d73:	48 85 f6             	test   %rsi,%rsi
+  804d76:	0f 84 0c 02 00 00    	je     804f88 <mmap+0x22a>
+  804d7c:	49 89 ff             	mov    %rdi,%r15
+  804d7f:	49 89 f4             	mov    %rsi,%r12
+  804d82:	41 89 d5             	mov    %edx,%r13d
+  804d85:	41 89 ce             	mov    %ecx,%r14d
+  804d88:	44 89 cb             	mov    %r9d,%ebx
+  804d8b:	45 85 c9             	test   %r9d,%r9d
+  804d8e:	0f 88 f4 01 00 00    	js     804f88 <mmap+0x22a>
+  804d94:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d9b:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804da2:	0f 85 e7 01 00 00    	jne    804f8f <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804da8:	83 e2 fd             	and    $0xfffffffd,%edx
+  804dab:	83 fa 04             	cmp    $0x4,%edx
+  804dae:	0f 85 db 01 00 00    	jne    804f8f <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804db4:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804db7:	83 fa 01             	cmp    $0x1,%edx
+  804dba:	0f 87 cf 01 00 00    	ja     804f8f <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804dc0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804dc4:	44 89 c7             	mov    %r8d,%edi
+  804dc7:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  804dce:	00 00 00 
+  804dd1:	ff d0                	call   *%rax
+  804dd3:	89 c2                	mov    %eax,%edx
+  804dd5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ddc:	85 d2                	test   %edx,%edx
+  804dde:	0f 88 ab 01 00 00    	js     804f8f <mmap+0x231>
+  804de4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804de8:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804def:	00 00 00 
+  804df2:	8b 09                	mov    (%rcx),%ecx
+  804df4:	39 0a                	cmp    %ecx,(%rdx)
+  804df6:	0f 85 93 01 00 00    	jne    804f8f <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804dfc:	8b 52 08             	mov    0x8(%rdx),%edx
+  804dff:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804e02:	83 fa 01             	cmp    $0x1,%edx
+  804e05:	0f 84 84 01 00 00    	je     804f8f <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e0b:	41 83 fe 01          	cmp    $0x1,%r14d
+  804e0f:	74 42                	je     804e53 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804e11:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804e18:	4c 89 e6             	mov    %r12,%rsi
+  804e1b:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e22:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804e26:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804e2a:	4d 85 ff             	test   %r15,%r15
+  804e2d:	74 67                	je     804e96 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e2f:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804e36:	75 0f                	jne    804e47 <mmap+0xe9>
+  804e38:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804e3f:	00 00 00 
+  804e42:	49 39 c7             	cmp    %rax,%r15
+  804e45:	77 1b                	ja     804e62 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e47:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e4e:	e9 3c 01 00 00       	jmp    804f8f <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e53:	41 f6 c5 02          	test   $0x2,%r13b
+  804e57:	74 b8                	je     804e11 <mmap+0xb3>
+  804e59:	85 d2                	test   %edx,%edx
+  804e5b:	75 b4                	jne    804e11 <mmap+0xb3>
+  804e5d:	e9 2d 01 00 00       	jmp    804f8f <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e62:	4c 89 ff             	mov    %r15,%rdi
+  804e65:	48 b8 cc 49 80 00 00 	movabs $0x8049cc,%rax
+  804e6c:	00 00 00 
+  804e6f:	ff d0                	call   *%rax
+  804e71:	48 89 c2             	mov    %rax,%rdx
+  804e74:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e7b:	49 39 d7             	cmp    %rdx,%r15
+  804e7e:	0f 85 0b 01 00 00    	jne    804f8f <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e84:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e8b:	00 00 00 
+  804e8e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e94:	eb 44                	jmp    804eda <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804e96:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804e9a:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804ea1:	00 00 00 
+  804ea4:	48 b8 cc 49 80 00 00 	movabs $0x8049cc,%rax
+  804eab:	00 00 00 
+  804eae:	ff d0                	call   *%rax
+  804eb0:	48 89 c7             	mov    %rax,%rdi
+  804eb3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804eb7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804ebe:	48 85 ff             	test   %rdi,%rdi
+  804ec1:	75 c1                	jne    804e84 <mmap+0x126>
+  804ec3:	e9 c7 00 00 00       	jmp    804f8f <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804ec8:	49 83 c4 01          	add    $0x1,%r12
+  804ecc:	48 83 c0 20          	add    $0x20,%rax
+  804ed0:	49 83 fc 20          	cmp    $0x20,%r12
+  804ed4:	0f 84 a5 00 00 00    	je     804f7f <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804eda:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804ede:	75 e8                	jne    804ec8 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804ee0:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804ee4:	48 b8 18 31 80 00 00 	movabs $0x803118,%rax
+  804eeb:	00 00 00 
+  804eee:	ff d0                	call   *%rax
+  804ef0:	89 c2                	mov    %eax,%edx
+  804ef2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ef9:	85 d2                	test   %edx,%edx
+  804efb:	0f 88 8e 00 00 00    	js     804f8f <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804f01:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804f05:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  804f0c:	00 00 00 
+  804f0f:	ff d0                	call   *%rax
+  804f11:	89 c6                	mov    %eax,%esi
+  804f13:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804f16:	48 b8 38 33 80 00 00 	movabs $0x803338,%rax
+  804f1d:	00 00 00 
+  804f20:	ff d0                	call   *%rax
+  804f22:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f25:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f2c:	45 85 ff             	test   %r15d,%r15d
+  804f2f:	78 5e                	js     804f8f <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f31:	49 c1 e4 05          	shl    $0x5,%r12
+  804f35:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f3c:	00 00 00 
+  804f3f:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804f42:	48 bf 3d 4a 80 00 00 	movabs $0x804a3d,%rdi
+  804f49:	00 00 00 
+  804f4c:	48 b8 68 54 80 00 00 	movabs $0x805468,%rax
+  804f53:	00 00 00 
+  804f56:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804f58:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f5c:	49 89 04 24          	mov    %rax,(%r12)
+  804f60:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804f64:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804f69:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804f6e:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804f73:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804f78:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804f7d:	eb 10                	jmp    804f8f <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804f7f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f86:	eb 07                	jmp    804f8f <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f88:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804f8f:	48 83 c4 38          	add    $0x38,%rsp
+  804f93:	5b                   	pop    %rbx
+  804f94:	41 5c                	pop    %r12
+  804f96:	41 5d                	pop    %r13
+  804f98:	41 5e                	pop    %r14
+  804f9a:	41 5f                	pop    %r15
+  804f9c:	5d                   	pop    %rbp
+  804f9d:	c3                   	ret
+
+0000000000804f9e <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804f9e:	55                   	push   %rbp
+  804f9f:	48 89 e5             	mov    %rsp,%rbp
+  804fa2:	41 57                	push   %r15
+  804fa4:	41 56                	push   %r14
+  804fa6:	41 55                	push   %r13
+  804fa8:	41 54                	push   %r12
+  804faa:	53                   	push   %rbx
+  804fab:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804faf:	49 89 fe             	mov    %rdi,%r14
+  804fb2:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fb9:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fc0:	00 
+  804fc1:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fc8:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804fcf:	00 00 00 
+  804fd2:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804fd9:	49 bf 25 4c 80 00 00 	movabs $0x804c25,%r15
+  804fe0:	00 00 00 
+  804fe3:	eb 09                	jmp    804fee <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fe5:	48 83 c3 20          	add    $0x20,%rbx
+  804fe9:	4c 39 eb             	cmp    %r13,%rbx
+  804fec:	74 33                	je     805021 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fee:	48 89 df             	mov    %rbx,%rdi
+  804ff1:	48 8b 33             	mov    (%rbx),%rsi
+  804ff4:	4c 39 e6             	cmp    %r12,%rsi
+  804ff7:	73 ec                	jae    804fe5 <msync+0x47>
+  804ff9:	48 85 f6             	test   %rsi,%rsi
+  804ffc:	74 e7                	je     804fe5 <msync+0x47>
+  804ffe:	48 89 f2             	mov    %rsi,%rdx
+  805001:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805005:	49 39 d6             	cmp    %rdx,%r14
+  805008:	73 db                	jae    804fe5 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80500a:	4c 39 e2             	cmp    %r12,%rdx
+  80500d:	49 0f 47 d4          	cmova  %r12,%rdx
+  805011:	4c 39 f6             	cmp    %r14,%rsi
+  805014:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805018:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  80501b:	85 c0                	test   %eax,%eax
+  80501d:	79 c6                	jns    804fe5 <msync+0x47>
+  80501f:	eb 05                	jmp    805026 <msync+0x88>
+    }
+
+    return 0;
+  805021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805026:	48 83 c4 08          	add    $0x8,%rsp
+  80502a:	5b                   	pop    %rbx
+  80502b:	41 5c                	pop    %r12
+  80502d:	41 5d                	pop    %r13
+  80502f:	41 5e                	pop    %r14
+  805031:	41 5f                	pop    %r15
+  805033:	5d                   	pop    %rbp
+  805034:	c3                   	ret
+
+0000000000805035 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805035:	55                   	push   %rbp
+  805036:	48 89 e5             	mov    %rsp,%rbp
+  805039:	41 57                	push   %r15
+  80503b:	41 56                	push   %r14
+  80503d:	41 55                	push   %r13
+  80503f:	41 54                	push   %r12
+  805041:	53                   	push   %rbx
+  805042:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805046:	49 89 ff             	mov    %rdi,%r15
+  805049:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805050:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805057:	00 
+  805058:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80505f:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805066:	00 00 00 
+  805069:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805070:	48 89 d8             	mov    %rbx,%rax
+  805073:	eb 09                	jmp    80507e <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805075:	48 83 c0 20          	add    $0x20,%rax
+  805079:	4c 39 f0             	cmp    %r14,%rax
+  80507c:	74 40                	je     8050be <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80507e:	48 8b 10             	mov    (%rax),%rdx
+  805081:	4c 39 e2             	cmp    %r12,%rdx
+  805084:	73 ef                	jae    805075 <munmap+0x40>
+  805086:	48 85 d2             	test   %rdx,%rdx
+  805089:	74 ea                	je     805075 <munmap+0x40>
+  80508b:	48 89 d7             	mov    %rdx,%rdi
+  80508e:	48 03 78 08          	add    0x8(%rax),%rdi
+  805092:	49 39 ff             	cmp    %rdi,%r15
+  805095:	73 de                	jae    805075 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805097:	49 39 fc             	cmp    %rdi,%r12
+  80509a:	72 05                	jb     8050a1 <munmap+0x6c>
+  80509c:	4c 39 fa             	cmp    %r15,%rdx
+  80509f:	73 d4                	jae    805075 <munmap+0x40>
+  8050a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8050a6:	48 83 c4 08          	add    $0x8,%rsp
+  8050aa:	5b                   	pop    %rbx
+  8050ab:	41 5c                	pop    %r12
+  8050ad:	41 5d                	pop    %r13
+  8050af:	41 5e                	pop    %r14
+  8050b1:	41 5f                	pop    %r15
+  8050b3:	5d                   	pop    %rbp
+  8050b4:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050b5:	48 83 c3 20          	add    $0x20,%rbx
+  8050b9:	4c 39 f3             	cmp    %r14,%rbx
+  8050bc:	74 5c                	je     80511a <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050be:	48 8b 33             	mov    (%rbx),%rsi
+  8050c1:	4c 39 e6             	cmp    %r12,%rsi
+  8050c4:	73 ef                	jae    8050b5 <munmap+0x80>
+  8050c6:	48 85 f6             	test   %rsi,%rsi
+  8050c9:	74 ea                	je     8050b5 <munmap+0x80>
+  8050cb:	48 89 f2             	mov    %rsi,%rdx
+  8050ce:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8050d2:	49 39 d7             	cmp    %rdx,%r15
+  8050d5:	73 de                	jae    8050b5 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8050d7:	48 89 df             	mov    %rbx,%rdi
+  8050da:	48 b8 25 4c 80 00 00 	movabs $0x804c25,%rax
+  8050e1:	00 00 00 
+  8050e4:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8050e6:	85 c0                	test   %eax,%eax
+  8050e8:	78 bc                	js     8050a6 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8050ea:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8050ee:	48 8b 33             	mov    (%rbx),%rsi
+  8050f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050f6:	48 b8 b2 29 80 00 00 	movabs $0x8029b2,%rax
+  8050fd:	00 00 00 
+  805100:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805102:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805105:	48 b8 dd 32 80 00 00 	movabs $0x8032dd,%rax
+  80510c:	00 00 00 
+  80510f:	ff d0                	call   *%rax
+        reg->start = 0;
+  805111:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805118:	eb 9b                	jmp    8050b5 <munmap+0x80>
+    return 0;
+  80511a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80511f:	eb 85                	jmp    8050a6 <munmap+0x71>
+
+0000000000805121 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805121:	b8 00 00 00 00       	mov    $0x0,%eax
+  805126:	c3                   	ret
+
+0000000000805127 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805127:	55                   	push   %rbp
+  805128:	48 89 e5             	mov    %rsp,%rbp
+  80512b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80512e:	48 be 85 66 80 00 00 	movabs $0x806685,%rsi
+  805135:	00 00 00 
+  805138:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  80513f:	00 00 00 
+  805142:	ff d0                	call   *%rax
+    return 0;
+}
+  805144:	b8 00 00 00 00       	mov    $0x0,%eax
+  805149:	5d                   	pop    %rbp
+  80514a:	c3                   	ret
+
+000000000080514b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80514b:	55                   	push   %rbp
+  80514c:	48 89 e5             	mov    %rsp,%rbp
+  80514f:	41 57                	push   %r15
+  805151:	41 56                	push   %r14
+  805153:	41 55                	push   %r13
+  805155:	41 54                	push   %r12
+  805157:	53                   	push   %rbx
+  805158:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80515f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805166:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80516d:	00 00 00 00 
+  805171:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805178:	00 00 00 00 
+  80517c:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805183:	00 00 00 00 
+  805187:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  80518e:	00 00 00 00 
+  805192:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805199:	00 00 00 00 
+  80519d:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8051a4:	00 00 00 00 
+  8051a8:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8051af:	00 
+  8051b0:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8051b7:	00 
+  8051b8:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8051bf:	00 
+  8051c0:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8051c7:	00 
+  8051c8:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8051cf:	00 
+  8051d0:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8051d7:	00 
+  8051d8:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8051df:	00 
+  8051e0:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8051e7:	00 
+  8051e8:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8051ef:	00 
+  8051f0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8051f7:	00 
+    for (res = 0; res < n; res += inc) {
+  8051f8:	48 85 d2             	test   %rdx,%rdx
+  8051fb:	74 7a                	je     805277 <devcons_write+0x12c>
+  8051fd:	49 89 d6             	mov    %rdx,%r14
+  805200:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805206:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80520b:	49 bf c5 24 80 00 00 	movabs $0x8024c5,%r15
+  805212:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805215:	4c 89 f3             	mov    %r14,%rbx
+  805218:	48 29 f3             	sub    %rsi,%rbx
+  80521b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805220:	48 39 c3             	cmp    %rax,%rbx
+  805223:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805227:	4c 63 eb             	movslq %ebx,%r13
+  80522a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805231:	48 01 c6             	add    %rax,%rsi
+  805234:	4c 89 ea             	mov    %r13,%rdx
+  805237:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80523e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805241:	4c 89 ee             	mov    %r13,%rsi
+  805244:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80524b:	48 b8 f2 26 80 00 00 	movabs $0x8026f2,%rax
+  805252:	00 00 00 
+  805255:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805257:	41 01 dc             	add    %ebx,%r12d
+  80525a:	49 63 f4             	movslq %r12d,%rsi
+  80525d:	4c 39 f6             	cmp    %r14,%rsi
+  805260:	72 b3                	jb     805215 <devcons_write+0xca>
+    return res;
+  805262:	49 63 c4             	movslq %r12d,%rax
+}
+  805265:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80526c:	5b                   	pop    %rbx
+  80526d:	41 5c                	pop    %r12
+  80526f:	41 5d                	pop    %r13
+  805271:	41 5e                	pop    %r14
+  805273:	41 5f                	pop    %r15
+  805275:	5d                   	pop    %rbp
+  805276:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805277:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80527d:	eb e3                	jmp    805262 <devcons_write+0x117>
+
+000000000080527f <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80527f:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805282:	ba 00 00 00 00       	mov    $0x0,%edx
+  805287:	48 85 c0             	test   %rax,%rax
+  80528a:	74 55                	je     8052e1 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80528c:	55                   	push   %rbp
+  80528d:	48 89 e5             	mov    %rsp,%rbp
+  805290:	41 55                	push   %r13
+  805292:	41 54                	push   %r12
+  805294:	53                   	push   %rbx
+  805295:	48 83 ec 08          	sub    $0x8,%rsp
+  805299:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80529c:	48 bb 25 27 80 00 00 	movabs $0x802725,%rbx
+  8052a3:	00 00 00 
+  8052a6:	49 bc 39 28 80 00 00 	movabs $0x802839,%r12
+  8052ad:	00 00 00 
+  8052b0:	eb 03                	jmp    8052b5 <devcons_read+0x36>
+  8052b2:	41 ff d4             	call   *%r12
+  8052b5:	ff d3                	call   *%rbx
+  8052b7:	85 c0                	test   %eax,%eax
+  8052b9:	74 f7                	je     8052b2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8052bb:	48 63 d0             	movslq %eax,%rdx
+  8052be:	78 13                	js     8052d3 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8052c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052c5:	83 f8 04             	cmp    $0x4,%eax
+  8052c8:	74 09                	je     8052d3 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052ca:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052ce:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8052d3:	48 89 d0             	mov    %rdx,%rax
+  8052d6:	48 83 c4 08          	add    $0x8,%rsp
+  8052da:	5b                   	pop    %rbx
+  8052db:	41 5c                	pop    %r12
+  8052dd:	41 5d                	pop    %r13
+  8052df:	5d                   	pop    %rbp
+  8052e0:	c3                   	ret
+  8052e1:	48 89 d0             	mov    %rdx,%rax
+  8052e4:	c3                   	ret
+
+00000000008052e5 <cputchar>:
+cputchar(int ch) {
+  8052e5:	55                   	push   %rbp
+  8052e6:	48 89 e5             	mov    %rsp,%rbp
+  8052e9:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8052ed:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8052f1:	be 01 00 00 00       	mov    $0x1,%esi
+  8052f6:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8052fa:	48 b8 f2 26 80 00 00 	movabs $0x8026f2,%rax
+  805301:	00 00 00 
+  805304:	ff d0                	call   *%rax
+}
+  805306:	c9                   	leave
+  805307:	c3                   	ret
+
+0000000000805308 <getchar>:
+getchar(void) {
+  805308:	55                   	push   %rbp
+  805309:	48 89 e5             	mov    %rsp,%rbp
+  80530c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805310:	ba 01 00 00 00       	mov    $0x1,%edx
+  805315:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805319:	bf 00 00 00 00       	mov    $0x0,%edi
+  80531e:	48 b8 5b 34 80 00 00 	movabs $0x80345b,%rax
+  805325:	00 00 00 
+  805328:	ff d0                	call   *%rax
+  80532a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80532c:	85 c0                	test   %eax,%eax
+  80532e:	78 06                	js     805336 <getchar+0x2e>
+  805330:	74 08                	je     80533a <getchar+0x32>
+  805332:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805336:	89 d0                	mov    %edx,%eax
+  805338:	c9                   	leave
+  805339:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80533a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80533f:	eb f5                	jmp    805336 <getchar+0x2e>
+
+0000000000805341 <iscons>:
+iscons(int fdnum) {
+  805341:	55                   	push   %rbp
+  805342:	48 89 e5             	mov    %rsp,%rbp
+  805345:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805349:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80534d:	48 b8 78 31 80 00 00 	movabs $0x803178,%rax
+  805354:	00 00 00 
+  805357:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805359:	85 c0                	test   %eax,%eax
+  80535b:	78 18                	js     805375 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80535d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805361:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805368:	00 00 00 
+  80536b:	8b 00                	mov    (%rax),%eax
+  80536d:	39 02                	cmp    %eax,(%rdx)
+  80536f:	0f 94 c0             	sete   %al
+  805372:	0f b6 c0             	movzbl %al,%eax
+}
+  805375:	c9                   	leave
+  805376:	c3                   	ret
+
+0000000000805377 <opencons>:
+opencons(void) {
+  805377:	55                   	push   %rbp
+  805378:	48 89 e5             	mov    %rsp,%rbp
+  80537b:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80537f:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805383:	48 b8 18 31 80 00 00 	movabs $0x803118,%rax
+  80538a:	00 00 00 
+  80538d:	ff d0                	call   *%rax
+  80538f:	85 c0                	test   %eax,%eax
+  805391:	78 49                	js     8053dc <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805393:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805398:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80539d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8053a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053a6:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  8053ad:	00 00 00 
+  8053b0:	ff d0                	call   *%rax
+  8053b2:	85 c0                	test   %eax,%eax
+  8053b4:	78 26                	js     8053dc <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8053b6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053ba:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8053c1:	00 00 
+  8053c3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8053c5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053c9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053d0:	48 b8 ea 30 80 00 00 	movabs $0x8030ea,%rax
+  8053d7:	00 00 00 
+  8053da:	ff d0                	call   *%rax
+}
+  8053dc:	c9                   	leave
+  8053dd:	c3                   	ret
+
+00000000008053de <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8053de:	55                   	push   %rbp
+  8053df:	48 89 e5             	mov    %rsp,%rbp
+  8053e2:	41 56                	push   %r14
+  8053e4:	41 55                	push   %r13
+  8053e6:	41 54                	push   %r12
+  8053e8:	53                   	push   %rbx
+  8053e9:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053ec:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053f3:	00 00 00 
+  8053f6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8053fa:	74 27                	je     805423 <_handle_vectored_pagefault+0x45>
+  8053fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805401:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805408:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80540b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80540e:	4c 89 e7             	mov    %r12,%rdi
+  805411:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805416:	84 c0                	test   %al,%al
+  805418:	75 45                	jne    80545f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80541a:	48 83 c3 01          	add    $0x1,%rbx
+  80541e:	49 3b 1e             	cmp    (%r14),%rbx
+  805421:	72 eb                	jb     80540e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805423:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80542a:	00 
+  80542b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805430:	4d 8b 04 24          	mov    (%r12),%r8
+  805434:	48 ba 98 66 80 00 00 	movabs $0x806698,%rdx
+  80543b:	00 00 00 
+  80543e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805443:	48 bf c8 66 80 00 00 	movabs $0x8066c8,%rdi
+  80544a:	00 00 00 
+  80544d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805452:	49 ba ee 16 80 00 00 	movabs $0x8016ee,%r10
+  805459:	00 00 00 
+  80545c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80545f:	5b                   	pop    %rbx
+  805460:	41 5c                	pop    %r12
+  805462:	41 5d                	pop    %r13
+  805464:	41 5e                	pop    %r14
+  805466:	5d                   	pop    %rbp
+  805467:	c3                   	ret
+
+0000000000805468 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805468:	55                   	push   %rbp
+  805469:	48 89 e5             	mov    %rsp,%rbp
+  80546c:	53                   	push   %rbx
+  80546d:	48 83 ec 08          	sub    $0x8,%rsp
+  805471:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805474:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805479:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805480:	00 00 00 
+  805483:	80 38 00             	cmpb   $0x0,(%rax)
+  805486:	74 68                	je     8054f0 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805488:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80548f:	00 00 00 
+  805492:	48 8b 08             	mov    (%rax),%rcx
+  805495:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80549a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054a1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054a4:	48 85 c9             	test   %rcx,%rcx
+  8054a7:	0f 84 e0 00 00 00    	je     80558d <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054ad:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8054b1:	0f 84 c9 00 00 00    	je     805580 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054b7:	48 83 c2 01          	add    $0x1,%rdx
+  8054bb:	48 39 ca             	cmp    %rcx,%rdx
+  8054be:	75 ed                	jne    8054ad <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8054c0:	48 83 f9 08          	cmp    $0x8,%rcx
+  8054c4:	0f 84 84 00 00 00    	je     80554e <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054ca:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8054ce:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8054d5:	00 00 00 
+  8054d8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054df:	00 00 00 
+  8054e2:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054e6:	85 f6                	test   %esi,%esi
+  8054e8:	0f 89 97 00 00 00    	jns    805585 <add_pgfault_handler+0x11d>
+  8054ee:	eb 63                	jmp    805553 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8054f0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8054f5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8054fa:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805501:	00 00 00 
+  805504:	bf 00 00 00 00       	mov    $0x0,%edi
+  805509:	48 b8 da 28 80 00 00 	movabs $0x8028da,%rax
+  805510:	00 00 00 
+  805513:	ff d0                	call   *%rax
+  805515:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805517:	85 c0                	test   %eax,%eax
+  805519:	78 38                	js     805553 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80551b:	48 be 69 56 80 00 00 	movabs $0x805669,%rsi
+  805522:	00 00 00 
+  805525:	bf 00 00 00 00       	mov    $0x0,%edi
+  80552a:	48 b8 fd 2a 80 00 00 	movabs $0x802afd,%rax
+  805531:	00 00 00 
+  805534:	ff d0                	call   *%rax
+  805536:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805538:	85 c0                	test   %eax,%eax
+  80553a:	78 17                	js     805553 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80553c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805543:	00 00 00 
+  805546:	c6 00 01             	movb   $0x1,(%rax)
+  805549:	e9 3a ff ff ff       	jmp    805488 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80554e:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805553:	89 f1                	mov    %esi,%ecx
+  805555:	48 ba d6 66 80 00 00 	movabs $0x8066d6,%rdx
+  80555c:	00 00 00 
+  80555f:	be 42 00 00 00       	mov    $0x42,%esi
+  805564:	48 bf c8 66 80 00 00 	movabs $0x8066c8,%rdi
+  80556b:	00 00 00 
+  80556e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805573:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  80557a:	00 00 00 
+  80557d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805580:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805585:	89 f0                	mov    %esi,%eax
+  805587:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80558b:	c9                   	leave
+  80558c:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80558d:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805594:	00 00 00 
+  805597:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80559e:	48 89 d8             	mov    %rbx,%rax
+  8055a1:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8055a8:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055ab:	eb d8                	jmp    805585 <add_pgfault_handler+0x11d>
+
+00000000008055ad <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8055ad:	55                   	push   %rbp
+  8055ae:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8055b1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055b8:	00 00 00 
+  8055bb:	80 38 00             	cmpb   $0x0,(%rax)
+  8055be:	74 33                	je     8055f3 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055c0:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8055c7:	00 00 00 
+  8055ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8055cf:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8055d6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055d9:	48 85 c0             	test   %rax,%rax
+  8055dc:	0f 84 85 00 00 00    	je     805667 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8055e2:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8055e6:	74 40                	je     805628 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055e8:	48 83 c1 01          	add    $0x1,%rcx
+  8055ec:	48 39 c1             	cmp    %rax,%rcx
+  8055ef:	75 f1                	jne    8055e2 <remove_pgfault_handler+0x35>
+  8055f1:	eb 74                	jmp    805667 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8055f3:	48 b9 ee 66 80 00 00 	movabs $0x8066ee,%rcx
+  8055fa:	00 00 00 
+  8055fd:	48 ba d6 65 80 00 00 	movabs $0x8065d6,%rdx
+  805604:	00 00 00 
+  805607:	be 48 00 00 00       	mov    $0x48,%esi
+  80560c:	48 bf c8 66 80 00 00 	movabs $0x8066c8,%rdi
+  805613:	00 00 00 
+  805616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80561b:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  805622:	00 00 00 
+  805625:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805628:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80562f:	00 
+  805630:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805634:	48 29 ca             	sub    %rcx,%rdx
+  805637:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80563e:	00 00 00 
+  805641:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805645:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80564a:	48 89 ce             	mov    %rcx,%rsi
+  80564d:	48 b8 c5 24 80 00 00 	movabs $0x8024c5,%rax
+  805654:	00 00 00 
+  805657:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805659:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805660:	00 00 00 
+  805663:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805667:	5d                   	pop    %rbp
+  805668:	c3                   	ret
+
+0000000000805669 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805669:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80566c:	48 b8 de 53 80 00 00 	movabs $0x8053de,%rax
+  805673:	00 00 00 
+    call *%rax
+  805676:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805678:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80567f:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805680:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805687:	00 
+    subq $8, %rcx
+  805688:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80568c:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80568f:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805696:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805697:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80569b:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80569f:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8056a4:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8056a9:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8056ae:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8056b3:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8056b8:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8056bd:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8056c2:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8056c7:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8056cc:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8056d1:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8056d6:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8056db:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8056e0:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8056e5:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8056e9:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8056ed:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8056ee:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8056ef:	c3                   	ret
+
+00000000008056f0 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8056f0:	85 ff                	test   %edi,%edi
+  8056f2:	78 58                	js     80574c <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8056f4:	48 85 f6             	test   %rsi,%rsi
+  8056f7:	74 12                	je     80570b <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8056f9:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805700:	00 00 00 
+  805703:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805709:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80570b:	48 85 c9             	test   %rcx,%rcx
+  80570e:	74 12                	je     805722 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805710:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805717:	00 00 00 
+  80571a:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805720:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805722:	48 85 d2             	test   %rdx,%rdx
+  805725:	74 14                	je     80573b <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805727:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80572e:	00 00 00 
+  805731:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805738:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80573b:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805742:	00 00 00 
+  805745:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80574b:	c3                   	ret
+        if (from_env_store) {
+  80574c:	48 85 f6             	test   %rsi,%rsi
+  80574f:	74 06                	je     805757 <ipc_result+0x67>
+            *from_env_store = 0;
+  805751:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805757:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805759:	48 85 c9             	test   %rcx,%rcx
+  80575c:	74 ed                	je     80574b <ipc_result+0x5b>
+            *perm_store = 0;
+  80575e:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805764:	c3                   	ret
+
+0000000000805765 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805765:	55                   	push   %rbp
+  805766:	48 89 e5             	mov    %rsp,%rbp
+  805769:	41 55                	push   %r13
+  80576b:	41 54                	push   %r12
+  80576d:	53                   	push   %rbx
+  80576e:	48 83 ec 08          	sub    $0x8,%rsp
+  805772:	49 89 fc             	mov    %rdi,%r12
+  805775:	48 89 f7             	mov    %rsi,%rdi
+  805778:	48 89 d3             	mov    %rdx,%rbx
+  80577b:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80577e:	48 85 f6             	test   %rsi,%rsi
+  805781:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805788:	00 00 00 
+  80578b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80578f:	be 00 00 00 00       	mov    $0x0,%esi
+  805794:	48 85 d2             	test   %rdx,%rdx
+  805797:	74 03                	je     80579c <ipc_recv+0x37>
+  805799:	48 8b 32             	mov    (%rdx),%rsi
+  80579c:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  8057a3:	00 00 00 
+  8057a6:	ff d0                	call   *%rax
+  8057a8:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8057aa:	4c 89 e9             	mov    %r13,%rcx
+  8057ad:	48 89 da             	mov    %rbx,%rdx
+  8057b0:	4c 89 e6             	mov    %r12,%rsi
+  8057b3:	48 b8 f0 56 80 00 00 	movabs $0x8056f0,%rax
+  8057ba:	00 00 00 
+  8057bd:	ff d0                	call   *%rax
+}
+  8057bf:	48 83 c4 08          	add    $0x8,%rsp
+  8057c3:	5b                   	pop    %rbx
+  8057c4:	41 5c                	pop    %r12
+  8057c6:	41 5d                	pop    %r13
+  8057c8:	5d                   	pop    %rbp
+  8057c9:	c3                   	ret
+
+00000000008057ca <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8057ca:	55                   	push   %rbp
+  8057cb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057ce:	48 85 d2             	test   %rdx,%rdx
+  8057d1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057d8:	00 00 00 
+  8057db:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8057df:	89 f6                	mov    %esi,%esi
+  8057e1:	48 b8 b2 2c 80 00 00 	movabs $0x802cb2,%rax
+  8057e8:	00 00 00 
+  8057eb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057ed:	85 c0                	test   %eax,%eax
+  8057ef:	78 02                	js     8057f3 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8057f1:	5d                   	pop    %rbp
+  8057f2:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8057f3:	89 c1                	mov    %eax,%ecx
+  8057f5:	48 ba 08 67 80 00 00 	movabs $0x806708,%rdx
+  8057fc:	00 00 00 
+  8057ff:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805804:	48 bf 15 67 80 00 00 	movabs $0x806715,%rdi
+  80580b:	00 00 00 
+  80580e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805813:	49 b8 ee 16 80 00 00 	movabs $0x8016ee,%r8
+  80581a:	00 00 00 
+  80581d:	41 ff d0             	call   *%r8
+
+0000000000805820 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805820:	55                   	push   %rbp
+  805821:	48 89 e5             	mov    %rsp,%rbp
+  805824:	53                   	push   %rbx
+  805825:	48 83 ec 08          	sub    $0x8,%rsp
+  805829:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80582d:	48 85 d2             	test   %rdx,%rdx
+  805830:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805837:	00 00 00 
+  80583a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80583e:	4d 85 c9             	test   %r9,%r9
+  805841:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80584a:	48 85 db             	test   %rbx,%rbx
+  80584d:	74 03                	je     805852 <ipc_call+0x32>
+  80584f:	48 8b 03             	mov    (%rbx),%rax
+  805852:	89 f6                	mov    %esi,%esi
+  805854:	48 83 ec 08          	sub    $0x8,%rsp
+  805858:	50                   	push   %rax
+  805859:	48 b8 e4 2c 80 00 00 	movabs $0x802ce4,%rax
+  805860:	00 00 00 
+  805863:	ff d0                	call   *%rax
+  805865:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805867:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80586b:	48 89 da             	mov    %rbx,%rdx
+  80586e:	be 00 00 00 00       	mov    $0x0,%esi
+  805873:	48 b8 f0 56 80 00 00 	movabs $0x8056f0,%rax
+  80587a:	00 00 00 
+  80587d:	ff d0                	call   *%rax
+}
+  80587f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805883:	c9                   	leave
+  805884:	c3                   	ret
+
+0000000000805885 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805885:	55                   	push   %rbp
+  805886:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805889:	89 f6                	mov    %esi,%esi
+  80588b:	48 b8 50 2d 80 00 00 	movabs $0x802d50,%rax
+  805892:	00 00 00 
+  805895:	ff d0                	call   *%rax
+  805897:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805899:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80589e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8058a8:	48 b8 f0 56 80 00 00 	movabs $0x8056f0,%rax
+  8058af:	00 00 00 
+  8058b2:	ff d0                	call   *%rax
+}
+  8058b4:	5d                   	pop    %rbp
+  8058b5:	c3                   	ret
+
+00000000008058b6 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8058b6:	55                   	push   %rbp
+  8058b7:	48 89 e5             	mov    %rsp,%rbp
+  8058ba:	41 54                	push   %r12
+  8058bc:	53                   	push   %rbx
+  8058bd:	4c 89 cb             	mov    %r9,%rbx
+  8058c0:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8058c4:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058c8:	48 85 d2             	test   %rdx,%rdx
+  8058cb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058d2:	00 00 00 
+  8058d5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8058d9:	4d 85 c9             	test   %r9,%r9
+  8058dc:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8058e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058e5:	4d 85 e4             	test   %r12,%r12
+  8058e8:	74 04                	je     8058ee <ipc_reply_wait+0x38>
+  8058ea:	49 8b 04 24          	mov    (%r12),%rax
+  8058ee:	89 f6                	mov    %esi,%esi
+  8058f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8058f4:	50                   	push   %rax
+  8058f5:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  8058fc:	00 00 00 
+  8058ff:	ff d0                	call   *%rax
+  805901:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805903:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805907:	4c 89 e2             	mov    %r12,%rdx
+  80590a:	48 89 de             	mov    %rbx,%rsi
+  80590d:	48 b8 f0 56 80 00 00 	movabs $0x8056f0,%rax
+  805914:	00 00 00 
+  805917:	ff d0                	call   *%rax
+}
+  805919:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80591d:	5b                   	pop    %rbx
+  80591e:	41 5c                	pop    %r12
+  805920:	5d                   	pop    %rbp
+  805921:	c3                   	ret
+
+0000000000805922 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805922:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805927:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80592e:	00 00 00 
+  805931:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805938:	48 01 ca             	add    %rcx,%rdx
+  80593b:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805941:	39 fa                	cmp    %edi,%edx
+  805943:	74 12                	je     805957 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805945:	48 83 c0 01          	add    $0x1,%rax
+  805949:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80594f:	75 e0                	jne    805931 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805951:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805956:	c3                   	ret
+            return envs[i].env_id;
+  805957:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80595e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805965:	00 00 00 
+  805968:	48 01 d0             	add    %rdx,%rax
+  80596b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805971:	c3                   	ret
+  805972:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000805978 <__rodata_start>:
+  805978:	77 00                	ja     80597a <__rodata_start+0x2>
+  80597a:	72 62                	jb     8059de <__rodata_start+0x66>
+  80597c:	00 77 62             	add    %dh,0x62(%rdi)
+  80597f:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 ed                	add    %ch,%ch
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	ed                   	in     (%dx),%eax
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 ed                	add    %ch,%ch
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	8c 0a                	mov    %cs,(%rdx)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	8c 0a                	mov    %cs,(%rdx)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	8c 0a                	mov    %cs,(%rdx)
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	8c 0a                	mov    %cs,(%rdx)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	8c 0a                	mov    %cs,(%rdx)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	f4                   	hlt
+  805b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b1f:	00 ed                	add    %ch,%ch
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	2c 0b                	sub    $0xb,%al
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 ed                	add    %ch,%ch
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b73:	00 00                	add    %al,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 cb                	add    %cl,%bl
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	6a 0a                	push   $0xa
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	3c 0a                	cmp    $0xa,%al
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 ed                	add    %ch,%ch
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805bcb:	00 00                	add    %al,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 29                	add    %ch,(%rcx)
+  805bd9:	0c 80                	or     $0x80,%al
+  805bdb:	00 00                	add    %al,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	1a 0b                	sbb    (%rbx),%cl
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 ed                	add    %ch,%ch
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ce                   	(bad)
+  805c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c07:	00 ed                	add    %ch,%ch
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	f4                   	hlt
+  805c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c1f:	00 37                	add    %dh,(%rdi)
+  805c21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 37                	add    %dh,(%rdi)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c4b:	00 00                	add    %al,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 d2                	add    %dl,%dl
+  805c51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c57:	00 d2                	add    %dl,%dl
+  805c59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c5f:	00 d2                	add    %dl,%dl
+  805c61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c67:	00 d2                	add    %dl,%dl
+  805c69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c6f:	00 d2                	add    %dl,%dl
+  805c71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c77:	00 d2                	add    %dl,%dl
+  805c79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c7f:	00 d2                	add    %dl,%dl
+  805c81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c87:	00 f6                	add    %dh,%dh
+  805c89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c8f:	00 f6                	add    %dh,%dh
+  805c91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 22                	add    %ah,(%rdx)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 22                	add    %ah,(%rdx)
+  805cd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cdf:	00 22                	add    %ah,(%rdx)
+  805ce1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ce7:	00 22                	add    %ah,(%rdx)
+  805ce9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cef:	00 22                	add    %ah,(%rdx)
+  805cf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cf7:	00 22                	add    %ah,(%rdx)
+  805cf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 46 12             	add    %al,0x12(%rsi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 22                	add    %ah,(%rdx)
+  805dd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dd7:	00 22                	add    %ah,(%rdx)
+  805dd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ddf:	00 22                	add    %ah,(%rdx)
+  805de1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805de7:	00 22                	add    %ah,(%rdx)
+  805de9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805def:	00 22                	add    %ah,(%rdx)
+  805df1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805df7:	00 22                	add    %ah,(%rdx)
+  805df9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 46 12             	add    %al,0x12(%rsi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ea0 <basefix.0>:
+  805ea0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805eb0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805ec0:	10 00 66 0f 1f 44 00 00 72 61 6e 20 6f 6e 20 74     ..f..D..ran on t
+  805ed0:	77 6f 20 43 50 55 73 20 61 74 20 6f 6e 63 65 20     wo CPUs at once 
+  805ee0:	28 63 6f 75 6e 74 65 72 20 69 73 20 25 64 29 00     (counter is %d).
+  805ef0:	75 73 65 72 2f 73 74 72 65 73 73 73 63 68 65 64     user/stresssched
+  805f00:	2e 63 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 00     .c.<unknown>....
+  805f10:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805f20:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805f30:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805f40:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805f50:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805f60:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805f70:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  805f80:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  805f90:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  805fa0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  805fb0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  805fc0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  805fd0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  805fe0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  805ff0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806000:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806010:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806020:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806030:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806040:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806050:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806060:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806070:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806080:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806090:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8060a0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8060b0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8060c0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  8060d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8060e0:	36 1a 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     6........ ......
+  8060f0:	7d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     } ....... ......
+  806100:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806110:	8d 20 80 00 00 00 00 00 55 1a 80 00 00 00 00 00     . ......U.......
+  806120:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806130:	49 1a 80 00 00 00 00 00 c3 1a 80 00 00 00 00 00     I...............
+  806140:	8d 20 80 00 00 00 00 00 49 1a 80 00 00 00 00 00     . ......I.......
+  806150:	8f 1a 80 00 00 00 00 00 8f 1a 80 00 00 00 00 00     ................
+  806160:	8f 1a 80 00 00 00 00 00 8f 1a 80 00 00 00 00 00     ................
+  806170:	8f 1a 80 00 00 00 00 00 8f 1a 80 00 00 00 00 00     ................
+  806180:	8f 1a 80 00 00 00 00 00 8f 1a 80 00 00 00 00 00     ................
+  806190:	8f 1a 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     ......... ......
+  8061a0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8061b0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8061d0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8061e0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8061f0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806200:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806210:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806220:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806230:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806240:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806250:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806260:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806270:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806280:	8d 20 80 00 00 00 00 00 ab 1f 80 00 00 00 00 00     . ..............
+  806290:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8062a0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8062b0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8062c0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8062d0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  8062e0:	f1 1a 80 00 00 00 00 00 c0 1c 80 00 00 00 00 00     ................
+  8062f0:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806300:	8d 20 80 00 00 00 00 00 e6 1a 80 00 00 00 00 00     . ..............
+  806310:	20 1b 80 00 00 00 00 00 8d 20 80 00 00 00 00 00      ........ ......
+  806320:	8d 20 80 00 00 00 00 00 db 1a 80 00 00 00 00 00     . ..............
+  806330:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806340:	69 1e 80 00 00 00 00 00 38 1f 80 00 00 00 00 00     i.......8.......
+  806350:	8d 20 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     . ....... ......
+  806360:	b7 1b 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     ......... ......
+  806370:	94 1d 80 00 00 00 00 00 8d 20 80 00 00 00 00 00     ......... ......
+  806380:	8d 20 80 00 00 00 00 00 ab 1f 80 00 00 00 00 00     . ..............
+  806390:	8d 20 80 00 00 00 00 00 3f 1a 80 00 00 00 00 00     . ......?.......
+
+00000000008063a0 <error_string>:
+	...
+  8063a8:	65 5f 80 00 00 00 00 00 77 5f 80 00 00 00 00 00     e_......w_......
+  8063b8:	87 5f 80 00 00 00 00 00 99 5f 80 00 00 00 00 00     ._......._......
+  8063c8:	a7 5f 80 00 00 00 00 00 bb 5f 80 00 00 00 00 00     ._......._......
+  8063d8:	d0 5f 80 00 00 00 00 00 e3 5f 80 00 00 00 00 00     ._......._......
+  8063e8:	f5 5f 80 00 00 00 00 00 09 60 80 00 00 00 00 00     ._.......`......
+  8063f8:	19 60 80 00 00 00 00 00 2c 60 80 00 00 00 00 00     .`......,`......
+  806408:	43 60 80 00 00 00 00 00 59 60 80 00 00 00 00 00     C`......Y`......
+  806418:	71 60 80 00 00 00 00 00 89 60 80 00 00 00 00 00     q`.......`......
+  806428:	96 60 80 00 00 00 00 00 40 64 80 00 00 00 00 00     .`......@d......
+  806438:	aa 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806448:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806458:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806468:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806478:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806488:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806498:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8064a8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8064b8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8064c8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8064d8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8064e8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8064f8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806508:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806518:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806528:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806538:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806548:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806558:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806568:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806578:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806588:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806598:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008065a0 <devtab>:
+  8065a0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8065b0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065c0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065d0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8065e0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8065f0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806600:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806610:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806620:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806630:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806640:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806650:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806660:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806670:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806680:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806690:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8066a0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8066b0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8066c0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8066d0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8066e0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8066f0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806700:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806710:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,10536 @@
+
+obj/user/syscallbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 e3 25 80 00 00 	movabs $0x8025e3,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 64 24 80 00 00 	movabs $0x802464,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 7a 3f 80 00 00 	movabs $0x803f7a,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 7a 3f 80 00 00 	movabs $0x803f7a,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 37 60 80 00 00 	movabs $0x806037,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a0 59 80 00 00 	movabs $0x8059a0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be a2 59 80 00 00 	movabs $0x8059a2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be a5 59 80 00 00 	movabs $0x8059a5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 8c 4d 80 00 00 	movabs $0x804d8c,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 63 50 80 00 00 	movabs $0x805063,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 8e 36 80 00 00 	movabs $0x80368e,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 57 37 80 00 00 	movabs $0x803757,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 5d 36 80 00 00 	movabs $0x80365d,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 5d 36 80 00 00 	movabs $0x80365d,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 75 34 80 00 00 	movabs $0x803475,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb b0 25 80 00 00 	movabs $0x8025b0,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 59 80 00 00 	movabs $0x8059c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 b0 25 80 00 00 	movabs $0x8025b0,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 e3 25 80 00 00 	movabs $0x8025e3,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc b0 25 80 00 00 	movabs $0x8025b0,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 5c 80 00 00 	movabs $0x805c60,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf b0 25 80 00 00 	movabs $0x8025b0,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf b0 25 80 00 00 	movabs $0x8025b0,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 5e 80 00 00 	movabs $0x805ee0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 5e 80 00 00 	movabs $0x805ee0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 ef 02 00 00       	call   8017ee <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <report>:
+#include <inc/lib.h>
+
+#define BENCH_ITERS (1 << 18)
+
+static void
+report(const char *name, long iters, uint32_t elapsed) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	89 d1                	mov    %edx,%ecx
+    cprintf("syscallbench: %-20s %ld calls in %u ms (%ld ns/call)\n",
+            name, iters, elapsed, (long)elapsed * 1000000 / iters);
+  801507:	89 d0                	mov    %edx,%eax
+  801509:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+    cprintf("syscallbench: %-20s %ld calls in %u ms (%ld ns/call)\n",
+  801510:	48 99                	cqto
+  801512:	48 f7 fe             	idiv   %rsi
+  801515:	49 89 c0             	mov    %rax,%r8
+  801518:	48 89 f2             	mov    %rsi,%rdx
+  80151b:	48 89 fe             	mov    %rdi,%rsi
+  80151e:	48 bf 08 5f 80 00 00 	movabs $0x805f08,%rdi
+  801525:	00 00 00 
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	49 b9 0a 1a 80 00 00 	movabs $0x801a0a,%r9
+  801534:	00 00 00 
+  801537:	41 ff d1             	call   *%r9
+}
+  80153a:	5d                   	pop    %rbp
+  80153b:	c3                   	ret
+
+000000000080153c <umain>:
+
+void
+umain(int argc, char **argv) {
+  80153c:	55                   	push   %rbp
+  80153d:	48 89 e5             	mov    %rsp,%rbp
+  801540:	41 57                	push   %r15
+  801542:	41 56                	push   %r14
+  801544:	41 55                	push   %r13
+  801546:	41 54                	push   %r12
+  801548:	53                   	push   %rbx
+  801549:	48 81 ec d8 00 00 00 	sub    $0xd8,%rsp
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  801550:	83 ff 01             	cmp    $0x1,%edi
+  801553:	0f 8f ca 00 00 00    	jg     801623 <umain+0xe7>
+    uint32_t start;
+    int res;
+
+    start = vsys_gettimems();
+  801559:	48 b8 f0 49 80 00 00 	movabs $0x8049f0,%rax
+  801560:	00 00 00 
+  801563:	ff d0                	call   *%rax
+  801565:	41 89 c6             	mov    %eax,%r14d
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  801568:	41 bd 00 00 04 00    	mov    $0x40000,%r13d
+  80156e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (long i = 0; i < iters; i++) sys_getenvid();
+  801573:	49 bc ce 29 80 00 00 	movabs $0x8029ce,%r12
+  80157a:	00 00 00 
+  80157d:	41 ff d4             	call   *%r12
+  801580:	48 83 c3 01          	add    $0x1,%rbx
+  801584:	4c 39 eb             	cmp    %r13,%rbx
+  801587:	75 f4                	jne    80157d <umain+0x41>
+    report("getenvid", iters, vsys_gettimems() - start);
+  801589:	48 b8 f0 49 80 00 00 	movabs $0x8049f0,%rax
+  801590:	00 00 00 
+  801593:	ff d0                	call   *%rax
+  801595:	44 29 f0             	sub    %r14d,%eax
+  801598:	89 c2                	mov    %eax,%edx
+  80159a:	4c 89 ee             	mov    %r13,%rsi
+  80159d:	48 bf 3e 5f 80 00 00 	movabs $0x805f3e,%rdi
+  8015a4:	00 00 00 
+  8015a7:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015ae:	00 00 00 
+  8015b1:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8015b3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015b8:	cd 30                	int    $0x30
+  8015ba:	41 89 c6             	mov    %eax,%r14d
+
+    /* Child is never run, it only provides a trapframe to set */
+    envid_t child = sys_exofork();
+    if (child < 0) panic("sys_exofork: %i", child);
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	0f 88 98 00 00 00    	js     80165d <umain+0x121>
+    if (!child) exit();
+  8015c5:	0f 84 bf 00 00 00    	je     80168a <umain+0x14e>
+    struct Trapframe tf = envs[ENVX(child)].env_tf;
+  8015cb:	44 89 f0             	mov    %r14d,%eax
+  8015ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015d3:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8015da:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8015e1:	00 00 00 
+  8015e4:	48 01 c6             	add    %rax,%rsi
+  8015e7:	48 8d bd 10 ff ff ff 	lea    -0xf0(%rbp),%rdi
+  8015ee:	b9 18 00 00 00       	mov    $0x18,%ecx
+  8015f3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+
+    start = vsys_gettimems();
+  8015f6:	48 b8 f0 49 80 00 00 	movabs $0x8049f0,%rax
+  8015fd:	00 00 00 
+  801600:	ff d0                	call   *%rax
+  801602:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%rbp)
+    for (long i = 0; i < iters; i++)
+  801608:	4d 85 ed             	test   %r13,%r13
+  80160b:	0f 8e 92 01 00 00    	jle    8017a3 <umain+0x267>
+  801611:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if ((res = sys_env_set_trapframe(child, &tf)) < 0)
+  801617:	49 bf 5a 2c 80 00 00 	movabs $0x802c5a,%r15
+  80161e:	00 00 00 
+  801621:	eb 7b                	jmp    80169e <umain+0x162>
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+  801623:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  801627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162c:	be 00 00 00 00       	mov    $0x0,%esi
+  801631:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  801638:	00 00 00 
+  80163b:	ff d0                	call   *%rax
+  80163d:	49 89 c5             	mov    %rax,%r13
+    start = vsys_gettimems();
+  801640:	48 b8 f0 49 80 00 00 	movabs $0x8049f0,%rax
+  801647:	00 00 00 
+  80164a:	ff d0                	call   *%rax
+  80164c:	41 89 c6             	mov    %eax,%r14d
+    for (long i = 0; i < iters; i++) sys_getenvid();
+  80164f:	4d 85 ed             	test   %r13,%r13
+  801652:	0f 8f 16 ff ff ff    	jg     80156e <umain+0x32>
+  801658:	e9 2c ff ff ff       	jmp    801589 <umain+0x4d>
+    if (child < 0) panic("sys_exofork: %i", child);
+  80165d:	89 c1                	mov    %eax,%ecx
+  80165f:	48 ba 47 5f 80 00 00 	movabs $0x805f47,%rdx
+  801666:	00 00 00 
+  801669:	be 1a 00 00 00       	mov    $0x1a,%esi
+  80166e:	48 bf 57 5f 80 00 00 	movabs $0x805f57,%rdi
+  801675:	00 00 00 
+  801678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167d:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  801684:	00 00 00 
+  801687:	41 ff d0             	call   *%r8
+    if (!child) exit();
+  80168a:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801691:	00 00 00 
+  801694:	ff d0                	call   *%rax
+  801696:	e9 30 ff ff ff       	jmp    8015cb <umain+0x8f>
+    for (long i = 0; i < iters; i++)
+  80169b:	49 89 dc             	mov    %rbx,%r12
+        if ((res = sys_env_set_trapframe(child, &tf)) < 0)
+  80169e:	48 8d b5 10 ff ff ff 	lea    -0xf0(%rbp),%rsi
+  8016a5:	44 89 f7             	mov    %r14d,%edi
+  8016a8:	41 ff d7             	call   *%r15
+  8016ab:	85 c0                	test   %eax,%eax
+  8016ad:	0f 88 c3 00 00 00    	js     801776 <umain+0x23a>
+    for (long i = 0; i < iters; i++)
+  8016b3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8016b8:	4c 39 eb             	cmp    %r13,%rbx
+  8016bb:	75 de                	jne    80169b <umain+0x15f>
+            panic("sys_env_set_trapframe: %i", res);
+    report("env_set_trapframe", iters, vsys_gettimems() - start);
+  8016bd:	49 bf f0 49 80 00 00 	movabs $0x8049f0,%r15
+  8016c4:	00 00 00 
+  8016c7:	41 ff d7             	call   *%r15
+  8016ca:	8b 8d 0c ff ff ff    	mov    -0xf4(%rbp),%ecx
+  8016d0:	29 c8                	sub    %ecx,%eax
+  8016d2:	89 c2                	mov    %eax,%edx
+  8016d4:	48 89 de             	mov    %rbx,%rsi
+  8016d7:	48 bf 85 5f 80 00 00 	movabs $0x805f85,%rdi
+  8016de:	00 00 00 
+  8016e1:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+
+    sys_env_destroy(child);
+  8016ed:	44 89 f7             	mov    %r14d,%edi
+  8016f0:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+
+    start = vsys_gettimems();
+  8016fc:	41 ff d7             	call   *%r15
+  8016ff:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%rbp)
+    for (long i = 0; i < iters; i++) sys_cputs("", 0);
+  801705:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170a:	49 bf 94 65 80 00 00 	movabs $0x806594,%r15
+  801711:	00 00 00 
+  801714:	49 be be 28 80 00 00 	movabs $0x8028be,%r14
+  80171b:	00 00 00 
+  80171e:	be 00 00 00 00       	mov    $0x0,%esi
+  801723:	4c 89 ff             	mov    %r15,%rdi
+  801726:	41 ff d6             	call   *%r14
+  801729:	48 89 d8             	mov    %rbx,%rax
+  80172c:	48 83 c3 01          	add    $0x1,%rbx
+  801730:	49 39 c4             	cmp    %rax,%r12
+  801733:	75 e9                	jne    80171e <umain+0x1e2>
+    report("cputs (empty)", iters, vsys_gettimems() - start);
+  801735:	48 b8 f0 49 80 00 00 	movabs $0x8049f0,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+  801741:	8b 8d 0c ff ff ff    	mov    -0xf4(%rbp),%ecx
+  801747:	29 c8                	sub    %ecx,%eax
+  801749:	89 c2                	mov    %eax,%edx
+  80174b:	4c 89 ee             	mov    %r13,%rsi
+  80174e:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801755:	00 00 00 
+  801758:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80175f:	00 00 00 
+  801762:	ff d0                	call   *%rax
+}
+  801764:	48 81 c4 d8 00 00 00 	add    $0xd8,%rsp
+  80176b:	5b                   	pop    %rbx
+  80176c:	41 5c                	pop    %r12
+  80176e:	41 5d                	pop    %r13
+  801770:	41 5e                	pop    %r14
+  801772:	41 5f                	pop    %r15
+  801774:	5d                   	pop    %rbp
+  801775:	c3                   	ret
+            panic("sys_env_set_trapframe: %i", res);
+  801776:	89 c1                	mov    %eax,%ecx
+  801778:	48 ba 6b 5f 80 00 00 	movabs $0x805f6b,%rdx
+  80177f:	00 00 00 
+  801782:	be 21 00 00 00       	mov    $0x21,%esi
+  801787:	48 bf 57 5f 80 00 00 	movabs $0x805f57,%rdi
+  80178e:	00 00 00 
+  801791:	b8 00 00 00 00       	mov    $0x0,%eax
+  801796:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  80179d:	00 00 00 
+  8017a0:	41 ff d0             	call   *%r8
+    report("env_set_trapframe", iters, vsys_gettimems() - start);
+  8017a3:	48 bb f0 49 80 00 00 	movabs $0x8049f0,%rbx
+  8017aa:	00 00 00 
+  8017ad:	ff d3                	call   *%rbx
+  8017af:	8b 8d 0c ff ff ff    	mov    -0xf4(%rbp),%ecx
+  8017b5:	29 c8                	sub    %ecx,%eax
+  8017b7:	89 c2                	mov    %eax,%edx
+  8017b9:	4c 89 ee             	mov    %r13,%rsi
+  8017bc:	48 bf 85 5f 80 00 00 	movabs $0x805f85,%rdi
+  8017c3:	00 00 00 
+  8017c6:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  8017d2:	44 89 f7             	mov    %r14d,%edi
+  8017d5:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  8017dc:	00 00 00 
+  8017df:	ff d0                	call   *%rax
+    start = vsys_gettimems();
+  8017e1:	ff d3                	call   *%rbx
+  8017e3:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%rbp)
+    for (long i = 0; i < iters; i++) sys_cputs("", 0);
+  8017e9:	e9 47 ff ff ff       	jmp    801735 <umain+0x1f9>
+
+00000000008017ee <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+  8017f2:	41 56                	push   %r14
+  8017f4:	41 55                	push   %r13
+  8017f6:	41 54                	push   %r12
+  8017f8:	53                   	push   %rbx
+  8017f9:	41 89 fd             	mov    %edi,%r13d
+  8017fc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8017ff:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801806:	00 00 00 
+  801809:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801810:	00 00 00 
+  801813:	48 39 c2             	cmp    %rax,%rdx
+  801816:	73 17                	jae    80182f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801818:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80181b:	49 89 c4             	mov    %rax,%r12
+  80181e:	48 83 c3 08          	add    $0x8,%rbx
+  801822:	b8 00 00 00 00       	mov    $0x0,%eax
+  801827:	ff 53 f8             	call   *-0x8(%rbx)
+  80182a:	4c 39 e3             	cmp    %r12,%rbx
+  80182d:	72 ef                	jb     80181e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80182f:	48 b8 ce 29 80 00 00 	movabs $0x8029ce,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+  80183b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801840:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801847:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80184e:	00 00 00 
+  801851:	48 01 d0             	add    %rdx,%rax
+  801854:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80185b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80185e:	45 85 ed             	test   %r13d,%r13d
+  801861:	7e 0d                	jle    801870 <libmain+0x82>
+  801863:	49 8b 06             	mov    (%r14),%rax
+  801866:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80186d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801870:	4c 89 f6             	mov    %r14,%rsi
+  801873:	44 89 ef             	mov    %r13d,%edi
+  801876:	48 b8 3c 15 80 00 00 	movabs $0x80153c,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801882:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+#endif
+}
+  80188e:	5b                   	pop    %rbx
+  80188f:	41 5c                	pop    %r12
+  801891:	41 5d                	pop    %r13
+  801893:	41 5e                	pop    %r14
+  801895:	5d                   	pop    %rbp
+  801896:	c3                   	ret
+
+0000000000801897 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801897:	55                   	push   %rbp
+  801898:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80189b:	48 b8 2a 33 80 00 00 	movabs $0x80332a,%rax
+  8018a2:	00 00 00 
+  8018a5:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8018a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ac:	48 b8 5d 29 80 00 00 	movabs $0x80295d,%rax
+  8018b3:	00 00 00 
+  8018b6:	ff d0                	call   *%rax
+}
+  8018b8:	5d                   	pop    %rbp
+  8018b9:	c3                   	ret
+
+00000000008018ba <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8018ba:	55                   	push   %rbp
+  8018bb:	48 89 e5             	mov    %rsp,%rbp
+  8018be:	41 56                	push   %r14
+  8018c0:	41 55                	push   %r13
+  8018c2:	41 54                	push   %r12
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 50          	sub    $0x50,%rsp
+  8018c9:	49 89 fc             	mov    %rdi,%r12
+  8018cc:	41 89 f5             	mov    %esi,%r13d
+  8018cf:	48 89 d3             	mov    %rdx,%rbx
+  8018d2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8018d6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8018da:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8018de:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8018e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018e9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8018ed:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8018f1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8018f5:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8018fc:	00 00 00 
+  8018ff:	4c 8b 30             	mov    (%rax),%r14
+  801902:	48 b8 ce 29 80 00 00 	movabs $0x8029ce,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+  80190e:	89 c6                	mov    %eax,%esi
+  801910:	45 89 e8             	mov    %r13d,%r8d
+  801913:	4c 89 e1             	mov    %r12,%rcx
+  801916:	4c 89 f2             	mov    %r14,%rdx
+  801919:	48 bf b0 5f 80 00 00 	movabs $0x805fb0,%rdi
+  801920:	00 00 00 
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+  801928:	49 bc 0a 1a 80 00 00 	movabs $0x801a0a,%r12
+  80192f:	00 00 00 
+  801932:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801935:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801939:	48 89 df             	mov    %rbx,%rdi
+  80193c:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801943:	00 00 00 
+  801946:	ff d0                	call   *%rax
+    cprintf("\n");
+  801948:	48 bf 93 65 80 00 00 	movabs $0x806593,%rdi
+  80194f:	00 00 00 
+  801952:	b8 00 00 00 00       	mov    $0x0,%eax
+  801957:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80195a:	cc                   	int3
+  80195b:	eb fd                	jmp    80195a <_panic+0xa0>
+
+000000000080195d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80195d:	55                   	push   %rbp
+  80195e:	48 89 e5             	mov    %rsp,%rbp
+  801961:	53                   	push   %rbx
+  801962:	48 83 ec 08          	sub    $0x8,%rsp
+  801966:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801969:	8b 06                	mov    (%rsi),%eax
+  80196b:	8d 50 01             	lea    0x1(%rax),%edx
+  80196e:	89 16                	mov    %edx,(%rsi)
+  801970:	48 98                	cltq
+  801972:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801977:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80197d:	74 0a                	je     801989 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80197f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801983:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801987:	c9                   	leave
+  801988:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801989:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80198d:	be ff 00 00 00       	mov    $0xff,%esi
+  801992:	48 b8 be 28 80 00 00 	movabs $0x8028be,%rax
+  801999:	00 00 00 
+  80199c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80199e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8019a4:	eb d9                	jmp    80197f <putch+0x22>
+
+00000000008019a6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+  8019aa:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8019b1:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8019b4:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8019bb:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8019c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8019c8:	48 89 f1             	mov    %rsi,%rcx
+  8019cb:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8019d2:	48 bf 5d 19 80 00 00 	movabs $0x80195d,%rdi
+  8019d9:	00 00 00 
+  8019dc:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8019e8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8019ef:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8019f6:	48 b8 be 28 80 00 00 	movabs $0x8028be,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a02:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a08:	c9                   	leave
+  801a09:	c3                   	ret
+
+0000000000801a0a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a0a:	55                   	push   %rbp
+  801a0b:	48 89 e5             	mov    %rsp,%rbp
+  801a0e:	48 83 ec 50          	sub    $0x50,%rsp
+  801a12:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a16:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a1e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a22:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a26:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a35:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a3d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a41:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a4d:	c9                   	leave
+  801a4e:	c3                   	ret
+
+0000000000801a4f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a4f:	55                   	push   %rbp
+  801a50:	48 89 e5             	mov    %rsp,%rbp
+  801a53:	41 57                	push   %r15
+  801a55:	41 56                	push   %r14
+  801a57:	41 55                	push   %r13
+  801a59:	41 54                	push   %r12
+  801a5b:	53                   	push   %rbx
+  801a5c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a60:	49 89 fc             	mov    %rdi,%r12
+  801a63:	49 89 f5             	mov    %rsi,%r13
+  801a66:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a6a:	8b 45 10             	mov    0x10(%rbp),%eax
+  801a6d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801a70:	41 89 cf             	mov    %ecx,%r15d
+  801a73:	4c 39 fa             	cmp    %r15,%rdx
+  801a76:	73 5b                	jae    801ad3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801a78:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801a7c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801a80:	85 db                	test   %ebx,%ebx
+  801a82:	7e 0e                	jle    801a92 <print_num+0x43>
+            putch(padc, put_arg);
+  801a84:	4c 89 ee             	mov    %r13,%rsi
+  801a87:	44 89 f7             	mov    %r14d,%edi
+  801a8a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801a8d:	83 eb 01             	sub    $0x1,%ebx
+  801a90:	75 f2                	jne    801a84 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801a92:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801a96:	48 b9 e4 5f 80 00 00 	movabs $0x805fe4,%rcx
+  801a9d:	00 00 00 
+  801aa0:	48 b8 d3 5f 80 00 00 	movabs $0x805fd3,%rax
+  801aa7:	00 00 00 
+  801aaa:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801aae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ab2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab7:	49 f7 f7             	div    %r15
+  801aba:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801abe:	4c 89 ee             	mov    %r13,%rsi
+  801ac1:	41 ff d4             	call   *%r12
+}
+  801ac4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801ac8:	5b                   	pop    %rbx
+  801ac9:	41 5c                	pop    %r12
+  801acb:	41 5d                	pop    %r13
+  801acd:	41 5e                	pop    %r14
+  801acf:	41 5f                	pop    %r15
+  801ad1:	5d                   	pop    %rbp
+  801ad2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801ad3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ad7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801adc:	49 f7 f7             	div    %r15
+  801adf:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801ae7:	52                   	push   %rdx
+  801ae8:	45 0f be c9          	movsbl %r9b,%r9d
+  801aec:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801af0:	48 89 c2             	mov    %rax,%rdx
+  801af3:	48 b8 4f 1a 80 00 00 	movabs $0x801a4f,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+  801aff:	48 83 c4 10          	add    $0x10,%rsp
+  801b03:	eb 8d                	jmp    801a92 <print_num+0x43>
+
+0000000000801b05 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b05:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b09:	48 8b 06             	mov    (%rsi),%rax
+  801b0c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b10:	73 0a                	jae    801b1c <sprintputch+0x17>
+        *state->start++ = ch;
+  801b12:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b16:	48 89 16             	mov    %rdx,(%rsi)
+  801b19:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b1c:	c3                   	ret
+
+0000000000801b1d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b1d:	55                   	push   %rbp
+  801b1e:	48 89 e5             	mov    %rsp,%rbp
+  801b21:	48 83 ec 50          	sub    $0x50,%rsp
+  801b25:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b29:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b2d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b31:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b38:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b40:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b44:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b48:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b4c:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+}
+  801b58:	c9                   	leave
+  801b59:	c3                   	ret
+
+0000000000801b5a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	41 57                	push   %r15
+  801b60:	41 56                	push   %r14
+  801b62:	41 55                	push   %r13
+  801b64:	41 54                	push   %r12
+  801b66:	53                   	push   %rbx
+  801b67:	48 83 ec 38          	sub    $0x38,%rsp
+  801b6b:	49 89 fe             	mov    %rdi,%r14
+  801b6e:	49 89 f5             	mov    %rsi,%r13
+  801b71:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801b74:	48 8b 01             	mov    (%rcx),%rax
+  801b77:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801b7b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801b7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b83:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801b87:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801b8b:	eb 0d                	jmp    801b9a <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801b8d:	40 0f b6 ff          	movzbl %dil,%edi
+  801b91:	4c 89 ee             	mov    %r13,%rsi
+  801b94:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801b97:	4c 89 e3             	mov    %r12,%rbx
+  801b9a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801b9e:	0f b6 3b             	movzbl (%rbx),%edi
+  801ba1:	40 80 ff 25          	cmp    $0x25,%dil
+  801ba5:	74 14                	je     801bbb <vprintfmt+0x61>
+            if (!ch) return;
+  801ba7:	40 84 ff             	test   %dil,%dil
+  801baa:	75 e1                	jne    801b8d <vprintfmt+0x33>
+}
+  801bac:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bb0:	5b                   	pop    %rbx
+  801bb1:	41 5c                	pop    %r12
+  801bb3:	41 5d                	pop    %r13
+  801bb5:	41 5e                	pop    %r14
+  801bb7:	41 5f                	pop    %r15
+  801bb9:	5d                   	pop    %rbp
+  801bba:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801bbb:	be 00 00 00 00       	mov    $0x0,%esi
+  801bc0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801bc9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801bcf:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801bd6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801bda:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801bdf:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801be4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801be7:	83 e8 23             	sub    $0x23,%eax
+  801bea:	3c 57                	cmp    $0x57,%al
+  801bec:	0f 87 67 06 00 00    	ja     802259 <vprintfmt+0x6ff>
+  801bf2:	0f b6 c0             	movzbl %al,%eax
+  801bf5:	48 b9 80 61 80 00 00 	movabs $0x806180,%rcx
+  801bfc:	00 00 00 
+  801bff:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c02:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c05:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c09:	eb cf                	jmp    801bda <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c0b:	49 89 dc             	mov    %rbx,%r12
+  801c0e:	be 01 00 00 00       	mov    $0x1,%esi
+  801c13:	eb c5                	jmp    801bda <vprintfmt+0x80>
+            padc = ch;
+  801c15:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c19:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c1c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c1f:	eb b9                	jmp    801bda <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c24:	83 f8 2f             	cmp    $0x2f,%eax
+  801c27:	77 24                	ja     801c4d <vprintfmt+0xf3>
+  801c29:	89 c1                	mov    %eax,%ecx
+  801c2b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c2f:	83 c0 08             	add    $0x8,%eax
+  801c32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c35:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c38:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c3b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c3f:	79 99                	jns    801bda <vprintfmt+0x80>
+                width = precision;
+  801c41:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c45:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c4b:	eb 8d                	jmp    801bda <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c4d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c51:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c59:	eb da                	jmp    801c35 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c5b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c60:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c64:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801c6a:	3c 39                	cmp    $0x39,%al
+  801c6c:	77 1c                	ja     801c8a <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801c6e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801c72:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801c76:	0f b6 c0             	movzbl %al,%eax
+  801c79:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c7e:	0f b6 03             	movzbl (%rbx),%eax
+  801c81:	3c 39                	cmp    $0x39,%al
+  801c83:	76 e9                	jbe    801c6e <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801c85:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801c88:	eb b1                	jmp    801c3b <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801c8a:	49 89 dc             	mov    %rbx,%r12
+  801c8d:	eb ac                	jmp    801c3b <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801c8f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801c92:	85 c9                	test   %ecx,%ecx
+  801c94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c99:	0f 49 c1             	cmovns %ecx,%eax
+  801c9c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801c9f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ca2:	e9 33 ff ff ff       	jmp    801bda <vprintfmt+0x80>
+            lflag++;
+  801ca7:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801caa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cad:	e9 28 ff ff ff       	jmp    801bda <vprintfmt+0x80>
+            lflag--;
+  801cb2:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cb5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cb8:	e9 1d ff ff ff       	jmp    801bda <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801cbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cc0:	83 f8 2f             	cmp    $0x2f,%eax
+  801cc3:	77 19                	ja     801cde <vprintfmt+0x184>
+  801cc5:	89 c2                	mov    %eax,%edx
+  801cc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ccb:	83 c0 08             	add    $0x8,%eax
+  801cce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cd1:	8b 3a                	mov    (%rdx),%edi
+  801cd3:	4c 89 ee             	mov    %r13,%rsi
+  801cd6:	41 ff d6             	call   *%r14
+            break;
+  801cd9:	e9 bc fe ff ff       	jmp    801b9a <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ce2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ce6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cea:	eb e5                	jmp    801cd1 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801cec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cef:	83 f8 2f             	cmp    $0x2f,%eax
+  801cf2:	77 5a                	ja     801d4e <vprintfmt+0x1f4>
+  801cf4:	89 c2                	mov    %eax,%edx
+  801cf6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cfa:	83 c0 08             	add    $0x8,%eax
+  801cfd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d00:	8b 02                	mov    (%rdx),%eax
+  801d02:	89 c1                	mov    %eax,%ecx
+  801d04:	f7 d9                	neg    %ecx
+  801d06:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d09:	83 f9 13             	cmp    $0x13,%ecx
+  801d0c:	7f 4e                	jg     801d5c <vprintfmt+0x202>
+  801d0e:	48 63 c1             	movslq %ecx,%rax
+  801d11:	48 ba 40 64 80 00 00 	movabs $0x806440,%rdx
+  801d18:	00 00 00 
+  801d1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d1f:	48 85 c0             	test   %rax,%rax
+  801d22:	74 38                	je     801d5c <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d24:	48 89 c1             	mov    %rax,%rcx
+  801d27:	48 ba 08 66 80 00 00 	movabs $0x806608,%rdx
+  801d2e:	00 00 00 
+  801d31:	4c 89 ee             	mov    %r13,%rsi
+  801d34:	4c 89 f7             	mov    %r14,%rdi
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	49 b8 1d 1b 80 00 00 	movabs $0x801b1d,%r8
+  801d43:	00 00 00 
+  801d46:	41 ff d0             	call   *%r8
+  801d49:	e9 4c fe ff ff       	jmp    801b9a <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d5a:	eb a4                	jmp    801d00 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d5c:	48 ba fc 5f 80 00 00 	movabs $0x805ffc,%rdx
+  801d63:	00 00 00 
+  801d66:	4c 89 ee             	mov    %r13,%rsi
+  801d69:	4c 89 f7             	mov    %r14,%rdi
+  801d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d71:	49 b8 1d 1b 80 00 00 	movabs $0x801b1d,%r8
+  801d78:	00 00 00 
+  801d7b:	41 ff d0             	call   *%r8
+  801d7e:	e9 17 fe ff ff       	jmp    801b9a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d86:	83 f8 2f             	cmp    $0x2f,%eax
+  801d89:	77 6c                	ja     801df7 <vprintfmt+0x29d>
+  801d8b:	89 c2                	mov    %eax,%edx
+  801d8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d91:	83 c0 08             	add    $0x8,%eax
+  801d94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d97:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801d9a:	48 85 f6             	test   %rsi,%rsi
+  801d9d:	48 b8 f5 5f 80 00 00 	movabs $0x805ff5,%rax
+  801da4:	00 00 00 
+  801da7:	48 0f 45 c6          	cmovne %rsi,%rax
+  801dab:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801daf:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801db3:	7e 06                	jle    801dbb <vprintfmt+0x261>
+  801db5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801db9:	75 4a                	jne    801e05 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801dbb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801dbf:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801dc3:	0f b6 00             	movzbl (%rax),%eax
+  801dc6:	84 c0                	test   %al,%al
+  801dc8:	0f 85 9a 00 00 00    	jne    801e68 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801dce:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801dd1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801dd5:	85 c0                	test   %eax,%eax
+  801dd7:	0f 8e bd fd ff ff    	jle    801b9a <vprintfmt+0x40>
+  801ddd:	4c 89 ee             	mov    %r13,%rsi
+  801de0:	bf 20 00 00 00       	mov    $0x20,%edi
+  801de5:	41 ff d6             	call   *%r14
+  801de8:	41 83 ec 01          	sub    $0x1,%r12d
+  801dec:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801df0:	75 eb                	jne    801ddd <vprintfmt+0x283>
+  801df2:	e9 a3 fd ff ff       	jmp    801b9a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801df7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dfb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e03:	eb 92                	jmp    801d97 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e05:	49 63 f7             	movslq %r15d,%rsi
+  801e08:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e0c:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  801e13:	00 00 00 
+  801e16:	ff d0                	call   *%rax
+  801e18:	48 89 c2             	mov    %rax,%rdx
+  801e1b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e1e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e20:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e23:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	7e 91                	jle    801dbb <vprintfmt+0x261>
+  801e2a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e2f:	4c 89 ee             	mov    %r13,%rsi
+  801e32:	44 89 e7             	mov    %r12d,%edi
+  801e35:	41 ff d6             	call   *%r14
+  801e38:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e3c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e42:	75 eb                	jne    801e2f <vprintfmt+0x2d5>
+  801e44:	e9 72 ff ff ff       	jmp    801dbb <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e49:	0f b6 f8             	movzbl %al,%edi
+  801e4c:	4c 89 ee             	mov    %r13,%rsi
+  801e4f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e52:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e56:	49 83 c4 01          	add    $0x1,%r12
+  801e5a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e60:	84 c0                	test   %al,%al
+  801e62:	0f 84 66 ff ff ff    	je     801dce <vprintfmt+0x274>
+  801e68:	45 85 ff             	test   %r15d,%r15d
+  801e6b:	78 0a                	js     801e77 <vprintfmt+0x31d>
+  801e6d:	41 83 ef 01          	sub    $0x1,%r15d
+  801e71:	0f 88 57 ff ff ff    	js     801dce <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e77:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801e7b:	74 cc                	je     801e49 <vprintfmt+0x2ef>
+  801e7d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801e80:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801e85:	80 fa 5e             	cmp    $0x5e,%dl
+  801e88:	77 c2                	ja     801e4c <vprintfmt+0x2f2>
+  801e8a:	eb bd                	jmp    801e49 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801e8c:	40 84 f6             	test   %sil,%sil
+  801e8f:	75 26                	jne    801eb7 <vprintfmt+0x35d>
+    switch (lflag) {
+  801e91:	85 d2                	test   %edx,%edx
+  801e93:	74 59                	je     801eee <vprintfmt+0x394>
+  801e95:	83 fa 01             	cmp    $0x1,%edx
+  801e98:	74 7b                	je     801f15 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801e9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9d:	83 f8 2f             	cmp    $0x2f,%eax
+  801ea0:	0f 87 96 00 00 00    	ja     801f3c <vprintfmt+0x3e2>
+  801ea6:	89 c2                	mov    %eax,%edx
+  801ea8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eac:	83 c0 08             	add    $0x8,%eax
+  801eaf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eb2:	4c 8b 22             	mov    (%rdx),%r12
+  801eb5:	eb 17                	jmp    801ece <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801eb7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eba:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebd:	77 21                	ja     801ee0 <vprintfmt+0x386>
+  801ebf:	89 c2                	mov    %eax,%edx
+  801ec1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec5:	83 c0 08             	add    $0x8,%eax
+  801ec8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecb:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801ece:	4d 85 e4             	test   %r12,%r12
+  801ed1:	78 7a                	js     801f4d <vprintfmt+0x3f3>
+            num = i;
+  801ed3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801ed6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801edb:	e9 56 02 00 00       	jmp    802136 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ee0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ee8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eec:	eb dd                	jmp    801ecb <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801eee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef4:	77 11                	ja     801f07 <vprintfmt+0x3ad>
+  801ef6:	89 c2                	mov    %eax,%edx
+  801ef8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801efc:	83 c0 08             	add    $0x8,%eax
+  801eff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f02:	4c 63 22             	movslq (%rdx),%r12
+  801f05:	eb c7                	jmp    801ece <vprintfmt+0x374>
+  801f07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f13:	eb ed                	jmp    801f02 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f18:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1b:	77 11                	ja     801f2e <vprintfmt+0x3d4>
+  801f1d:	89 c2                	mov    %eax,%edx
+  801f1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f23:	83 c0 08             	add    $0x8,%eax
+  801f26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f29:	4c 8b 22             	mov    (%rdx),%r12
+  801f2c:	eb a0                	jmp    801ece <vprintfmt+0x374>
+  801f2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f3a:	eb ed                	jmp    801f29 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f48:	e9 65 ff ff ff       	jmp    801eb2 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f4d:	4c 89 ee             	mov    %r13,%rsi
+  801f50:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f55:	41 ff d6             	call   *%r14
+                i = -i;
+  801f58:	49 f7 dc             	neg    %r12
+  801f5b:	e9 73 ff ff ff       	jmp    801ed3 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f60:	40 84 f6             	test   %sil,%sil
+  801f63:	75 2e                	jne    801f93 <vprintfmt+0x439>
+    switch (lflag) {
+  801f65:	85 d2                	test   %edx,%edx
+  801f67:	7f 59                	jg     801fc2 <vprintfmt+0x468>
+  801f69:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f6c:	7d 7a                	jge    801fe8 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801f6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f71:	83 f8 2f             	cmp    $0x2f,%eax
+  801f74:	0f 87 aa 00 00 00    	ja     802024 <vprintfmt+0x4ca>
+  801f7a:	89 c2                	mov    %eax,%edx
+  801f7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f80:	83 c0 08             	add    $0x8,%eax
+  801f83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f86:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f89:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f8e:	e9 a3 01 00 00       	jmp    802136 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f96:	83 f8 2f             	cmp    $0x2f,%eax
+  801f99:	77 19                	ja     801fb4 <vprintfmt+0x45a>
+  801f9b:	89 c2                	mov    %eax,%edx
+  801f9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa1:	83 c0 08             	add    $0x8,%eax
+  801fa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801faa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801faf:	e9 82 01 00 00       	jmp    802136 <vprintfmt+0x5dc>
+  801fb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc0:	eb e5                	jmp    801fa7 <vprintfmt+0x44d>
+    switch (lflag) {
+  801fc2:	83 fa 01             	cmp    $0x1,%edx
+  801fc5:	75 a7                	jne    801f6e <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801fc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fca:	83 f8 2f             	cmp    $0x2f,%eax
+  801fcd:	77 47                	ja     802016 <vprintfmt+0x4bc>
+  801fcf:	89 c2                	mov    %eax,%edx
+  801fd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd5:	83 c0 08             	add    $0x8,%eax
+  801fd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fdb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801fe3:	e9 4e 01 00 00       	jmp    802136 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fe8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801feb:	83 f8 2f             	cmp    $0x2f,%eax
+  801fee:	77 18                	ja     802008 <vprintfmt+0x4ae>
+  801ff0:	89 c2                	mov    %eax,%edx
+  801ff2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ff6:	83 c0 08             	add    $0x8,%eax
+  801ff9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ffc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801ffe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802003:	e9 2e 01 00 00       	jmp    802136 <vprintfmt+0x5dc>
+  802008:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80200c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802010:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802014:	eb e6                	jmp    801ffc <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802016:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802022:	eb b7                	jmp    801fdb <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802024:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802028:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80202c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802030:	e9 51 ff ff ff       	jmp    801f86 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802035:	40 84 f6             	test   %sil,%sil
+  802038:	75 2e                	jne    802068 <vprintfmt+0x50e>
+    switch (lflag) {
+  80203a:	85 d2                	test   %edx,%edx
+  80203c:	7f 59                	jg     802097 <vprintfmt+0x53d>
+  80203e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802041:	7d 77                	jge    8020ba <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802043:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802046:	83 f8 2f             	cmp    $0x2f,%eax
+  802049:	0f 87 a4 00 00 00    	ja     8020f3 <vprintfmt+0x599>
+  80204f:	89 c2                	mov    %eax,%edx
+  802051:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802055:	83 c0 08             	add    $0x8,%eax
+  802058:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80205b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80205e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802063:	e9 ce 00 00 00       	jmp    802136 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802068:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80206b:	83 f8 2f             	cmp    $0x2f,%eax
+  80206e:	77 19                	ja     802089 <vprintfmt+0x52f>
+  802070:	89 c2                	mov    %eax,%edx
+  802072:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802076:	83 c0 08             	add    $0x8,%eax
+  802079:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80207c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80207f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802084:	e9 ad 00 00 00       	jmp    802136 <vprintfmt+0x5dc>
+  802089:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80208d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802091:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802095:	eb e5                	jmp    80207c <vprintfmt+0x522>
+    switch (lflag) {
+  802097:	83 fa 01             	cmp    $0x1,%edx
+  80209a:	75 a7                	jne    802043 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  80209c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80209f:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a2:	77 41                	ja     8020e5 <vprintfmt+0x58b>
+  8020a4:	89 c2                	mov    %eax,%edx
+  8020a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020aa:	83 c0 08             	add    $0x8,%eax
+  8020ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020b0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8020b8:	eb 7c                	jmp    802136 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8020c0:	77 15                	ja     8020d7 <vprintfmt+0x57d>
+  8020c2:	89 c2                	mov    %eax,%edx
+  8020c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020c8:	83 c0 08             	add    $0x8,%eax
+  8020cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ce:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8020d0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8020d5:	eb 5f                	jmp    802136 <vprintfmt+0x5dc>
+  8020d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e3:	eb e9                	jmp    8020ce <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8020e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020f1:	eb bd                	jmp    8020b0 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  8020f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020ff:	e9 57 ff ff ff       	jmp    80205b <vprintfmt+0x501>
+            putch('0', put_arg);
+  802104:	4c 89 ee             	mov    %r13,%rsi
+  802107:	bf 30 00 00 00       	mov    $0x30,%edi
+  80210c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80210f:	4c 89 ee             	mov    %r13,%rsi
+  802112:	bf 78 00 00 00       	mov    $0x78,%edi
+  802117:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80211a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80211d:	83 f8 2f             	cmp    $0x2f,%eax
+  802120:	77 47                	ja     802169 <vprintfmt+0x60f>
+  802122:	89 c2                	mov    %eax,%edx
+  802124:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802128:	83 c0 08             	add    $0x8,%eax
+  80212b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80212e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802131:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802136:	48 83 ec 08          	sub    $0x8,%rsp
+  80213a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80213e:	0f 94 c0             	sete   %al
+  802141:	0f b6 c0             	movzbl %al,%eax
+  802144:	50                   	push   %rax
+  802145:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80214a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80214e:	4c 89 ee             	mov    %r13,%rsi
+  802151:	4c 89 f7             	mov    %r14,%rdi
+  802154:	48 b8 4f 1a 80 00 00 	movabs $0x801a4f,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+            break;
+  802160:	48 83 c4 10          	add    $0x10,%rsp
+  802164:	e9 31 fa ff ff       	jmp    801b9a <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802169:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80216d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802171:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802175:	eb b7                	jmp    80212e <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802177:	40 84 f6             	test   %sil,%sil
+  80217a:	75 2b                	jne    8021a7 <vprintfmt+0x64d>
+    switch (lflag) {
+  80217c:	85 d2                	test   %edx,%edx
+  80217e:	7f 56                	jg     8021d6 <vprintfmt+0x67c>
+  802180:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802183:	7d 77                	jge    8021fc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802185:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802188:	83 f8 2f             	cmp    $0x2f,%eax
+  80218b:	0f 87 a7 00 00 00    	ja     802238 <vprintfmt+0x6de>
+  802191:	89 c2                	mov    %eax,%edx
+  802193:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802197:	83 c0 08             	add    $0x8,%eax
+  80219a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80219d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021a0:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021a5:	eb 8f                	jmp    802136 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ad:	77 19                	ja     8021c8 <vprintfmt+0x66e>
+  8021af:	89 c2                	mov    %eax,%edx
+  8021b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021b5:	83 c0 08             	add    $0x8,%eax
+  8021b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021be:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021c3:	e9 6e ff ff ff       	jmp    802136 <vprintfmt+0x5dc>
+  8021c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021d4:	eb e5                	jmp    8021bb <vprintfmt+0x661>
+    switch (lflag) {
+  8021d6:	83 fa 01             	cmp    $0x1,%edx
+  8021d9:	75 aa                	jne    802185 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8021db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021de:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e1:	77 47                	ja     80222a <vprintfmt+0x6d0>
+  8021e3:	89 c2                	mov    %eax,%edx
+  8021e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021e9:	83 c0 08             	add    $0x8,%eax
+  8021ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021ef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8021f7:	e9 3a ff ff ff       	jmp    802136 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021ff:	83 f8 2f             	cmp    $0x2f,%eax
+  802202:	77 18                	ja     80221c <vprintfmt+0x6c2>
+  802204:	89 c2                	mov    %eax,%edx
+  802206:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220a:	83 c0 08             	add    $0x8,%eax
+  80220d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802210:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802212:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802217:	e9 1a ff ff ff       	jmp    802136 <vprintfmt+0x5dc>
+  80221c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802220:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802224:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802228:	eb e6                	jmp    802210 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80222a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802232:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802236:	eb b7                	jmp    8021ef <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802238:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80223c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802240:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802244:	e9 54 ff ff ff       	jmp    80219d <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802249:	4c 89 ee             	mov    %r13,%rsi
+  80224c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802251:	41 ff d6             	call   *%r14
+            break;
+  802254:	e9 41 f9 ff ff       	jmp    801b9a <vprintfmt+0x40>
+            putch('%', put_arg);
+  802259:	4c 89 ee             	mov    %r13,%rsi
+  80225c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802261:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802264:	48 83 eb 01          	sub    $0x1,%rbx
+  802268:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80226c:	75 f6                	jne    802264 <vprintfmt+0x70a>
+  80226e:	e9 27 f9 ff ff       	jmp    801b9a <vprintfmt+0x40>
+
+0000000000802273 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+  802277:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80227b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80227f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802284:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802288:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80228f:	48 85 ff             	test   %rdi,%rdi
+  802292:	74 2b                	je     8022bf <vsnprintf+0x4c>
+  802294:	48 85 f6             	test   %rsi,%rsi
+  802297:	74 26                	je     8022bf <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802299:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80229d:	48 bf 05 1b 80 00 00 	movabs $0x801b05,%rdi
+  8022a4:	00 00 00 
+  8022a7:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8022b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b7:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8022ba:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8022bd:	c9                   	leave
+  8022be:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8022bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022c4:	eb f7                	jmp    8022bd <vsnprintf+0x4a>
+
+00000000008022c6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8022c6:	55                   	push   %rbp
+  8022c7:	48 89 e5             	mov    %rsp,%rbp
+  8022ca:	48 83 ec 50          	sub    $0x50,%rsp
+  8022ce:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022d2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8022d6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8022da:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022ed:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8022f1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022f5:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  8022fc:	00 00 00 
+  8022ff:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+0000000000802303 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802303:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802306:	74 10                	je     802318 <strlen+0x15>
+    size_t n = 0;
+  802308:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80230d:	48 83 c0 01          	add    $0x1,%rax
+  802311:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802315:	75 f6                	jne    80230d <strlen+0xa>
+  802317:	c3                   	ret
+    size_t n = 0;
+  802318:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80231d:	c3                   	ret
+
+000000000080231e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80231e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802321:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802326:	48 85 f6             	test   %rsi,%rsi
+  802329:	74 11                	je     80233c <strnlen+0x1e>
+  80232b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80232f:	74 0c                	je     80233d <strnlen+0x1f>
+  802331:	48 83 c2 01          	add    $0x1,%rdx
+  802335:	48 39 d0             	cmp    %rdx,%rax
+  802338:	75 f1                	jne    80232b <strnlen+0xd>
+  80233a:	eb 04                	jmp    802340 <strnlen+0x22>
+  80233c:	c3                   	ret
+  80233d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802340:	c3                   	ret
+
+0000000000802341 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802341:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802344:	ba 00 00 00 00       	mov    $0x0,%edx
+  802349:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80234d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802350:	48 83 c2 01          	add    $0x1,%rdx
+  802354:	84 c9                	test   %cl,%cl
+  802356:	75 f1                	jne    802349 <strcpy+0x8>
+        ;
+    return res;
+}
+  802358:	c3                   	ret
+
+0000000000802359 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802359:	55                   	push   %rbp
+  80235a:	48 89 e5             	mov    %rsp,%rbp
+  80235d:	41 54                	push   %r12
+  80235f:	53                   	push   %rbx
+  802360:	48 89 fb             	mov    %rdi,%rbx
+  802363:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802366:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802372:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802376:	4c 89 e6             	mov    %r12,%rsi
+  802379:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+    return dst;
+}
+  802385:	48 89 d8             	mov    %rbx,%rax
+  802388:	5b                   	pop    %rbx
+  802389:	41 5c                	pop    %r12
+  80238b:	5d                   	pop    %rbp
+  80238c:	c3                   	ret
+
+000000000080238d <toupper>:
+
+int
+toupper(int ch) {
+  80238d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80238f:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802392:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802395:	83 f9 1a             	cmp    $0x1a,%ecx
+  802398:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80239b:	c3                   	ret
+
+000000000080239c <tolower>:
+
+int
+tolower(int ch) {
+  80239c:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80239e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8023a1:	8d 57 20             	lea    0x20(%rdi),%edx
+  8023a4:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023a7:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023aa:	c3                   	ret
+
+00000000008023ab <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8023ab:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8023ae:	48 85 d2             	test   %rdx,%rdx
+  8023b1:	74 1f                	je     8023d2 <strncpy+0x27>
+  8023b3:	48 01 fa             	add    %rdi,%rdx
+  8023b6:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8023b9:	48 83 c1 01          	add    $0x1,%rcx
+  8023bd:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8023c1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8023c5:	41 80 f8 01          	cmp    $0x1,%r8b
+  8023c9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8023cd:	48 39 ca             	cmp    %rcx,%rdx
+  8023d0:	75 e7                	jne    8023b9 <strncpy+0xe>
+    }
+    return ret;
+}
+  8023d2:	c3                   	ret
+
+00000000008023d3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8023d3:	48 89 f8             	mov    %rdi,%rax
+  8023d6:	48 85 d2             	test   %rdx,%rdx
+  8023d9:	74 24                	je     8023ff <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8023db:	48 83 ea 01          	sub    $0x1,%rdx
+  8023df:	74 1b                	je     8023fc <strlcpy+0x29>
+  8023e1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8023e5:	0f b6 16             	movzbl (%rsi),%edx
+  8023e8:	84 d2                	test   %dl,%dl
+  8023ea:	74 10                	je     8023fc <strlcpy+0x29>
+            *dst++ = *src++;
+  8023ec:	48 83 c6 01          	add    $0x1,%rsi
+  8023f0:	48 83 c0 01          	add    $0x1,%rax
+  8023f4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8023f7:	48 39 c8             	cmp    %rcx,%rax
+  8023fa:	75 e9                	jne    8023e5 <strlcpy+0x12>
+        *dst = '\0';
+  8023fc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8023ff:	48 29 f8             	sub    %rdi,%rax
+}
+  802402:	c3                   	ret
+
+0000000000802403 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802403:	0f b6 07             	movzbl (%rdi),%eax
+  802406:	84 c0                	test   %al,%al
+  802408:	74 13                	je     80241d <strcmp+0x1a>
+  80240a:	38 06                	cmp    %al,(%rsi)
+  80240c:	75 0f                	jne    80241d <strcmp+0x1a>
+  80240e:	48 83 c7 01          	add    $0x1,%rdi
+  802412:	48 83 c6 01          	add    $0x1,%rsi
+  802416:	0f b6 07             	movzbl (%rdi),%eax
+  802419:	84 c0                	test   %al,%al
+  80241b:	75 ed                	jne    80240a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80241d:	0f b6 c0             	movzbl %al,%eax
+  802420:	0f b6 16             	movzbl (%rsi),%edx
+  802423:	29 d0                	sub    %edx,%eax
+}
+  802425:	c3                   	ret
+
+0000000000802426 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802426:	48 85 d2             	test   %rdx,%rdx
+  802429:	74 1f                	je     80244a <strncmp+0x24>
+  80242b:	0f b6 07             	movzbl (%rdi),%eax
+  80242e:	84 c0                	test   %al,%al
+  802430:	74 1e                	je     802450 <strncmp+0x2a>
+  802432:	3a 06                	cmp    (%rsi),%al
+  802434:	75 1a                	jne    802450 <strncmp+0x2a>
+  802436:	48 83 c7 01          	add    $0x1,%rdi
+  80243a:	48 83 c6 01          	add    $0x1,%rsi
+  80243e:	48 83 ea 01          	sub    $0x1,%rdx
+  802442:	75 e7                	jne    80242b <strncmp+0x5>
+
+    if (!n) return 0;
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+  802449:	c3                   	ret
+  80244a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244f:	c3                   	ret
+  802450:	48 85 d2             	test   %rdx,%rdx
+  802453:	74 09                	je     80245e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802455:	0f b6 07             	movzbl (%rdi),%eax
+  802458:	0f b6 16             	movzbl (%rsi),%edx
+  80245b:	29 d0                	sub    %edx,%eax
+  80245d:	c3                   	ret
+    if (!n) return 0;
+  80245e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802463:	c3                   	ret
+
+0000000000802464 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802464:	0f b6 17             	movzbl (%rdi),%edx
+  802467:	84 d2                	test   %dl,%dl
+  802469:	74 18                	je     802483 <strchr+0x1f>
+        if (*str == c) {
+  80246b:	0f be d2             	movsbl %dl,%edx
+  80246e:	39 f2                	cmp    %esi,%edx
+  802470:	74 17                	je     802489 <strchr+0x25>
+    for (; *str; str++) {
+  802472:	48 83 c7 01          	add    $0x1,%rdi
+  802476:	0f b6 17             	movzbl (%rdi),%edx
+  802479:	84 d2                	test   %dl,%dl
+  80247b:	75 ee                	jne    80246b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80247d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802482:	c3                   	ret
+  802483:	b8 00 00 00 00       	mov    $0x0,%eax
+  802488:	c3                   	ret
+  802489:	48 89 f8             	mov    %rdi,%rax
+}
+  80248c:	c3                   	ret
+
+000000000080248d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80248d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802490:	0f b6 17             	movzbl (%rdi),%edx
+  802493:	84 d2                	test   %dl,%dl
+  802495:	74 13                	je     8024aa <strfind+0x1d>
+  802497:	0f be d2             	movsbl %dl,%edx
+  80249a:	39 f2                	cmp    %esi,%edx
+  80249c:	74 0b                	je     8024a9 <strfind+0x1c>
+  80249e:	48 83 c0 01          	add    $0x1,%rax
+  8024a2:	0f b6 10             	movzbl (%rax),%edx
+  8024a5:	84 d2                	test   %dl,%dl
+  8024a7:	75 ee                	jne    802497 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8024a9:	c3                   	ret
+  8024aa:	c3                   	ret
+
+00000000008024ab <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024ab:	48 39 f7             	cmp    %rsi,%rdi
+  8024ae:	74 65                	je     802515 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8024b0:	55                   	push   %rbp
+  8024b1:	48 89 e5             	mov    %rsp,%rbp
+  8024b4:	41 57                	push   %r15
+  8024b6:	41 56                	push   %r14
+  8024b8:	41 55                	push   %r13
+  8024ba:	41 54                	push   %r12
+  8024bc:	53                   	push   %rbx
+  8024bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8024c1:	48 89 fb             	mov    %rdi,%rbx
+  8024c4:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8024c7:	49 bf 9c 23 80 00 00 	movabs $0x80239c,%r15
+  8024ce:	00 00 00 
+  8024d1:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8024d5:	41 0f b6 fd          	movzbl %r13b,%edi
+  8024d9:	41 ff d7             	call   *%r15
+  8024dc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8024df:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8024e4:	41 0f b6 fe          	movzbl %r14b,%edi
+  8024e8:	41 ff d7             	call   *%r15
+  8024eb:	89 c2                	mov    %eax,%edx
+  8024ed:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024f0:	29 d0                	sub    %edx,%eax
+  8024f2:	75 12                	jne    802506 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8024f4:	48 83 c3 01          	add    $0x1,%rbx
+  8024f8:	45 84 ed             	test   %r13b,%r13b
+  8024fb:	74 09                	je     802506 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8024fd:	49 83 c4 01          	add    $0x1,%r12
+  802501:	45 84 f6             	test   %r14b,%r14b
+  802504:	75 cb                	jne    8024d1 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802506:	48 83 c4 18          	add    $0x18,%rsp
+  80250a:	5b                   	pop    %rbx
+  80250b:	41 5c                	pop    %r12
+  80250d:	41 5d                	pop    %r13
+  80250f:	41 5e                	pop    %r14
+  802511:	41 5f                	pop    %r15
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+    if (p1 == p2) return 0;
+  802515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80251a:	c3                   	ret
+
+000000000080251b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80251b:	48 39 f7             	cmp    %rsi,%rdi
+  80251e:	74 7d                	je     80259d <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802520:	55                   	push   %rbp
+  802521:	48 89 e5             	mov    %rsp,%rbp
+  802524:	41 57                	push   %r15
+  802526:	41 56                	push   %r14
+  802528:	41 55                	push   %r13
+  80252a:	41 54                	push   %r12
+  80252c:	53                   	push   %rbx
+  80252d:	48 83 ec 18          	sub    $0x18,%rsp
+  802531:	48 89 fb             	mov    %rdi,%rbx
+  802534:	49 89 f4             	mov    %rsi,%r12
+  802537:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80253b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80253f:	49 bf 9c 23 80 00 00 	movabs $0x80239c,%r15
+  802546:	00 00 00 
+    while (n--) {
+  802549:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80254d:	48 39 c3             	cmp    %rax,%rbx
+  802550:	74 37                	je     802589 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802552:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802556:	41 0f b6 fd          	movzbl %r13b,%edi
+  80255a:	41 ff d7             	call   *%r15
+  80255d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802560:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802565:	41 0f b6 fe          	movzbl %r14b,%edi
+  802569:	41 ff d7             	call   *%r15
+  80256c:	89 c2                	mov    %eax,%edx
+  80256e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802571:	29 d0                	sub    %edx,%eax
+  802573:	75 19                	jne    80258e <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802575:	48 83 c3 01          	add    $0x1,%rbx
+  802579:	45 84 ed             	test   %r13b,%r13b
+  80257c:	74 10                	je     80258e <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80257e:	49 83 c4 01          	add    $0x1,%r12
+  802582:	45 84 f6             	test   %r14b,%r14b
+  802585:	75 c2                	jne    802549 <strncasecmp+0x2e>
+  802587:	eb 05                	jmp    80258e <strncasecmp+0x73>
+  802589:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80258e:	48 83 c4 18          	add    $0x18,%rsp
+  802592:	5b                   	pop    %rbx
+  802593:	41 5c                	pop    %r12
+  802595:	41 5d                	pop    %r13
+  802597:	41 5e                	pop    %r14
+  802599:	41 5f                	pop    %r15
+  80259b:	5d                   	pop    %rbp
+  80259c:	c3                   	ret
+    if (p1 == p2) return 0;
+  80259d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a2:	c3                   	ret
+
+00000000008025a3 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8025a3:	83 e7 df             	and    $0xffffffdf,%edi
+  8025a6:	83 ef 41             	sub    $0x41,%edi
+  8025a9:	83 ff 19             	cmp    $0x19,%edi
+  8025ac:	0f 96 c0             	setbe  %al
+}
+  8025af:	c3                   	ret
+
+00000000008025b0 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8025b0:	83 ff 20             	cmp    $0x20,%edi
+  8025b3:	0f 94 c0             	sete   %al
+  8025b6:	83 ff 09             	cmp    $0x9,%edi
+  8025b9:	0f 94 c2             	sete   %dl
+  8025bc:	09 d0                	or     %edx,%eax
+}
+  8025be:	c3                   	ret
+
+00000000008025bf <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8025bf:	55                   	push   %rbp
+  8025c0:	48 89 e5             	mov    %rsp,%rbp
+  8025c3:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8025c5:	48 bf ff 64 80 00 00 	movabs $0x8064ff,%rdi
+  8025cc:	00 00 00 
+  8025cf:	48 b8 64 24 80 00 00 	movabs $0x802464,%rax
+  8025d6:	00 00 00 
+  8025d9:	ff d0                	call   *%rax
+  8025db:	48 85 c0             	test   %rax,%rax
+  8025de:	0f 95 c0             	setne  %al
+}
+  8025e1:	5d                   	pop    %rbp
+  8025e2:	c3                   	ret
+
+00000000008025e3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8025e3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8025e6:	48 89 f8             	mov    %rdi,%rax
+  8025e9:	48 f7 d8             	neg    %rax
+  8025ec:	83 e0 07             	and    $0x7,%eax
+  8025ef:	49 89 d1             	mov    %rdx,%r9
+  8025f2:	49 29 c1             	sub    %rax,%r9
+  8025f5:	78 36                	js     80262d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8025f7:	40 0f b6 c6          	movzbl %sil,%eax
+  8025fb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802602:	01 01 01 
+  802605:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802609:	40 f6 c7 07          	test   $0x7,%dil
+  80260d:	75 38                	jne    802647 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80260f:	4c 89 c9             	mov    %r9,%rcx
+  802612:	48 c1 f9 03          	sar    $0x3,%rcx
+  802616:	74 0c                	je     802624 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802618:	fc                   	cld
+  802619:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80261c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802620:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802624:	4d 85 c9             	test   %r9,%r9
+  802627:	75 45                	jne    80266e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802629:	4c 89 c0             	mov    %r8,%rax
+  80262c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80262d:	48 85 d2             	test   %rdx,%rdx
+  802630:	74 f7                	je     802629 <memset+0x46>
+  802632:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802635:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802638:	48 83 c0 01          	add    $0x1,%rax
+  80263c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802640:	48 39 c2             	cmp    %rax,%rdx
+  802643:	75 f3                	jne    802638 <memset+0x55>
+  802645:	eb e2                	jmp    802629 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802647:	40 f6 c7 01          	test   $0x1,%dil
+  80264b:	74 06                	je     802653 <memset+0x70>
+  80264d:	88 07                	mov    %al,(%rdi)
+  80264f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802653:	40 f6 c7 02          	test   $0x2,%dil
+  802657:	74 07                	je     802660 <memset+0x7d>
+  802659:	66 89 07             	mov    %ax,(%rdi)
+  80265c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802660:	40 f6 c7 04          	test   $0x4,%dil
+  802664:	74 a9                	je     80260f <memset+0x2c>
+  802666:	89 07                	mov    %eax,(%rdi)
+  802668:	48 83 c7 04          	add    $0x4,%rdi
+  80266c:	eb a1                	jmp    80260f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80266e:	41 f6 c1 04          	test   $0x4,%r9b
+  802672:	74 06                	je     80267a <memset+0x97>
+  802674:	89 07                	mov    %eax,(%rdi)
+  802676:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80267a:	41 f6 c1 02          	test   $0x2,%r9b
+  80267e:	74 07                	je     802687 <memset+0xa4>
+  802680:	66 89 07             	mov    %ax,(%rdi)
+  802683:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802687:	41 f6 c1 01          	test   $0x1,%r9b
+  80268b:	74 9c                	je     802629 <memset+0x46>
+  80268d:	88 07                	mov    %al,(%rdi)
+  80268f:	eb 98                	jmp    802629 <memset+0x46>
+
+0000000000802691 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802691:	48 89 f8             	mov    %rdi,%rax
+  802694:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802697:	48 39 fe             	cmp    %rdi,%rsi
+  80269a:	73 3b                	jae    8026d7 <memmove+0x46>
+  80269c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8026a0:	48 39 d7             	cmp    %rdx,%rdi
+  8026a3:	73 32                	jae    8026d7 <memmove+0x46>
+        s += n;
+        d += n;
+  8026a5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026a9:	48 89 d6             	mov    %rdx,%rsi
+  8026ac:	48 09 fe             	or     %rdi,%rsi
+  8026af:	48 09 ce             	or     %rcx,%rsi
+  8026b2:	40 f6 c6 07          	test   $0x7,%sil
+  8026b6:	75 12                	jne    8026ca <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8026b8:	48 83 ef 08          	sub    $0x8,%rdi
+  8026bc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8026c0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026c4:	fd                   	std
+  8026c5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8026c8:	fc                   	cld
+  8026c9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8026ca:	48 83 ef 01          	sub    $0x1,%rdi
+  8026ce:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8026d2:	fd                   	std
+  8026d3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8026d5:	eb f1                	jmp    8026c8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026d7:	48 89 f2             	mov    %rsi,%rdx
+  8026da:	48 09 c2             	or     %rax,%rdx
+  8026dd:	48 09 ca             	or     %rcx,%rdx
+  8026e0:	f6 c2 07             	test   $0x7,%dl
+  8026e3:	75 0c                	jne    8026f1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8026e5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026e9:	48 89 c7             	mov    %rax,%rdi
+  8026ec:	fc                   	cld
+  8026ed:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8026f0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8026f1:	48 89 c7             	mov    %rax,%rdi
+  8026f4:	fc                   	cld
+  8026f5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8026f7:	c3                   	ret
+
+00000000008026f8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8026f8:	55                   	push   %rbp
+  8026f9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8026fc:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+}
+  802708:	5d                   	pop    %rbp
+  802709:	c3                   	ret
+
+000000000080270a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80270a:	55                   	push   %rbp
+  80270b:	48 89 e5             	mov    %rsp,%rbp
+  80270e:	41 57                	push   %r15
+  802710:	41 56                	push   %r14
+  802712:	41 55                	push   %r13
+  802714:	41 54                	push   %r12
+  802716:	53                   	push   %rbx
+  802717:	48 83 ec 08          	sub    $0x8,%rsp
+  80271b:	49 89 fe             	mov    %rdi,%r14
+  80271e:	49 89 f7             	mov    %rsi,%r15
+  802721:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802724:	48 89 f7             	mov    %rsi,%rdi
+  802727:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  80272e:	00 00 00 
+  802731:	ff d0                	call   *%rax
+  802733:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802736:	48 89 de             	mov    %rbx,%rsi
+  802739:	4c 89 f7             	mov    %r14,%rdi
+  80273c:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80274b:	48 39 c3             	cmp    %rax,%rbx
+  80274e:	74 36                	je     802786 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802750:	48 89 d8             	mov    %rbx,%rax
+  802753:	4c 29 e8             	sub    %r13,%rax
+  802756:	49 39 c4             	cmp    %rax,%r12
+  802759:	73 31                	jae    80278c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80275b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802760:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802764:	4c 89 fe             	mov    %r15,%rsi
+  802767:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  80276e:	00 00 00 
+  802771:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802773:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802777:	48 83 c4 08          	add    $0x8,%rsp
+  80277b:	5b                   	pop    %rbx
+  80277c:	41 5c                	pop    %r12
+  80277e:	41 5d                	pop    %r13
+  802780:	41 5e                	pop    %r14
+  802782:	41 5f                	pop    %r15
+  802784:	5d                   	pop    %rbp
+  802785:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802786:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80278a:	eb eb                	jmp    802777 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80278c:	48 83 eb 01          	sub    $0x1,%rbx
+  802790:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802794:	48 89 da             	mov    %rbx,%rdx
+  802797:	4c 89 fe             	mov    %r15,%rsi
+  80279a:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8027a6:	49 01 de             	add    %rbx,%r14
+  8027a9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8027ae:	eb c3                	jmp    802773 <strlcat+0x69>
+
+00000000008027b0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8027b0:	48 85 d2             	test   %rdx,%rdx
+  8027b3:	74 2d                	je     8027e2 <memcmp+0x32>
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8027ba:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8027be:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8027c3:	44 38 c1             	cmp    %r8b,%cl
+  8027c6:	75 0f                	jne    8027d7 <memcmp+0x27>
+    while (n-- > 0) {
+  8027c8:	48 83 c0 01          	add    $0x1,%rax
+  8027cc:	48 39 c2             	cmp    %rax,%rdx
+  8027cf:	75 e9                	jne    8027ba <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8027d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8027d7:	0f b6 c1             	movzbl %cl,%eax
+  8027da:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8027de:	44 29 c0             	sub    %r8d,%eax
+  8027e1:	c3                   	ret
+    return 0;
+  8027e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e7:	c3                   	ret
+
+00000000008027e8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8027e8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8027ec:	48 39 c7             	cmp    %rax,%rdi
+  8027ef:	73 0f                	jae    802800 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8027f1:	40 38 37             	cmp    %sil,(%rdi)
+  8027f4:	74 0e                	je     802804 <memfind+0x1c>
+    for (; src < end; src++) {
+  8027f6:	48 83 c7 01          	add    $0x1,%rdi
+  8027fa:	48 39 f8             	cmp    %rdi,%rax
+  8027fd:	75 f2                	jne    8027f1 <memfind+0x9>
+  8027ff:	c3                   	ret
+  802800:	48 89 f8             	mov    %rdi,%rax
+  802803:	c3                   	ret
+  802804:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802807:	c3                   	ret
+
+0000000000802808 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802808:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80280b:	0f b6 37             	movzbl (%rdi),%esi
+  80280e:	40 80 fe 20          	cmp    $0x20,%sil
+  802812:	74 06                	je     80281a <strtol+0x12>
+  802814:	40 80 fe 09          	cmp    $0x9,%sil
+  802818:	75 13                	jne    80282d <strtol+0x25>
+  80281a:	48 83 c7 01          	add    $0x1,%rdi
+  80281e:	0f b6 37             	movzbl (%rdi),%esi
+  802821:	40 80 fe 20          	cmp    $0x20,%sil
+  802825:	74 f3                	je     80281a <strtol+0x12>
+  802827:	40 80 fe 09          	cmp    $0x9,%sil
+  80282b:	74 ed                	je     80281a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80282d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802830:	83 e0 fd             	and    $0xfffffffd,%eax
+  802833:	3c 01                	cmp    $0x1,%al
+  802835:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802839:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80283f:	75 0f                	jne    802850 <strtol+0x48>
+  802841:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802844:	74 14                	je     80285a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802846:	85 d2                	test   %edx,%edx
+  802848:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80284d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802850:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802855:	4c 63 ca             	movslq %edx,%r9
+  802858:	eb 36                	jmp    802890 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80285a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80285e:	74 0f                	je     80286f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802860:	85 d2                	test   %edx,%edx
+  802862:	75 ec                	jne    802850 <strtol+0x48>
+        s++;
+  802864:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802868:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80286d:	eb e1                	jmp    802850 <strtol+0x48>
+        s += 2;
+  80286f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802873:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802878:	eb d6                	jmp    802850 <strtol+0x48>
+            dig -= '0';
+  80287a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80287d:	44 0f b6 c1          	movzbl %cl,%r8d
+  802881:	41 39 d0             	cmp    %edx,%r8d
+  802884:	7d 21                	jge    8028a7 <strtol+0x9f>
+        val = val * base + dig;
+  802886:	49 0f af c1          	imul   %r9,%rax
+  80288a:	0f b6 c9             	movzbl %cl,%ecx
+  80288d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802890:	48 83 c7 01          	add    $0x1,%rdi
+  802894:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802898:	80 f9 39             	cmp    $0x39,%cl
+  80289b:	76 dd                	jbe    80287a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80289d:	80 f9 7b             	cmp    $0x7b,%cl
+  8028a0:	77 05                	ja     8028a7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8028a2:	83 e9 57             	sub    $0x57,%ecx
+  8028a5:	eb d6                	jmp    80287d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8028a7:	4d 85 d2             	test   %r10,%r10
+  8028aa:	74 03                	je     8028af <strtol+0xa7>
+  8028ac:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8028af:	48 89 c2             	mov    %rax,%rdx
+  8028b2:	48 f7 da             	neg    %rdx
+  8028b5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8028b9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8028bd:	c3                   	ret
+
+00000000008028be <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8028be:	55                   	push   %rbp
+  8028bf:	48 89 e5             	mov    %rsp,%rbp
+  8028c2:	53                   	push   %rbx
+  8028c3:	48 89 fa             	mov    %rdi,%rdx
+  8028c6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028e9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8028eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ef:	c9                   	leave
+  8028f0:	c3                   	ret
+
+00000000008028f1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8028f1:	55                   	push   %rbp
+  8028f2:	48 89 e5             	mov    %rsp,%rbp
+  8028f5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028f6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802900:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802905:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80290f:	be 00 00 00 00       	mov    $0x0,%esi
+  802914:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802920:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802922:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+0000000000802928 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	53                   	push   %rbx
+  80292d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802930:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802935:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80293a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80293f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+  802949:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80294f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802955:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802957:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80295b:	c9                   	leave
+  80295c:	c3                   	ret
+
+000000000080295d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80295d:	55                   	push   %rbp
+  80295e:	48 89 e5             	mov    %rsp,%rbp
+  802961:	53                   	push   %rbx
+  802962:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802966:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802969:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80296e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802973:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802978:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297d:	be 00 00 00 00       	mov    $0x0,%esi
+  802982:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802988:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802990:	48 85 c0             	test   %rax,%rax
+  802993:	7f 06                	jg     80299b <sys_env_destroy+0x3e>
+}
+  802995:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80299b:	49 89 c0             	mov    %rax,%r8
+  80299e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8029a3:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  8029aa:	00 00 00 
+  8029ad:	be 27 00 00 00       	mov    $0x27,%esi
+  8029b2:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  8029b9:	00 00 00 
+  8029bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c1:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  8029c8:	00 00 00 
+  8029cb:	41 ff d1             	call   *%r9
+
+00000000008029ce <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8029ce:	55                   	push   %rbp
+  8029cf:	48 89 e5             	mov    %rsp,%rbp
+  8029d2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029fd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a03:	c9                   	leave
+  802a04:	c3                   	ret
+
+0000000000802a05 <sys_yield>:
+
+void
+sys_yield(void) {
+  802a05:	55                   	push   %rbp
+  802a06:	48 89 e5             	mov    %rsp,%rbp
+  802a09:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a23:	be 00 00 00 00       	mov    $0x0,%esi
+  802a28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a34:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3a:	c9                   	leave
+  802a3b:	c3                   	ret
+
+0000000000802a3c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a3c:	55                   	push   %rbp
+  802a3d:	48 89 e5             	mov    %rsp,%rbp
+  802a40:	53                   	push   %rbx
+  802a41:	48 89 fa             	mov    %rdi,%rdx
+  802a44:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a47:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a4c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a53:	00 00 00 
+  802a56:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a60:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a66:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802a6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a72:	c9                   	leave
+  802a73:	c3                   	ret
+
+0000000000802a74 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802a74:	55                   	push   %rbp
+  802a75:	48 89 e5             	mov    %rsp,%rbp
+  802a78:	53                   	push   %rbx
+  802a79:	49 89 f8             	mov    %rdi,%r8
+  802a7c:	48 89 d3             	mov    %rdx,%rbx
+  802a7f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802a82:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a87:	4c 89 c2             	mov    %r8,%rdx
+  802a8a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a9e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802aa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa4:	c9                   	leave
+  802aa5:	c3                   	ret
+
+0000000000802aa6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802aa6:	55                   	push   %rbp
+  802aa7:	48 89 e5             	mov    %rsp,%rbp
+  802aaa:	53                   	push   %rbx
+  802aab:	48 83 ec 08          	sub    $0x8,%rsp
+  802aaf:	89 f8                	mov    %edi,%eax
+  802ab1:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802ab4:	48 63 f9             	movslq %ecx,%rdi
+  802ab7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aba:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802abf:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802acd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad5:	48 85 c0             	test   %rax,%rax
+  802ad8:	7f 06                	jg     802ae0 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ae0:	49 89 c0             	mov    %rax,%r8
+  802ae3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802ae8:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802aef:	00 00 00 
+  802af2:	be 27 00 00 00       	mov    $0x27,%esi
+  802af7:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802afe:	00 00 00 
+  802b01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b06:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802b0d:	00 00 00 
+  802b10:	41 ff d1             	call   *%r9
+
+0000000000802b13 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b13:	55                   	push   %rbp
+  802b14:	48 89 e5             	mov    %rsp,%rbp
+  802b17:	53                   	push   %rbx
+  802b18:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1c:	89 f8                	mov    %edi,%eax
+  802b1e:	49 89 f2             	mov    %rsi,%r10
+  802b21:	48 89 cf             	mov    %rcx,%rdi
+  802b24:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b27:	48 63 da             	movslq %edx,%rbx
+  802b2a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b2d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b32:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b35:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b3e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b40:	48 85 c0             	test   %rax,%rax
+  802b43:	7f 06                	jg     802b4b <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b4b:	49 89 c0             	mov    %rax,%r8
+  802b4e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b53:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802b5a:	00 00 00 
+  802b5d:	be 27 00 00 00       	mov    $0x27,%esi
+  802b62:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802b69:	00 00 00 
+  802b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b71:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802b78:	00 00 00 
+  802b7b:	41 ff d1             	call   *%r9
+
+0000000000802b7e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+  802b82:	53                   	push   %rbx
+  802b83:	48 83 ec 08          	sub    $0x8,%rsp
+  802b87:	48 89 f1             	mov    %rsi,%rcx
+  802b8a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802b8d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b90:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b95:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b9a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ba5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bad:	48 85 c0             	test   %rax,%rax
+  802bb0:	7f 06                	jg     802bb8 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802bb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb6:	c9                   	leave
+  802bb7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bb8:	49 89 c0             	mov    %rax,%r8
+  802bbb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802bc0:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802bc7:	00 00 00 
+  802bca:	be 27 00 00 00       	mov    $0x27,%esi
+  802bcf:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802bd6:	00 00 00 
+  802bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bde:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802be5:	00 00 00 
+  802be8:	41 ff d1             	call   *%r9
+
+0000000000802beb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802beb:	55                   	push   %rbp
+  802bec:	48 89 e5             	mov    %rsp,%rbp
+  802bef:	53                   	push   %rbx
+  802bf0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802bf4:	48 63 ce             	movslq %esi,%rcx
+  802bf7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bfa:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c04:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c09:	be 00 00 00 00       	mov    $0x0,%esi
+  802c0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c1a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c1c:	48 85 c0             	test   %rax,%rax
+  802c1f:	7f 06                	jg     802c27 <sys_env_set_status+0x3c>
+}
+  802c21:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c25:	c9                   	leave
+  802c26:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c27:	49 89 c0             	mov    %rax,%r8
+  802c2a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c2f:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802c36:	00 00 00 
+  802c39:	be 27 00 00 00       	mov    $0x27,%esi
+  802c3e:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802c45:	00 00 00 
+  802c48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4d:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802c54:	00 00 00 
+  802c57:	41 ff d1             	call   *%r9
+
+0000000000802c5a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c5a:	55                   	push   %rbp
+  802c5b:	48 89 e5             	mov    %rsp,%rbp
+  802c5e:	53                   	push   %rbx
+  802c5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c63:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802c66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c69:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c78:	be 00 00 00 00       	mov    $0x0,%esi
+  802c7d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c83:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c89:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c8b:	48 85 c0             	test   %rax,%rax
+  802c8e:	7f 06                	jg     802c96 <sys_env_set_trapframe+0x3c>
+}
+  802c90:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c94:	c9                   	leave
+  802c95:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c96:	49 89 c0             	mov    %rax,%r8
+  802c99:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802c9e:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802ca5:	00 00 00 
+  802ca8:	be 27 00 00 00       	mov    $0x27,%esi
+  802cad:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802cb4:	00 00 00 
+  802cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbc:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802cc3:	00 00 00 
+  802cc6:	41 ff d1             	call   *%r9
+
+0000000000802cc9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802cc9:	55                   	push   %rbp
+  802cca:	48 89 e5             	mov    %rsp,%rbp
+  802ccd:	53                   	push   %rbx
+  802cce:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802cd5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cd8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ce7:	be 00 00 00 00       	mov    $0x0,%esi
+  802cec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cf2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cf8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cfa:	48 85 c0             	test   %rax,%rax
+  802cfd:	7f 06                	jg     802d05 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802cff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d03:	c9                   	leave
+  802d04:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d05:	49 89 c0             	mov    %rax,%r8
+  802d08:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d0d:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802d14:	00 00 00 
+  802d17:	be 27 00 00 00       	mov    $0x27,%esi
+  802d1c:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802d23:	00 00 00 
+  802d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2b:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802d32:	00 00 00 
+  802d35:	41 ff d1             	call   *%r9
+
+0000000000802d38 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d38:	55                   	push   %rbp
+  802d39:	48 89 e5             	mov    %rsp,%rbp
+  802d3c:	53                   	push   %rbx
+  802d3d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d41:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d45:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d48:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d52:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d57:	be 00 00 00 00       	mov    $0x0,%esi
+  802d5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d68:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d6a:	48 85 c0             	test   %rax,%rax
+  802d6d:	7f 06                	jg     802d75 <sys_env_set_reclaim+0x3d>
+}
+  802d6f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d73:	c9                   	leave
+  802d74:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d75:	49 89 c0             	mov    %rax,%r8
+  802d78:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802d7d:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802d84:	00 00 00 
+  802d87:	be 27 00 00 00       	mov    $0x27,%esi
+  802d8c:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802d93:	00 00 00 
+  802d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9b:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802da2:	00 00 00 
+  802da5:	41 ff d1             	call   *%r9
+
+0000000000802da8 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802da8:	55                   	push   %rbp
+  802da9:	48 89 e5             	mov    %rsp,%rbp
+  802dac:	53                   	push   %rbx
+  802dad:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802db1:	48 63 ce             	movslq %esi,%rcx
+  802db4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802db7:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802dcb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dd7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dd9:	48 85 c0             	test   %rax,%rax
+  802ddc:	7f 06                	jg     802de4 <sys_env_set_nice+0x3c>
+}
+  802dde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de2:	c9                   	leave
+  802de3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802de4:	49 89 c0             	mov    %rax,%r8
+  802de7:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802dec:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802df3:	00 00 00 
+  802df6:	be 27 00 00 00       	mov    $0x27,%esi
+  802dfb:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802e02:	00 00 00 
+  802e05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0a:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802e11:	00 00 00 
+  802e14:	41 ff d1             	call   *%r9
+
+0000000000802e17 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e17:	55                   	push   %rbp
+  802e18:	48 89 e5             	mov    %rsp,%rbp
+  802e1b:	53                   	push   %rbx
+  802e1c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e1f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e24:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e33:	be 00 00 00 00       	mov    $0x0,%esi
+  802e38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e44:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e46:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4a:	c9                   	leave
+  802e4b:	c3                   	ret
+
+0000000000802e4c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e4c:	55                   	push   %rbp
+  802e4d:	48 89 e5             	mov    %rsp,%rbp
+  802e50:	53                   	push   %rbx
+  802e51:	89 f8                	mov    %edi,%eax
+  802e53:	49 89 f1             	mov    %rsi,%r9
+  802e56:	48 89 d3             	mov    %rdx,%rbx
+  802e59:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e5c:	49 63 f0             	movslq %r8d,%rsi
+  802e5f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e62:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e67:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e6a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e76:	cd 30                	int    $0x30
+}
+  802e78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e7c:	c9                   	leave
+  802e7d:	c3                   	ret
+
+0000000000802e7e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e7e:	55                   	push   %rbp
+  802e7f:	48 89 e5             	mov    %rsp,%rbp
+  802e82:	53                   	push   %rbx
+  802e83:	89 f8                	mov    %edi,%eax
+  802e85:	49 89 f1             	mov    %rsi,%r9
+  802e88:	48 89 d3             	mov    %rdx,%rbx
+  802e8b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e8e:	49 63 f0             	movslq %r8d,%rsi
+  802e91:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e94:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e99:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ea2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ea8:	cd 30                	int    $0x30
+}
+  802eaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eae:	c9                   	leave
+  802eaf:	c3                   	ret
+
+0000000000802eb0 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802eb0:	55                   	push   %rbp
+  802eb1:	48 89 e5             	mov    %rsp,%rbp
+  802eb4:	53                   	push   %rbx
+  802eb5:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb9:	89 f8                	mov    %edi,%eax
+  802ebb:	49 89 f2             	mov    %rsi,%r10
+  802ebe:	48 89 d3             	mov    %rdx,%rbx
+  802ec1:	48 89 cf             	mov    %rcx,%rdi
+  802ec4:	44 89 c6             	mov    %r8d,%esi
+  802ec7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802eca:	48 63 f6             	movslq %esi,%rsi
+  802ecd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ed0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ed5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ed8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802edc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ede:	48 85 c0             	test   %rax,%rax
+  802ee1:	7f 06                	jg     802ee9 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ee3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee7:	c9                   	leave
+  802ee8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ee9:	49 89 c0             	mov    %rax,%r8
+  802eec:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802ef1:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802ef8:	00 00 00 
+  802efb:	be 27 00 00 00       	mov    $0x27,%esi
+  802f00:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802f07:	00 00 00 
+  802f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f0f:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802f16:	00 00 00 
+  802f19:	41 ff d1             	call   *%r9
+
+0000000000802f1c <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	53                   	push   %rbx
+  802f21:	48 83 ec 08          	sub    $0x8,%rsp
+  802f25:	48 89 f1             	mov    %rsi,%rcx
+  802f28:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f2b:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f2f:	48 8b 1a             	mov    (%rdx),%rbx
+  802f32:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f35:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f3a:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f3e:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f42:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f46:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f48:	48 85 c0             	test   %rax,%rax
+  802f4b:	7f 06                	jg     802f53 <sys_ipc_call_short+0x37>
+}
+  802f4d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f51:	c9                   	leave
+  802f52:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f53:	49 89 c0             	mov    %rax,%r8
+  802f56:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f5b:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802f62:	00 00 00 
+  802f65:	be 27 00 00 00       	mov    $0x27,%esi
+  802f6a:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802f71:	00 00 00 
+  802f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f79:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802f80:	00 00 00 
+  802f83:	41 ff d1             	call   *%r9
+
+0000000000802f86 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f86:	55                   	push   %rbp
+  802f87:	48 89 e5             	mov    %rsp,%rbp
+  802f8a:	53                   	push   %rbx
+  802f8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f8f:	89 f8                	mov    %edi,%eax
+  802f91:	49 89 f2             	mov    %rsi,%r10
+  802f94:	48 89 d3             	mov    %rdx,%rbx
+  802f97:	48 89 cf             	mov    %rcx,%rdi
+  802f9a:	44 89 c6             	mov    %r8d,%esi
+  802f9d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802fa0:	48 63 f6             	movslq %esi,%rsi
+  802fa3:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fa6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fab:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802fae:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802fb2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fb4:	48 85 c0             	test   %rax,%rax
+  802fb7:	7f 06                	jg     802fbf <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802fb9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fbd:	c9                   	leave
+  802fbe:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fbf:	49 89 c0             	mov    %rax,%r8
+  802fc2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802fc7:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  802fce:	00 00 00 
+  802fd1:	be 27 00 00 00       	mov    $0x27,%esi
+  802fd6:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  802fdd:	00 00 00 
+  802fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe5:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  802fec:	00 00 00 
+  802fef:	41 ff d1             	call   *%r9
+
+0000000000802ff2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802ff2:	55                   	push   %rbp
+  802ff3:	48 89 e5             	mov    %rsp,%rbp
+  802ff6:	53                   	push   %rbx
+  802ff7:	48 83 ec 08          	sub    $0x8,%rsp
+  802ffb:	48 89 fa             	mov    %rdi,%rdx
+  802ffe:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803001:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803006:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80300b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803010:	be 00 00 00 00       	mov    $0x0,%esi
+  803015:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80301b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803021:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803023:	48 85 c0             	test   %rax,%rax
+  803026:	7f 06                	jg     80302e <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803028:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80302c:	c9                   	leave
+  80302d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80302e:	49 89 c0             	mov    %rax,%r8
+  803031:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803036:	48 ba 08 65 80 00 00 	movabs $0x806508,%rdx
+  80303d:	00 00 00 
+  803040:	be 27 00 00 00       	mov    $0x27,%esi
+  803045:	48 bf 27 65 80 00 00 	movabs $0x806527,%rdi
+  80304c:	00 00 00 
+  80304f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803054:	49 b9 ba 18 80 00 00 	movabs $0x8018ba,%r9
+  80305b:	00 00 00 
+  80305e:	41 ff d1             	call   *%r9
+
+0000000000803061 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803061:	55                   	push   %rbp
+  803062:	48 89 e5             	mov    %rsp,%rbp
+  803065:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803066:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80306b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803070:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803075:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80307a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80307f:	be 00 00 00 00       	mov    $0x0,%esi
+  803084:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80308a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803090:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803092:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803096:	c9                   	leave
+  803097:	c3                   	ret
+
+0000000000803098 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803098:	55                   	push   %rbp
+  803099:	48 89 e5             	mov    %rsp,%rbp
+  80309c:	53                   	push   %rbx
+  80309d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030a0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030af:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c5:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8030c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030cb:	c9                   	leave
+  8030cc:	c3                   	ret
+
+00000000008030cd <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  8030cd:	55                   	push   %rbp
+  8030ce:	48 89 e5             	mov    %rsp,%rbp
+  8030d1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030d2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8030f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030fc:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803102:	c9                   	leave
+  803103:	c3                   	ret
+
+0000000000803104 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803104:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80310b:	ff ff ff 
+  80310e:	48 01 f8             	add    %rdi,%rax
+  803111:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803115:	c3                   	ret
+
+0000000000803116 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803116:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80311d:	ff ff ff 
+  803120:	48 01 f8             	add    %rdi,%rax
+  803123:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803127:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80312d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803131:	c3                   	ret
+
+0000000000803132 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803132:	55                   	push   %rbp
+  803133:	48 89 e5             	mov    %rsp,%rbp
+  803136:	41 57                	push   %r15
+  803138:	41 56                	push   %r14
+  80313a:	41 55                	push   %r13
+  80313c:	41 54                	push   %r12
+  80313e:	53                   	push   %rbx
+  80313f:	48 83 ec 08          	sub    $0x8,%rsp
+  803143:	49 89 ff             	mov    %rdi,%r15
+  803146:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80314b:	49 bd 32 46 80 00 00 	movabs $0x804632,%r13
+  803152:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803155:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80315b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80315e:	48 89 df             	mov    %rbx,%rdi
+  803161:	41 ff d5             	call   *%r13
+  803164:	83 e0 04             	and    $0x4,%eax
+  803167:	74 17                	je     803180 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803169:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803170:	4c 39 f3             	cmp    %r14,%rbx
+  803173:	75 e6                	jne    80315b <fd_alloc+0x29>
+  803175:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80317b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803180:	4d 89 27             	mov    %r12,(%r15)
+}
+  803183:	48 83 c4 08          	add    $0x8,%rsp
+  803187:	5b                   	pop    %rbx
+  803188:	41 5c                	pop    %r12
+  80318a:	41 5d                	pop    %r13
+  80318c:	41 5e                	pop    %r14
+  80318e:	41 5f                	pop    %r15
+  803190:	5d                   	pop    %rbp
+  803191:	c3                   	ret
+
+0000000000803192 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803192:	83 ff 1f             	cmp    $0x1f,%edi
+  803195:	77 39                	ja     8031d0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803197:	55                   	push   %rbp
+  803198:	48 89 e5             	mov    %rsp,%rbp
+  80319b:	41 54                	push   %r12
+  80319d:	53                   	push   %rbx
+  80319e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8031a1:	48 63 df             	movslq %edi,%rbx
+  8031a4:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8031ab:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8031af:	48 89 df             	mov    %rbx,%rdi
+  8031b2:	48 b8 32 46 80 00 00 	movabs $0x804632,%rax
+  8031b9:	00 00 00 
+  8031bc:	ff d0                	call   *%rax
+  8031be:	a8 04                	test   $0x4,%al
+  8031c0:	74 14                	je     8031d6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8031c2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8031c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031cb:	5b                   	pop    %rbx
+  8031cc:	41 5c                	pop    %r12
+  8031ce:	5d                   	pop    %rbp
+  8031cf:	c3                   	ret
+        return -E_INVAL;
+  8031d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031d5:	c3                   	ret
+        return -E_INVAL;
+  8031d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031db:	eb ee                	jmp    8031cb <fd_lookup+0x39>
+
+00000000008031dd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031dd:	55                   	push   %rbp
+  8031de:	48 89 e5             	mov    %rsp,%rbp
+  8031e1:	41 54                	push   %r12
+  8031e3:	53                   	push   %rbx
+  8031e4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8031e7:	48 b8 c0 65 80 00 00 	movabs $0x8065c0,%rax
+  8031ee:	00 00 00 
+  8031f1:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8031f8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8031fb:	39 3b                	cmp    %edi,(%rbx)
+  8031fd:	74 47                	je     803246 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8031ff:	48 83 c0 08          	add    $0x8,%rax
+  803203:	48 8b 18             	mov    (%rax),%rbx
+  803206:	48 85 db             	test   %rbx,%rbx
+  803209:	75 f0                	jne    8031fb <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80320b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803212:	00 00 00 
+  803215:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80321b:	89 fa                	mov    %edi,%edx
+  80321d:	48 bf 38 65 80 00 00 	movabs $0x806538,%rdi
+  803224:	00 00 00 
+  803227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322c:	48 b9 0a 1a 80 00 00 	movabs $0x801a0a,%rcx
+  803233:	00 00 00 
+  803236:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803238:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80323d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803241:	5b                   	pop    %rbx
+  803242:	41 5c                	pop    %r12
+  803244:	5d                   	pop    %rbp
+  803245:	c3                   	ret
+            return 0;
+  803246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80324b:	eb f0                	jmp    80323d <dev_lookup+0x60>
+
+000000000080324d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80324d:	55                   	push   %rbp
+  80324e:	48 89 e5             	mov    %rsp,%rbp
+  803251:	41 55                	push   %r13
+  803253:	41 54                	push   %r12
+  803255:	53                   	push   %rbx
+  803256:	48 83 ec 18          	sub    $0x18,%rsp
+  80325a:	48 89 fb             	mov    %rdi,%rbx
+  80325d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803260:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803267:	ff ff ff 
+  80326a:	48 01 df             	add    %rbx,%rdi
+  80326d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803271:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803275:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+  803281:	41 89 c5             	mov    %eax,%r13d
+  803284:	85 c0                	test   %eax,%eax
+  803286:	78 06                	js     80328e <fd_close+0x41>
+  803288:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80328c:	74 1a                	je     8032a8 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80328e:	45 84 e4             	test   %r12b,%r12b
+  803291:	b8 00 00 00 00       	mov    $0x0,%eax
+  803296:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80329a:	44 89 e8             	mov    %r13d,%eax
+  80329d:	48 83 c4 18          	add    $0x18,%rsp
+  8032a1:	5b                   	pop    %rbx
+  8032a2:	41 5c                	pop    %r12
+  8032a4:	41 5d                	pop    %r13
+  8032a6:	5d                   	pop    %rbp
+  8032a7:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8032a8:	8b 3b                	mov    (%rbx),%edi
+  8032aa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8032ae:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+  8032ba:	41 89 c5             	mov    %eax,%r13d
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 1b                	js     8032dc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8032c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032c5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8032c9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8032cf:	48 85 c0             	test   %rax,%rax
+  8032d2:	74 08                	je     8032dc <fd_close+0x8f>
+  8032d4:	48 89 df             	mov    %rbx,%rdi
+  8032d7:	ff d0                	call   *%rax
+  8032d9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032e1:	48 89 de             	mov    %rbx,%rsi
+  8032e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e9:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+    return res;
+  8032f5:	eb a3                	jmp    80329a <fd_close+0x4d>
+
+00000000008032f7 <close>:
+
+int
+close(int fdnum) {
+  8032f7:	55                   	push   %rbp
+  8032f8:	48 89 e5             	mov    %rsp,%rbp
+  8032fb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803303:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  80330a:	00 00 00 
+  80330d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80330f:	85 c0                	test   %eax,%eax
+  803311:	78 15                	js     803328 <close+0x31>
+
+    return fd_close(fd, 1);
+  803313:	be 01 00 00 00       	mov    $0x1,%esi
+  803318:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80331c:	48 b8 4d 32 80 00 00 	movabs $0x80324d,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+}
+  803328:	c9                   	leave
+  803329:	c3                   	ret
+
+000000000080332a <close_all>:
+
+void
+close_all(void) {
+  80332a:	55                   	push   %rbp
+  80332b:	48 89 e5             	mov    %rsp,%rbp
+  80332e:	41 54                	push   %r12
+  803330:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803331:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803336:	49 bc f7 32 80 00 00 	movabs $0x8032f7,%r12
+  80333d:	00 00 00 
+  803340:	89 df                	mov    %ebx,%edi
+  803342:	41 ff d4             	call   *%r12
+  803345:	83 c3 01             	add    $0x1,%ebx
+  803348:	83 fb 20             	cmp    $0x20,%ebx
+  80334b:	75 f3                	jne    803340 <close_all+0x16>
+}
+  80334d:	5b                   	pop    %rbx
+  80334e:	41 5c                	pop    %r12
+  803350:	5d                   	pop    %rbp
+  803351:	c3                   	ret
+
+0000000000803352 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803352:	55                   	push   %rbp
+  803353:	48 89 e5             	mov    %rsp,%rbp
+  803356:	41 57                	push   %r15
+  803358:	41 56                	push   %r14
+  80335a:	41 55                	push   %r13
+  80335c:	41 54                	push   %r12
+  80335e:	53                   	push   %rbx
+  80335f:	48 83 ec 18          	sub    $0x18,%rsp
+  803363:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803366:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80336a:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+  803376:	89 c3                	mov    %eax,%ebx
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	0f 88 b8 00 00 00    	js     803438 <dup+0xe6>
+    close(newfdnum);
+  803380:	44 89 e7             	mov    %r12d,%edi
+  803383:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80338f:	4d 63 ec             	movslq %r12d,%r13
+  803392:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803399:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80339d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8033a1:	4c 89 ff             	mov    %r15,%rdi
+  8033a4:	49 be 16 31 80 00 00 	movabs $0x803116,%r14
+  8033ab:	00 00 00 
+  8033ae:	41 ff d6             	call   *%r14
+  8033b1:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8033b4:	4c 89 ef             	mov    %r13,%rdi
+  8033b7:	41 ff d6             	call   *%r14
+  8033ba:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8033bd:	48 89 df             	mov    %rbx,%rdi
+  8033c0:	48 b8 32 46 80 00 00 	movabs $0x804632,%rax
+  8033c7:	00 00 00 
+  8033ca:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8033cc:	a8 04                	test   $0x4,%al
+  8033ce:	74 2b                	je     8033fb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8033d0:	41 89 c1             	mov    %eax,%r9d
+  8033d3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033d9:	4c 89 f1             	mov    %r14,%rcx
+  8033dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e1:	48 89 de             	mov    %rbx,%rsi
+  8033e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033e9:	48 b8 13 2b 80 00 00 	movabs $0x802b13,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+  8033f5:	89 c3                	mov    %eax,%ebx
+  8033f7:	85 c0                	test   %eax,%eax
+  8033f9:	78 4e                	js     803449 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8033fb:	4c 89 ff             	mov    %r15,%rdi
+  8033fe:	48 b8 32 46 80 00 00 	movabs $0x804632,%rax
+  803405:	00 00 00 
+  803408:	ff d0                	call   *%rax
+  80340a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80340d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803413:	4c 89 e9             	mov    %r13,%rcx
+  803416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80341b:	4c 89 fe             	mov    %r15,%rsi
+  80341e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803423:	48 b8 13 2b 80 00 00 	movabs $0x802b13,%rax
+  80342a:	00 00 00 
+  80342d:	ff d0                	call   *%rax
+  80342f:	89 c3                	mov    %eax,%ebx
+  803431:	85 c0                	test   %eax,%eax
+  803433:	78 14                	js     803449 <dup+0xf7>
+
+    return newfdnum;
+  803435:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803438:	89 d8                	mov    %ebx,%eax
+  80343a:	48 83 c4 18          	add    $0x18,%rsp
+  80343e:	5b                   	pop    %rbx
+  80343f:	41 5c                	pop    %r12
+  803441:	41 5d                	pop    %r13
+  803443:	41 5e                	pop    %r14
+  803445:	41 5f                	pop    %r15
+  803447:	5d                   	pop    %rbp
+  803448:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803449:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80344e:	4c 89 ee             	mov    %r13,%rsi
+  803451:	bf 00 00 00 00       	mov    $0x0,%edi
+  803456:	49 bc 7e 2b 80 00 00 	movabs $0x802b7e,%r12
+  80345d:	00 00 00 
+  803460:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803463:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803468:	4c 89 f6             	mov    %r14,%rsi
+  80346b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803470:	41 ff d4             	call   *%r12
+    return res;
+  803473:	eb c3                	jmp    803438 <dup+0xe6>
+
+0000000000803475 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803475:	55                   	push   %rbp
+  803476:	48 89 e5             	mov    %rsp,%rbp
+  803479:	41 56                	push   %r14
+  80347b:	41 55                	push   %r13
+  80347d:	41 54                	push   %r12
+  80347f:	53                   	push   %rbx
+  803480:	48 83 ec 10          	sub    $0x10,%rsp
+  803484:	89 fb                	mov    %edi,%ebx
+  803486:	49 89 f4             	mov    %rsi,%r12
+  803489:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80348c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803490:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	78 4c                	js     8034ec <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034a0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8034a4:	41 8b 3e             	mov    (%r14),%edi
+  8034a7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8034ab:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	78 35                	js     8034f0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8034bb:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8034bf:	83 e0 03             	and    $0x3,%eax
+  8034c2:	83 f8 01             	cmp    $0x1,%eax
+  8034c5:	74 2d                	je     8034f4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8034c7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034cb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8034cf:	48 85 c0             	test   %rax,%rax
+  8034d2:	74 56                	je     80352a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8034d4:	4c 89 ea             	mov    %r13,%rdx
+  8034d7:	4c 89 e6             	mov    %r12,%rsi
+  8034da:	4c 89 f7             	mov    %r14,%rdi
+  8034dd:	ff d0                	call   *%rax
+}
+  8034df:	48 83 c4 10          	add    $0x10,%rsp
+  8034e3:	5b                   	pop    %rbx
+  8034e4:	41 5c                	pop    %r12
+  8034e6:	41 5d                	pop    %r13
+  8034e8:	41 5e                	pop    %r14
+  8034ea:	5d                   	pop    %rbp
+  8034eb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034ec:	48 98                	cltq
+  8034ee:	eb ef                	jmp    8034df <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034f0:	48 98                	cltq
+  8034f2:	eb eb                	jmp    8034df <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034f4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034fb:	00 00 00 
+  8034fe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803504:	89 da                	mov    %ebx,%edx
+  803506:	48 bf 79 65 80 00 00 	movabs $0x806579,%rdi
+  80350d:	00 00 00 
+  803510:	b8 00 00 00 00       	mov    $0x0,%eax
+  803515:	48 b9 0a 1a 80 00 00 	movabs $0x801a0a,%rcx
+  80351c:	00 00 00 
+  80351f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803521:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803528:	eb b5                	jmp    8034df <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80352a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803531:	eb ac                	jmp    8034df <read+0x6a>
+
+0000000000803533 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803533:	55                   	push   %rbp
+  803534:	48 89 e5             	mov    %rsp,%rbp
+  803537:	41 57                	push   %r15
+  803539:	41 56                	push   %r14
+  80353b:	41 55                	push   %r13
+  80353d:	41 54                	push   %r12
+  80353f:	53                   	push   %rbx
+  803540:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803544:	48 85 d2             	test   %rdx,%rdx
+  803547:	74 54                	je     80359d <readn+0x6a>
+  803549:	41 89 fd             	mov    %edi,%r13d
+  80354c:	49 89 f6             	mov    %rsi,%r14
+  80354f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803552:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803557:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80355c:	49 bf 75 34 80 00 00 	movabs $0x803475,%r15
+  803563:	00 00 00 
+  803566:	4c 89 e2             	mov    %r12,%rdx
+  803569:	48 29 f2             	sub    %rsi,%rdx
+  80356c:	4c 01 f6             	add    %r14,%rsi
+  80356f:	44 89 ef             	mov    %r13d,%edi
+  803572:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803575:	85 c0                	test   %eax,%eax
+  803577:	78 20                	js     803599 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803579:	01 c3                	add    %eax,%ebx
+  80357b:	85 c0                	test   %eax,%eax
+  80357d:	74 08                	je     803587 <readn+0x54>
+  80357f:	48 63 f3             	movslq %ebx,%rsi
+  803582:	4c 39 e6             	cmp    %r12,%rsi
+  803585:	72 df                	jb     803566 <readn+0x33>
+    }
+    return res;
+  803587:	48 63 c3             	movslq %ebx,%rax
+}
+  80358a:	48 83 c4 08          	add    $0x8,%rsp
+  80358e:	5b                   	pop    %rbx
+  80358f:	41 5c                	pop    %r12
+  803591:	41 5d                	pop    %r13
+  803593:	41 5e                	pop    %r14
+  803595:	41 5f                	pop    %r15
+  803597:	5d                   	pop    %rbp
+  803598:	c3                   	ret
+        if (inc < 0) return inc;
+  803599:	48 98                	cltq
+  80359b:	eb ed                	jmp    80358a <readn+0x57>
+    int inc = 1, res = 0;
+  80359d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035a2:	eb e3                	jmp    803587 <readn+0x54>
+
+00000000008035a4 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+  8035a8:	41 56                	push   %r14
+  8035aa:	41 55                	push   %r13
+  8035ac:	41 54                	push   %r12
+  8035ae:	53                   	push   %rbx
+  8035af:	48 83 ec 10          	sub    $0x10,%rsp
+  8035b3:	89 fb                	mov    %edi,%ebx
+  8035b5:	49 89 f4             	mov    %rsi,%r12
+  8035b8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035bb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035bf:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	78 47                	js     803616 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035cf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035d3:	41 8b 3e             	mov    (%r14),%edi
+  8035d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035da:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 30                	js     80361a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035ea:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8035ef:	74 2d                	je     80361e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8035f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035f5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035f9:	48 85 c0             	test   %rax,%rax
+  8035fc:	74 56                	je     803654 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8035fe:	4c 89 ea             	mov    %r13,%rdx
+  803601:	4c 89 e6             	mov    %r12,%rsi
+  803604:	4c 89 f7             	mov    %r14,%rdi
+  803607:	ff d0                	call   *%rax
+}
+  803609:	48 83 c4 10          	add    $0x10,%rsp
+  80360d:	5b                   	pop    %rbx
+  80360e:	41 5c                	pop    %r12
+  803610:	41 5d                	pop    %r13
+  803612:	41 5e                	pop    %r14
+  803614:	5d                   	pop    %rbp
+  803615:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803616:	48 98                	cltq
+  803618:	eb ef                	jmp    803609 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80361a:	48 98                	cltq
+  80361c:	eb eb                	jmp    803609 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80361e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803625:	00 00 00 
+  803628:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80362e:	89 da                	mov    %ebx,%edx
+  803630:	48 bf 95 65 80 00 00 	movabs $0x806595,%rdi
+  803637:	00 00 00 
+  80363a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363f:	48 b9 0a 1a 80 00 00 	movabs $0x801a0a,%rcx
+  803646:	00 00 00 
+  803649:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80364b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803652:	eb b5                	jmp    803609 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803654:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80365b:	eb ac                	jmp    803609 <write+0x65>
+
+000000000080365d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80365d:	55                   	push   %rbp
+  80365e:	48 89 e5             	mov    %rsp,%rbp
+  803661:	53                   	push   %rbx
+  803662:	48 83 ec 18          	sub    $0x18,%rsp
+  803666:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803668:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80366c:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803673:	00 00 00 
+  803676:	ff d0                	call   *%rax
+  803678:	85 c0                	test   %eax,%eax
+  80367a:	78 0c                	js     803688 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80367c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803680:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803683:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803688:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80368c:	c9                   	leave
+  80368d:	c3                   	ret
+
+000000000080368e <tell>:
+
+int tell(int fdnum) {
+  80368e:	55                   	push   %rbp
+  80368f:	48 89 e5             	mov    %rsp,%rbp
+  803692:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803696:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80369a:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	78 07                	js     8036b1 <tell+0x23>
+
+    return fd->fd_offset;
+  8036aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036ae:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8036b1:	c9                   	leave
+  8036b2:	c3                   	ret
+
+00000000008036b3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8036b3:	55                   	push   %rbp
+  8036b4:	48 89 e5             	mov    %rsp,%rbp
+  8036b7:	41 55                	push   %r13
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8036c0:	89 fb                	mov    %edi,%ebx
+  8036c2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036c5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036c9:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  8036d0:	00 00 00 
+  8036d3:	ff d0                	call   *%rax
+  8036d5:	85 c0                	test   %eax,%eax
+  8036d7:	78 38                	js     803711 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036d9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8036dd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8036e1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036e5:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  8036ec:	00 00 00 
+  8036ef:	ff d0                	call   *%rax
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	78 1c                	js     803711 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036f5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8036fa:	74 20                	je     80371c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8036fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803700:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803704:	48 85 c0             	test   %rax,%rax
+  803707:	74 47                	je     803750 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803709:	44 89 e6             	mov    %r12d,%esi
+  80370c:	4c 89 ef             	mov    %r13,%rdi
+  80370f:	ff d0                	call   *%rax
+}
+  803711:	48 83 c4 18          	add    $0x18,%rsp
+  803715:	5b                   	pop    %rbx
+  803716:	41 5c                	pop    %r12
+  803718:	41 5d                	pop    %r13
+  80371a:	5d                   	pop    %rbp
+  80371b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80371c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803723:	00 00 00 
+  803726:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80372c:	89 da                	mov    %ebx,%edx
+  80372e:	48 bf 58 65 80 00 00 	movabs $0x806558,%rdi
+  803735:	00 00 00 
+  803738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373d:	48 b9 0a 1a 80 00 00 	movabs $0x801a0a,%rcx
+  803744:	00 00 00 
+  803747:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803749:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80374e:	eb c1                	jmp    803711 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803750:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803755:	eb ba                	jmp    803711 <ftruncate+0x5e>
+
+0000000000803757 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803757:	55                   	push   %rbp
+  803758:	48 89 e5             	mov    %rsp,%rbp
+  80375b:	41 54                	push   %r12
+  80375d:	53                   	push   %rbx
+  80375e:	48 83 ec 10          	sub    $0x10,%rsp
+  803762:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803765:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803769:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+  803775:	85 c0                	test   %eax,%eax
+  803777:	78 63                	js     8037dc <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803779:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80377d:	41 8b 3c 24          	mov    (%r12),%edi
+  803781:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803785:	48 b8 dd 31 80 00 00 	movabs $0x8031dd,%rax
+  80378c:	00 00 00 
+  80378f:	ff d0                	call   *%rax
+  803791:	85 c0                	test   %eax,%eax
+  803793:	78 47                	js     8037dc <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803795:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803799:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80379e:	74 45                	je     8037e5 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8037a0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8037a3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8037aa:	00 00 00 
+    stat->st_isdir = 0;
+  8037ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037b4:	00 00 00 
+    stat->st_ino = 0;
+  8037b7:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8037be:	00 00 00 00 
+    stat->st_version = 0;
+  8037c2:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8037c9:	00 00 00 
+    stat->st_dev = dev;
+  8037cc:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8037d3:	48 89 de             	mov    %rbx,%rsi
+  8037d6:	4c 89 e7             	mov    %r12,%rdi
+  8037d9:	ff 50 28             	call   *0x28(%rax)
+}
+  8037dc:	48 83 c4 10          	add    $0x10,%rsp
+  8037e0:	5b                   	pop    %rbx
+  8037e1:	41 5c                	pop    %r12
+  8037e3:	5d                   	pop    %rbp
+  8037e4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037e5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037ea:	eb f0                	jmp    8037dc <fstat+0x85>
+
+00000000008037ec <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	41 54                	push   %r12
+  8037f2:	53                   	push   %rbx
+  8037f3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8037f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8037fb:	48 b8 0d 3d 80 00 00 	movabs $0x803d0d,%rax
+  803802:	00 00 00 
+  803805:	ff d0                	call   *%rax
+  803807:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803809:	85 c0                	test   %eax,%eax
+  80380b:	78 25                	js     803832 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80380d:	4c 89 e6             	mov    %r12,%rsi
+  803810:	89 c7                	mov    %eax,%edi
+  803812:	48 b8 57 37 80 00 00 	movabs $0x803757,%rax
+  803819:	00 00 00 
+  80381c:	ff d0                	call   *%rax
+  80381e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803821:	89 df                	mov    %ebx,%edi
+  803823:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  80382a:	00 00 00 
+  80382d:	ff d0                	call   *%rax
+
+    return res;
+  80382f:	44 89 e3             	mov    %r12d,%ebx
+}
+  803832:	89 d8                	mov    %ebx,%eax
+  803834:	5b                   	pop    %rbx
+  803835:	41 5c                	pop    %r12
+  803837:	5d                   	pop    %rbp
+  803838:	c3                   	ret
+
+0000000000803839 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803839:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803840:	00 00 00 
+  803843:	83 38 00             	cmpl   $0x0,(%rax)
+  803846:	74 0a                	je     803852 <fsipc_env+0x19>
+    return fsenv;
+}
+  803848:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80384f:	00 00 
+  803851:	c3                   	ret
+fsipc_env(void) {
+  803852:	55                   	push   %rbp
+  803853:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803856:	bf 03 00 00 00       	mov    $0x3,%edi
+  80385b:	48 b8 50 59 80 00 00 	movabs $0x805950,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80386e:	00 00 
+}
+  803870:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803877:	00 00 
+  803879:	5d                   	pop    %rbp
+  80387a:	c3                   	ret
+
+000000000080387b <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  80387b:	55                   	push   %rbp
+  80387c:	48 89 e5             	mov    %rsp,%rbp
+  80387f:	53                   	push   %rbx
+  803880:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803884:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80388b:	00 
+  80388c:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803893:	00 
+  803894:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  80389b:	00 
+  80389c:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8038a3:	00 
+  8038a4:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8038ab:	00 
+
+    assert(size <= sizeof(words));
+  8038ac:	48 83 fa 28          	cmp    $0x28,%rdx
+  8038b0:	77 38                	ja     8038ea <fsipc_short+0x6f>
+  8038b2:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8038b4:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8038b8:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8038c4:	48 b8 39 38 80 00 00 	movabs $0x803839,%rax
+  8038cb:	00 00 00 
+  8038ce:	ff d0                	call   *%rax
+  8038d0:	89 c7                	mov    %eax,%edi
+  8038d2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8038d6:	89 de                	mov    %ebx,%esi
+  8038d8:	48 b8 b3 58 80 00 00 	movabs $0x8058b3,%rax
+  8038df:	00 00 00 
+  8038e2:	ff d0                	call   *%rax
+}
+  8038e4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038e8:	c9                   	leave
+  8038e9:	c3                   	ret
+    assert(size <= sizeof(words));
+  8038ea:	48 b9 e0 65 80 00 00 	movabs $0x8065e0,%rcx
+  8038f1:	00 00 00 
+  8038f4:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  8038fb:	00 00 00 
+  8038fe:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803903:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  80390a:	00 00 00 
+  80390d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803912:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803919:	00 00 00 
+  80391c:	41 ff d0             	call   *%r8
+
+000000000080391f <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80391f:	55                   	push   %rbp
+  803920:	48 89 e5             	mov    %rsp,%rbp
+  803923:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803927:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80392a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80392d:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803930:	ba 08 00 00 00       	mov    $0x8,%edx
+  803935:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803939:	bf 02 00 00 00       	mov    $0x2,%edi
+  80393e:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  803945:	00 00 00 
+  803948:	ff d0                	call   *%rax
+}
+  80394a:	c9                   	leave
+  80394b:	c3                   	ret
+
+000000000080394c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80394c:	55                   	push   %rbp
+  80394d:	48 89 e5             	mov    %rsp,%rbp
+  803950:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803954:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803957:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80395a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80395f:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803963:	bf 06 00 00 00       	mov    $0x6,%edi
+  803968:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+}
+  803974:	c9                   	leave
+  803975:	c3                   	ret
+
+0000000000803976 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	41 54                	push   %r12
+  80397c:	53                   	push   %rbx
+  80397d:	48 83 ec 10          	sub    $0x10,%rsp
+  803981:	89 fb                	mov    %edi,%ebx
+  803983:	49 89 f4             	mov    %rsi,%r12
+  803986:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  80398a:	48 b8 39 38 80 00 00 	movabs $0x803839,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	89 c7                	mov    %eax,%edi
+  803998:	6a 00                	push   $0x0
+  80399a:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80399e:	50                   	push   %rax
+  80399f:	4d 89 e1             	mov    %r12,%r9
+  8039a2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8039a8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039ad:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8039b4:	00 00 00 
+  8039b7:	89 de                	mov    %ebx,%esi
+  8039b9:	48 b8 4e 58 80 00 00 	movabs $0x80584e,%rax
+  8039c0:	00 00 00 
+  8039c3:	ff d0                	call   *%rax
+}
+  8039c5:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8039c9:	5b                   	pop    %rbx
+  8039ca:	41 5c                	pop    %r12
+  8039cc:	5d                   	pop    %rbp
+  8039cd:	c3                   	ret
+
+00000000008039ce <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	41 54                	push   %r12
+  8039d4:	53                   	push   %rbx
+  8039d5:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039d8:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039db:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8039e2:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ee:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039f3:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039ff:	85 c0                	test   %eax,%eax
+  803a01:	78 5a                	js     803a5d <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803a03:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803a0a:	00 00 00 
+  803a0d:	4c 89 e6             	mov    %r12,%rsi
+  803a10:	48 89 df             	mov    %rbx,%rdi
+  803a13:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  803a1a:	00 00 00 
+  803a1d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803a1f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803a26:	00 
+  803a27:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a2d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a34:	00 
+  803a35:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a3b:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803a42:	00 
+  803a43:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803a4a:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803a51:	00 
+  803a52:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803a58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a5d:	5b                   	pop    %rbx
+  803a5e:	41 5c                	pop    %r12
+  803a60:	5d                   	pop    %rbp
+  803a61:	c3                   	ret
+
+0000000000803a62 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a62:	55                   	push   %rbp
+  803a63:	48 89 e5             	mov    %rsp,%rbp
+  803a66:	41 57                	push   %r15
+  803a68:	41 56                	push   %r14
+  803a6a:	41 55                	push   %r13
+  803a6c:	41 54                	push   %r12
+  803a6e:	53                   	push   %rbx
+  803a6f:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803a73:	48 85 ff             	test   %rdi,%rdi
+  803a76:	0f 84 a1 00 00 00    	je     803b1d <devfile_read+0xbb>
+  803a7c:	49 89 ff             	mov    %rdi,%r15
+  803a7f:	49 89 f5             	mov    %rsi,%r13
+  803a82:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803a85:	48 85 f6             	test   %rsi,%rsi
+  803a88:	0f 84 c4 00 00 00    	je     803b52 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803a8e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a95:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a96:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803a9d:	00 00 00 
+  803aa0:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803aa4:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803aa7:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803aab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ab0:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab5:	bf 03 00 00 00       	mov    $0x3,%edi
+  803aba:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+        if (res < 0) {
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	0f 88 b9 00 00 00    	js     803b87 <devfile_read+0x125>
+        assert(res <= n);
+  803ace:	48 63 d8             	movslq %eax,%rbx
+  803ad1:	49 39 dc             	cmp    %rbx,%r12
+  803ad4:	0f 82 b1 00 00 00    	jb     803b8b <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803ada:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803adf:	0f 87 db 00 00 00    	ja     803bc0 <devfile_read+0x15e>
+        if (!res) {
+  803ae5:	85 c0                	test   %eax,%eax
+  803ae7:	74 21                	je     803b0a <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ae9:	48 89 da             	mov    %rbx,%rdx
+  803aec:	4c 89 f6             	mov    %r14,%rsi
+  803aef:	4c 89 ef             	mov    %r13,%rdi
+  803af2:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  803af9:	00 00 00 
+  803afc:	ff d0                	call   *%rax
+        total_read += res;
+  803afe:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803b02:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803b05:	49 29 dc             	sub    %rbx,%r12
+  803b08:	75 96                	jne    803aa0 <devfile_read+0x3e>
+    return total_read;
+  803b0a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803b0e:	48 83 c4 18          	add    $0x18,%rsp
+  803b12:	5b                   	pop    %rbx
+  803b13:	41 5c                	pop    %r12
+  803b15:	41 5d                	pop    %r13
+  803b17:	41 5e                	pop    %r14
+  803b19:	41 5f                	pop    %r15
+  803b1b:	5d                   	pop    %rbp
+  803b1c:	c3                   	ret
+    assert(fd);
+  803b1d:	48 b9 16 66 80 00 00 	movabs $0x806616,%rcx
+  803b24:	00 00 00 
+  803b27:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803b2e:	00 00 00 
+  803b31:	be 91 00 00 00       	mov    $0x91,%esi
+  803b36:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803b3d:	00 00 00 
+  803b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b45:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803b4c:	00 00 00 
+  803b4f:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b52:	48 b9 19 66 80 00 00 	movabs $0x806619,%rcx
+  803b59:	00 00 00 
+  803b5c:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803b63:	00 00 00 
+  803b66:	be 92 00 00 00       	mov    $0x92,%esi
+  803b6b:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803b72:	00 00 00 
+  803b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7a:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803b81:	00 00 00 
+  803b84:	41 ff d0             	call   *%r8
+            return res;
+  803b87:	48 98                	cltq
+  803b89:	eb 83                	jmp    803b0e <devfile_read+0xac>
+        assert(res <= n);
+  803b8b:	48 b9 1d 66 80 00 00 	movabs $0x80661d,%rcx
+  803b92:	00 00 00 
+  803b95:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803b9c:	00 00 00 
+  803b9f:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803ba4:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803bab:	00 00 00 
+  803bae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb3:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803bba:	00 00 00 
+  803bbd:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803bc0:	48 b9 28 66 80 00 00 	movabs $0x806628,%rcx
+  803bc7:	00 00 00 
+  803bca:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803bd1:	00 00 00 
+  803bd4:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803bd9:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803be0:	00 00 00 
+  803be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be8:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803bef:	00 00 00 
+  803bf2:	41 ff d0             	call   *%r8
+
+0000000000803bf5 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bf5:	55                   	push   %rbp
+  803bf6:	48 89 e5             	mov    %rsp,%rbp
+  803bf9:	41 57                	push   %r15
+  803bfb:	41 56                	push   %r14
+  803bfd:	41 55                	push   %r13
+  803bff:	41 54                	push   %r12
+  803c01:	53                   	push   %rbx
+  803c02:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803c06:	48 85 ff             	test   %rdi,%rdi
+  803c09:	0f 84 83 00 00 00    	je     803c92 <devfile_write+0x9d>
+  803c0f:	49 89 ff             	mov    %rdi,%r15
+  803c12:	49 89 f4             	mov    %rsi,%r12
+  803c15:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803c18:	48 85 f6             	test   %rsi,%rsi
+  803c1b:	0f 84 a6 00 00 00    	je     803cc7 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803c21:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c27:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c2e:	00 00 00 
+  803c31:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c35:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c38:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c3c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803c41:	48 39 d3             	cmp    %rdx,%rbx
+  803c44:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803c48:	4c 89 e6             	mov    %r12,%rsi
+  803c4b:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803c52:	00 00 00 
+  803c55:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  803c5c:	00 00 00 
+  803c5f:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c66:	be 00 00 00 00       	mov    $0x0,%esi
+  803c6b:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c70:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803c77:	00 00 00 
+  803c7a:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c7c:	85 c0                	test   %eax,%eax
+  803c7e:	78 7c                	js     803cfc <devfile_write+0x107>
+        total_written += res;
+  803c80:	48 98                	cltq
+  803c82:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803c85:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803c88:	48 29 c3             	sub    %rax,%rbx
+  803c8b:	75 a4                	jne    803c31 <devfile_write+0x3c>
+    return total_written;
+  803c8d:	4c 89 e8             	mov    %r13,%rax
+  803c90:	eb 6c                	jmp    803cfe <devfile_write+0x109>
+    assert(fd);
+  803c92:	48 b9 16 66 80 00 00 	movabs $0x806616,%rcx
+  803c99:	00 00 00 
+  803c9c:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803ca3:	00 00 00 
+  803ca6:	be bd 00 00 00       	mov    $0xbd,%esi
+  803cab:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803cb2:	00 00 00 
+  803cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cba:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803cc1:	00 00 00 
+  803cc4:	41 ff d0             	call   *%r8
+    assert(buf);
+  803cc7:	48 b9 19 66 80 00 00 	movabs $0x806619,%rcx
+  803cce:	00 00 00 
+  803cd1:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  803cd8:	00 00 00 
+  803cdb:	be be 00 00 00       	mov    $0xbe,%esi
+  803ce0:	48 bf 0b 66 80 00 00 	movabs $0x80660b,%rdi
+  803ce7:	00 00 00 
+  803cea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cef:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  803cf6:	00 00 00 
+  803cf9:	41 ff d0             	call   *%r8
+            return res;
+  803cfc:	48 98                	cltq
+}
+  803cfe:	48 83 c4 08          	add    $0x8,%rsp
+  803d02:	5b                   	pop    %rbx
+  803d03:	41 5c                	pop    %r12
+  803d05:	41 5d                	pop    %r13
+  803d07:	41 5e                	pop    %r14
+  803d09:	41 5f                	pop    %r15
+  803d0b:	5d                   	pop    %rbp
+  803d0c:	c3                   	ret
+
+0000000000803d0d <open>:
+open(const char *path, int mode) {
+  803d0d:	55                   	push   %rbp
+  803d0e:	48 89 e5             	mov    %rsp,%rbp
+  803d11:	41 55                	push   %r13
+  803d13:	41 54                	push   %r12
+  803d15:	53                   	push   %rbx
+  803d16:	48 83 ec 18          	sub    $0x18,%rsp
+  803d1a:	49 89 fc             	mov    %rdi,%r12
+  803d1d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803d20:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  803d27:	00 00 00 
+  803d2a:	ff d0                	call   *%rax
+  803d2c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803d32:	0f 87 8f 00 00 00    	ja     803dc7 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d38:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d3c:	48 b8 32 31 80 00 00 	movabs $0x803132,%rax
+  803d43:	00 00 00 
+  803d46:	ff d0                	call   *%rax
+  803d48:	89 c3                	mov    %eax,%ebx
+  803d4a:	85 c0                	test   %eax,%eax
+  803d4c:	78 55                	js     803da3 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d4e:	4c 89 e6             	mov    %r12,%rsi
+  803d51:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803d58:	00 00 00 
+  803d5b:	48 89 df             	mov    %rbx,%rdi
+  803d5e:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  803d65:	00 00 00 
+  803d68:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d6a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d71:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d76:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d7f:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803d86:	00 00 00 
+  803d89:	ff d0                	call   *%rax
+  803d8b:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d8d:	85 c0                	test   %eax,%eax
+  803d8f:	78 1f                	js     803db0 <open+0xa3>
+    return fd2num(fd);
+  803d91:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d95:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  803d9c:	00 00 00 
+  803d9f:	ff d0                	call   *%rax
+  803da1:	89 c3                	mov    %eax,%ebx
+}
+  803da3:	89 d8                	mov    %ebx,%eax
+  803da5:	48 83 c4 18          	add    $0x18,%rsp
+  803da9:	5b                   	pop    %rbx
+  803daa:	41 5c                	pop    %r12
+  803dac:	41 5d                	pop    %r13
+  803dae:	5d                   	pop    %rbp
+  803daf:	c3                   	ret
+        fd_close(fd, 0);
+  803db0:	be 00 00 00 00       	mov    $0x0,%esi
+  803db5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803db9:	48 b8 4d 32 80 00 00 	movabs $0x80324d,%rax
+  803dc0:	00 00 00 
+  803dc3:	ff d0                	call   *%rax
+        return res;
+  803dc5:	eb dc                	jmp    803da3 <open+0x96>
+        return -E_BAD_PATH;
+  803dc7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803dcc:	eb d5                	jmp    803da3 <open+0x96>
+
+0000000000803dce <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803dce:	55                   	push   %rbp
+  803dcf:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd7:	be 00 00 00 00       	mov    $0x0,%esi
+  803ddc:	bf 08 00 00 00       	mov    $0x8,%edi
+  803de1:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  803de8:	00 00 00 
+  803deb:	ff d0                	call   *%rax
+}
+  803ded:	5d                   	pop    %rbp
+  803dee:	c3                   	ret
+
+0000000000803def <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	41 56                	push   %r14
+  803df5:	41 55                	push   %r13
+  803df7:	41 54                	push   %r12
+  803df9:	53                   	push   %rbx
+  803dfa:	48 83 ec 10          	sub    $0x10,%rsp
+  803dfe:	41 89 f6             	mov    %esi,%r14d
+  803e01:	49 89 d4             	mov    %rdx,%r12
+  803e04:	48 89 cb             	mov    %rcx,%rbx
+  803e07:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e0a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e0e:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803e15:	00 00 00 
+  803e18:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e1a:	85 c0                	test   %eax,%eax
+  803e1c:	78 46                	js     803e64 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e1e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e22:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803e29:	00 00 00 
+  803e2c:	8b 00                	mov    (%rax),%eax
+  803e2e:	39 02                	cmp    %eax,(%rdx)
+  803e30:	75 3f                	jne    803e71 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803e32:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e39:	00 00 00 
+  803e3c:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e3f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803e41:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803e45:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803e49:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803e4d:	48 89 da             	mov    %rbx,%rdx
+  803e50:	4c 89 e6             	mov    %r12,%rsi
+  803e53:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e58:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803e5f:	00 00 00 
+  803e62:	ff d0                	call   *%rax
+}
+  803e64:	48 83 c4 10          	add    $0x10,%rsp
+  803e68:	5b                   	pop    %rbx
+  803e69:	41 5c                	pop    %r12
+  803e6b:	41 5d                	pop    %r13
+  803e6d:	41 5e                	pop    %r14
+  803e6f:	5d                   	pop    %rbp
+  803e70:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e71:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e76:	eb ec                	jmp    803e64 <file_map+0x75>
+
+0000000000803e78 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803e78:	55                   	push   %rbp
+  803e79:	48 89 e5             	mov    %rsp,%rbp
+  803e7c:	41 54                	push   %r12
+  803e7e:	53                   	push   %rbx
+  803e7f:	48 83 ec 20          	sub    $0x20,%rsp
+  803e83:	41 89 f4             	mov    %esi,%r12d
+  803e86:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e89:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803e8d:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e99:	85 c0                	test   %eax,%eax
+  803e9b:	78 3c                	js     803ed9 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ea1:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803ea8:	00 00 00 
+  803eab:	8b 0a                	mov    (%rdx),%ecx
+  803ead:	39 08                	cmp    %ecx,(%rax)
+  803eaf:	75 31                	jne    803ee2 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803eb1:	8b 40 0c             	mov    0xc(%rax),%eax
+  803eb4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803eb7:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803ebb:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803ebf:	ba 10 00 00 00       	mov    $0x10,%edx
+  803ec4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ec8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803ecd:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  803ed4:	00 00 00 
+  803ed7:	ff d0                	call   *%rax
+}
+  803ed9:	48 83 c4 20          	add    $0x20,%rsp
+  803edd:	5b                   	pop    %rbx
+  803ede:	41 5c                	pop    %r12
+  803ee0:	5d                   	pop    %rbp
+  803ee1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ee2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ee7:	eb f0                	jmp    803ed9 <file_msync+0x61>
+
+0000000000803ee9 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803ee9:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803eed:	7f 01                	jg     803ef0 <writebuf+0x7>
+  803eef:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ef0:	55                   	push   %rbp
+  803ef1:	48 89 e5             	mov    %rsp,%rbp
+  803ef4:	53                   	push   %rbx
+  803ef5:	48 83 ec 08          	sub    $0x8,%rsp
+  803ef9:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803efc:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803f00:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803f04:	8b 3f                	mov    (%rdi),%edi
+  803f06:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  803f0d:	00 00 00 
+  803f10:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803f12:	48 85 c0             	test   %rax,%rax
+  803f15:	7e 04                	jle    803f1b <writebuf+0x32>
+  803f17:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803f1b:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803f1f:	48 39 c2             	cmp    %rax,%rdx
+  803f22:	74 0f                	je     803f33 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803f24:	48 85 c0             	test   %rax,%rax
+  803f27:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f2c:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803f30:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803f33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f37:	c9                   	leave
+  803f38:	c3                   	ret
+
+0000000000803f39 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f39:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f3c:	8d 50 01             	lea    0x1(%rax),%edx
+  803f3f:	89 56 04             	mov    %edx,0x4(%rsi)
+  803f42:	48 98                	cltq
+  803f44:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803f49:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803f4f:	74 01                	je     803f52 <putch+0x19>
+  803f51:	c3                   	ret
+putch(int ch, void *arg) {
+  803f52:	55                   	push   %rbp
+  803f53:	48 89 e5             	mov    %rsp,%rbp
+  803f56:	53                   	push   %rbx
+  803f57:	48 83 ec 08          	sub    $0x8,%rsp
+  803f5b:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803f5e:	48 89 f7             	mov    %rsi,%rdi
+  803f61:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+        state->offset = 0;
+  803f6d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803f74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f78:	c9                   	leave
+  803f79:	c3                   	ret
+
+0000000000803f7a <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f7a:	55                   	push   %rbp
+  803f7b:	48 89 e5             	mov    %rsp,%rbp
+  803f7e:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803f85:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803f88:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803f8e:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803f95:	00 00 00 
+    state.result = 0;
+  803f98:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803f9f:	00 00 00 00 
+    state.error = 1;
+  803fa3:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803faa:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803fad:	48 89 f2             	mov    %rsi,%rdx
+  803fb0:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803fb7:	48 bf 39 3f 80 00 00 	movabs $0x803f39,%rdi
+  803fbe:	00 00 00 
+  803fc1:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803fcd:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803fd4:	7f 14                	jg     803fea <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803fd6:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803fdd:	48 85 c0             	test   %rax,%rax
+  803fe0:	75 06                	jne    803fe8 <vfprintf+0x6e>
+  803fe2:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803fe8:	c9                   	leave
+  803fe9:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803fea:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ff1:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  803ff8:	00 00 00 
+  803ffb:	ff d0                	call   *%rax
+  803ffd:	eb d7                	jmp    803fd6 <vfprintf+0x5c>
+
+0000000000803fff <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803fff:	55                   	push   %rbp
+  804000:	48 89 e5             	mov    %rsp,%rbp
+  804003:	48 83 ec 50          	sub    $0x50,%rsp
+  804007:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80400b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80400f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804013:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804017:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80401e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804022:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804026:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80402a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80402e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804032:	48 b8 7a 3f 80 00 00 	movabs $0x803f7a,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80403e:	c9                   	leave
+  80403f:	c3                   	ret
+
+0000000000804040 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804040:	55                   	push   %rbp
+  804041:	48 89 e5             	mov    %rsp,%rbp
+  804044:	48 83 ec 50          	sub    $0x50,%rsp
+  804048:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80404c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804050:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804054:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804058:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80405c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804063:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804067:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80406b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80406f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804073:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804077:	48 89 fe             	mov    %rdi,%rsi
+  80407a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80407f:	48 b8 7a 3f 80 00 00 	movabs $0x803f7a,%rax
+  804086:	00 00 00 
+  804089:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80408b:	c9                   	leave
+  80408c:	c3                   	ret
+
+000000000080408d <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80408d:	55                   	push   %rbp
+  80408e:	48 89 e5             	mov    %rsp,%rbp
+  804091:	41 54                	push   %r12
+  804093:	53                   	push   %rbx
+  804094:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804097:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  80409e:	00 00 00 
+  8040a1:	ff d0                	call   *%rax
+  8040a3:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8040a6:	48 be 50 66 80 00 00 	movabs $0x806650,%rsi
+  8040ad:	00 00 00 
+  8040b0:	48 89 df             	mov    %rbx,%rdi
+  8040b3:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  8040ba:	00 00 00 
+  8040bd:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8040bf:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8040c4:	41 2b 04 24          	sub    (%r12),%eax
+  8040c8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8040ce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040d5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040d8:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8040df:	00 00 00 
+  8040e2:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8040e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ee:	5b                   	pop    %rbx
+  8040ef:	41 5c                	pop    %r12
+  8040f1:	5d                   	pop    %rbp
+  8040f2:	c3                   	ret
+
+00000000008040f3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8040f3:	55                   	push   %rbp
+  8040f4:	48 89 e5             	mov    %rsp,%rbp
+  8040f7:	41 54                	push   %r12
+  8040f9:	53                   	push   %rbx
+  8040fa:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8040fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804102:	48 89 fe             	mov    %rdi,%rsi
+  804105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80410a:	49 bc 7e 2b 80 00 00 	movabs $0x802b7e,%r12
+  804111:	00 00 00 
+  804114:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804117:	48 89 df             	mov    %rbx,%rdi
+  80411a:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  804121:	00 00 00 
+  804124:	ff d0                	call   *%rax
+  804126:	48 89 c6             	mov    %rax,%rsi
+  804129:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804133:	41 ff d4             	call   *%r12
+}
+  804136:	5b                   	pop    %rbx
+  804137:	41 5c                	pop    %r12
+  804139:	5d                   	pop    %rbp
+  80413a:	c3                   	ret
+
+000000000080413b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80413b:	55                   	push   %rbp
+  80413c:	48 89 e5             	mov    %rsp,%rbp
+  80413f:	41 57                	push   %r15
+  804141:	41 56                	push   %r14
+  804143:	41 55                	push   %r13
+  804145:	41 54                	push   %r12
+  804147:	53                   	push   %rbx
+  804148:	48 83 ec 18          	sub    $0x18,%rsp
+  80414c:	49 89 fc             	mov    %rdi,%r12
+  80414f:	49 89 f5             	mov    %rsi,%r13
+  804152:	49 89 d7             	mov    %rdx,%r15
+  804155:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804159:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  804160:	00 00 00 
+  804163:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804165:	4d 85 ff             	test   %r15,%r15
+  804168:	0f 84 af 00 00 00    	je     80421d <devpipe_write+0xe2>
+  80416e:	48 89 c3             	mov    %rax,%rbx
+  804171:	4c 89 f8             	mov    %r15,%rax
+  804174:	4d 89 ef             	mov    %r13,%r15
+  804177:	4c 01 e8             	add    %r13,%rax
+  80417a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80417e:	49 bd 74 2a 80 00 00 	movabs $0x802a74,%r13
+  804185:	00 00 00 
+            sys_yield();
+  804188:	49 be 05 2a 80 00 00 	movabs $0x802a05,%r14
+  80418f:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804192:	8b 73 04             	mov    0x4(%rbx),%esi
+  804195:	48 63 ce             	movslq %esi,%rcx
+  804198:	48 63 03             	movslq (%rbx),%rax
+  80419b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8041a1:	48 39 c1             	cmp    %rax,%rcx
+  8041a4:	72 2e                	jb     8041d4 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041a6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8041ab:	48 89 da             	mov    %rbx,%rdx
+  8041ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041b3:	4c 89 e7             	mov    %r12,%rdi
+  8041b6:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8041b9:	85 c0                	test   %eax,%eax
+  8041bb:	74 66                	je     804223 <devpipe_write+0xe8>
+            sys_yield();
+  8041bd:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8041c0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8041c3:	48 63 ce             	movslq %esi,%rcx
+  8041c6:	48 63 03             	movslq (%rbx),%rax
+  8041c9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8041cf:	48 39 c1             	cmp    %rax,%rcx
+  8041d2:	73 d2                	jae    8041a6 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041d4:	41 0f b6 3f          	movzbl (%r15),%edi
+  8041d8:	48 89 ca             	mov    %rcx,%rdx
+  8041db:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041df:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8041e6:	08 10 20 
+  8041e9:	48 f7 e2             	mul    %rdx
+  8041ec:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041f0:	48 89 d0             	mov    %rdx,%rax
+  8041f3:	48 c1 e0 09          	shl    $0x9,%rax
+  8041f7:	48 29 d0             	sub    %rdx,%rax
+  8041fa:	48 c1 e0 03          	shl    $0x3,%rax
+  8041fe:	48 29 c1             	sub    %rax,%rcx
+  804201:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804206:	83 c6 01             	add    $0x1,%esi
+  804209:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80420c:	49 83 c7 01          	add    $0x1,%r15
+  804210:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804214:	49 39 c7             	cmp    %rax,%r15
+  804217:	0f 85 75 ff ff ff    	jne    804192 <devpipe_write+0x57>
+    return n;
+  80421d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804221:	eb 05                	jmp    804228 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804223:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804228:	48 83 c4 18          	add    $0x18,%rsp
+  80422c:	5b                   	pop    %rbx
+  80422d:	41 5c                	pop    %r12
+  80422f:	41 5d                	pop    %r13
+  804231:	41 5e                	pop    %r14
+  804233:	41 5f                	pop    %r15
+  804235:	5d                   	pop    %rbp
+  804236:	c3                   	ret
+
+0000000000804237 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804237:	55                   	push   %rbp
+  804238:	48 89 e5             	mov    %rsp,%rbp
+  80423b:	41 57                	push   %r15
+  80423d:	41 56                	push   %r14
+  80423f:	41 55                	push   %r13
+  804241:	41 54                	push   %r12
+  804243:	53                   	push   %rbx
+  804244:	48 83 ec 18          	sub    $0x18,%rsp
+  804248:	49 89 fc             	mov    %rdi,%r12
+  80424b:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80424f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804253:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  80425a:	00 00 00 
+  80425d:	ff d0                	call   *%rax
+  80425f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804262:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804268:	49 bd 74 2a 80 00 00 	movabs $0x802a74,%r13
+  80426f:	00 00 00 
+            sys_yield();
+  804272:	49 be 05 2a 80 00 00 	movabs $0x802a05,%r14
+  804279:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80427c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804281:	74 7d                	je     804300 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804283:	8b 03                	mov    (%rbx),%eax
+  804285:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804288:	75 26                	jne    8042b0 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80428a:	4d 85 ff             	test   %r15,%r15
+  80428d:	75 77                	jne    804306 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80428f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804294:	48 89 da             	mov    %rbx,%rdx
+  804297:	be 00 10 00 00       	mov    $0x1000,%esi
+  80429c:	4c 89 e7             	mov    %r12,%rdi
+  80429f:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8042a2:	85 c0                	test   %eax,%eax
+  8042a4:	74 72                	je     804318 <devpipe_read+0xe1>
+            sys_yield();
+  8042a6:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8042a9:	8b 03                	mov    (%rbx),%eax
+  8042ab:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8042ae:	74 df                	je     80428f <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8042b0:	48 63 c8             	movslq %eax,%rcx
+  8042b3:	48 89 ca             	mov    %rcx,%rdx
+  8042b6:	48 c1 ea 03          	shr    $0x3,%rdx
+  8042ba:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8042c1:	08 10 20 
+  8042c4:	48 89 d0             	mov    %rdx,%rax
+  8042c7:	48 f7 e6             	mul    %rsi
+  8042ca:	48 c1 ea 06          	shr    $0x6,%rdx
+  8042ce:	48 89 d0             	mov    %rdx,%rax
+  8042d1:	48 c1 e0 09          	shl    $0x9,%rax
+  8042d5:	48 29 d0             	sub    %rdx,%rax
+  8042d8:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8042df:	00 
+  8042e0:	48 89 c8             	mov    %rcx,%rax
+  8042e3:	48 29 d0             	sub    %rdx,%rax
+  8042e6:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8042eb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042ef:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8042f3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042f6:	49 83 c7 01          	add    $0x1,%r15
+  8042fa:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8042fe:	75 83                	jne    804283 <devpipe_read+0x4c>
+    return n;
+  804300:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804304:	eb 03                	jmp    804309 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804306:	4c 89 f8             	mov    %r15,%rax
+}
+  804309:	48 83 c4 18          	add    $0x18,%rsp
+  80430d:	5b                   	pop    %rbx
+  80430e:	41 5c                	pop    %r12
+  804310:	41 5d                	pop    %r13
+  804312:	41 5e                	pop    %r14
+  804314:	41 5f                	pop    %r15
+  804316:	5d                   	pop    %rbp
+  804317:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431d:	eb ea                	jmp    804309 <devpipe_read+0xd2>
+
+000000000080431f <pipe>:
+pipe(int pfd[2]) {
+  80431f:	55                   	push   %rbp
+  804320:	48 89 e5             	mov    %rsp,%rbp
+  804323:	41 55                	push   %r13
+  804325:	41 54                	push   %r12
+  804327:	53                   	push   %rbx
+  804328:	48 83 ec 18          	sub    $0x18,%rsp
+  80432c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80432f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804333:	48 b8 32 31 80 00 00 	movabs $0x803132,%rax
+  80433a:	00 00 00 
+  80433d:	ff d0                	call   *%rax
+  80433f:	89 c3                	mov    %eax,%ebx
+  804341:	85 c0                	test   %eax,%eax
+  804343:	0f 88 a0 01 00 00    	js     8044e9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80434e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804353:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80435c:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  804363:	00 00 00 
+  804366:	ff d0                	call   *%rax
+  804368:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80436a:	85 c0                	test   %eax,%eax
+  80436c:	0f 88 77 01 00 00    	js     8044e9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804372:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804376:	48 b8 32 31 80 00 00 	movabs $0x803132,%rax
+  80437d:	00 00 00 
+  804380:	ff d0                	call   *%rax
+  804382:	89 c3                	mov    %eax,%ebx
+  804384:	85 c0                	test   %eax,%eax
+  804386:	0f 88 43 01 00 00    	js     8044cf <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80438c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804391:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804396:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80439a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80439f:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  8043a6:	00 00 00 
+  8043a9:	ff d0                	call   *%rax
+  8043ab:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8043ad:	85 c0                	test   %eax,%eax
+  8043af:	0f 88 1a 01 00 00    	js     8044cf <pipe+0x1b0>
+    va = fd2data(fd0);
+  8043b5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043b9:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  8043c0:	00 00 00 
+  8043c3:	ff d0                	call   *%rax
+  8043c5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8043c8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043d2:	48 89 c6             	mov    %rax,%rsi
+  8043d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043da:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+  8043e6:	89 c3                	mov    %eax,%ebx
+  8043e8:	85 c0                	test   %eax,%eax
+  8043ea:	0f 88 c5 00 00 00    	js     8044b5 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043f0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043f4:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  8043fb:	00 00 00 
+  8043fe:	ff d0                	call   *%rax
+  804400:	48 89 c1             	mov    %rax,%rcx
+  804403:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804409:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80440f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804414:	4c 89 ee             	mov    %r13,%rsi
+  804417:	bf 00 00 00 00       	mov    $0x0,%edi
+  80441c:	48 b8 13 2b 80 00 00 	movabs $0x802b13,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+  804428:	89 c3                	mov    %eax,%ebx
+  80442a:	85 c0                	test   %eax,%eax
+  80442c:	78 6e                	js     80449c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80442e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804433:	4c 89 ef             	mov    %r13,%rdi
+  804436:	48 b8 3c 2a 80 00 00 	movabs $0x802a3c,%rax
+  80443d:	00 00 00 
+  804440:	ff d0                	call   *%rax
+  804442:	83 f8 02             	cmp    $0x2,%eax
+  804445:	0f 85 ab 00 00 00    	jne    8044f6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80444b:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804452:	00 00 
+  804454:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804458:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80445a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80445e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804465:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804469:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80446b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80446f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804476:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80447a:	48 bb 04 31 80 00 00 	movabs $0x803104,%rbx
+  804481:	00 00 00 
+  804484:	ff d3                	call   *%rbx
+  804486:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80448a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80448e:	ff d3                	call   *%rbx
+  804490:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804495:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80449a:	eb 4d                	jmp    8044e9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80449c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044a1:	4c 89 ee             	mov    %r13,%rsi
+  8044a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a9:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  8044b0:	00 00 00 
+  8044b3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8044b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044ba:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044c3:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8044cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044d4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044dd:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  8044e4:	00 00 00 
+  8044e7:	ff d0                	call   *%rax
+}
+  8044e9:	89 d8                	mov    %ebx,%eax
+  8044eb:	48 83 c4 18          	add    $0x18,%rsp
+  8044ef:	5b                   	pop    %rbx
+  8044f0:	41 5c                	pop    %r12
+  8044f2:	41 5d                	pop    %r13
+  8044f4:	5d                   	pop    %rbp
+  8044f5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044f6:	48 b9 68 66 80 00 00 	movabs $0x806668,%rcx
+  8044fd:	00 00 00 
+  804500:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  804507:	00 00 00 
+  80450a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80450f:	48 bf 57 66 80 00 00 	movabs $0x806657,%rdi
+  804516:	00 00 00 
+  804519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451e:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  804525:	00 00 00 
+  804528:	41 ff d0             	call   *%r8
+
+000000000080452b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80452b:	55                   	push   %rbp
+  80452c:	48 89 e5             	mov    %rsp,%rbp
+  80452f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804533:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804537:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  80453e:	00 00 00 
+  804541:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804543:	85 c0                	test   %eax,%eax
+  804545:	78 35                	js     80457c <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804547:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80454b:	48 b8 16 31 80 00 00 	movabs $0x803116,%rax
+  804552:	00 00 00 
+  804555:	ff d0                	call   *%rax
+  804557:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80455a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80455f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804564:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804568:	48 b8 74 2a 80 00 00 	movabs $0x802a74,%rax
+  80456f:	00 00 00 
+  804572:	ff d0                	call   *%rax
+  804574:	85 c0                	test   %eax,%eax
+  804576:	0f 94 c0             	sete   %al
+  804579:	0f b6 c0             	movzbl %al,%eax
+}
+  80457c:	c9                   	leave
+  80457d:	c3                   	ret
+
+000000000080457e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80457e:	48 89 f8             	mov    %rdi,%rax
+  804581:	48 c1 e8 27          	shr    $0x27,%rax
+  804585:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80458c:	01 00 00 
+  80458f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804593:	f6 c2 01             	test   $0x1,%dl
+  804596:	74 6d                	je     804605 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804598:	48 89 f8             	mov    %rdi,%rax
+  80459b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80459f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045a6:	01 00 00 
+  8045a9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045ad:	f6 c2 01             	test   $0x1,%dl
+  8045b0:	74 62                	je     804614 <get_uvpt_entry+0x96>
+  8045b2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045b9:	01 00 00 
+  8045bc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045c0:	f6 c2 80             	test   $0x80,%dl
+  8045c3:	75 4f                	jne    804614 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045c5:	48 89 f8             	mov    %rdi,%rax
+  8045c8:	48 c1 e8 15          	shr    $0x15,%rax
+  8045cc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045d3:	01 00 00 
+  8045d6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045da:	f6 c2 01             	test   $0x1,%dl
+  8045dd:	74 44                	je     804623 <get_uvpt_entry+0xa5>
+  8045df:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045e6:	01 00 00 
+  8045e9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045ed:	f6 c2 80             	test   $0x80,%dl
+  8045f0:	75 31                	jne    804623 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045f2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045f6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045fd:	01 00 00 
+  804600:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804604:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804605:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80460c:	01 00 00 
+  80460f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804613:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804614:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80461b:	01 00 00 
+  80461e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804622:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804623:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80462a:	01 00 00 
+  80462d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804631:	c3                   	ret
+
+0000000000804632 <get_prot>:
+
+int
+get_prot(void *va) {
+  804632:	55                   	push   %rbp
+  804633:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804636:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  80463d:	00 00 00 
+  804640:	ff d0                	call   *%rax
+  804642:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804645:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80464a:	89 c1                	mov    %eax,%ecx
+  80464c:	83 c9 04             	or     $0x4,%ecx
+  80464f:	f6 c2 01             	test   $0x1,%dl
+  804652:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804655:	89 c1                	mov    %eax,%ecx
+  804657:	83 c9 02             	or     $0x2,%ecx
+  80465a:	f6 c2 02             	test   $0x2,%dl
+  80465d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804660:	89 c1                	mov    %eax,%ecx
+  804662:	83 c9 01             	or     $0x1,%ecx
+  804665:	48 85 d2             	test   %rdx,%rdx
+  804668:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80466b:	89 c1                	mov    %eax,%ecx
+  80466d:	83 c9 40             	or     $0x40,%ecx
+  804670:	f6 c6 04             	test   $0x4,%dh
+  804673:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804676:	5d                   	pop    %rbp
+  804677:	c3                   	ret
+
+0000000000804678 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804678:	55                   	push   %rbp
+  804679:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80467c:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  804683:	00 00 00 
+  804686:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804688:	48 c1 e8 06          	shr    $0x6,%rax
+  80468c:	83 e0 01             	and    $0x1,%eax
+}
+  80468f:	5d                   	pop    %rbp
+  804690:	c3                   	ret
+
+0000000000804691 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804691:	55                   	push   %rbp
+  804692:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804695:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  80469c:	00 00 00 
+  80469f:	ff d0                	call   *%rax
+  8046a1:	83 e0 01             	and    $0x1,%eax
+}
+  8046a4:	5d                   	pop    %rbp
+  8046a5:	c3                   	ret
+
+00000000008046a6 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8046a6:	55                   	push   %rbp
+  8046a7:	48 89 e5             	mov    %rsp,%rbp
+  8046aa:	41 57                	push   %r15
+  8046ac:	41 56                	push   %r14
+  8046ae:	41 55                	push   %r13
+  8046b0:	41 54                	push   %r12
+  8046b2:	53                   	push   %rbx
+  8046b3:	48 83 ec 28          	sub    $0x28,%rsp
+  8046b7:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8046bb:	48 85 ff             	test   %rdi,%rdi
+  8046be:	74 1e                	je     8046de <foreach_shared_region+0x38>
+  8046c0:	49 89 ff             	mov    %rdi,%r15
+  8046c3:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8046c9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8046cf:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8046d6:	01 00 00 
+  8046d9:	e9 72 02 00 00       	jmp    804950 <foreach_shared_region+0x2aa>
+    assert(fun);
+  8046de:	48 b9 8c 66 80 00 00 	movabs $0x80668c,%rcx
+  8046e5:	00 00 00 
+  8046e8:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  8046ef:	00 00 00 
+  8046f2:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8046f7:	48 bf 90 66 80 00 00 	movabs $0x806690,%rdi
+  8046fe:	00 00 00 
+  804701:	b8 00 00 00 00       	mov    $0x0,%eax
+  804706:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  80470d:	00 00 00 
+  804710:	41 ff d0             	call   *%r8
+  804713:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80471a:	eb 6c                	jmp    804788 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80471c:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804723:	ff ff ff 
+  804726:	4c 21 e2             	and    %r12,%rdx
+  804729:	48 89 d8             	mov    %rbx,%rax
+  80472c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804731:	48 83 c0 01          	add    $0x1,%rax
+  804735:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804739:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804740:	00 00 00 
+  804743:	48 21 c8             	and    %rcx,%rax
+  804746:	48 09 d0             	or     %rdx,%rax
+  804749:	49 89 c4             	mov    %rax,%r12
+  80474c:	eb 30                	jmp    80477e <foreach_shared_region+0xd8>
+  80474e:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804755:	ff ff ff 
+  804758:	4c 21 e2             	and    %r12,%rdx
+  80475b:	48 89 d8             	mov    %rbx,%rax
+  80475e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804763:	48 83 c0 01          	add    $0x1,%rax
+  804767:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80476b:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804772:	00 00 00 
+  804775:	48 21 c8             	and    %rcx,%rax
+  804778:	48 09 d0             	or     %rdx,%rax
+  80477b:	49 89 c4             	mov    %rax,%r12
+  80477e:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804782:	0f 84 99 01 00 00    	je     804921 <foreach_shared_region+0x27b>
+  804788:	4c 89 e3             	mov    %r12,%rbx
+  80478b:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80478f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804796:	01 00 00 
+  804799:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80479d:	a8 01                	test   $0x1,%al
+  80479f:	0f 84 77 ff ff ff    	je     80471c <foreach_shared_region+0x76>
+  8047a5:	a8 80                	test   $0x80,%al
+  8047a7:	74 19                	je     8047c2 <foreach_shared_region+0x11c>
+  8047a9:	f6 c4 04             	test   $0x4,%ah
+  8047ac:	74 a0                	je     80474e <foreach_shared_region+0xa8>
+  8047ae:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8047b5:	40 
+  8047b6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8047ba:	4c 89 e7             	mov    %r12,%rdi
+  8047bd:	41 ff d7             	call   *%r15
+  8047c0:	eb 8c                	jmp    80474e <foreach_shared_region+0xa8>
+  8047c2:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8047c9:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8047cd:	eb 46                	jmp    804815 <foreach_shared_region+0x16f>
+  8047cf:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047d6:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047dc:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047e0:	48 c1 e0 15          	shl    $0x15,%rax
+  8047e4:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047e9:	49 09 c4             	or     %rax,%r12
+  8047ec:	eb 1d                	jmp    80480b <foreach_shared_region+0x165>
+  8047ee:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047f5:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047fb:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047ff:	48 c1 e0 15          	shl    $0x15,%rax
+  804803:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804808:	49 09 c4             	or     %rax,%r12
+  80480b:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80480f:	0f 84 d3 00 00 00    	je     8048e8 <foreach_shared_region+0x242>
+  804815:	4c 89 e3             	mov    %r12,%rbx
+  804818:	48 c1 eb 15          	shr    $0x15,%rbx
+  80481c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804823:	01 00 00 
+  804826:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80482a:	a8 01                	test   $0x1,%al
+  80482c:	74 a1                	je     8047cf <foreach_shared_region+0x129>
+  80482e:	a8 80                	test   $0x80,%al
+  804830:	74 19                	je     80484b <foreach_shared_region+0x1a5>
+  804832:	f6 c4 04             	test   $0x4,%ah
+  804835:	74 b7                	je     8047ee <foreach_shared_region+0x148>
+  804837:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80483e:	00 
+  80483f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804843:	4c 89 e7             	mov    %r12,%rdi
+  804846:	41 ff d7             	call   *%r15
+  804849:	eb a3                	jmp    8047ee <foreach_shared_region+0x148>
+  80484b:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804851:	eb 3b                	jmp    80488e <foreach_shared_region+0x1e8>
+  804853:	f6 c4 04             	test   $0x4,%ah
+  804856:	74 12                	je     80486a <foreach_shared_region+0x1c4>
+  804858:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80485f:	00 
+  804860:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804864:	4c 89 e7             	mov    %r12,%rdi
+  804867:	41 ff d7             	call   *%r15
+  80486a:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804871:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804877:	48 83 c3 01          	add    $0x1,%rbx
+  80487b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80487f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804885:	49 09 dc             	or     %rbx,%r12
+  804888:	41 83 ed 01          	sub    $0x1,%r13d
+  80488c:	74 2f                	je     8048bd <foreach_shared_region+0x217>
+  80488e:	4c 89 e3             	mov    %r12,%rbx
+  804891:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804895:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804899:	a8 01                	test   $0x1,%al
+  80489b:	75 b6                	jne    804853 <foreach_shared_region+0x1ad>
+  80489d:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8048a4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8048aa:	48 83 c3 01          	add    $0x1,%rbx
+  8048ae:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8048b2:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8048b8:	49 09 dc             	or     %rbx,%r12
+  8048bb:	eb cb                	jmp    804888 <foreach_shared_region+0x1e2>
+  8048bd:	4c 89 e0             	mov    %r12,%rax
+  8048c0:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8048c6:	49 c1 ec 15          	shr    $0x15,%r12
+  8048ca:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048d1:	49 83 c4 01          	add    $0x1,%r12
+  8048d5:	49 c1 e4 15          	shl    $0x15,%r12
+  8048d9:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8048e0:	49 09 c4             	or     %rax,%r12
+  8048e3:	e9 23 ff ff ff       	jmp    80480b <foreach_shared_region+0x165>
+  8048e8:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8048ec:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8048f3:	ff ff ff 
+  8048f6:	4c 21 e0             	and    %r12,%rax
+  8048f9:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8048fd:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804904:	49 83 c4 01          	add    $0x1,%r12
+  804908:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80490c:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804913:	00 00 00 
+  804916:	49 21 d4             	and    %rdx,%r12
+  804919:	49 09 c4             	or     %rax,%r12
+  80491c:	e9 5d fe ff ff       	jmp    80477e <foreach_shared_region+0xd8>
+  804921:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804928:	00 ff ff 
+  80492b:	4c 21 e0             	and    %r12,%rax
+  80492e:	49 c1 ec 27          	shr    $0x27,%r12
+  804932:	49 83 c4 01          	add    $0x1,%r12
+  804936:	49 c1 e4 27          	shl    $0x27,%r12
+  80493a:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804941:	ff 00 00 
+  804944:	49 21 d4             	and    %rdx,%r12
+  804947:	49 09 c4             	or     %rax,%r12
+  80494a:	41 83 ed 01          	sub    $0x1,%r13d
+  80494e:	74 48                	je     804998 <foreach_shared_region+0x2f2>
+  804950:	4c 89 e0             	mov    %r12,%rax
+  804953:	48 c1 e8 27          	shr    $0x27,%rax
+  804957:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80495e:	01 00 00 
+  804961:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804965:	f6 c2 01             	test   $0x1,%dl
+  804968:	0f 85 a5 fd ff ff    	jne    804713 <foreach_shared_region+0x6d>
+  80496e:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804975:	00 ff ff 
+  804978:	4c 21 e2             	and    %r12,%rdx
+  80497b:	48 83 c0 01          	add    $0x1,%rax
+  80497f:	48 c1 e0 27          	shl    $0x27,%rax
+  804983:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  80498a:	ff 00 00 
+  80498d:	48 21 c8             	and    %rcx,%rax
+  804990:	48 09 d0             	or     %rdx,%rax
+  804993:	49 89 c4             	mov    %rax,%r12
+  804996:	eb b2                	jmp    80494a <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804998:	4d 85 e4             	test   %r12,%r12
+  80499b:	75 14                	jne    8049b1 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80499d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a2:	48 83 c4 28          	add    $0x28,%rsp
+  8049a6:	5b                   	pop    %rbx
+  8049a7:	41 5c                	pop    %r12
+  8049a9:	41 5d                	pop    %r13
+  8049ab:	41 5e                	pop    %r14
+  8049ad:	41 5f                	pop    %r15
+  8049af:	5d                   	pop    %rbp
+  8049b0:	c3                   	ret
+    assert(addr == 0);
+  8049b1:	48 b9 9b 66 80 00 00 	movabs $0x80669b,%rcx
+  8049b8:	00 00 00 
+  8049bb:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  8049c2:	00 00 00 
+  8049c5:	be 67 00 00 00       	mov    $0x67,%esi
+  8049ca:	48 bf 90 66 80 00 00 	movabs $0x806690,%rdi
+  8049d1:	00 00 00 
+  8049d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d9:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  8049e0:	00 00 00 
+  8049e3:	41 ff d0             	call   *%r8
+
+00000000008049e6 <vsys_gettime>:
+    // LAB 12: Your code here DONE
+    if (num < 0 || num >= NVSYSCALLS) {
+        return -E_NO_SYS;
+    }
+
+    return vsys[num];
+  8049e6:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  8049ed:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  8049ef:	c3                   	ret
+
+00000000008049f0 <vsys_gettimems>:
+    return vsys[num];
+  8049f0:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  8049f7:	00 00 
+
+uint32_t
+vsys_gettimems() {
+    return (uint32_t)vsyscall(VSYS_gettimems);
+}
+  8049f9:	c3                   	ret
+
+00000000008049fa <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8049fa:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804a01:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804a04:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804a0a:	eb 33                	jmp    804a3f <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a0c:	48 83 c0 20          	add    $0x20,%rax
+  804a10:	4c 39 c0             	cmp    %r8,%rax
+  804a13:	74 25                	je     804a3a <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804a15:	48 8b 10             	mov    (%rax),%rdx
+  804a18:	48 85 d2             	test   %rdx,%rdx
+  804a1b:	74 ef                	je     804a0c <mmap_place+0x12>
+  804a1d:	48 89 d1             	mov    %rdx,%rcx
+  804a20:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a24:	48 39 cf             	cmp    %rcx,%rdi
+  804a27:	73 e3                	jae    804a0c <mmap_place+0x12>
+  804a29:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804a2d:	4c 39 ca             	cmp    %r9,%rdx
+  804a30:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804a34:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804a38:	eb d2                	jmp    804a0c <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804a3a:	45 84 d2             	test   %r10b,%r10b
+  804a3d:	74 12                	je     804a51 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a3f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a46:	00 00 00 
+        moved = 0;
+  804a49:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a4f:	eb c4                	jmp    804a15 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a51:	48 01 fe             	add    %rdi,%rsi
+  804a54:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804a5b:	00 00 00 
+  804a5e:	48 39 f0             	cmp    %rsi,%rax
+  804a61:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a66:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804a6a:	c3                   	ret
+
+0000000000804a6b <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804a6b:	55                   	push   %rbp
+  804a6c:	48 89 e5             	mov    %rsp,%rbp
+  804a6f:	41 57                	push   %r15
+  804a71:	41 56                	push   %r14
+  804a73:	41 55                	push   %r13
+  804a75:	41 54                	push   %r12
+  804a77:	53                   	push   %rbx
+  804a78:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804a7c:	48 8b 1f             	mov    (%rdi),%rbx
+  804a7f:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a86:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a8d:	00 00 00 
+  804a90:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a95:	eb 12                	jmp    804aa9 <mmap_pgfault+0x3e>
+  804a97:	48 83 c2 01          	add    $0x1,%rdx
+  804a9b:	48 83 c0 20          	add    $0x20,%rax
+  804a9f:	48 83 fa 20          	cmp    $0x20,%rdx
+  804aa3:	0f 84 04 01 00 00    	je     804bad <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804aa9:	48 8b 08             	mov    (%rax),%rcx
+  804aac:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804ab0:	48 39 de             	cmp    %rbx,%rsi
+  804ab3:	73 e2                	jae    804a97 <mmap_pgfault+0x2c>
+  804ab5:	48 03 48 08          	add    0x8(%rax),%rcx
+  804ab9:	48 39 cb             	cmp    %rcx,%rbx
+  804abc:	73 d9                	jae    804a97 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804abe:	48 c1 e2 05          	shl    $0x5,%rdx
+  804ac2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804ac9:	00 00 00 
+  804acc:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804ad0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804ad4:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804ad8:	f6 c2 01             	test   $0x1,%dl
+  804adb:	0f 84 e0 00 00 00    	je     804bc1 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae6:	f6 c2 02             	test   $0x2,%dl
+  804ae9:	0f 84 c3 00 00 00    	je     804bb2 <mmap_pgfault+0x147>
+  804aef:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804af6:	ff ff ff 
+  804af9:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804afd:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804b04:	00 00 00 
+  804b07:	48 39 ca             	cmp    %rcx,%rdx
+  804b0a:	0f 85 a2 00 00 00    	jne    804bb2 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804b10:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804b15:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b1a:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804b21:	00 00 00 
+  804b24:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b29:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  804b30:	00 00 00 
+  804b33:	ff d0                	call   *%rax
+  804b35:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3c:	85 d2                	test   %edx,%edx
+  804b3e:	78 72                	js     804bb2 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804b40:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b45:	48 89 de             	mov    %rbx,%rsi
+  804b48:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b4f:	00 00 00 
+  804b52:	4c 89 e7             	mov    %r12,%rdi
+  804b55:	48 b8 f8 26 80 00 00 	movabs $0x8026f8,%rax
+  804b5c:	00 00 00 
+  804b5f:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804b61:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804b67:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b6d:	48 89 d9             	mov    %rbx,%rcx
+  804b70:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b75:	4c 89 e6             	mov    %r12,%rsi
+  804b78:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b7d:	48 b8 13 2b 80 00 00 	movabs $0x802b13,%rax
+  804b84:	00 00 00 
+  804b87:	ff d0                	call   *%rax
+  804b89:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804b8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b90:	4c 89 e6             	mov    %r12,%rsi
+  804b93:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b98:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  804b9f:	00 00 00 
+  804ba2:	ff d0                	call   *%rax
+    return res >= 0;
+  804ba4:	89 d8                	mov    %ebx,%eax
+  804ba6:	f7 d0                	not    %eax
+  804ba8:	c1 e8 1f             	shr    $0x1f,%eax
+  804bab:	eb 05                	jmp    804bb2 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804bad:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804bb2:	48 83 c4 18          	add    $0x18,%rsp
+  804bb6:	5b                   	pop    %rbx
+  804bb7:	41 5c                	pop    %r12
+  804bb9:	41 5d                	pop    %r13
+  804bbb:	41 5e                	pop    %r14
+  804bbd:	41 5f                	pop    %r15
+  804bbf:	5d                   	pop    %rbp
+  804bc0:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804bc1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bc5:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804bc9:	4c 03 30             	add    (%rax),%r14
+  804bcc:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804bd3:	49 39 c6             	cmp    %rax,%r14
+  804bd6:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bda:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804be1:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804be7:	49 bf 91 46 80 00 00 	movabs $0x804691,%r15
+  804bee:	00 00 00 
+  804bf1:	4d 39 f4             	cmp    %r14,%r12
+  804bf4:	73 1d                	jae    804c13 <mmap_pgfault+0x1a8>
+  804bf6:	4c 89 e7             	mov    %r12,%rdi
+  804bf9:	41 ff d7             	call   *%r15
+  804bfc:	84 c0                	test   %al,%al
+  804bfe:	75 13                	jne    804c13 <mmap_pgfault+0x1a8>
+  804c00:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804c07:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804c0e:	4d 39 f4             	cmp    %r14,%r12
+  804c11:	72 e3                	jb     804bf6 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c13:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804c19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c1d:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804c21:	74 2a                	je     804c4d <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804c23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c27:	89 de                	mov    %ebx,%esi
+  804c29:	2b 30                	sub    (%rax),%esi
+  804c2b:	03 70 1c             	add    0x1c(%rax),%esi
+  804c2e:	8b 78 18             	mov    0x18(%rax),%edi
+  804c31:	4c 89 e9             	mov    %r13,%rcx
+  804c34:	48 89 da             	mov    %rbx,%rdx
+  804c37:	48 b8 ef 3d 80 00 00 	movabs $0x803def,%rax
+  804c3e:	00 00 00 
+  804c41:	ff d0                	call   *%rax
+    return res > 0;
+  804c43:	85 c0                	test   %eax,%eax
+  804c45:	0f 9f c0             	setg   %al
+  804c48:	e9 65 ff ff ff       	jmp    804bb2 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c4d:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c51:	eb d0                	jmp    804c23 <mmap_pgfault+0x1b8>
+
+0000000000804c53 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c53:	55                   	push   %rbp
+  804c54:	48 89 e5             	mov    %rsp,%rbp
+  804c57:	41 57                	push   %r15
+  804c59:	41 56                	push   %r14
+  804c5b:	41 55                	push   %r13
+  804c5d:	41 54                	push   %r12
+  804c5f:	53                   	push   %rbx
+  804c60:	48 83 ec 28          	sub    $0x28,%rsp
+  804c64:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804c68:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804c6b:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c72:	ff ff ff 
+  804c75:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804c79:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7e:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804c85:	00 00 00 
+  804c88:	48 39 ca             	cmp    %rcx,%rdx
+  804c8b:	0f 85 e5 00 00 00    	jne    804d76 <mmap_writeback+0x123>
+  804c91:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804c94:	4c 39 ee             	cmp    %r13,%rsi
+  804c97:	0f 83 e8 00 00 00    	jae    804d85 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c9d:	49 be 91 46 80 00 00 	movabs $0x804691,%r14
+  804ca4:	00 00 00 
+  804ca7:	49 bf 78 46 80 00 00 	movabs $0x804678,%r15
+  804cae:	00 00 00 
+  804cb1:	eb 10                	jmp    804cc3 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804cb3:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804cba:	4d 39 ec             	cmp    %r13,%r12
+  804cbd:	0f 83 ae 00 00 00    	jae    804d71 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804cc3:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804cc7:	4c 89 e7             	mov    %r12,%rdi
+  804cca:	41 ff d6             	call   *%r14
+  804ccd:	84 c0                	test   %al,%al
+  804ccf:	74 e2                	je     804cb3 <mmap_writeback+0x60>
+  804cd1:	4c 89 e7             	mov    %r12,%rdi
+  804cd4:	41 ff d7             	call   *%r15
+  804cd7:	84 c0                	test   %al,%al
+  804cd9:	74 d8                	je     804cb3 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804cdb:	4c 89 e3             	mov    %r12,%rbx
+  804cde:	4d 39 ec             	cmp    %r13,%r12
+  804ce1:	73 20                	jae    804d03 <mmap_writeback+0xb0>
+  804ce3:	48 89 df             	mov    %rbx,%rdi
+  804ce6:	41 ff d6             	call   *%r14
+  804ce9:	84 c0                	test   %al,%al
+  804ceb:	74 16                	je     804d03 <mmap_writeback+0xb0>
+  804ced:	48 89 df             	mov    %rbx,%rdi
+  804cf0:	41 ff d7             	call   *%r15
+  804cf3:	84 c0                	test   %al,%al
+  804cf5:	74 0c                	je     804d03 <mmap_writeback+0xb0>
+  804cf7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804cfe:	4c 39 eb             	cmp    %r13,%rbx
+  804d01:	72 e0                	jb     804ce3 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804d03:	48 89 d9             	mov    %rbx,%rcx
+  804d06:	4c 29 e1             	sub    %r12,%rcx
+  804d09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804d0d:	44 89 e6             	mov    %r12d,%esi
+  804d10:	2b 30                	sub    (%rax),%esi
+  804d12:	49 89 c4             	mov    %rax,%r12
+  804d15:	03 70 1c             	add    0x1c(%rax),%esi
+  804d18:	8b 78 18             	mov    0x18(%rax),%edi
+  804d1b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804d1f:	48 89 ca             	mov    %rcx,%rdx
+  804d22:	48 b8 78 3e 80 00 00 	movabs $0x803e78,%rax
+  804d29:	00 00 00 
+  804d2c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d2e:	85 c0                	test   %eax,%eax
+  804d30:	78 44                	js     804d76 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804d32:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804d37:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804d3a:	41 89 c1             	mov    %eax,%r9d
+  804d3d:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804d44:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d48:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d51:	48 89 ce             	mov    %rcx,%rsi
+  804d54:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d59:	48 b8 13 2b 80 00 00 	movabs $0x802b13,%rax
+  804d60:	00 00 00 
+  804d63:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804d65:	85 c0                	test   %eax,%eax
+  804d67:	78 0d                	js     804d76 <mmap_writeback+0x123>
+  804d69:	49 89 dc             	mov    %rbx,%r12
+  804d6c:	e9 49 ff ff ff       	jmp    804cba <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804d71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d76:	48 83 c4 28          	add    $0x28,%rsp
+  804d7a:	5b                   	pop    %rbx
+  804d7b:	41 5c                	pop    %r12
+  804d7d:	41 5d                	pop    %r13
+  804d7f:	41 5e                	pop    %r14
+  804d81:	41 5f                	pop    %r15
+  804d83:	5d                   	pop    %rbp
+  804d84:	c3                   	ret
+    return 0;
+  804d85:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d8a:	eb ea                	jmp    804d76 <mmap_writeback+0x123>
+
+0000000000804d8c <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804d8c:	55                   	push   %rbp
+  804d8d:	48 89 e5             	mov    %rsp,%rbp
+  804d90:	41 57                	push   %r15
+  804d92:	41 56                	push   %r14
+  804d94:	41 55                	push   %r13
+  804d96:	41 54                	push   %r12
+  804d98:	53                   	push   %rbx
+  804d99:	48 83 ec 38          	sub    $0x38,%rsp
+  804d9d:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804da1:	48 85 f6             	test   %rsi,%rsi
+  804da4:	0f 84 0c 02 00 00    	je     804fb6 <mmap+0x22a>
+  804daa:	49 89 ff             	mov    %rdi,%r15
+  804dad:	49 89 f4             	mov    %rsi,%r12
+  804db0:	41 89 d5             	mov    %edx,%r13d
+  804db3:	41 89 ce             	mov    %ecx,%r14d
+  804db6:	44 89 cb             	mov    %r9d,%ebx
+  804db9:	45 85 c9             	test   %r9d,%r9d
+  804dbc:	0f 88 f4 01 00 00    	js     804fb6 <mmap+0x22a>
+  804dc2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dc9:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804dd0:	0f 85 e7 01 00 00    	jne    804fbd <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804dd6:	83 e2 fd             	and    $0xfffffffd,%edx
+  804dd9:	83 fa 04             	cmp    $0x4,%edx
+  804ddc:	0f 85 db 01 00 00    	jne    804fbd <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804de2:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804de5:	83 fa 01             	cmp    $0x1,%edx
+  804de8:	0f 87 cf 01 00 00    	ja     804fbd <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804dee:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804df2:	44 89 c7             	mov    %r8d,%edi
+  804df5:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  804dfc:	00 00 00 
+  804dff:	ff d0                	call   *%rax
+  804e01:	89 c2                	mov    %eax,%edx
+  804e03:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e0a:	85 d2                	test   %edx,%edx
+  804e0c:	0f 88 ab 01 00 00    	js     804fbd <mmap+0x231>
+  804e12:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e16:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804e1d:	00 00 00 
+  804e20:	8b 09                	mov    (%rcx),%ecx
+  804e22:	39 0a                	cmp    %ecx,(%rdx)
+  804e24:	0f 85 93 01 00 00    	jne    804fbd <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804e2a:	8b 52 08             	mov    0x8(%rdx),%edx
+  804e2d:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804e30:	83 fa 01             	cmp    $0x1,%edx
+  804e33:	0f 84 84 01 00 00    	je     804fbd <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e39:	41 83 fe 01          	cmp    $0x1,%r14d
+  804e3d:	74 42                	je     804e81 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804e3f:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804e46:	4c 89 e6             	mov    %r12,%rsi
+  804e49:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e50:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804e54:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804e58:	4d 85 ff             	test   %r15,%r15
+  804e5b:	74 67                	je     804ec4 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e5d:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804e64:	75 0f                	jne    804e75 <mmap+0xe9>
+  804e66:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804e6d:	00 00 00 
+  804e70:	49 39 c7             	cmp    %rax,%r15
+  804e73:	77 1b                	ja     804e90 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e75:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e7c:	e9 3c 01 00 00       	jmp    804fbd <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e81:	41 f6 c5 02          	test   $0x2,%r13b
+  804e85:	74 b8                	je     804e3f <mmap+0xb3>
+  804e87:	85 d2                	test   %edx,%edx
+  804e89:	75 b4                	jne    804e3f <mmap+0xb3>
+  804e8b:	e9 2d 01 00 00       	jmp    804fbd <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e90:	4c 89 ff             	mov    %r15,%rdi
+  804e93:	48 b8 fa 49 80 00 00 	movabs $0x8049fa,%rax
+  804e9a:	00 00 00 
+  804e9d:	ff d0                	call   *%rax
+  804e9f:	48 89 c2             	mov    %rax,%rdx
+  804ea2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ea9:	49 39 d7             	cmp    %rdx,%r15
+  804eac:	0f 85 0b 01 00 00    	jne    804fbd <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804eb2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804eb9:	00 00 00 
+  804ebc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804ec2:	eb 44                	jmp    804f08 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804ec4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804ec8:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804ecf:	00 00 00 
+  804ed2:	48 b8 fa 49 80 00 00 	movabs $0x8049fa,%rax
+  804ed9:	00 00 00 
+  804edc:	ff d0                	call   *%rax
+  804ede:	48 89 c7             	mov    %rax,%rdi
+  804ee1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804ee5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804eec:	48 85 ff             	test   %rdi,%rdi
+  804eef:	75 c1                	jne    804eb2 <mmap+0x126>
+  804ef1:	e9 c7 00 00 00       	jmp    804fbd <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804ef6:	49 83 c4 01          	add    $0x1,%r12
+  804efa:	48 83 c0 20          	add    $0x20,%rax
+  804efe:	49 83 fc 20          	cmp    $0x20,%r12
+  804f02:	0f 84 a5 00 00 00    	je     804fad <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f08:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804f0c:	75 e8                	jne    804ef6 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804f0e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804f12:	48 b8 32 31 80 00 00 	movabs $0x803132,%rax
+  804f19:	00 00 00 
+  804f1c:	ff d0                	call   *%rax
+  804f1e:	89 c2                	mov    %eax,%edx
+  804f20:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f27:	85 d2                	test   %edx,%edx
+  804f29:	0f 88 8e 00 00 00    	js     804fbd <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804f2f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804f33:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  804f3a:	00 00 00 
+  804f3d:	ff d0                	call   *%rax
+  804f3f:	89 c6                	mov    %eax,%esi
+  804f41:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804f44:	48 b8 52 33 80 00 00 	movabs $0x803352,%rax
+  804f4b:	00 00 00 
+  804f4e:	ff d0                	call   *%rax
+  804f50:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f53:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f5a:	45 85 ff             	test   %r15d,%r15d
+  804f5d:	78 5e                	js     804fbd <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f5f:	49 c1 e4 05          	shl    $0x5,%r12
+  804f63:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f6a:	00 00 00 
+  804f6d:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804f70:	48 bf 6b 4a 80 00 00 	movabs $0x804a6b,%rdi
+  804f77:	00 00 00 
+  804f7a:	48 b8 96 54 80 00 00 	movabs $0x805496,%rax
+  804f81:	00 00 00 
+  804f84:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804f86:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f8a:	49 89 04 24          	mov    %rax,(%r12)
+  804f8e:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804f92:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804f97:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804f9c:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804fa1:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804fa6:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804fab:	eb 10                	jmp    804fbd <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804fad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fb4:	eb 07                	jmp    804fbd <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804fb6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804fbd:	48 83 c4 38          	add    $0x38,%rsp
+  804fc1:	5b                   	pop    %rbx
+  804fc2:	41 5c                	pop    %r12
+  804fc4:	41 5d                	pop    %r13
+  804fc6:	41 5e                	pop    %r14
+  804fc8:	41 5f                	pop    %r15
+  804fca:	5d                   	pop    %rbp
+  804fcb:	c3                   	ret
+
+0000000000804fcc <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804fcc:	55                   	push   %rbp
+  804fcd:	48 89 e5             	mov    %rsp,%rbp
+  804fd0:	41 57                	push   %r15
+  804fd2:	41 56                	push   %r14
+  804fd4:	41 55                	push   %r13
+  804fd6:	41 54                	push   %r12
+  804fd8:	53                   	push   %rbx
+  804fd9:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804fdd:	49 89 fe             	mov    %rdi,%r14
+  804fe0:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fe7:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fee:	00 
+  804fef:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ff6:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804ffd:	00 00 00 
+  805000:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805007:	49 bf 53 4c 80 00 00 	movabs $0x804c53,%r15
+  80500e:	00 00 00 
+  805011:	eb 09                	jmp    80501c <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805013:	48 83 c3 20          	add    $0x20,%rbx
+  805017:	4c 39 eb             	cmp    %r13,%rbx
+  80501a:	74 33                	je     80504f <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  80501c:	48 89 df             	mov    %rbx,%rdi
+  80501f:	48 8b 33             	mov    (%rbx),%rsi
+  805022:	4c 39 e6             	cmp    %r12,%rsi
+  805025:	73 ec                	jae    805013 <msync+0x47>
+  805027:	48 85 f6             	test   %rsi,%rsi
+  80502a:	74 e7                	je     805013 <msync+0x47>
+  80502c:	48 89 f2             	mov    %rsi,%rdx
+  80502f:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805033:	49 39 d6             	cmp    %rdx,%r14
+  805036:	73 db                	jae    805013 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805038:	4c 39 e2             	cmp    %r12,%rdx
+  80503b:	49 0f 47 d4          	cmova  %r12,%rdx
+  80503f:	4c 39 f6             	cmp    %r14,%rsi
+  805042:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805046:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805049:	85 c0                	test   %eax,%eax
+  80504b:	79 c6                	jns    805013 <msync+0x47>
+  80504d:	eb 05                	jmp    805054 <msync+0x88>
+    }
+
+    return 0;
+  80504f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805054:	48 83 c4 08          	add    $0x8,%rsp
+  805058:	5b                   	pop    %rbx
+  805059:	41 5c                	pop    %r12
+  80505b:	41 5d                	pop    %r13
+  80505d:	41 5e                	pop    %r14
+  80505f:	41 5f                	pop    %r15
+  805061:	5d                   	pop    %rbp
+  805062:	c3                   	ret
+
+0000000000805063 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805063:	55                   	push   %rbp
+  805064:	48 89 e5             	mov    %rsp,%rbp
+  805067:	41 57                	push   %r15
+  805069:	41 56                	push   %r14
+  80506b:	41 55                	push   %r13
+  80506d:	41 54                	push   %r12
+  80506f:	53                   	push   %rbx
+  805070:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805074:	49 89 ff             	mov    %rdi,%r15
+  805077:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80507e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805085:	00 
+  805086:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80508d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805094:	00 00 00 
+  805097:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80509e:	48 89 d8             	mov    %rbx,%rax
+  8050a1:	eb 09                	jmp    8050ac <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050a3:	48 83 c0 20          	add    $0x20,%rax
+  8050a7:	4c 39 f0             	cmp    %r14,%rax
+  8050aa:	74 40                	je     8050ec <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050ac:	48 8b 10             	mov    (%rax),%rdx
+  8050af:	4c 39 e2             	cmp    %r12,%rdx
+  8050b2:	73 ef                	jae    8050a3 <munmap+0x40>
+  8050b4:	48 85 d2             	test   %rdx,%rdx
+  8050b7:	74 ea                	je     8050a3 <munmap+0x40>
+  8050b9:	48 89 d7             	mov    %rdx,%rdi
+  8050bc:	48 03 78 08          	add    0x8(%rax),%rdi
+  8050c0:	49 39 ff             	cmp    %rdi,%r15
+  8050c3:	73 de                	jae    8050a3 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8050c5:	49 39 fc             	cmp    %rdi,%r12
+  8050c8:	72 05                	jb     8050cf <munmap+0x6c>
+  8050ca:	4c 39 fa             	cmp    %r15,%rdx
+  8050cd:	73 d4                	jae    8050a3 <munmap+0x40>
+  8050cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8050d4:	48 83 c4 08          	add    $0x8,%rsp
+  8050d8:	5b                   	pop    %rbx
+  8050d9:	41 5c                	pop    %r12
+  8050db:	41 5d                	pop    %r13
+  8050dd:	41 5e                	pop    %r14
+  8050df:	41 5f                	pop    %r15
+  8050e1:	5d                   	pop    %rbp
+  8050e2:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050e3:	48 83 c3 20          	add    $0x20,%rbx
+  8050e7:	4c 39 f3             	cmp    %r14,%rbx
+  8050ea:	74 5c                	je     805148 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050ec:	48 8b 33             	mov    (%rbx),%rsi
+  8050ef:	4c 39 e6             	cmp    %r12,%rsi
+  8050f2:	73 ef                	jae    8050e3 <munmap+0x80>
+  8050f4:	48 85 f6             	test   %rsi,%rsi
+  8050f7:	74 ea                	je     8050e3 <munmap+0x80>
+  8050f9:	48 89 f2             	mov    %rsi,%rdx
+  8050fc:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805100:	49 39 d7             	cmp    %rdx,%r15
+  805103:	73 de                	jae    8050e3 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805105:	48 89 df             	mov    %rbx,%rdi
+  805108:	48 b8 53 4c 80 00 00 	movabs $0x804c53,%rax
+  80510f:	00 00 00 
+  805112:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805114:	85 c0                	test   %eax,%eax
+  805116:	78 bc                	js     8050d4 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805118:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80511c:	48 8b 33             	mov    (%rbx),%rsi
+  80511f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805124:	48 b8 7e 2b 80 00 00 	movabs $0x802b7e,%rax
+  80512b:	00 00 00 
+  80512e:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805130:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805133:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  80513a:	00 00 00 
+  80513d:	ff d0                	call   *%rax
+        reg->start = 0;
+  80513f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805146:	eb 9b                	jmp    8050e3 <munmap+0x80>
+    return 0;
+  805148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80514d:	eb 85                	jmp    8050d4 <munmap+0x71>
+
+000000000080514f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80514f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805154:	c3                   	ret
+
+0000000000805155 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805155:	55                   	push   %rbp
+  805156:	48 89 e5             	mov    %rsp,%rbp
+  805159:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80515c:	48 be a5 66 80 00 00 	movabs $0x8066a5,%rsi
+  805163:	00 00 00 
+  805166:	48 b8 41 23 80 00 00 	movabs $0x802341,%rax
+  80516d:	00 00 00 
+  805170:	ff d0                	call   *%rax
+    return 0;
+}
+  805172:	b8 00 00 00 00       	mov    $0x0,%eax
+  805177:	5d                   	pop    %rbp
+  805178:	c3                   	ret
+
+0000000000805179 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805179:	55                   	push   %rbp
+  80517a:	48 89 e5             	mov    %rsp,%rbp
+  80517d:	41 57                	push   %r15
+  80517f:	41 56                	push   %r14
+  805181:	41 55                	push   %r13
+  805183:	41 54                	push   %r12
+  805185:	53                   	push   %rbx
+  805186:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80518d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805194:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  80519b:	00 00 00 00 
+  80519f:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8051a6:	00 00 00 00 
+  8051aa:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8051b1:	00 00 00 00 
+  8051b5:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8051bc:	00 00 00 00 
+  8051c0:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8051c7:	00 00 00 00 
+  8051cb:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8051d2:	00 00 00 00 
+  8051d6:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8051dd:	00 
+  8051de:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8051e5:	00 
+  8051e6:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8051ed:	00 
+  8051ee:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8051f5:	00 
+  8051f6:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8051fd:	00 
+  8051fe:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805205:	00 
+  805206:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80520d:	00 
+  80520e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805215:	00 
+  805216:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80521d:	00 
+  80521e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805225:	00 
+    for (res = 0; res < n; res += inc) {
+  805226:	48 85 d2             	test   %rdx,%rdx
+  805229:	74 7a                	je     8052a5 <devcons_write+0x12c>
+  80522b:	49 89 d6             	mov    %rdx,%r14
+  80522e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805234:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805239:	49 bf 91 26 80 00 00 	movabs $0x802691,%r15
+  805240:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805243:	4c 89 f3             	mov    %r14,%rbx
+  805246:	48 29 f3             	sub    %rsi,%rbx
+  805249:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80524e:	48 39 c3             	cmp    %rax,%rbx
+  805251:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805255:	4c 63 eb             	movslq %ebx,%r13
+  805258:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80525f:	48 01 c6             	add    %rax,%rsi
+  805262:	4c 89 ea             	mov    %r13,%rdx
+  805265:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80526c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80526f:	4c 89 ee             	mov    %r13,%rsi
+  805272:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805279:	48 b8 be 28 80 00 00 	movabs $0x8028be,%rax
+  805280:	00 00 00 
+  805283:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805285:	41 01 dc             	add    %ebx,%r12d
+  805288:	49 63 f4             	movslq %r12d,%rsi
+  80528b:	4c 39 f6             	cmp    %r14,%rsi
+  80528e:	72 b3                	jb     805243 <devcons_write+0xca>
+    return res;
+  805290:	49 63 c4             	movslq %r12d,%rax
+}
+  805293:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80529a:	5b                   	pop    %rbx
+  80529b:	41 5c                	pop    %r12
+  80529d:	41 5d                	pop    %r13
+  80529f:	41 5e                	pop    %r14
+  8052a1:	41 5f                	pop    %r15
+  8052a3:	5d                   	pop    %rbp
+  8052a4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8052a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8052ab:	eb e3                	jmp    805290 <devcons_write+0x117>
+
+00000000008052ad <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8052ad:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8052b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052b5:	48 85 c0             	test   %rax,%rax
+  8052b8:	74 55                	je     80530f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8052ba:	55                   	push   %rbp
+  8052bb:	48 89 e5             	mov    %rsp,%rbp
+  8052be:	41 55                	push   %r13
+  8052c0:	41 54                	push   %r12
+  8052c2:	53                   	push   %rbx
+  8052c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8052c7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8052ca:	48 bb f1 28 80 00 00 	movabs $0x8028f1,%rbx
+  8052d1:	00 00 00 
+  8052d4:	49 bc 05 2a 80 00 00 	movabs $0x802a05,%r12
+  8052db:	00 00 00 
+  8052de:	eb 03                	jmp    8052e3 <devcons_read+0x36>
+  8052e0:	41 ff d4             	call   *%r12
+  8052e3:	ff d3                	call   *%rbx
+  8052e5:	85 c0                	test   %eax,%eax
+  8052e7:	74 f7                	je     8052e0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8052e9:	48 63 d0             	movslq %eax,%rdx
+  8052ec:	78 13                	js     805301 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8052ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052f3:	83 f8 04             	cmp    $0x4,%eax
+  8052f6:	74 09                	je     805301 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052f8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052fc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805301:	48 89 d0             	mov    %rdx,%rax
+  805304:	48 83 c4 08          	add    $0x8,%rsp
+  805308:	5b                   	pop    %rbx
+  805309:	41 5c                	pop    %r12
+  80530b:	41 5d                	pop    %r13
+  80530d:	5d                   	pop    %rbp
+  80530e:	c3                   	ret
+  80530f:	48 89 d0             	mov    %rdx,%rax
+  805312:	c3                   	ret
+
+0000000000805313 <cputchar>:
+cputchar(int ch) {
+  805313:	55                   	push   %rbp
+  805314:	48 89 e5             	mov    %rsp,%rbp
+  805317:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80531b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80531f:	be 01 00 00 00       	mov    $0x1,%esi
+  805324:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805328:	48 b8 be 28 80 00 00 	movabs $0x8028be,%rax
+  80532f:	00 00 00 
+  805332:	ff d0                	call   *%rax
+}
+  805334:	c9                   	leave
+  805335:	c3                   	ret
+
+0000000000805336 <getchar>:
+getchar(void) {
+  805336:	55                   	push   %rbp
+  805337:	48 89 e5             	mov    %rsp,%rbp
+  80533a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80533e:	ba 01 00 00 00       	mov    $0x1,%edx
+  805343:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805347:	bf 00 00 00 00       	mov    $0x0,%edi
+  80534c:	48 b8 75 34 80 00 00 	movabs $0x803475,%rax
+  805353:	00 00 00 
+  805356:	ff d0                	call   *%rax
+  805358:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80535a:	85 c0                	test   %eax,%eax
+  80535c:	78 06                	js     805364 <getchar+0x2e>
+  80535e:	74 08                	je     805368 <getchar+0x32>
+  805360:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805364:	89 d0                	mov    %edx,%eax
+  805366:	c9                   	leave
+  805367:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805368:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80536d:	eb f5                	jmp    805364 <getchar+0x2e>
+
+000000000080536f <iscons>:
+iscons(int fdnum) {
+  80536f:	55                   	push   %rbp
+  805370:	48 89 e5             	mov    %rsp,%rbp
+  805373:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805377:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80537b:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  805382:	00 00 00 
+  805385:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805387:	85 c0                	test   %eax,%eax
+  805389:	78 18                	js     8053a3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80538b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80538f:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805396:	00 00 00 
+  805399:	8b 00                	mov    (%rax),%eax
+  80539b:	39 02                	cmp    %eax,(%rdx)
+  80539d:	0f 94 c0             	sete   %al
+  8053a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8053a3:	c9                   	leave
+  8053a4:	c3                   	ret
+
+00000000008053a5 <opencons>:
+opencons(void) {
+  8053a5:	55                   	push   %rbp
+  8053a6:	48 89 e5             	mov    %rsp,%rbp
+  8053a9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8053ad:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8053b1:	48 b8 32 31 80 00 00 	movabs $0x803132,%rax
+  8053b8:	00 00 00 
+  8053bb:	ff d0                	call   *%rax
+  8053bd:	85 c0                	test   %eax,%eax
+  8053bf:	78 49                	js     80540a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8053c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8053c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053cb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8053cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d4:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  8053db:	00 00 00 
+  8053de:	ff d0                	call   *%rax
+  8053e0:	85 c0                	test   %eax,%eax
+  8053e2:	78 26                	js     80540a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8053e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053e8:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8053ef:	00 00 
+  8053f1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8053f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053f7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053fe:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  805405:	00 00 00 
+  805408:	ff d0                	call   *%rax
+}
+  80540a:	c9                   	leave
+  80540b:	c3                   	ret
+
+000000000080540c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80540c:	55                   	push   %rbp
+  80540d:	48 89 e5             	mov    %rsp,%rbp
+  805410:	41 56                	push   %r14
+  805412:	41 55                	push   %r13
+  805414:	41 54                	push   %r12
+  805416:	53                   	push   %rbx
+  805417:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80541a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805421:	00 00 00 
+  805424:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805428:	74 27                	je     805451 <_handle_vectored_pagefault+0x45>
+  80542a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80542f:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805436:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805439:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80543c:	4c 89 e7             	mov    %r12,%rdi
+  80543f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805444:	84 c0                	test   %al,%al
+  805446:	75 45                	jne    80548d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805448:	48 83 c3 01          	add    $0x1,%rbx
+  80544c:	49 3b 1e             	cmp    (%r14),%rbx
+  80544f:	72 eb                	jb     80543c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805451:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805458:	00 
+  805459:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80545e:	4d 8b 04 24          	mov    (%r12),%r8
+  805462:	48 ba b8 66 80 00 00 	movabs $0x8066b8,%rdx
+  805469:	00 00 00 
+  80546c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805471:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  805478:	00 00 00 
+  80547b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805480:	49 ba ba 18 80 00 00 	movabs $0x8018ba,%r10
+  805487:	00 00 00 
+  80548a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80548d:	5b                   	pop    %rbx
+  80548e:	41 5c                	pop    %r12
+  805490:	41 5d                	pop    %r13
+  805492:	41 5e                	pop    %r14
+  805494:	5d                   	pop    %rbp
+  805495:	c3                   	ret
+
+0000000000805496 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805496:	55                   	push   %rbp
+  805497:	48 89 e5             	mov    %rsp,%rbp
+  80549a:	53                   	push   %rbx
+  80549b:	48 83 ec 08          	sub    $0x8,%rsp
+  80549f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8054a2:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8054a7:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8054ae:	00 00 00 
+  8054b1:	80 38 00             	cmpb   $0x0,(%rax)
+  8054b4:	74 68                	je     80551e <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054b6:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8054bd:	00 00 00 
+  8054c0:	48 8b 08             	mov    (%rax),%rcx
+  8054c3:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054c8:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8054cf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054d2:	48 85 c9             	test   %rcx,%rcx
+  8054d5:	0f 84 e0 00 00 00    	je     8055bb <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054db:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8054df:	0f 84 c9 00 00 00    	je     8055ae <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054e5:	48 83 c2 01          	add    $0x1,%rdx
+  8054e9:	48 39 ca             	cmp    %rcx,%rdx
+  8054ec:	75 ed                	jne    8054db <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8054ee:	48 83 f9 08          	cmp    $0x8,%rcx
+  8054f2:	0f 84 84 00 00 00    	je     80557c <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054f8:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8054fc:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805503:	00 00 00 
+  805506:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80550d:	00 00 00 
+  805510:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805514:	85 f6                	test   %esi,%esi
+  805516:	0f 89 97 00 00 00    	jns    8055b3 <add_pgfault_handler+0x11d>
+  80551c:	eb 63                	jmp    805581 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80551e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805523:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805528:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80552f:	00 00 00 
+  805532:	bf 00 00 00 00       	mov    $0x0,%edi
+  805537:	48 b8 a6 2a 80 00 00 	movabs $0x802aa6,%rax
+  80553e:	00 00 00 
+  805541:	ff d0                	call   *%rax
+  805543:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805545:	85 c0                	test   %eax,%eax
+  805547:	78 38                	js     805581 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805549:	48 be 97 56 80 00 00 	movabs $0x805697,%rsi
+  805550:	00 00 00 
+  805553:	bf 00 00 00 00       	mov    $0x0,%edi
+  805558:	48 b8 c9 2c 80 00 00 	movabs $0x802cc9,%rax
+  80555f:	00 00 00 
+  805562:	ff d0                	call   *%rax
+  805564:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805566:	85 c0                	test   %eax,%eax
+  805568:	78 17                	js     805581 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80556a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805571:	00 00 00 
+  805574:	c6 00 01             	movb   $0x1,(%rax)
+  805577:	e9 3a ff ff ff       	jmp    8054b6 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80557c:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805581:	89 f1                	mov    %esi,%ecx
+  805583:	48 ba f6 66 80 00 00 	movabs $0x8066f6,%rdx
+  80558a:	00 00 00 
+  80558d:	be 42 00 00 00       	mov    $0x42,%esi
+  805592:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  805599:	00 00 00 
+  80559c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a1:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  8055a8:	00 00 00 
+  8055ab:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8055ae:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8055b3:	89 f0                	mov    %esi,%eax
+  8055b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055b9:	c9                   	leave
+  8055ba:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8055bb:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8055c2:	00 00 00 
+  8055c5:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8055cc:	48 89 d8             	mov    %rbx,%rax
+  8055cf:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8055d6:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055d9:	eb d8                	jmp    8055b3 <add_pgfault_handler+0x11d>
+
+00000000008055db <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8055db:	55                   	push   %rbp
+  8055dc:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8055df:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055e6:	00 00 00 
+  8055e9:	80 38 00             	cmpb   $0x0,(%rax)
+  8055ec:	74 33                	je     805621 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055ee:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8055f5:	00 00 00 
+  8055f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8055fd:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805604:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805607:	48 85 c0             	test   %rax,%rax
+  80560a:	0f 84 85 00 00 00    	je     805695 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805610:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805614:	74 40                	je     805656 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805616:	48 83 c1 01          	add    $0x1,%rcx
+  80561a:	48 39 c1             	cmp    %rax,%rcx
+  80561d:	75 f1                	jne    805610 <remove_pgfault_handler+0x35>
+  80561f:	eb 74                	jmp    805695 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805621:	48 b9 0e 67 80 00 00 	movabs $0x80670e,%rcx
+  805628:	00 00 00 
+  80562b:	48 ba f6 65 80 00 00 	movabs $0x8065f6,%rdx
+  805632:	00 00 00 
+  805635:	be 48 00 00 00       	mov    $0x48,%esi
+  80563a:	48 bf e8 66 80 00 00 	movabs $0x8066e8,%rdi
+  805641:	00 00 00 
+  805644:	b8 00 00 00 00       	mov    $0x0,%eax
+  805649:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  805650:	00 00 00 
+  805653:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805656:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80565d:	00 
+  80565e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805662:	48 29 ca             	sub    %rcx,%rdx
+  805665:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80566c:	00 00 00 
+  80566f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805673:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805678:	48 89 ce             	mov    %rcx,%rsi
+  80567b:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  805682:	00 00 00 
+  805685:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805687:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80568e:	00 00 00 
+  805691:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805695:	5d                   	pop    %rbp
+  805696:	c3                   	ret
+
+0000000000805697 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805697:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80569a:	48 b8 0c 54 80 00 00 	movabs $0x80540c,%rax
+  8056a1:	00 00 00 
+    call *%rax
+  8056a4:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8056a6:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8056ad:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8056ae:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8056b5:	00 
+    subq $8, %rcx
+  8056b6:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8056ba:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8056bd:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8056c4:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8056c5:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8056c9:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8056cd:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8056d2:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8056d7:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8056dc:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8056e1:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8056e6:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8056eb:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8056f0:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8056f5:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8056fa:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8056ff:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805704:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805709:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80570e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805713:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805717:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80571b:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80571c:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80571d:	c3                   	ret
+
+000000000080571e <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80571e:	85 ff                	test   %edi,%edi
+  805720:	78 58                	js     80577a <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805722:	48 85 f6             	test   %rsi,%rsi
+  805725:	74 12                	je     805739 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805727:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80572e:	00 00 00 
+  805731:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805737:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805739:	48 85 c9             	test   %rcx,%rcx
+  80573c:	74 12                	je     805750 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80573e:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805745:	00 00 00 
+  805748:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80574e:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805750:	48 85 d2             	test   %rdx,%rdx
+  805753:	74 14                	je     805769 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805755:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80575c:	00 00 00 
+  80575f:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805766:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805769:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805770:	00 00 00 
+  805773:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805779:	c3                   	ret
+        if (from_env_store) {
+  80577a:	48 85 f6             	test   %rsi,%rsi
+  80577d:	74 06                	je     805785 <ipc_result+0x67>
+            *from_env_store = 0;
+  80577f:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805785:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805787:	48 85 c9             	test   %rcx,%rcx
+  80578a:	74 ed                	je     805779 <ipc_result+0x5b>
+            *perm_store = 0;
+  80578c:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805792:	c3                   	ret
+
+0000000000805793 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805793:	55                   	push   %rbp
+  805794:	48 89 e5             	mov    %rsp,%rbp
+  805797:	41 55                	push   %r13
+  805799:	41 54                	push   %r12
+  80579b:	53                   	push   %rbx
+  80579c:	48 83 ec 08          	sub    $0x8,%rsp
+  8057a0:	49 89 fc             	mov    %rdi,%r12
+  8057a3:	48 89 f7             	mov    %rsi,%rdi
+  8057a6:	48 89 d3             	mov    %rdx,%rbx
+  8057a9:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057ac:	48 85 f6             	test   %rsi,%rsi
+  8057af:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057b6:	00 00 00 
+  8057b9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8057bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8057c2:	48 85 d2             	test   %rdx,%rdx
+  8057c5:	74 03                	je     8057ca <ipc_recv+0x37>
+  8057c7:	48 8b 32             	mov    (%rdx),%rsi
+  8057ca:	48 b8 f2 2f 80 00 00 	movabs $0x802ff2,%rax
+  8057d1:	00 00 00 
+  8057d4:	ff d0                	call   *%rax
+  8057d6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8057d8:	4c 89 e9             	mov    %r13,%rcx
+  8057db:	48 89 da             	mov    %rbx,%rdx
+  8057de:	4c 89 e6             	mov    %r12,%rsi
+  8057e1:	48 b8 1e 57 80 00 00 	movabs $0x80571e,%rax
+  8057e8:	00 00 00 
+  8057eb:	ff d0                	call   *%rax
+}
+  8057ed:	48 83 c4 08          	add    $0x8,%rsp
+  8057f1:	5b                   	pop    %rbx
+  8057f2:	41 5c                	pop    %r12
+  8057f4:	41 5d                	pop    %r13
+  8057f6:	5d                   	pop    %rbp
+  8057f7:	c3                   	ret
+
+00000000008057f8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8057f8:	55                   	push   %rbp
+  8057f9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057fc:	48 85 d2             	test   %rdx,%rdx
+  8057ff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805806:	00 00 00 
+  805809:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80580d:	89 f6                	mov    %esi,%esi
+  80580f:	48 b8 7e 2e 80 00 00 	movabs $0x802e7e,%rax
+  805816:	00 00 00 
+  805819:	ff d0                	call   *%rax
+    if (res < 0) {
+  80581b:	85 c0                	test   %eax,%eax
+  80581d:	78 02                	js     805821 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80581f:	5d                   	pop    %rbp
+  805820:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805821:	89 c1                	mov    %eax,%ecx
+  805823:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  80582a:	00 00 00 
+  80582d:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805832:	48 bf 35 67 80 00 00 	movabs $0x806735,%rdi
+  805839:	00 00 00 
+  80583c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805841:	49 b8 ba 18 80 00 00 	movabs $0x8018ba,%r8
+  805848:	00 00 00 
+  80584b:	41 ff d0             	call   *%r8
+
+000000000080584e <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80584e:	55                   	push   %rbp
+  80584f:	48 89 e5             	mov    %rsp,%rbp
+  805852:	53                   	push   %rbx
+  805853:	48 83 ec 08          	sub    $0x8,%rsp
+  805857:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80585b:	48 85 d2             	test   %rdx,%rdx
+  80585e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805865:	00 00 00 
+  805868:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80586c:	4d 85 c9             	test   %r9,%r9
+  80586f:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805873:	b8 00 00 00 00       	mov    $0x0,%eax
+  805878:	48 85 db             	test   %rbx,%rbx
+  80587b:	74 03                	je     805880 <ipc_call+0x32>
+  80587d:	48 8b 03             	mov    (%rbx),%rax
+  805880:	89 f6                	mov    %esi,%esi
+  805882:	48 83 ec 08          	sub    $0x8,%rsp
+  805886:	50                   	push   %rax
+  805887:	48 b8 b0 2e 80 00 00 	movabs $0x802eb0,%rax
+  80588e:	00 00 00 
+  805891:	ff d0                	call   *%rax
+  805893:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805895:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805899:	48 89 da             	mov    %rbx,%rdx
+  80589c:	be 00 00 00 00       	mov    $0x0,%esi
+  8058a1:	48 b8 1e 57 80 00 00 	movabs $0x80571e,%rax
+  8058a8:	00 00 00 
+  8058ab:	ff d0                	call   *%rax
+}
+  8058ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8058b1:	c9                   	leave
+  8058b2:	c3                   	ret
+
+00000000008058b3 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8058b3:	55                   	push   %rbp
+  8058b4:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8058b7:	89 f6                	mov    %esi,%esi
+  8058b9:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  8058c0:	00 00 00 
+  8058c3:	ff d0                	call   *%rax
+  8058c5:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8058c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8058cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8058d6:	48 b8 1e 57 80 00 00 	movabs $0x80571e,%rax
+  8058dd:	00 00 00 
+  8058e0:	ff d0                	call   *%rax
+}
+  8058e2:	5d                   	pop    %rbp
+  8058e3:	c3                   	ret
+
+00000000008058e4 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8058e4:	55                   	push   %rbp
+  8058e5:	48 89 e5             	mov    %rsp,%rbp
+  8058e8:	41 54                	push   %r12
+  8058ea:	53                   	push   %rbx
+  8058eb:	4c 89 cb             	mov    %r9,%rbx
+  8058ee:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8058f2:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058f6:	48 85 d2             	test   %rdx,%rdx
+  8058f9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805900:	00 00 00 
+  805903:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805907:	4d 85 c9             	test   %r9,%r9
+  80590a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80590e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805913:	4d 85 e4             	test   %r12,%r12
+  805916:	74 04                	je     80591c <ipc_reply_wait+0x38>
+  805918:	49 8b 04 24          	mov    (%r12),%rax
+  80591c:	89 f6                	mov    %esi,%esi
+  80591e:	48 83 ec 08          	sub    $0x8,%rsp
+  805922:	50                   	push   %rax
+  805923:	48 b8 86 2f 80 00 00 	movabs $0x802f86,%rax
+  80592a:	00 00 00 
+  80592d:	ff d0                	call   *%rax
+  80592f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805931:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805935:	4c 89 e2             	mov    %r12,%rdx
+  805938:	48 89 de             	mov    %rbx,%rsi
+  80593b:	48 b8 1e 57 80 00 00 	movabs $0x80571e,%rax
+  805942:	00 00 00 
+  805945:	ff d0                	call   *%rax
+}
+  805947:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80594b:	5b                   	pop    %rbx
+  80594c:	41 5c                	pop    %r12
+  80594e:	5d                   	pop    %rbp
+  80594f:	c3                   	ret
+
+0000000000805950 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805950:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805955:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80595c:	00 00 00 
+  80595f:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805966:	48 01 ca             	add    %rcx,%rdx
+  805969:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80596f:	39 fa                	cmp    %edi,%edx
+  805971:	74 12                	je     805985 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805973:	48 83 c0 01          	add    $0x1,%rax
+  805977:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80597d:	75 e0                	jne    80595f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80597f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805984:	c3                   	ret
+            return envs[i].env_id;
+  805985:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80598c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805993:	00 00 00 
+  805996:	48 01 d0             	add    %rdx,%rax
+  805999:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80599f:	c3                   	ret
+
+00000000008059a0 <__rodata_start>:
+  8059a0:	77 00                	ja     8059a2 <__rodata_start+0x2>
+  8059a2:	72 62                	jb     805a06 <__rodata_start+0x66>
+  8059a4:	00 77 62             	add    %dh,0x62(%rdi)
+  8059a7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8059aa:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8059b1:	00 
+  8059b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8059b9:	00 00 00 
+  8059bc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8059c0:	b3 09                	mov    $0x9,%bl
+  8059c2:	80 00 00             	addb   $0x0,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 ed                	add    %ch,%ch
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	ed                   	in     (%dx),%eax
+  8059d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	ed                   	in     (%dx),%eax
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 ed                	add    %ch,%ch
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	8c 0a                	mov    %cs,(%rdx)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	8c 0a                	mov    %cs,(%rdx)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	8c 0a                	mov    %cs,(%rdx)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	8c 0a                	mov    %cs,(%rdx)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	8c 0a                	mov    %cs,(%rdx)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	f4                   	hlt
+  805b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b5f:	00 ed                	add    %ch,%ch
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	2c 0b                	sub    $0xb,%al
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 ed                	add    %ch,%ch
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	ed                   	in     (%dx),%eax
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805bb3:	00 00                	add    %al,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 cb                	add    %cl,%bl
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	6a 0a                	push   $0xa
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	3c 0a                	cmp    $0xa,%al
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 ed                	add    %ch,%ch
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805c0b:	00 00                	add    %al,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 29                	add    %ch,(%rcx)
+  805c19:	0c 80                	or     $0x80,%al
+  805c1b:	00 00                	add    %al,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 ed                	add    %ch,%ch
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	1a 0b                	sbb    (%rbx),%cl
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 ed                	add    %ch,%ch
+  805c39:	0d 80 00 00 00       	or     $0x80,%eax
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	ce                   	(bad)
+  805c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	f4                   	hlt
+  805c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c5f:	00 37                	add    %dh,(%rdi)
+  805c61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 37                	add    %dh,(%rdi)
+  805c71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c8b:	00 00                	add    %al,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 d2                	add    %dl,%dl
+  805c91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c97:	00 d2                	add    %dl,%dl
+  805c99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c9f:	00 d2                	add    %dl,%dl
+  805ca1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ca7:	00 d2                	add    %dl,%dl
+  805ca9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805caf:	00 d2                	add    %dl,%dl
+  805cb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cb7:	00 d2                	add    %dl,%dl
+  805cb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cbf:	00 d2                	add    %dl,%dl
+  805cc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cc7:	00 f6                	add    %dh,%dh
+  805cc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ccf:	00 f6                	add    %dh,%dh
+  805cd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 22                	add    %ah,(%rdx)
+  805d11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d17:	00 22                	add    %ah,(%rdx)
+  805d19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d1f:	00 22                	add    %ah,(%rdx)
+  805d21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d27:	00 22                	add    %ah,(%rdx)
+  805d29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d2f:	00 22                	add    %ah,(%rdx)
+  805d31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d37:	00 22                	add    %ah,(%rdx)
+  805d39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 46 12             	add    %al,0x12(%rsi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 22                	add    %ah,(%rdx)
+  805e11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e17:	00 22                	add    %ah,(%rdx)
+  805e19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e1f:	00 22                	add    %ah,(%rdx)
+  805e21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e27:	00 22                	add    %ah,(%rdx)
+  805e29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e2f:	00 22                	add    %ah,(%rdx)
+  805e31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e37:	00 22                	add    %ah,(%rdx)
+  805e39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e7a:	80 00 00             	addb   $0x0,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 46 12             	add    %al,0x12(%rsi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ee0 <basefix.0>:
+  805ee0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805ef0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805f00:	10 00 66 0f 1f 44 00 00 73 79 73 63 61 6c 6c 62     ..f..D..syscallb
+  805f10:	65 6e 63 68 3a 20 25 2d 32 30 73 20 25 6c 64 20     ench: %-20s %ld 
+  805f20:	63 61 6c 6c 73 20 69 6e 20 25 75 20 6d 73 20 28     calls in %u ms (
+  805f30:	25 6c 64 20 6e 73 2f 63 61 6c 6c 29 0a 00 67 65     %ld ns/call)..ge
+  805f40:	74 65 6e 76 69 64 00 73 79 73 5f 65 78 6f 66 6f     tenvid.sys_exofo
+  805f50:	72 6b 3a 20 25 69 00 75 73 65 72 2f 73 79 73 63     rk: %i.user/sysc
+  805f60:	61 6c 6c 62 65 6e 63 68 2e 63 00 73 79 73 5f 65     allbench.c.sys_e
+  805f70:	6e 76 5f 73 65 74 5f 74 72 61 70 66 72 61 6d 65     nv_set_trapframe
+  805f80:	3a 20 25 69 00 65 6e 76 5f 73 65 74 5f 74 72 61     : %i.env_set_tra
+  805f90:	70 66 72 61 6d 65 00 63 70 75 74 73 20 28 65 6d     pframe.cputs (em
+  805fa0:	70 74 79 29 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 90     pty).<unknown>..
+  805fb0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805fc0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805fd0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805fe0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805ff0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806000:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806010:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806020:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806030:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806040:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806050:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806060:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806070:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806080:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806090:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8060a0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8060b0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8060c0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8060d0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8060e0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  8060f0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806100:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806110:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806120:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806130:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806140:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806150:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806160:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  806170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806180:	02 1c 80 00 00 00 00 00 59 22 80 00 00 00 00 00     ........Y"......
+  806190:	49 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     I"......Y"......
+  8061a0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8061b0:	59 22 80 00 00 00 00 00 21 1c 80 00 00 00 00 00     Y"......!.......
+  8061c0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8061d0:	15 1c 80 00 00 00 00 00 8f 1c 80 00 00 00 00 00     ................
+  8061e0:	59 22 80 00 00 00 00 00 15 1c 80 00 00 00 00 00     Y"..............
+  8061f0:	5b 1c 80 00 00 00 00 00 5b 1c 80 00 00 00 00 00     [.......[.......
+  806200:	5b 1c 80 00 00 00 00 00 5b 1c 80 00 00 00 00 00     [.......[.......
+  806210:	5b 1c 80 00 00 00 00 00 5b 1c 80 00 00 00 00 00     [.......[.......
+  806220:	5b 1c 80 00 00 00 00 00 5b 1c 80 00 00 00 00 00     [.......[.......
+  806230:	5b 1c 80 00 00 00 00 00 59 22 80 00 00 00 00 00     [.......Y"......
+  806240:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806250:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806260:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806270:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806280:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806290:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062a0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062b0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062c0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062d0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062e0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8062f0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806300:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806310:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806320:	59 22 80 00 00 00 00 00 77 21 80 00 00 00 00 00     Y"......w!......
+  806330:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806340:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806350:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806360:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806370:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806380:	bd 1c 80 00 00 00 00 00 8c 1e 80 00 00 00 00 00     ................
+  806390:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8063a0:	59 22 80 00 00 00 00 00 b2 1c 80 00 00 00 00 00     Y"..............
+  8063b0:	ec 1c 80 00 00 00 00 00 59 22 80 00 00 00 00 00     ........Y"......
+  8063c0:	59 22 80 00 00 00 00 00 a7 1c 80 00 00 00 00 00     Y"..............
+  8063d0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  8063e0:	35 20 80 00 00 00 00 00 04 21 80 00 00 00 00 00     5 .......!......
+  8063f0:	59 22 80 00 00 00 00 00 59 22 80 00 00 00 00 00     Y"......Y"......
+  806400:	83 1d 80 00 00 00 00 00 59 22 80 00 00 00 00 00     ........Y"......
+  806410:	60 1f 80 00 00 00 00 00 59 22 80 00 00 00 00 00     `.......Y"......
+  806420:	59 22 80 00 00 00 00 00 77 21 80 00 00 00 00 00     Y"......w!......
+  806430:	59 22 80 00 00 00 00 00 0b 1c 80 00 00 00 00 00     Y"..............
+
+0000000000806440 <error_string>:
+	...
+  806448:	05 60 80 00 00 00 00 00 17 60 80 00 00 00 00 00     .`.......`......
+  806458:	27 60 80 00 00 00 00 00 39 60 80 00 00 00 00 00     '`......9`......
+  806468:	47 60 80 00 00 00 00 00 5b 60 80 00 00 00 00 00     G`......[`......
+  806478:	70 60 80 00 00 00 00 00 83 60 80 00 00 00 00 00     p`.......`......
+  806488:	95 60 80 00 00 00 00 00 a9 60 80 00 00 00 00 00     .`.......`......
+  806498:	b9 60 80 00 00 00 00 00 cc 60 80 00 00 00 00 00     .`.......`......
+  8064a8:	e3 60 80 00 00 00 00 00 f9 60 80 00 00 00 00 00     .`.......`......
+  8064b8:	11 61 80 00 00 00 00 00 29 61 80 00 00 00 00 00     .a......)a......
+  8064c8:	36 61 80 00 00 00 00 00 e0 64 80 00 00 00 00 00     6a.......d......
+  8064d8:	4a 61 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     Ja......file is 
+  8064e8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8064f8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806508:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806518:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806528:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806538:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806548:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806558:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806568:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806578:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806588:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806598:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8065a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8065b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008065c0 <devtab>:
+  8065c0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8065d0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806600:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806610:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806620:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806630:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806640:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806650:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806660:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806670:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806680:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806690:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8066a0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8066b0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8066c0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8066d0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8066e0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8066f0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806700:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806710:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806720:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806730:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806740:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806750:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806760:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806770:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806780:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806790:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806800:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806810:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806820:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806830:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806840:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806850:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806860:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806870:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806880:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806890:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806900:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806910:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806920:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806930:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806940:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806950:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806960:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806970:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806980:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806990:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806aa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ab0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ac0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ad0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ae0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806af0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ba0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806be0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ca0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ce0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806da0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806db0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806de0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806df0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ea0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806eb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ec0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ed0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ee0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ef0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fa0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fe0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ff0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 90     .....f..........
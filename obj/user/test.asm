@@ -0,0 +1,10608 @@
+
+obj/user/test:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 43 26 80 00 00 	movabs $0x802643,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 c4 24 80 00 00 	movabs $0x8024c4,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 04 36 80 00 00 	movabs $0x803604,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 04 36 80 00 00 	movabs $0x803604,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 da 3f 80 00 00 	movabs $0x803fda,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 d3 22 80 00 00 	movabs $0x8022d3,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 da 3f 80 00 00 	movabs $0x803fda,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 d3 22 80 00 00 	movabs $0x8022d3,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 17 60 80 00 00 	movabs $0x806017,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 63 24 80 00 00 	movabs $0x802463,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be f0 59 80 00 00 	movabs $0x8059f0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 63 24 80 00 00 	movabs $0x802463,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be f2 59 80 00 00 	movabs $0x8059f2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 63 24 80 00 00 	movabs $0x802463,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be f5 59 80 00 00 	movabs $0x8059f5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 63 24 80 00 00 	movabs $0x802463,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 d8 4d 80 00 00 	movabs $0x804dd8,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 af 50 80 00 00 	movabs $0x8050af,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 ee 36 80 00 00 	movabs $0x8036ee,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 b7 37 80 00 00 	movabs $0x8037b7,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 bd 36 80 00 00 	movabs $0x8036bd,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 04 36 80 00 00 	movabs $0x803604,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 10 26 80 00 00 	movabs $0x802610,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 00 5a 80 00 00 	movabs $0x805a00,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 10 26 80 00 00 	movabs $0x802610,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 43 26 80 00 00 	movabs $0x802643,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 10 26 80 00 00 	movabs $0x802610,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be a0 5c 80 00 00 	movabs $0x805ca0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 10 26 80 00 00 	movabs $0x802610,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 10 26 80 00 00 	movabs $0x802610,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 20 5f 80 00 00 	movabs $0x805f20,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 20 5f 80 00 00 	movabs $0x805f20,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 4f 03 00 00       	call   80184e <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <draw_ball>:
+    int x, y;
+};
+
+
+void
+draw_ball(struct vec2i center, int radius, uint32_t color) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 56                	push   %r14
+  801507:	41 54                	push   %r12
+  801509:	53                   	push   %rbx
+  80150a:	48 89 f8             	mov    %rdi,%rax
+  80150d:	41 89 d1             	mov    %edx,%r9d
+    for (int y = 0; y < SCREEN_H; ++y) {
+        for (int x = 0; x < SCREEN_W; ++x) {
+            struct vec2i delta = (struct vec2i){x - center.x, y - center.y};
+  801510:	41 89 fc             	mov    %edi,%r12d
+
+            if (delta.x * delta.x + delta.y * delta.y <= radius * radius) {
+  801513:	0f af f6             	imul   %esi,%esi
+            struct vec2i delta = (struct vec2i){x - center.x, y - center.y};
+  801516:	49 89 fb             	mov    %rdi,%r11
+  801519:	49 c1 fb 20          	sar    $0x20,%r11
+  80151d:	41 f7 db             	neg    %r11d
+  801520:	8d 9f 00 e8 03 00    	lea    0x3e800(%rdi),%ebx
+            if (delta.x * delta.x + delta.y * delta.y <= radius * radius) {
+  801526:	41 89 f8             	mov    %edi,%r8d
+  801529:	bf 80 02 00 00       	mov    $0x280,%edi
+  80152e:	29 c7                	sub    %eax,%edi
+                fb[y * SCREEN_W + x] = color;
+  801530:	49 ba 20 80 80 01 00 	movabs $0x1808020,%r10
+  801537:	00 00 00 
+  80153a:	eb 32                	jmp    80156e <draw_ball+0x6d>
+        for (int x = 0; x < SCREEN_W; ++x) {
+  80153c:	83 c0 01             	add    $0x1,%eax
+  80153f:	39 f8                	cmp    %edi,%eax
+  801541:	74 1b                	je     80155e <draw_ball+0x5d>
+            if (delta.x * delta.x + delta.y * delta.y <= radius * radius) {
+  801543:	89 c2                	mov    %eax,%edx
+  801545:	0f af d0             	imul   %eax,%edx
+  801548:	01 ca                	add    %ecx,%edx
+  80154a:	39 f2                	cmp    %esi,%edx
+  80154c:	7f ee                	jg     80153c <draw_ball+0x3b>
+                fb[y * SCREEN_W + x] = color;
+  80154e:	42 8d 14 00          	lea    (%rax,%r8,1),%edx
+  801552:	48 63 d2             	movslq %edx,%rdx
+  801555:	4d 8b 32             	mov    (%r10),%r14
+  801558:	45 89 0c 96          	mov    %r9d,(%r14,%rdx,4)
+  80155c:	eb de                	jmp    80153c <draw_ball+0x3b>
+    for (int y = 0; y < SCREEN_H; ++y) {
+  80155e:	41 83 c3 01          	add    $0x1,%r11d
+  801562:	41 81 c0 80 02 00 00 	add    $0x280,%r8d
+  801569:	41 39 d8             	cmp    %ebx,%r8d
+  80156c:	74 0e                	je     80157c <draw_ball+0x7b>
+            if (delta.x * delta.x + delta.y * delta.y <= radius * radius) {
+  80156e:	44 89 d9             	mov    %r11d,%ecx
+  801571:	41 0f af cb          	imul   %r11d,%ecx
+  801575:	44 89 e0             	mov    %r12d,%eax
+  801578:	f7 d8                	neg    %eax
+  80157a:	eb c7                	jmp    801543 <draw_ball+0x42>
+            }
+        }
+    }
+}
+  80157c:	5b                   	pop    %rbx
+  80157d:	41 5c                	pop    %r12
+  80157f:	41 5e                	pop    %r14
+  801581:	5d                   	pop    %rbp
+  801582:	c3                   	ret
+
+0000000000801583 <draw_rect>:
+
+void
+draw_rect(struct vec2i start, struct vec2i end, uint32_t color) {
+  801583:	41 89 d0             	mov    %edx,%r8d
+  801586:	48 89 f9             	mov    %rdi,%rcx
+  801589:	48 c1 f9 20          	sar    $0x20,%rcx
+  80158d:	48 89 f0             	mov    %rsi,%rax
+  801590:	48 c1 f8 20          	sar    $0x20,%rax
+    if (start.x > end.x) {
+  801594:	39 f7                	cmp    %esi,%edi
+  801596:	41 89 f2             	mov    %esi,%r10d
+  801599:	44 0f 4e d7          	cmovle %edi,%r10d
+  80159d:	0f 4f f7             	cmovg  %edi,%esi
+        int tmp = start.x;
+        start.x = end.x;
+        end.x = tmp;
+    }
+
+    if (start.y > end.y) {
+  8015a0:	39 c1                	cmp    %eax,%ecx
+  8015a2:	89 c2                	mov    %eax,%edx
+  8015a4:	0f 4e d1             	cmovle %ecx,%edx
+  8015a7:	0f 4f c1             	cmovg  %ecx,%eax
+        int tmp = start.y;
+        start.y = end.y;
+        end.y = tmp;
+    }
+
+    start.x = MAX(start.x, 0);
+  8015aa:	45 85 d2             	test   %r10d,%r10d
+  8015ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b2:	44 0f 48 d1          	cmovs  %ecx,%r10d
+    start.y = MAX(start.y, 0);
+  8015b6:	85 d2                	test   %edx,%edx
+  8015b8:	0f 48 d1             	cmovs  %ecx,%edx
+    end.x = MIN(end.x, SCREEN_W);
+  8015bb:	b9 80 02 00 00       	mov    $0x280,%ecx
+  8015c0:	39 ce                	cmp    %ecx,%esi
+  8015c2:	0f 4e ce             	cmovle %esi,%ecx
+  8015c5:	41 89 c9             	mov    %ecx,%r9d
+    end.y = MIN(end.y, SCREEN_H);
+  8015c8:	b9 90 01 00 00       	mov    $0x190,%ecx
+  8015cd:	39 c8                	cmp    %ecx,%eax
+  8015cf:	0f 4f c1             	cmovg  %ecx,%eax
+    
+
+    for (int y = start.y; y < end.y; ++y) {
+  8015d2:	39 c2                	cmp    %eax,%edx
+  8015d4:	7d 66                	jge    80163c <draw_rect+0xb9>
+draw_rect(struct vec2i start, struct vec2i end, uint32_t color) {
+  8015d6:	55                   	push   %rbp
+  8015d7:	48 89 e5             	mov    %rsp,%rbp
+  8015da:	41 54                	push   %r12
+  8015dc:	53                   	push   %rbx
+  8015dd:	8d 3c 92             	lea    (%rdx,%rdx,4),%edi
+  8015e0:	c1 e7 07             	shl    $0x7,%edi
+  8015e3:	44 8d 1c 80          	lea    (%rax,%rax,4),%r11d
+  8015e7:	41 c1 e3 07          	shl    $0x7,%r11d
+  8015eb:	4d 63 e2             	movslq %r10d,%r12
+  8015ee:	44 89 cb             	mov    %r9d,%ebx
+  8015f1:	44 29 d3             	sub    %r10d,%ebx
+  8015f4:	4c 01 e3             	add    %r12,%rbx
+        for (int x = start.x; x < end.x; ++x) {
+            fb[y * SCREEN_W + x] = color;
+  8015f7:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  8015fe:	00 00 00 
+  801601:	eb 2d                	jmp    801630 <draw_rect+0xad>
+  801603:	48 63 cf             	movslq %edi,%rcx
+  801606:	4a 8d 04 21          	lea    (%rcx,%r12,1),%rax
+  80160a:	48 c1 e0 02          	shl    $0x2,%rax
+  80160e:	48 01 d9             	add    %rbx,%rcx
+  801611:	48 c1 e1 02          	shl    $0x2,%rcx
+  801615:	48 8b 16             	mov    (%rsi),%rdx
+  801618:	44 89 04 02          	mov    %r8d,(%rdx,%rax,1)
+        for (int x = start.x; x < end.x; ++x) {
+  80161c:	48 83 c0 04          	add    $0x4,%rax
+  801620:	48 39 c8             	cmp    %rcx,%rax
+  801623:	75 f0                	jne    801615 <draw_rect+0x92>
+    for (int y = start.y; y < end.y; ++y) {
+  801625:	81 c7 80 02 00 00    	add    $0x280,%edi
+  80162b:	44 39 df             	cmp    %r11d,%edi
+  80162e:	74 07                	je     801637 <draw_rect+0xb4>
+        for (int x = start.x; x < end.x; ++x) {
+  801630:	45 39 ca             	cmp    %r9d,%r10d
+  801633:	7c ce                	jl     801603 <draw_rect+0x80>
+  801635:	eb ee                	jmp    801625 <draw_rect+0xa2>
+        }
+    }
+}
+  801637:	5b                   	pop    %rbx
+  801638:	41 5c                	pop    %r12
+  80163a:	5d                   	pop    %rbp
+  80163b:	c3                   	ret
+  80163c:	c3                   	ret
+
+000000000080163d <draw_pens>:
+
+
+void
+draw_pens(struct vec2i root, unsigned ball_radius, unsigned stem_length, unsigned stem_radius, uint32_t color) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	41 57                	push   %r15
+  801643:	41 56                	push   %r14
+  801645:	41 55                	push   %r13
+  801647:	41 54                	push   %r12
+  801649:	53                   	push   %rbx
+  80164a:	48 83 ec 28          	sub    $0x28,%rsp
+  80164e:	48 89 fb             	mov    %rdi,%rbx
+  801651:	41 89 f4             	mov    %esi,%r12d
+  801654:	89 55 c8             	mov    %edx,-0x38(%rbp)
+  801657:	89 4d c4             	mov    %ecx,-0x3c(%rbp)
+  80165a:	45 89 c5             	mov    %r8d,%r13d
+  80165d:	49 89 ff             	mov    %rdi,%r15
+  801660:	49 c1 ff 20          	sar    $0x20,%r15
+    draw_ball((struct vec2i){root.x - ball_radius, root.y}, ball_radius, color);
+  801664:	4c 89 f8             	mov    %r15,%rax
+  801667:	48 c1 e0 20          	shl    $0x20,%rax
+  80166b:	29 f7                	sub    %esi,%edi
+  80166d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801671:	48 09 c7             	or     %rax,%rdi
+  801674:	44 89 c2             	mov    %r8d,%edx
+  801677:	49 be 01 15 80 00 00 	movabs $0x801501,%r14
+  80167e:	00 00 00 
+  801681:	41 ff d6             	call   *%r14
+    draw_ball((struct vec2i){root.x + ball_radius, root.y}, ball_radius, color);
+  801684:	41 8d 3c 1c          	lea    (%r12,%rbx,1),%edi
+  801688:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80168c:	48 09 c7             	or     %rax,%rdi
+  80168f:	44 89 ea             	mov    %r13d,%edx
+  801692:	44 89 e6             	mov    %r12d,%esi
+  801695:	41 ff d6             	call   *%r14
+    draw_rect((struct vec2i){root.x - stem_radius, root.y + ball_radius / 2}, (struct vec2i){root.x + stem_radius, root.y - stem_length}, color);
+  801698:	44 89 f8             	mov    %r15d,%eax
+  80169b:	8b 55 c8             	mov    -0x38(%rbp),%edx
+  80169e:	29 d0                	sub    %edx,%eax
+  8016a0:	48 c1 e0 20          	shl    $0x20,%rax
+  8016a4:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8016a7:	8d 34 19             	lea    (%rcx,%rbx,1),%esi
+  8016aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8016ae:	48 09 c6             	or     %rax,%rsi
+  8016b1:	41 d1 ec             	shr    %r12d
+  8016b4:	43 8d 04 3c          	lea    (%r12,%r15,1),%eax
+  8016b8:	48 c1 e0 20          	shl    $0x20,%rax
+  8016bc:	89 df                	mov    %ebx,%edi
+  8016be:	41 89 cf             	mov    %ecx,%r15d
+  8016c1:	29 cf                	sub    %ecx,%edi
+  8016c3:	48 09 c7             	or     %rax,%rdi
+  8016c6:	44 89 ea             	mov    %r13d,%edx
+  8016c9:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  8016d0:	00 00 00 
+  8016d3:	ff d0                	call   *%rax
+    draw_ball((struct vec2i){root.x, root.y - stem_length}, stem_radius, color);
+  8016d5:	89 df                	mov    %ebx,%edi
+  8016d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016db:	48 09 c7             	or     %rax,%rdi
+  8016de:	44 89 ea             	mov    %r13d,%edx
+  8016e1:	44 89 fe             	mov    %r15d,%esi
+  8016e4:	41 ff d6             	call   *%r14
+}
+  8016e7:	48 83 c4 28          	add    $0x28,%rsp
+  8016eb:	5b                   	pop    %rbx
+  8016ec:	41 5c                	pop    %r12
+  8016ee:	41 5d                	pop    %r13
+  8016f0:	41 5e                	pop    %r14
+  8016f2:	41 5f                	pop    %r15
+  8016f4:	5d                   	pop    %rbp
+  8016f5:	c3                   	ret
+
+00000000008016f6 <umain>:
+
+
+void
+umain(int argc, char **argv) {
+  8016f6:	55                   	push   %rbp
+  8016f7:	48 89 e5             	mov    %rsp,%rbp
+  8016fa:	48 81 ec a0 1f 00 00 	sub    $0x1fa0,%rsp
+    // char *s2 = malloc(10);
+
+    // sscanf(buf, "%s %d %s", s1, &n, s2);
+    // printf("%s|%d|%s\n", s1, n, s2);
+
+    int res = sys_virtiogpu_init(&fb);
+  801701:	48 bf 20 80 80 01 00 	movabs $0x1808020,%rdi
+  801708:	00 00 00 
+  80170b:	48 b8 f8 30 80 00 00 	movabs $0x8030f8,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+    assert(res >= 0);
+  801717:	85 c0                	test   %eax,%eax
+  801719:	0f 88 c5 00 00 00    	js     8017e4 <umain+0xee>
+    printf("fb = %p\n", fb);
+  80171f:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  801726:	00 00 00 
+  801729:	48 8b 30             	mov    (%rax),%rsi
+  80172c:	48 bf 6c 5f 80 00 00 	movabs $0x805f6c,%rdi
+  801733:	00 00 00 
+  801736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173b:	48 ba e5 04 80 00 00 	movabs $0x8004e5,%rdx
+  801742:	00 00 00 
+  801745:	ff d2                	call   *%rdx
+    //     for (unsigned x = 0; x < SCREEN_W; ++x) {
+    //         fb[y * SCREEN_W + x] = 0x000000FF;
+    //     }
+    // }
+
+    draw_rect((struct vec2i){0, 0}, (struct vec2i){SCREEN_W, SCREEN_H}, 0xFF000000);
+  801747:	ba 00 00 00 ff       	mov    $0xff000000,%edx
+  80174c:	48 be 80 02 00 00 90 	movabs $0x19000000280,%rsi
+  801753:	01 00 00 
+  801756:	bf 00 00 00 00       	mov    $0x0,%edi
+  80175b:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801762:	00 00 00 
+  801765:	ff d0                	call   *%rax
+
+    #ifdef PLEASE_DRAW_SOME_PENS
+    draw_pens((struct vec2i){SCREEN_W / 2, SCREEN_H - 50}, 25, 200, 10, 0xFF0000FF);
+    #endif
+    
+    res = sys_virtiogpu_flush();
+  801767:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176c:	48 ba 2d 31 80 00 00 	movabs $0x80312d,%rdx
+  801773:	00 00 00 
+  801776:	ff d2                	call   *%rdx
+    assert(res >= 0);
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	0f 88 99 00 00 00    	js     801819 <umain+0x123>
+
+    // libc_fprintf(file, "ABOBA[%s]", "typotype");
+
+    // fclose(file);
+
+    libc_FILE *file = fopen("lorem", "r");
+  801780:	48 be 17 60 80 00 00 	movabs $0x806017,%rsi
+  801787:	00 00 00 
+  80178a:	48 bf 75 5f 80 00 00 	movabs $0x805f75,%rdi
+  801791:	00 00 00 
+  801794:	48 b8 e2 05 80 00 00 	movabs $0x8005e2,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+  8017a0:	48 89 c1             	mov    %rax,%rcx
+
+    char buf[8096];
+
+    libc_fread(buf, 1, 8096, file);
+  8017a3:	ba a0 1f 00 00       	mov    $0x1fa0,%edx
+  8017a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8017ad:	48 8d bd 60 e0 ff ff 	lea    -0x1fa0(%rbp),%rdi
+  8017b4:	48 b8 20 08 80 00 00 	movabs $0x800820,%rax
+  8017bb:	00 00 00 
+  8017be:	ff d0                	call   *%rax
+    printf("%s\n", buf);
+  8017c0:	48 8d b5 60 e0 ff ff 	lea    -0x1fa0(%rbp),%rsi
+  8017c7:	48 bf 7b 5f 80 00 00 	movabs $0x805f7b,%rdi
+  8017ce:	00 00 00 
+  8017d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d6:	48 ba e5 04 80 00 00 	movabs $0x8004e5,%rdx
+  8017dd:	00 00 00 
+  8017e0:	ff d2                	call   *%rdx
+}
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+    assert(res >= 0);
+  8017e4:	48 b9 42 5f 80 00 00 	movabs $0x805f42,%rcx
+  8017eb:	00 00 00 
+  8017ee:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  8017f5:	00 00 00 
+  8017f8:	be 5a 00 00 00       	mov    $0x5a,%esi
+  8017fd:	48 bf 60 5f 80 00 00 	movabs $0x805f60,%rdi
+  801804:	00 00 00 
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  801813:	00 00 00 
+  801816:	41 ff d0             	call   *%r8
+    assert(res >= 0);
+  801819:	48 b9 42 5f 80 00 00 	movabs $0x805f42,%rcx
+  801820:	00 00 00 
+  801823:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  80182a:	00 00 00 
+  80182d:	be 6a 00 00 00       	mov    $0x6a,%esi
+  801832:	48 bf 60 5f 80 00 00 	movabs $0x805f60,%rdi
+  801839:	00 00 00 
+  80183c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801841:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  801848:	00 00 00 
+  80184b:	41 ff d0             	call   *%r8
+
+000000000080184e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80184e:	55                   	push   %rbp
+  80184f:	48 89 e5             	mov    %rsp,%rbp
+  801852:	41 56                	push   %r14
+  801854:	41 55                	push   %r13
+  801856:	41 54                	push   %r12
+  801858:	53                   	push   %rbx
+  801859:	41 89 fd             	mov    %edi,%r13d
+  80185c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80185f:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801866:	00 00 00 
+  801869:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801870:	00 00 00 
+  801873:	48 39 c2             	cmp    %rax,%rdx
+  801876:	73 17                	jae    80188f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801878:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80187b:	49 89 c4             	mov    %rax,%r12
+  80187e:	48 83 c3 08          	add    $0x8,%rbx
+  801882:	b8 00 00 00 00       	mov    $0x0,%eax
+  801887:	ff 53 f8             	call   *-0x8(%rbx)
+  80188a:	4c 39 e3             	cmp    %r12,%rbx
+  80188d:	72 ef                	jb     80187e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80188f:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  801896:	00 00 00 
+  801899:	ff d0                	call   *%rax
+  80189b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018a0:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8018a7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018ae:	00 00 00 
+  8018b1:	48 01 d0             	add    %rdx,%rax
+  8018b4:	48 a3 28 80 80 01 00 	movabs %rax,0x1808028
+  8018bb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8018be:	45 85 ed             	test   %r13d,%r13d
+  8018c1:	7e 0d                	jle    8018d0 <libmain+0x82>
+  8018c3:	49 8b 06             	mov    (%r14),%rax
+  8018c6:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018cd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018d0:	4c 89 f6             	mov    %r14,%rsi
+  8018d3:	44 89 ef             	mov    %r13d,%edi
+  8018d6:	48 b8 f6 16 80 00 00 	movabs $0x8016f6,%rax
+  8018dd:	00 00 00 
+  8018e0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018e2:	48 b8 f7 18 80 00 00 	movabs $0x8018f7,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+#endif
+}
+  8018ee:	5b                   	pop    %rbx
+  8018ef:	41 5c                	pop    %r12
+  8018f1:	41 5d                	pop    %r13
+  8018f3:	41 5e                	pop    %r14
+  8018f5:	5d                   	pop    %rbp
+  8018f6:	c3                   	ret
+
+00000000008018f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018f7:	55                   	push   %rbp
+  8018f8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018fb:	48 b8 8a 33 80 00 00 	movabs $0x80338a,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801907:	bf 00 00 00 00       	mov    $0x0,%edi
+  80190c:	48 b8 bd 29 80 00 00 	movabs $0x8029bd,%rax
+  801913:	00 00 00 
+  801916:	ff d0                	call   *%rax
+}
+  801918:	5d                   	pop    %rbp
+  801919:	c3                   	ret
+
+000000000080191a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80191a:	55                   	push   %rbp
+  80191b:	48 89 e5             	mov    %rsp,%rbp
+  80191e:	41 56                	push   %r14
+  801920:	41 55                	push   %r13
+  801922:	41 54                	push   %r12
+  801924:	53                   	push   %rbx
+  801925:	48 83 ec 50          	sub    $0x50,%rsp
+  801929:	49 89 fc             	mov    %rdi,%r12
+  80192c:	41 89 f5             	mov    %esi,%r13d
+  80192f:	48 89 d3             	mov    %rdx,%rbx
+  801932:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801936:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80193a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80193e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801945:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801949:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80194d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801951:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801955:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80195c:	00 00 00 
+  80195f:	4c 8b 30             	mov    (%rax),%r14
+  801962:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  801969:	00 00 00 
+  80196c:	ff d0                	call   *%rax
+  80196e:	89 c6                	mov    %eax,%esi
+  801970:	45 89 e8             	mov    %r13d,%r8d
+  801973:	4c 89 e1             	mov    %r12,%rcx
+  801976:	4c 89 f2             	mov    %r14,%rdx
+  801979:	48 bf 90 5f 80 00 00 	movabs $0x805f90,%rdi
+  801980:	00 00 00 
+  801983:	b8 00 00 00 00       	mov    $0x0,%eax
+  801988:	49 bc 6a 1a 80 00 00 	movabs $0x801a6a,%r12
+  80198f:	00 00 00 
+  801992:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801995:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801999:	48 89 df             	mov    %rbx,%rdi
+  80199c:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  8019a3:	00 00 00 
+  8019a6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8019a8:	48 bf 73 65 80 00 00 	movabs $0x806573,%rdi
+  8019af:	00 00 00 
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8019ba:	cc                   	int3
+  8019bb:	eb fd                	jmp    8019ba <_panic+0xa0>
+
+00000000008019bd <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	53                   	push   %rbx
+  8019c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8019c6:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8019c9:	8b 06                	mov    (%rsi),%eax
+  8019cb:	8d 50 01             	lea    0x1(%rax),%edx
+  8019ce:	89 16                	mov    %edx,(%rsi)
+  8019d0:	48 98                	cltq
+  8019d2:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019d7:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019dd:	74 0a                	je     8019e9 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019df:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019e7:	c9                   	leave
+  8019e8:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019e9:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019ed:	be ff 00 00 00       	mov    $0xff,%esi
+  8019f2:	48 b8 1e 29 80 00 00 	movabs $0x80291e,%rax
+  8019f9:	00 00 00 
+  8019fc:	ff d0                	call   *%rax
+        state->offset = 0;
+  8019fe:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801a04:	eb d9                	jmp    8019df <putch+0x22>
+
+0000000000801a06 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801a06:	55                   	push   %rbp
+  801a07:	48 89 e5             	mov    %rsp,%rbp
+  801a0a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801a11:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801a14:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801a1b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a25:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a28:	48 89 f1             	mov    %rsi,%rcx
+  801a2b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a32:	48 bf bd 19 80 00 00 	movabs $0x8019bd,%rdi
+  801a39:	00 00 00 
+  801a3c:	48 b8 ba 1b 80 00 00 	movabs $0x801bba,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a48:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a4f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a56:	48 b8 1e 29 80 00 00 	movabs $0x80291e,%rax
+  801a5d:	00 00 00 
+  801a60:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a62:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a68:	c9                   	leave
+  801a69:	c3                   	ret
+
+0000000000801a6a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a6a:	55                   	push   %rbp
+  801a6b:	48 89 e5             	mov    %rsp,%rbp
+  801a6e:	48 83 ec 50          	sub    $0x50,%rsp
+  801a72:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a76:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a7a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a7e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a82:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a86:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a8d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a95:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a99:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a9d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801aa1:	48 b8 06 1a 80 00 00 	movabs $0x801a06,%rax
+  801aa8:	00 00 00 
+  801aab:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801aad:	c9                   	leave
+  801aae:	c3                   	ret
+
+0000000000801aaf <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801aaf:	55                   	push   %rbp
+  801ab0:	48 89 e5             	mov    %rsp,%rbp
+  801ab3:	41 57                	push   %r15
+  801ab5:	41 56                	push   %r14
+  801ab7:	41 55                	push   %r13
+  801ab9:	41 54                	push   %r12
+  801abb:	53                   	push   %rbx
+  801abc:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac0:	49 89 fc             	mov    %rdi,%r12
+  801ac3:	49 89 f5             	mov    %rsi,%r13
+  801ac6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801aca:	8b 45 10             	mov    0x10(%rbp),%eax
+  801acd:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ad0:	41 89 cf             	mov    %ecx,%r15d
+  801ad3:	4c 39 fa             	cmp    %r15,%rdx
+  801ad6:	73 5b                	jae    801b33 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ad8:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801adc:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801ae0:	85 db                	test   %ebx,%ebx
+  801ae2:	7e 0e                	jle    801af2 <print_num+0x43>
+            putch(padc, put_arg);
+  801ae4:	4c 89 ee             	mov    %r13,%rsi
+  801ae7:	44 89 f7             	mov    %r14d,%edi
+  801aea:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801aed:	83 eb 01             	sub    $0x1,%ebx
+  801af0:	75 f2                	jne    801ae4 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801af2:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801af6:	48 b9 c4 5f 80 00 00 	movabs $0x805fc4,%rcx
+  801afd:	00 00 00 
+  801b00:	48 b8 b3 5f 80 00 00 	movabs $0x805fb3,%rax
+  801b07:	00 00 00 
+  801b0a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801b0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b17:	49 f7 f7             	div    %r15
+  801b1a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801b1e:	4c 89 ee             	mov    %r13,%rsi
+  801b21:	41 ff d4             	call   *%r12
+}
+  801b24:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b28:	5b                   	pop    %rbx
+  801b29:	41 5c                	pop    %r12
+  801b2b:	41 5d                	pop    %r13
+  801b2d:	41 5e                	pop    %r14
+  801b2f:	41 5f                	pop    %r15
+  801b31:	5d                   	pop    %rbp
+  801b32:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b37:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3c:	49 f7 f7             	div    %r15
+  801b3f:	48 83 ec 08          	sub    $0x8,%rsp
+  801b43:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b47:	52                   	push   %rdx
+  801b48:	45 0f be c9          	movsbl %r9b,%r9d
+  801b4c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b50:	48 89 c2             	mov    %rax,%rdx
+  801b53:	48 b8 af 1a 80 00 00 	movabs $0x801aaf,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	48 83 c4 10          	add    $0x10,%rsp
+  801b63:	eb 8d                	jmp    801af2 <print_num+0x43>
+
+0000000000801b65 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b65:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b69:	48 8b 06             	mov    (%rsi),%rax
+  801b6c:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b70:	73 0a                	jae    801b7c <sprintputch+0x17>
+        *state->start++ = ch;
+  801b72:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b76:	48 89 16             	mov    %rdx,(%rsi)
+  801b79:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b7c:	c3                   	ret
+
+0000000000801b7d <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b7d:	55                   	push   %rbp
+  801b7e:	48 89 e5             	mov    %rsp,%rbp
+  801b81:	48 83 ec 50          	sub    $0x50,%rsp
+  801b85:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b89:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b8d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b91:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b98:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ba4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801ba8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801bac:	48 b8 ba 1b 80 00 00 	movabs $0x801bba,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+}
+  801bb8:	c9                   	leave
+  801bb9:	c3                   	ret
+
+0000000000801bba <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801bba:	55                   	push   %rbp
+  801bbb:	48 89 e5             	mov    %rsp,%rbp
+  801bbe:	41 57                	push   %r15
+  801bc0:	41 56                	push   %r14
+  801bc2:	41 55                	push   %r13
+  801bc4:	41 54                	push   %r12
+  801bc6:	53                   	push   %rbx
+  801bc7:	48 83 ec 38          	sub    $0x38,%rsp
+  801bcb:	49 89 fe             	mov    %rdi,%r14
+  801bce:	49 89 f5             	mov    %rsi,%r13
+  801bd1:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801bd4:	48 8b 01             	mov    (%rcx),%rax
+  801bd7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801bdb:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801be3:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801be7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801beb:	eb 0d                	jmp    801bfa <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bed:	40 0f b6 ff          	movzbl %dil,%edi
+  801bf1:	4c 89 ee             	mov    %r13,%rsi
+  801bf4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801bf7:	4c 89 e3             	mov    %r12,%rbx
+  801bfa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801bfe:	0f b6 3b             	movzbl (%rbx),%edi
+  801c01:	40 80 ff 25          	cmp    $0x25,%dil
+  801c05:	74 14                	je     801c1b <vprintfmt+0x61>
+            if (!ch) return;
+  801c07:	40 84 ff             	test   %dil,%dil
+  801c0a:	75 e1                	jne    801bed <vprintfmt+0x33>
+}
+  801c0c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c10:	5b                   	pop    %rbx
+  801c11:	41 5c                	pop    %r12
+  801c13:	41 5d                	pop    %r13
+  801c15:	41 5e                	pop    %r14
+  801c17:	41 5f                	pop    %r15
+  801c19:	5d                   	pop    %rbp
+  801c1a:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801c1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801c20:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801c24:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c29:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c2f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c36:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c3a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c3f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c44:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c47:	83 e8 23             	sub    $0x23,%eax
+  801c4a:	3c 57                	cmp    $0x57,%al
+  801c4c:	0f 87 67 06 00 00    	ja     8022b9 <vprintfmt+0x6ff>
+  801c52:	0f b6 c0             	movzbl %al,%eax
+  801c55:	48 b9 60 61 80 00 00 	movabs $0x806160,%rcx
+  801c5c:	00 00 00 
+  801c5f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c62:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c65:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c69:	eb cf                	jmp    801c3a <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c6b:	49 89 dc             	mov    %rbx,%r12
+  801c6e:	be 01 00 00 00       	mov    $0x1,%esi
+  801c73:	eb c5                	jmp    801c3a <vprintfmt+0x80>
+            padc = ch;
+  801c75:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c79:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c7c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c7f:	eb b9                	jmp    801c3a <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c84:	83 f8 2f             	cmp    $0x2f,%eax
+  801c87:	77 24                	ja     801cad <vprintfmt+0xf3>
+  801c89:	89 c1                	mov    %eax,%ecx
+  801c8b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c8f:	83 c0 08             	add    $0x8,%eax
+  801c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c95:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c98:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c9b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c9f:	79 99                	jns    801c3a <vprintfmt+0x80>
+                width = precision;
+  801ca1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ca5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801cab:	eb 8d                	jmp    801c3a <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801cad:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801cb1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801cb5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb9:	eb da                	jmp    801c95 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801cbb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801cc0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cc4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801cca:	3c 39                	cmp    $0x39,%al
+  801ccc:	77 1c                	ja     801cea <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801cce:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801cd2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801cd6:	0f b6 c0             	movzbl %al,%eax
+  801cd9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cde:	0f b6 03             	movzbl (%rbx),%eax
+  801ce1:	3c 39                	cmp    $0x39,%al
+  801ce3:	76 e9                	jbe    801cce <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801ce5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ce8:	eb b1                	jmp    801c9b <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801cea:	49 89 dc             	mov    %rbx,%r12
+  801ced:	eb ac                	jmp    801c9b <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cef:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801cf2:	85 c9                	test   %ecx,%ecx
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	0f 49 c1             	cmovns %ecx,%eax
+  801cfc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801cff:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d02:	e9 33 ff ff ff       	jmp    801c3a <vprintfmt+0x80>
+            lflag++;
+  801d07:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d0a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d0d:	e9 28 ff ff ff       	jmp    801c3a <vprintfmt+0x80>
+            lflag--;
+  801d12:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801d15:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d18:	e9 1d ff ff ff       	jmp    801c3a <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801d1d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d20:	83 f8 2f             	cmp    $0x2f,%eax
+  801d23:	77 19                	ja     801d3e <vprintfmt+0x184>
+  801d25:	89 c2                	mov    %eax,%edx
+  801d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d2b:	83 c0 08             	add    $0x8,%eax
+  801d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d31:	8b 3a                	mov    (%rdx),%edi
+  801d33:	4c 89 ee             	mov    %r13,%rsi
+  801d36:	41 ff d6             	call   *%r14
+            break;
+  801d39:	e9 bc fe ff ff       	jmp    801bfa <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d4a:	eb e5                	jmp    801d31 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d52:	77 5a                	ja     801dae <vprintfmt+0x1f4>
+  801d54:	89 c2                	mov    %eax,%edx
+  801d56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5a:	83 c0 08             	add    $0x8,%eax
+  801d5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d60:	8b 02                	mov    (%rdx),%eax
+  801d62:	89 c1                	mov    %eax,%ecx
+  801d64:	f7 d9                	neg    %ecx
+  801d66:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d69:	83 f9 13             	cmp    $0x13,%ecx
+  801d6c:	7f 4e                	jg     801dbc <vprintfmt+0x202>
+  801d6e:	48 63 c1             	movslq %ecx,%rax
+  801d71:	48 ba 20 64 80 00 00 	movabs $0x806420,%rdx
+  801d78:	00 00 00 
+  801d7b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d7f:	48 85 c0             	test   %rax,%rax
+  801d82:	74 38                	je     801dbc <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d84:	48 89 c1             	mov    %rax,%rcx
+  801d87:	48 ba 5d 5f 80 00 00 	movabs $0x805f5d,%rdx
+  801d8e:	00 00 00 
+  801d91:	4c 89 ee             	mov    %r13,%rsi
+  801d94:	4c 89 f7             	mov    %r14,%rdi
+  801d97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9c:	49 b8 7d 1b 80 00 00 	movabs $0x801b7d,%r8
+  801da3:	00 00 00 
+  801da6:	41 ff d0             	call   *%r8
+  801da9:	e9 4c fe ff ff       	jmp    801bfa <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801dae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801db2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801db6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dba:	eb a4                	jmp    801d60 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801dbc:	48 ba dc 5f 80 00 00 	movabs $0x805fdc,%rdx
+  801dc3:	00 00 00 
+  801dc6:	4c 89 ee             	mov    %r13,%rsi
+  801dc9:	4c 89 f7             	mov    %r14,%rdi
+  801dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd1:	49 b8 7d 1b 80 00 00 	movabs $0x801b7d,%r8
+  801dd8:	00 00 00 
+  801ddb:	41 ff d0             	call   *%r8
+  801dde:	e9 17 fe ff ff       	jmp    801bfa <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801de3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801de6:	83 f8 2f             	cmp    $0x2f,%eax
+  801de9:	77 6c                	ja     801e57 <vprintfmt+0x29d>
+  801deb:	89 c2                	mov    %eax,%edx
+  801ded:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801df1:	83 c0 08             	add    $0x8,%eax
+  801df4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801df7:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801dfa:	48 85 f6             	test   %rsi,%rsi
+  801dfd:	48 b8 d5 5f 80 00 00 	movabs $0x805fd5,%rax
+  801e04:	00 00 00 
+  801e07:	48 0f 45 c6          	cmovne %rsi,%rax
+  801e0b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801e0f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801e13:	7e 06                	jle    801e1b <vprintfmt+0x261>
+  801e15:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801e19:	75 4a                	jne    801e65 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e1b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e1f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801e23:	0f b6 00             	movzbl (%rax),%eax
+  801e26:	84 c0                	test   %al,%al
+  801e28:	0f 85 9a 00 00 00    	jne    801ec8 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e2e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e31:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e35:	85 c0                	test   %eax,%eax
+  801e37:	0f 8e bd fd ff ff    	jle    801bfa <vprintfmt+0x40>
+  801e3d:	4c 89 ee             	mov    %r13,%rsi
+  801e40:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e45:	41 ff d6             	call   *%r14
+  801e48:	41 83 ec 01          	sub    $0x1,%r12d
+  801e4c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e50:	75 eb                	jne    801e3d <vprintfmt+0x283>
+  801e52:	e9 a3 fd ff ff       	jmp    801bfa <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e63:	eb 92                	jmp    801df7 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e65:	49 63 f7             	movslq %r15d,%rsi
+  801e68:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e6c:	48 b8 7e 23 80 00 00 	movabs $0x80237e,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+  801e78:	48 89 c2             	mov    %rax,%rdx
+  801e7b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e7e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e80:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e83:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	7e 91                	jle    801e1b <vprintfmt+0x261>
+  801e8a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e8f:	4c 89 ee             	mov    %r13,%rsi
+  801e92:	44 89 e7             	mov    %r12d,%edi
+  801e95:	41 ff d6             	call   *%r14
+  801e98:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e9c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801ea2:	75 eb                	jne    801e8f <vprintfmt+0x2d5>
+  801ea4:	e9 72 ff ff ff       	jmp    801e1b <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ea9:	0f b6 f8             	movzbl %al,%edi
+  801eac:	4c 89 ee             	mov    %r13,%rsi
+  801eaf:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801eb2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801eb6:	49 83 c4 01          	add    $0x1,%r12
+  801eba:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ec0:	84 c0                	test   %al,%al
+  801ec2:	0f 84 66 ff ff ff    	je     801e2e <vprintfmt+0x274>
+  801ec8:	45 85 ff             	test   %r15d,%r15d
+  801ecb:	78 0a                	js     801ed7 <vprintfmt+0x31d>
+  801ecd:	41 83 ef 01          	sub    $0x1,%r15d
+  801ed1:	0f 88 57 ff ff ff    	js     801e2e <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ed7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801edb:	74 cc                	je     801ea9 <vprintfmt+0x2ef>
+  801edd:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801ee0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ee5:	80 fa 5e             	cmp    $0x5e,%dl
+  801ee8:	77 c2                	ja     801eac <vprintfmt+0x2f2>
+  801eea:	eb bd                	jmp    801ea9 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801eec:	40 84 f6             	test   %sil,%sil
+  801eef:	75 26                	jne    801f17 <vprintfmt+0x35d>
+    switch (lflag) {
+  801ef1:	85 d2                	test   %edx,%edx
+  801ef3:	74 59                	je     801f4e <vprintfmt+0x394>
+  801ef5:	83 fa 01             	cmp    $0x1,%edx
+  801ef8:	74 7b                	je     801f75 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801efa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801efd:	83 f8 2f             	cmp    $0x2f,%eax
+  801f00:	0f 87 96 00 00 00    	ja     801f9c <vprintfmt+0x3e2>
+  801f06:	89 c2                	mov    %eax,%edx
+  801f08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0c:	83 c0 08             	add    $0x8,%eax
+  801f0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f12:	4c 8b 22             	mov    (%rdx),%r12
+  801f15:	eb 17                	jmp    801f2e <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801f17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f1a:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1d:	77 21                	ja     801f40 <vprintfmt+0x386>
+  801f1f:	89 c2                	mov    %eax,%edx
+  801f21:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f25:	83 c0 08             	add    $0x8,%eax
+  801f28:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f2b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f2e:	4d 85 e4             	test   %r12,%r12
+  801f31:	78 7a                	js     801fad <vprintfmt+0x3f3>
+            num = i;
+  801f33:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f3b:	e9 56 02 00 00       	jmp    802196 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f4c:	eb dd                	jmp    801f2b <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f51:	83 f8 2f             	cmp    $0x2f,%eax
+  801f54:	77 11                	ja     801f67 <vprintfmt+0x3ad>
+  801f56:	89 c2                	mov    %eax,%edx
+  801f58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5c:	83 c0 08             	add    $0x8,%eax
+  801f5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f62:	4c 63 22             	movslq (%rdx),%r12
+  801f65:	eb c7                	jmp    801f2e <vprintfmt+0x374>
+  801f67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f73:	eb ed                	jmp    801f62 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f78:	83 f8 2f             	cmp    $0x2f,%eax
+  801f7b:	77 11                	ja     801f8e <vprintfmt+0x3d4>
+  801f7d:	89 c2                	mov    %eax,%edx
+  801f7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f83:	83 c0 08             	add    $0x8,%eax
+  801f86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f89:	4c 8b 22             	mov    (%rdx),%r12
+  801f8c:	eb a0                	jmp    801f2e <vprintfmt+0x374>
+  801f8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f9a:	eb ed                	jmp    801f89 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fa0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fa4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa8:	e9 65 ff ff ff       	jmp    801f12 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801fad:	4c 89 ee             	mov    %r13,%rsi
+  801fb0:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801fb5:	41 ff d6             	call   *%r14
+                i = -i;
+  801fb8:	49 f7 dc             	neg    %r12
+  801fbb:	e9 73 ff ff ff       	jmp    801f33 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801fc0:	40 84 f6             	test   %sil,%sil
+  801fc3:	75 2e                	jne    801ff3 <vprintfmt+0x439>
+    switch (lflag) {
+  801fc5:	85 d2                	test   %edx,%edx
+  801fc7:	7f 59                	jg     802022 <vprintfmt+0x468>
+  801fc9:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fcc:	7d 7a                	jge    802048 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd1:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd4:	0f 87 aa 00 00 00    	ja     802084 <vprintfmt+0x4ca>
+  801fda:	89 c2                	mov    %eax,%edx
+  801fdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fe0:	83 c0 08             	add    $0x8,%eax
+  801fe3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fe9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fee:	e9 a3 01 00 00       	jmp    802196 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ff3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ff6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ff9:	77 19                	ja     802014 <vprintfmt+0x45a>
+  801ffb:	89 c2                	mov    %eax,%edx
+  801ffd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802001:	83 c0 08             	add    $0x8,%eax
+  802004:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802007:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80200a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80200f:	e9 82 01 00 00       	jmp    802196 <vprintfmt+0x5dc>
+  802014:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802018:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80201c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802020:	eb e5                	jmp    802007 <vprintfmt+0x44d>
+    switch (lflag) {
+  802022:	83 fa 01             	cmp    $0x1,%edx
+  802025:	75 a7                	jne    801fce <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802027:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80202a:	83 f8 2f             	cmp    $0x2f,%eax
+  80202d:	77 47                	ja     802076 <vprintfmt+0x4bc>
+  80202f:	89 c2                	mov    %eax,%edx
+  802031:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802035:	83 c0 08             	add    $0x8,%eax
+  802038:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80203e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802043:	e9 4e 01 00 00       	jmp    802196 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802048:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80204b:	83 f8 2f             	cmp    $0x2f,%eax
+  80204e:	77 18                	ja     802068 <vprintfmt+0x4ae>
+  802050:	89 c2                	mov    %eax,%edx
+  802052:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802056:	83 c0 08             	add    $0x8,%eax
+  802059:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80205c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80205e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802063:	e9 2e 01 00 00       	jmp    802196 <vprintfmt+0x5dc>
+  802068:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802070:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802074:	eb e6                	jmp    80205c <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802076:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80207a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80207e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802082:	eb b7                	jmp    80203b <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802084:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802088:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80208c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802090:	e9 51 ff ff ff       	jmp    801fe6 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802095:	40 84 f6             	test   %sil,%sil
+  802098:	75 2e                	jne    8020c8 <vprintfmt+0x50e>
+    switch (lflag) {
+  80209a:	85 d2                	test   %edx,%edx
+  80209c:	7f 59                	jg     8020f7 <vprintfmt+0x53d>
+  80209e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020a1:	7d 77                	jge    80211a <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8020a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a9:	0f 87 a4 00 00 00    	ja     802153 <vprintfmt+0x599>
+  8020af:	89 c2                	mov    %eax,%edx
+  8020b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b5:	83 c0 08             	add    $0x8,%eax
+  8020b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020bb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020be:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020c3:	e9 ce 00 00 00       	jmp    802196 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ce:	77 19                	ja     8020e9 <vprintfmt+0x52f>
+  8020d0:	89 c2                	mov    %eax,%edx
+  8020d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020d6:	83 c0 08             	add    $0x8,%eax
+  8020d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020dc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020df:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020e4:	e9 ad 00 00 00       	jmp    802196 <vprintfmt+0x5dc>
+  8020e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020f5:	eb e5                	jmp    8020dc <vprintfmt+0x522>
+    switch (lflag) {
+  8020f7:	83 fa 01             	cmp    $0x1,%edx
+  8020fa:	75 a7                	jne    8020a3 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ff:	83 f8 2f             	cmp    $0x2f,%eax
+  802102:	77 41                	ja     802145 <vprintfmt+0x58b>
+  802104:	89 c2                	mov    %eax,%edx
+  802106:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80210a:	83 c0 08             	add    $0x8,%eax
+  80210d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802110:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802113:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802118:	eb 7c                	jmp    802196 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80211a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80211d:	83 f8 2f             	cmp    $0x2f,%eax
+  802120:	77 15                	ja     802137 <vprintfmt+0x57d>
+  802122:	89 c2                	mov    %eax,%edx
+  802124:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802128:	83 c0 08             	add    $0x8,%eax
+  80212b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80212e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802130:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802135:	eb 5f                	jmp    802196 <vprintfmt+0x5dc>
+  802137:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80213f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802143:	eb e9                	jmp    80212e <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802145:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802149:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80214d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802151:	eb bd                	jmp    802110 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802153:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80215b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80215f:	e9 57 ff ff ff       	jmp    8020bb <vprintfmt+0x501>
+            putch('0', put_arg);
+  802164:	4c 89 ee             	mov    %r13,%rsi
+  802167:	bf 30 00 00 00       	mov    $0x30,%edi
+  80216c:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80216f:	4c 89 ee             	mov    %r13,%rsi
+  802172:	bf 78 00 00 00       	mov    $0x78,%edi
+  802177:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80217a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80217d:	83 f8 2f             	cmp    $0x2f,%eax
+  802180:	77 47                	ja     8021c9 <vprintfmt+0x60f>
+  802182:	89 c2                	mov    %eax,%edx
+  802184:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802188:	83 c0 08             	add    $0x8,%eax
+  80218b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80218e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802191:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802196:	48 83 ec 08          	sub    $0x8,%rsp
+  80219a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80219e:	0f 94 c0             	sete   %al
+  8021a1:	0f b6 c0             	movzbl %al,%eax
+  8021a4:	50                   	push   %rax
+  8021a5:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8021aa:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8021ae:	4c 89 ee             	mov    %r13,%rsi
+  8021b1:	4c 89 f7             	mov    %r14,%rdi
+  8021b4:	48 b8 af 1a 80 00 00 	movabs $0x801aaf,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+            break;
+  8021c0:	48 83 c4 10          	add    $0x10,%rsp
+  8021c4:	e9 31 fa ff ff       	jmp    801bfa <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8021c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021d5:	eb b7                	jmp    80218e <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021d7:	40 84 f6             	test   %sil,%sil
+  8021da:	75 2b                	jne    802207 <vprintfmt+0x64d>
+    switch (lflag) {
+  8021dc:	85 d2                	test   %edx,%edx
+  8021de:	7f 56                	jg     802236 <vprintfmt+0x67c>
+  8021e0:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021e3:	7d 77                	jge    80225c <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8021eb:	0f 87 a7 00 00 00    	ja     802298 <vprintfmt+0x6de>
+  8021f1:	89 c2                	mov    %eax,%edx
+  8021f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021f7:	83 c0 08             	add    $0x8,%eax
+  8021fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802200:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802205:	eb 8f                	jmp    802196 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802207:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80220a:	83 f8 2f             	cmp    $0x2f,%eax
+  80220d:	77 19                	ja     802228 <vprintfmt+0x66e>
+  80220f:	89 c2                	mov    %eax,%edx
+  802211:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802215:	83 c0 08             	add    $0x8,%eax
+  802218:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80221b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80221e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802223:	e9 6e ff ff ff       	jmp    802196 <vprintfmt+0x5dc>
+  802228:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80222c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802230:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802234:	eb e5                	jmp    80221b <vprintfmt+0x661>
+    switch (lflag) {
+  802236:	83 fa 01             	cmp    $0x1,%edx
+  802239:	75 aa                	jne    8021e5 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  80223b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80223e:	83 f8 2f             	cmp    $0x2f,%eax
+  802241:	77 47                	ja     80228a <vprintfmt+0x6d0>
+  802243:	89 c2                	mov    %eax,%edx
+  802245:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802249:	83 c0 08             	add    $0x8,%eax
+  80224c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80224f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802252:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802257:	e9 3a ff ff ff       	jmp    802196 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80225c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80225f:	83 f8 2f             	cmp    $0x2f,%eax
+  802262:	77 18                	ja     80227c <vprintfmt+0x6c2>
+  802264:	89 c2                	mov    %eax,%edx
+  802266:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80226a:	83 c0 08             	add    $0x8,%eax
+  80226d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802270:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802272:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802277:	e9 1a ff ff ff       	jmp    802196 <vprintfmt+0x5dc>
+  80227c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802280:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802284:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802288:	eb e6                	jmp    802270 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80228a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80228e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802292:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802296:	eb b7                	jmp    80224f <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802298:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80229c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022a4:	e9 54 ff ff ff       	jmp    8021fd <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8022a9:	4c 89 ee             	mov    %r13,%rsi
+  8022ac:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022b1:	41 ff d6             	call   *%r14
+            break;
+  8022b4:	e9 41 f9 ff ff       	jmp    801bfa <vprintfmt+0x40>
+            putch('%', put_arg);
+  8022b9:	4c 89 ee             	mov    %r13,%rsi
+  8022bc:	bf 25 00 00 00       	mov    $0x25,%edi
+  8022c1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8022c4:	48 83 eb 01          	sub    $0x1,%rbx
+  8022c8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022cc:	75 f6                	jne    8022c4 <vprintfmt+0x70a>
+  8022ce:	e9 27 f9 ff ff       	jmp    801bfa <vprintfmt+0x40>
+
+00000000008022d3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022d3:	55                   	push   %rbp
+  8022d4:	48 89 e5             	mov    %rsp,%rbp
+  8022d7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022db:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022df:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022e8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022ef:	48 85 ff             	test   %rdi,%rdi
+  8022f2:	74 2b                	je     80231f <vsnprintf+0x4c>
+  8022f4:	48 85 f6             	test   %rsi,%rsi
+  8022f7:	74 26                	je     80231f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022f9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022fd:	48 bf 65 1b 80 00 00 	movabs $0x801b65,%rdi
+  802304:	00 00 00 
+  802307:	48 b8 ba 1b 80 00 00 	movabs $0x801bba,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802313:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802317:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80231a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80231d:	c9                   	leave
+  80231e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80231f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802324:	eb f7                	jmp    80231d <vsnprintf+0x4a>
+
+0000000000802326 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802326:	55                   	push   %rbp
+  802327:	48 89 e5             	mov    %rsp,%rbp
+  80232a:	48 83 ec 50          	sub    $0x50,%rsp
+  80232e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802332:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802336:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80233a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802341:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802345:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802349:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80234d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802351:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802355:	48 b8 d3 22 80 00 00 	movabs $0x8022d3,%rax
+  80235c:	00 00 00 
+  80235f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802361:	c9                   	leave
+  802362:	c3                   	ret
+
+0000000000802363 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802363:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802366:	74 10                	je     802378 <strlen+0x15>
+    size_t n = 0;
+  802368:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80236d:	48 83 c0 01          	add    $0x1,%rax
+  802371:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802375:	75 f6                	jne    80236d <strlen+0xa>
+  802377:	c3                   	ret
+    size_t n = 0;
+  802378:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80237d:	c3                   	ret
+
+000000000080237e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80237e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802381:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802386:	48 85 f6             	test   %rsi,%rsi
+  802389:	74 11                	je     80239c <strnlen+0x1e>
+  80238b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80238f:	74 0c                	je     80239d <strnlen+0x1f>
+  802391:	48 83 c2 01          	add    $0x1,%rdx
+  802395:	48 39 d0             	cmp    %rdx,%rax
+  802398:	75 f1                	jne    80238b <strnlen+0xd>
+  80239a:	eb 04                	jmp    8023a0 <strnlen+0x22>
+  80239c:	c3                   	ret
+  80239d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8023a0:	c3                   	ret
+
+00000000008023a1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8023a1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8023a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8023ad:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8023b0:	48 83 c2 01          	add    $0x1,%rdx
+  8023b4:	84 c9                	test   %cl,%cl
+  8023b6:	75 f1                	jne    8023a9 <strcpy+0x8>
+        ;
+    return res;
+}
+  8023b8:	c3                   	ret
+
+00000000008023b9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8023b9:	55                   	push   %rbp
+  8023ba:	48 89 e5             	mov    %rsp,%rbp
+  8023bd:	41 54                	push   %r12
+  8023bf:	53                   	push   %rbx
+  8023c0:	48 89 fb             	mov    %rdi,%rbx
+  8023c3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8023c6:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  8023cd:	00 00 00 
+  8023d0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023d2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023d6:	4c 89 e6             	mov    %r12,%rsi
+  8023d9:	48 b8 a1 23 80 00 00 	movabs $0x8023a1,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+    return dst;
+}
+  8023e5:	48 89 d8             	mov    %rbx,%rax
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	5d                   	pop    %rbp
+  8023ec:	c3                   	ret
+
+00000000008023ed <toupper>:
+
+int
+toupper(int ch) {
+  8023ed:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023ef:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023f2:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023f5:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023f8:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023fb:	c3                   	ret
+
+00000000008023fc <tolower>:
+
+int
+tolower(int ch) {
+  8023fc:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8023fe:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802401:	8d 57 20             	lea    0x20(%rdi),%edx
+  802404:	83 f9 1a             	cmp    $0x1a,%ecx
+  802407:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80240a:	c3                   	ret
+
+000000000080240b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80240b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80240e:	48 85 d2             	test   %rdx,%rdx
+  802411:	74 1f                	je     802432 <strncpy+0x27>
+  802413:	48 01 fa             	add    %rdi,%rdx
+  802416:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802419:	48 83 c1 01          	add    $0x1,%rcx
+  80241d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802421:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802425:	41 80 f8 01          	cmp    $0x1,%r8b
+  802429:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80242d:	48 39 ca             	cmp    %rcx,%rdx
+  802430:	75 e7                	jne    802419 <strncpy+0xe>
+    }
+    return ret;
+}
+  802432:	c3                   	ret
+
+0000000000802433 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802433:	48 89 f8             	mov    %rdi,%rax
+  802436:	48 85 d2             	test   %rdx,%rdx
+  802439:	74 24                	je     80245f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80243b:	48 83 ea 01          	sub    $0x1,%rdx
+  80243f:	74 1b                	je     80245c <strlcpy+0x29>
+  802441:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802445:	0f b6 16             	movzbl (%rsi),%edx
+  802448:	84 d2                	test   %dl,%dl
+  80244a:	74 10                	je     80245c <strlcpy+0x29>
+            *dst++ = *src++;
+  80244c:	48 83 c6 01          	add    $0x1,%rsi
+  802450:	48 83 c0 01          	add    $0x1,%rax
+  802454:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802457:	48 39 c8             	cmp    %rcx,%rax
+  80245a:	75 e9                	jne    802445 <strlcpy+0x12>
+        *dst = '\0';
+  80245c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80245f:	48 29 f8             	sub    %rdi,%rax
+}
+  802462:	c3                   	ret
+
+0000000000802463 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802463:	0f b6 07             	movzbl (%rdi),%eax
+  802466:	84 c0                	test   %al,%al
+  802468:	74 13                	je     80247d <strcmp+0x1a>
+  80246a:	38 06                	cmp    %al,(%rsi)
+  80246c:	75 0f                	jne    80247d <strcmp+0x1a>
+  80246e:	48 83 c7 01          	add    $0x1,%rdi
+  802472:	48 83 c6 01          	add    $0x1,%rsi
+  802476:	0f b6 07             	movzbl (%rdi),%eax
+  802479:	84 c0                	test   %al,%al
+  80247b:	75 ed                	jne    80246a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80247d:	0f b6 c0             	movzbl %al,%eax
+  802480:	0f b6 16             	movzbl (%rsi),%edx
+  802483:	29 d0                	sub    %edx,%eax
+}
+  802485:	c3                   	ret
+
+0000000000802486 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802486:	48 85 d2             	test   %rdx,%rdx
+  802489:	74 1f                	je     8024aa <strncmp+0x24>
+  80248b:	0f b6 07             	movzbl (%rdi),%eax
+  80248e:	84 c0                	test   %al,%al
+  802490:	74 1e                	je     8024b0 <strncmp+0x2a>
+  802492:	3a 06                	cmp    (%rsi),%al
+  802494:	75 1a                	jne    8024b0 <strncmp+0x2a>
+  802496:	48 83 c7 01          	add    $0x1,%rdi
+  80249a:	48 83 c6 01          	add    $0x1,%rsi
+  80249e:	48 83 ea 01          	sub    $0x1,%rdx
+  8024a2:	75 e7                	jne    80248b <strncmp+0x5>
+
+    if (!n) return 0;
+  8024a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a9:	c3                   	ret
+  8024aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024af:	c3                   	ret
+  8024b0:	48 85 d2             	test   %rdx,%rdx
+  8024b3:	74 09                	je     8024be <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8024b5:	0f b6 07             	movzbl (%rdi),%eax
+  8024b8:	0f b6 16             	movzbl (%rsi),%edx
+  8024bb:	29 d0                	sub    %edx,%eax
+  8024bd:	c3                   	ret
+    if (!n) return 0;
+  8024be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024c3:	c3                   	ret
+
+00000000008024c4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8024c4:	0f b6 17             	movzbl (%rdi),%edx
+  8024c7:	84 d2                	test   %dl,%dl
+  8024c9:	74 18                	je     8024e3 <strchr+0x1f>
+        if (*str == c) {
+  8024cb:	0f be d2             	movsbl %dl,%edx
+  8024ce:	39 f2                	cmp    %esi,%edx
+  8024d0:	74 17                	je     8024e9 <strchr+0x25>
+    for (; *str; str++) {
+  8024d2:	48 83 c7 01          	add    $0x1,%rdi
+  8024d6:	0f b6 17             	movzbl (%rdi),%edx
+  8024d9:	84 d2                	test   %dl,%dl
+  8024db:	75 ee                	jne    8024cb <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e2:	c3                   	ret
+  8024e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e8:	c3                   	ret
+  8024e9:	48 89 f8             	mov    %rdi,%rax
+}
+  8024ec:	c3                   	ret
+
+00000000008024ed <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024ed:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024f0:	0f b6 17             	movzbl (%rdi),%edx
+  8024f3:	84 d2                	test   %dl,%dl
+  8024f5:	74 13                	je     80250a <strfind+0x1d>
+  8024f7:	0f be d2             	movsbl %dl,%edx
+  8024fa:	39 f2                	cmp    %esi,%edx
+  8024fc:	74 0b                	je     802509 <strfind+0x1c>
+  8024fe:	48 83 c0 01          	add    $0x1,%rax
+  802502:	0f b6 10             	movzbl (%rax),%edx
+  802505:	84 d2                	test   %dl,%dl
+  802507:	75 ee                	jne    8024f7 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802509:	c3                   	ret
+  80250a:	c3                   	ret
+
+000000000080250b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80250b:	48 39 f7             	cmp    %rsi,%rdi
+  80250e:	74 65                	je     802575 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802510:	55                   	push   %rbp
+  802511:	48 89 e5             	mov    %rsp,%rbp
+  802514:	41 57                	push   %r15
+  802516:	41 56                	push   %r14
+  802518:	41 55                	push   %r13
+  80251a:	41 54                	push   %r12
+  80251c:	53                   	push   %rbx
+  80251d:	48 83 ec 18          	sub    $0x18,%rsp
+  802521:	48 89 fb             	mov    %rdi,%rbx
+  802524:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802527:	49 bf fc 23 80 00 00 	movabs $0x8023fc,%r15
+  80252e:	00 00 00 
+  802531:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802535:	41 0f b6 fd          	movzbl %r13b,%edi
+  802539:	41 ff d7             	call   *%r15
+  80253c:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80253f:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802544:	41 0f b6 fe          	movzbl %r14b,%edi
+  802548:	41 ff d7             	call   *%r15
+  80254b:	89 c2                	mov    %eax,%edx
+  80254d:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802550:	29 d0                	sub    %edx,%eax
+  802552:	75 12                	jne    802566 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802554:	48 83 c3 01          	add    $0x1,%rbx
+  802558:	45 84 ed             	test   %r13b,%r13b
+  80255b:	74 09                	je     802566 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  80255d:	49 83 c4 01          	add    $0x1,%r12
+  802561:	45 84 f6             	test   %r14b,%r14b
+  802564:	75 cb                	jne    802531 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802566:	48 83 c4 18          	add    $0x18,%rsp
+  80256a:	5b                   	pop    %rbx
+  80256b:	41 5c                	pop    %r12
+  80256d:	41 5d                	pop    %r13
+  80256f:	41 5e                	pop    %r14
+  802571:	41 5f                	pop    %r15
+  802573:	5d                   	pop    %rbp
+  802574:	c3                   	ret
+    if (p1 == p2) return 0;
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80257a:	c3                   	ret
+
+000000000080257b <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80257b:	48 39 f7             	cmp    %rsi,%rdi
+  80257e:	74 7d                	je     8025fd <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802580:	55                   	push   %rbp
+  802581:	48 89 e5             	mov    %rsp,%rbp
+  802584:	41 57                	push   %r15
+  802586:	41 56                	push   %r14
+  802588:	41 55                	push   %r13
+  80258a:	41 54                	push   %r12
+  80258c:	53                   	push   %rbx
+  80258d:	48 83 ec 18          	sub    $0x18,%rsp
+  802591:	48 89 fb             	mov    %rdi,%rbx
+  802594:	49 89 f4             	mov    %rsi,%r12
+  802597:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80259b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80259f:	49 bf fc 23 80 00 00 	movabs $0x8023fc,%r15
+  8025a6:	00 00 00 
+    while (n--) {
+  8025a9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025ad:	48 39 c3             	cmp    %rax,%rbx
+  8025b0:	74 37                	je     8025e9 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8025b2:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025b6:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025ba:	41 ff d7             	call   *%r15
+  8025bd:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8025c0:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8025c5:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025c9:	41 ff d7             	call   *%r15
+  8025cc:	89 c2                	mov    %eax,%edx
+  8025ce:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025d1:	29 d0                	sub    %edx,%eax
+  8025d3:	75 19                	jne    8025ee <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025d5:	48 83 c3 01          	add    $0x1,%rbx
+  8025d9:	45 84 ed             	test   %r13b,%r13b
+  8025dc:	74 10                	je     8025ee <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025de:	49 83 c4 01          	add    $0x1,%r12
+  8025e2:	45 84 f6             	test   %r14b,%r14b
+  8025e5:	75 c2                	jne    8025a9 <strncasecmp+0x2e>
+  8025e7:	eb 05                	jmp    8025ee <strncasecmp+0x73>
+  8025e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025ee:	48 83 c4 18          	add    $0x18,%rsp
+  8025f2:	5b                   	pop    %rbx
+  8025f3:	41 5c                	pop    %r12
+  8025f5:	41 5d                	pop    %r13
+  8025f7:	41 5e                	pop    %r14
+  8025f9:	41 5f                	pop    %r15
+  8025fb:	5d                   	pop    %rbp
+  8025fc:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802602:	c3                   	ret
+
+0000000000802603 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802603:	83 e7 df             	and    $0xffffffdf,%edi
+  802606:	83 ef 41             	sub    $0x41,%edi
+  802609:	83 ff 19             	cmp    $0x19,%edi
+  80260c:	0f 96 c0             	setbe  %al
+}
+  80260f:	c3                   	ret
+
+0000000000802610 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802610:	83 ff 20             	cmp    $0x20,%edi
+  802613:	0f 94 c0             	sete   %al
+  802616:	83 ff 09             	cmp    $0x9,%edi
+  802619:	0f 94 c2             	sete   %dl
+  80261c:	09 d0                	or     %edx,%eax
+}
+  80261e:	c3                   	ret
+
+000000000080261f <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80261f:	55                   	push   %rbp
+  802620:	48 89 e5             	mov    %rsp,%rbp
+  802623:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802625:	48 bf df 64 80 00 00 	movabs $0x8064df,%rdi
+  80262c:	00 00 00 
+  80262f:	48 b8 c4 24 80 00 00 	movabs $0x8024c4,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+  80263b:	48 85 c0             	test   %rax,%rax
+  80263e:	0f 95 c0             	setne  %al
+}
+  802641:	5d                   	pop    %rbp
+  802642:	c3                   	ret
+
+0000000000802643 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802643:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802646:	48 89 f8             	mov    %rdi,%rax
+  802649:	48 f7 d8             	neg    %rax
+  80264c:	83 e0 07             	and    $0x7,%eax
+  80264f:	49 89 d1             	mov    %rdx,%r9
+  802652:	49 29 c1             	sub    %rax,%r9
+  802655:	78 36                	js     80268d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802657:	40 0f b6 c6          	movzbl %sil,%eax
+  80265b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802662:	01 01 01 
+  802665:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802669:	40 f6 c7 07          	test   $0x7,%dil
+  80266d:	75 38                	jne    8026a7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80266f:	4c 89 c9             	mov    %r9,%rcx
+  802672:	48 c1 f9 03          	sar    $0x3,%rcx
+  802676:	74 0c                	je     802684 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802678:	fc                   	cld
+  802679:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80267c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802680:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802684:	4d 85 c9             	test   %r9,%r9
+  802687:	75 45                	jne    8026ce <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802689:	4c 89 c0             	mov    %r8,%rax
+  80268c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80268d:	48 85 d2             	test   %rdx,%rdx
+  802690:	74 f7                	je     802689 <memset+0x46>
+  802692:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802695:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802698:	48 83 c0 01          	add    $0x1,%rax
+  80269c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8026a0:	48 39 c2             	cmp    %rax,%rdx
+  8026a3:	75 f3                	jne    802698 <memset+0x55>
+  8026a5:	eb e2                	jmp    802689 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8026a7:	40 f6 c7 01          	test   $0x1,%dil
+  8026ab:	74 06                	je     8026b3 <memset+0x70>
+  8026ad:	88 07                	mov    %al,(%rdi)
+  8026af:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026b3:	40 f6 c7 02          	test   $0x2,%dil
+  8026b7:	74 07                	je     8026c0 <memset+0x7d>
+  8026b9:	66 89 07             	mov    %ax,(%rdi)
+  8026bc:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026c0:	40 f6 c7 04          	test   $0x4,%dil
+  8026c4:	74 a9                	je     80266f <memset+0x2c>
+  8026c6:	89 07                	mov    %eax,(%rdi)
+  8026c8:	48 83 c7 04          	add    $0x4,%rdi
+  8026cc:	eb a1                	jmp    80266f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026ce:	41 f6 c1 04          	test   $0x4,%r9b
+  8026d2:	74 06                	je     8026da <memset+0x97>
+  8026d4:	89 07                	mov    %eax,(%rdi)
+  8026d6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026da:	41 f6 c1 02          	test   $0x2,%r9b
+  8026de:	74 07                	je     8026e7 <memset+0xa4>
+  8026e0:	66 89 07             	mov    %ax,(%rdi)
+  8026e3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026e7:	41 f6 c1 01          	test   $0x1,%r9b
+  8026eb:	74 9c                	je     802689 <memset+0x46>
+  8026ed:	88 07                	mov    %al,(%rdi)
+  8026ef:	eb 98                	jmp    802689 <memset+0x46>
+
+00000000008026f1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026f1:	48 89 f8             	mov    %rdi,%rax
+  8026f4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026f7:	48 39 fe             	cmp    %rdi,%rsi
+  8026fa:	73 3b                	jae    802737 <memmove+0x46>
+  8026fc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802700:	48 39 d7             	cmp    %rdx,%rdi
+  802703:	73 32                	jae    802737 <memmove+0x46>
+        s += n;
+        d += n;
+  802705:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802709:	48 89 d6             	mov    %rdx,%rsi
+  80270c:	48 09 fe             	or     %rdi,%rsi
+  80270f:	48 09 ce             	or     %rcx,%rsi
+  802712:	40 f6 c6 07          	test   $0x7,%sil
+  802716:	75 12                	jne    80272a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802718:	48 83 ef 08          	sub    $0x8,%rdi
+  80271c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802720:	48 c1 e9 03          	shr    $0x3,%rcx
+  802724:	fd                   	std
+  802725:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802728:	fc                   	cld
+  802729:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80272a:	48 83 ef 01          	sub    $0x1,%rdi
+  80272e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802732:	fd                   	std
+  802733:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802735:	eb f1                	jmp    802728 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802737:	48 89 f2             	mov    %rsi,%rdx
+  80273a:	48 09 c2             	or     %rax,%rdx
+  80273d:	48 09 ca             	or     %rcx,%rdx
+  802740:	f6 c2 07             	test   $0x7,%dl
+  802743:	75 0c                	jne    802751 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802745:	48 c1 e9 03          	shr    $0x3,%rcx
+  802749:	48 89 c7             	mov    %rax,%rdi
+  80274c:	fc                   	cld
+  80274d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802750:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802751:	48 89 c7             	mov    %rax,%rdi
+  802754:	fc                   	cld
+  802755:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802757:	c3                   	ret
+
+0000000000802758 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802758:	55                   	push   %rbp
+  802759:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80275c:	48 b8 f1 26 80 00 00 	movabs $0x8026f1,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+}
+  802768:	5d                   	pop    %rbp
+  802769:	c3                   	ret
+
+000000000080276a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80276a:	55                   	push   %rbp
+  80276b:	48 89 e5             	mov    %rsp,%rbp
+  80276e:	41 57                	push   %r15
+  802770:	41 56                	push   %r14
+  802772:	41 55                	push   %r13
+  802774:	41 54                	push   %r12
+  802776:	53                   	push   %rbx
+  802777:	48 83 ec 08          	sub    $0x8,%rsp
+  80277b:	49 89 fe             	mov    %rdi,%r14
+  80277e:	49 89 f7             	mov    %rsi,%r15
+  802781:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802784:	48 89 f7             	mov    %rsi,%rdi
+  802787:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  80278e:	00 00 00 
+  802791:	ff d0                	call   *%rax
+  802793:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802796:	48 89 de             	mov    %rbx,%rsi
+  802799:	4c 89 f7             	mov    %r14,%rdi
+  80279c:	48 b8 7e 23 80 00 00 	movabs $0x80237e,%rax
+  8027a3:	00 00 00 
+  8027a6:	ff d0                	call   *%rax
+  8027a8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027ab:	48 39 c3             	cmp    %rax,%rbx
+  8027ae:	74 36                	je     8027e6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8027b0:	48 89 d8             	mov    %rbx,%rax
+  8027b3:	4c 29 e8             	sub    %r13,%rax
+  8027b6:	49 39 c4             	cmp    %rax,%r12
+  8027b9:	73 31                	jae    8027ec <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8027bb:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8027c0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027c4:	4c 89 fe             	mov    %r15,%rsi
+  8027c7:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027d3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027d7:	48 83 c4 08          	add    $0x8,%rsp
+  8027db:	5b                   	pop    %rbx
+  8027dc:	41 5c                	pop    %r12
+  8027de:	41 5d                	pop    %r13
+  8027e0:	41 5e                	pop    %r14
+  8027e2:	41 5f                	pop    %r15
+  8027e4:	5d                   	pop    %rbp
+  8027e5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027e6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027ea:	eb eb                	jmp    8027d7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027ec:	48 83 eb 01          	sub    $0x1,%rbx
+  8027f0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027f4:	48 89 da             	mov    %rbx,%rdx
+  8027f7:	4c 89 fe             	mov    %r15,%rsi
+  8027fa:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  802801:	00 00 00 
+  802804:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802806:	49 01 de             	add    %rbx,%r14
+  802809:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80280e:	eb c3                	jmp    8027d3 <strlcat+0x69>
+
+0000000000802810 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802810:	48 85 d2             	test   %rdx,%rdx
+  802813:	74 2d                	je     802842 <memcmp+0x32>
+  802815:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80281a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80281e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802823:	44 38 c1             	cmp    %r8b,%cl
+  802826:	75 0f                	jne    802837 <memcmp+0x27>
+    while (n-- > 0) {
+  802828:	48 83 c0 01          	add    $0x1,%rax
+  80282c:	48 39 c2             	cmp    %rax,%rdx
+  80282f:	75 e9                	jne    80281a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802831:	b8 00 00 00 00       	mov    $0x0,%eax
+  802836:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802837:	0f b6 c1             	movzbl %cl,%eax
+  80283a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80283e:	44 29 c0             	sub    %r8d,%eax
+  802841:	c3                   	ret
+    return 0;
+  802842:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802847:	c3                   	ret
+
+0000000000802848 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802848:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80284c:	48 39 c7             	cmp    %rax,%rdi
+  80284f:	73 0f                	jae    802860 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802851:	40 38 37             	cmp    %sil,(%rdi)
+  802854:	74 0e                	je     802864 <memfind+0x1c>
+    for (; src < end; src++) {
+  802856:	48 83 c7 01          	add    $0x1,%rdi
+  80285a:	48 39 f8             	cmp    %rdi,%rax
+  80285d:	75 f2                	jne    802851 <memfind+0x9>
+  80285f:	c3                   	ret
+  802860:	48 89 f8             	mov    %rdi,%rax
+  802863:	c3                   	ret
+  802864:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802867:	c3                   	ret
+
+0000000000802868 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802868:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80286b:	0f b6 37             	movzbl (%rdi),%esi
+  80286e:	40 80 fe 20          	cmp    $0x20,%sil
+  802872:	74 06                	je     80287a <strtol+0x12>
+  802874:	40 80 fe 09          	cmp    $0x9,%sil
+  802878:	75 13                	jne    80288d <strtol+0x25>
+  80287a:	48 83 c7 01          	add    $0x1,%rdi
+  80287e:	0f b6 37             	movzbl (%rdi),%esi
+  802881:	40 80 fe 20          	cmp    $0x20,%sil
+  802885:	74 f3                	je     80287a <strtol+0x12>
+  802887:	40 80 fe 09          	cmp    $0x9,%sil
+  80288b:	74 ed                	je     80287a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80288d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802890:	83 e0 fd             	and    $0xfffffffd,%eax
+  802893:	3c 01                	cmp    $0x1,%al
+  802895:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802899:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80289f:	75 0f                	jne    8028b0 <strtol+0x48>
+  8028a1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8028a4:	74 14                	je     8028ba <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8028a6:	85 d2                	test   %edx,%edx
+  8028a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8028ad:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8028b0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8028b5:	4c 63 ca             	movslq %edx,%r9
+  8028b8:	eb 36                	jmp    8028f0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8028ba:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8028be:	74 0f                	je     8028cf <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8028c0:	85 d2                	test   %edx,%edx
+  8028c2:	75 ec                	jne    8028b0 <strtol+0x48>
+        s++;
+  8028c4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8028c8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028cd:	eb e1                	jmp    8028b0 <strtol+0x48>
+        s += 2;
+  8028cf:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028d3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028d8:	eb d6                	jmp    8028b0 <strtol+0x48>
+            dig -= '0';
+  8028da:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028dd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028e1:	41 39 d0             	cmp    %edx,%r8d
+  8028e4:	7d 21                	jge    802907 <strtol+0x9f>
+        val = val * base + dig;
+  8028e6:	49 0f af c1          	imul   %r9,%rax
+  8028ea:	0f b6 c9             	movzbl %cl,%ecx
+  8028ed:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028f0:	48 83 c7 01          	add    $0x1,%rdi
+  8028f4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028f8:	80 f9 39             	cmp    $0x39,%cl
+  8028fb:	76 dd                	jbe    8028da <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8028fd:	80 f9 7b             	cmp    $0x7b,%cl
+  802900:	77 05                	ja     802907 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802902:	83 e9 57             	sub    $0x57,%ecx
+  802905:	eb d6                	jmp    8028dd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802907:	4d 85 d2             	test   %r10,%r10
+  80290a:	74 03                	je     80290f <strtol+0xa7>
+  80290c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80290f:	48 89 c2             	mov    %rax,%rdx
+  802912:	48 f7 da             	neg    %rdx
+  802915:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802919:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80291d:	c3                   	ret
+
+000000000080291e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80291e:	55                   	push   %rbp
+  80291f:	48 89 e5             	mov    %rsp,%rbp
+  802922:	53                   	push   %rbx
+  802923:	48 89 fa             	mov    %rdi,%rdx
+  802926:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802929:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80292e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802933:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802938:	be 00 00 00 00       	mov    $0x0,%esi
+  80293d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802943:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802949:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80294b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+
+0000000000802951 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802951:	55                   	push   %rbp
+  802952:	48 89 e5             	mov    %rsp,%rbp
+  802955:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802956:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80295b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802960:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802965:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80296a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80296f:	be 00 00 00 00       	mov    $0x0,%esi
+  802974:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80297a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802980:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802982:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802986:	c9                   	leave
+  802987:	c3                   	ret
+
+0000000000802988 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802988:	55                   	push   %rbp
+  802989:	48 89 e5             	mov    %rsp,%rbp
+  80298c:	53                   	push   %rbx
+  80298d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802990:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802995:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80299a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80299f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029b5:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8029b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029bb:	c9                   	leave
+  8029bc:	c3                   	ret
+
+00000000008029bd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8029bd:	55                   	push   %rbp
+  8029be:	48 89 e5             	mov    %rsp,%rbp
+  8029c1:	53                   	push   %rbx
+  8029c2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8029c6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029c9:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029ee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f0:	48 85 c0             	test   %rax,%rax
+  8029f3:	7f 06                	jg     8029fb <sys_env_destroy+0x3e>
+}
+  8029f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029f9:	c9                   	leave
+  8029fa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029fb:	49 89 c0             	mov    %rax,%r8
+  8029fe:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802a03:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802a0a:	00 00 00 
+  802a0d:	be 27 00 00 00       	mov    $0x27,%esi
+  802a12:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802a19:	00 00 00 
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a21:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802a28:	00 00 00 
+  802a2b:	41 ff d1             	call   *%r9
+
+0000000000802a2e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a33:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a38:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a5d:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a63:	c9                   	leave
+  802a64:	c3                   	ret
+
+0000000000802a65 <sys_yield>:
+
+void
+sys_yield(void) {
+  802a65:	55                   	push   %rbp
+  802a66:	48 89 e5             	mov    %rsp,%rbp
+  802a69:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a6a:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a74:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a7e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a83:	be 00 00 00 00       	mov    $0x0,%esi
+  802a88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a94:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a9a:	c9                   	leave
+  802a9b:	c3                   	ret
+
+0000000000802a9c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+  802aa0:	53                   	push   %rbx
+  802aa1:	48 89 fa             	mov    %rdi,%rdx
+  802aa4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802aa7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802aac:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802ab3:	00 00 00 
+  802ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802abb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ac6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802acc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ace:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ad2:	c9                   	leave
+  802ad3:	c3                   	ret
+
+0000000000802ad4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802ad4:	55                   	push   %rbp
+  802ad5:	48 89 e5             	mov    %rsp,%rbp
+  802ad8:	53                   	push   %rbx
+  802ad9:	49 89 f8             	mov    %rdi,%r8
+  802adc:	48 89 d3             	mov    %rdx,%rbx
+  802adf:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802ae2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ae7:	4c 89 c2             	mov    %r8,%rdx
+  802aea:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aed:	be 00 00 00 00       	mov    $0x0,%esi
+  802af2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802af8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802afe:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802b00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b04:	c9                   	leave
+  802b05:	c3                   	ret
+
+0000000000802b06 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802b06:	55                   	push   %rbp
+  802b07:	48 89 e5             	mov    %rsp,%rbp
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0f:	89 f8                	mov    %edi,%eax
+  802b11:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802b14:	48 63 f9             	movslq %ecx,%rdi
+  802b17:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b1a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b1f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b22:	be 00 00 00 00       	mov    $0x0,%esi
+  802b27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b33:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b35:	48 85 c0             	test   %rax,%rax
+  802b38:	7f 06                	jg     802b40 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b3a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b3e:	c9                   	leave
+  802b3f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b40:	49 89 c0             	mov    %rax,%r8
+  802b43:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b48:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802b4f:	00 00 00 
+  802b52:	be 27 00 00 00       	mov    $0x27,%esi
+  802b57:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802b5e:	00 00 00 
+  802b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b66:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802b6d:	00 00 00 
+  802b70:	41 ff d1             	call   *%r9
+
+0000000000802b73 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b73:	55                   	push   %rbp
+  802b74:	48 89 e5             	mov    %rsp,%rbp
+  802b77:	53                   	push   %rbx
+  802b78:	48 83 ec 08          	sub    $0x8,%rsp
+  802b7c:	89 f8                	mov    %edi,%eax
+  802b7e:	49 89 f2             	mov    %rsi,%r10
+  802b81:	48 89 cf             	mov    %rcx,%rdi
+  802b84:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b87:	48 63 da             	movslq %edx,%rbx
+  802b8a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b92:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b95:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b9e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ba0:	48 85 c0             	test   %rax,%rax
+  802ba3:	7f 06                	jg     802bab <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802ba5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ba9:	c9                   	leave
+  802baa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bab:	49 89 c0             	mov    %rax,%r8
+  802bae:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bb3:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802bba:	00 00 00 
+  802bbd:	be 27 00 00 00       	mov    $0x27,%esi
+  802bc2:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802bc9:	00 00 00 
+  802bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd1:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802bd8:	00 00 00 
+  802bdb:	41 ff d1             	call   *%r9
+
+0000000000802bde <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802bde:	55                   	push   %rbp
+  802bdf:	48 89 e5             	mov    %rsp,%rbp
+  802be2:	53                   	push   %rbx
+  802be3:	48 83 ec 08          	sub    $0x8,%rsp
+  802be7:	48 89 f1             	mov    %rsi,%rcx
+  802bea:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bed:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bf0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bfa:	be 00 00 00 00       	mov    $0x0,%esi
+  802bff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c0d:	48 85 c0             	test   %rax,%rax
+  802c10:	7f 06                	jg     802c18 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802c12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c16:	c9                   	leave
+  802c17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c18:	49 89 c0             	mov    %rax,%r8
+  802c1b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c20:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802c27:	00 00 00 
+  802c2a:	be 27 00 00 00       	mov    $0x27,%esi
+  802c2f:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802c36:	00 00 00 
+  802c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3e:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802c45:	00 00 00 
+  802c48:	41 ff d1             	call   *%r9
+
+0000000000802c4b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c4b:	55                   	push   %rbp
+  802c4c:	48 89 e5             	mov    %rsp,%rbp
+  802c4f:	53                   	push   %rbx
+  802c50:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c54:	48 63 ce             	movslq %esi,%rcx
+  802c57:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c5a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c64:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c69:	be 00 00 00 00       	mov    $0x0,%esi
+  802c6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c74:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c7c:	48 85 c0             	test   %rax,%rax
+  802c7f:	7f 06                	jg     802c87 <sys_env_set_status+0x3c>
+}
+  802c81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c85:	c9                   	leave
+  802c86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c87:	49 89 c0             	mov    %rax,%r8
+  802c8a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c8f:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802c96:	00 00 00 
+  802c99:	be 27 00 00 00       	mov    $0x27,%esi
+  802c9e:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802ca5:	00 00 00 
+  802ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cad:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802cb4:	00 00 00 
+  802cb7:	41 ff d1             	call   *%r9
+
+0000000000802cba <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802cba:	55                   	push   %rbp
+  802cbb:	48 89 e5             	mov    %rsp,%rbp
+  802cbe:	53                   	push   %rbx
+  802cbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc3:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802cc6:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cc9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802cdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ce3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ce9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ceb:	48 85 c0             	test   %rax,%rax
+  802cee:	7f 06                	jg     802cf6 <sys_env_set_trapframe+0x3c>
+}
+  802cf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf4:	c9                   	leave
+  802cf5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cf6:	49 89 c0             	mov    %rax,%r8
+  802cf9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802cfe:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802d05:	00 00 00 
+  802d08:	be 27 00 00 00       	mov    $0x27,%esi
+  802d0d:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802d14:	00 00 00 
+  802d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d1c:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802d23:	00 00 00 
+  802d26:	41 ff d1             	call   *%r9
+
+0000000000802d29 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	53                   	push   %rbx
+  802d2e:	48 83 ec 08          	sub    $0x8,%rsp
+  802d32:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d35:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d38:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d42:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d47:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d58:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d5a:	48 85 c0             	test   %rax,%rax
+  802d5d:	7f 06                	jg     802d65 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d5f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d65:	49 89 c0             	mov    %rax,%r8
+  802d68:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d6d:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802d74:	00 00 00 
+  802d77:	be 27 00 00 00       	mov    $0x27,%esi
+  802d7c:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802d83:	00 00 00 
+  802d86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8b:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802d92:	00 00 00 
+  802d95:	41 ff d1             	call   *%r9
+
+0000000000802d98 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d98:	55                   	push   %rbp
+  802d99:	48 89 e5             	mov    %rsp,%rbp
+  802d9c:	53                   	push   %rbx
+  802d9d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802da1:	40 0f b6 ce          	movzbl %sil,%ecx
+  802da5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802da8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802db2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802db7:	be 00 00 00 00       	mov    $0x0,%esi
+  802dbc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dc2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dc8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dca:	48 85 c0             	test   %rax,%rax
+  802dcd:	7f 06                	jg     802dd5 <sys_env_set_reclaim+0x3d>
+}
+  802dcf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dd3:	c9                   	leave
+  802dd4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dd5:	49 89 c0             	mov    %rax,%r8
+  802dd8:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ddd:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802de4:	00 00 00 
+  802de7:	be 27 00 00 00       	mov    $0x27,%esi
+  802dec:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802df3:	00 00 00 
+  802df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfb:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802e02:	00 00 00 
+  802e05:	41 ff d1             	call   *%r9
+
+0000000000802e08 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802e08:	55                   	push   %rbp
+  802e09:	48 89 e5             	mov    %rsp,%rbp
+  802e0c:	53                   	push   %rbx
+  802e0d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802e11:	48 63 ce             	movslq %esi,%rcx
+  802e14:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e17:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e26:	be 00 00 00 00       	mov    $0x0,%esi
+  802e2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e37:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e39:	48 85 c0             	test   %rax,%rax
+  802e3c:	7f 06                	jg     802e44 <sys_env_set_nice+0x3c>
+}
+  802e3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e44:	49 89 c0             	mov    %rax,%r8
+  802e47:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e4c:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802e53:	00 00 00 
+  802e56:	be 27 00 00 00       	mov    $0x27,%esi
+  802e5b:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802e62:	00 00 00 
+  802e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e6a:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802e71:	00 00 00 
+  802e74:	41 ff d1             	call   *%r9
+
+0000000000802e77 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e77:	55                   	push   %rbp
+  802e78:	48 89 e5             	mov    %rsp,%rbp
+  802e7b:	53                   	push   %rbx
+  802e7c:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e7f:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e84:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e93:	be 00 00 00 00       	mov    $0x0,%esi
+  802e98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ea4:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802ea6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eaa:	c9                   	leave
+  802eab:	c3                   	ret
+
+0000000000802eac <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802eac:	55                   	push   %rbp
+  802ead:	48 89 e5             	mov    %rsp,%rbp
+  802eb0:	53                   	push   %rbx
+  802eb1:	89 f8                	mov    %edi,%eax
+  802eb3:	49 89 f1             	mov    %rsi,%r9
+  802eb6:	48 89 d3             	mov    %rdx,%rbx
+  802eb9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ebc:	49 63 f0             	movslq %r8d,%rsi
+  802ebf:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec2:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ec7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ed6:	cd 30                	int    $0x30
+}
+  802ed8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802edc:	c9                   	leave
+  802edd:	c3                   	ret
+
+0000000000802ede <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802ede:	55                   	push   %rbp
+  802edf:	48 89 e5             	mov    %rsp,%rbp
+  802ee2:	53                   	push   %rbx
+  802ee3:	89 f8                	mov    %edi,%eax
+  802ee5:	49 89 f1             	mov    %rsi,%r9
+  802ee8:	48 89 d3             	mov    %rdx,%rbx
+  802eeb:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802eee:	49 63 f0             	movslq %r8d,%rsi
+  802ef1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ef4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ef9:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802efc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f02:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f08:	cd 30                	int    $0x30
+}
+  802f0a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f0e:	c9                   	leave
+  802f0f:	c3                   	ret
+
+0000000000802f10 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f10:	55                   	push   %rbp
+  802f11:	48 89 e5             	mov    %rsp,%rbp
+  802f14:	53                   	push   %rbx
+  802f15:	48 83 ec 08          	sub    $0x8,%rsp
+  802f19:	89 f8                	mov    %edi,%eax
+  802f1b:	49 89 f2             	mov    %rsi,%r10
+  802f1e:	48 89 d3             	mov    %rdx,%rbx
+  802f21:	48 89 cf             	mov    %rcx,%rdi
+  802f24:	44 89 c6             	mov    %r8d,%esi
+  802f27:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f2a:	48 63 f6             	movslq %esi,%rsi
+  802f2d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f30:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f35:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f38:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f3c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f3e:	48 85 c0             	test   %rax,%rax
+  802f41:	7f 06                	jg     802f49 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f49:	49 89 c0             	mov    %rax,%r8
+  802f4c:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f51:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802f58:	00 00 00 
+  802f5b:	be 27 00 00 00       	mov    $0x27,%esi
+  802f60:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802f67:	00 00 00 
+  802f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6f:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802f76:	00 00 00 
+  802f79:	41 ff d1             	call   *%r9
+
+0000000000802f7c <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f7c:	55                   	push   %rbp
+  802f7d:	48 89 e5             	mov    %rsp,%rbp
+  802f80:	53                   	push   %rbx
+  802f81:	48 83 ec 08          	sub    $0x8,%rsp
+  802f85:	48 89 f1             	mov    %rsi,%rcx
+  802f88:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f8b:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f8f:	48 8b 1a             	mov    (%rdx),%rbx
+  802f92:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f95:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f9a:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f9e:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802fa2:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802fa6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fa8:	48 85 c0             	test   %rax,%rax
+  802fab:	7f 06                	jg     802fb3 <sys_ipc_call_short+0x37>
+}
+  802fad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fb1:	c9                   	leave
+  802fb2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fb3:	49 89 c0             	mov    %rax,%r8
+  802fb6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802fbb:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  802fc2:	00 00 00 
+  802fc5:	be 27 00 00 00       	mov    $0x27,%esi
+  802fca:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  802fd1:	00 00 00 
+  802fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd9:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  802fe0:	00 00 00 
+  802fe3:	41 ff d1             	call   *%r9
+
+0000000000802fe6 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	53                   	push   %rbx
+  802feb:	48 83 ec 08          	sub    $0x8,%rsp
+  802fef:	89 f8                	mov    %edi,%eax
+  802ff1:	49 89 f2             	mov    %rsi,%r10
+  802ff4:	48 89 d3             	mov    %rdx,%rbx
+  802ff7:	48 89 cf             	mov    %rcx,%rdi
+  802ffa:	44 89 c6             	mov    %r8d,%esi
+  802ffd:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803000:	48 63 f6             	movslq %esi,%rsi
+  803003:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803006:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80300b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  80300e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803012:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803014:	48 85 c0             	test   %rax,%rax
+  803017:	7f 06                	jg     80301f <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803019:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80301d:	c9                   	leave
+  80301e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80301f:	49 89 c0             	mov    %rax,%r8
+  803022:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803027:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  80302e:	00 00 00 
+  803031:	be 27 00 00 00       	mov    $0x27,%esi
+  803036:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  80303d:	00 00 00 
+  803040:	b8 00 00 00 00       	mov    $0x0,%eax
+  803045:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  80304c:	00 00 00 
+  80304f:	41 ff d1             	call   *%r9
+
+0000000000803052 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803052:	55                   	push   %rbp
+  803053:	48 89 e5             	mov    %rsp,%rbp
+  803056:	53                   	push   %rbx
+  803057:	48 83 ec 08          	sub    $0x8,%rsp
+  80305b:	48 89 fa             	mov    %rdi,%rdx
+  80305e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803061:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803070:	be 00 00 00 00       	mov    $0x0,%esi
+  803075:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80307b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803081:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803083:	48 85 c0             	test   %rax,%rax
+  803086:	7f 06                	jg     80308e <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803088:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80308c:	c9                   	leave
+  80308d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80308e:	49 89 c0             	mov    %rax,%r8
+  803091:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803096:	48 ba e8 64 80 00 00 	movabs $0x8064e8,%rdx
+  80309d:	00 00 00 
+  8030a0:	be 27 00 00 00       	mov    $0x27,%esi
+  8030a5:	48 bf 07 65 80 00 00 	movabs $0x806507,%rdi
+  8030ac:	00 00 00 
+  8030af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b4:	49 b9 1a 19 80 00 00 	movabs $0x80191a,%r9
+  8030bb:	00 00 00 
+  8030be:	41 ff d1             	call   *%r9
+
+00000000008030c1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8030c1:	55                   	push   %rbp
+  8030c2:	48 89 e5             	mov    %rsp,%rbp
+  8030c5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030c6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030df:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030f0:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030f6:	c9                   	leave
+  8030f7:	c3                   	ret
+
+00000000008030f8 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030f8:	55                   	push   %rbp
+  8030f9:	48 89 e5             	mov    %rsp,%rbp
+  8030fc:	53                   	push   %rbx
+  8030fd:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803100:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803105:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80310a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80310f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803114:	be 00 00 00 00       	mov    $0x0,%esi
+  803119:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80311f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803125:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803127:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80312b:	c9                   	leave
+  80312c:	c3                   	ret
+
+000000000080312d <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  80312d:	55                   	push   %rbp
+  80312e:	48 89 e5             	mov    %rsp,%rbp
+  803131:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803132:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803141:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803146:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80314b:	be 00 00 00 00       	mov    $0x0,%esi
+  803150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80315c:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80315e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803162:	c9                   	leave
+  803163:	c3                   	ret
+
+0000000000803164 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803164:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80316b:	ff ff ff 
+  80316e:	48 01 f8             	add    %rdi,%rax
+  803171:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803175:	c3                   	ret
+
+0000000000803176 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803176:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80317d:	ff ff ff 
+  803180:	48 01 f8             	add    %rdi,%rax
+  803183:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803187:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80318d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803191:	c3                   	ret
+
+0000000000803192 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803192:	55                   	push   %rbp
+  803193:	48 89 e5             	mov    %rsp,%rbp
+  803196:	41 57                	push   %r15
+  803198:	41 56                	push   %r14
+  80319a:	41 55                	push   %r13
+  80319c:	41 54                	push   %r12
+  80319e:	53                   	push   %rbx
+  80319f:	48 83 ec 08          	sub    $0x8,%rsp
+  8031a3:	49 89 ff             	mov    %rdi,%r15
+  8031a6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8031ab:	49 bd 92 46 80 00 00 	movabs $0x804692,%r13
+  8031b2:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8031b5:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8031bb:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8031be:	48 89 df             	mov    %rbx,%rdi
+  8031c1:	41 ff d5             	call   *%r13
+  8031c4:	83 e0 04             	and    $0x4,%eax
+  8031c7:	74 17                	je     8031e0 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8031c9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8031d0:	4c 39 f3             	cmp    %r14,%rbx
+  8031d3:	75 e6                	jne    8031bb <fd_alloc+0x29>
+  8031d5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8031db:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8031e0:	4d 89 27             	mov    %r12,(%r15)
+}
+  8031e3:	48 83 c4 08          	add    $0x8,%rsp
+  8031e7:	5b                   	pop    %rbx
+  8031e8:	41 5c                	pop    %r12
+  8031ea:	41 5d                	pop    %r13
+  8031ec:	41 5e                	pop    %r14
+  8031ee:	41 5f                	pop    %r15
+  8031f0:	5d                   	pop    %rbp
+  8031f1:	c3                   	ret
+
+00000000008031f2 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8031f2:	83 ff 1f             	cmp    $0x1f,%edi
+  8031f5:	77 39                	ja     803230 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8031f7:	55                   	push   %rbp
+  8031f8:	48 89 e5             	mov    %rsp,%rbp
+  8031fb:	41 54                	push   %r12
+  8031fd:	53                   	push   %rbx
+  8031fe:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803201:	48 63 df             	movslq %edi,%rbx
+  803204:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80320b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80320f:	48 89 df             	mov    %rbx,%rdi
+  803212:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  803219:	00 00 00 
+  80321c:	ff d0                	call   *%rax
+  80321e:	a8 04                	test   $0x4,%al
+  803220:	74 14                	je     803236 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803222:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803226:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80322b:	5b                   	pop    %rbx
+  80322c:	41 5c                	pop    %r12
+  80322e:	5d                   	pop    %rbp
+  80322f:	c3                   	ret
+        return -E_INVAL;
+  803230:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803235:	c3                   	ret
+        return -E_INVAL;
+  803236:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80323b:	eb ee                	jmp    80322b <fd_lookup+0x39>
+
+000000000080323d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80323d:	55                   	push   %rbp
+  80323e:	48 89 e5             	mov    %rsp,%rbp
+  803241:	41 54                	push   %r12
+  803243:	53                   	push   %rbx
+  803244:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803247:	48 b8 a0 65 80 00 00 	movabs $0x8065a0,%rax
+  80324e:	00 00 00 
+  803251:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803258:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80325b:	39 3b                	cmp    %edi,(%rbx)
+  80325d:	74 47                	je     8032a6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80325f:	48 83 c0 08          	add    $0x8,%rax
+  803263:	48 8b 18             	mov    (%rax),%rbx
+  803266:	48 85 db             	test   %rbx,%rbx
+  803269:	75 f0                	jne    80325b <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80326b:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803272:	00 00 00 
+  803275:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80327b:	89 fa                	mov    %edi,%edx
+  80327d:	48 bf 18 65 80 00 00 	movabs $0x806518,%rdi
+  803284:	00 00 00 
+  803287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328c:	48 b9 6a 1a 80 00 00 	movabs $0x801a6a,%rcx
+  803293:	00 00 00 
+  803296:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803298:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80329d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8032a1:	5b                   	pop    %rbx
+  8032a2:	41 5c                	pop    %r12
+  8032a4:	5d                   	pop    %rbp
+  8032a5:	c3                   	ret
+            return 0;
+  8032a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ab:	eb f0                	jmp    80329d <dev_lookup+0x60>
+
+00000000008032ad <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8032ad:	55                   	push   %rbp
+  8032ae:	48 89 e5             	mov    %rsp,%rbp
+  8032b1:	41 55                	push   %r13
+  8032b3:	41 54                	push   %r12
+  8032b5:	53                   	push   %rbx
+  8032b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8032ba:	48 89 fb             	mov    %rdi,%rbx
+  8032bd:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032c0:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8032c7:	ff ff ff 
+  8032ca:	48 01 df             	add    %rbx,%rdi
+  8032cd:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8032d1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032d5:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+  8032e1:	41 89 c5             	mov    %eax,%r13d
+  8032e4:	85 c0                	test   %eax,%eax
+  8032e6:	78 06                	js     8032ee <fd_close+0x41>
+  8032e8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8032ec:	74 1a                	je     803308 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8032ee:	45 84 e4             	test   %r12b,%r12b
+  8032f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f6:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8032fa:	44 89 e8             	mov    %r13d,%eax
+  8032fd:	48 83 c4 18          	add    $0x18,%rsp
+  803301:	5b                   	pop    %rbx
+  803302:	41 5c                	pop    %r12
+  803304:	41 5d                	pop    %r13
+  803306:	5d                   	pop    %rbp
+  803307:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803308:	8b 3b                	mov    (%rbx),%edi
+  80330a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80330e:	48 b8 3d 32 80 00 00 	movabs $0x80323d,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+  80331a:	41 89 c5             	mov    %eax,%r13d
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	78 1b                	js     80333c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803321:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803325:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803329:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80332f:	48 85 c0             	test   %rax,%rax
+  803332:	74 08                	je     80333c <fd_close+0x8f>
+  803334:	48 89 df             	mov    %rbx,%rdi
+  803337:	ff d0                	call   *%rax
+  803339:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80333c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803341:	48 89 de             	mov    %rbx,%rsi
+  803344:	bf 00 00 00 00       	mov    $0x0,%edi
+  803349:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  803350:	00 00 00 
+  803353:	ff d0                	call   *%rax
+    return res;
+  803355:	eb a3                	jmp    8032fa <fd_close+0x4d>
+
+0000000000803357 <close>:
+
+int
+close(int fdnum) {
+  803357:	55                   	push   %rbp
+  803358:	48 89 e5             	mov    %rsp,%rbp
+  80335b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80335f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803363:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  80336a:	00 00 00 
+  80336d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80336f:	85 c0                	test   %eax,%eax
+  803371:	78 15                	js     803388 <close+0x31>
+
+    return fd_close(fd, 1);
+  803373:	be 01 00 00 00       	mov    $0x1,%esi
+  803378:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80337c:	48 b8 ad 32 80 00 00 	movabs $0x8032ad,%rax
+  803383:	00 00 00 
+  803386:	ff d0                	call   *%rax
+}
+  803388:	c9                   	leave
+  803389:	c3                   	ret
+
+000000000080338a <close_all>:
+
+void
+close_all(void) {
+  80338a:	55                   	push   %rbp
+  80338b:	48 89 e5             	mov    %rsp,%rbp
+  80338e:	41 54                	push   %r12
+  803390:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803391:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803396:	49 bc 57 33 80 00 00 	movabs $0x803357,%r12
+  80339d:	00 00 00 
+  8033a0:	89 df                	mov    %ebx,%edi
+  8033a2:	41 ff d4             	call   *%r12
+  8033a5:	83 c3 01             	add    $0x1,%ebx
+  8033a8:	83 fb 20             	cmp    $0x20,%ebx
+  8033ab:	75 f3                	jne    8033a0 <close_all+0x16>
+}
+  8033ad:	5b                   	pop    %rbx
+  8033ae:	41 5c                	pop    %r12
+  8033b0:	5d                   	pop    %rbp
+  8033b1:	c3                   	ret
+
+00000000008033b2 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8033b2:	55                   	push   %rbp
+  8033b3:	48 89 e5             	mov    %rsp,%rbp
+  8033b6:	41 57                	push   %r15
+  8033b8:	41 56                	push   %r14
+  8033ba:	41 55                	push   %r13
+  8033bc:	41 54                	push   %r12
+  8033be:	53                   	push   %rbx
+  8033bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8033c3:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8033c6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033ca:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	89 c3                	mov    %eax,%ebx
+  8033d8:	85 c0                	test   %eax,%eax
+  8033da:	0f 88 b8 00 00 00    	js     803498 <dup+0xe6>
+    close(newfdnum);
+  8033e0:	44 89 e7             	mov    %r12d,%edi
+  8033e3:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  8033ea:	00 00 00 
+  8033ed:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8033ef:	4d 63 ec             	movslq %r12d,%r13
+  8033f2:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8033f9:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8033fd:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803401:	4c 89 ff             	mov    %r15,%rdi
+  803404:	49 be 76 31 80 00 00 	movabs $0x803176,%r14
+  80340b:	00 00 00 
+  80340e:	41 ff d6             	call   *%r14
+  803411:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803414:	4c 89 ef             	mov    %r13,%rdi
+  803417:	41 ff d6             	call   *%r14
+  80341a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80341d:	48 89 df             	mov    %rbx,%rdi
+  803420:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80342c:	a8 04                	test   $0x4,%al
+  80342e:	74 2b                	je     80345b <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803430:	41 89 c1             	mov    %eax,%r9d
+  803433:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803439:	4c 89 f1             	mov    %r14,%rcx
+  80343c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803441:	48 89 de             	mov    %rbx,%rsi
+  803444:	bf 00 00 00 00       	mov    $0x0,%edi
+  803449:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  803450:	00 00 00 
+  803453:	ff d0                	call   *%rax
+  803455:	89 c3                	mov    %eax,%ebx
+  803457:	85 c0                	test   %eax,%eax
+  803459:	78 4e                	js     8034a9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80345b:	4c 89 ff             	mov    %r15,%rdi
+  80345e:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+  80346a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80346d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803473:	4c 89 e9             	mov    %r13,%rcx
+  803476:	ba 00 00 00 00       	mov    $0x0,%edx
+  80347b:	4c 89 fe             	mov    %r15,%rsi
+  80347e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803483:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  80348a:	00 00 00 
+  80348d:	ff d0                	call   *%rax
+  80348f:	89 c3                	mov    %eax,%ebx
+  803491:	85 c0                	test   %eax,%eax
+  803493:	78 14                	js     8034a9 <dup+0xf7>
+
+    return newfdnum;
+  803495:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803498:	89 d8                	mov    %ebx,%eax
+  80349a:	48 83 c4 18          	add    $0x18,%rsp
+  80349e:	5b                   	pop    %rbx
+  80349f:	41 5c                	pop    %r12
+  8034a1:	41 5d                	pop    %r13
+  8034a3:	41 5e                	pop    %r14
+  8034a5:	41 5f                	pop    %r15
+  8034a7:	5d                   	pop    %rbp
+  8034a8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8034a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034ae:	4c 89 ee             	mov    %r13,%rsi
+  8034b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b6:	49 bc de 2b 80 00 00 	movabs $0x802bde,%r12
+  8034bd:	00 00 00 
+  8034c0:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8034c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034c8:	4c 89 f6             	mov    %r14,%rsi
+  8034cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034d0:	41 ff d4             	call   *%r12
+    return res;
+  8034d3:	eb c3                	jmp    803498 <dup+0xe6>
+
+00000000008034d5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	41 56                	push   %r14
+  8034db:	41 55                	push   %r13
+  8034dd:	41 54                	push   %r12
+  8034df:	53                   	push   %rbx
+  8034e0:	48 83 ec 10          	sub    $0x10,%rsp
+  8034e4:	89 fb                	mov    %edi,%ebx
+  8034e6:	49 89 f4             	mov    %rsi,%r12
+  8034e9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034ec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034f0:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8034f7:	00 00 00 
+  8034fa:	ff d0                	call   *%rax
+  8034fc:	85 c0                	test   %eax,%eax
+  8034fe:	78 4c                	js     80354c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803500:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803504:	41 8b 3e             	mov    (%r14),%edi
+  803507:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80350b:	48 b8 3d 32 80 00 00 	movabs $0x80323d,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	85 c0                	test   %eax,%eax
+  803519:	78 35                	js     803550 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80351b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80351f:	83 e0 03             	and    $0x3,%eax
+  803522:	83 f8 01             	cmp    $0x1,%eax
+  803525:	74 2d                	je     803554 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803527:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80352b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80352f:	48 85 c0             	test   %rax,%rax
+  803532:	74 56                	je     80358a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803534:	4c 89 ea             	mov    %r13,%rdx
+  803537:	4c 89 e6             	mov    %r12,%rsi
+  80353a:	4c 89 f7             	mov    %r14,%rdi
+  80353d:	ff d0                	call   *%rax
+}
+  80353f:	48 83 c4 10          	add    $0x10,%rsp
+  803543:	5b                   	pop    %rbx
+  803544:	41 5c                	pop    %r12
+  803546:	41 5d                	pop    %r13
+  803548:	41 5e                	pop    %r14
+  80354a:	5d                   	pop    %rbp
+  80354b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80354c:	48 98                	cltq
+  80354e:	eb ef                	jmp    80353f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803550:	48 98                	cltq
+  803552:	eb eb                	jmp    80353f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803554:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80355b:	00 00 00 
+  80355e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803564:	89 da                	mov    %ebx,%edx
+  803566:	48 bf 59 65 80 00 00 	movabs $0x806559,%rdi
+  80356d:	00 00 00 
+  803570:	b8 00 00 00 00       	mov    $0x0,%eax
+  803575:	48 b9 6a 1a 80 00 00 	movabs $0x801a6a,%rcx
+  80357c:	00 00 00 
+  80357f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803581:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803588:	eb b5                	jmp    80353f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80358a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803591:	eb ac                	jmp    80353f <read+0x6a>
+
+0000000000803593 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803593:	55                   	push   %rbp
+  803594:	48 89 e5             	mov    %rsp,%rbp
+  803597:	41 57                	push   %r15
+  803599:	41 56                	push   %r14
+  80359b:	41 55                	push   %r13
+  80359d:	41 54                	push   %r12
+  80359f:	53                   	push   %rbx
+  8035a0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8035a4:	48 85 d2             	test   %rdx,%rdx
+  8035a7:	74 54                	je     8035fd <readn+0x6a>
+  8035a9:	41 89 fd             	mov    %edi,%r13d
+  8035ac:	49 89 f6             	mov    %rsi,%r14
+  8035af:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8035b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8035b7:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8035bc:	49 bf d5 34 80 00 00 	movabs $0x8034d5,%r15
+  8035c3:	00 00 00 
+  8035c6:	4c 89 e2             	mov    %r12,%rdx
+  8035c9:	48 29 f2             	sub    %rsi,%rdx
+  8035cc:	4c 01 f6             	add    %r14,%rsi
+  8035cf:	44 89 ef             	mov    %r13d,%edi
+  8035d2:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8035d5:	85 c0                	test   %eax,%eax
+  8035d7:	78 20                	js     8035f9 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8035d9:	01 c3                	add    %eax,%ebx
+  8035db:	85 c0                	test   %eax,%eax
+  8035dd:	74 08                	je     8035e7 <readn+0x54>
+  8035df:	48 63 f3             	movslq %ebx,%rsi
+  8035e2:	4c 39 e6             	cmp    %r12,%rsi
+  8035e5:	72 df                	jb     8035c6 <readn+0x33>
+    }
+    return res;
+  8035e7:	48 63 c3             	movslq %ebx,%rax
+}
+  8035ea:	48 83 c4 08          	add    $0x8,%rsp
+  8035ee:	5b                   	pop    %rbx
+  8035ef:	41 5c                	pop    %r12
+  8035f1:	41 5d                	pop    %r13
+  8035f3:	41 5e                	pop    %r14
+  8035f5:	41 5f                	pop    %r15
+  8035f7:	5d                   	pop    %rbp
+  8035f8:	c3                   	ret
+        if (inc < 0) return inc;
+  8035f9:	48 98                	cltq
+  8035fb:	eb ed                	jmp    8035ea <readn+0x57>
+    int inc = 1, res = 0;
+  8035fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803602:	eb e3                	jmp    8035e7 <readn+0x54>
+
+0000000000803604 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803604:	55                   	push   %rbp
+  803605:	48 89 e5             	mov    %rsp,%rbp
+  803608:	41 56                	push   %r14
+  80360a:	41 55                	push   %r13
+  80360c:	41 54                	push   %r12
+  80360e:	53                   	push   %rbx
+  80360f:	48 83 ec 10          	sub    $0x10,%rsp
+  803613:	89 fb                	mov    %edi,%ebx
+  803615:	49 89 f4             	mov    %rsi,%r12
+  803618:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80361b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80361f:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+  80362b:	85 c0                	test   %eax,%eax
+  80362d:	78 47                	js     803676 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80362f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803633:	41 8b 3e             	mov    (%r14),%edi
+  803636:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80363a:	48 b8 3d 32 80 00 00 	movabs $0x80323d,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+  803646:	85 c0                	test   %eax,%eax
+  803648:	78 30                	js     80367a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80364a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80364f:	74 2d                	je     80367e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803651:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803655:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803659:	48 85 c0             	test   %rax,%rax
+  80365c:	74 56                	je     8036b4 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80365e:	4c 89 ea             	mov    %r13,%rdx
+  803661:	4c 89 e6             	mov    %r12,%rsi
+  803664:	4c 89 f7             	mov    %r14,%rdi
+  803667:	ff d0                	call   *%rax
+}
+  803669:	48 83 c4 10          	add    $0x10,%rsp
+  80366d:	5b                   	pop    %rbx
+  80366e:	41 5c                	pop    %r12
+  803670:	41 5d                	pop    %r13
+  803672:	41 5e                	pop    %r14
+  803674:	5d                   	pop    %rbp
+  803675:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803676:	48 98                	cltq
+  803678:	eb ef                	jmp    803669 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80367a:	48 98                	cltq
+  80367c:	eb eb                	jmp    803669 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80367e:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803685:	00 00 00 
+  803688:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80368e:	89 da                	mov    %ebx,%edx
+  803690:	48 bf 75 65 80 00 00 	movabs $0x806575,%rdi
+  803697:	00 00 00 
+  80369a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369f:	48 b9 6a 1a 80 00 00 	movabs $0x801a6a,%rcx
+  8036a6:	00 00 00 
+  8036a9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8036ab:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036b2:	eb b5                	jmp    803669 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8036b4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036bb:	eb ac                	jmp    803669 <write+0x65>
+
+00000000008036bd <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8036bd:	55                   	push   %rbp
+  8036be:	48 89 e5             	mov    %rsp,%rbp
+  8036c1:	53                   	push   %rbx
+  8036c2:	48 83 ec 18          	sub    $0x18,%rsp
+  8036c6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036c8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8036cc:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8036d3:	00 00 00 
+  8036d6:	ff d0                	call   *%rax
+  8036d8:	85 c0                	test   %eax,%eax
+  8036da:	78 0c                	js     8036e8 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8036dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036e0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8036e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ec:	c9                   	leave
+  8036ed:	c3                   	ret
+
+00000000008036ee <tell>:
+
+int tell(int fdnum) {
+  8036ee:	55                   	push   %rbp
+  8036ef:	48 89 e5             	mov    %rsp,%rbp
+  8036f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036f6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036fa:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+  803706:	85 c0                	test   %eax,%eax
+  803708:	78 07                	js     803711 <tell+0x23>
+
+    return fd->fd_offset;
+  80370a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80370e:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803711:	c9                   	leave
+  803712:	c3                   	ret
+
+0000000000803713 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803713:	55                   	push   %rbp
+  803714:	48 89 e5             	mov    %rsp,%rbp
+  803717:	41 55                	push   %r13
+  803719:	41 54                	push   %r12
+  80371b:	53                   	push   %rbx
+  80371c:	48 83 ec 18          	sub    $0x18,%rsp
+  803720:	89 fb                	mov    %edi,%ebx
+  803722:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803725:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803729:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  803730:	00 00 00 
+  803733:	ff d0                	call   *%rax
+  803735:	85 c0                	test   %eax,%eax
+  803737:	78 38                	js     803771 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803739:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80373d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803741:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803745:	48 b8 3d 32 80 00 00 	movabs $0x80323d,%rax
+  80374c:	00 00 00 
+  80374f:	ff d0                	call   *%rax
+  803751:	85 c0                	test   %eax,%eax
+  803753:	78 1c                	js     803771 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803755:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80375a:	74 20                	je     80377c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80375c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803760:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803764:	48 85 c0             	test   %rax,%rax
+  803767:	74 47                	je     8037b0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803769:	44 89 e6             	mov    %r12d,%esi
+  80376c:	4c 89 ef             	mov    %r13,%rdi
+  80376f:	ff d0                	call   *%rax
+}
+  803771:	48 83 c4 18          	add    $0x18,%rsp
+  803775:	5b                   	pop    %rbx
+  803776:	41 5c                	pop    %r12
+  803778:	41 5d                	pop    %r13
+  80377a:	5d                   	pop    %rbp
+  80377b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80377c:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  803783:	00 00 00 
+  803786:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80378c:	89 da                	mov    %ebx,%edx
+  80378e:	48 bf 38 65 80 00 00 	movabs $0x806538,%rdi
+  803795:	00 00 00 
+  803798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379d:	48 b9 6a 1a 80 00 00 	movabs $0x801a6a,%rcx
+  8037a4:	00 00 00 
+  8037a7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037ae:	eb c1                	jmp    803771 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8037b0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037b5:	eb ba                	jmp    803771 <ftruncate+0x5e>
+
+00000000008037b7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8037b7:	55                   	push   %rbp
+  8037b8:	48 89 e5             	mov    %rsp,%rbp
+  8037bb:	41 54                	push   %r12
+  8037bd:	53                   	push   %rbx
+  8037be:	48 83 ec 10          	sub    $0x10,%rsp
+  8037c2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037c5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8037c9:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8037d0:	00 00 00 
+  8037d3:	ff d0                	call   *%rax
+  8037d5:	85 c0                	test   %eax,%eax
+  8037d7:	78 63                	js     80383c <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037d9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8037dd:	41 8b 3c 24          	mov    (%r12),%edi
+  8037e1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8037e5:	48 b8 3d 32 80 00 00 	movabs $0x80323d,%rax
+  8037ec:	00 00 00 
+  8037ef:	ff d0                	call   *%rax
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	78 47                	js     80383c <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037f9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8037fe:	74 45                	je     803845 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803800:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803803:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80380a:	00 00 00 
+    stat->st_isdir = 0;
+  80380d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803814:	00 00 00 
+    stat->st_ino = 0;
+  803817:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80381e:	00 00 00 00 
+    stat->st_version = 0;
+  803822:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803829:	00 00 00 
+    stat->st_dev = dev;
+  80382c:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803833:	48 89 de             	mov    %rbx,%rsi
+  803836:	4c 89 e7             	mov    %r12,%rdi
+  803839:	ff 50 28             	call   *0x28(%rax)
+}
+  80383c:	48 83 c4 10          	add    $0x10,%rsp
+  803840:	5b                   	pop    %rbx
+  803841:	41 5c                	pop    %r12
+  803843:	5d                   	pop    %rbp
+  803844:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803845:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80384a:	eb f0                	jmp    80383c <fstat+0x85>
+
+000000000080384c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80384c:	55                   	push   %rbp
+  80384d:	48 89 e5             	mov    %rsp,%rbp
+  803850:	41 54                	push   %r12
+  803852:	53                   	push   %rbx
+  803853:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803856:	be 00 00 00 00       	mov    $0x0,%esi
+  80385b:	48 b8 6d 3d 80 00 00 	movabs $0x803d6d,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	78 25                	js     803892 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80386d:	4c 89 e6             	mov    %r12,%rsi
+  803870:	89 c7                	mov    %eax,%edi
+  803872:	48 b8 b7 37 80 00 00 	movabs $0x8037b7,%rax
+  803879:	00 00 00 
+  80387c:	ff d0                	call   *%rax
+  80387e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803881:	89 df                	mov    %ebx,%edi
+  803883:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  80388a:	00 00 00 
+  80388d:	ff d0                	call   *%rax
+
+    return res;
+  80388f:	44 89 e3             	mov    %r12d,%ebx
+}
+  803892:	89 d8                	mov    %ebx,%eax
+  803894:	5b                   	pop    %rbx
+  803895:	41 5c                	pop    %r12
+  803897:	5d                   	pop    %rbp
+  803898:	c3                   	ret
+
+0000000000803899 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803899:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8038a0:	00 00 00 
+  8038a3:	83 38 00             	cmpl   $0x0,(%rax)
+  8038a6:	74 0a                	je     8038b2 <fsipc_env+0x19>
+    return fsenv;
+}
+  8038a8:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8038af:	00 00 
+  8038b1:	c3                   	ret
+fsipc_env(void) {
+  8038b2:	55                   	push   %rbp
+  8038b3:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8038b6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038bb:	48 b8 9c 59 80 00 00 	movabs $0x80599c,%rax
+  8038c2:	00 00 00 
+  8038c5:	ff d0                	call   *%rax
+  8038c7:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8038ce:	00 00 
+}
+  8038d0:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8038d7:	00 00 
+  8038d9:	5d                   	pop    %rbp
+  8038da:	c3                   	ret
+
+00000000008038db <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8038db:	55                   	push   %rbp
+  8038dc:	48 89 e5             	mov    %rsp,%rbp
+  8038df:	53                   	push   %rbx
+  8038e0:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8038e4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8038eb:	00 
+  8038ec:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8038f3:	00 
+  8038f4:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8038fb:	00 
+  8038fc:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803903:	00 
+  803904:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  80390b:	00 
+
+    assert(size <= sizeof(words));
+  80390c:	48 83 fa 28          	cmp    $0x28,%rdx
+  803910:	77 38                	ja     80394a <fsipc_short+0x6f>
+  803912:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803914:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803918:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  80391f:	00 00 00 
+  803922:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803924:	48 b8 99 38 80 00 00 	movabs $0x803899,%rax
+  80392b:	00 00 00 
+  80392e:	ff d0                	call   *%rax
+  803930:	89 c7                	mov    %eax,%edi
+  803932:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803936:	89 de                	mov    %ebx,%esi
+  803938:	48 b8 ff 58 80 00 00 	movabs $0x8058ff,%rax
+  80393f:	00 00 00 
+  803942:	ff d0                	call   *%rax
+}
+  803944:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803948:	c9                   	leave
+  803949:	c3                   	ret
+    assert(size <= sizeof(words));
+  80394a:	48 b9 c0 65 80 00 00 	movabs $0x8065c0,%rcx
+  803951:	00 00 00 
+  803954:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  80395b:	00 00 00 
+  80395e:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803963:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  80396a:	00 00 00 
+  80396d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803972:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803979:	00 00 00 
+  80397c:	41 ff d0             	call   *%r8
+
+000000000080397f <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80397f:	55                   	push   %rbp
+  803980:	48 89 e5             	mov    %rsp,%rbp
+  803983:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803987:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80398a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80398d:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803990:	ba 08 00 00 00       	mov    $0x8,%edx
+  803995:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803999:	bf 02 00 00 00       	mov    $0x2,%edi
+  80399e:	48 b8 db 38 80 00 00 	movabs $0x8038db,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+}
+  8039aa:	c9                   	leave
+  8039ab:	c3                   	ret
+
+00000000008039ac <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8039ac:	55                   	push   %rbp
+  8039ad:	48 89 e5             	mov    %rsp,%rbp
+  8039b0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  8039b4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8039ba:	ba 04 00 00 00       	mov    $0x4,%edx
+  8039bf:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8039c3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8039c8:	48 b8 db 38 80 00 00 	movabs $0x8038db,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+}
+  8039d4:	c9                   	leave
+  8039d5:	c3                   	ret
+
+00000000008039d6 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8039d6:	55                   	push   %rbp
+  8039d7:	48 89 e5             	mov    %rsp,%rbp
+  8039da:	41 54                	push   %r12
+  8039dc:	53                   	push   %rbx
+  8039dd:	48 83 ec 10          	sub    $0x10,%rsp
+  8039e1:	89 fb                	mov    %edi,%ebx
+  8039e3:	49 89 f4             	mov    %rsi,%r12
+  8039e6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8039ea:	48 b8 99 38 80 00 00 	movabs $0x803899,%rax
+  8039f1:	00 00 00 
+  8039f4:	ff d0                	call   *%rax
+  8039f6:	89 c7                	mov    %eax,%edi
+  8039f8:	6a 00                	push   $0x0
+  8039fa:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8039fe:	50                   	push   %rax
+  8039ff:	4d 89 e1             	mov    %r12,%r9
+  803a02:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803a08:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a0d:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803a14:	00 00 00 
+  803a17:	89 de                	mov    %ebx,%esi
+  803a19:	48 b8 9a 58 80 00 00 	movabs $0x80589a,%rax
+  803a20:	00 00 00 
+  803a23:	ff d0                	call   *%rax
+}
+  803a25:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803a29:	5b                   	pop    %rbx
+  803a2a:	41 5c                	pop    %r12
+  803a2c:	5d                   	pop    %rbp
+  803a2d:	c3                   	ret
+
+0000000000803a2e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803a2e:	55                   	push   %rbp
+  803a2f:	48 89 e5             	mov    %rsp,%rbp
+  803a32:	41 54                	push   %r12
+  803a34:	53                   	push   %rbx
+  803a35:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803a38:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a3b:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803a42:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a44:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a49:	be 00 00 00 00       	mov    $0x0,%esi
+  803a4e:	bf 05 00 00 00       	mov    $0x5,%edi
+  803a53:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803a5f:	85 c0                	test   %eax,%eax
+  803a61:	78 5a                	js     803abd <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803a63:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803a6a:	00 00 00 
+  803a6d:	4c 89 e6             	mov    %r12,%rsi
+  803a70:	48 89 df             	mov    %rbx,%rdi
+  803a73:	48 b8 a1 23 80 00 00 	movabs $0x8023a1,%rax
+  803a7a:	00 00 00 
+  803a7d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803a7f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803a86:	00 
+  803a87:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803a8d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a94:	00 
+  803a95:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a9b:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803aa2:	00 
+  803aa3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803aaa:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803ab1:	00 
+  803ab2:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803abd:	5b                   	pop    %rbx
+  803abe:	41 5c                	pop    %r12
+  803ac0:	5d                   	pop    %rbp
+  803ac1:	c3                   	ret
+
+0000000000803ac2 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803ac2:	55                   	push   %rbp
+  803ac3:	48 89 e5             	mov    %rsp,%rbp
+  803ac6:	41 57                	push   %r15
+  803ac8:	41 56                	push   %r14
+  803aca:	41 55                	push   %r13
+  803acc:	41 54                	push   %r12
+  803ace:	53                   	push   %rbx
+  803acf:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803ad3:	48 85 ff             	test   %rdi,%rdi
+  803ad6:	0f 84 a1 00 00 00    	je     803b7d <devfile_read+0xbb>
+  803adc:	49 89 ff             	mov    %rdi,%r15
+  803adf:	49 89 f5             	mov    %rsi,%r13
+  803ae2:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803ae5:	48 85 f6             	test   %rsi,%rsi
+  803ae8:	0f 84 c4 00 00 00    	je     803bb2 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803aee:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803af5:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803af6:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803afd:	00 00 00 
+  803b00:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803b04:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803b07:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b10:	be 00 00 00 00       	mov    $0x0,%esi
+  803b15:	bf 03 00 00 00       	mov    $0x3,%edi
+  803b1a:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  803b21:	00 00 00 
+  803b24:	ff d0                	call   *%rax
+        if (res < 0) {
+  803b26:	85 c0                	test   %eax,%eax
+  803b28:	0f 88 b9 00 00 00    	js     803be7 <devfile_read+0x125>
+        assert(res <= n);
+  803b2e:	48 63 d8             	movslq %eax,%rbx
+  803b31:	49 39 dc             	cmp    %rbx,%r12
+  803b34:	0f 82 b1 00 00 00    	jb     803beb <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803b3a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803b3f:	0f 87 db 00 00 00    	ja     803c20 <devfile_read+0x15e>
+        if (!res) {
+  803b45:	85 c0                	test   %eax,%eax
+  803b47:	74 21                	je     803b6a <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803b49:	48 89 da             	mov    %rbx,%rdx
+  803b4c:	4c 89 f6             	mov    %r14,%rsi
+  803b4f:	4c 89 ef             	mov    %r13,%rdi
+  803b52:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+        total_read += res;
+  803b5e:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803b62:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803b65:	49 29 dc             	sub    %rbx,%r12
+  803b68:	75 96                	jne    803b00 <devfile_read+0x3e>
+    return total_read;
+  803b6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803b6e:	48 83 c4 18          	add    $0x18,%rsp
+  803b72:	5b                   	pop    %rbx
+  803b73:	41 5c                	pop    %r12
+  803b75:	41 5d                	pop    %r13
+  803b77:	41 5e                	pop    %r14
+  803b79:	41 5f                	pop    %r15
+  803b7b:	5d                   	pop    %rbp
+  803b7c:	c3                   	ret
+    assert(fd);
+  803b7d:	48 b9 e1 65 80 00 00 	movabs $0x8065e1,%rcx
+  803b84:	00 00 00 
+  803b87:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803b8e:	00 00 00 
+  803b91:	be 91 00 00 00       	mov    $0x91,%esi
+  803b96:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803b9d:	00 00 00 
+  803ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba5:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803bac:	00 00 00 
+  803baf:	41 ff d0             	call   *%r8
+    assert(buf);
+  803bb2:	48 b9 e4 65 80 00 00 	movabs $0x8065e4,%rcx
+  803bb9:	00 00 00 
+  803bbc:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803bc3:	00 00 00 
+  803bc6:	be 92 00 00 00       	mov    $0x92,%esi
+  803bcb:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803bd2:	00 00 00 
+  803bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bda:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803be1:	00 00 00 
+  803be4:	41 ff d0             	call   *%r8
+            return res;
+  803be7:	48 98                	cltq
+  803be9:	eb 83                	jmp    803b6e <devfile_read+0xac>
+        assert(res <= n);
+  803beb:	48 b9 e8 65 80 00 00 	movabs $0x8065e8,%rcx
+  803bf2:	00 00 00 
+  803bf5:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803bfc:	00 00 00 
+  803bff:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803c04:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803c0b:	00 00 00 
+  803c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c13:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803c1a:	00 00 00 
+  803c1d:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803c20:	48 b9 f8 65 80 00 00 	movabs $0x8065f8,%rcx
+  803c27:	00 00 00 
+  803c2a:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803c31:	00 00 00 
+  803c34:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803c39:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803c40:	00 00 00 
+  803c43:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c48:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803c4f:	00 00 00 
+  803c52:	41 ff d0             	call   *%r8
+
+0000000000803c55 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803c55:	55                   	push   %rbp
+  803c56:	48 89 e5             	mov    %rsp,%rbp
+  803c59:	41 57                	push   %r15
+  803c5b:	41 56                	push   %r14
+  803c5d:	41 55                	push   %r13
+  803c5f:	41 54                	push   %r12
+  803c61:	53                   	push   %rbx
+  803c62:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803c66:	48 85 ff             	test   %rdi,%rdi
+  803c69:	0f 84 83 00 00 00    	je     803cf2 <devfile_write+0x9d>
+  803c6f:	49 89 ff             	mov    %rdi,%r15
+  803c72:	49 89 f4             	mov    %rsi,%r12
+  803c75:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803c78:	48 85 f6             	test   %rsi,%rsi
+  803c7b:	0f 84 a6 00 00 00    	je     803d27 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803c81:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803c87:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c8e:	00 00 00 
+  803c91:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c95:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c98:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c9c:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803ca1:	48 39 d3             	cmp    %rdx,%rbx
+  803ca4:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803ca8:	4c 89 e6             	mov    %r12,%rsi
+  803cab:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803cb2:	00 00 00 
+  803cb5:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803cc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc6:	be 00 00 00 00       	mov    $0x0,%esi
+  803ccb:	bf 04 00 00 00       	mov    $0x4,%edi
+  803cd0:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  803cd7:	00 00 00 
+  803cda:	ff d0                	call   *%rax
+        if (res < 0) {
+  803cdc:	85 c0                	test   %eax,%eax
+  803cde:	78 7c                	js     803d5c <devfile_write+0x107>
+        total_written += res;
+  803ce0:	48 98                	cltq
+  803ce2:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803ce5:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803ce8:	48 29 c3             	sub    %rax,%rbx
+  803ceb:	75 a4                	jne    803c91 <devfile_write+0x3c>
+    return total_written;
+  803ced:	4c 89 e8             	mov    %r13,%rax
+  803cf0:	eb 6c                	jmp    803d5e <devfile_write+0x109>
+    assert(fd);
+  803cf2:	48 b9 e1 65 80 00 00 	movabs $0x8065e1,%rcx
+  803cf9:	00 00 00 
+  803cfc:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803d03:	00 00 00 
+  803d06:	be bd 00 00 00       	mov    $0xbd,%esi
+  803d0b:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803d12:	00 00 00 
+  803d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1a:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803d21:	00 00 00 
+  803d24:	41 ff d0             	call   *%r8
+    assert(buf);
+  803d27:	48 b9 e4 65 80 00 00 	movabs $0x8065e4,%rcx
+  803d2e:	00 00 00 
+  803d31:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  803d38:	00 00 00 
+  803d3b:	be be 00 00 00       	mov    $0xbe,%esi
+  803d40:	48 bf d6 65 80 00 00 	movabs $0x8065d6,%rdi
+  803d47:	00 00 00 
+  803d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4f:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  803d56:	00 00 00 
+  803d59:	41 ff d0             	call   *%r8
+            return res;
+  803d5c:	48 98                	cltq
+}
+  803d5e:	48 83 c4 08          	add    $0x8,%rsp
+  803d62:	5b                   	pop    %rbx
+  803d63:	41 5c                	pop    %r12
+  803d65:	41 5d                	pop    %r13
+  803d67:	41 5e                	pop    %r14
+  803d69:	41 5f                	pop    %r15
+  803d6b:	5d                   	pop    %rbp
+  803d6c:	c3                   	ret
+
+0000000000803d6d <open>:
+open(const char *path, int mode) {
+  803d6d:	55                   	push   %rbp
+  803d6e:	48 89 e5             	mov    %rsp,%rbp
+  803d71:	41 55                	push   %r13
+  803d73:	41 54                	push   %r12
+  803d75:	53                   	push   %rbx
+  803d76:	48 83 ec 18          	sub    $0x18,%rsp
+  803d7a:	49 89 fc             	mov    %rdi,%r12
+  803d7d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803d80:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  803d87:	00 00 00 
+  803d8a:	ff d0                	call   *%rax
+  803d8c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803d92:	0f 87 8f 00 00 00    	ja     803e27 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d98:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d9c:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  803da3:	00 00 00 
+  803da6:	ff d0                	call   *%rax
+  803da8:	89 c3                	mov    %eax,%ebx
+  803daa:	85 c0                	test   %eax,%eax
+  803dac:	78 55                	js     803e03 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803dae:	4c 89 e6             	mov    %r12,%rsi
+  803db1:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803db8:	00 00 00 
+  803dbb:	48 89 df             	mov    %rbx,%rdi
+  803dbe:	48 b8 a1 23 80 00 00 	movabs $0x8023a1,%rax
+  803dc5:	00 00 00 
+  803dc8:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803dca:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803dd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dda:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ddf:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  803de6:	00 00 00 
+  803de9:	ff d0                	call   *%rax
+  803deb:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ded:	85 c0                	test   %eax,%eax
+  803def:	78 1f                	js     803e10 <open+0xa3>
+    return fd2num(fd);
+  803df1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803df5:	48 b8 64 31 80 00 00 	movabs $0x803164,%rax
+  803dfc:	00 00 00 
+  803dff:	ff d0                	call   *%rax
+  803e01:	89 c3                	mov    %eax,%ebx
+}
+  803e03:	89 d8                	mov    %ebx,%eax
+  803e05:	48 83 c4 18          	add    $0x18,%rsp
+  803e09:	5b                   	pop    %rbx
+  803e0a:	41 5c                	pop    %r12
+  803e0c:	41 5d                	pop    %r13
+  803e0e:	5d                   	pop    %rbp
+  803e0f:	c3                   	ret
+        fd_close(fd, 0);
+  803e10:	be 00 00 00 00       	mov    $0x0,%esi
+  803e15:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e19:	48 b8 ad 32 80 00 00 	movabs $0x8032ad,%rax
+  803e20:	00 00 00 
+  803e23:	ff d0                	call   *%rax
+        return res;
+  803e25:	eb dc                	jmp    803e03 <open+0x96>
+        return -E_BAD_PATH;
+  803e27:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803e2c:	eb d5                	jmp    803e03 <open+0x96>
+
+0000000000803e2e <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803e2e:	55                   	push   %rbp
+  803e2f:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803e32:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e37:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803e41:	48 b8 db 38 80 00 00 	movabs $0x8038db,%rax
+  803e48:	00 00 00 
+  803e4b:	ff d0                	call   *%rax
+}
+  803e4d:	5d                   	pop    %rbp
+  803e4e:	c3                   	ret
+
+0000000000803e4f <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803e4f:	55                   	push   %rbp
+  803e50:	48 89 e5             	mov    %rsp,%rbp
+  803e53:	41 56                	push   %r14
+  803e55:	41 55                	push   %r13
+  803e57:	41 54                	push   %r12
+  803e59:	53                   	push   %rbx
+  803e5a:	48 83 ec 10          	sub    $0x10,%rsp
+  803e5e:	41 89 f6             	mov    %esi,%r14d
+  803e61:	49 89 d4             	mov    %rdx,%r12
+  803e64:	48 89 cb             	mov    %rcx,%rbx
+  803e67:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e6a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e6e:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  803e75:	00 00 00 
+  803e78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	78 46                	js     803ec4 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e7e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e82:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803e89:	00 00 00 
+  803e8c:	8b 00                	mov    (%rax),%eax
+  803e8e:	39 02                	cmp    %eax,(%rdx)
+  803e90:	75 3f                	jne    803ed1 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803e92:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e99:	00 00 00 
+  803e9c:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e9f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803ea1:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803ea5:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803ea9:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803ead:	48 89 da             	mov    %rbx,%rdx
+  803eb0:	4c 89 e6             	mov    %r12,%rsi
+  803eb3:	bf 09 00 00 00       	mov    $0x9,%edi
+  803eb8:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  803ebf:	00 00 00 
+  803ec2:	ff d0                	call   *%rax
+}
+  803ec4:	48 83 c4 10          	add    $0x10,%rsp
+  803ec8:	5b                   	pop    %rbx
+  803ec9:	41 5c                	pop    %r12
+  803ecb:	41 5d                	pop    %r13
+  803ecd:	41 5e                	pop    %r14
+  803ecf:	5d                   	pop    %rbp
+  803ed0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ed1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ed6:	eb ec                	jmp    803ec4 <file_map+0x75>
+
+0000000000803ed8 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803ed8:	55                   	push   %rbp
+  803ed9:	48 89 e5             	mov    %rsp,%rbp
+  803edc:	41 54                	push   %r12
+  803ede:	53                   	push   %rbx
+  803edf:	48 83 ec 20          	sub    $0x20,%rsp
+  803ee3:	41 89 f4             	mov    %esi,%r12d
+  803ee6:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ee9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803eed:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  803ef4:	00 00 00 
+  803ef7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ef9:	85 c0                	test   %eax,%eax
+  803efb:	78 3c                	js     803f39 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803efd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f01:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803f08:	00 00 00 
+  803f0b:	8b 0a                	mov    (%rdx),%ecx
+  803f0d:	39 08                	cmp    %ecx,(%rax)
+  803f0f:	75 31                	jne    803f42 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803f11:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f14:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803f17:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803f1b:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803f1f:	ba 10 00 00 00       	mov    $0x10,%edx
+  803f24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f28:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803f2d:	48 b8 db 38 80 00 00 	movabs $0x8038db,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+}
+  803f39:	48 83 c4 20          	add    $0x20,%rsp
+  803f3d:	5b                   	pop    %rbx
+  803f3e:	41 5c                	pop    %r12
+  803f40:	5d                   	pop    %rbp
+  803f41:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803f47:	eb f0                	jmp    803f39 <file_msync+0x61>
+
+0000000000803f49 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803f49:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803f4d:	7f 01                	jg     803f50 <writebuf+0x7>
+  803f4f:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803f50:	55                   	push   %rbp
+  803f51:	48 89 e5             	mov    %rsp,%rbp
+  803f54:	53                   	push   %rbx
+  803f55:	48 83 ec 08          	sub    $0x8,%rsp
+  803f59:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803f5c:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803f60:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803f64:	8b 3f                	mov    (%rdi),%edi
+  803f66:	48 b8 04 36 80 00 00 	movabs $0x803604,%rax
+  803f6d:	00 00 00 
+  803f70:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803f72:	48 85 c0             	test   %rax,%rax
+  803f75:	7e 04                	jle    803f7b <writebuf+0x32>
+  803f77:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803f7b:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803f7f:	48 39 c2             	cmp    %rax,%rdx
+  803f82:	74 0f                	je     803f93 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803f84:	48 85 c0             	test   %rax,%rax
+  803f87:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f8c:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803f90:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803f93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f97:	c9                   	leave
+  803f98:	c3                   	ret
+
+0000000000803f99 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f99:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f9c:	8d 50 01             	lea    0x1(%rax),%edx
+  803f9f:	89 56 04             	mov    %edx,0x4(%rsi)
+  803fa2:	48 98                	cltq
+  803fa4:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803fa9:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803faf:	74 01                	je     803fb2 <putch+0x19>
+  803fb1:	c3                   	ret
+putch(int ch, void *arg) {
+  803fb2:	55                   	push   %rbp
+  803fb3:	48 89 e5             	mov    %rsp,%rbp
+  803fb6:	53                   	push   %rbx
+  803fb7:	48 83 ec 08          	sub    $0x8,%rsp
+  803fbb:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803fbe:	48 89 f7             	mov    %rsi,%rdi
+  803fc1:	48 b8 49 3f 80 00 00 	movabs $0x803f49,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+        state->offset = 0;
+  803fcd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803fd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803fd8:	c9                   	leave
+  803fd9:	c3                   	ret
+
+0000000000803fda <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803fda:	55                   	push   %rbp
+  803fdb:	48 89 e5             	mov    %rsp,%rbp
+  803fde:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803fe5:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803fe8:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803fee:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803ff5:	00 00 00 
+    state.result = 0;
+  803ff8:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803fff:	00 00 00 00 
+    state.error = 1;
+  804003:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80400a:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80400d:	48 89 f2             	mov    %rsi,%rdx
+  804010:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804017:	48 bf 99 3f 80 00 00 	movabs $0x803f99,%rdi
+  80401e:	00 00 00 
+  804021:	48 b8 ba 1b 80 00 00 	movabs $0x801bba,%rax
+  804028:	00 00 00 
+  80402b:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80402d:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804034:	7f 14                	jg     80404a <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804036:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80403d:	48 85 c0             	test   %rax,%rax
+  804040:	75 06                	jne    804048 <vfprintf+0x6e>
+  804042:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804048:	c9                   	leave
+  804049:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80404a:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804051:	48 b8 49 3f 80 00 00 	movabs $0x803f49,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+  80405d:	eb d7                	jmp    804036 <vfprintf+0x5c>
+
+000000000080405f <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80405f:	55                   	push   %rbp
+  804060:	48 89 e5             	mov    %rsp,%rbp
+  804063:	48 83 ec 50          	sub    $0x50,%rsp
+  804067:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80406b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80406f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804073:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804077:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80407e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804082:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804086:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80408a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80408e:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804092:	48 b8 da 3f 80 00 00 	movabs $0x803fda,%rax
+  804099:	00 00 00 
+  80409c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80409e:	c9                   	leave
+  80409f:	c3                   	ret
+
+00000000008040a0 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8040a0:	55                   	push   %rbp
+  8040a1:	48 89 e5             	mov    %rsp,%rbp
+  8040a4:	48 83 ec 50          	sub    $0x50,%rsp
+  8040a8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8040ac:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8040b0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8040b4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8040b8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8040bc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8040c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8040c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040cb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8040cf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8040d3:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8040d7:	48 89 fe             	mov    %rdi,%rsi
+  8040da:	bf 01 00 00 00       	mov    $0x1,%edi
+  8040df:	48 b8 da 3f 80 00 00 	movabs $0x803fda,%rax
+  8040e6:	00 00 00 
+  8040e9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8040eb:	c9                   	leave
+  8040ec:	c3                   	ret
+
+00000000008040ed <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8040ed:	55                   	push   %rbp
+  8040ee:	48 89 e5             	mov    %rsp,%rbp
+  8040f1:	41 54                	push   %r12
+  8040f3:	53                   	push   %rbx
+  8040f4:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8040f7:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  8040fe:	00 00 00 
+  804101:	ff d0                	call   *%rax
+  804103:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804106:	48 be 20 66 80 00 00 	movabs $0x806620,%rsi
+  80410d:	00 00 00 
+  804110:	48 89 df             	mov    %rbx,%rdi
+  804113:	48 b8 a1 23 80 00 00 	movabs $0x8023a1,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80411f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804124:	41 2b 04 24          	sub    (%r12),%eax
+  804128:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80412e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804135:	00 00 00 
+    stat->st_dev = &devpipe;
+  804138:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80413f:	00 00 00 
+  804142:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80414e:	5b                   	pop    %rbx
+  80414f:	41 5c                	pop    %r12
+  804151:	5d                   	pop    %rbp
+  804152:	c3                   	ret
+
+0000000000804153 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804153:	55                   	push   %rbp
+  804154:	48 89 e5             	mov    %rsp,%rbp
+  804157:	41 54                	push   %r12
+  804159:	53                   	push   %rbx
+  80415a:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80415d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804162:	48 89 fe             	mov    %rdi,%rsi
+  804165:	bf 00 00 00 00       	mov    $0x0,%edi
+  80416a:	49 bc de 2b 80 00 00 	movabs $0x802bde,%r12
+  804171:	00 00 00 
+  804174:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804177:	48 89 df             	mov    %rbx,%rdi
+  80417a:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  804181:	00 00 00 
+  804184:	ff d0                	call   *%rax
+  804186:	48 89 c6             	mov    %rax,%rsi
+  804189:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80418e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804193:	41 ff d4             	call   *%r12
+}
+  804196:	5b                   	pop    %rbx
+  804197:	41 5c                	pop    %r12
+  804199:	5d                   	pop    %rbp
+  80419a:	c3                   	ret
+
+000000000080419b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80419b:	55                   	push   %rbp
+  80419c:	48 89 e5             	mov    %rsp,%rbp
+  80419f:	41 57                	push   %r15
+  8041a1:	41 56                	push   %r14
+  8041a3:	41 55                	push   %r13
+  8041a5:	41 54                	push   %r12
+  8041a7:	53                   	push   %rbx
+  8041a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8041ac:	49 89 fc             	mov    %rdi,%r12
+  8041af:	49 89 f5             	mov    %rsi,%r13
+  8041b2:	49 89 d7             	mov    %rdx,%r15
+  8041b5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041b9:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  8041c0:	00 00 00 
+  8041c3:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8041c5:	4d 85 ff             	test   %r15,%r15
+  8041c8:	0f 84 af 00 00 00    	je     80427d <devpipe_write+0xe2>
+  8041ce:	48 89 c3             	mov    %rax,%rbx
+  8041d1:	4c 89 f8             	mov    %r15,%rax
+  8041d4:	4d 89 ef             	mov    %r13,%r15
+  8041d7:	4c 01 e8             	add    %r13,%rax
+  8041da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8041de:	49 bd d4 2a 80 00 00 	movabs $0x802ad4,%r13
+  8041e5:	00 00 00 
+            sys_yield();
+  8041e8:	49 be 65 2a 80 00 00 	movabs $0x802a65,%r14
+  8041ef:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8041f2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8041f5:	48 63 ce             	movslq %esi,%rcx
+  8041f8:	48 63 03             	movslq (%rbx),%rax
+  8041fb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804201:	48 39 c1             	cmp    %rax,%rcx
+  804204:	72 2e                	jb     804234 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804206:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80420b:	48 89 da             	mov    %rbx,%rdx
+  80420e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804213:	4c 89 e7             	mov    %r12,%rdi
+  804216:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804219:	85 c0                	test   %eax,%eax
+  80421b:	74 66                	je     804283 <devpipe_write+0xe8>
+            sys_yield();
+  80421d:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804220:	8b 73 04             	mov    0x4(%rbx),%esi
+  804223:	48 63 ce             	movslq %esi,%rcx
+  804226:	48 63 03             	movslq (%rbx),%rax
+  804229:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80422f:	48 39 c1             	cmp    %rax,%rcx
+  804232:	73 d2                	jae    804206 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804234:	41 0f b6 3f          	movzbl (%r15),%edi
+  804238:	48 89 ca             	mov    %rcx,%rdx
+  80423b:	48 c1 ea 03          	shr    $0x3,%rdx
+  80423f:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804246:	08 10 20 
+  804249:	48 f7 e2             	mul    %rdx
+  80424c:	48 c1 ea 06          	shr    $0x6,%rdx
+  804250:	48 89 d0             	mov    %rdx,%rax
+  804253:	48 c1 e0 09          	shl    $0x9,%rax
+  804257:	48 29 d0             	sub    %rdx,%rax
+  80425a:	48 c1 e0 03          	shl    $0x3,%rax
+  80425e:	48 29 c1             	sub    %rax,%rcx
+  804261:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804266:	83 c6 01             	add    $0x1,%esi
+  804269:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80426c:	49 83 c7 01          	add    $0x1,%r15
+  804270:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804274:	49 39 c7             	cmp    %rax,%r15
+  804277:	0f 85 75 ff ff ff    	jne    8041f2 <devpipe_write+0x57>
+    return n;
+  80427d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804281:	eb 05                	jmp    804288 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804288:	48 83 c4 18          	add    $0x18,%rsp
+  80428c:	5b                   	pop    %rbx
+  80428d:	41 5c                	pop    %r12
+  80428f:	41 5d                	pop    %r13
+  804291:	41 5e                	pop    %r14
+  804293:	41 5f                	pop    %r15
+  804295:	5d                   	pop    %rbp
+  804296:	c3                   	ret
+
+0000000000804297 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804297:	55                   	push   %rbp
+  804298:	48 89 e5             	mov    %rsp,%rbp
+  80429b:	41 57                	push   %r15
+  80429d:	41 56                	push   %r14
+  80429f:	41 55                	push   %r13
+  8042a1:	41 54                	push   %r12
+  8042a3:	53                   	push   %rbx
+  8042a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8042a8:	49 89 fc             	mov    %rdi,%r12
+  8042ab:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8042af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042b3:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  8042ba:	00 00 00 
+  8042bd:	ff d0                	call   *%rax
+  8042bf:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8042c2:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042c8:	49 bd d4 2a 80 00 00 	movabs $0x802ad4,%r13
+  8042cf:	00 00 00 
+            sys_yield();
+  8042d2:	49 be 65 2a 80 00 00 	movabs $0x802a65,%r14
+  8042d9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8042dc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8042e1:	74 7d                	je     804360 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8042e3:	8b 03                	mov    (%rbx),%eax
+  8042e5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8042e8:	75 26                	jne    804310 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8042ea:	4d 85 ff             	test   %r15,%r15
+  8042ed:	75 77                	jne    804366 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042ef:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8042f4:	48 89 da             	mov    %rbx,%rdx
+  8042f7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8042fc:	4c 89 e7             	mov    %r12,%rdi
+  8042ff:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804302:	85 c0                	test   %eax,%eax
+  804304:	74 72                	je     804378 <devpipe_read+0xe1>
+            sys_yield();
+  804306:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804309:	8b 03                	mov    (%rbx),%eax
+  80430b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80430e:	74 df                	je     8042ef <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804310:	48 63 c8             	movslq %eax,%rcx
+  804313:	48 89 ca             	mov    %rcx,%rdx
+  804316:	48 c1 ea 03          	shr    $0x3,%rdx
+  80431a:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804321:	08 10 20 
+  804324:	48 89 d0             	mov    %rdx,%rax
+  804327:	48 f7 e6             	mul    %rsi
+  80432a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80432e:	48 89 d0             	mov    %rdx,%rax
+  804331:	48 c1 e0 09          	shl    $0x9,%rax
+  804335:	48 29 d0             	sub    %rdx,%rax
+  804338:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80433f:	00 
+  804340:	48 89 c8             	mov    %rcx,%rax
+  804343:	48 29 d0             	sub    %rdx,%rax
+  804346:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80434b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80434f:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804353:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804356:	49 83 c7 01          	add    $0x1,%r15
+  80435a:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80435e:	75 83                	jne    8042e3 <devpipe_read+0x4c>
+    return n;
+  804360:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804364:	eb 03                	jmp    804369 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804366:	4c 89 f8             	mov    %r15,%rax
+}
+  804369:	48 83 c4 18          	add    $0x18,%rsp
+  80436d:	5b                   	pop    %rbx
+  80436e:	41 5c                	pop    %r12
+  804370:	41 5d                	pop    %r13
+  804372:	41 5e                	pop    %r14
+  804374:	41 5f                	pop    %r15
+  804376:	5d                   	pop    %rbp
+  804377:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437d:	eb ea                	jmp    804369 <devpipe_read+0xd2>
+
+000000000080437f <pipe>:
+pipe(int pfd[2]) {
+  80437f:	55                   	push   %rbp
+  804380:	48 89 e5             	mov    %rsp,%rbp
+  804383:	41 55                	push   %r13
+  804385:	41 54                	push   %r12
+  804387:	53                   	push   %rbx
+  804388:	48 83 ec 18          	sub    $0x18,%rsp
+  80438c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80438f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804393:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  80439a:	00 00 00 
+  80439d:	ff d0                	call   *%rax
+  80439f:	89 c3                	mov    %eax,%ebx
+  8043a1:	85 c0                	test   %eax,%eax
+  8043a3:	0f 88 a0 01 00 00    	js     804549 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8043a9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043bc:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  8043c3:	00 00 00 
+  8043c6:	ff d0                	call   *%rax
+  8043c8:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8043ca:	85 c0                	test   %eax,%eax
+  8043cc:	0f 88 77 01 00 00    	js     804549 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8043d2:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8043d6:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  8043dd:	00 00 00 
+  8043e0:	ff d0                	call   *%rax
+  8043e2:	89 c3                	mov    %eax,%ebx
+  8043e4:	85 c0                	test   %eax,%eax
+  8043e6:	0f 88 43 01 00 00    	js     80452f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8043ec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043f6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ff:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  804406:	00 00 00 
+  804409:	ff d0                	call   *%rax
+  80440b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80440d:	85 c0                	test   %eax,%eax
+  80440f:	0f 88 1a 01 00 00    	js     80452f <pipe+0x1b0>
+    va = fd2data(fd0);
+  804415:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804419:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  804420:	00 00 00 
+  804423:	ff d0                	call   *%rax
+  804425:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804428:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80442d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804432:	48 89 c6             	mov    %rax,%rsi
+  804435:	bf 00 00 00 00       	mov    $0x0,%edi
+  80443a:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  804441:	00 00 00 
+  804444:	ff d0                	call   *%rax
+  804446:	89 c3                	mov    %eax,%ebx
+  804448:	85 c0                	test   %eax,%eax
+  80444a:	0f 88 c5 00 00 00    	js     804515 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804450:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804454:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  80445b:	00 00 00 
+  80445e:	ff d0                	call   *%rax
+  804460:	48 89 c1             	mov    %rax,%rcx
+  804463:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804469:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80446f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804474:	4c 89 ee             	mov    %r13,%rsi
+  804477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80447c:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+  804488:	89 c3                	mov    %eax,%ebx
+  80448a:	85 c0                	test   %eax,%eax
+  80448c:	78 6e                	js     8044fc <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80448e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804493:	4c 89 ef             	mov    %r13,%rdi
+  804496:	48 b8 9c 2a 80 00 00 	movabs $0x802a9c,%rax
+  80449d:	00 00 00 
+  8044a0:	ff d0                	call   *%rax
+  8044a2:	83 f8 02             	cmp    $0x2,%eax
+  8044a5:	0f 85 ab 00 00 00    	jne    804556 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8044ab:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8044b2:	00 00 
+  8044b4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044b8:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8044ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044be:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8044c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8044c9:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8044cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044cf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8044d6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8044da:	48 bb 64 31 80 00 00 	movabs $0x803164,%rbx
+  8044e1:	00 00 00 
+  8044e4:	ff d3                	call   *%rbx
+  8044e6:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8044ea:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8044ee:	ff d3                	call   *%rbx
+  8044f0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8044f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044fa:	eb 4d                	jmp    804549 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8044fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804501:	4c 89 ee             	mov    %r13,%rsi
+  804504:	bf 00 00 00 00       	mov    $0x0,%edi
+  804509:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804515:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80451a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80451e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804523:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  80452a:	00 00 00 
+  80452d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80452f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804534:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804538:	bf 00 00 00 00       	mov    $0x0,%edi
+  80453d:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  804544:	00 00 00 
+  804547:	ff d0                	call   *%rax
+}
+  804549:	89 d8                	mov    %ebx,%eax
+  80454b:	48 83 c4 18          	add    $0x18,%rsp
+  80454f:	5b                   	pop    %rbx
+  804550:	41 5c                	pop    %r12
+  804552:	41 5d                	pop    %r13
+  804554:	5d                   	pop    %rbp
+  804555:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804556:	48 b9 38 66 80 00 00 	movabs $0x806638,%rcx
+  80455d:	00 00 00 
+  804560:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  804567:	00 00 00 
+  80456a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80456f:	48 bf 27 66 80 00 00 	movabs $0x806627,%rdi
+  804576:	00 00 00 
+  804579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457e:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  804585:	00 00 00 
+  804588:	41 ff d0             	call   *%r8
+
+000000000080458b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80458b:	55                   	push   %rbp
+  80458c:	48 89 e5             	mov    %rsp,%rbp
+  80458f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804593:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804597:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  80459e:	00 00 00 
+  8045a1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045a3:	85 c0                	test   %eax,%eax
+  8045a5:	78 35                	js     8045dc <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8045a7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045ab:	48 b8 76 31 80 00 00 	movabs $0x803176,%rax
+  8045b2:	00 00 00 
+  8045b5:	ff d0                	call   *%rax
+  8045b7:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045ba:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8045bf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045c8:	48 b8 d4 2a 80 00 00 	movabs $0x802ad4,%rax
+  8045cf:	00 00 00 
+  8045d2:	ff d0                	call   *%rax
+  8045d4:	85 c0                	test   %eax,%eax
+  8045d6:	0f 94 c0             	sete   %al
+  8045d9:	0f b6 c0             	movzbl %al,%eax
+}
+  8045dc:	c9                   	leave
+  8045dd:	c3                   	ret
+
+00000000008045de <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045de:	48 89 f8             	mov    %rdi,%rax
+  8045e1:	48 c1 e8 27          	shr    $0x27,%rax
+  8045e5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045ec:	01 00 00 
+  8045ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045f3:	f6 c2 01             	test   $0x1,%dl
+  8045f6:	74 6d                	je     804665 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045f8:	48 89 f8             	mov    %rdi,%rax
+  8045fb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8045ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804606:	01 00 00 
+  804609:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80460d:	f6 c2 01             	test   $0x1,%dl
+  804610:	74 62                	je     804674 <get_uvpt_entry+0x96>
+  804612:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804619:	01 00 00 
+  80461c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804620:	f6 c2 80             	test   $0x80,%dl
+  804623:	75 4f                	jne    804674 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804625:	48 89 f8             	mov    %rdi,%rax
+  804628:	48 c1 e8 15          	shr    $0x15,%rax
+  80462c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804633:	01 00 00 
+  804636:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80463a:	f6 c2 01             	test   $0x1,%dl
+  80463d:	74 44                	je     804683 <get_uvpt_entry+0xa5>
+  80463f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804646:	01 00 00 
+  804649:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80464d:	f6 c2 80             	test   $0x80,%dl
+  804650:	75 31                	jne    804683 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804652:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804656:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80465d:	01 00 00 
+  804660:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804664:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804665:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80466c:	01 00 00 
+  80466f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804673:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804674:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80467b:	01 00 00 
+  80467e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804682:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804683:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80468a:	01 00 00 
+  80468d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804691:	c3                   	ret
+
+0000000000804692 <get_prot>:
+
+int
+get_prot(void *va) {
+  804692:	55                   	push   %rbp
+  804693:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804696:	48 b8 de 45 80 00 00 	movabs $0x8045de,%rax
+  80469d:	00 00 00 
+  8046a0:	ff d0                	call   *%rax
+  8046a2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8046a5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8046aa:	89 c1                	mov    %eax,%ecx
+  8046ac:	83 c9 04             	or     $0x4,%ecx
+  8046af:	f6 c2 01             	test   $0x1,%dl
+  8046b2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8046b5:	89 c1                	mov    %eax,%ecx
+  8046b7:	83 c9 02             	or     $0x2,%ecx
+  8046ba:	f6 c2 02             	test   $0x2,%dl
+  8046bd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8046c0:	89 c1                	mov    %eax,%ecx
+  8046c2:	83 c9 01             	or     $0x1,%ecx
+  8046c5:	48 85 d2             	test   %rdx,%rdx
+  8046c8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8046cb:	89 c1                	mov    %eax,%ecx
+  8046cd:	83 c9 40             	or     $0x40,%ecx
+  8046d0:	f6 c6 04             	test   $0x4,%dh
+  8046d3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8046d6:	5d                   	pop    %rbp
+  8046d7:	c3                   	ret
+
+00000000008046d8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8046d8:	55                   	push   %rbp
+  8046d9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8046dc:	48 b8 de 45 80 00 00 	movabs $0x8045de,%rax
+  8046e3:	00 00 00 
+  8046e6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8046e8:	48 c1 e8 06          	shr    $0x6,%rax
+  8046ec:	83 e0 01             	and    $0x1,%eax
+}
+  8046ef:	5d                   	pop    %rbp
+  8046f0:	c3                   	ret
+
+00000000008046f1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8046f1:	55                   	push   %rbp
+  8046f2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8046f5:	48 b8 de 45 80 00 00 	movabs $0x8045de,%rax
+  8046fc:	00 00 00 
+  8046ff:	ff d0                	call   *%rax
+  804701:	83 e0 01             	and    $0x1,%eax
+}
+  804704:	5d                   	pop    %rbp
+  804705:	c3                   	ret
+
+0000000000804706 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804706:	55                   	push   %rbp
+  804707:	48 89 e5             	mov    %rsp,%rbp
+  80470a:	41 57                	push   %r15
+  80470c:	41 56                	push   %r14
+  80470e:	41 55                	push   %r13
+  804710:	41 54                	push   %r12
+  804712:	53                   	push   %rbx
+  804713:	48 83 ec 28          	sub    $0x28,%rsp
+  804717:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  80471b:	48 85 ff             	test   %rdi,%rdi
+  80471e:	74 1e                	je     80473e <foreach_shared_region+0x38>
+  804720:	49 89 ff             	mov    %rdi,%r15
+  804723:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804729:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80472f:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804736:	01 00 00 
+  804739:	e9 72 02 00 00       	jmp    8049b0 <foreach_shared_region+0x2aa>
+    assert(fun);
+  80473e:	48 b9 5c 66 80 00 00 	movabs $0x80665c,%rcx
+  804745:	00 00 00 
+  804748:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  80474f:	00 00 00 
+  804752:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804757:	48 bf 60 66 80 00 00 	movabs $0x806660,%rdi
+  80475e:	00 00 00 
+  804761:	b8 00 00 00 00       	mov    $0x0,%eax
+  804766:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  80476d:	00 00 00 
+  804770:	41 ff d0             	call   *%r8
+  804773:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80477a:	eb 6c                	jmp    8047e8 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80477c:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804783:	ff ff ff 
+  804786:	4c 21 e2             	and    %r12,%rdx
+  804789:	48 89 d8             	mov    %rbx,%rax
+  80478c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804791:	48 83 c0 01          	add    $0x1,%rax
+  804795:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804799:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8047a0:	00 00 00 
+  8047a3:	48 21 c8             	and    %rcx,%rax
+  8047a6:	48 09 d0             	or     %rdx,%rax
+  8047a9:	49 89 c4             	mov    %rax,%r12
+  8047ac:	eb 30                	jmp    8047de <foreach_shared_region+0xd8>
+  8047ae:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8047b5:	ff ff ff 
+  8047b8:	4c 21 e2             	and    %r12,%rdx
+  8047bb:	48 89 d8             	mov    %rbx,%rax
+  8047be:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8047c3:	48 83 c0 01          	add    $0x1,%rax
+  8047c7:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8047cb:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8047d2:	00 00 00 
+  8047d5:	48 21 c8             	and    %rcx,%rax
+  8047d8:	48 09 d0             	or     %rdx,%rax
+  8047db:	49 89 c4             	mov    %rax,%r12
+  8047de:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8047e2:	0f 84 99 01 00 00    	je     804981 <foreach_shared_region+0x27b>
+  8047e8:	4c 89 e3             	mov    %r12,%rbx
+  8047eb:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8047ef:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8047f6:	01 00 00 
+  8047f9:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8047fd:	a8 01                	test   $0x1,%al
+  8047ff:	0f 84 77 ff ff ff    	je     80477c <foreach_shared_region+0x76>
+  804805:	a8 80                	test   $0x80,%al
+  804807:	74 19                	je     804822 <foreach_shared_region+0x11c>
+  804809:	f6 c4 04             	test   $0x4,%ah
+  80480c:	74 a0                	je     8047ae <foreach_shared_region+0xa8>
+  80480e:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804815:	40 
+  804816:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80481a:	4c 89 e7             	mov    %r12,%rdi
+  80481d:	41 ff d7             	call   *%r15
+  804820:	eb 8c                	jmp    8047ae <foreach_shared_region+0xa8>
+  804822:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804829:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80482d:	eb 46                	jmp    804875 <foreach_shared_region+0x16f>
+  80482f:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804836:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80483c:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804840:	48 c1 e0 15          	shl    $0x15,%rax
+  804844:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804849:	49 09 c4             	or     %rax,%r12
+  80484c:	eb 1d                	jmp    80486b <foreach_shared_region+0x165>
+  80484e:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804855:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80485b:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80485f:	48 c1 e0 15          	shl    $0x15,%rax
+  804863:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804868:	49 09 c4             	or     %rax,%r12
+  80486b:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80486f:	0f 84 d3 00 00 00    	je     804948 <foreach_shared_region+0x242>
+  804875:	4c 89 e3             	mov    %r12,%rbx
+  804878:	48 c1 eb 15          	shr    $0x15,%rbx
+  80487c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804883:	01 00 00 
+  804886:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80488a:	a8 01                	test   $0x1,%al
+  80488c:	74 a1                	je     80482f <foreach_shared_region+0x129>
+  80488e:	a8 80                	test   $0x80,%al
+  804890:	74 19                	je     8048ab <foreach_shared_region+0x1a5>
+  804892:	f6 c4 04             	test   $0x4,%ah
+  804895:	74 b7                	je     80484e <foreach_shared_region+0x148>
+  804897:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80489e:	00 
+  80489f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048a3:	4c 89 e7             	mov    %r12,%rdi
+  8048a6:	41 ff d7             	call   *%r15
+  8048a9:	eb a3                	jmp    80484e <foreach_shared_region+0x148>
+  8048ab:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8048b1:	eb 3b                	jmp    8048ee <foreach_shared_region+0x1e8>
+  8048b3:	f6 c4 04             	test   $0x4,%ah
+  8048b6:	74 12                	je     8048ca <foreach_shared_region+0x1c4>
+  8048b8:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8048bf:	00 
+  8048c0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8048c4:	4c 89 e7             	mov    %r12,%rdi
+  8048c7:	41 ff d7             	call   *%r15
+  8048ca:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8048d1:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8048d7:	48 83 c3 01          	add    $0x1,%rbx
+  8048db:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8048df:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8048e5:	49 09 dc             	or     %rbx,%r12
+  8048e8:	41 83 ed 01          	sub    $0x1,%r13d
+  8048ec:	74 2f                	je     80491d <foreach_shared_region+0x217>
+  8048ee:	4c 89 e3             	mov    %r12,%rbx
+  8048f1:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8048f5:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8048f9:	a8 01                	test   $0x1,%al
+  8048fb:	75 b6                	jne    8048b3 <foreach_shared_region+0x1ad>
+  8048fd:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804904:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80490a:	48 83 c3 01          	add    $0x1,%rbx
+  80490e:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804912:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804918:	49 09 dc             	or     %rbx,%r12
+  80491b:	eb cb                	jmp    8048e8 <foreach_shared_region+0x1e2>
+  80491d:	4c 89 e0             	mov    %r12,%rax
+  804920:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804926:	49 c1 ec 15          	shr    $0x15,%r12
+  80492a:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804931:	49 83 c4 01          	add    $0x1,%r12
+  804935:	49 c1 e4 15          	shl    $0x15,%r12
+  804939:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804940:	49 09 c4             	or     %rax,%r12
+  804943:	e9 23 ff ff ff       	jmp    80486b <foreach_shared_region+0x165>
+  804948:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80494c:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804953:	ff ff ff 
+  804956:	4c 21 e0             	and    %r12,%rax
+  804959:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80495d:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804964:	49 83 c4 01          	add    $0x1,%r12
+  804968:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80496c:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804973:	00 00 00 
+  804976:	49 21 d4             	and    %rdx,%r12
+  804979:	49 09 c4             	or     %rax,%r12
+  80497c:	e9 5d fe ff ff       	jmp    8047de <foreach_shared_region+0xd8>
+  804981:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804988:	00 ff ff 
+  80498b:	4c 21 e0             	and    %r12,%rax
+  80498e:	49 c1 ec 27          	shr    $0x27,%r12
+  804992:	49 83 c4 01          	add    $0x1,%r12
+  804996:	49 c1 e4 27          	shl    $0x27,%r12
+  80499a:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8049a1:	ff 00 00 
+  8049a4:	49 21 d4             	and    %rdx,%r12
+  8049a7:	49 09 c4             	or     %rax,%r12
+  8049aa:	41 83 ed 01          	sub    $0x1,%r13d
+  8049ae:	74 48                	je     8049f8 <foreach_shared_region+0x2f2>
+  8049b0:	4c 89 e0             	mov    %r12,%rax
+  8049b3:	48 c1 e8 27          	shr    $0x27,%rax
+  8049b7:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8049be:	01 00 00 
+  8049c1:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8049c5:	f6 c2 01             	test   $0x1,%dl
+  8049c8:	0f 85 a5 fd ff ff    	jne    804773 <foreach_shared_region+0x6d>
+  8049ce:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8049d5:	00 ff ff 
+  8049d8:	4c 21 e2             	and    %r12,%rdx
+  8049db:	48 83 c0 01          	add    $0x1,%rax
+  8049df:	48 c1 e0 27          	shl    $0x27,%rax
+  8049e3:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8049ea:	ff 00 00 
+  8049ed:	48 21 c8             	and    %rcx,%rax
+  8049f0:	48 09 d0             	or     %rdx,%rax
+  8049f3:	49 89 c4             	mov    %rax,%r12
+  8049f6:	eb b2                	jmp    8049aa <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8049f8:	4d 85 e4             	test   %r12,%r12
+  8049fb:	75 14                	jne    804a11 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8049fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a02:	48 83 c4 28          	add    $0x28,%rsp
+  804a06:	5b                   	pop    %rbx
+  804a07:	41 5c                	pop    %r12
+  804a09:	41 5d                	pop    %r13
+  804a0b:	41 5e                	pop    %r14
+  804a0d:	41 5f                	pop    %r15
+  804a0f:	5d                   	pop    %rbp
+  804a10:	c3                   	ret
+    assert(addr == 0);
+  804a11:	48 b9 6b 66 80 00 00 	movabs $0x80666b,%rcx
+  804a18:	00 00 00 
+  804a1b:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  804a22:	00 00 00 
+  804a25:	be 67 00 00 00       	mov    $0x67,%esi
+  804a2a:	48 bf 60 66 80 00 00 	movabs $0x806660,%rdi
+  804a31:	00 00 00 
+  804a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a39:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  804a40:	00 00 00 
+  804a43:	41 ff d0             	call   *%r8
+
+0000000000804a46 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804a46:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804a4d:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804a50:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804a56:	eb 33                	jmp    804a8b <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a58:	48 83 c0 20          	add    $0x20,%rax
+  804a5c:	4c 39 c0             	cmp    %r8,%rax
+  804a5f:	74 25                	je     804a86 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804a61:	48 8b 10             	mov    (%rax),%rdx
+  804a64:	48 85 d2             	test   %rdx,%rdx
+  804a67:	74 ef                	je     804a58 <mmap_place+0x12>
+  804a69:	48 89 d1             	mov    %rdx,%rcx
+  804a6c:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a70:	48 39 cf             	cmp    %rcx,%rdi
+  804a73:	73 e3                	jae    804a58 <mmap_place+0x12>
+  804a75:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804a79:	4c 39 ca             	cmp    %r9,%rdx
+  804a7c:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804a80:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804a84:	eb d2                	jmp    804a58 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804a86:	45 84 d2             	test   %r10b,%r10b
+  804a89:	74 12                	je     804a9d <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a8b:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a92:	00 00 00 
+        moved = 0;
+  804a95:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a9b:	eb c4                	jmp    804a61 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a9d:	48 01 fe             	add    %rdi,%rsi
+  804aa0:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804aa7:	00 00 00 
+  804aaa:	48 39 f0             	cmp    %rsi,%rax
+  804aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab2:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804ab6:	c3                   	ret
+
+0000000000804ab7 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804ab7:	55                   	push   %rbp
+  804ab8:	48 89 e5             	mov    %rsp,%rbp
+  804abb:	41 57                	push   %r15
+  804abd:	41 56                	push   %r14
+  804abf:	41 55                	push   %r13
+  804ac1:	41 54                	push   %r12
+  804ac3:	53                   	push   %rbx
+  804ac4:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804ac8:	48 8b 1f             	mov    (%rdi),%rbx
+  804acb:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ad2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804ad9:	00 00 00 
+  804adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ae1:	eb 12                	jmp    804af5 <mmap_pgfault+0x3e>
+  804ae3:	48 83 c2 01          	add    $0x1,%rdx
+  804ae7:	48 83 c0 20          	add    $0x20,%rax
+  804aeb:	48 83 fa 20          	cmp    $0x20,%rdx
+  804aef:	0f 84 04 01 00 00    	je     804bf9 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804af5:	48 8b 08             	mov    (%rax),%rcx
+  804af8:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804afc:	48 39 de             	cmp    %rbx,%rsi
+  804aff:	73 e2                	jae    804ae3 <mmap_pgfault+0x2c>
+  804b01:	48 03 48 08          	add    0x8(%rax),%rcx
+  804b05:	48 39 cb             	cmp    %rcx,%rbx
+  804b08:	73 d9                	jae    804ae3 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804b0a:	48 c1 e2 05          	shl    $0x5,%rdx
+  804b0e:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804b15:	00 00 00 
+  804b18:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804b1c:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804b20:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804b24:	f6 c2 01             	test   $0x1,%dl
+  804b27:	0f 84 e0 00 00 00    	je     804c0d <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b32:	f6 c2 02             	test   $0x2,%dl
+  804b35:	0f 84 c3 00 00 00    	je     804bfe <mmap_pgfault+0x147>
+  804b3b:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804b42:	ff ff ff 
+  804b45:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804b49:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804b50:	00 00 00 
+  804b53:	48 39 ca             	cmp    %rcx,%rdx
+  804b56:	0f 85 a2 00 00 00    	jne    804bfe <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804b5c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804b61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b66:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804b6d:	00 00 00 
+  804b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b75:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  804b7c:	00 00 00 
+  804b7f:	ff d0                	call   *%rax
+  804b81:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b88:	85 d2                	test   %edx,%edx
+  804b8a:	78 72                	js     804bfe <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804b8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b91:	48 89 de             	mov    %rbx,%rsi
+  804b94:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b9b:	00 00 00 
+  804b9e:	4c 89 e7             	mov    %r12,%rdi
+  804ba1:	48 b8 58 27 80 00 00 	movabs $0x802758,%rax
+  804ba8:	00 00 00 
+  804bab:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804bad:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804bb3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804bb9:	48 89 d9             	mov    %rbx,%rcx
+  804bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bc1:	4c 89 e6             	mov    %r12,%rsi
+  804bc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bc9:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  804bd0:	00 00 00 
+  804bd3:	ff d0                	call   *%rax
+  804bd5:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804bd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804bdc:	4c 89 e6             	mov    %r12,%rsi
+  804bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804be4:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  804beb:	00 00 00 
+  804bee:	ff d0                	call   *%rax
+    return res >= 0;
+  804bf0:	89 d8                	mov    %ebx,%eax
+  804bf2:	f7 d0                	not    %eax
+  804bf4:	c1 e8 1f             	shr    $0x1f,%eax
+  804bf7:	eb 05                	jmp    804bfe <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804bfe:	48 83 c4 18          	add    $0x18,%rsp
+  804c02:	5b                   	pop    %rbx
+  804c03:	41 5c                	pop    %r12
+  804c05:	41 5d                	pop    %r13
+  804c07:	41 5e                	pop    %r14
+  804c09:	41 5f                	pop    %r15
+  804c0b:	5d                   	pop    %rbp
+  804c0c:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804c0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c11:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804c15:	4c 03 30             	add    (%rax),%r14
+  804c18:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804c1f:	49 39 c6             	cmp    %rax,%r14
+  804c22:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804c26:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804c2d:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804c33:	49 bf f1 46 80 00 00 	movabs $0x8046f1,%r15
+  804c3a:	00 00 00 
+  804c3d:	4d 39 f4             	cmp    %r14,%r12
+  804c40:	73 1d                	jae    804c5f <mmap_pgfault+0x1a8>
+  804c42:	4c 89 e7             	mov    %r12,%rdi
+  804c45:	41 ff d7             	call   *%r15
+  804c48:	84 c0                	test   %al,%al
+  804c4a:	75 13                	jne    804c5f <mmap_pgfault+0x1a8>
+  804c4c:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804c53:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804c5a:	4d 39 f4             	cmp    %r14,%r12
+  804c5d:	72 e3                	jb     804c42 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c5f:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804c65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c69:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804c6d:	74 2a                	je     804c99 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804c6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c73:	89 de                	mov    %ebx,%esi
+  804c75:	2b 30                	sub    (%rax),%esi
+  804c77:	03 70 1c             	add    0x1c(%rax),%esi
+  804c7a:	8b 78 18             	mov    0x18(%rax),%edi
+  804c7d:	4c 89 e9             	mov    %r13,%rcx
+  804c80:	48 89 da             	mov    %rbx,%rdx
+  804c83:	48 b8 4f 3e 80 00 00 	movabs $0x803e4f,%rax
+  804c8a:	00 00 00 
+  804c8d:	ff d0                	call   *%rax
+    return res > 0;
+  804c8f:	85 c0                	test   %eax,%eax
+  804c91:	0f 9f c0             	setg   %al
+  804c94:	e9 65 ff ff ff       	jmp    804bfe <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c99:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c9d:	eb d0                	jmp    804c6f <mmap_pgfault+0x1b8>
+
+0000000000804c9f <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c9f:	55                   	push   %rbp
+  804ca0:	48 89 e5             	mov    %rsp,%rbp
+  804ca3:	41 57                	push   %r15
+  804ca5:	41 56                	push   %r14
+  804ca7:	41 55                	push   %r13
+  804ca9:	41 54                	push   %r12
+  804cab:	53                   	push   %rbx
+  804cac:	48 83 ec 28          	sub    $0x28,%rsp
+  804cb0:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804cb4:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804cb7:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804cbe:	ff ff ff 
+  804cc1:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cca:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804cd1:	00 00 00 
+  804cd4:	48 39 ca             	cmp    %rcx,%rdx
+  804cd7:	0f 85 e5 00 00 00    	jne    804dc2 <mmap_writeback+0x123>
+  804cdd:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804ce0:	4c 39 ee             	cmp    %r13,%rsi
+  804ce3:	0f 83 e8 00 00 00    	jae    804dd1 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ce9:	49 be f1 46 80 00 00 	movabs $0x8046f1,%r14
+  804cf0:	00 00 00 
+  804cf3:	49 bf d8 46 80 00 00 	movabs $0x8046d8,%r15
+  804cfa:	00 00 00 
+  804cfd:	eb 10                	jmp    804d0f <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804cff:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804d06:	4d 39 ec             	cmp    %r13,%r12
+  804d09:	0f 83 ae 00 00 00    	jae    804dbd <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804d0f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804d13:	4c 89 e7             	mov    %r12,%rdi
+  804d16:	41 ff d6             	call   *%r14
+  804d19:	84 c0                	test   %al,%al
+  804d1b:	74 e2                	je     804cff <mmap_writeback+0x60>
+  804d1d:	4c 89 e7             	mov    %r12,%rdi
+  804d20:	41 ff d7             	call   *%r15
+  804d23:	84 c0                	test   %al,%al
+  804d25:	74 d8                	je     804cff <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804d27:	4c 89 e3             	mov    %r12,%rbx
+  804d2a:	4d 39 ec             	cmp    %r13,%r12
+  804d2d:	73 20                	jae    804d4f <mmap_writeback+0xb0>
+  804d2f:	48 89 df             	mov    %rbx,%rdi
+  804d32:	41 ff d6             	call   *%r14
+  804d35:	84 c0                	test   %al,%al
+  804d37:	74 16                	je     804d4f <mmap_writeback+0xb0>
+  804d39:	48 89 df             	mov    %rbx,%rdi
+  804d3c:	41 ff d7             	call   *%r15
+  804d3f:	84 c0                	test   %al,%al
+  804d41:	74 0c                	je     804d4f <mmap_writeback+0xb0>
+  804d43:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804d4a:	4c 39 eb             	cmp    %r13,%rbx
+  804d4d:	72 e0                	jb     804d2f <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804d4f:	48 89 d9             	mov    %rbx,%rcx
+  804d52:	4c 29 e1             	sub    %r12,%rcx
+  804d55:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804d59:	44 89 e6             	mov    %r12d,%esi
+  804d5c:	2b 30                	sub    (%rax),%esi
+  804d5e:	49 89 c4             	mov    %rax,%r12
+  804d61:	03 70 1c             	add    0x1c(%rax),%esi
+  804d64:	8b 78 18             	mov    0x18(%rax),%edi
+  804d67:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804d6b:	48 89 ca             	mov    %rcx,%rdx
+  804d6e:	48 b8 d8 3e 80 00 00 	movabs $0x803ed8,%rax
+  804d75:	00 00 00 
+  804d78:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804d7a:	85 c0                	test   %eax,%eax
+  804d7c:	78 44                	js     804dc2 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804d7e:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804d83:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804d86:	41 89 c1             	mov    %eax,%r9d
+  804d89:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804d90:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d94:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d9d:	48 89 ce             	mov    %rcx,%rsi
+  804da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da5:	48 b8 73 2b 80 00 00 	movabs $0x802b73,%rax
+  804dac:	00 00 00 
+  804daf:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804db1:	85 c0                	test   %eax,%eax
+  804db3:	78 0d                	js     804dc2 <mmap_writeback+0x123>
+  804db5:	49 89 dc             	mov    %rbx,%r12
+  804db8:	e9 49 ff ff ff       	jmp    804d06 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dc2:	48 83 c4 28          	add    $0x28,%rsp
+  804dc6:	5b                   	pop    %rbx
+  804dc7:	41 5c                	pop    %r12
+  804dc9:	41 5d                	pop    %r13
+  804dcb:	41 5e                	pop    %r14
+  804dcd:	41 5f                	pop    %r15
+  804dcf:	5d                   	pop    %rbp
+  804dd0:	c3                   	ret
+    return 0;
+  804dd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd6:	eb ea                	jmp    804dc2 <mmap_writeback+0x123>
+
+0000000000804dd8 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804dd8:	55                   	push   %rbp
+  804dd9:	48 89 e5             	mov    %rsp,%rbp
+  804ddc:	41 57                	push   %r15
+  804dde:	41 56                	push   %r14
+  804de0:	41 55                	push   %r13
+  804de2:	41 54                	push   %r12
+  804de4:	53                   	push   %rbx
+  804de5:	48 83 ec 38          	sub    $0x38,%rsp
+  804de9:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ded:	48 85 f6             	test   %rsi,%rsi
+  804df0:	0f 84 0c 02 00 00    	je     805002 <mmap+0x22a>
+  804df6:	49 89 ff             	mov    %rdi,%r15
+  804df9:	49 89 f4             	mov    %rsi,%r12
+  804dfc:	41 89 d5             	mov    %edx,%r13d
+  804dff:	41 89 ce             	mov    %ecx,%r14d
+  804e02:	44 89 cb             	mov    %r9d,%ebx
+  804e05:	45 85 c9             	test   %r9d,%r9d
+  804e08:	0f 88 f4 01 00 00    	js     805002 <mmap+0x22a>
+  804e0e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e15:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804e1c:	0f 85 e7 01 00 00    	jne    805009 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804e22:	83 e2 fd             	and    $0xfffffffd,%edx
+  804e25:	83 fa 04             	cmp    $0x4,%edx
+  804e28:	0f 85 db 01 00 00    	jne    805009 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804e2e:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804e31:	83 fa 01             	cmp    $0x1,%edx
+  804e34:	0f 87 cf 01 00 00    	ja     805009 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804e3a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804e3e:	44 89 c7             	mov    %r8d,%edi
+  804e41:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  804e48:	00 00 00 
+  804e4b:	ff d0                	call   *%rax
+  804e4d:	89 c2                	mov    %eax,%edx
+  804e4f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e56:	85 d2                	test   %edx,%edx
+  804e58:	0f 88 ab 01 00 00    	js     805009 <mmap+0x231>
+  804e5e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e62:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804e69:	00 00 00 
+  804e6c:	8b 09                	mov    (%rcx),%ecx
+  804e6e:	39 0a                	cmp    %ecx,(%rdx)
+  804e70:	0f 85 93 01 00 00    	jne    805009 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804e76:	8b 52 08             	mov    0x8(%rdx),%edx
+  804e79:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804e7c:	83 fa 01             	cmp    $0x1,%edx
+  804e7f:	0f 84 84 01 00 00    	je     805009 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e85:	41 83 fe 01          	cmp    $0x1,%r14d
+  804e89:	74 42                	je     804ecd <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804e8b:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804e92:	4c 89 e6             	mov    %r12,%rsi
+  804e95:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e9c:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804ea0:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804ea4:	4d 85 ff             	test   %r15,%r15
+  804ea7:	74 67                	je     804f10 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ea9:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804eb0:	75 0f                	jne    804ec1 <mmap+0xe9>
+  804eb2:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804eb9:	00 00 00 
+  804ebc:	49 39 c7             	cmp    %rax,%r15
+  804ebf:	77 1b                	ja     804edc <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ec1:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ec8:	e9 3c 01 00 00       	jmp    805009 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ecd:	41 f6 c5 02          	test   $0x2,%r13b
+  804ed1:	74 b8                	je     804e8b <mmap+0xb3>
+  804ed3:	85 d2                	test   %edx,%edx
+  804ed5:	75 b4                	jne    804e8b <mmap+0xb3>
+  804ed7:	e9 2d 01 00 00       	jmp    805009 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804edc:	4c 89 ff             	mov    %r15,%rdi
+  804edf:	48 b8 46 4a 80 00 00 	movabs $0x804a46,%rax
+  804ee6:	00 00 00 
+  804ee9:	ff d0                	call   *%rax
+  804eeb:	48 89 c2             	mov    %rax,%rdx
+  804eee:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804ef5:	49 39 d7             	cmp    %rdx,%r15
+  804ef8:	0f 85 0b 01 00 00    	jne    805009 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804efe:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f05:	00 00 00 
+  804f08:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f0e:	eb 44                	jmp    804f54 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804f10:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804f14:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804f1b:	00 00 00 
+  804f1e:	48 b8 46 4a 80 00 00 	movabs $0x804a46,%rax
+  804f25:	00 00 00 
+  804f28:	ff d0                	call   *%rax
+  804f2a:	48 89 c7             	mov    %rax,%rdi
+  804f2d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804f31:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804f38:	48 85 ff             	test   %rdi,%rdi
+  804f3b:	75 c1                	jne    804efe <mmap+0x126>
+  804f3d:	e9 c7 00 00 00       	jmp    805009 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804f42:	49 83 c4 01          	add    $0x1,%r12
+  804f46:	48 83 c0 20          	add    $0x20,%rax
+  804f4a:	49 83 fc 20          	cmp    $0x20,%r12
+  804f4e:	0f 84 a5 00 00 00    	je     804ff9 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f54:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804f58:	75 e8                	jne    804f42 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804f5a:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804f5e:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  804f65:	00 00 00 
+  804f68:	ff d0                	call   *%rax
+  804f6a:	89 c2                	mov    %eax,%edx
+  804f6c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f73:	85 d2                	test   %edx,%edx
+  804f75:	0f 88 8e 00 00 00    	js     805009 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804f7b:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804f7f:	48 b8 64 31 80 00 00 	movabs $0x803164,%rax
+  804f86:	00 00 00 
+  804f89:	ff d0                	call   *%rax
+  804f8b:	89 c6                	mov    %eax,%esi
+  804f8d:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804f90:	48 b8 b2 33 80 00 00 	movabs $0x8033b2,%rax
+  804f97:	00 00 00 
+  804f9a:	ff d0                	call   *%rax
+  804f9c:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f9f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fa6:	45 85 ff             	test   %r15d,%r15d
+  804fa9:	78 5e                	js     805009 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804fab:	49 c1 e4 05          	shl    $0x5,%r12
+  804faf:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804fb6:	00 00 00 
+  804fb9:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804fbc:	48 bf b7 4a 80 00 00 	movabs $0x804ab7,%rdi
+  804fc3:	00 00 00 
+  804fc6:	48 b8 e2 54 80 00 00 	movabs $0x8054e2,%rax
+  804fcd:	00 00 00 
+  804fd0:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804fd2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804fd6:	49 89 04 24          	mov    %rax,(%r12)
+  804fda:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804fde:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804fe3:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804fe8:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804fed:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804ff2:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804ff7:	eb 10                	jmp    805009 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804ff9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805000:	eb 07                	jmp    805009 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805002:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805009:	48 83 c4 38          	add    $0x38,%rsp
+  80500d:	5b                   	pop    %rbx
+  80500e:	41 5c                	pop    %r12
+  805010:	41 5d                	pop    %r13
+  805012:	41 5e                	pop    %r14
+  805014:	41 5f                	pop    %r15
+  805016:	5d                   	pop    %rbp
+  805017:	c3                   	ret
+
+0000000000805018 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805018:	55                   	push   %rbp
+  805019:	48 89 e5             	mov    %rsp,%rbp
+  80501c:	41 57                	push   %r15
+  80501e:	41 56                	push   %r14
+  805020:	41 55                	push   %r13
+  805022:	41 54                	push   %r12
+  805024:	53                   	push   %rbx
+  805025:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805029:	49 89 fe             	mov    %rdi,%r14
+  80502c:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805033:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80503a:	00 
+  80503b:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805042:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805049:	00 00 00 
+  80504c:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805053:	49 bf 9f 4c 80 00 00 	movabs $0x804c9f,%r15
+  80505a:	00 00 00 
+  80505d:	eb 09                	jmp    805068 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80505f:	48 83 c3 20          	add    $0x20,%rbx
+  805063:	4c 39 eb             	cmp    %r13,%rbx
+  805066:	74 33                	je     80509b <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805068:	48 89 df             	mov    %rbx,%rdi
+  80506b:	48 8b 33             	mov    (%rbx),%rsi
+  80506e:	4c 39 e6             	cmp    %r12,%rsi
+  805071:	73 ec                	jae    80505f <msync+0x47>
+  805073:	48 85 f6             	test   %rsi,%rsi
+  805076:	74 e7                	je     80505f <msync+0x47>
+  805078:	48 89 f2             	mov    %rsi,%rdx
+  80507b:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80507f:	49 39 d6             	cmp    %rdx,%r14
+  805082:	73 db                	jae    80505f <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805084:	4c 39 e2             	cmp    %r12,%rdx
+  805087:	49 0f 47 d4          	cmova  %r12,%rdx
+  80508b:	4c 39 f6             	cmp    %r14,%rsi
+  80508e:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805092:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805095:	85 c0                	test   %eax,%eax
+  805097:	79 c6                	jns    80505f <msync+0x47>
+  805099:	eb 05                	jmp    8050a0 <msync+0x88>
+    }
+
+    return 0;
+  80509b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050a0:	48 83 c4 08          	add    $0x8,%rsp
+  8050a4:	5b                   	pop    %rbx
+  8050a5:	41 5c                	pop    %r12
+  8050a7:	41 5d                	pop    %r13
+  8050a9:	41 5e                	pop    %r14
+  8050ab:	41 5f                	pop    %r15
+  8050ad:	5d                   	pop    %rbp
+  8050ae:	c3                   	ret
+
+00000000008050af <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8050af:	55                   	push   %rbp
+  8050b0:	48 89 e5             	mov    %rsp,%rbp
+  8050b3:	41 57                	push   %r15
+  8050b5:	41 56                	push   %r14
+  8050b7:	41 55                	push   %r13
+  8050b9:	41 54                	push   %r12
+  8050bb:	53                   	push   %rbx
+  8050bc:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8050c0:	49 89 ff             	mov    %rdi,%r15
+  8050c3:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8050ca:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8050d1:	00 
+  8050d2:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050d9:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8050e0:	00 00 00 
+  8050e3:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8050ea:	48 89 d8             	mov    %rbx,%rax
+  8050ed:	eb 09                	jmp    8050f8 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050ef:	48 83 c0 20          	add    $0x20,%rax
+  8050f3:	4c 39 f0             	cmp    %r14,%rax
+  8050f6:	74 40                	je     805138 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050f8:	48 8b 10             	mov    (%rax),%rdx
+  8050fb:	4c 39 e2             	cmp    %r12,%rdx
+  8050fe:	73 ef                	jae    8050ef <munmap+0x40>
+  805100:	48 85 d2             	test   %rdx,%rdx
+  805103:	74 ea                	je     8050ef <munmap+0x40>
+  805105:	48 89 d7             	mov    %rdx,%rdi
+  805108:	48 03 78 08          	add    0x8(%rax),%rdi
+  80510c:	49 39 ff             	cmp    %rdi,%r15
+  80510f:	73 de                	jae    8050ef <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805111:	49 39 fc             	cmp    %rdi,%r12
+  805114:	72 05                	jb     80511b <munmap+0x6c>
+  805116:	4c 39 fa             	cmp    %r15,%rdx
+  805119:	73 d4                	jae    8050ef <munmap+0x40>
+  80511b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805120:	48 83 c4 08          	add    $0x8,%rsp
+  805124:	5b                   	pop    %rbx
+  805125:	41 5c                	pop    %r12
+  805127:	41 5d                	pop    %r13
+  805129:	41 5e                	pop    %r14
+  80512b:	41 5f                	pop    %r15
+  80512d:	5d                   	pop    %rbp
+  80512e:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80512f:	48 83 c3 20          	add    $0x20,%rbx
+  805133:	4c 39 f3             	cmp    %r14,%rbx
+  805136:	74 5c                	je     805194 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805138:	48 8b 33             	mov    (%rbx),%rsi
+  80513b:	4c 39 e6             	cmp    %r12,%rsi
+  80513e:	73 ef                	jae    80512f <munmap+0x80>
+  805140:	48 85 f6             	test   %rsi,%rsi
+  805143:	74 ea                	je     80512f <munmap+0x80>
+  805145:	48 89 f2             	mov    %rsi,%rdx
+  805148:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80514c:	49 39 d7             	cmp    %rdx,%r15
+  80514f:	73 de                	jae    80512f <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805151:	48 89 df             	mov    %rbx,%rdi
+  805154:	48 b8 9f 4c 80 00 00 	movabs $0x804c9f,%rax
+  80515b:	00 00 00 
+  80515e:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805160:	85 c0                	test   %eax,%eax
+  805162:	78 bc                	js     805120 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805164:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805168:	48 8b 33             	mov    (%rbx),%rsi
+  80516b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805170:	48 b8 de 2b 80 00 00 	movabs $0x802bde,%rax
+  805177:	00 00 00 
+  80517a:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80517c:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80517f:	48 b8 57 33 80 00 00 	movabs $0x803357,%rax
+  805186:	00 00 00 
+  805189:	ff d0                	call   *%rax
+        reg->start = 0;
+  80518b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805192:	eb 9b                	jmp    80512f <munmap+0x80>
+    return 0;
+  805194:	b8 00 00 00 00       	mov    $0x0,%eax
+  805199:	eb 85                	jmp    805120 <munmap+0x71>
+
+000000000080519b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80519b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051a0:	c3                   	ret
+
+00000000008051a1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8051a1:	55                   	push   %rbp
+  8051a2:	48 89 e5             	mov    %rsp,%rbp
+  8051a5:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8051a8:	48 be 75 66 80 00 00 	movabs $0x806675,%rsi
+  8051af:	00 00 00 
+  8051b2:	48 b8 a1 23 80 00 00 	movabs $0x8023a1,%rax
+  8051b9:	00 00 00 
+  8051bc:	ff d0                	call   *%rax
+    return 0;
+}
+  8051be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c3:	5d                   	pop    %rbp
+  8051c4:	c3                   	ret
+
+00000000008051c5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8051c5:	55                   	push   %rbp
+  8051c6:	48 89 e5             	mov    %rsp,%rbp
+  8051c9:	41 57                	push   %r15
+  8051cb:	41 56                	push   %r14
+  8051cd:	41 55                	push   %r13
+  8051cf:	41 54                	push   %r12
+  8051d1:	53                   	push   %rbx
+  8051d2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8051d9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8051e0:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8051e7:	00 00 00 00 
+  8051eb:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8051f2:	00 00 00 00 
+  8051f6:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8051fd:	00 00 00 00 
+  805201:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805208:	00 00 00 00 
+  80520c:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805213:	00 00 00 00 
+  805217:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80521e:	00 00 00 00 
+  805222:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805229:	00 
+  80522a:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805231:	00 
+  805232:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805239:	00 
+  80523a:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805241:	00 
+  805242:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805249:	00 
+  80524a:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805251:	00 
+  805252:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805259:	00 
+  80525a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805261:	00 
+  805262:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805269:	00 
+  80526a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805271:	00 
+    for (res = 0; res < n; res += inc) {
+  805272:	48 85 d2             	test   %rdx,%rdx
+  805275:	74 7a                	je     8052f1 <devcons_write+0x12c>
+  805277:	49 89 d6             	mov    %rdx,%r14
+  80527a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805280:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805285:	49 bf f1 26 80 00 00 	movabs $0x8026f1,%r15
+  80528c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80528f:	4c 89 f3             	mov    %r14,%rbx
+  805292:	48 29 f3             	sub    %rsi,%rbx
+  805295:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80529a:	48 39 c3             	cmp    %rax,%rbx
+  80529d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8052a1:	4c 63 eb             	movslq %ebx,%r13
+  8052a4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8052ab:	48 01 c6             	add    %rax,%rsi
+  8052ae:	4c 89 ea             	mov    %r13,%rdx
+  8052b1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8052b8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8052bb:	4c 89 ee             	mov    %r13,%rsi
+  8052be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8052c5:	48 b8 1e 29 80 00 00 	movabs $0x80291e,%rax
+  8052cc:	00 00 00 
+  8052cf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8052d1:	41 01 dc             	add    %ebx,%r12d
+  8052d4:	49 63 f4             	movslq %r12d,%rsi
+  8052d7:	4c 39 f6             	cmp    %r14,%rsi
+  8052da:	72 b3                	jb     80528f <devcons_write+0xca>
+    return res;
+  8052dc:	49 63 c4             	movslq %r12d,%rax
+}
+  8052df:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8052e6:	5b                   	pop    %rbx
+  8052e7:	41 5c                	pop    %r12
+  8052e9:	41 5d                	pop    %r13
+  8052eb:	41 5e                	pop    %r14
+  8052ed:	41 5f                	pop    %r15
+  8052ef:	5d                   	pop    %rbp
+  8052f0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8052f1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8052f7:	eb e3                	jmp    8052dc <devcons_write+0x117>
+
+00000000008052f9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8052f9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8052fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  805301:	48 85 c0             	test   %rax,%rax
+  805304:	74 55                	je     80535b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805306:	55                   	push   %rbp
+  805307:	48 89 e5             	mov    %rsp,%rbp
+  80530a:	41 55                	push   %r13
+  80530c:	41 54                	push   %r12
+  80530e:	53                   	push   %rbx
+  80530f:	48 83 ec 08          	sub    $0x8,%rsp
+  805313:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805316:	48 bb 51 29 80 00 00 	movabs $0x802951,%rbx
+  80531d:	00 00 00 
+  805320:	49 bc 65 2a 80 00 00 	movabs $0x802a65,%r12
+  805327:	00 00 00 
+  80532a:	eb 03                	jmp    80532f <devcons_read+0x36>
+  80532c:	41 ff d4             	call   *%r12
+  80532f:	ff d3                	call   *%rbx
+  805331:	85 c0                	test   %eax,%eax
+  805333:	74 f7                	je     80532c <devcons_read+0x33>
+    if (c < 0) return c;
+  805335:	48 63 d0             	movslq %eax,%rdx
+  805338:	78 13                	js     80534d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80533a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80533f:	83 f8 04             	cmp    $0x4,%eax
+  805342:	74 09                	je     80534d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805344:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805348:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80534d:	48 89 d0             	mov    %rdx,%rax
+  805350:	48 83 c4 08          	add    $0x8,%rsp
+  805354:	5b                   	pop    %rbx
+  805355:	41 5c                	pop    %r12
+  805357:	41 5d                	pop    %r13
+  805359:	5d                   	pop    %rbp
+  80535a:	c3                   	ret
+  80535b:	48 89 d0             	mov    %rdx,%rax
+  80535e:	c3                   	ret
+
+000000000080535f <cputchar>:
+cputchar(int ch) {
+  80535f:	55                   	push   %rbp
+  805360:	48 89 e5             	mov    %rsp,%rbp
+  805363:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805367:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80536b:	be 01 00 00 00       	mov    $0x1,%esi
+  805370:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805374:	48 b8 1e 29 80 00 00 	movabs $0x80291e,%rax
+  80537b:	00 00 00 
+  80537e:	ff d0                	call   *%rax
+}
+  805380:	c9                   	leave
+  805381:	c3                   	ret
+
+0000000000805382 <getchar>:
+getchar(void) {
+  805382:	55                   	push   %rbp
+  805383:	48 89 e5             	mov    %rsp,%rbp
+  805386:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80538a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80538f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805393:	bf 00 00 00 00       	mov    $0x0,%edi
+  805398:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  80539f:	00 00 00 
+  8053a2:	ff d0                	call   *%rax
+  8053a4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8053a6:	85 c0                	test   %eax,%eax
+  8053a8:	78 06                	js     8053b0 <getchar+0x2e>
+  8053aa:	74 08                	je     8053b4 <getchar+0x32>
+  8053ac:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8053b0:	89 d0                	mov    %edx,%eax
+  8053b2:	c9                   	leave
+  8053b3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8053b4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8053b9:	eb f5                	jmp    8053b0 <getchar+0x2e>
+
+00000000008053bb <iscons>:
+iscons(int fdnum) {
+  8053bb:	55                   	push   %rbp
+  8053bc:	48 89 e5             	mov    %rsp,%rbp
+  8053bf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8053c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8053c7:	48 b8 f2 31 80 00 00 	movabs $0x8031f2,%rax
+  8053ce:	00 00 00 
+  8053d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8053d3:	85 c0                	test   %eax,%eax
+  8053d5:	78 18                	js     8053ef <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8053d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053db:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8053e2:	00 00 00 
+  8053e5:	8b 00                	mov    (%rax),%eax
+  8053e7:	39 02                	cmp    %eax,(%rdx)
+  8053e9:	0f 94 c0             	sete   %al
+  8053ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8053ef:	c9                   	leave
+  8053f0:	c3                   	ret
+
+00000000008053f1 <opencons>:
+opencons(void) {
+  8053f1:	55                   	push   %rbp
+  8053f2:	48 89 e5             	mov    %rsp,%rbp
+  8053f5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8053f9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8053fd:	48 b8 92 31 80 00 00 	movabs $0x803192,%rax
+  805404:	00 00 00 
+  805407:	ff d0                	call   *%rax
+  805409:	85 c0                	test   %eax,%eax
+  80540b:	78 49                	js     805456 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80540d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805412:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805417:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80541b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805420:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  805427:	00 00 00 
+  80542a:	ff d0                	call   *%rax
+  80542c:	85 c0                	test   %eax,%eax
+  80542e:	78 26                	js     805456 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805430:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805434:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80543b:	00 00 
+  80543d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80543f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805443:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80544a:	48 b8 64 31 80 00 00 	movabs $0x803164,%rax
+  805451:	00 00 00 
+  805454:	ff d0                	call   *%rax
+}
+  805456:	c9                   	leave
+  805457:	c3                   	ret
+
+0000000000805458 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805458:	55                   	push   %rbp
+  805459:	48 89 e5             	mov    %rsp,%rbp
+  80545c:	41 56                	push   %r14
+  80545e:	41 55                	push   %r13
+  805460:	41 54                	push   %r12
+  805462:	53                   	push   %rbx
+  805463:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805466:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80546d:	00 00 00 
+  805470:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805474:	74 27                	je     80549d <_handle_vectored_pagefault+0x45>
+  805476:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80547b:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805482:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805485:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805488:	4c 89 e7             	mov    %r12,%rdi
+  80548b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805490:	84 c0                	test   %al,%al
+  805492:	75 45                	jne    8054d9 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805494:	48 83 c3 01          	add    $0x1,%rbx
+  805498:	49 3b 1e             	cmp    (%r14),%rbx
+  80549b:	72 eb                	jb     805488 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80549d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8054a4:	00 
+  8054a5:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8054aa:	4d 8b 04 24          	mov    (%r12),%r8
+  8054ae:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  8054b5:	00 00 00 
+  8054b8:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8054bd:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  8054c4:	00 00 00 
+  8054c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054cc:	49 ba 1a 19 80 00 00 	movabs $0x80191a,%r10
+  8054d3:	00 00 00 
+  8054d6:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8054d9:	5b                   	pop    %rbx
+  8054da:	41 5c                	pop    %r12
+  8054dc:	41 5d                	pop    %r13
+  8054de:	41 5e                	pop    %r14
+  8054e0:	5d                   	pop    %rbp
+  8054e1:	c3                   	ret
+
+00000000008054e2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8054e2:	55                   	push   %rbp
+  8054e3:	48 89 e5             	mov    %rsp,%rbp
+  8054e6:	53                   	push   %rbx
+  8054e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8054eb:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8054ee:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8054f3:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8054fa:	00 00 00 
+  8054fd:	80 38 00             	cmpb   $0x0,(%rax)
+  805500:	74 68                	je     80556a <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805502:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805509:	00 00 00 
+  80550c:	48 8b 08             	mov    (%rax),%rcx
+  80550f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805514:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80551b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80551e:	48 85 c9             	test   %rcx,%rcx
+  805521:	0f 84 e0 00 00 00    	je     805607 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805527:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80552b:	0f 84 c9 00 00 00    	je     8055fa <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805531:	48 83 c2 01          	add    $0x1,%rdx
+  805535:	48 39 ca             	cmp    %rcx,%rdx
+  805538:	75 ed                	jne    805527 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80553a:	48 83 f9 08          	cmp    $0x8,%rcx
+  80553e:	0f 84 84 00 00 00    	je     8055c8 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805544:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805548:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80554f:	00 00 00 
+  805552:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805559:	00 00 00 
+  80555c:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805560:	85 f6                	test   %esi,%esi
+  805562:	0f 89 97 00 00 00    	jns    8055ff <add_pgfault_handler+0x11d>
+  805568:	eb 63                	jmp    8055cd <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80556a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80556f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805574:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80557b:	00 00 00 
+  80557e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805583:	48 b8 06 2b 80 00 00 	movabs $0x802b06,%rax
+  80558a:	00 00 00 
+  80558d:	ff d0                	call   *%rax
+  80558f:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805591:	85 c0                	test   %eax,%eax
+  805593:	78 38                	js     8055cd <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805595:	48 be e3 56 80 00 00 	movabs $0x8056e3,%rsi
+  80559c:	00 00 00 
+  80559f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055a4:	48 b8 29 2d 80 00 00 	movabs $0x802d29,%rax
+  8055ab:	00 00 00 
+  8055ae:	ff d0                	call   *%rax
+  8055b0:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8055b2:	85 c0                	test   %eax,%eax
+  8055b4:	78 17                	js     8055cd <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8055b6:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055bd:	00 00 00 
+  8055c0:	c6 00 01             	movb   $0x1,(%rax)
+  8055c3:	e9 3a ff ff ff       	jmp    805502 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8055c8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055cd:	89 f1                	mov    %esi,%ecx
+  8055cf:	48 ba c6 66 80 00 00 	movabs $0x8066c6,%rdx
+  8055d6:	00 00 00 
+  8055d9:	be 42 00 00 00       	mov    $0x42,%esi
+  8055de:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  8055e5:	00 00 00 
+  8055e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ed:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  8055f4:	00 00 00 
+  8055f7:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8055fa:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8055ff:	89 f0                	mov    %esi,%eax
+  805601:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805605:	c9                   	leave
+  805606:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805607:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80560e:	00 00 00 
+  805611:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805618:	48 89 d8             	mov    %rbx,%rax
+  80561b:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805622:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805625:	eb d8                	jmp    8055ff <add_pgfault_handler+0x11d>
+
+0000000000805627 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805627:	55                   	push   %rbp
+  805628:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80562b:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805632:	00 00 00 
+  805635:	80 38 00             	cmpb   $0x0,(%rax)
+  805638:	74 33                	je     80566d <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80563a:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805641:	00 00 00 
+  805644:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805649:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805650:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805653:	48 85 c0             	test   %rax,%rax
+  805656:	0f 84 85 00 00 00    	je     8056e1 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80565c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805660:	74 40                	je     8056a2 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805662:	48 83 c1 01          	add    $0x1,%rcx
+  805666:	48 39 c1             	cmp    %rax,%rcx
+  805669:	75 f1                	jne    80565c <remove_pgfault_handler+0x35>
+  80566b:	eb 74                	jmp    8056e1 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80566d:	48 b9 de 66 80 00 00 	movabs $0x8066de,%rcx
+  805674:	00 00 00 
+  805677:	48 ba 4b 5f 80 00 00 	movabs $0x805f4b,%rdx
+  80567e:	00 00 00 
+  805681:	be 48 00 00 00       	mov    $0x48,%esi
+  805686:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  80568d:	00 00 00 
+  805690:	b8 00 00 00 00       	mov    $0x0,%eax
+  805695:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  80569c:	00 00 00 
+  80569f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8056a2:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8056a9:	00 
+  8056aa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8056ae:	48 29 ca             	sub    %rcx,%rdx
+  8056b1:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056b8:	00 00 00 
+  8056bb:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8056bf:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8056c4:	48 89 ce             	mov    %rcx,%rsi
+  8056c7:	48 b8 f1 26 80 00 00 	movabs $0x8026f1,%rax
+  8056ce:	00 00 00 
+  8056d1:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8056d3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056da:	00 00 00 
+  8056dd:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8056e1:	5d                   	pop    %rbp
+  8056e2:	c3                   	ret
+
+00000000008056e3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8056e3:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8056e6:	48 b8 58 54 80 00 00 	movabs $0x805458,%rax
+  8056ed:	00 00 00 
+    call *%rax
+  8056f0:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8056f2:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8056f9:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8056fa:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805701:	00 
+    subq $8, %rcx
+  805702:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805706:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805709:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805710:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805711:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805715:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805719:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80571e:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805723:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805728:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80572d:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805732:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805737:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80573c:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805741:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805746:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80574b:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805750:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805755:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80575a:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80575f:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805763:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805767:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805768:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805769:	c3                   	ret
+
+000000000080576a <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80576a:	85 ff                	test   %edi,%edi
+  80576c:	78 58                	js     8057c6 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80576e:	48 85 f6             	test   %rsi,%rsi
+  805771:	74 12                	je     805785 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805773:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  80577a:	00 00 00 
+  80577d:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805783:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805785:	48 85 c9             	test   %rcx,%rcx
+  805788:	74 12                	je     80579c <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80578a:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  805791:	00 00 00 
+  805794:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80579a:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80579c:	48 85 d2             	test   %rdx,%rdx
+  80579f:	74 14                	je     8057b5 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8057a1:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8057a8:	00 00 00 
+  8057ab:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8057b2:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8057b5:	48 a1 28 80 80 01 00 	movabs 0x1808028,%rax
+  8057bc:	00 00 00 
+  8057bf:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8057c5:	c3                   	ret
+        if (from_env_store) {
+  8057c6:	48 85 f6             	test   %rsi,%rsi
+  8057c9:	74 06                	je     8057d1 <ipc_result+0x67>
+            *from_env_store = 0;
+  8057cb:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8057d1:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8057d3:	48 85 c9             	test   %rcx,%rcx
+  8057d6:	74 ed                	je     8057c5 <ipc_result+0x5b>
+            *perm_store = 0;
+  8057d8:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8057de:	c3                   	ret
+
+00000000008057df <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8057df:	55                   	push   %rbp
+  8057e0:	48 89 e5             	mov    %rsp,%rbp
+  8057e3:	41 55                	push   %r13
+  8057e5:	41 54                	push   %r12
+  8057e7:	53                   	push   %rbx
+  8057e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8057ec:	49 89 fc             	mov    %rdi,%r12
+  8057ef:	48 89 f7             	mov    %rsi,%rdi
+  8057f2:	48 89 d3             	mov    %rdx,%rbx
+  8057f5:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057f8:	48 85 f6             	test   %rsi,%rsi
+  8057fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805802:	00 00 00 
+  805805:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805809:	be 00 00 00 00       	mov    $0x0,%esi
+  80580e:	48 85 d2             	test   %rdx,%rdx
+  805811:	74 03                	je     805816 <ipc_recv+0x37>
+  805813:	48 8b 32             	mov    (%rdx),%rsi
+  805816:	48 b8 52 30 80 00 00 	movabs $0x803052,%rax
+  80581d:	00 00 00 
+  805820:	ff d0                	call   *%rax
+  805822:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805824:	4c 89 e9             	mov    %r13,%rcx
+  805827:	48 89 da             	mov    %rbx,%rdx
+  80582a:	4c 89 e6             	mov    %r12,%rsi
+  80582d:	48 b8 6a 57 80 00 00 	movabs $0x80576a,%rax
+  805834:	00 00 00 
+  805837:	ff d0                	call   *%rax
+}
+  805839:	48 83 c4 08          	add    $0x8,%rsp
+  80583d:	5b                   	pop    %rbx
+  80583e:	41 5c                	pop    %r12
+  805840:	41 5d                	pop    %r13
+  805842:	5d                   	pop    %rbp
+  805843:	c3                   	ret
+
+0000000000805844 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805844:	55                   	push   %rbp
+  805845:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805848:	48 85 d2             	test   %rdx,%rdx
+  80584b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805852:	00 00 00 
+  805855:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805859:	89 f6                	mov    %esi,%esi
+  80585b:	48 b8 de 2e 80 00 00 	movabs $0x802ede,%rax
+  805862:	00 00 00 
+  805865:	ff d0                	call   *%rax
+    if (res < 0) {
+  805867:	85 c0                	test   %eax,%eax
+  805869:	78 02                	js     80586d <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80586b:	5d                   	pop    %rbp
+  80586c:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80586d:	89 c1                	mov    %eax,%ecx
+  80586f:	48 ba f8 66 80 00 00 	movabs $0x8066f8,%rdx
+  805876:	00 00 00 
+  805879:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80587e:	48 bf 05 67 80 00 00 	movabs $0x806705,%rdi
+  805885:	00 00 00 
+  805888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80588d:	49 b8 1a 19 80 00 00 	movabs $0x80191a,%r8
+  805894:	00 00 00 
+  805897:	41 ff d0             	call   *%r8
+
+000000000080589a <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80589a:	55                   	push   %rbp
+  80589b:	48 89 e5             	mov    %rsp,%rbp
+  80589e:	53                   	push   %rbx
+  80589f:	48 83 ec 08          	sub    $0x8,%rsp
+  8058a3:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058a7:	48 85 d2             	test   %rdx,%rdx
+  8058aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058b1:	00 00 00 
+  8058b4:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8058b8:	4d 85 c9             	test   %r9,%r9
+  8058bb:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8058bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058c4:	48 85 db             	test   %rbx,%rbx
+  8058c7:	74 03                	je     8058cc <ipc_call+0x32>
+  8058c9:	48 8b 03             	mov    (%rbx),%rax
+  8058cc:	89 f6                	mov    %esi,%esi
+  8058ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8058d2:	50                   	push   %rax
+  8058d3:	48 b8 10 2f 80 00 00 	movabs $0x802f10,%rax
+  8058da:	00 00 00 
+  8058dd:	ff d0                	call   *%rax
+  8058df:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8058e1:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8058e5:	48 89 da             	mov    %rbx,%rdx
+  8058e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8058ed:	48 b8 6a 57 80 00 00 	movabs $0x80576a,%rax
+  8058f4:	00 00 00 
+  8058f7:	ff d0                	call   *%rax
+}
+  8058f9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8058fd:	c9                   	leave
+  8058fe:	c3                   	ret
+
+00000000008058ff <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8058ff:	55                   	push   %rbp
+  805900:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805903:	89 f6                	mov    %esi,%esi
+  805905:	48 b8 7c 2f 80 00 00 	movabs $0x802f7c,%rax
+  80590c:	00 00 00 
+  80590f:	ff d0                	call   *%rax
+  805911:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805913:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80591d:	be 00 00 00 00       	mov    $0x0,%esi
+  805922:	48 b8 6a 57 80 00 00 	movabs $0x80576a,%rax
+  805929:	00 00 00 
+  80592c:	ff d0                	call   *%rax
+}
+  80592e:	5d                   	pop    %rbp
+  80592f:	c3                   	ret
+
+0000000000805930 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805930:	55                   	push   %rbp
+  805931:	48 89 e5             	mov    %rsp,%rbp
+  805934:	41 54                	push   %r12
+  805936:	53                   	push   %rbx
+  805937:	4c 89 cb             	mov    %r9,%rbx
+  80593a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80593e:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805942:	48 85 d2             	test   %rdx,%rdx
+  805945:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80594c:	00 00 00 
+  80594f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805953:	4d 85 c9             	test   %r9,%r9
+  805956:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80595a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80595f:	4d 85 e4             	test   %r12,%r12
+  805962:	74 04                	je     805968 <ipc_reply_wait+0x38>
+  805964:	49 8b 04 24          	mov    (%r12),%rax
+  805968:	89 f6                	mov    %esi,%esi
+  80596a:	48 83 ec 08          	sub    $0x8,%rsp
+  80596e:	50                   	push   %rax
+  80596f:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  805976:	00 00 00 
+  805979:	ff d0                	call   *%rax
+  80597b:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80597d:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805981:	4c 89 e2             	mov    %r12,%rdx
+  805984:	48 89 de             	mov    %rbx,%rsi
+  805987:	48 b8 6a 57 80 00 00 	movabs $0x80576a,%rax
+  80598e:	00 00 00 
+  805991:	ff d0                	call   *%rax
+}
+  805993:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805997:	5b                   	pop    %rbx
+  805998:	41 5c                	pop    %r12
+  80599a:	5d                   	pop    %rbp
+  80599b:	c3                   	ret
+
+000000000080599c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80599c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8059a1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8059a8:	00 00 00 
+  8059ab:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8059b2:	48 01 ca             	add    %rcx,%rdx
+  8059b5:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8059bb:	39 fa                	cmp    %edi,%edx
+  8059bd:	74 12                	je     8059d1 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8059bf:	48 83 c0 01          	add    $0x1,%rax
+  8059c3:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8059c9:	75 e0                	jne    8059ab <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8059cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059d0:	c3                   	ret
+            return envs[i].env_id;
+  8059d1:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8059d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8059df:	00 00 00 
+  8059e2:	48 01 d0             	add    %rdx,%rax
+  8059e5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8059eb:	c3                   	ret
+  8059ec:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008059f0 <__rodata_start>:
+  8059f0:	77 00                	ja     8059f2 <__rodata_start+0x2>
+  8059f2:	72 62                	jb     805a56 <__rodata_start+0x66>
+  8059f4:	00 77 62             	add    %dh,0x62(%rdi)
+  8059f7:	00 0f                	add    %cl,(%rdi)
+  8059f9:	1f                   	(bad)
+  8059fa:	84 00                	test   %al,(%rax)
+  8059fc:	00 00                	add    %al,(%rax)
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	b3 09                	mov    $0x9,%bl
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 ed                	add    %ch,%ch
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	8c 0a                	mov    %cs,(%rdx)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	8c 0a                	mov    %cs,(%rdx)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	8c 0a                	mov    %cs,(%rdx)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	8c 0a                	mov    %cs,(%rdx)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	8c 0a                	mov    %cs,(%rdx)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	ed                   	in     (%dx),%eax
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	f4                   	hlt
+  805b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b9f:	00 ed                	add    %ch,%ch
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	2c 0b                	sub    $0xb,%al
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 ed                	add    %ch,%ch
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	ed                   	in     (%dx),%eax
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805bf3:	00 00                	add    %al,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 cb                	add    %cl,%bl
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	ed                   	in     (%dx),%eax
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	6a 0a                	push   $0xa
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 ed                	add    %ch,%ch
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	3c 0a                	cmp    $0xa,%al
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 ed                	add    %ch,%ch
+  805c41:	0d 80 00 00 00       	or     $0x80,%eax
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805c4b:	00 00                	add    %al,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 29                	add    %ch,(%rcx)
+  805c59:	0c 80                	or     $0x80,%al
+  805c5b:	00 00                	add    %al,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 ed                	add    %ch,%ch
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	1a 0b                	sbb    (%rbx),%cl
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 ed                	add    %ch,%ch
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ce                   	(bad)
+  805c81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c87:	00 ed                	add    %ch,%ch
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	f4                   	hlt
+  805c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805c9f:	00 37                	add    %dh,(%rdi)
+  805ca1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 37                	add    %dh,(%rdi)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805ccb:	00 00                	add    %al,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 d2                	add    %dl,%dl
+  805cd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cd7:	00 d2                	add    %dl,%dl
+  805cd9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cdf:	00 d2                	add    %dl,%dl
+  805ce1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ce7:	00 d2                	add    %dl,%dl
+  805ce9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cef:	00 d2                	add    %dl,%dl
+  805cf1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cf7:	00 d2                	add    %dl,%dl
+  805cf9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cff:	00 d2                	add    %dl,%dl
+  805d01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d07:	00 f6                	add    %dh,%dh
+  805d09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d0f:	00 f6                	add    %dh,%dh
+  805d11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 22                	add    %ah,(%rdx)
+  805d51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d57:	00 22                	add    %ah,(%rdx)
+  805d59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d5f:	00 22                	add    %ah,(%rdx)
+  805d61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d67:	00 22                	add    %ah,(%rdx)
+  805d69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d6f:	00 22                	add    %ah,(%rdx)
+  805d71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d77:	00 22                	add    %ah,(%rdx)
+  805d79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 46 12             	add    %al,0x12(%rsi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 22                	add    %ah,(%rdx)
+  805e51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e57:	00 22                	add    %ah,(%rdx)
+  805e59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e5f:	00 22                	add    %ah,(%rdx)
+  805e61:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e67:	00 22                	add    %ah,(%rdx)
+  805e69:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e6f:	00 22                	add    %ah,(%rdx)
+  805e71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e77:	00 22                	add    %ah,(%rdx)
+  805e79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e92:	80 00 00             	addb   $0x0,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ef2:	80 00 00             	addb   $0x0,(%rax)
+  805ef5:	00 00                	add    %al,(%rax)
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 46 12             	add    %al,0x12(%rsi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805f20 <basefix.0>:
+  805f20:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805f30:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805f40:	10 00 72 65 73 20 3e 3d 20 30 00 61 73 73 65 72     ..res >= 0.asser
+  805f50:	74 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 73 00     tion failed: %s.
+  805f60:	75 73 65 72 2f 74 65 73 74 2e 63 00 66 62 20 3d     user/test.c.fb =
+  805f70:	20 25 70 0a 00 6c 6f 72 65 6d 00 25 73 0a 00 3c      %p..lorem.%s..<
+  805f80:	75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 80 00 00 00 00     unknown>........
+  805f90:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805fa0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805fb0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805fc0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805fd0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805fe0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805ff0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806000:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806010:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806020:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806030:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806040:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806050:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806060:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806070:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806080:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806090:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8060a0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8060b0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8060c0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  8060d0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  8060e0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  8060f0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806100:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806110:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806120:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806130:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806140:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  806150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806160:	62 1c 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     b........"......
+  806170:	a9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806180:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806190:	b9 22 80 00 00 00 00 00 81 1c 80 00 00 00 00 00     ."..............
+  8061a0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8061b0:	75 1c 80 00 00 00 00 00 ef 1c 80 00 00 00 00 00     u...............
+  8061c0:	b9 22 80 00 00 00 00 00 75 1c 80 00 00 00 00 00     ."......u.......
+  8061d0:	bb 1c 80 00 00 00 00 00 bb 1c 80 00 00 00 00 00     ................
+  8061e0:	bb 1c 80 00 00 00 00 00 bb 1c 80 00 00 00 00 00     ................
+  8061f0:	bb 1c 80 00 00 00 00 00 bb 1c 80 00 00 00 00 00     ................
+  806200:	bb 1c 80 00 00 00 00 00 bb 1c 80 00 00 00 00 00     ................
+  806210:	bb 1c 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ........."......
+  806220:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806230:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806240:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806250:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806260:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806270:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806280:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806290:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062a0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062b0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062c0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062d0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062e0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8062f0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806300:	b9 22 80 00 00 00 00 00 d7 21 80 00 00 00 00 00     .".......!......
+  806310:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806320:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806330:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806340:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806350:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806360:	1d 1d 80 00 00 00 00 00 ec 1e 80 00 00 00 00 00     ................
+  806370:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  806380:	b9 22 80 00 00 00 00 00 12 1d 80 00 00 00 00 00     ."..............
+  806390:	4c 1d 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     L........"......
+  8063a0:	b9 22 80 00 00 00 00 00 07 1d 80 00 00 00 00 00     ."..............
+  8063b0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8063c0:	95 20 80 00 00 00 00 00 64 21 80 00 00 00 00 00     . ......d!......
+  8063d0:	b9 22 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ."......."......
+  8063e0:	e3 1d 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ........."......
+  8063f0:	c0 1f 80 00 00 00 00 00 b9 22 80 00 00 00 00 00     ........."......
+  806400:	b9 22 80 00 00 00 00 00 d7 21 80 00 00 00 00 00     .".......!......
+  806410:	b9 22 80 00 00 00 00 00 6b 1c 80 00 00 00 00 00     ."......k.......
+
+0000000000806420 <error_string>:
+	...
+  806428:	e5 5f 80 00 00 00 00 00 f7 5f 80 00 00 00 00 00     ._......._......
+  806438:	07 60 80 00 00 00 00 00 19 60 80 00 00 00 00 00     .`.......`......
+  806448:	27 60 80 00 00 00 00 00 3b 60 80 00 00 00 00 00     '`......;`......
+  806458:	50 60 80 00 00 00 00 00 63 60 80 00 00 00 00 00     P`......c`......
+  806468:	75 60 80 00 00 00 00 00 89 60 80 00 00 00 00 00     u`.......`......
+  806478:	99 60 80 00 00 00 00 00 ac 60 80 00 00 00 00 00     .`.......`......
+  806488:	c3 60 80 00 00 00 00 00 d9 60 80 00 00 00 00 00     .`.......`......
+  806498:	f1 60 80 00 00 00 00 00 09 61 80 00 00 00 00 00     .`.......a......
+  8064a8:	16 61 80 00 00 00 00 00 c0 64 80 00 00 00 00 00     .a.......d......
+  8064b8:	2a 61 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     *a......file is 
+  8064c8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8064d8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8064e8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8064f8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806508:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806518:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806528:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806538:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806548:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806558:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806568:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806578:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806588:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806598:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008065a0 <devtab>:
+  8065a0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8065b0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065c0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065d0:	6f 72 64 73 29 00 6c 69 62 2f 66 69 6c 65 2e 63     ords).lib/file.c
+  8065e0:	00 66 64 00 62 75 66 00 72 65 73 20 3c 3d 20 6e     .fd.buf.res <= n
+  8065f0:	00 0f 1f 80 00 00 00 00 72 65 73 20 3c 3d 20 73     ........res <= s
+  806600:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806610:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806620:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806630:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806640:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806650:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806660:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806670:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806680:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806690:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8066a0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8066b0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8066c0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8066d0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8066e0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8066f0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806700:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
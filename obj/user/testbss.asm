@@ -0,0 +1,10374 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 aa 22 80 00 00 	movabs $0x8022aa,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 ea 33 80 00 00 	movabs $0x8033ea,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 ea 33 80 00 00 	movabs $0x8033ea,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 ec 17 80 00 00 	movabs $0x8017ec,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 c0 3d 80 00 00 	movabs $0x803dc0,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 c0 3d 80 00 00 	movabs $0x803dc0,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 dd 16 80 00 00 	movabs $0x8016dd,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 77 5e 80 00 00 	movabs $0x805e77,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d8 57 80 00 00 	movabs $0x8057d8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be da 57 80 00 00 	movabs $0x8057da,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be dd 57 80 00 00 	movabs $0x8057dd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 be 4b 80 00 00 	movabs $0x804bbe,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 95 4e 80 00 00 	movabs $0x804e95,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 d4 34 80 00 00 	movabs $0x8034d4,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 9d 35 80 00 00 	movabs $0x80359d,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 a3 34 80 00 00 	movabs $0x8034a3,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 bb 32 80 00 00 	movabs $0x8032bb,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 ea 33 80 00 00 	movabs $0x8033ea,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb f6 23 80 00 00 	movabs $0x8023f6,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 57 80 00 00 	movabs $0x8057e0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 f6 23 80 00 00 	movabs $0x8023f6,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc f6 23 80 00 00 	movabs $0x8023f6,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 5a 80 00 00 	movabs $0x805a80,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf f6 23 80 00 00 	movabs $0x8023f6,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf f6 23 80 00 00 	movabs $0x8023f6,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 5d 80 00 00 	movabs $0x805d00,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 5d 80 00 00 	movabs $0x805d00,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 4e 26 80 00 00 	movabs $0x80264e,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 35 01 00 00       	call   801634 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  801505:	48 bf 28 5d 80 00 00 	movabs $0x805d28,%rdi
+  80150c:	00 00 00 
+  80150f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801514:	48 ba 50 18 80 00 00 	movabs $0x801850,%rdx
+  80151b:	00 00 00 
+  80151e:	ff d2                	call   *%rdx
+  801520:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  801525:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  80152c:	00 00 00 
+  80152f:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  801533:	0f 85 a5 00 00 00    	jne    8015de <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  801539:	48 83 c1 01          	add    $0x1,%rcx
+  80153d:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  801544:	75 e9                	jne    80152f <umain+0x2e>
+  801546:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80154b:	48 ba 20 80 80 01 00 	movabs $0x1808020,%rdx
+  801552:	00 00 00 
+  801555:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  801558:	48 83 c0 01          	add    $0x1,%rax
+  80155c:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  801562:	75 f1                	jne    801555 <umain+0x54>
+  801564:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  801569:	48 b8 20 80 80 01 00 	movabs $0x1808020,%rax
+  801570:	00 00 00 
+  801573:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  801576:	0f 85 8d 00 00 00    	jne    801609 <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80157c:	48 83 c1 01          	add    $0x1,%rcx
+  801580:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  801587:	75 ea                	jne    801573 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  801589:	48 bf 70 5d 80 00 00 	movabs $0x805d70,%rdi
+  801590:	00 00 00 
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+  801598:	48 ba 50 18 80 00 00 	movabs $0x801850,%rdx
+  80159f:	00 00 00 
+  8015a2:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8015a4:	48 b8 20 80 c0 03 00 	movabs $0x3c08020,%rax
+  8015ab:	00 00 00 
+  8015ae:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8015b4:	48 ba cf 5d 80 00 00 	movabs $0x805dcf,%rdx
+  8015bb:	00 00 00 
+  8015be:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8015c3:	48 bf c0 5d 80 00 00 	movabs $0x805dc0,%rdi
+  8015ca:	00 00 00 
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	48 b9 00 17 80 00 00 	movabs $0x801700,%rcx
+  8015d9:	00 00 00 
+  8015dc:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  8015de:	48 ba a3 5d 80 00 00 	movabs $0x805da3,%rdx
+  8015e5:	00 00 00 
+  8015e8:	be 10 00 00 00       	mov    $0x10,%esi
+  8015ed:	48 bf c0 5d 80 00 00 	movabs $0x805dc0,%rdi
+  8015f4:	00 00 00 
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  801603:	00 00 00 
+  801606:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  801609:	48 ba 48 5d 80 00 00 	movabs $0x805d48,%rdx
+  801610:	00 00 00 
+  801613:	be 15 00 00 00       	mov    $0x15,%esi
+  801618:	48 bf c0 5d 80 00 00 	movabs $0x805dc0,%rdi
+  80161f:	00 00 00 
+  801622:	b8 00 00 00 00       	mov    $0x0,%eax
+  801627:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  80162e:	00 00 00 
+  801631:	41 ff d0             	call   *%r8
+
+0000000000801634 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801634:	55                   	push   %rbp
+  801635:	48 89 e5             	mov    %rsp,%rbp
+  801638:	41 56                	push   %r14
+  80163a:	41 55                	push   %r13
+  80163c:	41 54                	push   %r12
+  80163e:	53                   	push   %rbx
+  80163f:	41 89 fd             	mov    %edi,%r13d
+  801642:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801645:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80164c:	00 00 00 
+  80164f:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801656:	00 00 00 
+  801659:	48 39 c2             	cmp    %rax,%rdx
+  80165c:	73 17                	jae    801675 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80165e:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801661:	49 89 c4             	mov    %rax,%r12
+  801664:	48 83 c3 08          	add    $0x8,%rbx
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	ff 53 f8             	call   *-0x8(%rbx)
+  801670:	4c 39 e3             	cmp    %r12,%rbx
+  801673:	72 ef                	jb     801664 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801675:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  80167c:	00 00 00 
+  80167f:	ff d0                	call   *%rax
+  801681:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801686:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80168d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801694:	00 00 00 
+  801697:	48 01 d0             	add    %rdx,%rax
+  80169a:	48 a3 20 80 c0 01 00 	movabs %rax,0x1c08020
+  8016a1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8016a4:	45 85 ed             	test   %r13d,%r13d
+  8016a7:	7e 0d                	jle    8016b6 <libmain+0x82>
+  8016a9:	49 8b 06             	mov    (%r14),%rax
+  8016ac:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8016b3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8016b6:	4c 89 f6             	mov    %r14,%rsi
+  8016b9:	44 89 ef             	mov    %r13d,%edi
+  8016bc:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8016c3:	00 00 00 
+  8016c6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8016c8:	48 b8 dd 16 80 00 00 	movabs $0x8016dd,%rax
+  8016cf:	00 00 00 
+  8016d2:	ff d0                	call   *%rax
+#endif
+}
+  8016d4:	5b                   	pop    %rbx
+  8016d5:	41 5c                	pop    %r12
+  8016d7:	41 5d                	pop    %r13
+  8016d9:	41 5e                	pop    %r14
+  8016db:	5d                   	pop    %rbp
+  8016dc:	c3                   	ret
+
+00000000008016dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8016dd:	55                   	push   %rbp
+  8016de:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8016e1:	48 b8 70 31 80 00 00 	movabs $0x803170,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8016ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016f2:	48 b8 a3 27 80 00 00 	movabs $0x8027a3,%rax
+  8016f9:	00 00 00 
+  8016fc:	ff d0                	call   *%rax
+}
+  8016fe:	5d                   	pop    %rbp
+  8016ff:	c3                   	ret
+
+0000000000801700 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	41 56                	push   %r14
+  801706:	41 55                	push   %r13
+  801708:	41 54                	push   %r12
+  80170a:	53                   	push   %rbx
+  80170b:	48 83 ec 50          	sub    $0x50,%rsp
+  80170f:	49 89 fc             	mov    %rdi,%r12
+  801712:	41 89 f5             	mov    %esi,%r13d
+  801715:	48 89 d3             	mov    %rdx,%rbx
+  801718:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80171c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801720:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801724:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80172b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80172f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801733:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801737:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80173b:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801742:	00 00 00 
+  801745:	4c 8b 30             	mov    (%rax),%r14
+  801748:	48 b8 14 28 80 00 00 	movabs $0x802814,%rax
+  80174f:	00 00 00 
+  801752:	ff d0                	call   *%rax
+  801754:	89 c6                	mov    %eax,%esi
+  801756:	45 89 e8             	mov    %r13d,%r8d
+  801759:	4c 89 e1             	mov    %r12,%rcx
+  80175c:	4c 89 f2             	mov    %r14,%rdx
+  80175f:	48 bf f0 5d 80 00 00 	movabs $0x805df0,%rdi
+  801766:	00 00 00 
+  801769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176e:	49 bc 50 18 80 00 00 	movabs $0x801850,%r12
+  801775:	00 00 00 
+  801778:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80177b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80177f:	48 89 df             	mov    %rbx,%rdi
+  801782:	48 b8 ec 17 80 00 00 	movabs $0x8017ec,%rax
+  801789:	00 00 00 
+  80178c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80178e:	48 bf be 5d 80 00 00 	movabs $0x805dbe,%rdi
+  801795:	00 00 00 
+  801798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8017a0:	cc                   	int3
+  8017a1:	eb fd                	jmp    8017a0 <_panic+0xa0>
+
+00000000008017a3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8017a3:	55                   	push   %rbp
+  8017a4:	48 89 e5             	mov    %rsp,%rbp
+  8017a7:	53                   	push   %rbx
+  8017a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ac:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8017af:	8b 06                	mov    (%rsi),%eax
+  8017b1:	8d 50 01             	lea    0x1(%rax),%edx
+  8017b4:	89 16                	mov    %edx,(%rsi)
+  8017b6:	48 98                	cltq
+  8017b8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8017bd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8017c3:	74 0a                	je     8017cf <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8017c5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8017c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8017cd:	c9                   	leave
+  8017ce:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8017cf:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8017d3:	be ff 00 00 00       	mov    $0xff,%esi
+  8017d8:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8017df:	00 00 00 
+  8017e2:	ff d0                	call   *%rax
+        state->offset = 0;
+  8017e4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8017ea:	eb d9                	jmp    8017c5 <putch+0x22>
+
+00000000008017ec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8017ec:	55                   	push   %rbp
+  8017ed:	48 89 e5             	mov    %rsp,%rbp
+  8017f0:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8017f7:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8017fa:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801801:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80180e:	48 89 f1             	mov    %rsi,%rcx
+  801811:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801818:	48 bf a3 17 80 00 00 	movabs $0x8017a3,%rdi
+  80181f:	00 00 00 
+  801822:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  801829:	00 00 00 
+  80182c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80182e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801835:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80183c:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801848:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+
+0000000000801850 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801850:	55                   	push   %rbp
+  801851:	48 89 e5             	mov    %rsp,%rbp
+  801854:	48 83 ec 50          	sub    $0x50,%rsp
+  801858:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80185c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801860:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801864:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801868:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80186c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801873:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80187b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80187f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801883:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801887:	48 b8 ec 17 80 00 00 	movabs $0x8017ec,%rax
+  80188e:	00 00 00 
+  801891:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801893:	c9                   	leave
+  801894:	c3                   	ret
+
+0000000000801895 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801895:	55                   	push   %rbp
+  801896:	48 89 e5             	mov    %rsp,%rbp
+  801899:	41 57                	push   %r15
+  80189b:	41 56                	push   %r14
+  80189d:	41 55                	push   %r13
+  80189f:	41 54                	push   %r12
+  8018a1:	53                   	push   %rbx
+  8018a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8018a6:	49 89 fc             	mov    %rdi,%r12
+  8018a9:	49 89 f5             	mov    %rsi,%r13
+  8018ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018b0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8018b3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8018b6:	41 89 cf             	mov    %ecx,%r15d
+  8018b9:	4c 39 fa             	cmp    %r15,%rdx
+  8018bc:	73 5b                	jae    801919 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8018be:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8018c2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8018c6:	85 db                	test   %ebx,%ebx
+  8018c8:	7e 0e                	jle    8018d8 <print_num+0x43>
+            putch(padc, put_arg);
+  8018ca:	4c 89 ee             	mov    %r13,%rsi
+  8018cd:	44 89 f7             	mov    %r14d,%edi
+  8018d0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8018d3:	83 eb 01             	sub    $0x1,%ebx
+  8018d6:	75 f2                	jne    8018ca <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8018d8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8018dc:	48 b9 24 5e 80 00 00 	movabs $0x805e24,%rcx
+  8018e3:	00 00 00 
+  8018e6:	48 b8 13 5e 80 00 00 	movabs $0x805e13,%rax
+  8018ed:	00 00 00 
+  8018f0:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8018f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fd:	49 f7 f7             	div    %r15
+  801900:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801904:	4c 89 ee             	mov    %r13,%rsi
+  801907:	41 ff d4             	call   *%r12
+}
+  80190a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80190e:	5b                   	pop    %rbx
+  80190f:	41 5c                	pop    %r12
+  801911:	41 5d                	pop    %r13
+  801913:	41 5e                	pop    %r14
+  801915:	41 5f                	pop    %r15
+  801917:	5d                   	pop    %rbp
+  801918:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801919:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80191d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801922:	49 f7 f7             	div    %r15
+  801925:	48 83 ec 08          	sub    $0x8,%rsp
+  801929:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80192d:	52                   	push   %rdx
+  80192e:	45 0f be c9          	movsbl %r9b,%r9d
+  801932:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801936:	48 89 c2             	mov    %rax,%rdx
+  801939:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801940:	00 00 00 
+  801943:	ff d0                	call   *%rax
+  801945:	48 83 c4 10          	add    $0x10,%rsp
+  801949:	eb 8d                	jmp    8018d8 <print_num+0x43>
+
+000000000080194b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80194b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80194f:	48 8b 06             	mov    (%rsi),%rax
+  801952:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801956:	73 0a                	jae    801962 <sprintputch+0x17>
+        *state->start++ = ch;
+  801958:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80195c:	48 89 16             	mov    %rdx,(%rsi)
+  80195f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801962:	c3                   	ret
+
+0000000000801963 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801963:	55                   	push   %rbp
+  801964:	48 89 e5             	mov    %rsp,%rbp
+  801967:	48 83 ec 50          	sub    $0x50,%rsp
+  80196b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80196f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801973:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801977:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80197e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801982:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801986:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80198a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80198e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801992:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  801999:	00 00 00 
+  80199c:	ff d0                	call   *%rax
+}
+  80199e:	c9                   	leave
+  80199f:	c3                   	ret
+
+00000000008019a0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8019a0:	55                   	push   %rbp
+  8019a1:	48 89 e5             	mov    %rsp,%rbp
+  8019a4:	41 57                	push   %r15
+  8019a6:	41 56                	push   %r14
+  8019a8:	41 55                	push   %r13
+  8019aa:	41 54                	push   %r12
+  8019ac:	53                   	push   %rbx
+  8019ad:	48 83 ec 38          	sub    $0x38,%rsp
+  8019b1:	49 89 fe             	mov    %rdi,%r14
+  8019b4:	49 89 f5             	mov    %rsi,%r13
+  8019b7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8019ba:	48 8b 01             	mov    (%rcx),%rax
+  8019bd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8019c1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8019c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019c9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8019cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8019d1:	eb 0d                	jmp    8019e0 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8019d3:	40 0f b6 ff          	movzbl %dil,%edi
+  8019d7:	4c 89 ee             	mov    %r13,%rsi
+  8019da:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8019dd:	4c 89 e3             	mov    %r12,%rbx
+  8019e0:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8019e4:	0f b6 3b             	movzbl (%rbx),%edi
+  8019e7:	40 80 ff 25          	cmp    $0x25,%dil
+  8019eb:	74 14                	je     801a01 <vprintfmt+0x61>
+            if (!ch) return;
+  8019ed:	40 84 ff             	test   %dil,%dil
+  8019f0:	75 e1                	jne    8019d3 <vprintfmt+0x33>
+}
+  8019f2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8019f6:	5b                   	pop    %rbx
+  8019f7:	41 5c                	pop    %r12
+  8019f9:	41 5d                	pop    %r13
+  8019fb:	41 5e                	pop    %r14
+  8019fd:	41 5f                	pop    %r15
+  8019ff:	5d                   	pop    %rbp
+  801a00:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801a01:	be 00 00 00 00       	mov    $0x0,%esi
+  801a06:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801a0a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801a0f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a15:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801a1c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a20:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801a25:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801a2a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801a2d:	83 e8 23             	sub    $0x23,%eax
+  801a30:	3c 57                	cmp    $0x57,%al
+  801a32:	0f 87 67 06 00 00    	ja     80209f <vprintfmt+0x6ff>
+  801a38:	0f b6 c0             	movzbl %al,%eax
+  801a3b:	48 b9 c0 5f 80 00 00 	movabs $0x805fc0,%rcx
+  801a42:	00 00 00 
+  801a45:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801a48:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801a4b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801a4f:	eb cf                	jmp    801a20 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801a51:	49 89 dc             	mov    %rbx,%r12
+  801a54:	be 01 00 00 00       	mov    $0x1,%esi
+  801a59:	eb c5                	jmp    801a20 <vprintfmt+0x80>
+            padc = ch;
+  801a5b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801a5f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801a62:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801a65:	eb b9                	jmp    801a20 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a6a:	83 f8 2f             	cmp    $0x2f,%eax
+  801a6d:	77 24                	ja     801a93 <vprintfmt+0xf3>
+  801a6f:	89 c1                	mov    %eax,%ecx
+  801a71:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801a75:	83 c0 08             	add    $0x8,%eax
+  801a78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a7b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801a7e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801a81:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801a85:	79 99                	jns    801a20 <vprintfmt+0x80>
+                width = precision;
+  801a87:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801a8b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801a91:	eb 8d                	jmp    801a20 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801a93:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a97:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a9f:	eb da                	jmp    801a7b <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801aa1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801aa6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801aaa:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ab0:	3c 39                	cmp    $0x39,%al
+  801ab2:	77 1c                	ja     801ad0 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801ab4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801ab8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801abc:	0f b6 c0             	movzbl %al,%eax
+  801abf:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801ac4:	0f b6 03             	movzbl (%rbx),%eax
+  801ac7:	3c 39                	cmp    $0x39,%al
+  801ac9:	76 e9                	jbe    801ab4 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801acb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801ace:	eb b1                	jmp    801a81 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801ad0:	49 89 dc             	mov    %rbx,%r12
+  801ad3:	eb ac                	jmp    801a81 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801ad5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ad8:	85 c9                	test   %ecx,%ecx
+  801ada:	b8 00 00 00 00       	mov    $0x0,%eax
+  801adf:	0f 49 c1             	cmovns %ecx,%eax
+  801ae2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801ae5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ae8:	e9 33 ff ff ff       	jmp    801a20 <vprintfmt+0x80>
+            lflag++;
+  801aed:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801af0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801af3:	e9 28 ff ff ff       	jmp    801a20 <vprintfmt+0x80>
+            lflag--;
+  801af8:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801afb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801afe:	e9 1d ff ff ff       	jmp    801a20 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801b03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b06:	83 f8 2f             	cmp    $0x2f,%eax
+  801b09:	77 19                	ja     801b24 <vprintfmt+0x184>
+  801b0b:	89 c2                	mov    %eax,%edx
+  801b0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b11:	83 c0 08             	add    $0x8,%eax
+  801b14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b17:	8b 3a                	mov    (%rdx),%edi
+  801b19:	4c 89 ee             	mov    %r13,%rsi
+  801b1c:	41 ff d6             	call   *%r14
+            break;
+  801b1f:	e9 bc fe ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801b24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b30:	eb e5                	jmp    801b17 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801b32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b35:	83 f8 2f             	cmp    $0x2f,%eax
+  801b38:	77 5a                	ja     801b94 <vprintfmt+0x1f4>
+  801b3a:	89 c2                	mov    %eax,%edx
+  801b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801b40:	83 c0 08             	add    $0x8,%eax
+  801b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801b46:	8b 02                	mov    (%rdx),%eax
+  801b48:	89 c1                	mov    %eax,%ecx
+  801b4a:	f7 d9                	neg    %ecx
+  801b4c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801b4f:	83 f9 13             	cmp    $0x13,%ecx
+  801b52:	7f 4e                	jg     801ba2 <vprintfmt+0x202>
+  801b54:	48 63 c1             	movslq %ecx,%rax
+  801b57:	48 ba 80 62 80 00 00 	movabs $0x806280,%rdx
+  801b5e:	00 00 00 
+  801b61:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801b65:	48 85 c0             	test   %rax,%rax
+  801b68:	74 38                	je     801ba2 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801b6a:	48 89 c1             	mov    %rax,%rcx
+  801b6d:	48 ba 48 64 80 00 00 	movabs $0x806448,%rdx
+  801b74:	00 00 00 
+  801b77:	4c 89 ee             	mov    %r13,%rsi
+  801b7a:	4c 89 f7             	mov    %r14,%rdi
+  801b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b82:	49 b8 63 19 80 00 00 	movabs $0x801963,%r8
+  801b89:	00 00 00 
+  801b8c:	41 ff d0             	call   *%r8
+  801b8f:	e9 4c fe ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801b94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ba0:	eb a4                	jmp    801b46 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801ba2:	48 ba 3c 5e 80 00 00 	movabs $0x805e3c,%rdx
+  801ba9:	00 00 00 
+  801bac:	4c 89 ee             	mov    %r13,%rsi
+  801baf:	4c 89 f7             	mov    %r14,%rdi
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb7:	49 b8 63 19 80 00 00 	movabs $0x801963,%r8
+  801bbe:	00 00 00 
+  801bc1:	41 ff d0             	call   *%r8
+  801bc4:	e9 17 fe ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801bc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bcc:	83 f8 2f             	cmp    $0x2f,%eax
+  801bcf:	77 6c                	ja     801c3d <vprintfmt+0x29d>
+  801bd1:	89 c2                	mov    %eax,%edx
+  801bd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bd7:	83 c0 08             	add    $0x8,%eax
+  801bda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bdd:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801be0:	48 85 f6             	test   %rsi,%rsi
+  801be3:	48 b8 35 5e 80 00 00 	movabs $0x805e35,%rax
+  801bea:	00 00 00 
+  801bed:	48 0f 45 c6          	cmovne %rsi,%rax
+  801bf1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801bf5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801bf9:	7e 06                	jle    801c01 <vprintfmt+0x261>
+  801bfb:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801bff:	75 4a                	jne    801c4b <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c01:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801c05:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801c09:	0f b6 00             	movzbl (%rax),%eax
+  801c0c:	84 c0                	test   %al,%al
+  801c0e:	0f 85 9a 00 00 00    	jne    801cae <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801c14:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c17:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801c1b:	85 c0                	test   %eax,%eax
+  801c1d:	0f 8e bd fd ff ff    	jle    8019e0 <vprintfmt+0x40>
+  801c23:	4c 89 ee             	mov    %r13,%rsi
+  801c26:	bf 20 00 00 00       	mov    $0x20,%edi
+  801c2b:	41 ff d6             	call   *%r14
+  801c2e:	41 83 ec 01          	sub    $0x1,%r12d
+  801c32:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801c36:	75 eb                	jne    801c23 <vprintfmt+0x283>
+  801c38:	e9 a3 fd ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801c3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c49:	eb 92                	jmp    801bdd <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801c4b:	49 63 f7             	movslq %r15d,%rsi
+  801c4e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801c52:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+  801c5e:	48 89 c2             	mov    %rax,%rdx
+  801c61:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c64:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801c66:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801c69:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	7e 91                	jle    801c01 <vprintfmt+0x261>
+  801c70:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801c75:	4c 89 ee             	mov    %r13,%rsi
+  801c78:	44 89 e7             	mov    %r12d,%edi
+  801c7b:	41 ff d6             	call   *%r14
+  801c7e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c82:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801c85:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801c88:	75 eb                	jne    801c75 <vprintfmt+0x2d5>
+  801c8a:	e9 72 ff ff ff       	jmp    801c01 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801c8f:	0f b6 f8             	movzbl %al,%edi
+  801c92:	4c 89 ee             	mov    %r13,%rsi
+  801c95:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801c98:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801c9c:	49 83 c4 01          	add    $0x1,%r12
+  801ca0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ca6:	84 c0                	test   %al,%al
+  801ca8:	0f 84 66 ff ff ff    	je     801c14 <vprintfmt+0x274>
+  801cae:	45 85 ff             	test   %r15d,%r15d
+  801cb1:	78 0a                	js     801cbd <vprintfmt+0x31d>
+  801cb3:	41 83 ef 01          	sub    $0x1,%r15d
+  801cb7:	0f 88 57 ff ff ff    	js     801c14 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801cbd:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801cc1:	74 cc                	je     801c8f <vprintfmt+0x2ef>
+  801cc3:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801cc6:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ccb:	80 fa 5e             	cmp    $0x5e,%dl
+  801cce:	77 c2                	ja     801c92 <vprintfmt+0x2f2>
+  801cd0:	eb bd                	jmp    801c8f <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801cd2:	40 84 f6             	test   %sil,%sil
+  801cd5:	75 26                	jne    801cfd <vprintfmt+0x35d>
+    switch (lflag) {
+  801cd7:	85 d2                	test   %edx,%edx
+  801cd9:	74 59                	je     801d34 <vprintfmt+0x394>
+  801cdb:	83 fa 01             	cmp    $0x1,%edx
+  801cde:	74 7b                	je     801d5b <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801ce0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ce3:	83 f8 2f             	cmp    $0x2f,%eax
+  801ce6:	0f 87 96 00 00 00    	ja     801d82 <vprintfmt+0x3e2>
+  801cec:	89 c2                	mov    %eax,%edx
+  801cee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf2:	83 c0 08             	add    $0x8,%eax
+  801cf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cf8:	4c 8b 22             	mov    (%rdx),%r12
+  801cfb:	eb 17                	jmp    801d14 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801cfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d00:	83 f8 2f             	cmp    $0x2f,%eax
+  801d03:	77 21                	ja     801d26 <vprintfmt+0x386>
+  801d05:	89 c2                	mov    %eax,%edx
+  801d07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d0b:	83 c0 08             	add    $0x8,%eax
+  801d0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d11:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801d14:	4d 85 e4             	test   %r12,%r12
+  801d17:	78 7a                	js     801d93 <vprintfmt+0x3f3>
+            num = i;
+  801d19:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801d1c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801d21:	e9 56 02 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d32:	eb dd                	jmp    801d11 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801d34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d37:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3a:	77 11                	ja     801d4d <vprintfmt+0x3ad>
+  801d3c:	89 c2                	mov    %eax,%edx
+  801d3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d42:	83 c0 08             	add    $0x8,%eax
+  801d45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d48:	4c 63 22             	movslq (%rdx),%r12
+  801d4b:	eb c7                	jmp    801d14 <vprintfmt+0x374>
+  801d4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d59:	eb ed                	jmp    801d48 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801d5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801d61:	77 11                	ja     801d74 <vprintfmt+0x3d4>
+  801d63:	89 c2                	mov    %eax,%edx
+  801d65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d69:	83 c0 08             	add    $0x8,%eax
+  801d6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d6f:	4c 8b 22             	mov    (%rdx),%r12
+  801d72:	eb a0                	jmp    801d14 <vprintfmt+0x374>
+  801d74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d80:	eb ed                	jmp    801d6f <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d8e:	e9 65 ff ff ff       	jmp    801cf8 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801d93:	4c 89 ee             	mov    %r13,%rsi
+  801d96:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801d9b:	41 ff d6             	call   *%r14
+                i = -i;
+  801d9e:	49 f7 dc             	neg    %r12
+  801da1:	e9 73 ff ff ff       	jmp    801d19 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801da6:	40 84 f6             	test   %sil,%sil
+  801da9:	75 2e                	jne    801dd9 <vprintfmt+0x439>
+    switch (lflag) {
+  801dab:	85 d2                	test   %edx,%edx
+  801dad:	7f 59                	jg     801e08 <vprintfmt+0x468>
+  801daf:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801db2:	7d 7a                	jge    801e2e <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801db4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801db7:	83 f8 2f             	cmp    $0x2f,%eax
+  801dba:	0f 87 aa 00 00 00    	ja     801e6a <vprintfmt+0x4ca>
+  801dc0:	89 c2                	mov    %eax,%edx
+  801dc2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dc6:	83 c0 08             	add    $0x8,%eax
+  801dc9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dcc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801dcf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801dd4:	e9 a3 01 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801dd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ddc:	83 f8 2f             	cmp    $0x2f,%eax
+  801ddf:	77 19                	ja     801dfa <vprintfmt+0x45a>
+  801de1:	89 c2                	mov    %eax,%edx
+  801de3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801de7:	83 c0 08             	add    $0x8,%eax
+  801dea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ded:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801df0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801df5:	e9 82 01 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+  801dfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e06:	eb e5                	jmp    801ded <vprintfmt+0x44d>
+    switch (lflag) {
+  801e08:	83 fa 01             	cmp    $0x1,%edx
+  801e0b:	75 a7                	jne    801db4 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801e0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e10:	83 f8 2f             	cmp    $0x2f,%eax
+  801e13:	77 47                	ja     801e5c <vprintfmt+0x4bc>
+  801e15:	89 c2                	mov    %eax,%edx
+  801e17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e1b:	83 c0 08             	add    $0x8,%eax
+  801e1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e21:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801e24:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801e29:	e9 4e 01 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801e2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e31:	83 f8 2f             	cmp    $0x2f,%eax
+  801e34:	77 18                	ja     801e4e <vprintfmt+0x4ae>
+  801e36:	89 c2                	mov    %eax,%edx
+  801e38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e3c:	83 c0 08             	add    $0x8,%eax
+  801e3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e42:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801e44:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801e49:	e9 2e 01 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+  801e4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e5a:	eb e6                	jmp    801e42 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801e5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e68:	eb b7                	jmp    801e21 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801e6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e76:	e9 51 ff ff ff       	jmp    801dcc <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801e7b:	40 84 f6             	test   %sil,%sil
+  801e7e:	75 2e                	jne    801eae <vprintfmt+0x50e>
+    switch (lflag) {
+  801e80:	85 d2                	test   %edx,%edx
+  801e82:	7f 59                	jg     801edd <vprintfmt+0x53d>
+  801e84:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801e87:	7d 77                	jge    801f00 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801e89:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e8c:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8f:	0f 87 a4 00 00 00    	ja     801f39 <vprintfmt+0x599>
+  801e95:	89 c2                	mov    %eax,%edx
+  801e97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e9b:	83 c0 08             	add    $0x8,%eax
+  801e9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ea1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ea4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ea9:	e9 ce 00 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801eae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eb1:	83 f8 2f             	cmp    $0x2f,%eax
+  801eb4:	77 19                	ja     801ecf <vprintfmt+0x52f>
+  801eb6:	89 c2                	mov    %eax,%edx
+  801eb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ebc:	83 c0 08             	add    $0x8,%eax
+  801ebf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ec2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ec5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801eca:	e9 ad 00 00 00       	jmp    801f7c <vprintfmt+0x5dc>
+  801ecf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801edb:	eb e5                	jmp    801ec2 <vprintfmt+0x522>
+    switch (lflag) {
+  801edd:	83 fa 01             	cmp    $0x1,%edx
+  801ee0:	75 a7                	jne    801e89 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801ee2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee8:	77 41                	ja     801f2b <vprintfmt+0x58b>
+  801eea:	89 c2                	mov    %eax,%edx
+  801eec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef0:	83 c0 08             	add    $0x8,%eax
+  801ef3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801ef9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801efe:	eb 7c                	jmp    801f7c <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f03:	83 f8 2f             	cmp    $0x2f,%eax
+  801f06:	77 15                	ja     801f1d <vprintfmt+0x57d>
+  801f08:	89 c2                	mov    %eax,%edx
+  801f0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f0e:	83 c0 08             	add    $0x8,%eax
+  801f11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f14:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801f16:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801f1b:	eb 5f                	jmp    801f7c <vprintfmt+0x5dc>
+  801f1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f29:	eb e9                	jmp    801f14 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801f2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f37:	eb bd                	jmp    801ef6 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801f39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f45:	e9 57 ff ff ff       	jmp    801ea1 <vprintfmt+0x501>
+            putch('0', put_arg);
+  801f4a:	4c 89 ee             	mov    %r13,%rsi
+  801f4d:	bf 30 00 00 00       	mov    $0x30,%edi
+  801f52:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801f55:	4c 89 ee             	mov    %r13,%rsi
+  801f58:	bf 78 00 00 00       	mov    $0x78,%edi
+  801f5d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801f60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f63:	83 f8 2f             	cmp    $0x2f,%eax
+  801f66:	77 47                	ja     801faf <vprintfmt+0x60f>
+  801f68:	89 c2                	mov    %eax,%edx
+  801f6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6e:	83 c0 08             	add    $0x8,%eax
+  801f71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f74:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f77:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801f7c:	48 83 ec 08          	sub    $0x8,%rsp
+  801f80:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801f84:	0f 94 c0             	sete   %al
+  801f87:	0f b6 c0             	movzbl %al,%eax
+  801f8a:	50                   	push   %rax
+  801f8b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801f90:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801f94:	4c 89 ee             	mov    %r13,%rsi
+  801f97:	4c 89 f7             	mov    %r14,%rdi
+  801f9a:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801fa1:	00 00 00 
+  801fa4:	ff d0                	call   *%rax
+            break;
+  801fa6:	48 83 c4 10          	add    $0x10,%rsp
+  801faa:	e9 31 fa ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801faf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fbb:	eb b7                	jmp    801f74 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801fbd:	40 84 f6             	test   %sil,%sil
+  801fc0:	75 2b                	jne    801fed <vprintfmt+0x64d>
+    switch (lflag) {
+  801fc2:	85 d2                	test   %edx,%edx
+  801fc4:	7f 56                	jg     80201c <vprintfmt+0x67c>
+  801fc6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fc9:	7d 77                	jge    802042 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801fcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fce:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd1:	0f 87 a7 00 00 00    	ja     80207e <vprintfmt+0x6de>
+  801fd7:	89 c2                	mov    %eax,%edx
+  801fd9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fdd:	83 c0 08             	add    $0x8,%eax
+  801fe0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801fe6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801feb:	eb 8f                	jmp    801f7c <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ff0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ff3:	77 19                	ja     80200e <vprintfmt+0x66e>
+  801ff5:	89 c2                	mov    %eax,%edx
+  801ff7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ffb:	83 c0 08             	add    $0x8,%eax
+  801ffe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802001:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802004:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802009:	e9 6e ff ff ff       	jmp    801f7c <vprintfmt+0x5dc>
+  80200e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802012:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802016:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80201a:	eb e5                	jmp    802001 <vprintfmt+0x661>
+    switch (lflag) {
+  80201c:	83 fa 01             	cmp    $0x1,%edx
+  80201f:	75 aa                	jne    801fcb <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802021:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802024:	83 f8 2f             	cmp    $0x2f,%eax
+  802027:	77 47                	ja     802070 <vprintfmt+0x6d0>
+  802029:	89 c2                	mov    %eax,%edx
+  80202b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80202f:	83 c0 08             	add    $0x8,%eax
+  802032:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802035:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802038:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80203d:	e9 3a ff ff ff       	jmp    801f7c <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802042:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802045:	83 f8 2f             	cmp    $0x2f,%eax
+  802048:	77 18                	ja     802062 <vprintfmt+0x6c2>
+  80204a:	89 c2                	mov    %eax,%edx
+  80204c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802050:	83 c0 08             	add    $0x8,%eax
+  802053:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802056:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802058:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80205d:	e9 1a ff ff ff       	jmp    801f7c <vprintfmt+0x5dc>
+  802062:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802066:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80206a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206e:	eb e6                	jmp    802056 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802070:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802074:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802078:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80207c:	eb b7                	jmp    802035 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80207e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802082:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802086:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80208a:	e9 54 ff ff ff       	jmp    801fe3 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80208f:	4c 89 ee             	mov    %r13,%rsi
+  802092:	bf 25 00 00 00       	mov    $0x25,%edi
+  802097:	41 ff d6             	call   *%r14
+            break;
+  80209a:	e9 41 f9 ff ff       	jmp    8019e0 <vprintfmt+0x40>
+            putch('%', put_arg);
+  80209f:	4c 89 ee             	mov    %r13,%rsi
+  8020a2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8020a7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8020aa:	48 83 eb 01          	sub    $0x1,%rbx
+  8020ae:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8020b2:	75 f6                	jne    8020aa <vprintfmt+0x70a>
+  8020b4:	e9 27 f9 ff ff       	jmp    8019e0 <vprintfmt+0x40>
+
+00000000008020b9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8020b9:	55                   	push   %rbp
+  8020ba:	48 89 e5             	mov    %rsp,%rbp
+  8020bd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8020c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020c5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8020ca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8020ce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8020d5:	48 85 ff             	test   %rdi,%rdi
+  8020d8:	74 2b                	je     802105 <vsnprintf+0x4c>
+  8020da:	48 85 f6             	test   %rsi,%rsi
+  8020dd:	74 26                	je     802105 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8020df:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020e3:	48 bf 4b 19 80 00 00 	movabs $0x80194b,%rdi
+  8020ea:	00 00 00 
+  8020ed:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8020f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020fd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802100:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802103:	c9                   	leave
+  802104:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802105:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80210a:	eb f7                	jmp    802103 <vsnprintf+0x4a>
+
+000000000080210c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80210c:	55                   	push   %rbp
+  80210d:	48 89 e5             	mov    %rsp,%rbp
+  802110:	48 83 ec 50          	sub    $0x50,%rsp
+  802114:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802118:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80211c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802120:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802127:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80212b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802133:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802137:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80213b:	48 b8 b9 20 80 00 00 	movabs $0x8020b9,%rax
+  802142:	00 00 00 
+  802145:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802147:	c9                   	leave
+  802148:	c3                   	ret
+
+0000000000802149 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802149:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80214c:	74 10                	je     80215e <strlen+0x15>
+    size_t n = 0;
+  80214e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802153:	48 83 c0 01          	add    $0x1,%rax
+  802157:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80215b:	75 f6                	jne    802153 <strlen+0xa>
+  80215d:	c3                   	ret
+    size_t n = 0;
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802163:	c3                   	ret
+
+0000000000802164 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802164:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80216c:	48 85 f6             	test   %rsi,%rsi
+  80216f:	74 11                	je     802182 <strnlen+0x1e>
+  802171:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802175:	74 0c                	je     802183 <strnlen+0x1f>
+  802177:	48 83 c2 01          	add    $0x1,%rdx
+  80217b:	48 39 d0             	cmp    %rdx,%rax
+  80217e:	75 f1                	jne    802171 <strnlen+0xd>
+  802180:	eb 04                	jmp    802186 <strnlen+0x22>
+  802182:	c3                   	ret
+  802183:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802186:	c3                   	ret
+
+0000000000802187 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802187:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80218a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802193:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802196:	48 83 c2 01          	add    $0x1,%rdx
+  80219a:	84 c9                	test   %cl,%cl
+  80219c:	75 f1                	jne    80218f <strcpy+0x8>
+        ;
+    return res;
+}
+  80219e:	c3                   	ret
+
+000000000080219f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80219f:	55                   	push   %rbp
+  8021a0:	48 89 e5             	mov    %rsp,%rbp
+  8021a3:	41 54                	push   %r12
+  8021a5:	53                   	push   %rbx
+  8021a6:	48 89 fb             	mov    %rdi,%rbx
+  8021a9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8021ac:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  8021b3:	00 00 00 
+  8021b6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8021b8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8021bc:	4c 89 e6             	mov    %r12,%rsi
+  8021bf:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+    return dst;
+}
+  8021cb:	48 89 d8             	mov    %rbx,%rax
+  8021ce:	5b                   	pop    %rbx
+  8021cf:	41 5c                	pop    %r12
+  8021d1:	5d                   	pop    %rbp
+  8021d2:	c3                   	ret
+
+00000000008021d3 <toupper>:
+
+int
+toupper(int ch) {
+  8021d3:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8021d5:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8021d8:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8021db:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021de:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021e1:	c3                   	ret
+
+00000000008021e2 <tolower>:
+
+int
+tolower(int ch) {
+  8021e2:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8021e4:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8021e7:	8d 57 20             	lea    0x20(%rdi),%edx
+  8021ea:	83 f9 1a             	cmp    $0x1a,%ecx
+  8021ed:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8021f0:	c3                   	ret
+
+00000000008021f1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8021f1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8021f4:	48 85 d2             	test   %rdx,%rdx
+  8021f7:	74 1f                	je     802218 <strncpy+0x27>
+  8021f9:	48 01 fa             	add    %rdi,%rdx
+  8021fc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8021ff:	48 83 c1 01          	add    $0x1,%rcx
+  802203:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802207:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80220b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80220f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802213:	48 39 ca             	cmp    %rcx,%rdx
+  802216:	75 e7                	jne    8021ff <strncpy+0xe>
+    }
+    return ret;
+}
+  802218:	c3                   	ret
+
+0000000000802219 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802219:	48 89 f8             	mov    %rdi,%rax
+  80221c:	48 85 d2             	test   %rdx,%rdx
+  80221f:	74 24                	je     802245 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802221:	48 83 ea 01          	sub    $0x1,%rdx
+  802225:	74 1b                	je     802242 <strlcpy+0x29>
+  802227:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80222b:	0f b6 16             	movzbl (%rsi),%edx
+  80222e:	84 d2                	test   %dl,%dl
+  802230:	74 10                	je     802242 <strlcpy+0x29>
+            *dst++ = *src++;
+  802232:	48 83 c6 01          	add    $0x1,%rsi
+  802236:	48 83 c0 01          	add    $0x1,%rax
+  80223a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80223d:	48 39 c8             	cmp    %rcx,%rax
+  802240:	75 e9                	jne    80222b <strlcpy+0x12>
+        *dst = '\0';
+  802242:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802245:	48 29 f8             	sub    %rdi,%rax
+}
+  802248:	c3                   	ret
+
+0000000000802249 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802249:	0f b6 07             	movzbl (%rdi),%eax
+  80224c:	84 c0                	test   %al,%al
+  80224e:	74 13                	je     802263 <strcmp+0x1a>
+  802250:	38 06                	cmp    %al,(%rsi)
+  802252:	75 0f                	jne    802263 <strcmp+0x1a>
+  802254:	48 83 c7 01          	add    $0x1,%rdi
+  802258:	48 83 c6 01          	add    $0x1,%rsi
+  80225c:	0f b6 07             	movzbl (%rdi),%eax
+  80225f:	84 c0                	test   %al,%al
+  802261:	75 ed                	jne    802250 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802263:	0f b6 c0             	movzbl %al,%eax
+  802266:	0f b6 16             	movzbl (%rsi),%edx
+  802269:	29 d0                	sub    %edx,%eax
+}
+  80226b:	c3                   	ret
+
+000000000080226c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80226c:	48 85 d2             	test   %rdx,%rdx
+  80226f:	74 1f                	je     802290 <strncmp+0x24>
+  802271:	0f b6 07             	movzbl (%rdi),%eax
+  802274:	84 c0                	test   %al,%al
+  802276:	74 1e                	je     802296 <strncmp+0x2a>
+  802278:	3a 06                	cmp    (%rsi),%al
+  80227a:	75 1a                	jne    802296 <strncmp+0x2a>
+  80227c:	48 83 c7 01          	add    $0x1,%rdi
+  802280:	48 83 c6 01          	add    $0x1,%rsi
+  802284:	48 83 ea 01          	sub    $0x1,%rdx
+  802288:	75 e7                	jne    802271 <strncmp+0x5>
+
+    if (!n) return 0;
+  80228a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228f:	c3                   	ret
+  802290:	b8 00 00 00 00       	mov    $0x0,%eax
+  802295:	c3                   	ret
+  802296:	48 85 d2             	test   %rdx,%rdx
+  802299:	74 09                	je     8022a4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80229b:	0f b6 07             	movzbl (%rdi),%eax
+  80229e:	0f b6 16             	movzbl (%rsi),%edx
+  8022a1:	29 d0                	sub    %edx,%eax
+  8022a3:	c3                   	ret
+    if (!n) return 0;
+  8022a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a9:	c3                   	ret
+
+00000000008022aa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8022aa:	0f b6 17             	movzbl (%rdi),%edx
+  8022ad:	84 d2                	test   %dl,%dl
+  8022af:	74 18                	je     8022c9 <strchr+0x1f>
+        if (*str == c) {
+  8022b1:	0f be d2             	movsbl %dl,%edx
+  8022b4:	39 f2                	cmp    %esi,%edx
+  8022b6:	74 17                	je     8022cf <strchr+0x25>
+    for (; *str; str++) {
+  8022b8:	48 83 c7 01          	add    $0x1,%rdi
+  8022bc:	0f b6 17             	movzbl (%rdi),%edx
+  8022bf:	84 d2                	test   %dl,%dl
+  8022c1:	75 ee                	jne    8022b1 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c8:	c3                   	ret
+  8022c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ce:	c3                   	ret
+  8022cf:	48 89 f8             	mov    %rdi,%rax
+}
+  8022d2:	c3                   	ret
+
+00000000008022d3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8022d3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8022d6:	0f b6 17             	movzbl (%rdi),%edx
+  8022d9:	84 d2                	test   %dl,%dl
+  8022db:	74 13                	je     8022f0 <strfind+0x1d>
+  8022dd:	0f be d2             	movsbl %dl,%edx
+  8022e0:	39 f2                	cmp    %esi,%edx
+  8022e2:	74 0b                	je     8022ef <strfind+0x1c>
+  8022e4:	48 83 c0 01          	add    $0x1,%rax
+  8022e8:	0f b6 10             	movzbl (%rax),%edx
+  8022eb:	84 d2                	test   %dl,%dl
+  8022ed:	75 ee                	jne    8022dd <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8022ef:	c3                   	ret
+  8022f0:	c3                   	ret
+
+00000000008022f1 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8022f1:	48 39 f7             	cmp    %rsi,%rdi
+  8022f4:	74 65                	je     80235b <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	41 57                	push   %r15
+  8022fc:	41 56                	push   %r14
+  8022fe:	41 55                	push   %r13
+  802300:	41 54                	push   %r12
+  802302:	53                   	push   %rbx
+  802303:	48 83 ec 18          	sub    $0x18,%rsp
+  802307:	48 89 fb             	mov    %rdi,%rbx
+  80230a:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80230d:	49 bf e2 21 80 00 00 	movabs $0x8021e2,%r15
+  802314:	00 00 00 
+  802317:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80231b:	41 0f b6 fd          	movzbl %r13b,%edi
+  80231f:	41 ff d7             	call   *%r15
+  802322:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802325:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80232a:	41 0f b6 fe          	movzbl %r14b,%edi
+  80232e:	41 ff d7             	call   *%r15
+  802331:	89 c2                	mov    %eax,%edx
+  802333:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802336:	29 d0                	sub    %edx,%eax
+  802338:	75 12                	jne    80234c <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80233a:	48 83 c3 01          	add    $0x1,%rbx
+  80233e:	45 84 ed             	test   %r13b,%r13b
+  802341:	74 09                	je     80234c <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802343:	49 83 c4 01          	add    $0x1,%r12
+  802347:	45 84 f6             	test   %r14b,%r14b
+  80234a:	75 cb                	jne    802317 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80234c:	48 83 c4 18          	add    $0x18,%rsp
+  802350:	5b                   	pop    %rbx
+  802351:	41 5c                	pop    %r12
+  802353:	41 5d                	pop    %r13
+  802355:	41 5e                	pop    %r14
+  802357:	41 5f                	pop    %r15
+  802359:	5d                   	pop    %rbp
+  80235a:	c3                   	ret
+    if (p1 == p2) return 0;
+  80235b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802360:	c3                   	ret
+
+0000000000802361 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802361:	48 39 f7             	cmp    %rsi,%rdi
+  802364:	74 7d                	je     8023e3 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802366:	55                   	push   %rbp
+  802367:	48 89 e5             	mov    %rsp,%rbp
+  80236a:	41 57                	push   %r15
+  80236c:	41 56                	push   %r14
+  80236e:	41 55                	push   %r13
+  802370:	41 54                	push   %r12
+  802372:	53                   	push   %rbx
+  802373:	48 83 ec 18          	sub    $0x18,%rsp
+  802377:	48 89 fb             	mov    %rdi,%rbx
+  80237a:	49 89 f4             	mov    %rsi,%r12
+  80237d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802381:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802385:	49 bf e2 21 80 00 00 	movabs $0x8021e2,%r15
+  80238c:	00 00 00 
+    while (n--) {
+  80238f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802393:	48 39 c3             	cmp    %rax,%rbx
+  802396:	74 37                	je     8023cf <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802398:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80239c:	41 0f b6 fd          	movzbl %r13b,%edi
+  8023a0:	41 ff d7             	call   *%r15
+  8023a3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8023a6:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8023ab:	41 0f b6 fe          	movzbl %r14b,%edi
+  8023af:	41 ff d7             	call   *%r15
+  8023b2:	89 c2                	mov    %eax,%edx
+  8023b4:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8023b7:	29 d0                	sub    %edx,%eax
+  8023b9:	75 19                	jne    8023d4 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8023bb:	48 83 c3 01          	add    $0x1,%rbx
+  8023bf:	45 84 ed             	test   %r13b,%r13b
+  8023c2:	74 10                	je     8023d4 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8023c4:	49 83 c4 01          	add    $0x1,%r12
+  8023c8:	45 84 f6             	test   %r14b,%r14b
+  8023cb:	75 c2                	jne    80238f <strncasecmp+0x2e>
+  8023cd:	eb 05                	jmp    8023d4 <strncasecmp+0x73>
+  8023cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8023d4:	48 83 c4 18          	add    $0x18,%rsp
+  8023d8:	5b                   	pop    %rbx
+  8023d9:	41 5c                	pop    %r12
+  8023db:	41 5d                	pop    %r13
+  8023dd:	41 5e                	pop    %r14
+  8023df:	41 5f                	pop    %r15
+  8023e1:	5d                   	pop    %rbp
+  8023e2:	c3                   	ret
+    if (p1 == p2) return 0;
+  8023e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e8:	c3                   	ret
+
+00000000008023e9 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8023e9:	83 e7 df             	and    $0xffffffdf,%edi
+  8023ec:	83 ef 41             	sub    $0x41,%edi
+  8023ef:	83 ff 19             	cmp    $0x19,%edi
+  8023f2:	0f 96 c0             	setbe  %al
+}
+  8023f5:	c3                   	ret
+
+00000000008023f6 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8023f6:	83 ff 20             	cmp    $0x20,%edi
+  8023f9:	0f 94 c0             	sete   %al
+  8023fc:	83 ff 09             	cmp    $0x9,%edi
+  8023ff:	0f 94 c2             	sete   %dl
+  802402:	09 d0                	or     %edx,%eax
+}
+  802404:	c3                   	ret
+
+0000000000802405 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802405:	55                   	push   %rbp
+  802406:	48 89 e5             	mov    %rsp,%rbp
+  802409:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80240b:	48 bf 3f 63 80 00 00 	movabs $0x80633f,%rdi
+  802412:	00 00 00 
+  802415:	48 b8 aa 22 80 00 00 	movabs $0x8022aa,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+  802421:	48 85 c0             	test   %rax,%rax
+  802424:	0f 95 c0             	setne  %al
+}
+  802427:	5d                   	pop    %rbp
+  802428:	c3                   	ret
+
+0000000000802429 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802429:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80242c:	48 89 f8             	mov    %rdi,%rax
+  80242f:	48 f7 d8             	neg    %rax
+  802432:	83 e0 07             	and    $0x7,%eax
+  802435:	49 89 d1             	mov    %rdx,%r9
+  802438:	49 29 c1             	sub    %rax,%r9
+  80243b:	78 36                	js     802473 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80243d:	40 0f b6 c6          	movzbl %sil,%eax
+  802441:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802448:	01 01 01 
+  80244b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80244f:	40 f6 c7 07          	test   $0x7,%dil
+  802453:	75 38                	jne    80248d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802455:	4c 89 c9             	mov    %r9,%rcx
+  802458:	48 c1 f9 03          	sar    $0x3,%rcx
+  80245c:	74 0c                	je     80246a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80245e:	fc                   	cld
+  80245f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802462:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802466:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80246a:	4d 85 c9             	test   %r9,%r9
+  80246d:	75 45                	jne    8024b4 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80246f:	4c 89 c0             	mov    %r8,%rax
+  802472:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802473:	48 85 d2             	test   %rdx,%rdx
+  802476:	74 f7                	je     80246f <memset+0x46>
+  802478:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80247b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80247e:	48 83 c0 01          	add    $0x1,%rax
+  802482:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802486:	48 39 c2             	cmp    %rax,%rdx
+  802489:	75 f3                	jne    80247e <memset+0x55>
+  80248b:	eb e2                	jmp    80246f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80248d:	40 f6 c7 01          	test   $0x1,%dil
+  802491:	74 06                	je     802499 <memset+0x70>
+  802493:	88 07                	mov    %al,(%rdi)
+  802495:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802499:	40 f6 c7 02          	test   $0x2,%dil
+  80249d:	74 07                	je     8024a6 <memset+0x7d>
+  80249f:	66 89 07             	mov    %ax,(%rdi)
+  8024a2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024a6:	40 f6 c7 04          	test   $0x4,%dil
+  8024aa:	74 a9                	je     802455 <memset+0x2c>
+  8024ac:	89 07                	mov    %eax,(%rdi)
+  8024ae:	48 83 c7 04          	add    $0x4,%rdi
+  8024b2:	eb a1                	jmp    802455 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8024b4:	41 f6 c1 04          	test   $0x4,%r9b
+  8024b8:	74 06                	je     8024c0 <memset+0x97>
+  8024ba:	89 07                	mov    %eax,(%rdi)
+  8024bc:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8024c0:	41 f6 c1 02          	test   $0x2,%r9b
+  8024c4:	74 07                	je     8024cd <memset+0xa4>
+  8024c6:	66 89 07             	mov    %ax,(%rdi)
+  8024c9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8024cd:	41 f6 c1 01          	test   $0x1,%r9b
+  8024d1:	74 9c                	je     80246f <memset+0x46>
+  8024d3:	88 07                	mov    %al,(%rdi)
+  8024d5:	eb 98                	jmp    80246f <memset+0x46>
+
+00000000008024d7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8024d7:	48 89 f8             	mov    %rdi,%rax
+  8024da:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8024dd:	48 39 fe             	cmp    %rdi,%rsi
+  8024e0:	73 3b                	jae    80251d <memmove+0x46>
+  8024e2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8024e6:	48 39 d7             	cmp    %rdx,%rdi
+  8024e9:	73 32                	jae    80251d <memmove+0x46>
+        s += n;
+        d += n;
+  8024eb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8024ef:	48 89 d6             	mov    %rdx,%rsi
+  8024f2:	48 09 fe             	or     %rdi,%rsi
+  8024f5:	48 09 ce             	or     %rcx,%rsi
+  8024f8:	40 f6 c6 07          	test   $0x7,%sil
+  8024fc:	75 12                	jne    802510 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8024fe:	48 83 ef 08          	sub    $0x8,%rdi
+  802502:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802506:	48 c1 e9 03          	shr    $0x3,%rcx
+  80250a:	fd                   	std
+  80250b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80250e:	fc                   	cld
+  80250f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802510:	48 83 ef 01          	sub    $0x1,%rdi
+  802514:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802518:	fd                   	std
+  802519:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80251b:	eb f1                	jmp    80250e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80251d:	48 89 f2             	mov    %rsi,%rdx
+  802520:	48 09 c2             	or     %rax,%rdx
+  802523:	48 09 ca             	or     %rcx,%rdx
+  802526:	f6 c2 07             	test   $0x7,%dl
+  802529:	75 0c                	jne    802537 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80252b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80252f:	48 89 c7             	mov    %rax,%rdi
+  802532:	fc                   	cld
+  802533:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802536:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802537:	48 89 c7             	mov    %rax,%rdi
+  80253a:	fc                   	cld
+  80253b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80253d:	c3                   	ret
+
+000000000080253e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80253e:	55                   	push   %rbp
+  80253f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802542:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  802549:	00 00 00 
+  80254c:	ff d0                	call   *%rax
+}
+  80254e:	5d                   	pop    %rbp
+  80254f:	c3                   	ret
+
+0000000000802550 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802550:	55                   	push   %rbp
+  802551:	48 89 e5             	mov    %rsp,%rbp
+  802554:	41 57                	push   %r15
+  802556:	41 56                	push   %r14
+  802558:	41 55                	push   %r13
+  80255a:	41 54                	push   %r12
+  80255c:	53                   	push   %rbx
+  80255d:	48 83 ec 08          	sub    $0x8,%rsp
+  802561:	49 89 fe             	mov    %rdi,%r14
+  802564:	49 89 f7             	mov    %rsi,%r15
+  802567:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80256a:	48 89 f7             	mov    %rsi,%rdi
+  80256d:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80257c:	48 89 de             	mov    %rbx,%rsi
+  80257f:	4c 89 f7             	mov    %r14,%rdi
+  802582:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+  80258e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802591:	48 39 c3             	cmp    %rax,%rbx
+  802594:	74 36                	je     8025cc <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802596:	48 89 d8             	mov    %rbx,%rax
+  802599:	4c 29 e8             	sub    %r13,%rax
+  80259c:	49 39 c4             	cmp    %rax,%r12
+  80259f:	73 31                	jae    8025d2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8025a1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8025a6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025aa:	4c 89 fe             	mov    %r15,%rsi
+  8025ad:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  8025b4:	00 00 00 
+  8025b7:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8025b9:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8025bd:	48 83 c4 08          	add    $0x8,%rsp
+  8025c1:	5b                   	pop    %rbx
+  8025c2:	41 5c                	pop    %r12
+  8025c4:	41 5d                	pop    %r13
+  8025c6:	41 5e                	pop    %r14
+  8025c8:	41 5f                	pop    %r15
+  8025ca:	5d                   	pop    %rbp
+  8025cb:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8025cc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8025d0:	eb eb                	jmp    8025bd <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8025d2:	48 83 eb 01          	sub    $0x1,%rbx
+  8025d6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8025da:	48 89 da             	mov    %rbx,%rdx
+  8025dd:	4c 89 fe             	mov    %r15,%rsi
+  8025e0:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  8025e7:	00 00 00 
+  8025ea:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8025ec:	49 01 de             	add    %rbx,%r14
+  8025ef:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8025f4:	eb c3                	jmp    8025b9 <strlcat+0x69>
+
+00000000008025f6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8025f6:	48 85 d2             	test   %rdx,%rdx
+  8025f9:	74 2d                	je     802628 <memcmp+0x32>
+  8025fb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802600:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802604:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802609:	44 38 c1             	cmp    %r8b,%cl
+  80260c:	75 0f                	jne    80261d <memcmp+0x27>
+    while (n-- > 0) {
+  80260e:	48 83 c0 01          	add    $0x1,%rax
+  802612:	48 39 c2             	cmp    %rax,%rdx
+  802615:	75 e9                	jne    802600 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80261d:	0f b6 c1             	movzbl %cl,%eax
+  802620:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802624:	44 29 c0             	sub    %r8d,%eax
+  802627:	c3                   	ret
+    return 0;
+  802628:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80262d:	c3                   	ret
+
+000000000080262e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80262e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802632:	48 39 c7             	cmp    %rax,%rdi
+  802635:	73 0f                	jae    802646 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802637:	40 38 37             	cmp    %sil,(%rdi)
+  80263a:	74 0e                	je     80264a <memfind+0x1c>
+    for (; src < end; src++) {
+  80263c:	48 83 c7 01          	add    $0x1,%rdi
+  802640:	48 39 f8             	cmp    %rdi,%rax
+  802643:	75 f2                	jne    802637 <memfind+0x9>
+  802645:	c3                   	ret
+  802646:	48 89 f8             	mov    %rdi,%rax
+  802649:	c3                   	ret
+  80264a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80264d:	c3                   	ret
+
+000000000080264e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80264e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802651:	0f b6 37             	movzbl (%rdi),%esi
+  802654:	40 80 fe 20          	cmp    $0x20,%sil
+  802658:	74 06                	je     802660 <strtol+0x12>
+  80265a:	40 80 fe 09          	cmp    $0x9,%sil
+  80265e:	75 13                	jne    802673 <strtol+0x25>
+  802660:	48 83 c7 01          	add    $0x1,%rdi
+  802664:	0f b6 37             	movzbl (%rdi),%esi
+  802667:	40 80 fe 20          	cmp    $0x20,%sil
+  80266b:	74 f3                	je     802660 <strtol+0x12>
+  80266d:	40 80 fe 09          	cmp    $0x9,%sil
+  802671:	74 ed                	je     802660 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802673:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802676:	83 e0 fd             	and    $0xfffffffd,%eax
+  802679:	3c 01                	cmp    $0x1,%al
+  80267b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80267f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802685:	75 0f                	jne    802696 <strtol+0x48>
+  802687:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80268a:	74 14                	je     8026a0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80268c:	85 d2                	test   %edx,%edx
+  80268e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802693:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802696:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80269b:	4c 63 ca             	movslq %edx,%r9
+  80269e:	eb 36                	jmp    8026d6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8026a0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8026a4:	74 0f                	je     8026b5 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8026a6:	85 d2                	test   %edx,%edx
+  8026a8:	75 ec                	jne    802696 <strtol+0x48>
+        s++;
+  8026aa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8026ae:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8026b3:	eb e1                	jmp    802696 <strtol+0x48>
+        s += 2;
+  8026b5:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8026b9:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8026be:	eb d6                	jmp    802696 <strtol+0x48>
+            dig -= '0';
+  8026c0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8026c3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8026c7:	41 39 d0             	cmp    %edx,%r8d
+  8026ca:	7d 21                	jge    8026ed <strtol+0x9f>
+        val = val * base + dig;
+  8026cc:	49 0f af c1          	imul   %r9,%rax
+  8026d0:	0f b6 c9             	movzbl %cl,%ecx
+  8026d3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8026d6:	48 83 c7 01          	add    $0x1,%rdi
+  8026da:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8026de:	80 f9 39             	cmp    $0x39,%cl
+  8026e1:	76 dd                	jbe    8026c0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8026e3:	80 f9 7b             	cmp    $0x7b,%cl
+  8026e6:	77 05                	ja     8026ed <strtol+0x9f>
+            dig -= 'a' - 10;
+  8026e8:	83 e9 57             	sub    $0x57,%ecx
+  8026eb:	eb d6                	jmp    8026c3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8026ed:	4d 85 d2             	test   %r10,%r10
+  8026f0:	74 03                	je     8026f5 <strtol+0xa7>
+  8026f2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8026f5:	48 89 c2             	mov    %rax,%rdx
+  8026f8:	48 f7 da             	neg    %rdx
+  8026fb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8026ff:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802703:	c3                   	ret
+
+0000000000802704 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802704:	55                   	push   %rbp
+  802705:	48 89 e5             	mov    %rsp,%rbp
+  802708:	53                   	push   %rbx
+  802709:	48 89 fa             	mov    %rdi,%rdx
+  80270c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802714:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802719:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80271e:	be 00 00 00 00       	mov    $0x0,%esi
+  802723:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802729:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80272f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802731:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802735:	c9                   	leave
+  802736:	c3                   	ret
+
+0000000000802737 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80273c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802741:	ba 00 00 00 00       	mov    $0x0,%edx
+  802746:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80274b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802750:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802755:	be 00 00 00 00       	mov    $0x0,%esi
+  80275a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802760:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802766:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+000000000080276e <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80276e:	55                   	push   %rbp
+  80276f:	48 89 e5             	mov    %rsp,%rbp
+  802772:	53                   	push   %rbx
+  802773:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802776:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80277b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802780:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802785:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80278a:	be 00 00 00 00       	mov    $0x0,%esi
+  80278f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802795:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80279b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80279d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a1:	c9                   	leave
+  8027a2:	c3                   	ret
+
+00000000008027a3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027a3:	55                   	push   %rbp
+  8027a4:	48 89 e5             	mov    %rsp,%rbp
+  8027a7:	53                   	push   %rbx
+  8027a8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8027ac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027af:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8027b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027be:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8027d6:	48 85 c0             	test   %rax,%rax
+  8027d9:	7f 06                	jg     8027e1 <sys_env_destroy+0x3e>
+}
+  8027db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027df:	c9                   	leave
+  8027e0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8027e1:	49 89 c0             	mov    %rax,%r8
+  8027e4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8027e9:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  8027f0:	00 00 00 
+  8027f3:	be 27 00 00 00       	mov    $0x27,%esi
+  8027f8:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  8027ff:	00 00 00 
+  802802:	b8 00 00 00 00       	mov    $0x0,%eax
+  802807:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  80280e:	00 00 00 
+  802811:	41 ff d1             	call   *%r9
+
+0000000000802814 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802814:	55                   	push   %rbp
+  802815:	48 89 e5             	mov    %rsp,%rbp
+  802818:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802819:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80281e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802823:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802828:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80282d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802832:	be 00 00 00 00       	mov    $0x0,%esi
+  802837:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80283d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802843:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802845:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802849:	c9                   	leave
+  80284a:	c3                   	ret
+
+000000000080284b <sys_yield>:
+
+void
+sys_yield(void) {
+  80284b:	55                   	push   %rbp
+  80284c:	48 89 e5             	mov    %rsp,%rbp
+  80284f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802850:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802855:	ba 00 00 00 00       	mov    $0x0,%edx
+  80285a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80285f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802864:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802869:	be 00 00 00 00       	mov    $0x0,%esi
+  80286e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802874:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80287a:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80287c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+0000000000802882 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802882:	55                   	push   %rbp
+  802883:	48 89 e5             	mov    %rsp,%rbp
+  802886:	53                   	push   %rbx
+  802887:	48 89 fa             	mov    %rdi,%rdx
+  80288a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80288d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802892:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802899:	00 00 00 
+  80289c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8028b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+00000000008028ba <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  8028be:	53                   	push   %rbx
+  8028bf:	49 89 f8             	mov    %rdi,%r8
+  8028c2:	48 89 d3             	mov    %rdx,%rbx
+  8028c5:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8028c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028cd:	4c 89 c2             	mov    %r8,%rdx
+  8028d0:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028e4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8028e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+
+00000000008028ec <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8028ec:	55                   	push   %rbp
+  8028ed:	48 89 e5             	mov    %rsp,%rbp
+  8028f0:	53                   	push   %rbx
+  8028f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f5:	89 f8                	mov    %edi,%eax
+  8028f7:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8028fa:	48 63 f9             	movslq %ecx,%rdi
+  8028fd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802900:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802905:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802908:	be 00 00 00 00       	mov    $0x0,%esi
+  80290d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802913:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802919:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80291b:	48 85 c0             	test   %rax,%rax
+  80291e:	7f 06                	jg     802926 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802920:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802926:	49 89 c0             	mov    %rax,%r8
+  802929:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80292e:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802935:	00 00 00 
+  802938:	be 27 00 00 00       	mov    $0x27,%esi
+  80293d:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802944:	00 00 00 
+  802947:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294c:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802953:	00 00 00 
+  802956:	41 ff d1             	call   *%r9
+
+0000000000802959 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802959:	55                   	push   %rbp
+  80295a:	48 89 e5             	mov    %rsp,%rbp
+  80295d:	53                   	push   %rbx
+  80295e:	48 83 ec 08          	sub    $0x8,%rsp
+  802962:	89 f8                	mov    %edi,%eax
+  802964:	49 89 f2             	mov    %rsi,%r10
+  802967:	48 89 cf             	mov    %rcx,%rdi
+  80296a:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80296d:	48 63 da             	movslq %edx,%rbx
+  802970:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802973:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802978:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297b:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  80297e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802984:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802986:	48 85 c0             	test   %rax,%rax
+  802989:	7f 06                	jg     802991 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80298b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80298f:	c9                   	leave
+  802990:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802991:	49 89 c0             	mov    %rax,%r8
+  802994:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802999:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  8029a0:	00 00 00 
+  8029a3:	be 27 00 00 00       	mov    $0x27,%esi
+  8029a8:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  8029af:	00 00 00 
+  8029b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b7:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  8029be:	00 00 00 
+  8029c1:	41 ff d1             	call   *%r9
+
+00000000008029c4 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8029c4:	55                   	push   %rbp
+  8029c5:	48 89 e5             	mov    %rsp,%rbp
+  8029c8:	53                   	push   %rbx
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8029cd:	48 89 f1             	mov    %rsi,%rcx
+  8029d0:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8029d3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029f1:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029f3:	48 85 c0             	test   %rax,%rax
+  8029f6:	7f 06                	jg     8029fe <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8029f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029fc:	c9                   	leave
+  8029fd:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029fe:	49 89 c0             	mov    %rax,%r8
+  802a01:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a06:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802a0d:	00 00 00 
+  802a10:	be 27 00 00 00       	mov    $0x27,%esi
+  802a15:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802a1c:	00 00 00 
+  802a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a24:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802a2b:	00 00 00 
+  802a2e:	41 ff d1             	call   *%r9
+
+0000000000802a31 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a31:	55                   	push   %rbp
+  802a32:	48 89 e5             	mov    %rsp,%rbp
+  802a35:	53                   	push   %rbx
+  802a36:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802a3a:	48 63 ce             	movslq %esi,%rcx
+  802a3d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a40:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a60:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a62:	48 85 c0             	test   %rax,%rax
+  802a65:	7f 06                	jg     802a6d <sys_env_set_status+0x3c>
+}
+  802a67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6b:	c9                   	leave
+  802a6c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a6d:	49 89 c0             	mov    %rax,%r8
+  802a70:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802a75:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802a7c:	00 00 00 
+  802a7f:	be 27 00 00 00       	mov    $0x27,%esi
+  802a84:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802a8b:	00 00 00 
+  802a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a93:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802a9a:	00 00 00 
+  802a9d:	41 ff d1             	call   *%r9
+
+0000000000802aa0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802aa0:	55                   	push   %rbp
+  802aa1:	48 89 e5             	mov    %rsp,%rbp
+  802aa4:	53                   	push   %rbx
+  802aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802aac:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aaf:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802abe:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ac9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802acf:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ad1:	48 85 c0             	test   %rax,%rax
+  802ad4:	7f 06                	jg     802adc <sys_env_set_trapframe+0x3c>
+}
+  802ad6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ada:	c9                   	leave
+  802adb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802adc:	49 89 c0             	mov    %rax,%r8
+  802adf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802ae4:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802aeb:	00 00 00 
+  802aee:	be 27 00 00 00       	mov    $0x27,%esi
+  802af3:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802afa:	00 00 00 
+  802afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b02:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802b09:	00 00 00 
+  802b0c:	41 ff d1             	call   *%r9
+
+0000000000802b0f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b0f:	55                   	push   %rbp
+  802b10:	48 89 e5             	mov    %rsp,%rbp
+  802b13:	53                   	push   %rbx
+  802b14:	48 83 ec 08          	sub    $0x8,%rsp
+  802b18:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802b1b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b1e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b28:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b32:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b38:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b3e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b40:	48 85 c0             	test   %rax,%rax
+  802b43:	7f 06                	jg     802b4b <sys_env_set_pgfault_upcall+0x3c>
+}
+  802b45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b49:	c9                   	leave
+  802b4a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b4b:	49 89 c0             	mov    %rax,%r8
+  802b4e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802b53:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802b5a:	00 00 00 
+  802b5d:	be 27 00 00 00       	mov    $0x27,%esi
+  802b62:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802b69:	00 00 00 
+  802b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b71:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802b78:	00 00 00 
+  802b7b:	41 ff d1             	call   *%r9
+
+0000000000802b7e <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802b7e:	55                   	push   %rbp
+  802b7f:	48 89 e5             	mov    %rsp,%rbp
+  802b82:	53                   	push   %rbx
+  802b83:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802b87:	40 0f b6 ce          	movzbl %sil,%ecx
+  802b8b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b98:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b9d:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ba8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bae:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bb0:	48 85 c0             	test   %rax,%rax
+  802bb3:	7f 06                	jg     802bbb <sys_env_set_reclaim+0x3d>
+}
+  802bb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bbb:	49 89 c0             	mov    %rax,%r8
+  802bbe:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802bc3:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802bca:	00 00 00 
+  802bcd:	be 27 00 00 00       	mov    $0x27,%esi
+  802bd2:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802bd9:	00 00 00 
+  802bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be1:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802be8:	00 00 00 
+  802beb:	41 ff d1             	call   *%r9
+
+0000000000802bee <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802bee:	55                   	push   %rbp
+  802bef:	48 89 e5             	mov    %rsp,%rbp
+  802bf2:	53                   	push   %rbx
+  802bf3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802bf7:	48 63 ce             	movslq %esi,%rcx
+  802bfa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bfd:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c07:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c1d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c1f:	48 85 c0             	test   %rax,%rax
+  802c22:	7f 06                	jg     802c2a <sys_env_set_nice+0x3c>
+}
+  802c24:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c2a:	49 89 c0             	mov    %rax,%r8
+  802c2d:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802c32:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802c39:	00 00 00 
+  802c3c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c41:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802c48:	00 00 00 
+  802c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c50:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802c57:	00 00 00 
+  802c5a:	41 ff d1             	call   *%r9
+
+0000000000802c5d <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802c5d:	55                   	push   %rbp
+  802c5e:	48 89 e5             	mov    %rsp,%rbp
+  802c61:	53                   	push   %rbx
+  802c62:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c65:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c74:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c79:	be 00 00 00 00       	mov    $0x0,%esi
+  802c7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c84:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c8a:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802c8c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c90:	c9                   	leave
+  802c91:	c3                   	ret
+
+0000000000802c92 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802c92:	55                   	push   %rbp
+  802c93:	48 89 e5             	mov    %rsp,%rbp
+  802c96:	53                   	push   %rbx
+  802c97:	89 f8                	mov    %edi,%eax
+  802c99:	49 89 f1             	mov    %rsi,%r9
+  802c9c:	48 89 d3             	mov    %rdx,%rbx
+  802c9f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ca2:	49 63 f0             	movslq %r8d,%rsi
+  802ca5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cad:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbc:	cd 30                	int    $0x30
+}
+  802cbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc2:	c9                   	leave
+  802cc3:	c3                   	ret
+
+0000000000802cc4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802cc4:	55                   	push   %rbp
+  802cc5:	48 89 e5             	mov    %rsp,%rbp
+  802cc8:	53                   	push   %rbx
+  802cc9:	89 f8                	mov    %edi,%eax
+  802ccb:	49 89 f1             	mov    %rsi,%r9
+  802cce:	48 89 d3             	mov    %rdx,%rbx
+  802cd1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802cd4:	49 63 f0             	movslq %r8d,%rsi
+  802cd7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cda:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cdf:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ce2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ce8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cee:	cd 30                	int    $0x30
+}
+  802cf0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf4:	c9                   	leave
+  802cf5:	c3                   	ret
+
+0000000000802cf6 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cf6:	55                   	push   %rbp
+  802cf7:	48 89 e5             	mov    %rsp,%rbp
+  802cfa:	53                   	push   %rbx
+  802cfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802cff:	89 f8                	mov    %edi,%eax
+  802d01:	49 89 f2             	mov    %rsi,%r10
+  802d04:	48 89 d3             	mov    %rdx,%rbx
+  802d07:	48 89 cf             	mov    %rcx,%rdi
+  802d0a:	44 89 c6             	mov    %r8d,%esi
+  802d0d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802d10:	48 63 f6             	movslq %esi,%rsi
+  802d13:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d16:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d1b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802d1e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802d22:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d24:	48 85 c0             	test   %rax,%rax
+  802d27:	7f 06                	jg     802d2f <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d29:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d2d:	c9                   	leave
+  802d2e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d2f:	49 89 c0             	mov    %rax,%r8
+  802d32:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802d37:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802d3e:	00 00 00 
+  802d41:	be 27 00 00 00       	mov    $0x27,%esi
+  802d46:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802d4d:	00 00 00 
+  802d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d55:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802d5c:	00 00 00 
+  802d5f:	41 ff d1             	call   *%r9
+
+0000000000802d62 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802d62:	55                   	push   %rbp
+  802d63:	48 89 e5             	mov    %rsp,%rbp
+  802d66:	53                   	push   %rbx
+  802d67:	48 83 ec 08          	sub    $0x8,%rsp
+  802d6b:	48 89 f1             	mov    %rsi,%rcx
+  802d6e:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802d71:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802d75:	48 8b 1a             	mov    (%rdx),%rbx
+  802d78:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d80:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d84:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802d88:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802d8c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d8e:	48 85 c0             	test   %rax,%rax
+  802d91:	7f 06                	jg     802d99 <sys_ipc_call_short+0x37>
+}
+  802d93:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d97:	c9                   	leave
+  802d98:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d99:	49 89 c0             	mov    %rax,%r8
+  802d9c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802da1:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802da8:	00 00 00 
+  802dab:	be 27 00 00 00       	mov    $0x27,%esi
+  802db0:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802db7:	00 00 00 
+  802dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbf:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802dc6:	00 00 00 
+  802dc9:	41 ff d1             	call   *%r9
+
+0000000000802dcc <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802dcc:	55                   	push   %rbp
+  802dcd:	48 89 e5             	mov    %rsp,%rbp
+  802dd0:	53                   	push   %rbx
+  802dd1:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd5:	89 f8                	mov    %edi,%eax
+  802dd7:	49 89 f2             	mov    %rsi,%r10
+  802dda:	48 89 d3             	mov    %rdx,%rbx
+  802ddd:	48 89 cf             	mov    %rcx,%rdi
+  802de0:	44 89 c6             	mov    %r8d,%esi
+  802de3:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802de6:	48 63 f6             	movslq %esi,%rsi
+  802de9:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dec:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802df1:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802df4:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802df8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802dfa:	48 85 c0             	test   %rax,%rax
+  802dfd:	7f 06                	jg     802e05 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802dff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e03:	c9                   	leave
+  802e04:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e05:	49 89 c0             	mov    %rax,%r8
+  802e08:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802e0d:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802e14:	00 00 00 
+  802e17:	be 27 00 00 00       	mov    $0x27,%esi
+  802e1c:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802e23:	00 00 00 
+  802e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e2b:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802e32:	00 00 00 
+  802e35:	41 ff d1             	call   *%r9
+
+0000000000802e38 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802e38:	55                   	push   %rbp
+  802e39:	48 89 e5             	mov    %rsp,%rbp
+  802e3c:	53                   	push   %rbx
+  802e3d:	48 83 ec 08          	sub    $0x8,%rsp
+  802e41:	48 89 fa             	mov    %rdi,%rdx
+  802e44:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802e47:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e51:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e56:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e61:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e67:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e69:	48 85 c0             	test   %rax,%rax
+  802e6c:	7f 06                	jg     802e74 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e6e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e72:	c9                   	leave
+  802e73:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e74:	49 89 c0             	mov    %rax,%r8
+  802e77:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802e7c:	48 ba 48 63 80 00 00 	movabs $0x806348,%rdx
+  802e83:	00 00 00 
+  802e86:	be 27 00 00 00       	mov    $0x27,%esi
+  802e8b:	48 bf 67 63 80 00 00 	movabs $0x806367,%rdi
+  802e92:	00 00 00 
+  802e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e9a:	49 b9 00 17 80 00 00 	movabs $0x801700,%r9
+  802ea1:	00 00 00 
+  802ea4:	41 ff d1             	call   *%r9
+
+0000000000802ea7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802ea7:	55                   	push   %rbp
+  802ea8:	48 89 e5             	mov    %rsp,%rbp
+  802eab:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802eac:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ebb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ec5:	be 00 00 00 00       	mov    $0x0,%esi
+  802eca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ed0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ed6:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ed8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802edc:	c9                   	leave
+  802edd:	c3                   	ret
+
+0000000000802ede <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802ede:	55                   	push   %rbp
+  802edf:	48 89 e5             	mov    %rsp,%rbp
+  802ee2:	53                   	push   %rbx
+  802ee3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ee6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eeb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ef5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802efa:	be 00 00 00 00       	mov    $0x0,%esi
+  802eff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f0b:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802f0d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f11:	c9                   	leave
+  802f12:	c3                   	ret
+
+0000000000802f13 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802f13:	55                   	push   %rbp
+  802f14:	48 89 e5             	mov    %rsp,%rbp
+  802f17:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802f18:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f2c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f31:	be 00 00 00 00       	mov    $0x0,%esi
+  802f36:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f3c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f42:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802f44:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+
+0000000000802f4a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f4a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802f51:	ff ff ff 
+  802f54:	48 01 f8             	add    %rdi,%rax
+  802f57:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f5b:	c3                   	ret
+
+0000000000802f5c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f5c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802f63:	ff ff ff 
+  802f66:	48 01 f8             	add    %rdi,%rax
+  802f69:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802f6d:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802f73:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802f77:	c3                   	ret
+
+0000000000802f78 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802f78:	55                   	push   %rbp
+  802f79:	48 89 e5             	mov    %rsp,%rbp
+  802f7c:	41 57                	push   %r15
+  802f7e:	41 56                	push   %r14
+  802f80:	41 55                	push   %r13
+  802f82:	41 54                	push   %r12
+  802f84:	53                   	push   %rbx
+  802f85:	48 83 ec 08          	sub    $0x8,%rsp
+  802f89:	49 89 ff             	mov    %rdi,%r15
+  802f8c:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802f91:	49 bd 78 44 80 00 00 	movabs $0x804478,%r13
+  802f98:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802f9b:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802fa1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802fa4:	48 89 df             	mov    %rbx,%rdi
+  802fa7:	41 ff d5             	call   *%r13
+  802faa:	83 e0 04             	and    $0x4,%eax
+  802fad:	74 17                	je     802fc6 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802faf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802fb6:	4c 39 f3             	cmp    %r14,%rbx
+  802fb9:	75 e6                	jne    802fa1 <fd_alloc+0x29>
+  802fbb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802fc1:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802fc6:	4d 89 27             	mov    %r12,(%r15)
+}
+  802fc9:	48 83 c4 08          	add    $0x8,%rsp
+  802fcd:	5b                   	pop    %rbx
+  802fce:	41 5c                	pop    %r12
+  802fd0:	41 5d                	pop    %r13
+  802fd2:	41 5e                	pop    %r14
+  802fd4:	41 5f                	pop    %r15
+  802fd6:	5d                   	pop    %rbp
+  802fd7:	c3                   	ret
+
+0000000000802fd8 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802fd8:	83 ff 1f             	cmp    $0x1f,%edi
+  802fdb:	77 39                	ja     803016 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802fdd:	55                   	push   %rbp
+  802fde:	48 89 e5             	mov    %rsp,%rbp
+  802fe1:	41 54                	push   %r12
+  802fe3:	53                   	push   %rbx
+  802fe4:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802fe7:	48 63 df             	movslq %edi,%rbx
+  802fea:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802ff1:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802ff5:	48 89 df             	mov    %rbx,%rdi
+  802ff8:	48 b8 78 44 80 00 00 	movabs $0x804478,%rax
+  802fff:	00 00 00 
+  803002:	ff d0                	call   *%rax
+  803004:	a8 04                	test   $0x4,%al
+  803006:	74 14                	je     80301c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803008:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80300c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803011:	5b                   	pop    %rbx
+  803012:	41 5c                	pop    %r12
+  803014:	5d                   	pop    %rbp
+  803015:	c3                   	ret
+        return -E_INVAL;
+  803016:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80301b:	c3                   	ret
+        return -E_INVAL;
+  80301c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803021:	eb ee                	jmp    803011 <fd_lookup+0x39>
+
+0000000000803023 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803023:	55                   	push   %rbp
+  803024:	48 89 e5             	mov    %rsp,%rbp
+  803027:	41 54                	push   %r12
+  803029:	53                   	push   %rbx
+  80302a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80302d:	48 b8 00 64 80 00 00 	movabs $0x806400,%rax
+  803034:	00 00 00 
+  803037:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80303e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803041:	39 3b                	cmp    %edi,(%rbx)
+  803043:	74 47                	je     80308c <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803045:	48 83 c0 08          	add    $0x8,%rax
+  803049:	48 8b 18             	mov    (%rax),%rbx
+  80304c:	48 85 db             	test   %rbx,%rbx
+  80304f:	75 f0                	jne    803041 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803051:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  803058:	00 00 00 
+  80305b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803061:	89 fa                	mov    %edi,%edx
+  803063:	48 bf 78 63 80 00 00 	movabs $0x806378,%rdi
+  80306a:	00 00 00 
+  80306d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803072:	48 b9 50 18 80 00 00 	movabs $0x801850,%rcx
+  803079:	00 00 00 
+  80307c:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80307e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803083:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803087:	5b                   	pop    %rbx
+  803088:	41 5c                	pop    %r12
+  80308a:	5d                   	pop    %rbp
+  80308b:	c3                   	ret
+            return 0;
+  80308c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803091:	eb f0                	jmp    803083 <dev_lookup+0x60>
+
+0000000000803093 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	41 55                	push   %r13
+  803099:	41 54                	push   %r12
+  80309b:	53                   	push   %rbx
+  80309c:	48 83 ec 18          	sub    $0x18,%rsp
+  8030a0:	48 89 fb             	mov    %rdi,%rbx
+  8030a3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030a6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8030ad:	ff ff ff 
+  8030b0:	48 01 df             	add    %rbx,%rdi
+  8030b3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8030b7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030bb:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+  8030c7:	41 89 c5             	mov    %eax,%r13d
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	78 06                	js     8030d4 <fd_close+0x41>
+  8030ce:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8030d2:	74 1a                	je     8030ee <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8030d4:	45 84 e4             	test   %r12b,%r12b
+  8030d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030dc:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8030e0:	44 89 e8             	mov    %r13d,%eax
+  8030e3:	48 83 c4 18          	add    $0x18,%rsp
+  8030e7:	5b                   	pop    %rbx
+  8030e8:	41 5c                	pop    %r12
+  8030ea:	41 5d                	pop    %r13
+  8030ec:	5d                   	pop    %rbp
+  8030ed:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8030ee:	8b 3b                	mov    (%rbx),%edi
+  8030f0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8030f4:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  8030fb:	00 00 00 
+  8030fe:	ff d0                	call   *%rax
+  803100:	41 89 c5             	mov    %eax,%r13d
+  803103:	85 c0                	test   %eax,%eax
+  803105:	78 1b                	js     803122 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803107:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80310b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80310f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803115:	48 85 c0             	test   %rax,%rax
+  803118:	74 08                	je     803122 <fd_close+0x8f>
+  80311a:	48 89 df             	mov    %rbx,%rdi
+  80311d:	ff d0                	call   *%rax
+  80311f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803122:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803127:	48 89 de             	mov    %rbx,%rsi
+  80312a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80312f:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  803136:	00 00 00 
+  803139:	ff d0                	call   *%rax
+    return res;
+  80313b:	eb a3                	jmp    8030e0 <fd_close+0x4d>
+
+000000000080313d <close>:
+
+int
+close(int fdnum) {
+  80313d:	55                   	push   %rbp
+  80313e:	48 89 e5             	mov    %rsp,%rbp
+  803141:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803145:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803149:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  803150:	00 00 00 
+  803153:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803155:	85 c0                	test   %eax,%eax
+  803157:	78 15                	js     80316e <close+0x31>
+
+    return fd_close(fd, 1);
+  803159:	be 01 00 00 00       	mov    $0x1,%esi
+  80315e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803162:	48 b8 93 30 80 00 00 	movabs $0x803093,%rax
+  803169:	00 00 00 
+  80316c:	ff d0                	call   *%rax
+}
+  80316e:	c9                   	leave
+  80316f:	c3                   	ret
+
+0000000000803170 <close_all>:
+
+void
+close_all(void) {
+  803170:	55                   	push   %rbp
+  803171:	48 89 e5             	mov    %rsp,%rbp
+  803174:	41 54                	push   %r12
+  803176:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803177:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80317c:	49 bc 3d 31 80 00 00 	movabs $0x80313d,%r12
+  803183:	00 00 00 
+  803186:	89 df                	mov    %ebx,%edi
+  803188:	41 ff d4             	call   *%r12
+  80318b:	83 c3 01             	add    $0x1,%ebx
+  80318e:	83 fb 20             	cmp    $0x20,%ebx
+  803191:	75 f3                	jne    803186 <close_all+0x16>
+}
+  803193:	5b                   	pop    %rbx
+  803194:	41 5c                	pop    %r12
+  803196:	5d                   	pop    %rbp
+  803197:	c3                   	ret
+
+0000000000803198 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803198:	55                   	push   %rbp
+  803199:	48 89 e5             	mov    %rsp,%rbp
+  80319c:	41 57                	push   %r15
+  80319e:	41 56                	push   %r14
+  8031a0:	41 55                	push   %r13
+  8031a2:	41 54                	push   %r12
+  8031a4:	53                   	push   %rbx
+  8031a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8031a9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8031ac:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8031b0:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8031b7:	00 00 00 
+  8031ba:	ff d0                	call   *%rax
+  8031bc:	89 c3                	mov    %eax,%ebx
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	0f 88 b8 00 00 00    	js     80327e <dup+0xe6>
+    close(newfdnum);
+  8031c6:	44 89 e7             	mov    %r12d,%edi
+  8031c9:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8031d5:	4d 63 ec             	movslq %r12d,%r13
+  8031d8:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8031df:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8031e3:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8031e7:	4c 89 ff             	mov    %r15,%rdi
+  8031ea:	49 be 5c 2f 80 00 00 	movabs $0x802f5c,%r14
+  8031f1:	00 00 00 
+  8031f4:	41 ff d6             	call   *%r14
+  8031f7:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8031fa:	4c 89 ef             	mov    %r13,%rdi
+  8031fd:	41 ff d6             	call   *%r14
+  803200:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803203:	48 89 df             	mov    %rbx,%rdi
+  803206:	48 b8 78 44 80 00 00 	movabs $0x804478,%rax
+  80320d:	00 00 00 
+  803210:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803212:	a8 04                	test   $0x4,%al
+  803214:	74 2b                	je     803241 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803216:	41 89 c1             	mov    %eax,%r9d
+  803219:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80321f:	4c 89 f1             	mov    %r14,%rcx
+  803222:	ba 00 00 00 00       	mov    $0x0,%edx
+  803227:	48 89 de             	mov    %rbx,%rsi
+  80322a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322f:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  803236:	00 00 00 
+  803239:	ff d0                	call   *%rax
+  80323b:	89 c3                	mov    %eax,%ebx
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	78 4e                	js     80328f <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803241:	4c 89 ff             	mov    %r15,%rdi
+  803244:	48 b8 78 44 80 00 00 	movabs $0x804478,%rax
+  80324b:	00 00 00 
+  80324e:	ff d0                	call   *%rax
+  803250:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803253:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803259:	4c 89 e9             	mov    %r13,%rcx
+  80325c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803261:	4c 89 fe             	mov    %r15,%rsi
+  803264:	bf 00 00 00 00       	mov    $0x0,%edi
+  803269:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  803270:	00 00 00 
+  803273:	ff d0                	call   *%rax
+  803275:	89 c3                	mov    %eax,%ebx
+  803277:	85 c0                	test   %eax,%eax
+  803279:	78 14                	js     80328f <dup+0xf7>
+
+    return newfdnum;
+  80327b:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80327e:	89 d8                	mov    %ebx,%eax
+  803280:	48 83 c4 18          	add    $0x18,%rsp
+  803284:	5b                   	pop    %rbx
+  803285:	41 5c                	pop    %r12
+  803287:	41 5d                	pop    %r13
+  803289:	41 5e                	pop    %r14
+  80328b:	41 5f                	pop    %r15
+  80328d:	5d                   	pop    %rbp
+  80328e:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80328f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803294:	4c 89 ee             	mov    %r13,%rsi
+  803297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80329c:	49 bc c4 29 80 00 00 	movabs $0x8029c4,%r12
+  8032a3:	00 00 00 
+  8032a6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8032a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ae:	4c 89 f6             	mov    %r14,%rsi
+  8032b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b6:	41 ff d4             	call   *%r12
+    return res;
+  8032b9:	eb c3                	jmp    80327e <dup+0xe6>
+
+00000000008032bb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8032bb:	55                   	push   %rbp
+  8032bc:	48 89 e5             	mov    %rsp,%rbp
+  8032bf:	41 56                	push   %r14
+  8032c1:	41 55                	push   %r13
+  8032c3:	41 54                	push   %r12
+  8032c5:	53                   	push   %rbx
+  8032c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8032ca:	89 fb                	mov    %edi,%ebx
+  8032cc:	49 89 f4             	mov    %rsi,%r12
+  8032cf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032d6:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8032dd:	00 00 00 
+  8032e0:	ff d0                	call   *%rax
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	78 4c                	js     803332 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8032e6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8032ea:	41 8b 3e             	mov    (%r14),%edi
+  8032ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8032f1:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  8032f8:	00 00 00 
+  8032fb:	ff d0                	call   *%rax
+  8032fd:	85 c0                	test   %eax,%eax
+  8032ff:	78 35                	js     803336 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803301:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803305:	83 e0 03             	and    $0x3,%eax
+  803308:	83 f8 01             	cmp    $0x1,%eax
+  80330b:	74 2d                	je     80333a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80330d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803311:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803315:	48 85 c0             	test   %rax,%rax
+  803318:	74 56                	je     803370 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80331a:	4c 89 ea             	mov    %r13,%rdx
+  80331d:	4c 89 e6             	mov    %r12,%rsi
+  803320:	4c 89 f7             	mov    %r14,%rdi
+  803323:	ff d0                	call   *%rax
+}
+  803325:	48 83 c4 10          	add    $0x10,%rsp
+  803329:	5b                   	pop    %rbx
+  80332a:	41 5c                	pop    %r12
+  80332c:	41 5d                	pop    %r13
+  80332e:	41 5e                	pop    %r14
+  803330:	5d                   	pop    %rbp
+  803331:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803332:	48 98                	cltq
+  803334:	eb ef                	jmp    803325 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803336:	48 98                	cltq
+  803338:	eb eb                	jmp    803325 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80333a:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  803341:	00 00 00 
+  803344:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80334a:	89 da                	mov    %ebx,%edx
+  80334c:	48 bf b9 63 80 00 00 	movabs $0x8063b9,%rdi
+  803353:	00 00 00 
+  803356:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335b:	48 b9 50 18 80 00 00 	movabs $0x801850,%rcx
+  803362:	00 00 00 
+  803365:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803367:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80336e:	eb b5                	jmp    803325 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803370:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803377:	eb ac                	jmp    803325 <read+0x6a>
+
+0000000000803379 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803379:	55                   	push   %rbp
+  80337a:	48 89 e5             	mov    %rsp,%rbp
+  80337d:	41 57                	push   %r15
+  80337f:	41 56                	push   %r14
+  803381:	41 55                	push   %r13
+  803383:	41 54                	push   %r12
+  803385:	53                   	push   %rbx
+  803386:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80338a:	48 85 d2             	test   %rdx,%rdx
+  80338d:	74 54                	je     8033e3 <readn+0x6a>
+  80338f:	41 89 fd             	mov    %edi,%r13d
+  803392:	49 89 f6             	mov    %rsi,%r14
+  803395:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803398:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80339d:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8033a2:	49 bf bb 32 80 00 00 	movabs $0x8032bb,%r15
+  8033a9:	00 00 00 
+  8033ac:	4c 89 e2             	mov    %r12,%rdx
+  8033af:	48 29 f2             	sub    %rsi,%rdx
+  8033b2:	4c 01 f6             	add    %r14,%rsi
+  8033b5:	44 89 ef             	mov    %r13d,%edi
+  8033b8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	78 20                	js     8033df <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8033bf:	01 c3                	add    %eax,%ebx
+  8033c1:	85 c0                	test   %eax,%eax
+  8033c3:	74 08                	je     8033cd <readn+0x54>
+  8033c5:	48 63 f3             	movslq %ebx,%rsi
+  8033c8:	4c 39 e6             	cmp    %r12,%rsi
+  8033cb:	72 df                	jb     8033ac <readn+0x33>
+    }
+    return res;
+  8033cd:	48 63 c3             	movslq %ebx,%rax
+}
+  8033d0:	48 83 c4 08          	add    $0x8,%rsp
+  8033d4:	5b                   	pop    %rbx
+  8033d5:	41 5c                	pop    %r12
+  8033d7:	41 5d                	pop    %r13
+  8033d9:	41 5e                	pop    %r14
+  8033db:	41 5f                	pop    %r15
+  8033dd:	5d                   	pop    %rbp
+  8033de:	c3                   	ret
+        if (inc < 0) return inc;
+  8033df:	48 98                	cltq
+  8033e1:	eb ed                	jmp    8033d0 <readn+0x57>
+    int inc = 1, res = 0;
+  8033e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033e8:	eb e3                	jmp    8033cd <readn+0x54>
+
+00000000008033ea <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	41 56                	push   %r14
+  8033f0:	41 55                	push   %r13
+  8033f2:	41 54                	push   %r12
+  8033f4:	53                   	push   %rbx
+  8033f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8033f9:	89 fb                	mov    %edi,%ebx
+  8033fb:	49 89 f4             	mov    %rsi,%r12
+  8033fe:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803401:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803405:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  80340c:	00 00 00 
+  80340f:	ff d0                	call   *%rax
+  803411:	85 c0                	test   %eax,%eax
+  803413:	78 47                	js     80345c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803415:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803419:	41 8b 3e             	mov    (%r14),%edi
+  80341c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803420:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 30                	js     803460 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803430:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803435:	74 2d                	je     803464 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803437:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80343b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80343f:	48 85 c0             	test   %rax,%rax
+  803442:	74 56                	je     80349a <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803444:	4c 89 ea             	mov    %r13,%rdx
+  803447:	4c 89 e6             	mov    %r12,%rsi
+  80344a:	4c 89 f7             	mov    %r14,%rdi
+  80344d:	ff d0                	call   *%rax
+}
+  80344f:	48 83 c4 10          	add    $0x10,%rsp
+  803453:	5b                   	pop    %rbx
+  803454:	41 5c                	pop    %r12
+  803456:	41 5d                	pop    %r13
+  803458:	41 5e                	pop    %r14
+  80345a:	5d                   	pop    %rbp
+  80345b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80345c:	48 98                	cltq
+  80345e:	eb ef                	jmp    80344f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803460:	48 98                	cltq
+  803462:	eb eb                	jmp    80344f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803464:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  80346b:	00 00 00 
+  80346e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803474:	89 da                	mov    %ebx,%edx
+  803476:	48 bf d5 63 80 00 00 	movabs $0x8063d5,%rdi
+  80347d:	00 00 00 
+  803480:	b8 00 00 00 00       	mov    $0x0,%eax
+  803485:	48 b9 50 18 80 00 00 	movabs $0x801850,%rcx
+  80348c:	00 00 00 
+  80348f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803491:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803498:	eb b5                	jmp    80344f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80349a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034a1:	eb ac                	jmp    80344f <write+0x65>
+
+00000000008034a3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8034a3:	55                   	push   %rbp
+  8034a4:	48 89 e5             	mov    %rsp,%rbp
+  8034a7:	53                   	push   %rbx
+  8034a8:	48 83 ec 18          	sub    $0x18,%rsp
+  8034ac:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034ae:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8034b2:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8034b9:	00 00 00 
+  8034bc:	ff d0                	call   *%rax
+  8034be:	85 c0                	test   %eax,%eax
+  8034c0:	78 0c                	js     8034ce <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8034c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034c6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8034c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+
+00000000008034d4 <tell>:
+
+int tell(int fdnum) {
+  8034d4:	55                   	push   %rbp
+  8034d5:	48 89 e5             	mov    %rsp,%rbp
+  8034d8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034dc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034e0:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8034e7:	00 00 00 
+  8034ea:	ff d0                	call   *%rax
+  8034ec:	85 c0                	test   %eax,%eax
+  8034ee:	78 07                	js     8034f7 <tell+0x23>
+
+    return fd->fd_offset;
+  8034f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034f4:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8034f7:	c9                   	leave
+  8034f8:	c3                   	ret
+
+00000000008034f9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8034f9:	55                   	push   %rbp
+  8034fa:	48 89 e5             	mov    %rsp,%rbp
+  8034fd:	41 55                	push   %r13
+  8034ff:	41 54                	push   %r12
+  803501:	53                   	push   %rbx
+  803502:	48 83 ec 18          	sub    $0x18,%rsp
+  803506:	89 fb                	mov    %edi,%ebx
+  803508:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80350b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80350f:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  803516:	00 00 00 
+  803519:	ff d0                	call   *%rax
+  80351b:	85 c0                	test   %eax,%eax
+  80351d:	78 38                	js     803557 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80351f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803523:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803527:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80352b:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+  803537:	85 c0                	test   %eax,%eax
+  803539:	78 1c                	js     803557 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80353b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803540:	74 20                	je     803562 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803542:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803546:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80354a:	48 85 c0             	test   %rax,%rax
+  80354d:	74 47                	je     803596 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80354f:	44 89 e6             	mov    %r12d,%esi
+  803552:	4c 89 ef             	mov    %r13,%rdi
+  803555:	ff d0                	call   *%rax
+}
+  803557:	48 83 c4 18          	add    $0x18,%rsp
+  80355b:	5b                   	pop    %rbx
+  80355c:	41 5c                	pop    %r12
+  80355e:	41 5d                	pop    %r13
+  803560:	5d                   	pop    %rbp
+  803561:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803562:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  803569:	00 00 00 
+  80356c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803572:	89 da                	mov    %ebx,%edx
+  803574:	48 bf 98 63 80 00 00 	movabs $0x806398,%rdi
+  80357b:	00 00 00 
+  80357e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803583:	48 b9 50 18 80 00 00 	movabs $0x801850,%rcx
+  80358a:	00 00 00 
+  80358d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80358f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803594:	eb c1                	jmp    803557 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803596:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80359b:	eb ba                	jmp    803557 <ftruncate+0x5e>
+
+000000000080359d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80359d:	55                   	push   %rbp
+  80359e:	48 89 e5             	mov    %rsp,%rbp
+  8035a1:	41 54                	push   %r12
+  8035a3:	53                   	push   %rbx
+  8035a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8035a8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035ab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8035af:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8035b6:	00 00 00 
+  8035b9:	ff d0                	call   *%rax
+  8035bb:	85 c0                	test   %eax,%eax
+  8035bd:	78 63                	js     803622 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035bf:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8035c3:	41 8b 3c 24          	mov    (%r12),%edi
+  8035c7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8035cb:	48 b8 23 30 80 00 00 	movabs $0x803023,%rax
+  8035d2:	00 00 00 
+  8035d5:	ff d0                	call   *%rax
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	78 47                	js     803622 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8035db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035df:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8035e4:	74 45                	je     80362b <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8035e6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8035e9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8035f0:	00 00 00 
+    stat->st_isdir = 0;
+  8035f3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035fa:	00 00 00 
+    stat->st_ino = 0;
+  8035fd:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803604:	00 00 00 00 
+    stat->st_version = 0;
+  803608:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80360f:	00 00 00 
+    stat->st_dev = dev;
+  803612:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803619:	48 89 de             	mov    %rbx,%rsi
+  80361c:	4c 89 e7             	mov    %r12,%rdi
+  80361f:	ff 50 28             	call   *0x28(%rax)
+}
+  803622:	48 83 c4 10          	add    $0x10,%rsp
+  803626:	5b                   	pop    %rbx
+  803627:	41 5c                	pop    %r12
+  803629:	5d                   	pop    %rbp
+  80362a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80362b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803630:	eb f0                	jmp    803622 <fstat+0x85>
+
+0000000000803632 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803632:	55                   	push   %rbp
+  803633:	48 89 e5             	mov    %rsp,%rbp
+  803636:	41 54                	push   %r12
+  803638:	53                   	push   %rbx
+  803639:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80363c:	be 00 00 00 00       	mov    $0x0,%esi
+  803641:	48 b8 53 3b 80 00 00 	movabs $0x803b53,%rax
+  803648:	00 00 00 
+  80364b:	ff d0                	call   *%rax
+  80364d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80364f:	85 c0                	test   %eax,%eax
+  803651:	78 25                	js     803678 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803653:	4c 89 e6             	mov    %r12,%rsi
+  803656:	89 c7                	mov    %eax,%edi
+  803658:	48 b8 9d 35 80 00 00 	movabs $0x80359d,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+  803664:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803667:	89 df                	mov    %ebx,%edi
+  803669:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  803670:	00 00 00 
+  803673:	ff d0                	call   *%rax
+
+    return res;
+  803675:	44 89 e3             	mov    %r12d,%ebx
+}
+  803678:	89 d8                	mov    %ebx,%eax
+  80367a:	5b                   	pop    %rbx
+  80367b:	41 5c                	pop    %r12
+  80367d:	5d                   	pop    %rbp
+  80367e:	c3                   	ret
+
+000000000080367f <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80367f:	48 b8 00 a0 c0 01 00 	movabs $0x1c0a000,%rax
+  803686:	00 00 00 
+  803689:	83 38 00             	cmpl   $0x0,(%rax)
+  80368c:	74 0a                	je     803698 <fsipc_env+0x19>
+    return fsenv;
+}
+  80368e:	a1 00 a0 c0 01 00 00 	movabs 0x1c0a000,%eax
+  803695:	00 00 
+  803697:	c3                   	ret
+fsipc_env(void) {
+  803698:	55                   	push   %rbp
+  803699:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80369c:	bf 03 00 00 00       	mov    $0x3,%edi
+  8036a1:	48 b8 82 57 80 00 00 	movabs $0x805782,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+  8036ad:	a3 00 a0 c0 01 00 00 	movabs %eax,0x1c0a000
+  8036b4:	00 00 
+}
+  8036b6:	a1 00 a0 c0 01 00 00 	movabs 0x1c0a000,%eax
+  8036bd:	00 00 
+  8036bf:	5d                   	pop    %rbp
+  8036c0:	c3                   	ret
+
+00000000008036c1 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8036c1:	55                   	push   %rbp
+  8036c2:	48 89 e5             	mov    %rsp,%rbp
+  8036c5:	53                   	push   %rbx
+  8036c6:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8036ca:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8036d1:	00 
+  8036d2:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8036d9:	00 
+  8036da:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8036e1:	00 
+  8036e2:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8036e9:	00 
+  8036ea:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8036f1:	00 
+
+    assert(size <= sizeof(words));
+  8036f2:	48 83 fa 28          	cmp    $0x28,%rdx
+  8036f6:	77 38                	ja     803730 <fsipc_short+0x6f>
+  8036f8:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8036fa:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8036fe:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  803705:	00 00 00 
+  803708:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  80370a:	48 b8 7f 36 80 00 00 	movabs $0x80367f,%rax
+  803711:	00 00 00 
+  803714:	ff d0                	call   *%rax
+  803716:	89 c7                	mov    %eax,%edi
+  803718:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80371c:	89 de                	mov    %ebx,%esi
+  80371e:	48 b8 e5 56 80 00 00 	movabs $0x8056e5,%rax
+  803725:	00 00 00 
+  803728:	ff d0                	call   *%rax
+}
+  80372a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80372e:	c9                   	leave
+  80372f:	c3                   	ret
+    assert(size <= sizeof(words));
+  803730:	48 b9 20 64 80 00 00 	movabs $0x806420,%rcx
+  803737:	00 00 00 
+  80373a:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803741:	00 00 00 
+  803744:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803749:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803750:	00 00 00 
+  803753:	b8 00 00 00 00       	mov    $0x0,%eax
+  803758:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  80375f:	00 00 00 
+  803762:	41 ff d0             	call   *%r8
+
+0000000000803765 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803765:	55                   	push   %rbp
+  803766:	48 89 e5             	mov    %rsp,%rbp
+  803769:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80376d:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803770:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803773:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803776:	ba 08 00 00 00       	mov    $0x8,%edx
+  80377b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80377f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803784:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+}
+  803790:	c9                   	leave
+  803791:	c3                   	ret
+
+0000000000803792 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803792:	55                   	push   %rbp
+  803793:	48 89 e5             	mov    %rsp,%rbp
+  803796:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  80379a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80379d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  8037a0:	ba 04 00 00 00       	mov    $0x4,%edx
+  8037a5:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  8037a9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037ae:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  8037b5:	00 00 00 
+  8037b8:	ff d0                	call   *%rax
+}
+  8037ba:	c9                   	leave
+  8037bb:	c3                   	ret
+
+00000000008037bc <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8037bc:	55                   	push   %rbp
+  8037bd:	48 89 e5             	mov    %rsp,%rbp
+  8037c0:	41 54                	push   %r12
+  8037c2:	53                   	push   %rbx
+  8037c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8037c7:	89 fb                	mov    %edi,%ebx
+  8037c9:	49 89 f4             	mov    %rsi,%r12
+  8037cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8037d0:	48 b8 7f 36 80 00 00 	movabs $0x80367f,%rax
+  8037d7:	00 00 00 
+  8037da:	ff d0                	call   *%rax
+  8037dc:	89 c7                	mov    %eax,%edi
+  8037de:	6a 00                	push   $0x0
+  8037e0:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8037e4:	50                   	push   %rax
+  8037e5:	4d 89 e1             	mov    %r12,%r9
+  8037e8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8037ee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8037f3:	48 ba 00 90 c0 01 00 	movabs $0x1c09000,%rdx
+  8037fa:	00 00 00 
+  8037fd:	89 de                	mov    %ebx,%esi
+  8037ff:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  803806:	00 00 00 
+  803809:	ff d0                	call   *%rax
+}
+  80380b:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80380f:	5b                   	pop    %rbx
+  803810:	41 5c                	pop    %r12
+  803812:	5d                   	pop    %rbp
+  803813:	c3                   	ret
+
+0000000000803814 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803814:	55                   	push   %rbp
+  803815:	48 89 e5             	mov    %rsp,%rbp
+  803818:	41 54                	push   %r12
+  80381a:	53                   	push   %rbx
+  80381b:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80381e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803821:	a3 00 90 c0 01 00 00 	movabs %eax,0x1c09000
+  803828:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80382a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80382f:	be 00 00 00 00       	mov    $0x0,%esi
+  803834:	bf 05 00 00 00       	mov    $0x5,%edi
+  803839:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803845:	85 c0                	test   %eax,%eax
+  803847:	78 5a                	js     8038a3 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803849:	49 bc 00 90 c0 01 00 	movabs $0x1c09000,%r12
+  803850:	00 00 00 
+  803853:	4c 89 e6             	mov    %r12,%rsi
+  803856:	48 89 df             	mov    %rbx,%rdi
+  803859:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803865:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80386c:	00 
+  80386d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803873:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80387a:	00 
+  80387b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803881:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803888:	00 
+  803889:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803890:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803897:	00 
+  803898:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80389e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a3:	5b                   	pop    %rbx
+  8038a4:	41 5c                	pop    %r12
+  8038a6:	5d                   	pop    %rbp
+  8038a7:	c3                   	ret
+
+00000000008038a8 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8038a8:	55                   	push   %rbp
+  8038a9:	48 89 e5             	mov    %rsp,%rbp
+  8038ac:	41 57                	push   %r15
+  8038ae:	41 56                	push   %r14
+  8038b0:	41 55                	push   %r13
+  8038b2:	41 54                	push   %r12
+  8038b4:	53                   	push   %rbx
+  8038b5:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8038b9:	48 85 ff             	test   %rdi,%rdi
+  8038bc:	0f 84 a1 00 00 00    	je     803963 <devfile_read+0xbb>
+  8038c2:	49 89 ff             	mov    %rdi,%r15
+  8038c5:	49 89 f5             	mov    %rsi,%r13
+  8038c8:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8038cb:	48 85 f6             	test   %rsi,%rsi
+  8038ce:	0f 84 c4 00 00 00    	je     803998 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8038d4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8038db:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8038dc:	49 be 00 90 c0 01 00 	movabs $0x1c09000,%r14
+  8038e3:	00 00 00 
+  8038e6:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8038ea:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8038ed:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8038f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8038fb:	bf 03 00 00 00       	mov    $0x3,%edi
+  803900:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803907:	00 00 00 
+  80390a:	ff d0                	call   *%rax
+        if (res < 0) {
+  80390c:	85 c0                	test   %eax,%eax
+  80390e:	0f 88 b9 00 00 00    	js     8039cd <devfile_read+0x125>
+        assert(res <= n);
+  803914:	48 63 d8             	movslq %eax,%rbx
+  803917:	49 39 dc             	cmp    %rbx,%r12
+  80391a:	0f 82 b1 00 00 00    	jb     8039d1 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803920:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803925:	0f 87 db 00 00 00    	ja     803a06 <devfile_read+0x15e>
+        if (!res) {
+  80392b:	85 c0                	test   %eax,%eax
+  80392d:	74 21                	je     803950 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80392f:	48 89 da             	mov    %rbx,%rdx
+  803932:	4c 89 f6             	mov    %r14,%rsi
+  803935:	4c 89 ef             	mov    %r13,%rdi
+  803938:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  80393f:	00 00 00 
+  803942:	ff d0                	call   *%rax
+        total_read += res;
+  803944:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803948:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80394b:	49 29 dc             	sub    %rbx,%r12
+  80394e:	75 96                	jne    8038e6 <devfile_read+0x3e>
+    return total_read;
+  803950:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803954:	48 83 c4 18          	add    $0x18,%rsp
+  803958:	5b                   	pop    %rbx
+  803959:	41 5c                	pop    %r12
+  80395b:	41 5d                	pop    %r13
+  80395d:	41 5e                	pop    %r14
+  80395f:	41 5f                	pop    %r15
+  803961:	5d                   	pop    %rbp
+  803962:	c3                   	ret
+    assert(fd);
+  803963:	48 b9 56 64 80 00 00 	movabs $0x806456,%rcx
+  80396a:	00 00 00 
+  80396d:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803974:	00 00 00 
+  803977:	be 91 00 00 00       	mov    $0x91,%esi
+  80397c:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803983:	00 00 00 
+  803986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398b:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  803992:	00 00 00 
+  803995:	41 ff d0             	call   *%r8
+    assert(buf);
+  803998:	48 b9 59 64 80 00 00 	movabs $0x806459,%rcx
+  80399f:	00 00 00 
+  8039a2:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8039a9:	00 00 00 
+  8039ac:	be 92 00 00 00       	mov    $0x92,%esi
+  8039b1:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  8039b8:	00 00 00 
+  8039bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c0:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  8039c7:	00 00 00 
+  8039ca:	41 ff d0             	call   *%r8
+            return res;
+  8039cd:	48 98                	cltq
+  8039cf:	eb 83                	jmp    803954 <devfile_read+0xac>
+        assert(res <= n);
+  8039d1:	48 b9 5d 64 80 00 00 	movabs $0x80645d,%rcx
+  8039d8:	00 00 00 
+  8039db:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  8039e2:	00 00 00 
+  8039e5:	be 9e 00 00 00       	mov    $0x9e,%esi
+  8039ea:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  8039f1:	00 00 00 
+  8039f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f9:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  803a00:	00 00 00 
+  803a03:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803a06:	48 b9 68 64 80 00 00 	movabs $0x806468,%rcx
+  803a0d:	00 00 00 
+  803a10:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803a17:	00 00 00 
+  803a1a:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803a1f:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803a26:	00 00 00 
+  803a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2e:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  803a35:	00 00 00 
+  803a38:	41 ff d0             	call   *%r8
+
+0000000000803a3b <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803a3b:	55                   	push   %rbp
+  803a3c:	48 89 e5             	mov    %rsp,%rbp
+  803a3f:	41 57                	push   %r15
+  803a41:	41 56                	push   %r14
+  803a43:	41 55                	push   %r13
+  803a45:	41 54                	push   %r12
+  803a47:	53                   	push   %rbx
+  803a48:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803a4c:	48 85 ff             	test   %rdi,%rdi
+  803a4f:	0f 84 83 00 00 00    	je     803ad8 <devfile_write+0x9d>
+  803a55:	49 89 ff             	mov    %rdi,%r15
+  803a58:	49 89 f4             	mov    %rsi,%r12
+  803a5b:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803a5e:	48 85 f6             	test   %rsi,%rsi
+  803a61:	0f 84 a6 00 00 00    	je     803b0d <devfile_write+0xd2>
+    size_t total_written = 0;
+  803a67:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803a6d:	49 be 00 90 c0 01 00 	movabs $0x1c09000,%r14
+  803a74:	00 00 00 
+  803a77:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803a7b:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803a7e:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803a82:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803a87:	48 39 d3             	cmp    %rdx,%rbx
+  803a8a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803a8e:	4c 89 e6             	mov    %r12,%rsi
+  803a91:	48 bf 10 90 c0 01 00 	movabs $0x1c09010,%rdi
+  803a98:	00 00 00 
+  803a9b:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  803aa2:	00 00 00 
+  803aa5:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803aa7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aac:	be 00 00 00 00       	mov    $0x0,%esi
+  803ab1:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ab6:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803abd:	00 00 00 
+  803ac0:	ff d0                	call   *%rax
+        if (res < 0) {
+  803ac2:	85 c0                	test   %eax,%eax
+  803ac4:	78 7c                	js     803b42 <devfile_write+0x107>
+        total_written += res;
+  803ac6:	48 98                	cltq
+  803ac8:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803acb:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803ace:	48 29 c3             	sub    %rax,%rbx
+  803ad1:	75 a4                	jne    803a77 <devfile_write+0x3c>
+    return total_written;
+  803ad3:	4c 89 e8             	mov    %r13,%rax
+  803ad6:	eb 6c                	jmp    803b44 <devfile_write+0x109>
+    assert(fd);
+  803ad8:	48 b9 56 64 80 00 00 	movabs $0x806456,%rcx
+  803adf:	00 00 00 
+  803ae2:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803ae9:	00 00 00 
+  803aec:	be bd 00 00 00       	mov    $0xbd,%esi
+  803af1:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803af8:	00 00 00 
+  803afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b00:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  803b07:	00 00 00 
+  803b0a:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b0d:	48 b9 59 64 80 00 00 	movabs $0x806459,%rcx
+  803b14:	00 00 00 
+  803b17:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  803b1e:	00 00 00 
+  803b21:	be be 00 00 00       	mov    $0xbe,%esi
+  803b26:	48 bf 4b 64 80 00 00 	movabs $0x80644b,%rdi
+  803b2d:	00 00 00 
+  803b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b35:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  803b3c:	00 00 00 
+  803b3f:	41 ff d0             	call   *%r8
+            return res;
+  803b42:	48 98                	cltq
+}
+  803b44:	48 83 c4 08          	add    $0x8,%rsp
+  803b48:	5b                   	pop    %rbx
+  803b49:	41 5c                	pop    %r12
+  803b4b:	41 5d                	pop    %r13
+  803b4d:	41 5e                	pop    %r14
+  803b4f:	41 5f                	pop    %r15
+  803b51:	5d                   	pop    %rbp
+  803b52:	c3                   	ret
+
+0000000000803b53 <open>:
+open(const char *path, int mode) {
+  803b53:	55                   	push   %rbp
+  803b54:	48 89 e5             	mov    %rsp,%rbp
+  803b57:	41 55                	push   %r13
+  803b59:	41 54                	push   %r12
+  803b5b:	53                   	push   %rbx
+  803b5c:	48 83 ec 18          	sub    $0x18,%rsp
+  803b60:	49 89 fc             	mov    %rdi,%r12
+  803b63:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803b66:	48 b8 49 21 80 00 00 	movabs $0x802149,%rax
+  803b6d:	00 00 00 
+  803b70:	ff d0                	call   *%rax
+  803b72:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803b78:	0f 87 8f 00 00 00    	ja     803c0d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803b7e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b82:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+  803b8e:	89 c3                	mov    %eax,%ebx
+  803b90:	85 c0                	test   %eax,%eax
+  803b92:	78 55                	js     803be9 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803b94:	4c 89 e6             	mov    %r12,%rsi
+  803b97:	48 bb 00 90 c0 01 00 	movabs $0x1c09000,%rbx
+  803b9e:	00 00 00 
+  803ba1:	48 89 df             	mov    %rbx,%rdi
+  803ba4:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  803bab:	00 00 00 
+  803bae:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803bb0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bc0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bc5:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+  803bd1:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803bd3:	85 c0                	test   %eax,%eax
+  803bd5:	78 1f                	js     803bf6 <open+0xa3>
+    return fd2num(fd);
+  803bd7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bdb:	48 b8 4a 2f 80 00 00 	movabs $0x802f4a,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+  803be7:	89 c3                	mov    %eax,%ebx
+}
+  803be9:	89 d8                	mov    %ebx,%eax
+  803beb:	48 83 c4 18          	add    $0x18,%rsp
+  803bef:	5b                   	pop    %rbx
+  803bf0:	41 5c                	pop    %r12
+  803bf2:	41 5d                	pop    %r13
+  803bf4:	5d                   	pop    %rbp
+  803bf5:	c3                   	ret
+        fd_close(fd, 0);
+  803bf6:	be 00 00 00 00       	mov    $0x0,%esi
+  803bfb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bff:	48 b8 93 30 80 00 00 	movabs $0x803093,%rax
+  803c06:	00 00 00 
+  803c09:	ff d0                	call   *%rax
+        return res;
+  803c0b:	eb dc                	jmp    803be9 <open+0x96>
+        return -E_BAD_PATH;
+  803c0d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c12:	eb d5                	jmp    803be9 <open+0x96>
+
+0000000000803c14 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803c14:	55                   	push   %rbp
+  803c15:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803c18:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c1d:	be 00 00 00 00       	mov    $0x0,%esi
+  803c22:	bf 08 00 00 00       	mov    $0x8,%edi
+  803c27:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803c2e:	00 00 00 
+  803c31:	ff d0                	call   *%rax
+}
+  803c33:	5d                   	pop    %rbp
+  803c34:	c3                   	ret
+
+0000000000803c35 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	41 56                	push   %r14
+  803c3b:	41 55                	push   %r13
+  803c3d:	41 54                	push   %r12
+  803c3f:	53                   	push   %rbx
+  803c40:	48 83 ec 10          	sub    $0x10,%rsp
+  803c44:	41 89 f6             	mov    %esi,%r14d
+  803c47:	49 89 d4             	mov    %rdx,%r12
+  803c4a:	48 89 cb             	mov    %rcx,%rbx
+  803c4d:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803c50:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803c54:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c60:	85 c0                	test   %eax,%eax
+  803c62:	78 46                	js     803caa <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c64:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c68:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803c6f:	00 00 00 
+  803c72:	8b 00                	mov    (%rax),%eax
+  803c74:	39 02                	cmp    %eax,(%rdx)
+  803c76:	75 3f                	jne    803cb7 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803c78:	48 b8 00 90 c0 01 00 	movabs $0x1c09000,%rax
+  803c7f:	00 00 00 
+  803c82:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803c85:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803c87:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803c8b:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803c8f:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803c93:	48 89 da             	mov    %rbx,%rdx
+  803c96:	4c 89 e6             	mov    %r12,%rsi
+  803c99:	bf 09 00 00 00       	mov    $0x9,%edi
+  803c9e:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+}
+  803caa:	48 83 c4 10          	add    $0x10,%rsp
+  803cae:	5b                   	pop    %rbx
+  803caf:	41 5c                	pop    %r12
+  803cb1:	41 5d                	pop    %r13
+  803cb3:	41 5e                	pop    %r14
+  803cb5:	5d                   	pop    %rbp
+  803cb6:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803cb7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803cbc:	eb ec                	jmp    803caa <file_map+0x75>
+
+0000000000803cbe <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803cbe:	55                   	push   %rbp
+  803cbf:	48 89 e5             	mov    %rsp,%rbp
+  803cc2:	41 54                	push   %r12
+  803cc4:	53                   	push   %rbx
+  803cc5:	48 83 ec 20          	sub    $0x20,%rsp
+  803cc9:	41 89 f4             	mov    %esi,%r12d
+  803ccc:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803ccf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803cd3:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cdf:	85 c0                	test   %eax,%eax
+  803ce1:	78 3c                	js     803d1f <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ce3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ce7:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803cee:	00 00 00 
+  803cf1:	8b 0a                	mov    (%rdx),%ecx
+  803cf3:	39 08                	cmp    %ecx,(%rax)
+  803cf5:	75 31                	jne    803d28 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803cf7:	8b 40 0c             	mov    0xc(%rax),%eax
+  803cfa:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803cfd:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803d01:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803d05:	ba 10 00 00 00       	mov    $0x10,%edx
+  803d0a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d0e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803d13:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+}
+  803d1f:	48 83 c4 20          	add    $0x20,%rsp
+  803d23:	5b                   	pop    %rbx
+  803d24:	41 5c                	pop    %r12
+  803d26:	5d                   	pop    %rbp
+  803d27:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803d28:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d2d:	eb f0                	jmp    803d1f <file_msync+0x61>
+
+0000000000803d2f <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803d2f:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803d33:	7f 01                	jg     803d36 <writebuf+0x7>
+  803d35:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803d36:	55                   	push   %rbp
+  803d37:	48 89 e5             	mov    %rsp,%rbp
+  803d3a:	53                   	push   %rbx
+  803d3b:	48 83 ec 08          	sub    $0x8,%rsp
+  803d3f:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803d42:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803d46:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803d4a:	8b 3f                	mov    (%rdi),%edi
+  803d4c:	48 b8 ea 33 80 00 00 	movabs $0x8033ea,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803d58:	48 85 c0             	test   %rax,%rax
+  803d5b:	7e 04                	jle    803d61 <writebuf+0x32>
+  803d5d:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803d61:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803d65:	48 39 c2             	cmp    %rax,%rdx
+  803d68:	74 0f                	je     803d79 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803d6a:	48 85 c0             	test   %rax,%rax
+  803d6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d72:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803d76:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803d79:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d7d:	c9                   	leave
+  803d7e:	c3                   	ret
+
+0000000000803d7f <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803d7f:	8b 46 04             	mov    0x4(%rsi),%eax
+  803d82:	8d 50 01             	lea    0x1(%rax),%edx
+  803d85:	89 56 04             	mov    %edx,0x4(%rsi)
+  803d88:	48 98                	cltq
+  803d8a:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803d8f:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803d95:	74 01                	je     803d98 <putch+0x19>
+  803d97:	c3                   	ret
+putch(int ch, void *arg) {
+  803d98:	55                   	push   %rbp
+  803d99:	48 89 e5             	mov    %rsp,%rbp
+  803d9c:	53                   	push   %rbx
+  803d9d:	48 83 ec 08          	sub    $0x8,%rsp
+  803da1:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803da4:	48 89 f7             	mov    %rsi,%rdi
+  803da7:	48 b8 2f 3d 80 00 00 	movabs $0x803d2f,%rax
+  803dae:	00 00 00 
+  803db1:	ff d0                	call   *%rax
+        state->offset = 0;
+  803db3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803dba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803dbe:	c9                   	leave
+  803dbf:	c3                   	ret
+
+0000000000803dc0 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803dc0:	55                   	push   %rbp
+  803dc1:	48 89 e5             	mov    %rsp,%rbp
+  803dc4:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803dcb:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803dce:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803dd4:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803ddb:	00 00 00 
+    state.result = 0;
+  803dde:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803de5:	00 00 00 00 
+    state.error = 1;
+  803de9:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803df0:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803df3:	48 89 f2             	mov    %rsi,%rdx
+  803df6:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803dfd:	48 bf 7f 3d 80 00 00 	movabs $0x803d7f,%rdi
+  803e04:	00 00 00 
+  803e07:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803e13:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803e1a:	7f 14                	jg     803e30 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803e1c:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803e23:	48 85 c0             	test   %rax,%rax
+  803e26:	75 06                	jne    803e2e <vfprintf+0x6e>
+  803e28:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803e2e:	c9                   	leave
+  803e2f:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803e30:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803e37:	48 b8 2f 3d 80 00 00 	movabs $0x803d2f,%rax
+  803e3e:	00 00 00 
+  803e41:	ff d0                	call   *%rax
+  803e43:	eb d7                	jmp    803e1c <vfprintf+0x5c>
+
+0000000000803e45 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803e45:	55                   	push   %rbp
+  803e46:	48 89 e5             	mov    %rsp,%rbp
+  803e49:	48 83 ec 50          	sub    $0x50,%rsp
+  803e4d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803e51:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803e55:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803e59:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803e5d:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803e64:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803e68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e6c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803e70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803e74:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803e78:	48 b8 c0 3d 80 00 00 	movabs $0x803dc0,%rax
+  803e7f:	00 00 00 
+  803e82:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803e84:	c9                   	leave
+  803e85:	c3                   	ret
+
+0000000000803e86 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803e86:	55                   	push   %rbp
+  803e87:	48 89 e5             	mov    %rsp,%rbp
+  803e8a:	48 83 ec 50          	sub    $0x50,%rsp
+  803e8e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803e92:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803e96:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803e9a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803e9e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803ea2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803ea9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ead:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803eb1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803eb5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803eb9:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803ebd:	48 89 fe             	mov    %rdi,%rsi
+  803ec0:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ec5:	48 b8 c0 3d 80 00 00 	movabs $0x803dc0,%rax
+  803ecc:	00 00 00 
+  803ecf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ed1:	c9                   	leave
+  803ed2:	c3                   	ret
+
+0000000000803ed3 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803ed3:	55                   	push   %rbp
+  803ed4:	48 89 e5             	mov    %rsp,%rbp
+  803ed7:	41 54                	push   %r12
+  803ed9:	53                   	push   %rbx
+  803eda:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803edd:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  803ee4:	00 00 00 
+  803ee7:	ff d0                	call   *%rax
+  803ee9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803eec:	48 be 90 64 80 00 00 	movabs $0x806490,%rsi
+  803ef3:	00 00 00 
+  803ef6:	48 89 df             	mov    %rbx,%rdi
+  803ef9:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  803f00:	00 00 00 
+  803f03:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f05:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f0a:	41 2b 04 24          	sub    (%r12),%eax
+  803f0e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f14:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f1b:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f1e:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803f25:	00 00 00 
+  803f28:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f34:	5b                   	pop    %rbx
+  803f35:	41 5c                	pop    %r12
+  803f37:	5d                   	pop    %rbp
+  803f38:	c3                   	ret
+
+0000000000803f39 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803f39:	55                   	push   %rbp
+  803f3a:	48 89 e5             	mov    %rsp,%rbp
+  803f3d:	41 54                	push   %r12
+  803f3f:	53                   	push   %rbx
+  803f40:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803f43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f48:	48 89 fe             	mov    %rdi,%rsi
+  803f4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f50:	49 bc c4 29 80 00 00 	movabs $0x8029c4,%r12
+  803f57:	00 00 00 
+  803f5a:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803f5d:	48 89 df             	mov    %rbx,%rdi
+  803f60:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  803f67:	00 00 00 
+  803f6a:	ff d0                	call   *%rax
+  803f6c:	48 89 c6             	mov    %rax,%rsi
+  803f6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f79:	41 ff d4             	call   *%r12
+}
+  803f7c:	5b                   	pop    %rbx
+  803f7d:	41 5c                	pop    %r12
+  803f7f:	5d                   	pop    %rbp
+  803f80:	c3                   	ret
+
+0000000000803f81 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f81:	55                   	push   %rbp
+  803f82:	48 89 e5             	mov    %rsp,%rbp
+  803f85:	41 57                	push   %r15
+  803f87:	41 56                	push   %r14
+  803f89:	41 55                	push   %r13
+  803f8b:	41 54                	push   %r12
+  803f8d:	53                   	push   %rbx
+  803f8e:	48 83 ec 18          	sub    $0x18,%rsp
+  803f92:	49 89 fc             	mov    %rdi,%r12
+  803f95:	49 89 f5             	mov    %rsi,%r13
+  803f98:	49 89 d7             	mov    %rdx,%r15
+  803f9b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f9f:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  803fa6:	00 00 00 
+  803fa9:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803fab:	4d 85 ff             	test   %r15,%r15
+  803fae:	0f 84 af 00 00 00    	je     804063 <devpipe_write+0xe2>
+  803fb4:	48 89 c3             	mov    %rax,%rbx
+  803fb7:	4c 89 f8             	mov    %r15,%rax
+  803fba:	4d 89 ef             	mov    %r13,%r15
+  803fbd:	4c 01 e8             	add    %r13,%rax
+  803fc0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fc4:	49 bd ba 28 80 00 00 	movabs $0x8028ba,%r13
+  803fcb:	00 00 00 
+            sys_yield();
+  803fce:	49 be 4b 28 80 00 00 	movabs $0x80284b,%r14
+  803fd5:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803fd8:	8b 73 04             	mov    0x4(%rbx),%esi
+  803fdb:	48 63 ce             	movslq %esi,%rcx
+  803fde:	48 63 03             	movslq (%rbx),%rax
+  803fe1:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803fe7:	48 39 c1             	cmp    %rax,%rcx
+  803fea:	72 2e                	jb     80401a <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ff1:	48 89 da             	mov    %rbx,%rdx
+  803ff4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ff9:	4c 89 e7             	mov    %r12,%rdi
+  803ffc:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803fff:	85 c0                	test   %eax,%eax
+  804001:	74 66                	je     804069 <devpipe_write+0xe8>
+            sys_yield();
+  804003:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804006:	8b 73 04             	mov    0x4(%rbx),%esi
+  804009:	48 63 ce             	movslq %esi,%rcx
+  80400c:	48 63 03             	movslq (%rbx),%rax
+  80400f:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804015:	48 39 c1             	cmp    %rax,%rcx
+  804018:	73 d2                	jae    803fec <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80401a:	41 0f b6 3f          	movzbl (%r15),%edi
+  80401e:	48 89 ca             	mov    %rcx,%rdx
+  804021:	48 c1 ea 03          	shr    $0x3,%rdx
+  804025:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80402c:	08 10 20 
+  80402f:	48 f7 e2             	mul    %rdx
+  804032:	48 c1 ea 06          	shr    $0x6,%rdx
+  804036:	48 89 d0             	mov    %rdx,%rax
+  804039:	48 c1 e0 09          	shl    $0x9,%rax
+  80403d:	48 29 d0             	sub    %rdx,%rax
+  804040:	48 c1 e0 03          	shl    $0x3,%rax
+  804044:	48 29 c1             	sub    %rax,%rcx
+  804047:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80404c:	83 c6 01             	add    $0x1,%esi
+  80404f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804052:	49 83 c7 01          	add    $0x1,%r15
+  804056:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405a:	49 39 c7             	cmp    %rax,%r15
+  80405d:	0f 85 75 ff ff ff    	jne    803fd8 <devpipe_write+0x57>
+    return n;
+  804063:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804067:	eb 05                	jmp    80406e <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804069:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80406e:	48 83 c4 18          	add    $0x18,%rsp
+  804072:	5b                   	pop    %rbx
+  804073:	41 5c                	pop    %r12
+  804075:	41 5d                	pop    %r13
+  804077:	41 5e                	pop    %r14
+  804079:	41 5f                	pop    %r15
+  80407b:	5d                   	pop    %rbp
+  80407c:	c3                   	ret
+
+000000000080407d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80407d:	55                   	push   %rbp
+  80407e:	48 89 e5             	mov    %rsp,%rbp
+  804081:	41 57                	push   %r15
+  804083:	41 56                	push   %r14
+  804085:	41 55                	push   %r13
+  804087:	41 54                	push   %r12
+  804089:	53                   	push   %rbx
+  80408a:	48 83 ec 18          	sub    $0x18,%rsp
+  80408e:	49 89 fc             	mov    %rdi,%r12
+  804091:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804095:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804099:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  8040a0:	00 00 00 
+  8040a3:	ff d0                	call   *%rax
+  8040a5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8040a8:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040ae:	49 bd ba 28 80 00 00 	movabs $0x8028ba,%r13
+  8040b5:	00 00 00 
+            sys_yield();
+  8040b8:	49 be 4b 28 80 00 00 	movabs $0x80284b,%r14
+  8040bf:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8040c2:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8040c7:	74 7d                	je     804146 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8040c9:	8b 03                	mov    (%rbx),%eax
+  8040cb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8040ce:	75 26                	jne    8040f6 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8040d0:	4d 85 ff             	test   %r15,%r15
+  8040d3:	75 77                	jne    80414c <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040d5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040da:	48 89 da             	mov    %rbx,%rdx
+  8040dd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040e2:	4c 89 e7             	mov    %r12,%rdi
+  8040e5:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8040e8:	85 c0                	test   %eax,%eax
+  8040ea:	74 72                	je     80415e <devpipe_read+0xe1>
+            sys_yield();
+  8040ec:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8040ef:	8b 03                	mov    (%rbx),%eax
+  8040f1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8040f4:	74 df                	je     8040d5 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8040f6:	48 63 c8             	movslq %eax,%rcx
+  8040f9:	48 89 ca             	mov    %rcx,%rdx
+  8040fc:	48 c1 ea 03          	shr    $0x3,%rdx
+  804100:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804107:	08 10 20 
+  80410a:	48 89 d0             	mov    %rdx,%rax
+  80410d:	48 f7 e6             	mul    %rsi
+  804110:	48 c1 ea 06          	shr    $0x6,%rdx
+  804114:	48 89 d0             	mov    %rdx,%rax
+  804117:	48 c1 e0 09          	shl    $0x9,%rax
+  80411b:	48 29 d0             	sub    %rdx,%rax
+  80411e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804125:	00 
+  804126:	48 89 c8             	mov    %rcx,%rax
+  804129:	48 29 d0             	sub    %rdx,%rax
+  80412c:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804131:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804135:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804139:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80413c:	49 83 c7 01          	add    $0x1,%r15
+  804140:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804144:	75 83                	jne    8040c9 <devpipe_read+0x4c>
+    return n;
+  804146:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80414a:	eb 03                	jmp    80414f <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80414c:	4c 89 f8             	mov    %r15,%rax
+}
+  80414f:	48 83 c4 18          	add    $0x18,%rsp
+  804153:	5b                   	pop    %rbx
+  804154:	41 5c                	pop    %r12
+  804156:	41 5d                	pop    %r13
+  804158:	41 5e                	pop    %r14
+  80415a:	41 5f                	pop    %r15
+  80415c:	5d                   	pop    %rbp
+  80415d:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80415e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804163:	eb ea                	jmp    80414f <devpipe_read+0xd2>
+
+0000000000804165 <pipe>:
+pipe(int pfd[2]) {
+  804165:	55                   	push   %rbp
+  804166:	48 89 e5             	mov    %rsp,%rbp
+  804169:	41 55                	push   %r13
+  80416b:	41 54                	push   %r12
+  80416d:	53                   	push   %rbx
+  80416e:	48 83 ec 18          	sub    $0x18,%rsp
+  804172:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804175:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804179:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804180:	00 00 00 
+  804183:	ff d0                	call   *%rax
+  804185:	89 c3                	mov    %eax,%ebx
+  804187:	85 c0                	test   %eax,%eax
+  804189:	0f 88 a0 01 00 00    	js     80432f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80418f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804194:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804199:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80419d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041a2:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  8041a9:	00 00 00 
+  8041ac:	ff d0                	call   *%rax
+  8041ae:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8041b0:	85 c0                	test   %eax,%eax
+  8041b2:	0f 88 77 01 00 00    	js     80432f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8041b8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8041bc:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8041c3:	00 00 00 
+  8041c6:	ff d0                	call   *%rax
+  8041c8:	89 c3                	mov    %eax,%ebx
+  8041ca:	85 c0                	test   %eax,%eax
+  8041cc:	0f 88 43 01 00 00    	js     804315 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8041d2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041dc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8041e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041e5:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  8041ec:	00 00 00 
+  8041ef:	ff d0                	call   *%rax
+  8041f1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8041f3:	85 c0                	test   %eax,%eax
+  8041f5:	0f 88 1a 01 00 00    	js     804315 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8041fb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8041ff:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  804206:	00 00 00 
+  804209:	ff d0                	call   *%rax
+  80420b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80420e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804213:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804218:	48 89 c6             	mov    %rax,%rsi
+  80421b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804220:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  804227:	00 00 00 
+  80422a:	ff d0                	call   *%rax
+  80422c:	89 c3                	mov    %eax,%ebx
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	0f 88 c5 00 00 00    	js     8042fb <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804236:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80423a:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  804241:	00 00 00 
+  804244:	ff d0                	call   *%rax
+  804246:	48 89 c1             	mov    %rax,%rcx
+  804249:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80424f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80425a:	4c 89 ee             	mov    %r13,%rsi
+  80425d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804262:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  804269:	00 00 00 
+  80426c:	ff d0                	call   *%rax
+  80426e:	89 c3                	mov    %eax,%ebx
+  804270:	85 c0                	test   %eax,%eax
+  804272:	78 6e                	js     8042e2 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804274:	be 00 10 00 00       	mov    $0x1000,%esi
+  804279:	4c 89 ef             	mov    %r13,%rdi
+  80427c:	48 b8 82 28 80 00 00 	movabs $0x802882,%rax
+  804283:	00 00 00 
+  804286:	ff d0                	call   *%rax
+  804288:	83 f8 02             	cmp    $0x2,%eax
+  80428b:	0f 85 ab 00 00 00    	jne    80433c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804291:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804298:	00 00 
+  80429a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80429e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8042a0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8042a4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8042ab:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8042af:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8042b1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042b5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8042bc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8042c0:	48 bb 4a 2f 80 00 00 	movabs $0x802f4a,%rbx
+  8042c7:	00 00 00 
+  8042ca:	ff d3                	call   *%rbx
+  8042cc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8042d0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8042d4:	ff d3                	call   *%rbx
+  8042d6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8042db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8042e0:	eb 4d                	jmp    80432f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8042e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e7:	4c 89 ee             	mov    %r13,%rsi
+  8042ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ef:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8042fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804300:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804304:	bf 00 00 00 00       	mov    $0x0,%edi
+  804309:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804315:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80431a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80431e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804323:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  80432a:	00 00 00 
+  80432d:	ff d0                	call   *%rax
+}
+  80432f:	89 d8                	mov    %ebx,%eax
+  804331:	48 83 c4 18          	add    $0x18,%rsp
+  804335:	5b                   	pop    %rbx
+  804336:	41 5c                	pop    %r12
+  804338:	41 5d                	pop    %r13
+  80433a:	5d                   	pop    %rbp
+  80433b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80433c:	48 b9 a8 64 80 00 00 	movabs $0x8064a8,%rcx
+  804343:	00 00 00 
+  804346:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  80434d:	00 00 00 
+  804350:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804355:	48 bf 97 64 80 00 00 	movabs $0x806497,%rdi
+  80435c:	00 00 00 
+  80435f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804364:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  80436b:	00 00 00 
+  80436e:	41 ff d0             	call   *%r8
+
+0000000000804371 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804371:	55                   	push   %rbp
+  804372:	48 89 e5             	mov    %rsp,%rbp
+  804375:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804379:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80437d:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  804384:	00 00 00 
+  804387:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804389:	85 c0                	test   %eax,%eax
+  80438b:	78 35                	js     8043c2 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80438d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804391:	48 b8 5c 2f 80 00 00 	movabs $0x802f5c,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+  80439d:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043a0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043ae:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  8043b5:	00 00 00 
+  8043b8:	ff d0                	call   *%rax
+  8043ba:	85 c0                	test   %eax,%eax
+  8043bc:	0f 94 c0             	sete   %al
+  8043bf:	0f b6 c0             	movzbl %al,%eax
+}
+  8043c2:	c9                   	leave
+  8043c3:	c3                   	ret
+
+00000000008043c4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8043c4:	48 89 f8             	mov    %rdi,%rax
+  8043c7:	48 c1 e8 27          	shr    $0x27,%rax
+  8043cb:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8043d2:	01 00 00 
+  8043d5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043d9:	f6 c2 01             	test   $0x1,%dl
+  8043dc:	74 6d                	je     80444b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8043de:	48 89 f8             	mov    %rdi,%rax
+  8043e1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8043e5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8043ec:	01 00 00 
+  8043ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043f3:	f6 c2 01             	test   $0x1,%dl
+  8043f6:	74 62                	je     80445a <get_uvpt_entry+0x96>
+  8043f8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8043ff:	01 00 00 
+  804402:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804406:	f6 c2 80             	test   $0x80,%dl
+  804409:	75 4f                	jne    80445a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80440b:	48 89 f8             	mov    %rdi,%rax
+  80440e:	48 c1 e8 15          	shr    $0x15,%rax
+  804412:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804419:	01 00 00 
+  80441c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804420:	f6 c2 01             	test   $0x1,%dl
+  804423:	74 44                	je     804469 <get_uvpt_entry+0xa5>
+  804425:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80442c:	01 00 00 
+  80442f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804433:	f6 c2 80             	test   $0x80,%dl
+  804436:	75 31                	jne    804469 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804438:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80443c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804443:	01 00 00 
+  804446:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80444a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80444b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804452:	01 00 00 
+  804455:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804459:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80445a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804461:	01 00 00 
+  804464:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804468:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804469:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804470:	01 00 00 
+  804473:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804477:	c3                   	ret
+
+0000000000804478 <get_prot>:
+
+int
+get_prot(void *va) {
+  804478:	55                   	push   %rbp
+  804479:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80447c:	48 b8 c4 43 80 00 00 	movabs $0x8043c4,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+  804488:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80448b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804490:	89 c1                	mov    %eax,%ecx
+  804492:	83 c9 04             	or     $0x4,%ecx
+  804495:	f6 c2 01             	test   $0x1,%dl
+  804498:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80449b:	89 c1                	mov    %eax,%ecx
+  80449d:	83 c9 02             	or     $0x2,%ecx
+  8044a0:	f6 c2 02             	test   $0x2,%dl
+  8044a3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044a6:	89 c1                	mov    %eax,%ecx
+  8044a8:	83 c9 01             	or     $0x1,%ecx
+  8044ab:	48 85 d2             	test   %rdx,%rdx
+  8044ae:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8044b1:	89 c1                	mov    %eax,%ecx
+  8044b3:	83 c9 40             	or     $0x40,%ecx
+  8044b6:	f6 c6 04             	test   $0x4,%dh
+  8044b9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8044bc:	5d                   	pop    %rbp
+  8044bd:	c3                   	ret
+
+00000000008044be <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8044be:	55                   	push   %rbp
+  8044bf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044c2:	48 b8 c4 43 80 00 00 	movabs $0x8043c4,%rax
+  8044c9:	00 00 00 
+  8044cc:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8044ce:	48 c1 e8 06          	shr    $0x6,%rax
+  8044d2:	83 e0 01             	and    $0x1,%eax
+}
+  8044d5:	5d                   	pop    %rbp
+  8044d6:	c3                   	ret
+
+00000000008044d7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8044d7:	55                   	push   %rbp
+  8044d8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8044db:	48 b8 c4 43 80 00 00 	movabs $0x8043c4,%rax
+  8044e2:	00 00 00 
+  8044e5:	ff d0                	call   *%rax
+  8044e7:	83 e0 01             	and    $0x1,%eax
+}
+  8044ea:	5d                   	pop    %rbp
+  8044eb:	c3                   	ret
+
+00000000008044ec <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8044ec:	55                   	push   %rbp
+  8044ed:	48 89 e5             	mov    %rsp,%rbp
+  8044f0:	41 57                	push   %r15
+  8044f2:	41 56                	push   %r14
+  8044f4:	41 55                	push   %r13
+  8044f6:	41 54                	push   %r12
+  8044f8:	53                   	push   %rbx
+  8044f9:	48 83 ec 28          	sub    $0x28,%rsp
+  8044fd:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804501:	48 85 ff             	test   %rdi,%rdi
+  804504:	74 1e                	je     804524 <foreach_shared_region+0x38>
+  804506:	49 89 ff             	mov    %rdi,%r15
+  804509:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  80450f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804515:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80451c:	01 00 00 
+  80451f:	e9 72 02 00 00       	jmp    804796 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804524:	48 b9 cc 64 80 00 00 	movabs $0x8064cc,%rcx
+  80452b:	00 00 00 
+  80452e:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  804535:	00 00 00 
+  804538:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80453d:	48 bf d0 64 80 00 00 	movabs $0x8064d0,%rdi
+  804544:	00 00 00 
+  804547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80454c:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  804553:	00 00 00 
+  804556:	41 ff d0             	call   *%r8
+  804559:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804560:	eb 6c                	jmp    8045ce <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804562:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804569:	ff ff ff 
+  80456c:	4c 21 e2             	and    %r12,%rdx
+  80456f:	48 89 d8             	mov    %rbx,%rax
+  804572:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804577:	48 83 c0 01          	add    $0x1,%rax
+  80457b:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80457f:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804586:	00 00 00 
+  804589:	48 21 c8             	and    %rcx,%rax
+  80458c:	48 09 d0             	or     %rdx,%rax
+  80458f:	49 89 c4             	mov    %rax,%r12
+  804592:	eb 30                	jmp    8045c4 <foreach_shared_region+0xd8>
+  804594:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80459b:	ff ff ff 
+  80459e:	4c 21 e2             	and    %r12,%rdx
+  8045a1:	48 89 d8             	mov    %rbx,%rax
+  8045a4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8045a9:	48 83 c0 01          	add    $0x1,%rax
+  8045ad:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8045b1:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8045b8:	00 00 00 
+  8045bb:	48 21 c8             	and    %rcx,%rax
+  8045be:	48 09 d0             	or     %rdx,%rax
+  8045c1:	49 89 c4             	mov    %rax,%r12
+  8045c4:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8045c8:	0f 84 99 01 00 00    	je     804767 <foreach_shared_region+0x27b>
+  8045ce:	4c 89 e3             	mov    %r12,%rbx
+  8045d1:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8045d5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8045dc:	01 00 00 
+  8045df:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8045e3:	a8 01                	test   $0x1,%al
+  8045e5:	0f 84 77 ff ff ff    	je     804562 <foreach_shared_region+0x76>
+  8045eb:	a8 80                	test   $0x80,%al
+  8045ed:	74 19                	je     804608 <foreach_shared_region+0x11c>
+  8045ef:	f6 c4 04             	test   $0x4,%ah
+  8045f2:	74 a0                	je     804594 <foreach_shared_region+0xa8>
+  8045f4:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8045fb:	40 
+  8045fc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804600:	4c 89 e7             	mov    %r12,%rdi
+  804603:	41 ff d7             	call   *%r15
+  804606:	eb 8c                	jmp    804594 <foreach_shared_region+0xa8>
+  804608:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  80460f:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804613:	eb 46                	jmp    80465b <foreach_shared_region+0x16f>
+  804615:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80461c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804622:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804626:	48 c1 e0 15          	shl    $0x15,%rax
+  80462a:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80462f:	49 09 c4             	or     %rax,%r12
+  804632:	eb 1d                	jmp    804651 <foreach_shared_region+0x165>
+  804634:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80463b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804641:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804645:	48 c1 e0 15          	shl    $0x15,%rax
+  804649:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80464e:	49 09 c4             	or     %rax,%r12
+  804651:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804655:	0f 84 d3 00 00 00    	je     80472e <foreach_shared_region+0x242>
+  80465b:	4c 89 e3             	mov    %r12,%rbx
+  80465e:	48 c1 eb 15          	shr    $0x15,%rbx
+  804662:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804669:	01 00 00 
+  80466c:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804670:	a8 01                	test   $0x1,%al
+  804672:	74 a1                	je     804615 <foreach_shared_region+0x129>
+  804674:	a8 80                	test   $0x80,%al
+  804676:	74 19                	je     804691 <foreach_shared_region+0x1a5>
+  804678:	f6 c4 04             	test   $0x4,%ah
+  80467b:	74 b7                	je     804634 <foreach_shared_region+0x148>
+  80467d:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804684:	00 
+  804685:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804689:	4c 89 e7             	mov    %r12,%rdi
+  80468c:	41 ff d7             	call   *%r15
+  80468f:	eb a3                	jmp    804634 <foreach_shared_region+0x148>
+  804691:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804697:	eb 3b                	jmp    8046d4 <foreach_shared_region+0x1e8>
+  804699:	f6 c4 04             	test   $0x4,%ah
+  80469c:	74 12                	je     8046b0 <foreach_shared_region+0x1c4>
+  80469e:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8046a5:	00 
+  8046a6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046aa:	4c 89 e7             	mov    %r12,%rdi
+  8046ad:	41 ff d7             	call   *%r15
+  8046b0:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8046b7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046bd:	48 83 c3 01          	add    $0x1,%rbx
+  8046c1:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8046c5:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8046cb:	49 09 dc             	or     %rbx,%r12
+  8046ce:	41 83 ed 01          	sub    $0x1,%r13d
+  8046d2:	74 2f                	je     804703 <foreach_shared_region+0x217>
+  8046d4:	4c 89 e3             	mov    %r12,%rbx
+  8046d7:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8046db:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8046df:	a8 01                	test   $0x1,%al
+  8046e1:	75 b6                	jne    804699 <foreach_shared_region+0x1ad>
+  8046e3:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8046ea:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8046f0:	48 83 c3 01          	add    $0x1,%rbx
+  8046f4:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8046f8:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8046fe:	49 09 dc             	or     %rbx,%r12
+  804701:	eb cb                	jmp    8046ce <foreach_shared_region+0x1e2>
+  804703:	4c 89 e0             	mov    %r12,%rax
+  804706:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  80470c:	49 c1 ec 15          	shr    $0x15,%r12
+  804710:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804717:	49 83 c4 01          	add    $0x1,%r12
+  80471b:	49 c1 e4 15          	shl    $0x15,%r12
+  80471f:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804726:	49 09 c4             	or     %rax,%r12
+  804729:	e9 23 ff ff ff       	jmp    804651 <foreach_shared_region+0x165>
+  80472e:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804732:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804739:	ff ff ff 
+  80473c:	4c 21 e0             	and    %r12,%rax
+  80473f:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804743:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80474a:	49 83 c4 01          	add    $0x1,%r12
+  80474e:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804752:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804759:	00 00 00 
+  80475c:	49 21 d4             	and    %rdx,%r12
+  80475f:	49 09 c4             	or     %rax,%r12
+  804762:	e9 5d fe ff ff       	jmp    8045c4 <foreach_shared_region+0xd8>
+  804767:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80476e:	00 ff ff 
+  804771:	4c 21 e0             	and    %r12,%rax
+  804774:	49 c1 ec 27          	shr    $0x27,%r12
+  804778:	49 83 c4 01          	add    $0x1,%r12
+  80477c:	49 c1 e4 27          	shl    $0x27,%r12
+  804780:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804787:	ff 00 00 
+  80478a:	49 21 d4             	and    %rdx,%r12
+  80478d:	49 09 c4             	or     %rax,%r12
+  804790:	41 83 ed 01          	sub    $0x1,%r13d
+  804794:	74 48                	je     8047de <foreach_shared_region+0x2f2>
+  804796:	4c 89 e0             	mov    %r12,%rax
+  804799:	48 c1 e8 27          	shr    $0x27,%rax
+  80479d:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  8047a4:	01 00 00 
+  8047a7:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  8047ab:	f6 c2 01             	test   $0x1,%dl
+  8047ae:	0f 85 a5 fd ff ff    	jne    804559 <foreach_shared_region+0x6d>
+  8047b4:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8047bb:	00 ff ff 
+  8047be:	4c 21 e2             	and    %r12,%rdx
+  8047c1:	48 83 c0 01          	add    $0x1,%rax
+  8047c5:	48 c1 e0 27          	shl    $0x27,%rax
+  8047c9:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8047d0:	ff 00 00 
+  8047d3:	48 21 c8             	and    %rcx,%rax
+  8047d6:	48 09 d0             	or     %rdx,%rax
+  8047d9:	49 89 c4             	mov    %rax,%r12
+  8047dc:	eb b2                	jmp    804790 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8047de:	4d 85 e4             	test   %r12,%r12
+  8047e1:	75 14                	jne    8047f7 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8047e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e8:	48 83 c4 28          	add    $0x28,%rsp
+  8047ec:	5b                   	pop    %rbx
+  8047ed:	41 5c                	pop    %r12
+  8047ef:	41 5d                	pop    %r13
+  8047f1:	41 5e                	pop    %r14
+  8047f3:	41 5f                	pop    %r15
+  8047f5:	5d                   	pop    %rbp
+  8047f6:	c3                   	ret
+    assert(addr == 0);
+  8047f7:	48 b9 db 64 80 00 00 	movabs $0x8064db,%rcx
+  8047fe:	00 00 00 
+  804801:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  804808:	00 00 00 
+  80480b:	be 67 00 00 00       	mov    $0x67,%esi
+  804810:	48 bf d0 64 80 00 00 	movabs $0x8064d0,%rdi
+  804817:	00 00 00 
+  80481a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481f:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  804826:	00 00 00 
+  804829:	41 ff d0             	call   *%r8
+
+000000000080482c <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80482c:	49 b8 20 a4 c0 01 00 	movabs $0x1c0a420,%r8
+  804833:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804836:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80483c:	eb 33                	jmp    804871 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80483e:	48 83 c0 20          	add    $0x20,%rax
+  804842:	4c 39 c0             	cmp    %r8,%rax
+  804845:	74 25                	je     80486c <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804847:	48 8b 10             	mov    (%rax),%rdx
+  80484a:	48 85 d2             	test   %rdx,%rdx
+  80484d:	74 ef                	je     80483e <mmap_place+0x12>
+  80484f:	48 89 d1             	mov    %rdx,%rcx
+  804852:	48 03 48 08          	add    0x8(%rax),%rcx
+  804856:	48 39 cf             	cmp    %rcx,%rdi
+  804859:	73 e3                	jae    80483e <mmap_place+0x12>
+  80485b:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80485f:	4c 39 ca             	cmp    %r9,%rdx
+  804862:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804866:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  80486a:	eb d2                	jmp    80483e <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  80486c:	45 84 d2             	test   %r10b,%r10b
+  80486f:	74 12                	je     804883 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804871:	48 b8 20 a0 c0 01 00 	movabs $0x1c0a020,%rax
+  804878:	00 00 00 
+        moved = 0;
+  80487b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804881:	eb c4                	jmp    804847 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804883:	48 01 fe             	add    %rdi,%rsi
+  804886:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  80488d:	00 00 00 
+  804890:	48 39 f0             	cmp    %rsi,%rax
+  804893:	b8 00 00 00 00       	mov    $0x0,%eax
+  804898:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  80489c:	c3                   	ret
+
+000000000080489d <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80489d:	55                   	push   %rbp
+  80489e:	48 89 e5             	mov    %rsp,%rbp
+  8048a1:	41 57                	push   %r15
+  8048a3:	41 56                	push   %r14
+  8048a5:	41 55                	push   %r13
+  8048a7:	41 54                	push   %r12
+  8048a9:	53                   	push   %rbx
+  8048aa:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8048ae:	48 8b 1f             	mov    (%rdi),%rbx
+  8048b1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8048b8:	48 b8 20 a0 c0 01 00 	movabs $0x1c0a020,%rax
+  8048bf:	00 00 00 
+  8048c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048c7:	eb 12                	jmp    8048db <mmap_pgfault+0x3e>
+  8048c9:	48 83 c2 01          	add    $0x1,%rdx
+  8048cd:	48 83 c0 20          	add    $0x20,%rax
+  8048d1:	48 83 fa 20          	cmp    $0x20,%rdx
+  8048d5:	0f 84 04 01 00 00    	je     8049df <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8048db:	48 8b 08             	mov    (%rax),%rcx
+  8048de:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8048e2:	48 39 de             	cmp    %rbx,%rsi
+  8048e5:	73 e2                	jae    8048c9 <mmap_pgfault+0x2c>
+  8048e7:	48 03 48 08          	add    0x8(%rax),%rcx
+  8048eb:	48 39 cb             	cmp    %rcx,%rbx
+  8048ee:	73 d9                	jae    8048c9 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8048f0:	48 c1 e2 05          	shl    $0x5,%rdx
+  8048f4:	48 b8 20 a0 c0 01 00 	movabs $0x1c0a020,%rax
+  8048fb:	00 00 00 
+  8048fe:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804902:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804906:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80490a:	f6 c2 01             	test   $0x1,%dl
+  80490d:	0f 84 e0 00 00 00    	je     8049f3 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804913:	b8 00 00 00 00       	mov    $0x0,%eax
+  804918:	f6 c2 02             	test   $0x2,%dl
+  80491b:	0f 84 c3 00 00 00    	je     8049e4 <mmap_pgfault+0x147>
+  804921:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804928:	ff ff ff 
+  80492b:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80492f:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804936:	00 00 00 
+  804939:	48 39 ca             	cmp    %rcx,%rdx
+  80493c:	0f 85 a2 00 00 00    	jne    8049e4 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804942:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804947:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80494c:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804953:	00 00 00 
+  804956:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495b:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  804962:	00 00 00 
+  804965:	ff d0                	call   *%rax
+  804967:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80496e:	85 d2                	test   %edx,%edx
+  804970:	78 72                	js     8049e4 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804972:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804977:	48 89 de             	mov    %rbx,%rsi
+  80497a:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804981:	00 00 00 
+  804984:	4c 89 e7             	mov    %r12,%rdi
+  804987:	48 b8 3e 25 80 00 00 	movabs $0x80253e,%rax
+  80498e:	00 00 00 
+  804991:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804993:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804999:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80499f:	48 89 d9             	mov    %rbx,%rcx
+  8049a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049a7:	4c 89 e6             	mov    %r12,%rsi
+  8049aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049af:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  8049b6:	00 00 00 
+  8049b9:	ff d0                	call   *%rax
+  8049bb:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8049bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049c2:	4c 89 e6             	mov    %r12,%rsi
+  8049c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ca:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  8049d1:	00 00 00 
+  8049d4:	ff d0                	call   *%rax
+    return res >= 0;
+  8049d6:	89 d8                	mov    %ebx,%eax
+  8049d8:	f7 d0                	not    %eax
+  8049da:	c1 e8 1f             	shr    $0x1f,%eax
+  8049dd:	eb 05                	jmp    8049e4 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8049df:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8049e4:	48 83 c4 18          	add    $0x18,%rsp
+  8049e8:	5b                   	pop    %rbx
+  8049e9:	41 5c                	pop    %r12
+  8049eb:	41 5d                	pop    %r13
+  8049ed:	41 5e                	pop    %r14
+  8049ef:	41 5f                	pop    %r15
+  8049f1:	5d                   	pop    %rbp
+  8049f2:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  8049f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049f7:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  8049fb:	4c 03 30             	add    (%rax),%r14
+  8049fe:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804a05:	49 39 c6             	cmp    %rax,%r14
+  804a08:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a0c:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804a13:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804a19:	49 bf d7 44 80 00 00 	movabs $0x8044d7,%r15
+  804a20:	00 00 00 
+  804a23:	4d 39 f4             	cmp    %r14,%r12
+  804a26:	73 1d                	jae    804a45 <mmap_pgfault+0x1a8>
+  804a28:	4c 89 e7             	mov    %r12,%rdi
+  804a2b:	41 ff d7             	call   *%r15
+  804a2e:	84 c0                	test   %al,%al
+  804a30:	75 13                	jne    804a45 <mmap_pgfault+0x1a8>
+  804a32:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804a39:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804a40:	4d 39 f4             	cmp    %r14,%r12
+  804a43:	72 e3                	jb     804a28 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804a45:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804a4b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a4f:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804a53:	74 2a                	je     804a7f <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804a55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a59:	89 de                	mov    %ebx,%esi
+  804a5b:	2b 30                	sub    (%rax),%esi
+  804a5d:	03 70 1c             	add    0x1c(%rax),%esi
+  804a60:	8b 78 18             	mov    0x18(%rax),%edi
+  804a63:	4c 89 e9             	mov    %r13,%rcx
+  804a66:	48 89 da             	mov    %rbx,%rdx
+  804a69:	48 b8 35 3c 80 00 00 	movabs $0x803c35,%rax
+  804a70:	00 00 00 
+  804a73:	ff d0                	call   *%rax
+    return res > 0;
+  804a75:	85 c0                	test   %eax,%eax
+  804a77:	0f 9f c0             	setg   %al
+  804a7a:	e9 65 ff ff ff       	jmp    8049e4 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804a7f:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804a83:	eb d0                	jmp    804a55 <mmap_pgfault+0x1b8>
+
+0000000000804a85 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804a85:	55                   	push   %rbp
+  804a86:	48 89 e5             	mov    %rsp,%rbp
+  804a89:	41 57                	push   %r15
+  804a8b:	41 56                	push   %r14
+  804a8d:	41 55                	push   %r13
+  804a8f:	41 54                	push   %r12
+  804a91:	53                   	push   %rbx
+  804a92:	48 83 ec 28          	sub    $0x28,%rsp
+  804a96:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804a9a:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804a9d:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804aa4:	ff ff ff 
+  804aa7:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab0:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804ab7:	00 00 00 
+  804aba:	48 39 ca             	cmp    %rcx,%rdx
+  804abd:	0f 85 e5 00 00 00    	jne    804ba8 <mmap_writeback+0x123>
+  804ac3:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804ac6:	4c 39 ee             	cmp    %r13,%rsi
+  804ac9:	0f 83 e8 00 00 00    	jae    804bb7 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804acf:	49 be d7 44 80 00 00 	movabs $0x8044d7,%r14
+  804ad6:	00 00 00 
+  804ad9:	49 bf be 44 80 00 00 	movabs $0x8044be,%r15
+  804ae0:	00 00 00 
+  804ae3:	eb 10                	jmp    804af5 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804ae5:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804aec:	4d 39 ec             	cmp    %r13,%r12
+  804aef:	0f 83 ae 00 00 00    	jae    804ba3 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804af5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804af9:	4c 89 e7             	mov    %r12,%rdi
+  804afc:	41 ff d6             	call   *%r14
+  804aff:	84 c0                	test   %al,%al
+  804b01:	74 e2                	je     804ae5 <mmap_writeback+0x60>
+  804b03:	4c 89 e7             	mov    %r12,%rdi
+  804b06:	41 ff d7             	call   *%r15
+  804b09:	84 c0                	test   %al,%al
+  804b0b:	74 d8                	je     804ae5 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804b0d:	4c 89 e3             	mov    %r12,%rbx
+  804b10:	4d 39 ec             	cmp    %r13,%r12
+  804b13:	73 20                	jae    804b35 <mmap_writeback+0xb0>
+  804b15:	48 89 df             	mov    %rbx,%rdi
+  804b18:	41 ff d6             	call   *%r14
+  804b1b:	84 c0                	test   %al,%al
+  804b1d:	74 16                	je     804b35 <mmap_writeback+0xb0>
+  804b1f:	48 89 df             	mov    %rbx,%rdi
+  804b22:	41 ff d7             	call   *%r15
+  804b25:	84 c0                	test   %al,%al
+  804b27:	74 0c                	je     804b35 <mmap_writeback+0xb0>
+  804b29:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804b30:	4c 39 eb             	cmp    %r13,%rbx
+  804b33:	72 e0                	jb     804b15 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804b35:	48 89 d9             	mov    %rbx,%rcx
+  804b38:	4c 29 e1             	sub    %r12,%rcx
+  804b3b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804b3f:	44 89 e6             	mov    %r12d,%esi
+  804b42:	2b 30                	sub    (%rax),%esi
+  804b44:	49 89 c4             	mov    %rax,%r12
+  804b47:	03 70 1c             	add    0x1c(%rax),%esi
+  804b4a:	8b 78 18             	mov    0x18(%rax),%edi
+  804b4d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804b51:	48 89 ca             	mov    %rcx,%rdx
+  804b54:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  804b5b:	00 00 00 
+  804b5e:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804b60:	85 c0                	test   %eax,%eax
+  804b62:	78 44                	js     804ba8 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804b64:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804b69:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804b6c:	41 89 c1             	mov    %eax,%r9d
+  804b6f:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804b76:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804b7a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b83:	48 89 ce             	mov    %rcx,%rsi
+  804b86:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b8b:	48 b8 59 29 80 00 00 	movabs $0x802959,%rax
+  804b92:	00 00 00 
+  804b95:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804b97:	85 c0                	test   %eax,%eax
+  804b99:	78 0d                	js     804ba8 <mmap_writeback+0x123>
+  804b9b:	49 89 dc             	mov    %rbx,%r12
+  804b9e:	e9 49 ff ff ff       	jmp    804aec <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ba8:	48 83 c4 28          	add    $0x28,%rsp
+  804bac:	5b                   	pop    %rbx
+  804bad:	41 5c                	pop    %r12
+  804baf:	41 5d                	pop    %r13
+  804bb1:	41 5e                	pop    %r14
+  804bb3:	41 5f                	pop    %r15
+  804bb5:	5d                   	pop    %rbp
+  804bb6:	c3                   	ret
+    return 0;
+  804bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bbc:	eb ea                	jmp    804ba8 <mmap_writeback+0x123>
+
+0000000000804bbe <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804bbe:	55                   	push   %rbp
+  804bbf:	48 89 e5             	mov    %rsp,%rbp
+  804bc2:	41 57                	push   %r15
+  804bc4:	41 56                	push   %r14
+  804bc6:	41 55                	push   %r13
+  804bc8:	41 54                	push   %r12
+  804bca:	53                   	push   %rbx
+  804bcb:	48 83 ec 38          	sub    $0x38,%rsp
+  804bcf:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804bd3:	48 85 f6             	test   %rsi,%rsi
+  804bd6:	0f 84 0c 02 00 00    	je     804de8 <mmap+0x22a>
+  804bdc:	49 89 ff             	mov    %rdi,%r15
+  804bdf:	49 89 f4             	mov    %rsi,%r12
+  804be2:	41 89 d5             	mov    %edx,%r13d
+  804be5:	41 89 ce             	mov    %ecx,%r14d
+  804be8:	44 89 cb             	mov    %r9d,%ebx
+  804beb:	45 85 c9             	test   %r9d,%r9d
+  804bee:	0f 88 f4 01 00 00    	js     804de8 <mmap+0x22a>
+  804bf4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804bfb:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804c02:	0f 85 e7 01 00 00    	jne    804def <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804c08:	83 e2 fd             	and    $0xfffffffd,%edx
+  804c0b:	83 fa 04             	cmp    $0x4,%edx
+  804c0e:	0f 85 db 01 00 00    	jne    804def <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804c14:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804c17:	83 fa 01             	cmp    $0x1,%edx
+  804c1a:	0f 87 cf 01 00 00    	ja     804def <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804c20:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804c24:	44 89 c7             	mov    %r8d,%edi
+  804c27:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  804c2e:	00 00 00 
+  804c31:	ff d0                	call   *%rax
+  804c33:	89 c2                	mov    %eax,%edx
+  804c35:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c3c:	85 d2                	test   %edx,%edx
+  804c3e:	0f 88 ab 01 00 00    	js     804def <mmap+0x231>
+  804c44:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c48:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804c4f:	00 00 00 
+  804c52:	8b 09                	mov    (%rcx),%ecx
+  804c54:	39 0a                	cmp    %ecx,(%rdx)
+  804c56:	0f 85 93 01 00 00    	jne    804def <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804c5c:	8b 52 08             	mov    0x8(%rdx),%edx
+  804c5f:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804c62:	83 fa 01             	cmp    $0x1,%edx
+  804c65:	0f 84 84 01 00 00    	je     804def <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804c6b:	41 83 fe 01          	cmp    $0x1,%r14d
+  804c6f:	74 42                	je     804cb3 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804c71:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804c78:	4c 89 e6             	mov    %r12,%rsi
+  804c7b:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804c82:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804c86:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804c8a:	4d 85 ff             	test   %r15,%r15
+  804c8d:	74 67                	je     804cf6 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804c8f:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804c96:	75 0f                	jne    804ca7 <mmap+0xe9>
+  804c98:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804c9f:	00 00 00 
+  804ca2:	49 39 c7             	cmp    %rax,%r15
+  804ca5:	77 1b                	ja     804cc2 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ca7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cae:	e9 3c 01 00 00       	jmp    804def <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804cb3:	41 f6 c5 02          	test   $0x2,%r13b
+  804cb7:	74 b8                	je     804c71 <mmap+0xb3>
+  804cb9:	85 d2                	test   %edx,%edx
+  804cbb:	75 b4                	jne    804c71 <mmap+0xb3>
+  804cbd:	e9 2d 01 00 00       	jmp    804def <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804cc2:	4c 89 ff             	mov    %r15,%rdi
+  804cc5:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  804ccc:	00 00 00 
+  804ccf:	ff d0                	call   *%rax
+  804cd1:	48 89 c2             	mov    %rax,%rdx
+  804cd4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804cdb:	49 39 d7             	cmp    %rdx,%r15
+  804cde:	0f 85 0b 01 00 00    	jne    804def <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804ce4:	48 b8 20 a0 c0 01 00 	movabs $0x1c0a020,%rax
+  804ceb:	00 00 00 
+  804cee:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804cf4:	eb 44                	jmp    804d3a <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804cf6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804cfa:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804d01:	00 00 00 
+  804d04:	48 b8 2c 48 80 00 00 	movabs $0x80482c,%rax
+  804d0b:	00 00 00 
+  804d0e:	ff d0                	call   *%rax
+  804d10:	48 89 c7             	mov    %rax,%rdi
+  804d13:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804d17:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804d1e:	48 85 ff             	test   %rdi,%rdi
+  804d21:	75 c1                	jne    804ce4 <mmap+0x126>
+  804d23:	e9 c7 00 00 00       	jmp    804def <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804d28:	49 83 c4 01          	add    $0x1,%r12
+  804d2c:	48 83 c0 20          	add    $0x20,%rax
+  804d30:	49 83 fc 20          	cmp    $0x20,%r12
+  804d34:	0f 84 a5 00 00 00    	je     804ddf <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804d3a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804d3e:	75 e8                	jne    804d28 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804d40:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804d44:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  804d4b:	00 00 00 
+  804d4e:	ff d0                	call   *%rax
+  804d50:	89 c2                	mov    %eax,%edx
+  804d52:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d59:	85 d2                	test   %edx,%edx
+  804d5b:	0f 88 8e 00 00 00    	js     804def <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804d61:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804d65:	48 b8 4a 2f 80 00 00 	movabs $0x802f4a,%rax
+  804d6c:	00 00 00 
+  804d6f:	ff d0                	call   *%rax
+  804d71:	89 c6                	mov    %eax,%esi
+  804d73:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804d76:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  804d7d:	00 00 00 
+  804d80:	ff d0                	call   *%rax
+  804d82:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804d85:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d8c:	45 85 ff             	test   %r15d,%r15d
+  804d8f:	78 5e                	js     804def <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804d91:	49 c1 e4 05          	shl    $0x5,%r12
+  804d95:	48 b8 20 a0 c0 01 00 	movabs $0x1c0a020,%rax
+  804d9c:	00 00 00 
+  804d9f:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804da2:	48 bf 9d 48 80 00 00 	movabs $0x80489d,%rdi
+  804da9:	00 00 00 
+  804dac:	48 b8 c8 52 80 00 00 	movabs $0x8052c8,%rax
+  804db3:	00 00 00 
+  804db6:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804db8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804dbc:	49 89 04 24          	mov    %rax,(%r12)
+  804dc0:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804dc4:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804dc9:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804dce:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804dd3:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804dd8:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804ddd:	eb 10                	jmp    804def <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804ddf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804de6:	eb 07                	jmp    804def <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804de8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804def:	48 83 c4 38          	add    $0x38,%rsp
+  804df3:	5b                   	pop    %rbx
+  804df4:	41 5c                	pop    %r12
+  804df6:	41 5d                	pop    %r13
+  804df8:	41 5e                	pop    %r14
+  804dfa:	41 5f                	pop    %r15
+  804dfc:	5d                   	pop    %rbp
+  804dfd:	c3                   	ret
+
+0000000000804dfe <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804dfe:	55                   	push   %rbp
+  804dff:	48 89 e5             	mov    %rsp,%rbp
+  804e02:	41 57                	push   %r15
+  804e04:	41 56                	push   %r14
+  804e06:	41 55                	push   %r13
+  804e08:	41 54                	push   %r12
+  804e0a:	53                   	push   %rbx
+  804e0b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804e0f:	49 89 fe             	mov    %rdi,%r14
+  804e12:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804e19:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804e20:	00 
+  804e21:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e28:	48 bb 20 a0 c0 01 00 	movabs $0x1c0a020,%rbx
+  804e2f:	00 00 00 
+  804e32:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804e39:	49 bf 85 4a 80 00 00 	movabs $0x804a85,%r15
+  804e40:	00 00 00 
+  804e43:	eb 09                	jmp    804e4e <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e45:	48 83 c3 20          	add    $0x20,%rbx
+  804e49:	4c 39 eb             	cmp    %r13,%rbx
+  804e4c:	74 33                	je     804e81 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804e4e:	48 89 df             	mov    %rbx,%rdi
+  804e51:	48 8b 33             	mov    (%rbx),%rsi
+  804e54:	4c 39 e6             	cmp    %r12,%rsi
+  804e57:	73 ec                	jae    804e45 <msync+0x47>
+  804e59:	48 85 f6             	test   %rsi,%rsi
+  804e5c:	74 e7                	je     804e45 <msync+0x47>
+  804e5e:	48 89 f2             	mov    %rsi,%rdx
+  804e61:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804e65:	49 39 d6             	cmp    %rdx,%r14
+  804e68:	73 db                	jae    804e45 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804e6a:	4c 39 e2             	cmp    %r12,%rdx
+  804e6d:	49 0f 47 d4          	cmova  %r12,%rdx
+  804e71:	4c 39 f6             	cmp    %r14,%rsi
+  804e74:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804e78:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804e7b:	85 c0                	test   %eax,%eax
+  804e7d:	79 c6                	jns    804e45 <msync+0x47>
+  804e7f:	eb 05                	jmp    804e86 <msync+0x88>
+    }
+
+    return 0;
+  804e81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e86:	48 83 c4 08          	add    $0x8,%rsp
+  804e8a:	5b                   	pop    %rbx
+  804e8b:	41 5c                	pop    %r12
+  804e8d:	41 5d                	pop    %r13
+  804e8f:	41 5e                	pop    %r14
+  804e91:	41 5f                	pop    %r15
+  804e93:	5d                   	pop    %rbp
+  804e94:	c3                   	ret
+
+0000000000804e95 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804e95:	55                   	push   %rbp
+  804e96:	48 89 e5             	mov    %rsp,%rbp
+  804e99:	41 57                	push   %r15
+  804e9b:	41 56                	push   %r14
+  804e9d:	41 55                	push   %r13
+  804e9f:	41 54                	push   %r12
+  804ea1:	53                   	push   %rbx
+  804ea2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804ea6:	49 89 ff             	mov    %rdi,%r15
+  804ea9:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804eb0:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804eb7:	00 
+  804eb8:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ebf:	48 bb 20 a0 c0 01 00 	movabs $0x1c0a020,%rbx
+  804ec6:	00 00 00 
+  804ec9:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804ed0:	48 89 d8             	mov    %rbx,%rax
+  804ed3:	eb 09                	jmp    804ede <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ed5:	48 83 c0 20          	add    $0x20,%rax
+  804ed9:	4c 39 f0             	cmp    %r14,%rax
+  804edc:	74 40                	je     804f1e <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804ede:	48 8b 10             	mov    (%rax),%rdx
+  804ee1:	4c 39 e2             	cmp    %r12,%rdx
+  804ee4:	73 ef                	jae    804ed5 <munmap+0x40>
+  804ee6:	48 85 d2             	test   %rdx,%rdx
+  804ee9:	74 ea                	je     804ed5 <munmap+0x40>
+  804eeb:	48 89 d7             	mov    %rdx,%rdi
+  804eee:	48 03 78 08          	add    0x8(%rax),%rdi
+  804ef2:	49 39 ff             	cmp    %rdi,%r15
+  804ef5:	73 de                	jae    804ed5 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804ef7:	49 39 fc             	cmp    %rdi,%r12
+  804efa:	72 05                	jb     804f01 <munmap+0x6c>
+  804efc:	4c 39 fa             	cmp    %r15,%rdx
+  804eff:	73 d4                	jae    804ed5 <munmap+0x40>
+  804f01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804f06:	48 83 c4 08          	add    $0x8,%rsp
+  804f0a:	5b                   	pop    %rbx
+  804f0b:	41 5c                	pop    %r12
+  804f0d:	41 5d                	pop    %r13
+  804f0f:	41 5e                	pop    %r14
+  804f11:	41 5f                	pop    %r15
+  804f13:	5d                   	pop    %rbp
+  804f14:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804f15:	48 83 c3 20          	add    $0x20,%rbx
+  804f19:	4c 39 f3             	cmp    %r14,%rbx
+  804f1c:	74 5c                	je     804f7a <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804f1e:	48 8b 33             	mov    (%rbx),%rsi
+  804f21:	4c 39 e6             	cmp    %r12,%rsi
+  804f24:	73 ef                	jae    804f15 <munmap+0x80>
+  804f26:	48 85 f6             	test   %rsi,%rsi
+  804f29:	74 ea                	je     804f15 <munmap+0x80>
+  804f2b:	48 89 f2             	mov    %rsi,%rdx
+  804f2e:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804f32:	49 39 d7             	cmp    %rdx,%r15
+  804f35:	73 de                	jae    804f15 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804f37:	48 89 df             	mov    %rbx,%rdi
+  804f3a:	48 b8 85 4a 80 00 00 	movabs $0x804a85,%rax
+  804f41:	00 00 00 
+  804f44:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f46:	85 c0                	test   %eax,%eax
+  804f48:	78 bc                	js     804f06 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804f4a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804f4e:	48 8b 33             	mov    (%rbx),%rsi
+  804f51:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f56:	48 b8 c4 29 80 00 00 	movabs $0x8029c4,%rax
+  804f5d:	00 00 00 
+  804f60:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804f62:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804f65:	48 b8 3d 31 80 00 00 	movabs $0x80313d,%rax
+  804f6c:	00 00 00 
+  804f6f:	ff d0                	call   *%rax
+        reg->start = 0;
+  804f71:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804f78:	eb 9b                	jmp    804f15 <munmap+0x80>
+    return 0;
+  804f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7f:	eb 85                	jmp    804f06 <munmap+0x71>
+
+0000000000804f81 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804f81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f86:	c3                   	ret
+
+0000000000804f87 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804f87:	55                   	push   %rbp
+  804f88:	48 89 e5             	mov    %rsp,%rbp
+  804f8b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804f8e:	48 be e5 64 80 00 00 	movabs $0x8064e5,%rsi
+  804f95:	00 00 00 
+  804f98:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  804f9f:	00 00 00 
+  804fa2:	ff d0                	call   *%rax
+    return 0;
+}
+  804fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa9:	5d                   	pop    %rbp
+  804faa:	c3                   	ret
+
+0000000000804fab <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804fab:	55                   	push   %rbp
+  804fac:	48 89 e5             	mov    %rsp,%rbp
+  804faf:	41 57                	push   %r15
+  804fb1:	41 56                	push   %r14
+  804fb3:	41 55                	push   %r13
+  804fb5:	41 54                	push   %r12
+  804fb7:	53                   	push   %rbx
+  804fb8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804fbf:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804fc6:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804fcd:	00 00 00 00 
+  804fd1:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804fd8:	00 00 00 00 
+  804fdc:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804fe3:	00 00 00 00 
+  804fe7:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804fee:	00 00 00 00 
+  804ff2:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804ff9:	00 00 00 00 
+  804ffd:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805004:	00 00 00 00 
+  805008:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  80500f:	00 
+  805010:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805017:	00 
+  805018:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  80501f:	00 
+  805020:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805027:	00 
+  805028:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80502f:	00 
+  805030:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805037:	00 
+  805038:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80503f:	00 
+  805040:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805047:	00 
+  805048:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80504f:	00 
+  805050:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805057:	00 
+    for (res = 0; res < n; res += inc) {
+  805058:	48 85 d2             	test   %rdx,%rdx
+  80505b:	74 7a                	je     8050d7 <devcons_write+0x12c>
+  80505d:	49 89 d6             	mov    %rdx,%r14
+  805060:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805066:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80506b:	49 bf d7 24 80 00 00 	movabs $0x8024d7,%r15
+  805072:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805075:	4c 89 f3             	mov    %r14,%rbx
+  805078:	48 29 f3             	sub    %rsi,%rbx
+  80507b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805080:	48 39 c3             	cmp    %rax,%rbx
+  805083:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805087:	4c 63 eb             	movslq %ebx,%r13
+  80508a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805091:	48 01 c6             	add    %rax,%rsi
+  805094:	4c 89 ea             	mov    %r13,%rdx
+  805097:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80509e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8050a1:	4c 89 ee             	mov    %r13,%rsi
+  8050a4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8050ab:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  8050b2:	00 00 00 
+  8050b5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8050b7:	41 01 dc             	add    %ebx,%r12d
+  8050ba:	49 63 f4             	movslq %r12d,%rsi
+  8050bd:	4c 39 f6             	cmp    %r14,%rsi
+  8050c0:	72 b3                	jb     805075 <devcons_write+0xca>
+    return res;
+  8050c2:	49 63 c4             	movslq %r12d,%rax
+}
+  8050c5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8050cc:	5b                   	pop    %rbx
+  8050cd:	41 5c                	pop    %r12
+  8050cf:	41 5d                	pop    %r13
+  8050d1:	41 5e                	pop    %r14
+  8050d3:	41 5f                	pop    %r15
+  8050d5:	5d                   	pop    %rbp
+  8050d6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8050d7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050dd:	eb e3                	jmp    8050c2 <devcons_write+0x117>
+
+00000000008050df <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8050df:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8050e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050e7:	48 85 c0             	test   %rax,%rax
+  8050ea:	74 55                	je     805141 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8050ec:	55                   	push   %rbp
+  8050ed:	48 89 e5             	mov    %rsp,%rbp
+  8050f0:	41 55                	push   %r13
+  8050f2:	41 54                	push   %r12
+  8050f4:	53                   	push   %rbx
+  8050f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8050f9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8050fc:	48 bb 37 27 80 00 00 	movabs $0x802737,%rbx
+  805103:	00 00 00 
+  805106:	49 bc 4b 28 80 00 00 	movabs $0x80284b,%r12
+  80510d:	00 00 00 
+  805110:	eb 03                	jmp    805115 <devcons_read+0x36>
+  805112:	41 ff d4             	call   *%r12
+  805115:	ff d3                	call   *%rbx
+  805117:	85 c0                	test   %eax,%eax
+  805119:	74 f7                	je     805112 <devcons_read+0x33>
+    if (c < 0) return c;
+  80511b:	48 63 d0             	movslq %eax,%rdx
+  80511e:	78 13                	js     805133 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805120:	ba 00 00 00 00       	mov    $0x0,%edx
+  805125:	83 f8 04             	cmp    $0x4,%eax
+  805128:	74 09                	je     805133 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80512a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80512e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805133:	48 89 d0             	mov    %rdx,%rax
+  805136:	48 83 c4 08          	add    $0x8,%rsp
+  80513a:	5b                   	pop    %rbx
+  80513b:	41 5c                	pop    %r12
+  80513d:	41 5d                	pop    %r13
+  80513f:	5d                   	pop    %rbp
+  805140:	c3                   	ret
+  805141:	48 89 d0             	mov    %rdx,%rax
+  805144:	c3                   	ret
+
+0000000000805145 <cputchar>:
+cputchar(int ch) {
+  805145:	55                   	push   %rbp
+  805146:	48 89 e5             	mov    %rsp,%rbp
+  805149:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80514d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805151:	be 01 00 00 00       	mov    $0x1,%esi
+  805156:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80515a:	48 b8 04 27 80 00 00 	movabs $0x802704,%rax
+  805161:	00 00 00 
+  805164:	ff d0                	call   *%rax
+}
+  805166:	c9                   	leave
+  805167:	c3                   	ret
+
+0000000000805168 <getchar>:
+getchar(void) {
+  805168:	55                   	push   %rbp
+  805169:	48 89 e5             	mov    %rsp,%rbp
+  80516c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805170:	ba 01 00 00 00       	mov    $0x1,%edx
+  805175:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805179:	bf 00 00 00 00       	mov    $0x0,%edi
+  80517e:	48 b8 bb 32 80 00 00 	movabs $0x8032bb,%rax
+  805185:	00 00 00 
+  805188:	ff d0                	call   *%rax
+  80518a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80518c:	85 c0                	test   %eax,%eax
+  80518e:	78 06                	js     805196 <getchar+0x2e>
+  805190:	74 08                	je     80519a <getchar+0x32>
+  805192:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805196:	89 d0                	mov    %edx,%eax
+  805198:	c9                   	leave
+  805199:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80519a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80519f:	eb f5                	jmp    805196 <getchar+0x2e>
+
+00000000008051a1 <iscons>:
+iscons(int fdnum) {
+  8051a1:	55                   	push   %rbp
+  8051a2:	48 89 e5             	mov    %rsp,%rbp
+  8051a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8051a9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8051ad:	48 b8 d8 2f 80 00 00 	movabs $0x802fd8,%rax
+  8051b4:	00 00 00 
+  8051b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8051b9:	85 c0                	test   %eax,%eax
+  8051bb:	78 18                	js     8051d5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8051bd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051c1:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8051c8:	00 00 00 
+  8051cb:	8b 00                	mov    (%rax),%eax
+  8051cd:	39 02                	cmp    %eax,(%rdx)
+  8051cf:	0f 94 c0             	sete   %al
+  8051d2:	0f b6 c0             	movzbl %al,%eax
+}
+  8051d5:	c9                   	leave
+  8051d6:	c3                   	ret
+
+00000000008051d7 <opencons>:
+opencons(void) {
+  8051d7:	55                   	push   %rbp
+  8051d8:	48 89 e5             	mov    %rsp,%rbp
+  8051db:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8051df:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8051e3:	48 b8 78 2f 80 00 00 	movabs $0x802f78,%rax
+  8051ea:	00 00 00 
+  8051ed:	ff d0                	call   *%rax
+  8051ef:	85 c0                	test   %eax,%eax
+  8051f1:	78 49                	js     80523c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8051f3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8051f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8051fd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805201:	bf 00 00 00 00       	mov    $0x0,%edi
+  805206:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  80520d:	00 00 00 
+  805210:	ff d0                	call   *%rax
+  805212:	85 c0                	test   %eax,%eax
+  805214:	78 26                	js     80523c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805216:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80521a:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805221:	00 00 
+  805223:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805225:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805229:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805230:	48 b8 4a 2f 80 00 00 	movabs $0x802f4a,%rax
+  805237:	00 00 00 
+  80523a:	ff d0                	call   *%rax
+}
+  80523c:	c9                   	leave
+  80523d:	c3                   	ret
+
+000000000080523e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80523e:	55                   	push   %rbp
+  80523f:	48 89 e5             	mov    %rsp,%rbp
+  805242:	41 56                	push   %r14
+  805244:	41 55                	push   %r13
+  805246:	41 54                	push   %r12
+  805248:	53                   	push   %rbx
+  805249:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80524c:	48 b8 68 a4 c0 01 00 	movabs $0x1c0a468,%rax
+  805253:	00 00 00 
+  805256:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80525a:	74 27                	je     805283 <_handle_vectored_pagefault+0x45>
+  80525c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805261:	49 bd 20 a4 c0 01 00 	movabs $0x1c0a420,%r13
+  805268:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80526b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80526e:	4c 89 e7             	mov    %r12,%rdi
+  805271:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805276:	84 c0                	test   %al,%al
+  805278:	75 45                	jne    8052bf <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80527a:	48 83 c3 01          	add    $0x1,%rbx
+  80527e:	49 3b 1e             	cmp    (%r14),%rbx
+  805281:	72 eb                	jb     80526e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805283:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80528a:	00 
+  80528b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805290:	4d 8b 04 24          	mov    (%r12),%r8
+  805294:	48 ba f8 64 80 00 00 	movabs $0x8064f8,%rdx
+  80529b:	00 00 00 
+  80529e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8052a3:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  8052aa:	00 00 00 
+  8052ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b2:	49 ba 00 17 80 00 00 	movabs $0x801700,%r10
+  8052b9:	00 00 00 
+  8052bc:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8052bf:	5b                   	pop    %rbx
+  8052c0:	41 5c                	pop    %r12
+  8052c2:	41 5d                	pop    %r13
+  8052c4:	41 5e                	pop    %r14
+  8052c6:	5d                   	pop    %rbp
+  8052c7:	c3                   	ret
+
+00000000008052c8 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8052c8:	55                   	push   %rbp
+  8052c9:	48 89 e5             	mov    %rsp,%rbp
+  8052cc:	53                   	push   %rbx
+  8052cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8052d1:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8052d4:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8052d9:	48 b8 60 a4 c0 01 00 	movabs $0x1c0a460,%rax
+  8052e0:	00 00 00 
+  8052e3:	80 38 00             	cmpb   $0x0,(%rax)
+  8052e6:	74 68                	je     805350 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052e8:	48 b8 68 a4 c0 01 00 	movabs $0x1c0a468,%rax
+  8052ef:	00 00 00 
+  8052f2:	48 8b 08             	mov    (%rax),%rcx
+  8052f5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8052fa:	48 b8 20 a4 c0 01 00 	movabs $0x1c0a420,%rax
+  805301:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805304:	48 85 c9             	test   %rcx,%rcx
+  805307:	0f 84 e0 00 00 00    	je     8053ed <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80530d:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805311:	0f 84 c9 00 00 00    	je     8053e0 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805317:	48 83 c2 01          	add    $0x1,%rdx
+  80531b:	48 39 ca             	cmp    %rcx,%rdx
+  80531e:	75 ed                	jne    80530d <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805320:	48 83 f9 08          	cmp    $0x8,%rcx
+  805324:	0f 84 84 00 00 00    	je     8053ae <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80532a:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80532e:	48 a3 68 a4 c0 01 00 	movabs %rax,0x1c0a468
+  805335:	00 00 00 
+  805338:	48 b8 20 a4 c0 01 00 	movabs $0x1c0a420,%rax
+  80533f:	00 00 00 
+  805342:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805346:	85 f6                	test   %esi,%esi
+  805348:	0f 89 97 00 00 00    	jns    8053e5 <add_pgfault_handler+0x11d>
+  80534e:	eb 63                	jmp    8053b3 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805350:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805355:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80535a:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805361:	00 00 00 
+  805364:	bf 00 00 00 00       	mov    $0x0,%edi
+  805369:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  805370:	00 00 00 
+  805373:	ff d0                	call   *%rax
+  805375:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805377:	85 c0                	test   %eax,%eax
+  805379:	78 38                	js     8053b3 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80537b:	48 be c9 54 80 00 00 	movabs $0x8054c9,%rsi
+  805382:	00 00 00 
+  805385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80538a:	48 b8 0f 2b 80 00 00 	movabs $0x802b0f,%rax
+  805391:	00 00 00 
+  805394:	ff d0                	call   *%rax
+  805396:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805398:	85 c0                	test   %eax,%eax
+  80539a:	78 17                	js     8053b3 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80539c:	48 b8 60 a4 c0 01 00 	movabs $0x1c0a460,%rax
+  8053a3:	00 00 00 
+  8053a6:	c6 00 01             	movb   $0x1,(%rax)
+  8053a9:	e9 3a ff ff ff       	jmp    8052e8 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8053ae:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8053b3:	89 f1                	mov    %esi,%ecx
+  8053b5:	48 ba 36 65 80 00 00 	movabs $0x806536,%rdx
+  8053bc:	00 00 00 
+  8053bf:	be 42 00 00 00       	mov    $0x42,%esi
+  8053c4:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  8053cb:	00 00 00 
+  8053ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053d3:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  8053da:	00 00 00 
+  8053dd:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8053e0:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8053e5:	89 f0                	mov    %esi,%eax
+  8053e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8053eb:	c9                   	leave
+  8053ec:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8053ed:	48 b8 68 a4 c0 01 00 	movabs $0x1c0a468,%rax
+  8053f4:	00 00 00 
+  8053f7:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8053fe:	48 89 d8             	mov    %rbx,%rax
+  805401:	48 a3 20 a4 c0 01 00 	movabs %rax,0x1c0a420
+  805408:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80540b:	eb d8                	jmp    8053e5 <add_pgfault_handler+0x11d>
+
+000000000080540d <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80540d:	55                   	push   %rbp
+  80540e:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805411:	48 b8 60 a4 c0 01 00 	movabs $0x1c0a460,%rax
+  805418:	00 00 00 
+  80541b:	80 38 00             	cmpb   $0x0,(%rax)
+  80541e:	74 33                	je     805453 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805420:	48 a1 68 a4 c0 01 00 	movabs 0x1c0a468,%rax
+  805427:	00 00 00 
+  80542a:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80542f:	48 ba 20 a4 c0 01 00 	movabs $0x1c0a420,%rdx
+  805436:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805439:	48 85 c0             	test   %rax,%rax
+  80543c:	0f 84 85 00 00 00    	je     8054c7 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805442:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805446:	74 40                	je     805488 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805448:	48 83 c1 01          	add    $0x1,%rcx
+  80544c:	48 39 c1             	cmp    %rax,%rcx
+  80544f:	75 f1                	jne    805442 <remove_pgfault_handler+0x35>
+  805451:	eb 74                	jmp    8054c7 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805453:	48 b9 4e 65 80 00 00 	movabs $0x80654e,%rcx
+  80545a:	00 00 00 
+  80545d:	48 ba 36 64 80 00 00 	movabs $0x806436,%rdx
+  805464:	00 00 00 
+  805467:	be 48 00 00 00       	mov    $0x48,%esi
+  80546c:	48 bf 28 65 80 00 00 	movabs $0x806528,%rdi
+  805473:	00 00 00 
+  805476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80547b:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  805482:	00 00 00 
+  805485:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805488:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80548f:	00 
+  805490:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805494:	48 29 ca             	sub    %rcx,%rdx
+  805497:	48 b8 20 a4 c0 01 00 	movabs $0x1c0a420,%rax
+  80549e:	00 00 00 
+  8054a1:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8054a5:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8054aa:	48 89 ce             	mov    %rcx,%rsi
+  8054ad:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  8054b4:	00 00 00 
+  8054b7:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8054b9:	48 b8 68 a4 c0 01 00 	movabs $0x1c0a468,%rax
+  8054c0:	00 00 00 
+  8054c3:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8054c7:	5d                   	pop    %rbp
+  8054c8:	c3                   	ret
+
+00000000008054c9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8054c9:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8054cc:	48 b8 3e 52 80 00 00 	movabs $0x80523e,%rax
+  8054d3:	00 00 00 
+    call *%rax
+  8054d6:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8054d8:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8054df:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8054e0:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8054e7:	00 
+    subq $8, %rcx
+  8054e8:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8054ec:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8054ef:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8054f6:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8054f7:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8054fb:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8054ff:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805504:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805509:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80550e:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805513:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805518:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80551d:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805522:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805527:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80552c:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805531:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805536:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80553b:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805540:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805545:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805549:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80554d:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80554e:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80554f:	c3                   	ret
+
+0000000000805550 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805550:	85 ff                	test   %edi,%edi
+  805552:	78 58                	js     8055ac <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805554:	48 85 f6             	test   %rsi,%rsi
+  805557:	74 12                	je     80556b <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805559:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  805560:	00 00 00 
+  805563:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805569:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80556b:	48 85 c9             	test   %rcx,%rcx
+  80556e:	74 12                	je     805582 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805570:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  805577:	00 00 00 
+  80557a:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805580:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805582:	48 85 d2             	test   %rdx,%rdx
+  805585:	74 14                	je     80559b <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805587:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  80558e:	00 00 00 
+  805591:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805598:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80559b:	48 a1 20 80 c0 01 00 	movabs 0x1c08020,%rax
+  8055a2:	00 00 00 
+  8055a5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8055ab:	c3                   	ret
+        if (from_env_store) {
+  8055ac:	48 85 f6             	test   %rsi,%rsi
+  8055af:	74 06                	je     8055b7 <ipc_result+0x67>
+            *from_env_store = 0;
+  8055b1:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8055b7:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8055b9:	48 85 c9             	test   %rcx,%rcx
+  8055bc:	74 ed                	je     8055ab <ipc_result+0x5b>
+            *perm_store = 0;
+  8055be:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8055c4:	c3                   	ret
+
+00000000008055c5 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8055c5:	55                   	push   %rbp
+  8055c6:	48 89 e5             	mov    %rsp,%rbp
+  8055c9:	41 55                	push   %r13
+  8055cb:	41 54                	push   %r12
+  8055cd:	53                   	push   %rbx
+  8055ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8055d2:	49 89 fc             	mov    %rdi,%r12
+  8055d5:	48 89 f7             	mov    %rsi,%rdi
+  8055d8:	48 89 d3             	mov    %rdx,%rbx
+  8055db:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8055de:	48 85 f6             	test   %rsi,%rsi
+  8055e1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055e8:	00 00 00 
+  8055eb:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8055ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8055f4:	48 85 d2             	test   %rdx,%rdx
+  8055f7:	74 03                	je     8055fc <ipc_recv+0x37>
+  8055f9:	48 8b 32             	mov    (%rdx),%rsi
+  8055fc:	48 b8 38 2e 80 00 00 	movabs $0x802e38,%rax
+  805603:	00 00 00 
+  805606:	ff d0                	call   *%rax
+  805608:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80560a:	4c 89 e9             	mov    %r13,%rcx
+  80560d:	48 89 da             	mov    %rbx,%rdx
+  805610:	4c 89 e6             	mov    %r12,%rsi
+  805613:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  80561a:	00 00 00 
+  80561d:	ff d0                	call   *%rax
+}
+  80561f:	48 83 c4 08          	add    $0x8,%rsp
+  805623:	5b                   	pop    %rbx
+  805624:	41 5c                	pop    %r12
+  805626:	41 5d                	pop    %r13
+  805628:	5d                   	pop    %rbp
+  805629:	c3                   	ret
+
+000000000080562a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80562a:	55                   	push   %rbp
+  80562b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80562e:	48 85 d2             	test   %rdx,%rdx
+  805631:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805638:	00 00 00 
+  80563b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80563f:	89 f6                	mov    %esi,%esi
+  805641:	48 b8 c4 2c 80 00 00 	movabs $0x802cc4,%rax
+  805648:	00 00 00 
+  80564b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80564d:	85 c0                	test   %eax,%eax
+  80564f:	78 02                	js     805653 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805651:	5d                   	pop    %rbp
+  805652:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805653:	89 c1                	mov    %eax,%ecx
+  805655:	48 ba 68 65 80 00 00 	movabs $0x806568,%rdx
+  80565c:	00 00 00 
+  80565f:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805664:	48 bf 75 65 80 00 00 	movabs $0x806575,%rdi
+  80566b:	00 00 00 
+  80566e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805673:	49 b8 00 17 80 00 00 	movabs $0x801700,%r8
+  80567a:	00 00 00 
+  80567d:	41 ff d0             	call   *%r8
+
+0000000000805680 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805680:	55                   	push   %rbp
+  805681:	48 89 e5             	mov    %rsp,%rbp
+  805684:	53                   	push   %rbx
+  805685:	48 83 ec 08          	sub    $0x8,%rsp
+  805689:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80568d:	48 85 d2             	test   %rdx,%rdx
+  805690:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805697:	00 00 00 
+  80569a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80569e:	4d 85 c9             	test   %r9,%r9
+  8056a1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8056a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056aa:	48 85 db             	test   %rbx,%rbx
+  8056ad:	74 03                	je     8056b2 <ipc_call+0x32>
+  8056af:	48 8b 03             	mov    (%rbx),%rax
+  8056b2:	89 f6                	mov    %esi,%esi
+  8056b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8056b8:	50                   	push   %rax
+  8056b9:	48 b8 f6 2c 80 00 00 	movabs $0x802cf6,%rax
+  8056c0:	00 00 00 
+  8056c3:	ff d0                	call   *%rax
+  8056c5:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8056c7:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8056cb:	48 89 da             	mov    %rbx,%rdx
+  8056ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8056d3:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  8056da:	00 00 00 
+  8056dd:	ff d0                	call   *%rax
+}
+  8056df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8056e3:	c9                   	leave
+  8056e4:	c3                   	ret
+
+00000000008056e5 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8056e5:	55                   	push   %rbp
+  8056e6:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8056e9:	89 f6                	mov    %esi,%esi
+  8056eb:	48 b8 62 2d 80 00 00 	movabs $0x802d62,%rax
+  8056f2:	00 00 00 
+  8056f5:	ff d0                	call   *%rax
+  8056f7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8056f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8056fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  805703:	be 00 00 00 00       	mov    $0x0,%esi
+  805708:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  80570f:	00 00 00 
+  805712:	ff d0                	call   *%rax
+}
+  805714:	5d                   	pop    %rbp
+  805715:	c3                   	ret
+
+0000000000805716 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805716:	55                   	push   %rbp
+  805717:	48 89 e5             	mov    %rsp,%rbp
+  80571a:	41 54                	push   %r12
+  80571c:	53                   	push   %rbx
+  80571d:	4c 89 cb             	mov    %r9,%rbx
+  805720:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805724:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805728:	48 85 d2             	test   %rdx,%rdx
+  80572b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805732:	00 00 00 
+  805735:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805739:	4d 85 c9             	test   %r9,%r9
+  80573c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805740:	b8 00 00 00 00       	mov    $0x0,%eax
+  805745:	4d 85 e4             	test   %r12,%r12
+  805748:	74 04                	je     80574e <ipc_reply_wait+0x38>
+  80574a:	49 8b 04 24          	mov    (%r12),%rax
+  80574e:	89 f6                	mov    %esi,%esi
+  805750:	48 83 ec 08          	sub    $0x8,%rsp
+  805754:	50                   	push   %rax
+  805755:	48 b8 cc 2d 80 00 00 	movabs $0x802dcc,%rax
+  80575c:	00 00 00 
+  80575f:	ff d0                	call   *%rax
+  805761:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805763:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805767:	4c 89 e2             	mov    %r12,%rdx
+  80576a:	48 89 de             	mov    %rbx,%rsi
+  80576d:	48 b8 50 55 80 00 00 	movabs $0x805550,%rax
+  805774:	00 00 00 
+  805777:	ff d0                	call   *%rax
+}
+  805779:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80577d:	5b                   	pop    %rbx
+  80577e:	41 5c                	pop    %r12
+  805780:	5d                   	pop    %rbp
+  805781:	c3                   	ret
+
+0000000000805782 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805782:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805787:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80578e:	00 00 00 
+  805791:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805798:	48 01 ca             	add    %rcx,%rdx
+  80579b:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8057a1:	39 fa                	cmp    %edi,%edx
+  8057a3:	74 12                	je     8057b7 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8057a5:	48 83 c0 01          	add    $0x1,%rax
+  8057a9:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8057af:	75 e0                	jne    805791 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8057b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b6:	c3                   	ret
+            return envs[i].env_id;
+  8057b7:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8057be:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8057c5:	00 00 00 
+  8057c8:	48 01 d0             	add    %rdx,%rax
+  8057cb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8057d1:	c3                   	ret
+  8057d2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008057d8 <__rodata_start>:
+  8057d8:	77 00                	ja     8057da <__rodata_start+0x2>
+  8057da:	72 62                	jb     80583e <__rodata_start+0x66>
+  8057dc:	00 77 62             	add    %dh,0x62(%rdi)
+  8057df:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  8057e5:	00 00                	add    %al,(%rax)
+  8057e7:	00 ed                	add    %ch,%ch
+  8057e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ee:	00 00                	add    %al,(%rax)
+  8057f0:	ed                   	in     (%dx),%eax
+  8057f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	ed                   	in     (%dx),%eax
+  8057f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057fe:	00 00                	add    %al,(%rax)
+  805800:	ed                   	in     (%dx),%eax
+  805801:	0d 80 00 00 00       	or     $0x80,%eax
+  805806:	00 00                	add    %al,(%rax)
+  805808:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 ed                	add    %ch,%ch
+  805811:	0d 80 00 00 00       	or     $0x80,%eax
+  805816:	00 00                	add    %al,(%rax)
+  805818:	ed                   	in     (%dx),%eax
+  805819:	0d 80 00 00 00       	or     $0x80,%eax
+  80581e:	00 00                	add    %al,(%rax)
+  805820:	ed                   	in     (%dx),%eax
+  805821:	0d 80 00 00 00       	or     $0x80,%eax
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	8c 0a                	mov    %cs,(%rdx)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805846:	00 00                	add    %al,(%rax)
+  805848:	8c 0a                	mov    %cs,(%rdx)
+  80584a:	80 00 00             	addb   $0x0,(%rax)
+  80584d:	00 00                	add    %al,(%rax)
+  80584f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805856:	00 00                	add    %al,(%rax)
+  805858:	8c 0a                	mov    %cs,(%rdx)
+  80585a:	80 00 00             	addb   $0x0,(%rax)
+  80585d:	00 00                	add    %al,(%rax)
+  80585f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805866:	00 00                	add    %al,(%rax)
+  805868:	8c 0a                	mov    %cs,(%rdx)
+  80586a:	80 00 00             	addb   $0x0,(%rax)
+  80586d:	00 00                	add    %al,(%rax)
+  80586f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805876:	00 00                	add    %al,(%rax)
+  805878:	8c 0a                	mov    %cs,(%rdx)
+  80587a:	80 00 00             	addb   $0x0,(%rax)
+  80587d:	00 00                	add    %al,(%rax)
+  80587f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	ed                   	in     (%dx),%eax
+  805919:	0d 80 00 00 00       	or     $0x80,%eax
+  80591e:	00 00                	add    %al,(%rax)
+  805920:	ed                   	in     (%dx),%eax
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	ed                   	in     (%dx),%eax
+  805931:	0d 80 00 00 00       	or     $0x80,%eax
+  805936:	00 00                	add    %al,(%rax)
+  805938:	ed                   	in     (%dx),%eax
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	ed                   	in     (%dx),%eax
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	f4                   	hlt
+  805979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80597f:	00 ed                	add    %ch,%ch
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	2c 0b                	sub    $0xb,%al
+  805992:	80 00 00             	addb   $0x0,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 ed                	add    %ch,%ch
+  805999:	0d 80 00 00 00       	or     $0x80,%eax
+  80599e:	00 00                	add    %al,(%rax)
+  8059a0:	ed                   	in     (%dx),%eax
+  8059a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	ed                   	in     (%dx),%eax
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	ed                   	in     (%dx),%eax
+  8059b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059be:	00 00                	add    %al,(%rax)
+  8059c0:	ed                   	in     (%dx),%eax
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	ed                   	in     (%dx),%eax
+  8059c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ce:	00 00                	add    %al,(%rax)
+  8059d0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8059d3:	00 00                	add    %al,(%rax)
+  8059d5:	00 00                	add    %al,(%rax)
+  8059d7:	00 cb                	add    %cl,%bl
+  8059d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059de:	00 00                	add    %al,(%rax)
+  8059e0:	ed                   	in     (%dx),%eax
+  8059e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	6a 0a                	push   $0xa
+  8059fa:	80 00 00             	addb   $0x0,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	3c 0a                	cmp    $0xa,%al
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 ed                	add    %ch,%ch
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805a2b:	00 00                	add    %al,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 29                	add    %ch,(%rcx)
+  805a39:	0c 80                	or     $0x80,%al
+  805a3b:	00 00                	add    %al,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 ed                	add    %ch,%ch
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	1a 0b                	sbb    (%rbx),%cl
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 ed                	add    %ch,%ch
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ce                   	(bad)
+  805a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a67:	00 ed                	add    %ch,%ch
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	f4                   	hlt
+  805a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a7f:	00 37                	add    %dh,(%rdi)
+  805a81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 37                	add    %dh,(%rdi)
+  805a91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805aab:	00 00                	add    %al,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 d2                	add    %dl,%dl
+  805ab1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ab7:	00 d2                	add    %dl,%dl
+  805ab9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805abf:	00 d2                	add    %dl,%dl
+  805ac1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ac7:	00 d2                	add    %dl,%dl
+  805ac9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805acf:	00 d2                	add    %dl,%dl
+  805ad1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ad7:	00 d2                	add    %dl,%dl
+  805ad9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805adf:	00 d2                	add    %dl,%dl
+  805ae1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ae7:	00 f6                	add    %dh,%dh
+  805ae9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805aef:	00 f6                	add    %dh,%dh
+  805af1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 22                	add    %ah,(%rdx)
+  805b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b37:	00 22                	add    %ah,(%rdx)
+  805b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b3f:	00 22                	add    %ah,(%rdx)
+  805b41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b47:	00 22                	add    %ah,(%rdx)
+  805b49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b4f:	00 22                	add    %ah,(%rdx)
+  805b51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b57:	00 22                	add    %ah,(%rdx)
+  805b59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 46 12             	add    %al,0x12(%rsi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 22                	add    %ah,(%rdx)
+  805c31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c37:	00 22                	add    %ah,(%rdx)
+  805c39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c3f:	00 22                	add    %ah,(%rdx)
+  805c41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c47:	00 22                	add    %ah,(%rdx)
+  805c49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c4f:	00 22                	add    %ah,(%rdx)
+  805c51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c57:	00 22                	add    %ah,(%rdx)
+  805c59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ca2:	80 00 00             	addb   $0x0,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805caa:	80 00 00             	addb   $0x0,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 46 12             	add    %al,0x12(%rsi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805d00 <basefix.0>:
+  805d00:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805d10:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805d20:	10 00 66 0f 1f 44 00 00 4d 61 6b 69 6e 67 20 73     ..f..D..Making s
+  805d30:	75 72 65 20 62 73 73 20 77 6f 72 6b 73 20 72 69     ure bss works ri
+  805d40:	67 68 74 2e 2e 2e 0a 00 62 69 67 61 72 72 61 79     ght.....bigarray
+  805d50:	5b 25 64 5d 20 64 69 64 6e 27 74 20 68 6f 6c 64     [%d] didn't hold
+  805d60:	20 69 74 73 20 76 61 6c 75 65 21 0a 00 00 00 00      its value!.....
+  805d70:	59 65 73 2c 20 67 6f 6f 64 2e 20 20 4e 6f 77 20     Yes, good.  Now 
+  805d80:	64 6f 69 6e 67 20 61 20 77 69 6c 64 20 77 72 69     doing a wild wri
+  805d90:	74 65 20 6f 66 66 20 74 68 65 20 65 6e 64 2e 2e     te off the end..
+  805da0:	2e 0a 00 62 69 67 61 72 72 61 79 5b 25 64 5d 20     ...bigarray[%d] 
+  805db0:	69 73 6e 27 74 20 63 6c 65 61 72 65 64 21 0a 00     isn't cleared!..
+  805dc0:	75 73 65 72 2f 74 65 73 74 62 73 73 2e 63 00 53     user/testbss.c.S
+  805dd0:	48 4f 55 4c 44 20 48 41 56 45 20 54 52 41 50 50     HOULD HAVE TRAPP
+  805de0:	45 44 21 21 21 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     ED!!!.<unknown>.
+  805df0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805e00:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805e10:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805e20:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805e30:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805e40:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805e50:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  805e60:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  805e70:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  805e80:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  805e90:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  805ea0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  805eb0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  805ec0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  805ed0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  805ee0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  805ef0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  805f00:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  805f10:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  805f20:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  805f30:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  805f40:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  805f50:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  805f60:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  805f70:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  805f80:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  805f90:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  805fa0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	48 1a 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     H........ ......
+  805fd0:	8f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  805fe0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  805ff0:	9f 20 80 00 00 00 00 00 67 1a 80 00 00 00 00 00     . ......g.......
+  806000:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806010:	5b 1a 80 00 00 00 00 00 d5 1a 80 00 00 00 00 00     [...............
+  806020:	9f 20 80 00 00 00 00 00 5b 1a 80 00 00 00 00 00     . ......[.......
+  806030:	a1 1a 80 00 00 00 00 00 a1 1a 80 00 00 00 00 00     ................
+  806040:	a1 1a 80 00 00 00 00 00 a1 1a 80 00 00 00 00 00     ................
+  806050:	a1 1a 80 00 00 00 00 00 a1 1a 80 00 00 00 00 00     ................
+  806060:	a1 1a 80 00 00 00 00 00 a1 1a 80 00 00 00 00 00     ................
+  806070:	a1 1a 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     ......... ......
+  806080:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806090:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060a0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060b0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060c0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060d0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060e0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8060f0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806100:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806110:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806120:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806130:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806140:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806150:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806160:	9f 20 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     . ..............
+  806170:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806180:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806190:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8061a0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8061b0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8061c0:	03 1b 80 00 00 00 00 00 d2 1c 80 00 00 00 00 00     ................
+  8061d0:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  8061e0:	9f 20 80 00 00 00 00 00 f8 1a 80 00 00 00 00 00     . ..............
+  8061f0:	32 1b 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     2........ ......
+  806200:	9f 20 80 00 00 00 00 00 ed 1a 80 00 00 00 00 00     . ..............
+  806210:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806220:	7b 1e 80 00 00 00 00 00 4a 1f 80 00 00 00 00 00     {.......J.......
+  806230:	9f 20 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     . ....... ......
+  806240:	c9 1b 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     ......... ......
+  806250:	a6 1d 80 00 00 00 00 00 9f 20 80 00 00 00 00 00     ......... ......
+  806260:	9f 20 80 00 00 00 00 00 bd 1f 80 00 00 00 00 00     . ..............
+  806270:	9f 20 80 00 00 00 00 00 51 1a 80 00 00 00 00 00     . ......Q.......
+
+0000000000806280 <error_string>:
+	...
+  806288:	45 5e 80 00 00 00 00 00 57 5e 80 00 00 00 00 00     E^......W^......
+  806298:	67 5e 80 00 00 00 00 00 79 5e 80 00 00 00 00 00     g^......y^......
+  8062a8:	87 5e 80 00 00 00 00 00 9b 5e 80 00 00 00 00 00     .^.......^......
+  8062b8:	b0 5e 80 00 00 00 00 00 c3 5e 80 00 00 00 00 00     .^.......^......
+  8062c8:	d5 5e 80 00 00 00 00 00 e9 5e 80 00 00 00 00 00     .^.......^......
+  8062d8:	f9 5e 80 00 00 00 00 00 0c 5f 80 00 00 00 00 00     .^......._......
+  8062e8:	23 5f 80 00 00 00 00 00 39 5f 80 00 00 00 00 00     #_......9_......
+  8062f8:	51 5f 80 00 00 00 00 00 69 5f 80 00 00 00 00 00     Q_......i_......
+  806308:	76 5f 80 00 00 00 00 00 20 63 80 00 00 00 00 00     v_...... c......
+  806318:	8a 5f 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     ._......file is 
+  806328:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806338:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806348:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806358:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806368:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806378:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806388:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806398:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8063a8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8063b8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8063c8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8063d8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8063e8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8063f8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806400 <devtab>:
+  806400:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806410:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806420:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806430:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806440:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806450:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806460:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806470:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806480:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806490:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8064a0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8064b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8064c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8064d0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8064e0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8064f0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806500:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806510:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806520:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806530:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806540:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806550:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806560:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806570:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806580:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806590:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806600:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806610:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806620:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806630:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806640:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806650:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806660:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806670:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806680:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806690:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806700:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806710:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806720:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806730:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806740:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806750:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806760:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806770:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806780:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806790:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806800:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806810:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806820:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806830:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806840:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806850:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806860:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806870:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806880:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806890:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806900:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806910:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806920:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806930:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
@@ -0,0 +1,10670 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 c3 25 80 00 00 	movabs $0x8025c3,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 44 24 80 00 00 	movabs $0x802444,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 86 19 80 00 00 	movabs $0x801986,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ef 62 80 00 00 	movabs $0x8062ef,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be d8 5b 80 00 00 	movabs $0x805bd8,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be da 5b 80 00 00 	movabs $0x805bda,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be dd 5b 80 00 00 	movabs $0x805bdd,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 e3 23 80 00 00 	movabs $0x8023e3,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 c3 4f 80 00 00 	movabs $0x804fc3,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 9a 52 80 00 00 	movabs $0x80529a,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 20 38 80 00 00 	movabs $0x803820,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 e9 38 80 00 00 	movabs $0x8038e9,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 90 25 80 00 00 	movabs $0x802590,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be e0 5b 80 00 00 	movabs $0x805be0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 90 25 80 00 00 	movabs $0x802590,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 c3 25 80 00 00 	movabs $0x8025c3,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 90 25 80 00 00 	movabs $0x802590,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 80 5e 80 00 00 	movabs $0x805e80,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 90 25 80 00 00 	movabs $0x802590,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 90 25 80 00 00 	movabs $0x802590,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 e8 27 80 00 00 	movabs $0x8027e8,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 cf 02 00 00       	call   8017ce <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 56                	push   %r14
+  801507:	41 55                	push   %r13
+  801509:	41 54                	push   %r12
+  80150b:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  80150c:	be 00 00 00 00       	mov    $0x0,%esi
+  801511:	48 bf 22 61 80 00 00 	movabs $0x806122,%rdi
+  801518:	00 00 00 
+  80151b:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	89 c3                	mov    %eax,%ebx
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	0f 88 8a 01 00 00    	js     8016bb <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  801531:	be 00 00 00 00       	mov    $0x0,%esi
+  801536:	89 c7                	mov    %eax,%edi
+  801538:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  801544:	ba 00 02 00 00       	mov    $0x200,%edx
+  801549:	48 be 20 82 80 01 00 	movabs $0x1808220,%rsi
+  801550:	00 00 00 
+  801553:	89 df                	mov    %ebx,%edi
+  801555:	48 b8 c5 36 80 00 00 	movabs $0x8036c5,%rax
+  80155c:	00 00 00 
+  80155f:	ff d0                	call   *%rax
+  801561:	49 89 c4             	mov    %rax,%r12
+  801564:	41 89 c6             	mov    %eax,%r14d
+  801567:	85 c0                	test   %eax,%eax
+  801569:	0f 8e 79 01 00 00    	jle    8016e8 <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  80156f:	48 b8 e4 30 80 00 00 	movabs $0x8030e4,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+  80157b:	41 89 c5             	mov    %eax,%r13d
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	0f 88 8f 01 00 00    	js     801715 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  801586:	0f 85 c7 00 00 00    	jne    801653 <umain+0x152>
+        seek(fd, 0);
+  80158c:	be 00 00 00 00       	mov    $0x0,%esi
+  801591:	89 df                	mov    %ebx,%edi
+  801593:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  80159a:	00 00 00 
+  80159d:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80159f:	48 bf 88 61 80 00 00 	movabs $0x806188,%rdi
+  8015a6:	00 00 00 
+  8015a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ae:	48 ba ea 19 80 00 00 	movabs $0x8019ea,%rdx
+  8015b5:	00 00 00 
+  8015b8:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8015ba:	ba 00 02 00 00       	mov    $0x200,%edx
+  8015bf:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  8015c6:	00 00 00 
+  8015c9:	89 df                	mov    %ebx,%edi
+  8015cb:	48 b8 c5 36 80 00 00 	movabs $0x8036c5,%rax
+  8015d2:	00 00 00 
+  8015d5:	ff d0                	call   *%rax
+  8015d7:	41 39 c4             	cmp    %eax,%r12d
+  8015da:	0f 85 62 01 00 00    	jne    801742 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  8015e0:	49 63 d4             	movslq %r12d,%rdx
+  8015e3:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  8015ea:	00 00 00 
+  8015ed:	48 bf 20 82 80 01 00 	movabs $0x1808220,%rdi
+  8015f4:	00 00 00 
+  8015f7:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  8015fe:	00 00 00 
+  801601:	ff d0                	call   *%rax
+  801603:	85 c0                	test   %eax,%eax
+  801605:	0f 85 68 01 00 00    	jne    801773 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80160b:	48 bf 54 61 80 00 00 	movabs $0x806154,%rdi
+  801612:	00 00 00 
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	48 ba ea 19 80 00 00 	movabs $0x8019ea,%rdx
+  801621:	00 00 00 
+  801624:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  801626:	be 00 00 00 00       	mov    $0x0,%esi
+  80162b:	89 df                	mov    %ebx,%edi
+  80162d:	48 b8 ef 37 80 00 00 	movabs $0x8037ef,%rax
+  801634:	00 00 00 
+  801637:	ff d0                	call   *%rax
+        close(fd);
+  801639:	89 df                	mov    %ebx,%edi
+  80163b:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+        exit();
+  801647:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  80164e:	00 00 00 
+  801651:	ff d0                	call   *%rax
+    }
+    wait(r);
+  801653:	44 89 ef             	mov    %r13d,%edi
+  801656:	48 b8 10 47 80 00 00 	movabs $0x804710,%rax
+  80165d:	00 00 00 
+  801660:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  801662:	ba 00 02 00 00       	mov    $0x200,%edx
+  801667:	48 be 20 80 80 01 00 	movabs $0x1808020,%rsi
+  80166e:	00 00 00 
+  801671:	89 df                	mov    %ebx,%edi
+  801673:	48 b8 c5 36 80 00 00 	movabs $0x8036c5,%rax
+  80167a:	00 00 00 
+  80167d:	ff d0                	call   *%rax
+  80167f:	41 39 c4             	cmp    %eax,%r12d
+  801682:	0f 85 15 01 00 00    	jne    80179d <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  801688:	48 bf 6d 61 80 00 00 	movabs $0x80616d,%rdi
+  80168f:	00 00 00 
+  801692:	b8 00 00 00 00       	mov    $0x0,%eax
+  801697:	48 ba ea 19 80 00 00 	movabs $0x8019ea,%rdx
+  80169e:	00 00 00 
+  8016a1:	ff d2                	call   *%rdx
+    close(fd);
+  8016a3:	89 df                	mov    %ebx,%edi
+  8016a5:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  8016ac:	00 00 00 
+  8016af:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8016b1:	cc                   	int3
+
+    breakpoint();
+}
+  8016b2:	5b                   	pop    %rbx
+  8016b3:	41 5c                	pop    %r12
+  8016b5:	41 5d                	pop    %r13
+  8016b7:	41 5e                	pop    %r14
+  8016b9:	5d                   	pop    %rbp
+  8016ba:	c3                   	ret
+        panic("open motd: %i", fd);
+  8016bb:	89 c1                	mov    %eax,%ecx
+  8016bd:	48 ba 27 61 80 00 00 	movabs $0x806127,%rdx
+  8016c4:	00 00 00 
+  8016c7:	be 0b 00 00 00       	mov    $0xb,%esi
+  8016cc:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  8016d3:	00 00 00 
+  8016d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016db:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  8016e2:	00 00 00 
+  8016e5:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  8016e8:	89 c1                	mov    %eax,%ecx
+  8016ea:	48 ba 4a 61 80 00 00 	movabs $0x80614a,%rdx
+  8016f1:	00 00 00 
+  8016f4:	be 0e 00 00 00       	mov    $0xe,%esi
+  8016f9:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  801700:	00 00 00 
+  801703:	b8 00 00 00 00       	mov    $0x0,%eax
+  801708:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  80170f:	00 00 00 
+  801712:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  801715:	89 c1                	mov    %eax,%ecx
+  801717:	48 ba dc 67 80 00 00 	movabs $0x8067dc,%rdx
+  80171e:	00 00 00 
+  801721:	be 11 00 00 00       	mov    $0x11,%esi
+  801726:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  80172d:	00 00 00 
+  801730:	b8 00 00 00 00       	mov    $0x0,%eax
+  801735:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  80173c:	00 00 00 
+  80173f:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  801742:	41 89 c0             	mov    %eax,%r8d
+  801745:	44 89 e1             	mov    %r12d,%ecx
+  801748:	48 ba d0 61 80 00 00 	movabs $0x8061d0,%rdx
+  80174f:	00 00 00 
+  801752:	be 16 00 00 00       	mov    $0x16,%esi
+  801757:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  80175e:	00 00 00 
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+  801766:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  80176d:	00 00 00 
+  801770:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  801773:	48 ba 00 62 80 00 00 	movabs $0x806200,%rdx
+  80177a:	00 00 00 
+  80177d:	be 18 00 00 00       	mov    $0x18,%esi
+  801782:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  801789:	00 00 00 
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	48 b9 9a 18 80 00 00 	movabs $0x80189a,%rcx
+  801798:	00 00 00 
+  80179b:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  80179d:	41 89 c0             	mov    %eax,%r8d
+  8017a0:	44 89 f1             	mov    %r14d,%ecx
+  8017a3:	48 ba 38 62 80 00 00 	movabs $0x806238,%rdx
+  8017aa:	00 00 00 
+  8017ad:	be 20 00 00 00       	mov    $0x20,%esi
+  8017b2:	48 bf 35 61 80 00 00 	movabs $0x806135,%rdi
+  8017b9:	00 00 00 
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c1:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  8017c8:	00 00 00 
+  8017cb:	41 ff d1             	call   *%r9
+
+00000000008017ce <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8017ce:	55                   	push   %rbp
+  8017cf:	48 89 e5             	mov    %rsp,%rbp
+  8017d2:	41 56                	push   %r14
+  8017d4:	41 55                	push   %r13
+  8017d6:	41 54                	push   %r12
+  8017d8:	53                   	push   %rbx
+  8017d9:	41 89 fd             	mov    %edi,%r13d
+  8017dc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8017df:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8017e6:	00 00 00 
+  8017e9:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8017f0:	00 00 00 
+  8017f3:	48 39 c2             	cmp    %rax,%rdx
+  8017f6:	73 17                	jae    80180f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8017f8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8017fb:	49 89 c4             	mov    %rax,%r12
+  8017fe:	48 83 c3 08          	add    $0x8,%rbx
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+  801807:	ff 53 f8             	call   *-0x8(%rbx)
+  80180a:	4c 39 e3             	cmp    %r12,%rbx
+  80180d:	72 ef                	jb     8017fe <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80180f:	48 b8 ae 29 80 00 00 	movabs $0x8029ae,%rax
+  801816:	00 00 00 
+  801819:	ff d0                	call   *%rax
+  80181b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801820:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801827:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80182e:	00 00 00 
+  801831:	48 01 d0             	add    %rdx,%rax
+  801834:	48 a3 20 84 80 01 00 	movabs %rax,0x1808420
+  80183b:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80183e:	45 85 ed             	test   %r13d,%r13d
+  801841:	7e 0d                	jle    801850 <libmain+0x82>
+  801843:	49 8b 06             	mov    (%r14),%rax
+  801846:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  80184d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801850:	4c 89 f6             	mov    %r14,%rsi
+  801853:	44 89 ef             	mov    %r13d,%edi
+  801856:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80185d:	00 00 00 
+  801860:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801862:	48 b8 77 18 80 00 00 	movabs $0x801877,%rax
+  801869:	00 00 00 
+  80186c:	ff d0                	call   *%rax
+#endif
+}
+  80186e:	5b                   	pop    %rbx
+  80186f:	41 5c                	pop    %r12
+  801871:	41 5d                	pop    %r13
+  801873:	41 5e                	pop    %r14
+  801875:	5d                   	pop    %rbp
+  801876:	c3                   	ret
+
+0000000000801877 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801877:	55                   	push   %rbp
+  801878:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80187b:	48 b8 bc 34 80 00 00 	movabs $0x8034bc,%rax
+  801882:	00 00 00 
+  801885:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801887:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188c:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+}
+  801898:	5d                   	pop    %rbp
+  801899:	c3                   	ret
+
+000000000080189a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80189a:	55                   	push   %rbp
+  80189b:	48 89 e5             	mov    %rsp,%rbp
+  80189e:	41 56                	push   %r14
+  8018a0:	41 55                	push   %r13
+  8018a2:	41 54                	push   %r12
+  8018a4:	53                   	push   %rbx
+  8018a5:	48 83 ec 50          	sub    $0x50,%rsp
+  8018a9:	49 89 fc             	mov    %rdi,%r12
+  8018ac:	41 89 f5             	mov    %esi,%r13d
+  8018af:	48 89 d3             	mov    %rdx,%rbx
+  8018b2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8018b6:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8018ba:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8018be:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8018c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018c9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8018cd:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8018d1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8018d5:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8018dc:	00 00 00 
+  8018df:	4c 8b 30             	mov    (%rax),%r14
+  8018e2:	48 b8 ae 29 80 00 00 	movabs $0x8029ae,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	89 c6                	mov    %eax,%esi
+  8018f0:	45 89 e8             	mov    %r13d,%r8d
+  8018f3:	4c 89 e1             	mov    %r12,%rcx
+  8018f6:	4c 89 f2             	mov    %r14,%rdx
+  8018f9:	48 bf 68 62 80 00 00 	movabs $0x806268,%rdi
+  801900:	00 00 00 
+  801903:	b8 00 00 00 00       	mov    $0x0,%eax
+  801908:	49 bc ea 19 80 00 00 	movabs $0x8019ea,%r12
+  80190f:	00 00 00 
+  801912:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801915:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801919:	48 89 df             	mov    %rbx,%rdi
+  80191c:	48 b8 86 19 80 00 00 	movabs $0x801986,%rax
+  801923:	00 00 00 
+  801926:	ff d0                	call   *%rax
+    cprintf("\n");
+  801928:	48 bf 6b 61 80 00 00 	movabs $0x80616b,%rdi
+  80192f:	00 00 00 
+  801932:	b8 00 00 00 00       	mov    $0x0,%eax
+  801937:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80193a:	cc                   	int3
+  80193b:	eb fd                	jmp    80193a <_panic+0xa0>
+
+000000000080193d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80193d:	55                   	push   %rbp
+  80193e:	48 89 e5             	mov    %rsp,%rbp
+  801941:	53                   	push   %rbx
+  801942:	48 83 ec 08          	sub    $0x8,%rsp
+  801946:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801949:	8b 06                	mov    (%rsi),%eax
+  80194b:	8d 50 01             	lea    0x1(%rax),%edx
+  80194e:	89 16                	mov    %edx,(%rsi)
+  801950:	48 98                	cltq
+  801952:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801957:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80195d:	74 0a                	je     801969 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80195f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801963:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801967:	c9                   	leave
+  801968:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801969:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80196d:	be ff 00 00 00       	mov    $0xff,%esi
+  801972:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  801979:	00 00 00 
+  80197c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80197e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801984:	eb d9                	jmp    80195f <putch+0x22>
+
+0000000000801986 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801986:	55                   	push   %rbp
+  801987:	48 89 e5             	mov    %rsp,%rbp
+  80198a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801991:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801994:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80199b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8019a8:	48 89 f1             	mov    %rsi,%rcx
+  8019ab:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8019b2:	48 bf 3d 19 80 00 00 	movabs $0x80193d,%rdi
+  8019b9:	00 00 00 
+  8019bc:	48 b8 3a 1b 80 00 00 	movabs $0x801b3a,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8019c8:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8019cf:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8019d6:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  8019dd:	00 00 00 
+  8019e0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8019e2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+00000000008019ea <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8019f2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8019f6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8019fa:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019fe:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a02:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a06:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a0d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a15:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a19:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a1d:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a21:	48 b8 86 19 80 00 00 	movabs $0x801986,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+0000000000801a2f <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	41 57                	push   %r15
+  801a35:	41 56                	push   %r14
+  801a37:	41 55                	push   %r13
+  801a39:	41 54                	push   %r12
+  801a3b:	53                   	push   %rbx
+  801a3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801a40:	49 89 fc             	mov    %rdi,%r12
+  801a43:	49 89 f5             	mov    %rsi,%r13
+  801a46:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a4a:	8b 45 10             	mov    0x10(%rbp),%eax
+  801a4d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801a50:	41 89 cf             	mov    %ecx,%r15d
+  801a53:	4c 39 fa             	cmp    %r15,%rdx
+  801a56:	73 5b                	jae    801ab3 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801a58:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801a5c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801a60:	85 db                	test   %ebx,%ebx
+  801a62:	7e 0e                	jle    801a72 <print_num+0x43>
+            putch(padc, put_arg);
+  801a64:	4c 89 ee             	mov    %r13,%rsi
+  801a67:	44 89 f7             	mov    %r14d,%edi
+  801a6a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801a6d:	83 eb 01             	sub    $0x1,%ebx
+  801a70:	75 f2                	jne    801a64 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801a72:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801a76:	48 b9 9c 62 80 00 00 	movabs $0x80629c,%rcx
+  801a7d:	00 00 00 
+  801a80:	48 b8 8b 62 80 00 00 	movabs $0x80628b,%rax
+  801a87:	00 00 00 
+  801a8a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801a8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a97:	49 f7 f7             	div    %r15
+  801a9a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801a9e:	4c 89 ee             	mov    %r13,%rsi
+  801aa1:	41 ff d4             	call   *%r12
+}
+  801aa4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	41 5e                	pop    %r14
+  801aaf:	41 5f                	pop    %r15
+  801ab1:	5d                   	pop    %rbp
+  801ab2:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801abc:	49 f7 f7             	div    %r15
+  801abf:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac3:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801ac7:	52                   	push   %rdx
+  801ac8:	45 0f be c9          	movsbl %r9b,%r9d
+  801acc:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801ad0:	48 89 c2             	mov    %rax,%rdx
+  801ad3:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801ada:	00 00 00 
+  801add:	ff d0                	call   *%rax
+  801adf:	48 83 c4 10          	add    $0x10,%rsp
+  801ae3:	eb 8d                	jmp    801a72 <print_num+0x43>
+
+0000000000801ae5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ae5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801ae9:	48 8b 06             	mov    (%rsi),%rax
+  801aec:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801af0:	73 0a                	jae    801afc <sprintputch+0x17>
+        *state->start++ = ch;
+  801af2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801af6:	48 89 16             	mov    %rdx,(%rsi)
+  801af9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801afc:	c3                   	ret
+
+0000000000801afd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801afd:	55                   	push   %rbp
+  801afe:	48 89 e5             	mov    %rsp,%rbp
+  801b01:	48 83 ec 50          	sub    $0x50,%rsp
+  801b05:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b09:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b0d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b11:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b18:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b20:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b24:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b28:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b2c:	48 b8 3a 1b 80 00 00 	movabs $0x801b3a,%rax
+  801b33:	00 00 00 
+  801b36:	ff d0                	call   *%rax
+}
+  801b38:	c9                   	leave
+  801b39:	c3                   	ret
+
+0000000000801b3a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b3a:	55                   	push   %rbp
+  801b3b:	48 89 e5             	mov    %rsp,%rbp
+  801b3e:	41 57                	push   %r15
+  801b40:	41 56                	push   %r14
+  801b42:	41 55                	push   %r13
+  801b44:	41 54                	push   %r12
+  801b46:	53                   	push   %rbx
+  801b47:	48 83 ec 38          	sub    $0x38,%rsp
+  801b4b:	49 89 fe             	mov    %rdi,%r14
+  801b4e:	49 89 f5             	mov    %rsi,%r13
+  801b51:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801b54:	48 8b 01             	mov    (%rcx),%rax
+  801b57:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801b5b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b63:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801b67:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801b6b:	eb 0d                	jmp    801b7a <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801b6d:	40 0f b6 ff          	movzbl %dil,%edi
+  801b71:	4c 89 ee             	mov    %r13,%rsi
+  801b74:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801b77:	4c 89 e3             	mov    %r12,%rbx
+  801b7a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801b7e:	0f b6 3b             	movzbl (%rbx),%edi
+  801b81:	40 80 ff 25          	cmp    $0x25,%dil
+  801b85:	74 14                	je     801b9b <vprintfmt+0x61>
+            if (!ch) return;
+  801b87:	40 84 ff             	test   %dil,%dil
+  801b8a:	75 e1                	jne    801b6d <vprintfmt+0x33>
+}
+  801b8c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b90:	5b                   	pop    %rbx
+  801b91:	41 5c                	pop    %r12
+  801b93:	41 5d                	pop    %r13
+  801b95:	41 5e                	pop    %r14
+  801b97:	41 5f                	pop    %r15
+  801b99:	5d                   	pop    %rbp
+  801b9a:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801b9b:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801ba4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801ba9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801baf:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801bb6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801bba:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801bbf:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801bc4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801bc7:	83 e8 23             	sub    $0x23,%eax
+  801bca:	3c 57                	cmp    $0x57,%al
+  801bcc:	0f 87 67 06 00 00    	ja     802239 <vprintfmt+0x6ff>
+  801bd2:	0f b6 c0             	movzbl %al,%eax
+  801bd5:	48 b9 20 64 80 00 00 	movabs $0x806420,%rcx
+  801bdc:	00 00 00 
+  801bdf:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801be2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801be5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801be9:	eb cf                	jmp    801bba <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801beb:	49 89 dc             	mov    %rbx,%r12
+  801bee:	be 01 00 00 00       	mov    $0x1,%esi
+  801bf3:	eb c5                	jmp    801bba <vprintfmt+0x80>
+            padc = ch;
+  801bf5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801bf9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801bfc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801bff:	eb b9                	jmp    801bba <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c04:	83 f8 2f             	cmp    $0x2f,%eax
+  801c07:	77 24                	ja     801c2d <vprintfmt+0xf3>
+  801c09:	89 c1                	mov    %eax,%ecx
+  801c0b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c0f:	83 c0 08             	add    $0x8,%eax
+  801c12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c15:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c18:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c1b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c1f:	79 99                	jns    801bba <vprintfmt+0x80>
+                width = precision;
+  801c21:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c25:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c2b:	eb 8d                	jmp    801bba <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c2d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c31:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c39:	eb da                	jmp    801c15 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c3b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c40:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c44:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801c4a:	3c 39                	cmp    $0x39,%al
+  801c4c:	77 1c                	ja     801c6a <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801c4e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801c52:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801c56:	0f b6 c0             	movzbl %al,%eax
+  801c59:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c5e:	0f b6 03             	movzbl (%rbx),%eax
+  801c61:	3c 39                	cmp    $0x39,%al
+  801c63:	76 e9                	jbe    801c4e <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801c65:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801c68:	eb b1                	jmp    801c1b <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801c6a:	49 89 dc             	mov    %rbx,%r12
+  801c6d:	eb ac                	jmp    801c1b <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801c6f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801c72:	85 c9                	test   %ecx,%ecx
+  801c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c79:	0f 49 c1             	cmovns %ecx,%eax
+  801c7c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801c7f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c82:	e9 33 ff ff ff       	jmp    801bba <vprintfmt+0x80>
+            lflag++;
+  801c87:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c8a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c8d:	e9 28 ff ff ff       	jmp    801bba <vprintfmt+0x80>
+            lflag--;
+  801c92:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c95:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c98:	e9 1d ff ff ff       	jmp    801bba <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801c9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ca0:	83 f8 2f             	cmp    $0x2f,%eax
+  801ca3:	77 19                	ja     801cbe <vprintfmt+0x184>
+  801ca5:	89 c2                	mov    %eax,%edx
+  801ca7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cab:	83 c0 08             	add    $0x8,%eax
+  801cae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cb1:	8b 3a                	mov    (%rdx),%edi
+  801cb3:	4c 89 ee             	mov    %r13,%rsi
+  801cb6:	41 ff d6             	call   *%r14
+            break;
+  801cb9:	e9 bc fe ff ff       	jmp    801b7a <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cca:	eb e5                	jmp    801cb1 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801ccc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  801cd2:	77 5a                	ja     801d2e <vprintfmt+0x1f4>
+  801cd4:	89 c2                	mov    %eax,%edx
+  801cd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cda:	83 c0 08             	add    $0x8,%eax
+  801cdd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801ce0:	8b 02                	mov    (%rdx),%eax
+  801ce2:	89 c1                	mov    %eax,%ecx
+  801ce4:	f7 d9                	neg    %ecx
+  801ce6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ce9:	83 f9 13             	cmp    $0x13,%ecx
+  801cec:	7f 4e                	jg     801d3c <vprintfmt+0x202>
+  801cee:	48 63 c1             	movslq %ecx,%rax
+  801cf1:	48 ba e0 66 80 00 00 	movabs $0x8066e0,%rdx
+  801cf8:	00 00 00 
+  801cfb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801cff:	48 85 c0             	test   %rax,%rax
+  801d02:	74 38                	je     801d3c <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d04:	48 89 c1             	mov    %rax,%rcx
+  801d07:	48 ba 28 69 80 00 00 	movabs $0x806928,%rdx
+  801d0e:	00 00 00 
+  801d11:	4c 89 ee             	mov    %r13,%rsi
+  801d14:	4c 89 f7             	mov    %r14,%rdi
+  801d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d1c:	49 b8 fd 1a 80 00 00 	movabs $0x801afd,%r8
+  801d23:	00 00 00 
+  801d26:	41 ff d0             	call   *%r8
+  801d29:	e9 4c fe ff ff       	jmp    801b7a <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d3a:	eb a4                	jmp    801ce0 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d3c:	48 ba b4 62 80 00 00 	movabs $0x8062b4,%rdx
+  801d43:	00 00 00 
+  801d46:	4c 89 ee             	mov    %r13,%rsi
+  801d49:	4c 89 f7             	mov    %r14,%rdi
+  801d4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d51:	49 b8 fd 1a 80 00 00 	movabs $0x801afd,%r8
+  801d58:	00 00 00 
+  801d5b:	41 ff d0             	call   *%r8
+  801d5e:	e9 17 fe ff ff       	jmp    801b7a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d66:	83 f8 2f             	cmp    $0x2f,%eax
+  801d69:	77 6c                	ja     801dd7 <vprintfmt+0x29d>
+  801d6b:	89 c2                	mov    %eax,%edx
+  801d6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d71:	83 c0 08             	add    $0x8,%eax
+  801d74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d77:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801d7a:	48 85 f6             	test   %rsi,%rsi
+  801d7d:	48 b8 ad 62 80 00 00 	movabs $0x8062ad,%rax
+  801d84:	00 00 00 
+  801d87:	48 0f 45 c6          	cmovne %rsi,%rax
+  801d8b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801d8f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d93:	7e 06                	jle    801d9b <vprintfmt+0x261>
+  801d95:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801d99:	75 4a                	jne    801de5 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d9b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d9f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801da3:	0f b6 00             	movzbl (%rax),%eax
+  801da6:	84 c0                	test   %al,%al
+  801da8:	0f 85 9a 00 00 00    	jne    801e48 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801dae:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801db1:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	0f 8e bd fd ff ff    	jle    801b7a <vprintfmt+0x40>
+  801dbd:	4c 89 ee             	mov    %r13,%rsi
+  801dc0:	bf 20 00 00 00       	mov    $0x20,%edi
+  801dc5:	41 ff d6             	call   *%r14
+  801dc8:	41 83 ec 01          	sub    $0x1,%r12d
+  801dcc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801dd0:	75 eb                	jne    801dbd <vprintfmt+0x283>
+  801dd2:	e9 a3 fd ff ff       	jmp    801b7a <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ddb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ddf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801de3:	eb 92                	jmp    801d77 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801de5:	49 63 f7             	movslq %r15d,%rsi
+  801de8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801dec:	48 b8 fe 22 80 00 00 	movabs $0x8022fe,%rax
+  801df3:	00 00 00 
+  801df6:	ff d0                	call   *%rax
+  801df8:	48 89 c2             	mov    %rax,%rdx
+  801dfb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801dfe:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e00:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e03:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	7e 91                	jle    801d9b <vprintfmt+0x261>
+  801e0a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e0f:	4c 89 ee             	mov    %r13,%rsi
+  801e12:	44 89 e7             	mov    %r12d,%edi
+  801e15:	41 ff d6             	call   *%r14
+  801e18:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e1c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e22:	75 eb                	jne    801e0f <vprintfmt+0x2d5>
+  801e24:	e9 72 ff ff ff       	jmp    801d9b <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e29:	0f b6 f8             	movzbl %al,%edi
+  801e2c:	4c 89 ee             	mov    %r13,%rsi
+  801e2f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e32:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e36:	49 83 c4 01          	add    $0x1,%r12
+  801e3a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e40:	84 c0                	test   %al,%al
+  801e42:	0f 84 66 ff ff ff    	je     801dae <vprintfmt+0x274>
+  801e48:	45 85 ff             	test   %r15d,%r15d
+  801e4b:	78 0a                	js     801e57 <vprintfmt+0x31d>
+  801e4d:	41 83 ef 01          	sub    $0x1,%r15d
+  801e51:	0f 88 57 ff ff ff    	js     801dae <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e57:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801e5b:	74 cc                	je     801e29 <vprintfmt+0x2ef>
+  801e5d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801e60:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801e65:	80 fa 5e             	cmp    $0x5e,%dl
+  801e68:	77 c2                	ja     801e2c <vprintfmt+0x2f2>
+  801e6a:	eb bd                	jmp    801e29 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801e6c:	40 84 f6             	test   %sil,%sil
+  801e6f:	75 26                	jne    801e97 <vprintfmt+0x35d>
+    switch (lflag) {
+  801e71:	85 d2                	test   %edx,%edx
+  801e73:	74 59                	je     801ece <vprintfmt+0x394>
+  801e75:	83 fa 01             	cmp    $0x1,%edx
+  801e78:	74 7b                	je     801ef5 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801e7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e80:	0f 87 96 00 00 00    	ja     801f1c <vprintfmt+0x3e2>
+  801e86:	89 c2                	mov    %eax,%edx
+  801e88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e8c:	83 c0 08             	add    $0x8,%eax
+  801e8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e92:	4c 8b 22             	mov    (%rdx),%r12
+  801e95:	eb 17                	jmp    801eae <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9d:	77 21                	ja     801ec0 <vprintfmt+0x386>
+  801e9f:	89 c2                	mov    %eax,%edx
+  801ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea5:	83 c0 08             	add    $0x8,%eax
+  801ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eab:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801eae:	4d 85 e4             	test   %r12,%r12
+  801eb1:	78 7a                	js     801f2d <vprintfmt+0x3f3>
+            num = i;
+  801eb3:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801eb6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801ebb:	e9 56 02 00 00       	jmp    802116 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ec4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ec8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ecc:	eb dd                	jmp    801eab <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801ece:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed1:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed4:	77 11                	ja     801ee7 <vprintfmt+0x3ad>
+  801ed6:	89 c2                	mov    %eax,%edx
+  801ed8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801edc:	83 c0 08             	add    $0x8,%eax
+  801edf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ee2:	4c 63 22             	movslq (%rdx),%r12
+  801ee5:	eb c7                	jmp    801eae <vprintfmt+0x374>
+  801ee7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eeb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef3:	eb ed                	jmp    801ee2 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801ef5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef8:	83 f8 2f             	cmp    $0x2f,%eax
+  801efb:	77 11                	ja     801f0e <vprintfmt+0x3d4>
+  801efd:	89 c2                	mov    %eax,%edx
+  801eff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f03:	83 c0 08             	add    $0x8,%eax
+  801f06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f09:	4c 8b 22             	mov    (%rdx),%r12
+  801f0c:	eb a0                	jmp    801eae <vprintfmt+0x374>
+  801f0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f1a:	eb ed                	jmp    801f09 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f28:	e9 65 ff ff ff       	jmp    801e92 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f2d:	4c 89 ee             	mov    %r13,%rsi
+  801f30:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f35:	41 ff d6             	call   *%r14
+                i = -i;
+  801f38:	49 f7 dc             	neg    %r12
+  801f3b:	e9 73 ff ff ff       	jmp    801eb3 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f40:	40 84 f6             	test   %sil,%sil
+  801f43:	75 2e                	jne    801f73 <vprintfmt+0x439>
+    switch (lflag) {
+  801f45:	85 d2                	test   %edx,%edx
+  801f47:	7f 59                	jg     801fa2 <vprintfmt+0x468>
+  801f49:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f4c:	7d 7a                	jge    801fc8 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801f4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f51:	83 f8 2f             	cmp    $0x2f,%eax
+  801f54:	0f 87 aa 00 00 00    	ja     802004 <vprintfmt+0x4ca>
+  801f5a:	89 c2                	mov    %eax,%edx
+  801f5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f60:	83 c0 08             	add    $0x8,%eax
+  801f63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f66:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f69:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f6e:	e9 a3 01 00 00       	jmp    802116 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f76:	83 f8 2f             	cmp    $0x2f,%eax
+  801f79:	77 19                	ja     801f94 <vprintfmt+0x45a>
+  801f7b:	89 c2                	mov    %eax,%edx
+  801f7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f81:	83 c0 08             	add    $0x8,%eax
+  801f84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f87:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f8f:	e9 82 01 00 00       	jmp    802116 <vprintfmt+0x5dc>
+  801f94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fa0:	eb e5                	jmp    801f87 <vprintfmt+0x44d>
+    switch (lflag) {
+  801fa2:	83 fa 01             	cmp    $0x1,%edx
+  801fa5:	75 a7                	jne    801f4e <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801fa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801faa:	83 f8 2f             	cmp    $0x2f,%eax
+  801fad:	77 47                	ja     801ff6 <vprintfmt+0x4bc>
+  801faf:	89 c2                	mov    %eax,%edx
+  801fb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fb5:	83 c0 08             	add    $0x8,%eax
+  801fb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fbb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fbe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801fc3:	e9 4e 01 00 00       	jmp    802116 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fcb:	83 f8 2f             	cmp    $0x2f,%eax
+  801fce:	77 18                	ja     801fe8 <vprintfmt+0x4ae>
+  801fd0:	89 c2                	mov    %eax,%edx
+  801fd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd6:	83 c0 08             	add    $0x8,%eax
+  801fd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fdc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801fde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801fe3:	e9 2e 01 00 00       	jmp    802116 <vprintfmt+0x5dc>
+  801fe8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ff4:	eb e6                	jmp    801fdc <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801ff6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ffa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ffe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802002:	eb b7                	jmp    801fbb <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802004:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802008:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80200c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802010:	e9 51 ff ff ff       	jmp    801f66 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802015:	40 84 f6             	test   %sil,%sil
+  802018:	75 2e                	jne    802048 <vprintfmt+0x50e>
+    switch (lflag) {
+  80201a:	85 d2                	test   %edx,%edx
+  80201c:	7f 59                	jg     802077 <vprintfmt+0x53d>
+  80201e:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802021:	7d 77                	jge    80209a <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802023:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802026:	83 f8 2f             	cmp    $0x2f,%eax
+  802029:	0f 87 a4 00 00 00    	ja     8020d3 <vprintfmt+0x599>
+  80202f:	89 c2                	mov    %eax,%edx
+  802031:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802035:	83 c0 08             	add    $0x8,%eax
+  802038:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80203e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802043:	e9 ce 00 00 00       	jmp    802116 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802048:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80204b:	83 f8 2f             	cmp    $0x2f,%eax
+  80204e:	77 19                	ja     802069 <vprintfmt+0x52f>
+  802050:	89 c2                	mov    %eax,%edx
+  802052:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802056:	83 c0 08             	add    $0x8,%eax
+  802059:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80205c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80205f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802064:	e9 ad 00 00 00       	jmp    802116 <vprintfmt+0x5dc>
+  802069:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80206d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802071:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802075:	eb e5                	jmp    80205c <vprintfmt+0x522>
+    switch (lflag) {
+  802077:	83 fa 01             	cmp    $0x1,%edx
+  80207a:	75 a7                	jne    802023 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  80207c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80207f:	83 f8 2f             	cmp    $0x2f,%eax
+  802082:	77 41                	ja     8020c5 <vprintfmt+0x58b>
+  802084:	89 c2                	mov    %eax,%edx
+  802086:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80208a:	83 c0 08             	add    $0x8,%eax
+  80208d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802090:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802093:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802098:	eb 7c                	jmp    802116 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80209a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80209d:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a0:	77 15                	ja     8020b7 <vprintfmt+0x57d>
+  8020a2:	89 c2                	mov    %eax,%edx
+  8020a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020a8:	83 c0 08             	add    $0x8,%eax
+  8020ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ae:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8020b0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8020b5:	eb 5f                	jmp    802116 <vprintfmt+0x5dc>
+  8020b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c3:	eb e9                	jmp    8020ae <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8020c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d1:	eb bd                	jmp    802090 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  8020d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020df:	e9 57 ff ff ff       	jmp    80203b <vprintfmt+0x501>
+            putch('0', put_arg);
+  8020e4:	4c 89 ee             	mov    %r13,%rsi
+  8020e7:	bf 30 00 00 00       	mov    $0x30,%edi
+  8020ec:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8020ef:	4c 89 ee             	mov    %r13,%rsi
+  8020f2:	bf 78 00 00 00       	mov    $0x78,%edi
+  8020f7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8020fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020fd:	83 f8 2f             	cmp    $0x2f,%eax
+  802100:	77 47                	ja     802149 <vprintfmt+0x60f>
+  802102:	89 c2                	mov    %eax,%edx
+  802104:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802108:	83 c0 08             	add    $0x8,%eax
+  80210b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80210e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802111:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802116:	48 83 ec 08          	sub    $0x8,%rsp
+  80211a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80211e:	0f 94 c0             	sete   %al
+  802121:	0f b6 c0             	movzbl %al,%eax
+  802124:	50                   	push   %rax
+  802125:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80212a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80212e:	4c 89 ee             	mov    %r13,%rsi
+  802131:	4c 89 f7             	mov    %r14,%rdi
+  802134:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  80213b:	00 00 00 
+  80213e:	ff d0                	call   *%rax
+            break;
+  802140:	48 83 c4 10          	add    $0x10,%rsp
+  802144:	e9 31 fa ff ff       	jmp    801b7a <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802149:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802151:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802155:	eb b7                	jmp    80210e <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802157:	40 84 f6             	test   %sil,%sil
+  80215a:	75 2b                	jne    802187 <vprintfmt+0x64d>
+    switch (lflag) {
+  80215c:	85 d2                	test   %edx,%edx
+  80215e:	7f 56                	jg     8021b6 <vprintfmt+0x67c>
+  802160:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802163:	7d 77                	jge    8021dc <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802165:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802168:	83 f8 2f             	cmp    $0x2f,%eax
+  80216b:	0f 87 a7 00 00 00    	ja     802218 <vprintfmt+0x6de>
+  802171:	89 c2                	mov    %eax,%edx
+  802173:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802177:	83 c0 08             	add    $0x8,%eax
+  80217a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80217d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802180:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802185:	eb 8f                	jmp    802116 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802187:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80218a:	83 f8 2f             	cmp    $0x2f,%eax
+  80218d:	77 19                	ja     8021a8 <vprintfmt+0x66e>
+  80218f:	89 c2                	mov    %eax,%edx
+  802191:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802195:	83 c0 08             	add    $0x8,%eax
+  802198:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80219b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80219e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021a3:	e9 6e ff ff ff       	jmp    802116 <vprintfmt+0x5dc>
+  8021a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021b4:	eb e5                	jmp    80219b <vprintfmt+0x661>
+    switch (lflag) {
+  8021b6:	83 fa 01             	cmp    $0x1,%edx
+  8021b9:	75 aa                	jne    802165 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8021bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021be:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c1:	77 47                	ja     80220a <vprintfmt+0x6d0>
+  8021c3:	89 c2                	mov    %eax,%edx
+  8021c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021c9:	83 c0 08             	add    $0x8,%eax
+  8021cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8021d7:	e9 3a ff ff ff       	jmp    802116 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021df:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e2:	77 18                	ja     8021fc <vprintfmt+0x6c2>
+  8021e4:	89 c2                	mov    %eax,%edx
+  8021e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ea:	83 c0 08             	add    $0x8,%eax
+  8021ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f0:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8021f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8021f7:	e9 1a ff ff ff       	jmp    802116 <vprintfmt+0x5dc>
+  8021fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802200:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802204:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802208:	eb e6                	jmp    8021f0 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80220a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80220e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802212:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802216:	eb b7                	jmp    8021cf <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802218:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80221c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802220:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802224:	e9 54 ff ff ff       	jmp    80217d <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802229:	4c 89 ee             	mov    %r13,%rsi
+  80222c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802231:	41 ff d6             	call   *%r14
+            break;
+  802234:	e9 41 f9 ff ff       	jmp    801b7a <vprintfmt+0x40>
+            putch('%', put_arg);
+  802239:	4c 89 ee             	mov    %r13,%rsi
+  80223c:	bf 25 00 00 00       	mov    $0x25,%edi
+  802241:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802244:	48 83 eb 01          	sub    $0x1,%rbx
+  802248:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80224c:	75 f6                	jne    802244 <vprintfmt+0x70a>
+  80224e:	e9 27 f9 ff ff       	jmp    801b7a <vprintfmt+0x40>
+
+0000000000802253 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802253:	55                   	push   %rbp
+  802254:	48 89 e5             	mov    %rsp,%rbp
+  802257:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80225b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80225f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802264:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802268:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80226f:	48 85 ff             	test   %rdi,%rdi
+  802272:	74 2b                	je     80229f <vsnprintf+0x4c>
+  802274:	48 85 f6             	test   %rsi,%rsi
+  802277:	74 26                	je     80229f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802279:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80227d:	48 bf e5 1a 80 00 00 	movabs $0x801ae5,%rdi
+  802284:	00 00 00 
+  802287:	48 b8 3a 1b 80 00 00 	movabs $0x801b3a,%rax
+  80228e:	00 00 00 
+  802291:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802293:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802297:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80229a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80229f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022a4:	eb f7                	jmp    80229d <vsnprintf+0x4a>
+
+00000000008022a6 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  8022aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8022ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8022b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8022ba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8022d1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022d5:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  8022dc:	00 00 00 
+  8022df:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8022e1:	c9                   	leave
+  8022e2:	c3                   	ret
+
+00000000008022e3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8022e3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8022e6:	74 10                	je     8022f8 <strlen+0x15>
+    size_t n = 0;
+  8022e8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8022ed:	48 83 c0 01          	add    $0x1,%rax
+  8022f1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8022f5:	75 f6                	jne    8022ed <strlen+0xa>
+  8022f7:	c3                   	ret
+    size_t n = 0;
+  8022f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8022fd:	c3                   	ret
+
+00000000008022fe <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8022fe:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802301:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802306:	48 85 f6             	test   %rsi,%rsi
+  802309:	74 11                	je     80231c <strnlen+0x1e>
+  80230b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80230f:	74 0c                	je     80231d <strnlen+0x1f>
+  802311:	48 83 c2 01          	add    $0x1,%rdx
+  802315:	48 39 d0             	cmp    %rdx,%rax
+  802318:	75 f1                	jne    80230b <strnlen+0xd>
+  80231a:	eb 04                	jmp    802320 <strnlen+0x22>
+  80231c:	c3                   	ret
+  80231d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802320:	c3                   	ret
+
+0000000000802321 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802321:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802324:	ba 00 00 00 00       	mov    $0x0,%edx
+  802329:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80232d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802330:	48 83 c2 01          	add    $0x1,%rdx
+  802334:	84 c9                	test   %cl,%cl
+  802336:	75 f1                	jne    802329 <strcpy+0x8>
+        ;
+    return res;
+}
+  802338:	c3                   	ret
+
+0000000000802339 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802339:	55                   	push   %rbp
+  80233a:	48 89 e5             	mov    %rsp,%rbp
+  80233d:	41 54                	push   %r12
+  80233f:	53                   	push   %rbx
+  802340:	48 89 fb             	mov    %rdi,%rbx
+  802343:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802346:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802352:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802356:	4c 89 e6             	mov    %r12,%rsi
+  802359:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  802360:	00 00 00 
+  802363:	ff d0                	call   *%rax
+    return dst;
+}
+  802365:	48 89 d8             	mov    %rbx,%rax
+  802368:	5b                   	pop    %rbx
+  802369:	41 5c                	pop    %r12
+  80236b:	5d                   	pop    %rbp
+  80236c:	c3                   	ret
+
+000000000080236d <toupper>:
+
+int
+toupper(int ch) {
+  80236d:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80236f:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802372:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802375:	83 f9 1a             	cmp    $0x1a,%ecx
+  802378:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80237b:	c3                   	ret
+
+000000000080237c <tolower>:
+
+int
+tolower(int ch) {
+  80237c:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80237e:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802381:	8d 57 20             	lea    0x20(%rdi),%edx
+  802384:	83 f9 1a             	cmp    $0x1a,%ecx
+  802387:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80238a:	c3                   	ret
+
+000000000080238b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80238b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80238e:	48 85 d2             	test   %rdx,%rdx
+  802391:	74 1f                	je     8023b2 <strncpy+0x27>
+  802393:	48 01 fa             	add    %rdi,%rdx
+  802396:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802399:	48 83 c1 01          	add    $0x1,%rcx
+  80239d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8023a1:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8023a5:	41 80 f8 01          	cmp    $0x1,%r8b
+  8023a9:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8023ad:	48 39 ca             	cmp    %rcx,%rdx
+  8023b0:	75 e7                	jne    802399 <strncpy+0xe>
+    }
+    return ret;
+}
+  8023b2:	c3                   	ret
+
+00000000008023b3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8023b3:	48 89 f8             	mov    %rdi,%rax
+  8023b6:	48 85 d2             	test   %rdx,%rdx
+  8023b9:	74 24                	je     8023df <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8023bb:	48 83 ea 01          	sub    $0x1,%rdx
+  8023bf:	74 1b                	je     8023dc <strlcpy+0x29>
+  8023c1:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8023c5:	0f b6 16             	movzbl (%rsi),%edx
+  8023c8:	84 d2                	test   %dl,%dl
+  8023ca:	74 10                	je     8023dc <strlcpy+0x29>
+            *dst++ = *src++;
+  8023cc:	48 83 c6 01          	add    $0x1,%rsi
+  8023d0:	48 83 c0 01          	add    $0x1,%rax
+  8023d4:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8023d7:	48 39 c8             	cmp    %rcx,%rax
+  8023da:	75 e9                	jne    8023c5 <strlcpy+0x12>
+        *dst = '\0';
+  8023dc:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8023df:	48 29 f8             	sub    %rdi,%rax
+}
+  8023e2:	c3                   	ret
+
+00000000008023e3 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8023e3:	0f b6 07             	movzbl (%rdi),%eax
+  8023e6:	84 c0                	test   %al,%al
+  8023e8:	74 13                	je     8023fd <strcmp+0x1a>
+  8023ea:	38 06                	cmp    %al,(%rsi)
+  8023ec:	75 0f                	jne    8023fd <strcmp+0x1a>
+  8023ee:	48 83 c7 01          	add    $0x1,%rdi
+  8023f2:	48 83 c6 01          	add    $0x1,%rsi
+  8023f6:	0f b6 07             	movzbl (%rdi),%eax
+  8023f9:	84 c0                	test   %al,%al
+  8023fb:	75 ed                	jne    8023ea <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8023fd:	0f b6 c0             	movzbl %al,%eax
+  802400:	0f b6 16             	movzbl (%rsi),%edx
+  802403:	29 d0                	sub    %edx,%eax
+}
+  802405:	c3                   	ret
+
+0000000000802406 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802406:	48 85 d2             	test   %rdx,%rdx
+  802409:	74 1f                	je     80242a <strncmp+0x24>
+  80240b:	0f b6 07             	movzbl (%rdi),%eax
+  80240e:	84 c0                	test   %al,%al
+  802410:	74 1e                	je     802430 <strncmp+0x2a>
+  802412:	3a 06                	cmp    (%rsi),%al
+  802414:	75 1a                	jne    802430 <strncmp+0x2a>
+  802416:	48 83 c7 01          	add    $0x1,%rdi
+  80241a:	48 83 c6 01          	add    $0x1,%rsi
+  80241e:	48 83 ea 01          	sub    $0x1,%rdx
+  802422:	75 e7                	jne    80240b <strncmp+0x5>
+
+    if (!n) return 0;
+  802424:	b8 00 00 00 00       	mov    $0x0,%eax
+  802429:	c3                   	ret
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242f:	c3                   	ret
+  802430:	48 85 d2             	test   %rdx,%rdx
+  802433:	74 09                	je     80243e <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802435:	0f b6 07             	movzbl (%rdi),%eax
+  802438:	0f b6 16             	movzbl (%rsi),%edx
+  80243b:	29 d0                	sub    %edx,%eax
+  80243d:	c3                   	ret
+    if (!n) return 0;
+  80243e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802443:	c3                   	ret
+
+0000000000802444 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802444:	0f b6 17             	movzbl (%rdi),%edx
+  802447:	84 d2                	test   %dl,%dl
+  802449:	74 18                	je     802463 <strchr+0x1f>
+        if (*str == c) {
+  80244b:	0f be d2             	movsbl %dl,%edx
+  80244e:	39 f2                	cmp    %esi,%edx
+  802450:	74 17                	je     802469 <strchr+0x25>
+    for (; *str; str++) {
+  802452:	48 83 c7 01          	add    $0x1,%rdi
+  802456:	0f b6 17             	movzbl (%rdi),%edx
+  802459:	84 d2                	test   %dl,%dl
+  80245b:	75 ee                	jne    80244b <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80245d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802462:	c3                   	ret
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+  802468:	c3                   	ret
+  802469:	48 89 f8             	mov    %rdi,%rax
+}
+  80246c:	c3                   	ret
+
+000000000080246d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80246d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802470:	0f b6 17             	movzbl (%rdi),%edx
+  802473:	84 d2                	test   %dl,%dl
+  802475:	74 13                	je     80248a <strfind+0x1d>
+  802477:	0f be d2             	movsbl %dl,%edx
+  80247a:	39 f2                	cmp    %esi,%edx
+  80247c:	74 0b                	je     802489 <strfind+0x1c>
+  80247e:	48 83 c0 01          	add    $0x1,%rax
+  802482:	0f b6 10             	movzbl (%rax),%edx
+  802485:	84 d2                	test   %dl,%dl
+  802487:	75 ee                	jne    802477 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802489:	c3                   	ret
+  80248a:	c3                   	ret
+
+000000000080248b <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80248b:	48 39 f7             	cmp    %rsi,%rdi
+  80248e:	74 65                	je     8024f5 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802490:	55                   	push   %rbp
+  802491:	48 89 e5             	mov    %rsp,%rbp
+  802494:	41 57                	push   %r15
+  802496:	41 56                	push   %r14
+  802498:	41 55                	push   %r13
+  80249a:	41 54                	push   %r12
+  80249c:	53                   	push   %rbx
+  80249d:	48 83 ec 18          	sub    $0x18,%rsp
+  8024a1:	48 89 fb             	mov    %rdi,%rbx
+  8024a4:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8024a7:	49 bf 7c 23 80 00 00 	movabs $0x80237c,%r15
+  8024ae:	00 00 00 
+  8024b1:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8024b5:	41 0f b6 fd          	movzbl %r13b,%edi
+  8024b9:	41 ff d7             	call   *%r15
+  8024bc:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8024bf:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8024c4:	41 0f b6 fe          	movzbl %r14b,%edi
+  8024c8:	41 ff d7             	call   *%r15
+  8024cb:	89 c2                	mov    %eax,%edx
+  8024cd:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024d0:	29 d0                	sub    %edx,%eax
+  8024d2:	75 12                	jne    8024e6 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8024d4:	48 83 c3 01          	add    $0x1,%rbx
+  8024d8:	45 84 ed             	test   %r13b,%r13b
+  8024db:	74 09                	je     8024e6 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8024dd:	49 83 c4 01          	add    $0x1,%r12
+  8024e1:	45 84 f6             	test   %r14b,%r14b
+  8024e4:	75 cb                	jne    8024b1 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8024e6:	48 83 c4 18          	add    $0x18,%rsp
+  8024ea:	5b                   	pop    %rbx
+  8024eb:	41 5c                	pop    %r12
+  8024ed:	41 5d                	pop    %r13
+  8024ef:	41 5e                	pop    %r14
+  8024f1:	41 5f                	pop    %r15
+  8024f3:	5d                   	pop    %rbp
+  8024f4:	c3                   	ret
+    if (p1 == p2) return 0;
+  8024f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024fa:	c3                   	ret
+
+00000000008024fb <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024fb:	48 39 f7             	cmp    %rsi,%rdi
+  8024fe:	74 7d                	je     80257d <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802500:	55                   	push   %rbp
+  802501:	48 89 e5             	mov    %rsp,%rbp
+  802504:	41 57                	push   %r15
+  802506:	41 56                	push   %r14
+  802508:	41 55                	push   %r13
+  80250a:	41 54                	push   %r12
+  80250c:	53                   	push   %rbx
+  80250d:	48 83 ec 18          	sub    $0x18,%rsp
+  802511:	48 89 fb             	mov    %rdi,%rbx
+  802514:	49 89 f4             	mov    %rsi,%r12
+  802517:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80251b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80251f:	49 bf 7c 23 80 00 00 	movabs $0x80237c,%r15
+  802526:	00 00 00 
+    while (n--) {
+  802529:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80252d:	48 39 c3             	cmp    %rax,%rbx
+  802530:	74 37                	je     802569 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802532:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802536:	41 0f b6 fd          	movzbl %r13b,%edi
+  80253a:	41 ff d7             	call   *%r15
+  80253d:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802540:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802545:	41 0f b6 fe          	movzbl %r14b,%edi
+  802549:	41 ff d7             	call   *%r15
+  80254c:	89 c2                	mov    %eax,%edx
+  80254e:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802551:	29 d0                	sub    %edx,%eax
+  802553:	75 19                	jne    80256e <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802555:	48 83 c3 01          	add    $0x1,%rbx
+  802559:	45 84 ed             	test   %r13b,%r13b
+  80255c:	74 10                	je     80256e <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80255e:	49 83 c4 01          	add    $0x1,%r12
+  802562:	45 84 f6             	test   %r14b,%r14b
+  802565:	75 c2                	jne    802529 <strncasecmp+0x2e>
+  802567:	eb 05                	jmp    80256e <strncasecmp+0x73>
+  802569:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80256e:	48 83 c4 18          	add    $0x18,%rsp
+  802572:	5b                   	pop    %rbx
+  802573:	41 5c                	pop    %r12
+  802575:	41 5d                	pop    %r13
+  802577:	41 5e                	pop    %r14
+  802579:	41 5f                	pop    %r15
+  80257b:	5d                   	pop    %rbp
+  80257c:	c3                   	ret
+    if (p1 == p2) return 0;
+  80257d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802582:	c3                   	ret
+
+0000000000802583 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802583:	83 e7 df             	and    $0xffffffdf,%edi
+  802586:	83 ef 41             	sub    $0x41,%edi
+  802589:	83 ff 19             	cmp    $0x19,%edi
+  80258c:	0f 96 c0             	setbe  %al
+}
+  80258f:	c3                   	ret
+
+0000000000802590 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802590:	83 ff 20             	cmp    $0x20,%edi
+  802593:	0f 94 c0             	sete   %al
+  802596:	83 ff 09             	cmp    $0x9,%edi
+  802599:	0f 94 c2             	sete   %dl
+  80259c:	09 d0                	or     %edx,%eax
+}
+  80259e:	c3                   	ret
+
+000000000080259f <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80259f:	55                   	push   %rbp
+  8025a0:	48 89 e5             	mov    %rsp,%rbp
+  8025a3:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8025a5:	48 bf 9f 67 80 00 00 	movabs $0x80679f,%rdi
+  8025ac:	00 00 00 
+  8025af:	48 b8 44 24 80 00 00 	movabs $0x802444,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+  8025bb:	48 85 c0             	test   %rax,%rax
+  8025be:	0f 95 c0             	setne  %al
+}
+  8025c1:	5d                   	pop    %rbp
+  8025c2:	c3                   	ret
+
+00000000008025c3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8025c3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8025c6:	48 89 f8             	mov    %rdi,%rax
+  8025c9:	48 f7 d8             	neg    %rax
+  8025cc:	83 e0 07             	and    $0x7,%eax
+  8025cf:	49 89 d1             	mov    %rdx,%r9
+  8025d2:	49 29 c1             	sub    %rax,%r9
+  8025d5:	78 36                	js     80260d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8025d7:	40 0f b6 c6          	movzbl %sil,%eax
+  8025db:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8025e2:	01 01 01 
+  8025e5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8025e9:	40 f6 c7 07          	test   $0x7,%dil
+  8025ed:	75 38                	jne    802627 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8025ef:	4c 89 c9             	mov    %r9,%rcx
+  8025f2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8025f6:	74 0c                	je     802604 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8025f8:	fc                   	cld
+  8025f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8025fc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802600:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802604:	4d 85 c9             	test   %r9,%r9
+  802607:	75 45                	jne    80264e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802609:	4c 89 c0             	mov    %r8,%rax
+  80260c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80260d:	48 85 d2             	test   %rdx,%rdx
+  802610:	74 f7                	je     802609 <memset+0x46>
+  802612:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802615:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802618:	48 83 c0 01          	add    $0x1,%rax
+  80261c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802620:	48 39 c2             	cmp    %rax,%rdx
+  802623:	75 f3                	jne    802618 <memset+0x55>
+  802625:	eb e2                	jmp    802609 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802627:	40 f6 c7 01          	test   $0x1,%dil
+  80262b:	74 06                	je     802633 <memset+0x70>
+  80262d:	88 07                	mov    %al,(%rdi)
+  80262f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802633:	40 f6 c7 02          	test   $0x2,%dil
+  802637:	74 07                	je     802640 <memset+0x7d>
+  802639:	66 89 07             	mov    %ax,(%rdi)
+  80263c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802640:	40 f6 c7 04          	test   $0x4,%dil
+  802644:	74 a9                	je     8025ef <memset+0x2c>
+  802646:	89 07                	mov    %eax,(%rdi)
+  802648:	48 83 c7 04          	add    $0x4,%rdi
+  80264c:	eb a1                	jmp    8025ef <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80264e:	41 f6 c1 04          	test   $0x4,%r9b
+  802652:	74 06                	je     80265a <memset+0x97>
+  802654:	89 07                	mov    %eax,(%rdi)
+  802656:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80265a:	41 f6 c1 02          	test   $0x2,%r9b
+  80265e:	74 07                	je     802667 <memset+0xa4>
+  802660:	66 89 07             	mov    %ax,(%rdi)
+  802663:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802667:	41 f6 c1 01          	test   $0x1,%r9b
+  80266b:	74 9c                	je     802609 <memset+0x46>
+  80266d:	88 07                	mov    %al,(%rdi)
+  80266f:	eb 98                	jmp    802609 <memset+0x46>
+
+0000000000802671 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802671:	48 89 f8             	mov    %rdi,%rax
+  802674:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802677:	48 39 fe             	cmp    %rdi,%rsi
+  80267a:	73 3b                	jae    8026b7 <memmove+0x46>
+  80267c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802680:	48 39 d7             	cmp    %rdx,%rdi
+  802683:	73 32                	jae    8026b7 <memmove+0x46>
+        s += n;
+        d += n;
+  802685:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802689:	48 89 d6             	mov    %rdx,%rsi
+  80268c:	48 09 fe             	or     %rdi,%rsi
+  80268f:	48 09 ce             	or     %rcx,%rsi
+  802692:	40 f6 c6 07          	test   $0x7,%sil
+  802696:	75 12                	jne    8026aa <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802698:	48 83 ef 08          	sub    $0x8,%rdi
+  80269c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8026a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026a4:	fd                   	std
+  8026a5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8026a8:	fc                   	cld
+  8026a9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8026aa:	48 83 ef 01          	sub    $0x1,%rdi
+  8026ae:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8026b2:	fd                   	std
+  8026b3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8026b5:	eb f1                	jmp    8026a8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026b7:	48 89 f2             	mov    %rsi,%rdx
+  8026ba:	48 09 c2             	or     %rax,%rdx
+  8026bd:	48 09 ca             	or     %rcx,%rdx
+  8026c0:	f6 c2 07             	test   $0x7,%dl
+  8026c3:	75 0c                	jne    8026d1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8026c5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026c9:	48 89 c7             	mov    %rax,%rdi
+  8026cc:	fc                   	cld
+  8026cd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8026d0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8026d1:	48 89 c7             	mov    %rax,%rdi
+  8026d4:	fc                   	cld
+  8026d5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8026d7:	c3                   	ret
+
+00000000008026d8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8026d8:	55                   	push   %rbp
+  8026d9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8026dc:	48 b8 71 26 80 00 00 	movabs $0x802671,%rax
+  8026e3:	00 00 00 
+  8026e6:	ff d0                	call   *%rax
+}
+  8026e8:	5d                   	pop    %rbp
+  8026e9:	c3                   	ret
+
+00000000008026ea <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8026ea:	55                   	push   %rbp
+  8026eb:	48 89 e5             	mov    %rsp,%rbp
+  8026ee:	41 57                	push   %r15
+  8026f0:	41 56                	push   %r14
+  8026f2:	41 55                	push   %r13
+  8026f4:	41 54                	push   %r12
+  8026f6:	53                   	push   %rbx
+  8026f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026fb:	49 89 fe             	mov    %rdi,%r14
+  8026fe:	49 89 f7             	mov    %rsi,%r15
+  802701:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802704:	48 89 f7             	mov    %rsi,%rdi
+  802707:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+  802713:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802716:	48 89 de             	mov    %rbx,%rsi
+  802719:	4c 89 f7             	mov    %r14,%rdi
+  80271c:	48 b8 fe 22 80 00 00 	movabs $0x8022fe,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+  802728:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80272b:	48 39 c3             	cmp    %rax,%rbx
+  80272e:	74 36                	je     802766 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802730:	48 89 d8             	mov    %rbx,%rax
+  802733:	4c 29 e8             	sub    %r13,%rax
+  802736:	49 39 c4             	cmp    %rax,%r12
+  802739:	73 31                	jae    80276c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80273b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802740:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802744:	4c 89 fe             	mov    %r15,%rsi
+  802747:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  80274e:	00 00 00 
+  802751:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802753:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802757:	48 83 c4 08          	add    $0x8,%rsp
+  80275b:	5b                   	pop    %rbx
+  80275c:	41 5c                	pop    %r12
+  80275e:	41 5d                	pop    %r13
+  802760:	41 5e                	pop    %r14
+  802762:	41 5f                	pop    %r15
+  802764:	5d                   	pop    %rbp
+  802765:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802766:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80276a:	eb eb                	jmp    802757 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80276c:	48 83 eb 01          	sub    $0x1,%rbx
+  802770:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802774:	48 89 da             	mov    %rbx,%rdx
+  802777:	4c 89 fe             	mov    %r15,%rsi
+  80277a:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802786:	49 01 de             	add    %rbx,%r14
+  802789:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80278e:	eb c3                	jmp    802753 <strlcat+0x69>
+
+0000000000802790 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802790:	48 85 d2             	test   %rdx,%rdx
+  802793:	74 2d                	je     8027c2 <memcmp+0x32>
+  802795:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80279a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80279e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8027a3:	44 38 c1             	cmp    %r8b,%cl
+  8027a6:	75 0f                	jne    8027b7 <memcmp+0x27>
+    while (n-- > 0) {
+  8027a8:	48 83 c0 01          	add    $0x1,%rax
+  8027ac:	48 39 c2             	cmp    %rax,%rdx
+  8027af:	75 e9                	jne    80279a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8027b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8027b7:	0f b6 c1             	movzbl %cl,%eax
+  8027ba:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8027be:	44 29 c0             	sub    %r8d,%eax
+  8027c1:	c3                   	ret
+    return 0;
+  8027c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c7:	c3                   	ret
+
+00000000008027c8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8027c8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8027cc:	48 39 c7             	cmp    %rax,%rdi
+  8027cf:	73 0f                	jae    8027e0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8027d1:	40 38 37             	cmp    %sil,(%rdi)
+  8027d4:	74 0e                	je     8027e4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8027d6:	48 83 c7 01          	add    $0x1,%rdi
+  8027da:	48 39 f8             	cmp    %rdi,%rax
+  8027dd:	75 f2                	jne    8027d1 <memfind+0x9>
+  8027df:	c3                   	ret
+  8027e0:	48 89 f8             	mov    %rdi,%rax
+  8027e3:	c3                   	ret
+  8027e4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8027e7:	c3                   	ret
+
+00000000008027e8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8027e8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8027eb:	0f b6 37             	movzbl (%rdi),%esi
+  8027ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8027f2:	74 06                	je     8027fa <strtol+0x12>
+  8027f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8027f8:	75 13                	jne    80280d <strtol+0x25>
+  8027fa:	48 83 c7 01          	add    $0x1,%rdi
+  8027fe:	0f b6 37             	movzbl (%rdi),%esi
+  802801:	40 80 fe 20          	cmp    $0x20,%sil
+  802805:	74 f3                	je     8027fa <strtol+0x12>
+  802807:	40 80 fe 09          	cmp    $0x9,%sil
+  80280b:	74 ed                	je     8027fa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80280d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802810:	83 e0 fd             	and    $0xfffffffd,%eax
+  802813:	3c 01                	cmp    $0x1,%al
+  802815:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802819:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80281f:	75 0f                	jne    802830 <strtol+0x48>
+  802821:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802824:	74 14                	je     80283a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802826:	85 d2                	test   %edx,%edx
+  802828:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80282d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802830:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802835:	4c 63 ca             	movslq %edx,%r9
+  802838:	eb 36                	jmp    802870 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80283a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80283e:	74 0f                	je     80284f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802840:	85 d2                	test   %edx,%edx
+  802842:	75 ec                	jne    802830 <strtol+0x48>
+        s++;
+  802844:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802848:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80284d:	eb e1                	jmp    802830 <strtol+0x48>
+        s += 2;
+  80284f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802853:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802858:	eb d6                	jmp    802830 <strtol+0x48>
+            dig -= '0';
+  80285a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80285d:	44 0f b6 c1          	movzbl %cl,%r8d
+  802861:	41 39 d0             	cmp    %edx,%r8d
+  802864:	7d 21                	jge    802887 <strtol+0x9f>
+        val = val * base + dig;
+  802866:	49 0f af c1          	imul   %r9,%rax
+  80286a:	0f b6 c9             	movzbl %cl,%ecx
+  80286d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802870:	48 83 c7 01          	add    $0x1,%rdi
+  802874:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802878:	80 f9 39             	cmp    $0x39,%cl
+  80287b:	76 dd                	jbe    80285a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80287d:	80 f9 7b             	cmp    $0x7b,%cl
+  802880:	77 05                	ja     802887 <strtol+0x9f>
+            dig -= 'a' - 10;
+  802882:	83 e9 57             	sub    $0x57,%ecx
+  802885:	eb d6                	jmp    80285d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802887:	4d 85 d2             	test   %r10,%r10
+  80288a:	74 03                	je     80288f <strtol+0xa7>
+  80288c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80288f:	48 89 c2             	mov    %rax,%rdx
+  802892:	48 f7 da             	neg    %rdx
+  802895:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802899:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80289d:	c3                   	ret
+
+000000000080289e <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80289e:	55                   	push   %rbp
+  80289f:	48 89 e5             	mov    %rsp,%rbp
+  8028a2:	53                   	push   %rbx
+  8028a3:	48 89 fa             	mov    %rdi,%rdx
+  8028a6:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8028a9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028c9:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8028cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028cf:	c9                   	leave
+  8028d0:	c3                   	ret
+
+00000000008028d1 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8028d1:	55                   	push   %rbp
+  8028d2:	48 89 e5             	mov    %rsp,%rbp
+  8028d5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028d6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028ea:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8028f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802900:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802902:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+
+0000000000802908 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802908:	55                   	push   %rbp
+  802909:	48 89 e5             	mov    %rsp,%rbp
+  80290c:	53                   	push   %rbx
+  80290d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802910:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802915:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80291a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80291f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802924:	be 00 00 00 00       	mov    $0x0,%esi
+  802929:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80292f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802935:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802937:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+
+000000000080293d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80293d:	55                   	push   %rbp
+  80293e:	48 89 e5             	mov    %rsp,%rbp
+  802941:	53                   	push   %rbx
+  802942:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802946:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802949:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80294e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802953:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802958:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80295d:	be 00 00 00 00       	mov    $0x0,%esi
+  802962:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802968:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80296e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802970:	48 85 c0             	test   %rax,%rax
+  802973:	7f 06                	jg     80297b <sys_env_destroy+0x3e>
+}
+  802975:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802979:	c9                   	leave
+  80297a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80297b:	49 89 c0             	mov    %rax,%r8
+  80297e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802983:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  80298a:	00 00 00 
+  80298d:	be 27 00 00 00       	mov    $0x27,%esi
+  802992:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802999:	00 00 00 
+  80299c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a1:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  8029a8:	00 00 00 
+  8029ab:	41 ff d1             	call   *%r9
+
+00000000008029ae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8029ae:	55                   	push   %rbp
+  8029af:	48 89 e5             	mov    %rsp,%rbp
+  8029b2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029b3:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029c7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029dd:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029e3:	c9                   	leave
+  8029e4:	c3                   	ret
+
+00000000008029e5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8029e5:	55                   	push   %rbp
+  8029e6:	48 89 e5             	mov    %rsp,%rbp
+  8029e9:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029fe:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a03:	be 00 00 00 00       	mov    $0x0,%esi
+  802a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a14:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a16:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a1a:	c9                   	leave
+  802a1b:	c3                   	ret
+
+0000000000802a1c <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	53                   	push   %rbx
+  802a21:	48 89 fa             	mov    %rdi,%rdx
+  802a24:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a27:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a2c:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a33:	00 00 00 
+  802a36:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a46:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a4c:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802a4e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a52:	c9                   	leave
+  802a53:	c3                   	ret
+
+0000000000802a54 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802a54:	55                   	push   %rbp
+  802a55:	48 89 e5             	mov    %rsp,%rbp
+  802a58:	53                   	push   %rbx
+  802a59:	49 89 f8             	mov    %rdi,%r8
+  802a5c:	48 89 d3             	mov    %rdx,%rbx
+  802a5f:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802a62:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a67:	4c 89 c2             	mov    %r8,%rdx
+  802a6a:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7e:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802a80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a84:	c9                   	leave
+  802a85:	c3                   	ret
+
+0000000000802a86 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802a86:	55                   	push   %rbp
+  802a87:	48 89 e5             	mov    %rsp,%rbp
+  802a8a:	53                   	push   %rbx
+  802a8b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a8f:	89 f8                	mov    %edi,%eax
+  802a91:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802a94:	48 63 f9             	movslq %ecx,%rdi
+  802a97:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a9a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a9f:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa2:	be 00 00 00 00       	mov    $0x0,%esi
+  802aa7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ab5:	48 85 c0             	test   %rax,%rax
+  802ab8:	7f 06                	jg     802ac0 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802aba:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abe:	c9                   	leave
+  802abf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ac0:	49 89 c0             	mov    %rax,%r8
+  802ac3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802ac8:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802acf:	00 00 00 
+  802ad2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ad7:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802ade:	00 00 00 
+  802ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae6:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802aed:	00 00 00 
+  802af0:	41 ff d1             	call   *%r9
+
+0000000000802af3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	53                   	push   %rbx
+  802af8:	48 83 ec 08          	sub    $0x8,%rsp
+  802afc:	89 f8                	mov    %edi,%eax
+  802afe:	49 89 f2             	mov    %rsi,%r10
+  802b01:	48 89 cf             	mov    %rcx,%rdi
+  802b04:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b07:	48 63 da             	movslq %edx,%rbx
+  802b0a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b0d:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b12:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b15:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b18:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b1e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b20:	48 85 c0             	test   %rax,%rax
+  802b23:	7f 06                	jg     802b2b <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b25:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b29:	c9                   	leave
+  802b2a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b2b:	49 89 c0             	mov    %rax,%r8
+  802b2e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b33:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802b3a:	00 00 00 
+  802b3d:	be 27 00 00 00       	mov    $0x27,%esi
+  802b42:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802b49:	00 00 00 
+  802b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b51:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802b58:	00 00 00 
+  802b5b:	41 ff d1             	call   *%r9
+
+0000000000802b5e <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802b5e:	55                   	push   %rbp
+  802b5f:	48 89 e5             	mov    %rsp,%rbp
+  802b62:	53                   	push   %rbx
+  802b63:	48 83 ec 08          	sub    $0x8,%rsp
+  802b67:	48 89 f1             	mov    %rsi,%rcx
+  802b6a:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802b6d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b70:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b75:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b85:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b8b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b8d:	48 85 c0             	test   %rax,%rax
+  802b90:	7f 06                	jg     802b98 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802b92:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b96:	c9                   	leave
+  802b97:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b98:	49 89 c0             	mov    %rax,%r8
+  802b9b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ba0:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802ba7:	00 00 00 
+  802baa:	be 27 00 00 00       	mov    $0x27,%esi
+  802baf:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802bb6:	00 00 00 
+  802bb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbe:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802bc5:	00 00 00 
+  802bc8:	41 ff d1             	call   *%r9
+
+0000000000802bcb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802bcb:	55                   	push   %rbp
+  802bcc:	48 89 e5             	mov    %rsp,%rbp
+  802bcf:	53                   	push   %rbx
+  802bd0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802bd4:	48 63 ce             	movslq %esi,%rcx
+  802bd7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bda:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802be4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802be9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bf4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bfa:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bfc:	48 85 c0             	test   %rax,%rax
+  802bff:	7f 06                	jg     802c07 <sys_env_set_status+0x3c>
+}
+  802c01:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c05:	c9                   	leave
+  802c06:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c07:	49 89 c0             	mov    %rax,%r8
+  802c0a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c0f:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802c16:	00 00 00 
+  802c19:	be 27 00 00 00       	mov    $0x27,%esi
+  802c1e:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802c25:	00 00 00 
+  802c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2d:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802c34:	00 00 00 
+  802c37:	41 ff d1             	call   *%r9
+
+0000000000802c3a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c3a:	55                   	push   %rbp
+  802c3b:	48 89 e5             	mov    %rsp,%rbp
+  802c3e:	53                   	push   %rbx
+  802c3f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c43:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802c46:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c49:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c53:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c58:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c69:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c6b:	48 85 c0             	test   %rax,%rax
+  802c6e:	7f 06                	jg     802c76 <sys_env_set_trapframe+0x3c>
+}
+  802c70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c74:	c9                   	leave
+  802c75:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c76:	49 89 c0             	mov    %rax,%r8
+  802c79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802c7e:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802c85:	00 00 00 
+  802c88:	be 27 00 00 00       	mov    $0x27,%esi
+  802c8d:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802c94:	00 00 00 
+  802c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9c:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802ca3:	00 00 00 
+  802ca6:	41 ff d1             	call   *%r9
+
+0000000000802ca9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802ca9:	55                   	push   %rbp
+  802caa:	48 89 e5             	mov    %rsp,%rbp
+  802cad:	53                   	push   %rbx
+  802cae:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb2:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802cb5:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cb8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cc7:	be 00 00 00 00       	mov    $0x0,%esi
+  802ccc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cda:	48 85 c0             	test   %rax,%rax
+  802cdd:	7f 06                	jg     802ce5 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802cdf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ce3:	c9                   	leave
+  802ce4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce5:	49 89 c0             	mov    %rax,%r8
+  802ce8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802ced:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802cf4:	00 00 00 
+  802cf7:	be 27 00 00 00       	mov    $0x27,%esi
+  802cfc:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802d03:	00 00 00 
+  802d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0b:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802d12:	00 00 00 
+  802d15:	41 ff d1             	call   *%r9
+
+0000000000802d18 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d18:	55                   	push   %rbp
+  802d19:	48 89 e5             	mov    %rsp,%rbp
+  802d1c:	53                   	push   %rbx
+  802d1d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d21:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d25:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d28:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d32:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d37:	be 00 00 00 00       	mov    $0x0,%esi
+  802d3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d42:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d48:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d4a:	48 85 c0             	test   %rax,%rax
+  802d4d:	7f 06                	jg     802d55 <sys_env_set_reclaim+0x3d>
+}
+  802d4f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d55:	49 89 c0             	mov    %rax,%r8
+  802d58:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802d5d:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802d64:	00 00 00 
+  802d67:	be 27 00 00 00       	mov    $0x27,%esi
+  802d6c:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802d73:	00 00 00 
+  802d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d7b:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802d82:	00 00 00 
+  802d85:	41 ff d1             	call   *%r9
+
+0000000000802d88 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802d88:	55                   	push   %rbp
+  802d89:	48 89 e5             	mov    %rsp,%rbp
+  802d8c:	53                   	push   %rbx
+  802d8d:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802d91:	48 63 ce             	movslq %esi,%rcx
+  802d94:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d97:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802da6:	be 00 00 00 00       	mov    $0x0,%esi
+  802dab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802db1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db9:	48 85 c0             	test   %rax,%rax
+  802dbc:	7f 06                	jg     802dc4 <sys_env_set_nice+0x3c>
+}
+  802dbe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dc2:	c9                   	leave
+  802dc3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dc4:	49 89 c0             	mov    %rax,%r8
+  802dc7:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802dcc:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802dd3:	00 00 00 
+  802dd6:	be 27 00 00 00       	mov    $0x27,%esi
+  802ddb:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802de2:	00 00 00 
+  802de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dea:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802df1:	00 00 00 
+  802df4:	41 ff d1             	call   *%r9
+
+0000000000802df7 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802df7:	55                   	push   %rbp
+  802df8:	48 89 e5             	mov    %rsp,%rbp
+  802dfb:	53                   	push   %rbx
+  802dfc:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dff:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e04:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e13:	be 00 00 00 00       	mov    $0x0,%esi
+  802e18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e24:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2a:	c9                   	leave
+  802e2b:	c3                   	ret
+
+0000000000802e2c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e2c:	55                   	push   %rbp
+  802e2d:	48 89 e5             	mov    %rsp,%rbp
+  802e30:	53                   	push   %rbx
+  802e31:	89 f8                	mov    %edi,%eax
+  802e33:	49 89 f1             	mov    %rsi,%r9
+  802e36:	48 89 d3             	mov    %rdx,%rbx
+  802e39:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e3c:	49 63 f0             	movslq %r8d,%rsi
+  802e3f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e42:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e47:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e56:	cd 30                	int    $0x30
+}
+  802e58:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e5c:	c9                   	leave
+  802e5d:	c3                   	ret
+
+0000000000802e5e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e5e:	55                   	push   %rbp
+  802e5f:	48 89 e5             	mov    %rsp,%rbp
+  802e62:	53                   	push   %rbx
+  802e63:	89 f8                	mov    %edi,%eax
+  802e65:	49 89 f1             	mov    %rsi,%r9
+  802e68:	48 89 d3             	mov    %rdx,%rbx
+  802e6b:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e6e:	49 63 f0             	movslq %r8d,%rsi
+  802e71:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e74:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e79:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e88:	cd 30                	int    $0x30
+}
+  802e8a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e8e:	c9                   	leave
+  802e8f:	c3                   	ret
+
+0000000000802e90 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e90:	55                   	push   %rbp
+  802e91:	48 89 e5             	mov    %rsp,%rbp
+  802e94:	53                   	push   %rbx
+  802e95:	48 83 ec 08          	sub    $0x8,%rsp
+  802e99:	89 f8                	mov    %edi,%eax
+  802e9b:	49 89 f2             	mov    %rsi,%r10
+  802e9e:	48 89 d3             	mov    %rdx,%rbx
+  802ea1:	48 89 cf             	mov    %rcx,%rdi
+  802ea4:	44 89 c6             	mov    %r8d,%esi
+  802ea7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802eaa:	48 63 f6             	movslq %esi,%rsi
+  802ead:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802eb0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802eb5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802eb8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ebc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ebe:	48 85 c0             	test   %rax,%rax
+  802ec1:	7f 06                	jg     802ec9 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ec3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ec7:	c9                   	leave
+  802ec8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ec9:	49 89 c0             	mov    %rax,%r8
+  802ecc:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802ed1:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802ed8:	00 00 00 
+  802edb:	be 27 00 00 00       	mov    $0x27,%esi
+  802ee0:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802ee7:	00 00 00 
+  802eea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eef:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802ef6:	00 00 00 
+  802ef9:	41 ff d1             	call   *%r9
+
+0000000000802efc <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802efc:	55                   	push   %rbp
+  802efd:	48 89 e5             	mov    %rsp,%rbp
+  802f00:	53                   	push   %rbx
+  802f01:	48 83 ec 08          	sub    $0x8,%rsp
+  802f05:	48 89 f1             	mov    %rsi,%rcx
+  802f08:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f0b:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f0f:	48 8b 1a             	mov    (%rdx),%rbx
+  802f12:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f15:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f1a:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f1e:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f22:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f26:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f28:	48 85 c0             	test   %rax,%rax
+  802f2b:	7f 06                	jg     802f33 <sys_ipc_call_short+0x37>
+}
+  802f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f33:	49 89 c0             	mov    %rax,%r8
+  802f36:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f3b:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802f42:	00 00 00 
+  802f45:	be 27 00 00 00       	mov    $0x27,%esi
+  802f4a:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802f51:	00 00 00 
+  802f54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f59:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802f60:	00 00 00 
+  802f63:	41 ff d1             	call   *%r9
+
+0000000000802f66 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f66:	55                   	push   %rbp
+  802f67:	48 89 e5             	mov    %rsp,%rbp
+  802f6a:	53                   	push   %rbx
+  802f6b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f6f:	89 f8                	mov    %edi,%eax
+  802f71:	49 89 f2             	mov    %rsi,%r10
+  802f74:	48 89 d3             	mov    %rdx,%rbx
+  802f77:	48 89 cf             	mov    %rcx,%rdi
+  802f7a:	44 89 c6             	mov    %r8d,%esi
+  802f7d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f80:	48 63 f6             	movslq %esi,%rsi
+  802f83:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f86:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f8b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f8e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f92:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f94:	48 85 c0             	test   %rax,%rax
+  802f97:	7f 06                	jg     802f9f <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f99:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f9d:	c9                   	leave
+  802f9e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f9f:	49 89 c0             	mov    %rax,%r8
+  802fa2:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802fa7:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  802fae:	00 00 00 
+  802fb1:	be 27 00 00 00       	mov    $0x27,%esi
+  802fb6:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  802fbd:	00 00 00 
+  802fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc5:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  802fcc:	00 00 00 
+  802fcf:	41 ff d1             	call   *%r9
+
+0000000000802fd2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802fd2:	55                   	push   %rbp
+  802fd3:	48 89 e5             	mov    %rsp,%rbp
+  802fd6:	53                   	push   %rbx
+  802fd7:	48 83 ec 08          	sub    $0x8,%rsp
+  802fdb:	48 89 fa             	mov    %rdi,%rdx
+  802fde:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802fe1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802feb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ff0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ffb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803001:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803003:	48 85 c0             	test   %rax,%rax
+  803006:	7f 06                	jg     80300e <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803008:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80300c:	c9                   	leave
+  80300d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80300e:	49 89 c0             	mov    %rax,%r8
+  803011:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803016:	48 ba a8 67 80 00 00 	movabs $0x8067a8,%rdx
+  80301d:	00 00 00 
+  803020:	be 27 00 00 00       	mov    $0x27,%esi
+  803025:	48 bf c7 67 80 00 00 	movabs $0x8067c7,%rdi
+  80302c:	00 00 00 
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803034:	49 b9 9a 18 80 00 00 	movabs $0x80189a,%r9
+  80303b:	00 00 00 
+  80303e:	41 ff d1             	call   *%r9
+
+0000000000803041 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803041:	55                   	push   %rbp
+  803042:	48 89 e5             	mov    %rsp,%rbp
+  803045:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803046:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80304b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803050:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80305a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80305f:	be 00 00 00 00       	mov    $0x0,%esi
+  803064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80306a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803070:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803072:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+0000000000803078 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803078:	55                   	push   %rbp
+  803079:	48 89 e5             	mov    %rsp,%rbp
+  80307c:	53                   	push   %rbx
+  80307d:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803080:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803085:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80308a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803094:	be 00 00 00 00       	mov    $0x0,%esi
+  803099:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80309f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030a5:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  8030a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ab:	c9                   	leave
+  8030ac:	c3                   	ret
+
+00000000008030ad <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  8030ad:	55                   	push   %rbp
+  8030ae:	48 89 e5             	mov    %rsp,%rbp
+  8030b1:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030b2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030c6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030dc:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030de:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e2:	c9                   	leave
+  8030e3:	c3                   	ret
+
+00000000008030e4 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8030e4:	55                   	push   %rbp
+  8030e5:	48 89 e5             	mov    %rsp,%rbp
+  8030e8:	53                   	push   %rbx
+  8030e9:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8030ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8030f2:	cd 30                	int    $0x30
+  8030f4:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  8030f6:	85 c0                	test   %eax,%eax
+  8030f8:	0f 88 85 00 00 00    	js     803183 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8030fe:	0f 84 ac 00 00 00    	je     8031b0 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803104:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80310a:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803111:	00 00 00 
+  803114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803119:	89 c2                	mov    %eax,%edx
+  80311b:	be 00 00 00 00       	mov    $0x0,%esi
+  803120:	bf 00 00 00 00       	mov    $0x0,%edi
+  803125:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+  803131:	85 c0                	test   %eax,%eax
+  803133:	0f 88 a8 00 00 00    	js     8031e1 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  803139:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  803140:	00 00 00 
+  803143:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  80314a:	89 df                	mov    %ebx,%edi
+  80314c:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  803153:	00 00 00 
+  803156:	ff d0                	call   *%rax
+  803158:	85 c0                	test   %eax,%eax
+  80315a:	0f 88 ae 00 00 00    	js     80320e <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803160:	be 02 00 00 00       	mov    $0x2,%esi
+  803165:	89 df                	mov    %ebx,%edi
+  803167:	48 b8 cb 2b 80 00 00 	movabs $0x802bcb,%rax
+  80316e:	00 00 00 
+  803171:	ff d0                	call   *%rax
+  803173:	85 c0                	test   %eax,%eax
+  803175:	0f 88 c0 00 00 00    	js     80323b <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  80317b:	89 d8                	mov    %ebx,%eax
+  80317d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803181:	c9                   	leave
+  803182:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803183:	89 c1                	mov    %eax,%ecx
+  803185:	48 ba d5 67 80 00 00 	movabs $0x8067d5,%rdx
+  80318c:	00 00 00 
+  80318f:	be 20 00 00 00       	mov    $0x20,%esi
+  803194:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  80319b:	00 00 00 
+  80319e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a3:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  8031aa:	00 00 00 
+  8031ad:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8031b0:	48 b8 ae 29 80 00 00 	movabs $0x8029ae,%rax
+  8031b7:	00 00 00 
+  8031ba:	ff d0                	call   *%rax
+  8031bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031c1:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8031c8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8031cf:	00 00 00 
+  8031d2:	48 01 d0             	add    %rdx,%rax
+  8031d5:	48 a3 20 84 80 01 00 	movabs %rax,0x1808420
+  8031dc:	00 00 00 
+        return 0;
+  8031df:	eb 9a                	jmp    80317b <fork+0x97>
+        panic("sys_map_region: %i", res);
+  8031e1:	89 c1                	mov    %eax,%ecx
+  8031e3:	48 ba f0 67 80 00 00 	movabs $0x8067f0,%rdx
+  8031ea:	00 00 00 
+  8031ed:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8031f2:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  8031f9:	00 00 00 
+  8031fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803201:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803208:	00 00 00 
+  80320b:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  80320e:	89 c1                	mov    %eax,%ecx
+  803210:	48 ba 38 68 80 00 00 	movabs $0x806838,%rdx
+  803217:	00 00 00 
+  80321a:	be 32 00 00 00       	mov    $0x32,%esi
+  80321f:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  803226:	00 00 00 
+  803229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80322e:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803235:	00 00 00 
+  803238:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  80323b:	89 c1                	mov    %eax,%ecx
+  80323d:	48 ba 03 68 80 00 00 	movabs $0x806803,%rdx
+  803244:	00 00 00 
+  803247:	be 37 00 00 00       	mov    $0x37,%esi
+  80324c:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  803253:	00 00 00 
+  803256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325b:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803262:	00 00 00 
+  803265:	41 ff d0             	call   *%r8
+
+0000000000803268 <sfork>:
+
+envid_t
+sfork() {
+  803268:	55                   	push   %rbp
+  803269:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80326c:	48 ba 1a 68 80 00 00 	movabs $0x80681a,%rdx
+  803273:	00 00 00 
+  803276:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80327b:	48 bf e5 67 80 00 00 	movabs $0x8067e5,%rdi
+  803282:	00 00 00 
+  803285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328a:	48 b9 9a 18 80 00 00 	movabs $0x80189a,%rcx
+  803291:	00 00 00 
+  803294:	ff d1                	call   *%rcx
+
+0000000000803296 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803296:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80329d:	ff ff ff 
+  8032a0:	48 01 f8             	add    %rdi,%rax
+  8032a3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8032a7:	c3                   	ret
+
+00000000008032a8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8032a8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8032af:	ff ff ff 
+  8032b2:	48 01 f8             	add    %rdi,%rax
+  8032b5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8032b9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8032bf:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8032c3:	c3                   	ret
+
+00000000008032c4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8032c4:	55                   	push   %rbp
+  8032c5:	48 89 e5             	mov    %rsp,%rbp
+  8032c8:	41 57                	push   %r15
+  8032ca:	41 56                	push   %r14
+  8032cc:	41 55                	push   %r13
+  8032ce:	41 54                	push   %r12
+  8032d0:	53                   	push   %rbx
+  8032d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8032d5:	49 89 ff             	mov    %rdi,%r15
+  8032d8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8032dd:	49 bd 7d 48 80 00 00 	movabs $0x80487d,%r13
+  8032e4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8032e7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8032ed:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8032f0:	48 89 df             	mov    %rbx,%rdi
+  8032f3:	41 ff d5             	call   *%r13
+  8032f6:	83 e0 04             	and    $0x4,%eax
+  8032f9:	74 17                	je     803312 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8032fb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803302:	4c 39 f3             	cmp    %r14,%rbx
+  803305:	75 e6                	jne    8032ed <fd_alloc+0x29>
+  803307:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80330d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803312:	4d 89 27             	mov    %r12,(%r15)
+}
+  803315:	48 83 c4 08          	add    $0x8,%rsp
+  803319:	5b                   	pop    %rbx
+  80331a:	41 5c                	pop    %r12
+  80331c:	41 5d                	pop    %r13
+  80331e:	41 5e                	pop    %r14
+  803320:	41 5f                	pop    %r15
+  803322:	5d                   	pop    %rbp
+  803323:	c3                   	ret
+
+0000000000803324 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803324:	83 ff 1f             	cmp    $0x1f,%edi
+  803327:	77 39                	ja     803362 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803329:	55                   	push   %rbp
+  80332a:	48 89 e5             	mov    %rsp,%rbp
+  80332d:	41 54                	push   %r12
+  80332f:	53                   	push   %rbx
+  803330:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803333:	48 63 df             	movslq %edi,%rbx
+  803336:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80333d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803341:	48 89 df             	mov    %rbx,%rdi
+  803344:	48 b8 7d 48 80 00 00 	movabs $0x80487d,%rax
+  80334b:	00 00 00 
+  80334e:	ff d0                	call   *%rax
+  803350:	a8 04                	test   $0x4,%al
+  803352:	74 14                	je     803368 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803354:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803358:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80335d:	5b                   	pop    %rbx
+  80335e:	41 5c                	pop    %r12
+  803360:	5d                   	pop    %rbp
+  803361:	c3                   	ret
+        return -E_INVAL;
+  803362:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803367:	c3                   	ret
+        return -E_INVAL;
+  803368:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80336d:	eb ee                	jmp    80335d <fd_lookup+0x39>
+
+000000000080336f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80336f:	55                   	push   %rbp
+  803370:	48 89 e5             	mov    %rsp,%rbp
+  803373:	41 54                	push   %r12
+  803375:	53                   	push   %rbx
+  803376:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803379:	48 b8 e0 68 80 00 00 	movabs $0x8068e0,%rax
+  803380:	00 00 00 
+  803383:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  80338a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80338d:	39 3b                	cmp    %edi,(%rbx)
+  80338f:	74 47                	je     8033d8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803391:	48 83 c0 08          	add    $0x8,%rax
+  803395:	48 8b 18             	mov    (%rax),%rbx
+  803398:	48 85 db             	test   %rbx,%rbx
+  80339b:	75 f0                	jne    80338d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80339d:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8033a4:	00 00 00 
+  8033a7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8033ad:	89 fa                	mov    %edi,%edx
+  8033af:	48 bf 58 68 80 00 00 	movabs $0x806858,%rdi
+  8033b6:	00 00 00 
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033be:	48 b9 ea 19 80 00 00 	movabs $0x8019ea,%rcx
+  8033c5:	00 00 00 
+  8033c8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8033ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8033cf:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8033d3:	5b                   	pop    %rbx
+  8033d4:	41 5c                	pop    %r12
+  8033d6:	5d                   	pop    %rbp
+  8033d7:	c3                   	ret
+            return 0;
+  8033d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033dd:	eb f0                	jmp    8033cf <dev_lookup+0x60>
+
+00000000008033df <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8033df:	55                   	push   %rbp
+  8033e0:	48 89 e5             	mov    %rsp,%rbp
+  8033e3:	41 55                	push   %r13
+  8033e5:	41 54                	push   %r12
+  8033e7:	53                   	push   %rbx
+  8033e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8033ec:	48 89 fb             	mov    %rdi,%rbx
+  8033ef:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033f2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8033f9:	ff ff ff 
+  8033fc:	48 01 df             	add    %rbx,%rdi
+  8033ff:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803403:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803407:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+  803413:	41 89 c5             	mov    %eax,%r13d
+  803416:	85 c0                	test   %eax,%eax
+  803418:	78 06                	js     803420 <fd_close+0x41>
+  80341a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80341e:	74 1a                	je     80343a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803420:	45 84 e4             	test   %r12b,%r12b
+  803423:	b8 00 00 00 00       	mov    $0x0,%eax
+  803428:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80342c:	44 89 e8             	mov    %r13d,%eax
+  80342f:	48 83 c4 18          	add    $0x18,%rsp
+  803433:	5b                   	pop    %rbx
+  803434:	41 5c                	pop    %r12
+  803436:	41 5d                	pop    %r13
+  803438:	5d                   	pop    %rbp
+  803439:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80343a:	8b 3b                	mov    (%rbx),%edi
+  80343c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803440:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  803447:	00 00 00 
+  80344a:	ff d0                	call   *%rax
+  80344c:	41 89 c5             	mov    %eax,%r13d
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 1b                	js     80346e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803453:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803457:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80345b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803461:	48 85 c0             	test   %rax,%rax
+  803464:	74 08                	je     80346e <fd_close+0x8f>
+  803466:	48 89 df             	mov    %rbx,%rdi
+  803469:	ff d0                	call   *%rax
+  80346b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80346e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803473:	48 89 de             	mov    %rbx,%rsi
+  803476:	bf 00 00 00 00       	mov    $0x0,%edi
+  80347b:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  803482:	00 00 00 
+  803485:	ff d0                	call   *%rax
+    return res;
+  803487:	eb a3                	jmp    80342c <fd_close+0x4d>
+
+0000000000803489 <close>:
+
+int
+close(int fdnum) {
+  803489:	55                   	push   %rbp
+  80348a:	48 89 e5             	mov    %rsp,%rbp
+  80348d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803491:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803495:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  80349c:	00 00 00 
+  80349f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	78 15                	js     8034ba <close+0x31>
+
+    return fd_close(fd, 1);
+  8034a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8034aa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8034ae:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  8034b5:	00 00 00 
+  8034b8:	ff d0                	call   *%rax
+}
+  8034ba:	c9                   	leave
+  8034bb:	c3                   	ret
+
+00000000008034bc <close_all>:
+
+void
+close_all(void) {
+  8034bc:	55                   	push   %rbp
+  8034bd:	48 89 e5             	mov    %rsp,%rbp
+  8034c0:	41 54                	push   %r12
+  8034c2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8034c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034c8:	49 bc 89 34 80 00 00 	movabs $0x803489,%r12
+  8034cf:	00 00 00 
+  8034d2:	89 df                	mov    %ebx,%edi
+  8034d4:	41 ff d4             	call   *%r12
+  8034d7:	83 c3 01             	add    $0x1,%ebx
+  8034da:	83 fb 20             	cmp    $0x20,%ebx
+  8034dd:	75 f3                	jne    8034d2 <close_all+0x16>
+}
+  8034df:	5b                   	pop    %rbx
+  8034e0:	41 5c                	pop    %r12
+  8034e2:	5d                   	pop    %rbp
+  8034e3:	c3                   	ret
+
+00000000008034e4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8034e4:	55                   	push   %rbp
+  8034e5:	48 89 e5             	mov    %rsp,%rbp
+  8034e8:	41 57                	push   %r15
+  8034ea:	41 56                	push   %r14
+  8034ec:	41 55                	push   %r13
+  8034ee:	41 54                	push   %r12
+  8034f0:	53                   	push   %rbx
+  8034f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8034f5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8034f8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034fc:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803503:	00 00 00 
+  803506:	ff d0                	call   *%rax
+  803508:	89 c3                	mov    %eax,%ebx
+  80350a:	85 c0                	test   %eax,%eax
+  80350c:	0f 88 b8 00 00 00    	js     8035ca <dup+0xe6>
+    close(newfdnum);
+  803512:	44 89 e7             	mov    %r12d,%edi
+  803515:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803521:	4d 63 ec             	movslq %r12d,%r13
+  803524:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80352b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80352f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803533:	4c 89 ff             	mov    %r15,%rdi
+  803536:	49 be a8 32 80 00 00 	movabs $0x8032a8,%r14
+  80353d:	00 00 00 
+  803540:	41 ff d6             	call   *%r14
+  803543:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803546:	4c 89 ef             	mov    %r13,%rdi
+  803549:	41 ff d6             	call   *%r14
+  80354c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80354f:	48 89 df             	mov    %rbx,%rdi
+  803552:	48 b8 7d 48 80 00 00 	movabs $0x80487d,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80355e:	a8 04                	test   $0x4,%al
+  803560:	74 2b                	je     80358d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803562:	41 89 c1             	mov    %eax,%r9d
+  803565:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80356b:	4c 89 f1             	mov    %r14,%rcx
+  80356e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803573:	48 89 de             	mov    %rbx,%rsi
+  803576:	bf 00 00 00 00       	mov    $0x0,%edi
+  80357b:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  803582:	00 00 00 
+  803585:	ff d0                	call   *%rax
+  803587:	89 c3                	mov    %eax,%ebx
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	78 4e                	js     8035db <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80358d:	4c 89 ff             	mov    %r15,%rdi
+  803590:	48 b8 7d 48 80 00 00 	movabs $0x80487d,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+  80359c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80359f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8035a5:	4c 89 e9             	mov    %r13,%rcx
+  8035a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ad:	4c 89 fe             	mov    %r15,%rsi
+  8035b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b5:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+  8035c1:	89 c3                	mov    %eax,%ebx
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	78 14                	js     8035db <dup+0xf7>
+
+    return newfdnum;
+  8035c7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8035ca:	89 d8                	mov    %ebx,%eax
+  8035cc:	48 83 c4 18          	add    $0x18,%rsp
+  8035d0:	5b                   	pop    %rbx
+  8035d1:	41 5c                	pop    %r12
+  8035d3:	41 5d                	pop    %r13
+  8035d5:	41 5e                	pop    %r14
+  8035d7:	41 5f                	pop    %r15
+  8035d9:	5d                   	pop    %rbp
+  8035da:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8035db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035e0:	4c 89 ee             	mov    %r13,%rsi
+  8035e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e8:	49 bc 5e 2b 80 00 00 	movabs $0x802b5e,%r12
+  8035ef:	00 00 00 
+  8035f2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8035f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035fa:	4c 89 f6             	mov    %r14,%rsi
+  8035fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803602:	41 ff d4             	call   *%r12
+    return res;
+  803605:	eb c3                	jmp    8035ca <dup+0xe6>
+
+0000000000803607 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803607:	55                   	push   %rbp
+  803608:	48 89 e5             	mov    %rsp,%rbp
+  80360b:	41 56                	push   %r14
+  80360d:	41 55                	push   %r13
+  80360f:	41 54                	push   %r12
+  803611:	53                   	push   %rbx
+  803612:	48 83 ec 10          	sub    $0x10,%rsp
+  803616:	89 fb                	mov    %edi,%ebx
+  803618:	49 89 f4             	mov    %rsi,%r12
+  80361b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80361e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803622:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803629:	00 00 00 
+  80362c:	ff d0                	call   *%rax
+  80362e:	85 c0                	test   %eax,%eax
+  803630:	78 4c                	js     80367e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803632:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803636:	41 8b 3e             	mov    (%r14),%edi
+  803639:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80363d:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  803644:	00 00 00 
+  803647:	ff d0                	call   *%rax
+  803649:	85 c0                	test   %eax,%eax
+  80364b:	78 35                	js     803682 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80364d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803651:	83 e0 03             	and    $0x3,%eax
+  803654:	83 f8 01             	cmp    $0x1,%eax
+  803657:	74 2d                	je     803686 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803659:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80365d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803661:	48 85 c0             	test   %rax,%rax
+  803664:	74 56                	je     8036bc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803666:	4c 89 ea             	mov    %r13,%rdx
+  803669:	4c 89 e6             	mov    %r12,%rsi
+  80366c:	4c 89 f7             	mov    %r14,%rdi
+  80366f:	ff d0                	call   *%rax
+}
+  803671:	48 83 c4 10          	add    $0x10,%rsp
+  803675:	5b                   	pop    %rbx
+  803676:	41 5c                	pop    %r12
+  803678:	41 5d                	pop    %r13
+  80367a:	41 5e                	pop    %r14
+  80367c:	5d                   	pop    %rbp
+  80367d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80367e:	48 98                	cltq
+  803680:	eb ef                	jmp    803671 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803682:	48 98                	cltq
+  803684:	eb eb                	jmp    803671 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803686:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  80368d:	00 00 00 
+  803690:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803696:	89 da                	mov    %ebx,%edx
+  803698:	48 bf 99 68 80 00 00 	movabs $0x806899,%rdi
+  80369f:	00 00 00 
+  8036a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a7:	48 b9 ea 19 80 00 00 	movabs $0x8019ea,%rcx
+  8036ae:	00 00 00 
+  8036b1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8036b3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036ba:	eb b5                	jmp    803671 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036bc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036c3:	eb ac                	jmp    803671 <read+0x6a>
+
+00000000008036c5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036c5:	55                   	push   %rbp
+  8036c6:	48 89 e5             	mov    %rsp,%rbp
+  8036c9:	41 57                	push   %r15
+  8036cb:	41 56                	push   %r14
+  8036cd:	41 55                	push   %r13
+  8036cf:	41 54                	push   %r12
+  8036d1:	53                   	push   %rbx
+  8036d2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8036d6:	48 85 d2             	test   %rdx,%rdx
+  8036d9:	74 54                	je     80372f <readn+0x6a>
+  8036db:	41 89 fd             	mov    %edi,%r13d
+  8036de:	49 89 f6             	mov    %rsi,%r14
+  8036e1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8036e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8036e9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8036ee:	49 bf 07 36 80 00 00 	movabs $0x803607,%r15
+  8036f5:	00 00 00 
+  8036f8:	4c 89 e2             	mov    %r12,%rdx
+  8036fb:	48 29 f2             	sub    %rsi,%rdx
+  8036fe:	4c 01 f6             	add    %r14,%rsi
+  803701:	44 89 ef             	mov    %r13d,%edi
+  803704:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803707:	85 c0                	test   %eax,%eax
+  803709:	78 20                	js     80372b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80370b:	01 c3                	add    %eax,%ebx
+  80370d:	85 c0                	test   %eax,%eax
+  80370f:	74 08                	je     803719 <readn+0x54>
+  803711:	48 63 f3             	movslq %ebx,%rsi
+  803714:	4c 39 e6             	cmp    %r12,%rsi
+  803717:	72 df                	jb     8036f8 <readn+0x33>
+    }
+    return res;
+  803719:	48 63 c3             	movslq %ebx,%rax
+}
+  80371c:	48 83 c4 08          	add    $0x8,%rsp
+  803720:	5b                   	pop    %rbx
+  803721:	41 5c                	pop    %r12
+  803723:	41 5d                	pop    %r13
+  803725:	41 5e                	pop    %r14
+  803727:	41 5f                	pop    %r15
+  803729:	5d                   	pop    %rbp
+  80372a:	c3                   	ret
+        if (inc < 0) return inc;
+  80372b:	48 98                	cltq
+  80372d:	eb ed                	jmp    80371c <readn+0x57>
+    int inc = 1, res = 0;
+  80372f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803734:	eb e3                	jmp    803719 <readn+0x54>
+
+0000000000803736 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	41 56                	push   %r14
+  80373c:	41 55                	push   %r13
+  80373e:	41 54                	push   %r12
+  803740:	53                   	push   %rbx
+  803741:	48 83 ec 10          	sub    $0x10,%rsp
+  803745:	89 fb                	mov    %edi,%ebx
+  803747:	49 89 f4             	mov    %rsi,%r12
+  80374a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80374d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803751:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	78 47                	js     8037a8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803761:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803765:	41 8b 3e             	mov    (%r14),%edi
+  803768:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80376c:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  803773:	00 00 00 
+  803776:	ff d0                	call   *%rax
+  803778:	85 c0                	test   %eax,%eax
+  80377a:	78 30                	js     8037ac <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80377c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803781:	74 2d                	je     8037b0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803783:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803787:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80378b:	48 85 c0             	test   %rax,%rax
+  80378e:	74 56                	je     8037e6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803790:	4c 89 ea             	mov    %r13,%rdx
+  803793:	4c 89 e6             	mov    %r12,%rsi
+  803796:	4c 89 f7             	mov    %r14,%rdi
+  803799:	ff d0                	call   *%rax
+}
+  80379b:	48 83 c4 10          	add    $0x10,%rsp
+  80379f:	5b                   	pop    %rbx
+  8037a0:	41 5c                	pop    %r12
+  8037a2:	41 5d                	pop    %r13
+  8037a4:	41 5e                	pop    %r14
+  8037a6:	5d                   	pop    %rbp
+  8037a7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037a8:	48 98                	cltq
+  8037aa:	eb ef                	jmp    80379b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037ac:	48 98                	cltq
+  8037ae:	eb eb                	jmp    80379b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8037b0:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8037b7:	00 00 00 
+  8037ba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037c0:	89 da                	mov    %ebx,%edx
+  8037c2:	48 bf b5 68 80 00 00 	movabs $0x8068b5,%rdi
+  8037c9:	00 00 00 
+  8037cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d1:	48 b9 ea 19 80 00 00 	movabs $0x8019ea,%rcx
+  8037d8:	00 00 00 
+  8037db:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037dd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037e4:	eb b5                	jmp    80379b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037e6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037ed:	eb ac                	jmp    80379b <write+0x65>
+
+00000000008037ef <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8037ef:	55                   	push   %rbp
+  8037f0:	48 89 e5             	mov    %rsp,%rbp
+  8037f3:	53                   	push   %rbx
+  8037f4:	48 83 ec 18          	sub    $0x18,%rsp
+  8037f8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037fa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8037fe:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803805:	00 00 00 
+  803808:	ff d0                	call   *%rax
+  80380a:	85 c0                	test   %eax,%eax
+  80380c:	78 0c                	js     80381a <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80380e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803812:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803815:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80381a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80381e:	c9                   	leave
+  80381f:	c3                   	ret
+
+0000000000803820 <tell>:
+
+int tell(int fdnum) {
+  803820:	55                   	push   %rbp
+  803821:	48 89 e5             	mov    %rsp,%rbp
+  803824:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803828:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80382c:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803833:	00 00 00 
+  803836:	ff d0                	call   *%rax
+  803838:	85 c0                	test   %eax,%eax
+  80383a:	78 07                	js     803843 <tell+0x23>
+
+    return fd->fd_offset;
+  80383c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803840:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803843:	c9                   	leave
+  803844:	c3                   	ret
+
+0000000000803845 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803845:	55                   	push   %rbp
+  803846:	48 89 e5             	mov    %rsp,%rbp
+  803849:	41 55                	push   %r13
+  80384b:	41 54                	push   %r12
+  80384d:	53                   	push   %rbx
+  80384e:	48 83 ec 18          	sub    $0x18,%rsp
+  803852:	89 fb                	mov    %edi,%ebx
+  803854:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803857:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80385b:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	85 c0                	test   %eax,%eax
+  803869:	78 38                	js     8038a3 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80386b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80386f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803873:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803877:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  80387e:	00 00 00 
+  803881:	ff d0                	call   *%rax
+  803883:	85 c0                	test   %eax,%eax
+  803885:	78 1c                	js     8038a3 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803887:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80388c:	74 20                	je     8038ae <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80388e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803892:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803896:	48 85 c0             	test   %rax,%rax
+  803899:	74 47                	je     8038e2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80389b:	44 89 e6             	mov    %r12d,%esi
+  80389e:	4c 89 ef             	mov    %r13,%rdi
+  8038a1:	ff d0                	call   *%rax
+}
+  8038a3:	48 83 c4 18          	add    $0x18,%rsp
+  8038a7:	5b                   	pop    %rbx
+  8038a8:	41 5c                	pop    %r12
+  8038aa:	41 5d                	pop    %r13
+  8038ac:	5d                   	pop    %rbp
+  8038ad:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8038ae:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8038b5:	00 00 00 
+  8038b8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8038be:	89 da                	mov    %ebx,%edx
+  8038c0:	48 bf 78 68 80 00 00 	movabs $0x806878,%rdi
+  8038c7:	00 00 00 
+  8038ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cf:	48 b9 ea 19 80 00 00 	movabs $0x8019ea,%rcx
+  8038d6:	00 00 00 
+  8038d9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038e0:	eb c1                	jmp    8038a3 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038e2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8038e7:	eb ba                	jmp    8038a3 <ftruncate+0x5e>
+
+00000000008038e9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8038e9:	55                   	push   %rbp
+  8038ea:	48 89 e5             	mov    %rsp,%rbp
+  8038ed:	41 54                	push   %r12
+  8038ef:	53                   	push   %rbx
+  8038f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8038f4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8038fb:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+  803907:	85 c0                	test   %eax,%eax
+  803909:	78 63                	js     80396e <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80390b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80390f:	41 8b 3c 24          	mov    (%r12),%edi
+  803913:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803917:	48 b8 6f 33 80 00 00 	movabs $0x80336f,%rax
+  80391e:	00 00 00 
+  803921:	ff d0                	call   *%rax
+  803923:	85 c0                	test   %eax,%eax
+  803925:	78 47                	js     80396e <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803927:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80392b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803930:	74 45                	je     803977 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803932:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803935:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80393c:	00 00 00 
+    stat->st_isdir = 0;
+  80393f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803946:	00 00 00 
+    stat->st_ino = 0;
+  803949:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803950:	00 00 00 00 
+    stat->st_version = 0;
+  803954:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  80395b:	00 00 00 
+    stat->st_dev = dev;
+  80395e:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803965:	48 89 de             	mov    %rbx,%rsi
+  803968:	4c 89 e7             	mov    %r12,%rdi
+  80396b:	ff 50 28             	call   *0x28(%rax)
+}
+  80396e:	48 83 c4 10          	add    $0x10,%rsp
+  803972:	5b                   	pop    %rbx
+  803973:	41 5c                	pop    %r12
+  803975:	5d                   	pop    %rbp
+  803976:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803977:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80397c:	eb f0                	jmp    80396e <fstat+0x85>
+
+000000000080397e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80397e:	55                   	push   %rbp
+  80397f:	48 89 e5             	mov    %rsp,%rbp
+  803982:	41 54                	push   %r12
+  803984:	53                   	push   %rbx
+  803985:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803988:	be 00 00 00 00       	mov    $0x0,%esi
+  80398d:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  803994:	00 00 00 
+  803997:	ff d0                	call   *%rax
+  803999:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80399b:	85 c0                	test   %eax,%eax
+  80399d:	78 25                	js     8039c4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80399f:	4c 89 e6             	mov    %r12,%rsi
+  8039a2:	89 c7                	mov    %eax,%edi
+  8039a4:	48 b8 e9 38 80 00 00 	movabs $0x8038e9,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+  8039b0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8039b3:	89 df                	mov    %ebx,%edi
+  8039b5:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  8039bc:	00 00 00 
+  8039bf:	ff d0                	call   *%rax
+
+    return res;
+  8039c1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8039c4:	89 d8                	mov    %ebx,%eax
+  8039c6:	5b                   	pop    %rbx
+  8039c7:	41 5c                	pop    %r12
+  8039c9:	5d                   	pop    %rbp
+  8039ca:	c3                   	ret
+
+00000000008039cb <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039cb:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8039d2:	00 00 00 
+  8039d5:	83 38 00             	cmpl   $0x0,(%rax)
+  8039d8:	74 0a                	je     8039e4 <fsipc_env+0x19>
+    return fsenv;
+}
+  8039da:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8039e1:	00 00 
+  8039e3:	c3                   	ret
+fsipc_env(void) {
+  8039e4:	55                   	push   %rbp
+  8039e5:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039e8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039ed:	48 b8 87 5b 80 00 00 	movabs $0x805b87,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+  8039f9:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803a00:	00 00 
+}
+  803a02:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803a09:	00 00 
+  803a0b:	5d                   	pop    %rbp
+  803a0c:	c3                   	ret
+
+0000000000803a0d <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803a0d:	55                   	push   %rbp
+  803a0e:	48 89 e5             	mov    %rsp,%rbp
+  803a11:	53                   	push   %rbx
+  803a12:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803a16:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a1d:	00 
+  803a1e:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a25:	00 
+  803a26:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a2d:	00 
+  803a2e:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a35:	00 
+  803a36:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803a3d:	00 
+
+    assert(size <= sizeof(words));
+  803a3e:	48 83 fa 28          	cmp    $0x28,%rdx
+  803a42:	77 38                	ja     803a7c <fsipc_short+0x6f>
+  803a44:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803a46:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a4a:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  803a51:	00 00 00 
+  803a54:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803a56:	48 b8 cb 39 80 00 00 	movabs $0x8039cb,%rax
+  803a5d:	00 00 00 
+  803a60:	ff d0                	call   *%rax
+  803a62:	89 c7                	mov    %eax,%edi
+  803a64:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a68:	89 de                	mov    %ebx,%esi
+  803a6a:	48 b8 ea 5a 80 00 00 	movabs $0x805aea,%rax
+  803a71:	00 00 00 
+  803a74:	ff d0                	call   *%rax
+}
+  803a76:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a7a:	c9                   	leave
+  803a7b:	c3                   	ret
+    assert(size <= sizeof(words));
+  803a7c:	48 b9 00 69 80 00 00 	movabs $0x806900,%rcx
+  803a83:	00 00 00 
+  803a86:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803a8d:	00 00 00 
+  803a90:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803a95:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803a9c:	00 00 00 
+  803a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa4:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803aab:	00 00 00 
+  803aae:	41 ff d0             	call   *%r8
+
+0000000000803ab1 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803ab1:	55                   	push   %rbp
+  803ab2:	48 89 e5             	mov    %rsp,%rbp
+  803ab5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803ab9:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803abc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803abf:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803ac2:	ba 08 00 00 00       	mov    $0x8,%edx
+  803ac7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803acb:	bf 02 00 00 00       	mov    $0x2,%edi
+  803ad0:	48 b8 0d 3a 80 00 00 	movabs $0x803a0d,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+}
+  803adc:	c9                   	leave
+  803add:	c3                   	ret
+
+0000000000803ade <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803ade:	55                   	push   %rbp
+  803adf:	48 89 e5             	mov    %rsp,%rbp
+  803ae2:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803ae6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803ae9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803aec:	ba 04 00 00 00       	mov    $0x4,%edx
+  803af1:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803af5:	bf 06 00 00 00       	mov    $0x6,%edi
+  803afa:	48 b8 0d 3a 80 00 00 	movabs $0x803a0d,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+}
+  803b06:	c9                   	leave
+  803b07:	c3                   	ret
+
+0000000000803b08 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803b08:	55                   	push   %rbp
+  803b09:	48 89 e5             	mov    %rsp,%rbp
+  803b0c:	41 54                	push   %r12
+  803b0e:	53                   	push   %rbx
+  803b0f:	48 83 ec 10          	sub    $0x10,%rsp
+  803b13:	89 fb                	mov    %edi,%ebx
+  803b15:	49 89 f4             	mov    %rsi,%r12
+  803b18:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b1c:	48 b8 cb 39 80 00 00 	movabs $0x8039cb,%rax
+  803b23:	00 00 00 
+  803b26:	ff d0                	call   *%rax
+  803b28:	89 c7                	mov    %eax,%edi
+  803b2a:	6a 00                	push   $0x0
+  803b2c:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b30:	50                   	push   %rax
+  803b31:	4d 89 e1             	mov    %r12,%r9
+  803b34:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803b3a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b3f:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803b46:	00 00 00 
+  803b49:	89 de                	mov    %ebx,%esi
+  803b4b:	48 b8 85 5a 80 00 00 	movabs $0x805a85,%rax
+  803b52:	00 00 00 
+  803b55:	ff d0                	call   *%rax
+}
+  803b57:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803b5b:	5b                   	pop    %rbx
+  803b5c:	41 5c                	pop    %r12
+  803b5e:	5d                   	pop    %rbp
+  803b5f:	c3                   	ret
+
+0000000000803b60 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803b60:	55                   	push   %rbp
+  803b61:	48 89 e5             	mov    %rsp,%rbp
+  803b64:	41 54                	push   %r12
+  803b66:	53                   	push   %rbx
+  803b67:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b6a:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b6d:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803b74:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803b80:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b85:	48 b8 08 3b 80 00 00 	movabs $0x803b08,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b91:	85 c0                	test   %eax,%eax
+  803b93:	78 5a                	js     803bef <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b95:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803b9c:	00 00 00 
+  803b9f:	4c 89 e6             	mov    %r12,%rsi
+  803ba2:	48 89 df             	mov    %rbx,%rdi
+  803ba5:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  803bac:	00 00 00 
+  803baf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803bb1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803bb8:	00 
+  803bb9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803bbf:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803bc6:	00 
+  803bc7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803bcd:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803bd4:	00 
+  803bd5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803bdc:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803be3:	00 
+  803be4:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803bea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bef:	5b                   	pop    %rbx
+  803bf0:	41 5c                	pop    %r12
+  803bf2:	5d                   	pop    %rbp
+  803bf3:	c3                   	ret
+
+0000000000803bf4 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803bf4:	55                   	push   %rbp
+  803bf5:	48 89 e5             	mov    %rsp,%rbp
+  803bf8:	41 57                	push   %r15
+  803bfa:	41 56                	push   %r14
+  803bfc:	41 55                	push   %r13
+  803bfe:	41 54                	push   %r12
+  803c00:	53                   	push   %rbx
+  803c01:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803c05:	48 85 ff             	test   %rdi,%rdi
+  803c08:	0f 84 a1 00 00 00    	je     803caf <devfile_read+0xbb>
+  803c0e:	49 89 ff             	mov    %rdi,%r15
+  803c11:	49 89 f5             	mov    %rsi,%r13
+  803c14:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803c17:	48 85 f6             	test   %rsi,%rsi
+  803c1a:	0f 84 c4 00 00 00    	je     803ce4 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c20:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c27:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c28:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c2f:	00 00 00 
+  803c32:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c36:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803c39:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c3d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c42:	be 00 00 00 00       	mov    $0x0,%esi
+  803c47:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c4c:	48 b8 08 3b 80 00 00 	movabs $0x803b08,%rax
+  803c53:	00 00 00 
+  803c56:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c58:	85 c0                	test   %eax,%eax
+  803c5a:	0f 88 b9 00 00 00    	js     803d19 <devfile_read+0x125>
+        assert(res <= n);
+  803c60:	48 63 d8             	movslq %eax,%rbx
+  803c63:	49 39 dc             	cmp    %rbx,%r12
+  803c66:	0f 82 b1 00 00 00    	jb     803d1d <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803c6c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803c71:	0f 87 db 00 00 00    	ja     803d52 <devfile_read+0x15e>
+        if (!res) {
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	74 21                	je     803c9c <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c7b:	48 89 da             	mov    %rbx,%rdx
+  803c7e:	4c 89 f6             	mov    %r14,%rsi
+  803c81:	4c 89 ef             	mov    %r13,%rdi
+  803c84:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  803c8b:	00 00 00 
+  803c8e:	ff d0                	call   *%rax
+        total_read += res;
+  803c90:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803c94:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803c97:	49 29 dc             	sub    %rbx,%r12
+  803c9a:	75 96                	jne    803c32 <devfile_read+0x3e>
+    return total_read;
+  803c9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803ca0:	48 83 c4 18          	add    $0x18,%rsp
+  803ca4:	5b                   	pop    %rbx
+  803ca5:	41 5c                	pop    %r12
+  803ca7:	41 5d                	pop    %r13
+  803ca9:	41 5e                	pop    %r14
+  803cab:	41 5f                	pop    %r15
+  803cad:	5d                   	pop    %rbp
+  803cae:	c3                   	ret
+    assert(fd);
+  803caf:	48 b9 36 69 80 00 00 	movabs $0x806936,%rcx
+  803cb6:	00 00 00 
+  803cb9:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803cc0:	00 00 00 
+  803cc3:	be 91 00 00 00       	mov    $0x91,%esi
+  803cc8:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803ccf:	00 00 00 
+  803cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd7:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803cde:	00 00 00 
+  803ce1:	41 ff d0             	call   *%r8
+    assert(buf);
+  803ce4:	48 b9 39 69 80 00 00 	movabs $0x806939,%rcx
+  803ceb:	00 00 00 
+  803cee:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803cf5:	00 00 00 
+  803cf8:	be 92 00 00 00       	mov    $0x92,%esi
+  803cfd:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803d04:	00 00 00 
+  803d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0c:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803d13:	00 00 00 
+  803d16:	41 ff d0             	call   *%r8
+            return res;
+  803d19:	48 98                	cltq
+  803d1b:	eb 83                	jmp    803ca0 <devfile_read+0xac>
+        assert(res <= n);
+  803d1d:	48 b9 3d 69 80 00 00 	movabs $0x80693d,%rcx
+  803d24:	00 00 00 
+  803d27:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803d2e:	00 00 00 
+  803d31:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803d36:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803d3d:	00 00 00 
+  803d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d45:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803d4c:	00 00 00 
+  803d4f:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d52:	48 b9 48 69 80 00 00 	movabs $0x806948,%rcx
+  803d59:	00 00 00 
+  803d5c:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803d63:	00 00 00 
+  803d66:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803d6b:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803d72:	00 00 00 
+  803d75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d7a:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803d81:	00 00 00 
+  803d84:	41 ff d0             	call   *%r8
+
+0000000000803d87 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d87:	55                   	push   %rbp
+  803d88:	48 89 e5             	mov    %rsp,%rbp
+  803d8b:	41 57                	push   %r15
+  803d8d:	41 56                	push   %r14
+  803d8f:	41 55                	push   %r13
+  803d91:	41 54                	push   %r12
+  803d93:	53                   	push   %rbx
+  803d94:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803d98:	48 85 ff             	test   %rdi,%rdi
+  803d9b:	0f 84 83 00 00 00    	je     803e24 <devfile_write+0x9d>
+  803da1:	49 89 ff             	mov    %rdi,%r15
+  803da4:	49 89 f4             	mov    %rsi,%r12
+  803da7:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803daa:	48 85 f6             	test   %rsi,%rsi
+  803dad:	0f 84 a6 00 00 00    	je     803e59 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803db3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803db9:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803dc0:	00 00 00 
+  803dc3:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803dc7:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803dca:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803dce:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803dd3:	48 39 d3             	cmp    %rdx,%rbx
+  803dd6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803dda:	4c 89 e6             	mov    %r12,%rsi
+  803ddd:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803de4:	00 00 00 
+  803de7:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  803dee:	00 00 00 
+  803df1:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803df3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df8:	be 00 00 00 00       	mov    $0x0,%esi
+  803dfd:	bf 04 00 00 00       	mov    $0x4,%edi
+  803e02:	48 b8 08 3b 80 00 00 	movabs $0x803b08,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	78 7c                	js     803e8e <devfile_write+0x107>
+        total_written += res;
+  803e12:	48 98                	cltq
+  803e14:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803e17:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e1a:	48 29 c3             	sub    %rax,%rbx
+  803e1d:	75 a4                	jne    803dc3 <devfile_write+0x3c>
+    return total_written;
+  803e1f:	4c 89 e8             	mov    %r13,%rax
+  803e22:	eb 6c                	jmp    803e90 <devfile_write+0x109>
+    assert(fd);
+  803e24:	48 b9 36 69 80 00 00 	movabs $0x806936,%rcx
+  803e2b:	00 00 00 
+  803e2e:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803e35:	00 00 00 
+  803e38:	be bd 00 00 00       	mov    $0xbd,%esi
+  803e3d:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803e44:	00 00 00 
+  803e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e4c:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803e53:	00 00 00 
+  803e56:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e59:	48 b9 39 69 80 00 00 	movabs $0x806939,%rcx
+  803e60:	00 00 00 
+  803e63:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  803e6a:	00 00 00 
+  803e6d:	be be 00 00 00       	mov    $0xbe,%esi
+  803e72:	48 bf 2b 69 80 00 00 	movabs $0x80692b,%rdi
+  803e79:	00 00 00 
+  803e7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e81:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  803e88:	00 00 00 
+  803e8b:	41 ff d0             	call   *%r8
+            return res;
+  803e8e:	48 98                	cltq
+}
+  803e90:	48 83 c4 08          	add    $0x8,%rsp
+  803e94:	5b                   	pop    %rbx
+  803e95:	41 5c                	pop    %r12
+  803e97:	41 5d                	pop    %r13
+  803e99:	41 5e                	pop    %r14
+  803e9b:	41 5f                	pop    %r15
+  803e9d:	5d                   	pop    %rbp
+  803e9e:	c3                   	ret
+
+0000000000803e9f <open>:
+open(const char *path, int mode) {
+  803e9f:	55                   	push   %rbp
+  803ea0:	48 89 e5             	mov    %rsp,%rbp
+  803ea3:	41 55                	push   %r13
+  803ea5:	41 54                	push   %r12
+  803ea7:	53                   	push   %rbx
+  803ea8:	48 83 ec 18          	sub    $0x18,%rsp
+  803eac:	49 89 fc             	mov    %rdi,%r12
+  803eaf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803eb2:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  803eb9:	00 00 00 
+  803ebc:	ff d0                	call   *%rax
+  803ebe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803ec4:	0f 87 8f 00 00 00    	ja     803f59 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803eca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ece:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  803ed5:	00 00 00 
+  803ed8:	ff d0                	call   *%rax
+  803eda:	89 c3                	mov    %eax,%ebx
+  803edc:	85 c0                	test   %eax,%eax
+  803ede:	78 55                	js     803f35 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803ee0:	4c 89 e6             	mov    %r12,%rsi
+  803ee3:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803eea:	00 00 00 
+  803eed:	48 89 df             	mov    %rbx,%rdi
+  803ef0:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  803ef7:	00 00 00 
+  803efa:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803efc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f08:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f0c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f11:	48 b8 08 3b 80 00 00 	movabs $0x803b08,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+  803f1d:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f1f:	85 c0                	test   %eax,%eax
+  803f21:	78 1f                	js     803f42 <open+0xa3>
+    return fd2num(fd);
+  803f23:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f27:	48 b8 96 32 80 00 00 	movabs $0x803296,%rax
+  803f2e:	00 00 00 
+  803f31:	ff d0                	call   *%rax
+  803f33:	89 c3                	mov    %eax,%ebx
+}
+  803f35:	89 d8                	mov    %ebx,%eax
+  803f37:	48 83 c4 18          	add    $0x18,%rsp
+  803f3b:	5b                   	pop    %rbx
+  803f3c:	41 5c                	pop    %r12
+  803f3e:	41 5d                	pop    %r13
+  803f40:	5d                   	pop    %rbp
+  803f41:	c3                   	ret
+        fd_close(fd, 0);
+  803f42:	be 00 00 00 00       	mov    $0x0,%esi
+  803f47:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f4b:	48 b8 df 33 80 00 00 	movabs $0x8033df,%rax
+  803f52:	00 00 00 
+  803f55:	ff d0                	call   *%rax
+        return res;
+  803f57:	eb dc                	jmp    803f35 <open+0x96>
+        return -E_BAD_PATH;
+  803f59:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803f5e:	eb d5                	jmp    803f35 <open+0x96>
+
+0000000000803f60 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803f60:	55                   	push   %rbp
+  803f61:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803f64:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f69:	be 00 00 00 00       	mov    $0x0,%esi
+  803f6e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f73:	48 b8 0d 3a 80 00 00 	movabs $0x803a0d,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+}
+  803f7f:	5d                   	pop    %rbp
+  803f80:	c3                   	ret
+
+0000000000803f81 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803f81:	55                   	push   %rbp
+  803f82:	48 89 e5             	mov    %rsp,%rbp
+  803f85:	41 56                	push   %r14
+  803f87:	41 55                	push   %r13
+  803f89:	41 54                	push   %r12
+  803f8b:	53                   	push   %rbx
+  803f8c:	48 83 ec 10          	sub    $0x10,%rsp
+  803f90:	41 89 f6             	mov    %esi,%r14d
+  803f93:	49 89 d4             	mov    %rdx,%r12
+  803f96:	48 89 cb             	mov    %rcx,%rbx
+  803f99:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f9c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fa0:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  803fa7:	00 00 00 
+  803faa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fac:	85 c0                	test   %eax,%eax
+  803fae:	78 46                	js     803ff6 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fb0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fb4:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803fbb:	00 00 00 
+  803fbe:	8b 00                	mov    (%rax),%eax
+  803fc0:	39 02                	cmp    %eax,(%rdx)
+  803fc2:	75 3f                	jne    804003 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803fc4:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803fcb:	00 00 00 
+  803fce:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803fd1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803fd3:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803fd7:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803fdb:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803fdf:	48 89 da             	mov    %rbx,%rdx
+  803fe2:	4c 89 e6             	mov    %r12,%rsi
+  803fe5:	bf 09 00 00 00       	mov    $0x9,%edi
+  803fea:	48 b8 08 3b 80 00 00 	movabs $0x803b08,%rax
+  803ff1:	00 00 00 
+  803ff4:	ff d0                	call   *%rax
+}
+  803ff6:	48 83 c4 10          	add    $0x10,%rsp
+  803ffa:	5b                   	pop    %rbx
+  803ffb:	41 5c                	pop    %r12
+  803ffd:	41 5d                	pop    %r13
+  803fff:	41 5e                	pop    %r14
+  804001:	5d                   	pop    %rbp
+  804002:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804003:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804008:	eb ec                	jmp    803ff6 <file_map+0x75>
+
+000000000080400a <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  80400a:	55                   	push   %rbp
+  80400b:	48 89 e5             	mov    %rsp,%rbp
+  80400e:	41 54                	push   %r12
+  804010:	53                   	push   %rbx
+  804011:	48 83 ec 20          	sub    $0x20,%rsp
+  804015:	41 89 f4             	mov    %esi,%r12d
+  804018:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80401b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80401f:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  804026:	00 00 00 
+  804029:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80402b:	85 c0                	test   %eax,%eax
+  80402d:	78 3c                	js     80406b <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80402f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804033:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  80403a:	00 00 00 
+  80403d:	8b 0a                	mov    (%rdx),%ecx
+  80403f:	39 08                	cmp    %ecx,(%rax)
+  804041:	75 31                	jne    804074 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804043:	8b 40 0c             	mov    0xc(%rax),%eax
+  804046:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804049:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  80404d:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804051:	ba 10 00 00 00       	mov    $0x10,%edx
+  804056:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80405a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80405f:	48 b8 0d 3a 80 00 00 	movabs $0x803a0d,%rax
+  804066:	00 00 00 
+  804069:	ff d0                	call   *%rax
+}
+  80406b:	48 83 c4 20          	add    $0x20,%rsp
+  80406f:	5b                   	pop    %rbx
+  804070:	41 5c                	pop    %r12
+  804072:	5d                   	pop    %rbp
+  804073:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804074:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804079:	eb f0                	jmp    80406b <file_msync+0x61>
+
+000000000080407b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80407b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80407f:	7f 01                	jg     804082 <writebuf+0x7>
+  804081:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804082:	55                   	push   %rbp
+  804083:	48 89 e5             	mov    %rsp,%rbp
+  804086:	53                   	push   %rbx
+  804087:	48 83 ec 08          	sub    $0x8,%rsp
+  80408b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80408e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804092:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804096:	8b 3f                	mov    (%rdi),%edi
+  804098:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8040a4:	48 85 c0             	test   %rax,%rax
+  8040a7:	7e 04                	jle    8040ad <writebuf+0x32>
+  8040a9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8040ad:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8040b1:	48 39 c2             	cmp    %rax,%rdx
+  8040b4:	74 0f                	je     8040c5 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8040b6:	48 85 c0             	test   %rax,%rax
+  8040b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040be:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8040c2:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8040c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040c9:	c9                   	leave
+  8040ca:	c3                   	ret
+
+00000000008040cb <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8040cb:	8b 46 04             	mov    0x4(%rsi),%eax
+  8040ce:	8d 50 01             	lea    0x1(%rax),%edx
+  8040d1:	89 56 04             	mov    %edx,0x4(%rsi)
+  8040d4:	48 98                	cltq
+  8040d6:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8040db:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8040e1:	74 01                	je     8040e4 <putch+0x19>
+  8040e3:	c3                   	ret
+putch(int ch, void *arg) {
+  8040e4:	55                   	push   %rbp
+  8040e5:	48 89 e5             	mov    %rsp,%rbp
+  8040e8:	53                   	push   %rbx
+  8040e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8040ed:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8040f0:	48 89 f7             	mov    %rsi,%rdi
+  8040f3:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  8040fa:	00 00 00 
+  8040fd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8040ff:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804106:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80410a:	c9                   	leave
+  80410b:	c3                   	ret
+
+000000000080410c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  80410c:	55                   	push   %rbp
+  80410d:	48 89 e5             	mov    %rsp,%rbp
+  804110:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804117:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80411a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804120:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804127:	00 00 00 
+    state.result = 0;
+  80412a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804131:	00 00 00 00 
+    state.error = 1;
+  804135:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  80413c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80413f:	48 89 f2             	mov    %rsi,%rdx
+  804142:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804149:	48 bf cb 40 80 00 00 	movabs $0x8040cb,%rdi
+  804150:	00 00 00 
+  804153:	48 b8 3a 1b 80 00 00 	movabs $0x801b3a,%rax
+  80415a:	00 00 00 
+  80415d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80415f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804166:	7f 14                	jg     80417c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804168:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80416f:	48 85 c0             	test   %rax,%rax
+  804172:	75 06                	jne    80417a <vfprintf+0x6e>
+  804174:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80417a:	c9                   	leave
+  80417b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80417c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804183:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  80418a:	00 00 00 
+  80418d:	ff d0                	call   *%rax
+  80418f:	eb d7                	jmp    804168 <vfprintf+0x5c>
+
+0000000000804191 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804191:	55                   	push   %rbp
+  804192:	48 89 e5             	mov    %rsp,%rbp
+  804195:	48 83 ec 50          	sub    $0x50,%rsp
+  804199:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80419d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041a1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8041a5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8041a9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8041b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041b8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8041bc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8041c0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8041c4:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  8041cb:	00 00 00 
+  8041ce:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8041d0:	c9                   	leave
+  8041d1:	c3                   	ret
+
+00000000008041d2 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8041d2:	55                   	push   %rbp
+  8041d3:	48 89 e5             	mov    %rsp,%rbp
+  8041d6:	48 83 ec 50          	sub    $0x50,%rsp
+  8041da:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8041de:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8041e2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041e6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8041ea:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8041ee:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8041f5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041fd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804201:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804205:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804209:	48 89 fe             	mov    %rdi,%rsi
+  80420c:	bf 01 00 00 00       	mov    $0x1,%edi
+  804211:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  804218:	00 00 00 
+  80421b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80421d:	c9                   	leave
+  80421e:	c3                   	ret
+
+000000000080421f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80421f:	55                   	push   %rbp
+  804220:	48 89 e5             	mov    %rsp,%rbp
+  804223:	41 54                	push   %r12
+  804225:	53                   	push   %rbx
+  804226:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804229:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  804230:	00 00 00 
+  804233:	ff d0                	call   *%rax
+  804235:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804238:	48 be 70 69 80 00 00 	movabs $0x806970,%rsi
+  80423f:	00 00 00 
+  804242:	48 89 df             	mov    %rbx,%rdi
+  804245:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  80424c:	00 00 00 
+  80424f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804251:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804256:	41 2b 04 24          	sub    (%r12),%eax
+  80425a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804260:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804267:	00 00 00 
+    stat->st_dev = &devpipe;
+  80426a:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804271:	00 00 00 
+  804274:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  80427b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804280:	5b                   	pop    %rbx
+  804281:	41 5c                	pop    %r12
+  804283:	5d                   	pop    %rbp
+  804284:	c3                   	ret
+
+0000000000804285 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804285:	55                   	push   %rbp
+  804286:	48 89 e5             	mov    %rsp,%rbp
+  804289:	41 54                	push   %r12
+  80428b:	53                   	push   %rbx
+  80428c:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80428f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804294:	48 89 fe             	mov    %rdi,%rsi
+  804297:	bf 00 00 00 00       	mov    $0x0,%edi
+  80429c:	49 bc 5e 2b 80 00 00 	movabs $0x802b5e,%r12
+  8042a3:	00 00 00 
+  8042a6:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8042a9:	48 89 df             	mov    %rbx,%rdi
+  8042ac:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  8042b3:	00 00 00 
+  8042b6:	ff d0                	call   *%rax
+  8042b8:	48 89 c6             	mov    %rax,%rsi
+  8042bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042c5:	41 ff d4             	call   *%r12
+}
+  8042c8:	5b                   	pop    %rbx
+  8042c9:	41 5c                	pop    %r12
+  8042cb:	5d                   	pop    %rbp
+  8042cc:	c3                   	ret
+
+00000000008042cd <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042cd:	55                   	push   %rbp
+  8042ce:	48 89 e5             	mov    %rsp,%rbp
+  8042d1:	41 57                	push   %r15
+  8042d3:	41 56                	push   %r14
+  8042d5:	41 55                	push   %r13
+  8042d7:	41 54                	push   %r12
+  8042d9:	53                   	push   %rbx
+  8042da:	48 83 ec 18          	sub    $0x18,%rsp
+  8042de:	49 89 fc             	mov    %rdi,%r12
+  8042e1:	49 89 f5             	mov    %rsi,%r13
+  8042e4:	49 89 d7             	mov    %rdx,%r15
+  8042e7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042eb:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  8042f2:	00 00 00 
+  8042f5:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8042f7:	4d 85 ff             	test   %r15,%r15
+  8042fa:	0f 84 af 00 00 00    	je     8043af <devpipe_write+0xe2>
+  804300:	48 89 c3             	mov    %rax,%rbx
+  804303:	4c 89 f8             	mov    %r15,%rax
+  804306:	4d 89 ef             	mov    %r13,%r15
+  804309:	4c 01 e8             	add    %r13,%rax
+  80430c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804310:	49 bd 54 2a 80 00 00 	movabs $0x802a54,%r13
+  804317:	00 00 00 
+            sys_yield();
+  80431a:	49 be e5 29 80 00 00 	movabs $0x8029e5,%r14
+  804321:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804324:	8b 73 04             	mov    0x4(%rbx),%esi
+  804327:	48 63 ce             	movslq %esi,%rcx
+  80432a:	48 63 03             	movslq (%rbx),%rax
+  80432d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804333:	48 39 c1             	cmp    %rax,%rcx
+  804336:	72 2e                	jb     804366 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804338:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80433d:	48 89 da             	mov    %rbx,%rdx
+  804340:	be 00 10 00 00       	mov    $0x1000,%esi
+  804345:	4c 89 e7             	mov    %r12,%rdi
+  804348:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80434b:	85 c0                	test   %eax,%eax
+  80434d:	74 66                	je     8043b5 <devpipe_write+0xe8>
+            sys_yield();
+  80434f:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804352:	8b 73 04             	mov    0x4(%rbx),%esi
+  804355:	48 63 ce             	movslq %esi,%rcx
+  804358:	48 63 03             	movslq (%rbx),%rax
+  80435b:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804361:	48 39 c1             	cmp    %rax,%rcx
+  804364:	73 d2                	jae    804338 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804366:	41 0f b6 3f          	movzbl (%r15),%edi
+  80436a:	48 89 ca             	mov    %rcx,%rdx
+  80436d:	48 c1 ea 03          	shr    $0x3,%rdx
+  804371:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804378:	08 10 20 
+  80437b:	48 f7 e2             	mul    %rdx
+  80437e:	48 c1 ea 06          	shr    $0x6,%rdx
+  804382:	48 89 d0             	mov    %rdx,%rax
+  804385:	48 c1 e0 09          	shl    $0x9,%rax
+  804389:	48 29 d0             	sub    %rdx,%rax
+  80438c:	48 c1 e0 03          	shl    $0x3,%rax
+  804390:	48 29 c1             	sub    %rax,%rcx
+  804393:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804398:	83 c6 01             	add    $0x1,%esi
+  80439b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80439e:	49 83 c7 01          	add    $0x1,%r15
+  8043a2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043a6:	49 39 c7             	cmp    %rax,%r15
+  8043a9:	0f 85 75 ff ff ff    	jne    804324 <devpipe_write+0x57>
+    return n;
+  8043af:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8043b3:	eb 05                	jmp    8043ba <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8043b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043ba:	48 83 c4 18          	add    $0x18,%rsp
+  8043be:	5b                   	pop    %rbx
+  8043bf:	41 5c                	pop    %r12
+  8043c1:	41 5d                	pop    %r13
+  8043c3:	41 5e                	pop    %r14
+  8043c5:	41 5f                	pop    %r15
+  8043c7:	5d                   	pop    %rbp
+  8043c8:	c3                   	ret
+
+00000000008043c9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043c9:	55                   	push   %rbp
+  8043ca:	48 89 e5             	mov    %rsp,%rbp
+  8043cd:	41 57                	push   %r15
+  8043cf:	41 56                	push   %r14
+  8043d1:	41 55                	push   %r13
+  8043d3:	41 54                	push   %r12
+  8043d5:	53                   	push   %rbx
+  8043d6:	48 83 ec 18          	sub    $0x18,%rsp
+  8043da:	49 89 fc             	mov    %rdi,%r12
+  8043dd:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043e5:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  8043ec:	00 00 00 
+  8043ef:	ff d0                	call   *%rax
+  8043f1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8043f4:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043fa:	49 bd 54 2a 80 00 00 	movabs $0x802a54,%r13
+  804401:	00 00 00 
+            sys_yield();
+  804404:	49 be e5 29 80 00 00 	movabs $0x8029e5,%r14
+  80440b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80440e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804413:	74 7d                	je     804492 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804415:	8b 03                	mov    (%rbx),%eax
+  804417:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80441a:	75 26                	jne    804442 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80441c:	4d 85 ff             	test   %r15,%r15
+  80441f:	75 77                	jne    804498 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804421:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804426:	48 89 da             	mov    %rbx,%rdx
+  804429:	be 00 10 00 00       	mov    $0x1000,%esi
+  80442e:	4c 89 e7             	mov    %r12,%rdi
+  804431:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804434:	85 c0                	test   %eax,%eax
+  804436:	74 72                	je     8044aa <devpipe_read+0xe1>
+            sys_yield();
+  804438:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80443b:	8b 03                	mov    (%rbx),%eax
+  80443d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804440:	74 df                	je     804421 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804442:	48 63 c8             	movslq %eax,%rcx
+  804445:	48 89 ca             	mov    %rcx,%rdx
+  804448:	48 c1 ea 03          	shr    $0x3,%rdx
+  80444c:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804453:	08 10 20 
+  804456:	48 89 d0             	mov    %rdx,%rax
+  804459:	48 f7 e6             	mul    %rsi
+  80445c:	48 c1 ea 06          	shr    $0x6,%rdx
+  804460:	48 89 d0             	mov    %rdx,%rax
+  804463:	48 c1 e0 09          	shl    $0x9,%rax
+  804467:	48 29 d0             	sub    %rdx,%rax
+  80446a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804471:	00 
+  804472:	48 89 c8             	mov    %rcx,%rax
+  804475:	48 29 d0             	sub    %rdx,%rax
+  804478:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80447d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804481:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804485:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804488:	49 83 c7 01          	add    $0x1,%r15
+  80448c:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804490:	75 83                	jne    804415 <devpipe_read+0x4c>
+    return n;
+  804492:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804496:	eb 03                	jmp    80449b <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804498:	4c 89 f8             	mov    %r15,%rax
+}
+  80449b:	48 83 c4 18          	add    $0x18,%rsp
+  80449f:	5b                   	pop    %rbx
+  8044a0:	41 5c                	pop    %r12
+  8044a2:	41 5d                	pop    %r13
+  8044a4:	41 5e                	pop    %r14
+  8044a6:	41 5f                	pop    %r15
+  8044a8:	5d                   	pop    %rbp
+  8044a9:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8044aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044af:	eb ea                	jmp    80449b <devpipe_read+0xd2>
+
+00000000008044b1 <pipe>:
+pipe(int pfd[2]) {
+  8044b1:	55                   	push   %rbp
+  8044b2:	48 89 e5             	mov    %rsp,%rbp
+  8044b5:	41 55                	push   %r13
+  8044b7:	41 54                	push   %r12
+  8044b9:	53                   	push   %rbx
+  8044ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8044be:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8044c1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8044c5:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  8044cc:	00 00 00 
+  8044cf:	ff d0                	call   *%rax
+  8044d1:	89 c3                	mov    %eax,%ebx
+  8044d3:	85 c0                	test   %eax,%eax
+  8044d5:	0f 88 a0 01 00 00    	js     80467b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8044db:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044e5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ee:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+  8044fa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8044fc:	85 c0                	test   %eax,%eax
+  8044fe:	0f 88 77 01 00 00    	js     80467b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804504:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804508:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  80450f:	00 00 00 
+  804512:	ff d0                	call   *%rax
+  804514:	89 c3                	mov    %eax,%ebx
+  804516:	85 c0                	test   %eax,%eax
+  804518:	0f 88 43 01 00 00    	js     804661 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80451e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804523:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804528:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80452c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804531:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  804538:	00 00 00 
+  80453b:	ff d0                	call   *%rax
+  80453d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80453f:	85 c0                	test   %eax,%eax
+  804541:	0f 88 1a 01 00 00    	js     804661 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804547:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80454b:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  804552:	00 00 00 
+  804555:	ff d0                	call   *%rax
+  804557:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80455a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80455f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804564:	48 89 c6             	mov    %rax,%rsi
+  804567:	bf 00 00 00 00       	mov    $0x0,%edi
+  80456c:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  804573:	00 00 00 
+  804576:	ff d0                	call   *%rax
+  804578:	89 c3                	mov    %eax,%ebx
+  80457a:	85 c0                	test   %eax,%eax
+  80457c:	0f 88 c5 00 00 00    	js     804647 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804582:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804586:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+  804592:	48 89 c1             	mov    %rax,%rcx
+  804595:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80459b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8045a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a6:	4c 89 ee             	mov    %r13,%rsi
+  8045a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ae:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8045b5:	00 00 00 
+  8045b8:	ff d0                	call   *%rax
+  8045ba:	89 c3                	mov    %eax,%ebx
+  8045bc:	85 c0                	test   %eax,%eax
+  8045be:	78 6e                	js     80462e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8045c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045c5:	4c 89 ef             	mov    %r13,%rdi
+  8045c8:	48 b8 1c 2a 80 00 00 	movabs $0x802a1c,%rax
+  8045cf:	00 00 00 
+  8045d2:	ff d0                	call   *%rax
+  8045d4:	83 f8 02             	cmp    $0x2,%eax
+  8045d7:	0f 85 ab 00 00 00    	jne    804688 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8045dd:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8045e4:	00 00 
+  8045e6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045ea:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8045ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045f0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8045f7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8045fb:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8045fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804601:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804608:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80460c:	48 bb 96 32 80 00 00 	movabs $0x803296,%rbx
+  804613:	00 00 00 
+  804616:	ff d3                	call   *%rbx
+  804618:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80461c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804620:	ff d3                	call   *%rbx
+  804622:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804627:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80462c:	eb 4d                	jmp    80467b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80462e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804633:	4c 89 ee             	mov    %r13,%rsi
+  804636:	bf 00 00 00 00       	mov    $0x0,%edi
+  80463b:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  804642:	00 00 00 
+  804645:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804647:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80464c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804650:	bf 00 00 00 00       	mov    $0x0,%edi
+  804655:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  80465c:	00 00 00 
+  80465f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804661:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804666:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80466a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80466f:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  804676:	00 00 00 
+  804679:	ff d0                	call   *%rax
+}
+  80467b:	89 d8                	mov    %ebx,%eax
+  80467d:	48 83 c4 18          	add    $0x18,%rsp
+  804681:	5b                   	pop    %rbx
+  804682:	41 5c                	pop    %r12
+  804684:	41 5d                	pop    %r13
+  804686:	5d                   	pop    %rbp
+  804687:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804688:	48 b9 88 69 80 00 00 	movabs $0x806988,%rcx
+  80468f:	00 00 00 
+  804692:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  804699:	00 00 00 
+  80469c:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8046a1:	48 bf 77 69 80 00 00 	movabs $0x806977,%rdi
+  8046a8:	00 00 00 
+  8046ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b0:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  8046b7:	00 00 00 
+  8046ba:	41 ff d0             	call   *%r8
+
+00000000008046bd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8046bd:	55                   	push   %rbp
+  8046be:	48 89 e5             	mov    %rsp,%rbp
+  8046c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8046c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8046c9:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8046d5:	85 c0                	test   %eax,%eax
+  8046d7:	78 35                	js     80470e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8046d9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046dd:	48 b8 a8 32 80 00 00 	movabs $0x8032a8,%rax
+  8046e4:	00 00 00 
+  8046e7:	ff d0                	call   *%rax
+  8046e9:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046fa:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  804701:	00 00 00 
+  804704:	ff d0                	call   *%rax
+  804706:	85 c0                	test   %eax,%eax
+  804708:	0f 94 c0             	sete   %al
+  80470b:	0f b6 c0             	movzbl %al,%eax
+}
+  80470e:	c9                   	leave
+  80470f:	c3                   	ret
+
+0000000000804710 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804710:	55                   	push   %rbp
+  804711:	48 89 e5             	mov    %rsp,%rbp
+  804714:	41 55                	push   %r13
+  804716:	41 54                	push   %r12
+  804718:	53                   	push   %rbx
+  804719:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  80471d:	85 ff                	test   %edi,%edi
+  80471f:	74 73                	je     804794 <wait+0x84>
+  804721:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804724:	89 f8                	mov    %edi,%eax
+  804726:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  80472b:	89 f9                	mov    %edi,%ecx
+  80472d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804733:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  80473a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804741:	00 00 00 
+  804744:	48 01 ca             	add    %rcx,%rdx
+  804747:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  80474d:	39 d7                	cmp    %edx,%edi
+  80474f:	75 38                	jne    804789 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804751:	48 98                	cltq
+  804753:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80475a:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804761:	00 00 00 
+  804764:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804767:	49 bd e5 29 80 00 00 	movabs $0x8029e5,%r13
+  80476e:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804771:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  804777:	85 c0                	test   %eax,%eax
+  804779:	74 0e                	je     804789 <wait+0x79>
+        sys_yield();
+  80477b:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  80477e:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804784:	44 39 e0             	cmp    %r12d,%eax
+  804787:	74 e8                	je     804771 <wait+0x61>
+    }
+}
+  804789:	48 83 c4 08          	add    $0x8,%rsp
+  80478d:	5b                   	pop    %rbx
+  80478e:	41 5c                	pop    %r12
+  804790:	41 5d                	pop    %r13
+  804792:	5d                   	pop    %rbp
+  804793:	c3                   	ret
+    assert(envid != 0);
+  804794:	48 b9 ac 69 80 00 00 	movabs $0x8069ac,%rcx
+  80479b:	00 00 00 
+  80479e:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  8047a5:	00 00 00 
+  8047a8:	be 06 00 00 00       	mov    $0x6,%esi
+  8047ad:	48 bf b7 69 80 00 00 	movabs $0x8069b7,%rdi
+  8047b4:	00 00 00 
+  8047b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047bc:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  8047c3:	00 00 00 
+  8047c6:	41 ff d0             	call   *%r8
+
+00000000008047c9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8047c9:	48 89 f8             	mov    %rdi,%rax
+  8047cc:	48 c1 e8 27          	shr    $0x27,%rax
+  8047d0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8047d7:	01 00 00 
+  8047da:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047de:	f6 c2 01             	test   $0x1,%dl
+  8047e1:	74 6d                	je     804850 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8047e3:	48 89 f8             	mov    %rdi,%rax
+  8047e6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047ea:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8047f1:	01 00 00 
+  8047f4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047f8:	f6 c2 01             	test   $0x1,%dl
+  8047fb:	74 62                	je     80485f <get_uvpt_entry+0x96>
+  8047fd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804804:	01 00 00 
+  804807:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80480b:	f6 c2 80             	test   $0x80,%dl
+  80480e:	75 4f                	jne    80485f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804810:	48 89 f8             	mov    %rdi,%rax
+  804813:	48 c1 e8 15          	shr    $0x15,%rax
+  804817:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80481e:	01 00 00 
+  804821:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804825:	f6 c2 01             	test   $0x1,%dl
+  804828:	74 44                	je     80486e <get_uvpt_entry+0xa5>
+  80482a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804831:	01 00 00 
+  804834:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804838:	f6 c2 80             	test   $0x80,%dl
+  80483b:	75 31                	jne    80486e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80483d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804841:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804848:	01 00 00 
+  80484b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80484f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804850:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804857:	01 00 00 
+  80485a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80485e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80485f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804866:	01 00 00 
+  804869:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80486d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80486e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804875:	01 00 00 
+  804878:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80487c:	c3                   	ret
+
+000000000080487d <get_prot>:
+
+int
+get_prot(void *va) {
+  80487d:	55                   	push   %rbp
+  80487e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804881:	48 b8 c9 47 80 00 00 	movabs $0x8047c9,%rax
+  804888:	00 00 00 
+  80488b:	ff d0                	call   *%rax
+  80488d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804890:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804895:	89 c1                	mov    %eax,%ecx
+  804897:	83 c9 04             	or     $0x4,%ecx
+  80489a:	f6 c2 01             	test   $0x1,%dl
+  80489d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8048a0:	89 c1                	mov    %eax,%ecx
+  8048a2:	83 c9 02             	or     $0x2,%ecx
+  8048a5:	f6 c2 02             	test   $0x2,%dl
+  8048a8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8048ab:	89 c1                	mov    %eax,%ecx
+  8048ad:	83 c9 01             	or     $0x1,%ecx
+  8048b0:	48 85 d2             	test   %rdx,%rdx
+  8048b3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8048b6:	89 c1                	mov    %eax,%ecx
+  8048b8:	83 c9 40             	or     $0x40,%ecx
+  8048bb:	f6 c6 04             	test   $0x4,%dh
+  8048be:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8048c1:	5d                   	pop    %rbp
+  8048c2:	c3                   	ret
+
+00000000008048c3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8048c3:	55                   	push   %rbp
+  8048c4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048c7:	48 b8 c9 47 80 00 00 	movabs $0x8047c9,%rax
+  8048ce:	00 00 00 
+  8048d1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8048d3:	48 c1 e8 06          	shr    $0x6,%rax
+  8048d7:	83 e0 01             	and    $0x1,%eax
+}
+  8048da:	5d                   	pop    %rbp
+  8048db:	c3                   	ret
+
+00000000008048dc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8048dc:	55                   	push   %rbp
+  8048dd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8048e0:	48 b8 c9 47 80 00 00 	movabs $0x8047c9,%rax
+  8048e7:	00 00 00 
+  8048ea:	ff d0                	call   *%rax
+  8048ec:	83 e0 01             	and    $0x1,%eax
+}
+  8048ef:	5d                   	pop    %rbp
+  8048f0:	c3                   	ret
+
+00000000008048f1 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8048f1:	55                   	push   %rbp
+  8048f2:	48 89 e5             	mov    %rsp,%rbp
+  8048f5:	41 57                	push   %r15
+  8048f7:	41 56                	push   %r14
+  8048f9:	41 55                	push   %r13
+  8048fb:	41 54                	push   %r12
+  8048fd:	53                   	push   %rbx
+  8048fe:	48 83 ec 28          	sub    $0x28,%rsp
+  804902:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804906:	48 85 ff             	test   %rdi,%rdi
+  804909:	74 1e                	je     804929 <foreach_shared_region+0x38>
+  80490b:	49 89 ff             	mov    %rdi,%r15
+  80490e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804914:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80491a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804921:	01 00 00 
+  804924:	e9 72 02 00 00       	jmp    804b9b <foreach_shared_region+0x2aa>
+    assert(fun);
+  804929:	48 b9 c2 69 80 00 00 	movabs $0x8069c2,%rcx
+  804930:	00 00 00 
+  804933:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  80493a:	00 00 00 
+  80493d:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804942:	48 bf c6 69 80 00 00 	movabs $0x8069c6,%rdi
+  804949:	00 00 00 
+  80494c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804951:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  804958:	00 00 00 
+  80495b:	41 ff d0             	call   *%r8
+  80495e:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804965:	eb 6c                	jmp    8049d3 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804967:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80496e:	ff ff ff 
+  804971:	4c 21 e2             	and    %r12,%rdx
+  804974:	48 89 d8             	mov    %rbx,%rax
+  804977:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80497c:	48 83 c0 01          	add    $0x1,%rax
+  804980:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804984:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80498b:	00 00 00 
+  80498e:	48 21 c8             	and    %rcx,%rax
+  804991:	48 09 d0             	or     %rdx,%rax
+  804994:	49 89 c4             	mov    %rax,%r12
+  804997:	eb 30                	jmp    8049c9 <foreach_shared_region+0xd8>
+  804999:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049a0:	ff ff ff 
+  8049a3:	4c 21 e2             	and    %r12,%rdx
+  8049a6:	48 89 d8             	mov    %rbx,%rax
+  8049a9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8049ae:	48 83 c0 01          	add    $0x1,%rax
+  8049b2:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8049b6:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8049bd:	00 00 00 
+  8049c0:	48 21 c8             	and    %rcx,%rax
+  8049c3:	48 09 d0             	or     %rdx,%rax
+  8049c6:	49 89 c4             	mov    %rax,%r12
+  8049c9:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8049cd:	0f 84 99 01 00 00    	je     804b6c <foreach_shared_region+0x27b>
+  8049d3:	4c 89 e3             	mov    %r12,%rbx
+  8049d6:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8049da:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8049e1:	01 00 00 
+  8049e4:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049e8:	a8 01                	test   $0x1,%al
+  8049ea:	0f 84 77 ff ff ff    	je     804967 <foreach_shared_region+0x76>
+  8049f0:	a8 80                	test   $0x80,%al
+  8049f2:	74 19                	je     804a0d <foreach_shared_region+0x11c>
+  8049f4:	f6 c4 04             	test   $0x4,%ah
+  8049f7:	74 a0                	je     804999 <foreach_shared_region+0xa8>
+  8049f9:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a00:	40 
+  804a01:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a05:	4c 89 e7             	mov    %r12,%rdi
+  804a08:	41 ff d7             	call   *%r15
+  804a0b:	eb 8c                	jmp    804999 <foreach_shared_region+0xa8>
+  804a0d:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a14:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a18:	eb 46                	jmp    804a60 <foreach_shared_region+0x16f>
+  804a1a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a21:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a27:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a2b:	48 c1 e0 15          	shl    $0x15,%rax
+  804a2f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a34:	49 09 c4             	or     %rax,%r12
+  804a37:	eb 1d                	jmp    804a56 <foreach_shared_region+0x165>
+  804a39:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a40:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a46:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a4a:	48 c1 e0 15          	shl    $0x15,%rax
+  804a4e:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a53:	49 09 c4             	or     %rax,%r12
+  804a56:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804a5a:	0f 84 d3 00 00 00    	je     804b33 <foreach_shared_region+0x242>
+  804a60:	4c 89 e3             	mov    %r12,%rbx
+  804a63:	48 c1 eb 15          	shr    $0x15,%rbx
+  804a67:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804a6e:	01 00 00 
+  804a71:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a75:	a8 01                	test   $0x1,%al
+  804a77:	74 a1                	je     804a1a <foreach_shared_region+0x129>
+  804a79:	a8 80                	test   $0x80,%al
+  804a7b:	74 19                	je     804a96 <foreach_shared_region+0x1a5>
+  804a7d:	f6 c4 04             	test   $0x4,%ah
+  804a80:	74 b7                	je     804a39 <foreach_shared_region+0x148>
+  804a82:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804a89:	00 
+  804a8a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a8e:	4c 89 e7             	mov    %r12,%rdi
+  804a91:	41 ff d7             	call   *%r15
+  804a94:	eb a3                	jmp    804a39 <foreach_shared_region+0x148>
+  804a96:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804a9c:	eb 3b                	jmp    804ad9 <foreach_shared_region+0x1e8>
+  804a9e:	f6 c4 04             	test   $0x4,%ah
+  804aa1:	74 12                	je     804ab5 <foreach_shared_region+0x1c4>
+  804aa3:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804aaa:	00 
+  804aab:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804aaf:	4c 89 e7             	mov    %r12,%rdi
+  804ab2:	41 ff d7             	call   *%r15
+  804ab5:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804abc:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804ac2:	48 83 c3 01          	add    $0x1,%rbx
+  804ac6:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804aca:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804ad0:	49 09 dc             	or     %rbx,%r12
+  804ad3:	41 83 ed 01          	sub    $0x1,%r13d
+  804ad7:	74 2f                	je     804b08 <foreach_shared_region+0x217>
+  804ad9:	4c 89 e3             	mov    %r12,%rbx
+  804adc:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804ae0:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804ae4:	a8 01                	test   $0x1,%al
+  804ae6:	75 b6                	jne    804a9e <foreach_shared_region+0x1ad>
+  804ae8:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804aef:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804af5:	48 83 c3 01          	add    $0x1,%rbx
+  804af9:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804afd:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b03:	49 09 dc             	or     %rbx,%r12
+  804b06:	eb cb                	jmp    804ad3 <foreach_shared_region+0x1e2>
+  804b08:	4c 89 e0             	mov    %r12,%rax
+  804b0b:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b11:	49 c1 ec 15          	shr    $0x15,%r12
+  804b15:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b1c:	49 83 c4 01          	add    $0x1,%r12
+  804b20:	49 c1 e4 15          	shl    $0x15,%r12
+  804b24:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804b2b:	49 09 c4             	or     %rax,%r12
+  804b2e:	e9 23 ff ff ff       	jmp    804a56 <foreach_shared_region+0x165>
+  804b33:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b37:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b3e:	ff ff ff 
+  804b41:	4c 21 e0             	and    %r12,%rax
+  804b44:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b48:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b4f:	49 83 c4 01          	add    $0x1,%r12
+  804b53:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804b57:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804b5e:	00 00 00 
+  804b61:	49 21 d4             	and    %rdx,%r12
+  804b64:	49 09 c4             	or     %rax,%r12
+  804b67:	e9 5d fe ff ff       	jmp    8049c9 <foreach_shared_region+0xd8>
+  804b6c:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804b73:	00 ff ff 
+  804b76:	4c 21 e0             	and    %r12,%rax
+  804b79:	49 c1 ec 27          	shr    $0x27,%r12
+  804b7d:	49 83 c4 01          	add    $0x1,%r12
+  804b81:	49 c1 e4 27          	shl    $0x27,%r12
+  804b85:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804b8c:	ff 00 00 
+  804b8f:	49 21 d4             	and    %rdx,%r12
+  804b92:	49 09 c4             	or     %rax,%r12
+  804b95:	41 83 ed 01          	sub    $0x1,%r13d
+  804b99:	74 48                	je     804be3 <foreach_shared_region+0x2f2>
+  804b9b:	4c 89 e0             	mov    %r12,%rax
+  804b9e:	48 c1 e8 27          	shr    $0x27,%rax
+  804ba2:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804ba9:	01 00 00 
+  804bac:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804bb0:	f6 c2 01             	test   $0x1,%dl
+  804bb3:	0f 85 a5 fd ff ff    	jne    80495e <foreach_shared_region+0x6d>
+  804bb9:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804bc0:	00 ff ff 
+  804bc3:	4c 21 e2             	and    %r12,%rdx
+  804bc6:	48 83 c0 01          	add    $0x1,%rax
+  804bca:	48 c1 e0 27          	shl    $0x27,%rax
+  804bce:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804bd5:	ff 00 00 
+  804bd8:	48 21 c8             	and    %rcx,%rax
+  804bdb:	48 09 d0             	or     %rdx,%rax
+  804bde:	49 89 c4             	mov    %rax,%r12
+  804be1:	eb b2                	jmp    804b95 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804be3:	4d 85 e4             	test   %r12,%r12
+  804be6:	75 14                	jne    804bfc <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bed:	48 83 c4 28          	add    $0x28,%rsp
+  804bf1:	5b                   	pop    %rbx
+  804bf2:	41 5c                	pop    %r12
+  804bf4:	41 5d                	pop    %r13
+  804bf6:	41 5e                	pop    %r14
+  804bf8:	41 5f                	pop    %r15
+  804bfa:	5d                   	pop    %rbp
+  804bfb:	c3                   	ret
+    assert(addr == 0);
+  804bfc:	48 b9 d1 69 80 00 00 	movabs $0x8069d1,%rcx
+  804c03:	00 00 00 
+  804c06:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  804c0d:	00 00 00 
+  804c10:	be 67 00 00 00       	mov    $0x67,%esi
+  804c15:	48 bf c6 69 80 00 00 	movabs $0x8069c6,%rdi
+  804c1c:	00 00 00 
+  804c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c24:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  804c2b:	00 00 00 
+  804c2e:	41 ff d0             	call   *%r8
+
+0000000000804c31 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804c31:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c38:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c3b:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c41:	eb 33                	jmp    804c76 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c43:	48 83 c0 20          	add    $0x20,%rax
+  804c47:	4c 39 c0             	cmp    %r8,%rax
+  804c4a:	74 25                	je     804c71 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804c4c:	48 8b 10             	mov    (%rax),%rdx
+  804c4f:	48 85 d2             	test   %rdx,%rdx
+  804c52:	74 ef                	je     804c43 <mmap_place+0x12>
+  804c54:	48 89 d1             	mov    %rdx,%rcx
+  804c57:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c5b:	48 39 cf             	cmp    %rcx,%rdi
+  804c5e:	73 e3                	jae    804c43 <mmap_place+0x12>
+  804c60:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804c64:	4c 39 ca             	cmp    %r9,%rdx
+  804c67:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804c6b:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804c6f:	eb d2                	jmp    804c43 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804c71:	45 84 d2             	test   %r10b,%r10b
+  804c74:	74 12                	je     804c88 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c76:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c7d:	00 00 00 
+        moved = 0;
+  804c80:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804c86:	eb c4                	jmp    804c4c <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804c88:	48 01 fe             	add    %rdi,%rsi
+  804c8b:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804c92:	00 00 00 
+  804c95:	48 39 f0             	cmp    %rsi,%rax
+  804c98:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c9d:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804ca1:	c3                   	ret
+
+0000000000804ca2 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804ca2:	55                   	push   %rbp
+  804ca3:	48 89 e5             	mov    %rsp,%rbp
+  804ca6:	41 57                	push   %r15
+  804ca8:	41 56                	push   %r14
+  804caa:	41 55                	push   %r13
+  804cac:	41 54                	push   %r12
+  804cae:	53                   	push   %rbx
+  804caf:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804cb3:	48 8b 1f             	mov    (%rdi),%rbx
+  804cb6:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cbd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cc4:	00 00 00 
+  804cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ccc:	eb 12                	jmp    804ce0 <mmap_pgfault+0x3e>
+  804cce:	48 83 c2 01          	add    $0x1,%rdx
+  804cd2:	48 83 c0 20          	add    $0x20,%rax
+  804cd6:	48 83 fa 20          	cmp    $0x20,%rdx
+  804cda:	0f 84 04 01 00 00    	je     804de4 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804ce0:	48 8b 08             	mov    (%rax),%rcx
+  804ce3:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804ce7:	48 39 de             	cmp    %rbx,%rsi
+  804cea:	73 e2                	jae    804cce <mmap_pgfault+0x2c>
+  804cec:	48 03 48 08          	add    0x8(%rax),%rcx
+  804cf0:	48 39 cb             	cmp    %rcx,%rbx
+  804cf3:	73 d9                	jae    804cce <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804cf5:	48 c1 e2 05          	shl    $0x5,%rdx
+  804cf9:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d00:	00 00 00 
+  804d03:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d07:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d0b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d0f:	f6 c2 01             	test   $0x1,%dl
+  804d12:	0f 84 e0 00 00 00    	je     804df8 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1d:	f6 c2 02             	test   $0x2,%dl
+  804d20:	0f 84 c3 00 00 00    	je     804de9 <mmap_pgfault+0x147>
+  804d26:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d2d:	ff ff ff 
+  804d30:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804d34:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d3b:	00 00 00 
+  804d3e:	48 39 ca             	cmp    %rcx,%rdx
+  804d41:	0f 85 a2 00 00 00    	jne    804de9 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d47:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804d4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d51:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804d58:	00 00 00 
+  804d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d60:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  804d67:	00 00 00 
+  804d6a:	ff d0                	call   *%rax
+  804d6c:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d73:	85 d2                	test   %edx,%edx
+  804d75:	78 72                	js     804de9 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804d77:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d7c:	48 89 de             	mov    %rbx,%rsi
+  804d7f:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804d86:	00 00 00 
+  804d89:	4c 89 e7             	mov    %r12,%rdi
+  804d8c:	48 b8 d8 26 80 00 00 	movabs $0x8026d8,%rax
+  804d93:	00 00 00 
+  804d96:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804d98:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804d9e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804da4:	48 89 d9             	mov    %rbx,%rcx
+  804da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dac:	4c 89 e6             	mov    %r12,%rsi
+  804daf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804db4:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  804dbb:	00 00 00 
+  804dbe:	ff d0                	call   *%rax
+  804dc0:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804dc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dc7:	4c 89 e6             	mov    %r12,%rsi
+  804dca:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dcf:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  804dd6:	00 00 00 
+  804dd9:	ff d0                	call   *%rax
+    return res >= 0;
+  804ddb:	89 d8                	mov    %ebx,%eax
+  804ddd:	f7 d0                	not    %eax
+  804ddf:	c1 e8 1f             	shr    $0x1f,%eax
+  804de2:	eb 05                	jmp    804de9 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804de4:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804de9:	48 83 c4 18          	add    $0x18,%rsp
+  804ded:	5b                   	pop    %rbx
+  804dee:	41 5c                	pop    %r12
+  804df0:	41 5d                	pop    %r13
+  804df2:	41 5e                	pop    %r14
+  804df4:	41 5f                	pop    %r15
+  804df6:	5d                   	pop    %rbp
+  804df7:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804df8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804dfc:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e00:	4c 03 30             	add    (%rax),%r14
+  804e03:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e0a:	49 39 c6             	cmp    %rax,%r14
+  804e0d:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e11:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e18:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e1e:	49 bf dc 48 80 00 00 	movabs $0x8048dc,%r15
+  804e25:	00 00 00 
+  804e28:	4d 39 f4             	cmp    %r14,%r12
+  804e2b:	73 1d                	jae    804e4a <mmap_pgfault+0x1a8>
+  804e2d:	4c 89 e7             	mov    %r12,%rdi
+  804e30:	41 ff d7             	call   *%r15
+  804e33:	84 c0                	test   %al,%al
+  804e35:	75 13                	jne    804e4a <mmap_pgfault+0x1a8>
+  804e37:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e3e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e45:	4d 39 f4             	cmp    %r14,%r12
+  804e48:	72 e3                	jb     804e2d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e4a:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804e50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e54:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804e58:	74 2a                	je     804e84 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804e5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e5e:	89 de                	mov    %ebx,%esi
+  804e60:	2b 30                	sub    (%rax),%esi
+  804e62:	03 70 1c             	add    0x1c(%rax),%esi
+  804e65:	8b 78 18             	mov    0x18(%rax),%edi
+  804e68:	4c 89 e9             	mov    %r13,%rcx
+  804e6b:	48 89 da             	mov    %rbx,%rdx
+  804e6e:	48 b8 81 3f 80 00 00 	movabs $0x803f81,%rax
+  804e75:	00 00 00 
+  804e78:	ff d0                	call   *%rax
+    return res > 0;
+  804e7a:	85 c0                	test   %eax,%eax
+  804e7c:	0f 9f c0             	setg   %al
+  804e7f:	e9 65 ff ff ff       	jmp    804de9 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e84:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804e88:	eb d0                	jmp    804e5a <mmap_pgfault+0x1b8>
+
+0000000000804e8a <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804e8a:	55                   	push   %rbp
+  804e8b:	48 89 e5             	mov    %rsp,%rbp
+  804e8e:	41 57                	push   %r15
+  804e90:	41 56                	push   %r14
+  804e92:	41 55                	push   %r13
+  804e94:	41 54                	push   %r12
+  804e96:	53                   	push   %rbx
+  804e97:	48 83 ec 28          	sub    $0x28,%rsp
+  804e9b:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804e9f:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804ea2:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ea9:	ff ff ff 
+  804eac:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eb5:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804ebc:	00 00 00 
+  804ebf:	48 39 ca             	cmp    %rcx,%rdx
+  804ec2:	0f 85 e5 00 00 00    	jne    804fad <mmap_writeback+0x123>
+  804ec8:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804ecb:	4c 39 ee             	cmp    %r13,%rsi
+  804ece:	0f 83 e8 00 00 00    	jae    804fbc <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ed4:	49 be dc 48 80 00 00 	movabs $0x8048dc,%r14
+  804edb:	00 00 00 
+  804ede:	49 bf c3 48 80 00 00 	movabs $0x8048c3,%r15
+  804ee5:	00 00 00 
+  804ee8:	eb 10                	jmp    804efa <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804eea:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804ef1:	4d 39 ec             	cmp    %r13,%r12
+  804ef4:	0f 83 ae 00 00 00    	jae    804fa8 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804efa:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804efe:	4c 89 e7             	mov    %r12,%rdi
+  804f01:	41 ff d6             	call   *%r14
+  804f04:	84 c0                	test   %al,%al
+  804f06:	74 e2                	je     804eea <mmap_writeback+0x60>
+  804f08:	4c 89 e7             	mov    %r12,%rdi
+  804f0b:	41 ff d7             	call   *%r15
+  804f0e:	84 c0                	test   %al,%al
+  804f10:	74 d8                	je     804eea <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f12:	4c 89 e3             	mov    %r12,%rbx
+  804f15:	4d 39 ec             	cmp    %r13,%r12
+  804f18:	73 20                	jae    804f3a <mmap_writeback+0xb0>
+  804f1a:	48 89 df             	mov    %rbx,%rdi
+  804f1d:	41 ff d6             	call   *%r14
+  804f20:	84 c0                	test   %al,%al
+  804f22:	74 16                	je     804f3a <mmap_writeback+0xb0>
+  804f24:	48 89 df             	mov    %rbx,%rdi
+  804f27:	41 ff d7             	call   *%r15
+  804f2a:	84 c0                	test   %al,%al
+  804f2c:	74 0c                	je     804f3a <mmap_writeback+0xb0>
+  804f2e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f35:	4c 39 eb             	cmp    %r13,%rbx
+  804f38:	72 e0                	jb     804f1a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f3a:	48 89 d9             	mov    %rbx,%rcx
+  804f3d:	4c 29 e1             	sub    %r12,%rcx
+  804f40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f44:	44 89 e6             	mov    %r12d,%esi
+  804f47:	2b 30                	sub    (%rax),%esi
+  804f49:	49 89 c4             	mov    %rax,%r12
+  804f4c:	03 70 1c             	add    0x1c(%rax),%esi
+  804f4f:	8b 78 18             	mov    0x18(%rax),%edi
+  804f52:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804f56:	48 89 ca             	mov    %rcx,%rdx
+  804f59:	48 b8 0a 40 80 00 00 	movabs $0x80400a,%rax
+  804f60:	00 00 00 
+  804f63:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f65:	85 c0                	test   %eax,%eax
+  804f67:	78 44                	js     804fad <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804f69:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804f6e:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804f71:	41 89 c1             	mov    %eax,%r9d
+  804f74:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804f7b:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804f7f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f88:	48 89 ce             	mov    %rcx,%rsi
+  804f8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f90:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  804f97:	00 00 00 
+  804f9a:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804f9c:	85 c0                	test   %eax,%eax
+  804f9e:	78 0d                	js     804fad <mmap_writeback+0x123>
+  804fa0:	49 89 dc             	mov    %rbx,%r12
+  804fa3:	e9 49 ff ff ff       	jmp    804ef1 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804fa8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fad:	48 83 c4 28          	add    $0x28,%rsp
+  804fb1:	5b                   	pop    %rbx
+  804fb2:	41 5c                	pop    %r12
+  804fb4:	41 5d                	pop    %r13
+  804fb6:	41 5e                	pop    %r14
+  804fb8:	41 5f                	pop    %r15
+  804fba:	5d                   	pop    %rbp
+  804fbb:	c3                   	ret
+    return 0;
+  804fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fc1:	eb ea                	jmp    804fad <mmap_writeback+0x123>
+
+0000000000804fc3 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804fc3:	55                   	push   %rbp
+  804fc4:	48 89 e5             	mov    %rsp,%rbp
+  804fc7:	41 57                	push   %r15
+  804fc9:	41 56                	push   %r14
+  804fcb:	41 55                	push   %r13
+  804fcd:	41 54                	push   %r12
+  804fcf:	53                   	push   %rbx
+  804fd0:	48 83 ec 38          	sub    $0x38,%rsp
+  804fd4:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804fd8:	48 85 f6             	test   %rsi,%rsi
+  804fdb:	0f 84 0c 02 00 00    	je     8051ed <mmap+0x22a>
+  804fe1:	49 89 ff             	mov    %rdi,%r15
+  804fe4:	49 89 f4             	mov    %rsi,%r12
+  804fe7:	41 89 d5             	mov    %edx,%r13d
+  804fea:	41 89 ce             	mov    %ecx,%r14d
+  804fed:	44 89 cb             	mov    %r9d,%ebx
+  804ff0:	45 85 c9             	test   %r9d,%r9d
+  804ff3:	0f 88 f4 01 00 00    	js     8051ed <mmap+0x22a>
+  804ff9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805000:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805007:	0f 85 e7 01 00 00    	jne    8051f4 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  80500d:	83 e2 fd             	and    $0xfffffffd,%edx
+  805010:	83 fa 04             	cmp    $0x4,%edx
+  805013:	0f 85 db 01 00 00    	jne    8051f4 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805019:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80501c:	83 fa 01             	cmp    $0x1,%edx
+  80501f:	0f 87 cf 01 00 00    	ja     8051f4 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805025:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805029:	44 89 c7             	mov    %r8d,%edi
+  80502c:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  805033:	00 00 00 
+  805036:	ff d0                	call   *%rax
+  805038:	89 c2                	mov    %eax,%edx
+  80503a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805041:	85 d2                	test   %edx,%edx
+  805043:	0f 88 ab 01 00 00    	js     8051f4 <mmap+0x231>
+  805049:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80504d:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  805054:	00 00 00 
+  805057:	8b 09                	mov    (%rcx),%ecx
+  805059:	39 0a                	cmp    %ecx,(%rdx)
+  80505b:	0f 85 93 01 00 00    	jne    8051f4 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805061:	8b 52 08             	mov    0x8(%rdx),%edx
+  805064:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805067:	83 fa 01             	cmp    $0x1,%edx
+  80506a:	0f 84 84 01 00 00    	je     8051f4 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805070:	41 83 fe 01          	cmp    $0x1,%r14d
+  805074:	74 42                	je     8050b8 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805076:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  80507d:	4c 89 e6             	mov    %r12,%rsi
+  805080:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805087:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  80508b:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  80508f:	4d 85 ff             	test   %r15,%r15
+  805092:	74 67                	je     8050fb <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805094:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  80509b:	75 0f                	jne    8050ac <mmap+0xe9>
+  80509d:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8050a4:	00 00 00 
+  8050a7:	49 39 c7             	cmp    %rax,%r15
+  8050aa:	77 1b                	ja     8050c7 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8050ac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050b3:	e9 3c 01 00 00       	jmp    8051f4 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050b8:	41 f6 c5 02          	test   $0x2,%r13b
+  8050bc:	74 b8                	je     805076 <mmap+0xb3>
+  8050be:	85 d2                	test   %edx,%edx
+  8050c0:	75 b4                	jne    805076 <mmap+0xb3>
+  8050c2:	e9 2d 01 00 00       	jmp    8051f4 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8050c7:	4c 89 ff             	mov    %r15,%rdi
+  8050ca:	48 b8 31 4c 80 00 00 	movabs $0x804c31,%rax
+  8050d1:	00 00 00 
+  8050d4:	ff d0                	call   *%rax
+  8050d6:	48 89 c2             	mov    %rax,%rdx
+  8050d9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050e0:	49 39 d7             	cmp    %rdx,%r15
+  8050e3:	0f 85 0b 01 00 00    	jne    8051f4 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050e9:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8050f0:	00 00 00 
+  8050f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8050f9:	eb 44                	jmp    80513f <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8050fb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8050ff:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805106:	00 00 00 
+  805109:	48 b8 31 4c 80 00 00 	movabs $0x804c31,%rax
+  805110:	00 00 00 
+  805113:	ff d0                	call   *%rax
+  805115:	48 89 c7             	mov    %rax,%rdi
+  805118:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80511c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805123:	48 85 ff             	test   %rdi,%rdi
+  805126:	75 c1                	jne    8050e9 <mmap+0x126>
+  805128:	e9 c7 00 00 00       	jmp    8051f4 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80512d:	49 83 c4 01          	add    $0x1,%r12
+  805131:	48 83 c0 20          	add    $0x20,%rax
+  805135:	49 83 fc 20          	cmp    $0x20,%r12
+  805139:	0f 84 a5 00 00 00    	je     8051e4 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80513f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805143:	75 e8                	jne    80512d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805145:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805149:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  805150:	00 00 00 
+  805153:	ff d0                	call   *%rax
+  805155:	89 c2                	mov    %eax,%edx
+  805157:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80515e:	85 d2                	test   %edx,%edx
+  805160:	0f 88 8e 00 00 00    	js     8051f4 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805166:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80516a:	48 b8 96 32 80 00 00 	movabs $0x803296,%rax
+  805171:	00 00 00 
+  805174:	ff d0                	call   *%rax
+  805176:	89 c6                	mov    %eax,%esi
+  805178:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80517b:	48 b8 e4 34 80 00 00 	movabs $0x8034e4,%rax
+  805182:	00 00 00 
+  805185:	ff d0                	call   *%rax
+  805187:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80518a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805191:	45 85 ff             	test   %r15d,%r15d
+  805194:	78 5e                	js     8051f4 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805196:	49 c1 e4 05          	shl    $0x5,%r12
+  80519a:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8051a1:	00 00 00 
+  8051a4:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8051a7:	48 bf a2 4c 80 00 00 	movabs $0x804ca2,%rdi
+  8051ae:	00 00 00 
+  8051b1:	48 b8 cd 56 80 00 00 	movabs $0x8056cd,%rax
+  8051b8:	00 00 00 
+  8051bb:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8051bd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8051c1:	49 89 04 24          	mov    %rax,(%r12)
+  8051c5:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8051c9:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8051ce:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8051d3:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8051d8:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8051dd:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8051e2:	eb 10                	jmp    8051f4 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8051e4:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051eb:	eb 07                	jmp    8051f4 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8051ed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8051f4:	48 83 c4 38          	add    $0x38,%rsp
+  8051f8:	5b                   	pop    %rbx
+  8051f9:	41 5c                	pop    %r12
+  8051fb:	41 5d                	pop    %r13
+  8051fd:	41 5e                	pop    %r14
+  8051ff:	41 5f                	pop    %r15
+  805201:	5d                   	pop    %rbp
+  805202:	c3                   	ret
+
+0000000000805203 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805203:	55                   	push   %rbp
+  805204:	48 89 e5             	mov    %rsp,%rbp
+  805207:	41 57                	push   %r15
+  805209:	41 56                	push   %r14
+  80520b:	41 55                	push   %r13
+  80520d:	41 54                	push   %r12
+  80520f:	53                   	push   %rbx
+  805210:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805214:	49 89 fe             	mov    %rdi,%r14
+  805217:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80521e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805225:	00 
+  805226:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80522d:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805234:	00 00 00 
+  805237:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80523e:	49 bf 8a 4e 80 00 00 	movabs $0x804e8a,%r15
+  805245:	00 00 00 
+  805248:	eb 09                	jmp    805253 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80524a:	48 83 c3 20          	add    $0x20,%rbx
+  80524e:	4c 39 eb             	cmp    %r13,%rbx
+  805251:	74 33                	je     805286 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805253:	48 89 df             	mov    %rbx,%rdi
+  805256:	48 8b 33             	mov    (%rbx),%rsi
+  805259:	4c 39 e6             	cmp    %r12,%rsi
+  80525c:	73 ec                	jae    80524a <msync+0x47>
+  80525e:	48 85 f6             	test   %rsi,%rsi
+  805261:	74 e7                	je     80524a <msync+0x47>
+  805263:	48 89 f2             	mov    %rsi,%rdx
+  805266:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80526a:	49 39 d6             	cmp    %rdx,%r14
+  80526d:	73 db                	jae    80524a <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80526f:	4c 39 e2             	cmp    %r12,%rdx
+  805272:	49 0f 47 d4          	cmova  %r12,%rdx
+  805276:	4c 39 f6             	cmp    %r14,%rsi
+  805279:	49 0f 42 f6          	cmovb  %r14,%rsi
+  80527d:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805280:	85 c0                	test   %eax,%eax
+  805282:	79 c6                	jns    80524a <msync+0x47>
+  805284:	eb 05                	jmp    80528b <msync+0x88>
+    }
+
+    return 0;
+  805286:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80528b:	48 83 c4 08          	add    $0x8,%rsp
+  80528f:	5b                   	pop    %rbx
+  805290:	41 5c                	pop    %r12
+  805292:	41 5d                	pop    %r13
+  805294:	41 5e                	pop    %r14
+  805296:	41 5f                	pop    %r15
+  805298:	5d                   	pop    %rbp
+  805299:	c3                   	ret
+
+000000000080529a <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80529a:	55                   	push   %rbp
+  80529b:	48 89 e5             	mov    %rsp,%rbp
+  80529e:	41 57                	push   %r15
+  8052a0:	41 56                	push   %r14
+  8052a2:	41 55                	push   %r13
+  8052a4:	41 54                	push   %r12
+  8052a6:	53                   	push   %rbx
+  8052a7:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8052ab:	49 89 ff             	mov    %rdi,%r15
+  8052ae:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052b5:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8052bc:	00 
+  8052bd:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052c4:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8052cb:	00 00 00 
+  8052ce:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052d5:	48 89 d8             	mov    %rbx,%rax
+  8052d8:	eb 09                	jmp    8052e3 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052da:	48 83 c0 20          	add    $0x20,%rax
+  8052de:	4c 39 f0             	cmp    %r14,%rax
+  8052e1:	74 40                	je     805323 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052e3:	48 8b 10             	mov    (%rax),%rdx
+  8052e6:	4c 39 e2             	cmp    %r12,%rdx
+  8052e9:	73 ef                	jae    8052da <munmap+0x40>
+  8052eb:	48 85 d2             	test   %rdx,%rdx
+  8052ee:	74 ea                	je     8052da <munmap+0x40>
+  8052f0:	48 89 d7             	mov    %rdx,%rdi
+  8052f3:	48 03 78 08          	add    0x8(%rax),%rdi
+  8052f7:	49 39 ff             	cmp    %rdi,%r15
+  8052fa:	73 de                	jae    8052da <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8052fc:	49 39 fc             	cmp    %rdi,%r12
+  8052ff:	72 05                	jb     805306 <munmap+0x6c>
+  805301:	4c 39 fa             	cmp    %r15,%rdx
+  805304:	73 d4                	jae    8052da <munmap+0x40>
+  805306:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80530b:	48 83 c4 08          	add    $0x8,%rsp
+  80530f:	5b                   	pop    %rbx
+  805310:	41 5c                	pop    %r12
+  805312:	41 5d                	pop    %r13
+  805314:	41 5e                	pop    %r14
+  805316:	41 5f                	pop    %r15
+  805318:	5d                   	pop    %rbp
+  805319:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80531a:	48 83 c3 20          	add    $0x20,%rbx
+  80531e:	4c 39 f3             	cmp    %r14,%rbx
+  805321:	74 5c                	je     80537f <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805323:	48 8b 33             	mov    (%rbx),%rsi
+  805326:	4c 39 e6             	cmp    %r12,%rsi
+  805329:	73 ef                	jae    80531a <munmap+0x80>
+  80532b:	48 85 f6             	test   %rsi,%rsi
+  80532e:	74 ea                	je     80531a <munmap+0x80>
+  805330:	48 89 f2             	mov    %rsi,%rdx
+  805333:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805337:	49 39 d7             	cmp    %rdx,%r15
+  80533a:	73 de                	jae    80531a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80533c:	48 89 df             	mov    %rbx,%rdi
+  80533f:	48 b8 8a 4e 80 00 00 	movabs $0x804e8a,%rax
+  805346:	00 00 00 
+  805349:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80534b:	85 c0                	test   %eax,%eax
+  80534d:	78 bc                	js     80530b <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  80534f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805353:	48 8b 33             	mov    (%rbx),%rsi
+  805356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80535b:	48 b8 5e 2b 80 00 00 	movabs $0x802b5e,%rax
+  805362:	00 00 00 
+  805365:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805367:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80536a:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  805371:	00 00 00 
+  805374:	ff d0                	call   *%rax
+        reg->start = 0;
+  805376:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80537d:	eb 9b                	jmp    80531a <munmap+0x80>
+    return 0;
+  80537f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805384:	eb 85                	jmp    80530b <munmap+0x71>
+
+0000000000805386 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80538b:	c3                   	ret
+
+000000000080538c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80538c:	55                   	push   %rbp
+  80538d:	48 89 e5             	mov    %rsp,%rbp
+  805390:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805393:	48 be db 69 80 00 00 	movabs $0x8069db,%rsi
+  80539a:	00 00 00 
+  80539d:	48 b8 21 23 80 00 00 	movabs $0x802321,%rax
+  8053a4:	00 00 00 
+  8053a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8053a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053ae:	5d                   	pop    %rbp
+  8053af:	c3                   	ret
+
+00000000008053b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8053b0:	55                   	push   %rbp
+  8053b1:	48 89 e5             	mov    %rsp,%rbp
+  8053b4:	41 57                	push   %r15
+  8053b6:	41 56                	push   %r14
+  8053b8:	41 55                	push   %r13
+  8053ba:	41 54                	push   %r12
+  8053bc:	53                   	push   %rbx
+  8053bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8053c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8053cb:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8053d2:	00 00 00 00 
+  8053d6:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  8053dd:	00 00 00 00 
+  8053e1:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8053e8:	00 00 00 00 
+  8053ec:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8053f3:	00 00 00 00 
+  8053f7:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8053fe:	00 00 00 00 
+  805402:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805409:	00 00 00 00 
+  80540d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805414:	00 
+  805415:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  80541c:	00 
+  80541d:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805424:	00 
+  805425:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  80542c:	00 
+  80542d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805434:	00 
+  805435:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80543c:	00 
+  80543d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805444:	00 
+  805445:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80544c:	00 
+  80544d:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805454:	00 
+  805455:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80545c:	00 
+    for (res = 0; res < n; res += inc) {
+  80545d:	48 85 d2             	test   %rdx,%rdx
+  805460:	74 7a                	je     8054dc <devcons_write+0x12c>
+  805462:	49 89 d6             	mov    %rdx,%r14
+  805465:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80546b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805470:	49 bf 71 26 80 00 00 	movabs $0x802671,%r15
+  805477:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80547a:	4c 89 f3             	mov    %r14,%rbx
+  80547d:	48 29 f3             	sub    %rsi,%rbx
+  805480:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805485:	48 39 c3             	cmp    %rax,%rbx
+  805488:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80548c:	4c 63 eb             	movslq %ebx,%r13
+  80548f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805496:	48 01 c6             	add    %rax,%rsi
+  805499:	4c 89 ea             	mov    %r13,%rdx
+  80549c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8054a3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8054a6:	4c 89 ee             	mov    %r13,%rsi
+  8054a9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8054b0:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  8054b7:	00 00 00 
+  8054ba:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8054bc:	41 01 dc             	add    %ebx,%r12d
+  8054bf:	49 63 f4             	movslq %r12d,%rsi
+  8054c2:	4c 39 f6             	cmp    %r14,%rsi
+  8054c5:	72 b3                	jb     80547a <devcons_write+0xca>
+    return res;
+  8054c7:	49 63 c4             	movslq %r12d,%rax
+}
+  8054ca:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8054d1:	5b                   	pop    %rbx
+  8054d2:	41 5c                	pop    %r12
+  8054d4:	41 5d                	pop    %r13
+  8054d6:	41 5e                	pop    %r14
+  8054d8:	41 5f                	pop    %r15
+  8054da:	5d                   	pop    %rbp
+  8054db:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8054dc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8054e2:	eb e3                	jmp    8054c7 <devcons_write+0x117>
+
+00000000008054e4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054e4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8054e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054ec:	48 85 c0             	test   %rax,%rax
+  8054ef:	74 55                	je     805546 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8054f1:	55                   	push   %rbp
+  8054f2:	48 89 e5             	mov    %rsp,%rbp
+  8054f5:	41 55                	push   %r13
+  8054f7:	41 54                	push   %r12
+  8054f9:	53                   	push   %rbx
+  8054fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8054fe:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805501:	48 bb d1 28 80 00 00 	movabs $0x8028d1,%rbx
+  805508:	00 00 00 
+  80550b:	49 bc e5 29 80 00 00 	movabs $0x8029e5,%r12
+  805512:	00 00 00 
+  805515:	eb 03                	jmp    80551a <devcons_read+0x36>
+  805517:	41 ff d4             	call   *%r12
+  80551a:	ff d3                	call   *%rbx
+  80551c:	85 c0                	test   %eax,%eax
+  80551e:	74 f7                	je     805517 <devcons_read+0x33>
+    if (c < 0) return c;
+  805520:	48 63 d0             	movslq %eax,%rdx
+  805523:	78 13                	js     805538 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80552a:	83 f8 04             	cmp    $0x4,%eax
+  80552d:	74 09                	je     805538 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80552f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805533:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805538:	48 89 d0             	mov    %rdx,%rax
+  80553b:	48 83 c4 08          	add    $0x8,%rsp
+  80553f:	5b                   	pop    %rbx
+  805540:	41 5c                	pop    %r12
+  805542:	41 5d                	pop    %r13
+  805544:	5d                   	pop    %rbp
+  805545:	c3                   	ret
+  805546:	48 89 d0             	mov    %rdx,%rax
+  805549:	c3                   	ret
+
+000000000080554a <cputchar>:
+cputchar(int ch) {
+  80554a:	55                   	push   %rbp
+  80554b:	48 89 e5             	mov    %rsp,%rbp
+  80554e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805552:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805556:	be 01 00 00 00       	mov    $0x1,%esi
+  80555b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80555f:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  805566:	00 00 00 
+  805569:	ff d0                	call   *%rax
+}
+  80556b:	c9                   	leave
+  80556c:	c3                   	ret
+
+000000000080556d <getchar>:
+getchar(void) {
+  80556d:	55                   	push   %rbp
+  80556e:	48 89 e5             	mov    %rsp,%rbp
+  805571:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805575:	ba 01 00 00 00       	mov    $0x1,%edx
+  80557a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80557e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805583:	48 b8 07 36 80 00 00 	movabs $0x803607,%rax
+  80558a:	00 00 00 
+  80558d:	ff d0                	call   *%rax
+  80558f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805591:	85 c0                	test   %eax,%eax
+  805593:	78 06                	js     80559b <getchar+0x2e>
+  805595:	74 08                	je     80559f <getchar+0x32>
+  805597:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80559b:	89 d0                	mov    %edx,%eax
+  80559d:	c9                   	leave
+  80559e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80559f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8055a4:	eb f5                	jmp    80559b <getchar+0x2e>
+
+00000000008055a6 <iscons>:
+iscons(int fdnum) {
+  8055a6:	55                   	push   %rbp
+  8055a7:	48 89 e5             	mov    %rsp,%rbp
+  8055aa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8055ae:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8055b2:	48 b8 24 33 80 00 00 	movabs $0x803324,%rax
+  8055b9:	00 00 00 
+  8055bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8055be:	85 c0                	test   %eax,%eax
+  8055c0:	78 18                	js     8055da <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8055c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055c6:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8055cd:	00 00 00 
+  8055d0:	8b 00                	mov    (%rax),%eax
+  8055d2:	39 02                	cmp    %eax,(%rdx)
+  8055d4:	0f 94 c0             	sete   %al
+  8055d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8055da:	c9                   	leave
+  8055db:	c3                   	ret
+
+00000000008055dc <opencons>:
+opencons(void) {
+  8055dc:	55                   	push   %rbp
+  8055dd:	48 89 e5             	mov    %rsp,%rbp
+  8055e0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8055e4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8055e8:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  8055ef:	00 00 00 
+  8055f2:	ff d0                	call   *%rax
+  8055f4:	85 c0                	test   %eax,%eax
+  8055f6:	78 49                	js     805641 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8055f8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805602:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80560b:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  805612:	00 00 00 
+  805615:	ff d0                	call   *%rax
+  805617:	85 c0                	test   %eax,%eax
+  805619:	78 26                	js     805641 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80561b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80561f:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805626:	00 00 
+  805628:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80562a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80562e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805635:	48 b8 96 32 80 00 00 	movabs $0x803296,%rax
+  80563c:	00 00 00 
+  80563f:	ff d0                	call   *%rax
+}
+  805641:	c9                   	leave
+  805642:	c3                   	ret
+
+0000000000805643 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805643:	55                   	push   %rbp
+  805644:	48 89 e5             	mov    %rsp,%rbp
+  805647:	41 56                	push   %r14
+  805649:	41 55                	push   %r13
+  80564b:	41 54                	push   %r12
+  80564d:	53                   	push   %rbx
+  80564e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805651:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805658:	00 00 00 
+  80565b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80565f:	74 27                	je     805688 <_handle_vectored_pagefault+0x45>
+  805661:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805666:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80566d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805670:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805673:	4c 89 e7             	mov    %r12,%rdi
+  805676:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80567b:	84 c0                	test   %al,%al
+  80567d:	75 45                	jne    8056c4 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80567f:	48 83 c3 01          	add    $0x1,%rbx
+  805683:	49 3b 1e             	cmp    (%r14),%rbx
+  805686:	72 eb                	jb     805673 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805688:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80568f:	00 
+  805690:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805695:	4d 8b 04 24          	mov    (%r12),%r8
+  805699:	48 ba e8 69 80 00 00 	movabs $0x8069e8,%rdx
+  8056a0:	00 00 00 
+  8056a3:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8056a8:	48 bf 18 6a 80 00 00 	movabs $0x806a18,%rdi
+  8056af:	00 00 00 
+  8056b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056b7:	49 ba 9a 18 80 00 00 	movabs $0x80189a,%r10
+  8056be:	00 00 00 
+  8056c1:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8056c4:	5b                   	pop    %rbx
+  8056c5:	41 5c                	pop    %r12
+  8056c7:	41 5d                	pop    %r13
+  8056c9:	41 5e                	pop    %r14
+  8056cb:	5d                   	pop    %rbp
+  8056cc:	c3                   	ret
+
+00000000008056cd <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8056cd:	55                   	push   %rbp
+  8056ce:	48 89 e5             	mov    %rsp,%rbp
+  8056d1:	53                   	push   %rbx
+  8056d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8056d6:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8056d9:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8056de:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8056e5:	00 00 00 
+  8056e8:	80 38 00             	cmpb   $0x0,(%rax)
+  8056eb:	74 68                	je     805755 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8056ed:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056f4:	00 00 00 
+  8056f7:	48 8b 08             	mov    (%rax),%rcx
+  8056fa:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8056ff:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805706:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805709:	48 85 c9             	test   %rcx,%rcx
+  80570c:	0f 84 e0 00 00 00    	je     8057f2 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805712:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805716:	0f 84 c9 00 00 00    	je     8057e5 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80571c:	48 83 c2 01          	add    $0x1,%rdx
+  805720:	48 39 ca             	cmp    %rcx,%rdx
+  805723:	75 ed                	jne    805712 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805725:	48 83 f9 08          	cmp    $0x8,%rcx
+  805729:	0f 84 84 00 00 00    	je     8057b3 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80572f:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805733:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80573a:	00 00 00 
+  80573d:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805744:	00 00 00 
+  805747:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80574b:	85 f6                	test   %esi,%esi
+  80574d:	0f 89 97 00 00 00    	jns    8057ea <add_pgfault_handler+0x11d>
+  805753:	eb 63                	jmp    8057b8 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805755:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80575a:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80575f:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805766:	00 00 00 
+  805769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80576e:	48 b8 86 2a 80 00 00 	movabs $0x802a86,%rax
+  805775:	00 00 00 
+  805778:	ff d0                	call   *%rax
+  80577a:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80577c:	85 c0                	test   %eax,%eax
+  80577e:	78 38                	js     8057b8 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805780:	48 be ce 58 80 00 00 	movabs $0x8058ce,%rsi
+  805787:	00 00 00 
+  80578a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80578f:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  805796:	00 00 00 
+  805799:	ff d0                	call   *%rax
+  80579b:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80579d:	85 c0                	test   %eax,%eax
+  80579f:	78 17                	js     8057b8 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8057a1:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8057a8:	00 00 00 
+  8057ab:	c6 00 01             	movb   $0x1,(%rax)
+  8057ae:	e9 3a ff ff ff       	jmp    8056ed <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8057b3:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8057b8:	89 f1                	mov    %esi,%ecx
+  8057ba:	48 ba 26 6a 80 00 00 	movabs $0x806a26,%rdx
+  8057c1:	00 00 00 
+  8057c4:	be 42 00 00 00       	mov    $0x42,%esi
+  8057c9:	48 bf 18 6a 80 00 00 	movabs $0x806a18,%rdi
+  8057d0:	00 00 00 
+  8057d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057d8:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  8057df:	00 00 00 
+  8057e2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8057e5:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8057ea:	89 f0                	mov    %esi,%eax
+  8057ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8057f0:	c9                   	leave
+  8057f1:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8057f2:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8057f9:	00 00 00 
+  8057fc:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805803:	48 89 d8             	mov    %rbx,%rax
+  805806:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  80580d:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805810:	eb d8                	jmp    8057ea <add_pgfault_handler+0x11d>
+
+0000000000805812 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805812:	55                   	push   %rbp
+  805813:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805816:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80581d:	00 00 00 
+  805820:	80 38 00             	cmpb   $0x0,(%rax)
+  805823:	74 33                	je     805858 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805825:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  80582c:	00 00 00 
+  80582f:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805834:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  80583b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80583e:	48 85 c0             	test   %rax,%rax
+  805841:	0f 84 85 00 00 00    	je     8058cc <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805847:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80584b:	74 40                	je     80588d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80584d:	48 83 c1 01          	add    $0x1,%rcx
+  805851:	48 39 c1             	cmp    %rax,%rcx
+  805854:	75 f1                	jne    805847 <remove_pgfault_handler+0x35>
+  805856:	eb 74                	jmp    8058cc <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805858:	48 b9 3e 6a 80 00 00 	movabs $0x806a3e,%rcx
+  80585f:	00 00 00 
+  805862:	48 ba 16 69 80 00 00 	movabs $0x806916,%rdx
+  805869:	00 00 00 
+  80586c:	be 48 00 00 00       	mov    $0x48,%esi
+  805871:	48 bf 18 6a 80 00 00 	movabs $0x806a18,%rdi
+  805878:	00 00 00 
+  80587b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805880:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  805887:	00 00 00 
+  80588a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80588d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805894:	00 
+  805895:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805899:	48 29 ca             	sub    %rcx,%rdx
+  80589c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058a3:	00 00 00 
+  8058a6:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8058aa:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8058af:	48 89 ce             	mov    %rcx,%rsi
+  8058b2:	48 b8 71 26 80 00 00 	movabs $0x802671,%rax
+  8058b9:	00 00 00 
+  8058bc:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8058be:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8058c5:	00 00 00 
+  8058c8:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8058cc:	5d                   	pop    %rbp
+  8058cd:	c3                   	ret
+
+00000000008058ce <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8058ce:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8058d1:	48 b8 43 56 80 00 00 	movabs $0x805643,%rax
+  8058d8:	00 00 00 
+    call *%rax
+  8058db:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8058dd:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8058e4:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8058e5:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8058ec:	00 
+    subq $8, %rcx
+  8058ed:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8058f1:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8058f4:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8058fb:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8058fc:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805900:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805904:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805909:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80590e:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805913:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805918:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80591d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805922:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805927:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80592c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805931:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805936:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80593b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805940:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805945:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80594a:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80594e:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805952:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805953:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805954:	c3                   	ret
+
+0000000000805955 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805955:	85 ff                	test   %edi,%edi
+  805957:	78 58                	js     8059b1 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805959:	48 85 f6             	test   %rsi,%rsi
+  80595c:	74 12                	je     805970 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80595e:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  805965:	00 00 00 
+  805968:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80596e:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805970:	48 85 c9             	test   %rcx,%rcx
+  805973:	74 12                	je     805987 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805975:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  80597c:	00 00 00 
+  80597f:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805985:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805987:	48 85 d2             	test   %rdx,%rdx
+  80598a:	74 14                	je     8059a0 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  80598c:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  805993:	00 00 00 
+  805996:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  80599d:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8059a0:	48 a1 20 84 80 01 00 	movabs 0x1808420,%rax
+  8059a7:	00 00 00 
+  8059aa:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8059b0:	c3                   	ret
+        if (from_env_store) {
+  8059b1:	48 85 f6             	test   %rsi,%rsi
+  8059b4:	74 06                	je     8059bc <ipc_result+0x67>
+            *from_env_store = 0;
+  8059b6:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8059bc:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8059be:	48 85 c9             	test   %rcx,%rcx
+  8059c1:	74 ed                	je     8059b0 <ipc_result+0x5b>
+            *perm_store = 0;
+  8059c3:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8059c9:	c3                   	ret
+
+00000000008059ca <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8059ca:	55                   	push   %rbp
+  8059cb:	48 89 e5             	mov    %rsp,%rbp
+  8059ce:	41 55                	push   %r13
+  8059d0:	41 54                	push   %r12
+  8059d2:	53                   	push   %rbx
+  8059d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8059d7:	49 89 fc             	mov    %rdi,%r12
+  8059da:	48 89 f7             	mov    %rsi,%rdi
+  8059dd:	48 89 d3             	mov    %rdx,%rbx
+  8059e0:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8059e3:	48 85 f6             	test   %rsi,%rsi
+  8059e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8059ed:	00 00 00 
+  8059f0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8059f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8059f9:	48 85 d2             	test   %rdx,%rdx
+  8059fc:	74 03                	je     805a01 <ipc_recv+0x37>
+  8059fe:	48 8b 32             	mov    (%rdx),%rsi
+  805a01:	48 b8 d2 2f 80 00 00 	movabs $0x802fd2,%rax
+  805a08:	00 00 00 
+  805a0b:	ff d0                	call   *%rax
+  805a0d:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805a0f:	4c 89 e9             	mov    %r13,%rcx
+  805a12:	48 89 da             	mov    %rbx,%rdx
+  805a15:	4c 89 e6             	mov    %r12,%rsi
+  805a18:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805a1f:	00 00 00 
+  805a22:	ff d0                	call   *%rax
+}
+  805a24:	48 83 c4 08          	add    $0x8,%rsp
+  805a28:	5b                   	pop    %rbx
+  805a29:	41 5c                	pop    %r12
+  805a2b:	41 5d                	pop    %r13
+  805a2d:	5d                   	pop    %rbp
+  805a2e:	c3                   	ret
+
+0000000000805a2f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805a2f:	55                   	push   %rbp
+  805a30:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805a33:	48 85 d2             	test   %rdx,%rdx
+  805a36:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a3d:	00 00 00 
+  805a40:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805a44:	89 f6                	mov    %esi,%esi
+  805a46:	48 b8 5e 2e 80 00 00 	movabs $0x802e5e,%rax
+  805a4d:	00 00 00 
+  805a50:	ff d0                	call   *%rax
+    if (res < 0) {
+  805a52:	85 c0                	test   %eax,%eax
+  805a54:	78 02                	js     805a58 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805a56:	5d                   	pop    %rbp
+  805a57:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805a58:	89 c1                	mov    %eax,%ecx
+  805a5a:	48 ba 58 6a 80 00 00 	movabs $0x806a58,%rdx
+  805a61:	00 00 00 
+  805a64:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805a69:	48 bf 65 6a 80 00 00 	movabs $0x806a65,%rdi
+  805a70:	00 00 00 
+  805a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a78:	49 b8 9a 18 80 00 00 	movabs $0x80189a,%r8
+  805a7f:	00 00 00 
+  805a82:	41 ff d0             	call   *%r8
+
+0000000000805a85 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805a85:	55                   	push   %rbp
+  805a86:	48 89 e5             	mov    %rsp,%rbp
+  805a89:	53                   	push   %rbx
+  805a8a:	48 83 ec 08          	sub    $0x8,%rsp
+  805a8e:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805a92:	48 85 d2             	test   %rdx,%rdx
+  805a95:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a9c:	00 00 00 
+  805a9f:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805aa3:	4d 85 c9             	test   %r9,%r9
+  805aa6:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aaf:	48 85 db             	test   %rbx,%rbx
+  805ab2:	74 03                	je     805ab7 <ipc_call+0x32>
+  805ab4:	48 8b 03             	mov    (%rbx),%rax
+  805ab7:	89 f6                	mov    %esi,%esi
+  805ab9:	48 83 ec 08          	sub    $0x8,%rsp
+  805abd:	50                   	push   %rax
+  805abe:	48 b8 90 2e 80 00 00 	movabs $0x802e90,%rax
+  805ac5:	00 00 00 
+  805ac8:	ff d0                	call   *%rax
+  805aca:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805acc:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805ad0:	48 89 da             	mov    %rbx,%rdx
+  805ad3:	be 00 00 00 00       	mov    $0x0,%esi
+  805ad8:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805adf:	00 00 00 
+  805ae2:	ff d0                	call   *%rax
+}
+  805ae4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ae8:	c9                   	leave
+  805ae9:	c3                   	ret
+
+0000000000805aea <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805aea:	55                   	push   %rbp
+  805aeb:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805aee:	89 f6                	mov    %esi,%esi
+  805af0:	48 b8 fc 2e 80 00 00 	movabs $0x802efc,%rax
+  805af7:	00 00 00 
+  805afa:	ff d0                	call   *%rax
+  805afc:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805afe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805b03:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b08:	be 00 00 00 00       	mov    $0x0,%esi
+  805b0d:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805b14:	00 00 00 
+  805b17:	ff d0                	call   *%rax
+}
+  805b19:	5d                   	pop    %rbp
+  805b1a:	c3                   	ret
+
+0000000000805b1b <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805b1b:	55                   	push   %rbp
+  805b1c:	48 89 e5             	mov    %rsp,%rbp
+  805b1f:	41 54                	push   %r12
+  805b21:	53                   	push   %rbx
+  805b22:	4c 89 cb             	mov    %r9,%rbx
+  805b25:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805b29:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805b2d:	48 85 d2             	test   %rdx,%rdx
+  805b30:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b37:	00 00 00 
+  805b3a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805b3e:	4d 85 c9             	test   %r9,%r9
+  805b41:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b4a:	4d 85 e4             	test   %r12,%r12
+  805b4d:	74 04                	je     805b53 <ipc_reply_wait+0x38>
+  805b4f:	49 8b 04 24          	mov    (%r12),%rax
+  805b53:	89 f6                	mov    %esi,%esi
+  805b55:	48 83 ec 08          	sub    $0x8,%rsp
+  805b59:	50                   	push   %rax
+  805b5a:	48 b8 66 2f 80 00 00 	movabs $0x802f66,%rax
+  805b61:	00 00 00 
+  805b64:	ff d0                	call   *%rax
+  805b66:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805b68:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805b6c:	4c 89 e2             	mov    %r12,%rdx
+  805b6f:	48 89 de             	mov    %rbx,%rsi
+  805b72:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805b79:	00 00 00 
+  805b7c:	ff d0                	call   *%rax
+}
+  805b7e:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805b82:	5b                   	pop    %rbx
+  805b83:	41 5c                	pop    %r12
+  805b85:	5d                   	pop    %rbp
+  805b86:	c3                   	ret
+
+0000000000805b87 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805b87:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805b8c:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805b93:	00 00 00 
+  805b96:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805b9d:	48 01 ca             	add    %rcx,%rdx
+  805ba0:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805ba6:	39 fa                	cmp    %edi,%edx
+  805ba8:	74 12                	je     805bbc <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805baa:	48 83 c0 01          	add    $0x1,%rax
+  805bae:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805bb4:	75 e0                	jne    805b96 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805bbb:	c3                   	ret
+            return envs[i].env_id;
+  805bbc:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805bc3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805bca:	00 00 00 
+  805bcd:	48 01 d0             	add    %rdx,%rax
+  805bd0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805bd6:	c3                   	ret
+  805bd7:	90                   	nop
+
+0000000000805bd8 <__rodata_start>:
+  805bd8:	77 00                	ja     805bda <__rodata_start+0x2>
+  805bda:	72 62                	jb     805c3e <__rodata_start+0x66>
+  805bdc:	00 77 62             	add    %dh,0x62(%rdi)
+  805bdf:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 ed                	add    %ch,%ch
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	ed                   	in     (%dx),%eax
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 ed                	add    %ch,%ch
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	ed                   	in     (%dx),%eax
+  805c19:	0d 80 00 00 00       	or     $0x80,%eax
+  805c1e:	00 00                	add    %al,(%rax)
+  805c20:	ed                   	in     (%dx),%eax
+  805c21:	0d 80 00 00 00       	or     $0x80,%eax
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	ed                   	in     (%dx),%eax
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	8c 0a                	mov    %cs,(%rdx)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	8c 0a                	mov    %cs,(%rdx)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	8c 0a                	mov    %cs,(%rdx)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	8c 0a                	mov    %cs,(%rdx)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	8c 0a                	mov    %cs,(%rdx)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	ed                   	in     (%dx),%eax
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	ed                   	in     (%dx),%eax
+  805cb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	ed                   	in     (%dx),%eax
+  805cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	ed                   	in     (%dx),%eax
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	ed                   	in     (%dx),%eax
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	ed                   	in     (%dx),%eax
+  805d39:	0d 80 00 00 00       	or     $0x80,%eax
+  805d3e:	00 00                	add    %al,(%rax)
+  805d40:	ed                   	in     (%dx),%eax
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	ed                   	in     (%dx),%eax
+  805d59:	0d 80 00 00 00       	or     $0x80,%eax
+  805d5e:	00 00                	add    %al,(%rax)
+  805d60:	ed                   	in     (%dx),%eax
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	ed                   	in     (%dx),%eax
+  805d71:	0d 80 00 00 00       	or     $0x80,%eax
+  805d76:	00 00                	add    %al,(%rax)
+  805d78:	f4                   	hlt
+  805d79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d7f:	00 ed                	add    %ch,%ch
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	2c 0b                	sub    $0xb,%al
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 ed                	add    %ch,%ch
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ed                   	in     (%dx),%eax
+  805da1:	0d 80 00 00 00       	or     $0x80,%eax
+  805da6:	00 00                	add    %al,(%rax)
+  805da8:	ed                   	in     (%dx),%eax
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	ed                   	in     (%dx),%eax
+  805dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dce:	00 00                	add    %al,(%rax)
+  805dd0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805dd3:	00 00                	add    %al,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 cb                	add    %cl,%bl
+  805dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dde:	00 00                	add    %al,(%rax)
+  805de0:	ed                   	in     (%dx),%eax
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	ed                   	in     (%dx),%eax
+  805df1:	0d 80 00 00 00       	or     $0x80,%eax
+  805df6:	00 00                	add    %al,(%rax)
+  805df8:	6a 0a                	push   $0xa
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 ed                	add    %ch,%ch
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	3c 0a                	cmp    $0xa,%al
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 ed                	add    %ch,%ch
+  805e21:	0d 80 00 00 00       	or     $0x80,%eax
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805e2b:	00 00                	add    %al,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 29                	add    %ch,(%rcx)
+  805e39:	0c 80                	or     $0x80,%al
+  805e3b:	00 00                	add    %al,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 ed                	add    %ch,%ch
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	1a 0b                	sbb    (%rbx),%cl
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 ed                	add    %ch,%ch
+  805e59:	0d 80 00 00 00       	or     $0x80,%eax
+  805e5e:	00 00                	add    %al,(%rax)
+  805e60:	ce                   	(bad)
+  805e61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e67:	00 ed                	add    %ch,%ch
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	ed                   	in     (%dx),%eax
+  805e71:	0d 80 00 00 00       	or     $0x80,%eax
+  805e76:	00 00                	add    %al,(%rax)
+  805e78:	f4                   	hlt
+  805e79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e7f:	00 37                	add    %dh,(%rdi)
+  805e81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 37                	add    %dh,(%rdi)
+  805e91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805eab:	00 00                	add    %al,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 d2                	add    %dl,%dl
+  805eb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eb7:	00 d2                	add    %dl,%dl
+  805eb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ebf:	00 d2                	add    %dl,%dl
+  805ec1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ec7:	00 d2                	add    %dl,%dl
+  805ec9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ecf:	00 d2                	add    %dl,%dl
+  805ed1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ed7:	00 d2                	add    %dl,%dl
+  805ed9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805edf:	00 d2                	add    %dl,%dl
+  805ee1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ee7:	00 f6                	add    %dh,%dh
+  805ee9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eef:	00 f6                	add    %dh,%dh
+  805ef1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f12:	80 00 00             	addb   $0x0,(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f1a:	80 00 00             	addb   $0x0,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 22                	add    %ah,(%rdx)
+  805f31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f37:	00 22                	add    %ah,(%rdx)
+  805f39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f3f:	00 22                	add    %ah,(%rdx)
+  805f41:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f47:	00 22                	add    %ah,(%rdx)
+  805f49:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f4f:	00 22                	add    %ah,(%rdx)
+  805f51:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f57:	00 22                	add    %ah,(%rdx)
+  805f59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fb2:	80 00 00             	addb   $0x0,(%rax)
+  805fb5:	00 00                	add    %al,(%rax)
+  805fb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 46 12             	add    %al,0x12(%rsi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 5f 12             	add    %bl,0x12(%rdi)
+  80601a:	80 00 00             	addb   $0x0,(%rax)
+  80601d:	00 00                	add    %al,(%rax)
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 5f 12             	add    %bl,0x12(%rdi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+  80602d:	00 00                	add    %al,(%rax)
+  80602f:	00 22                	add    %ah,(%rdx)
+  806031:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806037:	00 22                	add    %ah,(%rdx)
+  806039:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80603f:	00 22                	add    %ah,(%rdx)
+  806041:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806047:	00 22                	add    %ah,(%rdx)
+  806049:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80604f:	00 22                	add    %ah,(%rdx)
+  806051:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806057:	00 22                	add    %ah,(%rdx)
+  806059:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 5f 12             	add    %bl,0x12(%rdi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+  80608d:	00 00                	add    %al,(%rax)
+  80608f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806092:	80 00 00             	addb   $0x0,(%rax)
+  806095:	00 00                	add    %al,(%rax)
+  806097:	00 5f 12             	add    %bl,0x12(%rdi)
+  80609a:	80 00 00             	addb   $0x0,(%rax)
+  80609d:	00 00                	add    %al,(%rax)
+  80609f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060a2:	80 00 00             	addb   $0x0,(%rax)
+  8060a5:	00 00                	add    %al,(%rax)
+  8060a7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060aa:	80 00 00             	addb   $0x0,(%rax)
+  8060ad:	00 00                	add    %al,(%rax)
+  8060af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060b2:	80 00 00             	addb   $0x0,(%rax)
+  8060b5:	00 00                	add    %al,(%rax)
+  8060b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 46 12             	add    %al,0x12(%rsi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806100 <basefix.0>:
+  806100:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806110:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806120:	10 00 6d 6f 74 64 00 6f 70 65 6e 20 6d 6f 74 64     ..motd.open motd
+  806130:	3a 20 25 69 00 75 73 65 72 2f 74 65 73 74 66 64     : %i.user/testfd
+  806140:	73 68 61 72 69 6e 67 2e 63 00 72 65 61 64 6e 3a     sharing.c.readn:
+  806150:	20 25 69 00 72 65 61 64 20 69 6e 20 63 68 69 6c      %i.read in chil
+  806160:	64 20 73 75 63 63 65 65 64 65 64 0a 00 72 65 61     d succeeded..rea
+  806170:	64 20 69 6e 20 70 61 72 65 6e 74 20 73 75 63 63     d in parent succ
+  806180:	65 65 64 65 64 0a 00 90 67 6f 69 6e 67 20 74 6f     eeded...going to
+  806190:	20 72 65 61 64 20 69 6e 20 63 68 69 6c 64 20 28      read in child (
+  8061a0:	6d 69 67 68 74 20 70 61 67 65 20 66 61 75 6c 74     might page fault
+  8061b0:	20 69 66 20 79 6f 75 72 20 73 68 61 72 69 6e 67      if your sharing
+  8061c0:	20 69 73 20 62 75 67 67 79 29 0a 00 00 00 00 00      is buggy)......
+  8061d0:	72 65 61 64 20 69 6e 20 70 61 72 65 6e 74 20 67     read in parent g
+  8061e0:	6f 74 20 25 64 2c 20 72 65 61 64 20 69 6e 20 63     ot %d, read in c
+  8061f0:	68 69 6c 64 20 67 6f 74 20 25 64 00 00 00 00 00     hild got %d.....
+  806200:	72 65 61 64 20 69 6e 20 70 61 72 65 6e 74 20 67     read in parent g
+  806210:	6f 74 20 64 69 66 66 65 72 65 6e 74 20 62 79 74     ot different byt
+  806220:	65 73 20 66 72 6f 6d 20 72 65 61 64 20 69 6e 20     es from read in 
+  806230:	63 68 69 6c 64 00 00 00 72 65 61 64 20 69 6e 20     child...read in 
+  806240:	70 61 72 65 6e 74 20 67 6f 74 20 25 64 2c 20 74     parent got %d, t
+  806250:	68 65 6e 20 67 6f 74 20 25 64 00 3c 75 6e 6b 6e     hen got %d.<unkn
+  806260:	6f 77 6e 3e 00 0f 1f 00 5b 25 30 38 78 5d 20 75     own>....[%08x] u
+  806270:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806280:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  806290:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  8062a0:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  8062b0:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  8062c0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  8062d0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  8062e0:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  8062f0:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806300:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806310:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806320:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806330:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806340:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806350:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  806360:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  806370:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  806380:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  806390:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  8063a0:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  8063b0:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  8063c0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  8063d0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  8063e0:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  8063f0:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806400:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806410:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  806420:	e2 1b 80 00 00 00 00 00 39 22 80 00 00 00 00 00     ........9"......
+  806430:	29 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     )"......9"......
+  806440:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806450:	39 22 80 00 00 00 00 00 01 1c 80 00 00 00 00 00     9"..............
+  806460:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806470:	f5 1b 80 00 00 00 00 00 6f 1c 80 00 00 00 00 00     ........o.......
+  806480:	39 22 80 00 00 00 00 00 f5 1b 80 00 00 00 00 00     9"..............
+  806490:	3b 1c 80 00 00 00 00 00 3b 1c 80 00 00 00 00 00     ;.......;.......
+  8064a0:	3b 1c 80 00 00 00 00 00 3b 1c 80 00 00 00 00 00     ;.......;.......
+  8064b0:	3b 1c 80 00 00 00 00 00 3b 1c 80 00 00 00 00 00     ;.......;.......
+  8064c0:	3b 1c 80 00 00 00 00 00 3b 1c 80 00 00 00 00 00     ;.......;.......
+  8064d0:	3b 1c 80 00 00 00 00 00 39 22 80 00 00 00 00 00     ;.......9"......
+  8064e0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8064f0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806500:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806510:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806520:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806530:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806540:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806550:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806560:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806570:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806580:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806590:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8065a0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8065b0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8065c0:	39 22 80 00 00 00 00 00 57 21 80 00 00 00 00 00     9"......W!......
+  8065d0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8065e0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8065f0:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806600:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806610:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806620:	9d 1c 80 00 00 00 00 00 6c 1e 80 00 00 00 00 00     ........l.......
+  806630:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806640:	39 22 80 00 00 00 00 00 92 1c 80 00 00 00 00 00     9"..............
+  806650:	cc 1c 80 00 00 00 00 00 39 22 80 00 00 00 00 00     ........9"......
+  806660:	39 22 80 00 00 00 00 00 87 1c 80 00 00 00 00 00     9"..............
+  806670:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  806680:	15 20 80 00 00 00 00 00 e4 20 80 00 00 00 00 00     . ....... ......
+  806690:	39 22 80 00 00 00 00 00 39 22 80 00 00 00 00 00     9"......9"......
+  8066a0:	63 1d 80 00 00 00 00 00 39 22 80 00 00 00 00 00     c.......9"......
+  8066b0:	40 1f 80 00 00 00 00 00 39 22 80 00 00 00 00 00     @.......9"......
+  8066c0:	39 22 80 00 00 00 00 00 57 21 80 00 00 00 00 00     9"......W!......
+  8066d0:	39 22 80 00 00 00 00 00 eb 1b 80 00 00 00 00 00     9"..............
+
+00000000008066e0 <error_string>:
+	...
+  8066e8:	bd 62 80 00 00 00 00 00 cf 62 80 00 00 00 00 00     .b.......b......
+  8066f8:	df 62 80 00 00 00 00 00 f1 62 80 00 00 00 00 00     .b.......b......
+  806708:	ff 62 80 00 00 00 00 00 13 63 80 00 00 00 00 00     .b.......c......
+  806718:	28 63 80 00 00 00 00 00 3b 63 80 00 00 00 00 00     (c......;c......
+  806728:	4d 63 80 00 00 00 00 00 61 63 80 00 00 00 00 00     Mc......ac......
+  806738:	71 63 80 00 00 00 00 00 84 63 80 00 00 00 00 00     qc.......c......
+  806748:	9b 63 80 00 00 00 00 00 b1 63 80 00 00 00 00 00     .c.......c......
+  806758:	c9 63 80 00 00 00 00 00 e1 63 80 00 00 00 00 00     .c.......c......
+  806768:	ee 63 80 00 00 00 00 00 80 67 80 00 00 00 00 00     .c.......g......
+  806778:	02 64 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .d......file is 
+  806788:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806798:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8067a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8067b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8067c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8067d8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8067e8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8067f8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806808:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806818:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806828:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806838:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806848:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806858:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806868:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806878:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806888:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806898:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8068a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8068b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8068c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8068d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008068e0 <devtab>:
+  8068e0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8068f0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806900:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806910:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806920:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806930:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806940:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806950:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806960:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806970:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806980:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806990:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8069a0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  8069b0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  8069c0:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  8069d0:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  8069e0:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  8069f0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806a00:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806a10:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806a20:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806a30:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806a40:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806a50:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806a60:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
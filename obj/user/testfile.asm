@@ -0,0 +1,11152 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 7f 2d 80 00 00 	movabs $0x802d7f,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 98 49 80 00 00 	movabs $0x804998,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 0f 2a 80 00 00 	movabs $0x802a0f,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 98 49 80 00 00 	movabs $0x804998,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 0f 2a 80 00 00 	movabs $0x802a0f,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be ef 6a 80 00 00 	movabs $0x806aef,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 28 61 80 00 00 	movabs $0x806128,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 2a 61 80 00 00 	movabs $0x80612a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 2d 61 80 00 00 	movabs $0x80612d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 96 57 80 00 00 	movabs $0x805796,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 6d 5a 80 00 00 	movabs $0x805a6d,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 ac 40 80 00 00 	movabs $0x8040ac,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 75 41 80 00 00 	movabs $0x804175,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 93 3e 80 00 00 	movabs $0x803e93,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 4c 2d 80 00 00 	movabs $0x802d4c,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 61 80 00 00 	movabs $0x806140,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 4c 2d 80 00 00 	movabs $0x802d4c,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 7f 2d 80 00 00 	movabs $0x802d7f,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 4c 2d 80 00 00 	movabs $0x802d4c,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 63 80 00 00 	movabs $0x8063e0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 4c 2d 80 00 00 	movabs $0x802d4c,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 4c 2d 80 00 00 	movabs $0x802d4c,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 66 80 00 00 	movabs $0x806660,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 66 80 00 00 	movabs $0x806660,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 a4 2f 80 00 00 	movabs $0x802fa4,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 8b 0a 00 00       	call   801f8a <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <xopen>:
+const char *msg = "This is the NEW message of the day!\n\n";
+
+#define FVA ((struct Fd *)0xA000000)
+
+static int
+xopen(const char *path, int mode) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 54                	push   %r12
+  801507:	53                   	push   %rbx
+  801508:	48 83 ec 10          	sub    $0x10,%rsp
+  80150c:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  80150f:	48 89 fe             	mov    %rdi,%rsi
+  801512:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  801519:	00 00 00 
+  80151c:	48 89 df             	mov    %rbx,%rdi
+  80151f:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  801526:	00 00 00 
+  801529:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80152b:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  801532:	bf 03 00 00 00       	mov    $0x3,%edi
+  801537:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  80153e:	00 00 00 
+  801541:	ff d0                	call   *%rax
+  801543:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  801545:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80154c:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  80154d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801553:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801558:	48 89 da             	mov    %rbx,%rdx
+  80155b:	be 01 00 00 00       	mov    $0x1,%esi
+  801560:	48 b8 7a 39 80 00 00 	movabs $0x80397a,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  80156c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801571:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  801575:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80157a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80157f:	48 b8 15 39 80 00 00 	movabs $0x803915,%rax
+  801586:	00 00 00 
+  801589:	ff d0                	call   *%rax
+}
+  80158b:	48 83 c4 10          	add    $0x10,%rsp
+  80158f:	5b                   	pop    %rbx
+  801590:	41 5c                	pop    %r12
+  801592:	5d                   	pop    %rbp
+  801593:	c3                   	ret
+
+0000000000801594 <umain>:
+
+void
+umain(int argc, char **argv) {
+  801594:	55                   	push   %rbp
+  801595:	48 89 e5             	mov    %rsp,%rbp
+  801598:	41 55                	push   %r13
+  80159a:	41 54                	push   %r12
+  80159c:	53                   	push   %rbx
+  80159d:	48 81 ec b8 02 00 00 	sub    $0x2b8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8015a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8015a9:	48 bf 82 66 80 00 00 	movabs $0x806682,%rdi
+  8015b0:	00 00 00 
+  8015b3:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015ba:	00 00 00 
+  8015bd:	ff d0                	call   *%rax
+  8015bf:	48 63 c8             	movslq %eax,%rcx
+  8015c2:	48 85 c9             	test   %rcx,%rcx
+  8015c5:	0f 89 70 05 00 00    	jns    801b3b <umain+0x5a7>
+  8015cb:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8015cf:	0f 85 3b 05 00 00    	jne    801b10 <umain+0x57c>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8015da:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  8015e1:	00 00 00 
+  8015e4:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8015eb:	00 00 00 
+  8015ee:	ff d0                	call   *%rax
+  8015f0:	48 63 c8             	movslq %eax,%rcx
+  8015f3:	48 85 c9             	test   %rcx,%rcx
+  8015f6:	0f 88 69 05 00 00    	js     801b65 <umain+0x5d1>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8015fc:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  801603:	66 
+  801604:	0f 85 86 05 00 00    	jne    801b90 <umain+0x5fc>
+  80160a:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  801611:	00 
+  801612:	0f 85 78 05 00 00    	jne    801b90 <umain+0x5fc>
+  801618:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  80161f:	00 
+  801620:	0f 85 6a 05 00 00    	jne    801b90 <umain+0x5fc>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  801626:	48 bf da 66 80 00 00 	movabs $0x8066da,%rdi
+  80162d:	00 00 00 
+  801630:	b8 00 00 00 00       	mov    $0x0,%eax
+  801635:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  80163c:	00 00 00 
+  80163f:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  801641:	48 8d b5 30 ff ff ff 	lea    -0xd0(%rbp),%rsi
+  801648:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80164d:	48 a1 88 80 80 00 00 	movabs 0x808088,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+  801659:	48 63 c8             	movslq %eax,%rcx
+  80165c:	48 85 c9             	test   %rcx,%rcx
+  80165f:	0f 88 55 05 00 00    	js     801bba <umain+0x626>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  801665:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  80166c:	00 00 00 
+  80166f:	48 8b 38             	mov    (%rax),%rdi
+  801672:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+  80167e:	48 89 c2             	mov    %rax,%rdx
+  801681:	48 63 45 b0          	movslq -0x50(%rbp),%rax
+  801685:	48 39 c2             	cmp    %rax,%rdx
+  801688:	0f 85 57 05 00 00    	jne    801be5 <umain+0x651>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  80168e:	48 bf fd 66 80 00 00 	movabs $0x8066fd,%rdi
+  801695:	00 00 00 
+  801698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80169d:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  8016a4:	00 00 00 
+  8016a7:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  8016a9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8016ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8016b3:	48 8d bd 30 fd ff ff 	lea    -0x2d0(%rbp),%rdi
+  8016ba:	48 b8 7f 2d 80 00 00 	movabs $0x802d7f,%rax
+  8016c1:	00 00 00 
+  8016c4:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8016c6:	ba 00 02 00 00       	mov    $0x200,%edx
+  8016cb:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8016d2:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8016d7:	48 a1 70 80 80 00 00 	movabs 0x808070,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+  8016e3:	48 85 c0             	test   %rax,%rax
+  8016e6:	0f 88 44 05 00 00    	js     801c30 <umain+0x69c>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8016ec:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  8016f3:	00 00 00 
+  8016f6:	48 8b 30             	mov    (%rax),%rsi
+  8016f9:	48 8d bd 30 fd ff ff 	lea    -0x2d0(%rbp),%rdi
+  801700:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	0f 85 4a 05 00 00    	jne    801c5e <umain+0x6ca>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  801714:	48 bf 3d 67 80 00 00 	movabs $0x80673d,%rdi
+  80171b:	00 00 00 
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  80172a:	00 00 00 
+  80172d:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  80172f:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  801734:	48 a1 80 80 80 00 00 	movabs 0x808080,%rax
+  80173b:	00 00 00 
+  80173e:	ff d0                	call   *%rax
+  801740:	48 63 c8             	movslq %eax,%rcx
+  801743:	48 85 c9             	test   %rcx,%rcx
+  801746:	0f 88 3c 05 00 00    	js     801c88 <umain+0x6f4>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  80174c:	48 bf 60 67 80 00 00 	movabs $0x806760,%rdi
+  801753:	00 00 00 
+  801756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175b:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  801762:	00 00 00 
+  801765:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  801767:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  80176e:	0a 
+  80176f:	48 8b 14 25 08 00 00 	mov    0xa000008,%rdx
+  801776:	0a 
+  801777:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80177b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  80177f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801784:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  801789:	bf 00 00 00 00       	mov    $0x0,%edi
+  80178e:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  801795:	00 00 00 
+  801798:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  80179a:	ba 00 02 00 00       	mov    $0x200,%edx
+  80179f:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8017a6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8017aa:	48 a1 70 80 80 00 00 	movabs 0x808070,%rax
+  8017b1:	00 00 00 
+  8017b4:	ff d0                	call   *%rax
+  8017b6:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  8017ba:	0f 85 f3 04 00 00    	jne    801cb3 <umain+0x71f>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  8017c0:	48 bf 74 67 80 00 00 	movabs $0x806774,%rdi
+  8017c7:	00 00 00 
+  8017ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cf:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  8017d6:	00 00 00 
+  8017d9:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  8017db:	be 02 01 00 00       	mov    $0x102,%esi
+  8017e0:	48 bf 8a 67 80 00 00 	movabs $0x80678a,%rdi
+  8017e7:	00 00 00 
+  8017ea:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8017f1:	00 00 00 
+  8017f4:	ff d0                	call   *%rax
+  8017f6:	48 63 c8             	movslq %eax,%rcx
+  8017f9:	48 85 c9             	test   %rcx,%rcx
+  8017fc:	0f 88 df 04 00 00    	js     801ce1 <umain+0x74d>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  801802:	48 b8 78 80 80 00 00 	movabs $0x808078,%rax
+  801809:	00 00 00 
+  80180c:	48 8b 18             	mov    (%rax),%rbx
+  80180f:	49 bc 38 80 80 00 00 	movabs $0x808038,%r12
+  801816:	00 00 00 
+  801819:	49 8b 3c 24          	mov    (%r12),%rdi
+  80181d:	49 bd 9f 2a 80 00 00 	movabs $0x802a9f,%r13
+  801824:	00 00 00 
+  801827:	41 ff d5             	call   *%r13
+  80182a:	48 89 c2             	mov    %rax,%rdx
+  80182d:	49 8b 34 24          	mov    (%r12),%rsi
+  801831:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  801836:	ff d3                	call   *%rbx
+  801838:	48 89 c3             	mov    %rax,%rbx
+  80183b:	49 8b 3c 24          	mov    (%r12),%rdi
+  80183f:	41 ff d5             	call   *%r13
+  801842:	48 39 c3             	cmp    %rax,%rbx
+  801845:	0f 85 c1 04 00 00    	jne    801d0c <umain+0x778>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  80184b:	48 bf be 67 80 00 00 	movabs $0x8067be,%rdi
+  801852:	00 00 00 
+  801855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185a:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  801861:	00 00 00 
+  801864:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  801866:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  80186d:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  801871:	ba 00 02 00 00       	mov    $0x200,%edx
+  801876:	be 00 00 00 00       	mov    $0x0,%esi
+  80187b:	48 8d bd 30 fd ff ff 	lea    -0x2d0(%rbp),%rdi
+  801882:	48 b8 7f 2d 80 00 00 	movabs $0x802d7f,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  80188e:	ba 00 02 00 00       	mov    $0x200,%edx
+  801893:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  80189a:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80189f:	48 a1 70 80 80 00 00 	movabs 0x808070,%rax
+  8018a6:	00 00 00 
+  8018a9:	ff d0                	call   *%rax
+  8018ab:	48 89 c3             	mov    %rax,%rbx
+  8018ae:	48 85 c0             	test   %rax,%rax
+  8018b1:	0f 88 83 04 00 00    	js     801d3a <umain+0x7a6>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  8018b7:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  8018be:	00 00 00 
+  8018c1:	48 8b 38             	mov    (%rax),%rdi
+  8018c4:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	48 39 d8             	cmp    %rbx,%rax
+  8018d3:	0f 85 8f 04 00 00    	jne    801d68 <umain+0x7d4>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  8018d9:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  8018e0:	00 00 00 
+  8018e3:	48 8b 30             	mov    (%rax),%rsi
+  8018e6:	48 8d bd 30 fd ff ff 	lea    -0x2d0(%rbp),%rdi
+  8018ed:	48 b8 9f 2b 80 00 00 	movabs $0x802b9f,%rax
+  8018f4:	00 00 00 
+  8018f7:	ff d0                	call   *%rax
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	0f 85 95 04 00 00    	jne    801d96 <umain+0x802>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  801901:	48 bf 90 69 80 00 00 	movabs $0x806990,%rdi
+  801908:	00 00 00 
+  80190b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801910:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  801917:	00 00 00 
+  80191a:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80191c:	be 00 00 00 00       	mov    $0x0,%esi
+  801921:	48 bf 82 66 80 00 00 	movabs $0x806682,%rdi
+  801928:	00 00 00 
+  80192b:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  801932:	00 00 00 
+  801935:	ff d0                	call   *%rax
+  801937:	48 63 c8             	movslq %eax,%rcx
+  80193a:	48 85 c9             	test   %rcx,%rcx
+  80193d:	0f 89 a8 04 00 00    	jns    801deb <umain+0x857>
+  801943:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  801947:	0f 85 73 04 00 00    	jne    801dc0 <umain+0x82c>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  80194d:	be 00 00 00 00       	mov    $0x0,%esi
+  801952:	48 bf b8 66 80 00 00 	movabs $0x8066b8,%rdi
+  801959:	00 00 00 
+  80195c:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  801963:	00 00 00 
+  801966:	ff d0                	call   *%rax
+  801968:	48 98                	cltq
+  80196a:	48 85 c0             	test   %rax,%rax
+  80196d:	0f 88 a2 04 00 00    	js     801e15 <umain+0x881>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  801973:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  801979:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  80197d:	83 38 66             	cmpl   $0x66,(%rax)
+  801980:	0f 85 bd 04 00 00    	jne    801e43 <umain+0x8af>
+  801986:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  80198a:	0f 85 b3 04 00 00    	jne    801e43 <umain+0x8af>
+  801990:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  801994:	0f 85 a9 04 00 00    	jne    801e43 <umain+0x8af>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  80199a:	48 bf e0 66 80 00 00 	movabs $0x8066e0,%rdi
+  8019a1:	00 00 00 
+  8019a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a9:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  8019b0:	00 00 00 
+  8019b3:	ff d2                	call   *%rdx
+
+    /* Try files with indirect blocks */
+    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+  8019b5:	be 01 01 00 00       	mov    $0x101,%esi
+  8019ba:	48 bf ed 67 80 00 00 	movabs $0x8067ed,%rdi
+  8019c1:	00 00 00 
+  8019c4:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  8019cb:	00 00 00 
+  8019ce:	ff d0                	call   *%rax
+  8019d0:	41 89 c4             	mov    %eax,%r12d
+  8019d3:	48 63 c8             	movslq %eax,%rcx
+  8019d6:	48 85 c9             	test   %rcx,%rcx
+  8019d9:	0f 88 8e 04 00 00    	js     801e6d <umain+0x8d9>
+        panic("creat /big: %ld", (long)f);
+    memset(buf, 0, sizeof(buf));
+  8019df:	ba 00 02 00 00       	mov    $0x200,%edx
+  8019e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e9:	48 8d bd 30 fd ff ff 	lea    -0x2d0(%rbp),%rdi
+  8019f0:	48 b8 7f 2d 80 00 00 	movabs $0x802d7f,%rax
+  8019f7:	00 00 00 
+  8019fa:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  8019fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  801a01:	49 bd c2 3f 80 00 00 	movabs $0x803fc2,%r13
+  801a08:	00 00 00 
+        *(int *)buf = i;
+  801a0b:	89 9d 30 fd ff ff    	mov    %ebx,-0x2d0(%rbp)
+        if ((r = write(f, buf, sizeof(buf))) < 0)
+  801a11:	ba 00 02 00 00       	mov    $0x200,%edx
+  801a16:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  801a1d:	44 89 e7             	mov    %r12d,%edi
+  801a20:	41 ff d5             	call   *%r13
+  801a23:	48 85 c0             	test   %rax,%rax
+  801a26:	0f 88 6c 04 00 00    	js     801e98 <umain+0x904>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  801a2c:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  801a33:	48 89 c3             	mov    %rax,%rbx
+  801a36:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  801a3c:	75 cd                	jne    801a0b <umain+0x477>
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+    }
+    close(f);
+  801a3e:	44 89 e7             	mov    %r12d,%edi
+  801a41:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+
+    if ((f = open("/big", O_RDONLY)) < 0)
+  801a4d:	be 00 00 00 00       	mov    $0x0,%esi
+  801a52:	48 bf ed 67 80 00 00 	movabs $0x8067ed,%rdi
+  801a59:	00 00 00 
+  801a5c:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  801a63:	00 00 00 
+  801a66:	ff d0                	call   *%rax
+  801a68:	41 89 c4             	mov    %eax,%r12d
+  801a6b:	48 63 c8             	movslq %eax,%rcx
+  801a6e:	48 85 c9             	test   %rcx,%rcx
+  801a71:	0f 88 52 04 00 00    	js     801ec9 <umain+0x935>
+        panic("open /big: %ld", (long)f);
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  801a77:	bb 00 00 00 00       	mov    $0x0,%ebx
+        *(int *)buf = i;
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  801a7c:	49 bd 51 3f 80 00 00 	movabs $0x803f51,%r13
+  801a83:	00 00 00 
+        *(int *)buf = i;
+  801a86:	89 9d 30 fd ff ff    	mov    %ebx,-0x2d0(%rbp)
+        if ((r = readn(f, buf, sizeof(buf))) < 0)
+  801a8c:	ba 00 02 00 00       	mov    $0x200,%edx
+  801a91:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  801a98:	44 89 e7             	mov    %r12d,%edi
+  801a9b:	41 ff d5             	call   *%r13
+  801a9e:	48 85 c0             	test   %rax,%rax
+  801aa1:	0f 88 4d 04 00 00    	js     801ef4 <umain+0x960>
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+        if (r != sizeof(buf))
+  801aa7:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  801aad:	0f 85 72 04 00 00    	jne    801f25 <umain+0x991>
+            panic("read /big from %ld returned %ld < %d bytes",
+                  (long)i, (long)r, (uint32_t)sizeof(buf));
+        if (*(int *)buf != i)
+  801ab3:	44 8b 85 30 fd ff ff 	mov    -0x2d0(%rbp),%r8d
+  801aba:	49 63 c0             	movslq %r8d,%rax
+  801abd:	48 39 d8             	cmp    %rbx,%rax
+  801ac0:	0f 85 96 04 00 00    	jne    801f5c <umain+0x9c8>
+    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
+  801ac6:	48 8d 83 00 02 00 00 	lea    0x200(%rbx),%rax
+  801acd:	48 89 c3             	mov    %rax,%rbx
+  801ad0:	48 3d 00 e0 01 00    	cmp    $0x1e000,%rax
+  801ad6:	75 ae                	jne    801a86 <umain+0x4f2>
+            panic("read /big from %ld returned bad data %d",
+                  (long)i, *(int *)buf);
+    }
+    close(f);
+  801ad8:	44 89 e7             	mov    %r12d,%edi
+  801adb:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  801ae2:	00 00 00 
+  801ae5:	ff d0                	call   *%rax
+    cprintf("large file is good\n");
+  801ae7:	48 bf 38 68 80 00 00 	movabs $0x806838,%rdi
+  801aee:	00 00 00 
+  801af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af6:	48 ba a6 21 80 00 00 	movabs $0x8021a6,%rdx
+  801afd:	00 00 00 
+  801b00:	ff d2                	call   *%rdx
+}
+  801b02:	48 81 c4 b8 02 00 00 	add    $0x2b8,%rsp
+  801b09:	5b                   	pop    %rbx
+  801b0a:	41 5c                	pop    %r12
+  801b0c:	41 5d                	pop    %r13
+  801b0e:	5d                   	pop    %rbp
+  801b0f:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  801b10:	48 ba 8d 66 80 00 00 	movabs $0x80668d,%rdx
+  801b17:	00 00 00 
+  801b1a:	be 1f 00 00 00       	mov    $0x1f,%esi
+  801b1f:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801b26:	00 00 00 
+  801b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2e:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801b35:	00 00 00 
+  801b38:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  801b3b:	48 ba 50 68 80 00 00 	movabs $0x806850,%rdx
+  801b42:	00 00 00 
+  801b45:	be 21 00 00 00       	mov    $0x21,%esi
+  801b4a:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801b51:	00 00 00 
+  801b54:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b59:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801b60:	00 00 00 
+  801b63:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  801b65:	48 ba c1 66 80 00 00 	movabs $0x8066c1,%rdx
+  801b6c:	00 00 00 
+  801b6f:	be 24 00 00 00       	mov    $0x24,%esi
+  801b74:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801b7b:	00 00 00 
+  801b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b83:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801b8a:	00 00 00 
+  801b8d:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  801b90:	48 ba 78 68 80 00 00 	movabs $0x806878,%rdx
+  801b97:	00 00 00 
+  801b9a:	be 26 00 00 00       	mov    $0x26,%esi
+  801b9f:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801ba6:	00 00 00 
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801bb5:	00 00 00 
+  801bb8:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  801bba:	48 ba ee 66 80 00 00 	movabs $0x8066ee,%rdx
+  801bc1:	00 00 00 
+  801bc4:	be 2a 00 00 00       	mov    $0x2a,%esi
+  801bc9:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801bd0:	00 00 00 
+  801bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd8:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801bdf:	00 00 00 
+  801be2:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  801be5:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  801bec:	00 00 00 
+  801bef:	48 8b 38             	mov    (%rax),%rdi
+  801bf2:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  801bf9:	00 00 00 
+  801bfc:	ff d0                	call   *%rax
+  801bfe:	49 89 c0             	mov    %rax,%r8
+  801c01:	48 63 4d b0          	movslq -0x50(%rbp),%rcx
+  801c05:	48 ba a8 68 80 00 00 	movabs $0x8068a8,%rdx
+  801c0c:	00 00 00 
+  801c0f:	be 2c 00 00 00       	mov    $0x2c,%esi
+  801c14:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801c1b:	00 00 00 
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c23:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  801c2a:	00 00 00 
+  801c2d:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  801c30:	48 89 c1             	mov    %rax,%rcx
+  801c33:	48 ba 10 67 80 00 00 	movabs $0x806710,%rdx
+  801c3a:	00 00 00 
+  801c3d:	be 31 00 00 00       	mov    $0x31,%esi
+  801c42:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801c49:	00 00 00 
+  801c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c51:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801c58:	00 00 00 
+  801c5b:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  801c5e:	48 ba 1f 67 80 00 00 	movabs $0x80671f,%rdx
+  801c65:	00 00 00 
+  801c68:	be 33 00 00 00       	mov    $0x33,%esi
+  801c6d:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801c74:	00 00 00 
+  801c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7c:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801c83:	00 00 00 
+  801c86:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  801c88:	48 ba 50 67 80 00 00 	movabs $0x806750,%rdx
+  801c8f:	00 00 00 
+  801c92:	be 37 00 00 00       	mov    $0x37,%esi
+  801c97:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801c9e:	00 00 00 
+  801ca1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca6:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801cad:	00 00 00 
+  801cb0:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  801cb3:	48 89 c1             	mov    %rax,%rcx
+  801cb6:	48 ba d0 68 80 00 00 	movabs $0x8068d0,%rdx
+  801cbd:	00 00 00 
+  801cc0:	be 42 00 00 00       	mov    $0x42,%esi
+  801cc5:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801ccc:	00 00 00 
+  801ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd4:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801cdb:	00 00 00 
+  801cde:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  801ce1:	48 ba 94 67 80 00 00 	movabs $0x806794,%rdx
+  801ce8:	00 00 00 
+  801ceb:	be 47 00 00 00       	mov    $0x47,%esi
+  801cf0:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801cf7:	00 00 00 
+  801cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cff:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801d06:	00 00 00 
+  801d09:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  801d0c:	48 89 d9             	mov    %rbx,%rcx
+  801d0f:	48 ba ae 67 80 00 00 	movabs $0x8067ae,%rdx
+  801d16:	00 00 00 
+  801d19:	be 4a 00 00 00       	mov    $0x4a,%esi
+  801d1e:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801d25:	00 00 00 
+  801d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2d:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801d34:	00 00 00 
+  801d37:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  801d3a:	48 89 c1             	mov    %rax,%rcx
+  801d3d:	48 ba 08 69 80 00 00 	movabs $0x806908,%rdx
+  801d44:	00 00 00 
+  801d47:	be 50 00 00 00       	mov    $0x50,%esi
+  801d4c:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801d53:	00 00 00 
+  801d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d5b:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801d62:	00 00 00 
+  801d65:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  801d68:	48 89 d9             	mov    %rbx,%rcx
+  801d6b:	48 ba 28 69 80 00 00 	movabs $0x806928,%rdx
+  801d72:	00 00 00 
+  801d75:	be 52 00 00 00       	mov    $0x52,%esi
+  801d7a:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801d81:	00 00 00 
+  801d84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d89:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801d90:	00 00 00 
+  801d93:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  801d96:	48 ba 60 69 80 00 00 	movabs $0x806960,%rdx
+  801d9d:	00 00 00 
+  801da0:	be 54 00 00 00       	mov    $0x54,%esi
+  801da5:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801dac:	00 00 00 
+  801daf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db4:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801dbb:	00 00 00 
+  801dbe:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  801dc0:	48 ba 93 66 80 00 00 	movabs $0x806693,%rdx
+  801dc7:	00 00 00 
+  801dca:	be 59 00 00 00       	mov    $0x59,%esi
+  801dcf:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801dd6:	00 00 00 
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dde:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801de5:	00 00 00 
+  801de8:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  801deb:	48 ba d2 67 80 00 00 	movabs $0x8067d2,%rdx
+  801df2:	00 00 00 
+  801df5:	be 5b 00 00 00       	mov    $0x5b,%esi
+  801dfa:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801e01:	00 00 00 
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e09:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801e10:	00 00 00 
+  801e13:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  801e15:	48 89 c1             	mov    %rax,%rcx
+  801e18:	48 ba c7 66 80 00 00 	movabs $0x8066c7,%rdx
+  801e1f:	00 00 00 
+  801e22:	be 5e 00 00 00       	mov    $0x5e,%esi
+  801e27:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801e2e:	00 00 00 
+  801e31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e36:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801e3d:	00 00 00 
+  801e40:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  801e43:	48 ba b8 69 80 00 00 	movabs $0x8069b8,%rdx
+  801e4a:	00 00 00 
+  801e4d:	be 61 00 00 00       	mov    $0x61,%esi
+  801e52:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801e59:	00 00 00 
+  801e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e61:	48 b9 56 20 80 00 00 	movabs $0x802056,%rcx
+  801e68:	00 00 00 
+  801e6b:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  801e6d:	48 ba f2 67 80 00 00 	movabs $0x8067f2,%rdx
+  801e74:	00 00 00 
+  801e77:	be 66 00 00 00       	mov    $0x66,%esi
+  801e7c:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801e83:	00 00 00 
+  801e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8b:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801e92:	00 00 00 
+  801e95:	41 ff d0             	call   *%r8
+            panic("write /big@%ld: %ld", (long)i, (long)r);
+  801e98:	49 89 c0             	mov    %rax,%r8
+  801e9b:	48 89 d9             	mov    %rbx,%rcx
+  801e9e:	48 ba 02 68 80 00 00 	movabs $0x806802,%rdx
+  801ea5:	00 00 00 
+  801ea8:	be 6b 00 00 00       	mov    $0x6b,%esi
+  801ead:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801eb4:	00 00 00 
+  801eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebc:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  801ec3:	00 00 00 
+  801ec6:	41 ff d1             	call   *%r9
+        panic("open /big: %ld", (long)f);
+  801ec9:	48 ba 16 68 80 00 00 	movabs $0x806816,%rdx
+  801ed0:	00 00 00 
+  801ed3:	be 70 00 00 00       	mov    $0x70,%esi
+  801ed8:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801edf:	00 00 00 
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee7:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  801eee:	00 00 00 
+  801ef1:	41 ff d0             	call   *%r8
+            panic("read /big@%ld: %ld", (long)i, (long)r);
+  801ef4:	49 89 c0             	mov    %rax,%r8
+  801ef7:	48 89 d9             	mov    %rbx,%rcx
+  801efa:	48 ba 25 68 80 00 00 	movabs $0x806825,%rdx
+  801f01:	00 00 00 
+  801f04:	be 74 00 00 00       	mov    $0x74,%esi
+  801f09:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801f10:	00 00 00 
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f18:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  801f1f:	00 00 00 
+  801f22:	41 ff d1             	call   *%r9
+            panic("read /big from %ld returned %ld < %d bytes",
+  801f25:	41 b9 00 02 00 00    	mov    $0x200,%r9d
+  801f2b:	49 89 c0             	mov    %rax,%r8
+  801f2e:	48 89 d9             	mov    %rbx,%rcx
+  801f31:	48 ba e0 69 80 00 00 	movabs $0x8069e0,%rdx
+  801f38:	00 00 00 
+  801f3b:	be 76 00 00 00       	mov    $0x76,%esi
+  801f40:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801f47:	00 00 00 
+  801f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4f:	49 ba 56 20 80 00 00 	movabs $0x802056,%r10
+  801f56:	00 00 00 
+  801f59:	41 ff d2             	call   *%r10
+            panic("read /big from %ld returned bad data %d",
+  801f5c:	48 89 d9             	mov    %rbx,%rcx
+  801f5f:	48 ba 10 6a 80 00 00 	movabs $0x806a10,%rdx
+  801f66:	00 00 00 
+  801f69:	be 79 00 00 00       	mov    $0x79,%esi
+  801f6e:	48 bf a8 66 80 00 00 	movabs $0x8066a8,%rdi
+  801f75:	00 00 00 
+  801f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7d:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  801f84:	00 00 00 
+  801f87:	41 ff d1             	call   *%r9
+
+0000000000801f8a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801f8a:	55                   	push   %rbp
+  801f8b:	48 89 e5             	mov    %rsp,%rbp
+  801f8e:	41 56                	push   %r14
+  801f90:	41 55                	push   %r13
+  801f92:	41 54                	push   %r12
+  801f94:	53                   	push   %rbx
+  801f95:	41 89 fd             	mov    %edi,%r13d
+  801f98:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801f9b:	48 ba 18 81 80 00 00 	movabs $0x808118,%rdx
+  801fa2:	00 00 00 
+  801fa5:	48 b8 18 81 80 00 00 	movabs $0x808118,%rax
+  801fac:	00 00 00 
+  801faf:	48 39 c2             	cmp    %rax,%rdx
+  801fb2:	73 17                	jae    801fcb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801fb4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801fb7:	49 89 c4             	mov    %rax,%r12
+  801fba:	48 83 c3 08          	add    $0x8,%rbx
+  801fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc3:	ff 53 f8             	call   *-0x8(%rbx)
+  801fc6:	4c 39 e3             	cmp    %r12,%rbx
+  801fc9:	72 ef                	jb     801fba <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801fcb:	48 b8 6a 31 80 00 00 	movabs $0x80316a,%rax
+  801fd2:	00 00 00 
+  801fd5:	ff d0                	call   *%rax
+  801fd7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801fdc:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801fe3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801fea:	00 00 00 
+  801fed:	48 01 d0             	add    %rdx,%rax
+  801ff0:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  801ff7:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801ffa:	45 85 ed             	test   %r13d,%r13d
+  801ffd:	7e 0d                	jle    80200c <libmain+0x82>
+  801fff:	49 8b 06             	mov    (%r14),%rax
+  802002:	48 a3 40 80 80 00 00 	movabs %rax,0x808040
+  802009:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80200c:	4c 89 f6             	mov    %r14,%rsi
+  80200f:	44 89 ef             	mov    %r13d,%edi
+  802012:	48 b8 94 15 80 00 00 	movabs $0x801594,%rax
+  802019:	00 00 00 
+  80201c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80201e:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+#endif
+}
+  80202a:	5b                   	pop    %rbx
+  80202b:	41 5c                	pop    %r12
+  80202d:	41 5d                	pop    %r13
+  80202f:	41 5e                	pop    %r14
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+
+0000000000802033 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  802037:	48 b8 48 3d 80 00 00 	movabs $0x803d48,%rax
+  80203e:	00 00 00 
+  802041:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  802043:	bf 00 00 00 00       	mov    $0x0,%edi
+  802048:	48 b8 f9 30 80 00 00 	movabs $0x8030f9,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+}
+  802054:	5d                   	pop    %rbp
+  802055:	c3                   	ret
+
+0000000000802056 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  802056:	55                   	push   %rbp
+  802057:	48 89 e5             	mov    %rsp,%rbp
+  80205a:	41 56                	push   %r14
+  80205c:	41 55                	push   %r13
+  80205e:	41 54                	push   %r12
+  802060:	53                   	push   %rbx
+  802061:	48 83 ec 50          	sub    $0x50,%rsp
+  802065:	49 89 fc             	mov    %rdi,%r12
+  802068:	41 89 f5             	mov    %esi,%r13d
+  80206b:	48 89 d3             	mov    %rdx,%rbx
+  80206e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802072:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  802076:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80207a:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  802081:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802085:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  802089:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80208d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  802091:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  802098:	00 00 00 
+  80209b:	4c 8b 30             	mov    (%rax),%r14
+  80209e:	48 b8 6a 31 80 00 00 	movabs $0x80316a,%rax
+  8020a5:	00 00 00 
+  8020a8:	ff d0                	call   *%rax
+  8020aa:	89 c6                	mov    %eax,%esi
+  8020ac:	45 89 e8             	mov    %r13d,%r8d
+  8020af:	4c 89 e1             	mov    %r12,%rcx
+  8020b2:	4c 89 f2             	mov    %r14,%rdx
+  8020b5:	48 bf 68 6a 80 00 00 	movabs $0x806a68,%rdi
+  8020bc:	00 00 00 
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c4:	49 bc a6 21 80 00 00 	movabs $0x8021a6,%r12
+  8020cb:	00 00 00 
+  8020ce:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8020d1:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8020d5:	48 89 df             	mov    %rbx,%rdi
+  8020d8:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  8020df:	00 00 00 
+  8020e2:	ff d0                	call   *%rax
+    cprintf("\n");
+  8020e4:	48 bf 4e 67 80 00 00 	movabs $0x80674e,%rdi
+  8020eb:	00 00 00 
+  8020ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f3:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8020f6:	cc                   	int3
+  8020f7:	eb fd                	jmp    8020f6 <_panic+0xa0>
+
+00000000008020f9 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	53                   	push   %rbx
+  8020fe:	48 83 ec 08          	sub    $0x8,%rsp
+  802102:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  802105:	8b 06                	mov    (%rsi),%eax
+  802107:	8d 50 01             	lea    0x1(%rax),%edx
+  80210a:	89 16                	mov    %edx,(%rsi)
+  80210c:	48 98                	cltq
+  80210e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  802113:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  802119:	74 0a                	je     802125 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80211b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80211f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802123:	c9                   	leave
+  802124:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  802125:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  802129:	be ff 00 00 00       	mov    $0xff,%esi
+  80212e:	48 b8 5a 30 80 00 00 	movabs $0x80305a,%rax
+  802135:	00 00 00 
+  802138:	ff d0                	call   *%rax
+        state->offset = 0;
+  80213a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  802140:	eb d9                	jmp    80211b <putch+0x22>
+
+0000000000802142 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  802142:	55                   	push   %rbp
+  802143:	48 89 e5             	mov    %rsp,%rbp
+  802146:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80214d:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  802150:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  802157:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80215c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802161:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  802164:	48 89 f1             	mov    %rsi,%rcx
+  802167:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80216e:	48 bf f9 20 80 00 00 	movabs $0x8020f9,%rdi
+  802175:	00 00 00 
+  802178:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  802184:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80218b:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  802192:	48 b8 5a 30 80 00 00 	movabs $0x80305a,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80219e:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8021a4:	c9                   	leave
+  8021a5:	c3                   	ret
+
+00000000008021a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8021a6:	55                   	push   %rbp
+  8021a7:	48 89 e5             	mov    %rsp,%rbp
+  8021aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8021ae:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8021b2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8021b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8021be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8021c2:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8021c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8021cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8021d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8021d9:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8021dd:	48 b8 42 21 80 00 00 	movabs $0x802142,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8021e9:	c9                   	leave
+  8021ea:	c3                   	ret
+
+00000000008021eb <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8021eb:	55                   	push   %rbp
+  8021ec:	48 89 e5             	mov    %rsp,%rbp
+  8021ef:	41 57                	push   %r15
+  8021f1:	41 56                	push   %r14
+  8021f3:	41 55                	push   %r13
+  8021f5:	41 54                	push   %r12
+  8021f7:	53                   	push   %rbx
+  8021f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021fc:	49 89 fc             	mov    %rdi,%r12
+  8021ff:	49 89 f5             	mov    %rsi,%r13
+  802202:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802206:	8b 45 10             	mov    0x10(%rbp),%eax
+  802209:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80220c:	41 89 cf             	mov    %ecx,%r15d
+  80220f:	4c 39 fa             	cmp    %r15,%rdx
+  802212:	73 5b                	jae    80226f <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  802214:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  802218:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80221c:	85 db                	test   %ebx,%ebx
+  80221e:	7e 0e                	jle    80222e <print_num+0x43>
+            putch(padc, put_arg);
+  802220:	4c 89 ee             	mov    %r13,%rsi
+  802223:	44 89 f7             	mov    %r14d,%edi
+  802226:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  802229:	83 eb 01             	sub    $0x1,%ebx
+  80222c:	75 f2                	jne    802220 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80222e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  802232:	48 b9 9c 6a 80 00 00 	movabs $0x806a9c,%rcx
+  802239:	00 00 00 
+  80223c:	48 b8 8b 6a 80 00 00 	movabs $0x806a8b,%rax
+  802243:	00 00 00 
+  802246:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80224a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80224e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802253:	49 f7 f7             	div    %r15
+  802256:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80225a:	4c 89 ee             	mov    %r13,%rsi
+  80225d:	41 ff d4             	call   *%r12
+}
+  802260:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802264:	5b                   	pop    %rbx
+  802265:	41 5c                	pop    %r12
+  802267:	41 5d                	pop    %r13
+  802269:	41 5e                	pop    %r14
+  80226b:	41 5f                	pop    %r15
+  80226d:	5d                   	pop    %rbp
+  80226e:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80226f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802273:	ba 00 00 00 00       	mov    $0x0,%edx
+  802278:	49 f7 f7             	div    %r15
+  80227b:	48 83 ec 08          	sub    $0x8,%rsp
+  80227f:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  802283:	52                   	push   %rdx
+  802284:	45 0f be c9          	movsbl %r9b,%r9d
+  802288:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80228c:	48 89 c2             	mov    %rax,%rdx
+  80228f:	48 b8 eb 21 80 00 00 	movabs $0x8021eb,%rax
+  802296:	00 00 00 
+  802299:	ff d0                	call   *%rax
+  80229b:	48 83 c4 10          	add    $0x10,%rsp
+  80229f:	eb 8d                	jmp    80222e <print_num+0x43>
+
+00000000008022a1 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8022a1:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8022a5:	48 8b 06             	mov    (%rsi),%rax
+  8022a8:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8022ac:	73 0a                	jae    8022b8 <sprintputch+0x17>
+        *state->start++ = ch;
+  8022ae:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8022b2:	48 89 16             	mov    %rdx,(%rsi)
+  8022b5:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8022b8:	c3                   	ret
+
+00000000008022b9 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8022b9:	55                   	push   %rbp
+  8022ba:	48 89 e5             	mov    %rsp,%rbp
+  8022bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8022c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8022c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8022c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8022cd:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8022e4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022e8:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+}
+  8022f4:	c9                   	leave
+  8022f5:	c3                   	ret
+
+00000000008022f6 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8022f6:	55                   	push   %rbp
+  8022f7:	48 89 e5             	mov    %rsp,%rbp
+  8022fa:	41 57                	push   %r15
+  8022fc:	41 56                	push   %r14
+  8022fe:	41 55                	push   %r13
+  802300:	41 54                	push   %r12
+  802302:	53                   	push   %rbx
+  802303:	48 83 ec 38          	sub    $0x38,%rsp
+  802307:	49 89 fe             	mov    %rdi,%r14
+  80230a:	49 89 f5             	mov    %rsi,%r13
+  80230d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  802310:	48 8b 01             	mov    (%rcx),%rax
+  802313:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802317:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80231b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80231f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  802323:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802327:	eb 0d                	jmp    802336 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  802329:	40 0f b6 ff          	movzbl %dil,%edi
+  80232d:	4c 89 ee             	mov    %r13,%rsi
+  802330:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  802333:	4c 89 e3             	mov    %r12,%rbx
+  802336:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80233a:	0f b6 3b             	movzbl (%rbx),%edi
+  80233d:	40 80 ff 25          	cmp    $0x25,%dil
+  802341:	74 14                	je     802357 <vprintfmt+0x61>
+            if (!ch) return;
+  802343:	40 84 ff             	test   %dil,%dil
+  802346:	75 e1                	jne    802329 <vprintfmt+0x33>
+}
+  802348:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80234c:	5b                   	pop    %rbx
+  80234d:	41 5c                	pop    %r12
+  80234f:	41 5d                	pop    %r13
+  802351:	41 5e                	pop    %r14
+  802353:	41 5f                	pop    %r15
+  802355:	5d                   	pop    %rbp
+  802356:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  802357:	be 00 00 00 00       	mov    $0x0,%esi
+  80235c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  802360:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802365:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80236b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  802372:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802376:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80237b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  802380:	88 45 a0             	mov    %al,-0x60(%rbp)
+  802383:	83 e8 23             	sub    $0x23,%eax
+  802386:	3c 57                	cmp    $0x57,%al
+  802388:	0f 87 67 06 00 00    	ja     8029f5 <vprintfmt+0x6ff>
+  80238e:	0f b6 c0             	movzbl %al,%eax
+  802391:	48 b9 20 6c 80 00 00 	movabs $0x806c20,%rcx
+  802398:	00 00 00 
+  80239b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80239e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8023a1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8023a5:	eb cf                	jmp    802376 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  8023a7:	49 89 dc             	mov    %rbx,%r12
+  8023aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8023af:	eb c5                	jmp    802376 <vprintfmt+0x80>
+            padc = ch;
+  8023b1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8023b5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8023b8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8023bb:	eb b9                	jmp    802376 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8023bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023c3:	77 24                	ja     8023e9 <vprintfmt+0xf3>
+  8023c5:	89 c1                	mov    %eax,%ecx
+  8023c7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8023cb:	83 c0 08             	add    $0x8,%eax
+  8023ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023d1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8023d4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8023d7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8023db:	79 99                	jns    802376 <vprintfmt+0x80>
+                width = precision;
+  8023dd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8023e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8023e7:	eb 8d                	jmp    802376 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8023e9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8023ed:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8023f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023f5:	eb da                	jmp    8023d1 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8023f7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8023fc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802400:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  802406:	3c 39                	cmp    $0x39,%al
+  802408:	77 1c                	ja     802426 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  80240a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80240e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  802412:	0f b6 c0             	movzbl %al,%eax
+  802415:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80241a:	0f b6 03             	movzbl (%rbx),%eax
+  80241d:	3c 39                	cmp    $0x39,%al
+  80241f:	76 e9                	jbe    80240a <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  802421:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802424:	eb b1                	jmp    8023d7 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  802426:	49 89 dc             	mov    %rbx,%r12
+  802429:	eb ac                	jmp    8023d7 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  80242b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80242e:	85 c9                	test   %ecx,%ecx
+  802430:	b8 00 00 00 00       	mov    $0x0,%eax
+  802435:	0f 49 c1             	cmovns %ecx,%eax
+  802438:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80243b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80243e:	e9 33 ff ff ff       	jmp    802376 <vprintfmt+0x80>
+            lflag++;
+  802443:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802446:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802449:	e9 28 ff ff ff       	jmp    802376 <vprintfmt+0x80>
+            lflag--;
+  80244e:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802451:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802454:	e9 1d ff ff ff       	jmp    802376 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  802459:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80245c:	83 f8 2f             	cmp    $0x2f,%eax
+  80245f:	77 19                	ja     80247a <vprintfmt+0x184>
+  802461:	89 c2                	mov    %eax,%edx
+  802463:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802467:	83 c0 08             	add    $0x8,%eax
+  80246a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80246d:	8b 3a                	mov    (%rdx),%edi
+  80246f:	4c 89 ee             	mov    %r13,%rsi
+  802472:	41 ff d6             	call   *%r14
+            break;
+  802475:	e9 bc fe ff ff       	jmp    802336 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  80247a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80247e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802482:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802486:	eb e5                	jmp    80246d <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  802488:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80248b:	83 f8 2f             	cmp    $0x2f,%eax
+  80248e:	77 5a                	ja     8024ea <vprintfmt+0x1f4>
+  802490:	89 c2                	mov    %eax,%edx
+  802492:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802496:	83 c0 08             	add    $0x8,%eax
+  802499:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80249c:	8b 02                	mov    (%rdx),%eax
+  80249e:	89 c1                	mov    %eax,%ecx
+  8024a0:	f7 d9                	neg    %ecx
+  8024a2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8024a5:	83 f9 13             	cmp    $0x13,%ecx
+  8024a8:	7f 4e                	jg     8024f8 <vprintfmt+0x202>
+  8024aa:	48 63 c1             	movslq %ecx,%rax
+  8024ad:	48 ba e0 6e 80 00 00 	movabs $0x806ee0,%rdx
+  8024b4:	00 00 00 
+  8024b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8024bb:	48 85 c0             	test   %rax,%rax
+  8024be:	74 38                	je     8024f8 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8024c0:	48 89 c1             	mov    %rax,%rcx
+  8024c3:	48 ba c8 70 80 00 00 	movabs $0x8070c8,%rdx
+  8024ca:	00 00 00 
+  8024cd:	4c 89 ee             	mov    %r13,%rsi
+  8024d0:	4c 89 f7             	mov    %r14,%rdi
+  8024d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d8:	49 b8 b9 22 80 00 00 	movabs $0x8022b9,%r8
+  8024df:	00 00 00 
+  8024e2:	41 ff d0             	call   *%r8
+  8024e5:	e9 4c fe ff ff       	jmp    802336 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8024ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024f6:	eb a4                	jmp    80249c <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8024f8:	48 ba b4 6a 80 00 00 	movabs $0x806ab4,%rdx
+  8024ff:	00 00 00 
+  802502:	4c 89 ee             	mov    %r13,%rsi
+  802505:	4c 89 f7             	mov    %r14,%rdi
+  802508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250d:	49 b8 b9 22 80 00 00 	movabs $0x8022b9,%r8
+  802514:	00 00 00 
+  802517:	41 ff d0             	call   *%r8
+  80251a:	e9 17 fe ff ff       	jmp    802336 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  80251f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802522:	83 f8 2f             	cmp    $0x2f,%eax
+  802525:	77 6c                	ja     802593 <vprintfmt+0x29d>
+  802527:	89 c2                	mov    %eax,%edx
+  802529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80252d:	83 c0 08             	add    $0x8,%eax
+  802530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802533:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  802536:	48 85 f6             	test   %rsi,%rsi
+  802539:	48 b8 ad 6a 80 00 00 	movabs $0x806aad,%rax
+  802540:	00 00 00 
+  802543:	48 0f 45 c6          	cmovne %rsi,%rax
+  802547:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80254b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80254f:	7e 06                	jle    802557 <vprintfmt+0x261>
+  802551:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802555:	75 4a                	jne    8025a1 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802557:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80255b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80255f:	0f b6 00             	movzbl (%rax),%eax
+  802562:	84 c0                	test   %al,%al
+  802564:	0f 85 9a 00 00 00    	jne    802604 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  80256a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80256d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  802571:	85 c0                	test   %eax,%eax
+  802573:	0f 8e bd fd ff ff    	jle    802336 <vprintfmt+0x40>
+  802579:	4c 89 ee             	mov    %r13,%rsi
+  80257c:	bf 20 00 00 00       	mov    $0x20,%edi
+  802581:	41 ff d6             	call   *%r14
+  802584:	41 83 ec 01          	sub    $0x1,%r12d
+  802588:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80258c:	75 eb                	jne    802579 <vprintfmt+0x283>
+  80258e:	e9 a3 fd ff ff       	jmp    802336 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  802593:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802597:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80259b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80259f:	eb 92                	jmp    802533 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  8025a1:	49 63 f7             	movslq %r15d,%rsi
+  8025a4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8025a8:	48 b8 ba 2a 80 00 00 	movabs $0x802aba,%rax
+  8025af:	00 00 00 
+  8025b2:	ff d0                	call   *%rax
+  8025b4:	48 89 c2             	mov    %rax,%rdx
+  8025b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8025ba:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8025bc:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8025bf:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  8025c2:	85 c0                	test   %eax,%eax
+  8025c4:	7e 91                	jle    802557 <vprintfmt+0x261>
+  8025c6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8025cb:	4c 89 ee             	mov    %r13,%rsi
+  8025ce:	44 89 e7             	mov    %r12d,%edi
+  8025d1:	41 ff d6             	call   *%r14
+  8025d4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8025d8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8025db:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8025de:	75 eb                	jne    8025cb <vprintfmt+0x2d5>
+  8025e0:	e9 72 ff ff ff       	jmp    802557 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8025e5:	0f b6 f8             	movzbl %al,%edi
+  8025e8:	4c 89 ee             	mov    %r13,%rsi
+  8025eb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8025ee:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8025f2:	49 83 c4 01          	add    $0x1,%r12
+  8025f6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8025fc:	84 c0                	test   %al,%al
+  8025fe:	0f 84 66 ff ff ff    	je     80256a <vprintfmt+0x274>
+  802604:	45 85 ff             	test   %r15d,%r15d
+  802607:	78 0a                	js     802613 <vprintfmt+0x31d>
+  802609:	41 83 ef 01          	sub    $0x1,%r15d
+  80260d:	0f 88 57 ff ff ff    	js     80256a <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  802613:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802617:	74 cc                	je     8025e5 <vprintfmt+0x2ef>
+  802619:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80261c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  802621:	80 fa 5e             	cmp    $0x5e,%dl
+  802624:	77 c2                	ja     8025e8 <vprintfmt+0x2f2>
+  802626:	eb bd                	jmp    8025e5 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  802628:	40 84 f6             	test   %sil,%sil
+  80262b:	75 26                	jne    802653 <vprintfmt+0x35d>
+    switch (lflag) {
+  80262d:	85 d2                	test   %edx,%edx
+  80262f:	74 59                	je     80268a <vprintfmt+0x394>
+  802631:	83 fa 01             	cmp    $0x1,%edx
+  802634:	74 7b                	je     8026b1 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  802636:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802639:	83 f8 2f             	cmp    $0x2f,%eax
+  80263c:	0f 87 96 00 00 00    	ja     8026d8 <vprintfmt+0x3e2>
+  802642:	89 c2                	mov    %eax,%edx
+  802644:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802648:	83 c0 08             	add    $0x8,%eax
+  80264b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80264e:	4c 8b 22             	mov    (%rdx),%r12
+  802651:	eb 17                	jmp    80266a <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  802653:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802656:	83 f8 2f             	cmp    $0x2f,%eax
+  802659:	77 21                	ja     80267c <vprintfmt+0x386>
+  80265b:	89 c2                	mov    %eax,%edx
+  80265d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802661:	83 c0 08             	add    $0x8,%eax
+  802664:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802667:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80266a:	4d 85 e4             	test   %r12,%r12
+  80266d:	78 7a                	js     8026e9 <vprintfmt+0x3f3>
+            num = i;
+  80266f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  802672:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802677:	e9 56 02 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80267c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802680:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802684:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802688:	eb dd                	jmp    802667 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  80268a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80268d:	83 f8 2f             	cmp    $0x2f,%eax
+  802690:	77 11                	ja     8026a3 <vprintfmt+0x3ad>
+  802692:	89 c2                	mov    %eax,%edx
+  802694:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802698:	83 c0 08             	add    $0x8,%eax
+  80269b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80269e:	4c 63 22             	movslq (%rdx),%r12
+  8026a1:	eb c7                	jmp    80266a <vprintfmt+0x374>
+  8026a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026af:	eb ed                	jmp    80269e <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  8026b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8026b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8026b7:	77 11                	ja     8026ca <vprintfmt+0x3d4>
+  8026b9:	89 c2                	mov    %eax,%edx
+  8026bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8026bf:	83 c0 08             	add    $0x8,%eax
+  8026c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8026c5:	4c 8b 22             	mov    (%rdx),%r12
+  8026c8:	eb a0                	jmp    80266a <vprintfmt+0x374>
+  8026ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026d6:	eb ed                	jmp    8026c5 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  8026d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026e4:	e9 65 ff ff ff       	jmp    80264e <vprintfmt+0x358>
+                putch('-', put_arg);
+  8026e9:	4c 89 ee             	mov    %r13,%rsi
+  8026ec:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8026f1:	41 ff d6             	call   *%r14
+                i = -i;
+  8026f4:	49 f7 dc             	neg    %r12
+  8026f7:	e9 73 ff ff ff       	jmp    80266f <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  8026fc:	40 84 f6             	test   %sil,%sil
+  8026ff:	75 2e                	jne    80272f <vprintfmt+0x439>
+    switch (lflag) {
+  802701:	85 d2                	test   %edx,%edx
+  802703:	7f 59                	jg     80275e <vprintfmt+0x468>
+  802705:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802708:	7d 7a                	jge    802784 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  80270a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80270d:	83 f8 2f             	cmp    $0x2f,%eax
+  802710:	0f 87 aa 00 00 00    	ja     8027c0 <vprintfmt+0x4ca>
+  802716:	89 c2                	mov    %eax,%edx
+  802718:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80271c:	83 c0 08             	add    $0x8,%eax
+  80271f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802722:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802725:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80272a:	e9 a3 01 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80272f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802732:	83 f8 2f             	cmp    $0x2f,%eax
+  802735:	77 19                	ja     802750 <vprintfmt+0x45a>
+  802737:	89 c2                	mov    %eax,%edx
+  802739:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80273d:	83 c0 08             	add    $0x8,%eax
+  802740:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802743:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80274b:	e9 82 01 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+  802750:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802754:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80275c:	eb e5                	jmp    802743 <vprintfmt+0x44d>
+    switch (lflag) {
+  80275e:	83 fa 01             	cmp    $0x1,%edx
+  802761:	75 a7                	jne    80270a <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802763:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802766:	83 f8 2f             	cmp    $0x2f,%eax
+  802769:	77 47                	ja     8027b2 <vprintfmt+0x4bc>
+  80276b:	89 c2                	mov    %eax,%edx
+  80276d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802771:	83 c0 08             	add    $0x8,%eax
+  802774:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802777:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80277a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80277f:	e9 4e 01 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802784:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802787:	83 f8 2f             	cmp    $0x2f,%eax
+  80278a:	77 18                	ja     8027a4 <vprintfmt+0x4ae>
+  80278c:	89 c2                	mov    %eax,%edx
+  80278e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802792:	83 c0 08             	add    $0x8,%eax
+  802795:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802798:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80279a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80279f:	e9 2e 01 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+  8027a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8027ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027b0:	eb e6                	jmp    802798 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8027b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8027ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027be:	eb b7                	jmp    802777 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8027c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8027c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8027c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8027cc:	e9 51 ff ff ff       	jmp    802722 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  8027d1:	40 84 f6             	test   %sil,%sil
+  8027d4:	75 2e                	jne    802804 <vprintfmt+0x50e>
+    switch (lflag) {
+  8027d6:	85 d2                	test   %edx,%edx
+  8027d8:	7f 59                	jg     802833 <vprintfmt+0x53d>
+  8027da:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8027dd:	7d 77                	jge    802856 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8027df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8027e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8027e5:	0f 87 a4 00 00 00    	ja     80288f <vprintfmt+0x599>
+  8027eb:	89 c2                	mov    %eax,%edx
+  8027ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8027f1:	83 c0 08             	add    $0x8,%eax
+  8027f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8027f7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8027fa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8027ff:	e9 ce 00 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802804:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802807:	83 f8 2f             	cmp    $0x2f,%eax
+  80280a:	77 19                	ja     802825 <vprintfmt+0x52f>
+  80280c:	89 c2                	mov    %eax,%edx
+  80280e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802812:	83 c0 08             	add    $0x8,%eax
+  802815:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802818:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80281b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802820:	e9 ad 00 00 00       	jmp    8028d2 <vprintfmt+0x5dc>
+  802825:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802829:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80282d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802831:	eb e5                	jmp    802818 <vprintfmt+0x522>
+    switch (lflag) {
+  802833:	83 fa 01             	cmp    $0x1,%edx
+  802836:	75 a7                	jne    8027df <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802838:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80283b:	83 f8 2f             	cmp    $0x2f,%eax
+  80283e:	77 41                	ja     802881 <vprintfmt+0x58b>
+  802840:	89 c2                	mov    %eax,%edx
+  802842:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802846:	83 c0 08             	add    $0x8,%eax
+  802849:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80284c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80284f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802854:	eb 7c                	jmp    8028d2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802859:	83 f8 2f             	cmp    $0x2f,%eax
+  80285c:	77 15                	ja     802873 <vprintfmt+0x57d>
+  80285e:	89 c2                	mov    %eax,%edx
+  802860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802864:	83 c0 08             	add    $0x8,%eax
+  802867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80286a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80286c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  802871:	eb 5f                	jmp    8028d2 <vprintfmt+0x5dc>
+  802873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80287b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80287f:	eb e9                	jmp    80286a <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  802881:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802885:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802889:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80288d:	eb bd                	jmp    80284c <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80288f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80289b:	e9 57 ff ff ff       	jmp    8027f7 <vprintfmt+0x501>
+            putch('0', put_arg);
+  8028a0:	4c 89 ee             	mov    %r13,%rsi
+  8028a3:	bf 30 00 00 00       	mov    $0x30,%edi
+  8028a8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8028ab:	4c 89 ee             	mov    %r13,%rsi
+  8028ae:	bf 78 00 00 00       	mov    $0x78,%edi
+  8028b3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8028b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8028b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8028bc:	77 47                	ja     802905 <vprintfmt+0x60f>
+  8028be:	89 c2                	mov    %eax,%edx
+  8028c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8028c4:	83 c0 08             	add    $0x8,%eax
+  8028c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8028ca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8028cd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8028d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8028da:	0f 94 c0             	sete   %al
+  8028dd:	0f b6 c0             	movzbl %al,%eax
+  8028e0:	50                   	push   %rax
+  8028e1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8028e6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8028ea:	4c 89 ee             	mov    %r13,%rsi
+  8028ed:	4c 89 f7             	mov    %r14,%rdi
+  8028f0:	48 b8 eb 21 80 00 00 	movabs $0x8021eb,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+            break;
+  8028fc:	48 83 c4 10          	add    $0x10,%rsp
+  802900:	e9 31 fa ff ff       	jmp    802336 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802905:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802909:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80290d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802911:	eb b7                	jmp    8028ca <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802913:	40 84 f6             	test   %sil,%sil
+  802916:	75 2b                	jne    802943 <vprintfmt+0x64d>
+    switch (lflag) {
+  802918:	85 d2                	test   %edx,%edx
+  80291a:	7f 56                	jg     802972 <vprintfmt+0x67c>
+  80291c:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80291f:	7d 77                	jge    802998 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802921:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802924:	83 f8 2f             	cmp    $0x2f,%eax
+  802927:	0f 87 a7 00 00 00    	ja     8029d4 <vprintfmt+0x6de>
+  80292d:	89 c2                	mov    %eax,%edx
+  80292f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802933:	83 c0 08             	add    $0x8,%eax
+  802936:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802939:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80293c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802941:	eb 8f                	jmp    8028d2 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802943:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802946:	83 f8 2f             	cmp    $0x2f,%eax
+  802949:	77 19                	ja     802964 <vprintfmt+0x66e>
+  80294b:	89 c2                	mov    %eax,%edx
+  80294d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802951:	83 c0 08             	add    $0x8,%eax
+  802954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802957:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80295a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80295f:	e9 6e ff ff ff       	jmp    8028d2 <vprintfmt+0x5dc>
+  802964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80296c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802970:	eb e5                	jmp    802957 <vprintfmt+0x661>
+    switch (lflag) {
+  802972:	83 fa 01             	cmp    $0x1,%edx
+  802975:	75 aa                	jne    802921 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80297a:	83 f8 2f             	cmp    $0x2f,%eax
+  80297d:	77 47                	ja     8029c6 <vprintfmt+0x6d0>
+  80297f:	89 c2                	mov    %eax,%edx
+  802981:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802985:	83 c0 08             	add    $0x8,%eax
+  802988:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80298b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80298e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802993:	e9 3a ff ff ff       	jmp    8028d2 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80299b:	83 f8 2f             	cmp    $0x2f,%eax
+  80299e:	77 18                	ja     8029b8 <vprintfmt+0x6c2>
+  8029a0:	89 c2                	mov    %eax,%edx
+  8029a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8029a6:	83 c0 08             	add    $0x8,%eax
+  8029a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8029ac:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8029ae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8029b3:	e9 1a ff ff ff       	jmp    8028d2 <vprintfmt+0x5dc>
+  8029b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029c4:	eb e6                	jmp    8029ac <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8029c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029d2:	eb b7                	jmp    80298b <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8029d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8029d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8029dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8029e0:	e9 54 ff ff ff       	jmp    802939 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8029e5:	4c 89 ee             	mov    %r13,%rsi
+  8029e8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8029ed:	41 ff d6             	call   *%r14
+            break;
+  8029f0:	e9 41 f9 ff ff       	jmp    802336 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8029f5:	4c 89 ee             	mov    %r13,%rsi
+  8029f8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8029fd:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802a00:	48 83 eb 01          	sub    $0x1,%rbx
+  802a04:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802a08:	75 f6                	jne    802a00 <vprintfmt+0x70a>
+  802a0a:	e9 27 f9 ff ff       	jmp    802336 <vprintfmt+0x40>
+
+0000000000802a0f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802a0f:	55                   	push   %rbp
+  802a10:	48 89 e5             	mov    %rsp,%rbp
+  802a13:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802a17:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a1b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802a20:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802a24:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802a2b:	48 85 ff             	test   %rdi,%rdi
+  802a2e:	74 2b                	je     802a5b <vsnprintf+0x4c>
+  802a30:	48 85 f6             	test   %rsi,%rsi
+  802a33:	74 26                	je     802a5b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802a35:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a39:	48 bf a1 22 80 00 00 	movabs $0x8022a1,%rdi
+  802a40:	00 00 00 
+  802a43:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  802a4a:	00 00 00 
+  802a4d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802a4f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a53:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802a56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802a59:	c9                   	leave
+  802a5a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802a5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a60:	eb f7                	jmp    802a59 <vsnprintf+0x4a>
+
+0000000000802a62 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802a62:	55                   	push   %rbp
+  802a63:	48 89 e5             	mov    %rsp,%rbp
+  802a66:	48 83 ec 50          	sub    $0x50,%rsp
+  802a6a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802a6e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802a72:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802a76:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802a7d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802a85:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802a89:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802a8d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802a91:	48 b8 0f 2a 80 00 00 	movabs $0x802a0f,%rax
+  802a98:	00 00 00 
+  802a9b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+0000000000802a9f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802a9f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802aa2:	74 10                	je     802ab4 <strlen+0x15>
+    size_t n = 0;
+  802aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802aa9:	48 83 c0 01          	add    $0x1,%rax
+  802aad:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802ab1:	75 f6                	jne    802aa9 <strlen+0xa>
+  802ab3:	c3                   	ret
+    size_t n = 0;
+  802ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802ab9:	c3                   	ret
+
+0000000000802aba <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802aba:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802abd:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802ac2:	48 85 f6             	test   %rsi,%rsi
+  802ac5:	74 11                	je     802ad8 <strnlen+0x1e>
+  802ac7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802acb:	74 0c                	je     802ad9 <strnlen+0x1f>
+  802acd:	48 83 c2 01          	add    $0x1,%rdx
+  802ad1:	48 39 d0             	cmp    %rdx,%rax
+  802ad4:	75 f1                	jne    802ac7 <strnlen+0xd>
+  802ad6:	eb 04                	jmp    802adc <strnlen+0x22>
+  802ad8:	c3                   	ret
+  802ad9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802adc:	c3                   	ret
+
+0000000000802add <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802add:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802ae9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802aec:	48 83 c2 01          	add    $0x1,%rdx
+  802af0:	84 c9                	test   %cl,%cl
+  802af2:	75 f1                	jne    802ae5 <strcpy+0x8>
+        ;
+    return res;
+}
+  802af4:	c3                   	ret
+
+0000000000802af5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802af5:	55                   	push   %rbp
+  802af6:	48 89 e5             	mov    %rsp,%rbp
+  802af9:	41 54                	push   %r12
+  802afb:	53                   	push   %rbx
+  802afc:	48 89 fb             	mov    %rdi,%rbx
+  802aff:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802b02:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802b0e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802b12:	4c 89 e6             	mov    %r12,%rsi
+  802b15:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+    return dst;
+}
+  802b21:	48 89 d8             	mov    %rbx,%rax
+  802b24:	5b                   	pop    %rbx
+  802b25:	41 5c                	pop    %r12
+  802b27:	5d                   	pop    %rbp
+  802b28:	c3                   	ret
+
+0000000000802b29 <toupper>:
+
+int
+toupper(int ch) {
+  802b29:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802b2b:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802b2e:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802b31:	83 f9 1a             	cmp    $0x1a,%ecx
+  802b34:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802b37:	c3                   	ret
+
+0000000000802b38 <tolower>:
+
+int
+tolower(int ch) {
+  802b38:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802b3a:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802b3d:	8d 57 20             	lea    0x20(%rdi),%edx
+  802b40:	83 f9 1a             	cmp    $0x1a,%ecx
+  802b43:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802b46:	c3                   	ret
+
+0000000000802b47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802b47:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802b4a:	48 85 d2             	test   %rdx,%rdx
+  802b4d:	74 1f                	je     802b6e <strncpy+0x27>
+  802b4f:	48 01 fa             	add    %rdi,%rdx
+  802b52:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802b55:	48 83 c1 01          	add    $0x1,%rcx
+  802b59:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802b5d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802b61:	41 80 f8 01          	cmp    $0x1,%r8b
+  802b65:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802b69:	48 39 ca             	cmp    %rcx,%rdx
+  802b6c:	75 e7                	jne    802b55 <strncpy+0xe>
+    }
+    return ret;
+}
+  802b6e:	c3                   	ret
+
+0000000000802b6f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802b6f:	48 89 f8             	mov    %rdi,%rax
+  802b72:	48 85 d2             	test   %rdx,%rdx
+  802b75:	74 24                	je     802b9b <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802b77:	48 83 ea 01          	sub    $0x1,%rdx
+  802b7b:	74 1b                	je     802b98 <strlcpy+0x29>
+  802b7d:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802b81:	0f b6 16             	movzbl (%rsi),%edx
+  802b84:	84 d2                	test   %dl,%dl
+  802b86:	74 10                	je     802b98 <strlcpy+0x29>
+            *dst++ = *src++;
+  802b88:	48 83 c6 01          	add    $0x1,%rsi
+  802b8c:	48 83 c0 01          	add    $0x1,%rax
+  802b90:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802b93:	48 39 c8             	cmp    %rcx,%rax
+  802b96:	75 e9                	jne    802b81 <strlcpy+0x12>
+        *dst = '\0';
+  802b98:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802b9b:	48 29 f8             	sub    %rdi,%rax
+}
+  802b9e:	c3                   	ret
+
+0000000000802b9f <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802b9f:	0f b6 07             	movzbl (%rdi),%eax
+  802ba2:	84 c0                	test   %al,%al
+  802ba4:	74 13                	je     802bb9 <strcmp+0x1a>
+  802ba6:	38 06                	cmp    %al,(%rsi)
+  802ba8:	75 0f                	jne    802bb9 <strcmp+0x1a>
+  802baa:	48 83 c7 01          	add    $0x1,%rdi
+  802bae:	48 83 c6 01          	add    $0x1,%rsi
+  802bb2:	0f b6 07             	movzbl (%rdi),%eax
+  802bb5:	84 c0                	test   %al,%al
+  802bb7:	75 ed                	jne    802ba6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802bb9:	0f b6 c0             	movzbl %al,%eax
+  802bbc:	0f b6 16             	movzbl (%rsi),%edx
+  802bbf:	29 d0                	sub    %edx,%eax
+}
+  802bc1:	c3                   	ret
+
+0000000000802bc2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802bc2:	48 85 d2             	test   %rdx,%rdx
+  802bc5:	74 1f                	je     802be6 <strncmp+0x24>
+  802bc7:	0f b6 07             	movzbl (%rdi),%eax
+  802bca:	84 c0                	test   %al,%al
+  802bcc:	74 1e                	je     802bec <strncmp+0x2a>
+  802bce:	3a 06                	cmp    (%rsi),%al
+  802bd0:	75 1a                	jne    802bec <strncmp+0x2a>
+  802bd2:	48 83 c7 01          	add    $0x1,%rdi
+  802bd6:	48 83 c6 01          	add    $0x1,%rsi
+  802bda:	48 83 ea 01          	sub    $0x1,%rdx
+  802bde:	75 e7                	jne    802bc7 <strncmp+0x5>
+
+    if (!n) return 0;
+  802be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be5:	c3                   	ret
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802beb:	c3                   	ret
+  802bec:	48 85 d2             	test   %rdx,%rdx
+  802bef:	74 09                	je     802bfa <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802bf1:	0f b6 07             	movzbl (%rdi),%eax
+  802bf4:	0f b6 16             	movzbl (%rsi),%edx
+  802bf7:	29 d0                	sub    %edx,%eax
+  802bf9:	c3                   	ret
+    if (!n) return 0;
+  802bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bff:	c3                   	ret
+
+0000000000802c00 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802c00:	0f b6 17             	movzbl (%rdi),%edx
+  802c03:	84 d2                	test   %dl,%dl
+  802c05:	74 18                	je     802c1f <strchr+0x1f>
+        if (*str == c) {
+  802c07:	0f be d2             	movsbl %dl,%edx
+  802c0a:	39 f2                	cmp    %esi,%edx
+  802c0c:	74 17                	je     802c25 <strchr+0x25>
+    for (; *str; str++) {
+  802c0e:	48 83 c7 01          	add    $0x1,%rdi
+  802c12:	0f b6 17             	movzbl (%rdi),%edx
+  802c15:	84 d2                	test   %dl,%dl
+  802c17:	75 ee                	jne    802c07 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1e:	c3                   	ret
+  802c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c24:	c3                   	ret
+  802c25:	48 89 f8             	mov    %rdi,%rax
+}
+  802c28:	c3                   	ret
+
+0000000000802c29 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802c29:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802c2c:	0f b6 17             	movzbl (%rdi),%edx
+  802c2f:	84 d2                	test   %dl,%dl
+  802c31:	74 13                	je     802c46 <strfind+0x1d>
+  802c33:	0f be d2             	movsbl %dl,%edx
+  802c36:	39 f2                	cmp    %esi,%edx
+  802c38:	74 0b                	je     802c45 <strfind+0x1c>
+  802c3a:	48 83 c0 01          	add    $0x1,%rax
+  802c3e:	0f b6 10             	movzbl (%rax),%edx
+  802c41:	84 d2                	test   %dl,%dl
+  802c43:	75 ee                	jne    802c33 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802c45:	c3                   	ret
+  802c46:	c3                   	ret
+
+0000000000802c47 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802c47:	48 39 f7             	cmp    %rsi,%rdi
+  802c4a:	74 65                	je     802cb1 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	41 57                	push   %r15
+  802c52:	41 56                	push   %r14
+  802c54:	41 55                	push   %r13
+  802c56:	41 54                	push   %r12
+  802c58:	53                   	push   %rbx
+  802c59:	48 83 ec 18          	sub    $0x18,%rsp
+  802c5d:	48 89 fb             	mov    %rdi,%rbx
+  802c60:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802c63:	49 bf 38 2b 80 00 00 	movabs $0x802b38,%r15
+  802c6a:	00 00 00 
+  802c6d:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802c71:	41 0f b6 fd          	movzbl %r13b,%edi
+  802c75:	41 ff d7             	call   *%r15
+  802c78:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802c7b:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802c80:	41 0f b6 fe          	movzbl %r14b,%edi
+  802c84:	41 ff d7             	call   *%r15
+  802c87:	89 c2                	mov    %eax,%edx
+  802c89:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802c8c:	29 d0                	sub    %edx,%eax
+  802c8e:	75 12                	jne    802ca2 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802c90:	48 83 c3 01          	add    $0x1,%rbx
+  802c94:	45 84 ed             	test   %r13b,%r13b
+  802c97:	74 09                	je     802ca2 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802c99:	49 83 c4 01          	add    $0x1,%r12
+  802c9d:	45 84 f6             	test   %r14b,%r14b
+  802ca0:	75 cb                	jne    802c6d <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802ca2:	48 83 c4 18          	add    $0x18,%rsp
+  802ca6:	5b                   	pop    %rbx
+  802ca7:	41 5c                	pop    %r12
+  802ca9:	41 5d                	pop    %r13
+  802cab:	41 5e                	pop    %r14
+  802cad:	41 5f                	pop    %r15
+  802caf:	5d                   	pop    %rbp
+  802cb0:	c3                   	ret
+    if (p1 == p2) return 0;
+  802cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb6:	c3                   	ret
+
+0000000000802cb7 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802cb7:	48 39 f7             	cmp    %rsi,%rdi
+  802cba:	74 7d                	je     802d39 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802cbc:	55                   	push   %rbp
+  802cbd:	48 89 e5             	mov    %rsp,%rbp
+  802cc0:	41 57                	push   %r15
+  802cc2:	41 56                	push   %r14
+  802cc4:	41 55                	push   %r13
+  802cc6:	41 54                	push   %r12
+  802cc8:	53                   	push   %rbx
+  802cc9:	48 83 ec 18          	sub    $0x18,%rsp
+  802ccd:	48 89 fb             	mov    %rdi,%rbx
+  802cd0:	49 89 f4             	mov    %rsi,%r12
+  802cd3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802cd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802cdb:	49 bf 38 2b 80 00 00 	movabs $0x802b38,%r15
+  802ce2:	00 00 00 
+    while (n--) {
+  802ce5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ce9:	48 39 c3             	cmp    %rax,%rbx
+  802cec:	74 37                	je     802d25 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802cee:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802cf2:	41 0f b6 fd          	movzbl %r13b,%edi
+  802cf6:	41 ff d7             	call   *%r15
+  802cf9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802cfc:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802d01:	41 0f b6 fe          	movzbl %r14b,%edi
+  802d05:	41 ff d7             	call   *%r15
+  802d08:	89 c2                	mov    %eax,%edx
+  802d0a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802d0d:	29 d0                	sub    %edx,%eax
+  802d0f:	75 19                	jne    802d2a <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802d11:	48 83 c3 01          	add    $0x1,%rbx
+  802d15:	45 84 ed             	test   %r13b,%r13b
+  802d18:	74 10                	je     802d2a <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802d1a:	49 83 c4 01          	add    $0x1,%r12
+  802d1e:	45 84 f6             	test   %r14b,%r14b
+  802d21:	75 c2                	jne    802ce5 <strncasecmp+0x2e>
+  802d23:	eb 05                	jmp    802d2a <strncasecmp+0x73>
+  802d25:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802d2a:	48 83 c4 18          	add    $0x18,%rsp
+  802d2e:	5b                   	pop    %rbx
+  802d2f:	41 5c                	pop    %r12
+  802d31:	41 5d                	pop    %r13
+  802d33:	41 5e                	pop    %r14
+  802d35:	41 5f                	pop    %r15
+  802d37:	5d                   	pop    %rbp
+  802d38:	c3                   	ret
+    if (p1 == p2) return 0;
+  802d39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d3e:	c3                   	ret
+
+0000000000802d3f <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802d3f:	83 e7 df             	and    $0xffffffdf,%edi
+  802d42:	83 ef 41             	sub    $0x41,%edi
+  802d45:	83 ff 19             	cmp    $0x19,%edi
+  802d48:	0f 96 c0             	setbe  %al
+}
+  802d4b:	c3                   	ret
+
+0000000000802d4c <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802d4c:	83 ff 20             	cmp    $0x20,%edi
+  802d4f:	0f 94 c0             	sete   %al
+  802d52:	83 ff 09             	cmp    $0x9,%edi
+  802d55:	0f 94 c2             	sete   %dl
+  802d58:	09 d0                	or     %edx,%eax
+}
+  802d5a:	c3                   	ret
+
+0000000000802d5b <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802d5b:	55                   	push   %rbp
+  802d5c:	48 89 e5             	mov    %rsp,%rbp
+  802d5f:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802d61:	48 bf 9f 6f 80 00 00 	movabs $0x806f9f,%rdi
+  802d68:	00 00 00 
+  802d6b:	48 b8 00 2c 80 00 00 	movabs $0x802c00,%rax
+  802d72:	00 00 00 
+  802d75:	ff d0                	call   *%rax
+  802d77:	48 85 c0             	test   %rax,%rax
+  802d7a:	0f 95 c0             	setne  %al
+}
+  802d7d:	5d                   	pop    %rbp
+  802d7e:	c3                   	ret
+
+0000000000802d7f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802d7f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802d82:	48 89 f8             	mov    %rdi,%rax
+  802d85:	48 f7 d8             	neg    %rax
+  802d88:	83 e0 07             	and    $0x7,%eax
+  802d8b:	49 89 d1             	mov    %rdx,%r9
+  802d8e:	49 29 c1             	sub    %rax,%r9
+  802d91:	78 36                	js     802dc9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802d93:	40 0f b6 c6          	movzbl %sil,%eax
+  802d97:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802d9e:	01 01 01 
+  802da1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802da5:	40 f6 c7 07          	test   $0x7,%dil
+  802da9:	75 38                	jne    802de3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802dab:	4c 89 c9             	mov    %r9,%rcx
+  802dae:	48 c1 f9 03          	sar    $0x3,%rcx
+  802db2:	74 0c                	je     802dc0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802db4:	fc                   	cld
+  802db5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802db8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802dbc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802dc0:	4d 85 c9             	test   %r9,%r9
+  802dc3:	75 45                	jne    802e0a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802dc5:	4c 89 c0             	mov    %r8,%rax
+  802dc8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802dc9:	48 85 d2             	test   %rdx,%rdx
+  802dcc:	74 f7                	je     802dc5 <memset+0x46>
+  802dce:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802dd1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802dd4:	48 83 c0 01          	add    $0x1,%rax
+  802dd8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802ddc:	48 39 c2             	cmp    %rax,%rdx
+  802ddf:	75 f3                	jne    802dd4 <memset+0x55>
+  802de1:	eb e2                	jmp    802dc5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802de3:	40 f6 c7 01          	test   $0x1,%dil
+  802de7:	74 06                	je     802def <memset+0x70>
+  802de9:	88 07                	mov    %al,(%rdi)
+  802deb:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802def:	40 f6 c7 02          	test   $0x2,%dil
+  802df3:	74 07                	je     802dfc <memset+0x7d>
+  802df5:	66 89 07             	mov    %ax,(%rdi)
+  802df8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802dfc:	40 f6 c7 04          	test   $0x4,%dil
+  802e00:	74 a9                	je     802dab <memset+0x2c>
+  802e02:	89 07                	mov    %eax,(%rdi)
+  802e04:	48 83 c7 04          	add    $0x4,%rdi
+  802e08:	eb a1                	jmp    802dab <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802e0a:	41 f6 c1 04          	test   $0x4,%r9b
+  802e0e:	74 06                	je     802e16 <memset+0x97>
+  802e10:	89 07                	mov    %eax,(%rdi)
+  802e12:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802e16:	41 f6 c1 02          	test   $0x2,%r9b
+  802e1a:	74 07                	je     802e23 <memset+0xa4>
+  802e1c:	66 89 07             	mov    %ax,(%rdi)
+  802e1f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802e23:	41 f6 c1 01          	test   $0x1,%r9b
+  802e27:	74 9c                	je     802dc5 <memset+0x46>
+  802e29:	88 07                	mov    %al,(%rdi)
+  802e2b:	eb 98                	jmp    802dc5 <memset+0x46>
+
+0000000000802e2d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802e2d:	48 89 f8             	mov    %rdi,%rax
+  802e30:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802e33:	48 39 fe             	cmp    %rdi,%rsi
+  802e36:	73 3b                	jae    802e73 <memmove+0x46>
+  802e38:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802e3c:	48 39 d7             	cmp    %rdx,%rdi
+  802e3f:	73 32                	jae    802e73 <memmove+0x46>
+        s += n;
+        d += n;
+  802e41:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802e45:	48 89 d6             	mov    %rdx,%rsi
+  802e48:	48 09 fe             	or     %rdi,%rsi
+  802e4b:	48 09 ce             	or     %rcx,%rsi
+  802e4e:	40 f6 c6 07          	test   $0x7,%sil
+  802e52:	75 12                	jne    802e66 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802e54:	48 83 ef 08          	sub    $0x8,%rdi
+  802e58:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802e5c:	48 c1 e9 03          	shr    $0x3,%rcx
+  802e60:	fd                   	std
+  802e61:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802e64:	fc                   	cld
+  802e65:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802e66:	48 83 ef 01          	sub    $0x1,%rdi
+  802e6a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802e6e:	fd                   	std
+  802e6f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802e71:	eb f1                	jmp    802e64 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802e73:	48 89 f2             	mov    %rsi,%rdx
+  802e76:	48 09 c2             	or     %rax,%rdx
+  802e79:	48 09 ca             	or     %rcx,%rdx
+  802e7c:	f6 c2 07             	test   $0x7,%dl
+  802e7f:	75 0c                	jne    802e8d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802e81:	48 c1 e9 03          	shr    $0x3,%rcx
+  802e85:	48 89 c7             	mov    %rax,%rdi
+  802e88:	fc                   	cld
+  802e89:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802e8c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802e8d:	48 89 c7             	mov    %rax,%rdi
+  802e90:	fc                   	cld
+  802e91:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802e93:	c3                   	ret
+
+0000000000802e94 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802e94:	55                   	push   %rbp
+  802e95:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802e98:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  802e9f:	00 00 00 
+  802ea2:	ff d0                	call   *%rax
+}
+  802ea4:	5d                   	pop    %rbp
+  802ea5:	c3                   	ret
+
+0000000000802ea6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802ea6:	55                   	push   %rbp
+  802ea7:	48 89 e5             	mov    %rsp,%rbp
+  802eaa:	41 57                	push   %r15
+  802eac:	41 56                	push   %r14
+  802eae:	41 55                	push   %r13
+  802eb0:	41 54                	push   %r12
+  802eb2:	53                   	push   %rbx
+  802eb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb7:	49 89 fe             	mov    %rdi,%r14
+  802eba:	49 89 f7             	mov    %rsi,%r15
+  802ebd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802ec0:	48 89 f7             	mov    %rsi,%rdi
+  802ec3:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+  802ecf:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802ed2:	48 89 de             	mov    %rbx,%rsi
+  802ed5:	4c 89 f7             	mov    %r14,%rdi
+  802ed8:	48 b8 ba 2a 80 00 00 	movabs $0x802aba,%rax
+  802edf:	00 00 00 
+  802ee2:	ff d0                	call   *%rax
+  802ee4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802ee7:	48 39 c3             	cmp    %rax,%rbx
+  802eea:	74 36                	je     802f22 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802eec:	48 89 d8             	mov    %rbx,%rax
+  802eef:	4c 29 e8             	sub    %r13,%rax
+  802ef2:	49 39 c4             	cmp    %rax,%r12
+  802ef5:	73 31                	jae    802f28 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802ef7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802efc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802f00:	4c 89 fe             	mov    %r15,%rsi
+  802f03:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802f0f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802f13:	48 83 c4 08          	add    $0x8,%rsp
+  802f17:	5b                   	pop    %rbx
+  802f18:	41 5c                	pop    %r12
+  802f1a:	41 5d                	pop    %r13
+  802f1c:	41 5e                	pop    %r14
+  802f1e:	41 5f                	pop    %r15
+  802f20:	5d                   	pop    %rbp
+  802f21:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802f22:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802f26:	eb eb                	jmp    802f13 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802f28:	48 83 eb 01          	sub    $0x1,%rbx
+  802f2c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802f30:	48 89 da             	mov    %rbx,%rdx
+  802f33:	4c 89 fe             	mov    %r15,%rsi
+  802f36:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802f42:	49 01 de             	add    %rbx,%r14
+  802f45:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802f4a:	eb c3                	jmp    802f0f <strlcat+0x69>
+
+0000000000802f4c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802f4c:	48 85 d2             	test   %rdx,%rdx
+  802f4f:	74 2d                	je     802f7e <memcmp+0x32>
+  802f51:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802f56:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802f5a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802f5f:	44 38 c1             	cmp    %r8b,%cl
+  802f62:	75 0f                	jne    802f73 <memcmp+0x27>
+    while (n-- > 0) {
+  802f64:	48 83 c0 01          	add    $0x1,%rax
+  802f68:	48 39 c2             	cmp    %rax,%rdx
+  802f6b:	75 e9                	jne    802f56 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f72:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802f73:	0f b6 c1             	movzbl %cl,%eax
+  802f76:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802f7a:	44 29 c0             	sub    %r8d,%eax
+  802f7d:	c3                   	ret
+    return 0;
+  802f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f83:	c3                   	ret
+
+0000000000802f84 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802f84:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802f88:	48 39 c7             	cmp    %rax,%rdi
+  802f8b:	73 0f                	jae    802f9c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802f8d:	40 38 37             	cmp    %sil,(%rdi)
+  802f90:	74 0e                	je     802fa0 <memfind+0x1c>
+    for (; src < end; src++) {
+  802f92:	48 83 c7 01          	add    $0x1,%rdi
+  802f96:	48 39 f8             	cmp    %rdi,%rax
+  802f99:	75 f2                	jne    802f8d <memfind+0x9>
+  802f9b:	c3                   	ret
+  802f9c:	48 89 f8             	mov    %rdi,%rax
+  802f9f:	c3                   	ret
+  802fa0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802fa3:	c3                   	ret
+
+0000000000802fa4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802fa4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802fa7:	0f b6 37             	movzbl (%rdi),%esi
+  802faa:	40 80 fe 20          	cmp    $0x20,%sil
+  802fae:	74 06                	je     802fb6 <strtol+0x12>
+  802fb0:	40 80 fe 09          	cmp    $0x9,%sil
+  802fb4:	75 13                	jne    802fc9 <strtol+0x25>
+  802fb6:	48 83 c7 01          	add    $0x1,%rdi
+  802fba:	0f b6 37             	movzbl (%rdi),%esi
+  802fbd:	40 80 fe 20          	cmp    $0x20,%sil
+  802fc1:	74 f3                	je     802fb6 <strtol+0x12>
+  802fc3:	40 80 fe 09          	cmp    $0x9,%sil
+  802fc7:	74 ed                	je     802fb6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802fc9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802fcc:	83 e0 fd             	and    $0xfffffffd,%eax
+  802fcf:	3c 01                	cmp    $0x1,%al
+  802fd1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802fd5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802fdb:	75 0f                	jne    802fec <strtol+0x48>
+  802fdd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802fe0:	74 14                	je     802ff6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802fe2:	85 d2                	test   %edx,%edx
+  802fe4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802fe9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802fec:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802ff1:	4c 63 ca             	movslq %edx,%r9
+  802ff4:	eb 36                	jmp    80302c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802ff6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802ffa:	74 0f                	je     80300b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802ffc:	85 d2                	test   %edx,%edx
+  802ffe:	75 ec                	jne    802fec <strtol+0x48>
+        s++;
+  803000:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  803004:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  803009:	eb e1                	jmp    802fec <strtol+0x48>
+        s += 2;
+  80300b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80300f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  803014:	eb d6                	jmp    802fec <strtol+0x48>
+            dig -= '0';
+  803016:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  803019:	44 0f b6 c1          	movzbl %cl,%r8d
+  80301d:	41 39 d0             	cmp    %edx,%r8d
+  803020:	7d 21                	jge    803043 <strtol+0x9f>
+        val = val * base + dig;
+  803022:	49 0f af c1          	imul   %r9,%rax
+  803026:	0f b6 c9             	movzbl %cl,%ecx
+  803029:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80302c:	48 83 c7 01          	add    $0x1,%rdi
+  803030:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  803034:	80 f9 39             	cmp    $0x39,%cl
+  803037:	76 dd                	jbe    803016 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  803039:	80 f9 7b             	cmp    $0x7b,%cl
+  80303c:	77 05                	ja     803043 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80303e:	83 e9 57             	sub    $0x57,%ecx
+  803041:	eb d6                	jmp    803019 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  803043:	4d 85 d2             	test   %r10,%r10
+  803046:	74 03                	je     80304b <strtol+0xa7>
+  803048:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80304b:	48 89 c2             	mov    %rax,%rdx
+  80304e:	48 f7 da             	neg    %rdx
+  803051:	40 80 fe 2d          	cmp    $0x2d,%sil
+  803055:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  803059:	c3                   	ret
+
+000000000080305a <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80305a:	55                   	push   %rbp
+  80305b:	48 89 e5             	mov    %rsp,%rbp
+  80305e:	53                   	push   %rbx
+  80305f:	48 89 fa             	mov    %rdi,%rdx
+  803062:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803065:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80306a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803074:	be 00 00 00 00       	mov    $0x0,%esi
+  803079:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80307f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803085:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  803087:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80308b:	c9                   	leave
+  80308c:	c3                   	ret
+
+000000000080308d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80308d:	55                   	push   %rbp
+  80308e:	48 89 e5             	mov    %rsp,%rbp
+  803091:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803092:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030a6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030bc:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c2:	c9                   	leave
+  8030c3:	c3                   	ret
+
+00000000008030c4 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8030c4:	55                   	push   %rbp
+  8030c5:	48 89 e5             	mov    %rsp,%rbp
+  8030c8:	53                   	push   %rbx
+  8030c9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030cc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030db:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030f1:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8030f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030f7:	c9                   	leave
+  8030f8:	c3                   	ret
+
+00000000008030f9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8030f9:	55                   	push   %rbp
+  8030fa:	48 89 e5             	mov    %rsp,%rbp
+  8030fd:	53                   	push   %rbx
+  8030fe:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  803102:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803105:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80310a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80310f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803114:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803119:	be 00 00 00 00       	mov    $0x0,%esi
+  80311e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803124:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80312a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80312c:	48 85 c0             	test   %rax,%rax
+  80312f:	7f 06                	jg     803137 <sys_env_destroy+0x3e>
+}
+  803131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803135:	c9                   	leave
+  803136:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803137:	49 89 c0             	mov    %rax,%r8
+  80313a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80313f:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  803146:	00 00 00 
+  803149:	be 27 00 00 00       	mov    $0x27,%esi
+  80314e:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  803155:	00 00 00 
+  803158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315d:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  803164:	00 00 00 
+  803167:	41 ff d1             	call   *%r9
+
+000000000080316a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80316a:	55                   	push   %rbp
+  80316b:	48 89 e5             	mov    %rsp,%rbp
+  80316e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80316f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803174:	ba 00 00 00 00       	mov    $0x0,%edx
+  803179:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80317e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803183:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803188:	be 00 00 00 00       	mov    $0x0,%esi
+  80318d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803193:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803199:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80319b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80319f:	c9                   	leave
+  8031a0:	c3                   	ret
+
+00000000008031a1 <sys_yield>:
+
+void
+sys_yield(void) {
+  8031a1:	55                   	push   %rbp
+  8031a2:	48 89 e5             	mov    %rsp,%rbp
+  8031a5:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8031a6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8031ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8031b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031ba:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8031c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031d0:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8031d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031d6:	c9                   	leave
+  8031d7:	c3                   	ret
+
+00000000008031d8 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8031d8:	55                   	push   %rbp
+  8031d9:	48 89 e5             	mov    %rsp,%rbp
+  8031dc:	53                   	push   %rbx
+  8031dd:	48 89 fa             	mov    %rdi,%rdx
+  8031e0:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8031e3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8031e8:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8031ef:	00 00 00 
+  8031f2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803202:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803208:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  80320a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80320e:	c9                   	leave
+  80320f:	c3                   	ret
+
+0000000000803210 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  803210:	55                   	push   %rbp
+  803211:	48 89 e5             	mov    %rsp,%rbp
+  803214:	53                   	push   %rbx
+  803215:	49 89 f8             	mov    %rdi,%r8
+  803218:	48 89 d3             	mov    %rdx,%rbx
+  80321b:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80321e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803223:	4c 89 c2             	mov    %r8,%rdx
+  803226:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803229:	be 00 00 00 00       	mov    $0x0,%esi
+  80322e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803234:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80323a:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  80323c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803240:	c9                   	leave
+  803241:	c3                   	ret
+
+0000000000803242 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  803242:	55                   	push   %rbp
+  803243:	48 89 e5             	mov    %rsp,%rbp
+  803246:	53                   	push   %rbx
+  803247:	48 83 ec 08          	sub    $0x8,%rsp
+  80324b:	89 f8                	mov    %edi,%eax
+  80324d:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  803250:	48 63 f9             	movslq %ecx,%rdi
+  803253:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803256:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80325b:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80325e:	be 00 00 00 00       	mov    $0x0,%esi
+  803263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803269:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80326f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803271:	48 85 c0             	test   %rax,%rax
+  803274:	7f 06                	jg     80327c <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  803276:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80327a:	c9                   	leave
+  80327b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80327c:	49 89 c0             	mov    %rax,%r8
+  80327f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  803284:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  80328b:	00 00 00 
+  80328e:	be 27 00 00 00       	mov    $0x27,%esi
+  803293:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  80329a:	00 00 00 
+  80329d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032a2:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8032a9:	00 00 00 
+  8032ac:	41 ff d1             	call   *%r9
+
+00000000008032af <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8032af:	55                   	push   %rbp
+  8032b0:	48 89 e5             	mov    %rsp,%rbp
+  8032b3:	53                   	push   %rbx
+  8032b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8032b8:	89 f8                	mov    %edi,%eax
+  8032ba:	49 89 f2             	mov    %rsi,%r10
+  8032bd:	48 89 cf             	mov    %rcx,%rdi
+  8032c0:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  8032c3:	48 63 da             	movslq %edx,%rbx
+  8032c6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032c9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032ce:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032d1:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  8032d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032da:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8032dc:	48 85 c0             	test   %rax,%rax
+  8032df:	7f 06                	jg     8032e7 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8032e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e5:	c9                   	leave
+  8032e6:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8032e7:	49 89 c0             	mov    %rax,%r8
+  8032ea:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8032ef:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  8032f6:	00 00 00 
+  8032f9:	be 27 00 00 00       	mov    $0x27,%esi
+  8032fe:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  803305:	00 00 00 
+  803308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330d:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  803314:	00 00 00 
+  803317:	41 ff d1             	call   *%r9
+
+000000000080331a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80331a:	55                   	push   %rbp
+  80331b:	48 89 e5             	mov    %rsp,%rbp
+  80331e:	53                   	push   %rbx
+  80331f:	48 83 ec 08          	sub    $0x8,%rsp
+  803323:	48 89 f1             	mov    %rsi,%rcx
+  803326:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  803329:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80332c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803331:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803336:	be 00 00 00 00       	mov    $0x0,%esi
+  80333b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803341:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803347:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803349:	48 85 c0             	test   %rax,%rax
+  80334c:	7f 06                	jg     803354 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80334e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803354:	49 89 c0             	mov    %rax,%r8
+  803357:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80335c:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  803363:	00 00 00 
+  803366:	be 27 00 00 00       	mov    $0x27,%esi
+  80336b:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  803372:	00 00 00 
+  803375:	b8 00 00 00 00       	mov    $0x0,%eax
+  80337a:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  803381:	00 00 00 
+  803384:	41 ff d1             	call   *%r9
+
+0000000000803387 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  803387:	55                   	push   %rbp
+  803388:	48 89 e5             	mov    %rsp,%rbp
+  80338b:	53                   	push   %rbx
+  80338c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  803390:	48 63 ce             	movslq %esi,%rcx
+  803393:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803396:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80339b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8033b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8033b6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8033b8:	48 85 c0             	test   %rax,%rax
+  8033bb:	7f 06                	jg     8033c3 <sys_env_set_status+0x3c>
+}
+  8033bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c1:	c9                   	leave
+  8033c2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8033c3:	49 89 c0             	mov    %rax,%r8
+  8033c6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8033cb:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  8033d2:	00 00 00 
+  8033d5:	be 27 00 00 00       	mov    $0x27,%esi
+  8033da:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  8033e1:	00 00 00 
+  8033e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e9:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8033f0:	00 00 00 
+  8033f3:	41 ff d1             	call   *%r9
+
+00000000008033f6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8033f6:	55                   	push   %rbp
+  8033f7:	48 89 e5             	mov    %rsp,%rbp
+  8033fa:	53                   	push   %rbx
+  8033fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ff:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  803402:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803405:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80340a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80340f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803414:	be 00 00 00 00       	mov    $0x0,%esi
+  803419:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80341f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803425:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803427:	48 85 c0             	test   %rax,%rax
+  80342a:	7f 06                	jg     803432 <sys_env_set_trapframe+0x3c>
+}
+  80342c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803430:	c9                   	leave
+  803431:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803432:	49 89 c0             	mov    %rax,%r8
+  803435:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80343a:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  803441:	00 00 00 
+  803444:	be 27 00 00 00       	mov    $0x27,%esi
+  803449:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  803450:	00 00 00 
+  803453:	b8 00 00 00 00       	mov    $0x0,%eax
+  803458:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  80345f:	00 00 00 
+  803462:	41 ff d1             	call   *%r9
+
+0000000000803465 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803465:	55                   	push   %rbp
+  803466:	48 89 e5             	mov    %rsp,%rbp
+  803469:	53                   	push   %rbx
+  80346a:	48 83 ec 08          	sub    $0x8,%rsp
+  80346e:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  803471:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803474:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803479:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80347e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803483:	be 00 00 00 00       	mov    $0x0,%esi
+  803488:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80348e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803494:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803496:	48 85 c0             	test   %rax,%rax
+  803499:	7f 06                	jg     8034a1 <sys_env_set_pgfault_upcall+0x3c>
+}
+  80349b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80349f:	c9                   	leave
+  8034a0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8034a1:	49 89 c0             	mov    %rax,%r8
+  8034a4:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8034a9:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  8034b0:	00 00 00 
+  8034b3:	be 27 00 00 00       	mov    $0x27,%esi
+  8034b8:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  8034bf:	00 00 00 
+  8034c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c7:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8034ce:	00 00 00 
+  8034d1:	41 ff d1             	call   *%r9
+
+00000000008034d4 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8034d4:	55                   	push   %rbp
+  8034d5:	48 89 e5             	mov    %rsp,%rbp
+  8034d8:	53                   	push   %rbx
+  8034d9:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8034dd:	40 0f b6 ce          	movzbl %sil,%ecx
+  8034e1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8034e4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8034e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034ee:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8034f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8034fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803504:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803506:	48 85 c0             	test   %rax,%rax
+  803509:	7f 06                	jg     803511 <sys_env_set_reclaim+0x3d>
+}
+  80350b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80350f:	c9                   	leave
+  803510:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803511:	49 89 c0             	mov    %rax,%r8
+  803514:	b9 16 00 00 00       	mov    $0x16,%ecx
+  803519:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  803520:	00 00 00 
+  803523:	be 27 00 00 00       	mov    $0x27,%esi
+  803528:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  80352f:	00 00 00 
+  803532:	b8 00 00 00 00       	mov    $0x0,%eax
+  803537:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  80353e:	00 00 00 
+  803541:	41 ff d1             	call   *%r9
+
+0000000000803544 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803544:	55                   	push   %rbp
+  803545:	48 89 e5             	mov    %rsp,%rbp
+  803548:	53                   	push   %rbx
+  803549:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  80354d:	48 63 ce             	movslq %esi,%rcx
+  803550:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803553:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803558:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80355d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803562:	be 00 00 00 00       	mov    $0x0,%esi
+  803567:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80356d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803573:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803575:	48 85 c0             	test   %rax,%rax
+  803578:	7f 06                	jg     803580 <sys_env_set_nice+0x3c>
+}
+  80357a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80357e:	c9                   	leave
+  80357f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803580:	49 89 c0             	mov    %rax,%r8
+  803583:	b9 18 00 00 00       	mov    $0x18,%ecx
+  803588:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  80358f:	00 00 00 
+  803592:	be 27 00 00 00       	mov    $0x27,%esi
+  803597:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  80359e:	00 00 00 
+  8035a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a6:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8035ad:	00 00 00 
+  8035b0:	41 ff d1             	call   *%r9
+
+00000000008035b3 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  8035b3:	55                   	push   %rbp
+  8035b4:	48 89 e5             	mov    %rsp,%rbp
+  8035b7:	53                   	push   %rbx
+  8035b8:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8035bb:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8035c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8035c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035ca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8035cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8035da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8035e0:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  8035e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035e6:	c9                   	leave
+  8035e7:	c3                   	ret
+
+00000000008035e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8035e8:	55                   	push   %rbp
+  8035e9:	48 89 e5             	mov    %rsp,%rbp
+  8035ec:	53                   	push   %rbx
+  8035ed:	89 f8                	mov    %edi,%eax
+  8035ef:	49 89 f1             	mov    %rsi,%r9
+  8035f2:	48 89 d3             	mov    %rdx,%rbx
+  8035f5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8035f8:	49 63 f0             	movslq %r8d,%rsi
+  8035fb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8035fe:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803603:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80360c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803612:	cd 30                	int    $0x30
+}
+  803614:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803618:	c9                   	leave
+  803619:	c3                   	ret
+
+000000000080361a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80361a:	55                   	push   %rbp
+  80361b:	48 89 e5             	mov    %rsp,%rbp
+  80361e:	53                   	push   %rbx
+  80361f:	89 f8                	mov    %edi,%eax
+  803621:	49 89 f1             	mov    %rsi,%r9
+  803624:	48 89 d3             	mov    %rdx,%rbx
+  803627:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  80362a:	49 63 f0             	movslq %r8d,%rsi
+  80362d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803630:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803635:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803638:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80363e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803644:	cd 30                	int    $0x30
+}
+  803646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80364a:	c9                   	leave
+  80364b:	c3                   	ret
+
+000000000080364c <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80364c:	55                   	push   %rbp
+  80364d:	48 89 e5             	mov    %rsp,%rbp
+  803650:	53                   	push   %rbx
+  803651:	48 83 ec 08          	sub    $0x8,%rsp
+  803655:	89 f8                	mov    %edi,%eax
+  803657:	49 89 f2             	mov    %rsi,%r10
+  80365a:	48 89 d3             	mov    %rdx,%rbx
+  80365d:	48 89 cf             	mov    %rcx,%rdi
+  803660:	44 89 c6             	mov    %r8d,%esi
+  803663:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803666:	48 63 f6             	movslq %esi,%rsi
+  803669:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80366c:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803671:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803674:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803678:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80367a:	48 85 c0             	test   %rax,%rax
+  80367d:	7f 06                	jg     803685 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80367f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803683:	c9                   	leave
+  803684:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803685:	49 89 c0             	mov    %rax,%r8
+  803688:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80368d:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  803694:	00 00 00 
+  803697:	be 27 00 00 00       	mov    $0x27,%esi
+  80369c:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  8036a3:	00 00 00 
+  8036a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ab:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8036b2:	00 00 00 
+  8036b5:	41 ff d1             	call   *%r9
+
+00000000008036b8 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  8036b8:	55                   	push   %rbp
+  8036b9:	48 89 e5             	mov    %rsp,%rbp
+  8036bc:	53                   	push   %rbx
+  8036bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8036c1:	48 89 f1             	mov    %rsi,%rcx
+  8036c4:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  8036c7:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  8036cb:	48 8b 1a             	mov    (%rdx),%rbx
+  8036ce:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8036d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8036d6:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8036da:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  8036de:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  8036e2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8036e4:	48 85 c0             	test   %rax,%rax
+  8036e7:	7f 06                	jg     8036ef <sys_ipc_call_short+0x37>
+}
+  8036e9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ed:	c9                   	leave
+  8036ee:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8036ef:	49 89 c0             	mov    %rax,%r8
+  8036f2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8036f7:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  8036fe:	00 00 00 
+  803701:	be 27 00 00 00       	mov    $0x27,%esi
+  803706:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  80370d:	00 00 00 
+  803710:	b8 00 00 00 00       	mov    $0x0,%eax
+  803715:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  80371c:	00 00 00 
+  80371f:	41 ff d1             	call   *%r9
+
+0000000000803722 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803722:	55                   	push   %rbp
+  803723:	48 89 e5             	mov    %rsp,%rbp
+  803726:	53                   	push   %rbx
+  803727:	48 83 ec 08          	sub    $0x8,%rsp
+  80372b:	89 f8                	mov    %edi,%eax
+  80372d:	49 89 f2             	mov    %rsi,%r10
+  803730:	48 89 d3             	mov    %rdx,%rbx
+  803733:	48 89 cf             	mov    %rcx,%rdi
+  803736:	44 89 c6             	mov    %r8d,%esi
+  803739:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  80373c:	48 63 f6             	movslq %esi,%rsi
+  80373f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803742:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803747:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  80374a:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  80374e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803750:	48 85 c0             	test   %rax,%rax
+  803753:	7f 06                	jg     80375b <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803755:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803759:	c9                   	leave
+  80375a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80375b:	49 89 c0             	mov    %rax,%r8
+  80375e:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803763:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  80376a:	00 00 00 
+  80376d:	be 27 00 00 00       	mov    $0x27,%esi
+  803772:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  803779:	00 00 00 
+  80377c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803781:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  803788:	00 00 00 
+  80378b:	41 ff d1             	call   *%r9
+
+000000000080378e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80378e:	55                   	push   %rbp
+  80378f:	48 89 e5             	mov    %rsp,%rbp
+  803792:	53                   	push   %rbx
+  803793:	48 83 ec 08          	sub    $0x8,%rsp
+  803797:	48 89 fa             	mov    %rdi,%rdx
+  80379a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80379d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8037a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8037ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8037b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8037bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8037bf:	48 85 c0             	test   %rax,%rax
+  8037c2:	7f 06                	jg     8037ca <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8037c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037c8:	c9                   	leave
+  8037c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8037ca:	49 89 c0             	mov    %rax,%r8
+  8037cd:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8037d2:	48 ba a8 6f 80 00 00 	movabs $0x806fa8,%rdx
+  8037d9:	00 00 00 
+  8037dc:	be 27 00 00 00       	mov    $0x27,%esi
+  8037e1:	48 bf c7 6f 80 00 00 	movabs $0x806fc7,%rdi
+  8037e8:	00 00 00 
+  8037eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f0:	49 b9 56 20 80 00 00 	movabs $0x802056,%r9
+  8037f7:	00 00 00 
+  8037fa:	41 ff d1             	call   *%r9
+
+00000000008037fd <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8037fd:	55                   	push   %rbp
+  8037fe:	48 89 e5             	mov    %rsp,%rbp
+  803801:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803802:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803807:	ba 00 00 00 00       	mov    $0x0,%edx
+  80380c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803816:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80381b:	be 00 00 00 00       	mov    $0x0,%esi
+  803820:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803826:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80382c:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80382e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803832:	c9                   	leave
+  803833:	c3                   	ret
+
+0000000000803834 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803834:	55                   	push   %rbp
+  803835:	48 89 e5             	mov    %rsp,%rbp
+  803838:	53                   	push   %rbx
+  803839:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80383c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803841:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80384b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803850:	be 00 00 00 00       	mov    $0x0,%esi
+  803855:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80385b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803861:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803863:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803867:	c9                   	leave
+  803868:	c3                   	ret
+
+0000000000803869 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80386e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803873:	ba 00 00 00 00       	mov    $0x0,%edx
+  803878:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80387d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803882:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803887:	be 00 00 00 00       	mov    $0x0,%esi
+  80388c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803892:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803898:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80389a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80389e:	c9                   	leave
+  80389f:	c3                   	ret
+
+00000000008038a0 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8038a0:	85 ff                	test   %edi,%edi
+  8038a2:	78 58                	js     8038fc <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8038a4:	48 85 f6             	test   %rsi,%rsi
+  8038a7:	74 12                	je     8038bb <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8038a9:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8038b0:	00 00 00 
+  8038b3:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8038b9:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8038bb:	48 85 c9             	test   %rcx,%rcx
+  8038be:	74 12                	je     8038d2 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8038c0:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8038c7:	00 00 00 
+  8038ca:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8038d0:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8038d2:	48 85 d2             	test   %rdx,%rdx
+  8038d5:	74 14                	je     8038eb <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8038d7:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8038de:	00 00 00 
+  8038e1:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8038e8:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8038eb:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8038f2:	00 00 00 
+  8038f5:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8038fb:	c3                   	ret
+        if (from_env_store) {
+  8038fc:	48 85 f6             	test   %rsi,%rsi
+  8038ff:	74 06                	je     803907 <ipc_result+0x67>
+            *from_env_store = 0;
+  803901:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  803907:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  803909:	48 85 c9             	test   %rcx,%rcx
+  80390c:	74 ed                	je     8038fb <ipc_result+0x5b>
+            *perm_store = 0;
+  80390e:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  803914:	c3                   	ret
+
+0000000000803915 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803915:	55                   	push   %rbp
+  803916:	48 89 e5             	mov    %rsp,%rbp
+  803919:	41 55                	push   %r13
+  80391b:	41 54                	push   %r12
+  80391d:	53                   	push   %rbx
+  80391e:	48 83 ec 08          	sub    $0x8,%rsp
+  803922:	49 89 fc             	mov    %rdi,%r12
+  803925:	48 89 f7             	mov    %rsi,%rdi
+  803928:	48 89 d3             	mov    %rdx,%rbx
+  80392b:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80392e:	48 85 f6             	test   %rsi,%rsi
+  803931:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803938:	00 00 00 
+  80393b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80393f:	be 00 00 00 00       	mov    $0x0,%esi
+  803944:	48 85 d2             	test   %rdx,%rdx
+  803947:	74 03                	je     80394c <ipc_recv+0x37>
+  803949:	48 8b 32             	mov    (%rdx),%rsi
+  80394c:	48 b8 8e 37 80 00 00 	movabs $0x80378e,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+  803958:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80395a:	4c 89 e9             	mov    %r13,%rcx
+  80395d:	48 89 da             	mov    %rbx,%rdx
+  803960:	4c 89 e6             	mov    %r12,%rsi
+  803963:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  80396a:	00 00 00 
+  80396d:	ff d0                	call   *%rax
+}
+  80396f:	48 83 c4 08          	add    $0x8,%rsp
+  803973:	5b                   	pop    %rbx
+  803974:	41 5c                	pop    %r12
+  803976:	41 5d                	pop    %r13
+  803978:	5d                   	pop    %rbp
+  803979:	c3                   	ret
+
+000000000080397a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80397a:	55                   	push   %rbp
+  80397b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80397e:	48 85 d2             	test   %rdx,%rdx
+  803981:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803988:	00 00 00 
+  80398b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80398f:	89 f6                	mov    %esi,%esi
+  803991:	48 b8 1a 36 80 00 00 	movabs $0x80361a,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80399d:	85 c0                	test   %eax,%eax
+  80399f:	78 02                	js     8039a3 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8039a1:	5d                   	pop    %rbp
+  8039a2:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8039a3:	89 c1                	mov    %eax,%ecx
+  8039a5:	48 ba d5 6f 80 00 00 	movabs $0x806fd5,%rdx
+  8039ac:	00 00 00 
+  8039af:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8039b4:	48 bf e2 6f 80 00 00 	movabs $0x806fe2,%rdi
+  8039bb:	00 00 00 
+  8039be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039c3:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  8039ca:	00 00 00 
+  8039cd:	41 ff d0             	call   *%r8
+
+00000000008039d0 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8039d0:	55                   	push   %rbp
+  8039d1:	48 89 e5             	mov    %rsp,%rbp
+  8039d4:	53                   	push   %rbx
+  8039d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8039d9:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8039dd:	48 85 d2             	test   %rdx,%rdx
+  8039e0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8039e7:	00 00 00 
+  8039ea:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8039ee:	4d 85 c9             	test   %r9,%r9
+  8039f1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8039f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039fa:	48 85 db             	test   %rbx,%rbx
+  8039fd:	74 03                	je     803a02 <ipc_call+0x32>
+  8039ff:	48 8b 03             	mov    (%rbx),%rax
+  803a02:	89 f6                	mov    %esi,%esi
+  803a04:	48 83 ec 08          	sub    $0x8,%rsp
+  803a08:	50                   	push   %rax
+  803a09:	48 b8 4c 36 80 00 00 	movabs $0x80364c,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  803a17:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  803a1b:	48 89 da             	mov    %rbx,%rdx
+  803a1e:	be 00 00 00 00       	mov    $0x0,%esi
+  803a23:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+}
+  803a2f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a33:	c9                   	leave
+  803a34:	c3                   	ret
+
+0000000000803a35 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  803a35:	55                   	push   %rbp
+  803a36:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  803a39:	89 f6                	mov    %esi,%esi
+  803a3b:	48 b8 b8 36 80 00 00 	movabs $0x8036b8,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+  803a47:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  803a49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a53:	be 00 00 00 00       	mov    $0x0,%esi
+  803a58:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803a5f:	00 00 00 
+  803a62:	ff d0                	call   *%rax
+}
+  803a64:	5d                   	pop    %rbp
+  803a65:	c3                   	ret
+
+0000000000803a66 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+  803a6a:	41 54                	push   %r12
+  803a6c:	53                   	push   %rbx
+  803a6d:	4c 89 cb             	mov    %r9,%rbx
+  803a70:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  803a74:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  803a78:	48 85 d2             	test   %rdx,%rdx
+  803a7b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803a82:	00 00 00 
+  803a85:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  803a89:	4d 85 c9             	test   %r9,%r9
+  803a8c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803a90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a95:	4d 85 e4             	test   %r12,%r12
+  803a98:	74 04                	je     803a9e <ipc_reply_wait+0x38>
+  803a9a:	49 8b 04 24          	mov    (%r12),%rax
+  803a9e:	89 f6                	mov    %esi,%esi
+  803aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  803aa4:	50                   	push   %rax
+  803aa5:	48 b8 22 37 80 00 00 	movabs $0x803722,%rax
+  803aac:	00 00 00 
+  803aaf:	ff d0                	call   *%rax
+  803ab1:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  803ab3:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  803ab7:	4c 89 e2             	mov    %r12,%rdx
+  803aba:	48 89 de             	mov    %rbx,%rsi
+  803abd:	48 b8 a0 38 80 00 00 	movabs $0x8038a0,%rax
+  803ac4:	00 00 00 
+  803ac7:	ff d0                	call   *%rax
+}
+  803ac9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803acd:	5b                   	pop    %rbx
+  803ace:	41 5c                	pop    %r12
+  803ad0:	5d                   	pop    %rbp
+  803ad1:	c3                   	ret
+
+0000000000803ad2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803ad7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  803ade:	00 00 00 
+  803ae1:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  803ae8:	48 01 ca             	add    %rcx,%rdx
+  803aeb:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  803af1:	39 fa                	cmp    %edi,%edx
+  803af3:	74 12                	je     803b07 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803af5:	48 83 c0 01          	add    $0x1,%rax
+  803af9:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  803aff:	75 e0                	jne    803ae1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803b01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b06:	c3                   	ret
+            return envs[i].env_id;
+  803b07:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803b0e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803b15:	00 00 00 
+  803b18:	48 01 d0             	add    %rdx,%rax
+  803b1b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803b21:	c3                   	ret
+
+0000000000803b22 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803b22:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803b29:	ff ff ff 
+  803b2c:	48 01 f8             	add    %rdi,%rax
+  803b2f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803b33:	c3                   	ret
+
+0000000000803b34 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803b34:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803b3b:	ff ff ff 
+  803b3e:	48 01 f8             	add    %rdi,%rax
+  803b41:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803b45:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803b4b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803b4f:	c3                   	ret
+
+0000000000803b50 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803b50:	55                   	push   %rbp
+  803b51:	48 89 e5             	mov    %rsp,%rbp
+  803b54:	41 57                	push   %r15
+  803b56:	41 56                	push   %r14
+  803b58:	41 55                	push   %r13
+  803b5a:	41 54                	push   %r12
+  803b5c:	53                   	push   %rbx
+  803b5d:	48 83 ec 08          	sub    $0x8,%rsp
+  803b61:	49 89 ff             	mov    %rdi,%r15
+  803b64:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803b69:	49 bd 50 50 80 00 00 	movabs $0x805050,%r13
+  803b70:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803b73:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803b79:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803b7c:	48 89 df             	mov    %rbx,%rdi
+  803b7f:	41 ff d5             	call   *%r13
+  803b82:	83 e0 04             	and    $0x4,%eax
+  803b85:	74 17                	je     803b9e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803b87:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803b8e:	4c 39 f3             	cmp    %r14,%rbx
+  803b91:	75 e6                	jne    803b79 <fd_alloc+0x29>
+  803b93:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803b99:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803b9e:	4d 89 27             	mov    %r12,(%r15)
+}
+  803ba1:	48 83 c4 08          	add    $0x8,%rsp
+  803ba5:	5b                   	pop    %rbx
+  803ba6:	41 5c                	pop    %r12
+  803ba8:	41 5d                	pop    %r13
+  803baa:	41 5e                	pop    %r14
+  803bac:	41 5f                	pop    %r15
+  803bae:	5d                   	pop    %rbp
+  803baf:	c3                   	ret
+
+0000000000803bb0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803bb0:	83 ff 1f             	cmp    $0x1f,%edi
+  803bb3:	77 39                	ja     803bee <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803bb5:	55                   	push   %rbp
+  803bb6:	48 89 e5             	mov    %rsp,%rbp
+  803bb9:	41 54                	push   %r12
+  803bbb:	53                   	push   %rbx
+  803bbc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803bbf:	48 63 df             	movslq %edi,%rbx
+  803bc2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803bc9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803bcd:	48 89 df             	mov    %rbx,%rdi
+  803bd0:	48 b8 50 50 80 00 00 	movabs $0x805050,%rax
+  803bd7:	00 00 00 
+  803bda:	ff d0                	call   *%rax
+  803bdc:	a8 04                	test   $0x4,%al
+  803bde:	74 14                	je     803bf4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803be0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803be4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be9:	5b                   	pop    %rbx
+  803bea:	41 5c                	pop    %r12
+  803bec:	5d                   	pop    %rbp
+  803bed:	c3                   	ret
+        return -E_INVAL;
+  803bee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803bf3:	c3                   	ret
+        return -E_INVAL;
+  803bf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bf9:	eb ee                	jmp    803be9 <fd_lookup+0x39>
+
+0000000000803bfb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+  803bff:	41 54                	push   %r12
+  803c01:	53                   	push   %rbx
+  803c02:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803c05:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803c0c:	00 00 00 
+  803c0f:	48 bb 60 80 80 00 00 	movabs $0x808060,%rbx
+  803c16:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803c19:	39 3b                	cmp    %edi,(%rbx)
+  803c1b:	74 47                	je     803c64 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803c1d:	48 83 c0 08          	add    $0x8,%rax
+  803c21:	48 8b 18             	mov    (%rax),%rbx
+  803c24:	48 85 db             	test   %rbx,%rbx
+  803c27:	75 f0                	jne    803c19 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803c29:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803c30:	00 00 00 
+  803c33:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803c39:	89 fa                	mov    %edi,%edx
+  803c3b:	48 bf f0 6f 80 00 00 	movabs $0x806ff0,%rdi
+  803c42:	00 00 00 
+  803c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4a:	48 b9 a6 21 80 00 00 	movabs $0x8021a6,%rcx
+  803c51:	00 00 00 
+  803c54:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803c56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803c5b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803c5f:	5b                   	pop    %rbx
+  803c60:	41 5c                	pop    %r12
+  803c62:	5d                   	pop    %rbp
+  803c63:	c3                   	ret
+            return 0;
+  803c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c69:	eb f0                	jmp    803c5b <dev_lookup+0x60>
+
+0000000000803c6b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803c6b:	55                   	push   %rbp
+  803c6c:	48 89 e5             	mov    %rsp,%rbp
+  803c6f:	41 55                	push   %r13
+  803c71:	41 54                	push   %r12
+  803c73:	53                   	push   %rbx
+  803c74:	48 83 ec 18          	sub    $0x18,%rsp
+  803c78:	48 89 fb             	mov    %rdi,%rbx
+  803c7b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803c7e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803c85:	ff ff ff 
+  803c88:	48 01 df             	add    %rbx,%rdi
+  803c8b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803c8f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803c93:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803c9a:	00 00 00 
+  803c9d:	ff d0                	call   *%rax
+  803c9f:	41 89 c5             	mov    %eax,%r13d
+  803ca2:	85 c0                	test   %eax,%eax
+  803ca4:	78 06                	js     803cac <fd_close+0x41>
+  803ca6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803caa:	74 1a                	je     803cc6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803cac:	45 84 e4             	test   %r12b,%r12b
+  803caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cb4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803cb8:	44 89 e8             	mov    %r13d,%eax
+  803cbb:	48 83 c4 18          	add    $0x18,%rsp
+  803cbf:	5b                   	pop    %rbx
+  803cc0:	41 5c                	pop    %r12
+  803cc2:	41 5d                	pop    %r13
+  803cc4:	5d                   	pop    %rbp
+  803cc5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803cc6:	8b 3b                	mov    (%rbx),%edi
+  803cc8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ccc:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+  803cd8:	41 89 c5             	mov    %eax,%r13d
+  803cdb:	85 c0                	test   %eax,%eax
+  803cdd:	78 1b                	js     803cfa <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803cdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ce3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803ce7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803ced:	48 85 c0             	test   %rax,%rax
+  803cf0:	74 08                	je     803cfa <fd_close+0x8f>
+  803cf2:	48 89 df             	mov    %rbx,%rdi
+  803cf5:	ff d0                	call   *%rax
+  803cf7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803cfa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cff:	48 89 de             	mov    %rbx,%rsi
+  803d02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d07:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  803d0e:	00 00 00 
+  803d11:	ff d0                	call   *%rax
+    return res;
+  803d13:	eb a3                	jmp    803cb8 <fd_close+0x4d>
+
+0000000000803d15 <close>:
+
+int
+close(int fdnum) {
+  803d15:	55                   	push   %rbp
+  803d16:	48 89 e5             	mov    %rsp,%rbp
+  803d19:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803d1d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d21:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803d28:	00 00 00 
+  803d2b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d2d:	85 c0                	test   %eax,%eax
+  803d2f:	78 15                	js     803d46 <close+0x31>
+
+    return fd_close(fd, 1);
+  803d31:	be 01 00 00 00       	mov    $0x1,%esi
+  803d36:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d3a:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+}
+  803d46:	c9                   	leave
+  803d47:	c3                   	ret
+
+0000000000803d48 <close_all>:
+
+void
+close_all(void) {
+  803d48:	55                   	push   %rbp
+  803d49:	48 89 e5             	mov    %rsp,%rbp
+  803d4c:	41 54                	push   %r12
+  803d4e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803d4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d54:	49 bc 15 3d 80 00 00 	movabs $0x803d15,%r12
+  803d5b:	00 00 00 
+  803d5e:	89 df                	mov    %ebx,%edi
+  803d60:	41 ff d4             	call   *%r12
+  803d63:	83 c3 01             	add    $0x1,%ebx
+  803d66:	83 fb 20             	cmp    $0x20,%ebx
+  803d69:	75 f3                	jne    803d5e <close_all+0x16>
+}
+  803d6b:	5b                   	pop    %rbx
+  803d6c:	41 5c                	pop    %r12
+  803d6e:	5d                   	pop    %rbp
+  803d6f:	c3                   	ret
+
+0000000000803d70 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803d70:	55                   	push   %rbp
+  803d71:	48 89 e5             	mov    %rsp,%rbp
+  803d74:	41 57                	push   %r15
+  803d76:	41 56                	push   %r14
+  803d78:	41 55                	push   %r13
+  803d7a:	41 54                	push   %r12
+  803d7c:	53                   	push   %rbx
+  803d7d:	48 83 ec 18          	sub    $0x18,%rsp
+  803d81:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803d84:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803d88:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803d8f:	00 00 00 
+  803d92:	ff d0                	call   *%rax
+  803d94:	89 c3                	mov    %eax,%ebx
+  803d96:	85 c0                	test   %eax,%eax
+  803d98:	0f 88 b8 00 00 00    	js     803e56 <dup+0xe6>
+    close(newfdnum);
+  803d9e:	44 89 e7             	mov    %r12d,%edi
+  803da1:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  803da8:	00 00 00 
+  803dab:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803dad:	4d 63 ec             	movslq %r12d,%r13
+  803db0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803db7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803dbb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803dbf:	4c 89 ff             	mov    %r15,%rdi
+  803dc2:	49 be 34 3b 80 00 00 	movabs $0x803b34,%r14
+  803dc9:	00 00 00 
+  803dcc:	41 ff d6             	call   *%r14
+  803dcf:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803dd2:	4c 89 ef             	mov    %r13,%rdi
+  803dd5:	41 ff d6             	call   *%r14
+  803dd8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803ddb:	48 89 df             	mov    %rbx,%rdi
+  803dde:	48 b8 50 50 80 00 00 	movabs $0x805050,%rax
+  803de5:	00 00 00 
+  803de8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803dea:	a8 04                	test   $0x4,%al
+  803dec:	74 2b                	je     803e19 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803dee:	41 89 c1             	mov    %eax,%r9d
+  803df1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803df7:	4c 89 f1             	mov    %r14,%rcx
+  803dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dff:	48 89 de             	mov    %rbx,%rsi
+  803e02:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e07:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  803e13:	89 c3                	mov    %eax,%ebx
+  803e15:	85 c0                	test   %eax,%eax
+  803e17:	78 4e                	js     803e67 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803e19:	4c 89 ff             	mov    %r15,%rdi
+  803e1c:	48 b8 50 50 80 00 00 	movabs $0x805050,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+  803e28:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803e2b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e31:	4c 89 e9             	mov    %r13,%rcx
+  803e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e39:	4c 89 fe             	mov    %r15,%rsi
+  803e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e41:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  803e48:	00 00 00 
+  803e4b:	ff d0                	call   *%rax
+  803e4d:	89 c3                	mov    %eax,%ebx
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	78 14                	js     803e67 <dup+0xf7>
+
+    return newfdnum;
+  803e53:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803e56:	89 d8                	mov    %ebx,%eax
+  803e58:	48 83 c4 18          	add    $0x18,%rsp
+  803e5c:	5b                   	pop    %rbx
+  803e5d:	41 5c                	pop    %r12
+  803e5f:	41 5d                	pop    %r13
+  803e61:	41 5e                	pop    %r14
+  803e63:	41 5f                	pop    %r15
+  803e65:	5d                   	pop    %rbp
+  803e66:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803e67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e6c:	4c 89 ee             	mov    %r13,%rsi
+  803e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e74:	49 bc 1a 33 80 00 00 	movabs $0x80331a,%r12
+  803e7b:	00 00 00 
+  803e7e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803e81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e86:	4c 89 f6             	mov    %r14,%rsi
+  803e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8e:	41 ff d4             	call   *%r12
+    return res;
+  803e91:	eb c3                	jmp    803e56 <dup+0xe6>
+
+0000000000803e93 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803e93:	55                   	push   %rbp
+  803e94:	48 89 e5             	mov    %rsp,%rbp
+  803e97:	41 56                	push   %r14
+  803e99:	41 55                	push   %r13
+  803e9b:	41 54                	push   %r12
+  803e9d:	53                   	push   %rbx
+  803e9e:	48 83 ec 10          	sub    $0x10,%rsp
+  803ea2:	89 fb                	mov    %edi,%ebx
+  803ea4:	49 89 f4             	mov    %rsi,%r12
+  803ea7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803eaa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803eae:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+  803eba:	85 c0                	test   %eax,%eax
+  803ebc:	78 4c                	js     803f0a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803ebe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803ec2:	41 8b 3e             	mov    (%r14),%edi
+  803ec5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ec9:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  803ed0:	00 00 00 
+  803ed3:	ff d0                	call   *%rax
+  803ed5:	85 c0                	test   %eax,%eax
+  803ed7:	78 35                	js     803f0e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803ed9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803edd:	83 e0 03             	and    $0x3,%eax
+  803ee0:	83 f8 01             	cmp    $0x1,%eax
+  803ee3:	74 2d                	je     803f12 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803ee5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ee9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803eed:	48 85 c0             	test   %rax,%rax
+  803ef0:	74 56                	je     803f48 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803ef2:	4c 89 ea             	mov    %r13,%rdx
+  803ef5:	4c 89 e6             	mov    %r12,%rsi
+  803ef8:	4c 89 f7             	mov    %r14,%rdi
+  803efb:	ff d0                	call   *%rax
+}
+  803efd:	48 83 c4 10          	add    $0x10,%rsp
+  803f01:	5b                   	pop    %rbx
+  803f02:	41 5c                	pop    %r12
+  803f04:	41 5d                	pop    %r13
+  803f06:	41 5e                	pop    %r14
+  803f08:	5d                   	pop    %rbp
+  803f09:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803f0a:	48 98                	cltq
+  803f0c:	eb ef                	jmp    803efd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803f0e:	48 98                	cltq
+  803f10:	eb eb                	jmp    803efd <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f12:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803f19:	00 00 00 
+  803f1c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803f22:	89 da                	mov    %ebx,%edx
+  803f24:	48 bf 31 70 80 00 00 	movabs $0x807031,%rdi
+  803f2b:	00 00 00 
+  803f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f33:	48 b9 a6 21 80 00 00 	movabs $0x8021a6,%rcx
+  803f3a:	00 00 00 
+  803f3d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803f3f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803f46:	eb b5                	jmp    803efd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803f48:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803f4f:	eb ac                	jmp    803efd <read+0x6a>
+
+0000000000803f51 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803f51:	55                   	push   %rbp
+  803f52:	48 89 e5             	mov    %rsp,%rbp
+  803f55:	41 57                	push   %r15
+  803f57:	41 56                	push   %r14
+  803f59:	41 55                	push   %r13
+  803f5b:	41 54                	push   %r12
+  803f5d:	53                   	push   %rbx
+  803f5e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803f62:	48 85 d2             	test   %rdx,%rdx
+  803f65:	74 54                	je     803fbb <readn+0x6a>
+  803f67:	41 89 fd             	mov    %edi,%r13d
+  803f6a:	49 89 f6             	mov    %rsi,%r14
+  803f6d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803f75:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803f7a:	49 bf 93 3e 80 00 00 	movabs $0x803e93,%r15
+  803f81:	00 00 00 
+  803f84:	4c 89 e2             	mov    %r12,%rdx
+  803f87:	48 29 f2             	sub    %rsi,%rdx
+  803f8a:	4c 01 f6             	add    %r14,%rsi
+  803f8d:	44 89 ef             	mov    %r13d,%edi
+  803f90:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803f93:	85 c0                	test   %eax,%eax
+  803f95:	78 20                	js     803fb7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803f97:	01 c3                	add    %eax,%ebx
+  803f99:	85 c0                	test   %eax,%eax
+  803f9b:	74 08                	je     803fa5 <readn+0x54>
+  803f9d:	48 63 f3             	movslq %ebx,%rsi
+  803fa0:	4c 39 e6             	cmp    %r12,%rsi
+  803fa3:	72 df                	jb     803f84 <readn+0x33>
+    }
+    return res;
+  803fa5:	48 63 c3             	movslq %ebx,%rax
+}
+  803fa8:	48 83 c4 08          	add    $0x8,%rsp
+  803fac:	5b                   	pop    %rbx
+  803fad:	41 5c                	pop    %r12
+  803faf:	41 5d                	pop    %r13
+  803fb1:	41 5e                	pop    %r14
+  803fb3:	41 5f                	pop    %r15
+  803fb5:	5d                   	pop    %rbp
+  803fb6:	c3                   	ret
+        if (inc < 0) return inc;
+  803fb7:	48 98                	cltq
+  803fb9:	eb ed                	jmp    803fa8 <readn+0x57>
+    int inc = 1, res = 0;
+  803fbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fc0:	eb e3                	jmp    803fa5 <readn+0x54>
+
+0000000000803fc2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803fc2:	55                   	push   %rbp
+  803fc3:	48 89 e5             	mov    %rsp,%rbp
+  803fc6:	41 56                	push   %r14
+  803fc8:	41 55                	push   %r13
+  803fca:	41 54                	push   %r12
+  803fcc:	53                   	push   %rbx
+  803fcd:	48 83 ec 10          	sub    $0x10,%rsp
+  803fd1:	89 fb                	mov    %edi,%ebx
+  803fd3:	49 89 f4             	mov    %rsi,%r12
+  803fd6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803fd9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fdd:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	85 c0                	test   %eax,%eax
+  803feb:	78 47                	js     804034 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803fed:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803ff1:	41 8b 3e             	mov    (%r14),%edi
+  803ff4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ff8:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  803fff:	00 00 00 
+  804002:	ff d0                	call   *%rax
+  804004:	85 c0                	test   %eax,%eax
+  804006:	78 30                	js     804038 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804008:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80400d:	74 2d                	je     80403c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80400f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804013:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804017:	48 85 c0             	test   %rax,%rax
+  80401a:	74 56                	je     804072 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80401c:	4c 89 ea             	mov    %r13,%rdx
+  80401f:	4c 89 e6             	mov    %r12,%rsi
+  804022:	4c 89 f7             	mov    %r14,%rdi
+  804025:	ff d0                	call   *%rax
+}
+  804027:	48 83 c4 10          	add    $0x10,%rsp
+  80402b:	5b                   	pop    %rbx
+  80402c:	41 5c                	pop    %r12
+  80402e:	41 5d                	pop    %r13
+  804030:	41 5e                	pop    %r14
+  804032:	5d                   	pop    %rbp
+  804033:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804034:	48 98                	cltq
+  804036:	eb ef                	jmp    804027 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804038:	48 98                	cltq
+  80403a:	eb eb                	jmp    804027 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80403c:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  804043:	00 00 00 
+  804046:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80404c:	89 da                	mov    %ebx,%edx
+  80404e:	48 bf 4d 70 80 00 00 	movabs $0x80704d,%rdi
+  804055:	00 00 00 
+  804058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80405d:	48 b9 a6 21 80 00 00 	movabs $0x8021a6,%rcx
+  804064:	00 00 00 
+  804067:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804069:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804070:	eb b5                	jmp    804027 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  804072:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  804079:	eb ac                	jmp    804027 <write+0x65>
+
+000000000080407b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80407b:	55                   	push   %rbp
+  80407c:	48 89 e5             	mov    %rsp,%rbp
+  80407f:	53                   	push   %rbx
+  804080:	48 83 ec 18          	sub    $0x18,%rsp
+  804084:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804086:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80408a:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  804091:	00 00 00 
+  804094:	ff d0                	call   *%rax
+  804096:	85 c0                	test   %eax,%eax
+  804098:	78 0c                	js     8040a6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  80409a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80409e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8040a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040aa:	c9                   	leave
+  8040ab:	c3                   	ret
+
+00000000008040ac <tell>:
+
+int tell(int fdnum) {
+  8040ac:	55                   	push   %rbp
+  8040ad:	48 89 e5             	mov    %rsp,%rbp
+  8040b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8040b4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040b8:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  8040bf:	00 00 00 
+  8040c2:	ff d0                	call   *%rax
+  8040c4:	85 c0                	test   %eax,%eax
+  8040c6:	78 07                	js     8040cf <tell+0x23>
+
+    return fd->fd_offset;
+  8040c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040cc:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8040cf:	c9                   	leave
+  8040d0:	c3                   	ret
+
+00000000008040d1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8040d1:	55                   	push   %rbp
+  8040d2:	48 89 e5             	mov    %rsp,%rbp
+  8040d5:	41 55                	push   %r13
+  8040d7:	41 54                	push   %r12
+  8040d9:	53                   	push   %rbx
+  8040da:	48 83 ec 18          	sub    $0x18,%rsp
+  8040de:	89 fb                	mov    %edi,%ebx
+  8040e0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8040e3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8040e7:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  8040ee:	00 00 00 
+  8040f1:	ff d0                	call   *%rax
+  8040f3:	85 c0                	test   %eax,%eax
+  8040f5:	78 38                	js     80412f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8040f7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8040fb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8040ff:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  804103:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  80410a:	00 00 00 
+  80410d:	ff d0                	call   *%rax
+  80410f:	85 c0                	test   %eax,%eax
+  804111:	78 1c                	js     80412f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  804113:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  804118:	74 20                	je     80413a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80411a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80411e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  804122:	48 85 c0             	test   %rax,%rax
+  804125:	74 47                	je     80416e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  804127:	44 89 e6             	mov    %r12d,%esi
+  80412a:	4c 89 ef             	mov    %r13,%rdi
+  80412d:	ff d0                	call   *%rax
+}
+  80412f:	48 83 c4 18          	add    $0x18,%rsp
+  804133:	5b                   	pop    %rbx
+  804134:	41 5c                	pop    %r12
+  804136:	41 5d                	pop    %r13
+  804138:	5d                   	pop    %rbp
+  804139:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80413a:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  804141:	00 00 00 
+  804144:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80414a:	89 da                	mov    %ebx,%edx
+  80414c:	48 bf 10 70 80 00 00 	movabs $0x807010,%rdi
+  804153:	00 00 00 
+  804156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415b:	48 b9 a6 21 80 00 00 	movabs $0x8021a6,%rcx
+  804162:	00 00 00 
+  804165:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  804167:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80416c:	eb c1                	jmp    80412f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80416e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804173:	eb ba                	jmp    80412f <ftruncate+0x5e>
+
+0000000000804175 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804175:	55                   	push   %rbp
+  804176:	48 89 e5             	mov    %rsp,%rbp
+  804179:	41 54                	push   %r12
+  80417b:	53                   	push   %rbx
+  80417c:	48 83 ec 10          	sub    $0x10,%rsp
+  804180:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804183:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804187:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  80418e:	00 00 00 
+  804191:	ff d0                	call   *%rax
+  804193:	85 c0                	test   %eax,%eax
+  804195:	78 63                	js     8041fa <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  804197:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80419b:	41 8b 3c 24          	mov    (%r12),%edi
+  80419f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8041a3:	48 b8 fb 3b 80 00 00 	movabs $0x803bfb,%rax
+  8041aa:	00 00 00 
+  8041ad:	ff d0                	call   *%rax
+  8041af:	85 c0                	test   %eax,%eax
+  8041b1:	78 47                	js     8041fa <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8041b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041b7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8041bc:	74 45                	je     804203 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8041be:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8041c1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8041c8:	00 00 00 
+    stat->st_isdir = 0;
+  8041cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8041d2:	00 00 00 
+    stat->st_ino = 0;
+  8041d5:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8041dc:	00 00 00 00 
+    stat->st_version = 0;
+  8041e0:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8041e7:	00 00 00 
+    stat->st_dev = dev;
+  8041ea:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8041f1:	48 89 de             	mov    %rbx,%rsi
+  8041f4:	4c 89 e7             	mov    %r12,%rdi
+  8041f7:	ff 50 28             	call   *0x28(%rax)
+}
+  8041fa:	48 83 c4 10          	add    $0x10,%rsp
+  8041fe:	5b                   	pop    %rbx
+  8041ff:	41 5c                	pop    %r12
+  804201:	5d                   	pop    %rbp
+  804202:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  804203:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804208:	eb f0                	jmp    8041fa <fstat+0x85>
+
+000000000080420a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80420a:	55                   	push   %rbp
+  80420b:	48 89 e5             	mov    %rsp,%rbp
+  80420e:	41 54                	push   %r12
+  804210:	53                   	push   %rbx
+  804211:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  804214:	be 00 00 00 00       	mov    $0x0,%esi
+  804219:	48 b8 2b 47 80 00 00 	movabs $0x80472b,%rax
+  804220:	00 00 00 
+  804223:	ff d0                	call   *%rax
+  804225:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  804227:	85 c0                	test   %eax,%eax
+  804229:	78 25                	js     804250 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80422b:	4c 89 e6             	mov    %r12,%rsi
+  80422e:	89 c7                	mov    %eax,%edi
+  804230:	48 b8 75 41 80 00 00 	movabs $0x804175,%rax
+  804237:	00 00 00 
+  80423a:	ff d0                	call   *%rax
+  80423c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80423f:	89 df                	mov    %ebx,%edi
+  804241:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  804248:	00 00 00 
+  80424b:	ff d0                	call   *%rax
+
+    return res;
+  80424d:	44 89 e3             	mov    %r12d,%ebx
+}
+  804250:	89 d8                	mov    %ebx,%eax
+  804252:	5b                   	pop    %rbx
+  804253:	41 5c                	pop    %r12
+  804255:	5d                   	pop    %rbp
+  804256:	c3                   	ret
+
+0000000000804257 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804257:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  80425e:	00 00 00 
+  804261:	83 38 00             	cmpl   $0x0,(%rax)
+  804264:	74 0a                	je     804270 <fsipc_env+0x19>
+    return fsenv;
+}
+  804266:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  80426d:	00 00 
+  80426f:	c3                   	ret
+fsipc_env(void) {
+  804270:	55                   	push   %rbp
+  804271:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  804274:	bf 03 00 00 00       	mov    $0x3,%edi
+  804279:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  804280:	00 00 00 
+  804283:	ff d0                	call   *%rax
+  804285:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  80428c:	00 00 
+}
+  80428e:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  804295:	00 00 
+  804297:	5d                   	pop    %rbp
+  804298:	c3                   	ret
+
+0000000000804299 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  804299:	55                   	push   %rbp
+  80429a:	48 89 e5             	mov    %rsp,%rbp
+  80429d:	53                   	push   %rbx
+  80429e:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8042a2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8042a9:	00 
+  8042aa:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8042b1:	00 
+  8042b2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8042b9:	00 
+  8042ba:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8042c1:	00 
+  8042c2:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8042c9:	00 
+
+    assert(size <= sizeof(words));
+  8042ca:	48 83 fa 28          	cmp    $0x28,%rdx
+  8042ce:	77 38                	ja     804308 <fsipc_short+0x6f>
+  8042d0:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8042d2:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8042d6:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8042e2:	48 b8 57 42 80 00 00 	movabs $0x804257,%rax
+  8042e9:	00 00 00 
+  8042ec:	ff d0                	call   *%rax
+  8042ee:	89 c7                	mov    %eax,%edi
+  8042f0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8042f4:	89 de                	mov    %ebx,%esi
+  8042f6:	48 b8 35 3a 80 00 00 	movabs $0x803a35,%rax
+  8042fd:	00 00 00 
+  804300:	ff d0                	call   *%rax
+}
+  804302:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804306:	c9                   	leave
+  804307:	c3                   	ret
+    assert(size <= sizeof(words));
+  804308:	48 b9 a0 70 80 00 00 	movabs $0x8070a0,%rcx
+  80430f:	00 00 00 
+  804312:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  804319:	00 00 00 
+  80431c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  804321:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  804328:	00 00 00 
+  80432b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804330:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  804337:	00 00 00 
+  80433a:	41 ff d0             	call   *%r8
+
+000000000080433d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80433d:	55                   	push   %rbp
+  80433e:	48 89 e5             	mov    %rsp,%rbp
+  804341:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  804345:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804348:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80434b:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  80434e:	ba 08 00 00 00       	mov    $0x8,%edx
+  804353:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804357:	bf 02 00 00 00       	mov    $0x2,%edi
+  80435c:	48 b8 99 42 80 00 00 	movabs $0x804299,%rax
+  804363:	00 00 00 
+  804366:	ff d0                	call   *%rax
+}
+  804368:	c9                   	leave
+  804369:	c3                   	ret
+
+000000000080436a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80436a:	55                   	push   %rbp
+  80436b:	48 89 e5             	mov    %rsp,%rbp
+  80436e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  804372:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804375:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  804378:	ba 04 00 00 00       	mov    $0x4,%edx
+  80437d:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  804381:	bf 06 00 00 00       	mov    $0x6,%edi
+  804386:	48 b8 99 42 80 00 00 	movabs $0x804299,%rax
+  80438d:	00 00 00 
+  804390:	ff d0                	call   *%rax
+}
+  804392:	c9                   	leave
+  804393:	c3                   	ret
+
+0000000000804394 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  804394:	55                   	push   %rbp
+  804395:	48 89 e5             	mov    %rsp,%rbp
+  804398:	41 54                	push   %r12
+  80439a:	53                   	push   %rbx
+  80439b:	48 83 ec 10          	sub    $0x10,%rsp
+  80439f:	89 fb                	mov    %edi,%ebx
+  8043a1:	49 89 f4             	mov    %rsi,%r12
+  8043a4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8043a8:	48 b8 57 42 80 00 00 	movabs $0x804257,%rax
+  8043af:	00 00 00 
+  8043b2:	ff d0                	call   *%rax
+  8043b4:	89 c7                	mov    %eax,%edi
+  8043b6:	6a 00                	push   $0x0
+  8043b8:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8043bc:	50                   	push   %rax
+  8043bd:	4d 89 e1             	mov    %r12,%r9
+  8043c0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8043c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8043cb:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  8043d2:	00 00 00 
+  8043d5:	89 de                	mov    %ebx,%esi
+  8043d7:	48 b8 d0 39 80 00 00 	movabs $0x8039d0,%rax
+  8043de:	00 00 00 
+  8043e1:	ff d0                	call   *%rax
+}
+  8043e3:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8043e7:	5b                   	pop    %rbx
+  8043e8:	41 5c                	pop    %r12
+  8043ea:	5d                   	pop    %rbp
+  8043eb:	c3                   	ret
+
+00000000008043ec <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8043ec:	55                   	push   %rbp
+  8043ed:	48 89 e5             	mov    %rsp,%rbp
+  8043f0:	41 54                	push   %r12
+  8043f2:	53                   	push   %rbx
+  8043f3:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8043f6:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8043f9:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  804400:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  804402:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804407:	be 00 00 00 00       	mov    $0x0,%esi
+  80440c:	bf 05 00 00 00       	mov    $0x5,%edi
+  804411:	48 b8 94 43 80 00 00 	movabs $0x804394,%rax
+  804418:	00 00 00 
+  80441b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80441d:	85 c0                	test   %eax,%eax
+  80441f:	78 5a                	js     80447b <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804421:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  804428:	00 00 00 
+  80442b:	4c 89 e6             	mov    %r12,%rsi
+  80442e:	48 89 df             	mov    %rbx,%rdi
+  804431:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  804438:	00 00 00 
+  80443b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80443d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  804444:	00 
+  804445:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80444b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  804452:	00 
+  804453:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  804459:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  804460:	00 
+  804461:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  804468:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80446f:	00 
+  804470:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  804476:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80447b:	5b                   	pop    %rbx
+  80447c:	41 5c                	pop    %r12
+  80447e:	5d                   	pop    %rbp
+  80447f:	c3                   	ret
+
+0000000000804480 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804480:	55                   	push   %rbp
+  804481:	48 89 e5             	mov    %rsp,%rbp
+  804484:	41 57                	push   %r15
+  804486:	41 56                	push   %r14
+  804488:	41 55                	push   %r13
+  80448a:	41 54                	push   %r12
+  80448c:	53                   	push   %rbx
+  80448d:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  804491:	48 85 ff             	test   %rdi,%rdi
+  804494:	0f 84 a1 00 00 00    	je     80453b <devfile_read+0xbb>
+  80449a:	49 89 ff             	mov    %rdi,%r15
+  80449d:	49 89 f5             	mov    %rsi,%r13
+  8044a0:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8044a3:	48 85 f6             	test   %rsi,%rsi
+  8044a6:	0f 84 c4 00 00 00    	je     804570 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8044ac:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8044b3:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8044b4:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  8044bb:	00 00 00 
+  8044be:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8044c2:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8044c5:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8044c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8044d3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044d8:	48 b8 94 43 80 00 00 	movabs $0x804394,%rax
+  8044df:	00 00 00 
+  8044e2:	ff d0                	call   *%rax
+        if (res < 0) {
+  8044e4:	85 c0                	test   %eax,%eax
+  8044e6:	0f 88 b9 00 00 00    	js     8045a5 <devfile_read+0x125>
+        assert(res <= n);
+  8044ec:	48 63 d8             	movslq %eax,%rbx
+  8044ef:	49 39 dc             	cmp    %rbx,%r12
+  8044f2:	0f 82 b1 00 00 00    	jb     8045a9 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8044f8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8044fd:	0f 87 db 00 00 00    	ja     8045de <devfile_read+0x15e>
+        if (!res) {
+  804503:	85 c0                	test   %eax,%eax
+  804505:	74 21                	je     804528 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804507:	48 89 da             	mov    %rbx,%rdx
+  80450a:	4c 89 f6             	mov    %r14,%rsi
+  80450d:	4c 89 ef             	mov    %r13,%rdi
+  804510:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  804517:	00 00 00 
+  80451a:	ff d0                	call   *%rax
+        total_read += res;
+  80451c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  804520:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  804523:	49 29 dc             	sub    %rbx,%r12
+  804526:	75 96                	jne    8044be <devfile_read+0x3e>
+    return total_read;
+  804528:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80452c:	48 83 c4 18          	add    $0x18,%rsp
+  804530:	5b                   	pop    %rbx
+  804531:	41 5c                	pop    %r12
+  804533:	41 5d                	pop    %r13
+  804535:	41 5e                	pop    %r14
+  804537:	41 5f                	pop    %r15
+  804539:	5d                   	pop    %rbp
+  80453a:	c3                   	ret
+    assert(fd);
+  80453b:	48 b9 d6 70 80 00 00 	movabs $0x8070d6,%rcx
+  804542:	00 00 00 
+  804545:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  80454c:	00 00 00 
+  80454f:	be 91 00 00 00       	mov    $0x91,%esi
+  804554:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  80455b:	00 00 00 
+  80455e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804563:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  80456a:	00 00 00 
+  80456d:	41 ff d0             	call   *%r8
+    assert(buf);
+  804570:	48 b9 d9 70 80 00 00 	movabs $0x8070d9,%rcx
+  804577:	00 00 00 
+  80457a:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  804581:	00 00 00 
+  804584:	be 92 00 00 00       	mov    $0x92,%esi
+  804589:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  804590:	00 00 00 
+  804593:	b8 00 00 00 00       	mov    $0x0,%eax
+  804598:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  80459f:	00 00 00 
+  8045a2:	41 ff d0             	call   *%r8
+            return res;
+  8045a5:	48 98                	cltq
+  8045a7:	eb 83                	jmp    80452c <devfile_read+0xac>
+        assert(res <= n);
+  8045a9:	48 b9 dd 70 80 00 00 	movabs $0x8070dd,%rcx
+  8045b0:	00 00 00 
+  8045b3:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  8045ba:	00 00 00 
+  8045bd:	be 9e 00 00 00       	mov    $0x9e,%esi
+  8045c2:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  8045c9:	00 00 00 
+  8045cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045d1:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  8045d8:	00 00 00 
+  8045db:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8045de:	48 b9 e8 70 80 00 00 	movabs $0x8070e8,%rcx
+  8045e5:	00 00 00 
+  8045e8:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  8045ef:	00 00 00 
+  8045f2:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8045f7:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  8045fe:	00 00 00 
+  804601:	b8 00 00 00 00       	mov    $0x0,%eax
+  804606:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  80460d:	00 00 00 
+  804610:	41 ff d0             	call   *%r8
+
+0000000000804613 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804613:	55                   	push   %rbp
+  804614:	48 89 e5             	mov    %rsp,%rbp
+  804617:	41 57                	push   %r15
+  804619:	41 56                	push   %r14
+  80461b:	41 55                	push   %r13
+  80461d:	41 54                	push   %r12
+  80461f:	53                   	push   %rbx
+  804620:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  804624:	48 85 ff             	test   %rdi,%rdi
+  804627:	0f 84 83 00 00 00    	je     8046b0 <devfile_write+0x9d>
+  80462d:	49 89 ff             	mov    %rdi,%r15
+  804630:	49 89 f4             	mov    %rsi,%r12
+  804633:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  804636:	48 85 f6             	test   %rsi,%rsi
+  804639:	0f 84 a6 00 00 00    	je     8046e5 <devfile_write+0xd2>
+    size_t total_written = 0;
+  80463f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804645:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  80464c:	00 00 00 
+  80464f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  804653:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  804656:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  80465a:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80465f:	48 39 d3             	cmp    %rdx,%rbx
+  804662:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  804666:	4c 89 e6             	mov    %r12,%rsi
+  804669:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  804670:	00 00 00 
+  804673:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  80467a:	00 00 00 
+  80467d:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80467f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804684:	be 00 00 00 00       	mov    $0x0,%esi
+  804689:	bf 04 00 00 00       	mov    $0x4,%edi
+  80468e:	48 b8 94 43 80 00 00 	movabs $0x804394,%rax
+  804695:	00 00 00 
+  804698:	ff d0                	call   *%rax
+        if (res < 0) {
+  80469a:	85 c0                	test   %eax,%eax
+  80469c:	78 7c                	js     80471a <devfile_write+0x107>
+        total_written += res;
+  80469e:	48 98                	cltq
+  8046a0:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8046a3:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8046a6:	48 29 c3             	sub    %rax,%rbx
+  8046a9:	75 a4                	jne    80464f <devfile_write+0x3c>
+    return total_written;
+  8046ab:	4c 89 e8             	mov    %r13,%rax
+  8046ae:	eb 6c                	jmp    80471c <devfile_write+0x109>
+    assert(fd);
+  8046b0:	48 b9 d6 70 80 00 00 	movabs $0x8070d6,%rcx
+  8046b7:	00 00 00 
+  8046ba:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  8046c1:	00 00 00 
+  8046c4:	be bd 00 00 00       	mov    $0xbd,%esi
+  8046c9:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  8046d0:	00 00 00 
+  8046d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d8:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  8046df:	00 00 00 
+  8046e2:	41 ff d0             	call   *%r8
+    assert(buf);
+  8046e5:	48 b9 d9 70 80 00 00 	movabs $0x8070d9,%rcx
+  8046ec:	00 00 00 
+  8046ef:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  8046f6:	00 00 00 
+  8046f9:	be be 00 00 00       	mov    $0xbe,%esi
+  8046fe:	48 bf cb 70 80 00 00 	movabs $0x8070cb,%rdi
+  804705:	00 00 00 
+  804708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470d:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  804714:	00 00 00 
+  804717:	41 ff d0             	call   *%r8
+            return res;
+  80471a:	48 98                	cltq
+}
+  80471c:	48 83 c4 08          	add    $0x8,%rsp
+  804720:	5b                   	pop    %rbx
+  804721:	41 5c                	pop    %r12
+  804723:	41 5d                	pop    %r13
+  804725:	41 5e                	pop    %r14
+  804727:	41 5f                	pop    %r15
+  804729:	5d                   	pop    %rbp
+  80472a:	c3                   	ret
+
+000000000080472b <open>:
+open(const char *path, int mode) {
+  80472b:	55                   	push   %rbp
+  80472c:	48 89 e5             	mov    %rsp,%rbp
+  80472f:	41 55                	push   %r13
+  804731:	41 54                	push   %r12
+  804733:	53                   	push   %rbx
+  804734:	48 83 ec 18          	sub    $0x18,%rsp
+  804738:	49 89 fc             	mov    %rdi,%r12
+  80473b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80473e:	48 b8 9f 2a 80 00 00 	movabs $0x802a9f,%rax
+  804745:	00 00 00 
+  804748:	ff d0                	call   *%rax
+  80474a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  804750:	0f 87 8f 00 00 00    	ja     8047e5 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804756:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80475a:	48 b8 50 3b 80 00 00 	movabs $0x803b50,%rax
+  804761:	00 00 00 
+  804764:	ff d0                	call   *%rax
+  804766:	89 c3                	mov    %eax,%ebx
+  804768:	85 c0                	test   %eax,%eax
+  80476a:	78 55                	js     8047c1 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80476c:	4c 89 e6             	mov    %r12,%rsi
+  80476f:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  804776:	00 00 00 
+  804779:	48 89 df             	mov    %rbx,%rdi
+  80477c:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  804783:	00 00 00 
+  804786:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  804788:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80478f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804794:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804798:	bf 01 00 00 00       	mov    $0x1,%edi
+  80479d:	48 b8 94 43 80 00 00 	movabs $0x804394,%rax
+  8047a4:	00 00 00 
+  8047a7:	ff d0                	call   *%rax
+  8047a9:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8047ab:	85 c0                	test   %eax,%eax
+  8047ad:	78 1f                	js     8047ce <open+0xa3>
+    return fd2num(fd);
+  8047af:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8047b3:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  8047ba:	00 00 00 
+  8047bd:	ff d0                	call   *%rax
+  8047bf:	89 c3                	mov    %eax,%ebx
+}
+  8047c1:	89 d8                	mov    %ebx,%eax
+  8047c3:	48 83 c4 18          	add    $0x18,%rsp
+  8047c7:	5b                   	pop    %rbx
+  8047c8:	41 5c                	pop    %r12
+  8047ca:	41 5d                	pop    %r13
+  8047cc:	5d                   	pop    %rbp
+  8047cd:	c3                   	ret
+        fd_close(fd, 0);
+  8047ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8047d3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8047d7:	48 b8 6b 3c 80 00 00 	movabs $0x803c6b,%rax
+  8047de:	00 00 00 
+  8047e1:	ff d0                	call   *%rax
+        return res;
+  8047e3:	eb dc                	jmp    8047c1 <open+0x96>
+        return -E_BAD_PATH;
+  8047e5:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8047ea:	eb d5                	jmp    8047c1 <open+0x96>
+
+00000000008047ec <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  8047ec:	55                   	push   %rbp
+  8047ed:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  8047f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8047fa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8047ff:	48 b8 99 42 80 00 00 	movabs $0x804299,%rax
+  804806:	00 00 00 
+  804809:	ff d0                	call   *%rax
+}
+  80480b:	5d                   	pop    %rbp
+  80480c:	c3                   	ret
+
+000000000080480d <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  80480d:	55                   	push   %rbp
+  80480e:	48 89 e5             	mov    %rsp,%rbp
+  804811:	41 56                	push   %r14
+  804813:	41 55                	push   %r13
+  804815:	41 54                	push   %r12
+  804817:	53                   	push   %rbx
+  804818:	48 83 ec 10          	sub    $0x10,%rsp
+  80481c:	41 89 f6             	mov    %esi,%r14d
+  80481f:	49 89 d4             	mov    %rdx,%r12
+  804822:	48 89 cb             	mov    %rcx,%rbx
+  804825:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804828:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80482c:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  804833:	00 00 00 
+  804836:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804838:	85 c0                	test   %eax,%eax
+  80483a:	78 46                	js     804882 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80483c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804840:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  804847:	00 00 00 
+  80484a:	8b 00                	mov    (%rax),%eax
+  80484c:	39 02                	cmp    %eax,(%rdx)
+  80484e:	75 3f                	jne    80488f <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804850:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  804857:	00 00 00 
+  80485a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80485d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  80485f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  804863:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804867:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  80486b:	48 89 da             	mov    %rbx,%rdx
+  80486e:	4c 89 e6             	mov    %r12,%rsi
+  804871:	bf 09 00 00 00       	mov    $0x9,%edi
+  804876:	48 b8 94 43 80 00 00 	movabs $0x804394,%rax
+  80487d:	00 00 00 
+  804880:	ff d0                	call   *%rax
+}
+  804882:	48 83 c4 10          	add    $0x10,%rsp
+  804886:	5b                   	pop    %rbx
+  804887:	41 5c                	pop    %r12
+  804889:	41 5d                	pop    %r13
+  80488b:	41 5e                	pop    %r14
+  80488d:	5d                   	pop    %rbp
+  80488e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80488f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804894:	eb ec                	jmp    804882 <file_map+0x75>
+
+0000000000804896 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  804896:	55                   	push   %rbp
+  804897:	48 89 e5             	mov    %rsp,%rbp
+  80489a:	41 54                	push   %r12
+  80489c:	53                   	push   %rbx
+  80489d:	48 83 ec 20          	sub    $0x20,%rsp
+  8048a1:	41 89 f4             	mov    %esi,%r12d
+  8048a4:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8048a7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8048ab:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  8048b2:	00 00 00 
+  8048b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8048b7:	85 c0                	test   %eax,%eax
+  8048b9:	78 3c                	js     8048f7 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8048bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048bf:	48 ba 60 80 80 00 00 	movabs $0x808060,%rdx
+  8048c6:	00 00 00 
+  8048c9:	8b 0a                	mov    (%rdx),%ecx
+  8048cb:	39 08                	cmp    %ecx,(%rax)
+  8048cd:	75 31                	jne    804900 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8048cf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8048d2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8048d5:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8048d9:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8048dd:	ba 10 00 00 00       	mov    $0x10,%edx
+  8048e2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8048e6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8048eb:	48 b8 99 42 80 00 00 	movabs $0x804299,%rax
+  8048f2:	00 00 00 
+  8048f5:	ff d0                	call   *%rax
+}
+  8048f7:	48 83 c4 20          	add    $0x20,%rsp
+  8048fb:	5b                   	pop    %rbx
+  8048fc:	41 5c                	pop    %r12
+  8048fe:	5d                   	pop    %rbp
+  8048ff:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804900:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804905:	eb f0                	jmp    8048f7 <file_msync+0x61>
+
+0000000000804907 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804907:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80490b:	7f 01                	jg     80490e <writebuf+0x7>
+  80490d:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80490e:	55                   	push   %rbp
+  80490f:	48 89 e5             	mov    %rsp,%rbp
+  804912:	53                   	push   %rbx
+  804913:	48 83 ec 08          	sub    $0x8,%rsp
+  804917:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80491a:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80491e:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804922:	8b 3f                	mov    (%rdi),%edi
+  804924:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  80492b:	00 00 00 
+  80492e:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804930:	48 85 c0             	test   %rax,%rax
+  804933:	7e 04                	jle    804939 <writebuf+0x32>
+  804935:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804939:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80493d:	48 39 c2             	cmp    %rax,%rdx
+  804940:	74 0f                	je     804951 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804942:	48 85 c0             	test   %rax,%rax
+  804945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80494a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80494e:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804951:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804955:	c9                   	leave
+  804956:	c3                   	ret
+
+0000000000804957 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804957:	8b 46 04             	mov    0x4(%rsi),%eax
+  80495a:	8d 50 01             	lea    0x1(%rax),%edx
+  80495d:	89 56 04             	mov    %edx,0x4(%rsi)
+  804960:	48 98                	cltq
+  804962:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804967:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  80496d:	74 01                	je     804970 <putch+0x19>
+  80496f:	c3                   	ret
+putch(int ch, void *arg) {
+  804970:	55                   	push   %rbp
+  804971:	48 89 e5             	mov    %rsp,%rbp
+  804974:	53                   	push   %rbx
+  804975:	48 83 ec 08          	sub    $0x8,%rsp
+  804979:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80497c:	48 89 f7             	mov    %rsi,%rdi
+  80497f:	48 b8 07 49 80 00 00 	movabs $0x804907,%rax
+  804986:	00 00 00 
+  804989:	ff d0                	call   *%rax
+        state->offset = 0;
+  80498b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804992:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804996:	c9                   	leave
+  804997:	c3                   	ret
+
+0000000000804998 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804998:	55                   	push   %rbp
+  804999:	48 89 e5             	mov    %rsp,%rbp
+  80499c:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8049a3:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8049a6:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8049ac:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8049b3:	00 00 00 
+    state.result = 0;
+  8049b6:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8049bd:	00 00 00 00 
+    state.error = 1;
+  8049c1:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8049c8:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8049cb:	48 89 f2             	mov    %rsi,%rdx
+  8049ce:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8049d5:	48 bf 57 49 80 00 00 	movabs $0x804957,%rdi
+  8049dc:	00 00 00 
+  8049df:	48 b8 f6 22 80 00 00 	movabs $0x8022f6,%rax
+  8049e6:	00 00 00 
+  8049e9:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8049eb:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8049f2:	7f 14                	jg     804a08 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8049f4:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8049fb:	48 85 c0             	test   %rax,%rax
+  8049fe:	75 06                	jne    804a06 <vfprintf+0x6e>
+  804a00:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804a06:	c9                   	leave
+  804a07:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804a08:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804a0f:	48 b8 07 49 80 00 00 	movabs $0x804907,%rax
+  804a16:	00 00 00 
+  804a19:	ff d0                	call   *%rax
+  804a1b:	eb d7                	jmp    8049f4 <vfprintf+0x5c>
+
+0000000000804a1d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804a1d:	55                   	push   %rbp
+  804a1e:	48 89 e5             	mov    %rsp,%rbp
+  804a21:	48 83 ec 50          	sub    $0x50,%rsp
+  804a25:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804a29:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804a2d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804a31:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804a35:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804a3c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a44:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804a48:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804a4c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804a50:	48 b8 98 49 80 00 00 	movabs $0x804998,%rax
+  804a57:	00 00 00 
+  804a5a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804a5c:	c9                   	leave
+  804a5d:	c3                   	ret
+
+0000000000804a5e <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804a5e:	55                   	push   %rbp
+  804a5f:	48 89 e5             	mov    %rsp,%rbp
+  804a62:	48 83 ec 50          	sub    $0x50,%rsp
+  804a66:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804a6a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804a6e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804a72:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804a76:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804a7a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804a81:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a89:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804a8d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804a91:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804a95:	48 89 fe             	mov    %rdi,%rsi
+  804a98:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a9d:	48 b8 98 49 80 00 00 	movabs $0x804998,%rax
+  804aa4:	00 00 00 
+  804aa7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804aa9:	c9                   	leave
+  804aaa:	c3                   	ret
+
+0000000000804aab <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804aab:	55                   	push   %rbp
+  804aac:	48 89 e5             	mov    %rsp,%rbp
+  804aaf:	41 54                	push   %r12
+  804ab1:	53                   	push   %rbx
+  804ab2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ab5:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+  804ac1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804ac4:	48 be 10 71 80 00 00 	movabs $0x807110,%rsi
+  804acb:	00 00 00 
+  804ace:	48 89 df             	mov    %rbx,%rdi
+  804ad1:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  804ad8:	00 00 00 
+  804adb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804add:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804ae2:	41 2b 04 24          	sub    (%r12),%eax
+  804ae6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804aec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804af3:	00 00 00 
+    stat->st_dev = &devpipe;
+  804af6:	48 b8 a0 80 80 00 00 	movabs $0x8080a0,%rax
+  804afd:	00 00 00 
+  804b00:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b0c:	5b                   	pop    %rbx
+  804b0d:	41 5c                	pop    %r12
+  804b0f:	5d                   	pop    %rbp
+  804b10:	c3                   	ret
+
+0000000000804b11 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804b11:	55                   	push   %rbp
+  804b12:	48 89 e5             	mov    %rsp,%rbp
+  804b15:	41 54                	push   %r12
+  804b17:	53                   	push   %rbx
+  804b18:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804b1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b20:	48 89 fe             	mov    %rdi,%rsi
+  804b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b28:	49 bc 1a 33 80 00 00 	movabs $0x80331a,%r12
+  804b2f:	00 00 00 
+  804b32:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804b35:	48 89 df             	mov    %rbx,%rdi
+  804b38:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804b3f:	00 00 00 
+  804b42:	ff d0                	call   *%rax
+  804b44:	48 89 c6             	mov    %rax,%rsi
+  804b47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b51:	41 ff d4             	call   *%r12
+}
+  804b54:	5b                   	pop    %rbx
+  804b55:	41 5c                	pop    %r12
+  804b57:	5d                   	pop    %rbp
+  804b58:	c3                   	ret
+
+0000000000804b59 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804b59:	55                   	push   %rbp
+  804b5a:	48 89 e5             	mov    %rsp,%rbp
+  804b5d:	41 57                	push   %r15
+  804b5f:	41 56                	push   %r14
+  804b61:	41 55                	push   %r13
+  804b63:	41 54                	push   %r12
+  804b65:	53                   	push   %rbx
+  804b66:	48 83 ec 18          	sub    $0x18,%rsp
+  804b6a:	49 89 fc             	mov    %rdi,%r12
+  804b6d:	49 89 f5             	mov    %rsi,%r13
+  804b70:	49 89 d7             	mov    %rdx,%r15
+  804b73:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b77:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804b7e:	00 00 00 
+  804b81:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804b83:	4d 85 ff             	test   %r15,%r15
+  804b86:	0f 84 af 00 00 00    	je     804c3b <devpipe_write+0xe2>
+  804b8c:	48 89 c3             	mov    %rax,%rbx
+  804b8f:	4c 89 f8             	mov    %r15,%rax
+  804b92:	4d 89 ef             	mov    %r13,%r15
+  804b95:	4c 01 e8             	add    %r13,%rax
+  804b98:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804b9c:	49 bd 10 32 80 00 00 	movabs $0x803210,%r13
+  804ba3:	00 00 00 
+            sys_yield();
+  804ba6:	49 be a1 31 80 00 00 	movabs $0x8031a1,%r14
+  804bad:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804bb0:	8b 73 04             	mov    0x4(%rbx),%esi
+  804bb3:	48 63 ce             	movslq %esi,%rcx
+  804bb6:	48 63 03             	movslq (%rbx),%rax
+  804bb9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804bbf:	48 39 c1             	cmp    %rax,%rcx
+  804bc2:	72 2e                	jb     804bf2 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804bc4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804bc9:	48 89 da             	mov    %rbx,%rdx
+  804bcc:	be 00 10 00 00       	mov    $0x1000,%esi
+  804bd1:	4c 89 e7             	mov    %r12,%rdi
+  804bd4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804bd7:	85 c0                	test   %eax,%eax
+  804bd9:	74 66                	je     804c41 <devpipe_write+0xe8>
+            sys_yield();
+  804bdb:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804bde:	8b 73 04             	mov    0x4(%rbx),%esi
+  804be1:	48 63 ce             	movslq %esi,%rcx
+  804be4:	48 63 03             	movslq (%rbx),%rax
+  804be7:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804bed:	48 39 c1             	cmp    %rax,%rcx
+  804bf0:	73 d2                	jae    804bc4 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804bf2:	41 0f b6 3f          	movzbl (%r15),%edi
+  804bf6:	48 89 ca             	mov    %rcx,%rdx
+  804bf9:	48 c1 ea 03          	shr    $0x3,%rdx
+  804bfd:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804c04:	08 10 20 
+  804c07:	48 f7 e2             	mul    %rdx
+  804c0a:	48 c1 ea 06          	shr    $0x6,%rdx
+  804c0e:	48 89 d0             	mov    %rdx,%rax
+  804c11:	48 c1 e0 09          	shl    $0x9,%rax
+  804c15:	48 29 d0             	sub    %rdx,%rax
+  804c18:	48 c1 e0 03          	shl    $0x3,%rax
+  804c1c:	48 29 c1             	sub    %rax,%rcx
+  804c1f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804c24:	83 c6 01             	add    $0x1,%esi
+  804c27:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804c2a:	49 83 c7 01          	add    $0x1,%r15
+  804c2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c32:	49 39 c7             	cmp    %rax,%r15
+  804c35:	0f 85 75 ff ff ff    	jne    804bb0 <devpipe_write+0x57>
+    return n;
+  804c3b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c3f:	eb 05                	jmp    804c46 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c46:	48 83 c4 18          	add    $0x18,%rsp
+  804c4a:	5b                   	pop    %rbx
+  804c4b:	41 5c                	pop    %r12
+  804c4d:	41 5d                	pop    %r13
+  804c4f:	41 5e                	pop    %r14
+  804c51:	41 5f                	pop    %r15
+  804c53:	5d                   	pop    %rbp
+  804c54:	c3                   	ret
+
+0000000000804c55 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c55:	55                   	push   %rbp
+  804c56:	48 89 e5             	mov    %rsp,%rbp
+  804c59:	41 57                	push   %r15
+  804c5b:	41 56                	push   %r14
+  804c5d:	41 55                	push   %r13
+  804c5f:	41 54                	push   %r12
+  804c61:	53                   	push   %rbx
+  804c62:	48 83 ec 18          	sub    $0x18,%rsp
+  804c66:	49 89 fc             	mov    %rdi,%r12
+  804c69:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804c6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c71:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804c78:	00 00 00 
+  804c7b:	ff d0                	call   *%rax
+  804c7d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804c80:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c86:	49 bd 10 32 80 00 00 	movabs $0x803210,%r13
+  804c8d:	00 00 00 
+            sys_yield();
+  804c90:	49 be a1 31 80 00 00 	movabs $0x8031a1,%r14
+  804c97:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804c9a:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804c9f:	74 7d                	je     804d1e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804ca1:	8b 03                	mov    (%rbx),%eax
+  804ca3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804ca6:	75 26                	jne    804cce <devpipe_read+0x79>
+            if (i > 0) return i;
+  804ca8:	4d 85 ff             	test   %r15,%r15
+  804cab:	75 77                	jne    804d24 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804cad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804cb2:	48 89 da             	mov    %rbx,%rdx
+  804cb5:	be 00 10 00 00       	mov    $0x1000,%esi
+  804cba:	4c 89 e7             	mov    %r12,%rdi
+  804cbd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804cc0:	85 c0                	test   %eax,%eax
+  804cc2:	74 72                	je     804d36 <devpipe_read+0xe1>
+            sys_yield();
+  804cc4:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804cc7:	8b 03                	mov    (%rbx),%eax
+  804cc9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804ccc:	74 df                	je     804cad <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804cce:	48 63 c8             	movslq %eax,%rcx
+  804cd1:	48 89 ca             	mov    %rcx,%rdx
+  804cd4:	48 c1 ea 03          	shr    $0x3,%rdx
+  804cd8:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804cdf:	08 10 20 
+  804ce2:	48 89 d0             	mov    %rdx,%rax
+  804ce5:	48 f7 e6             	mul    %rsi
+  804ce8:	48 c1 ea 06          	shr    $0x6,%rdx
+  804cec:	48 89 d0             	mov    %rdx,%rax
+  804cef:	48 c1 e0 09          	shl    $0x9,%rax
+  804cf3:	48 29 d0             	sub    %rdx,%rax
+  804cf6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804cfd:	00 
+  804cfe:	48 89 c8             	mov    %rcx,%rax
+  804d01:	48 29 d0             	sub    %rdx,%rax
+  804d04:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804d09:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804d0d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804d11:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804d14:	49 83 c7 01          	add    $0x1,%r15
+  804d18:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804d1c:	75 83                	jne    804ca1 <devpipe_read+0x4c>
+    return n;
+  804d1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d22:	eb 03                	jmp    804d27 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804d24:	4c 89 f8             	mov    %r15,%rax
+}
+  804d27:	48 83 c4 18          	add    $0x18,%rsp
+  804d2b:	5b                   	pop    %rbx
+  804d2c:	41 5c                	pop    %r12
+  804d2e:	41 5d                	pop    %r13
+  804d30:	41 5e                	pop    %r14
+  804d32:	41 5f                	pop    %r15
+  804d34:	5d                   	pop    %rbp
+  804d35:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3b:	eb ea                	jmp    804d27 <devpipe_read+0xd2>
+
+0000000000804d3d <pipe>:
+pipe(int pfd[2]) {
+  804d3d:	55                   	push   %rbp
+  804d3e:	48 89 e5             	mov    %rsp,%rbp
+  804d41:	41 55                	push   %r13
+  804d43:	41 54                	push   %r12
+  804d45:	53                   	push   %rbx
+  804d46:	48 83 ec 18          	sub    $0x18,%rsp
+  804d4a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804d4d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804d51:	48 b8 50 3b 80 00 00 	movabs $0x803b50,%rax
+  804d58:	00 00 00 
+  804d5b:	ff d0                	call   *%rax
+  804d5d:	89 c3                	mov    %eax,%ebx
+  804d5f:	85 c0                	test   %eax,%eax
+  804d61:	0f 88 a0 01 00 00    	js     804f07 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804d67:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804d6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d71:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d7a:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  804d81:	00 00 00 
+  804d84:	ff d0                	call   *%rax
+  804d86:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804d88:	85 c0                	test   %eax,%eax
+  804d8a:	0f 88 77 01 00 00    	js     804f07 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804d90:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804d94:	48 b8 50 3b 80 00 00 	movabs $0x803b50,%rax
+  804d9b:	00 00 00 
+  804d9e:	ff d0                	call   *%rax
+  804da0:	89 c3                	mov    %eax,%ebx
+  804da2:	85 c0                	test   %eax,%eax
+  804da4:	0f 88 43 01 00 00    	js     804eed <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804daa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804daf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804db4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804db8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dbd:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  804dc4:	00 00 00 
+  804dc7:	ff d0                	call   *%rax
+  804dc9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804dcb:	85 c0                	test   %eax,%eax
+  804dcd:	0f 88 1a 01 00 00    	js     804eed <pipe+0x1b0>
+    va = fd2data(fd0);
+  804dd3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804dd7:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804dde:	00 00 00 
+  804de1:	ff d0                	call   *%rax
+  804de3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804de6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804deb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804df0:	48 89 c6             	mov    %rax,%rsi
+  804df3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804df8:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  804dff:	00 00 00 
+  804e02:	ff d0                	call   *%rax
+  804e04:	89 c3                	mov    %eax,%ebx
+  804e06:	85 c0                	test   %eax,%eax
+  804e08:	0f 88 c5 00 00 00    	js     804ed3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804e0e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804e12:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804e19:	00 00 00 
+  804e1c:	ff d0                	call   *%rax
+  804e1e:	48 89 c1             	mov    %rax,%rcx
+  804e21:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804e27:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e32:	4c 89 ee             	mov    %r13,%rsi
+  804e35:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e3a:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  804e41:	00 00 00 
+  804e44:	ff d0                	call   *%rax
+  804e46:	89 c3                	mov    %eax,%ebx
+  804e48:	85 c0                	test   %eax,%eax
+  804e4a:	78 6e                	js     804eba <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804e4c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804e51:	4c 89 ef             	mov    %r13,%rdi
+  804e54:	48 b8 d8 31 80 00 00 	movabs $0x8031d8,%rax
+  804e5b:	00 00 00 
+  804e5e:	ff d0                	call   *%rax
+  804e60:	83 f8 02             	cmp    $0x2,%eax
+  804e63:	0f 85 ab 00 00 00    	jne    804f14 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804e69:	a1 a0 80 80 00 00 00 	movabs 0x8080a0,%eax
+  804e70:	00 00 
+  804e72:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e76:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804e78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e7c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804e83:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e87:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804e89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e8d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804e94:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804e98:	48 bb 22 3b 80 00 00 	movabs $0x803b22,%rbx
+  804e9f:	00 00 00 
+  804ea2:	ff d3                	call   *%rbx
+  804ea4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804ea8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804eac:	ff d3                	call   *%rbx
+  804eae:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804eb8:	eb 4d                	jmp    804f07 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804eba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ebf:	4c 89 ee             	mov    %r13,%rsi
+  804ec2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ec7:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  804ece:	00 00 00 
+  804ed1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804ed3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ed8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804edc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ee1:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  804ee8:	00 00 00 
+  804eeb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804eed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ef2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804ef6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804efb:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  804f02:	00 00 00 
+  804f05:	ff d0                	call   *%rax
+}
+  804f07:	89 d8                	mov    %ebx,%eax
+  804f09:	48 83 c4 18          	add    $0x18,%rsp
+  804f0d:	5b                   	pop    %rbx
+  804f0e:	41 5c                	pop    %r12
+  804f10:	41 5d                	pop    %r13
+  804f12:	5d                   	pop    %rbp
+  804f13:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804f14:	48 b9 28 71 80 00 00 	movabs $0x807128,%rcx
+  804f1b:	00 00 00 
+  804f1e:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  804f25:	00 00 00 
+  804f28:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804f2d:	48 bf 17 71 80 00 00 	movabs $0x807117,%rdi
+  804f34:	00 00 00 
+  804f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f3c:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  804f43:	00 00 00 
+  804f46:	41 ff d0             	call   *%r8
+
+0000000000804f49 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804f49:	55                   	push   %rbp
+  804f4a:	48 89 e5             	mov    %rsp,%rbp
+  804f4d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804f51:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804f55:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  804f5c:	00 00 00 
+  804f5f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804f61:	85 c0                	test   %eax,%eax
+  804f63:	78 35                	js     804f9a <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804f65:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f69:	48 b8 34 3b 80 00 00 	movabs $0x803b34,%rax
+  804f70:	00 00 00 
+  804f73:	ff d0                	call   *%rax
+  804f75:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804f78:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804f7d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f82:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f86:	48 b8 10 32 80 00 00 	movabs $0x803210,%rax
+  804f8d:	00 00 00 
+  804f90:	ff d0                	call   *%rax
+  804f92:	85 c0                	test   %eax,%eax
+  804f94:	0f 94 c0             	sete   %al
+  804f97:	0f b6 c0             	movzbl %al,%eax
+}
+  804f9a:	c9                   	leave
+  804f9b:	c3                   	ret
+
+0000000000804f9c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804f9c:	48 89 f8             	mov    %rdi,%rax
+  804f9f:	48 c1 e8 27          	shr    $0x27,%rax
+  804fa3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804faa:	01 00 00 
+  804fad:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804fb1:	f6 c2 01             	test   $0x1,%dl
+  804fb4:	74 6d                	je     805023 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804fb6:	48 89 f8             	mov    %rdi,%rax
+  804fb9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804fbd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804fc4:	01 00 00 
+  804fc7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804fcb:	f6 c2 01             	test   $0x1,%dl
+  804fce:	74 62                	je     805032 <get_uvpt_entry+0x96>
+  804fd0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804fd7:	01 00 00 
+  804fda:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804fde:	f6 c2 80             	test   $0x80,%dl
+  804fe1:	75 4f                	jne    805032 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804fe3:	48 89 f8             	mov    %rdi,%rax
+  804fe6:	48 c1 e8 15          	shr    $0x15,%rax
+  804fea:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804ff1:	01 00 00 
+  804ff4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ff8:	f6 c2 01             	test   $0x1,%dl
+  804ffb:	74 44                	je     805041 <get_uvpt_entry+0xa5>
+  804ffd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805004:	01 00 00 
+  805007:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80500b:	f6 c2 80             	test   $0x80,%dl
+  80500e:	75 31                	jne    805041 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  805010:	48 c1 ef 0c          	shr    $0xc,%rdi
+  805014:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80501b:	01 00 00 
+  80501e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  805022:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805023:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80502a:	01 00 00 
+  80502d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805031:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805032:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805039:	01 00 00 
+  80503c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805040:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805041:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805048:	01 00 00 
+  80504b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80504f:	c3                   	ret
+
+0000000000805050 <get_prot>:
+
+int
+get_prot(void *va) {
+  805050:	55                   	push   %rbp
+  805051:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805054:	48 b8 9c 4f 80 00 00 	movabs $0x804f9c,%rax
+  80505b:	00 00 00 
+  80505e:	ff d0                	call   *%rax
+  805060:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805063:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805068:	89 c1                	mov    %eax,%ecx
+  80506a:	83 c9 04             	or     $0x4,%ecx
+  80506d:	f6 c2 01             	test   $0x1,%dl
+  805070:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805073:	89 c1                	mov    %eax,%ecx
+  805075:	83 c9 02             	or     $0x2,%ecx
+  805078:	f6 c2 02             	test   $0x2,%dl
+  80507b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80507e:	89 c1                	mov    %eax,%ecx
+  805080:	83 c9 01             	or     $0x1,%ecx
+  805083:	48 85 d2             	test   %rdx,%rdx
+  805086:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805089:	89 c1                	mov    %eax,%ecx
+  80508b:	83 c9 40             	or     $0x40,%ecx
+  80508e:	f6 c6 04             	test   $0x4,%dh
+  805091:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805094:	5d                   	pop    %rbp
+  805095:	c3                   	ret
+
+0000000000805096 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805096:	55                   	push   %rbp
+  805097:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80509a:	48 b8 9c 4f 80 00 00 	movabs $0x804f9c,%rax
+  8050a1:	00 00 00 
+  8050a4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8050a6:	48 c1 e8 06          	shr    $0x6,%rax
+  8050aa:	83 e0 01             	and    $0x1,%eax
+}
+  8050ad:	5d                   	pop    %rbp
+  8050ae:	c3                   	ret
+
+00000000008050af <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8050af:	55                   	push   %rbp
+  8050b0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8050b3:	48 b8 9c 4f 80 00 00 	movabs $0x804f9c,%rax
+  8050ba:	00 00 00 
+  8050bd:	ff d0                	call   *%rax
+  8050bf:	83 e0 01             	and    $0x1,%eax
+}
+  8050c2:	5d                   	pop    %rbp
+  8050c3:	c3                   	ret
+
+00000000008050c4 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8050c4:	55                   	push   %rbp
+  8050c5:	48 89 e5             	mov    %rsp,%rbp
+  8050c8:	41 57                	push   %r15
+  8050ca:	41 56                	push   %r14
+  8050cc:	41 55                	push   %r13
+  8050ce:	41 54                	push   %r12
+  8050d0:	53                   	push   %rbx
+  8050d1:	48 83 ec 28          	sub    $0x28,%rsp
+  8050d5:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8050d9:	48 85 ff             	test   %rdi,%rdi
+  8050dc:	74 1e                	je     8050fc <foreach_shared_region+0x38>
+  8050de:	49 89 ff             	mov    %rdi,%r15
+  8050e1:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8050e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  8050ed:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8050f4:	01 00 00 
+  8050f7:	e9 72 02 00 00       	jmp    80536e <foreach_shared_region+0x2aa>
+    assert(fun);
+  8050fc:	48 b9 4c 71 80 00 00 	movabs $0x80714c,%rcx
+  805103:	00 00 00 
+  805106:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  80510d:	00 00 00 
+  805110:	be 2d 00 00 00       	mov    $0x2d,%esi
+  805115:	48 bf 50 71 80 00 00 	movabs $0x807150,%rdi
+  80511c:	00 00 00 
+  80511f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805124:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  80512b:	00 00 00 
+  80512e:	41 ff d0             	call   *%r8
+  805131:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  805138:	eb 6c                	jmp    8051a6 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80513a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805141:	ff ff ff 
+  805144:	4c 21 e2             	and    %r12,%rdx
+  805147:	48 89 d8             	mov    %rbx,%rax
+  80514a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80514f:	48 83 c0 01          	add    $0x1,%rax
+  805153:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805157:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80515e:	00 00 00 
+  805161:	48 21 c8             	and    %rcx,%rax
+  805164:	48 09 d0             	or     %rdx,%rax
+  805167:	49 89 c4             	mov    %rax,%r12
+  80516a:	eb 30                	jmp    80519c <foreach_shared_region+0xd8>
+  80516c:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805173:	ff ff ff 
+  805176:	4c 21 e2             	and    %r12,%rdx
+  805179:	48 89 d8             	mov    %rbx,%rax
+  80517c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805181:	48 83 c0 01          	add    $0x1,%rax
+  805185:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805189:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  805190:	00 00 00 
+  805193:	48 21 c8             	and    %rcx,%rax
+  805196:	48 09 d0             	or     %rdx,%rax
+  805199:	49 89 c4             	mov    %rax,%r12
+  80519c:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8051a0:	0f 84 99 01 00 00    	je     80533f <foreach_shared_region+0x27b>
+  8051a6:	4c 89 e3             	mov    %r12,%rbx
+  8051a9:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8051ad:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8051b4:	01 00 00 
+  8051b7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8051bb:	a8 01                	test   $0x1,%al
+  8051bd:	0f 84 77 ff ff ff    	je     80513a <foreach_shared_region+0x76>
+  8051c3:	a8 80                	test   $0x80,%al
+  8051c5:	74 19                	je     8051e0 <foreach_shared_region+0x11c>
+  8051c7:	f6 c4 04             	test   $0x4,%ah
+  8051ca:	74 a0                	je     80516c <foreach_shared_region+0xa8>
+  8051cc:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8051d3:	40 
+  8051d4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8051d8:	4c 89 e7             	mov    %r12,%rdi
+  8051db:	41 ff d7             	call   *%r15
+  8051de:	eb 8c                	jmp    80516c <foreach_shared_region+0xa8>
+  8051e0:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8051e7:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  8051eb:	eb 46                	jmp    805233 <foreach_shared_region+0x16f>
+  8051ed:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8051f4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8051fa:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8051fe:	48 c1 e0 15          	shl    $0x15,%rax
+  805202:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805207:	49 09 c4             	or     %rax,%r12
+  80520a:	eb 1d                	jmp    805229 <foreach_shared_region+0x165>
+  80520c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805213:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805219:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80521d:	48 c1 e0 15          	shl    $0x15,%rax
+  805221:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805226:	49 09 c4             	or     %rax,%r12
+  805229:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  80522d:	0f 84 d3 00 00 00    	je     805306 <foreach_shared_region+0x242>
+  805233:	4c 89 e3             	mov    %r12,%rbx
+  805236:	48 c1 eb 15          	shr    $0x15,%rbx
+  80523a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805241:	01 00 00 
+  805244:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805248:	a8 01                	test   $0x1,%al
+  80524a:	74 a1                	je     8051ed <foreach_shared_region+0x129>
+  80524c:	a8 80                	test   $0x80,%al
+  80524e:	74 19                	je     805269 <foreach_shared_region+0x1a5>
+  805250:	f6 c4 04             	test   $0x4,%ah
+  805253:	74 b7                	je     80520c <foreach_shared_region+0x148>
+  805255:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80525c:	00 
+  80525d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805261:	4c 89 e7             	mov    %r12,%rdi
+  805264:	41 ff d7             	call   *%r15
+  805267:	eb a3                	jmp    80520c <foreach_shared_region+0x148>
+  805269:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80526f:	eb 3b                	jmp    8052ac <foreach_shared_region+0x1e8>
+  805271:	f6 c4 04             	test   $0x4,%ah
+  805274:	74 12                	je     805288 <foreach_shared_region+0x1c4>
+  805276:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80527d:	00 
+  80527e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805282:	4c 89 e7             	mov    %r12,%rdi
+  805285:	41 ff d7             	call   *%r15
+  805288:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80528f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805295:	48 83 c3 01          	add    $0x1,%rbx
+  805299:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80529d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8052a3:	49 09 dc             	or     %rbx,%r12
+  8052a6:	41 83 ed 01          	sub    $0x1,%r13d
+  8052aa:	74 2f                	je     8052db <foreach_shared_region+0x217>
+  8052ac:	4c 89 e3             	mov    %r12,%rbx
+  8052af:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8052b3:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8052b7:	a8 01                	test   $0x1,%al
+  8052b9:	75 b6                	jne    805271 <foreach_shared_region+0x1ad>
+  8052bb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8052c2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8052c8:	48 83 c3 01          	add    $0x1,%rbx
+  8052cc:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8052d0:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8052d6:	49 09 dc             	or     %rbx,%r12
+  8052d9:	eb cb                	jmp    8052a6 <foreach_shared_region+0x1e2>
+  8052db:	4c 89 e0             	mov    %r12,%rax
+  8052de:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8052e4:	49 c1 ec 15          	shr    $0x15,%r12
+  8052e8:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8052ef:	49 83 c4 01          	add    $0x1,%r12
+  8052f3:	49 c1 e4 15          	shl    $0x15,%r12
+  8052f7:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8052fe:	49 09 c4             	or     %rax,%r12
+  805301:	e9 23 ff ff ff       	jmp    805229 <foreach_shared_region+0x165>
+  805306:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  80530a:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  805311:	ff ff ff 
+  805314:	4c 21 e0             	and    %r12,%rax
+  805317:	49 c1 ec 1e          	shr    $0x1e,%r12
+  80531b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805322:	49 83 c4 01          	add    $0x1,%r12
+  805326:	49 c1 e4 1e          	shl    $0x1e,%r12
+  80532a:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  805331:	00 00 00 
+  805334:	49 21 d4             	and    %rdx,%r12
+  805337:	49 09 c4             	or     %rax,%r12
+  80533a:	e9 5d fe ff ff       	jmp    80519c <foreach_shared_region+0xd8>
+  80533f:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  805346:	00 ff ff 
+  805349:	4c 21 e0             	and    %r12,%rax
+  80534c:	49 c1 ec 27          	shr    $0x27,%r12
+  805350:	49 83 c4 01          	add    $0x1,%r12
+  805354:	49 c1 e4 27          	shl    $0x27,%r12
+  805358:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80535f:	ff 00 00 
+  805362:	49 21 d4             	and    %rdx,%r12
+  805365:	49 09 c4             	or     %rax,%r12
+  805368:	41 83 ed 01          	sub    $0x1,%r13d
+  80536c:	74 48                	je     8053b6 <foreach_shared_region+0x2f2>
+  80536e:	4c 89 e0             	mov    %r12,%rax
+  805371:	48 c1 e8 27          	shr    $0x27,%rax
+  805375:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80537c:	01 00 00 
+  80537f:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  805383:	f6 c2 01             	test   $0x1,%dl
+  805386:	0f 85 a5 fd ff ff    	jne    805131 <foreach_shared_region+0x6d>
+  80538c:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805393:	00 ff ff 
+  805396:	4c 21 e2             	and    %r12,%rdx
+  805399:	48 83 c0 01          	add    $0x1,%rax
+  80539d:	48 c1 e0 27          	shl    $0x27,%rax
+  8053a1:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8053a8:	ff 00 00 
+  8053ab:	48 21 c8             	and    %rcx,%rax
+  8053ae:	48 09 d0             	or     %rdx,%rax
+  8053b1:	49 89 c4             	mov    %rax,%r12
+  8053b4:	eb b2                	jmp    805368 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8053b6:	4d 85 e4             	test   %r12,%r12
+  8053b9:	75 14                	jne    8053cf <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8053bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053c0:	48 83 c4 28          	add    $0x28,%rsp
+  8053c4:	5b                   	pop    %rbx
+  8053c5:	41 5c                	pop    %r12
+  8053c7:	41 5d                	pop    %r13
+  8053c9:	41 5e                	pop    %r14
+  8053cb:	41 5f                	pop    %r15
+  8053cd:	5d                   	pop    %rbp
+  8053ce:	c3                   	ret
+    assert(addr == 0);
+  8053cf:	48 b9 5b 71 80 00 00 	movabs $0x80715b,%rcx
+  8053d6:	00 00 00 
+  8053d9:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  8053e0:	00 00 00 
+  8053e3:	be 67 00 00 00       	mov    $0x67,%esi
+  8053e8:	48 bf 50 71 80 00 00 	movabs $0x807150,%rdi
+  8053ef:	00 00 00 
+  8053f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053f7:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  8053fe:	00 00 00 
+  805401:	41 ff d0             	call   *%r8
+
+0000000000805404 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  805404:	49 b8 20 b4 80 01 00 	movabs $0x180b420,%r8
+  80540b:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80540e:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  805414:	eb 33                	jmp    805449 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805416:	48 83 c0 20          	add    $0x20,%rax
+  80541a:	4c 39 c0             	cmp    %r8,%rax
+  80541d:	74 25                	je     805444 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  80541f:	48 8b 10             	mov    (%rax),%rdx
+  805422:	48 85 d2             	test   %rdx,%rdx
+  805425:	74 ef                	je     805416 <mmap_place+0x12>
+  805427:	48 89 d1             	mov    %rdx,%rcx
+  80542a:	48 03 48 08          	add    0x8(%rax),%rcx
+  80542e:	48 39 cf             	cmp    %rcx,%rdi
+  805431:	73 e3                	jae    805416 <mmap_place+0x12>
+  805433:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  805437:	4c 39 ca             	cmp    %r9,%rdx
+  80543a:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  80543e:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  805442:	eb d2                	jmp    805416 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  805444:	45 84 d2             	test   %r10b,%r10b
+  805447:	74 12                	je     80545b <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805449:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805450:	00 00 00 
+        moved = 0;
+  805453:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  805459:	eb c4                	jmp    80541f <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  80545b:	48 01 fe             	add    %rdi,%rsi
+  80545e:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  805465:	00 00 00 
+  805468:	48 39 f0             	cmp    %rsi,%rax
+  80546b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805470:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  805474:	c3                   	ret
+
+0000000000805475 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  805475:	55                   	push   %rbp
+  805476:	48 89 e5             	mov    %rsp,%rbp
+  805479:	41 57                	push   %r15
+  80547b:	41 56                	push   %r14
+  80547d:	41 55                	push   %r13
+  80547f:	41 54                	push   %r12
+  805481:	53                   	push   %rbx
+  805482:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  805486:	48 8b 1f             	mov    (%rdi),%rbx
+  805489:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805490:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805497:	00 00 00 
+  80549a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80549f:	eb 12                	jmp    8054b3 <mmap_pgfault+0x3e>
+  8054a1:	48 83 c2 01          	add    $0x1,%rdx
+  8054a5:	48 83 c0 20          	add    $0x20,%rax
+  8054a9:	48 83 fa 20          	cmp    $0x20,%rdx
+  8054ad:	0f 84 04 01 00 00    	je     8055b7 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8054b3:	48 8b 08             	mov    (%rax),%rcx
+  8054b6:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8054ba:	48 39 de             	cmp    %rbx,%rsi
+  8054bd:	73 e2                	jae    8054a1 <mmap_pgfault+0x2c>
+  8054bf:	48 03 48 08          	add    0x8(%rax),%rcx
+  8054c3:	48 39 cb             	cmp    %rcx,%rbx
+  8054c6:	73 d9                	jae    8054a1 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8054c8:	48 c1 e2 05          	shl    $0x5,%rdx
+  8054cc:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8054d3:	00 00 00 
+  8054d6:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8054da:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8054de:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8054e2:	f6 c2 01             	test   $0x1,%dl
+  8054e5:	0f 84 e0 00 00 00    	je     8055cb <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  8054eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f0:	f6 c2 02             	test   $0x2,%dl
+  8054f3:	0f 84 c3 00 00 00    	je     8055bc <mmap_pgfault+0x147>
+  8054f9:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805500:	ff ff ff 
+  805503:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805507:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80550e:	00 00 00 
+  805511:	48 39 ca             	cmp    %rcx,%rdx
+  805514:	0f 85 a2 00 00 00    	jne    8055bc <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  80551a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80551f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805524:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  80552b:	00 00 00 
+  80552e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805533:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  80553a:	00 00 00 
+  80553d:	ff d0                	call   *%rax
+  80553f:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  805541:	b8 00 00 00 00       	mov    $0x0,%eax
+  805546:	85 d2                	test   %edx,%edx
+  805548:	78 72                	js     8055bc <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  80554a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80554f:	48 89 de             	mov    %rbx,%rsi
+  805552:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  805559:	00 00 00 
+  80555c:	4c 89 e7             	mov    %r12,%rdi
+  80555f:	48 b8 94 2e 80 00 00 	movabs $0x802e94,%rax
+  805566:	00 00 00 
+  805569:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  80556b:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  805571:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805577:	48 89 d9             	mov    %rbx,%rcx
+  80557a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80557f:	4c 89 e6             	mov    %r12,%rsi
+  805582:	bf 00 00 00 00       	mov    $0x0,%edi
+  805587:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  80558e:	00 00 00 
+  805591:	ff d0                	call   *%rax
+  805593:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805595:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80559a:	4c 89 e6             	mov    %r12,%rsi
+  80559d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055a2:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  8055a9:	00 00 00 
+  8055ac:	ff d0                	call   *%rax
+    return res >= 0;
+  8055ae:	89 d8                	mov    %ebx,%eax
+  8055b0:	f7 d0                	not    %eax
+  8055b2:	c1 e8 1f             	shr    $0x1f,%eax
+  8055b5:	eb 05                	jmp    8055bc <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8055b7:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8055bc:	48 83 c4 18          	add    $0x18,%rsp
+  8055c0:	5b                   	pop    %rbx
+  8055c1:	41 5c                	pop    %r12
+  8055c3:	41 5d                	pop    %r13
+  8055c5:	41 5e                	pop    %r14
+  8055c7:	41 5f                	pop    %r15
+  8055c9:	5d                   	pop    %rbp
+  8055ca:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  8055cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055cf:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  8055d3:	4c 03 30             	add    (%rax),%r14
+  8055d6:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  8055dd:	49 39 c6             	cmp    %rax,%r14
+  8055e0:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8055e4:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  8055eb:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8055f1:	49 bf af 50 80 00 00 	movabs $0x8050af,%r15
+  8055f8:	00 00 00 
+  8055fb:	4d 39 f4             	cmp    %r14,%r12
+  8055fe:	73 1d                	jae    80561d <mmap_pgfault+0x1a8>
+  805600:	4c 89 e7             	mov    %r12,%rdi
+  805603:	41 ff d7             	call   *%r15
+  805606:	84 c0                	test   %al,%al
+  805608:	75 13                	jne    80561d <mmap_pgfault+0x1a8>
+  80560a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805611:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805618:	4d 39 f4             	cmp    %r14,%r12
+  80561b:	72 e3                	jb     805600 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80561d:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805623:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805627:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80562b:	74 2a                	je     805657 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80562d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805631:	89 de                	mov    %ebx,%esi
+  805633:	2b 30                	sub    (%rax),%esi
+  805635:	03 70 1c             	add    0x1c(%rax),%esi
+  805638:	8b 78 18             	mov    0x18(%rax),%edi
+  80563b:	4c 89 e9             	mov    %r13,%rcx
+  80563e:	48 89 da             	mov    %rbx,%rdx
+  805641:	48 b8 0d 48 80 00 00 	movabs $0x80480d,%rax
+  805648:	00 00 00 
+  80564b:	ff d0                	call   *%rax
+    return res > 0;
+  80564d:	85 c0                	test   %eax,%eax
+  80564f:	0f 9f c0             	setg   %al
+  805652:	e9 65 ff ff ff       	jmp    8055bc <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805657:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  80565b:	eb d0                	jmp    80562d <mmap_pgfault+0x1b8>
+
+000000000080565d <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  80565d:	55                   	push   %rbp
+  80565e:	48 89 e5             	mov    %rsp,%rbp
+  805661:	41 57                	push   %r15
+  805663:	41 56                	push   %r14
+  805665:	41 55                	push   %r13
+  805667:	41 54                	push   %r12
+  805669:	53                   	push   %rbx
+  80566a:	48 83 ec 28          	sub    $0x28,%rsp
+  80566e:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  805672:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  805675:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80567c:	ff ff ff 
+  80567f:	48 23 57 10          	and    0x10(%rdi),%rdx
+  805683:	b8 00 00 00 00       	mov    $0x0,%eax
+  805688:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80568f:	00 00 00 
+  805692:	48 39 ca             	cmp    %rcx,%rdx
+  805695:	0f 85 e5 00 00 00    	jne    805780 <mmap_writeback+0x123>
+  80569b:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80569e:	4c 39 ee             	cmp    %r13,%rsi
+  8056a1:	0f 83 e8 00 00 00    	jae    80578f <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8056a7:	49 be af 50 80 00 00 	movabs $0x8050af,%r14
+  8056ae:	00 00 00 
+  8056b1:	49 bf 96 50 80 00 00 	movabs $0x805096,%r15
+  8056b8:	00 00 00 
+  8056bb:	eb 10                	jmp    8056cd <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8056bd:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  8056c4:	4d 39 ec             	cmp    %r13,%r12
+  8056c7:	0f 83 ae 00 00 00    	jae    80577b <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8056cd:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8056d1:	4c 89 e7             	mov    %r12,%rdi
+  8056d4:	41 ff d6             	call   *%r14
+  8056d7:	84 c0                	test   %al,%al
+  8056d9:	74 e2                	je     8056bd <mmap_writeback+0x60>
+  8056db:	4c 89 e7             	mov    %r12,%rdi
+  8056de:	41 ff d7             	call   *%r15
+  8056e1:	84 c0                	test   %al,%al
+  8056e3:	74 d8                	je     8056bd <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8056e5:	4c 89 e3             	mov    %r12,%rbx
+  8056e8:	4d 39 ec             	cmp    %r13,%r12
+  8056eb:	73 20                	jae    80570d <mmap_writeback+0xb0>
+  8056ed:	48 89 df             	mov    %rbx,%rdi
+  8056f0:	41 ff d6             	call   *%r14
+  8056f3:	84 c0                	test   %al,%al
+  8056f5:	74 16                	je     80570d <mmap_writeback+0xb0>
+  8056f7:	48 89 df             	mov    %rbx,%rdi
+  8056fa:	41 ff d7             	call   *%r15
+  8056fd:	84 c0                	test   %al,%al
+  8056ff:	74 0c                	je     80570d <mmap_writeback+0xb0>
+  805701:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805708:	4c 39 eb             	cmp    %r13,%rbx
+  80570b:	72 e0                	jb     8056ed <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80570d:	48 89 d9             	mov    %rbx,%rcx
+  805710:	4c 29 e1             	sub    %r12,%rcx
+  805713:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805717:	44 89 e6             	mov    %r12d,%esi
+  80571a:	2b 30                	sub    (%rax),%esi
+  80571c:	49 89 c4             	mov    %rax,%r12
+  80571f:	03 70 1c             	add    0x1c(%rax),%esi
+  805722:	8b 78 18             	mov    0x18(%rax),%edi
+  805725:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  805729:	48 89 ca             	mov    %rcx,%rdx
+  80572c:	48 b8 96 48 80 00 00 	movabs $0x804896,%rax
+  805733:	00 00 00 
+  805736:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805738:	85 c0                	test   %eax,%eax
+  80573a:	78 44                	js     805780 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80573c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805741:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805744:	41 89 c1             	mov    %eax,%r9d
+  805747:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  80574e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805752:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805756:	ba 00 00 00 00       	mov    $0x0,%edx
+  80575b:	48 89 ce             	mov    %rcx,%rsi
+  80575e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805763:	48 b8 af 32 80 00 00 	movabs $0x8032af,%rax
+  80576a:	00 00 00 
+  80576d:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  80576f:	85 c0                	test   %eax,%eax
+  805771:	78 0d                	js     805780 <mmap_writeback+0x123>
+  805773:	49 89 dc             	mov    %rbx,%r12
+  805776:	e9 49 ff ff ff       	jmp    8056c4 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  80577b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805780:	48 83 c4 28          	add    $0x28,%rsp
+  805784:	5b                   	pop    %rbx
+  805785:	41 5c                	pop    %r12
+  805787:	41 5d                	pop    %r13
+  805789:	41 5e                	pop    %r14
+  80578b:	41 5f                	pop    %r15
+  80578d:	5d                   	pop    %rbp
+  80578e:	c3                   	ret
+    return 0;
+  80578f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805794:	eb ea                	jmp    805780 <mmap_writeback+0x123>
+
+0000000000805796 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805796:	55                   	push   %rbp
+  805797:	48 89 e5             	mov    %rsp,%rbp
+  80579a:	41 57                	push   %r15
+  80579c:	41 56                	push   %r14
+  80579e:	41 55                	push   %r13
+  8057a0:	41 54                	push   %r12
+  8057a2:	53                   	push   %rbx
+  8057a3:	48 83 ec 38          	sub    $0x38,%rsp
+  8057a7:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8057ab:	48 85 f6             	test   %rsi,%rsi
+  8057ae:	0f 84 0c 02 00 00    	je     8059c0 <mmap+0x22a>
+  8057b4:	49 89 ff             	mov    %rdi,%r15
+  8057b7:	49 89 f4             	mov    %rsi,%r12
+  8057ba:	41 89 d5             	mov    %edx,%r13d
+  8057bd:	41 89 ce             	mov    %ecx,%r14d
+  8057c0:	44 89 cb             	mov    %r9d,%ebx
+  8057c3:	45 85 c9             	test   %r9d,%r9d
+  8057c6:	0f 88 f4 01 00 00    	js     8059c0 <mmap+0x22a>
+  8057cc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8057d3:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  8057da:	0f 85 e7 01 00 00    	jne    8059c7 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  8057e0:	83 e2 fd             	and    $0xfffffffd,%edx
+  8057e3:	83 fa 04             	cmp    $0x4,%edx
+  8057e6:	0f 85 db 01 00 00    	jne    8059c7 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  8057ec:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8057ef:	83 fa 01             	cmp    $0x1,%edx
+  8057f2:	0f 87 cf 01 00 00    	ja     8059c7 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  8057f8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8057fc:	44 89 c7             	mov    %r8d,%edi
+  8057ff:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  805806:	00 00 00 
+  805809:	ff d0                	call   *%rax
+  80580b:	89 c2                	mov    %eax,%edx
+  80580d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805814:	85 d2                	test   %edx,%edx
+  805816:	0f 88 ab 01 00 00    	js     8059c7 <mmap+0x231>
+  80581c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805820:	48 b9 60 80 80 00 00 	movabs $0x808060,%rcx
+  805827:	00 00 00 
+  80582a:	8b 09                	mov    (%rcx),%ecx
+  80582c:	39 0a                	cmp    %ecx,(%rdx)
+  80582e:	0f 85 93 01 00 00    	jne    8059c7 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805834:	8b 52 08             	mov    0x8(%rdx),%edx
+  805837:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80583a:	83 fa 01             	cmp    $0x1,%edx
+  80583d:	0f 84 84 01 00 00    	je     8059c7 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805843:	41 83 fe 01          	cmp    $0x1,%r14d
+  805847:	74 42                	je     80588b <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805849:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805850:	4c 89 e6             	mov    %r12,%rsi
+  805853:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80585a:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  80585e:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805862:	4d 85 ff             	test   %r15,%r15
+  805865:	74 67                	je     8058ce <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805867:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  80586e:	75 0f                	jne    80587f <mmap+0xe9>
+  805870:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805877:	00 00 00 
+  80587a:	49 39 c7             	cmp    %rax,%r15
+  80587d:	77 1b                	ja     80589a <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80587f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805886:	e9 3c 01 00 00       	jmp    8059c7 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80588b:	41 f6 c5 02          	test   $0x2,%r13b
+  80588f:	74 b8                	je     805849 <mmap+0xb3>
+  805891:	85 d2                	test   %edx,%edx
+  805893:	75 b4                	jne    805849 <mmap+0xb3>
+  805895:	e9 2d 01 00 00       	jmp    8059c7 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80589a:	4c 89 ff             	mov    %r15,%rdi
+  80589d:	48 b8 04 54 80 00 00 	movabs $0x805404,%rax
+  8058a4:	00 00 00 
+  8058a7:	ff d0                	call   *%rax
+  8058a9:	48 89 c2             	mov    %rax,%rdx
+  8058ac:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8058b3:	49 39 d7             	cmp    %rdx,%r15
+  8058b6:	0f 85 0b 01 00 00    	jne    8059c7 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8058bc:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8058c3:	00 00 00 
+  8058c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8058cc:	eb 44                	jmp    805912 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8058ce:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8058d2:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8058d9:	00 00 00 
+  8058dc:	48 b8 04 54 80 00 00 	movabs $0x805404,%rax
+  8058e3:	00 00 00 
+  8058e6:	ff d0                	call   *%rax
+  8058e8:	48 89 c7             	mov    %rax,%rdi
+  8058eb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8058ef:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8058f6:	48 85 ff             	test   %rdi,%rdi
+  8058f9:	75 c1                	jne    8058bc <mmap+0x126>
+  8058fb:	e9 c7 00 00 00       	jmp    8059c7 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805900:	49 83 c4 01          	add    $0x1,%r12
+  805904:	48 83 c0 20          	add    $0x20,%rax
+  805908:	49 83 fc 20          	cmp    $0x20,%r12
+  80590c:	0f 84 a5 00 00 00    	je     8059b7 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805912:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805916:	75 e8                	jne    805900 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805918:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80591c:	48 b8 50 3b 80 00 00 	movabs $0x803b50,%rax
+  805923:	00 00 00 
+  805926:	ff d0                	call   *%rax
+  805928:	89 c2                	mov    %eax,%edx
+  80592a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805931:	85 d2                	test   %edx,%edx
+  805933:	0f 88 8e 00 00 00    	js     8059c7 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805939:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80593d:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  805944:	00 00 00 
+  805947:	ff d0                	call   *%rax
+  805949:	89 c6                	mov    %eax,%esi
+  80594b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80594e:	48 b8 70 3d 80 00 00 	movabs $0x803d70,%rax
+  805955:	00 00 00 
+  805958:	ff d0                	call   *%rax
+  80595a:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80595d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805964:	45 85 ff             	test   %r15d,%r15d
+  805967:	78 5e                	js     8059c7 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805969:	49 c1 e4 05          	shl    $0x5,%r12
+  80596d:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  805974:	00 00 00 
+  805977:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80597a:	48 bf 75 54 80 00 00 	movabs $0x805475,%rdi
+  805981:	00 00 00 
+  805984:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  80598b:	00 00 00 
+  80598e:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805990:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805994:	49 89 04 24          	mov    %rax,(%r12)
+  805998:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80599c:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8059a1:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8059a6:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8059ab:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8059b0:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8059b5:	eb 10                	jmp    8059c7 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8059b7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8059be:	eb 07                	jmp    8059c7 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8059c0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8059c7:	48 83 c4 38          	add    $0x38,%rsp
+  8059cb:	5b                   	pop    %rbx
+  8059cc:	41 5c                	pop    %r12
+  8059ce:	41 5d                	pop    %r13
+  8059d0:	41 5e                	pop    %r14
+  8059d2:	41 5f                	pop    %r15
+  8059d4:	5d                   	pop    %rbp
+  8059d5:	c3                   	ret
+
+00000000008059d6 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8059d6:	55                   	push   %rbp
+  8059d7:	48 89 e5             	mov    %rsp,%rbp
+  8059da:	41 57                	push   %r15
+  8059dc:	41 56                	push   %r14
+  8059de:	41 55                	push   %r13
+  8059e0:	41 54                	push   %r12
+  8059e2:	53                   	push   %rbx
+  8059e3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8059e7:	49 89 fe             	mov    %rdi,%r14
+  8059ea:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8059f1:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8059f8:	00 
+  8059f9:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805a00:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  805a07:	00 00 00 
+  805a0a:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805a11:	49 bf 5d 56 80 00 00 	movabs $0x80565d,%r15
+  805a18:	00 00 00 
+  805a1b:	eb 09                	jmp    805a26 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805a1d:	48 83 c3 20          	add    $0x20,%rbx
+  805a21:	4c 39 eb             	cmp    %r13,%rbx
+  805a24:	74 33                	je     805a59 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805a26:	48 89 df             	mov    %rbx,%rdi
+  805a29:	48 8b 33             	mov    (%rbx),%rsi
+  805a2c:	4c 39 e6             	cmp    %r12,%rsi
+  805a2f:	73 ec                	jae    805a1d <msync+0x47>
+  805a31:	48 85 f6             	test   %rsi,%rsi
+  805a34:	74 e7                	je     805a1d <msync+0x47>
+  805a36:	48 89 f2             	mov    %rsi,%rdx
+  805a39:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805a3d:	49 39 d6             	cmp    %rdx,%r14
+  805a40:	73 db                	jae    805a1d <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805a42:	4c 39 e2             	cmp    %r12,%rdx
+  805a45:	49 0f 47 d4          	cmova  %r12,%rdx
+  805a49:	4c 39 f6             	cmp    %r14,%rsi
+  805a4c:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805a50:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805a53:	85 c0                	test   %eax,%eax
+  805a55:	79 c6                	jns    805a1d <msync+0x47>
+  805a57:	eb 05                	jmp    805a5e <msync+0x88>
+    }
+
+    return 0;
+  805a59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a5e:	48 83 c4 08          	add    $0x8,%rsp
+  805a62:	5b                   	pop    %rbx
+  805a63:	41 5c                	pop    %r12
+  805a65:	41 5d                	pop    %r13
+  805a67:	41 5e                	pop    %r14
+  805a69:	41 5f                	pop    %r15
+  805a6b:	5d                   	pop    %rbp
+  805a6c:	c3                   	ret
+
+0000000000805a6d <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805a6d:	55                   	push   %rbp
+  805a6e:	48 89 e5             	mov    %rsp,%rbp
+  805a71:	41 57                	push   %r15
+  805a73:	41 56                	push   %r14
+  805a75:	41 55                	push   %r13
+  805a77:	41 54                	push   %r12
+  805a79:	53                   	push   %rbx
+  805a7a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805a7e:	49 89 ff             	mov    %rdi,%r15
+  805a81:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805a88:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805a8f:	00 
+  805a90:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805a97:	48 bb 20 b0 80 01 00 	movabs $0x180b020,%rbx
+  805a9e:	00 00 00 
+  805aa1:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805aa8:	48 89 d8             	mov    %rbx,%rax
+  805aab:	eb 09                	jmp    805ab6 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805aad:	48 83 c0 20          	add    $0x20,%rax
+  805ab1:	4c 39 f0             	cmp    %r14,%rax
+  805ab4:	74 40                	je     805af6 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805ab6:	48 8b 10             	mov    (%rax),%rdx
+  805ab9:	4c 39 e2             	cmp    %r12,%rdx
+  805abc:	73 ef                	jae    805aad <munmap+0x40>
+  805abe:	48 85 d2             	test   %rdx,%rdx
+  805ac1:	74 ea                	je     805aad <munmap+0x40>
+  805ac3:	48 89 d7             	mov    %rdx,%rdi
+  805ac6:	48 03 78 08          	add    0x8(%rax),%rdi
+  805aca:	49 39 ff             	cmp    %rdi,%r15
+  805acd:	73 de                	jae    805aad <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805acf:	49 39 fc             	cmp    %rdi,%r12
+  805ad2:	72 05                	jb     805ad9 <munmap+0x6c>
+  805ad4:	4c 39 fa             	cmp    %r15,%rdx
+  805ad7:	73 d4                	jae    805aad <munmap+0x40>
+  805ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805ade:	48 83 c4 08          	add    $0x8,%rsp
+  805ae2:	5b                   	pop    %rbx
+  805ae3:	41 5c                	pop    %r12
+  805ae5:	41 5d                	pop    %r13
+  805ae7:	41 5e                	pop    %r14
+  805ae9:	41 5f                	pop    %r15
+  805aeb:	5d                   	pop    %rbp
+  805aec:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805aed:	48 83 c3 20          	add    $0x20,%rbx
+  805af1:	4c 39 f3             	cmp    %r14,%rbx
+  805af4:	74 5c                	je     805b52 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805af6:	48 8b 33             	mov    (%rbx),%rsi
+  805af9:	4c 39 e6             	cmp    %r12,%rsi
+  805afc:	73 ef                	jae    805aed <munmap+0x80>
+  805afe:	48 85 f6             	test   %rsi,%rsi
+  805b01:	74 ea                	je     805aed <munmap+0x80>
+  805b03:	48 89 f2             	mov    %rsi,%rdx
+  805b06:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805b0a:	49 39 d7             	cmp    %rdx,%r15
+  805b0d:	73 de                	jae    805aed <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805b0f:	48 89 df             	mov    %rbx,%rdi
+  805b12:	48 b8 5d 56 80 00 00 	movabs $0x80565d,%rax
+  805b19:	00 00 00 
+  805b1c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805b1e:	85 c0                	test   %eax,%eax
+  805b20:	78 bc                	js     805ade <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805b22:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805b26:	48 8b 33             	mov    (%rbx),%rsi
+  805b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b2e:	48 b8 1a 33 80 00 00 	movabs $0x80331a,%rax
+  805b35:	00 00 00 
+  805b38:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805b3a:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805b3d:	48 b8 15 3d 80 00 00 	movabs $0x803d15,%rax
+  805b44:	00 00 00 
+  805b47:	ff d0                	call   *%rax
+        reg->start = 0;
+  805b49:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805b50:	eb 9b                	jmp    805aed <munmap+0x80>
+    return 0;
+  805b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b57:	eb 85                	jmp    805ade <munmap+0x71>
+
+0000000000805b59 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b5e:	c3                   	ret
+
+0000000000805b5f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805b5f:	55                   	push   %rbp
+  805b60:	48 89 e5             	mov    %rsp,%rbp
+  805b63:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805b66:	48 be 65 71 80 00 00 	movabs $0x807165,%rsi
+  805b6d:	00 00 00 
+  805b70:	48 b8 dd 2a 80 00 00 	movabs $0x802add,%rax
+  805b77:	00 00 00 
+  805b7a:	ff d0                	call   *%rax
+    return 0;
+}
+  805b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b81:	5d                   	pop    %rbp
+  805b82:	c3                   	ret
+
+0000000000805b83 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805b83:	55                   	push   %rbp
+  805b84:	48 89 e5             	mov    %rsp,%rbp
+  805b87:	41 57                	push   %r15
+  805b89:	41 56                	push   %r14
+  805b8b:	41 55                	push   %r13
+  805b8d:	41 54                	push   %r12
+  805b8f:	53                   	push   %rbx
+  805b90:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805b97:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805b9e:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805ba5:	00 00 00 00 
+  805ba9:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805bb0:	00 00 00 00 
+  805bb4:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805bbb:	00 00 00 00 
+  805bbf:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805bc6:	00 00 00 00 
+  805bca:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805bd1:	00 00 00 00 
+  805bd5:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805bdc:	00 00 00 00 
+  805be0:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805be7:	00 
+  805be8:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805bef:	00 
+  805bf0:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805bf7:	00 
+  805bf8:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805bff:	00 
+  805c00:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805c07:	00 
+  805c08:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805c0f:	00 
+  805c10:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805c17:	00 
+  805c18:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805c1f:	00 
+  805c20:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805c27:	00 
+  805c28:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805c2f:	00 
+    for (res = 0; res < n; res += inc) {
+  805c30:	48 85 d2             	test   %rdx,%rdx
+  805c33:	74 7a                	je     805caf <devcons_write+0x12c>
+  805c35:	49 89 d6             	mov    %rdx,%r14
+  805c38:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805c3e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805c43:	49 bf 2d 2e 80 00 00 	movabs $0x802e2d,%r15
+  805c4a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805c4d:	4c 89 f3             	mov    %r14,%rbx
+  805c50:	48 29 f3             	sub    %rsi,%rbx
+  805c53:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805c58:	48 39 c3             	cmp    %rax,%rbx
+  805c5b:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805c5f:	4c 63 eb             	movslq %ebx,%r13
+  805c62:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805c69:	48 01 c6             	add    %rax,%rsi
+  805c6c:	4c 89 ea             	mov    %r13,%rdx
+  805c6f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805c76:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805c79:	4c 89 ee             	mov    %r13,%rsi
+  805c7c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805c83:	48 b8 5a 30 80 00 00 	movabs $0x80305a,%rax
+  805c8a:	00 00 00 
+  805c8d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805c8f:	41 01 dc             	add    %ebx,%r12d
+  805c92:	49 63 f4             	movslq %r12d,%rsi
+  805c95:	4c 39 f6             	cmp    %r14,%rsi
+  805c98:	72 b3                	jb     805c4d <devcons_write+0xca>
+    return res;
+  805c9a:	49 63 c4             	movslq %r12d,%rax
+}
+  805c9d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805ca4:	5b                   	pop    %rbx
+  805ca5:	41 5c                	pop    %r12
+  805ca7:	41 5d                	pop    %r13
+  805ca9:	41 5e                	pop    %r14
+  805cab:	41 5f                	pop    %r15
+  805cad:	5d                   	pop    %rbp
+  805cae:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805caf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805cb5:	eb e3                	jmp    805c9a <devcons_write+0x117>
+
+0000000000805cb7 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805cb7:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805cba:	ba 00 00 00 00       	mov    $0x0,%edx
+  805cbf:	48 85 c0             	test   %rax,%rax
+  805cc2:	74 55                	je     805d19 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805cc4:	55                   	push   %rbp
+  805cc5:	48 89 e5             	mov    %rsp,%rbp
+  805cc8:	41 55                	push   %r13
+  805cca:	41 54                	push   %r12
+  805ccc:	53                   	push   %rbx
+  805ccd:	48 83 ec 08          	sub    $0x8,%rsp
+  805cd1:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805cd4:	48 bb 8d 30 80 00 00 	movabs $0x80308d,%rbx
+  805cdb:	00 00 00 
+  805cde:	49 bc a1 31 80 00 00 	movabs $0x8031a1,%r12
+  805ce5:	00 00 00 
+  805ce8:	eb 03                	jmp    805ced <devcons_read+0x36>
+  805cea:	41 ff d4             	call   *%r12
+  805ced:	ff d3                	call   *%rbx
+  805cef:	85 c0                	test   %eax,%eax
+  805cf1:	74 f7                	je     805cea <devcons_read+0x33>
+    if (c < 0) return c;
+  805cf3:	48 63 d0             	movslq %eax,%rdx
+  805cf6:	78 13                	js     805d0b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805cf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  805cfd:	83 f8 04             	cmp    $0x4,%eax
+  805d00:	74 09                	je     805d0b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805d02:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805d06:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805d0b:	48 89 d0             	mov    %rdx,%rax
+  805d0e:	48 83 c4 08          	add    $0x8,%rsp
+  805d12:	5b                   	pop    %rbx
+  805d13:	41 5c                	pop    %r12
+  805d15:	41 5d                	pop    %r13
+  805d17:	5d                   	pop    %rbp
+  805d18:	c3                   	ret
+  805d19:	48 89 d0             	mov    %rdx,%rax
+  805d1c:	c3                   	ret
+
+0000000000805d1d <cputchar>:
+cputchar(int ch) {
+  805d1d:	55                   	push   %rbp
+  805d1e:	48 89 e5             	mov    %rsp,%rbp
+  805d21:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805d25:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805d29:	be 01 00 00 00       	mov    $0x1,%esi
+  805d2e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805d32:	48 b8 5a 30 80 00 00 	movabs $0x80305a,%rax
+  805d39:	00 00 00 
+  805d3c:	ff d0                	call   *%rax
+}
+  805d3e:	c9                   	leave
+  805d3f:	c3                   	ret
+
+0000000000805d40 <getchar>:
+getchar(void) {
+  805d40:	55                   	push   %rbp
+  805d41:	48 89 e5             	mov    %rsp,%rbp
+  805d44:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805d48:	ba 01 00 00 00       	mov    $0x1,%edx
+  805d4d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805d51:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d56:	48 b8 93 3e 80 00 00 	movabs $0x803e93,%rax
+  805d5d:	00 00 00 
+  805d60:	ff d0                	call   *%rax
+  805d62:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805d64:	85 c0                	test   %eax,%eax
+  805d66:	78 06                	js     805d6e <getchar+0x2e>
+  805d68:	74 08                	je     805d72 <getchar+0x32>
+  805d6a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805d6e:	89 d0                	mov    %edx,%eax
+  805d70:	c9                   	leave
+  805d71:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805d72:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805d77:	eb f5                	jmp    805d6e <getchar+0x2e>
+
+0000000000805d79 <iscons>:
+iscons(int fdnum) {
+  805d79:	55                   	push   %rbp
+  805d7a:	48 89 e5             	mov    %rsp,%rbp
+  805d7d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805d81:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805d85:	48 b8 b0 3b 80 00 00 	movabs $0x803bb0,%rax
+  805d8c:	00 00 00 
+  805d8f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805d91:	85 c0                	test   %eax,%eax
+  805d93:	78 18                	js     805dad <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805d95:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805d99:	48 b8 e0 80 80 00 00 	movabs $0x8080e0,%rax
+  805da0:	00 00 00 
+  805da3:	8b 00                	mov    (%rax),%eax
+  805da5:	39 02                	cmp    %eax,(%rdx)
+  805da7:	0f 94 c0             	sete   %al
+  805daa:	0f b6 c0             	movzbl %al,%eax
+}
+  805dad:	c9                   	leave
+  805dae:	c3                   	ret
+
+0000000000805daf <opencons>:
+opencons(void) {
+  805daf:	55                   	push   %rbp
+  805db0:	48 89 e5             	mov    %rsp,%rbp
+  805db3:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805db7:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805dbb:	48 b8 50 3b 80 00 00 	movabs $0x803b50,%rax
+  805dc2:	00 00 00 
+  805dc5:	ff d0                	call   *%rax
+  805dc7:	85 c0                	test   %eax,%eax
+  805dc9:	78 49                	js     805e14 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805dcb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805dd0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805dd5:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805dde:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  805de5:	00 00 00 
+  805de8:	ff d0                	call   *%rax
+  805dea:	85 c0                	test   %eax,%eax
+  805dec:	78 26                	js     805e14 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805dee:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805df2:	a1 e0 80 80 00 00 00 	movabs 0x8080e0,%eax
+  805df9:	00 00 
+  805dfb:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805dfd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805e01:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805e08:	48 b8 22 3b 80 00 00 	movabs $0x803b22,%rax
+  805e0f:	00 00 00 
+  805e12:	ff d0                	call   *%rax
+}
+  805e14:	c9                   	leave
+  805e15:	c3                   	ret
+
+0000000000805e16 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805e16:	55                   	push   %rbp
+  805e17:	48 89 e5             	mov    %rsp,%rbp
+  805e1a:	41 56                	push   %r14
+  805e1c:	41 55                	push   %r13
+  805e1e:	41 54                	push   %r12
+  805e20:	53                   	push   %rbx
+  805e21:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e24:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805e2b:	00 00 00 
+  805e2e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805e32:	74 27                	je     805e5b <_handle_vectored_pagefault+0x45>
+  805e34:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805e39:	49 bd 20 b4 80 01 00 	movabs $0x180b420,%r13
+  805e40:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e43:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805e46:	4c 89 e7             	mov    %r12,%rdi
+  805e49:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805e4e:	84 c0                	test   %al,%al
+  805e50:	75 45                	jne    805e97 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805e52:	48 83 c3 01          	add    $0x1,%rbx
+  805e56:	49 3b 1e             	cmp    (%r14),%rbx
+  805e59:	72 eb                	jb     805e46 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805e5b:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805e62:	00 
+  805e63:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805e68:	4d 8b 04 24          	mov    (%r12),%r8
+  805e6c:	48 ba 78 71 80 00 00 	movabs $0x807178,%rdx
+  805e73:	00 00 00 
+  805e76:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805e7b:	48 bf a8 71 80 00 00 	movabs $0x8071a8,%rdi
+  805e82:	00 00 00 
+  805e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e8a:	49 ba 56 20 80 00 00 	movabs $0x802056,%r10
+  805e91:	00 00 00 
+  805e94:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805e97:	5b                   	pop    %rbx
+  805e98:	41 5c                	pop    %r12
+  805e9a:	41 5d                	pop    %r13
+  805e9c:	41 5e                	pop    %r14
+  805e9e:	5d                   	pop    %rbp
+  805e9f:	c3                   	ret
+
+0000000000805ea0 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805ea0:	55                   	push   %rbp
+  805ea1:	48 89 e5             	mov    %rsp,%rbp
+  805ea4:	53                   	push   %rbx
+  805ea5:	48 83 ec 08          	sub    $0x8,%rsp
+  805ea9:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805eac:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805eb1:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805eb8:	00 00 00 
+  805ebb:	80 38 00             	cmpb   $0x0,(%rax)
+  805ebe:	74 68                	je     805f28 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805ec0:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805ec7:	00 00 00 
+  805eca:	48 8b 08             	mov    (%rax),%rcx
+  805ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805ed2:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  805ed9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805edc:	48 85 c9             	test   %rcx,%rcx
+  805edf:	0f 84 e0 00 00 00    	je     805fc5 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805ee5:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805ee9:	0f 84 c9 00 00 00    	je     805fb8 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805eef:	48 83 c2 01          	add    $0x1,%rdx
+  805ef3:	48 39 ca             	cmp    %rcx,%rdx
+  805ef6:	75 ed                	jne    805ee5 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805ef8:	48 83 f9 08          	cmp    $0x8,%rcx
+  805efc:	0f 84 84 00 00 00    	je     805f86 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805f02:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805f06:	48 a3 68 b4 80 01 00 	movabs %rax,0x180b468
+  805f0d:	00 00 00 
+  805f10:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  805f17:	00 00 00 
+  805f1a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805f1e:	85 f6                	test   %esi,%esi
+  805f20:	0f 89 97 00 00 00    	jns    805fbd <add_pgfault_handler+0x11d>
+  805f26:	eb 63                	jmp    805f8b <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805f28:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805f2d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805f32:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805f39:	00 00 00 
+  805f3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f41:	48 b8 42 32 80 00 00 	movabs $0x803242,%rax
+  805f48:	00 00 00 
+  805f4b:	ff d0                	call   *%rax
+  805f4d:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805f4f:	85 c0                	test   %eax,%eax
+  805f51:	78 38                	js     805f8b <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805f53:	48 be a1 60 80 00 00 	movabs $0x8060a1,%rsi
+  805f5a:	00 00 00 
+  805f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f62:	48 b8 65 34 80 00 00 	movabs $0x803465,%rax
+  805f69:	00 00 00 
+  805f6c:	ff d0                	call   *%rax
+  805f6e:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805f70:	85 c0                	test   %eax,%eax
+  805f72:	78 17                	js     805f8b <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805f74:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805f7b:	00 00 00 
+  805f7e:	c6 00 01             	movb   $0x1,(%rax)
+  805f81:	e9 3a ff ff ff       	jmp    805ec0 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805f86:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805f8b:	89 f1                	mov    %esi,%ecx
+  805f8d:	48 ba b6 71 80 00 00 	movabs $0x8071b6,%rdx
+  805f94:	00 00 00 
+  805f97:	be 42 00 00 00       	mov    $0x42,%esi
+  805f9c:	48 bf a8 71 80 00 00 	movabs $0x8071a8,%rdi
+  805fa3:	00 00 00 
+  805fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fab:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  805fb2:	00 00 00 
+  805fb5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805fb8:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805fbd:	89 f0                	mov    %esi,%eax
+  805fbf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805fc3:	c9                   	leave
+  805fc4:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805fc5:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  805fcc:	00 00 00 
+  805fcf:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805fd6:	48 89 d8             	mov    %rbx,%rax
+  805fd9:	48 a3 20 b4 80 01 00 	movabs %rax,0x180b420
+  805fe0:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805fe3:	eb d8                	jmp    805fbd <add_pgfault_handler+0x11d>
+
+0000000000805fe5 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805fe5:	55                   	push   %rbp
+  805fe6:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805fe9:	48 b8 60 b4 80 01 00 	movabs $0x180b460,%rax
+  805ff0:	00 00 00 
+  805ff3:	80 38 00             	cmpb   $0x0,(%rax)
+  805ff6:	74 33                	je     80602b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805ff8:	48 a1 68 b4 80 01 00 	movabs 0x180b468,%rax
+  805fff:	00 00 00 
+  806002:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  806007:	48 ba 20 b4 80 01 00 	movabs $0x180b420,%rdx
+  80600e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806011:	48 85 c0             	test   %rax,%rax
+  806014:	0f 84 85 00 00 00    	je     80609f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80601a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80601e:	74 40                	je     806060 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806020:	48 83 c1 01          	add    $0x1,%rcx
+  806024:	48 39 c1             	cmp    %rax,%rcx
+  806027:	75 f1                	jne    80601a <remove_pgfault_handler+0x35>
+  806029:	eb 74                	jmp    80609f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80602b:	48 b9 ce 71 80 00 00 	movabs $0x8071ce,%rcx
+  806032:	00 00 00 
+  806035:	48 ba b6 70 80 00 00 	movabs $0x8070b6,%rdx
+  80603c:	00 00 00 
+  80603f:	be 48 00 00 00       	mov    $0x48,%esi
+  806044:	48 bf a8 71 80 00 00 	movabs $0x8071a8,%rdi
+  80604b:	00 00 00 
+  80604e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806053:	49 b8 56 20 80 00 00 	movabs $0x802056,%r8
+  80605a:	00 00 00 
+  80605d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  806060:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  806067:	00 
+  806068:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80606c:	48 29 ca             	sub    %rcx,%rdx
+  80606f:	48 b8 20 b4 80 01 00 	movabs $0x180b420,%rax
+  806076:	00 00 00 
+  806079:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80607d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  806082:	48 89 ce             	mov    %rcx,%rsi
+  806085:	48 b8 2d 2e 80 00 00 	movabs $0x802e2d,%rax
+  80608c:	00 00 00 
+  80608f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  806091:	48 b8 68 b4 80 01 00 	movabs $0x180b468,%rax
+  806098:	00 00 00 
+  80609b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80609f:	5d                   	pop    %rbp
+  8060a0:	c3                   	ret
+
+00000000008060a1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8060a1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8060a4:	48 b8 16 5e 80 00 00 	movabs $0x805e16,%rax
+  8060ab:	00 00 00 
+    call *%rax
+  8060ae:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8060b0:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8060b7:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8060b8:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8060bf:	00 
+    subq $8, %rcx
+  8060c0:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8060c4:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8060c7:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8060ce:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8060cf:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8060d3:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8060d7:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8060dc:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8060e1:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8060e6:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8060eb:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8060f0:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8060f5:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8060fa:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8060ff:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806104:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806109:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80610e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806113:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  806118:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  80611d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  806121:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  806125:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  806126:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  806127:	c3                   	ret
+
+0000000000806128 <__rodata_start>:
+  806128:	77 00                	ja     80612a <__rodata_start+0x2>
+  80612a:	72 62                	jb     80618e <__rodata_start+0x66>
+  80612c:	00 77 62             	add    %dh,0x62(%rdi)
+  80612f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  806132:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  806139:	00 
+  80613a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  806140:	b3 09                	mov    $0x9,%bl
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 ed                	add    %ch,%ch
+  806149:	0d 80 00 00 00       	or     $0x80,%eax
+  80614e:	00 00                	add    %al,(%rax)
+  806150:	ed                   	in     (%dx),%eax
+  806151:	0d 80 00 00 00       	or     $0x80,%eax
+  806156:	00 00                	add    %al,(%rax)
+  806158:	ed                   	in     (%dx),%eax
+  806159:	0d 80 00 00 00       	or     $0x80,%eax
+  80615e:	00 00                	add    %al,(%rax)
+  806160:	ed                   	in     (%dx),%eax
+  806161:	0d 80 00 00 00       	or     $0x80,%eax
+  806166:	00 00                	add    %al,(%rax)
+  806168:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80616d:	00 00                	add    %al,(%rax)
+  80616f:	00 ed                	add    %ch,%ch
+  806171:	0d 80 00 00 00       	or     $0x80,%eax
+  806176:	00 00                	add    %al,(%rax)
+  806178:	ed                   	in     (%dx),%eax
+  806179:	0d 80 00 00 00       	or     $0x80,%eax
+  80617e:	00 00                	add    %al,(%rax)
+  806180:	ed                   	in     (%dx),%eax
+  806181:	0d 80 00 00 00       	or     $0x80,%eax
+  806186:	00 00                	add    %al,(%rax)
+  806188:	ed                   	in     (%dx),%eax
+  806189:	0d 80 00 00 00       	or     $0x80,%eax
+  80618e:	00 00                	add    %al,(%rax)
+  806190:	ed                   	in     (%dx),%eax
+  806191:	0d 80 00 00 00       	or     $0x80,%eax
+  806196:	00 00                	add    %al,(%rax)
+  806198:	8c 0a                	mov    %cs,(%rdx)
+  80619a:	80 00 00             	addb   $0x0,(%rax)
+  80619d:	00 00                	add    %al,(%rax)
+  80619f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061a6:	00 00                	add    %al,(%rax)
+  8061a8:	8c 0a                	mov    %cs,(%rdx)
+  8061aa:	80 00 00             	addb   $0x0,(%rax)
+  8061ad:	00 00                	add    %al,(%rax)
+  8061af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061b6:	00 00                	add    %al,(%rax)
+  8061b8:	8c 0a                	mov    %cs,(%rdx)
+  8061ba:	80 00 00             	addb   $0x0,(%rax)
+  8061bd:	00 00                	add    %al,(%rax)
+  8061bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061c6:	00 00                	add    %al,(%rax)
+  8061c8:	8c 0a                	mov    %cs,(%rdx)
+  8061ca:	80 00 00             	addb   $0x0,(%rax)
+  8061cd:	00 00                	add    %al,(%rax)
+  8061cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061d6:	00 00                	add    %al,(%rax)
+  8061d8:	8c 0a                	mov    %cs,(%rdx)
+  8061da:	80 00 00             	addb   $0x0,(%rax)
+  8061dd:	00 00                	add    %al,(%rax)
+  8061df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8061e6:	00 00                	add    %al,(%rax)
+  8061e8:	ed                   	in     (%dx),%eax
+  8061e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061ee:	00 00                	add    %al,(%rax)
+  8061f0:	ed                   	in     (%dx),%eax
+  8061f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8061f6:	00 00                	add    %al,(%rax)
+  8061f8:	ed                   	in     (%dx),%eax
+  8061f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8061fe:	00 00                	add    %al,(%rax)
+  806200:	ed                   	in     (%dx),%eax
+  806201:	0d 80 00 00 00       	or     $0x80,%eax
+  806206:	00 00                	add    %al,(%rax)
+  806208:	ed                   	in     (%dx),%eax
+  806209:	0d 80 00 00 00       	or     $0x80,%eax
+  80620e:	00 00                	add    %al,(%rax)
+  806210:	ed                   	in     (%dx),%eax
+  806211:	0d 80 00 00 00       	or     $0x80,%eax
+  806216:	00 00                	add    %al,(%rax)
+  806218:	ed                   	in     (%dx),%eax
+  806219:	0d 80 00 00 00       	or     $0x80,%eax
+  80621e:	00 00                	add    %al,(%rax)
+  806220:	ed                   	in     (%dx),%eax
+  806221:	0d 80 00 00 00       	or     $0x80,%eax
+  806226:	00 00                	add    %al,(%rax)
+  806228:	ed                   	in     (%dx),%eax
+  806229:	0d 80 00 00 00       	or     $0x80,%eax
+  80622e:	00 00                	add    %al,(%rax)
+  806230:	ed                   	in     (%dx),%eax
+  806231:	0d 80 00 00 00       	or     $0x80,%eax
+  806236:	00 00                	add    %al,(%rax)
+  806238:	ed                   	in     (%dx),%eax
+  806239:	0d 80 00 00 00       	or     $0x80,%eax
+  80623e:	00 00                	add    %al,(%rax)
+  806240:	ed                   	in     (%dx),%eax
+  806241:	0d 80 00 00 00       	or     $0x80,%eax
+  806246:	00 00                	add    %al,(%rax)
+  806248:	ed                   	in     (%dx),%eax
+  806249:	0d 80 00 00 00       	or     $0x80,%eax
+  80624e:	00 00                	add    %al,(%rax)
+  806250:	ed                   	in     (%dx),%eax
+  806251:	0d 80 00 00 00       	or     $0x80,%eax
+  806256:	00 00                	add    %al,(%rax)
+  806258:	ed                   	in     (%dx),%eax
+  806259:	0d 80 00 00 00       	or     $0x80,%eax
+  80625e:	00 00                	add    %al,(%rax)
+  806260:	ed                   	in     (%dx),%eax
+  806261:	0d 80 00 00 00       	or     $0x80,%eax
+  806266:	00 00                	add    %al,(%rax)
+  806268:	ed                   	in     (%dx),%eax
+  806269:	0d 80 00 00 00       	or     $0x80,%eax
+  80626e:	00 00                	add    %al,(%rax)
+  806270:	ed                   	in     (%dx),%eax
+  806271:	0d 80 00 00 00       	or     $0x80,%eax
+  806276:	00 00                	add    %al,(%rax)
+  806278:	ed                   	in     (%dx),%eax
+  806279:	0d 80 00 00 00       	or     $0x80,%eax
+  80627e:	00 00                	add    %al,(%rax)
+  806280:	ed                   	in     (%dx),%eax
+  806281:	0d 80 00 00 00       	or     $0x80,%eax
+  806286:	00 00                	add    %al,(%rax)
+  806288:	ed                   	in     (%dx),%eax
+  806289:	0d 80 00 00 00       	or     $0x80,%eax
+  80628e:	00 00                	add    %al,(%rax)
+  806290:	ed                   	in     (%dx),%eax
+  806291:	0d 80 00 00 00       	or     $0x80,%eax
+  806296:	00 00                	add    %al,(%rax)
+  806298:	ed                   	in     (%dx),%eax
+  806299:	0d 80 00 00 00       	or     $0x80,%eax
+  80629e:	00 00                	add    %al,(%rax)
+  8062a0:	ed                   	in     (%dx),%eax
+  8062a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062a6:	00 00                	add    %al,(%rax)
+  8062a8:	ed                   	in     (%dx),%eax
+  8062a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ae:	00 00                	add    %al,(%rax)
+  8062b0:	ed                   	in     (%dx),%eax
+  8062b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062b6:	00 00                	add    %al,(%rax)
+  8062b8:	ed                   	in     (%dx),%eax
+  8062b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062be:	00 00                	add    %al,(%rax)
+  8062c0:	ed                   	in     (%dx),%eax
+  8062c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062c6:	00 00                	add    %al,(%rax)
+  8062c8:	ed                   	in     (%dx),%eax
+  8062c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ce:	00 00                	add    %al,(%rax)
+  8062d0:	ed                   	in     (%dx),%eax
+  8062d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062d6:	00 00                	add    %al,(%rax)
+  8062d8:	f4                   	hlt
+  8062d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8062df:	00 ed                	add    %ch,%ch
+  8062e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8062e6:	00 00                	add    %al,(%rax)
+  8062e8:	ed                   	in     (%dx),%eax
+  8062e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062ee:	00 00                	add    %al,(%rax)
+  8062f0:	2c 0b                	sub    $0xb,%al
+  8062f2:	80 00 00             	addb   $0x0,(%rax)
+  8062f5:	00 00                	add    %al,(%rax)
+  8062f7:	00 ed                	add    %ch,%ch
+  8062f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8062fe:	00 00                	add    %al,(%rax)
+  806300:	ed                   	in     (%dx),%eax
+  806301:	0d 80 00 00 00       	or     $0x80,%eax
+  806306:	00 00                	add    %al,(%rax)
+  806308:	ed                   	in     (%dx),%eax
+  806309:	0d 80 00 00 00       	or     $0x80,%eax
+  80630e:	00 00                	add    %al,(%rax)
+  806310:	ed                   	in     (%dx),%eax
+  806311:	0d 80 00 00 00       	or     $0x80,%eax
+  806316:	00 00                	add    %al,(%rax)
+  806318:	ed                   	in     (%dx),%eax
+  806319:	0d 80 00 00 00       	or     $0x80,%eax
+  80631e:	00 00                	add    %al,(%rax)
+  806320:	ed                   	in     (%dx),%eax
+  806321:	0d 80 00 00 00       	or     $0x80,%eax
+  806326:	00 00                	add    %al,(%rax)
+  806328:	ed                   	in     (%dx),%eax
+  806329:	0d 80 00 00 00       	or     $0x80,%eax
+  80632e:	00 00                	add    %al,(%rax)
+  806330:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806333:	00 00                	add    %al,(%rax)
+  806335:	00 00                	add    %al,(%rax)
+  806337:	00 cb                	add    %cl,%bl
+  806339:	0d 80 00 00 00       	or     $0x80,%eax
+  80633e:	00 00                	add    %al,(%rax)
+  806340:	ed                   	in     (%dx),%eax
+  806341:	0d 80 00 00 00       	or     $0x80,%eax
+  806346:	00 00                	add    %al,(%rax)
+  806348:	ed                   	in     (%dx),%eax
+  806349:	0d 80 00 00 00       	or     $0x80,%eax
+  80634e:	00 00                	add    %al,(%rax)
+  806350:	ed                   	in     (%dx),%eax
+  806351:	0d 80 00 00 00       	or     $0x80,%eax
+  806356:	00 00                	add    %al,(%rax)
+  806358:	6a 0a                	push   $0xa
+  80635a:	80 00 00             	addb   $0x0,(%rax)
+  80635d:	00 00                	add    %al,(%rax)
+  80635f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806365:	00 00                	add    %al,(%rax)
+  806367:	00 ed                	add    %ch,%ch
+  806369:	0d 80 00 00 00       	or     $0x80,%eax
+  80636e:	00 00                	add    %al,(%rax)
+  806370:	ed                   	in     (%dx),%eax
+  806371:	0d 80 00 00 00       	or     $0x80,%eax
+  806376:	00 00                	add    %al,(%rax)
+  806378:	3c 0a                	cmp    $0xa,%al
+  80637a:	80 00 00             	addb   $0x0,(%rax)
+  80637d:	00 00                	add    %al,(%rax)
+  80637f:	00 ed                	add    %ch,%ch
+  806381:	0d 80 00 00 00       	or     $0x80,%eax
+  806386:	00 00                	add    %al,(%rax)
+  806388:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80638b:	00 00                	add    %al,(%rax)
+  80638d:	00 00                	add    %al,(%rax)
+  80638f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806395:	00 00                	add    %al,(%rax)
+  806397:	00 29                	add    %ch,(%rcx)
+  806399:	0c 80                	or     $0x80,%al
+  80639b:	00 00                	add    %al,(%rax)
+  80639d:	00 00                	add    %al,(%rax)
+  80639f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8063a2:	80 00 00             	addb   $0x0,(%rax)
+  8063a5:	00 00                	add    %al,(%rax)
+  8063a7:	00 ed                	add    %ch,%ch
+  8063a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ae:	00 00                	add    %al,(%rax)
+  8063b0:	1a 0b                	sbb    (%rbx),%cl
+  8063b2:	80 00 00             	addb   $0x0,(%rax)
+  8063b5:	00 00                	add    %al,(%rax)
+  8063b7:	00 ed                	add    %ch,%ch
+  8063b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063be:	00 00                	add    %al,(%rax)
+  8063c0:	ce                   	(bad)
+  8063c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8063c7:	00 ed                	add    %ch,%ch
+  8063c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8063ce:	00 00                	add    %al,(%rax)
+  8063d0:	ed                   	in     (%dx),%eax
+  8063d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8063d6:	00 00                	add    %al,(%rax)
+  8063d8:	f4                   	hlt
+  8063d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8063df:	00 37                	add    %dh,(%rdi)
+  8063e1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063ea:	80 00 00             	addb   $0x0,(%rax)
+  8063ed:	00 00                	add    %al,(%rax)
+  8063ef:	00 37                	add    %dh,(%rdi)
+  8063f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8063f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8063fa:	80 00 00             	addb   $0x0,(%rax)
+  8063fd:	00 00                	add    %al,(%rax)
+  8063ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806402:	80 00 00             	addb   $0x0,(%rax)
+  806405:	00 00                	add    %al,(%rax)
+  806407:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80640b:	00 00                	add    %al,(%rax)
+  80640d:	00 00                	add    %al,(%rax)
+  80640f:	00 d2                	add    %dl,%dl
+  806411:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806417:	00 d2                	add    %dl,%dl
+  806419:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80641f:	00 d2                	add    %dl,%dl
+  806421:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806427:	00 d2                	add    %dl,%dl
+  806429:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80642f:	00 d2                	add    %dl,%dl
+  806431:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806437:	00 d2                	add    %dl,%dl
+  806439:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80643f:	00 d2                	add    %dl,%dl
+  806441:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806447:	00 f6                	add    %dh,%dh
+  806449:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80644f:	00 f6                	add    %dh,%dh
+  806451:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806457:	00 5f 12             	add    %bl,0x12(%rdi)
+  80645a:	80 00 00             	addb   $0x0,(%rax)
+  80645d:	00 00                	add    %al,(%rax)
+  80645f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806462:	80 00 00             	addb   $0x0,(%rax)
+  806465:	00 00                	add    %al,(%rax)
+  806467:	00 5f 12             	add    %bl,0x12(%rdi)
+  80646a:	80 00 00             	addb   $0x0,(%rax)
+  80646d:	00 00                	add    %al,(%rax)
+  80646f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806472:	80 00 00             	addb   $0x0,(%rax)
+  806475:	00 00                	add    %al,(%rax)
+  806477:	00 5f 12             	add    %bl,0x12(%rdi)
+  80647a:	80 00 00             	addb   $0x0,(%rax)
+  80647d:	00 00                	add    %al,(%rax)
+  80647f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806482:	80 00 00             	addb   $0x0,(%rax)
+  806485:	00 00                	add    %al,(%rax)
+  806487:	00 5f 12             	add    %bl,0x12(%rdi)
+  80648a:	80 00 00             	addb   $0x0,(%rax)
+  80648d:	00 00                	add    %al,(%rax)
+  80648f:	00 22                	add    %ah,(%rdx)
+  806491:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806497:	00 22                	add    %ah,(%rdx)
+  806499:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80649f:	00 22                	add    %ah,(%rdx)
+  8064a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064a7:	00 22                	add    %ah,(%rdx)
+  8064a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064af:	00 22                	add    %ah,(%rdx)
+  8064b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064b7:	00 22                	add    %ah,(%rdx)
+  8064b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8064bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064c2:	80 00 00             	addb   $0x0,(%rax)
+  8064c5:	00 00                	add    %al,(%rax)
+  8064c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ca:	80 00 00             	addb   $0x0,(%rax)
+  8064cd:	00 00                	add    %al,(%rax)
+  8064cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064d2:	80 00 00             	addb   $0x0,(%rax)
+  8064d5:	00 00                	add    %al,(%rax)
+  8064d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064da:	80 00 00             	addb   $0x0,(%rax)
+  8064dd:	00 00                	add    %al,(%rax)
+  8064df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064e2:	80 00 00             	addb   $0x0,(%rax)
+  8064e5:	00 00                	add    %al,(%rax)
+  8064e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064ea:	80 00 00             	addb   $0x0,(%rax)
+  8064ed:	00 00                	add    %al,(%rax)
+  8064ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064f2:	80 00 00             	addb   $0x0,(%rax)
+  8064f5:	00 00                	add    %al,(%rax)
+  8064f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8064fa:	80 00 00             	addb   $0x0,(%rax)
+  8064fd:	00 00                	add    %al,(%rax)
+  8064ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806502:	80 00 00             	addb   $0x0,(%rax)
+  806505:	00 00                	add    %al,(%rax)
+  806507:	00 5f 12             	add    %bl,0x12(%rdi)
+  80650a:	80 00 00             	addb   $0x0,(%rax)
+  80650d:	00 00                	add    %al,(%rax)
+  80650f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806512:	80 00 00             	addb   $0x0,(%rax)
+  806515:	00 00                	add    %al,(%rax)
+  806517:	00 5f 12             	add    %bl,0x12(%rdi)
+  80651a:	80 00 00             	addb   $0x0,(%rax)
+  80651d:	00 00                	add    %al,(%rax)
+  80651f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806522:	80 00 00             	addb   $0x0,(%rax)
+  806525:	00 00                	add    %al,(%rax)
+  806527:	00 5f 12             	add    %bl,0x12(%rdi)
+  80652a:	80 00 00             	addb   $0x0,(%rax)
+  80652d:	00 00                	add    %al,(%rax)
+  80652f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806532:	80 00 00             	addb   $0x0,(%rax)
+  806535:	00 00                	add    %al,(%rax)
+  806537:	00 5f 12             	add    %bl,0x12(%rdi)
+  80653a:	80 00 00             	addb   $0x0,(%rax)
+  80653d:	00 00                	add    %al,(%rax)
+  80653f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806542:	80 00 00             	addb   $0x0,(%rax)
+  806545:	00 00                	add    %al,(%rax)
+  806547:	00 46 12             	add    %al,0x12(%rsi)
+  80654a:	80 00 00             	addb   $0x0,(%rax)
+  80654d:	00 00                	add    %al,(%rax)
+  80654f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806552:	80 00 00             	addb   $0x0,(%rax)
+  806555:	00 00                	add    %al,(%rax)
+  806557:	00 5f 12             	add    %bl,0x12(%rdi)
+  80655a:	80 00 00             	addb   $0x0,(%rax)
+  80655d:	00 00                	add    %al,(%rax)
+  80655f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806562:	80 00 00             	addb   $0x0,(%rax)
+  806565:	00 00                	add    %al,(%rax)
+  806567:	00 5f 12             	add    %bl,0x12(%rdi)
+  80656a:	80 00 00             	addb   $0x0,(%rax)
+  80656d:	00 00                	add    %al,(%rax)
+  80656f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806572:	80 00 00             	addb   $0x0,(%rax)
+  806575:	00 00                	add    %al,(%rax)
+  806577:	00 5f 12             	add    %bl,0x12(%rdi)
+  80657a:	80 00 00             	addb   $0x0,(%rax)
+  80657d:	00 00                	add    %al,(%rax)
+  80657f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806582:	80 00 00             	addb   $0x0,(%rax)
+  806585:	00 00                	add    %al,(%rax)
+  806587:	00 5f 12             	add    %bl,0x12(%rdi)
+  80658a:	80 00 00             	addb   $0x0,(%rax)
+  80658d:	00 00                	add    %al,(%rax)
+  80658f:	00 22                	add    %ah,(%rdx)
+  806591:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806597:	00 22                	add    %ah,(%rdx)
+  806599:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80659f:	00 22                	add    %ah,(%rdx)
+  8065a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065a7:	00 22                	add    %ah,(%rdx)
+  8065a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065af:	00 22                	add    %ah,(%rdx)
+  8065b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065b7:	00 22                	add    %ah,(%rdx)
+  8065b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8065bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065c2:	80 00 00             	addb   $0x0,(%rax)
+  8065c5:	00 00                	add    %al,(%rax)
+  8065c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065ca:	80 00 00             	addb   $0x0,(%rax)
+  8065cd:	00 00                	add    %al,(%rax)
+  8065cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065d2:	80 00 00             	addb   $0x0,(%rax)
+  8065d5:	00 00                	add    %al,(%rax)
+  8065d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065da:	80 00 00             	addb   $0x0,(%rax)
+  8065dd:	00 00                	add    %al,(%rax)
+  8065df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065e2:	80 00 00             	addb   $0x0,(%rax)
+  8065e5:	00 00                	add    %al,(%rax)
+  8065e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065ea:	80 00 00             	addb   $0x0,(%rax)
+  8065ed:	00 00                	add    %al,(%rax)
+  8065ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065f2:	80 00 00             	addb   $0x0,(%rax)
+  8065f5:	00 00                	add    %al,(%rax)
+  8065f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8065fa:	80 00 00             	addb   $0x0,(%rax)
+  8065fd:	00 00                	add    %al,(%rax)
+  8065ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806602:	80 00 00             	addb   $0x0,(%rax)
+  806605:	00 00                	add    %al,(%rax)
+  806607:	00 5f 12             	add    %bl,0x12(%rdi)
+  80660a:	80 00 00             	addb   $0x0,(%rax)
+  80660d:	00 00                	add    %al,(%rax)
+  80660f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806612:	80 00 00             	addb   $0x0,(%rax)
+  806615:	00 00                	add    %al,(%rax)
+  806617:	00 5f 12             	add    %bl,0x12(%rdi)
+  80661a:	80 00 00             	addb   $0x0,(%rax)
+  80661d:	00 00                	add    %al,(%rax)
+  80661f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806622:	80 00 00             	addb   $0x0,(%rax)
+  806625:	00 00                	add    %al,(%rax)
+  806627:	00 5f 12             	add    %bl,0x12(%rdi)
+  80662a:	80 00 00             	addb   $0x0,(%rax)
+  80662d:	00 00                	add    %al,(%rax)
+  80662f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806632:	80 00 00             	addb   $0x0,(%rax)
+  806635:	00 00                	add    %al,(%rax)
+  806637:	00 5f 12             	add    %bl,0x12(%rdi)
+  80663a:	80 00 00             	addb   $0x0,(%rax)
+  80663d:	00 00                	add    %al,(%rax)
+  80663f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806642:	80 00 00             	addb   $0x0,(%rax)
+  806645:	00 00                	add    %al,(%rax)
+  806647:	00 46 12             	add    %al,0x12(%rsi)
+  80664a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806660 <basefix.0>:
+  806660:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806670:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806680:	10 00 2f 6e 6f 74 2d 66 6f 75 6e 64 00 73 65 72     ../not-found.ser
+  806690:	76 65 5f 6f 70 65 6e 20 2f 6e 6f 74 2d 66 6f 75     ve_open /not-fou
+  8066a0:	6e 64 3a 20 25 6c 64 00 75 73 65 72 2f 74 65 73     nd: %ld.user/tes
+  8066b0:	74 66 69 6c 65 2e 63 00 2f 6e 65 77 6d 6f 74 64     tfile.c./newmotd
+  8066c0:	00 73 65 72 76 65 5f 6f 70 65 6e 20 2f 6e 65 77     .serve_open /new
+  8066d0:	6d 6f 74 64 3a 20 25 6c 64 00 73 65 72 76 65 5f     motd: %ld.serve_
+  8066e0:	6f 70 65 6e 20 69 73 20 67 6f 6f 64 0a 00 66 69     open is good..fi
+  8066f0:	6c 65 5f 73 74 61 74 3a 20 25 6c 64 00 66 69 6c     le_stat: %ld.fil
+  806700:	65 5f 73 74 61 74 20 69 73 20 67 6f 6f 64 0a 00     e_stat is good..
+  806710:	66 69 6c 65 5f 72 65 61 64 3a 20 25 6c 64 00 66     file_read: %ld.f
+  806720:	69 6c 65 5f 72 65 61 64 20 72 65 74 75 72 6e 65     ile_read returne
+  806730:	64 20 77 72 6f 6e 67 20 64 61 74 61 00 66 69 6c     d wrong data.fil
+  806740:	65 5f 72 65 61 64 20 69 73 20 67 6f 6f 64 0a 00     e_read is good..
+  806750:	66 69 6c 65 5f 63 6c 6f 73 65 3a 20 25 6c 64 00     file_close: %ld.
+  806760:	66 69 6c 65 5f 63 6c 6f 73 65 20 69 73 20 67 6f     file_close is go
+  806770:	6f 64 0a 00 73 74 61 6c 65 20 66 69 6c 65 69 64     od..stale fileid
+  806780:	20 69 73 20 67 6f 6f 64 0a 00 2f 6e 65 77 2d 66      is good../new-f
+  806790:	69 6c 65 00 73 65 72 76 65 5f 6f 70 65 6e 20 2f     ile.serve_open /
+  8067a0:	6e 65 77 2d 66 69 6c 65 3a 20 25 6c 64 00 66 69     new-file: %ld.fi
+  8067b0:	6c 65 5f 77 72 69 74 65 3a 20 25 6c 64 00 66 69     le_write: %ld.fi
+  8067c0:	6c 65 5f 77 72 69 74 65 20 69 73 20 67 6f 6f 64     le_write is good
+  8067d0:	0a 00 6f 70 65 6e 20 2f 6e 6f 74 2d 66 6f 75 6e     ..open /not-foun
+  8067e0:	64 20 73 75 63 63 65 65 64 65 64 21 00 2f 62 69     d succeeded!./bi
+  8067f0:	67 00 63 72 65 61 74 20 2f 62 69 67 3a 20 25 6c     g.creat /big: %l
+  806800:	64 00 77 72 69 74 65 20 2f 62 69 67 40 25 6c 64     d.write /big@%ld
+  806810:	3a 20 25 6c 64 00 6f 70 65 6e 20 2f 62 69 67 3a     : %ld.open /big:
+  806820:	20 25 6c 64 00 72 65 61 64 20 2f 62 69 67 40 25      %ld.read /big@%
+  806830:	6c 64 3a 20 25 6c 64 00 6c 61 72 67 65 20 66 69     ld: %ld.large fi
+  806840:	6c 65 20 69 73 20 67 6f 6f 64 0a 00 0f 1f 40 00     le is good....@.
+  806850:	73 65 72 76 65 5f 6f 70 65 6e 20 2f 6e 6f 74 2d     serve_open /not-
+  806860:	66 6f 75 6e 64 20 73 75 63 63 65 65 64 65 64 21     found succeeded!
+	...
+  806878:	73 65 72 76 65 5f 6f 70 65 6e 20 64 69 64 20 6e     serve_open did n
+  806888:	6f 74 20 66 69 6c 6c 20 73 74 72 75 63 74 20 46     ot fill struct F
+  806898:	64 20 63 6f 72 72 65 63 74 6c 79 0a 00 00 00 00     d correctly.....
+  8068a8:	66 69 6c 65 5f 73 74 61 74 20 72 65 74 75 72 6e     file_stat return
+  8068b8:	65 64 20 73 69 7a 65 20 25 6c 64 20 77 61 6e 74     ed size %ld want
+  8068c8:	65 64 20 25 7a 64 0a 00 73 65 72 76 65 5f 72 65     ed %zd..serve_re
+  8068d8:	61 64 20 64 6f 65 73 20 6e 6f 74 20 68 61 6e 64     ad does not hand
+  8068e8:	6c 65 20 73 74 61 6c 65 20 66 69 6c 65 69 64 73     le stale fileids
+  8068f8:	20 63 6f 72 72 65 63 74 6c 79 3a 20 25 6c 64 00      correctly: %ld.
+  806908:	66 69 6c 65 5f 72 65 61 64 20 61 66 74 65 72 20     file_read after 
+  806918:	66 69 6c 65 5f 77 72 69 74 65 3a 20 25 6c 64 00     file_write: %ld.
+  806928:	66 69 6c 65 5f 72 65 61 64 20 61 66 74 65 72 20     file_read after 
+  806938:	66 69 6c 65 5f 77 72 69 74 65 20 72 65 74 75 72     file_write retur
+  806948:	6e 65 64 20 77 72 6f 6e 67 20 6c 65 6e 67 74 68     ned wrong length
+  806958:	3a 20 25 6c 64 00 00 00 66 69 6c 65 5f 72 65 61     : %ld...file_rea
+  806968:	64 20 61 66 74 65 72 20 66 69 6c 65 5f 77 72 69     d after file_wri
+  806978:	74 65 20 72 65 74 75 72 6e 65 64 20 77 72 6f 6e     te returned wron
+  806988:	67 20 64 61 74 61 00 00 66 69 6c 65 5f 72 65 61     g data..file_rea
+  806998:	64 20 61 66 74 65 72 20 66 69 6c 65 5f 77 72 69     d after file_wri
+  8069a8:	74 65 20 69 73 20 67 6f 6f 64 0a 00 00 00 00 00     te is good......
+  8069b8:	6f 70 65 6e 20 64 69 64 20 6e 6f 74 20 66 69 6c     open did not fil
+  8069c8:	6c 20 73 74 72 75 63 74 20 46 64 20 63 6f 72 72     l struct Fd corr
+  8069d8:	65 63 74 6c 79 0a 00 00 72 65 61 64 20 2f 62 69     ectly...read /bi
+  8069e8:	67 20 66 72 6f 6d 20 25 6c 64 20 72 65 74 75 72     g from %ld retur
+  8069f8:	6e 65 64 20 25 6c 64 20 3c 20 25 64 20 62 79 74     ned %ld < %d byt
+  806a08:	65 73 00 00 00 00 00 00 72 65 61 64 20 2f 62 69     es......read /bi
+  806a18:	67 20 66 72 6f 6d 20 25 6c 64 20 72 65 74 75 72     g from %ld retur
+  806a28:	6e 65 64 20 62 61 64 20 64 61 74 61 20 25 64 00     ned bad data %d.
+  806a38:	54 68 69 73 20 69 73 20 74 68 65 20 4e 45 57 20     This is the NEW 
+  806a48:	6d 65 73 73 61 67 65 20 6f 66 20 74 68 65 20 64     message of the d
+  806a58:	61 79 21 0a 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     ay!...<unknown>.
+  806a68:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806a78:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806a88:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806a98:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806aa8:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806ab8:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806ac8:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806ad8:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806ae8:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806af8:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806b08:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806b18:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806b28:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806b38:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806b48:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806b58:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806b68:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806b78:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806b88:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806b98:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806ba8:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806bb8:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806bc8:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806bd8:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806be8:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806bf8:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806c08:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806c18:	64 00 66 0f 1f 44 00 00 9e 23 80 00 00 00 00 00     d.f..D...#......
+  806c28:	f5 29 80 00 00 00 00 00 e5 29 80 00 00 00 00 00     .).......)......
+  806c38:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806c48:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806c58:	bd 23 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .#.......)......
+  806c68:	f5 29 80 00 00 00 00 00 b1 23 80 00 00 00 00 00     .).......#......
+  806c78:	2b 24 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     +$.......)......
+  806c88:	b1 23 80 00 00 00 00 00 f7 23 80 00 00 00 00 00     .#.......#......
+  806c98:	f7 23 80 00 00 00 00 00 f7 23 80 00 00 00 00 00     .#.......#......
+  806ca8:	f7 23 80 00 00 00 00 00 f7 23 80 00 00 00 00 00     .#.......#......
+  806cb8:	f7 23 80 00 00 00 00 00 f7 23 80 00 00 00 00 00     .#.......#......
+  806cc8:	f7 23 80 00 00 00 00 00 f7 23 80 00 00 00 00 00     .#.......#......
+  806cd8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806ce8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806cf8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d08:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d18:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d28:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d38:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d48:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d58:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d68:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d78:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d88:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806d98:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806da8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806db8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806dc8:	13 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806dd8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806de8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806df8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806e08:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806e18:	f5 29 80 00 00 00 00 00 59 24 80 00 00 00 00 00     .)......Y$......
+  806e28:	28 26 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     (&.......)......
+  806e38:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806e48:	4e 24 80 00 00 00 00 00 88 24 80 00 00 00 00 00     N$.......$......
+  806e58:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806e68:	43 24 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     C$.......)......
+  806e78:	f5 29 80 00 00 00 00 00 d1 27 80 00 00 00 00 00     .).......'......
+  806e88:	a0 28 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .(.......)......
+  806e98:	f5 29 80 00 00 00 00 00 1f 25 80 00 00 00 00 00     .).......%......
+  806ea8:	f5 29 80 00 00 00 00 00 fc 26 80 00 00 00 00 00     .).......&......
+  806eb8:	f5 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806ec8:	13 29 80 00 00 00 00 00 f5 29 80 00 00 00 00 00     .).......)......
+  806ed8:	a7 23 80 00 00 00 00 00                             .#......
+
+0000000000806ee0 <error_string>:
+	...
+  806ee8:	bd 6a 80 00 00 00 00 00 cf 6a 80 00 00 00 00 00     .j.......j......
+  806ef8:	df 6a 80 00 00 00 00 00 f1 6a 80 00 00 00 00 00     .j.......j......
+  806f08:	ff 6a 80 00 00 00 00 00 13 6b 80 00 00 00 00 00     .j.......k......
+  806f18:	28 6b 80 00 00 00 00 00 3b 6b 80 00 00 00 00 00     (k......;k......
+  806f28:	4d 6b 80 00 00 00 00 00 61 6b 80 00 00 00 00 00     Mk......ak......
+  806f38:	71 6b 80 00 00 00 00 00 84 6b 80 00 00 00 00 00     qk.......k......
+  806f48:	9b 6b 80 00 00 00 00 00 b1 6b 80 00 00 00 00 00     .k.......k......
+  806f58:	c9 6b 80 00 00 00 00 00 e1 6b 80 00 00 00 00 00     .k.......k......
+  806f68:	ee 6b 80 00 00 00 00 00 80 6f 80 00 00 00 00 00     .k.......o......
+  806f78:	02 6c 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .l......file is 
+  806f88:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806f98:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806fa8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806fb8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806fc8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  806fd8:	5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f 69 70     _send: %i.lib/ip
+  806fe8:	63 2e 63 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     c.c...@.[%08x] u
+  806ff8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  807008:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  807018:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  807028:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  807038:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  807048:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  807058:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  807068:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807078:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000807080 <devtab>:
+  807080:	60 80 80 00 00 00 00 00 a0 80 80 00 00 00 00 00     `...............
+  807090:	e0 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8070a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8070b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8070c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8070d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8070e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8070f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807100:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807110:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  807120:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  807130:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807140:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  807150:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  807160:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  807170:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  807180:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  807190:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8071a0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8071b0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8071c0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8071d0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8071e0:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  8071f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8072a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8072b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8072c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8072d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8072e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8072f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8073a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8073b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8073c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8073d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8073e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8073f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8074a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8074b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8074c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8074d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8074e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8074f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8075a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8075b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8075c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8075d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8075e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8075f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8076a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8076b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8076c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8076d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8076e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8076f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8077a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8077b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8077c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8077d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8077e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8077f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8078a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8078b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8078c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8078d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8078e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8078f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8079a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8079b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8079c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8079d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8079e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8079f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  807fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  807fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  807fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  807fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  807ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
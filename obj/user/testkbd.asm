@@ -0,0 +1,10534 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 f7 26 80 00 00 	movabs $0x8026f7,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 78 25 80 00 00 	movabs $0x802578,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 02 38 80 00 00 	movabs $0x803802,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 02 38 80 00 00 	movabs $0x803802,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 ba 1a 80 00 00 	movabs $0x801aba,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 87 5f 80 00 00 	movabs $0x805f87,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 17 25 80 00 00 	movabs $0x802517,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 30 59 80 00 00 	movabs $0x805930,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 17 25 80 00 00 	movabs $0x802517,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 32 59 80 00 00 	movabs $0x805932,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 17 25 80 00 00 	movabs $0x802517,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 35 59 80 00 00 	movabs $0x805935,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 17 25 80 00 00 	movabs $0x802517,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 d6 4f 80 00 00 	movabs $0x804fd6,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 ad 52 80 00 00 	movabs $0x8052ad,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 bb 38 80 00 00 	movabs $0x8038bb,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 bb 38 80 00 00 	movabs $0x8038bb,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 02 38 80 00 00 	movabs $0x803802,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb c4 26 80 00 00 	movabs $0x8026c4,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 59 80 00 00 	movabs $0x805940,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 c4 26 80 00 00 	movabs $0x8026c4,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 f7 26 80 00 00 	movabs $0x8026f7,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc c4 26 80 00 00 	movabs $0x8026c4,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 5b 80 00 00 	movabs $0x805be0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf c4 26 80 00 00 	movabs $0x8026c4,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf c4 26 80 00 00 	movabs $0x8026c4,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 5e 80 00 00 	movabs $0x805e60,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 5e 80 00 00 	movabs $0x805e60,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 1c 29 80 00 00 	movabs $0x80291c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 1c 29 80 00 00 	movabs $0x80291c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 03 04 00 00       	call   801902 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 56                	push   %r14
+  801507:	41 55                	push   %r13
+  801509:	41 54                	push   %r12
+  80150b:	53                   	push   %rbx
+  80150c:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  801511:	49 bc 63 2c 80 00 00 	movabs $0x802c63,%r12
+  801518:	00 00 00 
+  80151b:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  80151e:	83 eb 01             	sub    $0x1,%ebx
+  801521:	75 f8                	jne    80151b <umain+0x1a>
+
+    close(0);
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+  801528:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  80152f:	00 00 00 
+  801532:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  801534:	48 b8 9b 18 80 00 00 	movabs $0x80189b,%rax
+  80153b:	00 00 00 
+  80153e:	ff d0                	call   *%rax
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 2f                	js     801573 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  801544:	74 5a                	je     8015a0 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  801546:	89 c1                	mov    %eax,%ecx
+  801548:	48 ba 9e 5e 80 00 00 	movabs $0x805e9e,%rdx
+  80154f:	00 00 00 
+  801552:	be 10 00 00 00       	mov    $0x10,%esi
+  801557:	48 bf 8f 5e 80 00 00 	movabs $0x805e8f,%rdi
+  80155e:	00 00 00 
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+  801566:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  80156d:	00 00 00 
+  801570:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  801573:	89 c1                	mov    %eax,%ecx
+  801575:	48 ba 82 5e 80 00 00 	movabs $0x805e82,%rdx
+  80157c:	00 00 00 
+  80157f:	be 0e 00 00 00       	mov    $0xe,%esi
+  801584:	48 bf 8f 5e 80 00 00 	movabs $0x805e8f,%rdi
+  80158b:	00 00 00 
+  80158e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801593:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  80159a:	00 00 00 
+  80159d:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8015a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8015a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015aa:	48 b8 b0 35 80 00 00 	movabs $0x8035b0,%rax
+  8015b1:	00 00 00 
+  8015b4:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8015b6:	49 bc c0 5e 80 00 00 	movabs $0x805ec0,%r12
+  8015bd:	00 00 00 
+  8015c0:	48 bb d2 29 80 00 00 	movabs $0x8029d2,%rbx
+  8015c7:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8015ca:	49 be d2 5e 80 00 00 	movabs $0x805ed2,%r14
+  8015d1:	00 00 00 
+  8015d4:	49 bd 5d 42 80 00 00 	movabs $0x80425d,%r13
+  8015db:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8015de:	85 c0                	test   %eax,%eax
+  8015e0:	79 44                	jns    801626 <umain+0x125>
+        panic("dup: %i", r);
+  8015e2:	89 c1                	mov    %eax,%ecx
+  8015e4:	48 ba b8 5e 80 00 00 	movabs $0x805eb8,%rdx
+  8015eb:	00 00 00 
+  8015ee:	be 12 00 00 00       	mov    $0x12,%esi
+  8015f3:	48 bf 8f 5e 80 00 00 	movabs $0x805e8f,%rdi
+  8015fa:	00 00 00 
+  8015fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801602:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  801609:	00 00 00 
+  80160c:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  80160f:	48 be ce 5e 80 00 00 	movabs $0x805ece,%rsi
+  801616:	00 00 00 
+  801619:	bf 01 00 00 00       	mov    $0x1,%edi
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  801626:	4c 89 e7             	mov    %r12,%rdi
+  801629:	ff d3                	call   *%rbx
+  80162b:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  80162e:	48 85 c0             	test   %rax,%rax
+  801631:	75 dc                	jne    80160f <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  801633:	4c 89 f6             	mov    %r14,%rsi
+  801636:	bf 01 00 00 00       	mov    $0x1,%edi
+  80163b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801640:	41 ff d5             	call   *%r13
+  801643:	eb e1                	jmp    801626 <umain+0x125>
+
+0000000000801645 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  801645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164a:	c3                   	ret
+
+000000000080164b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  801652:	48 be ea 5e 80 00 00 	movabs $0x805eea,%rsi
+  801659:	00 00 00 
+  80165c:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  801663:	00 00 00 
+  801666:	ff d0                	call   *%rax
+    return 0;
+}
+  801668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166d:	5d                   	pop    %rbp
+  80166e:	c3                   	ret
+
+000000000080166f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80166f:	55                   	push   %rbp
+  801670:	48 89 e5             	mov    %rsp,%rbp
+  801673:	41 57                	push   %r15
+  801675:	41 56                	push   %r14
+  801677:	41 55                	push   %r13
+  801679:	41 54                	push   %r12
+  80167b:	53                   	push   %rbx
+  80167c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  801683:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  80168a:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  801691:	00 00 00 00 
+  801695:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80169c:	00 00 00 00 
+  8016a0:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  8016a7:	00 00 00 00 
+  8016ab:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8016b2:	00 00 00 00 
+  8016b6:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8016bd:	00 00 00 00 
+  8016c1:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8016c8:	00 00 00 00 
+  8016cc:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8016d3:	00 
+  8016d4:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8016db:	00 
+  8016dc:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8016e3:	00 
+  8016e4:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8016eb:	00 
+  8016ec:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8016f3:	00 
+  8016f4:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8016fb:	00 
+  8016fc:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801703:	00 
+  801704:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80170b:	00 
+  80170c:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801713:	00 
+  801714:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80171b:	00 
+    for (res = 0; res < n; res += inc) {
+  80171c:	48 85 d2             	test   %rdx,%rdx
+  80171f:	74 7a                	je     80179b <devcons_write+0x12c>
+  801721:	49 89 d6             	mov    %rdx,%r14
+  801724:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80172a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80172f:	49 bf a5 27 80 00 00 	movabs $0x8027a5,%r15
+  801736:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801739:	4c 89 f3             	mov    %r14,%rbx
+  80173c:	48 29 f3             	sub    %rsi,%rbx
+  80173f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801744:	48 39 c3             	cmp    %rax,%rbx
+  801747:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80174b:	4c 63 eb             	movslq %ebx,%r13
+  80174e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801755:	48 01 c6             	add    %rax,%rsi
+  801758:	4c 89 ea             	mov    %r13,%rdx
+  80175b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801762:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801765:	4c 89 ee             	mov    %r13,%rsi
+  801768:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80176f:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  801776:	00 00 00 
+  801779:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80177b:	41 01 dc             	add    %ebx,%r12d
+  80177e:	49 63 f4             	movslq %r12d,%rsi
+  801781:	4c 39 f6             	cmp    %r14,%rsi
+  801784:	72 b3                	jb     801739 <devcons_write+0xca>
+    return res;
+  801786:	49 63 c4             	movslq %r12d,%rax
+}
+  801789:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801790:	5b                   	pop    %rbx
+  801791:	41 5c                	pop    %r12
+  801793:	41 5d                	pop    %r13
+  801795:	41 5e                	pop    %r14
+  801797:	41 5f                	pop    %r15
+  801799:	5d                   	pop    %rbp
+  80179a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80179b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8017a1:	eb e3                	jmp    801786 <devcons_write+0x117>
+
+00000000008017a3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8017a3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8017a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ab:	48 85 c0             	test   %rax,%rax
+  8017ae:	74 55                	je     801805 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	41 55                	push   %r13
+  8017b6:	41 54                	push   %r12
+  8017b8:	53                   	push   %rbx
+  8017b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8017bd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8017c0:	48 bb 4f 2b 80 00 00 	movabs $0x802b4f,%rbx
+  8017c7:	00 00 00 
+  8017ca:	49 bc 63 2c 80 00 00 	movabs $0x802c63,%r12
+  8017d1:	00 00 00 
+  8017d4:	eb 03                	jmp    8017d9 <devcons_read+0x36>
+  8017d6:	41 ff d4             	call   *%r12
+  8017d9:	ff d3                	call   *%rbx
+  8017db:	85 c0                	test   %eax,%eax
+  8017dd:	74 f7                	je     8017d6 <devcons_read+0x33>
+    if (c < 0) return c;
+  8017df:	48 63 d0             	movslq %eax,%rdx
+  8017e2:	78 13                	js     8017f7 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8017e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e9:	83 f8 04             	cmp    $0x4,%eax
+  8017ec:	74 09                	je     8017f7 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8017ee:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8017f2:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8017f7:	48 89 d0             	mov    %rdx,%rax
+  8017fa:	48 83 c4 08          	add    $0x8,%rsp
+  8017fe:	5b                   	pop    %rbx
+  8017ff:	41 5c                	pop    %r12
+  801801:	41 5d                	pop    %r13
+  801803:	5d                   	pop    %rbp
+  801804:	c3                   	ret
+  801805:	48 89 d0             	mov    %rdx,%rax
+  801808:	c3                   	ret
+
+0000000000801809 <cputchar>:
+cputchar(int ch) {
+  801809:	55                   	push   %rbp
+  80180a:	48 89 e5             	mov    %rsp,%rbp
+  80180d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801811:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801815:	be 01 00 00 00       	mov    $0x1,%esi
+  80181a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80181e:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+}
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+000000000080182c <getchar>:
+getchar(void) {
+  80182c:	55                   	push   %rbp
+  80182d:	48 89 e5             	mov    %rsp,%rbp
+  801830:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801834:	ba 01 00 00 00       	mov    $0x1,%edx
+  801839:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80183d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801842:	48 b8 d3 36 80 00 00 	movabs $0x8036d3,%rax
+  801849:	00 00 00 
+  80184c:	ff d0                	call   *%rax
+  80184e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 06                	js     80185a <getchar+0x2e>
+  801854:	74 08                	je     80185e <getchar+0x32>
+  801856:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80185a:	89 d0                	mov    %edx,%eax
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80185e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801863:	eb f5                	jmp    80185a <getchar+0x2e>
+
+0000000000801865 <iscons>:
+iscons(int fdnum) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80186d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801871:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  801878:	00 00 00 
+  80187b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	78 18                	js     801899 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801881:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801885:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  80188c:	00 00 00 
+  80188f:	8b 00                	mov    (%rax),%eax
+  801891:	39 02                	cmp    %eax,(%rdx)
+  801893:	0f 94 c0             	sete   %al
+  801896:	0f b6 c0             	movzbl %al,%eax
+}
+  801899:	c9                   	leave
+  80189a:	c3                   	ret
+
+000000000080189b <opencons>:
+opencons(void) {
+  80189b:	55                   	push   %rbp
+  80189c:	48 89 e5             	mov    %rsp,%rbp
+  80189f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8018a3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8018a7:	48 b8 90 33 80 00 00 	movabs $0x803390,%rax
+  8018ae:	00 00 00 
+  8018b1:	ff d0                	call   *%rax
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	78 49                	js     801900 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8018b7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8018bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018c1:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8018c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ca:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 26                	js     801900 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8018da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018de:	a1 40 70 80 00 00 00 	movabs 0x807040,%eax
+  8018e5:	00 00 
+  8018e7:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8018e9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018ed:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8018f4:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  8018fb:	00 00 00 
+  8018fe:	ff d0                	call   *%rax
+}
+  801900:	c9                   	leave
+  801901:	c3                   	ret
+
+0000000000801902 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801902:	55                   	push   %rbp
+  801903:	48 89 e5             	mov    %rsp,%rbp
+  801906:	41 56                	push   %r14
+  801908:	41 55                	push   %r13
+  80190a:	41 54                	push   %r12
+  80190c:	53                   	push   %rbx
+  80190d:	41 89 fd             	mov    %edi,%r13d
+  801910:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801913:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  80191a:	00 00 00 
+  80191d:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801924:	00 00 00 
+  801927:	48 39 c2             	cmp    %rax,%rdx
+  80192a:	73 17                	jae    801943 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80192c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80192f:	49 89 c4             	mov    %rax,%r12
+  801932:	48 83 c3 08          	add    $0x8,%rbx
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193b:	ff 53 f8             	call   *-0x8(%rbx)
+  80193e:	4c 39 e3             	cmp    %r12,%rbx
+  801941:	72 ef                	jb     801932 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801943:	48 b8 2c 2c 80 00 00 	movabs $0x802c2c,%rax
+  80194a:	00 00 00 
+  80194d:	ff d0                	call   *%rax
+  80194f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801954:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80195b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801962:	00 00 00 
+  801965:	48 01 d0             	add    %rdx,%rax
+  801968:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  80196f:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801972:	45 85 ed             	test   %r13d,%r13d
+  801975:	7e 0d                	jle    801984 <libmain+0x82>
+  801977:	49 8b 06             	mov    (%r14),%rax
+  80197a:	48 a3 78 70 80 00 00 	movabs %rax,0x807078
+  801981:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801984:	4c 89 f6             	mov    %r14,%rsi
+  801987:	44 89 ef             	mov    %r13d,%edi
+  80198a:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801991:	00 00 00 
+  801994:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801996:	48 b8 ab 19 80 00 00 	movabs $0x8019ab,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+#endif
+}
+  8019a2:	5b                   	pop    %rbx
+  8019a3:	41 5c                	pop    %r12
+  8019a5:	41 5d                	pop    %r13
+  8019a7:	41 5e                	pop    %r14
+  8019a9:	5d                   	pop    %rbp
+  8019aa:	c3                   	ret
+
+00000000008019ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8019ab:	55                   	push   %rbp
+  8019ac:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8019af:	48 b8 88 35 80 00 00 	movabs $0x803588,%rax
+  8019b6:	00 00 00 
+  8019b9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8019bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c0:	48 b8 bb 2b 80 00 00 	movabs $0x802bbb,%rax
+  8019c7:	00 00 00 
+  8019ca:	ff d0                	call   *%rax
+}
+  8019cc:	5d                   	pop    %rbp
+  8019cd:	c3                   	ret
+
+00000000008019ce <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+  8019d2:	41 56                	push   %r14
+  8019d4:	41 55                	push   %r13
+  8019d6:	41 54                	push   %r12
+  8019d8:	53                   	push   %rbx
+  8019d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8019dd:	49 89 fc             	mov    %rdi,%r12
+  8019e0:	41 89 f5             	mov    %esi,%r13d
+  8019e3:	48 89 d3             	mov    %rdx,%rbx
+  8019e6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8019ea:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8019ee:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8019f2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8019f9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019fd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801a01:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801a05:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801a09:	48 b8 78 70 80 00 00 	movabs $0x807078,%rax
+  801a10:	00 00 00 
+  801a13:	4c 8b 30             	mov    (%rax),%r14
+  801a16:	48 b8 2c 2c 80 00 00 	movabs $0x802c2c,%rax
+  801a1d:	00 00 00 
+  801a20:	ff d0                	call   *%rax
+  801a22:	89 c6                	mov    %eax,%esi
+  801a24:	45 89 e8             	mov    %r13d,%r8d
+  801a27:	4c 89 e1             	mov    %r12,%rcx
+  801a2a:	4c 89 f2             	mov    %r14,%rdx
+  801a2d:	48 bf 00 5f 80 00 00 	movabs $0x805f00,%rdi
+  801a34:	00 00 00 
+  801a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3c:	49 bc 1e 1b 80 00 00 	movabs $0x801b1e,%r12
+  801a43:	00 00 00 
+  801a46:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801a49:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801a4d:	48 89 df             	mov    %rbx,%rdi
+  801a50:	48 b8 ba 1a 80 00 00 	movabs $0x801aba,%rax
+  801a57:	00 00 00 
+  801a5a:	ff d0                	call   *%rax
+    cprintf("\n");
+  801a5c:	48 bf e8 5e 80 00 00 	movabs $0x805ee8,%rdi
+  801a63:	00 00 00 
+  801a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801a6e:	cc                   	int3
+  801a6f:	eb fd                	jmp    801a6e <_panic+0xa0>
+
+0000000000801a71 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	53                   	push   %rbx
+  801a76:	48 83 ec 08          	sub    $0x8,%rsp
+  801a7a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801a7d:	8b 06                	mov    (%rsi),%eax
+  801a7f:	8d 50 01             	lea    0x1(%rax),%edx
+  801a82:	89 16                	mov    %edx,(%rsi)
+  801a84:	48 98                	cltq
+  801a86:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801a8b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801a91:	74 0a                	je     801a9d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801a93:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801a97:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a9b:	c9                   	leave
+  801a9c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801a9d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801aa1:	be ff 00 00 00       	mov    $0xff,%esi
+  801aa6:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  801aad:	00 00 00 
+  801ab0:	ff d0                	call   *%rax
+        state->offset = 0;
+  801ab2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801ab8:	eb d9                	jmp    801a93 <putch+0x22>
+
+0000000000801aba <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801aba:	55                   	push   %rbp
+  801abb:	48 89 e5             	mov    %rsp,%rbp
+  801abe:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801ac5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801ac8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801acf:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801adc:	48 89 f1             	mov    %rsi,%rcx
+  801adf:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801ae6:	48 bf 71 1a 80 00 00 	movabs $0x801a71,%rdi
+  801aed:	00 00 00 
+  801af0:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801afc:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801b03:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801b0a:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  801b11:	00 00 00 
+  801b14:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801b16:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801b1c:	c9                   	leave
+  801b1d:	c3                   	ret
+
+0000000000801b1e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801b1e:	55                   	push   %rbp
+  801b1f:	48 89 e5             	mov    %rsp,%rbp
+  801b22:	48 83 ec 50          	sub    $0x50,%rsp
+  801b26:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801b2a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801b2e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b32:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b36:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801b3a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801b41:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b49:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801b51:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801b55:	48 b8 ba 1a 80 00 00 	movabs $0x801aba,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801b61:	c9                   	leave
+  801b62:	c3                   	ret
+
+0000000000801b63 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801b63:	55                   	push   %rbp
+  801b64:	48 89 e5             	mov    %rsp,%rbp
+  801b67:	41 57                	push   %r15
+  801b69:	41 56                	push   %r14
+  801b6b:	41 55                	push   %r13
+  801b6d:	41 54                	push   %r12
+  801b6f:	53                   	push   %rbx
+  801b70:	48 83 ec 18          	sub    $0x18,%rsp
+  801b74:	49 89 fc             	mov    %rdi,%r12
+  801b77:	49 89 f5             	mov    %rsi,%r13
+  801b7a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b7e:	8b 45 10             	mov    0x10(%rbp),%eax
+  801b81:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801b84:	41 89 cf             	mov    %ecx,%r15d
+  801b87:	4c 39 fa             	cmp    %r15,%rdx
+  801b8a:	73 5b                	jae    801be7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801b8c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801b90:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801b94:	85 db                	test   %ebx,%ebx
+  801b96:	7e 0e                	jle    801ba6 <print_num+0x43>
+            putch(padc, put_arg);
+  801b98:	4c 89 ee             	mov    %r13,%rsi
+  801b9b:	44 89 f7             	mov    %r14d,%edi
+  801b9e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ba1:	83 eb 01             	sub    $0x1,%ebx
+  801ba4:	75 f2                	jne    801b98 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801ba6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801baa:	48 b9 34 5f 80 00 00 	movabs $0x805f34,%rcx
+  801bb1:	00 00 00 
+  801bb4:	48 b8 23 5f 80 00 00 	movabs $0x805f23,%rax
+  801bbb:	00 00 00 
+  801bbe:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801bc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcb:	49 f7 f7             	div    %r15
+  801bce:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801bd2:	4c 89 ee             	mov    %r13,%rsi
+  801bd5:	41 ff d4             	call   *%r12
+}
+  801bd8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bdc:	5b                   	pop    %rbx
+  801bdd:	41 5c                	pop    %r12
+  801bdf:	41 5d                	pop    %r13
+  801be1:	41 5e                	pop    %r14
+  801be3:	41 5f                	pop    %r15
+  801be5:	5d                   	pop    %rbp
+  801be6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801be7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf0:	49 f7 f7             	div    %r15
+  801bf3:	48 83 ec 08          	sub    $0x8,%rsp
+  801bf7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801bfb:	52                   	push   %rdx
+  801bfc:	45 0f be c9          	movsbl %r9b,%r9d
+  801c00:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801c04:	48 89 c2             	mov    %rax,%rdx
+  801c07:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+  801c13:	48 83 c4 10          	add    $0x10,%rsp
+  801c17:	eb 8d                	jmp    801ba6 <print_num+0x43>
+
+0000000000801c19 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801c19:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801c1d:	48 8b 06             	mov    (%rsi),%rax
+  801c20:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801c24:	73 0a                	jae    801c30 <sprintputch+0x17>
+        *state->start++ = ch;
+  801c26:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c2a:	48 89 16             	mov    %rdx,(%rsi)
+  801c2d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801c30:	c3                   	ret
+
+0000000000801c31 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801c31:	55                   	push   %rbp
+  801c32:	48 89 e5             	mov    %rsp,%rbp
+  801c35:	48 83 ec 50          	sub    $0x50,%rsp
+  801c39:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801c3d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801c41:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801c45:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801c4c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801c50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c54:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801c58:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801c5c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801c60:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  801c67:	00 00 00 
+  801c6a:	ff d0                	call   *%rax
+}
+  801c6c:	c9                   	leave
+  801c6d:	c3                   	ret
+
+0000000000801c6e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+  801c72:	41 57                	push   %r15
+  801c74:	41 56                	push   %r14
+  801c76:	41 55                	push   %r13
+  801c78:	41 54                	push   %r12
+  801c7a:	53                   	push   %rbx
+  801c7b:	48 83 ec 38          	sub    $0x38,%rsp
+  801c7f:	49 89 fe             	mov    %rdi,%r14
+  801c82:	49 89 f5             	mov    %rsi,%r13
+  801c85:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801c88:	48 8b 01             	mov    (%rcx),%rax
+  801c8b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801c8f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801c93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c97:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801c9b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801c9f:	eb 0d                	jmp    801cae <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801ca1:	40 0f b6 ff          	movzbl %dil,%edi
+  801ca5:	4c 89 ee             	mov    %r13,%rsi
+  801ca8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801cab:	4c 89 e3             	mov    %r12,%rbx
+  801cae:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801cb2:	0f b6 3b             	movzbl (%rbx),%edi
+  801cb5:	40 80 ff 25          	cmp    $0x25,%dil
+  801cb9:	74 14                	je     801ccf <vprintfmt+0x61>
+            if (!ch) return;
+  801cbb:	40 84 ff             	test   %dil,%dil
+  801cbe:	75 e1                	jne    801ca1 <vprintfmt+0x33>
+}
+  801cc0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801cc4:	5b                   	pop    %rbx
+  801cc5:	41 5c                	pop    %r12
+  801cc7:	41 5d                	pop    %r13
+  801cc9:	41 5e                	pop    %r14
+  801ccb:	41 5f                	pop    %r15
+  801ccd:	5d                   	pop    %rbp
+  801cce:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801ccf:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801cd8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801cdd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801ce3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801cea:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801cee:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801cf3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801cf8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801cfb:	83 e8 23             	sub    $0x23,%eax
+  801cfe:	3c 57                	cmp    $0x57,%al
+  801d00:	0f 87 67 06 00 00    	ja     80236d <vprintfmt+0x6ff>
+  801d06:	0f b6 c0             	movzbl %al,%eax
+  801d09:	48 b9 c0 60 80 00 00 	movabs $0x8060c0,%rcx
+  801d10:	00 00 00 
+  801d13:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801d16:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801d19:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801d1d:	eb cf                	jmp    801cee <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801d1f:	49 89 dc             	mov    %rbx,%r12
+  801d22:	be 01 00 00 00       	mov    $0x1,%esi
+  801d27:	eb c5                	jmp    801cee <vprintfmt+0x80>
+            padc = ch;
+  801d29:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801d2d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801d30:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801d33:	eb b9                	jmp    801cee <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801d35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d38:	83 f8 2f             	cmp    $0x2f,%eax
+  801d3b:	77 24                	ja     801d61 <vprintfmt+0xf3>
+  801d3d:	89 c1                	mov    %eax,%ecx
+  801d3f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801d43:	83 c0 08             	add    $0x8,%eax
+  801d46:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d49:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801d4c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801d4f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d53:	79 99                	jns    801cee <vprintfmt+0x80>
+                width = precision;
+  801d55:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801d59:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801d5f:	eb 8d                	jmp    801cee <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801d61:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801d65:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d6d:	eb da                	jmp    801d49 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801d6f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801d74:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d78:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801d7e:	3c 39                	cmp    $0x39,%al
+  801d80:	77 1c                	ja     801d9e <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801d82:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801d86:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801d8a:	0f b6 c0             	movzbl %al,%eax
+  801d8d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801d92:	0f b6 03             	movzbl (%rbx),%eax
+  801d95:	3c 39                	cmp    $0x39,%al
+  801d97:	76 e9                	jbe    801d82 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801d99:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801d9c:	eb b1                	jmp    801d4f <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801d9e:	49 89 dc             	mov    %rbx,%r12
+  801da1:	eb ac                	jmp    801d4f <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801da3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801da6:	85 c9                	test   %ecx,%ecx
+  801da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dad:	0f 49 c1             	cmovns %ecx,%eax
+  801db0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801db3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801db6:	e9 33 ff ff ff       	jmp    801cee <vprintfmt+0x80>
+            lflag++;
+  801dbb:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801dbe:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801dc1:	e9 28 ff ff ff       	jmp    801cee <vprintfmt+0x80>
+            lflag--;
+  801dc6:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801dc9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801dcc:	e9 1d ff ff ff       	jmp    801cee <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801dd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd4:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd7:	77 19                	ja     801df2 <vprintfmt+0x184>
+  801dd9:	89 c2                	mov    %eax,%edx
+  801ddb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ddf:	83 c0 08             	add    $0x8,%eax
+  801de2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de5:	8b 3a                	mov    (%rdx),%edi
+  801de7:	4c 89 ee             	mov    %r13,%rsi
+  801dea:	41 ff d6             	call   *%r14
+            break;
+  801ded:	e9 bc fe ff ff       	jmp    801cae <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801df2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801df6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dfa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dfe:	eb e5                	jmp    801de5 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801e00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e03:	83 f8 2f             	cmp    $0x2f,%eax
+  801e06:	77 5a                	ja     801e62 <vprintfmt+0x1f4>
+  801e08:	89 c2                	mov    %eax,%edx
+  801e0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e0e:	83 c0 08             	add    $0x8,%eax
+  801e11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801e14:	8b 02                	mov    (%rdx),%eax
+  801e16:	89 c1                	mov    %eax,%ecx
+  801e18:	f7 d9                	neg    %ecx
+  801e1a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801e1d:	83 f9 13             	cmp    $0x13,%ecx
+  801e20:	7f 4e                	jg     801e70 <vprintfmt+0x202>
+  801e22:	48 63 c1             	movslq %ecx,%rax
+  801e25:	48 ba 80 63 80 00 00 	movabs $0x806380,%rdx
+  801e2c:	00 00 00 
+  801e2f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801e33:	48 85 c0             	test   %rax,%rax
+  801e36:	74 38                	je     801e70 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801e38:	48 89 c1             	mov    %rax,%rcx
+  801e3b:	48 ba 68 65 80 00 00 	movabs $0x806568,%rdx
+  801e42:	00 00 00 
+  801e45:	4c 89 ee             	mov    %r13,%rsi
+  801e48:	4c 89 f7             	mov    %r14,%rdi
+  801e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e50:	49 b8 31 1c 80 00 00 	movabs $0x801c31,%r8
+  801e57:	00 00 00 
+  801e5a:	41 ff d0             	call   *%r8
+  801e5d:	e9 4c fe ff ff       	jmp    801cae <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801e62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e6e:	eb a4                	jmp    801e14 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801e70:	48 ba 4c 5f 80 00 00 	movabs $0x805f4c,%rdx
+  801e77:	00 00 00 
+  801e7a:	4c 89 ee             	mov    %r13,%rsi
+  801e7d:	4c 89 f7             	mov    %r14,%rdi
+  801e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e85:	49 b8 31 1c 80 00 00 	movabs $0x801c31,%r8
+  801e8c:	00 00 00 
+  801e8f:	41 ff d0             	call   *%r8
+  801e92:	e9 17 fe ff ff       	jmp    801cae <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e9a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e9d:	77 6c                	ja     801f0b <vprintfmt+0x29d>
+  801e9f:	89 c2                	mov    %eax,%edx
+  801ea1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ea5:	83 c0 08             	add    $0x8,%eax
+  801ea8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eab:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801eae:	48 85 f6             	test   %rsi,%rsi
+  801eb1:	48 b8 45 5f 80 00 00 	movabs $0x805f45,%rax
+  801eb8:	00 00 00 
+  801ebb:	48 0f 45 c6          	cmovne %rsi,%rax
+  801ebf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801ec3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ec7:	7e 06                	jle    801ecf <vprintfmt+0x261>
+  801ec9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801ecd:	75 4a                	jne    801f19 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801ecf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801ed3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801ed7:	0f b6 00             	movzbl (%rax),%eax
+  801eda:	84 c0                	test   %al,%al
+  801edc:	0f 85 9a 00 00 00    	jne    801f7c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801ee2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801ee5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801ee9:	85 c0                	test   %eax,%eax
+  801eeb:	0f 8e bd fd ff ff    	jle    801cae <vprintfmt+0x40>
+  801ef1:	4c 89 ee             	mov    %r13,%rsi
+  801ef4:	bf 20 00 00 00       	mov    $0x20,%edi
+  801ef9:	41 ff d6             	call   *%r14
+  801efc:	41 83 ec 01          	sub    $0x1,%r12d
+  801f00:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801f04:	75 eb                	jne    801ef1 <vprintfmt+0x283>
+  801f06:	e9 a3 fd ff ff       	jmp    801cae <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801f0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f17:	eb 92                	jmp    801eab <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801f19:	49 63 f7             	movslq %r15d,%rsi
+  801f1c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801f20:	48 b8 32 24 80 00 00 	movabs $0x802432,%rax
+  801f27:	00 00 00 
+  801f2a:	ff d0                	call   *%rax
+  801f2c:	48 89 c2             	mov    %rax,%rdx
+  801f2f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f32:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801f34:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801f37:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	7e 91                	jle    801ecf <vprintfmt+0x261>
+  801f3e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801f43:	4c 89 ee             	mov    %r13,%rsi
+  801f46:	44 89 e7             	mov    %r12d,%edi
+  801f49:	41 ff d6             	call   *%r14
+  801f4c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801f50:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f53:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801f56:	75 eb                	jne    801f43 <vprintfmt+0x2d5>
+  801f58:	e9 72 ff ff ff       	jmp    801ecf <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f5d:	0f b6 f8             	movzbl %al,%edi
+  801f60:	4c 89 ee             	mov    %r13,%rsi
+  801f63:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801f66:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801f6a:	49 83 c4 01          	add    $0x1,%r12
+  801f6e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801f74:	84 c0                	test   %al,%al
+  801f76:	0f 84 66 ff ff ff    	je     801ee2 <vprintfmt+0x274>
+  801f7c:	45 85 ff             	test   %r15d,%r15d
+  801f7f:	78 0a                	js     801f8b <vprintfmt+0x31d>
+  801f81:	41 83 ef 01          	sub    $0x1,%r15d
+  801f85:	0f 88 57 ff ff ff    	js     801ee2 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801f8b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801f8f:	74 cc                	je     801f5d <vprintfmt+0x2ef>
+  801f91:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801f94:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801f99:	80 fa 5e             	cmp    $0x5e,%dl
+  801f9c:	77 c2                	ja     801f60 <vprintfmt+0x2f2>
+  801f9e:	eb bd                	jmp    801f5d <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801fa0:	40 84 f6             	test   %sil,%sil
+  801fa3:	75 26                	jne    801fcb <vprintfmt+0x35d>
+    switch (lflag) {
+  801fa5:	85 d2                	test   %edx,%edx
+  801fa7:	74 59                	je     802002 <vprintfmt+0x394>
+  801fa9:	83 fa 01             	cmp    $0x1,%edx
+  801fac:	74 7b                	je     802029 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801fae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb1:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb4:	0f 87 96 00 00 00    	ja     802050 <vprintfmt+0x3e2>
+  801fba:	89 c2                	mov    %eax,%edx
+  801fbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc0:	83 c0 08             	add    $0x8,%eax
+  801fc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc6:	4c 8b 22             	mov    (%rdx),%r12
+  801fc9:	eb 17                	jmp    801fe2 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801fcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fce:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd1:	77 21                	ja     801ff4 <vprintfmt+0x386>
+  801fd3:	89 c2                	mov    %eax,%edx
+  801fd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fd9:	83 c0 08             	add    $0x8,%eax
+  801fdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fdf:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801fe2:	4d 85 e4             	test   %r12,%r12
+  801fe5:	78 7a                	js     802061 <vprintfmt+0x3f3>
+            num = i;
+  801fe7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801fea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801fef:	e9 56 02 00 00       	jmp    80224a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ff4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ff8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ffc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802000:	eb dd                	jmp    801fdf <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  802002:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802005:	83 f8 2f             	cmp    $0x2f,%eax
+  802008:	77 11                	ja     80201b <vprintfmt+0x3ad>
+  80200a:	89 c2                	mov    %eax,%edx
+  80200c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802010:	83 c0 08             	add    $0x8,%eax
+  802013:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802016:	4c 63 22             	movslq (%rdx),%r12
+  802019:	eb c7                	jmp    801fe2 <vprintfmt+0x374>
+  80201b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80201f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802023:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802027:	eb ed                	jmp    802016 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  802029:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80202c:	83 f8 2f             	cmp    $0x2f,%eax
+  80202f:	77 11                	ja     802042 <vprintfmt+0x3d4>
+  802031:	89 c2                	mov    %eax,%edx
+  802033:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802037:	83 c0 08             	add    $0x8,%eax
+  80203a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80203d:	4c 8b 22             	mov    (%rdx),%r12
+  802040:	eb a0                	jmp    801fe2 <vprintfmt+0x374>
+  802042:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802046:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80204a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80204e:	eb ed                	jmp    80203d <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  802050:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802054:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802058:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205c:	e9 65 ff ff ff       	jmp    801fc6 <vprintfmt+0x358>
+                putch('-', put_arg);
+  802061:	4c 89 ee             	mov    %r13,%rsi
+  802064:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  802069:	41 ff d6             	call   *%r14
+                i = -i;
+  80206c:	49 f7 dc             	neg    %r12
+  80206f:	e9 73 ff ff ff       	jmp    801fe7 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  802074:	40 84 f6             	test   %sil,%sil
+  802077:	75 2e                	jne    8020a7 <vprintfmt+0x439>
+    switch (lflag) {
+  802079:	85 d2                	test   %edx,%edx
+  80207b:	7f 59                	jg     8020d6 <vprintfmt+0x468>
+  80207d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802080:	7d 7a                	jge    8020fc <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802082:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802085:	83 f8 2f             	cmp    $0x2f,%eax
+  802088:	0f 87 aa 00 00 00    	ja     802138 <vprintfmt+0x4ca>
+  80208e:	89 c2                	mov    %eax,%edx
+  802090:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802094:	83 c0 08             	add    $0x8,%eax
+  802097:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80209a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80209d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8020a2:	e9 a3 01 00 00       	jmp    80224a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ad:	77 19                	ja     8020c8 <vprintfmt+0x45a>
+  8020af:	89 c2                	mov    %eax,%edx
+  8020b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b5:	83 c0 08             	add    $0x8,%eax
+  8020b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020bb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8020be:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020c3:	e9 82 01 00 00       	jmp    80224a <vprintfmt+0x5dc>
+  8020c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d4:	eb e5                	jmp    8020bb <vprintfmt+0x44d>
+    switch (lflag) {
+  8020d6:	83 fa 01             	cmp    $0x1,%edx
+  8020d9:	75 a7                	jne    802082 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  8020db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020de:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e1:	77 47                	ja     80212a <vprintfmt+0x4bc>
+  8020e3:	89 c2                	mov    %eax,%edx
+  8020e5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e9:	83 c0 08             	add    $0x8,%eax
+  8020ec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ef:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8020f2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8020f7:	e9 4e 01 00 00       	jmp    80224a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ff:	83 f8 2f             	cmp    $0x2f,%eax
+  802102:	77 18                	ja     80211c <vprintfmt+0x4ae>
+  802104:	89 c2                	mov    %eax,%edx
+  802106:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80210a:	83 c0 08             	add    $0x8,%eax
+  80210d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802110:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802112:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802117:	e9 2e 01 00 00       	jmp    80224a <vprintfmt+0x5dc>
+  80211c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802120:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802124:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802128:	eb e6                	jmp    802110 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80212a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80212e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802132:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802136:	eb b7                	jmp    8020ef <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  802138:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802140:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802144:	e9 51 ff ff ff       	jmp    80209a <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802149:	40 84 f6             	test   %sil,%sil
+  80214c:	75 2e                	jne    80217c <vprintfmt+0x50e>
+    switch (lflag) {
+  80214e:	85 d2                	test   %edx,%edx
+  802150:	7f 59                	jg     8021ab <vprintfmt+0x53d>
+  802152:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802155:	7d 77                	jge    8021ce <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802157:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80215a:	83 f8 2f             	cmp    $0x2f,%eax
+  80215d:	0f 87 a4 00 00 00    	ja     802207 <vprintfmt+0x599>
+  802163:	89 c2                	mov    %eax,%edx
+  802165:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802169:	83 c0 08             	add    $0x8,%eax
+  80216c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80216f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802172:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802177:	e9 ce 00 00 00       	jmp    80224a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80217c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80217f:	83 f8 2f             	cmp    $0x2f,%eax
+  802182:	77 19                	ja     80219d <vprintfmt+0x52f>
+  802184:	89 c2                	mov    %eax,%edx
+  802186:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80218a:	83 c0 08             	add    $0x8,%eax
+  80218d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802190:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802193:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802198:	e9 ad 00 00 00       	jmp    80224a <vprintfmt+0x5dc>
+  80219d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a9:	eb e5                	jmp    802190 <vprintfmt+0x522>
+    switch (lflag) {
+  8021ab:	83 fa 01             	cmp    $0x1,%edx
+  8021ae:	75 a7                	jne    802157 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8021b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8021b6:	77 41                	ja     8021f9 <vprintfmt+0x58b>
+  8021b8:	89 c2                	mov    %eax,%edx
+  8021ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021be:	83 c0 08             	add    $0x8,%eax
+  8021c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021c4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8021c7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8021cc:	eb 7c                	jmp    80224a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8021d4:	77 15                	ja     8021eb <vprintfmt+0x57d>
+  8021d6:	89 c2                	mov    %eax,%edx
+  8021d8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021dc:	83 c0 08             	add    $0x8,%eax
+  8021df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021e2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8021e4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8021e9:	eb 5f                	jmp    80224a <vprintfmt+0x5dc>
+  8021eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021f7:	eb e9                	jmp    8021e2 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8021f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802201:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802205:	eb bd                	jmp    8021c4 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802207:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80220b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802213:	e9 57 ff ff ff       	jmp    80216f <vprintfmt+0x501>
+            putch('0', put_arg);
+  802218:	4c 89 ee             	mov    %r13,%rsi
+  80221b:	bf 30 00 00 00       	mov    $0x30,%edi
+  802220:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802223:	4c 89 ee             	mov    %r13,%rsi
+  802226:	bf 78 00 00 00       	mov    $0x78,%edi
+  80222b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80222e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802231:	83 f8 2f             	cmp    $0x2f,%eax
+  802234:	77 47                	ja     80227d <vprintfmt+0x60f>
+  802236:	89 c2                	mov    %eax,%edx
+  802238:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80223c:	83 c0 08             	add    $0x8,%eax
+  80223f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802242:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802245:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80224a:	48 83 ec 08          	sub    $0x8,%rsp
+  80224e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802252:	0f 94 c0             	sete   %al
+  802255:	0f b6 c0             	movzbl %al,%eax
+  802258:	50                   	push   %rax
+  802259:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80225e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802262:	4c 89 ee             	mov    %r13,%rsi
+  802265:	4c 89 f7             	mov    %r14,%rdi
+  802268:	48 b8 63 1b 80 00 00 	movabs $0x801b63,%rax
+  80226f:	00 00 00 
+  802272:	ff d0                	call   *%rax
+            break;
+  802274:	48 83 c4 10          	add    $0x10,%rsp
+  802278:	e9 31 fa ff ff       	jmp    801cae <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80227d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802281:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802285:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802289:	eb b7                	jmp    802242 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80228b:	40 84 f6             	test   %sil,%sil
+  80228e:	75 2b                	jne    8022bb <vprintfmt+0x64d>
+    switch (lflag) {
+  802290:	85 d2                	test   %edx,%edx
+  802292:	7f 56                	jg     8022ea <vprintfmt+0x67c>
+  802294:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802297:	7d 77                	jge    802310 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802299:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80229c:	83 f8 2f             	cmp    $0x2f,%eax
+  80229f:	0f 87 a7 00 00 00    	ja     80234c <vprintfmt+0x6de>
+  8022a5:	89 c2                	mov    %eax,%edx
+  8022a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022ab:	83 c0 08             	add    $0x8,%eax
+  8022ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022b1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8022b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8022b9:	eb 8f                	jmp    80224a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8022bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022be:	83 f8 2f             	cmp    $0x2f,%eax
+  8022c1:	77 19                	ja     8022dc <vprintfmt+0x66e>
+  8022c3:	89 c2                	mov    %eax,%edx
+  8022c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022c9:	83 c0 08             	add    $0x8,%eax
+  8022cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022cf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8022d2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8022d7:	e9 6e ff ff ff       	jmp    80224a <vprintfmt+0x5dc>
+  8022dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8022e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8022e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022e8:	eb e5                	jmp    8022cf <vprintfmt+0x661>
+    switch (lflag) {
+  8022ea:	83 fa 01             	cmp    $0x1,%edx
+  8022ed:	75 aa                	jne    802299 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8022ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8022f5:	77 47                	ja     80233e <vprintfmt+0x6d0>
+  8022f7:	89 c2                	mov    %eax,%edx
+  8022f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022fd:	83 c0 08             	add    $0x8,%eax
+  802300:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802303:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802306:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80230b:	e9 3a ff ff ff       	jmp    80224a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802310:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802313:	83 f8 2f             	cmp    $0x2f,%eax
+  802316:	77 18                	ja     802330 <vprintfmt+0x6c2>
+  802318:	89 c2                	mov    %eax,%edx
+  80231a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80231e:	83 c0 08             	add    $0x8,%eax
+  802321:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802324:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802326:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80232b:	e9 1a ff ff ff       	jmp    80224a <vprintfmt+0x5dc>
+  802330:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802334:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802338:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80233c:	eb e6                	jmp    802324 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80233e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802342:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802346:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80234a:	eb b7                	jmp    802303 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80234c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802350:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802354:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802358:	e9 54 ff ff ff       	jmp    8022b1 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80235d:	4c 89 ee             	mov    %r13,%rsi
+  802360:	bf 25 00 00 00       	mov    $0x25,%edi
+  802365:	41 ff d6             	call   *%r14
+            break;
+  802368:	e9 41 f9 ff ff       	jmp    801cae <vprintfmt+0x40>
+            putch('%', put_arg);
+  80236d:	4c 89 ee             	mov    %r13,%rsi
+  802370:	bf 25 00 00 00       	mov    $0x25,%edi
+  802375:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802378:	48 83 eb 01          	sub    $0x1,%rbx
+  80237c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802380:	75 f6                	jne    802378 <vprintfmt+0x70a>
+  802382:	e9 27 f9 ff ff       	jmp    801cae <vprintfmt+0x40>
+
+0000000000802387 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802387:	55                   	push   %rbp
+  802388:	48 89 e5             	mov    %rsp,%rbp
+  80238b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80238f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802393:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802398:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80239c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8023a3:	48 85 ff             	test   %rdi,%rdi
+  8023a6:	74 2b                	je     8023d3 <vsnprintf+0x4c>
+  8023a8:	48 85 f6             	test   %rsi,%rsi
+  8023ab:	74 26                	je     8023d3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8023ad:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8023b1:	48 bf 19 1c 80 00 00 	movabs $0x801c19,%rdi
+  8023b8:	00 00 00 
+  8023bb:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8023c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023cb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8023ce:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8023d1:	c9                   	leave
+  8023d2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8023d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023d8:	eb f7                	jmp    8023d1 <vsnprintf+0x4a>
+
+00000000008023da <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	48 83 ec 50          	sub    $0x50,%rsp
+  8023e2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023e6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8023ea:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8023ee:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8023f5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8023f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023fd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802401:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802405:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802409:	48 b8 87 23 80 00 00 	movabs $0x802387,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802415:	c9                   	leave
+  802416:	c3                   	ret
+
+0000000000802417 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802417:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80241a:	74 10                	je     80242c <strlen+0x15>
+    size_t n = 0;
+  80241c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802421:	48 83 c0 01          	add    $0x1,%rax
+  802425:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802429:	75 f6                	jne    802421 <strlen+0xa>
+  80242b:	c3                   	ret
+    size_t n = 0;
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802431:	c3                   	ret
+
+0000000000802432 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802432:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802435:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80243a:	48 85 f6             	test   %rsi,%rsi
+  80243d:	74 11                	je     802450 <strnlen+0x1e>
+  80243f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802443:	74 0c                	je     802451 <strnlen+0x1f>
+  802445:	48 83 c2 01          	add    $0x1,%rdx
+  802449:	48 39 d0             	cmp    %rdx,%rax
+  80244c:	75 f1                	jne    80243f <strnlen+0xd>
+  80244e:	eb 04                	jmp    802454 <strnlen+0x22>
+  802450:	c3                   	ret
+  802451:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802454:	c3                   	ret
+
+0000000000802455 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802455:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802458:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802461:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802464:	48 83 c2 01          	add    $0x1,%rdx
+  802468:	84 c9                	test   %cl,%cl
+  80246a:	75 f1                	jne    80245d <strcpy+0x8>
+        ;
+    return res;
+}
+  80246c:	c3                   	ret
+
+000000000080246d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80246d:	55                   	push   %rbp
+  80246e:	48 89 e5             	mov    %rsp,%rbp
+  802471:	41 54                	push   %r12
+  802473:	53                   	push   %rbx
+  802474:	48 89 fb             	mov    %rdi,%rbx
+  802477:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80247a:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802486:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80248a:	4c 89 e6             	mov    %r12,%rsi
+  80248d:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  802494:	00 00 00 
+  802497:	ff d0                	call   *%rax
+    return dst;
+}
+  802499:	48 89 d8             	mov    %rbx,%rax
+  80249c:	5b                   	pop    %rbx
+  80249d:	41 5c                	pop    %r12
+  80249f:	5d                   	pop    %rbp
+  8024a0:	c3                   	ret
+
+00000000008024a1 <toupper>:
+
+int
+toupper(int ch) {
+  8024a1:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8024a3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8024a6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8024a9:	83 f9 1a             	cmp    $0x1a,%ecx
+  8024ac:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8024af:	c3                   	ret
+
+00000000008024b0 <tolower>:
+
+int
+tolower(int ch) {
+  8024b0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8024b2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8024b5:	8d 57 20             	lea    0x20(%rdi),%edx
+  8024b8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8024bb:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8024be:	c3                   	ret
+
+00000000008024bf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8024bf:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8024c2:	48 85 d2             	test   %rdx,%rdx
+  8024c5:	74 1f                	je     8024e6 <strncpy+0x27>
+  8024c7:	48 01 fa             	add    %rdi,%rdx
+  8024ca:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8024cd:	48 83 c1 01          	add    $0x1,%rcx
+  8024d1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8024d5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8024d9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8024dd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8024e1:	48 39 ca             	cmp    %rcx,%rdx
+  8024e4:	75 e7                	jne    8024cd <strncpy+0xe>
+    }
+    return ret;
+}
+  8024e6:	c3                   	ret
+
+00000000008024e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8024e7:	48 89 f8             	mov    %rdi,%rax
+  8024ea:	48 85 d2             	test   %rdx,%rdx
+  8024ed:	74 24                	je     802513 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8024ef:	48 83 ea 01          	sub    $0x1,%rdx
+  8024f3:	74 1b                	je     802510 <strlcpy+0x29>
+  8024f5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8024f9:	0f b6 16             	movzbl (%rsi),%edx
+  8024fc:	84 d2                	test   %dl,%dl
+  8024fe:	74 10                	je     802510 <strlcpy+0x29>
+            *dst++ = *src++;
+  802500:	48 83 c6 01          	add    $0x1,%rsi
+  802504:	48 83 c0 01          	add    $0x1,%rax
+  802508:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80250b:	48 39 c8             	cmp    %rcx,%rax
+  80250e:	75 e9                	jne    8024f9 <strlcpy+0x12>
+        *dst = '\0';
+  802510:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802513:	48 29 f8             	sub    %rdi,%rax
+}
+  802516:	c3                   	ret
+
+0000000000802517 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802517:	0f b6 07             	movzbl (%rdi),%eax
+  80251a:	84 c0                	test   %al,%al
+  80251c:	74 13                	je     802531 <strcmp+0x1a>
+  80251e:	38 06                	cmp    %al,(%rsi)
+  802520:	75 0f                	jne    802531 <strcmp+0x1a>
+  802522:	48 83 c7 01          	add    $0x1,%rdi
+  802526:	48 83 c6 01          	add    $0x1,%rsi
+  80252a:	0f b6 07             	movzbl (%rdi),%eax
+  80252d:	84 c0                	test   %al,%al
+  80252f:	75 ed                	jne    80251e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802531:	0f b6 c0             	movzbl %al,%eax
+  802534:	0f b6 16             	movzbl (%rsi),%edx
+  802537:	29 d0                	sub    %edx,%eax
+}
+  802539:	c3                   	ret
+
+000000000080253a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80253a:	48 85 d2             	test   %rdx,%rdx
+  80253d:	74 1f                	je     80255e <strncmp+0x24>
+  80253f:	0f b6 07             	movzbl (%rdi),%eax
+  802542:	84 c0                	test   %al,%al
+  802544:	74 1e                	je     802564 <strncmp+0x2a>
+  802546:	3a 06                	cmp    (%rsi),%al
+  802548:	75 1a                	jne    802564 <strncmp+0x2a>
+  80254a:	48 83 c7 01          	add    $0x1,%rdi
+  80254e:	48 83 c6 01          	add    $0x1,%rsi
+  802552:	48 83 ea 01          	sub    $0x1,%rdx
+  802556:	75 e7                	jne    80253f <strncmp+0x5>
+
+    if (!n) return 0;
+  802558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255d:	c3                   	ret
+  80255e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802563:	c3                   	ret
+  802564:	48 85 d2             	test   %rdx,%rdx
+  802567:	74 09                	je     802572 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802569:	0f b6 07             	movzbl (%rdi),%eax
+  80256c:	0f b6 16             	movzbl (%rsi),%edx
+  80256f:	29 d0                	sub    %edx,%eax
+  802571:	c3                   	ret
+    if (!n) return 0;
+  802572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802577:	c3                   	ret
+
+0000000000802578 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802578:	0f b6 17             	movzbl (%rdi),%edx
+  80257b:	84 d2                	test   %dl,%dl
+  80257d:	74 18                	je     802597 <strchr+0x1f>
+        if (*str == c) {
+  80257f:	0f be d2             	movsbl %dl,%edx
+  802582:	39 f2                	cmp    %esi,%edx
+  802584:	74 17                	je     80259d <strchr+0x25>
+    for (; *str; str++) {
+  802586:	48 83 c7 01          	add    $0x1,%rdi
+  80258a:	0f b6 17             	movzbl (%rdi),%edx
+  80258d:	84 d2                	test   %dl,%dl
+  80258f:	75 ee                	jne    80257f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802591:	b8 00 00 00 00       	mov    $0x0,%eax
+  802596:	c3                   	ret
+  802597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259c:	c3                   	ret
+  80259d:	48 89 f8             	mov    %rdi,%rax
+}
+  8025a0:	c3                   	ret
+
+00000000008025a1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8025a1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8025a4:	0f b6 17             	movzbl (%rdi),%edx
+  8025a7:	84 d2                	test   %dl,%dl
+  8025a9:	74 13                	je     8025be <strfind+0x1d>
+  8025ab:	0f be d2             	movsbl %dl,%edx
+  8025ae:	39 f2                	cmp    %esi,%edx
+  8025b0:	74 0b                	je     8025bd <strfind+0x1c>
+  8025b2:	48 83 c0 01          	add    $0x1,%rax
+  8025b6:	0f b6 10             	movzbl (%rax),%edx
+  8025b9:	84 d2                	test   %dl,%dl
+  8025bb:	75 ee                	jne    8025ab <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8025bd:	c3                   	ret
+  8025be:	c3                   	ret
+
+00000000008025bf <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8025bf:	48 39 f7             	cmp    %rsi,%rdi
+  8025c2:	74 65                	je     802629 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8025c4:	55                   	push   %rbp
+  8025c5:	48 89 e5             	mov    %rsp,%rbp
+  8025c8:	41 57                	push   %r15
+  8025ca:	41 56                	push   %r14
+  8025cc:	41 55                	push   %r13
+  8025ce:	41 54                	push   %r12
+  8025d0:	53                   	push   %rbx
+  8025d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8025d5:	48 89 fb             	mov    %rdi,%rbx
+  8025d8:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8025db:	49 bf b0 24 80 00 00 	movabs $0x8024b0,%r15
+  8025e2:	00 00 00 
+  8025e5:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8025e9:	41 0f b6 fd          	movzbl %r13b,%edi
+  8025ed:	41 ff d7             	call   *%r15
+  8025f0:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8025f3:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8025f8:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025fc:	41 ff d7             	call   *%r15
+  8025ff:	89 c2                	mov    %eax,%edx
+  802601:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802604:	29 d0                	sub    %edx,%eax
+  802606:	75 12                	jne    80261a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802608:	48 83 c3 01          	add    $0x1,%rbx
+  80260c:	45 84 ed             	test   %r13b,%r13b
+  80260f:	74 09                	je     80261a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802611:	49 83 c4 01          	add    $0x1,%r12
+  802615:	45 84 f6             	test   %r14b,%r14b
+  802618:	75 cb                	jne    8025e5 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80261a:	48 83 c4 18          	add    $0x18,%rsp
+  80261e:	5b                   	pop    %rbx
+  80261f:	41 5c                	pop    %r12
+  802621:	41 5d                	pop    %r13
+  802623:	41 5e                	pop    %r14
+  802625:	41 5f                	pop    %r15
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+    if (p1 == p2) return 0;
+  802629:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80262e:	c3                   	ret
+
+000000000080262f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80262f:	48 39 f7             	cmp    %rsi,%rdi
+  802632:	74 7d                	je     8026b1 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802634:	55                   	push   %rbp
+  802635:	48 89 e5             	mov    %rsp,%rbp
+  802638:	41 57                	push   %r15
+  80263a:	41 56                	push   %r14
+  80263c:	41 55                	push   %r13
+  80263e:	41 54                	push   %r12
+  802640:	53                   	push   %rbx
+  802641:	48 83 ec 18          	sub    $0x18,%rsp
+  802645:	48 89 fb             	mov    %rdi,%rbx
+  802648:	49 89 f4             	mov    %rsi,%r12
+  80264b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80264f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802653:	49 bf b0 24 80 00 00 	movabs $0x8024b0,%r15
+  80265a:	00 00 00 
+    while (n--) {
+  80265d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802661:	48 39 c3             	cmp    %rax,%rbx
+  802664:	74 37                	je     80269d <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802666:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80266a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80266e:	41 ff d7             	call   *%r15
+  802671:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802674:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802679:	41 0f b6 fe          	movzbl %r14b,%edi
+  80267d:	41 ff d7             	call   *%r15
+  802680:	89 c2                	mov    %eax,%edx
+  802682:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802685:	29 d0                	sub    %edx,%eax
+  802687:	75 19                	jne    8026a2 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802689:	48 83 c3 01          	add    $0x1,%rbx
+  80268d:	45 84 ed             	test   %r13b,%r13b
+  802690:	74 10                	je     8026a2 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802692:	49 83 c4 01          	add    $0x1,%r12
+  802696:	45 84 f6             	test   %r14b,%r14b
+  802699:	75 c2                	jne    80265d <strncasecmp+0x2e>
+  80269b:	eb 05                	jmp    8026a2 <strncasecmp+0x73>
+  80269d:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8026a2:	48 83 c4 18          	add    $0x18,%rsp
+  8026a6:	5b                   	pop    %rbx
+  8026a7:	41 5c                	pop    %r12
+  8026a9:	41 5d                	pop    %r13
+  8026ab:	41 5e                	pop    %r14
+  8026ad:	41 5f                	pop    %r15
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8026b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b6:	c3                   	ret
+
+00000000008026b7 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8026b7:	83 e7 df             	and    $0xffffffdf,%edi
+  8026ba:	83 ef 41             	sub    $0x41,%edi
+  8026bd:	83 ff 19             	cmp    $0x19,%edi
+  8026c0:	0f 96 c0             	setbe  %al
+}
+  8026c3:	c3                   	ret
+
+00000000008026c4 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8026c4:	83 ff 20             	cmp    $0x20,%edi
+  8026c7:	0f 94 c0             	sete   %al
+  8026ca:	83 ff 09             	cmp    $0x9,%edi
+  8026cd:	0f 94 c2             	sete   %dl
+  8026d0:	09 d0                	or     %edx,%eax
+}
+  8026d2:	c3                   	ret
+
+00000000008026d3 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8026d3:	55                   	push   %rbp
+  8026d4:	48 89 e5             	mov    %rsp,%rbp
+  8026d7:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8026d9:	48 bf 3f 64 80 00 00 	movabs $0x80643f,%rdi
+  8026e0:	00 00 00 
+  8026e3:	48 b8 78 25 80 00 00 	movabs $0x802578,%rax
+  8026ea:	00 00 00 
+  8026ed:	ff d0                	call   *%rax
+  8026ef:	48 85 c0             	test   %rax,%rax
+  8026f2:	0f 95 c0             	setne  %al
+}
+  8026f5:	5d                   	pop    %rbp
+  8026f6:	c3                   	ret
+
+00000000008026f7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8026f7:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8026fa:	48 89 f8             	mov    %rdi,%rax
+  8026fd:	48 f7 d8             	neg    %rax
+  802700:	83 e0 07             	and    $0x7,%eax
+  802703:	49 89 d1             	mov    %rdx,%r9
+  802706:	49 29 c1             	sub    %rax,%r9
+  802709:	78 36                	js     802741 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80270b:	40 0f b6 c6          	movzbl %sil,%eax
+  80270f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802716:	01 01 01 
+  802719:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80271d:	40 f6 c7 07          	test   $0x7,%dil
+  802721:	75 38                	jne    80275b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802723:	4c 89 c9             	mov    %r9,%rcx
+  802726:	48 c1 f9 03          	sar    $0x3,%rcx
+  80272a:	74 0c                	je     802738 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80272c:	fc                   	cld
+  80272d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802730:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802734:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802738:	4d 85 c9             	test   %r9,%r9
+  80273b:	75 45                	jne    802782 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80273d:	4c 89 c0             	mov    %r8,%rax
+  802740:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802741:	48 85 d2             	test   %rdx,%rdx
+  802744:	74 f7                	je     80273d <memset+0x46>
+  802746:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802749:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80274c:	48 83 c0 01          	add    $0x1,%rax
+  802750:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802754:	48 39 c2             	cmp    %rax,%rdx
+  802757:	75 f3                	jne    80274c <memset+0x55>
+  802759:	eb e2                	jmp    80273d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80275b:	40 f6 c7 01          	test   $0x1,%dil
+  80275f:	74 06                	je     802767 <memset+0x70>
+  802761:	88 07                	mov    %al,(%rdi)
+  802763:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802767:	40 f6 c7 02          	test   $0x2,%dil
+  80276b:	74 07                	je     802774 <memset+0x7d>
+  80276d:	66 89 07             	mov    %ax,(%rdi)
+  802770:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802774:	40 f6 c7 04          	test   $0x4,%dil
+  802778:	74 a9                	je     802723 <memset+0x2c>
+  80277a:	89 07                	mov    %eax,(%rdi)
+  80277c:	48 83 c7 04          	add    $0x4,%rdi
+  802780:	eb a1                	jmp    802723 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802782:	41 f6 c1 04          	test   $0x4,%r9b
+  802786:	74 06                	je     80278e <memset+0x97>
+  802788:	89 07                	mov    %eax,(%rdi)
+  80278a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80278e:	41 f6 c1 02          	test   $0x2,%r9b
+  802792:	74 07                	je     80279b <memset+0xa4>
+  802794:	66 89 07             	mov    %ax,(%rdi)
+  802797:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80279b:	41 f6 c1 01          	test   $0x1,%r9b
+  80279f:	74 9c                	je     80273d <memset+0x46>
+  8027a1:	88 07                	mov    %al,(%rdi)
+  8027a3:	eb 98                	jmp    80273d <memset+0x46>
+
+00000000008027a5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8027a5:	48 89 f8             	mov    %rdi,%rax
+  8027a8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8027ab:	48 39 fe             	cmp    %rdi,%rsi
+  8027ae:	73 3b                	jae    8027eb <memmove+0x46>
+  8027b0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8027b4:	48 39 d7             	cmp    %rdx,%rdi
+  8027b7:	73 32                	jae    8027eb <memmove+0x46>
+        s += n;
+        d += n;
+  8027b9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027bd:	48 89 d6             	mov    %rdx,%rsi
+  8027c0:	48 09 fe             	or     %rdi,%rsi
+  8027c3:	48 09 ce             	or     %rcx,%rsi
+  8027c6:	40 f6 c6 07          	test   $0x7,%sil
+  8027ca:	75 12                	jne    8027de <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8027cc:	48 83 ef 08          	sub    $0x8,%rdi
+  8027d0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8027d4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027d8:	fd                   	std
+  8027d9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8027dc:	fc                   	cld
+  8027dd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8027de:	48 83 ef 01          	sub    $0x1,%rdi
+  8027e2:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8027e6:	fd                   	std
+  8027e7:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8027e9:	eb f1                	jmp    8027dc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8027eb:	48 89 f2             	mov    %rsi,%rdx
+  8027ee:	48 09 c2             	or     %rax,%rdx
+  8027f1:	48 09 ca             	or     %rcx,%rdx
+  8027f4:	f6 c2 07             	test   $0x7,%dl
+  8027f7:	75 0c                	jne    802805 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8027f9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8027fd:	48 89 c7             	mov    %rax,%rdi
+  802800:	fc                   	cld
+  802801:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802804:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802805:	48 89 c7             	mov    %rax,%rdi
+  802808:	fc                   	cld
+  802809:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80280b:	c3                   	ret
+
+000000000080280c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80280c:	55                   	push   %rbp
+  80280d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802810:	48 b8 a5 27 80 00 00 	movabs $0x8027a5,%rax
+  802817:	00 00 00 
+  80281a:	ff d0                	call   *%rax
+}
+  80281c:	5d                   	pop    %rbp
+  80281d:	c3                   	ret
+
+000000000080281e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80281e:	55                   	push   %rbp
+  80281f:	48 89 e5             	mov    %rsp,%rbp
+  802822:	41 57                	push   %r15
+  802824:	41 56                	push   %r14
+  802826:	41 55                	push   %r13
+  802828:	41 54                	push   %r12
+  80282a:	53                   	push   %rbx
+  80282b:	48 83 ec 08          	sub    $0x8,%rsp
+  80282f:	49 89 fe             	mov    %rdi,%r14
+  802832:	49 89 f7             	mov    %rsi,%r15
+  802835:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802838:	48 89 f7             	mov    %rsi,%rdi
+  80283b:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  802842:	00 00 00 
+  802845:	ff d0                	call   *%rax
+  802847:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80284a:	48 89 de             	mov    %rbx,%rsi
+  80284d:	4c 89 f7             	mov    %r14,%rdi
+  802850:	48 b8 32 24 80 00 00 	movabs $0x802432,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80285f:	48 39 c3             	cmp    %rax,%rbx
+  802862:	74 36                	je     80289a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802864:	48 89 d8             	mov    %rbx,%rax
+  802867:	4c 29 e8             	sub    %r13,%rax
+  80286a:	49 39 c4             	cmp    %rax,%r12
+  80286d:	73 31                	jae    8028a0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80286f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802874:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802878:	4c 89 fe             	mov    %r15,%rsi
+  80287b:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  802882:	00 00 00 
+  802885:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802887:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80288b:	48 83 c4 08          	add    $0x8,%rsp
+  80288f:	5b                   	pop    %rbx
+  802890:	41 5c                	pop    %r12
+  802892:	41 5d                	pop    %r13
+  802894:	41 5e                	pop    %r14
+  802896:	41 5f                	pop    %r15
+  802898:	5d                   	pop    %rbp
+  802899:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80289a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80289e:	eb eb                	jmp    80288b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8028a0:	48 83 eb 01          	sub    $0x1,%rbx
+  8028a4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8028a8:	48 89 da             	mov    %rbx,%rdx
+  8028ab:	4c 89 fe             	mov    %r15,%rsi
+  8028ae:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  8028b5:	00 00 00 
+  8028b8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8028ba:	49 01 de             	add    %rbx,%r14
+  8028bd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8028c2:	eb c3                	jmp    802887 <strlcat+0x69>
+
+00000000008028c4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8028c4:	48 85 d2             	test   %rdx,%rdx
+  8028c7:	74 2d                	je     8028f6 <memcmp+0x32>
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8028ce:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8028d2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8028d7:	44 38 c1             	cmp    %r8b,%cl
+  8028da:	75 0f                	jne    8028eb <memcmp+0x27>
+    while (n-- > 0) {
+  8028dc:	48 83 c0 01          	add    $0x1,%rax
+  8028e0:	48 39 c2             	cmp    %rax,%rdx
+  8028e3:	75 e9                	jne    8028ce <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8028e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ea:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8028eb:	0f b6 c1             	movzbl %cl,%eax
+  8028ee:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8028f2:	44 29 c0             	sub    %r8d,%eax
+  8028f5:	c3                   	ret
+    return 0;
+  8028f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028fb:	c3                   	ret
+
+00000000008028fc <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8028fc:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802900:	48 39 c7             	cmp    %rax,%rdi
+  802903:	73 0f                	jae    802914 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802905:	40 38 37             	cmp    %sil,(%rdi)
+  802908:	74 0e                	je     802918 <memfind+0x1c>
+    for (; src < end; src++) {
+  80290a:	48 83 c7 01          	add    $0x1,%rdi
+  80290e:	48 39 f8             	cmp    %rdi,%rax
+  802911:	75 f2                	jne    802905 <memfind+0x9>
+  802913:	c3                   	ret
+  802914:	48 89 f8             	mov    %rdi,%rax
+  802917:	c3                   	ret
+  802918:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80291b:	c3                   	ret
+
+000000000080291c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80291c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80291f:	0f b6 37             	movzbl (%rdi),%esi
+  802922:	40 80 fe 20          	cmp    $0x20,%sil
+  802926:	74 06                	je     80292e <strtol+0x12>
+  802928:	40 80 fe 09          	cmp    $0x9,%sil
+  80292c:	75 13                	jne    802941 <strtol+0x25>
+  80292e:	48 83 c7 01          	add    $0x1,%rdi
+  802932:	0f b6 37             	movzbl (%rdi),%esi
+  802935:	40 80 fe 20          	cmp    $0x20,%sil
+  802939:	74 f3                	je     80292e <strtol+0x12>
+  80293b:	40 80 fe 09          	cmp    $0x9,%sil
+  80293f:	74 ed                	je     80292e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802941:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802944:	83 e0 fd             	and    $0xfffffffd,%eax
+  802947:	3c 01                	cmp    $0x1,%al
+  802949:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80294d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802953:	75 0f                	jne    802964 <strtol+0x48>
+  802955:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802958:	74 14                	je     80296e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80295a:	85 d2                	test   %edx,%edx
+  80295c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802961:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802964:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802969:	4c 63 ca             	movslq %edx,%r9
+  80296c:	eb 36                	jmp    8029a4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80296e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802972:	74 0f                	je     802983 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802974:	85 d2                	test   %edx,%edx
+  802976:	75 ec                	jne    802964 <strtol+0x48>
+        s++;
+  802978:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80297c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802981:	eb e1                	jmp    802964 <strtol+0x48>
+        s += 2;
+  802983:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802987:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80298c:	eb d6                	jmp    802964 <strtol+0x48>
+            dig -= '0';
+  80298e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802991:	44 0f b6 c1          	movzbl %cl,%r8d
+  802995:	41 39 d0             	cmp    %edx,%r8d
+  802998:	7d 21                	jge    8029bb <strtol+0x9f>
+        val = val * base + dig;
+  80299a:	49 0f af c1          	imul   %r9,%rax
+  80299e:	0f b6 c9             	movzbl %cl,%ecx
+  8029a1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8029a4:	48 83 c7 01          	add    $0x1,%rdi
+  8029a8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8029ac:	80 f9 39             	cmp    $0x39,%cl
+  8029af:	76 dd                	jbe    80298e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8029b1:	80 f9 7b             	cmp    $0x7b,%cl
+  8029b4:	77 05                	ja     8029bb <strtol+0x9f>
+            dig -= 'a' - 10;
+  8029b6:	83 e9 57             	sub    $0x57,%ecx
+  8029b9:	eb d6                	jmp    802991 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8029bb:	4d 85 d2             	test   %r10,%r10
+  8029be:	74 03                	je     8029c3 <strtol+0xa7>
+  8029c0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8029c3:	48 89 c2             	mov    %rax,%rdx
+  8029c6:	48 f7 da             	neg    %rdx
+  8029c9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8029cd:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8029d1:	c3                   	ret
+
+00000000008029d2 <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  8029d2:	55                   	push   %rbp
+  8029d3:	48 89 e5             	mov    %rsp,%rbp
+  8029d6:	41 57                	push   %r15
+  8029d8:	41 56                	push   %r14
+  8029da:	41 55                	push   %r13
+  8029dc:	41 54                	push   %r12
+  8029de:	53                   	push   %rbx
+  8029df:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  8029e3:	48 85 ff             	test   %rdi,%rdi
+  8029e6:	74 23                	je     802a0b <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  8029e8:	48 89 fa             	mov    %rdi,%rdx
+  8029eb:	48 be 68 65 80 00 00 	movabs $0x806568,%rsi
+  8029f2:	00 00 00 
+  8029f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ff:	48 b9 5d 42 80 00 00 	movabs $0x80425d,%rcx
+  802a06:	00 00 00 
+  802a09:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  802a0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a10:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  802a17:	00 00 00 
+  802a1a:	ff d0                	call   *%rax
+  802a1c:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  802a1f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  802a25:	49 bd 2c 18 80 00 00 	movabs $0x80182c,%r13
+  802a2c:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  802a2f:	49 bf 09 18 80 00 00 	movabs $0x801809,%r15
+  802a36:	00 00 00 
+  802a39:	eb 46                	jmp    802a81 <readline+0xaf>
+            return NULL;
+  802a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  802a40:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  802a43:	75 0f                	jne    802a54 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  802a45:	48 83 c4 08          	add    $0x8,%rsp
+  802a49:	5b                   	pop    %rbx
+  802a4a:	41 5c                	pop    %r12
+  802a4c:	41 5d                	pop    %r13
+  802a4e:	41 5e                	pop    %r14
+  802a50:	41 5f                	pop    %r15
+  802a52:	5d                   	pop    %rbp
+  802a53:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  802a54:	89 de                	mov    %ebx,%esi
+  802a56:	48 bf 47 64 80 00 00 	movabs $0x806447,%rdi
+  802a5d:	00 00 00 
+  802a60:	48 ba 1e 1b 80 00 00 	movabs $0x801b1e,%rdx
+  802a67:	00 00 00 
+  802a6a:	ff d2                	call   *%rdx
+            return NULL;
+  802a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a71:	eb d2                	jmp    802a45 <readline+0x73>
+            if (i) {
+  802a73:	4d 85 e4             	test   %r12,%r12
+  802a76:	74 09                	je     802a81 <readline+0xaf>
+                if (echo) {
+  802a78:	45 85 f6             	test   %r14d,%r14d
+  802a7b:	75 3f                	jne    802abc <readline+0xea>
+                i--;
+  802a7d:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  802a81:	41 ff d5             	call   *%r13
+  802a84:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	78 b1                	js     802a3b <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  802a8a:	83 f8 08             	cmp    $0x8,%eax
+  802a8d:	74 e4                	je     802a73 <readline+0xa1>
+  802a8f:	83 f8 7f             	cmp    $0x7f,%eax
+  802a92:	74 df                	je     802a73 <readline+0xa1>
+        } else if (c >= ' ') {
+  802a94:	83 f8 1f             	cmp    $0x1f,%eax
+  802a97:	7e 4d                	jle    802ae6 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  802a99:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  802aa0:	77 df                	ja     802a81 <readline+0xaf>
+                if (echo) {
+  802aa2:	45 85 f6             	test   %r14d,%r14d
+  802aa5:	75 2f                	jne    802ad6 <readline+0x104>
+                buf[i++] = (char)c;
+  802aa7:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802aae:	00 00 00 
+  802ab1:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  802ab5:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  802aba:	eb c5                	jmp    802a81 <readline+0xaf>
+                    cputchar('\b');
+  802abc:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ac1:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  802ac4:	bf 20 00 00 00       	mov    $0x20,%edi
+  802ac9:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  802acc:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ad1:	41 ff d7             	call   *%r15
+  802ad4:	eb a7                	jmp    802a7d <readline+0xab>
+                    cputchar(c);
+  802ad6:	89 c7                	mov    %eax,%edi
+  802ad8:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+  802ae4:	eb c1                	jmp    802aa7 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  802ae6:	83 f8 0a             	cmp    $0xa,%eax
+  802ae9:	74 05                	je     802af0 <readline+0x11e>
+  802aeb:	83 f8 0d             	cmp    $0xd,%eax
+  802aee:	75 91                	jne    802a81 <readline+0xaf>
+            if (echo) {
+  802af0:	45 85 f6             	test   %r14d,%r14d
+  802af3:	75 14                	jne    802b09 <readline+0x137>
+            buf[i] = 0;
+  802af5:	48 b8 40 80 80 01 00 	movabs $0x1808040,%rax
+  802afc:	00 00 00 
+  802aff:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  802b04:	e9 3c ff ff ff       	jmp    802a45 <readline+0x73>
+                cputchar('\n');
+  802b09:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802b0e:	48 b8 09 18 80 00 00 	movabs $0x801809,%rax
+  802b15:	00 00 00 
+  802b18:	ff d0                	call   *%rax
+  802b1a:	eb d9                	jmp    802af5 <readline+0x123>
+
+0000000000802b1c <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802b1c:	55                   	push   %rbp
+  802b1d:	48 89 e5             	mov    %rsp,%rbp
+  802b20:	53                   	push   %rbx
+  802b21:	48 89 fa             	mov    %rdi,%rdx
+  802b24:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b31:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b36:	be 00 00 00 00       	mov    $0x0,%esi
+  802b3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b47:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802b49:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b4d:	c9                   	leave
+  802b4e:	c3                   	ret
+
+0000000000802b4f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802b4f:	55                   	push   %rbp
+  802b50:	48 89 e5             	mov    %rsp,%rbp
+  802b53:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802b54:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b7e:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b84:	c9                   	leave
+  802b85:	c3                   	ret
+
+0000000000802b86 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+  802b8a:	53                   	push   %rbx
+  802b8b:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b8e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b93:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ba2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bb3:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802bb5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+
+0000000000802bbb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802bbb:	55                   	push   %rbp
+  802bbc:	48 89 e5             	mov    %rsp,%rbp
+  802bbf:	53                   	push   %rbx
+  802bc0:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802bc4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bcc:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802be0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802be6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bee:	48 85 c0             	test   %rax,%rax
+  802bf1:	7f 06                	jg     802bf9 <sys_env_destroy+0x3e>
+}
+  802bf3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf7:	c9                   	leave
+  802bf8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bf9:	49 89 c0             	mov    %rax,%r8
+  802bfc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802c01:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802c08:	00 00 00 
+  802c0b:	be 27 00 00 00       	mov    $0x27,%esi
+  802c10:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802c17:	00 00 00 
+  802c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1f:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802c26:	00 00 00 
+  802c29:	41 ff d1             	call   *%r9
+
+0000000000802c2c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802c2c:	55                   	push   %rbp
+  802c2d:	48 89 e5             	mov    %rsp,%rbp
+  802c30:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802c31:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c45:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c5b:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c61:	c9                   	leave
+  802c62:	c3                   	ret
+
+0000000000802c63 <sys_yield>:
+
+void
+sys_yield(void) {
+  802c63:	55                   	push   %rbp
+  802c64:	48 89 e5             	mov    %rsp,%rbp
+  802c67:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802c68:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c7c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c81:	be 00 00 00 00       	mov    $0x0,%esi
+  802c86:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c8c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c92:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802c94:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+0000000000802c9a <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802c9a:	55                   	push   %rbp
+  802c9b:	48 89 e5             	mov    %rsp,%rbp
+  802c9e:	53                   	push   %rbx
+  802c9f:	48 89 fa             	mov    %rdi,%rdx
+  802ca2:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802caa:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802cb1:	00 00 00 
+  802cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cc4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cca:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ccc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+
+0000000000802cd2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	53                   	push   %rbx
+  802cd7:	49 89 f8             	mov    %rdi,%r8
+  802cda:	48 89 d3             	mov    %rdx,%rbx
+  802cdd:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802ce0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ce5:	4c 89 c2             	mov    %r8,%rdx
+  802ce8:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ceb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cf6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cfc:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802cfe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d02:	c9                   	leave
+  802d03:	c3                   	ret
+
+0000000000802d04 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802d04:	55                   	push   %rbp
+  802d05:	48 89 e5             	mov    %rsp,%rbp
+  802d08:	53                   	push   %rbx
+  802d09:	48 83 ec 08          	sub    $0x8,%rsp
+  802d0d:	89 f8                	mov    %edi,%eax
+  802d0f:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802d12:	48 63 f9             	movslq %ecx,%rdi
+  802d15:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d18:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d1d:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d20:	be 00 00 00 00       	mov    $0x0,%esi
+  802d25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d31:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d33:	48 85 c0             	test   %rax,%rax
+  802d36:	7f 06                	jg     802d3e <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802d38:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3c:	c9                   	leave
+  802d3d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d3e:	49 89 c0             	mov    %rax,%r8
+  802d41:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802d46:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802d4d:	00 00 00 
+  802d50:	be 27 00 00 00       	mov    $0x27,%esi
+  802d55:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802d5c:	00 00 00 
+  802d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d64:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802d6b:	00 00 00 
+  802d6e:	41 ff d1             	call   *%r9
+
+0000000000802d71 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802d71:	55                   	push   %rbp
+  802d72:	48 89 e5             	mov    %rsp,%rbp
+  802d75:	53                   	push   %rbx
+  802d76:	48 83 ec 08          	sub    $0x8,%rsp
+  802d7a:	89 f8                	mov    %edi,%eax
+  802d7c:	49 89 f2             	mov    %rsi,%r10
+  802d7f:	48 89 cf             	mov    %rcx,%rdi
+  802d82:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802d85:	48 63 da             	movslq %edx,%rbx
+  802d88:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d8b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d90:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d93:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802d96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	7f 06                	jg     802da9 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802da3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802da9:	49 89 c0             	mov    %rax,%r8
+  802dac:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802db1:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802db8:	00 00 00 
+  802dbb:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc0:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802dc7:	00 00 00 
+  802dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dcf:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802dd6:	00 00 00 
+  802dd9:	41 ff d1             	call   *%r9
+
+0000000000802ddc <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802ddc:	55                   	push   %rbp
+  802ddd:	48 89 e5             	mov    %rsp,%rbp
+  802de0:	53                   	push   %rbx
+  802de1:	48 83 ec 08          	sub    $0x8,%rsp
+  802de5:	48 89 f1             	mov    %rsi,%rcx
+  802de8:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802deb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dee:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802df8:	be 00 00 00 00       	mov    $0x0,%esi
+  802dfd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e03:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e09:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e0b:	48 85 c0             	test   %rax,%rax
+  802e0e:	7f 06                	jg     802e16 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802e10:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e14:	c9                   	leave
+  802e15:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e16:	49 89 c0             	mov    %rax,%r8
+  802e19:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e1e:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802e25:	00 00 00 
+  802e28:	be 27 00 00 00       	mov    $0x27,%esi
+  802e2d:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802e34:	00 00 00 
+  802e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3c:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802e43:	00 00 00 
+  802e46:	41 ff d1             	call   *%r9
+
+0000000000802e49 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802e49:	55                   	push   %rbp
+  802e4a:	48 89 e5             	mov    %rsp,%rbp
+  802e4d:	53                   	push   %rbx
+  802e4e:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802e52:	48 63 ce             	movslq %esi,%rcx
+  802e55:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e58:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e67:	be 00 00 00 00       	mov    $0x0,%esi
+  802e6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e78:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e7a:	48 85 c0             	test   %rax,%rax
+  802e7d:	7f 06                	jg     802e85 <sys_env_set_status+0x3c>
+}
+  802e7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e85:	49 89 c0             	mov    %rax,%r8
+  802e88:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802e8d:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802e94:	00 00 00 
+  802e97:	be 27 00 00 00       	mov    $0x27,%esi
+  802e9c:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802ea3:	00 00 00 
+  802ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eab:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802eb2:	00 00 00 
+  802eb5:	41 ff d1             	call   *%r9
+
+0000000000802eb8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802eb8:	55                   	push   %rbp
+  802eb9:	48 89 e5             	mov    %rsp,%rbp
+  802ebc:	53                   	push   %rbx
+  802ebd:	48 83 ec 08          	sub    $0x8,%rsp
+  802ec1:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802ec4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ec7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ecc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  802edb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ee1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ee7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ee9:	48 85 c0             	test   %rax,%rax
+  802eec:	7f 06                	jg     802ef4 <sys_env_set_trapframe+0x3c>
+}
+  802eee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ef2:	c9                   	leave
+  802ef3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ef4:	49 89 c0             	mov    %rax,%r8
+  802ef7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802efc:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802f03:	00 00 00 
+  802f06:	be 27 00 00 00       	mov    $0x27,%esi
+  802f0b:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802f12:	00 00 00 
+  802f15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1a:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802f21:	00 00 00 
+  802f24:	41 ff d1             	call   *%r9
+
+0000000000802f27 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802f27:	55                   	push   %rbp
+  802f28:	48 89 e5             	mov    %rsp,%rbp
+  802f2b:	53                   	push   %rbx
+  802f2c:	48 83 ec 08          	sub    $0x8,%rsp
+  802f30:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802f33:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f36:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f45:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f56:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f58:	48 85 c0             	test   %rax,%rax
+  802f5b:	7f 06                	jg     802f63 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802f5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f61:	c9                   	leave
+  802f62:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f63:	49 89 c0             	mov    %rax,%r8
+  802f66:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802f6b:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802f72:	00 00 00 
+  802f75:	be 27 00 00 00       	mov    $0x27,%esi
+  802f7a:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802f81:	00 00 00 
+  802f84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f89:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  802f90:	00 00 00 
+  802f93:	41 ff d1             	call   *%r9
+
+0000000000802f96 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802f96:	55                   	push   %rbp
+  802f97:	48 89 e5             	mov    %rsp,%rbp
+  802f9a:	53                   	push   %rbx
+  802f9b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802f9f:	40 0f b6 ce          	movzbl %sil,%ecx
+  802fa3:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fa6:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fb5:	be 00 00 00 00       	mov    $0x0,%esi
+  802fba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fc0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fc6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fc8:	48 85 c0             	test   %rax,%rax
+  802fcb:	7f 06                	jg     802fd3 <sys_env_set_reclaim+0x3d>
+}
+  802fcd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fd1:	c9                   	leave
+  802fd2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fd3:	49 89 c0             	mov    %rax,%r8
+  802fd6:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802fdb:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  802fe2:	00 00 00 
+  802fe5:	be 27 00 00 00       	mov    $0x27,%esi
+  802fea:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  802ff1:	00 00 00 
+  802ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff9:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  803000:	00 00 00 
+  803003:	41 ff d1             	call   *%r9
+
+0000000000803006 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803006:	55                   	push   %rbp
+  803007:	48 89 e5             	mov    %rsp,%rbp
+  80300a:	53                   	push   %rbx
+  80300b:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  80300f:	48 63 ce             	movslq %esi,%rcx
+  803012:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803015:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80301a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80301f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803024:	be 00 00 00 00       	mov    $0x0,%esi
+  803029:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80302f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803035:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803037:	48 85 c0             	test   %rax,%rax
+  80303a:	7f 06                	jg     803042 <sys_env_set_nice+0x3c>
+}
+  80303c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803040:	c9                   	leave
+  803041:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803042:	49 89 c0             	mov    %rax,%r8
+  803045:	b9 18 00 00 00       	mov    $0x18,%ecx
+  80304a:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  803051:	00 00 00 
+  803054:	be 27 00 00 00       	mov    $0x27,%esi
+  803059:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  803060:	00 00 00 
+  803063:	b8 00 00 00 00       	mov    $0x0,%eax
+  803068:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  80306f:	00 00 00 
+  803072:	41 ff d1             	call   *%r9
+
+0000000000803075 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  803075:	55                   	push   %rbp
+  803076:	48 89 e5             	mov    %rsp,%rbp
+  803079:	53                   	push   %rbx
+  80307a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80307d:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803082:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803091:	be 00 00 00 00       	mov    $0x0,%esi
+  803096:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80309c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030a2:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  8030a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a8:	c9                   	leave
+  8030a9:	c3                   	ret
+
+00000000008030aa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	53                   	push   %rbx
+  8030af:	89 f8                	mov    %edi,%eax
+  8030b1:	49 89 f1             	mov    %rsi,%r9
+  8030b4:	48 89 d3             	mov    %rdx,%rbx
+  8030b7:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8030ba:	49 63 f0             	movslq %r8d,%rsi
+  8030bd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030c5:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030d4:	cd 30                	int    $0x30
+}
+  8030d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030da:	c9                   	leave
+  8030db:	c3                   	ret
+
+00000000008030dc <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8030dc:	55                   	push   %rbp
+  8030dd:	48 89 e5             	mov    %rsp,%rbp
+  8030e0:	53                   	push   %rbx
+  8030e1:	89 f8                	mov    %edi,%eax
+  8030e3:	49 89 f1             	mov    %rsi,%r9
+  8030e6:	48 89 d3             	mov    %rdx,%rbx
+  8030e9:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8030ec:	49 63 f0             	movslq %r8d,%rsi
+  8030ef:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030f7:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803100:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803106:	cd 30                	int    $0x30
+}
+  803108:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80310c:	c9                   	leave
+  80310d:	c3                   	ret
+
+000000000080310e <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80310e:	55                   	push   %rbp
+  80310f:	48 89 e5             	mov    %rsp,%rbp
+  803112:	53                   	push   %rbx
+  803113:	48 83 ec 08          	sub    $0x8,%rsp
+  803117:	89 f8                	mov    %edi,%eax
+  803119:	49 89 f2             	mov    %rsi,%r10
+  80311c:	48 89 d3             	mov    %rdx,%rbx
+  80311f:	48 89 cf             	mov    %rcx,%rdi
+  803122:	44 89 c6             	mov    %r8d,%esi
+  803125:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803128:	48 63 f6             	movslq %esi,%rsi
+  80312b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80312e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803133:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803136:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  80313a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80313c:	48 85 c0             	test   %rax,%rax
+  80313f:	7f 06                	jg     803147 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803141:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803145:	c9                   	leave
+  803146:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803147:	49 89 c0             	mov    %rax,%r8
+  80314a:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  80314f:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  803156:	00 00 00 
+  803159:	be 27 00 00 00       	mov    $0x27,%esi
+  80315e:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  803165:	00 00 00 
+  803168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316d:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  803174:	00 00 00 
+  803177:	41 ff d1             	call   *%r9
+
+000000000080317a <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  80317a:	55                   	push   %rbp
+  80317b:	48 89 e5             	mov    %rsp,%rbp
+  80317e:	53                   	push   %rbx
+  80317f:	48 83 ec 08          	sub    $0x8,%rsp
+  803183:	48 89 f1             	mov    %rsi,%rcx
+  803186:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  803189:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  80318d:	48 8b 1a             	mov    (%rdx),%rbx
+  803190:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803193:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803198:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80319c:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  8031a0:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  8031a4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8031a6:	48 85 c0             	test   %rax,%rax
+  8031a9:	7f 06                	jg     8031b1 <sys_ipc_call_short+0x37>
+}
+  8031ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031af:	c9                   	leave
+  8031b0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8031b1:	49 89 c0             	mov    %rax,%r8
+  8031b4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8031b9:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  8031c0:	00 00 00 
+  8031c3:	be 27 00 00 00       	mov    $0x27,%esi
+  8031c8:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  8031cf:	00 00 00 
+  8031d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d7:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  8031de:	00 00 00 
+  8031e1:	41 ff d1             	call   *%r9
+
+00000000008031e4 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  8031e4:	55                   	push   %rbp
+  8031e5:	48 89 e5             	mov    %rsp,%rbp
+  8031e8:	53                   	push   %rbx
+  8031e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ed:	89 f8                	mov    %edi,%eax
+  8031ef:	49 89 f2             	mov    %rsi,%r10
+  8031f2:	48 89 d3             	mov    %rdx,%rbx
+  8031f5:	48 89 cf             	mov    %rcx,%rdi
+  8031f8:	44 89 c6             	mov    %r8d,%esi
+  8031fb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  8031fe:	48 63 f6             	movslq %esi,%rsi
+  803201:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803204:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803209:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  80320c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803210:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803212:	48 85 c0             	test   %rax,%rax
+  803215:	7f 06                	jg     80321d <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803217:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80321b:	c9                   	leave
+  80321c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80321d:	49 89 c0             	mov    %rax,%r8
+  803220:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803225:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  80322c:	00 00 00 
+  80322f:	be 27 00 00 00       	mov    $0x27,%esi
+  803234:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  80323b:	00 00 00 
+  80323e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803243:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  80324a:	00 00 00 
+  80324d:	41 ff d1             	call   *%r9
+
+0000000000803250 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803250:	55                   	push   %rbp
+  803251:	48 89 e5             	mov    %rsp,%rbp
+  803254:	53                   	push   %rbx
+  803255:	48 83 ec 08          	sub    $0x8,%rsp
+  803259:	48 89 fa             	mov    %rdi,%rdx
+  80325c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80325f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803264:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803269:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80326e:	be 00 00 00 00       	mov    $0x0,%esi
+  803273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803279:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80327f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803281:	48 85 c0             	test   %rax,%rax
+  803284:	7f 06                	jg     80328c <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803286:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80328a:	c9                   	leave
+  80328b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80328c:	49 89 c0             	mov    %rax,%r8
+  80328f:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803294:	48 ba 58 64 80 00 00 	movabs $0x806458,%rdx
+  80329b:	00 00 00 
+  80329e:	be 27 00 00 00       	mov    $0x27,%esi
+  8032a3:	48 bf 77 64 80 00 00 	movabs $0x806477,%rdi
+  8032aa:	00 00 00 
+  8032ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b2:	49 b9 ce 19 80 00 00 	movabs $0x8019ce,%r9
+  8032b9:	00 00 00 
+  8032bc:	41 ff d1             	call   *%r9
+
+00000000008032bf <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8032bf:	55                   	push   %rbp
+  8032c0:	48 89 e5             	mov    %rsp,%rbp
+  8032c3:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8032c4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032d8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032ee:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8032f0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+00000000008032f6 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	53                   	push   %rbx
+  8032fb:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032fe:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803303:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803308:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80330d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803312:	be 00 00 00 00       	mov    $0x0,%esi
+  803317:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80331d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803323:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803325:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803329:	c9                   	leave
+  80332a:	c3                   	ret
+
+000000000080332b <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  80332b:	55                   	push   %rbp
+  80332c:	48 89 e5             	mov    %rsp,%rbp
+  80332f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803330:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80333f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803344:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803349:	be 00 00 00 00       	mov    $0x0,%esi
+  80334e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803354:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80335a:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80335c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+0000000000803362 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803362:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803369:	ff ff ff 
+  80336c:	48 01 f8             	add    %rdi,%rax
+  80336f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803373:	c3                   	ret
+
+0000000000803374 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803374:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80337b:	ff ff ff 
+  80337e:	48 01 f8             	add    %rdi,%rax
+  803381:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803385:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80338b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80338f:	c3                   	ret
+
+0000000000803390 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803390:	55                   	push   %rbp
+  803391:	48 89 e5             	mov    %rsp,%rbp
+  803394:	41 57                	push   %r15
+  803396:	41 56                	push   %r14
+  803398:	41 55                	push   %r13
+  80339a:	41 54                	push   %r12
+  80339c:	53                   	push   %rbx
+  80339d:	48 83 ec 08          	sub    $0x8,%rsp
+  8033a1:	49 89 ff             	mov    %rdi,%r15
+  8033a4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8033a9:	49 bd 90 48 80 00 00 	movabs $0x804890,%r13
+  8033b0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8033b3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8033b9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8033bc:	48 89 df             	mov    %rbx,%rdi
+  8033bf:	41 ff d5             	call   *%r13
+  8033c2:	83 e0 04             	and    $0x4,%eax
+  8033c5:	74 17                	je     8033de <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8033c7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8033ce:	4c 39 f3             	cmp    %r14,%rbx
+  8033d1:	75 e6                	jne    8033b9 <fd_alloc+0x29>
+  8033d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8033d9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8033de:	4d 89 27             	mov    %r12,(%r15)
+}
+  8033e1:	48 83 c4 08          	add    $0x8,%rsp
+  8033e5:	5b                   	pop    %rbx
+  8033e6:	41 5c                	pop    %r12
+  8033e8:	41 5d                	pop    %r13
+  8033ea:	41 5e                	pop    %r14
+  8033ec:	41 5f                	pop    %r15
+  8033ee:	5d                   	pop    %rbp
+  8033ef:	c3                   	ret
+
+00000000008033f0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8033f0:	83 ff 1f             	cmp    $0x1f,%edi
+  8033f3:	77 39                	ja     80342e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033f5:	55                   	push   %rbp
+  8033f6:	48 89 e5             	mov    %rsp,%rbp
+  8033f9:	41 54                	push   %r12
+  8033fb:	53                   	push   %rbx
+  8033fc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8033ff:	48 63 df             	movslq %edi,%rbx
+  803402:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803409:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80340d:	48 89 df             	mov    %rbx,%rdi
+  803410:	48 b8 90 48 80 00 00 	movabs $0x804890,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+  80341c:	a8 04                	test   $0x4,%al
+  80341e:	74 14                	je     803434 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803420:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803424:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803429:	5b                   	pop    %rbx
+  80342a:	41 5c                	pop    %r12
+  80342c:	5d                   	pop    %rbp
+  80342d:	c3                   	ret
+        return -E_INVAL;
+  80342e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803433:	c3                   	ret
+        return -E_INVAL;
+  803434:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803439:	eb ee                	jmp    803429 <fd_lookup+0x39>
+
+000000000080343b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80343b:	55                   	push   %rbp
+  80343c:	48 89 e5             	mov    %rsp,%rbp
+  80343f:	41 54                	push   %r12
+  803441:	53                   	push   %rbx
+  803442:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803445:	48 b8 20 65 80 00 00 	movabs $0x806520,%rax
+  80344c:	00 00 00 
+  80344f:	48 bb 80 70 80 00 00 	movabs $0x807080,%rbx
+  803456:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803459:	39 3b                	cmp    %edi,(%rbx)
+  80345b:	74 47                	je     8034a4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80345d:	48 83 c0 08          	add    $0x8,%rax
+  803461:	48 8b 18             	mov    (%rax),%rbx
+  803464:	48 85 db             	test   %rbx,%rbx
+  803467:	75 f0                	jne    803459 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803469:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803470:	00 00 00 
+  803473:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803479:	89 fa                	mov    %edi,%edx
+  80347b:	48 bf 88 64 80 00 00 	movabs $0x806488,%rdi
+  803482:	00 00 00 
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348a:	48 b9 1e 1b 80 00 00 	movabs $0x801b1e,%rcx
+  803491:	00 00 00 
+  803494:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803496:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80349b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80349f:	5b                   	pop    %rbx
+  8034a0:	41 5c                	pop    %r12
+  8034a2:	5d                   	pop    %rbp
+  8034a3:	c3                   	ret
+            return 0;
+  8034a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a9:	eb f0                	jmp    80349b <dev_lookup+0x60>
+
+00000000008034ab <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8034ab:	55                   	push   %rbp
+  8034ac:	48 89 e5             	mov    %rsp,%rbp
+  8034af:	41 55                	push   %r13
+  8034b1:	41 54                	push   %r12
+  8034b3:	53                   	push   %rbx
+  8034b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8034b8:	48 89 fb             	mov    %rdi,%rbx
+  8034bb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8034be:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8034c5:	ff ff ff 
+  8034c8:	48 01 df             	add    %rbx,%rdi
+  8034cb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8034cf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034d3:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8034da:	00 00 00 
+  8034dd:	ff d0                	call   *%rax
+  8034df:	41 89 c5             	mov    %eax,%r13d
+  8034e2:	85 c0                	test   %eax,%eax
+  8034e4:	78 06                	js     8034ec <fd_close+0x41>
+  8034e6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8034ea:	74 1a                	je     803506 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8034ec:	45 84 e4             	test   %r12b,%r12b
+  8034ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8034f8:	44 89 e8             	mov    %r13d,%eax
+  8034fb:	48 83 c4 18          	add    $0x18,%rsp
+  8034ff:	5b                   	pop    %rbx
+  803500:	41 5c                	pop    %r12
+  803502:	41 5d                	pop    %r13
+  803504:	5d                   	pop    %rbp
+  803505:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803506:	8b 3b                	mov    (%rbx),%edi
+  803508:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80350c:	48 b8 3b 34 80 00 00 	movabs $0x80343b,%rax
+  803513:	00 00 00 
+  803516:	ff d0                	call   *%rax
+  803518:	41 89 c5             	mov    %eax,%r13d
+  80351b:	85 c0                	test   %eax,%eax
+  80351d:	78 1b                	js     80353a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80351f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803523:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803527:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80352d:	48 85 c0             	test   %rax,%rax
+  803530:	74 08                	je     80353a <fd_close+0x8f>
+  803532:	48 89 df             	mov    %rbx,%rdi
+  803535:	ff d0                	call   *%rax
+  803537:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80353a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80353f:	48 89 de             	mov    %rbx,%rsi
+  803542:	bf 00 00 00 00       	mov    $0x0,%edi
+  803547:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+    return res;
+  803553:	eb a3                	jmp    8034f8 <fd_close+0x4d>
+
+0000000000803555 <close>:
+
+int
+close(int fdnum) {
+  803555:	55                   	push   %rbp
+  803556:	48 89 e5             	mov    %rsp,%rbp
+  803559:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80355d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803561:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80356d:	85 c0                	test   %eax,%eax
+  80356f:	78 15                	js     803586 <close+0x31>
+
+    return fd_close(fd, 1);
+  803571:	be 01 00 00 00       	mov    $0x1,%esi
+  803576:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80357a:	48 b8 ab 34 80 00 00 	movabs $0x8034ab,%rax
+  803581:	00 00 00 
+  803584:	ff d0                	call   *%rax
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+0000000000803588 <close_all>:
+
+void
+close_all(void) {
+  803588:	55                   	push   %rbp
+  803589:	48 89 e5             	mov    %rsp,%rbp
+  80358c:	41 54                	push   %r12
+  80358e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80358f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803594:	49 bc 55 35 80 00 00 	movabs $0x803555,%r12
+  80359b:	00 00 00 
+  80359e:	89 df                	mov    %ebx,%edi
+  8035a0:	41 ff d4             	call   *%r12
+  8035a3:	83 c3 01             	add    $0x1,%ebx
+  8035a6:	83 fb 20             	cmp    $0x20,%ebx
+  8035a9:	75 f3                	jne    80359e <close_all+0x16>
+}
+  8035ab:	5b                   	pop    %rbx
+  8035ac:	41 5c                	pop    %r12
+  8035ae:	5d                   	pop    %rbp
+  8035af:	c3                   	ret
+
+00000000008035b0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8035b0:	55                   	push   %rbp
+  8035b1:	48 89 e5             	mov    %rsp,%rbp
+  8035b4:	41 57                	push   %r15
+  8035b6:	41 56                	push   %r14
+  8035b8:	41 55                	push   %r13
+  8035ba:	41 54                	push   %r12
+  8035bc:	53                   	push   %rbx
+  8035bd:	48 83 ec 18          	sub    $0x18,%rsp
+  8035c1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8035c4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8035c8:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8035cf:	00 00 00 
+  8035d2:	ff d0                	call   *%rax
+  8035d4:	89 c3                	mov    %eax,%ebx
+  8035d6:	85 c0                	test   %eax,%eax
+  8035d8:	0f 88 b8 00 00 00    	js     803696 <dup+0xe6>
+    close(newfdnum);
+  8035de:	44 89 e7             	mov    %r12d,%edi
+  8035e1:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  8035e8:	00 00 00 
+  8035eb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8035ed:	4d 63 ec             	movslq %r12d,%r13
+  8035f0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8035f7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8035fb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8035ff:	4c 89 ff             	mov    %r15,%rdi
+  803602:	49 be 74 33 80 00 00 	movabs $0x803374,%r14
+  803609:	00 00 00 
+  80360c:	41 ff d6             	call   *%r14
+  80360f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803612:	4c 89 ef             	mov    %r13,%rdi
+  803615:	41 ff d6             	call   *%r14
+  803618:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80361b:	48 89 df             	mov    %rbx,%rdi
+  80361e:	48 b8 90 48 80 00 00 	movabs $0x804890,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80362a:	a8 04                	test   $0x4,%al
+  80362c:	74 2b                	je     803659 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80362e:	41 89 c1             	mov    %eax,%r9d
+  803631:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803637:	4c 89 f1             	mov    %r14,%rcx
+  80363a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80363f:	48 89 de             	mov    %rbx,%rsi
+  803642:	bf 00 00 00 00       	mov    $0x0,%edi
+  803647:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  80364e:	00 00 00 
+  803651:	ff d0                	call   *%rax
+  803653:	89 c3                	mov    %eax,%ebx
+  803655:	85 c0                	test   %eax,%eax
+  803657:	78 4e                	js     8036a7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803659:	4c 89 ff             	mov    %r15,%rdi
+  80365c:	48 b8 90 48 80 00 00 	movabs $0x804890,%rax
+  803663:	00 00 00 
+  803666:	ff d0                	call   *%rax
+  803668:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80366b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803671:	4c 89 e9             	mov    %r13,%rcx
+  803674:	ba 00 00 00 00       	mov    $0x0,%edx
+  803679:	4c 89 fe             	mov    %r15,%rsi
+  80367c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803681:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  803688:	00 00 00 
+  80368b:	ff d0                	call   *%rax
+  80368d:	89 c3                	mov    %eax,%ebx
+  80368f:	85 c0                	test   %eax,%eax
+  803691:	78 14                	js     8036a7 <dup+0xf7>
+
+    return newfdnum;
+  803693:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803696:	89 d8                	mov    %ebx,%eax
+  803698:	48 83 c4 18          	add    $0x18,%rsp
+  80369c:	5b                   	pop    %rbx
+  80369d:	41 5c                	pop    %r12
+  80369f:	41 5d                	pop    %r13
+  8036a1:	41 5e                	pop    %r14
+  8036a3:	41 5f                	pop    %r15
+  8036a5:	5d                   	pop    %rbp
+  8036a6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8036a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036ac:	4c 89 ee             	mov    %r13,%rsi
+  8036af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b4:	49 bc dc 2d 80 00 00 	movabs $0x802ddc,%r12
+  8036bb:	00 00 00 
+  8036be:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8036c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036c6:	4c 89 f6             	mov    %r14,%rsi
+  8036c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ce:	41 ff d4             	call   *%r12
+    return res;
+  8036d1:	eb c3                	jmp    803696 <dup+0xe6>
+
+00000000008036d3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8036d3:	55                   	push   %rbp
+  8036d4:	48 89 e5             	mov    %rsp,%rbp
+  8036d7:	41 56                	push   %r14
+  8036d9:	41 55                	push   %r13
+  8036db:	41 54                	push   %r12
+  8036dd:	53                   	push   %rbx
+  8036de:	48 83 ec 10          	sub    $0x10,%rsp
+  8036e2:	89 fb                	mov    %edi,%ebx
+  8036e4:	49 89 f4             	mov    %rsi,%r12
+  8036e7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036ea:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036ee:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8036f5:	00 00 00 
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	85 c0                	test   %eax,%eax
+  8036fc:	78 4c                	js     80374a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036fe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803702:	41 8b 3e             	mov    (%r14),%edi
+  803705:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803709:	48 b8 3b 34 80 00 00 	movabs $0x80343b,%rax
+  803710:	00 00 00 
+  803713:	ff d0                	call   *%rax
+  803715:	85 c0                	test   %eax,%eax
+  803717:	78 35                	js     80374e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803719:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80371d:	83 e0 03             	and    $0x3,%eax
+  803720:	83 f8 01             	cmp    $0x1,%eax
+  803723:	74 2d                	je     803752 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803725:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803729:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80372d:	48 85 c0             	test   %rax,%rax
+  803730:	74 56                	je     803788 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803732:	4c 89 ea             	mov    %r13,%rdx
+  803735:	4c 89 e6             	mov    %r12,%rsi
+  803738:	4c 89 f7             	mov    %r14,%rdi
+  80373b:	ff d0                	call   *%rax
+}
+  80373d:	48 83 c4 10          	add    $0x10,%rsp
+  803741:	5b                   	pop    %rbx
+  803742:	41 5c                	pop    %r12
+  803744:	41 5d                	pop    %r13
+  803746:	41 5e                	pop    %r14
+  803748:	5d                   	pop    %rbp
+  803749:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80374a:	48 98                	cltq
+  80374c:	eb ef                	jmp    80373d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80374e:	48 98                	cltq
+  803750:	eb eb                	jmp    80373d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803752:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803759:	00 00 00 
+  80375c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803762:	89 da                	mov    %ebx,%edx
+  803764:	48 bf c9 64 80 00 00 	movabs $0x8064c9,%rdi
+  80376b:	00 00 00 
+  80376e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803773:	48 b9 1e 1b 80 00 00 	movabs $0x801b1e,%rcx
+  80377a:	00 00 00 
+  80377d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80377f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803786:	eb b5                	jmp    80373d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803788:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80378f:	eb ac                	jmp    80373d <read+0x6a>
+
+0000000000803791 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803791:	55                   	push   %rbp
+  803792:	48 89 e5             	mov    %rsp,%rbp
+  803795:	41 57                	push   %r15
+  803797:	41 56                	push   %r14
+  803799:	41 55                	push   %r13
+  80379b:	41 54                	push   %r12
+  80379d:	53                   	push   %rbx
+  80379e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8037a2:	48 85 d2             	test   %rdx,%rdx
+  8037a5:	74 54                	je     8037fb <readn+0x6a>
+  8037a7:	41 89 fd             	mov    %edi,%r13d
+  8037aa:	49 89 f6             	mov    %rsi,%r14
+  8037ad:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8037b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8037b5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8037ba:	49 bf d3 36 80 00 00 	movabs $0x8036d3,%r15
+  8037c1:	00 00 00 
+  8037c4:	4c 89 e2             	mov    %r12,%rdx
+  8037c7:	48 29 f2             	sub    %rsi,%rdx
+  8037ca:	4c 01 f6             	add    %r14,%rsi
+  8037cd:	44 89 ef             	mov    %r13d,%edi
+  8037d0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	78 20                	js     8037f7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8037d7:	01 c3                	add    %eax,%ebx
+  8037d9:	85 c0                	test   %eax,%eax
+  8037db:	74 08                	je     8037e5 <readn+0x54>
+  8037dd:	48 63 f3             	movslq %ebx,%rsi
+  8037e0:	4c 39 e6             	cmp    %r12,%rsi
+  8037e3:	72 df                	jb     8037c4 <readn+0x33>
+    }
+    return res;
+  8037e5:	48 63 c3             	movslq %ebx,%rax
+}
+  8037e8:	48 83 c4 08          	add    $0x8,%rsp
+  8037ec:	5b                   	pop    %rbx
+  8037ed:	41 5c                	pop    %r12
+  8037ef:	41 5d                	pop    %r13
+  8037f1:	41 5e                	pop    %r14
+  8037f3:	41 5f                	pop    %r15
+  8037f5:	5d                   	pop    %rbp
+  8037f6:	c3                   	ret
+        if (inc < 0) return inc;
+  8037f7:	48 98                	cltq
+  8037f9:	eb ed                	jmp    8037e8 <readn+0x57>
+    int inc = 1, res = 0;
+  8037fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803800:	eb e3                	jmp    8037e5 <readn+0x54>
+
+0000000000803802 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803802:	55                   	push   %rbp
+  803803:	48 89 e5             	mov    %rsp,%rbp
+  803806:	41 56                	push   %r14
+  803808:	41 55                	push   %r13
+  80380a:	41 54                	push   %r12
+  80380c:	53                   	push   %rbx
+  80380d:	48 83 ec 10          	sub    $0x10,%rsp
+  803811:	89 fb                	mov    %edi,%ebx
+  803813:	49 89 f4             	mov    %rsi,%r12
+  803816:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803819:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80381d:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  803824:	00 00 00 
+  803827:	ff d0                	call   *%rax
+  803829:	85 c0                	test   %eax,%eax
+  80382b:	78 47                	js     803874 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80382d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803831:	41 8b 3e             	mov    (%r14),%edi
+  803834:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803838:	48 b8 3b 34 80 00 00 	movabs $0x80343b,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+  803844:	85 c0                	test   %eax,%eax
+  803846:	78 30                	js     803878 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803848:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80384d:	74 2d                	je     80387c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80384f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803853:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803857:	48 85 c0             	test   %rax,%rax
+  80385a:	74 56                	je     8038b2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80385c:	4c 89 ea             	mov    %r13,%rdx
+  80385f:	4c 89 e6             	mov    %r12,%rsi
+  803862:	4c 89 f7             	mov    %r14,%rdi
+  803865:	ff d0                	call   *%rax
+}
+  803867:	48 83 c4 10          	add    $0x10,%rsp
+  80386b:	5b                   	pop    %rbx
+  80386c:	41 5c                	pop    %r12
+  80386e:	41 5d                	pop    %r13
+  803870:	41 5e                	pop    %r14
+  803872:	5d                   	pop    %rbp
+  803873:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803874:	48 98                	cltq
+  803876:	eb ef                	jmp    803867 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803878:	48 98                	cltq
+  80387a:	eb eb                	jmp    803867 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80387c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803883:	00 00 00 
+  803886:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80388c:	89 da                	mov    %ebx,%edx
+  80388e:	48 bf e5 64 80 00 00 	movabs $0x8064e5,%rdi
+  803895:	00 00 00 
+  803898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80389d:	48 b9 1e 1b 80 00 00 	movabs $0x801b1e,%rcx
+  8038a4:	00 00 00 
+  8038a7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038a9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8038b0:	eb b5                	jmp    803867 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8038b2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8038b9:	eb ac                	jmp    803867 <write+0x65>
+
+00000000008038bb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8038bb:	55                   	push   %rbp
+  8038bc:	48 89 e5             	mov    %rsp,%rbp
+  8038bf:	53                   	push   %rbx
+  8038c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8038c4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038c6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8038ca:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8038d1:	00 00 00 
+  8038d4:	ff d0                	call   *%rax
+  8038d6:	85 c0                	test   %eax,%eax
+  8038d8:	78 0c                	js     8038e6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8038da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038de:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8038e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038ea:	c9                   	leave
+  8038eb:	c3                   	ret
+
+00000000008038ec <tell>:
+
+int tell(int fdnum) {
+  8038ec:	55                   	push   %rbp
+  8038ed:	48 89 e5             	mov    %rsp,%rbp
+  8038f0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038f4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038f8:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8038ff:	00 00 00 
+  803902:	ff d0                	call   *%rax
+  803904:	85 c0                	test   %eax,%eax
+  803906:	78 07                	js     80390f <tell+0x23>
+
+    return fd->fd_offset;
+  803908:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80390c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80390f:	c9                   	leave
+  803910:	c3                   	ret
+
+0000000000803911 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803911:	55                   	push   %rbp
+  803912:	48 89 e5             	mov    %rsp,%rbp
+  803915:	41 55                	push   %r13
+  803917:	41 54                	push   %r12
+  803919:	53                   	push   %rbx
+  80391a:	48 83 ec 18          	sub    $0x18,%rsp
+  80391e:	89 fb                	mov    %edi,%ebx
+  803920:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803923:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803927:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  80392e:	00 00 00 
+  803931:	ff d0                	call   *%rax
+  803933:	85 c0                	test   %eax,%eax
+  803935:	78 38                	js     80396f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803937:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80393b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80393f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803943:	48 b8 3b 34 80 00 00 	movabs $0x80343b,%rax
+  80394a:	00 00 00 
+  80394d:	ff d0                	call   *%rax
+  80394f:	85 c0                	test   %eax,%eax
+  803951:	78 1c                	js     80396f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803953:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803958:	74 20                	je     80397a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80395a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80395e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803962:	48 85 c0             	test   %rax,%rax
+  803965:	74 47                	je     8039ae <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803967:	44 89 e6             	mov    %r12d,%esi
+  80396a:	4c 89 ef             	mov    %r13,%rdi
+  80396d:	ff d0                	call   *%rax
+}
+  80396f:	48 83 c4 18          	add    $0x18,%rsp
+  803973:	5b                   	pop    %rbx
+  803974:	41 5c                	pop    %r12
+  803976:	41 5d                	pop    %r13
+  803978:	5d                   	pop    %rbp
+  803979:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80397a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803981:	00 00 00 
+  803984:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80398a:	89 da                	mov    %ebx,%edx
+  80398c:	48 bf a8 64 80 00 00 	movabs $0x8064a8,%rdi
+  803993:	00 00 00 
+  803996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80399b:	48 b9 1e 1b 80 00 00 	movabs $0x801b1e,%rcx
+  8039a2:	00 00 00 
+  8039a5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8039a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8039ac:	eb c1                	jmp    80396f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8039ae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8039b3:	eb ba                	jmp    80396f <ftruncate+0x5e>
+
+00000000008039b5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8039b5:	55                   	push   %rbp
+  8039b6:	48 89 e5             	mov    %rsp,%rbp
+  8039b9:	41 54                	push   %r12
+  8039bb:	53                   	push   %rbx
+  8039bc:	48 83 ec 10          	sub    $0x10,%rsp
+  8039c0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8039c7:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8039ce:	00 00 00 
+  8039d1:	ff d0                	call   *%rax
+  8039d3:	85 c0                	test   %eax,%eax
+  8039d5:	78 63                	js     803a3a <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8039d7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8039db:	41 8b 3c 24          	mov    (%r12),%edi
+  8039df:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8039e3:	48 b8 3b 34 80 00 00 	movabs $0x80343b,%rax
+  8039ea:	00 00 00 
+  8039ed:	ff d0                	call   *%rax
+  8039ef:	85 c0                	test   %eax,%eax
+  8039f1:	78 47                	js     803a3a <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8039f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8039fc:	74 45                	je     803a43 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8039fe:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803a01:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803a08:	00 00 00 
+    stat->st_isdir = 0;
+  803a0b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a12:	00 00 00 
+    stat->st_ino = 0;
+  803a15:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803a1c:	00 00 00 00 
+    stat->st_version = 0;
+  803a20:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803a27:	00 00 00 
+    stat->st_dev = dev;
+  803a2a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803a31:	48 89 de             	mov    %rbx,%rsi
+  803a34:	4c 89 e7             	mov    %r12,%rdi
+  803a37:	ff 50 28             	call   *0x28(%rax)
+}
+  803a3a:	48 83 c4 10          	add    $0x10,%rsp
+  803a3e:	5b                   	pop    %rbx
+  803a3f:	41 5c                	pop    %r12
+  803a41:	5d                   	pop    %rbp
+  803a42:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803a43:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a48:	eb f0                	jmp    803a3a <fstat+0x85>
+
+0000000000803a4a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a4a:	55                   	push   %rbp
+  803a4b:	48 89 e5             	mov    %rsp,%rbp
+  803a4e:	41 54                	push   %r12
+  803a50:	53                   	push   %rbx
+  803a51:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803a54:	be 00 00 00 00       	mov    $0x0,%esi
+  803a59:	48 b8 6b 3f 80 00 00 	movabs $0x803f6b,%rax
+  803a60:	00 00 00 
+  803a63:	ff d0                	call   *%rax
+  803a65:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803a67:	85 c0                	test   %eax,%eax
+  803a69:	78 25                	js     803a90 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803a6b:	4c 89 e6             	mov    %r12,%rsi
+  803a6e:	89 c7                	mov    %eax,%edi
+  803a70:	48 b8 b5 39 80 00 00 	movabs $0x8039b5,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+  803a7c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803a7f:	89 df                	mov    %ebx,%edi
+  803a81:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  803a88:	00 00 00 
+  803a8b:	ff d0                	call   *%rax
+
+    return res;
+  803a8d:	44 89 e3             	mov    %r12d,%ebx
+}
+  803a90:	89 d8                	mov    %ebx,%eax
+  803a92:	5b                   	pop    %rbx
+  803a93:	41 5c                	pop    %r12
+  803a95:	5d                   	pop    %rbp
+  803a96:	c3                   	ret
+
+0000000000803a97 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803a97:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803a9e:	00 00 00 
+  803aa1:	83 38 00             	cmpl   $0x0,(%rax)
+  803aa4:	74 0a                	je     803ab0 <fsipc_env+0x19>
+    return fsenv;
+}
+  803aa6:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803aad:	00 00 
+  803aaf:	c3                   	ret
+fsipc_env(void) {
+  803ab0:	55                   	push   %rbp
+  803ab1:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ab4:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ab9:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  803ac0:	00 00 00 
+  803ac3:	ff d0                	call   *%rax
+  803ac5:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803acc:	00 00 
+}
+  803ace:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803ad5:	00 00 
+  803ad7:	5d                   	pop    %rbp
+  803ad8:	c3                   	ret
+
+0000000000803ad9 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803ad9:	55                   	push   %rbp
+  803ada:	48 89 e5             	mov    %rsp,%rbp
+  803add:	53                   	push   %rbx
+  803ade:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803ae2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ae9:	00 
+  803aea:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803af1:	00 
+  803af2:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803af9:	00 
+  803afa:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803b01:	00 
+  803b02:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803b09:	00 
+
+    assert(size <= sizeof(words));
+  803b0a:	48 83 fa 28          	cmp    $0x28,%rdx
+  803b0e:	77 38                	ja     803b48 <fsipc_short+0x6f>
+  803b10:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803b12:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803b16:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  803b1d:	00 00 00 
+  803b20:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803b22:	48 b8 97 3a 80 00 00 	movabs $0x803a97,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	89 c7                	mov    %eax,%edi
+  803b30:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803b34:	89 de                	mov    %ebx,%esi
+  803b36:	48 b8 40 58 80 00 00 	movabs $0x805840,%rax
+  803b3d:	00 00 00 
+  803b40:	ff d0                	call   *%rax
+}
+  803b42:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803b46:	c9                   	leave
+  803b47:	c3                   	ret
+    assert(size <= sizeof(words));
+  803b48:	48 b9 40 65 80 00 00 	movabs $0x806540,%rcx
+  803b4f:	00 00 00 
+  803b52:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803b59:	00 00 00 
+  803b5c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803b61:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803b68:	00 00 00 
+  803b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b70:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803b77:	00 00 00 
+  803b7a:	41 ff d0             	call   *%r8
+
+0000000000803b7d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803b7d:	55                   	push   %rbp
+  803b7e:	48 89 e5             	mov    %rsp,%rbp
+  803b81:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803b85:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b88:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803b8b:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803b8e:	ba 08 00 00 00       	mov    $0x8,%edx
+  803b93:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b97:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b9c:	48 b8 d9 3a 80 00 00 	movabs $0x803ad9,%rax
+  803ba3:	00 00 00 
+  803ba6:	ff d0                	call   *%rax
+}
+  803ba8:	c9                   	leave
+  803ba9:	c3                   	ret
+
+0000000000803baa <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803baa:	55                   	push   %rbp
+  803bab:	48 89 e5             	mov    %rsp,%rbp
+  803bae:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803bb2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803bb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803bb8:	ba 04 00 00 00       	mov    $0x4,%edx
+  803bbd:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803bc1:	bf 06 00 00 00       	mov    $0x6,%edi
+  803bc6:	48 b8 d9 3a 80 00 00 	movabs $0x803ad9,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+}
+  803bd2:	c9                   	leave
+  803bd3:	c3                   	ret
+
+0000000000803bd4 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803bd4:	55                   	push   %rbp
+  803bd5:	48 89 e5             	mov    %rsp,%rbp
+  803bd8:	41 54                	push   %r12
+  803bda:	53                   	push   %rbx
+  803bdb:	48 83 ec 10          	sub    $0x10,%rsp
+  803bdf:	89 fb                	mov    %edi,%ebx
+  803be1:	49 89 f4             	mov    %rsi,%r12
+  803be4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803be8:	48 b8 97 3a 80 00 00 	movabs $0x803a97,%rax
+  803bef:	00 00 00 
+  803bf2:	ff d0                	call   *%rax
+  803bf4:	89 c7                	mov    %eax,%edi
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803bfc:	50                   	push   %rax
+  803bfd:	4d 89 e1             	mov    %r12,%r9
+  803c00:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803c06:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c0b:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803c12:	00 00 00 
+  803c15:	89 de                	mov    %ebx,%esi
+  803c17:	48 b8 db 57 80 00 00 	movabs $0x8057db,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+}
+  803c23:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803c27:	5b                   	pop    %rbx
+  803c28:	41 5c                	pop    %r12
+  803c2a:	5d                   	pop    %rbp
+  803c2b:	c3                   	ret
+
+0000000000803c2c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803c2c:	55                   	push   %rbp
+  803c2d:	48 89 e5             	mov    %rsp,%rbp
+  803c30:	41 54                	push   %r12
+  803c32:	53                   	push   %rbx
+  803c33:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803c36:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c39:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803c40:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c47:	be 00 00 00 00       	mov    $0x0,%esi
+  803c4c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803c51:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  803c58:	00 00 00 
+  803c5b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	78 5a                	js     803cbb <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803c61:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803c68:	00 00 00 
+  803c6b:	4c 89 e6             	mov    %r12,%rsi
+  803c6e:	48 89 df             	mov    %rbx,%rdi
+  803c71:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  803c78:	00 00 00 
+  803c7b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803c7d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803c84:	00 
+  803c85:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803c8b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803c92:	00 
+  803c93:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803c99:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803ca0:	00 
+  803ca1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803ca8:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803caf:	00 
+  803cb0:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cbb:	5b                   	pop    %rbx
+  803cbc:	41 5c                	pop    %r12
+  803cbe:	5d                   	pop    %rbp
+  803cbf:	c3                   	ret
+
+0000000000803cc0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803cc0:	55                   	push   %rbp
+  803cc1:	48 89 e5             	mov    %rsp,%rbp
+  803cc4:	41 57                	push   %r15
+  803cc6:	41 56                	push   %r14
+  803cc8:	41 55                	push   %r13
+  803cca:	41 54                	push   %r12
+  803ccc:	53                   	push   %rbx
+  803ccd:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803cd1:	48 85 ff             	test   %rdi,%rdi
+  803cd4:	0f 84 a1 00 00 00    	je     803d7b <devfile_read+0xbb>
+  803cda:	49 89 ff             	mov    %rdi,%r15
+  803cdd:	49 89 f5             	mov    %rsi,%r13
+  803ce0:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803ce3:	48 85 f6             	test   %rsi,%rsi
+  803ce6:	0f 84 c4 00 00 00    	je     803db0 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803cec:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803cf3:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803cf4:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803cfb:	00 00 00 
+  803cfe:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d02:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803d05:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d0e:	be 00 00 00 00       	mov    $0x0,%esi
+  803d13:	bf 03 00 00 00       	mov    $0x3,%edi
+  803d18:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  803d1f:	00 00 00 
+  803d22:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d24:	85 c0                	test   %eax,%eax
+  803d26:	0f 88 b9 00 00 00    	js     803de5 <devfile_read+0x125>
+        assert(res <= n);
+  803d2c:	48 63 d8             	movslq %eax,%rbx
+  803d2f:	49 39 dc             	cmp    %rbx,%r12
+  803d32:	0f 82 b1 00 00 00    	jb     803de9 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d38:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803d3d:	0f 87 db 00 00 00    	ja     803e1e <devfile_read+0x15e>
+        if (!res) {
+  803d43:	85 c0                	test   %eax,%eax
+  803d45:	74 21                	je     803d68 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803d47:	48 89 da             	mov    %rbx,%rdx
+  803d4a:	4c 89 f6             	mov    %r14,%rsi
+  803d4d:	4c 89 ef             	mov    %r13,%rdi
+  803d50:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+        total_read += res;
+  803d5c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803d60:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803d63:	49 29 dc             	sub    %rbx,%r12
+  803d66:	75 96                	jne    803cfe <devfile_read+0x3e>
+    return total_read;
+  803d68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803d6c:	48 83 c4 18          	add    $0x18,%rsp
+  803d70:	5b                   	pop    %rbx
+  803d71:	41 5c                	pop    %r12
+  803d73:	41 5d                	pop    %r13
+  803d75:	41 5e                	pop    %r14
+  803d77:	41 5f                	pop    %r15
+  803d79:	5d                   	pop    %rbp
+  803d7a:	c3                   	ret
+    assert(fd);
+  803d7b:	48 b9 76 65 80 00 00 	movabs $0x806576,%rcx
+  803d82:	00 00 00 
+  803d85:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803d8c:	00 00 00 
+  803d8f:	be 91 00 00 00       	mov    $0x91,%esi
+  803d94:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803d9b:	00 00 00 
+  803d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da3:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803daa:	00 00 00 
+  803dad:	41 ff d0             	call   *%r8
+    assert(buf);
+  803db0:	48 b9 79 65 80 00 00 	movabs $0x806579,%rcx
+  803db7:	00 00 00 
+  803dba:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803dc1:	00 00 00 
+  803dc4:	be 92 00 00 00       	mov    $0x92,%esi
+  803dc9:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803dd0:	00 00 00 
+  803dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd8:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803ddf:	00 00 00 
+  803de2:	41 ff d0             	call   *%r8
+            return res;
+  803de5:	48 98                	cltq
+  803de7:	eb 83                	jmp    803d6c <devfile_read+0xac>
+        assert(res <= n);
+  803de9:	48 b9 7d 65 80 00 00 	movabs $0x80657d,%rcx
+  803df0:	00 00 00 
+  803df3:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803dfa:	00 00 00 
+  803dfd:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803e02:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803e09:	00 00 00 
+  803e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e11:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803e18:	00 00 00 
+  803e1b:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e1e:	48 b9 88 65 80 00 00 	movabs $0x806588,%rcx
+  803e25:	00 00 00 
+  803e28:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803e2f:	00 00 00 
+  803e32:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803e37:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803e3e:	00 00 00 
+  803e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e46:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803e4d:	00 00 00 
+  803e50:	41 ff d0             	call   *%r8
+
+0000000000803e53 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803e53:	55                   	push   %rbp
+  803e54:	48 89 e5             	mov    %rsp,%rbp
+  803e57:	41 57                	push   %r15
+  803e59:	41 56                	push   %r14
+  803e5b:	41 55                	push   %r13
+  803e5d:	41 54                	push   %r12
+  803e5f:	53                   	push   %rbx
+  803e60:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803e64:	48 85 ff             	test   %rdi,%rdi
+  803e67:	0f 84 83 00 00 00    	je     803ef0 <devfile_write+0x9d>
+  803e6d:	49 89 ff             	mov    %rdi,%r15
+  803e70:	49 89 f4             	mov    %rsi,%r12
+  803e73:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803e76:	48 85 f6             	test   %rsi,%rsi
+  803e79:	0f 84 a6 00 00 00    	je     803f25 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803e7f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803e85:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803e8c:	00 00 00 
+  803e8f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803e93:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803e96:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803e9a:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803e9f:	48 39 d3             	cmp    %rdx,%rbx
+  803ea2:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803ea6:	4c 89 e6             	mov    %r12,%rsi
+  803ea9:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803eb0:	00 00 00 
+  803eb3:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  803eba:	00 00 00 
+  803ebd:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ebf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ec9:	bf 04 00 00 00       	mov    $0x4,%edi
+  803ece:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  803ed5:	00 00 00 
+  803ed8:	ff d0                	call   *%rax
+        if (res < 0) {
+  803eda:	85 c0                	test   %eax,%eax
+  803edc:	78 7c                	js     803f5a <devfile_write+0x107>
+        total_written += res;
+  803ede:	48 98                	cltq
+  803ee0:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803ee3:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803ee6:	48 29 c3             	sub    %rax,%rbx
+  803ee9:	75 a4                	jne    803e8f <devfile_write+0x3c>
+    return total_written;
+  803eeb:	4c 89 e8             	mov    %r13,%rax
+  803eee:	eb 6c                	jmp    803f5c <devfile_write+0x109>
+    assert(fd);
+  803ef0:	48 b9 76 65 80 00 00 	movabs $0x806576,%rcx
+  803ef7:	00 00 00 
+  803efa:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803f01:	00 00 00 
+  803f04:	be bd 00 00 00       	mov    $0xbd,%esi
+  803f09:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803f10:	00 00 00 
+  803f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f18:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803f1f:	00 00 00 
+  803f22:	41 ff d0             	call   *%r8
+    assert(buf);
+  803f25:	48 b9 79 65 80 00 00 	movabs $0x806579,%rcx
+  803f2c:	00 00 00 
+  803f2f:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  803f36:	00 00 00 
+  803f39:	be be 00 00 00       	mov    $0xbe,%esi
+  803f3e:	48 bf 6b 65 80 00 00 	movabs $0x80656b,%rdi
+  803f45:	00 00 00 
+  803f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4d:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  803f54:	00 00 00 
+  803f57:	41 ff d0             	call   *%r8
+            return res;
+  803f5a:	48 98                	cltq
+}
+  803f5c:	48 83 c4 08          	add    $0x8,%rsp
+  803f60:	5b                   	pop    %rbx
+  803f61:	41 5c                	pop    %r12
+  803f63:	41 5d                	pop    %r13
+  803f65:	41 5e                	pop    %r14
+  803f67:	41 5f                	pop    %r15
+  803f69:	5d                   	pop    %rbp
+  803f6a:	c3                   	ret
+
+0000000000803f6b <open>:
+open(const char *path, int mode) {
+  803f6b:	55                   	push   %rbp
+  803f6c:	48 89 e5             	mov    %rsp,%rbp
+  803f6f:	41 55                	push   %r13
+  803f71:	41 54                	push   %r12
+  803f73:	53                   	push   %rbx
+  803f74:	48 83 ec 18          	sub    $0x18,%rsp
+  803f78:	49 89 fc             	mov    %rdi,%r12
+  803f7b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f7e:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  803f85:	00 00 00 
+  803f88:	ff d0                	call   *%rax
+  803f8a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f90:	0f 87 8f 00 00 00    	ja     804025 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f9a:	48 b8 90 33 80 00 00 	movabs $0x803390,%rax
+  803fa1:	00 00 00 
+  803fa4:	ff d0                	call   *%rax
+  803fa6:	89 c3                	mov    %eax,%ebx
+  803fa8:	85 c0                	test   %eax,%eax
+  803faa:	78 55                	js     804001 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803fac:	4c 89 e6             	mov    %r12,%rsi
+  803faf:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803fb6:	00 00 00 
+  803fb9:	48 89 df             	mov    %rbx,%rdi
+  803fbc:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  803fc3:	00 00 00 
+  803fc6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803fc8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803fcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fd4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fd8:	bf 01 00 00 00       	mov    $0x1,%edi
+  803fdd:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803feb:	85 c0                	test   %eax,%eax
+  803fed:	78 1f                	js     80400e <open+0xa3>
+    return fd2num(fd);
+  803fef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ff3:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  803ffa:	00 00 00 
+  803ffd:	ff d0                	call   *%rax
+  803fff:	89 c3                	mov    %eax,%ebx
+}
+  804001:	89 d8                	mov    %ebx,%eax
+  804003:	48 83 c4 18          	add    $0x18,%rsp
+  804007:	5b                   	pop    %rbx
+  804008:	41 5c                	pop    %r12
+  80400a:	41 5d                	pop    %r13
+  80400c:	5d                   	pop    %rbp
+  80400d:	c3                   	ret
+        fd_close(fd, 0);
+  80400e:	be 00 00 00 00       	mov    $0x0,%esi
+  804013:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804017:	48 b8 ab 34 80 00 00 	movabs $0x8034ab,%rax
+  80401e:	00 00 00 
+  804021:	ff d0                	call   *%rax
+        return res;
+  804023:	eb dc                	jmp    804001 <open+0x96>
+        return -E_BAD_PATH;
+  804025:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80402a:	eb d5                	jmp    804001 <open+0x96>
+
+000000000080402c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80402c:	55                   	push   %rbp
+  80402d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804030:	ba 00 00 00 00       	mov    $0x0,%edx
+  804035:	be 00 00 00 00       	mov    $0x0,%esi
+  80403a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80403f:	48 b8 d9 3a 80 00 00 	movabs $0x803ad9,%rax
+  804046:	00 00 00 
+  804049:	ff d0                	call   *%rax
+}
+  80404b:	5d                   	pop    %rbp
+  80404c:	c3                   	ret
+
+000000000080404d <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  80404d:	55                   	push   %rbp
+  80404e:	48 89 e5             	mov    %rsp,%rbp
+  804051:	41 56                	push   %r14
+  804053:	41 55                	push   %r13
+  804055:	41 54                	push   %r12
+  804057:	53                   	push   %rbx
+  804058:	48 83 ec 10          	sub    $0x10,%rsp
+  80405c:	41 89 f6             	mov    %esi,%r14d
+  80405f:	49 89 d4             	mov    %rdx,%r12
+  804062:	48 89 cb             	mov    %rcx,%rbx
+  804065:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804068:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80406c:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  804073:	00 00 00 
+  804076:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804078:	85 c0                	test   %eax,%eax
+  80407a:	78 46                	js     8040c2 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80407c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804080:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804087:	00 00 00 
+  80408a:	8b 00                	mov    (%rax),%eax
+  80408c:	39 02                	cmp    %eax,(%rdx)
+  80408e:	75 3f                	jne    8040cf <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  804090:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  804097:	00 00 00 
+  80409a:	8b 52 0c             	mov    0xc(%rdx),%edx
+  80409d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  80409f:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  8040a3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  8040a7:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  8040ab:	48 89 da             	mov    %rbx,%rdx
+  8040ae:	4c 89 e6             	mov    %r12,%rsi
+  8040b1:	bf 09 00 00 00       	mov    $0x9,%edi
+  8040b6:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  8040bd:	00 00 00 
+  8040c0:	ff d0                	call   *%rax
+}
+  8040c2:	48 83 c4 10          	add    $0x10,%rsp
+  8040c6:	5b                   	pop    %rbx
+  8040c7:	41 5c                	pop    %r12
+  8040c9:	41 5d                	pop    %r13
+  8040cb:	41 5e                	pop    %r14
+  8040cd:	5d                   	pop    %rbp
+  8040ce:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040cf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8040d4:	eb ec                	jmp    8040c2 <file_map+0x75>
+
+00000000008040d6 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  8040d6:	55                   	push   %rbp
+  8040d7:	48 89 e5             	mov    %rsp,%rbp
+  8040da:	41 54                	push   %r12
+  8040dc:	53                   	push   %rbx
+  8040dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8040e1:	41 89 f4             	mov    %esi,%r12d
+  8040e4:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8040e7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8040eb:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040f7:	85 c0                	test   %eax,%eax
+  8040f9:	78 3c                	js     804137 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8040fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ff:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804106:	00 00 00 
+  804109:	8b 0a                	mov    (%rdx),%ecx
+  80410b:	39 08                	cmp    %ecx,(%rax)
+  80410d:	75 31                	jne    804140 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  80410f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804112:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804115:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804119:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  80411d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804122:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804126:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80412b:	48 b8 d9 3a 80 00 00 	movabs $0x803ad9,%rax
+  804132:	00 00 00 
+  804135:	ff d0                	call   *%rax
+}
+  804137:	48 83 c4 20          	add    $0x20,%rsp
+  80413b:	5b                   	pop    %rbx
+  80413c:	41 5c                	pop    %r12
+  80413e:	5d                   	pop    %rbp
+  80413f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804140:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804145:	eb f0                	jmp    804137 <file_msync+0x61>
+
+0000000000804147 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804147:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80414b:	7f 01                	jg     80414e <writebuf+0x7>
+  80414d:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80414e:	55                   	push   %rbp
+  80414f:	48 89 e5             	mov    %rsp,%rbp
+  804152:	53                   	push   %rbx
+  804153:	48 83 ec 08          	sub    $0x8,%rsp
+  804157:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80415a:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80415e:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804162:	8b 3f                	mov    (%rdi),%edi
+  804164:	48 b8 02 38 80 00 00 	movabs $0x803802,%rax
+  80416b:	00 00 00 
+  80416e:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804170:	48 85 c0             	test   %rax,%rax
+  804173:	7e 04                	jle    804179 <writebuf+0x32>
+  804175:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804179:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80417d:	48 39 c2             	cmp    %rax,%rdx
+  804180:	74 0f                	je     804191 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804182:	48 85 c0             	test   %rax,%rax
+  804185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80418a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80418e:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  804191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804195:	c9                   	leave
+  804196:	c3                   	ret
+
+0000000000804197 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804197:	8b 46 04             	mov    0x4(%rsi),%eax
+  80419a:	8d 50 01             	lea    0x1(%rax),%edx
+  80419d:	89 56 04             	mov    %edx,0x4(%rsi)
+  8041a0:	48 98                	cltq
+  8041a2:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8041a7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8041ad:	74 01                	je     8041b0 <putch+0x19>
+  8041af:	c3                   	ret
+putch(int ch, void *arg) {
+  8041b0:	55                   	push   %rbp
+  8041b1:	48 89 e5             	mov    %rsp,%rbp
+  8041b4:	53                   	push   %rbx
+  8041b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8041b9:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8041bc:	48 89 f7             	mov    %rsi,%rdi
+  8041bf:	48 b8 47 41 80 00 00 	movabs $0x804147,%rax
+  8041c6:	00 00 00 
+  8041c9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8041cb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8041d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041d6:	c9                   	leave
+  8041d7:	c3                   	ret
+
+00000000008041d8 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8041d8:	55                   	push   %rbp
+  8041d9:	48 89 e5             	mov    %rsp,%rbp
+  8041dc:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8041e3:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8041e6:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8041ec:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8041f3:	00 00 00 
+    state.result = 0;
+  8041f6:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8041fd:	00 00 00 00 
+    state.error = 1;
+  804201:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804208:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80420b:	48 89 f2             	mov    %rsi,%rdx
+  80420e:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804215:	48 bf 97 41 80 00 00 	movabs $0x804197,%rdi
+  80421c:	00 00 00 
+  80421f:	48 b8 6e 1c 80 00 00 	movabs $0x801c6e,%rax
+  804226:	00 00 00 
+  804229:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80422b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804232:	7f 14                	jg     804248 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804234:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80423b:	48 85 c0             	test   %rax,%rax
+  80423e:	75 06                	jne    804246 <vfprintf+0x6e>
+  804240:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804246:	c9                   	leave
+  804247:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804248:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80424f:	48 b8 47 41 80 00 00 	movabs $0x804147,%rax
+  804256:	00 00 00 
+  804259:	ff d0                	call   *%rax
+  80425b:	eb d7                	jmp    804234 <vfprintf+0x5c>
+
+000000000080425d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80425d:	55                   	push   %rbp
+  80425e:	48 89 e5             	mov    %rsp,%rbp
+  804261:	48 83 ec 50          	sub    $0x50,%rsp
+  804265:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804269:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80426d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804271:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804275:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80427c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804280:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804284:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804288:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80428c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804290:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  804297:	00 00 00 
+  80429a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80429c:	c9                   	leave
+  80429d:	c3                   	ret
+
+000000000080429e <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8042a6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8042aa:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8042ba:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8042c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8042d1:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8042d5:	48 89 fe             	mov    %rdi,%rsi
+  8042d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042dd:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  8042e4:	00 00 00 
+  8042e7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8042e9:	c9                   	leave
+  8042ea:	c3                   	ret
+
+00000000008042eb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8042eb:	55                   	push   %rbp
+  8042ec:	48 89 e5             	mov    %rsp,%rbp
+  8042ef:	41 54                	push   %r12
+  8042f1:	53                   	push   %rbx
+  8042f2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042f5:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+  804301:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804304:	48 be b0 65 80 00 00 	movabs $0x8065b0,%rsi
+  80430b:	00 00 00 
+  80430e:	48 89 df             	mov    %rbx,%rdi
+  804311:	48 b8 55 24 80 00 00 	movabs $0x802455,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80431d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804322:	41 2b 04 24          	sub    (%r12),%eax
+  804326:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80432c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804333:	00 00 00 
+    stat->st_dev = &devpipe;
+  804336:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  80433d:	00 00 00 
+  804340:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434c:	5b                   	pop    %rbx
+  80434d:	41 5c                	pop    %r12
+  80434f:	5d                   	pop    %rbp
+  804350:	c3                   	ret
+
+0000000000804351 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804351:	55                   	push   %rbp
+  804352:	48 89 e5             	mov    %rsp,%rbp
+  804355:	41 54                	push   %r12
+  804357:	53                   	push   %rbx
+  804358:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80435b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804360:	48 89 fe             	mov    %rdi,%rsi
+  804363:	bf 00 00 00 00       	mov    $0x0,%edi
+  804368:	49 bc dc 2d 80 00 00 	movabs $0x802ddc,%r12
+  80436f:	00 00 00 
+  804372:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804375:	48 89 df             	mov    %rbx,%rdi
+  804378:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  80437f:	00 00 00 
+  804382:	ff d0                	call   *%rax
+  804384:	48 89 c6             	mov    %rax,%rsi
+  804387:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80438c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804391:	41 ff d4             	call   *%r12
+}
+  804394:	5b                   	pop    %rbx
+  804395:	41 5c                	pop    %r12
+  804397:	5d                   	pop    %rbp
+  804398:	c3                   	ret
+
+0000000000804399 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804399:	55                   	push   %rbp
+  80439a:	48 89 e5             	mov    %rsp,%rbp
+  80439d:	41 57                	push   %r15
+  80439f:	41 56                	push   %r14
+  8043a1:	41 55                	push   %r13
+  8043a3:	41 54                	push   %r12
+  8043a5:	53                   	push   %rbx
+  8043a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8043aa:	49 89 fc             	mov    %rdi,%r12
+  8043ad:	49 89 f5             	mov    %rsi,%r13
+  8043b0:	49 89 d7             	mov    %rdx,%r15
+  8043b3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043b7:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  8043be:	00 00 00 
+  8043c1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8043c3:	4d 85 ff             	test   %r15,%r15
+  8043c6:	0f 84 af 00 00 00    	je     80447b <devpipe_write+0xe2>
+  8043cc:	48 89 c3             	mov    %rax,%rbx
+  8043cf:	4c 89 f8             	mov    %r15,%rax
+  8043d2:	4d 89 ef             	mov    %r13,%r15
+  8043d5:	4c 01 e8             	add    %r13,%rax
+  8043d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043dc:	49 bd d2 2c 80 00 00 	movabs $0x802cd2,%r13
+  8043e3:	00 00 00 
+            sys_yield();
+  8043e6:	49 be 63 2c 80 00 00 	movabs $0x802c63,%r14
+  8043ed:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043f0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043f3:	48 63 ce             	movslq %esi,%rcx
+  8043f6:	48 63 03             	movslq (%rbx),%rax
+  8043f9:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8043ff:	48 39 c1             	cmp    %rax,%rcx
+  804402:	72 2e                	jb     804432 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804404:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804409:	48 89 da             	mov    %rbx,%rdx
+  80440c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804411:	4c 89 e7             	mov    %r12,%rdi
+  804414:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804417:	85 c0                	test   %eax,%eax
+  804419:	74 66                	je     804481 <devpipe_write+0xe8>
+            sys_yield();
+  80441b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80441e:	8b 73 04             	mov    0x4(%rbx),%esi
+  804421:	48 63 ce             	movslq %esi,%rcx
+  804424:	48 63 03             	movslq (%rbx),%rax
+  804427:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80442d:	48 39 c1             	cmp    %rax,%rcx
+  804430:	73 d2                	jae    804404 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804432:	41 0f b6 3f          	movzbl (%r15),%edi
+  804436:	48 89 ca             	mov    %rcx,%rdx
+  804439:	48 c1 ea 03          	shr    $0x3,%rdx
+  80443d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804444:	08 10 20 
+  804447:	48 f7 e2             	mul    %rdx
+  80444a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80444e:	48 89 d0             	mov    %rdx,%rax
+  804451:	48 c1 e0 09          	shl    $0x9,%rax
+  804455:	48 29 d0             	sub    %rdx,%rax
+  804458:	48 c1 e0 03          	shl    $0x3,%rax
+  80445c:	48 29 c1             	sub    %rax,%rcx
+  80445f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804464:	83 c6 01             	add    $0x1,%esi
+  804467:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80446a:	49 83 c7 01          	add    $0x1,%r15
+  80446e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804472:	49 39 c7             	cmp    %rax,%r15
+  804475:	0f 85 75 ff ff ff    	jne    8043f0 <devpipe_write+0x57>
+    return n;
+  80447b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80447f:	eb 05                	jmp    804486 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804481:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804486:	48 83 c4 18          	add    $0x18,%rsp
+  80448a:	5b                   	pop    %rbx
+  80448b:	41 5c                	pop    %r12
+  80448d:	41 5d                	pop    %r13
+  80448f:	41 5e                	pop    %r14
+  804491:	41 5f                	pop    %r15
+  804493:	5d                   	pop    %rbp
+  804494:	c3                   	ret
+
+0000000000804495 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804495:	55                   	push   %rbp
+  804496:	48 89 e5             	mov    %rsp,%rbp
+  804499:	41 57                	push   %r15
+  80449b:	41 56                	push   %r14
+  80449d:	41 55                	push   %r13
+  80449f:	41 54                	push   %r12
+  8044a1:	53                   	push   %rbx
+  8044a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8044a6:	49 89 fc             	mov    %rdi,%r12
+  8044a9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044ad:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044b1:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  8044b8:	00 00 00 
+  8044bb:	ff d0                	call   *%rax
+  8044bd:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8044c0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044c6:	49 bd d2 2c 80 00 00 	movabs $0x802cd2,%r13
+  8044cd:	00 00 00 
+            sys_yield();
+  8044d0:	49 be 63 2c 80 00 00 	movabs $0x802c63,%r14
+  8044d7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8044da:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044df:	74 7d                	je     80455e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044e1:	8b 03                	mov    (%rbx),%eax
+  8044e3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8044e6:	75 26                	jne    80450e <devpipe_read+0x79>
+            if (i > 0) return i;
+  8044e8:	4d 85 ff             	test   %r15,%r15
+  8044eb:	75 77                	jne    804564 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044ed:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8044f2:	48 89 da             	mov    %rbx,%rdx
+  8044f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044fa:	4c 89 e7             	mov    %r12,%rdi
+  8044fd:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804500:	85 c0                	test   %eax,%eax
+  804502:	74 72                	je     804576 <devpipe_read+0xe1>
+            sys_yield();
+  804504:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804507:	8b 03                	mov    (%rbx),%eax
+  804509:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80450c:	74 df                	je     8044ed <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80450e:	48 63 c8             	movslq %eax,%rcx
+  804511:	48 89 ca             	mov    %rcx,%rdx
+  804514:	48 c1 ea 03          	shr    $0x3,%rdx
+  804518:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80451f:	08 10 20 
+  804522:	48 89 d0             	mov    %rdx,%rax
+  804525:	48 f7 e6             	mul    %rsi
+  804528:	48 c1 ea 06          	shr    $0x6,%rdx
+  80452c:	48 89 d0             	mov    %rdx,%rax
+  80452f:	48 c1 e0 09          	shl    $0x9,%rax
+  804533:	48 29 d0             	sub    %rdx,%rax
+  804536:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80453d:	00 
+  80453e:	48 89 c8             	mov    %rcx,%rax
+  804541:	48 29 d0             	sub    %rdx,%rax
+  804544:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804549:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80454d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804551:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804554:	49 83 c7 01          	add    $0x1,%r15
+  804558:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80455c:	75 83                	jne    8044e1 <devpipe_read+0x4c>
+    return n;
+  80455e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804562:	eb 03                	jmp    804567 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804564:	4c 89 f8             	mov    %r15,%rax
+}
+  804567:	48 83 c4 18          	add    $0x18,%rsp
+  80456b:	5b                   	pop    %rbx
+  80456c:	41 5c                	pop    %r12
+  80456e:	41 5d                	pop    %r13
+  804570:	41 5e                	pop    %r14
+  804572:	41 5f                	pop    %r15
+  804574:	5d                   	pop    %rbp
+  804575:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457b:	eb ea                	jmp    804567 <devpipe_read+0xd2>
+
+000000000080457d <pipe>:
+pipe(int pfd[2]) {
+  80457d:	55                   	push   %rbp
+  80457e:	48 89 e5             	mov    %rsp,%rbp
+  804581:	41 55                	push   %r13
+  804583:	41 54                	push   %r12
+  804585:	53                   	push   %rbx
+  804586:	48 83 ec 18          	sub    $0x18,%rsp
+  80458a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80458d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804591:	48 b8 90 33 80 00 00 	movabs $0x803390,%rax
+  804598:	00 00 00 
+  80459b:	ff d0                	call   *%rax
+  80459d:	89 c3                	mov    %eax,%ebx
+  80459f:	85 c0                	test   %eax,%eax
+  8045a1:	0f 88 a0 01 00 00    	js     804747 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8045a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045b1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ba:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  8045c1:	00 00 00 
+  8045c4:	ff d0                	call   *%rax
+  8045c6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045c8:	85 c0                	test   %eax,%eax
+  8045ca:	0f 88 77 01 00 00    	js     804747 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8045d0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8045d4:	48 b8 90 33 80 00 00 	movabs $0x803390,%rax
+  8045db:	00 00 00 
+  8045de:	ff d0                	call   *%rax
+  8045e0:	89 c3                	mov    %eax,%ebx
+  8045e2:	85 c0                	test   %eax,%eax
+  8045e4:	0f 88 43 01 00 00    	js     80472d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8045ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045f4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045fd:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  804604:	00 00 00 
+  804607:	ff d0                	call   *%rax
+  804609:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80460b:	85 c0                	test   %eax,%eax
+  80460d:	0f 88 1a 01 00 00    	js     80472d <pipe+0x1b0>
+    va = fd2data(fd0);
+  804613:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804617:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  80461e:	00 00 00 
+  804621:	ff d0                	call   *%rax
+  804623:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804626:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80462b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804630:	48 89 c6             	mov    %rax,%rsi
+  804633:	bf 00 00 00 00       	mov    $0x0,%edi
+  804638:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  80463f:	00 00 00 
+  804642:	ff d0                	call   *%rax
+  804644:	89 c3                	mov    %eax,%ebx
+  804646:	85 c0                	test   %eax,%eax
+  804648:	0f 88 c5 00 00 00    	js     804713 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80464e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804652:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  804659:	00 00 00 
+  80465c:	ff d0                	call   *%rax
+  80465e:	48 89 c1             	mov    %rax,%rcx
+  804661:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804667:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80466d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804672:	4c 89 ee             	mov    %r13,%rsi
+  804675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80467a:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  804681:	00 00 00 
+  804684:	ff d0                	call   *%rax
+  804686:	89 c3                	mov    %eax,%ebx
+  804688:	85 c0                	test   %eax,%eax
+  80468a:	78 6e                	js     8046fa <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80468c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804691:	4c 89 ef             	mov    %r13,%rdi
+  804694:	48 b8 9a 2c 80 00 00 	movabs $0x802c9a,%rax
+  80469b:	00 00 00 
+  80469e:	ff d0                	call   *%rax
+  8046a0:	83 f8 02             	cmp    $0x2,%eax
+  8046a3:	0f 85 ab 00 00 00    	jne    804754 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8046a9:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8046b0:	00 00 
+  8046b2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046b6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8046b8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8046bc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8046c3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8046c7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8046c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046cd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8046d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8046d8:	48 bb 62 33 80 00 00 	movabs $0x803362,%rbx
+  8046df:	00 00 00 
+  8046e2:	ff d3                	call   *%rbx
+  8046e4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8046e8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046ec:	ff d3                	call   *%rbx
+  8046ee:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8046f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046f8:	eb 4d                	jmp    804747 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8046fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046ff:	4c 89 ee             	mov    %r13,%rsi
+  804702:	bf 00 00 00 00       	mov    $0x0,%edi
+  804707:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  80470e:	00 00 00 
+  804711:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804713:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804718:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80471c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804721:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  804728:	00 00 00 
+  80472b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80472d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804732:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804736:	bf 00 00 00 00       	mov    $0x0,%edi
+  80473b:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  804742:	00 00 00 
+  804745:	ff d0                	call   *%rax
+}
+  804747:	89 d8                	mov    %ebx,%eax
+  804749:	48 83 c4 18          	add    $0x18,%rsp
+  80474d:	5b                   	pop    %rbx
+  80474e:	41 5c                	pop    %r12
+  804750:	41 5d                	pop    %r13
+  804752:	5d                   	pop    %rbp
+  804753:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804754:	48 b9 c8 65 80 00 00 	movabs $0x8065c8,%rcx
+  80475b:	00 00 00 
+  80475e:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  804765:	00 00 00 
+  804768:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80476d:	48 bf b7 65 80 00 00 	movabs $0x8065b7,%rdi
+  804774:	00 00 00 
+  804777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477c:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  804783:	00 00 00 
+  804786:	41 ff d0             	call   *%r8
+
+0000000000804789 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804789:	55                   	push   %rbp
+  80478a:	48 89 e5             	mov    %rsp,%rbp
+  80478d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804791:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804795:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  80479c:	00 00 00 
+  80479f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8047a1:	85 c0                	test   %eax,%eax
+  8047a3:	78 35                	js     8047da <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8047a5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047a9:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  8047b0:	00 00 00 
+  8047b3:	ff d0                	call   *%rax
+  8047b5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8047bd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047c2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047c6:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  8047cd:	00 00 00 
+  8047d0:	ff d0                	call   *%rax
+  8047d2:	85 c0                	test   %eax,%eax
+  8047d4:	0f 94 c0             	sete   %al
+  8047d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8047da:	c9                   	leave
+  8047db:	c3                   	ret
+
+00000000008047dc <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8047dc:	48 89 f8             	mov    %rdi,%rax
+  8047df:	48 c1 e8 27          	shr    $0x27,%rax
+  8047e3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8047ea:	01 00 00 
+  8047ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8047f1:	f6 c2 01             	test   $0x1,%dl
+  8047f4:	74 6d                	je     804863 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8047f6:	48 89 f8             	mov    %rdi,%rax
+  8047f9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047fd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804804:	01 00 00 
+  804807:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80480b:	f6 c2 01             	test   $0x1,%dl
+  80480e:	74 62                	je     804872 <get_uvpt_entry+0x96>
+  804810:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804817:	01 00 00 
+  80481a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80481e:	f6 c2 80             	test   $0x80,%dl
+  804821:	75 4f                	jne    804872 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804823:	48 89 f8             	mov    %rdi,%rax
+  804826:	48 c1 e8 15          	shr    $0x15,%rax
+  80482a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804831:	01 00 00 
+  804834:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804838:	f6 c2 01             	test   $0x1,%dl
+  80483b:	74 44                	je     804881 <get_uvpt_entry+0xa5>
+  80483d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804844:	01 00 00 
+  804847:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80484b:	f6 c2 80             	test   $0x80,%dl
+  80484e:	75 31                	jne    804881 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804850:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804854:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80485b:	01 00 00 
+  80485e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804862:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804863:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80486a:	01 00 00 
+  80486d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804871:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804872:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804879:	01 00 00 
+  80487c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804880:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804881:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804888:	01 00 00 
+  80488b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80488f:	c3                   	ret
+
+0000000000804890 <get_prot>:
+
+int
+get_prot(void *va) {
+  804890:	55                   	push   %rbp
+  804891:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804894:	48 b8 dc 47 80 00 00 	movabs $0x8047dc,%rax
+  80489b:	00 00 00 
+  80489e:	ff d0                	call   *%rax
+  8048a0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8048a3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8048a8:	89 c1                	mov    %eax,%ecx
+  8048aa:	83 c9 04             	or     $0x4,%ecx
+  8048ad:	f6 c2 01             	test   $0x1,%dl
+  8048b0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8048b3:	89 c1                	mov    %eax,%ecx
+  8048b5:	83 c9 02             	or     $0x2,%ecx
+  8048b8:	f6 c2 02             	test   $0x2,%dl
+  8048bb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8048be:	89 c1                	mov    %eax,%ecx
+  8048c0:	83 c9 01             	or     $0x1,%ecx
+  8048c3:	48 85 d2             	test   %rdx,%rdx
+  8048c6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8048c9:	89 c1                	mov    %eax,%ecx
+  8048cb:	83 c9 40             	or     $0x40,%ecx
+  8048ce:	f6 c6 04             	test   $0x4,%dh
+  8048d1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8048d4:	5d                   	pop    %rbp
+  8048d5:	c3                   	ret
+
+00000000008048d6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8048d6:	55                   	push   %rbp
+  8048d7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8048da:	48 b8 dc 47 80 00 00 	movabs $0x8047dc,%rax
+  8048e1:	00 00 00 
+  8048e4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8048e6:	48 c1 e8 06          	shr    $0x6,%rax
+  8048ea:	83 e0 01             	and    $0x1,%eax
+}
+  8048ed:	5d                   	pop    %rbp
+  8048ee:	c3                   	ret
+
+00000000008048ef <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8048ef:	55                   	push   %rbp
+  8048f0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8048f3:	48 b8 dc 47 80 00 00 	movabs $0x8047dc,%rax
+  8048fa:	00 00 00 
+  8048fd:	ff d0                	call   *%rax
+  8048ff:	83 e0 01             	and    $0x1,%eax
+}
+  804902:	5d                   	pop    %rbp
+  804903:	c3                   	ret
+
+0000000000804904 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804904:	55                   	push   %rbp
+  804905:	48 89 e5             	mov    %rsp,%rbp
+  804908:	41 57                	push   %r15
+  80490a:	41 56                	push   %r14
+  80490c:	41 55                	push   %r13
+  80490e:	41 54                	push   %r12
+  804910:	53                   	push   %rbx
+  804911:	48 83 ec 28          	sub    $0x28,%rsp
+  804915:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804919:	48 85 ff             	test   %rdi,%rdi
+  80491c:	74 1e                	je     80493c <foreach_shared_region+0x38>
+  80491e:	49 89 ff             	mov    %rdi,%r15
+  804921:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804927:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80492d:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804934:	01 00 00 
+  804937:	e9 72 02 00 00       	jmp    804bae <foreach_shared_region+0x2aa>
+    assert(fun);
+  80493c:	48 b9 ec 65 80 00 00 	movabs $0x8065ec,%rcx
+  804943:	00 00 00 
+  804946:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  80494d:	00 00 00 
+  804950:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804955:	48 bf f0 65 80 00 00 	movabs $0x8065f0,%rdi
+  80495c:	00 00 00 
+  80495f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804964:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  80496b:	00 00 00 
+  80496e:	41 ff d0             	call   *%r8
+  804971:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804978:	eb 6c                	jmp    8049e6 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  80497a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804981:	ff ff ff 
+  804984:	4c 21 e2             	and    %r12,%rdx
+  804987:	48 89 d8             	mov    %rbx,%rax
+  80498a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80498f:	48 83 c0 01          	add    $0x1,%rax
+  804993:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804997:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80499e:	00 00 00 
+  8049a1:	48 21 c8             	and    %rcx,%rax
+  8049a4:	48 09 d0             	or     %rdx,%rax
+  8049a7:	49 89 c4             	mov    %rax,%r12
+  8049aa:	eb 30                	jmp    8049dc <foreach_shared_region+0xd8>
+  8049ac:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8049b3:	ff ff ff 
+  8049b6:	4c 21 e2             	and    %r12,%rdx
+  8049b9:	48 89 d8             	mov    %rbx,%rax
+  8049bc:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8049c1:	48 83 c0 01          	add    $0x1,%rax
+  8049c5:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8049c9:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8049d0:	00 00 00 
+  8049d3:	48 21 c8             	and    %rcx,%rax
+  8049d6:	48 09 d0             	or     %rdx,%rax
+  8049d9:	49 89 c4             	mov    %rax,%r12
+  8049dc:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8049e0:	0f 84 99 01 00 00    	je     804b7f <foreach_shared_region+0x27b>
+  8049e6:	4c 89 e3             	mov    %r12,%rbx
+  8049e9:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8049ed:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8049f4:	01 00 00 
+  8049f7:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049fb:	a8 01                	test   $0x1,%al
+  8049fd:	0f 84 77 ff ff ff    	je     80497a <foreach_shared_region+0x76>
+  804a03:	a8 80                	test   $0x80,%al
+  804a05:	74 19                	je     804a20 <foreach_shared_region+0x11c>
+  804a07:	f6 c4 04             	test   $0x4,%ah
+  804a0a:	74 a0                	je     8049ac <foreach_shared_region+0xa8>
+  804a0c:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804a13:	40 
+  804a14:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804a18:	4c 89 e7             	mov    %r12,%rdi
+  804a1b:	41 ff d7             	call   *%r15
+  804a1e:	eb 8c                	jmp    8049ac <foreach_shared_region+0xa8>
+  804a20:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804a27:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804a2b:	eb 46                	jmp    804a73 <foreach_shared_region+0x16f>
+  804a2d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a34:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a3a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a3e:	48 c1 e0 15          	shl    $0x15,%rax
+  804a42:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a47:	49 09 c4             	or     %rax,%r12
+  804a4a:	eb 1d                	jmp    804a69 <foreach_shared_region+0x165>
+  804a4c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804a53:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a59:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804a5d:	48 c1 e0 15          	shl    $0x15,%rax
+  804a61:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804a66:	49 09 c4             	or     %rax,%r12
+  804a69:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804a6d:	0f 84 d3 00 00 00    	je     804b46 <foreach_shared_region+0x242>
+  804a73:	4c 89 e3             	mov    %r12,%rbx
+  804a76:	48 c1 eb 15          	shr    $0x15,%rbx
+  804a7a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804a81:	01 00 00 
+  804a84:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804a88:	a8 01                	test   $0x1,%al
+  804a8a:	74 a1                	je     804a2d <foreach_shared_region+0x129>
+  804a8c:	a8 80                	test   $0x80,%al
+  804a8e:	74 19                	je     804aa9 <foreach_shared_region+0x1a5>
+  804a90:	f6 c4 04             	test   $0x4,%ah
+  804a93:	74 b7                	je     804a4c <foreach_shared_region+0x148>
+  804a95:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804a9c:	00 
+  804a9d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804aa1:	4c 89 e7             	mov    %r12,%rdi
+  804aa4:	41 ff d7             	call   *%r15
+  804aa7:	eb a3                	jmp    804a4c <foreach_shared_region+0x148>
+  804aa9:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804aaf:	eb 3b                	jmp    804aec <foreach_shared_region+0x1e8>
+  804ab1:	f6 c4 04             	test   $0x4,%ah
+  804ab4:	74 12                	je     804ac8 <foreach_shared_region+0x1c4>
+  804ab6:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804abd:	00 
+  804abe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804ac2:	4c 89 e7             	mov    %r12,%rdi
+  804ac5:	41 ff d7             	call   *%r15
+  804ac8:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804acf:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804ad5:	48 83 c3 01          	add    $0x1,%rbx
+  804ad9:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804add:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804ae3:	49 09 dc             	or     %rbx,%r12
+  804ae6:	41 83 ed 01          	sub    $0x1,%r13d
+  804aea:	74 2f                	je     804b1b <foreach_shared_region+0x217>
+  804aec:	4c 89 e3             	mov    %r12,%rbx
+  804aef:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804af3:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804af7:	a8 01                	test   $0x1,%al
+  804af9:	75 b6                	jne    804ab1 <foreach_shared_region+0x1ad>
+  804afb:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804b02:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804b08:	48 83 c3 01          	add    $0x1,%rbx
+  804b0c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804b10:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804b16:	49 09 dc             	or     %rbx,%r12
+  804b19:	eb cb                	jmp    804ae6 <foreach_shared_region+0x1e2>
+  804b1b:	4c 89 e0             	mov    %r12,%rax
+  804b1e:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804b24:	49 c1 ec 15          	shr    $0x15,%r12
+  804b28:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b2f:	49 83 c4 01          	add    $0x1,%r12
+  804b33:	49 c1 e4 15          	shl    $0x15,%r12
+  804b37:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804b3e:	49 09 c4             	or     %rax,%r12
+  804b41:	e9 23 ff ff ff       	jmp    804a69 <foreach_shared_region+0x165>
+  804b46:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804b4a:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804b51:	ff ff ff 
+  804b54:	4c 21 e0             	and    %r12,%rax
+  804b57:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804b5b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804b62:	49 83 c4 01          	add    $0x1,%r12
+  804b66:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804b6a:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804b71:	00 00 00 
+  804b74:	49 21 d4             	and    %rdx,%r12
+  804b77:	49 09 c4             	or     %rax,%r12
+  804b7a:	e9 5d fe ff ff       	jmp    8049dc <foreach_shared_region+0xd8>
+  804b7f:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804b86:	00 ff ff 
+  804b89:	4c 21 e0             	and    %r12,%rax
+  804b8c:	49 c1 ec 27          	shr    $0x27,%r12
+  804b90:	49 83 c4 01          	add    $0x1,%r12
+  804b94:	49 c1 e4 27          	shl    $0x27,%r12
+  804b98:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804b9f:	ff 00 00 
+  804ba2:	49 21 d4             	and    %rdx,%r12
+  804ba5:	49 09 c4             	or     %rax,%r12
+  804ba8:	41 83 ed 01          	sub    $0x1,%r13d
+  804bac:	74 48                	je     804bf6 <foreach_shared_region+0x2f2>
+  804bae:	4c 89 e0             	mov    %r12,%rax
+  804bb1:	48 c1 e8 27          	shr    $0x27,%rax
+  804bb5:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804bbc:	01 00 00 
+  804bbf:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804bc3:	f6 c2 01             	test   $0x1,%dl
+  804bc6:	0f 85 a5 fd ff ff    	jne    804971 <foreach_shared_region+0x6d>
+  804bcc:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804bd3:	00 ff ff 
+  804bd6:	4c 21 e2             	and    %r12,%rdx
+  804bd9:	48 83 c0 01          	add    $0x1,%rax
+  804bdd:	48 c1 e0 27          	shl    $0x27,%rax
+  804be1:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804be8:	ff 00 00 
+  804beb:	48 21 c8             	and    %rcx,%rax
+  804bee:	48 09 d0             	or     %rdx,%rax
+  804bf1:	49 89 c4             	mov    %rax,%r12
+  804bf4:	eb b2                	jmp    804ba8 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804bf6:	4d 85 e4             	test   %r12,%r12
+  804bf9:	75 14                	jne    804c0f <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c00:	48 83 c4 28          	add    $0x28,%rsp
+  804c04:	5b                   	pop    %rbx
+  804c05:	41 5c                	pop    %r12
+  804c07:	41 5d                	pop    %r13
+  804c09:	41 5e                	pop    %r14
+  804c0b:	41 5f                	pop    %r15
+  804c0d:	5d                   	pop    %rbp
+  804c0e:	c3                   	ret
+    assert(addr == 0);
+  804c0f:	48 b9 fb 65 80 00 00 	movabs $0x8065fb,%rcx
+  804c16:	00 00 00 
+  804c19:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  804c20:	00 00 00 
+  804c23:	be 67 00 00 00       	mov    $0x67,%esi
+  804c28:	48 bf f0 65 80 00 00 	movabs $0x8065f0,%rdi
+  804c2f:	00 00 00 
+  804c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c37:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  804c3e:	00 00 00 
+  804c41:	41 ff d0             	call   *%r8
+
+0000000000804c44 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804c44:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804c4b:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804c4e:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804c54:	eb 33                	jmp    804c89 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c56:	48 83 c0 20          	add    $0x20,%rax
+  804c5a:	4c 39 c0             	cmp    %r8,%rax
+  804c5d:	74 25                	je     804c84 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804c5f:	48 8b 10             	mov    (%rax),%rdx
+  804c62:	48 85 d2             	test   %rdx,%rdx
+  804c65:	74 ef                	je     804c56 <mmap_place+0x12>
+  804c67:	48 89 d1             	mov    %rdx,%rcx
+  804c6a:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c6e:	48 39 cf             	cmp    %rcx,%rdi
+  804c71:	73 e3                	jae    804c56 <mmap_place+0x12>
+  804c73:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804c77:	4c 39 ca             	cmp    %r9,%rdx
+  804c7a:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804c7e:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804c82:	eb d2                	jmp    804c56 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804c84:	45 84 d2             	test   %r10b,%r10b
+  804c87:	74 12                	je     804c9b <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804c89:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c90:	00 00 00 
+        moved = 0;
+  804c93:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804c99:	eb c4                	jmp    804c5f <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804c9b:	48 01 fe             	add    %rdi,%rsi
+  804c9e:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804ca5:	00 00 00 
+  804ca8:	48 39 f0             	cmp    %rsi,%rax
+  804cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cb0:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804cb4:	c3                   	ret
+
+0000000000804cb5 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804cb5:	55                   	push   %rbp
+  804cb6:	48 89 e5             	mov    %rsp,%rbp
+  804cb9:	41 57                	push   %r15
+  804cbb:	41 56                	push   %r14
+  804cbd:	41 55                	push   %r13
+  804cbf:	41 54                	push   %r12
+  804cc1:	53                   	push   %rbx
+  804cc2:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804cc6:	48 8b 1f             	mov    (%rdi),%rbx
+  804cc9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804cd0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804cd7:	00 00 00 
+  804cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cdf:	eb 12                	jmp    804cf3 <mmap_pgfault+0x3e>
+  804ce1:	48 83 c2 01          	add    $0x1,%rdx
+  804ce5:	48 83 c0 20          	add    $0x20,%rax
+  804ce9:	48 83 fa 20          	cmp    $0x20,%rdx
+  804ced:	0f 84 04 01 00 00    	je     804df7 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804cf3:	48 8b 08             	mov    (%rax),%rcx
+  804cf6:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804cfa:	48 39 de             	cmp    %rbx,%rsi
+  804cfd:	73 e2                	jae    804ce1 <mmap_pgfault+0x2c>
+  804cff:	48 03 48 08          	add    0x8(%rax),%rcx
+  804d03:	48 39 cb             	cmp    %rcx,%rbx
+  804d06:	73 d9                	jae    804ce1 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804d08:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d0c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804d13:	00 00 00 
+  804d16:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804d1a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804d1e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804d22:	f6 c2 01             	test   $0x1,%dl
+  804d25:	0f 84 e0 00 00 00    	je     804e0b <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d30:	f6 c2 02             	test   $0x2,%dl
+  804d33:	0f 84 c3 00 00 00    	je     804dfc <mmap_pgfault+0x147>
+  804d39:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804d40:	ff ff ff 
+  804d43:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804d47:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804d4e:	00 00 00 
+  804d51:	48 39 ca             	cmp    %rcx,%rdx
+  804d54:	0f 85 a2 00 00 00    	jne    804dfc <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804d5a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804d5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d64:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804d6b:	00 00 00 
+  804d6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d73:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  804d7a:	00 00 00 
+  804d7d:	ff d0                	call   *%rax
+  804d7f:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804d81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d86:	85 d2                	test   %edx,%edx
+  804d88:	78 72                	js     804dfc <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804d8a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d8f:	48 89 de             	mov    %rbx,%rsi
+  804d92:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804d99:	00 00 00 
+  804d9c:	4c 89 e7             	mov    %r12,%rdi
+  804d9f:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  804da6:	00 00 00 
+  804da9:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804dab:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804db1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804db7:	48 89 d9             	mov    %rbx,%rcx
+  804dba:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dbf:	4c 89 e6             	mov    %r12,%rsi
+  804dc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dc7:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  804dce:	00 00 00 
+  804dd1:	ff d0                	call   *%rax
+  804dd3:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804dd5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dda:	4c 89 e6             	mov    %r12,%rsi
+  804ddd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804de2:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  804de9:	00 00 00 
+  804dec:	ff d0                	call   *%rax
+    return res >= 0;
+  804dee:	89 d8                	mov    %ebx,%eax
+  804df0:	f7 d0                	not    %eax
+  804df2:	c1 e8 1f             	shr    $0x1f,%eax
+  804df5:	eb 05                	jmp    804dfc <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804df7:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804dfc:	48 83 c4 18          	add    $0x18,%rsp
+  804e00:	5b                   	pop    %rbx
+  804e01:	41 5c                	pop    %r12
+  804e03:	41 5d                	pop    %r13
+  804e05:	41 5e                	pop    %r14
+  804e07:	41 5f                	pop    %r15
+  804e09:	5d                   	pop    %rbp
+  804e0a:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804e0b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e0f:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804e13:	4c 03 30             	add    (%rax),%r14
+  804e16:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804e1d:	49 39 c6             	cmp    %rax,%r14
+  804e20:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e24:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804e2b:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804e31:	49 bf ef 48 80 00 00 	movabs $0x8048ef,%r15
+  804e38:	00 00 00 
+  804e3b:	4d 39 f4             	cmp    %r14,%r12
+  804e3e:	73 1d                	jae    804e5d <mmap_pgfault+0x1a8>
+  804e40:	4c 89 e7             	mov    %r12,%rdi
+  804e43:	41 ff d7             	call   *%r15
+  804e46:	84 c0                	test   %al,%al
+  804e48:	75 13                	jne    804e5d <mmap_pgfault+0x1a8>
+  804e4a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804e51:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804e58:	4d 39 f4             	cmp    %r14,%r12
+  804e5b:	72 e3                	jb     804e40 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e5d:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804e63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e67:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804e6b:	74 2a                	je     804e97 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e71:	89 de                	mov    %ebx,%esi
+  804e73:	2b 30                	sub    (%rax),%esi
+  804e75:	03 70 1c             	add    0x1c(%rax),%esi
+  804e78:	8b 78 18             	mov    0x18(%rax),%edi
+  804e7b:	4c 89 e9             	mov    %r13,%rcx
+  804e7e:	48 89 da             	mov    %rbx,%rdx
+  804e81:	48 b8 4d 40 80 00 00 	movabs $0x80404d,%rax
+  804e88:	00 00 00 
+  804e8b:	ff d0                	call   *%rax
+    return res > 0;
+  804e8d:	85 c0                	test   %eax,%eax
+  804e8f:	0f 9f c0             	setg   %al
+  804e92:	e9 65 ff ff ff       	jmp    804dfc <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804e97:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804e9b:	eb d0                	jmp    804e6d <mmap_pgfault+0x1b8>
+
+0000000000804e9d <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804e9d:	55                   	push   %rbp
+  804e9e:	48 89 e5             	mov    %rsp,%rbp
+  804ea1:	41 57                	push   %r15
+  804ea3:	41 56                	push   %r14
+  804ea5:	41 55                	push   %r13
+  804ea7:	41 54                	push   %r12
+  804ea9:	53                   	push   %rbx
+  804eaa:	48 83 ec 28          	sub    $0x28,%rsp
+  804eae:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804eb2:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804eb5:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ebc:	ff ff ff 
+  804ebf:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804ec3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ec8:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804ecf:	00 00 00 
+  804ed2:	48 39 ca             	cmp    %rcx,%rdx
+  804ed5:	0f 85 e5 00 00 00    	jne    804fc0 <mmap_writeback+0x123>
+  804edb:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804ede:	4c 39 ee             	cmp    %r13,%rsi
+  804ee1:	0f 83 e8 00 00 00    	jae    804fcf <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804ee7:	49 be ef 48 80 00 00 	movabs $0x8048ef,%r14
+  804eee:	00 00 00 
+  804ef1:	49 bf d6 48 80 00 00 	movabs $0x8048d6,%r15
+  804ef8:	00 00 00 
+  804efb:	eb 10                	jmp    804f0d <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804efd:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804f04:	4d 39 ec             	cmp    %r13,%r12
+  804f07:	0f 83 ae 00 00 00    	jae    804fbb <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804f0d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804f11:	4c 89 e7             	mov    %r12,%rdi
+  804f14:	41 ff d6             	call   *%r14
+  804f17:	84 c0                	test   %al,%al
+  804f19:	74 e2                	je     804efd <mmap_writeback+0x60>
+  804f1b:	4c 89 e7             	mov    %r12,%rdi
+  804f1e:	41 ff d7             	call   *%r15
+  804f21:	84 c0                	test   %al,%al
+  804f23:	74 d8                	je     804efd <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804f25:	4c 89 e3             	mov    %r12,%rbx
+  804f28:	4d 39 ec             	cmp    %r13,%r12
+  804f2b:	73 20                	jae    804f4d <mmap_writeback+0xb0>
+  804f2d:	48 89 df             	mov    %rbx,%rdi
+  804f30:	41 ff d6             	call   *%r14
+  804f33:	84 c0                	test   %al,%al
+  804f35:	74 16                	je     804f4d <mmap_writeback+0xb0>
+  804f37:	48 89 df             	mov    %rbx,%rdi
+  804f3a:	41 ff d7             	call   *%r15
+  804f3d:	84 c0                	test   %al,%al
+  804f3f:	74 0c                	je     804f4d <mmap_writeback+0xb0>
+  804f41:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f48:	4c 39 eb             	cmp    %r13,%rbx
+  804f4b:	72 e0                	jb     804f2d <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804f4d:	48 89 d9             	mov    %rbx,%rcx
+  804f50:	4c 29 e1             	sub    %r12,%rcx
+  804f53:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f57:	44 89 e6             	mov    %r12d,%esi
+  804f5a:	2b 30                	sub    (%rax),%esi
+  804f5c:	49 89 c4             	mov    %rax,%r12
+  804f5f:	03 70 1c             	add    0x1c(%rax),%esi
+  804f62:	8b 78 18             	mov    0x18(%rax),%edi
+  804f65:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804f69:	48 89 ca             	mov    %rcx,%rdx
+  804f6c:	48 b8 d6 40 80 00 00 	movabs $0x8040d6,%rax
+  804f73:	00 00 00 
+  804f76:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804f78:	85 c0                	test   %eax,%eax
+  804f7a:	78 44                	js     804fc0 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804f7c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804f81:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804f84:	41 89 c1             	mov    %eax,%r9d
+  804f87:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804f8e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804f92:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f9b:	48 89 ce             	mov    %rcx,%rsi
+  804f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fa3:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  804faa:	00 00 00 
+  804fad:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804faf:	85 c0                	test   %eax,%eax
+  804fb1:	78 0d                	js     804fc0 <mmap_writeback+0x123>
+  804fb3:	49 89 dc             	mov    %rbx,%r12
+  804fb6:	e9 49 ff ff ff       	jmp    804f04 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fc0:	48 83 c4 28          	add    $0x28,%rsp
+  804fc4:	5b                   	pop    %rbx
+  804fc5:	41 5c                	pop    %r12
+  804fc7:	41 5d                	pop    %r13
+  804fc9:	41 5e                	pop    %r14
+  804fcb:	41 5f                	pop    %r15
+  804fcd:	5d                   	pop    %rbp
+  804fce:	c3                   	ret
+    return 0;
+  804fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd4:	eb ea                	jmp    804fc0 <mmap_writeback+0x123>
+
+0000000000804fd6 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804fd6:	55                   	push   %rbp
+  804fd7:	48 89 e5             	mov    %rsp,%rbp
+  804fda:	41 57                	push   %r15
+  804fdc:	41 56                	push   %r14
+  804fde:	41 55                	push   %r13
+  804fe0:	41 54                	push   %r12
+  804fe2:	53                   	push   %rbx
+  804fe3:	48 83 ec 38          	sub    $0x38,%rsp
+  804fe7:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804feb:	48 85 f6             	test   %rsi,%rsi
+  804fee:	0f 84 0c 02 00 00    	je     805200 <mmap+0x22a>
+  804ff4:	49 89 ff             	mov    %rdi,%r15
+  804ff7:	49 89 f4             	mov    %rsi,%r12
+  804ffa:	41 89 d5             	mov    %edx,%r13d
+  804ffd:	41 89 ce             	mov    %ecx,%r14d
+  805000:	44 89 cb             	mov    %r9d,%ebx
+  805003:	45 85 c9             	test   %r9d,%r9d
+  805006:	0f 88 f4 01 00 00    	js     805200 <mmap+0x22a>
+  80500c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805013:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80501a:	0f 85 e7 01 00 00    	jne    805207 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805020:	83 e2 fd             	and    $0xfffffffd,%edx
+  805023:	83 fa 04             	cmp    $0x4,%edx
+  805026:	0f 85 db 01 00 00    	jne    805207 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80502c:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80502f:	83 fa 01             	cmp    $0x1,%edx
+  805032:	0f 87 cf 01 00 00    	ja     805207 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805038:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80503c:	44 89 c7             	mov    %r8d,%edi
+  80503f:	48 b8 f0 33 80 00 00 	movabs $0x8033f0,%rax
+  805046:	00 00 00 
+  805049:	ff d0                	call   *%rax
+  80504b:	89 c2                	mov    %eax,%edx
+  80504d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805054:	85 d2                	test   %edx,%edx
+  805056:	0f 88 ab 01 00 00    	js     805207 <mmap+0x231>
+  80505c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805060:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805067:	00 00 00 
+  80506a:	8b 09                	mov    (%rcx),%ecx
+  80506c:	39 0a                	cmp    %ecx,(%rdx)
+  80506e:	0f 85 93 01 00 00    	jne    805207 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805074:	8b 52 08             	mov    0x8(%rdx),%edx
+  805077:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80507a:	83 fa 01             	cmp    $0x1,%edx
+  80507d:	0f 84 84 01 00 00    	je     805207 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805083:	41 83 fe 01          	cmp    $0x1,%r14d
+  805087:	74 42                	je     8050cb <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805089:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805090:	4c 89 e6             	mov    %r12,%rsi
+  805093:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80509a:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  80509e:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8050a2:	4d 85 ff             	test   %r15,%r15
+  8050a5:	74 67                	je     80510e <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050a7:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8050ae:	75 0f                	jne    8050bf <mmap+0xe9>
+  8050b0:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8050b7:	00 00 00 
+  8050ba:	49 39 c7             	cmp    %rax,%r15
+  8050bd:	77 1b                	ja     8050da <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8050bf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050c6:	e9 3c 01 00 00       	jmp    805207 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8050cb:	41 f6 c5 02          	test   $0x2,%r13b
+  8050cf:	74 b8                	je     805089 <mmap+0xb3>
+  8050d1:	85 d2                	test   %edx,%edx
+  8050d3:	75 b4                	jne    805089 <mmap+0xb3>
+  8050d5:	e9 2d 01 00 00       	jmp    805207 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8050da:	4c 89 ff             	mov    %r15,%rdi
+  8050dd:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  8050e4:	00 00 00 
+  8050e7:	ff d0                	call   *%rax
+  8050e9:	48 89 c2             	mov    %rax,%rdx
+  8050ec:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8050f3:	49 39 d7             	cmp    %rdx,%r15
+  8050f6:	0f 85 0b 01 00 00    	jne    805207 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8050fc:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805103:	00 00 00 
+  805106:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80510c:	eb 44                	jmp    805152 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80510e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805112:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805119:	00 00 00 
+  80511c:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  805123:	00 00 00 
+  805126:	ff d0                	call   *%rax
+  805128:	48 89 c7             	mov    %rax,%rdi
+  80512b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80512f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805136:	48 85 ff             	test   %rdi,%rdi
+  805139:	75 c1                	jne    8050fc <mmap+0x126>
+  80513b:	e9 c7 00 00 00       	jmp    805207 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805140:	49 83 c4 01          	add    $0x1,%r12
+  805144:	48 83 c0 20          	add    $0x20,%rax
+  805148:	49 83 fc 20          	cmp    $0x20,%r12
+  80514c:	0f 84 a5 00 00 00    	je     8051f7 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805152:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805156:	75 e8                	jne    805140 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805158:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80515c:	48 b8 90 33 80 00 00 	movabs $0x803390,%rax
+  805163:	00 00 00 
+  805166:	ff d0                	call   *%rax
+  805168:	89 c2                	mov    %eax,%edx
+  80516a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805171:	85 d2                	test   %edx,%edx
+  805173:	0f 88 8e 00 00 00    	js     805207 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805179:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80517d:	48 b8 62 33 80 00 00 	movabs $0x803362,%rax
+  805184:	00 00 00 
+  805187:	ff d0                	call   *%rax
+  805189:	89 c6                	mov    %eax,%esi
+  80518b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80518e:	48 b8 b0 35 80 00 00 	movabs $0x8035b0,%rax
+  805195:	00 00 00 
+  805198:	ff d0                	call   *%rax
+  80519a:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  80519d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051a4:	45 85 ff             	test   %r15d,%r15d
+  8051a7:	78 5e                	js     805207 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8051a9:	49 c1 e4 05          	shl    $0x5,%r12
+  8051ad:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8051b4:	00 00 00 
+  8051b7:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8051ba:	48 bf b5 4c 80 00 00 	movabs $0x804cb5,%rdi
+  8051c1:	00 00 00 
+  8051c4:	48 b8 23 54 80 00 00 	movabs $0x805423,%rax
+  8051cb:	00 00 00 
+  8051ce:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8051d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8051d4:	49 89 04 24          	mov    %rax,(%r12)
+  8051d8:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8051dc:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8051e1:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8051e6:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8051eb:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  8051f0:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  8051f5:	eb 10                	jmp    805207 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  8051f7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051fe:	eb 07                	jmp    805207 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805200:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805207:	48 83 c4 38          	add    $0x38,%rsp
+  80520b:	5b                   	pop    %rbx
+  80520c:	41 5c                	pop    %r12
+  80520e:	41 5d                	pop    %r13
+  805210:	41 5e                	pop    %r14
+  805212:	41 5f                	pop    %r15
+  805214:	5d                   	pop    %rbp
+  805215:	c3                   	ret
+
+0000000000805216 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805216:	55                   	push   %rbp
+  805217:	48 89 e5             	mov    %rsp,%rbp
+  80521a:	41 57                	push   %r15
+  80521c:	41 56                	push   %r14
+  80521e:	41 55                	push   %r13
+  805220:	41 54                	push   %r12
+  805222:	53                   	push   %rbx
+  805223:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805227:	49 89 fe             	mov    %rdi,%r14
+  80522a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805231:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805238:	00 
+  805239:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805240:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805247:	00 00 00 
+  80524a:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805251:	49 bf 9d 4e 80 00 00 	movabs $0x804e9d,%r15
+  805258:	00 00 00 
+  80525b:	eb 09                	jmp    805266 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80525d:	48 83 c3 20          	add    $0x20,%rbx
+  805261:	4c 39 eb             	cmp    %r13,%rbx
+  805264:	74 33                	je     805299 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805266:	48 89 df             	mov    %rbx,%rdi
+  805269:	48 8b 33             	mov    (%rbx),%rsi
+  80526c:	4c 39 e6             	cmp    %r12,%rsi
+  80526f:	73 ec                	jae    80525d <msync+0x47>
+  805271:	48 85 f6             	test   %rsi,%rsi
+  805274:	74 e7                	je     80525d <msync+0x47>
+  805276:	48 89 f2             	mov    %rsi,%rdx
+  805279:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80527d:	49 39 d6             	cmp    %rdx,%r14
+  805280:	73 db                	jae    80525d <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805282:	4c 39 e2             	cmp    %r12,%rdx
+  805285:	49 0f 47 d4          	cmova  %r12,%rdx
+  805289:	4c 39 f6             	cmp    %r14,%rsi
+  80528c:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805290:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805293:	85 c0                	test   %eax,%eax
+  805295:	79 c6                	jns    80525d <msync+0x47>
+  805297:	eb 05                	jmp    80529e <msync+0x88>
+    }
+
+    return 0;
+  805299:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80529e:	48 83 c4 08          	add    $0x8,%rsp
+  8052a2:	5b                   	pop    %rbx
+  8052a3:	41 5c                	pop    %r12
+  8052a5:	41 5d                	pop    %r13
+  8052a7:	41 5e                	pop    %r14
+  8052a9:	41 5f                	pop    %r15
+  8052ab:	5d                   	pop    %rbp
+  8052ac:	c3                   	ret
+
+00000000008052ad <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8052ad:	55                   	push   %rbp
+  8052ae:	48 89 e5             	mov    %rsp,%rbp
+  8052b1:	41 57                	push   %r15
+  8052b3:	41 56                	push   %r14
+  8052b5:	41 55                	push   %r13
+  8052b7:	41 54                	push   %r12
+  8052b9:	53                   	push   %rbx
+  8052ba:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8052be:	49 89 ff             	mov    %rdi,%r15
+  8052c1:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052c8:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8052cf:	00 
+  8052d0:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052d7:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8052de:	00 00 00 
+  8052e1:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8052e8:	48 89 d8             	mov    %rbx,%rax
+  8052eb:	eb 09                	jmp    8052f6 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8052ed:	48 83 c0 20          	add    $0x20,%rax
+  8052f1:	4c 39 f0             	cmp    %r14,%rax
+  8052f4:	74 40                	je     805336 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8052f6:	48 8b 10             	mov    (%rax),%rdx
+  8052f9:	4c 39 e2             	cmp    %r12,%rdx
+  8052fc:	73 ef                	jae    8052ed <munmap+0x40>
+  8052fe:	48 85 d2             	test   %rdx,%rdx
+  805301:	74 ea                	je     8052ed <munmap+0x40>
+  805303:	48 89 d7             	mov    %rdx,%rdi
+  805306:	48 03 78 08          	add    0x8(%rax),%rdi
+  80530a:	49 39 ff             	cmp    %rdi,%r15
+  80530d:	73 de                	jae    8052ed <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  80530f:	49 39 fc             	cmp    %rdi,%r12
+  805312:	72 05                	jb     805319 <munmap+0x6c>
+  805314:	4c 39 fa             	cmp    %r15,%rdx
+  805317:	73 d4                	jae    8052ed <munmap+0x40>
+  805319:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80531e:	48 83 c4 08          	add    $0x8,%rsp
+  805322:	5b                   	pop    %rbx
+  805323:	41 5c                	pop    %r12
+  805325:	41 5d                	pop    %r13
+  805327:	41 5e                	pop    %r14
+  805329:	41 5f                	pop    %r15
+  80532b:	5d                   	pop    %rbp
+  80532c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80532d:	48 83 c3 20          	add    $0x20,%rbx
+  805331:	4c 39 f3             	cmp    %r14,%rbx
+  805334:	74 5c                	je     805392 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805336:	48 8b 33             	mov    (%rbx),%rsi
+  805339:	4c 39 e6             	cmp    %r12,%rsi
+  80533c:	73 ef                	jae    80532d <munmap+0x80>
+  80533e:	48 85 f6             	test   %rsi,%rsi
+  805341:	74 ea                	je     80532d <munmap+0x80>
+  805343:	48 89 f2             	mov    %rsi,%rdx
+  805346:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80534a:	49 39 d7             	cmp    %rdx,%r15
+  80534d:	73 de                	jae    80532d <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80534f:	48 89 df             	mov    %rbx,%rdi
+  805352:	48 b8 9d 4e 80 00 00 	movabs $0x804e9d,%rax
+  805359:	00 00 00 
+  80535c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80535e:	85 c0                	test   %eax,%eax
+  805360:	78 bc                	js     80531e <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805362:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805366:	48 8b 33             	mov    (%rbx),%rsi
+  805369:	bf 00 00 00 00       	mov    $0x0,%edi
+  80536e:	48 b8 dc 2d 80 00 00 	movabs $0x802ddc,%rax
+  805375:	00 00 00 
+  805378:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80537a:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80537d:	48 b8 55 35 80 00 00 	movabs $0x803555,%rax
+  805384:	00 00 00 
+  805387:	ff d0                	call   *%rax
+        reg->start = 0;
+  805389:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805390:	eb 9b                	jmp    80532d <munmap+0x80>
+    return 0;
+  805392:	b8 00 00 00 00       	mov    $0x0,%eax
+  805397:	eb 85                	jmp    80531e <munmap+0x71>
+
+0000000000805399 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805399:	55                   	push   %rbp
+  80539a:	48 89 e5             	mov    %rsp,%rbp
+  80539d:	41 56                	push   %r14
+  80539f:	41 55                	push   %r13
+  8053a1:	41 54                	push   %r12
+  8053a3:	53                   	push   %rbx
+  8053a4:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053a7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8053ae:	00 00 00 
+  8053b1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8053b5:	74 27                	je     8053de <_handle_vectored_pagefault+0x45>
+  8053b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8053bc:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8053c3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053c6:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8053c9:	4c 89 e7             	mov    %r12,%rdi
+  8053cc:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8053d1:	84 c0                	test   %al,%al
+  8053d3:	75 45                	jne    80541a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053d5:	48 83 c3 01          	add    $0x1,%rbx
+  8053d9:	49 3b 1e             	cmp    (%r14),%rbx
+  8053dc:	72 eb                	jb     8053c9 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8053de:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8053e5:	00 
+  8053e6:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8053eb:	4d 8b 04 24          	mov    (%r12),%r8
+  8053ef:	48 ba 08 66 80 00 00 	movabs $0x806608,%rdx
+  8053f6:	00 00 00 
+  8053f9:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8053fe:	48 bf 38 66 80 00 00 	movabs $0x806638,%rdi
+  805405:	00 00 00 
+  805408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80540d:	49 ba ce 19 80 00 00 	movabs $0x8019ce,%r10
+  805414:	00 00 00 
+  805417:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80541a:	5b                   	pop    %rbx
+  80541b:	41 5c                	pop    %r12
+  80541d:	41 5d                	pop    %r13
+  80541f:	41 5e                	pop    %r14
+  805421:	5d                   	pop    %rbp
+  805422:	c3                   	ret
+
+0000000000805423 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805423:	55                   	push   %rbp
+  805424:	48 89 e5             	mov    %rsp,%rbp
+  805427:	53                   	push   %rbx
+  805428:	48 83 ec 08          	sub    $0x8,%rsp
+  80542c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80542f:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805434:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80543b:	00 00 00 
+  80543e:	80 38 00             	cmpb   $0x0,(%rax)
+  805441:	74 68                	je     8054ab <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805443:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80544a:	00 00 00 
+  80544d:	48 8b 08             	mov    (%rax),%rcx
+  805450:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805455:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80545c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80545f:	48 85 c9             	test   %rcx,%rcx
+  805462:	0f 84 e0 00 00 00    	je     805548 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805468:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80546c:	0f 84 c9 00 00 00    	je     80553b <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805472:	48 83 c2 01          	add    $0x1,%rdx
+  805476:	48 39 ca             	cmp    %rcx,%rdx
+  805479:	75 ed                	jne    805468 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80547b:	48 83 f9 08          	cmp    $0x8,%rcx
+  80547f:	0f 84 84 00 00 00    	je     805509 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805485:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805489:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805490:	00 00 00 
+  805493:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80549a:	00 00 00 
+  80549d:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054a1:	85 f6                	test   %esi,%esi
+  8054a3:	0f 89 97 00 00 00    	jns    805540 <add_pgfault_handler+0x11d>
+  8054a9:	eb 63                	jmp    80550e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8054ab:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8054b0:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8054b5:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8054bc:	00 00 00 
+  8054bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054c4:	48 b8 04 2d 80 00 00 	movabs $0x802d04,%rax
+  8054cb:	00 00 00 
+  8054ce:	ff d0                	call   *%rax
+  8054d0:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8054d2:	85 c0                	test   %eax,%eax
+  8054d4:	78 38                	js     80550e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8054d6:	48 be 24 56 80 00 00 	movabs $0x805624,%rsi
+  8054dd:	00 00 00 
+  8054e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054e5:	48 b8 27 2f 80 00 00 	movabs $0x802f27,%rax
+  8054ec:	00 00 00 
+  8054ef:	ff d0                	call   *%rax
+  8054f1:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8054f3:	85 c0                	test   %eax,%eax
+  8054f5:	78 17                	js     80550e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8054f7:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8054fe:	00 00 00 
+  805501:	c6 00 01             	movb   $0x1,(%rax)
+  805504:	e9 3a ff ff ff       	jmp    805443 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805509:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80550e:	89 f1                	mov    %esi,%ecx
+  805510:	48 ba 46 66 80 00 00 	movabs $0x806646,%rdx
+  805517:	00 00 00 
+  80551a:	be 42 00 00 00       	mov    $0x42,%esi
+  80551f:	48 bf 38 66 80 00 00 	movabs $0x806638,%rdi
+  805526:	00 00 00 
+  805529:	b8 00 00 00 00       	mov    $0x0,%eax
+  80552e:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  805535:	00 00 00 
+  805538:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80553b:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805540:	89 f0                	mov    %esi,%eax
+  805542:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805546:	c9                   	leave
+  805547:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805548:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80554f:	00 00 00 
+  805552:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805559:	48 89 d8             	mov    %rbx,%rax
+  80555c:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805563:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805566:	eb d8                	jmp    805540 <add_pgfault_handler+0x11d>
+
+0000000000805568 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805568:	55                   	push   %rbp
+  805569:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80556c:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805573:	00 00 00 
+  805576:	80 38 00             	cmpb   $0x0,(%rax)
+  805579:	74 33                	je     8055ae <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80557b:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805582:	00 00 00 
+  805585:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80558a:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805591:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805594:	48 85 c0             	test   %rax,%rax
+  805597:	0f 84 85 00 00 00    	je     805622 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80559d:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8055a1:	74 40                	je     8055e3 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055a3:	48 83 c1 01          	add    $0x1,%rcx
+  8055a7:	48 39 c1             	cmp    %rax,%rcx
+  8055aa:	75 f1                	jne    80559d <remove_pgfault_handler+0x35>
+  8055ac:	eb 74                	jmp    805622 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8055ae:	48 b9 5e 66 80 00 00 	movabs $0x80665e,%rcx
+  8055b5:	00 00 00 
+  8055b8:	48 ba 56 65 80 00 00 	movabs $0x806556,%rdx
+  8055bf:	00 00 00 
+  8055c2:	be 48 00 00 00       	mov    $0x48,%esi
+  8055c7:	48 bf 38 66 80 00 00 	movabs $0x806638,%rdi
+  8055ce:	00 00 00 
+  8055d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055d6:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  8055dd:	00 00 00 
+  8055e0:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8055e3:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8055ea:	00 
+  8055eb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8055ef:	48 29 ca             	sub    %rcx,%rdx
+  8055f2:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8055f9:	00 00 00 
+  8055fc:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805600:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805605:	48 89 ce             	mov    %rcx,%rsi
+  805608:	48 b8 a5 27 80 00 00 	movabs $0x8027a5,%rax
+  80560f:	00 00 00 
+  805612:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805614:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80561b:	00 00 00 
+  80561e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805622:	5d                   	pop    %rbp
+  805623:	c3                   	ret
+
+0000000000805624 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805624:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805627:	48 b8 99 53 80 00 00 	movabs $0x805399,%rax
+  80562e:	00 00 00 
+    call *%rax
+  805631:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805633:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80563a:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80563b:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805642:	00 
+    subq $8, %rcx
+  805643:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805647:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80564a:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805651:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805652:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805656:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80565a:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  80565f:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805664:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805669:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  80566e:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805673:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805678:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  80567d:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805682:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805687:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80568c:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805691:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805696:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80569b:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8056a0:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8056a4:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8056a8:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8056a9:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8056aa:	c3                   	ret
+
+00000000008056ab <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8056ab:	85 ff                	test   %edi,%edi
+  8056ad:	78 58                	js     805707 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8056af:	48 85 f6             	test   %rsi,%rsi
+  8056b2:	74 12                	je     8056c6 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8056b4:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056bb:	00 00 00 
+  8056be:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8056c4:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8056c6:	48 85 c9             	test   %rcx,%rcx
+  8056c9:	74 12                	je     8056dd <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8056cb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056d2:	00 00 00 
+  8056d5:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8056db:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8056dd:	48 85 d2             	test   %rdx,%rdx
+  8056e0:	74 14                	je     8056f6 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8056e2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056e9:	00 00 00 
+  8056ec:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8056f3:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8056f6:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8056fd:	00 00 00 
+  805700:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805706:	c3                   	ret
+        if (from_env_store) {
+  805707:	48 85 f6             	test   %rsi,%rsi
+  80570a:	74 06                	je     805712 <ipc_result+0x67>
+            *from_env_store = 0;
+  80570c:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805712:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805714:	48 85 c9             	test   %rcx,%rcx
+  805717:	74 ed                	je     805706 <ipc_result+0x5b>
+            *perm_store = 0;
+  805719:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80571f:	c3                   	ret
+
+0000000000805720 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805720:	55                   	push   %rbp
+  805721:	48 89 e5             	mov    %rsp,%rbp
+  805724:	41 55                	push   %r13
+  805726:	41 54                	push   %r12
+  805728:	53                   	push   %rbx
+  805729:	48 83 ec 08          	sub    $0x8,%rsp
+  80572d:	49 89 fc             	mov    %rdi,%r12
+  805730:	48 89 f7             	mov    %rsi,%rdi
+  805733:	48 89 d3             	mov    %rdx,%rbx
+  805736:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805739:	48 85 f6             	test   %rsi,%rsi
+  80573c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805743:	00 00 00 
+  805746:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80574a:	be 00 00 00 00       	mov    $0x0,%esi
+  80574f:	48 85 d2             	test   %rdx,%rdx
+  805752:	74 03                	je     805757 <ipc_recv+0x37>
+  805754:	48 8b 32             	mov    (%rdx),%rsi
+  805757:	48 b8 50 32 80 00 00 	movabs $0x803250,%rax
+  80575e:	00 00 00 
+  805761:	ff d0                	call   *%rax
+  805763:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805765:	4c 89 e9             	mov    %r13,%rcx
+  805768:	48 89 da             	mov    %rbx,%rdx
+  80576b:	4c 89 e6             	mov    %r12,%rsi
+  80576e:	48 b8 ab 56 80 00 00 	movabs $0x8056ab,%rax
+  805775:	00 00 00 
+  805778:	ff d0                	call   *%rax
+}
+  80577a:	48 83 c4 08          	add    $0x8,%rsp
+  80577e:	5b                   	pop    %rbx
+  80577f:	41 5c                	pop    %r12
+  805781:	41 5d                	pop    %r13
+  805783:	5d                   	pop    %rbp
+  805784:	c3                   	ret
+
+0000000000805785 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805785:	55                   	push   %rbp
+  805786:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805789:	48 85 d2             	test   %rdx,%rdx
+  80578c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805793:	00 00 00 
+  805796:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80579a:	89 f6                	mov    %esi,%esi
+  80579c:	48 b8 dc 30 80 00 00 	movabs $0x8030dc,%rax
+  8057a3:	00 00 00 
+  8057a6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057a8:	85 c0                	test   %eax,%eax
+  8057aa:	78 02                	js     8057ae <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8057ac:	5d                   	pop    %rbp
+  8057ad:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8057ae:	89 c1                	mov    %eax,%ecx
+  8057b0:	48 ba 78 66 80 00 00 	movabs $0x806678,%rdx
+  8057b7:	00 00 00 
+  8057ba:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8057bf:	48 bf 85 66 80 00 00 	movabs $0x806685,%rdi
+  8057c6:	00 00 00 
+  8057c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ce:	49 b8 ce 19 80 00 00 	movabs $0x8019ce,%r8
+  8057d5:	00 00 00 
+  8057d8:	41 ff d0             	call   *%r8
+
+00000000008057db <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8057db:	55                   	push   %rbp
+  8057dc:	48 89 e5             	mov    %rsp,%rbp
+  8057df:	53                   	push   %rbx
+  8057e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8057e4:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8057e8:	48 85 d2             	test   %rdx,%rdx
+  8057eb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057f2:	00 00 00 
+  8057f5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8057f9:	4d 85 c9             	test   %r9,%r9
+  8057fc:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805800:	b8 00 00 00 00       	mov    $0x0,%eax
+  805805:	48 85 db             	test   %rbx,%rbx
+  805808:	74 03                	je     80580d <ipc_call+0x32>
+  80580a:	48 8b 03             	mov    (%rbx),%rax
+  80580d:	89 f6                	mov    %esi,%esi
+  80580f:	48 83 ec 08          	sub    $0x8,%rsp
+  805813:	50                   	push   %rax
+  805814:	48 b8 0e 31 80 00 00 	movabs $0x80310e,%rax
+  80581b:	00 00 00 
+  80581e:	ff d0                	call   *%rax
+  805820:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805822:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805826:	48 89 da             	mov    %rbx,%rdx
+  805829:	be 00 00 00 00       	mov    $0x0,%esi
+  80582e:	48 b8 ab 56 80 00 00 	movabs $0x8056ab,%rax
+  805835:	00 00 00 
+  805838:	ff d0                	call   *%rax
+}
+  80583a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80583e:	c9                   	leave
+  80583f:	c3                   	ret
+
+0000000000805840 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805840:	55                   	push   %rbp
+  805841:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805844:	89 f6                	mov    %esi,%esi
+  805846:	48 b8 7a 31 80 00 00 	movabs $0x80317a,%rax
+  80584d:	00 00 00 
+  805850:	ff d0                	call   *%rax
+  805852:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805854:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805859:	ba 00 00 00 00       	mov    $0x0,%edx
+  80585e:	be 00 00 00 00       	mov    $0x0,%esi
+  805863:	48 b8 ab 56 80 00 00 	movabs $0x8056ab,%rax
+  80586a:	00 00 00 
+  80586d:	ff d0                	call   *%rax
+}
+  80586f:	5d                   	pop    %rbp
+  805870:	c3                   	ret
+
+0000000000805871 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805871:	55                   	push   %rbp
+  805872:	48 89 e5             	mov    %rsp,%rbp
+  805875:	41 54                	push   %r12
+  805877:	53                   	push   %rbx
+  805878:	4c 89 cb             	mov    %r9,%rbx
+  80587b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  80587f:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805883:	48 85 d2             	test   %rdx,%rdx
+  805886:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80588d:	00 00 00 
+  805890:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805894:	4d 85 c9             	test   %r9,%r9
+  805897:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80589b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058a0:	4d 85 e4             	test   %r12,%r12
+  8058a3:	74 04                	je     8058a9 <ipc_reply_wait+0x38>
+  8058a5:	49 8b 04 24          	mov    (%r12),%rax
+  8058a9:	89 f6                	mov    %esi,%esi
+  8058ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8058af:	50                   	push   %rax
+  8058b0:	48 b8 e4 31 80 00 00 	movabs $0x8031e4,%rax
+  8058b7:	00 00 00 
+  8058ba:	ff d0                	call   *%rax
+  8058bc:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8058be:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8058c2:	4c 89 e2             	mov    %r12,%rdx
+  8058c5:	48 89 de             	mov    %rbx,%rsi
+  8058c8:	48 b8 ab 56 80 00 00 	movabs $0x8056ab,%rax
+  8058cf:	00 00 00 
+  8058d2:	ff d0                	call   *%rax
+}
+  8058d4:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8058d8:	5b                   	pop    %rbx
+  8058d9:	41 5c                	pop    %r12
+  8058db:	5d                   	pop    %rbp
+  8058dc:	c3                   	ret
+
+00000000008058dd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8058dd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8058e2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8058e9:	00 00 00 
+  8058ec:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8058f3:	48 01 ca             	add    %rcx,%rdx
+  8058f6:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8058fc:	39 fa                	cmp    %edi,%edx
+  8058fe:	74 12                	je     805912 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805900:	48 83 c0 01          	add    $0x1,%rax
+  805904:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80590a:	75 e0                	jne    8058ec <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80590c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805911:	c3                   	ret
+            return envs[i].env_id;
+  805912:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805919:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805920:	00 00 00 
+  805923:	48 01 d0             	add    %rdx,%rax
+  805926:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80592c:	c3                   	ret
+  80592d:	0f 1f 00             	nopl   (%rax)
+
+0000000000805930 <__rodata_start>:
+  805930:	77 00                	ja     805932 <__rodata_start+0x2>
+  805932:	72 62                	jb     805996 <__rodata_start+0x66>
+  805934:	00 77 62             	add    %dh,0x62(%rdi)
+  805937:	00 0f                	add    %cl,(%rdi)
+  805939:	1f                   	(bad)
+  80593a:	84 00                	test   %al,(%rax)
+  80593c:	00 00                	add    %al,(%rax)
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	b3 09                	mov    $0x9,%bl
+  805942:	80 00 00             	addb   $0x0,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 ed                	add    %ch,%ch
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 ed                	add    %ch,%ch
+  805971:	0d 80 00 00 00       	or     $0x80,%eax
+  805976:	00 00                	add    %al,(%rax)
+  805978:	ed                   	in     (%dx),%eax
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	8c 0a                	mov    %cs,(%rdx)
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059a6:	00 00                	add    %al,(%rax)
+  8059a8:	8c 0a                	mov    %cs,(%rdx)
+  8059aa:	80 00 00             	addb   $0x0,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	8c 0a                	mov    %cs,(%rdx)
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	8c 0a                	mov    %cs,(%rdx)
+  8059ca:	80 00 00             	addb   $0x0,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059d6:	00 00                	add    %al,(%rax)
+  8059d8:	8c 0a                	mov    %cs,(%rdx)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8059e6:	00 00                	add    %al,(%rax)
+  8059e8:	ed                   	in     (%dx),%eax
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	ed                   	in     (%dx),%eax
+  8059f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059f6:	00 00                	add    %al,(%rax)
+  8059f8:	ed                   	in     (%dx),%eax
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ed                   	in     (%dx),%eax
+  805a01:	0d 80 00 00 00       	or     $0x80,%eax
+  805a06:	00 00                	add    %al,(%rax)
+  805a08:	ed                   	in     (%dx),%eax
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	ed                   	in     (%dx),%eax
+  805a19:	0d 80 00 00 00       	or     $0x80,%eax
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	ed                   	in     (%dx),%eax
+  805a21:	0d 80 00 00 00       	or     $0x80,%eax
+  805a26:	00 00                	add    %al,(%rax)
+  805a28:	ed                   	in     (%dx),%eax
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	ed                   	in     (%dx),%eax
+  805a49:	0d 80 00 00 00       	or     $0x80,%eax
+  805a4e:	00 00                	add    %al,(%rax)
+  805a50:	ed                   	in     (%dx),%eax
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	ed                   	in     (%dx),%eax
+  805a79:	0d 80 00 00 00       	or     $0x80,%eax
+  805a7e:	00 00                	add    %al,(%rax)
+  805a80:	ed                   	in     (%dx),%eax
+  805a81:	0d 80 00 00 00       	or     $0x80,%eax
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	ed                   	in     (%dx),%eax
+  805a89:	0d 80 00 00 00       	or     $0x80,%eax
+  805a8e:	00 00                	add    %al,(%rax)
+  805a90:	ed                   	in     (%dx),%eax
+  805a91:	0d 80 00 00 00       	or     $0x80,%eax
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	ed                   	in     (%dx),%eax
+  805a99:	0d 80 00 00 00       	or     $0x80,%eax
+  805a9e:	00 00                	add    %al,(%rax)
+  805aa0:	ed                   	in     (%dx),%eax
+  805aa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	ed                   	in     (%dx),%eax
+  805aa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aae:	00 00                	add    %al,(%rax)
+  805ab0:	ed                   	in     (%dx),%eax
+  805ab1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	ed                   	in     (%dx),%eax
+  805ab9:	0d 80 00 00 00       	or     $0x80,%eax
+  805abe:	00 00                	add    %al,(%rax)
+  805ac0:	ed                   	in     (%dx),%eax
+  805ac1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	f4                   	hlt
+  805ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805adf:	00 ed                	add    %ch,%ch
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	2c 0b                	sub    $0xb,%al
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 ed                	add    %ch,%ch
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805b33:	00 00                	add    %al,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 cb                	add    %cl,%bl
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	6a 0a                	push   $0xa
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 ed                	add    %ch,%ch
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	3c 0a                	cmp    $0xa,%al
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 ed                	add    %ch,%ch
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805b8b:	00 00                	add    %al,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 29                	add    %ch,(%rcx)
+  805b99:	0c 80                	or     $0x80,%al
+  805b9b:	00 00                	add    %al,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 ed                	add    %ch,%ch
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	1a 0b                	sbb    (%rbx),%cl
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 ed                	add    %ch,%ch
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ce                   	(bad)
+  805bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805bc7:	00 ed                	add    %ch,%ch
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	f4                   	hlt
+  805bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805bdf:	00 37                	add    %dh,(%rdi)
+  805be1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805be7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 37                	add    %dh,(%rdi)
+  805bf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805c0b:	00 00                	add    %al,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 d2                	add    %dl,%dl
+  805c11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c17:	00 d2                	add    %dl,%dl
+  805c19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c1f:	00 d2                	add    %dl,%dl
+  805c21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c27:	00 d2                	add    %dl,%dl
+  805c29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c2f:	00 d2                	add    %dl,%dl
+  805c31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c37:	00 d2                	add    %dl,%dl
+  805c39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c3f:	00 d2                	add    %dl,%dl
+  805c41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c47:	00 f6                	add    %dh,%dh
+  805c49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c4f:	00 f6                	add    %dh,%dh
+  805c51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 22                	add    %ah,(%rdx)
+  805c91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c97:	00 22                	add    %ah,(%rdx)
+  805c99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805c9f:	00 22                	add    %ah,(%rdx)
+  805ca1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ca7:	00 22                	add    %ah,(%rdx)
+  805ca9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805caf:	00 22                	add    %ah,(%rdx)
+  805cb1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cb7:	00 22                	add    %ah,(%rdx)
+  805cb9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cea:	80 00 00             	addb   $0x0,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d22:	80 00 00             	addb   $0x0,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 46 12             	add    %al,0x12(%rsi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d72:	80 00 00             	addb   $0x0,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d7a:	80 00 00             	addb   $0x0,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 22                	add    %ah,(%rdx)
+  805d91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d97:	00 22                	add    %ah,(%rdx)
+  805d99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d9f:	00 22                	add    %ah,(%rdx)
+  805da1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805da7:	00 22                	add    %ah,(%rdx)
+  805da9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805daf:	00 22                	add    %ah,(%rdx)
+  805db1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805db7:	00 22                	add    %ah,(%rdx)
+  805db9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 46 12             	add    %al,0x12(%rsi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805e60 <basefix.0>:
+  805e60:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805e70:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805e80:	10 00 6f 70 65 6e 63 6f 6e 73 3a 20 25 69 00 75     ..opencons: %i.u
+  805e90:	73 65 72 2f 74 65 73 74 6b 62 64 2e 63 00 66 69     ser/testkbd.c.fi
+  805ea0:	72 73 74 20 6f 70 65 6e 63 6f 6e 73 20 75 73 65     rst opencons use
+  805eb0:	64 20 66 64 20 25 64 00 64 75 70 3a 20 25 69 00     d fd %d.dup: %i.
+  805ec0:	54 79 70 65 20 61 20 6c 69 6e 65 3a 20 00 25 73     Type a line: .%s
+  805ed0:	0a 00 28 65 6e 64 20 6f 66 20 66 69 6c 65 20 72     ..(end of file r
+  805ee0:	65 63 65 69 76 65 64 29 0a 00 3c 63 6f 6e 73 3e     eceived)..<cons>
+  805ef0:	00 63 6f 6e 73 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     .cons.<unknown>.
+  805f00:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805f10:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805f20:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  805f30:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  805f40:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  805f50:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  805f60:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  805f70:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  805f80:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  805f90:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  805fa0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  805fb0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  805fc0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  805fd0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  805fe0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  805ff0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806000:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806010:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806020:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806030:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806040:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806050:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806060:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806070:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806080:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806090:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8060a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8060b0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  8060c0:	16 1d 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     ........m#......
+  8060d0:	5d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     ]#......m#......
+  8060e0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8060f0:	6d 23 80 00 00 00 00 00 35 1d 80 00 00 00 00 00     m#......5.......
+  806100:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806110:	29 1d 80 00 00 00 00 00 a3 1d 80 00 00 00 00 00     )...............
+  806120:	6d 23 80 00 00 00 00 00 29 1d 80 00 00 00 00 00     m#......).......
+  806130:	6f 1d 80 00 00 00 00 00 6f 1d 80 00 00 00 00 00     o.......o.......
+  806140:	6f 1d 80 00 00 00 00 00 6f 1d 80 00 00 00 00 00     o.......o.......
+  806150:	6f 1d 80 00 00 00 00 00 6f 1d 80 00 00 00 00 00     o.......o.......
+  806160:	6f 1d 80 00 00 00 00 00 6f 1d 80 00 00 00 00 00     o.......o.......
+  806170:	6f 1d 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     o.......m#......
+  806180:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806190:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061a0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061b0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061c0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061d0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061e0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8061f0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806200:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806210:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806220:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806230:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806240:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806250:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806260:	6d 23 80 00 00 00 00 00 8b 22 80 00 00 00 00 00     m#......."......
+  806270:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806280:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806290:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8062a0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8062b0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8062c0:	d1 1d 80 00 00 00 00 00 a0 1f 80 00 00 00 00 00     ................
+  8062d0:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  8062e0:	6d 23 80 00 00 00 00 00 c6 1d 80 00 00 00 00 00     m#..............
+  8062f0:	00 1e 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     ........m#......
+  806300:	6d 23 80 00 00 00 00 00 bb 1d 80 00 00 00 00 00     m#..............
+  806310:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806320:	49 21 80 00 00 00 00 00 18 22 80 00 00 00 00 00     I!......."......
+  806330:	6d 23 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     m#......m#......
+  806340:	97 1e 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     ........m#......
+  806350:	74 20 80 00 00 00 00 00 6d 23 80 00 00 00 00 00     t ......m#......
+  806360:	6d 23 80 00 00 00 00 00 8b 22 80 00 00 00 00 00     m#......."......
+  806370:	6d 23 80 00 00 00 00 00 1f 1d 80 00 00 00 00 00     m#..............
+
+0000000000806380 <error_string>:
+	...
+  806388:	55 5f 80 00 00 00 00 00 67 5f 80 00 00 00 00 00     U_......g_......
+  806398:	77 5f 80 00 00 00 00 00 89 5f 80 00 00 00 00 00     w_......._......
+  8063a8:	97 5f 80 00 00 00 00 00 ab 5f 80 00 00 00 00 00     ._......._......
+  8063b8:	c0 5f 80 00 00 00 00 00 d3 5f 80 00 00 00 00 00     ._......._......
+  8063c8:	e5 5f 80 00 00 00 00 00 f9 5f 80 00 00 00 00 00     ._......._......
+  8063d8:	09 60 80 00 00 00 00 00 1c 60 80 00 00 00 00 00     .`.......`......
+  8063e8:	33 60 80 00 00 00 00 00 49 60 80 00 00 00 00 00     3`......I`......
+  8063f8:	61 60 80 00 00 00 00 00 79 60 80 00 00 00 00 00     a`......y`......
+  806408:	86 60 80 00 00 00 00 00 20 64 80 00 00 00 00 00     .`...... d......
+  806418:	9a 60 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .`......file is 
+  806428:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806438:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 72     utable..;!?....r
+  806448:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 90     ead error: %i...
+  806458:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806468:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806478:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806488:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806498:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8064a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8064b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8064c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8064d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8064e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8064f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806508:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806518:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000806520 <devtab>:
+  806520:	80 70 80 00 00 00 00 00 c0 70 80 00 00 00 00 00     .p.......p......
+  806530:	40 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     @p..............
+  806540:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806550:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806560:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806570:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806580:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806590:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8065a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8065b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8065c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8065d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8065e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8065f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806600:	3d 3d 20 30 00 0f 1f 00 55 73 65 72 73 70 61 63     == 0....Userspac
+  806610:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806620:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806630:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806640:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806650:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806660:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806670:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806680:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
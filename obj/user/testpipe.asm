@@ -0,0 +1,10767 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be b7 64 80 00 00 	movabs $0x8064b7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 90 5d 80 00 00 	movabs $0x805d90,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 92 5d 80 00 00 	movabs $0x805d92,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 95 5d 80 00 00 	movabs $0x805d95,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 79 51 80 00 00 	movabs $0x805179,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 50 54 80 00 00 	movabs $0x805450,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 d6 39 80 00 00 	movabs $0x8039d6,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 9f 3a 80 00 00 	movabs $0x803a9f,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 a5 39 80 00 00 	movabs $0x8039a5,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 bd 37 80 00 00 	movabs $0x8037bd,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 46 27 80 00 00 	movabs $0x802746,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be a0 5d 80 00 00 	movabs $0x805da0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 46 27 80 00 00 	movabs $0x802746,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 79 27 80 00 00 	movabs $0x802779,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 46 27 80 00 00 	movabs $0x802746,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 40 60 80 00 00 	movabs $0x806040,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 46 27 80 00 00 	movabs $0x802746,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 46 27 80 00 00 	movabs $0x802746,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 c0 62 80 00 00 	movabs $0x8062c0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 c0 62 80 00 00 	movabs $0x8062c0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 85 04 00 00       	call   801984 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  801512:	48 b8 e2 62 80 00 00 	movabs $0x8062e2,%rax
+  801519:	00 00 00 
+  80151c:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  801523:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  801526:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  80152d:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  801534:	00 00 00 
+  801537:	ff d0                	call   *%rax
+  801539:	41 89 c4             	mov    %eax,%r12d
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	0f 88 b3 01 00 00    	js     8016f7 <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  801544:	48 b8 9a 32 80 00 00 	movabs $0x80329a,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+  801550:	89 c3                	mov    %eax,%ebx
+  801552:	85 c0                	test   %eax,%eax
+  801554:	0f 88 ca 01 00 00    	js     801724 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80155a:	0f 85 49 02 00 00    	jne    8017a9 <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  801560:	49 bd 20 80 80 01 00 	movabs $0x1808020,%r13
+  801567:	00 00 00 
+  80156a:	49 8b 45 00          	mov    0x0(%r13),%rax
+  80156e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801574:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80157a:	48 bf 07 63 80 00 00 	movabs $0x806307,%rdi
+  801581:	00 00 00 
+  801584:	b8 00 00 00 00       	mov    $0x0,%eax
+  801589:	49 bc a0 1b 80 00 00 	movabs $0x801ba0,%r12
+  801590:	00 00 00 
+  801593:	41 ff d4             	call   *%r12
+        close(p[1]);
+  801596:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80159c:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8015a8:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8015ac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8015b2:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8015b8:	48 bf 24 63 80 00 00 	movabs $0x806324,%rdi
+  8015bf:	00 00 00 
+  8015c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c7:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8015ca:	ba 63 00 00 00       	mov    $0x63,%edx
+  8015cf:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8015d6:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8015dc:	48 b8 7b 38 80 00 00 	movabs $0x80387b,%rax
+  8015e3:	00 00 00 
+  8015e6:	ff d0                	call   *%rax
+  8015e8:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  8015eb:	85 c0                	test   %eax,%eax
+  8015ed:	0f 88 5f 01 00 00    	js     801752 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  8015f3:	48 98                	cltq
+  8015f5:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  8015fc:	00 
+        if (strcmp(buf, msg) == 0)
+  8015fd:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801604:	00 00 00 
+  801607:	48 8b 30             	mov    (%rax),%rsi
+  80160a:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  801611:	48 b8 99 25 80 00 00 	movabs $0x802599,%rax
+  801618:	00 00 00 
+  80161b:	ff d0                	call   *%rax
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	0f 85 5a 01 00 00    	jne    80177f <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  801625:	48 bf 4a 63 80 00 00 	movabs $0x80634a,%rdi
+  80162c:	00 00 00 
+  80162f:	48 ba a0 1b 80 00 00 	movabs $0x801ba0,%rdx
+  801636:	00 00 00 
+  801639:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80163b:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  801647:	89 df                	mov    %ebx,%edi
+  801649:	48 b8 c6 48 80 00 00 	movabs $0x8048c6,%rax
+  801650:	00 00 00 
+  801653:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  801655:	48 b8 a0 63 80 00 00 	movabs $0x8063a0,%rax
+  80165c:	00 00 00 
+  80165f:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  801666:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  801669:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  801670:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  801677:	00 00 00 
+  80167a:	ff d0                	call   *%rax
+  80167c:	41 89 c4             	mov    %eax,%r12d
+  80167f:	85 c0                	test   %eax,%eax
+  801681:	0f 88 1a 02 00 00    	js     8018a1 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  801687:	48 b8 9a 32 80 00 00 	movabs $0x80329a,%rax
+  80168e:	00 00 00 
+  801691:	ff d0                	call   *%rax
+  801693:	89 c3                	mov    %eax,%ebx
+  801695:	85 c0                	test   %eax,%eax
+  801697:	0f 88 31 02 00 00    	js     8018ce <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80169d:	0f 84 59 02 00 00    	je     8018fc <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8016a3:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8016a9:	49 bc 3f 36 80 00 00 	movabs $0x80363f,%r12
+  8016b0:	00 00 00 
+  8016b3:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8016b6:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8016bc:	41 ff d4             	call   *%r12
+    wait(pid);
+  8016bf:	89 df                	mov    %ebx,%edi
+  8016c1:	48 b8 c6 48 80 00 00 	movabs $0x8048c6,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8016cd:	48 bf cc 63 80 00 00 	movabs $0x8063cc,%rdi
+  8016d4:	00 00 00 
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	48 ba a0 1b 80 00 00 	movabs $0x801ba0,%rdx
+  8016e3:	00 00 00 
+  8016e6:	ff d2                	call   *%rdx
+}
+  8016e8:	48 83 c4 78          	add    $0x78,%rsp
+  8016ec:	5b                   	pop    %rbx
+  8016ed:	41 5c                	pop    %r12
+  8016ef:	41 5d                	pop    %r13
+  8016f1:	41 5e                	pop    %r14
+  8016f3:	41 5f                	pop    %r15
+  8016f5:	5d                   	pop    %rbp
+  8016f6:	c3                   	ret
+        panic("pipe: %i", i);
+  8016f7:	89 c1                	mov    %eax,%ecx
+  8016f9:	48 ba ee 62 80 00 00 	movabs $0x8062ee,%rdx
+  801700:	00 00 00 
+  801703:	be 0d 00 00 00       	mov    $0xd,%esi
+  801708:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  80170f:	00 00 00 
+  801712:	b8 00 00 00 00       	mov    $0x0,%eax
+  801717:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  80171e:	00 00 00 
+  801721:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  801724:	44 89 e1             	mov    %r12d,%ecx
+  801727:	48 ba bc 69 80 00 00 	movabs $0x8069bc,%rdx
+  80172e:	00 00 00 
+  801731:	be 10 00 00 00       	mov    $0x10,%esi
+  801736:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  80173d:	00 00 00 
+  801740:	b8 00 00 00 00       	mov    $0x0,%eax
+  801745:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  80174c:	00 00 00 
+  80174f:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  801752:	89 c1                	mov    %eax,%ecx
+  801754:	48 ba 41 63 80 00 00 	movabs $0x806341,%rdx
+  80175b:	00 00 00 
+  80175e:	be 18 00 00 00       	mov    $0x18,%esi
+  801763:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  80176a:	00 00 00 
+  80176d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801772:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  801779:	00 00 00 
+  80177c:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  80177f:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  801786:	44 89 e6             	mov    %r12d,%esi
+  801789:	48 bf 66 63 80 00 00 	movabs $0x806366,%rdi
+  801790:	00 00 00 
+  801793:	b8 00 00 00 00       	mov    $0x0,%eax
+  801798:	48 b9 a0 1b 80 00 00 	movabs $0x801ba0,%rcx
+  80179f:	00 00 00 
+  8017a2:	ff d1                	call   *%rcx
+  8017a4:	e9 92 fe ff ff       	jmp    80163b <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8017a9:	49 bd 20 80 80 01 00 	movabs $0x1808020,%r13
+  8017b0:	00 00 00 
+  8017b3:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8017b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017bd:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8017c3:	48 bf 07 63 80 00 00 	movabs $0x806307,%rdi
+  8017ca:	00 00 00 
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	49 bc a0 1b 80 00 00 	movabs $0x801ba0,%r12
+  8017d9:	00 00 00 
+  8017dc:	41 ff d4             	call   *%r12
+        close(p[0]);
+  8017df:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8017e5:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  8017ec:	00 00 00 
+  8017ef:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8017f1:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8017f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017fb:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  801801:	48 bf 79 63 80 00 00 	movabs $0x806379,%rdi
+  801808:	00 00 00 
+  80180b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801810:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  801813:	49 bd 38 70 80 00 00 	movabs $0x807038,%r13
+  80181a:	00 00 00 
+  80181d:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  801821:	49 bf 99 24 80 00 00 	movabs $0x802499,%r15
+  801828:	00 00 00 
+  80182b:	41 ff d7             	call   *%r15
+  80182e:	48 89 c2             	mov    %rax,%rdx
+  801831:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  801835:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80183b:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  801842:	00 00 00 
+  801845:	ff d0                	call   *%rax
+  801847:	49 89 c4             	mov    %rax,%r12
+  80184a:	41 89 c6             	mov    %eax,%r14d
+  80184d:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  801851:	41 ff d7             	call   *%r15
+  801854:	4d 63 e4             	movslq %r12d,%r12
+  801857:	49 39 c4             	cmp    %rax,%r12
+  80185a:	75 17                	jne    801873 <umain+0x372>
+        close(p[1]);
+  80185c:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  801862:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  801869:	00 00 00 
+  80186c:	ff d0                	call   *%rax
+  80186e:	e9 d4 fd ff ff       	jmp    801647 <umain+0x146>
+            panic("write: %i", i);
+  801873:	44 89 f1             	mov    %r14d,%ecx
+  801876:	48 ba 96 63 80 00 00 	movabs $0x806396,%rdx
+  80187d:	00 00 00 
+  801880:	be 24 00 00 00       	mov    $0x24,%esi
+  801885:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  80188c:	00 00 00 
+  80188f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801894:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  80189b:	00 00 00 
+  80189e:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8018a1:	89 c1                	mov    %eax,%ecx
+  8018a3:	48 ba ee 62 80 00 00 	movabs $0x8062ee,%rdx
+  8018aa:	00 00 00 
+  8018ad:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8018b2:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  8018b9:	00 00 00 
+  8018bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c1:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  8018c8:	00 00 00 
+  8018cb:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8018ce:	44 89 e1             	mov    %r12d,%ecx
+  8018d1:	48 ba bc 69 80 00 00 	movabs $0x8069bc,%rdx
+  8018d8:	00 00 00 
+  8018db:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8018e0:	48 bf f7 62 80 00 00 	movabs $0x8062f7,%rdi
+  8018e7:	00 00 00 
+  8018ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ef:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  8018f6:	00 00 00 
+  8018f9:	41 ff d0             	call   *%r8
+        close(p[0]);
+  8018fc:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  801902:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+            cprintf(".");
+  80190e:	49 bf 85 69 80 00 00 	movabs $0x806985,%r15
+  801915:	00 00 00 
+  801918:	49 be a0 1b 80 00 00 	movabs $0x801ba0,%r14
+  80191f:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  801922:	49 bd ad 63 80 00 00 	movabs $0x8063ad,%r13
+  801929:	00 00 00 
+  80192c:	49 bc ec 38 80 00 00 	movabs $0x8038ec,%r12
+  801933:	00 00 00 
+            cprintf(".");
+  801936:	4c 89 ff             	mov    %r15,%rdi
+  801939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193e:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  801941:	ba 01 00 00 00       	mov    $0x1,%edx
+  801946:	4c 89 ee             	mov    %r13,%rsi
+  801949:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80194f:	41 ff d4             	call   *%r12
+  801952:	48 83 f8 01          	cmp    $0x1,%rax
+  801956:	74 de                	je     801936 <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  801958:	48 bf af 63 80 00 00 	movabs $0x8063af,%rdi
+  80195f:	00 00 00 
+  801962:	b8 00 00 00 00       	mov    $0x0,%eax
+  801967:	48 ba a0 1b 80 00 00 	movabs $0x801ba0,%rdx
+  80196e:	00 00 00 
+  801971:	ff d2                	call   *%rdx
+        exit();
+  801973:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+  80197f:	e9 1f fd ff ff       	jmp    8016a3 <umain+0x1a2>
+
+0000000000801984 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801984:	55                   	push   %rbp
+  801985:	48 89 e5             	mov    %rsp,%rbp
+  801988:	41 56                	push   %r14
+  80198a:	41 55                	push   %r13
+  80198c:	41 54                	push   %r12
+  80198e:	53                   	push   %rbx
+  80198f:	41 89 fd             	mov    %edi,%r13d
+  801992:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801995:	48 ba 18 71 80 00 00 	movabs $0x807118,%rdx
+  80199c:	00 00 00 
+  80199f:	48 b8 18 71 80 00 00 	movabs $0x807118,%rax
+  8019a6:	00 00 00 
+  8019a9:	48 39 c2             	cmp    %rax,%rdx
+  8019ac:	73 17                	jae    8019c5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8019ae:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8019b1:	49 89 c4             	mov    %rax,%r12
+  8019b4:	48 83 c3 08          	add    $0x8,%rbx
+  8019b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bd:	ff 53 f8             	call   *-0x8(%rbx)
+  8019c0:	4c 39 e3             	cmp    %r12,%rbx
+  8019c3:	72 ef                	jb     8019b4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8019c5:	48 b8 64 2b 80 00 00 	movabs $0x802b64,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+  8019d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019d6:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8019dd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019e4:	00 00 00 
+  8019e7:	48 01 d0             	add    %rdx,%rax
+  8019ea:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8019f1:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8019f4:	45 85 ed             	test   %r13d,%r13d
+  8019f7:	7e 0d                	jle    801a06 <libmain+0x82>
+  8019f9:	49 8b 06             	mov    (%r14),%rax
+  8019fc:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  801a03:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801a06:	4c 89 f6             	mov    %r14,%rsi
+  801a09:	44 89 ef             	mov    %r13d,%edi
+  801a0c:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801a13:	00 00 00 
+  801a16:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801a18:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  801a1f:	00 00 00 
+  801a22:	ff d0                	call   *%rax
+#endif
+}
+  801a24:	5b                   	pop    %rbx
+  801a25:	41 5c                	pop    %r12
+  801a27:	41 5d                	pop    %r13
+  801a29:	41 5e                	pop    %r14
+  801a2b:	5d                   	pop    %rbp
+  801a2c:	c3                   	ret
+
+0000000000801a2d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801a2d:	55                   	push   %rbp
+  801a2e:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801a31:	48 b8 72 36 80 00 00 	movabs $0x803672,%rax
+  801a38:	00 00 00 
+  801a3b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801a3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a42:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  801a49:	00 00 00 
+  801a4c:	ff d0                	call   *%rax
+}
+  801a4e:	5d                   	pop    %rbp
+  801a4f:	c3                   	ret
+
+0000000000801a50 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801a50:	55                   	push   %rbp
+  801a51:	48 89 e5             	mov    %rsp,%rbp
+  801a54:	41 56                	push   %r14
+  801a56:	41 55                	push   %r13
+  801a58:	41 54                	push   %r12
+  801a5a:	53                   	push   %rbx
+  801a5b:	48 83 ec 50          	sub    $0x50,%rsp
+  801a5f:	49 89 fc             	mov    %rdi,%r12
+  801a62:	41 89 f5             	mov    %esi,%r13d
+  801a65:	48 89 d3             	mov    %rdx,%rbx
+  801a68:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801a6c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801a70:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801a74:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801a7b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a7f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801a83:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801a87:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801a8b:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  801a92:	00 00 00 
+  801a95:	4c 8b 30             	mov    (%rax),%r14
+  801a98:	48 b8 64 2b 80 00 00 	movabs $0x802b64,%rax
+  801a9f:	00 00 00 
+  801aa2:	ff d0                	call   *%rax
+  801aa4:	89 c6                	mov    %eax,%esi
+  801aa6:	45 89 e8             	mov    %r13d,%r8d
+  801aa9:	4c 89 e1             	mov    %r12,%rcx
+  801aac:	4c 89 f2             	mov    %r14,%rdx
+  801aaf:	48 bf 30 64 80 00 00 	movabs $0x806430,%rdi
+  801ab6:	00 00 00 
+  801ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abe:	49 bc a0 1b 80 00 00 	movabs $0x801ba0,%r12
+  801ac5:	00 00 00 
+  801ac8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801acb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801acf:	48 89 df             	mov    %rbx,%rdi
+  801ad2:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  801ad9:	00 00 00 
+  801adc:	ff d0                	call   *%rax
+    cprintf("\n");
+  801ade:	48 bf 22 63 80 00 00 	movabs $0x806322,%rdi
+  801ae5:	00 00 00 
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801af0:	cc                   	int3
+  801af1:	eb fd                	jmp    801af0 <_panic+0xa0>
+
+0000000000801af3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801af3:	55                   	push   %rbp
+  801af4:	48 89 e5             	mov    %rsp,%rbp
+  801af7:	53                   	push   %rbx
+  801af8:	48 83 ec 08          	sub    $0x8,%rsp
+  801afc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801aff:	8b 06                	mov    (%rsi),%eax
+  801b01:	8d 50 01             	lea    0x1(%rax),%edx
+  801b04:	89 16                	mov    %edx,(%rsi)
+  801b06:	48 98                	cltq
+  801b08:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801b0d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801b13:	74 0a                	je     801b1f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801b15:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801b19:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801b1f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801b23:	be ff 00 00 00       	mov    $0xff,%esi
+  801b28:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+        state->offset = 0;
+  801b34:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801b3a:	eb d9                	jmp    801b15 <putch+0x22>
+
+0000000000801b3c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801b3c:	55                   	push   %rbp
+  801b3d:	48 89 e5             	mov    %rsp,%rbp
+  801b40:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801b47:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801b4a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801b51:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801b56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801b5e:	48 89 f1             	mov    %rsi,%rcx
+  801b61:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801b68:	48 bf f3 1a 80 00 00 	movabs $0x801af3,%rdi
+  801b6f:	00 00 00 
+  801b72:	48 b8 f0 1c 80 00 00 	movabs $0x801cf0,%rax
+  801b79:	00 00 00 
+  801b7c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801b7e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801b85:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801b8c:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  801b93:	00 00 00 
+  801b96:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801b98:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+
+0000000000801ba0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801ba0:	55                   	push   %rbp
+  801ba1:	48 89 e5             	mov    %rsp,%rbp
+  801ba4:	48 83 ec 50          	sub    $0x50,%rsp
+  801ba8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801bac:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801bb0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801bb4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801bb8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801bbc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801bc3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bcb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801bcf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801bd3:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801bd7:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801be3:	c9                   	leave
+  801be4:	c3                   	ret
+
+0000000000801be5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	41 57                	push   %r15
+  801beb:	41 56                	push   %r14
+  801bed:	41 55                	push   %r13
+  801bef:	41 54                	push   %r12
+  801bf1:	53                   	push   %rbx
+  801bf2:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf6:	49 89 fc             	mov    %rdi,%r12
+  801bf9:	49 89 f5             	mov    %rsi,%r13
+  801bfc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c00:	8b 45 10             	mov    0x10(%rbp),%eax
+  801c03:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801c06:	41 89 cf             	mov    %ecx,%r15d
+  801c09:	4c 39 fa             	cmp    %r15,%rdx
+  801c0c:	73 5b                	jae    801c69 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801c0e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801c12:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801c16:	85 db                	test   %ebx,%ebx
+  801c18:	7e 0e                	jle    801c28 <print_num+0x43>
+            putch(padc, put_arg);
+  801c1a:	4c 89 ee             	mov    %r13,%rsi
+  801c1d:	44 89 f7             	mov    %r14d,%edi
+  801c20:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801c23:	83 eb 01             	sub    $0x1,%ebx
+  801c26:	75 f2                	jne    801c1a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801c28:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801c2c:	48 b9 64 64 80 00 00 	movabs $0x806464,%rcx
+  801c33:	00 00 00 
+  801c36:	48 b8 53 64 80 00 00 	movabs $0x806453,%rax
+  801c3d:	00 00 00 
+  801c40:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801c44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	49 f7 f7             	div    %r15
+  801c50:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801c54:	4c 89 ee             	mov    %r13,%rsi
+  801c57:	41 ff d4             	call   *%r12
+}
+  801c5a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801c5e:	5b                   	pop    %rbx
+  801c5f:	41 5c                	pop    %r12
+  801c61:	41 5d                	pop    %r13
+  801c63:	41 5e                	pop    %r14
+  801c65:	41 5f                	pop    %r15
+  801c67:	5d                   	pop    %rbp
+  801c68:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801c69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c72:	49 f7 f7             	div    %r15
+  801c75:	48 83 ec 08          	sub    $0x8,%rsp
+  801c79:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801c7d:	52                   	push   %rdx
+  801c7e:	45 0f be c9          	movsbl %r9b,%r9d
+  801c82:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801c86:	48 89 c2             	mov    %rax,%rdx
+  801c89:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  801c90:	00 00 00 
+  801c93:	ff d0                	call   *%rax
+  801c95:	48 83 c4 10          	add    $0x10,%rsp
+  801c99:	eb 8d                	jmp    801c28 <print_num+0x43>
+
+0000000000801c9b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801c9b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801c9f:	48 8b 06             	mov    (%rsi),%rax
+  801ca2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801ca6:	73 0a                	jae    801cb2 <sprintputch+0x17>
+        *state->start++ = ch;
+  801ca8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cac:	48 89 16             	mov    %rdx,(%rsi)
+  801caf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801cb2:	c3                   	ret
+
+0000000000801cb3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801cb3:	55                   	push   %rbp
+  801cb4:	48 89 e5             	mov    %rsp,%rbp
+  801cb7:	48 83 ec 50          	sub    $0x50,%rsp
+  801cbb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801cbf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801cc3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801cc7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801cce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801cd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cd6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801cda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801cde:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ce2:	48 b8 f0 1c 80 00 00 	movabs $0x801cf0,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+}
+  801cee:	c9                   	leave
+  801cef:	c3                   	ret
+
+0000000000801cf0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801cf0:	55                   	push   %rbp
+  801cf1:	48 89 e5             	mov    %rsp,%rbp
+  801cf4:	41 57                	push   %r15
+  801cf6:	41 56                	push   %r14
+  801cf8:	41 55                	push   %r13
+  801cfa:	41 54                	push   %r12
+  801cfc:	53                   	push   %rbx
+  801cfd:	48 83 ec 38          	sub    $0x38,%rsp
+  801d01:	49 89 fe             	mov    %rdi,%r14
+  801d04:	49 89 f5             	mov    %rsi,%r13
+  801d07:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801d0a:	48 8b 01             	mov    (%rcx),%rax
+  801d0d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801d11:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801d15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d19:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801d1d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801d21:	eb 0d                	jmp    801d30 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801d23:	40 0f b6 ff          	movzbl %dil,%edi
+  801d27:	4c 89 ee             	mov    %r13,%rsi
+  801d2a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801d2d:	4c 89 e3             	mov    %r12,%rbx
+  801d30:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801d34:	0f b6 3b             	movzbl (%rbx),%edi
+  801d37:	40 80 ff 25          	cmp    $0x25,%dil
+  801d3b:	74 14                	je     801d51 <vprintfmt+0x61>
+            if (!ch) return;
+  801d3d:	40 84 ff             	test   %dil,%dil
+  801d40:	75 e1                	jne    801d23 <vprintfmt+0x33>
+}
+  801d42:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801d46:	5b                   	pop    %rbx
+  801d47:	41 5c                	pop    %r12
+  801d49:	41 5d                	pop    %r13
+  801d4b:	41 5e                	pop    %r14
+  801d4d:	41 5f                	pop    %r15
+  801d4f:	5d                   	pop    %rbp
+  801d50:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801d51:	be 00 00 00 00       	mov    $0x0,%esi
+  801d56:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801d5f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801d65:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801d6c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801d70:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801d75:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801d7a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801d7d:	83 e8 23             	sub    $0x23,%eax
+  801d80:	3c 57                	cmp    $0x57,%al
+  801d82:	0f 87 67 06 00 00    	ja     8023ef <vprintfmt+0x6ff>
+  801d88:	0f b6 c0             	movzbl %al,%eax
+  801d8b:	48 b9 00 66 80 00 00 	movabs $0x806600,%rcx
+  801d92:	00 00 00 
+  801d95:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801d98:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801d9b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801d9f:	eb cf                	jmp    801d70 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801da1:	49 89 dc             	mov    %rbx,%r12
+  801da4:	be 01 00 00 00       	mov    $0x1,%esi
+  801da9:	eb c5                	jmp    801d70 <vprintfmt+0x80>
+            padc = ch;
+  801dab:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801daf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801db2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801db5:	eb b9                	jmp    801d70 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801db7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dba:	83 f8 2f             	cmp    $0x2f,%eax
+  801dbd:	77 24                	ja     801de3 <vprintfmt+0xf3>
+  801dbf:	89 c1                	mov    %eax,%ecx
+  801dc1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801dc5:	83 c0 08             	add    $0x8,%eax
+  801dc8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dcb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801dce:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801dd1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801dd5:	79 99                	jns    801d70 <vprintfmt+0x80>
+                width = precision;
+  801dd7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801ddb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801de1:	eb 8d                	jmp    801d70 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801de3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801de7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801def:	eb da                	jmp    801dcb <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801df1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801df6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801dfa:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801e00:	3c 39                	cmp    $0x39,%al
+  801e02:	77 1c                	ja     801e20 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801e04:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801e08:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801e0c:	0f b6 c0             	movzbl %al,%eax
+  801e0f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801e14:	0f b6 03             	movzbl (%rbx),%eax
+  801e17:	3c 39                	cmp    $0x39,%al
+  801e19:	76 e9                	jbe    801e04 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801e1b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801e1e:	eb b1                	jmp    801dd1 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801e20:	49 89 dc             	mov    %rbx,%r12
+  801e23:	eb ac                	jmp    801dd1 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801e25:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801e28:	85 c9                	test   %ecx,%ecx
+  801e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2f:	0f 49 c1             	cmovns %ecx,%eax
+  801e32:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801e35:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e38:	e9 33 ff ff ff       	jmp    801d70 <vprintfmt+0x80>
+            lflag++;
+  801e3d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801e40:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e43:	e9 28 ff ff ff       	jmp    801d70 <vprintfmt+0x80>
+            lflag--;
+  801e48:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801e4b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801e4e:	e9 1d ff ff ff       	jmp    801d70 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801e53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e56:	83 f8 2f             	cmp    $0x2f,%eax
+  801e59:	77 19                	ja     801e74 <vprintfmt+0x184>
+  801e5b:	89 c2                	mov    %eax,%edx
+  801e5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e61:	83 c0 08             	add    $0x8,%eax
+  801e64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e67:	8b 3a                	mov    (%rdx),%edi
+  801e69:	4c 89 ee             	mov    %r13,%rsi
+  801e6c:	41 ff d6             	call   *%r14
+            break;
+  801e6f:	e9 bc fe ff ff       	jmp    801d30 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801e74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e80:	eb e5                	jmp    801e67 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801e82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e85:	83 f8 2f             	cmp    $0x2f,%eax
+  801e88:	77 5a                	ja     801ee4 <vprintfmt+0x1f4>
+  801e8a:	89 c2                	mov    %eax,%edx
+  801e8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e90:	83 c0 08             	add    $0x8,%eax
+  801e93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801e96:	8b 02                	mov    (%rdx),%eax
+  801e98:	89 c1                	mov    %eax,%ecx
+  801e9a:	f7 d9                	neg    %ecx
+  801e9c:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801e9f:	83 f9 13             	cmp    $0x13,%ecx
+  801ea2:	7f 4e                	jg     801ef2 <vprintfmt+0x202>
+  801ea4:	48 63 c1             	movslq %ecx,%rax
+  801ea7:	48 ba c0 68 80 00 00 	movabs $0x8068c0,%rdx
+  801eae:	00 00 00 
+  801eb1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801eb5:	48 85 c0             	test   %rax,%rax
+  801eb8:	74 38                	je     801ef2 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801eba:	48 89 c1             	mov    %rax,%rcx
+  801ebd:	48 ba 08 6b 80 00 00 	movabs $0x806b08,%rdx
+  801ec4:	00 00 00 
+  801ec7:	4c 89 ee             	mov    %r13,%rsi
+  801eca:	4c 89 f7             	mov    %r14,%rdi
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ed2:	49 b8 b3 1c 80 00 00 	movabs $0x801cb3,%r8
+  801ed9:	00 00 00 
+  801edc:	41 ff d0             	call   *%r8
+  801edf:	e9 4c fe ff ff       	jmp    801d30 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801ee4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ee8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ef0:	eb a4                	jmp    801e96 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801ef2:	48 ba 7c 64 80 00 00 	movabs $0x80647c,%rdx
+  801ef9:	00 00 00 
+  801efc:	4c 89 ee             	mov    %r13,%rsi
+  801eff:	4c 89 f7             	mov    %r14,%rdi
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f07:	49 b8 b3 1c 80 00 00 	movabs $0x801cb3,%r8
+  801f0e:	00 00 00 
+  801f11:	41 ff d0             	call   *%r8
+  801f14:	e9 17 fe ff ff       	jmp    801d30 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801f19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f1c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f1f:	77 6c                	ja     801f8d <vprintfmt+0x29d>
+  801f21:	89 c2                	mov    %eax,%edx
+  801f23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f27:	83 c0 08             	add    $0x8,%eax
+  801f2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f2d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801f30:	48 85 f6             	test   %rsi,%rsi
+  801f33:	48 b8 75 64 80 00 00 	movabs $0x806475,%rax
+  801f3a:	00 00 00 
+  801f3d:	48 0f 45 c6          	cmovne %rsi,%rax
+  801f41:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801f45:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801f49:	7e 06                	jle    801f51 <vprintfmt+0x261>
+  801f4b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801f4f:	75 4a                	jne    801f9b <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801f51:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801f55:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801f59:	0f b6 00             	movzbl (%rax),%eax
+  801f5c:	84 c0                	test   %al,%al
+  801f5e:	0f 85 9a 00 00 00    	jne    801ffe <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801f64:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801f67:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	0f 8e bd fd ff ff    	jle    801d30 <vprintfmt+0x40>
+  801f73:	4c 89 ee             	mov    %r13,%rsi
+  801f76:	bf 20 00 00 00       	mov    $0x20,%edi
+  801f7b:	41 ff d6             	call   *%r14
+  801f7e:	41 83 ec 01          	sub    $0x1,%r12d
+  801f82:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801f86:	75 eb                	jne    801f73 <vprintfmt+0x283>
+  801f88:	e9 a3 fd ff ff       	jmp    801d30 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801f8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f99:	eb 92                	jmp    801f2d <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801f9b:	49 63 f7             	movslq %r15d,%rsi
+  801f9e:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801fa2:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	48 89 c2             	mov    %rax,%rdx
+  801fb1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801fb4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801fb6:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801fb9:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801fbc:	85 c0                	test   %eax,%eax
+  801fbe:	7e 91                	jle    801f51 <vprintfmt+0x261>
+  801fc0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801fc5:	4c 89 ee             	mov    %r13,%rsi
+  801fc8:	44 89 e7             	mov    %r12d,%edi
+  801fcb:	41 ff d6             	call   *%r14
+  801fce:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801fd2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801fd5:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801fd8:	75 eb                	jne    801fc5 <vprintfmt+0x2d5>
+  801fda:	e9 72 ff ff ff       	jmp    801f51 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801fdf:	0f b6 f8             	movzbl %al,%edi
+  801fe2:	4c 89 ee             	mov    %r13,%rsi
+  801fe5:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801fe8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801fec:	49 83 c4 01          	add    $0x1,%r12
+  801ff0:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801ff6:	84 c0                	test   %al,%al
+  801ff8:	0f 84 66 ff ff ff    	je     801f64 <vprintfmt+0x274>
+  801ffe:	45 85 ff             	test   %r15d,%r15d
+  802001:	78 0a                	js     80200d <vprintfmt+0x31d>
+  802003:	41 83 ef 01          	sub    $0x1,%r15d
+  802007:	0f 88 57 ff ff ff    	js     801f64 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80200d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802011:	74 cc                	je     801fdf <vprintfmt+0x2ef>
+  802013:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802016:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80201b:	80 fa 5e             	cmp    $0x5e,%dl
+  80201e:	77 c2                	ja     801fe2 <vprintfmt+0x2f2>
+  802020:	eb bd                	jmp    801fdf <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  802022:	40 84 f6             	test   %sil,%sil
+  802025:	75 26                	jne    80204d <vprintfmt+0x35d>
+    switch (lflag) {
+  802027:	85 d2                	test   %edx,%edx
+  802029:	74 59                	je     802084 <vprintfmt+0x394>
+  80202b:	83 fa 01             	cmp    $0x1,%edx
+  80202e:	74 7b                	je     8020ab <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  802030:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802033:	83 f8 2f             	cmp    $0x2f,%eax
+  802036:	0f 87 96 00 00 00    	ja     8020d2 <vprintfmt+0x3e2>
+  80203c:	89 c2                	mov    %eax,%edx
+  80203e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802042:	83 c0 08             	add    $0x8,%eax
+  802045:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802048:	4c 8b 22             	mov    (%rdx),%r12
+  80204b:	eb 17                	jmp    802064 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  80204d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802050:	83 f8 2f             	cmp    $0x2f,%eax
+  802053:	77 21                	ja     802076 <vprintfmt+0x386>
+  802055:	89 c2                	mov    %eax,%edx
+  802057:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80205b:	83 c0 08             	add    $0x8,%eax
+  80205e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802061:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802064:	4d 85 e4             	test   %r12,%r12
+  802067:	78 7a                	js     8020e3 <vprintfmt+0x3f3>
+            num = i;
+  802069:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80206c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802071:	e9 56 02 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802076:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80207a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80207e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802082:	eb dd                	jmp    802061 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  802084:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802087:	83 f8 2f             	cmp    $0x2f,%eax
+  80208a:	77 11                	ja     80209d <vprintfmt+0x3ad>
+  80208c:	89 c2                	mov    %eax,%edx
+  80208e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802092:	83 c0 08             	add    $0x8,%eax
+  802095:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802098:	4c 63 22             	movslq (%rdx),%r12
+  80209b:	eb c7                	jmp    802064 <vprintfmt+0x374>
+  80209d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a9:	eb ed                	jmp    802098 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  8020ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8020b1:	77 11                	ja     8020c4 <vprintfmt+0x3d4>
+  8020b3:	89 c2                	mov    %eax,%edx
+  8020b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b9:	83 c0 08             	add    $0x8,%eax
+  8020bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020bf:	4c 8b 22             	mov    (%rdx),%r12
+  8020c2:	eb a0                	jmp    802064 <vprintfmt+0x374>
+  8020c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020d0:	eb ed                	jmp    8020bf <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  8020d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020de:	e9 65 ff ff ff       	jmp    802048 <vprintfmt+0x358>
+                putch('-', put_arg);
+  8020e3:	4c 89 ee             	mov    %r13,%rsi
+  8020e6:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8020eb:	41 ff d6             	call   *%r14
+                i = -i;
+  8020ee:	49 f7 dc             	neg    %r12
+  8020f1:	e9 73 ff ff ff       	jmp    802069 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  8020f6:	40 84 f6             	test   %sil,%sil
+  8020f9:	75 2e                	jne    802129 <vprintfmt+0x439>
+    switch (lflag) {
+  8020fb:	85 d2                	test   %edx,%edx
+  8020fd:	7f 59                	jg     802158 <vprintfmt+0x468>
+  8020ff:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802102:	7d 7a                	jge    80217e <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  802104:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802107:	83 f8 2f             	cmp    $0x2f,%eax
+  80210a:	0f 87 aa 00 00 00    	ja     8021ba <vprintfmt+0x4ca>
+  802110:	89 c2                	mov    %eax,%edx
+  802112:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802116:	83 c0 08             	add    $0x8,%eax
+  802119:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80211c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80211f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802124:	e9 a3 01 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802129:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80212c:	83 f8 2f             	cmp    $0x2f,%eax
+  80212f:	77 19                	ja     80214a <vprintfmt+0x45a>
+  802131:	89 c2                	mov    %eax,%edx
+  802133:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802137:	83 c0 08             	add    $0x8,%eax
+  80213a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80213d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802140:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802145:	e9 82 01 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+  80214a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80214e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802152:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802156:	eb e5                	jmp    80213d <vprintfmt+0x44d>
+    switch (lflag) {
+  802158:	83 fa 01             	cmp    $0x1,%edx
+  80215b:	75 a7                	jne    802104 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  80215d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802160:	83 f8 2f             	cmp    $0x2f,%eax
+  802163:	77 47                	ja     8021ac <vprintfmt+0x4bc>
+  802165:	89 c2                	mov    %eax,%edx
+  802167:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216b:	83 c0 08             	add    $0x8,%eax
+  80216e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802171:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802174:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  802179:	e9 4e 01 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80217e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802181:	83 f8 2f             	cmp    $0x2f,%eax
+  802184:	77 18                	ja     80219e <vprintfmt+0x4ae>
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80218c:	83 c0 08             	add    $0x8,%eax
+  80218f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802192:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802194:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  802199:	e9 2e 01 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+  80219e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021aa:	eb e6                	jmp    802192 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  8021ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021b8:	eb b7                	jmp    802171 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8021ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021c6:	e9 51 ff ff ff       	jmp    80211c <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  8021cb:	40 84 f6             	test   %sil,%sil
+  8021ce:	75 2e                	jne    8021fe <vprintfmt+0x50e>
+    switch (lflag) {
+  8021d0:	85 d2                	test   %edx,%edx
+  8021d2:	7f 59                	jg     80222d <vprintfmt+0x53d>
+  8021d4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021d7:	7d 77                	jge    802250 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8021d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8021df:	0f 87 a4 00 00 00    	ja     802289 <vprintfmt+0x599>
+  8021e5:	89 c2                	mov    %eax,%edx
+  8021e7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021eb:	83 c0 08             	add    $0x8,%eax
+  8021ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8021f4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021f9:	e9 ce 00 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802201:	83 f8 2f             	cmp    $0x2f,%eax
+  802204:	77 19                	ja     80221f <vprintfmt+0x52f>
+  802206:	89 c2                	mov    %eax,%edx
+  802208:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80220c:	83 c0 08             	add    $0x8,%eax
+  80220f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802212:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802215:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80221a:	e9 ad 00 00 00       	jmp    8022cc <vprintfmt+0x5dc>
+  80221f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802223:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802227:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80222b:	eb e5                	jmp    802212 <vprintfmt+0x522>
+    switch (lflag) {
+  80222d:	83 fa 01             	cmp    $0x1,%edx
+  802230:	75 a7                	jne    8021d9 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802232:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802235:	83 f8 2f             	cmp    $0x2f,%eax
+  802238:	77 41                	ja     80227b <vprintfmt+0x58b>
+  80223a:	89 c2                	mov    %eax,%edx
+  80223c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802240:	83 c0 08             	add    $0x8,%eax
+  802243:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802246:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802249:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80224e:	eb 7c                	jmp    8022cc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802250:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802253:	83 f8 2f             	cmp    $0x2f,%eax
+  802256:	77 15                	ja     80226d <vprintfmt+0x57d>
+  802258:	89 c2                	mov    %eax,%edx
+  80225a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80225e:	83 c0 08             	add    $0x8,%eax
+  802261:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802264:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802266:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80226b:	eb 5f                	jmp    8022cc <vprintfmt+0x5dc>
+  80226d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802271:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802275:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802279:	eb e9                	jmp    802264 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80227b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80227f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802283:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802287:	eb bd                	jmp    802246 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802289:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80228d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802291:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802295:	e9 57 ff ff ff       	jmp    8021f1 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80229a:	4c 89 ee             	mov    %r13,%rsi
+  80229d:	bf 30 00 00 00       	mov    $0x30,%edi
+  8022a2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8022a5:	4c 89 ee             	mov    %r13,%rsi
+  8022a8:	bf 78 00 00 00       	mov    $0x78,%edi
+  8022ad:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8022b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8022b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8022b6:	77 47                	ja     8022ff <vprintfmt+0x60f>
+  8022b8:	89 c2                	mov    %eax,%edx
+  8022ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8022be:	83 c0 08             	add    $0x8,%eax
+  8022c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8022c4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8022c7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8022cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8022d4:	0f 94 c0             	sete   %al
+  8022d7:	0f b6 c0             	movzbl %al,%eax
+  8022da:	50                   	push   %rax
+  8022db:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8022e0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8022e4:	4c 89 ee             	mov    %r13,%rsi
+  8022e7:	4c 89 f7             	mov    %r14,%rdi
+  8022ea:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  8022f1:	00 00 00 
+  8022f4:	ff d0                	call   *%rax
+            break;
+  8022f6:	48 83 c4 10          	add    $0x10,%rsp
+  8022fa:	e9 31 fa ff ff       	jmp    801d30 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8022ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802303:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80230b:	eb b7                	jmp    8022c4 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80230d:	40 84 f6             	test   %sil,%sil
+  802310:	75 2b                	jne    80233d <vprintfmt+0x64d>
+    switch (lflag) {
+  802312:	85 d2                	test   %edx,%edx
+  802314:	7f 56                	jg     80236c <vprintfmt+0x67c>
+  802316:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802319:	7d 77                	jge    802392 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80231b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80231e:	83 f8 2f             	cmp    $0x2f,%eax
+  802321:	0f 87 a7 00 00 00    	ja     8023ce <vprintfmt+0x6de>
+  802327:	89 c2                	mov    %eax,%edx
+  802329:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80232d:	83 c0 08             	add    $0x8,%eax
+  802330:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802333:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802336:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80233b:	eb 8f                	jmp    8022cc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80233d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802340:	83 f8 2f             	cmp    $0x2f,%eax
+  802343:	77 19                	ja     80235e <vprintfmt+0x66e>
+  802345:	89 c2                	mov    %eax,%edx
+  802347:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80234b:	83 c0 08             	add    $0x8,%eax
+  80234e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802351:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802354:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802359:	e9 6e ff ff ff       	jmp    8022cc <vprintfmt+0x5dc>
+  80235e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802362:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802366:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80236a:	eb e5                	jmp    802351 <vprintfmt+0x661>
+    switch (lflag) {
+  80236c:	83 fa 01             	cmp    $0x1,%edx
+  80236f:	75 aa                	jne    80231b <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802371:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802374:	83 f8 2f             	cmp    $0x2f,%eax
+  802377:	77 47                	ja     8023c0 <vprintfmt+0x6d0>
+  802379:	89 c2                	mov    %eax,%edx
+  80237b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80237f:	83 c0 08             	add    $0x8,%eax
+  802382:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802385:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802388:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80238d:	e9 3a ff ff ff       	jmp    8022cc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802392:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802395:	83 f8 2f             	cmp    $0x2f,%eax
+  802398:	77 18                	ja     8023b2 <vprintfmt+0x6c2>
+  80239a:	89 c2                	mov    %eax,%edx
+  80239c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023a0:	83 c0 08             	add    $0x8,%eax
+  8023a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023a6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8023a8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8023ad:	e9 1a ff ff ff       	jmp    8022cc <vprintfmt+0x5dc>
+  8023b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023be:	eb e6                	jmp    8023a6 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8023c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023cc:	eb b7                	jmp    802385 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8023ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023da:	e9 54 ff ff ff       	jmp    802333 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8023df:	4c 89 ee             	mov    %r13,%rsi
+  8023e2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8023e7:	41 ff d6             	call   *%r14
+            break;
+  8023ea:	e9 41 f9 ff ff       	jmp    801d30 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8023ef:	4c 89 ee             	mov    %r13,%rsi
+  8023f2:	bf 25 00 00 00       	mov    $0x25,%edi
+  8023f7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8023fa:	48 83 eb 01          	sub    $0x1,%rbx
+  8023fe:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802402:	75 f6                	jne    8023fa <vprintfmt+0x70a>
+  802404:	e9 27 f9 ff ff       	jmp    801d30 <vprintfmt+0x40>
+
+0000000000802409 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802409:	55                   	push   %rbp
+  80240a:	48 89 e5             	mov    %rsp,%rbp
+  80240d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802411:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802415:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80241a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80241e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802425:	48 85 ff             	test   %rdi,%rdi
+  802428:	74 2b                	je     802455 <vsnprintf+0x4c>
+  80242a:	48 85 f6             	test   %rsi,%rsi
+  80242d:	74 26                	je     802455 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80242f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802433:	48 bf 9b 1c 80 00 00 	movabs $0x801c9b,%rdi
+  80243a:	00 00 00 
+  80243d:	48 b8 f0 1c 80 00 00 	movabs $0x801cf0,%rax
+  802444:	00 00 00 
+  802447:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802449:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80244d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802450:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802455:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80245a:	eb f7                	jmp    802453 <vsnprintf+0x4a>
+
+000000000080245c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80245c:	55                   	push   %rbp
+  80245d:	48 89 e5             	mov    %rsp,%rbp
+  802460:	48 83 ec 50          	sub    $0x50,%rsp
+  802464:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802468:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80246c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802470:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802477:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80247b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80247f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802483:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802487:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80248b:	48 b8 09 24 80 00 00 	movabs $0x802409,%rax
+  802492:	00 00 00 
+  802495:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802497:	c9                   	leave
+  802498:	c3                   	ret
+
+0000000000802499 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802499:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80249c:	74 10                	je     8024ae <strlen+0x15>
+    size_t n = 0;
+  80249e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8024a3:	48 83 c0 01          	add    $0x1,%rax
+  8024a7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8024ab:	75 f6                	jne    8024a3 <strlen+0xa>
+  8024ad:	c3                   	ret
+    size_t n = 0;
+  8024ae:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8024b3:	c3                   	ret
+
+00000000008024b4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8024b4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8024b7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8024bc:	48 85 f6             	test   %rsi,%rsi
+  8024bf:	74 11                	je     8024d2 <strnlen+0x1e>
+  8024c1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8024c5:	74 0c                	je     8024d3 <strnlen+0x1f>
+  8024c7:	48 83 c2 01          	add    $0x1,%rdx
+  8024cb:	48 39 d0             	cmp    %rdx,%rax
+  8024ce:	75 f1                	jne    8024c1 <strnlen+0xd>
+  8024d0:	eb 04                	jmp    8024d6 <strnlen+0x22>
+  8024d2:	c3                   	ret
+  8024d3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8024d6:	c3                   	ret
+
+00000000008024d7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8024d7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8024da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024df:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8024e3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8024e6:	48 83 c2 01          	add    $0x1,%rdx
+  8024ea:	84 c9                	test   %cl,%cl
+  8024ec:	75 f1                	jne    8024df <strcpy+0x8>
+        ;
+    return res;
+}
+  8024ee:	c3                   	ret
+
+00000000008024ef <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8024ef:	55                   	push   %rbp
+  8024f0:	48 89 e5             	mov    %rsp,%rbp
+  8024f3:	41 54                	push   %r12
+  8024f5:	53                   	push   %rbx
+  8024f6:	48 89 fb             	mov    %rdi,%rbx
+  8024f9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8024fc:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802508:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80250c:	4c 89 e6             	mov    %r12,%rsi
+  80250f:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  802516:	00 00 00 
+  802519:	ff d0                	call   *%rax
+    return dst;
+}
+  80251b:	48 89 d8             	mov    %rbx,%rax
+  80251e:	5b                   	pop    %rbx
+  80251f:	41 5c                	pop    %r12
+  802521:	5d                   	pop    %rbp
+  802522:	c3                   	ret
+
+0000000000802523 <toupper>:
+
+int
+toupper(int ch) {
+  802523:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802525:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802528:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80252b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80252e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802531:	c3                   	ret
+
+0000000000802532 <tolower>:
+
+int
+tolower(int ch) {
+  802532:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802534:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802537:	8d 57 20             	lea    0x20(%rdi),%edx
+  80253a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80253d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802540:	c3                   	ret
+
+0000000000802541 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802541:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802544:	48 85 d2             	test   %rdx,%rdx
+  802547:	74 1f                	je     802568 <strncpy+0x27>
+  802549:	48 01 fa             	add    %rdi,%rdx
+  80254c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80254f:	48 83 c1 01          	add    $0x1,%rcx
+  802553:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802557:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80255b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80255f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802563:	48 39 ca             	cmp    %rcx,%rdx
+  802566:	75 e7                	jne    80254f <strncpy+0xe>
+    }
+    return ret;
+}
+  802568:	c3                   	ret
+
+0000000000802569 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802569:	48 89 f8             	mov    %rdi,%rax
+  80256c:	48 85 d2             	test   %rdx,%rdx
+  80256f:	74 24                	je     802595 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802571:	48 83 ea 01          	sub    $0x1,%rdx
+  802575:	74 1b                	je     802592 <strlcpy+0x29>
+  802577:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80257b:	0f b6 16             	movzbl (%rsi),%edx
+  80257e:	84 d2                	test   %dl,%dl
+  802580:	74 10                	je     802592 <strlcpy+0x29>
+            *dst++ = *src++;
+  802582:	48 83 c6 01          	add    $0x1,%rsi
+  802586:	48 83 c0 01          	add    $0x1,%rax
+  80258a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80258d:	48 39 c8             	cmp    %rcx,%rax
+  802590:	75 e9                	jne    80257b <strlcpy+0x12>
+        *dst = '\0';
+  802592:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802595:	48 29 f8             	sub    %rdi,%rax
+}
+  802598:	c3                   	ret
+
+0000000000802599 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802599:	0f b6 07             	movzbl (%rdi),%eax
+  80259c:	84 c0                	test   %al,%al
+  80259e:	74 13                	je     8025b3 <strcmp+0x1a>
+  8025a0:	38 06                	cmp    %al,(%rsi)
+  8025a2:	75 0f                	jne    8025b3 <strcmp+0x1a>
+  8025a4:	48 83 c7 01          	add    $0x1,%rdi
+  8025a8:	48 83 c6 01          	add    $0x1,%rsi
+  8025ac:	0f b6 07             	movzbl (%rdi),%eax
+  8025af:	84 c0                	test   %al,%al
+  8025b1:	75 ed                	jne    8025a0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8025b3:	0f b6 c0             	movzbl %al,%eax
+  8025b6:	0f b6 16             	movzbl (%rsi),%edx
+  8025b9:	29 d0                	sub    %edx,%eax
+}
+  8025bb:	c3                   	ret
+
+00000000008025bc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8025bc:	48 85 d2             	test   %rdx,%rdx
+  8025bf:	74 1f                	je     8025e0 <strncmp+0x24>
+  8025c1:	0f b6 07             	movzbl (%rdi),%eax
+  8025c4:	84 c0                	test   %al,%al
+  8025c6:	74 1e                	je     8025e6 <strncmp+0x2a>
+  8025c8:	3a 06                	cmp    (%rsi),%al
+  8025ca:	75 1a                	jne    8025e6 <strncmp+0x2a>
+  8025cc:	48 83 c7 01          	add    $0x1,%rdi
+  8025d0:	48 83 c6 01          	add    $0x1,%rsi
+  8025d4:	48 83 ea 01          	sub    $0x1,%rdx
+  8025d8:	75 e7                	jne    8025c1 <strncmp+0x5>
+
+    if (!n) return 0;
+  8025da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025df:	c3                   	ret
+  8025e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e5:	c3                   	ret
+  8025e6:	48 85 d2             	test   %rdx,%rdx
+  8025e9:	74 09                	je     8025f4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8025eb:	0f b6 07             	movzbl (%rdi),%eax
+  8025ee:	0f b6 16             	movzbl (%rsi),%edx
+  8025f1:	29 d0                	sub    %edx,%eax
+  8025f3:	c3                   	ret
+    if (!n) return 0;
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025f9:	c3                   	ret
+
+00000000008025fa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8025fa:	0f b6 17             	movzbl (%rdi),%edx
+  8025fd:	84 d2                	test   %dl,%dl
+  8025ff:	74 18                	je     802619 <strchr+0x1f>
+        if (*str == c) {
+  802601:	0f be d2             	movsbl %dl,%edx
+  802604:	39 f2                	cmp    %esi,%edx
+  802606:	74 17                	je     80261f <strchr+0x25>
+    for (; *str; str++) {
+  802608:	48 83 c7 01          	add    $0x1,%rdi
+  80260c:	0f b6 17             	movzbl (%rdi),%edx
+  80260f:	84 d2                	test   %dl,%dl
+  802611:	75 ee                	jne    802601 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802613:	b8 00 00 00 00       	mov    $0x0,%eax
+  802618:	c3                   	ret
+  802619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80261e:	c3                   	ret
+  80261f:	48 89 f8             	mov    %rdi,%rax
+}
+  802622:	c3                   	ret
+
+0000000000802623 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802623:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802626:	0f b6 17             	movzbl (%rdi),%edx
+  802629:	84 d2                	test   %dl,%dl
+  80262b:	74 13                	je     802640 <strfind+0x1d>
+  80262d:	0f be d2             	movsbl %dl,%edx
+  802630:	39 f2                	cmp    %esi,%edx
+  802632:	74 0b                	je     80263f <strfind+0x1c>
+  802634:	48 83 c0 01          	add    $0x1,%rax
+  802638:	0f b6 10             	movzbl (%rax),%edx
+  80263b:	84 d2                	test   %dl,%dl
+  80263d:	75 ee                	jne    80262d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80263f:	c3                   	ret
+  802640:	c3                   	ret
+
+0000000000802641 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802641:	48 39 f7             	cmp    %rsi,%rdi
+  802644:	74 65                	je     8026ab <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802646:	55                   	push   %rbp
+  802647:	48 89 e5             	mov    %rsp,%rbp
+  80264a:	41 57                	push   %r15
+  80264c:	41 56                	push   %r14
+  80264e:	41 55                	push   %r13
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+  802653:	48 83 ec 18          	sub    $0x18,%rsp
+  802657:	48 89 fb             	mov    %rdi,%rbx
+  80265a:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80265d:	49 bf 32 25 80 00 00 	movabs $0x802532,%r15
+  802664:	00 00 00 
+  802667:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80266b:	41 0f b6 fd          	movzbl %r13b,%edi
+  80266f:	41 ff d7             	call   *%r15
+  802672:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802675:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80267a:	41 0f b6 fe          	movzbl %r14b,%edi
+  80267e:	41 ff d7             	call   *%r15
+  802681:	89 c2                	mov    %eax,%edx
+  802683:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802686:	29 d0                	sub    %edx,%eax
+  802688:	75 12                	jne    80269c <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80268a:	48 83 c3 01          	add    $0x1,%rbx
+  80268e:	45 84 ed             	test   %r13b,%r13b
+  802691:	74 09                	je     80269c <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802693:	49 83 c4 01          	add    $0x1,%r12
+  802697:	45 84 f6             	test   %r14b,%r14b
+  80269a:	75 cb                	jne    802667 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80269c:	48 83 c4 18          	add    $0x18,%rsp
+  8026a0:	5b                   	pop    %rbx
+  8026a1:	41 5c                	pop    %r12
+  8026a3:	41 5d                	pop    %r13
+  8026a5:	41 5e                	pop    %r14
+  8026a7:	41 5f                	pop    %r15
+  8026a9:	5d                   	pop    %rbp
+  8026aa:	c3                   	ret
+    if (p1 == p2) return 0;
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026b0:	c3                   	ret
+
+00000000008026b1 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8026b1:	48 39 f7             	cmp    %rsi,%rdi
+  8026b4:	74 7d                	je     802733 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8026b6:	55                   	push   %rbp
+  8026b7:	48 89 e5             	mov    %rsp,%rbp
+  8026ba:	41 57                	push   %r15
+  8026bc:	41 56                	push   %r14
+  8026be:	41 55                	push   %r13
+  8026c0:	41 54                	push   %r12
+  8026c2:	53                   	push   %rbx
+  8026c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8026c7:	48 89 fb             	mov    %rdi,%rbx
+  8026ca:	49 89 f4             	mov    %rsi,%r12
+  8026cd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8026d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8026d5:	49 bf 32 25 80 00 00 	movabs $0x802532,%r15
+  8026dc:	00 00 00 
+    while (n--) {
+  8026df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026e3:	48 39 c3             	cmp    %rax,%rbx
+  8026e6:	74 37                	je     80271f <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8026e8:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8026ec:	41 0f b6 fd          	movzbl %r13b,%edi
+  8026f0:	41 ff d7             	call   *%r15
+  8026f3:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8026f6:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8026fb:	41 0f b6 fe          	movzbl %r14b,%edi
+  8026ff:	41 ff d7             	call   *%r15
+  802702:	89 c2                	mov    %eax,%edx
+  802704:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802707:	29 d0                	sub    %edx,%eax
+  802709:	75 19                	jne    802724 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80270b:	48 83 c3 01          	add    $0x1,%rbx
+  80270f:	45 84 ed             	test   %r13b,%r13b
+  802712:	74 10                	je     802724 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802714:	49 83 c4 01          	add    $0x1,%r12
+  802718:	45 84 f6             	test   %r14b,%r14b
+  80271b:	75 c2                	jne    8026df <strncasecmp+0x2e>
+  80271d:	eb 05                	jmp    802724 <strncasecmp+0x73>
+  80271f:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802724:	48 83 c4 18          	add    $0x18,%rsp
+  802728:	5b                   	pop    %rbx
+  802729:	41 5c                	pop    %r12
+  80272b:	41 5d                	pop    %r13
+  80272d:	41 5e                	pop    %r14
+  80272f:	41 5f                	pop    %r15
+  802731:	5d                   	pop    %rbp
+  802732:	c3                   	ret
+    if (p1 == p2) return 0;
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802738:	c3                   	ret
+
+0000000000802739 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802739:	83 e7 df             	and    $0xffffffdf,%edi
+  80273c:	83 ef 41             	sub    $0x41,%edi
+  80273f:	83 ff 19             	cmp    $0x19,%edi
+  802742:	0f 96 c0             	setbe  %al
+}
+  802745:	c3                   	ret
+
+0000000000802746 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802746:	83 ff 20             	cmp    $0x20,%edi
+  802749:	0f 94 c0             	sete   %al
+  80274c:	83 ff 09             	cmp    $0x9,%edi
+  80274f:	0f 94 c2             	sete   %dl
+  802752:	09 d0                	or     %edx,%eax
+}
+  802754:	c3                   	ret
+
+0000000000802755 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802755:	55                   	push   %rbp
+  802756:	48 89 e5             	mov    %rsp,%rbp
+  802759:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80275b:	48 bf 7f 69 80 00 00 	movabs $0x80697f,%rdi
+  802762:	00 00 00 
+  802765:	48 b8 fa 25 80 00 00 	movabs $0x8025fa,%rax
+  80276c:	00 00 00 
+  80276f:	ff d0                	call   *%rax
+  802771:	48 85 c0             	test   %rax,%rax
+  802774:	0f 95 c0             	setne  %al
+}
+  802777:	5d                   	pop    %rbp
+  802778:	c3                   	ret
+
+0000000000802779 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802779:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80277c:	48 89 f8             	mov    %rdi,%rax
+  80277f:	48 f7 d8             	neg    %rax
+  802782:	83 e0 07             	and    $0x7,%eax
+  802785:	49 89 d1             	mov    %rdx,%r9
+  802788:	49 29 c1             	sub    %rax,%r9
+  80278b:	78 36                	js     8027c3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80278d:	40 0f b6 c6          	movzbl %sil,%eax
+  802791:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802798:	01 01 01 
+  80279b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80279f:	40 f6 c7 07          	test   $0x7,%dil
+  8027a3:	75 38                	jne    8027dd <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8027a5:	4c 89 c9             	mov    %r9,%rcx
+  8027a8:	48 c1 f9 03          	sar    $0x3,%rcx
+  8027ac:	74 0c                	je     8027ba <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8027ae:	fc                   	cld
+  8027af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8027b2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8027b6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8027ba:	4d 85 c9             	test   %r9,%r9
+  8027bd:	75 45                	jne    802804 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8027bf:	4c 89 c0             	mov    %r8,%rax
+  8027c2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8027c3:	48 85 d2             	test   %rdx,%rdx
+  8027c6:	74 f7                	je     8027bf <memset+0x46>
+  8027c8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8027cb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8027ce:	48 83 c0 01          	add    $0x1,%rax
+  8027d2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8027d6:	48 39 c2             	cmp    %rax,%rdx
+  8027d9:	75 f3                	jne    8027ce <memset+0x55>
+  8027db:	eb e2                	jmp    8027bf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8027dd:	40 f6 c7 01          	test   $0x1,%dil
+  8027e1:	74 06                	je     8027e9 <memset+0x70>
+  8027e3:	88 07                	mov    %al,(%rdi)
+  8027e5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8027e9:	40 f6 c7 02          	test   $0x2,%dil
+  8027ed:	74 07                	je     8027f6 <memset+0x7d>
+  8027ef:	66 89 07             	mov    %ax,(%rdi)
+  8027f2:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8027f6:	40 f6 c7 04          	test   $0x4,%dil
+  8027fa:	74 a9                	je     8027a5 <memset+0x2c>
+  8027fc:	89 07                	mov    %eax,(%rdi)
+  8027fe:	48 83 c7 04          	add    $0x4,%rdi
+  802802:	eb a1                	jmp    8027a5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802804:	41 f6 c1 04          	test   $0x4,%r9b
+  802808:	74 06                	je     802810 <memset+0x97>
+  80280a:	89 07                	mov    %eax,(%rdi)
+  80280c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802810:	41 f6 c1 02          	test   $0x2,%r9b
+  802814:	74 07                	je     80281d <memset+0xa4>
+  802816:	66 89 07             	mov    %ax,(%rdi)
+  802819:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80281d:	41 f6 c1 01          	test   $0x1,%r9b
+  802821:	74 9c                	je     8027bf <memset+0x46>
+  802823:	88 07                	mov    %al,(%rdi)
+  802825:	eb 98                	jmp    8027bf <memset+0x46>
+
+0000000000802827 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802827:	48 89 f8             	mov    %rdi,%rax
+  80282a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80282d:	48 39 fe             	cmp    %rdi,%rsi
+  802830:	73 3b                	jae    80286d <memmove+0x46>
+  802832:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802836:	48 39 d7             	cmp    %rdx,%rdi
+  802839:	73 32                	jae    80286d <memmove+0x46>
+        s += n;
+        d += n;
+  80283b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80283f:	48 89 d6             	mov    %rdx,%rsi
+  802842:	48 09 fe             	or     %rdi,%rsi
+  802845:	48 09 ce             	or     %rcx,%rsi
+  802848:	40 f6 c6 07          	test   $0x7,%sil
+  80284c:	75 12                	jne    802860 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80284e:	48 83 ef 08          	sub    $0x8,%rdi
+  802852:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802856:	48 c1 e9 03          	shr    $0x3,%rcx
+  80285a:	fd                   	std
+  80285b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80285e:	fc                   	cld
+  80285f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802860:	48 83 ef 01          	sub    $0x1,%rdi
+  802864:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802868:	fd                   	std
+  802869:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80286b:	eb f1                	jmp    80285e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80286d:	48 89 f2             	mov    %rsi,%rdx
+  802870:	48 09 c2             	or     %rax,%rdx
+  802873:	48 09 ca             	or     %rcx,%rdx
+  802876:	f6 c2 07             	test   $0x7,%dl
+  802879:	75 0c                	jne    802887 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80287b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80287f:	48 89 c7             	mov    %rax,%rdi
+  802882:	fc                   	cld
+  802883:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802886:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802887:	48 89 c7             	mov    %rax,%rdi
+  80288a:	fc                   	cld
+  80288b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80288d:	c3                   	ret
+
+000000000080288e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80288e:	55                   	push   %rbp
+  80288f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802892:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+}
+  80289e:	5d                   	pop    %rbp
+  80289f:	c3                   	ret
+
+00000000008028a0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	41 57                	push   %r15
+  8028a6:	41 56                	push   %r14
+  8028a8:	41 55                	push   %r13
+  8028aa:	41 54                	push   %r12
+  8028ac:	53                   	push   %rbx
+  8028ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b1:	49 89 fe             	mov    %rdi,%r14
+  8028b4:	49 89 f7             	mov    %rsi,%r15
+  8028b7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8028ba:	48 89 f7             	mov    %rsi,%rdi
+  8028bd:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+  8028c9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8028cc:	48 89 de             	mov    %rbx,%rsi
+  8028cf:	4c 89 f7             	mov    %r14,%rdi
+  8028d2:	48 b8 b4 24 80 00 00 	movabs $0x8024b4,%rax
+  8028d9:	00 00 00 
+  8028dc:	ff d0                	call   *%rax
+  8028de:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8028e1:	48 39 c3             	cmp    %rax,%rbx
+  8028e4:	74 36                	je     80291c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8028e6:	48 89 d8             	mov    %rbx,%rax
+  8028e9:	4c 29 e8             	sub    %r13,%rax
+  8028ec:	49 39 c4             	cmp    %rax,%r12
+  8028ef:	73 31                	jae    802922 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8028f1:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8028f6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8028fa:	4c 89 fe             	mov    %r15,%rsi
+  8028fd:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  802904:	00 00 00 
+  802907:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802909:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80290d:	48 83 c4 08          	add    $0x8,%rsp
+  802911:	5b                   	pop    %rbx
+  802912:	41 5c                	pop    %r12
+  802914:	41 5d                	pop    %r13
+  802916:	41 5e                	pop    %r14
+  802918:	41 5f                	pop    %r15
+  80291a:	5d                   	pop    %rbp
+  80291b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80291c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802920:	eb eb                	jmp    80290d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802922:	48 83 eb 01          	sub    $0x1,%rbx
+  802926:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80292a:	48 89 da             	mov    %rbx,%rdx
+  80292d:	4c 89 fe             	mov    %r15,%rsi
+  802930:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80293c:	49 01 de             	add    %rbx,%r14
+  80293f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802944:	eb c3                	jmp    802909 <strlcat+0x69>
+
+0000000000802946 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802946:	48 85 d2             	test   %rdx,%rdx
+  802949:	74 2d                	je     802978 <memcmp+0x32>
+  80294b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802950:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802954:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802959:	44 38 c1             	cmp    %r8b,%cl
+  80295c:	75 0f                	jne    80296d <memcmp+0x27>
+    while (n-- > 0) {
+  80295e:	48 83 c0 01          	add    $0x1,%rax
+  802962:	48 39 c2             	cmp    %rax,%rdx
+  802965:	75 e9                	jne    802950 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80296d:	0f b6 c1             	movzbl %cl,%eax
+  802970:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802974:	44 29 c0             	sub    %r8d,%eax
+  802977:	c3                   	ret
+    return 0;
+  802978:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80297d:	c3                   	ret
+
+000000000080297e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80297e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802982:	48 39 c7             	cmp    %rax,%rdi
+  802985:	73 0f                	jae    802996 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802987:	40 38 37             	cmp    %sil,(%rdi)
+  80298a:	74 0e                	je     80299a <memfind+0x1c>
+    for (; src < end; src++) {
+  80298c:	48 83 c7 01          	add    $0x1,%rdi
+  802990:	48 39 f8             	cmp    %rdi,%rax
+  802993:	75 f2                	jne    802987 <memfind+0x9>
+  802995:	c3                   	ret
+  802996:	48 89 f8             	mov    %rdi,%rax
+  802999:	c3                   	ret
+  80299a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80299d:	c3                   	ret
+
+000000000080299e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80299e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8029a1:	0f b6 37             	movzbl (%rdi),%esi
+  8029a4:	40 80 fe 20          	cmp    $0x20,%sil
+  8029a8:	74 06                	je     8029b0 <strtol+0x12>
+  8029aa:	40 80 fe 09          	cmp    $0x9,%sil
+  8029ae:	75 13                	jne    8029c3 <strtol+0x25>
+  8029b0:	48 83 c7 01          	add    $0x1,%rdi
+  8029b4:	0f b6 37             	movzbl (%rdi),%esi
+  8029b7:	40 80 fe 20          	cmp    $0x20,%sil
+  8029bb:	74 f3                	je     8029b0 <strtol+0x12>
+  8029bd:	40 80 fe 09          	cmp    $0x9,%sil
+  8029c1:	74 ed                	je     8029b0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8029c3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8029c6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8029c9:	3c 01                	cmp    $0x1,%al
+  8029cb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8029cf:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8029d5:	75 0f                	jne    8029e6 <strtol+0x48>
+  8029d7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8029da:	74 14                	je     8029f0 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8029dc:	85 d2                	test   %edx,%edx
+  8029de:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029e3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8029e6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8029eb:	4c 63 ca             	movslq %edx,%r9
+  8029ee:	eb 36                	jmp    802a26 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8029f0:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8029f4:	74 0f                	je     802a05 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8029f6:	85 d2                	test   %edx,%edx
+  8029f8:	75 ec                	jne    8029e6 <strtol+0x48>
+        s++;
+  8029fa:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8029fe:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802a03:	eb e1                	jmp    8029e6 <strtol+0x48>
+        s += 2;
+  802a05:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802a09:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802a0e:	eb d6                	jmp    8029e6 <strtol+0x48>
+            dig -= '0';
+  802a10:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802a13:	44 0f b6 c1          	movzbl %cl,%r8d
+  802a17:	41 39 d0             	cmp    %edx,%r8d
+  802a1a:	7d 21                	jge    802a3d <strtol+0x9f>
+        val = val * base + dig;
+  802a1c:	49 0f af c1          	imul   %r9,%rax
+  802a20:	0f b6 c9             	movzbl %cl,%ecx
+  802a23:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802a26:	48 83 c7 01          	add    $0x1,%rdi
+  802a2a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802a2e:	80 f9 39             	cmp    $0x39,%cl
+  802a31:	76 dd                	jbe    802a10 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802a33:	80 f9 7b             	cmp    $0x7b,%cl
+  802a36:	77 05                	ja     802a3d <strtol+0x9f>
+            dig -= 'a' - 10;
+  802a38:	83 e9 57             	sub    $0x57,%ecx
+  802a3b:	eb d6                	jmp    802a13 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802a3d:	4d 85 d2             	test   %r10,%r10
+  802a40:	74 03                	je     802a45 <strtol+0xa7>
+  802a42:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802a45:	48 89 c2             	mov    %rax,%rdx
+  802a48:	48 f7 da             	neg    %rdx
+  802a4b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802a4f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802a53:	c3                   	ret
+
+0000000000802a54 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802a54:	55                   	push   %rbp
+  802a55:	48 89 e5             	mov    %rsp,%rbp
+  802a58:	53                   	push   %rbx
+  802a59:	48 89 fa             	mov    %rdi,%rdx
+  802a5c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a7f:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802a81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a85:	c9                   	leave
+  802a86:	c3                   	ret
+
+0000000000802a87 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802a87:	55                   	push   %rbp
+  802a88:	48 89 e5             	mov    %rsp,%rbp
+  802a8b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a8c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a96:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aa5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aaa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ab0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ab6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ab8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802abc:	c9                   	leave
+  802abd:	c3                   	ret
+
+0000000000802abe <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802abe:	55                   	push   %rbp
+  802abf:	48 89 e5             	mov    %rsp,%rbp
+  802ac2:	53                   	push   %rbx
+  802ac3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ac6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802acb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ad0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ad5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ada:	be 00 00 00 00       	mov    $0x0,%esi
+  802adf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ae5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aeb:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802aed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802af1:	c9                   	leave
+  802af2:	c3                   	ret
+
+0000000000802af3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	53                   	push   %rbx
+  802af8:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802afc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aff:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b04:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b09:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b13:	be 00 00 00 00       	mov    $0x0,%esi
+  802b18:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b1e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b24:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b26:	48 85 c0             	test   %rax,%rax
+  802b29:	7f 06                	jg     802b31 <sys_env_destroy+0x3e>
+}
+  802b2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b2f:	c9                   	leave
+  802b30:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b31:	49 89 c0             	mov    %rax,%r8
+  802b34:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802b39:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802b40:	00 00 00 
+  802b43:	be 27 00 00 00       	mov    $0x27,%esi
+  802b48:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802b4f:	00 00 00 
+  802b52:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b57:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802b5e:	00 00 00 
+  802b61:	41 ff d1             	call   *%r9
+
+0000000000802b64 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802b64:	55                   	push   %rbp
+  802b65:	48 89 e5             	mov    %rsp,%rbp
+  802b68:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802b69:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b73:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b82:	be 00 00 00 00       	mov    $0x0,%esi
+  802b87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b93:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802b95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b99:	c9                   	leave
+  802b9a:	c3                   	ret
+
+0000000000802b9b <sys_yield>:
+
+void
+sys_yield(void) {
+  802b9b:	55                   	push   %rbp
+  802b9c:	48 89 e5             	mov    %rsp,%rbp
+  802b9f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802ba0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ba5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802baa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802baf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bb9:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bc4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bca:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802bcc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bd0:	c9                   	leave
+  802bd1:	c3                   	ret
+
+0000000000802bd2 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802bd2:	55                   	push   %rbp
+  802bd3:	48 89 e5             	mov    %rsp,%rbp
+  802bd6:	53                   	push   %rbx
+  802bd7:	48 89 fa             	mov    %rdi,%rdx
+  802bda:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802bdd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802be2:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802be9:	00 00 00 
+  802bec:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bf1:	be 00 00 00 00       	mov    $0x0,%esi
+  802bf6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bfc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c02:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802c04:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+
+0000000000802c0a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802c0a:	55                   	push   %rbp
+  802c0b:	48 89 e5             	mov    %rsp,%rbp
+  802c0e:	53                   	push   %rbx
+  802c0f:	49 89 f8             	mov    %rdi,%r8
+  802c12:	48 89 d3             	mov    %rdx,%rbx
+  802c15:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802c18:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c1d:	4c 89 c2             	mov    %r8,%rdx
+  802c20:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c23:	be 00 00 00 00       	mov    $0x0,%esi
+  802c28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c34:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802c36:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c3a:	c9                   	leave
+  802c3b:	c3                   	ret
+
+0000000000802c3c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802c3c:	55                   	push   %rbp
+  802c3d:	48 89 e5             	mov    %rsp,%rbp
+  802c40:	53                   	push   %rbx
+  802c41:	48 83 ec 08          	sub    $0x8,%rsp
+  802c45:	89 f8                	mov    %edi,%eax
+  802c47:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802c4a:	48 63 f9             	movslq %ecx,%rdi
+  802c4d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c50:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c55:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c58:	be 00 00 00 00       	mov    $0x0,%esi
+  802c5d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c63:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c69:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c6b:	48 85 c0             	test   %rax,%rax
+  802c6e:	7f 06                	jg     802c76 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802c70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c74:	c9                   	leave
+  802c75:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c76:	49 89 c0             	mov    %rax,%r8
+  802c79:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802c7e:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802c85:	00 00 00 
+  802c88:	be 27 00 00 00       	mov    $0x27,%esi
+  802c8d:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802c94:	00 00 00 
+  802c97:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9c:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802ca3:	00 00 00 
+  802ca6:	41 ff d1             	call   *%r9
+
+0000000000802ca9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802ca9:	55                   	push   %rbp
+  802caa:	48 89 e5             	mov    %rsp,%rbp
+  802cad:	53                   	push   %rbx
+  802cae:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb2:	89 f8                	mov    %edi,%eax
+  802cb4:	49 89 f2             	mov    %rsi,%r10
+  802cb7:	48 89 cf             	mov    %rcx,%rdi
+  802cba:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802cbd:	48 63 da             	movslq %edx,%rbx
+  802cc0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cc3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cc8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ccb:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802cce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cd4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cd6:	48 85 c0             	test   %rax,%rax
+  802cd9:	7f 06                	jg     802ce1 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802cdb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cdf:	c9                   	leave
+  802ce0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ce1:	49 89 c0             	mov    %rax,%r8
+  802ce4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802ce9:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802cf0:	00 00 00 
+  802cf3:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf8:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802cff:	00 00 00 
+  802d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d07:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802d0e:	00 00 00 
+  802d11:	41 ff d1             	call   *%r9
+
+0000000000802d14 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802d14:	55                   	push   %rbp
+  802d15:	48 89 e5             	mov    %rsp,%rbp
+  802d18:	53                   	push   %rbx
+  802d19:	48 83 ec 08          	sub    $0x8,%rsp
+  802d1d:	48 89 f1             	mov    %rsi,%rcx
+  802d20:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802d23:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d26:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d30:	be 00 00 00 00       	mov    $0x0,%esi
+  802d35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d3b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d41:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d43:	48 85 c0             	test   %rax,%rax
+  802d46:	7f 06                	jg     802d4e <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802d48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d4c:	c9                   	leave
+  802d4d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d4e:	49 89 c0             	mov    %rax,%r8
+  802d51:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d56:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802d5d:	00 00 00 
+  802d60:	be 27 00 00 00       	mov    $0x27,%esi
+  802d65:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802d6c:	00 00 00 
+  802d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d74:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802d7b:	00 00 00 
+  802d7e:	41 ff d1             	call   *%r9
+
+0000000000802d81 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802d81:	55                   	push   %rbp
+  802d82:	48 89 e5             	mov    %rsp,%rbp
+  802d85:	53                   	push   %rbx
+  802d86:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802d8a:	48 63 ce             	movslq %esi,%rcx
+  802d8d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d90:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802da4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802daa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802db0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802db2:	48 85 c0             	test   %rax,%rax
+  802db5:	7f 06                	jg     802dbd <sys_env_set_status+0x3c>
+}
+  802db7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dbb:	c9                   	leave
+  802dbc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802dbd:	49 89 c0             	mov    %rax,%r8
+  802dc0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802dc5:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802dcc:	00 00 00 
+  802dcf:	be 27 00 00 00       	mov    $0x27,%esi
+  802dd4:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802ddb:	00 00 00 
+  802dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de3:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802dea:	00 00 00 
+  802ded:	41 ff d1             	call   *%r9
+
+0000000000802df0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802df0:	55                   	push   %rbp
+  802df1:	48 89 e5             	mov    %rsp,%rbp
+  802df4:	53                   	push   %rbx
+  802df5:	48 83 ec 08          	sub    $0x8,%rsp
+  802df9:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802dfc:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dff:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e09:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802e13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e1f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e21:	48 85 c0             	test   %rax,%rax
+  802e24:	7f 06                	jg     802e2c <sys_env_set_trapframe+0x3c>
+}
+  802e26:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e2a:	c9                   	leave
+  802e2b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e2c:	49 89 c0             	mov    %rax,%r8
+  802e2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802e34:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802e3b:	00 00 00 
+  802e3e:	be 27 00 00 00       	mov    $0x27,%esi
+  802e43:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802e4a:	00 00 00 
+  802e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e52:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802e59:	00 00 00 
+  802e5c:	41 ff d1             	call   *%r9
+
+0000000000802e5f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802e5f:	55                   	push   %rbp
+  802e60:	48 89 e5             	mov    %rsp,%rbp
+  802e63:	53                   	push   %rbx
+  802e64:	48 83 ec 08          	sub    $0x8,%rsp
+  802e68:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802e6b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e6e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e78:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e88:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e8e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e90:	48 85 c0             	test   %rax,%rax
+  802e93:	7f 06                	jg     802e9b <sys_env_set_pgfault_upcall+0x3c>
+}
+  802e95:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e99:	c9                   	leave
+  802e9a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e9b:	49 89 c0             	mov    %rax,%r8
+  802e9e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802ea3:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802eaa:	00 00 00 
+  802ead:	be 27 00 00 00       	mov    $0x27,%esi
+  802eb2:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802eb9:	00 00 00 
+  802ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec1:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802ec8:	00 00 00 
+  802ecb:	41 ff d1             	call   *%r9
+
+0000000000802ece <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802ece:	55                   	push   %rbp
+  802ecf:	48 89 e5             	mov    %rsp,%rbp
+  802ed2:	53                   	push   %rbx
+  802ed3:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802ed7:	40 0f b6 ce          	movzbl %sil,%ecx
+  802edb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ede:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ee8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eed:	be 00 00 00 00       	mov    $0x0,%esi
+  802ef2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ef8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802efe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f00:	48 85 c0             	test   %rax,%rax
+  802f03:	7f 06                	jg     802f0b <sys_env_set_reclaim+0x3d>
+}
+  802f05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f09:	c9                   	leave
+  802f0a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f0b:	49 89 c0             	mov    %rax,%r8
+  802f0e:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802f13:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802f1a:	00 00 00 
+  802f1d:	be 27 00 00 00       	mov    $0x27,%esi
+  802f22:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802f29:	00 00 00 
+  802f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f31:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802f38:	00 00 00 
+  802f3b:	41 ff d1             	call   *%r9
+
+0000000000802f3e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802f3e:	55                   	push   %rbp
+  802f3f:	48 89 e5             	mov    %rsp,%rbp
+  802f42:	53                   	push   %rbx
+  802f43:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802f47:	48 63 ce             	movslq %esi,%rcx
+  802f4a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f4d:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f57:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f5c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f6d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f6f:	48 85 c0             	test   %rax,%rax
+  802f72:	7f 06                	jg     802f7a <sys_env_set_nice+0x3c>
+}
+  802f74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f78:	c9                   	leave
+  802f79:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f7a:	49 89 c0             	mov    %rax,%r8
+  802f7d:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802f82:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  802f89:	00 00 00 
+  802f8c:	be 27 00 00 00       	mov    $0x27,%esi
+  802f91:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  802f98:	00 00 00 
+  802f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa0:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  802fa7:	00 00 00 
+  802faa:	41 ff d1             	call   *%r9
+
+0000000000802fad <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802fad:	55                   	push   %rbp
+  802fae:	48 89 e5             	mov    %rsp,%rbp
+  802fb1:	53                   	push   %rbx
+  802fb2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fb5:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fba:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fbf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fc9:	be 00 00 00 00       	mov    $0x0,%esi
+  802fce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fd4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fda:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802fdc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fe0:	c9                   	leave
+  802fe1:	c3                   	ret
+
+0000000000802fe2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802fe2:	55                   	push   %rbp
+  802fe3:	48 89 e5             	mov    %rsp,%rbp
+  802fe6:	53                   	push   %rbx
+  802fe7:	89 f8                	mov    %edi,%eax
+  802fe9:	49 89 f1             	mov    %rsi,%r9
+  802fec:	48 89 d3             	mov    %rdx,%rbx
+  802fef:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ff2:	49 63 f0             	movslq %r8d,%rsi
+  802ff5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ff8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ffd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803000:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803006:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80300c:	cd 30                	int    $0x30
+}
+  80300e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803012:	c9                   	leave
+  803013:	c3                   	ret
+
+0000000000803014 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	53                   	push   %rbx
+  803019:	89 f8                	mov    %edi,%eax
+  80301b:	49 89 f1             	mov    %rsi,%r9
+  80301e:	48 89 d3             	mov    %rdx,%rbx
+  803021:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803024:	49 63 f0             	movslq %r8d,%rsi
+  803027:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80302a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80302f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803032:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803038:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80303e:	cd 30                	int    $0x30
+}
+  803040:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803044:	c9                   	leave
+  803045:	c3                   	ret
+
+0000000000803046 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803046:	55                   	push   %rbp
+  803047:	48 89 e5             	mov    %rsp,%rbp
+  80304a:	53                   	push   %rbx
+  80304b:	48 83 ec 08          	sub    $0x8,%rsp
+  80304f:	89 f8                	mov    %edi,%eax
+  803051:	49 89 f2             	mov    %rsi,%r10
+  803054:	48 89 d3             	mov    %rdx,%rbx
+  803057:	48 89 cf             	mov    %rcx,%rdi
+  80305a:	44 89 c6             	mov    %r8d,%esi
+  80305d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803060:	48 63 f6             	movslq %esi,%rsi
+  803063:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803066:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80306b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  80306e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803072:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803074:	48 85 c0             	test   %rax,%rax
+  803077:	7f 06                	jg     80307f <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803079:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80307d:	c9                   	leave
+  80307e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80307f:	49 89 c0             	mov    %rax,%r8
+  803082:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  803087:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  80308e:	00 00 00 
+  803091:	be 27 00 00 00       	mov    $0x27,%esi
+  803096:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  80309d:	00 00 00 
+  8030a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a5:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  8030ac:	00 00 00 
+  8030af:	41 ff d1             	call   *%r9
+
+00000000008030b2 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  8030b2:	55                   	push   %rbp
+  8030b3:	48 89 e5             	mov    %rsp,%rbp
+  8030b6:	53                   	push   %rbx
+  8030b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8030bb:	48 89 f1             	mov    %rsi,%rcx
+  8030be:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  8030c1:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  8030c5:	48 8b 1a             	mov    (%rdx),%rbx
+  8030c8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030cb:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030d0:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030d4:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  8030d8:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  8030dc:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030de:	48 85 c0             	test   %rax,%rax
+  8030e1:	7f 06                	jg     8030e9 <sys_ipc_call_short+0x37>
+}
+  8030e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e7:	c9                   	leave
+  8030e8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030e9:	49 89 c0             	mov    %rax,%r8
+  8030ec:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8030f1:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  8030f8:	00 00 00 
+  8030fb:	be 27 00 00 00       	mov    $0x27,%esi
+  803100:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  803107:	00 00 00 
+  80310a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80310f:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  803116:	00 00 00 
+  803119:	41 ff d1             	call   *%r9
+
+000000000080311c <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80311c:	55                   	push   %rbp
+  80311d:	48 89 e5             	mov    %rsp,%rbp
+  803120:	53                   	push   %rbx
+  803121:	48 83 ec 08          	sub    $0x8,%rsp
+  803125:	89 f8                	mov    %edi,%eax
+  803127:	49 89 f2             	mov    %rsi,%r10
+  80312a:	48 89 d3             	mov    %rdx,%rbx
+  80312d:	48 89 cf             	mov    %rcx,%rdi
+  803130:	44 89 c6             	mov    %r8d,%esi
+  803133:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803136:	48 63 f6             	movslq %esi,%rsi
+  803139:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80313c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803141:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803144:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803148:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80314a:	48 85 c0             	test   %rax,%rax
+  80314d:	7f 06                	jg     803155 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80314f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803153:	c9                   	leave
+  803154:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803155:	49 89 c0             	mov    %rax,%r8
+  803158:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80315d:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  803164:	00 00 00 
+  803167:	be 27 00 00 00       	mov    $0x27,%esi
+  80316c:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  803173:	00 00 00 
+  803176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80317b:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  803182:	00 00 00 
+  803185:	41 ff d1             	call   *%r9
+
+0000000000803188 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+  80318c:	53                   	push   %rbx
+  80318d:	48 83 ec 08          	sub    $0x8,%rsp
+  803191:	48 89 fa             	mov    %rdi,%rdx
+  803194:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803197:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80319c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031a1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031b7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8031b9:	48 85 c0             	test   %rax,%rax
+  8031bc:	7f 06                	jg     8031c4 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8031be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031c2:	c9                   	leave
+  8031c3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8031c4:	49 89 c0             	mov    %rax,%r8
+  8031c7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8031cc:	48 ba 88 69 80 00 00 	movabs $0x806988,%rdx
+  8031d3:	00 00 00 
+  8031d6:	be 27 00 00 00       	mov    $0x27,%esi
+  8031db:	48 bf a7 69 80 00 00 	movabs $0x8069a7,%rdi
+  8031e2:	00 00 00 
+  8031e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ea:	49 b9 50 1a 80 00 00 	movabs $0x801a50,%r9
+  8031f1:	00 00 00 
+  8031f4:	41 ff d1             	call   *%r9
+
+00000000008031f7 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8031f7:	55                   	push   %rbp
+  8031f8:	48 89 e5             	mov    %rsp,%rbp
+  8031fb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8031fc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803201:	ba 00 00 00 00       	mov    $0x0,%edx
+  803206:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80320b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803210:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803215:	be 00 00 00 00       	mov    $0x0,%esi
+  80321a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803220:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803226:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803228:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80322c:	c9                   	leave
+  80322d:	c3                   	ret
+
+000000000080322e <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  80322e:	55                   	push   %rbp
+  80322f:	48 89 e5             	mov    %rsp,%rbp
+  803232:	53                   	push   %rbx
+  803233:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803236:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80323b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803240:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803245:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80324a:	be 00 00 00 00       	mov    $0x0,%esi
+  80324f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803255:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80325b:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80325d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803261:	c9                   	leave
+  803262:	c3                   	ret
+
+0000000000803263 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803263:	55                   	push   %rbp
+  803264:	48 89 e5             	mov    %rsp,%rbp
+  803267:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803268:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80326d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803272:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80327c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803281:	be 00 00 00 00       	mov    $0x0,%esi
+  803286:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80328c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803292:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803294:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803298:	c9                   	leave
+  803299:	c3                   	ret
+
+000000000080329a <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80329a:	55                   	push   %rbp
+  80329b:	48 89 e5             	mov    %rsp,%rbp
+  80329e:	53                   	push   %rbx
+  80329f:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8032a3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8032a8:	cd 30                	int    $0x30
+  8032aa:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  8032ac:	85 c0                	test   %eax,%eax
+  8032ae:	0f 88 85 00 00 00    	js     803339 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8032b4:	0f 84 ac 00 00 00    	je     803366 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  8032ba:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8032c0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8032c7:	00 00 00 
+  8032ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032cf:	89 c2                	mov    %eax,%edx
+  8032d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032db:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  8032e2:	00 00 00 
+  8032e5:	ff d0                	call   *%rax
+  8032e7:	85 c0                	test   %eax,%eax
+  8032e9:	0f 88 a8 00 00 00    	js     803397 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8032ef:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8032f6:	00 00 00 
+  8032f9:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  803300:	89 df                	mov    %ebx,%edi
+  803302:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	0f 88 ae 00 00 00    	js     8033c4 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803316:	be 02 00 00 00       	mov    $0x2,%esi
+  80331b:	89 df                	mov    %ebx,%edi
+  80331d:	48 b8 81 2d 80 00 00 	movabs $0x802d81,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	0f 88 c0 00 00 00    	js     8033f1 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803331:	89 d8                	mov    %ebx,%eax
+  803333:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803339:	89 c1                	mov    %eax,%ecx
+  80333b:	48 ba b5 69 80 00 00 	movabs $0x8069b5,%rdx
+  803342:	00 00 00 
+  803345:	be 20 00 00 00       	mov    $0x20,%esi
+  80334a:	48 bf c5 69 80 00 00 	movabs $0x8069c5,%rdi
+  803351:	00 00 00 
+  803354:	b8 00 00 00 00       	mov    $0x0,%eax
+  803359:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803360:	00 00 00 
+  803363:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803366:	48 b8 64 2b 80 00 00 	movabs $0x802b64,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+  803372:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803377:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80337e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803385:	00 00 00 
+  803388:	48 01 d0             	add    %rdx,%rax
+  80338b:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  803392:	00 00 00 
+        return 0;
+  803395:	eb 9a                	jmp    803331 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803397:	89 c1                	mov    %eax,%ecx
+  803399:	48 ba d0 69 80 00 00 	movabs $0x8069d0,%rdx
+  8033a0:	00 00 00 
+  8033a3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8033a8:	48 bf c5 69 80 00 00 	movabs $0x8069c5,%rdi
+  8033af:	00 00 00 
+  8033b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b7:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  8033be:	00 00 00 
+  8033c1:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8033c4:	89 c1                	mov    %eax,%ecx
+  8033c6:	48 ba 18 6a 80 00 00 	movabs $0x806a18,%rdx
+  8033cd:	00 00 00 
+  8033d0:	be 32 00 00 00       	mov    $0x32,%esi
+  8033d5:	48 bf c5 69 80 00 00 	movabs $0x8069c5,%rdi
+  8033dc:	00 00 00 
+  8033df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e4:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  8033eb:	00 00 00 
+  8033ee:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8033f1:	89 c1                	mov    %eax,%ecx
+  8033f3:	48 ba e3 69 80 00 00 	movabs $0x8069e3,%rdx
+  8033fa:	00 00 00 
+  8033fd:	be 37 00 00 00       	mov    $0x37,%esi
+  803402:	48 bf c5 69 80 00 00 	movabs $0x8069c5,%rdi
+  803409:	00 00 00 
+  80340c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803411:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803418:	00 00 00 
+  80341b:	41 ff d0             	call   *%r8
+
+000000000080341e <sfork>:
+
+envid_t
+sfork() {
+  80341e:	55                   	push   %rbp
+  80341f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803422:	48 ba fa 69 80 00 00 	movabs $0x8069fa,%rdx
+  803429:	00 00 00 
+  80342c:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803431:	48 bf c5 69 80 00 00 	movabs $0x8069c5,%rdi
+  803438:	00 00 00 
+  80343b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803440:	48 b9 50 1a 80 00 00 	movabs $0x801a50,%rcx
+  803447:	00 00 00 
+  80344a:	ff d1                	call   *%rcx
+
+000000000080344c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80344c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803453:	ff ff ff 
+  803456:	48 01 f8             	add    %rdi,%rax
+  803459:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80345d:	c3                   	ret
+
+000000000080345e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80345e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803465:	ff ff ff 
+  803468:	48 01 f8             	add    %rdi,%rax
+  80346b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80346f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803475:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803479:	c3                   	ret
+
+000000000080347a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80347a:	55                   	push   %rbp
+  80347b:	48 89 e5             	mov    %rsp,%rbp
+  80347e:	41 57                	push   %r15
+  803480:	41 56                	push   %r14
+  803482:	41 55                	push   %r13
+  803484:	41 54                	push   %r12
+  803486:	53                   	push   %rbx
+  803487:	48 83 ec 08          	sub    $0x8,%rsp
+  80348b:	49 89 ff             	mov    %rdi,%r15
+  80348e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803493:	49 bd 33 4a 80 00 00 	movabs $0x804a33,%r13
+  80349a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80349d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8034a3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8034a6:	48 89 df             	mov    %rbx,%rdi
+  8034a9:	41 ff d5             	call   *%r13
+  8034ac:	83 e0 04             	and    $0x4,%eax
+  8034af:	74 17                	je     8034c8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8034b1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8034b8:	4c 39 f3             	cmp    %r14,%rbx
+  8034bb:	75 e6                	jne    8034a3 <fd_alloc+0x29>
+  8034bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8034c3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8034c8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8034cb:	48 83 c4 08          	add    $0x8,%rsp
+  8034cf:	5b                   	pop    %rbx
+  8034d0:	41 5c                	pop    %r12
+  8034d2:	41 5d                	pop    %r13
+  8034d4:	41 5e                	pop    %r14
+  8034d6:	41 5f                	pop    %r15
+  8034d8:	5d                   	pop    %rbp
+  8034d9:	c3                   	ret
+
+00000000008034da <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8034da:	83 ff 1f             	cmp    $0x1f,%edi
+  8034dd:	77 39                	ja     803518 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8034df:	55                   	push   %rbp
+  8034e0:	48 89 e5             	mov    %rsp,%rbp
+  8034e3:	41 54                	push   %r12
+  8034e5:	53                   	push   %rbx
+  8034e6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8034e9:	48 63 df             	movslq %edi,%rbx
+  8034ec:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8034f3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8034f7:	48 89 df             	mov    %rbx,%rdi
+  8034fa:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  803501:	00 00 00 
+  803504:	ff d0                	call   *%rax
+  803506:	a8 04                	test   $0x4,%al
+  803508:	74 14                	je     80351e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80350a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80350e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803513:	5b                   	pop    %rbx
+  803514:	41 5c                	pop    %r12
+  803516:	5d                   	pop    %rbp
+  803517:	c3                   	ret
+        return -E_INVAL;
+  803518:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80351d:	c3                   	ret
+        return -E_INVAL;
+  80351e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803523:	eb ee                	jmp    803513 <fd_lookup+0x39>
+
+0000000000803525 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803525:	55                   	push   %rbp
+  803526:	48 89 e5             	mov    %rsp,%rbp
+  803529:	41 54                	push   %r12
+  80352b:	53                   	push   %rbx
+  80352c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80352f:	48 b8 c0 6a 80 00 00 	movabs $0x806ac0,%rax
+  803536:	00 00 00 
+  803539:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  803540:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803543:	39 3b                	cmp    %edi,(%rbx)
+  803545:	74 47                	je     80358e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803547:	48 83 c0 08          	add    $0x8,%rax
+  80354b:	48 8b 18             	mov    (%rax),%rbx
+  80354e:	48 85 db             	test   %rbx,%rbx
+  803551:	75 f0                	jne    803543 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803553:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80355a:	00 00 00 
+  80355d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803563:	89 fa                	mov    %edi,%edx
+  803565:	48 bf 38 6a 80 00 00 	movabs $0x806a38,%rdi
+  80356c:	00 00 00 
+  80356f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803574:	48 b9 a0 1b 80 00 00 	movabs $0x801ba0,%rcx
+  80357b:	00 00 00 
+  80357e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803580:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803585:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803589:	5b                   	pop    %rbx
+  80358a:	41 5c                	pop    %r12
+  80358c:	5d                   	pop    %rbp
+  80358d:	c3                   	ret
+            return 0;
+  80358e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803593:	eb f0                	jmp    803585 <dev_lookup+0x60>
+
+0000000000803595 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803595:	55                   	push   %rbp
+  803596:	48 89 e5             	mov    %rsp,%rbp
+  803599:	41 55                	push   %r13
+  80359b:	41 54                	push   %r12
+  80359d:	53                   	push   %rbx
+  80359e:	48 83 ec 18          	sub    $0x18,%rsp
+  8035a2:	48 89 fb             	mov    %rdi,%rbx
+  8035a5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8035a8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8035af:	ff ff ff 
+  8035b2:	48 01 df             	add    %rbx,%rdi
+  8035b5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8035b9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035bd:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8035c4:	00 00 00 
+  8035c7:	ff d0                	call   *%rax
+  8035c9:	41 89 c5             	mov    %eax,%r13d
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	78 06                	js     8035d6 <fd_close+0x41>
+  8035d0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8035d4:	74 1a                	je     8035f0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8035d6:	45 84 e4             	test   %r12b,%r12b
+  8035d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035de:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8035e2:	44 89 e8             	mov    %r13d,%eax
+  8035e5:	48 83 c4 18          	add    $0x18,%rsp
+  8035e9:	5b                   	pop    %rbx
+  8035ea:	41 5c                	pop    %r12
+  8035ec:	41 5d                	pop    %r13
+  8035ee:	5d                   	pop    %rbp
+  8035ef:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8035f0:	8b 3b                	mov    (%rbx),%edi
+  8035f2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035f6:	48 b8 25 35 80 00 00 	movabs $0x803525,%rax
+  8035fd:	00 00 00 
+  803600:	ff d0                	call   *%rax
+  803602:	41 89 c5             	mov    %eax,%r13d
+  803605:	85 c0                	test   %eax,%eax
+  803607:	78 1b                	js     803624 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803609:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80360d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803611:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803617:	48 85 c0             	test   %rax,%rax
+  80361a:	74 08                	je     803624 <fd_close+0x8f>
+  80361c:	48 89 df             	mov    %rbx,%rdi
+  80361f:	ff d0                	call   *%rax
+  803621:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803624:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803629:	48 89 de             	mov    %rbx,%rsi
+  80362c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803631:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  803638:	00 00 00 
+  80363b:	ff d0                	call   *%rax
+    return res;
+  80363d:	eb a3                	jmp    8035e2 <fd_close+0x4d>
+
+000000000080363f <close>:
+
+int
+close(int fdnum) {
+  80363f:	55                   	push   %rbp
+  803640:	48 89 e5             	mov    %rsp,%rbp
+  803643:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803647:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80364b:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  803652:	00 00 00 
+  803655:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803657:	85 c0                	test   %eax,%eax
+  803659:	78 15                	js     803670 <close+0x31>
+
+    return fd_close(fd, 1);
+  80365b:	be 01 00 00 00       	mov    $0x1,%esi
+  803660:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803664:	48 b8 95 35 80 00 00 	movabs $0x803595,%rax
+  80366b:	00 00 00 
+  80366e:	ff d0                	call   *%rax
+}
+  803670:	c9                   	leave
+  803671:	c3                   	ret
+
+0000000000803672 <close_all>:
+
+void
+close_all(void) {
+  803672:	55                   	push   %rbp
+  803673:	48 89 e5             	mov    %rsp,%rbp
+  803676:	41 54                	push   %r12
+  803678:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80367e:	49 bc 3f 36 80 00 00 	movabs $0x80363f,%r12
+  803685:	00 00 00 
+  803688:	89 df                	mov    %ebx,%edi
+  80368a:	41 ff d4             	call   *%r12
+  80368d:	83 c3 01             	add    $0x1,%ebx
+  803690:	83 fb 20             	cmp    $0x20,%ebx
+  803693:	75 f3                	jne    803688 <close_all+0x16>
+}
+  803695:	5b                   	pop    %rbx
+  803696:	41 5c                	pop    %r12
+  803698:	5d                   	pop    %rbp
+  803699:	c3                   	ret
+
+000000000080369a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80369a:	55                   	push   %rbp
+  80369b:	48 89 e5             	mov    %rsp,%rbp
+  80369e:	41 57                	push   %r15
+  8036a0:	41 56                	push   %r14
+  8036a2:	41 55                	push   %r13
+  8036a4:	41 54                	push   %r12
+  8036a6:	53                   	push   %rbx
+  8036a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8036ab:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8036ae:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036b2:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+  8036be:	89 c3                	mov    %eax,%ebx
+  8036c0:	85 c0                	test   %eax,%eax
+  8036c2:	0f 88 b8 00 00 00    	js     803780 <dup+0xe6>
+    close(newfdnum);
+  8036c8:	44 89 e7             	mov    %r12d,%edi
+  8036cb:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  8036d2:	00 00 00 
+  8036d5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8036d7:	4d 63 ec             	movslq %r12d,%r13
+  8036da:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8036e1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8036e5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8036e9:	4c 89 ff             	mov    %r15,%rdi
+  8036ec:	49 be 5e 34 80 00 00 	movabs $0x80345e,%r14
+  8036f3:	00 00 00 
+  8036f6:	41 ff d6             	call   *%r14
+  8036f9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8036fc:	4c 89 ef             	mov    %r13,%rdi
+  8036ff:	41 ff d6             	call   *%r14
+  803702:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803705:	48 89 df             	mov    %rbx,%rdi
+  803708:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803714:	a8 04                	test   $0x4,%al
+  803716:	74 2b                	je     803743 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803718:	41 89 c1             	mov    %eax,%r9d
+  80371b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803721:	4c 89 f1             	mov    %r14,%rcx
+  803724:	ba 00 00 00 00       	mov    $0x0,%edx
+  803729:	48 89 de             	mov    %rbx,%rsi
+  80372c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803731:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  803738:	00 00 00 
+  80373b:	ff d0                	call   *%rax
+  80373d:	89 c3                	mov    %eax,%ebx
+  80373f:	85 c0                	test   %eax,%eax
+  803741:	78 4e                	js     803791 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803743:	4c 89 ff             	mov    %r15,%rdi
+  803746:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  80374d:	00 00 00 
+  803750:	ff d0                	call   *%rax
+  803752:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803755:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80375b:	4c 89 e9             	mov    %r13,%rcx
+  80375e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803763:	4c 89 fe             	mov    %r15,%rsi
+  803766:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376b:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  803772:	00 00 00 
+  803775:	ff d0                	call   *%rax
+  803777:	89 c3                	mov    %eax,%ebx
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	78 14                	js     803791 <dup+0xf7>
+
+    return newfdnum;
+  80377d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803780:	89 d8                	mov    %ebx,%eax
+  803782:	48 83 c4 18          	add    $0x18,%rsp
+  803786:	5b                   	pop    %rbx
+  803787:	41 5c                	pop    %r12
+  803789:	41 5d                	pop    %r13
+  80378b:	41 5e                	pop    %r14
+  80378d:	41 5f                	pop    %r15
+  80378f:	5d                   	pop    %rbp
+  803790:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803791:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803796:	4c 89 ee             	mov    %r13,%rsi
+  803799:	bf 00 00 00 00       	mov    $0x0,%edi
+  80379e:	49 bc 14 2d 80 00 00 	movabs $0x802d14,%r12
+  8037a5:	00 00 00 
+  8037a8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8037ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b0:	4c 89 f6             	mov    %r14,%rsi
+  8037b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b8:	41 ff d4             	call   *%r12
+    return res;
+  8037bb:	eb c3                	jmp    803780 <dup+0xe6>
+
+00000000008037bd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8037bd:	55                   	push   %rbp
+  8037be:	48 89 e5             	mov    %rsp,%rbp
+  8037c1:	41 56                	push   %r14
+  8037c3:	41 55                	push   %r13
+  8037c5:	41 54                	push   %r12
+  8037c7:	53                   	push   %rbx
+  8037c8:	48 83 ec 10          	sub    $0x10,%rsp
+  8037cc:	89 fb                	mov    %edi,%ebx
+  8037ce:	49 89 f4             	mov    %rsi,%r12
+  8037d1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037d4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037d8:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	85 c0                	test   %eax,%eax
+  8037e6:	78 4c                	js     803834 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037e8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8037ec:	41 8b 3e             	mov    (%r14),%edi
+  8037ef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037f3:	48 b8 25 35 80 00 00 	movabs $0x803525,%rax
+  8037fa:	00 00 00 
+  8037fd:	ff d0                	call   *%rax
+  8037ff:	85 c0                	test   %eax,%eax
+  803801:	78 35                	js     803838 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803803:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803807:	83 e0 03             	and    $0x3,%eax
+  80380a:	83 f8 01             	cmp    $0x1,%eax
+  80380d:	74 2d                	je     80383c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80380f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803813:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803817:	48 85 c0             	test   %rax,%rax
+  80381a:	74 56                	je     803872 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80381c:	4c 89 ea             	mov    %r13,%rdx
+  80381f:	4c 89 e6             	mov    %r12,%rsi
+  803822:	4c 89 f7             	mov    %r14,%rdi
+  803825:	ff d0                	call   *%rax
+}
+  803827:	48 83 c4 10          	add    $0x10,%rsp
+  80382b:	5b                   	pop    %rbx
+  80382c:	41 5c                	pop    %r12
+  80382e:	41 5d                	pop    %r13
+  803830:	41 5e                	pop    %r14
+  803832:	5d                   	pop    %rbp
+  803833:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803834:	48 98                	cltq
+  803836:	eb ef                	jmp    803827 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803838:	48 98                	cltq
+  80383a:	eb eb                	jmp    803827 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80383c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803843:	00 00 00 
+  803846:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80384c:	89 da                	mov    %ebx,%edx
+  80384e:	48 bf 79 6a 80 00 00 	movabs $0x806a79,%rdi
+  803855:	00 00 00 
+  803858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385d:	48 b9 a0 1b 80 00 00 	movabs $0x801ba0,%rcx
+  803864:	00 00 00 
+  803867:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803869:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803870:	eb b5                	jmp    803827 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803872:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803879:	eb ac                	jmp    803827 <read+0x6a>
+
+000000000080387b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80387b:	55                   	push   %rbp
+  80387c:	48 89 e5             	mov    %rsp,%rbp
+  80387f:	41 57                	push   %r15
+  803881:	41 56                	push   %r14
+  803883:	41 55                	push   %r13
+  803885:	41 54                	push   %r12
+  803887:	53                   	push   %rbx
+  803888:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80388c:	48 85 d2             	test   %rdx,%rdx
+  80388f:	74 54                	je     8038e5 <readn+0x6a>
+  803891:	41 89 fd             	mov    %edi,%r13d
+  803894:	49 89 f6             	mov    %rsi,%r14
+  803897:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80389a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80389f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8038a4:	49 bf bd 37 80 00 00 	movabs $0x8037bd,%r15
+  8038ab:	00 00 00 
+  8038ae:	4c 89 e2             	mov    %r12,%rdx
+  8038b1:	48 29 f2             	sub    %rsi,%rdx
+  8038b4:	4c 01 f6             	add    %r14,%rsi
+  8038b7:	44 89 ef             	mov    %r13d,%edi
+  8038ba:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8038bd:	85 c0                	test   %eax,%eax
+  8038bf:	78 20                	js     8038e1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8038c1:	01 c3                	add    %eax,%ebx
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	74 08                	je     8038cf <readn+0x54>
+  8038c7:	48 63 f3             	movslq %ebx,%rsi
+  8038ca:	4c 39 e6             	cmp    %r12,%rsi
+  8038cd:	72 df                	jb     8038ae <readn+0x33>
+    }
+    return res;
+  8038cf:	48 63 c3             	movslq %ebx,%rax
+}
+  8038d2:	48 83 c4 08          	add    $0x8,%rsp
+  8038d6:	5b                   	pop    %rbx
+  8038d7:	41 5c                	pop    %r12
+  8038d9:	41 5d                	pop    %r13
+  8038db:	41 5e                	pop    %r14
+  8038dd:	41 5f                	pop    %r15
+  8038df:	5d                   	pop    %rbp
+  8038e0:	c3                   	ret
+        if (inc < 0) return inc;
+  8038e1:	48 98                	cltq
+  8038e3:	eb ed                	jmp    8038d2 <readn+0x57>
+    int inc = 1, res = 0;
+  8038e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038ea:	eb e3                	jmp    8038cf <readn+0x54>
+
+00000000008038ec <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8038ec:	55                   	push   %rbp
+  8038ed:	48 89 e5             	mov    %rsp,%rbp
+  8038f0:	41 56                	push   %r14
+  8038f2:	41 55                	push   %r13
+  8038f4:	41 54                	push   %r12
+  8038f6:	53                   	push   %rbx
+  8038f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8038fb:	89 fb                	mov    %edi,%ebx
+  8038fd:	49 89 f4             	mov    %rsi,%r12
+  803900:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803903:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803907:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  80390e:	00 00 00 
+  803911:	ff d0                	call   *%rax
+  803913:	85 c0                	test   %eax,%eax
+  803915:	78 47                	js     80395e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803917:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80391b:	41 8b 3e             	mov    (%r14),%edi
+  80391e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803922:	48 b8 25 35 80 00 00 	movabs $0x803525,%rax
+  803929:	00 00 00 
+  80392c:	ff d0                	call   *%rax
+  80392e:	85 c0                	test   %eax,%eax
+  803930:	78 30                	js     803962 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803932:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803937:	74 2d                	je     803966 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803939:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80393d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803941:	48 85 c0             	test   %rax,%rax
+  803944:	74 56                	je     80399c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803946:	4c 89 ea             	mov    %r13,%rdx
+  803949:	4c 89 e6             	mov    %r12,%rsi
+  80394c:	4c 89 f7             	mov    %r14,%rdi
+  80394f:	ff d0                	call   *%rax
+}
+  803951:	48 83 c4 10          	add    $0x10,%rsp
+  803955:	5b                   	pop    %rbx
+  803956:	41 5c                	pop    %r12
+  803958:	41 5d                	pop    %r13
+  80395a:	41 5e                	pop    %r14
+  80395c:	5d                   	pop    %rbp
+  80395d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80395e:	48 98                	cltq
+  803960:	eb ef                	jmp    803951 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803962:	48 98                	cltq
+  803964:	eb eb                	jmp    803951 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803966:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80396d:	00 00 00 
+  803970:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803976:	89 da                	mov    %ebx,%edx
+  803978:	48 bf 95 6a 80 00 00 	movabs $0x806a95,%rdi
+  80397f:	00 00 00 
+  803982:	b8 00 00 00 00       	mov    $0x0,%eax
+  803987:	48 b9 a0 1b 80 00 00 	movabs $0x801ba0,%rcx
+  80398e:	00 00 00 
+  803991:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803993:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80399a:	eb b5                	jmp    803951 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80399c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8039a3:	eb ac                	jmp    803951 <write+0x65>
+
+00000000008039a5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8039a5:	55                   	push   %rbp
+  8039a6:	48 89 e5             	mov    %rsp,%rbp
+  8039a9:	53                   	push   %rbx
+  8039aa:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ae:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039b0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8039b4:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8039bb:	00 00 00 
+  8039be:	ff d0                	call   *%rax
+  8039c0:	85 c0                	test   %eax,%eax
+  8039c2:	78 0c                	js     8039d0 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8039c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8039cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039d4:	c9                   	leave
+  8039d5:	c3                   	ret
+
+00000000008039d6 <tell>:
+
+int tell(int fdnum) {
+  8039d6:	55                   	push   %rbp
+  8039d7:	48 89 e5             	mov    %rsp,%rbp
+  8039da:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039de:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8039e2:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8039e9:	00 00 00 
+  8039ec:	ff d0                	call   *%rax
+  8039ee:	85 c0                	test   %eax,%eax
+  8039f0:	78 07                	js     8039f9 <tell+0x23>
+
+    return fd->fd_offset;
+  8039f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f6:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8039f9:	c9                   	leave
+  8039fa:	c3                   	ret
+
+00000000008039fb <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8039fb:	55                   	push   %rbp
+  8039fc:	48 89 e5             	mov    %rsp,%rbp
+  8039ff:	41 55                	push   %r13
+  803a01:	41 54                	push   %r12
+  803a03:	53                   	push   %rbx
+  803a04:	48 83 ec 18          	sub    $0x18,%rsp
+  803a08:	89 fb                	mov    %edi,%ebx
+  803a0a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a0d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a11:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+  803a1d:	85 c0                	test   %eax,%eax
+  803a1f:	78 38                	js     803a59 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a21:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803a25:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803a29:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803a2d:	48 b8 25 35 80 00 00 	movabs $0x803525,%rax
+  803a34:	00 00 00 
+  803a37:	ff d0                	call   *%rax
+  803a39:	85 c0                	test   %eax,%eax
+  803a3b:	78 1c                	js     803a59 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a3d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803a42:	74 20                	je     803a64 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803a44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a48:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803a4c:	48 85 c0             	test   %rax,%rax
+  803a4f:	74 47                	je     803a98 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803a51:	44 89 e6             	mov    %r12d,%esi
+  803a54:	4c 89 ef             	mov    %r13,%rdi
+  803a57:	ff d0                	call   *%rax
+}
+  803a59:	48 83 c4 18          	add    $0x18,%rsp
+  803a5d:	5b                   	pop    %rbx
+  803a5e:	41 5c                	pop    %r12
+  803a60:	41 5d                	pop    %r13
+  803a62:	5d                   	pop    %rbp
+  803a63:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803a64:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803a6b:	00 00 00 
+  803a6e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803a74:	89 da                	mov    %ebx,%edx
+  803a76:	48 bf 58 6a 80 00 00 	movabs $0x806a58,%rdi
+  803a7d:	00 00 00 
+  803a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a85:	48 b9 a0 1b 80 00 00 	movabs $0x801ba0,%rcx
+  803a8c:	00 00 00 
+  803a8f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803a91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a96:	eb c1                	jmp    803a59 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803a98:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803a9d:	eb ba                	jmp    803a59 <ftruncate+0x5e>
+
+0000000000803a9f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803a9f:	55                   	push   %rbp
+  803aa0:	48 89 e5             	mov    %rsp,%rbp
+  803aa3:	41 54                	push   %r12
+  803aa5:	53                   	push   %rbx
+  803aa6:	48 83 ec 10          	sub    $0x10,%rsp
+  803aaa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803aad:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803ab1:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+  803abd:	85 c0                	test   %eax,%eax
+  803abf:	78 63                	js     803b24 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803ac1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803ac5:	41 8b 3c 24          	mov    (%r12),%edi
+  803ac9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803acd:	48 b8 25 35 80 00 00 	movabs $0x803525,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+  803ad9:	85 c0                	test   %eax,%eax
+  803adb:	78 47                	js     803b24 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803add:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ae1:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803ae6:	74 45                	je     803b2d <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803ae8:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803aeb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803af2:	00 00 00 
+    stat->st_isdir = 0;
+  803af5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803afc:	00 00 00 
+    stat->st_ino = 0;
+  803aff:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803b06:	00 00 00 00 
+    stat->st_version = 0;
+  803b0a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803b11:	00 00 00 
+    stat->st_dev = dev;
+  803b14:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803b1b:	48 89 de             	mov    %rbx,%rsi
+  803b1e:	4c 89 e7             	mov    %r12,%rdi
+  803b21:	ff 50 28             	call   *0x28(%rax)
+}
+  803b24:	48 83 c4 10          	add    $0x10,%rsp
+  803b28:	5b                   	pop    %rbx
+  803b29:	41 5c                	pop    %r12
+  803b2b:	5d                   	pop    %rbp
+  803b2c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803b2d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803b32:	eb f0                	jmp    803b24 <fstat+0x85>
+
+0000000000803b34 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	41 54                	push   %r12
+  803b3a:	53                   	push   %rbx
+  803b3b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803b3e:	be 00 00 00 00       	mov    $0x0,%esi
+  803b43:	48 b8 55 40 80 00 00 	movabs $0x804055,%rax
+  803b4a:	00 00 00 
+  803b4d:	ff d0                	call   *%rax
+  803b4f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803b51:	85 c0                	test   %eax,%eax
+  803b53:	78 25                	js     803b7a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803b55:	4c 89 e6             	mov    %r12,%rsi
+  803b58:	89 c7                	mov    %eax,%edi
+  803b5a:	48 b8 9f 3a 80 00 00 	movabs $0x803a9f,%rax
+  803b61:	00 00 00 
+  803b64:	ff d0                	call   *%rax
+  803b66:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803b69:	89 df                	mov    %ebx,%edi
+  803b6b:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+
+    return res;
+  803b77:	44 89 e3             	mov    %r12d,%ebx
+}
+  803b7a:	89 d8                	mov    %ebx,%eax
+  803b7c:	5b                   	pop    %rbx
+  803b7d:	41 5c                	pop    %r12
+  803b7f:	5d                   	pop    %rbp
+  803b80:	c3                   	ret
+
+0000000000803b81 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b81:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803b88:	00 00 00 
+  803b8b:	83 38 00             	cmpl   $0x0,(%rax)
+  803b8e:	74 0a                	je     803b9a <fsipc_env+0x19>
+    return fsenv;
+}
+  803b90:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803b97:	00 00 
+  803b99:	c3                   	ret
+fsipc_env(void) {
+  803b9a:	55                   	push   %rbp
+  803b9b:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803b9e:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ba3:	48 b8 3d 5d 80 00 00 	movabs $0x805d3d,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+  803baf:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803bb6:	00 00 
+}
+  803bb8:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803bbf:	00 00 
+  803bc1:	5d                   	pop    %rbp
+  803bc2:	c3                   	ret
+
+0000000000803bc3 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803bc3:	55                   	push   %rbp
+  803bc4:	48 89 e5             	mov    %rsp,%rbp
+  803bc7:	53                   	push   %rbx
+  803bc8:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803bcc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803bd3:	00 
+  803bd4:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803bdb:	00 
+  803bdc:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803be3:	00 
+  803be4:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803beb:	00 
+  803bec:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803bf3:	00 
+
+    assert(size <= sizeof(words));
+  803bf4:	48 83 fa 28          	cmp    $0x28,%rdx
+  803bf8:	77 38                	ja     803c32 <fsipc_short+0x6f>
+  803bfa:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803bfc:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803c00:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  803c07:	00 00 00 
+  803c0a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803c0c:	48 b8 81 3b 80 00 00 	movabs $0x803b81,%rax
+  803c13:	00 00 00 
+  803c16:	ff d0                	call   *%rax
+  803c18:	89 c7                	mov    %eax,%edi
+  803c1a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803c1e:	89 de                	mov    %ebx,%esi
+  803c20:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+}
+  803c2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c30:	c9                   	leave
+  803c31:	c3                   	ret
+    assert(size <= sizeof(words));
+  803c32:	48 b9 e0 6a 80 00 00 	movabs $0x806ae0,%rcx
+  803c39:	00 00 00 
+  803c3c:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803c43:	00 00 00 
+  803c46:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803c4b:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803c52:	00 00 00 
+  803c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5a:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803c61:	00 00 00 
+  803c64:	41 ff d0             	call   *%r8
+
+0000000000803c67 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803c67:	55                   	push   %rbp
+  803c68:	48 89 e5             	mov    %rsp,%rbp
+  803c6b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803c6f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c72:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803c75:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803c78:	ba 08 00 00 00       	mov    $0x8,%edx
+  803c7d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803c81:	bf 02 00 00 00       	mov    $0x2,%edi
+  803c86:	48 b8 c3 3b 80 00 00 	movabs $0x803bc3,%rax
+  803c8d:	00 00 00 
+  803c90:	ff d0                	call   *%rax
+}
+  803c92:	c9                   	leave
+  803c93:	c3                   	ret
+
+0000000000803c94 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803c94:	55                   	push   %rbp
+  803c95:	48 89 e5             	mov    %rsp,%rbp
+  803c98:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803c9c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803c9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803ca2:	ba 04 00 00 00       	mov    $0x4,%edx
+  803ca7:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803cab:	bf 06 00 00 00       	mov    $0x6,%edi
+  803cb0:	48 b8 c3 3b 80 00 00 	movabs $0x803bc3,%rax
+  803cb7:	00 00 00 
+  803cba:	ff d0                	call   *%rax
+}
+  803cbc:	c9                   	leave
+  803cbd:	c3                   	ret
+
+0000000000803cbe <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803cbe:	55                   	push   %rbp
+  803cbf:	48 89 e5             	mov    %rsp,%rbp
+  803cc2:	41 54                	push   %r12
+  803cc4:	53                   	push   %rbx
+  803cc5:	48 83 ec 10          	sub    $0x10,%rsp
+  803cc9:	89 fb                	mov    %edi,%ebx
+  803ccb:	49 89 f4             	mov    %rsi,%r12
+  803cce:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803cd2:	48 b8 81 3b 80 00 00 	movabs $0x803b81,%rax
+  803cd9:	00 00 00 
+  803cdc:	ff d0                	call   *%rax
+  803cde:	89 c7                	mov    %eax,%edi
+  803ce0:	6a 00                	push   $0x0
+  803ce2:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803ce6:	50                   	push   %rax
+  803ce7:	4d 89 e1             	mov    %r12,%r9
+  803cea:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803cf0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cf5:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803cfc:	00 00 00 
+  803cff:	89 de                	mov    %ebx,%esi
+  803d01:	48 b8 3b 5c 80 00 00 	movabs $0x805c3b,%rax
+  803d08:	00 00 00 
+  803d0b:	ff d0                	call   *%rax
+}
+  803d0d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803d11:	5b                   	pop    %rbx
+  803d12:	41 5c                	pop    %r12
+  803d14:	5d                   	pop    %rbp
+  803d15:	c3                   	ret
+
+0000000000803d16 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803d16:	55                   	push   %rbp
+  803d17:	48 89 e5             	mov    %rsp,%rbp
+  803d1a:	41 54                	push   %r12
+  803d1c:	53                   	push   %rbx
+  803d1d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803d20:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803d23:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803d2a:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d31:	be 00 00 00 00       	mov    $0x0,%esi
+  803d36:	bf 05 00 00 00       	mov    $0x5,%edi
+  803d3b:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  803d42:	00 00 00 
+  803d45:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d47:	85 c0                	test   %eax,%eax
+  803d49:	78 5a                	js     803da5 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803d4b:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803d52:	00 00 00 
+  803d55:	4c 89 e6             	mov    %r12,%rsi
+  803d58:	48 89 df             	mov    %rbx,%rdi
+  803d5b:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  803d62:	00 00 00 
+  803d65:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803d67:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803d6e:	00 
+  803d6f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803d75:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803d7c:	00 
+  803d7d:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803d83:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803d8a:	00 
+  803d8b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803d92:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803d99:	00 
+  803d9a:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803da0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803da5:	5b                   	pop    %rbx
+  803da6:	41 5c                	pop    %r12
+  803da8:	5d                   	pop    %rbp
+  803da9:	c3                   	ret
+
+0000000000803daa <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803daa:	55                   	push   %rbp
+  803dab:	48 89 e5             	mov    %rsp,%rbp
+  803dae:	41 57                	push   %r15
+  803db0:	41 56                	push   %r14
+  803db2:	41 55                	push   %r13
+  803db4:	41 54                	push   %r12
+  803db6:	53                   	push   %rbx
+  803db7:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803dbb:	48 85 ff             	test   %rdi,%rdi
+  803dbe:	0f 84 a1 00 00 00    	je     803e65 <devfile_read+0xbb>
+  803dc4:	49 89 ff             	mov    %rdi,%r15
+  803dc7:	49 89 f5             	mov    %rsi,%r13
+  803dca:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803dcd:	48 85 f6             	test   %rsi,%rsi
+  803dd0:	0f 84 c4 00 00 00    	je     803e9a <devfile_read+0xf0>
+    size_t total_read = 0;
+  803dd6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ddd:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803dde:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803de5:	00 00 00 
+  803de8:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803dec:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803def:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803df3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df8:	be 00 00 00 00       	mov    $0x0,%esi
+  803dfd:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e02:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803e0e:	85 c0                	test   %eax,%eax
+  803e10:	0f 88 b9 00 00 00    	js     803ecf <devfile_read+0x125>
+        assert(res <= n);
+  803e16:	48 63 d8             	movslq %eax,%rbx
+  803e19:	49 39 dc             	cmp    %rbx,%r12
+  803e1c:	0f 82 b1 00 00 00    	jb     803ed3 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803e22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803e27:	0f 87 db 00 00 00    	ja     803f08 <devfile_read+0x15e>
+        if (!res) {
+  803e2d:	85 c0                	test   %eax,%eax
+  803e2f:	74 21                	je     803e52 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803e31:	48 89 da             	mov    %rbx,%rdx
+  803e34:	4c 89 f6             	mov    %r14,%rsi
+  803e37:	4c 89 ef             	mov    %r13,%rdi
+  803e3a:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  803e41:	00 00 00 
+  803e44:	ff d0                	call   *%rax
+        total_read += res;
+  803e46:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803e4a:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803e4d:	49 29 dc             	sub    %rbx,%r12
+  803e50:	75 96                	jne    803de8 <devfile_read+0x3e>
+    return total_read;
+  803e52:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803e56:	48 83 c4 18          	add    $0x18,%rsp
+  803e5a:	5b                   	pop    %rbx
+  803e5b:	41 5c                	pop    %r12
+  803e5d:	41 5d                	pop    %r13
+  803e5f:	41 5e                	pop    %r14
+  803e61:	41 5f                	pop    %r15
+  803e63:	5d                   	pop    %rbp
+  803e64:	c3                   	ret
+    assert(fd);
+  803e65:	48 b9 16 6b 80 00 00 	movabs $0x806b16,%rcx
+  803e6c:	00 00 00 
+  803e6f:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803e76:	00 00 00 
+  803e79:	be 91 00 00 00       	mov    $0x91,%esi
+  803e7e:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803e85:	00 00 00 
+  803e88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e8d:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803e94:	00 00 00 
+  803e97:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e9a:	48 b9 19 6b 80 00 00 	movabs $0x806b19,%rcx
+  803ea1:	00 00 00 
+  803ea4:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803eab:	00 00 00 
+  803eae:	be 92 00 00 00       	mov    $0x92,%esi
+  803eb3:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803eba:	00 00 00 
+  803ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec2:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803ec9:	00 00 00 
+  803ecc:	41 ff d0             	call   *%r8
+            return res;
+  803ecf:	48 98                	cltq
+  803ed1:	eb 83                	jmp    803e56 <devfile_read+0xac>
+        assert(res <= n);
+  803ed3:	48 b9 1d 6b 80 00 00 	movabs $0x806b1d,%rcx
+  803eda:	00 00 00 
+  803edd:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803ee4:	00 00 00 
+  803ee7:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803eec:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803ef3:	00 00 00 
+  803ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efb:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803f02:	00 00 00 
+  803f05:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803f08:	48 b9 28 6b 80 00 00 	movabs $0x806b28,%rcx
+  803f0f:	00 00 00 
+  803f12:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803f19:	00 00 00 
+  803f1c:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803f21:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803f28:	00 00 00 
+  803f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f30:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  803f37:	00 00 00 
+  803f3a:	41 ff d0             	call   *%r8
+
+0000000000803f3d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803f3d:	55                   	push   %rbp
+  803f3e:	48 89 e5             	mov    %rsp,%rbp
+  803f41:	41 57                	push   %r15
+  803f43:	41 56                	push   %r14
+  803f45:	41 55                	push   %r13
+  803f47:	41 54                	push   %r12
+  803f49:	53                   	push   %rbx
+  803f4a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803f4e:	48 85 ff             	test   %rdi,%rdi
+  803f51:	0f 84 83 00 00 00    	je     803fda <devfile_write+0x9d>
+  803f57:	49 89 ff             	mov    %rdi,%r15
+  803f5a:	49 89 f4             	mov    %rsi,%r12
+  803f5d:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803f60:	48 85 f6             	test   %rsi,%rsi
+  803f63:	0f 84 a6 00 00 00    	je     80400f <devfile_write+0xd2>
+    size_t total_written = 0;
+  803f69:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803f6f:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803f76:	00 00 00 
+  803f79:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f7d:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803f80:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803f84:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803f89:	48 39 d3             	cmp    %rdx,%rbx
+  803f8c:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803f90:	4c 89 e6             	mov    %r12,%rsi
+  803f93:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803f9a:	00 00 00 
+  803f9d:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  803fa4:	00 00 00 
+  803fa7:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803fa9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fae:	be 00 00 00 00       	mov    $0x0,%esi
+  803fb3:	bf 04 00 00 00       	mov    $0x4,%edi
+  803fb8:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+        if (res < 0) {
+  803fc4:	85 c0                	test   %eax,%eax
+  803fc6:	78 7c                	js     804044 <devfile_write+0x107>
+        total_written += res;
+  803fc8:	48 98                	cltq
+  803fca:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803fcd:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803fd0:	48 29 c3             	sub    %rax,%rbx
+  803fd3:	75 a4                	jne    803f79 <devfile_write+0x3c>
+    return total_written;
+  803fd5:	4c 89 e8             	mov    %r13,%rax
+  803fd8:	eb 6c                	jmp    804046 <devfile_write+0x109>
+    assert(fd);
+  803fda:	48 b9 16 6b 80 00 00 	movabs $0x806b16,%rcx
+  803fe1:	00 00 00 
+  803fe4:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  803feb:	00 00 00 
+  803fee:	be bd 00 00 00       	mov    $0xbd,%esi
+  803ff3:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  803ffa:	00 00 00 
+  803ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804002:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  804009:	00 00 00 
+  80400c:	41 ff d0             	call   *%r8
+    assert(buf);
+  80400f:	48 b9 19 6b 80 00 00 	movabs $0x806b19,%rcx
+  804016:	00 00 00 
+  804019:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  804020:	00 00 00 
+  804023:	be be 00 00 00       	mov    $0xbe,%esi
+  804028:	48 bf 0b 6b 80 00 00 	movabs $0x806b0b,%rdi
+  80402f:	00 00 00 
+  804032:	b8 00 00 00 00       	mov    $0x0,%eax
+  804037:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  80403e:	00 00 00 
+  804041:	41 ff d0             	call   *%r8
+            return res;
+  804044:	48 98                	cltq
+}
+  804046:	48 83 c4 08          	add    $0x8,%rsp
+  80404a:	5b                   	pop    %rbx
+  80404b:	41 5c                	pop    %r12
+  80404d:	41 5d                	pop    %r13
+  80404f:	41 5e                	pop    %r14
+  804051:	41 5f                	pop    %r15
+  804053:	5d                   	pop    %rbp
+  804054:	c3                   	ret
+
+0000000000804055 <open>:
+open(const char *path, int mode) {
+  804055:	55                   	push   %rbp
+  804056:	48 89 e5             	mov    %rsp,%rbp
+  804059:	41 55                	push   %r13
+  80405b:	41 54                	push   %r12
+  80405d:	53                   	push   %rbx
+  80405e:	48 83 ec 18          	sub    $0x18,%rsp
+  804062:	49 89 fc             	mov    %rdi,%r12
+  804065:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  804068:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  80406f:	00 00 00 
+  804072:	ff d0                	call   *%rax
+  804074:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80407a:	0f 87 8f 00 00 00    	ja     80410f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804080:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804084:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  80408b:	00 00 00 
+  80408e:	ff d0                	call   *%rax
+  804090:	89 c3                	mov    %eax,%ebx
+  804092:	85 c0                	test   %eax,%eax
+  804094:	78 55                	js     8040eb <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804096:	4c 89 e6             	mov    %r12,%rsi
+  804099:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8040a0:	00 00 00 
+  8040a3:	48 89 df             	mov    %rbx,%rdi
+  8040a6:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  8040ad:	00 00 00 
+  8040b0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8040b2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8040b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8040c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8040c7:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  8040ce:	00 00 00 
+  8040d1:	ff d0                	call   *%rax
+  8040d3:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8040d5:	85 c0                	test   %eax,%eax
+  8040d7:	78 1f                	js     8040f8 <open+0xa3>
+    return fd2num(fd);
+  8040d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040dd:	48 b8 4c 34 80 00 00 	movabs $0x80344c,%rax
+  8040e4:	00 00 00 
+  8040e7:	ff d0                	call   *%rax
+  8040e9:	89 c3                	mov    %eax,%ebx
+}
+  8040eb:	89 d8                	mov    %ebx,%eax
+  8040ed:	48 83 c4 18          	add    $0x18,%rsp
+  8040f1:	5b                   	pop    %rbx
+  8040f2:	41 5c                	pop    %r12
+  8040f4:	41 5d                	pop    %r13
+  8040f6:	5d                   	pop    %rbp
+  8040f7:	c3                   	ret
+        fd_close(fd, 0);
+  8040f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8040fd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804101:	48 b8 95 35 80 00 00 	movabs $0x803595,%rax
+  804108:	00 00 00 
+  80410b:	ff d0                	call   *%rax
+        return res;
+  80410d:	eb dc                	jmp    8040eb <open+0x96>
+        return -E_BAD_PATH;
+  80410f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804114:	eb d5                	jmp    8040eb <open+0x96>
+
+0000000000804116 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804116:	55                   	push   %rbp
+  804117:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  80411a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80411f:	be 00 00 00 00       	mov    $0x0,%esi
+  804124:	bf 08 00 00 00       	mov    $0x8,%edi
+  804129:	48 b8 c3 3b 80 00 00 	movabs $0x803bc3,%rax
+  804130:	00 00 00 
+  804133:	ff d0                	call   *%rax
+}
+  804135:	5d                   	pop    %rbp
+  804136:	c3                   	ret
+
+0000000000804137 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804137:	55                   	push   %rbp
+  804138:	48 89 e5             	mov    %rsp,%rbp
+  80413b:	41 56                	push   %r14
+  80413d:	41 55                	push   %r13
+  80413f:	41 54                	push   %r12
+  804141:	53                   	push   %rbx
+  804142:	48 83 ec 10          	sub    $0x10,%rsp
+  804146:	41 89 f6             	mov    %esi,%r14d
+  804149:	49 89 d4             	mov    %rdx,%r12
+  80414c:	48 89 cb             	mov    %rcx,%rbx
+  80414f:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804152:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804156:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804162:	85 c0                	test   %eax,%eax
+  804164:	78 46                	js     8041ac <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804166:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80416a:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  804171:	00 00 00 
+  804174:	8b 00                	mov    (%rax),%eax
+  804176:	39 02                	cmp    %eax,(%rdx)
+  804178:	75 3f                	jne    8041b9 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80417a:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  804181:	00 00 00 
+  804184:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804187:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  804189:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80418d:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804191:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804195:	48 89 da             	mov    %rbx,%rdx
+  804198:	4c 89 e6             	mov    %r12,%rsi
+  80419b:	bf 09 00 00 00       	mov    $0x9,%edi
+  8041a0:	48 b8 be 3c 80 00 00 	movabs $0x803cbe,%rax
+  8041a7:	00 00 00 
+  8041aa:	ff d0                	call   *%rax
+}
+  8041ac:	48 83 c4 10          	add    $0x10,%rsp
+  8041b0:	5b                   	pop    %rbx
+  8041b1:	41 5c                	pop    %r12
+  8041b3:	41 5d                	pop    %r13
+  8041b5:	41 5e                	pop    %r14
+  8041b7:	5d                   	pop    %rbp
+  8041b8:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8041b9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8041be:	eb ec                	jmp    8041ac <file_map+0x75>
+
+00000000008041c0 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  8041c0:	55                   	push   %rbp
+  8041c1:	48 89 e5             	mov    %rsp,%rbp
+  8041c4:	41 54                	push   %r12
+  8041c6:	53                   	push   %rbx
+  8041c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8041cb:	41 89 f4             	mov    %esi,%r12d
+  8041ce:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8041d1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8041d5:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8041dc:	00 00 00 
+  8041df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8041e1:	85 c0                	test   %eax,%eax
+  8041e3:	78 3c                	js     804221 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8041e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e9:	48 ba 60 70 80 00 00 	movabs $0x807060,%rdx
+  8041f0:	00 00 00 
+  8041f3:	8b 0a                	mov    (%rdx),%ecx
+  8041f5:	39 08                	cmp    %ecx,(%rax)
+  8041f7:	75 31                	jne    80422a <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8041f9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041fc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8041ff:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804203:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804207:	ba 10 00 00 00       	mov    $0x10,%edx
+  80420c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804210:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804215:	48 b8 c3 3b 80 00 00 	movabs $0x803bc3,%rax
+  80421c:	00 00 00 
+  80421f:	ff d0                	call   *%rax
+}
+  804221:	48 83 c4 20          	add    $0x20,%rsp
+  804225:	5b                   	pop    %rbx
+  804226:	41 5c                	pop    %r12
+  804228:	5d                   	pop    %rbp
+  804229:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80422a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80422f:	eb f0                	jmp    804221 <file_msync+0x61>
+
+0000000000804231 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804231:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804235:	7f 01                	jg     804238 <writebuf+0x7>
+  804237:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804238:	55                   	push   %rbp
+  804239:	48 89 e5             	mov    %rsp,%rbp
+  80423c:	53                   	push   %rbx
+  80423d:	48 83 ec 08          	sub    $0x8,%rsp
+  804241:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804244:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804248:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80424c:	8b 3f                	mov    (%rdi),%edi
+  80424e:	48 b8 ec 38 80 00 00 	movabs $0x8038ec,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80425a:	48 85 c0             	test   %rax,%rax
+  80425d:	7e 04                	jle    804263 <writebuf+0x32>
+  80425f:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804263:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804267:	48 39 c2             	cmp    %rax,%rdx
+  80426a:	74 0f                	je     80427b <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80426c:	48 85 c0             	test   %rax,%rax
+  80426f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804274:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804278:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80427b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80427f:	c9                   	leave
+  804280:	c3                   	ret
+
+0000000000804281 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804281:	8b 46 04             	mov    0x4(%rsi),%eax
+  804284:	8d 50 01             	lea    0x1(%rax),%edx
+  804287:	89 56 04             	mov    %edx,0x4(%rsi)
+  80428a:	48 98                	cltq
+  80428c:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804291:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804297:	74 01                	je     80429a <putch+0x19>
+  804299:	c3                   	ret
+putch(int ch, void *arg) {
+  80429a:	55                   	push   %rbp
+  80429b:	48 89 e5             	mov    %rsp,%rbp
+  80429e:	53                   	push   %rbx
+  80429f:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a3:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8042a6:	48 89 f7             	mov    %rsi,%rdi
+  8042a9:	48 b8 31 42 80 00 00 	movabs $0x804231,%rax
+  8042b0:	00 00 00 
+  8042b3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8042b5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8042bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042c0:	c9                   	leave
+  8042c1:	c3                   	ret
+
+00000000008042c2 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8042c2:	55                   	push   %rbp
+  8042c3:	48 89 e5             	mov    %rsp,%rbp
+  8042c6:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8042cd:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8042d0:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8042d6:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8042dd:	00 00 00 
+    state.result = 0;
+  8042e0:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8042e7:	00 00 00 00 
+    state.error = 1;
+  8042eb:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8042f2:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8042f5:	48 89 f2             	mov    %rsi,%rdx
+  8042f8:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8042ff:	48 bf 81 42 80 00 00 	movabs $0x804281,%rdi
+  804306:	00 00 00 
+  804309:	48 b8 f0 1c 80 00 00 	movabs $0x801cf0,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804315:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80431c:	7f 14                	jg     804332 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80431e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804325:	48 85 c0             	test   %rax,%rax
+  804328:	75 06                	jne    804330 <vfprintf+0x6e>
+  80432a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804330:	c9                   	leave
+  804331:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804332:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804339:	48 b8 31 42 80 00 00 	movabs $0x804231,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  804345:	eb d7                	jmp    80431e <vfprintf+0x5c>
+
+0000000000804347 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	48 83 ec 50          	sub    $0x50,%rsp
+  80434f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804353:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804357:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80435b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80435f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804366:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80436a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80436e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804372:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804376:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80437a:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  804381:	00 00 00 
+  804384:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804386:	c9                   	leave
+  804387:	c3                   	ret
+
+0000000000804388 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804388:	55                   	push   %rbp
+  804389:	48 89 e5             	mov    %rsp,%rbp
+  80438c:	48 83 ec 50          	sub    $0x50,%rsp
+  804390:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804394:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804398:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80439c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8043a0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8043a4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8043ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043b3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8043b7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8043bb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8043bf:	48 89 fe             	mov    %rdi,%rsi
+  8043c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043c7:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8043d3:	c9                   	leave
+  8043d4:	c3                   	ret
+
+00000000008043d5 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8043d5:	55                   	push   %rbp
+  8043d6:	48 89 e5             	mov    %rsp,%rbp
+  8043d9:	41 54                	push   %r12
+  8043db:	53                   	push   %rbx
+  8043dc:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043df:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  8043e6:	00 00 00 
+  8043e9:	ff d0                	call   *%rax
+  8043eb:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8043ee:	48 be 50 6b 80 00 00 	movabs $0x806b50,%rsi
+  8043f5:	00 00 00 
+  8043f8:	48 89 df             	mov    %rbx,%rdi
+  8043fb:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  804402:	00 00 00 
+  804405:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804407:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80440c:	41 2b 04 24          	sub    (%r12),%eax
+  804410:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804416:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80441d:	00 00 00 
+    stat->st_dev = &devpipe;
+  804420:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  804427:	00 00 00 
+  80442a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804431:	b8 00 00 00 00       	mov    $0x0,%eax
+  804436:	5b                   	pop    %rbx
+  804437:	41 5c                	pop    %r12
+  804439:	5d                   	pop    %rbp
+  80443a:	c3                   	ret
+
+000000000080443b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80443b:	55                   	push   %rbp
+  80443c:	48 89 e5             	mov    %rsp,%rbp
+  80443f:	41 54                	push   %r12
+  804441:	53                   	push   %rbx
+  804442:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804445:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80444a:	48 89 fe             	mov    %rdi,%rsi
+  80444d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804452:	49 bc 14 2d 80 00 00 	movabs $0x802d14,%r12
+  804459:	00 00 00 
+  80445c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80445f:	48 89 df             	mov    %rbx,%rdi
+  804462:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  804469:	00 00 00 
+  80446c:	ff d0                	call   *%rax
+  80446e:	48 89 c6             	mov    %rax,%rsi
+  804471:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804476:	bf 00 00 00 00       	mov    $0x0,%edi
+  80447b:	41 ff d4             	call   *%r12
+}
+  80447e:	5b                   	pop    %rbx
+  80447f:	41 5c                	pop    %r12
+  804481:	5d                   	pop    %rbp
+  804482:	c3                   	ret
+
+0000000000804483 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804483:	55                   	push   %rbp
+  804484:	48 89 e5             	mov    %rsp,%rbp
+  804487:	41 57                	push   %r15
+  804489:	41 56                	push   %r14
+  80448b:	41 55                	push   %r13
+  80448d:	41 54                	push   %r12
+  80448f:	53                   	push   %rbx
+  804490:	48 83 ec 18          	sub    $0x18,%rsp
+  804494:	49 89 fc             	mov    %rdi,%r12
+  804497:	49 89 f5             	mov    %rsi,%r13
+  80449a:	49 89 d7             	mov    %rdx,%r15
+  80449d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044a1:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  8044a8:	00 00 00 
+  8044ab:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8044ad:	4d 85 ff             	test   %r15,%r15
+  8044b0:	0f 84 af 00 00 00    	je     804565 <devpipe_write+0xe2>
+  8044b6:	48 89 c3             	mov    %rax,%rbx
+  8044b9:	4c 89 f8             	mov    %r15,%rax
+  8044bc:	4d 89 ef             	mov    %r13,%r15
+  8044bf:	4c 01 e8             	add    %r13,%rax
+  8044c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044c6:	49 bd 0a 2c 80 00 00 	movabs $0x802c0a,%r13
+  8044cd:	00 00 00 
+            sys_yield();
+  8044d0:	49 be 9b 2b 80 00 00 	movabs $0x802b9b,%r14
+  8044d7:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8044da:	8b 73 04             	mov    0x4(%rbx),%esi
+  8044dd:	48 63 ce             	movslq %esi,%rcx
+  8044e0:	48 63 03             	movslq (%rbx),%rax
+  8044e3:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8044e9:	48 39 c1             	cmp    %rax,%rcx
+  8044ec:	72 2e                	jb     80451c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8044ee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8044f3:	48 89 da             	mov    %rbx,%rdx
+  8044f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044fb:	4c 89 e7             	mov    %r12,%rdi
+  8044fe:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804501:	85 c0                	test   %eax,%eax
+  804503:	74 66                	je     80456b <devpipe_write+0xe8>
+            sys_yield();
+  804505:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804508:	8b 73 04             	mov    0x4(%rbx),%esi
+  80450b:	48 63 ce             	movslq %esi,%rcx
+  80450e:	48 63 03             	movslq (%rbx),%rax
+  804511:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804517:	48 39 c1             	cmp    %rax,%rcx
+  80451a:	73 d2                	jae    8044ee <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80451c:	41 0f b6 3f          	movzbl (%r15),%edi
+  804520:	48 89 ca             	mov    %rcx,%rdx
+  804523:	48 c1 ea 03          	shr    $0x3,%rdx
+  804527:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80452e:	08 10 20 
+  804531:	48 f7 e2             	mul    %rdx
+  804534:	48 c1 ea 06          	shr    $0x6,%rdx
+  804538:	48 89 d0             	mov    %rdx,%rax
+  80453b:	48 c1 e0 09          	shl    $0x9,%rax
+  80453f:	48 29 d0             	sub    %rdx,%rax
+  804542:	48 c1 e0 03          	shl    $0x3,%rax
+  804546:	48 29 c1             	sub    %rax,%rcx
+  804549:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80454e:	83 c6 01             	add    $0x1,%esi
+  804551:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804554:	49 83 c7 01          	add    $0x1,%r15
+  804558:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80455c:	49 39 c7             	cmp    %rax,%r15
+  80455f:	0f 85 75 ff ff ff    	jne    8044da <devpipe_write+0x57>
+    return n;
+  804565:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804569:	eb 05                	jmp    804570 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80456b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804570:	48 83 c4 18          	add    $0x18,%rsp
+  804574:	5b                   	pop    %rbx
+  804575:	41 5c                	pop    %r12
+  804577:	41 5d                	pop    %r13
+  804579:	41 5e                	pop    %r14
+  80457b:	41 5f                	pop    %r15
+  80457d:	5d                   	pop    %rbp
+  80457e:	c3                   	ret
+
+000000000080457f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80457f:	55                   	push   %rbp
+  804580:	48 89 e5             	mov    %rsp,%rbp
+  804583:	41 57                	push   %r15
+  804585:	41 56                	push   %r14
+  804587:	41 55                	push   %r13
+  804589:	41 54                	push   %r12
+  80458b:	53                   	push   %rbx
+  80458c:	48 83 ec 18          	sub    $0x18,%rsp
+  804590:	49 89 fc             	mov    %rdi,%r12
+  804593:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804597:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80459b:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  8045a2:	00 00 00 
+  8045a5:	ff d0                	call   *%rax
+  8045a7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8045aa:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045b0:	49 bd 0a 2c 80 00 00 	movabs $0x802c0a,%r13
+  8045b7:	00 00 00 
+            sys_yield();
+  8045ba:	49 be 9b 2b 80 00 00 	movabs $0x802b9b,%r14
+  8045c1:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8045c4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8045c9:	74 7d                	je     804648 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8045cb:	8b 03                	mov    (%rbx),%eax
+  8045cd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8045d0:	75 26                	jne    8045f8 <devpipe_read+0x79>
+            if (i > 0) return i;
+  8045d2:	4d 85 ff             	test   %r15,%r15
+  8045d5:	75 77                	jne    80464e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8045dc:	48 89 da             	mov    %rbx,%rdx
+  8045df:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045e4:	4c 89 e7             	mov    %r12,%rdi
+  8045e7:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8045ea:	85 c0                	test   %eax,%eax
+  8045ec:	74 72                	je     804660 <devpipe_read+0xe1>
+            sys_yield();
+  8045ee:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8045f1:	8b 03                	mov    (%rbx),%eax
+  8045f3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8045f6:	74 df                	je     8045d7 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8045f8:	48 63 c8             	movslq %eax,%rcx
+  8045fb:	48 89 ca             	mov    %rcx,%rdx
+  8045fe:	48 c1 ea 03          	shr    $0x3,%rdx
+  804602:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804609:	08 10 20 
+  80460c:	48 89 d0             	mov    %rdx,%rax
+  80460f:	48 f7 e6             	mul    %rsi
+  804612:	48 c1 ea 06          	shr    $0x6,%rdx
+  804616:	48 89 d0             	mov    %rdx,%rax
+  804619:	48 c1 e0 09          	shl    $0x9,%rax
+  80461d:	48 29 d0             	sub    %rdx,%rax
+  804620:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804627:	00 
+  804628:	48 89 c8             	mov    %rcx,%rax
+  80462b:	48 29 d0             	sub    %rdx,%rax
+  80462e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804633:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804637:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80463b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80463e:	49 83 c7 01          	add    $0x1,%r15
+  804642:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804646:	75 83                	jne    8045cb <devpipe_read+0x4c>
+    return n;
+  804648:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80464c:	eb 03                	jmp    804651 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80464e:	4c 89 f8             	mov    %r15,%rax
+}
+  804651:	48 83 c4 18          	add    $0x18,%rsp
+  804655:	5b                   	pop    %rbx
+  804656:	41 5c                	pop    %r12
+  804658:	41 5d                	pop    %r13
+  80465a:	41 5e                	pop    %r14
+  80465c:	41 5f                	pop    %r15
+  80465e:	5d                   	pop    %rbp
+  80465f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804660:	b8 00 00 00 00       	mov    $0x0,%eax
+  804665:	eb ea                	jmp    804651 <devpipe_read+0xd2>
+
+0000000000804667 <pipe>:
+pipe(int pfd[2]) {
+  804667:	55                   	push   %rbp
+  804668:	48 89 e5             	mov    %rsp,%rbp
+  80466b:	41 55                	push   %r13
+  80466d:	41 54                	push   %r12
+  80466f:	53                   	push   %rbx
+  804670:	48 83 ec 18          	sub    $0x18,%rsp
+  804674:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804677:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80467b:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+  804687:	89 c3                	mov    %eax,%ebx
+  804689:	85 c0                	test   %eax,%eax
+  80468b:	0f 88 a0 01 00 00    	js     804831 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804691:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804696:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80469b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80469f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046a4:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  8046ab:	00 00 00 
+  8046ae:	ff d0                	call   *%rax
+  8046b0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8046b2:	85 c0                	test   %eax,%eax
+  8046b4:	0f 88 77 01 00 00    	js     804831 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8046ba:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8046be:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  8046c5:	00 00 00 
+  8046c8:	ff d0                	call   *%rax
+  8046ca:	89 c3                	mov    %eax,%ebx
+  8046cc:	85 c0                	test   %eax,%eax
+  8046ce:	0f 88 43 01 00 00    	js     804817 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8046d4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8046d9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046de:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8046e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046e7:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  8046ee:	00 00 00 
+  8046f1:	ff d0                	call   *%rax
+  8046f3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8046f5:	85 c0                	test   %eax,%eax
+  8046f7:	0f 88 1a 01 00 00    	js     804817 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8046fd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804701:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  804708:	00 00 00 
+  80470b:	ff d0                	call   *%rax
+  80470d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804710:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804715:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80471a:	48 89 c6             	mov    %rax,%rsi
+  80471d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804722:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  804729:	00 00 00 
+  80472c:	ff d0                	call   *%rax
+  80472e:	89 c3                	mov    %eax,%ebx
+  804730:	85 c0                	test   %eax,%eax
+  804732:	0f 88 c5 00 00 00    	js     8047fd <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804738:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80473c:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  804743:	00 00 00 
+  804746:	ff d0                	call   *%rax
+  804748:	48 89 c1             	mov    %rax,%rcx
+  80474b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804751:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80475c:	4c 89 ee             	mov    %r13,%rsi
+  80475f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804764:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  80476b:	00 00 00 
+  80476e:	ff d0                	call   *%rax
+  804770:	89 c3                	mov    %eax,%ebx
+  804772:	85 c0                	test   %eax,%eax
+  804774:	78 6e                	js     8047e4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804776:	be 00 10 00 00       	mov    $0x1000,%esi
+  80477b:	4c 89 ef             	mov    %r13,%rdi
+  80477e:	48 b8 d2 2b 80 00 00 	movabs $0x802bd2,%rax
+  804785:	00 00 00 
+  804788:	ff d0                	call   *%rax
+  80478a:	83 f8 02             	cmp    $0x2,%eax
+  80478d:	0f 85 ab 00 00 00    	jne    80483e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804793:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  80479a:	00 00 
+  80479c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8047a0:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8047a2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8047a6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8047ad:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8047b1:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8047b3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8047b7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8047be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8047c2:	48 bb 4c 34 80 00 00 	movabs $0x80344c,%rbx
+  8047c9:	00 00 00 
+  8047cc:	ff d3                	call   *%rbx
+  8047ce:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8047d2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8047d6:	ff d3                	call   *%rbx
+  8047d8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8047dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047e2:	eb 4d                	jmp    804831 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8047e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047e9:	4c 89 ee             	mov    %r13,%rsi
+  8047ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f1:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  8047f8:	00 00 00 
+  8047fb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8047fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804802:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804806:	bf 00 00 00 00       	mov    $0x0,%edi
+  80480b:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  804812:	00 00 00 
+  804815:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804817:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80481c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804820:	bf 00 00 00 00       	mov    $0x0,%edi
+  804825:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  80482c:	00 00 00 
+  80482f:	ff d0                	call   *%rax
+}
+  804831:	89 d8                	mov    %ebx,%eax
+  804833:	48 83 c4 18          	add    $0x18,%rsp
+  804837:	5b                   	pop    %rbx
+  804838:	41 5c                	pop    %r12
+  80483a:	41 5d                	pop    %r13
+  80483c:	5d                   	pop    %rbp
+  80483d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80483e:	48 b9 68 6b 80 00 00 	movabs $0x806b68,%rcx
+  804845:	00 00 00 
+  804848:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  80484f:	00 00 00 
+  804852:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804857:	48 bf 57 6b 80 00 00 	movabs $0x806b57,%rdi
+  80485e:	00 00 00 
+  804861:	b8 00 00 00 00       	mov    $0x0,%eax
+  804866:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  80486d:	00 00 00 
+  804870:	41 ff d0             	call   *%r8
+
+0000000000804873 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804873:	55                   	push   %rbp
+  804874:	48 89 e5             	mov    %rsp,%rbp
+  804877:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80487b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80487f:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  804886:	00 00 00 
+  804889:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80488b:	85 c0                	test   %eax,%eax
+  80488d:	78 35                	js     8048c4 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80488f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804893:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  80489a:	00 00 00 
+  80489d:	ff d0                	call   *%rax
+  80489f:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8048a2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8048a7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048ac:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8048b0:	48 b8 0a 2c 80 00 00 	movabs $0x802c0a,%rax
+  8048b7:	00 00 00 
+  8048ba:	ff d0                	call   *%rax
+  8048bc:	85 c0                	test   %eax,%eax
+  8048be:	0f 94 c0             	sete   %al
+  8048c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8048c4:	c9                   	leave
+  8048c5:	c3                   	ret
+
+00000000008048c6 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8048c6:	55                   	push   %rbp
+  8048c7:	48 89 e5             	mov    %rsp,%rbp
+  8048ca:	41 55                	push   %r13
+  8048cc:	41 54                	push   %r12
+  8048ce:	53                   	push   %rbx
+  8048cf:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8048d3:	85 ff                	test   %edi,%edi
+  8048d5:	74 73                	je     80494a <wait+0x84>
+  8048d7:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8048da:	89 f8                	mov    %edi,%eax
+  8048dc:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8048e1:	89 f9                	mov    %edi,%ecx
+  8048e3:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8048e9:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  8048f0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048f7:	00 00 00 
+  8048fa:	48 01 ca             	add    %rcx,%rdx
+  8048fd:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804903:	39 d7                	cmp    %edx,%edi
+  804905:	75 38                	jne    80493f <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804907:	48 98                	cltq
+  804909:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  804910:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804917:	00 00 00 
+  80491a:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  80491d:	49 bd 9b 2b 80 00 00 	movabs $0x802b9b,%r13
+  804924:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804927:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  80492d:	85 c0                	test   %eax,%eax
+  80492f:	74 0e                	je     80493f <wait+0x79>
+        sys_yield();
+  804931:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804934:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80493a:	44 39 e0             	cmp    %r12d,%eax
+  80493d:	74 e8                	je     804927 <wait+0x61>
+    }
+}
+  80493f:	48 83 c4 08          	add    $0x8,%rsp
+  804943:	5b                   	pop    %rbx
+  804944:	41 5c                	pop    %r12
+  804946:	41 5d                	pop    %r13
+  804948:	5d                   	pop    %rbp
+  804949:	c3                   	ret
+    assert(envid != 0);
+  80494a:	48 b9 8c 6b 80 00 00 	movabs $0x806b8c,%rcx
+  804951:	00 00 00 
+  804954:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  80495b:	00 00 00 
+  80495e:	be 06 00 00 00       	mov    $0x6,%esi
+  804963:	48 bf 97 6b 80 00 00 	movabs $0x806b97,%rdi
+  80496a:	00 00 00 
+  80496d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804972:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  804979:	00 00 00 
+  80497c:	41 ff d0             	call   *%r8
+
+000000000080497f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80497f:	48 89 f8             	mov    %rdi,%rax
+  804982:	48 c1 e8 27          	shr    $0x27,%rax
+  804986:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80498d:	01 00 00 
+  804990:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804994:	f6 c2 01             	test   $0x1,%dl
+  804997:	74 6d                	je     804a06 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804999:	48 89 f8             	mov    %rdi,%rax
+  80499c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8049a0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8049a7:	01 00 00 
+  8049aa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049ae:	f6 c2 01             	test   $0x1,%dl
+  8049b1:	74 62                	je     804a15 <get_uvpt_entry+0x96>
+  8049b3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8049ba:	01 00 00 
+  8049bd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049c1:	f6 c2 80             	test   $0x80,%dl
+  8049c4:	75 4f                	jne    804a15 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8049c6:	48 89 f8             	mov    %rdi,%rax
+  8049c9:	48 c1 e8 15          	shr    $0x15,%rax
+  8049cd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8049d4:	01 00 00 
+  8049d7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049db:	f6 c2 01             	test   $0x1,%dl
+  8049de:	74 44                	je     804a24 <get_uvpt_entry+0xa5>
+  8049e0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8049e7:	01 00 00 
+  8049ea:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049ee:	f6 c2 80             	test   $0x80,%dl
+  8049f1:	75 31                	jne    804a24 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8049f3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8049f7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8049fe:	01 00 00 
+  804a01:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804a05:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804a06:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804a0d:	01 00 00 
+  804a10:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a14:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a15:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a1c:	01 00 00 
+  804a1f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a23:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a24:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a2b:	01 00 00 
+  804a2e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a32:	c3                   	ret
+
+0000000000804a33 <get_prot>:
+
+int
+get_prot(void *va) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804a37:	48 b8 7f 49 80 00 00 	movabs $0x80497f,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+  804a43:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804a46:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804a4b:	89 c1                	mov    %eax,%ecx
+  804a4d:	83 c9 04             	or     $0x4,%ecx
+  804a50:	f6 c2 01             	test   $0x1,%dl
+  804a53:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804a56:	89 c1                	mov    %eax,%ecx
+  804a58:	83 c9 02             	or     $0x2,%ecx
+  804a5b:	f6 c2 02             	test   $0x2,%dl
+  804a5e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804a61:	89 c1                	mov    %eax,%ecx
+  804a63:	83 c9 01             	or     $0x1,%ecx
+  804a66:	48 85 d2             	test   %rdx,%rdx
+  804a69:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804a6c:	89 c1                	mov    %eax,%ecx
+  804a6e:	83 c9 40             	or     $0x40,%ecx
+  804a71:	f6 c6 04             	test   $0x4,%dh
+  804a74:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804a77:	5d                   	pop    %rbp
+  804a78:	c3                   	ret
+
+0000000000804a79 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804a79:	55                   	push   %rbp
+  804a7a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804a7d:	48 b8 7f 49 80 00 00 	movabs $0x80497f,%rax
+  804a84:	00 00 00 
+  804a87:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804a89:	48 c1 e8 06          	shr    $0x6,%rax
+  804a8d:	83 e0 01             	and    $0x1,%eax
+}
+  804a90:	5d                   	pop    %rbp
+  804a91:	c3                   	ret
+
+0000000000804a92 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804a92:	55                   	push   %rbp
+  804a93:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804a96:	48 b8 7f 49 80 00 00 	movabs $0x80497f,%rax
+  804a9d:	00 00 00 
+  804aa0:	ff d0                	call   *%rax
+  804aa2:	83 e0 01             	and    $0x1,%eax
+}
+  804aa5:	5d                   	pop    %rbp
+  804aa6:	c3                   	ret
+
+0000000000804aa7 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804aa7:	55                   	push   %rbp
+  804aa8:	48 89 e5             	mov    %rsp,%rbp
+  804aab:	41 57                	push   %r15
+  804aad:	41 56                	push   %r14
+  804aaf:	41 55                	push   %r13
+  804ab1:	41 54                	push   %r12
+  804ab3:	53                   	push   %rbx
+  804ab4:	48 83 ec 28          	sub    $0x28,%rsp
+  804ab8:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804abc:	48 85 ff             	test   %rdi,%rdi
+  804abf:	74 1e                	je     804adf <foreach_shared_region+0x38>
+  804ac1:	49 89 ff             	mov    %rdi,%r15
+  804ac4:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804aca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804ad0:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804ad7:	01 00 00 
+  804ada:	e9 72 02 00 00       	jmp    804d51 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804adf:	48 b9 a2 6b 80 00 00 	movabs $0x806ba2,%rcx
+  804ae6:	00 00 00 
+  804ae9:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  804af0:	00 00 00 
+  804af3:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804af8:	48 bf a6 6b 80 00 00 	movabs $0x806ba6,%rdi
+  804aff:	00 00 00 
+  804b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b07:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  804b0e:	00 00 00 
+  804b11:	41 ff d0             	call   *%r8
+  804b14:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804b1b:	eb 6c                	jmp    804b89 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804b1d:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804b24:	ff ff ff 
+  804b27:	4c 21 e2             	and    %r12,%rdx
+  804b2a:	48 89 d8             	mov    %rbx,%rax
+  804b2d:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804b32:	48 83 c0 01          	add    $0x1,%rax
+  804b36:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804b3a:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804b41:	00 00 00 
+  804b44:	48 21 c8             	and    %rcx,%rax
+  804b47:	48 09 d0             	or     %rdx,%rax
+  804b4a:	49 89 c4             	mov    %rax,%r12
+  804b4d:	eb 30                	jmp    804b7f <foreach_shared_region+0xd8>
+  804b4f:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804b56:	ff ff ff 
+  804b59:	4c 21 e2             	and    %r12,%rdx
+  804b5c:	48 89 d8             	mov    %rbx,%rax
+  804b5f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804b64:	48 83 c0 01          	add    $0x1,%rax
+  804b68:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804b6c:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804b73:	00 00 00 
+  804b76:	48 21 c8             	and    %rcx,%rax
+  804b79:	48 09 d0             	or     %rdx,%rax
+  804b7c:	49 89 c4             	mov    %rax,%r12
+  804b7f:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804b83:	0f 84 99 01 00 00    	je     804d22 <foreach_shared_region+0x27b>
+  804b89:	4c 89 e3             	mov    %r12,%rbx
+  804b8c:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804b90:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804b97:	01 00 00 
+  804b9a:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804b9e:	a8 01                	test   $0x1,%al
+  804ba0:	0f 84 77 ff ff ff    	je     804b1d <foreach_shared_region+0x76>
+  804ba6:	a8 80                	test   $0x80,%al
+  804ba8:	74 19                	je     804bc3 <foreach_shared_region+0x11c>
+  804baa:	f6 c4 04             	test   $0x4,%ah
+  804bad:	74 a0                	je     804b4f <foreach_shared_region+0xa8>
+  804baf:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804bb6:	40 
+  804bb7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804bbb:	4c 89 e7             	mov    %r12,%rdi
+  804bbe:	41 ff d7             	call   *%r15
+  804bc1:	eb 8c                	jmp    804b4f <foreach_shared_region+0xa8>
+  804bc3:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804bca:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804bce:	eb 46                	jmp    804c16 <foreach_shared_region+0x16f>
+  804bd0:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804bd7:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804bdd:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804be1:	48 c1 e0 15          	shl    $0x15,%rax
+  804be5:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804bea:	49 09 c4             	or     %rax,%r12
+  804bed:	eb 1d                	jmp    804c0c <foreach_shared_region+0x165>
+  804bef:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804bf6:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804bfc:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804c00:	48 c1 e0 15          	shl    $0x15,%rax
+  804c04:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804c09:	49 09 c4             	or     %rax,%r12
+  804c0c:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804c10:	0f 84 d3 00 00 00    	je     804ce9 <foreach_shared_region+0x242>
+  804c16:	4c 89 e3             	mov    %r12,%rbx
+  804c19:	48 c1 eb 15          	shr    $0x15,%rbx
+  804c1d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804c24:	01 00 00 
+  804c27:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804c2b:	a8 01                	test   $0x1,%al
+  804c2d:	74 a1                	je     804bd0 <foreach_shared_region+0x129>
+  804c2f:	a8 80                	test   $0x80,%al
+  804c31:	74 19                	je     804c4c <foreach_shared_region+0x1a5>
+  804c33:	f6 c4 04             	test   $0x4,%ah
+  804c36:	74 b7                	je     804bef <foreach_shared_region+0x148>
+  804c38:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804c3f:	00 
+  804c40:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c44:	4c 89 e7             	mov    %r12,%rdi
+  804c47:	41 ff d7             	call   *%r15
+  804c4a:	eb a3                	jmp    804bef <foreach_shared_region+0x148>
+  804c4c:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804c52:	eb 3b                	jmp    804c8f <foreach_shared_region+0x1e8>
+  804c54:	f6 c4 04             	test   $0x4,%ah
+  804c57:	74 12                	je     804c6b <foreach_shared_region+0x1c4>
+  804c59:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804c60:	00 
+  804c61:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c65:	4c 89 e7             	mov    %r12,%rdi
+  804c68:	41 ff d7             	call   *%r15
+  804c6b:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804c72:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804c78:	48 83 c3 01          	add    $0x1,%rbx
+  804c7c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804c80:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804c86:	49 09 dc             	or     %rbx,%r12
+  804c89:	41 83 ed 01          	sub    $0x1,%r13d
+  804c8d:	74 2f                	je     804cbe <foreach_shared_region+0x217>
+  804c8f:	4c 89 e3             	mov    %r12,%rbx
+  804c92:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804c96:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804c9a:	a8 01                	test   $0x1,%al
+  804c9c:	75 b6                	jne    804c54 <foreach_shared_region+0x1ad>
+  804c9e:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804ca5:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804cab:	48 83 c3 01          	add    $0x1,%rbx
+  804caf:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804cb3:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804cb9:	49 09 dc             	or     %rbx,%r12
+  804cbc:	eb cb                	jmp    804c89 <foreach_shared_region+0x1e2>
+  804cbe:	4c 89 e0             	mov    %r12,%rax
+  804cc1:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804cc7:	49 c1 ec 15          	shr    $0x15,%r12
+  804ccb:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804cd2:	49 83 c4 01          	add    $0x1,%r12
+  804cd6:	49 c1 e4 15          	shl    $0x15,%r12
+  804cda:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804ce1:	49 09 c4             	or     %rax,%r12
+  804ce4:	e9 23 ff ff ff       	jmp    804c0c <foreach_shared_region+0x165>
+  804ce9:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804ced:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804cf4:	ff ff ff 
+  804cf7:	4c 21 e0             	and    %r12,%rax
+  804cfa:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804cfe:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804d05:	49 83 c4 01          	add    $0x1,%r12
+  804d09:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804d0d:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804d14:	00 00 00 
+  804d17:	49 21 d4             	and    %rdx,%r12
+  804d1a:	49 09 c4             	or     %rax,%r12
+  804d1d:	e9 5d fe ff ff       	jmp    804b7f <foreach_shared_region+0xd8>
+  804d22:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804d29:	00 ff ff 
+  804d2c:	4c 21 e0             	and    %r12,%rax
+  804d2f:	49 c1 ec 27          	shr    $0x27,%r12
+  804d33:	49 83 c4 01          	add    $0x1,%r12
+  804d37:	49 c1 e4 27          	shl    $0x27,%r12
+  804d3b:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804d42:	ff 00 00 
+  804d45:	49 21 d4             	and    %rdx,%r12
+  804d48:	49 09 c4             	or     %rax,%r12
+  804d4b:	41 83 ed 01          	sub    $0x1,%r13d
+  804d4f:	74 48                	je     804d99 <foreach_shared_region+0x2f2>
+  804d51:	4c 89 e0             	mov    %r12,%rax
+  804d54:	48 c1 e8 27          	shr    $0x27,%rax
+  804d58:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804d5f:	01 00 00 
+  804d62:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804d66:	f6 c2 01             	test   $0x1,%dl
+  804d69:	0f 85 a5 fd ff ff    	jne    804b14 <foreach_shared_region+0x6d>
+  804d6f:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804d76:	00 ff ff 
+  804d79:	4c 21 e2             	and    %r12,%rdx
+  804d7c:	48 83 c0 01          	add    $0x1,%rax
+  804d80:	48 c1 e0 27          	shl    $0x27,%rax
+  804d84:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804d8b:	ff 00 00 
+  804d8e:	48 21 c8             	and    %rcx,%rax
+  804d91:	48 09 d0             	or     %rdx,%rax
+  804d94:	49 89 c4             	mov    %rax,%r12
+  804d97:	eb b2                	jmp    804d4b <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804d99:	4d 85 e4             	test   %r12,%r12
+  804d9c:	75 14                	jne    804db2 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da3:	48 83 c4 28          	add    $0x28,%rsp
+  804da7:	5b                   	pop    %rbx
+  804da8:	41 5c                	pop    %r12
+  804daa:	41 5d                	pop    %r13
+  804dac:	41 5e                	pop    %r14
+  804dae:	41 5f                	pop    %r15
+  804db0:	5d                   	pop    %rbp
+  804db1:	c3                   	ret
+    assert(addr == 0);
+  804db2:	48 b9 b1 6b 80 00 00 	movabs $0x806bb1,%rcx
+  804db9:	00 00 00 
+  804dbc:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  804dc3:	00 00 00 
+  804dc6:	be 67 00 00 00       	mov    $0x67,%esi
+  804dcb:	48 bf a6 6b 80 00 00 	movabs $0x806ba6,%rdi
+  804dd2:	00 00 00 
+  804dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dda:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  804de1:	00 00 00 
+  804de4:	41 ff d0             	call   *%r8
+
+0000000000804de7 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804de7:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804dee:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804df1:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804df7:	eb 33                	jmp    804e2c <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804df9:	48 83 c0 20          	add    $0x20,%rax
+  804dfd:	4c 39 c0             	cmp    %r8,%rax
+  804e00:	74 25                	je     804e27 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804e02:	48 8b 10             	mov    (%rax),%rdx
+  804e05:	48 85 d2             	test   %rdx,%rdx
+  804e08:	74 ef                	je     804df9 <mmap_place+0x12>
+  804e0a:	48 89 d1             	mov    %rdx,%rcx
+  804e0d:	48 03 48 08          	add    0x8(%rax),%rcx
+  804e11:	48 39 cf             	cmp    %rcx,%rdi
+  804e14:	73 e3                	jae    804df9 <mmap_place+0x12>
+  804e16:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804e1a:	4c 39 ca             	cmp    %r9,%rdx
+  804e1d:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804e21:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804e25:	eb d2                	jmp    804df9 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804e27:	45 84 d2             	test   %r10b,%r10b
+  804e2a:	74 12                	je     804e3e <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e2c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e33:	00 00 00 
+        moved = 0;
+  804e36:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804e3c:	eb c4                	jmp    804e02 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804e3e:	48 01 fe             	add    %rdi,%rsi
+  804e41:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804e48:	00 00 00 
+  804e4b:	48 39 f0             	cmp    %rsi,%rax
+  804e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e53:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804e57:	c3                   	ret
+
+0000000000804e58 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804e58:	55                   	push   %rbp
+  804e59:	48 89 e5             	mov    %rsp,%rbp
+  804e5c:	41 57                	push   %r15
+  804e5e:	41 56                	push   %r14
+  804e60:	41 55                	push   %r13
+  804e62:	41 54                	push   %r12
+  804e64:	53                   	push   %rbx
+  804e65:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804e69:	48 8b 1f             	mov    (%rdi),%rbx
+  804e6c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e73:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e7a:	00 00 00 
+  804e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e82:	eb 12                	jmp    804e96 <mmap_pgfault+0x3e>
+  804e84:	48 83 c2 01          	add    $0x1,%rdx
+  804e88:	48 83 c0 20          	add    $0x20,%rax
+  804e8c:	48 83 fa 20          	cmp    $0x20,%rdx
+  804e90:	0f 84 04 01 00 00    	je     804f9a <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804e96:	48 8b 08             	mov    (%rax),%rcx
+  804e99:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804e9d:	48 39 de             	cmp    %rbx,%rsi
+  804ea0:	73 e2                	jae    804e84 <mmap_pgfault+0x2c>
+  804ea2:	48 03 48 08          	add    0x8(%rax),%rcx
+  804ea6:	48 39 cb             	cmp    %rcx,%rbx
+  804ea9:	73 d9                	jae    804e84 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804eab:	48 c1 e2 05          	shl    $0x5,%rdx
+  804eaf:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804eb6:	00 00 00 
+  804eb9:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804ebd:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804ec1:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804ec5:	f6 c2 01             	test   $0x1,%dl
+  804ec8:	0f 84 e0 00 00 00    	je     804fae <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ed3:	f6 c2 02             	test   $0x2,%dl
+  804ed6:	0f 84 c3 00 00 00    	je     804f9f <mmap_pgfault+0x147>
+  804edc:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ee3:	ff ff ff 
+  804ee6:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804eea:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ef1:	00 00 00 
+  804ef4:	48 39 ca             	cmp    %rcx,%rdx
+  804ef7:	0f 85 a2 00 00 00    	jne    804f9f <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804efd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804f02:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f07:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804f0e:	00 00 00 
+  804f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f16:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  804f1d:	00 00 00 
+  804f20:	ff d0                	call   *%rax
+  804f22:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f29:	85 d2                	test   %edx,%edx
+  804f2b:	78 72                	js     804f9f <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804f2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f32:	48 89 de             	mov    %rbx,%rsi
+  804f35:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804f3c:	00 00 00 
+  804f3f:	4c 89 e7             	mov    %r12,%rdi
+  804f42:	48 b8 8e 28 80 00 00 	movabs $0x80288e,%rax
+  804f49:	00 00 00 
+  804f4c:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804f4e:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804f54:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804f5a:	48 89 d9             	mov    %rbx,%rcx
+  804f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f62:	4c 89 e6             	mov    %r12,%rsi
+  804f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f6a:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  804f71:	00 00 00 
+  804f74:	ff d0                	call   *%rax
+  804f76:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804f78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f7d:	4c 89 e6             	mov    %r12,%rsi
+  804f80:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f85:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  804f8c:	00 00 00 
+  804f8f:	ff d0                	call   *%rax
+    return res >= 0;
+  804f91:	89 d8                	mov    %ebx,%eax
+  804f93:	f7 d0                	not    %eax
+  804f95:	c1 e8 1f             	shr    $0x1f,%eax
+  804f98:	eb 05                	jmp    804f9f <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804f9f:	48 83 c4 18          	add    $0x18,%rsp
+  804fa3:	5b                   	pop    %rbx
+  804fa4:	41 5c                	pop    %r12
+  804fa6:	41 5d                	pop    %r13
+  804fa8:	41 5e                	pop    %r14
+  804faa:	41 5f                	pop    %r15
+  804fac:	5d                   	pop    %rbp
+  804fad:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804fae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fb2:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804fb6:	4c 03 30             	add    (%rax),%r14
+  804fb9:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804fc0:	49 39 c6             	cmp    %rax,%r14
+  804fc3:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804fc7:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804fce:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804fd4:	49 bf 92 4a 80 00 00 	movabs $0x804a92,%r15
+  804fdb:	00 00 00 
+  804fde:	4d 39 f4             	cmp    %r14,%r12
+  804fe1:	73 1d                	jae    805000 <mmap_pgfault+0x1a8>
+  804fe3:	4c 89 e7             	mov    %r12,%rdi
+  804fe6:	41 ff d7             	call   *%r15
+  804fe9:	84 c0                	test   %al,%al
+  804feb:	75 13                	jne    805000 <mmap_pgfault+0x1a8>
+  804fed:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804ff4:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804ffb:	4d 39 f4             	cmp    %r14,%r12
+  804ffe:	72 e3                	jb     804fe3 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805000:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805006:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80500a:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80500e:	74 2a                	je     80503a <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  805010:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805014:	89 de                	mov    %ebx,%esi
+  805016:	2b 30                	sub    (%rax),%esi
+  805018:	03 70 1c             	add    0x1c(%rax),%esi
+  80501b:	8b 78 18             	mov    0x18(%rax),%edi
+  80501e:	4c 89 e9             	mov    %r13,%rcx
+  805021:	48 89 da             	mov    %rbx,%rdx
+  805024:	48 b8 37 41 80 00 00 	movabs $0x804137,%rax
+  80502b:	00 00 00 
+  80502e:	ff d0                	call   *%rax
+    return res > 0;
+  805030:	85 c0                	test   %eax,%eax
+  805032:	0f 9f c0             	setg   %al
+  805035:	e9 65 ff ff ff       	jmp    804f9f <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80503a:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  80503e:	eb d0                	jmp    805010 <mmap_pgfault+0x1b8>
+
+0000000000805040 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  805040:	55                   	push   %rbp
+  805041:	48 89 e5             	mov    %rsp,%rbp
+  805044:	41 57                	push   %r15
+  805046:	41 56                	push   %r14
+  805048:	41 55                	push   %r13
+  80504a:	41 54                	push   %r12
+  80504c:	53                   	push   %rbx
+  80504d:	48 83 ec 28          	sub    $0x28,%rsp
+  805051:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  805055:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  805058:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80505f:	ff ff ff 
+  805062:	48 23 57 10          	and    0x10(%rdi),%rdx
+  805066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80506b:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805072:	00 00 00 
+  805075:	48 39 ca             	cmp    %rcx,%rdx
+  805078:	0f 85 e5 00 00 00    	jne    805163 <mmap_writeback+0x123>
+  80507e:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  805081:	4c 39 ee             	cmp    %r13,%rsi
+  805084:	0f 83 e8 00 00 00    	jae    805172 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80508a:	49 be 92 4a 80 00 00 	movabs $0x804a92,%r14
+  805091:	00 00 00 
+  805094:	49 bf 79 4a 80 00 00 	movabs $0x804a79,%r15
+  80509b:	00 00 00 
+  80509e:	eb 10                	jmp    8050b0 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8050a0:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  8050a7:	4d 39 ec             	cmp    %r13,%r12
+  8050aa:	0f 83 ae 00 00 00    	jae    80515e <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8050b0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8050b4:	4c 89 e7             	mov    %r12,%rdi
+  8050b7:	41 ff d6             	call   *%r14
+  8050ba:	84 c0                	test   %al,%al
+  8050bc:	74 e2                	je     8050a0 <mmap_writeback+0x60>
+  8050be:	4c 89 e7             	mov    %r12,%rdi
+  8050c1:	41 ff d7             	call   *%r15
+  8050c4:	84 c0                	test   %al,%al
+  8050c6:	74 d8                	je     8050a0 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8050c8:	4c 89 e3             	mov    %r12,%rbx
+  8050cb:	4d 39 ec             	cmp    %r13,%r12
+  8050ce:	73 20                	jae    8050f0 <mmap_writeback+0xb0>
+  8050d0:	48 89 df             	mov    %rbx,%rdi
+  8050d3:	41 ff d6             	call   *%r14
+  8050d6:	84 c0                	test   %al,%al
+  8050d8:	74 16                	je     8050f0 <mmap_writeback+0xb0>
+  8050da:	48 89 df             	mov    %rbx,%rdi
+  8050dd:	41 ff d7             	call   *%r15
+  8050e0:	84 c0                	test   %al,%al
+  8050e2:	74 0c                	je     8050f0 <mmap_writeback+0xb0>
+  8050e4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8050eb:	4c 39 eb             	cmp    %r13,%rbx
+  8050ee:	72 e0                	jb     8050d0 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  8050f0:	48 89 d9             	mov    %rbx,%rcx
+  8050f3:	4c 29 e1             	sub    %r12,%rcx
+  8050f6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8050fa:	44 89 e6             	mov    %r12d,%esi
+  8050fd:	2b 30                	sub    (%rax),%esi
+  8050ff:	49 89 c4             	mov    %rax,%r12
+  805102:	03 70 1c             	add    0x1c(%rax),%esi
+  805105:	8b 78 18             	mov    0x18(%rax),%edi
+  805108:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80510c:	48 89 ca             	mov    %rcx,%rdx
+  80510f:	48 b8 c0 41 80 00 00 	movabs $0x8041c0,%rax
+  805116:	00 00 00 
+  805119:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80511b:	85 c0                	test   %eax,%eax
+  80511d:	78 44                	js     805163 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80511f:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805124:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805127:	41 89 c1             	mov    %eax,%r9d
+  80512a:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  805131:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805135:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80513e:	48 89 ce             	mov    %rcx,%rsi
+  805141:	bf 00 00 00 00       	mov    $0x0,%edi
+  805146:	48 b8 a9 2c 80 00 00 	movabs $0x802ca9,%rax
+  80514d:	00 00 00 
+  805150:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805152:	85 c0                	test   %eax,%eax
+  805154:	78 0d                	js     805163 <mmap_writeback+0x123>
+  805156:	49 89 dc             	mov    %rbx,%r12
+  805159:	e9 49 ff ff ff       	jmp    8050a7 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  80515e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805163:	48 83 c4 28          	add    $0x28,%rsp
+  805167:	5b                   	pop    %rbx
+  805168:	41 5c                	pop    %r12
+  80516a:	41 5d                	pop    %r13
+  80516c:	41 5e                	pop    %r14
+  80516e:	41 5f                	pop    %r15
+  805170:	5d                   	pop    %rbp
+  805171:	c3                   	ret
+    return 0;
+  805172:	b8 00 00 00 00       	mov    $0x0,%eax
+  805177:	eb ea                	jmp    805163 <mmap_writeback+0x123>
+
+0000000000805179 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805179:	55                   	push   %rbp
+  80517a:	48 89 e5             	mov    %rsp,%rbp
+  80517d:	41 57                	push   %r15
+  80517f:	41 56                	push   %r14
+  805181:	41 55                	push   %r13
+  805183:	41 54                	push   %r12
+  805185:	53                   	push   %rbx
+  805186:	48 83 ec 38          	sub    $0x38,%rsp
+  80518a:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80518e:	48 85 f6             	test   %rsi,%rsi
+  805191:	0f 84 0c 02 00 00    	je     8053a3 <mmap+0x22a>
+  805197:	49 89 ff             	mov    %rdi,%r15
+  80519a:	49 89 f4             	mov    %rsi,%r12
+  80519d:	41 89 d5             	mov    %edx,%r13d
+  8051a0:	41 89 ce             	mov    %ecx,%r14d
+  8051a3:	44 89 cb             	mov    %r9d,%ebx
+  8051a6:	45 85 c9             	test   %r9d,%r9d
+  8051a9:	0f 88 f4 01 00 00    	js     8053a3 <mmap+0x22a>
+  8051af:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051b6:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  8051bd:	0f 85 e7 01 00 00    	jne    8053aa <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  8051c3:	83 e2 fd             	and    $0xfffffffd,%edx
+  8051c6:	83 fa 04             	cmp    $0x4,%edx
+  8051c9:	0f 85 db 01 00 00    	jne    8053aa <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  8051cf:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8051d2:	83 fa 01             	cmp    $0x1,%edx
+  8051d5:	0f 87 cf 01 00 00    	ja     8053aa <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  8051db:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8051df:	44 89 c7             	mov    %r8d,%edi
+  8051e2:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  8051e9:	00 00 00 
+  8051ec:	ff d0                	call   *%rax
+  8051ee:	89 c2                	mov    %eax,%edx
+  8051f0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8051f7:	85 d2                	test   %edx,%edx
+  8051f9:	0f 88 ab 01 00 00    	js     8053aa <mmap+0x231>
+  8051ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805203:	48 b9 60 70 80 00 00 	movabs $0x807060,%rcx
+  80520a:	00 00 00 
+  80520d:	8b 09                	mov    (%rcx),%ecx
+  80520f:	39 0a                	cmp    %ecx,(%rdx)
+  805211:	0f 85 93 01 00 00    	jne    8053aa <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805217:	8b 52 08             	mov    0x8(%rdx),%edx
+  80521a:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80521d:	83 fa 01             	cmp    $0x1,%edx
+  805220:	0f 84 84 01 00 00    	je     8053aa <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805226:	41 83 fe 01          	cmp    $0x1,%r14d
+  80522a:	74 42                	je     80526e <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  80522c:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805233:	4c 89 e6             	mov    %r12,%rsi
+  805236:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  80523d:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805241:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805245:	4d 85 ff             	test   %r15,%r15
+  805248:	74 67                	je     8052b1 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80524a:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805251:	75 0f                	jne    805262 <mmap+0xe9>
+  805253:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  80525a:	00 00 00 
+  80525d:	49 39 c7             	cmp    %rax,%r15
+  805260:	77 1b                	ja     80527d <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805262:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805269:	e9 3c 01 00 00       	jmp    8053aa <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  80526e:	41 f6 c5 02          	test   $0x2,%r13b
+  805272:	74 b8                	je     80522c <mmap+0xb3>
+  805274:	85 d2                	test   %edx,%edx
+  805276:	75 b4                	jne    80522c <mmap+0xb3>
+  805278:	e9 2d 01 00 00       	jmp    8053aa <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80527d:	4c 89 ff             	mov    %r15,%rdi
+  805280:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  805287:	00 00 00 
+  80528a:	ff d0                	call   *%rax
+  80528c:	48 89 c2             	mov    %rax,%rdx
+  80528f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805296:	49 39 d7             	cmp    %rdx,%r15
+  805299:	0f 85 0b 01 00 00    	jne    8053aa <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80529f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8052a6:	00 00 00 
+  8052a9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8052af:	eb 44                	jmp    8052f5 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8052b1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8052b5:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  8052bc:	00 00 00 
+  8052bf:	48 b8 e7 4d 80 00 00 	movabs $0x804de7,%rax
+  8052c6:	00 00 00 
+  8052c9:	ff d0                	call   *%rax
+  8052cb:	48 89 c7             	mov    %rax,%rdi
+  8052ce:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  8052d2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  8052d9:	48 85 ff             	test   %rdi,%rdi
+  8052dc:	75 c1                	jne    80529f <mmap+0x126>
+  8052de:	e9 c7 00 00 00       	jmp    8053aa <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  8052e3:	49 83 c4 01          	add    $0x1,%r12
+  8052e7:	48 83 c0 20          	add    $0x20,%rax
+  8052eb:	49 83 fc 20          	cmp    $0x20,%r12
+  8052ef:	0f 84 a5 00 00 00    	je     80539a <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8052f5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8052f9:	75 e8                	jne    8052e3 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8052fb:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8052ff:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  805306:	00 00 00 
+  805309:	ff d0                	call   *%rax
+  80530b:	89 c2                	mov    %eax,%edx
+  80530d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805314:	85 d2                	test   %edx,%edx
+  805316:	0f 88 8e 00 00 00    	js     8053aa <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  80531c:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805320:	48 b8 4c 34 80 00 00 	movabs $0x80344c,%rax
+  805327:	00 00 00 
+  80532a:	ff d0                	call   *%rax
+  80532c:	89 c6                	mov    %eax,%esi
+  80532e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805331:	48 b8 9a 36 80 00 00 	movabs $0x80369a,%rax
+  805338:	00 00 00 
+  80533b:	ff d0                	call   *%rax
+  80533d:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805340:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805347:	45 85 ff             	test   %r15d,%r15d
+  80534a:	78 5e                	js     8053aa <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80534c:	49 c1 e4 05          	shl    $0x5,%r12
+  805350:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805357:	00 00 00 
+  80535a:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  80535d:	48 bf 58 4e 80 00 00 	movabs $0x804e58,%rdi
+  805364:	00 00 00 
+  805367:	48 b8 83 58 80 00 00 	movabs $0x805883,%rax
+  80536e:	00 00 00 
+  805371:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805373:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805377:	49 89 04 24          	mov    %rax,(%r12)
+  80537b:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  80537f:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805384:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805389:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  80538e:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805393:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805398:	eb 10                	jmp    8053aa <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  80539a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8053a1:	eb 07                	jmp    8053aa <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8053a3:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  8053aa:	48 83 c4 38          	add    $0x38,%rsp
+  8053ae:	5b                   	pop    %rbx
+  8053af:	41 5c                	pop    %r12
+  8053b1:	41 5d                	pop    %r13
+  8053b3:	41 5e                	pop    %r14
+  8053b5:	41 5f                	pop    %r15
+  8053b7:	5d                   	pop    %rbp
+  8053b8:	c3                   	ret
+
+00000000008053b9 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  8053b9:	55                   	push   %rbp
+  8053ba:	48 89 e5             	mov    %rsp,%rbp
+  8053bd:	41 57                	push   %r15
+  8053bf:	41 56                	push   %r14
+  8053c1:	41 55                	push   %r13
+  8053c3:	41 54                	push   %r12
+  8053c5:	53                   	push   %rbx
+  8053c6:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8053ca:	49 89 fe             	mov    %rdi,%r14
+  8053cd:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8053d4:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8053db:	00 
+  8053dc:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8053e3:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8053ea:	00 00 00 
+  8053ed:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  8053f4:	49 bf 40 50 80 00 00 	movabs $0x805040,%r15
+  8053fb:	00 00 00 
+  8053fe:	eb 09                	jmp    805409 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805400:	48 83 c3 20          	add    $0x20,%rbx
+  805404:	4c 39 eb             	cmp    %r13,%rbx
+  805407:	74 33                	je     80543c <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805409:	48 89 df             	mov    %rbx,%rdi
+  80540c:	48 8b 33             	mov    (%rbx),%rsi
+  80540f:	4c 39 e6             	cmp    %r12,%rsi
+  805412:	73 ec                	jae    805400 <msync+0x47>
+  805414:	48 85 f6             	test   %rsi,%rsi
+  805417:	74 e7                	je     805400 <msync+0x47>
+  805419:	48 89 f2             	mov    %rsi,%rdx
+  80541c:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805420:	49 39 d6             	cmp    %rdx,%r14
+  805423:	73 db                	jae    805400 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805425:	4c 39 e2             	cmp    %r12,%rdx
+  805428:	49 0f 47 d4          	cmova  %r12,%rdx
+  80542c:	4c 39 f6             	cmp    %r14,%rsi
+  80542f:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805433:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805436:	85 c0                	test   %eax,%eax
+  805438:	79 c6                	jns    805400 <msync+0x47>
+  80543a:	eb 05                	jmp    805441 <msync+0x88>
+    }
+
+    return 0;
+  80543c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805441:	48 83 c4 08          	add    $0x8,%rsp
+  805445:	5b                   	pop    %rbx
+  805446:	41 5c                	pop    %r12
+  805448:	41 5d                	pop    %r13
+  80544a:	41 5e                	pop    %r14
+  80544c:	41 5f                	pop    %r15
+  80544e:	5d                   	pop    %rbp
+  80544f:	c3                   	ret
+
+0000000000805450 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805450:	55                   	push   %rbp
+  805451:	48 89 e5             	mov    %rsp,%rbp
+  805454:	41 57                	push   %r15
+  805456:	41 56                	push   %r14
+  805458:	41 55                	push   %r13
+  80545a:	41 54                	push   %r12
+  80545c:	53                   	push   %rbx
+  80545d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805461:	49 89 ff             	mov    %rdi,%r15
+  805464:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80546b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805472:	00 
+  805473:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80547a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805481:	00 00 00 
+  805484:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80548b:	48 89 d8             	mov    %rbx,%rax
+  80548e:	eb 09                	jmp    805499 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805490:	48 83 c0 20          	add    $0x20,%rax
+  805494:	4c 39 f0             	cmp    %r14,%rax
+  805497:	74 40                	je     8054d9 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805499:	48 8b 10             	mov    (%rax),%rdx
+  80549c:	4c 39 e2             	cmp    %r12,%rdx
+  80549f:	73 ef                	jae    805490 <munmap+0x40>
+  8054a1:	48 85 d2             	test   %rdx,%rdx
+  8054a4:	74 ea                	je     805490 <munmap+0x40>
+  8054a6:	48 89 d7             	mov    %rdx,%rdi
+  8054a9:	48 03 78 08          	add    0x8(%rax),%rdi
+  8054ad:	49 39 ff             	cmp    %rdi,%r15
+  8054b0:	73 de                	jae    805490 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  8054b2:	49 39 fc             	cmp    %rdi,%r12
+  8054b5:	72 05                	jb     8054bc <munmap+0x6c>
+  8054b7:	4c 39 fa             	cmp    %r15,%rdx
+  8054ba:	73 d4                	jae    805490 <munmap+0x40>
+  8054bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8054c1:	48 83 c4 08          	add    $0x8,%rsp
+  8054c5:	5b                   	pop    %rbx
+  8054c6:	41 5c                	pop    %r12
+  8054c8:	41 5d                	pop    %r13
+  8054ca:	41 5e                	pop    %r14
+  8054cc:	41 5f                	pop    %r15
+  8054ce:	5d                   	pop    %rbp
+  8054cf:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8054d0:	48 83 c3 20          	add    $0x20,%rbx
+  8054d4:	4c 39 f3             	cmp    %r14,%rbx
+  8054d7:	74 5c                	je     805535 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8054d9:	48 8b 33             	mov    (%rbx),%rsi
+  8054dc:	4c 39 e6             	cmp    %r12,%rsi
+  8054df:	73 ef                	jae    8054d0 <munmap+0x80>
+  8054e1:	48 85 f6             	test   %rsi,%rsi
+  8054e4:	74 ea                	je     8054d0 <munmap+0x80>
+  8054e6:	48 89 f2             	mov    %rsi,%rdx
+  8054e9:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8054ed:	49 39 d7             	cmp    %rdx,%r15
+  8054f0:	73 de                	jae    8054d0 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8054f2:	48 89 df             	mov    %rbx,%rdi
+  8054f5:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  8054fc:	00 00 00 
+  8054ff:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805501:	85 c0                	test   %eax,%eax
+  805503:	78 bc                	js     8054c1 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805505:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805509:	48 8b 33             	mov    (%rbx),%rsi
+  80550c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805511:	48 b8 14 2d 80 00 00 	movabs $0x802d14,%rax
+  805518:	00 00 00 
+  80551b:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80551d:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805520:	48 b8 3f 36 80 00 00 	movabs $0x80363f,%rax
+  805527:	00 00 00 
+  80552a:	ff d0                	call   *%rax
+        reg->start = 0;
+  80552c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805533:	eb 9b                	jmp    8054d0 <munmap+0x80>
+    return 0;
+  805535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80553a:	eb 85                	jmp    8054c1 <munmap+0x71>
+
+000000000080553c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80553c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805541:	c3                   	ret
+
+0000000000805542 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805542:	55                   	push   %rbp
+  805543:	48 89 e5             	mov    %rsp,%rbp
+  805546:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805549:	48 be bb 6b 80 00 00 	movabs $0x806bbb,%rsi
+  805550:	00 00 00 
+  805553:	48 b8 d7 24 80 00 00 	movabs $0x8024d7,%rax
+  80555a:	00 00 00 
+  80555d:	ff d0                	call   *%rax
+    return 0;
+}
+  80555f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805564:	5d                   	pop    %rbp
+  805565:	c3                   	ret
+
+0000000000805566 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805566:	55                   	push   %rbp
+  805567:	48 89 e5             	mov    %rsp,%rbp
+  80556a:	41 57                	push   %r15
+  80556c:	41 56                	push   %r14
+  80556e:	41 55                	push   %r13
+  805570:	41 54                	push   %r12
+  805572:	53                   	push   %rbx
+  805573:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80557a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805581:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805588:	00 00 00 00 
+  80558c:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805593:	00 00 00 00 
+  805597:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80559e:	00 00 00 00 
+  8055a2:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  8055a9:	00 00 00 00 
+  8055ad:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  8055b4:	00 00 00 00 
+  8055b8:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  8055bf:	00 00 00 00 
+  8055c3:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8055ca:	00 
+  8055cb:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8055d2:	00 
+  8055d3:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8055da:	00 
+  8055db:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8055e2:	00 
+  8055e3:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8055ea:	00 
+  8055eb:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8055f2:	00 
+  8055f3:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8055fa:	00 
+  8055fb:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805602:	00 
+  805603:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  80560a:	00 
+  80560b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805612:	00 
+    for (res = 0; res < n; res += inc) {
+  805613:	48 85 d2             	test   %rdx,%rdx
+  805616:	74 7a                	je     805692 <devcons_write+0x12c>
+  805618:	49 89 d6             	mov    %rdx,%r14
+  80561b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805621:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805626:	49 bf 27 28 80 00 00 	movabs $0x802827,%r15
+  80562d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805630:	4c 89 f3             	mov    %r14,%rbx
+  805633:	48 29 f3             	sub    %rsi,%rbx
+  805636:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80563b:	48 39 c3             	cmp    %rax,%rbx
+  80563e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805642:	4c 63 eb             	movslq %ebx,%r13
+  805645:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80564c:	48 01 c6             	add    %rax,%rsi
+  80564f:	4c 89 ea             	mov    %r13,%rdx
+  805652:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805659:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80565c:	4c 89 ee             	mov    %r13,%rsi
+  80565f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805666:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  80566d:	00 00 00 
+  805670:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805672:	41 01 dc             	add    %ebx,%r12d
+  805675:	49 63 f4             	movslq %r12d,%rsi
+  805678:	4c 39 f6             	cmp    %r14,%rsi
+  80567b:	72 b3                	jb     805630 <devcons_write+0xca>
+    return res;
+  80567d:	49 63 c4             	movslq %r12d,%rax
+}
+  805680:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805687:	5b                   	pop    %rbx
+  805688:	41 5c                	pop    %r12
+  80568a:	41 5d                	pop    %r13
+  80568c:	41 5e                	pop    %r14
+  80568e:	41 5f                	pop    %r15
+  805690:	5d                   	pop    %rbp
+  805691:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805692:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805698:	eb e3                	jmp    80567d <devcons_write+0x117>
+
+000000000080569a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80569a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80569d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056a2:	48 85 c0             	test   %rax,%rax
+  8056a5:	74 55                	je     8056fc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8056a7:	55                   	push   %rbp
+  8056a8:	48 89 e5             	mov    %rsp,%rbp
+  8056ab:	41 55                	push   %r13
+  8056ad:	41 54                	push   %r12
+  8056af:	53                   	push   %rbx
+  8056b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8056b4:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8056b7:	48 bb 87 2a 80 00 00 	movabs $0x802a87,%rbx
+  8056be:	00 00 00 
+  8056c1:	49 bc 9b 2b 80 00 00 	movabs $0x802b9b,%r12
+  8056c8:	00 00 00 
+  8056cb:	eb 03                	jmp    8056d0 <devcons_read+0x36>
+  8056cd:	41 ff d4             	call   *%r12
+  8056d0:	ff d3                	call   *%rbx
+  8056d2:	85 c0                	test   %eax,%eax
+  8056d4:	74 f7                	je     8056cd <devcons_read+0x33>
+    if (c < 0) return c;
+  8056d6:	48 63 d0             	movslq %eax,%rdx
+  8056d9:	78 13                	js     8056ee <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8056db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056e0:	83 f8 04             	cmp    $0x4,%eax
+  8056e3:	74 09                	je     8056ee <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8056e5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8056e9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8056ee:	48 89 d0             	mov    %rdx,%rax
+  8056f1:	48 83 c4 08          	add    $0x8,%rsp
+  8056f5:	5b                   	pop    %rbx
+  8056f6:	41 5c                	pop    %r12
+  8056f8:	41 5d                	pop    %r13
+  8056fa:	5d                   	pop    %rbp
+  8056fb:	c3                   	ret
+  8056fc:	48 89 d0             	mov    %rdx,%rax
+  8056ff:	c3                   	ret
+
+0000000000805700 <cputchar>:
+cputchar(int ch) {
+  805700:	55                   	push   %rbp
+  805701:	48 89 e5             	mov    %rsp,%rbp
+  805704:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805708:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80570c:	be 01 00 00 00       	mov    $0x1,%esi
+  805711:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805715:	48 b8 54 2a 80 00 00 	movabs $0x802a54,%rax
+  80571c:	00 00 00 
+  80571f:	ff d0                	call   *%rax
+}
+  805721:	c9                   	leave
+  805722:	c3                   	ret
+
+0000000000805723 <getchar>:
+getchar(void) {
+  805723:	55                   	push   %rbp
+  805724:	48 89 e5             	mov    %rsp,%rbp
+  805727:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80572b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805730:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805734:	bf 00 00 00 00       	mov    $0x0,%edi
+  805739:	48 b8 bd 37 80 00 00 	movabs $0x8037bd,%rax
+  805740:	00 00 00 
+  805743:	ff d0                	call   *%rax
+  805745:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805747:	85 c0                	test   %eax,%eax
+  805749:	78 06                	js     805751 <getchar+0x2e>
+  80574b:	74 08                	je     805755 <getchar+0x32>
+  80574d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805751:	89 d0                	mov    %edx,%eax
+  805753:	c9                   	leave
+  805754:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805755:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80575a:	eb f5                	jmp    805751 <getchar+0x2e>
+
+000000000080575c <iscons>:
+iscons(int fdnum) {
+  80575c:	55                   	push   %rbp
+  80575d:	48 89 e5             	mov    %rsp,%rbp
+  805760:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805764:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805768:	48 b8 da 34 80 00 00 	movabs $0x8034da,%rax
+  80576f:	00 00 00 
+  805772:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805774:	85 c0                	test   %eax,%eax
+  805776:	78 18                	js     805790 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805778:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80577c:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  805783:	00 00 00 
+  805786:	8b 00                	mov    (%rax),%eax
+  805788:	39 02                	cmp    %eax,(%rdx)
+  80578a:	0f 94 c0             	sete   %al
+  80578d:	0f b6 c0             	movzbl %al,%eax
+}
+  805790:	c9                   	leave
+  805791:	c3                   	ret
+
+0000000000805792 <opencons>:
+opencons(void) {
+  805792:	55                   	push   %rbp
+  805793:	48 89 e5             	mov    %rsp,%rbp
+  805796:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80579a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80579e:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  8057a5:	00 00 00 
+  8057a8:	ff d0                	call   *%rax
+  8057aa:	85 c0                	test   %eax,%eax
+  8057ac:	78 49                	js     8057f7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8057ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8057b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8057b8:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8057bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057c1:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  8057c8:	00 00 00 
+  8057cb:	ff d0                	call   *%rax
+  8057cd:	85 c0                	test   %eax,%eax
+  8057cf:	78 26                	js     8057f7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8057d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8057d5:	a1 e0 70 80 00 00 00 	movabs 0x8070e0,%eax
+  8057dc:	00 00 
+  8057de:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8057e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8057e4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8057eb:	48 b8 4c 34 80 00 00 	movabs $0x80344c,%rax
+  8057f2:	00 00 00 
+  8057f5:	ff d0                	call   *%rax
+}
+  8057f7:	c9                   	leave
+  8057f8:	c3                   	ret
+
+00000000008057f9 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8057f9:	55                   	push   %rbp
+  8057fa:	48 89 e5             	mov    %rsp,%rbp
+  8057fd:	41 56                	push   %r14
+  8057ff:	41 55                	push   %r13
+  805801:	41 54                	push   %r12
+  805803:	53                   	push   %rbx
+  805804:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805807:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80580e:	00 00 00 
+  805811:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805815:	74 27                	je     80583e <_handle_vectored_pagefault+0x45>
+  805817:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80581c:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805823:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805826:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805829:	4c 89 e7             	mov    %r12,%rdi
+  80582c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805831:	84 c0                	test   %al,%al
+  805833:	75 45                	jne    80587a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805835:	48 83 c3 01          	add    $0x1,%rbx
+  805839:	49 3b 1e             	cmp    (%r14),%rbx
+  80583c:	72 eb                	jb     805829 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80583e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805845:	00 
+  805846:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80584b:	4d 8b 04 24          	mov    (%r12),%r8
+  80584f:	48 ba c8 6b 80 00 00 	movabs $0x806bc8,%rdx
+  805856:	00 00 00 
+  805859:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80585e:	48 bf f8 6b 80 00 00 	movabs $0x806bf8,%rdi
+  805865:	00 00 00 
+  805868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80586d:	49 ba 50 1a 80 00 00 	movabs $0x801a50,%r10
+  805874:	00 00 00 
+  805877:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80587a:	5b                   	pop    %rbx
+  80587b:	41 5c                	pop    %r12
+  80587d:	41 5d                	pop    %r13
+  80587f:	41 5e                	pop    %r14
+  805881:	5d                   	pop    %rbp
+  805882:	c3                   	ret
+
+0000000000805883 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805883:	55                   	push   %rbp
+  805884:	48 89 e5             	mov    %rsp,%rbp
+  805887:	53                   	push   %rbx
+  805888:	48 83 ec 08          	sub    $0x8,%rsp
+  80588c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80588f:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805894:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80589b:	00 00 00 
+  80589e:	80 38 00             	cmpb   $0x0,(%rax)
+  8058a1:	74 68                	je     80590b <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8058a3:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8058aa:	00 00 00 
+  8058ad:	48 8b 08             	mov    (%rax),%rcx
+  8058b0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8058b5:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058bc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8058bf:	48 85 c9             	test   %rcx,%rcx
+  8058c2:	0f 84 e0 00 00 00    	je     8059a8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8058c8:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8058cc:	0f 84 c9 00 00 00    	je     80599b <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8058d2:	48 83 c2 01          	add    $0x1,%rdx
+  8058d6:	48 39 ca             	cmp    %rcx,%rdx
+  8058d9:	75 ed                	jne    8058c8 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8058db:	48 83 f9 08          	cmp    $0x8,%rcx
+  8058df:	0f 84 84 00 00 00    	je     805969 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8058e5:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8058e9:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8058f0:	00 00 00 
+  8058f3:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8058fa:	00 00 00 
+  8058fd:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805901:	85 f6                	test   %esi,%esi
+  805903:	0f 89 97 00 00 00    	jns    8059a0 <add_pgfault_handler+0x11d>
+  805909:	eb 63                	jmp    80596e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80590b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805910:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805915:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80591c:	00 00 00 
+  80591f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805924:	48 b8 3c 2c 80 00 00 	movabs $0x802c3c,%rax
+  80592b:	00 00 00 
+  80592e:	ff d0                	call   *%rax
+  805930:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805932:	85 c0                	test   %eax,%eax
+  805934:	78 38                	js     80596e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805936:	48 be 84 5a 80 00 00 	movabs $0x805a84,%rsi
+  80593d:	00 00 00 
+  805940:	bf 00 00 00 00       	mov    $0x0,%edi
+  805945:	48 b8 5f 2e 80 00 00 	movabs $0x802e5f,%rax
+  80594c:	00 00 00 
+  80594f:	ff d0                	call   *%rax
+  805951:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805953:	85 c0                	test   %eax,%eax
+  805955:	78 17                	js     80596e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  805957:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80595e:	00 00 00 
+  805961:	c6 00 01             	movb   $0x1,(%rax)
+  805964:	e9 3a ff ff ff       	jmp    8058a3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  805969:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80596e:	89 f1                	mov    %esi,%ecx
+  805970:	48 ba 06 6c 80 00 00 	movabs $0x806c06,%rdx
+  805977:	00 00 00 
+  80597a:	be 42 00 00 00       	mov    $0x42,%esi
+  80597f:	48 bf f8 6b 80 00 00 	movabs $0x806bf8,%rdi
+  805986:	00 00 00 
+  805989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80598e:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  805995:	00 00 00 
+  805998:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80599b:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8059a0:	89 f0                	mov    %esi,%eax
+  8059a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8059a6:	c9                   	leave
+  8059a7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8059a8:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8059af:	00 00 00 
+  8059b2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8059b9:	48 89 d8             	mov    %rbx,%rax
+  8059bc:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  8059c3:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8059c6:	eb d8                	jmp    8059a0 <add_pgfault_handler+0x11d>
+
+00000000008059c8 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8059c8:	55                   	push   %rbp
+  8059c9:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8059cc:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8059d3:	00 00 00 
+  8059d6:	80 38 00             	cmpb   $0x0,(%rax)
+  8059d9:	74 33                	je     805a0e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8059db:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8059e2:	00 00 00 
+  8059e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8059ea:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8059f1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8059f4:	48 85 c0             	test   %rax,%rax
+  8059f7:	0f 84 85 00 00 00    	je     805a82 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8059fd:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805a01:	74 40                	je     805a43 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805a03:	48 83 c1 01          	add    $0x1,%rcx
+  805a07:	48 39 c1             	cmp    %rax,%rcx
+  805a0a:	75 f1                	jne    8059fd <remove_pgfault_handler+0x35>
+  805a0c:	eb 74                	jmp    805a82 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805a0e:	48 b9 1e 6c 80 00 00 	movabs $0x806c1e,%rcx
+  805a15:	00 00 00 
+  805a18:	48 ba f6 6a 80 00 00 	movabs $0x806af6,%rdx
+  805a1f:	00 00 00 
+  805a22:	be 48 00 00 00       	mov    $0x48,%esi
+  805a27:	48 bf f8 6b 80 00 00 	movabs $0x806bf8,%rdi
+  805a2e:	00 00 00 
+  805a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a36:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  805a3d:	00 00 00 
+  805a40:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805a43:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805a4a:	00 
+  805a4b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805a4f:	48 29 ca             	sub    %rcx,%rdx
+  805a52:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805a59:	00 00 00 
+  805a5c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805a60:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805a65:	48 89 ce             	mov    %rcx,%rsi
+  805a68:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  805a6f:	00 00 00 
+  805a72:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805a74:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805a7b:	00 00 00 
+  805a7e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805a82:	5d                   	pop    %rbp
+  805a83:	c3                   	ret
+
+0000000000805a84 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805a84:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805a87:	48 b8 f9 57 80 00 00 	movabs $0x8057f9,%rax
+  805a8e:	00 00 00 
+    call *%rax
+  805a91:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805a93:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805a9a:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805a9b:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805aa2:	00 
+    subq $8, %rcx
+  805aa3:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805aa7:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805aaa:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805ab1:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805ab2:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805ab6:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805aba:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805abf:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805ac4:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805ac9:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805ace:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805ad3:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805ad8:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805add:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805ae2:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805ae7:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805aec:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805af1:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805af6:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805afb:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805b00:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805b04:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805b08:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805b09:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805b0a:	c3                   	ret
+
+0000000000805b0b <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805b0b:	85 ff                	test   %edi,%edi
+  805b0d:	78 58                	js     805b67 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805b0f:	48 85 f6             	test   %rsi,%rsi
+  805b12:	74 12                	je     805b26 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805b14:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805b1b:	00 00 00 
+  805b1e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  805b24:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  805b26:	48 85 c9             	test   %rcx,%rcx
+  805b29:	74 12                	je     805b3d <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805b2b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805b32:	00 00 00 
+  805b35:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805b3b:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805b3d:	48 85 d2             	test   %rdx,%rdx
+  805b40:	74 14                	je     805b56 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805b42:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805b49:	00 00 00 
+  805b4c:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805b53:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  805b56:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805b5d:	00 00 00 
+  805b60:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  805b66:	c3                   	ret
+        if (from_env_store) {
+  805b67:	48 85 f6             	test   %rsi,%rsi
+  805b6a:	74 06                	je     805b72 <ipc_result+0x67>
+            *from_env_store = 0;
+  805b6c:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805b72:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  805b74:	48 85 c9             	test   %rcx,%rcx
+  805b77:	74 ed                	je     805b66 <ipc_result+0x5b>
+            *perm_store = 0;
+  805b79:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805b7f:	c3                   	ret
+
+0000000000805b80 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805b80:	55                   	push   %rbp
+  805b81:	48 89 e5             	mov    %rsp,%rbp
+  805b84:	41 55                	push   %r13
+  805b86:	41 54                	push   %r12
+  805b88:	53                   	push   %rbx
+  805b89:	48 83 ec 08          	sub    $0x8,%rsp
+  805b8d:	49 89 fc             	mov    %rdi,%r12
+  805b90:	48 89 f7             	mov    %rsi,%rdi
+  805b93:	48 89 d3             	mov    %rdx,%rbx
+  805b96:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805b99:	48 85 f6             	test   %rsi,%rsi
+  805b9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ba3:	00 00 00 
+  805ba6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805baa:	be 00 00 00 00       	mov    $0x0,%esi
+  805baf:	48 85 d2             	test   %rdx,%rdx
+  805bb2:	74 03                	je     805bb7 <ipc_recv+0x37>
+  805bb4:	48 8b 32             	mov    (%rdx),%rsi
+  805bb7:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  805bbe:	00 00 00 
+  805bc1:	ff d0                	call   *%rax
+  805bc3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805bc5:	4c 89 e9             	mov    %r13,%rcx
+  805bc8:	48 89 da             	mov    %rbx,%rdx
+  805bcb:	4c 89 e6             	mov    %r12,%rsi
+  805bce:	48 b8 0b 5b 80 00 00 	movabs $0x805b0b,%rax
+  805bd5:	00 00 00 
+  805bd8:	ff d0                	call   *%rax
+}
+  805bda:	48 83 c4 08          	add    $0x8,%rsp
+  805bde:	5b                   	pop    %rbx
+  805bdf:	41 5c                	pop    %r12
+  805be1:	41 5d                	pop    %r13
+  805be3:	5d                   	pop    %rbp
+  805be4:	c3                   	ret
+
+0000000000805be5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805be5:	55                   	push   %rbp
+  805be6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805be9:	48 85 d2             	test   %rdx,%rdx
+  805bec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805bf3:	00 00 00 
+  805bf6:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805bfa:	89 f6                	mov    %esi,%esi
+  805bfc:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  805c03:	00 00 00 
+  805c06:	ff d0                	call   *%rax
+    if (res < 0) {
+  805c08:	85 c0                	test   %eax,%eax
+  805c0a:	78 02                	js     805c0e <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805c0c:	5d                   	pop    %rbp
+  805c0d:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805c0e:	89 c1                	mov    %eax,%ecx
+  805c10:	48 ba 38 6c 80 00 00 	movabs $0x806c38,%rdx
+  805c17:	00 00 00 
+  805c1a:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805c1f:	48 bf 45 6c 80 00 00 	movabs $0x806c45,%rdi
+  805c26:	00 00 00 
+  805c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c2e:	49 b8 50 1a 80 00 00 	movabs $0x801a50,%r8
+  805c35:	00 00 00 
+  805c38:	41 ff d0             	call   *%r8
+
+0000000000805c3b <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805c3b:	55                   	push   %rbp
+  805c3c:	48 89 e5             	mov    %rsp,%rbp
+  805c3f:	53                   	push   %rbx
+  805c40:	48 83 ec 08          	sub    $0x8,%rsp
+  805c44:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805c48:	48 85 d2             	test   %rdx,%rdx
+  805c4b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c52:	00 00 00 
+  805c55:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805c59:	4d 85 c9             	test   %r9,%r9
+  805c5c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c65:	48 85 db             	test   %rbx,%rbx
+  805c68:	74 03                	je     805c6d <ipc_call+0x32>
+  805c6a:	48 8b 03             	mov    (%rbx),%rax
+  805c6d:	89 f6                	mov    %esi,%esi
+  805c6f:	48 83 ec 08          	sub    $0x8,%rsp
+  805c73:	50                   	push   %rax
+  805c74:	48 b8 46 30 80 00 00 	movabs $0x803046,%rax
+  805c7b:	00 00 00 
+  805c7e:	ff d0                	call   *%rax
+  805c80:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805c82:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805c86:	48 89 da             	mov    %rbx,%rdx
+  805c89:	be 00 00 00 00       	mov    $0x0,%esi
+  805c8e:	48 b8 0b 5b 80 00 00 	movabs $0x805b0b,%rax
+  805c95:	00 00 00 
+  805c98:	ff d0                	call   *%rax
+}
+  805c9a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805c9e:	c9                   	leave
+  805c9f:	c3                   	ret
+
+0000000000805ca0 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805ca0:	55                   	push   %rbp
+  805ca1:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805ca4:	89 f6                	mov    %esi,%esi
+  805ca6:	48 b8 b2 30 80 00 00 	movabs $0x8030b2,%rax
+  805cad:	00 00 00 
+  805cb0:	ff d0                	call   *%rax
+  805cb2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805cb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  805cc3:	48 b8 0b 5b 80 00 00 	movabs $0x805b0b,%rax
+  805cca:	00 00 00 
+  805ccd:	ff d0                	call   *%rax
+}
+  805ccf:	5d                   	pop    %rbp
+  805cd0:	c3                   	ret
+
+0000000000805cd1 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805cd1:	55                   	push   %rbp
+  805cd2:	48 89 e5             	mov    %rsp,%rbp
+  805cd5:	41 54                	push   %r12
+  805cd7:	53                   	push   %rbx
+  805cd8:	4c 89 cb             	mov    %r9,%rbx
+  805cdb:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805cdf:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805ce3:	48 85 d2             	test   %rdx,%rdx
+  805ce6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805ced:	00 00 00 
+  805cf0:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805cf4:	4d 85 c9             	test   %r9,%r9
+  805cf7:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d00:	4d 85 e4             	test   %r12,%r12
+  805d03:	74 04                	je     805d09 <ipc_reply_wait+0x38>
+  805d05:	49 8b 04 24          	mov    (%r12),%rax
+  805d09:	89 f6                	mov    %esi,%esi
+  805d0b:	48 83 ec 08          	sub    $0x8,%rsp
+  805d0f:	50                   	push   %rax
+  805d10:	48 b8 1c 31 80 00 00 	movabs $0x80311c,%rax
+  805d17:	00 00 00 
+  805d1a:	ff d0                	call   *%rax
+  805d1c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805d1e:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805d22:	4c 89 e2             	mov    %r12,%rdx
+  805d25:	48 89 de             	mov    %rbx,%rsi
+  805d28:	48 b8 0b 5b 80 00 00 	movabs $0x805b0b,%rax
+  805d2f:	00 00 00 
+  805d32:	ff d0                	call   *%rax
+}
+  805d34:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805d38:	5b                   	pop    %rbx
+  805d39:	41 5c                	pop    %r12
+  805d3b:	5d                   	pop    %rbp
+  805d3c:	c3                   	ret
+
+0000000000805d3d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805d42:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805d49:	00 00 00 
+  805d4c:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805d53:	48 01 ca             	add    %rcx,%rdx
+  805d56:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805d5c:	39 fa                	cmp    %edi,%edx
+  805d5e:	74 12                	je     805d72 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805d60:	48 83 c0 01          	add    $0x1,%rax
+  805d64:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805d6a:	75 e0                	jne    805d4c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d71:	c3                   	ret
+            return envs[i].env_id;
+  805d72:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805d79:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805d80:	00 00 00 
+  805d83:	48 01 d0             	add    %rdx,%rax
+  805d86:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805d8c:	c3                   	ret
+  805d8d:	0f 1f 00             	nopl   (%rax)
+
+0000000000805d90 <__rodata_start>:
+  805d90:	77 00                	ja     805d92 <__rodata_start+0x2>
+  805d92:	72 62                	jb     805df6 <__rodata_start+0x66>
+  805d94:	00 77 62             	add    %dh,0x62(%rdi)
+  805d97:	00 0f                	add    %cl,(%rdi)
+  805d99:	1f                   	(bad)
+  805d9a:	84 00                	test   %al,(%rax)
+  805d9c:	00 00                	add    %al,(%rax)
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	b3 09                	mov    $0x9,%bl
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 ed                	add    %ch,%ch
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	ed                   	in     (%dx),%eax
+  805db9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dbe:	00 00                	add    %al,(%rax)
+  805dc0:	ed                   	in     (%dx),%eax
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 ed                	add    %ch,%ch
+  805dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dd6:	00 00                	add    %al,(%rax)
+  805dd8:	ed                   	in     (%dx),%eax
+  805dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dde:	00 00                	add    %al,(%rax)
+  805de0:	ed                   	in     (%dx),%eax
+  805de1:	0d 80 00 00 00       	or     $0x80,%eax
+  805de6:	00 00                	add    %al,(%rax)
+  805de8:	ed                   	in     (%dx),%eax
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	ed                   	in     (%dx),%eax
+  805df1:	0d 80 00 00 00       	or     $0x80,%eax
+  805df6:	00 00                	add    %al,(%rax)
+  805df8:	8c 0a                	mov    %cs,(%rdx)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805e06:	00 00                	add    %al,(%rax)
+  805e08:	8c 0a                	mov    %cs,(%rdx)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	8c 0a                	mov    %cs,(%rdx)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805e26:	00 00                	add    %al,(%rax)
+  805e28:	8c 0a                	mov    %cs,(%rdx)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805e36:	00 00                	add    %al,(%rax)
+  805e38:	8c 0a                	mov    %cs,(%rdx)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805e46:	00 00                	add    %al,(%rax)
+  805e48:	ed                   	in     (%dx),%eax
+  805e49:	0d 80 00 00 00       	or     $0x80,%eax
+  805e4e:	00 00                	add    %al,(%rax)
+  805e50:	ed                   	in     (%dx),%eax
+  805e51:	0d 80 00 00 00       	or     $0x80,%eax
+  805e56:	00 00                	add    %al,(%rax)
+  805e58:	ed                   	in     (%dx),%eax
+  805e59:	0d 80 00 00 00       	or     $0x80,%eax
+  805e5e:	00 00                	add    %al,(%rax)
+  805e60:	ed                   	in     (%dx),%eax
+  805e61:	0d 80 00 00 00       	or     $0x80,%eax
+  805e66:	00 00                	add    %al,(%rax)
+  805e68:	ed                   	in     (%dx),%eax
+  805e69:	0d 80 00 00 00       	or     $0x80,%eax
+  805e6e:	00 00                	add    %al,(%rax)
+  805e70:	ed                   	in     (%dx),%eax
+  805e71:	0d 80 00 00 00       	or     $0x80,%eax
+  805e76:	00 00                	add    %al,(%rax)
+  805e78:	ed                   	in     (%dx),%eax
+  805e79:	0d 80 00 00 00       	or     $0x80,%eax
+  805e7e:	00 00                	add    %al,(%rax)
+  805e80:	ed                   	in     (%dx),%eax
+  805e81:	0d 80 00 00 00       	or     $0x80,%eax
+  805e86:	00 00                	add    %al,(%rax)
+  805e88:	ed                   	in     (%dx),%eax
+  805e89:	0d 80 00 00 00       	or     $0x80,%eax
+  805e8e:	00 00                	add    %al,(%rax)
+  805e90:	ed                   	in     (%dx),%eax
+  805e91:	0d 80 00 00 00       	or     $0x80,%eax
+  805e96:	00 00                	add    %al,(%rax)
+  805e98:	ed                   	in     (%dx),%eax
+  805e99:	0d 80 00 00 00       	or     $0x80,%eax
+  805e9e:	00 00                	add    %al,(%rax)
+  805ea0:	ed                   	in     (%dx),%eax
+  805ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ea6:	00 00                	add    %al,(%rax)
+  805ea8:	ed                   	in     (%dx),%eax
+  805ea9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eae:	00 00                	add    %al,(%rax)
+  805eb0:	ed                   	in     (%dx),%eax
+  805eb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805eb6:	00 00                	add    %al,(%rax)
+  805eb8:	ed                   	in     (%dx),%eax
+  805eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ebe:	00 00                	add    %al,(%rax)
+  805ec0:	ed                   	in     (%dx),%eax
+  805ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ec6:	00 00                	add    %al,(%rax)
+  805ec8:	ed                   	in     (%dx),%eax
+  805ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ece:	00 00                	add    %al,(%rax)
+  805ed0:	ed                   	in     (%dx),%eax
+  805ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ed6:	00 00                	add    %al,(%rax)
+  805ed8:	ed                   	in     (%dx),%eax
+  805ed9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ede:	00 00                	add    %al,(%rax)
+  805ee0:	ed                   	in     (%dx),%eax
+  805ee1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ee6:	00 00                	add    %al,(%rax)
+  805ee8:	ed                   	in     (%dx),%eax
+  805ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  805eee:	00 00                	add    %al,(%rax)
+  805ef0:	ed                   	in     (%dx),%eax
+  805ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ef6:	00 00                	add    %al,(%rax)
+  805ef8:	ed                   	in     (%dx),%eax
+  805ef9:	0d 80 00 00 00       	or     $0x80,%eax
+  805efe:	00 00                	add    %al,(%rax)
+  805f00:	ed                   	in     (%dx),%eax
+  805f01:	0d 80 00 00 00       	or     $0x80,%eax
+  805f06:	00 00                	add    %al,(%rax)
+  805f08:	ed                   	in     (%dx),%eax
+  805f09:	0d 80 00 00 00       	or     $0x80,%eax
+  805f0e:	00 00                	add    %al,(%rax)
+  805f10:	ed                   	in     (%dx),%eax
+  805f11:	0d 80 00 00 00       	or     $0x80,%eax
+  805f16:	00 00                	add    %al,(%rax)
+  805f18:	ed                   	in     (%dx),%eax
+  805f19:	0d 80 00 00 00       	or     $0x80,%eax
+  805f1e:	00 00                	add    %al,(%rax)
+  805f20:	ed                   	in     (%dx),%eax
+  805f21:	0d 80 00 00 00       	or     $0x80,%eax
+  805f26:	00 00                	add    %al,(%rax)
+  805f28:	ed                   	in     (%dx),%eax
+  805f29:	0d 80 00 00 00       	or     $0x80,%eax
+  805f2e:	00 00                	add    %al,(%rax)
+  805f30:	ed                   	in     (%dx),%eax
+  805f31:	0d 80 00 00 00       	or     $0x80,%eax
+  805f36:	00 00                	add    %al,(%rax)
+  805f38:	f4                   	hlt
+  805f39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805f3f:	00 ed                	add    %ch,%ch
+  805f41:	0d 80 00 00 00       	or     $0x80,%eax
+  805f46:	00 00                	add    %al,(%rax)
+  805f48:	ed                   	in     (%dx),%eax
+  805f49:	0d 80 00 00 00       	or     $0x80,%eax
+  805f4e:	00 00                	add    %al,(%rax)
+  805f50:	2c 0b                	sub    $0xb,%al
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 ed                	add    %ch,%ch
+  805f59:	0d 80 00 00 00       	or     $0x80,%eax
+  805f5e:	00 00                	add    %al,(%rax)
+  805f60:	ed                   	in     (%dx),%eax
+  805f61:	0d 80 00 00 00       	or     $0x80,%eax
+  805f66:	00 00                	add    %al,(%rax)
+  805f68:	ed                   	in     (%dx),%eax
+  805f69:	0d 80 00 00 00       	or     $0x80,%eax
+  805f6e:	00 00                	add    %al,(%rax)
+  805f70:	ed                   	in     (%dx),%eax
+  805f71:	0d 80 00 00 00       	or     $0x80,%eax
+  805f76:	00 00                	add    %al,(%rax)
+  805f78:	ed                   	in     (%dx),%eax
+  805f79:	0d 80 00 00 00       	or     $0x80,%eax
+  805f7e:	00 00                	add    %al,(%rax)
+  805f80:	ed                   	in     (%dx),%eax
+  805f81:	0d 80 00 00 00       	or     $0x80,%eax
+  805f86:	00 00                	add    %al,(%rax)
+  805f88:	ed                   	in     (%dx),%eax
+  805f89:	0d 80 00 00 00       	or     $0x80,%eax
+  805f8e:	00 00                	add    %al,(%rax)
+  805f90:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805f93:	00 00                	add    %al,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 cb                	add    %cl,%bl
+  805f99:	0d 80 00 00 00       	or     $0x80,%eax
+  805f9e:	00 00                	add    %al,(%rax)
+  805fa0:	ed                   	in     (%dx),%eax
+  805fa1:	0d 80 00 00 00       	or     $0x80,%eax
+  805fa6:	00 00                	add    %al,(%rax)
+  805fa8:	ed                   	in     (%dx),%eax
+  805fa9:	0d 80 00 00 00       	or     $0x80,%eax
+  805fae:	00 00                	add    %al,(%rax)
+  805fb0:	ed                   	in     (%dx),%eax
+  805fb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805fb6:	00 00                	add    %al,(%rax)
+  805fb8:	6a 0a                	push   $0xa
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 ed                	add    %ch,%ch
+  805fc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805fce:	00 00                	add    %al,(%rax)
+  805fd0:	ed                   	in     (%dx),%eax
+  805fd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805fd6:	00 00                	add    %al,(%rax)
+  805fd8:	3c 0a                	cmp    $0xa,%al
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 ed                	add    %ch,%ch
+  805fe1:	0d 80 00 00 00       	or     $0x80,%eax
+  805fe6:	00 00                	add    %al,(%rax)
+  805fe8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805feb:	00 00                	add    %al,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 29                	add    %ch,(%rcx)
+  805ff9:	0c 80                	or     $0x80,%al
+  805ffb:	00 00                	add    %al,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5e 0a             	add    %bl,0xa(%rsi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 ed                	add    %ch,%ch
+  806009:	0d 80 00 00 00       	or     $0x80,%eax
+  80600e:	00 00                	add    %al,(%rax)
+  806010:	1a 0b                	sbb    (%rbx),%cl
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 ed                	add    %ch,%ch
+  806019:	0d 80 00 00 00       	or     $0x80,%eax
+  80601e:	00 00                	add    %al,(%rax)
+  806020:	ce                   	(bad)
+  806021:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  806027:	00 ed                	add    %ch,%ch
+  806029:	0d 80 00 00 00       	or     $0x80,%eax
+  80602e:	00 00                	add    %al,(%rax)
+  806030:	ed                   	in     (%dx),%eax
+  806031:	0d 80 00 00 00       	or     $0x80,%eax
+  806036:	00 00                	add    %al,(%rax)
+  806038:	f4                   	hlt
+  806039:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80603f:	00 37                	add    %dh,(%rdi)
+  806041:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 37                	add    %dh,(%rdi)
+  806051:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80606b:	00 00                	add    %al,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 d2                	add    %dl,%dl
+  806071:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806077:	00 d2                	add    %dl,%dl
+  806079:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80607f:	00 d2                	add    %dl,%dl
+  806081:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806087:	00 d2                	add    %dl,%dl
+  806089:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80608f:	00 d2                	add    %dl,%dl
+  806091:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806097:	00 d2                	add    %dl,%dl
+  806099:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80609f:	00 d2                	add    %dl,%dl
+  8060a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8060a7:	00 f6                	add    %dh,%dh
+  8060a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8060af:	00 f6                	add    %dh,%dh
+  8060b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8060b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ba:	80 00 00             	addb   $0x0,(%rax)
+  8060bd:	00 00                	add    %al,(%rax)
+  8060bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060c2:	80 00 00             	addb   $0x0,(%rax)
+  8060c5:	00 00                	add    %al,(%rax)
+  8060c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ca:	80 00 00             	addb   $0x0,(%rax)
+  8060cd:	00 00                	add    %al,(%rax)
+  8060cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060d2:	80 00 00             	addb   $0x0,(%rax)
+  8060d5:	00 00                	add    %al,(%rax)
+  8060d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060da:	80 00 00             	addb   $0x0,(%rax)
+  8060dd:	00 00                	add    %al,(%rax)
+  8060df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060e2:	80 00 00             	addb   $0x0,(%rax)
+  8060e5:	00 00                	add    %al,(%rax)
+  8060e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8060ea:	80 00 00             	addb   $0x0,(%rax)
+  8060ed:	00 00                	add    %al,(%rax)
+  8060ef:	00 22                	add    %ah,(%rdx)
+  8060f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060f7:	00 22                	add    %ah,(%rdx)
+  8060f9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8060ff:	00 22                	add    %ah,(%rdx)
+  806101:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806107:	00 22                	add    %ah,(%rdx)
+  806109:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80610f:	00 22                	add    %ah,(%rdx)
+  806111:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806117:	00 22                	add    %ah,(%rdx)
+  806119:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80611f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806122:	80 00 00             	addb   $0x0,(%rax)
+  806125:	00 00                	add    %al,(%rax)
+  806127:	00 5f 12             	add    %bl,0x12(%rdi)
+  80612a:	80 00 00             	addb   $0x0,(%rax)
+  80612d:	00 00                	add    %al,(%rax)
+  80612f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806132:	80 00 00             	addb   $0x0,(%rax)
+  806135:	00 00                	add    %al,(%rax)
+  806137:	00 5f 12             	add    %bl,0x12(%rdi)
+  80613a:	80 00 00             	addb   $0x0,(%rax)
+  80613d:	00 00                	add    %al,(%rax)
+  80613f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806142:	80 00 00             	addb   $0x0,(%rax)
+  806145:	00 00                	add    %al,(%rax)
+  806147:	00 5f 12             	add    %bl,0x12(%rdi)
+  80614a:	80 00 00             	addb   $0x0,(%rax)
+  80614d:	00 00                	add    %al,(%rax)
+  80614f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806152:	80 00 00             	addb   $0x0,(%rax)
+  806155:	00 00                	add    %al,(%rax)
+  806157:	00 5f 12             	add    %bl,0x12(%rdi)
+  80615a:	80 00 00             	addb   $0x0,(%rax)
+  80615d:	00 00                	add    %al,(%rax)
+  80615f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806162:	80 00 00             	addb   $0x0,(%rax)
+  806165:	00 00                	add    %al,(%rax)
+  806167:	00 5f 12             	add    %bl,0x12(%rdi)
+  80616a:	80 00 00             	addb   $0x0,(%rax)
+  80616d:	00 00                	add    %al,(%rax)
+  80616f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806172:	80 00 00             	addb   $0x0,(%rax)
+  806175:	00 00                	add    %al,(%rax)
+  806177:	00 5f 12             	add    %bl,0x12(%rdi)
+  80617a:	80 00 00             	addb   $0x0,(%rax)
+  80617d:	00 00                	add    %al,(%rax)
+  80617f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806182:	80 00 00             	addb   $0x0,(%rax)
+  806185:	00 00                	add    %al,(%rax)
+  806187:	00 5f 12             	add    %bl,0x12(%rdi)
+  80618a:	80 00 00             	addb   $0x0,(%rax)
+  80618d:	00 00                	add    %al,(%rax)
+  80618f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806192:	80 00 00             	addb   $0x0,(%rax)
+  806195:	00 00                	add    %al,(%rax)
+  806197:	00 5f 12             	add    %bl,0x12(%rdi)
+  80619a:	80 00 00             	addb   $0x0,(%rax)
+  80619d:	00 00                	add    %al,(%rax)
+  80619f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061a2:	80 00 00             	addb   $0x0,(%rax)
+  8061a5:	00 00                	add    %al,(%rax)
+  8061a7:	00 46 12             	add    %al,0x12(%rsi)
+  8061aa:	80 00 00             	addb   $0x0,(%rax)
+  8061ad:	00 00                	add    %al,(%rax)
+  8061af:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061b2:	80 00 00             	addb   $0x0,(%rax)
+  8061b5:	00 00                	add    %al,(%rax)
+  8061b7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ba:	80 00 00             	addb   $0x0,(%rax)
+  8061bd:	00 00                	add    %al,(%rax)
+  8061bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061c2:	80 00 00             	addb   $0x0,(%rax)
+  8061c5:	00 00                	add    %al,(%rax)
+  8061c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ca:	80 00 00             	addb   $0x0,(%rax)
+  8061cd:	00 00                	add    %al,(%rax)
+  8061cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061d2:	80 00 00             	addb   $0x0,(%rax)
+  8061d5:	00 00                	add    %al,(%rax)
+  8061d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061da:	80 00 00             	addb   $0x0,(%rax)
+  8061dd:	00 00                	add    %al,(%rax)
+  8061df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061e2:	80 00 00             	addb   $0x0,(%rax)
+  8061e5:	00 00                	add    %al,(%rax)
+  8061e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8061ea:	80 00 00             	addb   $0x0,(%rax)
+  8061ed:	00 00                	add    %al,(%rax)
+  8061ef:	00 22                	add    %ah,(%rdx)
+  8061f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8061f7:	00 22                	add    %ah,(%rdx)
+  8061f9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8061ff:	00 22                	add    %ah,(%rdx)
+  806201:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806207:	00 22                	add    %ah,(%rdx)
+  806209:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80620f:	00 22                	add    %ah,(%rdx)
+  806211:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806217:	00 22                	add    %ah,(%rdx)
+  806219:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80621f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806222:	80 00 00             	addb   $0x0,(%rax)
+  806225:	00 00                	add    %al,(%rax)
+  806227:	00 5f 12             	add    %bl,0x12(%rdi)
+  80622a:	80 00 00             	addb   $0x0,(%rax)
+  80622d:	00 00                	add    %al,(%rax)
+  80622f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806232:	80 00 00             	addb   $0x0,(%rax)
+  806235:	00 00                	add    %al,(%rax)
+  806237:	00 5f 12             	add    %bl,0x12(%rdi)
+  80623a:	80 00 00             	addb   $0x0,(%rax)
+  80623d:	00 00                	add    %al,(%rax)
+  80623f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806242:	80 00 00             	addb   $0x0,(%rax)
+  806245:	00 00                	add    %al,(%rax)
+  806247:	00 5f 12             	add    %bl,0x12(%rdi)
+  80624a:	80 00 00             	addb   $0x0,(%rax)
+  80624d:	00 00                	add    %al,(%rax)
+  80624f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806252:	80 00 00             	addb   $0x0,(%rax)
+  806255:	00 00                	add    %al,(%rax)
+  806257:	00 5f 12             	add    %bl,0x12(%rdi)
+  80625a:	80 00 00             	addb   $0x0,(%rax)
+  80625d:	00 00                	add    %al,(%rax)
+  80625f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806262:	80 00 00             	addb   $0x0,(%rax)
+  806265:	00 00                	add    %al,(%rax)
+  806267:	00 5f 12             	add    %bl,0x12(%rdi)
+  80626a:	80 00 00             	addb   $0x0,(%rax)
+  80626d:	00 00                	add    %al,(%rax)
+  80626f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806272:	80 00 00             	addb   $0x0,(%rax)
+  806275:	00 00                	add    %al,(%rax)
+  806277:	00 5f 12             	add    %bl,0x12(%rdi)
+  80627a:	80 00 00             	addb   $0x0,(%rax)
+  80627d:	00 00                	add    %al,(%rax)
+  80627f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806282:	80 00 00             	addb   $0x0,(%rax)
+  806285:	00 00                	add    %al,(%rax)
+  806287:	00 5f 12             	add    %bl,0x12(%rdi)
+  80628a:	80 00 00             	addb   $0x0,(%rax)
+  80628d:	00 00                	add    %al,(%rax)
+  80628f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806292:	80 00 00             	addb   $0x0,(%rax)
+  806295:	00 00                	add    %al,(%rax)
+  806297:	00 5f 12             	add    %bl,0x12(%rdi)
+  80629a:	80 00 00             	addb   $0x0,(%rax)
+  80629d:	00 00                	add    %al,(%rax)
+  80629f:	00 5f 12             	add    %bl,0x12(%rdi)
+  8062a2:	80 00 00             	addb   $0x0,(%rax)
+  8062a5:	00 00                	add    %al,(%rax)
+  8062a7:	00 46 12             	add    %al,0x12(%rsi)
+  8062aa:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008062c0 <basefix.0>:
+  8062c0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8062d0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8062e0:	10 00 70 69 70 65 72 65 61 64 65 6f 66 00 70 69     ..pipereadeof.pi
+  8062f0:	70 65 3a 20 25 69 00 75 73 65 72 2f 74 65 73 74     pe: %i.user/test
+  806300:	70 69 70 65 2e 63 00 5b 25 30 38 78 5d 20 70 69     pipe.c.[%08x] pi
+  806310:	70 65 72 65 61 64 65 6f 66 20 63 6c 6f 73 65 20     pereadeof close 
+  806320:	25 64 0a 00 5b 25 30 38 78 5d 20 70 69 70 65 72     %d..[%08x] piper
+  806330:	65 61 64 65 6f 66 20 72 65 61 64 6e 20 25 64 0a     eadeof readn %d.
+  806340:	00 72 65 61 64 3a 20 25 69 00 0a 70 69 70 65 20     .read: %i..pipe 
+  806350:	72 65 61 64 20 63 6c 6f 73 65 64 20 70 72 6f 70     read closed prop
+  806360:	65 72 6c 79 0a 00 0a 67 6f 74 20 25 64 20 62 79     erly...got %d by
+  806370:	74 65 73 3a 20 25 73 0a 00 5b 25 30 38 78 5d 20     tes: %s..[%08x] 
+  806380:	70 69 70 65 72 65 61 64 65 6f 66 20 77 72 69 74     pipereadeof writ
+  806390:	65 20 25 64 0a 00 77 72 69 74 65 3a 20 25 69 00     e %d..write: %i.
+  8063a0:	70 69 70 65 77 72 69 74 65 65 6f 66 00 78 00 0a     pipewriteeof.x..
+  8063b0:	70 69 70 65 20 77 72 69 74 65 20 63 6c 6f 73 65     pipe write close
+  8063c0:	64 20 70 72 6f 70 65 72 6c 79 0a 00 70 69 70 65     d properly..pipe
+  8063d0:	20 74 65 73 74 73 20 70 61 73 73 65 64 0a 00 90      tests passed...
+  8063e0:	4e 6f 77 20 69 73 20 74 68 65 20 74 69 6d 65 20     Now is the time 
+  8063f0:	66 6f 72 20 61 6c 6c 20 67 6f 6f 64 20 6d 65 6e     for all good men
+  806400:	20 74 6f 20 63 6f 6d 65 20 74 6f 20 74 68 65 20      to come to the 
+  806410:	61 69 64 20 6f 66 20 74 68 65 69 72 20 70 61 72     aid of their par
+  806420:	74 79 2e 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 66 90     ty..<unknown>.f.
+  806430:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806440:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806450:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806460:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806470:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806480:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806490:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  8064a0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8064b0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8064c0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8064d0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8064e0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8064f0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806500:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806510:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806520:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806530:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806540:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806550:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806560:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806570:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806580:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806590:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  8065a0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8065b0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8065c0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8065d0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8065e0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  8065f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806600:	98 1d 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .........#......
+  806610:	df 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806620:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806630:	ef 23 80 00 00 00 00 00 b7 1d 80 00 00 00 00 00     .#..............
+  806640:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806650:	ab 1d 80 00 00 00 00 00 25 1e 80 00 00 00 00 00     ........%.......
+  806660:	ef 23 80 00 00 00 00 00 ab 1d 80 00 00 00 00 00     .#..............
+  806670:	f1 1d 80 00 00 00 00 00 f1 1d 80 00 00 00 00 00     ................
+  806680:	f1 1d 80 00 00 00 00 00 f1 1d 80 00 00 00 00 00     ................
+  806690:	f1 1d 80 00 00 00 00 00 f1 1d 80 00 00 00 00 00     ................
+  8066a0:	f1 1d 80 00 00 00 00 00 f1 1d 80 00 00 00 00 00     ................
+  8066b0:	f1 1d 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .........#......
+  8066c0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8066d0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8066e0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8066f0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806700:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806710:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806720:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806730:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806740:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806750:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806760:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806770:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806780:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806790:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8067a0:	ef 23 80 00 00 00 00 00 0d 23 80 00 00 00 00 00     .#.......#......
+  8067b0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8067c0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8067d0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8067e0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  8067f0:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806800:	53 1e 80 00 00 00 00 00 22 20 80 00 00 00 00 00     S......." ......
+  806810:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806820:	ef 23 80 00 00 00 00 00 48 1e 80 00 00 00 00 00     .#......H.......
+  806830:	82 1e 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .........#......
+  806840:	ef 23 80 00 00 00 00 00 3d 1e 80 00 00 00 00 00     .#......=.......
+  806850:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806860:	cb 21 80 00 00 00 00 00 9a 22 80 00 00 00 00 00     .!......."......
+  806870:	ef 23 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .#.......#......
+  806880:	19 1f 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     .........#......
+  806890:	f6 20 80 00 00 00 00 00 ef 23 80 00 00 00 00 00     . .......#......
+  8068a0:	ef 23 80 00 00 00 00 00 0d 23 80 00 00 00 00 00     .#.......#......
+  8068b0:	ef 23 80 00 00 00 00 00 a1 1d 80 00 00 00 00 00     .#..............
+
+00000000008068c0 <error_string>:
+	...
+  8068c8:	85 64 80 00 00 00 00 00 97 64 80 00 00 00 00 00     .d.......d......
+  8068d8:	a7 64 80 00 00 00 00 00 b9 64 80 00 00 00 00 00     .d.......d......
+  8068e8:	c7 64 80 00 00 00 00 00 db 64 80 00 00 00 00 00     .d.......d......
+  8068f8:	f0 64 80 00 00 00 00 00 03 65 80 00 00 00 00 00     .d.......e......
+  806908:	15 65 80 00 00 00 00 00 29 65 80 00 00 00 00 00     .e......)e......
+  806918:	39 65 80 00 00 00 00 00 4c 65 80 00 00 00 00 00     9e......Le......
+  806928:	63 65 80 00 00 00 00 00 79 65 80 00 00 00 00 00     ce......ye......
+  806938:	91 65 80 00 00 00 00 00 a9 65 80 00 00 00 00 00     .e.......e......
+  806948:	b6 65 80 00 00 00 00 00 60 69 80 00 00 00 00 00     .e......`i......
+  806958:	ca 65 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .e......file is 
+  806968:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806978:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806988:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806998:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8069a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8069b8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8069c8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8069d8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8069e8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8069f8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806a08:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806a18:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806a28:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806a38:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806a48:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806a58:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806a68:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806a78:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806a88:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806a98:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806aa8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806ab8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806ac0 <devtab>:
+  806ac0:	60 70 80 00 00 00 00 00 a0 70 80 00 00 00 00 00     `p.......p......
+  806ad0:	e0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806ae0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806af0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806b00:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806b10:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806b20:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806b30:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806b40:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806b50:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806b60:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806b70:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806b80:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806b90:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806ba0:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  806bb0:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  806bc0:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  806bd0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806be0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806bf0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806c00:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806c10:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806c20:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806c30:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806c40:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
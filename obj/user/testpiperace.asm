@@ -0,0 +1,10635 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 9e 24 80 00 00 	movabs $0x80249e,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 12 3a 80 00 00 	movabs $0x803a12,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 12 3a 80 00 00 	movabs $0x803a12,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 d1 18 80 00 00 	movabs $0x8018d1,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be 5f 62 80 00 00 	movabs $0x80625f,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 3d 24 80 00 00 	movabs $0x80243d,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 78 5b 80 00 00 	movabs $0x805b78,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 3d 24 80 00 00 	movabs $0x80243d,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 7a 5b 80 00 00 	movabs $0x805b7a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 3d 24 80 00 00 	movabs $0x80243d,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 7d 5b 80 00 00 	movabs $0x805b7d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 3d 24 80 00 00 	movabs $0x80243d,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 e6 51 80 00 00 	movabs $0x8051e6,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 bd 54 80 00 00 	movabs $0x8054bd,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 fc 3a 80 00 00 	movabs $0x803afc,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 c5 3b 80 00 00 	movabs $0x803bc5,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 cb 3a 80 00 00 	movabs $0x803acb,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 cb 3a 80 00 00 	movabs $0x803acb,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 12 3a 80 00 00 	movabs $0x803a12,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb ea 25 80 00 00 	movabs $0x8025ea,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 80 5b 80 00 00 	movabs $0x805b80,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 ea 25 80 00 00 	movabs $0x8025ea,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 1d 26 80 00 00 	movabs $0x80261d,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc ea 25 80 00 00 	movabs $0x8025ea,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 20 5e 80 00 00 	movabs $0x805e20,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf ea 25 80 00 00 	movabs $0x8025ea,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf ea 25 80 00 00 	movabs $0x8025ea,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 42 28 80 00 00 	movabs $0x802842,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 42 28 80 00 00 	movabs $0x802842,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 29 03 00 00       	call   801828 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  801512:	48 bf c2 60 80 00 00 	movabs $0x8060c2,%rdi
+  801519:	00 00 00 
+  80151c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801521:	48 ba 44 1a 80 00 00 	movabs $0x801a44,%rdx
+  801528:	00 00 00 
+  80152b:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  80152d:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  801531:	48 b8 8d 47 80 00 00 	movabs $0x80478d,%rax
+  801538:	00 00 00 
+  80153b:	ff d0                	call   *%rax
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	0f 88 7f 01 00 00    	js     8016c4 <umain+0x1c3>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  801545:	48 b8 3e 31 80 00 00 	movabs $0x80313e,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  801554:	85 c0                	test   %eax,%eax
+  801556:	0f 88 95 01 00 00    	js     8016f1 <umain+0x1f0>
+        panic("fork: %i", r);
+    if (r == 0) {
+  80155c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  801560:	0f 84 b8 01 00 00    	je     80171e <umain+0x21d>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  801566:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  801569:	89 de                	mov    %ebx,%esi
+  80156b:	48 bf 13 61 80 00 00 	movabs $0x806113,%rdi
+  801572:	00 00 00 
+  801575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157a:	49 bc 44 1a 80 00 00 	movabs $0x801a44,%r12
+  801581:	00 00 00 
+  801584:	41 ff d4             	call   *%r12
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  801587:	41 89 dd             	mov    %ebx,%r13d
+  80158a:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  801591:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  801597:	48 69 db 38 02 00 00 	imul   $0x238,%rbx,%rbx
+  80159e:	48 89 de             	mov    %rbx,%rsi
+  8015a1:	48 c1 fe 03          	sar    $0x3,%rsi
+  8015a5:	69 f6 77 a9 27 e3    	imul   $0xe327a977,%esi,%esi
+  8015ab:	48 bf 1e 61 80 00 00 	movabs $0x80611e,%rdi
+  8015b2:	00 00 00 
+  8015b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ba:	41 ff d4             	call   *%r12
+    dup(p[0], 10);
+  8015bd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8015c2:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8015c5:	48 b8 c0 37 80 00 00 	movabs $0x8037c0,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8015d1:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8015d8:	00 00 00 
+  8015db:	48 01 d8             	add    %rbx,%rax
+  8015de:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+  8015e4:	83 f8 02             	cmp    $0x2,%eax
+  8015e7:	75 37                	jne    801620 <umain+0x11f>
+        dup(p[0], 10);
+  8015e9:	49 bc c0 37 80 00 00 	movabs $0x8037c0,%r12
+  8015f0:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  8015f3:	4d 63 ed             	movslq %r13d,%r13
+  8015f6:	4d 69 ed 38 02 00 00 	imul   $0x238,%r13,%r13
+  8015fd:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  801604:	00 00 00 
+  801607:	4c 01 eb             	add    %r13,%rbx
+        dup(p[0], 10);
+  80160a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80160f:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  801612:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  801615:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+  80161b:	83 f8 02             	cmp    $0x2,%eax
+  80161e:	74 ea                	je     80160a <umain+0x109>
+
+    cprintf("child done with loop\n");
+  801620:	48 bf 29 61 80 00 00 	movabs $0x806129,%rdi
+  801627:	00 00 00 
+  80162a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162f:	48 ba 44 1a 80 00 00 	movabs $0x801a44,%rdx
+  801636:	00 00 00 
+  801639:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  80163b:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80163e:	48 b8 99 49 80 00 00 	movabs $0x804999,%rax
+  801645:	00 00 00 
+  801648:	ff d0                	call   *%rax
+  80164a:	85 c0                	test   %eax,%eax
+  80164c:	0f 85 5a 01 00 00    	jne    8017ac <umain+0x2ab>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  801652:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801656:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  801659:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+  801665:	85 c0                	test   %eax,%eax
+  801667:	0f 88 69 01 00 00    	js     8017d6 <umain+0x2d5>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  80166d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  801671:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+  80167d:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  801680:	be 00 10 00 00       	mov    $0x1000,%esi
+  801685:	48 b8 76 2a 80 00 00 	movabs $0x802a76,%rax
+  80168c:	00 00 00 
+  80168f:	ff d0                	call   *%rax
+  801691:	83 f8 04             	cmp    $0x4,%eax
+  801694:	0f 84 69 01 00 00    	je     801803 <umain+0x302>
+        cprintf("\nchild detected race\n");
+  80169a:	48 bf 57 61 80 00 00 	movabs $0x806157,%rdi
+  8016a1:	00 00 00 
+  8016a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a9:	48 ba 44 1a 80 00 00 	movabs $0x801a44,%rdx
+  8016b0:	00 00 00 
+  8016b3:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8016b5:	48 83 c4 28          	add    $0x28,%rsp
+  8016b9:	5b                   	pop    %rbx
+  8016ba:	41 5c                	pop    %r12
+  8016bc:	41 5d                	pop    %r13
+  8016be:	41 5e                	pop    %r14
+  8016c0:	41 5f                	pop    %r15
+  8016c2:	5d                   	pop    %rbp
+  8016c3:	c3                   	ret
+        panic("pipe: %i", r);
+  8016c4:	89 c1                	mov    %eax,%ecx
+  8016c6:	48 ba db 60 80 00 00 	movabs $0x8060db,%rdx
+  8016cd:	00 00 00 
+  8016d0:	be 0c 00 00 00       	mov    $0xc,%esi
+  8016d5:	48 bf e4 60 80 00 00 	movabs $0x8060e4,%rdi
+  8016dc:	00 00 00 
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e4:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  8016eb:	00 00 00 
+  8016ee:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8016f1:	89 c1                	mov    %eax,%ecx
+  8016f3:	48 ba 5c 67 80 00 00 	movabs $0x80675c,%rdx
+  8016fa:	00 00 00 
+  8016fd:	be 0f 00 00 00       	mov    $0xf,%esi
+  801702:	48 bf e4 60 80 00 00 	movabs $0x8060e4,%rdi
+  801709:	00 00 00 
+  80170c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801711:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  801718:	00 00 00 
+  80171b:	41 ff d0             	call   *%r8
+        close(p[1]);
+  80171e:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  801721:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+  80172d:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  801732:	49 bc 99 49 80 00 00 	movabs $0x804999,%r12
+  801739:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  80173c:	49 bf f8 60 80 00 00 	movabs $0x8060f8,%r15
+  801743:	00 00 00 
+  801746:	49 be 44 1a 80 00 00 	movabs $0x801a44,%r14
+  80174d:	00 00 00 
+                exit();
+  801750:	49 bd d1 18 80 00 00 	movabs $0x8018d1,%r13
+  801757:	00 00 00 
+  80175a:	eb 11                	jmp    80176d <umain+0x26c>
+            sys_yield();
+  80175c:	48 b8 3f 2a 80 00 00 	movabs $0x802a3f,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  801768:	83 eb 01             	sub    $0x1,%ebx
+  80176b:	74 1a                	je     801787 <umain+0x286>
+            if (pipeisclosed(p[0])) {
+  80176d:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  801770:	41 ff d4             	call   *%r12
+  801773:	85 c0                	test   %eax,%eax
+  801775:	74 e5                	je     80175c <umain+0x25b>
+                cprintf("RACE: pipe appears closed\n");
+  801777:	4c 89 ff             	mov    %r15,%rdi
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177f:	41 ff d6             	call   *%r14
+                exit();
+  801782:	41 ff d5             	call   *%r13
+  801785:	eb d5                	jmp    80175c <umain+0x25b>
+        ipc_recv(0, 0, 0, 0);
+  801787:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801791:	be 00 00 00 00       	mov    $0x0,%esi
+  801796:	bf 00 00 00 00       	mov    $0x0,%edi
+  80179b:	48 b8 65 33 80 00 00 	movabs $0x803365,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+  8017a7:	e9 ba fd ff ff       	jmp    801566 <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8017ac:	48 ba 70 61 80 00 00 	movabs $0x806170,%rdx
+  8017b3:	00 00 00 
+  8017b6:	be 38 00 00 00       	mov    $0x38,%esi
+  8017bb:	48 bf e4 60 80 00 00 	movabs $0x8060e4,%rdi
+  8017c2:	00 00 00 
+  8017c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ca:	48 b9 f4 18 80 00 00 	movabs $0x8018f4,%rcx
+  8017d1:	00 00 00 
+  8017d4:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8017d6:	89 c1                	mov    %eax,%ecx
+  8017d8:	48 ba 3f 61 80 00 00 	movabs $0x80613f,%rdx
+  8017df:	00 00 00 
+  8017e2:	be 3a 00 00 00       	mov    $0x3a,%esi
+  8017e7:	48 bf e4 60 80 00 00 	movabs $0x8060e4,%rdi
+  8017ee:	00 00 00 
+  8017f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f6:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  8017fd:	00 00 00 
+  801800:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  801803:	be c8 00 00 00       	mov    $0xc8,%esi
+  801808:	48 bf a0 61 80 00 00 	movabs $0x8061a0,%rdi
+  80180f:	00 00 00 
+  801812:	b8 00 00 00 00       	mov    $0x0,%eax
+  801817:	48 ba 44 1a 80 00 00 	movabs $0x801a44,%rdx
+  80181e:	00 00 00 
+  801821:	ff d2                	call   *%rdx
+}
+  801823:	e9 8d fe ff ff       	jmp    8016b5 <umain+0x1b4>
+
+0000000000801828 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	41 56                	push   %r14
+  80182e:	41 55                	push   %r13
+  801830:	41 54                	push   %r12
+  801832:	53                   	push   %rbx
+  801833:	41 89 fd             	mov    %edi,%r13d
+  801836:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801839:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801840:	00 00 00 
+  801843:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  80184a:	00 00 00 
+  80184d:	48 39 c2             	cmp    %rax,%rdx
+  801850:	73 17                	jae    801869 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801852:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801855:	49 89 c4             	mov    %rax,%r12
+  801858:	48 83 c3 08          	add    $0x8,%rbx
+  80185c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801861:	ff 53 f8             	call   *-0x8(%rbx)
+  801864:	4c 39 e3             	cmp    %r12,%rbx
+  801867:	72 ef                	jb     801858 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801869:	48 b8 08 2a 80 00 00 	movabs $0x802a08,%rax
+  801870:	00 00 00 
+  801873:	ff d0                	call   *%rax
+  801875:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80187a:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801881:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801888:	00 00 00 
+  80188b:	48 01 d0             	add    %rdx,%rax
+  80188e:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801895:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801898:	45 85 ed             	test   %r13d,%r13d
+  80189b:	7e 0d                	jle    8018aa <libmain+0x82>
+  80189d:	49 8b 06             	mov    (%r14),%rax
+  8018a0:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018a7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018aa:	4c 89 f6             	mov    %r14,%rsi
+  8018ad:	44 89 ef             	mov    %r13d,%edi
+  8018b0:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8018b7:	00 00 00 
+  8018ba:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018bc:	48 b8 d1 18 80 00 00 	movabs $0x8018d1,%rax
+  8018c3:	00 00 00 
+  8018c6:	ff d0                	call   *%rax
+#endif
+}
+  8018c8:	5b                   	pop    %rbx
+  8018c9:	41 5c                	pop    %r12
+  8018cb:	41 5d                	pop    %r13
+  8018cd:	41 5e                	pop    %r14
+  8018cf:	5d                   	pop    %rbp
+  8018d0:	c3                   	ret
+
+00000000008018d1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8018d1:	55                   	push   %rbp
+  8018d2:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  8018d5:	48 b8 98 37 80 00 00 	movabs $0x803798,%rax
+  8018dc:	00 00 00 
+  8018df:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8018e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e6:	48 b8 97 29 80 00 00 	movabs $0x802997,%rax
+  8018ed:	00 00 00 
+  8018f0:	ff d0                	call   *%rax
+}
+  8018f2:	5d                   	pop    %rbp
+  8018f3:	c3                   	ret
+
+00000000008018f4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8018f4:	55                   	push   %rbp
+  8018f5:	48 89 e5             	mov    %rsp,%rbp
+  8018f8:	41 56                	push   %r14
+  8018fa:	41 55                	push   %r13
+  8018fc:	41 54                	push   %r12
+  8018fe:	53                   	push   %rbx
+  8018ff:	48 83 ec 50          	sub    $0x50,%rsp
+  801903:	49 89 fc             	mov    %rdi,%r12
+  801906:	41 89 f5             	mov    %esi,%r13d
+  801909:	48 89 d3             	mov    %rdx,%rbx
+  80190c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801910:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801914:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801918:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80191f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801923:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801927:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80192b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80192f:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  801936:	00 00 00 
+  801939:	4c 8b 30             	mov    (%rax),%r14
+  80193c:	48 b8 08 2a 80 00 00 	movabs $0x802a08,%rax
+  801943:	00 00 00 
+  801946:	ff d0                	call   *%rax
+  801948:	89 c6                	mov    %eax,%esi
+  80194a:	45 89 e8             	mov    %r13d,%r8d
+  80194d:	4c 89 e1             	mov    %r12,%rcx
+  801950:	4c 89 f2             	mov    %r14,%rdx
+  801953:	48 bf d8 61 80 00 00 	movabs $0x8061d8,%rdi
+  80195a:	00 00 00 
+  80195d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801962:	49 bc 44 1a 80 00 00 	movabs $0x801a44,%r12
+  801969:	00 00 00 
+  80196c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80196f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801973:	48 89 df             	mov    %rbx,%rdi
+  801976:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  80197d:	00 00 00 
+  801980:	ff d0                	call   *%rax
+    cprintf("\n");
+  801982:	48 bf d9 60 80 00 00 	movabs $0x8060d9,%rdi
+  801989:	00 00 00 
+  80198c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801991:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801994:	cc                   	int3
+  801995:	eb fd                	jmp    801994 <_panic+0xa0>
+
+0000000000801997 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801997:	55                   	push   %rbp
+  801998:	48 89 e5             	mov    %rsp,%rbp
+  80199b:	53                   	push   %rbx
+  80199c:	48 83 ec 08          	sub    $0x8,%rsp
+  8019a0:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8019a3:	8b 06                	mov    (%rsi),%eax
+  8019a5:	8d 50 01             	lea    0x1(%rax),%edx
+  8019a8:	89 16                	mov    %edx,(%rsi)
+  8019aa:	48 98                	cltq
+  8019ac:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8019b1:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8019b7:	74 0a                	je     8019c3 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8019b9:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8019bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8019c3:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8019c7:	be ff 00 00 00       	mov    $0xff,%esi
+  8019cc:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  8019d3:	00 00 00 
+  8019d6:	ff d0                	call   *%rax
+        state->offset = 0;
+  8019d8:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8019de:	eb d9                	jmp    8019b9 <putch+0x22>
+
+00000000008019e0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8019eb:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8019ee:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8019f5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ff:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801a02:	48 89 f1             	mov    %rsi,%rcx
+  801a05:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801a0c:	48 bf 97 19 80 00 00 	movabs $0x801997,%rdi
+  801a13:	00 00 00 
+  801a16:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801a1d:	00 00 00 
+  801a20:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801a22:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801a29:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801a30:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801a3c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801a42:	c9                   	leave
+  801a43:	c3                   	ret
+
+0000000000801a44 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801a44:	55                   	push   %rbp
+  801a45:	48 89 e5             	mov    %rsp,%rbp
+  801a48:	48 83 ec 50          	sub    $0x50,%rsp
+  801a4c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801a50:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801a54:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a58:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a5c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801a60:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801a67:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801a6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a6f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a73:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a77:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a7b:	48 b8 e0 19 80 00 00 	movabs $0x8019e0,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+0000000000801a89 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a89:	55                   	push   %rbp
+  801a8a:	48 89 e5             	mov    %rsp,%rbp
+  801a8d:	41 57                	push   %r15
+  801a8f:	41 56                	push   %r14
+  801a91:	41 55                	push   %r13
+  801a93:	41 54                	push   %r12
+  801a95:	53                   	push   %rbx
+  801a96:	48 83 ec 18          	sub    $0x18,%rsp
+  801a9a:	49 89 fc             	mov    %rdi,%r12
+  801a9d:	49 89 f5             	mov    %rsi,%r13
+  801aa0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801aa4:	8b 45 10             	mov    0x10(%rbp),%eax
+  801aa7:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801aaa:	41 89 cf             	mov    %ecx,%r15d
+  801aad:	4c 39 fa             	cmp    %r15,%rdx
+  801ab0:	73 5b                	jae    801b0d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801ab2:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801ab6:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801aba:	85 db                	test   %ebx,%ebx
+  801abc:	7e 0e                	jle    801acc <print_num+0x43>
+            putch(padc, put_arg);
+  801abe:	4c 89 ee             	mov    %r13,%rsi
+  801ac1:	44 89 f7             	mov    %r14d,%edi
+  801ac4:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801ac7:	83 eb 01             	sub    $0x1,%ebx
+  801aca:	75 f2                	jne    801abe <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801acc:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801ad0:	48 b9 0c 62 80 00 00 	movabs $0x80620c,%rcx
+  801ad7:	00 00 00 
+  801ada:	48 b8 fb 61 80 00 00 	movabs $0x8061fb,%rax
+  801ae1:	00 00 00 
+  801ae4:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801ae8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af1:	49 f7 f7             	div    %r15
+  801af4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801af8:	4c 89 ee             	mov    %r13,%rsi
+  801afb:	41 ff d4             	call   *%r12
+}
+  801afe:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b02:	5b                   	pop    %rbx
+  801b03:	41 5c                	pop    %r12
+  801b05:	41 5d                	pop    %r13
+  801b07:	41 5e                	pop    %r14
+  801b09:	41 5f                	pop    %r15
+  801b0b:	5d                   	pop    %rbp
+  801b0c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801b0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b16:	49 f7 f7             	div    %r15
+  801b19:	48 83 ec 08          	sub    $0x8,%rsp
+  801b1d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801b21:	52                   	push   %rdx
+  801b22:	45 0f be c9          	movsbl %r9b,%r9d
+  801b26:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801b2a:	48 89 c2             	mov    %rax,%rdx
+  801b2d:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  801b34:	00 00 00 
+  801b37:	ff d0                	call   *%rax
+  801b39:	48 83 c4 10          	add    $0x10,%rsp
+  801b3d:	eb 8d                	jmp    801acc <print_num+0x43>
+
+0000000000801b3f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801b3f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801b43:	48 8b 06             	mov    (%rsi),%rax
+  801b46:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801b4a:	73 0a                	jae    801b56 <sprintputch+0x17>
+        *state->start++ = ch;
+  801b4c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b50:	48 89 16             	mov    %rdx,(%rsi)
+  801b53:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801b56:	c3                   	ret
+
+0000000000801b57 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801b57:	55                   	push   %rbp
+  801b58:	48 89 e5             	mov    %rsp,%rbp
+  801b5b:	48 83 ec 50          	sub    $0x50,%rsp
+  801b5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801b63:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801b67:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801b6b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b7a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b7e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b82:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b86:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  801b8d:	00 00 00 
+  801b90:	ff d0                	call   *%rax
+}
+  801b92:	c9                   	leave
+  801b93:	c3                   	ret
+
+0000000000801b94 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b94:	55                   	push   %rbp
+  801b95:	48 89 e5             	mov    %rsp,%rbp
+  801b98:	41 57                	push   %r15
+  801b9a:	41 56                	push   %r14
+  801b9c:	41 55                	push   %r13
+  801b9e:	41 54                	push   %r12
+  801ba0:	53                   	push   %rbx
+  801ba1:	48 83 ec 38          	sub    $0x38,%rsp
+  801ba5:	49 89 fe             	mov    %rdi,%r14
+  801ba8:	49 89 f5             	mov    %rsi,%r13
+  801bab:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801bae:	48 8b 01             	mov    (%rcx),%rax
+  801bb1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801bb5:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801bb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbd:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801bc1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801bc5:	eb 0d                	jmp    801bd4 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801bc7:	40 0f b6 ff          	movzbl %dil,%edi
+  801bcb:	4c 89 ee             	mov    %r13,%rsi
+  801bce:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801bd1:	4c 89 e3             	mov    %r12,%rbx
+  801bd4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801bd8:	0f b6 3b             	movzbl (%rbx),%edi
+  801bdb:	40 80 ff 25          	cmp    $0x25,%dil
+  801bdf:	74 14                	je     801bf5 <vprintfmt+0x61>
+            if (!ch) return;
+  801be1:	40 84 ff             	test   %dil,%dil
+  801be4:	75 e1                	jne    801bc7 <vprintfmt+0x33>
+}
+  801be6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801bea:	5b                   	pop    %rbx
+  801beb:	41 5c                	pop    %r12
+  801bed:	41 5d                	pop    %r13
+  801bef:	41 5e                	pop    %r14
+  801bf1:	41 5f                	pop    %r15
+  801bf3:	5d                   	pop    %rbp
+  801bf4:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801bf5:	be 00 00 00 00       	mov    $0x0,%esi
+  801bfa:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801c03:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c09:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801c10:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c14:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801c19:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801c1e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801c21:	83 e8 23             	sub    $0x23,%eax
+  801c24:	3c 57                	cmp    $0x57,%al
+  801c26:	0f 87 67 06 00 00    	ja     802293 <vprintfmt+0x6ff>
+  801c2c:	0f b6 c0             	movzbl %al,%eax
+  801c2f:	48 b9 a0 63 80 00 00 	movabs $0x8063a0,%rcx
+  801c36:	00 00 00 
+  801c39:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801c3c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801c3f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801c43:	eb cf                	jmp    801c14 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801c45:	49 89 dc             	mov    %rbx,%r12
+  801c48:	be 01 00 00 00       	mov    $0x1,%esi
+  801c4d:	eb c5                	jmp    801c14 <vprintfmt+0x80>
+            padc = ch;
+  801c4f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801c53:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801c56:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c59:	eb b9                	jmp    801c14 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  801c61:	77 24                	ja     801c87 <vprintfmt+0xf3>
+  801c63:	89 c1                	mov    %eax,%ecx
+  801c65:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801c69:	83 c0 08             	add    $0x8,%eax
+  801c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c6f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c72:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c75:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c79:	79 99                	jns    801c14 <vprintfmt+0x80>
+                width = precision;
+  801c7b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c7f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c85:	eb 8d                	jmp    801c14 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c87:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c8b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c93:	eb da                	jmp    801c6f <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c95:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c9a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c9e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801ca4:	3c 39                	cmp    $0x39,%al
+  801ca6:	77 1c                	ja     801cc4 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801ca8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801cac:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801cb0:	0f b6 c0             	movzbl %al,%eax
+  801cb3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801cb8:	0f b6 03             	movzbl (%rbx),%eax
+  801cbb:	3c 39                	cmp    $0x39,%al
+  801cbd:	76 e9                	jbe    801ca8 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801cbf:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801cc2:	eb b1                	jmp    801c75 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801cc4:	49 89 dc             	mov    %rbx,%r12
+  801cc7:	eb ac                	jmp    801c75 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801cc9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801ccc:	85 c9                	test   %ecx,%ecx
+  801cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd3:	0f 49 c1             	cmovns %ecx,%eax
+  801cd6:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801cd9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cdc:	e9 33 ff ff ff       	jmp    801c14 <vprintfmt+0x80>
+            lflag++;
+  801ce1:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801ce4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801ce7:	e9 28 ff ff ff       	jmp    801c14 <vprintfmt+0x80>
+            lflag--;
+  801cec:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801cef:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801cf2:	e9 1d ff ff ff       	jmp    801c14 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801cf7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cfa:	83 f8 2f             	cmp    $0x2f,%eax
+  801cfd:	77 19                	ja     801d18 <vprintfmt+0x184>
+  801cff:	89 c2                	mov    %eax,%edx
+  801d01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d05:	83 c0 08             	add    $0x8,%eax
+  801d08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d0b:	8b 3a                	mov    (%rdx),%edi
+  801d0d:	4c 89 ee             	mov    %r13,%rsi
+  801d10:	41 ff d6             	call   *%r14
+            break;
+  801d13:	e9 bc fe ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801d18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d24:	eb e5                	jmp    801d0b <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801d26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d29:	83 f8 2f             	cmp    $0x2f,%eax
+  801d2c:	77 5a                	ja     801d88 <vprintfmt+0x1f4>
+  801d2e:	89 c2                	mov    %eax,%edx
+  801d30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d34:	83 c0 08             	add    $0x8,%eax
+  801d37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801d3a:	8b 02                	mov    (%rdx),%eax
+  801d3c:	89 c1                	mov    %eax,%ecx
+  801d3e:	f7 d9                	neg    %ecx
+  801d40:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801d43:	83 f9 13             	cmp    $0x13,%ecx
+  801d46:	7f 4e                	jg     801d96 <vprintfmt+0x202>
+  801d48:	48 63 c1             	movslq %ecx,%rax
+  801d4b:	48 ba 60 66 80 00 00 	movabs $0x806660,%rdx
+  801d52:	00 00 00 
+  801d55:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801d59:	48 85 c0             	test   %rax,%rax
+  801d5c:	74 38                	je     801d96 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801d5e:	48 89 c1             	mov    %rax,%rcx
+  801d61:	48 ba c8 68 80 00 00 	movabs $0x8068c8,%rdx
+  801d68:	00 00 00 
+  801d6b:	4c 89 ee             	mov    %r13,%rsi
+  801d6e:	4c 89 f7             	mov    %r14,%rdi
+  801d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d76:	49 b8 57 1b 80 00 00 	movabs $0x801b57,%r8
+  801d7d:	00 00 00 
+  801d80:	41 ff d0             	call   *%r8
+  801d83:	e9 4c fe ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d94:	eb a4                	jmp    801d3a <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d96:	48 ba 24 62 80 00 00 	movabs $0x806224,%rdx
+  801d9d:	00 00 00 
+  801da0:	4c 89 ee             	mov    %r13,%rsi
+  801da3:	4c 89 f7             	mov    %r14,%rdi
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	49 b8 57 1b 80 00 00 	movabs $0x801b57,%r8
+  801db2:	00 00 00 
+  801db5:	41 ff d0             	call   *%r8
+  801db8:	e9 17 fe ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dc0:	83 f8 2f             	cmp    $0x2f,%eax
+  801dc3:	77 6c                	ja     801e31 <vprintfmt+0x29d>
+  801dc5:	89 c2                	mov    %eax,%edx
+  801dc7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dcb:	83 c0 08             	add    $0x8,%eax
+  801dce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801dd1:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801dd4:	48 85 f6             	test   %rsi,%rsi
+  801dd7:	48 b8 1d 62 80 00 00 	movabs $0x80621d,%rax
+  801dde:	00 00 00 
+  801de1:	48 0f 45 c6          	cmovne %rsi,%rax
+  801de5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801de9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ded:	7e 06                	jle    801df5 <vprintfmt+0x261>
+  801def:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801df3:	75 4a                	jne    801e3f <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801df5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801df9:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801dfd:	0f b6 00             	movzbl (%rax),%eax
+  801e00:	84 c0                	test   %al,%al
+  801e02:	0f 85 9a 00 00 00    	jne    801ea2 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801e08:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e0b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801e0f:	85 c0                	test   %eax,%eax
+  801e11:	0f 8e bd fd ff ff    	jle    801bd4 <vprintfmt+0x40>
+  801e17:	4c 89 ee             	mov    %r13,%rsi
+  801e1a:	bf 20 00 00 00       	mov    $0x20,%edi
+  801e1f:	41 ff d6             	call   *%r14
+  801e22:	41 83 ec 01          	sub    $0x1,%r12d
+  801e26:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801e2a:	75 eb                	jne    801e17 <vprintfmt+0x283>
+  801e2c:	e9 a3 fd ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801e31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e3d:	eb 92                	jmp    801dd1 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801e3f:	49 63 f7             	movslq %r15d,%rsi
+  801e42:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801e46:	48 b8 58 23 80 00 00 	movabs $0x802358,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+  801e52:	48 89 c2             	mov    %rax,%rdx
+  801e55:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e58:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801e5a:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801e5d:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	7e 91                	jle    801df5 <vprintfmt+0x261>
+  801e64:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801e69:	4c 89 ee             	mov    %r13,%rsi
+  801e6c:	44 89 e7             	mov    %r12d,%edi
+  801e6f:	41 ff d6             	call   *%r14
+  801e72:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e76:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e79:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e7c:	75 eb                	jne    801e69 <vprintfmt+0x2d5>
+  801e7e:	e9 72 ff ff ff       	jmp    801df5 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e83:	0f b6 f8             	movzbl %al,%edi
+  801e86:	4c 89 ee             	mov    %r13,%rsi
+  801e89:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e8c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e90:	49 83 c4 01          	add    $0x1,%r12
+  801e94:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e9a:	84 c0                	test   %al,%al
+  801e9c:	0f 84 66 ff ff ff    	je     801e08 <vprintfmt+0x274>
+  801ea2:	45 85 ff             	test   %r15d,%r15d
+  801ea5:	78 0a                	js     801eb1 <vprintfmt+0x31d>
+  801ea7:	41 83 ef 01          	sub    $0x1,%r15d
+  801eab:	0f 88 57 ff ff ff    	js     801e08 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801eb1:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801eb5:	74 cc                	je     801e83 <vprintfmt+0x2ef>
+  801eb7:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801eba:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801ebf:	80 fa 5e             	cmp    $0x5e,%dl
+  801ec2:	77 c2                	ja     801e86 <vprintfmt+0x2f2>
+  801ec4:	eb bd                	jmp    801e83 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec6:	40 84 f6             	test   %sil,%sil
+  801ec9:	75 26                	jne    801ef1 <vprintfmt+0x35d>
+    switch (lflag) {
+  801ecb:	85 d2                	test   %edx,%edx
+  801ecd:	74 59                	je     801f28 <vprintfmt+0x394>
+  801ecf:	83 fa 01             	cmp    $0x1,%edx
+  801ed2:	74 7b                	je     801f4f <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801ed4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed7:	83 f8 2f             	cmp    $0x2f,%eax
+  801eda:	0f 87 96 00 00 00    	ja     801f76 <vprintfmt+0x3e2>
+  801ee0:	89 c2                	mov    %eax,%edx
+  801ee2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee6:	83 c0 08             	add    $0x8,%eax
+  801ee9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eec:	4c 8b 22             	mov    (%rdx),%r12
+  801eef:	eb 17                	jmp    801f08 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801ef1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ef4:	83 f8 2f             	cmp    $0x2f,%eax
+  801ef7:	77 21                	ja     801f1a <vprintfmt+0x386>
+  801ef9:	89 c2                	mov    %eax,%edx
+  801efb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801eff:	83 c0 08             	add    $0x8,%eax
+  801f02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f05:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801f08:	4d 85 e4             	test   %r12,%r12
+  801f0b:	78 7a                	js     801f87 <vprintfmt+0x3f3>
+            num = i;
+  801f0d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801f10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801f15:	e9 56 02 00 00       	jmp    802170 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f26:	eb dd                	jmp    801f05 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801f28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f2b:	83 f8 2f             	cmp    $0x2f,%eax
+  801f2e:	77 11                	ja     801f41 <vprintfmt+0x3ad>
+  801f30:	89 c2                	mov    %eax,%edx
+  801f32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f36:	83 c0 08             	add    $0x8,%eax
+  801f39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f3c:	4c 63 22             	movslq (%rdx),%r12
+  801f3f:	eb c7                	jmp    801f08 <vprintfmt+0x374>
+  801f41:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f45:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f4d:	eb ed                	jmp    801f3c <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801f4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f52:	83 f8 2f             	cmp    $0x2f,%eax
+  801f55:	77 11                	ja     801f68 <vprintfmt+0x3d4>
+  801f57:	89 c2                	mov    %eax,%edx
+  801f59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5d:	83 c0 08             	add    $0x8,%eax
+  801f60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f63:	4c 8b 22             	mov    (%rdx),%r12
+  801f66:	eb a0                	jmp    801f08 <vprintfmt+0x374>
+  801f68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f74:	eb ed                	jmp    801f63 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f82:	e9 65 ff ff ff       	jmp    801eec <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f87:	4c 89 ee             	mov    %r13,%rsi
+  801f8a:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f8f:	41 ff d6             	call   *%r14
+                i = -i;
+  801f92:	49 f7 dc             	neg    %r12
+  801f95:	e9 73 ff ff ff       	jmp    801f0d <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f9a:	40 84 f6             	test   %sil,%sil
+  801f9d:	75 2e                	jne    801fcd <vprintfmt+0x439>
+    switch (lflag) {
+  801f9f:	85 d2                	test   %edx,%edx
+  801fa1:	7f 59                	jg     801ffc <vprintfmt+0x468>
+  801fa3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fa6:	7d 7a                	jge    802022 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801fa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fab:	83 f8 2f             	cmp    $0x2f,%eax
+  801fae:	0f 87 aa 00 00 00    	ja     80205e <vprintfmt+0x4ca>
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fba:	83 c0 08             	add    $0x8,%eax
+  801fbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fc3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fc8:	e9 a3 01 00 00       	jmp    802170 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd0:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd3:	77 19                	ja     801fee <vprintfmt+0x45a>
+  801fd5:	89 c2                	mov    %eax,%edx
+  801fd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fdb:	83 c0 08             	add    $0x8,%eax
+  801fde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fe4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fe9:	e9 82 01 00 00       	jmp    802170 <vprintfmt+0x5dc>
+  801fee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ff2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ffa:	eb e5                	jmp    801fe1 <vprintfmt+0x44d>
+    switch (lflag) {
+  801ffc:	83 fa 01             	cmp    $0x1,%edx
+  801fff:	75 a7                	jne    801fa8 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  802001:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802004:	83 f8 2f             	cmp    $0x2f,%eax
+  802007:	77 47                	ja     802050 <vprintfmt+0x4bc>
+  802009:	89 c2                	mov    %eax,%edx
+  80200b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80200f:	83 c0 08             	add    $0x8,%eax
+  802012:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802015:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802018:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80201d:	e9 4e 01 00 00       	jmp    802170 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802022:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802025:	83 f8 2f             	cmp    $0x2f,%eax
+  802028:	77 18                	ja     802042 <vprintfmt+0x4ae>
+  80202a:	89 c2                	mov    %eax,%edx
+  80202c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802030:	83 c0 08             	add    $0x8,%eax
+  802033:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802036:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802038:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80203d:	e9 2e 01 00 00       	jmp    802170 <vprintfmt+0x5dc>
+  802042:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802046:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80204a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80204e:	eb e6                	jmp    802036 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  802050:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802054:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802058:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205c:	eb b7                	jmp    802015 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  80205e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802062:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802066:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80206a:	e9 51 ff ff ff       	jmp    801fc0 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  80206f:	40 84 f6             	test   %sil,%sil
+  802072:	75 2e                	jne    8020a2 <vprintfmt+0x50e>
+    switch (lflag) {
+  802074:	85 d2                	test   %edx,%edx
+  802076:	7f 59                	jg     8020d1 <vprintfmt+0x53d>
+  802078:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80207b:	7d 77                	jge    8020f4 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  80207d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802080:	83 f8 2f             	cmp    $0x2f,%eax
+  802083:	0f 87 a4 00 00 00    	ja     80212d <vprintfmt+0x599>
+  802089:	89 c2                	mov    %eax,%edx
+  80208b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80208f:	83 c0 08             	add    $0x8,%eax
+  802092:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802095:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802098:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80209d:	e9 ce 00 00 00       	jmp    802170 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8020a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8020a8:	77 19                	ja     8020c3 <vprintfmt+0x52f>
+  8020aa:	89 c2                	mov    %eax,%edx
+  8020ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020b0:	83 c0 08             	add    $0x8,%eax
+  8020b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020b9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8020be:	e9 ad 00 00 00       	jmp    802170 <vprintfmt+0x5dc>
+  8020c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020cf:	eb e5                	jmp    8020b6 <vprintfmt+0x522>
+    switch (lflag) {
+  8020d1:	83 fa 01             	cmp    $0x1,%edx
+  8020d4:	75 a7                	jne    80207d <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  8020d6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020d9:	83 f8 2f             	cmp    $0x2f,%eax
+  8020dc:	77 41                	ja     80211f <vprintfmt+0x58b>
+  8020de:	89 c2                	mov    %eax,%edx
+  8020e0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020e4:	83 c0 08             	add    $0x8,%eax
+  8020e7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020ea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8020ed:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8020f2:	eb 7c                	jmp    802170 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8020f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8020fa:	77 15                	ja     802111 <vprintfmt+0x57d>
+  8020fc:	89 c2                	mov    %eax,%edx
+  8020fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802102:	83 c0 08             	add    $0x8,%eax
+  802105:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802108:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80210a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80210f:	eb 5f                	jmp    802170 <vprintfmt+0x5dc>
+  802111:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802115:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802119:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80211d:	eb e9                	jmp    802108 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80211f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802123:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802127:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80212b:	eb bd                	jmp    8020ea <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80212d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802131:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802135:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802139:	e9 57 ff ff ff       	jmp    802095 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80213e:	4c 89 ee             	mov    %r13,%rsi
+  802141:	bf 30 00 00 00       	mov    $0x30,%edi
+  802146:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802149:	4c 89 ee             	mov    %r13,%rsi
+  80214c:	bf 78 00 00 00       	mov    $0x78,%edi
+  802151:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  802154:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802157:	83 f8 2f             	cmp    $0x2f,%eax
+  80215a:	77 47                	ja     8021a3 <vprintfmt+0x60f>
+  80215c:	89 c2                	mov    %eax,%edx
+  80215e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802162:	83 c0 08             	add    $0x8,%eax
+  802165:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802168:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80216b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802170:	48 83 ec 08          	sub    $0x8,%rsp
+  802174:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802178:	0f 94 c0             	sete   %al
+  80217b:	0f b6 c0             	movzbl %al,%eax
+  80217e:	50                   	push   %rax
+  80217f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802184:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802188:	4c 89 ee             	mov    %r13,%rsi
+  80218b:	4c 89 f7             	mov    %r14,%rdi
+  80218e:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+            break;
+  80219a:	48 83 c4 10          	add    $0x10,%rsp
+  80219e:	e9 31 fa ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8021a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021af:	eb b7                	jmp    802168 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8021b1:	40 84 f6             	test   %sil,%sil
+  8021b4:	75 2b                	jne    8021e1 <vprintfmt+0x64d>
+    switch (lflag) {
+  8021b6:	85 d2                	test   %edx,%edx
+  8021b8:	7f 56                	jg     802210 <vprintfmt+0x67c>
+  8021ba:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8021bd:	7d 77                	jge    802236 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8021bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c5:	0f 87 a7 00 00 00    	ja     802272 <vprintfmt+0x6de>
+  8021cb:	89 c2                	mov    %eax,%edx
+  8021cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d1:	83 c0 08             	add    $0x8,%eax
+  8021d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021da:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8021df:	eb 8f                	jmp    802170 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8021e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8021e7:	77 19                	ja     802202 <vprintfmt+0x66e>
+  8021e9:	89 c2                	mov    %eax,%edx
+  8021eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021ef:	83 c0 08             	add    $0x8,%eax
+  8021f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021f5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021f8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8021fd:	e9 6e ff ff ff       	jmp    802170 <vprintfmt+0x5dc>
+  802202:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802206:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80220e:	eb e5                	jmp    8021f5 <vprintfmt+0x661>
+    switch (lflag) {
+  802210:	83 fa 01             	cmp    $0x1,%edx
+  802213:	75 aa                	jne    8021bf <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802215:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802218:	83 f8 2f             	cmp    $0x2f,%eax
+  80221b:	77 47                	ja     802264 <vprintfmt+0x6d0>
+  80221d:	89 c2                	mov    %eax,%edx
+  80221f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802223:	83 c0 08             	add    $0x8,%eax
+  802226:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802229:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80222c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  802231:	e9 3a ff ff ff       	jmp    802170 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802236:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802239:	83 f8 2f             	cmp    $0x2f,%eax
+  80223c:	77 18                	ja     802256 <vprintfmt+0x6c2>
+  80223e:	89 c2                	mov    %eax,%edx
+  802240:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802244:	83 c0 08             	add    $0x8,%eax
+  802247:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80224a:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80224c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  802251:	e9 1a ff ff ff       	jmp    802170 <vprintfmt+0x5dc>
+  802256:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80225a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80225e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802262:	eb e6                	jmp    80224a <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  802264:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802268:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80226c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802270:	eb b7                	jmp    802229 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802272:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802276:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80227a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80227e:	e9 54 ff ff ff       	jmp    8021d7 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802283:	4c 89 ee             	mov    %r13,%rsi
+  802286:	bf 25 00 00 00       	mov    $0x25,%edi
+  80228b:	41 ff d6             	call   *%r14
+            break;
+  80228e:	e9 41 f9 ff ff       	jmp    801bd4 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802293:	4c 89 ee             	mov    %r13,%rsi
+  802296:	bf 25 00 00 00       	mov    $0x25,%edi
+  80229b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80229e:	48 83 eb 01          	sub    $0x1,%rbx
+  8022a2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8022a6:	75 f6                	jne    80229e <vprintfmt+0x70a>
+  8022a8:	e9 27 f9 ff ff       	jmp    801bd4 <vprintfmt+0x40>
+
+00000000008022ad <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8022ad:	55                   	push   %rbp
+  8022ae:	48 89 e5             	mov    %rsp,%rbp
+  8022b1:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8022b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8022b9:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8022be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8022c2:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8022c9:	48 85 ff             	test   %rdi,%rdi
+  8022cc:	74 2b                	je     8022f9 <vsnprintf+0x4c>
+  8022ce:	48 85 f6             	test   %rsi,%rsi
+  8022d1:	74 26                	je     8022f9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8022d3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8022d7:	48 bf 3f 1b 80 00 00 	movabs $0x801b3f,%rdi
+  8022de:	00 00 00 
+  8022e1:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  8022e8:	00 00 00 
+  8022eb:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8022ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022f1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8022f4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8022f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fe:	eb f7                	jmp    8022f7 <vsnprintf+0x4a>
+
+0000000000802300 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802300:	55                   	push   %rbp
+  802301:	48 89 e5             	mov    %rsp,%rbp
+  802304:	48 83 ec 50          	sub    $0x50,%rsp
+  802308:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80230c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  802310:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802314:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80231b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80231f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802323:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802327:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80232b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80232f:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80233b:	c9                   	leave
+  80233c:	c3                   	ret
+
+000000000080233d <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80233d:	80 3f 00             	cmpb   $0x0,(%rdi)
+  802340:	74 10                	je     802352 <strlen+0x15>
+    size_t n = 0;
+  802342:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802347:	48 83 c0 01          	add    $0x1,%rax
+  80234b:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80234f:	75 f6                	jne    802347 <strlen+0xa>
+  802351:	c3                   	ret
+    size_t n = 0;
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802357:	c3                   	ret
+
+0000000000802358 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802358:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80235b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  802360:	48 85 f6             	test   %rsi,%rsi
+  802363:	74 11                	je     802376 <strnlen+0x1e>
+  802365:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802369:	74 0c                	je     802377 <strnlen+0x1f>
+  80236b:	48 83 c2 01          	add    $0x1,%rdx
+  80236f:	48 39 d0             	cmp    %rdx,%rax
+  802372:	75 f1                	jne    802365 <strnlen+0xd>
+  802374:	eb 04                	jmp    80237a <strnlen+0x22>
+  802376:	c3                   	ret
+  802377:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80237a:	c3                   	ret
+
+000000000080237b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80237b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80237e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802383:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802387:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80238a:	48 83 c2 01          	add    $0x1,%rdx
+  80238e:	84 c9                	test   %cl,%cl
+  802390:	75 f1                	jne    802383 <strcpy+0x8>
+        ;
+    return res;
+}
+  802392:	c3                   	ret
+
+0000000000802393 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802393:	55                   	push   %rbp
+  802394:	48 89 e5             	mov    %rsp,%rbp
+  802397:	41 54                	push   %r12
+  802399:	53                   	push   %rbx
+  80239a:	48 89 fb             	mov    %rdi,%rbx
+  80239d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8023a0:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  8023a7:	00 00 00 
+  8023aa:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8023ac:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8023b0:	4c 89 e6             	mov    %r12,%rsi
+  8023b3:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  8023ba:	00 00 00 
+  8023bd:	ff d0                	call   *%rax
+    return dst;
+}
+  8023bf:	48 89 d8             	mov    %rbx,%rax
+  8023c2:	5b                   	pop    %rbx
+  8023c3:	41 5c                	pop    %r12
+  8023c5:	5d                   	pop    %rbp
+  8023c6:	c3                   	ret
+
+00000000008023c7 <toupper>:
+
+int
+toupper(int ch) {
+  8023c7:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8023c9:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8023cc:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8023cf:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023d2:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023d5:	c3                   	ret
+
+00000000008023d6 <tolower>:
+
+int
+tolower(int ch) {
+  8023d6:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8023d8:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8023db:	8d 57 20             	lea    0x20(%rdi),%edx
+  8023de:	83 f9 1a             	cmp    $0x1a,%ecx
+  8023e1:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8023e4:	c3                   	ret
+
+00000000008023e5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8023e5:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8023e8:	48 85 d2             	test   %rdx,%rdx
+  8023eb:	74 1f                	je     80240c <strncpy+0x27>
+  8023ed:	48 01 fa             	add    %rdi,%rdx
+  8023f0:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8023f3:	48 83 c1 01          	add    $0x1,%rcx
+  8023f7:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8023fb:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8023ff:	41 80 f8 01          	cmp    $0x1,%r8b
+  802403:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802407:	48 39 ca             	cmp    %rcx,%rdx
+  80240a:	75 e7                	jne    8023f3 <strncpy+0xe>
+    }
+    return ret;
+}
+  80240c:	c3                   	ret
+
+000000000080240d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80240d:	48 89 f8             	mov    %rdi,%rax
+  802410:	48 85 d2             	test   %rdx,%rdx
+  802413:	74 24                	je     802439 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802415:	48 83 ea 01          	sub    $0x1,%rdx
+  802419:	74 1b                	je     802436 <strlcpy+0x29>
+  80241b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80241f:	0f b6 16             	movzbl (%rsi),%edx
+  802422:	84 d2                	test   %dl,%dl
+  802424:	74 10                	je     802436 <strlcpy+0x29>
+            *dst++ = *src++;
+  802426:	48 83 c6 01          	add    $0x1,%rsi
+  80242a:	48 83 c0 01          	add    $0x1,%rax
+  80242e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  802431:	48 39 c8             	cmp    %rcx,%rax
+  802434:	75 e9                	jne    80241f <strlcpy+0x12>
+        *dst = '\0';
+  802436:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802439:	48 29 f8             	sub    %rdi,%rax
+}
+  80243c:	c3                   	ret
+
+000000000080243d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80243d:	0f b6 07             	movzbl (%rdi),%eax
+  802440:	84 c0                	test   %al,%al
+  802442:	74 13                	je     802457 <strcmp+0x1a>
+  802444:	38 06                	cmp    %al,(%rsi)
+  802446:	75 0f                	jne    802457 <strcmp+0x1a>
+  802448:	48 83 c7 01          	add    $0x1,%rdi
+  80244c:	48 83 c6 01          	add    $0x1,%rsi
+  802450:	0f b6 07             	movzbl (%rdi),%eax
+  802453:	84 c0                	test   %al,%al
+  802455:	75 ed                	jne    802444 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802457:	0f b6 c0             	movzbl %al,%eax
+  80245a:	0f b6 16             	movzbl (%rsi),%edx
+  80245d:	29 d0                	sub    %edx,%eax
+}
+  80245f:	c3                   	ret
+
+0000000000802460 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  802460:	48 85 d2             	test   %rdx,%rdx
+  802463:	74 1f                	je     802484 <strncmp+0x24>
+  802465:	0f b6 07             	movzbl (%rdi),%eax
+  802468:	84 c0                	test   %al,%al
+  80246a:	74 1e                	je     80248a <strncmp+0x2a>
+  80246c:	3a 06                	cmp    (%rsi),%al
+  80246e:	75 1a                	jne    80248a <strncmp+0x2a>
+  802470:	48 83 c7 01          	add    $0x1,%rdi
+  802474:	48 83 c6 01          	add    $0x1,%rsi
+  802478:	48 83 ea 01          	sub    $0x1,%rdx
+  80247c:	75 e7                	jne    802465 <strncmp+0x5>
+
+    if (!n) return 0;
+  80247e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802483:	c3                   	ret
+  802484:	b8 00 00 00 00       	mov    $0x0,%eax
+  802489:	c3                   	ret
+  80248a:	48 85 d2             	test   %rdx,%rdx
+  80248d:	74 09                	je     802498 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80248f:	0f b6 07             	movzbl (%rdi),%eax
+  802492:	0f b6 16             	movzbl (%rsi),%edx
+  802495:	29 d0                	sub    %edx,%eax
+  802497:	c3                   	ret
+    if (!n) return 0;
+  802498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80249d:	c3                   	ret
+
+000000000080249e <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80249e:	0f b6 17             	movzbl (%rdi),%edx
+  8024a1:	84 d2                	test   %dl,%dl
+  8024a3:	74 18                	je     8024bd <strchr+0x1f>
+        if (*str == c) {
+  8024a5:	0f be d2             	movsbl %dl,%edx
+  8024a8:	39 f2                	cmp    %esi,%edx
+  8024aa:	74 17                	je     8024c3 <strchr+0x25>
+    for (; *str; str++) {
+  8024ac:	48 83 c7 01          	add    $0x1,%rdi
+  8024b0:	0f b6 17             	movzbl (%rdi),%edx
+  8024b3:	84 d2                	test   %dl,%dl
+  8024b5:	75 ee                	jne    8024a5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8024b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024bc:	c3                   	ret
+  8024bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c2:	c3                   	ret
+  8024c3:	48 89 f8             	mov    %rdi,%rax
+}
+  8024c6:	c3                   	ret
+
+00000000008024c7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8024c7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8024ca:	0f b6 17             	movzbl (%rdi),%edx
+  8024cd:	84 d2                	test   %dl,%dl
+  8024cf:	74 13                	je     8024e4 <strfind+0x1d>
+  8024d1:	0f be d2             	movsbl %dl,%edx
+  8024d4:	39 f2                	cmp    %esi,%edx
+  8024d6:	74 0b                	je     8024e3 <strfind+0x1c>
+  8024d8:	48 83 c0 01          	add    $0x1,%rax
+  8024dc:	0f b6 10             	movzbl (%rax),%edx
+  8024df:	84 d2                	test   %dl,%dl
+  8024e1:	75 ee                	jne    8024d1 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8024e3:	c3                   	ret
+  8024e4:	c3                   	ret
+
+00000000008024e5 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024e5:	48 39 f7             	cmp    %rsi,%rdi
+  8024e8:	74 65                	je     80254f <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8024ea:	55                   	push   %rbp
+  8024eb:	48 89 e5             	mov    %rsp,%rbp
+  8024ee:	41 57                	push   %r15
+  8024f0:	41 56                	push   %r14
+  8024f2:	41 55                	push   %r13
+  8024f4:	41 54                	push   %r12
+  8024f6:	53                   	push   %rbx
+  8024f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8024fb:	48 89 fb             	mov    %rdi,%rbx
+  8024fe:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802501:	49 bf d6 23 80 00 00 	movabs $0x8023d6,%r15
+  802508:	00 00 00 
+  80250b:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80250f:	41 0f b6 fd          	movzbl %r13b,%edi
+  802513:	41 ff d7             	call   *%r15
+  802516:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802519:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80251e:	41 0f b6 fe          	movzbl %r14b,%edi
+  802522:	41 ff d7             	call   *%r15
+  802525:	89 c2                	mov    %eax,%edx
+  802527:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80252a:	29 d0                	sub    %edx,%eax
+  80252c:	75 12                	jne    802540 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80252e:	48 83 c3 01          	add    $0x1,%rbx
+  802532:	45 84 ed             	test   %r13b,%r13b
+  802535:	74 09                	je     802540 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802537:	49 83 c4 01          	add    $0x1,%r12
+  80253b:	45 84 f6             	test   %r14b,%r14b
+  80253e:	75 cb                	jne    80250b <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  802540:	48 83 c4 18          	add    $0x18,%rsp
+  802544:	5b                   	pop    %rbx
+  802545:	41 5c                	pop    %r12
+  802547:	41 5d                	pop    %r13
+  802549:	41 5e                	pop    %r14
+  80254b:	41 5f                	pop    %r15
+  80254d:	5d                   	pop    %rbp
+  80254e:	c3                   	ret
+    if (p1 == p2) return 0;
+  80254f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802554:	c3                   	ret
+
+0000000000802555 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802555:	48 39 f7             	cmp    %rsi,%rdi
+  802558:	74 7d                	je     8025d7 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  80255a:	55                   	push   %rbp
+  80255b:	48 89 e5             	mov    %rsp,%rbp
+  80255e:	41 57                	push   %r15
+  802560:	41 56                	push   %r14
+  802562:	41 55                	push   %r13
+  802564:	41 54                	push   %r12
+  802566:	53                   	push   %rbx
+  802567:	48 83 ec 18          	sub    $0x18,%rsp
+  80256b:	48 89 fb             	mov    %rdi,%rbx
+  80256e:	49 89 f4             	mov    %rsi,%r12
+  802571:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802575:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802579:	49 bf d6 23 80 00 00 	movabs $0x8023d6,%r15
+  802580:	00 00 00 
+    while (n--) {
+  802583:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802587:	48 39 c3             	cmp    %rax,%rbx
+  80258a:	74 37                	je     8025c3 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80258c:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802590:	41 0f b6 fd          	movzbl %r13b,%edi
+  802594:	41 ff d7             	call   *%r15
+  802597:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80259a:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80259f:	41 0f b6 fe          	movzbl %r14b,%edi
+  8025a3:	41 ff d7             	call   *%r15
+  8025a6:	89 c2                	mov    %eax,%edx
+  8025a8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8025ab:	29 d0                	sub    %edx,%eax
+  8025ad:	75 19                	jne    8025c8 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8025af:	48 83 c3 01          	add    $0x1,%rbx
+  8025b3:	45 84 ed             	test   %r13b,%r13b
+  8025b6:	74 10                	je     8025c8 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8025b8:	49 83 c4 01          	add    $0x1,%r12
+  8025bc:	45 84 f6             	test   %r14b,%r14b
+  8025bf:	75 c2                	jne    802583 <strncasecmp+0x2e>
+  8025c1:	eb 05                	jmp    8025c8 <strncasecmp+0x73>
+  8025c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8025c8:	48 83 c4 18          	add    $0x18,%rsp
+  8025cc:	5b                   	pop    %rbx
+  8025cd:	41 5c                	pop    %r12
+  8025cf:	41 5d                	pop    %r13
+  8025d1:	41 5e                	pop    %r14
+  8025d3:	41 5f                	pop    %r15
+  8025d5:	5d                   	pop    %rbp
+  8025d6:	c3                   	ret
+    if (p1 == p2) return 0;
+  8025d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025dc:	c3                   	ret
+
+00000000008025dd <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8025dd:	83 e7 df             	and    $0xffffffdf,%edi
+  8025e0:	83 ef 41             	sub    $0x41,%edi
+  8025e3:	83 ff 19             	cmp    $0x19,%edi
+  8025e6:	0f 96 c0             	setbe  %al
+}
+  8025e9:	c3                   	ret
+
+00000000008025ea <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8025ea:	83 ff 20             	cmp    $0x20,%edi
+  8025ed:	0f 94 c0             	sete   %al
+  8025f0:	83 ff 09             	cmp    $0x9,%edi
+  8025f3:	0f 94 c2             	sete   %dl
+  8025f6:	09 d0                	or     %edx,%eax
+}
+  8025f8:	c3                   	ret
+
+00000000008025f9 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8025f9:	55                   	push   %rbp
+  8025fa:	48 89 e5             	mov    %rsp,%rbp
+  8025fd:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8025ff:	48 bf 1f 67 80 00 00 	movabs $0x80671f,%rdi
+  802606:	00 00 00 
+  802609:	48 b8 9e 24 80 00 00 	movabs $0x80249e,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+  802615:	48 85 c0             	test   %rax,%rax
+  802618:	0f 95 c0             	setne  %al
+}
+  80261b:	5d                   	pop    %rbp
+  80261c:	c3                   	ret
+
+000000000080261d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80261d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802620:	48 89 f8             	mov    %rdi,%rax
+  802623:	48 f7 d8             	neg    %rax
+  802626:	83 e0 07             	and    $0x7,%eax
+  802629:	49 89 d1             	mov    %rdx,%r9
+  80262c:	49 29 c1             	sub    %rax,%r9
+  80262f:	78 36                	js     802667 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802631:	40 0f b6 c6          	movzbl %sil,%eax
+  802635:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80263c:	01 01 01 
+  80263f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802643:	40 f6 c7 07          	test   $0x7,%dil
+  802647:	75 38                	jne    802681 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802649:	4c 89 c9             	mov    %r9,%rcx
+  80264c:	48 c1 f9 03          	sar    $0x3,%rcx
+  802650:	74 0c                	je     80265e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802652:	fc                   	cld
+  802653:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802656:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80265a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80265e:	4d 85 c9             	test   %r9,%r9
+  802661:	75 45                	jne    8026a8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802663:	4c 89 c0             	mov    %r8,%rax
+  802666:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802667:	48 85 d2             	test   %rdx,%rdx
+  80266a:	74 f7                	je     802663 <memset+0x46>
+  80266c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80266f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802672:	48 83 c0 01          	add    $0x1,%rax
+  802676:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80267a:	48 39 c2             	cmp    %rax,%rdx
+  80267d:	75 f3                	jne    802672 <memset+0x55>
+  80267f:	eb e2                	jmp    802663 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802681:	40 f6 c7 01          	test   $0x1,%dil
+  802685:	74 06                	je     80268d <memset+0x70>
+  802687:	88 07                	mov    %al,(%rdi)
+  802689:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80268d:	40 f6 c7 02          	test   $0x2,%dil
+  802691:	74 07                	je     80269a <memset+0x7d>
+  802693:	66 89 07             	mov    %ax,(%rdi)
+  802696:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80269a:	40 f6 c7 04          	test   $0x4,%dil
+  80269e:	74 a9                	je     802649 <memset+0x2c>
+  8026a0:	89 07                	mov    %eax,(%rdi)
+  8026a2:	48 83 c7 04          	add    $0x4,%rdi
+  8026a6:	eb a1                	jmp    802649 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8026a8:	41 f6 c1 04          	test   $0x4,%r9b
+  8026ac:	74 06                	je     8026b4 <memset+0x97>
+  8026ae:	89 07                	mov    %eax,(%rdi)
+  8026b0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8026b4:	41 f6 c1 02          	test   $0x2,%r9b
+  8026b8:	74 07                	je     8026c1 <memset+0xa4>
+  8026ba:	66 89 07             	mov    %ax,(%rdi)
+  8026bd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8026c1:	41 f6 c1 01          	test   $0x1,%r9b
+  8026c5:	74 9c                	je     802663 <memset+0x46>
+  8026c7:	88 07                	mov    %al,(%rdi)
+  8026c9:	eb 98                	jmp    802663 <memset+0x46>
+
+00000000008026cb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8026cb:	48 89 f8             	mov    %rdi,%rax
+  8026ce:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8026d1:	48 39 fe             	cmp    %rdi,%rsi
+  8026d4:	73 3b                	jae    802711 <memmove+0x46>
+  8026d6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8026da:	48 39 d7             	cmp    %rdx,%rdi
+  8026dd:	73 32                	jae    802711 <memmove+0x46>
+        s += n;
+        d += n;
+  8026df:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026e3:	48 89 d6             	mov    %rdx,%rsi
+  8026e6:	48 09 fe             	or     %rdi,%rsi
+  8026e9:	48 09 ce             	or     %rcx,%rsi
+  8026ec:	40 f6 c6 07          	test   $0x7,%sil
+  8026f0:	75 12                	jne    802704 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8026f2:	48 83 ef 08          	sub    $0x8,%rdi
+  8026f6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8026fa:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026fe:	fd                   	std
+  8026ff:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802702:	fc                   	cld
+  802703:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802704:	48 83 ef 01          	sub    $0x1,%rdi
+  802708:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80270c:	fd                   	std
+  80270d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80270f:	eb f1                	jmp    802702 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802711:	48 89 f2             	mov    %rsi,%rdx
+  802714:	48 09 c2             	or     %rax,%rdx
+  802717:	48 09 ca             	or     %rcx,%rdx
+  80271a:	f6 c2 07             	test   $0x7,%dl
+  80271d:	75 0c                	jne    80272b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80271f:	48 c1 e9 03          	shr    $0x3,%rcx
+  802723:	48 89 c7             	mov    %rax,%rdi
+  802726:	fc                   	cld
+  802727:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80272a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80272b:	48 89 c7             	mov    %rax,%rdi
+  80272e:	fc                   	cld
+  80272f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802731:	c3                   	ret
+
+0000000000802732 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802732:	55                   	push   %rbp
+  802733:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802736:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  80273d:	00 00 00 
+  802740:	ff d0                	call   *%rax
+}
+  802742:	5d                   	pop    %rbp
+  802743:	c3                   	ret
+
+0000000000802744 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802744:	55                   	push   %rbp
+  802745:	48 89 e5             	mov    %rsp,%rbp
+  802748:	41 57                	push   %r15
+  80274a:	41 56                	push   %r14
+  80274c:	41 55                	push   %r13
+  80274e:	41 54                	push   %r12
+  802750:	53                   	push   %rbx
+  802751:	48 83 ec 08          	sub    $0x8,%rsp
+  802755:	49 89 fe             	mov    %rdi,%r14
+  802758:	49 89 f7             	mov    %rsi,%r15
+  80275b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80275e:	48 89 f7             	mov    %rsi,%rdi
+  802761:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802770:	48 89 de             	mov    %rbx,%rsi
+  802773:	4c 89 f7             	mov    %r14,%rdi
+  802776:	48 b8 58 23 80 00 00 	movabs $0x802358,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802785:	48 39 c3             	cmp    %rax,%rbx
+  802788:	74 36                	je     8027c0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80278a:	48 89 d8             	mov    %rbx,%rax
+  80278d:	4c 29 e8             	sub    %r13,%rax
+  802790:	49 39 c4             	cmp    %rax,%r12
+  802793:	73 31                	jae    8027c6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802795:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80279a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80279e:	4c 89 fe             	mov    %r15,%rsi
+  8027a1:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8027a8:	00 00 00 
+  8027ab:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8027ad:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8027b1:	48 83 c4 08          	add    $0x8,%rsp
+  8027b5:	5b                   	pop    %rbx
+  8027b6:	41 5c                	pop    %r12
+  8027b8:	41 5d                	pop    %r13
+  8027ba:	41 5e                	pop    %r14
+  8027bc:	41 5f                	pop    %r15
+  8027be:	5d                   	pop    %rbp
+  8027bf:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8027c0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8027c4:	eb eb                	jmp    8027b1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8027c6:	48 83 eb 01          	sub    $0x1,%rbx
+  8027ca:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8027ce:	48 89 da             	mov    %rbx,%rdx
+  8027d1:	4c 89 fe             	mov    %r15,%rsi
+  8027d4:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8027db:	00 00 00 
+  8027de:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8027e0:	49 01 de             	add    %rbx,%r14
+  8027e3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8027e8:	eb c3                	jmp    8027ad <strlcat+0x69>
+
+00000000008027ea <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8027ea:	48 85 d2             	test   %rdx,%rdx
+  8027ed:	74 2d                	je     80281c <memcmp+0x32>
+  8027ef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8027f4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8027f8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8027fd:	44 38 c1             	cmp    %r8b,%cl
+  802800:	75 0f                	jne    802811 <memcmp+0x27>
+    while (n-- > 0) {
+  802802:	48 83 c0 01          	add    $0x1,%rax
+  802806:	48 39 c2             	cmp    %rax,%rdx
+  802809:	75 e9                	jne    8027f4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80280b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802810:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802811:	0f b6 c1             	movzbl %cl,%eax
+  802814:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802818:	44 29 c0             	sub    %r8d,%eax
+  80281b:	c3                   	ret
+    return 0;
+  80281c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802821:	c3                   	ret
+
+0000000000802822 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802822:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802826:	48 39 c7             	cmp    %rax,%rdi
+  802829:	73 0f                	jae    80283a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80282b:	40 38 37             	cmp    %sil,(%rdi)
+  80282e:	74 0e                	je     80283e <memfind+0x1c>
+    for (; src < end; src++) {
+  802830:	48 83 c7 01          	add    $0x1,%rdi
+  802834:	48 39 f8             	cmp    %rdi,%rax
+  802837:	75 f2                	jne    80282b <memfind+0x9>
+  802839:	c3                   	ret
+  80283a:	48 89 f8             	mov    %rdi,%rax
+  80283d:	c3                   	ret
+  80283e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802841:	c3                   	ret
+
+0000000000802842 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802842:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802845:	0f b6 37             	movzbl (%rdi),%esi
+  802848:	40 80 fe 20          	cmp    $0x20,%sil
+  80284c:	74 06                	je     802854 <strtol+0x12>
+  80284e:	40 80 fe 09          	cmp    $0x9,%sil
+  802852:	75 13                	jne    802867 <strtol+0x25>
+  802854:	48 83 c7 01          	add    $0x1,%rdi
+  802858:	0f b6 37             	movzbl (%rdi),%esi
+  80285b:	40 80 fe 20          	cmp    $0x20,%sil
+  80285f:	74 f3                	je     802854 <strtol+0x12>
+  802861:	40 80 fe 09          	cmp    $0x9,%sil
+  802865:	74 ed                	je     802854 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802867:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80286a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80286d:	3c 01                	cmp    $0x1,%al
+  80286f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802873:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802879:	75 0f                	jne    80288a <strtol+0x48>
+  80287b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80287e:	74 14                	je     802894 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802880:	85 d2                	test   %edx,%edx
+  802882:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802887:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80288a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80288f:	4c 63 ca             	movslq %edx,%r9
+  802892:	eb 36                	jmp    8028ca <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802894:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802898:	74 0f                	je     8028a9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80289a:	85 d2                	test   %edx,%edx
+  80289c:	75 ec                	jne    80288a <strtol+0x48>
+        s++;
+  80289e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8028a2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8028a7:	eb e1                	jmp    80288a <strtol+0x48>
+        s += 2;
+  8028a9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8028ad:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8028b2:	eb d6                	jmp    80288a <strtol+0x48>
+            dig -= '0';
+  8028b4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8028b7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8028bb:	41 39 d0             	cmp    %edx,%r8d
+  8028be:	7d 21                	jge    8028e1 <strtol+0x9f>
+        val = val * base + dig;
+  8028c0:	49 0f af c1          	imul   %r9,%rax
+  8028c4:	0f b6 c9             	movzbl %cl,%ecx
+  8028c7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8028ca:	48 83 c7 01          	add    $0x1,%rdi
+  8028ce:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8028d2:	80 f9 39             	cmp    $0x39,%cl
+  8028d5:	76 dd                	jbe    8028b4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8028d7:	80 f9 7b             	cmp    $0x7b,%cl
+  8028da:	77 05                	ja     8028e1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8028dc:	83 e9 57             	sub    $0x57,%ecx
+  8028df:	eb d6                	jmp    8028b7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8028e1:	4d 85 d2             	test   %r10,%r10
+  8028e4:	74 03                	je     8028e9 <strtol+0xa7>
+  8028e6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8028e9:	48 89 c2             	mov    %rax,%rdx
+  8028ec:	48 f7 da             	neg    %rdx
+  8028ef:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8028f3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8028f7:	c3                   	ret
+
+00000000008028f8 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8028f8:	55                   	push   %rbp
+  8028f9:	48 89 e5             	mov    %rsp,%rbp
+  8028fc:	53                   	push   %rbx
+  8028fd:	48 89 fa             	mov    %rdi,%rdx
+  802900:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802903:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802908:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802912:	be 00 00 00 00       	mov    $0x0,%esi
+  802917:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802923:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802925:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+
+000000000080292b <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80292b:	55                   	push   %rbp
+  80292c:	48 89 e5             	mov    %rsp,%rbp
+  80292f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802930:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802935:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80293f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802944:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802949:	be 00 00 00 00       	mov    $0x0,%esi
+  80294e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802954:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80295a:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80295c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802960:	c9                   	leave
+  802961:	c3                   	ret
+
+0000000000802962 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	53                   	push   %rbx
+  802967:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80296a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80296f:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802979:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80297e:	be 00 00 00 00       	mov    $0x0,%esi
+  802983:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802989:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80298f:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802991:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802995:	c9                   	leave
+  802996:	c3                   	ret
+
+0000000000802997 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802997:	55                   	push   %rbp
+  802998:	48 89 e5             	mov    %rsp,%rbp
+  80299b:	53                   	push   %rbx
+  80299c:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8029a0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8029a3:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029a8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029b2:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c8:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029ca:	48 85 c0             	test   %rax,%rax
+  8029cd:	7f 06                	jg     8029d5 <sys_env_destroy+0x3e>
+}
+  8029cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029d3:	c9                   	leave
+  8029d4:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029d5:	49 89 c0             	mov    %rax,%r8
+  8029d8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8029dd:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  8029e4:	00 00 00 
+  8029e7:	be 27 00 00 00       	mov    $0x27,%esi
+  8029ec:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  8029f3:	00 00 00 
+  8029f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029fb:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802a02:	00 00 00 
+  802a05:	41 ff d1             	call   *%r9
+
+0000000000802a08 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802a08:	55                   	push   %rbp
+  802a09:	48 89 e5             	mov    %rsp,%rbp
+  802a0c:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0d:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a17:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a21:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a26:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a31:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a37:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3d:	c9                   	leave
+  802a3e:	c3                   	ret
+
+0000000000802a3f <sys_yield>:
+
+void
+sys_yield(void) {
+  802a3f:	55                   	push   %rbp
+  802a40:	48 89 e5             	mov    %rsp,%rbp
+  802a43:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802a44:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a49:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a58:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5d:	be 00 00 00 00       	mov    $0x0,%esi
+  802a62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6e:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a74:	c9                   	leave
+  802a75:	c3                   	ret
+
+0000000000802a76 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a76:	55                   	push   %rbp
+  802a77:	48 89 e5             	mov    %rsp,%rbp
+  802a7a:	53                   	push   %rbx
+  802a7b:	48 89 fa             	mov    %rdi,%rdx
+  802a7e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a81:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a86:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a8d:	00 00 00 
+  802a90:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a95:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802aa0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa6:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802aa8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aac:	c9                   	leave
+  802aad:	c3                   	ret
+
+0000000000802aae <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802aae:	55                   	push   %rbp
+  802aaf:	48 89 e5             	mov    %rsp,%rbp
+  802ab2:	53                   	push   %rbx
+  802ab3:	49 89 f8             	mov    %rdi,%r8
+  802ab6:	48 89 d3             	mov    %rdx,%rbx
+  802ab9:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802abc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ac1:	4c 89 c2             	mov    %r8,%rdx
+  802ac4:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ac7:	be 00 00 00 00       	mov    $0x0,%esi
+  802acc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ad2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ad8:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802ada:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+0000000000802ae0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802ae0:	55                   	push   %rbp
+  802ae1:	48 89 e5             	mov    %rsp,%rbp
+  802ae4:	53                   	push   %rbx
+  802ae5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae9:	89 f8                	mov    %edi,%eax
+  802aeb:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802aee:	48 63 f9             	movslq %ecx,%rdi
+  802af1:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802af9:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afc:	be 00 00 00 00       	mov    $0x0,%esi
+  802b01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b0f:	48 85 c0             	test   %rax,%rax
+  802b12:	7f 06                	jg     802b1a <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802b14:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b18:	c9                   	leave
+  802b19:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b1a:	49 89 c0             	mov    %rax,%r8
+  802b1d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802b22:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802b29:	00 00 00 
+  802b2c:	be 27 00 00 00       	mov    $0x27,%esi
+  802b31:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802b38:	00 00 00 
+  802b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b40:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802b47:	00 00 00 
+  802b4a:	41 ff d1             	call   *%r9
+
+0000000000802b4d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802b4d:	55                   	push   %rbp
+  802b4e:	48 89 e5             	mov    %rsp,%rbp
+  802b51:	53                   	push   %rbx
+  802b52:	48 83 ec 08          	sub    $0x8,%rsp
+  802b56:	89 f8                	mov    %edi,%eax
+  802b58:	49 89 f2             	mov    %rsi,%r10
+  802b5b:	48 89 cf             	mov    %rcx,%rdi
+  802b5e:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802b61:	48 63 da             	movslq %edx,%rbx
+  802b64:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b67:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b6c:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b6f:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b78:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b7a:	48 85 c0             	test   %rax,%rax
+  802b7d:	7f 06                	jg     802b85 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b83:	c9                   	leave
+  802b84:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b85:	49 89 c0             	mov    %rax,%r8
+  802b88:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b8d:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802b94:	00 00 00 
+  802b97:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9c:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802ba3:	00 00 00 
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802bb2:	00 00 00 
+  802bb5:	41 ff d1             	call   *%r9
+
+0000000000802bb8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802bb8:	55                   	push   %rbp
+  802bb9:	48 89 e5             	mov    %rsp,%rbp
+  802bbc:	53                   	push   %rbx
+  802bbd:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc1:	48 89 f1             	mov    %rsi,%rcx
+  802bc4:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802bc7:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bca:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bcf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd4:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bdf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be7:	48 85 c0             	test   %rax,%rax
+  802bea:	7f 06                	jg     802bf2 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802bec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf0:	c9                   	leave
+  802bf1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bf2:	49 89 c0             	mov    %rax,%r8
+  802bf5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802bfa:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802c01:	00 00 00 
+  802c04:	be 27 00 00 00       	mov    $0x27,%esi
+  802c09:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802c10:	00 00 00 
+  802c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c18:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802c1f:	00 00 00 
+  802c22:	41 ff d1             	call   *%r9
+
+0000000000802c25 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	53                   	push   %rbx
+  802c2a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802c2e:	48 63 ce             	movslq %esi,%rcx
+  802c31:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c34:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c3e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c43:	be 00 00 00 00       	mov    $0x0,%esi
+  802c48:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c54:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c56:	48 85 c0             	test   %rax,%rax
+  802c59:	7f 06                	jg     802c61 <sys_env_set_status+0x3c>
+}
+  802c5b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5f:	c9                   	leave
+  802c60:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c61:	49 89 c0             	mov    %rax,%r8
+  802c64:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802c69:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802c70:	00 00 00 
+  802c73:	be 27 00 00 00       	mov    $0x27,%esi
+  802c78:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802c7f:	00 00 00 
+  802c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c87:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802c8e:	00 00 00 
+  802c91:	41 ff d1             	call   *%r9
+
+0000000000802c94 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c94:	55                   	push   %rbp
+  802c95:	48 89 e5             	mov    %rsp,%rbp
+  802c98:	53                   	push   %rbx
+  802c99:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9d:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802ca0:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca3:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb2:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cbd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cc3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc5:	48 85 c0             	test   %rax,%rax
+  802cc8:	7f 06                	jg     802cd0 <sys_env_set_trapframe+0x3c>
+}
+  802cca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cce:	c9                   	leave
+  802ccf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cd0:	49 89 c0             	mov    %rax,%r8
+  802cd3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802cd8:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802cdf:	00 00 00 
+  802ce2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce7:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802cee:	00 00 00 
+  802cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf6:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802cfd:	00 00 00 
+  802d00:	41 ff d1             	call   *%r9
+
+0000000000802d03 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	53                   	push   %rbx
+  802d08:	48 83 ec 08          	sub    $0x8,%rsp
+  802d0c:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802d0f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d12:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d21:	be 00 00 00 00       	mov    $0x0,%esi
+  802d26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d32:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d34:	48 85 c0             	test   %rax,%rax
+  802d37:	7f 06                	jg     802d3f <sys_env_set_pgfault_upcall+0x3c>
+}
+  802d39:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d3f:	49 89 c0             	mov    %rax,%r8
+  802d42:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802d47:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802d4e:	00 00 00 
+  802d51:	be 27 00 00 00       	mov    $0x27,%esi
+  802d56:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802d5d:	00 00 00 
+  802d60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d65:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802d6c:	00 00 00 
+  802d6f:	41 ff d1             	call   *%r9
+
+0000000000802d72 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d72:	55                   	push   %rbp
+  802d73:	48 89 e5             	mov    %rsp,%rbp
+  802d76:	53                   	push   %rbx
+  802d77:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d7b:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d7f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d82:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d91:	be 00 00 00 00       	mov    $0x0,%esi
+  802d96:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802da4:	48 85 c0             	test   %rax,%rax
+  802da7:	7f 06                	jg     802daf <sys_env_set_reclaim+0x3d>
+}
+  802da9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802daf:	49 89 c0             	mov    %rax,%r8
+  802db2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802db7:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802dbe:	00 00 00 
+  802dc1:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc6:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802dcd:	00 00 00 
+  802dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd5:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802ddc:	00 00 00 
+  802ddf:	41 ff d1             	call   *%r9
+
+0000000000802de2 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802de2:	55                   	push   %rbp
+  802de3:	48 89 e5             	mov    %rsp,%rbp
+  802de6:	53                   	push   %rbx
+  802de7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802deb:	48 63 ce             	movslq %esi,%rcx
+  802dee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802df1:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e00:	be 00 00 00 00       	mov    $0x0,%esi
+  802e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e11:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e13:	48 85 c0             	test   %rax,%rax
+  802e16:	7f 06                	jg     802e1e <sys_env_set_nice+0x3c>
+}
+  802e18:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e1c:	c9                   	leave
+  802e1d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e1e:	49 89 c0             	mov    %rax,%r8
+  802e21:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802e26:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802e2d:	00 00 00 
+  802e30:	be 27 00 00 00       	mov    $0x27,%esi
+  802e35:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802e3c:	00 00 00 
+  802e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e44:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802e4b:	00 00 00 
+  802e4e:	41 ff d1             	call   *%r9
+
+0000000000802e51 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802e51:	55                   	push   %rbp
+  802e52:	48 89 e5             	mov    %rsp,%rbp
+  802e55:	53                   	push   %rbx
+  802e56:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e59:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e5e:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e68:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e6d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e78:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e7e:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e80:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e84:	c9                   	leave
+  802e85:	c3                   	ret
+
+0000000000802e86 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e86:	55                   	push   %rbp
+  802e87:	48 89 e5             	mov    %rsp,%rbp
+  802e8a:	53                   	push   %rbx
+  802e8b:	89 f8                	mov    %edi,%eax
+  802e8d:	49 89 f1             	mov    %rsi,%r9
+  802e90:	48 89 d3             	mov    %rdx,%rbx
+  802e93:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e96:	49 63 f0             	movslq %r8d,%rsi
+  802e99:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ea1:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ea4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eaa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802eb0:	cd 30                	int    $0x30
+}
+  802eb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb6:	c9                   	leave
+  802eb7:	c3                   	ret
+
+0000000000802eb8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802eb8:	55                   	push   %rbp
+  802eb9:	48 89 e5             	mov    %rsp,%rbp
+  802ebc:	53                   	push   %rbx
+  802ebd:	89 f8                	mov    %edi,%eax
+  802ebf:	49 89 f1             	mov    %rsi,%r9
+  802ec2:	48 89 d3             	mov    %rdx,%rbx
+  802ec5:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802ec8:	49 63 f0             	movslq %r8d,%rsi
+  802ecb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ece:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ed3:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ed6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802edc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ee2:	cd 30                	int    $0x30
+}
+  802ee4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ee8:	c9                   	leave
+  802ee9:	c3                   	ret
+
+0000000000802eea <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	53                   	push   %rbx
+  802eef:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef3:	89 f8                	mov    %edi,%eax
+  802ef5:	49 89 f2             	mov    %rsi,%r10
+  802ef8:	48 89 d3             	mov    %rdx,%rbx
+  802efb:	48 89 cf             	mov    %rcx,%rdi
+  802efe:	44 89 c6             	mov    %r8d,%esi
+  802f01:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f04:	48 63 f6             	movslq %esi,%rsi
+  802f07:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f0a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f0f:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f12:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f16:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f18:	48 85 c0             	test   %rax,%rax
+  802f1b:	7f 06                	jg     802f23 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f21:	c9                   	leave
+  802f22:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f23:	49 89 c0             	mov    %rax,%r8
+  802f26:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802f2b:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802f32:	00 00 00 
+  802f35:	be 27 00 00 00       	mov    $0x27,%esi
+  802f3a:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802f41:	00 00 00 
+  802f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f49:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802f50:	00 00 00 
+  802f53:	41 ff d1             	call   *%r9
+
+0000000000802f56 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802f56:	55                   	push   %rbp
+  802f57:	48 89 e5             	mov    %rsp,%rbp
+  802f5a:	53                   	push   %rbx
+  802f5b:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5f:	48 89 f1             	mov    %rsi,%rcx
+  802f62:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802f65:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802f69:	48 8b 1a             	mov    (%rdx),%rbx
+  802f6c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f6f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f74:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f78:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f7c:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f80:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f82:	48 85 c0             	test   %rax,%rax
+  802f85:	7f 06                	jg     802f8d <sys_ipc_call_short+0x37>
+}
+  802f87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f8b:	c9                   	leave
+  802f8c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f8d:	49 89 c0             	mov    %rax,%r8
+  802f90:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f95:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  802f9c:	00 00 00 
+  802f9f:	be 27 00 00 00       	mov    $0x27,%esi
+  802fa4:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  802fab:	00 00 00 
+  802fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb3:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  802fba:	00 00 00 
+  802fbd:	41 ff d1             	call   *%r9
+
+0000000000802fc0 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802fc0:	55                   	push   %rbp
+  802fc1:	48 89 e5             	mov    %rsp,%rbp
+  802fc4:	53                   	push   %rbx
+  802fc5:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc9:	89 f8                	mov    %edi,%eax
+  802fcb:	49 89 f2             	mov    %rsi,%r10
+  802fce:	48 89 d3             	mov    %rdx,%rbx
+  802fd1:	48 89 cf             	mov    %rcx,%rdi
+  802fd4:	44 89 c6             	mov    %r8d,%esi
+  802fd7:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802fda:	48 63 f6             	movslq %esi,%rsi
+  802fdd:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fe0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fe5:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802fe8:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802fec:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fee:	48 85 c0             	test   %rax,%rax
+  802ff1:	7f 06                	jg     802ff9 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ff3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff9:	49 89 c0             	mov    %rax,%r8
+  802ffc:	b9 11 00 00 00       	mov    $0x11,%ecx
+  803001:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  803008:	00 00 00 
+  80300b:	be 27 00 00 00       	mov    $0x27,%esi
+  803010:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  803017:	00 00 00 
+  80301a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301f:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  803026:	00 00 00 
+  803029:	41 ff d1             	call   *%r9
+
+000000000080302c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80302c:	55                   	push   %rbp
+  80302d:	48 89 e5             	mov    %rsp,%rbp
+  803030:	53                   	push   %rbx
+  803031:	48 83 ec 08          	sub    $0x8,%rsp
+  803035:	48 89 fa             	mov    %rdi,%rdx
+  803038:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80303b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803040:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803045:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80304a:	be 00 00 00 00       	mov    $0x0,%esi
+  80304f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803055:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80305b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80305d:	48 85 c0             	test   %rax,%rax
+  803060:	7f 06                	jg     803068 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803062:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803066:	c9                   	leave
+  803067:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803068:	49 89 c0             	mov    %rax,%r8
+  80306b:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803070:	48 ba 28 67 80 00 00 	movabs $0x806728,%rdx
+  803077:	00 00 00 
+  80307a:	be 27 00 00 00       	mov    $0x27,%esi
+  80307f:	48 bf 47 67 80 00 00 	movabs $0x806747,%rdi
+  803086:	00 00 00 
+  803089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80308e:	49 b9 f4 18 80 00 00 	movabs $0x8018f4,%r9
+  803095:	00 00 00 
+  803098:	41 ff d1             	call   *%r9
+
+000000000080309b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80309b:	55                   	push   %rbp
+  80309c:	48 89 e5             	mov    %rsp,%rbp
+  80309f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8030a0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8030be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030ca:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030d0:	c9                   	leave
+  8030d1:	c3                   	ret
+
+00000000008030d2 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  8030d2:	55                   	push   %rbp
+  8030d3:	48 89 e5             	mov    %rsp,%rbp
+  8030d6:	53                   	push   %rbx
+  8030d7:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030da:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030df:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030e9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8030f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030ff:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803101:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803105:	c9                   	leave
+  803106:	c3                   	ret
+
+0000000000803107 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803107:	55                   	push   %rbp
+  803108:	48 89 e5             	mov    %rsp,%rbp
+  80310b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80310c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803111:	ba 00 00 00 00       	mov    $0x0,%edx
+  803116:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80311b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803120:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803125:	be 00 00 00 00       	mov    $0x0,%esi
+  80312a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803130:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803136:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803138:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80313c:	c9                   	leave
+  80313d:	c3                   	ret
+
+000000000080313e <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80313e:	55                   	push   %rbp
+  80313f:	48 89 e5             	mov    %rsp,%rbp
+  803142:	53                   	push   %rbx
+  803143:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803147:	b8 08 00 00 00       	mov    $0x8,%eax
+  80314c:	cd 30                	int    $0x30
+  80314e:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  803150:	85 c0                	test   %eax,%eax
+  803152:	0f 88 85 00 00 00    	js     8031dd <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803158:	0f 84 ac 00 00 00    	je     80320a <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  80315e:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  803164:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80316b:	00 00 00 
+  80316e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803173:	89 c2                	mov    %eax,%edx
+  803175:	be 00 00 00 00       	mov    $0x0,%esi
+  80317a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317f:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+  80318b:	85 c0                	test   %eax,%eax
+  80318d:	0f 88 a8 00 00 00    	js     80323b <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  803193:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80319a:	00 00 00 
+  80319d:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8031a4:	89 df                	mov    %ebx,%edi
+  8031a6:	48 b8 03 2d 80 00 00 	movabs $0x802d03,%rax
+  8031ad:	00 00 00 
+  8031b0:	ff d0                	call   *%rax
+  8031b2:	85 c0                	test   %eax,%eax
+  8031b4:	0f 88 ae 00 00 00    	js     803268 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8031ba:	be 02 00 00 00       	mov    $0x2,%esi
+  8031bf:	89 df                	mov    %ebx,%edi
+  8031c1:	48 b8 25 2c 80 00 00 	movabs $0x802c25,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+  8031cd:	85 c0                	test   %eax,%eax
+  8031cf:	0f 88 c0 00 00 00    	js     803295 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  8031d5:	89 d8                	mov    %ebx,%eax
+  8031d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031db:	c9                   	leave
+  8031dc:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  8031dd:	89 c1                	mov    %eax,%ecx
+  8031df:	48 ba 55 67 80 00 00 	movabs $0x806755,%rdx
+  8031e6:	00 00 00 
+  8031e9:	be 20 00 00 00       	mov    $0x20,%esi
+  8031ee:	48 bf 65 67 80 00 00 	movabs $0x806765,%rdi
+  8031f5:	00 00 00 
+  8031f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fd:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  803204:	00 00 00 
+  803207:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80320a:	48 b8 08 2a 80 00 00 	movabs $0x802a08,%rax
+  803211:	00 00 00 
+  803214:	ff d0                	call   *%rax
+  803216:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80321b:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803222:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803229:	00 00 00 
+  80322c:	48 01 d0             	add    %rdx,%rax
+  80322f:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  803236:	00 00 00 
+        return 0;
+  803239:	eb 9a                	jmp    8031d5 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  80323b:	89 c1                	mov    %eax,%ecx
+  80323d:	48 ba 70 67 80 00 00 	movabs $0x806770,%rdx
+  803244:	00 00 00 
+  803247:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80324c:	48 bf 65 67 80 00 00 	movabs $0x806765,%rdi
+  803253:	00 00 00 
+  803256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325b:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  803262:	00 00 00 
+  803265:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803268:	89 c1                	mov    %eax,%ecx
+  80326a:	48 ba b8 67 80 00 00 	movabs $0x8067b8,%rdx
+  803271:	00 00 00 
+  803274:	be 32 00 00 00       	mov    $0x32,%esi
+  803279:	48 bf 65 67 80 00 00 	movabs $0x806765,%rdi
+  803280:	00 00 00 
+  803283:	b8 00 00 00 00       	mov    $0x0,%eax
+  803288:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  80328f:	00 00 00 
+  803292:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803295:	89 c1                	mov    %eax,%ecx
+  803297:	48 ba 83 67 80 00 00 	movabs $0x806783,%rdx
+  80329e:	00 00 00 
+  8032a1:	be 37 00 00 00       	mov    $0x37,%esi
+  8032a6:	48 bf 65 67 80 00 00 	movabs $0x806765,%rdi
+  8032ad:	00 00 00 
+  8032b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b5:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  8032bc:	00 00 00 
+  8032bf:	41 ff d0             	call   *%r8
+
+00000000008032c2 <sfork>:
+
+envid_t
+sfork() {
+  8032c2:	55                   	push   %rbp
+  8032c3:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8032c6:	48 ba 9a 67 80 00 00 	movabs $0x80679a,%rdx
+  8032cd:	00 00 00 
+  8032d0:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8032d5:	48 bf 65 67 80 00 00 	movabs $0x806765,%rdi
+  8032dc:	00 00 00 
+  8032df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e4:	48 b9 f4 18 80 00 00 	movabs $0x8018f4,%rcx
+  8032eb:	00 00 00 
+  8032ee:	ff d1                	call   *%rcx
+
+00000000008032f0 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8032f0:	85 ff                	test   %edi,%edi
+  8032f2:	78 58                	js     80334c <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8032f4:	48 85 f6             	test   %rsi,%rsi
+  8032f7:	74 12                	je     80330b <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8032f9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803300:	00 00 00 
+  803303:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  803309:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80330b:	48 85 c9             	test   %rcx,%rcx
+  80330e:	74 12                	je     803322 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  803310:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803317:	00 00 00 
+  80331a:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  803320:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  803322:	48 85 d2             	test   %rdx,%rdx
+  803325:	74 14                	je     80333b <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  803327:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80332e:	00 00 00 
+  803331:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  803338:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80333b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803342:	00 00 00 
+  803345:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80334b:	c3                   	ret
+        if (from_env_store) {
+  80334c:	48 85 f6             	test   %rsi,%rsi
+  80334f:	74 06                	je     803357 <ipc_result+0x67>
+            *from_env_store = 0;
+  803351:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  803357:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  803359:	48 85 c9             	test   %rcx,%rcx
+  80335c:	74 ed                	je     80334b <ipc_result+0x5b>
+            *perm_store = 0;
+  80335e:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  803364:	c3                   	ret
+
+0000000000803365 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  803365:	55                   	push   %rbp
+  803366:	48 89 e5             	mov    %rsp,%rbp
+  803369:	41 55                	push   %r13
+  80336b:	41 54                	push   %r12
+  80336d:	53                   	push   %rbx
+  80336e:	48 83 ec 08          	sub    $0x8,%rsp
+  803372:	49 89 fc             	mov    %rdi,%r12
+  803375:	48 89 f7             	mov    %rsi,%rdi
+  803378:	48 89 d3             	mov    %rdx,%rbx
+  80337b:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80337e:	48 85 f6             	test   %rsi,%rsi
+  803381:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803388:	00 00 00 
+  80338b:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80338f:	be 00 00 00 00       	mov    $0x0,%esi
+  803394:	48 85 d2             	test   %rdx,%rdx
+  803397:	74 03                	je     80339c <ipc_recv+0x37>
+  803399:	48 8b 32             	mov    (%rdx),%rsi
+  80339c:	48 b8 2c 30 80 00 00 	movabs $0x80302c,%rax
+  8033a3:	00 00 00 
+  8033a6:	ff d0                	call   *%rax
+  8033a8:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8033aa:	4c 89 e9             	mov    %r13,%rcx
+  8033ad:	48 89 da             	mov    %rbx,%rdx
+  8033b0:	4c 89 e6             	mov    %r12,%rsi
+  8033b3:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  8033ba:	00 00 00 
+  8033bd:	ff d0                	call   *%rax
+}
+  8033bf:	48 83 c4 08          	add    $0x8,%rsp
+  8033c3:	5b                   	pop    %rbx
+  8033c4:	41 5c                	pop    %r12
+  8033c6:	41 5d                	pop    %r13
+  8033c8:	5d                   	pop    %rbp
+  8033c9:	c3                   	ret
+
+00000000008033ca <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8033ca:	55                   	push   %rbp
+  8033cb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8033ce:	48 85 d2             	test   %rdx,%rdx
+  8033d1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033d8:	00 00 00 
+  8033db:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8033df:	89 f6                	mov    %esi,%esi
+  8033e1:	48 b8 b8 2e 80 00 00 	movabs $0x802eb8,%rax
+  8033e8:	00 00 00 
+  8033eb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8033ed:	85 c0                	test   %eax,%eax
+  8033ef:	78 02                	js     8033f3 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8033f1:	5d                   	pop    %rbp
+  8033f2:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8033f3:	89 c1                	mov    %eax,%ecx
+  8033f5:	48 ba d7 67 80 00 00 	movabs $0x8067d7,%rdx
+  8033fc:	00 00 00 
+  8033ff:	be 4f 00 00 00       	mov    $0x4f,%esi
+  803404:	48 bf e4 67 80 00 00 	movabs $0x8067e4,%rdi
+  80340b:	00 00 00 
+  80340e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803413:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  80341a:	00 00 00 
+  80341d:	41 ff d0             	call   *%r8
+
+0000000000803420 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  803420:	55                   	push   %rbp
+  803421:	48 89 e5             	mov    %rsp,%rbp
+  803424:	53                   	push   %rbx
+  803425:	48 83 ec 08          	sub    $0x8,%rsp
+  803429:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80342d:	48 85 d2             	test   %rdx,%rdx
+  803430:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803437:	00 00 00 
+  80343a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80343e:	4d 85 c9             	test   %r9,%r9
+  803441:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  803445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344a:	48 85 db             	test   %rbx,%rbx
+  80344d:	74 03                	je     803452 <ipc_call+0x32>
+  80344f:	48 8b 03             	mov    (%rbx),%rax
+  803452:	89 f6                	mov    %esi,%esi
+  803454:	48 83 ec 08          	sub    $0x8,%rsp
+  803458:	50                   	push   %rax
+  803459:	48 b8 ea 2e 80 00 00 	movabs $0x802eea,%rax
+  803460:	00 00 00 
+  803463:	ff d0                	call   *%rax
+  803465:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  803467:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80346b:	48 89 da             	mov    %rbx,%rdx
+  80346e:	be 00 00 00 00       	mov    $0x0,%esi
+  803473:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+}
+  80347f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803483:	c9                   	leave
+  803484:	c3                   	ret
+
+0000000000803485 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  803485:	55                   	push   %rbp
+  803486:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  803489:	89 f6                	mov    %esi,%esi
+  80348b:	48 b8 56 2f 80 00 00 	movabs $0x802f56,%rax
+  803492:	00 00 00 
+  803495:	ff d0                	call   *%rax
+  803497:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  803499:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80349e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a8:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  8034af:	00 00 00 
+  8034b2:	ff d0                	call   *%rax
+}
+  8034b4:	5d                   	pop    %rbp
+  8034b5:	c3                   	ret
+
+00000000008034b6 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8034b6:	55                   	push   %rbp
+  8034b7:	48 89 e5             	mov    %rsp,%rbp
+  8034ba:	41 54                	push   %r12
+  8034bc:	53                   	push   %rbx
+  8034bd:	4c 89 cb             	mov    %r9,%rbx
+  8034c0:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8034c4:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8034c8:	48 85 d2             	test   %rdx,%rdx
+  8034cb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034d2:	00 00 00 
+  8034d5:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8034d9:	4d 85 c9             	test   %r9,%r9
+  8034dc:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8034e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e5:	4d 85 e4             	test   %r12,%r12
+  8034e8:	74 04                	je     8034ee <ipc_reply_wait+0x38>
+  8034ea:	49 8b 04 24          	mov    (%r12),%rax
+  8034ee:	89 f6                	mov    %esi,%esi
+  8034f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8034f4:	50                   	push   %rax
+  8034f5:	48 b8 c0 2f 80 00 00 	movabs $0x802fc0,%rax
+  8034fc:	00 00 00 
+  8034ff:	ff d0                	call   *%rax
+  803501:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  803503:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  803507:	4c 89 e2             	mov    %r12,%rdx
+  80350a:	48 89 de             	mov    %rbx,%rsi
+  80350d:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  803514:	00 00 00 
+  803517:	ff d0                	call   *%rax
+}
+  803519:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80351d:	5b                   	pop    %rbx
+  80351e:	41 5c                	pop    %r12
+  803520:	5d                   	pop    %rbp
+  803521:	c3                   	ret
+
+0000000000803522 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  803522:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  803527:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80352e:	00 00 00 
+  803531:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  803538:	48 01 ca             	add    %rcx,%rdx
+  80353b:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  803541:	39 fa                	cmp    %edi,%edx
+  803543:	74 12                	je     803557 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  803545:	48 83 c0 01          	add    $0x1,%rax
+  803549:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80354f:	75 e0                	jne    803531 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  803551:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803556:	c3                   	ret
+            return envs[i].env_id;
+  803557:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80355e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803565:	00 00 00 
+  803568:	48 01 d0             	add    %rdx,%rax
+  80356b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  803571:	c3                   	ret
+
+0000000000803572 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803572:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803579:	ff ff ff 
+  80357c:	48 01 f8             	add    %rdi,%rax
+  80357f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803583:	c3                   	ret
+
+0000000000803584 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803584:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80358b:	ff ff ff 
+  80358e:	48 01 f8             	add    %rdi,%rax
+  803591:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803595:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80359b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80359f:	c3                   	ret
+
+00000000008035a0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8035a0:	55                   	push   %rbp
+  8035a1:	48 89 e5             	mov    %rsp,%rbp
+  8035a4:	41 57                	push   %r15
+  8035a6:	41 56                	push   %r14
+  8035a8:	41 55                	push   %r13
+  8035aa:	41 54                	push   %r12
+  8035ac:	53                   	push   %rbx
+  8035ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8035b1:	49 89 ff             	mov    %rdi,%r15
+  8035b4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8035b9:	49 bd a0 4a 80 00 00 	movabs $0x804aa0,%r13
+  8035c0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8035c3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8035c9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8035cc:	48 89 df             	mov    %rbx,%rdi
+  8035cf:	41 ff d5             	call   *%r13
+  8035d2:	83 e0 04             	and    $0x4,%eax
+  8035d5:	74 17                	je     8035ee <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8035d7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8035de:	4c 39 f3             	cmp    %r14,%rbx
+  8035e1:	75 e6                	jne    8035c9 <fd_alloc+0x29>
+  8035e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8035e9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8035ee:	4d 89 27             	mov    %r12,(%r15)
+}
+  8035f1:	48 83 c4 08          	add    $0x8,%rsp
+  8035f5:	5b                   	pop    %rbx
+  8035f6:	41 5c                	pop    %r12
+  8035f8:	41 5d                	pop    %r13
+  8035fa:	41 5e                	pop    %r14
+  8035fc:	41 5f                	pop    %r15
+  8035fe:	5d                   	pop    %rbp
+  8035ff:	c3                   	ret
+
+0000000000803600 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  803600:	83 ff 1f             	cmp    $0x1f,%edi
+  803603:	77 39                	ja     80363e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803605:	55                   	push   %rbp
+  803606:	48 89 e5             	mov    %rsp,%rbp
+  803609:	41 54                	push   %r12
+  80360b:	53                   	push   %rbx
+  80360c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80360f:	48 63 df             	movslq %edi,%rbx
+  803612:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803619:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80361d:	48 89 df             	mov    %rbx,%rdi
+  803620:	48 b8 a0 4a 80 00 00 	movabs $0x804aa0,%rax
+  803627:	00 00 00 
+  80362a:	ff d0                	call   *%rax
+  80362c:	a8 04                	test   $0x4,%al
+  80362e:	74 14                	je     803644 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  803630:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803634:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803639:	5b                   	pop    %rbx
+  80363a:	41 5c                	pop    %r12
+  80363c:	5d                   	pop    %rbp
+  80363d:	c3                   	ret
+        return -E_INVAL;
+  80363e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803643:	c3                   	ret
+        return -E_INVAL;
+  803644:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803649:	eb ee                	jmp    803639 <fd_lookup+0x39>
+
+000000000080364b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80364b:	55                   	push   %rbp
+  80364c:	48 89 e5             	mov    %rsp,%rbp
+  80364f:	41 54                	push   %r12
+  803651:	53                   	push   %rbx
+  803652:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803655:	48 b8 80 68 80 00 00 	movabs $0x806880,%rax
+  80365c:	00 00 00 
+  80365f:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803666:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803669:	39 3b                	cmp    %edi,(%rbx)
+  80366b:	74 47                	je     8036b4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80366d:	48 83 c0 08          	add    $0x8,%rax
+  803671:	48 8b 18             	mov    (%rax),%rbx
+  803674:	48 85 db             	test   %rbx,%rbx
+  803677:	75 f0                	jne    803669 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803679:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803680:	00 00 00 
+  803683:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803689:	89 fa                	mov    %edi,%edx
+  80368b:	48 bf f0 67 80 00 00 	movabs $0x8067f0,%rdi
+  803692:	00 00 00 
+  803695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369a:	48 b9 44 1a 80 00 00 	movabs $0x801a44,%rcx
+  8036a1:	00 00 00 
+  8036a4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8036a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8036ab:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8036af:	5b                   	pop    %rbx
+  8036b0:	41 5c                	pop    %r12
+  8036b2:	5d                   	pop    %rbp
+  8036b3:	c3                   	ret
+            return 0;
+  8036b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036b9:	eb f0                	jmp    8036ab <dev_lookup+0x60>
+
+00000000008036bb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8036bb:	55                   	push   %rbp
+  8036bc:	48 89 e5             	mov    %rsp,%rbp
+  8036bf:	41 55                	push   %r13
+  8036c1:	41 54                	push   %r12
+  8036c3:	53                   	push   %rbx
+  8036c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8036c8:	48 89 fb             	mov    %rdi,%rbx
+  8036cb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8036ce:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8036d5:	ff ff ff 
+  8036d8:	48 01 df             	add    %rbx,%rdi
+  8036db:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8036df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036e3:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+  8036ef:	41 89 c5             	mov    %eax,%r13d
+  8036f2:	85 c0                	test   %eax,%eax
+  8036f4:	78 06                	js     8036fc <fd_close+0x41>
+  8036f6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8036fa:	74 1a                	je     803716 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8036fc:	45 84 e4             	test   %r12b,%r12b
+  8036ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803704:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803708:	44 89 e8             	mov    %r13d,%eax
+  80370b:	48 83 c4 18          	add    $0x18,%rsp
+  80370f:	5b                   	pop    %rbx
+  803710:	41 5c                	pop    %r12
+  803712:	41 5d                	pop    %r13
+  803714:	5d                   	pop    %rbp
+  803715:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803716:	8b 3b                	mov    (%rbx),%edi
+  803718:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80371c:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  803723:	00 00 00 
+  803726:	ff d0                	call   *%rax
+  803728:	41 89 c5             	mov    %eax,%r13d
+  80372b:	85 c0                	test   %eax,%eax
+  80372d:	78 1b                	js     80374a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80372f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803733:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803737:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80373d:	48 85 c0             	test   %rax,%rax
+  803740:	74 08                	je     80374a <fd_close+0x8f>
+  803742:	48 89 df             	mov    %rbx,%rdi
+  803745:	ff d0                	call   *%rax
+  803747:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80374a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374f:	48 89 de             	mov    %rbx,%rsi
+  803752:	bf 00 00 00 00       	mov    $0x0,%edi
+  803757:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  80375e:	00 00 00 
+  803761:	ff d0                	call   *%rax
+    return res;
+  803763:	eb a3                	jmp    803708 <fd_close+0x4d>
+
+0000000000803765 <close>:
+
+int
+close(int fdnum) {
+  803765:	55                   	push   %rbp
+  803766:	48 89 e5             	mov    %rsp,%rbp
+  803769:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80376d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803771:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803778:	00 00 00 
+  80377b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	78 15                	js     803796 <close+0x31>
+
+    return fd_close(fd, 1);
+  803781:	be 01 00 00 00       	mov    $0x1,%esi
+  803786:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80378a:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+}
+  803796:	c9                   	leave
+  803797:	c3                   	ret
+
+0000000000803798 <close_all>:
+
+void
+close_all(void) {
+  803798:	55                   	push   %rbp
+  803799:	48 89 e5             	mov    %rsp,%rbp
+  80379c:	41 54                	push   %r12
+  80379e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80379f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8037a4:	49 bc 65 37 80 00 00 	movabs $0x803765,%r12
+  8037ab:	00 00 00 
+  8037ae:	89 df                	mov    %ebx,%edi
+  8037b0:	41 ff d4             	call   *%r12
+  8037b3:	83 c3 01             	add    $0x1,%ebx
+  8037b6:	83 fb 20             	cmp    $0x20,%ebx
+  8037b9:	75 f3                	jne    8037ae <close_all+0x16>
+}
+  8037bb:	5b                   	pop    %rbx
+  8037bc:	41 5c                	pop    %r12
+  8037be:	5d                   	pop    %rbp
+  8037bf:	c3                   	ret
+
+00000000008037c0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8037c0:	55                   	push   %rbp
+  8037c1:	48 89 e5             	mov    %rsp,%rbp
+  8037c4:	41 57                	push   %r15
+  8037c6:	41 56                	push   %r14
+  8037c8:	41 55                	push   %r13
+  8037ca:	41 54                	push   %r12
+  8037cc:	53                   	push   %rbx
+  8037cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8037d1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8037d4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037d8:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	89 c3                	mov    %eax,%ebx
+  8037e6:	85 c0                	test   %eax,%eax
+  8037e8:	0f 88 b8 00 00 00    	js     8038a6 <dup+0xe6>
+    close(newfdnum);
+  8037ee:	44 89 e7             	mov    %r12d,%edi
+  8037f1:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8037fd:	4d 63 ec             	movslq %r12d,%r13
+  803800:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803807:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80380b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80380f:	4c 89 ff             	mov    %r15,%rdi
+  803812:	49 be 84 35 80 00 00 	movabs $0x803584,%r14
+  803819:	00 00 00 
+  80381c:	41 ff d6             	call   *%r14
+  80381f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803822:	4c 89 ef             	mov    %r13,%rdi
+  803825:	41 ff d6             	call   *%r14
+  803828:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80382b:	48 89 df             	mov    %rbx,%rdi
+  80382e:	48 b8 a0 4a 80 00 00 	movabs $0x804aa0,%rax
+  803835:	00 00 00 
+  803838:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80383a:	a8 04                	test   $0x4,%al
+  80383c:	74 2b                	je     803869 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80383e:	41 89 c1             	mov    %eax,%r9d
+  803841:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803847:	4c 89 f1             	mov    %r14,%rcx
+  80384a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80384f:	48 89 de             	mov    %rbx,%rsi
+  803852:	bf 00 00 00 00       	mov    $0x0,%edi
+  803857:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  80385e:	00 00 00 
+  803861:	ff d0                	call   *%rax
+  803863:	89 c3                	mov    %eax,%ebx
+  803865:	85 c0                	test   %eax,%eax
+  803867:	78 4e                	js     8038b7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803869:	4c 89 ff             	mov    %r15,%rdi
+  80386c:	48 b8 a0 4a 80 00 00 	movabs $0x804aa0,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+  803878:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80387b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803881:	4c 89 e9             	mov    %r13,%rcx
+  803884:	ba 00 00 00 00       	mov    $0x0,%edx
+  803889:	4c 89 fe             	mov    %r15,%rsi
+  80388c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803891:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  803898:	00 00 00 
+  80389b:	ff d0                	call   *%rax
+  80389d:	89 c3                	mov    %eax,%ebx
+  80389f:	85 c0                	test   %eax,%eax
+  8038a1:	78 14                	js     8038b7 <dup+0xf7>
+
+    return newfdnum;
+  8038a3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8038a6:	89 d8                	mov    %ebx,%eax
+  8038a8:	48 83 c4 18          	add    $0x18,%rsp
+  8038ac:	5b                   	pop    %rbx
+  8038ad:	41 5c                	pop    %r12
+  8038af:	41 5d                	pop    %r13
+  8038b1:	41 5e                	pop    %r14
+  8038b3:	41 5f                	pop    %r15
+  8038b5:	5d                   	pop    %rbp
+  8038b6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8038b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038bc:	4c 89 ee             	mov    %r13,%rsi
+  8038bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c4:	49 bc b8 2b 80 00 00 	movabs $0x802bb8,%r12
+  8038cb:	00 00 00 
+  8038ce:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8038d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038d6:	4c 89 f6             	mov    %r14,%rsi
+  8038d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038de:	41 ff d4             	call   *%r12
+    return res;
+  8038e1:	eb c3                	jmp    8038a6 <dup+0xe6>
+
+00000000008038e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8038e3:	55                   	push   %rbp
+  8038e4:	48 89 e5             	mov    %rsp,%rbp
+  8038e7:	41 56                	push   %r14
+  8038e9:	41 55                	push   %r13
+  8038eb:	41 54                	push   %r12
+  8038ed:	53                   	push   %rbx
+  8038ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8038f2:	89 fb                	mov    %edi,%ebx
+  8038f4:	49 89 f4             	mov    %rsi,%r12
+  8038f7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038fa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038fe:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803905:	00 00 00 
+  803908:	ff d0                	call   *%rax
+  80390a:	85 c0                	test   %eax,%eax
+  80390c:	78 4c                	js     80395a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80390e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803912:	41 8b 3e             	mov    (%r14),%edi
+  803915:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803919:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+  803925:	85 c0                	test   %eax,%eax
+  803927:	78 35                	js     80395e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803929:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80392d:	83 e0 03             	and    $0x3,%eax
+  803930:	83 f8 01             	cmp    $0x1,%eax
+  803933:	74 2d                	je     803962 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803935:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803939:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80393d:	48 85 c0             	test   %rax,%rax
+  803940:	74 56                	je     803998 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803942:	4c 89 ea             	mov    %r13,%rdx
+  803945:	4c 89 e6             	mov    %r12,%rsi
+  803948:	4c 89 f7             	mov    %r14,%rdi
+  80394b:	ff d0                	call   *%rax
+}
+  80394d:	48 83 c4 10          	add    $0x10,%rsp
+  803951:	5b                   	pop    %rbx
+  803952:	41 5c                	pop    %r12
+  803954:	41 5d                	pop    %r13
+  803956:	41 5e                	pop    %r14
+  803958:	5d                   	pop    %rbp
+  803959:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80395a:	48 98                	cltq
+  80395c:	eb ef                	jmp    80394d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80395e:	48 98                	cltq
+  803960:	eb eb                	jmp    80394d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803962:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803969:	00 00 00 
+  80396c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803972:	89 da                	mov    %ebx,%edx
+  803974:	48 bf 31 68 80 00 00 	movabs $0x806831,%rdi
+  80397b:	00 00 00 
+  80397e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803983:	48 b9 44 1a 80 00 00 	movabs $0x801a44,%rcx
+  80398a:	00 00 00 
+  80398d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80398f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803996:	eb b5                	jmp    80394d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803998:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80399f:	eb ac                	jmp    80394d <read+0x6a>
+
+00000000008039a1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8039a1:	55                   	push   %rbp
+  8039a2:	48 89 e5             	mov    %rsp,%rbp
+  8039a5:	41 57                	push   %r15
+  8039a7:	41 56                	push   %r14
+  8039a9:	41 55                	push   %r13
+  8039ab:	41 54                	push   %r12
+  8039ad:	53                   	push   %rbx
+  8039ae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8039b2:	48 85 d2             	test   %rdx,%rdx
+  8039b5:	74 54                	je     803a0b <readn+0x6a>
+  8039b7:	41 89 fd             	mov    %edi,%r13d
+  8039ba:	49 89 f6             	mov    %rsi,%r14
+  8039bd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8039c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8039c5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8039ca:	49 bf e3 38 80 00 00 	movabs $0x8038e3,%r15
+  8039d1:	00 00 00 
+  8039d4:	4c 89 e2             	mov    %r12,%rdx
+  8039d7:	48 29 f2             	sub    %rsi,%rdx
+  8039da:	4c 01 f6             	add    %r14,%rsi
+  8039dd:	44 89 ef             	mov    %r13d,%edi
+  8039e0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8039e3:	85 c0                	test   %eax,%eax
+  8039e5:	78 20                	js     803a07 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8039e7:	01 c3                	add    %eax,%ebx
+  8039e9:	85 c0                	test   %eax,%eax
+  8039eb:	74 08                	je     8039f5 <readn+0x54>
+  8039ed:	48 63 f3             	movslq %ebx,%rsi
+  8039f0:	4c 39 e6             	cmp    %r12,%rsi
+  8039f3:	72 df                	jb     8039d4 <readn+0x33>
+    }
+    return res;
+  8039f5:	48 63 c3             	movslq %ebx,%rax
+}
+  8039f8:	48 83 c4 08          	add    $0x8,%rsp
+  8039fc:	5b                   	pop    %rbx
+  8039fd:	41 5c                	pop    %r12
+  8039ff:	41 5d                	pop    %r13
+  803a01:	41 5e                	pop    %r14
+  803a03:	41 5f                	pop    %r15
+  803a05:	5d                   	pop    %rbp
+  803a06:	c3                   	ret
+        if (inc < 0) return inc;
+  803a07:	48 98                	cltq
+  803a09:	eb ed                	jmp    8039f8 <readn+0x57>
+    int inc = 1, res = 0;
+  803a0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a10:	eb e3                	jmp    8039f5 <readn+0x54>
+
+0000000000803a12 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a12:	55                   	push   %rbp
+  803a13:	48 89 e5             	mov    %rsp,%rbp
+  803a16:	41 56                	push   %r14
+  803a18:	41 55                	push   %r13
+  803a1a:	41 54                	push   %r12
+  803a1c:	53                   	push   %rbx
+  803a1d:	48 83 ec 10          	sub    $0x10,%rsp
+  803a21:	89 fb                	mov    %edi,%ebx
+  803a23:	49 89 f4             	mov    %rsi,%r12
+  803a26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803a2d:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803a34:	00 00 00 
+  803a37:	ff d0                	call   *%rax
+  803a39:	85 c0                	test   %eax,%eax
+  803a3b:	78 47                	js     803a84 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803a41:	41 8b 3e             	mov    (%r14),%edi
+  803a44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803a48:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  803a4f:	00 00 00 
+  803a52:	ff d0                	call   *%rax
+  803a54:	85 c0                	test   %eax,%eax
+  803a56:	78 30                	js     803a88 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a58:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803a5d:	74 2d                	je     803a8c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803a5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803a67:	48 85 c0             	test   %rax,%rax
+  803a6a:	74 56                	je     803ac2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803a6c:	4c 89 ea             	mov    %r13,%rdx
+  803a6f:	4c 89 e6             	mov    %r12,%rsi
+  803a72:	4c 89 f7             	mov    %r14,%rdi
+  803a75:	ff d0                	call   *%rax
+}
+  803a77:	48 83 c4 10          	add    $0x10,%rsp
+  803a7b:	5b                   	pop    %rbx
+  803a7c:	41 5c                	pop    %r12
+  803a7e:	41 5d                	pop    %r13
+  803a80:	41 5e                	pop    %r14
+  803a82:	5d                   	pop    %rbp
+  803a83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803a84:	48 98                	cltq
+  803a86:	eb ef                	jmp    803a77 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803a88:	48 98                	cltq
+  803a8a:	eb eb                	jmp    803a77 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a8c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803a93:	00 00 00 
+  803a96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803a9c:	89 da                	mov    %ebx,%edx
+  803a9e:	48 bf 4d 68 80 00 00 	movabs $0x80684d,%rdi
+  803aa5:	00 00 00 
+  803aa8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aad:	48 b9 44 1a 80 00 00 	movabs $0x801a44,%rcx
+  803ab4:	00 00 00 
+  803ab7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803ab9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ac0:	eb b5                	jmp    803a77 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803ac2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803ac9:	eb ac                	jmp    803a77 <write+0x65>
+
+0000000000803acb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803acb:	55                   	push   %rbp
+  803acc:	48 89 e5             	mov    %rsp,%rbp
+  803acf:	53                   	push   %rbx
+  803ad0:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ad6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803ada:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803ae1:	00 00 00 
+  803ae4:	ff d0                	call   *%rax
+  803ae6:	85 c0                	test   %eax,%eax
+  803ae8:	78 0c                	js     803af6 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803aea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803aee:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803af1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803af6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803afa:	c9                   	leave
+  803afb:	c3                   	ret
+
+0000000000803afc <tell>:
+
+int tell(int fdnum) {
+  803afc:	55                   	push   %rbp
+  803afd:	48 89 e5             	mov    %rsp,%rbp
+  803b00:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b04:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b08:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803b0f:	00 00 00 
+  803b12:	ff d0                	call   *%rax
+  803b14:	85 c0                	test   %eax,%eax
+  803b16:	78 07                	js     803b1f <tell+0x23>
+
+    return fd->fd_offset;
+  803b18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b1c:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803b1f:	c9                   	leave
+  803b20:	c3                   	ret
+
+0000000000803b21 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b21:	55                   	push   %rbp
+  803b22:	48 89 e5             	mov    %rsp,%rbp
+  803b25:	41 55                	push   %r13
+  803b27:	41 54                	push   %r12
+  803b29:	53                   	push   %rbx
+  803b2a:	48 83 ec 18          	sub    $0x18,%rsp
+  803b2e:	89 fb                	mov    %edi,%ebx
+  803b30:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b33:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b37:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803b3e:	00 00 00 
+  803b41:	ff d0                	call   *%rax
+  803b43:	85 c0                	test   %eax,%eax
+  803b45:	78 38                	js     803b7f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803b47:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803b4b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803b4f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803b53:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  803b5a:	00 00 00 
+  803b5d:	ff d0                	call   *%rax
+  803b5f:	85 c0                	test   %eax,%eax
+  803b61:	78 1c                	js     803b7f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b63:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803b68:	74 20                	je     803b8a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803b6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b6e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803b72:	48 85 c0             	test   %rax,%rax
+  803b75:	74 47                	je     803bbe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803b77:	44 89 e6             	mov    %r12d,%esi
+  803b7a:	4c 89 ef             	mov    %r13,%rdi
+  803b7d:	ff d0                	call   *%rax
+}
+  803b7f:	48 83 c4 18          	add    $0x18,%rsp
+  803b83:	5b                   	pop    %rbx
+  803b84:	41 5c                	pop    %r12
+  803b86:	41 5d                	pop    %r13
+  803b88:	5d                   	pop    %rbp
+  803b89:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803b8a:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803b91:	00 00 00 
+  803b94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803b9a:	89 da                	mov    %ebx,%edx
+  803b9c:	48 bf 10 68 80 00 00 	movabs $0x806810,%rdi
+  803ba3:	00 00 00 
+  803ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bab:	48 b9 44 1a 80 00 00 	movabs $0x801a44,%rcx
+  803bb2:	00 00 00 
+  803bb5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803bb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bbc:	eb c1                	jmp    803b7f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803bbe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803bc3:	eb ba                	jmp    803b7f <ftruncate+0x5e>
+
+0000000000803bc5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803bc5:	55                   	push   %rbp
+  803bc6:	48 89 e5             	mov    %rsp,%rbp
+  803bc9:	41 54                	push   %r12
+  803bcb:	53                   	push   %rbx
+  803bcc:	48 83 ec 10          	sub    $0x10,%rsp
+  803bd0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803bd3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803bd7:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  803bde:	00 00 00 
+  803be1:	ff d0                	call   *%rax
+  803be3:	85 c0                	test   %eax,%eax
+  803be5:	78 63                	js     803c4a <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803be7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803beb:	41 8b 3c 24          	mov    (%r12),%edi
+  803bef:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803bf3:	48 b8 4b 36 80 00 00 	movabs $0x80364b,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+  803bff:	85 c0                	test   %eax,%eax
+  803c01:	78 47                	js     803c4a <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803c03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c07:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803c0c:	74 45                	je     803c53 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803c0e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803c11:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803c18:	00 00 00 
+    stat->st_isdir = 0;
+  803c1b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c22:	00 00 00 
+    stat->st_ino = 0;
+  803c25:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803c2c:	00 00 00 00 
+    stat->st_version = 0;
+  803c30:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803c37:	00 00 00 
+    stat->st_dev = dev;
+  803c3a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803c41:	48 89 de             	mov    %rbx,%rsi
+  803c44:	4c 89 e7             	mov    %r12,%rdi
+  803c47:	ff 50 28             	call   *0x28(%rax)
+}
+  803c4a:	48 83 c4 10          	add    $0x10,%rsp
+  803c4e:	5b                   	pop    %rbx
+  803c4f:	41 5c                	pop    %r12
+  803c51:	5d                   	pop    %rbp
+  803c52:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803c53:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c58:	eb f0                	jmp    803c4a <fstat+0x85>
+
+0000000000803c5a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803c5a:	55                   	push   %rbp
+  803c5b:	48 89 e5             	mov    %rsp,%rbp
+  803c5e:	41 54                	push   %r12
+  803c60:	53                   	push   %rbx
+  803c61:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803c64:	be 00 00 00 00       	mov    $0x0,%esi
+  803c69:	48 b8 7b 41 80 00 00 	movabs $0x80417b,%rax
+  803c70:	00 00 00 
+  803c73:	ff d0                	call   *%rax
+  803c75:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	78 25                	js     803ca0 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803c7b:	4c 89 e6             	mov    %r12,%rsi
+  803c7e:	89 c7                	mov    %eax,%edi
+  803c80:	48 b8 c5 3b 80 00 00 	movabs $0x803bc5,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+  803c8c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803c8f:	89 df                	mov    %ebx,%edi
+  803c91:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  803c98:	00 00 00 
+  803c9b:	ff d0                	call   *%rax
+
+    return res;
+  803c9d:	44 89 e3             	mov    %r12d,%ebx
+}
+  803ca0:	89 d8                	mov    %ebx,%eax
+  803ca2:	5b                   	pop    %rbx
+  803ca3:	41 5c                	pop    %r12
+  803ca5:	5d                   	pop    %rbp
+  803ca6:	c3                   	ret
+
+0000000000803ca7 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803ca7:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803cae:	00 00 00 
+  803cb1:	83 38 00             	cmpl   $0x0,(%rax)
+  803cb4:	74 0a                	je     803cc0 <fsipc_env+0x19>
+    return fsenv;
+}
+  803cb6:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803cbd:	00 00 
+  803cbf:	c3                   	ret
+fsipc_env(void) {
+  803cc0:	55                   	push   %rbp
+  803cc1:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803cc4:	bf 03 00 00 00       	mov    $0x3,%edi
+  803cc9:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803cd0:	00 00 00 
+  803cd3:	ff d0                	call   *%rax
+  803cd5:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803cdc:	00 00 
+}
+  803cde:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803ce5:	00 00 
+  803ce7:	5d                   	pop    %rbp
+  803ce8:	c3                   	ret
+
+0000000000803ce9 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803ce9:	55                   	push   %rbp
+  803cea:	48 89 e5             	mov    %rsp,%rbp
+  803ced:	53                   	push   %rbx
+  803cee:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803cf2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803cf9:	00 
+  803cfa:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803d01:	00 
+  803d02:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803d09:	00 
+  803d0a:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803d11:	00 
+  803d12:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803d19:	00 
+
+    assert(size <= sizeof(words));
+  803d1a:	48 83 fa 28          	cmp    $0x28,%rdx
+  803d1e:	77 38                	ja     803d58 <fsipc_short+0x6f>
+  803d20:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803d22:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803d26:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  803d2d:	00 00 00 
+  803d30:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803d32:	48 b8 a7 3c 80 00 00 	movabs $0x803ca7,%rax
+  803d39:	00 00 00 
+  803d3c:	ff d0                	call   *%rax
+  803d3e:	89 c7                	mov    %eax,%edi
+  803d40:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803d44:	89 de                	mov    %ebx,%esi
+  803d46:	48 b8 85 34 80 00 00 	movabs $0x803485,%rax
+  803d4d:	00 00 00 
+  803d50:	ff d0                	call   *%rax
+}
+  803d52:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803d56:	c9                   	leave
+  803d57:	c3                   	ret
+    assert(size <= sizeof(words));
+  803d58:	48 b9 a0 68 80 00 00 	movabs $0x8068a0,%rcx
+  803d5f:	00 00 00 
+  803d62:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803d69:	00 00 00 
+  803d6c:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803d71:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803d78:	00 00 00 
+  803d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d80:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  803d87:	00 00 00 
+  803d8a:	41 ff d0             	call   *%r8
+
+0000000000803d8d <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803d8d:	55                   	push   %rbp
+  803d8e:	48 89 e5             	mov    %rsp,%rbp
+  803d91:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803d95:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803d98:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803d9b:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803d9e:	ba 08 00 00 00       	mov    $0x8,%edx
+  803da3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803da7:	bf 02 00 00 00       	mov    $0x2,%edi
+  803dac:	48 b8 e9 3c 80 00 00 	movabs $0x803ce9,%rax
+  803db3:	00 00 00 
+  803db6:	ff d0                	call   *%rax
+}
+  803db8:	c9                   	leave
+  803db9:	c3                   	ret
+
+0000000000803dba <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803dba:	55                   	push   %rbp
+  803dbb:	48 89 e5             	mov    %rsp,%rbp
+  803dbe:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803dc2:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803dc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803dc8:	ba 04 00 00 00       	mov    $0x4,%edx
+  803dcd:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803dd1:	bf 06 00 00 00       	mov    $0x6,%edi
+  803dd6:	48 b8 e9 3c 80 00 00 	movabs $0x803ce9,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+}
+  803de2:	c9                   	leave
+  803de3:	c3                   	ret
+
+0000000000803de4 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803de4:	55                   	push   %rbp
+  803de5:	48 89 e5             	mov    %rsp,%rbp
+  803de8:	41 54                	push   %r12
+  803dea:	53                   	push   %rbx
+  803deb:	48 83 ec 10          	sub    $0x10,%rsp
+  803def:	89 fb                	mov    %edi,%ebx
+  803df1:	49 89 f4             	mov    %rsi,%r12
+  803df4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803df8:	48 b8 a7 3c 80 00 00 	movabs $0x803ca7,%rax
+  803dff:	00 00 00 
+  803e02:	ff d0                	call   *%rax
+  803e04:	89 c7                	mov    %eax,%edi
+  803e06:	6a 00                	push   $0x0
+  803e08:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803e0c:	50                   	push   %rax
+  803e0d:	4d 89 e1             	mov    %r12,%r9
+  803e10:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803e16:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e1b:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803e22:	00 00 00 
+  803e25:	89 de                	mov    %ebx,%esi
+  803e27:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803e2e:	00 00 00 
+  803e31:	ff d0                	call   *%rax
+}
+  803e33:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803e37:	5b                   	pop    %rbx
+  803e38:	41 5c                	pop    %r12
+  803e3a:	5d                   	pop    %rbp
+  803e3b:	c3                   	ret
+
+0000000000803e3c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803e3c:	55                   	push   %rbp
+  803e3d:	48 89 e5             	mov    %rsp,%rbp
+  803e40:	41 54                	push   %r12
+  803e42:	53                   	push   %rbx
+  803e43:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803e46:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803e49:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803e50:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e57:	be 00 00 00 00       	mov    $0x0,%esi
+  803e5c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803e61:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  803e68:	00 00 00 
+  803e6b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e6d:	85 c0                	test   %eax,%eax
+  803e6f:	78 5a                	js     803ecb <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803e71:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803e78:	00 00 00 
+  803e7b:	4c 89 e6             	mov    %r12,%rsi
+  803e7e:	48 89 df             	mov    %rbx,%rdi
+  803e81:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  803e88:	00 00 00 
+  803e8b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803e8d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803e94:	00 
+  803e95:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803e9b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803ea2:	00 
+  803ea3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803ea9:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803eb0:	00 
+  803eb1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803eb8:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803ebf:	00 
+  803ec0:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ecb:	5b                   	pop    %rbx
+  803ecc:	41 5c                	pop    %r12
+  803ece:	5d                   	pop    %rbp
+  803ecf:	c3                   	ret
+
+0000000000803ed0 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803ed0:	55                   	push   %rbp
+  803ed1:	48 89 e5             	mov    %rsp,%rbp
+  803ed4:	41 57                	push   %r15
+  803ed6:	41 56                	push   %r14
+  803ed8:	41 55                	push   %r13
+  803eda:	41 54                	push   %r12
+  803edc:	53                   	push   %rbx
+  803edd:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803ee1:	48 85 ff             	test   %rdi,%rdi
+  803ee4:	0f 84 a1 00 00 00    	je     803f8b <devfile_read+0xbb>
+  803eea:	49 89 ff             	mov    %rdi,%r15
+  803eed:	49 89 f5             	mov    %rsi,%r13
+  803ef0:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803ef3:	48 85 f6             	test   %rsi,%rsi
+  803ef6:	0f 84 c4 00 00 00    	je     803fc0 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803efc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803f03:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803f04:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803f0b:	00 00 00 
+  803f0e:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803f12:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803f15:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803f19:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  803f23:	bf 03 00 00 00       	mov    $0x3,%edi
+  803f28:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  803f2f:	00 00 00 
+  803f32:	ff d0                	call   *%rax
+        if (res < 0) {
+  803f34:	85 c0                	test   %eax,%eax
+  803f36:	0f 88 b9 00 00 00    	js     803ff5 <devfile_read+0x125>
+        assert(res <= n);
+  803f3c:	48 63 d8             	movslq %eax,%rbx
+  803f3f:	49 39 dc             	cmp    %rbx,%r12
+  803f42:	0f 82 b1 00 00 00    	jb     803ff9 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803f48:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803f4d:	0f 87 db 00 00 00    	ja     80402e <devfile_read+0x15e>
+        if (!res) {
+  803f53:	85 c0                	test   %eax,%eax
+  803f55:	74 21                	je     803f78 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803f57:	48 89 da             	mov    %rbx,%rdx
+  803f5a:	4c 89 f6             	mov    %r14,%rsi
+  803f5d:	4c 89 ef             	mov    %r13,%rdi
+  803f60:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  803f67:	00 00 00 
+  803f6a:	ff d0                	call   *%rax
+        total_read += res;
+  803f6c:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803f70:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803f73:	49 29 dc             	sub    %rbx,%r12
+  803f76:	75 96                	jne    803f0e <devfile_read+0x3e>
+    return total_read;
+  803f78:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803f7c:	48 83 c4 18          	add    $0x18,%rsp
+  803f80:	5b                   	pop    %rbx
+  803f81:	41 5c                	pop    %r12
+  803f83:	41 5d                	pop    %r13
+  803f85:	41 5e                	pop    %r14
+  803f87:	41 5f                	pop    %r15
+  803f89:	5d                   	pop    %rbp
+  803f8a:	c3                   	ret
+    assert(fd);
+  803f8b:	48 b9 d6 68 80 00 00 	movabs $0x8068d6,%rcx
+  803f92:	00 00 00 
+  803f95:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803f9c:	00 00 00 
+  803f9f:	be 91 00 00 00       	mov    $0x91,%esi
+  803fa4:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803fab:	00 00 00 
+  803fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb3:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  803fba:	00 00 00 
+  803fbd:	41 ff d0             	call   *%r8
+    assert(buf);
+  803fc0:	48 b9 d9 68 80 00 00 	movabs $0x8068d9,%rcx
+  803fc7:	00 00 00 
+  803fca:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  803fd1:	00 00 00 
+  803fd4:	be 92 00 00 00       	mov    $0x92,%esi
+  803fd9:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  803fe0:	00 00 00 
+  803fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe8:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  803fef:	00 00 00 
+  803ff2:	41 ff d0             	call   *%r8
+            return res;
+  803ff5:	48 98                	cltq
+  803ff7:	eb 83                	jmp    803f7c <devfile_read+0xac>
+        assert(res <= n);
+  803ff9:	48 b9 dd 68 80 00 00 	movabs $0x8068dd,%rcx
+  804000:	00 00 00 
+  804003:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  80400a:	00 00 00 
+  80400d:	be 9e 00 00 00       	mov    $0x9e,%esi
+  804012:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  804019:	00 00 00 
+  80401c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804021:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  804028:	00 00 00 
+  80402b:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80402e:	48 b9 e8 68 80 00 00 	movabs $0x8068e8,%rcx
+  804035:	00 00 00 
+  804038:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  80403f:	00 00 00 
+  804042:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804047:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  80404e:	00 00 00 
+  804051:	b8 00 00 00 00       	mov    $0x0,%eax
+  804056:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  80405d:	00 00 00 
+  804060:	41 ff d0             	call   *%r8
+
+0000000000804063 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804063:	55                   	push   %rbp
+  804064:	48 89 e5             	mov    %rsp,%rbp
+  804067:	41 57                	push   %r15
+  804069:	41 56                	push   %r14
+  80406b:	41 55                	push   %r13
+  80406d:	41 54                	push   %r12
+  80406f:	53                   	push   %rbx
+  804070:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  804074:	48 85 ff             	test   %rdi,%rdi
+  804077:	0f 84 83 00 00 00    	je     804100 <devfile_write+0x9d>
+  80407d:	49 89 ff             	mov    %rdi,%r15
+  804080:	49 89 f4             	mov    %rsi,%r12
+  804083:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  804086:	48 85 f6             	test   %rsi,%rsi
+  804089:	0f 84 a6 00 00 00    	je     804135 <devfile_write+0xd2>
+    size_t total_written = 0;
+  80408f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804095:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  80409c:	00 00 00 
+  80409f:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8040a3:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  8040a6:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  8040aa:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  8040af:	48 39 d3             	cmp    %rdx,%rbx
+  8040b2:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  8040b6:	4c 89 e6             	mov    %r12,%rsi
+  8040b9:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  8040c0:	00 00 00 
+  8040c3:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  8040ca:	00 00 00 
+  8040cd:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8040cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8040d9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8040de:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  8040e5:	00 00 00 
+  8040e8:	ff d0                	call   *%rax
+        if (res < 0) {
+  8040ea:	85 c0                	test   %eax,%eax
+  8040ec:	78 7c                	js     80416a <devfile_write+0x107>
+        total_written += res;
+  8040ee:	48 98                	cltq
+  8040f0:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8040f3:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8040f6:	48 29 c3             	sub    %rax,%rbx
+  8040f9:	75 a4                	jne    80409f <devfile_write+0x3c>
+    return total_written;
+  8040fb:	4c 89 e8             	mov    %r13,%rax
+  8040fe:	eb 6c                	jmp    80416c <devfile_write+0x109>
+    assert(fd);
+  804100:	48 b9 d6 68 80 00 00 	movabs $0x8068d6,%rcx
+  804107:	00 00 00 
+  80410a:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804111:	00 00 00 
+  804114:	be bd 00 00 00       	mov    $0xbd,%esi
+  804119:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  804120:	00 00 00 
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+  804128:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  80412f:	00 00 00 
+  804132:	41 ff d0             	call   *%r8
+    assert(buf);
+  804135:	48 b9 d9 68 80 00 00 	movabs $0x8068d9,%rcx
+  80413c:	00 00 00 
+  80413f:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804146:	00 00 00 
+  804149:	be be 00 00 00       	mov    $0xbe,%esi
+  80414e:	48 bf cb 68 80 00 00 	movabs $0x8068cb,%rdi
+  804155:	00 00 00 
+  804158:	b8 00 00 00 00       	mov    $0x0,%eax
+  80415d:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  804164:	00 00 00 
+  804167:	41 ff d0             	call   *%r8
+            return res;
+  80416a:	48 98                	cltq
+}
+  80416c:	48 83 c4 08          	add    $0x8,%rsp
+  804170:	5b                   	pop    %rbx
+  804171:	41 5c                	pop    %r12
+  804173:	41 5d                	pop    %r13
+  804175:	41 5e                	pop    %r14
+  804177:	41 5f                	pop    %r15
+  804179:	5d                   	pop    %rbp
+  80417a:	c3                   	ret
+
+000000000080417b <open>:
+open(const char *path, int mode) {
+  80417b:	55                   	push   %rbp
+  80417c:	48 89 e5             	mov    %rsp,%rbp
+  80417f:	41 55                	push   %r13
+  804181:	41 54                	push   %r12
+  804183:	53                   	push   %rbx
+  804184:	48 83 ec 18          	sub    $0x18,%rsp
+  804188:	49 89 fc             	mov    %rdi,%r12
+  80418b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80418e:	48 b8 3d 23 80 00 00 	movabs $0x80233d,%rax
+  804195:	00 00 00 
+  804198:	ff d0                	call   *%rax
+  80419a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8041a0:	0f 87 8f 00 00 00    	ja     804235 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8041a6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8041aa:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  8041b1:	00 00 00 
+  8041b4:	ff d0                	call   *%rax
+  8041b6:	89 c3                	mov    %eax,%ebx
+  8041b8:	85 c0                	test   %eax,%eax
+  8041ba:	78 55                	js     804211 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8041bc:	4c 89 e6             	mov    %r12,%rsi
+  8041bf:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  8041c6:	00 00 00 
+  8041c9:	48 89 df             	mov    %rbx,%rdi
+  8041cc:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8041d8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8041df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041e4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8041e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041ed:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  8041f4:	00 00 00 
+  8041f7:	ff d0                	call   *%rax
+  8041f9:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8041fb:	85 c0                	test   %eax,%eax
+  8041fd:	78 1f                	js     80421e <open+0xa3>
+    return fd2num(fd);
+  8041ff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804203:	48 b8 72 35 80 00 00 	movabs $0x803572,%rax
+  80420a:	00 00 00 
+  80420d:	ff d0                	call   *%rax
+  80420f:	89 c3                	mov    %eax,%ebx
+}
+  804211:	89 d8                	mov    %ebx,%eax
+  804213:	48 83 c4 18          	add    $0x18,%rsp
+  804217:	5b                   	pop    %rbx
+  804218:	41 5c                	pop    %r12
+  80421a:	41 5d                	pop    %r13
+  80421c:	5d                   	pop    %rbp
+  80421d:	c3                   	ret
+        fd_close(fd, 0);
+  80421e:	be 00 00 00 00       	mov    $0x0,%esi
+  804223:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804227:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  80422e:	00 00 00 
+  804231:	ff d0                	call   *%rax
+        return res;
+  804233:	eb dc                	jmp    804211 <open+0x96>
+        return -E_BAD_PATH;
+  804235:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80423a:	eb d5                	jmp    804211 <open+0x96>
+
+000000000080423c <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  80423c:	55                   	push   %rbp
+  80423d:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  804240:	ba 00 00 00 00       	mov    $0x0,%edx
+  804245:	be 00 00 00 00       	mov    $0x0,%esi
+  80424a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80424f:	48 b8 e9 3c 80 00 00 	movabs $0x803ce9,%rax
+  804256:	00 00 00 
+  804259:	ff d0                	call   *%rax
+}
+  80425b:	5d                   	pop    %rbp
+  80425c:	c3                   	ret
+
+000000000080425d <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  80425d:	55                   	push   %rbp
+  80425e:	48 89 e5             	mov    %rsp,%rbp
+  804261:	41 56                	push   %r14
+  804263:	41 55                	push   %r13
+  804265:	41 54                	push   %r12
+  804267:	53                   	push   %rbx
+  804268:	48 83 ec 10          	sub    $0x10,%rsp
+  80426c:	41 89 f6             	mov    %esi,%r14d
+  80426f:	49 89 d4             	mov    %rdx,%r12
+  804272:	48 89 cb             	mov    %rcx,%rbx
+  804275:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804278:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80427c:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  804283:	00 00 00 
+  804286:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804288:	85 c0                	test   %eax,%eax
+  80428a:	78 46                	js     8042d2 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80428c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804290:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  804297:	00 00 00 
+  80429a:	8b 00                	mov    (%rax),%eax
+  80429c:	39 02                	cmp    %eax,(%rdx)
+  80429e:	75 3f                	jne    8042df <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8042a0:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  8042a7:	00 00 00 
+  8042aa:	8b 52 0c             	mov    0xc(%rdx),%edx
+  8042ad:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  8042af:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  8042b3:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  8042b7:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  8042bb:	48 89 da             	mov    %rbx,%rdx
+  8042be:	4c 89 e6             	mov    %r12,%rsi
+  8042c1:	bf 09 00 00 00       	mov    $0x9,%edi
+  8042c6:	48 b8 e4 3d 80 00 00 	movabs $0x803de4,%rax
+  8042cd:	00 00 00 
+  8042d0:	ff d0                	call   *%rax
+}
+  8042d2:	48 83 c4 10          	add    $0x10,%rsp
+  8042d6:	5b                   	pop    %rbx
+  8042d7:	41 5c                	pop    %r12
+  8042d9:	41 5d                	pop    %r13
+  8042db:	41 5e                	pop    %r14
+  8042dd:	5d                   	pop    %rbp
+  8042de:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8042df:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8042e4:	eb ec                	jmp    8042d2 <file_map+0x75>
+
+00000000008042e6 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  8042e6:	55                   	push   %rbp
+  8042e7:	48 89 e5             	mov    %rsp,%rbp
+  8042ea:	41 54                	push   %r12
+  8042ec:	53                   	push   %rbx
+  8042ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8042f1:	41 89 f4             	mov    %esi,%r12d
+  8042f4:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8042f7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8042fb:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  804302:	00 00 00 
+  804305:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804307:	85 c0                	test   %eax,%eax
+  804309:	78 3c                	js     804347 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80430b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80430f:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  804316:	00 00 00 
+  804319:	8b 0a                	mov    (%rdx),%ecx
+  80431b:	39 08                	cmp    %ecx,(%rax)
+  80431d:	75 31                	jne    804350 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  80431f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804322:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804325:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804329:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  80432d:	ba 10 00 00 00       	mov    $0x10,%edx
+  804332:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804336:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80433b:	48 b8 e9 3c 80 00 00 	movabs $0x803ce9,%rax
+  804342:	00 00 00 
+  804345:	ff d0                	call   *%rax
+}
+  804347:	48 83 c4 20          	add    $0x20,%rsp
+  80434b:	5b                   	pop    %rbx
+  80434c:	41 5c                	pop    %r12
+  80434e:	5d                   	pop    %rbp
+  80434f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804350:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804355:	eb f0                	jmp    804347 <file_msync+0x61>
+
+0000000000804357 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804357:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80435b:	7f 01                	jg     80435e <writebuf+0x7>
+  80435d:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80435e:	55                   	push   %rbp
+  80435f:	48 89 e5             	mov    %rsp,%rbp
+  804362:	53                   	push   %rbx
+  804363:	48 83 ec 08          	sub    $0x8,%rsp
+  804367:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80436a:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80436e:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  804372:	8b 3f                	mov    (%rdi),%edi
+  804374:	48 b8 12 3a 80 00 00 	movabs $0x803a12,%rax
+  80437b:	00 00 00 
+  80437e:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804380:	48 85 c0             	test   %rax,%rax
+  804383:	7e 04                	jle    804389 <writebuf+0x32>
+  804385:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804389:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  80438d:	48 39 c2             	cmp    %rax,%rdx
+  804390:	74 0f                	je     8043a1 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  804392:	48 85 c0             	test   %rax,%rax
+  804395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80439a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80439e:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8043a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043a5:	c9                   	leave
+  8043a6:	c3                   	ret
+
+00000000008043a7 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8043a7:	8b 46 04             	mov    0x4(%rsi),%eax
+  8043aa:	8d 50 01             	lea    0x1(%rax),%edx
+  8043ad:	89 56 04             	mov    %edx,0x4(%rsi)
+  8043b0:	48 98                	cltq
+  8043b2:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8043b7:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8043bd:	74 01                	je     8043c0 <putch+0x19>
+  8043bf:	c3                   	ret
+putch(int ch, void *arg) {
+  8043c0:	55                   	push   %rbp
+  8043c1:	48 89 e5             	mov    %rsp,%rbp
+  8043c4:	53                   	push   %rbx
+  8043c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8043c9:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8043cc:	48 89 f7             	mov    %rsi,%rdi
+  8043cf:	48 b8 57 43 80 00 00 	movabs $0x804357,%rax
+  8043d6:	00 00 00 
+  8043d9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8043db:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8043e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043e6:	c9                   	leave
+  8043e7:	c3                   	ret
+
+00000000008043e8 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8043e8:	55                   	push   %rbp
+  8043e9:	48 89 e5             	mov    %rsp,%rbp
+  8043ec:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8043f3:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8043f6:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8043fc:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804403:	00 00 00 
+    state.result = 0;
+  804406:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80440d:	00 00 00 00 
+    state.error = 1;
+  804411:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804418:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80441b:	48 89 f2             	mov    %rsi,%rdx
+  80441e:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804425:	48 bf a7 43 80 00 00 	movabs $0x8043a7,%rdi
+  80442c:	00 00 00 
+  80442f:	48 b8 94 1b 80 00 00 	movabs $0x801b94,%rax
+  804436:	00 00 00 
+  804439:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80443b:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804442:	7f 14                	jg     804458 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804444:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80444b:	48 85 c0             	test   %rax,%rax
+  80444e:	75 06                	jne    804456 <vfprintf+0x6e>
+  804450:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804456:	c9                   	leave
+  804457:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804458:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80445f:	48 b8 57 43 80 00 00 	movabs $0x804357,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+  80446b:	eb d7                	jmp    804444 <vfprintf+0x5c>
+
+000000000080446d <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  80446d:	55                   	push   %rbp
+  80446e:	48 89 e5             	mov    %rsp,%rbp
+  804471:	48 83 ec 50          	sub    $0x50,%rsp
+  804475:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804479:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80447d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804481:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804485:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80448c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804490:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804494:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804498:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  80449c:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8044a0:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  8044a7:	00 00 00 
+  8044aa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8044ac:	c9                   	leave
+  8044ad:	c3                   	ret
+
+00000000008044ae <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8044ae:	55                   	push   %rbp
+  8044af:	48 89 e5             	mov    %rsp,%rbp
+  8044b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8044b6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8044ba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8044be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8044c2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8044c6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8044ca:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8044d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8044dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8044e1:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8044e5:	48 89 fe             	mov    %rdi,%rsi
+  8044e8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8044ed:	48 b8 e8 43 80 00 00 	movabs $0x8043e8,%rax
+  8044f4:	00 00 00 
+  8044f7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8044f9:	c9                   	leave
+  8044fa:	c3                   	ret
+
+00000000008044fb <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8044fb:	55                   	push   %rbp
+  8044fc:	48 89 e5             	mov    %rsp,%rbp
+  8044ff:	41 54                	push   %r12
+  804501:	53                   	push   %rbx
+  804502:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804505:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  80450c:	00 00 00 
+  80450f:	ff d0                	call   *%rax
+  804511:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804514:	48 be 10 69 80 00 00 	movabs $0x806910,%rsi
+  80451b:	00 00 00 
+  80451e:	48 89 df             	mov    %rbx,%rdi
+  804521:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80452d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804532:	41 2b 04 24          	sub    (%r12),%eax
+  804536:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80453c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804543:	00 00 00 
+    stat->st_dev = &devpipe;
+  804546:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80454d:	00 00 00 
+  804550:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455c:	5b                   	pop    %rbx
+  80455d:	41 5c                	pop    %r12
+  80455f:	5d                   	pop    %rbp
+  804560:	c3                   	ret
+
+0000000000804561 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804561:	55                   	push   %rbp
+  804562:	48 89 e5             	mov    %rsp,%rbp
+  804565:	41 54                	push   %r12
+  804567:	53                   	push   %rbx
+  804568:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80456b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804570:	48 89 fe             	mov    %rdi,%rsi
+  804573:	bf 00 00 00 00       	mov    $0x0,%edi
+  804578:	49 bc b8 2b 80 00 00 	movabs $0x802bb8,%r12
+  80457f:	00 00 00 
+  804582:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804585:	48 89 df             	mov    %rbx,%rdi
+  804588:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  80458f:	00 00 00 
+  804592:	ff d0                	call   *%rax
+  804594:	48 89 c6             	mov    %rax,%rsi
+  804597:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80459c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045a1:	41 ff d4             	call   *%r12
+}
+  8045a4:	5b                   	pop    %rbx
+  8045a5:	41 5c                	pop    %r12
+  8045a7:	5d                   	pop    %rbp
+  8045a8:	c3                   	ret
+
+00000000008045a9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8045a9:	55                   	push   %rbp
+  8045aa:	48 89 e5             	mov    %rsp,%rbp
+  8045ad:	41 57                	push   %r15
+  8045af:	41 56                	push   %r14
+  8045b1:	41 55                	push   %r13
+  8045b3:	41 54                	push   %r12
+  8045b5:	53                   	push   %rbx
+  8045b6:	48 83 ec 18          	sub    $0x18,%rsp
+  8045ba:	49 89 fc             	mov    %rdi,%r12
+  8045bd:	49 89 f5             	mov    %rsi,%r13
+  8045c0:	49 89 d7             	mov    %rdx,%r15
+  8045c3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8045c7:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  8045ce:	00 00 00 
+  8045d1:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8045d3:	4d 85 ff             	test   %r15,%r15
+  8045d6:	0f 84 af 00 00 00    	je     80468b <devpipe_write+0xe2>
+  8045dc:	48 89 c3             	mov    %rax,%rbx
+  8045df:	4c 89 f8             	mov    %r15,%rax
+  8045e2:	4d 89 ef             	mov    %r13,%r15
+  8045e5:	4c 01 e8             	add    %r13,%rax
+  8045e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8045ec:	49 bd ae 2a 80 00 00 	movabs $0x802aae,%r13
+  8045f3:	00 00 00 
+            sys_yield();
+  8045f6:	49 be 3f 2a 80 00 00 	movabs $0x802a3f,%r14
+  8045fd:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804600:	8b 73 04             	mov    0x4(%rbx),%esi
+  804603:	48 63 ce             	movslq %esi,%rcx
+  804606:	48 63 03             	movslq (%rbx),%rax
+  804609:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80460f:	48 39 c1             	cmp    %rax,%rcx
+  804612:	72 2e                	jb     804642 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804614:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804619:	48 89 da             	mov    %rbx,%rdx
+  80461c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804621:	4c 89 e7             	mov    %r12,%rdi
+  804624:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804627:	85 c0                	test   %eax,%eax
+  804629:	74 66                	je     804691 <devpipe_write+0xe8>
+            sys_yield();
+  80462b:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80462e:	8b 73 04             	mov    0x4(%rbx),%esi
+  804631:	48 63 ce             	movslq %esi,%rcx
+  804634:	48 63 03             	movslq (%rbx),%rax
+  804637:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80463d:	48 39 c1             	cmp    %rax,%rcx
+  804640:	73 d2                	jae    804614 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804642:	41 0f b6 3f          	movzbl (%r15),%edi
+  804646:	48 89 ca             	mov    %rcx,%rdx
+  804649:	48 c1 ea 03          	shr    $0x3,%rdx
+  80464d:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804654:	08 10 20 
+  804657:	48 f7 e2             	mul    %rdx
+  80465a:	48 c1 ea 06          	shr    $0x6,%rdx
+  80465e:	48 89 d0             	mov    %rdx,%rax
+  804661:	48 c1 e0 09          	shl    $0x9,%rax
+  804665:	48 29 d0             	sub    %rdx,%rax
+  804668:	48 c1 e0 03          	shl    $0x3,%rax
+  80466c:	48 29 c1             	sub    %rax,%rcx
+  80466f:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804674:	83 c6 01             	add    $0x1,%esi
+  804677:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80467a:	49 83 c7 01          	add    $0x1,%r15
+  80467e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804682:	49 39 c7             	cmp    %rax,%r15
+  804685:	0f 85 75 ff ff ff    	jne    804600 <devpipe_write+0x57>
+    return n;
+  80468b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80468f:	eb 05                	jmp    804696 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804696:	48 83 c4 18          	add    $0x18,%rsp
+  80469a:	5b                   	pop    %rbx
+  80469b:	41 5c                	pop    %r12
+  80469d:	41 5d                	pop    %r13
+  80469f:	41 5e                	pop    %r14
+  8046a1:	41 5f                	pop    %r15
+  8046a3:	5d                   	pop    %rbp
+  8046a4:	c3                   	ret
+
+00000000008046a5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046a5:	55                   	push   %rbp
+  8046a6:	48 89 e5             	mov    %rsp,%rbp
+  8046a9:	41 57                	push   %r15
+  8046ab:	41 56                	push   %r14
+  8046ad:	41 55                	push   %r13
+  8046af:	41 54                	push   %r12
+  8046b1:	53                   	push   %rbx
+  8046b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8046b6:	49 89 fc             	mov    %rdi,%r12
+  8046b9:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8046bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046c1:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  8046c8:	00 00 00 
+  8046cb:	ff d0                	call   *%rax
+  8046cd:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046d0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046d6:	49 bd ae 2a 80 00 00 	movabs $0x802aae,%r13
+  8046dd:	00 00 00 
+            sys_yield();
+  8046e0:	49 be 3f 2a 80 00 00 	movabs $0x802a3f,%r14
+  8046e7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8046ea:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8046ef:	74 7d                	je     80476e <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8046f1:	8b 03                	mov    (%rbx),%eax
+  8046f3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8046f6:	75 26                	jne    80471e <devpipe_read+0x79>
+            if (i > 0) return i;
+  8046f8:	4d 85 ff             	test   %r15,%r15
+  8046fb:	75 77                	jne    804774 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046fd:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804702:	48 89 da             	mov    %rbx,%rdx
+  804705:	be 00 10 00 00       	mov    $0x1000,%esi
+  80470a:	4c 89 e7             	mov    %r12,%rdi
+  80470d:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804710:	85 c0                	test   %eax,%eax
+  804712:	74 72                	je     804786 <devpipe_read+0xe1>
+            sys_yield();
+  804714:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804717:	8b 03                	mov    (%rbx),%eax
+  804719:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80471c:	74 df                	je     8046fd <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80471e:	48 63 c8             	movslq %eax,%rcx
+  804721:	48 89 ca             	mov    %rcx,%rdx
+  804724:	48 c1 ea 03          	shr    $0x3,%rdx
+  804728:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80472f:	08 10 20 
+  804732:	48 89 d0             	mov    %rdx,%rax
+  804735:	48 f7 e6             	mul    %rsi
+  804738:	48 c1 ea 06          	shr    $0x6,%rdx
+  80473c:	48 89 d0             	mov    %rdx,%rax
+  80473f:	48 c1 e0 09          	shl    $0x9,%rax
+  804743:	48 29 d0             	sub    %rdx,%rax
+  804746:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80474d:	00 
+  80474e:	48 89 c8             	mov    %rcx,%rax
+  804751:	48 29 d0             	sub    %rdx,%rax
+  804754:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804759:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80475d:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804761:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804764:	49 83 c7 01          	add    $0x1,%r15
+  804768:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  80476c:	75 83                	jne    8046f1 <devpipe_read+0x4c>
+    return n;
+  80476e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804772:	eb 03                	jmp    804777 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804774:	4c 89 f8             	mov    %r15,%rax
+}
+  804777:	48 83 c4 18          	add    $0x18,%rsp
+  80477b:	5b                   	pop    %rbx
+  80477c:	41 5c                	pop    %r12
+  80477e:	41 5d                	pop    %r13
+  804780:	41 5e                	pop    %r14
+  804782:	41 5f                	pop    %r15
+  804784:	5d                   	pop    %rbp
+  804785:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804786:	b8 00 00 00 00       	mov    $0x0,%eax
+  80478b:	eb ea                	jmp    804777 <devpipe_read+0xd2>
+
+000000000080478d <pipe>:
+pipe(int pfd[2]) {
+  80478d:	55                   	push   %rbp
+  80478e:	48 89 e5             	mov    %rsp,%rbp
+  804791:	41 55                	push   %r13
+  804793:	41 54                	push   %r12
+  804795:	53                   	push   %rbx
+  804796:	48 83 ec 18          	sub    $0x18,%rsp
+  80479a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80479d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8047a1:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  8047a8:	00 00 00 
+  8047ab:	ff d0                	call   *%rax
+  8047ad:	89 c3                	mov    %eax,%ebx
+  8047af:	85 c0                	test   %eax,%eax
+  8047b1:	0f 88 a0 01 00 00    	js     804957 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8047b7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047c1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8047c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ca:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  8047d1:	00 00 00 
+  8047d4:	ff d0                	call   *%rax
+  8047d6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8047d8:	85 c0                	test   %eax,%eax
+  8047da:	0f 88 77 01 00 00    	js     804957 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8047e0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8047e4:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  8047eb:	00 00 00 
+  8047ee:	ff d0                	call   *%rax
+  8047f0:	89 c3                	mov    %eax,%ebx
+  8047f2:	85 c0                	test   %eax,%eax
+  8047f4:	0f 88 43 01 00 00    	js     80493d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8047fa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804804:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804808:	bf 00 00 00 00       	mov    $0x0,%edi
+  80480d:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  804814:	00 00 00 
+  804817:	ff d0                	call   *%rax
+  804819:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80481b:	85 c0                	test   %eax,%eax
+  80481d:	0f 88 1a 01 00 00    	js     80493d <pipe+0x1b0>
+    va = fd2data(fd0);
+  804823:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804827:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  80482e:	00 00 00 
+  804831:	ff d0                	call   *%rax
+  804833:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804836:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80483b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804840:	48 89 c6             	mov    %rax,%rsi
+  804843:	bf 00 00 00 00       	mov    $0x0,%edi
+  804848:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  80484f:	00 00 00 
+  804852:	ff d0                	call   *%rax
+  804854:	89 c3                	mov    %eax,%ebx
+  804856:	85 c0                	test   %eax,%eax
+  804858:	0f 88 c5 00 00 00    	js     804923 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80485e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804862:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  804869:	00 00 00 
+  80486c:	ff d0                	call   *%rax
+  80486e:	48 89 c1             	mov    %rax,%rcx
+  804871:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804877:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80487d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804882:	4c 89 ee             	mov    %r13,%rsi
+  804885:	bf 00 00 00 00       	mov    $0x0,%edi
+  80488a:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  804891:	00 00 00 
+  804894:	ff d0                	call   *%rax
+  804896:	89 c3                	mov    %eax,%ebx
+  804898:	85 c0                	test   %eax,%eax
+  80489a:	78 6e                	js     80490a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80489c:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048a1:	4c 89 ef             	mov    %r13,%rdi
+  8048a4:	48 b8 76 2a 80 00 00 	movabs $0x802a76,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+  8048b0:	83 f8 02             	cmp    $0x2,%eax
+  8048b3:	0f 85 ab 00 00 00    	jne    804964 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8048b9:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8048c0:	00 00 
+  8048c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048c6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8048c8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048cc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8048d3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8048d7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8048d9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8048dd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8048e4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8048e8:	48 bb 72 35 80 00 00 	movabs $0x803572,%rbx
+  8048ef:	00 00 00 
+  8048f2:	ff d3                	call   *%rbx
+  8048f4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8048f8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048fc:	ff d3                	call   *%rbx
+  8048fe:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804903:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804908:	eb 4d                	jmp    804957 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80490a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80490f:	4c 89 ee             	mov    %r13,%rsi
+  804912:	bf 00 00 00 00       	mov    $0x0,%edi
+  804917:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  80491e:	00 00 00 
+  804921:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804923:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804928:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80492c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804931:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  804938:	00 00 00 
+  80493b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80493d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804942:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804946:	bf 00 00 00 00       	mov    $0x0,%edi
+  80494b:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  804952:	00 00 00 
+  804955:	ff d0                	call   *%rax
+}
+  804957:	89 d8                	mov    %ebx,%eax
+  804959:	48 83 c4 18          	add    $0x18,%rsp
+  80495d:	5b                   	pop    %rbx
+  80495e:	41 5c                	pop    %r12
+  804960:	41 5d                	pop    %r13
+  804962:	5d                   	pop    %rbp
+  804963:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804964:	48 b9 28 69 80 00 00 	movabs $0x806928,%rcx
+  80496b:	00 00 00 
+  80496e:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804975:	00 00 00 
+  804978:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80497d:	48 bf 17 69 80 00 00 	movabs $0x806917,%rdi
+  804984:	00 00 00 
+  804987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80498c:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  804993:	00 00 00 
+  804996:	41 ff d0             	call   *%r8
+
+0000000000804999 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804999:	55                   	push   %rbp
+  80499a:	48 89 e5             	mov    %rsp,%rbp
+  80499d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8049a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8049a5:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  8049ac:	00 00 00 
+  8049af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8049b1:	85 c0                	test   %eax,%eax
+  8049b3:	78 35                	js     8049ea <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8049b5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049b9:	48 b8 84 35 80 00 00 	movabs $0x803584,%rax
+  8049c0:	00 00 00 
+  8049c3:	ff d0                	call   *%rax
+  8049c5:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8049c8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8049cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8049d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049d6:	48 b8 ae 2a 80 00 00 	movabs $0x802aae,%rax
+  8049dd:	00 00 00 
+  8049e0:	ff d0                	call   *%rax
+  8049e2:	85 c0                	test   %eax,%eax
+  8049e4:	0f 94 c0             	sete   %al
+  8049e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8049ea:	c9                   	leave
+  8049eb:	c3                   	ret
+
+00000000008049ec <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8049ec:	48 89 f8             	mov    %rdi,%rax
+  8049ef:	48 c1 e8 27          	shr    $0x27,%rax
+  8049f3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8049fa:	01 00 00 
+  8049fd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a01:	f6 c2 01             	test   $0x1,%dl
+  804a04:	74 6d                	je     804a73 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a06:	48 89 f8             	mov    %rdi,%rax
+  804a09:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804a0d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a14:	01 00 00 
+  804a17:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a1b:	f6 c2 01             	test   $0x1,%dl
+  804a1e:	74 62                	je     804a82 <get_uvpt_entry+0x96>
+  804a20:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a27:	01 00 00 
+  804a2a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a2e:	f6 c2 80             	test   $0x80,%dl
+  804a31:	75 4f                	jne    804a82 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a33:	48 89 f8             	mov    %rdi,%rax
+  804a36:	48 c1 e8 15          	shr    $0x15,%rax
+  804a3a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a41:	01 00 00 
+  804a44:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a48:	f6 c2 01             	test   $0x1,%dl
+  804a4b:	74 44                	je     804a91 <get_uvpt_entry+0xa5>
+  804a4d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a54:	01 00 00 
+  804a57:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804a5b:	f6 c2 80             	test   $0x80,%dl
+  804a5e:	75 31                	jne    804a91 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804a60:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804a64:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804a6b:	01 00 00 
+  804a6e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804a72:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804a73:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804a7a:	01 00 00 
+  804a7d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a81:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804a82:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804a89:	01 00 00 
+  804a8c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a90:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804a91:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804a98:	01 00 00 
+  804a9b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804a9f:	c3                   	ret
+
+0000000000804aa0 <get_prot>:
+
+int
+get_prot(void *va) {
+  804aa0:	55                   	push   %rbp
+  804aa1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804aa4:	48 b8 ec 49 80 00 00 	movabs $0x8049ec,%rax
+  804aab:	00 00 00 
+  804aae:	ff d0                	call   *%rax
+  804ab0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804ab3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804ab8:	89 c1                	mov    %eax,%ecx
+  804aba:	83 c9 04             	or     $0x4,%ecx
+  804abd:	f6 c2 01             	test   $0x1,%dl
+  804ac0:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804ac3:	89 c1                	mov    %eax,%ecx
+  804ac5:	83 c9 02             	or     $0x2,%ecx
+  804ac8:	f6 c2 02             	test   $0x2,%dl
+  804acb:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804ace:	89 c1                	mov    %eax,%ecx
+  804ad0:	83 c9 01             	or     $0x1,%ecx
+  804ad3:	48 85 d2             	test   %rdx,%rdx
+  804ad6:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804ad9:	89 c1                	mov    %eax,%ecx
+  804adb:	83 c9 40             	or     $0x40,%ecx
+  804ade:	f6 c6 04             	test   $0x4,%dh
+  804ae1:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804ae4:	5d                   	pop    %rbp
+  804ae5:	c3                   	ret
+
+0000000000804ae6 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804ae6:	55                   	push   %rbp
+  804ae7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804aea:	48 b8 ec 49 80 00 00 	movabs $0x8049ec,%rax
+  804af1:	00 00 00 
+  804af4:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804af6:	48 c1 e8 06          	shr    $0x6,%rax
+  804afa:	83 e0 01             	and    $0x1,%eax
+}
+  804afd:	5d                   	pop    %rbp
+  804afe:	c3                   	ret
+
+0000000000804aff <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804aff:	55                   	push   %rbp
+  804b00:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804b03:	48 b8 ec 49 80 00 00 	movabs $0x8049ec,%rax
+  804b0a:	00 00 00 
+  804b0d:	ff d0                	call   *%rax
+  804b0f:	83 e0 01             	and    $0x1,%eax
+}
+  804b12:	5d                   	pop    %rbp
+  804b13:	c3                   	ret
+
+0000000000804b14 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804b14:	55                   	push   %rbp
+  804b15:	48 89 e5             	mov    %rsp,%rbp
+  804b18:	41 57                	push   %r15
+  804b1a:	41 56                	push   %r14
+  804b1c:	41 55                	push   %r13
+  804b1e:	41 54                	push   %r12
+  804b20:	53                   	push   %rbx
+  804b21:	48 83 ec 28          	sub    $0x28,%rsp
+  804b25:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804b29:	48 85 ff             	test   %rdi,%rdi
+  804b2c:	74 1e                	je     804b4c <foreach_shared_region+0x38>
+  804b2e:	49 89 ff             	mov    %rdi,%r15
+  804b31:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804b37:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804b3d:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  804b44:	01 00 00 
+  804b47:	e9 72 02 00 00       	jmp    804dbe <foreach_shared_region+0x2aa>
+    assert(fun);
+  804b4c:	48 b9 4c 69 80 00 00 	movabs $0x80694c,%rcx
+  804b53:	00 00 00 
+  804b56:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804b5d:	00 00 00 
+  804b60:	be 2d 00 00 00       	mov    $0x2d,%esi
+  804b65:	48 bf 50 69 80 00 00 	movabs $0x806950,%rdi
+  804b6c:	00 00 00 
+  804b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b74:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  804b7b:	00 00 00 
+  804b7e:	41 ff d0             	call   *%r8
+  804b81:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804b88:	eb 6c                	jmp    804bf6 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804b8a:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804b91:	ff ff ff 
+  804b94:	4c 21 e2             	and    %r12,%rdx
+  804b97:	48 89 d8             	mov    %rbx,%rax
+  804b9a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804b9f:	48 83 c0 01          	add    $0x1,%rax
+  804ba3:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804ba7:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804bae:	00 00 00 
+  804bb1:	48 21 c8             	and    %rcx,%rax
+  804bb4:	48 09 d0             	or     %rdx,%rax
+  804bb7:	49 89 c4             	mov    %rax,%r12
+  804bba:	eb 30                	jmp    804bec <foreach_shared_region+0xd8>
+  804bbc:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804bc3:	ff ff ff 
+  804bc6:	4c 21 e2             	and    %r12,%rdx
+  804bc9:	48 89 d8             	mov    %rbx,%rax
+  804bcc:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804bd1:	48 83 c0 01          	add    $0x1,%rax
+  804bd5:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804bd9:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804be0:	00 00 00 
+  804be3:	48 21 c8             	and    %rcx,%rax
+  804be6:	48 09 d0             	or     %rdx,%rax
+  804be9:	49 89 c4             	mov    %rax,%r12
+  804bec:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  804bf0:	0f 84 99 01 00 00    	je     804d8f <foreach_shared_region+0x27b>
+  804bf6:	4c 89 e3             	mov    %r12,%rbx
+  804bf9:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804bfd:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804c04:	01 00 00 
+  804c07:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804c0b:	a8 01                	test   $0x1,%al
+  804c0d:	0f 84 77 ff ff ff    	je     804b8a <foreach_shared_region+0x76>
+  804c13:	a8 80                	test   $0x80,%al
+  804c15:	74 19                	je     804c30 <foreach_shared_region+0x11c>
+  804c17:	f6 c4 04             	test   $0x4,%ah
+  804c1a:	74 a0                	je     804bbc <foreach_shared_region+0xa8>
+  804c1c:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804c23:	40 
+  804c24:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804c28:	4c 89 e7             	mov    %r12,%rdi
+  804c2b:	41 ff d7             	call   *%r15
+  804c2e:	eb 8c                	jmp    804bbc <foreach_shared_region+0xa8>
+  804c30:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804c37:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804c3b:	eb 46                	jmp    804c83 <foreach_shared_region+0x16f>
+  804c3d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804c44:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804c4a:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804c4e:	48 c1 e0 15          	shl    $0x15,%rax
+  804c52:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804c57:	49 09 c4             	or     %rax,%r12
+  804c5a:	eb 1d                	jmp    804c79 <foreach_shared_region+0x165>
+  804c5c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804c63:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804c69:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804c6d:	48 c1 e0 15          	shl    $0x15,%rax
+  804c71:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804c76:	49 09 c4             	or     %rax,%r12
+  804c79:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804c7d:	0f 84 d3 00 00 00    	je     804d56 <foreach_shared_region+0x242>
+  804c83:	4c 89 e3             	mov    %r12,%rbx
+  804c86:	48 c1 eb 15          	shr    $0x15,%rbx
+  804c8a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804c91:	01 00 00 
+  804c94:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804c98:	a8 01                	test   $0x1,%al
+  804c9a:	74 a1                	je     804c3d <foreach_shared_region+0x129>
+  804c9c:	a8 80                	test   $0x80,%al
+  804c9e:	74 19                	je     804cb9 <foreach_shared_region+0x1a5>
+  804ca0:	f6 c4 04             	test   $0x4,%ah
+  804ca3:	74 b7                	je     804c5c <foreach_shared_region+0x148>
+  804ca5:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804cac:	00 
+  804cad:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804cb1:	4c 89 e7             	mov    %r12,%rdi
+  804cb4:	41 ff d7             	call   *%r15
+  804cb7:	eb a3                	jmp    804c5c <foreach_shared_region+0x148>
+  804cb9:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804cbf:	eb 3b                	jmp    804cfc <foreach_shared_region+0x1e8>
+  804cc1:	f6 c4 04             	test   $0x4,%ah
+  804cc4:	74 12                	je     804cd8 <foreach_shared_region+0x1c4>
+  804cc6:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804ccd:	00 
+  804cce:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804cd2:	4c 89 e7             	mov    %r12,%rdi
+  804cd5:	41 ff d7             	call   *%r15
+  804cd8:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804cdf:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804ce5:	48 83 c3 01          	add    $0x1,%rbx
+  804ce9:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804ced:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804cf3:	49 09 dc             	or     %rbx,%r12
+  804cf6:	41 83 ed 01          	sub    $0x1,%r13d
+  804cfa:	74 2f                	je     804d2b <foreach_shared_region+0x217>
+  804cfc:	4c 89 e3             	mov    %r12,%rbx
+  804cff:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804d03:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804d07:	a8 01                	test   $0x1,%al
+  804d09:	75 b6                	jne    804cc1 <foreach_shared_region+0x1ad>
+  804d0b:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804d12:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804d18:	48 83 c3 01          	add    $0x1,%rbx
+  804d1c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804d20:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804d26:	49 09 dc             	or     %rbx,%r12
+  804d29:	eb cb                	jmp    804cf6 <foreach_shared_region+0x1e2>
+  804d2b:	4c 89 e0             	mov    %r12,%rax
+  804d2e:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804d34:	49 c1 ec 15          	shr    $0x15,%r12
+  804d38:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804d3f:	49 83 c4 01          	add    $0x1,%r12
+  804d43:	49 c1 e4 15          	shl    $0x15,%r12
+  804d47:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804d4e:	49 09 c4             	or     %rax,%r12
+  804d51:	e9 23 ff ff ff       	jmp    804c79 <foreach_shared_region+0x165>
+  804d56:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804d5a:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804d61:	ff ff ff 
+  804d64:	4c 21 e0             	and    %r12,%rax
+  804d67:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804d6b:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804d72:	49 83 c4 01          	add    $0x1,%r12
+  804d76:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804d7a:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804d81:	00 00 00 
+  804d84:	49 21 d4             	and    %rdx,%r12
+  804d87:	49 09 c4             	or     %rax,%r12
+  804d8a:	e9 5d fe ff ff       	jmp    804bec <foreach_shared_region+0xd8>
+  804d8f:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804d96:	00 ff ff 
+  804d99:	4c 21 e0             	and    %r12,%rax
+  804d9c:	49 c1 ec 27          	shr    $0x27,%r12
+  804da0:	49 83 c4 01          	add    $0x1,%r12
+  804da4:	49 c1 e4 27          	shl    $0x27,%r12
+  804da8:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804daf:	ff 00 00 
+  804db2:	49 21 d4             	and    %rdx,%r12
+  804db5:	49 09 c4             	or     %rax,%r12
+  804db8:	41 83 ed 01          	sub    $0x1,%r13d
+  804dbc:	74 48                	je     804e06 <foreach_shared_region+0x2f2>
+  804dbe:	4c 89 e0             	mov    %r12,%rax
+  804dc1:	48 c1 e8 27          	shr    $0x27,%rax
+  804dc5:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804dcc:	01 00 00 
+  804dcf:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804dd3:	f6 c2 01             	test   $0x1,%dl
+  804dd6:	0f 85 a5 fd ff ff    	jne    804b81 <foreach_shared_region+0x6d>
+  804ddc:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804de3:	00 ff ff 
+  804de6:	4c 21 e2             	and    %r12,%rdx
+  804de9:	48 83 c0 01          	add    $0x1,%rax
+  804ded:	48 c1 e0 27          	shl    $0x27,%rax
+  804df1:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804df8:	ff 00 00 
+  804dfb:	48 21 c8             	and    %rcx,%rax
+  804dfe:	48 09 d0             	or     %rdx,%rax
+  804e01:	49 89 c4             	mov    %rax,%r12
+  804e04:	eb b2                	jmp    804db8 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804e06:	4d 85 e4             	test   %r12,%r12
+  804e09:	75 14                	jne    804e1f <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e10:	48 83 c4 28          	add    $0x28,%rsp
+  804e14:	5b                   	pop    %rbx
+  804e15:	41 5c                	pop    %r12
+  804e17:	41 5d                	pop    %r13
+  804e19:	41 5e                	pop    %r14
+  804e1b:	41 5f                	pop    %r15
+  804e1d:	5d                   	pop    %rbp
+  804e1e:	c3                   	ret
+    assert(addr == 0);
+  804e1f:	48 b9 5b 69 80 00 00 	movabs $0x80695b,%rcx
+  804e26:	00 00 00 
+  804e29:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  804e30:	00 00 00 
+  804e33:	be 67 00 00 00       	mov    $0x67,%esi
+  804e38:	48 bf 50 69 80 00 00 	movabs $0x806950,%rdi
+  804e3f:	00 00 00 
+  804e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e47:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  804e4e:	00 00 00 
+  804e51:	41 ff d0             	call   *%r8
+
+0000000000804e54 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804e54:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804e5b:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804e5e:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804e64:	eb 33                	jmp    804e99 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e66:	48 83 c0 20          	add    $0x20,%rax
+  804e6a:	4c 39 c0             	cmp    %r8,%rax
+  804e6d:	74 25                	je     804e94 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804e6f:	48 8b 10             	mov    (%rax),%rdx
+  804e72:	48 85 d2             	test   %rdx,%rdx
+  804e75:	74 ef                	je     804e66 <mmap_place+0x12>
+  804e77:	48 89 d1             	mov    %rdx,%rcx
+  804e7a:	48 03 48 08          	add    0x8(%rax),%rcx
+  804e7e:	48 39 cf             	cmp    %rcx,%rdi
+  804e81:	73 e3                	jae    804e66 <mmap_place+0x12>
+  804e83:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804e87:	4c 39 ca             	cmp    %r9,%rdx
+  804e8a:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804e8e:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804e92:	eb d2                	jmp    804e66 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804e94:	45 84 d2             	test   %r10b,%r10b
+  804e97:	74 12                	je     804eab <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e99:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804ea0:	00 00 00 
+        moved = 0;
+  804ea3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804ea9:	eb c4                	jmp    804e6f <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804eab:	48 01 fe             	add    %rdi,%rsi
+  804eae:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804eb5:	00 00 00 
+  804eb8:	48 39 f0             	cmp    %rsi,%rax
+  804ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ec0:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804ec4:	c3                   	ret
+
+0000000000804ec5 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804ec5:	55                   	push   %rbp
+  804ec6:	48 89 e5             	mov    %rsp,%rbp
+  804ec9:	41 57                	push   %r15
+  804ecb:	41 56                	push   %r14
+  804ecd:	41 55                	push   %r13
+  804ecf:	41 54                	push   %r12
+  804ed1:	53                   	push   %rbx
+  804ed2:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804ed6:	48 8b 1f             	mov    (%rdi),%rbx
+  804ed9:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ee0:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804ee7:	00 00 00 
+  804eea:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eef:	eb 12                	jmp    804f03 <mmap_pgfault+0x3e>
+  804ef1:	48 83 c2 01          	add    $0x1,%rdx
+  804ef5:	48 83 c0 20          	add    $0x20,%rax
+  804ef9:	48 83 fa 20          	cmp    $0x20,%rdx
+  804efd:	0f 84 04 01 00 00    	je     805007 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804f03:	48 8b 08             	mov    (%rax),%rcx
+  804f06:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804f0a:	48 39 de             	cmp    %rbx,%rsi
+  804f0d:	73 e2                	jae    804ef1 <mmap_pgfault+0x2c>
+  804f0f:	48 03 48 08          	add    0x8(%rax),%rcx
+  804f13:	48 39 cb             	cmp    %rcx,%rbx
+  804f16:	73 d9                	jae    804ef1 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804f18:	48 c1 e2 05          	shl    $0x5,%rdx
+  804f1c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f23:	00 00 00 
+  804f26:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804f2a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804f2e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804f32:	f6 c2 01             	test   $0x1,%dl
+  804f35:	0f 84 e0 00 00 00    	je     80501b <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f40:	f6 c2 02             	test   $0x2,%dl
+  804f43:	0f 84 c3 00 00 00    	je     80500c <mmap_pgfault+0x147>
+  804f49:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804f50:	ff ff ff 
+  804f53:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804f57:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804f5e:	00 00 00 
+  804f61:	48 39 ca             	cmp    %rcx,%rdx
+  804f64:	0f 85 a2 00 00 00    	jne    80500c <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804f6a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804f6f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f74:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804f7b:	00 00 00 
+  804f7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f83:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  804f8a:	00 00 00 
+  804f8d:	ff d0                	call   *%rax
+  804f8f:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f96:	85 d2                	test   %edx,%edx
+  804f98:	78 72                	js     80500c <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804f9a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f9f:	48 89 de             	mov    %rbx,%rsi
+  804fa2:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804fa9:	00 00 00 
+  804fac:	4c 89 e7             	mov    %r12,%rdi
+  804faf:	48 b8 32 27 80 00 00 	movabs $0x802732,%rax
+  804fb6:	00 00 00 
+  804fb9:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804fbb:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804fc1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804fc7:	48 89 d9             	mov    %rbx,%rcx
+  804fca:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fcf:	4c 89 e6             	mov    %r12,%rsi
+  804fd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804fd7:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  804fde:	00 00 00 
+  804fe1:	ff d0                	call   *%rax
+  804fe3:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804fe5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804fea:	4c 89 e6             	mov    %r12,%rsi
+  804fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ff2:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  804ff9:	00 00 00 
+  804ffc:	ff d0                	call   *%rax
+    return res >= 0;
+  804ffe:	89 d8                	mov    %ebx,%eax
+  805000:	f7 d0                	not    %eax
+  805002:	c1 e8 1f             	shr    $0x1f,%eax
+  805005:	eb 05                	jmp    80500c <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805007:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  80500c:	48 83 c4 18          	add    $0x18,%rsp
+  805010:	5b                   	pop    %rbx
+  805011:	41 5c                	pop    %r12
+  805013:	41 5d                	pop    %r13
+  805015:	41 5e                	pop    %r14
+  805017:	41 5f                	pop    %r15
+  805019:	5d                   	pop    %rbp
+  80501a:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  80501b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80501f:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805023:	4c 03 30             	add    (%rax),%r14
+  805026:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80502d:	49 39 c6             	cmp    %rax,%r14
+  805030:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805034:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  80503b:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805041:	49 bf ff 4a 80 00 00 	movabs $0x804aff,%r15
+  805048:	00 00 00 
+  80504b:	4d 39 f4             	cmp    %r14,%r12
+  80504e:	73 1d                	jae    80506d <mmap_pgfault+0x1a8>
+  805050:	4c 89 e7             	mov    %r12,%rdi
+  805053:	41 ff d7             	call   *%r15
+  805056:	84 c0                	test   %al,%al
+  805058:	75 13                	jne    80506d <mmap_pgfault+0x1a8>
+  80505a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805061:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805068:	4d 39 f4             	cmp    %r14,%r12
+  80506b:	72 e3                	jb     805050 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80506d:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805073:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805077:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  80507b:	74 2a                	je     8050a7 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  80507d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805081:	89 de                	mov    %ebx,%esi
+  805083:	2b 30                	sub    (%rax),%esi
+  805085:	03 70 1c             	add    0x1c(%rax),%esi
+  805088:	8b 78 18             	mov    0x18(%rax),%edi
+  80508b:	4c 89 e9             	mov    %r13,%rcx
+  80508e:	48 89 da             	mov    %rbx,%rdx
+  805091:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  805098:	00 00 00 
+  80509b:	ff d0                	call   *%rax
+    return res > 0;
+  80509d:	85 c0                	test   %eax,%eax
+  80509f:	0f 9f c0             	setg   %al
+  8050a2:	e9 65 ff ff ff       	jmp    80500c <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8050a7:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8050ab:	eb d0                	jmp    80507d <mmap_pgfault+0x1b8>
+
+00000000008050ad <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8050ad:	55                   	push   %rbp
+  8050ae:	48 89 e5             	mov    %rsp,%rbp
+  8050b1:	41 57                	push   %r15
+  8050b3:	41 56                	push   %r14
+  8050b5:	41 55                	push   %r13
+  8050b7:	41 54                	push   %r12
+  8050b9:	53                   	push   %rbx
+  8050ba:	48 83 ec 28          	sub    $0x28,%rsp
+  8050be:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8050c2:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  8050c5:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  8050cc:	ff ff ff 
+  8050cf:	48 23 57 10          	and    0x10(%rdi),%rdx
+  8050d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050d8:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8050df:	00 00 00 
+  8050e2:	48 39 ca             	cmp    %rcx,%rdx
+  8050e5:	0f 85 e5 00 00 00    	jne    8051d0 <mmap_writeback+0x123>
+  8050eb:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8050ee:	4c 39 ee             	cmp    %r13,%rsi
+  8050f1:	0f 83 e8 00 00 00    	jae    8051df <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8050f7:	49 be ff 4a 80 00 00 	movabs $0x804aff,%r14
+  8050fe:	00 00 00 
+  805101:	49 bf e6 4a 80 00 00 	movabs $0x804ae6,%r15
+  805108:	00 00 00 
+  80510b:	eb 10                	jmp    80511d <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80510d:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805114:	4d 39 ec             	cmp    %r13,%r12
+  805117:	0f 83 ae 00 00 00    	jae    8051cb <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80511d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805121:	4c 89 e7             	mov    %r12,%rdi
+  805124:	41 ff d6             	call   *%r14
+  805127:	84 c0                	test   %al,%al
+  805129:	74 e2                	je     80510d <mmap_writeback+0x60>
+  80512b:	4c 89 e7             	mov    %r12,%rdi
+  80512e:	41 ff d7             	call   *%r15
+  805131:	84 c0                	test   %al,%al
+  805133:	74 d8                	je     80510d <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805135:	4c 89 e3             	mov    %r12,%rbx
+  805138:	4d 39 ec             	cmp    %r13,%r12
+  80513b:	73 20                	jae    80515d <mmap_writeback+0xb0>
+  80513d:	48 89 df             	mov    %rbx,%rdi
+  805140:	41 ff d6             	call   *%r14
+  805143:	84 c0                	test   %al,%al
+  805145:	74 16                	je     80515d <mmap_writeback+0xb0>
+  805147:	48 89 df             	mov    %rbx,%rdi
+  80514a:	41 ff d7             	call   *%r15
+  80514d:	84 c0                	test   %al,%al
+  80514f:	74 0c                	je     80515d <mmap_writeback+0xb0>
+  805151:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805158:	4c 39 eb             	cmp    %r13,%rbx
+  80515b:	72 e0                	jb     80513d <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80515d:	48 89 d9             	mov    %rbx,%rcx
+  805160:	4c 29 e1             	sub    %r12,%rcx
+  805163:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805167:	44 89 e6             	mov    %r12d,%esi
+  80516a:	2b 30                	sub    (%rax),%esi
+  80516c:	49 89 c4             	mov    %rax,%r12
+  80516f:	03 70 1c             	add    0x1c(%rax),%esi
+  805172:	8b 78 18             	mov    0x18(%rax),%edi
+  805175:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  805179:	48 89 ca             	mov    %rcx,%rdx
+  80517c:	48 b8 e6 42 80 00 00 	movabs $0x8042e6,%rax
+  805183:	00 00 00 
+  805186:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805188:	85 c0                	test   %eax,%eax
+  80518a:	78 44                	js     8051d0 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  80518c:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805191:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805194:	41 89 c1             	mov    %eax,%r9d
+  805197:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  80519e:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8051a2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8051a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051ab:	48 89 ce             	mov    %rcx,%rsi
+  8051ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051b3:	48 b8 4d 2b 80 00 00 	movabs $0x802b4d,%rax
+  8051ba:	00 00 00 
+  8051bd:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8051bf:	85 c0                	test   %eax,%eax
+  8051c1:	78 0d                	js     8051d0 <mmap_writeback+0x123>
+  8051c3:	49 89 dc             	mov    %rbx,%r12
+  8051c6:	e9 49 ff ff ff       	jmp    805114 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  8051cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051d0:	48 83 c4 28          	add    $0x28,%rsp
+  8051d4:	5b                   	pop    %rbx
+  8051d5:	41 5c                	pop    %r12
+  8051d7:	41 5d                	pop    %r13
+  8051d9:	41 5e                	pop    %r14
+  8051db:	41 5f                	pop    %r15
+  8051dd:	5d                   	pop    %rbp
+  8051de:	c3                   	ret
+    return 0;
+  8051df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051e4:	eb ea                	jmp    8051d0 <mmap_writeback+0x123>
+
+00000000008051e6 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8051e6:	55                   	push   %rbp
+  8051e7:	48 89 e5             	mov    %rsp,%rbp
+  8051ea:	41 57                	push   %r15
+  8051ec:	41 56                	push   %r14
+  8051ee:	41 55                	push   %r13
+  8051f0:	41 54                	push   %r12
+  8051f2:	53                   	push   %rbx
+  8051f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8051f7:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  8051fb:	48 85 f6             	test   %rsi,%rsi
+  8051fe:	0f 84 0c 02 00 00    	je     805410 <mmap+0x22a>
+  805204:	49 89 ff             	mov    %rdi,%r15
+  805207:	49 89 f4             	mov    %rsi,%r12
+  80520a:	41 89 d5             	mov    %edx,%r13d
+  80520d:	41 89 ce             	mov    %ecx,%r14d
+  805210:	44 89 cb             	mov    %r9d,%ebx
+  805213:	45 85 c9             	test   %r9d,%r9d
+  805216:	0f 88 f4 01 00 00    	js     805410 <mmap+0x22a>
+  80521c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805223:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  80522a:	0f 85 e7 01 00 00    	jne    805417 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805230:	83 e2 fd             	and    $0xfffffffd,%edx
+  805233:	83 fa 04             	cmp    $0x4,%edx
+  805236:	0f 85 db 01 00 00    	jne    805417 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  80523c:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80523f:	83 fa 01             	cmp    $0x1,%edx
+  805242:	0f 87 cf 01 00 00    	ja     805417 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805248:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80524c:	44 89 c7             	mov    %r8d,%edi
+  80524f:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  805256:	00 00 00 
+  805259:	ff d0                	call   *%rax
+  80525b:	89 c2                	mov    %eax,%edx
+  80525d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805264:	85 d2                	test   %edx,%edx
+  805266:	0f 88 ab 01 00 00    	js     805417 <mmap+0x231>
+  80526c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805270:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  805277:	00 00 00 
+  80527a:	8b 09                	mov    (%rcx),%ecx
+  80527c:	39 0a                	cmp    %ecx,(%rdx)
+  80527e:	0f 85 93 01 00 00    	jne    805417 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805284:	8b 52 08             	mov    0x8(%rdx),%edx
+  805287:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  80528a:	83 fa 01             	cmp    $0x1,%edx
+  80528d:	0f 84 84 01 00 00    	je     805417 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805293:	41 83 fe 01          	cmp    $0x1,%r14d
+  805297:	74 42                	je     8052db <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805299:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8052a0:	4c 89 e6             	mov    %r12,%rsi
+  8052a3:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8052aa:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8052ae:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8052b2:	4d 85 ff             	test   %r15,%r15
+  8052b5:	74 67                	je     80531e <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8052b7:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8052be:	75 0f                	jne    8052cf <mmap+0xe9>
+  8052c0:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  8052c7:	00 00 00 
+  8052ca:	49 39 c7             	cmp    %rax,%r15
+  8052cd:	77 1b                	ja     8052ea <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8052cf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8052d6:	e9 3c 01 00 00       	jmp    805417 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8052db:	41 f6 c5 02          	test   $0x2,%r13b
+  8052df:	74 b8                	je     805299 <mmap+0xb3>
+  8052e1:	85 d2                	test   %edx,%edx
+  8052e3:	75 b4                	jne    805299 <mmap+0xb3>
+  8052e5:	e9 2d 01 00 00       	jmp    805417 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  8052ea:	4c 89 ff             	mov    %r15,%rdi
+  8052ed:	48 b8 54 4e 80 00 00 	movabs $0x804e54,%rax
+  8052f4:	00 00 00 
+  8052f7:	ff d0                	call   *%rax
+  8052f9:	48 89 c2             	mov    %rax,%rdx
+  8052fc:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805303:	49 39 d7             	cmp    %rdx,%r15
+  805306:	0f 85 0b 01 00 00    	jne    805417 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80530c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  805313:	00 00 00 
+  805316:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80531c:	eb 44                	jmp    805362 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80531e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805322:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805329:	00 00 00 
+  80532c:	48 b8 54 4e 80 00 00 	movabs $0x804e54,%rax
+  805333:	00 00 00 
+  805336:	ff d0                	call   *%rax
+  805338:	48 89 c7             	mov    %rax,%rdi
+  80533b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80533f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805346:	48 85 ff             	test   %rdi,%rdi
+  805349:	75 c1                	jne    80530c <mmap+0x126>
+  80534b:	e9 c7 00 00 00       	jmp    805417 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805350:	49 83 c4 01          	add    $0x1,%r12
+  805354:	48 83 c0 20          	add    $0x20,%rax
+  805358:	49 83 fc 20          	cmp    $0x20,%r12
+  80535c:	0f 84 a5 00 00 00    	je     805407 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805362:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805366:	75 e8                	jne    805350 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805368:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  80536c:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  805373:	00 00 00 
+  805376:	ff d0                	call   *%rax
+  805378:	89 c2                	mov    %eax,%edx
+  80537a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805381:	85 d2                	test   %edx,%edx
+  805383:	0f 88 8e 00 00 00    	js     805417 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805389:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  80538d:	48 b8 72 35 80 00 00 	movabs $0x803572,%rax
+  805394:	00 00 00 
+  805397:	ff d0                	call   *%rax
+  805399:	89 c6                	mov    %eax,%esi
+  80539b:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  80539e:	48 b8 c0 37 80 00 00 	movabs $0x8037c0,%rax
+  8053a5:	00 00 00 
+  8053a8:	ff d0                	call   *%rax
+  8053aa:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8053ad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8053b4:	45 85 ff             	test   %r15d,%r15d
+  8053b7:	78 5e                	js     805417 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8053b9:	49 c1 e4 05          	shl    $0x5,%r12
+  8053bd:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8053c4:	00 00 00 
+  8053c7:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8053ca:	48 bf c5 4e 80 00 00 	movabs $0x804ec5,%rdi
+  8053d1:	00 00 00 
+  8053d4:	48 b8 f0 58 80 00 00 	movabs $0x8058f0,%rax
+  8053db:	00 00 00 
+  8053de:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8053e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8053e4:	49 89 04 24          	mov    %rax,(%r12)
+  8053e8:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8053ec:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8053f1:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  8053f6:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  8053fb:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805400:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805405:	eb 10                	jmp    805417 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805407:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80540e:	eb 07                	jmp    805417 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805410:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805417:	48 83 c4 38          	add    $0x38,%rsp
+  80541b:	5b                   	pop    %rbx
+  80541c:	41 5c                	pop    %r12
+  80541e:	41 5d                	pop    %r13
+  805420:	41 5e                	pop    %r14
+  805422:	41 5f                	pop    %r15
+  805424:	5d                   	pop    %rbp
+  805425:	c3                   	ret
+
+0000000000805426 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805426:	55                   	push   %rbp
+  805427:	48 89 e5             	mov    %rsp,%rbp
+  80542a:	41 57                	push   %r15
+  80542c:	41 56                	push   %r14
+  80542e:	41 55                	push   %r13
+  805430:	41 54                	push   %r12
+  805432:	53                   	push   %rbx
+  805433:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805437:	49 89 fe             	mov    %rdi,%r14
+  80543a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805441:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805448:	00 
+  805449:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805450:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805457:	00 00 00 
+  80545a:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805461:	49 bf ad 50 80 00 00 	movabs $0x8050ad,%r15
+  805468:	00 00 00 
+  80546b:	eb 09                	jmp    805476 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80546d:	48 83 c3 20          	add    $0x20,%rbx
+  805471:	4c 39 eb             	cmp    %r13,%rbx
+  805474:	74 33                	je     8054a9 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805476:	48 89 df             	mov    %rbx,%rdi
+  805479:	48 8b 33             	mov    (%rbx),%rsi
+  80547c:	4c 39 e6             	cmp    %r12,%rsi
+  80547f:	73 ec                	jae    80546d <msync+0x47>
+  805481:	48 85 f6             	test   %rsi,%rsi
+  805484:	74 e7                	je     80546d <msync+0x47>
+  805486:	48 89 f2             	mov    %rsi,%rdx
+  805489:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80548d:	49 39 d6             	cmp    %rdx,%r14
+  805490:	73 db                	jae    80546d <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805492:	4c 39 e2             	cmp    %r12,%rdx
+  805495:	49 0f 47 d4          	cmova  %r12,%rdx
+  805499:	4c 39 f6             	cmp    %r14,%rsi
+  80549c:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8054a0:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8054a3:	85 c0                	test   %eax,%eax
+  8054a5:	79 c6                	jns    80546d <msync+0x47>
+  8054a7:	eb 05                	jmp    8054ae <msync+0x88>
+    }
+
+    return 0;
+  8054a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054ae:	48 83 c4 08          	add    $0x8,%rsp
+  8054b2:	5b                   	pop    %rbx
+  8054b3:	41 5c                	pop    %r12
+  8054b5:	41 5d                	pop    %r13
+  8054b7:	41 5e                	pop    %r14
+  8054b9:	41 5f                	pop    %r15
+  8054bb:	5d                   	pop    %rbp
+  8054bc:	c3                   	ret
+
+00000000008054bd <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8054bd:	55                   	push   %rbp
+  8054be:	48 89 e5             	mov    %rsp,%rbp
+  8054c1:	41 57                	push   %r15
+  8054c3:	41 56                	push   %r14
+  8054c5:	41 55                	push   %r13
+  8054c7:	41 54                	push   %r12
+  8054c9:	53                   	push   %rbx
+  8054ca:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8054ce:	49 89 ff             	mov    %rdi,%r15
+  8054d1:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8054d8:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8054df:	00 
+  8054e0:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8054e7:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8054ee:	00 00 00 
+  8054f1:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8054f8:	48 89 d8             	mov    %rbx,%rax
+  8054fb:	eb 09                	jmp    805506 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8054fd:	48 83 c0 20          	add    $0x20,%rax
+  805501:	4c 39 f0             	cmp    %r14,%rax
+  805504:	74 40                	je     805546 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805506:	48 8b 10             	mov    (%rax),%rdx
+  805509:	4c 39 e2             	cmp    %r12,%rdx
+  80550c:	73 ef                	jae    8054fd <munmap+0x40>
+  80550e:	48 85 d2             	test   %rdx,%rdx
+  805511:	74 ea                	je     8054fd <munmap+0x40>
+  805513:	48 89 d7             	mov    %rdx,%rdi
+  805516:	48 03 78 08          	add    0x8(%rax),%rdi
+  80551a:	49 39 ff             	cmp    %rdi,%r15
+  80551d:	73 de                	jae    8054fd <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  80551f:	49 39 fc             	cmp    %rdi,%r12
+  805522:	72 05                	jb     805529 <munmap+0x6c>
+  805524:	4c 39 fa             	cmp    %r15,%rdx
+  805527:	73 d4                	jae    8054fd <munmap+0x40>
+  805529:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80552e:	48 83 c4 08          	add    $0x8,%rsp
+  805532:	5b                   	pop    %rbx
+  805533:	41 5c                	pop    %r12
+  805535:	41 5d                	pop    %r13
+  805537:	41 5e                	pop    %r14
+  805539:	41 5f                	pop    %r15
+  80553b:	5d                   	pop    %rbp
+  80553c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80553d:	48 83 c3 20          	add    $0x20,%rbx
+  805541:	4c 39 f3             	cmp    %r14,%rbx
+  805544:	74 5c                	je     8055a2 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805546:	48 8b 33             	mov    (%rbx),%rsi
+  805549:	4c 39 e6             	cmp    %r12,%rsi
+  80554c:	73 ef                	jae    80553d <munmap+0x80>
+  80554e:	48 85 f6             	test   %rsi,%rsi
+  805551:	74 ea                	je     80553d <munmap+0x80>
+  805553:	48 89 f2             	mov    %rsi,%rdx
+  805556:	48 03 53 08          	add    0x8(%rbx),%rdx
+  80555a:	49 39 d7             	cmp    %rdx,%r15
+  80555d:	73 de                	jae    80553d <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  80555f:	48 89 df             	mov    %rbx,%rdi
+  805562:	48 b8 ad 50 80 00 00 	movabs $0x8050ad,%rax
+  805569:	00 00 00 
+  80556c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  80556e:	85 c0                	test   %eax,%eax
+  805570:	78 bc                	js     80552e <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805572:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805576:	48 8b 33             	mov    (%rbx),%rsi
+  805579:	bf 00 00 00 00       	mov    $0x0,%edi
+  80557e:	48 b8 b8 2b 80 00 00 	movabs $0x802bb8,%rax
+  805585:	00 00 00 
+  805588:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  80558a:	8b 7b 18             	mov    0x18(%rbx),%edi
+  80558d:	48 b8 65 37 80 00 00 	movabs $0x803765,%rax
+  805594:	00 00 00 
+  805597:	ff d0                	call   *%rax
+        reg->start = 0;
+  805599:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8055a0:	eb 9b                	jmp    80553d <munmap+0x80>
+    return 0;
+  8055a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055a7:	eb 85                	jmp    80552e <munmap+0x71>
+
+00000000008055a9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8055a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ae:	c3                   	ret
+
+00000000008055af <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8055af:	55                   	push   %rbp
+  8055b0:	48 89 e5             	mov    %rsp,%rbp
+  8055b3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8055b6:	48 be 65 69 80 00 00 	movabs $0x806965,%rsi
+  8055bd:	00 00 00 
+  8055c0:	48 b8 7b 23 80 00 00 	movabs $0x80237b,%rax
+  8055c7:	00 00 00 
+  8055ca:	ff d0                	call   *%rax
+    return 0;
+}
+  8055cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055d1:	5d                   	pop    %rbp
+  8055d2:	c3                   	ret
+
+00000000008055d3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8055d3:	55                   	push   %rbp
+  8055d4:	48 89 e5             	mov    %rsp,%rbp
+  8055d7:	41 57                	push   %r15
+  8055d9:	41 56                	push   %r14
+  8055db:	41 55                	push   %r13
+  8055dd:	41 54                	push   %r12
+  8055df:	53                   	push   %rbx
+  8055e0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8055e7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8055ee:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8055f5:	00 00 00 00 
+  8055f9:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805600:	00 00 00 00 
+  805604:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80560b:	00 00 00 00 
+  80560f:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805616:	00 00 00 00 
+  80561a:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805621:	00 00 00 00 
+  805625:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80562c:	00 00 00 00 
+  805630:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805637:	00 
+  805638:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  80563f:	00 
+  805640:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805647:	00 
+  805648:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  80564f:	00 
+  805650:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805657:	00 
+  805658:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  80565f:	00 
+  805660:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805667:	00 
+  805668:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80566f:	00 
+  805670:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805677:	00 
+  805678:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80567f:	00 
+    for (res = 0; res < n; res += inc) {
+  805680:	48 85 d2             	test   %rdx,%rdx
+  805683:	74 7a                	je     8056ff <devcons_write+0x12c>
+  805685:	49 89 d6             	mov    %rdx,%r14
+  805688:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80568e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805693:	49 bf cb 26 80 00 00 	movabs $0x8026cb,%r15
+  80569a:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80569d:	4c 89 f3             	mov    %r14,%rbx
+  8056a0:	48 29 f3             	sub    %rsi,%rbx
+  8056a3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8056a8:	48 39 c3             	cmp    %rax,%rbx
+  8056ab:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8056af:	4c 63 eb             	movslq %ebx,%r13
+  8056b2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8056b9:	48 01 c6             	add    %rax,%rsi
+  8056bc:	4c 89 ea             	mov    %r13,%rdx
+  8056bf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8056c6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8056c9:	4c 89 ee             	mov    %r13,%rsi
+  8056cc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8056d3:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  8056da:	00 00 00 
+  8056dd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8056df:	41 01 dc             	add    %ebx,%r12d
+  8056e2:	49 63 f4             	movslq %r12d,%rsi
+  8056e5:	4c 39 f6             	cmp    %r14,%rsi
+  8056e8:	72 b3                	jb     80569d <devcons_write+0xca>
+    return res;
+  8056ea:	49 63 c4             	movslq %r12d,%rax
+}
+  8056ed:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8056f4:	5b                   	pop    %rbx
+  8056f5:	41 5c                	pop    %r12
+  8056f7:	41 5d                	pop    %r13
+  8056f9:	41 5e                	pop    %r14
+  8056fb:	41 5f                	pop    %r15
+  8056fd:	5d                   	pop    %rbp
+  8056fe:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8056ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805705:	eb e3                	jmp    8056ea <devcons_write+0x117>
+
+0000000000805707 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805707:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80570a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80570f:	48 85 c0             	test   %rax,%rax
+  805712:	74 55                	je     805769 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805714:	55                   	push   %rbp
+  805715:	48 89 e5             	mov    %rsp,%rbp
+  805718:	41 55                	push   %r13
+  80571a:	41 54                	push   %r12
+  80571c:	53                   	push   %rbx
+  80571d:	48 83 ec 08          	sub    $0x8,%rsp
+  805721:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805724:	48 bb 2b 29 80 00 00 	movabs $0x80292b,%rbx
+  80572b:	00 00 00 
+  80572e:	49 bc 3f 2a 80 00 00 	movabs $0x802a3f,%r12
+  805735:	00 00 00 
+  805738:	eb 03                	jmp    80573d <devcons_read+0x36>
+  80573a:	41 ff d4             	call   *%r12
+  80573d:	ff d3                	call   *%rbx
+  80573f:	85 c0                	test   %eax,%eax
+  805741:	74 f7                	je     80573a <devcons_read+0x33>
+    if (c < 0) return c;
+  805743:	48 63 d0             	movslq %eax,%rdx
+  805746:	78 13                	js     80575b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80574d:	83 f8 04             	cmp    $0x4,%eax
+  805750:	74 09                	je     80575b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805752:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805756:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80575b:	48 89 d0             	mov    %rdx,%rax
+  80575e:	48 83 c4 08          	add    $0x8,%rsp
+  805762:	5b                   	pop    %rbx
+  805763:	41 5c                	pop    %r12
+  805765:	41 5d                	pop    %r13
+  805767:	5d                   	pop    %rbp
+  805768:	c3                   	ret
+  805769:	48 89 d0             	mov    %rdx,%rax
+  80576c:	c3                   	ret
+
+000000000080576d <cputchar>:
+cputchar(int ch) {
+  80576d:	55                   	push   %rbp
+  80576e:	48 89 e5             	mov    %rsp,%rbp
+  805771:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805775:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805779:	be 01 00 00 00       	mov    $0x1,%esi
+  80577e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805782:	48 b8 f8 28 80 00 00 	movabs $0x8028f8,%rax
+  805789:	00 00 00 
+  80578c:	ff d0                	call   *%rax
+}
+  80578e:	c9                   	leave
+  80578f:	c3                   	ret
+
+0000000000805790 <getchar>:
+getchar(void) {
+  805790:	55                   	push   %rbp
+  805791:	48 89 e5             	mov    %rsp,%rbp
+  805794:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805798:	ba 01 00 00 00       	mov    $0x1,%edx
+  80579d:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8057a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057a6:	48 b8 e3 38 80 00 00 	movabs $0x8038e3,%rax
+  8057ad:	00 00 00 
+  8057b0:	ff d0                	call   *%rax
+  8057b2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8057b4:	85 c0                	test   %eax,%eax
+  8057b6:	78 06                	js     8057be <getchar+0x2e>
+  8057b8:	74 08                	je     8057c2 <getchar+0x32>
+  8057ba:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8057be:	89 d0                	mov    %edx,%eax
+  8057c0:	c9                   	leave
+  8057c1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8057c2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8057c7:	eb f5                	jmp    8057be <getchar+0x2e>
+
+00000000008057c9 <iscons>:
+iscons(int fdnum) {
+  8057c9:	55                   	push   %rbp
+  8057ca:	48 89 e5             	mov    %rsp,%rbp
+  8057cd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8057d1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8057d5:	48 b8 00 36 80 00 00 	movabs $0x803600,%rax
+  8057dc:	00 00 00 
+  8057df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8057e1:	85 c0                	test   %eax,%eax
+  8057e3:	78 18                	js     8057fd <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8057e5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8057e9:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8057f0:	00 00 00 
+  8057f3:	8b 00                	mov    (%rax),%eax
+  8057f5:	39 02                	cmp    %eax,(%rdx)
+  8057f7:	0f 94 c0             	sete   %al
+  8057fa:	0f b6 c0             	movzbl %al,%eax
+}
+  8057fd:	c9                   	leave
+  8057fe:	c3                   	ret
+
+00000000008057ff <opencons>:
+opencons(void) {
+  8057ff:	55                   	push   %rbp
+  805800:	48 89 e5             	mov    %rsp,%rbp
+  805803:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805807:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80580b:	48 b8 a0 35 80 00 00 	movabs $0x8035a0,%rax
+  805812:	00 00 00 
+  805815:	ff d0                	call   *%rax
+  805817:	85 c0                	test   %eax,%eax
+  805819:	78 49                	js     805864 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80581b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805820:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805825:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805829:	bf 00 00 00 00       	mov    $0x0,%edi
+  80582e:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  805835:	00 00 00 
+  805838:	ff d0                	call   *%rax
+  80583a:	85 c0                	test   %eax,%eax
+  80583c:	78 26                	js     805864 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80583e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805842:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805849:	00 00 
+  80584b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80584d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805851:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805858:	48 b8 72 35 80 00 00 	movabs $0x803572,%rax
+  80585f:	00 00 00 
+  805862:	ff d0                	call   *%rax
+}
+  805864:	c9                   	leave
+  805865:	c3                   	ret
+
+0000000000805866 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805866:	55                   	push   %rbp
+  805867:	48 89 e5             	mov    %rsp,%rbp
+  80586a:	41 56                	push   %r14
+  80586c:	41 55                	push   %r13
+  80586e:	41 54                	push   %r12
+  805870:	53                   	push   %rbx
+  805871:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805874:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80587b:	00 00 00 
+  80587e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805882:	74 27                	je     8058ab <_handle_vectored_pagefault+0x45>
+  805884:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805889:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  805890:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805893:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805896:	4c 89 e7             	mov    %r12,%rdi
+  805899:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80589e:	84 c0                	test   %al,%al
+  8058a0:	75 45                	jne    8058e7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8058a2:	48 83 c3 01          	add    $0x1,%rbx
+  8058a6:	49 3b 1e             	cmp    (%r14),%rbx
+  8058a9:	72 eb                	jb     805896 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8058ab:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8058b2:	00 
+  8058b3:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8058b8:	4d 8b 04 24          	mov    (%r12),%r8
+  8058bc:	48 ba 78 69 80 00 00 	movabs $0x806978,%rdx
+  8058c3:	00 00 00 
+  8058c6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8058cb:	48 bf a8 69 80 00 00 	movabs $0x8069a8,%rdi
+  8058d2:	00 00 00 
+  8058d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058da:	49 ba f4 18 80 00 00 	movabs $0x8018f4,%r10
+  8058e1:	00 00 00 
+  8058e4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8058e7:	5b                   	pop    %rbx
+  8058e8:	41 5c                	pop    %r12
+  8058ea:	41 5d                	pop    %r13
+  8058ec:	41 5e                	pop    %r14
+  8058ee:	5d                   	pop    %rbp
+  8058ef:	c3                   	ret
+
+00000000008058f0 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8058f0:	55                   	push   %rbp
+  8058f1:	48 89 e5             	mov    %rsp,%rbp
+  8058f4:	53                   	push   %rbx
+  8058f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8058f9:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  8058fc:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805901:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805908:	00 00 00 
+  80590b:	80 38 00             	cmpb   $0x0,(%rax)
+  80590e:	74 68                	je     805978 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805910:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805917:	00 00 00 
+  80591a:	48 8b 08             	mov    (%rax),%rcx
+  80591d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805922:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805929:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80592c:	48 85 c9             	test   %rcx,%rcx
+  80592f:	0f 84 e0 00 00 00    	je     805a15 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805935:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805939:	0f 84 c9 00 00 00    	je     805a08 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80593f:	48 83 c2 01          	add    $0x1,%rdx
+  805943:	48 39 ca             	cmp    %rcx,%rdx
+  805946:	75 ed                	jne    805935 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805948:	48 83 f9 08          	cmp    $0x8,%rcx
+  80594c:	0f 84 84 00 00 00    	je     8059d6 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805952:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805956:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  80595d:	00 00 00 
+  805960:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805967:	00 00 00 
+  80596a:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80596e:	85 f6                	test   %esi,%esi
+  805970:	0f 89 97 00 00 00    	jns    805a0d <add_pgfault_handler+0x11d>
+  805976:	eb 63                	jmp    8059db <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805978:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80597d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805982:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805989:	00 00 00 
+  80598c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805991:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  805998:	00 00 00 
+  80599b:	ff d0                	call   *%rax
+  80599d:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  80599f:	85 c0                	test   %eax,%eax
+  8059a1:	78 38                	js     8059db <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8059a3:	48 be f1 5a 80 00 00 	movabs $0x805af1,%rsi
+  8059aa:	00 00 00 
+  8059ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059b2:	48 b8 03 2d 80 00 00 	movabs $0x802d03,%rax
+  8059b9:	00 00 00 
+  8059bc:	ff d0                	call   *%rax
+  8059be:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8059c0:	85 c0                	test   %eax,%eax
+  8059c2:	78 17                	js     8059db <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8059c4:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8059cb:	00 00 00 
+  8059ce:	c6 00 01             	movb   $0x1,(%rax)
+  8059d1:	e9 3a ff ff ff       	jmp    805910 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8059d6:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8059db:	89 f1                	mov    %esi,%ecx
+  8059dd:	48 ba b6 69 80 00 00 	movabs $0x8069b6,%rdx
+  8059e4:	00 00 00 
+  8059e7:	be 42 00 00 00       	mov    $0x42,%esi
+  8059ec:	48 bf a8 69 80 00 00 	movabs $0x8069a8,%rdi
+  8059f3:	00 00 00 
+  8059f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059fb:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  805a02:	00 00 00 
+  805a05:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805a08:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805a0d:	89 f0                	mov    %esi,%eax
+  805a0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805a13:	c9                   	leave
+  805a14:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805a15:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805a1c:	00 00 00 
+  805a1f:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805a26:	48 89 d8             	mov    %rbx,%rax
+  805a29:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805a30:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805a33:	eb d8                	jmp    805a0d <add_pgfault_handler+0x11d>
+
+0000000000805a35 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805a35:	55                   	push   %rbp
+  805a36:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805a39:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805a40:	00 00 00 
+  805a43:	80 38 00             	cmpb   $0x0,(%rax)
+  805a46:	74 33                	je     805a7b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805a48:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805a4f:	00 00 00 
+  805a52:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805a57:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805a5e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805a61:	48 85 c0             	test   %rax,%rax
+  805a64:	0f 84 85 00 00 00    	je     805aef <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805a6a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805a6e:	74 40                	je     805ab0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805a70:	48 83 c1 01          	add    $0x1,%rcx
+  805a74:	48 39 c1             	cmp    %rax,%rcx
+  805a77:	75 f1                	jne    805a6a <remove_pgfault_handler+0x35>
+  805a79:	eb 74                	jmp    805aef <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805a7b:	48 b9 ce 69 80 00 00 	movabs $0x8069ce,%rcx
+  805a82:	00 00 00 
+  805a85:	48 ba b6 68 80 00 00 	movabs $0x8068b6,%rdx
+  805a8c:	00 00 00 
+  805a8f:	be 48 00 00 00       	mov    $0x48,%esi
+  805a94:	48 bf a8 69 80 00 00 	movabs $0x8069a8,%rdi
+  805a9b:	00 00 00 
+  805a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aa3:	49 b8 f4 18 80 00 00 	movabs $0x8018f4,%r8
+  805aaa:	00 00 00 
+  805aad:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805ab0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805ab7:	00 
+  805ab8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805abc:	48 29 ca             	sub    %rcx,%rdx
+  805abf:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805ac6:	00 00 00 
+  805ac9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805acd:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805ad2:	48 89 ce             	mov    %rcx,%rsi
+  805ad5:	48 b8 cb 26 80 00 00 	movabs $0x8026cb,%rax
+  805adc:	00 00 00 
+  805adf:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805ae1:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805ae8:	00 00 00 
+  805aeb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805aef:	5d                   	pop    %rbp
+  805af0:	c3                   	ret
+
+0000000000805af1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805af1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805af4:	48 b8 66 58 80 00 00 	movabs $0x805866,%rax
+  805afb:	00 00 00 
+    call *%rax
+  805afe:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805b00:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805b07:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805b08:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805b0f:	00 
+    subq $8, %rcx
+  805b10:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  805b14:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805b17:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805b1e:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805b1f:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805b23:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805b27:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805b2c:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805b31:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805b36:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805b3b:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805b40:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  805b45:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805b4a:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805b4f:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  805b54:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805b59:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805b5e:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805b63:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805b68:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805b6d:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805b71:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  805b75:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805b76:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805b77:	c3                   	ret
+
+0000000000805b78 <__rodata_start>:
+  805b78:	77 00                	ja     805b7a <__rodata_start+0x2>
+  805b7a:	72 62                	jb     805bde <__rodata_start+0x66>
+  805b7c:	00 77 62             	add    %dh,0x62(%rdi)
+  805b7f:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 ed                	add    %ch,%ch
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	ed                   	in     (%dx),%eax
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 ed                	add    %ch,%ch
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	ed                   	in     (%dx),%eax
+  805bb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bbe:	00 00                	add    %al,(%rax)
+  805bc0:	ed                   	in     (%dx),%eax
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	8c 0a                	mov    %cs,(%rdx)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	8c 0a                	mov    %cs,(%rdx)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	8c 0a                	mov    %cs,(%rdx)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	8c 0a                	mov    %cs,(%rdx)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	8c 0a                	mov    %cs,(%rdx)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	ed                   	in     (%dx),%eax
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	ed                   	in     (%dx),%eax
+  805c39:	0d 80 00 00 00       	or     $0x80,%eax
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	ed                   	in     (%dx),%eax
+  805c41:	0d 80 00 00 00       	or     $0x80,%eax
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	ed                   	in     (%dx),%eax
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	ed                   	in     (%dx),%eax
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	ed                   	in     (%dx),%eax
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	ed                   	in     (%dx),%eax
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	ed                   	in     (%dx),%eax
+  805cb9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cbe:	00 00                	add    %al,(%rax)
+  805cc0:	ed                   	in     (%dx),%eax
+  805cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	ed                   	in     (%dx),%eax
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	ed                   	in     (%dx),%eax
+  805cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cd6:	00 00                	add    %al,(%rax)
+  805cd8:	ed                   	in     (%dx),%eax
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	ed                   	in     (%dx),%eax
+  805d11:	0d 80 00 00 00       	or     $0x80,%eax
+  805d16:	00 00                	add    %al,(%rax)
+  805d18:	f4                   	hlt
+  805d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d1f:	00 ed                	add    %ch,%ch
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	2c 0b                	sub    $0xb,%al
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 ed                	add    %ch,%ch
+  805d39:	0d 80 00 00 00       	or     $0x80,%eax
+  805d3e:	00 00                	add    %al,(%rax)
+  805d40:	ed                   	in     (%dx),%eax
+  805d41:	0d 80 00 00 00       	or     $0x80,%eax
+  805d46:	00 00                	add    %al,(%rax)
+  805d48:	ed                   	in     (%dx),%eax
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	ed                   	in     (%dx),%eax
+  805d59:	0d 80 00 00 00       	or     $0x80,%eax
+  805d5e:	00 00                	add    %al,(%rax)
+  805d60:	ed                   	in     (%dx),%eax
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	ed                   	in     (%dx),%eax
+  805d69:	0d 80 00 00 00       	or     $0x80,%eax
+  805d6e:	00 00                	add    %al,(%rax)
+  805d70:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805d73:	00 00                	add    %al,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 cb                	add    %cl,%bl
+  805d79:	0d 80 00 00 00       	or     $0x80,%eax
+  805d7e:	00 00                	add    %al,(%rax)
+  805d80:	ed                   	in     (%dx),%eax
+  805d81:	0d 80 00 00 00       	or     $0x80,%eax
+  805d86:	00 00                	add    %al,(%rax)
+  805d88:	ed                   	in     (%dx),%eax
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	ed                   	in     (%dx),%eax
+  805d91:	0d 80 00 00 00       	or     $0x80,%eax
+  805d96:	00 00                	add    %al,(%rax)
+  805d98:	6a 0a                	push   $0xa
+  805d9a:	80 00 00             	addb   $0x0,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 ed                	add    %ch,%ch
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	3c 0a                	cmp    $0xa,%al
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 ed                	add    %ch,%ch
+  805dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805dc6:	00 00                	add    %al,(%rax)
+  805dc8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805dcb:	00 00                	add    %al,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 29                	add    %ch,(%rcx)
+  805dd9:	0c 80                	or     $0x80,%al
+  805ddb:	00 00                	add    %al,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 ed                	add    %ch,%ch
+  805de9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dee:	00 00                	add    %al,(%rax)
+  805df0:	1a 0b                	sbb    (%rbx),%cl
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 ed                	add    %ch,%ch
+  805df9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dfe:	00 00                	add    %al,(%rax)
+  805e00:	ce                   	(bad)
+  805e01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e07:	00 ed                	add    %ch,%ch
+  805e09:	0d 80 00 00 00       	or     $0x80,%eax
+  805e0e:	00 00                	add    %al,(%rax)
+  805e10:	ed                   	in     (%dx),%eax
+  805e11:	0d 80 00 00 00       	or     $0x80,%eax
+  805e16:	00 00                	add    %al,(%rax)
+  805e18:	f4                   	hlt
+  805e19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805e1f:	00 37                	add    %dh,(%rdi)
+  805e21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 37                	add    %dh,(%rdi)
+  805e31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805e4b:	00 00                	add    %al,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 d2                	add    %dl,%dl
+  805e51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e57:	00 d2                	add    %dl,%dl
+  805e59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e5f:	00 d2                	add    %dl,%dl
+  805e61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e67:	00 d2                	add    %dl,%dl
+  805e69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e6f:	00 d2                	add    %dl,%dl
+  805e71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e77:	00 d2                	add    %dl,%dl
+  805e79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e7f:	00 d2                	add    %dl,%dl
+  805e81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e87:	00 f6                	add    %dh,%dh
+  805e89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e8f:	00 f6                	add    %dh,%dh
+  805e91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 22                	add    %ah,(%rdx)
+  805ed1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ed7:	00 22                	add    %ah,(%rdx)
+  805ed9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805edf:	00 22                	add    %ah,(%rdx)
+  805ee1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ee7:	00 22                	add    %ah,(%rdx)
+  805ee9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805eef:	00 22                	add    %ah,(%rdx)
+  805ef1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ef7:	00 22                	add    %ah,(%rdx)
+  805ef9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f12:	80 00 00             	addb   $0x0,(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f1a:	80 00 00             	addb   $0x0,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f3a:	80 00 00             	addb   $0x0,(%rax)
+  805f3d:	00 00                	add    %al,(%rax)
+  805f3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f72:	80 00 00             	addb   $0x0,(%rax)
+  805f75:	00 00                	add    %al,(%rax)
+  805f77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f7a:	80 00 00             	addb   $0x0,(%rax)
+  805f7d:	00 00                	add    %al,(%rax)
+  805f7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 46 12             	add    %al,0x12(%rsi)
+  805f8a:	80 00 00             	addb   $0x0,(%rax)
+  805f8d:	00 00                	add    %al,(%rax)
+  805f8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f9a:	80 00 00             	addb   $0x0,(%rax)
+  805f9d:	00 00                	add    %al,(%rax)
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fb2:	80 00 00             	addb   $0x0,(%rax)
+  805fb5:	00 00                	add    %al,(%rax)
+  805fb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 22                	add    %ah,(%rdx)
+  805fd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fd7:	00 22                	add    %ah,(%rdx)
+  805fd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fdf:	00 22                	add    %ah,(%rdx)
+  805fe1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fe7:	00 22                	add    %ah,(%rdx)
+  805fe9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fef:	00 22                	add    %ah,(%rdx)
+  805ff1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ff7:	00 22                	add    %ah,(%rdx)
+  805ff9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 5f 12             	add    %bl,0x12(%rdi)
+  80601a:	80 00 00             	addb   $0x0,(%rax)
+  80601d:	00 00                	add    %al,(%rax)
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 5f 12             	add    %bl,0x12(%rdi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+  80602d:	00 00                	add    %al,(%rax)
+  80602f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806032:	80 00 00             	addb   $0x0,(%rax)
+  806035:	00 00                	add    %al,(%rax)
+  806037:	00 5f 12             	add    %bl,0x12(%rdi)
+  80603a:	80 00 00             	addb   $0x0,(%rax)
+  80603d:	00 00                	add    %al,(%rax)
+  80603f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806042:	80 00 00             	addb   $0x0,(%rax)
+  806045:	00 00                	add    %al,(%rax)
+  806047:	00 5f 12             	add    %bl,0x12(%rdi)
+  80604a:	80 00 00             	addb   $0x0,(%rax)
+  80604d:	00 00                	add    %al,(%rax)
+  80604f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806052:	80 00 00             	addb   $0x0,(%rax)
+  806055:	00 00                	add    %al,(%rax)
+  806057:	00 5f 12             	add    %bl,0x12(%rdi)
+  80605a:	80 00 00             	addb   $0x0,(%rax)
+  80605d:	00 00                	add    %al,(%rax)
+  80605f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806062:	80 00 00             	addb   $0x0,(%rax)
+  806065:	00 00                	add    %al,(%rax)
+  806067:	00 5f 12             	add    %bl,0x12(%rdi)
+  80606a:	80 00 00             	addb   $0x0,(%rax)
+  80606d:	00 00                	add    %al,(%rax)
+  80606f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806072:	80 00 00             	addb   $0x0,(%rax)
+  806075:	00 00                	add    %al,(%rax)
+  806077:	00 5f 12             	add    %bl,0x12(%rdi)
+  80607a:	80 00 00             	addb   $0x0,(%rax)
+  80607d:	00 00                	add    %al,(%rax)
+  80607f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806082:	80 00 00             	addb   $0x0,(%rax)
+  806085:	00 00                	add    %al,(%rax)
+  806087:	00 46 12             	add    %al,0x12(%rsi)
+  80608a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+00000000008060a0 <basefix.0>:
+  8060a0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  8060b0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  8060c0:	10 00 74 65 73 74 69 6e 67 20 66 6f 72 20 64 75     ..testing for du
+  8060d0:	70 20 72 61 63 65 2e 2e 2e 0a 00 70 69 70 65 3a     p race.....pipe:
+  8060e0:	20 25 69 00 75 73 65 72 2f 74 65 73 74 70 69 70      %i.user/testpip
+  8060f0:	65 72 61 63 65 2e 63 00 52 41 43 45 3a 20 70 69     erace.c.RACE: pi
+  806100:	70 65 20 61 70 70 65 61 72 73 20 63 6c 6f 73 65     pe appears close
+  806110:	64 0a 00 70 69 64 20 69 73 20 25 64 0a 00 6b 69     d..pid is %d..ki
+  806120:	64 20 69 73 20 25 64 0a 00 63 68 69 6c 64 20 64     d is %d..child d
+  806130:	6f 6e 65 20 77 69 74 68 20 6c 6f 6f 70 0a 00 63     one with loop..c
+  806140:	61 6e 6e 6f 74 20 6c 6f 6f 6b 20 75 70 20 70 5b     annot look up p[
+  806150:	30 5d 3a 20 25 69 00 0a 63 68 69 6c 64 20 64 65     0]: %i..child de
+  806160:	74 65 63 74 65 64 20 72 61 63 65 0a 00 0f 1f 00     tected race.....
+  806170:	73 6f 6d 65 68 6f 77 20 74 68 65 20 6f 74 68 65     somehow the othe
+  806180:	72 20 65 6e 64 20 6f 66 20 70 5b 30 5d 20 67 6f     r end of p[0] go
+  806190:	74 20 63 6c 6f 73 65 64 21 00 00 00 00 00 00 00     t closed!.......
+  8061a0:	0a 72 61 63 65 20 64 69 64 6e 27 74 20 68 61 70     .race didn't hap
+  8061b0:	70 65 6e 20 28 6e 75 6d 62 65 72 20 6f 66 20 74     pen (number of t
+  8061c0:	65 73 74 73 3a 20 25 64 29 0a 00 3c 75 6e 6b 6e     ests: %d)..<unkn
+  8061d0:	6f 77 6e 3e 00 0f 1f 00 5b 25 30 38 78 5d 20 75     own>....[%08x] u
+  8061e0:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  8061f0:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  806200:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  806210:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  806220:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  806230:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  806240:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  806250:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  806260:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  806270:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  806280:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806290:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  8062a0:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  8062b0:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  8062c0:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  8062d0:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  8062e0:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  8062f0:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  806300:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  806310:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  806320:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  806330:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  806340:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  806350:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  806360:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  806370:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  806380:	73 75 70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00     supported.f.....
+  806390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
+  8063a0:	3c 1c 80 00 00 00 00 00 93 22 80 00 00 00 00 00     <........"......
+  8063b0:	83 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8063c0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8063d0:	93 22 80 00 00 00 00 00 5b 1c 80 00 00 00 00 00     ."......[.......
+  8063e0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8063f0:	4f 1c 80 00 00 00 00 00 c9 1c 80 00 00 00 00 00     O...............
+  806400:	93 22 80 00 00 00 00 00 4f 1c 80 00 00 00 00 00     ."......O.......
+  806410:	95 1c 80 00 00 00 00 00 95 1c 80 00 00 00 00 00     ................
+  806420:	95 1c 80 00 00 00 00 00 95 1c 80 00 00 00 00 00     ................
+  806430:	95 1c 80 00 00 00 00 00 95 1c 80 00 00 00 00 00     ................
+  806440:	95 1c 80 00 00 00 00 00 95 1c 80 00 00 00 00 00     ................
+  806450:	95 1c 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ........."......
+  806460:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806470:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806480:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806490:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064a0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064b0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064c0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064d0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064e0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8064f0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806500:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806510:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806520:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806530:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806540:	93 22 80 00 00 00 00 00 b1 21 80 00 00 00 00 00     .".......!......
+  806550:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806560:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806570:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806580:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806590:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8065a0:	f7 1c 80 00 00 00 00 00 c6 1e 80 00 00 00 00 00     ................
+  8065b0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  8065c0:	93 22 80 00 00 00 00 00 ec 1c 80 00 00 00 00 00     ."..............
+  8065d0:	26 1d 80 00 00 00 00 00 93 22 80 00 00 00 00 00     &........"......
+  8065e0:	93 22 80 00 00 00 00 00 e1 1c 80 00 00 00 00 00     ."..............
+  8065f0:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806600:	6f 20 80 00 00 00 00 00 3e 21 80 00 00 00 00 00     o ......>!......
+  806610:	93 22 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ."......."......
+  806620:	bd 1d 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ........."......
+  806630:	9a 1f 80 00 00 00 00 00 93 22 80 00 00 00 00 00     ........."......
+  806640:	93 22 80 00 00 00 00 00 b1 21 80 00 00 00 00 00     .".......!......
+  806650:	93 22 80 00 00 00 00 00 45 1c 80 00 00 00 00 00     ."......E.......
+
+0000000000806660 <error_string>:
+	...
+  806668:	2d 62 80 00 00 00 00 00 3f 62 80 00 00 00 00 00     -b......?b......
+  806678:	4f 62 80 00 00 00 00 00 61 62 80 00 00 00 00 00     Ob......ab......
+  806688:	6f 62 80 00 00 00 00 00 83 62 80 00 00 00 00 00     ob.......b......
+  806698:	98 62 80 00 00 00 00 00 ab 62 80 00 00 00 00 00     .b.......b......
+  8066a8:	bd 62 80 00 00 00 00 00 d1 62 80 00 00 00 00 00     .b.......b......
+  8066b8:	e1 62 80 00 00 00 00 00 f4 62 80 00 00 00 00 00     .b.......b......
+  8066c8:	0b 63 80 00 00 00 00 00 21 63 80 00 00 00 00 00     .c......!c......
+  8066d8:	39 63 80 00 00 00 00 00 51 63 80 00 00 00 00 00     9c......Qc......
+  8066e8:	5e 63 80 00 00 00 00 00 00 67 80 00 00 00 00 00     ^c.......g......
+  8066f8:	72 63 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     rc......file is 
+  806708:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806718:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806728:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806738:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806748:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806758:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806768:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806778:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806788:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806798:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  8067a8:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  8067b8:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  8067c8:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 69     ult_upcall: %i.i
+  8067d8:	70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62 2f     pc_send: %i.lib/
+  8067e8:	69 70 63 2e 63 00 66 90 5b 25 30 38 78 5d 20 75     ipc.c.f.[%08x] u
+  8067f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806808:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806818:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806828:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  806838:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  806848:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  806858:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806868:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806878:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806880 <devtab>:
+  806880:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806890:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8068a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8068b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8068c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8068d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8068e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8068f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806900:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806910:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806920:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806930:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806940:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806950:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806960:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806970:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  806980:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806990:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8069a0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8069b0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8069c0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8069d0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8069e0:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  8069f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
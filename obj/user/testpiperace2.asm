@@ -0,0 +1,10622 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 2a 24 80 00 00 	movabs $0x80242a,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 1c 37 80 00 00 	movabs $0x80371c,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 1c 37 80 00 00 	movabs $0x80371c,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 6c 19 80 00 00 	movabs $0x80196c,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 f2 40 80 00 00 	movabs $0x8040f2,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 39 22 80 00 00 	movabs $0x802239,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 f2 40 80 00 00 	movabs $0x8040f2,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 39 22 80 00 00 	movabs $0x802239,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be cf 61 80 00 00 	movabs $0x8061cf,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 08 5b 80 00 00 	movabs $0x805b08,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 0a 5b 80 00 00 	movabs $0x805b0a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 0d 5b 80 00 00 	movabs $0x805b0d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 f0 4e 80 00 00 	movabs $0x804ef0,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 c7 51 80 00 00 	movabs $0x8051c7,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 06 38 80 00 00 	movabs $0x803806,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 d5 37 80 00 00 	movabs $0x8037d5,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 1c 37 80 00 00 	movabs $0x80371c,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 76 25 80 00 00 	movabs $0x802576,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 5b 80 00 00 	movabs $0x805b20,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 76 25 80 00 00 	movabs $0x802576,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 a9 25 80 00 00 	movabs $0x8025a9,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 76 25 80 00 00 	movabs $0x802576,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 5d 80 00 00 	movabs $0x805dc0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 76 25 80 00 00 	movabs $0x802576,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 76 25 80 00 00 	movabs $0x802576,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 ce 27 80 00 00 	movabs $0x8027ce,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 b5 02 00 00       	call   8017b4 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  801512:	48 bf 68 60 80 00 00 	movabs $0x806068,%rdi
+  801519:	00 00 00 
+  80151c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801521:	48 ba d0 19 80 00 00 	movabs $0x8019d0,%rdx
+  801528:	00 00 00 
+  80152b:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  80152d:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  801531:	48 b8 97 44 80 00 00 	movabs $0x804497,%rax
+  801538:	00 00 00 
+  80153b:	ff d0                	call   *%rax
+  80153d:	85 c0                	test   %eax,%eax
+  80153f:	0f 88 98 00 00 00    	js     8015dd <umain+0xdc>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  801545:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  801554:	85 c0                	test   %eax,%eax
+  801556:	0f 88 ae 00 00 00    	js     80160a <umain+0x109>
+        panic("fork: %i", r);
+    if (r == 0) {
+  80155c:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  801560:	0f 84 d1 00 00 00    	je     801637 <umain+0x136>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  801566:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  801569:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80156e:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801575:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  80157c:	00 00 00 
+  80157f:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  801582:	49 bc a3 46 80 00 00 	movabs $0x8046a3,%r12
+  801589:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  80158c:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+  801592:	83 f8 02             	cmp    $0x2,%eax
+  801595:	0f 85 43 01 00 00    	jne    8016de <umain+0x1dd>
+        if (pipeisclosed(p[0]) != 0) {
+  80159b:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80159e:	41 ff d4             	call   *%r12
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	74 e7                	je     80158c <umain+0x8b>
+            cprintf("\nRACE: pipe appears closed\n");
+  8015a5:	48 bf dc 60 80 00 00 	movabs $0x8060dc,%rdi
+  8015ac:	00 00 00 
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	48 ba d0 19 80 00 00 	movabs $0x8019d0,%rdx
+  8015bb:	00 00 00 
+  8015be:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8015c0:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8015c3:	48 b8 23 29 80 00 00 	movabs $0x802923,%rax
+  8015ca:	00 00 00 
+  8015cd:	ff d0                	call   *%rax
+            exit();
+  8015cf:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8015d6:	00 00 00 
+  8015d9:	ff d0                	call   *%rax
+  8015db:	eb af                	jmp    80158c <umain+0x8b>
+        panic("pipe: %i", r);
+  8015dd:	89 c1                	mov    %eax,%ecx
+  8015df:	48 ba ba 60 80 00 00 	movabs $0x8060ba,%rdx
+  8015e6:	00 00 00 
+  8015e9:	be 0c 00 00 00       	mov    $0xc,%esi
+  8015ee:	48 bf c3 60 80 00 00 	movabs $0x8060c3,%rdi
+  8015f5:	00 00 00 
+  8015f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fd:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  801604:	00 00 00 
+  801607:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80160a:	89 c1                	mov    %eax,%ecx
+  80160c:	48 ba bc 66 80 00 00 	movabs $0x8066bc,%rdx
+  801613:	00 00 00 
+  801616:	be 0e 00 00 00       	mov    $0xe,%esi
+  80161b:	48 bf c3 60 80 00 00 	movabs $0x8060c3,%rdi
+  801622:	00 00 00 
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  801631:	00 00 00 
+  801634:	41 ff d0             	call   *%r8
+        close(p[1]);
+  801637:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80163a:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  801646:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  801649:	49 bf d8 60 80 00 00 	movabs $0x8060d8,%r15
+  801650:	00 00 00 
+  801653:	49 be d0 19 80 00 00 	movabs $0x8019d0,%r14
+  80165a:	00 00 00 
+            dup(p[0], 10);
+  80165d:	49 bd ca 34 80 00 00 	movabs $0x8034ca,%r13
+  801664:	00 00 00 
+            sys_yield();
+  801667:	49 bc cb 29 80 00 00 	movabs $0x8029cb,%r12
+  80166e:	00 00 00 
+  801671:	eb 2d                	jmp    8016a0 <umain+0x19f>
+            dup(p[0], 10);
+  801673:	be 0a 00 00 00       	mov    $0xa,%esi
+  801678:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80167b:	41 ff d5             	call   *%r13
+            sys_yield();
+  80167e:	41 ff d4             	call   *%r12
+            close(10);
+  801681:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801686:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80168d:	00 00 00 
+  801690:	ff d0                	call   *%rax
+            sys_yield();
+  801692:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  801695:	83 c3 01             	add    $0x1,%ebx
+  801698:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80169e:	74 2d                	je     8016cd <umain+0x1cc>
+            if (i % 10 == 0)
+  8016a0:	48 63 c3             	movslq %ebx,%rax
+  8016a3:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8016aa:	48 c1 f8 22          	sar    $0x22,%rax
+  8016ae:	89 da                	mov    %ebx,%edx
+  8016b0:	c1 fa 1f             	sar    $0x1f,%edx
+  8016b3:	29 d0                	sub    %edx,%eax
+  8016b5:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8016b8:	01 c0                	add    %eax,%eax
+  8016ba:	39 c3                	cmp    %eax,%ebx
+  8016bc:	75 b5                	jne    801673 <umain+0x172>
+                cprintf("%d.", i);
+  8016be:	89 de                	mov    %ebx,%esi
+  8016c0:	4c 89 ff             	mov    %r15,%rdi
+  8016c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c8:	41 ff d6             	call   *%r14
+  8016cb:	eb a6                	jmp    801673 <umain+0x172>
+        exit();
+  8016cd:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+  8016d9:	e9 88 fe ff ff       	jmp    801566 <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  8016de:	48 bf f8 60 80 00 00 	movabs $0x8060f8,%rdi
+  8016e5:	00 00 00 
+  8016e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ed:	48 ba d0 19 80 00 00 	movabs $0x8019d0,%rdx
+  8016f4:	00 00 00 
+  8016f7:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  8016f9:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8016fc:	48 b8 a3 46 80 00 00 	movabs $0x8046a3,%rax
+  801703:	00 00 00 
+  801706:	ff d0                	call   *%rax
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	75 51                	jne    80175d <umain+0x25c>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  80170c:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  801710:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  801713:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  80171a:	00 00 00 
+  80171d:	ff d0                	call   *%rax
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 64                	js     801787 <umain+0x286>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  801723:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  801727:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  80172e:	00 00 00 
+  801731:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  801733:	48 bf 26 61 80 00 00 	movabs $0x806126,%rdi
+  80173a:	00 00 00 
+  80173d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801742:	48 ba d0 19 80 00 00 	movabs $0x8019d0,%rdx
+  801749:	00 00 00 
+  80174c:	ff d2                	call   *%rdx
+}
+  80174e:	48 83 c4 28          	add    $0x28,%rsp
+  801752:	5b                   	pop    %rbx
+  801753:	41 5c                	pop    %r12
+  801755:	41 5d                	pop    %r13
+  801757:	41 5e                	pop    %r14
+  801759:	41 5f                	pop    %r15
+  80175b:	5d                   	pop    %rbp
+  80175c:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  80175d:	48 ba 90 60 80 00 00 	movabs $0x806090,%rdx
+  801764:	00 00 00 
+  801767:	be 40 00 00 00       	mov    $0x40,%esi
+  80176c:	48 bf c3 60 80 00 00 	movabs $0x8060c3,%rdi
+  801773:	00 00 00 
+  801776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177b:	48 b9 80 18 80 00 00 	movabs $0x801880,%rcx
+  801782:	00 00 00 
+  801785:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  801787:	89 c1                	mov    %eax,%ecx
+  801789:	48 ba 0e 61 80 00 00 	movabs $0x80610e,%rdx
+  801790:	00 00 00 
+  801793:	be 42 00 00 00       	mov    $0x42,%esi
+  801798:	48 bf c3 60 80 00 00 	movabs $0x8060c3,%rdi
+  80179f:	00 00 00 
+  8017a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a7:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  8017ae:	00 00 00 
+  8017b1:	41 ff d0             	call   *%r8
+
+00000000008017b4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8017b4:	55                   	push   %rbp
+  8017b5:	48 89 e5             	mov    %rsp,%rbp
+  8017b8:	41 56                	push   %r14
+  8017ba:	41 55                	push   %r13
+  8017bc:	41 54                	push   %r12
+  8017be:	53                   	push   %rbx
+  8017bf:	41 89 fd             	mov    %edi,%r13d
+  8017c2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8017c5:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8017cc:	00 00 00 
+  8017cf:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8017d6:	00 00 00 
+  8017d9:	48 39 c2             	cmp    %rax,%rdx
+  8017dc:	73 17                	jae    8017f5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8017de:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8017e1:	49 89 c4             	mov    %rax,%r12
+  8017e4:	48 83 c3 08          	add    $0x8,%rbx
+  8017e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ed:	ff 53 f8             	call   *-0x8(%rbx)
+  8017f0:	4c 39 e3             	cmp    %r12,%rbx
+  8017f3:	72 ef                	jb     8017e4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  8017f5:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  8017fc:	00 00 00 
+  8017ff:	ff d0                	call   *%rax
+  801801:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801806:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80180d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801814:	00 00 00 
+  801817:	48 01 d0             	add    %rdx,%rax
+  80181a:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801821:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801824:	45 85 ed             	test   %r13d,%r13d
+  801827:	7e 0d                	jle    801836 <libmain+0x82>
+  801829:	49 8b 06             	mov    (%r14),%rax
+  80182c:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801833:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801836:	4c 89 f6             	mov    %r14,%rsi
+  801839:	44 89 ef             	mov    %r13d,%edi
+  80183c:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801848:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+#endif
+}
+  801854:	5b                   	pop    %rbx
+  801855:	41 5c                	pop    %r12
+  801857:	41 5d                	pop    %r13
+  801859:	41 5e                	pop    %r14
+  80185b:	5d                   	pop    %rbp
+  80185c:	c3                   	ret
+
+000000000080185d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801861:	48 b8 a2 34 80 00 00 	movabs $0x8034a2,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80186d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801872:	48 b8 23 29 80 00 00 	movabs $0x802923,%rax
+  801879:	00 00 00 
+  80187c:	ff d0                	call   *%rax
+}
+  80187e:	5d                   	pop    %rbp
+  80187f:	c3                   	ret
+
+0000000000801880 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801880:	55                   	push   %rbp
+  801881:	48 89 e5             	mov    %rsp,%rbp
+  801884:	41 56                	push   %r14
+  801886:	41 55                	push   %r13
+  801888:	41 54                	push   %r12
+  80188a:	53                   	push   %rbx
+  80188b:	48 83 ec 50          	sub    $0x50,%rsp
+  80188f:	49 89 fc             	mov    %rdi,%r12
+  801892:	41 89 f5             	mov    %esi,%r13d
+  801895:	48 89 d3             	mov    %rdx,%rbx
+  801898:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80189c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8018a0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8018a4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8018ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018af:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8018b3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8018b7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8018bb:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8018c2:	00 00 00 
+  8018c5:	4c 8b 30             	mov    (%rax),%r14
+  8018c8:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  8018cf:	00 00 00 
+  8018d2:	ff d0                	call   *%rax
+  8018d4:	89 c6                	mov    %eax,%esi
+  8018d6:	45 89 e8             	mov    %r13d,%r8d
+  8018d9:	4c 89 e1             	mov    %r12,%rcx
+  8018dc:	4c 89 f2             	mov    %r14,%rdx
+  8018df:	48 bf 48 61 80 00 00 	movabs $0x806148,%rdi
+  8018e6:	00 00 00 
+  8018e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ee:	49 bc d0 19 80 00 00 	movabs $0x8019d0,%r12
+  8018f5:	00 00 00 
+  8018f8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8018fb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8018ff:	48 89 df             	mov    %rbx,%rdi
+  801902:	48 b8 6c 19 80 00 00 	movabs $0x80196c,%rax
+  801909:	00 00 00 
+  80190c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80190e:	48 bf f6 60 80 00 00 	movabs $0x8060f6,%rdi
+  801915:	00 00 00 
+  801918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80191d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801920:	cc                   	int3
+  801921:	eb fd                	jmp    801920 <_panic+0xa0>
+
+0000000000801923 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+  801927:	53                   	push   %rbx
+  801928:	48 83 ec 08          	sub    $0x8,%rsp
+  80192c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80192f:	8b 06                	mov    (%rsi),%eax
+  801931:	8d 50 01             	lea    0x1(%rax),%edx
+  801934:	89 16                	mov    %edx,(%rsi)
+  801936:	48 98                	cltq
+  801938:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80193d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801943:	74 0a                	je     80194f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801945:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801949:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80194d:	c9                   	leave
+  80194e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80194f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801953:	be ff 00 00 00       	mov    $0xff,%esi
+  801958:	48 b8 84 28 80 00 00 	movabs $0x802884,%rax
+  80195f:	00 00 00 
+  801962:	ff d0                	call   *%rax
+        state->offset = 0;
+  801964:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80196a:	eb d9                	jmp    801945 <putch+0x22>
+
+000000000080196c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80196c:	55                   	push   %rbp
+  80196d:	48 89 e5             	mov    %rsp,%rbp
+  801970:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801977:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80197a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801981:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80198e:	48 89 f1             	mov    %rsi,%rcx
+  801991:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801998:	48 bf 23 19 80 00 00 	movabs $0x801923,%rdi
+  80199f:	00 00 00 
+  8019a2:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  8019a9:	00 00 00 
+  8019ac:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8019ae:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8019b5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8019bc:	48 b8 84 28 80 00 00 	movabs $0x802884,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8019c8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8019ce:	c9                   	leave
+  8019cf:	c3                   	ret
+
+00000000008019d0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8019d0:	55                   	push   %rbp
+  8019d1:	48 89 e5             	mov    %rsp,%rbp
+  8019d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8019d8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8019dc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8019e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8019ec:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8019f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8019fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8019ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a03:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a07:	48 b8 6c 19 80 00 00 	movabs $0x80196c,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a13:	c9                   	leave
+  801a14:	c3                   	ret
+
+0000000000801a15 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a15:	55                   	push   %rbp
+  801a16:	48 89 e5             	mov    %rsp,%rbp
+  801a19:	41 57                	push   %r15
+  801a1b:	41 56                	push   %r14
+  801a1d:	41 55                	push   %r13
+  801a1f:	41 54                	push   %r12
+  801a21:	53                   	push   %rbx
+  801a22:	48 83 ec 18          	sub    $0x18,%rsp
+  801a26:	49 89 fc             	mov    %rdi,%r12
+  801a29:	49 89 f5             	mov    %rsi,%r13
+  801a2c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a30:	8b 45 10             	mov    0x10(%rbp),%eax
+  801a33:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801a36:	41 89 cf             	mov    %ecx,%r15d
+  801a39:	4c 39 fa             	cmp    %r15,%rdx
+  801a3c:	73 5b                	jae    801a99 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801a3e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801a42:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801a46:	85 db                	test   %ebx,%ebx
+  801a48:	7e 0e                	jle    801a58 <print_num+0x43>
+            putch(padc, put_arg);
+  801a4a:	4c 89 ee             	mov    %r13,%rsi
+  801a4d:	44 89 f7             	mov    %r14d,%edi
+  801a50:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801a53:	83 eb 01             	sub    $0x1,%ebx
+  801a56:	75 f2                	jne    801a4a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801a58:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801a5c:	48 b9 7c 61 80 00 00 	movabs $0x80617c,%rcx
+  801a63:	00 00 00 
+  801a66:	48 b8 6b 61 80 00 00 	movabs $0x80616b,%rax
+  801a6d:	00 00 00 
+  801a70:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801a74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7d:	49 f7 f7             	div    %r15
+  801a80:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801a84:	4c 89 ee             	mov    %r13,%rsi
+  801a87:	41 ff d4             	call   *%r12
+}
+  801a8a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a8e:	5b                   	pop    %rbx
+  801a8f:	41 5c                	pop    %r12
+  801a91:	41 5d                	pop    %r13
+  801a93:	41 5e                	pop    %r14
+  801a95:	41 5f                	pop    %r15
+  801a97:	5d                   	pop    %rbp
+  801a98:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801a99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa2:	49 f7 f7             	div    %r15
+  801aa5:	48 83 ec 08          	sub    $0x8,%rsp
+  801aa9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801aad:	52                   	push   %rdx
+  801aae:	45 0f be c9          	movsbl %r9b,%r9d
+  801ab2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801ab6:	48 89 c2             	mov    %rax,%rdx
+  801ab9:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  801ac0:	00 00 00 
+  801ac3:	ff d0                	call   *%rax
+  801ac5:	48 83 c4 10          	add    $0x10,%rsp
+  801ac9:	eb 8d                	jmp    801a58 <print_num+0x43>
+
+0000000000801acb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801acb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801acf:	48 8b 06             	mov    (%rsi),%rax
+  801ad2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801ad6:	73 0a                	jae    801ae2 <sprintputch+0x17>
+        *state->start++ = ch;
+  801ad8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801adc:	48 89 16             	mov    %rdx,(%rsi)
+  801adf:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801ae2:	c3                   	ret
+
+0000000000801ae3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801ae3:	55                   	push   %rbp
+  801ae4:	48 89 e5             	mov    %rsp,%rbp
+  801ae7:	48 83 ec 50          	sub    $0x50,%rsp
+  801aeb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801aef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801af3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801af7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801afe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b06:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b0e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b12:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  801b19:	00 00 00 
+  801b1c:	ff d0                	call   *%rax
+}
+  801b1e:	c9                   	leave
+  801b1f:	c3                   	ret
+
+0000000000801b20 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b20:	55                   	push   %rbp
+  801b21:	48 89 e5             	mov    %rsp,%rbp
+  801b24:	41 57                	push   %r15
+  801b26:	41 56                	push   %r14
+  801b28:	41 55                	push   %r13
+  801b2a:	41 54                	push   %r12
+  801b2c:	53                   	push   %rbx
+  801b2d:	48 83 ec 38          	sub    $0x38,%rsp
+  801b31:	49 89 fe             	mov    %rdi,%r14
+  801b34:	49 89 f5             	mov    %rsi,%r13
+  801b37:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801b3a:	48 8b 01             	mov    (%rcx),%rax
+  801b3d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801b41:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801b45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b49:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801b4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801b51:	eb 0d                	jmp    801b60 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801b53:	40 0f b6 ff          	movzbl %dil,%edi
+  801b57:	4c 89 ee             	mov    %r13,%rsi
+  801b5a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801b5d:	4c 89 e3             	mov    %r12,%rbx
+  801b60:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801b64:	0f b6 3b             	movzbl (%rbx),%edi
+  801b67:	40 80 ff 25          	cmp    $0x25,%dil
+  801b6b:	74 14                	je     801b81 <vprintfmt+0x61>
+            if (!ch) return;
+  801b6d:	40 84 ff             	test   %dil,%dil
+  801b70:	75 e1                	jne    801b53 <vprintfmt+0x33>
+}
+  801b72:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b76:	5b                   	pop    %rbx
+  801b77:	41 5c                	pop    %r12
+  801b79:	41 5d                	pop    %r13
+  801b7b:	41 5e                	pop    %r14
+  801b7d:	41 5f                	pop    %r15
+  801b7f:	5d                   	pop    %rbp
+  801b80:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801b81:	be 00 00 00 00       	mov    $0x0,%esi
+  801b86:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801b8f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b95:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801b9c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801ba0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801ba5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801baa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801bad:	83 e8 23             	sub    $0x23,%eax
+  801bb0:	3c 57                	cmp    $0x57,%al
+  801bb2:	0f 87 67 06 00 00    	ja     80221f <vprintfmt+0x6ff>
+  801bb8:	0f b6 c0             	movzbl %al,%eax
+  801bbb:	48 b9 00 63 80 00 00 	movabs $0x806300,%rcx
+  801bc2:	00 00 00 
+  801bc5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801bc8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801bcb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801bcf:	eb cf                	jmp    801ba0 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801bd1:	49 89 dc             	mov    %rbx,%r12
+  801bd4:	be 01 00 00 00       	mov    $0x1,%esi
+  801bd9:	eb c5                	jmp    801ba0 <vprintfmt+0x80>
+            padc = ch;
+  801bdb:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801bdf:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801be2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801be5:	eb b9                	jmp    801ba0 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801be7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bea:	83 f8 2f             	cmp    $0x2f,%eax
+  801bed:	77 24                	ja     801c13 <vprintfmt+0xf3>
+  801bef:	89 c1                	mov    %eax,%ecx
+  801bf1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801bf5:	83 c0 08             	add    $0x8,%eax
+  801bf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bfb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801bfe:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c01:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c05:	79 99                	jns    801ba0 <vprintfmt+0x80>
+                width = precision;
+  801c07:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c0b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c11:	eb 8d                	jmp    801ba0 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c13:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c17:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c1f:	eb da                	jmp    801bfb <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c21:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c26:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c2a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801c30:	3c 39                	cmp    $0x39,%al
+  801c32:	77 1c                	ja     801c50 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801c34:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801c38:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801c3c:	0f b6 c0             	movzbl %al,%eax
+  801c3f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c44:	0f b6 03             	movzbl (%rbx),%eax
+  801c47:	3c 39                	cmp    $0x39,%al
+  801c49:	76 e9                	jbe    801c34 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801c4b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801c4e:	eb b1                	jmp    801c01 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801c50:	49 89 dc             	mov    %rbx,%r12
+  801c53:	eb ac                	jmp    801c01 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801c55:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801c58:	85 c9                	test   %ecx,%ecx
+  801c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5f:	0f 49 c1             	cmovns %ecx,%eax
+  801c62:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801c65:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c68:	e9 33 ff ff ff       	jmp    801ba0 <vprintfmt+0x80>
+            lflag++;
+  801c6d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c70:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c73:	e9 28 ff ff ff       	jmp    801ba0 <vprintfmt+0x80>
+            lflag--;
+  801c78:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c7b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c7e:	e9 1d ff ff ff       	jmp    801ba0 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801c83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c86:	83 f8 2f             	cmp    $0x2f,%eax
+  801c89:	77 19                	ja     801ca4 <vprintfmt+0x184>
+  801c8b:	89 c2                	mov    %eax,%edx
+  801c8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c91:	83 c0 08             	add    $0x8,%eax
+  801c94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c97:	8b 3a                	mov    (%rdx),%edi
+  801c99:	4c 89 ee             	mov    %r13,%rsi
+  801c9c:	41 ff d6             	call   *%r14
+            break;
+  801c9f:	e9 bc fe ff ff       	jmp    801b60 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801ca4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ca8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb0:	eb e5                	jmp    801c97 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  801cb8:	77 5a                	ja     801d14 <vprintfmt+0x1f4>
+  801cba:	89 c2                	mov    %eax,%edx
+  801cbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc0:	83 c0 08             	add    $0x8,%eax
+  801cc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801cc6:	8b 02                	mov    (%rdx),%eax
+  801cc8:	89 c1                	mov    %eax,%ecx
+  801cca:	f7 d9                	neg    %ecx
+  801ccc:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801ccf:	83 f9 13             	cmp    $0x13,%ecx
+  801cd2:	7f 4e                	jg     801d22 <vprintfmt+0x202>
+  801cd4:	48 63 c1             	movslq %ecx,%rax
+  801cd7:	48 ba c0 65 80 00 00 	movabs $0x8065c0,%rdx
+  801cde:	00 00 00 
+  801ce1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801ce5:	48 85 c0             	test   %rax,%rax
+  801ce8:	74 38                	je     801d22 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801cea:	48 89 c1             	mov    %rax,%rcx
+  801ced:	48 ba 08 68 80 00 00 	movabs $0x806808,%rdx
+  801cf4:	00 00 00 
+  801cf7:	4c 89 ee             	mov    %r13,%rsi
+  801cfa:	4c 89 f7             	mov    %r14,%rdi
+  801cfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d02:	49 b8 e3 1a 80 00 00 	movabs $0x801ae3,%r8
+  801d09:	00 00 00 
+  801d0c:	41 ff d0             	call   *%r8
+  801d0f:	e9 4c fe ff ff       	jmp    801b60 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d20:	eb a4                	jmp    801cc6 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d22:	48 ba 94 61 80 00 00 	movabs $0x806194,%rdx
+  801d29:	00 00 00 
+  801d2c:	4c 89 ee             	mov    %r13,%rsi
+  801d2f:	4c 89 f7             	mov    %r14,%rdi
+  801d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d37:	49 b8 e3 1a 80 00 00 	movabs $0x801ae3,%r8
+  801d3e:	00 00 00 
+  801d41:	41 ff d0             	call   *%r8
+  801d44:	e9 17 fe ff ff       	jmp    801b60 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801d4f:	77 6c                	ja     801dbd <vprintfmt+0x29d>
+  801d51:	89 c2                	mov    %eax,%edx
+  801d53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d57:	83 c0 08             	add    $0x8,%eax
+  801d5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d5d:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801d60:	48 85 f6             	test   %rsi,%rsi
+  801d63:	48 b8 8d 61 80 00 00 	movabs $0x80618d,%rax
+  801d6a:	00 00 00 
+  801d6d:	48 0f 45 c6          	cmovne %rsi,%rax
+  801d71:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801d75:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d79:	7e 06                	jle    801d81 <vprintfmt+0x261>
+  801d7b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801d7f:	75 4a                	jne    801dcb <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d81:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d85:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d89:	0f b6 00             	movzbl (%rax),%eax
+  801d8c:	84 c0                	test   %al,%al
+  801d8e:	0f 85 9a 00 00 00    	jne    801e2e <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801d94:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d97:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	0f 8e bd fd ff ff    	jle    801b60 <vprintfmt+0x40>
+  801da3:	4c 89 ee             	mov    %r13,%rsi
+  801da6:	bf 20 00 00 00       	mov    $0x20,%edi
+  801dab:	41 ff d6             	call   *%r14
+  801dae:	41 83 ec 01          	sub    $0x1,%r12d
+  801db2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801db6:	75 eb                	jne    801da3 <vprintfmt+0x283>
+  801db8:	e9 a3 fd ff ff       	jmp    801b60 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc9:	eb 92                	jmp    801d5d <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801dcb:	49 63 f7             	movslq %r15d,%rsi
+  801dce:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801dd2:	48 b8 e4 22 80 00 00 	movabs $0x8022e4,%rax
+  801dd9:	00 00 00 
+  801ddc:	ff d0                	call   *%rax
+  801dde:	48 89 c2             	mov    %rax,%rdx
+  801de1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801de4:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801de6:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801de9:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801dec:	85 c0                	test   %eax,%eax
+  801dee:	7e 91                	jle    801d81 <vprintfmt+0x261>
+  801df0:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801df5:	4c 89 ee             	mov    %r13,%rsi
+  801df8:	44 89 e7             	mov    %r12d,%edi
+  801dfb:	41 ff d6             	call   *%r14
+  801dfe:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e05:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e08:	75 eb                	jne    801df5 <vprintfmt+0x2d5>
+  801e0a:	e9 72 ff ff ff       	jmp    801d81 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e0f:	0f b6 f8             	movzbl %al,%edi
+  801e12:	4c 89 ee             	mov    %r13,%rsi
+  801e15:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e18:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e1c:	49 83 c4 01          	add    $0x1,%r12
+  801e20:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e26:	84 c0                	test   %al,%al
+  801e28:	0f 84 66 ff ff ff    	je     801d94 <vprintfmt+0x274>
+  801e2e:	45 85 ff             	test   %r15d,%r15d
+  801e31:	78 0a                	js     801e3d <vprintfmt+0x31d>
+  801e33:	41 83 ef 01          	sub    $0x1,%r15d
+  801e37:	0f 88 57 ff ff ff    	js     801d94 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e3d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801e41:	74 cc                	je     801e0f <vprintfmt+0x2ef>
+  801e43:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801e46:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801e4b:	80 fa 5e             	cmp    $0x5e,%dl
+  801e4e:	77 c2                	ja     801e12 <vprintfmt+0x2f2>
+  801e50:	eb bd                	jmp    801e0f <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801e52:	40 84 f6             	test   %sil,%sil
+  801e55:	75 26                	jne    801e7d <vprintfmt+0x35d>
+    switch (lflag) {
+  801e57:	85 d2                	test   %edx,%edx
+  801e59:	74 59                	je     801eb4 <vprintfmt+0x394>
+  801e5b:	83 fa 01             	cmp    $0x1,%edx
+  801e5e:	74 7b                	je     801edb <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801e60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e63:	83 f8 2f             	cmp    $0x2f,%eax
+  801e66:	0f 87 96 00 00 00    	ja     801f02 <vprintfmt+0x3e2>
+  801e6c:	89 c2                	mov    %eax,%edx
+  801e6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e72:	83 c0 08             	add    $0x8,%eax
+  801e75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e78:	4c 8b 22             	mov    (%rdx),%r12
+  801e7b:	eb 17                	jmp    801e94 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801e7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e80:	83 f8 2f             	cmp    $0x2f,%eax
+  801e83:	77 21                	ja     801ea6 <vprintfmt+0x386>
+  801e85:	89 c2                	mov    %eax,%edx
+  801e87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e8b:	83 c0 08             	add    $0x8,%eax
+  801e8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e91:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801e94:	4d 85 e4             	test   %r12,%r12
+  801e97:	78 7a                	js     801f13 <vprintfmt+0x3f3>
+            num = i;
+  801e99:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801e9c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801ea1:	e9 56 02 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ea6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb2:	eb dd                	jmp    801e91 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801eb4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801eb7:	83 f8 2f             	cmp    $0x2f,%eax
+  801eba:	77 11                	ja     801ecd <vprintfmt+0x3ad>
+  801ebc:	89 c2                	mov    %eax,%edx
+  801ebe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec2:	83 c0 08             	add    $0x8,%eax
+  801ec5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ec8:	4c 63 22             	movslq (%rdx),%r12
+  801ecb:	eb c7                	jmp    801e94 <vprintfmt+0x374>
+  801ecd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ed5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ed9:	eb ed                	jmp    801ec8 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801edb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ede:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee1:	77 11                	ja     801ef4 <vprintfmt+0x3d4>
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee9:	83 c0 08             	add    $0x8,%eax
+  801eec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eef:	4c 8b 22             	mov    (%rdx),%r12
+  801ef2:	eb a0                	jmp    801e94 <vprintfmt+0x374>
+  801ef4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ef8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f00:	eb ed                	jmp    801eef <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f0e:	e9 65 ff ff ff       	jmp    801e78 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f13:	4c 89 ee             	mov    %r13,%rsi
+  801f16:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f1b:	41 ff d6             	call   *%r14
+                i = -i;
+  801f1e:	49 f7 dc             	neg    %r12
+  801f21:	e9 73 ff ff ff       	jmp    801e99 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f26:	40 84 f6             	test   %sil,%sil
+  801f29:	75 2e                	jne    801f59 <vprintfmt+0x439>
+    switch (lflag) {
+  801f2b:	85 d2                	test   %edx,%edx
+  801f2d:	7f 59                	jg     801f88 <vprintfmt+0x468>
+  801f2f:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f32:	7d 7a                	jge    801fae <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801f34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f37:	83 f8 2f             	cmp    $0x2f,%eax
+  801f3a:	0f 87 aa 00 00 00    	ja     801fea <vprintfmt+0x4ca>
+  801f40:	89 c2                	mov    %eax,%edx
+  801f42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f46:	83 c0 08             	add    $0x8,%eax
+  801f49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f4c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f54:	e9 a3 01 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f5c:	83 f8 2f             	cmp    $0x2f,%eax
+  801f5f:	77 19                	ja     801f7a <vprintfmt+0x45a>
+  801f61:	89 c2                	mov    %eax,%edx
+  801f63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f67:	83 c0 08             	add    $0x8,%eax
+  801f6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f6d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f75:	e9 82 01 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+  801f7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f86:	eb e5                	jmp    801f6d <vprintfmt+0x44d>
+    switch (lflag) {
+  801f88:	83 fa 01             	cmp    $0x1,%edx
+  801f8b:	75 a7                	jne    801f34 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801f8d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f90:	83 f8 2f             	cmp    $0x2f,%eax
+  801f93:	77 47                	ja     801fdc <vprintfmt+0x4bc>
+  801f95:	89 c2                	mov    %eax,%edx
+  801f97:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f9b:	83 c0 08             	add    $0x8,%eax
+  801f9e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fa4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801fa9:	e9 4e 01 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb1:	83 f8 2f             	cmp    $0x2f,%eax
+  801fb4:	77 18                	ja     801fce <vprintfmt+0x4ae>
+  801fb6:	89 c2                	mov    %eax,%edx
+  801fb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fbc:	83 c0 08             	add    $0x8,%eax
+  801fbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801fc4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801fc9:	e9 2e 01 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+  801fce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fda:	eb e6                	jmp    801fc2 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801fdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fe4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fe8:	eb b7                	jmp    801fa1 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801fea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ff6:	e9 51 ff ff ff       	jmp    801f4c <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801ffb:	40 84 f6             	test   %sil,%sil
+  801ffe:	75 2e                	jne    80202e <vprintfmt+0x50e>
+    switch (lflag) {
+  802000:	85 d2                	test   %edx,%edx
+  802002:	7f 59                	jg     80205d <vprintfmt+0x53d>
+  802004:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802007:	7d 77                	jge    802080 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802009:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80200c:	83 f8 2f             	cmp    $0x2f,%eax
+  80200f:	0f 87 a4 00 00 00    	ja     8020b9 <vprintfmt+0x599>
+  802015:	89 c2                	mov    %eax,%edx
+  802017:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80201b:	83 c0 08             	add    $0x8,%eax
+  80201e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802021:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802024:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802029:	e9 ce 00 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80202e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802031:	83 f8 2f             	cmp    $0x2f,%eax
+  802034:	77 19                	ja     80204f <vprintfmt+0x52f>
+  802036:	89 c2                	mov    %eax,%edx
+  802038:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80203c:	83 c0 08             	add    $0x8,%eax
+  80203f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802042:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802045:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80204a:	e9 ad 00 00 00       	jmp    8020fc <vprintfmt+0x5dc>
+  80204f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802053:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802057:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80205b:	eb e5                	jmp    802042 <vprintfmt+0x522>
+    switch (lflag) {
+  80205d:	83 fa 01             	cmp    $0x1,%edx
+  802060:	75 a7                	jne    802009 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802062:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802065:	83 f8 2f             	cmp    $0x2f,%eax
+  802068:	77 41                	ja     8020ab <vprintfmt+0x58b>
+  80206a:	89 c2                	mov    %eax,%edx
+  80206c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802070:	83 c0 08             	add    $0x8,%eax
+  802073:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802076:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802079:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80207e:	eb 7c                	jmp    8020fc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802080:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802083:	83 f8 2f             	cmp    $0x2f,%eax
+  802086:	77 15                	ja     80209d <vprintfmt+0x57d>
+  802088:	89 c2                	mov    %eax,%edx
+  80208a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80208e:	83 c0 08             	add    $0x8,%eax
+  802091:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802094:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802096:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80209b:	eb 5f                	jmp    8020fc <vprintfmt+0x5dc>
+  80209d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020a9:	eb e9                	jmp    802094 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8020ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b7:	eb bd                	jmp    802076 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  8020b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020c5:	e9 57 ff ff ff       	jmp    802021 <vprintfmt+0x501>
+            putch('0', put_arg);
+  8020ca:	4c 89 ee             	mov    %r13,%rsi
+  8020cd:	bf 30 00 00 00       	mov    $0x30,%edi
+  8020d2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8020d5:	4c 89 ee             	mov    %r13,%rsi
+  8020d8:	bf 78 00 00 00       	mov    $0x78,%edi
+  8020dd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8020e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8020e6:	77 47                	ja     80212f <vprintfmt+0x60f>
+  8020e8:	89 c2                	mov    %eax,%edx
+  8020ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020ee:	83 c0 08             	add    $0x8,%eax
+  8020f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020f4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020f7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8020fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802100:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  802104:	0f 94 c0             	sete   %al
+  802107:	0f b6 c0             	movzbl %al,%eax
+  80210a:	50                   	push   %rax
+  80210b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802110:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  802114:	4c 89 ee             	mov    %r13,%rsi
+  802117:	4c 89 f7             	mov    %r14,%rdi
+  80211a:	48 b8 15 1a 80 00 00 	movabs $0x801a15,%rax
+  802121:	00 00 00 
+  802124:	ff d0                	call   *%rax
+            break;
+  802126:	48 83 c4 10          	add    $0x10,%rsp
+  80212a:	e9 31 fa ff ff       	jmp    801b60 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  80212f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802133:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802137:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80213b:	eb b7                	jmp    8020f4 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  80213d:	40 84 f6             	test   %sil,%sil
+  802140:	75 2b                	jne    80216d <vprintfmt+0x64d>
+    switch (lflag) {
+  802142:	85 d2                	test   %edx,%edx
+  802144:	7f 56                	jg     80219c <vprintfmt+0x67c>
+  802146:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802149:	7d 77                	jge    8021c2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80214b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80214e:	83 f8 2f             	cmp    $0x2f,%eax
+  802151:	0f 87 a7 00 00 00    	ja     8021fe <vprintfmt+0x6de>
+  802157:	89 c2                	mov    %eax,%edx
+  802159:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80215d:	83 c0 08             	add    $0x8,%eax
+  802160:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802163:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802166:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80216b:	eb 8f                	jmp    8020fc <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80216d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802170:	83 f8 2f             	cmp    $0x2f,%eax
+  802173:	77 19                	ja     80218e <vprintfmt+0x66e>
+  802175:	89 c2                	mov    %eax,%edx
+  802177:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80217b:	83 c0 08             	add    $0x8,%eax
+  80217e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802181:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802184:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802189:	e9 6e ff ff ff       	jmp    8020fc <vprintfmt+0x5dc>
+  80218e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802192:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802196:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80219a:	eb e5                	jmp    802181 <vprintfmt+0x661>
+    switch (lflag) {
+  80219c:	83 fa 01             	cmp    $0x1,%edx
+  80219f:	75 aa                	jne    80214b <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8021a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8021a7:	77 47                	ja     8021f0 <vprintfmt+0x6d0>
+  8021a9:	89 c2                	mov    %eax,%edx
+  8021ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021af:	83 c0 08             	add    $0x8,%eax
+  8021b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021b5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021b8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8021bd:	e9 3a ff ff ff       	jmp    8020fc <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8021c8:	77 18                	ja     8021e2 <vprintfmt+0x6c2>
+  8021ca:	89 c2                	mov    %eax,%edx
+  8021cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d0:	83 c0 08             	add    $0x8,%eax
+  8021d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021d6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8021d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8021dd:	e9 1a ff ff ff       	jmp    8020fc <vprintfmt+0x5dc>
+  8021e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021ee:	eb e6                	jmp    8021d6 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8021f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021fc:	eb b7                	jmp    8021b5 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8021fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802202:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802206:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80220a:	e9 54 ff ff ff       	jmp    802163 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  80220f:	4c 89 ee             	mov    %r13,%rsi
+  802212:	bf 25 00 00 00       	mov    $0x25,%edi
+  802217:	41 ff d6             	call   *%r14
+            break;
+  80221a:	e9 41 f9 ff ff       	jmp    801b60 <vprintfmt+0x40>
+            putch('%', put_arg);
+  80221f:	4c 89 ee             	mov    %r13,%rsi
+  802222:	bf 25 00 00 00       	mov    $0x25,%edi
+  802227:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80222a:	48 83 eb 01          	sub    $0x1,%rbx
+  80222e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802232:	75 f6                	jne    80222a <vprintfmt+0x70a>
+  802234:	e9 27 f9 ff ff       	jmp    801b60 <vprintfmt+0x40>
+
+0000000000802239 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802239:	55                   	push   %rbp
+  80223a:	48 89 e5             	mov    %rsp,%rbp
+  80223d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802241:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802245:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80224a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80224e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802255:	48 85 ff             	test   %rdi,%rdi
+  802258:	74 2b                	je     802285 <vsnprintf+0x4c>
+  80225a:	48 85 f6             	test   %rsi,%rsi
+  80225d:	74 26                	je     802285 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80225f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802263:	48 bf cb 1a 80 00 00 	movabs $0x801acb,%rdi
+  80226a:	00 00 00 
+  80226d:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802279:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80227d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802280:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802285:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228a:	eb f7                	jmp    802283 <vsnprintf+0x4a>
+
+000000000080228c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80228c:	55                   	push   %rbp
+  80228d:	48 89 e5             	mov    %rsp,%rbp
+  802290:	48 83 ec 50          	sub    $0x50,%rsp
+  802294:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802298:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80229c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8022a0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022af:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8022b7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022bb:	48 b8 39 22 80 00 00 	movabs $0x802239,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+
+00000000008022c9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8022c9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8022cc:	74 10                	je     8022de <strlen+0x15>
+    size_t n = 0;
+  8022ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8022d3:	48 83 c0 01          	add    $0x1,%rax
+  8022d7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8022db:	75 f6                	jne    8022d3 <strlen+0xa>
+  8022dd:	c3                   	ret
+    size_t n = 0;
+  8022de:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8022e3:	c3                   	ret
+
+00000000008022e4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8022e4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8022e7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8022ec:	48 85 f6             	test   %rsi,%rsi
+  8022ef:	74 11                	je     802302 <strnlen+0x1e>
+  8022f1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8022f5:	74 0c                	je     802303 <strnlen+0x1f>
+  8022f7:	48 83 c2 01          	add    $0x1,%rdx
+  8022fb:	48 39 d0             	cmp    %rdx,%rax
+  8022fe:	75 f1                	jne    8022f1 <strnlen+0xd>
+  802300:	eb 04                	jmp    802306 <strnlen+0x22>
+  802302:	c3                   	ret
+  802303:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802306:	c3                   	ret
+
+0000000000802307 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802307:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80230a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80230f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802313:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802316:	48 83 c2 01          	add    $0x1,%rdx
+  80231a:	84 c9                	test   %cl,%cl
+  80231c:	75 f1                	jne    80230f <strcpy+0x8>
+        ;
+    return res;
+}
+  80231e:	c3                   	ret
+
+000000000080231f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80231f:	55                   	push   %rbp
+  802320:	48 89 e5             	mov    %rsp,%rbp
+  802323:	41 54                	push   %r12
+  802325:	53                   	push   %rbx
+  802326:	48 89 fb             	mov    %rdi,%rbx
+  802329:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80232c:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  802333:	00 00 00 
+  802336:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  802338:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80233c:	4c 89 e6             	mov    %r12,%rsi
+  80233f:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+    return dst;
+}
+  80234b:	48 89 d8             	mov    %rbx,%rax
+  80234e:	5b                   	pop    %rbx
+  80234f:	41 5c                	pop    %r12
+  802351:	5d                   	pop    %rbp
+  802352:	c3                   	ret
+
+0000000000802353 <toupper>:
+
+int
+toupper(int ch) {
+  802353:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802355:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  802358:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80235b:	83 f9 1a             	cmp    $0x1a,%ecx
+  80235e:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802361:	c3                   	ret
+
+0000000000802362 <tolower>:
+
+int
+tolower(int ch) {
+  802362:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802364:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802367:	8d 57 20             	lea    0x20(%rdi),%edx
+  80236a:	83 f9 1a             	cmp    $0x1a,%ecx
+  80236d:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802370:	c3                   	ret
+
+0000000000802371 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802371:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802374:	48 85 d2             	test   %rdx,%rdx
+  802377:	74 1f                	je     802398 <strncpy+0x27>
+  802379:	48 01 fa             	add    %rdi,%rdx
+  80237c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80237f:	48 83 c1 01          	add    $0x1,%rcx
+  802383:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802387:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80238b:	41 80 f8 01          	cmp    $0x1,%r8b
+  80238f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802393:	48 39 ca             	cmp    %rcx,%rdx
+  802396:	75 e7                	jne    80237f <strncpy+0xe>
+    }
+    return ret;
+}
+  802398:	c3                   	ret
+
+0000000000802399 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802399:	48 89 f8             	mov    %rdi,%rax
+  80239c:	48 85 d2             	test   %rdx,%rdx
+  80239f:	74 24                	je     8023c5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8023a1:	48 83 ea 01          	sub    $0x1,%rdx
+  8023a5:	74 1b                	je     8023c2 <strlcpy+0x29>
+  8023a7:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8023ab:	0f b6 16             	movzbl (%rsi),%edx
+  8023ae:	84 d2                	test   %dl,%dl
+  8023b0:	74 10                	je     8023c2 <strlcpy+0x29>
+            *dst++ = *src++;
+  8023b2:	48 83 c6 01          	add    $0x1,%rsi
+  8023b6:	48 83 c0 01          	add    $0x1,%rax
+  8023ba:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8023bd:	48 39 c8             	cmp    %rcx,%rax
+  8023c0:	75 e9                	jne    8023ab <strlcpy+0x12>
+        *dst = '\0';
+  8023c2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8023c5:	48 29 f8             	sub    %rdi,%rax
+}
+  8023c8:	c3                   	ret
+
+00000000008023c9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8023c9:	0f b6 07             	movzbl (%rdi),%eax
+  8023cc:	84 c0                	test   %al,%al
+  8023ce:	74 13                	je     8023e3 <strcmp+0x1a>
+  8023d0:	38 06                	cmp    %al,(%rsi)
+  8023d2:	75 0f                	jne    8023e3 <strcmp+0x1a>
+  8023d4:	48 83 c7 01          	add    $0x1,%rdi
+  8023d8:	48 83 c6 01          	add    $0x1,%rsi
+  8023dc:	0f b6 07             	movzbl (%rdi),%eax
+  8023df:	84 c0                	test   %al,%al
+  8023e1:	75 ed                	jne    8023d0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8023e3:	0f b6 c0             	movzbl %al,%eax
+  8023e6:	0f b6 16             	movzbl (%rsi),%edx
+  8023e9:	29 d0                	sub    %edx,%eax
+}
+  8023eb:	c3                   	ret
+
+00000000008023ec <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8023ec:	48 85 d2             	test   %rdx,%rdx
+  8023ef:	74 1f                	je     802410 <strncmp+0x24>
+  8023f1:	0f b6 07             	movzbl (%rdi),%eax
+  8023f4:	84 c0                	test   %al,%al
+  8023f6:	74 1e                	je     802416 <strncmp+0x2a>
+  8023f8:	3a 06                	cmp    (%rsi),%al
+  8023fa:	75 1a                	jne    802416 <strncmp+0x2a>
+  8023fc:	48 83 c7 01          	add    $0x1,%rdi
+  802400:	48 83 c6 01          	add    $0x1,%rsi
+  802404:	48 83 ea 01          	sub    $0x1,%rdx
+  802408:	75 e7                	jne    8023f1 <strncmp+0x5>
+
+    if (!n) return 0;
+  80240a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240f:	c3                   	ret
+  802410:	b8 00 00 00 00       	mov    $0x0,%eax
+  802415:	c3                   	ret
+  802416:	48 85 d2             	test   %rdx,%rdx
+  802419:	74 09                	je     802424 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80241b:	0f b6 07             	movzbl (%rdi),%eax
+  80241e:	0f b6 16             	movzbl (%rsi),%edx
+  802421:	29 d0                	sub    %edx,%eax
+  802423:	c3                   	ret
+    if (!n) return 0;
+  802424:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802429:	c3                   	ret
+
+000000000080242a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80242a:	0f b6 17             	movzbl (%rdi),%edx
+  80242d:	84 d2                	test   %dl,%dl
+  80242f:	74 18                	je     802449 <strchr+0x1f>
+        if (*str == c) {
+  802431:	0f be d2             	movsbl %dl,%edx
+  802434:	39 f2                	cmp    %esi,%edx
+  802436:	74 17                	je     80244f <strchr+0x25>
+    for (; *str; str++) {
+  802438:	48 83 c7 01          	add    $0x1,%rdi
+  80243c:	0f b6 17             	movzbl (%rdi),%edx
+  80243f:	84 d2                	test   %dl,%dl
+  802441:	75 ee                	jne    802431 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802443:	b8 00 00 00 00       	mov    $0x0,%eax
+  802448:	c3                   	ret
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244e:	c3                   	ret
+  80244f:	48 89 f8             	mov    %rdi,%rax
+}
+  802452:	c3                   	ret
+
+0000000000802453 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802453:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802456:	0f b6 17             	movzbl (%rdi),%edx
+  802459:	84 d2                	test   %dl,%dl
+  80245b:	74 13                	je     802470 <strfind+0x1d>
+  80245d:	0f be d2             	movsbl %dl,%edx
+  802460:	39 f2                	cmp    %esi,%edx
+  802462:	74 0b                	je     80246f <strfind+0x1c>
+  802464:	48 83 c0 01          	add    $0x1,%rax
+  802468:	0f b6 10             	movzbl (%rax),%edx
+  80246b:	84 d2                	test   %dl,%dl
+  80246d:	75 ee                	jne    80245d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80246f:	c3                   	ret
+  802470:	c3                   	ret
+
+0000000000802471 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802471:	48 39 f7             	cmp    %rsi,%rdi
+  802474:	74 65                	je     8024db <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802476:	55                   	push   %rbp
+  802477:	48 89 e5             	mov    %rsp,%rbp
+  80247a:	41 57                	push   %r15
+  80247c:	41 56                	push   %r14
+  80247e:	41 55                	push   %r13
+  802480:	41 54                	push   %r12
+  802482:	53                   	push   %rbx
+  802483:	48 83 ec 18          	sub    $0x18,%rsp
+  802487:	48 89 fb             	mov    %rdi,%rbx
+  80248a:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80248d:	49 bf 62 23 80 00 00 	movabs $0x802362,%r15
+  802494:	00 00 00 
+  802497:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80249b:	41 0f b6 fd          	movzbl %r13b,%edi
+  80249f:	41 ff d7             	call   *%r15
+  8024a2:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8024a5:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8024aa:	41 0f b6 fe          	movzbl %r14b,%edi
+  8024ae:	41 ff d7             	call   *%r15
+  8024b1:	89 c2                	mov    %eax,%edx
+  8024b3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024b6:	29 d0                	sub    %edx,%eax
+  8024b8:	75 12                	jne    8024cc <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8024ba:	48 83 c3 01          	add    $0x1,%rbx
+  8024be:	45 84 ed             	test   %r13b,%r13b
+  8024c1:	74 09                	je     8024cc <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8024c3:	49 83 c4 01          	add    $0x1,%r12
+  8024c7:	45 84 f6             	test   %r14b,%r14b
+  8024ca:	75 cb                	jne    802497 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8024cc:	48 83 c4 18          	add    $0x18,%rsp
+  8024d0:	5b                   	pop    %rbx
+  8024d1:	41 5c                	pop    %r12
+  8024d3:	41 5d                	pop    %r13
+  8024d5:	41 5e                	pop    %r14
+  8024d7:	41 5f                	pop    %r15
+  8024d9:	5d                   	pop    %rbp
+  8024da:	c3                   	ret
+    if (p1 == p2) return 0;
+  8024db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e0:	c3                   	ret
+
+00000000008024e1 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024e1:	48 39 f7             	cmp    %rsi,%rdi
+  8024e4:	74 7d                	je     802563 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8024e6:	55                   	push   %rbp
+  8024e7:	48 89 e5             	mov    %rsp,%rbp
+  8024ea:	41 57                	push   %r15
+  8024ec:	41 56                	push   %r14
+  8024ee:	41 55                	push   %r13
+  8024f0:	41 54                	push   %r12
+  8024f2:	53                   	push   %rbx
+  8024f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8024f7:	48 89 fb             	mov    %rdi,%rbx
+  8024fa:	49 89 f4             	mov    %rsi,%r12
+  8024fd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802501:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802505:	49 bf 62 23 80 00 00 	movabs $0x802362,%r15
+  80250c:	00 00 00 
+    while (n--) {
+  80250f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802513:	48 39 c3             	cmp    %rax,%rbx
+  802516:	74 37                	je     80254f <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802518:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80251c:	41 0f b6 fd          	movzbl %r13b,%edi
+  802520:	41 ff d7             	call   *%r15
+  802523:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802526:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80252b:	41 0f b6 fe          	movzbl %r14b,%edi
+  80252f:	41 ff d7             	call   *%r15
+  802532:	89 c2                	mov    %eax,%edx
+  802534:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802537:	29 d0                	sub    %edx,%eax
+  802539:	75 19                	jne    802554 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  80253b:	48 83 c3 01          	add    $0x1,%rbx
+  80253f:	45 84 ed             	test   %r13b,%r13b
+  802542:	74 10                	je     802554 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802544:	49 83 c4 01          	add    $0x1,%r12
+  802548:	45 84 f6             	test   %r14b,%r14b
+  80254b:	75 c2                	jne    80250f <strncasecmp+0x2e>
+  80254d:	eb 05                	jmp    802554 <strncasecmp+0x73>
+  80254f:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802554:	48 83 c4 18          	add    $0x18,%rsp
+  802558:	5b                   	pop    %rbx
+  802559:	41 5c                	pop    %r12
+  80255b:	41 5d                	pop    %r13
+  80255d:	41 5e                	pop    %r14
+  80255f:	41 5f                	pop    %r15
+  802561:	5d                   	pop    %rbp
+  802562:	c3                   	ret
+    if (p1 == p2) return 0;
+  802563:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802568:	c3                   	ret
+
+0000000000802569 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802569:	83 e7 df             	and    $0xffffffdf,%edi
+  80256c:	83 ef 41             	sub    $0x41,%edi
+  80256f:	83 ff 19             	cmp    $0x19,%edi
+  802572:	0f 96 c0             	setbe  %al
+}
+  802575:	c3                   	ret
+
+0000000000802576 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802576:	83 ff 20             	cmp    $0x20,%edi
+  802579:	0f 94 c0             	sete   %al
+  80257c:	83 ff 09             	cmp    $0x9,%edi
+  80257f:	0f 94 c2             	sete   %dl
+  802582:	09 d0                	or     %edx,%eax
+}
+  802584:	c3                   	ret
+
+0000000000802585 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80258b:	48 bf 7f 66 80 00 00 	movabs $0x80667f,%rdi
+  802592:	00 00 00 
+  802595:	48 b8 2a 24 80 00 00 	movabs $0x80242a,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+  8025a1:	48 85 c0             	test   %rax,%rax
+  8025a4:	0f 95 c0             	setne  %al
+}
+  8025a7:	5d                   	pop    %rbp
+  8025a8:	c3                   	ret
+
+00000000008025a9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8025a9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8025ac:	48 89 f8             	mov    %rdi,%rax
+  8025af:	48 f7 d8             	neg    %rax
+  8025b2:	83 e0 07             	and    $0x7,%eax
+  8025b5:	49 89 d1             	mov    %rdx,%r9
+  8025b8:	49 29 c1             	sub    %rax,%r9
+  8025bb:	78 36                	js     8025f3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8025bd:	40 0f b6 c6          	movzbl %sil,%eax
+  8025c1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8025c8:	01 01 01 
+  8025cb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8025cf:	40 f6 c7 07          	test   $0x7,%dil
+  8025d3:	75 38                	jne    80260d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8025d5:	4c 89 c9             	mov    %r9,%rcx
+  8025d8:	48 c1 f9 03          	sar    $0x3,%rcx
+  8025dc:	74 0c                	je     8025ea <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8025de:	fc                   	cld
+  8025df:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8025e2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8025e6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8025ea:	4d 85 c9             	test   %r9,%r9
+  8025ed:	75 45                	jne    802634 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8025ef:	4c 89 c0             	mov    %r8,%rax
+  8025f2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8025f3:	48 85 d2             	test   %rdx,%rdx
+  8025f6:	74 f7                	je     8025ef <memset+0x46>
+  8025f8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8025fb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8025fe:	48 83 c0 01          	add    $0x1,%rax
+  802602:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802606:	48 39 c2             	cmp    %rax,%rdx
+  802609:	75 f3                	jne    8025fe <memset+0x55>
+  80260b:	eb e2                	jmp    8025ef <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80260d:	40 f6 c7 01          	test   $0x1,%dil
+  802611:	74 06                	je     802619 <memset+0x70>
+  802613:	88 07                	mov    %al,(%rdi)
+  802615:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802619:	40 f6 c7 02          	test   $0x2,%dil
+  80261d:	74 07                	je     802626 <memset+0x7d>
+  80261f:	66 89 07             	mov    %ax,(%rdi)
+  802622:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802626:	40 f6 c7 04          	test   $0x4,%dil
+  80262a:	74 a9                	je     8025d5 <memset+0x2c>
+  80262c:	89 07                	mov    %eax,(%rdi)
+  80262e:	48 83 c7 04          	add    $0x4,%rdi
+  802632:	eb a1                	jmp    8025d5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802634:	41 f6 c1 04          	test   $0x4,%r9b
+  802638:	74 06                	je     802640 <memset+0x97>
+  80263a:	89 07                	mov    %eax,(%rdi)
+  80263c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802640:	41 f6 c1 02          	test   $0x2,%r9b
+  802644:	74 07                	je     80264d <memset+0xa4>
+  802646:	66 89 07             	mov    %ax,(%rdi)
+  802649:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80264d:	41 f6 c1 01          	test   $0x1,%r9b
+  802651:	74 9c                	je     8025ef <memset+0x46>
+  802653:	88 07                	mov    %al,(%rdi)
+  802655:	eb 98                	jmp    8025ef <memset+0x46>
+
+0000000000802657 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802657:	48 89 f8             	mov    %rdi,%rax
+  80265a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80265d:	48 39 fe             	cmp    %rdi,%rsi
+  802660:	73 3b                	jae    80269d <memmove+0x46>
+  802662:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802666:	48 39 d7             	cmp    %rdx,%rdi
+  802669:	73 32                	jae    80269d <memmove+0x46>
+        s += n;
+        d += n;
+  80266b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80266f:	48 89 d6             	mov    %rdx,%rsi
+  802672:	48 09 fe             	or     %rdi,%rsi
+  802675:	48 09 ce             	or     %rcx,%rsi
+  802678:	40 f6 c6 07          	test   $0x7,%sil
+  80267c:	75 12                	jne    802690 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80267e:	48 83 ef 08          	sub    $0x8,%rdi
+  802682:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802686:	48 c1 e9 03          	shr    $0x3,%rcx
+  80268a:	fd                   	std
+  80268b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80268e:	fc                   	cld
+  80268f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802690:	48 83 ef 01          	sub    $0x1,%rdi
+  802694:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802698:	fd                   	std
+  802699:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80269b:	eb f1                	jmp    80268e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80269d:	48 89 f2             	mov    %rsi,%rdx
+  8026a0:	48 09 c2             	or     %rax,%rdx
+  8026a3:	48 09 ca             	or     %rcx,%rdx
+  8026a6:	f6 c2 07             	test   $0x7,%dl
+  8026a9:	75 0c                	jne    8026b7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8026ab:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026af:	48 89 c7             	mov    %rax,%rdi
+  8026b2:	fc                   	cld
+  8026b3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8026b6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8026b7:	48 89 c7             	mov    %rax,%rdi
+  8026ba:	fc                   	cld
+  8026bb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8026bd:	c3                   	ret
+
+00000000008026be <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8026be:	55                   	push   %rbp
+  8026bf:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8026c2:	48 b8 57 26 80 00 00 	movabs $0x802657,%rax
+  8026c9:	00 00 00 
+  8026cc:	ff d0                	call   *%rax
+}
+  8026ce:	5d                   	pop    %rbp
+  8026cf:	c3                   	ret
+
+00000000008026d0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8026d0:	55                   	push   %rbp
+  8026d1:	48 89 e5             	mov    %rsp,%rbp
+  8026d4:	41 57                	push   %r15
+  8026d6:	41 56                	push   %r14
+  8026d8:	41 55                	push   %r13
+  8026da:	41 54                	push   %r12
+  8026dc:	53                   	push   %rbx
+  8026dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e1:	49 89 fe             	mov    %rdi,%r14
+  8026e4:	49 89 f7             	mov    %rsi,%r15
+  8026e7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8026ea:	48 89 f7             	mov    %rsi,%rdi
+  8026ed:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8026fc:	48 89 de             	mov    %rbx,%rsi
+  8026ff:	4c 89 f7             	mov    %r14,%rdi
+  802702:	48 b8 e4 22 80 00 00 	movabs $0x8022e4,%rax
+  802709:	00 00 00 
+  80270c:	ff d0                	call   *%rax
+  80270e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802711:	48 39 c3             	cmp    %rax,%rbx
+  802714:	74 36                	je     80274c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802716:	48 89 d8             	mov    %rbx,%rax
+  802719:	4c 29 e8             	sub    %r13,%rax
+  80271c:	49 39 c4             	cmp    %rax,%r12
+  80271f:	73 31                	jae    802752 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802721:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802726:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80272a:	4c 89 fe             	mov    %r15,%rsi
+  80272d:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  802734:	00 00 00 
+  802737:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802739:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80273d:	48 83 c4 08          	add    $0x8,%rsp
+  802741:	5b                   	pop    %rbx
+  802742:	41 5c                	pop    %r12
+  802744:	41 5d                	pop    %r13
+  802746:	41 5e                	pop    %r14
+  802748:	41 5f                	pop    %r15
+  80274a:	5d                   	pop    %rbp
+  80274b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80274c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802750:	eb eb                	jmp    80273d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802752:	48 83 eb 01          	sub    $0x1,%rbx
+  802756:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80275a:	48 89 da             	mov    %rbx,%rdx
+  80275d:	4c 89 fe             	mov    %r15,%rsi
+  802760:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  802767:	00 00 00 
+  80276a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80276c:	49 01 de             	add    %rbx,%r14
+  80276f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802774:	eb c3                	jmp    802739 <strlcat+0x69>
+
+0000000000802776 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802776:	48 85 d2             	test   %rdx,%rdx
+  802779:	74 2d                	je     8027a8 <memcmp+0x32>
+  80277b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802780:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802784:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802789:	44 38 c1             	cmp    %r8b,%cl
+  80278c:	75 0f                	jne    80279d <memcmp+0x27>
+    while (n-- > 0) {
+  80278e:	48 83 c0 01          	add    $0x1,%rax
+  802792:	48 39 c2             	cmp    %rax,%rdx
+  802795:	75 e9                	jne    802780 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80279d:	0f b6 c1             	movzbl %cl,%eax
+  8027a0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8027a4:	44 29 c0             	sub    %r8d,%eax
+  8027a7:	c3                   	ret
+    return 0;
+  8027a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ad:	c3                   	ret
+
+00000000008027ae <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8027ae:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8027b2:	48 39 c7             	cmp    %rax,%rdi
+  8027b5:	73 0f                	jae    8027c6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8027b7:	40 38 37             	cmp    %sil,(%rdi)
+  8027ba:	74 0e                	je     8027ca <memfind+0x1c>
+    for (; src < end; src++) {
+  8027bc:	48 83 c7 01          	add    $0x1,%rdi
+  8027c0:	48 39 f8             	cmp    %rdi,%rax
+  8027c3:	75 f2                	jne    8027b7 <memfind+0x9>
+  8027c5:	c3                   	ret
+  8027c6:	48 89 f8             	mov    %rdi,%rax
+  8027c9:	c3                   	ret
+  8027ca:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8027cd:	c3                   	ret
+
+00000000008027ce <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8027ce:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8027d1:	0f b6 37             	movzbl (%rdi),%esi
+  8027d4:	40 80 fe 20          	cmp    $0x20,%sil
+  8027d8:	74 06                	je     8027e0 <strtol+0x12>
+  8027da:	40 80 fe 09          	cmp    $0x9,%sil
+  8027de:	75 13                	jne    8027f3 <strtol+0x25>
+  8027e0:	48 83 c7 01          	add    $0x1,%rdi
+  8027e4:	0f b6 37             	movzbl (%rdi),%esi
+  8027e7:	40 80 fe 20          	cmp    $0x20,%sil
+  8027eb:	74 f3                	je     8027e0 <strtol+0x12>
+  8027ed:	40 80 fe 09          	cmp    $0x9,%sil
+  8027f1:	74 ed                	je     8027e0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8027f3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8027f6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8027f9:	3c 01                	cmp    $0x1,%al
+  8027fb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8027ff:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802805:	75 0f                	jne    802816 <strtol+0x48>
+  802807:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80280a:	74 14                	je     802820 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80280c:	85 d2                	test   %edx,%edx
+  80280e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802813:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802816:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80281b:	4c 63 ca             	movslq %edx,%r9
+  80281e:	eb 36                	jmp    802856 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802820:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802824:	74 0f                	je     802835 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802826:	85 d2                	test   %edx,%edx
+  802828:	75 ec                	jne    802816 <strtol+0x48>
+        s++;
+  80282a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80282e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802833:	eb e1                	jmp    802816 <strtol+0x48>
+        s += 2;
+  802835:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802839:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80283e:	eb d6                	jmp    802816 <strtol+0x48>
+            dig -= '0';
+  802840:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802843:	44 0f b6 c1          	movzbl %cl,%r8d
+  802847:	41 39 d0             	cmp    %edx,%r8d
+  80284a:	7d 21                	jge    80286d <strtol+0x9f>
+        val = val * base + dig;
+  80284c:	49 0f af c1          	imul   %r9,%rax
+  802850:	0f b6 c9             	movzbl %cl,%ecx
+  802853:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802856:	48 83 c7 01          	add    $0x1,%rdi
+  80285a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80285e:	80 f9 39             	cmp    $0x39,%cl
+  802861:	76 dd                	jbe    802840 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802863:	80 f9 7b             	cmp    $0x7b,%cl
+  802866:	77 05                	ja     80286d <strtol+0x9f>
+            dig -= 'a' - 10;
+  802868:	83 e9 57             	sub    $0x57,%ecx
+  80286b:	eb d6                	jmp    802843 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80286d:	4d 85 d2             	test   %r10,%r10
+  802870:	74 03                	je     802875 <strtol+0xa7>
+  802872:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802875:	48 89 c2             	mov    %rax,%rdx
+  802878:	48 f7 da             	neg    %rdx
+  80287b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80287f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802883:	c3                   	ret
+
+0000000000802884 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802884:	55                   	push   %rbp
+  802885:	48 89 e5             	mov    %rsp,%rbp
+  802888:	53                   	push   %rbx
+  802889:	48 89 fa             	mov    %rdi,%rdx
+  80288c:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80288f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802894:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802899:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80289e:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028af:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8028b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028b5:	c9                   	leave
+  8028b6:	c3                   	ret
+
+00000000008028b7 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8028b7:	55                   	push   %rbp
+  8028b8:	48 89 e5             	mov    %rsp,%rbp
+  8028bb:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028bc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028e6:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ec:	c9                   	leave
+  8028ed:	c3                   	ret
+
+00000000008028ee <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8028ee:	55                   	push   %rbp
+  8028ef:	48 89 e5             	mov    %rsp,%rbp
+  8028f2:	53                   	push   %rbx
+  8028f3:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028f6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802900:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802905:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80290a:	be 00 00 00 00       	mov    $0x0,%esi
+  80290f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802915:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80291b:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80291d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802921:	c9                   	leave
+  802922:	c3                   	ret
+
+0000000000802923 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802923:	55                   	push   %rbp
+  802924:	48 89 e5             	mov    %rsp,%rbp
+  802927:	53                   	push   %rbx
+  802928:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80292c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80292f:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802934:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802939:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80293e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802943:	be 00 00 00 00       	mov    $0x0,%esi
+  802948:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80294e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802954:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802956:	48 85 c0             	test   %rax,%rax
+  802959:	7f 06                	jg     802961 <sys_env_destroy+0x3e>
+}
+  80295b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80295f:	c9                   	leave
+  802960:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802961:	49 89 c0             	mov    %rax,%r8
+  802964:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802969:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802970:	00 00 00 
+  802973:	be 27 00 00 00       	mov    $0x27,%esi
+  802978:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  80297f:	00 00 00 
+  802982:	b8 00 00 00 00       	mov    $0x0,%eax
+  802987:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  80298e:	00 00 00 
+  802991:	41 ff d1             	call   *%r9
+
+0000000000802994 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802999:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80299e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029ad:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029c3:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c9:	c9                   	leave
+  8029ca:	c3                   	ret
+
+00000000008029cb <sys_yield>:
+
+void
+sys_yield(void) {
+  8029cb:	55                   	push   %rbp
+  8029cc:	48 89 e5             	mov    %rsp,%rbp
+  8029cf:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029da:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029e4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029fa:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+
+0000000000802a02 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a02:	55                   	push   %rbp
+  802a03:	48 89 e5             	mov    %rsp,%rbp
+  802a06:	53                   	push   %rbx
+  802a07:	48 89 fa             	mov    %rdi,%rdx
+  802a0a:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a12:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a19:	00 00 00 
+  802a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a21:	be 00 00 00 00       	mov    $0x0,%esi
+  802a26:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a2c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a32:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802a34:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a38:	c9                   	leave
+  802a39:	c3                   	ret
+
+0000000000802a3a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	53                   	push   %rbx
+  802a3f:	49 89 f8             	mov    %rdi,%r8
+  802a42:	48 89 d3             	mov    %rdx,%rbx
+  802a45:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802a48:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a4d:	4c 89 c2             	mov    %r8,%rdx
+  802a50:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a53:	be 00 00 00 00       	mov    $0x0,%esi
+  802a58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a64:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802a66:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+0000000000802a6c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+  802a70:	53                   	push   %rbx
+  802a71:	48 83 ec 08          	sub    $0x8,%rsp
+  802a75:	89 f8                	mov    %edi,%eax
+  802a77:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802a7a:	48 63 f9             	movslq %ecx,%rdi
+  802a7d:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a80:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a85:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a88:	be 00 00 00 00       	mov    $0x0,%esi
+  802a8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a93:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a99:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a9b:	48 85 c0             	test   %rax,%rax
+  802a9e:	7f 06                	jg     802aa6 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802aa0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa4:	c9                   	leave
+  802aa5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aa6:	49 89 c0             	mov    %rax,%r8
+  802aa9:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802aae:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802ab5:	00 00 00 
+  802ab8:	be 27 00 00 00       	mov    $0x27,%esi
+  802abd:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802ac4:	00 00 00 
+  802ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acc:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802ad3:	00 00 00 
+  802ad6:	41 ff d1             	call   *%r9
+
+0000000000802ad9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802ad9:	55                   	push   %rbp
+  802ada:	48 89 e5             	mov    %rsp,%rbp
+  802add:	53                   	push   %rbx
+  802ade:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae2:	89 f8                	mov    %edi,%eax
+  802ae4:	49 89 f2             	mov    %rsi,%r10
+  802ae7:	48 89 cf             	mov    %rcx,%rdi
+  802aea:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802aed:	48 63 da             	movslq %edx,%rbx
+  802af0:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802af8:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afb:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802afe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b04:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b06:	48 85 c0             	test   %rax,%rax
+  802b09:	7f 06                	jg     802b11 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b0f:	c9                   	leave
+  802b10:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b11:	49 89 c0             	mov    %rax,%r8
+  802b14:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b19:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802b20:	00 00 00 
+  802b23:	be 27 00 00 00       	mov    $0x27,%esi
+  802b28:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802b2f:	00 00 00 
+  802b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b37:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802b3e:	00 00 00 
+  802b41:	41 ff d1             	call   *%r9
+
+0000000000802b44 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802b44:	55                   	push   %rbp
+  802b45:	48 89 e5             	mov    %rsp,%rbp
+  802b48:	53                   	push   %rbx
+  802b49:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4d:	48 89 f1             	mov    %rsi,%rcx
+  802b50:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802b53:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b56:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b60:	be 00 00 00 00       	mov    $0x0,%esi
+  802b65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b71:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b73:	48 85 c0             	test   %rax,%rax
+  802b76:	7f 06                	jg     802b7e <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802b78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b7e:	49 89 c0             	mov    %rax,%r8
+  802b81:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b86:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802b8d:	00 00 00 
+  802b90:	be 27 00 00 00       	mov    $0x27,%esi
+  802b95:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802b9c:	00 00 00 
+  802b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba4:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802bab:	00 00 00 
+  802bae:	41 ff d1             	call   *%r9
+
+0000000000802bb1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802bb1:	55                   	push   %rbp
+  802bb2:	48 89 e5             	mov    %rsp,%rbp
+  802bb5:	53                   	push   %rbx
+  802bb6:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802bba:	48 63 ce             	movslq %esi,%rcx
+  802bbd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bc5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bca:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bcf:	be 00 00 00 00       	mov    $0x0,%esi
+  802bd4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be2:	48 85 c0             	test   %rax,%rax
+  802be5:	7f 06                	jg     802bed <sys_env_set_status+0x3c>
+}
+  802be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bed:	49 89 c0             	mov    %rax,%r8
+  802bf0:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802bf5:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802bfc:	00 00 00 
+  802bff:	be 27 00 00 00       	mov    $0x27,%esi
+  802c04:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802c0b:	00 00 00 
+  802c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c13:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802c1a:	00 00 00 
+  802c1d:	41 ff d1             	call   *%r9
+
+0000000000802c20 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c20:	55                   	push   %rbp
+  802c21:	48 89 e5             	mov    %rsp,%rbp
+  802c24:	53                   	push   %rbx
+  802c25:	48 83 ec 08          	sub    $0x8,%rsp
+  802c29:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802c2c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c2f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c39:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c3e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c43:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c49:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c4f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c51:	48 85 c0             	test   %rax,%rax
+  802c54:	7f 06                	jg     802c5c <sys_env_set_trapframe+0x3c>
+}
+  802c56:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c5c:	49 89 c0             	mov    %rax,%r8
+  802c5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802c64:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802c6b:	00 00 00 
+  802c6e:	be 27 00 00 00       	mov    $0x27,%esi
+  802c73:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802c7a:	00 00 00 
+  802c7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c82:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802c89:	00 00 00 
+  802c8c:	41 ff d1             	call   *%r9
+
+0000000000802c8f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802c8f:	55                   	push   %rbp
+  802c90:	48 89 e5             	mov    %rsp,%rbp
+  802c93:	53                   	push   %rbx
+  802c94:	48 83 ec 08          	sub    $0x8,%rsp
+  802c98:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802c9b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c9e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cad:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cb8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cbe:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc0:	48 85 c0             	test   %rax,%rax
+  802cc3:	7f 06                	jg     802ccb <sys_env_set_pgfault_upcall+0x3c>
+}
+  802cc5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cc9:	c9                   	leave
+  802cca:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ccb:	49 89 c0             	mov    %rax,%r8
+  802cce:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802cd3:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802cda:	00 00 00 
+  802cdd:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce2:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802ce9:	00 00 00 
+  802cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf1:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802cf8:	00 00 00 
+  802cfb:	41 ff d1             	call   *%r9
+
+0000000000802cfe <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802cfe:	55                   	push   %rbp
+  802cff:	48 89 e5             	mov    %rsp,%rbp
+  802d02:	53                   	push   %rbx
+  802d03:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d07:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d0b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d0e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d18:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d1d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d28:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d2e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d30:	48 85 c0             	test   %rax,%rax
+  802d33:	7f 06                	jg     802d3b <sys_env_set_reclaim+0x3d>
+}
+  802d35:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d39:	c9                   	leave
+  802d3a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d3b:	49 89 c0             	mov    %rax,%r8
+  802d3e:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802d43:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802d4a:	00 00 00 
+  802d4d:	be 27 00 00 00       	mov    $0x27,%esi
+  802d52:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802d59:	00 00 00 
+  802d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d61:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802d68:	00 00 00 
+  802d6b:	41 ff d1             	call   *%r9
+
+0000000000802d6e <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802d6e:	55                   	push   %rbp
+  802d6f:	48 89 e5             	mov    %rsp,%rbp
+  802d72:	53                   	push   %rbx
+  802d73:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802d77:	48 63 ce             	movslq %esi,%rcx
+  802d7a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7d:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d87:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d8c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d91:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d97:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d9d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d9f:	48 85 c0             	test   %rax,%rax
+  802da2:	7f 06                	jg     802daa <sys_env_set_nice+0x3c>
+}
+  802da4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802da8:	c9                   	leave
+  802da9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802daa:	49 89 c0             	mov    %rax,%r8
+  802dad:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802db2:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802db9:	00 00 00 
+  802dbc:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc1:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802dc8:	00 00 00 
+  802dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd0:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802dd7:	00 00 00 
+  802dda:	41 ff d1             	call   *%r9
+
+0000000000802ddd <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802ddd:	55                   	push   %rbp
+  802dde:	48 89 e5             	mov    %rsp,%rbp
+  802de1:	53                   	push   %rbx
+  802de2:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802de5:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dea:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802df4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802df9:	be 00 00 00 00       	mov    $0x0,%esi
+  802dfe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e04:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0a:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e10:	c9                   	leave
+  802e11:	c3                   	ret
+
+0000000000802e12 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e12:	55                   	push   %rbp
+  802e13:	48 89 e5             	mov    %rsp,%rbp
+  802e16:	53                   	push   %rbx
+  802e17:	89 f8                	mov    %edi,%eax
+  802e19:	49 89 f1             	mov    %rsi,%r9
+  802e1c:	48 89 d3             	mov    %rdx,%rbx
+  802e1f:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e22:	49 63 f0             	movslq %r8d,%rsi
+  802e25:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e28:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e2d:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e36:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e3c:	cd 30                	int    $0x30
+}
+  802e3e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e42:	c9                   	leave
+  802e43:	c3                   	ret
+
+0000000000802e44 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e44:	55                   	push   %rbp
+  802e45:	48 89 e5             	mov    %rsp,%rbp
+  802e48:	53                   	push   %rbx
+  802e49:	89 f8                	mov    %edi,%eax
+  802e4b:	49 89 f1             	mov    %rsi,%r9
+  802e4e:	48 89 d3             	mov    %rdx,%rbx
+  802e51:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e54:	49 63 f0             	movslq %r8d,%rsi
+  802e57:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e5a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e5f:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e62:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e68:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e6e:	cd 30                	int    $0x30
+}
+  802e70:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+
+0000000000802e76 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e76:	55                   	push   %rbp
+  802e77:	48 89 e5             	mov    %rsp,%rbp
+  802e7a:	53                   	push   %rbx
+  802e7b:	48 83 ec 08          	sub    $0x8,%rsp
+  802e7f:	89 f8                	mov    %edi,%eax
+  802e81:	49 89 f2             	mov    %rsi,%r10
+  802e84:	48 89 d3             	mov    %rdx,%rbx
+  802e87:	48 89 cf             	mov    %rcx,%rdi
+  802e8a:	44 89 c6             	mov    %r8d,%esi
+  802e8d:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e90:	48 63 f6             	movslq %esi,%rsi
+  802e93:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e96:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e9b:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e9e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ea2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ea4:	48 85 c0             	test   %rax,%rax
+  802ea7:	7f 06                	jg     802eaf <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ea9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ead:	c9                   	leave
+  802eae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802eaf:	49 89 c0             	mov    %rax,%r8
+  802eb2:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802eb7:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802ebe:	00 00 00 
+  802ec1:	be 27 00 00 00       	mov    $0x27,%esi
+  802ec6:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802ecd:	00 00 00 
+  802ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed5:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802edc:	00 00 00 
+  802edf:	41 ff d1             	call   *%r9
+
+0000000000802ee2 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802ee2:	55                   	push   %rbp
+  802ee3:	48 89 e5             	mov    %rsp,%rbp
+  802ee6:	53                   	push   %rbx
+  802ee7:	48 83 ec 08          	sub    $0x8,%rsp
+  802eeb:	48 89 f1             	mov    %rsi,%rcx
+  802eee:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802ef1:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802ef5:	48 8b 1a             	mov    (%rdx),%rbx
+  802ef8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802efb:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f00:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f04:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f08:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f0c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f0e:	48 85 c0             	test   %rax,%rax
+  802f11:	7f 06                	jg     802f19 <sys_ipc_call_short+0x37>
+}
+  802f13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f17:	c9                   	leave
+  802f18:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f19:	49 89 c0             	mov    %rax,%r8
+  802f1c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f21:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802f28:	00 00 00 
+  802f2b:	be 27 00 00 00       	mov    $0x27,%esi
+  802f30:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802f37:	00 00 00 
+  802f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3f:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802f46:	00 00 00 
+  802f49:	41 ff d1             	call   *%r9
+
+0000000000802f4c <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f4c:	55                   	push   %rbp
+  802f4d:	48 89 e5             	mov    %rsp,%rbp
+  802f50:	53                   	push   %rbx
+  802f51:	48 83 ec 08          	sub    $0x8,%rsp
+  802f55:	89 f8                	mov    %edi,%eax
+  802f57:	49 89 f2             	mov    %rsi,%r10
+  802f5a:	48 89 d3             	mov    %rdx,%rbx
+  802f5d:	48 89 cf             	mov    %rcx,%rdi
+  802f60:	44 89 c6             	mov    %r8d,%esi
+  802f63:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f66:	48 63 f6             	movslq %esi,%rsi
+  802f69:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f6c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f71:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f74:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f78:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f7a:	48 85 c0             	test   %rax,%rax
+  802f7d:	7f 06                	jg     802f85 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f83:	c9                   	leave
+  802f84:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f85:	49 89 c0             	mov    %rax,%r8
+  802f88:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802f8d:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  802f94:	00 00 00 
+  802f97:	be 27 00 00 00       	mov    $0x27,%esi
+  802f9c:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  802fa3:	00 00 00 
+  802fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fab:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  802fb2:	00 00 00 
+  802fb5:	41 ff d1             	call   *%r9
+
+0000000000802fb8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802fb8:	55                   	push   %rbp
+  802fb9:	48 89 e5             	mov    %rsp,%rbp
+  802fbc:	53                   	push   %rbx
+  802fbd:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc1:	48 89 fa             	mov    %rdi,%rdx
+  802fc4:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802fc7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fd6:	be 00 00 00 00       	mov    $0x0,%esi
+  802fdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fe1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fe7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fe9:	48 85 c0             	test   %rax,%rax
+  802fec:	7f 06                	jg     802ff4 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802fee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff2:	c9                   	leave
+  802ff3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ff4:	49 89 c0             	mov    %rax,%r8
+  802ff7:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802ffc:	48 ba 88 66 80 00 00 	movabs $0x806688,%rdx
+  803003:	00 00 00 
+  803006:	be 27 00 00 00       	mov    $0x27,%esi
+  80300b:	48 bf a7 66 80 00 00 	movabs $0x8066a7,%rdi
+  803012:	00 00 00 
+  803015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80301a:	49 b9 80 18 80 00 00 	movabs $0x801880,%r9
+  803021:	00 00 00 
+  803024:	41 ff d1             	call   *%r9
+
+0000000000803027 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  803027:	55                   	push   %rbp
+  803028:	48 89 e5             	mov    %rsp,%rbp
+  80302b:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80302c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803031:	ba 00 00 00 00       	mov    $0x0,%edx
+  803036:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80303b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803040:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803045:	be 00 00 00 00       	mov    $0x0,%esi
+  80304a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803050:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803056:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803058:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80305c:	c9                   	leave
+  80305d:	c3                   	ret
+
+000000000080305e <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  80305e:	55                   	push   %rbp
+  80305f:	48 89 e5             	mov    %rsp,%rbp
+  803062:	53                   	push   %rbx
+  803063:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803066:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80306b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803070:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803075:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80307a:	be 00 00 00 00       	mov    $0x0,%esi
+  80307f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803085:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80308b:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80308d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803091:	c9                   	leave
+  803092:	c3                   	ret
+
+0000000000803093 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803098:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80309d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c2:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c8:	c9                   	leave
+  8030c9:	c3                   	ret
+
+00000000008030ca <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	53                   	push   %rbx
+  8030cf:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  8030d3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8030d8:	cd 30                	int    $0x30
+  8030da:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  8030dc:	85 c0                	test   %eax,%eax
+  8030de:	0f 88 85 00 00 00    	js     803169 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8030e4:	0f 84 ac 00 00 00    	je     803196 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  8030ea:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8030f0:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8030f7:	00 00 00 
+  8030fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ff:	89 c2                	mov    %eax,%edx
+  803101:	be 00 00 00 00       	mov    $0x0,%esi
+  803106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310b:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  803112:	00 00 00 
+  803115:	ff d0                	call   *%rax
+  803117:	85 c0                	test   %eax,%eax
+  803119:	0f 88 a8 00 00 00    	js     8031c7 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  80311f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803126:	00 00 00 
+  803129:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  803130:	89 df                	mov    %ebx,%edi
+  803132:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	0f 88 ae 00 00 00    	js     8031f4 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803146:	be 02 00 00 00       	mov    $0x2,%esi
+  80314b:	89 df                	mov    %ebx,%edi
+  80314d:	48 b8 b1 2b 80 00 00 	movabs $0x802bb1,%rax
+  803154:	00 00 00 
+  803157:	ff d0                	call   *%rax
+  803159:	85 c0                	test   %eax,%eax
+  80315b:	0f 88 c0 00 00 00    	js     803221 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803161:	89 d8                	mov    %ebx,%eax
+  803163:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803167:	c9                   	leave
+  803168:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803169:	89 c1                	mov    %eax,%ecx
+  80316b:	48 ba b5 66 80 00 00 	movabs $0x8066b5,%rdx
+  803172:	00 00 00 
+  803175:	be 20 00 00 00       	mov    $0x20,%esi
+  80317a:	48 bf c5 66 80 00 00 	movabs $0x8066c5,%rdi
+  803181:	00 00 00 
+  803184:	b8 00 00 00 00       	mov    $0x0,%eax
+  803189:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803190:	00 00 00 
+  803193:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803196:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  80319d:	00 00 00 
+  8031a0:	ff d0                	call   *%rax
+  8031a2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8031a7:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8031ae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8031b5:	00 00 00 
+  8031b8:	48 01 d0             	add    %rdx,%rax
+  8031bb:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8031c2:	00 00 00 
+        return 0;
+  8031c5:	eb 9a                	jmp    803161 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  8031c7:	89 c1                	mov    %eax,%ecx
+  8031c9:	48 ba d0 66 80 00 00 	movabs $0x8066d0,%rdx
+  8031d0:	00 00 00 
+  8031d3:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8031d8:	48 bf c5 66 80 00 00 	movabs $0x8066c5,%rdi
+  8031df:	00 00 00 
+  8031e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e7:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  8031ee:	00 00 00 
+  8031f1:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8031f4:	89 c1                	mov    %eax,%ecx
+  8031f6:	48 ba 18 67 80 00 00 	movabs $0x806718,%rdx
+  8031fd:	00 00 00 
+  803200:	be 32 00 00 00       	mov    $0x32,%esi
+  803205:	48 bf c5 66 80 00 00 	movabs $0x8066c5,%rdi
+  80320c:	00 00 00 
+  80320f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803214:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  80321b:	00 00 00 
+  80321e:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  803221:	89 c1                	mov    %eax,%ecx
+  803223:	48 ba e3 66 80 00 00 	movabs $0x8066e3,%rdx
+  80322a:	00 00 00 
+  80322d:	be 37 00 00 00       	mov    $0x37,%esi
+  803232:	48 bf c5 66 80 00 00 	movabs $0x8066c5,%rdi
+  803239:	00 00 00 
+  80323c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803241:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803248:	00 00 00 
+  80324b:	41 ff d0             	call   *%r8
+
+000000000080324e <sfork>:
+
+envid_t
+sfork() {
+  80324e:	55                   	push   %rbp
+  80324f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803252:	48 ba fa 66 80 00 00 	movabs $0x8066fa,%rdx
+  803259:	00 00 00 
+  80325c:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803261:	48 bf c5 66 80 00 00 	movabs $0x8066c5,%rdi
+  803268:	00 00 00 
+  80326b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803270:	48 b9 80 18 80 00 00 	movabs $0x801880,%rcx
+  803277:	00 00 00 
+  80327a:	ff d1                	call   *%rcx
+
+000000000080327c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80327c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803283:	ff ff ff 
+  803286:	48 01 f8             	add    %rdi,%rax
+  803289:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80328d:	c3                   	ret
+
+000000000080328e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80328e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803295:	ff ff ff 
+  803298:	48 01 f8             	add    %rdi,%rax
+  80329b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80329f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8032a5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8032a9:	c3                   	ret
+
+00000000008032aa <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8032aa:	55                   	push   %rbp
+  8032ab:	48 89 e5             	mov    %rsp,%rbp
+  8032ae:	41 57                	push   %r15
+  8032b0:	41 56                	push   %r14
+  8032b2:	41 55                	push   %r13
+  8032b4:	41 54                	push   %r12
+  8032b6:	53                   	push   %rbx
+  8032b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bb:	49 89 ff             	mov    %rdi,%r15
+  8032be:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8032c3:	49 bd aa 47 80 00 00 	movabs $0x8047aa,%r13
+  8032ca:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8032cd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8032d3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8032d6:	48 89 df             	mov    %rbx,%rdi
+  8032d9:	41 ff d5             	call   *%r13
+  8032dc:	83 e0 04             	and    $0x4,%eax
+  8032df:	74 17                	je     8032f8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8032e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8032e8:	4c 39 f3             	cmp    %r14,%rbx
+  8032eb:	75 e6                	jne    8032d3 <fd_alloc+0x29>
+  8032ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8032f3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8032f8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8032fb:	48 83 c4 08          	add    $0x8,%rsp
+  8032ff:	5b                   	pop    %rbx
+  803300:	41 5c                	pop    %r12
+  803302:	41 5d                	pop    %r13
+  803304:	41 5e                	pop    %r14
+  803306:	41 5f                	pop    %r15
+  803308:	5d                   	pop    %rbp
+  803309:	c3                   	ret
+
+000000000080330a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80330a:	83 ff 1f             	cmp    $0x1f,%edi
+  80330d:	77 39                	ja     803348 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80330f:	55                   	push   %rbp
+  803310:	48 89 e5             	mov    %rsp,%rbp
+  803313:	41 54                	push   %r12
+  803315:	53                   	push   %rbx
+  803316:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  803319:	48 63 df             	movslq %edi,%rbx
+  80331c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803323:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  803327:	48 89 df             	mov    %rbx,%rdi
+  80332a:	48 b8 aa 47 80 00 00 	movabs $0x8047aa,%rax
+  803331:	00 00 00 
+  803334:	ff d0                	call   *%rax
+  803336:	a8 04                	test   $0x4,%al
+  803338:	74 14                	je     80334e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80333a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80333e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803343:	5b                   	pop    %rbx
+  803344:	41 5c                	pop    %r12
+  803346:	5d                   	pop    %rbp
+  803347:	c3                   	ret
+        return -E_INVAL;
+  803348:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80334d:	c3                   	ret
+        return -E_INVAL;
+  80334e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803353:	eb ee                	jmp    803343 <fd_lookup+0x39>
+
+0000000000803355 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803355:	55                   	push   %rbp
+  803356:	48 89 e5             	mov    %rsp,%rbp
+  803359:	41 54                	push   %r12
+  80335b:	53                   	push   %rbx
+  80335c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80335f:	48 b8 c0 67 80 00 00 	movabs $0x8067c0,%rax
+  803366:	00 00 00 
+  803369:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  803370:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803373:	39 3b                	cmp    %edi,(%rbx)
+  803375:	74 47                	je     8033be <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803377:	48 83 c0 08          	add    $0x8,%rax
+  80337b:	48 8b 18             	mov    (%rax),%rbx
+  80337e:	48 85 db             	test   %rbx,%rbx
+  803381:	75 f0                	jne    803373 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803383:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80338a:	00 00 00 
+  80338d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803393:	89 fa                	mov    %edi,%edx
+  803395:	48 bf 38 67 80 00 00 	movabs $0x806738,%rdi
+  80339c:	00 00 00 
+  80339f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033a4:	48 b9 d0 19 80 00 00 	movabs $0x8019d0,%rcx
+  8033ab:	00 00 00 
+  8033ae:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8033b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8033b5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8033b9:	5b                   	pop    %rbx
+  8033ba:	41 5c                	pop    %r12
+  8033bc:	5d                   	pop    %rbp
+  8033bd:	c3                   	ret
+            return 0;
+  8033be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c3:	eb f0                	jmp    8033b5 <dev_lookup+0x60>
+
+00000000008033c5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8033c5:	55                   	push   %rbp
+  8033c6:	48 89 e5             	mov    %rsp,%rbp
+  8033c9:	41 55                	push   %r13
+  8033cb:	41 54                	push   %r12
+  8033cd:	53                   	push   %rbx
+  8033ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8033d2:	48 89 fb             	mov    %rdi,%rbx
+  8033d5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8033d8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8033df:	ff ff ff 
+  8033e2:	48 01 df             	add    %rbx,%rdi
+  8033e5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8033e9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033ed:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8033f4:	00 00 00 
+  8033f7:	ff d0                	call   *%rax
+  8033f9:	41 89 c5             	mov    %eax,%r13d
+  8033fc:	85 c0                	test   %eax,%eax
+  8033fe:	78 06                	js     803406 <fd_close+0x41>
+  803400:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803404:	74 1a                	je     803420 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  803406:	45 84 e4             	test   %r12b,%r12b
+  803409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803412:	44 89 e8             	mov    %r13d,%eax
+  803415:	48 83 c4 18          	add    $0x18,%rsp
+  803419:	5b                   	pop    %rbx
+  80341a:	41 5c                	pop    %r12
+  80341c:	41 5d                	pop    %r13
+  80341e:	5d                   	pop    %rbp
+  80341f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803420:	8b 3b                	mov    (%rbx),%edi
+  803422:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803426:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  80342d:	00 00 00 
+  803430:	ff d0                	call   *%rax
+  803432:	41 89 c5             	mov    %eax,%r13d
+  803435:	85 c0                	test   %eax,%eax
+  803437:	78 1b                	js     803454 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  803439:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80343d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803441:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803447:	48 85 c0             	test   %rax,%rax
+  80344a:	74 08                	je     803454 <fd_close+0x8f>
+  80344c:	48 89 df             	mov    %rbx,%rdi
+  80344f:	ff d0                	call   *%rax
+  803451:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803454:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803459:	48 89 de             	mov    %rbx,%rsi
+  80345c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803461:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  803468:	00 00 00 
+  80346b:	ff d0                	call   *%rax
+    return res;
+  80346d:	eb a3                	jmp    803412 <fd_close+0x4d>
+
+000000000080346f <close>:
+
+int
+close(int fdnum) {
+  80346f:	55                   	push   %rbp
+  803470:	48 89 e5             	mov    %rsp,%rbp
+  803473:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803477:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80347b:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  803482:	00 00 00 
+  803485:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803487:	85 c0                	test   %eax,%eax
+  803489:	78 15                	js     8034a0 <close+0x31>
+
+    return fd_close(fd, 1);
+  80348b:	be 01 00 00 00       	mov    $0x1,%esi
+  803490:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803494:	48 b8 c5 33 80 00 00 	movabs $0x8033c5,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+}
+  8034a0:	c9                   	leave
+  8034a1:	c3                   	ret
+
+00000000008034a2 <close_all>:
+
+void
+close_all(void) {
+  8034a2:	55                   	push   %rbp
+  8034a3:	48 89 e5             	mov    %rsp,%rbp
+  8034a6:	41 54                	push   %r12
+  8034a8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8034a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034ae:	49 bc 6f 34 80 00 00 	movabs $0x80346f,%r12
+  8034b5:	00 00 00 
+  8034b8:	89 df                	mov    %ebx,%edi
+  8034ba:	41 ff d4             	call   *%r12
+  8034bd:	83 c3 01             	add    $0x1,%ebx
+  8034c0:	83 fb 20             	cmp    $0x20,%ebx
+  8034c3:	75 f3                	jne    8034b8 <close_all+0x16>
+}
+  8034c5:	5b                   	pop    %rbx
+  8034c6:	41 5c                	pop    %r12
+  8034c8:	5d                   	pop    %rbp
+  8034c9:	c3                   	ret
+
+00000000008034ca <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8034ca:	55                   	push   %rbp
+  8034cb:	48 89 e5             	mov    %rsp,%rbp
+  8034ce:	41 57                	push   %r15
+  8034d0:	41 56                	push   %r14
+  8034d2:	41 55                	push   %r13
+  8034d4:	41 54                	push   %r12
+  8034d6:	53                   	push   %rbx
+  8034d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8034db:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8034de:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034e2:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8034e9:	00 00 00 
+  8034ec:	ff d0                	call   *%rax
+  8034ee:	89 c3                	mov    %eax,%ebx
+  8034f0:	85 c0                	test   %eax,%eax
+  8034f2:	0f 88 b8 00 00 00    	js     8035b0 <dup+0xe6>
+    close(newfdnum);
+  8034f8:	44 89 e7             	mov    %r12d,%edi
+  8034fb:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  803502:	00 00 00 
+  803505:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  803507:	4d 63 ec             	movslq %r12d,%r13
+  80350a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803511:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  803515:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  803519:	4c 89 ff             	mov    %r15,%rdi
+  80351c:	49 be 8e 32 80 00 00 	movabs $0x80328e,%r14
+  803523:	00 00 00 
+  803526:	41 ff d6             	call   *%r14
+  803529:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80352c:	4c 89 ef             	mov    %r13,%rdi
+  80352f:	41 ff d6             	call   *%r14
+  803532:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  803535:	48 89 df             	mov    %rbx,%rdi
+  803538:	48 b8 aa 47 80 00 00 	movabs $0x8047aa,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803544:	a8 04                	test   $0x4,%al
+  803546:	74 2b                	je     803573 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803548:	41 89 c1             	mov    %eax,%r9d
+  80354b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803551:	4c 89 f1             	mov    %r14,%rcx
+  803554:	ba 00 00 00 00       	mov    $0x0,%edx
+  803559:	48 89 de             	mov    %rbx,%rsi
+  80355c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803561:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  803568:	00 00 00 
+  80356b:	ff d0                	call   *%rax
+  80356d:	89 c3                	mov    %eax,%ebx
+  80356f:	85 c0                	test   %eax,%eax
+  803571:	78 4e                	js     8035c1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803573:	4c 89 ff             	mov    %r15,%rdi
+  803576:	48 b8 aa 47 80 00 00 	movabs $0x8047aa,%rax
+  80357d:	00 00 00 
+  803580:	ff d0                	call   *%rax
+  803582:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803585:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80358b:	4c 89 e9             	mov    %r13,%rcx
+  80358e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803593:	4c 89 fe             	mov    %r15,%rsi
+  803596:	bf 00 00 00 00       	mov    $0x0,%edi
+  80359b:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  8035a2:	00 00 00 
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	89 c3                	mov    %eax,%ebx
+  8035a9:	85 c0                	test   %eax,%eax
+  8035ab:	78 14                	js     8035c1 <dup+0xf7>
+
+    return newfdnum;
+  8035ad:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8035b0:	89 d8                	mov    %ebx,%eax
+  8035b2:	48 83 c4 18          	add    $0x18,%rsp
+  8035b6:	5b                   	pop    %rbx
+  8035b7:	41 5c                	pop    %r12
+  8035b9:	41 5d                	pop    %r13
+  8035bb:	41 5e                	pop    %r14
+  8035bd:	41 5f                	pop    %r15
+  8035bf:	5d                   	pop    %rbp
+  8035c0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8035c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035c6:	4c 89 ee             	mov    %r13,%rsi
+  8035c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035ce:	49 bc 44 2b 80 00 00 	movabs $0x802b44,%r12
+  8035d5:	00 00 00 
+  8035d8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8035db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035e0:	4c 89 f6             	mov    %r14,%rsi
+  8035e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e8:	41 ff d4             	call   *%r12
+    return res;
+  8035eb:	eb c3                	jmp    8035b0 <dup+0xe6>
+
+00000000008035ed <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8035ed:	55                   	push   %rbp
+  8035ee:	48 89 e5             	mov    %rsp,%rbp
+  8035f1:	41 56                	push   %r14
+  8035f3:	41 55                	push   %r13
+  8035f5:	41 54                	push   %r12
+  8035f7:	53                   	push   %rbx
+  8035f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8035fc:	89 fb                	mov    %edi,%ebx
+  8035fe:	49 89 f4             	mov    %rsi,%r12
+  803601:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803604:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803608:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+  803614:	85 c0                	test   %eax,%eax
+  803616:	78 4c                	js     803664 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803618:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80361c:	41 8b 3e             	mov    (%r14),%edi
+  80361f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803623:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	85 c0                	test   %eax,%eax
+  803631:	78 35                	js     803668 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803633:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803637:	83 e0 03             	and    $0x3,%eax
+  80363a:	83 f8 01             	cmp    $0x1,%eax
+  80363d:	74 2d                	je     80366c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80363f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803643:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803647:	48 85 c0             	test   %rax,%rax
+  80364a:	74 56                	je     8036a2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80364c:	4c 89 ea             	mov    %r13,%rdx
+  80364f:	4c 89 e6             	mov    %r12,%rsi
+  803652:	4c 89 f7             	mov    %r14,%rdi
+  803655:	ff d0                	call   *%rax
+}
+  803657:	48 83 c4 10          	add    $0x10,%rsp
+  80365b:	5b                   	pop    %rbx
+  80365c:	41 5c                	pop    %r12
+  80365e:	41 5d                	pop    %r13
+  803660:	41 5e                	pop    %r14
+  803662:	5d                   	pop    %rbp
+  803663:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803664:	48 98                	cltq
+  803666:	eb ef                	jmp    803657 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803668:	48 98                	cltq
+  80366a:	eb eb                	jmp    803657 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80366c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803673:	00 00 00 
+  803676:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80367c:	89 da                	mov    %ebx,%edx
+  80367e:	48 bf 79 67 80 00 00 	movabs $0x806779,%rdi
+  803685:	00 00 00 
+  803688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368d:	48 b9 d0 19 80 00 00 	movabs $0x8019d0,%rcx
+  803694:	00 00 00 
+  803697:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803699:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8036a0:	eb b5                	jmp    803657 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8036a2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8036a9:	eb ac                	jmp    803657 <read+0x6a>
+
+00000000008036ab <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8036ab:	55                   	push   %rbp
+  8036ac:	48 89 e5             	mov    %rsp,%rbp
+  8036af:	41 57                	push   %r15
+  8036b1:	41 56                	push   %r14
+  8036b3:	41 55                	push   %r13
+  8036b5:	41 54                	push   %r12
+  8036b7:	53                   	push   %rbx
+  8036b8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8036bc:	48 85 d2             	test   %rdx,%rdx
+  8036bf:	74 54                	je     803715 <readn+0x6a>
+  8036c1:	41 89 fd             	mov    %edi,%r13d
+  8036c4:	49 89 f6             	mov    %rsi,%r14
+  8036c7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8036ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8036cf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8036d4:	49 bf ed 35 80 00 00 	movabs $0x8035ed,%r15
+  8036db:	00 00 00 
+  8036de:	4c 89 e2             	mov    %r12,%rdx
+  8036e1:	48 29 f2             	sub    %rsi,%rdx
+  8036e4:	4c 01 f6             	add    %r14,%rsi
+  8036e7:	44 89 ef             	mov    %r13d,%edi
+  8036ea:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8036ed:	85 c0                	test   %eax,%eax
+  8036ef:	78 20                	js     803711 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8036f1:	01 c3                	add    %eax,%ebx
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	74 08                	je     8036ff <readn+0x54>
+  8036f7:	48 63 f3             	movslq %ebx,%rsi
+  8036fa:	4c 39 e6             	cmp    %r12,%rsi
+  8036fd:	72 df                	jb     8036de <readn+0x33>
+    }
+    return res;
+  8036ff:	48 63 c3             	movslq %ebx,%rax
+}
+  803702:	48 83 c4 08          	add    $0x8,%rsp
+  803706:	5b                   	pop    %rbx
+  803707:	41 5c                	pop    %r12
+  803709:	41 5d                	pop    %r13
+  80370b:	41 5e                	pop    %r14
+  80370d:	41 5f                	pop    %r15
+  80370f:	5d                   	pop    %rbp
+  803710:	c3                   	ret
+        if (inc < 0) return inc;
+  803711:	48 98                	cltq
+  803713:	eb ed                	jmp    803702 <readn+0x57>
+    int inc = 1, res = 0;
+  803715:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80371a:	eb e3                	jmp    8036ff <readn+0x54>
+
+000000000080371c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80371c:	55                   	push   %rbp
+  80371d:	48 89 e5             	mov    %rsp,%rbp
+  803720:	41 56                	push   %r14
+  803722:	41 55                	push   %r13
+  803724:	41 54                	push   %r12
+  803726:	53                   	push   %rbx
+  803727:	48 83 ec 10          	sub    $0x10,%rsp
+  80372b:	89 fb                	mov    %edi,%ebx
+  80372d:	49 89 f4             	mov    %rsi,%r12
+  803730:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803733:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803737:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  80373e:	00 00 00 
+  803741:	ff d0                	call   *%rax
+  803743:	85 c0                	test   %eax,%eax
+  803745:	78 47                	js     80378e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803747:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80374b:	41 8b 3e             	mov    (%r14),%edi
+  80374e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803752:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+  80375e:	85 c0                	test   %eax,%eax
+  803760:	78 30                	js     803792 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803762:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803767:	74 2d                	je     803796 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803769:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80376d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803771:	48 85 c0             	test   %rax,%rax
+  803774:	74 56                	je     8037cc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803776:	4c 89 ea             	mov    %r13,%rdx
+  803779:	4c 89 e6             	mov    %r12,%rsi
+  80377c:	4c 89 f7             	mov    %r14,%rdi
+  80377f:	ff d0                	call   *%rax
+}
+  803781:	48 83 c4 10          	add    $0x10,%rsp
+  803785:	5b                   	pop    %rbx
+  803786:	41 5c                	pop    %r12
+  803788:	41 5d                	pop    %r13
+  80378a:	41 5e                	pop    %r14
+  80378c:	5d                   	pop    %rbp
+  80378d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80378e:	48 98                	cltq
+  803790:	eb ef                	jmp    803781 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803792:	48 98                	cltq
+  803794:	eb eb                	jmp    803781 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803796:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80379d:	00 00 00 
+  8037a0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8037a6:	89 da                	mov    %ebx,%edx
+  8037a8:	48 bf 95 67 80 00 00 	movabs $0x806795,%rdi
+  8037af:	00 00 00 
+  8037b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b7:	48 b9 d0 19 80 00 00 	movabs $0x8019d0,%rcx
+  8037be:	00 00 00 
+  8037c1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8037c3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037ca:	eb b5                	jmp    803781 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8037cc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8037d3:	eb ac                	jmp    803781 <write+0x65>
+
+00000000008037d5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8037d5:	55                   	push   %rbp
+  8037d6:	48 89 e5             	mov    %rsp,%rbp
+  8037d9:	53                   	push   %rbx
+  8037da:	48 83 ec 18          	sub    $0x18,%rsp
+  8037de:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037e0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8037e4:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+  8037f0:	85 c0                	test   %eax,%eax
+  8037f2:	78 0c                	js     803800 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8037f4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037f8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8037fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803804:	c9                   	leave
+  803805:	c3                   	ret
+
+0000000000803806 <tell>:
+
+int tell(int fdnum) {
+  803806:	55                   	push   %rbp
+  803807:	48 89 e5             	mov    %rsp,%rbp
+  80380a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80380e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803812:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  803819:	00 00 00 
+  80381c:	ff d0                	call   *%rax
+  80381e:	85 c0                	test   %eax,%eax
+  803820:	78 07                	js     803829 <tell+0x23>
+
+    return fd->fd_offset;
+  803822:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803826:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803829:	c9                   	leave
+  80382a:	c3                   	ret
+
+000000000080382b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80382b:	55                   	push   %rbp
+  80382c:	48 89 e5             	mov    %rsp,%rbp
+  80382f:	41 55                	push   %r13
+  803831:	41 54                	push   %r12
+  803833:	53                   	push   %rbx
+  803834:	48 83 ec 18          	sub    $0x18,%rsp
+  803838:	89 fb                	mov    %edi,%ebx
+  80383a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80383d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803841:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  803848:	00 00 00 
+  80384b:	ff d0                	call   *%rax
+  80384d:	85 c0                	test   %eax,%eax
+  80384f:	78 38                	js     803889 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803851:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803855:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803859:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80385d:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  803864:	00 00 00 
+  803867:	ff d0                	call   *%rax
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	78 1c                	js     803889 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80386d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803872:	74 20                	je     803894 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803874:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803878:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80387c:	48 85 c0             	test   %rax,%rax
+  80387f:	74 47                	je     8038c8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803881:	44 89 e6             	mov    %r12d,%esi
+  803884:	4c 89 ef             	mov    %r13,%rdi
+  803887:	ff d0                	call   *%rax
+}
+  803889:	48 83 c4 18          	add    $0x18,%rsp
+  80388d:	5b                   	pop    %rbx
+  80388e:	41 5c                	pop    %r12
+  803890:	41 5d                	pop    %r13
+  803892:	5d                   	pop    %rbp
+  803893:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803894:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80389b:	00 00 00 
+  80389e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8038a4:	89 da                	mov    %ebx,%edx
+  8038a6:	48 bf 58 67 80 00 00 	movabs $0x806758,%rdi
+  8038ad:	00 00 00 
+  8038b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b5:	48 b9 d0 19 80 00 00 	movabs $0x8019d0,%rcx
+  8038bc:	00 00 00 
+  8038bf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8038c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038c6:	eb c1                	jmp    803889 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8038c8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8038cd:	eb ba                	jmp    803889 <ftruncate+0x5e>
+
+00000000008038cf <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8038cf:	55                   	push   %rbp
+  8038d0:	48 89 e5             	mov    %rsp,%rbp
+  8038d3:	41 54                	push   %r12
+  8038d5:	53                   	push   %rbx
+  8038d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8038da:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038dd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8038e1:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8038e8:	00 00 00 
+  8038eb:	ff d0                	call   *%rax
+  8038ed:	85 c0                	test   %eax,%eax
+  8038ef:	78 63                	js     803954 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8038f1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8038f5:	41 8b 3c 24          	mov    (%r12),%edi
+  8038f9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8038fd:	48 b8 55 33 80 00 00 	movabs $0x803355,%rax
+  803904:	00 00 00 
+  803907:	ff d0                	call   *%rax
+  803909:	85 c0                	test   %eax,%eax
+  80390b:	78 47                	js     803954 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80390d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803911:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803916:	74 45                	je     80395d <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803918:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80391b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803922:	00 00 00 
+    stat->st_isdir = 0;
+  803925:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80392c:	00 00 00 
+    stat->st_ino = 0;
+  80392f:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803936:	00 00 00 00 
+    stat->st_version = 0;
+  80393a:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803941:	00 00 00 
+    stat->st_dev = dev;
+  803944:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80394b:	48 89 de             	mov    %rbx,%rsi
+  80394e:	4c 89 e7             	mov    %r12,%rdi
+  803951:	ff 50 28             	call   *0x28(%rax)
+}
+  803954:	48 83 c4 10          	add    $0x10,%rsp
+  803958:	5b                   	pop    %rbx
+  803959:	41 5c                	pop    %r12
+  80395b:	5d                   	pop    %rbp
+  80395c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80395d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803962:	eb f0                	jmp    803954 <fstat+0x85>
+
+0000000000803964 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803964:	55                   	push   %rbp
+  803965:	48 89 e5             	mov    %rsp,%rbp
+  803968:	41 54                	push   %r12
+  80396a:	53                   	push   %rbx
+  80396b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80396e:	be 00 00 00 00       	mov    $0x0,%esi
+  803973:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  80397a:	00 00 00 
+  80397d:	ff d0                	call   *%rax
+  80397f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803981:	85 c0                	test   %eax,%eax
+  803983:	78 25                	js     8039aa <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803985:	4c 89 e6             	mov    %r12,%rsi
+  803988:	89 c7                	mov    %eax,%edi
+  80398a:	48 b8 cf 38 80 00 00 	movabs $0x8038cf,%rax
+  803991:	00 00 00 
+  803994:	ff d0                	call   *%rax
+  803996:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803999:	89 df                	mov    %ebx,%edi
+  80399b:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+
+    return res;
+  8039a7:	44 89 e3             	mov    %r12d,%ebx
+}
+  8039aa:	89 d8                	mov    %ebx,%eax
+  8039ac:	5b                   	pop    %rbx
+  8039ad:	41 5c                	pop    %r12
+  8039af:	5d                   	pop    %rbp
+  8039b0:	c3                   	ret
+
+00000000008039b1 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039b1:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  8039b8:	00 00 00 
+  8039bb:	83 38 00             	cmpl   $0x0,(%rax)
+  8039be:	74 0a                	je     8039ca <fsipc_env+0x19>
+    return fsenv;
+}
+  8039c0:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8039c7:	00 00 
+  8039c9:	c3                   	ret
+fsipc_env(void) {
+  8039ca:	55                   	push   %rbp
+  8039cb:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  8039ce:	bf 03 00 00 00       	mov    $0x3,%edi
+  8039d3:	48 b8 b4 5a 80 00 00 	movabs $0x805ab4,%rax
+  8039da:	00 00 00 
+  8039dd:	ff d0                	call   *%rax
+  8039df:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8039e6:	00 00 
+}
+  8039e8:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8039ef:	00 00 
+  8039f1:	5d                   	pop    %rbp
+  8039f2:	c3                   	ret
+
+00000000008039f3 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8039f3:	55                   	push   %rbp
+  8039f4:	48 89 e5             	mov    %rsp,%rbp
+  8039f7:	53                   	push   %rbx
+  8039f8:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8039fc:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a03:	00 
+  803a04:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803a0b:	00 
+  803a0c:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803a13:	00 
+  803a14:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803a1b:	00 
+  803a1c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803a23:	00 
+
+    assert(size <= sizeof(words));
+  803a24:	48 83 fa 28          	cmp    $0x28,%rdx
+  803a28:	77 38                	ja     803a62 <fsipc_short+0x6f>
+  803a2a:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803a2c:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803a30:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803a3c:	48 b8 b1 39 80 00 00 	movabs $0x8039b1,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+  803a48:	89 c7                	mov    %eax,%edi
+  803a4a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803a4e:	89 de                	mov    %ebx,%esi
+  803a50:	48 b8 17 5a 80 00 00 	movabs $0x805a17,%rax
+  803a57:	00 00 00 
+  803a5a:	ff d0                	call   *%rax
+}
+  803a5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803a60:	c9                   	leave
+  803a61:	c3                   	ret
+    assert(size <= sizeof(words));
+  803a62:	48 b9 e0 67 80 00 00 	movabs $0x8067e0,%rcx
+  803a69:	00 00 00 
+  803a6c:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803a73:	00 00 00 
+  803a76:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803a7b:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803a82:	00 00 00 
+  803a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8a:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803a91:	00 00 00 
+  803a94:	41 ff d0             	call   *%r8
+
+0000000000803a97 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a97:	55                   	push   %rbp
+  803a98:	48 89 e5             	mov    %rsp,%rbp
+  803a9b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803a9f:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803aa2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803aa5:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803aa8:	ba 08 00 00 00       	mov    $0x8,%edx
+  803aad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803ab1:	bf 02 00 00 00       	mov    $0x2,%edi
+  803ab6:	48 b8 f3 39 80 00 00 	movabs $0x8039f3,%rax
+  803abd:	00 00 00 
+  803ac0:	ff d0                	call   *%rax
+}
+  803ac2:	c9                   	leave
+  803ac3:	c3                   	ret
+
+0000000000803ac4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803ac4:	55                   	push   %rbp
+  803ac5:	48 89 e5             	mov    %rsp,%rbp
+  803ac8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803acc:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803acf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803ad2:	ba 04 00 00 00       	mov    $0x4,%edx
+  803ad7:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803adb:	bf 06 00 00 00       	mov    $0x6,%edi
+  803ae0:	48 b8 f3 39 80 00 00 	movabs $0x8039f3,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+}
+  803aec:	c9                   	leave
+  803aed:	c3                   	ret
+
+0000000000803aee <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803aee:	55                   	push   %rbp
+  803aef:	48 89 e5             	mov    %rsp,%rbp
+  803af2:	41 54                	push   %r12
+  803af4:	53                   	push   %rbx
+  803af5:	48 83 ec 10          	sub    $0x10,%rsp
+  803af9:	89 fb                	mov    %edi,%ebx
+  803afb:	49 89 f4             	mov    %rsi,%r12
+  803afe:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803b02:	48 b8 b1 39 80 00 00 	movabs $0x8039b1,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	89 c7                	mov    %eax,%edi
+  803b10:	6a 00                	push   $0x0
+  803b12:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803b16:	50                   	push   %rax
+  803b17:	4d 89 e1             	mov    %r12,%r9
+  803b1a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803b20:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b25:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803b2c:	00 00 00 
+  803b2f:	89 de                	mov    %ebx,%esi
+  803b31:	48 b8 b2 59 80 00 00 	movabs $0x8059b2,%rax
+  803b38:	00 00 00 
+  803b3b:	ff d0                	call   *%rax
+}
+  803b3d:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803b41:	5b                   	pop    %rbx
+  803b42:	41 5c                	pop    %r12
+  803b44:	5d                   	pop    %rbp
+  803b45:	c3                   	ret
+
+0000000000803b46 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803b46:	55                   	push   %rbp
+  803b47:	48 89 e5             	mov    %rsp,%rbp
+  803b4a:	41 54                	push   %r12
+  803b4c:	53                   	push   %rbx
+  803b4d:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803b50:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803b53:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803b5a:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803b5c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b61:	be 00 00 00 00       	mov    $0x0,%esi
+  803b66:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b6b:	48 b8 ee 3a 80 00 00 	movabs $0x803aee,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b77:	85 c0                	test   %eax,%eax
+  803b79:	78 5a                	js     803bd5 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b7b:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  803b82:	00 00 00 
+  803b85:	4c 89 e6             	mov    %r12,%rsi
+  803b88:	48 89 df             	mov    %rbx,%rdi
+  803b8b:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  803b92:	00 00 00 
+  803b95:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803b97:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803b9e:	00 
+  803b9f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ba5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803bac:	00 
+  803bad:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803bb3:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803bba:	00 
+  803bbb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803bc2:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803bc9:	00 
+  803bca:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bd5:	5b                   	pop    %rbx
+  803bd6:	41 5c                	pop    %r12
+  803bd8:	5d                   	pop    %rbp
+  803bd9:	c3                   	ret
+
+0000000000803bda <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803bda:	55                   	push   %rbp
+  803bdb:	48 89 e5             	mov    %rsp,%rbp
+  803bde:	41 57                	push   %r15
+  803be0:	41 56                	push   %r14
+  803be2:	41 55                	push   %r13
+  803be4:	41 54                	push   %r12
+  803be6:	53                   	push   %rbx
+  803be7:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803beb:	48 85 ff             	test   %rdi,%rdi
+  803bee:	0f 84 a1 00 00 00    	je     803c95 <devfile_read+0xbb>
+  803bf4:	49 89 ff             	mov    %rdi,%r15
+  803bf7:	49 89 f5             	mov    %rsi,%r13
+  803bfa:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803bfd:	48 85 f6             	test   %rsi,%rsi
+  803c00:	0f 84 c4 00 00 00    	je     803cca <devfile_read+0xf0>
+    size_t total_read = 0;
+  803c06:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803c0d:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c0e:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803c15:	00 00 00 
+  803c18:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c1c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803c1f:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c28:	be 00 00 00 00       	mov    $0x0,%esi
+  803c2d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c32:	48 b8 ee 3a 80 00 00 	movabs $0x803aee,%rax
+  803c39:	00 00 00 
+  803c3c:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c3e:	85 c0                	test   %eax,%eax
+  803c40:	0f 88 b9 00 00 00    	js     803cff <devfile_read+0x125>
+        assert(res <= n);
+  803c46:	48 63 d8             	movslq %eax,%rbx
+  803c49:	49 39 dc             	cmp    %rbx,%r12
+  803c4c:	0f 82 b1 00 00 00    	jb     803d03 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803c52:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803c57:	0f 87 db 00 00 00    	ja     803d38 <devfile_read+0x15e>
+        if (!res) {
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	74 21                	je     803c82 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c61:	48 89 da             	mov    %rbx,%rdx
+  803c64:	4c 89 f6             	mov    %r14,%rsi
+  803c67:	4c 89 ef             	mov    %r13,%rdi
+  803c6a:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  803c71:	00 00 00 
+  803c74:	ff d0                	call   *%rax
+        total_read += res;
+  803c76:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803c7a:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803c7d:	49 29 dc             	sub    %rbx,%r12
+  803c80:	75 96                	jne    803c18 <devfile_read+0x3e>
+    return total_read;
+  803c82:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803c86:	48 83 c4 18          	add    $0x18,%rsp
+  803c8a:	5b                   	pop    %rbx
+  803c8b:	41 5c                	pop    %r12
+  803c8d:	41 5d                	pop    %r13
+  803c8f:	41 5e                	pop    %r14
+  803c91:	41 5f                	pop    %r15
+  803c93:	5d                   	pop    %rbp
+  803c94:	c3                   	ret
+    assert(fd);
+  803c95:	48 b9 16 68 80 00 00 	movabs $0x806816,%rcx
+  803c9c:	00 00 00 
+  803c9f:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803ca6:	00 00 00 
+  803ca9:	be 91 00 00 00       	mov    $0x91,%esi
+  803cae:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803cb5:	00 00 00 
+  803cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbd:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803cc4:	00 00 00 
+  803cc7:	41 ff d0             	call   *%r8
+    assert(buf);
+  803cca:	48 b9 19 68 80 00 00 	movabs $0x806819,%rcx
+  803cd1:	00 00 00 
+  803cd4:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803cdb:	00 00 00 
+  803cde:	be 92 00 00 00       	mov    $0x92,%esi
+  803ce3:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803cea:	00 00 00 
+  803ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf2:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803cf9:	00 00 00 
+  803cfc:	41 ff d0             	call   *%r8
+            return res;
+  803cff:	48 98                	cltq
+  803d01:	eb 83                	jmp    803c86 <devfile_read+0xac>
+        assert(res <= n);
+  803d03:	48 b9 1d 68 80 00 00 	movabs $0x80681d,%rcx
+  803d0a:	00 00 00 
+  803d0d:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803d14:	00 00 00 
+  803d17:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803d1c:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803d23:	00 00 00 
+  803d26:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d2b:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803d32:	00 00 00 
+  803d35:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803d38:	48 b9 28 68 80 00 00 	movabs $0x806828,%rcx
+  803d3f:	00 00 00 
+  803d42:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803d49:	00 00 00 
+  803d4c:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803d51:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803d58:	00 00 00 
+  803d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d60:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803d67:	00 00 00 
+  803d6a:	41 ff d0             	call   *%r8
+
+0000000000803d6d <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d6d:	55                   	push   %rbp
+  803d6e:	48 89 e5             	mov    %rsp,%rbp
+  803d71:	41 57                	push   %r15
+  803d73:	41 56                	push   %r14
+  803d75:	41 55                	push   %r13
+  803d77:	41 54                	push   %r12
+  803d79:	53                   	push   %rbx
+  803d7a:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803d7e:	48 85 ff             	test   %rdi,%rdi
+  803d81:	0f 84 83 00 00 00    	je     803e0a <devfile_write+0x9d>
+  803d87:	49 89 ff             	mov    %rdi,%r15
+  803d8a:	49 89 f4             	mov    %rsi,%r12
+  803d8d:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803d90:	48 85 f6             	test   %rsi,%rsi
+  803d93:	0f 84 a6 00 00 00    	je     803e3f <devfile_write+0xd2>
+    size_t total_written = 0;
+  803d99:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d9f:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803da6:	00 00 00 
+  803da9:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803dad:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803db0:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803db4:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803db9:	48 39 d3             	cmp    %rdx,%rbx
+  803dbc:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803dc0:	4c 89 e6             	mov    %r12,%rsi
+  803dc3:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803dca:	00 00 00 
+  803dcd:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  803dd4:	00 00 00 
+  803dd7:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803dd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dde:	be 00 00 00 00       	mov    $0x0,%esi
+  803de3:	bf 04 00 00 00       	mov    $0x4,%edi
+  803de8:	48 b8 ee 3a 80 00 00 	movabs $0x803aee,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+        if (res < 0) {
+  803df4:	85 c0                	test   %eax,%eax
+  803df6:	78 7c                	js     803e74 <devfile_write+0x107>
+        total_written += res;
+  803df8:	48 98                	cltq
+  803dfa:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803dfd:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803e00:	48 29 c3             	sub    %rax,%rbx
+  803e03:	75 a4                	jne    803da9 <devfile_write+0x3c>
+    return total_written;
+  803e05:	4c 89 e8             	mov    %r13,%rax
+  803e08:	eb 6c                	jmp    803e76 <devfile_write+0x109>
+    assert(fd);
+  803e0a:	48 b9 16 68 80 00 00 	movabs $0x806816,%rcx
+  803e11:	00 00 00 
+  803e14:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803e1b:	00 00 00 
+  803e1e:	be bd 00 00 00       	mov    $0xbd,%esi
+  803e23:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803e2a:	00 00 00 
+  803e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e32:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803e39:	00 00 00 
+  803e3c:	41 ff d0             	call   *%r8
+    assert(buf);
+  803e3f:	48 b9 19 68 80 00 00 	movabs $0x806819,%rcx
+  803e46:	00 00 00 
+  803e49:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  803e50:	00 00 00 
+  803e53:	be be 00 00 00       	mov    $0xbe,%esi
+  803e58:	48 bf 0b 68 80 00 00 	movabs $0x80680b,%rdi
+  803e5f:	00 00 00 
+  803e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e67:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  803e6e:	00 00 00 
+  803e71:	41 ff d0             	call   *%r8
+            return res;
+  803e74:	48 98                	cltq
+}
+  803e76:	48 83 c4 08          	add    $0x8,%rsp
+  803e7a:	5b                   	pop    %rbx
+  803e7b:	41 5c                	pop    %r12
+  803e7d:	41 5d                	pop    %r13
+  803e7f:	41 5e                	pop    %r14
+  803e81:	41 5f                	pop    %r15
+  803e83:	5d                   	pop    %rbp
+  803e84:	c3                   	ret
+
+0000000000803e85 <open>:
+open(const char *path, int mode) {
+  803e85:	55                   	push   %rbp
+  803e86:	48 89 e5             	mov    %rsp,%rbp
+  803e89:	41 55                	push   %r13
+  803e8b:	41 54                	push   %r12
+  803e8d:	53                   	push   %rbx
+  803e8e:	48 83 ec 18          	sub    $0x18,%rsp
+  803e92:	49 89 fc             	mov    %rdi,%r12
+  803e95:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803e98:	48 b8 c9 22 80 00 00 	movabs $0x8022c9,%rax
+  803e9f:	00 00 00 
+  803ea2:	ff d0                	call   *%rax
+  803ea4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803eaa:	0f 87 8f 00 00 00    	ja     803f3f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803eb0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803eb4:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  803ebb:	00 00 00 
+  803ebe:	ff d0                	call   *%rax
+  803ec0:	89 c3                	mov    %eax,%ebx
+  803ec2:	85 c0                	test   %eax,%eax
+  803ec4:	78 55                	js     803f1b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803ec6:	4c 89 e6             	mov    %r12,%rsi
+  803ec9:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803ed0:	00 00 00 
+  803ed3:	48 89 df             	mov    %rbx,%rdi
+  803ed6:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  803edd:	00 00 00 
+  803ee0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803ee2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803ee9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ef2:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ef7:	48 b8 ee 3a 80 00 00 	movabs $0x803aee,%rax
+  803efe:	00 00 00 
+  803f01:	ff d0                	call   *%rax
+  803f03:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f05:	85 c0                	test   %eax,%eax
+  803f07:	78 1f                	js     803f28 <open+0xa3>
+    return fd2num(fd);
+  803f09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f0d:	48 b8 7c 32 80 00 00 	movabs $0x80327c,%rax
+  803f14:	00 00 00 
+  803f17:	ff d0                	call   *%rax
+  803f19:	89 c3                	mov    %eax,%ebx
+}
+  803f1b:	89 d8                	mov    %ebx,%eax
+  803f1d:	48 83 c4 18          	add    $0x18,%rsp
+  803f21:	5b                   	pop    %rbx
+  803f22:	41 5c                	pop    %r12
+  803f24:	41 5d                	pop    %r13
+  803f26:	5d                   	pop    %rbp
+  803f27:	c3                   	ret
+        fd_close(fd, 0);
+  803f28:	be 00 00 00 00       	mov    $0x0,%esi
+  803f2d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f31:	48 b8 c5 33 80 00 00 	movabs $0x8033c5,%rax
+  803f38:	00 00 00 
+  803f3b:	ff d0                	call   *%rax
+        return res;
+  803f3d:	eb dc                	jmp    803f1b <open+0x96>
+        return -E_BAD_PATH;
+  803f3f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803f44:	eb d5                	jmp    803f1b <open+0x96>
+
+0000000000803f46 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803f46:	55                   	push   %rbp
+  803f47:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f54:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f59:	48 b8 f3 39 80 00 00 	movabs $0x8039f3,%rax
+  803f60:	00 00 00 
+  803f63:	ff d0                	call   *%rax
+}
+  803f65:	5d                   	pop    %rbp
+  803f66:	c3                   	ret
+
+0000000000803f67 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803f67:	55                   	push   %rbp
+  803f68:	48 89 e5             	mov    %rsp,%rbp
+  803f6b:	41 56                	push   %r14
+  803f6d:	41 55                	push   %r13
+  803f6f:	41 54                	push   %r12
+  803f71:	53                   	push   %rbx
+  803f72:	48 83 ec 10          	sub    $0x10,%rsp
+  803f76:	41 89 f6             	mov    %esi,%r14d
+  803f79:	49 89 d4             	mov    %rdx,%r12
+  803f7c:	48 89 cb             	mov    %rcx,%rbx
+  803f7f:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f82:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f86:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  803f8d:	00 00 00 
+  803f90:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f92:	85 c0                	test   %eax,%eax
+  803f94:	78 46                	js     803fdc <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f96:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f9a:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803fa1:	00 00 00 
+  803fa4:	8b 00                	mov    (%rax),%eax
+  803fa6:	39 02                	cmp    %eax,(%rdx)
+  803fa8:	75 3f                	jne    803fe9 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803faa:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803fb1:	00 00 00 
+  803fb4:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803fb7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803fb9:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803fbd:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803fc1:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803fc5:	48 89 da             	mov    %rbx,%rdx
+  803fc8:	4c 89 e6             	mov    %r12,%rsi
+  803fcb:	bf 09 00 00 00       	mov    $0x9,%edi
+  803fd0:	48 b8 ee 3a 80 00 00 	movabs $0x803aee,%rax
+  803fd7:	00 00 00 
+  803fda:	ff d0                	call   *%rax
+}
+  803fdc:	48 83 c4 10          	add    $0x10,%rsp
+  803fe0:	5b                   	pop    %rbx
+  803fe1:	41 5c                	pop    %r12
+  803fe3:	41 5d                	pop    %r13
+  803fe5:	41 5e                	pop    %r14
+  803fe7:	5d                   	pop    %rbp
+  803fe8:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fe9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803fee:	eb ec                	jmp    803fdc <file_map+0x75>
+
+0000000000803ff0 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803ff0:	55                   	push   %rbp
+  803ff1:	48 89 e5             	mov    %rsp,%rbp
+  803ff4:	41 54                	push   %r12
+  803ff6:	53                   	push   %rbx
+  803ff7:	48 83 ec 20          	sub    $0x20,%rsp
+  803ffb:	41 89 f4             	mov    %esi,%r12d
+  803ffe:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804001:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804005:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  80400c:	00 00 00 
+  80400f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804011:	85 c0                	test   %eax,%eax
+  804013:	78 3c                	js     804051 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804015:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804019:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  804020:	00 00 00 
+  804023:	8b 0a                	mov    (%rdx),%ecx
+  804025:	39 08                	cmp    %ecx,(%rax)
+  804027:	75 31                	jne    80405a <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  804029:	8b 40 0c             	mov    0xc(%rax),%eax
+  80402c:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80402f:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  804033:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  804037:	ba 10 00 00 00       	mov    $0x10,%edx
+  80403c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804040:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804045:	48 b8 f3 39 80 00 00 	movabs $0x8039f3,%rax
+  80404c:	00 00 00 
+  80404f:	ff d0                	call   *%rax
+}
+  804051:	48 83 c4 20          	add    $0x20,%rsp
+  804055:	5b                   	pop    %rbx
+  804056:	41 5c                	pop    %r12
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80405a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80405f:	eb f0                	jmp    804051 <file_msync+0x61>
+
+0000000000804061 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804061:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804065:	7f 01                	jg     804068 <writebuf+0x7>
+  804067:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804068:	55                   	push   %rbp
+  804069:	48 89 e5             	mov    %rsp,%rbp
+  80406c:	53                   	push   %rbx
+  80406d:	48 83 ec 08          	sub    $0x8,%rsp
+  804071:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804074:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804078:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80407c:	8b 3f                	mov    (%rdi),%edi
+  80407e:	48 b8 1c 37 80 00 00 	movabs $0x80371c,%rax
+  804085:	00 00 00 
+  804088:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80408a:	48 85 c0             	test   %rax,%rax
+  80408d:	7e 04                	jle    804093 <writebuf+0x32>
+  80408f:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804093:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804097:	48 39 c2             	cmp    %rax,%rdx
+  80409a:	74 0f                	je     8040ab <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80409c:	48 85 c0             	test   %rax,%rax
+  80409f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8040a8:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8040ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040af:	c9                   	leave
+  8040b0:	c3                   	ret
+
+00000000008040b1 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8040b1:	8b 46 04             	mov    0x4(%rsi),%eax
+  8040b4:	8d 50 01             	lea    0x1(%rax),%edx
+  8040b7:	89 56 04             	mov    %edx,0x4(%rsi)
+  8040ba:	48 98                	cltq
+  8040bc:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8040c1:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8040c7:	74 01                	je     8040ca <putch+0x19>
+  8040c9:	c3                   	ret
+putch(int ch, void *arg) {
+  8040ca:	55                   	push   %rbp
+  8040cb:	48 89 e5             	mov    %rsp,%rbp
+  8040ce:	53                   	push   %rbx
+  8040cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8040d3:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  8040d6:	48 89 f7             	mov    %rsi,%rdi
+  8040d9:	48 b8 61 40 80 00 00 	movabs $0x804061,%rax
+  8040e0:	00 00 00 
+  8040e3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8040e5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8040ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040f0:	c9                   	leave
+  8040f1:	c3                   	ret
+
+00000000008040f2 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8040f2:	55                   	push   %rbp
+  8040f3:	48 89 e5             	mov    %rsp,%rbp
+  8040f6:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8040fd:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804100:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  804106:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80410d:	00 00 00 
+    state.result = 0;
+  804110:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  804117:	00 00 00 00 
+    state.error = 1;
+  80411b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804122:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  804125:	48 89 f2             	mov    %rsi,%rdx
+  804128:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80412f:	48 bf b1 40 80 00 00 	movabs $0x8040b1,%rdi
+  804136:	00 00 00 
+  804139:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  804140:	00 00 00 
+  804143:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804145:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80414c:	7f 14                	jg     804162 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80414e:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804155:	48 85 c0             	test   %rax,%rax
+  804158:	75 06                	jne    804160 <vfprintf+0x6e>
+  80415a:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804160:	c9                   	leave
+  804161:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804162:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804169:	48 b8 61 40 80 00 00 	movabs $0x804061,%rax
+  804170:	00 00 00 
+  804173:	ff d0                	call   *%rax
+  804175:	eb d7                	jmp    80414e <vfprintf+0x5c>
+
+0000000000804177 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804177:	55                   	push   %rbp
+  804178:	48 89 e5             	mov    %rsp,%rbp
+  80417b:	48 83 ec 50          	sub    $0x50,%rsp
+  80417f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804183:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804187:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80418b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80418f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804196:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80419a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80419e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8041a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8041a6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8041aa:	48 b8 f2 40 80 00 00 	movabs $0x8040f2,%rax
+  8041b1:	00 00 00 
+  8041b4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8041b6:	c9                   	leave
+  8041b7:	c3                   	ret
+
+00000000008041b8 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8041b8:	55                   	push   %rbp
+  8041b9:	48 89 e5             	mov    %rsp,%rbp
+  8041bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8041c0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8041c4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8041c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8041cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8041d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8041d4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8041db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8041e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8041eb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8041ef:	48 89 fe             	mov    %rdi,%rsi
+  8041f2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8041f7:	48 b8 f2 40 80 00 00 	movabs $0x8040f2,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804203:	c9                   	leave
+  804204:	c3                   	ret
+
+0000000000804205 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804205:	55                   	push   %rbp
+  804206:	48 89 e5             	mov    %rsp,%rbp
+  804209:	41 54                	push   %r12
+  80420b:	53                   	push   %rbx
+  80420c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80420f:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  804216:	00 00 00 
+  804219:	ff d0                	call   *%rax
+  80421b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80421e:	48 be 50 68 80 00 00 	movabs $0x806850,%rsi
+  804225:	00 00 00 
+  804228:	48 89 df             	mov    %rbx,%rdi
+  80422b:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  804232:	00 00 00 
+  804235:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804237:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80423c:	41 2b 04 24          	sub    (%r12),%eax
+  804240:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804246:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80424d:	00 00 00 
+    stat->st_dev = &devpipe;
+  804250:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  804257:	00 00 00 
+  80425a:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804261:	b8 00 00 00 00       	mov    $0x0,%eax
+  804266:	5b                   	pop    %rbx
+  804267:	41 5c                	pop    %r12
+  804269:	5d                   	pop    %rbp
+  80426a:	c3                   	ret
+
+000000000080426b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80426b:	55                   	push   %rbp
+  80426c:	48 89 e5             	mov    %rsp,%rbp
+  80426f:	41 54                	push   %r12
+  804271:	53                   	push   %rbx
+  804272:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804275:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80427a:	48 89 fe             	mov    %rdi,%rsi
+  80427d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804282:	49 bc 44 2b 80 00 00 	movabs $0x802b44,%r12
+  804289:	00 00 00 
+  80428c:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80428f:	48 89 df             	mov    %rbx,%rdi
+  804292:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+  80429e:	48 89 c6             	mov    %rax,%rsi
+  8042a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ab:	41 ff d4             	call   *%r12
+}
+  8042ae:	5b                   	pop    %rbx
+  8042af:	41 5c                	pop    %r12
+  8042b1:	5d                   	pop    %rbp
+  8042b2:	c3                   	ret
+
+00000000008042b3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042b3:	55                   	push   %rbp
+  8042b4:	48 89 e5             	mov    %rsp,%rbp
+  8042b7:	41 57                	push   %r15
+  8042b9:	41 56                	push   %r14
+  8042bb:	41 55                	push   %r13
+  8042bd:	41 54                	push   %r12
+  8042bf:	53                   	push   %rbx
+  8042c0:	48 83 ec 18          	sub    $0x18,%rsp
+  8042c4:	49 89 fc             	mov    %rdi,%r12
+  8042c7:	49 89 f5             	mov    %rsi,%r13
+  8042ca:	49 89 d7             	mov    %rdx,%r15
+  8042cd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042d1:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  8042d8:	00 00 00 
+  8042db:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  8042dd:	4d 85 ff             	test   %r15,%r15
+  8042e0:	0f 84 af 00 00 00    	je     804395 <devpipe_write+0xe2>
+  8042e6:	48 89 c3             	mov    %rax,%rbx
+  8042e9:	4c 89 f8             	mov    %r15,%rax
+  8042ec:	4d 89 ef             	mov    %r13,%r15
+  8042ef:	4c 01 e8             	add    %r13,%rax
+  8042f2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8042f6:	49 bd 3a 2a 80 00 00 	movabs $0x802a3a,%r13
+  8042fd:	00 00 00 
+            sys_yield();
+  804300:	49 be cb 29 80 00 00 	movabs $0x8029cb,%r14
+  804307:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80430a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80430d:	48 63 ce             	movslq %esi,%rcx
+  804310:	48 63 03             	movslq (%rbx),%rax
+  804313:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804319:	48 39 c1             	cmp    %rax,%rcx
+  80431c:	72 2e                	jb     80434c <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80431e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804323:	48 89 da             	mov    %rbx,%rdx
+  804326:	be 00 10 00 00       	mov    $0x1000,%esi
+  80432b:	4c 89 e7             	mov    %r12,%rdi
+  80432e:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804331:	85 c0                	test   %eax,%eax
+  804333:	74 66                	je     80439b <devpipe_write+0xe8>
+            sys_yield();
+  804335:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804338:	8b 73 04             	mov    0x4(%rbx),%esi
+  80433b:	48 63 ce             	movslq %esi,%rcx
+  80433e:	48 63 03             	movslq (%rbx),%rax
+  804341:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804347:	48 39 c1             	cmp    %rax,%rcx
+  80434a:	73 d2                	jae    80431e <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80434c:	41 0f b6 3f          	movzbl (%r15),%edi
+  804350:	48 89 ca             	mov    %rcx,%rdx
+  804353:	48 c1 ea 03          	shr    $0x3,%rdx
+  804357:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  80435e:	08 10 20 
+  804361:	48 f7 e2             	mul    %rdx
+  804364:	48 c1 ea 06          	shr    $0x6,%rdx
+  804368:	48 89 d0             	mov    %rdx,%rax
+  80436b:	48 c1 e0 09          	shl    $0x9,%rax
+  80436f:	48 29 d0             	sub    %rdx,%rax
+  804372:	48 c1 e0 03          	shl    $0x3,%rax
+  804376:	48 29 c1             	sub    %rax,%rcx
+  804379:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80437e:	83 c6 01             	add    $0x1,%esi
+  804381:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804384:	49 83 c7 01          	add    $0x1,%r15
+  804388:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80438c:	49 39 c7             	cmp    %rax,%r15
+  80438f:	0f 85 75 ff ff ff    	jne    80430a <devpipe_write+0x57>
+    return n;
+  804395:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804399:	eb 05                	jmp    8043a0 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  80439b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043a0:	48 83 c4 18          	add    $0x18,%rsp
+  8043a4:	5b                   	pop    %rbx
+  8043a5:	41 5c                	pop    %r12
+  8043a7:	41 5d                	pop    %r13
+  8043a9:	41 5e                	pop    %r14
+  8043ab:	41 5f                	pop    %r15
+  8043ad:	5d                   	pop    %rbp
+  8043ae:	c3                   	ret
+
+00000000008043af <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043af:	55                   	push   %rbp
+  8043b0:	48 89 e5             	mov    %rsp,%rbp
+  8043b3:	41 57                	push   %r15
+  8043b5:	41 56                	push   %r14
+  8043b7:	41 55                	push   %r13
+  8043b9:	41 54                	push   %r12
+  8043bb:	53                   	push   %rbx
+  8043bc:	48 83 ec 18          	sub    $0x18,%rsp
+  8043c0:	49 89 fc             	mov    %rdi,%r12
+  8043c3:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043c7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8043cb:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  8043d2:	00 00 00 
+  8043d5:	ff d0                	call   *%rax
+  8043d7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8043da:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8043e0:	49 bd 3a 2a 80 00 00 	movabs $0x802a3a,%r13
+  8043e7:	00 00 00 
+            sys_yield();
+  8043ea:	49 be cb 29 80 00 00 	movabs $0x8029cb,%r14
+  8043f1:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8043f4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8043f9:	74 7d                	je     804478 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8043fb:	8b 03                	mov    (%rbx),%eax
+  8043fd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804400:	75 26                	jne    804428 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804402:	4d 85 ff             	test   %r15,%r15
+  804405:	75 77                	jne    80447e <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804407:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80440c:	48 89 da             	mov    %rbx,%rdx
+  80440f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804414:	4c 89 e7             	mov    %r12,%rdi
+  804417:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80441a:	85 c0                	test   %eax,%eax
+  80441c:	74 72                	je     804490 <devpipe_read+0xe1>
+            sys_yield();
+  80441e:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804421:	8b 03                	mov    (%rbx),%eax
+  804423:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804426:	74 df                	je     804407 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804428:	48 63 c8             	movslq %eax,%rcx
+  80442b:	48 89 ca             	mov    %rcx,%rdx
+  80442e:	48 c1 ea 03          	shr    $0x3,%rdx
+  804432:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804439:	08 10 20 
+  80443c:	48 89 d0             	mov    %rdx,%rax
+  80443f:	48 f7 e6             	mul    %rsi
+  804442:	48 c1 ea 06          	shr    $0x6,%rdx
+  804446:	48 89 d0             	mov    %rdx,%rax
+  804449:	48 c1 e0 09          	shl    $0x9,%rax
+  80444d:	48 29 d0             	sub    %rdx,%rax
+  804450:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804457:	00 
+  804458:	48 89 c8             	mov    %rcx,%rax
+  80445b:	48 29 d0             	sub    %rdx,%rax
+  80445e:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804463:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804467:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  80446b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80446e:	49 83 c7 01          	add    $0x1,%r15
+  804472:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804476:	75 83                	jne    8043fb <devpipe_read+0x4c>
+    return n;
+  804478:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80447c:	eb 03                	jmp    804481 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80447e:	4c 89 f8             	mov    %r15,%rax
+}
+  804481:	48 83 c4 18          	add    $0x18,%rsp
+  804485:	5b                   	pop    %rbx
+  804486:	41 5c                	pop    %r12
+  804488:	41 5d                	pop    %r13
+  80448a:	41 5e                	pop    %r14
+  80448c:	41 5f                	pop    %r15
+  80448e:	5d                   	pop    %rbp
+  80448f:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804490:	b8 00 00 00 00       	mov    $0x0,%eax
+  804495:	eb ea                	jmp    804481 <devpipe_read+0xd2>
+
+0000000000804497 <pipe>:
+pipe(int pfd[2]) {
+  804497:	55                   	push   %rbp
+  804498:	48 89 e5             	mov    %rsp,%rbp
+  80449b:	41 55                	push   %r13
+  80449d:	41 54                	push   %r12
+  80449f:	53                   	push   %rbx
+  8044a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8044a4:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8044a7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8044ab:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  8044b2:	00 00 00 
+  8044b5:	ff d0                	call   *%rax
+  8044b7:	89 c3                	mov    %eax,%ebx
+  8044b9:	85 c0                	test   %eax,%eax
+  8044bb:	0f 88 a0 01 00 00    	js     804661 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8044c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044cb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044d4:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  8044db:	00 00 00 
+  8044de:	ff d0                	call   *%rax
+  8044e0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8044e2:	85 c0                	test   %eax,%eax
+  8044e4:	0f 88 77 01 00 00    	js     804661 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8044ea:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8044ee:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+  8044fa:	89 c3                	mov    %eax,%ebx
+  8044fc:	85 c0                	test   %eax,%eax
+  8044fe:	0f 88 43 01 00 00    	js     804647 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804504:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804509:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80450e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804512:	bf 00 00 00 00       	mov    $0x0,%edi
+  804517:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+  804523:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804525:	85 c0                	test   %eax,%eax
+  804527:	0f 88 1a 01 00 00    	js     804647 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80452d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804531:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  804538:	00 00 00 
+  80453b:	ff d0                	call   *%rax
+  80453d:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804540:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804545:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80454a:	48 89 c6             	mov    %rax,%rsi
+  80454d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804552:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  804559:	00 00 00 
+  80455c:	ff d0                	call   *%rax
+  80455e:	89 c3                	mov    %eax,%ebx
+  804560:	85 c0                	test   %eax,%eax
+  804562:	0f 88 c5 00 00 00    	js     80462d <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804568:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80456c:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  804573:	00 00 00 
+  804576:	ff d0                	call   *%rax
+  804578:	48 89 c1             	mov    %rax,%rcx
+  80457b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804581:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80458c:	4c 89 ee             	mov    %r13,%rsi
+  80458f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804594:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  80459b:	00 00 00 
+  80459e:	ff d0                	call   *%rax
+  8045a0:	89 c3                	mov    %eax,%ebx
+  8045a2:	85 c0                	test   %eax,%eax
+  8045a4:	78 6e                	js     804614 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8045a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045ab:	4c 89 ef             	mov    %r13,%rdi
+  8045ae:	48 b8 02 2a 80 00 00 	movabs $0x802a02,%rax
+  8045b5:	00 00 00 
+  8045b8:	ff d0                	call   *%rax
+  8045ba:	83 f8 02             	cmp    $0x2,%eax
+  8045bd:	0f 85 ab 00 00 00    	jne    80466e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8045c3:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  8045ca:	00 00 
+  8045cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045d0:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8045d2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8045d6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8045dd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8045e1:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8045e3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8045e7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8045ee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8045f2:	48 bb 7c 32 80 00 00 	movabs $0x80327c,%rbx
+  8045f9:	00 00 00 
+  8045fc:	ff d3                	call   *%rbx
+  8045fe:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804602:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804606:	ff d3                	call   *%rbx
+  804608:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80460d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804612:	eb 4d                	jmp    804661 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804614:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804619:	4c 89 ee             	mov    %r13,%rsi
+  80461c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804621:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  804628:	00 00 00 
+  80462b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80462d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804632:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804636:	bf 00 00 00 00       	mov    $0x0,%edi
+  80463b:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  804642:	00 00 00 
+  804645:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804647:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80464c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804650:	bf 00 00 00 00       	mov    $0x0,%edi
+  804655:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  80465c:	00 00 00 
+  80465f:	ff d0                	call   *%rax
+}
+  804661:	89 d8                	mov    %ebx,%eax
+  804663:	48 83 c4 18          	add    $0x18,%rsp
+  804667:	5b                   	pop    %rbx
+  804668:	41 5c                	pop    %r12
+  80466a:	41 5d                	pop    %r13
+  80466c:	5d                   	pop    %rbp
+  80466d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80466e:	48 b9 68 68 80 00 00 	movabs $0x806868,%rcx
+  804675:	00 00 00 
+  804678:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  80467f:	00 00 00 
+  804682:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804687:	48 bf 57 68 80 00 00 	movabs $0x806857,%rdi
+  80468e:	00 00 00 
+  804691:	b8 00 00 00 00       	mov    $0x0,%eax
+  804696:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  80469d:	00 00 00 
+  8046a0:	41 ff d0             	call   *%r8
+
+00000000008046a3 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8046a3:	55                   	push   %rbp
+  8046a4:	48 89 e5             	mov    %rsp,%rbp
+  8046a7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8046ab:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8046af:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8046b6:	00 00 00 
+  8046b9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8046bb:	85 c0                	test   %eax,%eax
+  8046bd:	78 35                	js     8046f4 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8046bf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046c3:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+  8046cf:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046dc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046e0:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  8046e7:	00 00 00 
+  8046ea:	ff d0                	call   *%rax
+  8046ec:	85 c0                	test   %eax,%eax
+  8046ee:	0f 94 c0             	sete   %al
+  8046f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8046f4:	c9                   	leave
+  8046f5:	c3                   	ret
+
+00000000008046f6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8046f6:	48 89 f8             	mov    %rdi,%rax
+  8046f9:	48 c1 e8 27          	shr    $0x27,%rax
+  8046fd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804704:	01 00 00 
+  804707:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80470b:	f6 c2 01             	test   $0x1,%dl
+  80470e:	74 6d                	je     80477d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804710:	48 89 f8             	mov    %rdi,%rax
+  804713:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804717:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80471e:	01 00 00 
+  804721:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804725:	f6 c2 01             	test   $0x1,%dl
+  804728:	74 62                	je     80478c <get_uvpt_entry+0x96>
+  80472a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804731:	01 00 00 
+  804734:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804738:	f6 c2 80             	test   $0x80,%dl
+  80473b:	75 4f                	jne    80478c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80473d:	48 89 f8             	mov    %rdi,%rax
+  804740:	48 c1 e8 15          	shr    $0x15,%rax
+  804744:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80474b:	01 00 00 
+  80474e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804752:	f6 c2 01             	test   $0x1,%dl
+  804755:	74 44                	je     80479b <get_uvpt_entry+0xa5>
+  804757:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80475e:	01 00 00 
+  804761:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804765:	f6 c2 80             	test   $0x80,%dl
+  804768:	75 31                	jne    80479b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80476a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80476e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804775:	01 00 00 
+  804778:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80477c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80477d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804784:	01 00 00 
+  804787:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80478b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80478c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804793:	01 00 00 
+  804796:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80479a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80479b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8047a2:	01 00 00 
+  8047a5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047a9:	c3                   	ret
+
+00000000008047aa <get_prot>:
+
+int
+get_prot(void *va) {
+  8047aa:	55                   	push   %rbp
+  8047ab:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047ae:	48 b8 f6 46 80 00 00 	movabs $0x8046f6,%rax
+  8047b5:	00 00 00 
+  8047b8:	ff d0                	call   *%rax
+  8047ba:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8047bd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8047c2:	89 c1                	mov    %eax,%ecx
+  8047c4:	83 c9 04             	or     $0x4,%ecx
+  8047c7:	f6 c2 01             	test   $0x1,%dl
+  8047ca:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8047cd:	89 c1                	mov    %eax,%ecx
+  8047cf:	83 c9 02             	or     $0x2,%ecx
+  8047d2:	f6 c2 02             	test   $0x2,%dl
+  8047d5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8047d8:	89 c1                	mov    %eax,%ecx
+  8047da:	83 c9 01             	or     $0x1,%ecx
+  8047dd:	48 85 d2             	test   %rdx,%rdx
+  8047e0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8047e3:	89 c1                	mov    %eax,%ecx
+  8047e5:	83 c9 40             	or     $0x40,%ecx
+  8047e8:	f6 c6 04             	test   $0x4,%dh
+  8047eb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8047ee:	5d                   	pop    %rbp
+  8047ef:	c3                   	ret
+
+00000000008047f0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8047f0:	55                   	push   %rbp
+  8047f1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047f4:	48 b8 f6 46 80 00 00 	movabs $0x8046f6,%rax
+  8047fb:	00 00 00 
+  8047fe:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804800:	48 c1 e8 06          	shr    $0x6,%rax
+  804804:	83 e0 01             	and    $0x1,%eax
+}
+  804807:	5d                   	pop    %rbp
+  804808:	c3                   	ret
+
+0000000000804809 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804809:	55                   	push   %rbp
+  80480a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80480d:	48 b8 f6 46 80 00 00 	movabs $0x8046f6,%rax
+  804814:	00 00 00 
+  804817:	ff d0                	call   *%rax
+  804819:	83 e0 01             	and    $0x1,%eax
+}
+  80481c:	5d                   	pop    %rbp
+  80481d:	c3                   	ret
+
+000000000080481e <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80481e:	55                   	push   %rbp
+  80481f:	48 89 e5             	mov    %rsp,%rbp
+  804822:	41 57                	push   %r15
+  804824:	41 56                	push   %r14
+  804826:	41 55                	push   %r13
+  804828:	41 54                	push   %r12
+  80482a:	53                   	push   %rbx
+  80482b:	48 83 ec 28          	sub    $0x28,%rsp
+  80482f:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804833:	48 85 ff             	test   %rdi,%rdi
+  804836:	74 1e                	je     804856 <foreach_shared_region+0x38>
+  804838:	49 89 ff             	mov    %rdi,%r15
+  80483b:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804841:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804847:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80484e:	01 00 00 
+  804851:	e9 72 02 00 00       	jmp    804ac8 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804856:	48 b9 8c 68 80 00 00 	movabs $0x80688c,%rcx
+  80485d:	00 00 00 
+  804860:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  804867:	00 00 00 
+  80486a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80486f:	48 bf 90 68 80 00 00 	movabs $0x806890,%rdi
+  804876:	00 00 00 
+  804879:	b8 00 00 00 00       	mov    $0x0,%eax
+  80487e:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  804885:	00 00 00 
+  804888:	41 ff d0             	call   *%r8
+  80488b:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  804892:	eb 6c                	jmp    804900 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804894:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  80489b:	ff ff ff 
+  80489e:	4c 21 e2             	and    %r12,%rdx
+  8048a1:	48 89 d8             	mov    %rbx,%rax
+  8048a4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8048a9:	48 83 c0 01          	add    $0x1,%rax
+  8048ad:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8048b1:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8048b8:	00 00 00 
+  8048bb:	48 21 c8             	and    %rcx,%rax
+  8048be:	48 09 d0             	or     %rdx,%rax
+  8048c1:	49 89 c4             	mov    %rax,%r12
+  8048c4:	eb 30                	jmp    8048f6 <foreach_shared_region+0xd8>
+  8048c6:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8048cd:	ff ff ff 
+  8048d0:	4c 21 e2             	and    %r12,%rdx
+  8048d3:	48 89 d8             	mov    %rbx,%rax
+  8048d6:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8048db:	48 83 c0 01          	add    $0x1,%rax
+  8048df:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8048e3:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8048ea:	00 00 00 
+  8048ed:	48 21 c8             	and    %rcx,%rax
+  8048f0:	48 09 d0             	or     %rdx,%rax
+  8048f3:	49 89 c4             	mov    %rax,%r12
+  8048f6:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8048fa:	0f 84 99 01 00 00    	je     804a99 <foreach_shared_region+0x27b>
+  804900:	4c 89 e3             	mov    %r12,%rbx
+  804903:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  804907:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80490e:	01 00 00 
+  804911:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  804915:	a8 01                	test   $0x1,%al
+  804917:	0f 84 77 ff ff ff    	je     804894 <foreach_shared_region+0x76>
+  80491d:	a8 80                	test   $0x80,%al
+  80491f:	74 19                	je     80493a <foreach_shared_region+0x11c>
+  804921:	f6 c4 04             	test   $0x4,%ah
+  804924:	74 a0                	je     8048c6 <foreach_shared_region+0xa8>
+  804926:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  80492d:	40 
+  80492e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804932:	4c 89 e7             	mov    %r12,%rdi
+  804935:	41 ff d7             	call   *%r15
+  804938:	eb 8c                	jmp    8048c6 <foreach_shared_region+0xa8>
+  80493a:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804941:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804945:	eb 46                	jmp    80498d <foreach_shared_region+0x16f>
+  804947:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80494e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804954:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804958:	48 c1 e0 15          	shl    $0x15,%rax
+  80495c:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804961:	49 09 c4             	or     %rax,%r12
+  804964:	eb 1d                	jmp    804983 <foreach_shared_region+0x165>
+  804966:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80496d:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804973:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804977:	48 c1 e0 15          	shl    $0x15,%rax
+  80497b:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  804980:	49 09 c4             	or     %rax,%r12
+  804983:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804987:	0f 84 d3 00 00 00    	je     804a60 <foreach_shared_region+0x242>
+  80498d:	4c 89 e3             	mov    %r12,%rbx
+  804990:	48 c1 eb 15          	shr    $0x15,%rbx
+  804994:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80499b:	01 00 00 
+  80499e:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8049a2:	a8 01                	test   $0x1,%al
+  8049a4:	74 a1                	je     804947 <foreach_shared_region+0x129>
+  8049a6:	a8 80                	test   $0x80,%al
+  8049a8:	74 19                	je     8049c3 <foreach_shared_region+0x1a5>
+  8049aa:	f6 c4 04             	test   $0x4,%ah
+  8049ad:	74 b7                	je     804966 <foreach_shared_region+0x148>
+  8049af:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8049b6:	00 
+  8049b7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049bb:	4c 89 e7             	mov    %r12,%rdi
+  8049be:	41 ff d7             	call   *%r15
+  8049c1:	eb a3                	jmp    804966 <foreach_shared_region+0x148>
+  8049c3:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8049c9:	eb 3b                	jmp    804a06 <foreach_shared_region+0x1e8>
+  8049cb:	f6 c4 04             	test   $0x4,%ah
+  8049ce:	74 12                	je     8049e2 <foreach_shared_region+0x1c4>
+  8049d0:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  8049d7:	00 
+  8049d8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8049dc:	4c 89 e7             	mov    %r12,%rdi
+  8049df:	41 ff d7             	call   *%r15
+  8049e2:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8049e9:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8049ef:	48 83 c3 01          	add    $0x1,%rbx
+  8049f3:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8049f7:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8049fd:	49 09 dc             	or     %rbx,%r12
+  804a00:	41 83 ed 01          	sub    $0x1,%r13d
+  804a04:	74 2f                	je     804a35 <foreach_shared_region+0x217>
+  804a06:	4c 89 e3             	mov    %r12,%rbx
+  804a09:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804a0d:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804a11:	a8 01                	test   $0x1,%al
+  804a13:	75 b6                	jne    8049cb <foreach_shared_region+0x1ad>
+  804a15:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804a1c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804a22:	48 83 c3 01          	add    $0x1,%rbx
+  804a26:	48 c1 e3 0c          	shl    $0xc,%rbx
+  804a2a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804a30:	49 09 dc             	or     %rbx,%r12
+  804a33:	eb cb                	jmp    804a00 <foreach_shared_region+0x1e2>
+  804a35:	4c 89 e0             	mov    %r12,%rax
+  804a38:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804a3e:	49 c1 ec 15          	shr    $0x15,%r12
+  804a42:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a49:	49 83 c4 01          	add    $0x1,%r12
+  804a4d:	49 c1 e4 15          	shl    $0x15,%r12
+  804a51:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804a58:	49 09 c4             	or     %rax,%r12
+  804a5b:	e9 23 ff ff ff       	jmp    804983 <foreach_shared_region+0x165>
+  804a60:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804a64:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804a6b:	ff ff ff 
+  804a6e:	4c 21 e0             	and    %r12,%rax
+  804a71:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804a75:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804a7c:	49 83 c4 01          	add    $0x1,%r12
+  804a80:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804a84:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804a8b:	00 00 00 
+  804a8e:	49 21 d4             	and    %rdx,%r12
+  804a91:	49 09 c4             	or     %rax,%r12
+  804a94:	e9 5d fe ff ff       	jmp    8048f6 <foreach_shared_region+0xd8>
+  804a99:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  804aa0:	00 ff ff 
+  804aa3:	4c 21 e0             	and    %r12,%rax
+  804aa6:	49 c1 ec 27          	shr    $0x27,%r12
+  804aaa:	49 83 c4 01          	add    $0x1,%r12
+  804aae:	49 c1 e4 27          	shl    $0x27,%r12
+  804ab2:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804ab9:	ff 00 00 
+  804abc:	49 21 d4             	and    %rdx,%r12
+  804abf:	49 09 c4             	or     %rax,%r12
+  804ac2:	41 83 ed 01          	sub    $0x1,%r13d
+  804ac6:	74 48                	je     804b10 <foreach_shared_region+0x2f2>
+  804ac8:	4c 89 e0             	mov    %r12,%rax
+  804acb:	48 c1 e8 27          	shr    $0x27,%rax
+  804acf:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804ad6:	01 00 00 
+  804ad9:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804add:	f6 c2 01             	test   $0x1,%dl
+  804ae0:	0f 85 a5 fd ff ff    	jne    80488b <foreach_shared_region+0x6d>
+  804ae6:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804aed:	00 ff ff 
+  804af0:	4c 21 e2             	and    %r12,%rdx
+  804af3:	48 83 c0 01          	add    $0x1,%rax
+  804af7:	48 c1 e0 27          	shl    $0x27,%rax
+  804afb:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804b02:	ff 00 00 
+  804b05:	48 21 c8             	and    %rcx,%rax
+  804b08:	48 09 d0             	or     %rdx,%rax
+  804b0b:	49 89 c4             	mov    %rax,%r12
+  804b0e:	eb b2                	jmp    804ac2 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804b10:	4d 85 e4             	test   %r12,%r12
+  804b13:	75 14                	jne    804b29 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  804b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b1a:	48 83 c4 28          	add    $0x28,%rsp
+  804b1e:	5b                   	pop    %rbx
+  804b1f:	41 5c                	pop    %r12
+  804b21:	41 5d                	pop    %r13
+  804b23:	41 5e                	pop    %r14
+  804b25:	41 5f                	pop    %r15
+  804b27:	5d                   	pop    %rbp
+  804b28:	c3                   	ret
+    assert(addr == 0);
+  804b29:	48 b9 9b 68 80 00 00 	movabs $0x80689b,%rcx
+  804b30:	00 00 00 
+  804b33:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  804b3a:	00 00 00 
+  804b3d:	be 67 00 00 00       	mov    $0x67,%esi
+  804b42:	48 bf 90 68 80 00 00 	movabs $0x806890,%rdi
+  804b49:	00 00 00 
+  804b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b51:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  804b58:	00 00 00 
+  804b5b:	41 ff d0             	call   *%r8
+
+0000000000804b5e <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  804b5e:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804b65:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804b68:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  804b6e:	eb 33                	jmp    804ba3 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804b70:	48 83 c0 20          	add    $0x20,%rax
+  804b74:	4c 39 c0             	cmp    %r8,%rax
+  804b77:	74 25                	je     804b9e <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804b79:	48 8b 10             	mov    (%rax),%rdx
+  804b7c:	48 85 d2             	test   %rdx,%rdx
+  804b7f:	74 ef                	je     804b70 <mmap_place+0x12>
+  804b81:	48 89 d1             	mov    %rdx,%rcx
+  804b84:	48 03 48 08          	add    0x8(%rax),%rcx
+  804b88:	48 39 cf             	cmp    %rcx,%rdi
+  804b8b:	73 e3                	jae    804b70 <mmap_place+0x12>
+  804b8d:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  804b91:	4c 39 ca             	cmp    %r9,%rdx
+  804b94:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804b98:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804b9c:	eb d2                	jmp    804b70 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804b9e:	45 84 d2             	test   %r10b,%r10b
+  804ba1:	74 12                	je     804bb5 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804ba3:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804baa:	00 00 00 
+        moved = 0;
+  804bad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804bb3:	eb c4                	jmp    804b79 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804bb5:	48 01 fe             	add    %rdi,%rsi
+  804bb8:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804bbf:	00 00 00 
+  804bc2:	48 39 f0             	cmp    %rsi,%rax
+  804bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bca:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804bce:	c3                   	ret
+
+0000000000804bcf <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804bcf:	55                   	push   %rbp
+  804bd0:	48 89 e5             	mov    %rsp,%rbp
+  804bd3:	41 57                	push   %r15
+  804bd5:	41 56                	push   %r14
+  804bd7:	41 55                	push   %r13
+  804bd9:	41 54                	push   %r12
+  804bdb:	53                   	push   %rbx
+  804bdc:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804be0:	48 8b 1f             	mov    (%rdi),%rbx
+  804be3:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804bea:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bf1:	00 00 00 
+  804bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf9:	eb 12                	jmp    804c0d <mmap_pgfault+0x3e>
+  804bfb:	48 83 c2 01          	add    $0x1,%rdx
+  804bff:	48 83 c0 20          	add    $0x20,%rax
+  804c03:	48 83 fa 20          	cmp    $0x20,%rdx
+  804c07:	0f 84 04 01 00 00    	je     804d11 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804c0d:	48 8b 08             	mov    (%rax),%rcx
+  804c10:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804c14:	48 39 de             	cmp    %rbx,%rsi
+  804c17:	73 e2                	jae    804bfb <mmap_pgfault+0x2c>
+  804c19:	48 03 48 08          	add    0x8(%rax),%rcx
+  804c1d:	48 39 cb             	cmp    %rcx,%rbx
+  804c20:	73 d9                	jae    804bfb <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804c22:	48 c1 e2 05          	shl    $0x5,%rdx
+  804c26:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c2d:	00 00 00 
+  804c30:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804c34:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804c38:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804c3c:	f6 c2 01             	test   $0x1,%dl
+  804c3f:	0f 84 e0 00 00 00    	je     804d25 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4a:	f6 c2 02             	test   $0x2,%dl
+  804c4d:	0f 84 c3 00 00 00    	je     804d16 <mmap_pgfault+0x147>
+  804c53:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c5a:	ff ff ff 
+  804c5d:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804c61:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804c68:	00 00 00 
+  804c6b:	48 39 ca             	cmp    %rcx,%rdx
+  804c6e:	0f 85 a2 00 00 00    	jne    804d16 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804c74:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c79:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c7e:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804c85:	00 00 00 
+  804c88:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c8d:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  804c94:	00 00 00 
+  804c97:	ff d0                	call   *%rax
+  804c99:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca0:	85 d2                	test   %edx,%edx
+  804ca2:	78 72                	js     804d16 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804ca4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ca9:	48 89 de             	mov    %rbx,%rsi
+  804cac:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804cb3:	00 00 00 
+  804cb6:	4c 89 e7             	mov    %r12,%rdi
+  804cb9:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  804cc0:	00 00 00 
+  804cc3:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804cc5:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804ccb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804cd1:	48 89 d9             	mov    %rbx,%rcx
+  804cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cd9:	4c 89 e6             	mov    %r12,%rsi
+  804cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ce1:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  804ce8:	00 00 00 
+  804ceb:	ff d0                	call   *%rax
+  804ced:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804cef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804cf4:	4c 89 e6             	mov    %r12,%rsi
+  804cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cfc:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  804d03:	00 00 00 
+  804d06:	ff d0                	call   *%rax
+    return res >= 0;
+  804d08:	89 d8                	mov    %ebx,%eax
+  804d0a:	f7 d0                	not    %eax
+  804d0c:	c1 e8 1f             	shr    $0x1f,%eax
+  804d0f:	eb 05                	jmp    804d16 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804d11:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804d16:	48 83 c4 18          	add    $0x18,%rsp
+  804d1a:	5b                   	pop    %rbx
+  804d1b:	41 5c                	pop    %r12
+  804d1d:	41 5d                	pop    %r13
+  804d1f:	41 5e                	pop    %r14
+  804d21:	41 5f                	pop    %r15
+  804d23:	5d                   	pop    %rbp
+  804d24:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804d25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d29:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804d2d:	4c 03 30             	add    (%rax),%r14
+  804d30:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804d37:	49 39 c6             	cmp    %rax,%r14
+  804d3a:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804d3e:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804d45:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804d4b:	49 bf 09 48 80 00 00 	movabs $0x804809,%r15
+  804d52:	00 00 00 
+  804d55:	4d 39 f4             	cmp    %r14,%r12
+  804d58:	73 1d                	jae    804d77 <mmap_pgfault+0x1a8>
+  804d5a:	4c 89 e7             	mov    %r12,%rdi
+  804d5d:	41 ff d7             	call   *%r15
+  804d60:	84 c0                	test   %al,%al
+  804d62:	75 13                	jne    804d77 <mmap_pgfault+0x1a8>
+  804d64:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804d6b:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804d72:	4d 39 f4             	cmp    %r14,%r12
+  804d75:	72 e3                	jb     804d5a <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804d77:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804d7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d81:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804d85:	74 2a                	je     804db1 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804d87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d8b:	89 de                	mov    %ebx,%esi
+  804d8d:	2b 30                	sub    (%rax),%esi
+  804d8f:	03 70 1c             	add    0x1c(%rax),%esi
+  804d92:	8b 78 18             	mov    0x18(%rax),%edi
+  804d95:	4c 89 e9             	mov    %r13,%rcx
+  804d98:	48 89 da             	mov    %rbx,%rdx
+  804d9b:	48 b8 67 3f 80 00 00 	movabs $0x803f67,%rax
+  804da2:	00 00 00 
+  804da5:	ff d0                	call   *%rax
+    return res > 0;
+  804da7:	85 c0                	test   %eax,%eax
+  804da9:	0f 9f c0             	setg   %al
+  804dac:	e9 65 ff ff ff       	jmp    804d16 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804db1:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804db5:	eb d0                	jmp    804d87 <mmap_pgfault+0x1b8>
+
+0000000000804db7 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804db7:	55                   	push   %rbp
+  804db8:	48 89 e5             	mov    %rsp,%rbp
+  804dbb:	41 57                	push   %r15
+  804dbd:	41 56                	push   %r14
+  804dbf:	41 55                	push   %r13
+  804dc1:	41 54                	push   %r12
+  804dc3:	53                   	push   %rbx
+  804dc4:	48 83 ec 28          	sub    $0x28,%rsp
+  804dc8:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804dcc:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804dcf:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804dd6:	ff ff ff 
+  804dd9:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de2:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804de9:	00 00 00 
+  804dec:	48 39 ca             	cmp    %rcx,%rdx
+  804def:	0f 85 e5 00 00 00    	jne    804eda <mmap_writeback+0x123>
+  804df5:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804df8:	4c 39 ee             	cmp    %r13,%rsi
+  804dfb:	0f 83 e8 00 00 00    	jae    804ee9 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e01:	49 be 09 48 80 00 00 	movabs $0x804809,%r14
+  804e08:	00 00 00 
+  804e0b:	49 bf f0 47 80 00 00 	movabs $0x8047f0,%r15
+  804e12:	00 00 00 
+  804e15:	eb 10                	jmp    804e27 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804e17:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804e1e:	4d 39 ec             	cmp    %r13,%r12
+  804e21:	0f 83 ae 00 00 00    	jae    804ed5 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804e27:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804e2b:	4c 89 e7             	mov    %r12,%rdi
+  804e2e:	41 ff d6             	call   *%r14
+  804e31:	84 c0                	test   %al,%al
+  804e33:	74 e2                	je     804e17 <mmap_writeback+0x60>
+  804e35:	4c 89 e7             	mov    %r12,%rdi
+  804e38:	41 ff d7             	call   *%r15
+  804e3b:	84 c0                	test   %al,%al
+  804e3d:	74 d8                	je     804e17 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804e3f:	4c 89 e3             	mov    %r12,%rbx
+  804e42:	4d 39 ec             	cmp    %r13,%r12
+  804e45:	73 20                	jae    804e67 <mmap_writeback+0xb0>
+  804e47:	48 89 df             	mov    %rbx,%rdi
+  804e4a:	41 ff d6             	call   *%r14
+  804e4d:	84 c0                	test   %al,%al
+  804e4f:	74 16                	je     804e67 <mmap_writeback+0xb0>
+  804e51:	48 89 df             	mov    %rbx,%rdi
+  804e54:	41 ff d7             	call   *%r15
+  804e57:	84 c0                	test   %al,%al
+  804e59:	74 0c                	je     804e67 <mmap_writeback+0xb0>
+  804e5b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804e62:	4c 39 eb             	cmp    %r13,%rbx
+  804e65:	72 e0                	jb     804e47 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804e67:	48 89 d9             	mov    %rbx,%rcx
+  804e6a:	4c 29 e1             	sub    %r12,%rcx
+  804e6d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804e71:	44 89 e6             	mov    %r12d,%esi
+  804e74:	2b 30                	sub    (%rax),%esi
+  804e76:	49 89 c4             	mov    %rax,%r12
+  804e79:	03 70 1c             	add    0x1c(%rax),%esi
+  804e7c:	8b 78 18             	mov    0x18(%rax),%edi
+  804e7f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804e83:	48 89 ca             	mov    %rcx,%rdx
+  804e86:	48 b8 f0 3f 80 00 00 	movabs $0x803ff0,%rax
+  804e8d:	00 00 00 
+  804e90:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e92:	85 c0                	test   %eax,%eax
+  804e94:	78 44                	js     804eda <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804e96:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804e9b:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804e9e:	41 89 c1             	mov    %eax,%r9d
+  804ea1:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804ea8:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804eac:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804eb5:	48 89 ce             	mov    %rcx,%rsi
+  804eb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ebd:	48 b8 d9 2a 80 00 00 	movabs $0x802ad9,%rax
+  804ec4:	00 00 00 
+  804ec7:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804ec9:	85 c0                	test   %eax,%eax
+  804ecb:	78 0d                	js     804eda <mmap_writeback+0x123>
+  804ecd:	49 89 dc             	mov    %rbx,%r12
+  804ed0:	e9 49 ff ff ff       	jmp    804e1e <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eda:	48 83 c4 28          	add    $0x28,%rsp
+  804ede:	5b                   	pop    %rbx
+  804edf:	41 5c                	pop    %r12
+  804ee1:	41 5d                	pop    %r13
+  804ee3:	41 5e                	pop    %r14
+  804ee5:	41 5f                	pop    %r15
+  804ee7:	5d                   	pop    %rbp
+  804ee8:	c3                   	ret
+    return 0;
+  804ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eee:	eb ea                	jmp    804eda <mmap_writeback+0x123>
+
+0000000000804ef0 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804ef0:	55                   	push   %rbp
+  804ef1:	48 89 e5             	mov    %rsp,%rbp
+  804ef4:	41 57                	push   %r15
+  804ef6:	41 56                	push   %r14
+  804ef8:	41 55                	push   %r13
+  804efa:	41 54                	push   %r12
+  804efc:	53                   	push   %rbx
+  804efd:	48 83 ec 38          	sub    $0x38,%rsp
+  804f01:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f05:	48 85 f6             	test   %rsi,%rsi
+  804f08:	0f 84 0c 02 00 00    	je     80511a <mmap+0x22a>
+  804f0e:	49 89 ff             	mov    %rdi,%r15
+  804f11:	49 89 f4             	mov    %rsi,%r12
+  804f14:	41 89 d5             	mov    %edx,%r13d
+  804f17:	41 89 ce             	mov    %ecx,%r14d
+  804f1a:	44 89 cb             	mov    %r9d,%ebx
+  804f1d:	45 85 c9             	test   %r9d,%r9d
+  804f20:	0f 88 f4 01 00 00    	js     80511a <mmap+0x22a>
+  804f26:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f2d:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804f34:	0f 85 e7 01 00 00    	jne    805121 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804f3a:	83 e2 fd             	and    $0xfffffffd,%edx
+  804f3d:	83 fa 04             	cmp    $0x4,%edx
+  804f40:	0f 85 db 01 00 00    	jne    805121 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804f46:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804f49:	83 fa 01             	cmp    $0x1,%edx
+  804f4c:	0f 87 cf 01 00 00    	ja     805121 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804f52:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804f56:	44 89 c7             	mov    %r8d,%edi
+  804f59:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  804f60:	00 00 00 
+  804f63:	ff d0                	call   *%rax
+  804f65:	89 c2                	mov    %eax,%edx
+  804f67:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f6e:	85 d2                	test   %edx,%edx
+  804f70:	0f 88 ab 01 00 00    	js     805121 <mmap+0x231>
+  804f76:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804f7a:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804f81:	00 00 00 
+  804f84:	8b 09                	mov    (%rcx),%ecx
+  804f86:	39 0a                	cmp    %ecx,(%rdx)
+  804f88:	0f 85 93 01 00 00    	jne    805121 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804f8e:	8b 52 08             	mov    0x8(%rdx),%edx
+  804f91:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804f94:	83 fa 01             	cmp    $0x1,%edx
+  804f97:	0f 84 84 01 00 00    	je     805121 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804f9d:	41 83 fe 01          	cmp    $0x1,%r14d
+  804fa1:	74 42                	je     804fe5 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804fa3:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804faa:	4c 89 e6             	mov    %r12,%rsi
+  804fad:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804fb4:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804fb8:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804fbc:	4d 85 ff             	test   %r15,%r15
+  804fbf:	74 67                	je     805028 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804fc1:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804fc8:	75 0f                	jne    804fd9 <mmap+0xe9>
+  804fca:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804fd1:	00 00 00 
+  804fd4:	49 39 c7             	cmp    %rax,%r15
+  804fd7:	77 1b                	ja     804ff4 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804fd9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804fe0:	e9 3c 01 00 00       	jmp    805121 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804fe5:	41 f6 c5 02          	test   $0x2,%r13b
+  804fe9:	74 b8                	je     804fa3 <mmap+0xb3>
+  804feb:	85 d2                	test   %edx,%edx
+  804fed:	75 b4                	jne    804fa3 <mmap+0xb3>
+  804fef:	e9 2d 01 00 00       	jmp    805121 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804ff4:	4c 89 ff             	mov    %r15,%rdi
+  804ff7:	48 b8 5e 4b 80 00 00 	movabs $0x804b5e,%rax
+  804ffe:	00 00 00 
+  805001:	ff d0                	call   *%rax
+  805003:	48 89 c2             	mov    %rax,%rdx
+  805006:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  80500d:	49 39 d7             	cmp    %rdx,%r15
+  805010:	0f 85 0b 01 00 00    	jne    805121 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805016:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  80501d:	00 00 00 
+  805020:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805026:	eb 44                	jmp    80506c <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805028:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80502c:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805033:	00 00 00 
+  805036:	48 b8 5e 4b 80 00 00 	movabs $0x804b5e,%rax
+  80503d:	00 00 00 
+  805040:	ff d0                	call   *%rax
+  805042:	48 89 c7             	mov    %rax,%rdi
+  805045:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805049:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805050:	48 85 ff             	test   %rdi,%rdi
+  805053:	75 c1                	jne    805016 <mmap+0x126>
+  805055:	e9 c7 00 00 00       	jmp    805121 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80505a:	49 83 c4 01          	add    $0x1,%r12
+  80505e:	48 83 c0 20          	add    $0x20,%rax
+  805062:	49 83 fc 20          	cmp    $0x20,%r12
+  805066:	0f 84 a5 00 00 00    	je     805111 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80506c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805070:	75 e8                	jne    80505a <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805072:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805076:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  80507d:	00 00 00 
+  805080:	ff d0                	call   *%rax
+  805082:	89 c2                	mov    %eax,%edx
+  805084:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80508b:	85 d2                	test   %edx,%edx
+  80508d:	0f 88 8e 00 00 00    	js     805121 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805093:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805097:	48 b8 7c 32 80 00 00 	movabs $0x80327c,%rax
+  80509e:	00 00 00 
+  8050a1:	ff d0                	call   *%rax
+  8050a3:	89 c6                	mov    %eax,%esi
+  8050a5:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8050a8:	48 b8 ca 34 80 00 00 	movabs $0x8034ca,%rax
+  8050af:	00 00 00 
+  8050b2:	ff d0                	call   *%rax
+  8050b4:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8050b7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8050be:	45 85 ff             	test   %r15d,%r15d
+  8050c1:	78 5e                	js     805121 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8050c3:	49 c1 e4 05          	shl    $0x5,%r12
+  8050c7:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8050ce:	00 00 00 
+  8050d1:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  8050d4:	48 bf cf 4b 80 00 00 	movabs $0x804bcf,%rdi
+  8050db:	00 00 00 
+  8050de:	48 b8 fa 55 80 00 00 	movabs $0x8055fa,%rax
+  8050e5:	00 00 00 
+  8050e8:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  8050ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8050ee:	49 89 04 24          	mov    %rax,(%r12)
+  8050f2:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  8050f6:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  8050fb:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805100:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805105:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  80510a:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  80510f:	eb 10                	jmp    805121 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805111:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805118:	eb 07                	jmp    805121 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  80511a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805121:	48 83 c4 38          	add    $0x38,%rsp
+  805125:	5b                   	pop    %rbx
+  805126:	41 5c                	pop    %r12
+  805128:	41 5d                	pop    %r13
+  80512a:	41 5e                	pop    %r14
+  80512c:	41 5f                	pop    %r15
+  80512e:	5d                   	pop    %rbp
+  80512f:	c3                   	ret
+
+0000000000805130 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805130:	55                   	push   %rbp
+  805131:	48 89 e5             	mov    %rsp,%rbp
+  805134:	41 57                	push   %r15
+  805136:	41 56                	push   %r14
+  805138:	41 55                	push   %r13
+  80513a:	41 54                	push   %r12
+  80513c:	53                   	push   %rbx
+  80513d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805141:	49 89 fe             	mov    %rdi,%r14
+  805144:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80514b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805152:	00 
+  805153:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80515a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805161:	00 00 00 
+  805164:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80516b:	49 bf b7 4d 80 00 00 	movabs $0x804db7,%r15
+  805172:	00 00 00 
+  805175:	eb 09                	jmp    805180 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805177:	48 83 c3 20          	add    $0x20,%rbx
+  80517b:	4c 39 eb             	cmp    %r13,%rbx
+  80517e:	74 33                	je     8051b3 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805180:	48 89 df             	mov    %rbx,%rdi
+  805183:	48 8b 33             	mov    (%rbx),%rsi
+  805186:	4c 39 e6             	cmp    %r12,%rsi
+  805189:	73 ec                	jae    805177 <msync+0x47>
+  80518b:	48 85 f6             	test   %rsi,%rsi
+  80518e:	74 e7                	je     805177 <msync+0x47>
+  805190:	48 89 f2             	mov    %rsi,%rdx
+  805193:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805197:	49 39 d6             	cmp    %rdx,%r14
+  80519a:	73 db                	jae    805177 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  80519c:	4c 39 e2             	cmp    %r12,%rdx
+  80519f:	49 0f 47 d4          	cmova  %r12,%rdx
+  8051a3:	4c 39 f6             	cmp    %r14,%rsi
+  8051a6:	49 0f 42 f6          	cmovb  %r14,%rsi
+  8051aa:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  8051ad:	85 c0                	test   %eax,%eax
+  8051af:	79 c6                	jns    805177 <msync+0x47>
+  8051b1:	eb 05                	jmp    8051b8 <msync+0x88>
+    }
+
+    return 0;
+  8051b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051b8:	48 83 c4 08          	add    $0x8,%rsp
+  8051bc:	5b                   	pop    %rbx
+  8051bd:	41 5c                	pop    %r12
+  8051bf:	41 5d                	pop    %r13
+  8051c1:	41 5e                	pop    %r14
+  8051c3:	41 5f                	pop    %r15
+  8051c5:	5d                   	pop    %rbp
+  8051c6:	c3                   	ret
+
+00000000008051c7 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  8051c7:	55                   	push   %rbp
+  8051c8:	48 89 e5             	mov    %rsp,%rbp
+  8051cb:	41 57                	push   %r15
+  8051cd:	41 56                	push   %r14
+  8051cf:	41 55                	push   %r13
+  8051d1:	41 54                	push   %r12
+  8051d3:	53                   	push   %rbx
+  8051d4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  8051d8:	49 89 ff             	mov    %rdi,%r15
+  8051db:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  8051e2:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  8051e9:	00 
+  8051ea:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8051f1:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  8051f8:	00 00 00 
+  8051fb:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805202:	48 89 d8             	mov    %rbx,%rax
+  805205:	eb 09                	jmp    805210 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805207:	48 83 c0 20          	add    $0x20,%rax
+  80520b:	4c 39 f0             	cmp    %r14,%rax
+  80520e:	74 40                	je     805250 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805210:	48 8b 10             	mov    (%rax),%rdx
+  805213:	4c 39 e2             	cmp    %r12,%rdx
+  805216:	73 ef                	jae    805207 <munmap+0x40>
+  805218:	48 85 d2             	test   %rdx,%rdx
+  80521b:	74 ea                	je     805207 <munmap+0x40>
+  80521d:	48 89 d7             	mov    %rdx,%rdi
+  805220:	48 03 78 08          	add    0x8(%rax),%rdi
+  805224:	49 39 ff             	cmp    %rdi,%r15
+  805227:	73 de                	jae    805207 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805229:	49 39 fc             	cmp    %rdi,%r12
+  80522c:	72 05                	jb     805233 <munmap+0x6c>
+  80522e:	4c 39 fa             	cmp    %r15,%rdx
+  805231:	73 d4                	jae    805207 <munmap+0x40>
+  805233:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805238:	48 83 c4 08          	add    $0x8,%rsp
+  80523c:	5b                   	pop    %rbx
+  80523d:	41 5c                	pop    %r12
+  80523f:	41 5d                	pop    %r13
+  805241:	41 5e                	pop    %r14
+  805243:	41 5f                	pop    %r15
+  805245:	5d                   	pop    %rbp
+  805246:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805247:	48 83 c3 20          	add    $0x20,%rbx
+  80524b:	4c 39 f3             	cmp    %r14,%rbx
+  80524e:	74 5c                	je     8052ac <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805250:	48 8b 33             	mov    (%rbx),%rsi
+  805253:	4c 39 e6             	cmp    %r12,%rsi
+  805256:	73 ef                	jae    805247 <munmap+0x80>
+  805258:	48 85 f6             	test   %rsi,%rsi
+  80525b:	74 ea                	je     805247 <munmap+0x80>
+  80525d:	48 89 f2             	mov    %rsi,%rdx
+  805260:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805264:	49 39 d7             	cmp    %rdx,%r15
+  805267:	73 de                	jae    805247 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805269:	48 89 df             	mov    %rbx,%rdi
+  80526c:	48 b8 b7 4d 80 00 00 	movabs $0x804db7,%rax
+  805273:	00 00 00 
+  805276:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805278:	85 c0                	test   %eax,%eax
+  80527a:	78 bc                	js     805238 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  80527c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805280:	48 8b 33             	mov    (%rbx),%rsi
+  805283:	bf 00 00 00 00       	mov    $0x0,%edi
+  805288:	48 b8 44 2b 80 00 00 	movabs $0x802b44,%rax
+  80528f:	00 00 00 
+  805292:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805294:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805297:	48 b8 6f 34 80 00 00 	movabs $0x80346f,%rax
+  80529e:	00 00 00 
+  8052a1:	ff d0                	call   *%rax
+        reg->start = 0;
+  8052a3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8052aa:	eb 9b                	jmp    805247 <munmap+0x80>
+    return 0;
+  8052ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b1:	eb 85                	jmp    805238 <munmap+0x71>
+
+00000000008052b3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8052b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b8:	c3                   	ret
+
+00000000008052b9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8052b9:	55                   	push   %rbp
+  8052ba:	48 89 e5             	mov    %rsp,%rbp
+  8052bd:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8052c0:	48 be a5 68 80 00 00 	movabs $0x8068a5,%rsi
+  8052c7:	00 00 00 
+  8052ca:	48 b8 07 23 80 00 00 	movabs $0x802307,%rax
+  8052d1:	00 00 00 
+  8052d4:	ff d0                	call   *%rax
+    return 0;
+}
+  8052d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052db:	5d                   	pop    %rbp
+  8052dc:	c3                   	ret
+
+00000000008052dd <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8052dd:	55                   	push   %rbp
+  8052de:	48 89 e5             	mov    %rsp,%rbp
+  8052e1:	41 57                	push   %r15
+  8052e3:	41 56                	push   %r14
+  8052e5:	41 55                	push   %r13
+  8052e7:	41 54                	push   %r12
+  8052e9:	53                   	push   %rbx
+  8052ea:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8052f1:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8052f8:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  8052ff:	00 00 00 00 
+  805303:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  80530a:	00 00 00 00 
+  80530e:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805315:	00 00 00 00 
+  805319:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805320:	00 00 00 00 
+  805324:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  80532b:	00 00 00 00 
+  80532f:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805336:	00 00 00 00 
+  80533a:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805341:	00 
+  805342:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805349:	00 
+  80534a:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805351:	00 
+  805352:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805359:	00 
+  80535a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805361:	00 
+  805362:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805369:	00 
+  80536a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805371:	00 
+  805372:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805379:	00 
+  80537a:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805381:	00 
+  805382:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805389:	00 
+    for (res = 0; res < n; res += inc) {
+  80538a:	48 85 d2             	test   %rdx,%rdx
+  80538d:	74 7a                	je     805409 <devcons_write+0x12c>
+  80538f:	49 89 d6             	mov    %rdx,%r14
+  805392:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805398:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80539d:	49 bf 57 26 80 00 00 	movabs $0x802657,%r15
+  8053a4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8053a7:	4c 89 f3             	mov    %r14,%rbx
+  8053aa:	48 29 f3             	sub    %rsi,%rbx
+  8053ad:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8053b2:	48 39 c3             	cmp    %rax,%rbx
+  8053b5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8053b9:	4c 63 eb             	movslq %ebx,%r13
+  8053bc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8053c3:	48 01 c6             	add    %rax,%rsi
+  8053c6:	4c 89 ea             	mov    %r13,%rdx
+  8053c9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8053d0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8053d3:	4c 89 ee             	mov    %r13,%rsi
+  8053d6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8053dd:	48 b8 84 28 80 00 00 	movabs $0x802884,%rax
+  8053e4:	00 00 00 
+  8053e7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8053e9:	41 01 dc             	add    %ebx,%r12d
+  8053ec:	49 63 f4             	movslq %r12d,%rsi
+  8053ef:	4c 39 f6             	cmp    %r14,%rsi
+  8053f2:	72 b3                	jb     8053a7 <devcons_write+0xca>
+    return res;
+  8053f4:	49 63 c4             	movslq %r12d,%rax
+}
+  8053f7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8053fe:	5b                   	pop    %rbx
+  8053ff:	41 5c                	pop    %r12
+  805401:	41 5d                	pop    %r13
+  805403:	41 5e                	pop    %r14
+  805405:	41 5f                	pop    %r15
+  805407:	5d                   	pop    %rbp
+  805408:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805409:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80540f:	eb e3                	jmp    8053f4 <devcons_write+0x117>
+
+0000000000805411 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805411:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805414:	ba 00 00 00 00       	mov    $0x0,%edx
+  805419:	48 85 c0             	test   %rax,%rax
+  80541c:	74 55                	je     805473 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80541e:	55                   	push   %rbp
+  80541f:	48 89 e5             	mov    %rsp,%rbp
+  805422:	41 55                	push   %r13
+  805424:	41 54                	push   %r12
+  805426:	53                   	push   %rbx
+  805427:	48 83 ec 08          	sub    $0x8,%rsp
+  80542b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80542e:	48 bb b7 28 80 00 00 	movabs $0x8028b7,%rbx
+  805435:	00 00 00 
+  805438:	49 bc cb 29 80 00 00 	movabs $0x8029cb,%r12
+  80543f:	00 00 00 
+  805442:	eb 03                	jmp    805447 <devcons_read+0x36>
+  805444:	41 ff d4             	call   *%r12
+  805447:	ff d3                	call   *%rbx
+  805449:	85 c0                	test   %eax,%eax
+  80544b:	74 f7                	je     805444 <devcons_read+0x33>
+    if (c < 0) return c;
+  80544d:	48 63 d0             	movslq %eax,%rdx
+  805450:	78 13                	js     805465 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805452:	ba 00 00 00 00       	mov    $0x0,%edx
+  805457:	83 f8 04             	cmp    $0x4,%eax
+  80545a:	74 09                	je     805465 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80545c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805460:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805465:	48 89 d0             	mov    %rdx,%rax
+  805468:	48 83 c4 08          	add    $0x8,%rsp
+  80546c:	5b                   	pop    %rbx
+  80546d:	41 5c                	pop    %r12
+  80546f:	41 5d                	pop    %r13
+  805471:	5d                   	pop    %rbp
+  805472:	c3                   	ret
+  805473:	48 89 d0             	mov    %rdx,%rax
+  805476:	c3                   	ret
+
+0000000000805477 <cputchar>:
+cputchar(int ch) {
+  805477:	55                   	push   %rbp
+  805478:	48 89 e5             	mov    %rsp,%rbp
+  80547b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80547f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805483:	be 01 00 00 00       	mov    $0x1,%esi
+  805488:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80548c:	48 b8 84 28 80 00 00 	movabs $0x802884,%rax
+  805493:	00 00 00 
+  805496:	ff d0                	call   *%rax
+}
+  805498:	c9                   	leave
+  805499:	c3                   	ret
+
+000000000080549a <getchar>:
+getchar(void) {
+  80549a:	55                   	push   %rbp
+  80549b:	48 89 e5             	mov    %rsp,%rbp
+  80549e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8054a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054a7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8054ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054b0:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  8054b7:	00 00 00 
+  8054ba:	ff d0                	call   *%rax
+  8054bc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8054be:	85 c0                	test   %eax,%eax
+  8054c0:	78 06                	js     8054c8 <getchar+0x2e>
+  8054c2:	74 08                	je     8054cc <getchar+0x32>
+  8054c4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8054c8:	89 d0                	mov    %edx,%eax
+  8054ca:	c9                   	leave
+  8054cb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8054cc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8054d1:	eb f5                	jmp    8054c8 <getchar+0x2e>
+
+00000000008054d3 <iscons>:
+iscons(int fdnum) {
+  8054d3:	55                   	push   %rbp
+  8054d4:	48 89 e5             	mov    %rsp,%rbp
+  8054d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8054db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8054df:	48 b8 0a 33 80 00 00 	movabs $0x80330a,%rax
+  8054e6:	00 00 00 
+  8054e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8054eb:	85 c0                	test   %eax,%eax
+  8054ed:	78 18                	js     805507 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8054ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054f3:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8054fa:	00 00 00 
+  8054fd:	8b 00                	mov    (%rax),%eax
+  8054ff:	39 02                	cmp    %eax,(%rdx)
+  805501:	0f 94 c0             	sete   %al
+  805504:	0f b6 c0             	movzbl %al,%eax
+}
+  805507:	c9                   	leave
+  805508:	c3                   	ret
+
+0000000000805509 <opencons>:
+opencons(void) {
+  805509:	55                   	push   %rbp
+  80550a:	48 89 e5             	mov    %rsp,%rbp
+  80550d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805511:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805515:	48 b8 aa 32 80 00 00 	movabs $0x8032aa,%rax
+  80551c:	00 00 00 
+  80551f:	ff d0                	call   *%rax
+  805521:	85 c0                	test   %eax,%eax
+  805523:	78 49                	js     80556e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805525:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80552a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80552f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805533:	bf 00 00 00 00       	mov    $0x0,%edi
+  805538:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  80553f:	00 00 00 
+  805542:	ff d0                	call   *%rax
+  805544:	85 c0                	test   %eax,%eax
+  805546:	78 26                	js     80556e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805548:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80554c:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  805553:	00 00 
+  805555:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805557:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80555b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805562:	48 b8 7c 32 80 00 00 	movabs $0x80327c,%rax
+  805569:	00 00 00 
+  80556c:	ff d0                	call   *%rax
+}
+  80556e:	c9                   	leave
+  80556f:	c3                   	ret
+
+0000000000805570 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805570:	55                   	push   %rbp
+  805571:	48 89 e5             	mov    %rsp,%rbp
+  805574:	41 56                	push   %r14
+  805576:	41 55                	push   %r13
+  805578:	41 54                	push   %r12
+  80557a:	53                   	push   %rbx
+  80557b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80557e:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805585:	00 00 00 
+  805588:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80558c:	74 27                	je     8055b5 <_handle_vectored_pagefault+0x45>
+  80558e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805593:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  80559a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80559d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8055a0:	4c 89 e7             	mov    %r12,%rdi
+  8055a3:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8055a8:	84 c0                	test   %al,%al
+  8055aa:	75 45                	jne    8055f1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8055ac:	48 83 c3 01          	add    $0x1,%rbx
+  8055b0:	49 3b 1e             	cmp    (%r14),%rbx
+  8055b3:	72 eb                	jb     8055a0 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8055b5:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8055bc:	00 
+  8055bd:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8055c2:	4d 8b 04 24          	mov    (%r12),%r8
+  8055c6:	48 ba b8 68 80 00 00 	movabs $0x8068b8,%rdx
+  8055cd:	00 00 00 
+  8055d0:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8055d5:	48 bf e8 68 80 00 00 	movabs $0x8068e8,%rdi
+  8055dc:	00 00 00 
+  8055df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055e4:	49 ba 80 18 80 00 00 	movabs $0x801880,%r10
+  8055eb:	00 00 00 
+  8055ee:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8055f1:	5b                   	pop    %rbx
+  8055f2:	41 5c                	pop    %r12
+  8055f4:	41 5d                	pop    %r13
+  8055f6:	41 5e                	pop    %r14
+  8055f8:	5d                   	pop    %rbp
+  8055f9:	c3                   	ret
+
+00000000008055fa <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8055fa:	55                   	push   %rbp
+  8055fb:	48 89 e5             	mov    %rsp,%rbp
+  8055fe:	53                   	push   %rbx
+  8055ff:	48 83 ec 08          	sub    $0x8,%rsp
+  805603:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805606:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  80560b:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805612:	00 00 00 
+  805615:	80 38 00             	cmpb   $0x0,(%rax)
+  805618:	74 68                	je     805682 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80561a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805621:	00 00 00 
+  805624:	48 8b 08             	mov    (%rax),%rcx
+  805627:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80562c:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805633:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805636:	48 85 c9             	test   %rcx,%rcx
+  805639:	0f 84 e0 00 00 00    	je     80571f <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80563f:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805643:	0f 84 c9 00 00 00    	je     805712 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805649:	48 83 c2 01          	add    $0x1,%rdx
+  80564d:	48 39 ca             	cmp    %rcx,%rdx
+  805650:	75 ed                	jne    80563f <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805652:	48 83 f9 08          	cmp    $0x8,%rcx
+  805656:	0f 84 84 00 00 00    	je     8056e0 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80565c:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805660:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805667:	00 00 00 
+  80566a:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805671:	00 00 00 
+  805674:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805678:	85 f6                	test   %esi,%esi
+  80567a:	0f 89 97 00 00 00    	jns    805717 <add_pgfault_handler+0x11d>
+  805680:	eb 63                	jmp    8056e5 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805682:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805687:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80568c:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805693:	00 00 00 
+  805696:	bf 00 00 00 00       	mov    $0x0,%edi
+  80569b:	48 b8 6c 2a 80 00 00 	movabs $0x802a6c,%rax
+  8056a2:	00 00 00 
+  8056a5:	ff d0                	call   *%rax
+  8056a7:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8056a9:	85 c0                	test   %eax,%eax
+  8056ab:	78 38                	js     8056e5 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8056ad:	48 be fb 57 80 00 00 	movabs $0x8057fb,%rsi
+  8056b4:	00 00 00 
+  8056b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056bc:	48 b8 8f 2c 80 00 00 	movabs $0x802c8f,%rax
+  8056c3:	00 00 00 
+  8056c6:	ff d0                	call   *%rax
+  8056c8:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8056ca:	85 c0                	test   %eax,%eax
+  8056cc:	78 17                	js     8056e5 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8056ce:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8056d5:	00 00 00 
+  8056d8:	c6 00 01             	movb   $0x1,(%rax)
+  8056db:	e9 3a ff ff ff       	jmp    80561a <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8056e0:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8056e5:	89 f1                	mov    %esi,%ecx
+  8056e7:	48 ba f6 68 80 00 00 	movabs $0x8068f6,%rdx
+  8056ee:	00 00 00 
+  8056f1:	be 42 00 00 00       	mov    $0x42,%esi
+  8056f6:	48 bf e8 68 80 00 00 	movabs $0x8068e8,%rdi
+  8056fd:	00 00 00 
+  805700:	b8 00 00 00 00       	mov    $0x0,%eax
+  805705:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  80570c:	00 00 00 
+  80570f:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805712:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805717:	89 f0                	mov    %esi,%eax
+  805719:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80571d:	c9                   	leave
+  80571e:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80571f:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805726:	00 00 00 
+  805729:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  805730:	48 89 d8             	mov    %rbx,%rax
+  805733:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  80573a:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80573d:	eb d8                	jmp    805717 <add_pgfault_handler+0x11d>
+
+000000000080573f <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80573f:	55                   	push   %rbp
+  805740:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805743:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80574a:	00 00 00 
+  80574d:	80 38 00             	cmpb   $0x0,(%rax)
+  805750:	74 33                	je     805785 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805752:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805759:	00 00 00 
+  80575c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805761:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805768:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80576b:	48 85 c0             	test   %rax,%rax
+  80576e:	0f 84 85 00 00 00    	je     8057f9 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805774:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805778:	74 40                	je     8057ba <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80577a:	48 83 c1 01          	add    $0x1,%rcx
+  80577e:	48 39 c1             	cmp    %rax,%rcx
+  805781:	75 f1                	jne    805774 <remove_pgfault_handler+0x35>
+  805783:	eb 74                	jmp    8057f9 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805785:	48 b9 0e 69 80 00 00 	movabs $0x80690e,%rcx
+  80578c:	00 00 00 
+  80578f:	48 ba f6 67 80 00 00 	movabs $0x8067f6,%rdx
+  805796:	00 00 00 
+  805799:	be 48 00 00 00       	mov    $0x48,%esi
+  80579e:	48 bf e8 68 80 00 00 	movabs $0x8068e8,%rdi
+  8057a5:	00 00 00 
+  8057a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057ad:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  8057b4:	00 00 00 
+  8057b7:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8057ba:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8057c1:	00 
+  8057c2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8057c6:	48 29 ca             	sub    %rcx,%rdx
+  8057c9:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8057d0:	00 00 00 
+  8057d3:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8057d7:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8057dc:	48 89 ce             	mov    %rcx,%rsi
+  8057df:	48 b8 57 26 80 00 00 	movabs $0x802657,%rax
+  8057e6:	00 00 00 
+  8057e9:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8057eb:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8057f2:	00 00 00 
+  8057f5:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8057f9:	5d                   	pop    %rbp
+  8057fa:	c3                   	ret
+
+00000000008057fb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8057fb:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8057fe:	48 b8 70 55 80 00 00 	movabs $0x805570,%rax
+  805805:	00 00 00 
+    call *%rax
+  805808:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80580a:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805811:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805812:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805819:	00 
+    subq $8, %rcx
+  80581a:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80581e:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805821:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805828:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805829:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80582d:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805831:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805836:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80583b:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  805840:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805845:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80584a:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80584f:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805854:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805859:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80585e:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  805863:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805868:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  80586d:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  805872:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805877:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  80587b:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80587f:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  805880:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  805881:	c3                   	ret
+
+0000000000805882 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  805882:	85 ff                	test   %edi,%edi
+  805884:	78 58                	js     8058de <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805886:	48 85 f6             	test   %rsi,%rsi
+  805889:	74 12                	je     80589d <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  80588b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805892:	00 00 00 
+  805895:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  80589b:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  80589d:	48 85 c9             	test   %rcx,%rcx
+  8058a0:	74 12                	je     8058b4 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8058a2:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8058a9:	00 00 00 
+  8058ac:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8058b2:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8058b4:	48 85 d2             	test   %rdx,%rdx
+  8058b7:	74 14                	je     8058cd <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8058b9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8058c0:	00 00 00 
+  8058c3:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8058ca:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8058cd:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8058d4:	00 00 00 
+  8058d7:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8058dd:	c3                   	ret
+        if (from_env_store) {
+  8058de:	48 85 f6             	test   %rsi,%rsi
+  8058e1:	74 06                	je     8058e9 <ipc_result+0x67>
+            *from_env_store = 0;
+  8058e3:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8058e9:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8058eb:	48 85 c9             	test   %rcx,%rcx
+  8058ee:	74 ed                	je     8058dd <ipc_result+0x5b>
+            *perm_store = 0;
+  8058f0:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  8058f6:	c3                   	ret
+
+00000000008058f7 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8058f7:	55                   	push   %rbp
+  8058f8:	48 89 e5             	mov    %rsp,%rbp
+  8058fb:	41 55                	push   %r13
+  8058fd:	41 54                	push   %r12
+  8058ff:	53                   	push   %rbx
+  805900:	48 83 ec 08          	sub    $0x8,%rsp
+  805904:	49 89 fc             	mov    %rdi,%r12
+  805907:	48 89 f7             	mov    %rsi,%rdi
+  80590a:	48 89 d3             	mov    %rdx,%rbx
+  80590d:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805910:	48 85 f6             	test   %rsi,%rsi
+  805913:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80591a:	00 00 00 
+  80591d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805921:	be 00 00 00 00       	mov    $0x0,%esi
+  805926:	48 85 d2             	test   %rdx,%rdx
+  805929:	74 03                	je     80592e <ipc_recv+0x37>
+  80592b:	48 8b 32             	mov    (%rdx),%rsi
+  80592e:	48 b8 b8 2f 80 00 00 	movabs $0x802fb8,%rax
+  805935:	00 00 00 
+  805938:	ff d0                	call   *%rax
+  80593a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80593c:	4c 89 e9             	mov    %r13,%rcx
+  80593f:	48 89 da             	mov    %rbx,%rdx
+  805942:	4c 89 e6             	mov    %r12,%rsi
+  805945:	48 b8 82 58 80 00 00 	movabs $0x805882,%rax
+  80594c:	00 00 00 
+  80594f:	ff d0                	call   *%rax
+}
+  805951:	48 83 c4 08          	add    $0x8,%rsp
+  805955:	5b                   	pop    %rbx
+  805956:	41 5c                	pop    %r12
+  805958:	41 5d                	pop    %r13
+  80595a:	5d                   	pop    %rbp
+  80595b:	c3                   	ret
+
+000000000080595c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80595c:	55                   	push   %rbp
+  80595d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805960:	48 85 d2             	test   %rdx,%rdx
+  805963:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80596a:	00 00 00 
+  80596d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805971:	89 f6                	mov    %esi,%esi
+  805973:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  80597a:	00 00 00 
+  80597d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80597f:	85 c0                	test   %eax,%eax
+  805981:	78 02                	js     805985 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  805983:	5d                   	pop    %rbp
+  805984:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805985:	89 c1                	mov    %eax,%ecx
+  805987:	48 ba 28 69 80 00 00 	movabs $0x806928,%rdx
+  80598e:	00 00 00 
+  805991:	be 4f 00 00 00       	mov    $0x4f,%esi
+  805996:	48 bf 35 69 80 00 00 	movabs $0x806935,%rdi
+  80599d:	00 00 00 
+  8059a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059a5:	49 b8 80 18 80 00 00 	movabs $0x801880,%r8
+  8059ac:	00 00 00 
+  8059af:	41 ff d0             	call   *%r8
+
+00000000008059b2 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8059b2:	55                   	push   %rbp
+  8059b3:	48 89 e5             	mov    %rsp,%rbp
+  8059b6:	53                   	push   %rbx
+  8059b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8059bb:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8059bf:	48 85 d2             	test   %rdx,%rdx
+  8059c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8059c9:	00 00 00 
+  8059cc:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8059d0:	4d 85 c9             	test   %r9,%r9
+  8059d3:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8059d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059dc:	48 85 db             	test   %rbx,%rbx
+  8059df:	74 03                	je     8059e4 <ipc_call+0x32>
+  8059e1:	48 8b 03             	mov    (%rbx),%rax
+  8059e4:	89 f6                	mov    %esi,%esi
+  8059e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8059ea:	50                   	push   %rax
+  8059eb:	48 b8 76 2e 80 00 00 	movabs $0x802e76,%rax
+  8059f2:	00 00 00 
+  8059f5:	ff d0                	call   *%rax
+  8059f7:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  8059f9:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  8059fd:	48 89 da             	mov    %rbx,%rdx
+  805a00:	be 00 00 00 00       	mov    $0x0,%esi
+  805a05:	48 b8 82 58 80 00 00 	movabs $0x805882,%rax
+  805a0c:	00 00 00 
+  805a0f:	ff d0                	call   *%rax
+}
+  805a11:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805a15:	c9                   	leave
+  805a16:	c3                   	ret
+
+0000000000805a17 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805a17:	55                   	push   %rbp
+  805a18:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805a1b:	89 f6                	mov    %esi,%esi
+  805a1d:	48 b8 e2 2e 80 00 00 	movabs $0x802ee2,%rax
+  805a24:	00 00 00 
+  805a27:	ff d0                	call   *%rax
+  805a29:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805a2b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805a30:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a35:	be 00 00 00 00       	mov    $0x0,%esi
+  805a3a:	48 b8 82 58 80 00 00 	movabs $0x805882,%rax
+  805a41:	00 00 00 
+  805a44:	ff d0                	call   *%rax
+}
+  805a46:	5d                   	pop    %rbp
+  805a47:	c3                   	ret
+
+0000000000805a48 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805a48:	55                   	push   %rbp
+  805a49:	48 89 e5             	mov    %rsp,%rbp
+  805a4c:	41 54                	push   %r12
+  805a4e:	53                   	push   %rbx
+  805a4f:	4c 89 cb             	mov    %r9,%rbx
+  805a52:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805a56:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805a5a:	48 85 d2             	test   %rdx,%rdx
+  805a5d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a64:	00 00 00 
+  805a67:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805a6b:	4d 85 c9             	test   %r9,%r9
+  805a6e:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a77:	4d 85 e4             	test   %r12,%r12
+  805a7a:	74 04                	je     805a80 <ipc_reply_wait+0x38>
+  805a7c:	49 8b 04 24          	mov    (%r12),%rax
+  805a80:	89 f6                	mov    %esi,%esi
+  805a82:	48 83 ec 08          	sub    $0x8,%rsp
+  805a86:	50                   	push   %rax
+  805a87:	48 b8 4c 2f 80 00 00 	movabs $0x802f4c,%rax
+  805a8e:	00 00 00 
+  805a91:	ff d0                	call   *%rax
+  805a93:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  805a95:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  805a99:	4c 89 e2             	mov    %r12,%rdx
+  805a9c:	48 89 de             	mov    %rbx,%rsi
+  805a9f:	48 b8 82 58 80 00 00 	movabs $0x805882,%rax
+  805aa6:	00 00 00 
+  805aa9:	ff d0                	call   *%rax
+}
+  805aab:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  805aaf:	5b                   	pop    %rbx
+  805ab0:	41 5c                	pop    %r12
+  805ab2:	5d                   	pop    %rbp
+  805ab3:	c3                   	ret
+
+0000000000805ab4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805ab9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805ac0:	00 00 00 
+  805ac3:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805aca:	48 01 ca             	add    %rcx,%rdx
+  805acd:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805ad3:	39 fa                	cmp    %edi,%edx
+  805ad5:	74 12                	je     805ae9 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805ad7:	48 83 c0 01          	add    $0x1,%rax
+  805adb:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805ae1:	75 e0                	jne    805ac3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ae8:	c3                   	ret
+            return envs[i].env_id;
+  805ae9:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  805af0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805af7:	00 00 00 
+  805afa:	48 01 d0             	add    %rdx,%rax
+  805afd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805b03:	c3                   	ret
+  805b04:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000805b08 <__rodata_start>:
+  805b08:	77 00                	ja     805b0a <__rodata_start+0x2>
+  805b0a:	72 62                	jb     805b6e <__rodata_start+0x66>
+  805b0c:	00 77 62             	add    %dh,0x62(%rdi)
+  805b0f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805b12:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805b19:	00 
+  805b1a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805b20:	b3 09                	mov    $0x9,%bl
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 ed                	add    %ch,%ch
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 ed                	add    %ch,%ch
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	8c 0a                	mov    %cs,(%rdx)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	8c 0a                	mov    %cs,(%rdx)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	8c 0a                	mov    %cs,(%rdx)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	8c 0a                	mov    %cs,(%rdx)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	8c 0a                	mov    %cs,(%rdx)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	ed                   	in     (%dx),%eax
+  805bd1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bd6:	00 00                	add    %al,(%rax)
+  805bd8:	ed                   	in     (%dx),%eax
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	ed                   	in     (%dx),%eax
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	ed                   	in     (%dx),%eax
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	ed                   	in     (%dx),%eax
+  805c11:	0d 80 00 00 00       	or     $0x80,%eax
+  805c16:	00 00                	add    %al,(%rax)
+  805c18:	ed                   	in     (%dx),%eax
+  805c19:	0d 80 00 00 00       	or     $0x80,%eax
+  805c1e:	00 00                	add    %al,(%rax)
+  805c20:	ed                   	in     (%dx),%eax
+  805c21:	0d 80 00 00 00       	or     $0x80,%eax
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	ed                   	in     (%dx),%eax
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	ed                   	in     (%dx),%eax
+  805c39:	0d 80 00 00 00       	or     $0x80,%eax
+  805c3e:	00 00                	add    %al,(%rax)
+  805c40:	ed                   	in     (%dx),%eax
+  805c41:	0d 80 00 00 00       	or     $0x80,%eax
+  805c46:	00 00                	add    %al,(%rax)
+  805c48:	ed                   	in     (%dx),%eax
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	ed                   	in     (%dx),%eax
+  805c59:	0d 80 00 00 00       	or     $0x80,%eax
+  805c5e:	00 00                	add    %al,(%rax)
+  805c60:	ed                   	in     (%dx),%eax
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	ed                   	in     (%dx),%eax
+  805c69:	0d 80 00 00 00       	or     $0x80,%eax
+  805c6e:	00 00                	add    %al,(%rax)
+  805c70:	ed                   	in     (%dx),%eax
+  805c71:	0d 80 00 00 00       	or     $0x80,%eax
+  805c76:	00 00                	add    %al,(%rax)
+  805c78:	ed                   	in     (%dx),%eax
+  805c79:	0d 80 00 00 00       	or     $0x80,%eax
+  805c7e:	00 00                	add    %al,(%rax)
+  805c80:	ed                   	in     (%dx),%eax
+  805c81:	0d 80 00 00 00       	or     $0x80,%eax
+  805c86:	00 00                	add    %al,(%rax)
+  805c88:	ed                   	in     (%dx),%eax
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	ed                   	in     (%dx),%eax
+  805c91:	0d 80 00 00 00       	or     $0x80,%eax
+  805c96:	00 00                	add    %al,(%rax)
+  805c98:	ed                   	in     (%dx),%eax
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ed                   	in     (%dx),%eax
+  805ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ca6:	00 00                	add    %al,(%rax)
+  805ca8:	ed                   	in     (%dx),%eax
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	f4                   	hlt
+  805cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805cbf:	00 ed                	add    %ch,%ch
+  805cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cc6:	00 00                	add    %al,(%rax)
+  805cc8:	ed                   	in     (%dx),%eax
+  805cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cce:	00 00                	add    %al,(%rax)
+  805cd0:	2c 0b                	sub    $0xb,%al
+  805cd2:	80 00 00             	addb   $0x0,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 ed                	add    %ch,%ch
+  805cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cde:	00 00                	add    %al,(%rax)
+  805ce0:	ed                   	in     (%dx),%eax
+  805ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ce6:	00 00                	add    %al,(%rax)
+  805ce8:	ed                   	in     (%dx),%eax
+  805ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cee:	00 00                	add    %al,(%rax)
+  805cf0:	ed                   	in     (%dx),%eax
+  805cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cf6:	00 00                	add    %al,(%rax)
+  805cf8:	ed                   	in     (%dx),%eax
+  805cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cfe:	00 00                	add    %al,(%rax)
+  805d00:	ed                   	in     (%dx),%eax
+  805d01:	0d 80 00 00 00       	or     $0x80,%eax
+  805d06:	00 00                	add    %al,(%rax)
+  805d08:	ed                   	in     (%dx),%eax
+  805d09:	0d 80 00 00 00       	or     $0x80,%eax
+  805d0e:	00 00                	add    %al,(%rax)
+  805d10:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805d13:	00 00                	add    %al,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 cb                	add    %cl,%bl
+  805d19:	0d 80 00 00 00       	or     $0x80,%eax
+  805d1e:	00 00                	add    %al,(%rax)
+  805d20:	ed                   	in     (%dx),%eax
+  805d21:	0d 80 00 00 00       	or     $0x80,%eax
+  805d26:	00 00                	add    %al,(%rax)
+  805d28:	ed                   	in     (%dx),%eax
+  805d29:	0d 80 00 00 00       	or     $0x80,%eax
+  805d2e:	00 00                	add    %al,(%rax)
+  805d30:	ed                   	in     (%dx),%eax
+  805d31:	0d 80 00 00 00       	or     $0x80,%eax
+  805d36:	00 00                	add    %al,(%rax)
+  805d38:	6a 0a                	push   $0xa
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 ed                	add    %ch,%ch
+  805d49:	0d 80 00 00 00       	or     $0x80,%eax
+  805d4e:	00 00                	add    %al,(%rax)
+  805d50:	ed                   	in     (%dx),%eax
+  805d51:	0d 80 00 00 00       	or     $0x80,%eax
+  805d56:	00 00                	add    %al,(%rax)
+  805d58:	3c 0a                	cmp    $0xa,%al
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 ed                	add    %ch,%ch
+  805d61:	0d 80 00 00 00       	or     $0x80,%eax
+  805d66:	00 00                	add    %al,(%rax)
+  805d68:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805d6b:	00 00                	add    %al,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 29                	add    %ch,(%rcx)
+  805d79:	0c 80                	or     $0x80,%al
+  805d7b:	00 00                	add    %al,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805d82:	80 00 00             	addb   $0x0,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 ed                	add    %ch,%ch
+  805d89:	0d 80 00 00 00       	or     $0x80,%eax
+  805d8e:	00 00                	add    %al,(%rax)
+  805d90:	1a 0b                	sbb    (%rbx),%cl
+  805d92:	80 00 00             	addb   $0x0,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 ed                	add    %ch,%ch
+  805d99:	0d 80 00 00 00       	or     $0x80,%eax
+  805d9e:	00 00                	add    %al,(%rax)
+  805da0:	ce                   	(bad)
+  805da1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805da7:	00 ed                	add    %ch,%ch
+  805da9:	0d 80 00 00 00       	or     $0x80,%eax
+  805dae:	00 00                	add    %al,(%rax)
+  805db0:	ed                   	in     (%dx),%eax
+  805db1:	0d 80 00 00 00       	or     $0x80,%eax
+  805db6:	00 00                	add    %al,(%rax)
+  805db8:	f4                   	hlt
+  805db9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805dbf:	00 37                	add    %dh,(%rdi)
+  805dc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 37                	add    %dh,(%rdi)
+  805dd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805deb:	00 00                	add    %al,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 d2                	add    %dl,%dl
+  805df1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805df7:	00 d2                	add    %dl,%dl
+  805df9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dff:	00 d2                	add    %dl,%dl
+  805e01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e07:	00 d2                	add    %dl,%dl
+  805e09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e0f:	00 d2                	add    %dl,%dl
+  805e11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e17:	00 d2                	add    %dl,%dl
+  805e19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e1f:	00 d2                	add    %dl,%dl
+  805e21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e27:	00 f6                	add    %dh,%dh
+  805e29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e2f:	00 f6                	add    %dh,%dh
+  805e31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 22                	add    %ah,(%rdx)
+  805e71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e77:	00 22                	add    %ah,(%rdx)
+  805e79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e7f:	00 22                	add    %ah,(%rdx)
+  805e81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e87:	00 22                	add    %ah,(%rdx)
+  805e89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e8f:	00 22                	add    %ah,(%rdx)
+  805e91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e97:	00 22                	add    %ah,(%rdx)
+  805e99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ef2:	80 00 00             	addb   $0x0,(%rax)
+  805ef5:	00 00                	add    %al,(%rax)
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f12:	80 00 00             	addb   $0x0,(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f1a:	80 00 00             	addb   $0x0,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 46 12             	add    %al,0x12(%rsi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f32:	80 00 00             	addb   $0x0,(%rax)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f3a:	80 00 00             	addb   $0x0,(%rax)
+  805f3d:	00 00                	add    %al,(%rax)
+  805f3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f42:	80 00 00             	addb   $0x0,(%rax)
+  805f45:	00 00                	add    %al,(%rax)
+  805f47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f4a:	80 00 00             	addb   $0x0,(%rax)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f52:	80 00 00             	addb   $0x0,(%rax)
+  805f55:	00 00                	add    %al,(%rax)
+  805f57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f5a:	80 00 00             	addb   $0x0,(%rax)
+  805f5d:	00 00                	add    %al,(%rax)
+  805f5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f62:	80 00 00             	addb   $0x0,(%rax)
+  805f65:	00 00                	add    %al,(%rax)
+  805f67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f6a:	80 00 00             	addb   $0x0,(%rax)
+  805f6d:	00 00                	add    %al,(%rax)
+  805f6f:	00 22                	add    %ah,(%rdx)
+  805f71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f77:	00 22                	add    %ah,(%rdx)
+  805f79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f7f:	00 22                	add    %ah,(%rdx)
+  805f81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f87:	00 22                	add    %ah,(%rdx)
+  805f89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f8f:	00 22                	add    %ah,(%rdx)
+  805f91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f97:	00 22                	add    %ah,(%rdx)
+  805f99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805f9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fa2:	80 00 00             	addb   $0x0,(%rax)
+  805fa5:	00 00                	add    %al,(%rax)
+  805fa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805faa:	80 00 00             	addb   $0x0,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fb2:	80 00 00             	addb   $0x0,(%rax)
+  805fb5:	00 00                	add    %al,(%rax)
+  805fb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fba:	80 00 00             	addb   $0x0,(%rax)
+  805fbd:	00 00                	add    %al,(%rax)
+  805fbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fc2:	80 00 00             	addb   $0x0,(%rax)
+  805fc5:	00 00                	add    %al,(%rax)
+  805fc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fca:	80 00 00             	addb   $0x0,(%rax)
+  805fcd:	00 00                	add    %al,(%rax)
+  805fcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fd2:	80 00 00             	addb   $0x0,(%rax)
+  805fd5:	00 00                	add    %al,(%rax)
+  805fd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fda:	80 00 00             	addb   $0x0,(%rax)
+  805fdd:	00 00                	add    %al,(%rax)
+  805fdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fe2:	80 00 00             	addb   $0x0,(%rax)
+  805fe5:	00 00                	add    %al,(%rax)
+  805fe7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805fea:	80 00 00             	addb   $0x0,(%rax)
+  805fed:	00 00                	add    %al,(%rax)
+  805fef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ff2:	80 00 00             	addb   $0x0,(%rax)
+  805ff5:	00 00                	add    %al,(%rax)
+  805ff7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ffa:	80 00 00             	addb   $0x0,(%rax)
+  805ffd:	00 00                	add    %al,(%rax)
+  805fff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806002:	80 00 00             	addb   $0x0,(%rax)
+  806005:	00 00                	add    %al,(%rax)
+  806007:	00 5f 12             	add    %bl,0x12(%rdi)
+  80600a:	80 00 00             	addb   $0x0,(%rax)
+  80600d:	00 00                	add    %al,(%rax)
+  80600f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806012:	80 00 00             	addb   $0x0,(%rax)
+  806015:	00 00                	add    %al,(%rax)
+  806017:	00 5f 12             	add    %bl,0x12(%rdi)
+  80601a:	80 00 00             	addb   $0x0,(%rax)
+  80601d:	00 00                	add    %al,(%rax)
+  80601f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806022:	80 00 00             	addb   $0x0,(%rax)
+  806025:	00 00                	add    %al,(%rax)
+  806027:	00 46 12             	add    %al,0x12(%rsi)
+  80602a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806040 <basefix.0>:
+  806040:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806050:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806060:	10 00 66 0f 1f 44 00 00 74 65 73 74 69 6e 67 20     ..f..D..testing 
+  806070:	66 6f 72 20 70 69 70 65 69 73 63 6c 6f 73 65 64     for pipeisclosed
+  806080:	20 72 61 63 65 2e 2e 2e 0a 00 00 00 00 00 00 00      race...........
+  806090:	73 6f 6d 65 68 6f 77 20 74 68 65 20 6f 74 68 65     somehow the othe
+  8060a0:	72 20 65 6e 64 20 6f 66 20 70 5b 30 5d 20 67 6f     r end of p[0] go
+  8060b0:	74 20 63 6c 6f 73 65 64 21 00 70 69 70 65 3a 20     t closed!.pipe: 
+  8060c0:	25 69 00 75 73 65 72 2f 74 65 73 74 70 69 70 65     %i.user/testpipe
+  8060d0:	72 61 63 65 32 2e 63 00 25 64 2e 00 0a 52 41 43     race2.c.%d...RAC
+  8060e0:	45 3a 20 70 69 70 65 20 61 70 70 65 61 72 73 20     E: pipe appears 
+  8060f0:	63 6c 6f 73 65 64 0a 00 63 68 69 6c 64 20 64 6f     closed..child do
+  806100:	6e 65 20 77 69 74 68 20 6c 6f 6f 70 0a 00 63 61     ne with loop..ca
+  806110:	6e 6e 6f 74 20 6c 6f 6f 6b 20 75 70 20 70 5b 30     nnot look up p[0
+  806120:	5d 3a 20 25 69 00 72 61 63 65 20 64 69 64 6e 27     ]: %i.race didn'
+  806130:	74 20 68 61 70 70 65 6e 0a 00 3c 75 6e 6b 6e 6f     t happen..<unkno
+  806140:	77 6e 3e 00 0f 1f 40 00 5b 25 30 38 78 5d 20 75     wn>...@.[%08x] u
+  806150:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806160:	61 74 20 25 73 3a 25 64 3a 20 00 30 31 32 33 34     at %s:%d: .01234
+  806170:	35 36 37 38 39 41 42 43 44 45 46 00 30 31 32 33     56789ABCDEF.0123
+  806180:	34 35 36 37 38 39 61 62 63 64 65 66 00 28 6e 75     456789abcdef.(nu
+  806190:	6c 6c 29 00 65 72 72 6f 72 20 25 64 00 75 6e 73     ll).error %d.uns
+  8061a0:	70 65 63 69 66 69 65 64 20 65 72 72 6f 72 00 62     pecified error.b
+  8061b0:	61 64 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69     ad environment.i
+  8061c0:	6e 76 61 6c 69 64 20 70 61 72 61 6d 65 74 65 72     nvalid parameter
+  8061d0:	00 6f 75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f     .out of memory.o
+  8061e0:	75 74 20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e     ut of environmen
+  8061f0:	74 73 00 63 6f 72 72 75 70 74 65 64 20 64 65 62     ts.corrupted deb
+  806200:	75 67 20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61     ug info.segmenta
+  806210:	74 69 6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c     tion fault.inval
+  806220:	69 64 20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20     id ELF image.no 
+  806230:	73 75 63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c     such system call
+  806240:	00 65 6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64     .entry not found
+  806250:	00 65 6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76     .env is not recv
+  806260:	69 6e 67 00 75 6e 65 78 70 65 63 74 65 64 20 65     ing.unexpected e
+  806270:	6e 64 20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72     nd of file.no fr
+  806280:	65 65 20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b     ee space on disk
+  806290:	00 74 6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20     .too many files 
+  8062a0:	61 72 65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72     are open.file or
+  8062b0:	20 62 6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64      block not found
+  8062c0:	00 69 6e 76 61 6c 69 64 20 70 61 74 68 00 66 69     .invalid path.fi
+  8062d0:	6c 65 20 61 6c 72 65 61 64 79 20 65 78 69 73 74     le already exist
+  8062e0:	73 00 6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20     s.operation not 
+  8062f0:	73 75 70 70 6f 72 74 65 64 00 66 0f 1f 44 00 00     supported.f..D..
+  806300:	c8 1b 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ........."......
+  806310:	0f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806320:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806330:	1f 22 80 00 00 00 00 00 e7 1b 80 00 00 00 00 00     ."..............
+  806340:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806350:	db 1b 80 00 00 00 00 00 55 1c 80 00 00 00 00 00     ........U.......
+  806360:	1f 22 80 00 00 00 00 00 db 1b 80 00 00 00 00 00     ."..............
+  806370:	21 1c 80 00 00 00 00 00 21 1c 80 00 00 00 00 00     !.......!.......
+  806380:	21 1c 80 00 00 00 00 00 21 1c 80 00 00 00 00 00     !.......!.......
+  806390:	21 1c 80 00 00 00 00 00 21 1c 80 00 00 00 00 00     !.......!.......
+  8063a0:	21 1c 80 00 00 00 00 00 21 1c 80 00 00 00 00 00     !.......!.......
+  8063b0:	21 1c 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     !........"......
+  8063c0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8063d0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8063e0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8063f0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806400:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806410:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806420:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806430:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806440:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806450:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806460:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806470:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806480:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806490:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8064a0:	1f 22 80 00 00 00 00 00 3d 21 80 00 00 00 00 00     ."......=!......
+  8064b0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8064c0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8064d0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8064e0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  8064f0:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806500:	83 1c 80 00 00 00 00 00 52 1e 80 00 00 00 00 00     ........R.......
+  806510:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806520:	1f 22 80 00 00 00 00 00 78 1c 80 00 00 00 00 00     ."......x.......
+  806530:	b2 1c 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ........."......
+  806540:	1f 22 80 00 00 00 00 00 6d 1c 80 00 00 00 00 00     ."......m.......
+  806550:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806560:	fb 1f 80 00 00 00 00 00 ca 20 80 00 00 00 00 00     ......... ......
+  806570:	1f 22 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     ."......."......
+  806580:	49 1d 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     I........"......
+  806590:	26 1f 80 00 00 00 00 00 1f 22 80 00 00 00 00 00     &........"......
+  8065a0:	1f 22 80 00 00 00 00 00 3d 21 80 00 00 00 00 00     ."......=!......
+  8065b0:	1f 22 80 00 00 00 00 00 d1 1b 80 00 00 00 00 00     ."..............
+
+00000000008065c0 <error_string>:
+	...
+  8065c8:	9d 61 80 00 00 00 00 00 af 61 80 00 00 00 00 00     .a.......a......
+  8065d8:	bf 61 80 00 00 00 00 00 d1 61 80 00 00 00 00 00     .a.......a......
+  8065e8:	df 61 80 00 00 00 00 00 f3 61 80 00 00 00 00 00     .a.......a......
+  8065f8:	08 62 80 00 00 00 00 00 1b 62 80 00 00 00 00 00     .b.......b......
+  806608:	2d 62 80 00 00 00 00 00 41 62 80 00 00 00 00 00     -b......Ab......
+  806618:	51 62 80 00 00 00 00 00 64 62 80 00 00 00 00 00     Qb......db......
+  806628:	7b 62 80 00 00 00 00 00 91 62 80 00 00 00 00 00     {b.......b......
+  806638:	a9 62 80 00 00 00 00 00 c1 62 80 00 00 00 00 00     .b.......b......
+  806648:	ce 62 80 00 00 00 00 00 60 66 80 00 00 00 00 00     .b......`f......
+  806658:	e2 62 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .b......file is 
+  806668:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806678:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806688:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806698:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8066a8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8066b8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8066c8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8066d8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  8066e8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  8066f8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  806708:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  806718:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  806728:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  806738:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806748:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806758:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806768:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806778:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806788:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806798:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8067a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8067b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008067c0 <devtab>:
+  8067c0:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  8067d0:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8067e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8067f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806800:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806810:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806820:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806830:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806840:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806850:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806860:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806870:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806880:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806890:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  8068a0:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  8068b0:	00 0f 1f 80 00 00 00 00 55 73 65 72 73 70 61 63     ........Userspac
+  8068c0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8068d0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8068e0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8068f0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806900:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806910:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806920:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806930:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  806940:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806950:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806960:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806970:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806980:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806990:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806aa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ab0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ac0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ad0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ae0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806af0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ba0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806be0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ca0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ce0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806da0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806db0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806de0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806df0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ea0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806eb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ec0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ed0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ee0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ef0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fa0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fe0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ff0:	1f 84 00 00 00 00 00 66 0f 1f 84 00 00 00 00 00     .......f........
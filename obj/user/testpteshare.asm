@@ -0,0 +1,11439 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 91 40 80 00 00 	movabs $0x804091,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 91 40 80 00 00 	movabs $0x804091,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be b7 6a 80 00 00 	movabs $0x806ab7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 38 64 80 00 00 	movabs $0x806438,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 3a 64 80 00 00 	movabs $0x80643a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 3d 64 80 00 00 	movabs $0x80643d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 23 58 80 00 00 	movabs $0x805823,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 fa 5a 80 00 00 	movabs $0x805afa,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 a5 37 80 00 00 	movabs $0x8037a5,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 6e 38 80 00 00 	movabs $0x80386e,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 74 37 80 00 00 	movabs $0x803774,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 74 37 80 00 00 	movabs $0x803774,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 15 25 80 00 00 	movabs $0x802515,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 40 64 80 00 00 	movabs $0x806440,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 48 25 80 00 00 	movabs $0x802548,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 15 25 80 00 00 	movabs $0x802515,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be e0 66 80 00 00 	movabs $0x8066e0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 15 25 80 00 00 	movabs $0x802515,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 15 25 80 00 00 	movabs $0x802515,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 60 69 80 00 00 	movabs $0x806960,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 60 69 80 00 00 	movabs $0x806960,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 6d 27 80 00 00 	movabs $0x80276d,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 6d 27 80 00 00 	movabs $0x80276d,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 54 02 00 00       	call   801753 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  801505:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  80150c:	00 00 00 
+  80150f:	48 8b 30             	mov    (%rax),%rsi
+  801512:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  801517:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  80151e:	00 00 00 
+  801521:	ff d0                	call   *%rax
+    exit();
+  801523:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80152a:	00 00 00 
+  80152d:	ff d0                	call   *%rax
+}
+  80152f:	5d                   	pop    %rbp
+  801530:	c3                   	ret
+
+0000000000801531 <umain>:
+umain(int argc, char **argv) {
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	53                   	push   %rbx
+  801536:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80153a:	85 ff                	test   %edi,%edi
+  80153c:	0f 85 4a 01 00 00    	jne    80168c <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  801542:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801547:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80154c:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  801551:	bf 00 00 00 00       	mov    $0x0,%edi
+  801556:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+  801562:	85 c0                	test   %eax,%eax
+  801564:	0f 88 33 01 00 00    	js     80169d <umain+0x16c>
+    if ((r = fork()) < 0)
+  80156a:	48 b8 69 30 80 00 00 	movabs $0x803069,%rax
+  801571:	00 00 00 
+  801574:	ff d0                	call   *%rax
+  801576:	89 c3                	mov    %eax,%ebx
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	0f 88 4a 01 00 00    	js     8016ca <umain+0x199>
+    if (r == 0) {
+  801580:	0f 84 71 01 00 00    	je     8016f7 <umain+0x1c6>
+    wait(r);
+  801586:	89 df                	mov    %ebx,%edi
+  801588:	48 b8 70 4f 80 00 00 	movabs $0x804f70,%rax
+  80158f:	00 00 00 
+  801592:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  801594:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  80159b:	00 00 00 
+  80159e:	48 8b 30             	mov    (%rax),%rsi
+  8015a1:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8015a6:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  8015ad:	00 00 00 
+  8015b0:	ff d0                	call   *%rax
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	48 be 88 69 80 00 00 	movabs $0x806988,%rsi
+  8015bb:	00 00 00 
+  8015be:	48 b8 82 69 80 00 00 	movabs $0x806982,%rax
+  8015c5:	00 00 00 
+  8015c8:	48 0f 44 f0          	cmove  %rax,%rsi
+  8015cc:	48 bf b5 69 80 00 00 	movabs $0x8069b5,%rdi
+  8015d3:	00 00 00 
+  8015d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015db:	48 ba 6f 19 80 00 00 	movabs $0x80196f,%rdx
+  8015e2:	00 00 00 
+  8015e5:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8015e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ec:	48 ba d0 69 80 00 00 	movabs $0x8069d0,%rdx
+  8015f3:	00 00 00 
+  8015f6:	48 be d5 69 80 00 00 	movabs $0x8069d5,%rsi
+  8015fd:	00 00 00 
+  801600:	48 bf d4 69 80 00 00 	movabs $0x8069d4,%rdi
+  801607:	00 00 00 
+  80160a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160f:	49 b8 75 49 80 00 00 	movabs $0x804975,%r8
+  801616:	00 00 00 
+  801619:	41 ff d0             	call   *%r8
+  80161c:	89 c7                	mov    %eax,%edi
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	0f 88 00 01 00 00    	js     801726 <umain+0x1f5>
+    wait(r);
+  801626:	48 b8 70 4f 80 00 00 	movabs $0x804f70,%rax
+  80162d:	00 00 00 
+  801630:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  801632:	48 b8 38 80 80 00 00 	movabs $0x808038,%rax
+  801639:	00 00 00 
+  80163c:	48 8b 30             	mov    (%rax),%rsi
+  80163f:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  801644:	48 b8 68 23 80 00 00 	movabs $0x802368,%rax
+  80164b:	00 00 00 
+  80164e:	ff d0                	call   *%rax
+  801650:	85 c0                	test   %eax,%eax
+  801652:	48 be 88 69 80 00 00 	movabs $0x806988,%rsi
+  801659:	00 00 00 
+  80165c:	48 b8 82 69 80 00 00 	movabs $0x806982,%rax
+  801663:	00 00 00 
+  801666:	48 0f 44 f0          	cmove  %rax,%rsi
+  80166a:	48 bf ec 69 80 00 00 	movabs $0x8069ec,%rdi
+  801671:	00 00 00 
+  801674:	b8 00 00 00 00       	mov    $0x0,%eax
+  801679:	48 ba 6f 19 80 00 00 	movabs $0x80196f,%rdx
+  801680:	00 00 00 
+  801683:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  801685:	cc                   	int3
+}
+  801686:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80168a:	c9                   	leave
+  80168b:	c3                   	ret
+        childofspawn();
+  80168c:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801693:	00 00 00 
+  801696:	ff d0                	call   *%rax
+  801698:	e9 a5 fe ff ff       	jmp    801542 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  80169d:	89 c1                	mov    %eax,%ecx
+  80169f:	48 ba 8e 69 80 00 00 	movabs $0x80698e,%rdx
+  8016a6:	00 00 00 
+  8016a9:	be 12 00 00 00       	mov    $0x12,%esi
+  8016ae:	48 bf a1 69 80 00 00 	movabs $0x8069a1,%rdi
+  8016b5:	00 00 00 
+  8016b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bd:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8016c4:	00 00 00 
+  8016c7:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8016ca:	89 c1                	mov    %eax,%ecx
+  8016cc:	48 ba bc 6f 80 00 00 	movabs $0x806fbc,%rdx
+  8016d3:	00 00 00 
+  8016d6:	be 16 00 00 00       	mov    $0x16,%esi
+  8016db:	48 bf a1 69 80 00 00 	movabs $0x8069a1,%rdi
+  8016e2:	00 00 00 
+  8016e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ea:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8016f1:	00 00 00 
+  8016f4:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  8016f7:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  8016fe:	00 00 00 
+  801701:	48 8b 30             	mov    (%rax),%rsi
+  801704:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  801709:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+        exit();
+  801715:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  80171c:	00 00 00 
+  80171f:	ff d0                	call   *%rax
+  801721:	e9 60 fe ff ff       	jmp    801586 <umain+0x55>
+        panic("spawn: %i", r);
+  801726:	89 c1                	mov    %eax,%ecx
+  801728:	48 ba e2 69 80 00 00 	movabs $0x8069e2,%rdx
+  80172f:	00 00 00 
+  801732:	be 20 00 00 00       	mov    $0x20,%esi
+  801737:	48 bf a1 69 80 00 00 	movabs $0x8069a1,%rdi
+  80173e:	00 00 00 
+  801741:	b8 00 00 00 00       	mov    $0x0,%eax
+  801746:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  80174d:	00 00 00 
+  801750:	41 ff d0             	call   *%r8
+
+0000000000801753 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801753:	55                   	push   %rbp
+  801754:	48 89 e5             	mov    %rsp,%rbp
+  801757:	41 56                	push   %r14
+  801759:	41 55                	push   %r13
+  80175b:	41 54                	push   %r12
+  80175d:	53                   	push   %rbx
+  80175e:	41 89 fd             	mov    %edi,%r13d
+  801761:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801764:	48 ba 18 81 80 00 00 	movabs $0x808118,%rdx
+  80176b:	00 00 00 
+  80176e:	48 b8 18 81 80 00 00 	movabs $0x808118,%rax
+  801775:	00 00 00 
+  801778:	48 39 c2             	cmp    %rax,%rdx
+  80177b:	73 17                	jae    801794 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80177d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801780:	49 89 c4             	mov    %rax,%r12
+  801783:	48 83 c3 08          	add    $0x8,%rbx
+  801787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178c:	ff 53 f8             	call   *-0x8(%rbx)
+  80178f:	4c 39 e3             	cmp    %r12,%rbx
+  801792:	72 ef                	jb     801783 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801794:	48 b8 33 29 80 00 00 	movabs $0x802933,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+  8017a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017a5:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8017ac:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8017b3:	00 00 00 
+  8017b6:	48 01 d0             	add    %rdx,%rax
+  8017b9:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  8017c0:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8017c3:	45 85 ed             	test   %r13d,%r13d
+  8017c6:	7e 0d                	jle    8017d5 <libmain+0x82>
+  8017c8:	49 8b 06             	mov    (%r14),%rax
+  8017cb:	48 a3 48 80 80 00 00 	movabs %rax,0x808048
+  8017d2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8017d5:	4c 89 f6             	mov    %r14,%rsi
+  8017d8:	44 89 ef             	mov    %r13d,%edi
+  8017db:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8017e2:	00 00 00 
+  8017e5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8017e7:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8017ee:	00 00 00 
+  8017f1:	ff d0                	call   *%rax
+#endif
+}
+  8017f3:	5b                   	pop    %rbx
+  8017f4:	41 5c                	pop    %r12
+  8017f6:	41 5d                	pop    %r13
+  8017f8:	41 5e                	pop    %r14
+  8017fa:	5d                   	pop    %rbp
+  8017fb:	c3                   	ret
+
+00000000008017fc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801800:	48 b8 41 34 80 00 00 	movabs $0x803441,%rax
+  801807:	00 00 00 
+  80180a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801811:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+}
+  80181d:	5d                   	pop    %rbp
+  80181e:	c3                   	ret
+
+000000000080181f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80181f:	55                   	push   %rbp
+  801820:	48 89 e5             	mov    %rsp,%rbp
+  801823:	41 56                	push   %r14
+  801825:	41 55                	push   %r13
+  801827:	41 54                	push   %r12
+  801829:	53                   	push   %rbx
+  80182a:	48 83 ec 50          	sub    $0x50,%rsp
+  80182e:	49 89 fc             	mov    %rdi,%r12
+  801831:	41 89 f5             	mov    %esi,%r13d
+  801834:	48 89 d3             	mov    %rdx,%rbx
+  801837:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80183b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80183f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801843:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80184a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80184e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801852:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801856:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80185a:	48 b8 48 80 80 00 00 	movabs $0x808048,%rax
+  801861:	00 00 00 
+  801864:	4c 8b 30             	mov    (%rax),%r14
+  801867:	48 b8 33 29 80 00 00 	movabs $0x802933,%rax
+  80186e:	00 00 00 
+  801871:	ff d0                	call   *%rax
+  801873:	89 c6                	mov    %eax,%esi
+  801875:	45 89 e8             	mov    %r13d,%r8d
+  801878:	4c 89 e1             	mov    %r12,%rcx
+  80187b:	4c 89 f2             	mov    %r14,%rdx
+  80187e:	48 bf 30 6a 80 00 00 	movabs $0x806a30,%rdi
+  801885:	00 00 00 
+  801888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188d:	49 bc 6f 19 80 00 00 	movabs $0x80196f,%r12
+  801894:	00 00 00 
+  801897:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80189a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80189e:	48 89 df             	mov    %rbx,%rdi
+  8018a1:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+    cprintf("\n");
+  8018ad:	48 bf 16 6a 80 00 00 	movabs $0x806a16,%rdi
+  8018b4:	00 00 00 
+  8018b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8018bf:	cc                   	int3
+  8018c0:	eb fd                	jmp    8018bf <_panic+0xa0>
+
+00000000008018c2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8018c2:	55                   	push   %rbp
+  8018c3:	48 89 e5             	mov    %rsp,%rbp
+  8018c6:	53                   	push   %rbx
+  8018c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8018cb:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8018ce:	8b 06                	mov    (%rsi),%eax
+  8018d0:	8d 50 01             	lea    0x1(%rax),%edx
+  8018d3:	89 16                	mov    %edx,(%rsi)
+  8018d5:	48 98                	cltq
+  8018d7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8018dc:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8018e2:	74 0a                	je     8018ee <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8018e4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8018e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8018ec:	c9                   	leave
+  8018ed:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8018ee:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8018f2:	be ff 00 00 00       	mov    $0xff,%esi
+  8018f7:	48 b8 23 28 80 00 00 	movabs $0x802823,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+        state->offset = 0;
+  801903:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801909:	eb d9                	jmp    8018e4 <putch+0x22>
+
+000000000080190b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80190b:	55                   	push   %rbp
+  80190c:	48 89 e5             	mov    %rsp,%rbp
+  80190f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801916:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801919:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801920:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80192d:	48 89 f1             	mov    %rsi,%rcx
+  801930:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801937:	48 bf c2 18 80 00 00 	movabs $0x8018c2,%rdi
+  80193e:	00 00 00 
+  801941:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  801948:	00 00 00 
+  80194b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80194d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801954:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80195b:	48 b8 23 28 80 00 00 	movabs $0x802823,%rax
+  801962:	00 00 00 
+  801965:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801967:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80196d:	c9                   	leave
+  80196e:	c3                   	ret
+
+000000000080196f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80196f:	55                   	push   %rbp
+  801970:	48 89 e5             	mov    %rsp,%rbp
+  801973:	48 83 ec 50          	sub    $0x50,%rsp
+  801977:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80197b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80197f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801983:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801987:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80198b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801992:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801996:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80199a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80199e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8019a2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8019a6:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8019b2:	c9                   	leave
+  8019b3:	c3                   	ret
+
+00000000008019b4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8019b4:	55                   	push   %rbp
+  8019b5:	48 89 e5             	mov    %rsp,%rbp
+  8019b8:	41 57                	push   %r15
+  8019ba:	41 56                	push   %r14
+  8019bc:	41 55                	push   %r13
+  8019be:	41 54                	push   %r12
+  8019c0:	53                   	push   %rbx
+  8019c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8019c5:	49 89 fc             	mov    %rdi,%r12
+  8019c8:	49 89 f5             	mov    %rsi,%r13
+  8019cb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019cf:	8b 45 10             	mov    0x10(%rbp),%eax
+  8019d2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8019d5:	41 89 cf             	mov    %ecx,%r15d
+  8019d8:	4c 39 fa             	cmp    %r15,%rdx
+  8019db:	73 5b                	jae    801a38 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8019dd:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8019e1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8019e5:	85 db                	test   %ebx,%ebx
+  8019e7:	7e 0e                	jle    8019f7 <print_num+0x43>
+            putch(padc, put_arg);
+  8019e9:	4c 89 ee             	mov    %r13,%rsi
+  8019ec:	44 89 f7             	mov    %r14d,%edi
+  8019ef:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8019f2:	83 eb 01             	sub    $0x1,%ebx
+  8019f5:	75 f2                	jne    8019e9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8019f7:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8019fb:	48 b9 64 6a 80 00 00 	movabs $0x806a64,%rcx
+  801a02:	00 00 00 
+  801a05:	48 b8 53 6a 80 00 00 	movabs $0x806a53,%rax
+  801a0c:	00 00 00 
+  801a0f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801a13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1c:	49 f7 f7             	div    %r15
+  801a1f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801a23:	4c 89 ee             	mov    %r13,%rsi
+  801a26:	41 ff d4             	call   *%r12
+}
+  801a29:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a2d:	5b                   	pop    %rbx
+  801a2e:	41 5c                	pop    %r12
+  801a30:	41 5d                	pop    %r13
+  801a32:	41 5e                	pop    %r14
+  801a34:	41 5f                	pop    %r15
+  801a36:	5d                   	pop    %rbp
+  801a37:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801a38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a41:	49 f7 f7             	div    %r15
+  801a44:	48 83 ec 08          	sub    $0x8,%rsp
+  801a48:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801a4c:	52                   	push   %rdx
+  801a4d:	45 0f be c9          	movsbl %r9b,%r9d
+  801a51:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801a55:	48 89 c2             	mov    %rax,%rdx
+  801a58:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  801a5f:	00 00 00 
+  801a62:	ff d0                	call   *%rax
+  801a64:	48 83 c4 10          	add    $0x10,%rsp
+  801a68:	eb 8d                	jmp    8019f7 <print_num+0x43>
+
+0000000000801a6a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801a6a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801a6e:	48 8b 06             	mov    (%rsi),%rax
+  801a71:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801a75:	73 0a                	jae    801a81 <sprintputch+0x17>
+        *state->start++ = ch;
+  801a77:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a7b:	48 89 16             	mov    %rdx,(%rsi)
+  801a7e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801a81:	c3                   	ret
+
+0000000000801a82 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801a82:	55                   	push   %rbp
+  801a83:	48 89 e5             	mov    %rsp,%rbp
+  801a86:	48 83 ec 50          	sub    $0x50,%rsp
+  801a8a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801a8e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801a92:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801a96:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801a9d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801aa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801aa5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801aa9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801aad:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801ab1:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  801ab8:	00 00 00 
+  801abb:	ff d0                	call   *%rax
+}
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+
+0000000000801abf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+  801ac3:	41 57                	push   %r15
+  801ac5:	41 56                	push   %r14
+  801ac7:	41 55                	push   %r13
+  801ac9:	41 54                	push   %r12
+  801acb:	53                   	push   %rbx
+  801acc:	48 83 ec 38          	sub    $0x38,%rsp
+  801ad0:	49 89 fe             	mov    %rdi,%r14
+  801ad3:	49 89 f5             	mov    %rsi,%r13
+  801ad6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ad9:	48 8b 01             	mov    (%rcx),%rax
+  801adc:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801ae0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801ae4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ae8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801aec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801af0:	eb 0d                	jmp    801aff <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801af2:	40 0f b6 ff          	movzbl %dil,%edi
+  801af6:	4c 89 ee             	mov    %r13,%rsi
+  801af9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801afc:	4c 89 e3             	mov    %r12,%rbx
+  801aff:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801b03:	0f b6 3b             	movzbl (%rbx),%edi
+  801b06:	40 80 ff 25          	cmp    $0x25,%dil
+  801b0a:	74 14                	je     801b20 <vprintfmt+0x61>
+            if (!ch) return;
+  801b0c:	40 84 ff             	test   %dil,%dil
+  801b0f:	75 e1                	jne    801af2 <vprintfmt+0x33>
+}
+  801b11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b15:	5b                   	pop    %rbx
+  801b16:	41 5c                	pop    %r12
+  801b18:	41 5d                	pop    %r13
+  801b1a:	41 5e                	pop    %r14
+  801b1c:	41 5f                	pop    %r15
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801b20:	be 00 00 00 00       	mov    $0x0,%esi
+  801b25:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801b29:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801b2e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b34:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801b3b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801b3f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801b44:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801b49:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801b4c:	83 e8 23             	sub    $0x23,%eax
+  801b4f:	3c 57                	cmp    $0x57,%al
+  801b51:	0f 87 67 06 00 00    	ja     8021be <vprintfmt+0x6ff>
+  801b57:	0f b6 c0             	movzbl %al,%eax
+  801b5a:	48 b9 00 6c 80 00 00 	movabs $0x806c00,%rcx
+  801b61:	00 00 00 
+  801b64:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801b67:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801b6a:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801b6e:	eb cf                	jmp    801b3f <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801b70:	49 89 dc             	mov    %rbx,%r12
+  801b73:	be 01 00 00 00       	mov    $0x1,%esi
+  801b78:	eb c5                	jmp    801b3f <vprintfmt+0x80>
+            padc = ch;
+  801b7a:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801b7e:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801b81:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801b84:	eb b9                	jmp    801b3f <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801b86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801b89:	83 f8 2f             	cmp    $0x2f,%eax
+  801b8c:	77 24                	ja     801bb2 <vprintfmt+0xf3>
+  801b8e:	89 c1                	mov    %eax,%ecx
+  801b90:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801b94:	83 c0 08             	add    $0x8,%eax
+  801b97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801b9a:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801b9d:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801ba0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ba4:	79 99                	jns    801b3f <vprintfmt+0x80>
+                width = precision;
+  801ba6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801baa:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801bb0:	eb 8d                	jmp    801b3f <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801bb2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801bb6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801bba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801bbe:	eb da                	jmp    801b9a <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801bc0:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801bc5:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801bc9:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801bcf:	3c 39                	cmp    $0x39,%al
+  801bd1:	77 1c                	ja     801bef <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801bd3:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801bd7:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801bdb:	0f b6 c0             	movzbl %al,%eax
+  801bde:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801be3:	0f b6 03             	movzbl (%rbx),%eax
+  801be6:	3c 39                	cmp    $0x39,%al
+  801be8:	76 e9                	jbe    801bd3 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801bea:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801bed:	eb b1                	jmp    801ba0 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801bef:	49 89 dc             	mov    %rbx,%r12
+  801bf2:	eb ac                	jmp    801ba0 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801bf4:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801bf7:	85 c9                	test   %ecx,%ecx
+  801bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfe:	0f 49 c1             	cmovns %ecx,%eax
+  801c01:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801c04:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c07:	e9 33 ff ff ff       	jmp    801b3f <vprintfmt+0x80>
+            lflag++;
+  801c0c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c0f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c12:	e9 28 ff ff ff       	jmp    801b3f <vprintfmt+0x80>
+            lflag--;
+  801c17:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c1a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c1d:	e9 1d ff ff ff       	jmp    801b3f <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c25:	83 f8 2f             	cmp    $0x2f,%eax
+  801c28:	77 19                	ja     801c43 <vprintfmt+0x184>
+  801c2a:	89 c2                	mov    %eax,%edx
+  801c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c30:	83 c0 08             	add    $0x8,%eax
+  801c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c36:	8b 3a                	mov    (%rdx),%edi
+  801c38:	4c 89 ee             	mov    %r13,%rsi
+  801c3b:	41 ff d6             	call   *%r14
+            break;
+  801c3e:	e9 bc fe ff ff       	jmp    801aff <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801c43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c4f:	eb e5                	jmp    801c36 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801c51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c54:	83 f8 2f             	cmp    $0x2f,%eax
+  801c57:	77 5a                	ja     801cb3 <vprintfmt+0x1f4>
+  801c59:	89 c2                	mov    %eax,%edx
+  801c5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c5f:	83 c0 08             	add    $0x8,%eax
+  801c62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801c65:	8b 02                	mov    (%rdx),%eax
+  801c67:	89 c1                	mov    %eax,%ecx
+  801c69:	f7 d9                	neg    %ecx
+  801c6b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801c6e:	83 f9 13             	cmp    $0x13,%ecx
+  801c71:	7f 4e                	jg     801cc1 <vprintfmt+0x202>
+  801c73:	48 63 c1             	movslq %ecx,%rax
+  801c76:	48 ba c0 6e 80 00 00 	movabs $0x806ec0,%rdx
+  801c7d:	00 00 00 
+  801c80:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801c84:	48 85 c0             	test   %rax,%rax
+  801c87:	74 38                	je     801cc1 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801c89:	48 89 c1             	mov    %rax,%rcx
+  801c8c:	48 ba 08 71 80 00 00 	movabs $0x807108,%rdx
+  801c93:	00 00 00 
+  801c96:	4c 89 ee             	mov    %r13,%rsi
+  801c99:	4c 89 f7             	mov    %r14,%rdi
+  801c9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca1:	49 b8 82 1a 80 00 00 	movabs $0x801a82,%r8
+  801ca8:	00 00 00 
+  801cab:	41 ff d0             	call   *%r8
+  801cae:	e9 4c fe ff ff       	jmp    801aff <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801cb3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cb7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cbf:	eb a4                	jmp    801c65 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801cc1:	48 ba 7c 6a 80 00 00 	movabs $0x806a7c,%rdx
+  801cc8:	00 00 00 
+  801ccb:	4c 89 ee             	mov    %r13,%rsi
+  801cce:	4c 89 f7             	mov    %r14,%rdi
+  801cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd6:	49 b8 82 1a 80 00 00 	movabs $0x801a82,%r8
+  801cdd:	00 00 00 
+  801ce0:	41 ff d0             	call   *%r8
+  801ce3:	e9 17 fe ff ff       	jmp    801aff <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ce8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ceb:	83 f8 2f             	cmp    $0x2f,%eax
+  801cee:	77 6c                	ja     801d5c <vprintfmt+0x29d>
+  801cf0:	89 c2                	mov    %eax,%edx
+  801cf2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cf6:	83 c0 08             	add    $0x8,%eax
+  801cf9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cfc:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801cff:	48 85 f6             	test   %rsi,%rsi
+  801d02:	48 b8 75 6a 80 00 00 	movabs $0x806a75,%rax
+  801d09:	00 00 00 
+  801d0c:	48 0f 45 c6          	cmovne %rsi,%rax
+  801d10:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801d14:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d18:	7e 06                	jle    801d20 <vprintfmt+0x261>
+  801d1a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801d1e:	75 4a                	jne    801d6a <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d20:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d24:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d28:	0f b6 00             	movzbl (%rax),%eax
+  801d2b:	84 c0                	test   %al,%al
+  801d2d:	0f 85 9a 00 00 00    	jne    801dcd <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801d33:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d36:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801d3a:	85 c0                	test   %eax,%eax
+  801d3c:	0f 8e bd fd ff ff    	jle    801aff <vprintfmt+0x40>
+  801d42:	4c 89 ee             	mov    %r13,%rsi
+  801d45:	bf 20 00 00 00       	mov    $0x20,%edi
+  801d4a:	41 ff d6             	call   *%r14
+  801d4d:	41 83 ec 01          	sub    $0x1,%r12d
+  801d51:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801d55:	75 eb                	jne    801d42 <vprintfmt+0x283>
+  801d57:	e9 a3 fd ff ff       	jmp    801aff <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d68:	eb 92                	jmp    801cfc <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801d6a:	49 63 f7             	movslq %r15d,%rsi
+  801d6d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801d71:	48 b8 83 22 80 00 00 	movabs $0x802283,%rax
+  801d78:	00 00 00 
+  801d7b:	ff d0                	call   *%rax
+  801d7d:	48 89 c2             	mov    %rax,%rdx
+  801d80:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d83:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801d85:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801d88:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801d8b:	85 c0                	test   %eax,%eax
+  801d8d:	7e 91                	jle    801d20 <vprintfmt+0x261>
+  801d8f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801d94:	4c 89 ee             	mov    %r13,%rsi
+  801d97:	44 89 e7             	mov    %r12d,%edi
+  801d9a:	41 ff d6             	call   *%r14
+  801d9d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801da1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801da4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801da7:	75 eb                	jne    801d94 <vprintfmt+0x2d5>
+  801da9:	e9 72 ff ff ff       	jmp    801d20 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801dae:	0f b6 f8             	movzbl %al,%edi
+  801db1:	4c 89 ee             	mov    %r13,%rsi
+  801db4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801db7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801dbb:	49 83 c4 01          	add    $0x1,%r12
+  801dbf:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801dc5:	84 c0                	test   %al,%al
+  801dc7:	0f 84 66 ff ff ff    	je     801d33 <vprintfmt+0x274>
+  801dcd:	45 85 ff             	test   %r15d,%r15d
+  801dd0:	78 0a                	js     801ddc <vprintfmt+0x31d>
+  801dd2:	41 83 ef 01          	sub    $0x1,%r15d
+  801dd6:	0f 88 57 ff ff ff    	js     801d33 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801ddc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801de0:	74 cc                	je     801dae <vprintfmt+0x2ef>
+  801de2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801de5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801dea:	80 fa 5e             	cmp    $0x5e,%dl
+  801ded:	77 c2                	ja     801db1 <vprintfmt+0x2f2>
+  801def:	eb bd                	jmp    801dae <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801df1:	40 84 f6             	test   %sil,%sil
+  801df4:	75 26                	jne    801e1c <vprintfmt+0x35d>
+    switch (lflag) {
+  801df6:	85 d2                	test   %edx,%edx
+  801df8:	74 59                	je     801e53 <vprintfmt+0x394>
+  801dfa:	83 fa 01             	cmp    $0x1,%edx
+  801dfd:	74 7b                	je     801e7a <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801dff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e02:	83 f8 2f             	cmp    $0x2f,%eax
+  801e05:	0f 87 96 00 00 00    	ja     801ea1 <vprintfmt+0x3e2>
+  801e0b:	89 c2                	mov    %eax,%edx
+  801e0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e11:	83 c0 08             	add    $0x8,%eax
+  801e14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e17:	4c 8b 22             	mov    (%rdx),%r12
+  801e1a:	eb 17                	jmp    801e33 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801e1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e1f:	83 f8 2f             	cmp    $0x2f,%eax
+  801e22:	77 21                	ja     801e45 <vprintfmt+0x386>
+  801e24:	89 c2                	mov    %eax,%edx
+  801e26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e2a:	83 c0 08             	add    $0x8,%eax
+  801e2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e30:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801e33:	4d 85 e4             	test   %r12,%r12
+  801e36:	78 7a                	js     801eb2 <vprintfmt+0x3f3>
+            num = i;
+  801e38:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801e3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801e40:	e9 56 02 00 00       	jmp    80209b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801e45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e51:	eb dd                	jmp    801e30 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801e53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e56:	83 f8 2f             	cmp    $0x2f,%eax
+  801e59:	77 11                	ja     801e6c <vprintfmt+0x3ad>
+  801e5b:	89 c2                	mov    %eax,%edx
+  801e5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e61:	83 c0 08             	add    $0x8,%eax
+  801e64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e67:	4c 63 22             	movslq (%rdx),%r12
+  801e6a:	eb c7                	jmp    801e33 <vprintfmt+0x374>
+  801e6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e78:	eb ed                	jmp    801e67 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801e7a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e7d:	83 f8 2f             	cmp    $0x2f,%eax
+  801e80:	77 11                	ja     801e93 <vprintfmt+0x3d4>
+  801e82:	89 c2                	mov    %eax,%edx
+  801e84:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e88:	83 c0 08             	add    $0x8,%eax
+  801e8b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e8e:	4c 8b 22             	mov    (%rdx),%r12
+  801e91:	eb a0                	jmp    801e33 <vprintfmt+0x374>
+  801e93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e9f:	eb ed                	jmp    801e8e <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801ea1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ead:	e9 65 ff ff ff       	jmp    801e17 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801eb2:	4c 89 ee             	mov    %r13,%rsi
+  801eb5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801eba:	41 ff d6             	call   *%r14
+                i = -i;
+  801ebd:	49 f7 dc             	neg    %r12
+  801ec0:	e9 73 ff ff ff       	jmp    801e38 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801ec5:	40 84 f6             	test   %sil,%sil
+  801ec8:	75 2e                	jne    801ef8 <vprintfmt+0x439>
+    switch (lflag) {
+  801eca:	85 d2                	test   %edx,%edx
+  801ecc:	7f 59                	jg     801f27 <vprintfmt+0x468>
+  801ece:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ed1:	7d 7a                	jge    801f4d <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801ed3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ed6:	83 f8 2f             	cmp    $0x2f,%eax
+  801ed9:	0f 87 aa 00 00 00    	ja     801f89 <vprintfmt+0x4ca>
+  801edf:	89 c2                	mov    %eax,%edx
+  801ee1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee5:	83 c0 08             	add    $0x8,%eax
+  801ee8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eeb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801eee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ef3:	e9 a3 01 00 00       	jmp    80209b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ef8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801efb:	83 f8 2f             	cmp    $0x2f,%eax
+  801efe:	77 19                	ja     801f19 <vprintfmt+0x45a>
+  801f00:	89 c2                	mov    %eax,%edx
+  801f02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f06:	83 c0 08             	add    $0x8,%eax
+  801f09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f0c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f14:	e9 82 01 00 00       	jmp    80209b <vprintfmt+0x5dc>
+  801f19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f25:	eb e5                	jmp    801f0c <vprintfmt+0x44d>
+    switch (lflag) {
+  801f27:	83 fa 01             	cmp    $0x1,%edx
+  801f2a:	75 a7                	jne    801ed3 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801f2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f2f:	83 f8 2f             	cmp    $0x2f,%eax
+  801f32:	77 47                	ja     801f7b <vprintfmt+0x4bc>
+  801f34:	89 c2                	mov    %eax,%edx
+  801f36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3a:	83 c0 08             	add    $0x8,%eax
+  801f3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f40:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f43:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801f48:	e9 4e 01 00 00       	jmp    80209b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f50:	83 f8 2f             	cmp    $0x2f,%eax
+  801f53:	77 18                	ja     801f6d <vprintfmt+0x4ae>
+  801f55:	89 c2                	mov    %eax,%edx
+  801f57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f5b:	83 c0 08             	add    $0x8,%eax
+  801f5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f61:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801f63:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801f68:	e9 2e 01 00 00       	jmp    80209b <vprintfmt+0x5dc>
+  801f6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f79:	eb e6                	jmp    801f61 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801f7b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f7f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f87:	eb b7                	jmp    801f40 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801f89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f95:	e9 51 ff ff ff       	jmp    801eeb <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801f9a:	40 84 f6             	test   %sil,%sil
+  801f9d:	75 2e                	jne    801fcd <vprintfmt+0x50e>
+    switch (lflag) {
+  801f9f:	85 d2                	test   %edx,%edx
+  801fa1:	7f 59                	jg     801ffc <vprintfmt+0x53d>
+  801fa3:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801fa6:	7d 77                	jge    80201f <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801fa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fab:	83 f8 2f             	cmp    $0x2f,%eax
+  801fae:	0f 87 a4 00 00 00    	ja     802058 <vprintfmt+0x599>
+  801fb4:	89 c2                	mov    %eax,%edx
+  801fb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fba:	83 c0 08             	add    $0x8,%eax
+  801fbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801fc3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801fc8:	e9 ce 00 00 00       	jmp    80209b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801fcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fd0:	83 f8 2f             	cmp    $0x2f,%eax
+  801fd3:	77 19                	ja     801fee <vprintfmt+0x52f>
+  801fd5:	89 c2                	mov    %eax,%edx
+  801fd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fdb:	83 c0 08             	add    $0x8,%eax
+  801fde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fe1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801fe4:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801fe9:	e9 ad 00 00 00       	jmp    80209b <vprintfmt+0x5dc>
+  801fee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ff2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ffa:	eb e5                	jmp    801fe1 <vprintfmt+0x522>
+    switch (lflag) {
+  801ffc:	83 fa 01             	cmp    $0x1,%edx
+  801fff:	75 a7                	jne    801fa8 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802001:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802004:	83 f8 2f             	cmp    $0x2f,%eax
+  802007:	77 41                	ja     80204a <vprintfmt+0x58b>
+  802009:	89 c2                	mov    %eax,%edx
+  80200b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80200f:	83 c0 08             	add    $0x8,%eax
+  802012:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802015:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802018:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80201d:	eb 7c                	jmp    80209b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  80201f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802022:	83 f8 2f             	cmp    $0x2f,%eax
+  802025:	77 15                	ja     80203c <vprintfmt+0x57d>
+  802027:	89 c2                	mov    %eax,%edx
+  802029:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80202d:	83 c0 08             	add    $0x8,%eax
+  802030:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802033:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802035:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80203a:	eb 5f                	jmp    80209b <vprintfmt+0x5dc>
+  80203c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802040:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802044:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802048:	eb e9                	jmp    802033 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80204a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80204e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802052:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802056:	eb bd                	jmp    802015 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  802058:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802060:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802064:	e9 57 ff ff ff       	jmp    801fc0 <vprintfmt+0x501>
+            putch('0', put_arg);
+  802069:	4c 89 ee             	mov    %r13,%rsi
+  80206c:	bf 30 00 00 00       	mov    $0x30,%edi
+  802071:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802074:	4c 89 ee             	mov    %r13,%rsi
+  802077:	bf 78 00 00 00       	mov    $0x78,%edi
+  80207c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80207f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802082:	83 f8 2f             	cmp    $0x2f,%eax
+  802085:	77 47                	ja     8020ce <vprintfmt+0x60f>
+  802087:	89 c2                	mov    %eax,%edx
+  802089:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80208d:	83 c0 08             	add    $0x8,%eax
+  802090:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802093:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802096:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80209b:	48 83 ec 08          	sub    $0x8,%rsp
+  80209f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8020a3:	0f 94 c0             	sete   %al
+  8020a6:	0f b6 c0             	movzbl %al,%eax
+  8020a9:	50                   	push   %rax
+  8020aa:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8020af:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8020b3:	4c 89 ee             	mov    %r13,%rsi
+  8020b6:	4c 89 f7             	mov    %r14,%rdi
+  8020b9:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+            break;
+  8020c5:	48 83 c4 10          	add    $0x10,%rsp
+  8020c9:	e9 31 fa ff ff       	jmp    801aff <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8020ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020da:	eb b7                	jmp    802093 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8020dc:	40 84 f6             	test   %sil,%sil
+  8020df:	75 2b                	jne    80210c <vprintfmt+0x64d>
+    switch (lflag) {
+  8020e1:	85 d2                	test   %edx,%edx
+  8020e3:	7f 56                	jg     80213b <vprintfmt+0x67c>
+  8020e5:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8020e8:	7d 77                	jge    802161 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8020ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8020f0:	0f 87 a7 00 00 00    	ja     80219d <vprintfmt+0x6de>
+  8020f6:	89 c2                	mov    %eax,%edx
+  8020f8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020fc:	83 c0 08             	add    $0x8,%eax
+  8020ff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802102:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802105:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80210a:	eb 8f                	jmp    80209b <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80210c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80210f:	83 f8 2f             	cmp    $0x2f,%eax
+  802112:	77 19                	ja     80212d <vprintfmt+0x66e>
+  802114:	89 c2                	mov    %eax,%edx
+  802116:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80211a:	83 c0 08             	add    $0x8,%eax
+  80211d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802120:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802123:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802128:	e9 6e ff ff ff       	jmp    80209b <vprintfmt+0x5dc>
+  80212d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802131:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802135:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802139:	eb e5                	jmp    802120 <vprintfmt+0x661>
+    switch (lflag) {
+  80213b:	83 fa 01             	cmp    $0x1,%edx
+  80213e:	75 aa                	jne    8020ea <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802140:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802143:	83 f8 2f             	cmp    $0x2f,%eax
+  802146:	77 47                	ja     80218f <vprintfmt+0x6d0>
+  802148:	89 c2                	mov    %eax,%edx
+  80214a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80214e:	83 c0 08             	add    $0x8,%eax
+  802151:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802154:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802157:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80215c:	e9 3a ff ff ff       	jmp    80209b <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802161:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802164:	83 f8 2f             	cmp    $0x2f,%eax
+  802167:	77 18                	ja     802181 <vprintfmt+0x6c2>
+  802169:	89 c2                	mov    %eax,%edx
+  80216b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80216f:	83 c0 08             	add    $0x8,%eax
+  802172:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802175:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  802177:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80217c:	e9 1a ff ff ff       	jmp    80209b <vprintfmt+0x5dc>
+  802181:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802185:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802189:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80218d:	eb e6                	jmp    802175 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  80218f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802193:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802197:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80219b:	eb b7                	jmp    802154 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  80219d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a9:	e9 54 ff ff ff       	jmp    802102 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8021ae:	4c 89 ee             	mov    %r13,%rsi
+  8021b1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8021b6:	41 ff d6             	call   *%r14
+            break;
+  8021b9:	e9 41 f9 ff ff       	jmp    801aff <vprintfmt+0x40>
+            putch('%', put_arg);
+  8021be:	4c 89 ee             	mov    %r13,%rsi
+  8021c1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8021c6:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8021c9:	48 83 eb 01          	sub    $0x1,%rbx
+  8021cd:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8021d1:	75 f6                	jne    8021c9 <vprintfmt+0x70a>
+  8021d3:	e9 27 f9 ff ff       	jmp    801aff <vprintfmt+0x40>
+
+00000000008021d8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+  8021dc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8021e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021e4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8021e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8021ed:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8021f4:	48 85 ff             	test   %rdi,%rdi
+  8021f7:	74 2b                	je     802224 <vsnprintf+0x4c>
+  8021f9:	48 85 f6             	test   %rsi,%rsi
+  8021fc:	74 26                	je     802224 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8021fe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802202:	48 bf 6a 1a 80 00 00 	movabs $0x801a6a,%rdi
+  802209:	00 00 00 
+  80220c:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  802213:	00 00 00 
+  802216:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802218:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80221c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  80221f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802222:	c9                   	leave
+  802223:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802224:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802229:	eb f7                	jmp    802222 <vsnprintf+0x4a>
+
+000000000080222b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80222b:	55                   	push   %rbp
+  80222c:	48 89 e5             	mov    %rsp,%rbp
+  80222f:	48 83 ec 50          	sub    $0x50,%rsp
+  802233:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802237:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80223b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80223f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802246:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80224a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80224e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802252:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802256:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80225a:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+
+0000000000802268 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802268:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80226b:	74 10                	je     80227d <strlen+0x15>
+    size_t n = 0;
+  80226d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802272:	48 83 c0 01          	add    $0x1,%rax
+  802276:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80227a:	75 f6                	jne    802272 <strlen+0xa>
+  80227c:	c3                   	ret
+    size_t n = 0;
+  80227d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802282:	c3                   	ret
+
+0000000000802283 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802283:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802286:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80228b:	48 85 f6             	test   %rsi,%rsi
+  80228e:	74 11                	je     8022a1 <strnlen+0x1e>
+  802290:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802294:	74 0c                	je     8022a2 <strnlen+0x1f>
+  802296:	48 83 c2 01          	add    $0x1,%rdx
+  80229a:	48 39 d0             	cmp    %rdx,%rax
+  80229d:	75 f1                	jne    802290 <strnlen+0xd>
+  80229f:	eb 04                	jmp    8022a5 <strnlen+0x22>
+  8022a1:	c3                   	ret
+  8022a2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8022a5:	c3                   	ret
+
+00000000008022a6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8022a6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8022a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ae:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8022b2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8022b5:	48 83 c2 01          	add    $0x1,%rdx
+  8022b9:	84 c9                	test   %cl,%cl
+  8022bb:	75 f1                	jne    8022ae <strcpy+0x8>
+        ;
+    return res;
+}
+  8022bd:	c3                   	ret
+
+00000000008022be <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8022be:	55                   	push   %rbp
+  8022bf:	48 89 e5             	mov    %rsp,%rbp
+  8022c2:	41 54                	push   %r12
+  8022c4:	53                   	push   %rbx
+  8022c5:	48 89 fb             	mov    %rdi,%rbx
+  8022c8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8022cb:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  8022d2:	00 00 00 
+  8022d5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8022d7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8022db:	4c 89 e6             	mov    %r12,%rsi
+  8022de:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  8022e5:	00 00 00 
+  8022e8:	ff d0                	call   *%rax
+    return dst;
+}
+  8022ea:	48 89 d8             	mov    %rbx,%rax
+  8022ed:	5b                   	pop    %rbx
+  8022ee:	41 5c                	pop    %r12
+  8022f0:	5d                   	pop    %rbp
+  8022f1:	c3                   	ret
+
+00000000008022f2 <toupper>:
+
+int
+toupper(int ch) {
+  8022f2:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8022f4:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8022f7:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8022fa:	83 f9 1a             	cmp    $0x1a,%ecx
+  8022fd:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802300:	c3                   	ret
+
+0000000000802301 <tolower>:
+
+int
+tolower(int ch) {
+  802301:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802303:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802306:	8d 57 20             	lea    0x20(%rdi),%edx
+  802309:	83 f9 1a             	cmp    $0x1a,%ecx
+  80230c:	0f 42 c2             	cmovb  %edx,%eax
+}
+  80230f:	c3                   	ret
+
+0000000000802310 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802310:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802313:	48 85 d2             	test   %rdx,%rdx
+  802316:	74 1f                	je     802337 <strncpy+0x27>
+  802318:	48 01 fa             	add    %rdi,%rdx
+  80231b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80231e:	48 83 c1 01          	add    $0x1,%rcx
+  802322:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802326:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80232a:	41 80 f8 01          	cmp    $0x1,%r8b
+  80232e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802332:	48 39 ca             	cmp    %rcx,%rdx
+  802335:	75 e7                	jne    80231e <strncpy+0xe>
+    }
+    return ret;
+}
+  802337:	c3                   	ret
+
+0000000000802338 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802338:	48 89 f8             	mov    %rdi,%rax
+  80233b:	48 85 d2             	test   %rdx,%rdx
+  80233e:	74 24                	je     802364 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802340:	48 83 ea 01          	sub    $0x1,%rdx
+  802344:	74 1b                	je     802361 <strlcpy+0x29>
+  802346:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80234a:	0f b6 16             	movzbl (%rsi),%edx
+  80234d:	84 d2                	test   %dl,%dl
+  80234f:	74 10                	je     802361 <strlcpy+0x29>
+            *dst++ = *src++;
+  802351:	48 83 c6 01          	add    $0x1,%rsi
+  802355:	48 83 c0 01          	add    $0x1,%rax
+  802359:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80235c:	48 39 c8             	cmp    %rcx,%rax
+  80235f:	75 e9                	jne    80234a <strlcpy+0x12>
+        *dst = '\0';
+  802361:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802364:	48 29 f8             	sub    %rdi,%rax
+}
+  802367:	c3                   	ret
+
+0000000000802368 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802368:	0f b6 07             	movzbl (%rdi),%eax
+  80236b:	84 c0                	test   %al,%al
+  80236d:	74 13                	je     802382 <strcmp+0x1a>
+  80236f:	38 06                	cmp    %al,(%rsi)
+  802371:	75 0f                	jne    802382 <strcmp+0x1a>
+  802373:	48 83 c7 01          	add    $0x1,%rdi
+  802377:	48 83 c6 01          	add    $0x1,%rsi
+  80237b:	0f b6 07             	movzbl (%rdi),%eax
+  80237e:	84 c0                	test   %al,%al
+  802380:	75 ed                	jne    80236f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802382:	0f b6 c0             	movzbl %al,%eax
+  802385:	0f b6 16             	movzbl (%rsi),%edx
+  802388:	29 d0                	sub    %edx,%eax
+}
+  80238a:	c3                   	ret
+
+000000000080238b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80238b:	48 85 d2             	test   %rdx,%rdx
+  80238e:	74 1f                	je     8023af <strncmp+0x24>
+  802390:	0f b6 07             	movzbl (%rdi),%eax
+  802393:	84 c0                	test   %al,%al
+  802395:	74 1e                	je     8023b5 <strncmp+0x2a>
+  802397:	3a 06                	cmp    (%rsi),%al
+  802399:	75 1a                	jne    8023b5 <strncmp+0x2a>
+  80239b:	48 83 c7 01          	add    $0x1,%rdi
+  80239f:	48 83 c6 01          	add    $0x1,%rsi
+  8023a3:	48 83 ea 01          	sub    $0x1,%rdx
+  8023a7:	75 e7                	jne    802390 <strncmp+0x5>
+
+    if (!n) return 0;
+  8023a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ae:	c3                   	ret
+  8023af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b4:	c3                   	ret
+  8023b5:	48 85 d2             	test   %rdx,%rdx
+  8023b8:	74 09                	je     8023c3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8023ba:	0f b6 07             	movzbl (%rdi),%eax
+  8023bd:	0f b6 16             	movzbl (%rsi),%edx
+  8023c0:	29 d0                	sub    %edx,%eax
+  8023c2:	c3                   	ret
+    if (!n) return 0;
+  8023c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c8:	c3                   	ret
+
+00000000008023c9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8023c9:	0f b6 17             	movzbl (%rdi),%edx
+  8023cc:	84 d2                	test   %dl,%dl
+  8023ce:	74 18                	je     8023e8 <strchr+0x1f>
+        if (*str == c) {
+  8023d0:	0f be d2             	movsbl %dl,%edx
+  8023d3:	39 f2                	cmp    %esi,%edx
+  8023d5:	74 17                	je     8023ee <strchr+0x25>
+    for (; *str; str++) {
+  8023d7:	48 83 c7 01          	add    $0x1,%rdi
+  8023db:	0f b6 17             	movzbl (%rdi),%edx
+  8023de:	84 d2                	test   %dl,%dl
+  8023e0:	75 ee                	jne    8023d0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8023e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023e7:	c3                   	ret
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ed:	c3                   	ret
+  8023ee:	48 89 f8             	mov    %rdi,%rax
+}
+  8023f1:	c3                   	ret
+
+00000000008023f2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8023f2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8023f5:	0f b6 17             	movzbl (%rdi),%edx
+  8023f8:	84 d2                	test   %dl,%dl
+  8023fa:	74 13                	je     80240f <strfind+0x1d>
+  8023fc:	0f be d2             	movsbl %dl,%edx
+  8023ff:	39 f2                	cmp    %esi,%edx
+  802401:	74 0b                	je     80240e <strfind+0x1c>
+  802403:	48 83 c0 01          	add    $0x1,%rax
+  802407:	0f b6 10             	movzbl (%rax),%edx
+  80240a:	84 d2                	test   %dl,%dl
+  80240c:	75 ee                	jne    8023fc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80240e:	c3                   	ret
+  80240f:	c3                   	ret
+
+0000000000802410 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802410:	48 39 f7             	cmp    %rsi,%rdi
+  802413:	74 65                	je     80247a <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802415:	55                   	push   %rbp
+  802416:	48 89 e5             	mov    %rsp,%rbp
+  802419:	41 57                	push   %r15
+  80241b:	41 56                	push   %r14
+  80241d:	41 55                	push   %r13
+  80241f:	41 54                	push   %r12
+  802421:	53                   	push   %rbx
+  802422:	48 83 ec 18          	sub    $0x18,%rsp
+  802426:	48 89 fb             	mov    %rdi,%rbx
+  802429:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80242c:	49 bf 01 23 80 00 00 	movabs $0x802301,%r15
+  802433:	00 00 00 
+  802436:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80243a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80243e:	41 ff d7             	call   *%r15
+  802441:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802444:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802449:	41 0f b6 fe          	movzbl %r14b,%edi
+  80244d:	41 ff d7             	call   *%r15
+  802450:	89 c2                	mov    %eax,%edx
+  802452:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802455:	29 d0                	sub    %edx,%eax
+  802457:	75 12                	jne    80246b <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802459:	48 83 c3 01          	add    $0x1,%rbx
+  80245d:	45 84 ed             	test   %r13b,%r13b
+  802460:	74 09                	je     80246b <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802462:	49 83 c4 01          	add    $0x1,%r12
+  802466:	45 84 f6             	test   %r14b,%r14b
+  802469:	75 cb                	jne    802436 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80246b:	48 83 c4 18          	add    $0x18,%rsp
+  80246f:	5b                   	pop    %rbx
+  802470:	41 5c                	pop    %r12
+  802472:	41 5d                	pop    %r13
+  802474:	41 5e                	pop    %r14
+  802476:	41 5f                	pop    %r15
+  802478:	5d                   	pop    %rbp
+  802479:	c3                   	ret
+    if (p1 == p2) return 0;
+  80247a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80247f:	c3                   	ret
+
+0000000000802480 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802480:	48 39 f7             	cmp    %rsi,%rdi
+  802483:	74 7d                	je     802502 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802485:	55                   	push   %rbp
+  802486:	48 89 e5             	mov    %rsp,%rbp
+  802489:	41 57                	push   %r15
+  80248b:	41 56                	push   %r14
+  80248d:	41 55                	push   %r13
+  80248f:	41 54                	push   %r12
+  802491:	53                   	push   %rbx
+  802492:	48 83 ec 18          	sub    $0x18,%rsp
+  802496:	48 89 fb             	mov    %rdi,%rbx
+  802499:	49 89 f4             	mov    %rsi,%r12
+  80249c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8024a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8024a4:	49 bf 01 23 80 00 00 	movabs $0x802301,%r15
+  8024ab:	00 00 00 
+    while (n--) {
+  8024ae:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024b2:	48 39 c3             	cmp    %rax,%rbx
+  8024b5:	74 37                	je     8024ee <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8024b7:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8024bb:	41 0f b6 fd          	movzbl %r13b,%edi
+  8024bf:	41 ff d7             	call   *%r15
+  8024c2:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8024c5:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8024ca:	41 0f b6 fe          	movzbl %r14b,%edi
+  8024ce:	41 ff d7             	call   *%r15
+  8024d1:	89 c2                	mov    %eax,%edx
+  8024d3:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024d6:	29 d0                	sub    %edx,%eax
+  8024d8:	75 19                	jne    8024f3 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8024da:	48 83 c3 01          	add    $0x1,%rbx
+  8024de:	45 84 ed             	test   %r13b,%r13b
+  8024e1:	74 10                	je     8024f3 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8024e3:	49 83 c4 01          	add    $0x1,%r12
+  8024e7:	45 84 f6             	test   %r14b,%r14b
+  8024ea:	75 c2                	jne    8024ae <strncasecmp+0x2e>
+  8024ec:	eb 05                	jmp    8024f3 <strncasecmp+0x73>
+  8024ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8024f3:	48 83 c4 18          	add    $0x18,%rsp
+  8024f7:	5b                   	pop    %rbx
+  8024f8:	41 5c                	pop    %r12
+  8024fa:	41 5d                	pop    %r13
+  8024fc:	41 5e                	pop    %r14
+  8024fe:	41 5f                	pop    %r15
+  802500:	5d                   	pop    %rbp
+  802501:	c3                   	ret
+    if (p1 == p2) return 0;
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802507:	c3                   	ret
+
+0000000000802508 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802508:	83 e7 df             	and    $0xffffffdf,%edi
+  80250b:	83 ef 41             	sub    $0x41,%edi
+  80250e:	83 ff 19             	cmp    $0x19,%edi
+  802511:	0f 96 c0             	setbe  %al
+}
+  802514:	c3                   	ret
+
+0000000000802515 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802515:	83 ff 20             	cmp    $0x20,%edi
+  802518:	0f 94 c0             	sete   %al
+  80251b:	83 ff 09             	cmp    $0x9,%edi
+  80251e:	0f 94 c2             	sete   %dl
+  802521:	09 d0                	or     %edx,%eax
+}
+  802523:	c3                   	ret
+
+0000000000802524 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802524:	55                   	push   %rbp
+  802525:	48 89 e5             	mov    %rsp,%rbp
+  802528:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  80252a:	48 bf 7f 6f 80 00 00 	movabs $0x806f7f,%rdi
+  802531:	00 00 00 
+  802534:	48 b8 c9 23 80 00 00 	movabs $0x8023c9,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	48 85 c0             	test   %rax,%rax
+  802543:	0f 95 c0             	setne  %al
+}
+  802546:	5d                   	pop    %rbp
+  802547:	c3                   	ret
+
+0000000000802548 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802548:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80254b:	48 89 f8             	mov    %rdi,%rax
+  80254e:	48 f7 d8             	neg    %rax
+  802551:	83 e0 07             	and    $0x7,%eax
+  802554:	49 89 d1             	mov    %rdx,%r9
+  802557:	49 29 c1             	sub    %rax,%r9
+  80255a:	78 36                	js     802592 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80255c:	40 0f b6 c6          	movzbl %sil,%eax
+  802560:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802567:	01 01 01 
+  80256a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80256e:	40 f6 c7 07          	test   $0x7,%dil
+  802572:	75 38                	jne    8025ac <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802574:	4c 89 c9             	mov    %r9,%rcx
+  802577:	48 c1 f9 03          	sar    $0x3,%rcx
+  80257b:	74 0c                	je     802589 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80257d:	fc                   	cld
+  80257e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802581:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802585:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802589:	4d 85 c9             	test   %r9,%r9
+  80258c:	75 45                	jne    8025d3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80258e:	4c 89 c0             	mov    %r8,%rax
+  802591:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802592:	48 85 d2             	test   %rdx,%rdx
+  802595:	74 f7                	je     80258e <memset+0x46>
+  802597:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80259a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80259d:	48 83 c0 01          	add    $0x1,%rax
+  8025a1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8025a5:	48 39 c2             	cmp    %rax,%rdx
+  8025a8:	75 f3                	jne    80259d <memset+0x55>
+  8025aa:	eb e2                	jmp    80258e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8025ac:	40 f6 c7 01          	test   $0x1,%dil
+  8025b0:	74 06                	je     8025b8 <memset+0x70>
+  8025b2:	88 07                	mov    %al,(%rdi)
+  8025b4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8025b8:	40 f6 c7 02          	test   $0x2,%dil
+  8025bc:	74 07                	je     8025c5 <memset+0x7d>
+  8025be:	66 89 07             	mov    %ax,(%rdi)
+  8025c1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8025c5:	40 f6 c7 04          	test   $0x4,%dil
+  8025c9:	74 a9                	je     802574 <memset+0x2c>
+  8025cb:	89 07                	mov    %eax,(%rdi)
+  8025cd:	48 83 c7 04          	add    $0x4,%rdi
+  8025d1:	eb a1                	jmp    802574 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8025d3:	41 f6 c1 04          	test   $0x4,%r9b
+  8025d7:	74 06                	je     8025df <memset+0x97>
+  8025d9:	89 07                	mov    %eax,(%rdi)
+  8025db:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8025df:	41 f6 c1 02          	test   $0x2,%r9b
+  8025e3:	74 07                	je     8025ec <memset+0xa4>
+  8025e5:	66 89 07             	mov    %ax,(%rdi)
+  8025e8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8025ec:	41 f6 c1 01          	test   $0x1,%r9b
+  8025f0:	74 9c                	je     80258e <memset+0x46>
+  8025f2:	88 07                	mov    %al,(%rdi)
+  8025f4:	eb 98                	jmp    80258e <memset+0x46>
+
+00000000008025f6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8025f6:	48 89 f8             	mov    %rdi,%rax
+  8025f9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8025fc:	48 39 fe             	cmp    %rdi,%rsi
+  8025ff:	73 3b                	jae    80263c <memmove+0x46>
+  802601:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802605:	48 39 d7             	cmp    %rdx,%rdi
+  802608:	73 32                	jae    80263c <memmove+0x46>
+        s += n;
+        d += n;
+  80260a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80260e:	48 89 d6             	mov    %rdx,%rsi
+  802611:	48 09 fe             	or     %rdi,%rsi
+  802614:	48 09 ce             	or     %rcx,%rsi
+  802617:	40 f6 c6 07          	test   $0x7,%sil
+  80261b:	75 12                	jne    80262f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80261d:	48 83 ef 08          	sub    $0x8,%rdi
+  802621:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802625:	48 c1 e9 03          	shr    $0x3,%rcx
+  802629:	fd                   	std
+  80262a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80262d:	fc                   	cld
+  80262e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80262f:	48 83 ef 01          	sub    $0x1,%rdi
+  802633:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802637:	fd                   	std
+  802638:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80263a:	eb f1                	jmp    80262d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80263c:	48 89 f2             	mov    %rsi,%rdx
+  80263f:	48 09 c2             	or     %rax,%rdx
+  802642:	48 09 ca             	or     %rcx,%rdx
+  802645:	f6 c2 07             	test   $0x7,%dl
+  802648:	75 0c                	jne    802656 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80264a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80264e:	48 89 c7             	mov    %rax,%rdi
+  802651:	fc                   	cld
+  802652:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802655:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802656:	48 89 c7             	mov    %rax,%rdi
+  802659:	fc                   	cld
+  80265a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80265c:	c3                   	ret
+
+000000000080265d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80265d:	55                   	push   %rbp
+  80265e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802661:	48 b8 f6 25 80 00 00 	movabs $0x8025f6,%rax
+  802668:	00 00 00 
+  80266b:	ff d0                	call   *%rax
+}
+  80266d:	5d                   	pop    %rbp
+  80266e:	c3                   	ret
+
+000000000080266f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80266f:	55                   	push   %rbp
+  802670:	48 89 e5             	mov    %rsp,%rbp
+  802673:	41 57                	push   %r15
+  802675:	41 56                	push   %r14
+  802677:	41 55                	push   %r13
+  802679:	41 54                	push   %r12
+  80267b:	53                   	push   %rbx
+  80267c:	48 83 ec 08          	sub    $0x8,%rsp
+  802680:	49 89 fe             	mov    %rdi,%r14
+  802683:	49 89 f7             	mov    %rsi,%r15
+  802686:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802689:	48 89 f7             	mov    %rsi,%rdi
+  80268c:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  802693:	00 00 00 
+  802696:	ff d0                	call   *%rax
+  802698:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80269b:	48 89 de             	mov    %rbx,%rsi
+  80269e:	4c 89 f7             	mov    %r14,%rdi
+  8026a1:	48 b8 83 22 80 00 00 	movabs $0x802283,%rax
+  8026a8:	00 00 00 
+  8026ab:	ff d0                	call   *%rax
+  8026ad:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8026b0:	48 39 c3             	cmp    %rax,%rbx
+  8026b3:	74 36                	je     8026eb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8026b5:	48 89 d8             	mov    %rbx,%rax
+  8026b8:	4c 29 e8             	sub    %r13,%rax
+  8026bb:	49 39 c4             	cmp    %rax,%r12
+  8026be:	73 31                	jae    8026f1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8026c0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8026c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8026c9:	4c 89 fe             	mov    %r15,%rsi
+  8026cc:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  8026d3:	00 00 00 
+  8026d6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8026d8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8026dc:	48 83 c4 08          	add    $0x8,%rsp
+  8026e0:	5b                   	pop    %rbx
+  8026e1:	41 5c                	pop    %r12
+  8026e3:	41 5d                	pop    %r13
+  8026e5:	41 5e                	pop    %r14
+  8026e7:	41 5f                	pop    %r15
+  8026e9:	5d                   	pop    %rbp
+  8026ea:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8026eb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8026ef:	eb eb                	jmp    8026dc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8026f1:	48 83 eb 01          	sub    $0x1,%rbx
+  8026f5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8026f9:	48 89 da             	mov    %rbx,%rdx
+  8026fc:	4c 89 fe             	mov    %r15,%rsi
+  8026ff:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80270b:	49 01 de             	add    %rbx,%r14
+  80270e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802713:	eb c3                	jmp    8026d8 <strlcat+0x69>
+
+0000000000802715 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802715:	48 85 d2             	test   %rdx,%rdx
+  802718:	74 2d                	je     802747 <memcmp+0x32>
+  80271a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80271f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802723:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802728:	44 38 c1             	cmp    %r8b,%cl
+  80272b:	75 0f                	jne    80273c <memcmp+0x27>
+    while (n-- > 0) {
+  80272d:	48 83 c0 01          	add    $0x1,%rax
+  802731:	48 39 c2             	cmp    %rax,%rdx
+  802734:	75 e9                	jne    80271f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80273c:	0f b6 c1             	movzbl %cl,%eax
+  80273f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802743:	44 29 c0             	sub    %r8d,%eax
+  802746:	c3                   	ret
+    return 0;
+  802747:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80274c:	c3                   	ret
+
+000000000080274d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80274d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802751:	48 39 c7             	cmp    %rax,%rdi
+  802754:	73 0f                	jae    802765 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802756:	40 38 37             	cmp    %sil,(%rdi)
+  802759:	74 0e                	je     802769 <memfind+0x1c>
+    for (; src < end; src++) {
+  80275b:	48 83 c7 01          	add    $0x1,%rdi
+  80275f:	48 39 f8             	cmp    %rdi,%rax
+  802762:	75 f2                	jne    802756 <memfind+0x9>
+  802764:	c3                   	ret
+  802765:	48 89 f8             	mov    %rdi,%rax
+  802768:	c3                   	ret
+  802769:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80276c:	c3                   	ret
+
+000000000080276d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80276d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802770:	0f b6 37             	movzbl (%rdi),%esi
+  802773:	40 80 fe 20          	cmp    $0x20,%sil
+  802777:	74 06                	je     80277f <strtol+0x12>
+  802779:	40 80 fe 09          	cmp    $0x9,%sil
+  80277d:	75 13                	jne    802792 <strtol+0x25>
+  80277f:	48 83 c7 01          	add    $0x1,%rdi
+  802783:	0f b6 37             	movzbl (%rdi),%esi
+  802786:	40 80 fe 20          	cmp    $0x20,%sil
+  80278a:	74 f3                	je     80277f <strtol+0x12>
+  80278c:	40 80 fe 09          	cmp    $0x9,%sil
+  802790:	74 ed                	je     80277f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802792:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802795:	83 e0 fd             	and    $0xfffffffd,%eax
+  802798:	3c 01                	cmp    $0x1,%al
+  80279a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80279e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8027a4:	75 0f                	jne    8027b5 <strtol+0x48>
+  8027a6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8027a9:	74 14                	je     8027bf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8027ab:	85 d2                	test   %edx,%edx
+  8027ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8027b2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8027b5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8027ba:	4c 63 ca             	movslq %edx,%r9
+  8027bd:	eb 36                	jmp    8027f5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8027bf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8027c3:	74 0f                	je     8027d4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8027c5:	85 d2                	test   %edx,%edx
+  8027c7:	75 ec                	jne    8027b5 <strtol+0x48>
+        s++;
+  8027c9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8027cd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8027d2:	eb e1                	jmp    8027b5 <strtol+0x48>
+        s += 2;
+  8027d4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8027d8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8027dd:	eb d6                	jmp    8027b5 <strtol+0x48>
+            dig -= '0';
+  8027df:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8027e2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8027e6:	41 39 d0             	cmp    %edx,%r8d
+  8027e9:	7d 21                	jge    80280c <strtol+0x9f>
+        val = val * base + dig;
+  8027eb:	49 0f af c1          	imul   %r9,%rax
+  8027ef:	0f b6 c9             	movzbl %cl,%ecx
+  8027f2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8027f5:	48 83 c7 01          	add    $0x1,%rdi
+  8027f9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8027fd:	80 f9 39             	cmp    $0x39,%cl
+  802800:	76 dd                	jbe    8027df <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802802:	80 f9 7b             	cmp    $0x7b,%cl
+  802805:	77 05                	ja     80280c <strtol+0x9f>
+            dig -= 'a' - 10;
+  802807:	83 e9 57             	sub    $0x57,%ecx
+  80280a:	eb d6                	jmp    8027e2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80280c:	4d 85 d2             	test   %r10,%r10
+  80280f:	74 03                	je     802814 <strtol+0xa7>
+  802811:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802814:	48 89 c2             	mov    %rax,%rdx
+  802817:	48 f7 da             	neg    %rdx
+  80281a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80281e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802822:	c3                   	ret
+
+0000000000802823 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802823:	55                   	push   %rbp
+  802824:	48 89 e5             	mov    %rsp,%rbp
+  802827:	53                   	push   %rbx
+  802828:	48 89 fa             	mov    %rdi,%rdx
+  80282b:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80282e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802833:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802838:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80283d:	be 00 00 00 00       	mov    $0x0,%esi
+  802842:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802848:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80284e:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802850:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802854:	c9                   	leave
+  802855:	c3                   	ret
+
+0000000000802856 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802856:	55                   	push   %rbp
+  802857:	48 89 e5             	mov    %rsp,%rbp
+  80285a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80285b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802860:	ba 00 00 00 00       	mov    $0x0,%edx
+  802865:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80286a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80286f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802874:	be 00 00 00 00       	mov    $0x0,%esi
+  802879:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80287f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802885:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802887:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80288b:	c9                   	leave
+  80288c:	c3                   	ret
+
+000000000080288d <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80288d:	55                   	push   %rbp
+  80288e:	48 89 e5             	mov    %rsp,%rbp
+  802891:	53                   	push   %rbx
+  802892:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802895:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80289a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ba:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  8028bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+
+00000000008028c2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8028c2:	55                   	push   %rbp
+  8028c3:	48 89 e5             	mov    %rsp,%rbp
+  8028c6:	53                   	push   %rbx
+  8028c7:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  8028cb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028ce:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028dd:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028f3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028f5:	48 85 c0             	test   %rax,%rax
+  8028f8:	7f 06                	jg     802900 <sys_env_destroy+0x3e>
+}
+  8028fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802900:	49 89 c0             	mov    %rax,%r8
+  802903:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802908:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  80290f:	00 00 00 
+  802912:	be 27 00 00 00       	mov    $0x27,%esi
+  802917:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  80291e:	00 00 00 
+  802921:	b8 00 00 00 00       	mov    $0x0,%eax
+  802926:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  80292d:	00 00 00 
+  802930:	41 ff d1             	call   *%r9
+
+0000000000802933 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802933:	55                   	push   %rbp
+  802934:	48 89 e5             	mov    %rsp,%rbp
+  802937:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802938:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80293d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802942:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802947:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80294c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802951:	be 00 00 00 00       	mov    $0x0,%esi
+  802956:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80295c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802962:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802964:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802968:	c9                   	leave
+  802969:	c3                   	ret
+
+000000000080296a <sys_yield>:
+
+void
+sys_yield(void) {
+  80296a:	55                   	push   %rbp
+  80296b:	48 89 e5             	mov    %rsp,%rbp
+  80296e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80296f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802974:	ba 00 00 00 00       	mov    $0x0,%edx
+  802979:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80297e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802983:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802988:	be 00 00 00 00       	mov    $0x0,%esi
+  80298d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802993:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802999:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80299b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80299f:	c9                   	leave
+  8029a0:	c3                   	ret
+
+00000000008029a1 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  8029a1:	55                   	push   %rbp
+  8029a2:	48 89 e5             	mov    %rsp,%rbp
+  8029a5:	53                   	push   %rbx
+  8029a6:	48 89 fa             	mov    %rdi,%rdx
+  8029a9:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8029ac:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029b1:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  8029b8:	00 00 00 
+  8029bb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029d1:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8029d3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029d7:	c9                   	leave
+  8029d8:	c3                   	ret
+
+00000000008029d9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8029d9:	55                   	push   %rbp
+  8029da:	48 89 e5             	mov    %rsp,%rbp
+  8029dd:	53                   	push   %rbx
+  8029de:	49 89 f8             	mov    %rdi,%r8
+  8029e1:	48 89 d3             	mov    %rdx,%rbx
+  8029e4:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8029e7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029ec:	4c 89 c2             	mov    %r8,%rdx
+  8029ef:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a03:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802a05:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+
+0000000000802a0b <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802a0b:	55                   	push   %rbp
+  802a0c:	48 89 e5             	mov    %rsp,%rbp
+  802a0f:	53                   	push   %rbx
+  802a10:	48 83 ec 08          	sub    $0x8,%rsp
+  802a14:	89 f8                	mov    %edi,%eax
+  802a16:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802a19:	48 63 f9             	movslq %ecx,%rdi
+  802a1c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a1f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a24:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a27:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a38:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a3a:	48 85 c0             	test   %rax,%rax
+  802a3d:	7f 06                	jg     802a45 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802a3f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a43:	c9                   	leave
+  802a44:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a45:	49 89 c0             	mov    %rax,%r8
+  802a48:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802a4d:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802a54:	00 00 00 
+  802a57:	be 27 00 00 00       	mov    $0x27,%esi
+  802a5c:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802a63:	00 00 00 
+  802a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6b:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802a72:	00 00 00 
+  802a75:	41 ff d1             	call   *%r9
+
+0000000000802a78 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802a78:	55                   	push   %rbp
+  802a79:	48 89 e5             	mov    %rsp,%rbp
+  802a7c:	53                   	push   %rbx
+  802a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  802a81:	89 f8                	mov    %edi,%eax
+  802a83:	49 89 f2             	mov    %rsi,%r10
+  802a86:	48 89 cf             	mov    %rcx,%rdi
+  802a89:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802a8c:	48 63 da             	movslq %edx,%rbx
+  802a8f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a92:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a97:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a9a:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802a9d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa3:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aa5:	48 85 c0             	test   %rax,%rax
+  802aa8:	7f 06                	jg     802ab0 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802aaa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aae:	c9                   	leave
+  802aaf:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ab0:	49 89 c0             	mov    %rax,%r8
+  802ab3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802ab8:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802abf:	00 00 00 
+  802ac2:	be 27 00 00 00       	mov    $0x27,%esi
+  802ac7:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802ace:	00 00 00 
+  802ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad6:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802add:	00 00 00 
+  802ae0:	41 ff d1             	call   *%r9
+
+0000000000802ae3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+  802ae7:	53                   	push   %rbx
+  802ae8:	48 83 ec 08          	sub    $0x8,%rsp
+  802aec:	48 89 f1             	mov    %rsi,%rcx
+  802aef:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802af2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802af5:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802afa:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802aff:	be 00 00 00 00       	mov    $0x0,%esi
+  802b04:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b0a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b12:	48 85 c0             	test   %rax,%rax
+  802b15:	7f 06                	jg     802b1d <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802b17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b1d:	49 89 c0             	mov    %rax,%r8
+  802b20:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b25:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802b2c:	00 00 00 
+  802b2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802b34:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802b3b:	00 00 00 
+  802b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b43:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802b4a:	00 00 00 
+  802b4d:	41 ff d1             	call   *%r9
+
+0000000000802b50 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802b50:	55                   	push   %rbp
+  802b51:	48 89 e5             	mov    %rsp,%rbp
+  802b54:	53                   	push   %rbx
+  802b55:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802b59:	48 63 ce             	movslq %esi,%rcx
+  802b5c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b5f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b69:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b6e:	be 00 00 00 00       	mov    $0x0,%esi
+  802b73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b7f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b81:	48 85 c0             	test   %rax,%rax
+  802b84:	7f 06                	jg     802b8c <sys_env_set_status+0x3c>
+}
+  802b86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b8c:	49 89 c0             	mov    %rax,%r8
+  802b8f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802b94:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802b9b:	00 00 00 
+  802b9e:	be 27 00 00 00       	mov    $0x27,%esi
+  802ba3:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802baa:	00 00 00 
+  802bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb2:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802bb9:	00 00 00 
+  802bbc:	41 ff d1             	call   *%r9
+
+0000000000802bbf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+  802bc3:	53                   	push   %rbx
+  802bc4:	48 83 ec 08          	sub    $0x8,%rsp
+  802bc8:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802bcb:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bce:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bdd:	be 00 00 00 00       	mov    $0x0,%esi
+  802be2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802be8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802bf0:	48 85 c0             	test   %rax,%rax
+  802bf3:	7f 06                	jg     802bfb <sys_env_set_trapframe+0x3c>
+}
+  802bf5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf9:	c9                   	leave
+  802bfa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bfb:	49 89 c0             	mov    %rax,%r8
+  802bfe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802c03:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802c0a:	00 00 00 
+  802c0d:	be 27 00 00 00       	mov    $0x27,%esi
+  802c12:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802c19:	00 00 00 
+  802c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c21:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802c28:	00 00 00 
+  802c2b:	41 ff d1             	call   *%r9
+
+0000000000802c2e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802c2e:	55                   	push   %rbp
+  802c2f:	48 89 e5             	mov    %rsp,%rbp
+  802c32:	53                   	push   %rbx
+  802c33:	48 83 ec 08          	sub    $0x8,%rsp
+  802c37:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802c3a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c3d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c47:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802c51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c5d:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c5f:	48 85 c0             	test   %rax,%rax
+  802c62:	7f 06                	jg     802c6a <sys_env_set_pgfault_upcall+0x3c>
+}
+  802c64:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c6a:	49 89 c0             	mov    %rax,%r8
+  802c6d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802c72:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802c79:	00 00 00 
+  802c7c:	be 27 00 00 00       	mov    $0x27,%esi
+  802c81:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802c88:	00 00 00 
+  802c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c90:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802c97:	00 00 00 
+  802c9a:	41 ff d1             	call   *%r9
+
+0000000000802c9d <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802c9d:	55                   	push   %rbp
+  802c9e:	48 89 e5             	mov    %rsp,%rbp
+  802ca1:	53                   	push   %rbx
+  802ca2:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802ca6:	40 0f b6 ce          	movzbl %sil,%ecx
+  802caa:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cad:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802cb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cc7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ccd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ccf:	48 85 c0             	test   %rax,%rax
+  802cd2:	7f 06                	jg     802cda <sys_env_set_reclaim+0x3d>
+}
+  802cd4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cda:	49 89 c0             	mov    %rax,%r8
+  802cdd:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ce2:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802ce9:	00 00 00 
+  802cec:	be 27 00 00 00       	mov    $0x27,%esi
+  802cf1:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802cf8:	00 00 00 
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802d07:	00 00 00 
+  802d0a:	41 ff d1             	call   *%r9
+
+0000000000802d0d <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802d0d:	55                   	push   %rbp
+  802d0e:	48 89 e5             	mov    %rsp,%rbp
+  802d11:	53                   	push   %rbx
+  802d12:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802d16:	48 63 ce             	movslq %esi,%rcx
+  802d19:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d1c:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d26:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d30:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d36:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d3c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d3e:	48 85 c0             	test   %rax,%rax
+  802d41:	7f 06                	jg     802d49 <sys_env_set_nice+0x3c>
+}
+  802d43:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d47:	c9                   	leave
+  802d48:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d49:	49 89 c0             	mov    %rax,%r8
+  802d4c:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802d51:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802d58:	00 00 00 
+  802d5b:	be 27 00 00 00       	mov    $0x27,%esi
+  802d60:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802d67:	00 00 00 
+  802d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6f:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802d76:	00 00 00 
+  802d79:	41 ff d1             	call   *%r9
+
+0000000000802d7c <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802d7c:	55                   	push   %rbp
+  802d7d:	48 89 e5             	mov    %rsp,%rbp
+  802d80:	53                   	push   %rbx
+  802d81:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d84:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d89:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d93:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d98:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802da3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da9:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802dab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802daf:	c9                   	leave
+  802db0:	c3                   	ret
+
+0000000000802db1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802db1:	55                   	push   %rbp
+  802db2:	48 89 e5             	mov    %rsp,%rbp
+  802db5:	53                   	push   %rbx
+  802db6:	89 f8                	mov    %edi,%eax
+  802db8:	49 89 f1             	mov    %rsi,%r9
+  802dbb:	48 89 d3             	mov    %rdx,%rbx
+  802dbe:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802dc1:	49 63 f0             	movslq %r8d,%rsi
+  802dc4:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dc7:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dcc:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dcf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ddb:	cd 30                	int    $0x30
+}
+  802ddd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de1:	c9                   	leave
+  802de2:	c3                   	ret
+
+0000000000802de3 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802de3:	55                   	push   %rbp
+  802de4:	48 89 e5             	mov    %rsp,%rbp
+  802de7:	53                   	push   %rbx
+  802de8:	89 f8                	mov    %edi,%eax
+  802dea:	49 89 f1             	mov    %rsi,%r9
+  802ded:	48 89 d3             	mov    %rdx,%rbx
+  802df0:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802df3:	49 63 f0             	movslq %r8d,%rsi
+  802df6:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802df9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dfe:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e0d:	cd 30                	int    $0x30
+}
+  802e0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e13:	c9                   	leave
+  802e14:	c3                   	ret
+
+0000000000802e15 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e15:	55                   	push   %rbp
+  802e16:	48 89 e5             	mov    %rsp,%rbp
+  802e19:	53                   	push   %rbx
+  802e1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e1e:	89 f8                	mov    %edi,%eax
+  802e20:	49 89 f2             	mov    %rsi,%r10
+  802e23:	48 89 d3             	mov    %rdx,%rbx
+  802e26:	48 89 cf             	mov    %rcx,%rdi
+  802e29:	44 89 c6             	mov    %r8d,%esi
+  802e2c:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e2f:	48 63 f6             	movslq %esi,%rsi
+  802e32:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e35:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e3a:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802e3d:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802e41:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e43:	48 85 c0             	test   %rax,%rax
+  802e46:	7f 06                	jg     802e4e <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802e48:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e4c:	c9                   	leave
+  802e4d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e4e:	49 89 c0             	mov    %rax,%r8
+  802e51:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802e56:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802e5d:	00 00 00 
+  802e60:	be 27 00 00 00       	mov    $0x27,%esi
+  802e65:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802e6c:	00 00 00 
+  802e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e74:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802e7b:	00 00 00 
+  802e7e:	41 ff d1             	call   *%r9
+
+0000000000802e81 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802e81:	55                   	push   %rbp
+  802e82:	48 89 e5             	mov    %rsp,%rbp
+  802e85:	53                   	push   %rbx
+  802e86:	48 83 ec 08          	sub    $0x8,%rsp
+  802e8a:	48 89 f1             	mov    %rsi,%rcx
+  802e8d:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802e90:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802e94:	48 8b 1a             	mov    (%rdx),%rbx
+  802e97:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e9f:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ea3:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802ea7:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802eab:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ead:	48 85 c0             	test   %rax,%rax
+  802eb0:	7f 06                	jg     802eb8 <sys_ipc_call_short+0x37>
+}
+  802eb2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb6:	c9                   	leave
+  802eb7:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802eb8:	49 89 c0             	mov    %rax,%r8
+  802ebb:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802ec0:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802ec7:	00 00 00 
+  802eca:	be 27 00 00 00       	mov    $0x27,%esi
+  802ecf:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802ed6:	00 00 00 
+  802ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ede:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802ee5:	00 00 00 
+  802ee8:	41 ff d1             	call   *%r9
+
+0000000000802eeb <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802eeb:	55                   	push   %rbp
+  802eec:	48 89 e5             	mov    %rsp,%rbp
+  802eef:	53                   	push   %rbx
+  802ef0:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef4:	89 f8                	mov    %edi,%eax
+  802ef6:	49 89 f2             	mov    %rsi,%r10
+  802ef9:	48 89 d3             	mov    %rdx,%rbx
+  802efc:	48 89 cf             	mov    %rcx,%rdi
+  802eff:	44 89 c6             	mov    %r8d,%esi
+  802f02:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f05:	48 63 f6             	movslq %esi,%rsi
+  802f08:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f0b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f10:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f13:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f17:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f19:	48 85 c0             	test   %rax,%rax
+  802f1c:	7f 06                	jg     802f24 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f22:	c9                   	leave
+  802f23:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f24:	49 89 c0             	mov    %rax,%r8
+  802f27:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802f2c:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802f33:	00 00 00 
+  802f36:	be 27 00 00 00       	mov    $0x27,%esi
+  802f3b:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802f42:	00 00 00 
+  802f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4a:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802f51:	00 00 00 
+  802f54:	41 ff d1             	call   *%r9
+
+0000000000802f57 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802f57:	55                   	push   %rbp
+  802f58:	48 89 e5             	mov    %rsp,%rbp
+  802f5b:	53                   	push   %rbx
+  802f5c:	48 83 ec 08          	sub    $0x8,%rsp
+  802f60:	48 89 fa             	mov    %rdi,%rdx
+  802f63:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802f66:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f70:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f75:	be 00 00 00 00       	mov    $0x0,%esi
+  802f7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f86:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f88:	48 85 c0             	test   %rax,%rax
+  802f8b:	7f 06                	jg     802f93 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f8d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f91:	c9                   	leave
+  802f92:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f93:	49 89 c0             	mov    %rax,%r8
+  802f96:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802f9b:	48 ba 88 6f 80 00 00 	movabs $0x806f88,%rdx
+  802fa2:	00 00 00 
+  802fa5:	be 27 00 00 00       	mov    $0x27,%esi
+  802faa:	48 bf a7 6f 80 00 00 	movabs $0x806fa7,%rdi
+  802fb1:	00 00 00 
+  802fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb9:	49 b9 1f 18 80 00 00 	movabs $0x80181f,%r9
+  802fc0:	00 00 00 
+  802fc3:	41 ff d1             	call   *%r9
+
+0000000000802fc6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802fc6:	55                   	push   %rbp
+  802fc7:	48 89 e5             	mov    %rsp,%rbp
+  802fca:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802fcb:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ff5:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ff7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ffb:	c9                   	leave
+  802ffc:	c3                   	ret
+
+0000000000802ffd <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802ffd:	55                   	push   %rbp
+  802ffe:	48 89 e5             	mov    %rsp,%rbp
+  803001:	53                   	push   %rbx
+  803002:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803005:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80300a:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80300f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803014:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803019:	be 00 00 00 00       	mov    $0x0,%esi
+  80301e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803024:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80302a:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80302c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803030:	c9                   	leave
+  803031:	c3                   	ret
+
+0000000000803032 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803032:	55                   	push   %rbp
+  803033:	48 89 e5             	mov    %rsp,%rbp
+  803036:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803037:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80303c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803041:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80304b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803050:	be 00 00 00 00       	mov    $0x0,%esi
+  803055:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80305b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803061:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803063:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803067:	c9                   	leave
+  803068:	c3                   	ret
+
+0000000000803069 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  803069:	55                   	push   %rbp
+  80306a:	48 89 e5             	mov    %rsp,%rbp
+  80306d:	53                   	push   %rbx
+  80306e:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803072:	b8 08 00 00 00       	mov    $0x8,%eax
+  803077:	cd 30                	int    $0x30
+  803079:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  80307b:	85 c0                	test   %eax,%eax
+  80307d:	0f 88 85 00 00 00    	js     803108 <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  803083:	0f 84 ac 00 00 00    	je     803135 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  803089:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80308f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  803096:	00 00 00 
+  803099:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80309e:	89 c2                	mov    %eax,%edx
+  8030a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030aa:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  8030b1:	00 00 00 
+  8030b4:	ff d0                	call   *%rax
+  8030b6:	85 c0                	test   %eax,%eax
+  8030b8:	0f 88 a8 00 00 00    	js     803166 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8030be:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8030c5:	00 00 00 
+  8030c8:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8030cf:	89 df                	mov    %ebx,%edi
+  8030d1:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  8030d8:	00 00 00 
+  8030db:	ff d0                	call   *%rax
+  8030dd:	85 c0                	test   %eax,%eax
+  8030df:	0f 88 ae 00 00 00    	js     803193 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  8030e5:	be 02 00 00 00       	mov    $0x2,%esi
+  8030ea:	89 df                	mov    %ebx,%edi
+  8030ec:	48 b8 50 2b 80 00 00 	movabs $0x802b50,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	0f 88 c0 00 00 00    	js     8031c0 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803100:	89 d8                	mov    %ebx,%eax
+  803102:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803106:	c9                   	leave
+  803107:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  803108:	89 c1                	mov    %eax,%ecx
+  80310a:	48 ba b5 6f 80 00 00 	movabs $0x806fb5,%rdx
+  803111:	00 00 00 
+  803114:	be 20 00 00 00       	mov    $0x20,%esi
+  803119:	48 bf c5 6f 80 00 00 	movabs $0x806fc5,%rdi
+  803120:	00 00 00 
+  803123:	b8 00 00 00 00       	mov    $0x0,%eax
+  803128:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  80312f:	00 00 00 
+  803132:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803135:	48 b8 33 29 80 00 00 	movabs $0x802933,%rax
+  80313c:	00 00 00 
+  80313f:	ff d0                	call   *%rax
+  803141:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803146:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80314d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803154:	00 00 00 
+  803157:	48 01 d0             	add    %rdx,%rax
+  80315a:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  803161:	00 00 00 
+        return 0;
+  803164:	eb 9a                	jmp    803100 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803166:	89 c1                	mov    %eax,%ecx
+  803168:	48 ba d0 6f 80 00 00 	movabs $0x806fd0,%rdx
+  80316f:	00 00 00 
+  803172:	be 2e 00 00 00       	mov    $0x2e,%esi
+  803177:	48 bf c5 6f 80 00 00 	movabs $0x806fc5,%rdi
+  80317e:	00 00 00 
+  803181:	b8 00 00 00 00       	mov    $0x0,%eax
+  803186:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  80318d:	00 00 00 
+  803190:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  803193:	89 c1                	mov    %eax,%ecx
+  803195:	48 ba 18 70 80 00 00 	movabs $0x807018,%rdx
+  80319c:	00 00 00 
+  80319f:	be 32 00 00 00       	mov    $0x32,%esi
+  8031a4:	48 bf c5 6f 80 00 00 	movabs $0x806fc5,%rdi
+  8031ab:	00 00 00 
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b3:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8031ba:	00 00 00 
+  8031bd:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8031c0:	89 c1                	mov    %eax,%ecx
+  8031c2:	48 ba e3 6f 80 00 00 	movabs $0x806fe3,%rdx
+  8031c9:	00 00 00 
+  8031cc:	be 37 00 00 00       	mov    $0x37,%esi
+  8031d1:	48 bf c5 6f 80 00 00 	movabs $0x806fc5,%rdi
+  8031d8:	00 00 00 
+  8031db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031e0:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8031e7:	00 00 00 
+  8031ea:	41 ff d0             	call   *%r8
+
+00000000008031ed <sfork>:
+
+envid_t
+sfork() {
+  8031ed:	55                   	push   %rbp
+  8031ee:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8031f1:	48 ba fa 6f 80 00 00 	movabs $0x806ffa,%rdx
+  8031f8:	00 00 00 
+  8031fb:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803200:	48 bf c5 6f 80 00 00 	movabs $0x806fc5,%rdi
+  803207:	00 00 00 
+  80320a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320f:	48 b9 1f 18 80 00 00 	movabs $0x80181f,%rcx
+  803216:	00 00 00 
+  803219:	ff d1                	call   *%rcx
+
+000000000080321b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80321b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803222:	ff ff ff 
+  803225:	48 01 f8             	add    %rdi,%rax
+  803228:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80322c:	c3                   	ret
+
+000000000080322d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80322d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803234:	ff ff ff 
+  803237:	48 01 f8             	add    %rdi,%rax
+  80323a:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80323e:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803244:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  803248:	c3                   	ret
+
+0000000000803249 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  803249:	55                   	push   %rbp
+  80324a:	48 89 e5             	mov    %rsp,%rbp
+  80324d:	41 57                	push   %r15
+  80324f:	41 56                	push   %r14
+  803251:	41 55                	push   %r13
+  803253:	41 54                	push   %r12
+  803255:	53                   	push   %rbx
+  803256:	48 83 ec 08          	sub    $0x8,%rsp
+  80325a:	49 89 ff             	mov    %rdi,%r15
+  80325d:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803262:	49 bd dd 50 80 00 00 	movabs $0x8050dd,%r13
+  803269:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80326c:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803272:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803275:	48 89 df             	mov    %rbx,%rdi
+  803278:	41 ff d5             	call   *%r13
+  80327b:	83 e0 04             	and    $0x4,%eax
+  80327e:	74 17                	je     803297 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803280:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803287:	4c 39 f3             	cmp    %r14,%rbx
+  80328a:	75 e6                	jne    803272 <fd_alloc+0x29>
+  80328c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803292:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  803297:	4d 89 27             	mov    %r12,(%r15)
+}
+  80329a:	48 83 c4 08          	add    $0x8,%rsp
+  80329e:	5b                   	pop    %rbx
+  80329f:	41 5c                	pop    %r12
+  8032a1:	41 5d                	pop    %r13
+  8032a3:	41 5e                	pop    %r14
+  8032a5:	41 5f                	pop    %r15
+  8032a7:	5d                   	pop    %rbp
+  8032a8:	c3                   	ret
+
+00000000008032a9 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8032a9:	83 ff 1f             	cmp    $0x1f,%edi
+  8032ac:	77 39                	ja     8032e7 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8032ae:	55                   	push   %rbp
+  8032af:	48 89 e5             	mov    %rsp,%rbp
+  8032b2:	41 54                	push   %r12
+  8032b4:	53                   	push   %rbx
+  8032b5:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8032b8:	48 63 df             	movslq %edi,%rbx
+  8032bb:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8032c2:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8032c6:	48 89 df             	mov    %rbx,%rdi
+  8032c9:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+  8032d5:	a8 04                	test   $0x4,%al
+  8032d7:	74 14                	je     8032ed <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8032d9:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8032dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e2:	5b                   	pop    %rbx
+  8032e3:	41 5c                	pop    %r12
+  8032e5:	5d                   	pop    %rbp
+  8032e6:	c3                   	ret
+        return -E_INVAL;
+  8032e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8032ec:	c3                   	ret
+        return -E_INVAL;
+  8032ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032f2:	eb ee                	jmp    8032e2 <fd_lookup+0x39>
+
+00000000008032f4 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8032f4:	55                   	push   %rbp
+  8032f5:	48 89 e5             	mov    %rsp,%rbp
+  8032f8:	41 54                	push   %r12
+  8032fa:	53                   	push   %rbx
+  8032fb:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8032fe:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  803305:	00 00 00 
+  803308:	48 bb 60 80 80 00 00 	movabs $0x808060,%rbx
+  80330f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803312:	39 3b                	cmp    %edi,(%rbx)
+  803314:	74 47                	je     80335d <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803316:	48 83 c0 08          	add    $0x8,%rax
+  80331a:	48 8b 18             	mov    (%rax),%rbx
+  80331d:	48 85 db             	test   %rbx,%rbx
+  803320:	75 f0                	jne    803312 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803322:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803329:	00 00 00 
+  80332c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803332:	89 fa                	mov    %edi,%edx
+  803334:	48 bf 38 70 80 00 00 	movabs $0x807038,%rdi
+  80333b:	00 00 00 
+  80333e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803343:	48 b9 6f 19 80 00 00 	movabs $0x80196f,%rcx
+  80334a:	00 00 00 
+  80334d:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80334f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803354:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  803358:	5b                   	pop    %rbx
+  803359:	41 5c                	pop    %r12
+  80335b:	5d                   	pop    %rbp
+  80335c:	c3                   	ret
+            return 0;
+  80335d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803362:	eb f0                	jmp    803354 <dev_lookup+0x60>
+
+0000000000803364 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803364:	55                   	push   %rbp
+  803365:	48 89 e5             	mov    %rsp,%rbp
+  803368:	41 55                	push   %r13
+  80336a:	41 54                	push   %r12
+  80336c:	53                   	push   %rbx
+  80336d:	48 83 ec 18          	sub    $0x18,%rsp
+  803371:	48 89 fb             	mov    %rdi,%rbx
+  803374:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803377:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80337e:	ff ff ff 
+  803381:	48 01 df             	add    %rbx,%rdi
+  803384:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  803388:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80338c:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803393:	00 00 00 
+  803396:	ff d0                	call   *%rax
+  803398:	41 89 c5             	mov    %eax,%r13d
+  80339b:	85 c0                	test   %eax,%eax
+  80339d:	78 06                	js     8033a5 <fd_close+0x41>
+  80339f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8033a3:	74 1a                	je     8033bf <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8033a5:	45 84 e4             	test   %r12b,%r12b
+  8033a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ad:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8033b1:	44 89 e8             	mov    %r13d,%eax
+  8033b4:	48 83 c4 18          	add    $0x18,%rsp
+  8033b8:	5b                   	pop    %rbx
+  8033b9:	41 5c                	pop    %r12
+  8033bb:	41 5d                	pop    %r13
+  8033bd:	5d                   	pop    %rbp
+  8033be:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8033bf:	8b 3b                	mov    (%rbx),%edi
+  8033c1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8033c5:	48 b8 f4 32 80 00 00 	movabs $0x8032f4,%rax
+  8033cc:	00 00 00 
+  8033cf:	ff d0                	call   *%rax
+  8033d1:	41 89 c5             	mov    %eax,%r13d
+  8033d4:	85 c0                	test   %eax,%eax
+  8033d6:	78 1b                	js     8033f3 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8033d8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8033dc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8033e0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8033e6:	48 85 c0             	test   %rax,%rax
+  8033e9:	74 08                	je     8033f3 <fd_close+0x8f>
+  8033eb:	48 89 df             	mov    %rbx,%rdi
+  8033ee:	ff d0                	call   *%rax
+  8033f0:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8033f3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f8:	48 89 de             	mov    %rbx,%rsi
+  8033fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803400:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  803407:	00 00 00 
+  80340a:	ff d0                	call   *%rax
+    return res;
+  80340c:	eb a3                	jmp    8033b1 <fd_close+0x4d>
+
+000000000080340e <close>:
+
+int
+close(int fdnum) {
+  80340e:	55                   	push   %rbp
+  80340f:	48 89 e5             	mov    %rsp,%rbp
+  803412:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803416:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80341a:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803421:	00 00 00 
+  803424:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803426:	85 c0                	test   %eax,%eax
+  803428:	78 15                	js     80343f <close+0x31>
+
+    return fd_close(fd, 1);
+  80342a:	be 01 00 00 00       	mov    $0x1,%esi
+  80342f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803433:	48 b8 64 33 80 00 00 	movabs $0x803364,%rax
+  80343a:	00 00 00 
+  80343d:	ff d0                	call   *%rax
+}
+  80343f:	c9                   	leave
+  803440:	c3                   	ret
+
+0000000000803441 <close_all>:
+
+void
+close_all(void) {
+  803441:	55                   	push   %rbp
+  803442:	48 89 e5             	mov    %rsp,%rbp
+  803445:	41 54                	push   %r12
+  803447:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803448:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80344d:	49 bc 0e 34 80 00 00 	movabs $0x80340e,%r12
+  803454:	00 00 00 
+  803457:	89 df                	mov    %ebx,%edi
+  803459:	41 ff d4             	call   *%r12
+  80345c:	83 c3 01             	add    $0x1,%ebx
+  80345f:	83 fb 20             	cmp    $0x20,%ebx
+  803462:	75 f3                	jne    803457 <close_all+0x16>
+}
+  803464:	5b                   	pop    %rbx
+  803465:	41 5c                	pop    %r12
+  803467:	5d                   	pop    %rbp
+  803468:	c3                   	ret
+
+0000000000803469 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803469:	55                   	push   %rbp
+  80346a:	48 89 e5             	mov    %rsp,%rbp
+  80346d:	41 57                	push   %r15
+  80346f:	41 56                	push   %r14
+  803471:	41 55                	push   %r13
+  803473:	41 54                	push   %r12
+  803475:	53                   	push   %rbx
+  803476:	48 83 ec 18          	sub    $0x18,%rsp
+  80347a:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80347d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803481:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803488:	00 00 00 
+  80348b:	ff d0                	call   *%rax
+  80348d:	89 c3                	mov    %eax,%ebx
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	0f 88 b8 00 00 00    	js     80354f <dup+0xe6>
+    close(newfdnum);
+  803497:	44 89 e7             	mov    %r12d,%edi
+  80349a:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8034a6:	4d 63 ec             	movslq %r12d,%r13
+  8034a9:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8034b0:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8034b4:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8034b8:	4c 89 ff             	mov    %r15,%rdi
+  8034bb:	49 be 2d 32 80 00 00 	movabs $0x80322d,%r14
+  8034c2:	00 00 00 
+  8034c5:	41 ff d6             	call   *%r14
+  8034c8:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8034cb:	4c 89 ef             	mov    %r13,%rdi
+  8034ce:	41 ff d6             	call   *%r14
+  8034d1:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8034d4:	48 89 df             	mov    %rbx,%rdi
+  8034d7:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  8034de:	00 00 00 
+  8034e1:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8034e3:	a8 04                	test   $0x4,%al
+  8034e5:	74 2b                	je     803512 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8034e7:	41 89 c1             	mov    %eax,%r9d
+  8034ea:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8034f0:	4c 89 f1             	mov    %r14,%rcx
+  8034f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f8:	48 89 de             	mov    %rbx,%rsi
+  8034fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803500:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  803507:	00 00 00 
+  80350a:	ff d0                	call   *%rax
+  80350c:	89 c3                	mov    %eax,%ebx
+  80350e:	85 c0                	test   %eax,%eax
+  803510:	78 4e                	js     803560 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803512:	4c 89 ff             	mov    %r15,%rdi
+  803515:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  80351c:	00 00 00 
+  80351f:	ff d0                	call   *%rax
+  803521:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803524:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80352a:	4c 89 e9             	mov    %r13,%rcx
+  80352d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803532:	4c 89 fe             	mov    %r15,%rsi
+  803535:	bf 00 00 00 00       	mov    $0x0,%edi
+  80353a:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  803541:	00 00 00 
+  803544:	ff d0                	call   *%rax
+  803546:	89 c3                	mov    %eax,%ebx
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	78 14                	js     803560 <dup+0xf7>
+
+    return newfdnum;
+  80354c:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80354f:	89 d8                	mov    %ebx,%eax
+  803551:	48 83 c4 18          	add    $0x18,%rsp
+  803555:	5b                   	pop    %rbx
+  803556:	41 5c                	pop    %r12
+  803558:	41 5d                	pop    %r13
+  80355a:	41 5e                	pop    %r14
+  80355c:	41 5f                	pop    %r15
+  80355e:	5d                   	pop    %rbp
+  80355f:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803560:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803565:	4c 89 ee             	mov    %r13,%rsi
+  803568:	bf 00 00 00 00       	mov    $0x0,%edi
+  80356d:	49 bc e3 2a 80 00 00 	movabs $0x802ae3,%r12
+  803574:	00 00 00 
+  803577:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80357a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80357f:	4c 89 f6             	mov    %r14,%rsi
+  803582:	bf 00 00 00 00       	mov    $0x0,%edi
+  803587:	41 ff d4             	call   *%r12
+    return res;
+  80358a:	eb c3                	jmp    80354f <dup+0xe6>
+
+000000000080358c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80358c:	55                   	push   %rbp
+  80358d:	48 89 e5             	mov    %rsp,%rbp
+  803590:	41 56                	push   %r14
+  803592:	41 55                	push   %r13
+  803594:	41 54                	push   %r12
+  803596:	53                   	push   %rbx
+  803597:	48 83 ec 10          	sub    $0x10,%rsp
+  80359b:	89 fb                	mov    %edi,%ebx
+  80359d:	49 89 f4             	mov    %rsi,%r12
+  8035a0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035a3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8035a7:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  8035ae:	00 00 00 
+  8035b1:	ff d0                	call   *%rax
+  8035b3:	85 c0                	test   %eax,%eax
+  8035b5:	78 4c                	js     803603 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035b7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035bb:	41 8b 3e             	mov    (%r14),%edi
+  8035be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035c2:	48 b8 f4 32 80 00 00 	movabs $0x8032f4,%rax
+  8035c9:	00 00 00 
+  8035cc:	ff d0                	call   *%rax
+  8035ce:	85 c0                	test   %eax,%eax
+  8035d0:	78 35                	js     803607 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8035d2:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8035d6:	83 e0 03             	and    $0x3,%eax
+  8035d9:	83 f8 01             	cmp    $0x1,%eax
+  8035dc:	74 2d                	je     80360b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8035de:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035e2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8035e6:	48 85 c0             	test   %rax,%rax
+  8035e9:	74 56                	je     803641 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8035eb:	4c 89 ea             	mov    %r13,%rdx
+  8035ee:	4c 89 e6             	mov    %r12,%rsi
+  8035f1:	4c 89 f7             	mov    %r14,%rdi
+  8035f4:	ff d0                	call   *%rax
+}
+  8035f6:	48 83 c4 10          	add    $0x10,%rsp
+  8035fa:	5b                   	pop    %rbx
+  8035fb:	41 5c                	pop    %r12
+  8035fd:	41 5d                	pop    %r13
+  8035ff:	41 5e                	pop    %r14
+  803601:	5d                   	pop    %rbp
+  803602:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803603:	48 98                	cltq
+  803605:	eb ef                	jmp    8035f6 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803607:	48 98                	cltq
+  803609:	eb eb                	jmp    8035f6 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80360b:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803612:	00 00 00 
+  803615:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80361b:	89 da                	mov    %ebx,%edx
+  80361d:	48 bf 79 70 80 00 00 	movabs $0x807079,%rdi
+  803624:	00 00 00 
+  803627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362c:	48 b9 6f 19 80 00 00 	movabs $0x80196f,%rcx
+  803633:	00 00 00 
+  803636:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803638:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80363f:	eb b5                	jmp    8035f6 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803641:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803648:	eb ac                	jmp    8035f6 <read+0x6a>
+
+000000000080364a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80364a:	55                   	push   %rbp
+  80364b:	48 89 e5             	mov    %rsp,%rbp
+  80364e:	41 57                	push   %r15
+  803650:	41 56                	push   %r14
+  803652:	41 55                	push   %r13
+  803654:	41 54                	push   %r12
+  803656:	53                   	push   %rbx
+  803657:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80365b:	48 85 d2             	test   %rdx,%rdx
+  80365e:	74 54                	je     8036b4 <readn+0x6a>
+  803660:	41 89 fd             	mov    %edi,%r13d
+  803663:	49 89 f6             	mov    %rsi,%r14
+  803666:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803669:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80366e:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803673:	49 bf 8c 35 80 00 00 	movabs $0x80358c,%r15
+  80367a:	00 00 00 
+  80367d:	4c 89 e2             	mov    %r12,%rdx
+  803680:	48 29 f2             	sub    %rsi,%rdx
+  803683:	4c 01 f6             	add    %r14,%rsi
+  803686:	44 89 ef             	mov    %r13d,%edi
+  803689:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	78 20                	js     8036b0 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803690:	01 c3                	add    %eax,%ebx
+  803692:	85 c0                	test   %eax,%eax
+  803694:	74 08                	je     80369e <readn+0x54>
+  803696:	48 63 f3             	movslq %ebx,%rsi
+  803699:	4c 39 e6             	cmp    %r12,%rsi
+  80369c:	72 df                	jb     80367d <readn+0x33>
+    }
+    return res;
+  80369e:	48 63 c3             	movslq %ebx,%rax
+}
+  8036a1:	48 83 c4 08          	add    $0x8,%rsp
+  8036a5:	5b                   	pop    %rbx
+  8036a6:	41 5c                	pop    %r12
+  8036a8:	41 5d                	pop    %r13
+  8036aa:	41 5e                	pop    %r14
+  8036ac:	41 5f                	pop    %r15
+  8036ae:	5d                   	pop    %rbp
+  8036af:	c3                   	ret
+        if (inc < 0) return inc;
+  8036b0:	48 98                	cltq
+  8036b2:	eb ed                	jmp    8036a1 <readn+0x57>
+    int inc = 1, res = 0;
+  8036b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036b9:	eb e3                	jmp    80369e <readn+0x54>
+
+00000000008036bb <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8036bb:	55                   	push   %rbp
+  8036bc:	48 89 e5             	mov    %rsp,%rbp
+  8036bf:	41 56                	push   %r14
+  8036c1:	41 55                	push   %r13
+  8036c3:	41 54                	push   %r12
+  8036c5:	53                   	push   %rbx
+  8036c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8036ca:	89 fb                	mov    %edi,%ebx
+  8036cc:	49 89 f4             	mov    %rsi,%r12
+  8036cf:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036d2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8036d6:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  8036dd:	00 00 00 
+  8036e0:	ff d0                	call   *%rax
+  8036e2:	85 c0                	test   %eax,%eax
+  8036e4:	78 47                	js     80372d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036e6:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8036ea:	41 8b 3e             	mov    (%r14),%edi
+  8036ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036f1:	48 b8 f4 32 80 00 00 	movabs $0x8032f4,%rax
+  8036f8:	00 00 00 
+  8036fb:	ff d0                	call   *%rax
+  8036fd:	85 c0                	test   %eax,%eax
+  8036ff:	78 30                	js     803731 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803701:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803706:	74 2d                	je     803735 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803708:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80370c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803710:	48 85 c0             	test   %rax,%rax
+  803713:	74 56                	je     80376b <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803715:	4c 89 ea             	mov    %r13,%rdx
+  803718:	4c 89 e6             	mov    %r12,%rsi
+  80371b:	4c 89 f7             	mov    %r14,%rdi
+  80371e:	ff d0                	call   *%rax
+}
+  803720:	48 83 c4 10          	add    $0x10,%rsp
+  803724:	5b                   	pop    %rbx
+  803725:	41 5c                	pop    %r12
+  803727:	41 5d                	pop    %r13
+  803729:	41 5e                	pop    %r14
+  80372b:	5d                   	pop    %rbp
+  80372c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80372d:	48 98                	cltq
+  80372f:	eb ef                	jmp    803720 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803731:	48 98                	cltq
+  803733:	eb eb                	jmp    803720 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803735:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80373c:	00 00 00 
+  80373f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803745:	89 da                	mov    %ebx,%edx
+  803747:	48 bf 95 70 80 00 00 	movabs $0x807095,%rdi
+  80374e:	00 00 00 
+  803751:	b8 00 00 00 00       	mov    $0x0,%eax
+  803756:	48 b9 6f 19 80 00 00 	movabs $0x80196f,%rcx
+  80375d:	00 00 00 
+  803760:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803762:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803769:	eb b5                	jmp    803720 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80376b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803772:	eb ac                	jmp    803720 <write+0x65>
+
+0000000000803774 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803774:	55                   	push   %rbp
+  803775:	48 89 e5             	mov    %rsp,%rbp
+  803778:	53                   	push   %rbx
+  803779:	48 83 ec 18          	sub    $0x18,%rsp
+  80377d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80377f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803783:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  80378a:	00 00 00 
+  80378d:	ff d0                	call   *%rax
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	78 0c                	js     80379f <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803793:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803797:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  80379a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80379f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037a3:	c9                   	leave
+  8037a4:	c3                   	ret
+
+00000000008037a5 <tell>:
+
+int tell(int fdnum) {
+  8037a5:	55                   	push   %rbp
+  8037a6:	48 89 e5             	mov    %rsp,%rbp
+  8037a9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037ad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037b1:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  8037b8:	00 00 00 
+  8037bb:	ff d0                	call   *%rax
+  8037bd:	85 c0                	test   %eax,%eax
+  8037bf:	78 07                	js     8037c8 <tell+0x23>
+
+    return fd->fd_offset;
+  8037c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037c5:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8037c8:	c9                   	leave
+  8037c9:	c3                   	ret
+
+00000000008037ca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8037ca:	55                   	push   %rbp
+  8037cb:	48 89 e5             	mov    %rsp,%rbp
+  8037ce:	41 55                	push   %r13
+  8037d0:	41 54                	push   %r12
+  8037d2:	53                   	push   %rbx
+  8037d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8037d7:	89 fb                	mov    %edi,%ebx
+  8037d9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8037e0:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  8037e7:	00 00 00 
+  8037ea:	ff d0                	call   *%rax
+  8037ec:	85 c0                	test   %eax,%eax
+  8037ee:	78 38                	js     803828 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8037f0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8037f4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8037f8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8037fc:	48 b8 f4 32 80 00 00 	movabs $0x8032f4,%rax
+  803803:	00 00 00 
+  803806:	ff d0                	call   *%rax
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	78 1c                	js     803828 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80380c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803811:	74 20                	je     803833 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803813:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803817:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80381b:	48 85 c0             	test   %rax,%rax
+  80381e:	74 47                	je     803867 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803820:	44 89 e6             	mov    %r12d,%esi
+  803823:	4c 89 ef             	mov    %r13,%rdi
+  803826:	ff d0                	call   *%rax
+}
+  803828:	48 83 c4 18          	add    $0x18,%rsp
+  80382c:	5b                   	pop    %rbx
+  80382d:	41 5c                	pop    %r12
+  80382f:	41 5d                	pop    %r13
+  803831:	5d                   	pop    %rbp
+  803832:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803833:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80383a:	00 00 00 
+  80383d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803843:	89 da                	mov    %ebx,%edx
+  803845:	48 bf 58 70 80 00 00 	movabs $0x807058,%rdi
+  80384c:	00 00 00 
+  80384f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803854:	48 b9 6f 19 80 00 00 	movabs $0x80196f,%rcx
+  80385b:	00 00 00 
+  80385e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803860:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803865:	eb c1                	jmp    803828 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803867:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80386c:	eb ba                	jmp    803828 <ftruncate+0x5e>
+
+000000000080386e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80386e:	55                   	push   %rbp
+  80386f:	48 89 e5             	mov    %rsp,%rbp
+  803872:	41 54                	push   %r12
+  803874:	53                   	push   %rbx
+  803875:	48 83 ec 10          	sub    $0x10,%rsp
+  803879:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80387c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803880:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+  80388c:	85 c0                	test   %eax,%eax
+  80388e:	78 63                	js     8038f3 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803890:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803894:	41 8b 3c 24          	mov    (%r12),%edi
+  803898:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80389c:	48 b8 f4 32 80 00 00 	movabs $0x8032f4,%rax
+  8038a3:	00 00 00 
+  8038a6:	ff d0                	call   *%rax
+  8038a8:	85 c0                	test   %eax,%eax
+  8038aa:	78 47                	js     8038f3 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8038ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038b0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8038b5:	74 45                	je     8038fc <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8038b7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8038ba:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8038c1:	00 00 00 
+    stat->st_isdir = 0;
+  8038c4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038cb:	00 00 00 
+    stat->st_ino = 0;
+  8038ce:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8038d5:	00 00 00 00 
+    stat->st_version = 0;
+  8038d9:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8038e0:	00 00 00 
+    stat->st_dev = dev;
+  8038e3:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8038ea:	48 89 de             	mov    %rbx,%rsi
+  8038ed:	4c 89 e7             	mov    %r12,%rdi
+  8038f0:	ff 50 28             	call   *0x28(%rax)
+}
+  8038f3:	48 83 c4 10          	add    $0x10,%rsp
+  8038f7:	5b                   	pop    %rbx
+  8038f8:	41 5c                	pop    %r12
+  8038fa:	5d                   	pop    %rbp
+  8038fb:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8038fc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803901:	eb f0                	jmp    8038f3 <fstat+0x85>
+
+0000000000803903 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803903:	55                   	push   %rbp
+  803904:	48 89 e5             	mov    %rsp,%rbp
+  803907:	41 54                	push   %r12
+  803909:	53                   	push   %rbx
+  80390a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80390d:	be 00 00 00 00       	mov    $0x0,%esi
+  803912:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+  80391e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803920:	85 c0                	test   %eax,%eax
+  803922:	78 25                	js     803949 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803924:	4c 89 e6             	mov    %r12,%rsi
+  803927:	89 c7                	mov    %eax,%edi
+  803929:	48 b8 6e 38 80 00 00 	movabs $0x80386e,%rax
+  803930:	00 00 00 
+  803933:	ff d0                	call   *%rax
+  803935:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803938:	89 df                	mov    %ebx,%edi
+  80393a:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  803941:	00 00 00 
+  803944:	ff d0                	call   *%rax
+
+    return res;
+  803946:	44 89 e3             	mov    %r12d,%ebx
+}
+  803949:	89 d8                	mov    %ebx,%eax
+  80394b:	5b                   	pop    %rbx
+  80394c:	41 5c                	pop    %r12
+  80394e:	5d                   	pop    %rbp
+  80394f:	c3                   	ret
+
+0000000000803950 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803950:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  803957:	00 00 00 
+  80395a:	83 38 00             	cmpl   $0x0,(%rax)
+  80395d:	74 0a                	je     803969 <fsipc_env+0x19>
+    return fsenv;
+}
+  80395f:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803966:	00 00 
+  803968:	c3                   	ret
+fsipc_env(void) {
+  803969:	55                   	push   %rbp
+  80396a:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80396d:	bf 03 00 00 00       	mov    $0x3,%edi
+  803972:	48 b8 e7 63 80 00 00 	movabs $0x8063e7,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+  80397e:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  803985:	00 00 
+}
+  803987:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  80398e:	00 00 
+  803990:	5d                   	pop    %rbp
+  803991:	c3                   	ret
+
+0000000000803992 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803992:	55                   	push   %rbp
+  803993:	48 89 e5             	mov    %rsp,%rbp
+  803996:	53                   	push   %rbx
+  803997:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  80399b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8039a2:	00 
+  8039a3:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8039aa:	00 
+  8039ab:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8039b2:	00 
+  8039b3:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8039ba:	00 
+  8039bb:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8039c2:	00 
+
+    assert(size <= sizeof(words));
+  8039c3:	48 83 fa 28          	cmp    $0x28,%rdx
+  8039c7:	77 38                	ja     803a01 <fsipc_short+0x6f>
+  8039c9:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8039cb:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8039cf:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  8039d6:	00 00 00 
+  8039d9:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8039db:	48 b8 50 39 80 00 00 	movabs $0x803950,%rax
+  8039e2:	00 00 00 
+  8039e5:	ff d0                	call   *%rax
+  8039e7:	89 c7                	mov    %eax,%edi
+  8039e9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039ed:	89 de                	mov    %ebx,%esi
+  8039ef:	48 b8 4a 63 80 00 00 	movabs $0x80634a,%rax
+  8039f6:	00 00 00 
+  8039f9:	ff d0                	call   *%rax
+}
+  8039fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039ff:	c9                   	leave
+  803a00:	c3                   	ret
+    assert(size <= sizeof(words));
+  803a01:	48 b9 e0 70 80 00 00 	movabs $0x8070e0,%rcx
+  803a08:	00 00 00 
+  803a0b:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803a12:	00 00 00 
+  803a15:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803a1a:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803a21:	00 00 00 
+  803a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a29:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803a30:	00 00 00 
+  803a33:	41 ff d0             	call   *%r8
+
+0000000000803a36 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803a36:	55                   	push   %rbp
+  803a37:	48 89 e5             	mov    %rsp,%rbp
+  803a3a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803a3e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a41:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803a44:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803a47:	ba 08 00 00 00       	mov    $0x8,%edx
+  803a4c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803a50:	bf 02 00 00 00       	mov    $0x2,%edi
+  803a55:	48 b8 92 39 80 00 00 	movabs $0x803992,%rax
+  803a5c:	00 00 00 
+  803a5f:	ff d0                	call   *%rax
+}
+  803a61:	c9                   	leave
+  803a62:	c3                   	ret
+
+0000000000803a63 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803a63:	55                   	push   %rbp
+  803a64:	48 89 e5             	mov    %rsp,%rbp
+  803a67:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803a6b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803a6e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803a71:	ba 04 00 00 00       	mov    $0x4,%edx
+  803a76:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803a7a:	bf 06 00 00 00       	mov    $0x6,%edi
+  803a7f:	48 b8 92 39 80 00 00 	movabs $0x803992,%rax
+  803a86:	00 00 00 
+  803a89:	ff d0                	call   *%rax
+}
+  803a8b:	c9                   	leave
+  803a8c:	c3                   	ret
+
+0000000000803a8d <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803a8d:	55                   	push   %rbp
+  803a8e:	48 89 e5             	mov    %rsp,%rbp
+  803a91:	41 54                	push   %r12
+  803a93:	53                   	push   %rbx
+  803a94:	48 83 ec 10          	sub    $0x10,%rsp
+  803a98:	89 fb                	mov    %edi,%ebx
+  803a9a:	49 89 f4             	mov    %rsi,%r12
+  803a9d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803aa1:	48 b8 50 39 80 00 00 	movabs $0x803950,%rax
+  803aa8:	00 00 00 
+  803aab:	ff d0                	call   *%rax
+  803aad:	89 c7                	mov    %eax,%edi
+  803aaf:	6a 00                	push   $0x0
+  803ab1:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803ab5:	50                   	push   %rax
+  803ab6:	4d 89 e1             	mov    %r12,%r9
+  803ab9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803abf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ac4:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  803acb:	00 00 00 
+  803ace:	89 de                	mov    %ebx,%esi
+  803ad0:	48 b8 e5 62 80 00 00 	movabs $0x8062e5,%rax
+  803ad7:	00 00 00 
+  803ada:	ff d0                	call   *%rax
+}
+  803adc:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803ae0:	5b                   	pop    %rbx
+  803ae1:	41 5c                	pop    %r12
+  803ae3:	5d                   	pop    %rbp
+  803ae4:	c3                   	ret
+
+0000000000803ae5 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803ae5:	55                   	push   %rbp
+  803ae6:	48 89 e5             	mov    %rsp,%rbp
+  803ae9:	41 54                	push   %r12
+  803aeb:	53                   	push   %rbx
+  803aec:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803aef:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803af2:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  803af9:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803afb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b00:	be 00 00 00 00       	mov    $0x0,%esi
+  803b05:	bf 05 00 00 00       	mov    $0x5,%edi
+  803b0a:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b16:	85 c0                	test   %eax,%eax
+  803b18:	78 5a                	js     803b74 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803b1a:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  803b21:	00 00 00 
+  803b24:	4c 89 e6             	mov    %r12,%rsi
+  803b27:	48 89 df             	mov    %rbx,%rdi
+  803b2a:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  803b31:	00 00 00 
+  803b34:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803b36:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803b3d:	00 
+  803b3e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803b44:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803b4b:	00 
+  803b4c:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803b52:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803b59:	00 
+  803b5a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803b61:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803b68:	00 
+  803b69:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b74:	5b                   	pop    %rbx
+  803b75:	41 5c                	pop    %r12
+  803b77:	5d                   	pop    %rbp
+  803b78:	c3                   	ret
+
+0000000000803b79 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+  803b7d:	41 57                	push   %r15
+  803b7f:	41 56                	push   %r14
+  803b81:	41 55                	push   %r13
+  803b83:	41 54                	push   %r12
+  803b85:	53                   	push   %rbx
+  803b86:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803b8a:	48 85 ff             	test   %rdi,%rdi
+  803b8d:	0f 84 a1 00 00 00    	je     803c34 <devfile_read+0xbb>
+  803b93:	49 89 ff             	mov    %rdi,%r15
+  803b96:	49 89 f5             	mov    %rsi,%r13
+  803b99:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803b9c:	48 85 f6             	test   %rsi,%rsi
+  803b9f:	0f 84 c4 00 00 00    	je     803c69 <devfile_read+0xf0>
+    size_t total_read = 0;
+  803ba5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803bac:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803bad:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  803bb4:	00 00 00 
+  803bb7:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803bbb:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803bbe:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803bc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bc7:	be 00 00 00 00       	mov    $0x0,%esi
+  803bcc:	bf 03 00 00 00       	mov    $0x3,%edi
+  803bd1:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803bd8:	00 00 00 
+  803bdb:	ff d0                	call   *%rax
+        if (res < 0) {
+  803bdd:	85 c0                	test   %eax,%eax
+  803bdf:	0f 88 b9 00 00 00    	js     803c9e <devfile_read+0x125>
+        assert(res <= n);
+  803be5:	48 63 d8             	movslq %eax,%rbx
+  803be8:	49 39 dc             	cmp    %rbx,%r12
+  803beb:	0f 82 b1 00 00 00    	jb     803ca2 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803bf1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803bf6:	0f 87 db 00 00 00    	ja     803cd7 <devfile_read+0x15e>
+        if (!res) {
+  803bfc:	85 c0                	test   %eax,%eax
+  803bfe:	74 21                	je     803c21 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803c00:	48 89 da             	mov    %rbx,%rdx
+  803c03:	4c 89 f6             	mov    %r14,%rsi
+  803c06:	4c 89 ef             	mov    %r13,%rdi
+  803c09:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  803c10:	00 00 00 
+  803c13:	ff d0                	call   *%rax
+        total_read += res;
+  803c15:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803c19:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803c1c:	49 29 dc             	sub    %rbx,%r12
+  803c1f:	75 96                	jne    803bb7 <devfile_read+0x3e>
+    return total_read;
+  803c21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803c25:	48 83 c4 18          	add    $0x18,%rsp
+  803c29:	5b                   	pop    %rbx
+  803c2a:	41 5c                	pop    %r12
+  803c2c:	41 5d                	pop    %r13
+  803c2e:	41 5e                	pop    %r14
+  803c30:	41 5f                	pop    %r15
+  803c32:	5d                   	pop    %rbp
+  803c33:	c3                   	ret
+    assert(fd);
+  803c34:	48 b9 16 71 80 00 00 	movabs $0x807116,%rcx
+  803c3b:	00 00 00 
+  803c3e:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803c45:	00 00 00 
+  803c48:	be 91 00 00 00       	mov    $0x91,%esi
+  803c4d:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803c54:	00 00 00 
+  803c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c5c:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803c63:	00 00 00 
+  803c66:	41 ff d0             	call   *%r8
+    assert(buf);
+  803c69:	48 b9 19 71 80 00 00 	movabs $0x807119,%rcx
+  803c70:	00 00 00 
+  803c73:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803c7a:	00 00 00 
+  803c7d:	be 92 00 00 00       	mov    $0x92,%esi
+  803c82:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803c89:	00 00 00 
+  803c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c91:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803c98:	00 00 00 
+  803c9b:	41 ff d0             	call   *%r8
+            return res;
+  803c9e:	48 98                	cltq
+  803ca0:	eb 83                	jmp    803c25 <devfile_read+0xac>
+        assert(res <= n);
+  803ca2:	48 b9 1d 71 80 00 00 	movabs $0x80711d,%rcx
+  803ca9:	00 00 00 
+  803cac:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803cb3:	00 00 00 
+  803cb6:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803cbb:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803cc2:	00 00 00 
+  803cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cca:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803cd1:	00 00 00 
+  803cd4:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803cd7:	48 b9 28 71 80 00 00 	movabs $0x807128,%rcx
+  803cde:	00 00 00 
+  803ce1:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803ce8:	00 00 00 
+  803ceb:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803cf0:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803cf7:	00 00 00 
+  803cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cff:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803d06:	00 00 00 
+  803d09:	41 ff d0             	call   *%r8
+
+0000000000803d0c <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d0c:	55                   	push   %rbp
+  803d0d:	48 89 e5             	mov    %rsp,%rbp
+  803d10:	41 57                	push   %r15
+  803d12:	41 56                	push   %r14
+  803d14:	41 55                	push   %r13
+  803d16:	41 54                	push   %r12
+  803d18:	53                   	push   %rbx
+  803d19:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803d1d:	48 85 ff             	test   %rdi,%rdi
+  803d20:	0f 84 83 00 00 00    	je     803da9 <devfile_write+0x9d>
+  803d26:	49 89 ff             	mov    %rdi,%r15
+  803d29:	49 89 f4             	mov    %rsi,%r12
+  803d2c:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803d2f:	48 85 f6             	test   %rsi,%rsi
+  803d32:	0f 84 a6 00 00 00    	je     803dde <devfile_write+0xd2>
+    size_t total_written = 0;
+  803d38:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803d3e:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  803d45:	00 00 00 
+  803d48:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803d4c:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803d4f:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803d53:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803d58:	48 39 d3             	cmp    %rdx,%rbx
+  803d5b:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803d5f:	4c 89 e6             	mov    %r12,%rsi
+  803d62:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  803d69:	00 00 00 
+  803d6c:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d82:	bf 04 00 00 00       	mov    $0x4,%edi
+  803d87:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+        if (res < 0) {
+  803d93:	85 c0                	test   %eax,%eax
+  803d95:	78 7c                	js     803e13 <devfile_write+0x107>
+        total_written += res;
+  803d97:	48 98                	cltq
+  803d99:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803d9c:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803d9f:	48 29 c3             	sub    %rax,%rbx
+  803da2:	75 a4                	jne    803d48 <devfile_write+0x3c>
+    return total_written;
+  803da4:	4c 89 e8             	mov    %r13,%rax
+  803da7:	eb 6c                	jmp    803e15 <devfile_write+0x109>
+    assert(fd);
+  803da9:	48 b9 16 71 80 00 00 	movabs $0x807116,%rcx
+  803db0:	00 00 00 
+  803db3:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803dba:	00 00 00 
+  803dbd:	be bd 00 00 00       	mov    $0xbd,%esi
+  803dc2:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803dc9:	00 00 00 
+  803dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dd1:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803dd8:	00 00 00 
+  803ddb:	41 ff d0             	call   *%r8
+    assert(buf);
+  803dde:	48 b9 19 71 80 00 00 	movabs $0x807119,%rcx
+  803de5:	00 00 00 
+  803de8:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  803def:	00 00 00 
+  803df2:	be be 00 00 00       	mov    $0xbe,%esi
+  803df7:	48 bf 0b 71 80 00 00 	movabs $0x80710b,%rdi
+  803dfe:	00 00 00 
+  803e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e06:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  803e0d:	00 00 00 
+  803e10:	41 ff d0             	call   *%r8
+            return res;
+  803e13:	48 98                	cltq
+}
+  803e15:	48 83 c4 08          	add    $0x8,%rsp
+  803e19:	5b                   	pop    %rbx
+  803e1a:	41 5c                	pop    %r12
+  803e1c:	41 5d                	pop    %r13
+  803e1e:	41 5e                	pop    %r14
+  803e20:	41 5f                	pop    %r15
+  803e22:	5d                   	pop    %rbp
+  803e23:	c3                   	ret
+
+0000000000803e24 <open>:
+open(const char *path, int mode) {
+  803e24:	55                   	push   %rbp
+  803e25:	48 89 e5             	mov    %rsp,%rbp
+  803e28:	41 55                	push   %r13
+  803e2a:	41 54                	push   %r12
+  803e2c:	53                   	push   %rbx
+  803e2d:	48 83 ec 18          	sub    $0x18,%rsp
+  803e31:	49 89 fc             	mov    %rdi,%r12
+  803e34:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803e37:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  803e3e:	00 00 00 
+  803e41:	ff d0                	call   *%rax
+  803e43:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803e49:	0f 87 8f 00 00 00    	ja     803ede <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803e4f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e53:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  803e5a:	00 00 00 
+  803e5d:	ff d0                	call   *%rax
+  803e5f:	89 c3                	mov    %eax,%ebx
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	78 55                	js     803eba <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803e65:	4c 89 e6             	mov    %r12,%rsi
+  803e68:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  803e6f:	00 00 00 
+  803e72:	48 89 df             	mov    %rbx,%rdi
+  803e75:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  803e7c:	00 00 00 
+  803e7f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803e81:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803e88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e8d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e91:	bf 01 00 00 00       	mov    $0x1,%edi
+  803e96:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803e9d:	00 00 00 
+  803ea0:	ff d0                	call   *%rax
+  803ea2:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ea4:	85 c0                	test   %eax,%eax
+  803ea6:	78 1f                	js     803ec7 <open+0xa3>
+    return fd2num(fd);
+  803ea8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803eac:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	89 c3                	mov    %eax,%ebx
+}
+  803eba:	89 d8                	mov    %ebx,%eax
+  803ebc:	48 83 c4 18          	add    $0x18,%rsp
+  803ec0:	5b                   	pop    %rbx
+  803ec1:	41 5c                	pop    %r12
+  803ec3:	41 5d                	pop    %r13
+  803ec5:	5d                   	pop    %rbp
+  803ec6:	c3                   	ret
+        fd_close(fd, 0);
+  803ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  803ecc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ed0:	48 b8 64 33 80 00 00 	movabs $0x803364,%rax
+  803ed7:	00 00 00 
+  803eda:	ff d0                	call   *%rax
+        return res;
+  803edc:	eb dc                	jmp    803eba <open+0x96>
+        return -E_BAD_PATH;
+  803ede:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803ee3:	eb d5                	jmp    803eba <open+0x96>
+
+0000000000803ee5 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803ee5:	55                   	push   %rbp
+  803ee6:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803ee9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803eee:	be 00 00 00 00       	mov    $0x0,%esi
+  803ef3:	bf 08 00 00 00       	mov    $0x8,%edi
+  803ef8:	48 b8 92 39 80 00 00 	movabs $0x803992,%rax
+  803eff:	00 00 00 
+  803f02:	ff d0                	call   *%rax
+}
+  803f04:	5d                   	pop    %rbp
+  803f05:	c3                   	ret
+
+0000000000803f06 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803f06:	55                   	push   %rbp
+  803f07:	48 89 e5             	mov    %rsp,%rbp
+  803f0a:	41 56                	push   %r14
+  803f0c:	41 55                	push   %r13
+  803f0e:	41 54                	push   %r12
+  803f10:	53                   	push   %rbx
+  803f11:	48 83 ec 10          	sub    $0x10,%rsp
+  803f15:	41 89 f6             	mov    %esi,%r14d
+  803f18:	49 89 d4             	mov    %rdx,%r12
+  803f1b:	48 89 cb             	mov    %rcx,%rbx
+  803f1e:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803f21:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803f25:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803f2c:	00 00 00 
+  803f2f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f31:	85 c0                	test   %eax,%eax
+  803f33:	78 46                	js     803f7b <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f35:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f39:	48 b8 60 80 80 00 00 	movabs $0x808060,%rax
+  803f40:	00 00 00 
+  803f43:	8b 00                	mov    (%rax),%eax
+  803f45:	39 02                	cmp    %eax,(%rdx)
+  803f47:	75 3f                	jne    803f88 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803f49:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803f50:	00 00 00 
+  803f53:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803f56:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803f58:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803f5c:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803f60:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803f64:	48 89 da             	mov    %rbx,%rdx
+  803f67:	4c 89 e6             	mov    %r12,%rsi
+  803f6a:	bf 09 00 00 00       	mov    $0x9,%edi
+  803f6f:	48 b8 8d 3a 80 00 00 	movabs $0x803a8d,%rax
+  803f76:	00 00 00 
+  803f79:	ff d0                	call   *%rax
+}
+  803f7b:	48 83 c4 10          	add    $0x10,%rsp
+  803f7f:	5b                   	pop    %rbx
+  803f80:	41 5c                	pop    %r12
+  803f82:	41 5d                	pop    %r13
+  803f84:	41 5e                	pop    %r14
+  803f86:	5d                   	pop    %rbp
+  803f87:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803f88:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803f8d:	eb ec                	jmp    803f7b <file_map+0x75>
+
+0000000000803f8f <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803f8f:	55                   	push   %rbp
+  803f90:	48 89 e5             	mov    %rsp,%rbp
+  803f93:	41 54                	push   %r12
+  803f95:	53                   	push   %rbx
+  803f96:	48 83 ec 20          	sub    $0x20,%rsp
+  803f9a:	41 89 f4             	mov    %esi,%r12d
+  803f9d:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803fa0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803fa4:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fb0:	85 c0                	test   %eax,%eax
+  803fb2:	78 3c                	js     803ff0 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803fb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb8:	48 ba 60 80 80 00 00 	movabs $0x808060,%rdx
+  803fbf:	00 00 00 
+  803fc2:	8b 0a                	mov    (%rdx),%ecx
+  803fc4:	39 08                	cmp    %ecx,(%rax)
+  803fc6:	75 31                	jne    803ff9 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803fc8:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fcb:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803fce:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803fd2:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803fd6:	ba 10 00 00 00       	mov    $0x10,%edx
+  803fdb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803fdf:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803fe4:	48 b8 92 39 80 00 00 	movabs $0x803992,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+}
+  803ff0:	48 83 c4 20          	add    $0x20,%rsp
+  803ff4:	5b                   	pop    %rbx
+  803ff5:	41 5c                	pop    %r12
+  803ff7:	5d                   	pop    %rbp
+  803ff8:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ff9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803ffe:	eb f0                	jmp    803ff0 <file_msync+0x61>
+
+0000000000804000 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804000:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804004:	7f 01                	jg     804007 <writebuf+0x7>
+  804006:	c3                   	ret
+writebuf(struct printbuf *state) {
+  804007:	55                   	push   %rbp
+  804008:	48 89 e5             	mov    %rsp,%rbp
+  80400b:	53                   	push   %rbx
+  80400c:	48 83 ec 08          	sub    $0x8,%rsp
+  804010:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804013:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  804017:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80401b:	8b 3f                	mov    (%rdi),%edi
+  80401d:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  804029:	48 85 c0             	test   %rax,%rax
+  80402c:	7e 04                	jle    804032 <writebuf+0x32>
+  80402e:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804032:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804036:	48 39 c2             	cmp    %rax,%rdx
+  804039:	74 0f                	je     80404a <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80403b:	48 85 c0             	test   %rax,%rax
+  80403e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804043:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804047:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80404a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80404e:	c9                   	leave
+  80404f:	c3                   	ret
+
+0000000000804050 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804050:	8b 46 04             	mov    0x4(%rsi),%eax
+  804053:	8d 50 01             	lea    0x1(%rax),%edx
+  804056:	89 56 04             	mov    %edx,0x4(%rsi)
+  804059:	48 98                	cltq
+  80405b:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804060:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804066:	74 01                	je     804069 <putch+0x19>
+  804068:	c3                   	ret
+putch(int ch, void *arg) {
+  804069:	55                   	push   %rbp
+  80406a:	48 89 e5             	mov    %rsp,%rbp
+  80406d:	53                   	push   %rbx
+  80406e:	48 83 ec 08          	sub    $0x8,%rsp
+  804072:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804075:	48 89 f7             	mov    %rsi,%rdi
+  804078:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+        state->offset = 0;
+  804084:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80408b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80408f:	c9                   	leave
+  804090:	c3                   	ret
+
+0000000000804091 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804091:	55                   	push   %rbp
+  804092:	48 89 e5             	mov    %rsp,%rbp
+  804095:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80409c:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80409f:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8040a5:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8040ac:	00 00 00 
+    state.result = 0;
+  8040af:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8040b6:	00 00 00 00 
+    state.error = 1;
+  8040ba:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8040c1:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8040c4:	48 89 f2             	mov    %rsi,%rdx
+  8040c7:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8040ce:	48 bf 50 40 80 00 00 	movabs $0x804050,%rdi
+  8040d5:	00 00 00 
+  8040d8:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  8040df:	00 00 00 
+  8040e2:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8040e4:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8040eb:	7f 14                	jg     804101 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  8040ed:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  8040f4:	48 85 c0             	test   %rax,%rax
+  8040f7:	75 06                	jne    8040ff <vfprintf+0x6e>
+  8040f9:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  8040ff:	c9                   	leave
+  804100:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804101:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  804108:	48 b8 00 40 80 00 00 	movabs $0x804000,%rax
+  80410f:	00 00 00 
+  804112:	ff d0                	call   *%rax
+  804114:	eb d7                	jmp    8040ed <vfprintf+0x5c>
+
+0000000000804116 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804116:	55                   	push   %rbp
+  804117:	48 89 e5             	mov    %rsp,%rbp
+  80411a:	48 83 ec 50          	sub    $0x50,%rsp
+  80411e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804122:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804126:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80412a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80412e:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804135:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804139:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80413d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804141:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804145:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804149:	48 b8 91 40 80 00 00 	movabs $0x804091,%rax
+  804150:	00 00 00 
+  804153:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804155:	c9                   	leave
+  804156:	c3                   	ret
+
+0000000000804157 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804157:	55                   	push   %rbp
+  804158:	48 89 e5             	mov    %rsp,%rbp
+  80415b:	48 83 ec 50          	sub    $0x50,%rsp
+  80415f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804163:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804167:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80416b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80416f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804173:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80417a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80417e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804182:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804186:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80418a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80418e:	48 89 fe             	mov    %rdi,%rsi
+  804191:	bf 01 00 00 00       	mov    $0x1,%edi
+  804196:	48 b8 91 40 80 00 00 	movabs $0x804091,%rax
+  80419d:	00 00 00 
+  8041a0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8041a2:	c9                   	leave
+  8041a3:	c3                   	ret
+
+00000000008041a4 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  8041a4:	55                   	push   %rbp
+  8041a5:	48 89 e5             	mov    %rsp,%rbp
+  8041a8:	41 55                	push   %r13
+  8041aa:	41 54                	push   %r12
+  8041ac:	53                   	push   %rbx
+  8041ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8041b1:	48 89 fb             	mov    %rdi,%rbx
+  8041b4:	49 89 f5             	mov    %rsi,%r13
+  8041b7:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  8041ba:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+  8041c6:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  8041c8:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  8041cf:	ff ff ff 
+  8041d2:	48 01 d8             	add    %rbx,%rax
+  8041d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041da:	48 c1 e8 24          	shr    $0x24,%rax
+  8041de:	74 5c                	je     80423c <collect_shared_region+0x98>
+
+    if (list->count) {
+  8041e0:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  8041e7:	00 
+  8041e8:	48 85 c0             	test   %rax,%rax
+  8041eb:	74 20                	je     80420d <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  8041ed:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8041f1:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  8041f5:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  8041f9:	48 89 f7             	mov    %rsi,%rdi
+  8041fc:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  804200:	48 39 fb             	cmp    %rdi,%rbx
+  804203:	74 44                	je     804249 <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804205:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80420b:	74 59                	je     804266 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  80420d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804211:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  804218:	00 
+  804219:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  80421d:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804221:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  804225:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  804228:	49 29 dd             	sub    %rbx,%r13
+  80422b:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  80422f:	48 01 c2             	add    %rax,%rdx
+  804232:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  804237:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80423c:	89 d0                	mov    %edx,%eax
+  80423e:	48 83 c4 08          	add    $0x8,%rsp
+  804242:	5b                   	pop    %rbx
+  804243:	41 5c                	pop    %r12
+  804245:	41 5d                	pop    %r13
+  804247:	5d                   	pop    %rbp
+  804248:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  804249:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  80424e:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804253:	75 b0                	jne    804205 <collect_shared_region+0x61>
+            last->size += end - start;
+  804255:	49 29 dd             	sub    %rbx,%r13
+  804258:	49 01 f5             	add    %rsi,%r13
+  80425b:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  80425f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804264:	eb d6                	jmp    80423c <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804266:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  80426b:	eb cf                	jmp    80423c <collect_shared_region+0x98>
+
+000000000080426d <spawn>:
+spawn(const char *prog, const char **argv) {
+  80426d:	55                   	push   %rbp
+  80426e:	48 89 e5             	mov    %rsp,%rbp
+  804271:	41 57                	push   %r15
+  804273:	41 56                	push   %r14
+  804275:	41 55                	push   %r13
+  804277:	41 54                	push   %r12
+  804279:	53                   	push   %rbx
+  80427a:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  804281:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  804284:	be 00 00 00 00       	mov    $0x0,%esi
+  804289:	48 b8 24 3e 80 00 00 	movabs $0x803e24,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+  804295:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  804298:	85 c0                	test   %eax,%eax
+  80429a:	0f 88 8f 06 00 00    	js     80492f <spawn+0x6c2>
+    struct SpawnImage img = {
+  8042a0:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8042a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8042ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8042b4:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  8042bb:	00 00 00 
+  8042be:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  8042c5:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8042cc:	00 00 00 
+  8042cf:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  8042d6:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  8042dd:	44 89 f7             	mov    %r14d,%edi
+  8042e0:	48 b8 6e 38 80 00 00 	movabs $0x80386e,%rax
+  8042e7:	00 00 00 
+  8042ea:	ff d0                	call   *%rax
+  8042ec:	41 89 c4             	mov    %eax,%r12d
+  8042ef:	85 c0                	test   %eax,%eax
+  8042f1:	0f 88 26 06 00 00    	js     80491d <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  8042f7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042fe:	48 85 c0             	test   %rax,%rax
+  804301:	74 22                	je     804325 <spawn+0xb8>
+  804303:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  80430a:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  804311:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  804318:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  80431e:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  804325:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80432a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80432f:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804336:	00 00 00 
+  804339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433e:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+  80434a:	41 89 c4             	mov    %eax,%r12d
+  80434d:	85 c0                	test   %eax,%eax
+  80434f:	0f 88 c8 05 00 00    	js     80491d <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804355:	48 8b 3b             	mov    (%rbx),%rdi
+  804358:	48 85 ff             	test   %rdi,%rdi
+  80435b:	0f 84 61 02 00 00    	je     8045c2 <spawn+0x355>
+  804361:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  804367:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  80436d:	49 bf 68 22 80 00 00 	movabs $0x802268,%r15
+  804374:	00 00 00 
+  804377:	41 ff d7             	call   *%r15
+  80437a:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  80437f:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  804386:	49 83 c4 01          	add    $0x1,%r12
+  80438a:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  80438f:	48 85 ff             	test   %rdi,%rdi
+  804392:	75 e3                	jne    804377 <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804394:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  80439a:	4d 29 ec             	sub    %r13,%r12
+  80439d:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  8043a4:	00 00 00 
+  8043a7:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8043aa:	4c 89 e1             	mov    %r12,%rcx
+  8043ad:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  8043b1:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  8043b8:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  8043bf:	89 f0                	mov    %esi,%eax
+  8043c1:	83 c0 01             	add    $0x1,%eax
+  8043c4:	48 98                	cltq
+  8043c6:	48 c1 e0 03          	shl    $0x3,%rax
+  8043ca:	48 29 c1             	sub    %rax,%rcx
+  8043cd:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8043d4:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8043d8:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  8043df:	00 00 00 
+  8043e2:	48 39 c2             	cmp    %rax,%rdx
+  8043e5:	0f 83 f2 04 00 00    	jae    8048dd <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  8043eb:	85 f6                	test   %esi,%esi
+  8043ed:	7e 4e                	jle    80443d <spawn+0x1d0>
+  8043ef:	49 89 cd             	mov    %rcx,%r13
+  8043f2:	48 63 c6             	movslq %esi,%rax
+  8043f5:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  8043f9:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804400:	00 00 00 
+  804403:	4c 01 e0             	add    %r12,%rax
+  804406:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  80440a:	48 8b 33             	mov    (%rbx),%rsi
+  80440d:	4c 89 e7             	mov    %r12,%rdi
+  804410:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  804417:	00 00 00 
+  80441a:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80441c:	48 8b 3b             	mov    (%rbx),%rdi
+  80441f:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  804430:	49 83 c5 08          	add    $0x8,%r13
+  804434:	48 83 c3 08          	add    $0x8,%rbx
+  804438:	4d 39 fd             	cmp    %r15,%r13
+  80443b:	75 bc                	jne    8043f9 <spawn+0x18c>
+    argv_store[argc] = 0;
+  80443d:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804444:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80444b:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  80444c:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804453:	00 00 00 
+  804456:	49 39 c4             	cmp    %rax,%r12
+  804459:	0f 85 92 01 00 00    	jne    8045f1 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  80445f:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804466:	00 00 00 
+  804469:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804470:	48 01 d0             	add    %rdx,%rax
+  804473:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  804477:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80447e:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  804482:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  804489:	00 00 00 
+  80448c:	48 01 d0             	add    %rdx,%rax
+  80448f:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  804496:	48 be 20 b0 80 01 00 	movabs $0x180b020,%rsi
+  80449d:	00 00 00 
+  8044a0:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  8044a7:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  8044ab:	48 bf a4 41 80 00 00 	movabs $0x8041a4,%rdi
+  8044b2:	00 00 00 
+  8044b5:	48 b8 51 51 80 00 00 	movabs $0x805151,%rax
+  8044bc:	00 00 00 
+  8044bf:	ff d0                	call   *%rax
+  8044c1:	41 89 c4             	mov    %eax,%r12d
+  8044c4:	85 c0                	test   %eax,%eax
+  8044c6:	0f 88 24 04 00 00    	js     8048f0 <spawn+0x683>
+    img.nshared = shared.count;
+  8044cc:	48 a1 20 c8 80 01 00 	movabs 0x180c820,%rax
+  8044d3:	00 00 00 
+  8044d6:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  8044dd:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  8044e4:	00 
+  8044e5:	74 1f                	je     804506 <spawn+0x299>
+        res = sys_spawn(&img);
+  8044e7:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8044ee:	48 b8 7c 2d 80 00 00 	movabs $0x802d7c,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+  8044fa:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  8044fd:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  804500:	0f 85 ca 03 00 00    	jne    8048d0 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  804506:	ba 00 02 00 00       	mov    $0x200,%edx
+  80450b:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  804512:	44 89 f7             	mov    %r14d,%edi
+  804515:	48 b8 4a 36 80 00 00 	movabs $0x80364a,%rax
+  80451c:	00 00 00 
+  80451f:	ff d0                	call   *%rax
+  804521:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  804523:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804528:	0f 85 f8 00 00 00    	jne    804626 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  80452e:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  804535:	ff ff 00 
+  804538:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  80453f:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804546:	01 01 00 
+  804549:	48 39 d0             	cmp    %rdx,%rax
+  80454c:	0f 85 f7 00 00 00    	jne    804649 <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804552:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  804559:	00 3e 00 
+  80455c:	0f 85 e7 00 00 00    	jne    804649 <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  804562:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  804569:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  804570:	ff 
+  804571:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  804578:	00 
+  804579:	4c 29 c0             	sub    %r8,%rax
+  80457c:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  804580:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804586:	0f 87 bd 00 00 00    	ja     804649 <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80458c:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804593:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804594:	4d 85 c0             	test   %r8,%r8
+  804597:	0f 84 1b 02 00 00    	je     8047b8 <spawn+0x54b>
+  80459d:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  8045a2:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8045a9:	00 00 01 00 
+  8045ad:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  8045b3:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  8045ba:	00 00 00 
+  8045bd:	e9 d4 00 00 00       	jmp    804696 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8045c2:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  8045c9:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8045cd:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  8045d4:	00 00 00 
+  8045d7:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  8045de:	48 8d 40 08          	lea    0x8(%rax),%rax
+  8045e2:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  8045e9:	49 89 c4             	mov    %rax,%r12
+  8045ec:	e9 4c fe ff ff       	jmp    80443d <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  8045f1:	48 b9 50 71 80 00 00 	movabs $0x807150,%rcx
+  8045f8:	00 00 00 
+  8045fb:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  804602:	00 00 00 
+  804605:	be e2 00 00 00       	mov    $0xe2,%esi
+  80460a:	48 bf a9 71 80 00 00 	movabs $0x8071a9,%rdi
+  804611:	00 00 00 
+  804614:	b8 00 00 00 00       	mov    $0x0,%eax
+  804619:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  804620:	00 00 00 
+  804623:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  804626:	48 bf 80 71 80 00 00 	movabs $0x807180,%rdi
+  80462d:	00 00 00 
+  804630:	b8 00 00 00 00       	mov    $0x0,%eax
+  804635:	48 ba 6f 19 80 00 00 	movabs $0x80196f,%rdx
+  80463c:	00 00 00 
+  80463f:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  804641:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804647:	eb 2c                	jmp    804675 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804649:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80464e:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  804654:	48 bf b5 71 80 00 00 	movabs $0x8071b5,%rdi
+  80465b:	00 00 00 
+  80465e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804663:	48 b9 6f 19 80 00 00 	movabs $0x80196f,%rcx
+  80466a:	00 00 00 
+  80466d:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  80466f:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804675:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  80467c:	00 00 01 00 
+  804680:	e9 76 02 00 00       	jmp    8048fb <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804685:	48 83 c2 01          	add    $0x1,%rdx
+  804689:	48 83 c0 38          	add    $0x38,%rax
+  80468d:	49 39 d0             	cmp    %rdx,%r8
+  804690:	0f 84 a5 00 00 00    	je     80473b <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804696:	83 38 01             	cmpl   $0x1,(%rax)
+  804699:	75 ea                	jne    804685 <spawn+0x418>
+  80469b:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  80469f:	48 85 f6             	test   %rsi,%rsi
+  8046a2:	74 e1                	je     804685 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  8046a4:	49 83 ff 10          	cmp    $0x10,%r15
+  8046a8:	0f 84 a1 02 00 00    	je     80494f <spawn+0x6e2>
+  8046ae:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  8046b2:	0f 82 aa 02 00 00    	jb     804962 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  8046b8:	8b 78 04             	mov    0x4(%rax),%edi
+  8046bb:	89 f9                	mov    %edi,%ecx
+  8046bd:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  8046c0:	41 89 c9             	mov    %ecx,%r9d
+  8046c3:	41 83 c9 04          	or     $0x4,%r9d
+  8046c7:	40 f6 c7 04          	test   $0x4,%dil
+  8046cb:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  8046cf:	41 89 c9             	mov    %ecx,%r9d
+  8046d2:	41 83 c9 01          	or     $0x1,%r9d
+  8046d6:	40 f6 c7 01          	test   $0x1,%dil
+  8046da:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  8046de:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  8046e2:	49 89 f9             	mov    %rdi,%r9
+  8046e5:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  8046ec:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  8046f3:	00 
+  8046f4:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8046fb:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  8046fe:	4c 89 ff             	mov    %r15,%rdi
+  804701:	48 c1 e7 05          	shl    $0x5,%rdi
+  804705:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  80470c:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  80470f:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  804716:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  80471a:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  80471d:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  804721:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  804725:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  804728:	48 01 f3             	add    %rsi,%rbx
+  80472b:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  804732:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  804736:	e9 4a ff ff ff       	jmp    804685 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  80473b:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  804742:	00 00 00 
+  804745:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  80474c:	48 39 c8             	cmp    %rcx,%rax
+  80474f:	0f 82 ef 01 00 00    	jb     804944 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  804755:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  80475c:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  804763:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804768:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  80476f:	00 00 00 
+  804772:	bf 00 00 00 00       	mov    $0x0,%edi
+  804777:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  80477e:	00 00 00 
+  804781:	ff d0                	call   *%rax
+  804783:	41 89 c4             	mov    %eax,%r12d
+  804786:	85 c0                	test   %eax,%eax
+  804788:	0f 88 e7 fe ff ff    	js     804675 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80478e:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  804795:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  80479c:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  80479d:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  8047a4:	00 
+  8047a5:	0f 84 d3 00 00 00    	je     80487e <spawn+0x611>
+  8047ab:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8047b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047b6:	eb 46                	jmp    8047fe <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  8047b8:	4d 89 c7             	mov    %r8,%r15
+  8047bb:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8047c2:	00 00 01 00 
+  8047c6:	eb 8d                	jmp    804755 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  8047c8:	48 85 c0             	test   %rax,%rax
+  8047cb:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  8047d2:	48 0f 49 c2          	cmovns %rdx,%rax
+  8047d6:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  8047d9:	85 c0                	test   %eax,%eax
+  8047db:	0f 89 c0 00 00 00    	jns    8048a1 <spawn+0x634>
+  8047e1:	e9 15 01 00 00       	jmp    8048fb <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  8047e6:	49 83 c5 01          	add    $0x1,%r13
+  8047ea:	48 83 c3 38          	add    $0x38,%rbx
+  8047ee:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  8047f5:	49 39 c5             	cmp    %rax,%r13
+  8047f8:	0f 83 80 00 00 00    	jae    80487e <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  8047fe:	83 3b 01             	cmpl   $0x1,(%rbx)
+  804801:	75 e3                	jne    8047e6 <spawn+0x579>
+  804803:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  804808:	74 dc                	je     8047e6 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  80480a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80480e:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  804815:	48 c1 e2 05          	shl    $0x5,%rdx
+  804819:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  80481d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804822:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  804829:	ff 
+  80482a:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  804831:	8b 73 08             	mov    0x8(%rbx),%esi
+  804834:	44 89 f7             	mov    %r14d,%edi
+  804837:	48 ba 74 37 80 00 00 	movabs $0x803774,%rdx
+  80483e:	00 00 00 
+  804841:	ff d2                	call   *%rdx
+  804843:	41 89 c4             	mov    %eax,%r12d
+  804846:	85 c0                	test   %eax,%eax
+  804848:	0f 88 ad 00 00 00    	js     8048fb <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  80484e:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  804852:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  804859:	44 89 f7             	mov    %r14d,%edi
+  80485c:	48 b8 4a 36 80 00 00 	movabs $0x80364a,%rax
+  804863:	00 00 00 
+  804866:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804868:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  80486c:	0f 85 56 ff ff ff    	jne    8047c8 <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804872:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804879:	e9 68 ff ff ff       	jmp    8047e6 <spawn+0x579>
+    img->entry = elf->e_entry;
+  80487e:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  804885:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  80488c:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804893:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  80489a:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  8048a1:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8048a8:	48 b8 7c 2d 80 00 00 	movabs $0x802d7c,%rax
+  8048af:	00 00 00 
+  8048b2:	ff d0                	call   *%rax
+  8048b4:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  8048b7:	45 85 e4             	test   %r12d,%r12d
+  8048ba:	78 3f                	js     8048fb <spawn+0x68e>
+    close(fd);
+  8048bc:	44 89 f7             	mov    %r14d,%edi
+  8048bf:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  8048c6:	00 00 00 
+  8048c9:	ff d0                	call   *%rax
+    return res;
+  8048cb:	45 89 e6             	mov    %r12d,%r14d
+  8048ce:	eb 5f                	jmp    80492f <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  8048d0:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8048d7:	00 00 01 00 
+  8048db:	eb da                	jmp    8048b7 <spawn+0x64a>
+  8048dd:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8048e4:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8048e8:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  8048ee:	eb 0b                	jmp    8048fb <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  8048f0:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  8048f7:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  8048fb:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  804902:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804909:	00 00 00 
+  80490c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804911:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  804918:	00 00 00 
+  80491b:	ff d0                	call   *%rax
+    close(fd);
+  80491d:	44 89 f7             	mov    %r14d,%edi
+  804920:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  804927:	00 00 00 
+  80492a:	ff d0                	call   *%rax
+    return res;
+  80492c:	45 89 e6             	mov    %r12d,%r14d
+}
+  80492f:	44 89 f0             	mov    %r14d,%eax
+  804932:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  804939:	5b                   	pop    %rbx
+  80493a:	41 5c                	pop    %r12
+  80493c:	41 5d                	pop    %r13
+  80493e:	41 5e                	pop    %r14
+  804940:	41 5f                	pop    %r15
+  804942:	5d                   	pop    %rbp
+  804943:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804944:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  80494a:	e9 26 fd ff ff       	jmp    804675 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  80494f:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804956:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  80495a:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804960:	eb 99                	jmp    8048fb <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804962:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804969:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  80496d:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804973:	eb 86                	jmp    8048fb <spawn+0x68e>
+
+0000000000804975 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804975:	55                   	push   %rbp
+  804976:	48 89 e5             	mov    %rsp,%rbp
+  804979:	48 83 ec 50          	sub    $0x50,%rsp
+  80497d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804981:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804985:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804989:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80498d:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804994:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804998:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80499c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8049a0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8049a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8049a9:	eb 15                	jmp    8049c0 <spawnl+0x4b>
+  8049ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8049af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8049b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8049b7:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8049bb:	74 1c                	je     8049d9 <spawnl+0x64>
+  8049bd:	83 c1 01             	add    $0x1,%ecx
+  8049c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8049c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8049c6:	77 e3                	ja     8049ab <spawnl+0x36>
+  8049c8:	89 c2                	mov    %eax,%edx
+  8049ca:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8049ce:	4c 01 d2             	add    %r10,%rdx
+  8049d1:	83 c0 08             	add    $0x8,%eax
+  8049d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8049d7:	eb de                	jmp    8049b7 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8049d9:	8d 41 02             	lea    0x2(%rcx),%eax
+  8049dc:	48 98                	cltq
+  8049de:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8049e5:	00 
+  8049e6:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8049ea:	48 29 c4             	sub    %rax,%rsp
+  8049ed:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8049f2:	4c 89 c0             	mov    %r8,%rax
+  8049f5:	48 c1 e8 03          	shr    $0x3,%rax
+  8049f9:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8049fd:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804a04:	00 
+    argv[argc + 1] = NULL;
+  804a05:	8d 41 01             	lea    0x1(%rcx),%eax
+  804a08:	48 98                	cltq
+  804a0a:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804a11:	00 
+    va_start(vl, arg0);
+  804a12:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804a19:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804a21:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804a25:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804a29:	85 c9                	test   %ecx,%ecx
+  804a2b:	74 41                	je     804a6e <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804a2d:	49 89 c1             	mov    %rax,%r9
+  804a30:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804a34:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804a37:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804a3c:	eb 1b                	jmp    804a59 <spawnl+0xe4>
+  804a3e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804a42:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804a46:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804a4a:	48 8b 11             	mov    (%rcx),%rdx
+  804a4d:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804a50:	48 83 c0 08          	add    $0x8,%rax
+  804a54:	48 39 f0             	cmp    %rsi,%rax
+  804a57:	74 15                	je     804a6e <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804a59:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804a5c:	83 fa 2f             	cmp    $0x2f,%edx
+  804a5f:	77 dd                	ja     804a3e <spawnl+0xc9>
+  804a61:	89 d1                	mov    %edx,%ecx
+  804a63:	4c 01 c9             	add    %r9,%rcx
+  804a66:	83 c2 08             	add    $0x8,%edx
+  804a69:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804a6c:	eb dc                	jmp    804a4a <spawnl+0xd5>
+    return spawn(prog, argv);
+  804a6e:	4c 89 c6             	mov    %r8,%rsi
+  804a71:	48 b8 6d 42 80 00 00 	movabs $0x80426d,%rax
+  804a78:	00 00 00 
+  804a7b:	ff d0                	call   *%rax
+}
+  804a7d:	c9                   	leave
+  804a7e:	c3                   	ret
+
+0000000000804a7f <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804a7f:	55                   	push   %rbp
+  804a80:	48 89 e5             	mov    %rsp,%rbp
+  804a83:	41 54                	push   %r12
+  804a85:	53                   	push   %rbx
+  804a86:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804a89:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804a90:	00 00 00 
+  804a93:	ff d0                	call   *%rax
+  804a95:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804a98:	48 be cf 71 80 00 00 	movabs $0x8071cf,%rsi
+  804a9f:	00 00 00 
+  804aa2:	48 89 df             	mov    %rbx,%rdi
+  804aa5:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  804aac:	00 00 00 
+  804aaf:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804ab1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804ab6:	41 2b 04 24          	sub    (%r12),%eax
+  804aba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804ac0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804ac7:	00 00 00 
+    stat->st_dev = &devpipe;
+  804aca:	48 b8 a0 80 80 00 00 	movabs $0x8080a0,%rax
+  804ad1:	00 00 00 
+  804ad4:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae0:	5b                   	pop    %rbx
+  804ae1:	41 5c                	pop    %r12
+  804ae3:	5d                   	pop    %rbp
+  804ae4:	c3                   	ret
+
+0000000000804ae5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804ae5:	55                   	push   %rbp
+  804ae6:	48 89 e5             	mov    %rsp,%rbp
+  804ae9:	41 54                	push   %r12
+  804aeb:	53                   	push   %rbx
+  804aec:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804aef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804af4:	48 89 fe             	mov    %rdi,%rsi
+  804af7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afc:	49 bc e3 2a 80 00 00 	movabs $0x802ae3,%r12
+  804b03:	00 00 00 
+  804b06:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  804b09:	48 89 df             	mov    %rbx,%rdi
+  804b0c:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804b13:	00 00 00 
+  804b16:	ff d0                	call   *%rax
+  804b18:	48 89 c6             	mov    %rax,%rsi
+  804b1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b20:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b25:	41 ff d4             	call   *%r12
+}
+  804b28:	5b                   	pop    %rbx
+  804b29:	41 5c                	pop    %r12
+  804b2b:	5d                   	pop    %rbp
+  804b2c:	c3                   	ret
+
+0000000000804b2d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804b2d:	55                   	push   %rbp
+  804b2e:	48 89 e5             	mov    %rsp,%rbp
+  804b31:	41 57                	push   %r15
+  804b33:	41 56                	push   %r14
+  804b35:	41 55                	push   %r13
+  804b37:	41 54                	push   %r12
+  804b39:	53                   	push   %rbx
+  804b3a:	48 83 ec 18          	sub    $0x18,%rsp
+  804b3e:	49 89 fc             	mov    %rdi,%r12
+  804b41:	49 89 f5             	mov    %rsi,%r13
+  804b44:	49 89 d7             	mov    %rdx,%r15
+  804b47:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804b4b:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804b52:	00 00 00 
+  804b55:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804b57:	4d 85 ff             	test   %r15,%r15
+  804b5a:	0f 84 af 00 00 00    	je     804c0f <devpipe_write+0xe2>
+  804b60:	48 89 c3             	mov    %rax,%rbx
+  804b63:	4c 89 f8             	mov    %r15,%rax
+  804b66:	4d 89 ef             	mov    %r13,%r15
+  804b69:	4c 01 e8             	add    %r13,%rax
+  804b6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804b70:	49 bd d9 29 80 00 00 	movabs $0x8029d9,%r13
+  804b77:	00 00 00 
+            sys_yield();
+  804b7a:	49 be 6a 29 80 00 00 	movabs $0x80296a,%r14
+  804b81:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804b84:	8b 73 04             	mov    0x4(%rbx),%esi
+  804b87:	48 63 ce             	movslq %esi,%rcx
+  804b8a:	48 63 03             	movslq (%rbx),%rax
+  804b8d:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804b93:	48 39 c1             	cmp    %rax,%rcx
+  804b96:	72 2e                	jb     804bc6 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804b98:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804b9d:	48 89 da             	mov    %rbx,%rdx
+  804ba0:	be 00 10 00 00       	mov    $0x1000,%esi
+  804ba5:	4c 89 e7             	mov    %r12,%rdi
+  804ba8:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804bab:	85 c0                	test   %eax,%eax
+  804bad:	74 66                	je     804c15 <devpipe_write+0xe8>
+            sys_yield();
+  804baf:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804bb2:	8b 73 04             	mov    0x4(%rbx),%esi
+  804bb5:	48 63 ce             	movslq %esi,%rcx
+  804bb8:	48 63 03             	movslq (%rbx),%rax
+  804bbb:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  804bc1:	48 39 c1             	cmp    %rax,%rcx
+  804bc4:	73 d2                	jae    804b98 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804bc6:	41 0f b6 3f          	movzbl (%r15),%edi
+  804bca:	48 89 ca             	mov    %rcx,%rdx
+  804bcd:	48 c1 ea 03          	shr    $0x3,%rdx
+  804bd1:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  804bd8:	08 10 20 
+  804bdb:	48 f7 e2             	mul    %rdx
+  804bde:	48 c1 ea 06          	shr    $0x6,%rdx
+  804be2:	48 89 d0             	mov    %rdx,%rax
+  804be5:	48 c1 e0 09          	shl    $0x9,%rax
+  804be9:	48 29 d0             	sub    %rdx,%rax
+  804bec:	48 c1 e0 03          	shl    $0x3,%rax
+  804bf0:	48 29 c1             	sub    %rax,%rcx
+  804bf3:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  804bf8:	83 c6 01             	add    $0x1,%esi
+  804bfb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804bfe:	49 83 c7 01          	add    $0x1,%r15
+  804c02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c06:	49 39 c7             	cmp    %rax,%r15
+  804c09:	0f 85 75 ff ff ff    	jne    804b84 <devpipe_write+0x57>
+    return n;
+  804c0f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c13:	eb 05                	jmp    804c1a <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  804c15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c1a:	48 83 c4 18          	add    $0x18,%rsp
+  804c1e:	5b                   	pop    %rbx
+  804c1f:	41 5c                	pop    %r12
+  804c21:	41 5d                	pop    %r13
+  804c23:	41 5e                	pop    %r14
+  804c25:	41 5f                	pop    %r15
+  804c27:	5d                   	pop    %rbp
+  804c28:	c3                   	ret
+
+0000000000804c29 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c29:	55                   	push   %rbp
+  804c2a:	48 89 e5             	mov    %rsp,%rbp
+  804c2d:	41 57                	push   %r15
+  804c2f:	41 56                	push   %r14
+  804c31:	41 55                	push   %r13
+  804c33:	41 54                	push   %r12
+  804c35:	53                   	push   %rbx
+  804c36:	48 83 ec 18          	sub    $0x18,%rsp
+  804c3a:	49 89 fc             	mov    %rdi,%r12
+  804c3d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804c41:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c45:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804c4c:	00 00 00 
+  804c4f:	ff d0                	call   *%rax
+  804c51:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804c54:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c5a:	49 bd d9 29 80 00 00 	movabs $0x8029d9,%r13
+  804c61:	00 00 00 
+            sys_yield();
+  804c64:	49 be 6a 29 80 00 00 	movabs $0x80296a,%r14
+  804c6b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804c6e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804c73:	74 7d                	je     804cf2 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804c75:	8b 03                	mov    (%rbx),%eax
+  804c77:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804c7a:	75 26                	jne    804ca2 <devpipe_read+0x79>
+            if (i > 0) return i;
+  804c7c:	4d 85 ff             	test   %r15,%r15
+  804c7f:	75 77                	jne    804cf8 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804c81:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804c86:	48 89 da             	mov    %rbx,%rdx
+  804c89:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c8e:	4c 89 e7             	mov    %r12,%rdi
+  804c91:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804c94:	85 c0                	test   %eax,%eax
+  804c96:	74 72                	je     804d0a <devpipe_read+0xe1>
+            sys_yield();
+  804c98:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804c9b:	8b 03                	mov    (%rbx),%eax
+  804c9d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804ca0:	74 df                	je     804c81 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804ca2:	48 63 c8             	movslq %eax,%rcx
+  804ca5:	48 89 ca             	mov    %rcx,%rdx
+  804ca8:	48 c1 ea 03          	shr    $0x3,%rdx
+  804cac:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  804cb3:	08 10 20 
+  804cb6:	48 89 d0             	mov    %rdx,%rax
+  804cb9:	48 f7 e6             	mul    %rsi
+  804cbc:	48 c1 ea 06          	shr    $0x6,%rdx
+  804cc0:	48 89 d0             	mov    %rdx,%rax
+  804cc3:	48 c1 e0 09          	shl    $0x9,%rax
+  804cc7:	48 29 d0             	sub    %rdx,%rax
+  804cca:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804cd1:	00 
+  804cd2:	48 89 c8             	mov    %rcx,%rax
+  804cd5:	48 29 d0             	sub    %rdx,%rax
+  804cd8:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  804cdd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804ce1:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804ce5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804ce8:	49 83 c7 01          	add    $0x1,%r15
+  804cec:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804cf0:	75 83                	jne    804c75 <devpipe_read+0x4c>
+    return n;
+  804cf2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cf6:	eb 03                	jmp    804cfb <devpipe_read+0xd2>
+            if (i > 0) return i;
+  804cf8:	4c 89 f8             	mov    %r15,%rax
+}
+  804cfb:	48 83 c4 18          	add    $0x18,%rsp
+  804cff:	5b                   	pop    %rbx
+  804d00:	41 5c                	pop    %r12
+  804d02:	41 5d                	pop    %r13
+  804d04:	41 5e                	pop    %r14
+  804d06:	41 5f                	pop    %r15
+  804d08:	5d                   	pop    %rbp
+  804d09:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  804d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d0f:	eb ea                	jmp    804cfb <devpipe_read+0xd2>
+
+0000000000804d11 <pipe>:
+pipe(int pfd[2]) {
+  804d11:	55                   	push   %rbp
+  804d12:	48 89 e5             	mov    %rsp,%rbp
+  804d15:	41 55                	push   %r13
+  804d17:	41 54                	push   %r12
+  804d19:	53                   	push   %rbx
+  804d1a:	48 83 ec 18          	sub    $0x18,%rsp
+  804d1e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804d21:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804d25:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  804d2c:	00 00 00 
+  804d2f:	ff d0                	call   *%rax
+  804d31:	89 c3                	mov    %eax,%ebx
+  804d33:	85 c0                	test   %eax,%eax
+  804d35:	0f 88 a0 01 00 00    	js     804edb <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804d3b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804d40:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d45:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804d49:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d4e:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  804d55:	00 00 00 
+  804d58:	ff d0                	call   *%rax
+  804d5a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804d5c:	85 c0                	test   %eax,%eax
+  804d5e:	0f 88 77 01 00 00    	js     804edb <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804d64:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804d68:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  804d6f:	00 00 00 
+  804d72:	ff d0                	call   *%rax
+  804d74:	89 c3                	mov    %eax,%ebx
+  804d76:	85 c0                	test   %eax,%eax
+  804d78:	0f 88 43 01 00 00    	js     804ec1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804d7e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804d83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d88:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804d8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d91:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  804d98:	00 00 00 
+  804d9b:	ff d0                	call   *%rax
+  804d9d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804d9f:	85 c0                	test   %eax,%eax
+  804da1:	0f 88 1a 01 00 00    	js     804ec1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804da7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804dab:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804db2:	00 00 00 
+  804db5:	ff d0                	call   *%rax
+  804db7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804dba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804dbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804dc4:	48 89 c6             	mov    %rax,%rsi
+  804dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dcc:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  804dd3:	00 00 00 
+  804dd6:	ff d0                	call   *%rax
+  804dd8:	89 c3                	mov    %eax,%ebx
+  804dda:	85 c0                	test   %eax,%eax
+  804ddc:	0f 88 c5 00 00 00    	js     804ea7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804de2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804de6:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804ded:	00 00 00 
+  804df0:	ff d0                	call   *%rax
+  804df2:	48 89 c1             	mov    %rax,%rcx
+  804df5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804dfb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e06:	4c 89 ee             	mov    %r13,%rsi
+  804e09:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e0e:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  804e15:	00 00 00 
+  804e18:	ff d0                	call   *%rax
+  804e1a:	89 c3                	mov    %eax,%ebx
+  804e1c:	85 c0                	test   %eax,%eax
+  804e1e:	78 6e                	js     804e8e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804e20:	be 00 10 00 00       	mov    $0x1000,%esi
+  804e25:	4c 89 ef             	mov    %r13,%rdi
+  804e28:	48 b8 a1 29 80 00 00 	movabs $0x8029a1,%rax
+  804e2f:	00 00 00 
+  804e32:	ff d0                	call   *%rax
+  804e34:	83 f8 02             	cmp    $0x2,%eax
+  804e37:	0f 85 ab 00 00 00    	jne    804ee8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804e3d:	a1 a0 80 80 00 00 00 	movabs 0x8080a0,%eax
+  804e44:	00 00 
+  804e46:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e4a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804e4c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804e50:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804e57:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804e5b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804e5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e61:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804e68:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804e6c:	48 bb 1b 32 80 00 00 	movabs $0x80321b,%rbx
+  804e73:	00 00 00 
+  804e76:	ff d3                	call   *%rbx
+  804e78:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804e7c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804e80:	ff d3                	call   *%rbx
+  804e82:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804e87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804e8c:	eb 4d                	jmp    804edb <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804e8e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804e93:	4c 89 ee             	mov    %r13,%rsi
+  804e96:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e9b:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  804ea2:	00 00 00 
+  804ea5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804ea7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804eac:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804eb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804eb5:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  804ebc:	00 00 00 
+  804ebf:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804ec1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ec6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ecf:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  804ed6:	00 00 00 
+  804ed9:	ff d0                	call   *%rax
+}
+  804edb:	89 d8                	mov    %ebx,%eax
+  804edd:	48 83 c4 18          	add    $0x18,%rsp
+  804ee1:	5b                   	pop    %rbx
+  804ee2:	41 5c                	pop    %r12
+  804ee4:	41 5d                	pop    %r13
+  804ee6:	5d                   	pop    %rbp
+  804ee7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804ee8:	48 b9 e8 71 80 00 00 	movabs $0x8071e8,%rcx
+  804eef:	00 00 00 
+  804ef2:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  804ef9:	00 00 00 
+  804efc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804f01:	48 bf d6 71 80 00 00 	movabs $0x8071d6,%rdi
+  804f08:	00 00 00 
+  804f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f10:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  804f17:	00 00 00 
+  804f1a:	41 ff d0             	call   *%r8
+
+0000000000804f1d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804f1d:	55                   	push   %rbp
+  804f1e:	48 89 e5             	mov    %rsp,%rbp
+  804f21:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804f25:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804f29:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  804f30:	00 00 00 
+  804f33:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804f35:	85 c0                	test   %eax,%eax
+  804f37:	78 35                	js     804f6e <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804f39:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f3d:	48 b8 2d 32 80 00 00 	movabs $0x80322d,%rax
+  804f44:	00 00 00 
+  804f47:	ff d0                	call   *%rax
+  804f49:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804f4c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804f51:	be 00 10 00 00       	mov    $0x1000,%esi
+  804f56:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f5a:	48 b8 d9 29 80 00 00 	movabs $0x8029d9,%rax
+  804f61:	00 00 00 
+  804f64:	ff d0                	call   *%rax
+  804f66:	85 c0                	test   %eax,%eax
+  804f68:	0f 94 c0             	sete   %al
+  804f6b:	0f b6 c0             	movzbl %al,%eax
+}
+  804f6e:	c9                   	leave
+  804f6f:	c3                   	ret
+
+0000000000804f70 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804f70:	55                   	push   %rbp
+  804f71:	48 89 e5             	mov    %rsp,%rbp
+  804f74:	41 55                	push   %r13
+  804f76:	41 54                	push   %r12
+  804f78:	53                   	push   %rbx
+  804f79:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  804f7d:	85 ff                	test   %edi,%edi
+  804f7f:	74 73                	je     804ff4 <wait+0x84>
+  804f81:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804f84:	89 f8                	mov    %edi,%eax
+  804f86:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  804f8b:	89 f9                	mov    %edi,%ecx
+  804f8d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  804f93:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  804f9a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804fa1:	00 00 00 
+  804fa4:	48 01 ca             	add    %rcx,%rdx
+  804fa7:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  804fad:	39 d7                	cmp    %edx,%edi
+  804faf:	75 38                	jne    804fe9 <wait+0x79>
+           env->env_status != ENV_FREE) {
+  804fb1:	48 98                	cltq
+  804fb3:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  804fba:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  804fc1:	00 00 00 
+  804fc4:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  804fc7:	49 bd 6a 29 80 00 00 	movabs $0x80296a,%r13
+  804fce:	00 00 00 
+           env->env_status != ENV_FREE) {
+  804fd1:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  804fd7:	85 c0                	test   %eax,%eax
+  804fd9:	74 0e                	je     804fe9 <wait+0x79>
+        sys_yield();
+  804fdb:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  804fde:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804fe4:	44 39 e0             	cmp    %r12d,%eax
+  804fe7:	74 e8                	je     804fd1 <wait+0x61>
+    }
+}
+  804fe9:	48 83 c4 08          	add    $0x8,%rsp
+  804fed:	5b                   	pop    %rbx
+  804fee:	41 5c                	pop    %r12
+  804ff0:	41 5d                	pop    %r13
+  804ff2:	5d                   	pop    %rbp
+  804ff3:	c3                   	ret
+    assert(envid != 0);
+  804ff4:	48 b9 0c 72 80 00 00 	movabs $0x80720c,%rcx
+  804ffb:	00 00 00 
+  804ffe:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  805005:	00 00 00 
+  805008:	be 06 00 00 00       	mov    $0x6,%esi
+  80500d:	48 bf 17 72 80 00 00 	movabs $0x807217,%rdi
+  805014:	00 00 00 
+  805017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501c:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  805023:	00 00 00 
+  805026:	41 ff d0             	call   *%r8
+
+0000000000805029 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805029:	48 89 f8             	mov    %rdi,%rax
+  80502c:	48 c1 e8 27          	shr    $0x27,%rax
+  805030:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805037:	01 00 00 
+  80503a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80503e:	f6 c2 01             	test   $0x1,%dl
+  805041:	74 6d                	je     8050b0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805043:	48 89 f8             	mov    %rdi,%rax
+  805046:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80504a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805051:	01 00 00 
+  805054:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805058:	f6 c2 01             	test   $0x1,%dl
+  80505b:	74 62                	je     8050bf <get_uvpt_entry+0x96>
+  80505d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805064:	01 00 00 
+  805067:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80506b:	f6 c2 80             	test   $0x80,%dl
+  80506e:	75 4f                	jne    8050bf <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805070:	48 89 f8             	mov    %rdi,%rax
+  805073:	48 c1 e8 15          	shr    $0x15,%rax
+  805077:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80507e:	01 00 00 
+  805081:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805085:	f6 c2 01             	test   $0x1,%dl
+  805088:	74 44                	je     8050ce <get_uvpt_entry+0xa5>
+  80508a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805091:	01 00 00 
+  805094:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805098:	f6 c2 80             	test   $0x80,%dl
+  80509b:	75 31                	jne    8050ce <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80509d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8050a1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8050a8:	01 00 00 
+  8050ab:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8050af:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8050b0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8050b7:	01 00 00 
+  8050ba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050be:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8050bf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8050c6:	01 00 00 
+  8050c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050cd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8050ce:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8050d5:	01 00 00 
+  8050d8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8050dc:	c3                   	ret
+
+00000000008050dd <get_prot>:
+
+int
+get_prot(void *va) {
+  8050dd:	55                   	push   %rbp
+  8050de:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8050e1:	48 b8 29 50 80 00 00 	movabs $0x805029,%rax
+  8050e8:	00 00 00 
+  8050eb:	ff d0                	call   *%rax
+  8050ed:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8050f0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8050f5:	89 c1                	mov    %eax,%ecx
+  8050f7:	83 c9 04             	or     $0x4,%ecx
+  8050fa:	f6 c2 01             	test   $0x1,%dl
+  8050fd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805100:	89 c1                	mov    %eax,%ecx
+  805102:	83 c9 02             	or     $0x2,%ecx
+  805105:	f6 c2 02             	test   $0x2,%dl
+  805108:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80510b:	89 c1                	mov    %eax,%ecx
+  80510d:	83 c9 01             	or     $0x1,%ecx
+  805110:	48 85 d2             	test   %rdx,%rdx
+  805113:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805116:	89 c1                	mov    %eax,%ecx
+  805118:	83 c9 40             	or     $0x40,%ecx
+  80511b:	f6 c6 04             	test   $0x4,%dh
+  80511e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805121:	5d                   	pop    %rbp
+  805122:	c3                   	ret
+
+0000000000805123 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805123:	55                   	push   %rbp
+  805124:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805127:	48 b8 29 50 80 00 00 	movabs $0x805029,%rax
+  80512e:	00 00 00 
+  805131:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805133:	48 c1 e8 06          	shr    $0x6,%rax
+  805137:	83 e0 01             	and    $0x1,%eax
+}
+  80513a:	5d                   	pop    %rbp
+  80513b:	c3                   	ret
+
+000000000080513c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80513c:	55                   	push   %rbp
+  80513d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805140:	48 b8 29 50 80 00 00 	movabs $0x805029,%rax
+  805147:	00 00 00 
+  80514a:	ff d0                	call   *%rax
+  80514c:	83 e0 01             	and    $0x1,%eax
+}
+  80514f:	5d                   	pop    %rbp
+  805150:	c3                   	ret
+
+0000000000805151 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805151:	55                   	push   %rbp
+  805152:	48 89 e5             	mov    %rsp,%rbp
+  805155:	41 57                	push   %r15
+  805157:	41 56                	push   %r14
+  805159:	41 55                	push   %r13
+  80515b:	41 54                	push   %r12
+  80515d:	53                   	push   %rbx
+  80515e:	48 83 ec 28          	sub    $0x28,%rsp
+  805162:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  805166:	48 85 ff             	test   %rdi,%rdi
+  805169:	74 1e                	je     805189 <foreach_shared_region+0x38>
+  80516b:	49 89 ff             	mov    %rdi,%r15
+  80516e:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  805174:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80517a:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  805181:	01 00 00 
+  805184:	e9 72 02 00 00       	jmp    8053fb <foreach_shared_region+0x2aa>
+    assert(fun);
+  805189:	48 b9 22 72 80 00 00 	movabs $0x807222,%rcx
+  805190:	00 00 00 
+  805193:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  80519a:	00 00 00 
+  80519d:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8051a2:	48 bf 26 72 80 00 00 	movabs $0x807226,%rdi
+  8051a9:	00 00 00 
+  8051ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b1:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8051b8:	00 00 00 
+  8051bb:	41 ff d0             	call   *%r8
+  8051be:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8051c5:	eb 6c                	jmp    805233 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8051c7:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8051ce:	ff ff ff 
+  8051d1:	4c 21 e2             	and    %r12,%rdx
+  8051d4:	48 89 d8             	mov    %rbx,%rax
+  8051d7:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8051dc:	48 83 c0 01          	add    $0x1,%rax
+  8051e0:	48 c1 e0 1e          	shl    $0x1e,%rax
+  8051e4:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8051eb:	00 00 00 
+  8051ee:	48 21 c8             	and    %rcx,%rax
+  8051f1:	48 09 d0             	or     %rdx,%rax
+  8051f4:	49 89 c4             	mov    %rax,%r12
+  8051f7:	eb 30                	jmp    805229 <foreach_shared_region+0xd8>
+  8051f9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805200:	ff ff ff 
+  805203:	4c 21 e2             	and    %r12,%rdx
+  805206:	48 89 d8             	mov    %rbx,%rax
+  805209:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80520e:	48 83 c0 01          	add    $0x1,%rax
+  805212:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805216:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80521d:	00 00 00 
+  805220:	48 21 c8             	and    %rcx,%rax
+  805223:	48 09 d0             	or     %rdx,%rax
+  805226:	49 89 c4             	mov    %rax,%r12
+  805229:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80522d:	0f 84 99 01 00 00    	je     8053cc <foreach_shared_region+0x27b>
+  805233:	4c 89 e3             	mov    %r12,%rbx
+  805236:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80523a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805241:	01 00 00 
+  805244:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  805248:	a8 01                	test   $0x1,%al
+  80524a:	0f 84 77 ff ff ff    	je     8051c7 <foreach_shared_region+0x76>
+  805250:	a8 80                	test   $0x80,%al
+  805252:	74 19                	je     80526d <foreach_shared_region+0x11c>
+  805254:	f6 c4 04             	test   $0x4,%ah
+  805257:	74 a0                	je     8051f9 <foreach_shared_region+0xa8>
+  805259:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  805260:	40 
+  805261:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805265:	4c 89 e7             	mov    %r12,%rdi
+  805268:	41 ff d7             	call   *%r15
+  80526b:	eb 8c                	jmp    8051f9 <foreach_shared_region+0xa8>
+  80526d:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  805274:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  805278:	eb 46                	jmp    8052c0 <foreach_shared_region+0x16f>
+  80527a:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  805281:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805287:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  80528b:	48 c1 e0 15          	shl    $0x15,%rax
+  80528f:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  805294:	49 09 c4             	or     %rax,%r12
+  805297:	eb 1d                	jmp    8052b6 <foreach_shared_region+0x165>
+  805299:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8052a0:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8052a6:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8052aa:	48 c1 e0 15          	shl    $0x15,%rax
+  8052ae:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8052b3:	49 09 c4             	or     %rax,%r12
+  8052b6:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8052ba:	0f 84 d3 00 00 00    	je     805393 <foreach_shared_region+0x242>
+  8052c0:	4c 89 e3             	mov    %r12,%rbx
+  8052c3:	48 c1 eb 15          	shr    $0x15,%rbx
+  8052c7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8052ce:	01 00 00 
+  8052d1:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8052d5:	a8 01                	test   $0x1,%al
+  8052d7:	74 a1                	je     80527a <foreach_shared_region+0x129>
+  8052d9:	a8 80                	test   $0x80,%al
+  8052db:	74 19                	je     8052f6 <foreach_shared_region+0x1a5>
+  8052dd:	f6 c4 04             	test   $0x4,%ah
+  8052e0:	74 b7                	je     805299 <foreach_shared_region+0x148>
+  8052e2:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  8052e9:	00 
+  8052ea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8052ee:	4c 89 e7             	mov    %r12,%rdi
+  8052f1:	41 ff d7             	call   *%r15
+  8052f4:	eb a3                	jmp    805299 <foreach_shared_region+0x148>
+  8052f6:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  8052fc:	eb 3b                	jmp    805339 <foreach_shared_region+0x1e8>
+  8052fe:	f6 c4 04             	test   $0x4,%ah
+  805301:	74 12                	je     805315 <foreach_shared_region+0x1c4>
+  805303:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80530a:	00 
+  80530b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80530f:	4c 89 e7             	mov    %r12,%rdi
+  805312:	41 ff d7             	call   *%r15
+  805315:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80531c:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805322:	48 83 c3 01          	add    $0x1,%rbx
+  805326:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80532a:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805330:	49 09 dc             	or     %rbx,%r12
+  805333:	41 83 ed 01          	sub    $0x1,%r13d
+  805337:	74 2f                	je     805368 <foreach_shared_region+0x217>
+  805339:	4c 89 e3             	mov    %r12,%rbx
+  80533c:	48 c1 eb 0c          	shr    $0xc,%rbx
+  805340:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805344:	a8 01                	test   $0x1,%al
+  805346:	75 b6                	jne    8052fe <foreach_shared_region+0x1ad>
+  805348:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80534f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805355:	48 83 c3 01          	add    $0x1,%rbx
+  805359:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80535d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805363:	49 09 dc             	or     %rbx,%r12
+  805366:	eb cb                	jmp    805333 <foreach_shared_region+0x1e2>
+  805368:	4c 89 e0             	mov    %r12,%rax
+  80536b:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  805371:	49 c1 ec 15          	shr    $0x15,%r12
+  805375:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80537c:	49 83 c4 01          	add    $0x1,%r12
+  805380:	49 c1 e4 15          	shl    $0x15,%r12
+  805384:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  80538b:	49 09 c4             	or     %rax,%r12
+  80538e:	e9 23 ff ff ff       	jmp    8052b6 <foreach_shared_region+0x165>
+  805393:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  805397:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  80539e:	ff ff ff 
+  8053a1:	4c 21 e0             	and    %r12,%rax
+  8053a4:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8053a8:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8053af:	49 83 c4 01          	add    $0x1,%r12
+  8053b3:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8053b7:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8053be:	00 00 00 
+  8053c1:	49 21 d4             	and    %rdx,%r12
+  8053c4:	49 09 c4             	or     %rax,%r12
+  8053c7:	e9 5d fe ff ff       	jmp    805229 <foreach_shared_region+0xd8>
+  8053cc:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8053d3:	00 ff ff 
+  8053d6:	4c 21 e0             	and    %r12,%rax
+  8053d9:	49 c1 ec 27          	shr    $0x27,%r12
+  8053dd:	49 83 c4 01          	add    $0x1,%r12
+  8053e1:	49 c1 e4 27          	shl    $0x27,%r12
+  8053e5:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  8053ec:	ff 00 00 
+  8053ef:	49 21 d4             	and    %rdx,%r12
+  8053f2:	49 09 c4             	or     %rax,%r12
+  8053f5:	41 83 ed 01          	sub    $0x1,%r13d
+  8053f9:	74 48                	je     805443 <foreach_shared_region+0x2f2>
+  8053fb:	4c 89 e0             	mov    %r12,%rax
+  8053fe:	48 c1 e8 27          	shr    $0x27,%rax
+  805402:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  805409:	01 00 00 
+  80540c:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  805410:	f6 c2 01             	test   $0x1,%dl
+  805413:	0f 85 a5 fd ff ff    	jne    8051be <foreach_shared_region+0x6d>
+  805419:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805420:	00 ff ff 
+  805423:	4c 21 e2             	and    %r12,%rdx
+  805426:	48 83 c0 01          	add    $0x1,%rax
+  80542a:	48 c1 e0 27          	shl    $0x27,%rax
+  80542e:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  805435:	ff 00 00 
+  805438:	48 21 c8             	and    %rcx,%rax
+  80543b:	48 09 d0             	or     %rdx,%rax
+  80543e:	49 89 c4             	mov    %rax,%r12
+  805441:	eb b2                	jmp    8053f5 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805443:	4d 85 e4             	test   %r12,%r12
+  805446:	75 14                	jne    80545c <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  805448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80544d:	48 83 c4 28          	add    $0x28,%rsp
+  805451:	5b                   	pop    %rbx
+  805452:	41 5c                	pop    %r12
+  805454:	41 5d                	pop    %r13
+  805456:	41 5e                	pop    %r14
+  805458:	41 5f                	pop    %r15
+  80545a:	5d                   	pop    %rbp
+  80545b:	c3                   	ret
+    assert(addr == 0);
+  80545c:	48 b9 31 72 80 00 00 	movabs $0x807231,%rcx
+  805463:	00 00 00 
+  805466:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  80546d:	00 00 00 
+  805470:	be 67 00 00 00       	mov    $0x67,%esi
+  805475:	48 bf 26 72 80 00 00 	movabs $0x807226,%rdi
+  80547c:	00 00 00 
+  80547f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805484:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  80548b:	00 00 00 
+  80548e:	41 ff d0             	call   *%r8
+
+0000000000805491 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  805491:	49 b8 40 cc 80 01 00 	movabs $0x180cc40,%r8
+  805498:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  80549b:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8054a1:	eb 33                	jmp    8054d6 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8054a3:	48 83 c0 20          	add    $0x20,%rax
+  8054a7:	4c 39 c0             	cmp    %r8,%rax
+  8054aa:	74 25                	je     8054d1 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8054ac:	48 8b 10             	mov    (%rax),%rdx
+  8054af:	48 85 d2             	test   %rdx,%rdx
+  8054b2:	74 ef                	je     8054a3 <mmap_place+0x12>
+  8054b4:	48 89 d1             	mov    %rdx,%rcx
+  8054b7:	48 03 48 08          	add    0x8(%rax),%rcx
+  8054bb:	48 39 cf             	cmp    %rcx,%rdi
+  8054be:	73 e3                	jae    8054a3 <mmap_place+0x12>
+  8054c0:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8054c4:	4c 39 ca             	cmp    %r9,%rdx
+  8054c7:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8054cb:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8054cf:	eb d2                	jmp    8054a3 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8054d1:	45 84 d2             	test   %r10b,%r10b
+  8054d4:	74 12                	je     8054e8 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8054d6:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  8054dd:	00 00 00 
+        moved = 0;
+  8054e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  8054e6:	eb c4                	jmp    8054ac <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  8054e8:	48 01 fe             	add    %rdi,%rsi
+  8054eb:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  8054f2:	00 00 00 
+  8054f5:	48 39 f0             	cmp    %rsi,%rax
+  8054f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054fd:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  805501:	c3                   	ret
+
+0000000000805502 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  805502:	55                   	push   %rbp
+  805503:	48 89 e5             	mov    %rsp,%rbp
+  805506:	41 57                	push   %r15
+  805508:	41 56                	push   %r14
+  80550a:	41 55                	push   %r13
+  80550c:	41 54                	push   %r12
+  80550e:	53                   	push   %rbx
+  80550f:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  805513:	48 8b 1f             	mov    (%rdi),%rbx
+  805516:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80551d:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805524:	00 00 00 
+  805527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80552c:	eb 12                	jmp    805540 <mmap_pgfault+0x3e>
+  80552e:	48 83 c2 01          	add    $0x1,%rdx
+  805532:	48 83 c0 20          	add    $0x20,%rax
+  805536:	48 83 fa 20          	cmp    $0x20,%rdx
+  80553a:	0f 84 04 01 00 00    	je     805644 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805540:	48 8b 08             	mov    (%rax),%rcx
+  805543:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805547:	48 39 de             	cmp    %rbx,%rsi
+  80554a:	73 e2                	jae    80552e <mmap_pgfault+0x2c>
+  80554c:	48 03 48 08          	add    0x8(%rax),%rcx
+  805550:	48 39 cb             	cmp    %rcx,%rbx
+  805553:	73 d9                	jae    80552e <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  805555:	48 c1 e2 05          	shl    $0x5,%rdx
+  805559:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805560:	00 00 00 
+  805563:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805567:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  80556b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80556f:	f6 c2 01             	test   $0x1,%dl
+  805572:	0f 84 e0 00 00 00    	je     805658 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80557d:	f6 c2 02             	test   $0x2,%dl
+  805580:	0f 84 c3 00 00 00    	je     805649 <mmap_pgfault+0x147>
+  805586:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  80558d:	ff ff ff 
+  805590:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805594:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  80559b:	00 00 00 
+  80559e:	48 39 ca             	cmp    %rcx,%rdx
+  8055a1:	0f 85 a2 00 00 00    	jne    805649 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  8055a7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8055ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055b1:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  8055b8:	00 00 00 
+  8055bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055c0:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  8055c7:	00 00 00 
+  8055ca:	ff d0                	call   *%rax
+  8055cc:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  8055ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055d3:	85 d2                	test   %edx,%edx
+  8055d5:	78 72                	js     805649 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  8055d7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055dc:	48 89 de             	mov    %rbx,%rsi
+  8055df:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  8055e6:	00 00 00 
+  8055e9:	4c 89 e7             	mov    %r12,%rdi
+  8055ec:	48 b8 5d 26 80 00 00 	movabs $0x80265d,%rax
+  8055f3:	00 00 00 
+  8055f6:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  8055f8:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8055fe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805604:	48 89 d9             	mov    %rbx,%rcx
+  805607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80560c:	4c 89 e6             	mov    %r12,%rsi
+  80560f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805614:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  80561b:	00 00 00 
+  80561e:	ff d0                	call   *%rax
+  805620:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805622:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805627:	4c 89 e6             	mov    %r12,%rsi
+  80562a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80562f:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  805636:	00 00 00 
+  805639:	ff d0                	call   *%rax
+    return res >= 0;
+  80563b:	89 d8                	mov    %ebx,%eax
+  80563d:	f7 d0                	not    %eax
+  80563f:	c1 e8 1f             	shr    $0x1f,%eax
+  805642:	eb 05                	jmp    805649 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805644:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805649:	48 83 c4 18          	add    $0x18,%rsp
+  80564d:	5b                   	pop    %rbx
+  80564e:	41 5c                	pop    %r12
+  805650:	41 5d                	pop    %r13
+  805652:	41 5e                	pop    %r14
+  805654:	41 5f                	pop    %r15
+  805656:	5d                   	pop    %rbp
+  805657:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805658:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80565c:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805660:	4c 03 30             	add    (%rax),%r14
+  805663:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  80566a:	49 39 c6             	cmp    %rax,%r14
+  80566d:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805671:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805678:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  80567e:	49 bf 3c 51 80 00 00 	movabs $0x80513c,%r15
+  805685:	00 00 00 
+  805688:	4d 39 f4             	cmp    %r14,%r12
+  80568b:	73 1d                	jae    8056aa <mmap_pgfault+0x1a8>
+  80568d:	4c 89 e7             	mov    %r12,%rdi
+  805690:	41 ff d7             	call   *%r15
+  805693:	84 c0                	test   %al,%al
+  805695:	75 13                	jne    8056aa <mmap_pgfault+0x1a8>
+  805697:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80569e:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8056a5:	4d 39 f4             	cmp    %r14,%r12
+  8056a8:	72 e3                	jb     80568d <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8056aa:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  8056b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056b4:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  8056b8:	74 2a                	je     8056e4 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  8056ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8056be:	89 de                	mov    %ebx,%esi
+  8056c0:	2b 30                	sub    (%rax),%esi
+  8056c2:	03 70 1c             	add    0x1c(%rax),%esi
+  8056c5:	8b 78 18             	mov    0x18(%rax),%edi
+  8056c8:	4c 89 e9             	mov    %r13,%rcx
+  8056cb:	48 89 da             	mov    %rbx,%rdx
+  8056ce:	48 b8 06 3f 80 00 00 	movabs $0x803f06,%rax
+  8056d5:	00 00 00 
+  8056d8:	ff d0                	call   *%rax
+    return res > 0;
+  8056da:	85 c0                	test   %eax,%eax
+  8056dc:	0f 9f c0             	setg   %al
+  8056df:	e9 65 ff ff ff       	jmp    805649 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  8056e4:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  8056e8:	eb d0                	jmp    8056ba <mmap_pgfault+0x1b8>
+
+00000000008056ea <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  8056ea:	55                   	push   %rbp
+  8056eb:	48 89 e5             	mov    %rsp,%rbp
+  8056ee:	41 57                	push   %r15
+  8056f0:	41 56                	push   %r14
+  8056f2:	41 55                	push   %r13
+  8056f4:	41 54                	push   %r12
+  8056f6:	53                   	push   %rbx
+  8056f7:	48 83 ec 28          	sub    $0x28,%rsp
+  8056fb:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  8056ff:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  805702:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805709:	ff ff ff 
+  80570c:	48 23 57 10          	and    0x10(%rdi),%rdx
+  805710:	b8 00 00 00 00       	mov    $0x0,%eax
+  805715:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  80571c:	00 00 00 
+  80571f:	48 39 ca             	cmp    %rcx,%rdx
+  805722:	0f 85 e5 00 00 00    	jne    80580d <mmap_writeback+0x123>
+  805728:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  80572b:	4c 39 ee             	cmp    %r13,%rsi
+  80572e:	0f 83 e8 00 00 00    	jae    80581c <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805734:	49 be 3c 51 80 00 00 	movabs $0x80513c,%r14
+  80573b:	00 00 00 
+  80573e:	49 bf 23 51 80 00 00 	movabs $0x805123,%r15
+  805745:	00 00 00 
+  805748:	eb 10                	jmp    80575a <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  80574a:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805751:	4d 39 ec             	cmp    %r13,%r12
+  805754:	0f 83 ae 00 00 00    	jae    805808 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  80575a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80575e:	4c 89 e7             	mov    %r12,%rdi
+  805761:	41 ff d6             	call   *%r14
+  805764:	84 c0                	test   %al,%al
+  805766:	74 e2                	je     80574a <mmap_writeback+0x60>
+  805768:	4c 89 e7             	mov    %r12,%rdi
+  80576b:	41 ff d7             	call   *%r15
+  80576e:	84 c0                	test   %al,%al
+  805770:	74 d8                	je     80574a <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805772:	4c 89 e3             	mov    %r12,%rbx
+  805775:	4d 39 ec             	cmp    %r13,%r12
+  805778:	73 20                	jae    80579a <mmap_writeback+0xb0>
+  80577a:	48 89 df             	mov    %rbx,%rdi
+  80577d:	41 ff d6             	call   *%r14
+  805780:	84 c0                	test   %al,%al
+  805782:	74 16                	je     80579a <mmap_writeback+0xb0>
+  805784:	48 89 df             	mov    %rbx,%rdi
+  805787:	41 ff d7             	call   *%r15
+  80578a:	84 c0                	test   %al,%al
+  80578c:	74 0c                	je     80579a <mmap_writeback+0xb0>
+  80578e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805795:	4c 39 eb             	cmp    %r13,%rbx
+  805798:	72 e0                	jb     80577a <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  80579a:	48 89 d9             	mov    %rbx,%rcx
+  80579d:	4c 29 e1             	sub    %r12,%rcx
+  8057a0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8057a4:	44 89 e6             	mov    %r12d,%esi
+  8057a7:	2b 30                	sub    (%rax),%esi
+  8057a9:	49 89 c4             	mov    %rax,%r12
+  8057ac:	03 70 1c             	add    0x1c(%rax),%esi
+  8057af:	8b 78 18             	mov    0x18(%rax),%edi
+  8057b2:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8057b6:	48 89 ca             	mov    %rcx,%rdx
+  8057b9:	48 b8 8f 3f 80 00 00 	movabs $0x803f8f,%rax
+  8057c0:	00 00 00 
+  8057c3:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8057c5:	85 c0                	test   %eax,%eax
+  8057c7:	78 44                	js     80580d <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  8057c9:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  8057ce:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  8057d1:	41 89 c1             	mov    %eax,%r9d
+  8057d4:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  8057db:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  8057df:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8057e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057e8:	48 89 ce             	mov    %rcx,%rsi
+  8057eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057f0:	48 b8 78 2a 80 00 00 	movabs $0x802a78,%rax
+  8057f7:	00 00 00 
+  8057fa:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  8057fc:	85 c0                	test   %eax,%eax
+  8057fe:	78 0d                	js     80580d <mmap_writeback+0x123>
+  805800:	49 89 dc             	mov    %rbx,%r12
+  805803:	e9 49 ff ff ff       	jmp    805751 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  805808:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80580d:	48 83 c4 28          	add    $0x28,%rsp
+  805811:	5b                   	pop    %rbx
+  805812:	41 5c                	pop    %r12
+  805814:	41 5d                	pop    %r13
+  805816:	41 5e                	pop    %r14
+  805818:	41 5f                	pop    %r15
+  80581a:	5d                   	pop    %rbp
+  80581b:	c3                   	ret
+    return 0;
+  80581c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805821:	eb ea                	jmp    80580d <mmap_writeback+0x123>
+
+0000000000805823 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805823:	55                   	push   %rbp
+  805824:	48 89 e5             	mov    %rsp,%rbp
+  805827:	41 57                	push   %r15
+  805829:	41 56                	push   %r14
+  80582b:	41 55                	push   %r13
+  80582d:	41 54                	push   %r12
+  80582f:	53                   	push   %rbx
+  805830:	48 83 ec 38          	sub    $0x38,%rsp
+  805834:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805838:	48 85 f6             	test   %rsi,%rsi
+  80583b:	0f 84 0c 02 00 00    	je     805a4d <mmap+0x22a>
+  805841:	49 89 ff             	mov    %rdi,%r15
+  805844:	49 89 f4             	mov    %rsi,%r12
+  805847:	41 89 d5             	mov    %edx,%r13d
+  80584a:	41 89 ce             	mov    %ecx,%r14d
+  80584d:	44 89 cb             	mov    %r9d,%ebx
+  805850:	45 85 c9             	test   %r9d,%r9d
+  805853:	0f 88 f4 01 00 00    	js     805a4d <mmap+0x22a>
+  805859:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805860:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805867:	0f 85 e7 01 00 00    	jne    805a54 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  80586d:	83 e2 fd             	and    $0xfffffffd,%edx
+  805870:	83 fa 04             	cmp    $0x4,%edx
+  805873:	0f 85 db 01 00 00    	jne    805a54 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805879:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80587c:	83 fa 01             	cmp    $0x1,%edx
+  80587f:	0f 87 cf 01 00 00    	ja     805a54 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805885:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805889:	44 89 c7             	mov    %r8d,%edi
+  80588c:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  805893:	00 00 00 
+  805896:	ff d0                	call   *%rax
+  805898:	89 c2                	mov    %eax,%edx
+  80589a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8058a1:	85 d2                	test   %edx,%edx
+  8058a3:	0f 88 ab 01 00 00    	js     805a54 <mmap+0x231>
+  8058a9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8058ad:	48 b9 60 80 80 00 00 	movabs $0x808060,%rcx
+  8058b4:	00 00 00 
+  8058b7:	8b 09                	mov    (%rcx),%ecx
+  8058b9:	39 0a                	cmp    %ecx,(%rdx)
+  8058bb:	0f 85 93 01 00 00    	jne    805a54 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  8058c1:	8b 52 08             	mov    0x8(%rdx),%edx
+  8058c4:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  8058c7:	83 fa 01             	cmp    $0x1,%edx
+  8058ca:	0f 84 84 01 00 00    	je     805a54 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  8058d0:	41 83 fe 01          	cmp    $0x1,%r14d
+  8058d4:	74 42                	je     805918 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  8058d6:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  8058dd:	4c 89 e6             	mov    %r12,%rsi
+  8058e0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8058e7:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  8058eb:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  8058ef:	4d 85 ff             	test   %r15,%r15
+  8058f2:	74 67                	je     80595b <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  8058f4:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  8058fb:	75 0f                	jne    80590c <mmap+0xe9>
+  8058fd:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805904:	00 00 00 
+  805907:	49 39 c7             	cmp    %rax,%r15
+  80590a:	77 1b                	ja     805927 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  80590c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805913:	e9 3c 01 00 00       	jmp    805a54 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805918:	41 f6 c5 02          	test   $0x2,%r13b
+  80591c:	74 b8                	je     8058d6 <mmap+0xb3>
+  80591e:	85 d2                	test   %edx,%edx
+  805920:	75 b4                	jne    8058d6 <mmap+0xb3>
+  805922:	e9 2d 01 00 00       	jmp    805a54 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805927:	4c 89 ff             	mov    %r15,%rdi
+  80592a:	48 b8 91 54 80 00 00 	movabs $0x805491,%rax
+  805931:	00 00 00 
+  805934:	ff d0                	call   *%rax
+  805936:	48 89 c2             	mov    %rax,%rdx
+  805939:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805940:	49 39 d7             	cmp    %rdx,%r15
+  805943:	0f 85 0b 01 00 00    	jne    805a54 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805949:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805950:	00 00 00 
+  805953:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805959:	eb 44                	jmp    80599f <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  80595b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80595f:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805966:	00 00 00 
+  805969:	48 b8 91 54 80 00 00 	movabs $0x805491,%rax
+  805970:	00 00 00 
+  805973:	ff d0                	call   *%rax
+  805975:	48 89 c7             	mov    %rax,%rdi
+  805978:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  80597c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805983:	48 85 ff             	test   %rdi,%rdi
+  805986:	75 c1                	jne    805949 <mmap+0x126>
+  805988:	e9 c7 00 00 00       	jmp    805a54 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  80598d:	49 83 c4 01          	add    $0x1,%r12
+  805991:	48 83 c0 20          	add    $0x20,%rax
+  805995:	49 83 fc 20          	cmp    $0x20,%r12
+  805999:	0f 84 a5 00 00 00    	je     805a44 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  80599f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8059a3:	75 e8                	jne    80598d <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  8059a5:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  8059a9:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  8059b0:	00 00 00 
+  8059b3:	ff d0                	call   *%rax
+  8059b5:	89 c2                	mov    %eax,%edx
+  8059b7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8059be:	85 d2                	test   %edx,%edx
+  8059c0:	0f 88 8e 00 00 00    	js     805a54 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  8059c6:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8059ca:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  8059d1:	00 00 00 
+  8059d4:	ff d0                	call   *%rax
+  8059d6:	89 c6                	mov    %eax,%esi
+  8059d8:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8059db:	48 b8 69 34 80 00 00 	movabs $0x803469,%rax
+  8059e2:	00 00 00 
+  8059e5:	ff d0                	call   *%rax
+  8059e7:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  8059ea:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8059f1:	45 85 ff             	test   %r15d,%r15d
+  8059f4:	78 5e                	js     805a54 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  8059f6:	49 c1 e4 05          	shl    $0x5,%r12
+  8059fa:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805a01:	00 00 00 
+  805a04:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805a07:	48 bf 02 55 80 00 00 	movabs $0x805502,%rdi
+  805a0e:	00 00 00 
+  805a11:	48 b8 2d 5f 80 00 00 	movabs $0x805f2d,%rax
+  805a18:	00 00 00 
+  805a1b:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805a1d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805a21:	49 89 04 24          	mov    %rax,(%r12)
+  805a25:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805a29:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805a2e:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805a33:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805a38:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805a3d:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805a42:	eb 10                	jmp    805a54 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805a44:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805a4b:	eb 07                	jmp    805a54 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805a4d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805a54:	48 83 c4 38          	add    $0x38,%rsp
+  805a58:	5b                   	pop    %rbx
+  805a59:	41 5c                	pop    %r12
+  805a5b:	41 5d                	pop    %r13
+  805a5d:	41 5e                	pop    %r14
+  805a5f:	41 5f                	pop    %r15
+  805a61:	5d                   	pop    %rbp
+  805a62:	c3                   	ret
+
+0000000000805a63 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805a63:	55                   	push   %rbp
+  805a64:	48 89 e5             	mov    %rsp,%rbp
+  805a67:	41 57                	push   %r15
+  805a69:	41 56                	push   %r14
+  805a6b:	41 55                	push   %r13
+  805a6d:	41 54                	push   %r12
+  805a6f:	53                   	push   %rbx
+  805a70:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805a74:	49 89 fe             	mov    %rdi,%r14
+  805a77:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805a7e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805a85:	00 
+  805a86:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805a8d:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  805a94:	00 00 00 
+  805a97:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805a9e:	49 bf ea 56 80 00 00 	movabs $0x8056ea,%r15
+  805aa5:	00 00 00 
+  805aa8:	eb 09                	jmp    805ab3 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805aaa:	48 83 c3 20          	add    $0x20,%rbx
+  805aae:	4c 39 eb             	cmp    %r13,%rbx
+  805ab1:	74 33                	je     805ae6 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805ab3:	48 89 df             	mov    %rbx,%rdi
+  805ab6:	48 8b 33             	mov    (%rbx),%rsi
+  805ab9:	4c 39 e6             	cmp    %r12,%rsi
+  805abc:	73 ec                	jae    805aaa <msync+0x47>
+  805abe:	48 85 f6             	test   %rsi,%rsi
+  805ac1:	74 e7                	je     805aaa <msync+0x47>
+  805ac3:	48 89 f2             	mov    %rsi,%rdx
+  805ac6:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805aca:	49 39 d6             	cmp    %rdx,%r14
+  805acd:	73 db                	jae    805aaa <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805acf:	4c 39 e2             	cmp    %r12,%rdx
+  805ad2:	49 0f 47 d4          	cmova  %r12,%rdx
+  805ad6:	4c 39 f6             	cmp    %r14,%rsi
+  805ad9:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805add:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805ae0:	85 c0                	test   %eax,%eax
+  805ae2:	79 c6                	jns    805aaa <msync+0x47>
+  805ae4:	eb 05                	jmp    805aeb <msync+0x88>
+    }
+
+    return 0;
+  805ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805aeb:	48 83 c4 08          	add    $0x8,%rsp
+  805aef:	5b                   	pop    %rbx
+  805af0:	41 5c                	pop    %r12
+  805af2:	41 5d                	pop    %r13
+  805af4:	41 5e                	pop    %r14
+  805af6:	41 5f                	pop    %r15
+  805af8:	5d                   	pop    %rbp
+  805af9:	c3                   	ret
+
+0000000000805afa <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805afa:	55                   	push   %rbp
+  805afb:	48 89 e5             	mov    %rsp,%rbp
+  805afe:	41 57                	push   %r15
+  805b00:	41 56                	push   %r14
+  805b02:	41 55                	push   %r13
+  805b04:	41 54                	push   %r12
+  805b06:	53                   	push   %rbx
+  805b07:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805b0b:	49 89 ff             	mov    %rdi,%r15
+  805b0e:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805b15:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805b1c:	00 
+  805b1d:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805b24:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  805b2b:	00 00 00 
+  805b2e:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805b35:	48 89 d8             	mov    %rbx,%rax
+  805b38:	eb 09                	jmp    805b43 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805b3a:	48 83 c0 20          	add    $0x20,%rax
+  805b3e:	4c 39 f0             	cmp    %r14,%rax
+  805b41:	74 40                	je     805b83 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805b43:	48 8b 10             	mov    (%rax),%rdx
+  805b46:	4c 39 e2             	cmp    %r12,%rdx
+  805b49:	73 ef                	jae    805b3a <munmap+0x40>
+  805b4b:	48 85 d2             	test   %rdx,%rdx
+  805b4e:	74 ea                	je     805b3a <munmap+0x40>
+  805b50:	48 89 d7             	mov    %rdx,%rdi
+  805b53:	48 03 78 08          	add    0x8(%rax),%rdi
+  805b57:	49 39 ff             	cmp    %rdi,%r15
+  805b5a:	73 de                	jae    805b3a <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805b5c:	49 39 fc             	cmp    %rdi,%r12
+  805b5f:	72 05                	jb     805b66 <munmap+0x6c>
+  805b61:	4c 39 fa             	cmp    %r15,%rdx
+  805b64:	73 d4                	jae    805b3a <munmap+0x40>
+  805b66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  805b6b:	48 83 c4 08          	add    $0x8,%rsp
+  805b6f:	5b                   	pop    %rbx
+  805b70:	41 5c                	pop    %r12
+  805b72:	41 5d                	pop    %r13
+  805b74:	41 5e                	pop    %r14
+  805b76:	41 5f                	pop    %r15
+  805b78:	5d                   	pop    %rbp
+  805b79:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805b7a:	48 83 c3 20          	add    $0x20,%rbx
+  805b7e:	4c 39 f3             	cmp    %r14,%rbx
+  805b81:	74 5c                	je     805bdf <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805b83:	48 8b 33             	mov    (%rbx),%rsi
+  805b86:	4c 39 e6             	cmp    %r12,%rsi
+  805b89:	73 ef                	jae    805b7a <munmap+0x80>
+  805b8b:	48 85 f6             	test   %rsi,%rsi
+  805b8e:	74 ea                	je     805b7a <munmap+0x80>
+  805b90:	48 89 f2             	mov    %rsi,%rdx
+  805b93:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805b97:	49 39 d7             	cmp    %rdx,%r15
+  805b9a:	73 de                	jae    805b7a <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  805b9c:	48 89 df             	mov    %rbx,%rdi
+  805b9f:	48 b8 ea 56 80 00 00 	movabs $0x8056ea,%rax
+  805ba6:	00 00 00 
+  805ba9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805bab:	85 c0                	test   %eax,%eax
+  805bad:	78 bc                	js     805b6b <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  805baf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805bb3:	48 8b 33             	mov    (%rbx),%rsi
+  805bb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bbb:	48 b8 e3 2a 80 00 00 	movabs $0x802ae3,%rax
+  805bc2:	00 00 00 
+  805bc5:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  805bc7:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805bca:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  805bd1:	00 00 00 
+  805bd4:	ff d0                	call   *%rax
+        reg->start = 0;
+  805bd6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805bdd:	eb 9b                	jmp    805b7a <munmap+0x80>
+    return 0;
+  805bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805be4:	eb 85                	jmp    805b6b <munmap+0x71>
+
+0000000000805be6 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  805be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805beb:	c3                   	ret
+
+0000000000805bec <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805bec:	55                   	push   %rbp
+  805bed:	48 89 e5             	mov    %rsp,%rbp
+  805bf0:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805bf3:	48 be 3b 72 80 00 00 	movabs $0x80723b,%rsi
+  805bfa:	00 00 00 
+  805bfd:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  805c04:	00 00 00 
+  805c07:	ff d0                	call   *%rax
+    return 0;
+}
+  805c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c0e:	5d                   	pop    %rbp
+  805c0f:	c3                   	ret
+
+0000000000805c10 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805c10:	55                   	push   %rbp
+  805c11:	48 89 e5             	mov    %rsp,%rbp
+  805c14:	41 57                	push   %r15
+  805c16:	41 56                	push   %r14
+  805c18:	41 55                	push   %r13
+  805c1a:	41 54                	push   %r12
+  805c1c:	53                   	push   %rbx
+  805c1d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  805c24:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805c2b:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805c32:	00 00 00 00 
+  805c36:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805c3d:	00 00 00 00 
+  805c41:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  805c48:	00 00 00 00 
+  805c4c:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805c53:	00 00 00 00 
+  805c57:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805c5e:	00 00 00 00 
+  805c62:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  805c69:	00 00 00 00 
+  805c6d:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  805c74:	00 
+  805c75:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  805c7c:	00 
+  805c7d:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  805c84:	00 
+  805c85:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  805c8c:	00 
+  805c8d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  805c94:	00 
+  805c95:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  805c9c:	00 
+  805c9d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  805ca4:	00 
+  805ca5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805cac:	00 
+  805cad:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  805cb4:	00 
+  805cb5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  805cbc:	00 
+    for (res = 0; res < n; res += inc) {
+  805cbd:	48 85 d2             	test   %rdx,%rdx
+  805cc0:	74 7a                	je     805d3c <devcons_write+0x12c>
+  805cc2:	49 89 d6             	mov    %rdx,%r14
+  805cc5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805ccb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805cd0:	49 bf f6 25 80 00 00 	movabs $0x8025f6,%r15
+  805cd7:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805cda:	4c 89 f3             	mov    %r14,%rbx
+  805cdd:	48 29 f3             	sub    %rsi,%rbx
+  805ce0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805ce5:	48 39 c3             	cmp    %rax,%rbx
+  805ce8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805cec:	4c 63 eb             	movslq %ebx,%r13
+  805cef:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805cf6:	48 01 c6             	add    %rax,%rsi
+  805cf9:	4c 89 ea             	mov    %r13,%rdx
+  805cfc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805d03:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805d06:	4c 89 ee             	mov    %r13,%rsi
+  805d09:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805d10:	48 b8 23 28 80 00 00 	movabs $0x802823,%rax
+  805d17:	00 00 00 
+  805d1a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805d1c:	41 01 dc             	add    %ebx,%r12d
+  805d1f:	49 63 f4             	movslq %r12d,%rsi
+  805d22:	4c 39 f6             	cmp    %r14,%rsi
+  805d25:	72 b3                	jb     805cda <devcons_write+0xca>
+    return res;
+  805d27:	49 63 c4             	movslq %r12d,%rax
+}
+  805d2a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805d31:	5b                   	pop    %rbx
+  805d32:	41 5c                	pop    %r12
+  805d34:	41 5d                	pop    %r13
+  805d36:	41 5e                	pop    %r14
+  805d38:	41 5f                	pop    %r15
+  805d3a:	5d                   	pop    %rbp
+  805d3b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805d3c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805d42:	eb e3                	jmp    805d27 <devcons_write+0x117>
+
+0000000000805d44 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805d44:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805d47:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d4c:	48 85 c0             	test   %rax,%rax
+  805d4f:	74 55                	je     805da6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805d51:	55                   	push   %rbp
+  805d52:	48 89 e5             	mov    %rsp,%rbp
+  805d55:	41 55                	push   %r13
+  805d57:	41 54                	push   %r12
+  805d59:	53                   	push   %rbx
+  805d5a:	48 83 ec 08          	sub    $0x8,%rsp
+  805d5e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805d61:	48 bb 56 28 80 00 00 	movabs $0x802856,%rbx
+  805d68:	00 00 00 
+  805d6b:	49 bc 6a 29 80 00 00 	movabs $0x80296a,%r12
+  805d72:	00 00 00 
+  805d75:	eb 03                	jmp    805d7a <devcons_read+0x36>
+  805d77:	41 ff d4             	call   *%r12
+  805d7a:	ff d3                	call   *%rbx
+  805d7c:	85 c0                	test   %eax,%eax
+  805d7e:	74 f7                	je     805d77 <devcons_read+0x33>
+    if (c < 0) return c;
+  805d80:	48 63 d0             	movslq %eax,%rdx
+  805d83:	78 13                	js     805d98 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805d85:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d8a:	83 f8 04             	cmp    $0x4,%eax
+  805d8d:	74 09                	je     805d98 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805d8f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805d93:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805d98:	48 89 d0             	mov    %rdx,%rax
+  805d9b:	48 83 c4 08          	add    $0x8,%rsp
+  805d9f:	5b                   	pop    %rbx
+  805da0:	41 5c                	pop    %r12
+  805da2:	41 5d                	pop    %r13
+  805da4:	5d                   	pop    %rbp
+  805da5:	c3                   	ret
+  805da6:	48 89 d0             	mov    %rdx,%rax
+  805da9:	c3                   	ret
+
+0000000000805daa <cputchar>:
+cputchar(int ch) {
+  805daa:	55                   	push   %rbp
+  805dab:	48 89 e5             	mov    %rsp,%rbp
+  805dae:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805db2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805db6:	be 01 00 00 00       	mov    $0x1,%esi
+  805dbb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805dbf:	48 b8 23 28 80 00 00 	movabs $0x802823,%rax
+  805dc6:	00 00 00 
+  805dc9:	ff d0                	call   *%rax
+}
+  805dcb:	c9                   	leave
+  805dcc:	c3                   	ret
+
+0000000000805dcd <getchar>:
+getchar(void) {
+  805dcd:	55                   	push   %rbp
+  805dce:	48 89 e5             	mov    %rsp,%rbp
+  805dd1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805dd5:	ba 01 00 00 00       	mov    $0x1,%edx
+  805dda:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  805de3:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  805dea:	00 00 00 
+  805ded:	ff d0                	call   *%rax
+  805def:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805df1:	85 c0                	test   %eax,%eax
+  805df3:	78 06                	js     805dfb <getchar+0x2e>
+  805df5:	74 08                	je     805dff <getchar+0x32>
+  805df7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805dfb:	89 d0                	mov    %edx,%eax
+  805dfd:	c9                   	leave
+  805dfe:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805dff:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805e04:	eb f5                	jmp    805dfb <getchar+0x2e>
+
+0000000000805e06 <iscons>:
+iscons(int fdnum) {
+  805e06:	55                   	push   %rbp
+  805e07:	48 89 e5             	mov    %rsp,%rbp
+  805e0a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805e0e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805e12:	48 b8 a9 32 80 00 00 	movabs $0x8032a9,%rax
+  805e19:	00 00 00 
+  805e1c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805e1e:	85 c0                	test   %eax,%eax
+  805e20:	78 18                	js     805e3a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805e22:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e26:	48 b8 e0 80 80 00 00 	movabs $0x8080e0,%rax
+  805e2d:	00 00 00 
+  805e30:	8b 00                	mov    (%rax),%eax
+  805e32:	39 02                	cmp    %eax,(%rdx)
+  805e34:	0f 94 c0             	sete   %al
+  805e37:	0f b6 c0             	movzbl %al,%eax
+}
+  805e3a:	c9                   	leave
+  805e3b:	c3                   	ret
+
+0000000000805e3c <opencons>:
+opencons(void) {
+  805e3c:	55                   	push   %rbp
+  805e3d:	48 89 e5             	mov    %rsp,%rbp
+  805e40:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805e44:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805e48:	48 b8 49 32 80 00 00 	movabs $0x803249,%rax
+  805e4f:	00 00 00 
+  805e52:	ff d0                	call   *%rax
+  805e54:	85 c0                	test   %eax,%eax
+  805e56:	78 49                	js     805ea1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805e58:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805e62:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805e66:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e6b:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  805e72:	00 00 00 
+  805e75:	ff d0                	call   *%rax
+  805e77:	85 c0                	test   %eax,%eax
+  805e79:	78 26                	js     805ea1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805e7b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805e7f:	a1 e0 80 80 00 00 00 	movabs 0x8080e0,%eax
+  805e86:	00 00 
+  805e88:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805e8a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805e8e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805e95:	48 b8 1b 32 80 00 00 	movabs $0x80321b,%rax
+  805e9c:	00 00 00 
+  805e9f:	ff d0                	call   *%rax
+}
+  805ea1:	c9                   	leave
+  805ea2:	c3                   	ret
+
+0000000000805ea3 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805ea3:	55                   	push   %rbp
+  805ea4:	48 89 e5             	mov    %rsp,%rbp
+  805ea7:	41 56                	push   %r14
+  805ea9:	41 55                	push   %r13
+  805eab:	41 54                	push   %r12
+  805ead:	53                   	push   %rbx
+  805eae:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805eb1:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  805eb8:	00 00 00 
+  805ebb:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805ebf:	74 27                	je     805ee8 <_handle_vectored_pagefault+0x45>
+  805ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805ec6:	49 bd 40 cc 80 01 00 	movabs $0x180cc40,%r13
+  805ecd:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805ed0:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805ed3:	4c 89 e7             	mov    %r12,%rdi
+  805ed6:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805edb:	84 c0                	test   %al,%al
+  805edd:	75 45                	jne    805f24 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805edf:	48 83 c3 01          	add    $0x1,%rbx
+  805ee3:	49 3b 1e             	cmp    (%r14),%rbx
+  805ee6:	72 eb                	jb     805ed3 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805ee8:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805eef:	00 
+  805ef0:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805ef5:	4d 8b 04 24          	mov    (%r12),%r8
+  805ef9:	48 ba 48 72 80 00 00 	movabs $0x807248,%rdx
+  805f00:	00 00 00 
+  805f03:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805f08:	48 bf 78 72 80 00 00 	movabs $0x807278,%rdi
+  805f0f:	00 00 00 
+  805f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f17:	49 ba 1f 18 80 00 00 	movabs $0x80181f,%r10
+  805f1e:	00 00 00 
+  805f21:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805f24:	5b                   	pop    %rbx
+  805f25:	41 5c                	pop    %r12
+  805f27:	41 5d                	pop    %r13
+  805f29:	41 5e                	pop    %r14
+  805f2b:	5d                   	pop    %rbp
+  805f2c:	c3                   	ret
+
+0000000000805f2d <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805f2d:	55                   	push   %rbp
+  805f2e:	48 89 e5             	mov    %rsp,%rbp
+  805f31:	53                   	push   %rbx
+  805f32:	48 83 ec 08          	sub    $0x8,%rsp
+  805f36:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805f39:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805f3e:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  805f45:	00 00 00 
+  805f48:	80 38 00             	cmpb   $0x0,(%rax)
+  805f4b:	74 68                	je     805fb5 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f4d:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  805f54:	00 00 00 
+  805f57:	48 8b 08             	mov    (%rax),%rcx
+  805f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805f5f:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  805f66:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f69:	48 85 c9             	test   %rcx,%rcx
+  805f6c:	0f 84 e0 00 00 00    	je     806052 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805f72:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  805f76:	0f 84 c9 00 00 00    	je     806045 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f7c:	48 83 c2 01          	add    $0x1,%rdx
+  805f80:	48 39 ca             	cmp    %rcx,%rdx
+  805f83:	75 ed                	jne    805f72 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805f85:	48 83 f9 08          	cmp    $0x8,%rcx
+  805f89:	0f 84 84 00 00 00    	je     806013 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805f8f:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  805f93:	48 a3 88 cc 80 01 00 	movabs %rax,0x180cc88
+  805f9a:	00 00 00 
+  805f9d:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  805fa4:	00 00 00 
+  805fa7:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805fab:	85 f6                	test   %esi,%esi
+  805fad:	0f 89 97 00 00 00    	jns    80604a <add_pgfault_handler+0x11d>
+  805fb3:	eb 63                	jmp    806018 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  805fb5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805fba:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805fbf:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  805fc6:	00 00 00 
+  805fc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fce:	48 b8 0b 2a 80 00 00 	movabs $0x802a0b,%rax
+  805fd5:	00 00 00 
+  805fd8:	ff d0                	call   *%rax
+  805fda:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805fdc:	85 c0                	test   %eax,%eax
+  805fde:	78 38                	js     806018 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805fe0:	48 be 2e 61 80 00 00 	movabs $0x80612e,%rsi
+  805fe7:	00 00 00 
+  805fea:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fef:	48 b8 2e 2c 80 00 00 	movabs $0x802c2e,%rax
+  805ff6:	00 00 00 
+  805ff9:	ff d0                	call   *%rax
+  805ffb:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805ffd:	85 c0                	test   %eax,%eax
+  805fff:	78 17                	js     806018 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  806001:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  806008:	00 00 00 
+  80600b:	c6 00 01             	movb   $0x1,(%rax)
+  80600e:	e9 3a ff ff ff       	jmp    805f4d <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  806013:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806018:	89 f1                	mov    %esi,%ecx
+  80601a:	48 ba 86 72 80 00 00 	movabs $0x807286,%rdx
+  806021:	00 00 00 
+  806024:	be 42 00 00 00       	mov    $0x42,%esi
+  806029:	48 bf 78 72 80 00 00 	movabs $0x807278,%rdi
+  806030:	00 00 00 
+  806033:	b8 00 00 00 00       	mov    $0x0,%eax
+  806038:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  80603f:	00 00 00 
+  806042:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  806045:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  80604a:	89 f0                	mov    %esi,%eax
+  80604c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806050:	c9                   	leave
+  806051:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  806052:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  806059:	00 00 00 
+  80605c:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  806063:	48 89 d8             	mov    %rbx,%rax
+  806066:	48 a3 40 cc 80 01 00 	movabs %rax,0x180cc40
+  80606d:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806070:	eb d8                	jmp    80604a <add_pgfault_handler+0x11d>
+
+0000000000806072 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  806072:	55                   	push   %rbp
+  806073:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  806076:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  80607d:	00 00 00 
+  806080:	80 38 00             	cmpb   $0x0,(%rax)
+  806083:	74 33                	je     8060b8 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806085:	48 a1 88 cc 80 01 00 	movabs 0x180cc88,%rax
+  80608c:	00 00 00 
+  80608f:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  806094:	48 ba 40 cc 80 01 00 	movabs $0x180cc40,%rdx
+  80609b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80609e:	48 85 c0             	test   %rax,%rax
+  8060a1:	0f 84 85 00 00 00    	je     80612c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8060a7:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8060ab:	74 40                	je     8060ed <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8060ad:	48 83 c1 01          	add    $0x1,%rcx
+  8060b1:	48 39 c1             	cmp    %rax,%rcx
+  8060b4:	75 f1                	jne    8060a7 <remove_pgfault_handler+0x35>
+  8060b6:	eb 74                	jmp    80612c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8060b8:	48 b9 9e 72 80 00 00 	movabs $0x80729e,%rcx
+  8060bf:	00 00 00 
+  8060c2:	48 ba f6 70 80 00 00 	movabs $0x8070f6,%rdx
+  8060c9:	00 00 00 
+  8060cc:	be 48 00 00 00       	mov    $0x48,%esi
+  8060d1:	48 bf 78 72 80 00 00 	movabs $0x807278,%rdi
+  8060d8:	00 00 00 
+  8060db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060e0:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8060e7:	00 00 00 
+  8060ea:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8060ed:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8060f4:	00 
+  8060f5:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8060f9:	48 29 ca             	sub    %rcx,%rdx
+  8060fc:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  806103:	00 00 00 
+  806106:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80610a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80610f:	48 89 ce             	mov    %rcx,%rsi
+  806112:	48 b8 f6 25 80 00 00 	movabs $0x8025f6,%rax
+  806119:	00 00 00 
+  80611c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80611e:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  806125:	00 00 00 
+  806128:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80612c:	5d                   	pop    %rbp
+  80612d:	c3                   	ret
+
+000000000080612e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80612e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  806131:	48 b8 a3 5e 80 00 00 	movabs $0x805ea3,%rax
+  806138:	00 00 00 
+    call *%rax
+  80613b:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  80613d:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  806144:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  806145:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  80614c:	00 
+    subq $8, %rcx
+  80614d:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  806151:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  806154:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  80615b:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  80615c:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  806160:	4c 8b 3c 24          	mov    (%rsp),%r15
+  806164:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  806169:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80616e:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  806173:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  806178:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  80617d:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  806182:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  806187:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  80618c:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  806191:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  806196:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  80619b:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8061a0:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8061a5:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8061aa:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8061ae:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8061b2:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8061b3:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8061b4:	c3                   	ret
+
+00000000008061b5 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8061b5:	85 ff                	test   %edi,%edi
+  8061b7:	78 58                	js     806211 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8061b9:	48 85 f6             	test   %rsi,%rsi
+  8061bc:	74 12                	je     8061d0 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8061be:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8061c5:	00 00 00 
+  8061c8:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8061ce:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8061d0:	48 85 c9             	test   %rcx,%rcx
+  8061d3:	74 12                	je     8061e7 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8061d5:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8061dc:	00 00 00 
+  8061df:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8061e5:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8061e7:	48 85 d2             	test   %rdx,%rdx
+  8061ea:	74 14                	je     806200 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8061ec:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8061f3:	00 00 00 
+  8061f6:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8061fd:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  806200:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  806207:	00 00 00 
+  80620a:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  806210:	c3                   	ret
+        if (from_env_store) {
+  806211:	48 85 f6             	test   %rsi,%rsi
+  806214:	74 06                	je     80621c <ipc_result+0x67>
+            *from_env_store = 0;
+  806216:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  80621c:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80621e:	48 85 c9             	test   %rcx,%rcx
+  806221:	74 ed                	je     806210 <ipc_result+0x5b>
+            *perm_store = 0;
+  806223:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  806229:	c3                   	ret
+
+000000000080622a <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80622a:	55                   	push   %rbp
+  80622b:	48 89 e5             	mov    %rsp,%rbp
+  80622e:	41 55                	push   %r13
+  806230:	41 54                	push   %r12
+  806232:	53                   	push   %rbx
+  806233:	48 83 ec 08          	sub    $0x8,%rsp
+  806237:	49 89 fc             	mov    %rdi,%r12
+  80623a:	48 89 f7             	mov    %rsi,%rdi
+  80623d:	48 89 d3             	mov    %rdx,%rbx
+  806240:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806243:	48 85 f6             	test   %rsi,%rsi
+  806246:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80624d:	00 00 00 
+  806250:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  806254:	be 00 00 00 00       	mov    $0x0,%esi
+  806259:	48 85 d2             	test   %rdx,%rdx
+  80625c:	74 03                	je     806261 <ipc_recv+0x37>
+  80625e:	48 8b 32             	mov    (%rdx),%rsi
+  806261:	48 b8 57 2f 80 00 00 	movabs $0x802f57,%rax
+  806268:	00 00 00 
+  80626b:	ff d0                	call   *%rax
+  80626d:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80626f:	4c 89 e9             	mov    %r13,%rcx
+  806272:	48 89 da             	mov    %rbx,%rdx
+  806275:	4c 89 e6             	mov    %r12,%rsi
+  806278:	48 b8 b5 61 80 00 00 	movabs $0x8061b5,%rax
+  80627f:	00 00 00 
+  806282:	ff d0                	call   *%rax
+}
+  806284:	48 83 c4 08          	add    $0x8,%rsp
+  806288:	5b                   	pop    %rbx
+  806289:	41 5c                	pop    %r12
+  80628b:	41 5d                	pop    %r13
+  80628d:	5d                   	pop    %rbp
+  80628e:	c3                   	ret
+
+000000000080628f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80628f:	55                   	push   %rbp
+  806290:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806293:	48 85 d2             	test   %rdx,%rdx
+  806296:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80629d:	00 00 00 
+  8062a0:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8062a4:	89 f6                	mov    %esi,%esi
+  8062a6:	48 b8 e3 2d 80 00 00 	movabs $0x802de3,%rax
+  8062ad:	00 00 00 
+  8062b0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8062b2:	85 c0                	test   %eax,%eax
+  8062b4:	78 02                	js     8062b8 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8062b6:	5d                   	pop    %rbp
+  8062b7:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8062b8:	89 c1                	mov    %eax,%ecx
+  8062ba:	48 ba b8 72 80 00 00 	movabs $0x8072b8,%rdx
+  8062c1:	00 00 00 
+  8062c4:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8062c9:	48 bf c5 72 80 00 00 	movabs $0x8072c5,%rdi
+  8062d0:	00 00 00 
+  8062d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062d8:	49 b8 1f 18 80 00 00 	movabs $0x80181f,%r8
+  8062df:	00 00 00 
+  8062e2:	41 ff d0             	call   *%r8
+
+00000000008062e5 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8062e5:	55                   	push   %rbp
+  8062e6:	48 89 e5             	mov    %rsp,%rbp
+  8062e9:	53                   	push   %rbx
+  8062ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8062ee:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8062f2:	48 85 d2             	test   %rdx,%rdx
+  8062f5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8062fc:	00 00 00 
+  8062ff:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806303:	4d 85 c9             	test   %r9,%r9
+  806306:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80630a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80630f:	48 85 db             	test   %rbx,%rbx
+  806312:	74 03                	je     806317 <ipc_call+0x32>
+  806314:	48 8b 03             	mov    (%rbx),%rax
+  806317:	89 f6                	mov    %esi,%esi
+  806319:	48 83 ec 08          	sub    $0x8,%rsp
+  80631d:	50                   	push   %rax
+  80631e:	48 b8 15 2e 80 00 00 	movabs $0x802e15,%rax
+  806325:	00 00 00 
+  806328:	ff d0                	call   *%rax
+  80632a:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  80632c:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806330:	48 89 da             	mov    %rbx,%rdx
+  806333:	be 00 00 00 00       	mov    $0x0,%esi
+  806338:	48 b8 b5 61 80 00 00 	movabs $0x8061b5,%rax
+  80633f:	00 00 00 
+  806342:	ff d0                	call   *%rax
+}
+  806344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806348:	c9                   	leave
+  806349:	c3                   	ret
+
+000000000080634a <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  80634a:	55                   	push   %rbp
+  80634b:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80634e:	89 f6                	mov    %esi,%esi
+  806350:	48 b8 81 2e 80 00 00 	movabs $0x802e81,%rax
+  806357:	00 00 00 
+  80635a:	ff d0                	call   *%rax
+  80635c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80635e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806363:	ba 00 00 00 00       	mov    $0x0,%edx
+  806368:	be 00 00 00 00       	mov    $0x0,%esi
+  80636d:	48 b8 b5 61 80 00 00 	movabs $0x8061b5,%rax
+  806374:	00 00 00 
+  806377:	ff d0                	call   *%rax
+}
+  806379:	5d                   	pop    %rbp
+  80637a:	c3                   	ret
+
+000000000080637b <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80637b:	55                   	push   %rbp
+  80637c:	48 89 e5             	mov    %rsp,%rbp
+  80637f:	41 54                	push   %r12
+  806381:	53                   	push   %rbx
+  806382:	4c 89 cb             	mov    %r9,%rbx
+  806385:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  806389:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80638d:	48 85 d2             	test   %rdx,%rdx
+  806390:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806397:	00 00 00 
+  80639a:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80639e:	4d 85 c9             	test   %r9,%r9
+  8063a1:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8063a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063aa:	4d 85 e4             	test   %r12,%r12
+  8063ad:	74 04                	je     8063b3 <ipc_reply_wait+0x38>
+  8063af:	49 8b 04 24          	mov    (%r12),%rax
+  8063b3:	89 f6                	mov    %esi,%esi
+  8063b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8063b9:	50                   	push   %rax
+  8063ba:	48 b8 eb 2e 80 00 00 	movabs $0x802eeb,%rax
+  8063c1:	00 00 00 
+  8063c4:	ff d0                	call   *%rax
+  8063c6:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8063c8:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8063cc:	4c 89 e2             	mov    %r12,%rdx
+  8063cf:	48 89 de             	mov    %rbx,%rsi
+  8063d2:	48 b8 b5 61 80 00 00 	movabs $0x8061b5,%rax
+  8063d9:	00 00 00 
+  8063dc:	ff d0                	call   *%rax
+}
+  8063de:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8063e2:	5b                   	pop    %rbx
+  8063e3:	41 5c                	pop    %r12
+  8063e5:	5d                   	pop    %rbp
+  8063e6:	c3                   	ret
+
+00000000008063e7 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8063e7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8063ec:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8063f3:	00 00 00 
+  8063f6:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8063fd:	48 01 ca             	add    %rcx,%rdx
+  806400:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  806406:	39 fa                	cmp    %edi,%edx
+  806408:	74 12                	je     80641c <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  80640a:	48 83 c0 01          	add    $0x1,%rax
+  80640e:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  806414:	75 e0                	jne    8063f6 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  806416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80641b:	c3                   	ret
+            return envs[i].env_id;
+  80641c:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806423:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80642a:	00 00 00 
+  80642d:	48 01 d0             	add    %rdx,%rax
+  806430:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  806436:	c3                   	ret
+  806437:	90                   	nop
+
+0000000000806438 <__rodata_start>:
+  806438:	77 00                	ja     80643a <__rodata_start+0x2>
+  80643a:	72 62                	jb     80649e <__rodata_start+0x66>
+  80643c:	00 77 62             	add    %dh,0x62(%rdi)
+  80643f:	00 b3 09 80 00 00    	add    %dh,0x8009(%rbx)
+  806445:	00 00                	add    %al,(%rax)
+  806447:	00 ed                	add    %ch,%ch
+  806449:	0d 80 00 00 00       	or     $0x80,%eax
+  80644e:	00 00                	add    %al,(%rax)
+  806450:	ed                   	in     (%dx),%eax
+  806451:	0d 80 00 00 00       	or     $0x80,%eax
+  806456:	00 00                	add    %al,(%rax)
+  806458:	ed                   	in     (%dx),%eax
+  806459:	0d 80 00 00 00       	or     $0x80,%eax
+  80645e:	00 00                	add    %al,(%rax)
+  806460:	ed                   	in     (%dx),%eax
+  806461:	0d 80 00 00 00       	or     $0x80,%eax
+  806466:	00 00                	add    %al,(%rax)
+  806468:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  80646d:	00 00                	add    %al,(%rax)
+  80646f:	00 ed                	add    %ch,%ch
+  806471:	0d 80 00 00 00       	or     $0x80,%eax
+  806476:	00 00                	add    %al,(%rax)
+  806478:	ed                   	in     (%dx),%eax
+  806479:	0d 80 00 00 00       	or     $0x80,%eax
+  80647e:	00 00                	add    %al,(%rax)
+  806480:	ed                   	in     (%dx),%eax
+  806481:	0d 80 00 00 00       	or     $0x80,%eax
+  806486:	00 00                	add    %al,(%rax)
+  806488:	ed                   	in     (%dx),%eax
+  806489:	0d 80 00 00 00       	or     $0x80,%eax
+  80648e:	00 00                	add    %al,(%rax)
+  806490:	ed                   	in     (%dx),%eax
+  806491:	0d 80 00 00 00       	or     $0x80,%eax
+  806496:	00 00                	add    %al,(%rax)
+  806498:	8c 0a                	mov    %cs,(%rdx)
+  80649a:	80 00 00             	addb   $0x0,(%rax)
+  80649d:	00 00                	add    %al,(%rax)
+  80649f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8064a6:	00 00                	add    %al,(%rax)
+  8064a8:	8c 0a                	mov    %cs,(%rdx)
+  8064aa:	80 00 00             	addb   $0x0,(%rax)
+  8064ad:	00 00                	add    %al,(%rax)
+  8064af:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8064b6:	00 00                	add    %al,(%rax)
+  8064b8:	8c 0a                	mov    %cs,(%rdx)
+  8064ba:	80 00 00             	addb   $0x0,(%rax)
+  8064bd:	00 00                	add    %al,(%rax)
+  8064bf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8064c6:	00 00                	add    %al,(%rax)
+  8064c8:	8c 0a                	mov    %cs,(%rdx)
+  8064ca:	80 00 00             	addb   $0x0,(%rax)
+  8064cd:	00 00                	add    %al,(%rax)
+  8064cf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8064d6:	00 00                	add    %al,(%rax)
+  8064d8:	8c 0a                	mov    %cs,(%rdx)
+  8064da:	80 00 00             	addb   $0x0,(%rax)
+  8064dd:	00 00                	add    %al,(%rax)
+  8064df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8064e6:	00 00                	add    %al,(%rax)
+  8064e8:	ed                   	in     (%dx),%eax
+  8064e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064ee:	00 00                	add    %al,(%rax)
+  8064f0:	ed                   	in     (%dx),%eax
+  8064f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8064f6:	00 00                	add    %al,(%rax)
+  8064f8:	ed                   	in     (%dx),%eax
+  8064f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8064fe:	00 00                	add    %al,(%rax)
+  806500:	ed                   	in     (%dx),%eax
+  806501:	0d 80 00 00 00       	or     $0x80,%eax
+  806506:	00 00                	add    %al,(%rax)
+  806508:	ed                   	in     (%dx),%eax
+  806509:	0d 80 00 00 00       	or     $0x80,%eax
+  80650e:	00 00                	add    %al,(%rax)
+  806510:	ed                   	in     (%dx),%eax
+  806511:	0d 80 00 00 00       	or     $0x80,%eax
+  806516:	00 00                	add    %al,(%rax)
+  806518:	ed                   	in     (%dx),%eax
+  806519:	0d 80 00 00 00       	or     $0x80,%eax
+  80651e:	00 00                	add    %al,(%rax)
+  806520:	ed                   	in     (%dx),%eax
+  806521:	0d 80 00 00 00       	or     $0x80,%eax
+  806526:	00 00                	add    %al,(%rax)
+  806528:	ed                   	in     (%dx),%eax
+  806529:	0d 80 00 00 00       	or     $0x80,%eax
+  80652e:	00 00                	add    %al,(%rax)
+  806530:	ed                   	in     (%dx),%eax
+  806531:	0d 80 00 00 00       	or     $0x80,%eax
+  806536:	00 00                	add    %al,(%rax)
+  806538:	ed                   	in     (%dx),%eax
+  806539:	0d 80 00 00 00       	or     $0x80,%eax
+  80653e:	00 00                	add    %al,(%rax)
+  806540:	ed                   	in     (%dx),%eax
+  806541:	0d 80 00 00 00       	or     $0x80,%eax
+  806546:	00 00                	add    %al,(%rax)
+  806548:	ed                   	in     (%dx),%eax
+  806549:	0d 80 00 00 00       	or     $0x80,%eax
+  80654e:	00 00                	add    %al,(%rax)
+  806550:	ed                   	in     (%dx),%eax
+  806551:	0d 80 00 00 00       	or     $0x80,%eax
+  806556:	00 00                	add    %al,(%rax)
+  806558:	ed                   	in     (%dx),%eax
+  806559:	0d 80 00 00 00       	or     $0x80,%eax
+  80655e:	00 00                	add    %al,(%rax)
+  806560:	ed                   	in     (%dx),%eax
+  806561:	0d 80 00 00 00       	or     $0x80,%eax
+  806566:	00 00                	add    %al,(%rax)
+  806568:	ed                   	in     (%dx),%eax
+  806569:	0d 80 00 00 00       	or     $0x80,%eax
+  80656e:	00 00                	add    %al,(%rax)
+  806570:	ed                   	in     (%dx),%eax
+  806571:	0d 80 00 00 00       	or     $0x80,%eax
+  806576:	00 00                	add    %al,(%rax)
+  806578:	ed                   	in     (%dx),%eax
+  806579:	0d 80 00 00 00       	or     $0x80,%eax
+  80657e:	00 00                	add    %al,(%rax)
+  806580:	ed                   	in     (%dx),%eax
+  806581:	0d 80 00 00 00       	or     $0x80,%eax
+  806586:	00 00                	add    %al,(%rax)
+  806588:	ed                   	in     (%dx),%eax
+  806589:	0d 80 00 00 00       	or     $0x80,%eax
+  80658e:	00 00                	add    %al,(%rax)
+  806590:	ed                   	in     (%dx),%eax
+  806591:	0d 80 00 00 00       	or     $0x80,%eax
+  806596:	00 00                	add    %al,(%rax)
+  806598:	ed                   	in     (%dx),%eax
+  806599:	0d 80 00 00 00       	or     $0x80,%eax
+  80659e:	00 00                	add    %al,(%rax)
+  8065a0:	ed                   	in     (%dx),%eax
+  8065a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065a6:	00 00                	add    %al,(%rax)
+  8065a8:	ed                   	in     (%dx),%eax
+  8065a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ae:	00 00                	add    %al,(%rax)
+  8065b0:	ed                   	in     (%dx),%eax
+  8065b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065b6:	00 00                	add    %al,(%rax)
+  8065b8:	ed                   	in     (%dx),%eax
+  8065b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065be:	00 00                	add    %al,(%rax)
+  8065c0:	ed                   	in     (%dx),%eax
+  8065c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065c6:	00 00                	add    %al,(%rax)
+  8065c8:	ed                   	in     (%dx),%eax
+  8065c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ce:	00 00                	add    %al,(%rax)
+  8065d0:	ed                   	in     (%dx),%eax
+  8065d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065d6:	00 00                	add    %al,(%rax)
+  8065d8:	f4                   	hlt
+  8065d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8065df:	00 ed                	add    %ch,%ch
+  8065e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8065e6:	00 00                	add    %al,(%rax)
+  8065e8:	ed                   	in     (%dx),%eax
+  8065e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065ee:	00 00                	add    %al,(%rax)
+  8065f0:	2c 0b                	sub    $0xb,%al
+  8065f2:	80 00 00             	addb   $0x0,(%rax)
+  8065f5:	00 00                	add    %al,(%rax)
+  8065f7:	00 ed                	add    %ch,%ch
+  8065f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8065fe:	00 00                	add    %al,(%rax)
+  806600:	ed                   	in     (%dx),%eax
+  806601:	0d 80 00 00 00       	or     $0x80,%eax
+  806606:	00 00                	add    %al,(%rax)
+  806608:	ed                   	in     (%dx),%eax
+  806609:	0d 80 00 00 00       	or     $0x80,%eax
+  80660e:	00 00                	add    %al,(%rax)
+  806610:	ed                   	in     (%dx),%eax
+  806611:	0d 80 00 00 00       	or     $0x80,%eax
+  806616:	00 00                	add    %al,(%rax)
+  806618:	ed                   	in     (%dx),%eax
+  806619:	0d 80 00 00 00       	or     $0x80,%eax
+  80661e:	00 00                	add    %al,(%rax)
+  806620:	ed                   	in     (%dx),%eax
+  806621:	0d 80 00 00 00       	or     $0x80,%eax
+  806626:	00 00                	add    %al,(%rax)
+  806628:	ed                   	in     (%dx),%eax
+  806629:	0d 80 00 00 00       	or     $0x80,%eax
+  80662e:	00 00                	add    %al,(%rax)
+  806630:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  806633:	00 00                	add    %al,(%rax)
+  806635:	00 00                	add    %al,(%rax)
+  806637:	00 cb                	add    %cl,%bl
+  806639:	0d 80 00 00 00       	or     $0x80,%eax
+  80663e:	00 00                	add    %al,(%rax)
+  806640:	ed                   	in     (%dx),%eax
+  806641:	0d 80 00 00 00       	or     $0x80,%eax
+  806646:	00 00                	add    %al,(%rax)
+  806648:	ed                   	in     (%dx),%eax
+  806649:	0d 80 00 00 00       	or     $0x80,%eax
+  80664e:	00 00                	add    %al,(%rax)
+  806650:	ed                   	in     (%dx),%eax
+  806651:	0d 80 00 00 00       	or     $0x80,%eax
+  806656:	00 00                	add    %al,(%rax)
+  806658:	6a 0a                	push   $0xa
+  80665a:	80 00 00             	addb   $0x0,(%rax)
+  80665d:	00 00                	add    %al,(%rax)
+  80665f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  806665:	00 00                	add    %al,(%rax)
+  806667:	00 ed                	add    %ch,%ch
+  806669:	0d 80 00 00 00       	or     $0x80,%eax
+  80666e:	00 00                	add    %al,(%rax)
+  806670:	ed                   	in     (%dx),%eax
+  806671:	0d 80 00 00 00       	or     $0x80,%eax
+  806676:	00 00                	add    %al,(%rax)
+  806678:	3c 0a                	cmp    $0xa,%al
+  80667a:	80 00 00             	addb   $0x0,(%rax)
+  80667d:	00 00                	add    %al,(%rax)
+  80667f:	00 ed                	add    %ch,%ch
+  806681:	0d 80 00 00 00       	or     $0x80,%eax
+  806686:	00 00                	add    %al,(%rax)
+  806688:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80668b:	00 00                	add    %al,(%rax)
+  80668d:	00 00                	add    %al,(%rax)
+  80668f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806695:	00 00                	add    %al,(%rax)
+  806697:	00 29                	add    %ch,(%rcx)
+  806699:	0c 80                	or     $0x80,%al
+  80669b:	00 00                	add    %al,(%rax)
+  80669d:	00 00                	add    %al,(%rax)
+  80669f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8066a2:	80 00 00             	addb   $0x0,(%rax)
+  8066a5:	00 00                	add    %al,(%rax)
+  8066a7:	00 ed                	add    %ch,%ch
+  8066a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ae:	00 00                	add    %al,(%rax)
+  8066b0:	1a 0b                	sbb    (%rbx),%cl
+  8066b2:	80 00 00             	addb   $0x0,(%rax)
+  8066b5:	00 00                	add    %al,(%rax)
+  8066b7:	00 ed                	add    %ch,%ch
+  8066b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066be:	00 00                	add    %al,(%rax)
+  8066c0:	ce                   	(bad)
+  8066c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8066c7:	00 ed                	add    %ch,%ch
+  8066c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ce:	00 00                	add    %al,(%rax)
+  8066d0:	ed                   	in     (%dx),%eax
+  8066d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066d6:	00 00                	add    %al,(%rax)
+  8066d8:	f4                   	hlt
+  8066d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8066df:	00 37                	add    %dh,(%rdi)
+  8066e1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066ea:	80 00 00             	addb   $0x0,(%rax)
+  8066ed:	00 00                	add    %al,(%rax)
+  8066ef:	00 37                	add    %dh,(%rdi)
+  8066f1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8066f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8066fa:	80 00 00             	addb   $0x0,(%rax)
+  8066fd:	00 00                	add    %al,(%rax)
+  8066ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806702:	80 00 00             	addb   $0x0,(%rax)
+  806705:	00 00                	add    %al,(%rax)
+  806707:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80670b:	00 00                	add    %al,(%rax)
+  80670d:	00 00                	add    %al,(%rax)
+  80670f:	00 d2                	add    %dl,%dl
+  806711:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806717:	00 d2                	add    %dl,%dl
+  806719:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80671f:	00 d2                	add    %dl,%dl
+  806721:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806727:	00 d2                	add    %dl,%dl
+  806729:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80672f:	00 d2                	add    %dl,%dl
+  806731:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806737:	00 d2                	add    %dl,%dl
+  806739:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80673f:	00 d2                	add    %dl,%dl
+  806741:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806747:	00 f6                	add    %dh,%dh
+  806749:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80674f:	00 f6                	add    %dh,%dh
+  806751:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806757:	00 5f 12             	add    %bl,0x12(%rdi)
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806762:	80 00 00             	addb   $0x0,(%rax)
+  806765:	00 00                	add    %al,(%rax)
+  806767:	00 5f 12             	add    %bl,0x12(%rdi)
+  80676a:	80 00 00             	addb   $0x0,(%rax)
+  80676d:	00 00                	add    %al,(%rax)
+  80676f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806772:	80 00 00             	addb   $0x0,(%rax)
+  806775:	00 00                	add    %al,(%rax)
+  806777:	00 5f 12             	add    %bl,0x12(%rdi)
+  80677a:	80 00 00             	addb   $0x0,(%rax)
+  80677d:	00 00                	add    %al,(%rax)
+  80677f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806782:	80 00 00             	addb   $0x0,(%rax)
+  806785:	00 00                	add    %al,(%rax)
+  806787:	00 5f 12             	add    %bl,0x12(%rdi)
+  80678a:	80 00 00             	addb   $0x0,(%rax)
+  80678d:	00 00                	add    %al,(%rax)
+  80678f:	00 22                	add    %ah,(%rdx)
+  806791:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806797:	00 22                	add    %ah,(%rdx)
+  806799:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80679f:	00 22                	add    %ah,(%rdx)
+  8067a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067a7:	00 22                	add    %ah,(%rdx)
+  8067a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067af:	00 22                	add    %ah,(%rdx)
+  8067b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067b7:	00 22                	add    %ah,(%rdx)
+  8067b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8067bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067c2:	80 00 00             	addb   $0x0,(%rax)
+  8067c5:	00 00                	add    %al,(%rax)
+  8067c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067ca:	80 00 00             	addb   $0x0,(%rax)
+  8067cd:	00 00                	add    %al,(%rax)
+  8067cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067d2:	80 00 00             	addb   $0x0,(%rax)
+  8067d5:	00 00                	add    %al,(%rax)
+  8067d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067da:	80 00 00             	addb   $0x0,(%rax)
+  8067dd:	00 00                	add    %al,(%rax)
+  8067df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067e2:	80 00 00             	addb   $0x0,(%rax)
+  8067e5:	00 00                	add    %al,(%rax)
+  8067e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067ea:	80 00 00             	addb   $0x0,(%rax)
+  8067ed:	00 00                	add    %al,(%rax)
+  8067ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067f2:	80 00 00             	addb   $0x0,(%rax)
+  8067f5:	00 00                	add    %al,(%rax)
+  8067f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8067fa:	80 00 00             	addb   $0x0,(%rax)
+  8067fd:	00 00                	add    %al,(%rax)
+  8067ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806802:	80 00 00             	addb   $0x0,(%rax)
+  806805:	00 00                	add    %al,(%rax)
+  806807:	00 5f 12             	add    %bl,0x12(%rdi)
+  80680a:	80 00 00             	addb   $0x0,(%rax)
+  80680d:	00 00                	add    %al,(%rax)
+  80680f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806812:	80 00 00             	addb   $0x0,(%rax)
+  806815:	00 00                	add    %al,(%rax)
+  806817:	00 5f 12             	add    %bl,0x12(%rdi)
+  80681a:	80 00 00             	addb   $0x0,(%rax)
+  80681d:	00 00                	add    %al,(%rax)
+  80681f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806822:	80 00 00             	addb   $0x0,(%rax)
+  806825:	00 00                	add    %al,(%rax)
+  806827:	00 5f 12             	add    %bl,0x12(%rdi)
+  80682a:	80 00 00             	addb   $0x0,(%rax)
+  80682d:	00 00                	add    %al,(%rax)
+  80682f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806832:	80 00 00             	addb   $0x0,(%rax)
+  806835:	00 00                	add    %al,(%rax)
+  806837:	00 5f 12             	add    %bl,0x12(%rdi)
+  80683a:	80 00 00             	addb   $0x0,(%rax)
+  80683d:	00 00                	add    %al,(%rax)
+  80683f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806842:	80 00 00             	addb   $0x0,(%rax)
+  806845:	00 00                	add    %al,(%rax)
+  806847:	00 46 12             	add    %al,0x12(%rsi)
+  80684a:	80 00 00             	addb   $0x0,(%rax)
+  80684d:	00 00                	add    %al,(%rax)
+  80684f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806852:	80 00 00             	addb   $0x0,(%rax)
+  806855:	00 00                	add    %al,(%rax)
+  806857:	00 5f 12             	add    %bl,0x12(%rdi)
+  80685a:	80 00 00             	addb   $0x0,(%rax)
+  80685d:	00 00                	add    %al,(%rax)
+  80685f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806862:	80 00 00             	addb   $0x0,(%rax)
+  806865:	00 00                	add    %al,(%rax)
+  806867:	00 5f 12             	add    %bl,0x12(%rdi)
+  80686a:	80 00 00             	addb   $0x0,(%rax)
+  80686d:	00 00                	add    %al,(%rax)
+  80686f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806872:	80 00 00             	addb   $0x0,(%rax)
+  806875:	00 00                	add    %al,(%rax)
+  806877:	00 5f 12             	add    %bl,0x12(%rdi)
+  80687a:	80 00 00             	addb   $0x0,(%rax)
+  80687d:	00 00                	add    %al,(%rax)
+  80687f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806882:	80 00 00             	addb   $0x0,(%rax)
+  806885:	00 00                	add    %al,(%rax)
+  806887:	00 5f 12             	add    %bl,0x12(%rdi)
+  80688a:	80 00 00             	addb   $0x0,(%rax)
+  80688d:	00 00                	add    %al,(%rax)
+  80688f:	00 22                	add    %ah,(%rdx)
+  806891:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806897:	00 22                	add    %ah,(%rdx)
+  806899:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  80689f:	00 22                	add    %ah,(%rdx)
+  8068a1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068a7:	00 22                	add    %ah,(%rdx)
+  8068a9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068af:	00 22                	add    %ah,(%rdx)
+  8068b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068b7:	00 22                	add    %ah,(%rdx)
+  8068b9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8068bf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068c2:	80 00 00             	addb   $0x0,(%rax)
+  8068c5:	00 00                	add    %al,(%rax)
+  8068c7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068ca:	80 00 00             	addb   $0x0,(%rax)
+  8068cd:	00 00                	add    %al,(%rax)
+  8068cf:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068d2:	80 00 00             	addb   $0x0,(%rax)
+  8068d5:	00 00                	add    %al,(%rax)
+  8068d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068da:	80 00 00             	addb   $0x0,(%rax)
+  8068dd:	00 00                	add    %al,(%rax)
+  8068df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068e2:	80 00 00             	addb   $0x0,(%rax)
+  8068e5:	00 00                	add    %al,(%rax)
+  8068e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068ea:	80 00 00             	addb   $0x0,(%rax)
+  8068ed:	00 00                	add    %al,(%rax)
+  8068ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068f2:	80 00 00             	addb   $0x0,(%rax)
+  8068f5:	00 00                	add    %al,(%rax)
+  8068f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8068fa:	80 00 00             	addb   $0x0,(%rax)
+  8068fd:	00 00                	add    %al,(%rax)
+  8068ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806902:	80 00 00             	addb   $0x0,(%rax)
+  806905:	00 00                	add    %al,(%rax)
+  806907:	00 5f 12             	add    %bl,0x12(%rdi)
+  80690a:	80 00 00             	addb   $0x0,(%rax)
+  80690d:	00 00                	add    %al,(%rax)
+  80690f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806912:	80 00 00             	addb   $0x0,(%rax)
+  806915:	00 00                	add    %al,(%rax)
+  806917:	00 5f 12             	add    %bl,0x12(%rdi)
+  80691a:	80 00 00             	addb   $0x0,(%rax)
+  80691d:	00 00                	add    %al,(%rax)
+  80691f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806922:	80 00 00             	addb   $0x0,(%rax)
+  806925:	00 00                	add    %al,(%rax)
+  806927:	00 5f 12             	add    %bl,0x12(%rdi)
+  80692a:	80 00 00             	addb   $0x0,(%rax)
+  80692d:	00 00                	add    %al,(%rax)
+  80692f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806932:	80 00 00             	addb   $0x0,(%rax)
+  806935:	00 00                	add    %al,(%rax)
+  806937:	00 5f 12             	add    %bl,0x12(%rdi)
+  80693a:	80 00 00             	addb   $0x0,(%rax)
+  80693d:	00 00                	add    %al,(%rax)
+  80693f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806942:	80 00 00             	addb   $0x0,(%rax)
+  806945:	00 00                	add    %al,(%rax)
+  806947:	00 46 12             	add    %al,0x12(%rsi)
+  80694a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806960 <basefix.0>:
+  806960:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806970:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806980:	10 00 72 69 67 68 74 00 77 72 6f 6e 67 00 73 79     ..right.wrong.sy
+  806990:	73 5f 70 61 67 65 5f 61 6c 6c 6f 63 3a 20 25 69     s_page_alloc: %i
+  8069a0:	00 75 73 65 72 2f 74 65 73 74 70 74 65 73 68 61     .user/testptesha
+  8069b0:	72 65 2e 63 00 66 6f 72 6b 20 68 61 6e 64 6c 65     re.c.fork handle
+  8069c0:	73 20 50 54 45 5f 53 48 41 52 45 20 25 73 0a 00     s PTE_SHARE %s..
+  8069d0:	61 72 67 00 2f 74 65 73 74 70 74 65 73 68 61 72     arg./testpteshar
+  8069e0:	65 00 73 70 61 77 6e 3a 20 25 69 00 73 70 61 77     e.spawn: %i.spaw
+  8069f0:	6e 20 68 61 6e 64 6c 65 73 20 50 54 45 5f 53 48     n handles PTE_SH
+  806a00:	41 52 45 20 25 73 0a 00 67 6f 6f 64 62 79 65 2c     ARE %s..goodbye,
+  806a10:	20 77 6f 72 6c 64 0a 00 68 65 6c 6c 6f 2c 20 77      world..hello, w
+  806a20:	6f 72 6c 64 0a 00 3c 75 6e 6b 6e 6f 77 6e 3e 00     orld..<unknown>.
+  806a30:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806a40:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806a50:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806a60:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806a70:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806a80:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806a90:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806aa0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806ab0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806ac0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806ad0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806ae0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806af0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806b00:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806b10:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806b20:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806b30:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806b40:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806b50:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806b60:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806b70:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806b80:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806b90:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806ba0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806bb0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806bc0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806bd0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806be0:	64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     d.f.........f...
+  806bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c00:	67 1b 80 00 00 00 00 00 be 21 80 00 00 00 00 00     g........!......
+  806c10:	ae 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806c20:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806c30:	be 21 80 00 00 00 00 00 86 1b 80 00 00 00 00 00     .!..............
+  806c40:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806c50:	7a 1b 80 00 00 00 00 00 f4 1b 80 00 00 00 00 00     z...............
+  806c60:	be 21 80 00 00 00 00 00 7a 1b 80 00 00 00 00 00     .!......z.......
+  806c70:	c0 1b 80 00 00 00 00 00 c0 1b 80 00 00 00 00 00     ................
+  806c80:	c0 1b 80 00 00 00 00 00 c0 1b 80 00 00 00 00 00     ................
+  806c90:	c0 1b 80 00 00 00 00 00 c0 1b 80 00 00 00 00 00     ................
+  806ca0:	c0 1b 80 00 00 00 00 00 c0 1b 80 00 00 00 00 00     ................
+  806cb0:	c0 1b 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .........!......
+  806cc0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806cd0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806ce0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806cf0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d00:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d10:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d20:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d30:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d40:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d50:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d60:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d70:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d80:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806d90:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806da0:	be 21 80 00 00 00 00 00 dc 20 80 00 00 00 00 00     .!....... ......
+  806db0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806dc0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806dd0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806de0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806df0:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806e00:	22 1c 80 00 00 00 00 00 f1 1d 80 00 00 00 00 00     "...............
+  806e10:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806e20:	be 21 80 00 00 00 00 00 17 1c 80 00 00 00 00 00     .!..............
+  806e30:	51 1c 80 00 00 00 00 00 be 21 80 00 00 00 00 00     Q........!......
+  806e40:	be 21 80 00 00 00 00 00 0c 1c 80 00 00 00 00 00     .!..............
+  806e50:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806e60:	9a 1f 80 00 00 00 00 00 69 20 80 00 00 00 00 00     ........i ......
+  806e70:	be 21 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .!.......!......
+  806e80:	e8 1c 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .........!......
+  806e90:	c5 1e 80 00 00 00 00 00 be 21 80 00 00 00 00 00     .........!......
+  806ea0:	be 21 80 00 00 00 00 00 dc 20 80 00 00 00 00 00     .!....... ......
+  806eb0:	be 21 80 00 00 00 00 00 70 1b 80 00 00 00 00 00     .!......p.......
+
+0000000000806ec0 <error_string>:
+	...
+  806ec8:	85 6a 80 00 00 00 00 00 97 6a 80 00 00 00 00 00     .j.......j......
+  806ed8:	a7 6a 80 00 00 00 00 00 b9 6a 80 00 00 00 00 00     .j.......j......
+  806ee8:	c7 6a 80 00 00 00 00 00 db 6a 80 00 00 00 00 00     .j.......j......
+  806ef8:	f0 6a 80 00 00 00 00 00 03 6b 80 00 00 00 00 00     .j.......k......
+  806f08:	15 6b 80 00 00 00 00 00 29 6b 80 00 00 00 00 00     .k......)k......
+  806f18:	39 6b 80 00 00 00 00 00 4c 6b 80 00 00 00 00 00     9k......Lk......
+  806f28:	63 6b 80 00 00 00 00 00 79 6b 80 00 00 00 00 00     ck......yk......
+  806f38:	91 6b 80 00 00 00 00 00 a9 6b 80 00 00 00 00 00     .k.......k......
+  806f48:	b6 6b 80 00 00 00 00 00 60 6f 80 00 00 00 00 00     .k......`o......
+  806f58:	ca 6b 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .k......file is 
+  806f68:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806f78:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806f88:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806f98:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806fa8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  806fb8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  806fc8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  806fd8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  806fe8:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  806ff8:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  807008:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  807018:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  807028:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  807038:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  807048:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  807058:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  807068:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  807078:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  807088:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  807098:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8070a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8070b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008070c0 <devtab>:
+  8070c0:	60 80 80 00 00 00 00 00 a0 80 80 00 00 00 00 00     `...............
+  8070d0:	e0 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     ................
+  8070e0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8070f0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  807100:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  807110:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  807120:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  807130:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807140:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807150:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  807160:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  807170:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  807180:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  807190:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8071a0:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  8071b0:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  8071c0:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  8071d0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  8071e0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  8071f0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807200:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  807210:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  807220:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  807230:	00 61 64 64 72 20 3d 3d 20 30 00 3c 63 6f 6e 73     .addr == 0.<cons
+  807240:	3e 00 63 6f 6e 73 00 90 55 73 65 72 73 70 61 63     >.cons..Userspac
+  807250:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  807260:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  807270:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  807280:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  807290:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8072a0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8072b0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8072c0:	3a 20 25 69 00 6c 69 62 2f 69 70 63 2e 63 00 66     : %i.lib/ipc.c.f
+  8072d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8072e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8072f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807300:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807310:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807320:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807330:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807340:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807350:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807360:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807370:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807380:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807390:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8073a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8073b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8073c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8073d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8073e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8073f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807400:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807410:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807420:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807430:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807440:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807450:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807460:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807470:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807480:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807490:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8074a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8074b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8074c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8074d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8074e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8074f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807500:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807510:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807520:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807530:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807540:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807550:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807560:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807570:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807580:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807590:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8075b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8075c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8075d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8075e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8075f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807600:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807610:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807620:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807630:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807640:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807650:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807660:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807670:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807680:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807690:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8076b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8076c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807700:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807710:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807720:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807730:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807740:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807750:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807760:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807770:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807780:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807790:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8077b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8077c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807800:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807810:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807820:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807830:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807840:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807850:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807860:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807870:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807880:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807890:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8078b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8078c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807900:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807910:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807920:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807930:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807940:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807950:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807960:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807970:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807980:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807990:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8079b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8079c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807aa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ab0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ac0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ad0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ae0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807af0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ba0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807bb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807bc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807bd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807be0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807bf0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ca0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807cb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807cc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807cd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ce0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807da0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807db0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807dc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807dd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807de0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807df0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
@@ -0,0 +1,11616 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 90 80 00 00 	movabs $0x809020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 90 80 00 00 	movabs %rax,0x809000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 90 80 00 00 	movabs 0x809000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 de 3b 80 00 00 	movabs $0x803bde,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 de 3b 80 00 00 	movabs $0x803bde,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 fb 26 80 00 00 	movabs $0x8026fb,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 fb 26 80 00 00 	movabs $0x8026fb,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 1f 1d 80 00 00 	movabs $0x801d1f,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be e7 6d 80 00 00 	movabs $0x806de7,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be a0 66 80 00 00 	movabs $0x8066a0,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be a2 66 80 00 00 	movabs $0x8066a2,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be a5 66 80 00 00 	movabs $0x8066a5,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 46 5d 80 00 00 	movabs $0x805d46,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 1d 60 80 00 00 	movabs $0x80601d,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 c8 3c 80 00 00 	movabs $0x803cc8,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 97 3c 80 00 00 	movabs $0x803c97,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 af 3a 80 00 00 	movabs $0x803aaf,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 de 3b 80 00 00 	movabs $0x803bde,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 38 2a 80 00 00 	movabs $0x802a38,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be c0 66 80 00 00 	movabs $0x8066c0,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 38 2a 80 00 00 	movabs $0x802a38,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 60 69 80 00 00 	movabs $0x806960,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 38 2a 80 00 00 	movabs $0x802a38,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 38 2a 80 00 00 	movabs $0x802a38,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 e0 6b 80 00 00 	movabs $0x806be0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 e0 6b 80 00 00 	movabs $0x806be0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 90 2c 80 00 00 	movabs $0x802c90,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 90 2c 80 00 00 	movabs $0x802c90,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 77 07 00 00       	call   801c76 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  801515:	89 fb                	mov    %edi,%ebx
+  801517:	41 89 f4             	mov    %esi,%r12d
+  80151a:	41 89 d6             	mov    %edx,%r14d
+  80151d:	41 89 cd             	mov    %ecx,%r13d
+  801520:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  801527:	89 d6                	mov    %edx,%esi
+  801529:	49 bf 97 3c 80 00 00 	movabs $0x803c97,%r15
+  801530:	00 00 00 
+  801533:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  801536:	44 89 f6             	mov    %r14d,%esi
+  801539:	44 89 e7             	mov    %r12d,%edi
+  80153c:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  80153f:	48 bf 08 6c 80 00 00 	movabs $0x806c08,%rdi
+  801546:	00 00 00 
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154e:	49 be 92 1e 80 00 00 	movabs $0x801e92,%r14
+  801555:	00 00 00 
+  801558:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80155b:	41 0f be f5          	movsbl %r13b,%esi
+  80155f:	48 bf 7b 6c 80 00 00 	movabs $0x806c7b,%rdi
+  801566:	00 00 00 
+  801569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156e:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  801571:	49 bd af 3a 80 00 00 	movabs $0x803aaf,%r13
+  801578:	00 00 00 
+        sys_cputs(buf, n);
+  80157b:	49 be 46 2d 80 00 00 	movabs $0x802d46,%r14
+  801582:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  801585:	eb 0d                	jmp    801594 <wrong+0x93>
+        sys_cputs(buf, n);
+  801587:	48 63 f0             	movslq %eax,%rsi
+  80158a:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  801591:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  801594:	ba 63 00 00 00       	mov    $0x63,%edx
+  801599:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8015a0:	44 89 e7             	mov    %r12d,%edi
+  8015a3:	41 ff d5             	call   *%r13
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	7f dd                	jg     801587 <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8015aa:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8015b1:	48 bf 8c 6c 80 00 00 	movabs $0x806c8c,%rdi
+  8015b8:	00 00 00 
+  8015bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c0:	48 ba 92 1e 80 00 00 	movabs $0x801e92,%rdx
+  8015c7:	00 00 00 
+  8015ca:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8015cc:	49 bc af 3a 80 00 00 	movabs $0x803aaf,%r12
+  8015d3:	00 00 00 
+        sys_cputs(buf, n);
+  8015d6:	49 bd 46 2d 80 00 00 	movabs $0x802d46,%r13
+  8015dd:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8015e0:	eb 0d                	jmp    8015ef <wrong+0xee>
+        sys_cputs(buf, n);
+  8015e2:	48 63 f0             	movslq %eax,%rsi
+  8015e5:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8015ec:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8015ef:	ba 63 00 00 00       	mov    $0x63,%edx
+  8015f4:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8015fb:	89 df                	mov    %ebx,%edi
+  8015fd:	41 ff d4             	call   *%r12
+  801600:	85 c0                	test   %eax,%eax
+  801602:	7f de                	jg     8015e2 <wrong+0xe1>
+    cprintf("===\n");
+  801604:	48 bf 9c 6c 80 00 00 	movabs $0x806c9c,%rdi
+  80160b:	00 00 00 
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	48 ba 92 1e 80 00 00 	movabs $0x801e92,%rdx
+  80161a:	00 00 00 
+  80161d:	ff d2                	call   *%rdx
+    exit();
+  80161f:	48 b8 1f 1d 80 00 00 	movabs $0x801d1f,%rax
+  801626:	00 00 00 
+  801629:	ff d0                	call   *%rax
+}
+  80162b:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  801632:	5b                   	pop    %rbx
+  801633:	41 5c                	pop    %r12
+  801635:	41 5d                	pop    %r13
+  801637:	41 5e                	pop    %r14
+  801639:	41 5f                	pop    %r15
+  80163b:	5d                   	pop    %rbp
+  80163c:	c3                   	ret
+
+000000000080163d <umain>:
+umain(int argc, char **argv) {
+  80163d:	55                   	push   %rbp
+  80163e:	48 89 e5             	mov    %rsp,%rbp
+  801641:	41 57                	push   %r15
+  801643:	41 56                	push   %r14
+  801645:	41 55                	push   %r13
+  801647:	41 54                	push   %r12
+  801649:	53                   	push   %rbx
+  80164a:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  80164e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801653:	48 bb 31 39 80 00 00 	movabs $0x803931,%rbx
+  80165a:	00 00 00 
+  80165d:	ff d3                	call   *%rbx
+    close(1);
+  80165f:	bf 01 00 00 00       	mov    $0x1,%edi
+  801664:	ff d3                	call   *%rbx
+    opencons();
+  801666:	48 bb 0f 1c 80 00 00 	movabs $0x801c0f,%rbx
+  80166d:	00 00 00 
+  801670:	ff d3                	call   *%rbx
+    opencons();
+  801672:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  801674:	be 00 00 00 00       	mov    $0x0,%esi
+  801679:	48 bf a1 6c 80 00 00 	movabs $0x806ca1,%rdi
+  801680:	00 00 00 
+  801683:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  80168a:	00 00 00 
+  80168d:	ff d0                	call   *%rax
+  80168f:	89 c3                	mov    %eax,%ebx
+  801691:	85 c0                	test   %eax,%eax
+  801693:	0f 88 4c 01 00 00    	js     8017e5 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  801699:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  80169d:	48 b8 34 52 80 00 00 	movabs $0x805234,%rax
+  8016a4:	00 00 00 
+  8016a7:	ff d0                	call   *%rax
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	0f 88 61 01 00 00    	js     801812 <umain+0x1d5>
+    wfd = pfds[1];
+  8016b1:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8016b5:	48 bf 30 6c 80 00 00 	movabs $0x806c30,%rdi
+  8016bc:	00 00 00 
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c4:	48 ba 92 1e 80 00 00 	movabs $0x801e92,%rdx
+  8016cb:	00 00 00 
+  8016ce:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8016d0:	48 b8 8c 35 80 00 00 	movabs $0x80358c,%rax
+  8016d7:	00 00 00 
+  8016da:	ff d0                	call   *%rax
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	0f 88 5b 01 00 00    	js     80183f <umain+0x202>
+    if (r == 0) {
+  8016e4:	0f 85 a9 00 00 00    	jne    801793 <umain+0x156>
+        dup(rfd, 0);
+  8016ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ef:	89 df                	mov    %ebx,%edi
+  8016f1:	49 bd 8c 39 80 00 00 	movabs $0x80398c,%r13
+  8016f8:	00 00 00 
+  8016fb:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  8016fe:	be 01 00 00 00       	mov    $0x1,%esi
+  801703:	44 89 e7             	mov    %r12d,%edi
+  801706:	41 ff d5             	call   *%r13
+        close(rfd);
+  801709:	89 df                	mov    %ebx,%edi
+  80170b:	49 bd 31 39 80 00 00 	movabs $0x803931,%r13
+  801712:	00 00 00 
+  801715:	41 ff d5             	call   *%r13
+        close(wfd);
+  801718:	44 89 e7             	mov    %r12d,%edi
+  80171b:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80171e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801723:	48 ba de 6c 80 00 00 	movabs $0x806cde,%rdx
+  80172a:	00 00 00 
+  80172d:	48 be ab 6c 80 00 00 	movabs $0x806cab,%rsi
+  801734:	00 00 00 
+  801737:	48 bf e1 6c 80 00 00 	movabs $0x806ce1,%rdi
+  80173e:	00 00 00 
+  801741:	b8 00 00 00 00       	mov    $0x0,%eax
+  801746:	49 b8 98 4e 80 00 00 	movabs $0x804e98,%r8
+  80174d:	00 00 00 
+  801750:	41 ff d0             	call   *%r8
+  801753:	41 89 c5             	mov    %eax,%r13d
+  801756:	85 c0                	test   %eax,%eax
+  801758:	0f 88 0e 01 00 00    	js     80186c <umain+0x22f>
+        close(0);
+  80175e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801763:	49 be 31 39 80 00 00 	movabs $0x803931,%r14
+  80176a:	00 00 00 
+  80176d:	41 ff d6             	call   *%r14
+        close(1);
+  801770:	bf 01 00 00 00       	mov    $0x1,%edi
+  801775:	41 ff d6             	call   *%r14
+        wait(r);
+  801778:	44 89 ef             	mov    %r13d,%edi
+  80177b:	48 b8 93 54 80 00 00 	movabs $0x805493,%rax
+  801782:	00 00 00 
+  801785:	ff d0                	call   *%rax
+        exit();
+  801787:	48 b8 1f 1d 80 00 00 	movabs $0x801d1f,%rax
+  80178e:	00 00 00 
+  801791:	ff d0                	call   *%rax
+    close(rfd);
+  801793:	89 df                	mov    %ebx,%edi
+  801795:	48 bb 31 39 80 00 00 	movabs $0x803931,%rbx
+  80179c:	00 00 00 
+  80179f:	ff d3                	call   *%rbx
+    close(wfd);
+  8017a1:	44 89 e7             	mov    %r12d,%edi
+  8017a4:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8017a6:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8017aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8017af:	48 bf ef 6c 80 00 00 	movabs $0x806cef,%rdi
+  8017b6:	00 00 00 
+  8017b9:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+  8017c5:	41 89 c6             	mov    %eax,%r14d
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	0f 88 c9 00 00 00    	js     801899 <umain+0x25c>
+    for (off = 0;; off++) {
+  8017d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8017d6:	49 bd af 3a 80 00 00 	movabs $0x803aaf,%r13
+  8017dd:	00 00 00 
+  8017e0:	e9 5c 01 00 00       	jmp    801941 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  8017e5:	89 c1                	mov    %eax,%ecx
+  8017e7:	48 ba ae 6c 80 00 00 	movabs $0x806cae,%rdx
+  8017ee:	00 00 00 
+  8017f1:	be 12 00 00 00       	mov    $0x12,%esi
+  8017f6:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  8017fd:	00 00 00 
+  801800:	b8 00 00 00 00       	mov    $0x0,%eax
+  801805:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  80180c:	00 00 00 
+  80180f:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  801812:	89 c1                	mov    %eax,%ecx
+  801814:	48 ba d5 6c 80 00 00 	movabs $0x806cd5,%rdx
+  80181b:	00 00 00 
+  80181e:	be 14 00 00 00       	mov    $0x14,%esi
+  801823:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  80182a:	00 00 00 
+  80182d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801832:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  801839:	00 00 00 
+  80183c:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  80183f:	89 c1                	mov    %eax,%ecx
+  801841:	48 ba dc 72 80 00 00 	movabs $0x8072dc,%rdx
+  801848:	00 00 00 
+  80184b:	be 19 00 00 00       	mov    $0x19,%esi
+  801850:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  801857:	00 00 00 
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185f:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  801866:	00 00 00 
+  801869:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  80186c:	89 c1                	mov    %eax,%ecx
+  80186e:	48 ba e5 6c 80 00 00 	movabs $0x806ce5,%rdx
+  801875:	00 00 00 
+  801878:	be 20 00 00 00       	mov    $0x20,%esi
+  80187d:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  801884:	00 00 00 
+  801887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188c:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  801893:	00 00 00 
+  801896:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  801899:	89 c1                	mov    %eax,%ecx
+  80189b:	48 ba 58 6c 80 00 00 	movabs $0x806c58,%rdx
+  8018a2:	00 00 00 
+  8018a5:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8018aa:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  8018b1:	00 00 00 
+  8018b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b9:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8018c0:	00 00 00 
+  8018c3:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8018c6:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8018c9:	48 ba fd 6c 80 00 00 	movabs $0x806cfd,%rdx
+  8018d0:	00 00 00 
+  8018d3:	be 32 00 00 00       	mov    $0x32,%esi
+  8018d8:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  8018df:	00 00 00 
+  8018e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e7:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8018ee:	00 00 00 
+  8018f1:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  8018f4:	48 ba 17 6d 80 00 00 	movabs $0x806d17,%rdx
+  8018fb:	00 00 00 
+  8018fe:	be 34 00 00 00       	mov    $0x34,%esi
+  801903:	48 bf c4 6c 80 00 00 	movabs $0x806cc4,%rdi
+  80190a:	00 00 00 
+  80190d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801912:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  801919:	00 00 00 
+  80191c:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  80191f:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  801923:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  801928:	44 89 e2             	mov    %r12d,%edx
+  80192b:	44 89 f6             	mov    %r14d,%esi
+  80192e:	44 89 ff             	mov    %r15d,%edi
+  801931:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801938:	00 00 00 
+  80193b:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  80193d:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  801941:	ba 01 00 00 00       	mov    $0x1,%edx
+  801946:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80194a:	44 89 ff             	mov    %r15d,%edi
+  80194d:	41 ff d5             	call   *%r13
+  801950:	48 89 c3             	mov    %rax,%rbx
+  801953:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  801956:	ba 01 00 00 00       	mov    $0x1,%edx
+  80195b:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  80195f:	44 89 f7             	mov    %r14d,%edi
+  801962:	41 ff d5             	call   *%r13
+  801965:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  801967:	85 db                	test   %ebx,%ebx
+  801969:	0f 88 57 ff ff ff    	js     8018c6 <umain+0x289>
+        if (n2 < 0)
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 81                	js     8018f4 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  801973:	89 c2                	mov    %eax,%edx
+  801975:	09 da                	or     %ebx,%edx
+  801977:	74 15                	je     80198e <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  801979:	83 fb 01             	cmp    $0x1,%ebx
+  80197c:	75 a1                	jne    80191f <umain+0x2e2>
+  80197e:	83 f8 01             	cmp    $0x1,%eax
+  801981:	75 9c                	jne    80191f <umain+0x2e2>
+  801983:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  801987:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  80198a:	75 93                	jne    80191f <umain+0x2e2>
+  80198c:	eb af                	jmp    80193d <umain+0x300>
+    cprintf("shell ran correctly\n");
+  80198e:	48 bf 31 6d 80 00 00 	movabs $0x806d31,%rdi
+  801995:	00 00 00 
+  801998:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199d:	48 ba 92 1e 80 00 00 	movabs $0x801e92,%rdx
+  8019a4:	00 00 00 
+  8019a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8019a9:	cc                   	int3
+}
+  8019aa:	48 83 c4 28          	add    $0x28,%rsp
+  8019ae:	5b                   	pop    %rbx
+  8019af:	41 5c                	pop    %r12
+  8019b1:	41 5d                	pop    %r13
+  8019b3:	41 5e                	pop    %r14
+  8019b5:	41 5f                	pop    %r15
+  8019b7:	5d                   	pop    %rbp
+  8019b8:	c3                   	ret
+
+00000000008019b9 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8019b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019be:	c3                   	ret
+
+00000000008019bf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8019bf:	55                   	push   %rbp
+  8019c0:	48 89 e5             	mov    %rsp,%rbp
+  8019c3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8019c6:	48 be 46 6d 80 00 00 	movabs $0x806d46,%rsi
+  8019cd:	00 00 00 
+  8019d0:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  8019d7:	00 00 00 
+  8019da:	ff d0                	call   *%rax
+    return 0;
+}
+  8019dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e1:	5d                   	pop    %rbp
+  8019e2:	c3                   	ret
+
+00000000008019e3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8019e3:	55                   	push   %rbp
+  8019e4:	48 89 e5             	mov    %rsp,%rbp
+  8019e7:	41 57                	push   %r15
+  8019e9:	41 56                	push   %r14
+  8019eb:	41 55                	push   %r13
+  8019ed:	41 54                	push   %r12
+  8019ef:	53                   	push   %rbx
+  8019f0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8019f7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  8019fe:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  801a05:	00 00 00 00 
+  801a09:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  801a10:	00 00 00 00 
+  801a14:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  801a1b:	00 00 00 00 
+  801a1f:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  801a26:	00 00 00 00 
+  801a2a:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  801a31:	00 00 00 00 
+  801a35:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  801a3c:	00 00 00 00 
+  801a40:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  801a47:	00 
+  801a48:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  801a4f:	00 
+  801a50:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  801a57:	00 
+  801a58:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  801a5f:	00 
+  801a60:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801a67:	00 
+  801a68:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  801a6f:	00 
+  801a70:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a77:	00 
+  801a78:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  801a7f:	00 
+  801a80:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  801a87:	00 
+  801a88:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801a8f:	00 
+    for (res = 0; res < n; res += inc) {
+  801a90:	48 85 d2             	test   %rdx,%rdx
+  801a93:	74 7a                	je     801b0f <devcons_write+0x12c>
+  801a95:	49 89 d6             	mov    %rdx,%r14
+  801a98:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801a9e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  801aa3:	49 bf 19 2b 80 00 00 	movabs $0x802b19,%r15
+  801aaa:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  801aad:	4c 89 f3             	mov    %r14,%rbx
+  801ab0:	48 29 f3             	sub    %rsi,%rbx
+  801ab3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801ab8:	48 39 c3             	cmp    %rax,%rbx
+  801abb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  801abf:	4c 63 eb             	movslq %ebx,%r13
+  801ac2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  801ac9:	48 01 c6             	add    %rax,%rsi
+  801acc:	4c 89 ea             	mov    %r13,%rdx
+  801acf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ad6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  801ad9:	4c 89 ee             	mov    %r13,%rsi
+  801adc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801ae3:	48 b8 46 2d 80 00 00 	movabs $0x802d46,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  801aef:	41 01 dc             	add    %ebx,%r12d
+  801af2:	49 63 f4             	movslq %r12d,%rsi
+  801af5:	4c 39 f6             	cmp    %r14,%rsi
+  801af8:	72 b3                	jb     801aad <devcons_write+0xca>
+    return res;
+  801afa:	49 63 c4             	movslq %r12d,%rax
+}
+  801afd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  801b04:	5b                   	pop    %rbx
+  801b05:	41 5c                	pop    %r12
+  801b07:	41 5d                	pop    %r13
+  801b09:	41 5e                	pop    %r14
+  801b0b:	41 5f                	pop    %r15
+  801b0d:	5d                   	pop    %rbp
+  801b0e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  801b0f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801b15:	eb e3                	jmp    801afa <devcons_write+0x117>
+
+0000000000801b17 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b17:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  801b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b1f:	48 85 c0             	test   %rax,%rax
+  801b22:	74 55                	je     801b79 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	41 55                	push   %r13
+  801b2a:	41 54                	push   %r12
+  801b2c:	53                   	push   %rbx
+  801b2d:	48 83 ec 08          	sub    $0x8,%rsp
+  801b31:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  801b34:	48 bb 79 2d 80 00 00 	movabs $0x802d79,%rbx
+  801b3b:	00 00 00 
+  801b3e:	49 bc 8d 2e 80 00 00 	movabs $0x802e8d,%r12
+  801b45:	00 00 00 
+  801b48:	eb 03                	jmp    801b4d <devcons_read+0x36>
+  801b4a:	41 ff d4             	call   *%r12
+  801b4d:	ff d3                	call   *%rbx
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	74 f7                	je     801b4a <devcons_read+0x33>
+    if (c < 0) return c;
+  801b53:	48 63 d0             	movslq %eax,%rdx
+  801b56:	78 13                	js     801b6b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  801b58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5d:	83 f8 04             	cmp    $0x4,%eax
+  801b60:	74 09                	je     801b6b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  801b62:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  801b66:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  801b6b:	48 89 d0             	mov    %rdx,%rax
+  801b6e:	48 83 c4 08          	add    $0x8,%rsp
+  801b72:	5b                   	pop    %rbx
+  801b73:	41 5c                	pop    %r12
+  801b75:	41 5d                	pop    %r13
+  801b77:	5d                   	pop    %rbp
+  801b78:	c3                   	ret
+  801b79:	48 89 d0             	mov    %rdx,%rax
+  801b7c:	c3                   	ret
+
+0000000000801b7d <cputchar>:
+cputchar(int ch) {
+  801b7d:	55                   	push   %rbp
+  801b7e:	48 89 e5             	mov    %rsp,%rbp
+  801b81:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  801b85:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  801b89:	be 01 00 00 00       	mov    $0x1,%esi
+  801b8e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  801b92:	48 b8 46 2d 80 00 00 	movabs $0x802d46,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+}
+  801b9e:	c9                   	leave
+  801b9f:	c3                   	ret
+
+0000000000801ba0 <getchar>:
+getchar(void) {
+  801ba0:	55                   	push   %rbp
+  801ba1:	48 89 e5             	mov    %rsp,%rbp
+  801ba4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  801ba8:	ba 01 00 00 00       	mov    $0x1,%edx
+  801bad:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  801bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb6:	48 b8 af 3a 80 00 00 	movabs $0x803aaf,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 06                	js     801bce <getchar+0x2e>
+  801bc8:	74 08                	je     801bd2 <getchar+0x32>
+  801bca:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  801bce:	89 d0                	mov    %edx,%eax
+  801bd0:	c9                   	leave
+  801bd1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  801bd2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  801bd7:	eb f5                	jmp    801bce <getchar+0x2e>
+
+0000000000801bd9 <iscons>:
+iscons(int fdnum) {
+  801bd9:	55                   	push   %rbp
+  801bda:	48 89 e5             	mov    %rsp,%rbp
+  801bdd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  801be1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801be5:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  801bec:	00 00 00 
+  801bef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 18                	js     801c0d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  801bf5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bf9:	48 b8 40 80 80 00 00 	movabs $0x808040,%rax
+  801c00:	00 00 00 
+  801c03:	8b 00                	mov    (%rax),%eax
+  801c05:	39 02                	cmp    %eax,(%rdx)
+  801c07:	0f 94 c0             	sete   %al
+  801c0a:	0f b6 c0             	movzbl %al,%eax
+}
+  801c0d:	c9                   	leave
+  801c0e:	c3                   	ret
+
+0000000000801c0f <opencons>:
+opencons(void) {
+  801c0f:	55                   	push   %rbp
+  801c10:	48 89 e5             	mov    %rsp,%rbp
+  801c13:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801c17:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  801c1b:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 49                	js     801c74 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  801c2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c35:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  801c39:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3e:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  801c45:	00 00 00 
+  801c48:	ff d0                	call   *%rax
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	78 26                	js     801c74 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  801c4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c52:	a1 40 80 80 00 00 00 	movabs 0x808040,%eax
+  801c59:	00 00 
+  801c5b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  801c5d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c61:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  801c68:	48 b8 3e 37 80 00 00 	movabs $0x80373e,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+
+0000000000801c76 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	41 56                	push   %r14
+  801c7c:	41 55                	push   %r13
+  801c7e:	41 54                	push   %r12
+  801c80:	53                   	push   %rbx
+  801c81:	41 89 fd             	mov    %edi,%r13d
+  801c84:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  801c87:	48 ba f8 80 80 00 00 	movabs $0x8080f8,%rdx
+  801c8e:	00 00 00 
+  801c91:	48 b8 f8 80 80 00 00 	movabs $0x8080f8,%rax
+  801c98:	00 00 00 
+  801c9b:	48 39 c2             	cmp    %rax,%rdx
+  801c9e:	73 17                	jae    801cb7 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801ca0:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  801ca3:	49 89 c4             	mov    %rax,%r12
+  801ca6:	48 83 c3 08          	add    $0x8,%rbx
+  801caa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801caf:	ff 53 f8             	call   *-0x8(%rbx)
+  801cb2:	4c 39 e3             	cmp    %r12,%rbx
+  801cb5:	72 ef                	jb     801ca6 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801cb7:	48 b8 56 2e 80 00 00 	movabs $0x802e56,%rax
+  801cbe:	00 00 00 
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cc8:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  801ccf:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801cd6:	00 00 00 
+  801cd9:	48 01 d0             	add    %rdx,%rax
+  801cdc:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  801ce3:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801ce6:	45 85 ed             	test   %r13d,%r13d
+  801ce9:	7e 0d                	jle    801cf8 <libmain+0x82>
+  801ceb:	49 8b 06             	mov    (%r14),%rax
+  801cee:	48 a3 78 80 80 00 00 	movabs %rax,0x808078
+  801cf5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801cf8:	4c 89 f6             	mov    %r14,%rsi
+  801cfb:	44 89 ef             	mov    %r13d,%edi
+  801cfe:	48 b8 3d 16 80 00 00 	movabs $0x80163d,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801d0a:	48 b8 1f 1d 80 00 00 	movabs $0x801d1f,%rax
+  801d11:	00 00 00 
+  801d14:	ff d0                	call   *%rax
+#endif
+}
+  801d16:	5b                   	pop    %rbx
+  801d17:	41 5c                	pop    %r12
+  801d19:	41 5d                	pop    %r13
+  801d1b:	41 5e                	pop    %r14
+  801d1d:	5d                   	pop    %rbp
+  801d1e:	c3                   	ret
+
+0000000000801d1f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801d1f:	55                   	push   %rbp
+  801d20:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801d23:	48 b8 64 39 80 00 00 	movabs $0x803964,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801d2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d34:	48 b8 e5 2d 80 00 00 	movabs $0x802de5,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+}
+  801d40:	5d                   	pop    %rbp
+  801d41:	c3                   	ret
+
+0000000000801d42 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  801d42:	55                   	push   %rbp
+  801d43:	48 89 e5             	mov    %rsp,%rbp
+  801d46:	41 56                	push   %r14
+  801d48:	41 55                	push   %r13
+  801d4a:	41 54                	push   %r12
+  801d4c:	53                   	push   %rbx
+  801d4d:	48 83 ec 50          	sub    $0x50,%rsp
+  801d51:	49 89 fc             	mov    %rdi,%r12
+  801d54:	41 89 f5             	mov    %esi,%r13d
+  801d57:	48 89 d3             	mov    %rdx,%rbx
+  801d5a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801d5e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  801d62:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801d66:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  801d6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801d71:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  801d75:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  801d79:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  801d7d:	48 b8 78 80 80 00 00 	movabs $0x808078,%rax
+  801d84:	00 00 00 
+  801d87:	4c 8b 30             	mov    (%rax),%r14
+  801d8a:	48 b8 56 2e 80 00 00 	movabs $0x802e56,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+  801d96:	89 c6                	mov    %eax,%esi
+  801d98:	45 89 e8             	mov    %r13d,%r8d
+  801d9b:	4c 89 e1             	mov    %r12,%rcx
+  801d9e:	4c 89 f2             	mov    %r14,%rdx
+  801da1:	48 bf 60 6d 80 00 00 	movabs $0x806d60,%rdi
+  801da8:	00 00 00 
+  801dab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801db0:	49 bc 92 1e 80 00 00 	movabs $0x801e92,%r12
+  801db7:	00 00 00 
+  801dba:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  801dbd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  801dc1:	48 89 df             	mov    %rbx,%rdi
+  801dc4:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+    cprintf("\n");
+  801dd0:	48 bf 9f 6c 80 00 00 	movabs $0x806c9f,%rdi
+  801dd7:	00 00 00 
+  801dda:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddf:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  801de2:	cc                   	int3
+  801de3:	eb fd                	jmp    801de2 <_panic+0xa0>
+
+0000000000801de5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801de5:	55                   	push   %rbp
+  801de6:	48 89 e5             	mov    %rsp,%rbp
+  801de9:	53                   	push   %rbx
+  801dea:	48 83 ec 08          	sub    $0x8,%rsp
+  801dee:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801df1:	8b 06                	mov    (%rsi),%eax
+  801df3:	8d 50 01             	lea    0x1(%rax),%edx
+  801df6:	89 16                	mov    %edx,(%rsi)
+  801df8:	48 98                	cltq
+  801dfa:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801dff:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  801e05:	74 0a                	je     801e11 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  801e07:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801e0b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e0f:	c9                   	leave
+  801e10:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801e11:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  801e15:	be ff 00 00 00       	mov    $0xff,%esi
+  801e1a:	48 b8 46 2d 80 00 00 	movabs $0x802d46,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+        state->offset = 0;
+  801e26:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801e2c:	eb d9                	jmp    801e07 <putch+0x22>
+
+0000000000801e2e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801e2e:	55                   	push   %rbp
+  801e2f:	48 89 e5             	mov    %rsp,%rbp
+  801e32:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  801e39:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801e3c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801e43:	b9 21 00 00 00       	mov    $0x21,%ecx
+  801e48:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801e50:	48 89 f1             	mov    %rsi,%rcx
+  801e53:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801e5a:	48 bf e5 1d 80 00 00 	movabs $0x801de5,%rdi
+  801e61:	00 00 00 
+  801e64:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  801e6b:	00 00 00 
+  801e6e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  801e70:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801e77:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801e7e:	48 b8 46 2d 80 00 00 	movabs $0x802d46,%rax
+  801e85:	00 00 00 
+  801e88:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801e8a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  801e90:	c9                   	leave
+  801e91:	c3                   	ret
+
+0000000000801e92 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  801e92:	55                   	push   %rbp
+  801e93:	48 89 e5             	mov    %rsp,%rbp
+  801e96:	48 83 ec 50          	sub    $0x50,%rsp
+  801e9a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801e9e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  801ea2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ea6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801eaa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801eae:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801eb5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801eb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ebd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801ec1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801ec5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801ec9:	48 b8 2e 1e 80 00 00 	movabs $0x801e2e,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801ed5:	c9                   	leave
+  801ed6:	c3                   	ret
+
+0000000000801ed7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801ed7:	55                   	push   %rbp
+  801ed8:	48 89 e5             	mov    %rsp,%rbp
+  801edb:	41 57                	push   %r15
+  801edd:	41 56                	push   %r14
+  801edf:	41 55                	push   %r13
+  801ee1:	41 54                	push   %r12
+  801ee3:	53                   	push   %rbx
+  801ee4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee8:	49 89 fc             	mov    %rdi,%r12
+  801eeb:	49 89 f5             	mov    %rsi,%r13
+  801eee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ef2:	8b 45 10             	mov    0x10(%rbp),%eax
+  801ef5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801ef8:	41 89 cf             	mov    %ecx,%r15d
+  801efb:	4c 39 fa             	cmp    %r15,%rdx
+  801efe:	73 5b                	jae    801f5b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801f00:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801f04:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801f08:	85 db                	test   %ebx,%ebx
+  801f0a:	7e 0e                	jle    801f1a <print_num+0x43>
+            putch(padc, put_arg);
+  801f0c:	4c 89 ee             	mov    %r13,%rsi
+  801f0f:	44 89 f7             	mov    %r14d,%edi
+  801f12:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801f15:	83 eb 01             	sub    $0x1,%ebx
+  801f18:	75 f2                	jne    801f0c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801f1a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801f1e:	48 b9 94 6d 80 00 00 	movabs $0x806d94,%rcx
+  801f25:	00 00 00 
+  801f28:	48 b8 83 6d 80 00 00 	movabs $0x806d83,%rax
+  801f2f:	00 00 00 
+  801f32:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801f36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3f:	49 f7 f7             	div    %r15
+  801f42:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801f46:	4c 89 ee             	mov    %r13,%rsi
+  801f49:	41 ff d4             	call   *%r12
+}
+  801f4c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801f50:	5b                   	pop    %rbx
+  801f51:	41 5c                	pop    %r12
+  801f53:	41 5d                	pop    %r13
+  801f55:	41 5e                	pop    %r14
+  801f57:	41 5f                	pop    %r15
+  801f59:	5d                   	pop    %rbp
+  801f5a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801f5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f64:	49 f7 f7             	div    %r15
+  801f67:	48 83 ec 08          	sub    $0x8,%rsp
+  801f6b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801f6f:	52                   	push   %rdx
+  801f70:	45 0f be c9          	movsbl %r9b,%r9d
+  801f74:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801f78:	48 89 c2             	mov    %rax,%rdx
+  801f7b:	48 b8 d7 1e 80 00 00 	movabs $0x801ed7,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	48 83 c4 10          	add    $0x10,%rsp
+  801f8b:	eb 8d                	jmp    801f1a <print_num+0x43>
+
+0000000000801f8d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801f8d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801f91:	48 8b 06             	mov    (%rsi),%rax
+  801f94:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801f98:	73 0a                	jae    801fa4 <sprintputch+0x17>
+        *state->start++ = ch;
+  801f9a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801f9e:	48 89 16             	mov    %rdx,(%rsi)
+  801fa1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801fa4:	c3                   	ret
+
+0000000000801fa5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801fa5:	55                   	push   %rbp
+  801fa6:	48 89 e5             	mov    %rsp,%rbp
+  801fa9:	48 83 ec 50          	sub    $0x50,%rsp
+  801fad:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801fb1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801fb5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801fb9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801fc0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801fc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fc8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801fcc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801fd0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801fd4:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+}
+  801fe0:	c9                   	leave
+  801fe1:	c3                   	ret
+
+0000000000801fe2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801fe2:	55                   	push   %rbp
+  801fe3:	48 89 e5             	mov    %rsp,%rbp
+  801fe6:	41 57                	push   %r15
+  801fe8:	41 56                	push   %r14
+  801fea:	41 55                	push   %r13
+  801fec:	41 54                	push   %r12
+  801fee:	53                   	push   %rbx
+  801fef:	48 83 ec 38          	sub    $0x38,%rsp
+  801ff3:	49 89 fe             	mov    %rdi,%r14
+  801ff6:	49 89 f5             	mov    %rsi,%r13
+  801ff9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801ffc:	48 8b 01             	mov    (%rcx),%rax
+  801fff:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  802003:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  802007:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80200b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80200f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802013:	eb 0d                	jmp    802022 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  802015:	40 0f b6 ff          	movzbl %dil,%edi
+  802019:	4c 89 ee             	mov    %r13,%rsi
+  80201c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80201f:	4c 89 e3             	mov    %r12,%rbx
+  802022:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  802026:	0f b6 3b             	movzbl (%rbx),%edi
+  802029:	40 80 ff 25          	cmp    $0x25,%dil
+  80202d:	74 14                	je     802043 <vprintfmt+0x61>
+            if (!ch) return;
+  80202f:	40 84 ff             	test   %dil,%dil
+  802032:	75 e1                	jne    802015 <vprintfmt+0x33>
+}
+  802034:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  802038:	5b                   	pop    %rbx
+  802039:	41 5c                	pop    %r12
+  80203b:	41 5d                	pop    %r13
+  80203d:	41 5e                	pop    %r14
+  80203f:	41 5f                	pop    %r15
+  802041:	5d                   	pop    %rbp
+  802042:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  802043:	be 00 00 00 00       	mov    $0x0,%esi
+  802048:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80204c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  802051:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  802057:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80205e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  802062:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  802067:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80206c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80206f:	83 e8 23             	sub    $0x23,%eax
+  802072:	3c 57                	cmp    $0x57,%al
+  802074:	0f 87 67 06 00 00    	ja     8026e1 <vprintfmt+0x6ff>
+  80207a:	0f b6 c0             	movzbl %al,%eax
+  80207d:	48 b9 20 6f 80 00 00 	movabs $0x806f20,%rcx
+  802084:	00 00 00 
+  802087:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80208a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80208d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  802091:	eb cf                	jmp    802062 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  802093:	49 89 dc             	mov    %rbx,%r12
+  802096:	be 01 00 00 00       	mov    $0x1,%esi
+  80209b:	eb c5                	jmp    802062 <vprintfmt+0x80>
+            padc = ch;
+  80209d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8020a1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8020a4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8020a7:	eb b9                	jmp    802062 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8020a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8020af:	77 24                	ja     8020d5 <vprintfmt+0xf3>
+  8020b1:	89 c1                	mov    %eax,%ecx
+  8020b3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8020b7:	83 c0 08             	add    $0x8,%eax
+  8020ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020bd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8020c0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8020c3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8020c7:	79 99                	jns    802062 <vprintfmt+0x80>
+                width = precision;
+  8020c9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8020cd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8020d3:	eb 8d                	jmp    802062 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  8020d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8020d9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8020dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020e1:	eb da                	jmp    8020bd <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  8020e3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8020e8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8020ec:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8020f2:	3c 39                	cmp    $0x39,%al
+  8020f4:	77 1c                	ja     802112 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8020f6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8020fa:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8020fe:	0f b6 c0             	movzbl %al,%eax
+  802101:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  802106:	0f b6 03             	movzbl (%rbx),%eax
+  802109:	3c 39                	cmp    $0x39,%al
+  80210b:	76 e9                	jbe    8020f6 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  80210d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  802110:	eb b1                	jmp    8020c3 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  802112:	49 89 dc             	mov    %rbx,%r12
+  802115:	eb ac                	jmp    8020c3 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  802117:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80211a:	85 c9                	test   %ecx,%ecx
+  80211c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802121:	0f 49 c1             	cmovns %ecx,%eax
+  802124:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  802127:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80212a:	e9 33 ff ff ff       	jmp    802062 <vprintfmt+0x80>
+            lflag++;
+  80212f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  802132:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802135:	e9 28 ff ff ff       	jmp    802062 <vprintfmt+0x80>
+            lflag--;
+  80213a:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80213d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  802140:	e9 1d ff ff ff       	jmp    802062 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  802145:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802148:	83 f8 2f             	cmp    $0x2f,%eax
+  80214b:	77 19                	ja     802166 <vprintfmt+0x184>
+  80214d:	89 c2                	mov    %eax,%edx
+  80214f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802153:	83 c0 08             	add    $0x8,%eax
+  802156:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802159:	8b 3a                	mov    (%rdx),%edi
+  80215b:	4c 89 ee             	mov    %r13,%rsi
+  80215e:	41 ff d6             	call   *%r14
+            break;
+  802161:	e9 bc fe ff ff       	jmp    802022 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  802166:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80216a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80216e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802172:	eb e5                	jmp    802159 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  802174:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802177:	83 f8 2f             	cmp    $0x2f,%eax
+  80217a:	77 5a                	ja     8021d6 <vprintfmt+0x1f4>
+  80217c:	89 c2                	mov    %eax,%edx
+  80217e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802182:	83 c0 08             	add    $0x8,%eax
+  802185:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  802188:	8b 02                	mov    (%rdx),%eax
+  80218a:	89 c1                	mov    %eax,%ecx
+  80218c:	f7 d9                	neg    %ecx
+  80218e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  802191:	83 f9 13             	cmp    $0x13,%ecx
+  802194:	7f 4e                	jg     8021e4 <vprintfmt+0x202>
+  802196:	48 63 c1             	movslq %ecx,%rax
+  802199:	48 ba e0 71 80 00 00 	movabs $0x8071e0,%rdx
+  8021a0:	00 00 00 
+  8021a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8021a7:	48 85 c0             	test   %rax,%rax
+  8021aa:	74 38                	je     8021e4 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  8021ac:	48 89 c1             	mov    %rax,%rcx
+  8021af:	48 ba 28 74 80 00 00 	movabs $0x807428,%rdx
+  8021b6:	00 00 00 
+  8021b9:	4c 89 ee             	mov    %r13,%rsi
+  8021bc:	4c 89 f7             	mov    %r14,%rdi
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c4:	49 b8 a5 1f 80 00 00 	movabs $0x801fa5,%r8
+  8021cb:	00 00 00 
+  8021ce:	41 ff d0             	call   *%r8
+  8021d1:	e9 4c fe ff ff       	jmp    802022 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  8021d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021e2:	eb a4                	jmp    802188 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  8021e4:	48 ba ac 6d 80 00 00 	movabs $0x806dac,%rdx
+  8021eb:	00 00 00 
+  8021ee:	4c 89 ee             	mov    %r13,%rsi
+  8021f1:	4c 89 f7             	mov    %r14,%rdi
+  8021f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f9:	49 b8 a5 1f 80 00 00 	movabs $0x801fa5,%r8
+  802200:	00 00 00 
+  802203:	41 ff d0             	call   *%r8
+  802206:	e9 17 fe ff ff       	jmp    802022 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  80220b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80220e:	83 f8 2f             	cmp    $0x2f,%eax
+  802211:	77 6c                	ja     80227f <vprintfmt+0x29d>
+  802213:	89 c2                	mov    %eax,%edx
+  802215:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802219:	83 c0 08             	add    $0x8,%eax
+  80221c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80221f:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  802222:	48 85 f6             	test   %rsi,%rsi
+  802225:	48 b8 a5 6d 80 00 00 	movabs $0x806da5,%rax
+  80222c:	00 00 00 
+  80222f:	48 0f 45 c6          	cmovne %rsi,%rax
+  802233:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  802237:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80223b:	7e 06                	jle    802243 <vprintfmt+0x261>
+  80223d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  802241:	75 4a                	jne    80228d <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  802243:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802247:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80224b:	0f b6 00             	movzbl (%rax),%eax
+  80224e:	84 c0                	test   %al,%al
+  802250:	0f 85 9a 00 00 00    	jne    8022f0 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  802256:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  802259:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	0f 8e bd fd ff ff    	jle    802022 <vprintfmt+0x40>
+  802265:	4c 89 ee             	mov    %r13,%rsi
+  802268:	bf 20 00 00 00       	mov    $0x20,%edi
+  80226d:	41 ff d6             	call   *%r14
+  802270:	41 83 ec 01          	sub    $0x1,%r12d
+  802274:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802278:	75 eb                	jne    802265 <vprintfmt+0x283>
+  80227a:	e9 a3 fd ff ff       	jmp    802022 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  80227f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802283:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802287:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228b:	eb 92                	jmp    80221f <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  80228d:	49 63 f7             	movslq %r15d,%rsi
+  802290:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  802294:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+  8022a0:	48 89 c2             	mov    %rax,%rdx
+  8022a3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8022a6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8022a8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8022ab:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	7e 91                	jle    802243 <vprintfmt+0x261>
+  8022b2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8022b7:	4c 89 ee             	mov    %r13,%rsi
+  8022ba:	44 89 e7             	mov    %r12d,%edi
+  8022bd:	41 ff d6             	call   *%r14
+  8022c0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8022c4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8022c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8022ca:	75 eb                	jne    8022b7 <vprintfmt+0x2d5>
+  8022cc:	e9 72 ff ff ff       	jmp    802243 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8022d1:	0f b6 f8             	movzbl %al,%edi
+  8022d4:	4c 89 ee             	mov    %r13,%rsi
+  8022d7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8022da:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8022de:	49 83 c4 01          	add    $0x1,%r12
+  8022e2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8022e8:	84 c0                	test   %al,%al
+  8022ea:	0f 84 66 ff ff ff    	je     802256 <vprintfmt+0x274>
+  8022f0:	45 85 ff             	test   %r15d,%r15d
+  8022f3:	78 0a                	js     8022ff <vprintfmt+0x31d>
+  8022f5:	41 83 ef 01          	sub    $0x1,%r15d
+  8022f9:	0f 88 57 ff ff ff    	js     802256 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8022ff:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  802303:	74 cc                	je     8022d1 <vprintfmt+0x2ef>
+  802305:	8d 50 e0             	lea    -0x20(%rax),%edx
+  802308:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80230d:	80 fa 5e             	cmp    $0x5e,%dl
+  802310:	77 c2                	ja     8022d4 <vprintfmt+0x2f2>
+  802312:	eb bd                	jmp    8022d1 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  802314:	40 84 f6             	test   %sil,%sil
+  802317:	75 26                	jne    80233f <vprintfmt+0x35d>
+    switch (lflag) {
+  802319:	85 d2                	test   %edx,%edx
+  80231b:	74 59                	je     802376 <vprintfmt+0x394>
+  80231d:	83 fa 01             	cmp    $0x1,%edx
+  802320:	74 7b                	je     80239d <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  802322:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802325:	83 f8 2f             	cmp    $0x2f,%eax
+  802328:	0f 87 96 00 00 00    	ja     8023c4 <vprintfmt+0x3e2>
+  80232e:	89 c2                	mov    %eax,%edx
+  802330:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802334:	83 c0 08             	add    $0x8,%eax
+  802337:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80233a:	4c 8b 22             	mov    (%rdx),%r12
+  80233d:	eb 17                	jmp    802356 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  80233f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802342:	83 f8 2f             	cmp    $0x2f,%eax
+  802345:	77 21                	ja     802368 <vprintfmt+0x386>
+  802347:	89 c2                	mov    %eax,%edx
+  802349:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80234d:	83 c0 08             	add    $0x8,%eax
+  802350:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802353:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  802356:	4d 85 e4             	test   %r12,%r12
+  802359:	78 7a                	js     8023d5 <vprintfmt+0x3f3>
+            num = i;
+  80235b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80235e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  802363:	e9 56 02 00 00       	jmp    8025be <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802368:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80236c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802370:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802374:	eb dd                	jmp    802353 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  802376:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802379:	83 f8 2f             	cmp    $0x2f,%eax
+  80237c:	77 11                	ja     80238f <vprintfmt+0x3ad>
+  80237e:	89 c2                	mov    %eax,%edx
+  802380:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802384:	83 c0 08             	add    $0x8,%eax
+  802387:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80238a:	4c 63 22             	movslq (%rdx),%r12
+  80238d:	eb c7                	jmp    802356 <vprintfmt+0x374>
+  80238f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802393:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802397:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80239b:	eb ed                	jmp    80238a <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  80239d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8023a3:	77 11                	ja     8023b6 <vprintfmt+0x3d4>
+  8023a5:	89 c2                	mov    %eax,%edx
+  8023a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8023ab:	83 c0 08             	add    $0x8,%eax
+  8023ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8023b1:	4c 8b 22             	mov    (%rdx),%r12
+  8023b4:	eb a0                	jmp    802356 <vprintfmt+0x374>
+  8023b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023c2:	eb ed                	jmp    8023b1 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  8023c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8023c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8023cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8023d0:	e9 65 ff ff ff       	jmp    80233a <vprintfmt+0x358>
+                putch('-', put_arg);
+  8023d5:	4c 89 ee             	mov    %r13,%rsi
+  8023d8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8023dd:	41 ff d6             	call   *%r14
+                i = -i;
+  8023e0:	49 f7 dc             	neg    %r12
+  8023e3:	e9 73 ff ff ff       	jmp    80235b <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  8023e8:	40 84 f6             	test   %sil,%sil
+  8023eb:	75 2e                	jne    80241b <vprintfmt+0x439>
+    switch (lflag) {
+  8023ed:	85 d2                	test   %edx,%edx
+  8023ef:	7f 59                	jg     80244a <vprintfmt+0x468>
+  8023f1:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8023f4:	7d 7a                	jge    802470 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  8023f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8023f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8023fc:	0f 87 aa 00 00 00    	ja     8024ac <vprintfmt+0x4ca>
+  802402:	89 c2                	mov    %eax,%edx
+  802404:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802408:	83 c0 08             	add    $0x8,%eax
+  80240b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80240e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802411:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  802416:	e9 a3 01 00 00       	jmp    8025be <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80241b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80241e:	83 f8 2f             	cmp    $0x2f,%eax
+  802421:	77 19                	ja     80243c <vprintfmt+0x45a>
+  802423:	89 c2                	mov    %eax,%edx
+  802425:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802429:	83 c0 08             	add    $0x8,%eax
+  80242c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80242f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802432:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802437:	e9 82 01 00 00       	jmp    8025be <vprintfmt+0x5dc>
+  80243c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802440:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802444:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802448:	eb e5                	jmp    80242f <vprintfmt+0x44d>
+    switch (lflag) {
+  80244a:	83 fa 01             	cmp    $0x1,%edx
+  80244d:	75 a7                	jne    8023f6 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  80244f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802452:	83 f8 2f             	cmp    $0x2f,%eax
+  802455:	77 47                	ja     80249e <vprintfmt+0x4bc>
+  802457:	89 c2                	mov    %eax,%edx
+  802459:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80245d:	83 c0 08             	add    $0x8,%eax
+  802460:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802463:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  802466:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80246b:	e9 4e 01 00 00       	jmp    8025be <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802470:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802473:	83 f8 2f             	cmp    $0x2f,%eax
+  802476:	77 18                	ja     802490 <vprintfmt+0x4ae>
+  802478:	89 c2                	mov    %eax,%edx
+  80247a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80247e:	83 c0 08             	add    $0x8,%eax
+  802481:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802484:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  802486:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80248b:	e9 2e 01 00 00       	jmp    8025be <vprintfmt+0x5dc>
+  802490:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802494:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802498:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80249c:	eb e6                	jmp    802484 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  80249e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024aa:	eb b7                	jmp    802463 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  8024ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8024b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8024b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8024b8:	e9 51 ff ff ff       	jmp    80240e <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  8024bd:	40 84 f6             	test   %sil,%sil
+  8024c0:	75 2e                	jne    8024f0 <vprintfmt+0x50e>
+    switch (lflag) {
+  8024c2:	85 d2                	test   %edx,%edx
+  8024c4:	7f 59                	jg     80251f <vprintfmt+0x53d>
+  8024c6:	83 fa fe             	cmp    $0xfffffffe,%edx
+  8024c9:	7d 77                	jge    802542 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  8024cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8024d1:	0f 87 a4 00 00 00    	ja     80257b <vprintfmt+0x599>
+  8024d7:	89 c2                	mov    %eax,%edx
+  8024d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024dd:	83 c0 08             	add    $0x8,%eax
+  8024e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8024e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8024e6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8024eb:	e9 ce 00 00 00       	jmp    8025be <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  8024f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8024f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8024f6:	77 19                	ja     802511 <vprintfmt+0x52f>
+  8024f8:	89 c2                	mov    %eax,%edx
+  8024fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8024fe:	83 c0 08             	add    $0x8,%eax
+  802501:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802504:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802507:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80250c:	e9 ad 00 00 00       	jmp    8025be <vprintfmt+0x5dc>
+  802511:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802515:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802519:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80251d:	eb e5                	jmp    802504 <vprintfmt+0x522>
+    switch (lflag) {
+  80251f:	83 fa 01             	cmp    $0x1,%edx
+  802522:	75 a7                	jne    8024cb <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802524:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802527:	83 f8 2f             	cmp    $0x2f,%eax
+  80252a:	77 41                	ja     80256d <vprintfmt+0x58b>
+  80252c:	89 c2                	mov    %eax,%edx
+  80252e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802532:	83 c0 08             	add    $0x8,%eax
+  802535:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802538:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80253b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802540:	eb 7c                	jmp    8025be <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802542:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802545:	83 f8 2f             	cmp    $0x2f,%eax
+  802548:	77 15                	ja     80255f <vprintfmt+0x57d>
+  80254a:	89 c2                	mov    %eax,%edx
+  80254c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802550:	83 c0 08             	add    $0x8,%eax
+  802553:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802556:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  802558:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80255d:	eb 5f                	jmp    8025be <vprintfmt+0x5dc>
+  80255f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802563:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802567:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80256b:	eb e9                	jmp    802556 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  80256d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802571:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802575:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802579:	eb bd                	jmp    802538 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  80257b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80257f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802583:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802587:	e9 57 ff ff ff       	jmp    8024e3 <vprintfmt+0x501>
+            putch('0', put_arg);
+  80258c:	4c 89 ee             	mov    %r13,%rsi
+  80258f:	bf 30 00 00 00       	mov    $0x30,%edi
+  802594:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  802597:	4c 89 ee             	mov    %r13,%rsi
+  80259a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80259f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8025a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8025a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8025a8:	77 47                	ja     8025f1 <vprintfmt+0x60f>
+  8025aa:	89 c2                	mov    %eax,%edx
+  8025ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8025b0:	83 c0 08             	add    $0x8,%eax
+  8025b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8025b6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8025b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8025be:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8025c6:	0f 94 c0             	sete   %al
+  8025c9:	0f b6 c0             	movzbl %al,%eax
+  8025cc:	50                   	push   %rax
+  8025cd:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8025d2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8025d6:	4c 89 ee             	mov    %r13,%rsi
+  8025d9:	4c 89 f7             	mov    %r14,%rdi
+  8025dc:	48 b8 d7 1e 80 00 00 	movabs $0x801ed7,%rax
+  8025e3:	00 00 00 
+  8025e6:	ff d0                	call   *%rax
+            break;
+  8025e8:	48 83 c4 10          	add    $0x10,%rsp
+  8025ec:	e9 31 fa ff ff       	jmp    802022 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  8025f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8025f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8025f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8025fd:	eb b7                	jmp    8025b6 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  8025ff:	40 84 f6             	test   %sil,%sil
+  802602:	75 2b                	jne    80262f <vprintfmt+0x64d>
+    switch (lflag) {
+  802604:	85 d2                	test   %edx,%edx
+  802606:	7f 56                	jg     80265e <vprintfmt+0x67c>
+  802608:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80260b:	7d 77                	jge    802684 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80260d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802610:	83 f8 2f             	cmp    $0x2f,%eax
+  802613:	0f 87 a7 00 00 00    	ja     8026c0 <vprintfmt+0x6de>
+  802619:	89 c2                	mov    %eax,%edx
+  80261b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80261f:	83 c0 08             	add    $0x8,%eax
+  802622:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802625:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802628:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80262d:	eb 8f                	jmp    8025be <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  80262f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802632:	83 f8 2f             	cmp    $0x2f,%eax
+  802635:	77 19                	ja     802650 <vprintfmt+0x66e>
+  802637:	89 c2                	mov    %eax,%edx
+  802639:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80263d:	83 c0 08             	add    $0x8,%eax
+  802640:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802643:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  802646:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80264b:	e9 6e ff ff ff       	jmp    8025be <vprintfmt+0x5dc>
+  802650:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802654:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  802658:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80265c:	eb e5                	jmp    802643 <vprintfmt+0x661>
+    switch (lflag) {
+  80265e:	83 fa 01             	cmp    $0x1,%edx
+  802661:	75 aa                	jne    80260d <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  802663:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802666:	83 f8 2f             	cmp    $0x2f,%eax
+  802669:	77 47                	ja     8026b2 <vprintfmt+0x6d0>
+  80266b:	89 c2                	mov    %eax,%edx
+  80266d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802671:	83 c0 08             	add    $0x8,%eax
+  802674:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802677:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80267a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  80267f:	e9 3a ff ff ff       	jmp    8025be <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802684:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802687:	83 f8 2f             	cmp    $0x2f,%eax
+  80268a:	77 18                	ja     8026a4 <vprintfmt+0x6c2>
+  80268c:	89 c2                	mov    %eax,%edx
+  80268e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802692:	83 c0 08             	add    $0x8,%eax
+  802695:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802698:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80269a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80269f:	e9 1a ff ff ff       	jmp    8025be <vprintfmt+0x5dc>
+  8026a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026b0:	eb e6                	jmp    802698 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8026b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026be:	eb b7                	jmp    802677 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  8026c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8026c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8026c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8026cc:	e9 54 ff ff ff       	jmp    802625 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  8026d1:	4c 89 ee             	mov    %r13,%rsi
+  8026d4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8026d9:	41 ff d6             	call   *%r14
+            break;
+  8026dc:	e9 41 f9 ff ff       	jmp    802022 <vprintfmt+0x40>
+            putch('%', put_arg);
+  8026e1:	4c 89 ee             	mov    %r13,%rsi
+  8026e4:	bf 25 00 00 00       	mov    $0x25,%edi
+  8026e9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  8026ec:	48 83 eb 01          	sub    $0x1,%rbx
+  8026f0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  8026f4:	75 f6                	jne    8026ec <vprintfmt+0x70a>
+  8026f6:	e9 27 f9 ff ff       	jmp    802022 <vprintfmt+0x40>
+
+00000000008026fb <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8026fb:	55                   	push   %rbp
+  8026fc:	48 89 e5             	mov    %rsp,%rbp
+  8026ff:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802703:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802707:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80270c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802710:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  802717:	48 85 ff             	test   %rdi,%rdi
+  80271a:	74 2b                	je     802747 <vsnprintf+0x4c>
+  80271c:	48 85 f6             	test   %rsi,%rsi
+  80271f:	74 26                	je     802747 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802721:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802725:	48 bf 8d 1f 80 00 00 	movabs $0x801f8d,%rdi
+  80272c:	00 00 00 
+  80272f:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80273b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80273f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802742:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  802747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80274c:	eb f7                	jmp    802745 <vsnprintf+0x4a>
+
+000000000080274e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	48 83 ec 50          	sub    $0x50,%rsp
+  802756:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80275a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80275e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  802762:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802769:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80276d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802771:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802775:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802779:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80277d:	48 b8 fb 26 80 00 00 	movabs $0x8026fb,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+
+000000000080278b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80278b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80278e:	74 10                	je     8027a0 <strlen+0x15>
+    size_t n = 0;
+  802790:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802795:	48 83 c0 01          	add    $0x1,%rax
+  802799:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  80279d:	75 f6                	jne    802795 <strlen+0xa>
+  80279f:	c3                   	ret
+    size_t n = 0;
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8027a5:	c3                   	ret
+
+00000000008027a6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8027a6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8027a9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8027ae:	48 85 f6             	test   %rsi,%rsi
+  8027b1:	74 11                	je     8027c4 <strnlen+0x1e>
+  8027b3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8027b7:	74 0c                	je     8027c5 <strnlen+0x1f>
+  8027b9:	48 83 c2 01          	add    $0x1,%rdx
+  8027bd:	48 39 d0             	cmp    %rdx,%rax
+  8027c0:	75 f1                	jne    8027b3 <strnlen+0xd>
+  8027c2:	eb 04                	jmp    8027c8 <strnlen+0x22>
+  8027c4:	c3                   	ret
+  8027c5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8027c8:	c3                   	ret
+
+00000000008027c9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8027c9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8027cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8027d5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8027d8:	48 83 c2 01          	add    $0x1,%rdx
+  8027dc:	84 c9                	test   %cl,%cl
+  8027de:	75 f1                	jne    8027d1 <strcpy+0x8>
+        ;
+    return res;
+}
+  8027e0:	c3                   	ret
+
+00000000008027e1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8027e1:	55                   	push   %rbp
+  8027e2:	48 89 e5             	mov    %rsp,%rbp
+  8027e5:	41 54                	push   %r12
+  8027e7:	53                   	push   %rbx
+  8027e8:	48 89 fb             	mov    %rdi,%rbx
+  8027eb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8027ee:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  8027f5:	00 00 00 
+  8027f8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8027fa:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8027fe:	4c 89 e6             	mov    %r12,%rsi
+  802801:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  802808:	00 00 00 
+  80280b:	ff d0                	call   *%rax
+    return dst;
+}
+  80280d:	48 89 d8             	mov    %rbx,%rax
+  802810:	5b                   	pop    %rbx
+  802811:	41 5c                	pop    %r12
+  802813:	5d                   	pop    %rbp
+  802814:	c3                   	ret
+
+0000000000802815 <toupper>:
+
+int
+toupper(int ch) {
+  802815:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  802817:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80281a:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80281d:	83 f9 1a             	cmp    $0x1a,%ecx
+  802820:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802823:	c3                   	ret
+
+0000000000802824 <tolower>:
+
+int
+tolower(int ch) {
+  802824:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  802826:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  802829:	8d 57 20             	lea    0x20(%rdi),%edx
+  80282c:	83 f9 1a             	cmp    $0x1a,%ecx
+  80282f:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802832:	c3                   	ret
+
+0000000000802833 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802833:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  802836:	48 85 d2             	test   %rdx,%rdx
+  802839:	74 1f                	je     80285a <strncpy+0x27>
+  80283b:	48 01 fa             	add    %rdi,%rdx
+  80283e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802841:	48 83 c1 01          	add    $0x1,%rcx
+  802845:	44 0f b6 06          	movzbl (%rsi),%r8d
+  802849:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80284d:	41 80 f8 01          	cmp    $0x1,%r8b
+  802851:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802855:	48 39 ca             	cmp    %rcx,%rdx
+  802858:	75 e7                	jne    802841 <strncpy+0xe>
+    }
+    return ret;
+}
+  80285a:	c3                   	ret
+
+000000000080285b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80285b:	48 89 f8             	mov    %rdi,%rax
+  80285e:	48 85 d2             	test   %rdx,%rdx
+  802861:	74 24                	je     802887 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  802863:	48 83 ea 01          	sub    $0x1,%rdx
+  802867:	74 1b                	je     802884 <strlcpy+0x29>
+  802869:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80286d:	0f b6 16             	movzbl (%rsi),%edx
+  802870:	84 d2                	test   %dl,%dl
+  802872:	74 10                	je     802884 <strlcpy+0x29>
+            *dst++ = *src++;
+  802874:	48 83 c6 01          	add    $0x1,%rsi
+  802878:	48 83 c0 01          	add    $0x1,%rax
+  80287c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80287f:	48 39 c8             	cmp    %rcx,%rax
+  802882:	75 e9                	jne    80286d <strlcpy+0x12>
+        *dst = '\0';
+  802884:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802887:	48 29 f8             	sub    %rdi,%rax
+}
+  80288a:	c3                   	ret
+
+000000000080288b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  80288b:	0f b6 07             	movzbl (%rdi),%eax
+  80288e:	84 c0                	test   %al,%al
+  802890:	74 13                	je     8028a5 <strcmp+0x1a>
+  802892:	38 06                	cmp    %al,(%rsi)
+  802894:	75 0f                	jne    8028a5 <strcmp+0x1a>
+  802896:	48 83 c7 01          	add    $0x1,%rdi
+  80289a:	48 83 c6 01          	add    $0x1,%rsi
+  80289e:	0f b6 07             	movzbl (%rdi),%eax
+  8028a1:	84 c0                	test   %al,%al
+  8028a3:	75 ed                	jne    802892 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8028a5:	0f b6 c0             	movzbl %al,%eax
+  8028a8:	0f b6 16             	movzbl (%rsi),%edx
+  8028ab:	29 d0                	sub    %edx,%eax
+}
+  8028ad:	c3                   	ret
+
+00000000008028ae <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8028ae:	48 85 d2             	test   %rdx,%rdx
+  8028b1:	74 1f                	je     8028d2 <strncmp+0x24>
+  8028b3:	0f b6 07             	movzbl (%rdi),%eax
+  8028b6:	84 c0                	test   %al,%al
+  8028b8:	74 1e                	je     8028d8 <strncmp+0x2a>
+  8028ba:	3a 06                	cmp    (%rsi),%al
+  8028bc:	75 1a                	jne    8028d8 <strncmp+0x2a>
+  8028be:	48 83 c7 01          	add    $0x1,%rdi
+  8028c2:	48 83 c6 01          	add    $0x1,%rsi
+  8028c6:	48 83 ea 01          	sub    $0x1,%rdx
+  8028ca:	75 e7                	jne    8028b3 <strncmp+0x5>
+
+    if (!n) return 0;
+  8028cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d1:	c3                   	ret
+  8028d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d7:	c3                   	ret
+  8028d8:	48 85 d2             	test   %rdx,%rdx
+  8028db:	74 09                	je     8028e6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8028dd:	0f b6 07             	movzbl (%rdi),%eax
+  8028e0:	0f b6 16             	movzbl (%rsi),%edx
+  8028e3:	29 d0                	sub    %edx,%eax
+  8028e5:	c3                   	ret
+    if (!n) return 0;
+  8028e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028eb:	c3                   	ret
+
+00000000008028ec <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8028ec:	0f b6 17             	movzbl (%rdi),%edx
+  8028ef:	84 d2                	test   %dl,%dl
+  8028f1:	74 18                	je     80290b <strchr+0x1f>
+        if (*str == c) {
+  8028f3:	0f be d2             	movsbl %dl,%edx
+  8028f6:	39 f2                	cmp    %esi,%edx
+  8028f8:	74 17                	je     802911 <strchr+0x25>
+    for (; *str; str++) {
+  8028fa:	48 83 c7 01          	add    $0x1,%rdi
+  8028fe:	0f b6 17             	movzbl (%rdi),%edx
+  802901:	84 d2                	test   %dl,%dl
+  802903:	75 ee                	jne    8028f3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	c3                   	ret
+  80290b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802910:	c3                   	ret
+  802911:	48 89 f8             	mov    %rdi,%rax
+}
+  802914:	c3                   	ret
+
+0000000000802915 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  802915:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  802918:	0f b6 17             	movzbl (%rdi),%edx
+  80291b:	84 d2                	test   %dl,%dl
+  80291d:	74 13                	je     802932 <strfind+0x1d>
+  80291f:	0f be d2             	movsbl %dl,%edx
+  802922:	39 f2                	cmp    %esi,%edx
+  802924:	74 0b                	je     802931 <strfind+0x1c>
+  802926:	48 83 c0 01          	add    $0x1,%rax
+  80292a:	0f b6 10             	movzbl (%rax),%edx
+  80292d:	84 d2                	test   %dl,%dl
+  80292f:	75 ee                	jne    80291f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802931:	c3                   	ret
+  802932:	c3                   	ret
+
+0000000000802933 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802933:	48 39 f7             	cmp    %rsi,%rdi
+  802936:	74 65                	je     80299d <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+  80293c:	41 57                	push   %r15
+  80293e:	41 56                	push   %r14
+  802940:	41 55                	push   %r13
+  802942:	41 54                	push   %r12
+  802944:	53                   	push   %rbx
+  802945:	48 83 ec 18          	sub    $0x18,%rsp
+  802949:	48 89 fb             	mov    %rdi,%rbx
+  80294c:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  80294f:	49 bf 24 28 80 00 00 	movabs $0x802824,%r15
+  802956:	00 00 00 
+  802959:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80295d:	41 0f b6 fd          	movzbl %r13b,%edi
+  802961:	41 ff d7             	call   *%r15
+  802964:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802967:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  80296c:	41 0f b6 fe          	movzbl %r14b,%edi
+  802970:	41 ff d7             	call   *%r15
+  802973:	89 c2                	mov    %eax,%edx
+  802975:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802978:	29 d0                	sub    %edx,%eax
+  80297a:	75 12                	jne    80298e <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  80297c:	48 83 c3 01          	add    $0x1,%rbx
+  802980:	45 84 ed             	test   %r13b,%r13b
+  802983:	74 09                	je     80298e <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802985:	49 83 c4 01          	add    $0x1,%r12
+  802989:	45 84 f6             	test   %r14b,%r14b
+  80298c:	75 cb                	jne    802959 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80298e:	48 83 c4 18          	add    $0x18,%rsp
+  802992:	5b                   	pop    %rbx
+  802993:	41 5c                	pop    %r12
+  802995:	41 5d                	pop    %r13
+  802997:	41 5e                	pop    %r14
+  802999:	41 5f                	pop    %r15
+  80299b:	5d                   	pop    %rbp
+  80299c:	c3                   	ret
+    if (p1 == p2) return 0;
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a2:	c3                   	ret
+
+00000000008029a3 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8029a3:	48 39 f7             	cmp    %rsi,%rdi
+  8029a6:	74 7d                	je     802a25 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	41 57                	push   %r15
+  8029ae:	41 56                	push   %r14
+  8029b0:	41 55                	push   %r13
+  8029b2:	41 54                	push   %r12
+  8029b4:	53                   	push   %rbx
+  8029b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8029b9:	48 89 fb             	mov    %rdi,%rbx
+  8029bc:	49 89 f4             	mov    %rsi,%r12
+  8029bf:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  8029c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8029c7:	49 bf 24 28 80 00 00 	movabs $0x802824,%r15
+  8029ce:	00 00 00 
+    while (n--) {
+  8029d1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8029d5:	48 39 c3             	cmp    %rax,%rbx
+  8029d8:	74 37                	je     802a11 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  8029da:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8029de:	41 0f b6 fd          	movzbl %r13b,%edi
+  8029e2:	41 ff d7             	call   *%r15
+  8029e5:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8029e8:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8029ed:	41 0f b6 fe          	movzbl %r14b,%edi
+  8029f1:	41 ff d7             	call   *%r15
+  8029f4:	89 c2                	mov    %eax,%edx
+  8029f6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8029f9:	29 d0                	sub    %edx,%eax
+  8029fb:	75 19                	jne    802a16 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8029fd:	48 83 c3 01          	add    $0x1,%rbx
+  802a01:	45 84 ed             	test   %r13b,%r13b
+  802a04:	74 10                	je     802a16 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  802a06:	49 83 c4 01          	add    $0x1,%r12
+  802a0a:	45 84 f6             	test   %r14b,%r14b
+  802a0d:	75 c2                	jne    8029d1 <strncasecmp+0x2e>
+  802a0f:	eb 05                	jmp    802a16 <strncasecmp+0x73>
+  802a11:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  802a16:	48 83 c4 18          	add    $0x18,%rsp
+  802a1a:	5b                   	pop    %rbx
+  802a1b:	41 5c                	pop    %r12
+  802a1d:	41 5d                	pop    %r13
+  802a1f:	41 5e                	pop    %r14
+  802a21:	41 5f                	pop    %r15
+  802a23:	5d                   	pop    %rbp
+  802a24:	c3                   	ret
+    if (p1 == p2) return 0;
+  802a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a2a:	c3                   	ret
+
+0000000000802a2b <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802a2b:	83 e7 df             	and    $0xffffffdf,%edi
+  802a2e:	83 ef 41             	sub    $0x41,%edi
+  802a31:	83 ff 19             	cmp    $0x19,%edi
+  802a34:	0f 96 c0             	setbe  %al
+}
+  802a37:	c3                   	ret
+
+0000000000802a38 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  802a38:	83 ff 20             	cmp    $0x20,%edi
+  802a3b:	0f 94 c0             	sete   %al
+  802a3e:	83 ff 09             	cmp    $0x9,%edi
+  802a41:	0f 94 c2             	sete   %dl
+  802a44:	09 d0                	or     %edx,%eax
+}
+  802a46:	c3                   	ret
+
+0000000000802a47 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  802a47:	55                   	push   %rbp
+  802a48:	48 89 e5             	mov    %rsp,%rbp
+  802a4b:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802a4d:	48 bf 9f 72 80 00 00 	movabs $0x80729f,%rdi
+  802a54:	00 00 00 
+  802a57:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+  802a63:	48 85 c0             	test   %rax,%rax
+  802a66:	0f 95 c0             	setne  %al
+}
+  802a69:	5d                   	pop    %rbp
+  802a6a:	c3                   	ret
+
+0000000000802a6b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802a6b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  802a6e:	48 89 f8             	mov    %rdi,%rax
+  802a71:	48 f7 d8             	neg    %rax
+  802a74:	83 e0 07             	and    $0x7,%eax
+  802a77:	49 89 d1             	mov    %rdx,%r9
+  802a7a:	49 29 c1             	sub    %rax,%r9
+  802a7d:	78 36                	js     802ab5 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  802a7f:	40 0f b6 c6          	movzbl %sil,%eax
+  802a83:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802a8a:	01 01 01 
+  802a8d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  802a91:	40 f6 c7 07          	test   $0x7,%dil
+  802a95:	75 38                	jne    802acf <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802a97:	4c 89 c9             	mov    %r9,%rcx
+  802a9a:	48 c1 f9 03          	sar    $0x3,%rcx
+  802a9e:	74 0c                	je     802aac <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  802aa0:	fc                   	cld
+  802aa1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802aa4:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802aa8:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802aac:	4d 85 c9             	test   %r9,%r9
+  802aaf:	75 45                	jne    802af6 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  802ab1:	4c 89 c0             	mov    %r8,%rax
+  802ab4:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802ab5:	48 85 d2             	test   %rdx,%rdx
+  802ab8:	74 f7                	je     802ab1 <memset+0x46>
+  802aba:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802abd:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802ac0:	48 83 c0 01          	add    $0x1,%rax
+  802ac4:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802ac8:	48 39 c2             	cmp    %rax,%rdx
+  802acb:	75 f3                	jne    802ac0 <memset+0x55>
+  802acd:	eb e2                	jmp    802ab1 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802acf:	40 f6 c7 01          	test   $0x1,%dil
+  802ad3:	74 06                	je     802adb <memset+0x70>
+  802ad5:	88 07                	mov    %al,(%rdi)
+  802ad7:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802adb:	40 f6 c7 02          	test   $0x2,%dil
+  802adf:	74 07                	je     802ae8 <memset+0x7d>
+  802ae1:	66 89 07             	mov    %ax,(%rdi)
+  802ae4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802ae8:	40 f6 c7 04          	test   $0x4,%dil
+  802aec:	74 a9                	je     802a97 <memset+0x2c>
+  802aee:	89 07                	mov    %eax,(%rdi)
+  802af0:	48 83 c7 04          	add    $0x4,%rdi
+  802af4:	eb a1                	jmp    802a97 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802af6:	41 f6 c1 04          	test   $0x4,%r9b
+  802afa:	74 06                	je     802b02 <memset+0x97>
+  802afc:	89 07                	mov    %eax,(%rdi)
+  802afe:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802b02:	41 f6 c1 02          	test   $0x2,%r9b
+  802b06:	74 07                	je     802b0f <memset+0xa4>
+  802b08:	66 89 07             	mov    %ax,(%rdi)
+  802b0b:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802b0f:	41 f6 c1 01          	test   $0x1,%r9b
+  802b13:	74 9c                	je     802ab1 <memset+0x46>
+  802b15:	88 07                	mov    %al,(%rdi)
+  802b17:	eb 98                	jmp    802ab1 <memset+0x46>
+
+0000000000802b19 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  802b19:	48 89 f8             	mov    %rdi,%rax
+  802b1c:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802b1f:	48 39 fe             	cmp    %rdi,%rsi
+  802b22:	73 3b                	jae    802b5f <memmove+0x46>
+  802b24:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  802b28:	48 39 d7             	cmp    %rdx,%rdi
+  802b2b:	73 32                	jae    802b5f <memmove+0x46>
+        s += n;
+        d += n;
+  802b2d:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802b31:	48 89 d6             	mov    %rdx,%rsi
+  802b34:	48 09 fe             	or     %rdi,%rsi
+  802b37:	48 09 ce             	or     %rcx,%rsi
+  802b3a:	40 f6 c6 07          	test   $0x7,%sil
+  802b3e:	75 12                	jne    802b52 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802b40:	48 83 ef 08          	sub    $0x8,%rdi
+  802b44:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  802b48:	48 c1 e9 03          	shr    $0x3,%rcx
+  802b4c:	fd                   	std
+  802b4d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802b50:	fc                   	cld
+  802b51:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802b52:	48 83 ef 01          	sub    $0x1,%rdi
+  802b56:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802b5a:	fd                   	std
+  802b5b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802b5d:	eb f1                	jmp    802b50 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802b5f:	48 89 f2             	mov    %rsi,%rdx
+  802b62:	48 09 c2             	or     %rax,%rdx
+  802b65:	48 09 ca             	or     %rcx,%rdx
+  802b68:	f6 c2 07             	test   $0x7,%dl
+  802b6b:	75 0c                	jne    802b79 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802b6d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802b71:	48 89 c7             	mov    %rax,%rdi
+  802b74:	fc                   	cld
+  802b75:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802b78:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802b79:	48 89 c7             	mov    %rax,%rdi
+  802b7c:	fc                   	cld
+  802b7d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  802b7f:	c3                   	ret
+
+0000000000802b80 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802b84:	48 b8 19 2b 80 00 00 	movabs $0x802b19,%rax
+  802b8b:	00 00 00 
+  802b8e:	ff d0                	call   *%rax
+}
+  802b90:	5d                   	pop    %rbp
+  802b91:	c3                   	ret
+
+0000000000802b92 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  802b92:	55                   	push   %rbp
+  802b93:	48 89 e5             	mov    %rsp,%rbp
+  802b96:	41 57                	push   %r15
+  802b98:	41 56                	push   %r14
+  802b9a:	41 55                	push   %r13
+  802b9c:	41 54                	push   %r12
+  802b9e:	53                   	push   %rbx
+  802b9f:	48 83 ec 08          	sub    $0x8,%rsp
+  802ba3:	49 89 fe             	mov    %rdi,%r14
+  802ba6:	49 89 f7             	mov    %rsi,%r15
+  802ba9:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802bac:	48 89 f7             	mov    %rsi,%rdi
+  802baf:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  802bb6:	00 00 00 
+  802bb9:	ff d0                	call   *%rax
+  802bbb:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802bbe:	48 89 de             	mov    %rbx,%rsi
+  802bc1:	4c 89 f7             	mov    %r14,%rdi
+  802bc4:	48 b8 a6 27 80 00 00 	movabs $0x8027a6,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+  802bd0:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802bd3:	48 39 c3             	cmp    %rax,%rbx
+  802bd6:	74 36                	je     802c0e <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802bd8:	48 89 d8             	mov    %rbx,%rax
+  802bdb:	4c 29 e8             	sub    %r13,%rax
+  802bde:	49 39 c4             	cmp    %rax,%r12
+  802be1:	73 31                	jae    802c14 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802be3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802be8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802bec:	4c 89 fe             	mov    %r15,%rsi
+  802bef:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802bfb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802bff:	48 83 c4 08          	add    $0x8,%rsp
+  802c03:	5b                   	pop    %rbx
+  802c04:	41 5c                	pop    %r12
+  802c06:	41 5d                	pop    %r13
+  802c08:	41 5e                	pop    %r14
+  802c0a:	41 5f                	pop    %r15
+  802c0c:	5d                   	pop    %rbp
+  802c0d:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802c0e:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802c12:	eb eb                	jmp    802bff <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802c14:	48 83 eb 01          	sub    $0x1,%rbx
+  802c18:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802c1c:	48 89 da             	mov    %rbx,%rdx
+  802c1f:	4c 89 fe             	mov    %r15,%rsi
+  802c22:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  802c29:	00 00 00 
+  802c2c:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802c2e:	49 01 de             	add    %rbx,%r14
+  802c31:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  802c36:	eb c3                	jmp    802bfb <strlcat+0x69>
+
+0000000000802c38 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  802c38:	48 85 d2             	test   %rdx,%rdx
+  802c3b:	74 2d                	je     802c6a <memcmp+0x32>
+  802c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802c42:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  802c46:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802c4b:	44 38 c1             	cmp    %r8b,%cl
+  802c4e:	75 0f                	jne    802c5f <memcmp+0x27>
+    while (n-- > 0) {
+  802c50:	48 83 c0 01          	add    $0x1,%rax
+  802c54:	48 39 c2             	cmp    %rax,%rdx
+  802c57:	75 e9                	jne    802c42 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802c59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  802c5f:	0f b6 c1             	movzbl %cl,%eax
+  802c62:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802c66:	44 29 c0             	sub    %r8d,%eax
+  802c69:	c3                   	ret
+    return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c6f:	c3                   	ret
+
+0000000000802c70 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  802c70:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802c74:	48 39 c7             	cmp    %rax,%rdi
+  802c77:	73 0f                	jae    802c88 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802c79:	40 38 37             	cmp    %sil,(%rdi)
+  802c7c:	74 0e                	je     802c8c <memfind+0x1c>
+    for (; src < end; src++) {
+  802c7e:	48 83 c7 01          	add    $0x1,%rdi
+  802c82:	48 39 f8             	cmp    %rdi,%rax
+  802c85:	75 f2                	jne    802c79 <memfind+0x9>
+  802c87:	c3                   	ret
+  802c88:	48 89 f8             	mov    %rdi,%rax
+  802c8b:	c3                   	ret
+  802c8c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  802c8f:	c3                   	ret
+
+0000000000802c90 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802c90:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  802c93:	0f b6 37             	movzbl (%rdi),%esi
+  802c96:	40 80 fe 20          	cmp    $0x20,%sil
+  802c9a:	74 06                	je     802ca2 <strtol+0x12>
+  802c9c:	40 80 fe 09          	cmp    $0x9,%sil
+  802ca0:	75 13                	jne    802cb5 <strtol+0x25>
+  802ca2:	48 83 c7 01          	add    $0x1,%rdi
+  802ca6:	0f b6 37             	movzbl (%rdi),%esi
+  802ca9:	40 80 fe 20          	cmp    $0x20,%sil
+  802cad:	74 f3                	je     802ca2 <strtol+0x12>
+  802caf:	40 80 fe 09          	cmp    $0x9,%sil
+  802cb3:	74 ed                	je     802ca2 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802cb5:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802cb8:	83 e0 fd             	and    $0xfffffffd,%eax
+  802cbb:	3c 01                	cmp    $0x1,%al
+  802cbd:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802cc1:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802cc7:	75 0f                	jne    802cd8 <strtol+0x48>
+  802cc9:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802ccc:	74 14                	je     802ce2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802cce:	85 d2                	test   %edx,%edx
+  802cd0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802cd5:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802cdd:	4c 63 ca             	movslq %edx,%r9
+  802ce0:	eb 36                	jmp    802d18 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802ce2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802ce6:	74 0f                	je     802cf7 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802ce8:	85 d2                	test   %edx,%edx
+  802cea:	75 ec                	jne    802cd8 <strtol+0x48>
+        s++;
+  802cec:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802cf0:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  802cf5:	eb e1                	jmp    802cd8 <strtol+0x48>
+        s += 2;
+  802cf7:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802cfb:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802d00:	eb d6                	jmp    802cd8 <strtol+0x48>
+            dig -= '0';
+  802d02:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  802d05:	44 0f b6 c1          	movzbl %cl,%r8d
+  802d09:	41 39 d0             	cmp    %edx,%r8d
+  802d0c:	7d 21                	jge    802d2f <strtol+0x9f>
+        val = val * base + dig;
+  802d0e:	49 0f af c1          	imul   %r9,%rax
+  802d12:	0f b6 c9             	movzbl %cl,%ecx
+  802d15:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  802d18:	48 83 c7 01          	add    $0x1,%rdi
+  802d1c:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802d20:	80 f9 39             	cmp    $0x39,%cl
+  802d23:	76 dd                	jbe    802d02 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  802d25:	80 f9 7b             	cmp    $0x7b,%cl
+  802d28:	77 05                	ja     802d2f <strtol+0x9f>
+            dig -= 'a' - 10;
+  802d2a:	83 e9 57             	sub    $0x57,%ecx
+  802d2d:	eb d6                	jmp    802d05 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802d2f:	4d 85 d2             	test   %r10,%r10
+  802d32:	74 03                	je     802d37 <strtol+0xa7>
+  802d34:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  802d37:	48 89 c2             	mov    %rax,%rdx
+  802d3a:	48 f7 da             	neg    %rdx
+  802d3d:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802d41:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  802d45:	c3                   	ret
+
+0000000000802d46 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  802d46:	55                   	push   %rbp
+  802d47:	48 89 e5             	mov    %rsp,%rbp
+  802d4a:	53                   	push   %rbx
+  802d4b:	48 89 fa             	mov    %rdi,%rdx
+  802d4e:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d51:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d60:	be 00 00 00 00       	mov    $0x0,%esi
+  802d65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d71:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  802d73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d77:	c9                   	leave
+  802d78:	c3                   	ret
+
+0000000000802d79 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802d79:	55                   	push   %rbp
+  802d7a:	48 89 e5             	mov    %rsp,%rbp
+  802d7d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d7e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d83:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d88:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d92:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d97:	be 00 00 00 00       	mov    $0x0,%esi
+  802d9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802da2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da8:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802daa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dae:	c9                   	leave
+  802daf:	c3                   	ret
+
+0000000000802db0 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  802db0:	55                   	push   %rbp
+  802db1:	48 89 e5             	mov    %rsp,%rbp
+  802db4:	53                   	push   %rbx
+  802db5:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802db8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dbd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802dcc:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dd7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ddd:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802ddf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802de3:	c9                   	leave
+  802de4:	c3                   	ret
+
+0000000000802de5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802de5:	55                   	push   %rbp
+  802de6:	48 89 e5             	mov    %rsp,%rbp
+  802de9:	53                   	push   %rbx
+  802dea:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802dee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802df1:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802df6:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e00:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e05:	be 00 00 00 00       	mov    $0x0,%esi
+  802e0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e16:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802e18:	48 85 c0             	test   %rax,%rax
+  802e1b:	7f 06                	jg     802e23 <sys_env_destroy+0x3e>
+}
+  802e1d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e21:	c9                   	leave
+  802e22:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802e23:	49 89 c0             	mov    %rax,%r8
+  802e26:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802e2b:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  802e32:	00 00 00 
+  802e35:	be 27 00 00 00       	mov    $0x27,%esi
+  802e3a:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  802e41:	00 00 00 
+  802e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e49:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  802e50:	00 00 00 
+  802e53:	41 ff d1             	call   *%r9
+
+0000000000802e56 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802e56:	55                   	push   %rbp
+  802e57:	48 89 e5             	mov    %rsp,%rbp
+  802e5a:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e5b:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e65:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e6f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e74:	be 00 00 00 00       	mov    $0x0,%esi
+  802e79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e85:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e87:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e8b:	c9                   	leave
+  802e8c:	c3                   	ret
+
+0000000000802e8d <sys_yield>:
+
+void
+sys_yield(void) {
+  802e8d:	55                   	push   %rbp
+  802e8e:	48 89 e5             	mov    %rsp,%rbp
+  802e91:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e92:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802eab:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eb6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ebc:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802ebe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ec2:	c9                   	leave
+  802ec3:	c3                   	ret
+
+0000000000802ec4 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802ec4:	55                   	push   %rbp
+  802ec5:	48 89 e5             	mov    %rsp,%rbp
+  802ec8:	53                   	push   %rbx
+  802ec9:	48 89 fa             	mov    %rdi,%rdx
+  802ecc:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802ecf:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802ed4:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802edb:	00 00 00 
+  802ede:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ee8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802eee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802ef4:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802ef6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802efa:	c9                   	leave
+  802efb:	c3                   	ret
+
+0000000000802efc <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802efc:	55                   	push   %rbp
+  802efd:	48 89 e5             	mov    %rsp,%rbp
+  802f00:	53                   	push   %rbx
+  802f01:	49 89 f8             	mov    %rdi,%r8
+  802f04:	48 89 d3             	mov    %rdx,%rbx
+  802f07:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802f0a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f0f:	4c 89 c2             	mov    %r8,%rdx
+  802f12:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f15:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f20:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f26:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802f28:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f2c:	c9                   	leave
+  802f2d:	c3                   	ret
+
+0000000000802f2e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	53                   	push   %rbx
+  802f33:	48 83 ec 08          	sub    $0x8,%rsp
+  802f37:	89 f8                	mov    %edi,%eax
+  802f39:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802f3c:	48 63 f9             	movslq %ecx,%rdi
+  802f3f:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f42:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f47:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f4a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802f55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802f5b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f5d:	48 85 c0             	test   %rax,%rax
+  802f60:	7f 06                	jg     802f68 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802f62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f66:	c9                   	leave
+  802f67:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f68:	49 89 c0             	mov    %rax,%r8
+  802f6b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802f70:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  802f77:	00 00 00 
+  802f7a:	be 27 00 00 00       	mov    $0x27,%esi
+  802f7f:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  802f86:	00 00 00 
+  802f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8e:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  802f95:	00 00 00 
+  802f98:	41 ff d1             	call   *%r9
+
+0000000000802f9b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802f9b:	55                   	push   %rbp
+  802f9c:	48 89 e5             	mov    %rsp,%rbp
+  802f9f:	53                   	push   %rbx
+  802fa0:	48 83 ec 08          	sub    $0x8,%rsp
+  802fa4:	89 f8                	mov    %edi,%eax
+  802fa6:	49 89 f2             	mov    %rsi,%r10
+  802fa9:	48 89 cf             	mov    %rcx,%rdi
+  802fac:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802faf:	48 63 da             	movslq %edx,%rbx
+  802fb2:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802fb5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802fba:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fbd:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802fc0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fc6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802fc8:	48 85 c0             	test   %rax,%rax
+  802fcb:	7f 06                	jg     802fd3 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802fcd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fd1:	c9                   	leave
+  802fd2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802fd3:	49 89 c0             	mov    %rax,%r8
+  802fd6:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802fdb:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  802fe2:	00 00 00 
+  802fe5:	be 27 00 00 00       	mov    $0x27,%esi
+  802fea:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  802ff1:	00 00 00 
+  802ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff9:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  803000:	00 00 00 
+  803003:	41 ff d1             	call   *%r9
+
+0000000000803006 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  803006:	55                   	push   %rbp
+  803007:	48 89 e5             	mov    %rsp,%rbp
+  80300a:	53                   	push   %rbx
+  80300b:	48 83 ec 08          	sub    $0x8,%rsp
+  80300f:	48 89 f1             	mov    %rsi,%rcx
+  803012:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  803015:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803018:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80301d:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803022:	be 00 00 00 00       	mov    $0x0,%esi
+  803027:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80302d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803033:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803035:	48 85 c0             	test   %rax,%rax
+  803038:	7f 06                	jg     803040 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80303a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80303e:	c9                   	leave
+  80303f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803040:	49 89 c0             	mov    %rax,%r8
+  803043:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803048:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  80304f:	00 00 00 
+  803052:	be 27 00 00 00       	mov    $0x27,%esi
+  803057:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  80305e:	00 00 00 
+  803061:	b8 00 00 00 00       	mov    $0x0,%eax
+  803066:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  80306d:	00 00 00 
+  803070:	41 ff d1             	call   *%r9
+
+0000000000803073 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  803073:	55                   	push   %rbp
+  803074:	48 89 e5             	mov    %rsp,%rbp
+  803077:	53                   	push   %rbx
+  803078:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  80307c:	48 63 ce             	movslq %esi,%rcx
+  80307f:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803082:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803087:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803091:	be 00 00 00 00       	mov    $0x0,%esi
+  803096:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80309c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030a2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8030a4:	48 85 c0             	test   %rax,%rax
+  8030a7:	7f 06                	jg     8030af <sys_env_set_status+0x3c>
+}
+  8030a9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030ad:	c9                   	leave
+  8030ae:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8030af:	49 89 c0             	mov    %rax,%r8
+  8030b2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8030b7:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  8030be:	00 00 00 
+  8030c1:	be 27 00 00 00       	mov    $0x27,%esi
+  8030c6:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  8030cd:	00 00 00 
+  8030d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d5:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  8030dc:	00 00 00 
+  8030df:	41 ff d1             	call   *%r9
+
+00000000008030e2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8030e2:	55                   	push   %rbp
+  8030e3:	48 89 e5             	mov    %rsp,%rbp
+  8030e6:	53                   	push   %rbx
+  8030e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8030eb:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  8030ee:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8030f1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030fb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803100:	be 00 00 00 00       	mov    $0x0,%esi
+  803105:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80310b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803111:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803113:	48 85 c0             	test   %rax,%rax
+  803116:	7f 06                	jg     80311e <sys_env_set_trapframe+0x3c>
+}
+  803118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80311c:	c9                   	leave
+  80311d:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80311e:	49 89 c0             	mov    %rax,%r8
+  803121:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  803126:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  80312d:	00 00 00 
+  803130:	be 27 00 00 00       	mov    $0x27,%esi
+  803135:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  80313c:	00 00 00 
+  80313f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803144:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  80314b:	00 00 00 
+  80314e:	41 ff d1             	call   *%r9
+
+0000000000803151 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  803151:	55                   	push   %rbp
+  803152:	48 89 e5             	mov    %rsp,%rbp
+  803155:	53                   	push   %rbx
+  803156:	48 83 ec 08          	sub    $0x8,%rsp
+  80315a:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  80315d:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803160:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803165:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80316a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80316f:	be 00 00 00 00       	mov    $0x0,%esi
+  803174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80317a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803180:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803182:	48 85 c0             	test   %rax,%rax
+  803185:	7f 06                	jg     80318d <sys_env_set_pgfault_upcall+0x3c>
+}
+  803187:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80318d:	49 89 c0             	mov    %rax,%r8
+  803190:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  803195:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  80319c:	00 00 00 
+  80319f:	be 27 00 00 00       	mov    $0x27,%esi
+  8031a4:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  8031ab:	00 00 00 
+  8031ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b3:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  8031ba:	00 00 00 
+  8031bd:	41 ff d1             	call   *%r9
+
+00000000008031c0 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  8031c0:	55                   	push   %rbp
+  8031c1:	48 89 e5             	mov    %rsp,%rbp
+  8031c4:	53                   	push   %rbx
+  8031c5:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  8031c9:	40 0f b6 ce          	movzbl %sil,%ecx
+  8031cd:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8031d0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8031d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031da:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8031df:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8031ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8031f0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8031f2:	48 85 c0             	test   %rax,%rax
+  8031f5:	7f 06                	jg     8031fd <sys_env_set_reclaim+0x3d>
+}
+  8031f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031fb:	c9                   	leave
+  8031fc:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8031fd:	49 89 c0             	mov    %rax,%r8
+  803200:	b9 16 00 00 00       	mov    $0x16,%ecx
+  803205:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  80320c:	00 00 00 
+  80320f:	be 27 00 00 00       	mov    $0x27,%esi
+  803214:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  80321b:	00 00 00 
+  80321e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803223:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  80322a:	00 00 00 
+  80322d:	41 ff d1             	call   *%r9
+
+0000000000803230 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	53                   	push   %rbx
+  803235:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  803239:	48 63 ce             	movslq %esi,%rcx
+  80323c:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80323f:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803249:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80324e:	be 00 00 00 00       	mov    $0x0,%esi
+  803253:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803259:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80325f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803261:	48 85 c0             	test   %rax,%rax
+  803264:	7f 06                	jg     80326c <sys_env_set_nice+0x3c>
+}
+  803266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80326a:	c9                   	leave
+  80326b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80326c:	49 89 c0             	mov    %rax,%r8
+  80326f:	b9 18 00 00 00       	mov    $0x18,%ecx
+  803274:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  80327b:	00 00 00 
+  80327e:	be 27 00 00 00       	mov    $0x27,%esi
+  803283:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  80328a:	00 00 00 
+  80328d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803292:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  803299:	00 00 00 
+  80329c:	41 ff d1             	call   *%r9
+
+000000000080329f <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  80329f:	55                   	push   %rbp
+  8032a0:	48 89 e5             	mov    %rsp,%rbp
+  8032a3:	53                   	push   %rbx
+  8032a4:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032a7:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8032b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b6:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8032c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032cc:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  8032ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032d2:	c9                   	leave
+  8032d3:	c3                   	ret
+
+00000000008032d4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	53                   	push   %rbx
+  8032d9:	89 f8                	mov    %edi,%eax
+  8032db:	49 89 f1             	mov    %rsi,%r9
+  8032de:	48 89 d3             	mov    %rdx,%rbx
+  8032e1:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  8032e4:	49 63 f0             	movslq %r8d,%rsi
+  8032e7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8032ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8032ef:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8032f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8032f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8032fe:	cd 30                	int    $0x30
+}
+  803300:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803304:	c9                   	leave
+  803305:	c3                   	ret
+
+0000000000803306 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  803306:	55                   	push   %rbp
+  803307:	48 89 e5             	mov    %rsp,%rbp
+  80330a:	53                   	push   %rbx
+  80330b:	89 f8                	mov    %edi,%eax
+  80330d:	49 89 f1             	mov    %rsi,%r9
+  803310:	48 89 d3             	mov    %rdx,%rbx
+  803313:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  803316:	49 63 f0             	movslq %r8d,%rsi
+  803319:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80331c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803321:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80332a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803330:	cd 30                	int    $0x30
+}
+  803332:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803336:	c9                   	leave
+  803337:	c3                   	ret
+
+0000000000803338 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  803338:	55                   	push   %rbp
+  803339:	48 89 e5             	mov    %rsp,%rbp
+  80333c:	53                   	push   %rbx
+  80333d:	48 83 ec 08          	sub    $0x8,%rsp
+  803341:	89 f8                	mov    %edi,%eax
+  803343:	49 89 f2             	mov    %rsi,%r10
+  803346:	48 89 d3             	mov    %rdx,%rbx
+  803349:	48 89 cf             	mov    %rcx,%rdi
+  80334c:	44 89 c6             	mov    %r8d,%esi
+  80334f:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803352:	48 63 f6             	movslq %esi,%rsi
+  803355:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803358:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80335d:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803360:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  803364:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  803366:	48 85 c0             	test   %rax,%rax
+  803369:	7f 06                	jg     803371 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80336b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80336f:	c9                   	leave
+  803370:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803371:	49 89 c0             	mov    %rax,%r8
+  803374:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  803379:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  803380:	00 00 00 
+  803383:	be 27 00 00 00       	mov    $0x27,%esi
+  803388:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  80338f:	00 00 00 
+  803392:	b8 00 00 00 00       	mov    $0x0,%eax
+  803397:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  80339e:	00 00 00 
+  8033a1:	41 ff d1             	call   *%r9
+
+00000000008033a4 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  8033a4:	55                   	push   %rbp
+  8033a5:	48 89 e5             	mov    %rsp,%rbp
+  8033a8:	53                   	push   %rbx
+  8033a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ad:	48 89 f1             	mov    %rsi,%rcx
+  8033b0:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  8033b3:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  8033b7:	48 8b 1a             	mov    (%rdx),%rbx
+  8033ba:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8033bd:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8033c2:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8033c6:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  8033ca:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  8033ce:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8033d0:	48 85 c0             	test   %rax,%rax
+  8033d3:	7f 06                	jg     8033db <sys_ipc_call_short+0x37>
+}
+  8033d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8033db:	49 89 c0             	mov    %rax,%r8
+  8033de:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8033e3:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  8033ea:	00 00 00 
+  8033ed:	be 27 00 00 00       	mov    $0x27,%esi
+  8033f2:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  8033f9:	00 00 00 
+  8033fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803401:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  803408:	00 00 00 
+  80340b:	41 ff d1             	call   *%r9
+
+000000000080340e <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  80340e:	55                   	push   %rbp
+  80340f:	48 89 e5             	mov    %rsp,%rbp
+  803412:	53                   	push   %rbx
+  803413:	48 83 ec 08          	sub    $0x8,%rsp
+  803417:	89 f8                	mov    %edi,%eax
+  803419:	49 89 f2             	mov    %rsi,%r10
+  80341c:	48 89 d3             	mov    %rdx,%rbx
+  80341f:	48 89 cf             	mov    %rcx,%rdi
+  803422:	44 89 c6             	mov    %r8d,%esi
+  803425:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  803428:	48 63 f6             	movslq %esi,%rsi
+  80342b:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80342e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803433:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  803436:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  80343a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80343c:	48 85 c0             	test   %rax,%rax
+  80343f:	7f 06                	jg     803447 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  803441:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  803447:	49 89 c0             	mov    %rax,%r8
+  80344a:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80344f:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  803456:	00 00 00 
+  803459:	be 27 00 00 00       	mov    $0x27,%esi
+  80345e:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  803465:	00 00 00 
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  803474:	00 00 00 
+  803477:	41 ff d1             	call   *%r9
+
+000000000080347a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  80347a:	55                   	push   %rbp
+  80347b:	48 89 e5             	mov    %rsp,%rbp
+  80347e:	53                   	push   %rbx
+  80347f:	48 83 ec 08          	sub    $0x8,%rsp
+  803483:	48 89 fa             	mov    %rdi,%rdx
+  803486:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  803489:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80348e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803493:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803498:	be 00 00 00 00       	mov    $0x0,%esi
+  80349d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8034a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8034a9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8034ab:	48 85 c0             	test   %rax,%rax
+  8034ae:	7f 06                	jg     8034b6 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8034b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034b4:	c9                   	leave
+  8034b5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8034b6:	49 89 c0             	mov    %rax,%r8
+  8034b9:	b9 12 00 00 00       	mov    $0x12,%ecx
+  8034be:	48 ba a8 72 80 00 00 	movabs $0x8072a8,%rdx
+  8034c5:	00 00 00 
+  8034c8:	be 27 00 00 00       	mov    $0x27,%esi
+  8034cd:	48 bf c7 72 80 00 00 	movabs $0x8072c7,%rdi
+  8034d4:	00 00 00 
+  8034d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034dc:	49 b9 42 1d 80 00 00 	movabs $0x801d42,%r9
+  8034e3:	00 00 00 
+  8034e6:	41 ff d1             	call   *%r9
+
+00000000008034e9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8034e9:	55                   	push   %rbp
+  8034ea:	48 89 e5             	mov    %rsp,%rbp
+  8034ed:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8034ee:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8034f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8034fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803502:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803507:	be 00 00 00 00       	mov    $0x0,%esi
+  80350c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803512:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803518:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80351a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+
+0000000000803520 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	53                   	push   %rbx
+  803525:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  803528:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80352d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803532:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803537:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80353c:	be 00 00 00 00       	mov    $0x0,%esi
+  803541:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803547:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80354d:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  80354f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803553:	c9                   	leave
+  803554:	c3                   	ret
+
+0000000000803555 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  803555:	55                   	push   %rbp
+  803556:	48 89 e5             	mov    %rsp,%rbp
+  803559:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80355a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80355f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803564:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803569:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803573:	be 00 00 00 00       	mov    $0x0,%esi
+  803578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80357e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803584:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  803586:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80358a:	c9                   	leave
+  80358b:	c3                   	ret
+
+000000000080358c <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80358c:	55                   	push   %rbp
+  80358d:	48 89 e5             	mov    %rsp,%rbp
+  803590:	53                   	push   %rbx
+  803591:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("int %2"
+  803595:	b8 08 00 00 00       	mov    $0x8,%eax
+  80359a:	cd 30                	int    $0x30
+  80359c:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	0f 88 85 00 00 00    	js     80362b <fork+0x9f>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  8035a6:	0f 84 ac 00 00 00    	je     803658 <fork+0xcc>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    if ((res = sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS,
+  8035ac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8035b2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8035b9:	00 00 00 
+  8035bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035c1:	89 c2                	mov    %eax,%edx
+  8035c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8035c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035cd:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  8035d4:	00 00 00 
+  8035d7:	ff d0                	call   *%rax
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	0f 88 a8 00 00 00    	js     803689 <fork+0xfd>
+                              PROT_ALL | PROT_LAZY | PROT_COMBINE)) < 0) {
+        panic("sys_map_region: %i", res);
+    }
+
+    if ((res = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0) {
+  8035e1:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  8035e8:	00 00 00 
+  8035eb:	48 8b b0 70 01 00 00 	mov    0x170(%rax),%rsi
+  8035f2:	89 df                	mov    %ebx,%edi
+  8035f4:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  8035fb:	00 00 00 
+  8035fe:	ff d0                	call   *%rax
+  803600:	85 c0                	test   %eax,%eax
+  803602:	0f 88 ae 00 00 00    	js     8036b6 <fork+0x12a>
+        panic("sys_env_set_pgfault_upcall: %i", res);
+    }
+
+    /* Start the child environment running */
+    if ((res = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  803608:	be 02 00 00 00       	mov    $0x2,%esi
+  80360d:	89 df                	mov    %ebx,%edi
+  80360f:	48 b8 73 30 80 00 00 	movabs $0x803073,%rax
+  803616:	00 00 00 
+  803619:	ff d0                	call   *%rax
+  80361b:	85 c0                	test   %eax,%eax
+  80361d:	0f 88 c0 00 00 00    	js     8036e3 <fork+0x157>
+        panic("sys_env_set_status: %i", res);
+
+    return envid;
+}
+  803623:	89 d8                	mov    %ebx,%eax
+  803625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803629:	c9                   	leave
+  80362a:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  80362b:	89 c1                	mov    %eax,%ecx
+  80362d:	48 ba d5 72 80 00 00 	movabs $0x8072d5,%rdx
+  803634:	00 00 00 
+  803637:	be 20 00 00 00       	mov    $0x20,%esi
+  80363c:	48 bf e5 72 80 00 00 	movabs $0x8072e5,%rdi
+  803643:	00 00 00 
+  803646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364b:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  803652:	00 00 00 
+  803655:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  803658:	48 b8 56 2e 80 00 00 	movabs $0x802e56,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+  803664:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803669:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  803670:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  803677:	00 00 00 
+  80367a:	48 01 d0             	add    %rdx,%rax
+  80367d:	48 a3 20 90 80 01 00 	movabs %rax,0x1809020
+  803684:	00 00 00 
+        return 0;
+  803687:	eb 9a                	jmp    803623 <fork+0x97>
+        panic("sys_map_region: %i", res);
+  803689:	89 c1                	mov    %eax,%ecx
+  80368b:	48 ba f0 72 80 00 00 	movabs $0x8072f0,%rdx
+  803692:	00 00 00 
+  803695:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80369a:	48 bf e5 72 80 00 00 	movabs $0x8072e5,%rdi
+  8036a1:	00 00 00 
+  8036a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a9:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8036b0:	00 00 00 
+  8036b3:	41 ff d0             	call   *%r8
+        panic("sys_env_set_pgfault_upcall: %i", res);
+  8036b6:	89 c1                	mov    %eax,%ecx
+  8036b8:	48 ba 38 73 80 00 00 	movabs $0x807338,%rdx
+  8036bf:	00 00 00 
+  8036c2:	be 32 00 00 00       	mov    $0x32,%esi
+  8036c7:	48 bf e5 72 80 00 00 	movabs $0x8072e5,%rdi
+  8036ce:	00 00 00 
+  8036d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d6:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8036dd:	00 00 00 
+  8036e0:	41 ff d0             	call   *%r8
+        panic("sys_env_set_status: %i", res);
+  8036e3:	89 c1                	mov    %eax,%ecx
+  8036e5:	48 ba 03 73 80 00 00 	movabs $0x807303,%rdx
+  8036ec:	00 00 00 
+  8036ef:	be 37 00 00 00       	mov    $0x37,%esi
+  8036f4:	48 bf e5 72 80 00 00 	movabs $0x8072e5,%rdi
+  8036fb:	00 00 00 
+  8036fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803703:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  80370a:	00 00 00 
+  80370d:	41 ff d0             	call   *%r8
+
+0000000000803710 <sfork>:
+
+envid_t
+sfork() {
+  803710:	55                   	push   %rbp
+  803711:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  803714:	48 ba 1a 73 80 00 00 	movabs $0x80731a,%rdx
+  80371b:	00 00 00 
+  80371e:	be 3e 00 00 00       	mov    $0x3e,%esi
+  803723:	48 bf e5 72 80 00 00 	movabs $0x8072e5,%rdi
+  80372a:	00 00 00 
+  80372d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803732:	48 b9 42 1d 80 00 00 	movabs $0x801d42,%rcx
+  803739:	00 00 00 
+  80373c:	ff d1                	call   *%rcx
+
+000000000080373e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80373e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803745:	ff ff ff 
+  803748:	48 01 f8             	add    %rdi,%rax
+  80374b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80374f:	c3                   	ret
+
+0000000000803750 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  803750:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  803757:	ff ff ff 
+  80375a:	48 01 f8             	add    %rdi,%rax
+  80375d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  803761:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  803767:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80376b:	c3                   	ret
+
+000000000080376c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80376c:	55                   	push   %rbp
+  80376d:	48 89 e5             	mov    %rsp,%rbp
+  803770:	41 57                	push   %r15
+  803772:	41 56                	push   %r14
+  803774:	41 55                	push   %r13
+  803776:	41 54                	push   %r12
+  803778:	53                   	push   %rbx
+  803779:	48 83 ec 08          	sub    $0x8,%rsp
+  80377d:	49 89 ff             	mov    %rdi,%r15
+  803780:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803785:	49 bd 00 56 80 00 00 	movabs $0x805600,%r13
+  80378c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80378f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803795:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  803798:	48 89 df             	mov    %rbx,%rdi
+  80379b:	41 ff d5             	call   *%r13
+  80379e:	83 e0 04             	and    $0x4,%eax
+  8037a1:	74 17                	je     8037ba <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8037a3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8037aa:	4c 39 f3             	cmp    %r14,%rbx
+  8037ad:	75 e6                	jne    803795 <fd_alloc+0x29>
+  8037af:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8037b5:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8037ba:	4d 89 27             	mov    %r12,(%r15)
+}
+  8037bd:	48 83 c4 08          	add    $0x8,%rsp
+  8037c1:	5b                   	pop    %rbx
+  8037c2:	41 5c                	pop    %r12
+  8037c4:	41 5d                	pop    %r13
+  8037c6:	41 5e                	pop    %r14
+  8037c8:	41 5f                	pop    %r15
+  8037ca:	5d                   	pop    %rbp
+  8037cb:	c3                   	ret
+
+00000000008037cc <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8037cc:	83 ff 1f             	cmp    $0x1f,%edi
+  8037cf:	77 39                	ja     80380a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8037d1:	55                   	push   %rbp
+  8037d2:	48 89 e5             	mov    %rsp,%rbp
+  8037d5:	41 54                	push   %r12
+  8037d7:	53                   	push   %rbx
+  8037d8:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8037db:	48 63 df             	movslq %edi,%rbx
+  8037de:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8037e5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8037e9:	48 89 df             	mov    %rbx,%rdi
+  8037ec:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8037f3:	00 00 00 
+  8037f6:	ff d0                	call   *%rax
+  8037f8:	a8 04                	test   $0x4,%al
+  8037fa:	74 14                	je     803810 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8037fc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803800:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803805:	5b                   	pop    %rbx
+  803806:	41 5c                	pop    %r12
+  803808:	5d                   	pop    %rbp
+  803809:	c3                   	ret
+        return -E_INVAL;
+  80380a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80380f:	c3                   	ret
+        return -E_INVAL;
+  803810:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803815:	eb ee                	jmp    803805 <fd_lookup+0x39>
+
+0000000000803817 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803817:	55                   	push   %rbp
+  803818:	48 89 e5             	mov    %rsp,%rbp
+  80381b:	41 54                	push   %r12
+  80381d:	53                   	push   %rbx
+  80381e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  803821:	48 b8 e0 73 80 00 00 	movabs $0x8073e0,%rax
+  803828:	00 00 00 
+  80382b:	48 bb 80 80 80 00 00 	movabs $0x808080,%rbx
+  803832:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  803835:	39 3b                	cmp    %edi,(%rbx)
+  803837:	74 47                	je     803880 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  803839:	48 83 c0 08          	add    $0x8,%rax
+  80383d:	48 8b 18             	mov    (%rax),%rbx
+  803840:	48 85 db             	test   %rbx,%rbx
+  803843:	75 f0                	jne    803835 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803845:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80384c:	00 00 00 
+  80384f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803855:	89 fa                	mov    %edi,%edx
+  803857:	48 bf 58 73 80 00 00 	movabs $0x807358,%rdi
+  80385e:	00 00 00 
+  803861:	b8 00 00 00 00       	mov    $0x0,%eax
+  803866:	48 b9 92 1e 80 00 00 	movabs $0x801e92,%rcx
+  80386d:	00 00 00 
+  803870:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803872:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  803877:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80387b:	5b                   	pop    %rbx
+  80387c:	41 5c                	pop    %r12
+  80387e:	5d                   	pop    %rbp
+  80387f:	c3                   	ret
+            return 0;
+  803880:	b8 00 00 00 00       	mov    $0x0,%eax
+  803885:	eb f0                	jmp    803877 <dev_lookup+0x60>
+
+0000000000803887 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  803887:	55                   	push   %rbp
+  803888:	48 89 e5             	mov    %rsp,%rbp
+  80388b:	41 55                	push   %r13
+  80388d:	41 54                	push   %r12
+  80388f:	53                   	push   %rbx
+  803890:	48 83 ec 18          	sub    $0x18,%rsp
+  803894:	48 89 fb             	mov    %rdi,%rbx
+  803897:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80389a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8038a1:	ff ff ff 
+  8038a4:	48 01 df             	add    %rbx,%rdi
+  8038a7:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8038ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8038af:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  8038b6:	00 00 00 
+  8038b9:	ff d0                	call   *%rax
+  8038bb:	41 89 c5             	mov    %eax,%r13d
+  8038be:	85 c0                	test   %eax,%eax
+  8038c0:	78 06                	js     8038c8 <fd_close+0x41>
+  8038c2:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8038c6:	74 1a                	je     8038e2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8038c8:	45 84 e4             	test   %r12b,%r12b
+  8038cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d0:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8038d4:	44 89 e8             	mov    %r13d,%eax
+  8038d7:	48 83 c4 18          	add    $0x18,%rsp
+  8038db:	5b                   	pop    %rbx
+  8038dc:	41 5c                	pop    %r12
+  8038de:	41 5d                	pop    %r13
+  8038e0:	5d                   	pop    %rbp
+  8038e1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8038e2:	8b 3b                	mov    (%rbx),%edi
+  8038e4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8038e8:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  8038ef:	00 00 00 
+  8038f2:	ff d0                	call   *%rax
+  8038f4:	41 89 c5             	mov    %eax,%r13d
+  8038f7:	85 c0                	test   %eax,%eax
+  8038f9:	78 1b                	js     803916 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8038fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ff:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803903:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803909:	48 85 c0             	test   %rax,%rax
+  80390c:	74 08                	je     803916 <fd_close+0x8f>
+  80390e:	48 89 df             	mov    %rbx,%rdi
+  803911:	ff d0                	call   *%rax
+  803913:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803916:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80391b:	48 89 de             	mov    %rbx,%rsi
+  80391e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803923:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  80392a:	00 00 00 
+  80392d:	ff d0                	call   *%rax
+    return res;
+  80392f:	eb a3                	jmp    8038d4 <fd_close+0x4d>
+
+0000000000803931 <close>:
+
+int
+close(int fdnum) {
+  803931:	55                   	push   %rbp
+  803932:	48 89 e5             	mov    %rsp,%rbp
+  803935:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803939:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80393d:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803944:	00 00 00 
+  803947:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803949:	85 c0                	test   %eax,%eax
+  80394b:	78 15                	js     803962 <close+0x31>
+
+    return fd_close(fd, 1);
+  80394d:	be 01 00 00 00       	mov    $0x1,%esi
+  803952:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803956:	48 b8 87 38 80 00 00 	movabs $0x803887,%rax
+  80395d:	00 00 00 
+  803960:	ff d0                	call   *%rax
+}
+  803962:	c9                   	leave
+  803963:	c3                   	ret
+
+0000000000803964 <close_all>:
+
+void
+close_all(void) {
+  803964:	55                   	push   %rbp
+  803965:	48 89 e5             	mov    %rsp,%rbp
+  803968:	41 54                	push   %r12
+  80396a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80396b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803970:	49 bc 31 39 80 00 00 	movabs $0x803931,%r12
+  803977:	00 00 00 
+  80397a:	89 df                	mov    %ebx,%edi
+  80397c:	41 ff d4             	call   *%r12
+  80397f:	83 c3 01             	add    $0x1,%ebx
+  803982:	83 fb 20             	cmp    $0x20,%ebx
+  803985:	75 f3                	jne    80397a <close_all+0x16>
+}
+  803987:	5b                   	pop    %rbx
+  803988:	41 5c                	pop    %r12
+  80398a:	5d                   	pop    %rbp
+  80398b:	c3                   	ret
+
+000000000080398c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80398c:	55                   	push   %rbp
+  80398d:	48 89 e5             	mov    %rsp,%rbp
+  803990:	41 57                	push   %r15
+  803992:	41 56                	push   %r14
+  803994:	41 55                	push   %r13
+  803996:	41 54                	push   %r12
+  803998:	53                   	push   %rbx
+  803999:	48 83 ec 18          	sub    $0x18,%rsp
+  80399d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8039a0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8039a4:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+  8039b0:	89 c3                	mov    %eax,%ebx
+  8039b2:	85 c0                	test   %eax,%eax
+  8039b4:	0f 88 b8 00 00 00    	js     803a72 <dup+0xe6>
+    close(newfdnum);
+  8039ba:	44 89 e7             	mov    %r12d,%edi
+  8039bd:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8039c9:	4d 63 ec             	movslq %r12d,%r13
+  8039cc:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8039d3:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8039d7:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8039db:	4c 89 ff             	mov    %r15,%rdi
+  8039de:	49 be 50 37 80 00 00 	movabs $0x803750,%r14
+  8039e5:	00 00 00 
+  8039e8:	41 ff d6             	call   *%r14
+  8039eb:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8039ee:	4c 89 ef             	mov    %r13,%rdi
+  8039f1:	41 ff d6             	call   *%r14
+  8039f4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8039f7:	48 89 df             	mov    %rbx,%rdi
+  8039fa:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  803a01:	00 00 00 
+  803a04:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803a06:	a8 04                	test   $0x4,%al
+  803a08:	74 2b                	je     803a35 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803a0a:	41 89 c1             	mov    %eax,%r9d
+  803a0d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a13:	4c 89 f1             	mov    %r14,%rcx
+  803a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a1b:	48 89 de             	mov    %rbx,%rsi
+  803a1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a23:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  803a2a:	00 00 00 
+  803a2d:	ff d0                	call   *%rax
+  803a2f:	89 c3                	mov    %eax,%ebx
+  803a31:	85 c0                	test   %eax,%eax
+  803a33:	78 4e                	js     803a83 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  803a35:	4c 89 ff             	mov    %r15,%rdi
+  803a38:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  803a3f:	00 00 00 
+  803a42:	ff d0                	call   *%rax
+  803a44:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803a47:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a4d:	4c 89 e9             	mov    %r13,%rcx
+  803a50:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a55:	4c 89 fe             	mov    %r15,%rsi
+  803a58:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a5d:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+  803a69:	89 c3                	mov    %eax,%ebx
+  803a6b:	85 c0                	test   %eax,%eax
+  803a6d:	78 14                	js     803a83 <dup+0xf7>
+
+    return newfdnum;
+  803a6f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803a72:	89 d8                	mov    %ebx,%eax
+  803a74:	48 83 c4 18          	add    $0x18,%rsp
+  803a78:	5b                   	pop    %rbx
+  803a79:	41 5c                	pop    %r12
+  803a7b:	41 5d                	pop    %r13
+  803a7d:	41 5e                	pop    %r14
+  803a7f:	41 5f                	pop    %r15
+  803a81:	5d                   	pop    %rbp
+  803a82:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803a83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a88:	4c 89 ee             	mov    %r13,%rsi
+  803a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a90:	49 bc 06 30 80 00 00 	movabs $0x803006,%r12
+  803a97:	00 00 00 
+  803a9a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803a9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa2:	4c 89 f6             	mov    %r14,%rsi
+  803aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aaa:	41 ff d4             	call   *%r12
+    return res;
+  803aad:	eb c3                	jmp    803a72 <dup+0xe6>
+
+0000000000803aaf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803aaf:	55                   	push   %rbp
+  803ab0:	48 89 e5             	mov    %rsp,%rbp
+  803ab3:	41 56                	push   %r14
+  803ab5:	41 55                	push   %r13
+  803ab7:	41 54                	push   %r12
+  803ab9:	53                   	push   %rbx
+  803aba:	48 83 ec 10          	sub    $0x10,%rsp
+  803abe:	89 fb                	mov    %edi,%ebx
+  803ac0:	49 89 f4             	mov    %rsi,%r12
+  803ac3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ac6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803aca:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803ad1:	00 00 00 
+  803ad4:	ff d0                	call   *%rax
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	78 4c                	js     803b26 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803ada:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803ade:	41 8b 3e             	mov    (%r14),%edi
+  803ae1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803ae5:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803aec:	00 00 00 
+  803aef:	ff d0                	call   *%rax
+  803af1:	85 c0                	test   %eax,%eax
+  803af3:	78 35                	js     803b2a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803af5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  803af9:	83 e0 03             	and    $0x3,%eax
+  803afc:	83 f8 01             	cmp    $0x1,%eax
+  803aff:	74 2d                	je     803b2e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803b01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b05:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803b09:	48 85 c0             	test   %rax,%rax
+  803b0c:	74 56                	je     803b64 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803b0e:	4c 89 ea             	mov    %r13,%rdx
+  803b11:	4c 89 e6             	mov    %r12,%rsi
+  803b14:	4c 89 f7             	mov    %r14,%rdi
+  803b17:	ff d0                	call   *%rax
+}
+  803b19:	48 83 c4 10          	add    $0x10,%rsp
+  803b1d:	5b                   	pop    %rbx
+  803b1e:	41 5c                	pop    %r12
+  803b20:	41 5d                	pop    %r13
+  803b22:	41 5e                	pop    %r14
+  803b24:	5d                   	pop    %rbp
+  803b25:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b26:	48 98                	cltq
+  803b28:	eb ef                	jmp    803b19 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803b2a:	48 98                	cltq
+  803b2c:	eb eb                	jmp    803b19 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b2e:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803b35:	00 00 00 
+  803b38:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803b3e:	89 da                	mov    %ebx,%edx
+  803b40:	48 bf 99 73 80 00 00 	movabs $0x807399,%rdi
+  803b47:	00 00 00 
+  803b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4f:	48 b9 92 1e 80 00 00 	movabs $0x801e92,%rcx
+  803b56:	00 00 00 
+  803b59:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803b5b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b62:	eb b5                	jmp    803b19 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803b64:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803b6b:	eb ac                	jmp    803b19 <read+0x6a>
+
+0000000000803b6d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803b6d:	55                   	push   %rbp
+  803b6e:	48 89 e5             	mov    %rsp,%rbp
+  803b71:	41 57                	push   %r15
+  803b73:	41 56                	push   %r14
+  803b75:	41 55                	push   %r13
+  803b77:	41 54                	push   %r12
+  803b79:	53                   	push   %rbx
+  803b7a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803b7e:	48 85 d2             	test   %rdx,%rdx
+  803b81:	74 54                	je     803bd7 <readn+0x6a>
+  803b83:	41 89 fd             	mov    %edi,%r13d
+  803b86:	49 89 f6             	mov    %rsi,%r14
+  803b89:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803b8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803b91:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803b96:	49 bf af 3a 80 00 00 	movabs $0x803aaf,%r15
+  803b9d:	00 00 00 
+  803ba0:	4c 89 e2             	mov    %r12,%rdx
+  803ba3:	48 29 f2             	sub    %rsi,%rdx
+  803ba6:	4c 01 f6             	add    %r14,%rsi
+  803ba9:	44 89 ef             	mov    %r13d,%edi
+  803bac:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	78 20                	js     803bd3 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803bb3:	01 c3                	add    %eax,%ebx
+  803bb5:	85 c0                	test   %eax,%eax
+  803bb7:	74 08                	je     803bc1 <readn+0x54>
+  803bb9:	48 63 f3             	movslq %ebx,%rsi
+  803bbc:	4c 39 e6             	cmp    %r12,%rsi
+  803bbf:	72 df                	jb     803ba0 <readn+0x33>
+    }
+    return res;
+  803bc1:	48 63 c3             	movslq %ebx,%rax
+}
+  803bc4:	48 83 c4 08          	add    $0x8,%rsp
+  803bc8:	5b                   	pop    %rbx
+  803bc9:	41 5c                	pop    %r12
+  803bcb:	41 5d                	pop    %r13
+  803bcd:	41 5e                	pop    %r14
+  803bcf:	41 5f                	pop    %r15
+  803bd1:	5d                   	pop    %rbp
+  803bd2:	c3                   	ret
+        if (inc < 0) return inc;
+  803bd3:	48 98                	cltq
+  803bd5:	eb ed                	jmp    803bc4 <readn+0x57>
+    int inc = 1, res = 0;
+  803bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bdc:	eb e3                	jmp    803bc1 <readn+0x54>
+
+0000000000803bde <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803bde:	55                   	push   %rbp
+  803bdf:	48 89 e5             	mov    %rsp,%rbp
+  803be2:	41 56                	push   %r14
+  803be4:	41 55                	push   %r13
+  803be6:	41 54                	push   %r12
+  803be8:	53                   	push   %rbx
+  803be9:	48 83 ec 10          	sub    $0x10,%rsp
+  803bed:	89 fb                	mov    %edi,%ebx
+  803bef:	49 89 f4             	mov    %rsi,%r12
+  803bf2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803bf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803bf9:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+  803c05:	85 c0                	test   %eax,%eax
+  803c07:	78 47                	js     803c50 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803c09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803c0d:	41 8b 3e             	mov    (%r14),%edi
+  803c10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803c14:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803c1b:	00 00 00 
+  803c1e:	ff d0                	call   *%rax
+  803c20:	85 c0                	test   %eax,%eax
+  803c22:	78 30                	js     803c54 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c24:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803c29:	74 2d                	je     803c58 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803c2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c2f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803c33:	48 85 c0             	test   %rax,%rax
+  803c36:	74 56                	je     803c8e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803c38:	4c 89 ea             	mov    %r13,%rdx
+  803c3b:	4c 89 e6             	mov    %r12,%rsi
+  803c3e:	4c 89 f7             	mov    %r14,%rdi
+  803c41:	ff d0                	call   *%rax
+}
+  803c43:	48 83 c4 10          	add    $0x10,%rsp
+  803c47:	5b                   	pop    %rbx
+  803c48:	41 5c                	pop    %r12
+  803c4a:	41 5d                	pop    %r13
+  803c4c:	41 5e                	pop    %r14
+  803c4e:	5d                   	pop    %rbp
+  803c4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803c50:	48 98                	cltq
+  803c52:	eb ef                	jmp    803c43 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803c54:	48 98                	cltq
+  803c56:	eb eb                	jmp    803c43 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c58:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803c5f:	00 00 00 
+  803c62:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803c68:	89 da                	mov    %ebx,%edx
+  803c6a:	48 bf b5 73 80 00 00 	movabs $0x8073b5,%rdi
+  803c71:	00 00 00 
+  803c74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c79:	48 b9 92 1e 80 00 00 	movabs $0x801e92,%rcx
+  803c80:	00 00 00 
+  803c83:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803c85:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c8c:	eb b5                	jmp    803c43 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803c8e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803c95:	eb ac                	jmp    803c43 <write+0x65>
+
+0000000000803c97 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803c97:	55                   	push   %rbp
+  803c98:	48 89 e5             	mov    %rsp,%rbp
+  803c9b:	53                   	push   %rbx
+  803c9c:	48 83 ec 18          	sub    $0x18,%rsp
+  803ca0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ca2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803ca6:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803cad:	00 00 00 
+  803cb0:	ff d0                	call   *%rax
+  803cb2:	85 c0                	test   %eax,%eax
+  803cb4:	78 0c                	js     803cc2 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803cb6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cba:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cc6:	c9                   	leave
+  803cc7:	c3                   	ret
+
+0000000000803cc8 <tell>:
+
+int tell(int fdnum) {
+  803cc8:	55                   	push   %rbp
+  803cc9:	48 89 e5             	mov    %rsp,%rbp
+  803ccc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803cd0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cd4:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803cdb:	00 00 00 
+  803cde:	ff d0                	call   *%rax
+  803ce0:	85 c0                	test   %eax,%eax
+  803ce2:	78 07                	js     803ceb <tell+0x23>
+
+    return fd->fd_offset;
+  803ce4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ce8:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  803ceb:	c9                   	leave
+  803cec:	c3                   	ret
+
+0000000000803ced <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803ced:	55                   	push   %rbp
+  803cee:	48 89 e5             	mov    %rsp,%rbp
+  803cf1:	41 55                	push   %r13
+  803cf3:	41 54                	push   %r12
+  803cf5:	53                   	push   %rbx
+  803cf6:	48 83 ec 18          	sub    $0x18,%rsp
+  803cfa:	89 fb                	mov    %edi,%ebx
+  803cfc:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803cff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803d03:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803d0a:	00 00 00 
+  803d0d:	ff d0                	call   *%rax
+  803d0f:	85 c0                	test   %eax,%eax
+  803d11:	78 38                	js     803d4b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803d13:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803d17:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803d1b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803d1f:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803d26:	00 00 00 
+  803d29:	ff d0                	call   *%rax
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	78 1c                	js     803d4b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803d2f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  803d34:	74 20                	je     803d56 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803d36:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d3a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803d3e:	48 85 c0             	test   %rax,%rax
+  803d41:	74 47                	je     803d8a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  803d43:	44 89 e6             	mov    %r12d,%esi
+  803d46:	4c 89 ef             	mov    %r13,%rdi
+  803d49:	ff d0                	call   *%rax
+}
+  803d4b:	48 83 c4 18          	add    $0x18,%rsp
+  803d4f:	5b                   	pop    %rbx
+  803d50:	41 5c                	pop    %r12
+  803d52:	41 5d                	pop    %r13
+  803d54:	5d                   	pop    %rbp
+  803d55:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803d56:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  803d5d:	00 00 00 
+  803d60:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803d66:	89 da                	mov    %ebx,%edx
+  803d68:	48 bf 78 73 80 00 00 	movabs $0x807378,%rdi
+  803d6f:	00 00 00 
+  803d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d77:	48 b9 92 1e 80 00 00 	movabs $0x801e92,%rcx
+  803d7e:	00 00 00 
+  803d81:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803d83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d88:	eb c1                	jmp    803d4b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803d8a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803d8f:	eb ba                	jmp    803d4b <ftruncate+0x5e>
+
+0000000000803d91 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d91:	55                   	push   %rbp
+  803d92:	48 89 e5             	mov    %rsp,%rbp
+  803d95:	41 54                	push   %r12
+  803d97:	53                   	push   %rbx
+  803d98:	48 83 ec 10          	sub    $0x10,%rsp
+  803d9c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803d9f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803da3:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  803daa:	00 00 00 
+  803dad:	ff d0                	call   *%rax
+  803daf:	85 c0                	test   %eax,%eax
+  803db1:	78 63                	js     803e16 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803db3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  803db7:	41 8b 3c 24          	mov    (%r12),%edi
+  803dbb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803dbf:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+  803dcb:	85 c0                	test   %eax,%eax
+  803dcd:	78 47                	js     803e16 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803dcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dd3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  803dd8:	74 45                	je     803e1f <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  803dda:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803ddd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803de4:	00 00 00 
+    stat->st_isdir = 0;
+  803de7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803dee:	00 00 00 
+    stat->st_ino = 0;
+  803df1:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  803df8:	00 00 00 00 
+    stat->st_version = 0;
+  803dfc:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803e03:	00 00 00 
+    stat->st_dev = dev;
+  803e06:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803e0d:	48 89 de             	mov    %rbx,%rsi
+  803e10:	4c 89 e7             	mov    %r12,%rdi
+  803e13:	ff 50 28             	call   *0x28(%rax)
+}
+  803e16:	48 83 c4 10          	add    $0x10,%rsp
+  803e1a:	5b                   	pop    %rbx
+  803e1b:	41 5c                	pop    %r12
+  803e1d:	5d                   	pop    %rbp
+  803e1e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803e1f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e24:	eb f0                	jmp    803e16 <fstat+0x85>
+
+0000000000803e26 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803e26:	55                   	push   %rbp
+  803e27:	48 89 e5             	mov    %rsp,%rbp
+  803e2a:	41 54                	push   %r12
+  803e2c:	53                   	push   %rbx
+  803e2d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  803e30:	be 00 00 00 00       	mov    $0x0,%esi
+  803e35:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  803e3c:	00 00 00 
+  803e3f:	ff d0                	call   *%rax
+  803e41:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  803e43:	85 c0                	test   %eax,%eax
+  803e45:	78 25                	js     803e6c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803e47:	4c 89 e6             	mov    %r12,%rsi
+  803e4a:	89 c7                	mov    %eax,%edi
+  803e4c:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+  803e58:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803e5b:	89 df                	mov    %ebx,%edi
+  803e5d:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  803e64:	00 00 00 
+  803e67:	ff d0                	call   *%rax
+
+    return res;
+  803e69:	44 89 e3             	mov    %r12d,%ebx
+}
+  803e6c:	89 d8                	mov    %ebx,%eax
+  803e6e:	5b                   	pop    %rbx
+  803e6f:	41 5c                	pop    %r12
+  803e71:	5d                   	pop    %rbp
+  803e72:	c3                   	ret
+
+0000000000803e73 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e73:	48 b8 00 b0 80 01 00 	movabs $0x180b000,%rax
+  803e7a:	00 00 00 
+  803e7d:	83 38 00             	cmpl   $0x0,(%rax)
+  803e80:	74 0a                	je     803e8c <fsipc_env+0x19>
+    return fsenv;
+}
+  803e82:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803e89:	00 00 
+  803e8b:	c3                   	ret
+fsipc_env(void) {
+  803e8c:	55                   	push   %rbp
+  803e8d:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e90:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e95:	48 b8 4d 66 80 00 00 	movabs $0x80664d,%rax
+  803e9c:	00 00 00 
+  803e9f:	ff d0                	call   *%rax
+  803ea1:	a3 00 b0 80 01 00 00 	movabs %eax,0x180b000
+  803ea8:	00 00 
+}
+  803eaa:	a1 00 b0 80 01 00 00 	movabs 0x180b000,%eax
+  803eb1:	00 00 
+  803eb3:	5d                   	pop    %rbp
+  803eb4:	c3                   	ret
+
+0000000000803eb5 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803eb5:	55                   	push   %rbp
+  803eb6:	48 89 e5             	mov    %rsp,%rbp
+  803eb9:	53                   	push   %rbx
+  803eba:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803ebe:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803ec5:	00 
+  803ec6:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803ecd:	00 
+  803ece:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803ed5:	00 
+  803ed6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803edd:	00 
+  803ede:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803ee5:	00 
+
+    assert(size <= sizeof(words));
+  803ee6:	48 83 fa 28          	cmp    $0x28,%rdx
+  803eea:	77 38                	ja     803f24 <fsipc_short+0x6f>
+  803eec:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803eee:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803ef2:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  803ef9:	00 00 00 
+  803efc:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803efe:	48 b8 73 3e 80 00 00 	movabs $0x803e73,%rax
+  803f05:	00 00 00 
+  803f08:	ff d0                	call   *%rax
+  803f0a:	89 c7                	mov    %eax,%edi
+  803f0c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803f10:	89 de                	mov    %ebx,%esi
+  803f12:	48 b8 b0 65 80 00 00 	movabs $0x8065b0,%rax
+  803f19:	00 00 00 
+  803f1c:	ff d0                	call   *%rax
+}
+  803f1e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f22:	c9                   	leave
+  803f23:	c3                   	ret
+    assert(size <= sizeof(words));
+  803f24:	48 b9 00 74 80 00 00 	movabs $0x807400,%rcx
+  803f2b:	00 00 00 
+  803f2e:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  803f35:	00 00 00 
+  803f38:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803f3d:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  803f44:	00 00 00 
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4c:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  803f53:	00 00 00 
+  803f56:	41 ff d0             	call   *%r8
+
+0000000000803f59 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803f59:	55                   	push   %rbp
+  803f5a:	48 89 e5             	mov    %rsp,%rbp
+  803f5d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  803f61:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803f64:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803f67:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803f6a:	ba 08 00 00 00       	mov    $0x8,%edx
+  803f6f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f73:	bf 02 00 00 00       	mov    $0x2,%edi
+  803f78:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  803f7f:	00 00 00 
+  803f82:	ff d0                	call   *%rax
+}
+  803f84:	c9                   	leave
+  803f85:	c3                   	ret
+
+0000000000803f86 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803f86:	55                   	push   %rbp
+  803f87:	48 89 e5             	mov    %rsp,%rbp
+  803f8a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803f8e:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803f91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803f94:	ba 04 00 00 00       	mov    $0x4,%edx
+  803f99:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803f9d:	bf 06 00 00 00       	mov    $0x6,%edi
+  803fa2:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  803fa9:	00 00 00 
+  803fac:	ff d0                	call   *%rax
+}
+  803fae:	c9                   	leave
+  803faf:	c3                   	ret
+
+0000000000803fb0 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803fb0:	55                   	push   %rbp
+  803fb1:	48 89 e5             	mov    %rsp,%rbp
+  803fb4:	41 54                	push   %r12
+  803fb6:	53                   	push   %rbx
+  803fb7:	48 83 ec 10          	sub    $0x10,%rsp
+  803fbb:	89 fb                	mov    %edi,%ebx
+  803fbd:	49 89 f4             	mov    %rsi,%r12
+  803fc0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803fc4:	48 b8 73 3e 80 00 00 	movabs $0x803e73,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+  803fd0:	89 c7                	mov    %eax,%edi
+  803fd2:	6a 00                	push   $0x0
+  803fd4:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  803fd8:	50                   	push   %rax
+  803fd9:	4d 89 e1             	mov    %r12,%r9
+  803fdc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803fe2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803fe7:	48 ba 00 a0 80 01 00 	movabs $0x180a000,%rdx
+  803fee:	00 00 00 
+  803ff1:	89 de                	mov    %ebx,%esi
+  803ff3:	48 b8 4b 65 80 00 00 	movabs $0x80654b,%rax
+  803ffa:	00 00 00 
+  803ffd:	ff d0                	call   *%rax
+}
+  803fff:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  804003:	5b                   	pop    %rbx
+  804004:	41 5c                	pop    %r12
+  804006:	5d                   	pop    %rbp
+  804007:	c3                   	ret
+
+0000000000804008 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804008:	55                   	push   %rbp
+  804009:	48 89 e5             	mov    %rsp,%rbp
+  80400c:	41 54                	push   %r12
+  80400e:	53                   	push   %rbx
+  80400f:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804012:	8b 47 0c             	mov    0xc(%rdi),%eax
+  804015:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80401c:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80401e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804023:	be 00 00 00 00       	mov    $0x0,%esi
+  804028:	bf 05 00 00 00       	mov    $0x5,%edi
+  80402d:	48 b8 b0 3f 80 00 00 	movabs $0x803fb0,%rax
+  804034:	00 00 00 
+  804037:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804039:	85 c0                	test   %eax,%eax
+  80403b:	78 5a                	js     804097 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80403d:	49 bc 00 a0 80 01 00 	movabs $0x180a000,%r12
+  804044:	00 00 00 
+  804047:	4c 89 e6             	mov    %r12,%rsi
+  80404a:	48 89 df             	mov    %rbx,%rdi
+  80404d:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  804054:	00 00 00 
+  804057:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  804059:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  804060:	00 
+  804061:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804067:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80406e:	00 
+  80406f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  804075:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  80407c:	00 
+  80407d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  804084:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  80408b:	00 
+  80408c:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  804092:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804097:	5b                   	pop    %rbx
+  804098:	41 5c                	pop    %r12
+  80409a:	5d                   	pop    %rbp
+  80409b:	c3                   	ret
+
+000000000080409c <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 57                	push   %r15
+  8040a2:	41 56                	push   %r14
+  8040a4:	41 55                	push   %r13
+  8040a6:	41 54                	push   %r12
+  8040a8:	53                   	push   %rbx
+  8040a9:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8040ad:	48 85 ff             	test   %rdi,%rdi
+  8040b0:	0f 84 a1 00 00 00    	je     804157 <devfile_read+0xbb>
+  8040b6:	49 89 ff             	mov    %rdi,%r15
+  8040b9:	49 89 f5             	mov    %rsi,%r13
+  8040bc:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8040bf:	48 85 f6             	test   %rsi,%rsi
+  8040c2:	0f 84 c4 00 00 00    	je     80418c <devfile_read+0xf0>
+    size_t total_read = 0;
+  8040c8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8040cf:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8040d0:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  8040d7:	00 00 00 
+  8040da:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8040de:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8040e1:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8040e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8040ef:	bf 03 00 00 00       	mov    $0x3,%edi
+  8040f4:	48 b8 b0 3f 80 00 00 	movabs $0x803fb0,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+        if (res < 0) {
+  804100:	85 c0                	test   %eax,%eax
+  804102:	0f 88 b9 00 00 00    	js     8041c1 <devfile_read+0x125>
+        assert(res <= n);
+  804108:	48 63 d8             	movslq %eax,%rbx
+  80410b:	49 39 dc             	cmp    %rbx,%r12
+  80410e:	0f 82 b1 00 00 00    	jb     8041c5 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  804114:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  804119:	0f 87 db 00 00 00    	ja     8041fa <devfile_read+0x15e>
+        if (!res) {
+  80411f:	85 c0                	test   %eax,%eax
+  804121:	74 21                	je     804144 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804123:	48 89 da             	mov    %rbx,%rdx
+  804126:	4c 89 f6             	mov    %r14,%rsi
+  804129:	4c 89 ef             	mov    %r13,%rdi
+  80412c:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  804133:	00 00 00 
+  804136:	ff d0                	call   *%rax
+        total_read += res;
+  804138:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  80413c:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  80413f:	49 29 dc             	sub    %rbx,%r12
+  804142:	75 96                	jne    8040da <devfile_read+0x3e>
+    return total_read;
+  804144:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  804148:	48 83 c4 18          	add    $0x18,%rsp
+  80414c:	5b                   	pop    %rbx
+  80414d:	41 5c                	pop    %r12
+  80414f:	41 5d                	pop    %r13
+  804151:	41 5e                	pop    %r14
+  804153:	41 5f                	pop    %r15
+  804155:	5d                   	pop    %rbp
+  804156:	c3                   	ret
+    assert(fd);
+  804157:	48 b9 36 74 80 00 00 	movabs $0x807436,%rcx
+  80415e:	00 00 00 
+  804161:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  804168:	00 00 00 
+  80416b:	be 91 00 00 00       	mov    $0x91,%esi
+  804170:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  804177:	00 00 00 
+  80417a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417f:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  804186:	00 00 00 
+  804189:	41 ff d0             	call   *%r8
+    assert(buf);
+  80418c:	48 b9 39 74 80 00 00 	movabs $0x807439,%rcx
+  804193:	00 00 00 
+  804196:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  80419d:	00 00 00 
+  8041a0:	be 92 00 00 00       	mov    $0x92,%esi
+  8041a5:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  8041ac:	00 00 00 
+  8041af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b4:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8041bb:	00 00 00 
+  8041be:	41 ff d0             	call   *%r8
+            return res;
+  8041c1:	48 98                	cltq
+  8041c3:	eb 83                	jmp    804148 <devfile_read+0xac>
+        assert(res <= n);
+  8041c5:	48 b9 3d 74 80 00 00 	movabs $0x80743d,%rcx
+  8041cc:	00 00 00 
+  8041cf:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  8041d6:	00 00 00 
+  8041d9:	be 9e 00 00 00       	mov    $0x9e,%esi
+  8041de:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  8041e5:	00 00 00 
+  8041e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ed:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8041f4:	00 00 00 
+  8041f7:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8041fa:	48 b9 48 74 80 00 00 	movabs $0x807448,%rcx
+  804201:	00 00 00 
+  804204:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  80420b:	00 00 00 
+  80420e:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804213:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  80421a:	00 00 00 
+  80421d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804222:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  804229:	00 00 00 
+  80422c:	41 ff d0             	call   *%r8
+
+000000000080422f <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80422f:	55                   	push   %rbp
+  804230:	48 89 e5             	mov    %rsp,%rbp
+  804233:	41 57                	push   %r15
+  804235:	41 56                	push   %r14
+  804237:	41 55                	push   %r13
+  804239:	41 54                	push   %r12
+  80423b:	53                   	push   %rbx
+  80423c:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  804240:	48 85 ff             	test   %rdi,%rdi
+  804243:	0f 84 83 00 00 00    	je     8042cc <devfile_write+0x9d>
+  804249:	49 89 ff             	mov    %rdi,%r15
+  80424c:	49 89 f4             	mov    %rsi,%r12
+  80424f:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  804252:	48 85 f6             	test   %rsi,%rsi
+  804255:	0f 84 a6 00 00 00    	je     804301 <devfile_write+0xd2>
+    size_t total_written = 0;
+  80425b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804261:	49 be 00 a0 80 01 00 	movabs $0x180a000,%r14
+  804268:	00 00 00 
+  80426b:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  80426f:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  804272:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  804276:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  80427b:	48 39 d3             	cmp    %rdx,%rbx
+  80427e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  804282:	4c 89 e6             	mov    %r12,%rsi
+  804285:	48 bf 10 a0 80 01 00 	movabs $0x180a010,%rdi
+  80428c:	00 00 00 
+  80428f:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  804296:	00 00 00 
+  804299:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  80429b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8042a5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8042aa:	48 b8 b0 3f 80 00 00 	movabs $0x803fb0,%rax
+  8042b1:	00 00 00 
+  8042b4:	ff d0                	call   *%rax
+        if (res < 0) {
+  8042b6:	85 c0                	test   %eax,%eax
+  8042b8:	78 7c                	js     804336 <devfile_write+0x107>
+        total_written += res;
+  8042ba:	48 98                	cltq
+  8042bc:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8042bf:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8042c2:	48 29 c3             	sub    %rax,%rbx
+  8042c5:	75 a4                	jne    80426b <devfile_write+0x3c>
+    return total_written;
+  8042c7:	4c 89 e8             	mov    %r13,%rax
+  8042ca:	eb 6c                	jmp    804338 <devfile_write+0x109>
+    assert(fd);
+  8042cc:	48 b9 36 74 80 00 00 	movabs $0x807436,%rcx
+  8042d3:	00 00 00 
+  8042d6:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  8042dd:	00 00 00 
+  8042e0:	be bd 00 00 00       	mov    $0xbd,%esi
+  8042e5:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  8042ec:	00 00 00 
+  8042ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f4:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8042fb:	00 00 00 
+  8042fe:	41 ff d0             	call   *%r8
+    assert(buf);
+  804301:	48 b9 39 74 80 00 00 	movabs $0x807439,%rcx
+  804308:	00 00 00 
+  80430b:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  804312:	00 00 00 
+  804315:	be be 00 00 00       	mov    $0xbe,%esi
+  80431a:	48 bf 2b 74 80 00 00 	movabs $0x80742b,%rdi
+  804321:	00 00 00 
+  804324:	b8 00 00 00 00       	mov    $0x0,%eax
+  804329:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  804330:	00 00 00 
+  804333:	41 ff d0             	call   *%r8
+            return res;
+  804336:	48 98                	cltq
+}
+  804338:	48 83 c4 08          	add    $0x8,%rsp
+  80433c:	5b                   	pop    %rbx
+  80433d:	41 5c                	pop    %r12
+  80433f:	41 5d                	pop    %r13
+  804341:	41 5e                	pop    %r14
+  804343:	41 5f                	pop    %r15
+  804345:	5d                   	pop    %rbp
+  804346:	c3                   	ret
+
+0000000000804347 <open>:
+open(const char *path, int mode) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	41 55                	push   %r13
+  80434d:	41 54                	push   %r12
+  80434f:	53                   	push   %rbx
+  804350:	48 83 ec 18          	sub    $0x18,%rsp
+  804354:	49 89 fc             	mov    %rdi,%r12
+  804357:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80435a:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  804361:	00 00 00 
+  804364:	ff d0                	call   *%rax
+  804366:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80436c:	0f 87 8f 00 00 00    	ja     804401 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804372:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804376:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  80437d:	00 00 00 
+  804380:	ff d0                	call   *%rax
+  804382:	89 c3                	mov    %eax,%ebx
+  804384:	85 c0                	test   %eax,%eax
+  804386:	78 55                	js     8043dd <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  804388:	4c 89 e6             	mov    %r12,%rsi
+  80438b:	48 bb 00 a0 80 01 00 	movabs $0x180a000,%rbx
+  804392:	00 00 00 
+  804395:	48 89 df             	mov    %rbx,%rdi
+  804398:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  80439f:	00 00 00 
+  8043a2:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8043a4:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8043ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8043b9:	48 b8 b0 3f 80 00 00 	movabs $0x803fb0,%rax
+  8043c0:	00 00 00 
+  8043c3:	ff d0                	call   *%rax
+  8043c5:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8043c7:	85 c0                	test   %eax,%eax
+  8043c9:	78 1f                	js     8043ea <open+0xa3>
+    return fd2num(fd);
+  8043cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043cf:	48 b8 3e 37 80 00 00 	movabs $0x80373e,%rax
+  8043d6:	00 00 00 
+  8043d9:	ff d0                	call   *%rax
+  8043db:	89 c3                	mov    %eax,%ebx
+}
+  8043dd:	89 d8                	mov    %ebx,%eax
+  8043df:	48 83 c4 18          	add    $0x18,%rsp
+  8043e3:	5b                   	pop    %rbx
+  8043e4:	41 5c                	pop    %r12
+  8043e6:	41 5d                	pop    %r13
+  8043e8:	5d                   	pop    %rbp
+  8043e9:	c3                   	ret
+        fd_close(fd, 0);
+  8043ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8043ef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043f3:	48 b8 87 38 80 00 00 	movabs $0x803887,%rax
+  8043fa:	00 00 00 
+  8043fd:	ff d0                	call   *%rax
+        return res;
+  8043ff:	eb dc                	jmp    8043dd <open+0x96>
+        return -E_BAD_PATH;
+  804401:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804406:	eb d5                	jmp    8043dd <open+0x96>
+
+0000000000804408 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  804408:	55                   	push   %rbp
+  804409:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  80440c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804411:	be 00 00 00 00       	mov    $0x0,%esi
+  804416:	bf 08 00 00 00       	mov    $0x8,%edi
+  80441b:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  804422:	00 00 00 
+  804425:	ff d0                	call   *%rax
+}
+  804427:	5d                   	pop    %rbp
+  804428:	c3                   	ret
+
+0000000000804429 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  804429:	55                   	push   %rbp
+  80442a:	48 89 e5             	mov    %rsp,%rbp
+  80442d:	41 56                	push   %r14
+  80442f:	41 55                	push   %r13
+  804431:	41 54                	push   %r12
+  804433:	53                   	push   %rbx
+  804434:	48 83 ec 10          	sub    $0x10,%rsp
+  804438:	41 89 f6             	mov    %esi,%r14d
+  80443b:	49 89 d4             	mov    %rdx,%r12
+  80443e:	48 89 cb             	mov    %rcx,%rbx
+  804441:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  804444:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804448:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  80444f:	00 00 00 
+  804452:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804454:	85 c0                	test   %eax,%eax
+  804456:	78 46                	js     80449e <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  804458:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80445c:	48 b8 80 80 80 00 00 	movabs $0x808080,%rax
+  804463:	00 00 00 
+  804466:	8b 00                	mov    (%rax),%eax
+  804468:	39 02                	cmp    %eax,(%rdx)
+  80446a:	75 3f                	jne    8044ab <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80446c:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  804473:	00 00 00 
+  804476:	8b 52 0c             	mov    0xc(%rdx),%edx
+  804479:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  80447b:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  80447f:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  804483:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  804487:	48 89 da             	mov    %rbx,%rdx
+  80448a:	4c 89 e6             	mov    %r12,%rsi
+  80448d:	bf 09 00 00 00       	mov    $0x9,%edi
+  804492:	48 b8 b0 3f 80 00 00 	movabs $0x803fb0,%rax
+  804499:	00 00 00 
+  80449c:	ff d0                	call   *%rax
+}
+  80449e:	48 83 c4 10          	add    $0x10,%rsp
+  8044a2:	5b                   	pop    %rbx
+  8044a3:	41 5c                	pop    %r12
+  8044a5:	41 5d                	pop    %r13
+  8044a7:	41 5e                	pop    %r14
+  8044a9:	5d                   	pop    %rbp
+  8044aa:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8044ab:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8044b0:	eb ec                	jmp    80449e <file_map+0x75>
+
+00000000008044b2 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  8044b2:	55                   	push   %rbp
+  8044b3:	48 89 e5             	mov    %rsp,%rbp
+  8044b6:	41 54                	push   %r12
+  8044b8:	53                   	push   %rbx
+  8044b9:	48 83 ec 20          	sub    $0x20,%rsp
+  8044bd:	41 89 f4             	mov    %esi,%r12d
+  8044c0:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8044c3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8044c7:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  8044ce:	00 00 00 
+  8044d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044d3:	85 c0                	test   %eax,%eax
+  8044d5:	78 3c                	js     804513 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  8044d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044db:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  8044e2:	00 00 00 
+  8044e5:	8b 0a                	mov    (%rdx),%ecx
+  8044e7:	39 08                	cmp    %ecx,(%rax)
+  8044e9:	75 31                	jne    80451c <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  8044eb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044ee:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8044f1:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  8044f5:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  8044f9:	ba 10 00 00 00       	mov    $0x10,%edx
+  8044fe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  804502:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804507:	48 b8 b5 3e 80 00 00 	movabs $0x803eb5,%rax
+  80450e:	00 00 00 
+  804511:	ff d0                	call   *%rax
+}
+  804513:	48 83 c4 20          	add    $0x20,%rsp
+  804517:	5b                   	pop    %rbx
+  804518:	41 5c                	pop    %r12
+  80451a:	5d                   	pop    %rbp
+  80451b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  80451c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804521:	eb f0                	jmp    804513 <file_msync+0x61>
+
+0000000000804523 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804523:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  804527:	7f 01                	jg     80452a <writebuf+0x7>
+  804529:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80452a:	55                   	push   %rbp
+  80452b:	48 89 e5             	mov    %rsp,%rbp
+  80452e:	53                   	push   %rbx
+  80452f:	48 83 ec 08          	sub    $0x8,%rsp
+  804533:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  804536:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80453a:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80453e:	8b 3f                	mov    (%rdi),%edi
+  804540:	48 b8 de 3b 80 00 00 	movabs $0x803bde,%rax
+  804547:	00 00 00 
+  80454a:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80454c:	48 85 c0             	test   %rax,%rax
+  80454f:	7e 04                	jle    804555 <writebuf+0x32>
+  804551:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  804555:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  804559:	48 39 c2             	cmp    %rax,%rdx
+  80455c:	74 0f                	je     80456d <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80455e:	48 85 c0             	test   %rax,%rax
+  804561:	ba 00 00 00 00       	mov    $0x0,%edx
+  804566:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80456a:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80456d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804571:	c9                   	leave
+  804572:	c3                   	ret
+
+0000000000804573 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  804573:	8b 46 04             	mov    0x4(%rsi),%eax
+  804576:	8d 50 01             	lea    0x1(%rax),%edx
+  804579:	89 56 04             	mov    %edx,0x4(%rsi)
+  80457c:	48 98                	cltq
+  80457e:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  804583:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  804589:	74 01                	je     80458c <putch+0x19>
+  80458b:	c3                   	ret
+putch(int ch, void *arg) {
+  80458c:	55                   	push   %rbp
+  80458d:	48 89 e5             	mov    %rsp,%rbp
+  804590:	53                   	push   %rbx
+  804591:	48 83 ec 08          	sub    $0x8,%rsp
+  804595:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  804598:	48 89 f7             	mov    %rsi,%rdi
+  80459b:	48 b8 23 45 80 00 00 	movabs $0x804523,%rax
+  8045a2:	00 00 00 
+  8045a5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8045a7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8045ae:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045b2:	c9                   	leave
+  8045b3:	c3                   	ret
+
+00000000008045b4 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8045b4:	55                   	push   %rbp
+  8045b5:	48 89 e5             	mov    %rsp,%rbp
+  8045b8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8045bf:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8045c2:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8045c8:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8045cf:	00 00 00 
+    state.result = 0;
+  8045d2:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8045d9:	00 00 00 00 
+    state.error = 1;
+  8045dd:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8045e4:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8045e7:	48 89 f2             	mov    %rsi,%rdx
+  8045ea:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8045f1:	48 bf 73 45 80 00 00 	movabs $0x804573,%rdi
+  8045f8:	00 00 00 
+  8045fb:	48 b8 e2 1f 80 00 00 	movabs $0x801fe2,%rax
+  804602:	00 00 00 
+  804605:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  804607:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80460e:	7f 14                	jg     804624 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804610:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  804617:	48 85 c0             	test   %rax,%rax
+  80461a:	75 06                	jne    804622 <vfprintf+0x6e>
+  80461c:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804622:	c9                   	leave
+  804623:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804624:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80462b:	48 b8 23 45 80 00 00 	movabs $0x804523,%rax
+  804632:	00 00 00 
+  804635:	ff d0                	call   *%rax
+  804637:	eb d7                	jmp    804610 <vfprintf+0x5c>
+
+0000000000804639 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  804639:	55                   	push   %rbp
+  80463a:	48 89 e5             	mov    %rsp,%rbp
+  80463d:	48 83 ec 50          	sub    $0x50,%rsp
+  804641:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804645:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804649:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80464d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804651:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804658:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80465c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804660:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804664:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  804668:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80466c:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  804673:	00 00 00 
+  804676:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804678:	c9                   	leave
+  804679:	c3                   	ret
+
+000000000080467a <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80467a:	55                   	push   %rbp
+  80467b:	48 89 e5             	mov    %rsp,%rbp
+  80467e:	48 83 ec 50          	sub    $0x50,%rsp
+  804682:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804686:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80468a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80468e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804692:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804696:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80469d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8046a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046a5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8046a9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8046ad:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8046b1:	48 89 fe             	mov    %rdi,%rsi
+  8046b4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046b9:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  8046c0:	00 00 00 
+  8046c3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8046c5:	c9                   	leave
+  8046c6:	c3                   	ret
+
+00000000008046c7 <collect_shared_region>:
+    return 0;
+}
+
+/* Append shared region to SharedList arg merging adjacent regions */
+static int
+collect_shared_region(void *start, void *end, void *arg) {
+  8046c7:	55                   	push   %rbp
+  8046c8:	48 89 e5             	mov    %rsp,%rbp
+  8046cb:	41 55                	push   %r13
+  8046cd:	41 54                	push   %r12
+  8046cf:	53                   	push   %rbx
+  8046d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8046d4:	48 89 fb             	mov    %rdi,%rbx
+  8046d7:	49 89 f5             	mov    %rsi,%r13
+  8046da:	49 89 d4             	mov    %rdx,%r12
+    struct SharedList *list = arg;
+    int prot = get_prot(start);
+  8046dd:	48 b8 00 56 80 00 00 	movabs $0x805600,%rax
+  8046e4:	00 00 00 
+  8046e7:	ff d0                	call   *%rax
+  8046e9:	89 c1                	mov    %eax,%ecx
+
+    /* File mappings are not inherited, the child has no mmap() state */
+    if ((uintptr_t)start >= UMMAP_BASE && (uintptr_t)start < UMMAP_BASE + UMMAP_SIZE) return 0;
+  8046eb:	48 b8 00 00 00 00 d0 	movabs $0xffffffd000000000,%rax
+  8046f2:	ff ff ff 
+  8046f5:	48 01 d8             	add    %rbx,%rax
+  8046f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046fd:	48 c1 e8 24          	shr    $0x24,%rax
+  804701:	74 5c                	je     80475f <collect_shared_region+0x98>
+
+    if (list->count) {
+  804703:	49 8b 84 24 00 18 00 	mov    0x1800(%r12),%rax
+  80470a:	00 
+  80470b:	48 85 c0             	test   %rax,%rax
+  80470e:	74 20                	je     804730 <collect_shared_region+0x69>
+        struct SpawnRegion *last = &list->regions[list->count - 1];
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  804710:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  804714:	49 8d 14 d4          	lea    (%r12,%rdx,8),%rdx
+  804718:	48 8b 72 f0          	mov    -0x10(%rdx),%rsi
+  80471c:	48 89 f7             	mov    %rsi,%rdi
+  80471f:	48 03 7a e8          	add    -0x18(%rdx),%rdi
+  804723:	48 39 fb             	cmp    %rdi,%rbx
+  804726:	74 44                	je     80476c <collect_shared_region+0xa5>
+            last->size += end - start;
+            return 0;
+        }
+    }
+
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804728:	48 3d 00 01 00 00    	cmp    $0x100,%rax
+  80472e:	74 59                	je     804789 <collect_shared_region+0xc2>
+    list->regions[list->count++] = (struct SpawnRegion){
+  804730:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  804734:	49 89 94 24 00 18 00 	mov    %rdx,0x1800(%r12)
+  80473b:	00 
+  80473c:	48 8d 14 00          	lea    (%rax,%rax,1),%rdx
+  804740:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804744:	49 8d 34 f4          	lea    (%r12,%rsi,8),%rsi
+  804748:	48 89 1e             	mov    %rbx,(%rsi)
+            .start = (uintptr_t)start,
+            .size = end - start,
+  80474b:	49 29 dd             	sub    %rbx,%r13
+  80474e:	4c 89 6e 08          	mov    %r13,0x8(%rsi)
+    list->regions[list->count++] = (struct SpawnRegion){
+  804752:	48 01 c2             	add    %rax,%rdx
+  804755:	41 89 4c d4 10       	mov    %ecx,0x10(%r12,%rdx,8)
+            .prot = prot};
+    return 0;
+  80475a:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+  80475f:	89 d0                	mov    %edx,%eax
+  804761:	48 83 c4 08          	add    $0x8,%rsp
+  804765:	5b                   	pop    %rbx
+  804766:	41 5c                	pop    %r12
+  804768:	41 5d                	pop    %r13
+  80476a:	5d                   	pop    %rbp
+  80476b:	c3                   	ret
+        if (last->start + last->size == (uintptr_t)start && last->prot == prot) {
+  80476c:	48 8d 7c 40 fd       	lea    -0x3(%rax,%rax,2),%rdi
+  804771:	41 39 4c fc 10       	cmp    %ecx,0x10(%r12,%rdi,8)
+  804776:	75 b0                	jne    804728 <collect_shared_region+0x61>
+            last->size += end - start;
+  804778:	49 29 dd             	sub    %rbx,%r13
+  80477b:	49 01 f5             	add    %rsi,%r13
+  80477e:	4c 89 6a f0          	mov    %r13,-0x10(%rdx)
+            return 0;
+  804782:	ba 00 00 00 00       	mov    $0x0,%edx
+  804787:	eb d6                	jmp    80475f <collect_shared_region+0x98>
+    if (list->count == SPAWN_MAX_SHARED) return -E_NO_MEM;
+  804789:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+  80478e:	eb cf                	jmp    80475f <collect_shared_region+0x98>
+
+0000000000804790 <spawn>:
+spawn(const char *prog, const char **argv) {
+  804790:	55                   	push   %rbp
+  804791:	48 89 e5             	mov    %rsp,%rbp
+  804794:	41 57                	push   %r15
+  804796:	41 56                	push   %r14
+  804798:	41 55                	push   %r13
+  80479a:	41 54                	push   %r12
+  80479c:	53                   	push   %rbx
+  80479d:	48 81 ec 18 05 00 00 	sub    $0x518,%rsp
+  8047a4:	48 89 f3             	mov    %rsi,%rbx
+    int fd = open(prog, O_RDONLY);
+  8047a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8047ac:	48 b8 47 43 80 00 00 	movabs $0x804347,%rax
+  8047b3:	00 00 00 
+  8047b6:	ff d0                	call   *%rax
+  8047b8:	41 89 c6             	mov    %eax,%r14d
+    if (fd < 0) return fd;
+  8047bb:	85 c0                	test   %eax,%eax
+  8047bd:	0f 88 8f 06 00 00    	js     804e52 <spawn+0x6c2>
+    struct SpawnImage img = {
+  8047c3:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  8047ca:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8047cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8047d7:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  8047de:	00 00 00 
+  8047e1:	48 89 85 00 fd ff ff 	mov    %rax,-0x300(%rbp)
+  8047e8:	48 b8 20 b0 80 01 00 	movabs $0x180b020,%rax
+  8047ef:	00 00 00 
+  8047f2:	48 89 85 20 fd ff ff 	mov    %rax,-0x2e0(%rbp)
+    if ((res = fstat(fd, &st)) < 0) goto error2;
+  8047f9:	48 8d b5 30 fd ff ff 	lea    -0x2d0(%rbp),%rsi
+  804800:	44 89 f7             	mov    %r14d,%edi
+  804803:	48 b8 91 3d 80 00 00 	movabs $0x803d91,%rax
+  80480a:	00 00 00 
+  80480d:	ff d0                	call   *%rax
+  80480f:	41 89 c4             	mov    %eax,%r12d
+  804812:	85 c0                	test   %eax,%eax
+  804814:	0f 88 26 06 00 00    	js     804e40 <spawn+0x6b0>
+    if (st.st_ino) img.key = (struct SpawnKey){st.st_ino, st.st_size, st.st_version};
+  80481a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804821:	48 85 c0             	test   %rax,%rax
+  804824:	74 22                	je     804848 <spawn+0xb8>
+  804826:	48 63 95 b0 fd ff ff 	movslq -0x250(%rbp),%rdx
+  80482d:	48 89 85 e0 fc ff ff 	mov    %rax,-0x320(%rbp)
+  804834:	48 89 95 e8 fc ff ff 	mov    %rdx,-0x318(%rbp)
+  80483b:	8b 85 c0 fd ff ff    	mov    -0x240(%rbp),%eax
+  804841:	48 89 85 f0 fc ff ff 	mov    %rax,-0x310(%rbp)
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, staged, PROT_RW)) < 0) goto error2;
+  804848:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80484d:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804852:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804859:	00 00 00 
+  80485c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804861:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  804868:	00 00 00 
+  80486b:	ff d0                	call   *%rax
+  80486d:	41 89 c4             	mov    %eax,%r12d
+  804870:	85 c0                	test   %eax,%eax
+  804872:	0f 88 c8 05 00 00    	js     804e40 <spawn+0x6b0>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804878:	48 8b 3b             	mov    (%rbx),%rdi
+  80487b:	48 85 ff             	test   %rdi,%rdi
+  80487e:	0f 84 61 02 00 00    	je     804ae5 <spawn+0x355>
+  804884:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    string_size = 0;
+  80488a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        string_size += strlen(argv[argc]) + 1;
+  804890:	49 bf 8b 27 80 00 00 	movabs $0x80278b,%r15
+  804897:	00 00 00 
+  80489a:	41 ff d7             	call   *%r15
+  80489d:	4d 8d 6c 05 01       	lea    0x1(%r13,%rax,1),%r13
+    for (argc = 0; argv[argc] != 0; argc++)
+  8048a2:	4c 89 a5 d8 fa ff ff 	mov    %r12,-0x528(%rbp)
+  8048a9:	49 83 c4 01          	add    $0x1,%r12
+  8048ad:	4a 8b 7c e3 f8       	mov    -0x8(%rbx,%r12,8),%rdi
+  8048b2:	48 85 ff             	test   %rdi,%rdi
+  8048b5:	75 e3                	jne    80489a <spawn+0x10a>
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  8048b7:	41 bc 00 00 01 00    	mov    $0x10000,%r12d
+  8048bd:	4d 29 ec             	sub    %r13,%r12
+  8048c0:	48 b8 00 00 00 00 60 	movabs $0x6000000000,%rax
+  8048c7:	00 00 00 
+  8048ca:	49 01 c4             	add    %rax,%r12
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8048cd:	4c 89 e1             	mov    %r12,%rcx
+  8048d0:	48 83 e1 f8          	and    $0xfffffffffffffff8,%rcx
+  8048d4:	48 89 8d d0 fa ff ff 	mov    %rcx,-0x530(%rbp)
+  8048db:	48 8b b5 d8 fa ff ff 	mov    -0x528(%rbp),%rsi
+  8048e2:	89 f0                	mov    %esi,%eax
+  8048e4:	83 c0 01             	add    $0x1,%eax
+  8048e7:	48 98                	cltq
+  8048e9:	48 c1 e0 03          	shl    $0x3,%rax
+  8048ed:	48 29 c1             	sub    %rax,%rcx
+  8048f0:	48 89 8d c8 fa ff ff 	mov    %rcx,-0x538(%rbp)
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  8048f7:	48 8d 41 f0          	lea    -0x10(%rcx),%rax
+  8048fb:	48 ba ff ff ff ff 5f 	movabs $0x5fffffffff,%rdx
+  804902:	00 00 00 
+  804905:	48 39 c2             	cmp    %rax,%rdx
+  804908:	0f 83 f2 04 00 00    	jae    804e00 <spawn+0x670>
+    for (i = 0; i < argc; i++) {
+  80490e:	85 f6                	test   %esi,%esi
+  804910:	7e 4e                	jle    804960 <spawn+0x1d0>
+  804912:	49 89 cd             	mov    %rcx,%r13
+  804915:	48 63 c6             	movslq %esi,%rax
+  804918:	4c 8d 3c c1          	lea    (%rcx,%rax,8),%r15
+        argv_store[i] = STAGE2USTACK(string_store, stack);
+  80491c:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804923:	00 00 00 
+  804926:	4c 01 e0             	add    %r12,%rax
+  804929:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  80492d:	48 8b 33             	mov    (%rbx),%rsi
+  804930:	4c 89 e7             	mov    %r12,%rdi
+  804933:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  80493a:	00 00 00 
+  80493d:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  80493f:	48 8b 3b             	mov    (%rbx),%rdi
+  804942:	48 b8 8b 27 80 00 00 	movabs $0x80278b,%rax
+  804949:	00 00 00 
+  80494c:	ff d0                	call   *%rax
+  80494e:	4d 8d 64 04 01       	lea    0x1(%r12,%rax,1),%r12
+    for (i = 0; i < argc; i++) {
+  804953:	49 83 c5 08          	add    $0x8,%r13
+  804957:	48 83 c3 08          	add    $0x8,%rbx
+  80495b:	4d 39 fd             	cmp    %r15,%r13
+  80495e:	75 bc                	jne    80491c <spawn+0x18c>
+    argv_store[argc] = 0;
+  804960:	48 8b 85 d0 fa ff ff 	mov    -0x530(%rbp),%rax
+  804967:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80496e:	00 
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  80496f:	48 b8 00 00 01 00 60 	movabs $0x6000010000,%rax
+  804976:	00 00 00 
+  804979:	49 39 c4             	cmp    %rax,%r12
+  80497c:	0f 85 92 01 00 00    	jne    804b14 <spawn+0x384>
+    argv_store[-1] = STAGE2USTACK(argv_store, stack);
+  804982:	48 b8 00 70 fe ff 1f 	movabs $0x1ffffe7000,%rax
+  804989:	00 00 00 
+  80498c:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804993:	48 01 d0             	add    %rdx,%rax
+  804996:	48 89 42 f8          	mov    %rax,-0x8(%rdx)
+    argv_store[-2] = argc;
+  80499a:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  8049a1:	48 89 42 f0          	mov    %rax,-0x10(%rdx)
+    *rsp = STAGE2USTACK(&argv_store[-2], stack);
+  8049a5:	48 b8 f0 6f fe ff 1f 	movabs $0x1ffffe6ff0,%rax
+  8049ac:	00 00 00 
+  8049af:	48 01 d0             	add    %rdx,%rax
+  8049b2:	48 89 85 08 fd ff ff 	mov    %rax,-0x2f8(%rbp)
+    shared.count = 0;
+  8049b9:	48 be 20 b0 80 01 00 	movabs $0x180b020,%rsi
+  8049c0:	00 00 00 
+  8049c3:	48 c7 86 00 18 00 00 	movq   $0x0,0x1800(%rsi)
+  8049ca:	00 00 00 00 
+    if ((res = foreach_shared_region(collect_shared_region, &shared)) < 0) goto error;
+  8049ce:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  8049d5:	00 00 00 
+  8049d8:	48 b8 74 56 80 00 00 	movabs $0x805674,%rax
+  8049df:	00 00 00 
+  8049e2:	ff d0                	call   *%rax
+  8049e4:	41 89 c4             	mov    %eax,%r12d
+  8049e7:	85 c0                	test   %eax,%eax
+  8049e9:	0f 88 24 04 00 00    	js     804e13 <spawn+0x683>
+    img.nshared = shared.count;
+  8049ef:	48 a1 20 c8 80 01 00 	movabs 0x180c820,%rax
+  8049f6:	00 00 00 
+  8049f9:	48 89 85 28 fd ff ff 	mov    %rax,-0x2d8(%rbp)
+    if (img.key.size) {
+  804a00:	48 83 bd e8 fc ff ff 	cmpq   $0x0,-0x318(%rbp)
+  804a07:	00 
+  804a08:	74 1f                	je     804a29 <spawn+0x299>
+        res = sys_spawn(&img);
+  804a0a:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804a11:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  804a18:	00 00 00 
+  804a1b:	ff d0                	call   *%rax
+  804a1d:	41 89 c4             	mov    %eax,%r12d
+        if (res != -E_NOT_FOUND) goto done;
+  804a20:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  804a23:	0f 85 ca 03 00 00    	jne    804df3 <spawn+0x663>
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  804a29:	ba 00 02 00 00       	mov    $0x200,%edx
+  804a2e:	48 8d b5 e0 fa ff ff 	lea    -0x520(%rbp),%rsi
+  804a35:	44 89 f7             	mov    %r14d,%edi
+  804a38:	48 b8 6d 3b 80 00 00 	movabs $0x803b6d,%rax
+  804a3f:	00 00 00 
+  804a42:	ff d0                	call   *%rax
+  804a44:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  804a46:	3d 00 02 00 00       	cmp    $0x200,%eax
+  804a4b:	0f 85 f8 00 00 00    	jne    804b49 <spawn+0x3b9>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  804a51:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  804a58:	ff ff 00 
+  804a5b:	48 23 85 e0 fa ff ff 	and    -0x520(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  804a62:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804a69:	01 01 00 
+  804a6c:	48 39 d0             	cmp    %rdx,%rax
+  804a6f:	0f 85 f7 00 00 00    	jne    804b6c <spawn+0x3dc>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804a75:	81 bd f0 fa ff ff 02 	cmpl   $0x3e0002,-0x510(%rbp)
+  804a7c:	00 3e 00 
+  804a7f:	0f 85 e7 00 00 00    	jne    804b6c <spawn+0x3dc>
+        elf->e_phoff + elf->e_phnum * sizeof(struct Proghdr) > sizeof(elf_buf)) {
+  804a85:	48 8b 95 00 fb ff ff 	mov    -0x500(%rbp),%rdx
+  804a8c:	44 0f b7 85 18 fb ff 	movzwl -0x4e8(%rbp),%r8d
+  804a93:	ff 
+  804a94:	4a 8d 04 c5 00 00 00 	lea    0x0(,%r8,8),%rax
+  804a9b:	00 
+  804a9c:	4c 29 c0             	sub    %r8,%rax
+  804a9f:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+        elf->e_machine != 0x3E /* amd64 */ ||
+  804aa3:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804aa9:	0f 87 bd 00 00 00    	ja     804b6c <spawn+0x3dc>
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804aaf:	48 8d 84 15 e0 fa ff 	lea    -0x520(%rbp,%rdx,1),%rax
+  804ab6:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804ab7:	4d 85 c0             	test   %r8,%r8
+  804aba:	0f 84 1b 02 00 00    	je     804cdb <spawn+0x54b>
+  804ac0:	ba 00 00 00 00       	mov    $0x0,%edx
+    size_t nsegs = 0, start = *staged, end = start;
+  804ac5:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804acc:	00 00 01 00 
+  804ad0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804ad6:	49 ba 00 00 00 00 60 	movabs $0x6000000000,%r10
+  804add:	00 00 00 
+  804ae0:	e9 d4 00 00 00       	jmp    804bb9 <spawn+0x429>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804ae5:	48 c7 85 d8 fa ff ff 	movq   $0x0,-0x528(%rbp)
+  804aec:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804af0:	48 b8 f8 ff 00 00 60 	movabs $0x600000fff8,%rax
+  804af7:	00 00 00 
+  804afa:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  804b01:	48 8d 40 08          	lea    0x8(%rax),%rax
+  804b05:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+    string_store = (char *)stack + USER_STACK_SIZE - string_size;
+  804b0c:	49 89 c4             	mov    %rax,%r12
+  804b0f:	e9 4c fe ff ff       	jmp    804960 <spawn+0x1d0>
+    assert(string_store == (char *)stack + USER_STACK_SIZE);
+  804b14:	48 b9 70 74 80 00 00 	movabs $0x807470,%rcx
+  804b1b:	00 00 00 
+  804b1e:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  804b25:	00 00 00 
+  804b28:	be e2 00 00 00       	mov    $0xe2,%esi
+  804b2d:	48 bf c9 74 80 00 00 	movabs $0x8074c9,%rdi
+  804b34:	00 00 00 
+  804b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3c:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  804b43:	00 00 00 
+  804b46:	41 ff d0             	call   *%r8
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  804b49:	48 bf a0 74 80 00 00 	movabs $0x8074a0,%rdi
+  804b50:	00 00 00 
+  804b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b58:	48 ba 92 1e 80 00 00 	movabs $0x801e92,%rdx
+  804b5f:	00 00 00 
+  804b62:	ff d2                	call   *%rdx
+        return -E_NOT_EXEC;
+  804b64:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804b6a:	eb 2c                	jmp    804b98 <spawn+0x408>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804b6c:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804b71:	8b b5 e0 fa ff ff    	mov    -0x520(%rbp),%esi
+  804b77:	48 bf d5 74 80 00 00 	movabs $0x8074d5,%rdi
+  804b7e:	00 00 00 
+  804b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b86:	48 b9 92 1e 80 00 00 	movabs $0x801e92,%rcx
+  804b8d:	00 00 00 
+  804b90:	ff d1                	call   *%rcx
+        return -E_NOT_EXEC;
+  804b92:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804b98:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804b9f:	00 00 01 00 
+  804ba3:	e9 76 02 00 00       	jmp    804e1e <spawn+0x68e>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804ba8:	48 83 c2 01          	add    $0x1,%rdx
+  804bac:	48 83 c0 38          	add    $0x38,%rax
+  804bb0:	49 39 d0             	cmp    %rdx,%r8
+  804bb3:	0f 84 a5 00 00 00    	je     804c5e <spawn+0x4ce>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804bb9:	83 38 01             	cmpl   $0x1,(%rax)
+  804bbc:	75 ea                	jne    804ba8 <spawn+0x418>
+  804bbe:	48 8b 70 28          	mov    0x28(%rax),%rsi
+  804bc2:	48 85 f6             	test   %rsi,%rsi
+  804bc5:	74 e1                	je     804ba8 <spawn+0x418>
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804bc7:	49 83 ff 10          	cmp    $0x10,%r15
+  804bcb:	0f 84 a1 02 00 00    	je     804e72 <spawn+0x6e2>
+  804bd1:	48 3b 70 20          	cmp    0x20(%rax),%rsi
+  804bd5:	0f 82 aa 02 00 00    	jb     804e85 <spawn+0x6f5>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) prot |= PROT_W;
+  804bdb:	8b 78 04             	mov    0x4(%rax),%edi
+  804bde:	89 f9                	mov    %edi,%ecx
+  804be0:	83 e1 02             	and    $0x2,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) prot |= PROT_R;
+  804be3:	41 89 c9             	mov    %ecx,%r9d
+  804be6:	41 83 c9 04          	or     $0x4,%r9d
+  804bea:	40 f6 c7 04          	test   $0x4,%dil
+  804bee:	41 0f 45 c9          	cmovne %r9d,%ecx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) prot |= PROT_X;
+  804bf2:	41 89 c9             	mov    %ecx,%r9d
+  804bf5:	41 83 c9 01          	or     $0x1,%r9d
+  804bf9:	40 f6 c7 01          	test   $0x1,%dil
+  804bfd:	41 0f 45 c9          	cmovne %r9d,%ecx
+        uintptr_t va = ROUNDDOWN(ph->p_va, PAGE_SIZE);
+  804c01:	48 8b 78 10          	mov    0x10(%rax),%rdi
+  804c05:	49 89 f9             	mov    %rdi,%r9
+  804c08:	49 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%r9
+        size_t size = ROUNDUP(ph->p_va + ph->p_memsz, PAGE_SIZE) - va;
+  804c0f:	48 8d b4 3e ff 0f 00 	lea    0xfff(%rsi,%rdi,1),%rsi
+  804c16:	00 
+  804c17:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804c1e:	4c 29 ce             	sub    %r9,%rsi
+        segs[nsegs++] = (struct SpawnSegment){
+  804c21:	4c 89 ff             	mov    %r15,%rdi
+  804c24:	48 c1 e7 05          	shl    $0x5,%rdi
+  804c28:	48 8d 9d d0 fd ff ff 	lea    -0x230(%rbp),%rbx
+  804c2f:	48 01 df             	add    %rbx,%rdi
+                .src = (uintptr_t)USPAWN_STAGING + end,
+  804c32:	48 8b 9d d8 fa ff ff 	mov    -0x528(%rbp),%rbx
+  804c39:	4e 8d 1c 13          	lea    (%rbx,%r10,1),%r11
+  804c3d:	4c 89 1f             	mov    %r11,(%rdi)
+        segs[nsegs++] = (struct SpawnSegment){
+  804c40:	4c 89 4f 08          	mov    %r9,0x8(%rdi)
+  804c44:	48 89 77 10          	mov    %rsi,0x10(%rdi)
+  804c48:	89 4f 18             	mov    %ecx,0x18(%rdi)
+        end += size;
+  804c4b:	48 01 f3             	add    %rsi,%rbx
+  804c4e:	48 89 9d d8 fa ff ff 	mov    %rbx,-0x528(%rbp)
+        segs[nsegs++] = (struct SpawnSegment){
+  804c55:	4d 8d 7f 01          	lea    0x1(%r15),%r15
+  804c59:	e9 4a ff ff ff       	jmp    804ba8 <spawn+0x418>
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804c5e:	48 b8 00 00 00 00 01 	movabs $0x100000000,%rax
+  804c65:	00 00 00 
+  804c68:	48 8b 8d d8 fa ff ff 	mov    -0x528(%rbp),%rcx
+  804c6f:	48 39 c8             	cmp    %rcx,%rax
+  804c72:	0f 82 ef 01 00 00    	jb     804e67 <spawn+0x6d7>
+    if ((res = sys_alloc_region(0, USPAWN_STAGING + start, end - start, PROT_RW)) < 0) return res;
+  804c78:	48 8b 85 d8 fa ff ff 	mov    -0x528(%rbp),%rax
+  804c7f:	48 8d 90 00 00 ff ff 	lea    -0x10000(%rax),%rdx
+  804c86:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c8b:	48 be 00 00 01 00 60 	movabs $0x6000010000,%rsi
+  804c92:	00 00 00 
+  804c95:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c9a:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  804ca1:	00 00 00 
+  804ca4:	ff d0                	call   *%rax
+  804ca6:	41 89 c4             	mov    %eax,%r12d
+  804ca9:	85 c0                	test   %eax,%eax
+  804cab:	0f 88 e7 fe ff ff    	js     804b98 <spawn+0x408>
+    ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804cb1:	48 8b 85 00 fb ff ff 	mov    -0x500(%rbp),%rax
+  804cb8:	48 8d 9c 05 e0 fa ff 	lea    -0x520(%rbp,%rax,1),%rbx
+  804cbf:	ff 
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  804cc0:	66 83 bd 18 fb ff ff 	cmpw   $0x0,-0x4e8(%rbp)
+  804cc7:	00 
+  804cc8:	0f 84 d3 00 00 00    	je     804da1 <spawn+0x611>
+  804cce:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cd9:	eb 46                	jmp    804d21 <spawn+0x591>
+    size_t nsegs = 0, start = *staged, end = start;
+  804cdb:	4d 89 c7             	mov    %r8,%r15
+  804cde:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804ce5:	00 00 01 00 
+  804ce9:	eb 8d                	jmp    804c78 <spawn+0x4e8>
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804ceb:	48 85 c0             	test   %rax,%rax
+  804cee:	48 c7 c2 ee ff ff ff 	mov    $0xffffffffffffffee,%rdx
+  804cf5:	48 0f 49 c2          	cmovns %rdx,%rax
+  804cf9:	41 89 c4             	mov    %eax,%r12d
+    if ((res = load_segments(fd, &img, segs, &staged)) < 0) goto error;
+  804cfc:	85 c0                	test   %eax,%eax
+  804cfe:	0f 89 c0 00 00 00    	jns    804dc4 <spawn+0x634>
+  804d04:	e9 15 01 00 00       	jmp    804e1e <spawn+0x68e>
+    for (size_t i = 0, seg = 0; i < elf->e_phnum; i++, ph++) {
+  804d09:	49 83 c5 01          	add    $0x1,%r13
+  804d0d:	48 83 c3 38          	add    $0x38,%rbx
+  804d11:	0f b7 85 18 fb ff ff 	movzwl -0x4e8(%rbp),%eax
+  804d18:	49 39 c5             	cmp    %rax,%r13
+  804d1b:	0f 83 80 00 00 00    	jae    804da1 <spawn+0x611>
+        if (ph->p_type != ELF_PROG_LOAD || !ph->p_memsz) continue;
+  804d21:	83 3b 01             	cmpl   $0x1,(%rbx)
+  804d24:	75 e3                	jne    804d09 <spawn+0x579>
+  804d26:	48 83 7b 28 00       	cmpq   $0x0,0x28(%rbx)
+  804d2b:	74 dc                	je     804d09 <spawn+0x579>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804d2d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804d31:	48 89 85 c8 fa ff ff 	mov    %rax,-0x538(%rbp)
+  804d38:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d3c:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  804d40:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804d45:	48 03 84 15 d0 fd ff 	add    -0x230(%rbp,%rdx,1),%rax
+  804d4c:	ff 
+  804d4d:	48 89 85 d0 fa ff ff 	mov    %rax,-0x530(%rbp)
+        if ((res = seek(fd, ph->p_offset)) < 0) return res;
+  804d54:	8b 73 08             	mov    0x8(%rbx),%esi
+  804d57:	44 89 f7             	mov    %r14d,%edi
+  804d5a:	48 ba 97 3c 80 00 00 	movabs $0x803c97,%rdx
+  804d61:	00 00 00 
+  804d64:	ff d2                	call   *%rdx
+  804d66:	41 89 c4             	mov    %eax,%r12d
+  804d69:	85 c0                	test   %eax,%eax
+  804d6b:	0f 88 ad 00 00 00    	js     804e1e <spawn+0x68e>
+        ssize_t nread = readn(fd, dst, ph->p_filesz);
+  804d71:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  804d75:	48 8b b5 d0 fa ff ff 	mov    -0x530(%rbp),%rsi
+  804d7c:	44 89 f7             	mov    %r14d,%edi
+  804d7f:	48 b8 6d 3b 80 00 00 	movabs $0x803b6d,%rax
+  804d86:	00 00 00 
+  804d89:	ff d0                	call   *%rax
+        if (nread != ph->p_filesz) return nread < 0 ? (int)nread : -E_NOT_EXEC;
+  804d8b:	48 39 43 20          	cmp    %rax,0x20(%rbx)
+  804d8f:	0f 85 56 ff ff ff    	jne    804ceb <spawn+0x55b>
+        void *dst = (void *)segs[seg++].src + PAGE_OFFSET(ph->p_va);
+  804d95:	48 8b 95 c8 fa ff ff 	mov    -0x538(%rbp),%rdx
+  804d9c:	e9 68 ff ff ff       	jmp    804d09 <spawn+0x579>
+    img->entry = elf->e_entry;
+  804da1:	48 8b 85 f8 fa ff ff 	mov    -0x508(%rbp),%rax
+  804da8:	48 89 85 f8 fc ff ff 	mov    %rax,-0x308(%rbp)
+    img->segments = segs;
+  804daf:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804db6:	48 89 85 10 fd ff ff 	mov    %rax,-0x2f0(%rbp)
+    img->nsegments = nsegs;
+  804dbd:	4c 89 bd 18 fd ff ff 	mov    %r15,-0x2e8(%rbp)
+    res = sys_spawn(&img);
+  804dc4:	48 8d bd e0 fc ff ff 	lea    -0x320(%rbp),%rdi
+  804dcb:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  804dd2:	00 00 00 
+  804dd5:	ff d0                	call   *%rax
+  804dd7:	41 89 c4             	mov    %eax,%r12d
+    if (res < 0) goto error;
+  804dda:	45 85 e4             	test   %r12d,%r12d
+  804ddd:	78 3f                	js     804e1e <spawn+0x68e>
+    close(fd);
+  804ddf:	44 89 f7             	mov    %r14d,%edi
+  804de2:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  804de9:	00 00 00 
+  804dec:	ff d0                	call   *%rax
+    return res;
+  804dee:	45 89 e6             	mov    %r12d,%r14d
+  804df1:	eb 5f                	jmp    804e52 <spawn+0x6c2>
+    size_t staged = USER_STACK_SIZE;
+  804df3:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804dfa:	00 00 01 00 
+  804dfe:	eb da                	jmp    804dda <spawn+0x64a>
+  804e00:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804e07:	00 00 01 00 
+    if ((void *)(argv_store - 2) < stack) return -E_NO_MEM;
+  804e0b:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  804e11:	eb 0b                	jmp    804e1e <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804e13:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804e1a:	00 00 01 00 
+    sys_unmap_region(0, USPAWN_STAGING, staged);
+  804e1e:	48 8b 95 d8 fa ff ff 	mov    -0x528(%rbp),%rdx
+  804e25:	48 be 00 00 00 00 60 	movabs $0x6000000000,%rsi
+  804e2c:	00 00 00 
+  804e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e34:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  804e3b:	00 00 00 
+  804e3e:	ff d0                	call   *%rax
+    close(fd);
+  804e40:	44 89 f7             	mov    %r14d,%edi
+  804e43:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  804e4a:	00 00 00 
+  804e4d:	ff d0                	call   *%rax
+    return res;
+  804e4f:	45 89 e6             	mov    %r12d,%r14d
+}
+  804e52:	44 89 f0             	mov    %r14d,%eax
+  804e55:	48 81 c4 18 05 00 00 	add    $0x518,%rsp
+  804e5c:	5b                   	pop    %rbx
+  804e5d:	41 5c                	pop    %r12
+  804e5f:	41 5d                	pop    %r13
+  804e61:	41 5e                	pop    %r14
+  804e63:	41 5f                	pop    %r15
+  804e65:	5d                   	pop    %rbp
+  804e66:	c3                   	ret
+    if (end > USPAWN_STAGING_SIZE) return -E_NO_MEM;
+  804e67:	41 bc fc ff ff ff    	mov    $0xfffffffc,%r12d
+  804e6d:	e9 26 fd ff ff       	jmp    804b98 <spawn+0x408>
+    size_t staged = USER_STACK_SIZE;
+  804e72:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804e79:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804e7d:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804e83:	eb 99                	jmp    804e1e <spawn+0x68e>
+    size_t staged = USER_STACK_SIZE;
+  804e85:	48 c7 85 d8 fa ff ff 	movq   $0x10000,-0x528(%rbp)
+  804e8c:	00 00 01 00 
+        if (nsegs == SPAWN_MAX_SEGMENTS || ph->p_filesz > ph->p_memsz) return -E_NOT_EXEC;
+  804e90:	41 bc ee ff ff ff    	mov    $0xffffffee,%r12d
+  804e96:	eb 86                	jmp    804e1e <spawn+0x68e>
+
+0000000000804e98 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804e98:	55                   	push   %rbp
+  804e99:	48 89 e5             	mov    %rsp,%rbp
+  804e9c:	48 83 ec 50          	sub    $0x50,%rsp
+  804ea0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804ea4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804ea8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804eac:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804eb0:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804eb7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804ebb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ebf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804ec3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804ec7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804ecc:	eb 15                	jmp    804ee3 <spawnl+0x4b>
+  804ece:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804ed2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804ed6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804eda:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804ede:	74 1c                	je     804efc <spawnl+0x64>
+  804ee0:	83 c1 01             	add    $0x1,%ecx
+  804ee3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804ee6:	83 f8 2f             	cmp    $0x2f,%eax
+  804ee9:	77 e3                	ja     804ece <spawnl+0x36>
+  804eeb:	89 c2                	mov    %eax,%edx
+  804eed:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804ef1:	4c 01 d2             	add    %r10,%rdx
+  804ef4:	83 c0 08             	add    $0x8,%eax
+  804ef7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804efa:	eb de                	jmp    804eda <spawnl+0x42>
+    const char *argv[argc + 2];
+  804efc:	8d 41 02             	lea    0x2(%rcx),%eax
+  804eff:	48 98                	cltq
+  804f01:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  804f08:	00 
+  804f09:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804f0d:	48 29 c4             	sub    %rax,%rsp
+  804f10:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804f15:	4c 89 c0             	mov    %r8,%rax
+  804f18:	48 c1 e8 03          	shr    $0x3,%rax
+  804f1c:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804f20:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804f27:	00 
+    argv[argc + 1] = NULL;
+  804f28:	8d 41 01             	lea    0x1(%rcx),%eax
+  804f2b:	48 98                	cltq
+  804f2d:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804f34:	00 
+    va_start(vl, arg0);
+  804f35:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804f3c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804f40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804f44:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804f48:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804f4c:	85 c9                	test   %ecx,%ecx
+  804f4e:	74 41                	je     804f91 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804f50:	49 89 c1             	mov    %rax,%r9
+  804f53:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804f57:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804f5a:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804f5f:	eb 1b                	jmp    804f7c <spawnl+0xe4>
+  804f61:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804f65:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804f69:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804f6d:	48 8b 11             	mov    (%rcx),%rdx
+  804f70:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804f73:	48 83 c0 08          	add    $0x8,%rax
+  804f77:	48 39 f0             	cmp    %rsi,%rax
+  804f7a:	74 15                	je     804f91 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804f7c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804f7f:	83 fa 2f             	cmp    $0x2f,%edx
+  804f82:	77 dd                	ja     804f61 <spawnl+0xc9>
+  804f84:	89 d1                	mov    %edx,%ecx
+  804f86:	4c 01 c9             	add    %r9,%rcx
+  804f89:	83 c2 08             	add    $0x8,%edx
+  804f8c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804f8f:	eb dc                	jmp    804f6d <spawnl+0xd5>
+    return spawn(prog, argv);
+  804f91:	4c 89 c6             	mov    %r8,%rsi
+  804f94:	48 b8 90 47 80 00 00 	movabs $0x804790,%rax
+  804f9b:	00 00 00 
+  804f9e:	ff d0                	call   *%rax
+}
+  804fa0:	c9                   	leave
+  804fa1:	c3                   	ret
+
+0000000000804fa2 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804fa2:	55                   	push   %rbp
+  804fa3:	48 89 e5             	mov    %rsp,%rbp
+  804fa6:	41 54                	push   %r12
+  804fa8:	53                   	push   %rbx
+  804fa9:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804fac:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  804fb3:	00 00 00 
+  804fb6:	ff d0                	call   *%rax
+  804fb8:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804fbb:	48 be ef 74 80 00 00 	movabs $0x8074ef,%rsi
+  804fc2:	00 00 00 
+  804fc5:	48 89 df             	mov    %rbx,%rdi
+  804fc8:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  804fcf:	00 00 00 
+  804fd2:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804fd4:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804fd9:	41 2b 04 24          	sub    (%r12),%eax
+  804fdd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804fe3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804fea:	00 00 00 
+    stat->st_dev = &devpipe;
+  804fed:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  804ff4:	00 00 00 
+  804ff7:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  804ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  805003:	5b                   	pop    %rbx
+  805004:	41 5c                	pop    %r12
+  805006:	5d                   	pop    %rbp
+  805007:	c3                   	ret
+
+0000000000805008 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805008:	55                   	push   %rbp
+  805009:	48 89 e5             	mov    %rsp,%rbp
+  80500c:	41 54                	push   %r12
+  80500e:	53                   	push   %rbx
+  80500f:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  805012:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805017:	48 89 fe             	mov    %rdi,%rsi
+  80501a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80501f:	49 bc 06 30 80 00 00 	movabs $0x803006,%r12
+  805026:	00 00 00 
+  805029:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  80502c:	48 89 df             	mov    %rbx,%rdi
+  80502f:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  805036:	00 00 00 
+  805039:	ff d0                	call   *%rax
+  80503b:	48 89 c6             	mov    %rax,%rsi
+  80503e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805043:	bf 00 00 00 00       	mov    $0x0,%edi
+  805048:	41 ff d4             	call   *%r12
+}
+  80504b:	5b                   	pop    %rbx
+  80504c:	41 5c                	pop    %r12
+  80504e:	5d                   	pop    %rbp
+  80504f:	c3                   	ret
+
+0000000000805050 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805050:	55                   	push   %rbp
+  805051:	48 89 e5             	mov    %rsp,%rbp
+  805054:	41 57                	push   %r15
+  805056:	41 56                	push   %r14
+  805058:	41 55                	push   %r13
+  80505a:	41 54                	push   %r12
+  80505c:	53                   	push   %rbx
+  80505d:	48 83 ec 18          	sub    $0x18,%rsp
+  805061:	49 89 fc             	mov    %rdi,%r12
+  805064:	49 89 f5             	mov    %rsi,%r13
+  805067:	49 89 d7             	mov    %rdx,%r15
+  80506a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80506e:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  805075:	00 00 00 
+  805078:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  80507a:	4d 85 ff             	test   %r15,%r15
+  80507d:	0f 84 af 00 00 00    	je     805132 <devpipe_write+0xe2>
+  805083:	48 89 c3             	mov    %rax,%rbx
+  805086:	4c 89 f8             	mov    %r15,%rax
+  805089:	4d 89 ef             	mov    %r13,%r15
+  80508c:	4c 01 e8             	add    %r13,%rax
+  80508f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805093:	49 bd fc 2e 80 00 00 	movabs $0x802efc,%r13
+  80509a:	00 00 00 
+            sys_yield();
+  80509d:	49 be 8d 2e 80 00 00 	movabs $0x802e8d,%r14
+  8050a4:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8050a7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8050aa:	48 63 ce             	movslq %esi,%rcx
+  8050ad:	48 63 03             	movslq (%rbx),%rax
+  8050b0:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8050b6:	48 39 c1             	cmp    %rax,%rcx
+  8050b9:	72 2e                	jb     8050e9 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8050bb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8050c0:	48 89 da             	mov    %rbx,%rdx
+  8050c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8050c8:	4c 89 e7             	mov    %r12,%rdi
+  8050cb:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8050ce:	85 c0                	test   %eax,%eax
+  8050d0:	74 66                	je     805138 <devpipe_write+0xe8>
+            sys_yield();
+  8050d2:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8050d5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8050d8:	48 63 ce             	movslq %esi,%rcx
+  8050db:	48 63 03             	movslq (%rbx),%rax
+  8050de:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  8050e4:	48 39 c1             	cmp    %rax,%rcx
+  8050e7:	73 d2                	jae    8050bb <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8050e9:	41 0f b6 3f          	movzbl (%r15),%edi
+  8050ed:	48 89 ca             	mov    %rcx,%rdx
+  8050f0:	48 c1 ea 03          	shr    $0x3,%rdx
+  8050f4:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8050fb:	08 10 20 
+  8050fe:	48 f7 e2             	mul    %rdx
+  805101:	48 c1 ea 06          	shr    $0x6,%rdx
+  805105:	48 89 d0             	mov    %rdx,%rax
+  805108:	48 c1 e0 09          	shl    $0x9,%rax
+  80510c:	48 29 d0             	sub    %rdx,%rax
+  80510f:	48 c1 e0 03          	shl    $0x3,%rax
+  805113:	48 29 c1             	sub    %rax,%rcx
+  805116:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  80511b:	83 c6 01             	add    $0x1,%esi
+  80511e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  805121:	49 83 c7 01          	add    $0x1,%r15
+  805125:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805129:	49 39 c7             	cmp    %rax,%r15
+  80512c:	0f 85 75 ff ff ff    	jne    8050a7 <devpipe_write+0x57>
+    return n;
+  805132:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805136:	eb 05                	jmp    80513d <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  805138:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80513d:	48 83 c4 18          	add    $0x18,%rsp
+  805141:	5b                   	pop    %rbx
+  805142:	41 5c                	pop    %r12
+  805144:	41 5d                	pop    %r13
+  805146:	41 5e                	pop    %r14
+  805148:	41 5f                	pop    %r15
+  80514a:	5d                   	pop    %rbp
+  80514b:	c3                   	ret
+
+000000000080514c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80514c:	55                   	push   %rbp
+  80514d:	48 89 e5             	mov    %rsp,%rbp
+  805150:	41 57                	push   %r15
+  805152:	41 56                	push   %r14
+  805154:	41 55                	push   %r13
+  805156:	41 54                	push   %r12
+  805158:	53                   	push   %rbx
+  805159:	48 83 ec 18          	sub    $0x18,%rsp
+  80515d:	49 89 fc             	mov    %rdi,%r12
+  805160:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805164:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805168:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  80516f:	00 00 00 
+  805172:	ff d0                	call   *%rax
+  805174:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  805177:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80517d:	49 bd fc 2e 80 00 00 	movabs $0x802efc,%r13
+  805184:	00 00 00 
+            sys_yield();
+  805187:	49 be 8d 2e 80 00 00 	movabs $0x802e8d,%r14
+  80518e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  805191:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  805196:	74 7d                	je     805215 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  805198:	8b 03                	mov    (%rbx),%eax
+  80519a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80519d:	75 26                	jne    8051c5 <devpipe_read+0x79>
+            if (i > 0) return i;
+  80519f:	4d 85 ff             	test   %r15,%r15
+  8051a2:	75 77                	jne    80521b <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8051a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8051a9:	48 89 da             	mov    %rbx,%rdx
+  8051ac:	be 00 10 00 00       	mov    $0x1000,%esi
+  8051b1:	4c 89 e7             	mov    %r12,%rdi
+  8051b4:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  8051b7:	85 c0                	test   %eax,%eax
+  8051b9:	74 72                	je     80522d <devpipe_read+0xe1>
+            sys_yield();
+  8051bb:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8051be:	8b 03                	mov    (%rbx),%eax
+  8051c0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8051c3:	74 df                	je     8051a4 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8051c5:	48 63 c8             	movslq %eax,%rcx
+  8051c8:	48 89 ca             	mov    %rcx,%rdx
+  8051cb:	48 c1 ea 03          	shr    $0x3,%rdx
+  8051cf:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  8051d6:	08 10 20 
+  8051d9:	48 89 d0             	mov    %rdx,%rax
+  8051dc:	48 f7 e6             	mul    %rsi
+  8051df:	48 c1 ea 06          	shr    $0x6,%rdx
+  8051e3:	48 89 d0             	mov    %rdx,%rax
+  8051e6:	48 c1 e0 09          	shl    $0x9,%rax
+  8051ea:	48 29 d0             	sub    %rdx,%rax
+  8051ed:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8051f4:	00 
+  8051f5:	48 89 c8             	mov    %rcx,%rax
+  8051f8:	48 29 d0             	sub    %rdx,%rax
+  8051fb:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  805200:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  805204:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  805208:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80520b:	49 83 c7 01          	add    $0x1,%r15
+  80520f:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  805213:	75 83                	jne    805198 <devpipe_read+0x4c>
+    return n;
+  805215:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805219:	eb 03                	jmp    80521e <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80521b:	4c 89 f8             	mov    %r15,%rax
+}
+  80521e:	48 83 c4 18          	add    $0x18,%rsp
+  805222:	5b                   	pop    %rbx
+  805223:	41 5c                	pop    %r12
+  805225:	41 5d                	pop    %r13
+  805227:	41 5e                	pop    %r14
+  805229:	41 5f                	pop    %r15
+  80522b:	5d                   	pop    %rbp
+  80522c:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80522d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805232:	eb ea                	jmp    80521e <devpipe_read+0xd2>
+
+0000000000805234 <pipe>:
+pipe(int pfd[2]) {
+  805234:	55                   	push   %rbp
+  805235:	48 89 e5             	mov    %rsp,%rbp
+  805238:	41 55                	push   %r13
+  80523a:	41 54                	push   %r12
+  80523c:	53                   	push   %rbx
+  80523d:	48 83 ec 18          	sub    $0x18,%rsp
+  805241:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805244:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  805248:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  80524f:	00 00 00 
+  805252:	ff d0                	call   *%rax
+  805254:	89 c3                	mov    %eax,%ebx
+  805256:	85 c0                	test   %eax,%eax
+  805258:	0f 88 a0 01 00 00    	js     8053fe <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80525e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805263:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805268:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80526c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805271:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  805278:	00 00 00 
+  80527b:	ff d0                	call   *%rax
+  80527d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80527f:	85 c0                	test   %eax,%eax
+  805281:	0f 88 77 01 00 00    	js     8053fe <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805287:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80528b:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  805292:	00 00 00 
+  805295:	ff d0                	call   *%rax
+  805297:	89 c3                	mov    %eax,%ebx
+  805299:	85 c0                	test   %eax,%eax
+  80529b:	0f 88 43 01 00 00    	js     8053e4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8052a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8052a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052ab:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8052af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052b4:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  8052bb:	00 00 00 
+  8052be:	ff d0                	call   *%rax
+  8052c0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8052c2:	85 c0                	test   %eax,%eax
+  8052c4:	0f 88 1a 01 00 00    	js     8053e4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8052ca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8052ce:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  8052d5:	00 00 00 
+  8052d8:	ff d0                	call   *%rax
+  8052da:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8052dd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8052e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052e7:	48 89 c6             	mov    %rax,%rsi
+  8052ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ef:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  8052f6:	00 00 00 
+  8052f9:	ff d0                	call   *%rax
+  8052fb:	89 c3                	mov    %eax,%ebx
+  8052fd:	85 c0                	test   %eax,%eax
+  8052ff:	0f 88 c5 00 00 00    	js     8053ca <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  805305:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805309:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  805310:	00 00 00 
+  805313:	ff d0                	call   *%rax
+  805315:	48 89 c1             	mov    %rax,%rcx
+  805318:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80531e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805324:	ba 00 00 00 00       	mov    $0x0,%edx
+  805329:	4c 89 ee             	mov    %r13,%rsi
+  80532c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805331:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  805338:	00 00 00 
+  80533b:	ff d0                	call   *%rax
+  80533d:	89 c3                	mov    %eax,%ebx
+  80533f:	85 c0                	test   %eax,%eax
+  805341:	78 6e                	js     8053b1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  805343:	be 00 10 00 00       	mov    $0x1000,%esi
+  805348:	4c 89 ef             	mov    %r13,%rdi
+  80534b:	48 b8 c4 2e 80 00 00 	movabs $0x802ec4,%rax
+  805352:	00 00 00 
+  805355:	ff d0                	call   *%rax
+  805357:	83 f8 02             	cmp    $0x2,%eax
+  80535a:	0f 85 ab 00 00 00    	jne    80540b <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  805360:	a1 c0 80 80 00 00 00 	movabs 0x8080c0,%eax
+  805367:	00 00 
+  805369:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80536d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80536f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805373:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80537a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80537e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  805380:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805384:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80538b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80538f:	48 bb 3e 37 80 00 00 	movabs $0x80373e,%rbx
+  805396:	00 00 00 
+  805399:	ff d3                	call   *%rbx
+  80539b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80539f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8053a3:	ff d3                	call   *%rbx
+  8053a5:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8053aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8053af:	eb 4d                	jmp    8053fe <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8053b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053b6:	4c 89 ee             	mov    %r13,%rsi
+  8053b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053be:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  8053c5:	00 00 00 
+  8053c8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8053ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053cf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8053d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053d8:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  8053df:	00 00 00 
+  8053e2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8053e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053e9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8053ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053f2:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  8053f9:	00 00 00 
+  8053fc:	ff d0                	call   *%rax
+}
+  8053fe:	89 d8                	mov    %ebx,%eax
+  805400:	48 83 c4 18          	add    $0x18,%rsp
+  805404:	5b                   	pop    %rbx
+  805405:	41 5c                	pop    %r12
+  805407:	41 5d                	pop    %r13
+  805409:	5d                   	pop    %rbp
+  80540a:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80540b:	48 b9 08 75 80 00 00 	movabs $0x807508,%rcx
+  805412:	00 00 00 
+  805415:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  80541c:	00 00 00 
+  80541f:	be 2e 00 00 00       	mov    $0x2e,%esi
+  805424:	48 bf f6 74 80 00 00 	movabs $0x8074f6,%rdi
+  80542b:	00 00 00 
+  80542e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805433:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  80543a:	00 00 00 
+  80543d:	41 ff d0             	call   *%r8
+
+0000000000805440 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  805440:	55                   	push   %rbp
+  805441:	48 89 e5             	mov    %rsp,%rbp
+  805444:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805448:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80544c:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  805453:	00 00 00 
+  805456:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805458:	85 c0                	test   %eax,%eax
+  80545a:	78 35                	js     805491 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80545c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805460:	48 b8 50 37 80 00 00 	movabs $0x803750,%rax
+  805467:	00 00 00 
+  80546a:	ff d0                	call   *%rax
+  80546c:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80546f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  805474:	be 00 10 00 00       	mov    $0x1000,%esi
+  805479:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80547d:	48 b8 fc 2e 80 00 00 	movabs $0x802efc,%rax
+  805484:	00 00 00 
+  805487:	ff d0                	call   *%rax
+  805489:	85 c0                	test   %eax,%eax
+  80548b:	0f 94 c0             	sete   %al
+  80548e:	0f b6 c0             	movzbl %al,%eax
+}
+  805491:	c9                   	leave
+  805492:	c3                   	ret
+
+0000000000805493 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  805493:	55                   	push   %rbp
+  805494:	48 89 e5             	mov    %rsp,%rbp
+  805497:	41 55                	push   %r13
+  805499:	41 54                	push   %r12
+  80549b:	53                   	push   %rbx
+  80549c:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(envid != 0);
+  8054a0:	85 ff                	test   %edi,%edi
+  8054a2:	74 73                	je     805517 <wait+0x84>
+  8054a4:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8054a7:	89 f8                	mov    %edi,%eax
+  8054a9:	25 ff 03 00 00       	and    $0x3ff,%eax
+
+    while (env->env_id == envid &&
+  8054ae:	89 f9                	mov    %edi,%ecx
+  8054b0:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+  8054b6:	48 69 c9 38 02 00 00 	imul   $0x238,%rcx,%rcx
+  8054bd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8054c4:	00 00 00 
+  8054c7:	48 01 ca             	add    %rcx,%rdx
+  8054ca:	8b 92 c8 00 00 00    	mov    0xc8(%rdx),%edx
+  8054d0:	39 d7                	cmp    %edx,%edi
+  8054d2:	75 38                	jne    80550c <wait+0x79>
+           env->env_status != ENV_FREE) {
+  8054d4:	48 98                	cltq
+  8054d6:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8054dd:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8054e4:	00 00 00 
+  8054e7:	48 01 c3             	add    %rax,%rbx
+        sys_yield();
+  8054ea:	49 bd 8d 2e 80 00 00 	movabs $0x802e8d,%r13
+  8054f1:	00 00 00 
+           env->env_status != ENV_FREE) {
+  8054f4:	8b 83 d8 00 00 00    	mov    0xd8(%rbx),%eax
+    while (env->env_id == envid &&
+  8054fa:	85 c0                	test   %eax,%eax
+  8054fc:	74 0e                	je     80550c <wait+0x79>
+        sys_yield();
+  8054fe:	41 ff d5             	call   *%r13
+    while (env->env_id == envid &&
+  805501:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  805507:	44 39 e0             	cmp    %r12d,%eax
+  80550a:	74 e8                	je     8054f4 <wait+0x61>
+    }
+}
+  80550c:	48 83 c4 08          	add    $0x8,%rsp
+  805510:	5b                   	pop    %rbx
+  805511:	41 5c                	pop    %r12
+  805513:	41 5d                	pop    %r13
+  805515:	5d                   	pop    %rbp
+  805516:	c3                   	ret
+    assert(envid != 0);
+  805517:	48 b9 2c 75 80 00 00 	movabs $0x80752c,%rcx
+  80551e:	00 00 00 
+  805521:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  805528:	00 00 00 
+  80552b:	be 06 00 00 00       	mov    $0x6,%esi
+  805530:	48 bf 37 75 80 00 00 	movabs $0x807537,%rdi
+  805537:	00 00 00 
+  80553a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80553f:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  805546:	00 00 00 
+  805549:	41 ff d0             	call   *%r8
+
+000000000080554c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80554c:	48 89 f8             	mov    %rdi,%rax
+  80554f:	48 c1 e8 27          	shr    $0x27,%rax
+  805553:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80555a:	01 00 00 
+  80555d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805561:	f6 c2 01             	test   $0x1,%dl
+  805564:	74 6d                	je     8055d3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  805566:	48 89 f8             	mov    %rdi,%rax
+  805569:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80556d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805574:	01 00 00 
+  805577:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80557b:	f6 c2 01             	test   $0x1,%dl
+  80557e:	74 62                	je     8055e2 <get_uvpt_entry+0x96>
+  805580:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  805587:	01 00 00 
+  80558a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80558e:	f6 c2 80             	test   $0x80,%dl
+  805591:	75 4f                	jne    8055e2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  805593:	48 89 f8             	mov    %rdi,%rax
+  805596:	48 c1 e8 15          	shr    $0x15,%rax
+  80559a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8055a1:	01 00 00 
+  8055a4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8055a8:	f6 c2 01             	test   $0x1,%dl
+  8055ab:	74 44                	je     8055f1 <get_uvpt_entry+0xa5>
+  8055ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8055b4:	01 00 00 
+  8055b7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8055bb:	f6 c2 80             	test   $0x80,%dl
+  8055be:	75 31                	jne    8055f1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8055c0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8055c4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8055cb:	01 00 00 
+  8055ce:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8055d2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8055d3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8055da:	01 00 00 
+  8055dd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8055e1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8055e2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8055e9:	01 00 00 
+  8055ec:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8055f0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8055f1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8055f8:	01 00 00 
+  8055fb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8055ff:	c3                   	ret
+
+0000000000805600 <get_prot>:
+
+int
+get_prot(void *va) {
+  805600:	55                   	push   %rbp
+  805601:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805604:	48 b8 4c 55 80 00 00 	movabs $0x80554c,%rax
+  80560b:	00 00 00 
+  80560e:	ff d0                	call   *%rax
+  805610:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  805613:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  805618:	89 c1                	mov    %eax,%ecx
+  80561a:	83 c9 04             	or     $0x4,%ecx
+  80561d:	f6 c2 01             	test   $0x1,%dl
+  805620:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  805623:	89 c1                	mov    %eax,%ecx
+  805625:	83 c9 02             	or     $0x2,%ecx
+  805628:	f6 c2 02             	test   $0x2,%dl
+  80562b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80562e:	89 c1                	mov    %eax,%ecx
+  805630:	83 c9 01             	or     $0x1,%ecx
+  805633:	48 85 d2             	test   %rdx,%rdx
+  805636:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  805639:	89 c1                	mov    %eax,%ecx
+  80563b:	83 c9 40             	or     $0x40,%ecx
+  80563e:	f6 c6 04             	test   $0x4,%dh
+  805641:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  805644:	5d                   	pop    %rbp
+  805645:	c3                   	ret
+
+0000000000805646 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  805646:	55                   	push   %rbp
+  805647:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80564a:	48 b8 4c 55 80 00 00 	movabs $0x80554c,%rax
+  805651:	00 00 00 
+  805654:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805656:	48 c1 e8 06          	shr    $0x6,%rax
+  80565a:	83 e0 01             	and    $0x1,%eax
+}
+  80565d:	5d                   	pop    %rbp
+  80565e:	c3                   	ret
+
+000000000080565f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80565f:	55                   	push   %rbp
+  805660:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805663:	48 b8 4c 55 80 00 00 	movabs $0x80554c,%rax
+  80566a:	00 00 00 
+  80566d:	ff d0                	call   *%rax
+  80566f:	83 e0 01             	and    $0x1,%eax
+}
+  805672:	5d                   	pop    %rbp
+  805673:	c3                   	ret
+
+0000000000805674 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805674:	55                   	push   %rbp
+  805675:	48 89 e5             	mov    %rsp,%rbp
+  805678:	41 57                	push   %r15
+  80567a:	41 56                	push   %r14
+  80567c:	41 55                	push   %r13
+  80567e:	41 54                	push   %r12
+  805680:	53                   	push   %rbx
+  805681:	48 83 ec 28          	sub    $0x28,%rsp
+  805685:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  805689:	48 85 ff             	test   %rdi,%rdi
+  80568c:	74 1e                	je     8056ac <foreach_shared_region+0x38>
+  80568e:	49 89 ff             	mov    %rdi,%r15
+  805691:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  805697:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80569d:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8056a4:	01 00 00 
+  8056a7:	e9 72 02 00 00       	jmp    80591e <foreach_shared_region+0x2aa>
+    assert(fun);
+  8056ac:	48 b9 42 75 80 00 00 	movabs $0x807542,%rcx
+  8056b3:	00 00 00 
+  8056b6:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  8056bd:	00 00 00 
+  8056c0:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8056c5:	48 bf 46 75 80 00 00 	movabs $0x807546,%rdi
+  8056cc:	00 00 00 
+  8056cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056d4:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8056db:	00 00 00 
+  8056de:	41 ff d0             	call   *%r8
+  8056e1:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8056e8:	eb 6c                	jmp    805756 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8056ea:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8056f1:	ff ff ff 
+  8056f4:	4c 21 e2             	and    %r12,%rdx
+  8056f7:	48 89 d8             	mov    %rbx,%rax
+  8056fa:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8056ff:	48 83 c0 01          	add    $0x1,%rax
+  805703:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805707:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80570e:	00 00 00 
+  805711:	48 21 c8             	and    %rcx,%rax
+  805714:	48 09 d0             	or     %rdx,%rax
+  805717:	49 89 c4             	mov    %rax,%r12
+  80571a:	eb 30                	jmp    80574c <foreach_shared_region+0xd8>
+  80571c:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  805723:	ff ff ff 
+  805726:	4c 21 e2             	and    %r12,%rdx
+  805729:	48 89 d8             	mov    %rbx,%rax
+  80572c:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805731:	48 83 c0 01          	add    $0x1,%rax
+  805735:	48 c1 e0 1e          	shl    $0x1e,%rax
+  805739:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  805740:	00 00 00 
+  805743:	48 21 c8             	and    %rcx,%rax
+  805746:	48 09 d0             	or     %rdx,%rax
+  805749:	49 89 c4             	mov    %rax,%r12
+  80574c:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  805750:	0f 84 99 01 00 00    	je     8058ef <foreach_shared_region+0x27b>
+  805756:	4c 89 e3             	mov    %r12,%rbx
+  805759:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80575d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805764:	01 00 00 
+  805767:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80576b:	a8 01                	test   $0x1,%al
+  80576d:	0f 84 77 ff ff ff    	je     8056ea <foreach_shared_region+0x76>
+  805773:	a8 80                	test   $0x80,%al
+  805775:	74 19                	je     805790 <foreach_shared_region+0x11c>
+  805777:	f6 c4 04             	test   $0x4,%ah
+  80577a:	74 a0                	je     80571c <foreach_shared_region+0xa8>
+  80577c:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  805783:	40 
+  805784:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805788:	4c 89 e7             	mov    %r12,%rdi
+  80578b:	41 ff d7             	call   *%r15
+  80578e:	eb 8c                	jmp    80571c <foreach_shared_region+0xa8>
+  805790:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  805797:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80579b:	eb 46                	jmp    8057e3 <foreach_shared_region+0x16f>
+  80579d:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8057a4:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8057aa:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8057ae:	48 c1 e0 15          	shl    $0x15,%rax
+  8057b2:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8057b7:	49 09 c4             	or     %rax,%r12
+  8057ba:	eb 1d                	jmp    8057d9 <foreach_shared_region+0x165>
+  8057bc:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8057c3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8057c9:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8057cd:	48 c1 e0 15          	shl    $0x15,%rax
+  8057d1:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8057d6:	49 09 c4             	or     %rax,%r12
+  8057d9:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8057dd:	0f 84 d3 00 00 00    	je     8058b6 <foreach_shared_region+0x242>
+  8057e3:	4c 89 e3             	mov    %r12,%rbx
+  8057e6:	48 c1 eb 15          	shr    $0x15,%rbx
+  8057ea:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8057f1:	01 00 00 
+  8057f4:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8057f8:	a8 01                	test   $0x1,%al
+  8057fa:	74 a1                	je     80579d <foreach_shared_region+0x129>
+  8057fc:	a8 80                	test   $0x80,%al
+  8057fe:	74 19                	je     805819 <foreach_shared_region+0x1a5>
+  805800:	f6 c4 04             	test   $0x4,%ah
+  805803:	74 b7                	je     8057bc <foreach_shared_region+0x148>
+  805805:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80580c:	00 
+  80580d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805811:	4c 89 e7             	mov    %r12,%rdi
+  805814:	41 ff d7             	call   *%r15
+  805817:	eb a3                	jmp    8057bc <foreach_shared_region+0x148>
+  805819:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80581f:	eb 3b                	jmp    80585c <foreach_shared_region+0x1e8>
+  805821:	f6 c4 04             	test   $0x4,%ah
+  805824:	74 12                	je     805838 <foreach_shared_region+0x1c4>
+  805826:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80582d:	00 
+  80582e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805832:	4c 89 e7             	mov    %r12,%rdi
+  805835:	41 ff d7             	call   *%r15
+  805838:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80583f:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805845:	48 83 c3 01          	add    $0x1,%rbx
+  805849:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80584d:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805853:	49 09 dc             	or     %rbx,%r12
+  805856:	41 83 ed 01          	sub    $0x1,%r13d
+  80585a:	74 2f                	je     80588b <foreach_shared_region+0x217>
+  80585c:	4c 89 e3             	mov    %r12,%rbx
+  80585f:	48 c1 eb 0c          	shr    $0xc,%rbx
+  805863:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  805867:	a8 01                	test   $0x1,%al
+  805869:	75 b6                	jne    805821 <foreach_shared_region+0x1ad>
+  80586b:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  805872:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  805878:	48 83 c3 01          	add    $0x1,%rbx
+  80587c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805880:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  805886:	49 09 dc             	or     %rbx,%r12
+  805889:	eb cb                	jmp    805856 <foreach_shared_region+0x1e2>
+  80588b:	4c 89 e0             	mov    %r12,%rax
+  80588e:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  805894:	49 c1 ec 15          	shr    $0x15,%r12
+  805898:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80589f:	49 83 c4 01          	add    $0x1,%r12
+  8058a3:	49 c1 e4 15          	shl    $0x15,%r12
+  8058a7:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8058ae:	49 09 c4             	or     %rax,%r12
+  8058b1:	e9 23 ff ff ff       	jmp    8057d9 <foreach_shared_region+0x165>
+  8058b6:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8058ba:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8058c1:	ff ff ff 
+  8058c4:	4c 21 e0             	and    %r12,%rax
+  8058c7:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8058cb:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8058d2:	49 83 c4 01          	add    $0x1,%r12
+  8058d6:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8058da:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8058e1:	00 00 00 
+  8058e4:	49 21 d4             	and    %rdx,%r12
+  8058e7:	49 09 c4             	or     %rax,%r12
+  8058ea:	e9 5d fe ff ff       	jmp    80574c <foreach_shared_region+0xd8>
+  8058ef:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8058f6:	00 ff ff 
+  8058f9:	4c 21 e0             	and    %r12,%rax
+  8058fc:	49 c1 ec 27          	shr    $0x27,%r12
+  805900:	49 83 c4 01          	add    $0x1,%r12
+  805904:	49 c1 e4 27          	shl    $0x27,%r12
+  805908:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80590f:	ff 00 00 
+  805912:	49 21 d4             	and    %rdx,%r12
+  805915:	49 09 c4             	or     %rax,%r12
+  805918:	41 83 ed 01          	sub    $0x1,%r13d
+  80591c:	74 48                	je     805966 <foreach_shared_region+0x2f2>
+  80591e:	4c 89 e0             	mov    %r12,%rax
+  805921:	48 c1 e8 27          	shr    $0x27,%rax
+  805925:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80592c:	01 00 00 
+  80592f:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  805933:	f6 c2 01             	test   $0x1,%dl
+  805936:	0f 85 a5 fd ff ff    	jne    8056e1 <foreach_shared_region+0x6d>
+  80593c:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  805943:	00 ff ff 
+  805946:	4c 21 e2             	and    %r12,%rdx
+  805949:	48 83 c0 01          	add    $0x1,%rax
+  80594d:	48 c1 e0 27          	shl    $0x27,%rax
+  805951:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  805958:	ff 00 00 
+  80595b:	48 21 c8             	and    %rcx,%rax
+  80595e:	48 09 d0             	or     %rdx,%rax
+  805961:	49 89 c4             	mov    %rax,%r12
+  805964:	eb b2                	jmp    805918 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  805966:	4d 85 e4             	test   %r12,%r12
+  805969:	75 14                	jne    80597f <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80596b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805970:	48 83 c4 28          	add    $0x28,%rsp
+  805974:	5b                   	pop    %rbx
+  805975:	41 5c                	pop    %r12
+  805977:	41 5d                	pop    %r13
+  805979:	41 5e                	pop    %r14
+  80597b:	41 5f                	pop    %r15
+  80597d:	5d                   	pop    %rbp
+  80597e:	c3                   	ret
+    assert(addr == 0);
+  80597f:	48 b9 51 75 80 00 00 	movabs $0x807551,%rcx
+  805986:	00 00 00 
+  805989:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  805990:	00 00 00 
+  805993:	be 67 00 00 00       	mov    $0x67,%esi
+  805998:	48 bf 46 75 80 00 00 	movabs $0x807546,%rdi
+  80599f:	00 00 00 
+  8059a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059a7:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8059ae:	00 00 00 
+  8059b1:	41 ff d0             	call   *%r8
+
+00000000008059b4 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8059b4:	49 b8 40 cc 80 01 00 	movabs $0x180cc40,%r8
+  8059bb:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8059be:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8059c4:	eb 33                	jmp    8059f9 <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8059c6:	48 83 c0 20          	add    $0x20,%rax
+  8059ca:	4c 39 c0             	cmp    %r8,%rax
+  8059cd:	74 25                	je     8059f4 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8059cf:	48 8b 10             	mov    (%rax),%rdx
+  8059d2:	48 85 d2             	test   %rdx,%rdx
+  8059d5:	74 ef                	je     8059c6 <mmap_place+0x12>
+  8059d7:	48 89 d1             	mov    %rdx,%rcx
+  8059da:	48 03 48 08          	add    0x8(%rax),%rcx
+  8059de:	48 39 cf             	cmp    %rcx,%rdi
+  8059e1:	73 e3                	jae    8059c6 <mmap_place+0x12>
+  8059e3:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8059e7:	4c 39 ca             	cmp    %r9,%rdx
+  8059ea:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  8059ee:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  8059f2:	eb d2                	jmp    8059c6 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  8059f4:	45 84 d2             	test   %r10b,%r10b
+  8059f7:	74 12                	je     805a0b <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8059f9:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805a00:	00 00 00 
+        moved = 0;
+  805a03:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  805a09:	eb c4                	jmp    8059cf <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  805a0b:	48 01 fe             	add    %rdi,%rsi
+  805a0e:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  805a15:	00 00 00 
+  805a18:	48 39 f0             	cmp    %rsi,%rax
+  805a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a20:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  805a24:	c3                   	ret
+
+0000000000805a25 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  805a25:	55                   	push   %rbp
+  805a26:	48 89 e5             	mov    %rsp,%rbp
+  805a29:	41 57                	push   %r15
+  805a2b:	41 56                	push   %r14
+  805a2d:	41 55                	push   %r13
+  805a2f:	41 54                	push   %r12
+  805a31:	53                   	push   %rbx
+  805a32:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  805a36:	48 8b 1f             	mov    (%rdi),%rbx
+  805a39:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805a40:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805a47:	00 00 00 
+  805a4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a4f:	eb 12                	jmp    805a63 <mmap_pgfault+0x3e>
+  805a51:	48 83 c2 01          	add    $0x1,%rdx
+  805a55:	48 83 c0 20          	add    $0x20,%rax
+  805a59:	48 83 fa 20          	cmp    $0x20,%rdx
+  805a5d:	0f 84 04 01 00 00    	je     805b67 <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  805a63:	48 8b 08             	mov    (%rax),%rcx
+  805a66:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  805a6a:	48 39 de             	cmp    %rbx,%rsi
+  805a6d:	73 e2                	jae    805a51 <mmap_pgfault+0x2c>
+  805a6f:	48 03 48 08          	add    0x8(%rax),%rcx
+  805a73:	48 39 cb             	cmp    %rcx,%rbx
+  805a76:	73 d9                	jae    805a51 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  805a78:	48 c1 e2 05          	shl    $0x5,%rdx
+  805a7c:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805a83:	00 00 00 
+  805a86:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  805a8a:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  805a8e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  805a92:	f6 c2 01             	test   $0x1,%dl
+  805a95:	0f 84 e0 00 00 00    	je     805b7b <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  805a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805aa0:	f6 c2 02             	test   $0x2,%dl
+  805aa3:	0f 84 c3 00 00 00    	je     805b6c <mmap_pgfault+0x147>
+  805aa9:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805ab0:	ff ff ff 
+  805ab3:	48 23 56 10          	and    0x10(%rsi),%rdx
+  805ab7:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  805abe:	00 00 00 
+  805ac1:	48 39 ca             	cmp    %rcx,%rdx
+  805ac4:	0f 85 a2 00 00 00    	jne    805b6c <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  805aca:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805acf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805ad4:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  805adb:	00 00 00 
+  805ade:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ae3:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  805aea:	00 00 00 
+  805aed:	ff d0                	call   *%rax
+  805aef:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  805af1:	b8 00 00 00 00       	mov    $0x0,%eax
+  805af6:	85 d2                	test   %edx,%edx
+  805af8:	78 72                	js     805b6c <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  805afa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805aff:	48 89 de             	mov    %rbx,%rsi
+  805b02:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  805b09:	00 00 00 
+  805b0c:	4c 89 e7             	mov    %r12,%rdi
+  805b0f:	48 b8 80 2b 80 00 00 	movabs $0x802b80,%rax
+  805b16:	00 00 00 
+  805b19:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  805b1b:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  805b21:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  805b27:	48 89 d9             	mov    %rbx,%rcx
+  805b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b2f:	4c 89 e6             	mov    %r12,%rsi
+  805b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b37:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  805b3e:	00 00 00 
+  805b41:	ff d0                	call   *%rax
+  805b43:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  805b45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805b4a:	4c 89 e6             	mov    %r12,%rsi
+  805b4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b52:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  805b59:	00 00 00 
+  805b5c:	ff d0                	call   *%rax
+    return res >= 0;
+  805b5e:	89 d8                	mov    %ebx,%eax
+  805b60:	f7 d0                	not    %eax
+  805b62:	c1 e8 1f             	shr    $0x1f,%eax
+  805b65:	eb 05                	jmp    805b6c <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  805b67:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  805b6c:	48 83 c4 18          	add    $0x18,%rsp
+  805b70:	5b                   	pop    %rbx
+  805b71:	41 5c                	pop    %r12
+  805b73:	41 5d                	pop    %r13
+  805b75:	41 5e                	pop    %r14
+  805b77:	41 5f                	pop    %r15
+  805b79:	5d                   	pop    %rbp
+  805b7a:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  805b7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b7f:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  805b83:	4c 03 30             	add    (%rax),%r14
+  805b86:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  805b8d:	49 39 c6             	cmp    %rax,%r14
+  805b90:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805b94:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  805b9b:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  805ba1:	49 bf 5f 56 80 00 00 	movabs $0x80565f,%r15
+  805ba8:	00 00 00 
+  805bab:	4d 39 f4             	cmp    %r14,%r12
+  805bae:	73 1d                	jae    805bcd <mmap_pgfault+0x1a8>
+  805bb0:	4c 89 e7             	mov    %r12,%rdi
+  805bb3:	41 ff d7             	call   *%r15
+  805bb6:	84 c0                	test   %al,%al
+  805bb8:	75 13                	jne    805bcd <mmap_pgfault+0x1a8>
+  805bba:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805bc1:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805bc8:	4d 39 f4             	cmp    %r14,%r12
+  805bcb:	72 e3                	jb     805bb0 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805bcd:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  805bd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805bd7:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  805bdb:	74 2a                	je     805c07 <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  805bdd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805be1:	89 de                	mov    %ebx,%esi
+  805be3:	2b 30                	sub    (%rax),%esi
+  805be5:	03 70 1c             	add    0x1c(%rax),%esi
+  805be8:	8b 78 18             	mov    0x18(%rax),%edi
+  805beb:	4c 89 e9             	mov    %r13,%rcx
+  805bee:	48 89 da             	mov    %rbx,%rdx
+  805bf1:	48 b8 29 44 80 00 00 	movabs $0x804429,%rax
+  805bf8:	00 00 00 
+  805bfb:	ff d0                	call   *%rax
+    return res > 0;
+  805bfd:	85 c0                	test   %eax,%eax
+  805bff:	0f 9f c0             	setg   %al
+  805c02:	e9 65 ff ff ff       	jmp    805b6c <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  805c07:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  805c0b:	eb d0                	jmp    805bdd <mmap_pgfault+0x1b8>
+
+0000000000805c0d <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  805c0d:	55                   	push   %rbp
+  805c0e:	48 89 e5             	mov    %rsp,%rbp
+  805c11:	41 57                	push   %r15
+  805c13:	41 56                	push   %r14
+  805c15:	41 55                	push   %r13
+  805c17:	41 54                	push   %r12
+  805c19:	53                   	push   %rbx
+  805c1a:	48 83 ec 28          	sub    $0x28,%rsp
+  805c1e:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  805c22:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  805c25:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  805c2c:	ff ff ff 
+  805c2f:	48 23 57 10          	and    0x10(%rdi),%rdx
+  805c33:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c38:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  805c3f:	00 00 00 
+  805c42:	48 39 ca             	cmp    %rcx,%rdx
+  805c45:	0f 85 e5 00 00 00    	jne    805d30 <mmap_writeback+0x123>
+  805c4b:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  805c4e:	4c 39 ee             	cmp    %r13,%rsi
+  805c51:	0f 83 e8 00 00 00    	jae    805d3f <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805c57:	49 be 5f 56 80 00 00 	movabs $0x80565f,%r14
+  805c5e:	00 00 00 
+  805c61:	49 bf 46 56 80 00 00 	movabs $0x805646,%r15
+  805c68:	00 00 00 
+  805c6b:	eb 10                	jmp    805c7d <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  805c6d:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  805c74:	4d 39 ec             	cmp    %r13,%r12
+  805c77:	0f 83 ae 00 00 00    	jae    805d2b <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  805c7d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  805c81:	4c 89 e7             	mov    %r12,%rdi
+  805c84:	41 ff d6             	call   *%r14
+  805c87:	84 c0                	test   %al,%al
+  805c89:	74 e2                	je     805c6d <mmap_writeback+0x60>
+  805c8b:	4c 89 e7             	mov    %r12,%rdi
+  805c8e:	41 ff d7             	call   *%r15
+  805c91:	84 c0                	test   %al,%al
+  805c93:	74 d8                	je     805c6d <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  805c95:	4c 89 e3             	mov    %r12,%rbx
+  805c98:	4d 39 ec             	cmp    %r13,%r12
+  805c9b:	73 20                	jae    805cbd <mmap_writeback+0xb0>
+  805c9d:	48 89 df             	mov    %rbx,%rdi
+  805ca0:	41 ff d6             	call   *%r14
+  805ca3:	84 c0                	test   %al,%al
+  805ca5:	74 16                	je     805cbd <mmap_writeback+0xb0>
+  805ca7:	48 89 df             	mov    %rbx,%rdi
+  805caa:	41 ff d7             	call   *%r15
+  805cad:	84 c0                	test   %al,%al
+  805caf:	74 0c                	je     805cbd <mmap_writeback+0xb0>
+  805cb1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805cb8:	4c 39 eb             	cmp    %r13,%rbx
+  805cbb:	72 e0                	jb     805c9d <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  805cbd:	48 89 d9             	mov    %rbx,%rcx
+  805cc0:	4c 29 e1             	sub    %r12,%rcx
+  805cc3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805cc7:	44 89 e6             	mov    %r12d,%esi
+  805cca:	2b 30                	sub    (%rax),%esi
+  805ccc:	49 89 c4             	mov    %rax,%r12
+  805ccf:	03 70 1c             	add    0x1c(%rax),%esi
+  805cd2:	8b 78 18             	mov    0x18(%rax),%edi
+  805cd5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  805cd9:	48 89 ca             	mov    %rcx,%rdx
+  805cdc:	48 b8 b2 44 80 00 00 	movabs $0x8044b2,%rax
+  805ce3:	00 00 00 
+  805ce6:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  805ce8:	85 c0                	test   %eax,%eax
+  805cea:	78 44                	js     805d30 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  805cec:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  805cf1:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  805cf4:	41 89 c1             	mov    %eax,%r9d
+  805cf7:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  805cfe:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  805d02:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  805d06:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d0b:	48 89 ce             	mov    %rcx,%rsi
+  805d0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d13:	48 b8 9b 2f 80 00 00 	movabs $0x802f9b,%rax
+  805d1a:	00 00 00 
+  805d1d:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  805d1f:	85 c0                	test   %eax,%eax
+  805d21:	78 0d                	js     805d30 <mmap_writeback+0x123>
+  805d23:	49 89 dc             	mov    %rbx,%r12
+  805d26:	e9 49 ff ff ff       	jmp    805c74 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  805d2b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d30:	48 83 c4 28          	add    $0x28,%rsp
+  805d34:	5b                   	pop    %rbx
+  805d35:	41 5c                	pop    %r12
+  805d37:	41 5d                	pop    %r13
+  805d39:	41 5e                	pop    %r14
+  805d3b:	41 5f                	pop    %r15
+  805d3d:	5d                   	pop    %rbp
+  805d3e:	c3                   	ret
+    return 0;
+  805d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d44:	eb ea                	jmp    805d30 <mmap_writeback+0x123>
+
+0000000000805d46 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  805d46:	55                   	push   %rbp
+  805d47:	48 89 e5             	mov    %rsp,%rbp
+  805d4a:	41 57                	push   %r15
+  805d4c:	41 56                	push   %r14
+  805d4e:	41 55                	push   %r13
+  805d50:	41 54                	push   %r12
+  805d52:	53                   	push   %rbx
+  805d53:	48 83 ec 38          	sub    $0x38,%rsp
+  805d57:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805d5b:	48 85 f6             	test   %rsi,%rsi
+  805d5e:	0f 84 0c 02 00 00    	je     805f70 <mmap+0x22a>
+  805d64:	49 89 ff             	mov    %rdi,%r15
+  805d67:	49 89 f4             	mov    %rsi,%r12
+  805d6a:	41 89 d5             	mov    %edx,%r13d
+  805d6d:	41 89 ce             	mov    %ecx,%r14d
+  805d70:	44 89 cb             	mov    %r9d,%ebx
+  805d73:	45 85 c9             	test   %r9d,%r9d
+  805d76:	0f 88 f4 01 00 00    	js     805f70 <mmap+0x22a>
+  805d7c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805d83:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  805d8a:	0f 85 e7 01 00 00    	jne    805f77 <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  805d90:	83 e2 fd             	and    $0xfffffffd,%edx
+  805d93:	83 fa 04             	cmp    $0x4,%edx
+  805d96:	0f 85 db 01 00 00    	jne    805f77 <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  805d9c:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  805d9f:	83 fa 01             	cmp    $0x1,%edx
+  805da2:	0f 87 cf 01 00 00    	ja     805f77 <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  805da8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  805dac:	44 89 c7             	mov    %r8d,%edi
+  805daf:	48 b8 cc 37 80 00 00 	movabs $0x8037cc,%rax
+  805db6:	00 00 00 
+  805db9:	ff d0                	call   *%rax
+  805dbb:	89 c2                	mov    %eax,%edx
+  805dbd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805dc4:	85 d2                	test   %edx,%edx
+  805dc6:	0f 88 ab 01 00 00    	js     805f77 <mmap+0x231>
+  805dcc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805dd0:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  805dd7:	00 00 00 
+  805dda:	8b 09                	mov    (%rcx),%ecx
+  805ddc:	39 0a                	cmp    %ecx,(%rdx)
+  805dde:	0f 85 93 01 00 00    	jne    805f77 <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  805de4:	8b 52 08             	mov    0x8(%rdx),%edx
+  805de7:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  805dea:	83 fa 01             	cmp    $0x1,%edx
+  805ded:	0f 84 84 01 00 00    	je     805f77 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805df3:	41 83 fe 01          	cmp    $0x1,%r14d
+  805df7:	74 42                	je     805e3b <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  805df9:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  805e00:	4c 89 e6             	mov    %r12,%rsi
+  805e03:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  805e0a:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  805e0e:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  805e12:	4d 85 ff             	test   %r15,%r15
+  805e15:	74 67                	je     805e7e <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805e17:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  805e1e:	75 0f                	jne    805e2f <mmap+0xe9>
+  805e20:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  805e27:	00 00 00 
+  805e2a:	49 39 c7             	cmp    %rax,%r15
+  805e2d:	77 1b                	ja     805e4a <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805e2f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805e36:	e9 3c 01 00 00       	jmp    805f77 <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  805e3b:	41 f6 c5 02          	test   $0x2,%r13b
+  805e3f:	74 b8                	je     805df9 <mmap+0xb3>
+  805e41:	85 d2                	test   %edx,%edx
+  805e43:	75 b4                	jne    805df9 <mmap+0xb3>
+  805e45:	e9 2d 01 00 00       	jmp    805f77 <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  805e4a:	4c 89 ff             	mov    %r15,%rdi
+  805e4d:	48 b8 b4 59 80 00 00 	movabs $0x8059b4,%rax
+  805e54:	00 00 00 
+  805e57:	ff d0                	call   *%rax
+  805e59:	48 89 c2             	mov    %rax,%rdx
+  805e5c:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  805e63:	49 39 d7             	cmp    %rdx,%r15
+  805e66:	0f 85 0b 01 00 00    	jne    805f77 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805e6c:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805e73:	00 00 00 
+  805e76:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805e7c:	eb 44                	jmp    805ec2 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805e7e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  805e82:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  805e89:	00 00 00 
+  805e8c:	48 b8 b4 59 80 00 00 	movabs $0x8059b4,%rax
+  805e93:	00 00 00 
+  805e96:	ff d0                	call   *%rax
+  805e98:	48 89 c7             	mov    %rax,%rdi
+  805e9b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  805e9f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  805ea6:	48 85 ff             	test   %rdi,%rdi
+  805ea9:	75 c1                	jne    805e6c <mmap+0x126>
+  805eab:	e9 c7 00 00 00       	jmp    805f77 <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  805eb0:	49 83 c4 01          	add    $0x1,%r12
+  805eb4:	48 83 c0 20          	add    $0x20,%rax
+  805eb8:	49 83 fc 20          	cmp    $0x20,%r12
+  805ebc:	0f 84 a5 00 00 00    	je     805f67 <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805ec2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805ec6:	75 e8                	jne    805eb0 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  805ec8:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  805ecc:	48 b8 6c 37 80 00 00 	movabs $0x80376c,%rax
+  805ed3:	00 00 00 
+  805ed6:	ff d0                	call   *%rax
+  805ed8:	89 c2                	mov    %eax,%edx
+  805eda:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805ee1:	85 d2                	test   %edx,%edx
+  805ee3:	0f 88 8e 00 00 00    	js     805f77 <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  805ee9:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  805eed:	48 b8 3e 37 80 00 00 	movabs $0x80373e,%rax
+  805ef4:	00 00 00 
+  805ef7:	ff d0                	call   *%rax
+  805ef9:	89 c6                	mov    %eax,%esi
+  805efb:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  805efe:	48 b8 8c 39 80 00 00 	movabs $0x80398c,%rax
+  805f05:	00 00 00 
+  805f08:	ff d0                	call   *%rax
+  805f0a:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  805f0d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805f14:	45 85 ff             	test   %r15d,%r15d
+  805f17:	78 5e                	js     805f77 <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  805f19:	49 c1 e4 05          	shl    $0x5,%r12
+  805f1d:	48 b8 40 c8 80 01 00 	movabs $0x180c840,%rax
+  805f24:	00 00 00 
+  805f27:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  805f2a:	48 bf 25 5a 80 00 00 	movabs $0x805a25,%rdi
+  805f31:	00 00 00 
+  805f34:	48 b8 93 61 80 00 00 	movabs $0x806193,%rax
+  805f3b:	00 00 00 
+  805f3e:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  805f40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805f44:	49 89 04 24          	mov    %rax,(%r12)
+  805f48:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  805f4c:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  805f51:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  805f56:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  805f5b:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  805f60:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  805f65:	eb 10                	jmp    805f77 <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  805f67:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805f6e:	eb 07                	jmp    805f77 <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  805f70:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  805f77:	48 83 c4 38          	add    $0x38,%rsp
+  805f7b:	5b                   	pop    %rbx
+  805f7c:	41 5c                	pop    %r12
+  805f7e:	41 5d                	pop    %r13
+  805f80:	41 5e                	pop    %r14
+  805f82:	41 5f                	pop    %r15
+  805f84:	5d                   	pop    %rbp
+  805f85:	c3                   	ret
+
+0000000000805f86 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  805f86:	55                   	push   %rbp
+  805f87:	48 89 e5             	mov    %rsp,%rbp
+  805f8a:	41 57                	push   %r15
+  805f8c:	41 56                	push   %r14
+  805f8e:	41 55                	push   %r13
+  805f90:	41 54                	push   %r12
+  805f92:	53                   	push   %rbx
+  805f93:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805f97:	49 89 fe             	mov    %rdi,%r14
+  805f9a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  805fa1:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805fa8:	00 
+  805fa9:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805fb0:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  805fb7:	00 00 00 
+  805fba:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805fc1:	49 bf 0d 5c 80 00 00 	movabs $0x805c0d,%r15
+  805fc8:	00 00 00 
+  805fcb:	eb 09                	jmp    805fd6 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805fcd:	48 83 c3 20          	add    $0x20,%rbx
+  805fd1:	4c 39 eb             	cmp    %r13,%rbx
+  805fd4:	74 33                	je     806009 <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805fd6:	48 89 df             	mov    %rbx,%rdi
+  805fd9:	48 8b 33             	mov    (%rbx),%rsi
+  805fdc:	4c 39 e6             	cmp    %r12,%rsi
+  805fdf:	73 ec                	jae    805fcd <msync+0x47>
+  805fe1:	48 85 f6             	test   %rsi,%rsi
+  805fe4:	74 e7                	je     805fcd <msync+0x47>
+  805fe6:	48 89 f2             	mov    %rsi,%rdx
+  805fe9:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805fed:	49 39 d6             	cmp    %rdx,%r14
+  805ff0:	73 db                	jae    805fcd <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805ff2:	4c 39 e2             	cmp    %r12,%rdx
+  805ff5:	49 0f 47 d4          	cmova  %r12,%rdx
+  805ff9:	4c 39 f6             	cmp    %r14,%rsi
+  805ffc:	49 0f 42 f6          	cmovb  %r14,%rsi
+  806000:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  806003:	85 c0                	test   %eax,%eax
+  806005:	79 c6                	jns    805fcd <msync+0x47>
+  806007:	eb 05                	jmp    80600e <msync+0x88>
+    }
+
+    return 0;
+  806009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80600e:	48 83 c4 08          	add    $0x8,%rsp
+  806012:	5b                   	pop    %rbx
+  806013:	41 5c                	pop    %r12
+  806015:	41 5d                	pop    %r13
+  806017:	41 5e                	pop    %r14
+  806019:	41 5f                	pop    %r15
+  80601b:	5d                   	pop    %rbp
+  80601c:	c3                   	ret
+
+000000000080601d <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  80601d:	55                   	push   %rbp
+  80601e:	48 89 e5             	mov    %rsp,%rbp
+  806021:	41 57                	push   %r15
+  806023:	41 56                	push   %r14
+  806025:	41 55                	push   %r13
+  806027:	41 54                	push   %r12
+  806029:	53                   	push   %rbx
+  80602a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  80602e:	49 89 ff             	mov    %rdi,%r15
+  806031:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  806038:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  80603f:	00 
+  806040:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  806047:	48 bb 40 c8 80 01 00 	movabs $0x180c840,%rbx
+  80604e:	00 00 00 
+  806051:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  806058:	48 89 d8             	mov    %rbx,%rax
+  80605b:	eb 09                	jmp    806066 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80605d:	48 83 c0 20          	add    $0x20,%rax
+  806061:	4c 39 f0             	cmp    %r14,%rax
+  806064:	74 40                	je     8060a6 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  806066:	48 8b 10             	mov    (%rax),%rdx
+  806069:	4c 39 e2             	cmp    %r12,%rdx
+  80606c:	73 ef                	jae    80605d <munmap+0x40>
+  80606e:	48 85 d2             	test   %rdx,%rdx
+  806071:	74 ea                	je     80605d <munmap+0x40>
+  806073:	48 89 d7             	mov    %rdx,%rdi
+  806076:	48 03 78 08          	add    0x8(%rax),%rdi
+  80607a:	49 39 ff             	cmp    %rdi,%r15
+  80607d:	73 de                	jae    80605d <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  80607f:	49 39 fc             	cmp    %rdi,%r12
+  806082:	72 05                	jb     806089 <munmap+0x6c>
+  806084:	4c 39 fa             	cmp    %r15,%rdx
+  806087:	73 d4                	jae    80605d <munmap+0x40>
+  806089:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  80608e:	48 83 c4 08          	add    $0x8,%rsp
+  806092:	5b                   	pop    %rbx
+  806093:	41 5c                	pop    %r12
+  806095:	41 5d                	pop    %r13
+  806097:	41 5e                	pop    %r14
+  806099:	41 5f                	pop    %r15
+  80609b:	5d                   	pop    %rbp
+  80609c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80609d:	48 83 c3 20          	add    $0x20,%rbx
+  8060a1:	4c 39 f3             	cmp    %r14,%rbx
+  8060a4:	74 5c                	je     806102 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8060a6:	48 8b 33             	mov    (%rbx),%rsi
+  8060a9:	4c 39 e6             	cmp    %r12,%rsi
+  8060ac:	73 ef                	jae    80609d <munmap+0x80>
+  8060ae:	48 85 f6             	test   %rsi,%rsi
+  8060b1:	74 ea                	je     80609d <munmap+0x80>
+  8060b3:	48 89 f2             	mov    %rsi,%rdx
+  8060b6:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8060ba:	49 39 d7             	cmp    %rdx,%r15
+  8060bd:	73 de                	jae    80609d <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8060bf:	48 89 df             	mov    %rbx,%rdi
+  8060c2:	48 b8 0d 5c 80 00 00 	movabs $0x805c0d,%rax
+  8060c9:	00 00 00 
+  8060cc:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8060ce:	85 c0                	test   %eax,%eax
+  8060d0:	78 bc                	js     80608e <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8060d2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8060d6:	48 8b 33             	mov    (%rbx),%rsi
+  8060d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060de:	48 b8 06 30 80 00 00 	movabs $0x803006,%rax
+  8060e5:	00 00 00 
+  8060e8:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8060ea:	8b 7b 18             	mov    0x18(%rbx),%edi
+  8060ed:	48 b8 31 39 80 00 00 	movabs $0x803931,%rax
+  8060f4:	00 00 00 
+  8060f7:	ff d0                	call   *%rax
+        reg->start = 0;
+  8060f9:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  806100:	eb 9b                	jmp    80609d <munmap+0x80>
+    return 0;
+  806102:	b8 00 00 00 00       	mov    $0x0,%eax
+  806107:	eb 85                	jmp    80608e <munmap+0x71>
+
+0000000000806109 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  806109:	55                   	push   %rbp
+  80610a:	48 89 e5             	mov    %rsp,%rbp
+  80610d:	41 56                	push   %r14
+  80610f:	41 55                	push   %r13
+  806111:	41 54                	push   %r12
+  806113:	53                   	push   %rbx
+  806114:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806117:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80611e:	00 00 00 
+  806121:	48 83 38 00          	cmpq   $0x0,(%rax)
+  806125:	74 27                	je     80614e <_handle_vectored_pagefault+0x45>
+  806127:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80612c:	49 bd 40 cc 80 01 00 	movabs $0x180cc40,%r13
+  806133:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806136:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  806139:	4c 89 e7             	mov    %r12,%rdi
+  80613c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  806141:	84 c0                	test   %al,%al
+  806143:	75 45                	jne    80618a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  806145:	48 83 c3 01          	add    $0x1,%rbx
+  806149:	49 3b 1e             	cmp    (%r14),%rbx
+  80614c:	72 eb                	jb     806139 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80614e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  806155:	00 
+  806156:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80615b:	4d 8b 04 24          	mov    (%r12),%r8
+  80615f:	48 ba 60 75 80 00 00 	movabs $0x807560,%rdx
+  806166:	00 00 00 
+  806169:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80616e:	48 bf 90 75 80 00 00 	movabs $0x807590,%rdi
+  806175:	00 00 00 
+  806178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80617d:	49 ba 42 1d 80 00 00 	movabs $0x801d42,%r10
+  806184:	00 00 00 
+  806187:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80618a:	5b                   	pop    %rbx
+  80618b:	41 5c                	pop    %r12
+  80618d:	41 5d                	pop    %r13
+  80618f:	41 5e                	pop    %r14
+  806191:	5d                   	pop    %rbp
+  806192:	c3                   	ret
+
+0000000000806193 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  806193:	55                   	push   %rbp
+  806194:	48 89 e5             	mov    %rsp,%rbp
+  806197:	53                   	push   %rbx
+  806198:	48 83 ec 08          	sub    $0x8,%rsp
+  80619c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  80619f:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  8061a4:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  8061ab:	00 00 00 
+  8061ae:	80 38 00             	cmpb   $0x0,(%rax)
+  8061b1:	74 68                	je     80621b <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8061b3:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  8061ba:	00 00 00 
+  8061bd:	48 8b 08             	mov    (%rax),%rcx
+  8061c0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  8061c5:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  8061cc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8061cf:	48 85 c9             	test   %rcx,%rcx
+  8061d2:	0f 84 e0 00 00 00    	je     8062b8 <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8061d8:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8061dc:	0f 84 c9 00 00 00    	je     8062ab <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8061e2:	48 83 c2 01          	add    $0x1,%rdx
+  8061e6:	48 39 ca             	cmp    %rcx,%rdx
+  8061e9:	75 ed                	jne    8061d8 <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8061eb:	48 83 f9 08          	cmp    $0x8,%rcx
+  8061ef:	0f 84 84 00 00 00    	je     806279 <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8061f5:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8061f9:	48 a3 88 cc 80 01 00 	movabs %rax,0x180cc88
+  806200:	00 00 00 
+  806203:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  80620a:	00 00 00 
+  80620d:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  806211:	85 f6                	test   %esi,%esi
+  806213:	0f 89 97 00 00 00    	jns    8062b0 <add_pgfault_handler+0x11d>
+  806219:	eb 63                	jmp    80627e <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80621b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  806220:	ba 00 80 00 00       	mov    $0x8000,%edx
+  806225:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80622c:	00 00 00 
+  80622f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806234:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  80623b:	00 00 00 
+  80623e:	ff d0                	call   *%rax
+  806240:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  806242:	85 c0                	test   %eax,%eax
+  806244:	78 38                	js     80627e <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  806246:	48 be 94 63 80 00 00 	movabs $0x806394,%rsi
+  80624d:	00 00 00 
+  806250:	bf 00 00 00 00       	mov    $0x0,%edi
+  806255:	48 b8 51 31 80 00 00 	movabs $0x803151,%rax
+  80625c:	00 00 00 
+  80625f:	ff d0                	call   *%rax
+  806261:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  806263:	85 c0                	test   %eax,%eax
+  806265:	78 17                	js     80627e <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  806267:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  80626e:	00 00 00 
+  806271:	c6 00 01             	movb   $0x1,(%rax)
+  806274:	e9 3a ff ff ff       	jmp    8061b3 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  806279:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80627e:	89 f1                	mov    %esi,%ecx
+  806280:	48 ba 9e 75 80 00 00 	movabs $0x80759e,%rdx
+  806287:	00 00 00 
+  80628a:	be 42 00 00 00       	mov    $0x42,%esi
+  80628f:	48 bf 90 75 80 00 00 	movabs $0x807590,%rdi
+  806296:	00 00 00 
+  806299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80629e:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  8062a5:	00 00 00 
+  8062a8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8062ab:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  8062b0:	89 f0                	mov    %esi,%eax
+  8062b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8062b6:	c9                   	leave
+  8062b7:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8062b8:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  8062bf:	00 00 00 
+  8062c2:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  8062c9:	48 89 d8             	mov    %rbx,%rax
+  8062cc:	48 a3 40 cc 80 01 00 	movabs %rax,0x180cc40
+  8062d3:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8062d6:	eb d8                	jmp    8062b0 <add_pgfault_handler+0x11d>
+
+00000000008062d8 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8062d8:	55                   	push   %rbp
+  8062d9:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8062dc:	48 b8 80 cc 80 01 00 	movabs $0x180cc80,%rax
+  8062e3:	00 00 00 
+  8062e6:	80 38 00             	cmpb   $0x0,(%rax)
+  8062e9:	74 33                	je     80631e <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8062eb:	48 a1 88 cc 80 01 00 	movabs 0x180cc88,%rax
+  8062f2:	00 00 00 
+  8062f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8062fa:	48 ba 40 cc 80 01 00 	movabs $0x180cc40,%rdx
+  806301:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806304:	48 85 c0             	test   %rax,%rax
+  806307:	0f 84 85 00 00 00    	je     806392 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80630d:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  806311:	74 40                	je     806353 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806313:	48 83 c1 01          	add    $0x1,%rcx
+  806317:	48 39 c1             	cmp    %rax,%rcx
+  80631a:	75 f1                	jne    80630d <remove_pgfault_handler+0x35>
+  80631c:	eb 74                	jmp    806392 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80631e:	48 b9 b6 75 80 00 00 	movabs $0x8075b6,%rcx
+  806325:	00 00 00 
+  806328:	48 ba 16 74 80 00 00 	movabs $0x807416,%rdx
+  80632f:	00 00 00 
+  806332:	be 48 00 00 00       	mov    $0x48,%esi
+  806337:	48 bf 90 75 80 00 00 	movabs $0x807590,%rdi
+  80633e:	00 00 00 
+  806341:	b8 00 00 00 00       	mov    $0x0,%eax
+  806346:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  80634d:	00 00 00 
+  806350:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  806353:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80635a:	00 
+  80635b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80635f:	48 29 ca             	sub    %rcx,%rdx
+  806362:	48 b8 40 cc 80 01 00 	movabs $0x180cc40,%rax
+  806369:	00 00 00 
+  80636c:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  806370:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  806375:	48 89 ce             	mov    %rcx,%rsi
+  806378:	48 b8 19 2b 80 00 00 	movabs $0x802b19,%rax
+  80637f:	00 00 00 
+  806382:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  806384:	48 b8 88 cc 80 01 00 	movabs $0x180cc88,%rax
+  80638b:	00 00 00 
+  80638e:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  806392:	5d                   	pop    %rbp
+  806393:	c3                   	ret
+
+0000000000806394 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  806394:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  806397:	48 b8 09 61 80 00 00 	movabs $0x806109,%rax
+  80639e:	00 00 00 
+    call *%rax
+  8063a1:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  8063a3:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  8063aa:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  8063ab:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  8063b2:	00 
+    subq $8, %rcx
+  8063b3:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  8063b7:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  8063ba:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  8063c1:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  8063c2:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  8063c6:	4c 8b 3c 24          	mov    (%rsp),%r15
+  8063ca:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  8063cf:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  8063d4:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  8063d9:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8063de:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8063e3:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8063e8:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8063ed:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8063f2:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8063f7:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8063fc:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  806401:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  806406:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80640b:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  806410:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  806414:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  806418:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  806419:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80641a:	c3                   	ret
+
+000000000080641b <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80641b:	85 ff                	test   %edi,%edi
+  80641d:	78 58                	js     806477 <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  80641f:	48 85 f6             	test   %rsi,%rsi
+  806422:	74 12                	je     806436 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  806424:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80642b:	00 00 00 
+  80642e:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  806434:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  806436:	48 85 c9             	test   %rcx,%rcx
+  806439:	74 12                	je     80644d <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  80643b:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  806442:	00 00 00 
+  806445:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  80644b:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  80644d:	48 85 d2             	test   %rdx,%rdx
+  806450:	74 14                	je     806466 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  806452:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  806459:	00 00 00 
+  80645c:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  806463:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  806466:	48 a1 20 90 80 01 00 	movabs 0x1809020,%rax
+  80646d:	00 00 00 
+  806470:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  806476:	c3                   	ret
+        if (from_env_store) {
+  806477:	48 85 f6             	test   %rsi,%rsi
+  80647a:	74 06                	je     806482 <ipc_result+0x67>
+            *from_env_store = 0;
+  80647c:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  806482:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  806484:	48 85 c9             	test   %rcx,%rcx
+  806487:	74 ed                	je     806476 <ipc_result+0x5b>
+            *perm_store = 0;
+  806489:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  80648f:	c3                   	ret
+
+0000000000806490 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  806490:	55                   	push   %rbp
+  806491:	48 89 e5             	mov    %rsp,%rbp
+  806494:	41 55                	push   %r13
+  806496:	41 54                	push   %r12
+  806498:	53                   	push   %rbx
+  806499:	48 83 ec 08          	sub    $0x8,%rsp
+  80649d:	49 89 fc             	mov    %rdi,%r12
+  8064a0:	48 89 f7             	mov    %rsi,%rdi
+  8064a3:	48 89 d3             	mov    %rdx,%rbx
+  8064a6:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8064a9:	48 85 f6             	test   %rsi,%rsi
+  8064ac:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8064b3:	00 00 00 
+  8064b6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  8064ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8064bf:	48 85 d2             	test   %rdx,%rdx
+  8064c2:	74 03                	je     8064c7 <ipc_recv+0x37>
+  8064c4:	48 8b 32             	mov    (%rdx),%rsi
+  8064c7:	48 b8 7a 34 80 00 00 	movabs $0x80347a,%rax
+  8064ce:	00 00 00 
+  8064d1:	ff d0                	call   *%rax
+  8064d3:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  8064d5:	4c 89 e9             	mov    %r13,%rcx
+  8064d8:	48 89 da             	mov    %rbx,%rdx
+  8064db:	4c 89 e6             	mov    %r12,%rsi
+  8064de:	48 b8 1b 64 80 00 00 	movabs $0x80641b,%rax
+  8064e5:	00 00 00 
+  8064e8:	ff d0                	call   *%rax
+}
+  8064ea:	48 83 c4 08          	add    $0x8,%rsp
+  8064ee:	5b                   	pop    %rbx
+  8064ef:	41 5c                	pop    %r12
+  8064f1:	41 5d                	pop    %r13
+  8064f3:	5d                   	pop    %rbp
+  8064f4:	c3                   	ret
+
+00000000008064f5 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8064f5:	55                   	push   %rbp
+  8064f6:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8064f9:	48 85 d2             	test   %rdx,%rdx
+  8064fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806503:	00 00 00 
+  806506:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80650a:	89 f6                	mov    %esi,%esi
+  80650c:	48 b8 06 33 80 00 00 	movabs $0x803306,%rax
+  806513:	00 00 00 
+  806516:	ff d0                	call   *%rax
+    if (res < 0) {
+  806518:	85 c0                	test   %eax,%eax
+  80651a:	78 02                	js     80651e <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80651c:	5d                   	pop    %rbp
+  80651d:	c3                   	ret
+        panic("ipc_send: %i", res);
+  80651e:	89 c1                	mov    %eax,%ecx
+  806520:	48 ba d0 75 80 00 00 	movabs $0x8075d0,%rdx
+  806527:	00 00 00 
+  80652a:	be 4f 00 00 00       	mov    $0x4f,%esi
+  80652f:	48 bf dd 75 80 00 00 	movabs $0x8075dd,%rdi
+  806536:	00 00 00 
+  806539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80653e:	49 b8 42 1d 80 00 00 	movabs $0x801d42,%r8
+  806545:	00 00 00 
+  806548:	41 ff d0             	call   *%r8
+
+000000000080654b <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  80654b:	55                   	push   %rbp
+  80654c:	48 89 e5             	mov    %rsp,%rbp
+  80654f:	53                   	push   %rbx
+  806550:	48 83 ec 08          	sub    $0x8,%rsp
+  806554:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  806558:	48 85 d2             	test   %rdx,%rdx
+  80655b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806562:	00 00 00 
+  806565:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806569:	4d 85 c9             	test   %r9,%r9
+  80656c:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  806570:	b8 00 00 00 00       	mov    $0x0,%eax
+  806575:	48 85 db             	test   %rbx,%rbx
+  806578:	74 03                	je     80657d <ipc_call+0x32>
+  80657a:	48 8b 03             	mov    (%rbx),%rax
+  80657d:	89 f6                	mov    %esi,%esi
+  80657f:	48 83 ec 08          	sub    $0x8,%rsp
+  806583:	50                   	push   %rax
+  806584:	48 b8 38 33 80 00 00 	movabs $0x803338,%rax
+  80658b:	00 00 00 
+  80658e:	ff d0                	call   *%rax
+  806590:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  806592:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  806596:	48 89 da             	mov    %rbx,%rdx
+  806599:	be 00 00 00 00       	mov    $0x0,%esi
+  80659e:	48 b8 1b 64 80 00 00 	movabs $0x80641b,%rax
+  8065a5:	00 00 00 
+  8065a8:	ff d0                	call   *%rax
+}
+  8065aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8065ae:	c9                   	leave
+  8065af:	c3                   	ret
+
+00000000008065b0 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  8065b0:	55                   	push   %rbp
+  8065b1:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  8065b4:	89 f6                	mov    %esi,%esi
+  8065b6:	48 b8 a4 33 80 00 00 	movabs $0x8033a4,%rax
+  8065bd:	00 00 00 
+  8065c0:	ff d0                	call   *%rax
+  8065c2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  8065c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8065c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8065ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8065d3:	48 b8 1b 64 80 00 00 	movabs $0x80641b,%rax
+  8065da:	00 00 00 
+  8065dd:	ff d0                	call   *%rax
+}
+  8065df:	5d                   	pop    %rbp
+  8065e0:	c3                   	ret
+
+00000000008065e1 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8065e1:	55                   	push   %rbp
+  8065e2:	48 89 e5             	mov    %rsp,%rbp
+  8065e5:	41 54                	push   %r12
+  8065e7:	53                   	push   %rbx
+  8065e8:	4c 89 cb             	mov    %r9,%rbx
+  8065eb:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8065ef:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8065f3:	48 85 d2             	test   %rdx,%rdx
+  8065f6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8065fd:	00 00 00 
+  806600:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  806604:	4d 85 c9             	test   %r9,%r9
+  806607:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80660b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806610:	4d 85 e4             	test   %r12,%r12
+  806613:	74 04                	je     806619 <ipc_reply_wait+0x38>
+  806615:	49 8b 04 24          	mov    (%r12),%rax
+  806619:	89 f6                	mov    %esi,%esi
+  80661b:	48 83 ec 08          	sub    $0x8,%rsp
+  80661f:	50                   	push   %rax
+  806620:	48 b8 0e 34 80 00 00 	movabs $0x80340e,%rax
+  806627:	00 00 00 
+  80662a:	ff d0                	call   *%rax
+  80662c:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  80662e:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  806632:	4c 89 e2             	mov    %r12,%rdx
+  806635:	48 89 de             	mov    %rbx,%rsi
+  806638:	48 b8 1b 64 80 00 00 	movabs $0x80641b,%rax
+  80663f:	00 00 00 
+  806642:	ff d0                	call   *%rax
+}
+  806644:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  806648:	5b                   	pop    %rbx
+  806649:	41 5c                	pop    %r12
+  80664b:	5d                   	pop    %rbp
+  80664c:	c3                   	ret
+
+000000000080664d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80664d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  806652:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  806659:	00 00 00 
+  80665c:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  806663:	48 01 ca             	add    %rcx,%rdx
+  806666:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  80666c:	39 fa                	cmp    %edi,%edx
+  80666e:	74 12                	je     806682 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  806670:	48 83 c0 01          	add    $0x1,%rax
+  806674:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  80667a:	75 e0                	jne    80665c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80667c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806681:	c3                   	ret
+            return envs[i].env_id;
+  806682:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  806689:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  806690:	00 00 00 
+  806693:	48 01 d0             	add    %rdx,%rax
+  806696:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80669c:	c3                   	ret
+  80669d:	0f 1f 00             	nopl   (%rax)
+
+00000000008066a0 <__rodata_start>:
+  8066a0:	77 00                	ja     8066a2 <__rodata_start+0x2>
+  8066a2:	72 62                	jb     806706 <__rodata_start+0x66>
+  8066a4:	00 77 62             	add    %dh,0x62(%rdi)
+  8066a7:	00 66 2e             	add    %ah,0x2e(%rsi)
+  8066aa:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8066b1:	00 
+  8066b2:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8066b9:	00 00 00 
+  8066bc:	0f 1f 40 00          	nopl   0x0(%rax)
+  8066c0:	b3 09                	mov    $0x9,%bl
+  8066c2:	80 00 00             	addb   $0x0,(%rax)
+  8066c5:	00 00                	add    %al,(%rax)
+  8066c7:	00 ed                	add    %ch,%ch
+  8066c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066ce:	00 00                	add    %al,(%rax)
+  8066d0:	ed                   	in     (%dx),%eax
+  8066d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066d6:	00 00                	add    %al,(%rax)
+  8066d8:	ed                   	in     (%dx),%eax
+  8066d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066de:	00 00                	add    %al,(%rax)
+  8066e0:	ed                   	in     (%dx),%eax
+  8066e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066e6:	00 00                	add    %al,(%rax)
+  8066e8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8066ed:	00 00                	add    %al,(%rax)
+  8066ef:	00 ed                	add    %ch,%ch
+  8066f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8066f6:	00 00                	add    %al,(%rax)
+  8066f8:	ed                   	in     (%dx),%eax
+  8066f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8066fe:	00 00                	add    %al,(%rax)
+  806700:	ed                   	in     (%dx),%eax
+  806701:	0d 80 00 00 00       	or     $0x80,%eax
+  806706:	00 00                	add    %al,(%rax)
+  806708:	ed                   	in     (%dx),%eax
+  806709:	0d 80 00 00 00       	or     $0x80,%eax
+  80670e:	00 00                	add    %al,(%rax)
+  806710:	ed                   	in     (%dx),%eax
+  806711:	0d 80 00 00 00       	or     $0x80,%eax
+  806716:	00 00                	add    %al,(%rax)
+  806718:	8c 0a                	mov    %cs,(%rdx)
+  80671a:	80 00 00             	addb   $0x0,(%rax)
+  80671d:	00 00                	add    %al,(%rax)
+  80671f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806726:	00 00                	add    %al,(%rax)
+  806728:	8c 0a                	mov    %cs,(%rdx)
+  80672a:	80 00 00             	addb   $0x0,(%rax)
+  80672d:	00 00                	add    %al,(%rax)
+  80672f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806736:	00 00                	add    %al,(%rax)
+  806738:	8c 0a                	mov    %cs,(%rdx)
+  80673a:	80 00 00             	addb   $0x0,(%rax)
+  80673d:	00 00                	add    %al,(%rax)
+  80673f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806746:	00 00                	add    %al,(%rax)
+  806748:	8c 0a                	mov    %cs,(%rdx)
+  80674a:	80 00 00             	addb   $0x0,(%rax)
+  80674d:	00 00                	add    %al,(%rax)
+  80674f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806756:	00 00                	add    %al,(%rax)
+  806758:	8c 0a                	mov    %cs,(%rdx)
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  806766:	00 00                	add    %al,(%rax)
+  806768:	ed                   	in     (%dx),%eax
+  806769:	0d 80 00 00 00       	or     $0x80,%eax
+  80676e:	00 00                	add    %al,(%rax)
+  806770:	ed                   	in     (%dx),%eax
+  806771:	0d 80 00 00 00       	or     $0x80,%eax
+  806776:	00 00                	add    %al,(%rax)
+  806778:	ed                   	in     (%dx),%eax
+  806779:	0d 80 00 00 00       	or     $0x80,%eax
+  80677e:	00 00                	add    %al,(%rax)
+  806780:	ed                   	in     (%dx),%eax
+  806781:	0d 80 00 00 00       	or     $0x80,%eax
+  806786:	00 00                	add    %al,(%rax)
+  806788:	ed                   	in     (%dx),%eax
+  806789:	0d 80 00 00 00       	or     $0x80,%eax
+  80678e:	00 00                	add    %al,(%rax)
+  806790:	ed                   	in     (%dx),%eax
+  806791:	0d 80 00 00 00       	or     $0x80,%eax
+  806796:	00 00                	add    %al,(%rax)
+  806798:	ed                   	in     (%dx),%eax
+  806799:	0d 80 00 00 00       	or     $0x80,%eax
+  80679e:	00 00                	add    %al,(%rax)
+  8067a0:	ed                   	in     (%dx),%eax
+  8067a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067a6:	00 00                	add    %al,(%rax)
+  8067a8:	ed                   	in     (%dx),%eax
+  8067a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067ae:	00 00                	add    %al,(%rax)
+  8067b0:	ed                   	in     (%dx),%eax
+  8067b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067b6:	00 00                	add    %al,(%rax)
+  8067b8:	ed                   	in     (%dx),%eax
+  8067b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067be:	00 00                	add    %al,(%rax)
+  8067c0:	ed                   	in     (%dx),%eax
+  8067c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067c6:	00 00                	add    %al,(%rax)
+  8067c8:	ed                   	in     (%dx),%eax
+  8067c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067ce:	00 00                	add    %al,(%rax)
+  8067d0:	ed                   	in     (%dx),%eax
+  8067d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067d6:	00 00                	add    %al,(%rax)
+  8067d8:	ed                   	in     (%dx),%eax
+  8067d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067de:	00 00                	add    %al,(%rax)
+  8067e0:	ed                   	in     (%dx),%eax
+  8067e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067e6:	00 00                	add    %al,(%rax)
+  8067e8:	ed                   	in     (%dx),%eax
+  8067e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067ee:	00 00                	add    %al,(%rax)
+  8067f0:	ed                   	in     (%dx),%eax
+  8067f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8067f6:	00 00                	add    %al,(%rax)
+  8067f8:	ed                   	in     (%dx),%eax
+  8067f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8067fe:	00 00                	add    %al,(%rax)
+  806800:	ed                   	in     (%dx),%eax
+  806801:	0d 80 00 00 00       	or     $0x80,%eax
+  806806:	00 00                	add    %al,(%rax)
+  806808:	ed                   	in     (%dx),%eax
+  806809:	0d 80 00 00 00       	or     $0x80,%eax
+  80680e:	00 00                	add    %al,(%rax)
+  806810:	ed                   	in     (%dx),%eax
+  806811:	0d 80 00 00 00       	or     $0x80,%eax
+  806816:	00 00                	add    %al,(%rax)
+  806818:	ed                   	in     (%dx),%eax
+  806819:	0d 80 00 00 00       	or     $0x80,%eax
+  80681e:	00 00                	add    %al,(%rax)
+  806820:	ed                   	in     (%dx),%eax
+  806821:	0d 80 00 00 00       	or     $0x80,%eax
+  806826:	00 00                	add    %al,(%rax)
+  806828:	ed                   	in     (%dx),%eax
+  806829:	0d 80 00 00 00       	or     $0x80,%eax
+  80682e:	00 00                	add    %al,(%rax)
+  806830:	ed                   	in     (%dx),%eax
+  806831:	0d 80 00 00 00       	or     $0x80,%eax
+  806836:	00 00                	add    %al,(%rax)
+  806838:	ed                   	in     (%dx),%eax
+  806839:	0d 80 00 00 00       	or     $0x80,%eax
+  80683e:	00 00                	add    %al,(%rax)
+  806840:	ed                   	in     (%dx),%eax
+  806841:	0d 80 00 00 00       	or     $0x80,%eax
+  806846:	00 00                	add    %al,(%rax)
+  806848:	ed                   	in     (%dx),%eax
+  806849:	0d 80 00 00 00       	or     $0x80,%eax
+  80684e:	00 00                	add    %al,(%rax)
+  806850:	ed                   	in     (%dx),%eax
+  806851:	0d 80 00 00 00       	or     $0x80,%eax
+  806856:	00 00                	add    %al,(%rax)
+  806858:	f4                   	hlt
+  806859:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80685f:	00 ed                	add    %ch,%ch
+  806861:	0d 80 00 00 00       	or     $0x80,%eax
+  806866:	00 00                	add    %al,(%rax)
+  806868:	ed                   	in     (%dx),%eax
+  806869:	0d 80 00 00 00       	or     $0x80,%eax
+  80686e:	00 00                	add    %al,(%rax)
+  806870:	2c 0b                	sub    $0xb,%al
+  806872:	80 00 00             	addb   $0x0,(%rax)
+  806875:	00 00                	add    %al,(%rax)
+  806877:	00 ed                	add    %ch,%ch
+  806879:	0d 80 00 00 00       	or     $0x80,%eax
+  80687e:	00 00                	add    %al,(%rax)
+  806880:	ed                   	in     (%dx),%eax
+  806881:	0d 80 00 00 00       	or     $0x80,%eax
+  806886:	00 00                	add    %al,(%rax)
+  806888:	ed                   	in     (%dx),%eax
+  806889:	0d 80 00 00 00       	or     $0x80,%eax
+  80688e:	00 00                	add    %al,(%rax)
+  806890:	ed                   	in     (%dx),%eax
+  806891:	0d 80 00 00 00       	or     $0x80,%eax
+  806896:	00 00                	add    %al,(%rax)
+  806898:	ed                   	in     (%dx),%eax
+  806899:	0d 80 00 00 00       	or     $0x80,%eax
+  80689e:	00 00                	add    %al,(%rax)
+  8068a0:	ed                   	in     (%dx),%eax
+  8068a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8068a6:	00 00                	add    %al,(%rax)
+  8068a8:	ed                   	in     (%dx),%eax
+  8068a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8068ae:	00 00                	add    %al,(%rax)
+  8068b0:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  8068b3:	00 00                	add    %al,(%rax)
+  8068b5:	00 00                	add    %al,(%rax)
+  8068b7:	00 cb                	add    %cl,%bl
+  8068b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8068be:	00 00                	add    %al,(%rax)
+  8068c0:	ed                   	in     (%dx),%eax
+  8068c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8068c6:	00 00                	add    %al,(%rax)
+  8068c8:	ed                   	in     (%dx),%eax
+  8068c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8068ce:	00 00                	add    %al,(%rax)
+  8068d0:	ed                   	in     (%dx),%eax
+  8068d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8068d6:	00 00                	add    %al,(%rax)
+  8068d8:	6a 0a                	push   $0xa
+  8068da:	80 00 00             	addb   $0x0,(%rax)
+  8068dd:	00 00                	add    %al,(%rax)
+  8068df:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8068e5:	00 00                	add    %al,(%rax)
+  8068e7:	00 ed                	add    %ch,%ch
+  8068e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8068ee:	00 00                	add    %al,(%rax)
+  8068f0:	ed                   	in     (%dx),%eax
+  8068f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8068f6:	00 00                	add    %al,(%rax)
+  8068f8:	3c 0a                	cmp    $0xa,%al
+  8068fa:	80 00 00             	addb   $0x0,(%rax)
+  8068fd:	00 00                	add    %al,(%rax)
+  8068ff:	00 ed                	add    %ch,%ch
+  806901:	0d 80 00 00 00       	or     $0x80,%eax
+  806906:	00 00                	add    %al,(%rax)
+  806908:	4f 0c 80             	rex.WRXB or $0x80,%al
+  80690b:	00 00                	add    %al,(%rax)
+  80690d:	00 00                	add    %al,(%rax)
+  80690f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  806915:	00 00                	add    %al,(%rax)
+  806917:	00 29                	add    %ch,(%rcx)
+  806919:	0c 80                	or     $0x80,%al
+  80691b:	00 00                	add    %al,(%rax)
+  80691d:	00 00                	add    %al,(%rax)
+  80691f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  806922:	80 00 00             	addb   $0x0,(%rax)
+  806925:	00 00                	add    %al,(%rax)
+  806927:	00 ed                	add    %ch,%ch
+  806929:	0d 80 00 00 00       	or     $0x80,%eax
+  80692e:	00 00                	add    %al,(%rax)
+  806930:	1a 0b                	sbb    (%rbx),%cl
+  806932:	80 00 00             	addb   $0x0,(%rax)
+  806935:	00 00                	add    %al,(%rax)
+  806937:	00 ed                	add    %ch,%ch
+  806939:	0d 80 00 00 00       	or     $0x80,%eax
+  80693e:	00 00                	add    %al,(%rax)
+  806940:	ce                   	(bad)
+  806941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  806947:	00 ed                	add    %ch,%ch
+  806949:	0d 80 00 00 00       	or     $0x80,%eax
+  80694e:	00 00                	add    %al,(%rax)
+  806950:	ed                   	in     (%dx),%eax
+  806951:	0d 80 00 00 00       	or     $0x80,%eax
+  806956:	00 00                	add    %al,(%rax)
+  806958:	f4                   	hlt
+  806959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80695f:	00 37                	add    %dh,(%rdi)
+  806961:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806967:	00 5f 12             	add    %bl,0x12(%rdi)
+  80696a:	80 00 00             	addb   $0x0,(%rax)
+  80696d:	00 00                	add    %al,(%rax)
+  80696f:	00 37                	add    %dh,(%rdi)
+  806971:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806977:	00 5f 12             	add    %bl,0x12(%rdi)
+  80697a:	80 00 00             	addb   $0x0,(%rax)
+  80697d:	00 00                	add    %al,(%rax)
+  80697f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806982:	80 00 00             	addb   $0x0,(%rax)
+  806985:	00 00                	add    %al,(%rax)
+  806987:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  80698b:	00 00                	add    %al,(%rax)
+  80698d:	00 00                	add    %al,(%rax)
+  80698f:	00 d2                	add    %dl,%dl
+  806991:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  806997:	00 d2                	add    %dl,%dl
+  806999:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80699f:	00 d2                	add    %dl,%dl
+  8069a1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069a7:	00 d2                	add    %dl,%dl
+  8069a9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069af:	00 d2                	add    %dl,%dl
+  8069b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069b7:	00 d2                	add    %dl,%dl
+  8069b9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069bf:	00 d2                	add    %dl,%dl
+  8069c1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069c7:	00 f6                	add    %dh,%dh
+  8069c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069cf:	00 f6                	add    %dh,%dh
+  8069d1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8069d7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069da:	80 00 00             	addb   $0x0,(%rax)
+  8069dd:	00 00                	add    %al,(%rax)
+  8069df:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069e2:	80 00 00             	addb   $0x0,(%rax)
+  8069e5:	00 00                	add    %al,(%rax)
+  8069e7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069ea:	80 00 00             	addb   $0x0,(%rax)
+  8069ed:	00 00                	add    %al,(%rax)
+  8069ef:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069f2:	80 00 00             	addb   $0x0,(%rax)
+  8069f5:	00 00                	add    %al,(%rax)
+  8069f7:	00 5f 12             	add    %bl,0x12(%rdi)
+  8069fa:	80 00 00             	addb   $0x0,(%rax)
+  8069fd:	00 00                	add    %al,(%rax)
+  8069ff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a02:	80 00 00             	addb   $0x0,(%rax)
+  806a05:	00 00                	add    %al,(%rax)
+  806a07:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a0a:	80 00 00             	addb   $0x0,(%rax)
+  806a0d:	00 00                	add    %al,(%rax)
+  806a0f:	00 22                	add    %ah,(%rdx)
+  806a11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a17:	00 22                	add    %ah,(%rdx)
+  806a19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a1f:	00 22                	add    %ah,(%rdx)
+  806a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a27:	00 22                	add    %ah,(%rdx)
+  806a29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a2f:	00 22                	add    %ah,(%rdx)
+  806a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a37:	00 22                	add    %ah,(%rdx)
+  806a39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a42:	80 00 00             	addb   $0x0,(%rax)
+  806a45:	00 00                	add    %al,(%rax)
+  806a47:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a4a:	80 00 00             	addb   $0x0,(%rax)
+  806a4d:	00 00                	add    %al,(%rax)
+  806a4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a52:	80 00 00             	addb   $0x0,(%rax)
+  806a55:	00 00                	add    %al,(%rax)
+  806a57:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a5a:	80 00 00             	addb   $0x0,(%rax)
+  806a5d:	00 00                	add    %al,(%rax)
+  806a5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a62:	80 00 00             	addb   $0x0,(%rax)
+  806a65:	00 00                	add    %al,(%rax)
+  806a67:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a6a:	80 00 00             	addb   $0x0,(%rax)
+  806a6d:	00 00                	add    %al,(%rax)
+  806a6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a72:	80 00 00             	addb   $0x0,(%rax)
+  806a75:	00 00                	add    %al,(%rax)
+  806a77:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a7a:	80 00 00             	addb   $0x0,(%rax)
+  806a7d:	00 00                	add    %al,(%rax)
+  806a7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a82:	80 00 00             	addb   $0x0,(%rax)
+  806a85:	00 00                	add    %al,(%rax)
+  806a87:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a8a:	80 00 00             	addb   $0x0,(%rax)
+  806a8d:	00 00                	add    %al,(%rax)
+  806a8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a92:	80 00 00             	addb   $0x0,(%rax)
+  806a95:	00 00                	add    %al,(%rax)
+  806a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  806a9a:	80 00 00             	addb   $0x0,(%rax)
+  806a9d:	00 00                	add    %al,(%rax)
+  806a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806aa2:	80 00 00             	addb   $0x0,(%rax)
+  806aa5:	00 00                	add    %al,(%rax)
+  806aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806aaa:	80 00 00             	addb   $0x0,(%rax)
+  806aad:	00 00                	add    %al,(%rax)
+  806aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ab2:	80 00 00             	addb   $0x0,(%rax)
+  806ab5:	00 00                	add    %al,(%rax)
+  806ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806aba:	80 00 00             	addb   $0x0,(%rax)
+  806abd:	00 00                	add    %al,(%rax)
+  806abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ac2:	80 00 00             	addb   $0x0,(%rax)
+  806ac5:	00 00                	add    %al,(%rax)
+  806ac7:	00 46 12             	add    %al,0x12(%rsi)
+  806aca:	80 00 00             	addb   $0x0,(%rax)
+  806acd:	00 00                	add    %al,(%rax)
+  806acf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ad2:	80 00 00             	addb   $0x0,(%rax)
+  806ad5:	00 00                	add    %al,(%rax)
+  806ad7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ada:	80 00 00             	addb   $0x0,(%rax)
+  806add:	00 00                	add    %al,(%rax)
+  806adf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ae2:	80 00 00             	addb   $0x0,(%rax)
+  806ae5:	00 00                	add    %al,(%rax)
+  806ae7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806aea:	80 00 00             	addb   $0x0,(%rax)
+  806aed:	00 00                	add    %al,(%rax)
+  806aef:	00 5f 12             	add    %bl,0x12(%rdi)
+  806af2:	80 00 00             	addb   $0x0,(%rax)
+  806af5:	00 00                	add    %al,(%rax)
+  806af7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806afa:	80 00 00             	addb   $0x0,(%rax)
+  806afd:	00 00                	add    %al,(%rax)
+  806aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b02:	80 00 00             	addb   $0x0,(%rax)
+  806b05:	00 00                	add    %al,(%rax)
+  806b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b0a:	80 00 00             	addb   $0x0,(%rax)
+  806b0d:	00 00                	add    %al,(%rax)
+  806b0f:	00 22                	add    %ah,(%rdx)
+  806b11:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b17:	00 22                	add    %ah,(%rdx)
+  806b19:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b1f:	00 22                	add    %ah,(%rdx)
+  806b21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b27:	00 22                	add    %ah,(%rdx)
+  806b29:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b2f:	00 22                	add    %ah,(%rdx)
+  806b31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b37:	00 22                	add    %ah,(%rdx)
+  806b39:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b42:	80 00 00             	addb   $0x0,(%rax)
+  806b45:	00 00                	add    %al,(%rax)
+  806b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b4a:	80 00 00             	addb   $0x0,(%rax)
+  806b4d:	00 00                	add    %al,(%rax)
+  806b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b52:	80 00 00             	addb   $0x0,(%rax)
+  806b55:	00 00                	add    %al,(%rax)
+  806b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b5a:	80 00 00             	addb   $0x0,(%rax)
+  806b5d:	00 00                	add    %al,(%rax)
+  806b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b62:	80 00 00             	addb   $0x0,(%rax)
+  806b65:	00 00                	add    %al,(%rax)
+  806b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b6a:	80 00 00             	addb   $0x0,(%rax)
+  806b6d:	00 00                	add    %al,(%rax)
+  806b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b72:	80 00 00             	addb   $0x0,(%rax)
+  806b75:	00 00                	add    %al,(%rax)
+  806b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b7a:	80 00 00             	addb   $0x0,(%rax)
+  806b7d:	00 00                	add    %al,(%rax)
+  806b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b82:	80 00 00             	addb   $0x0,(%rax)
+  806b85:	00 00                	add    %al,(%rax)
+  806b87:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b8a:	80 00 00             	addb   $0x0,(%rax)
+  806b8d:	00 00                	add    %al,(%rax)
+  806b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b92:	80 00 00             	addb   $0x0,(%rax)
+  806b95:	00 00                	add    %al,(%rax)
+  806b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  806b9a:	80 00 00             	addb   $0x0,(%rax)
+  806b9d:	00 00                	add    %al,(%rax)
+  806b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  806ba2:	80 00 00             	addb   $0x0,(%rax)
+  806ba5:	00 00                	add    %al,(%rax)
+  806ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806baa:	80 00 00             	addb   $0x0,(%rax)
+  806bad:	00 00                	add    %al,(%rax)
+  806baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806bb2:	80 00 00             	addb   $0x0,(%rax)
+  806bb5:	00 00                	add    %al,(%rax)
+  806bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  806bba:	80 00 00             	addb   $0x0,(%rax)
+  806bbd:	00 00                	add    %al,(%rax)
+  806bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  806bc2:	80 00 00             	addb   $0x0,(%rax)
+  806bc5:	00 00                	add    %al,(%rax)
+  806bc7:	00 46 12             	add    %al,0x12(%rsi)
+  806bca:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000806be0 <basefix.0>:
+  806be0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  806bf0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  806c00:	10 00 66 0f 1f 44 00 00 73 68 65 6c 6c 20 70 72     ..f..D..shell pr
+  806c10:	6f 64 75 63 65 64 20 69 6e 63 6f 72 72 65 63 74     oduced incorrect
+  806c20:	20 6f 75 74 70 75 74 2e 0a 00 00 00 00 00 00 00      output.........
+  806c30:	72 75 6e 6e 69 6e 67 20 73 68 20 2d 78 20 3c 20     running sh -x < 
+  806c40:	74 65 73 74 73 68 65 6c 6c 2e 73 68 20 7c 20 63     testshell.sh | c
+  806c50:	61 74 0a 00 00 00 00 00 6f 70 65 6e 20 74 65 73     at......open tes
+  806c60:	74 73 68 65 6c 6c 2e 6b 65 79 20 66 6f 72 20 72     tshell.key for r
+  806c70:	65 61 64 69 6e 67 3a 20 25 69 00 65 78 70 65 63     eading: %i.expec
+  806c80:	74 65 64 3a 0a 3d 3d 3d 0a 25 63 00 3d 3d 3d 0a     ted:.===.%c.===.
+  806c90:	67 6f 74 3a 0a 3d 3d 3d 0a 25 63 00 3d 3d 3d 0a     got:.===.%c.===.
+  806ca0:	00 74 65 73 74 73 68 65 6c 6c 2e 73 68 00 6f 70     .testshell.sh.op
+  806cb0:	65 6e 20 74 65 73 74 73 68 65 6c 6c 2e 73 68 3a     en testshell.sh:
+  806cc0:	20 25 69 00 75 73 65 72 2f 74 65 73 74 73 68 65      %i.user/testshe
+  806cd0:	6c 6c 2e 63 00 70 69 70 65 3a 20 25 69 00 2d 78     ll.c.pipe: %i.-x
+  806ce0:	00 2f 73 68 00 73 70 61 77 6e 3a 20 25 69 00 74     ./sh.spawn: %i.t
+  806cf0:	65 73 74 73 68 65 6c 6c 2e 6b 65 79 00 72 65 61     estshell.key.rea
+  806d00:	64 69 6e 67 20 74 65 73 74 73 68 65 6c 6c 2e 6f     ding testshell.o
+  806d10:	75 74 3a 20 25 69 00 72 65 61 64 69 6e 67 20 74     ut: %i.reading t
+  806d20:	65 73 74 73 68 65 6c 6c 2e 6b 65 79 3a 20 25 69     estshell.key: %i
+  806d30:	00 73 68 65 6c 6c 20 72 61 6e 20 63 6f 72 72 65     .shell ran corre
+  806d40:	63 74 6c 79 0a 00 3c 63 6f 6e 73 3e 00 63 6f 6e     ctly..<cons>.con
+  806d50:	73 00 3c 75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 40 00     s.<unknown>...@.
+  806d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  806d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  806d80:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  806d90:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  806da0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  806db0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  806dc0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  806dd0:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  806de0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  806df0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  806e00:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  806e10:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  806e20:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  806e30:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  806e40:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  806e50:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  806e60:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  806e70:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  806e80:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  806e90:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  806ea0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  806eb0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  806ec0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  806ed0:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  806ee0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  806ef0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  806f00:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  806f10:	64 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     d.f...........@.
+  806f20:	8a 20 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     . .......&......
+  806f30:	d1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  806f40:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  806f50:	e1 26 80 00 00 00 00 00 a9 20 80 00 00 00 00 00     .&....... ......
+  806f60:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  806f70:	9d 20 80 00 00 00 00 00 17 21 80 00 00 00 00 00     . .......!......
+  806f80:	e1 26 80 00 00 00 00 00 9d 20 80 00 00 00 00 00     .&....... ......
+  806f90:	e3 20 80 00 00 00 00 00 e3 20 80 00 00 00 00 00     . ....... ......
+  806fa0:	e3 20 80 00 00 00 00 00 e3 20 80 00 00 00 00 00     . ....... ......
+  806fb0:	e3 20 80 00 00 00 00 00 e3 20 80 00 00 00 00 00     . ....... ......
+  806fc0:	e3 20 80 00 00 00 00 00 e3 20 80 00 00 00 00 00     . ....... ......
+  806fd0:	e3 20 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     . .......&......
+  806fe0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  806ff0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807000:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807010:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807020:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807030:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807040:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807050:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807060:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807070:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807080:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807090:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8070a0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8070b0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8070c0:	e1 26 80 00 00 00 00 00 ff 25 80 00 00 00 00 00     .&.......%......
+  8070d0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8070e0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8070f0:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807100:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807110:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807120:	45 21 80 00 00 00 00 00 14 23 80 00 00 00 00 00     E!.......#......
+  807130:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807140:	e1 26 80 00 00 00 00 00 3a 21 80 00 00 00 00 00     .&......:!......
+  807150:	74 21 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     t!.......&......
+  807160:	e1 26 80 00 00 00 00 00 2f 21 80 00 00 00 00 00     .&....../!......
+  807170:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  807180:	bd 24 80 00 00 00 00 00 8c 25 80 00 00 00 00 00     .$.......%......
+  807190:	e1 26 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .&.......&......
+  8071a0:	0b 22 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .".......&......
+  8071b0:	e8 23 80 00 00 00 00 00 e1 26 80 00 00 00 00 00     .#.......&......
+  8071c0:	e1 26 80 00 00 00 00 00 ff 25 80 00 00 00 00 00     .&.......%......
+  8071d0:	e1 26 80 00 00 00 00 00 93 20 80 00 00 00 00 00     .&....... ......
+
+00000000008071e0 <error_string>:
+	...
+  8071e8:	b5 6d 80 00 00 00 00 00 c7 6d 80 00 00 00 00 00     .m.......m......
+  8071f8:	d7 6d 80 00 00 00 00 00 e9 6d 80 00 00 00 00 00     .m.......m......
+  807208:	f7 6d 80 00 00 00 00 00 0b 6e 80 00 00 00 00 00     .m.......n......
+  807218:	20 6e 80 00 00 00 00 00 33 6e 80 00 00 00 00 00      n......3n......
+  807228:	45 6e 80 00 00 00 00 00 59 6e 80 00 00 00 00 00     En......Yn......
+  807238:	69 6e 80 00 00 00 00 00 7c 6e 80 00 00 00 00 00     in......|n......
+  807248:	93 6e 80 00 00 00 00 00 a9 6e 80 00 00 00 00 00     .n.......n......
+  807258:	c1 6e 80 00 00 00 00 00 d9 6e 80 00 00 00 00 00     .n.......n......
+  807268:	e6 6e 80 00 00 00 00 00 80 72 80 00 00 00 00 00     .n.......r......
+  807278:	fa 6e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .n......file is 
+  807288:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  807298:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8072a8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8072b8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8072c8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 79 73     ib/syscall.c.sys
+  8072d8:	5f 65 78 6f 66 6f 72 6b 3a 20 25 69 00 6c 69 62     _exofork: %i.lib
+  8072e8:	2f 66 6f 72 6b 2e 63 00 73 79 73 5f 6d 61 70 5f     /fork.c.sys_map_
+  8072f8:	72 65 67 69 6f 6e 3a 20 25 69 00 73 79 73 5f 65     region: %i.sys_e
+  807308:	6e 76 5f 73 65 74 5f 73 74 61 74 75 73 3a 20 25     nv_set_status: %
+  807318:	69 00 73 66 6f 72 6b 28 29 20 69 73 20 6e 6f 74     i.sfork() is not
+  807328:	20 69 6d 70 6c 65 6d 65 6e 74 65 64 00 0f 1f 00      implemented....
+  807338:	73 79 73 5f 65 6e 76 5f 73 65 74 5f 70 67 66 61     sys_env_set_pgfa
+  807348:	75 6c 74 5f 75 70 63 61 6c 6c 3a 20 25 69 00 90     ult_upcall: %i..
+  807358:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  807368:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  807378:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  807388:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  807398:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8073a8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8073b8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8073c8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8073d8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008073e0 <devtab>:
+  8073e0:	80 80 80 00 00 00 00 00 c0 80 80 00 00 00 00 00     ................
+  8073f0:	40 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00     @...............
+  807400:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  807410:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  807420:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  807430:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  807440:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  807450:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  807460:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  807470:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  807480:	28 63 68 61 72 20 2a 29 73 74 61 63 6b 20 2b 20     (char *)stack + 
+  807490:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8074a0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  8074b0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8074c0:	72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f 73 70 61     ror: %i..lib/spa
+  8074d0:	77 6e 2e 63 00 45 6c 66 20 6d 61 67 69 63 20 25     wn.c.Elf magic %
+  8074e0:	30 38 78 20 77 61 6e 74 20 25 30 38 78 0a 00 3c     08x want %08x..<
+  8074f0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  807500:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  807510:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  807520:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  807530:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  807540:	63 00 66 75 6e 00 6c 69 62 2f 75 76 70 74 2e 63     c.fun.lib/uvpt.c
+  807550:	00 61 64 64 72 20 3d 3d 20 30 00 0f 1f 44 00 00     .addr == 0...D..
+  807560:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  807570:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  807580:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  807590:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8075a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8075b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8075c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8075d0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8075e0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8075f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807600:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807610:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807620:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807630:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807640:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807650:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807660:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807670:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807680:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807690:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8076b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8076c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8076d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8076e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8076f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807700:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807710:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807720:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8077b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8077c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8077d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8077e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8077f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8078b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8078c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8078d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8078e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8078f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8079b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8079c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8079d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8079e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8079f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  807fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  807fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  807fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  807fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  807ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
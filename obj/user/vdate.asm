@@ -0,0 +1,10538 @@
+
+obj/user/vdate:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 b0 25 80 00 00 	movabs $0x8025b0,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 31 24 80 00 00 	movabs $0x802431,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 71 35 80 00 00 	movabs $0x803571,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 71 35 80 00 00 	movabs $0x803571,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 47 3f 80 00 00 	movabs $0x803f47,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 47 3f 80 00 00 	movabs $0x803f47,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be f9 5f 80 00 00 	movabs $0x805ff9,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 10 5a 80 00 00 	movabs $0x805a10,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 12 5a 80 00 00 	movabs $0x805a12,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 15 5a 80 00 00 	movabs $0x805a15,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 d0 23 80 00 00 	movabs $0x8023d0,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 59 4d 80 00 00 	movabs $0x804d59,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 30 50 80 00 00 	movabs $0x805030,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 5b 36 80 00 00 	movabs $0x80365b,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 24 37 80 00 00 	movabs $0x803724,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 2a 36 80 00 00 	movabs $0x80362a,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 42 34 80 00 00 	movabs $0x803442,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 71 35 80 00 00 	movabs $0x803571,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb 7d 25 80 00 00 	movabs $0x80257d,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 20 5a 80 00 00 	movabs $0x805a20,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 7d 25 80 00 00 	movabs $0x80257d,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 b0 25 80 00 00 	movabs $0x8025b0,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc 7d 25 80 00 00 	movabs $0x80257d,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be c0 5c 80 00 00 	movabs $0x805cc0,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf 7d 25 80 00 00 	movabs $0x80257d,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf 7d 25 80 00 00 	movabs $0x80257d,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 40 5f 80 00 00 	movabs $0x805f40,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 40 5f 80 00 00 	movabs $0x805f40,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 5f 03 00 00       	call   80185e <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	53                   	push   %rbx
+  801506:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = vsys_gettime();
+  80150a:	48 b8 b3 49 80 00 00 	movabs $0x8049b3,%rax
+  801511:	00 00 00 
+  801514:	ff d0                	call   *%rax
+  801516:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  801519:	48 63 f0             	movslq %eax,%rsi
+  80151c:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  801523:	48 c1 fe 35          	sar    $0x35,%rsi
+  801527:	c1 f8 1f             	sar    $0x1f,%eax
+  80152a:	29 c6                	sub    %eax,%esi
+  80152c:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  801532:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  801538:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  80153e:	89 f9                	mov    %edi,%ecx
+  801540:	83 c7 01             	add    $0x1,%edi
+  801543:	8d 41 03             	lea    0x3(%rcx),%eax
+  801546:	85 c9                	test   %ecx,%ecx
+  801548:	0f 49 c1             	cmovns %ecx,%eax
+  80154b:	c1 f8 02             	sar    $0x2,%eax
+  80154e:	01 f0                	add    %esi,%eax
+  801550:	48 63 d1             	movslq %ecx,%rdx
+  801553:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80155a:	48 89 d3             	mov    %rdx,%rbx
+  80155d:	48 c1 fb 25          	sar    $0x25,%rbx
+  801561:	49 89 db             	mov    %rbx,%r11
+  801564:	41 89 c9             	mov    %ecx,%r9d
+  801567:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80156b:	45 89 ca             	mov    %r9d,%r10d
+  80156e:	41 29 da             	sub    %ebx,%r10d
+  801571:	44 01 d0             	add    %r10d,%eax
+  801574:	48 c1 fa 27          	sar    $0x27,%rdx
+  801578:	44 29 ca             	sub    %r9d,%edx
+  80157b:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  801582:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  801588:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  80158e:	41 39 c0             	cmp    %eax,%r8d
+  801591:	7d ab                	jge    80153e <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  801593:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  801599:	8d 41 02             	lea    0x2(%rcx),%eax
+  80159c:	89 ca                	mov    %ecx,%edx
+  80159e:	83 ea 01             	sub    $0x1,%edx
+  8015a1:	0f 49 c2             	cmovns %edx,%eax
+  8015a4:	c1 f8 02             	sar    $0x2,%eax
+  8015a7:	01 c6                	add    %eax,%esi
+  8015a9:	48 63 c2             	movslq %edx,%rax
+  8015ac:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8015b3:	48 89 c3             	mov    %rax,%rbx
+  8015b6:	48 c1 fb 25          	sar    $0x25,%rbx
+  8015ba:	c1 fa 1f             	sar    $0x1f,%edx
+  8015bd:	89 d7                	mov    %edx,%edi
+  8015bf:	29 df                	sub    %ebx,%edi
+  8015c1:	01 fe                	add    %edi,%esi
+  8015c3:	48 c1 f8 27          	sar    $0x27,%rax
+  8015c7:	29 d0                	sub    %edx,%eax
+  8015c9:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8015d0:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8015d6:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8015d9:	4c 63 c9             	movslq %ecx,%r9
+  8015dc:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  8015e3:	4c 89 c8             	mov    %r9,%rax
+  8015e6:	48 c1 f8 27          	sar    $0x27,%rax
+  8015ea:	49 89 c2             	mov    %rax,%r10
+  8015ed:	89 c8                	mov    %ecx,%eax
+  8015ef:	c1 f8 1f             	sar    $0x1f,%eax
+  8015f2:	41 29 c2             	sub    %eax,%r10d
+  8015f5:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  8015fc:	41 89 ca             	mov    %ecx,%r10d
+  8015ff:	41 29 d2             	sub    %edx,%r10d
+  801602:	4d 89 d9             	mov    %r11,%r9
+  801605:	41 29 c1             	sub    %eax,%r9d
+  801608:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  80160c:	41 89 c9             	mov    %ecx,%r9d
+  80160f:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  801612:	48 63 d6             	movslq %esi,%rdx
+  801615:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  80161c:	48 c1 ea 20          	shr    $0x20,%rdx
+  801620:	01 f2                	add    %esi,%edx
+  801622:	c1 fa 15             	sar    $0x15,%edx
+  801625:	89 f0                	mov    %esi,%eax
+  801627:	c1 f8 1f             	sar    $0x1f,%eax
+  80162a:	29 c2                	sub    %eax,%edx
+  80162c:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  80162f:	41 89 cb             	mov    %ecx,%r11d
+  801632:	41 83 e3 03          	and    $0x3,%r11d
+  801636:	44 89 cb             	mov    %r9d,%ebx
+  801639:	eb 21                	jmp    80165c <umain+0x15b>
+  80163b:	85 d2                	test   %edx,%edx
+  80163d:	40 0f 9f c7          	setg   %dil
+  801641:	40 0f b6 ff          	movzbl %dil,%edi
+  801645:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  801649:	01 f8                	add    %edi,%eax
+  80164b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  801651:	39 c6                	cmp    %eax,%esi
+  801653:	0f 8c 89 00 00 00    	jl     8016e2 <umain+0x1e1>
+  801659:	4c 89 c2             	mov    %r8,%rdx
+  80165c:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  801663:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80166a:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  801671:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  801678:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80167f:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  801686:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  80168d:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  801694:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  80169b:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8016a2:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8016a9:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8016b0:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8016b7:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8016bb:	45 85 d2             	test   %r10d,%r10d
+  8016be:	0f 84 77 ff ff ff    	je     80163b <umain+0x13a>
+  8016c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c9:	45 85 db             	test   %r11d,%r11d
+  8016cc:	0f 85 73 ff ff ff    	jne    801645 <umain+0x144>
+  8016d2:	89 df                	mov    %ebx,%edi
+  8016d4:	45 85 c9             	test   %r9d,%r9d
+  8016d7:	0f 84 68 ff ff ff    	je     801645 <umain+0x144>
+  8016dd:	e9 59 ff ff ff       	jmp    80163b <umain+0x13a>
+  8016e2:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  8016e4:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  8016eb:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  8016f2:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  8016f9:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  801700:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  801707:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  80170e:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  801715:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  80171c:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  801723:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80172a:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  801731:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  801738:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  80173f:	48 63 c2             	movslq %edx,%rax
+  801742:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  801746:	45 85 d2             	test   %r10d,%r10d
+  801749:	74 0e                	je     801759 <umain+0x258>
+  80174b:	f6 c1 03             	test   $0x3,%cl
+  80174e:	0f 85 ff 00 00 00    	jne    801853 <umain+0x352>
+  801754:	45 85 c9             	test   %r9d,%r9d
+  801757:	74 0b                	je     801764 <umain+0x263>
+  801759:	83 ff 01             	cmp    $0x1,%edi
+  80175c:	41 0f 9f c1          	setg   %r9b
+  801760:	45 0f b6 c9          	movzbl %r9b,%r9d
+  801764:	44 01 c8             	add    %r9d,%eax
+  801767:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  80176d:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  80176f:	48 63 c6             	movslq %esi,%rax
+  801772:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  801779:	48 c1 e8 20          	shr    $0x20,%rax
+  80177d:	01 f0                	add    %esi,%eax
+  80177f:	c1 f8 10             	sar    $0x10,%eax
+  801782:	41 89 f3             	mov    %esi,%r11d
+  801785:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  801789:	41 89 c2             	mov    %eax,%r10d
+  80178c:	45 29 da             	sub    %r11d,%r10d
+  80178f:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  801796:	29 fe                	sub    %edi,%esi
+  801798:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  80179b:	48 63 f6             	movslq %esi,%rsi
+  80179e:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8017a5:	48 c1 ee 20          	shr    $0x20,%rsi
+  8017a9:	44 01 d6             	add    %r10d,%esi
+  8017ac:	c1 fe 0b             	sar    $0xb,%esi
+  8017af:	41 89 f0             	mov    %esi,%r8d
+  8017b2:	45 89 d1             	mov    %r10d,%r9d
+  8017b5:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8017b9:	89 f7                	mov    %esi,%edi
+  8017bb:	44 29 cf             	sub    %r9d,%edi
+  8017be:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8017c4:	44 89 d7             	mov    %r10d,%edi
+  8017c7:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8017c9:	44 29 d8             	sub    %r11d,%eax
+  8017cc:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8017ce:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8017d2:	48 63 c7             	movslq %edi,%rax
+  8017d5:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  8017dc:	48 c1 e8 20          	shr    $0x20,%rax
+  8017e0:	01 f8                	add    %edi,%eax
+  8017e2:	c1 f8 05             	sar    $0x5,%eax
+  8017e5:	41 89 fa             	mov    %edi,%r10d
+  8017e8:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  8017ec:	44 29 d0             	sub    %r10d,%eax
+  8017ef:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  8017f3:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8017f6:	57                   	push   %rdi
+  8017f7:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  8017f8:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8017fb:	41 50                	push   %r8
+  8017fd:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  801801:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  801805:	48 ba 62 5f 80 00 00 	movabs $0x805f62,%rdx
+  80180c:	00 00 00 
+  80180f:	be 14 00 00 00       	mov    $0x14,%esi
+  801814:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  801818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181d:	49 ba 93 22 80 00 00 	movabs $0x802293,%r10
+  801824:	00 00 00 
+  801827:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("VDATE: %s\n", time);
+  80182a:	48 83 c4 20          	add    $0x20,%rsp
+  80182e:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  801832:	48 bf 80 5f 80 00 00 	movabs $0x805f80,%rdi
+  801839:	00 00 00 
+  80183c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801841:	48 ba d7 19 80 00 00 	movabs $0x8019d7,%rdx
+  801848:	00 00 00 
+  80184b:	ff d2                	call   *%rdx
+}
+  80184d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801851:	c9                   	leave
+  801852:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  801853:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801859:	e9 06 ff ff ff       	jmp    801764 <umain+0x263>
+
+000000000080185e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80185e:	55                   	push   %rbp
+  80185f:	48 89 e5             	mov    %rsp,%rbp
+  801862:	41 56                	push   %r14
+  801864:	41 55                	push   %r13
+  801866:	41 54                	push   %r12
+  801868:	53                   	push   %rbx
+  801869:	41 89 fd             	mov    %edi,%r13d
+  80186c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80186f:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  801876:	00 00 00 
+  801879:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  801880:	00 00 00 
+  801883:	48 39 c2             	cmp    %rax,%rdx
+  801886:	73 17                	jae    80189f <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  801888:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80188b:	49 89 c4             	mov    %rax,%r12
+  80188e:	48 83 c3 08          	add    $0x8,%rbx
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	ff 53 f8             	call   *-0x8(%rbx)
+  80189a:	4c 39 e3             	cmp    %r12,%rbx
+  80189d:	72 ef                	jb     80188e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  80189f:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  8018a6:	00 00 00 
+  8018a9:	ff d0                	call   *%rax
+  8018ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018b0:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8018b7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018be:	00 00 00 
+  8018c1:	48 01 d0             	add    %rdx,%rax
+  8018c4:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  8018cb:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8018ce:	45 85 ed             	test   %r13d,%r13d
+  8018d1:	7e 0d                	jle    8018e0 <libmain+0x82>
+  8018d3:	49 8b 06             	mov    (%r14),%rax
+  8018d6:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  8018dd:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8018e0:	4c 89 f6             	mov    %r14,%rsi
+  8018e3:	44 89 ef             	mov    %r13d,%edi
+  8018e6:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  8018ed:	00 00 00 
+  8018f0:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8018f2:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  8018f9:	00 00 00 
+  8018fc:	ff d0                	call   *%rax
+#endif
+}
+  8018fe:	5b                   	pop    %rbx
+  8018ff:	41 5c                	pop    %r12
+  801901:	41 5d                	pop    %r13
+  801903:	41 5e                	pop    %r14
+  801905:	5d                   	pop    %rbp
+  801906:	c3                   	ret
+
+0000000000801907 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  80190b:	48 b8 f7 32 80 00 00 	movabs $0x8032f7,%rax
+  801912:	00 00 00 
+  801915:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  801917:	bf 00 00 00 00       	mov    $0x0,%edi
+  80191c:	48 b8 2a 29 80 00 00 	movabs $0x80292a,%rax
+  801923:	00 00 00 
+  801926:	ff d0                	call   *%rax
+}
+  801928:	5d                   	pop    %rbp
+  801929:	c3                   	ret
+
+000000000080192a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80192a:	55                   	push   %rbp
+  80192b:	48 89 e5             	mov    %rsp,%rbp
+  80192e:	53                   	push   %rbx
+  80192f:	48 83 ec 08          	sub    $0x8,%rsp
+  801933:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  801936:	8b 06                	mov    (%rsi),%eax
+  801938:	8d 50 01             	lea    0x1(%rax),%edx
+  80193b:	89 16                	mov    %edx,(%rsi)
+  80193d:	48 98                	cltq
+  80193f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  801944:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80194a:	74 0a                	je     801956 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80194c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  801950:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801954:	c9                   	leave
+  801955:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  801956:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80195a:	be ff 00 00 00       	mov    $0xff,%esi
+  80195f:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  801966:	00 00 00 
+  801969:	ff d0                	call   *%rax
+        state->offset = 0;
+  80196b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  801971:	eb d9                	jmp    80194c <putch+0x22>
+
+0000000000801973 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801973:	55                   	push   %rbp
+  801974:	48 89 e5             	mov    %rsp,%rbp
+  801977:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80197e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  801981:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  801988:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80198d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801992:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  801995:	48 89 f1             	mov    %rsi,%rcx
+  801998:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80199f:	48 bf 2a 19 80 00 00 	movabs $0x80192a,%rdi
+  8019a6:	00 00 00 
+  8019a9:	48 b8 27 1b 80 00 00 	movabs $0x801b27,%rax
+  8019b0:	00 00 00 
+  8019b3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8019b5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8019bc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8019c3:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8019cf:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8019d5:	c9                   	leave
+  8019d6:	c3                   	ret
+
+00000000008019d7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8019d7:	55                   	push   %rbp
+  8019d8:	48 89 e5             	mov    %rsp,%rbp
+  8019db:	48 83 ec 50          	sub    $0x50,%rsp
+  8019df:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8019e3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8019e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8019eb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8019ef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8019f3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8019fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a02:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801a06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801a0a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801a0e:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  801a15:	00 00 00 
+  801a18:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801a1a:	c9                   	leave
+  801a1b:	c3                   	ret
+
+0000000000801a1c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801a1c:	55                   	push   %rbp
+  801a1d:	48 89 e5             	mov    %rsp,%rbp
+  801a20:	41 57                	push   %r15
+  801a22:	41 56                	push   %r14
+  801a24:	41 55                	push   %r13
+  801a26:	41 54                	push   %r12
+  801a28:	53                   	push   %rbx
+  801a29:	48 83 ec 18          	sub    $0x18,%rsp
+  801a2d:	49 89 fc             	mov    %rdi,%r12
+  801a30:	49 89 f5             	mov    %rsi,%r13
+  801a33:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a37:	8b 45 10             	mov    0x10(%rbp),%eax
+  801a3a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801a3d:	41 89 cf             	mov    %ecx,%r15d
+  801a40:	4c 39 fa             	cmp    %r15,%rdx
+  801a43:	73 5b                	jae    801aa0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  801a45:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  801a49:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801a4d:	85 db                	test   %ebx,%ebx
+  801a4f:	7e 0e                	jle    801a5f <print_num+0x43>
+            putch(padc, put_arg);
+  801a51:	4c 89 ee             	mov    %r13,%rsi
+  801a54:	44 89 f7             	mov    %r14d,%edi
+  801a57:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  801a5a:	83 eb 01             	sub    $0x1,%ebx
+  801a5d:	75 f2                	jne    801a51 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  801a5f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  801a63:	48 b9 a6 5f 80 00 00 	movabs $0x805fa6,%rcx
+  801a6a:	00 00 00 
+  801a6d:	48 b8 95 5f 80 00 00 	movabs $0x805f95,%rax
+  801a74:	00 00 00 
+  801a77:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  801a7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a84:	49 f7 f7             	div    %r15
+  801a87:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  801a8b:	4c 89 ee             	mov    %r13,%rsi
+  801a8e:	41 ff d4             	call   *%r12
+}
+  801a91:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801a95:	5b                   	pop    %rbx
+  801a96:	41 5c                	pop    %r12
+  801a98:	41 5d                	pop    %r13
+  801a9a:	41 5e                	pop    %r14
+  801a9c:	41 5f                	pop    %r15
+  801a9e:	5d                   	pop    %rbp
+  801a9f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801aa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa9:	49 f7 f7             	div    %r15
+  801aac:	48 83 ec 08          	sub    $0x8,%rsp
+  801ab0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  801ab4:	52                   	push   %rdx
+  801ab5:	45 0f be c9          	movsbl %r9b,%r9d
+  801ab9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801abd:	48 89 c2             	mov    %rax,%rdx
+  801ac0:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	48 83 c4 10          	add    $0x10,%rsp
+  801ad0:	eb 8d                	jmp    801a5f <print_num+0x43>
+
+0000000000801ad2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801ad2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801ad6:	48 8b 06             	mov    (%rsi),%rax
+  801ad9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801add:	73 0a                	jae    801ae9 <sprintputch+0x17>
+        *state->start++ = ch;
+  801adf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ae3:	48 89 16             	mov    %rdx,(%rsi)
+  801ae6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801ae9:	c3                   	ret
+
+0000000000801aea <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	48 83 ec 50          	sub    $0x50,%rsp
+  801af2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801af6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801afa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801afe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801b05:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b0d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801b11:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801b15:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801b19:	48 b8 27 1b 80 00 00 	movabs $0x801b27,%rax
+  801b20:	00 00 00 
+  801b23:	ff d0                	call   *%rax
+}
+  801b25:	c9                   	leave
+  801b26:	c3                   	ret
+
+0000000000801b27 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801b27:	55                   	push   %rbp
+  801b28:	48 89 e5             	mov    %rsp,%rbp
+  801b2b:	41 57                	push   %r15
+  801b2d:	41 56                	push   %r14
+  801b2f:	41 55                	push   %r13
+  801b31:	41 54                	push   %r12
+  801b33:	53                   	push   %rbx
+  801b34:	48 83 ec 38          	sub    $0x38,%rsp
+  801b38:	49 89 fe             	mov    %rdi,%r14
+  801b3b:	49 89 f5             	mov    %rsi,%r13
+  801b3e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801b41:	48 8b 01             	mov    (%rcx),%rax
+  801b44:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801b48:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801b4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b50:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801b54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  801b58:	eb 0d                	jmp    801b67 <vprintfmt+0x40>
+            putch(ch, put_arg);
+  801b5a:	40 0f b6 ff          	movzbl %dil,%edi
+  801b5e:	4c 89 ee             	mov    %r13,%rsi
+  801b61:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  801b64:	4c 89 e3             	mov    %r12,%rbx
+  801b67:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801b6b:	0f b6 3b             	movzbl (%rbx),%edi
+  801b6e:	40 80 ff 25          	cmp    $0x25,%dil
+  801b72:	74 14                	je     801b88 <vprintfmt+0x61>
+            if (!ch) return;
+  801b74:	40 84 ff             	test   %dil,%dil
+  801b77:	75 e1                	jne    801b5a <vprintfmt+0x33>
+}
+  801b79:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801b7d:	5b                   	pop    %rbx
+  801b7e:	41 5c                	pop    %r12
+  801b80:	41 5d                	pop    %r13
+  801b82:	41 5e                	pop    %r14
+  801b84:	41 5f                	pop    %r15
+  801b86:	5d                   	pop    %rbp
+  801b87:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  801b88:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  801b91:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  801b96:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801b9c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  801ba3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801ba7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801bac:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801bb1:	88 45 a0             	mov    %al,-0x60(%rbp)
+  801bb4:	83 e8 23             	sub    $0x23,%eax
+  801bb7:	3c 57                	cmp    $0x57,%al
+  801bb9:	0f 87 67 06 00 00    	ja     802226 <vprintfmt+0x6ff>
+  801bbf:	0f b6 c0             	movzbl %al,%eax
+  801bc2:	48 b9 40 61 80 00 00 	movabs $0x806140,%rcx
+  801bc9:	00 00 00 
+  801bcc:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801bcf:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801bd2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801bd6:	eb cf                	jmp    801ba7 <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  801bd8:	49 89 dc             	mov    %rbx,%r12
+  801bdb:	be 01 00 00 00       	mov    $0x1,%esi
+  801be0:	eb c5                	jmp    801ba7 <vprintfmt+0x80>
+            padc = ch;
+  801be2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801be6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801be9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801bec:	eb b9                	jmp    801ba7 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801bee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bf1:	83 f8 2f             	cmp    $0x2f,%eax
+  801bf4:	77 24                	ja     801c1a <vprintfmt+0xf3>
+  801bf6:	89 c1                	mov    %eax,%ecx
+  801bf8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801bfc:	83 c0 08             	add    $0x8,%eax
+  801bff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c02:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801c05:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801c08:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801c0c:	79 99                	jns    801ba7 <vprintfmt+0x80>
+                width = precision;
+  801c0e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801c12:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801c18:	eb 8d                	jmp    801ba7 <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801c1a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801c1e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801c22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c26:	eb da                	jmp    801c02 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  801c28:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801c2d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c31:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801c37:	3c 39                	cmp    $0x39,%al
+  801c39:	77 1c                	ja     801c57 <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  801c3b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801c3f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801c43:	0f b6 c0             	movzbl %al,%eax
+  801c46:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801c4b:	0f b6 03             	movzbl (%rbx),%eax
+  801c4e:	3c 39                	cmp    $0x39,%al
+  801c50:	76 e9                	jbe    801c3b <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  801c52:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801c55:	eb b1                	jmp    801c08 <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  801c57:	49 89 dc             	mov    %rbx,%r12
+  801c5a:	eb ac                	jmp    801c08 <vprintfmt+0xe1>
+            width = MAX(0, width);
+  801c5c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801c5f:	85 c9                	test   %ecx,%ecx
+  801c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c66:	0f 49 c1             	cmovns %ecx,%eax
+  801c69:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  801c6c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c6f:	e9 33 ff ff ff       	jmp    801ba7 <vprintfmt+0x80>
+            lflag++;
+  801c74:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c77:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c7a:	e9 28 ff ff ff       	jmp    801ba7 <vprintfmt+0x80>
+            lflag--;
+  801c7f:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801c82:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801c85:	e9 1d ff ff ff       	jmp    801ba7 <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  801c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  801c90:	77 19                	ja     801cab <vprintfmt+0x184>
+  801c92:	89 c2                	mov    %eax,%edx
+  801c94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c98:	83 c0 08             	add    $0x8,%eax
+  801c9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c9e:	8b 3a                	mov    (%rdx),%edi
+  801ca0:	4c 89 ee             	mov    %r13,%rsi
+  801ca3:	41 ff d6             	call   *%r14
+            break;
+  801ca6:	e9 bc fe ff ff       	jmp    801b67 <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801cab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801caf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cb7:	eb e5                	jmp    801c9e <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801cb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cbc:	83 f8 2f             	cmp    $0x2f,%eax
+  801cbf:	77 5a                	ja     801d1b <vprintfmt+0x1f4>
+  801cc1:	89 c2                	mov    %eax,%edx
+  801cc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cc7:	83 c0 08             	add    $0x8,%eax
+  801cca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801ccd:	8b 02                	mov    (%rdx),%eax
+  801ccf:	89 c1                	mov    %eax,%ecx
+  801cd1:	f7 d9                	neg    %ecx
+  801cd3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801cd6:	83 f9 13             	cmp    $0x13,%ecx
+  801cd9:	7f 4e                	jg     801d29 <vprintfmt+0x202>
+  801cdb:	48 63 c1             	movslq %ecx,%rax
+  801cde:	48 ba 00 64 80 00 00 	movabs $0x806400,%rdx
+  801ce5:	00 00 00 
+  801ce8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801cec:	48 85 c0             	test   %rax,%rax
+  801cef:	74 38                	je     801d29 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801cf1:	48 89 c1             	mov    %rax,%rcx
+  801cf4:	48 ba c8 65 80 00 00 	movabs $0x8065c8,%rdx
+  801cfb:	00 00 00 
+  801cfe:	4c 89 ee             	mov    %r13,%rsi
+  801d01:	4c 89 f7             	mov    %r14,%rdi
+  801d04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d09:	49 b8 ea 1a 80 00 00 	movabs $0x801aea,%r8
+  801d10:	00 00 00 
+  801d13:	41 ff d0             	call   *%r8
+  801d16:	e9 4c fe ff ff       	jmp    801b67 <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801d1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d27:	eb a4                	jmp    801ccd <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801d29:	48 ba be 5f 80 00 00 	movabs $0x805fbe,%rdx
+  801d30:	00 00 00 
+  801d33:	4c 89 ee             	mov    %r13,%rsi
+  801d36:	4c 89 f7             	mov    %r14,%rdi
+  801d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3e:	49 b8 ea 1a 80 00 00 	movabs $0x801aea,%r8
+  801d45:	00 00 00 
+  801d48:	41 ff d0             	call   *%r8
+  801d4b:	e9 17 fe ff ff       	jmp    801b67 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801d50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d53:	83 f8 2f             	cmp    $0x2f,%eax
+  801d56:	77 6c                	ja     801dc4 <vprintfmt+0x29d>
+  801d58:	89 c2                	mov    %eax,%edx
+  801d5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d5e:	83 c0 08             	add    $0x8,%eax
+  801d61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d64:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801d67:	48 85 f6             	test   %rsi,%rsi
+  801d6a:	48 b8 b7 5f 80 00 00 	movabs $0x805fb7,%rax
+  801d71:	00 00 00 
+  801d74:	48 0f 45 c6          	cmovne %rsi,%rax
+  801d78:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801d7c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801d80:	7e 06                	jle    801d88 <vprintfmt+0x261>
+  801d82:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801d86:	75 4a                	jne    801dd2 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801d88:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801d8c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801d90:	0f b6 00             	movzbl (%rax),%eax
+  801d93:	84 c0                	test   %al,%al
+  801d95:	0f 85 9a 00 00 00    	jne    801e35 <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801d9b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801d9e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801da2:	85 c0                	test   %eax,%eax
+  801da4:	0f 8e bd fd ff ff    	jle    801b67 <vprintfmt+0x40>
+  801daa:	4c 89 ee             	mov    %r13,%rsi
+  801dad:	bf 20 00 00 00       	mov    $0x20,%edi
+  801db2:	41 ff d6             	call   *%r14
+  801db5:	41 83 ec 01          	sub    $0x1,%r12d
+  801db9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801dbd:	75 eb                	jne    801daa <vprintfmt+0x283>
+  801dbf:	e9 a3 fd ff ff       	jmp    801b67 <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801dc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dd0:	eb 92                	jmp    801d64 <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801dd2:	49 63 f7             	movslq %r15d,%rsi
+  801dd5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801dd9:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	48 89 c2             	mov    %rax,%rdx
+  801de8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801deb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801ded:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801df0:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	7e 91                	jle    801d88 <vprintfmt+0x261>
+  801df7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801dfc:	4c 89 ee             	mov    %r13,%rsi
+  801dff:	44 89 e7             	mov    %r12d,%edi
+  801e02:	41 ff d6             	call   *%r14
+  801e05:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e09:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801e0c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801e0f:	75 eb                	jne    801dfc <vprintfmt+0x2d5>
+  801e11:	e9 72 ff ff ff       	jmp    801d88 <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e16:	0f b6 f8             	movzbl %al,%edi
+  801e19:	4c 89 ee             	mov    %r13,%rsi
+  801e1c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801e1f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801e23:	49 83 c4 01          	add    $0x1,%r12
+  801e27:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801e2d:	84 c0                	test   %al,%al
+  801e2f:	0f 84 66 ff ff ff    	je     801d9b <vprintfmt+0x274>
+  801e35:	45 85 ff             	test   %r15d,%r15d
+  801e38:	78 0a                	js     801e44 <vprintfmt+0x31d>
+  801e3a:	41 83 ef 01          	sub    $0x1,%r15d
+  801e3e:	0f 88 57 ff ff ff    	js     801d9b <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801e44:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801e48:	74 cc                	je     801e16 <vprintfmt+0x2ef>
+  801e4a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801e4d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801e52:	80 fa 5e             	cmp    $0x5e,%dl
+  801e55:	77 c2                	ja     801e19 <vprintfmt+0x2f2>
+  801e57:	eb bd                	jmp    801e16 <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801e59:	40 84 f6             	test   %sil,%sil
+  801e5c:	75 26                	jne    801e84 <vprintfmt+0x35d>
+    switch (lflag) {
+  801e5e:	85 d2                	test   %edx,%edx
+  801e60:	74 59                	je     801ebb <vprintfmt+0x394>
+  801e62:	83 fa 01             	cmp    $0x1,%edx
+  801e65:	74 7b                	je     801ee2 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801e67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e6a:	83 f8 2f             	cmp    $0x2f,%eax
+  801e6d:	0f 87 96 00 00 00    	ja     801f09 <vprintfmt+0x3e2>
+  801e73:	89 c2                	mov    %eax,%edx
+  801e75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e79:	83 c0 08             	add    $0x8,%eax
+  801e7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e7f:	4c 8b 22             	mov    (%rdx),%r12
+  801e82:	eb 17                	jmp    801e9b <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801e84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e87:	83 f8 2f             	cmp    $0x2f,%eax
+  801e8a:	77 21                	ja     801ead <vprintfmt+0x386>
+  801e8c:	89 c2                	mov    %eax,%edx
+  801e8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e92:	83 c0 08             	add    $0x8,%eax
+  801e95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e98:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801e9b:	4d 85 e4             	test   %r12,%r12
+  801e9e:	78 7a                	js     801f1a <vprintfmt+0x3f3>
+            num = i;
+  801ea0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801ea3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801ea8:	e9 56 02 00 00       	jmp    802103 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801ead:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eb1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801eb5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801eb9:	eb dd                	jmp    801e98 <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801ebb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebe:	83 f8 2f             	cmp    $0x2f,%eax
+  801ec1:	77 11                	ja     801ed4 <vprintfmt+0x3ad>
+  801ec3:	89 c2                	mov    %eax,%edx
+  801ec5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ec9:	83 c0 08             	add    $0x8,%eax
+  801ecc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ecf:	4c 63 22             	movslq (%rdx),%r12
+  801ed2:	eb c7                	jmp    801e9b <vprintfmt+0x374>
+  801ed4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ed8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801edc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ee0:	eb ed                	jmp    801ecf <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801ee2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ee5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee8:	77 11                	ja     801efb <vprintfmt+0x3d4>
+  801eea:	89 c2                	mov    %eax,%edx
+  801eec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ef0:	83 c0 08             	add    $0x8,%eax
+  801ef3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ef6:	4c 8b 22             	mov    (%rdx),%r12
+  801ef9:	eb a0                	jmp    801e9b <vprintfmt+0x374>
+  801efb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801eff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f07:	eb ed                	jmp    801ef6 <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801f09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f15:	e9 65 ff ff ff       	jmp    801e7f <vprintfmt+0x358>
+                putch('-', put_arg);
+  801f1a:	4c 89 ee             	mov    %r13,%rsi
+  801f1d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801f22:	41 ff d6             	call   *%r14
+                i = -i;
+  801f25:	49 f7 dc             	neg    %r12
+  801f28:	e9 73 ff ff ff       	jmp    801ea0 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801f2d:	40 84 f6             	test   %sil,%sil
+  801f30:	75 2e                	jne    801f60 <vprintfmt+0x439>
+    switch (lflag) {
+  801f32:	85 d2                	test   %edx,%edx
+  801f34:	7f 59                	jg     801f8f <vprintfmt+0x468>
+  801f36:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801f39:	7d 7a                	jge    801fb5 <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801f3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f3e:	83 f8 2f             	cmp    $0x2f,%eax
+  801f41:	0f 87 aa 00 00 00    	ja     801ff1 <vprintfmt+0x4ca>
+  801f47:	89 c2                	mov    %eax,%edx
+  801f49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f4d:	83 c0 08             	add    $0x8,%eax
+  801f50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f53:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801f5b:	e9 a3 01 00 00       	jmp    802103 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801f60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f63:	83 f8 2f             	cmp    $0x2f,%eax
+  801f66:	77 19                	ja     801f81 <vprintfmt+0x45a>
+  801f68:	89 c2                	mov    %eax,%edx
+  801f6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f6e:	83 c0 08             	add    $0x8,%eax
+  801f71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f74:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801f77:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801f7c:	e9 82 01 00 00       	jmp    802103 <vprintfmt+0x5dc>
+  801f81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f8d:	eb e5                	jmp    801f74 <vprintfmt+0x44d>
+    switch (lflag) {
+  801f8f:	83 fa 01             	cmp    $0x1,%edx
+  801f92:	75 a7                	jne    801f3b <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f97:	83 f8 2f             	cmp    $0x2f,%eax
+  801f9a:	77 47                	ja     801fe3 <vprintfmt+0x4bc>
+  801f9c:	89 c2                	mov    %eax,%edx
+  801f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fa2:	83 c0 08             	add    $0x8,%eax
+  801fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fa8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801fab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801fb0:	e9 4e 01 00 00       	jmp    802103 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801fb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801fb8:	83 f8 2f             	cmp    $0x2f,%eax
+  801fbb:	77 18                	ja     801fd5 <vprintfmt+0x4ae>
+  801fbd:	89 c2                	mov    %eax,%edx
+  801fbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801fc3:	83 c0 08             	add    $0x8,%eax
+  801fc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801fc9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801fcb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801fd0:	e9 2e 01 00 00       	jmp    802103 <vprintfmt+0x5dc>
+  801fd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801fdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fe1:	eb e6                	jmp    801fc9 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801fe3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801fe7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801feb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801fef:	eb b7                	jmp    801fa8 <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801ff1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ff5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ff9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ffd:	e9 51 ff ff ff       	jmp    801f53 <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  802002:	40 84 f6             	test   %sil,%sil
+  802005:	75 2e                	jne    802035 <vprintfmt+0x50e>
+    switch (lflag) {
+  802007:	85 d2                	test   %edx,%edx
+  802009:	7f 59                	jg     802064 <vprintfmt+0x53d>
+  80200b:	83 fa fe             	cmp    $0xfffffffe,%edx
+  80200e:	7d 77                	jge    802087 <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  802010:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802013:	83 f8 2f             	cmp    $0x2f,%eax
+  802016:	0f 87 a4 00 00 00    	ja     8020c0 <vprintfmt+0x599>
+  80201c:	89 c2                	mov    %eax,%edx
+  80201e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802022:	83 c0 08             	add    $0x8,%eax
+  802025:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802028:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80202b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  802030:	e9 ce 00 00 00       	jmp    802103 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802035:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802038:	83 f8 2f             	cmp    $0x2f,%eax
+  80203b:	77 19                	ja     802056 <vprintfmt+0x52f>
+  80203d:	89 c2                	mov    %eax,%edx
+  80203f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802043:	83 c0 08             	add    $0x8,%eax
+  802046:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802049:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80204c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802051:	e9 ad 00 00 00       	jmp    802103 <vprintfmt+0x5dc>
+  802056:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80205a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80205e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802062:	eb e5                	jmp    802049 <vprintfmt+0x522>
+    switch (lflag) {
+  802064:	83 fa 01             	cmp    $0x1,%edx
+  802067:	75 a7                	jne    802010 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  802069:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80206c:	83 f8 2f             	cmp    $0x2f,%eax
+  80206f:	77 41                	ja     8020b2 <vprintfmt+0x58b>
+  802071:	89 c2                	mov    %eax,%edx
+  802073:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802077:	83 c0 08             	add    $0x8,%eax
+  80207a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80207d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  802080:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  802085:	eb 7c                	jmp    802103 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  802087:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80208a:	83 f8 2f             	cmp    $0x2f,%eax
+  80208d:	77 15                	ja     8020a4 <vprintfmt+0x57d>
+  80208f:	89 c2                	mov    %eax,%edx
+  802091:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802095:	83 c0 08             	add    $0x8,%eax
+  802098:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80209b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80209d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8020a2:	eb 5f                	jmp    802103 <vprintfmt+0x5dc>
+  8020a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020b0:	eb e9                	jmp    80209b <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  8020b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020be:	eb bd                	jmp    80207d <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  8020c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8020c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8020c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8020cc:	e9 57 ff ff ff       	jmp    802028 <vprintfmt+0x501>
+            putch('0', put_arg);
+  8020d1:	4c 89 ee             	mov    %r13,%rsi
+  8020d4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8020d9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8020dc:	4c 89 ee             	mov    %r13,%rsi
+  8020df:	bf 78 00 00 00       	mov    $0x78,%edi
+  8020e4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8020e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8020ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8020ed:	77 47                	ja     802136 <vprintfmt+0x60f>
+  8020ef:	89 c2                	mov    %eax,%edx
+  8020f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8020f5:	83 c0 08             	add    $0x8,%eax
+  8020f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8020fb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8020fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  802103:	48 83 ec 08          	sub    $0x8,%rsp
+  802107:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80210b:	0f 94 c0             	sete   %al
+  80210e:	0f b6 c0             	movzbl %al,%eax
+  802111:	50                   	push   %rax
+  802112:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  802117:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80211b:	4c 89 ee             	mov    %r13,%rsi
+  80211e:	4c 89 f7             	mov    %r14,%rdi
+  802121:	48 b8 1c 1a 80 00 00 	movabs $0x801a1c,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+            break;
+  80212d:	48 83 c4 10          	add    $0x10,%rsp
+  802131:	e9 31 fa ff ff       	jmp    801b67 <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  802136:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80213a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80213e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802142:	eb b7                	jmp    8020fb <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  802144:	40 84 f6             	test   %sil,%sil
+  802147:	75 2b                	jne    802174 <vprintfmt+0x64d>
+    switch (lflag) {
+  802149:	85 d2                	test   %edx,%edx
+  80214b:	7f 56                	jg     8021a3 <vprintfmt+0x67c>
+  80214d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  802150:	7d 77                	jge    8021c9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  802152:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802155:	83 f8 2f             	cmp    $0x2f,%eax
+  802158:	0f 87 a7 00 00 00    	ja     802205 <vprintfmt+0x6de>
+  80215e:	89 c2                	mov    %eax,%edx
+  802160:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802164:	83 c0 08             	add    $0x8,%eax
+  802167:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80216a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80216d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  802172:	eb 8f                	jmp    802103 <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  802174:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  802177:	83 f8 2f             	cmp    $0x2f,%eax
+  80217a:	77 19                	ja     802195 <vprintfmt+0x66e>
+  80217c:	89 c2                	mov    %eax,%edx
+  80217e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  802182:	83 c0 08             	add    $0x8,%eax
+  802185:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  802188:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80218b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  802190:	e9 6e ff ff ff       	jmp    802103 <vprintfmt+0x5dc>
+  802195:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802199:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80219d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021a1:	eb e5                	jmp    802188 <vprintfmt+0x661>
+    switch (lflag) {
+  8021a3:	83 fa 01             	cmp    $0x1,%edx
+  8021a6:	75 aa                	jne    802152 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  8021a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8021ae:	77 47                	ja     8021f7 <vprintfmt+0x6d0>
+  8021b0:	89 c2                	mov    %eax,%edx
+  8021b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021b6:	83 c0 08             	add    $0x8,%eax
+  8021b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8021bf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8021c4:	e9 3a ff ff ff       	jmp    802103 <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  8021c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8021cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8021cf:	77 18                	ja     8021e9 <vprintfmt+0x6c2>
+  8021d1:	89 c2                	mov    %eax,%edx
+  8021d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8021d7:	83 c0 08             	add    $0x8,%eax
+  8021da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8021dd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8021df:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8021e4:	e9 1a ff ff ff       	jmp    802103 <vprintfmt+0x5dc>
+  8021e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8021f5:	eb e6                	jmp    8021dd <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  8021f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8021fb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8021ff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802203:	eb b7                	jmp    8021bc <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  802205:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  802209:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80220d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802211:	e9 54 ff ff ff       	jmp    80216a <vprintfmt+0x643>
+            putch(ch, put_arg);
+  802216:	4c 89 ee             	mov    %r13,%rsi
+  802219:	bf 25 00 00 00       	mov    $0x25,%edi
+  80221e:	41 ff d6             	call   *%r14
+            break;
+  802221:	e9 41 f9 ff ff       	jmp    801b67 <vprintfmt+0x40>
+            putch('%', put_arg);
+  802226:	4c 89 ee             	mov    %r13,%rsi
+  802229:	bf 25 00 00 00       	mov    $0x25,%edi
+  80222e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  802231:	48 83 eb 01          	sub    $0x1,%rbx
+  802235:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  802239:	75 f6                	jne    802231 <vprintfmt+0x70a>
+  80223b:	e9 27 f9 ff ff       	jmp    801b67 <vprintfmt+0x40>
+
+0000000000802240 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  802248:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80224c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  802251:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  802255:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80225c:	48 85 ff             	test   %rdi,%rdi
+  80225f:	74 2b                	je     80228c <vsnprintf+0x4c>
+  802261:	48 85 f6             	test   %rsi,%rsi
+  802264:	74 26                	je     80228c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  802266:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80226a:	48 bf d2 1a 80 00 00 	movabs $0x801ad2,%rdi
+  802271:	00 00 00 
+  802274:	48 b8 27 1b 80 00 00 	movabs $0x801b27,%rax
+  80227b:	00 00 00 
+  80227e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  802280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802284:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  802287:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80228a:	c9                   	leave
+  80228b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80228c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802291:	eb f7                	jmp    80228a <vsnprintf+0x4a>
+
+0000000000802293 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  802293:	55                   	push   %rbp
+  802294:	48 89 e5             	mov    %rsp,%rbp
+  802297:	48 83 ec 50          	sub    $0x50,%rsp
+  80229b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80229f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8022a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8022a7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8022ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8022b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8022b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8022ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8022be:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8022c2:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+00000000008022d0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8022d0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8022d3:	74 10                	je     8022e5 <strlen+0x15>
+    size_t n = 0;
+  8022d5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8022da:	48 83 c0 01          	add    $0x1,%rax
+  8022de:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8022e2:	75 f6                	jne    8022da <strlen+0xa>
+  8022e4:	c3                   	ret
+    size_t n = 0;
+  8022e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8022ea:	c3                   	ret
+
+00000000008022eb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8022eb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8022ee:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8022f3:	48 85 f6             	test   %rsi,%rsi
+  8022f6:	74 11                	je     802309 <strnlen+0x1e>
+  8022f8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8022fc:	74 0c                	je     80230a <strnlen+0x1f>
+  8022fe:	48 83 c2 01          	add    $0x1,%rdx
+  802302:	48 39 d0             	cmp    %rdx,%rax
+  802305:	75 f1                	jne    8022f8 <strnlen+0xd>
+  802307:	eb 04                	jmp    80230d <strnlen+0x22>
+  802309:	c3                   	ret
+  80230a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80230d:	c3                   	ret
+
+000000000080230e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80230e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802311:	ba 00 00 00 00       	mov    $0x0,%edx
+  802316:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80231a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80231d:	48 83 c2 01          	add    $0x1,%rdx
+  802321:	84 c9                	test   %cl,%cl
+  802323:	75 f1                	jne    802316 <strcpy+0x8>
+        ;
+    return res;
+}
+  802325:	c3                   	ret
+
+0000000000802326 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  802326:	55                   	push   %rbp
+  802327:	48 89 e5             	mov    %rsp,%rbp
+  80232a:	41 54                	push   %r12
+  80232c:	53                   	push   %rbx
+  80232d:	48 89 fb             	mov    %rdi,%rbx
+  802330:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  802333:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  80233a:	00 00 00 
+  80233d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80233f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  802343:	4c 89 e6             	mov    %r12,%rsi
+  802346:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  80234d:	00 00 00 
+  802350:	ff d0                	call   *%rax
+    return dst;
+}
+  802352:	48 89 d8             	mov    %rbx,%rax
+  802355:	5b                   	pop    %rbx
+  802356:	41 5c                	pop    %r12
+  802358:	5d                   	pop    %rbp
+  802359:	c3                   	ret
+
+000000000080235a <toupper>:
+
+int
+toupper(int ch) {
+  80235a:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  80235c:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  80235f:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  802362:	83 f9 1a             	cmp    $0x1a,%ecx
+  802365:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802368:	c3                   	ret
+
+0000000000802369 <tolower>:
+
+int
+tolower(int ch) {
+  802369:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  80236b:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  80236e:	8d 57 20             	lea    0x20(%rdi),%edx
+  802371:	83 f9 1a             	cmp    $0x1a,%ecx
+  802374:	0f 42 c2             	cmovb  %edx,%eax
+}
+  802377:	c3                   	ret
+
+0000000000802378 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  802378:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80237b:	48 85 d2             	test   %rdx,%rdx
+  80237e:	74 1f                	je     80239f <strncpy+0x27>
+  802380:	48 01 fa             	add    %rdi,%rdx
+  802383:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  802386:	48 83 c1 01          	add    $0x1,%rcx
+  80238a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80238e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  802392:	41 80 f8 01          	cmp    $0x1,%r8b
+  802396:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80239a:	48 39 ca             	cmp    %rcx,%rdx
+  80239d:	75 e7                	jne    802386 <strncpy+0xe>
+    }
+    return ret;
+}
+  80239f:	c3                   	ret
+
+00000000008023a0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8023a0:	48 89 f8             	mov    %rdi,%rax
+  8023a3:	48 85 d2             	test   %rdx,%rdx
+  8023a6:	74 24                	je     8023cc <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8023a8:	48 83 ea 01          	sub    $0x1,%rdx
+  8023ac:	74 1b                	je     8023c9 <strlcpy+0x29>
+  8023ae:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8023b2:	0f b6 16             	movzbl (%rsi),%edx
+  8023b5:	84 d2                	test   %dl,%dl
+  8023b7:	74 10                	je     8023c9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8023b9:	48 83 c6 01          	add    $0x1,%rsi
+  8023bd:	48 83 c0 01          	add    $0x1,%rax
+  8023c1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8023c4:	48 39 c8             	cmp    %rcx,%rax
+  8023c7:	75 e9                	jne    8023b2 <strlcpy+0x12>
+        *dst = '\0';
+  8023c9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8023cc:	48 29 f8             	sub    %rdi,%rax
+}
+  8023cf:	c3                   	ret
+
+00000000008023d0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8023d0:	0f b6 07             	movzbl (%rdi),%eax
+  8023d3:	84 c0                	test   %al,%al
+  8023d5:	74 13                	je     8023ea <strcmp+0x1a>
+  8023d7:	38 06                	cmp    %al,(%rsi)
+  8023d9:	75 0f                	jne    8023ea <strcmp+0x1a>
+  8023db:	48 83 c7 01          	add    $0x1,%rdi
+  8023df:	48 83 c6 01          	add    $0x1,%rsi
+  8023e3:	0f b6 07             	movzbl (%rdi),%eax
+  8023e6:	84 c0                	test   %al,%al
+  8023e8:	75 ed                	jne    8023d7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8023ea:	0f b6 c0             	movzbl %al,%eax
+  8023ed:	0f b6 16             	movzbl (%rsi),%edx
+  8023f0:	29 d0                	sub    %edx,%eax
+}
+  8023f2:	c3                   	ret
+
+00000000008023f3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8023f3:	48 85 d2             	test   %rdx,%rdx
+  8023f6:	74 1f                	je     802417 <strncmp+0x24>
+  8023f8:	0f b6 07             	movzbl (%rdi),%eax
+  8023fb:	84 c0                	test   %al,%al
+  8023fd:	74 1e                	je     80241d <strncmp+0x2a>
+  8023ff:	3a 06                	cmp    (%rsi),%al
+  802401:	75 1a                	jne    80241d <strncmp+0x2a>
+  802403:	48 83 c7 01          	add    $0x1,%rdi
+  802407:	48 83 c6 01          	add    $0x1,%rsi
+  80240b:	48 83 ea 01          	sub    $0x1,%rdx
+  80240f:	75 e7                	jne    8023f8 <strncmp+0x5>
+
+    if (!n) return 0;
+  802411:	b8 00 00 00 00       	mov    $0x0,%eax
+  802416:	c3                   	ret
+  802417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241c:	c3                   	ret
+  80241d:	48 85 d2             	test   %rdx,%rdx
+  802420:	74 09                	je     80242b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802422:	0f b6 07             	movzbl (%rdi),%eax
+  802425:	0f b6 16             	movzbl (%rsi),%edx
+  802428:	29 d0                	sub    %edx,%eax
+  80242a:	c3                   	ret
+    if (!n) return 0;
+  80242b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802430:	c3                   	ret
+
+0000000000802431 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802431:	0f b6 17             	movzbl (%rdi),%edx
+  802434:	84 d2                	test   %dl,%dl
+  802436:	74 18                	je     802450 <strchr+0x1f>
+        if (*str == c) {
+  802438:	0f be d2             	movsbl %dl,%edx
+  80243b:	39 f2                	cmp    %esi,%edx
+  80243d:	74 17                	je     802456 <strchr+0x25>
+    for (; *str; str++) {
+  80243f:	48 83 c7 01          	add    $0x1,%rdi
+  802443:	0f b6 17             	movzbl (%rdi),%edx
+  802446:	84 d2                	test   %dl,%dl
+  802448:	75 ee                	jne    802438 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80244a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244f:	c3                   	ret
+  802450:	b8 00 00 00 00       	mov    $0x0,%eax
+  802455:	c3                   	ret
+  802456:	48 89 f8             	mov    %rdi,%rax
+}
+  802459:	c3                   	ret
+
+000000000080245a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80245a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80245d:	0f b6 17             	movzbl (%rdi),%edx
+  802460:	84 d2                	test   %dl,%dl
+  802462:	74 13                	je     802477 <strfind+0x1d>
+  802464:	0f be d2             	movsbl %dl,%edx
+  802467:	39 f2                	cmp    %esi,%edx
+  802469:	74 0b                	je     802476 <strfind+0x1c>
+  80246b:	48 83 c0 01          	add    $0x1,%rax
+  80246f:	0f b6 10             	movzbl (%rax),%edx
+  802472:	84 d2                	test   %dl,%dl
+  802474:	75 ee                	jne    802464 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  802476:	c3                   	ret
+  802477:	c3                   	ret
+
+0000000000802478 <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  802478:	48 39 f7             	cmp    %rsi,%rdi
+  80247b:	74 65                	je     8024e2 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  80247d:	55                   	push   %rbp
+  80247e:	48 89 e5             	mov    %rsp,%rbp
+  802481:	41 57                	push   %r15
+  802483:	41 56                	push   %r14
+  802485:	41 55                	push   %r13
+  802487:	41 54                	push   %r12
+  802489:	53                   	push   %rbx
+  80248a:	48 83 ec 18          	sub    $0x18,%rsp
+  80248e:	48 89 fb             	mov    %rdi,%rbx
+  802491:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  802494:	49 bf 69 23 80 00 00 	movabs $0x802369,%r15
+  80249b:	00 00 00 
+  80249e:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  8024a2:	41 0f b6 fd          	movzbl %r13b,%edi
+  8024a6:	41 ff d7             	call   *%r15
+  8024a9:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  8024ac:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  8024b1:	41 0f b6 fe          	movzbl %r14b,%edi
+  8024b5:	41 ff d7             	call   *%r15
+  8024b8:	89 c2                	mov    %eax,%edx
+  8024ba:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8024bd:	29 d0                	sub    %edx,%eax
+  8024bf:	75 12                	jne    8024d3 <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  8024c1:	48 83 c3 01          	add    $0x1,%rbx
+  8024c5:	45 84 ed             	test   %r13b,%r13b
+  8024c8:	74 09                	je     8024d3 <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  8024ca:	49 83 c4 01          	add    $0x1,%r12
+  8024ce:	45 84 f6             	test   %r14b,%r14b
+  8024d1:	75 cb                	jne    80249e <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  8024d3:	48 83 c4 18          	add    $0x18,%rsp
+  8024d7:	5b                   	pop    %rbx
+  8024d8:	41 5c                	pop    %r12
+  8024da:	41 5d                	pop    %r13
+  8024dc:	41 5e                	pop    %r14
+  8024de:	41 5f                	pop    %r15
+  8024e0:	5d                   	pop    %rbp
+  8024e1:	c3                   	ret
+    if (p1 == p2) return 0;
+  8024e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e7:	c3                   	ret
+
+00000000008024e8 <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8024e8:	48 39 f7             	cmp    %rsi,%rdi
+  8024eb:	74 7d                	je     80256a <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  8024ed:	55                   	push   %rbp
+  8024ee:	48 89 e5             	mov    %rsp,%rbp
+  8024f1:	41 57                	push   %r15
+  8024f3:	41 56                	push   %r14
+  8024f5:	41 55                	push   %r13
+  8024f7:	41 54                	push   %r12
+  8024f9:	53                   	push   %rbx
+  8024fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8024fe:	48 89 fb             	mov    %rdi,%rbx
+  802501:	49 89 f4             	mov    %rsi,%r12
+  802504:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  802508:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80250c:	49 bf 69 23 80 00 00 	movabs $0x802369,%r15
+  802513:	00 00 00 
+    while (n--) {
+  802516:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80251a:	48 39 c3             	cmp    %rax,%rbx
+  80251d:	74 37                	je     802556 <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  80251f:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802523:	41 0f b6 fd          	movzbl %r13b,%edi
+  802527:	41 ff d7             	call   *%r15
+  80252a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80252d:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802532:	41 0f b6 fe          	movzbl %r14b,%edi
+  802536:	41 ff d7             	call   *%r15
+  802539:	89 c2                	mov    %eax,%edx
+  80253b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80253e:	29 d0                	sub    %edx,%eax
+  802540:	75 19                	jne    80255b <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  802542:	48 83 c3 01          	add    $0x1,%rbx
+  802546:	45 84 ed             	test   %r13b,%r13b
+  802549:	74 10                	je     80255b <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  80254b:	49 83 c4 01          	add    $0x1,%r12
+  80254f:	45 84 f6             	test   %r14b,%r14b
+  802552:	75 c2                	jne    802516 <strncasecmp+0x2e>
+  802554:	eb 05                	jmp    80255b <strncasecmp+0x73>
+  802556:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  80255b:	48 83 c4 18          	add    $0x18,%rsp
+  80255f:	5b                   	pop    %rbx
+  802560:	41 5c                	pop    %r12
+  802562:	41 5d                	pop    %r13
+  802564:	41 5e                	pop    %r14
+  802566:	41 5f                	pop    %r15
+  802568:	5d                   	pop    %rbp
+  802569:	c3                   	ret
+    if (p1 == p2) return 0;
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80256f:	c3                   	ret
+
+0000000000802570 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  802570:	83 e7 df             	and    $0xffffffdf,%edi
+  802573:	83 ef 41             	sub    $0x41,%edi
+  802576:	83 ff 19             	cmp    $0x19,%edi
+  802579:	0f 96 c0             	setbe  %al
+}
+  80257c:	c3                   	ret
+
+000000000080257d <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  80257d:	83 ff 20             	cmp    $0x20,%edi
+  802580:	0f 94 c0             	sete   %al
+  802583:	83 ff 09             	cmp    $0x9,%edi
+  802586:	0f 94 c2             	sete   %dl
+  802589:	09 d0                	or     %edx,%eax
+}
+  80258b:	c3                   	ret
+
+000000000080258c <ispunct>:
+
+bool
+ispunct(int c)
+{
+  80258c:	55                   	push   %rbp
+  80258d:	48 89 e5             	mov    %rsp,%rbp
+  802590:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  802592:	48 bf bf 64 80 00 00 	movabs $0x8064bf,%rdi
+  802599:	00 00 00 
+  80259c:	48 b8 31 24 80 00 00 	movabs $0x802431,%rax
+  8025a3:	00 00 00 
+  8025a6:	ff d0                	call   *%rax
+  8025a8:	48 85 c0             	test   %rax,%rax
+  8025ab:	0f 95 c0             	setne  %al
+}
+  8025ae:	5d                   	pop    %rbp
+  8025af:	c3                   	ret
+
+00000000008025b0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8025b0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8025b3:	48 89 f8             	mov    %rdi,%rax
+  8025b6:	48 f7 d8             	neg    %rax
+  8025b9:	83 e0 07             	and    $0x7,%eax
+  8025bc:	49 89 d1             	mov    %rdx,%r9
+  8025bf:	49 29 c1             	sub    %rax,%r9
+  8025c2:	78 36                	js     8025fa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8025c4:	40 0f b6 c6          	movzbl %sil,%eax
+  8025c8:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8025cf:	01 01 01 
+  8025d2:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8025d6:	40 f6 c7 07          	test   $0x7,%dil
+  8025da:	75 38                	jne    802614 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8025dc:	4c 89 c9             	mov    %r9,%rcx
+  8025df:	48 c1 f9 03          	sar    $0x3,%rcx
+  8025e3:	74 0c                	je     8025f1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8025e5:	fc                   	cld
+  8025e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8025e9:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8025ed:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8025f1:	4d 85 c9             	test   %r9,%r9
+  8025f4:	75 45                	jne    80263b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8025f6:	4c 89 c0             	mov    %r8,%rax
+  8025f9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8025fa:	48 85 d2             	test   %rdx,%rdx
+  8025fd:	74 f7                	je     8025f6 <memset+0x46>
+  8025ff:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802602:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  802605:	48 83 c0 01          	add    $0x1,%rax
+  802609:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80260d:	48 39 c2             	cmp    %rax,%rdx
+  802610:	75 f3                	jne    802605 <memset+0x55>
+  802612:	eb e2                	jmp    8025f6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  802614:	40 f6 c7 01          	test   $0x1,%dil
+  802618:	74 06                	je     802620 <memset+0x70>
+  80261a:	88 07                	mov    %al,(%rdi)
+  80261c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802620:	40 f6 c7 02          	test   $0x2,%dil
+  802624:	74 07                	je     80262d <memset+0x7d>
+  802626:	66 89 07             	mov    %ax,(%rdi)
+  802629:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80262d:	40 f6 c7 04          	test   $0x4,%dil
+  802631:	74 a9                	je     8025dc <memset+0x2c>
+  802633:	89 07                	mov    %eax,(%rdi)
+  802635:	48 83 c7 04          	add    $0x4,%rdi
+  802639:	eb a1                	jmp    8025dc <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80263b:	41 f6 c1 04          	test   $0x4,%r9b
+  80263f:	74 06                	je     802647 <memset+0x97>
+  802641:	89 07                	mov    %eax,(%rdi)
+  802643:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802647:	41 f6 c1 02          	test   $0x2,%r9b
+  80264b:	74 07                	je     802654 <memset+0xa4>
+  80264d:	66 89 07             	mov    %ax,(%rdi)
+  802650:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  802654:	41 f6 c1 01          	test   $0x1,%r9b
+  802658:	74 9c                	je     8025f6 <memset+0x46>
+  80265a:	88 07                	mov    %al,(%rdi)
+  80265c:	eb 98                	jmp    8025f6 <memset+0x46>
+
+000000000080265e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80265e:	48 89 f8             	mov    %rdi,%rax
+  802661:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  802664:	48 39 fe             	cmp    %rdi,%rsi
+  802667:	73 3b                	jae    8026a4 <memmove+0x46>
+  802669:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80266d:	48 39 d7             	cmp    %rdx,%rdi
+  802670:	73 32                	jae    8026a4 <memmove+0x46>
+        s += n;
+        d += n;
+  802672:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  802676:	48 89 d6             	mov    %rdx,%rsi
+  802679:	48 09 fe             	or     %rdi,%rsi
+  80267c:	48 09 ce             	or     %rcx,%rsi
+  80267f:	40 f6 c6 07          	test   $0x7,%sil
+  802683:	75 12                	jne    802697 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  802685:	48 83 ef 08          	sub    $0x8,%rdi
+  802689:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80268d:	48 c1 e9 03          	shr    $0x3,%rcx
+  802691:	fd                   	std
+  802692:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  802695:	fc                   	cld
+  802696:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  802697:	48 83 ef 01          	sub    $0x1,%rdi
+  80269b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80269f:	fd                   	std
+  8026a0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8026a2:	eb f1                	jmp    802695 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8026a4:	48 89 f2             	mov    %rsi,%rdx
+  8026a7:	48 09 c2             	or     %rax,%rdx
+  8026aa:	48 09 ca             	or     %rcx,%rdx
+  8026ad:	f6 c2 07             	test   $0x7,%dl
+  8026b0:	75 0c                	jne    8026be <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8026b2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8026b6:	48 89 c7             	mov    %rax,%rdi
+  8026b9:	fc                   	cld
+  8026ba:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8026bd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8026be:	48 89 c7             	mov    %rax,%rdi
+  8026c1:	fc                   	cld
+  8026c2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8026c4:	c3                   	ret
+
+00000000008026c5 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8026c5:	55                   	push   %rbp
+  8026c6:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8026c9:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+}
+  8026d5:	5d                   	pop    %rbp
+  8026d6:	c3                   	ret
+
+00000000008026d7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8026d7:	55                   	push   %rbp
+  8026d8:	48 89 e5             	mov    %rsp,%rbp
+  8026db:	41 57                	push   %r15
+  8026dd:	41 56                	push   %r14
+  8026df:	41 55                	push   %r13
+  8026e1:	41 54                	push   %r12
+  8026e3:	53                   	push   %rbx
+  8026e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e8:	49 89 fe             	mov    %rdi,%r14
+  8026eb:	49 89 f7             	mov    %rsi,%r15
+  8026ee:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8026f1:	48 89 f7             	mov    %rsi,%rdi
+  8026f4:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+  802700:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  802703:	48 89 de             	mov    %rbx,%rsi
+  802706:	4c 89 f7             	mov    %r14,%rdi
+  802709:	48 b8 eb 22 80 00 00 	movabs $0x8022eb,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  802718:	48 39 c3             	cmp    %rax,%rbx
+  80271b:	74 36                	je     802753 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80271d:	48 89 d8             	mov    %rbx,%rax
+  802720:	4c 29 e8             	sub    %r13,%rax
+  802723:	49 39 c4             	cmp    %rax,%r12
+  802726:	73 31                	jae    802759 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  802728:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80272d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802731:	4c 89 fe             	mov    %r15,%rsi
+  802734:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  80273b:	00 00 00 
+  80273e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  802740:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  802744:	48 83 c4 08          	add    $0x8,%rsp
+  802748:	5b                   	pop    %rbx
+  802749:	41 5c                	pop    %r12
+  80274b:	41 5d                	pop    %r13
+  80274d:	41 5e                	pop    %r14
+  80274f:	41 5f                	pop    %r15
+  802751:	5d                   	pop    %rbp
+  802752:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  802753:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  802757:	eb eb                	jmp    802744 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  802759:	48 83 eb 01          	sub    $0x1,%rbx
+  80275d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802761:	48 89 da             	mov    %rbx,%rdx
+  802764:	4c 89 fe             	mov    %r15,%rsi
+  802767:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  80276e:	00 00 00 
+  802771:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  802773:	49 01 de             	add    %rbx,%r14
+  802776:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80277b:	eb c3                	jmp    802740 <strlcat+0x69>
+
+000000000080277d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80277d:	48 85 d2             	test   %rdx,%rdx
+  802780:	74 2d                	je     8027af <memcmp+0x32>
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  802787:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80278b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  802790:	44 38 c1             	cmp    %r8b,%cl
+  802793:	75 0f                	jne    8027a4 <memcmp+0x27>
+    while (n-- > 0) {
+  802795:	48 83 c0 01          	add    $0x1,%rax
+  802799:	48 39 c2             	cmp    %rax,%rdx
+  80279c:	75 e9                	jne    802787 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80279e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8027a4:	0f b6 c1             	movzbl %cl,%eax
+  8027a7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8027ab:	44 29 c0             	sub    %r8d,%eax
+  8027ae:	c3                   	ret
+    return 0;
+  8027af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027b4:	c3                   	ret
+
+00000000008027b5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8027b5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8027b9:	48 39 c7             	cmp    %rax,%rdi
+  8027bc:	73 0f                	jae    8027cd <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8027be:	40 38 37             	cmp    %sil,(%rdi)
+  8027c1:	74 0e                	je     8027d1 <memfind+0x1c>
+    for (; src < end; src++) {
+  8027c3:	48 83 c7 01          	add    $0x1,%rdi
+  8027c7:	48 39 f8             	cmp    %rdi,%rax
+  8027ca:	75 f2                	jne    8027be <memfind+0x9>
+  8027cc:	c3                   	ret
+  8027cd:	48 89 f8             	mov    %rdi,%rax
+  8027d0:	c3                   	ret
+  8027d1:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8027d4:	c3                   	ret
+
+00000000008027d5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8027d5:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8027d8:	0f b6 37             	movzbl (%rdi),%esi
+  8027db:	40 80 fe 20          	cmp    $0x20,%sil
+  8027df:	74 06                	je     8027e7 <strtol+0x12>
+  8027e1:	40 80 fe 09          	cmp    $0x9,%sil
+  8027e5:	75 13                	jne    8027fa <strtol+0x25>
+  8027e7:	48 83 c7 01          	add    $0x1,%rdi
+  8027eb:	0f b6 37             	movzbl (%rdi),%esi
+  8027ee:	40 80 fe 20          	cmp    $0x20,%sil
+  8027f2:	74 f3                	je     8027e7 <strtol+0x12>
+  8027f4:	40 80 fe 09          	cmp    $0x9,%sil
+  8027f8:	74 ed                	je     8027e7 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8027fa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8027fd:	83 e0 fd             	and    $0xfffffffd,%eax
+  802800:	3c 01                	cmp    $0x1,%al
+  802802:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802806:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80280c:	75 0f                	jne    80281d <strtol+0x48>
+  80280e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802811:	74 14                	je     802827 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  802813:	85 d2                	test   %edx,%edx
+  802815:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80281a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80281d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802822:	4c 63 ca             	movslq %edx,%r9
+  802825:	eb 36                	jmp    80285d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  802827:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80282b:	74 0f                	je     80283c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80282d:	85 d2                	test   %edx,%edx
+  80282f:	75 ec                	jne    80281d <strtol+0x48>
+        s++;
+  802831:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  802835:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80283a:	eb e1                	jmp    80281d <strtol+0x48>
+        s += 2;
+  80283c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  802840:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  802845:	eb d6                	jmp    80281d <strtol+0x48>
+            dig -= '0';
+  802847:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80284a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80284e:	41 39 d0             	cmp    %edx,%r8d
+  802851:	7d 21                	jge    802874 <strtol+0x9f>
+        val = val * base + dig;
+  802853:	49 0f af c1          	imul   %r9,%rax
+  802857:	0f b6 c9             	movzbl %cl,%ecx
+  80285a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80285d:	48 83 c7 01          	add    $0x1,%rdi
+  802861:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  802865:	80 f9 39             	cmp    $0x39,%cl
+  802868:	76 dd                	jbe    802847 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80286a:	80 f9 7b             	cmp    $0x7b,%cl
+  80286d:	77 05                	ja     802874 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80286f:	83 e9 57             	sub    $0x57,%ecx
+  802872:	eb d6                	jmp    80284a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  802874:	4d 85 d2             	test   %r10,%r10
+  802877:	74 03                	je     80287c <strtol+0xa7>
+  802879:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80287c:	48 89 c2             	mov    %rax,%rdx
+  80287f:	48 f7 da             	neg    %rdx
+  802882:	40 80 fe 2d          	cmp    $0x2d,%sil
+  802886:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80288a:	c3                   	ret
+
+000000000080288b <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  80288b:	55                   	push   %rbp
+  80288c:	48 89 e5             	mov    %rsp,%rbp
+  80288f:	53                   	push   %rbx
+  802890:	48 89 fa             	mov    %rdi,%rdx
+  802893:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802896:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80289b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028a0:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028b6:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  8028b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028bc:	c9                   	leave
+  8028bd:	c3                   	ret
+
+00000000008028be <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8028be:	55                   	push   %rbp
+  8028bf:	48 89 e5             	mov    %rsp,%rbp
+  8028c2:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8028c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028ed:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8028ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+00000000008028f5 <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  8028f5:	55                   	push   %rbp
+  8028f6:	48 89 e5             	mov    %rsp,%rbp
+  8028f9:	53                   	push   %rbx
+  8028fa:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028fd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802902:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802907:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80290c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802911:	be 00 00 00 00       	mov    $0x0,%esi
+  802916:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80291c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802922:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  802924:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+
+000000000080292a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80292a:	55                   	push   %rbp
+  80292b:	48 89 e5             	mov    %rsp,%rbp
+  80292e:	53                   	push   %rbx
+  80292f:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  802933:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802936:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80293b:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802940:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802945:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80294a:	be 00 00 00 00       	mov    $0x0,%esi
+  80294f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802955:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80295b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  80295d:	48 85 c0             	test   %rax,%rax
+  802960:	7f 06                	jg     802968 <sys_env_destroy+0x3e>
+}
+  802962:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802968:	49 89 c0             	mov    %rax,%r8
+  80296b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  802970:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802977:	00 00 00 
+  80297a:	be 27 00 00 00       	mov    $0x27,%esi
+  80297f:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802986:	00 00 00 
+  802989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298e:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802995:	00 00 00 
+  802998:	41 ff d1             	call   *%r9
+
+000000000080299b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80299b:	55                   	push   %rbp
+  80299c:	48 89 e5             	mov    %rsp,%rbp
+  80299f:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029a0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029b4:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8029be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029ca:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8029cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+
+00000000008029d2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8029d2:	55                   	push   %rbp
+  8029d3:	48 89 e5             	mov    %rsp,%rbp
+  8029d6:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  8029d7:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8029dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029eb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a01:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802a03:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a07:	c9                   	leave
+  802a08:	c3                   	ret
+
+0000000000802a09 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802a09:	55                   	push   %rbp
+  802a0a:	48 89 e5             	mov    %rsp,%rbp
+  802a0d:	53                   	push   %rbx
+  802a0e:	48 89 fa             	mov    %rdi,%rdx
+  802a11:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802a14:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a19:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802a20:	00 00 00 
+  802a23:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a28:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a33:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a39:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  802a3b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a3f:	c9                   	leave
+  802a40:	c3                   	ret
+
+0000000000802a41 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  802a41:	55                   	push   %rbp
+  802a42:	48 89 e5             	mov    %rsp,%rbp
+  802a45:	53                   	push   %rbx
+  802a46:	49 89 f8             	mov    %rdi,%r8
+  802a49:	48 89 d3             	mov    %rdx,%rbx
+  802a4c:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802a4f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a54:	4c 89 c2             	mov    %r8,%rdx
+  802a57:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a6b:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  802a6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a71:	c9                   	leave
+  802a72:	c3                   	ret
+
+0000000000802a73 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  802a73:	55                   	push   %rbp
+  802a74:	48 89 e5             	mov    %rsp,%rbp
+  802a77:	53                   	push   %rbx
+  802a78:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7c:	89 f8                	mov    %edi,%eax
+  802a7e:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  802a81:	48 63 f9             	movslq %ecx,%rdi
+  802a84:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a87:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802a8c:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802a94:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a9a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802aa0:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802aa2:	48 85 c0             	test   %rax,%rax
+  802aa5:	7f 06                	jg     802aad <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  802aa7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aab:	c9                   	leave
+  802aac:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aad:	49 89 c0             	mov    %rax,%r8
+  802ab0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  802ab5:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802abc:	00 00 00 
+  802abf:	be 27 00 00 00       	mov    $0x27,%esi
+  802ac4:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802acb:	00 00 00 
+  802ace:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad3:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802ada:	00 00 00 
+  802add:	41 ff d1             	call   *%r9
+
+0000000000802ae0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802ae0:	55                   	push   %rbp
+  802ae1:	48 89 e5             	mov    %rsp,%rbp
+  802ae4:	53                   	push   %rbx
+  802ae5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ae9:	89 f8                	mov    %edi,%eax
+  802aeb:	49 89 f2             	mov    %rsi,%r10
+  802aee:	48 89 cf             	mov    %rcx,%rdi
+  802af1:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  802af4:	48 63 da             	movslq %edx,%rbx
+  802af7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802afa:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802aff:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b02:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  802b05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b0d:	48 85 c0             	test   %rax,%rax
+  802b10:	7f 06                	jg     802b18 <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802b12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b18:	49 89 c0             	mov    %rax,%r8
+  802b1b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802b20:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802b27:	00 00 00 
+  802b2a:	be 27 00 00 00       	mov    $0x27,%esi
+  802b2f:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802b36:	00 00 00 
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802b45:	00 00 00 
+  802b48:	41 ff d1             	call   *%r9
+
+0000000000802b4b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	53                   	push   %rbx
+  802b50:	48 83 ec 08          	sub    $0x8,%rsp
+  802b54:	48 89 f1             	mov    %rsi,%rcx
+  802b57:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  802b5a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b5d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b67:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b78:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b7a:	48 85 c0             	test   %rax,%rax
+  802b7d:	7f 06                	jg     802b85 <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802b7f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b83:	c9                   	leave
+  802b84:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b85:	49 89 c0             	mov    %rax,%r8
+  802b88:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b8d:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802b94:	00 00 00 
+  802b97:	be 27 00 00 00       	mov    $0x27,%esi
+  802b9c:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802ba3:	00 00 00 
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802bb2:	00 00 00 
+  802bb5:	41 ff d1             	call   *%r9
+
+0000000000802bb8 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802bb8:	55                   	push   %rbp
+  802bb9:	48 89 e5             	mov    %rsp,%rbp
+  802bbc:	53                   	push   %rbx
+  802bbd:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802bc1:	48 63 ce             	movslq %esi,%rcx
+  802bc4:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802bcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802be1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802be7:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802be9:	48 85 c0             	test   %rax,%rax
+  802bec:	7f 06                	jg     802bf4 <sys_env_set_status+0x3c>
+}
+  802bee:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bf2:	c9                   	leave
+  802bf3:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802bf4:	49 89 c0             	mov    %rax,%r8
+  802bf7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802bfc:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802c03:	00 00 00 
+  802c06:	be 27 00 00 00       	mov    $0x27,%esi
+  802c0b:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802c12:	00 00 00 
+  802c15:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1a:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802c21:	00 00 00 
+  802c24:	41 ff d1             	call   *%r9
+
+0000000000802c27 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802c27:	55                   	push   %rbp
+  802c28:	48 89 e5             	mov    %rsp,%rbp
+  802c2b:	53                   	push   %rbx
+  802c2c:	48 83 ec 08          	sub    $0x8,%rsp
+  802c30:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  802c33:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c36:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c40:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c45:	be 00 00 00 00       	mov    $0x0,%esi
+  802c4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802c50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802c56:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c58:	48 85 c0             	test   %rax,%rax
+  802c5b:	7f 06                	jg     802c63 <sys_env_set_trapframe+0x3c>
+}
+  802c5d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c61:	c9                   	leave
+  802c62:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c63:	49 89 c0             	mov    %rax,%r8
+  802c66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802c6b:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802c72:	00 00 00 
+  802c75:	be 27 00 00 00       	mov    $0x27,%esi
+  802c7a:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802c81:	00 00 00 
+  802c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c89:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802c90:	00 00 00 
+  802c93:	41 ff d1             	call   *%r9
+
+0000000000802c96 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802c96:	55                   	push   %rbp
+  802c97:	48 89 e5             	mov    %rsp,%rbp
+  802c9a:	53                   	push   %rbx
+  802c9b:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9f:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802ca2:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802ca5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802caf:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802cb4:	be 00 00 00 00       	mov    $0x0,%esi
+  802cb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802cbf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802cc5:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802cc7:	48 85 c0             	test   %rax,%rax
+  802cca:	7f 06                	jg     802cd2 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802ccc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cd2:	49 89 c0             	mov    %rax,%r8
+  802cd5:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802cda:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802ce1:	00 00 00 
+  802ce4:	be 27 00 00 00       	mov    $0x27,%esi
+  802ce9:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802cf0:	00 00 00 
+  802cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf8:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802cff:	00 00 00 
+  802d02:	41 ff d1             	call   *%r9
+
+0000000000802d05 <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802d05:	55                   	push   %rbp
+  802d06:	48 89 e5             	mov    %rsp,%rbp
+  802d09:	53                   	push   %rbx
+  802d0a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802d0e:	40 0f b6 ce          	movzbl %sil,%ecx
+  802d12:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d15:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d24:	be 00 00 00 00       	mov    $0x0,%esi
+  802d29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d2f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d35:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d37:	48 85 c0             	test   %rax,%rax
+  802d3a:	7f 06                	jg     802d42 <sys_env_set_reclaim+0x3d>
+}
+  802d3c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d40:	c9                   	leave
+  802d41:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d42:	49 89 c0             	mov    %rax,%r8
+  802d45:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802d4a:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802d51:	00 00 00 
+  802d54:	be 27 00 00 00       	mov    $0x27,%esi
+  802d59:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802d60:	00 00 00 
+  802d63:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d68:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802d6f:	00 00 00 
+  802d72:	41 ff d1             	call   *%r9
+
+0000000000802d75 <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802d75:	55                   	push   %rbp
+  802d76:	48 89 e5             	mov    %rsp,%rbp
+  802d79:	53                   	push   %rbx
+  802d7a:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802d7e:	48 63 ce             	movslq %esi,%rcx
+  802d81:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802d84:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d8e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d93:	be 00 00 00 00       	mov    $0x0,%esi
+  802d98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802da4:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802da6:	48 85 c0             	test   %rax,%rax
+  802da9:	7f 06                	jg     802db1 <sys_env_set_nice+0x3c>
+}
+  802dab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802daf:	c9                   	leave
+  802db0:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802db1:	49 89 c0             	mov    %rax,%r8
+  802db4:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802db9:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802dc0:	00 00 00 
+  802dc3:	be 27 00 00 00       	mov    $0x27,%esi
+  802dc8:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802dcf:	00 00 00 
+  802dd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd7:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802dde:	00 00 00 
+  802de1:	41 ff d1             	call   *%r9
+
+0000000000802de4 <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802de4:	55                   	push   %rbp
+  802de5:	48 89 e5             	mov    %rsp,%rbp
+  802de8:	53                   	push   %rbx
+  802de9:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dec:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802df1:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e00:	be 00 00 00 00       	mov    $0x0,%esi
+  802e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e11:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802e13:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e17:	c9                   	leave
+  802e18:	c3                   	ret
+
+0000000000802e19 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e19:	55                   	push   %rbp
+  802e1a:	48 89 e5             	mov    %rsp,%rbp
+  802e1d:	53                   	push   %rbx
+  802e1e:	89 f8                	mov    %edi,%eax
+  802e20:	49 89 f1             	mov    %rsi,%r9
+  802e23:	48 89 d3             	mov    %rdx,%rbx
+  802e26:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e29:	49 63 f0             	movslq %r8d,%rsi
+  802e2c:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e2f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e34:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e37:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e3d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e43:	cd 30                	int    $0x30
+}
+  802e45:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e49:	c9                   	leave
+  802e4a:	c3                   	ret
+
+0000000000802e4b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802e4b:	55                   	push   %rbp
+  802e4c:	48 89 e5             	mov    %rsp,%rbp
+  802e4f:	53                   	push   %rbx
+  802e50:	89 f8                	mov    %edi,%eax
+  802e52:	49 89 f1             	mov    %rsi,%r9
+  802e55:	48 89 d3             	mov    %rdx,%rbx
+  802e58:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802e5b:	49 63 f0             	movslq %r8d,%rsi
+  802e5e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e61:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e66:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e69:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e75:	cd 30                	int    $0x30
+}
+  802e77:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e7b:	c9                   	leave
+  802e7c:	c3                   	ret
+
+0000000000802e7d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802e7d:	55                   	push   %rbp
+  802e7e:	48 89 e5             	mov    %rsp,%rbp
+  802e81:	53                   	push   %rbx
+  802e82:	48 83 ec 08          	sub    $0x8,%rsp
+  802e86:	89 f8                	mov    %edi,%eax
+  802e88:	49 89 f2             	mov    %rsi,%r10
+  802e8b:	48 89 d3             	mov    %rdx,%rbx
+  802e8e:	48 89 cf             	mov    %rcx,%rdi
+  802e91:	44 89 c6             	mov    %r8d,%esi
+  802e94:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802e97:	48 63 f6             	movslq %esi,%rsi
+  802e9a:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802e9d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802ea2:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ea5:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ea9:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802eab:	48 85 c0             	test   %rax,%rax
+  802eae:	7f 06                	jg     802eb6 <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802eb0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802eb4:	c9                   	leave
+  802eb5:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802eb6:	49 89 c0             	mov    %rax,%r8
+  802eb9:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802ebe:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802ec5:	00 00 00 
+  802ec8:	be 27 00 00 00       	mov    $0x27,%esi
+  802ecd:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802ed4:	00 00 00 
+  802ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802edc:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802ee3:	00 00 00 
+  802ee6:	41 ff d1             	call   *%r9
+
+0000000000802ee9 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802ee9:	55                   	push   %rbp
+  802eea:	48 89 e5             	mov    %rsp,%rbp
+  802eed:	53                   	push   %rbx
+  802eee:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef2:	48 89 f1             	mov    %rsi,%rcx
+  802ef5:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802ef8:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802efc:	48 8b 1a             	mov    (%rdx),%rbx
+  802eff:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f02:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802f07:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802f0b:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802f0f:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802f13:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f15:	48 85 c0             	test   %rax,%rax
+  802f18:	7f 06                	jg     802f20 <sys_ipc_call_short+0x37>
+}
+  802f1a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f20:	49 89 c0             	mov    %rax,%r8
+  802f23:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802f28:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802f2f:	00 00 00 
+  802f32:	be 27 00 00 00       	mov    $0x27,%esi
+  802f37:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802f3e:	00 00 00 
+  802f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f46:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802f4d:	00 00 00 
+  802f50:	41 ff d1             	call   *%r9
+
+0000000000802f53 <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802f53:	55                   	push   %rbp
+  802f54:	48 89 e5             	mov    %rsp,%rbp
+  802f57:	53                   	push   %rbx
+  802f58:	48 83 ec 08          	sub    $0x8,%rsp
+  802f5c:	89 f8                	mov    %edi,%eax
+  802f5e:	49 89 f2             	mov    %rsi,%r10
+  802f61:	48 89 d3             	mov    %rdx,%rbx
+  802f64:	48 89 cf             	mov    %rcx,%rdi
+  802f67:	44 89 c6             	mov    %r8d,%esi
+  802f6a:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802f6d:	48 63 f6             	movslq %esi,%rsi
+  802f70:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802f73:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802f78:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802f7b:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802f7f:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802f81:	48 85 c0             	test   %rax,%rax
+  802f84:	7f 06                	jg     802f8c <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802f86:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f8a:	c9                   	leave
+  802f8b:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802f8c:	49 89 c0             	mov    %rax,%r8
+  802f8f:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802f94:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  802f9b:	00 00 00 
+  802f9e:	be 27 00 00 00       	mov    $0x27,%esi
+  802fa3:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  802faa:	00 00 00 
+  802fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fb2:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  802fb9:	00 00 00 
+  802fbc:	41 ff d1             	call   *%r9
+
+0000000000802fbf <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802fbf:	55                   	push   %rbp
+  802fc0:	48 89 e5             	mov    %rsp,%rbp
+  802fc3:	53                   	push   %rbx
+  802fc4:	48 83 ec 08          	sub    $0x8,%rsp
+  802fc8:	48 89 fa             	mov    %rdi,%rdx
+  802fcb:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802fce:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802fdd:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802fe8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802fee:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ff0:	48 85 c0             	test   %rax,%rax
+  802ff3:	7f 06                	jg     802ffb <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ff5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802ffb:	49 89 c0             	mov    %rax,%r8
+  802ffe:	b9 12 00 00 00       	mov    $0x12,%ecx
+  803003:	48 ba c8 64 80 00 00 	movabs $0x8064c8,%rdx
+  80300a:	00 00 00 
+  80300d:	be 27 00 00 00       	mov    $0x27,%esi
+  803012:	48 bf e7 64 80 00 00 	movabs $0x8064e7,%rdi
+  803019:	00 00 00 
+  80301c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803021:	49 b9 d9 53 80 00 00 	movabs $0x8053d9,%r9
+  803028:	00 00 00 
+  80302b:	41 ff d1             	call   *%r9
+
+000000000080302e <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80302e:	55                   	push   %rbp
+  80302f:	48 89 e5             	mov    %rsp,%rbp
+  803032:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  803033:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80303d:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803042:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803047:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80304c:	be 00 00 00 00       	mov    $0x0,%esi
+  803051:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  803057:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80305d:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80305f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803063:	c9                   	leave
+  803064:	c3                   	ret
+
+0000000000803065 <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  803065:	55                   	push   %rbp
+  803066:	48 89 e5             	mov    %rsp,%rbp
+  803069:	53                   	push   %rbx
+  80306a:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80306d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  803072:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  803077:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80307c:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  803081:	be 00 00 00 00       	mov    $0x0,%esi
+  803086:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80308c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  803092:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  803094:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803098:	c9                   	leave
+  803099:	c3                   	ret
+
+000000000080309a <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  80309a:	55                   	push   %rbp
+  80309b:	48 89 e5             	mov    %rsp,%rbp
+  80309e:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80309f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8030a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8030ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030b3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8030b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8030c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8030c9:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  8030cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030cf:	c9                   	leave
+  8030d0:	c3                   	ret
+
+00000000008030d1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030d1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030d8:	ff ff ff 
+  8030db:	48 01 f8             	add    %rdi,%rax
+  8030de:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8030e2:	c3                   	ret
+
+00000000008030e3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8030e3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8030ea:	ff ff ff 
+  8030ed:	48 01 f8             	add    %rdi,%rax
+  8030f0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8030f4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8030fa:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8030fe:	c3                   	ret
+
+00000000008030ff <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8030ff:	55                   	push   %rbp
+  803100:	48 89 e5             	mov    %rsp,%rbp
+  803103:	41 57                	push   %r15
+  803105:	41 56                	push   %r14
+  803107:	41 55                	push   %r13
+  803109:	41 54                	push   %r12
+  80310b:	53                   	push   %rbx
+  80310c:	48 83 ec 08          	sub    $0x8,%rsp
+  803110:	49 89 ff             	mov    %rdi,%r15
+  803113:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  803118:	49 bd ff 45 80 00 00 	movabs $0x8045ff,%r13
+  80311f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  803122:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  803128:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80312b:	48 89 df             	mov    %rbx,%rdi
+  80312e:	41 ff d5             	call   *%r13
+  803131:	83 e0 04             	and    $0x4,%eax
+  803134:	74 17                	je     80314d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  803136:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80313d:	4c 39 f3             	cmp    %r14,%rbx
+  803140:	75 e6                	jne    803128 <fd_alloc+0x29>
+  803142:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  803148:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80314d:	4d 89 27             	mov    %r12,(%r15)
+}
+  803150:	48 83 c4 08          	add    $0x8,%rsp
+  803154:	5b                   	pop    %rbx
+  803155:	41 5c                	pop    %r12
+  803157:	41 5d                	pop    %r13
+  803159:	41 5e                	pop    %r14
+  80315b:	41 5f                	pop    %r15
+  80315d:	5d                   	pop    %rbp
+  80315e:	c3                   	ret
+
+000000000080315f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80315f:	83 ff 1f             	cmp    $0x1f,%edi
+  803162:	77 39                	ja     80319d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803164:	55                   	push   %rbp
+  803165:	48 89 e5             	mov    %rsp,%rbp
+  803168:	41 54                	push   %r12
+  80316a:	53                   	push   %rbx
+  80316b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80316e:	48 63 df             	movslq %edi,%rbx
+  803171:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  803178:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80317c:	48 89 df             	mov    %rbx,%rdi
+  80317f:	48 b8 ff 45 80 00 00 	movabs $0x8045ff,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+  80318b:	a8 04                	test   $0x4,%al
+  80318d:	74 14                	je     8031a3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80318f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  803193:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803198:	5b                   	pop    %rbx
+  803199:	41 5c                	pop    %r12
+  80319b:	5d                   	pop    %rbp
+  80319c:	c3                   	ret
+        return -E_INVAL;
+  80319d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8031a2:	c3                   	ret
+        return -E_INVAL;
+  8031a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a8:	eb ee                	jmp    803198 <fd_lookup+0x39>
+
+00000000008031aa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031aa:	55                   	push   %rbp
+  8031ab:	48 89 e5             	mov    %rsp,%rbp
+  8031ae:	41 54                	push   %r12
+  8031b0:	53                   	push   %rbx
+  8031b1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8031b4:	48 b8 80 65 80 00 00 	movabs $0x806580,%rax
+  8031bb:	00 00 00 
+  8031be:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  8031c5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8031c8:	39 3b                	cmp    %edi,(%rbx)
+  8031ca:	74 47                	je     803213 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8031cc:	48 83 c0 08          	add    $0x8,%rax
+  8031d0:	48 8b 18             	mov    (%rax),%rbx
+  8031d3:	48 85 db             	test   %rbx,%rbx
+  8031d6:	75 f0                	jne    8031c8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8031d8:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8031df:	00 00 00 
+  8031e2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8031e8:	89 fa                	mov    %edi,%edx
+  8031ea:	48 bf f8 64 80 00 00 	movabs $0x8064f8,%rdi
+  8031f1:	00 00 00 
+  8031f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f9:	48 b9 d7 19 80 00 00 	movabs $0x8019d7,%rcx
+  803200:	00 00 00 
+  803203:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  803205:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80320a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80320e:	5b                   	pop    %rbx
+  80320f:	41 5c                	pop    %r12
+  803211:	5d                   	pop    %rbp
+  803212:	c3                   	ret
+            return 0;
+  803213:	b8 00 00 00 00       	mov    $0x0,%eax
+  803218:	eb f0                	jmp    80320a <dev_lookup+0x60>
+
+000000000080321a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80321a:	55                   	push   %rbp
+  80321b:	48 89 e5             	mov    %rsp,%rbp
+  80321e:	41 55                	push   %r13
+  803220:	41 54                	push   %r12
+  803222:	53                   	push   %rbx
+  803223:	48 83 ec 18          	sub    $0x18,%rsp
+  803227:	48 89 fb             	mov    %rdi,%rbx
+  80322a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80322d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  803234:	ff ff ff 
+  803237:	48 01 df             	add    %rbx,%rdi
+  80323a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80323e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803242:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+  80324e:	41 89 c5             	mov    %eax,%r13d
+  803251:	85 c0                	test   %eax,%eax
+  803253:	78 06                	js     80325b <fd_close+0x41>
+  803255:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  803259:	74 1a                	je     803275 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80325b:	45 84 e4             	test   %r12b,%r12b
+  80325e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803263:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  803267:	44 89 e8             	mov    %r13d,%eax
+  80326a:	48 83 c4 18          	add    $0x18,%rsp
+  80326e:	5b                   	pop    %rbx
+  80326f:	41 5c                	pop    %r12
+  803271:	41 5d                	pop    %r13
+  803273:	5d                   	pop    %rbp
+  803274:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803275:	8b 3b                	mov    (%rbx),%edi
+  803277:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80327b:	48 b8 aa 31 80 00 00 	movabs $0x8031aa,%rax
+  803282:	00 00 00 
+  803285:	ff d0                	call   *%rax
+  803287:	41 89 c5             	mov    %eax,%r13d
+  80328a:	85 c0                	test   %eax,%eax
+  80328c:	78 1b                	js     8032a9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80328e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803292:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803296:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80329c:	48 85 c0             	test   %rax,%rax
+  80329f:	74 08                	je     8032a9 <fd_close+0x8f>
+  8032a1:	48 89 df             	mov    %rbx,%rdi
+  8032a4:	ff d0                	call   *%rax
+  8032a6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8032a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032ae:	48 89 de             	mov    %rbx,%rsi
+  8032b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b6:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  8032bd:	00 00 00 
+  8032c0:	ff d0                	call   *%rax
+    return res;
+  8032c2:	eb a3                	jmp    803267 <fd_close+0x4d>
+
+00000000008032c4 <close>:
+
+int
+close(int fdnum) {
+  8032c4:	55                   	push   %rbp
+  8032c5:	48 89 e5             	mov    %rsp,%rbp
+  8032c8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8032cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032d0:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032dc:	85 c0                	test   %eax,%eax
+  8032de:	78 15                	js     8032f5 <close+0x31>
+
+    return fd_close(fd, 1);
+  8032e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8032e5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032e9:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+}
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+
+00000000008032f7 <close_all>:
+
+void
+close_all(void) {
+  8032f7:	55                   	push   %rbp
+  8032f8:	48 89 e5             	mov    %rsp,%rbp
+  8032fb:	41 54                	push   %r12
+  8032fd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8032fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803303:	49 bc c4 32 80 00 00 	movabs $0x8032c4,%r12
+  80330a:	00 00 00 
+  80330d:	89 df                	mov    %ebx,%edi
+  80330f:	41 ff d4             	call   *%r12
+  803312:	83 c3 01             	add    $0x1,%ebx
+  803315:	83 fb 20             	cmp    $0x20,%ebx
+  803318:	75 f3                	jne    80330d <close_all+0x16>
+}
+  80331a:	5b                   	pop    %rbx
+  80331b:	41 5c                	pop    %r12
+  80331d:	5d                   	pop    %rbp
+  80331e:	c3                   	ret
+
+000000000080331f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80331f:	55                   	push   %rbp
+  803320:	48 89 e5             	mov    %rsp,%rbp
+  803323:	41 57                	push   %r15
+  803325:	41 56                	push   %r14
+  803327:	41 55                	push   %r13
+  803329:	41 54                	push   %r12
+  80332b:	53                   	push   %rbx
+  80332c:	48 83 ec 18          	sub    $0x18,%rsp
+  803330:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  803333:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803337:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+  803343:	89 c3                	mov    %eax,%ebx
+  803345:	85 c0                	test   %eax,%eax
+  803347:	0f 88 b8 00 00 00    	js     803405 <dup+0xe6>
+    close(newfdnum);
+  80334d:	44 89 e7             	mov    %r12d,%edi
+  803350:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  803357:	00 00 00 
+  80335a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80335c:	4d 63 ec             	movslq %r12d,%r13
+  80335f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  803366:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80336a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80336e:	4c 89 ff             	mov    %r15,%rdi
+  803371:	49 be e3 30 80 00 00 	movabs $0x8030e3,%r14
+  803378:	00 00 00 
+  80337b:	41 ff d6             	call   *%r14
+  80337e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  803381:	4c 89 ef             	mov    %r13,%rdi
+  803384:	41 ff d6             	call   *%r14
+  803387:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80338a:	48 89 df             	mov    %rbx,%rdi
+  80338d:	48 b8 ff 45 80 00 00 	movabs $0x8045ff,%rax
+  803394:	00 00 00 
+  803397:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803399:	a8 04                	test   $0x4,%al
+  80339b:	74 2b                	je     8033c8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80339d:	41 89 c1             	mov    %eax,%r9d
+  8033a0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033a6:	4c 89 f1             	mov    %r14,%rcx
+  8033a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ae:	48 89 de             	mov    %rbx,%rsi
+  8033b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033b6:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  8033bd:	00 00 00 
+  8033c0:	ff d0                	call   *%rax
+  8033c2:	89 c3                	mov    %eax,%ebx
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 4e                	js     803416 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8033c8:	4c 89 ff             	mov    %r15,%rdi
+  8033cb:	48 b8 ff 45 80 00 00 	movabs $0x8045ff,%rax
+  8033d2:	00 00 00 
+  8033d5:	ff d0                	call   *%rax
+  8033d7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8033da:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8033e0:	4c 89 e9             	mov    %r13,%rcx
+  8033e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e8:	4c 89 fe             	mov    %r15,%rsi
+  8033eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f0:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+  8033fc:	89 c3                	mov    %eax,%ebx
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	78 14                	js     803416 <dup+0xf7>
+
+    return newfdnum;
+  803402:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  803405:	89 d8                	mov    %ebx,%eax
+  803407:	48 83 c4 18          	add    $0x18,%rsp
+  80340b:	5b                   	pop    %rbx
+  80340c:	41 5c                	pop    %r12
+  80340e:	41 5d                	pop    %r13
+  803410:	41 5e                	pop    %r14
+  803412:	41 5f                	pop    %r15
+  803414:	5d                   	pop    %rbp
+  803415:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  803416:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80341b:	4c 89 ee             	mov    %r13,%rsi
+  80341e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803423:	49 bc 4b 2b 80 00 00 	movabs $0x802b4b,%r12
+  80342a:	00 00 00 
+  80342d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803430:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803435:	4c 89 f6             	mov    %r14,%rsi
+  803438:	bf 00 00 00 00       	mov    $0x0,%edi
+  80343d:	41 ff d4             	call   *%r12
+    return res;
+  803440:	eb c3                	jmp    803405 <dup+0xe6>
+
+0000000000803442 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803442:	55                   	push   %rbp
+  803443:	48 89 e5             	mov    %rsp,%rbp
+  803446:	41 56                	push   %r14
+  803448:	41 55                	push   %r13
+  80344a:	41 54                	push   %r12
+  80344c:	53                   	push   %rbx
+  80344d:	48 83 ec 10          	sub    $0x10,%rsp
+  803451:	89 fb                	mov    %edi,%ebx
+  803453:	49 89 f4             	mov    %rsi,%r12
+  803456:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803459:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80345d:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803464:	00 00 00 
+  803467:	ff d0                	call   *%rax
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 4c                	js     8034b9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80346d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803471:	41 8b 3e             	mov    (%r14),%edi
+  803474:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803478:	48 b8 aa 31 80 00 00 	movabs $0x8031aa,%rax
+  80347f:	00 00 00 
+  803482:	ff d0                	call   *%rax
+  803484:	85 c0                	test   %eax,%eax
+  803486:	78 35                	js     8034bd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803488:	41 8b 46 08          	mov    0x8(%r14),%eax
+  80348c:	83 e0 03             	and    $0x3,%eax
+  80348f:	83 f8 01             	cmp    $0x1,%eax
+  803492:	74 2d                	je     8034c1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  803494:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803498:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80349c:	48 85 c0             	test   %rax,%rax
+  80349f:	74 56                	je     8034f7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8034a1:	4c 89 ea             	mov    %r13,%rdx
+  8034a4:	4c 89 e6             	mov    %r12,%rsi
+  8034a7:	4c 89 f7             	mov    %r14,%rdi
+  8034aa:	ff d0                	call   *%rax
+}
+  8034ac:	48 83 c4 10          	add    $0x10,%rsp
+  8034b0:	5b                   	pop    %rbx
+  8034b1:	41 5c                	pop    %r12
+  8034b3:	41 5d                	pop    %r13
+  8034b5:	41 5e                	pop    %r14
+  8034b7:	5d                   	pop    %rbp
+  8034b8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034b9:	48 98                	cltq
+  8034bb:	eb ef                	jmp    8034ac <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034bd:	48 98                	cltq
+  8034bf:	eb eb                	jmp    8034ac <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8034c1:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8034c8:	00 00 00 
+  8034cb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8034d1:	89 da                	mov    %ebx,%edx
+  8034d3:	48 bf 39 65 80 00 00 	movabs $0x806539,%rdi
+  8034da:	00 00 00 
+  8034dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e2:	48 b9 d7 19 80 00 00 	movabs $0x8019d7,%rcx
+  8034e9:	00 00 00 
+  8034ec:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8034ee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8034f5:	eb b5                	jmp    8034ac <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8034f7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8034fe:	eb ac                	jmp    8034ac <read+0x6a>
+
+0000000000803500 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803500:	55                   	push   %rbp
+  803501:	48 89 e5             	mov    %rsp,%rbp
+  803504:	41 57                	push   %r15
+  803506:	41 56                	push   %r14
+  803508:	41 55                	push   %r13
+  80350a:	41 54                	push   %r12
+  80350c:	53                   	push   %rbx
+  80350d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803511:	48 85 d2             	test   %rdx,%rdx
+  803514:	74 54                	je     80356a <readn+0x6a>
+  803516:	41 89 fd             	mov    %edi,%r13d
+  803519:	49 89 f6             	mov    %rsi,%r14
+  80351c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80351f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  803524:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803529:	49 bf 42 34 80 00 00 	movabs $0x803442,%r15
+  803530:	00 00 00 
+  803533:	4c 89 e2             	mov    %r12,%rdx
+  803536:	48 29 f2             	sub    %rsi,%rdx
+  803539:	4c 01 f6             	add    %r14,%rsi
+  80353c:	44 89 ef             	mov    %r13d,%edi
+  80353f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  803542:	85 c0                	test   %eax,%eax
+  803544:	78 20                	js     803566 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  803546:	01 c3                	add    %eax,%ebx
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	74 08                	je     803554 <readn+0x54>
+  80354c:	48 63 f3             	movslq %ebx,%rsi
+  80354f:	4c 39 e6             	cmp    %r12,%rsi
+  803552:	72 df                	jb     803533 <readn+0x33>
+    }
+    return res;
+  803554:	48 63 c3             	movslq %ebx,%rax
+}
+  803557:	48 83 c4 08          	add    $0x8,%rsp
+  80355b:	5b                   	pop    %rbx
+  80355c:	41 5c                	pop    %r12
+  80355e:	41 5d                	pop    %r13
+  803560:	41 5e                	pop    %r14
+  803562:	41 5f                	pop    %r15
+  803564:	5d                   	pop    %rbp
+  803565:	c3                   	ret
+        if (inc < 0) return inc;
+  803566:	48 98                	cltq
+  803568:	eb ed                	jmp    803557 <readn+0x57>
+    int inc = 1, res = 0;
+  80356a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80356f:	eb e3                	jmp    803554 <readn+0x54>
+
+0000000000803571 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803571:	55                   	push   %rbp
+  803572:	48 89 e5             	mov    %rsp,%rbp
+  803575:	41 56                	push   %r14
+  803577:	41 55                	push   %r13
+  803579:	41 54                	push   %r12
+  80357b:	53                   	push   %rbx
+  80357c:	48 83 ec 10          	sub    $0x10,%rsp
+  803580:	89 fb                	mov    %edi,%ebx
+  803582:	49 89 f4             	mov    %rsi,%r12
+  803585:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803588:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80358c:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803593:	00 00 00 
+  803596:	ff d0                	call   *%rax
+  803598:	85 c0                	test   %eax,%eax
+  80359a:	78 47                	js     8035e3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80359c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8035a0:	41 8b 3e             	mov    (%r14),%edi
+  8035a3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8035a7:	48 b8 aa 31 80 00 00 	movabs $0x8031aa,%rax
+  8035ae:	00 00 00 
+  8035b1:	ff d0                	call   *%rax
+  8035b3:	85 c0                	test   %eax,%eax
+  8035b5:	78 30                	js     8035e7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8035b7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8035bc:	74 2d                	je     8035eb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8035be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035c2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035c6:	48 85 c0             	test   %rax,%rax
+  8035c9:	74 56                	je     803621 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8035cb:	4c 89 ea             	mov    %r13,%rdx
+  8035ce:	4c 89 e6             	mov    %r12,%rsi
+  8035d1:	4c 89 f7             	mov    %r14,%rdi
+  8035d4:	ff d0                	call   *%rax
+}
+  8035d6:	48 83 c4 10          	add    $0x10,%rsp
+  8035da:	5b                   	pop    %rbx
+  8035db:	41 5c                	pop    %r12
+  8035dd:	41 5d                	pop    %r13
+  8035df:	41 5e                	pop    %r14
+  8035e1:	5d                   	pop    %rbp
+  8035e2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8035e3:	48 98                	cltq
+  8035e5:	eb ef                	jmp    8035d6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8035e7:	48 98                	cltq
+  8035e9:	eb eb                	jmp    8035d6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8035eb:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8035f2:	00 00 00 
+  8035f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8035fb:	89 da                	mov    %ebx,%edx
+  8035fd:	48 bf 55 65 80 00 00 	movabs $0x806555,%rdi
+  803604:	00 00 00 
+  803607:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360c:	48 b9 d7 19 80 00 00 	movabs $0x8019d7,%rcx
+  803613:	00 00 00 
+  803616:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803618:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80361f:	eb b5                	jmp    8035d6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803621:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803628:	eb ac                	jmp    8035d6 <write+0x65>
+
+000000000080362a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80362a:	55                   	push   %rbp
+  80362b:	48 89 e5             	mov    %rsp,%rbp
+  80362e:	53                   	push   %rbx
+  80362f:	48 83 ec 18          	sub    $0x18,%rsp
+  803633:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803635:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803639:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803640:	00 00 00 
+  803643:	ff d0                	call   *%rax
+  803645:	85 c0                	test   %eax,%eax
+  803647:	78 0c                	js     803655 <seek+0x2b>
+
+    fd->fd_offset = offset;
+  803649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80364d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  803650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803655:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803659:	c9                   	leave
+  80365a:	c3                   	ret
+
+000000000080365b <tell>:
+
+int tell(int fdnum) {
+  80365b:	55                   	push   %rbp
+  80365c:	48 89 e5             	mov    %rsp,%rbp
+  80365f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803663:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803667:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80366e:	00 00 00 
+  803671:	ff d0                	call   *%rax
+  803673:	85 c0                	test   %eax,%eax
+  803675:	78 07                	js     80367e <tell+0x23>
+
+    return fd->fd_offset;
+  803677:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80367b:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+
+0000000000803680 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	41 55                	push   %r13
+  803686:	41 54                	push   %r12
+  803688:	53                   	push   %rbx
+  803689:	48 83 ec 18          	sub    $0x18,%rsp
+  80368d:	89 fb                	mov    %edi,%ebx
+  80368f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803692:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803696:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	78 38                	js     8036de <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8036a6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8036aa:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8036ae:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8036b2:	48 b8 aa 31 80 00 00 	movabs $0x8031aa,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+  8036be:	85 c0                	test   %eax,%eax
+  8036c0:	78 1c                	js     8036de <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8036c2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8036c7:	74 20                	je     8036e9 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8036c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036cd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036d1:	48 85 c0             	test   %rax,%rax
+  8036d4:	74 47                	je     80371d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8036d6:	44 89 e6             	mov    %r12d,%esi
+  8036d9:	4c 89 ef             	mov    %r13,%rdi
+  8036dc:	ff d0                	call   *%rax
+}
+  8036de:	48 83 c4 18          	add    $0x18,%rsp
+  8036e2:	5b                   	pop    %rbx
+  8036e3:	41 5c                	pop    %r12
+  8036e5:	41 5d                	pop    %r13
+  8036e7:	5d                   	pop    %rbp
+  8036e8:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8036e9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8036f0:	00 00 00 
+  8036f3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8036f9:	89 da                	mov    %ebx,%edx
+  8036fb:	48 bf 18 65 80 00 00 	movabs $0x806518,%rdi
+  803702:	00 00 00 
+  803705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370a:	48 b9 d7 19 80 00 00 	movabs $0x8019d7,%rcx
+  803711:	00 00 00 
+  803714:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803716:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80371b:	eb c1                	jmp    8036de <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80371d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803722:	eb ba                	jmp    8036de <ftruncate+0x5e>
+
+0000000000803724 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803724:	55                   	push   %rbp
+  803725:	48 89 e5             	mov    %rsp,%rbp
+  803728:	41 54                	push   %r12
+  80372a:	53                   	push   %rbx
+  80372b:	48 83 ec 10          	sub    $0x10,%rsp
+  80372f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803732:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803736:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80373d:	00 00 00 
+  803740:	ff d0                	call   *%rax
+  803742:	85 c0                	test   %eax,%eax
+  803744:	78 63                	js     8037a9 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803746:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80374a:	41 8b 3c 24          	mov    (%r12),%edi
+  80374e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  803752:	48 b8 aa 31 80 00 00 	movabs $0x8031aa,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+  80375e:	85 c0                	test   %eax,%eax
+  803760:	78 47                	js     8037a9 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803762:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803766:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80376b:	74 45                	je     8037b2 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  80376d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  803770:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  803777:	00 00 00 
+    stat->st_isdir = 0;
+  80377a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803781:	00 00 00 
+    stat->st_ino = 0;
+  803784:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  80378b:	00 00 00 00 
+    stat->st_version = 0;
+  80378f:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  803796:	00 00 00 
+    stat->st_dev = dev;
+  803799:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8037a0:	48 89 de             	mov    %rbx,%rsi
+  8037a3:	4c 89 e7             	mov    %r12,%rdi
+  8037a6:	ff 50 28             	call   *0x28(%rax)
+}
+  8037a9:	48 83 c4 10          	add    $0x10,%rsp
+  8037ad:	5b                   	pop    %rbx
+  8037ae:	41 5c                	pop    %r12
+  8037b0:	5d                   	pop    %rbp
+  8037b1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8037b2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8037b7:	eb f0                	jmp    8037a9 <fstat+0x85>
+
+00000000008037b9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8037b9:	55                   	push   %rbp
+  8037ba:	48 89 e5             	mov    %rsp,%rbp
+  8037bd:	41 54                	push   %r12
+  8037bf:	53                   	push   %rbx
+  8037c0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8037c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037c8:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  8037cf:	00 00 00 
+  8037d2:	ff d0                	call   *%rax
+  8037d4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8037d6:	85 c0                	test   %eax,%eax
+  8037d8:	78 25                	js     8037ff <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8037da:	4c 89 e6             	mov    %r12,%rsi
+  8037dd:	89 c7                	mov    %eax,%edi
+  8037df:	48 b8 24 37 80 00 00 	movabs $0x803724,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+  8037eb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8037ee:	89 df                	mov    %ebx,%edi
+  8037f0:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  8037f7:	00 00 00 
+  8037fa:	ff d0                	call   *%rax
+
+    return res;
+  8037fc:	44 89 e3             	mov    %r12d,%ebx
+}
+  8037ff:	89 d8                	mov    %ebx,%eax
+  803801:	5b                   	pop    %rbx
+  803802:	41 5c                	pop    %r12
+  803804:	5d                   	pop    %rbp
+  803805:	c3                   	ret
+
+0000000000803806 <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803806:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  80380d:	00 00 00 
+  803810:	83 38 00             	cmpl   $0x0,(%rax)
+  803813:	74 0a                	je     80381f <fsipc_env+0x19>
+    return fsenv;
+}
+  803815:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  80381c:	00 00 
+  80381e:	c3                   	ret
+fsipc_env(void) {
+  80381f:	55                   	push   %rbp
+  803820:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  803823:	bf 03 00 00 00       	mov    $0x3,%edi
+  803828:	48 b8 c0 59 80 00 00 	movabs $0x8059c0,%rax
+  80382f:	00 00 00 
+  803832:	ff d0                	call   *%rax
+  803834:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  80383b:	00 00 
+}
+  80383d:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803844:	00 00 
+  803846:	5d                   	pop    %rbp
+  803847:	c3                   	ret
+
+0000000000803848 <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  803848:	55                   	push   %rbp
+  803849:	48 89 e5             	mov    %rsp,%rbp
+  80384c:	53                   	push   %rbx
+  80384d:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  803851:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803858:	00 
+  803859:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  803860:	00 
+  803861:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  803868:	00 
+  803869:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  803870:	00 
+  803871:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  803878:	00 
+
+    assert(size <= sizeof(words));
+  803879:	48 83 fa 28          	cmp    $0x28,%rdx
+  80387d:	77 38                	ja     8038b7 <fsipc_short+0x6f>
+  80387f:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  803881:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  803885:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  80388c:	00 00 00 
+  80388f:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  803891:	48 b8 06 38 80 00 00 	movabs $0x803806,%rax
+  803898:	00 00 00 
+  80389b:	ff d0                	call   *%rax
+  80389d:	89 c7                	mov    %eax,%edi
+  80389f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8038a3:	89 de                	mov    %ebx,%esi
+  8038a5:	48 b8 23 59 80 00 00 	movabs $0x805923,%rax
+  8038ac:	00 00 00 
+  8038af:	ff d0                	call   *%rax
+}
+  8038b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038b5:	c9                   	leave
+  8038b6:	c3                   	ret
+    assert(size <= sizeof(words));
+  8038b7:	48 b9 a0 65 80 00 00 	movabs $0x8065a0,%rcx
+  8038be:	00 00 00 
+  8038c1:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8038c8:	00 00 00 
+  8038cb:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8038d0:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  8038d7:	00 00 00 
+  8038da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038df:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8038e6:	00 00 00 
+  8038e9:	41 ff d0             	call   *%r8
+
+00000000008038ec <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8038ec:	55                   	push   %rbp
+  8038ed:	48 89 e5             	mov    %rsp,%rbp
+  8038f0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  8038f4:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8038f7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8038fa:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  8038fd:	ba 08 00 00 00       	mov    $0x8,%edx
+  803902:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803906:	bf 02 00 00 00       	mov    $0x2,%edi
+  80390b:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  803912:	00 00 00 
+  803915:	ff d0                	call   *%rax
+}
+  803917:	c9                   	leave
+  803918:	c3                   	ret
+
+0000000000803919 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803919:	55                   	push   %rbp
+  80391a:	48 89 e5             	mov    %rsp,%rbp
+  80391d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803921:	8b 47 0c             	mov    0xc(%rdi),%eax
+  803924:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  803927:	ba 04 00 00 00       	mov    $0x4,%edx
+  80392c:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803930:	bf 06 00 00 00       	mov    $0x6,%edi
+  803935:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  80393c:	00 00 00 
+  80393f:	ff d0                	call   *%rax
+}
+  803941:	c9                   	leave
+  803942:	c3                   	ret
+
+0000000000803943 <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  803943:	55                   	push   %rbp
+  803944:	48 89 e5             	mov    %rsp,%rbp
+  803947:	41 54                	push   %r12
+  803949:	53                   	push   %rbx
+  80394a:	48 83 ec 10          	sub    $0x10,%rsp
+  80394e:	89 fb                	mov    %edi,%ebx
+  803950:	49 89 f4             	mov    %rsi,%r12
+  803953:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  803957:	48 b8 06 38 80 00 00 	movabs $0x803806,%rax
+  80395e:	00 00 00 
+  803961:	ff d0                	call   *%rax
+  803963:	89 c7                	mov    %eax,%edi
+  803965:	6a 00                	push   $0x0
+  803967:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  80396b:	50                   	push   %rax
+  80396c:	4d 89 e1             	mov    %r12,%r9
+  80396f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803975:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80397a:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  803981:	00 00 00 
+  803984:	89 de                	mov    %ebx,%esi
+  803986:	48 b8 be 58 80 00 00 	movabs $0x8058be,%rax
+  80398d:	00 00 00 
+  803990:	ff d0                	call   *%rax
+}
+  803992:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  803996:	5b                   	pop    %rbx
+  803997:	41 5c                	pop    %r12
+  803999:	5d                   	pop    %rbp
+  80399a:	c3                   	ret
+
+000000000080399b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80399b:	55                   	push   %rbp
+  80399c:	48 89 e5             	mov    %rsp,%rbp
+  80399f:	41 54                	push   %r12
+  8039a1:	53                   	push   %rbx
+  8039a2:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8039a5:	8b 47 0c             	mov    0xc(%rdi),%eax
+  8039a8:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  8039af:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8039b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8039bb:	bf 05 00 00 00       	mov    $0x5,%edi
+  8039c0:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  8039c7:	00 00 00 
+  8039ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039cc:	85 c0                	test   %eax,%eax
+  8039ce:	78 5a                	js     803a2a <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8039d0:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  8039d7:	00 00 00 
+  8039da:	4c 89 e6             	mov    %r12,%rsi
+  8039dd:	48 89 df             	mov    %rbx,%rdi
+  8039e0:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  8039e7:	00 00 00 
+  8039ea:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8039ec:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8039f3:	00 
+  8039f4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8039fa:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803a01:	00 
+  803a02:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  803a08:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803a0f:	00 
+  803a10:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  803a17:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803a1e:	00 
+  803a1f:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  803a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a2a:	5b                   	pop    %rbx
+  803a2b:	41 5c                	pop    %r12
+  803a2d:	5d                   	pop    %rbp
+  803a2e:	c3                   	ret
+
+0000000000803a2f <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a2f:	55                   	push   %rbp
+  803a30:	48 89 e5             	mov    %rsp,%rbp
+  803a33:	41 57                	push   %r15
+  803a35:	41 56                	push   %r14
+  803a37:	41 55                	push   %r13
+  803a39:	41 54                	push   %r12
+  803a3b:	53                   	push   %rbx
+  803a3c:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  803a40:	48 85 ff             	test   %rdi,%rdi
+  803a43:	0f 84 a1 00 00 00    	je     803aea <devfile_read+0xbb>
+  803a49:	49 89 ff             	mov    %rdi,%r15
+  803a4c:	49 89 f5             	mov    %rsi,%r13
+  803a4f:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  803a52:	48 85 f6             	test   %rsi,%rsi
+  803a55:	0f 84 c4 00 00 00    	je     803b1f <devfile_read+0xf0>
+    size_t total_read = 0;
+  803a5b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803a62:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a63:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803a6a:	00 00 00 
+  803a6d:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803a71:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  803a74:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803a78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803a82:	bf 03 00 00 00       	mov    $0x3,%edi
+  803a87:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  803a8e:	00 00 00 
+  803a91:	ff d0                	call   *%rax
+        if (res < 0) {
+  803a93:	85 c0                	test   %eax,%eax
+  803a95:	0f 88 b9 00 00 00    	js     803b54 <devfile_read+0x125>
+        assert(res <= n);
+  803a9b:	48 63 d8             	movslq %eax,%rbx
+  803a9e:	49 39 dc             	cmp    %rbx,%r12
+  803aa1:	0f 82 b1 00 00 00    	jb     803b58 <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803aa7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803aac:	0f 87 db 00 00 00    	ja     803b8d <devfile_read+0x15e>
+        if (!res) {
+  803ab2:	85 c0                	test   %eax,%eax
+  803ab4:	74 21                	je     803ad7 <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803ab6:	48 89 da             	mov    %rbx,%rdx
+  803ab9:	4c 89 f6             	mov    %r14,%rsi
+  803abc:	4c 89 ef             	mov    %r13,%rdi
+  803abf:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803ac6:	00 00 00 
+  803ac9:	ff d0                	call   *%rax
+        total_read += res;
+  803acb:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803acf:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803ad2:	49 29 dc             	sub    %rbx,%r12
+  803ad5:	75 96                	jne    803a6d <devfile_read+0x3e>
+    return total_read;
+  803ad7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803adb:	48 83 c4 18          	add    $0x18,%rsp
+  803adf:	5b                   	pop    %rbx
+  803ae0:	41 5c                	pop    %r12
+  803ae2:	41 5d                	pop    %r13
+  803ae4:	41 5e                	pop    %r14
+  803ae6:	41 5f                	pop    %r15
+  803ae8:	5d                   	pop    %rbp
+  803ae9:	c3                   	ret
+    assert(fd);
+  803aea:	48 b9 d6 65 80 00 00 	movabs $0x8065d6,%rcx
+  803af1:	00 00 00 
+  803af4:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803afb:	00 00 00 
+  803afe:	be 91 00 00 00       	mov    $0x91,%esi
+  803b03:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803b0a:	00 00 00 
+  803b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b12:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803b19:	00 00 00 
+  803b1c:	41 ff d0             	call   *%r8
+    assert(buf);
+  803b1f:	48 b9 d9 65 80 00 00 	movabs $0x8065d9,%rcx
+  803b26:	00 00 00 
+  803b29:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803b30:	00 00 00 
+  803b33:	be 92 00 00 00       	mov    $0x92,%esi
+  803b38:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803b3f:	00 00 00 
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b47:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803b4e:	00 00 00 
+  803b51:	41 ff d0             	call   *%r8
+            return res;
+  803b54:	48 98                	cltq
+  803b56:	eb 83                	jmp    803adb <devfile_read+0xac>
+        assert(res <= n);
+  803b58:	48 b9 dd 65 80 00 00 	movabs $0x8065dd,%rcx
+  803b5f:	00 00 00 
+  803b62:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803b69:	00 00 00 
+  803b6c:	be 9e 00 00 00       	mov    $0x9e,%esi
+  803b71:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803b78:	00 00 00 
+  803b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b80:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803b87:	00 00 00 
+  803b8a:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  803b8d:	48 b9 e8 65 80 00 00 	movabs $0x8065e8,%rcx
+  803b94:	00 00 00 
+  803b97:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803b9e:	00 00 00 
+  803ba1:	be 9f 00 00 00       	mov    $0x9f,%esi
+  803ba6:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803bad:	00 00 00 
+  803bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb5:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803bbc:	00 00 00 
+  803bbf:	41 ff d0             	call   *%r8
+
+0000000000803bc2 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803bc2:	55                   	push   %rbp
+  803bc3:	48 89 e5             	mov    %rsp,%rbp
+  803bc6:	41 57                	push   %r15
+  803bc8:	41 56                	push   %r14
+  803bca:	41 55                	push   %r13
+  803bcc:	41 54                	push   %r12
+  803bce:	53                   	push   %rbx
+  803bcf:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  803bd3:	48 85 ff             	test   %rdi,%rdi
+  803bd6:	0f 84 83 00 00 00    	je     803c5f <devfile_write+0x9d>
+  803bdc:	49 89 ff             	mov    %rdi,%r15
+  803bdf:	49 89 f4             	mov    %rsi,%r12
+  803be2:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  803be5:	48 85 f6             	test   %rsi,%rsi
+  803be8:	0f 84 a6 00 00 00    	je     803c94 <devfile_write+0xd2>
+    size_t total_written = 0;
+  803bee:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803bf4:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803bfb:	00 00 00 
+  803bfe:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803c02:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  803c05:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803c09:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803c0e:	48 39 d3             	cmp    %rdx,%rbx
+  803c11:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  803c15:	4c 89 e6             	mov    %r12,%rsi
+  803c18:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803c1f:	00 00 00 
+  803c22:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803c29:	00 00 00 
+  803c2c:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803c2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c33:	be 00 00 00 00       	mov    $0x0,%esi
+  803c38:	bf 04 00 00 00       	mov    $0x4,%edi
+  803c3d:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  803c44:	00 00 00 
+  803c47:	ff d0                	call   *%rax
+        if (res < 0) {
+  803c49:	85 c0                	test   %eax,%eax
+  803c4b:	78 7c                	js     803cc9 <devfile_write+0x107>
+        total_written += res;
+  803c4d:	48 98                	cltq
+  803c4f:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  803c52:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  803c55:	48 29 c3             	sub    %rax,%rbx
+  803c58:	75 a4                	jne    803bfe <devfile_write+0x3c>
+    return total_written;
+  803c5a:	4c 89 e8             	mov    %r13,%rax
+  803c5d:	eb 6c                	jmp    803ccb <devfile_write+0x109>
+    assert(fd);
+  803c5f:	48 b9 d6 65 80 00 00 	movabs $0x8065d6,%rcx
+  803c66:	00 00 00 
+  803c69:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803c70:	00 00 00 
+  803c73:	be bd 00 00 00       	mov    $0xbd,%esi
+  803c78:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803c7f:	00 00 00 
+  803c82:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c87:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803c8e:	00 00 00 
+  803c91:	41 ff d0             	call   *%r8
+    assert(buf);
+  803c94:	48 b9 d9 65 80 00 00 	movabs $0x8065d9,%rcx
+  803c9b:	00 00 00 
+  803c9e:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  803ca5:	00 00 00 
+  803ca8:	be be 00 00 00       	mov    $0xbe,%esi
+  803cad:	48 bf cb 65 80 00 00 	movabs $0x8065cb,%rdi
+  803cb4:	00 00 00 
+  803cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbc:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  803cc3:	00 00 00 
+  803cc6:	41 ff d0             	call   *%r8
+            return res;
+  803cc9:	48 98                	cltq
+}
+  803ccb:	48 83 c4 08          	add    $0x8,%rsp
+  803ccf:	5b                   	pop    %rbx
+  803cd0:	41 5c                	pop    %r12
+  803cd2:	41 5d                	pop    %r13
+  803cd4:	41 5e                	pop    %r14
+  803cd6:	41 5f                	pop    %r15
+  803cd8:	5d                   	pop    %rbp
+  803cd9:	c3                   	ret
+
+0000000000803cda <open>:
+open(const char *path, int mode) {
+  803cda:	55                   	push   %rbp
+  803cdb:	48 89 e5             	mov    %rsp,%rbp
+  803cde:	41 55                	push   %r13
+  803ce0:	41 54                	push   %r12
+  803ce2:	53                   	push   %rbx
+  803ce3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ce7:	49 89 fc             	mov    %rdi,%r12
+  803cea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ced:	48 b8 d0 22 80 00 00 	movabs $0x8022d0,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+  803cf9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803cff:	0f 87 8f 00 00 00    	ja     803d94 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d09:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+  803d15:	89 c3                	mov    %eax,%ebx
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	78 55                	js     803d70 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d1b:	4c 89 e6             	mov    %r12,%rsi
+  803d1e:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803d25:	00 00 00 
+  803d28:	48 89 df             	mov    %rbx,%rdi
+  803d2b:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803d3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d47:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d4c:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+  803d58:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d5a:	85 c0                	test   %eax,%eax
+  803d5c:	78 1f                	js     803d7d <open+0xa3>
+    return fd2num(fd);
+  803d5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d62:	48 b8 d1 30 80 00 00 	movabs $0x8030d1,%rax
+  803d69:	00 00 00 
+  803d6c:	ff d0                	call   *%rax
+  803d6e:	89 c3                	mov    %eax,%ebx
+}
+  803d70:	89 d8                	mov    %ebx,%eax
+  803d72:	48 83 c4 18          	add    $0x18,%rsp
+  803d76:	5b                   	pop    %rbx
+  803d77:	41 5c                	pop    %r12
+  803d79:	41 5d                	pop    %r13
+  803d7b:	5d                   	pop    %rbp
+  803d7c:	c3                   	ret
+        fd_close(fd, 0);
+  803d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d86:	48 b8 1a 32 80 00 00 	movabs $0x80321a,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+        return res;
+  803d92:	eb dc                	jmp    803d70 <open+0x96>
+        return -E_BAD_PATH;
+  803d94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d99:	eb d5                	jmp    803d70 <open+0x96>
+
+0000000000803d9b <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803d9b:	55                   	push   %rbp
+  803d9c:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803da4:	be 00 00 00 00       	mov    $0x0,%esi
+  803da9:	bf 08 00 00 00       	mov    $0x8,%edi
+  803dae:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  803db5:	00 00 00 
+  803db8:	ff d0                	call   *%rax
+}
+  803dba:	5d                   	pop    %rbp
+  803dbb:	c3                   	ret
+
+0000000000803dbc <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803dbc:	55                   	push   %rbp
+  803dbd:	48 89 e5             	mov    %rsp,%rbp
+  803dc0:	41 56                	push   %r14
+  803dc2:	41 55                	push   %r13
+  803dc4:	41 54                	push   %r12
+  803dc6:	53                   	push   %rbx
+  803dc7:	48 83 ec 10          	sub    $0x10,%rsp
+  803dcb:	41 89 f6             	mov    %esi,%r14d
+  803dce:	49 89 d4             	mov    %rdx,%r12
+  803dd1:	48 89 cb             	mov    %rcx,%rbx
+  803dd4:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803dd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ddb:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803de2:	00 00 00 
+  803de5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803de7:	85 c0                	test   %eax,%eax
+  803de9:	78 46                	js     803e31 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803deb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803def:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803df6:	00 00 00 
+  803df9:	8b 00                	mov    (%rax),%eax
+  803dfb:	39 02                	cmp    %eax,(%rdx)
+  803dfd:	75 3f                	jne    803e3e <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803dff:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803e06:	00 00 00 
+  803e09:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803e0c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803e0e:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803e12:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803e16:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803e1a:	48 89 da             	mov    %rbx,%rdx
+  803e1d:	4c 89 e6             	mov    %r12,%rsi
+  803e20:	bf 09 00 00 00       	mov    $0x9,%edi
+  803e25:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+}
+  803e31:	48 83 c4 10          	add    $0x10,%rsp
+  803e35:	5b                   	pop    %rbx
+  803e36:	41 5c                	pop    %r12
+  803e38:	41 5d                	pop    %r13
+  803e3a:	41 5e                	pop    %r14
+  803e3c:	5d                   	pop    %rbp
+  803e3d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e3e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803e43:	eb ec                	jmp    803e31 <file_map+0x75>
+
+0000000000803e45 <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803e45:	55                   	push   %rbp
+  803e46:	48 89 e5             	mov    %rsp,%rbp
+  803e49:	41 54                	push   %r12
+  803e4b:	53                   	push   %rbx
+  803e4c:	48 83 ec 20          	sub    $0x20,%rsp
+  803e50:	41 89 f4             	mov    %esi,%r12d
+  803e53:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803e56:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803e5a:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  803e61:	00 00 00 
+  803e64:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e66:	85 c0                	test   %eax,%eax
+  803e68:	78 3c                	js     803ea6 <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803e6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e6e:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803e75:	00 00 00 
+  803e78:	8b 0a                	mov    (%rdx),%ecx
+  803e7a:	39 08                	cmp    %ecx,(%rax)
+  803e7c:	75 31                	jne    803eaf <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803e7e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e81:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803e84:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803e88:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803e8c:	ba 10 00 00 00       	mov    $0x10,%edx
+  803e91:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803e95:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803e9a:	48 b8 48 38 80 00 00 	movabs $0x803848,%rax
+  803ea1:	00 00 00 
+  803ea4:	ff d0                	call   *%rax
+}
+  803ea6:	48 83 c4 20          	add    $0x20,%rsp
+  803eaa:	5b                   	pop    %rbx
+  803eab:	41 5c                	pop    %r12
+  803ead:	5d                   	pop    %rbp
+  803eae:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803eaf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803eb4:	eb f0                	jmp    803ea6 <file_msync+0x61>
+
+0000000000803eb6 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803eb6:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803eba:	7f 01                	jg     803ebd <writebuf+0x7>
+  803ebc:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803ebd:	55                   	push   %rbp
+  803ebe:	48 89 e5             	mov    %rsp,%rbp
+  803ec1:	53                   	push   %rbx
+  803ec2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ec6:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803ec9:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ecd:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803ed1:	8b 3f                	mov    (%rdi),%edi
+  803ed3:	48 b8 71 35 80 00 00 	movabs $0x803571,%rax
+  803eda:	00 00 00 
+  803edd:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803edf:	48 85 c0             	test   %rax,%rax
+  803ee2:	7e 04                	jle    803ee8 <writebuf+0x32>
+  803ee4:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803ee8:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803eec:	48 39 c2             	cmp    %rax,%rdx
+  803eef:	74 0f                	je     803f00 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803ef1:	48 85 c0             	test   %rax,%rax
+  803ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ef9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803efd:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803f00:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f04:	c9                   	leave
+  803f05:	c3                   	ret
+
+0000000000803f06 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803f06:	8b 46 04             	mov    0x4(%rsi),%eax
+  803f09:	8d 50 01             	lea    0x1(%rax),%edx
+  803f0c:	89 56 04             	mov    %edx,0x4(%rsi)
+  803f0f:	48 98                	cltq
+  803f11:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803f16:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803f1c:	74 01                	je     803f1f <putch+0x19>
+  803f1e:	c3                   	ret
+putch(int ch, void *arg) {
+  803f1f:	55                   	push   %rbp
+  803f20:	48 89 e5             	mov    %rsp,%rbp
+  803f23:	53                   	push   %rbx
+  803f24:	48 83 ec 08          	sub    $0x8,%rsp
+  803f28:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803f2b:	48 89 f7             	mov    %rsi,%rdi
+  803f2e:	48 b8 b6 3e 80 00 00 	movabs $0x803eb6,%rax
+  803f35:	00 00 00 
+  803f38:	ff d0                	call   *%rax
+        state->offset = 0;
+  803f3a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803f41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f45:	c9                   	leave
+  803f46:	c3                   	ret
+
+0000000000803f47 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803f47:	55                   	push   %rbp
+  803f48:	48 89 e5             	mov    %rsp,%rbp
+  803f4b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803f52:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803f55:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803f5b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803f62:	00 00 00 
+    state.result = 0;
+  803f65:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803f6c:	00 00 00 00 
+    state.error = 1;
+  803f70:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803f77:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803f7a:	48 89 f2             	mov    %rsi,%rdx
+  803f7d:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803f84:	48 bf 06 3f 80 00 00 	movabs $0x803f06,%rdi
+  803f8b:	00 00 00 
+  803f8e:	48 b8 27 1b 80 00 00 	movabs $0x801b27,%rax
+  803f95:	00 00 00 
+  803f98:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803f9a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803fa1:	7f 14                	jg     803fb7 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803fa3:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803faa:	48 85 c0             	test   %rax,%rax
+  803fad:	75 06                	jne    803fb5 <vfprintf+0x6e>
+  803faf:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803fb5:	c9                   	leave
+  803fb6:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803fb7:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803fbe:	48 b8 b6 3e 80 00 00 	movabs $0x803eb6,%rax
+  803fc5:	00 00 00 
+  803fc8:	ff d0                	call   *%rax
+  803fca:	eb d7                	jmp    803fa3 <vfprintf+0x5c>
+
+0000000000803fcc <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803fcc:	55                   	push   %rbp
+  803fcd:	48 89 e5             	mov    %rsp,%rbp
+  803fd0:	48 83 ec 50          	sub    $0x50,%rsp
+  803fd4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803fd8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803fdc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803fe0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803fe4:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803feb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803fef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ff3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ff7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803ffb:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803fff:	48 b8 47 3f 80 00 00 	movabs $0x803f47,%rax
+  804006:	00 00 00 
+  804009:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80400b:	c9                   	leave
+  80400c:	c3                   	ret
+
+000000000080400d <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80400d:	55                   	push   %rbp
+  80400e:	48 89 e5             	mov    %rsp,%rbp
+  804011:	48 83 ec 50          	sub    $0x50,%rsp
+  804015:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  804019:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80401d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804021:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804025:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  804029:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804030:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804034:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804038:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80403c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804040:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804044:	48 89 fe             	mov    %rdi,%rsi
+  804047:	bf 01 00 00 00       	mov    $0x1,%edi
+  80404c:	48 b8 47 3f 80 00 00 	movabs $0x803f47,%rax
+  804053:	00 00 00 
+  804056:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  804058:	c9                   	leave
+  804059:	c3                   	ret
+
+000000000080405a <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	41 54                	push   %r12
+  804060:	53                   	push   %rbx
+  804061:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804064:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  80406b:	00 00 00 
+  80406e:	ff d0                	call   *%rax
+  804070:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804073:	48 be 10 66 80 00 00 	movabs $0x806610,%rsi
+  80407a:	00 00 00 
+  80407d:	48 89 df             	mov    %rbx,%rdi
+  804080:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  804087:	00 00 00 
+  80408a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80408c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804091:	41 2b 04 24          	sub    (%r12),%eax
+  804095:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80409b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040a2:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040a5:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  8040ac:	00 00 00 
+  8040af:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  8040b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040bb:	5b                   	pop    %rbx
+  8040bc:	41 5c                	pop    %r12
+  8040be:	5d                   	pop    %rbp
+  8040bf:	c3                   	ret
+
+00000000008040c0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8040c0:	55                   	push   %rbp
+  8040c1:	48 89 e5             	mov    %rsp,%rbp
+  8040c4:	41 54                	push   %r12
+  8040c6:	53                   	push   %rbx
+  8040c7:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8040ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040cf:	48 89 fe             	mov    %rdi,%rsi
+  8040d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d7:	49 bc 4b 2b 80 00 00 	movabs $0x802b4b,%r12
+  8040de:	00 00 00 
+  8040e1:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  8040e4:	48 89 df             	mov    %rbx,%rdi
+  8040e7:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  8040ee:	00 00 00 
+  8040f1:	ff d0                	call   *%rax
+  8040f3:	48 89 c6             	mov    %rax,%rsi
+  8040f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804100:	41 ff d4             	call   *%r12
+}
+  804103:	5b                   	pop    %rbx
+  804104:	41 5c                	pop    %r12
+  804106:	5d                   	pop    %rbp
+  804107:	c3                   	ret
+
+0000000000804108 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804108:	55                   	push   %rbp
+  804109:	48 89 e5             	mov    %rsp,%rbp
+  80410c:	41 57                	push   %r15
+  80410e:	41 56                	push   %r14
+  804110:	41 55                	push   %r13
+  804112:	41 54                	push   %r12
+  804114:	53                   	push   %rbx
+  804115:	48 83 ec 18          	sub    $0x18,%rsp
+  804119:	49 89 fc             	mov    %rdi,%r12
+  80411c:	49 89 f5             	mov    %rsi,%r13
+  80411f:	49 89 d7             	mov    %rdx,%r15
+  804122:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804126:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  80412d:	00 00 00 
+  804130:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  804132:	4d 85 ff             	test   %r15,%r15
+  804135:	0f 84 af 00 00 00    	je     8041ea <devpipe_write+0xe2>
+  80413b:	48 89 c3             	mov    %rax,%rbx
+  80413e:	4c 89 f8             	mov    %r15,%rax
+  804141:	4d 89 ef             	mov    %r13,%r15
+  804144:	4c 01 e8             	add    %r13,%rax
+  804147:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80414b:	49 bd 41 2a 80 00 00 	movabs $0x802a41,%r13
+  804152:	00 00 00 
+            sys_yield();
+  804155:	49 be d2 29 80 00 00 	movabs $0x8029d2,%r14
+  80415c:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80415f:	8b 73 04             	mov    0x4(%rbx),%esi
+  804162:	48 63 ce             	movslq %esi,%rcx
+  804165:	48 63 03             	movslq (%rbx),%rax
+  804168:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80416e:	48 39 c1             	cmp    %rax,%rcx
+  804171:	72 2e                	jb     8041a1 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804173:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804178:	48 89 da             	mov    %rbx,%rdx
+  80417b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804180:	4c 89 e7             	mov    %r12,%rdi
+  804183:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  804186:	85 c0                	test   %eax,%eax
+  804188:	74 66                	je     8041f0 <devpipe_write+0xe8>
+            sys_yield();
+  80418a:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80418d:	8b 73 04             	mov    0x4(%rbx),%esi
+  804190:	48 63 ce             	movslq %esi,%rcx
+  804193:	48 63 03             	movslq (%rbx),%rax
+  804196:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  80419c:	48 39 c1             	cmp    %rax,%rcx
+  80419f:	73 d2                	jae    804173 <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041a1:	41 0f b6 3f          	movzbl (%r15),%edi
+  8041a5:	48 89 ca             	mov    %rcx,%rdx
+  8041a8:	48 c1 ea 03          	shr    $0x3,%rdx
+  8041ac:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  8041b3:	08 10 20 
+  8041b6:	48 f7 e2             	mul    %rdx
+  8041b9:	48 c1 ea 06          	shr    $0x6,%rdx
+  8041bd:	48 89 d0             	mov    %rdx,%rax
+  8041c0:	48 c1 e0 09          	shl    $0x9,%rax
+  8041c4:	48 29 d0             	sub    %rdx,%rax
+  8041c7:	48 c1 e0 03          	shl    $0x3,%rax
+  8041cb:	48 29 c1             	sub    %rax,%rcx
+  8041ce:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  8041d3:	83 c6 01             	add    $0x1,%esi
+  8041d6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041d9:	49 83 c7 01          	add    $0x1,%r15
+  8041dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041e1:	49 39 c7             	cmp    %rax,%r15
+  8041e4:	0f 85 75 ff ff ff    	jne    80415f <devpipe_write+0x57>
+    return n;
+  8041ea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041ee:	eb 05                	jmp    8041f5 <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041f5:	48 83 c4 18          	add    $0x18,%rsp
+  8041f9:	5b                   	pop    %rbx
+  8041fa:	41 5c                	pop    %r12
+  8041fc:	41 5d                	pop    %r13
+  8041fe:	41 5e                	pop    %r14
+  804200:	41 5f                	pop    %r15
+  804202:	5d                   	pop    %rbp
+  804203:	c3                   	ret
+
+0000000000804204 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804204:	55                   	push   %rbp
+  804205:	48 89 e5             	mov    %rsp,%rbp
+  804208:	41 57                	push   %r15
+  80420a:	41 56                	push   %r14
+  80420c:	41 55                	push   %r13
+  80420e:	41 54                	push   %r12
+  804210:	53                   	push   %rbx
+  804211:	48 83 ec 18          	sub    $0x18,%rsp
+  804215:	49 89 fc             	mov    %rdi,%r12
+  804218:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80421c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804220:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  804227:	00 00 00 
+  80422a:	ff d0                	call   *%rax
+  80422c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80422f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804235:	49 bd 41 2a 80 00 00 	movabs $0x802a41,%r13
+  80423c:	00 00 00 
+            sys_yield();
+  80423f:	49 be d2 29 80 00 00 	movabs $0x8029d2,%r14
+  804246:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804249:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80424e:	74 7d                	je     8042cd <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804250:	8b 03                	mov    (%rbx),%eax
+  804252:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804255:	75 26                	jne    80427d <devpipe_read+0x79>
+            if (i > 0) return i;
+  804257:	4d 85 ff             	test   %r15,%r15
+  80425a:	75 77                	jne    8042d3 <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80425c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804261:	48 89 da             	mov    %rbx,%rdx
+  804264:	be 00 10 00 00       	mov    $0x1000,%esi
+  804269:	4c 89 e7             	mov    %r12,%rdi
+  80426c:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  80426f:	85 c0                	test   %eax,%eax
+  804271:	74 72                	je     8042e5 <devpipe_read+0xe1>
+            sys_yield();
+  804273:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804276:	8b 03                	mov    (%rbx),%eax
+  804278:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80427b:	74 df                	je     80425c <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80427d:	48 63 c8             	movslq %eax,%rcx
+  804280:	48 89 ca             	mov    %rcx,%rdx
+  804283:	48 c1 ea 03          	shr    $0x3,%rdx
+  804287:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  80428e:	08 10 20 
+  804291:	48 89 d0             	mov    %rdx,%rax
+  804294:	48 f7 e6             	mul    %rsi
+  804297:	48 c1 ea 06          	shr    $0x6,%rdx
+  80429b:	48 89 d0             	mov    %rdx,%rax
+  80429e:	48 c1 e0 09          	shl    $0x9,%rax
+  8042a2:	48 29 d0             	sub    %rdx,%rax
+  8042a5:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8042ac:	00 
+  8042ad:	48 89 c8             	mov    %rcx,%rax
+  8042b0:	48 29 d0             	sub    %rdx,%rax
+  8042b3:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  8042b8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8042bc:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  8042c0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042c3:	49 83 c7 01          	add    $0x1,%r15
+  8042c7:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  8042cb:	75 83                	jne    804250 <devpipe_read+0x4c>
+    return n;
+  8042cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042d1:	eb 03                	jmp    8042d6 <devpipe_read+0xd2>
+            if (i > 0) return i;
+  8042d3:	4c 89 f8             	mov    %r15,%rax
+}
+  8042d6:	48 83 c4 18          	add    $0x18,%rsp
+  8042da:	5b                   	pop    %rbx
+  8042db:	41 5c                	pop    %r12
+  8042dd:	41 5d                	pop    %r13
+  8042df:	41 5e                	pop    %r14
+  8042e1:	41 5f                	pop    %r15
+  8042e3:	5d                   	pop    %rbp
+  8042e4:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  8042e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ea:	eb ea                	jmp    8042d6 <devpipe_read+0xd2>
+
+00000000008042ec <pipe>:
+pipe(int pfd[2]) {
+  8042ec:	55                   	push   %rbp
+  8042ed:	48 89 e5             	mov    %rsp,%rbp
+  8042f0:	41 55                	push   %r13
+  8042f2:	41 54                	push   %r12
+  8042f4:	53                   	push   %rbx
+  8042f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8042f9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8042fc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804300:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  804307:	00 00 00 
+  80430a:	ff d0                	call   *%rax
+  80430c:	89 c3                	mov    %eax,%ebx
+  80430e:	85 c0                	test   %eax,%eax
+  804310:	0f 88 a0 01 00 00    	js     8044b6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804316:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80431b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804320:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804324:	bf 00 00 00 00       	mov    $0x0,%edi
+  804329:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  804330:	00 00 00 
+  804333:	ff d0                	call   *%rax
+  804335:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804337:	85 c0                	test   %eax,%eax
+  804339:	0f 88 77 01 00 00    	js     8044b6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80433f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804343:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+  80434f:	89 c3                	mov    %eax,%ebx
+  804351:	85 c0                	test   %eax,%eax
+  804353:	0f 88 43 01 00 00    	js     80449c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804359:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80435e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804363:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804367:	bf 00 00 00 00       	mov    $0x0,%edi
+  80436c:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  804373:	00 00 00 
+  804376:	ff d0                	call   *%rax
+  804378:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80437a:	85 c0                	test   %eax,%eax
+  80437c:	0f 88 1a 01 00 00    	js     80449c <pipe+0x1b0>
+    va = fd2data(fd0);
+  804382:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804386:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  80438d:	00 00 00 
+  804390:	ff d0                	call   *%rax
+  804392:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804395:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80439a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80439f:	48 89 c6             	mov    %rax,%rsi
+  8043a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043a7:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  8043ae:	00 00 00 
+  8043b1:	ff d0                	call   *%rax
+  8043b3:	89 c3                	mov    %eax,%ebx
+  8043b5:	85 c0                	test   %eax,%eax
+  8043b7:	0f 88 c5 00 00 00    	js     804482 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043bd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043c1:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  8043c8:	00 00 00 
+  8043cb:	ff d0                	call   *%rax
+  8043cd:	48 89 c1             	mov    %rax,%rcx
+  8043d0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8043d6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8043dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e1:	4c 89 ee             	mov    %r13,%rsi
+  8043e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e9:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+  8043f5:	89 c3                	mov    %eax,%ebx
+  8043f7:	85 c0                	test   %eax,%eax
+  8043f9:	78 6e                	js     804469 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  804400:	4c 89 ef             	mov    %r13,%rdi
+  804403:	48 b8 09 2a 80 00 00 	movabs $0x802a09,%rax
+  80440a:	00 00 00 
+  80440d:	ff d0                	call   *%rax
+  80440f:	83 f8 02             	cmp    $0x2,%eax
+  804412:	0f 85 ab 00 00 00    	jne    8044c3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804418:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  80441f:	00 00 
+  804421:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804425:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804427:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80442b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804432:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804436:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804438:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80443c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804443:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804447:	48 bb d1 30 80 00 00 	movabs $0x8030d1,%rbx
+  80444e:	00 00 00 
+  804451:	ff d3                	call   *%rbx
+  804453:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804457:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80445b:	ff d3                	call   *%rbx
+  80445d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804462:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804467:	eb 4d                	jmp    8044b6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804469:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80446e:	4c 89 ee             	mov    %r13,%rsi
+  804471:	bf 00 00 00 00       	mov    $0x0,%edi
+  804476:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  80447d:	00 00 00 
+  804480:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804482:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804487:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80448b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804490:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  804497:	00 00 00 
+  80449a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80449c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044a1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044aa:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  8044b1:	00 00 00 
+  8044b4:	ff d0                	call   *%rax
+}
+  8044b6:	89 d8                	mov    %ebx,%eax
+  8044b8:	48 83 c4 18          	add    $0x18,%rsp
+  8044bc:	5b                   	pop    %rbx
+  8044bd:	41 5c                	pop    %r12
+  8044bf:	41 5d                	pop    %r13
+  8044c1:	5d                   	pop    %rbp
+  8044c2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044c3:	48 b9 28 66 80 00 00 	movabs $0x806628,%rcx
+  8044ca:	00 00 00 
+  8044cd:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8044d4:	00 00 00 
+  8044d7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8044dc:	48 bf 17 66 80 00 00 	movabs $0x806617,%rdi
+  8044e3:	00 00 00 
+  8044e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044eb:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8044f2:	00 00 00 
+  8044f5:	41 ff d0             	call   *%r8
+
+00000000008044f8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8044f8:	55                   	push   %rbp
+  8044f9:	48 89 e5             	mov    %rsp,%rbp
+  8044fc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804500:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804504:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804510:	85 c0                	test   %eax,%eax
+  804512:	78 35                	js     804549 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804514:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804518:	48 b8 e3 30 80 00 00 	movabs $0x8030e3,%rax
+  80451f:	00 00 00 
+  804522:	ff d0                	call   *%rax
+  804524:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804527:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80452c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804531:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804535:	48 b8 41 2a 80 00 00 	movabs $0x802a41,%rax
+  80453c:	00 00 00 
+  80453f:	ff d0                	call   *%rax
+  804541:	85 c0                	test   %eax,%eax
+  804543:	0f 94 c0             	sete   %al
+  804546:	0f b6 c0             	movzbl %al,%eax
+}
+  804549:	c9                   	leave
+  80454a:	c3                   	ret
+
+000000000080454b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80454b:	48 89 f8             	mov    %rdi,%rax
+  80454e:	48 c1 e8 27          	shr    $0x27,%rax
+  804552:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804559:	01 00 00 
+  80455c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804560:	f6 c2 01             	test   $0x1,%dl
+  804563:	74 6d                	je     8045d2 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804565:	48 89 f8             	mov    %rdi,%rax
+  804568:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80456c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804573:	01 00 00 
+  804576:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80457a:	f6 c2 01             	test   $0x1,%dl
+  80457d:	74 62                	je     8045e1 <get_uvpt_entry+0x96>
+  80457f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804586:	01 00 00 
+  804589:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80458d:	f6 c2 80             	test   $0x80,%dl
+  804590:	75 4f                	jne    8045e1 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804592:	48 89 f8             	mov    %rdi,%rax
+  804595:	48 c1 e8 15          	shr    $0x15,%rax
+  804599:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045a0:	01 00 00 
+  8045a3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045a7:	f6 c2 01             	test   $0x1,%dl
+  8045aa:	74 44                	je     8045f0 <get_uvpt_entry+0xa5>
+  8045ac:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045b3:	01 00 00 
+  8045b6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045ba:	f6 c2 80             	test   $0x80,%dl
+  8045bd:	75 31                	jne    8045f0 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045bf:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045c3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045ca:	01 00 00 
+  8045cd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8045d1:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045d2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045d9:	01 00 00 
+  8045dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045e0:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045e1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045e8:	01 00 00 
+  8045eb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045ef:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045f0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045f7:	01 00 00 
+  8045fa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045fe:	c3                   	ret
+
+00000000008045ff <get_prot>:
+
+int
+get_prot(void *va) {
+  8045ff:	55                   	push   %rbp
+  804600:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804603:	48 b8 4b 45 80 00 00 	movabs $0x80454b,%rax
+  80460a:	00 00 00 
+  80460d:	ff d0                	call   *%rax
+  80460f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804612:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804617:	89 c1                	mov    %eax,%ecx
+  804619:	83 c9 04             	or     $0x4,%ecx
+  80461c:	f6 c2 01             	test   $0x1,%dl
+  80461f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804622:	89 c1                	mov    %eax,%ecx
+  804624:	83 c9 02             	or     $0x2,%ecx
+  804627:	f6 c2 02             	test   $0x2,%dl
+  80462a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80462d:	89 c1                	mov    %eax,%ecx
+  80462f:	83 c9 01             	or     $0x1,%ecx
+  804632:	48 85 d2             	test   %rdx,%rdx
+  804635:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804638:	89 c1                	mov    %eax,%ecx
+  80463a:	83 c9 40             	or     $0x40,%ecx
+  80463d:	f6 c6 04             	test   $0x4,%dh
+  804640:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804643:	5d                   	pop    %rbp
+  804644:	c3                   	ret
+
+0000000000804645 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804645:	55                   	push   %rbp
+  804646:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804649:	48 b8 4b 45 80 00 00 	movabs $0x80454b,%rax
+  804650:	00 00 00 
+  804653:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804655:	48 c1 e8 06          	shr    $0x6,%rax
+  804659:	83 e0 01             	and    $0x1,%eax
+}
+  80465c:	5d                   	pop    %rbp
+  80465d:	c3                   	ret
+
+000000000080465e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80465e:	55                   	push   %rbp
+  80465f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804662:	48 b8 4b 45 80 00 00 	movabs $0x80454b,%rax
+  804669:	00 00 00 
+  80466c:	ff d0                	call   *%rax
+  80466e:	83 e0 01             	and    $0x1,%eax
+}
+  804671:	5d                   	pop    %rbp
+  804672:	c3                   	ret
+
+0000000000804673 <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804673:	55                   	push   %rbp
+  804674:	48 89 e5             	mov    %rsp,%rbp
+  804677:	41 57                	push   %r15
+  804679:	41 56                	push   %r14
+  80467b:	41 55                	push   %r13
+  80467d:	41 54                	push   %r12
+  80467f:	53                   	push   %rbx
+  804680:	48 83 ec 28          	sub    $0x28,%rsp
+  804684:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  804688:	48 85 ff             	test   %rdi,%rdi
+  80468b:	74 1e                	je     8046ab <foreach_shared_region+0x38>
+  80468d:	49 89 ff             	mov    %rdi,%r15
+  804690:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  804696:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  80469c:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  8046a3:	01 00 00 
+  8046a6:	e9 72 02 00 00       	jmp    80491d <foreach_shared_region+0x2aa>
+    assert(fun);
+  8046ab:	48 b9 4c 66 80 00 00 	movabs $0x80664c,%rcx
+  8046b2:	00 00 00 
+  8046b5:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8046bc:	00 00 00 
+  8046bf:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8046c4:	48 bf 50 66 80 00 00 	movabs $0x806650,%rdi
+  8046cb:	00 00 00 
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d3:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8046da:	00 00 00 
+  8046dd:	41 ff d0             	call   *%r8
+  8046e0:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  8046e7:	eb 6c                	jmp    804755 <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  8046e9:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  8046f0:	ff ff ff 
+  8046f3:	4c 21 e2             	and    %r12,%rdx
+  8046f6:	48 89 d8             	mov    %rbx,%rax
+  8046f9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8046fe:	48 83 c0 01          	add    $0x1,%rax
+  804702:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804706:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80470d:	00 00 00 
+  804710:	48 21 c8             	and    %rcx,%rax
+  804713:	48 09 d0             	or     %rdx,%rax
+  804716:	49 89 c4             	mov    %rax,%r12
+  804719:	eb 30                	jmp    80474b <foreach_shared_region+0xd8>
+  80471b:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804722:	ff ff ff 
+  804725:	4c 21 e2             	and    %r12,%rdx
+  804728:	48 89 d8             	mov    %rbx,%rax
+  80472b:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804730:	48 83 c0 01          	add    $0x1,%rax
+  804734:	48 c1 e0 1e          	shl    $0x1e,%rax
+  804738:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  80473f:	00 00 00 
+  804742:	48 21 c8             	and    %rcx,%rax
+  804745:	48 09 d0             	or     %rdx,%rax
+  804748:	49 89 c4             	mov    %rax,%r12
+  80474b:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  80474f:	0f 84 99 01 00 00    	je     8048ee <foreach_shared_region+0x27b>
+  804755:	4c 89 e3             	mov    %r12,%rbx
+  804758:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  80475c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804763:	01 00 00 
+  804766:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80476a:	a8 01                	test   $0x1,%al
+  80476c:	0f 84 77 ff ff ff    	je     8046e9 <foreach_shared_region+0x76>
+  804772:	a8 80                	test   $0x80,%al
+  804774:	74 19                	je     80478f <foreach_shared_region+0x11c>
+  804776:	f6 c4 04             	test   $0x4,%ah
+  804779:	74 a0                	je     80471b <foreach_shared_region+0xa8>
+  80477b:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  804782:	40 
+  804783:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804787:	4c 89 e7             	mov    %r12,%rdi
+  80478a:	41 ff d7             	call   *%r15
+  80478d:	eb 8c                	jmp    80471b <foreach_shared_region+0xa8>
+  80478f:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  804796:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  80479a:	eb 46                	jmp    8047e2 <foreach_shared_region+0x16f>
+  80479c:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047a3:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047a9:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047ad:	48 c1 e0 15          	shl    $0x15,%rax
+  8047b1:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047b6:	49 09 c4             	or     %rax,%r12
+  8047b9:	eb 1d                	jmp    8047d8 <foreach_shared_region+0x165>
+  8047bb:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  8047c2:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8047c8:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8047cc:	48 c1 e0 15          	shl    $0x15,%rax
+  8047d0:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  8047d5:	49 09 c4             	or     %rax,%r12
+  8047d8:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  8047dc:	0f 84 d3 00 00 00    	je     8048b5 <foreach_shared_region+0x242>
+  8047e2:	4c 89 e3             	mov    %r12,%rbx
+  8047e5:	48 c1 eb 15          	shr    $0x15,%rbx
+  8047e9:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8047f0:	01 00 00 
+  8047f3:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8047f7:	a8 01                	test   $0x1,%al
+  8047f9:	74 a1                	je     80479c <foreach_shared_region+0x129>
+  8047fb:	a8 80                	test   $0x80,%al
+  8047fd:	74 19                	je     804818 <foreach_shared_region+0x1a5>
+  8047ff:	f6 c4 04             	test   $0x4,%ah
+  804802:	74 b7                	je     8047bb <foreach_shared_region+0x148>
+  804804:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  80480b:	00 
+  80480c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804810:	4c 89 e7             	mov    %r12,%rdi
+  804813:	41 ff d7             	call   *%r15
+  804816:	eb a3                	jmp    8047bb <foreach_shared_region+0x148>
+  804818:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  80481e:	eb 3b                	jmp    80485b <foreach_shared_region+0x1e8>
+  804820:	f6 c4 04             	test   $0x4,%ah
+  804823:	74 12                	je     804837 <foreach_shared_region+0x1c4>
+  804825:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  80482c:	00 
+  80482d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804831:	4c 89 e7             	mov    %r12,%rdi
+  804834:	41 ff d7             	call   *%r15
+  804837:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  80483e:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804844:	48 83 c3 01          	add    $0x1,%rbx
+  804848:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80484c:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804852:	49 09 dc             	or     %rbx,%r12
+  804855:	41 83 ed 01          	sub    $0x1,%r13d
+  804859:	74 2f                	je     80488a <foreach_shared_region+0x217>
+  80485b:	4c 89 e3             	mov    %r12,%rbx
+  80485e:	48 c1 eb 0c          	shr    $0xc,%rbx
+  804862:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  804866:	a8 01                	test   $0x1,%al
+  804868:	75 b6                	jne    804820 <foreach_shared_region+0x1ad>
+  80486a:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  804871:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804877:	48 83 c3 01          	add    $0x1,%rbx
+  80487b:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80487f:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  804885:	49 09 dc             	or     %rbx,%r12
+  804888:	eb cb                	jmp    804855 <foreach_shared_region+0x1e2>
+  80488a:	4c 89 e0             	mov    %r12,%rax
+  80488d:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  804893:	49 c1 ec 15          	shr    $0x15,%r12
+  804897:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  80489e:	49 83 c4 01          	add    $0x1,%r12
+  8048a2:	49 c1 e4 15          	shl    $0x15,%r12
+  8048a6:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  8048ad:	49 09 c4             	or     %rax,%r12
+  8048b0:	e9 23 ff ff ff       	jmp    8047d8 <foreach_shared_region+0x165>
+  8048b5:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  8048b9:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  8048c0:	ff ff ff 
+  8048c3:	4c 21 e0             	and    %r12,%rax
+  8048c6:	49 c1 ec 1e          	shr    $0x1e,%r12
+  8048ca:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  8048d1:	49 83 c4 01          	add    $0x1,%r12
+  8048d5:	49 c1 e4 1e          	shl    $0x1e,%r12
+  8048d9:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  8048e0:	00 00 00 
+  8048e3:	49 21 d4             	and    %rdx,%r12
+  8048e6:	49 09 c4             	or     %rax,%r12
+  8048e9:	e9 5d fe ff ff       	jmp    80474b <foreach_shared_region+0xd8>
+  8048ee:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  8048f5:	00 ff ff 
+  8048f8:	4c 21 e0             	and    %r12,%rax
+  8048fb:	49 c1 ec 27          	shr    $0x27,%r12
+  8048ff:	49 83 c4 01          	add    $0x1,%r12
+  804903:	49 c1 e4 27          	shl    $0x27,%r12
+  804907:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  80490e:	ff 00 00 
+  804911:	49 21 d4             	and    %rdx,%r12
+  804914:	49 09 c4             	or     %rax,%r12
+  804917:	41 83 ed 01          	sub    $0x1,%r13d
+  80491b:	74 48                	je     804965 <foreach_shared_region+0x2f2>
+  80491d:	4c 89 e0             	mov    %r12,%rax
+  804920:	48 c1 e8 27          	shr    $0x27,%rax
+  804924:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  80492b:	01 00 00 
+  80492e:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804932:	f6 c2 01             	test   $0x1,%dl
+  804935:	0f 85 a5 fd ff ff    	jne    8046e0 <foreach_shared_region+0x6d>
+  80493b:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  804942:	00 ff ff 
+  804945:	4c 21 e2             	and    %r12,%rdx
+  804948:	48 83 c0 01          	add    $0x1,%rax
+  80494c:	48 c1 e0 27          	shl    $0x27,%rax
+  804950:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  804957:	ff 00 00 
+  80495a:	48 21 c8             	and    %rcx,%rax
+  80495d:	48 09 d0             	or     %rdx,%rax
+  804960:	49 89 c4             	mov    %rax,%r12
+  804963:	eb b2                	jmp    804917 <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  804965:	4d 85 e4             	test   %r12,%r12
+  804968:	75 14                	jne    80497e <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  80496a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80496f:	48 83 c4 28          	add    $0x28,%rsp
+  804973:	5b                   	pop    %rbx
+  804974:	41 5c                	pop    %r12
+  804976:	41 5d                	pop    %r13
+  804978:	41 5e                	pop    %r14
+  80497a:	41 5f                	pop    %r15
+  80497c:	5d                   	pop    %rbp
+  80497d:	c3                   	ret
+    assert(addr == 0);
+  80497e:	48 b9 5b 66 80 00 00 	movabs $0x80665b,%rcx
+  804985:	00 00 00 
+  804988:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  80498f:	00 00 00 
+  804992:	be 67 00 00 00       	mov    $0x67,%esi
+  804997:	48 bf 50 66 80 00 00 	movabs $0x806650,%rdi
+  80499e:	00 00 00 
+  8049a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a6:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8049ad:	00 00 00 
+  8049b0:	41 ff d0             	call   *%r8
+
+00000000008049b3 <vsys_gettime>:
+    // LAB 12: Your code here DONE
+    if (num < 0 || num >= NVSYSCALLS) {
+        return -E_NO_SYS;
+    }
+
+    return vsys[num];
+  8049b3:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  8049ba:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  8049bc:	c3                   	ret
+
+00000000008049bd <vsys_gettimems>:
+    return vsys[num];
+  8049bd:	a1 04 f0 bf 1f 80 00 	movabs 0x801fbff004,%eax
+  8049c4:	00 00 
+
+uint32_t
+vsys_gettimems() {
+    return (uint32_t)vsyscall(VSYS_gettimems);
+}
+  8049c6:	c3                   	ret
+
+00000000008049c7 <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  8049c7:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  8049ce:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  8049d1:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  8049d7:	eb 33                	jmp    804a0c <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8049d9:	48 83 c0 20          	add    $0x20,%rax
+  8049dd:	4c 39 c0             	cmp    %r8,%rax
+  8049e0:	74 25                	je     804a07 <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  8049e2:	48 8b 10             	mov    (%rax),%rdx
+  8049e5:	48 85 d2             	test   %rdx,%rdx
+  8049e8:	74 ef                	je     8049d9 <mmap_place+0x12>
+  8049ea:	48 89 d1             	mov    %rdx,%rcx
+  8049ed:	48 03 48 08          	add    0x8(%rax),%rcx
+  8049f1:	48 39 cf             	cmp    %rcx,%rdi
+  8049f4:	73 e3                	jae    8049d9 <mmap_place+0x12>
+  8049f6:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  8049fa:	4c 39 ca             	cmp    %r9,%rdx
+  8049fd:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804a01:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804a05:	eb d2                	jmp    8049d9 <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  804a07:	45 84 d2             	test   %r10b,%r10b
+  804a0a:	74 12                	je     804a1e <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a0c:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a13:	00 00 00 
+        moved = 0;
+  804a16:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  804a1c:	eb c4                	jmp    8049e2 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804a1e:	48 01 fe             	add    %rdi,%rsi
+  804a21:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  804a28:	00 00 00 
+  804a2b:	48 39 f0             	cmp    %rsi,%rax
+  804a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a33:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  804a37:	c3                   	ret
+
+0000000000804a38 <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  804a38:	55                   	push   %rbp
+  804a39:	48 89 e5             	mov    %rsp,%rbp
+  804a3c:	41 57                	push   %r15
+  804a3e:	41 56                	push   %r14
+  804a40:	41 55                	push   %r13
+  804a42:	41 54                	push   %r12
+  804a44:	53                   	push   %rbx
+  804a45:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  804a49:	48 8b 1f             	mov    (%rdi),%rbx
+  804a4c:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804a53:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a5a:	00 00 00 
+  804a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a62:	eb 12                	jmp    804a76 <mmap_pgfault+0x3e>
+  804a64:	48 83 c2 01          	add    $0x1,%rdx
+  804a68:	48 83 c0 20          	add    $0x20,%rax
+  804a6c:	48 83 fa 20          	cmp    $0x20,%rdx
+  804a70:	0f 84 04 01 00 00    	je     804b7a <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  804a76:	48 8b 08             	mov    (%rax),%rcx
+  804a79:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  804a7d:	48 39 de             	cmp    %rbx,%rsi
+  804a80:	73 e2                	jae    804a64 <mmap_pgfault+0x2c>
+  804a82:	48 03 48 08          	add    0x8(%rax),%rcx
+  804a86:	48 39 cb             	cmp    %rcx,%rbx
+  804a89:	73 d9                	jae    804a64 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  804a8b:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a8f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804a96:	00 00 00 
+  804a99:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  804a9d:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  804aa1:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  804aa5:	f6 c2 01             	test   $0x1,%dl
+  804aa8:	0f 84 e0 00 00 00    	je     804b8e <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ab3:	f6 c2 02             	test   $0x2,%dl
+  804ab6:	0f 84 c3 00 00 00    	je     804b7f <mmap_pgfault+0x147>
+  804abc:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804ac3:	ff ff ff 
+  804ac6:	48 23 56 10          	and    0x10(%rsi),%rdx
+  804aca:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804ad1:	00 00 00 
+  804ad4:	48 39 ca             	cmp    %rcx,%rdx
+  804ad7:	0f 85 a2 00 00 00    	jne    804b7f <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804add:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804ae2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ae7:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804aee:	00 00 00 
+  804af1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af6:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  804afd:	00 00 00 
+  804b00:	ff d0                	call   *%rax
+  804b02:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804b04:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b09:	85 d2                	test   %edx,%edx
+  804b0b:	78 72                	js     804b7f <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804b0d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b12:	48 89 de             	mov    %rbx,%rsi
+  804b15:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  804b1c:	00 00 00 
+  804b1f:	4c 89 e7             	mov    %r12,%rdi
+  804b22:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  804b29:	00 00 00 
+  804b2c:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804b2e:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804b34:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b3a:	48 89 d9             	mov    %rbx,%rcx
+  804b3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b42:	4c 89 e6             	mov    %r12,%rsi
+  804b45:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b4a:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  804b51:	00 00 00 
+  804b54:	ff d0                	call   *%rax
+  804b56:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  804b58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b5d:	4c 89 e6             	mov    %r12,%rsi
+  804b60:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b65:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  804b6c:	00 00 00 
+  804b6f:	ff d0                	call   *%rax
+    return res >= 0;
+  804b71:	89 d8                	mov    %ebx,%eax
+  804b73:	f7 d0                	not    %eax
+  804b75:	c1 e8 1f             	shr    $0x1f,%eax
+  804b78:	eb 05                	jmp    804b7f <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  804b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  804b7f:	48 83 c4 18          	add    $0x18,%rsp
+  804b83:	5b                   	pop    %rbx
+  804b84:	41 5c                	pop    %r12
+  804b86:	41 5d                	pop    %r13
+  804b88:	41 5e                	pop    %r14
+  804b8a:	41 5f                	pop    %r15
+  804b8c:	5d                   	pop    %rbp
+  804b8d:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  804b8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b92:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  804b96:	4c 03 30             	add    (%rax),%r14
+  804b99:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  804ba0:	49 39 c6             	cmp    %rax,%r14
+  804ba3:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804ba7:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804bae:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804bb4:	49 bf 5e 46 80 00 00 	movabs $0x80465e,%r15
+  804bbb:	00 00 00 
+  804bbe:	4d 39 f4             	cmp    %r14,%r12
+  804bc1:	73 1d                	jae    804be0 <mmap_pgfault+0x1a8>
+  804bc3:	4c 89 e7             	mov    %r12,%rdi
+  804bc6:	41 ff d7             	call   *%r15
+  804bc9:	84 c0                	test   %al,%al
+  804bcb:	75 13                	jne    804be0 <mmap_pgfault+0x1a8>
+  804bcd:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804bd4:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  804bdb:	4d 39 f4             	cmp    %r14,%r12
+  804bde:	72 e3                	jb     804bc3 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804be0:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804be6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bea:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804bee:	74 2a                	je     804c1a <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804bf0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bf4:	89 de                	mov    %ebx,%esi
+  804bf6:	2b 30                	sub    (%rax),%esi
+  804bf8:	03 70 1c             	add    0x1c(%rax),%esi
+  804bfb:	8b 78 18             	mov    0x18(%rax),%edi
+  804bfe:	4c 89 e9             	mov    %r13,%rcx
+  804c01:	48 89 da             	mov    %rbx,%rdx
+  804c04:	48 b8 bc 3d 80 00 00 	movabs $0x803dbc,%rax
+  804c0b:	00 00 00 
+  804c0e:	ff d0                	call   *%rax
+    return res > 0;
+  804c10:	85 c0                	test   %eax,%eax
+  804c12:	0f 9f c0             	setg   %al
+  804c15:	e9 65 ff ff ff       	jmp    804b7f <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804c1a:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804c1e:	eb d0                	jmp    804bf0 <mmap_pgfault+0x1b8>
+
+0000000000804c20 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804c20:	55                   	push   %rbp
+  804c21:	48 89 e5             	mov    %rsp,%rbp
+  804c24:	41 57                	push   %r15
+  804c26:	41 56                	push   %r14
+  804c28:	41 55                	push   %r13
+  804c2a:	41 54                	push   %r12
+  804c2c:	53                   	push   %rbx
+  804c2d:	48 83 ec 28          	sub    $0x28,%rsp
+  804c31:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804c35:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  804c38:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804c3f:	ff ff ff 
+  804c42:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804c46:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4b:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  804c52:	00 00 00 
+  804c55:	48 39 ca             	cmp    %rcx,%rdx
+  804c58:	0f 85 e5 00 00 00    	jne    804d43 <mmap_writeback+0x123>
+  804c5e:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  804c61:	4c 39 ee             	cmp    %r13,%rsi
+  804c64:	0f 83 e8 00 00 00    	jae    804d52 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c6a:	49 be 5e 46 80 00 00 	movabs $0x80465e,%r14
+  804c71:	00 00 00 
+  804c74:	49 bf 45 46 80 00 00 	movabs $0x804645,%r15
+  804c7b:	00 00 00 
+  804c7e:	eb 10                	jmp    804c90 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  804c80:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  804c87:	4d 39 ec             	cmp    %r13,%r12
+  804c8a:	0f 83 ae 00 00 00    	jae    804d3e <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  804c90:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  804c94:	4c 89 e7             	mov    %r12,%rdi
+  804c97:	41 ff d6             	call   *%r14
+  804c9a:	84 c0                	test   %al,%al
+  804c9c:	74 e2                	je     804c80 <mmap_writeback+0x60>
+  804c9e:	4c 89 e7             	mov    %r12,%rdi
+  804ca1:	41 ff d7             	call   *%r15
+  804ca4:	84 c0                	test   %al,%al
+  804ca6:	74 d8                	je     804c80 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  804ca8:	4c 89 e3             	mov    %r12,%rbx
+  804cab:	4d 39 ec             	cmp    %r13,%r12
+  804cae:	73 20                	jae    804cd0 <mmap_writeback+0xb0>
+  804cb0:	48 89 df             	mov    %rbx,%rdi
+  804cb3:	41 ff d6             	call   *%r14
+  804cb6:	84 c0                	test   %al,%al
+  804cb8:	74 16                	je     804cd0 <mmap_writeback+0xb0>
+  804cba:	48 89 df             	mov    %rbx,%rdi
+  804cbd:	41 ff d7             	call   *%r15
+  804cc0:	84 c0                	test   %al,%al
+  804cc2:	74 0c                	je     804cd0 <mmap_writeback+0xb0>
+  804cc4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ccb:	4c 39 eb             	cmp    %r13,%rbx
+  804cce:	72 e0                	jb     804cb0 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804cd0:	48 89 d9             	mov    %rbx,%rcx
+  804cd3:	4c 29 e1             	sub    %r12,%rcx
+  804cd6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804cda:	44 89 e6             	mov    %r12d,%esi
+  804cdd:	2b 30                	sub    (%rax),%esi
+  804cdf:	49 89 c4             	mov    %rax,%r12
+  804ce2:	03 70 1c             	add    0x1c(%rax),%esi
+  804ce5:	8b 78 18             	mov    0x18(%rax),%edi
+  804ce8:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804cec:	48 89 ca             	mov    %rcx,%rdx
+  804cef:	48 b8 45 3e 80 00 00 	movabs $0x803e45,%rax
+  804cf6:	00 00 00 
+  804cf9:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804cfb:	85 c0                	test   %eax,%eax
+  804cfd:	78 44                	js     804d43 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804cff:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804d04:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804d07:	41 89 c1             	mov    %eax,%r9d
+  804d0a:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804d11:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804d15:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d1e:	48 89 ce             	mov    %rcx,%rsi
+  804d21:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d26:	48 b8 e0 2a 80 00 00 	movabs $0x802ae0,%rax
+  804d2d:	00 00 00 
+  804d30:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804d32:	85 c0                	test   %eax,%eax
+  804d34:	78 0d                	js     804d43 <mmap_writeback+0x123>
+  804d36:	49 89 dc             	mov    %rbx,%r12
+  804d39:	e9 49 ff ff ff       	jmp    804c87 <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d43:	48 83 c4 28          	add    $0x28,%rsp
+  804d47:	5b                   	pop    %rbx
+  804d48:	41 5c                	pop    %r12
+  804d4a:	41 5d                	pop    %r13
+  804d4c:	41 5e                	pop    %r14
+  804d4e:	41 5f                	pop    %r15
+  804d50:	5d                   	pop    %rbp
+  804d51:	c3                   	ret
+    return 0;
+  804d52:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d57:	eb ea                	jmp    804d43 <mmap_writeback+0x123>
+
+0000000000804d59 <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804d59:	55                   	push   %rbp
+  804d5a:	48 89 e5             	mov    %rsp,%rbp
+  804d5d:	41 57                	push   %r15
+  804d5f:	41 56                	push   %r14
+  804d61:	41 55                	push   %r13
+  804d63:	41 54                	push   %r12
+  804d65:	53                   	push   %rbx
+  804d66:	48 83 ec 38          	sub    $0x38,%rsp
+  804d6a:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804d6e:	48 85 f6             	test   %rsi,%rsi
+  804d71:	0f 84 0c 02 00 00    	je     804f83 <mmap+0x22a>
+  804d77:	49 89 ff             	mov    %rdi,%r15
+  804d7a:	49 89 f4             	mov    %rsi,%r12
+  804d7d:	41 89 d5             	mov    %edx,%r13d
+  804d80:	41 89 ce             	mov    %ecx,%r14d
+  804d83:	44 89 cb             	mov    %r9d,%ebx
+  804d86:	45 85 c9             	test   %r9d,%r9d
+  804d89:	0f 88 f4 01 00 00    	js     804f83 <mmap+0x22a>
+  804d8f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804d96:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804d9d:	0f 85 e7 01 00 00    	jne    804f8a <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804da3:	83 e2 fd             	and    $0xfffffffd,%edx
+  804da6:	83 fa 04             	cmp    $0x4,%edx
+  804da9:	0f 85 db 01 00 00    	jne    804f8a <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804daf:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804db2:	83 fa 01             	cmp    $0x1,%edx
+  804db5:	0f 87 cf 01 00 00    	ja     804f8a <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804dbb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804dbf:	44 89 c7             	mov    %r8d,%edi
+  804dc2:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  804dc9:	00 00 00 
+  804dcc:	ff d0                	call   *%rax
+  804dce:	89 c2                	mov    %eax,%edx
+  804dd0:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804dd7:	85 d2                	test   %edx,%edx
+  804dd9:	0f 88 ab 01 00 00    	js     804f8a <mmap+0x231>
+  804ddf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804de3:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804dea:	00 00 00 
+  804ded:	8b 09                	mov    (%rcx),%ecx
+  804def:	39 0a                	cmp    %ecx,(%rdx)
+  804df1:	0f 85 93 01 00 00    	jne    804f8a <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804df7:	8b 52 08             	mov    0x8(%rdx),%edx
+  804dfa:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804dfd:	83 fa 01             	cmp    $0x1,%edx
+  804e00:	0f 84 84 01 00 00    	je     804f8a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e06:	41 83 fe 01          	cmp    $0x1,%r14d
+  804e0a:	74 42                	je     804e4e <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804e0c:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804e13:	4c 89 e6             	mov    %r12,%rsi
+  804e16:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804e1d:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804e21:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804e25:	4d 85 ff             	test   %r15,%r15
+  804e28:	74 67                	je     804e91 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e2a:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804e31:	75 0f                	jne    804e42 <mmap+0xe9>
+  804e33:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804e3a:	00 00 00 
+  804e3d:	49 39 c7             	cmp    %rax,%r15
+  804e40:	77 1b                	ja     804e5d <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e42:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804e49:	e9 3c 01 00 00       	jmp    804f8a <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804e4e:	41 f6 c5 02          	test   $0x2,%r13b
+  804e52:	74 b8                	je     804e0c <mmap+0xb3>
+  804e54:	85 d2                	test   %edx,%edx
+  804e56:	75 b4                	jne    804e0c <mmap+0xb3>
+  804e58:	e9 2d 01 00 00       	jmp    804f8a <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804e5d:	4c 89 ff             	mov    %r15,%rdi
+  804e60:	48 b8 c7 49 80 00 00 	movabs $0x8049c7,%rax
+  804e67:	00 00 00 
+  804e6a:	ff d0                	call   *%rax
+  804e6c:	48 89 c2             	mov    %rax,%rdx
+  804e6f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804e76:	49 39 d7             	cmp    %rdx,%r15
+  804e79:	0f 85 0b 01 00 00    	jne    804f8a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804e7f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804e86:	00 00 00 
+  804e89:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e8f:	eb 44                	jmp    804ed5 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804e91:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804e95:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804e9c:	00 00 00 
+  804e9f:	48 b8 c7 49 80 00 00 	movabs $0x8049c7,%rax
+  804ea6:	00 00 00 
+  804ea9:	ff d0                	call   *%rax
+  804eab:	48 89 c7             	mov    %rax,%rdi
+  804eae:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804eb2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804eb9:	48 85 ff             	test   %rdi,%rdi
+  804ebc:	75 c1                	jne    804e7f <mmap+0x126>
+  804ebe:	e9 c7 00 00 00       	jmp    804f8a <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804ec3:	49 83 c4 01          	add    $0x1,%r12
+  804ec7:	48 83 c0 20          	add    $0x20,%rax
+  804ecb:	49 83 fc 20          	cmp    $0x20,%r12
+  804ecf:	0f 84 a5 00 00 00    	je     804f7a <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804ed5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804ed9:	75 e8                	jne    804ec3 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804edb:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804edf:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  804ee6:	00 00 00 
+  804ee9:	ff d0                	call   *%rax
+  804eeb:	89 c2                	mov    %eax,%edx
+  804eed:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ef4:	85 d2                	test   %edx,%edx
+  804ef6:	0f 88 8e 00 00 00    	js     804f8a <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804efc:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804f00:	48 b8 d1 30 80 00 00 	movabs $0x8030d1,%rax
+  804f07:	00 00 00 
+  804f0a:	ff d0                	call   *%rax
+  804f0c:	89 c6                	mov    %eax,%esi
+  804f0e:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804f11:	48 b8 1f 33 80 00 00 	movabs $0x80331f,%rax
+  804f18:	00 00 00 
+  804f1b:	ff d0                	call   *%rax
+  804f1d:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804f20:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f27:	45 85 ff             	test   %r15d,%r15d
+  804f2a:	78 5e                	js     804f8a <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804f2c:	49 c1 e4 05          	shl    $0x5,%r12
+  804f30:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804f37:	00 00 00 
+  804f3a:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804f3d:	48 bf 38 4a 80 00 00 	movabs $0x804a38,%rdi
+  804f44:	00 00 00 
+  804f47:	48 b8 06 55 80 00 00 	movabs $0x805506,%rax
+  804f4e:	00 00 00 
+  804f51:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804f53:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f57:	49 89 04 24          	mov    %rax,(%r12)
+  804f5b:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804f5f:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804f64:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804f69:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804f6e:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804f73:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804f78:	eb 10                	jmp    804f8a <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804f7a:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804f81:	eb 07                	jmp    804f8a <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804f83:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804f8a:	48 83 c4 38          	add    $0x38,%rsp
+  804f8e:	5b                   	pop    %rbx
+  804f8f:	41 5c                	pop    %r12
+  804f91:	41 5d                	pop    %r13
+  804f93:	41 5e                	pop    %r14
+  804f95:	41 5f                	pop    %r15
+  804f97:	5d                   	pop    %rbp
+  804f98:	c3                   	ret
+
+0000000000804f99 <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804f99:	55                   	push   %rbp
+  804f9a:	48 89 e5             	mov    %rsp,%rbp
+  804f9d:	41 57                	push   %r15
+  804f9f:	41 56                	push   %r14
+  804fa1:	41 55                	push   %r13
+  804fa3:	41 54                	push   %r12
+  804fa5:	53                   	push   %rbx
+  804fa6:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804faa:	49 89 fe             	mov    %rdi,%r14
+  804fad:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804fb4:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804fbb:	00 
+  804fbc:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fc3:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804fca:	00 00 00 
+  804fcd:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804fd4:	49 bf 20 4c 80 00 00 	movabs $0x804c20,%r15
+  804fdb:	00 00 00 
+  804fde:	eb 09                	jmp    804fe9 <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804fe0:	48 83 c3 20          	add    $0x20,%rbx
+  804fe4:	4c 39 eb             	cmp    %r13,%rbx
+  804fe7:	74 33                	je     80501c <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804fe9:	48 89 df             	mov    %rbx,%rdi
+  804fec:	48 8b 33             	mov    (%rbx),%rsi
+  804fef:	4c 39 e6             	cmp    %r12,%rsi
+  804ff2:	73 ec                	jae    804fe0 <msync+0x47>
+  804ff4:	48 85 f6             	test   %rsi,%rsi
+  804ff7:	74 e7                	je     804fe0 <msync+0x47>
+  804ff9:	48 89 f2             	mov    %rsi,%rdx
+  804ffc:	48 03 53 08          	add    0x8(%rbx),%rdx
+  805000:	49 39 d6             	cmp    %rdx,%r14
+  805003:	73 db                	jae    804fe0 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  805005:	4c 39 e2             	cmp    %r12,%rdx
+  805008:	49 0f 47 d4          	cmova  %r12,%rdx
+  80500c:	4c 39 f6             	cmp    %r14,%rsi
+  80500f:	49 0f 42 f6          	cmovb  %r14,%rsi
+  805013:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  805016:	85 c0                	test   %eax,%eax
+  805018:	79 c6                	jns    804fe0 <msync+0x47>
+  80501a:	eb 05                	jmp    805021 <msync+0x88>
+    }
+
+    return 0;
+  80501c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805021:	48 83 c4 08          	add    $0x8,%rsp
+  805025:	5b                   	pop    %rbx
+  805026:	41 5c                	pop    %r12
+  805028:	41 5d                	pop    %r13
+  80502a:	41 5e                	pop    %r14
+  80502c:	41 5f                	pop    %r15
+  80502e:	5d                   	pop    %rbp
+  80502f:	c3                   	ret
+
+0000000000805030 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  805030:	55                   	push   %rbp
+  805031:	48 89 e5             	mov    %rsp,%rbp
+  805034:	41 57                	push   %r15
+  805036:	41 56                	push   %r14
+  805038:	41 55                	push   %r13
+  80503a:	41 54                	push   %r12
+  80503c:	53                   	push   %rbx
+  80503d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  805041:	49 89 ff             	mov    %rdi,%r15
+  805044:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80504b:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  805052:	00 
+  805053:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80505a:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  805061:	00 00 00 
+  805064:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  80506b:	48 89 d8             	mov    %rbx,%rax
+  80506e:	eb 09                	jmp    805079 <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  805070:	48 83 c0 20          	add    $0x20,%rax
+  805074:	4c 39 f0             	cmp    %r14,%rax
+  805077:	74 40                	je     8050b9 <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  805079:	48 8b 10             	mov    (%rax),%rdx
+  80507c:	4c 39 e2             	cmp    %r12,%rdx
+  80507f:	73 ef                	jae    805070 <munmap+0x40>
+  805081:	48 85 d2             	test   %rdx,%rdx
+  805084:	74 ea                	je     805070 <munmap+0x40>
+  805086:	48 89 d7             	mov    %rdx,%rdi
+  805089:	48 03 78 08          	add    0x8(%rax),%rdi
+  80508d:	49 39 ff             	cmp    %rdi,%r15
+  805090:	73 de                	jae    805070 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  805092:	49 39 fc             	cmp    %rdi,%r12
+  805095:	72 05                	jb     80509c <munmap+0x6c>
+  805097:	4c 39 fa             	cmp    %r15,%rdx
+  80509a:	73 d4                	jae    805070 <munmap+0x40>
+  80509c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  8050a1:	48 83 c4 08          	add    $0x8,%rsp
+  8050a5:	5b                   	pop    %rbx
+  8050a6:	41 5c                	pop    %r12
+  8050a8:	41 5d                	pop    %r13
+  8050aa:	41 5e                	pop    %r14
+  8050ac:	41 5f                	pop    %r15
+  8050ae:	5d                   	pop    %rbp
+  8050af:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8050b0:	48 83 c3 20          	add    $0x20,%rbx
+  8050b4:	4c 39 f3             	cmp    %r14,%rbx
+  8050b7:	74 5c                	je     805115 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  8050b9:	48 8b 33             	mov    (%rbx),%rsi
+  8050bc:	4c 39 e6             	cmp    %r12,%rsi
+  8050bf:	73 ef                	jae    8050b0 <munmap+0x80>
+  8050c1:	48 85 f6             	test   %rsi,%rsi
+  8050c4:	74 ea                	je     8050b0 <munmap+0x80>
+  8050c6:	48 89 f2             	mov    %rsi,%rdx
+  8050c9:	48 03 53 08          	add    0x8(%rbx),%rdx
+  8050cd:	49 39 d7             	cmp    %rdx,%r15
+  8050d0:	73 de                	jae    8050b0 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  8050d2:	48 89 df             	mov    %rbx,%rdi
+  8050d5:	48 b8 20 4c 80 00 00 	movabs $0x804c20,%rax
+  8050dc:	00 00 00 
+  8050df:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8050e1:	85 c0                	test   %eax,%eax
+  8050e3:	78 bc                	js     8050a1 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  8050e5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8050e9:	48 8b 33             	mov    (%rbx),%rsi
+  8050ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050f1:	48 b8 4b 2b 80 00 00 	movabs $0x802b4b,%rax
+  8050f8:	00 00 00 
+  8050fb:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  8050fd:	8b 7b 18             	mov    0x18(%rbx),%edi
+  805100:	48 b8 c4 32 80 00 00 	movabs $0x8032c4,%rax
+  805107:	00 00 00 
+  80510a:	ff d0                	call   *%rax
+        reg->start = 0;
+  80510c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805113:	eb 9b                	jmp    8050b0 <munmap+0x80>
+    return 0;
+  805115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80511a:	eb 85                	jmp    8050a1 <munmap+0x71>
+
+000000000080511c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80511c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805121:	c3                   	ret
+
+0000000000805122 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805122:	55                   	push   %rbp
+  805123:	48 89 e5             	mov    %rsp,%rbp
+  805126:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805129:	48 be 65 66 80 00 00 	movabs $0x806665,%rsi
+  805130:	00 00 00 
+  805133:	48 b8 0e 23 80 00 00 	movabs $0x80230e,%rax
+  80513a:	00 00 00 
+  80513d:	ff d0                	call   *%rax
+    return 0;
+}
+  80513f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805144:	5d                   	pop    %rbp
+  805145:	c3                   	ret
+
+0000000000805146 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805146:	55                   	push   %rbp
+  805147:	48 89 e5             	mov    %rsp,%rbp
+  80514a:	41 57                	push   %r15
+  80514c:	41 56                	push   %r14
+  80514e:	41 55                	push   %r13
+  805150:	41 54                	push   %r12
+  805152:	53                   	push   %rbx
+  805153:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80515a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  805161:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  805168:	00 00 00 00 
+  80516c:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  805173:	00 00 00 00 
+  805177:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  80517e:	00 00 00 00 
+  805182:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  805189:	00 00 00 00 
+  80518d:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  805194:	00 00 00 00 
+  805198:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  80519f:	00 00 00 00 
+  8051a3:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  8051aa:	00 
+  8051ab:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  8051b2:	00 
+  8051b3:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8051ba:	00 
+  8051bb:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8051c2:	00 
+  8051c3:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8051ca:	00 
+  8051cb:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8051d2:	00 
+  8051d3:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8051da:	00 
+  8051db:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8051e2:	00 
+  8051e3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8051ea:	00 
+  8051eb:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8051f2:	00 
+    for (res = 0; res < n; res += inc) {
+  8051f3:	48 85 d2             	test   %rdx,%rdx
+  8051f6:	74 7a                	je     805272 <devcons_write+0x12c>
+  8051f8:	49 89 d6             	mov    %rdx,%r14
+  8051fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805201:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805206:	49 bf 5e 26 80 00 00 	movabs $0x80265e,%r15
+  80520d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805210:	4c 89 f3             	mov    %r14,%rbx
+  805213:	48 29 f3             	sub    %rsi,%rbx
+  805216:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80521b:	48 39 c3             	cmp    %rax,%rbx
+  80521e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805222:	4c 63 eb             	movslq %ebx,%r13
+  805225:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80522c:	48 01 c6             	add    %rax,%rsi
+  80522f:	4c 89 ea             	mov    %r13,%rdx
+  805232:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805239:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80523c:	4c 89 ee             	mov    %r13,%rsi
+  80523f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805246:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  80524d:	00 00 00 
+  805250:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805252:	41 01 dc             	add    %ebx,%r12d
+  805255:	49 63 f4             	movslq %r12d,%rsi
+  805258:	4c 39 f6             	cmp    %r14,%rsi
+  80525b:	72 b3                	jb     805210 <devcons_write+0xca>
+    return res;
+  80525d:	49 63 c4             	movslq %r12d,%rax
+}
+  805260:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805267:	5b                   	pop    %rbx
+  805268:	41 5c                	pop    %r12
+  80526a:	41 5d                	pop    %r13
+  80526c:	41 5e                	pop    %r14
+  80526e:	41 5f                	pop    %r15
+  805270:	5d                   	pop    %rbp
+  805271:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805272:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805278:	eb e3                	jmp    80525d <devcons_write+0x117>
+
+000000000080527a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80527a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80527d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805282:	48 85 c0             	test   %rax,%rax
+  805285:	74 55                	je     8052dc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805287:	55                   	push   %rbp
+  805288:	48 89 e5             	mov    %rsp,%rbp
+  80528b:	41 55                	push   %r13
+  80528d:	41 54                	push   %r12
+  80528f:	53                   	push   %rbx
+  805290:	48 83 ec 08          	sub    $0x8,%rsp
+  805294:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805297:	48 bb be 28 80 00 00 	movabs $0x8028be,%rbx
+  80529e:	00 00 00 
+  8052a1:	49 bc d2 29 80 00 00 	movabs $0x8029d2,%r12
+  8052a8:	00 00 00 
+  8052ab:	eb 03                	jmp    8052b0 <devcons_read+0x36>
+  8052ad:	41 ff d4             	call   *%r12
+  8052b0:	ff d3                	call   *%rbx
+  8052b2:	85 c0                	test   %eax,%eax
+  8052b4:	74 f7                	je     8052ad <devcons_read+0x33>
+    if (c < 0) return c;
+  8052b6:	48 63 d0             	movslq %eax,%rdx
+  8052b9:	78 13                	js     8052ce <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8052bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052c0:	83 f8 04             	cmp    $0x4,%eax
+  8052c3:	74 09                	je     8052ce <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052c5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052c9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8052ce:	48 89 d0             	mov    %rdx,%rax
+  8052d1:	48 83 c4 08          	add    $0x8,%rsp
+  8052d5:	5b                   	pop    %rbx
+  8052d6:	41 5c                	pop    %r12
+  8052d8:	41 5d                	pop    %r13
+  8052da:	5d                   	pop    %rbp
+  8052db:	c3                   	ret
+  8052dc:	48 89 d0             	mov    %rdx,%rax
+  8052df:	c3                   	ret
+
+00000000008052e0 <cputchar>:
+cputchar(int ch) {
+  8052e0:	55                   	push   %rbp
+  8052e1:	48 89 e5             	mov    %rsp,%rbp
+  8052e4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8052e8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8052ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8052f1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8052f5:	48 b8 8b 28 80 00 00 	movabs $0x80288b,%rax
+  8052fc:	00 00 00 
+  8052ff:	ff d0                	call   *%rax
+}
+  805301:	c9                   	leave
+  805302:	c3                   	ret
+
+0000000000805303 <getchar>:
+getchar(void) {
+  805303:	55                   	push   %rbp
+  805304:	48 89 e5             	mov    %rsp,%rbp
+  805307:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80530b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805310:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805314:	bf 00 00 00 00       	mov    $0x0,%edi
+  805319:	48 b8 42 34 80 00 00 	movabs $0x803442,%rax
+  805320:	00 00 00 
+  805323:	ff d0                	call   *%rax
+  805325:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805327:	85 c0                	test   %eax,%eax
+  805329:	78 06                	js     805331 <getchar+0x2e>
+  80532b:	74 08                	je     805335 <getchar+0x32>
+  80532d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805331:	89 d0                	mov    %edx,%eax
+  805333:	c9                   	leave
+  805334:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805335:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80533a:	eb f5                	jmp    805331 <getchar+0x2e>
+
+000000000080533c <iscons>:
+iscons(int fdnum) {
+  80533c:	55                   	push   %rbp
+  80533d:	48 89 e5             	mov    %rsp,%rbp
+  805340:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805344:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805348:	48 b8 5f 31 80 00 00 	movabs $0x80315f,%rax
+  80534f:	00 00 00 
+  805352:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805354:	85 c0                	test   %eax,%eax
+  805356:	78 18                	js     805370 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805358:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80535c:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805363:	00 00 00 
+  805366:	8b 00                	mov    (%rax),%eax
+  805368:	39 02                	cmp    %eax,(%rdx)
+  80536a:	0f 94 c0             	sete   %al
+  80536d:	0f b6 c0             	movzbl %al,%eax
+}
+  805370:	c9                   	leave
+  805371:	c3                   	ret
+
+0000000000805372 <opencons>:
+opencons(void) {
+  805372:	55                   	push   %rbp
+  805373:	48 89 e5             	mov    %rsp,%rbp
+  805376:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80537a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80537e:	48 b8 ff 30 80 00 00 	movabs $0x8030ff,%rax
+  805385:	00 00 00 
+  805388:	ff d0                	call   *%rax
+  80538a:	85 c0                	test   %eax,%eax
+  80538c:	78 49                	js     8053d7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80538e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805393:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805398:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80539c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053a1:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  8053a8:	00 00 00 
+  8053ab:	ff d0                	call   *%rax
+  8053ad:	85 c0                	test   %eax,%eax
+  8053af:	78 26                	js     8053d7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8053b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053b5:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  8053bc:	00 00 
+  8053be:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8053c0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053c4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053cb:	48 b8 d1 30 80 00 00 	movabs $0x8030d1,%rax
+  8053d2:	00 00 00 
+  8053d5:	ff d0                	call   *%rax
+}
+  8053d7:	c9                   	leave
+  8053d8:	c3                   	ret
+
+00000000008053d9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8053d9:	55                   	push   %rbp
+  8053da:	48 89 e5             	mov    %rsp,%rbp
+  8053dd:	41 56                	push   %r14
+  8053df:	41 55                	push   %r13
+  8053e1:	41 54                	push   %r12
+  8053e3:	53                   	push   %rbx
+  8053e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8053e8:	49 89 fc             	mov    %rdi,%r12
+  8053eb:	41 89 f5             	mov    %esi,%r13d
+  8053ee:	48 89 d3             	mov    %rdx,%rbx
+  8053f1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8053f5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8053f9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8053fd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805404:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805408:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80540c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805410:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805414:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80541b:	00 00 00 
+  80541e:	4c 8b 30             	mov    (%rax),%r14
+  805421:	48 b8 9b 29 80 00 00 	movabs $0x80299b,%rax
+  805428:	00 00 00 
+  80542b:	ff d0                	call   *%rax
+  80542d:	89 c6                	mov    %eax,%esi
+  80542f:	45 89 e8             	mov    %r13d,%r8d
+  805432:	4c 89 e1             	mov    %r12,%rcx
+  805435:	4c 89 f2             	mov    %r14,%rdx
+  805438:	48 bf 78 66 80 00 00 	movabs $0x806678,%rdi
+  80543f:	00 00 00 
+  805442:	b8 00 00 00 00       	mov    $0x0,%eax
+  805447:	49 bc d7 19 80 00 00 	movabs $0x8019d7,%r12
+  80544e:	00 00 00 
+  805451:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  805454:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  805458:	48 89 df             	mov    %rbx,%rdi
+  80545b:	48 b8 73 19 80 00 00 	movabs $0x801973,%rax
+  805462:	00 00 00 
+  805465:	ff d0                	call   *%rax
+    cprintf("\n");
+  805467:	48 bf 53 65 80 00 00 	movabs $0x806553,%rdi
+  80546e:	00 00 00 
+  805471:	b8 00 00 00 00       	mov    $0x0,%eax
+  805476:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  805479:	cc                   	int3
+  80547a:	eb fd                	jmp    805479 <_panic+0xa0>
+
+000000000080547c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80547c:	55                   	push   %rbp
+  80547d:	48 89 e5             	mov    %rsp,%rbp
+  805480:	41 56                	push   %r14
+  805482:	41 55                	push   %r13
+  805484:	41 54                	push   %r12
+  805486:	53                   	push   %rbx
+  805487:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80548a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805491:	00 00 00 
+  805494:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805498:	74 27                	je     8054c1 <_handle_vectored_pagefault+0x45>
+  80549a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80549f:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8054a6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054a9:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8054ac:	4c 89 e7             	mov    %r12,%rdi
+  8054af:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8054b4:	84 c0                	test   %al,%al
+  8054b6:	75 45                	jne    8054fd <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054b8:	48 83 c3 01          	add    $0x1,%rbx
+  8054bc:	49 3b 1e             	cmp    (%r14),%rbx
+  8054bf:	72 eb                	jb     8054ac <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8054c1:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8054c8:	00 
+  8054c9:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8054ce:	4d 8b 04 24          	mov    (%r12),%r8
+  8054d2:	48 ba a0 66 80 00 00 	movabs $0x8066a0,%rdx
+  8054d9:	00 00 00 
+  8054dc:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8054e1:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  8054e8:	00 00 00 
+  8054eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054f0:	49 ba d9 53 80 00 00 	movabs $0x8053d9,%r10
+  8054f7:	00 00 00 
+  8054fa:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8054fd:	5b                   	pop    %rbx
+  8054fe:	41 5c                	pop    %r12
+  805500:	41 5d                	pop    %r13
+  805502:	41 5e                	pop    %r14
+  805504:	5d                   	pop    %rbp
+  805505:	c3                   	ret
+
+0000000000805506 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805506:	55                   	push   %rbp
+  805507:	48 89 e5             	mov    %rsp,%rbp
+  80550a:	53                   	push   %rbx
+  80550b:	48 83 ec 08          	sub    $0x8,%rsp
+  80550f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805512:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  805517:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  80551e:	00 00 00 
+  805521:	80 38 00             	cmpb   $0x0,(%rax)
+  805524:	74 68                	je     80558e <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805526:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  80552d:	00 00 00 
+  805530:	48 8b 08             	mov    (%rax),%rcx
+  805533:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  805538:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80553f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805542:	48 85 c9             	test   %rcx,%rcx
+  805545:	0f 84 e0 00 00 00    	je     80562b <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80554b:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  80554f:	0f 84 c9 00 00 00    	je     80561e <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805555:	48 83 c2 01          	add    $0x1,%rdx
+  805559:	48 39 ca             	cmp    %rcx,%rdx
+  80555c:	75 ed                	jne    80554b <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80555e:	48 83 f9 08          	cmp    $0x8,%rcx
+  805562:	0f 84 84 00 00 00    	je     8055ec <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805568:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  80556c:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  805573:	00 00 00 
+  805576:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80557d:	00 00 00 
+  805580:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805584:	85 f6                	test   %esi,%esi
+  805586:	0f 89 97 00 00 00    	jns    805623 <add_pgfault_handler+0x11d>
+  80558c:	eb 63                	jmp    8055f1 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  80558e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805593:	ba 00 80 00 00       	mov    $0x8000,%edx
+  805598:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  80559f:	00 00 00 
+  8055a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055a7:	48 b8 73 2a 80 00 00 	movabs $0x802a73,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+  8055b3:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8055b5:	85 c0                	test   %eax,%eax
+  8055b7:	78 38                	js     8055f1 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8055b9:	48 be 07 57 80 00 00 	movabs $0x805707,%rsi
+  8055c0:	00 00 00 
+  8055c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055c8:	48 b8 96 2c 80 00 00 	movabs $0x802c96,%rax
+  8055cf:	00 00 00 
+  8055d2:	ff d0                	call   *%rax
+  8055d4:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  8055d6:	85 c0                	test   %eax,%eax
+  8055d8:	78 17                	js     8055f1 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  8055da:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8055e1:	00 00 00 
+  8055e4:	c6 00 01             	movb   $0x1,(%rax)
+  8055e7:	e9 3a ff ff ff       	jmp    805526 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  8055ec:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055f1:	89 f1                	mov    %esi,%ecx
+  8055f3:	48 ba de 66 80 00 00 	movabs $0x8066de,%rdx
+  8055fa:	00 00 00 
+  8055fd:	be 42 00 00 00       	mov    $0x42,%esi
+  805602:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  805609:	00 00 00 
+  80560c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805611:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  805618:	00 00 00 
+  80561b:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80561e:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805623:	89 f0                	mov    %esi,%eax
+  805625:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805629:	c9                   	leave
+  80562a:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80562b:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805632:	00 00 00 
+  805635:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80563c:	48 89 d8             	mov    %rbx,%rax
+  80563f:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805646:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805649:	eb d8                	jmp    805623 <add_pgfault_handler+0x11d>
+
+000000000080564b <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80564b:	55                   	push   %rbp
+  80564c:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80564f:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805656:	00 00 00 
+  805659:	80 38 00             	cmpb   $0x0,(%rax)
+  80565c:	74 33                	je     805691 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80565e:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  805665:	00 00 00 
+  805668:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80566d:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  805674:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805677:	48 85 c0             	test   %rax,%rax
+  80567a:	0f 84 85 00 00 00    	je     805705 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805680:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805684:	74 40                	je     8056c6 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805686:	48 83 c1 01          	add    $0x1,%rcx
+  80568a:	48 39 c1             	cmp    %rax,%rcx
+  80568d:	75 f1                	jne    805680 <remove_pgfault_handler+0x35>
+  80568f:	eb 74                	jmp    805705 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805691:	48 b9 f6 66 80 00 00 	movabs $0x8066f6,%rcx
+  805698:	00 00 00 
+  80569b:	48 ba b6 65 80 00 00 	movabs $0x8065b6,%rdx
+  8056a2:	00 00 00 
+  8056a5:	be 48 00 00 00       	mov    $0x48,%esi
+  8056aa:	48 bf d0 66 80 00 00 	movabs $0x8066d0,%rdi
+  8056b1:	00 00 00 
+  8056b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056b9:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8056c0:	00 00 00 
+  8056c3:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8056c6:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8056cd:	00 
+  8056ce:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8056d2:	48 29 ca             	sub    %rcx,%rdx
+  8056d5:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8056dc:	00 00 00 
+  8056df:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8056e3:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8056e8:	48 89 ce             	mov    %rcx,%rsi
+  8056eb:	48 b8 5e 26 80 00 00 	movabs $0x80265e,%rax
+  8056f2:	00 00 00 
+  8056f5:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8056f7:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8056fe:	00 00 00 
+  805701:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805705:	5d                   	pop    %rbp
+  805706:	c3                   	ret
+
+0000000000805707 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805707:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80570a:	48 b8 7c 54 80 00 00 	movabs $0x80547c,%rax
+  805711:	00 00 00 
+    call *%rax
+  805714:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805716:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  80571d:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  80571e:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805725:	00 
+    subq $8, %rcx
+  805726:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80572a:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  80572d:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805734:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805735:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  805739:	4c 8b 3c 24          	mov    (%rsp),%r15
+  80573d:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805742:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  805747:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80574c:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  805751:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  805756:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  80575b:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  805760:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  805765:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  80576a:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  80576f:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  805774:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  805779:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  80577e:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  805783:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  805787:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  80578b:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  80578c:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  80578d:	c3                   	ret
+
+000000000080578e <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  80578e:	85 ff                	test   %edi,%edi
+  805790:	78 58                	js     8057ea <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  805792:	48 85 f6             	test   %rsi,%rsi
+  805795:	74 12                	je     8057a9 <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  805797:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80579e:	00 00 00 
+  8057a1:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8057a7:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8057a9:	48 85 c9             	test   %rcx,%rcx
+  8057ac:	74 12                	je     8057c0 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  8057ae:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8057b5:	00 00 00 
+  8057b8:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  8057be:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  8057c0:	48 85 d2             	test   %rdx,%rdx
+  8057c3:	74 14                	je     8057d9 <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  8057c5:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8057cc:	00 00 00 
+  8057cf:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  8057d6:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  8057d9:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8057e0:	00 00 00 
+  8057e3:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  8057e9:	c3                   	ret
+        if (from_env_store) {
+  8057ea:	48 85 f6             	test   %rsi,%rsi
+  8057ed:	74 06                	je     8057f5 <ipc_result+0x67>
+            *from_env_store = 0;
+  8057ef:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  8057f5:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  8057f7:	48 85 c9             	test   %rcx,%rcx
+  8057fa:	74 ed                	je     8057e9 <ipc_result+0x5b>
+            *perm_store = 0;
+  8057fc:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805802:	c3                   	ret
+
+0000000000805803 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805803:	55                   	push   %rbp
+  805804:	48 89 e5             	mov    %rsp,%rbp
+  805807:	41 55                	push   %r13
+  805809:	41 54                	push   %r12
+  80580b:	53                   	push   %rbx
+  80580c:	48 83 ec 08          	sub    $0x8,%rsp
+  805810:	49 89 fc             	mov    %rdi,%r12
+  805813:	48 89 f7             	mov    %rsi,%rdi
+  805816:	48 89 d3             	mov    %rdx,%rbx
+  805819:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80581c:	48 85 f6             	test   %rsi,%rsi
+  80581f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805826:	00 00 00 
+  805829:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  80582d:	be 00 00 00 00       	mov    $0x0,%esi
+  805832:	48 85 d2             	test   %rdx,%rdx
+  805835:	74 03                	je     80583a <ipc_recv+0x37>
+  805837:	48 8b 32             	mov    (%rdx),%rsi
+  80583a:	48 b8 bf 2f 80 00 00 	movabs $0x802fbf,%rax
+  805841:	00 00 00 
+  805844:	ff d0                	call   *%rax
+  805846:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  805848:	4c 89 e9             	mov    %r13,%rcx
+  80584b:	48 89 da             	mov    %rbx,%rdx
+  80584e:	4c 89 e6             	mov    %r12,%rsi
+  805851:	48 b8 8e 57 80 00 00 	movabs $0x80578e,%rax
+  805858:	00 00 00 
+  80585b:	ff d0                	call   *%rax
+}
+  80585d:	48 83 c4 08          	add    $0x8,%rsp
+  805861:	5b                   	pop    %rbx
+  805862:	41 5c                	pop    %r12
+  805864:	41 5d                	pop    %r13
+  805866:	5d                   	pop    %rbp
+  805867:	c3                   	ret
+
+0000000000805868 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805868:	55                   	push   %rbp
+  805869:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80586c:	48 85 d2             	test   %rdx,%rdx
+  80586f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805876:	00 00 00 
+  805879:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80587d:	89 f6                	mov    %esi,%esi
+  80587f:	48 b8 4b 2e 80 00 00 	movabs $0x802e4b,%rax
+  805886:	00 00 00 
+  805889:	ff d0                	call   *%rax
+    if (res < 0) {
+  80588b:	85 c0                	test   %eax,%eax
+  80588d:	78 02                	js     805891 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  80588f:	5d                   	pop    %rbp
+  805890:	c3                   	ret
+        panic("ipc_send: %i", res);
+  805891:	89 c1                	mov    %eax,%ecx
+  805893:	48 ba 10 67 80 00 00 	movabs $0x806710,%rdx
+  80589a:	00 00 00 
+  80589d:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8058a2:	48 bf 1d 67 80 00 00 	movabs $0x80671d,%rdi
+  8058a9:	00 00 00 
+  8058ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058b1:	49 b8 d9 53 80 00 00 	movabs $0x8053d9,%r8
+  8058b8:	00 00 00 
+  8058bb:	41 ff d0             	call   *%r8
+
+00000000008058be <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8058be:	55                   	push   %rbp
+  8058bf:	48 89 e5             	mov    %rsp,%rbp
+  8058c2:	53                   	push   %rbx
+  8058c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8058c7:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8058cb:	48 85 d2             	test   %rdx,%rdx
+  8058ce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058d5:	00 00 00 
+  8058d8:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8058dc:	4d 85 c9             	test   %r9,%r9
+  8058df:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8058e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058e8:	48 85 db             	test   %rbx,%rbx
+  8058eb:	74 03                	je     8058f0 <ipc_call+0x32>
+  8058ed:	48 8b 03             	mov    (%rbx),%rax
+  8058f0:	89 f6                	mov    %esi,%esi
+  8058f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8058f6:	50                   	push   %rax
+  8058f7:	48 b8 7d 2e 80 00 00 	movabs $0x802e7d,%rax
+  8058fe:	00 00 00 
+  805901:	ff d0                	call   *%rax
+  805903:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805905:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  805909:	48 89 da             	mov    %rbx,%rdx
+  80590c:	be 00 00 00 00       	mov    $0x0,%esi
+  805911:	48 b8 8e 57 80 00 00 	movabs $0x80578e,%rax
+  805918:	00 00 00 
+  80591b:	ff d0                	call   *%rax
+}
+  80591d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805921:	c9                   	leave
+  805922:	c3                   	ret
+
+0000000000805923 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805923:	55                   	push   %rbp
+  805924:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  805927:	89 f6                	mov    %esi,%esi
+  805929:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  805930:	00 00 00 
+  805933:	ff d0                	call   *%rax
+  805935:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  805937:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80593c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805941:	be 00 00 00 00       	mov    $0x0,%esi
+  805946:	48 b8 8e 57 80 00 00 	movabs $0x80578e,%rax
+  80594d:	00 00 00 
+  805950:	ff d0                	call   *%rax
+}
+  805952:	5d                   	pop    %rbp
+  805953:	c3                   	ret
+
+0000000000805954 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805954:	55                   	push   %rbp
+  805955:	48 89 e5             	mov    %rsp,%rbp
+  805958:	41 54                	push   %r12
+  80595a:	53                   	push   %rbx
+  80595b:	4c 89 cb             	mov    %r9,%rbx
+  80595e:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  805962:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  805966:	48 85 d2             	test   %rdx,%rdx
+  805969:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805970:	00 00 00 
+  805973:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  805977:	4d 85 c9             	test   %r9,%r9
+  80597a:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  80597e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805983:	4d 85 e4             	test   %r12,%r12
+  805986:	74 04                	je     80598c <ipc_reply_wait+0x38>
+  805988:	49 8b 04 24          	mov    (%r12),%rax
+  80598c:	89 f6                	mov    %esi,%esi
+  80598e:	48 83 ec 08          	sub    $0x8,%rsp
+  805992:	50                   	push   %rax
+  805993:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  80599a:	00 00 00 
+  80599d:	ff d0                	call   *%rax
+  80599f:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8059a1:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8059a5:	4c 89 e2             	mov    %r12,%rdx
+  8059a8:	48 89 de             	mov    %rbx,%rsi
+  8059ab:	48 b8 8e 57 80 00 00 	movabs $0x80578e,%rax
+  8059b2:	00 00 00 
+  8059b5:	ff d0                	call   *%rax
+}
+  8059b7:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8059bb:	5b                   	pop    %rbx
+  8059bc:	41 5c                	pop    %r12
+  8059be:	5d                   	pop    %rbp
+  8059bf:	c3                   	ret
+
+00000000008059c0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8059c0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  8059c5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8059cc:	00 00 00 
+  8059cf:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  8059d6:	48 01 ca             	add    %rcx,%rdx
+  8059d9:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  8059df:	39 fa                	cmp    %edi,%edx
+  8059e1:	74 12                	je     8059f5 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  8059e3:	48 83 c0 01          	add    $0x1,%rax
+  8059e7:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  8059ed:	75 e0                	jne    8059cf <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8059ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059f4:	c3                   	ret
+            return envs[i].env_id;
+  8059f5:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  8059fc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805a03:	00 00 00 
+  805a06:	48 01 d0             	add    %rdx,%rax
+  805a09:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805a0f:	c3                   	ret
+
+0000000000805a10 <__rodata_start>:
+  805a10:	77 00                	ja     805a12 <__rodata_start+0x2>
+  805a12:	72 62                	jb     805a76 <__rodata_start+0x66>
+  805a14:	00 77 62             	add    %dh,0x62(%rdi)
+  805a17:	00 0f                	add    %cl,(%rdi)
+  805a19:	1f                   	(bad)
+  805a1a:	84 00                	test   %al,(%rax)
+  805a1c:	00 00                	add    %al,(%rax)
+  805a1e:	00 00                	add    %al,(%rax)
+  805a20:	b3 09                	mov    $0x9,%bl
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 ed                	add    %ch,%ch
+  805a29:	0d 80 00 00 00       	or     $0x80,%eax
+  805a2e:	00 00                	add    %al,(%rax)
+  805a30:	ed                   	in     (%dx),%eax
+  805a31:	0d 80 00 00 00       	or     $0x80,%eax
+  805a36:	00 00                	add    %al,(%rax)
+  805a38:	ed                   	in     (%dx),%eax
+  805a39:	0d 80 00 00 00       	or     $0x80,%eax
+  805a3e:	00 00                	add    %al,(%rax)
+  805a40:	ed                   	in     (%dx),%eax
+  805a41:	0d 80 00 00 00       	or     $0x80,%eax
+  805a46:	00 00                	add    %al,(%rax)
+  805a48:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 ed                	add    %ch,%ch
+  805a51:	0d 80 00 00 00       	or     $0x80,%eax
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	ed                   	in     (%dx),%eax
+  805a59:	0d 80 00 00 00       	or     $0x80,%eax
+  805a5e:	00 00                	add    %al,(%rax)
+  805a60:	ed                   	in     (%dx),%eax
+  805a61:	0d 80 00 00 00       	or     $0x80,%eax
+  805a66:	00 00                	add    %al,(%rax)
+  805a68:	ed                   	in     (%dx),%eax
+  805a69:	0d 80 00 00 00       	or     $0x80,%eax
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	ed                   	in     (%dx),%eax
+  805a71:	0d 80 00 00 00       	or     $0x80,%eax
+  805a76:	00 00                	add    %al,(%rax)
+  805a78:	8c 0a                	mov    %cs,(%rdx)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a86:	00 00                	add    %al,(%rax)
+  805a88:	8c 0a                	mov    %cs,(%rdx)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805a96:	00 00                	add    %al,(%rax)
+  805a98:	8c 0a                	mov    %cs,(%rdx)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	8c 0a                	mov    %cs,(%rdx)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ab6:	00 00                	add    %al,(%rax)
+  805ab8:	8c 0a                	mov    %cs,(%rdx)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805ac6:	00 00                	add    %al,(%rax)
+  805ac8:	ed                   	in     (%dx),%eax
+  805ac9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ace:	00 00                	add    %al,(%rax)
+  805ad0:	ed                   	in     (%dx),%eax
+  805ad1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ad6:	00 00                	add    %al,(%rax)
+  805ad8:	ed                   	in     (%dx),%eax
+  805ad9:	0d 80 00 00 00       	or     $0x80,%eax
+  805ade:	00 00                	add    %al,(%rax)
+  805ae0:	ed                   	in     (%dx),%eax
+  805ae1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ae6:	00 00                	add    %al,(%rax)
+  805ae8:	ed                   	in     (%dx),%eax
+  805ae9:	0d 80 00 00 00       	or     $0x80,%eax
+  805aee:	00 00                	add    %al,(%rax)
+  805af0:	ed                   	in     (%dx),%eax
+  805af1:	0d 80 00 00 00       	or     $0x80,%eax
+  805af6:	00 00                	add    %al,(%rax)
+  805af8:	ed                   	in     (%dx),%eax
+  805af9:	0d 80 00 00 00       	or     $0x80,%eax
+  805afe:	00 00                	add    %al,(%rax)
+  805b00:	ed                   	in     (%dx),%eax
+  805b01:	0d 80 00 00 00       	or     $0x80,%eax
+  805b06:	00 00                	add    %al,(%rax)
+  805b08:	ed                   	in     (%dx),%eax
+  805b09:	0d 80 00 00 00       	or     $0x80,%eax
+  805b0e:	00 00                	add    %al,(%rax)
+  805b10:	ed                   	in     (%dx),%eax
+  805b11:	0d 80 00 00 00       	or     $0x80,%eax
+  805b16:	00 00                	add    %al,(%rax)
+  805b18:	ed                   	in     (%dx),%eax
+  805b19:	0d 80 00 00 00       	or     $0x80,%eax
+  805b1e:	00 00                	add    %al,(%rax)
+  805b20:	ed                   	in     (%dx),%eax
+  805b21:	0d 80 00 00 00       	or     $0x80,%eax
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	ed                   	in     (%dx),%eax
+  805b29:	0d 80 00 00 00       	or     $0x80,%eax
+  805b2e:	00 00                	add    %al,(%rax)
+  805b30:	ed                   	in     (%dx),%eax
+  805b31:	0d 80 00 00 00       	or     $0x80,%eax
+  805b36:	00 00                	add    %al,(%rax)
+  805b38:	ed                   	in     (%dx),%eax
+  805b39:	0d 80 00 00 00       	or     $0x80,%eax
+  805b3e:	00 00                	add    %al,(%rax)
+  805b40:	ed                   	in     (%dx),%eax
+  805b41:	0d 80 00 00 00       	or     $0x80,%eax
+  805b46:	00 00                	add    %al,(%rax)
+  805b48:	ed                   	in     (%dx),%eax
+  805b49:	0d 80 00 00 00       	or     $0x80,%eax
+  805b4e:	00 00                	add    %al,(%rax)
+  805b50:	ed                   	in     (%dx),%eax
+  805b51:	0d 80 00 00 00       	or     $0x80,%eax
+  805b56:	00 00                	add    %al,(%rax)
+  805b58:	ed                   	in     (%dx),%eax
+  805b59:	0d 80 00 00 00       	or     $0x80,%eax
+  805b5e:	00 00                	add    %al,(%rax)
+  805b60:	ed                   	in     (%dx),%eax
+  805b61:	0d 80 00 00 00       	or     $0x80,%eax
+  805b66:	00 00                	add    %al,(%rax)
+  805b68:	ed                   	in     (%dx),%eax
+  805b69:	0d 80 00 00 00       	or     $0x80,%eax
+  805b6e:	00 00                	add    %al,(%rax)
+  805b70:	ed                   	in     (%dx),%eax
+  805b71:	0d 80 00 00 00       	or     $0x80,%eax
+  805b76:	00 00                	add    %al,(%rax)
+  805b78:	ed                   	in     (%dx),%eax
+  805b79:	0d 80 00 00 00       	or     $0x80,%eax
+  805b7e:	00 00                	add    %al,(%rax)
+  805b80:	ed                   	in     (%dx),%eax
+  805b81:	0d 80 00 00 00       	or     $0x80,%eax
+  805b86:	00 00                	add    %al,(%rax)
+  805b88:	ed                   	in     (%dx),%eax
+  805b89:	0d 80 00 00 00       	or     $0x80,%eax
+  805b8e:	00 00                	add    %al,(%rax)
+  805b90:	ed                   	in     (%dx),%eax
+  805b91:	0d 80 00 00 00       	or     $0x80,%eax
+  805b96:	00 00                	add    %al,(%rax)
+  805b98:	ed                   	in     (%dx),%eax
+  805b99:	0d 80 00 00 00       	or     $0x80,%eax
+  805b9e:	00 00                	add    %al,(%rax)
+  805ba0:	ed                   	in     (%dx),%eax
+  805ba1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ba6:	00 00                	add    %al,(%rax)
+  805ba8:	ed                   	in     (%dx),%eax
+  805ba9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bae:	00 00                	add    %al,(%rax)
+  805bb0:	ed                   	in     (%dx),%eax
+  805bb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bb6:	00 00                	add    %al,(%rax)
+  805bb8:	f4                   	hlt
+  805bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805bbf:	00 ed                	add    %ch,%ch
+  805bc1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bc6:	00 00                	add    %al,(%rax)
+  805bc8:	ed                   	in     (%dx),%eax
+  805bc9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bce:	00 00                	add    %al,(%rax)
+  805bd0:	2c 0b                	sub    $0xb,%al
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 ed                	add    %ch,%ch
+  805bd9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bde:	00 00                	add    %al,(%rax)
+  805be0:	ed                   	in     (%dx),%eax
+  805be1:	0d 80 00 00 00       	or     $0x80,%eax
+  805be6:	00 00                	add    %al,(%rax)
+  805be8:	ed                   	in     (%dx),%eax
+  805be9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bee:	00 00                	add    %al,(%rax)
+  805bf0:	ed                   	in     (%dx),%eax
+  805bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  805bf6:	00 00                	add    %al,(%rax)
+  805bf8:	ed                   	in     (%dx),%eax
+  805bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  805bfe:	00 00                	add    %al,(%rax)
+  805c00:	ed                   	in     (%dx),%eax
+  805c01:	0d 80 00 00 00       	or     $0x80,%eax
+  805c06:	00 00                	add    %al,(%rax)
+  805c08:	ed                   	in     (%dx),%eax
+  805c09:	0d 80 00 00 00       	or     $0x80,%eax
+  805c0e:	00 00                	add    %al,(%rax)
+  805c10:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805c13:	00 00                	add    %al,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 cb                	add    %cl,%bl
+  805c19:	0d 80 00 00 00       	or     $0x80,%eax
+  805c1e:	00 00                	add    %al,(%rax)
+  805c20:	ed                   	in     (%dx),%eax
+  805c21:	0d 80 00 00 00       	or     $0x80,%eax
+  805c26:	00 00                	add    %al,(%rax)
+  805c28:	ed                   	in     (%dx),%eax
+  805c29:	0d 80 00 00 00       	or     $0x80,%eax
+  805c2e:	00 00                	add    %al,(%rax)
+  805c30:	ed                   	in     (%dx),%eax
+  805c31:	0d 80 00 00 00       	or     $0x80,%eax
+  805c36:	00 00                	add    %al,(%rax)
+  805c38:	6a 0a                	push   $0xa
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 ed                	add    %ch,%ch
+  805c49:	0d 80 00 00 00       	or     $0x80,%eax
+  805c4e:	00 00                	add    %al,(%rax)
+  805c50:	ed                   	in     (%dx),%eax
+  805c51:	0d 80 00 00 00       	or     $0x80,%eax
+  805c56:	00 00                	add    %al,(%rax)
+  805c58:	3c 0a                	cmp    $0xa,%al
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 ed                	add    %ch,%ch
+  805c61:	0d 80 00 00 00       	or     $0x80,%eax
+  805c66:	00 00                	add    %al,(%rax)
+  805c68:	4f 0c 80             	rex.WRXB or $0x80,%al
+  805c6b:	00 00                	add    %al,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 29                	add    %ch,(%rcx)
+  805c79:	0c 80                	or     $0x80,%al
+  805c7b:	00 00                	add    %al,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5e 0a             	add    %bl,0xa(%rsi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 ed                	add    %ch,%ch
+  805c89:	0d 80 00 00 00       	or     $0x80,%eax
+  805c8e:	00 00                	add    %al,(%rax)
+  805c90:	1a 0b                	sbb    (%rbx),%cl
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 ed                	add    %ch,%ch
+  805c99:	0d 80 00 00 00       	or     $0x80,%eax
+  805c9e:	00 00                	add    %al,(%rax)
+  805ca0:	ce                   	(bad)
+  805ca1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ca7:	00 ed                	add    %ch,%ch
+  805ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  805cae:	00 00                	add    %al,(%rax)
+  805cb0:	ed                   	in     (%dx),%eax
+  805cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  805cb6:	00 00                	add    %al,(%rax)
+  805cb8:	f4                   	hlt
+  805cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805cbf:	00 37                	add    %dh,(%rdi)
+  805cc1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 37                	add    %dh,(%rdi)
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805ceb:	00 00                	add    %al,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 d2                	add    %dl,%dl
+  805cf1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cf7:	00 d2                	add    %dl,%dl
+  805cf9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805cff:	00 d2                	add    %dl,%dl
+  805d01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d07:	00 d2                	add    %dl,%dl
+  805d09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d0f:	00 d2                	add    %dl,%dl
+  805d11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d17:	00 d2                	add    %dl,%dl
+  805d19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d1f:	00 d2                	add    %dl,%dl
+  805d21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d27:	00 f6                	add    %dh,%dh
+  805d29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d2f:	00 f6                	add    %dh,%dh
+  805d31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d62:	80 00 00             	addb   $0x0,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805d6a:	80 00 00             	addb   $0x0,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 22                	add    %ah,(%rdx)
+  805d71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d77:	00 22                	add    %ah,(%rdx)
+  805d79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d7f:	00 22                	add    %ah,(%rdx)
+  805d81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d87:	00 22                	add    %ah,(%rdx)
+  805d89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d8f:	00 22                	add    %ah,(%rdx)
+  805d91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d97:	00 22                	add    %ah,(%rdx)
+  805d99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805d9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805da2:	80 00 00             	addb   $0x0,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805daa:	80 00 00             	addb   $0x0,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805db2:	80 00 00             	addb   $0x0,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dba:	80 00 00             	addb   $0x0,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dc2:	80 00 00             	addb   $0x0,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dca:	80 00 00             	addb   $0x0,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dd2:	80 00 00             	addb   $0x0,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dda:	80 00 00             	addb   $0x0,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805de2:	80 00 00             	addb   $0x0,(%rax)
+  805de5:	00 00                	add    %al,(%rax)
+  805de7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dea:	80 00 00             	addb   $0x0,(%rax)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5f 12             	add    %bl,0x12(%rdi)
+  805df2:	80 00 00             	addb   $0x0,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805dfa:	80 00 00             	addb   $0x0,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e02:	80 00 00             	addb   $0x0,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e0a:	80 00 00             	addb   $0x0,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e12:	80 00 00             	addb   $0x0,(%rax)
+  805e15:	00 00                	add    %al,(%rax)
+  805e17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e1a:	80 00 00             	addb   $0x0,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e22:	80 00 00             	addb   $0x0,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 46 12             	add    %al,0x12(%rsi)
+  805e2a:	80 00 00             	addb   $0x0,(%rax)
+  805e2d:	00 00                	add    %al,(%rax)
+  805e2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e32:	80 00 00             	addb   $0x0,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e3a:	80 00 00             	addb   $0x0,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e52:	80 00 00             	addb   $0x0,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e5a:	80 00 00             	addb   $0x0,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e62:	80 00 00             	addb   $0x0,(%rax)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805e6a:	80 00 00             	addb   $0x0,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 22                	add    %ah,(%rdx)
+  805e71:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e77:	00 22                	add    %ah,(%rdx)
+  805e79:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e7f:	00 22                	add    %ah,(%rdx)
+  805e81:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e87:	00 22                	add    %ah,(%rdx)
+  805e89:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e8f:	00 22                	add    %ah,(%rdx)
+  805e91:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e97:	00 22                	add    %ah,(%rdx)
+  805e99:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805e9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ea2:	80 00 00             	addb   $0x0,(%rax)
+  805ea5:	00 00                	add    %al,(%rax)
+  805ea7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eaa:	80 00 00             	addb   $0x0,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eb2:	80 00 00             	addb   $0x0,(%rax)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eba:	80 00 00             	addb   $0x0,(%rax)
+  805ebd:	00 00                	add    %al,(%rax)
+  805ebf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ec2:	80 00 00             	addb   $0x0,(%rax)
+  805ec5:	00 00                	add    %al,(%rax)
+  805ec7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ed2:	80 00 00             	addb   $0x0,(%rax)
+  805ed5:	00 00                	add    %al,(%rax)
+  805ed7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eda:	80 00 00             	addb   $0x0,(%rax)
+  805edd:	00 00                	add    %al,(%rax)
+  805edf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ee2:	80 00 00             	addb   $0x0,(%rax)
+  805ee5:	00 00                	add    %al,(%rax)
+  805ee7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ef2:	80 00 00             	addb   $0x0,(%rax)
+  805ef5:	00 00                	add    %al,(%rax)
+  805ef7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805efa:	80 00 00             	addb   $0x0,(%rax)
+  805efd:	00 00                	add    %al,(%rax)
+  805eff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f12:	80 00 00             	addb   $0x0,(%rax)
+  805f15:	00 00                	add    %al,(%rax)
+  805f17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f1a:	80 00 00             	addb   $0x0,(%rax)
+  805f1d:	00 00                	add    %al,(%rax)
+  805f1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805f22:	80 00 00             	addb   $0x0,(%rax)
+  805f25:	00 00                	add    %al,(%rax)
+  805f27:	00 46 12             	add    %al,0x12(%rsi)
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805f40 <basefix.0>:
+  805f40:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805f50:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805f60:	10 00 25 30 34 64 2d 25 30 32 64 2d 25 30 32 64     ..%04d-%02d-%02d
+  805f70:	20 25 30 32 64 3a 25 30 32 64 3a 25 30 32 64 00      %02d:%02d:%02d.
+  805f80:	56 44 41 54 45 3a 20 25 73 0a 00 3c 75 6e 6b 6e     VDATE: %s..<unkn
+  805f90:	6f 77 6e 3e 00 30 31 32 33 34 35 36 37 38 39 41     own>.0123456789A
+  805fa0:	42 43 44 45 46 00 30 31 32 33 34 35 36 37 38 39     BCDEF.0123456789
+  805fb0:	61 62 63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72     abcdef.(null).er
+  805fc0:	72 6f 72 20 25 64 00 75 6e 73 70 65 63 69 66 69     ror %d.unspecifi
+  805fd0:	65 64 20 65 72 72 6f 72 00 62 61 64 20 65 6e 76     ed error.bad env
+  805fe0:	69 72 6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64     ironment.invalid
+  805ff0:	20 70 61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f      parameter.out o
+  806000:	66 20 6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20     f memory.out of 
+  806010:	65 6e 76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72     environments.cor
+  806020:	72 75 70 74 65 64 20 64 65 62 75 67 20 69 6e 66     rupted debug inf
+  806030:	6f 00 73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66     o.segmentation f
+  806040:	61 75 6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46     ault.invalid ELF
+  806050:	20 69 6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73      image.no such s
+  806060:	79 73 74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79     ystem call.entry
+  806070:	20 6e 6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69      not found.env i
+  806080:	73 20 6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e     s not recving.un
+  806090:	65 78 70 65 63 74 65 64 20 65 6e 64 20 6f 66 20     expected end of 
+  8060a0:	66 69 6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61     file.no free spa
+  8060b0:	63 65 20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d     ce on disk.too m
+  8060c0:	61 6e 79 20 66 69 6c 65 73 20 61 72 65 20 6f 70     any files are op
+  8060d0:	65 6e 00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b     en.file or block
+  8060e0:	20 6e 6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c      not found.inval
+  8060f0:	69 64 20 70 61 74 68 00 66 69 6c 65 20 61 6c 72     id path.file alr
+  806100:	65 61 64 79 20 65 78 69 73 74 73 00 6f 70 65 72     eady exists.oper
+  806110:	61 74 69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72     ation not suppor
+  806120:	74 65 64 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ted.f.........f.
+  806130:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
+  806140:	cf 1b 80 00 00 00 00 00 26 22 80 00 00 00 00 00     ........&"......
+  806150:	16 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     ."......&"......
+  806160:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806170:	26 22 80 00 00 00 00 00 ee 1b 80 00 00 00 00 00     &"..............
+  806180:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806190:	e2 1b 80 00 00 00 00 00 5c 1c 80 00 00 00 00 00     ........\.......
+  8061a0:	26 22 80 00 00 00 00 00 e2 1b 80 00 00 00 00 00     &"..............
+  8061b0:	28 1c 80 00 00 00 00 00 28 1c 80 00 00 00 00 00     (.......(.......
+  8061c0:	28 1c 80 00 00 00 00 00 28 1c 80 00 00 00 00 00     (.......(.......
+  8061d0:	28 1c 80 00 00 00 00 00 28 1c 80 00 00 00 00 00     (.......(.......
+  8061e0:	28 1c 80 00 00 00 00 00 28 1c 80 00 00 00 00 00     (.......(.......
+  8061f0:	28 1c 80 00 00 00 00 00 26 22 80 00 00 00 00 00     (.......&"......
+  806200:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806210:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806220:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806230:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806240:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806250:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806260:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806270:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806280:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806290:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8062a0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8062b0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8062c0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8062d0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8062e0:	26 22 80 00 00 00 00 00 44 21 80 00 00 00 00 00     &"......D!......
+  8062f0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806300:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806310:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806320:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806330:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806340:	8a 1c 80 00 00 00 00 00 59 1e 80 00 00 00 00 00     ........Y.......
+  806350:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  806360:	26 22 80 00 00 00 00 00 7f 1c 80 00 00 00 00 00     &"..............
+  806370:	b9 1c 80 00 00 00 00 00 26 22 80 00 00 00 00 00     ........&"......
+  806380:	26 22 80 00 00 00 00 00 74 1c 80 00 00 00 00 00     &"......t.......
+  806390:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8063a0:	02 20 80 00 00 00 00 00 d1 20 80 00 00 00 00 00     . ....... ......
+  8063b0:	26 22 80 00 00 00 00 00 26 22 80 00 00 00 00 00     &"......&"......
+  8063c0:	50 1d 80 00 00 00 00 00 26 22 80 00 00 00 00 00     P.......&"......
+  8063d0:	2d 1f 80 00 00 00 00 00 26 22 80 00 00 00 00 00     -.......&"......
+  8063e0:	26 22 80 00 00 00 00 00 44 21 80 00 00 00 00 00     &"......D!......
+  8063f0:	26 22 80 00 00 00 00 00 d8 1b 80 00 00 00 00 00     &"..............
+
+0000000000806400 <error_string>:
+	...
+  806408:	c7 5f 80 00 00 00 00 00 d9 5f 80 00 00 00 00 00     ._......._......
+  806418:	e9 5f 80 00 00 00 00 00 fb 5f 80 00 00 00 00 00     ._......._......
+  806428:	09 60 80 00 00 00 00 00 1d 60 80 00 00 00 00 00     .`.......`......
+  806438:	32 60 80 00 00 00 00 00 45 60 80 00 00 00 00 00     2`......E`......
+  806448:	57 60 80 00 00 00 00 00 6b 60 80 00 00 00 00 00     W`......k`......
+  806458:	7b 60 80 00 00 00 00 00 8e 60 80 00 00 00 00 00     {`.......`......
+  806468:	a5 60 80 00 00 00 00 00 bb 60 80 00 00 00 00 00     .`.......`......
+  806478:	d3 60 80 00 00 00 00 00 eb 60 80 00 00 00 00 00     .`.......`......
+  806488:	f8 60 80 00 00 00 00 00 a0 64 80 00 00 00 00 00     .`.......d......
+  806498:	0c 61 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .a......file is 
+  8064a8:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  8064b8:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  8064c8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8064d8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8064e8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8064f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  806508:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  806518:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  806528:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806538:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806548:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806558:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806568:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806578:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806580 <devtab>:
+  806580:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806590:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  8065a0:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  8065b0:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  8065c0:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  8065d0:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  8065e0:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  8065f0:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  806600:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  806610:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  806620:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  806630:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806640:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  806650:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806660:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806670:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806680:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806690:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  8066a0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8066b0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8066c0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8066d0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8066e0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8066f0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806700:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806710:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  806720:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  806730:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806740:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806750:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806760:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806770:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806780:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806790:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806800:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806810:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806820:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806830:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806840:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806850:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806860:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806870:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806880:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806890:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806900:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806910:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806920:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806930:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806940:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806950:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806960:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806970:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806980:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806990:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806aa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ab0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ac0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ad0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ae0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806af0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ba0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806bc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806be0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bf0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ca0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806cc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ce0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cf0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806da0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806db0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806dc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806dd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806de0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806df0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ea0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806eb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ec0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ed0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ee0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ef0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fa0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fe0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ff0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
@@ -0,0 +1,10363 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <libc_abs>:
+libc_FILE *libc_stderr = &one;
+libc_FILE *libc_stdout = &one;
+
+
+int libc_abs(int x) {
+    return (x >= 0) ? x : -x;
+  800000:	89 f8                	mov    %edi,%eax
+  800002:	f7 d8                	neg    %eax
+  800004:	0f 48 c7             	cmovs  %edi,%eax
+}
+  800007:	c3                   	ret
+
+0000000000800008 <libc_atoi>:
+    int rc = 0;
+
+    char sign = '+';
+
+    /* TODO: In other than "C" locale, additional patterns may be defined     */
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800008:	0f b6 07             	movzbl (%rdi),%eax
+  80000b:	3c 20                	cmp    $0x20,%al
+  80000d:	77 28                	ja     800037 <libc_atoi+0x2f>
+  80000f:	48 ba 00 2e 00 00 01 	movabs $0x100002e00,%rdx
+  800016:	00 00 00 
+  800019:	48 0f a3 c2          	bt     %rax,%rdx
+  80001d:	72 0d                	jb     80002c <libc_atoi+0x24>
+    char sign = '+';
+  80001f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+  800024:	eb 1e                	jmp    800044 <libc_atoi+0x3c>
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800026:	48 0f a3 c2          	bt     %rax,%rdx
+  80002a:	73 0b                	jae    800037 <libc_atoi+0x2f>
+    {
+        ++s;
+  80002c:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s == ' ' || *s == '\t' || *s == '\n' || *s == '\v' || *s == '\r' )
+  800030:	0f b6 07             	movzbl (%rdi),%eax
+  800033:	3c 20                	cmp    $0x20,%al
+  800035:	76 ef                	jbe    800026 <libc_atoi+0x1e>
+    }
+
+    if ( *s == '+' )
+  800037:	3c 2b                	cmp    $0x2b,%al
+  800039:	74 40                	je     80007b <libc_atoi+0x73>
+    {
+        ++s;
+    }
+    else if ( *s == '-' )
+  80003b:	3c 2d                	cmp    $0x2d,%al
+  80003d:	74 42                	je     800081 <libc_atoi+0x79>
+    char sign = '+';
+  80003f:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    {
+        sign = *( s++ );
+    }
+
+    /* TODO: Earlier version was missing tolower() but was not caught by tests */
+    while ( *s >= '0' && *s <= '9' )
+  800044:	0f b6 17             	movzbl (%rdi),%edx
+  800047:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80004a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80004f:	40 80 fe 09          	cmp    $0x9,%sil
+  800053:	77 1a                	ja     80006f <libc_atoi+0x67>
+    {
+        rc = rc * 10 + (*s - '0');
+  800055:	8d 0c 89             	lea    (%rcx,%rcx,4),%ecx
+  800058:	0f be d2             	movsbl %dl,%edx
+  80005b:	8d 4c 4a d0          	lea    -0x30(%rdx,%rcx,2),%ecx
+        s++;
+  80005f:	48 83 c7 01          	add    $0x1,%rdi
+    while ( *s >= '0' && *s <= '9' )
+  800063:	0f b6 17             	movzbl (%rdi),%edx
+  800066:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  800069:	40 80 fe 09          	cmp    $0x9,%sil
+  80006d:	76 e6                	jbe    800055 <libc_atoi+0x4d>
+    }
+
+    return ( sign == '+' ) ? rc : -rc;
+  80006f:	89 ca                	mov    %ecx,%edx
+  800071:	f7 da                	neg    %edx
+  800073:	3c 2b                	cmp    $0x2b,%al
+  800075:	0f 45 ca             	cmovne %edx,%ecx
+}
+  800078:	89 c8                	mov    %ecx,%eax
+  80007a:	c3                   	ret
+        ++s;
+  80007b:	48 83 c7 01          	add    $0x1,%rdi
+  80007f:	eb c3                	jmp    800044 <libc_atoi+0x3c>
+        sign = *( s++ );
+  800081:	48 83 c7 01          	add    $0x1,%rdi
+  800085:	eb bd                	jmp    800044 <libc_atoi+0x3c>
+
+0000000000800087 <libc_toupper>:
+
+
+int libc_toupper(int ch) {
+  800087:	89 f8                	mov    %edi,%eax
+    if (ch >= 'a' && ch <= 'z') return ch + 'A' - 'a';
+  800089:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+  80008c:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  80008f:	83 f9 1a             	cmp    $0x1a,%ecx
+  800092:	0f 42 c2             	cmovb  %edx,%eax
+    else return ch;
+}
+  800095:	c3                   	ret
+
+0000000000800096 <test_alloc>:
+
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
+  800096:	48 8d 77 1f          	lea    0x1f(%rdi),%rsi
+  80009a:	48 c1 ee 05          	shr    $0x5,%rsi
+  80009e:	48 83 c6 01          	add    $0x1,%rsi
+
+    /* no free list yet */
+    if (!freep) {
+  8000a2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8000a9:	00 00 00 
+  8000ac:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8000b0:	74 36                	je     8000e8 <test_alloc+0x52>
+
+    // cprintf("frep %p\n", freep);
+
+    // check_list();
+
+    for (Header *p = freep->next;; p = p->next) {
+  8000b2:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  8000b9:	00 00 00 
+  8000bc:	48 8b 10             	mov    (%rax),%rdx
+        /* big enough */
+        if (p->size >= nunits) {
+  8000bf:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000c3:	48 39 f1             	cmp    %rsi,%rcx
+  8000c6:	73 4f                	jae    800117 <test_alloc+0x81>
+            // unlock_kernel();
+            return (void *)(p + 1);
+        }
+
+        /* wrapped around free list */
+        if (p == freep) {
+  8000c8:	48 39 d0             	cmp    %rdx,%rax
+  8000cb:	0f 84 83 00 00 00    	je     800154 <test_alloc+0xbe>
+    for (Header *p = freep->next;; p = p->next) {
+  8000d1:	48 8b 12             	mov    (%rdx),%rdx
+        if (p->size >= nunits) {
+  8000d4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8000d8:	48 39 f1             	cmp    %rsi,%rcx
+  8000db:	73 3a                	jae    800117 <test_alloc+0x81>
+        if (p == freep) {
+  8000dd:	48 39 d0             	cmp    %rdx,%rax
+  8000e0:	75 ef                	jne    8000d1 <test_alloc+0x3b>
+            break;
+        }
+    }
+
+    // unlock_kernel();
+    return NULL;
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8000e7:	c3                   	ret
+        hd->next = (Header *)&base;
+  8000e8:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8000ef:	00 00 00 
+  8000f2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8000f9:	00 00 00 
+  8000fc:	48 89 02             	mov    %rax,(%rdx)
+        hd->prev = (Header *)&base;
+  8000ff:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        hd->size = (SPACE_SIZE - sizeof(Header)) / sizeof(Header);
+  800103:	48 c7 42 10 ff ff 07 	movq   $0x7ffff,0x10(%rdx)
+  80010a:	00 
+        freep = &base;
+  80010b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800112:	00 00 00 
+  800115:	eb 9b                	jmp    8000b2 <test_alloc+0x1c>
+            freep = p->prev;
+  800117:	48 8b 42 08          	mov    0x8(%rdx),%rax
+  80011b:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  800122:	00 00 00 
+            if (p->size == nunits) {
+  800125:	48 39 ce             	cmp    %rcx,%rsi
+  800128:	74 17                	je     800141 <test_alloc+0xab>
+                p->size -= nunits;
+  80012a:	48 29 f1             	sub    %rsi,%rcx
+  80012d:	48 89 4a 10          	mov    %rcx,0x10(%rdx)
+                p += p->size;
+  800131:	48 c1 e1 05          	shl    $0x5,%rcx
+  800135:	48 01 ca             	add    %rcx,%rdx
+                p->size = nunits;
+  800138:	48 89 72 10          	mov    %rsi,0x10(%rdx)
+            return (void *)(p + 1);
+  80013c:	48 8d 42 20          	lea    0x20(%rdx),%rax
+  800140:	c3                   	ret
+                p->prev->next = p->next;
+  800141:	48 8b 0a             	mov    (%rdx),%rcx
+  800144:	48 89 08             	mov    %rcx,(%rax)
+                p->next->prev = p->prev;
+  800147:	48 8b 02             	mov    (%rdx),%rax
+  80014a:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  80014e:	48 89 48 08          	mov    %rcx,0x8(%rax)
+  800152:	eb e8                	jmp    80013c <test_alloc+0xa6>
+    return NULL;
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	c3                   	ret
+
+000000000080015a <test_free>:
+
+/* free: put block ap in free list */
+void
+test_free(void *ap) {
+  80015a:	48 89 fe             	mov    %rdi,%rsi
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80015d:	48 8d 4f e0          	lea    -0x20(%rdi),%rcx
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  800161:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800168:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80016b:	eb 10                	jmp    80017d <test_free+0x23>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80016d:	48 8b 10             	mov    (%rax),%rdx
+  800170:	48 39 d0             	cmp    %rdx,%rax
+  800173:	72 05                	jb     80017a <test_free+0x20>
+  800175:	48 39 d1             	cmp    %rdx,%rcx
+  800178:	72 15                	jb     80018f <test_free+0x35>
+test_free(void *ap) {
+  80017a:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80017d:	48 39 c8             	cmp    %rcx,%rax
+  800180:	73 eb                	jae    80016d <test_free+0x13>
+  800182:	48 8b 10             	mov    (%rax),%rdx
+  800185:	48 39 d1             	cmp    %rdx,%rcx
+  800188:	72 05                	jb     80018f <test_free+0x35>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80018a:	48 39 d0             	cmp    %rdx,%rax
+  80018d:	72 eb                	jb     80017a <test_free+0x20>
+
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  80018f:	48 8b 7e f0          	mov    -0x10(%rsi),%rdi
+  800193:	4c 8b 00             	mov    (%rax),%r8
+  800196:	48 89 fa             	mov    %rdi,%rdx
+  800199:	48 c1 e2 05          	shl    $0x5,%rdx
+  80019d:	48 01 ca             	add    %rcx,%rdx
+  8001a0:	49 39 d0             	cmp    %rdx,%r8
+  8001a3:	74 30                	je     8001d5 <test_free+0x7b>
+        bp->size += p->next->size;
+        bp->next = p->next->next;
+        bp->prev = p->next->prev;
+        p->next->next->prev = bp;
+        p->next = bp;
+    } else if (p + p->size == bp) /* join to lower nbr */ {
+  8001a5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001a9:	4c 89 ca             	mov    %r9,%rdx
+  8001ac:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001b0:	48 01 c2             	add    %rax,%rdx
+  8001b3:	48 39 d1             	cmp    %rdx,%rcx
+  8001b6:	74 79                	je     800231 <test_free+0xd7>
+        p->size += bp->size;
+    } else {
+        bp->next = p->next;
+  8001b8:	4c 89 46 e0          	mov    %r8,-0x20(%rsi)
+        bp->prev = p;
+  8001bc:	48 89 46 e8          	mov    %rax,-0x18(%rsi)
+        p->next->prev = bp;
+  8001c0:	48 8b 10             	mov    (%rax),%rdx
+  8001c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  8001c7:	48 89 08             	mov    %rcx,(%rax)
+    }
+    freep = p;
+  8001ca:	48 a3 00 80 80 00 00 	movabs %rax,0x808000
+  8001d1:	00 00 00 
+
+    // check_list();
+
+    // unlock_kernel();
+
+}
+  8001d4:	c3                   	ret
+    if (bp + bp->size == p->next && p + p->size == bp) /* join to both */ {
+  8001d5:	4c 8b 48 10          	mov    0x10(%rax),%r9
+  8001d9:	4c 89 ca             	mov    %r9,%rdx
+  8001dc:	48 c1 e2 05          	shl    $0x5,%rdx
+  8001e0:	48 01 c2             	add    %rax,%rdx
+  8001e3:	48 39 d1             	cmp    %rdx,%rcx
+  8001e6:	74 2c                	je     800214 <test_free+0xba>
+        bp->size += p->next->size;
+  8001e8:	49 03 78 10          	add    0x10(%r8),%rdi
+  8001ec:	48 89 7e f0          	mov    %rdi,-0x10(%rsi)
+        bp->next = p->next->next;
+  8001f0:	48 8b 10             	mov    (%rax),%rdx
+  8001f3:	48 8b 12             	mov    (%rdx),%rdx
+  8001f6:	48 89 56 e0          	mov    %rdx,-0x20(%rsi)
+        bp->prev = p->next->prev;
+  8001fa:	48 8b 10             	mov    (%rax),%rdx
+  8001fd:	48 8b 52 08          	mov    0x8(%rdx),%rdx
+  800201:	48 89 56 e8          	mov    %rdx,-0x18(%rsi)
+        p->next->next->prev = bp;
+  800205:	48 8b 10             	mov    (%rax),%rdx
+  800208:	48 8b 12             	mov    (%rdx),%rdx
+  80020b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+        p->next = bp;
+  80020f:	48 89 08             	mov    %rcx,(%rax)
+  800212:	eb b6                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size + p->next->size;
+  800214:	4c 01 cf             	add    %r9,%rdi
+  800217:	49 03 78 10          	add    0x10(%r8),%rdi
+  80021b:	48 89 78 10          	mov    %rdi,0x10(%rax)
+        p->next->next->prev = p;
+  80021f:	49 8b 10             	mov    (%r8),%rdx
+  800222:	48 89 42 08          	mov    %rax,0x8(%rdx)
+        p->next = p->next->next;
+  800226:	48 8b 10             	mov    (%rax),%rdx
+  800229:	48 8b 12             	mov    (%rdx),%rdx
+  80022c:	48 89 10             	mov    %rdx,(%rax)
+  80022f:	eb 99                	jmp    8001ca <test_free+0x70>
+        p->size += bp->size;
+  800231:	4c 01 cf             	add    %r9,%rdi
+  800234:	48 89 78 10          	mov    %rdi,0x10(%rax)
+  800238:	eb 90                	jmp    8001ca <test_free+0x70>
+
+000000000080023a <get_header>:
+
+Header*
+get_header(void *ap) {
+
+    /* point to block header */
+    Header *bp = (Header *)ap - 1;
+  80023a:	48 83 ef 20          	sub    $0x20,%rdi
+    /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
+    // LAB 5: Your code here DONE?
+    // lock_kernel();
+
+    /* freed block at start or end of arena */
+    Header *p = freep;
+  80023e:	48 a1 00 80 80 00 00 	movabs 0x808000,%rax
+  800245:	00 00 00 
+    for (; !(bp > p && bp < p->next); p = p->next)
+  800248:	eb 10                	jmp    80025a <get_header+0x20>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  80024a:	48 8b 10             	mov    (%rax),%rdx
+  80024d:	48 39 d0             	cmp    %rdx,%rax
+  800250:	72 05                	jb     800257 <get_header+0x1d>
+  800252:	48 39 d7             	cmp    %rdx,%rdi
+  800255:	72 15                	jb     80026c <get_header+0x32>
+get_header(void *ap) {
+  800257:	48 89 d0             	mov    %rdx,%rax
+    for (; !(bp > p && bp < p->next); p = p->next)
+  80025a:	48 39 f8             	cmp    %rdi,%rax
+  80025d:	73 eb                	jae    80024a <get_header+0x10>
+  80025f:	48 8b 10             	mov    (%rax),%rdx
+  800262:	48 39 d7             	cmp    %rdx,%rdi
+  800265:	72 05                	jb     80026c <get_header+0x32>
+        if (p >= p->next && (bp > p || bp < p->next)) break;
+  800267:	48 39 d0             	cmp    %rdx,%rax
+  80026a:	72 eb                	jb     800257 <get_header+0x1d>
+
+    return bp;
+}
+  80026c:	48 89 f8             	mov    %rdi,%rax
+  80026f:	c3                   	ret
+
+0000000000800270 <libc_free>:
+
+// ================================================================================================
+
+void libc_free(void *ptr) {
+	if (ptr == NULL) return;
+  800270:	48 85 ff             	test   %rdi,%rdi
+  800273:	74 12                	je     800287 <libc_free+0x17>
+void libc_free(void *ptr) {
+  800275:	55                   	push   %rbp
+  800276:	48 89 e5             	mov    %rsp,%rbp
+
+    test_free(ptr);
+  800279:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+}
+  800285:	5d                   	pop    %rbp
+  800286:	c3                   	ret
+  800287:	c3                   	ret
+
+0000000000800288 <libc_malloc>:
+
+void *libc_malloc(int cnt) {
+  800288:	55                   	push   %rbp
+  800289:	48 89 e5             	mov    %rsp,%rbp
+    return test_alloc((size_t) cnt);
+  80028c:	48 63 ff             	movslq %edi,%rdi
+  80028f:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800296:	00 00 00 
+  800299:	ff d0                	call   *%rax
+}
+  80029b:	5d                   	pop    %rbp
+  80029c:	c3                   	ret
+
+000000000080029d <libc_realloc>:
+
+void *libc_realloc(void *ptr, size_t newsize) {
+  80029d:	55                   	push   %rbp
+  80029e:	48 89 e5             	mov    %rsp,%rbp
+  8002a1:	41 54                	push   %r12
+  8002a3:	53                   	push   %rbx
+  8002a4:	49 89 fc             	mov    %rdi,%r12
+    return test_alloc((size_t) cnt);
+  8002a7:	48 63 fe             	movslq %esi,%rdi
+  8002aa:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  8002b1:	00 00 00 
+  8002b4:	ff d0                	call   *%rax
+  8002b6:	48 89 c3             	mov    %rax,%rbx
+    void *new_ptr = libc_malloc(newsize);
+    if (!new_ptr || !ptr) {
+  8002b9:	48 85 c0             	test   %rax,%rax
+  8002bc:	74 39                	je     8002f7 <libc_realloc+0x5a>
+  8002be:	4d 85 e4             	test   %r12,%r12
+  8002c1:	74 34                	je     8002f7 <libc_realloc+0x5a>
+        return new_ptr;
+    }
+
+    Header *header = get_header(ptr);
+  8002c3:	4c 89 e7             	mov    %r12,%rdi
+  8002c6:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8002cd:	00 00 00 
+  8002d0:	ff d0                	call   *%rax
+
+    memcpy(new_ptr, ptr, header->size);
+  8002d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8002d6:	4c 89 e6             	mov    %r12,%rsi
+  8002d9:	48 89 df             	mov    %rbx,%rdi
+  8002dc:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    libc_free(ptr);
+  8002e8:	4c 89 e7             	mov    %r12,%rdi
+  8002eb:	48 b8 70 02 80 00 00 	movabs $0x800270,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+    
+    return new_ptr;
+}
+  8002f7:	48 89 d8             	mov    %rbx,%rax
+  8002fa:	5b                   	pop    %rbx
+  8002fb:	41 5c                	pop    %r12
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+
+00000000008002ff <libc_calloc>:
+
+void *libc_calloc(size_t num, size_t size) {
+  8002ff:	55                   	push   %rbp
+  800300:	48 89 e5             	mov    %rsp,%rbp
+  800303:	41 55                	push   %r13
+  800305:	41 54                	push   %r12
+  800307:	53                   	push   %rbx
+  800308:	48 83 ec 08          	sub    $0x8,%rsp
+  80030c:	48 89 fb             	mov    %rdi,%rbx
+  80030f:	49 89 f5             	mov    %rsi,%r13
+    void *ptr = libc_malloc(num * size);
+  800312:	0f af fe             	imul   %esi,%edi
+    return test_alloc((size_t) cnt);
+  800315:	48 63 ff             	movslq %edi,%rdi
+  800318:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80031f:	00 00 00 
+  800322:	ff d0                	call   *%rax
+  800324:	49 89 c4             	mov    %rax,%r12
+    memset(ptr, 0, num * size);
+  800327:	48 89 da             	mov    %rbx,%rdx
+  80032a:	49 0f af d5          	imul   %r13,%rdx
+  80032e:	be 00 00 00 00       	mov    $0x0,%esi
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+    
+    return ptr;
+}
+  800342:	4c 89 e0             	mov    %r12,%rax
+  800345:	48 83 c4 08          	add    $0x8,%rsp
+  800349:	5b                   	pop    %rbx
+  80034a:	41 5c                	pop    %r12
+  80034c:	41 5d                	pop    %r13
+  80034e:	5d                   	pop    %rbp
+  80034f:	c3                   	ret
+
+0000000000800350 <libc_strdup>:
+
+
+char *libc_strdup(const char *str) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 55                	push   %r13
+  800356:	41 54                	push   %r12
+  800358:	53                   	push   %rbx
+  800359:	48 83 ec 08          	sub    $0x8,%rsp
+  80035d:	49 89 fd             	mov    %rdi,%r13
+    size_t length = strlen(str);
+  800360:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  800367:	00 00 00 
+  80036a:	ff d0                	call   *%rax
+  80036c:	48 89 c3             	mov    %rax,%rbx
+    char* new_str = (char*)libc_malloc(length + 1);
+  80036f:	8d 78 01             	lea    0x1(%rax),%edi
+    return test_alloc((size_t) cnt);
+  800372:	48 63 ff             	movslq %edi,%rdi
+  800375:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+  800381:	49 89 c4             	mov    %rax,%r12
+    memcpy(new_str, str, length + 1);
+  800384:	48 8d 53 01          	lea    0x1(%rbx),%rdx
+  800388:	4c 89 ee             	mov    %r13,%rsi
+  80038b:	48 89 c7             	mov    %rax,%rdi
+  80038e:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+    return new_str;
+}
+  80039a:	4c 89 e0             	mov    %r12,%rax
+  80039d:	48 83 c4 08          	add    $0x8,%rsp
+  8003a1:	5b                   	pop    %rbx
+  8003a2:	41 5c                	pop    %r12
+  8003a4:	41 5d                	pop    %r13
+  8003a6:	5d                   	pop    %rbp
+  8003a7:	c3                   	ret
+
+00000000008003a8 <libc_strchr>:
+
+char *libc_strchr(const char *str, int ch) {
+  8003a8:	48 89 f8             	mov    %rdi,%rax
+    do {
+        if(*str == ch) return (char*)str;
+  8003ab:	0f be 10             	movsbl (%rax),%edx
+  8003ae:	39 f2                	cmp    %esi,%edx
+  8003b0:	74 0e                	je     8003c0 <libc_strchr+0x18>
+    } while(*(++str) != '\0');
+  8003b2:	48 83 c0 01          	add    $0x1,%rax
+  8003b6:	80 38 00             	cmpb   $0x0,(%rax)
+  8003b9:	75 f0                	jne    8003ab <libc_strchr+0x3>
+
+    return NULL;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003c0:	c3                   	ret
+
+00000000008003c1 <libc_strrchr>:
+
+char *libc_strrchr(const char *str, int ch) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+  8003c5:	41 55                	push   %r13
+  8003c7:	41 54                	push   %r12
+  8003c9:	53                   	push   %rbx
+  8003ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ce:	89 f3                	mov    %esi,%ebx
+
+    if (ch == '\0') {
+        return strchr(str, '\0');
+    }
+
+    found = NULL;
+  8003d0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  8003d6:	49 bd a8 03 80 00 00 	movabs $0x8003a8,%r13
+  8003dd:	00 00 00 
+    if (ch == '\0') {
+  8003e0:	85 f6                	test   %esi,%esi
+  8003e2:	75 1d                	jne    800401 <libc_strrchr+0x40>
+        return strchr(str, '\0');
+  8003e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8003e9:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  8003f0:	00 00 00 
+  8003f3:	ff d0                	call   *%rax
+  8003f5:	49 89 c4             	mov    %rax,%r12
+  8003f8:	eb 11                	jmp    80040b <libc_strrchr+0x4a>
+        found = ptr;
+        str = ptr + 1;
+  8003fa:	48 8d 78 01          	lea    0x1(%rax),%rdi
+        found = ptr;
+  8003fe:	49 89 c4             	mov    %rax,%r12
+    while ((ptr = libc_strchr(str, ch)) != NULL) {
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	41 ff d5             	call   *%r13
+  800406:	48 85 c0             	test   %rax,%rax
+  800409:	75 ef                	jne    8003fa <libc_strrchr+0x39>
+    }
+
+    return (char *) found;
+}
+  80040b:	4c 89 e0             	mov    %r12,%rax
+  80040e:	48 83 c4 08          	add    $0x8,%rsp
+  800412:	5b                   	pop    %rbx
+  800413:	41 5c                	pop    %r12
+  800415:	41 5d                	pop    %r13
+  800417:	5d                   	pop    %rbp
+  800418:	c3                   	ret
+
+0000000000800419 <libc_strstr>:
+
+char *libc_strstr(const char *str1, const char *str2) {
+    const char *a, *b;
+
+    b = str2;
+    if (*b == 0) return (char*)str1;
+  800419:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80041d:	48 89 f8             	mov    %rdi,%rax
+  800420:	45 84 c0             	test   %r8b,%r8b
+  800423:	74 41                	je     800466 <libc_strstr+0x4d>
+
+    for ( ; *str1 != 0; str1++) {
+  800425:	0f b6 07             	movzbl (%rdi),%eax
+  800428:	84 c0                	test   %al,%al
+  80042a:	75 11                	jne    80043d <libc_strstr+0x24>
+            if (*b == 0) return (char*)str1;
+            if (*a++ != *b++) break;
+        }
+        b = str2;
+    }
+    return NULL;
+  80042c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800431:	c3                   	ret
+    for ( ; *str1 != 0; str1++) {
+  800432:	48 83 c7 01          	add    $0x1,%rdi
+  800436:	0f b6 07             	movzbl (%rdi),%eax
+  800439:	84 c0                	test   %al,%al
+  80043b:	74 20                	je     80045d <libc_strstr+0x44>
+        if (*str1 != *b) continue;
+  80043d:	41 38 c0             	cmp    %al,%r8b
+  800440:	75 f0                	jne    800432 <libc_strstr+0x19>
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (*b == 0) return (char*)str1;
+  800447:	0f b6 14 06          	movzbl (%rsi,%rax,1),%edx
+  80044b:	84 d2                	test   %dl,%dl
+  80044d:	74 14                	je     800463 <libc_strstr+0x4a>
+            if (*a++ != *b++) break;
+  80044f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800453:	48 83 c0 01          	add    $0x1,%rax
+  800457:	38 ca                	cmp    %cl,%dl
+  800459:	74 ec                	je     800447 <libc_strstr+0x2e>
+  80045b:	eb d5                	jmp    800432 <libc_strstr+0x19>
+    return NULL;
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	c3                   	ret
+  800463:	48 89 f8             	mov    %rdi,%rax
+}
+  800466:	c3                   	ret
+
+0000000000800467 <libc_putchar>:
+
+int libc_putchar(char c) {
+  800467:	55                   	push   %rbp
+  800468:	48 89 e5             	mov    %rsp,%rbp
+  80046b:	48 83 ec 10          	sub    $0x10,%rsp
+  80046f:	40 88 7d fc          	mov    %dil,-0x4(%rbp)
+    if(write(1, &c, 1) == 1) return c;
+  800473:	ba 01 00 00 00       	mov    $0x1,%edx
+  800478:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  80047c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800481:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+  80048d:	48 83 f8 01          	cmp    $0x1,%rax
+  800491:	75 06                	jne    800499 <libc_putchar+0x32>
+  800493:	0f be 45 fc          	movsbl -0x4(%rbp),%eax
+    return -1;
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+    return -1;
+  800499:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80049e:	eb f7                	jmp    800497 <libc_putchar+0x30>
+
+00000000008004a0 <libc_puts>:
+
+int libc_puts(const char *s) {
+  8004a0:	55                   	push   %rbp
+  8004a1:	48 89 e5             	mov    %rsp,%rbp
+  8004a4:	53                   	push   %rbx
+  8004a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8004a9:	48 89 fb             	mov    %rdi,%rbx
+    if(write(1, s, strlen(s)) > 0) return '\n';
+  8004ac:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	48 89 c2             	mov    %rax,%rdx
+  8004bb:	48 89 de             	mov    %rbx,%rsi
+  8004be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004c3:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  8004ca:	00 00 00 
+  8004cd:	ff d0                	call   *%rax
+    return -1;
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8004d7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8004dc:	0f 4e c2             	cmovle %edx,%eax
+}
+  8004df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004e3:	c9                   	leave
+  8004e4:	c3                   	ret
+
+00000000008004e5 <libc_printf>:
+
+int libc_printf(const char *format, ...) {
+  8004e5:	55                   	push   %rbp
+  8004e6:	48 89 e5             	mov    %rsp,%rbp
+  8004e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ed:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004f1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004f5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004fd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800501:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800510:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800514:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int result = vcprintf(format, ap);
+  800518:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80051c:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  800523:	00 00 00 
+  800526:	ff d0                	call   *%rax
+    va_end(ap);
+    return result;
+}
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <libc_fprintf>:
+
+int libc_fprintf(libc_FILE *fp, const char *format, ...) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800536:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80053a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80053e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800542:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  800549:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80054d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800551:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800555:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*fp, format, ap);
+  800559:	8b 3f                	mov    (%rdi),%edi
+  80055b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80055f:	48 b8 ae 3c 80 00 00 	movabs $0x803cae,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  80056b:	c9                   	leave
+  80056c:	c3                   	ret
+
+000000000080056d <libc_snprintf>:
+
+int libc_snprintf(char * s, size_t n, const char * format, ...) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+  800571:	48 83 ec 50          	sub    $0x50,%rsp
+  800575:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800579:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80057d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, format);
+  800581:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800588:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80058c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800590:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800594:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, ap);
+  800598:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80059c:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  8005a3:	00 00 00 
+  8005a6:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+    va_end(ap);
+    return result;
+}
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+
+00000000008005aa <libc_vfprintf>:
+
+int libc_vfprintf(libc_FILE *stream, const char *format, va_list arg_ptr) {
+  8005aa:	55                   	push   %rbp
+  8005ab:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vfprintf(*((int*)stream), format, arg_ptr);
+  8005ae:	8b 3f                	mov    (%rdi),%edi
+  8005b0:	48 b8 ae 3c 80 00 00 	movabs $0x803cae,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005bc:	5d                   	pop    %rbp
+  8005bd:	c3                   	ret
+
+00000000008005be <libc_vsnprintf>:
+
+int libc_vsnprintf(char * s, size_t n, const char *format, va_list arg) {
+  8005be:	55                   	push   %rbp
+  8005bf:	48 89 e5             	mov    %rsp,%rbp
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    int result = vsnprintf(s, n, format, arg);
+  8005c2:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  8005c9:	00 00 00 
+  8005cc:	ff d0                	call   *%rax
+#pragma GCC diagnostic pop
+
+    return result;
+}
+  8005ce:	5d                   	pop    %rbp
+  8005cf:	c3                   	ret
+
+00000000008005d0 <libc_exit>:
+
+void libc_exit() {
+  8005d0:	55                   	push   %rbp
+  8005d1:	48 89 e5             	mov    %rsp,%rbp
+    exit();
+  8005d4:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+}
+  8005e0:	5d                   	pop    %rbp
+  8005e1:	c3                   	ret
+
+00000000008005e2 <libc_fopen>:
+
+libc_FILE *libc_fopen(const char *filename, const char *mode) {
+  8005e2:	55                   	push   %rbp
+  8005e3:	48 89 e5             	mov    %rsp,%rbp
+  8005e6:	41 54                	push   %r12
+  8005e8:	53                   	push   %rbx
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	48 89 f3             	mov    %rsi,%rbx
+    int r = -1;
+
+    if(strcmp(mode, "r") == 0) r = open(filename, O_RDONLY);
+  8005ef:	48 be a5 5d 80 00 00 	movabs $0x805da5,%rsi
+  8005f6:	00 00 00 
+  8005f9:	48 89 df             	mov    %rbx,%rdi
+  8005fc:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  800603:	00 00 00 
+  800606:	ff d0                	call   *%rax
+  800608:	85 c0                	test   %eax,%eax
+  80060a:	75 37                	jne    800643 <libc_fopen+0x61>
+  80060c:	be 00 00 00 00       	mov    $0x0,%esi
+  800611:	4c 89 e7             	mov    %r12,%rdi
+  800614:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  80061b:	00 00 00 
+  80061e:	ff d0                	call   *%rax
+  800620:	89 c3                	mov    %eax,%ebx
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+
+    if(r < 0) return NULL;
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	85 db                	test   %ebx,%ebx
+  800629:	78 13                	js     80063e <libc_fopen+0x5c>
+    return test_alloc((size_t) cnt);
+  80062b:	bf 04 00 00 00       	mov    $0x4,%edi
+  800630:	48 b8 96 00 80 00 00 	movabs $0x800096,%rax
+  800637:	00 00 00 
+  80063a:	ff d0                	call   *%rax
+
+    libc_FILE* buffer = (libc_FILE*)libc_malloc(sizeof(libc_FILE));
+    *((int*)buffer) = r;
+  80063c:	89 18                	mov    %ebx,(%rax)
+    return buffer;
+}
+  80063e:	5b                   	pop    %rbx
+  80063f:	41 5c                	pop    %r12
+  800641:	5d                   	pop    %rbp
+  800642:	c3                   	ret
+    else if(strcmp(mode, "w") == 0) r = open(filename, O_WRONLY);
+  800643:	48 be 68 57 80 00 00 	movabs $0x805768,%rsi
+  80064a:	00 00 00 
+  80064d:	48 89 df             	mov    %rbx,%rdi
+  800650:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	75 18                	jne    800678 <libc_fopen+0x96>
+  800660:	be 01 00 00 00       	mov    $0x1,%esi
+  800665:	4c 89 e7             	mov    %r12,%rdi
+  800668:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	89 c3                	mov    %eax,%ebx
+  800676:	eb aa                	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "rb") == 0) r = open(filename, O_RDONLY);
+  800678:	48 be 6a 57 80 00 00 	movabs $0x80576a,%rsi
+  80067f:	00 00 00 
+  800682:	48 89 df             	mov    %rbx,%rdi
+  800685:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	75 1b                	jne    8006b0 <libc_fopen+0xce>
+  800695:	be 00 00 00 00       	mov    $0x0,%esi
+  80069a:	4c 89 e7             	mov    %r12,%rdi
+  80069d:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  8006a4:	00 00 00 
+  8006a7:	ff d0                	call   *%rax
+  8006a9:	89 c3                	mov    %eax,%ebx
+  8006ab:	e9 72 ff ff ff       	jmp    800622 <libc_fopen+0x40>
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006b0:	48 be 6d 57 80 00 00 	movabs $0x80576d,%rsi
+  8006b7:	00 00 00 
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 37 21 80 00 00 	movabs $0x802137,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+  8006c9:	89 c2                	mov    %eax,%edx
+    if(r < 0) return NULL;
+  8006cb:	b8 00 00 00 00       	mov    $0x0,%eax
+    else if(strcmp(mode, "wb") == 0) r = open(filename, O_WRONLY);
+  8006d0:	85 d2                	test   %edx,%edx
+  8006d2:	0f 85 66 ff ff ff    	jne    80063e <libc_fopen+0x5c>
+  8006d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8006dd:	4c 89 e7             	mov    %r12,%rdi
+  8006e0:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  8006e7:	00 00 00 
+  8006ea:	ff d0                	call   *%rax
+  8006ec:	89 c3                	mov    %eax,%ebx
+  8006ee:	e9 2f ff ff ff       	jmp    800622 <libc_fopen+0x40>
+
+00000000008006f3 <libc_mmap>:
+
+void *libc_mmap(libc_FILE *file, size_t length) {
+  8006f3:	55                   	push   %rbp
+  8006f4:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+  8006f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8006fd:	44 8b 07             	mov    (%rdi),%r8d
+  800700:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800705:	ba 06 00 00 00       	mov    $0x6,%edx
+  80070a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80070f:	48 b8 ac 4a 80 00 00 	movabs $0x804aac,%rax
+  800716:	00 00 00 
+  800719:	ff d0                	call   *%rax
+    return addr == MAP_FAILED ? NULL : addr;
+  80071b:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+  80071f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800724:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800728:	5d                   	pop    %rbp
+  800729:	c3                   	ret
+
+000000000080072a <libc_munmap>:
+
+void libc_munmap(void *addr, size_t length) {
+  80072a:	55                   	push   %rbp
+  80072b:	48 89 e5             	mov    %rsp,%rbp
+    munmap(addr, length);
+  80072e:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  800735:	00 00 00 
+  800738:	ff d0                	call   *%rax
+}
+  80073a:	5d                   	pop    %rbp
+  80073b:	c3                   	ret
+
+000000000080073c <libc_fclose>:
+
+void libc_fclose(libc_FILE *file) {
+  80073c:	55                   	push   %rbp
+  80073d:	48 89 e5             	mov    %rsp,%rbp
+    close(*((int*)file));
+  800740:	8b 3f                	mov    (%rdi),%edi
+  800742:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+}
+  80074e:	5d                   	pop    %rbp
+  80074f:	c3                   	ret
+
+0000000000800750 <libc_ftell>:
+
+long libc_ftell(libc_FILE *file) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+    return tell(*((int*)file));
+  800754:	8b 3f                	mov    (%rdi),%edi
+  800756:	48 b8 c2 33 80 00 00 	movabs $0x8033c2,%rax
+  80075d:	00 00 00 
+  800760:	ff d0                	call   *%rax
+  800762:	48 98                	cltq
+}
+  800764:	5d                   	pop    %rbp
+  800765:	c3                   	ret
+
+0000000000800766 <libc_fseek>:
+
+int libc_fseek (libc_FILE *file, long offset, int origin) {
+  800766:	55                   	push   %rbp
+  800767:	48 89 e5             	mov    %rsp,%rbp
+  80076a:	41 55                	push   %r13
+  80076c:	41 54                	push   %r12
+  80076e:	53                   	push   %rbx
+  80076f:	48 81 ec a8 00 00 00 	sub    $0xa8,%rsp
+  800776:	48 89 f3             	mov    %rsi,%rbx
+  800779:	41 89 d4             	mov    %edx,%r12d
+    struct Stat stat;
+
+    int fd = *((int*)file);
+  80077c:	44 8b 2f             	mov    (%rdi),%r13d
+    fstat(fd, &stat);
+  80077f:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800786:	44 89 ef             	mov    %r13d,%edi
+  800789:	48 b8 8b 34 80 00 00 	movabs $0x80348b,%rax
+  800790:	00 00 00 
+  800793:	ff d0                	call   *%rax
+
+    if(origin == SEEK_END) {
+  800795:	41 83 fc 01          	cmp    $0x1,%r12d
+  800799:	74 38                	je     8007d3 <libc_fseek+0x6d>
+        if(offset > 0) return -1;
+        if(offset < -stat.st_size) return -1;
+        seek(fd, stat.st_size + offset);
+    } else if(origin == SEEK_SET) {
+        if(offset < 0) return -1;
+  80079b:	48 85 db             	test   %rbx,%rbx
+  80079e:	78 6c                	js     80080c <libc_fseek+0xa6>
+  8007a0:	41 83 fc 02          	cmp    $0x2,%r12d
+  8007a4:	75 66                	jne    80080c <libc_fseek+0xa6>
+        if(offset >= stat.st_size) return -1;
+  8007a6:	48 63 45 c0          	movslq -0x40(%rbp),%rax
+  8007aa:	48 39 d8             	cmp    %rbx,%rax
+  8007ad:	7e 64                	jle    800813 <libc_fseek+0xad>
+        seek(fd, offset);
+  8007af:	89 de                	mov    %ebx,%esi
+  8007b1:	44 89 ef             	mov    %r13d,%edi
+  8007b4:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  8007bb:	00 00 00 
+  8007be:	ff d0                	call   *%rax
+        if(offset < 0) return -1;
+        if(offset >= stat.st_size) return -1;
+        seek(fd, offset);
+    } else return -1;
+
+    return 0;
+  8007c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007c5:	48 81 c4 a8 00 00 00 	add    $0xa8,%rsp
+  8007cc:	5b                   	pop    %rbx
+  8007cd:	41 5c                	pop    %r12
+  8007cf:	41 5d                	pop    %r13
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+        if(offset > 0) return -1;
+  8007d3:	48 85 db             	test   %rbx,%rbx
+  8007d6:	7f 26                	jg     8007fe <libc_fseek+0x98>
+        if(offset < -stat.st_size) return -1;
+  8007d8:	8b 75 c0             	mov    -0x40(%rbp),%esi
+  8007db:	89 f0                	mov    %esi,%eax
+  8007dd:	f7 d8                	neg    %eax
+  8007df:	48 98                	cltq
+  8007e1:	48 39 d8             	cmp    %rbx,%rax
+  8007e4:	7f 1f                	jg     800805 <libc_fseek+0x9f>
+        seek(fd, stat.st_size + offset);
+  8007e6:	01 de                	add    %ebx,%esi
+  8007e8:	44 89 ef             	mov    %r13d,%edi
+  8007eb:	48 b8 91 33 80 00 00 	movabs $0x803391,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+    return 0;
+  8007f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fc:	eb c7                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset > 0) return -1;
+  8007fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800803:	eb c0                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < -stat.st_size) return -1;
+  800805:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80080a:	eb b9                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset < 0) return -1;
+  80080c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800811:	eb b2                	jmp    8007c5 <libc_fseek+0x5f>
+        if(offset >= stat.st_size) return -1;
+  800813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800818:	eb ab                	jmp    8007c5 <libc_fseek+0x5f>
+
+000000000080081a <libc_fflush>:
+
+int libc_fflush(libc_FILE *stream) {
+    // We're working with file descriptors directly. fflush is unnecessary
+    return 0;
+}
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	c3                   	ret
+
+0000000000800820 <libc_fread>:
+
+size_t libc_fread(void *buf, size_t size, size_t count, libc_FILE *stream) {
+  800820:	55                   	push   %rbp
+  800821:	48 89 e5             	mov    %rsp,%rbp
+    return read(*((int*)stream), buf, size * count);
+  800824:	48 0f af d6          	imul   %rsi,%rdx
+  800828:	8b 01                	mov    (%rcx),%eax
+  80082a:	48 89 fe             	mov    %rdi,%rsi
+  80082d:	89 c7                	mov    %eax,%edi
+  80082f:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  800836:	00 00 00 
+  800839:	ff d0                	call   *%rax
+}
+  80083b:	5d                   	pop    %rbp
+  80083c:	c3                   	ret
+
+000000000080083d <libc_fwrite>:
+
+size_t libc_fwrite(const void *buf, size_t size, size_t count, libc_FILE *stream) {
+  80083d:	55                   	push   %rbp
+  80083e:	48 89 e5             	mov    %rsp,%rbp
+    return write(*((int*)stream), buf, size * count);
+  800841:	48 0f af d6          	imul   %rsi,%rdx
+  800845:	8b 01                	mov    (%rcx),%eax
+  800847:	48 89 fe             	mov    %rdi,%rsi
+  80084a:	89 c7                	mov    %eax,%edi
+  80084c:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  800853:	00 00 00 
+  800856:	ff d0                	call   *%rax
+}
+  800858:	5d                   	pop    %rbp
+  800859:	c3                   	ret
+
+000000000080085a <libc_mkdir>:
+
+int libc_mkdir(const char *path, int chmod) {
+  80085a:	55                   	push   %rbp
+  80085b:	48 89 e5             	mov    %rsp,%rbp
+    int fd = open(path, O_MKDIR);
+  80085e:	be 00 08 00 00       	mov    $0x800,%esi
+  800863:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  80086a:	00 00 00 
+  80086d:	ff d0                	call   *%rax
+    if(fd < 0) return -1;
+  80086f:	85 c0                	test   %eax,%eax
+  800871:	78 15                	js     800888 <libc_mkdir+0x2e>
+  800873:	89 c7                	mov    %eax,%edi
+    close(fd);
+  800875:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+    return 0;
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800886:	5d                   	pop    %rbp
+  800887:	c3                   	ret
+    if(fd < 0) return -1;
+  800888:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80088d:	eb f7                	jmp    800886 <libc_mkdir+0x2c>
+
+000000000080088f <libc_vsscanf>:
+	return(ret);
+}
+
+int
+libc_vsscanf(const char *inp, char const *fmt0, va_list ap)
+{
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 57                	push   %r15
+  800895:	41 56                	push   %r14
+  800897:	41 55                	push   %r13
+  800899:	41 54                	push   %r12
+  80089b:	53                   	push   %rbx
+  80089c:	48 81 ec 58 01 00 00 	sub    $0x158,%rsp
+  8008a3:	49 89 fe             	mov    %rdi,%r14
+  8008a6:	48 89 f3             	mov    %rsi,%rbx
+  8008a9:	48 89 95 80 fe ff ff 	mov    %rdx,-0x180(%rbp)
+
+	/* `basefix' is used to avoid `if' tests in the integer scanner */
+	static short basefix[17] =
+		{ 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	inr = strlen(inp);
+  8008b0:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8008b7:	00 00 00 
+  8008ba:	ff d0                	call   *%rax
+	nassigned = 0;
+	nconversions = 0;
+	nread = 0;
+	base = 0;		/* XXX just to keep gcc happy */
+	for (;;) {
+		c = *fmt++;
+  8008bc:	44 0f b6 3b          	movzbl (%rbx),%r15d
+		if (c == 0)
+  8008c0:	45 85 ff             	test   %r15d,%r15d
+  8008c3:	0f 84 c6 0b 00 00    	je     80148f <libc_vsscanf+0xc00>
+  8008c9:	41 89 c5             	mov    %eax,%r13d
+  8008cc:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+	base = 0;		/* XXX just to keep gcc happy */
+  8008d0:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8008d7:	00 00 00 
+	nread = 0;
+  8008da:	c7 85 a4 fe ff ff 00 	movl   $0x0,-0x15c(%rbp)
+  8008e1:	00 00 00 
+	nconversions = 0;
+  8008e4:	c7 85 8c fe ff ff 00 	movl   $0x0,-0x174(%rbp)
+  8008eb:	00 00 00 
+	nassigned = 0;
+  8008ee:	c7 85 a0 fe ff ff 00 	movl   $0x0,-0x160(%rbp)
+  8008f5:	00 00 00 
+  8008f8:	e9 e5 00 00 00       	jmp    8009e2 <libc_vsscanf+0x153>
+			return (nassigned);
+		if (isspace(c)) {
+			while (inr > 0 && isspace(*inp))
+  8008fd:	48 bb e4 22 80 00 00 	movabs $0x8022e4,%rbx
+  800904:	00 00 00 
+  800907:	44 8b bd a4 fe ff ff 	mov    -0x15c(%rbp),%r15d
+  80090e:	45 85 ed             	test   %r13d,%r13d
+  800911:	7e 2b                	jle    80093e <libc_vsscanf+0xaf>
+  800913:	41 0f be 3e          	movsbl (%r14),%edi
+  800917:	ff d3                	call   *%rbx
+  800919:	84 c0                	test   %al,%al
+  80091b:	74 2d                	je     80094a <libc_vsscanf+0xbb>
+				nread++, inr--, inp++;
+  80091d:	41 83 c7 01          	add    $0x1,%r15d
+  800921:	49 83 c6 01          	add    $0x1,%r14
+			while (inr > 0 && isspace(*inp))
+  800925:	41 83 ed 01          	sub    $0x1,%r13d
+  800929:	75 e8                	jne    800913 <libc_vsscanf+0x84>
+  80092b:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800932:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800939:	e9 90 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80093e:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800945:	e9 84 00 00 00       	jmp    8009ce <libc_vsscanf+0x13f>
+  80094a:	44 89 bd a4 fe ff ff 	mov    %r15d,-0x15c(%rbp)
+  800951:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+  800958:	eb 74                	jmp    8009ce <libc_vsscanf+0x13f>
+			continue;
+		}
+		if (c != '%')
+			goto literal;
+		width = 0;
+		flags = 0;
+  80095a:	c7 85 98 fe ff ff 00 	movl   $0x0,-0x168(%rbp)
+  800961:	00 00 00 
+		width = 0;
+  800964:	48 c7 85 90 fe ff ff 	movq   $0x0,-0x170(%rbp)
+  80096b:	00 00 00 00 
+		/*
+		 * switch on the format.  continue if done;
+		 * break once format type is derived.
+		 */
+again:		c = *fmt++;
+  80096f:	49 8d 4c 24 01       	lea    0x1(%r12),%rcx
+  800974:	0f b6 51 ff          	movzbl -0x1(%rcx),%edx
+  800978:	44 0f b6 fa          	movzbl %dl,%r15d
+		switch (c) {
+  80097c:	8d 42 db             	lea    -0x25(%rdx),%eax
+  80097f:	3c 53                	cmp    $0x53,%al
+  800981:	0f 87 5d 04 00 00    	ja     800de4 <libc_vsscanf+0x555>
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	48 be 80 57 80 00 00 	movabs $0x805780,%rsi
+  800991:	00 00 00 
+  800994:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+			base = 10;
+			break;
+
+		case 'i':
+			c = CT_INT;
+			base = 0;
+  800997:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  80099e:	c7 85 88 fe ff ff 00 	movl   $0x0,-0x178(%rbp)
+  8009a5:	00 00 00 
+			c = CT_INT;
+  8009a8:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  8009ae:	e9 41 04 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+		switch (c) {
+  8009b3:	49 89 cc             	mov    %rcx,%r12
+  8009b6:	eb 4b                	jmp    800a03 <libc_vsscanf+0x174>
+			inr--, inp++;
+  8009b8:	41 83 ed 01          	sub    $0x1,%r13d
+  8009bc:	49 83 c6 01          	add    $0x1,%r14
+			nread++;
+  8009c0:	83 85 a4 fe ff ff 01 	addl   $0x1,-0x15c(%rbp)
+			continue;
+  8009c7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+		c = *fmt++;
+  8009ce:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  8009d5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d9:	44 0f b6 38          	movzbl (%rax),%r15d
+		if (c == 0)
+  8009dd:	45 85 ff             	test   %r15d,%r15d
+  8009e0:	74 33                	je     800a15 <libc_vsscanf+0x186>
+		if (isspace(c)) {
+  8009e2:	44 89 ff             	mov    %r15d,%edi
+  8009e5:	48 b8 e4 22 80 00 00 	movabs $0x8022e4,%rax
+  8009ec:	00 00 00 
+  8009ef:	ff d0                	call   *%rax
+  8009f1:	84 c0                	test   %al,%al
+  8009f3:	0f 85 04 ff ff ff    	jne    8008fd <libc_vsscanf+0x6e>
+		if (c != '%')
+  8009f9:	41 83 ff 25          	cmp    $0x25,%r15d
+  8009fd:	0f 84 57 ff ff ff    	je     80095a <libc_vsscanf+0xcb>
+			if (inr <= 0)
+  800a03:	45 85 ed             	test   %r13d,%r13d
+  800a06:	0f 8e 95 05 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+			if (*inp != c)
+  800a0c:	41 0f be 06          	movsbl (%r14),%eax
+  800a10:	44 39 f8             	cmp    %r15d,%eax
+  800a13:	74 a3                	je     8009b8 <libc_vsscanf+0x129>
+	}
+input_failure:
+	return (nconversions != 0 ? nassigned : -1);
+match_failure:
+	return (nassigned);
+}
+  800a15:	8b 85 a0 fe ff ff    	mov    -0x160(%rbp),%eax
+  800a1b:	48 81 c4 58 01 00 00 	add    $0x158,%rsp
+  800a22:	5b                   	pop    %rbx
+  800a23:	41 5c                	pop    %r12
+  800a25:	41 5d                	pop    %r13
+  800a27:	41 5e                	pop    %r14
+  800a29:	41 5f                	pop    %r15
+  800a2b:	5d                   	pop    %rbp
+  800a2c:	c3                   	ret
+			flags |= SUPPRESS;
+  800a2d:	83 8d 98 fe ff ff 08 	orl    $0x8,-0x168(%rbp)
+again:		c = *fmt++;
+  800a34:	49 89 cc             	mov    %rcx,%r12
+  800a37:	e9 33 ff ff ff       	jmp    80096f <libc_vsscanf+0xe0>
+				flags |= LONGLONG;
+  800a3c:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a42:	89 f0                	mov    %esi,%eax
+  800a44:	83 e0 fe             	and    $0xfffffffe,%eax
+  800a47:	80 cc 04             	or     $0x4,%ah
+  800a4a:	89 f2                	mov    %esi,%edx
+  800a4c:	83 ca 01             	or     $0x1,%edx
+  800a4f:	40 f6 c6 01          	test   $0x1,%sil
+  800a53:	0f 44 c2             	cmove  %edx,%eax
+  800a56:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a5c:	eb d6                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= LONGLONG;	/* not quite */
+  800a5e:	81 8d 98 fe ff ff 00 	orl    $0x400,-0x168(%rbp)
+  800a65:	04 00 00 
+			goto again;
+  800a68:	eb ca                	jmp    800a34 <libc_vsscanf+0x1a5>
+				flags |= SHORTSHORT;
+  800a6a:	8b b5 98 fe ff ff    	mov    -0x168(%rbp),%esi
+  800a70:	89 f0                	mov    %esi,%eax
+  800a72:	83 e0 fb             	and    $0xfffffffb,%eax
+  800a75:	80 cc 40             	or     $0x40,%ah
+  800a78:	89 f2                	mov    %esi,%edx
+  800a7a:	83 ca 04             	or     $0x4,%edx
+  800a7d:	40 f6 c6 04          	test   $0x4,%sil
+  800a81:	0f 44 c2             	cmove  %edx,%eax
+  800a84:	89 85 98 fe ff ff    	mov    %eax,-0x168(%rbp)
+  800a8a:	eb a8                	jmp    800a34 <libc_vsscanf+0x1a5>
+			width = width * 10 + c - '0';
+  800a8c:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800a93:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  800a97:	0f b6 d2             	movzbl %dl,%edx
+  800a9a:	48 8d 44 42 d0       	lea    -0x30(%rdx,%rax,2),%rax
+  800a9f:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			goto again;
+  800aa6:	eb 8c                	jmp    800a34 <libc_vsscanf+0x1a5>
+			flags |= UNSIGNED;
+  800aa8:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800aaf:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800ab6:	80 00 00 
+			base = 8;
+  800ab9:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  800ac0:	00 00 00 
+			c = CT_INT;
+  800ac3:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800ac9:	e9 26 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800ace:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800ad5:	81 8d 98 fe ff ff 00 	orl    $0x8000,-0x168(%rbp)
+  800adc:	80 00 00 
+			base = 10;
+  800adf:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800ae6:	00 00 00 
+			c = CT_INT;
+  800ae9:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800aef:	e9 00 03 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800af4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800afb:	81 8d 98 fe ff ff 00 	orl    $0x8100,-0x168(%rbp)
+  800b02:	81 00 00 
+			base = 16;
+  800b05:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800b0c:	00 00 00 
+			c = CT_INT;
+  800b0f:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800b15:	e9 da 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			c = CT_STRING;
+  800b1a:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b21:	41 bf 02 00 00 00    	mov    $0x2,%r15d
+			break;
+  800b27:	e9 c8 02 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+__libc_sccl(char *tab, const uint8_t *fmt)
+{
+	int c, n, v;
+
+	/* first `clear' the whole table */
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b2c:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800b33:	44 0f b6 39          	movzbl (%rcx),%r15d
+	if (c == '^') {
+  800b37:	41 83 ff 5e          	cmp    $0x5e,%r15d
+  800b3b:	74 61                	je     800b9e <libc_vsscanf+0x30f>
+	c = *fmt++;		/* first char hat => negated scanset */
+  800b3d:	49 83 c4 02          	add    $0x2,%r12
+		v = 1;		/* default => accept */
+		c = *fmt++;	/* get new first char */
+	} else
+		v = 0;		/* default => reject */
+  800b41:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+	/* XXX: Will not work if sizeof(tab*) > sizeof(char) */
+	(void) memset(tab, v, 256);
+  800b46:	ba 00 01 00 00       	mov    $0x100,%edx
+  800b4b:	89 de                	mov    %ebx,%esi
+  800b4d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800b54:	48 b8 17 23 80 00 00 	movabs $0x802317,%rax
+  800b5b:	00 00 00 
+  800b5e:	ff d0                	call   *%rax
+	 * to the opposite of the above.
+	 *
+	 * The first character may be ']' (or '-') without being special;
+	 * the last character may be '-'.
+	 */
+	v = 1 - v;
+  800b60:	ba 01 00 00 00       	mov    $0x1,%edx
+  800b65:	29 da                	sub    %ebx,%edx
+	for (;;) {
+		tab[c] = v;		/* take character c */
+  800b67:	89 d6                	mov    %edx,%esi
+	if (c == 0)
+  800b69:	45 85 ff             	test   %r15d,%r15d
+  800b6c:	74 47                	je     800bb5 <libc_vsscanf+0x326>
+		tab[c] = v;		/* take character c */
+  800b6e:	49 63 c7             	movslq %r15d,%rax
+  800b71:	88 94 05 d0 fe ff ff 	mov    %dl,-0x130(%rbp,%rax,1)
+doswitch:
+		n = *fmt++;		/* and examine the next */
+  800b78:	49 8d 7c 24 01       	lea    0x1(%r12),%rdi
+  800b7d:	48 89 bd a8 fe ff ff 	mov    %rdi,-0x158(%rbp)
+  800b84:	41 0f b6 04 24       	movzbl (%r12),%eax
+		switch (n) {
+  800b89:	3c 2d                	cmp    $0x2d,%al
+  800b8b:	74 3e                	je     800bcb <libc_vsscanf+0x33c>
+  800b8d:	3c 5d                	cmp    $0x5d,%al
+  800b8f:	74 6d                	je     800bfe <libc_vsscanf+0x36f>
+  800b91:	84 c0                	test   %al,%al
+  800b93:	74 62                	je     800bf7 <libc_vsscanf+0x368>
+		n = *fmt++;		/* and examine the next */
+  800b95:	44 0f b6 f8          	movzbl %al,%r15d
+			 * or is not numerically greater than the character
+			 * we just stored in the table (c).
+			 */
+			n = *fmt;
+			if (n == ']' || n < c) {
+				c = '-';
+  800b99:	49 89 fc             	mov    %rdi,%r12
+  800b9c:	eb d0                	jmp    800b6e <libc_vsscanf+0x2df>
+		c = *fmt++;	/* get new first char */
+  800b9e:	49 83 c4 03          	add    $0x3,%r12
+  800ba2:	48 8b 85 a8 fe ff ff 	mov    -0x158(%rbp),%rax
+  800ba9:	44 0f b6 78 01       	movzbl 0x1(%rax),%r15d
+		v = 1;		/* default => accept */
+  800bae:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800bb3:	eb 91                	jmp    800b46 <libc_vsscanf+0x2b7>
+		return (fmt - 1);/* format ended before closing ] */
+  800bb5:	49 8d 44 24 ff       	lea    -0x1(%r12),%rax
+  800bba:	48 89 85 a8 fe ff ff 	mov    %rax,-0x158(%rbp)
+  800bc1:	eb 3b                	jmp    800bfe <libc_vsscanf+0x36f>
+				c = '-';
+  800bc3:	41 bf 2d 00 00 00    	mov    $0x2d,%r15d
+  800bc9:	eb ce                	jmp    800b99 <libc_vsscanf+0x30a>
+			n = *fmt;
+  800bcb:	41 0f b6 4c 24 01    	movzbl 0x1(%r12),%ecx
+			if (n == ']' || n < c) {
+  800bd1:	83 f9 5d             	cmp    $0x5d,%ecx
+  800bd4:	74 ed                	je     800bc3 <libc_vsscanf+0x334>
+  800bd6:	44 39 f9             	cmp    %r15d,%ecx
+  800bd9:	7c e8                	jl     800bc3 <libc_vsscanf+0x334>
+				break;	/* resume the for(;;) */
+			}
+			fmt++;
+  800bdb:	49 83 c4 02          	add    $0x2,%r12
+  800bdf:	49 63 c7             	movslq %r15d,%rax
+			/* fill in the range */
+			do {
+			    tab[++c] = v;
+  800be2:	40 88 b4 05 d1 fe ff 	mov    %sil,-0x12f(%rbp,%rax,1)
+  800be9:	ff 
+			} while (c < n);
+  800bea:	48 83 c0 01          	add    $0x1,%rax
+  800bee:	39 c1                	cmp    %eax,%ecx
+  800bf0:	7f f0                	jg     800be2 <libc_vsscanf+0x353>
+			c = n;
+  800bf2:	41 89 cf             	mov    %ecx,%r15d
+  800bf5:	eb 81                	jmp    800b78 <libc_vsscanf+0x2e9>
+		switch (n) {
+  800bf7:	4c 89 a5 a8 fe ff ff 	mov    %r12,-0x158(%rbp)
+			flags |= NOSKIP;
+  800bfe:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CCL;
+  800c05:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+			break;
+  800c0b:	e9 e4 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= NOSKIP;
+  800c10:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c17:	83 8d 98 fe ff ff 20 	orl    $0x20,-0x168(%rbp)
+			c = CT_CHAR;
+  800c1e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+			break;
+  800c24:	e9 cb 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			flags |= UNSIGNED;
+  800c29:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c30:	81 8d 98 fe ff ff 10 	orl    $0x8110,-0x168(%rbp)
+  800c37:	81 00 00 
+			base = 16;
+  800c3a:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  800c41:	00 00 00 
+			c = CT_INT;
+  800c44:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+			break;
+  800c4a:	e9 a5 01 00 00       	jmp    800df4 <libc_vsscanf+0x565>
+			nconversions++;
+  800c4f:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800c56:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			if (flags & SUPPRESS)	/* ??? */
+  800c5d:	8b 85 98 fe ff ff    	mov    -0x168(%rbp),%eax
+  800c63:	a8 08                	test   $0x8,%al
+  800c65:	0f 85 63 fd ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (flags & SHORTSHORT)
+  800c6b:	f6 c4 40             	test   $0x40,%ah
+  800c6e:	74 3f                	je     800caf <libc_vsscanf+0x420>
+				*va_arg(ap, char *) = nread;
+  800c70:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800c77:	8b 01                	mov    (%rcx),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 1c                	ja     800c9a <libc_vsscanf+0x40b>
+  800c7e:	89 c2                	mov    %eax,%edx
+  800c80:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800c84:	83 c0 08             	add    $0x8,%eax
+  800c87:	89 01                	mov    %eax,(%rcx)
+  800c89:	48 8b 02             	mov    (%rdx),%rax
+  800c8c:	0f b6 8d a4 fe ff ff 	movzbl -0x15c(%rbp),%ecx
+  800c93:	88 08                	mov    %cl,(%rax)
+  800c95:	e9 34 fd ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800c9a:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800ca1:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  800ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca9:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  800cad:	eb da                	jmp    800c89 <libc_vsscanf+0x3fa>
+			else if (flags & SHORT)
+  800caf:	f6 85 98 fe ff ff 04 	testb  $0x4,-0x168(%rbp)
+  800cb6:	74 40                	je     800cf8 <libc_vsscanf+0x469>
+				*va_arg(ap, short *) = nread;
+  800cb8:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cbf:	8b 11                	mov    (%rcx),%edx
+  800cc1:	83 fa 2f             	cmp    $0x2f,%edx
+  800cc4:	77 1d                	ja     800ce3 <libc_vsscanf+0x454>
+  800cc6:	89 d0                	mov    %edx,%eax
+  800cc8:	48 03 41 10          	add    0x10(%rcx),%rax
+  800ccc:	83 c2 08             	add    $0x8,%edx
+  800ccf:	89 11                	mov    %edx,(%rcx)
+  800cd1:	48 8b 00             	mov    (%rax),%rax
+  800cd4:	0f b7 8d a4 fe ff ff 	movzwl -0x15c(%rbp),%ecx
+  800cdb:	66 89 08             	mov    %cx,(%rax)
+  800cde:	e9 eb fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ce3:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800cea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800cee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800cf6:	eb d9                	jmp    800cd1 <libc_vsscanf+0x442>
+			else if (flags & LONG)
+  800cf8:	f6 85 98 fe ff ff 01 	testb  $0x1,-0x168(%rbp)
+  800cff:	74 40                	je     800d41 <libc_vsscanf+0x4b2>
+				*va_arg(ap, long *) = nread;
+  800d01:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d08:	8b 11                	mov    (%rcx),%edx
+  800d0a:	83 fa 2f             	cmp    $0x2f,%edx
+  800d0d:	77 1d                	ja     800d2c <libc_vsscanf+0x49d>
+  800d0f:	89 d0                	mov    %edx,%eax
+  800d11:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d15:	83 c2 08             	add    $0x8,%edx
+  800d18:	89 11                	mov    %edx,(%rcx)
+  800d1a:	48 8b 00             	mov    (%rax),%rax
+  800d1d:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d24:	48 89 10             	mov    %rdx,(%rax)
+  800d27:	e9 a2 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d2c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d33:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d37:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d3b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d3f:	eb d9                	jmp    800d1a <libc_vsscanf+0x48b>
+			else if (flags & LONGLONG)
+  800d41:	f7 85 98 fe ff ff 00 	testl  $0x400,-0x168(%rbp)
+  800d48:	04 00 00 
+  800d4b:	74 40                	je     800d8d <libc_vsscanf+0x4fe>
+				*va_arg(ap, long long *) = nread;
+  800d4d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d54:	8b 11                	mov    (%rcx),%edx
+  800d56:	83 fa 2f             	cmp    $0x2f,%edx
+  800d59:	77 1d                	ja     800d78 <libc_vsscanf+0x4e9>
+  800d5b:	89 d0                	mov    %edx,%eax
+  800d5d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800d61:	83 c2 08             	add    $0x8,%edx
+  800d64:	89 11                	mov    %edx,(%rcx)
+  800d66:	48 8b 00             	mov    (%rax),%rax
+  800d69:	48 63 95 a4 fe ff ff 	movslq -0x15c(%rbp),%rdx
+  800d70:	48 89 10             	mov    %rdx,(%rax)
+  800d73:	e9 56 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800d78:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d7f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800d83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d87:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800d8b:	eb d9                	jmp    800d66 <libc_vsscanf+0x4d7>
+				*va_arg(ap, int *) = nread;
+  800d8d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800d94:	8b 11                	mov    (%rcx),%edx
+  800d96:	83 fa 2f             	cmp    $0x2f,%edx
+  800d99:	77 1b                	ja     800db6 <libc_vsscanf+0x527>
+  800d9b:	89 d0                	mov    %edx,%eax
+  800d9d:	48 03 41 10          	add    0x10(%rcx),%rax
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 11                	mov    %edx,(%rcx)
+  800da6:	48 8b 00             	mov    (%rax),%rax
+  800da9:	8b 8d a4 fe ff ff    	mov    -0x15c(%rbp),%ecx
+  800daf:	89 08                	mov    %ecx,(%rax)
+  800db1:	e9 18 fc ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800db6:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800dbd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800dc1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dc5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800dc9:	eb db                	jmp    800da6 <libc_vsscanf+0x517>
+		switch (c) {
+  800dcb:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800dd2:	c7 85 88 fe ff ff 0a 	movl   $0xa,-0x178(%rbp)
+  800dd9:	00 00 00 
+  800ddc:	41 bf 03 00 00 00    	mov    $0x3,%r15d
+  800de2:	eb 10                	jmp    800df4 <libc_vsscanf+0x565>
+  800de4:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+  800deb:	eb 07                	jmp    800df4 <libc_vsscanf+0x565>
+  800ded:	48 89 8d a8 fe ff ff 	mov    %rcx,-0x158(%rbp)
+		if (inr <= 0)
+  800df4:	45 85 ed             	test   %r13d,%r13d
+  800df7:	0f 8e a4 01 00 00    	jle    800fa1 <libc_vsscanf+0x712>
+		if ((flags & NOSKIP) == 0) {
+  800dfd:	f6 85 98 fe ff ff 20 	testb  $0x20,-0x168(%rbp)
+  800e04:	0f 84 df 00 00 00    	je     800ee9 <libc_vsscanf+0x65a>
+		switch (c) {
+  800e0a:	41 83 ff 02          	cmp    $0x2,%r15d
+  800e0e:	0f 84 30 02 00 00    	je     801044 <libc_vsscanf+0x7b5>
+  800e14:	0f 8f 11 01 00 00    	jg     800f2b <libc_vsscanf+0x69c>
+  800e1a:	45 85 ff             	test   %r15d,%r15d
+  800e1d:	0f 84 52 01 00 00    	je     800f75 <libc_vsscanf+0x6e6>
+  800e23:	41 83 ff 01          	cmp    $0x1,%r15d
+  800e27:	0f 85 a1 fb ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+				width = (size_t)~0;	/* `infinity' */
+  800e2d:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800e34:	48 85 c9             	test   %rcx,%rcx
+  800e37:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  800e3e:	48 0f 45 c1          	cmovne %rcx,%rax
+  800e42:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  800e49:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800e50:	0f 85 81 01 00 00    	jne    800fd7 <libc_vsscanf+0x748>
+				p0 = p = va_arg(ap, char *);
+  800e56:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  800e5d:	8b 01                	mov    (%rcx),%eax
+  800e5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e62:	0f 87 c4 01 00 00    	ja     80102c <libc_vsscanf+0x79d>
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	48 03 51 10          	add    0x10(%rcx),%rdx
+  800e6e:	83 c0 08             	add    $0x8,%eax
+  800e71:	89 01                	mov    %eax,(%rcx)
+  800e73:	48 8b 0a             	mov    (%rdx),%rcx
+  800e76:	48 89 ca             	mov    %rcx,%rdx
+				while (ccltab[(unsigned char)*inp]) {
+  800e79:	4c 89 f0             	mov    %r14,%rax
+					if (--width == 0)
+  800e7c:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800e83:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800e86:	0f b6 30             	movzbl (%rax),%esi
+  800e89:	40 0f b6 fe          	movzbl %sil,%edi
+  800e8d:	80 bc 3d d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdi,1)
+  800e94:	00 
+  800e95:	74 23                	je     800eba <libc_vsscanf+0x62b>
+					inr--;
+  800e97:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  800e9b:	48 83 c0 01          	add    $0x1,%rax
+  800e9f:	48 83 c2 01          	add    $0x1,%rdx
+  800ea3:	40 88 72 ff          	mov    %sil,-0x1(%rdx)
+					if (--width == 0)
+  800ea7:	4c 39 f0             	cmp    %r14,%rax
+  800eaa:	74 0e                	je     800eba <libc_vsscanf+0x62b>
+					if (inr <= 0) {
+  800eac:	45 85 ed             	test   %r13d,%r13d
+  800eaf:	7f d5                	jg     800e86 <libc_vsscanf+0x5f7>
+						if (p == p0)
+  800eb1:	48 39 d1             	cmp    %rdx,%rcx
+  800eb4:	0f 84 e7 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+				n = p - p0;
+  800eba:	48 89 d6             	mov    %rdx,%rsi
+  800ebd:	48 29 ce             	sub    %rcx,%rsi
+  800ec0:	89 f1                	mov    %esi,%ecx
+				if (n == 0)
+  800ec2:	85 f6                	test   %esi,%esi
+  800ec4:	0f 84 4b fb ff ff    	je     800a15 <libc_vsscanf+0x186>
+				*p = 0;
+  800eca:	c6 02 00             	movb   $0x0,(%rdx)
+				nassigned++;
+  800ecd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  800ed4:	49 89 c6             	mov    %rax,%r14
+			nread += n;
+  800ed7:	01 8d a4 fe ff ff    	add    %ecx,-0x15c(%rbp)
+			nconversions++;
+  800edd:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800ee4:	e9 e5 fa ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800ee9:	44 89 eb             	mov    %r13d,%ebx
+			while (isspace(*inp)) {
+  800eec:	49 bc e4 22 80 00 00 	movabs $0x8022e4,%r12
+  800ef3:	00 00 00 
+  800ef6:	41 0f be 3e          	movsbl (%r14),%edi
+  800efa:	41 ff d4             	call   *%r12
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 0f                	je     800f10 <libc_vsscanf+0x681>
+				if (--inr > 0)
+  800f01:	83 eb 01             	sub    $0x1,%ebx
+  800f04:	0f 84 97 00 00 00    	je     800fa1 <libc_vsscanf+0x712>
+					inp++;
+  800f0a:	49 83 c6 01          	add    $0x1,%r14
+  800f0e:	eb e6                	jmp    800ef6 <libc_vsscanf+0x667>
+  800f10:	8b 85 a4 fe ff ff    	mov    -0x15c(%rbp),%eax
+  800f16:	41 01 c5             	add    %eax,%r13d
+  800f19:	41 29 dd             	sub    %ebx,%r13d
+  800f1c:	44 89 ad a4 fe ff ff 	mov    %r13d,-0x15c(%rbp)
+			while (isspace(*inp)) {
+  800f23:	41 89 dd             	mov    %ebx,%r13d
+  800f26:	e9 df fe ff ff       	jmp    800e0a <libc_vsscanf+0x57b>
+		switch (c) {
+  800f2b:	41 83 ff 03          	cmp    $0x3,%r15d
+  800f2f:	0f 85 99 fa ff ff    	jne    8009ce <libc_vsscanf+0x13f>
+			if (--width > sizeof(buf) - 2)
+  800f35:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  800f3c:	48 83 e8 01          	sub    $0x1,%rax
+  800f40:	ba 1e 00 00 00       	mov    $0x1e,%edx
+  800f45:	48 39 d0             	cmp    %rdx,%rax
+  800f48:	48 0f 47 c2          	cmova  %rdx,%rax
+			flags |= SIGNOK | NDIGITS | NZDIGITS;
+  800f4c:	44 8b a5 98 fe ff ff 	mov    -0x168(%rbp),%r12d
+  800f53:	41 81 cc c0 02 00 00 	or     $0x2c0,%r12d
+			for (p = buf; width; width--) {
+  800f5a:	49 8d 4c 06 01       	lea    0x1(%r14,%rax,1),%rcx
+  800f5f:	48 8d 9d b0 fe ff ff 	lea    -0x150(%rbp),%rbx
+  800f66:	48 be 20 5a 80 00 00 	movabs $0x805a20,%rsi
+  800f6d:	00 00 00 
+  800f70:	e9 48 02 00 00       	jmp    8011bd <libc_vsscanf+0x92e>
+			if (flags & SUPPRESS) {
+  800f75:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  800f7c:	74 4d                	je     800fcb <libc_vsscanf+0x73c>
+  800f7e:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  800f85:	48 85 c9             	test   %rcx,%rcx
+  800f88:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f8d:	48 0f 45 c1          	cmovne %rcx,%rax
+					if ((n = inr) < (int)width) {
+  800f91:	41 39 c5             	cmp    %eax,%r13d
+  800f94:	7d 29                	jge    800fbf <libc_vsscanf+0x730>
+						sum += n;
+  800f96:	49 63 c5             	movslq %r13d,%rax
+						inp += n;
+  800f99:	49 01 c6             	add    %rax,%r14
+						if (sum == 0)
+  800f9c:	48 85 c0             	test   %rax,%rax
+  800f9f:	75 24                	jne    800fc5 <libc_vsscanf+0x736>
+	return (nconversions != 0 ? nassigned : -1);
+  800fa1:	83 bd 8c fe ff ff 00 	cmpl   $0x0,-0x174(%rbp)
+  800fa8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800fad:	0f 45 85 a0 fe ff ff 	cmovne -0x160(%rbp),%eax
+  800fb4:	89 85 a0 fe ff ff    	mov    %eax,-0x160(%rbp)
+  800fba:	e9 56 fa ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+						inr -= width;
+  800fbf:	41 29 c5             	sub    %eax,%r13d
+						inp += width;
+  800fc2:	49 01 c6             	add    %rax,%r14
+				nread += sum;
+  800fc5:	01 85 a4 fe ff ff    	add    %eax,-0x15c(%rbp)
+			nconversions++;
+  800fcb:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  800fd2:	e9 f7 f9 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+  800fd7:	4c 89 f0             	mov    %r14,%rax
+				n = 0;
+  800fda:	b9 00 00 00 00       	mov    $0x0,%ecx
+					if (--width == 0)
+  800fdf:	48 8b b5 90 fe ff ff 	mov    -0x170(%rbp),%rsi
+  800fe6:	49 01 f6             	add    %rsi,%r14
+				while (ccltab[(unsigned char)*inp]) {
+  800fe9:	0f b6 10             	movzbl (%rax),%edx
+  800fec:	80 bc 15 d0 fe ff ff 	cmpb   $0x0,-0x130(%rbp,%rdx,1)
+  800ff3:	00 
+  800ff4:	74 21                	je     801017 <libc_vsscanf+0x788>
+					n++, inr--, inp++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	41 83 ed 01          	sub    $0x1,%r13d
+  800ffd:	48 83 c0 01          	add    $0x1,%rax
+					if (--width == 0)
+  801001:	4c 39 f0             	cmp    %r14,%rax
+  801004:	74 21                	je     801027 <libc_vsscanf+0x798>
+					if (inr <= 0) {
+  801006:	45 85 ed             	test   %r13d,%r13d
+  801009:	7f de                	jg     800fe9 <libc_vsscanf+0x75a>
+						if (n == 0)
+  80100b:	85 c9                	test   %ecx,%ecx
+  80100d:	74 92                	je     800fa1 <libc_vsscanf+0x712>
+					n++, inr--, inp++;
+  80100f:	49 89 c6             	mov    %rax,%r14
+  801012:	e9 c0 fe ff ff       	jmp    800ed7 <libc_vsscanf+0x648>
+  801017:	49 89 c6             	mov    %rax,%r14
+				if (n == 0)
+  80101a:	85 c9                	test   %ecx,%ecx
+  80101c:	0f 85 b5 fe ff ff    	jne    800ed7 <libc_vsscanf+0x648>
+  801022:	e9 ee f9 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+					n++, inr--, inp++;
+  801027:	49 89 c6             	mov    %rax,%r14
+  80102a:	eb ee                	jmp    80101a <libc_vsscanf+0x78b>
+				p0 = p = va_arg(ap, char *);
+  80102c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801033:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801037:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80103f:	e9 2f fe ff ff       	jmp    800e73 <libc_vsscanf+0x5e4>
+				width = (size_t)~0;
+  801044:	48 8b 8d 90 fe ff ff 	mov    -0x170(%rbp),%rcx
+  80104b:	48 85 c9             	test   %rcx,%rcx
+  80104e:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  801055:	48 0f 45 c1          	cmovne %rcx,%rax
+  801059:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+			if (flags & SUPPRESS) {
+  801060:	f6 85 98 fe ff ff 08 	testb  $0x8,-0x168(%rbp)
+  801067:	0f 85 8c 00 00 00    	jne    8010f9 <libc_vsscanf+0x86a>
+				p0 = p = va_arg(ap, char *);
+  80106d:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801074:	8b 01                	mov    (%rcx),%eax
+  801076:	83 f8 2f             	cmp    $0x2f,%eax
+  801079:	0f 87 cd 00 00 00    	ja     80114c <libc_vsscanf+0x8bd>
+  80107f:	89 c2                	mov    %eax,%edx
+  801081:	48 03 51 10          	add    0x10(%rcx),%rdx
+  801085:	83 c0 08             	add    $0x8,%eax
+  801088:	89 01                	mov    %eax,(%rcx)
+  80108a:	48 8b 12             	mov    (%rdx),%rdx
+  80108d:	49 89 d4             	mov    %rdx,%r12
+				while (!isspace(*inp)) {
+  801090:	4c 89 f3             	mov    %r14,%rbx
+  801093:	49 bf e4 22 80 00 00 	movabs $0x8022e4,%r15
+  80109a:	00 00 00 
+  80109d:	48 89 95 98 fe ff ff 	mov    %rdx,-0x168(%rbp)
+  8010a4:	0f be 3b             	movsbl (%rbx),%edi
+  8010a7:	41 ff d7             	call   *%r15
+  8010aa:	84 c0                	test   %al,%al
+  8010ac:	75 29                	jne    8010d7 <libc_vsscanf+0x848>
+					inr--;
+  8010ae:	41 83 ed 01          	sub    $0x1,%r13d
+					*p++ = *inp++;
+  8010b2:	48 83 c3 01          	add    $0x1,%rbx
+  8010b6:	49 83 c4 01          	add    $0x1,%r12
+  8010ba:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  8010be:	41 88 44 24 ff       	mov    %al,-0x1(%r12)
+					if (--width == 0)
+  8010c3:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  8010ca:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  8010cd:	48 39 c3             	cmp    %rax,%rbx
+  8010d0:	74 05                	je     8010d7 <libc_vsscanf+0x848>
+  8010d2:	45 85 ed             	test   %r13d,%r13d
+  8010d5:	7f cd                	jg     8010a4 <libc_vsscanf+0x815>
+				*p = 0;
+  8010d7:	48 8b 95 98 fe ff ff 	mov    -0x168(%rbp),%rdx
+  8010de:	41 c6 04 24 00       	movb   $0x0,(%r12)
+				nread += p - p0;
+  8010e3:	49 29 d4             	sub    %rdx,%r12
+  8010e6:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+				nassigned++;
+  8010ed:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+  8010f4:	49 89 de             	mov    %rbx,%r14
+  8010f7:	eb 47                	jmp    801140 <libc_vsscanf+0x8b1>
+  8010f9:	4c 89 f3             	mov    %r14,%rbx
+				n = 0;
+  8010fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+				while (!isspace(*inp)) {
+  801102:	49 bf e4 22 80 00 00 	movabs $0x8022e4,%r15
+  801109:	00 00 00 
+  80110c:	0f be 3b             	movsbl (%rbx),%edi
+  80110f:	41 ff d7             	call   *%r15
+  801112:	84 c0                	test   %al,%al
+  801114:	75 20                	jne    801136 <libc_vsscanf+0x8a7>
+					n++, inr--, inp++;
+  801116:	41 83 c4 01          	add    $0x1,%r12d
+  80111a:	41 83 ed 01          	sub    $0x1,%r13d
+  80111e:	48 83 c3 01          	add    $0x1,%rbx
+					if (--width == 0)
+  801122:	48 8b 85 90 fe ff ff 	mov    -0x170(%rbp),%rax
+  801129:	4c 01 f0             	add    %r14,%rax
+					if (inr <= 0)
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 05                	je     801136 <libc_vsscanf+0x8a7>
+  801131:	45 85 ed             	test   %r13d,%r13d
+  801134:	7f d6                	jg     80110c <libc_vsscanf+0x87d>
+				nread += n;
+  801136:	44 01 a5 a4 fe ff ff 	add    %r12d,-0x15c(%rbp)
+  80113d:	49 89 de             	mov    %rbx,%r14
+			nconversions++;
+  801140:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			continue;
+  801147:	e9 82 f8 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+				p0 = p = va_arg(ap, char *);
+  80114c:	48 8b 8d 80 fe ff ff 	mov    -0x180(%rbp),%rcx
+  801153:	48 8b 51 08          	mov    0x8(%rcx),%rdx
+  801157:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115b:	48 89 41 08          	mov    %rax,0x8(%rcx)
+  80115f:	e9 26 ff ff ff       	jmp    80108a <libc_vsscanf+0x7fb>
+					if (base == 0) {
+  801164:	83 bd 88 fe ff ff 00 	cmpl   $0x0,-0x178(%rbp)
+  80116b:	75 11                	jne    80117e <libc_vsscanf+0x8ef>
+						flags |= PFXOK;
+  80116d:	41 81 cc 00 01 00 00 	or     $0x100,%r12d
+						base = 8;
+  801174:	c7 85 88 fe ff ff 08 	movl   $0x8,-0x178(%rbp)
+  80117b:	00 00 00 
+					    flags &= ~(SIGNOK|NZDIGITS|NDIGITS);
+  80117e:	44 89 e0             	mov    %r12d,%eax
+  801181:	25 3f fd ff ff       	and    $0xfffffd3f,%eax
+  801186:	44 89 e7             	mov    %r12d,%edi
+  801189:	81 e7 3f fe ff ff    	and    $0xfffffe3f,%edi
+  80118f:	41 f7 c4 00 02 00 00 	test   $0x200,%r12d
+  801196:	0f 44 c7             	cmove  %edi,%eax
+  801199:	41 89 c4             	mov    %eax,%r12d
+				*p++ = c;
+  80119c:	48 83 c3 01          	add    $0x1,%rbx
+  8011a0:	88 53 ff             	mov    %dl,-0x1(%rbx)
+				if (--inr > 0)
+  8011a3:	41 83 ed 01          	sub    $0x1,%r13d
+  8011a7:	45 85 ed             	test   %r13d,%r13d
+  8011aa:	0f 8e af 00 00 00    	jle    80125f <libc_vsscanf+0x9d0>
+					inp++;
+  8011b0:	49 83 c6 01          	add    $0x1,%r14
+			for (p = buf; width; width--) {
+  8011b4:	49 39 ce             	cmp    %rcx,%r14
+  8011b7:	0f 84 59 01 00 00    	je     801316 <libc_vsscanf+0xa87>
+				c = *inp;
+  8011bd:	41 0f b6 16          	movzbl (%r14),%edx
+				switch (c) {
+  8011c1:	8d 42 d5             	lea    -0x2b(%rdx),%eax
+  8011c4:	3c 4d                	cmp    $0x4d,%al
+  8011c6:	0f 87 93 00 00 00    	ja     80125f <libc_vsscanf+0x9d0>
+  8011cc:	0f b6 c0             	movzbl %al,%eax
+  8011cf:	ff 24 c6             	jmp    *(%rsi,%rax,8)
+					base = basefix[base];
+  8011d2:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011d9:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  8011e0:	00 00 00 
+  8011e3:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  8011e7:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  8011ed:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  8011f4:	eb a6                	jmp    80119c <libc_vsscanf+0x90d>
+					base = basefix[base];
+  8011f6:	48 63 bd 88 fe ff ff 	movslq -0x178(%rbp),%rdi
+  8011fd:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  801204:	00 00 00 
+  801207:	0f bf 04 78          	movswl (%rax,%rdi,2),%eax
+  80120b:	89 85 88 fe ff ff    	mov    %eax,-0x178(%rbp)
+					if (base <= 8)
+  801211:	83 f8 08             	cmp    $0x8,%eax
+  801214:	7e 49                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  801216:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  80121d:	e9 7a ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (base <= 10)
+  801222:	83 bd 88 fe ff ff 0a 	cmpl   $0xa,-0x178(%rbp)
+  801229:	7e 34                	jle    80125f <libc_vsscanf+0x9d0>
+					flags &= ~(SIGNOK | PFXOK | NDIGITS);
+  80122b:	41 81 e4 3f fe ff ff 	and    $0xfffffe3f,%r12d
+					goto ok;
+  801232:	e9 65 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & SIGNOK) {
+  801237:	41 f6 c4 40          	test   $0x40,%r12b
+  80123b:	74 22                	je     80125f <libc_vsscanf+0x9d0>
+						flags &= ~SIGNOK;
+  80123d:	41 83 e4 bf          	and    $0xffffffbf,%r12d
+						goto ok;
+  801241:	e9 56 ff ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					if (flags & PFXOK && p == buf + 1) {
+  801246:	41 f7 c4 00 01 00 00 	test   $0x100,%r12d
+  80124d:	74 10                	je     80125f <libc_vsscanf+0x9d0>
+  80124f:	48 8d 85 b1 fe ff ff 	lea    -0x14f(%rbp),%rax
+  801256:	48 39 c3             	cmp    %rax,%rbx
+  801259:	0f 84 a1 00 00 00    	je     801300 <libc_vsscanf+0xa71>
+			if (flags & NDIGITS) {
+  80125f:	41 f6 c4 80          	test   $0x80,%r12b
+  801263:	0f 85 ac f7 ff ff    	jne    800a15 <libc_vsscanf+0x186>
+			if (c == 'x' || c == 'X') {
+  801269:	0f b6 43 ff          	movzbl -0x1(%rbx),%eax
+  80126d:	83 e0 df             	and    $0xffffffdf,%eax
+  801270:	3c 58                	cmp    $0x58,%al
+  801272:	75 0c                	jne    801280 <libc_vsscanf+0x9f1>
+				--p;
+  801274:	48 83 eb 01          	sub    $0x1,%rbx
+				inp--;
+  801278:	49 83 ee 01          	sub    $0x1,%r14
+				inr++;
+  80127c:	41 83 c5 01          	add    $0x1,%r13d
+			if ((flags & SUPPRESS) == 0) {
+  801280:	41 f6 c4 08          	test   $0x8,%r12b
+  801284:	75 5e                	jne    8012e4 <libc_vsscanf+0xa55>
+				*p = 0;
+  801286:	c6 03 00             	movb   $0x0,(%rbx)
+				if ((flags & UNSIGNED) == 0)
+  801289:	41 f7 c4 00 80 00 00 	test   $0x8000,%r12d
+  801290:	0f 85 88 00 00 00    	jne    80131e <libc_vsscanf+0xa8f>
+                    res = strtol(buf, (char **)NULL, base);
+  801296:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  80129c:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a1:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  8012a8:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+				if (flags & POINTER)
+  8012b4:	41 f6 c4 10          	test   $0x10,%r12b
+  8012b8:	0f 84 98 00 00 00    	je     801356 <libc_vsscanf+0xac7>
+					*va_arg(ap, void **) =
+  8012be:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8012c5:	8b 16                	mov    (%rsi),%edx
+  8012c7:	83 fa 2f             	cmp    $0x2f,%edx
+  8012ca:	77 75                	ja     801341 <libc_vsscanf+0xab2>
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  8012d2:	83 c2 08             	add    $0x8,%edx
+  8012d5:	89 16                	mov    %edx,(%rsi)
+  8012d7:	48 8b 11             	mov    (%rcx),%rdx
+  8012da:	48 89 02             	mov    %rax,(%rdx)
+				nassigned++;
+  8012dd:	83 85 a0 fe ff ff 01 	addl   $0x1,-0x160(%rbp)
+			nread += p - buf;
+  8012e4:	48 8d 85 b0 fe ff ff 	lea    -0x150(%rbp),%rax
+  8012eb:	48 29 c3             	sub    %rax,%rbx
+  8012ee:	01 9d a4 fe ff ff    	add    %ebx,-0x15c(%rbp)
+			nconversions++;
+  8012f4:	83 85 8c fe ff ff 01 	addl   $0x1,-0x174(%rbp)
+			break;
+  8012fb:	e9 ce f6 ff ff       	jmp    8009ce <libc_vsscanf+0x13f>
+						flags &= ~PFXOK;
+  801300:	41 81 e4 ff fe ff ff 	and    $0xfffffeff,%r12d
+						base = 16;	/* if %d */
+  801307:	c7 85 88 fe ff ff 10 	movl   $0x10,-0x178(%rbp)
+  80130e:	00 00 00 
+						goto ok;
+  801311:	e9 86 fe ff ff       	jmp    80119c <libc_vsscanf+0x90d>
+					inp++;
+  801316:	49 89 ce             	mov    %rcx,%r14
+  801319:	e9 41 ff ff ff       	jmp    80125f <libc_vsscanf+0x9d0>
+                    res = strtol(buf, (char **)NULL, base);
+  80131e:	8b 95 88 fe ff ff    	mov    -0x178(%rbp),%edx
+  801324:	be 00 00 00 00       	mov    $0x0,%esi
+  801329:	48 8d bd b0 fe ff ff 	lea    -0x150(%rbp),%rdi
+  801330:	48 b8 3c 25 80 00 00 	movabs $0x80253c,%rax
+  801337:	00 00 00 
+  80133a:	ff d0                	call   *%rax
+  80133c:	e9 73 ff ff ff       	jmp    8012b4 <libc_vsscanf+0xa25>
+					*va_arg(ap, void **) =
+  801341:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801348:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80134c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801350:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801354:	eb 81                	jmp    8012d7 <libc_vsscanf+0xa48>
+				else if (flags & SHORTSHORT)
+  801356:	41 f7 c4 00 40 00 00 	test   $0x4000,%r12d
+  80135d:	74 38                	je     801397 <libc_vsscanf+0xb08>
+					*va_arg(ap, char *) = res;
+  80135f:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801366:	8b 16                	mov    (%rsi),%edx
+  801368:	83 fa 2f             	cmp    $0x2f,%edx
+  80136b:	77 15                	ja     801382 <libc_vsscanf+0xaf3>
+  80136d:	89 d1                	mov    %edx,%ecx
+  80136f:	48 03 4e 10          	add    0x10(%rsi),%rcx
+  801373:	83 c2 08             	add    $0x8,%edx
+  801376:	89 16                	mov    %edx,(%rsi)
+  801378:	48 8b 11             	mov    (%rcx),%rdx
+  80137b:	88 02                	mov    %al,(%rdx)
+  80137d:	e9 5b ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801382:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801389:	48 8b 4e 08          	mov    0x8(%rsi),%rcx
+  80138d:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  801391:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  801395:	eb e1                	jmp    801378 <libc_vsscanf+0xae9>
+				else if (flags & SHORT)
+  801397:	41 f6 c4 04          	test   $0x4,%r12b
+  80139b:	74 39                	je     8013d6 <libc_vsscanf+0xb47>
+					*va_arg(ap, short *) = res;
+  80139d:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013a4:	8b 0e                	mov    (%rsi),%ecx
+  8013a6:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013a9:	77 16                	ja     8013c1 <libc_vsscanf+0xb32>
+  8013ab:	89 ca                	mov    %ecx,%edx
+  8013ad:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013b1:	83 c1 08             	add    $0x8,%ecx
+  8013b4:	89 0e                	mov    %ecx,(%rsi)
+  8013b6:	48 8b 12             	mov    (%rdx),%rdx
+  8013b9:	66 89 02             	mov    %ax,(%rdx)
+  8013bc:	e9 1c ff ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  8013c1:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013c8:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8013cc:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  8013d0:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  8013d4:	eb e0                	jmp    8013b6 <libc_vsscanf+0xb27>
+				else if (flags & LONG)
+  8013d6:	41 f6 c4 01          	test   $0x1,%r12b
+  8013da:	74 39                	je     801415 <libc_vsscanf+0xb86>
+					*va_arg(ap, long *) = res;
+  8013dc:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  8013e3:	8b 0e                	mov    (%rsi),%ecx
+  8013e5:	83 f9 2f             	cmp    $0x2f,%ecx
+  8013e8:	77 16                	ja     801400 <libc_vsscanf+0xb71>
+  8013ea:	89 ca                	mov    %ecx,%edx
+  8013ec:	48 03 56 10          	add    0x10(%rsi),%rdx
+  8013f0:	83 c1 08             	add    $0x8,%ecx
+  8013f3:	89 0e                	mov    %ecx,(%rsi)
+  8013f5:	48 8b 12             	mov    (%rdx),%rdx
+  8013f8:	48 89 02             	mov    %rax,(%rdx)
+  8013fb:	e9 dd fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801400:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801407:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80140b:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  80140f:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801413:	eb e0                	jmp    8013f5 <libc_vsscanf+0xb66>
+				else if (flags & LONGLONG)
+  801415:	41 f7 c4 00 04 00 00 	test   $0x400,%r12d
+  80141c:	74 39                	je     801457 <libc_vsscanf+0xbc8>
+					*va_arg(ap, long long *) = res;
+  80141e:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801425:	8b 0e                	mov    (%rsi),%ecx
+  801427:	83 f9 2f             	cmp    $0x2f,%ecx
+  80142a:	77 16                	ja     801442 <libc_vsscanf+0xbb3>
+  80142c:	89 ca                	mov    %ecx,%edx
+  80142e:	48 03 56 10          	add    0x10(%rsi),%rdx
+  801432:	83 c1 08             	add    $0x8,%ecx
+  801435:	89 0e                	mov    %ecx,(%rsi)
+  801437:	48 8b 12             	mov    (%rdx),%rdx
+  80143a:	48 89 02             	mov    %rax,(%rdx)
+  80143d:	e9 9b fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  801442:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801449:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144d:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801451:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  801455:	eb e0                	jmp    801437 <libc_vsscanf+0xba8>
+					*va_arg(ap, int *) = res;
+  801457:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  80145e:	8b 0e                	mov    (%rsi),%ecx
+  801460:	83 f9 2f             	cmp    $0x2f,%ecx
+  801463:	77 15                	ja     80147a <libc_vsscanf+0xbeb>
+  801465:	89 ca                	mov    %ecx,%edx
+  801467:	48 03 56 10          	add    0x10(%rsi),%rdx
+  80146b:	83 c1 08             	add    $0x8,%ecx
+  80146e:	89 0e                	mov    %ecx,(%rsi)
+  801470:	48 8b 12             	mov    (%rdx),%rdx
+  801473:	89 02                	mov    %eax,(%rdx)
+  801475:	e9 63 fe ff ff       	jmp    8012dd <libc_vsscanf+0xa4e>
+  80147a:	48 8b b5 80 fe ff ff 	mov    -0x180(%rbp),%rsi
+  801481:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  801485:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+  801489:	48 89 4e 08          	mov    %rcx,0x8(%rsi)
+  80148d:	eb e1                	jmp    801470 <libc_vsscanf+0xbe1>
+	nassigned = 0;
+  80148f:	44 89 bd a0 fe ff ff 	mov    %r15d,-0x160(%rbp)
+  801496:	e9 7a f5 ff ff       	jmp    800a15 <libc_vsscanf+0x186>
+
+000000000080149b <libc_sscanf>:
+{
+  80149b:	55                   	push   %rbp
+  80149c:	48 89 e5             	mov    %rsp,%rbp
+  80149f:	48 83 ec 50          	sub    $0x50,%rsp
+  8014a3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8014a7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8014ab:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8014af:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+	va_start(ap, fmt);
+  8014b3:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8014ba:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014c2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8014c6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+	ret = libc_vsscanf(ibuf, fmt, ap);
+  8014ca:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8014ce:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8014d5:	00 00 00 
+  8014d8:	ff d0                	call   *%rax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <_start>:
+.globl _start
+_start:
+    // See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  8014dc:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  8014e3:	00 00 00 
+    cmpq %rax, %rsp
+  8014e6:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  8014e9:	75 04                	jne    8014ef <args_exist>
+
+    // If not, push dummy argc/argv arguments.
+    // This happens when we are loaded by the kernel,
+    // because the kernel does not know about passing arguments.
+    // Marking argc and argv as zero.
+    pushq $0
+  8014eb:	6a 00                	push   $0x0
+    pushq $0
+  8014ed:	6a 00                	push   $0x0
+
+00000000008014ef <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  8014ef:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  8014f4:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  8014f8:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  8014fa:	e8 c6 00 00 00       	call   8015c5 <libmain>
+    jmp .
+  8014ff:	eb fe                	jmp    8014ff <args_exist+0x10>
+
+0000000000801501 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  801501:	55                   	push   %rbp
+  801502:	48 89 e5             	mov    %rsp,%rbp
+  801505:	41 57                	push   %r15
+  801507:	41 56                	push   %r14
+  801509:	41 55                	push   %r13
+  80150b:	41 54                	push   %r12
+  80150d:	53                   	push   %rbx
+  80150e:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  801512:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  801519:	00 00 00 
+  80151c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801522:	48 bf c8 5c 80 00 00 	movabs $0x805cc8,%rdi
+  801529:	00 00 00 
+  80152c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801531:	48 ba 3e 17 80 00 00 	movabs $0x80173e,%rdx
+  801538:	00 00 00 
+  80153b:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  801542:	49 bf 39 27 80 00 00 	movabs $0x802739,%r15
+  801549:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  80154c:	49 be 20 80 80 01 00 	movabs $0x1808020,%r14
+  801553:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  801556:	49 bd e8 5c 80 00 00 	movabs $0x805ce8,%r13
+  80155d:	00 00 00 
+  801560:	49 bc 3e 17 80 00 00 	movabs $0x80173e,%r12
+  801567:	00 00 00 
+        sys_yield();
+  80156a:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  80156d:	49 8b 06             	mov    (%r14),%rax
+  801570:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  801576:	89 da                	mov    %ebx,%edx
+  801578:	4c 89 ef             	mov    %r13,%rdi
+  80157b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801580:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  801583:	83 c3 01             	add    $0x1,%ebx
+  801586:	83 fb 05             	cmp    $0x5,%ebx
+  801589:	75 df                	jne    80156a <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80158b:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  801592:	00 00 00 
+  801595:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80159b:	48 bf 18 5d 80 00 00 	movabs $0x805d18,%rdi
+  8015a2:	00 00 00 
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015aa:	48 ba 3e 17 80 00 00 	movabs $0x80173e,%rdx
+  8015b1:	00 00 00 
+  8015b4:	ff d2                	call   *%rdx
+}
+  8015b6:	48 83 c4 08          	add    $0x8,%rsp
+  8015ba:	5b                   	pop    %rbx
+  8015bb:	41 5c                	pop    %r12
+  8015bd:	41 5d                	pop    %r13
+  8015bf:	41 5e                	pop    %r14
+  8015c1:	41 5f                	pop    %r15
+  8015c3:	5d                   	pop    %rbp
+  8015c4:	c3                   	ret
+
+00000000008015c5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8015c5:	55                   	push   %rbp
+  8015c6:	48 89 e5             	mov    %rsp,%rbp
+  8015c9:	41 56                	push   %r14
+  8015cb:	41 55                	push   %r13
+  8015cd:	41 54                	push   %r12
+  8015cf:	53                   	push   %rbx
+  8015d0:	41 89 fd             	mov    %edi,%r13d
+  8015d3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015d6:	48 ba f8 70 80 00 00 	movabs $0x8070f8,%rdx
+  8015dd:	00 00 00 
+  8015e0:	48 b8 f8 70 80 00 00 	movabs $0x8070f8,%rax
+  8015e7:	00 00 00 
+  8015ea:	48 39 c2             	cmp    %rax,%rdx
+  8015ed:	73 17                	jae    801606 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8015ef:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8015f2:	49 89 c4             	mov    %rax,%r12
+  8015f5:	48 83 c3 08          	add    $0x8,%rbx
+  8015f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fe:	ff 53 f8             	call   *-0x8(%rbx)
+  801601:	4c 39 e3             	cmp    %r12,%rbx
+  801604:	72 ef                	jb     8015f5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here DONE
+    thisenv = ((struct Env *)UENVS) + ENVX(sys_getenvid());
+  801606:	48 b8 02 27 80 00 00 	movabs $0x802702,%rax
+  80160d:	00 00 00 
+  801610:	ff d0                	call   *%rax
+  801612:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801617:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80161e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801625:	00 00 00 
+  801628:	48 01 d0             	add    %rdx,%rax
+  80162b:	48 a3 20 80 80 01 00 	movabs %rax,0x1808020
+  801632:	00 00 00 
+
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  801635:	45 85 ed             	test   %r13d,%r13d
+  801638:	7e 0d                	jle    801647 <libmain+0x82>
+  80163a:	49 8b 06             	mov    (%r14),%rax
+  80163d:	48 a3 38 70 80 00 00 	movabs %rax,0x807038
+  801644:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  801647:	4c 89 f6             	mov    %r14,%rsi
+  80164a:	44 89 ef             	mov    %r13d,%edi
+  80164d:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  801654:	00 00 00 
+  801657:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  801659:	48 b8 6e 16 80 00 00 	movabs $0x80166e,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+#endif
+}
+  801665:	5b                   	pop    %rbx
+  801666:	41 5c                	pop    %r12
+  801668:	41 5d                	pop    %r13
+  80166a:	41 5e                	pop    %r14
+  80166c:	5d                   	pop    %rbp
+  80166d:	c3                   	ret
+
+000000000080166e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 10: Uncomment DONE
+    close_all();
+  801672:	48 b8 5e 30 80 00 00 	movabs $0x80305e,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80167e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801683:	48 b8 91 26 80 00 00 	movabs $0x802691,%rax
+  80168a:	00 00 00 
+  80168d:	ff d0                	call   *%rax
+}
+  80168f:	5d                   	pop    %rbp
+  801690:	c3                   	ret
+
+0000000000801691 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  801691:	55                   	push   %rbp
+  801692:	48 89 e5             	mov    %rsp,%rbp
+  801695:	53                   	push   %rbx
+  801696:	48 83 ec 08          	sub    $0x8,%rsp
+  80169a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80169d:	8b 06                	mov    (%rsi),%eax
+  80169f:	8d 50 01             	lea    0x1(%rax),%edx
+  8016a2:	89 16                	mov    %edx,(%rsi)
+  8016a4:	48 98                	cltq
+  8016a6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8016ab:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8016b1:	74 0a                	je     8016bd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8016b3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8016b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016bb:	c9                   	leave
+  8016bc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8016bd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8016c1:	be ff 00 00 00       	mov    $0xff,%esi
+  8016c6:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  8016cd:	00 00 00 
+  8016d0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8016d2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8016d8:	eb d9                	jmp    8016b3 <putch+0x22>
+
+00000000008016da <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8016da:	55                   	push   %rbp
+  8016db:	48 89 e5             	mov    %rsp,%rbp
+  8016de:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8016e5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8016e8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8016ef:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8016f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8016fc:	48 89 f1             	mov    %rsi,%rcx
+  8016ff:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  801706:	48 bf 91 16 80 00 00 	movabs $0x801691,%rdi
+  80170d:	00 00 00 
+  801710:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  801717:	00 00 00 
+  80171a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80171c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801723:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80172a:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801736:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80173c:	c9                   	leave
+  80173d:	c3                   	ret
+
+000000000080173e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80173e:	55                   	push   %rbp
+  80173f:	48 89 e5             	mov    %rsp,%rbp
+  801742:	48 83 ec 50          	sub    $0x50,%rsp
+  801746:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80174a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80174e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801752:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801756:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80175a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801761:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801765:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801769:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80176d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801771:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801775:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  80177c:	00 00 00 
+  80177f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801781:	c9                   	leave
+  801782:	c3                   	ret
+
+0000000000801783 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	41 57                	push   %r15
+  801789:	41 56                	push   %r14
+  80178b:	41 55                	push   %r13
+  80178d:	41 54                	push   %r12
+  80178f:	53                   	push   %rbx
+  801790:	48 83 ec 18          	sub    $0x18,%rsp
+  801794:	49 89 fc             	mov    %rdi,%r12
+  801797:	49 89 f5             	mov    %rsi,%r13
+  80179a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80179e:	8b 45 10             	mov    0x10(%rbp),%eax
+  8017a1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8017a4:	41 89 cf             	mov    %ecx,%r15d
+  8017a7:	4c 39 fa             	cmp    %r15,%rdx
+  8017aa:	73 5b                	jae    801807 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8017ac:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8017b0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8017b4:	85 db                	test   %ebx,%ebx
+  8017b6:	7e 0e                	jle    8017c6 <print_num+0x43>
+            putch(padc, put_arg);
+  8017b8:	4c 89 ee             	mov    %r13,%rsi
+  8017bb:	44 89 f7             	mov    %r14d,%edi
+  8017be:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8017c1:	83 eb 01             	sub    $0x1,%ebx
+  8017c4:	75 f2                	jne    8017b8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8017c6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8017ca:	48 b9 52 5d 80 00 00 	movabs $0x805d52,%rcx
+  8017d1:	00 00 00 
+  8017d4:	48 b8 41 5d 80 00 00 	movabs $0x805d41,%rax
+  8017db:	00 00 00 
+  8017de:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8017e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017eb:	49 f7 f7             	div    %r15
+  8017ee:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8017f2:	4c 89 ee             	mov    %r13,%rsi
+  8017f5:	41 ff d4             	call   *%r12
+}
+  8017f8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8017fc:	5b                   	pop    %rbx
+  8017fd:	41 5c                	pop    %r12
+  8017ff:	41 5d                	pop    %r13
+  801801:	41 5e                	pop    %r14
+  801803:	41 5f                	pop    %r15
+  801805:	5d                   	pop    %rbp
+  801806:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  801807:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80180b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801810:	49 f7 f7             	div    %r15
+  801813:	48 83 ec 08          	sub    $0x8,%rsp
+  801817:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80181b:	52                   	push   %rdx
+  80181c:	45 0f be c9          	movsbl %r9b,%r9d
+  801820:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801824:	48 89 c2             	mov    %rax,%rdx
+  801827:	48 b8 83 17 80 00 00 	movabs $0x801783,%rax
+  80182e:	00 00 00 
+  801831:	ff d0                	call   *%rax
+  801833:	48 83 c4 10          	add    $0x10,%rsp
+  801837:	eb 8d                	jmp    8017c6 <print_num+0x43>
+
+0000000000801839 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801839:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80183d:	48 8b 06             	mov    (%rsi),%rax
+  801840:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801844:	73 0a                	jae    801850 <sprintputch+0x17>
+        *state->start++ = ch;
+  801846:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80184a:	48 89 16             	mov    %rdx,(%rsi)
+  80184d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801850:	c3                   	ret
+
+0000000000801851 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801851:	55                   	push   %rbp
+  801852:	48 89 e5             	mov    %rsp,%rbp
+  801855:	48 83 ec 50          	sub    $0x50,%rsp
+  801859:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80185d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801861:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801865:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80186c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801874:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801878:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80187c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801880:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  801887:	00 00 00 
+  80188a:	ff d0                	call   *%rax
+}
+  80188c:	c9                   	leave
+  80188d:	c3                   	ret
+
+000000000080188e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80188e:	55                   	push   %rbp
+  80188f:	48 89 e5             	mov    %rsp,%rbp
+  801892:	41 57                	push   %r15
+  801894:	41 56                	push   %r14
+  801896:	41 55                	push   %r13
+  801898:	41 54                	push   %r12
+  80189a:	53                   	push   %rbx
+  80189b:	48 83 ec 38          	sub    $0x38,%rsp
+  80189f:	49 89 fe             	mov    %rdi,%r14
+  8018a2:	49 89 f5             	mov    %rsi,%r13
+  8018a5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8018a8:	48 8b 01             	mov    (%rcx),%rax
+  8018ab:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8018af:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8018b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018b7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8018bb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8018bf:	eb 0d                	jmp    8018ce <vprintfmt+0x40>
+            putch(ch, put_arg);
+  8018c1:	40 0f b6 ff          	movzbl %dil,%edi
+  8018c5:	4c 89 ee             	mov    %r13,%rsi
+  8018c8:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8018cb:	4c 89 e3             	mov    %r12,%rbx
+  8018ce:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8018d2:	0f b6 3b             	movzbl (%rbx),%edi
+  8018d5:	40 80 ff 25          	cmp    $0x25,%dil
+  8018d9:	74 14                	je     8018ef <vprintfmt+0x61>
+            if (!ch) return;
+  8018db:	40 84 ff             	test   %dil,%dil
+  8018de:	75 e1                	jne    8018c1 <vprintfmt+0x33>
+}
+  8018e0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8018e4:	5b                   	pop    %rbx
+  8018e5:	41 5c                	pop    %r12
+  8018e7:	41 5d                	pop    %r13
+  8018e9:	41 5e                	pop    %r14
+  8018eb:	41 5f                	pop    %r15
+  8018ed:	5d                   	pop    %rbp
+  8018ee:	c3                   	ret
+        bool altflag = 0, zflag = 0;
+  8018ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8018f4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8018f8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8018fd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801903:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80190a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80190e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  801913:	41 0f b6 04 24       	movzbl (%r12),%eax
+  801918:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80191b:	83 e8 23             	sub    $0x23,%eax
+  80191e:	3c 57                	cmp    $0x57,%al
+  801920:	0f 87 67 06 00 00    	ja     801f8d <vprintfmt+0x6ff>
+  801926:	0f b6 c0             	movzbl %al,%eax
+  801929:	48 b9 e0 5e 80 00 00 	movabs $0x805ee0,%rcx
+  801930:	00 00 00 
+  801933:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  801936:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  801939:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80193d:	eb cf                	jmp    80190e <vprintfmt+0x80>
+        switch (ch = *ufmt++) {
+  80193f:	49 89 dc             	mov    %rbx,%r12
+  801942:	be 01 00 00 00       	mov    $0x1,%esi
+  801947:	eb c5                	jmp    80190e <vprintfmt+0x80>
+            padc = ch;
+  801949:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80194d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801950:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801953:	eb b9                	jmp    80190e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801958:	83 f8 2f             	cmp    $0x2f,%eax
+  80195b:	77 24                	ja     801981 <vprintfmt+0xf3>
+  80195d:	89 c1                	mov    %eax,%ecx
+  80195f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801963:	83 c0 08             	add    $0x8,%eax
+  801966:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801969:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80196c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80196f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801973:	79 99                	jns    80190e <vprintfmt+0x80>
+                width = precision;
+  801975:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801979:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80197f:	eb 8d                	jmp    80190e <vprintfmt+0x80>
+            precision = va_arg(aq, int);
+  801981:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801985:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801989:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80198d:	eb da                	jmp    801969 <vprintfmt+0xdb>
+        switch (ch = *ufmt++) {
+  80198f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801994:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801998:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80199e:	3c 39                	cmp    $0x39,%al
+  8019a0:	77 1c                	ja     8019be <vprintfmt+0x130>
+            for (precision = 0;; ++ufmt) {
+  8019a2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8019a6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8019aa:	0f b6 c0             	movzbl %al,%eax
+  8019ad:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8019b2:	0f b6 03             	movzbl (%rbx),%eax
+  8019b5:	3c 39                	cmp    $0x39,%al
+  8019b7:	76 e9                	jbe    8019a2 <vprintfmt+0x114>
+            for (precision = 0;; ++ufmt) {
+  8019b9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8019bc:	eb b1                	jmp    80196f <vprintfmt+0xe1>
+        switch (ch = *ufmt++) {
+  8019be:	49 89 dc             	mov    %rbx,%r12
+  8019c1:	eb ac                	jmp    80196f <vprintfmt+0xe1>
+            width = MAX(0, width);
+  8019c3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8019c6:	85 c9                	test   %ecx,%ecx
+  8019c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019cd:	0f 49 c1             	cmovns %ecx,%eax
+  8019d0:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8019d3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019d6:	e9 33 ff ff ff       	jmp    80190e <vprintfmt+0x80>
+            lflag++;
+  8019db:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019de:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019e1:	e9 28 ff ff ff       	jmp    80190e <vprintfmt+0x80>
+            lflag--;
+  8019e6:	83 ea 01             	sub    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8019e9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8019ec:	e9 1d ff ff ff       	jmp    80190e <vprintfmt+0x80>
+            putch(va_arg(aq, int), put_arg);
+  8019f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8019f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8019f7:	77 19                	ja     801a12 <vprintfmt+0x184>
+  8019f9:	89 c2                	mov    %eax,%edx
+  8019fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8019ff:	83 c0 08             	add    $0x8,%eax
+  801a02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801a05:	8b 3a                	mov    (%rdx),%edi
+  801a07:	4c 89 ee             	mov    %r13,%rsi
+  801a0a:	41 ff d6             	call   *%r14
+            break;
+  801a0d:	e9 bc fe ff ff       	jmp    8018ce <vprintfmt+0x40>
+            putch(va_arg(aq, int), put_arg);
+  801a12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a1e:	eb e5                	jmp    801a05 <vprintfmt+0x177>
+            int err = va_arg(aq, int);
+  801a20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801a23:	83 f8 2f             	cmp    $0x2f,%eax
+  801a26:	77 5a                	ja     801a82 <vprintfmt+0x1f4>
+  801a28:	89 c2                	mov    %eax,%edx
+  801a2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801a2e:	83 c0 08             	add    $0x8,%eax
+  801a31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  801a34:	8b 02                	mov    (%rdx),%eax
+  801a36:	89 c1                	mov    %eax,%ecx
+  801a38:	f7 d9                	neg    %ecx
+  801a3a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801a3d:	83 f9 13             	cmp    $0x13,%ecx
+  801a40:	7f 4e                	jg     801a90 <vprintfmt+0x202>
+  801a42:	48 63 c1             	movslq %ecx,%rax
+  801a45:	48 ba a0 61 80 00 00 	movabs $0x8061a0,%rdx
+  801a4c:	00 00 00 
+  801a4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801a53:	48 85 c0             	test   %rax,%rax
+  801a56:	74 38                	je     801a90 <vprintfmt+0x202>
+                printfmt(putch, put_arg, "%s", strerr);
+  801a58:	48 89 c1             	mov    %rax,%rcx
+  801a5b:	48 ba 68 63 80 00 00 	movabs $0x806368,%rdx
+  801a62:	00 00 00 
+  801a65:	4c 89 ee             	mov    %r13,%rsi
+  801a68:	4c 89 f7             	mov    %r14,%rdi
+  801a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a70:	49 b8 51 18 80 00 00 	movabs $0x801851,%r8
+  801a77:	00 00 00 
+  801a7a:	41 ff d0             	call   *%r8
+  801a7d:	e9 4c fe ff ff       	jmp    8018ce <vprintfmt+0x40>
+            int err = va_arg(aq, int);
+  801a82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801a86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801a8e:	eb a4                	jmp    801a34 <vprintfmt+0x1a6>
+                printfmt(putch, put_arg, "error %d", err);
+  801a90:	48 ba 6a 5d 80 00 00 	movabs $0x805d6a,%rdx
+  801a97:	00 00 00 
+  801a9a:	4c 89 ee             	mov    %r13,%rsi
+  801a9d:	4c 89 f7             	mov    %r14,%rdi
+  801aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aa5:	49 b8 51 18 80 00 00 	movabs $0x801851,%r8
+  801aac:	00 00 00 
+  801aaf:	41 ff d0             	call   *%r8
+  801ab2:	e9 17 fe ff ff       	jmp    8018ce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801ab7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801aba:	83 f8 2f             	cmp    $0x2f,%eax
+  801abd:	77 6c                	ja     801b2b <vprintfmt+0x29d>
+  801abf:	89 c2                	mov    %eax,%edx
+  801ac1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ac5:	83 c0 08             	add    $0x8,%eax
+  801ac8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801acb:	48 8b 32             	mov    (%rdx),%rsi
+            if (!ptr) ptr = "(null)";
+  801ace:	48 85 f6             	test   %rsi,%rsi
+  801ad1:	48 b8 63 5d 80 00 00 	movabs $0x805d63,%rax
+  801ad8:	00 00 00 
+  801adb:	48 0f 45 c6          	cmovne %rsi,%rax
+  801adf:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801ae3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801ae7:	7e 06                	jle    801aef <vprintfmt+0x261>
+  801ae9:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801aed:	75 4a                	jne    801b39 <vprintfmt+0x2ab>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801aef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801af3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801af7:	0f b6 00             	movzbl (%rax),%eax
+  801afa:	84 c0                	test   %al,%al
+  801afc:	0f 85 9a 00 00 00    	jne    801b9c <vprintfmt+0x30e>
+            while (width-- > 0) putch(' ', put_arg);
+  801b02:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b05:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	0f 8e bd fd ff ff    	jle    8018ce <vprintfmt+0x40>
+  801b11:	4c 89 ee             	mov    %r13,%rsi
+  801b14:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b19:	41 ff d6             	call   *%r14
+  801b1c:	41 83 ec 01          	sub    $0x1,%r12d
+  801b20:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b24:	75 eb                	jne    801b11 <vprintfmt+0x283>
+  801b26:	e9 a3 fd ff ff       	jmp    8018ce <vprintfmt+0x40>
+            const char *ptr = va_arg(aq, char *);
+  801b2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801b2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801b33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801b37:	eb 92                	jmp    801acb <vprintfmt+0x23d>
+                width -= strnlen(ptr, precision);
+  801b39:	49 63 f7             	movslq %r15d,%rsi
+  801b3c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801b40:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  801b47:	00 00 00 
+  801b4a:	ff d0                	call   *%rax
+  801b4c:	48 89 c2             	mov    %rax,%rdx
+  801b4f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b52:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801b54:	8d 50 ff             	lea    -0x1(%rax),%edx
+  801b57:	89 55 ac             	mov    %edx,-0x54(%rbp)
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	7e 91                	jle    801aef <vprintfmt+0x261>
+  801b5e:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801b63:	4c 89 ee             	mov    %r13,%rsi
+  801b66:	44 89 e7             	mov    %r12d,%edi
+  801b69:	41 ff d6             	call   *%r14
+  801b6c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b70:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801b73:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801b76:	75 eb                	jne    801b63 <vprintfmt+0x2d5>
+  801b78:	e9 72 ff ff ff       	jmp    801aef <vprintfmt+0x261>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801b7d:	0f b6 f8             	movzbl %al,%edi
+  801b80:	4c 89 ee             	mov    %r13,%rsi
+  801b83:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801b86:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801b8a:	49 83 c4 01          	add    $0x1,%r12
+  801b8e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801b94:	84 c0                	test   %al,%al
+  801b96:	0f 84 66 ff ff ff    	je     801b02 <vprintfmt+0x274>
+  801b9c:	45 85 ff             	test   %r15d,%r15d
+  801b9f:	78 0a                	js     801bab <vprintfmt+0x31d>
+  801ba1:	41 83 ef 01          	sub    $0x1,%r15d
+  801ba5:	0f 88 57 ff ff ff    	js     801b02 <vprintfmt+0x274>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801bab:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801baf:	74 cc                	je     801b7d <vprintfmt+0x2ef>
+  801bb1:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801bb4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801bb9:	80 fa 5e             	cmp    $0x5e,%dl
+  801bbc:	77 c2                	ja     801b80 <vprintfmt+0x2f2>
+  801bbe:	eb bd                	jmp    801b7d <vprintfmt+0x2ef>
+    if (zflag) return va_arg(*ap, size_t);
+  801bc0:	40 84 f6             	test   %sil,%sil
+  801bc3:	75 26                	jne    801beb <vprintfmt+0x35d>
+    switch (lflag) {
+  801bc5:	85 d2                	test   %edx,%edx
+  801bc7:	74 59                	je     801c22 <vprintfmt+0x394>
+  801bc9:	83 fa 01             	cmp    $0x1,%edx
+  801bcc:	74 7b                	je     801c49 <vprintfmt+0x3bb>
+        return va_arg(*ap, long long);
+  801bce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bd1:	83 f8 2f             	cmp    $0x2f,%eax
+  801bd4:	0f 87 96 00 00 00    	ja     801c70 <vprintfmt+0x3e2>
+  801bda:	89 c2                	mov    %eax,%edx
+  801bdc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801be0:	83 c0 08             	add    $0x8,%eax
+  801be3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801be6:	4c 8b 22             	mov    (%rdx),%r12
+  801be9:	eb 17                	jmp    801c02 <vprintfmt+0x374>
+    if (zflag) return va_arg(*ap, size_t);
+  801beb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801bee:	83 f8 2f             	cmp    $0x2f,%eax
+  801bf1:	77 21                	ja     801c14 <vprintfmt+0x386>
+  801bf3:	89 c2                	mov    %eax,%edx
+  801bf5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801bf9:	83 c0 08             	add    $0x8,%eax
+  801bfc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801bff:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801c02:	4d 85 e4             	test   %r12,%r12
+  801c05:	78 7a                	js     801c81 <vprintfmt+0x3f3>
+            num = i;
+  801c07:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  801c0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801c0f:	e9 56 02 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c20:	eb dd                	jmp    801bff <vprintfmt+0x371>
+        return va_arg(*ap, int);
+  801c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c25:	83 f8 2f             	cmp    $0x2f,%eax
+  801c28:	77 11                	ja     801c3b <vprintfmt+0x3ad>
+  801c2a:	89 c2                	mov    %eax,%edx
+  801c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c30:	83 c0 08             	add    $0x8,%eax
+  801c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c36:	4c 63 22             	movslq (%rdx),%r12
+  801c39:	eb c7                	jmp    801c02 <vprintfmt+0x374>
+  801c3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c47:	eb ed                	jmp    801c36 <vprintfmt+0x3a8>
+        return va_arg(*ap, long);
+  801c49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801c4c:	83 f8 2f             	cmp    $0x2f,%eax
+  801c4f:	77 11                	ja     801c62 <vprintfmt+0x3d4>
+  801c51:	89 c2                	mov    %eax,%edx
+  801c53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801c57:	83 c0 08             	add    $0x8,%eax
+  801c5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801c5d:	4c 8b 22             	mov    (%rdx),%r12
+  801c60:	eb a0                	jmp    801c02 <vprintfmt+0x374>
+  801c62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c6e:	eb ed                	jmp    801c5d <vprintfmt+0x3cf>
+        return va_arg(*ap, long long);
+  801c70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801c74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801c78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801c7c:	e9 65 ff ff ff       	jmp    801be6 <vprintfmt+0x358>
+                putch('-', put_arg);
+  801c81:	4c 89 ee             	mov    %r13,%rsi
+  801c84:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801c89:	41 ff d6             	call   *%r14
+                i = -i;
+  801c8c:	49 f7 dc             	neg    %r12
+  801c8f:	e9 73 ff ff ff       	jmp    801c07 <vprintfmt+0x379>
+    if (zflag) return va_arg(*ap, size_t);
+  801c94:	40 84 f6             	test   %sil,%sil
+  801c97:	75 2e                	jne    801cc7 <vprintfmt+0x439>
+    switch (lflag) {
+  801c99:	85 d2                	test   %edx,%edx
+  801c9b:	7f 59                	jg     801cf6 <vprintfmt+0x468>
+  801c9d:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801ca0:	7d 7a                	jge    801d1c <vprintfmt+0x48e>
+        return va_arg(*ap, unsigned long long);
+  801ca2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ca5:	83 f8 2f             	cmp    $0x2f,%eax
+  801ca8:	0f 87 aa 00 00 00    	ja     801d58 <vprintfmt+0x4ca>
+  801cae:	89 c2                	mov    %eax,%edx
+  801cb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cb4:	83 c0 08             	add    $0x8,%eax
+  801cb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cba:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cbd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801cc2:	e9 a3 01 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801cc7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cca:	83 f8 2f             	cmp    $0x2f,%eax
+  801ccd:	77 19                	ja     801ce8 <vprintfmt+0x45a>
+  801ccf:	89 c2                	mov    %eax,%edx
+  801cd1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801cd5:	83 c0 08             	add    $0x8,%eax
+  801cd8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801cdb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801cde:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ce3:	e9 82 01 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+  801ce8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801cec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801cf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801cf4:	eb e5                	jmp    801cdb <vprintfmt+0x44d>
+    switch (lflag) {
+  801cf6:	83 fa 01             	cmp    $0x1,%edx
+  801cf9:	75 a7                	jne    801ca2 <vprintfmt+0x414>
+        return va_arg(*ap, unsigned long);
+  801cfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801cfe:	83 f8 2f             	cmp    $0x2f,%eax
+  801d01:	77 47                	ja     801d4a <vprintfmt+0x4bc>
+  801d03:	89 c2                	mov    %eax,%edx
+  801d05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d09:	83 c0 08             	add    $0x8,%eax
+  801d0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d0f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801d12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  801d17:	e9 4e 01 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801d1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d1f:	83 f8 2f             	cmp    $0x2f,%eax
+  801d22:	77 18                	ja     801d3c <vprintfmt+0x4ae>
+  801d24:	89 c2                	mov    %eax,%edx
+  801d26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d2a:	83 c0 08             	add    $0x8,%eax
+  801d2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d30:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801d32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801d37:	e9 2e 01 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+  801d3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d48:	eb e6                	jmp    801d30 <vprintfmt+0x4a2>
+        return va_arg(*ap, unsigned long);
+  801d4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d56:	eb b7                	jmp    801d0f <vprintfmt+0x481>
+        return va_arg(*ap, unsigned long long);
+  801d58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801d5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801d60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d64:	e9 51 ff ff ff       	jmp    801cba <vprintfmt+0x42c>
+    if (zflag) return va_arg(*ap, size_t);
+  801d69:	40 84 f6             	test   %sil,%sil
+  801d6c:	75 2e                	jne    801d9c <vprintfmt+0x50e>
+    switch (lflag) {
+  801d6e:	85 d2                	test   %edx,%edx
+  801d70:	7f 59                	jg     801dcb <vprintfmt+0x53d>
+  801d72:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801d75:	7d 77                	jge    801dee <vprintfmt+0x560>
+        return va_arg(*ap, unsigned long long);
+  801d77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d7a:	83 f8 2f             	cmp    $0x2f,%eax
+  801d7d:	0f 87 a4 00 00 00    	ja     801e27 <vprintfmt+0x599>
+  801d83:	89 c2                	mov    %eax,%edx
+  801d85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801d89:	83 c0 08             	add    $0x8,%eax
+  801d8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801d8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801d92:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801d97:	e9 ce 00 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801d9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801d9f:	83 f8 2f             	cmp    $0x2f,%eax
+  801da2:	77 19                	ja     801dbd <vprintfmt+0x52f>
+  801da4:	89 c2                	mov    %eax,%edx
+  801da6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801daa:	83 c0 08             	add    $0x8,%eax
+  801dad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801db0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801db3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801db8:	e9 ad 00 00 00       	jmp    801e6a <vprintfmt+0x5dc>
+  801dbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801dc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801dc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dc9:	eb e5                	jmp    801db0 <vprintfmt+0x522>
+    switch (lflag) {
+  801dcb:	83 fa 01             	cmp    $0x1,%edx
+  801dce:	75 a7                	jne    801d77 <vprintfmt+0x4e9>
+        return va_arg(*ap, unsigned long);
+  801dd0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801dd3:	83 f8 2f             	cmp    $0x2f,%eax
+  801dd6:	77 41                	ja     801e19 <vprintfmt+0x58b>
+  801dd8:	89 c2                	mov    %eax,%edx
+  801dda:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dde:	83 c0 08             	add    $0x8,%eax
+  801de1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801de4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801de7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801dec:	eb 7c                	jmp    801e6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801dee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801df1:	83 f8 2f             	cmp    $0x2f,%eax
+  801df4:	77 15                	ja     801e0b <vprintfmt+0x57d>
+  801df6:	89 c2                	mov    %eax,%edx
+  801df8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801dfc:	83 c0 08             	add    $0x8,%eax
+  801dff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e02:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801e04:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801e09:	eb 5f                	jmp    801e6a <vprintfmt+0x5dc>
+  801e0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e17:	eb e9                	jmp    801e02 <vprintfmt+0x574>
+        return va_arg(*ap, unsigned long);
+  801e19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e25:	eb bd                	jmp    801de4 <vprintfmt+0x556>
+        return va_arg(*ap, unsigned long long);
+  801e27:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801e2b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801e2f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801e33:	e9 57 ff ff ff       	jmp    801d8f <vprintfmt+0x501>
+            putch('0', put_arg);
+  801e38:	4c 89 ee             	mov    %r13,%rsi
+  801e3b:	bf 30 00 00 00       	mov    $0x30,%edi
+  801e40:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801e43:	4c 89 ee             	mov    %r13,%rsi
+  801e46:	bf 78 00 00 00       	mov    $0x78,%edi
+  801e4b:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801e4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801e51:	83 f8 2f             	cmp    $0x2f,%eax
+  801e54:	77 47                	ja     801e9d <vprintfmt+0x60f>
+  801e56:	89 c2                	mov    %eax,%edx
+  801e58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801e5c:	83 c0 08             	add    $0x8,%eax
+  801e5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801e62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801e65:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  801e6e:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801e72:	0f 94 c0             	sete   %al
+  801e75:	0f b6 c0             	movzbl %al,%eax
+  801e78:	50                   	push   %rax
+  801e79:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801e7e:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801e82:	4c 89 ee             	mov    %r13,%rsi
+  801e85:	4c 89 f7             	mov    %r14,%rdi
+  801e88:	48 b8 83 17 80 00 00 	movabs $0x801783,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+            break;
+  801e94:	48 83 c4 10          	add    $0x10,%rsp
+  801e98:	e9 31 fa ff ff       	jmp    8018ce <vprintfmt+0x40>
+            num = (uintptr_t)va_arg(aq, void *);
+  801e9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801ea1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801ea5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801ea9:	eb b7                	jmp    801e62 <vprintfmt+0x5d4>
+    if (zflag) return va_arg(*ap, size_t);
+  801eab:	40 84 f6             	test   %sil,%sil
+  801eae:	75 2b                	jne    801edb <vprintfmt+0x64d>
+    switch (lflag) {
+  801eb0:	85 d2                	test   %edx,%edx
+  801eb2:	7f 56                	jg     801f0a <vprintfmt+0x67c>
+  801eb4:	83 fa fe             	cmp    $0xfffffffe,%edx
+  801eb7:	7d 77                	jge    801f30 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801eb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ebc:	83 f8 2f             	cmp    $0x2f,%eax
+  801ebf:	0f 87 a7 00 00 00    	ja     801f6c <vprintfmt+0x6de>
+  801ec5:	89 c2                	mov    %eax,%edx
+  801ec7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ecb:	83 c0 08             	add    $0x8,%eax
+  801ece:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801ed1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ed4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801ed9:	eb 8f                	jmp    801e6a <vprintfmt+0x5dc>
+    if (zflag) return va_arg(*ap, size_t);
+  801edb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801ede:	83 f8 2f             	cmp    $0x2f,%eax
+  801ee1:	77 19                	ja     801efc <vprintfmt+0x66e>
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801ee9:	83 c0 08             	add    $0x8,%eax
+  801eec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801eef:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801ef2:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801ef7:	e9 6e ff ff ff       	jmp    801e6a <vprintfmt+0x5dc>
+  801efc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f08:	eb e5                	jmp    801eef <vprintfmt+0x661>
+    switch (lflag) {
+  801f0a:	83 fa 01             	cmp    $0x1,%edx
+  801f0d:	75 aa                	jne    801eb9 <vprintfmt+0x62b>
+        return va_arg(*ap, unsigned long);
+  801f0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f12:	83 f8 2f             	cmp    $0x2f,%eax
+  801f15:	77 47                	ja     801f5e <vprintfmt+0x6d0>
+  801f17:	89 c2                	mov    %eax,%edx
+  801f19:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f1d:	83 c0 08             	add    $0x8,%eax
+  801f20:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f23:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801f26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801f2b:	e9 3a ff ff ff       	jmp    801e6a <vprintfmt+0x5dc>
+        return va_arg(*ap, unsigned int);
+  801f30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801f33:	83 f8 2f             	cmp    $0x2f,%eax
+  801f36:	77 18                	ja     801f50 <vprintfmt+0x6c2>
+  801f38:	89 c2                	mov    %eax,%edx
+  801f3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801f3e:	83 c0 08             	add    $0x8,%eax
+  801f41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801f44:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  801f46:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801f4b:	e9 1a ff ff ff       	jmp    801e6a <vprintfmt+0x5dc>
+  801f50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f5c:	eb e6                	jmp    801f44 <vprintfmt+0x6b6>
+        return va_arg(*ap, unsigned long);
+  801f5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f62:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f6a:	eb b7                	jmp    801f23 <vprintfmt+0x695>
+        return va_arg(*ap, unsigned long long);
+  801f6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801f70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801f74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801f78:	e9 54 ff ff ff       	jmp    801ed1 <vprintfmt+0x643>
+            putch(ch, put_arg);
+  801f7d:	4c 89 ee             	mov    %r13,%rsi
+  801f80:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f85:	41 ff d6             	call   *%r14
+            break;
+  801f88:	e9 41 f9 ff ff       	jmp    8018ce <vprintfmt+0x40>
+            putch('%', put_arg);
+  801f8d:	4c 89 ee             	mov    %r13,%rsi
+  801f90:	bf 25 00 00 00       	mov    $0x25,%edi
+  801f95:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801f98:	48 83 eb 01          	sub    $0x1,%rbx
+  801f9c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801fa0:	75 f6                	jne    801f98 <vprintfmt+0x70a>
+  801fa2:	e9 27 f9 ff ff       	jmp    8018ce <vprintfmt+0x40>
+
+0000000000801fa7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801fa7:	55                   	push   %rbp
+  801fa8:	48 89 e5             	mov    %rsp,%rbp
+  801fab:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801faf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801fb3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801fb8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801fbc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801fc3:	48 85 ff             	test   %rdi,%rdi
+  801fc6:	74 2b                	je     801ff3 <vsnprintf+0x4c>
+  801fc8:	48 85 f6             	test   %rsi,%rsi
+  801fcb:	74 26                	je     801ff3 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801fcd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fd1:	48 bf 39 18 80 00 00 	movabs $0x801839,%rdi
+  801fd8:	00 00 00 
+  801fdb:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  801fe2:	00 00 00 
+  801fe5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801feb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801fee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801ff1:	c9                   	leave
+  801ff2:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801ff3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff8:	eb f7                	jmp    801ff1 <vsnprintf+0x4a>
+
+0000000000801ffa <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	48 83 ec 50          	sub    $0x50,%rsp
+  802002:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802006:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80200a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80200e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  802015:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  802019:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80201d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  802021:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  802025:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  802029:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  802030:	00 00 00 
+  802033:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+0000000000802037 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  802037:	80 3f 00             	cmpb   $0x0,(%rdi)
+  80203a:	74 10                	je     80204c <strlen+0x15>
+    size_t n = 0;
+  80203c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  802041:	48 83 c0 01          	add    $0x1,%rax
+  802045:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  802049:	75 f6                	jne    802041 <strlen+0xa>
+  80204b:	c3                   	ret
+    size_t n = 0;
+  80204c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  802051:	c3                   	ret
+
+0000000000802052 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  802052:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  802055:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80205a:	48 85 f6             	test   %rsi,%rsi
+  80205d:	74 11                	je     802070 <strnlen+0x1e>
+  80205f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  802063:	74 0c                	je     802071 <strnlen+0x1f>
+  802065:	48 83 c2 01          	add    $0x1,%rdx
+  802069:	48 39 d0             	cmp    %rdx,%rax
+  80206c:	75 f1                	jne    80205f <strnlen+0xd>
+  80206e:	eb 04                	jmp    802074 <strnlen+0x22>
+  802070:	c3                   	ret
+  802071:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  802074:	c3                   	ret
+
+0000000000802075 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  802075:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  802078:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  802081:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  802084:	48 83 c2 01          	add    $0x1,%rdx
+  802088:	84 c9                	test   %cl,%cl
+  80208a:	75 f1                	jne    80207d <strcpy+0x8>
+        ;
+    return res;
+}
+  80208c:	c3                   	ret
+
+000000000080208d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80208d:	55                   	push   %rbp
+  80208e:	48 89 e5             	mov    %rsp,%rbp
+  802091:	41 54                	push   %r12
+  802093:	53                   	push   %rbx
+  802094:	48 89 fb             	mov    %rdi,%rbx
+  802097:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80209a:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  8020a1:	00 00 00 
+  8020a4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8020a6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8020aa:	4c 89 e6             	mov    %r12,%rsi
+  8020ad:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  8020b4:	00 00 00 
+  8020b7:	ff d0                	call   *%rax
+    return dst;
+}
+  8020b9:	48 89 d8             	mov    %rbx,%rax
+  8020bc:	5b                   	pop    %rbx
+  8020bd:	41 5c                	pop    %r12
+  8020bf:	5d                   	pop    %rbp
+  8020c0:	c3                   	ret
+
+00000000008020c1 <toupper>:
+
+int
+toupper(int ch) {
+  8020c1:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'a' && ch <= 'z')) return ch;
+  8020c3:	8d 4f 9f             	lea    -0x61(%rdi),%ecx
+    else return ch + 'A' - 'a';
+  8020c6:	8d 57 e0             	lea    -0x20(%rdi),%edx
+  8020c9:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020cc:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020cf:	c3                   	ret
+
+00000000008020d0 <tolower>:
+
+int
+tolower(int ch) {
+  8020d0:	89 f8                	mov    %edi,%eax
+    if (!(ch >= 'A' && ch <= 'Z')) return ch;
+  8020d2:	8d 4f bf             	lea    -0x41(%rdi),%ecx
+    else return ch - ('A' - 'a');
+  8020d5:	8d 57 20             	lea    0x20(%rdi),%edx
+  8020d8:	83 f9 1a             	cmp    $0x1a,%ecx
+  8020db:	0f 42 c2             	cmovb  %edx,%eax
+}
+  8020de:	c3                   	ret
+
+00000000008020df <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8020df:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8020e2:	48 85 d2             	test   %rdx,%rdx
+  8020e5:	74 1f                	je     802106 <strncpy+0x27>
+  8020e7:	48 01 fa             	add    %rdi,%rdx
+  8020ea:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8020ed:	48 83 c1 01          	add    $0x1,%rcx
+  8020f1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8020f5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8020f9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8020fd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  802101:	48 39 ca             	cmp    %rcx,%rdx
+  802104:	75 e7                	jne    8020ed <strncpy+0xe>
+    }
+    return ret;
+}
+  802106:	c3                   	ret
+
+0000000000802107 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  802107:	48 89 f8             	mov    %rdi,%rax
+  80210a:	48 85 d2             	test   %rdx,%rdx
+  80210d:	74 24                	je     802133 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80210f:	48 83 ea 01          	sub    $0x1,%rdx
+  802113:	74 1b                	je     802130 <strlcpy+0x29>
+  802115:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  802119:	0f b6 16             	movzbl (%rsi),%edx
+  80211c:	84 d2                	test   %dl,%dl
+  80211e:	74 10                	je     802130 <strlcpy+0x29>
+            *dst++ = *src++;
+  802120:	48 83 c6 01          	add    $0x1,%rsi
+  802124:	48 83 c0 01          	add    $0x1,%rax
+  802128:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80212b:	48 39 c8             	cmp    %rcx,%rax
+  80212e:	75 e9                	jne    802119 <strlcpy+0x12>
+        *dst = '\0';
+  802130:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  802133:	48 29 f8             	sub    %rdi,%rax
+}
+  802136:	c3                   	ret
+
+0000000000802137 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  802137:	0f b6 07             	movzbl (%rdi),%eax
+  80213a:	84 c0                	test   %al,%al
+  80213c:	74 13                	je     802151 <strcmp+0x1a>
+  80213e:	38 06                	cmp    %al,(%rsi)
+  802140:	75 0f                	jne    802151 <strcmp+0x1a>
+  802142:	48 83 c7 01          	add    $0x1,%rdi
+  802146:	48 83 c6 01          	add    $0x1,%rsi
+  80214a:	0f b6 07             	movzbl (%rdi),%eax
+  80214d:	84 c0                	test   %al,%al
+  80214f:	75 ed                	jne    80213e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802151:	0f b6 c0             	movzbl %al,%eax
+  802154:	0f b6 16             	movzbl (%rsi),%edx
+  802157:	29 d0                	sub    %edx,%eax
+}
+  802159:	c3                   	ret
+
+000000000080215a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80215a:	48 85 d2             	test   %rdx,%rdx
+  80215d:	74 1f                	je     80217e <strncmp+0x24>
+  80215f:	0f b6 07             	movzbl (%rdi),%eax
+  802162:	84 c0                	test   %al,%al
+  802164:	74 1e                	je     802184 <strncmp+0x2a>
+  802166:	3a 06                	cmp    (%rsi),%al
+  802168:	75 1a                	jne    802184 <strncmp+0x2a>
+  80216a:	48 83 c7 01          	add    $0x1,%rdi
+  80216e:	48 83 c6 01          	add    $0x1,%rsi
+  802172:	48 83 ea 01          	sub    $0x1,%rdx
+  802176:	75 e7                	jne    80215f <strncmp+0x5>
+
+    if (!n) return 0;
+  802178:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217d:	c3                   	ret
+  80217e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802183:	c3                   	ret
+  802184:	48 85 d2             	test   %rdx,%rdx
+  802187:	74 09                	je     802192 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802189:	0f b6 07             	movzbl (%rdi),%eax
+  80218c:	0f b6 16             	movzbl (%rsi),%edx
+  80218f:	29 d0                	sub    %edx,%eax
+  802191:	c3                   	ret
+    if (!n) return 0;
+  802192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802197:	c3                   	ret
+
+0000000000802198 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  802198:	0f b6 17             	movzbl (%rdi),%edx
+  80219b:	84 d2                	test   %dl,%dl
+  80219d:	74 18                	je     8021b7 <strchr+0x1f>
+        if (*str == c) {
+  80219f:	0f be d2             	movsbl %dl,%edx
+  8021a2:	39 f2                	cmp    %esi,%edx
+  8021a4:	74 17                	je     8021bd <strchr+0x25>
+    for (; *str; str++) {
+  8021a6:	48 83 c7 01          	add    $0x1,%rdi
+  8021aa:	0f b6 17             	movzbl (%rdi),%edx
+  8021ad:	84 d2                	test   %dl,%dl
+  8021af:	75 ee                	jne    80219f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	c3                   	ret
+  8021b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021bc:	c3                   	ret
+  8021bd:	48 89 f8             	mov    %rdi,%rax
+}
+  8021c0:	c3                   	ret
+
+00000000008021c1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8021c1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8021c4:	0f b6 17             	movzbl (%rdi),%edx
+  8021c7:	84 d2                	test   %dl,%dl
+  8021c9:	74 13                	je     8021de <strfind+0x1d>
+  8021cb:	0f be d2             	movsbl %dl,%edx
+  8021ce:	39 f2                	cmp    %esi,%edx
+  8021d0:	74 0b                	je     8021dd <strfind+0x1c>
+  8021d2:	48 83 c0 01          	add    $0x1,%rax
+  8021d6:	0f b6 10             	movzbl (%rax),%edx
+  8021d9:	84 d2                	test   %dl,%dl
+  8021db:	75 ee                	jne    8021cb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8021dd:	c3                   	ret
+  8021de:	c3                   	ret
+
+00000000008021df <strcasecmp>:
+strcasecmp(const char *s1, const char *s2) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  8021df:	48 39 f7             	cmp    %rsi,%rdi
+  8021e2:	74 65                	je     802249 <strcasecmp+0x6a>
+strcasecmp(const char *s1, const char *s2) {
+  8021e4:	55                   	push   %rbp
+  8021e5:	48 89 e5             	mov    %rsp,%rbp
+  8021e8:	41 57                	push   %r15
+  8021ea:	41 56                	push   %r14
+  8021ec:	41 55                	push   %r13
+  8021ee:	41 54                	push   %r12
+  8021f0:	53                   	push   %rbx
+  8021f1:	48 83 ec 18          	sub    $0x18,%rsp
+  8021f5:	48 89 fb             	mov    %rdi,%rbx
+  8021f8:	49 89 f4             	mov    %rsi,%r12
+
+    while ((result = tolower (*p1) - tolower (*p2)) == 0) {
+  8021fb:	49 bf d0 20 80 00 00 	movabs $0x8020d0,%r15
+  802202:	00 00 00 
+  802205:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  802209:	41 0f b6 fd          	movzbl %r13b,%edi
+  80220d:	41 ff d7             	call   *%r15
+  802210:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802213:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802218:	41 0f b6 fe          	movzbl %r14b,%edi
+  80221c:	41 ff d7             	call   *%r15
+  80221f:	89 c2                	mov    %eax,%edx
+  802221:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802224:	29 d0                	sub    %edx,%eax
+  802226:	75 12                	jne    80223a <strcasecmp+0x5b>
+        if (*p1++ == '\0') break;
+  802228:	48 83 c3 01          	add    $0x1,%rbx
+  80222c:	45 84 ed             	test   %r13b,%r13b
+  80222f:	74 09                	je     80223a <strcasecmp+0x5b>
+        if (*p2++ == '\0') break;
+  802231:	49 83 c4 01          	add    $0x1,%r12
+  802235:	45 84 f6             	test   %r14b,%r14b
+  802238:	75 cb                	jne    802205 <strcasecmp+0x26>
+    }
+
+    return result;
+}
+  80223a:	48 83 c4 18          	add    $0x18,%rsp
+  80223e:	5b                   	pop    %rbx
+  80223f:	41 5c                	pop    %r12
+  802241:	41 5d                	pop    %r13
+  802243:	41 5e                	pop    %r14
+  802245:	41 5f                	pop    %r15
+  802247:	5d                   	pop    %rbp
+  802248:	c3                   	ret
+    if (p1 == p2) return 0;
+  802249:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80224e:	c3                   	ret
+
+000000000080224f <strncasecmp>:
+strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *p1 = (const unsigned char *) s1;
+    const unsigned char *p2 = (const unsigned char *) s2;
+    int result;
+
+    if (p1 == p2) return 0;
+  80224f:	48 39 f7             	cmp    %rsi,%rdi
+  802252:	74 7d                	je     8022d1 <strncasecmp+0x82>
+strncasecmp(const char *s1, const char *s2, size_t n) {
+  802254:	55                   	push   %rbp
+  802255:	48 89 e5             	mov    %rsp,%rbp
+  802258:	41 57                	push   %r15
+  80225a:	41 56                	push   %r14
+  80225c:	41 55                	push   %r13
+  80225e:	41 54                	push   %r12
+  802260:	53                   	push   %rbx
+  802261:	48 83 ec 18          	sub    $0x18,%rsp
+  802265:	48 89 fb             	mov    %rdi,%rbx
+  802268:	49 89 f4             	mov    %rsi,%r12
+  80226b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+  80226f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+
+    while (n--) {
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802273:	49 bf d0 20 80 00 00 	movabs $0x8020d0,%r15
+  80227a:	00 00 00 
+    while (n--) {
+  80227d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802281:	48 39 c3             	cmp    %rax,%rbx
+  802284:	74 37                	je     8022bd <strncasecmp+0x6e>
+        if((result = (tolower (*p1) - tolower (*p2))) != 0) break;
+  802286:	44 0f b6 2b          	movzbl (%rbx),%r13d
+  80228a:	41 0f b6 fd          	movzbl %r13b,%edi
+  80228e:	41 ff d7             	call   *%r15
+  802291:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  802294:	45 0f b6 34 24       	movzbl (%r12),%r14d
+  802299:	41 0f b6 fe          	movzbl %r14b,%edi
+  80229d:	41 ff d7             	call   *%r15
+  8022a0:	89 c2                	mov    %eax,%edx
+  8022a2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022a5:	29 d0                	sub    %edx,%eax
+  8022a7:	75 19                	jne    8022c2 <strncasecmp+0x73>
+
+        if (*p1++ == '\0') break;
+  8022a9:	48 83 c3 01          	add    $0x1,%rbx
+  8022ad:	45 84 ed             	test   %r13b,%r13b
+  8022b0:	74 10                	je     8022c2 <strncasecmp+0x73>
+        if (*p2++ == '\0') break;
+  8022b2:	49 83 c4 01          	add    $0x1,%r12
+  8022b6:	45 84 f6             	test   %r14b,%r14b
+  8022b9:	75 c2                	jne    80227d <strncasecmp+0x2e>
+  8022bb:	eb 05                	jmp    8022c2 <strncasecmp+0x73>
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+
+    return result;
+}
+  8022c2:	48 83 c4 18          	add    $0x18,%rsp
+  8022c6:	5b                   	pop    %rbx
+  8022c7:	41 5c                	pop    %r12
+  8022c9:	41 5d                	pop    %r13
+  8022cb:	41 5e                	pop    %r14
+  8022cd:	41 5f                	pop    %r15
+  8022cf:	5d                   	pop    %rbp
+  8022d0:	c3                   	ret
+    if (p1 == p2) return 0;
+  8022d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022d6:	c3                   	ret
+
+00000000008022d7 <isalpha>:
+
+bool
+isalpha(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+  8022d7:	83 e7 df             	and    $0xffffffdf,%edi
+  8022da:	83 ef 41             	sub    $0x41,%edi
+  8022dd:	83 ff 19             	cmp    $0x19,%edi
+  8022e0:	0f 96 c0             	setbe  %al
+}
+  8022e3:	c3                   	ret
+
+00000000008022e4 <isspace>:
+
+bool
+isspace(int c)
+{
+    return c == ' ' || c == '\t';
+  8022e4:	83 ff 20             	cmp    $0x20,%edi
+  8022e7:	0f 94 c0             	sete   %al
+  8022ea:	83 ff 09             	cmp    $0x9,%edi
+  8022ed:	0f 94 c2             	sete   %dl
+  8022f0:	09 d0                	or     %edx,%eax
+}
+  8022f2:	c3                   	ret
+
+00000000008022f3 <ispunct>:
+
+bool
+ispunct(int c)
+{
+  8022f3:	55                   	push   %rbp
+  8022f4:	48 89 e5             	mov    %rsp,%rbp
+  8022f7:	89 fe                	mov    %edi,%esi
+    static const char *punct = ".;!?...";
+    return strchr(punct, c) == NULL ? false : true;
+  8022f9:	48 bf 5f 62 80 00 00 	movabs $0x80625f,%rdi
+  802300:	00 00 00 
+  802303:	48 b8 98 21 80 00 00 	movabs $0x802198,%rax
+  80230a:	00 00 00 
+  80230d:	ff d0                	call   *%rax
+  80230f:	48 85 c0             	test   %rax,%rax
+  802312:	0f 95 c0             	setne  %al
+}
+  802315:	5d                   	pop    %rbp
+  802316:	c3                   	ret
+
+0000000000802317 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  802317:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80231a:	48 89 f8             	mov    %rdi,%rax
+  80231d:	48 f7 d8             	neg    %rax
+  802320:	83 e0 07             	and    $0x7,%eax
+  802323:	49 89 d1             	mov    %rdx,%r9
+  802326:	49 29 c1             	sub    %rax,%r9
+  802329:	78 36                	js     802361 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80232b:	40 0f b6 c6          	movzbl %sil,%eax
+  80232f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  802336:	01 01 01 
+  802339:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80233d:	40 f6 c7 07          	test   $0x7,%dil
+  802341:	75 38                	jne    80237b <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  802343:	4c 89 c9             	mov    %r9,%rcx
+  802346:	48 c1 f9 03          	sar    $0x3,%rcx
+  80234a:	74 0c                	je     802358 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80234c:	fc                   	cld
+  80234d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  802350:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  802354:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  802358:	4d 85 c9             	test   %r9,%r9
+  80235b:	75 45                	jne    8023a2 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80235d:	4c 89 c0             	mov    %r8,%rax
+  802360:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  802361:	48 85 d2             	test   %rdx,%rdx
+  802364:	74 f7                	je     80235d <memset+0x46>
+  802366:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  802369:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80236c:	48 83 c0 01          	add    $0x1,%rax
+  802370:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  802374:	48 39 c2             	cmp    %rax,%rdx
+  802377:	75 f3                	jne    80236c <memset+0x55>
+  802379:	eb e2                	jmp    80235d <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80237b:	40 f6 c7 01          	test   $0x1,%dil
+  80237f:	74 06                	je     802387 <memset+0x70>
+  802381:	88 07                	mov    %al,(%rdi)
+  802383:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  802387:	40 f6 c7 02          	test   $0x2,%dil
+  80238b:	74 07                	je     802394 <memset+0x7d>
+  80238d:	66 89 07             	mov    %ax,(%rdi)
+  802390:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  802394:	40 f6 c7 04          	test   $0x4,%dil
+  802398:	74 a9                	je     802343 <memset+0x2c>
+  80239a:	89 07                	mov    %eax,(%rdi)
+  80239c:	48 83 c7 04          	add    $0x4,%rdi
+  8023a0:	eb a1                	jmp    802343 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8023a2:	41 f6 c1 04          	test   $0x4,%r9b
+  8023a6:	74 06                	je     8023ae <memset+0x97>
+  8023a8:	89 07                	mov    %eax,(%rdi)
+  8023aa:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8023ae:	41 f6 c1 02          	test   $0x2,%r9b
+  8023b2:	74 07                	je     8023bb <memset+0xa4>
+  8023b4:	66 89 07             	mov    %ax,(%rdi)
+  8023b7:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8023bb:	41 f6 c1 01          	test   $0x1,%r9b
+  8023bf:	74 9c                	je     80235d <memset+0x46>
+  8023c1:	88 07                	mov    %al,(%rdi)
+  8023c3:	eb 98                	jmp    80235d <memset+0x46>
+
+00000000008023c5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8023c5:	48 89 f8             	mov    %rdi,%rax
+  8023c8:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8023cb:	48 39 fe             	cmp    %rdi,%rsi
+  8023ce:	73 3b                	jae    80240b <memmove+0x46>
+  8023d0:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8023d4:	48 39 d7             	cmp    %rdx,%rdi
+  8023d7:	73 32                	jae    80240b <memmove+0x46>
+        s += n;
+        d += n;
+  8023d9:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8023dd:	48 89 d6             	mov    %rdx,%rsi
+  8023e0:	48 09 fe             	or     %rdi,%rsi
+  8023e3:	48 09 ce             	or     %rcx,%rsi
+  8023e6:	40 f6 c6 07          	test   $0x7,%sil
+  8023ea:	75 12                	jne    8023fe <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8023ec:	48 83 ef 08          	sub    $0x8,%rdi
+  8023f0:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8023f4:	48 c1 e9 03          	shr    $0x3,%rcx
+  8023f8:	fd                   	std
+  8023f9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8023fc:	fc                   	cld
+  8023fd:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8023fe:	48 83 ef 01          	sub    $0x1,%rdi
+  802402:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  802406:	fd                   	std
+  802407:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802409:	eb f1                	jmp    8023fc <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80240b:	48 89 f2             	mov    %rsi,%rdx
+  80240e:	48 09 c2             	or     %rax,%rdx
+  802411:	48 09 ca             	or     %rcx,%rdx
+  802414:	f6 c2 07             	test   $0x7,%dl
+  802417:	75 0c                	jne    802425 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  802419:	48 c1 e9 03          	shr    $0x3,%rcx
+  80241d:	48 89 c7             	mov    %rax,%rdi
+  802420:	fc                   	cld
+  802421:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802424:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  802425:	48 89 c7             	mov    %rax,%rdi
+  802428:	fc                   	cld
+  802429:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80242b:	c3                   	ret
+
+000000000080242c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  802430:	48 b8 c5 23 80 00 00 	movabs $0x8023c5,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+}
+  80243c:	5d                   	pop    %rbp
+  80243d:	c3                   	ret
+
+000000000080243e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80243e:	55                   	push   %rbp
+  80243f:	48 89 e5             	mov    %rsp,%rbp
+  802442:	41 57                	push   %r15
+  802444:	41 56                	push   %r14
+  802446:	41 55                	push   %r13
+  802448:	41 54                	push   %r12
+  80244a:	53                   	push   %rbx
+  80244b:	48 83 ec 08          	sub    $0x8,%rsp
+  80244f:	49 89 fe             	mov    %rdi,%r14
+  802452:	49 89 f7             	mov    %rsi,%r15
+  802455:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  802458:	48 89 f7             	mov    %rsi,%rdi
+  80245b:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  802462:	00 00 00 
+  802465:	ff d0                	call   *%rax
+  802467:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80246a:	48 89 de             	mov    %rbx,%rsi
+  80246d:	4c 89 f7             	mov    %r14,%rdi
+  802470:	48 b8 52 20 80 00 00 	movabs $0x802052,%rax
+  802477:	00 00 00 
+  80247a:	ff d0                	call   *%rax
+  80247c:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80247f:	48 39 c3             	cmp    %rax,%rbx
+  802482:	74 36                	je     8024ba <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  802484:	48 89 d8             	mov    %rbx,%rax
+  802487:	4c 29 e8             	sub    %r13,%rax
+  80248a:	49 39 c4             	cmp    %rax,%r12
+  80248d:	73 31                	jae    8024c0 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80248f:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  802494:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  802498:	4c 89 fe             	mov    %r15,%rsi
+  80249b:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8024a7:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8024ab:	48 83 c4 08          	add    $0x8,%rsp
+  8024af:	5b                   	pop    %rbx
+  8024b0:	41 5c                	pop    %r12
+  8024b2:	41 5d                	pop    %r13
+  8024b4:	41 5e                	pop    %r14
+  8024b6:	41 5f                	pop    %r15
+  8024b8:	5d                   	pop    %rbp
+  8024b9:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8024ba:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8024be:	eb eb                	jmp    8024ab <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8024c0:	48 83 eb 01          	sub    $0x1,%rbx
+  8024c4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8024c8:	48 89 da             	mov    %rbx,%rdx
+  8024cb:	4c 89 fe             	mov    %r15,%rsi
+  8024ce:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8024d5:	00 00 00 
+  8024d8:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8024da:	49 01 de             	add    %rbx,%r14
+  8024dd:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8024e2:	eb c3                	jmp    8024a7 <strlcat+0x69>
+
+00000000008024e4 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8024e4:	48 85 d2             	test   %rdx,%rdx
+  8024e7:	74 2d                	je     802516 <memcmp+0x32>
+  8024e9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8024ee:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8024f2:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8024f7:	44 38 c1             	cmp    %r8b,%cl
+  8024fa:	75 0f                	jne    80250b <memcmp+0x27>
+    while (n-- > 0) {
+  8024fc:	48 83 c0 01          	add    $0x1,%rax
+  802500:	48 39 c2             	cmp    %rax,%rdx
+  802503:	75 e9                	jne    8024ee <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  802505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80250b:	0f b6 c1             	movzbl %cl,%eax
+  80250e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  802512:	44 29 c0             	sub    %r8d,%eax
+  802515:	c3                   	ret
+    return 0;
+  802516:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80251b:	c3                   	ret
+
+000000000080251c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80251c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  802520:	48 39 c7             	cmp    %rax,%rdi
+  802523:	73 0f                	jae    802534 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  802525:	40 38 37             	cmp    %sil,(%rdi)
+  802528:	74 0e                	je     802538 <memfind+0x1c>
+    for (; src < end; src++) {
+  80252a:	48 83 c7 01          	add    $0x1,%rdi
+  80252e:	48 39 f8             	cmp    %rdi,%rax
+  802531:	75 f2                	jne    802525 <memfind+0x9>
+  802533:	c3                   	ret
+  802534:	48 89 f8             	mov    %rdi,%rax
+  802537:	c3                   	ret
+  802538:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80253b:	c3                   	ret
+
+000000000080253c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80253c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80253f:	0f b6 37             	movzbl (%rdi),%esi
+  802542:	40 80 fe 20          	cmp    $0x20,%sil
+  802546:	74 06                	je     80254e <strtol+0x12>
+  802548:	40 80 fe 09          	cmp    $0x9,%sil
+  80254c:	75 13                	jne    802561 <strtol+0x25>
+  80254e:	48 83 c7 01          	add    $0x1,%rdi
+  802552:	0f b6 37             	movzbl (%rdi),%esi
+  802555:	40 80 fe 20          	cmp    $0x20,%sil
+  802559:	74 f3                	je     80254e <strtol+0x12>
+  80255b:	40 80 fe 09          	cmp    $0x9,%sil
+  80255f:	74 ed                	je     80254e <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  802561:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  802564:	83 e0 fd             	and    $0xfffffffd,%eax
+  802567:	3c 01                	cmp    $0x1,%al
+  802569:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80256d:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  802573:	75 0f                	jne    802584 <strtol+0x48>
+  802575:	80 3f 30             	cmpb   $0x30,(%rdi)
+  802578:	74 14                	je     80258e <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80257a:	85 d2                	test   %edx,%edx
+  80257c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802581:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  802589:	4c 63 ca             	movslq %edx,%r9
+  80258c:	eb 36                	jmp    8025c4 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80258e:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  802592:	74 0f                	je     8025a3 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  802594:	85 d2                	test   %edx,%edx
+  802596:	75 ec                	jne    802584 <strtol+0x48>
+        s++;
+  802598:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80259c:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8025a1:	eb e1                	jmp    802584 <strtol+0x48>
+        s += 2;
+  8025a3:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8025a7:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8025ac:	eb d6                	jmp    802584 <strtol+0x48>
+            dig -= '0';
+  8025ae:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8025b1:	44 0f b6 c1          	movzbl %cl,%r8d
+  8025b5:	41 39 d0             	cmp    %edx,%r8d
+  8025b8:	7d 21                	jge    8025db <strtol+0x9f>
+        val = val * base + dig;
+  8025ba:	49 0f af c1          	imul   %r9,%rax
+  8025be:	0f b6 c9             	movzbl %cl,%ecx
+  8025c1:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8025c4:	48 83 c7 01          	add    $0x1,%rdi
+  8025c8:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8025cc:	80 f9 39             	cmp    $0x39,%cl
+  8025cf:	76 dd                	jbe    8025ae <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8025d1:	80 f9 7b             	cmp    $0x7b,%cl
+  8025d4:	77 05                	ja     8025db <strtol+0x9f>
+            dig -= 'a' - 10;
+  8025d6:	83 e9 57             	sub    $0x57,%ecx
+  8025d9:	eb d6                	jmp    8025b1 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8025db:	4d 85 d2             	test   %r10,%r10
+  8025de:	74 03                	je     8025e3 <strtol+0xa7>
+  8025e0:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8025e3:	48 89 c2             	mov    %rax,%rdx
+  8025e6:	48 f7 da             	neg    %rdx
+  8025e9:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8025ed:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8025f1:	c3                   	ret
+
+00000000008025f2 <sys_cputs>:
+
+    return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+  8025f2:	55                   	push   %rbp
+  8025f3:	48 89 e5             	mov    %rsp,%rbp
+  8025f6:	53                   	push   %rbx
+  8025f7:	48 89 fa             	mov    %rdi,%rdx
+  8025fa:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802602:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802607:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80260c:	be 00 00 00 00       	mov    $0x0,%esi
+  802611:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802617:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80261d:	cd 30                	int    $0x30
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0, 0);
+}
+  80261f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802623:	c9                   	leave
+  802624:	c3                   	ret
+
+0000000000802625 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802625:	55                   	push   %rbp
+  802626:	48 89 e5             	mov    %rsp,%rbp
+  802629:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80262a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80262f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802634:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802639:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80263e:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802643:	be 00 00 00 00       	mov    $0x0,%esi
+  802648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80264e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802654:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802656:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80265a:	c9                   	leave
+  80265b:	c3                   	ret
+
+000000000080265c <sys_rcgetc>:
+
+int
+sys_rcgetc(uint8_t* is_released) {
+  80265c:	55                   	push   %rbp
+  80265d:	48 89 e5             	mov    %rsp,%rbp
+  802660:	53                   	push   %rbx
+  802661:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802664:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802669:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80266e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802673:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802678:	be 00 00 00 00       	mov    $0x0,%esi
+  80267d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802683:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802689:	cd 30                	int    $0x30
+    return syscall(SYS_cgetc, 0, (uintptr_t)is_released, 0, 0, 0, 0, 0, 0);
+}
+  80268b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80268f:	c9                   	leave
+  802690:	c3                   	ret
+
+0000000000802691 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802691:	55                   	push   %rbp
+  802692:	48 89 e5             	mov    %rsp,%rbp
+  802695:	53                   	push   %rbx
+  802696:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0, 0);
+  80269a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80269d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8026a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8026a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ac:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8026b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8026bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8026c2:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8026c4:	48 85 c0             	test   %rax,%rax
+  8026c7:	7f 06                	jg     8026cf <sys_env_destroy+0x3e>
+}
+  8026c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8026cf:	49 89 c0             	mov    %rax,%r8
+  8026d2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8026d7:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8026de:	00 00 00 
+  8026e1:	be 27 00 00 00       	mov    $0x27,%esi
+  8026e6:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  8026ed:	00 00 00 
+  8026f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f5:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  8026fc:	00 00 00 
+  8026ff:	41 ff d1             	call   *%r9
+
+0000000000802702 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802702:	55                   	push   %rbp
+  802703:	48 89 e5             	mov    %rsp,%rbp
+  802706:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802707:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  80270c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802711:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802716:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80271b:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802720:	be 00 00 00 00       	mov    $0x0,%esi
+  802725:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80272b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802731:	cd 30                	int    $0x30
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802733:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802737:	c9                   	leave
+  802738:	c3                   	ret
+
+0000000000802739 <sys_yield>:
+
+void
+sys_yield(void) {
+  802739:	55                   	push   %rbp
+  80273a:	48 89 e5             	mov    %rsp,%rbp
+  80273d:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  80273e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802743:	ba 00 00 00 00       	mov    $0x0,%edx
+  802748:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  80274d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802752:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802757:	be 00 00 00 00       	mov    $0x0,%esi
+  80275c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802762:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802768:	cd 30                	int    $0x30
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  80276a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80276e:	c9                   	leave
+  80276f:	c3                   	ret
+
+0000000000802770 <sys_region_refs>:
+
+int
+sys_region_refs(void *va, size_t size) {
+  802770:	55                   	push   %rbp
+  802771:	48 89 e5             	mov    %rsp,%rbp
+  802774:	53                   	push   %rbx
+  802775:	48 89 fa             	mov    %rdi,%rdx
+  802778:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  80277b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802780:	48 bb 00 00 00 00 80 	movabs $0x8000000000,%rbx
+  802787:	00 00 00 
+  80278a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80278f:	be 00 00 00 00       	mov    $0x0,%esi
+  802794:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  80279a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027a0:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0, 0);
+}
+  8027a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027a6:	c9                   	leave
+  8027a7:	c3                   	ret
+
+00000000008027a8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8027a8:	55                   	push   %rbp
+  8027a9:	48 89 e5             	mov    %rsp,%rbp
+  8027ac:	53                   	push   %rbx
+  8027ad:	49 89 f8             	mov    %rdi,%r8
+  8027b0:	48 89 d3             	mov    %rdx,%rbx
+  8027b3:	48 89 cf             	mov    %rcx,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8027b6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027bb:	4c 89 c2             	mov    %r8,%rdx
+  8027be:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8027cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8027d2:	cd 30                	int    $0x30
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0, 0);
+}
+  8027d4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d8:	c9                   	leave
+  8027d9:	c3                   	ret
+
+00000000008027da <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8027da:	55                   	push   %rbp
+  8027db:	48 89 e5             	mov    %rsp,%rbp
+  8027de:	53                   	push   %rbx
+  8027df:	48 83 ec 08          	sub    $0x8,%rsp
+  8027e3:	89 f8                	mov    %edi,%eax
+  8027e5:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0, 0);
+  8027e8:	48 63 f9             	movslq %ecx,%rdi
+  8027eb:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8027ee:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  8027f3:	48 89 f1             	mov    %rsi,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8027f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802801:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802807:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802809:	48 85 c0             	test   %rax,%rax
+  80280c:	7f 06                	jg     802814 <sys_alloc_region+0x3a>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80280e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802812:	c9                   	leave
+  802813:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802814:	49 89 c0             	mov    %rax,%r8
+  802817:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80281c:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802823:	00 00 00 
+  802826:	be 27 00 00 00       	mov    $0x27,%esi
+  80282b:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802832:	00 00 00 
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283a:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802841:	00 00 00 
+  802844:	41 ff d1             	call   *%r9
+
+0000000000802847 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802847:	55                   	push   %rbp
+  802848:	48 89 e5             	mov    %rsp,%rbp
+  80284b:	53                   	push   %rbx
+  80284c:	48 83 ec 08          	sub    $0x8,%rsp
+  802850:	89 f8                	mov    %edi,%eax
+  802852:	49 89 f2             	mov    %rsi,%r10
+  802855:	48 89 cf             	mov    %rcx,%rdi
+  802858:	4c 89 c6             	mov    %r8,%rsi
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm, 0);
+  80285b:	48 63 da             	movslq %edx,%rbx
+  80285e:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802861:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802866:	4c 89 d1             	mov    %r10,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802869:	4d 63 c1             	movslq %r9d,%r8
+                           _a7 asm("r9") = a7;
+  80286c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802872:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802874:	48 85 c0             	test   %rax,%rax
+  802877:	7f 06                	jg     80287f <sys_map_region+0x38>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  802879:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80287d:	c9                   	leave
+  80287e:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80287f:	49 89 c0             	mov    %rax,%r8
+  802882:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802887:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  80288e:	00 00 00 
+  802891:	be 27 00 00 00       	mov    $0x27,%esi
+  802896:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  80289d:	00 00 00 
+  8028a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a5:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  8028ac:	00 00 00 
+  8028af:	41 ff d1             	call   *%r9
+
+00000000008028b2 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8028b2:	55                   	push   %rbp
+  8028b3:	48 89 e5             	mov    %rsp,%rbp
+  8028b6:	53                   	push   %rbx
+  8028b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028bb:	48 89 f1             	mov    %rsi,%rcx
+  8028be:	48 89 d3             	mov    %rdx,%rbx
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0, 0);
+  8028c1:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  8028c4:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8028c9:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8028ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8028d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8028df:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8028e1:	48 85 c0             	test   %rax,%rax
+  8028e4:	7f 06                	jg     8028ec <sys_unmap_region+0x3a>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8028e6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8028ec:	49 89 c0             	mov    %rax,%r8
+  8028ef:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028f4:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8028fb:	00 00 00 
+  8028fe:	be 27 00 00 00       	mov    $0x27,%esi
+  802903:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  80290a:	00 00 00 
+  80290d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802912:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802919:	00 00 00 
+  80291c:	41 ff d1             	call   *%r9
+
+000000000080291f <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80291f:	55                   	push   %rbp
+  802920:	48 89 e5             	mov    %rsp,%rbp
+  802923:	53                   	push   %rbx
+  802924:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0, 0);
+  802928:	48 63 ce             	movslq %esi,%rcx
+  80292b:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80292e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802933:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802938:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  80293d:	be 00 00 00 00       	mov    $0x0,%esi
+  802942:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802948:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  80294e:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802950:	48 85 c0             	test   %rax,%rax
+  802953:	7f 06                	jg     80295b <sys_env_set_status+0x3c>
+}
+  802955:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802959:	c9                   	leave
+  80295a:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80295b:	49 89 c0             	mov    %rax,%r8
+  80295e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802963:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  80296a:	00 00 00 
+  80296d:	be 27 00 00 00       	mov    $0x27,%esi
+  802972:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802979:	00 00 00 
+  80297c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802981:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802988:	00 00 00 
+  80298b:	41 ff d1             	call   *%r9
+
+000000000080298e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80298e:	55                   	push   %rbp
+  80298f:	48 89 e5             	mov    %rsp,%rbp
+  802992:	53                   	push   %rbx
+  802993:	48 83 ec 08          	sub    $0x8,%rsp
+  802997:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0, 0);
+  80299a:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  80299d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  8029a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a7:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  8029ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8029b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  8029b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  8029bd:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  8029bf:	48 85 c0             	test   %rax,%rax
+  8029c2:	7f 06                	jg     8029ca <sys_env_set_trapframe+0x3c>
+}
+  8029c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8029ca:	49 89 c0             	mov    %rax,%r8
+  8029cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8029d2:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  8029d9:	00 00 00 
+  8029dc:	be 27 00 00 00       	mov    $0x27,%esi
+  8029e1:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  8029e8:	00 00 00 
+  8029eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f0:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  8029f7:	00 00 00 
+  8029fa:	41 ff d1             	call   *%r9
+
+00000000008029fd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8029fd:	55                   	push   %rbp
+  8029fe:	48 89 e5             	mov    %rsp,%rbp
+  802a01:	53                   	push   %rbx
+  802a02:	48 83 ec 08          	sub    $0x8,%rsp
+  802a06:	48 89 f1             	mov    %rsi,%rcx
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0, 0);
+  802a09:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a16:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a1b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a20:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a26:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a2c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a2e:	48 85 c0             	test   %rax,%rax
+  802a31:	7f 06                	jg     802a39 <sys_env_set_pgfault_upcall+0x3c>
+}
+  802a33:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802a37:	c9                   	leave
+  802a38:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802a39:	49 89 c0             	mov    %rax,%r8
+  802a3c:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802a41:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802a48:	00 00 00 
+  802a4b:	be 27 00 00 00       	mov    $0x27,%esi
+  802a50:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802a57:	00 00 00 
+  802a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5f:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802a66:	00 00 00 
+  802a69:	41 ff d1             	call   *%r9
+
+0000000000802a6c <sys_env_set_reclaim>:
+
+int
+sys_env_set_reclaim(envid_t envid, bool enable) {
+  802a6c:	55                   	push   %rbp
+  802a6d:	48 89 e5             	mov    %rsp,%rbp
+  802a70:	53                   	push   %rbx
+  802a71:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_reclaim, 1, envid, enable, 0, 0, 0, 0, 0);
+  802a75:	40 0f b6 ce          	movzbl %sil,%ecx
+  802a79:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802a7c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802a81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a86:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802a8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802a96:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802a9c:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802a9e:	48 85 c0             	test   %rax,%rax
+  802aa1:	7f 06                	jg     802aa9 <sys_env_set_reclaim+0x3d>
+}
+  802aa3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802aa7:	c9                   	leave
+  802aa8:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802aa9:	49 89 c0             	mov    %rax,%r8
+  802aac:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ab1:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802ab8:	00 00 00 
+  802abb:	be 27 00 00 00       	mov    $0x27,%esi
+  802ac0:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802ac7:	00 00 00 
+  802aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  802acf:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802ad6:	00 00 00 
+  802ad9:	41 ff d1             	call   *%r9
+
+0000000000802adc <sys_env_set_nice>:
+
+int
+sys_env_set_nice(envid_t envid, int nice) {
+  802adc:	55                   	push   %rbp
+  802add:	48 89 e5             	mov    %rsp,%rbp
+  802ae0:	53                   	push   %rbx
+  802ae1:	48 83 ec 08          	sub    $0x8,%rsp
+    return syscall(SYS_env_set_nice, 1, envid, nice, 0, 0, 0, 0, 0);
+  802ae5:	48 63 ce             	movslq %esi,%rcx
+  802ae8:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802aeb:	b8 18 00 00 00       	mov    $0x18,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802af0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802af5:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802afa:	be 00 00 00 00       	mov    $0x0,%esi
+  802aff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b0b:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802b0d:	48 85 c0             	test   %rax,%rax
+  802b10:	7f 06                	jg     802b18 <sys_env_set_nice+0x3c>
+}
+  802b12:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b16:	c9                   	leave
+  802b17:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802b18:	49 89 c0             	mov    %rax,%r8
+  802b1b:	b9 18 00 00 00       	mov    $0x18,%ecx
+  802b20:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802b27:	00 00 00 
+  802b2a:	be 27 00 00 00       	mov    $0x27,%esi
+  802b2f:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802b36:	00 00 00 
+  802b39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3e:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802b45:	00 00 00 
+  802b48:	41 ff d1             	call   *%r9
+
+0000000000802b4b <sys_spawn>:
+
+envid_t
+sys_spawn(const struct SpawnImage *img) {
+  802b4b:	55                   	push   %rbp
+  802b4c:	48 89 e5             	mov    %rsp,%rbp
+  802b4f:	53                   	push   %rbx
+  802b50:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b53:	b8 17 00 00 00       	mov    $0x17,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b58:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802b5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b62:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b67:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802b72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802b78:	cd 30                	int    $0x30
+    return syscall(SYS_spawn, 0, (uintptr_t)img, 0, 0, 0, 0, 0, 0);
+}
+  802b7a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b7e:	c9                   	leave
+  802b7f:	c3                   	ret
+
+0000000000802b80 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+  802b84:	53                   	push   %rbx
+  802b85:	89 f8                	mov    %edi,%eax
+  802b87:	49 89 f1             	mov    %rsi,%r9
+  802b8a:	48 89 d3             	mov    %rdx,%rbx
+  802b8d:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802b90:	49 63 f0             	movslq %r8d,%rsi
+  802b93:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802b96:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802b9b:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802b9e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802ba4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802baa:	cd 30                	int    $0x30
+}
+  802bac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802bb0:	c9                   	leave
+  802bb1:	c3                   	ret
+
+0000000000802bb2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	53                   	push   %rbx
+  802bb7:	89 f8                	mov    %edi,%eax
+  802bb9:	49 89 f1             	mov    %rsi,%r9
+  802bbc:	48 89 d3             	mov    %rdx,%rbx
+  802bbf:	48 89 cf             	mov    %rcx,%rdi
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0, 0);
+  802bc2:	49 63 f0             	movslq %r8d,%rsi
+  802bc5:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802bc8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802bcd:	4c 89 c9             	mov    %r9,%rcx
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802bd0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802bd6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802bdc:	cd 30                	int    $0x30
+}
+  802bde:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802be2:	c9                   	leave
+  802be3:	c3                   	ret
+
+0000000000802be4 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802be4:	55                   	push   %rbp
+  802be5:	48 89 e5             	mov    %rsp,%rbp
+  802be8:	53                   	push   %rbx
+  802be9:	48 83 ec 08          	sub    $0x8,%rsp
+  802bed:	89 f8                	mov    %edi,%eax
+  802bef:	49 89 f2             	mov    %rsi,%r10
+  802bf2:	48 89 d3             	mov    %rdx,%rbx
+  802bf5:	48 89 cf             	mov    %rcx,%rdi
+  802bf8:	44 89 c6             	mov    %r8d,%esi
+  802bfb:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_call, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802bfe:	48 63 f6             	movslq %esi,%rsi
+  802c01:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c04:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802c09:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802c0c:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802c10:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c12:	48 85 c0             	test   %rax,%rax
+  802c15:	7f 06                	jg     802c1d <sys_ipc_call+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802c17:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c1d:	49 89 c0             	mov    %rax,%r8
+  802c20:	b9 0f 00 00 00       	mov    $0xf,%ecx
+  802c25:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802c2c:	00 00 00 
+  802c2f:	be 27 00 00 00       	mov    $0x27,%esi
+  802c34:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802c3b:	00 00 00 
+  802c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c43:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802c4a:	00 00 00 
+  802c4d:	41 ff d1             	call   *%r9
+
+0000000000802c50 <sys_ipc_call_short>:
+
+int
+sys_ipc_call_short(envid_t envid, uintptr_t value, const uint64_t words[IPC_NWORDS]) {
+  802c50:	55                   	push   %rbp
+  802c51:	48 89 e5             	mov    %rsp,%rbp
+  802c54:	53                   	push   %rbx
+  802c55:	48 83 ec 08          	sub    $0x8,%rsp
+  802c59:	48 89 f1             	mov    %rsi,%rcx
+  802c5c:	49 89 d1             	mov    %rdx,%r9
+    return syscall(SYS_ipc_call_short, 1, envid, value, words[0], words[1], words[2], words[3], words[4]);
+  802c5f:	48 8b 72 10          	mov    0x10(%rdx),%rsi
+  802c63:	48 8b 1a             	mov    (%rdx),%rbx
+  802c66:	48 63 d7             	movslq %edi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802c69:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802c6e:	49 8b 79 08          	mov    0x8(%r9),%rdi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802c72:	4d 8b 41 18          	mov    0x18(%r9),%r8
+                           _a7 asm("r9") = a7;
+  802c76:	4d 8b 49 20          	mov    0x20(%r9),%r9
+    asm volatile("int %1\n"
+  802c7a:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802c7c:	48 85 c0             	test   %rax,%rax
+  802c7f:	7f 06                	jg     802c87 <sys_ipc_call_short+0x37>
+}
+  802c81:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c85:	c9                   	leave
+  802c86:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802c87:	49 89 c0             	mov    %rax,%r8
+  802c8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  802c8f:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802c96:	00 00 00 
+  802c99:	be 27 00 00 00       	mov    $0x27,%esi
+  802c9e:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802ca5:	00 00 00 
+  802ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cad:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802cb4:	00 00 00 
+  802cb7:	41 ff d1             	call   *%r9
+
+0000000000802cba <sys_ipc_reply_wait>:
+
+int
+sys_ipc_reply_wait(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm, void *dstva, size_t maxsize) {
+  802cba:	55                   	push   %rbp
+  802cbb:	48 89 e5             	mov    %rsp,%rbp
+  802cbe:	53                   	push   %rbx
+  802cbf:	48 83 ec 08          	sub    $0x8,%rsp
+  802cc3:	89 f8                	mov    %edi,%eax
+  802cc5:	49 89 f2             	mov    %rsi,%r10
+  802cc8:	48 89 d3             	mov    %rdx,%rbx
+  802ccb:	48 89 cf             	mov    %rcx,%rdi
+  802cce:	44 89 c6             	mov    %r8d,%esi
+  802cd1:	4d 89 c8             	mov    %r9,%r8
+    int res = syscall(SYS_ipc_reply_wait, 1, envid, value, (uintptr_t)srcva, size, perm, (uintptr_t)dstva, maxsize);
+  802cd4:	48 63 f6             	movslq %esi,%rsi
+  802cd7:	48 63 d0             	movslq %eax,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802cda:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802cdf:	4c 89 d1             	mov    %r10,%rcx
+                           _a7 asm("r9") = a7;
+  802ce2:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+    asm volatile("int %1\n"
+  802ce6:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802ce8:	48 85 c0             	test   %rax,%rax
+  802ceb:	7f 06                	jg     802cf3 <sys_ipc_reply_wait+0x39>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802ced:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802cf1:	c9                   	leave
+  802cf2:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802cf3:	49 89 c0             	mov    %rax,%r8
+  802cf6:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802cfb:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802d02:	00 00 00 
+  802d05:	be 27 00 00 00       	mov    $0x27,%esi
+  802d0a:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802d11:	00 00 00 
+  802d14:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d19:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802d20:	00 00 00 
+  802d23:	41 ff d1             	call   *%r9
+
+0000000000802d26 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t size) {
+  802d26:	55                   	push   %rbp
+  802d27:	48 89 e5             	mov    %rsp,%rbp
+  802d2a:	53                   	push   %rbx
+  802d2b:	48 83 ec 08          	sub    $0x8,%rsp
+  802d2f:	48 89 fa             	mov    %rdi,%rdx
+  802d32:	48 89 f1             	mov    %rsi,%rcx
+    register uintptr_t _a0 asm("rax") = num,
+  802d35:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802d3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d3f:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802d44:	be 00 00 00 00       	mov    $0x0,%esi
+  802d49:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802d4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802d55:	cd 30                	int    $0x30
+    if (check && ret > 0) {
+  802d57:	48 85 c0             	test   %rax,%rax
+  802d5a:	7f 06                	jg     802d62 <sys_ipc_recv+0x3c>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802d5c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802d60:	c9                   	leave
+  802d61:	c3                   	ret
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802d62:	49 89 c0             	mov    %rax,%r8
+  802d65:	b9 12 00 00 00       	mov    $0x12,%ecx
+  802d6a:	48 ba 68 62 80 00 00 	movabs $0x806268,%rdx
+  802d71:	00 00 00 
+  802d74:	be 27 00 00 00       	mov    $0x27,%esi
+  802d79:	48 bf 87 62 80 00 00 	movabs $0x806287,%rdi
+  802d80:	00 00 00 
+  802d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d88:	49 b9 2c 51 80 00 00 	movabs $0x80512c,%r9
+  802d8f:	00 00 00 
+  802d92:	41 ff d1             	call   *%r9
+
+0000000000802d95 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802d95:	55                   	push   %rbp
+  802d96:	48 89 e5             	mov    %rsp,%rbp
+  802d99:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802d9a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da4:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802da9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dae:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802db3:	be 00 00 00 00       	mov    $0x0,%esi
+  802db8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802dbe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802dc4:	cd 30                	int    $0x30
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802dc6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dca:	c9                   	leave
+  802dcb:	c3                   	ret
+
+0000000000802dcc <sys_virtiogpu_init>:
+
+int
+sys_virtiogpu_init(uint32_t **fb_holder) {
+  802dcc:	55                   	push   %rbp
+  802dcd:	48 89 e5             	mov    %rsp,%rbp
+  802dd0:	53                   	push   %rbx
+  802dd1:	48 89 fa             	mov    %rdi,%rdx
+    register uintptr_t _a0 asm("rax") = num,
+  802dd4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802dd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802dde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802de3:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802de8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ded:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802df3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802df9:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_init, 0, (uintptr_t)fb_holder, 0, 0, 0, 0, 0, 0);
+}
+  802dfb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802dff:	c9                   	leave
+  802e00:	c3                   	ret
+
+0000000000802e01 <sys_virtiogpu_flush>:
+
+int
+sys_virtiogpu_flush() {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	53                   	push   %rbx
+    register uintptr_t _a0 asm("rax") = num,
+  802e06:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
+  802e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
+  802e15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e1a:	bf 00 00 00 00       	mov    $0x0,%edi
+                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6,
+  802e1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802e24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+                           _a7 asm("r9") = a7;
+  802e2a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("int %1\n"
+  802e30:	cd 30                	int    $0x30
+    return syscall(SYS_virtiogpu_flush, 0, 0, 0, 0, 0, 0, 0, 0);
+}
+  802e32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+
+0000000000802e38 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e38:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e3f:	ff ff ff 
+  802e42:	48 01 f8             	add    %rdi,%rax
+  802e45:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802e49:	c3                   	ret
+
+0000000000802e4a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802e4a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  802e51:	ff ff ff 
+  802e54:	48 01 f8             	add    %rdi,%rax
+  802e57:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  802e5b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  802e61:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  802e65:	c3                   	ret
+
+0000000000802e66 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  802e66:	55                   	push   %rbp
+  802e67:	48 89 e5             	mov    %rsp,%rbp
+  802e6a:	41 57                	push   %r15
+  802e6c:	41 56                	push   %r14
+  802e6e:	41 55                	push   %r13
+  802e70:	41 54                	push   %r12
+  802e72:	53                   	push   %rbx
+  802e73:	48 83 ec 08          	sub    $0x8,%rsp
+  802e77:	49 89 ff             	mov    %rdi,%r15
+  802e7a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  802e7f:	49 bd 66 43 80 00 00 	movabs $0x804366,%r13
+  802e86:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  802e89:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  802e8f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  802e92:	48 89 df             	mov    %rbx,%rdi
+  802e95:	41 ff d5             	call   *%r13
+  802e98:	83 e0 04             	and    $0x4,%eax
+  802e9b:	74 17                	je     802eb4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802e9d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ea4:	4c 39 f3             	cmp    %r14,%rbx
+  802ea7:	75 e6                	jne    802e8f <fd_alloc+0x29>
+  802ea9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802eaf:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802eb4:	4d 89 27             	mov    %r12,(%r15)
+}
+  802eb7:	48 83 c4 08          	add    $0x8,%rsp
+  802ebb:	5b                   	pop    %rbx
+  802ebc:	41 5c                	pop    %r12
+  802ebe:	41 5d                	pop    %r13
+  802ec0:	41 5e                	pop    %r14
+  802ec2:	41 5f                	pop    %r15
+  802ec4:	5d                   	pop    %rbp
+  802ec5:	c3                   	ret
+
+0000000000802ec6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802ec6:	83 ff 1f             	cmp    $0x1f,%edi
+  802ec9:	77 39                	ja     802f04 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802ecb:	55                   	push   %rbp
+  802ecc:	48 89 e5             	mov    %rsp,%rbp
+  802ecf:	41 54                	push   %r12
+  802ed1:	53                   	push   %rbx
+  802ed2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802ed5:	48 63 df             	movslq %edi,%rbx
+  802ed8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802edf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802ee3:	48 89 df             	mov    %rbx,%rdi
+  802ee6:	48 b8 66 43 80 00 00 	movabs $0x804366,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+  802ef2:	a8 04                	test   $0x4,%al
+  802ef4:	74 14                	je     802f0a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802ef6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802efa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802eff:	5b                   	pop    %rbx
+  802f00:	41 5c                	pop    %r12
+  802f02:	5d                   	pop    %rbp
+  802f03:	c3                   	ret
+        return -E_INVAL;
+  802f04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802f09:	c3                   	ret
+        return -E_INVAL;
+  802f0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f0f:	eb ee                	jmp    802eff <fd_lookup+0x39>
+
+0000000000802f11 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802f11:	55                   	push   %rbp
+  802f12:	48 89 e5             	mov    %rsp,%rbp
+  802f15:	41 54                	push   %r12
+  802f17:	53                   	push   %rbx
+  802f18:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802f1b:	48 b8 20 63 80 00 00 	movabs $0x806320,%rax
+  802f22:	00 00 00 
+  802f25:	48 bb 40 70 80 00 00 	movabs $0x807040,%rbx
+  802f2c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802f2f:	39 3b                	cmp    %edi,(%rbx)
+  802f31:	74 47                	je     802f7a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802f33:	48 83 c0 08          	add    $0x8,%rax
+  802f37:	48 8b 18             	mov    (%rax),%rbx
+  802f3a:	48 85 db             	test   %rbx,%rbx
+  802f3d:	75 f0                	jne    802f2f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802f3f:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  802f46:	00 00 00 
+  802f49:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802f4f:	89 fa                	mov    %edi,%edx
+  802f51:	48 bf 98 62 80 00 00 	movabs $0x806298,%rdi
+  802f58:	00 00 00 
+  802f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f60:	48 b9 3e 17 80 00 00 	movabs $0x80173e,%rcx
+  802f67:	00 00 00 
+  802f6a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  802f6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  802f71:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  802f75:	5b                   	pop    %rbx
+  802f76:	41 5c                	pop    %r12
+  802f78:	5d                   	pop    %rbp
+  802f79:	c3                   	ret
+            return 0;
+  802f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7f:	eb f0                	jmp    802f71 <dev_lookup+0x60>
+
+0000000000802f81 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  802f81:	55                   	push   %rbp
+  802f82:	48 89 e5             	mov    %rsp,%rbp
+  802f85:	41 55                	push   %r13
+  802f87:	41 54                	push   %r12
+  802f89:	53                   	push   %rbx
+  802f8a:	48 83 ec 18          	sub    $0x18,%rsp
+  802f8e:	48 89 fb             	mov    %rdi,%rbx
+  802f91:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802f94:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802f9b:	ff ff ff 
+  802f9e:	48 01 df             	add    %rbx,%rdi
+  802fa1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802fa5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fa9:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  802fb0:	00 00 00 
+  802fb3:	ff d0                	call   *%rax
+  802fb5:	41 89 c5             	mov    %eax,%r13d
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	78 06                	js     802fc2 <fd_close+0x41>
+  802fbc:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802fc0:	74 1a                	je     802fdc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802fc2:	45 84 e4             	test   %r12b,%r12b
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802fce:	44 89 e8             	mov    %r13d,%eax
+  802fd1:	48 83 c4 18          	add    $0x18,%rsp
+  802fd5:	5b                   	pop    %rbx
+  802fd6:	41 5c                	pop    %r12
+  802fd8:	41 5d                	pop    %r13
+  802fda:	5d                   	pop    %rbp
+  802fdb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802fdc:	8b 3b                	mov    (%rbx),%edi
+  802fde:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802fe2:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  802fe9:	00 00 00 
+  802fec:	ff d0                	call   *%rax
+  802fee:	41 89 c5             	mov    %eax,%r13d
+  802ff1:	85 c0                	test   %eax,%eax
+  802ff3:	78 1b                	js     803010 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802ff5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ff9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802ffd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803003:	48 85 c0             	test   %rax,%rax
+  803006:	74 08                	je     803010 <fd_close+0x8f>
+  803008:	48 89 df             	mov    %rbx,%rdi
+  80300b:	ff d0                	call   *%rax
+  80300d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803010:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803015:	48 89 de             	mov    %rbx,%rsi
+  803018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80301d:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  803024:	00 00 00 
+  803027:	ff d0                	call   *%rax
+    return res;
+  803029:	eb a3                	jmp    802fce <fd_close+0x4d>
+
+000000000080302b <close>:
+
+int
+close(int fdnum) {
+  80302b:	55                   	push   %rbp
+  80302c:	48 89 e5             	mov    %rsp,%rbp
+  80302f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803033:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803037:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  80303e:	00 00 00 
+  803041:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803043:	85 c0                	test   %eax,%eax
+  803045:	78 15                	js     80305c <close+0x31>
+
+    return fd_close(fd, 1);
+  803047:	be 01 00 00 00       	mov    $0x1,%esi
+  80304c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803050:	48 b8 81 2f 80 00 00 	movabs $0x802f81,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+}
+  80305c:	c9                   	leave
+  80305d:	c3                   	ret
+
+000000000080305e <close_all>:
+
+void
+close_all(void) {
+  80305e:	55                   	push   %rbp
+  80305f:	48 89 e5             	mov    %rsp,%rbp
+  803062:	41 54                	push   %r12
+  803064:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  803065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80306a:	49 bc 2b 30 80 00 00 	movabs $0x80302b,%r12
+  803071:	00 00 00 
+  803074:	89 df                	mov    %ebx,%edi
+  803076:	41 ff d4             	call   *%r12
+  803079:	83 c3 01             	add    $0x1,%ebx
+  80307c:	83 fb 20             	cmp    $0x20,%ebx
+  80307f:	75 f3                	jne    803074 <close_all+0x16>
+}
+  803081:	5b                   	pop    %rbx
+  803082:	41 5c                	pop    %r12
+  803084:	5d                   	pop    %rbp
+  803085:	c3                   	ret
+
+0000000000803086 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  803086:	55                   	push   %rbp
+  803087:	48 89 e5             	mov    %rsp,%rbp
+  80308a:	41 57                	push   %r15
+  80308c:	41 56                	push   %r14
+  80308e:	41 55                	push   %r13
+  803090:	41 54                	push   %r12
+  803092:	53                   	push   %rbx
+  803093:	48 83 ec 18          	sub    $0x18,%rsp
+  803097:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80309a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80309e:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8030a5:	00 00 00 
+  8030a8:	ff d0                	call   *%rax
+  8030aa:	89 c3                	mov    %eax,%ebx
+  8030ac:	85 c0                	test   %eax,%eax
+  8030ae:	0f 88 b8 00 00 00    	js     80316c <dup+0xe6>
+    close(newfdnum);
+  8030b4:	44 89 e7             	mov    %r12d,%edi
+  8030b7:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  8030be:	00 00 00 
+  8030c1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8030c3:	4d 63 ec             	movslq %r12d,%r13
+  8030c6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8030cd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8030d1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8030d5:	4c 89 ff             	mov    %r15,%rdi
+  8030d8:	49 be 4a 2e 80 00 00 	movabs $0x802e4a,%r14
+  8030df:	00 00 00 
+  8030e2:	41 ff d6             	call   *%r14
+  8030e5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8030e8:	4c 89 ef             	mov    %r13,%rdi
+  8030eb:	41 ff d6             	call   *%r14
+  8030ee:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8030f1:	48 89 df             	mov    %rbx,%rdi
+  8030f4:	48 b8 66 43 80 00 00 	movabs $0x804366,%rax
+  8030fb:	00 00 00 
+  8030fe:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  803100:	a8 04                	test   $0x4,%al
+  803102:	74 2b                	je     80312f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  803104:	41 89 c1             	mov    %eax,%r9d
+  803107:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80310d:	4c 89 f1             	mov    %r14,%rcx
+  803110:	ba 00 00 00 00       	mov    $0x0,%edx
+  803115:	48 89 de             	mov    %rbx,%rsi
+  803118:	bf 00 00 00 00       	mov    $0x0,%edi
+  80311d:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  803124:	00 00 00 
+  803127:	ff d0                	call   *%rax
+  803129:	89 c3                	mov    %eax,%ebx
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	78 4e                	js     80317d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80312f:	4c 89 ff             	mov    %r15,%rdi
+  803132:	48 b8 66 43 80 00 00 	movabs $0x804366,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  803141:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803147:	4c 89 e9             	mov    %r13,%rcx
+  80314a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80314f:	4c 89 fe             	mov    %r15,%rsi
+  803152:	bf 00 00 00 00       	mov    $0x0,%edi
+  803157:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	89 c3                	mov    %eax,%ebx
+  803165:	85 c0                	test   %eax,%eax
+  803167:	78 14                	js     80317d <dup+0xf7>
+
+    return newfdnum;
+  803169:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80316c:	89 d8                	mov    %ebx,%eax
+  80316e:	48 83 c4 18          	add    $0x18,%rsp
+  803172:	5b                   	pop    %rbx
+  803173:	41 5c                	pop    %r12
+  803175:	41 5d                	pop    %r13
+  803177:	41 5e                	pop    %r14
+  803179:	41 5f                	pop    %r15
+  80317b:	5d                   	pop    %rbp
+  80317c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80317d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803182:	4c 89 ee             	mov    %r13,%rsi
+  803185:	bf 00 00 00 00       	mov    $0x0,%edi
+  80318a:	49 bc b2 28 80 00 00 	movabs $0x8028b2,%r12
+  803191:	00 00 00 
+  803194:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  803197:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80319c:	4c 89 f6             	mov    %r14,%rsi
+  80319f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a4:	41 ff d4             	call   *%r12
+    return res;
+  8031a7:	eb c3                	jmp    80316c <dup+0xe6>
+
+00000000008031a9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8031a9:	55                   	push   %rbp
+  8031aa:	48 89 e5             	mov    %rsp,%rbp
+  8031ad:	41 56                	push   %r14
+  8031af:	41 55                	push   %r13
+  8031b1:	41 54                	push   %r12
+  8031b3:	53                   	push   %rbx
+  8031b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8031b8:	89 fb                	mov    %edi,%ebx
+  8031ba:	49 89 f4             	mov    %rsi,%r12
+  8031bd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8031c0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031c4:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8031cb:	00 00 00 
+  8031ce:	ff d0                	call   *%rax
+  8031d0:	85 c0                	test   %eax,%eax
+  8031d2:	78 4c                	js     803220 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8031d4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8031d8:	41 8b 3e             	mov    (%r14),%edi
+  8031db:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8031df:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  8031e6:	00 00 00 
+  8031e9:	ff d0                	call   *%rax
+  8031eb:	85 c0                	test   %eax,%eax
+  8031ed:	78 35                	js     803224 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8031ef:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8031f3:	83 e0 03             	and    $0x3,%eax
+  8031f6:	83 f8 01             	cmp    $0x1,%eax
+  8031f9:	74 2d                	je     803228 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8031fb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031ff:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803203:	48 85 c0             	test   %rax,%rax
+  803206:	74 56                	je     80325e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  803208:	4c 89 ea             	mov    %r13,%rdx
+  80320b:	4c 89 e6             	mov    %r12,%rsi
+  80320e:	4c 89 f7             	mov    %r14,%rdi
+  803211:	ff d0                	call   *%rax
+}
+  803213:	48 83 c4 10          	add    $0x10,%rsp
+  803217:	5b                   	pop    %rbx
+  803218:	41 5c                	pop    %r12
+  80321a:	41 5d                	pop    %r13
+  80321c:	41 5e                	pop    %r14
+  80321e:	5d                   	pop    %rbp
+  80321f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803220:	48 98                	cltq
+  803222:	eb ef                	jmp    803213 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803224:	48 98                	cltq
+  803226:	eb eb                	jmp    803213 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803228:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80322f:	00 00 00 
+  803232:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803238:	89 da                	mov    %ebx,%edx
+  80323a:	48 bf d9 62 80 00 00 	movabs $0x8062d9,%rdi
+  803241:	00 00 00 
+  803244:	b8 00 00 00 00       	mov    $0x0,%eax
+  803249:	48 b9 3e 17 80 00 00 	movabs $0x80173e,%rcx
+  803250:	00 00 00 
+  803253:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  803255:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80325c:	eb b5                	jmp    803213 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80325e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  803265:	eb ac                	jmp    803213 <read+0x6a>
+
+0000000000803267 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803267:	55                   	push   %rbp
+  803268:	48 89 e5             	mov    %rsp,%rbp
+  80326b:	41 57                	push   %r15
+  80326d:	41 56                	push   %r14
+  80326f:	41 55                	push   %r13
+  803271:	41 54                	push   %r12
+  803273:	53                   	push   %rbx
+  803274:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  803278:	48 85 d2             	test   %rdx,%rdx
+  80327b:	74 54                	je     8032d1 <readn+0x6a>
+  80327d:	41 89 fd             	mov    %edi,%r13d
+  803280:	49 89 f6             	mov    %rsi,%r14
+  803283:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  803286:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80328b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  803290:	49 bf a9 31 80 00 00 	movabs $0x8031a9,%r15
+  803297:	00 00 00 
+  80329a:	4c 89 e2             	mov    %r12,%rdx
+  80329d:	48 29 f2             	sub    %rsi,%rdx
+  8032a0:	4c 01 f6             	add    %r14,%rsi
+  8032a3:	44 89 ef             	mov    %r13d,%edi
+  8032a6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	78 20                	js     8032cd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8032ad:	01 c3                	add    %eax,%ebx
+  8032af:	85 c0                	test   %eax,%eax
+  8032b1:	74 08                	je     8032bb <readn+0x54>
+  8032b3:	48 63 f3             	movslq %ebx,%rsi
+  8032b6:	4c 39 e6             	cmp    %r12,%rsi
+  8032b9:	72 df                	jb     80329a <readn+0x33>
+    }
+    return res;
+  8032bb:	48 63 c3             	movslq %ebx,%rax
+}
+  8032be:	48 83 c4 08          	add    $0x8,%rsp
+  8032c2:	5b                   	pop    %rbx
+  8032c3:	41 5c                	pop    %r12
+  8032c5:	41 5d                	pop    %r13
+  8032c7:	41 5e                	pop    %r14
+  8032c9:	41 5f                	pop    %r15
+  8032cb:	5d                   	pop    %rbp
+  8032cc:	c3                   	ret
+        if (inc < 0) return inc;
+  8032cd:	48 98                	cltq
+  8032cf:	eb ed                	jmp    8032be <readn+0x57>
+    int inc = 1, res = 0;
+  8032d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032d6:	eb e3                	jmp    8032bb <readn+0x54>
+
+00000000008032d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8032d8:	55                   	push   %rbp
+  8032d9:	48 89 e5             	mov    %rsp,%rbp
+  8032dc:	41 56                	push   %r14
+  8032de:	41 55                	push   %r13
+  8032e0:	41 54                	push   %r12
+  8032e2:	53                   	push   %rbx
+  8032e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8032e7:	89 fb                	mov    %edi,%ebx
+  8032e9:	49 89 f4             	mov    %rsi,%r12
+  8032ec:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032ef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032f3:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8032fa:	00 00 00 
+  8032fd:	ff d0                	call   *%rax
+  8032ff:	85 c0                	test   %eax,%eax
+  803301:	78 47                	js     80334a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  803303:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  803307:	41 8b 3e             	mov    (%r14),%edi
+  80330a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80330e:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	78 30                	js     80334e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80331e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  803323:	74 2d                	je     803352 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803325:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803329:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80332d:	48 85 c0             	test   %rax,%rax
+  803330:	74 56                	je     803388 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  803332:	4c 89 ea             	mov    %r13,%rdx
+  803335:	4c 89 e6             	mov    %r12,%rsi
+  803338:	4c 89 f7             	mov    %r14,%rdi
+  80333b:	ff d0                	call   *%rax
+}
+  80333d:	48 83 c4 10          	add    $0x10,%rsp
+  803341:	5b                   	pop    %rbx
+  803342:	41 5c                	pop    %r12
+  803344:	41 5d                	pop    %r13
+  803346:	41 5e                	pop    %r14
+  803348:	5d                   	pop    %rbp
+  803349:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80334a:	48 98                	cltq
+  80334c:	eb ef                	jmp    80333d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80334e:	48 98                	cltq
+  803350:	eb eb                	jmp    80333d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803352:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803359:	00 00 00 
+  80335c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  803362:	89 da                	mov    %ebx,%edx
+  803364:	48 bf f5 62 80 00 00 	movabs $0x8062f5,%rdi
+  80336b:	00 00 00 
+  80336e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803373:	48 b9 3e 17 80 00 00 	movabs $0x80173e,%rcx
+  80337a:	00 00 00 
+  80337d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80337f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803386:	eb b5                	jmp    80333d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  803388:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80338f:	eb ac                	jmp    80333d <write+0x65>
+
+0000000000803391 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803391:	55                   	push   %rbp
+  803392:	48 89 e5             	mov    %rsp,%rbp
+  803395:	53                   	push   %rbx
+  803396:	48 83 ec 18          	sub    $0x18,%rsp
+  80339a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80339c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8033a0:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+  8033ac:	85 c0                	test   %eax,%eax
+  8033ae:	78 0c                	js     8033bc <seek+0x2b>
+
+    fd->fd_offset = offset;
+  8033b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return 0;
+  8033b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+
+00000000008033c2 <tell>:
+
+int tell(int fdnum) {
+  8033c2:	55                   	push   %rbp
+  8033c3:	48 89 e5             	mov    %rsp,%rbp
+  8033c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033ce:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8033d5:	00 00 00 
+  8033d8:	ff d0                	call   *%rax
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	78 07                	js     8033e5 <tell+0x23>
+
+    return fd->fd_offset;
+  8033de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033e2:	8b 40 04             	mov    0x4(%rax),%eax
+}
+  8033e5:	c9                   	leave
+  8033e6:	c3                   	ret
+
+00000000008033e7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8033e7:	55                   	push   %rbp
+  8033e8:	48 89 e5             	mov    %rsp,%rbp
+  8033eb:	41 55                	push   %r13
+  8033ed:	41 54                	push   %r12
+  8033ef:	53                   	push   %rbx
+  8033f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8033f4:	89 fb                	mov    %edi,%ebx
+  8033f6:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033fd:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  803404:	00 00 00 
+  803407:	ff d0                	call   *%rax
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 38                	js     803445 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80340d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  803411:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  803415:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  803419:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  803420:	00 00 00 
+  803423:	ff d0                	call   *%rax
+  803425:	85 c0                	test   %eax,%eax
+  803427:	78 1c                	js     803445 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803429:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80342e:	74 20                	je     803450 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803430:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803434:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803438:	48 85 c0             	test   %rax,%rax
+  80343b:	74 47                	je     803484 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80343d:	44 89 e6             	mov    %r12d,%esi
+  803440:	4c 89 ef             	mov    %r13,%rdi
+  803443:	ff d0                	call   *%rax
+}
+  803445:	48 83 c4 18          	add    $0x18,%rsp
+  803449:	5b                   	pop    %rbx
+  80344a:	41 5c                	pop    %r12
+  80344c:	41 5d                	pop    %r13
+  80344e:	5d                   	pop    %rbp
+  80344f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  803450:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  803457:	00 00 00 
+  80345a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803460:	89 da                	mov    %ebx,%edx
+  803462:	48 bf b8 62 80 00 00 	movabs $0x8062b8,%rdi
+  803469:	00 00 00 
+  80346c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803471:	48 b9 3e 17 80 00 00 	movabs $0x80173e,%rcx
+  803478:	00 00 00 
+  80347b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80347d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803482:	eb c1                	jmp    803445 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  803484:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803489:	eb ba                	jmp    803445 <ftruncate+0x5e>
+
+000000000080348b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80348b:	55                   	push   %rbp
+  80348c:	48 89 e5             	mov    %rsp,%rbp
+  80348f:	41 54                	push   %r12
+  803491:	53                   	push   %rbx
+  803492:	48 83 ec 10          	sub    $0x10,%rsp
+  803496:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803499:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80349d:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8034a4:	00 00 00 
+  8034a7:	ff d0                	call   *%rax
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	78 63                	js     803510 <fstat+0x85>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8034ad:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8034b1:	41 8b 3c 24          	mov    (%r12),%edi
+  8034b5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8034b9:	48 b8 11 2f 80 00 00 	movabs $0x802f11,%rax
+  8034c0:	00 00 00 
+  8034c3:	ff d0                	call   *%rax
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	78 47                	js     803510 <fstat+0x85>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8034c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034cd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8034d2:	74 45                	je     803519 <fstat+0x8e>
+
+    stat->st_name[0] = 0;
+  8034d4:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8034d7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8034de:	00 00 00 
+    stat->st_isdir = 0;
+  8034e1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8034e8:	00 00 00 
+    stat->st_ino = 0;
+  8034eb:	48 c7 83 88 00 00 00 	movq   $0x0,0x88(%rbx)
+  8034f2:	00 00 00 00 
+    stat->st_version = 0;
+  8034f6:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%rbx)
+  8034fd:	00 00 00 
+    stat->st_dev = dev;
+  803500:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  803507:	48 89 de             	mov    %rbx,%rsi
+  80350a:	4c 89 e7             	mov    %r12,%rdi
+  80350d:	ff 50 28             	call   *0x28(%rax)
+}
+  803510:	48 83 c4 10          	add    $0x10,%rsp
+  803514:	5b                   	pop    %rbx
+  803515:	41 5c                	pop    %r12
+  803517:	5d                   	pop    %rbp
+  803518:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  803519:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80351e:	eb f0                	jmp    803510 <fstat+0x85>
+
+0000000000803520 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	41 54                	push   %r12
+  803526:	53                   	push   %rbx
+  803527:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80352a:	be 00 00 00 00       	mov    $0x0,%esi
+  80352f:	48 b8 41 3a 80 00 00 	movabs $0x803a41,%rax
+  803536:	00 00 00 
+  803539:	ff d0                	call   *%rax
+  80353b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80353d:	85 c0                	test   %eax,%eax
+  80353f:	78 25                	js     803566 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  803541:	4c 89 e6             	mov    %r12,%rsi
+  803544:	89 c7                	mov    %eax,%edi
+  803546:	48 b8 8b 34 80 00 00 	movabs $0x80348b,%rax
+  80354d:	00 00 00 
+  803550:	ff d0                	call   *%rax
+  803552:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  803555:	89 df                	mov    %ebx,%edi
+  803557:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  80355e:	00 00 00 
+  803561:	ff d0                	call   *%rax
+
+    return res;
+  803563:	44 89 e3             	mov    %r12d,%ebx
+}
+  803566:	89 d8                	mov    %ebx,%eax
+  803568:	5b                   	pop    %rbx
+  803569:	41 5c                	pop    %r12
+  80356b:	5d                   	pop    %rbp
+  80356c:	c3                   	ret
+
+000000000080356d <fsipc_env>:
+
+static envid_t
+fsipc_env(void) {
+    static envid_t fsenv;
+
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80356d:	48 b8 00 a0 80 01 00 	movabs $0x180a000,%rax
+  803574:	00 00 00 
+  803577:	83 38 00             	cmpl   $0x0,(%rax)
+  80357a:	74 0a                	je     803586 <fsipc_env+0x19>
+    return fsenv;
+}
+  80357c:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  803583:	00 00 
+  803585:	c3                   	ret
+fsipc_env(void) {
+  803586:	55                   	push   %rbp
+  803587:	48 89 e5             	mov    %rsp,%rbp
+    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+  80358a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80358f:	48 b8 13 57 80 00 00 	movabs $0x805713,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+  80359b:	a3 00 a0 80 01 00 00 	movabs %eax,0x180a000
+  8035a2:	00 00 
+}
+  8035a4:	a1 00 a0 80 01 00 00 	movabs 0x180a000,%eax
+  8035ab:	00 00 
+  8035ad:	5d                   	pop    %rbp
+  8035ae:	c3                   	ret
+
+00000000008035af <fsipc_short>:
+/* Send a small request, which is passed in registers
+ * instead of fsipcbuf, and wait for the reply.
+ * req: request structure of at most IPC_NWORDS words.
+ * Returns result from the file server. */
+static int
+fsipc_short(unsigned type, const void *req, size_t size) {
+  8035af:	55                   	push   %rbp
+  8035b0:	48 89 e5             	mov    %rsp,%rbp
+  8035b3:	53                   	push   %rbx
+  8035b4:	48 83 ec 38          	sub    $0x38,%rsp
+    uint64_t words[IPC_NWORDS] = {0};
+  8035b8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8035bf:	00 
+  8035c0:	48 c7 45 d0 00 00 00 	movq   $0x0,-0x30(%rbp)
+  8035c7:	00 
+  8035c8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+  8035cf:	00 
+  8035d0:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8035d7:	00 
+  8035d8:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8035df:	00 
+
+    assert(size <= sizeof(words));
+  8035e0:	48 83 fa 28          	cmp    $0x28,%rdx
+  8035e4:	77 38                	ja     80361e <fsipc_short+0x6f>
+  8035e6:	89 fb                	mov    %edi,%ebx
+    memcpy(words, req, size);
+  8035e8:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8035ec:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+    if (debug) {
+        cprintf("[%08x] fsipc short %d %08lx\n",
+                thisenv->env_id, type, (unsigned long)words[0]);
+    }
+
+    return ipc_call_short(fsipc_env(), type, words);
+  8035f8:	48 b8 6d 35 80 00 00 	movabs $0x80356d,%rax
+  8035ff:	00 00 00 
+  803602:	ff d0                	call   *%rax
+  803604:	89 c7                	mov    %eax,%edi
+  803606:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80360a:	89 de                	mov    %ebx,%esi
+  80360c:	48 b8 76 56 80 00 00 	movabs $0x805676,%rax
+  803613:	00 00 00 
+  803616:	ff d0                	call   *%rax
+}
+  803618:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80361c:	c9                   	leave
+  80361d:	c3                   	ret
+    assert(size <= sizeof(words));
+  80361e:	48 b9 40 63 80 00 00 	movabs $0x806340,%rcx
+  803625:	00 00 00 
+  803628:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  80362f:	00 00 00 
+  803632:	be 2f 00 00 00       	mov    $0x2f,%esi
+  803637:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  80363e:	00 00 00 
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+  803646:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  80364d:	00 00 00 
+  803650:	41 ff d0             	call   *%r8
+
+0000000000803653 <devfile_trunc>:
+    return 0;
+}
+
+/* Truncate or extend an open file to 'size' bytes */
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803653:	55                   	push   %rbp
+  803654:	48 89 e5             	mov    %rsp,%rbp
+  803657:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_set_size req = {
+  80365b:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80365e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  803661:	89 75 fc             	mov    %esi,-0x4(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_size = newsize};
+
+    return fsipc_short(FSREQ_SET_SIZE, &req, sizeof(req));
+  803664:	ba 08 00 00 00       	mov    $0x8,%edx
+  803669:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80366d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803672:	48 b8 af 35 80 00 00 	movabs $0x8035af,%rax
+  803679:	00 00 00 
+  80367c:	ff d0                	call   *%rax
+}
+  80367e:	c9                   	leave
+  80367f:	c3                   	ret
+
+0000000000803680 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fsreq_flush req = {.req_fileid = fd->fd_file.id};
+  803688:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80368b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    return fsipc_short(FSREQ_FLUSH, &req, sizeof(req));
+  80368e:	ba 04 00 00 00       	mov    $0x4,%edx
+  803693:	48 8d 75 fc          	lea    -0x4(%rbp),%rsi
+  803697:	bf 06 00 00 00       	mov    $0x6,%edi
+  80369c:	48 b8 af 35 80 00 00 	movabs $0x8035af,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+}
+  8036a8:	c9                   	leave
+  8036a9:	c3                   	ret
+
+00000000008036aa <fsipc_region>:
+fsipc_region(unsigned type, void *dstva, size_t maxsz) {
+  8036aa:	55                   	push   %rbp
+  8036ab:	48 89 e5             	mov    %rsp,%rbp
+  8036ae:	41 54                	push   %r12
+  8036b0:	53                   	push   %rbx
+  8036b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8036b5:	89 fb                	mov    %edi,%ebx
+  8036b7:	49 89 f4             	mov    %rsi,%r12
+  8036ba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    return ipc_call(fsipc_env(), type, &fsipcbuf, PAGE_SIZE, PROT_RW, dstva, &maxsz, NULL);
+  8036be:	48 b8 6d 35 80 00 00 	movabs $0x80356d,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+  8036ca:	89 c7                	mov    %eax,%edi
+  8036cc:	6a 00                	push   $0x0
+  8036ce:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  8036d2:	50                   	push   %rax
+  8036d3:	4d 89 e1             	mov    %r12,%r9
+  8036d6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8036dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036e1:	48 ba 00 90 80 01 00 	movabs $0x1809000,%rdx
+  8036e8:	00 00 00 
+  8036eb:	89 de                	mov    %ebx,%esi
+  8036ed:	48 b8 11 56 80 00 00 	movabs $0x805611,%rax
+  8036f4:	00 00 00 
+  8036f7:	ff d0                	call   *%rax
+}
+  8036f9:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  8036fd:	5b                   	pop    %rbx
+  8036fe:	41 5c                	pop    %r12
+  803700:	5d                   	pop    %rbp
+  803701:	c3                   	ret
+
+0000000000803702 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803702:	55                   	push   %rbp
+  803703:	48 89 e5             	mov    %rsp,%rbp
+  803706:	41 54                	push   %r12
+  803708:	53                   	push   %rbx
+  803709:	48 89 f3             	mov    %rsi,%rbx
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80370c:	8b 47 0c             	mov    0xc(%rdi),%eax
+  80370f:	a3 00 90 80 01 00 00 	movabs %eax,0x1809000
+  803716:	00 00 
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803718:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80371d:	be 00 00 00 00       	mov    $0x0,%esi
+  803722:	bf 05 00 00 00       	mov    $0x5,%edi
+  803727:	48 b8 aa 36 80 00 00 	movabs $0x8036aa,%rax
+  80372e:	00 00 00 
+  803731:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803733:	85 c0                	test   %eax,%eax
+  803735:	78 5a                	js     803791 <devfile_stat+0x8f>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803737:	49 bc 00 90 80 01 00 	movabs $0x1809000,%r12
+  80373e:	00 00 00 
+  803741:	4c 89 e6             	mov    %r12,%rsi
+  803744:	48 89 df             	mov    %rbx,%rdi
+  803747:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  80374e:	00 00 00 
+  803751:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803753:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80375a:	00 
+  80375b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803761:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803768:	00 
+  803769:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    st->st_ino = fsipcbuf.statRet.ret_ino;
+  80376f:	49 8b 84 24 88 00 00 	mov    0x88(%r12),%rax
+  803776:	00 
+  803777:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    st->st_version = fsipcbuf.statRet.ret_version;
+  80377e:	41 8b 84 24 90 00 00 	mov    0x90(%r12),%eax
+  803785:	00 
+  803786:	89 83 90 00 00 00    	mov    %eax,0x90(%rbx)
+    return 0;
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803791:	5b                   	pop    %rbx
+  803792:	41 5c                	pop    %r12
+  803794:	5d                   	pop    %rbp
+  803795:	c3                   	ret
+
+0000000000803796 <devfile_read>:
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803796:	55                   	push   %rbp
+  803797:	48 89 e5             	mov    %rsp,%rbp
+  80379a:	41 57                	push   %r15
+  80379c:	41 56                	push   %r14
+  80379e:	41 55                	push   %r13
+  8037a0:	41 54                	push   %r12
+  8037a2:	53                   	push   %rbx
+  8037a3:	48 83 ec 18          	sub    $0x18,%rsp
+    assert(fd);
+  8037a7:	48 85 ff             	test   %rdi,%rdi
+  8037aa:	0f 84 a1 00 00 00    	je     803851 <devfile_read+0xbb>
+  8037b0:	49 89 ff             	mov    %rdi,%r15
+  8037b3:	49 89 f5             	mov    %rsi,%r13
+  8037b6:	49 89 d4             	mov    %rdx,%r12
+    assert(buf);
+  8037b9:	48 85 f6             	test   %rsi,%rsi
+  8037bc:	0f 84 c4 00 00 00    	je     803886 <devfile_read+0xf0>
+    size_t total_read = 0;
+  8037c2:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8037c9:	00 
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8037ca:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  8037d1:	00 00 00 
+  8037d4:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  8037d8:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.read.req_n = n;
+  8037db:	4d 89 66 08          	mov    %r12,0x8(%r14)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  8037df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8037e9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8037ee:	48 b8 aa 36 80 00 00 	movabs $0x8036aa,%rax
+  8037f5:	00 00 00 
+  8037f8:	ff d0                	call   *%rax
+        if (res < 0) {
+  8037fa:	85 c0                	test   %eax,%eax
+  8037fc:	0f 88 b9 00 00 00    	js     8038bb <devfile_read+0x125>
+        assert(res <= n);
+  803802:	48 63 d8             	movslq %eax,%rbx
+  803805:	49 39 dc             	cmp    %rbx,%r12
+  803808:	0f 82 b1 00 00 00    	jb     8038bf <devfile_read+0x129>
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  80380e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803813:	0f 87 db 00 00 00    	ja     8038f4 <devfile_read+0x15e>
+        if (!res) {
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	74 21                	je     80383e <devfile_read+0xa8>
+        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80381d:	48 89 da             	mov    %rbx,%rdx
+  803820:	4c 89 f6             	mov    %r14,%rsi
+  803823:	4c 89 ef             	mov    %r13,%rdi
+  803826:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+        total_read += res;
+  803832:	48 01 5d c8          	add    %rbx,-0x38(%rbp)
+        buf += res;
+  803836:	49 01 dd             	add    %rbx,%r13
+    } while (n && REPEAT_DEVFILE_RW);
+  803839:	49 29 dc             	sub    %rbx,%r12
+  80383c:	75 96                	jne    8037d4 <devfile_read+0x3e>
+    return total_read;
+  80383e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  803842:	48 83 c4 18          	add    $0x18,%rsp
+  803846:	5b                   	pop    %rbx
+  803847:	41 5c                	pop    %r12
+  803849:	41 5d                	pop    %r13
+  80384b:	41 5e                	pop    %r14
+  80384d:	41 5f                	pop    %r15
+  80384f:	5d                   	pop    %rbp
+  803850:	c3                   	ret
+    assert(fd);
+  803851:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  803858:	00 00 00 
+  80385b:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803862:	00 00 00 
+  803865:	be 91 00 00 00       	mov    $0x91,%esi
+  80386a:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803871:	00 00 00 
+  803874:	b8 00 00 00 00       	mov    $0x0,%eax
+  803879:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  803880:	00 00 00 
+  803883:	41 ff d0             	call   *%r8
+    assert(buf);
+  803886:	48 b9 79 63 80 00 00 	movabs $0x806379,%rcx
+  80388d:	00 00 00 
+  803890:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803897:	00 00 00 
+  80389a:	be 92 00 00 00       	mov    $0x92,%esi
+  80389f:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  8038a6:	00 00 00 
+  8038a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ae:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  8038b5:	00 00 00 
+  8038b8:	41 ff d0             	call   *%r8
+            return res;
+  8038bb:	48 98                	cltq
+  8038bd:	eb 83                	jmp    803842 <devfile_read+0xac>
+        assert(res <= n);
+  8038bf:	48 b9 7d 63 80 00 00 	movabs $0x80637d,%rcx
+  8038c6:	00 00 00 
+  8038c9:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8038d0:	00 00 00 
+  8038d3:	be 9e 00 00 00       	mov    $0x9e,%esi
+  8038d8:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  8038df:	00 00 00 
+  8038e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e7:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  8038ee:	00 00 00 
+  8038f1:	41 ff d0             	call   *%r8
+        assert(res <= sizeof(fsipcbuf.readRet.ret_buf));
+  8038f4:	48 b9 88 63 80 00 00 	movabs $0x806388,%rcx
+  8038fb:	00 00 00 
+  8038fe:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803905:	00 00 00 
+  803908:	be 9f 00 00 00       	mov    $0x9f,%esi
+  80390d:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803914:	00 00 00 
+  803917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391c:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  803923:	00 00 00 
+  803926:	41 ff d0             	call   *%r8
+
+0000000000803929 <devfile_write>:
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	41 57                	push   %r15
+  80392f:	41 56                	push   %r14
+  803931:	41 55                	push   %r13
+  803933:	41 54                	push   %r12
+  803935:	53                   	push   %rbx
+  803936:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(fd);
+  80393a:	48 85 ff             	test   %rdi,%rdi
+  80393d:	0f 84 83 00 00 00    	je     8039c6 <devfile_write+0x9d>
+  803943:	49 89 ff             	mov    %rdi,%r15
+  803946:	49 89 f4             	mov    %rsi,%r12
+  803949:	48 89 d3             	mov    %rdx,%rbx
+    assert(buf);
+  80394c:	48 85 f6             	test   %rsi,%rsi
+  80394f:	0f 84 a6 00 00 00    	je     8039fb <devfile_write+0xd2>
+    size_t total_written = 0;
+  803955:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80395b:	49 be 00 90 80 01 00 	movabs $0x1809000,%r14
+  803962:	00 00 00 
+  803965:	41 8b 47 0c          	mov    0xc(%r15),%eax
+  803969:	41 89 06             	mov    %eax,(%r14)
+        fsipcbuf.write.req_n = n;
+  80396c:	49 89 5e 08          	mov    %rbx,0x8(%r14)
+        memcpy(fsipcbuf.write.req_buf, buf, MIN(n, sizeof(fsipcbuf.write.req_buf)));
+  803970:	ba f0 0f 00 00       	mov    $0xff0,%edx
+  803975:	48 39 d3             	cmp    %rdx,%rbx
+  803978:	48 0f 46 d3          	cmovbe %rbx,%rdx
+  80397c:	4c 89 e6             	mov    %r12,%rsi
+  80397f:	48 bf 10 90 80 01 00 	movabs $0x1809010,%rdi
+  803986:	00 00 00 
+  803989:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803995:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80399a:	be 00 00 00 00       	mov    $0x0,%esi
+  80399f:	bf 04 00 00 00       	mov    $0x4,%edi
+  8039a4:	48 b8 aa 36 80 00 00 	movabs $0x8036aa,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+        if (res < 0) {
+  8039b0:	85 c0                	test   %eax,%eax
+  8039b2:	78 7c                	js     803a30 <devfile_write+0x107>
+        total_written += res;
+  8039b4:	48 98                	cltq
+  8039b6:	49 01 c5             	add    %rax,%r13
+        buf += res;
+  8039b9:	49 01 c4             	add    %rax,%r12
+    } while (n && REPEAT_DEVFILE_RW);
+  8039bc:	48 29 c3             	sub    %rax,%rbx
+  8039bf:	75 a4                	jne    803965 <devfile_write+0x3c>
+    return total_written;
+  8039c1:	4c 89 e8             	mov    %r13,%rax
+  8039c4:	eb 6c                	jmp    803a32 <devfile_write+0x109>
+    assert(fd);
+  8039c6:	48 b9 76 63 80 00 00 	movabs $0x806376,%rcx
+  8039cd:	00 00 00 
+  8039d0:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8039d7:	00 00 00 
+  8039da:	be bd 00 00 00       	mov    $0xbd,%esi
+  8039df:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  8039e6:	00 00 00 
+  8039e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ee:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  8039f5:	00 00 00 
+  8039f8:	41 ff d0             	call   *%r8
+    assert(buf);
+  8039fb:	48 b9 79 63 80 00 00 	movabs $0x806379,%rcx
+  803a02:	00 00 00 
+  803a05:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  803a0c:	00 00 00 
+  803a0f:	be be 00 00 00       	mov    $0xbe,%esi
+  803a14:	48 bf 6b 63 80 00 00 	movabs $0x80636b,%rdi
+  803a1b:	00 00 00 
+  803a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a23:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  803a2a:	00 00 00 
+  803a2d:	41 ff d0             	call   *%r8
+            return res;
+  803a30:	48 98                	cltq
+}
+  803a32:	48 83 c4 08          	add    $0x8,%rsp
+  803a36:	5b                   	pop    %rbx
+  803a37:	41 5c                	pop    %r12
+  803a39:	41 5d                	pop    %r13
+  803a3b:	41 5e                	pop    %r14
+  803a3d:	41 5f                	pop    %r15
+  803a3f:	5d                   	pop    %rbp
+  803a40:	c3                   	ret
+
+0000000000803a41 <open>:
+open(const char *path, int mode) {
+  803a41:	55                   	push   %rbp
+  803a42:	48 89 e5             	mov    %rsp,%rbp
+  803a45:	41 55                	push   %r13
+  803a47:	41 54                	push   %r12
+  803a49:	53                   	push   %rbx
+  803a4a:	48 83 ec 18          	sub    $0x18,%rsp
+  803a4e:	49 89 fc             	mov    %rdi,%r12
+  803a51:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803a54:	48 b8 37 20 80 00 00 	movabs $0x802037,%rax
+  803a5b:	00 00 00 
+  803a5e:	ff d0                	call   *%rax
+  803a60:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803a66:	0f 87 8f 00 00 00    	ja     803afb <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803a6c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803a70:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  803a77:	00 00 00 
+  803a7a:	ff d0                	call   *%rax
+  803a7c:	89 c3                	mov    %eax,%ebx
+  803a7e:	85 c0                	test   %eax,%eax
+  803a80:	78 55                	js     803ad7 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803a82:	4c 89 e6             	mov    %r12,%rsi
+  803a85:	48 bb 00 90 80 01 00 	movabs $0x1809000,%rbx
+  803a8c:	00 00 00 
+  803a8f:	48 89 df             	mov    %rbx,%rdi
+  803a92:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  803a99:	00 00 00 
+  803a9c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803a9e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    return fsipc_region(type, dstva, PAGE_SIZE);
+  803aa5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aaa:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803aae:	bf 01 00 00 00       	mov    $0x1,%edi
+  803ab3:	48 b8 aa 36 80 00 00 	movabs $0x8036aa,%rax
+  803aba:	00 00 00 
+  803abd:	ff d0                	call   *%rax
+  803abf:	89 c3                	mov    %eax,%ebx
+    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803ac1:	85 c0                	test   %eax,%eax
+  803ac3:	78 1f                	js     803ae4 <open+0xa3>
+    return fd2num(fd);
+  803ac5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ac9:	48 b8 38 2e 80 00 00 	movabs $0x802e38,%rax
+  803ad0:	00 00 00 
+  803ad3:	ff d0                	call   *%rax
+  803ad5:	89 c3                	mov    %eax,%ebx
+}
+  803ad7:	89 d8                	mov    %ebx,%eax
+  803ad9:	48 83 c4 18          	add    $0x18,%rsp
+  803add:	5b                   	pop    %rbx
+  803ade:	41 5c                	pop    %r12
+  803ae0:	41 5d                	pop    %r13
+  803ae2:	5d                   	pop    %rbp
+  803ae3:	c3                   	ret
+        fd_close(fd, 0);
+  803ae4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ae9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803aed:	48 b8 81 2f 80 00 00 	movabs $0x802f81,%rax
+  803af4:	00 00 00 
+  803af7:	ff d0                	call   *%rax
+        return res;
+  803af9:	eb dc                	jmp    803ad7 <open+0x96>
+        return -E_BAD_PATH;
+  803afb:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b00:	eb d5                	jmp    803ad7 <open+0x96>
+
+0000000000803b02 <sync>:
+
+/* Synchronize disk with buffer cache */
+int
+sync(void) {
+  803b02:	55                   	push   %rbp
+  803b03:	48 89 e5             	mov    %rsp,%rbp
+    /* Ask the file server to update the disk
+     * by writing any dirty blocks in the buffer cache. */
+
+    return fsipc_short(FSREQ_SYNC, NULL, 0);
+  803b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b0b:	be 00 00 00 00       	mov    $0x0,%esi
+  803b10:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b15:	48 b8 af 35 80 00 00 	movabs $0x8035af,%rax
+  803b1c:	00 00 00 
+  803b1f:	ff d0                	call   *%rax
+}
+  803b21:	5d                   	pop    %rbp
+  803b22:	c3                   	ret
+
+0000000000803b23 <file_map>:
+ * 'offset' at 'dstva' directly from the file server block cache.
+ * Pages are mapped writable only if 'prot' contains PROT_W.
+ * Returns the number of bytes mapped, which may be less than
+ * requested, 0 at end of file or < 0 on error. */
+int
+file_map(int fdnum, off_t offset, void *dstva, size_t size, int prot) {
+  803b23:	55                   	push   %rbp
+  803b24:	48 89 e5             	mov    %rsp,%rbp
+  803b27:	41 56                	push   %r14
+  803b29:	41 55                	push   %r13
+  803b2b:	41 54                	push   %r12
+  803b2d:	53                   	push   %rbx
+  803b2e:	48 83 ec 10          	sub    $0x10,%rsp
+  803b32:	41 89 f6             	mov    %esi,%r14d
+  803b35:	49 89 d4             	mov    %rdx,%r12
+  803b38:	48 89 cb             	mov    %rcx,%rbx
+  803b3b:	45 89 c5             	mov    %r8d,%r13d
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803b3e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803b42:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  803b49:	00 00 00 
+  803b4c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b4e:	85 c0                	test   %eax,%eax
+  803b50:	78 46                	js     803b98 <file_map+0x75>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803b52:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b56:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  803b5d:	00 00 00 
+  803b60:	8b 00                	mov    (%rax),%eax
+  803b62:	39 02                	cmp    %eax,(%rdx)
+  803b64:	75 3f                	jne    803ba5 <file_map+0x82>
+
+    fsipcbuf.map.req_fileid = fd->fd_file.id;
+  803b66:	48 b8 00 90 80 01 00 	movabs $0x1809000,%rax
+  803b6d:	00 00 00 
+  803b70:	8b 52 0c             	mov    0xc(%rdx),%edx
+  803b73:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.map.req_offset = offset;
+  803b75:	44 89 70 04          	mov    %r14d,0x4(%rax)
+    fsipcbuf.map.req_n = size;
+  803b79:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    fsipcbuf.map.req_prot = prot;
+  803b7d:	44 89 68 10          	mov    %r13d,0x10(%rax)
+
+    return fsipc_region(FSREQ_MAP, dstva, size);
+  803b81:	48 89 da             	mov    %rbx,%rdx
+  803b84:	4c 89 e6             	mov    %r12,%rsi
+  803b87:	bf 09 00 00 00       	mov    $0x9,%edi
+  803b8c:	48 b8 aa 36 80 00 00 	movabs $0x8036aa,%rax
+  803b93:	00 00 00 
+  803b96:	ff d0                	call   *%rax
+}
+  803b98:	48 83 c4 10          	add    $0x10,%rsp
+  803b9c:	5b                   	pop    %rbx
+  803b9d:	41 5c                	pop    %r12
+  803b9f:	41 5d                	pop    %r13
+  803ba1:	41 5e                	pop    %r14
+  803ba3:	5d                   	pop    %rbp
+  803ba4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803ba5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803baa:	eb ec                	jmp    803b98 <file_map+0x75>
+
+0000000000803bac <file_msync>:
+
+/* Write 'size' bytes of open file 'fdnum' starting at 'offset'
+ * to disk, they may be modified through shared mappings */
+int
+file_msync(int fdnum, off_t offset, size_t size) {
+  803bac:	55                   	push   %rbp
+  803bad:	48 89 e5             	mov    %rsp,%rbp
+  803bb0:	41 54                	push   %r12
+  803bb2:	53                   	push   %rbx
+  803bb3:	48 83 ec 20          	sub    $0x20,%rsp
+  803bb7:	41 89 f4             	mov    %esi,%r12d
+  803bba:	48 89 d3             	mov    %rdx,%rbx
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  803bbd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803bc1:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  803bc8:	00 00 00 
+  803bcb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	78 3c                	js     803c0d <file_msync+0x61>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803bd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bd5:	48 ba 40 70 80 00 00 	movabs $0x807040,%rdx
+  803bdc:	00 00 00 
+  803bdf:	8b 0a                	mov    (%rdx),%ecx
+  803be1:	39 08                	cmp    %ecx,(%rax)
+  803be3:	75 31                	jne    803c16 <file_msync+0x6a>
+
+    struct Fsreq_msync req = {
+  803be5:	8b 40 0c             	mov    0xc(%rax),%eax
+  803be8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  803beb:	44 89 65 dc          	mov    %r12d,-0x24(%rbp)
+  803bef:	48 89 5d e0          	mov    %rbx,-0x20(%rbp)
+            .req_fileid = fd->fd_file.id,
+            .req_offset = offset,
+            .req_n = size};
+
+    return fsipc_short(FSREQ_MSYNC, &req, sizeof(req));
+  803bf3:	ba 10 00 00 00       	mov    $0x10,%edx
+  803bf8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803bfc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c01:	48 b8 af 35 80 00 00 	movabs $0x8035af,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+}
+  803c0d:	48 83 c4 20          	add    $0x20,%rsp
+  803c11:	5b                   	pop    %rbx
+  803c12:	41 5c                	pop    %r12
+  803c14:	5d                   	pop    %rbp
+  803c15:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_NOT_SUPP;
+  803c16:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  803c1b:	eb f0                	jmp    803c0d <file_msync+0x61>
+
+0000000000803c1d <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803c1d:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803c21:	7f 01                	jg     803c24 <writebuf+0x7>
+  803c23:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803c24:	55                   	push   %rbp
+  803c25:	48 89 e5             	mov    %rsp,%rbp
+  803c28:	53                   	push   %rbx
+  803c29:	48 83 ec 08          	sub    $0x8,%rsp
+  803c2d:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803c30:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803c34:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803c38:	8b 3f                	mov    (%rdi),%edi
+  803c3a:	48 b8 d8 32 80 00 00 	movabs $0x8032d8,%rax
+  803c41:	00 00 00 
+  803c44:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803c46:	48 85 c0             	test   %rax,%rax
+  803c49:	7e 04                	jle    803c4f <writebuf+0x32>
+  803c4b:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803c4f:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803c53:	48 39 c2             	cmp    %rax,%rdx
+  803c56:	74 0f                	je     803c67 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803c58:	48 85 c0             	test   %rax,%rax
+  803c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c60:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803c64:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803c67:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c6b:	c9                   	leave
+  803c6c:	c3                   	ret
+
+0000000000803c6d <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803c6d:	8b 46 04             	mov    0x4(%rsi),%eax
+  803c70:	8d 50 01             	lea    0x1(%rax),%edx
+  803c73:	89 56 04             	mov    %edx,0x4(%rsi)
+  803c76:	48 98                	cltq
+  803c78:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803c7d:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803c83:	74 01                	je     803c86 <putch+0x19>
+  803c85:	c3                   	ret
+putch(int ch, void *arg) {
+  803c86:	55                   	push   %rbp
+  803c87:	48 89 e5             	mov    %rsp,%rbp
+  803c8a:	53                   	push   %rbx
+  803c8b:	48 83 ec 08          	sub    $0x8,%rsp
+  803c8f:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c92:	48 89 f7             	mov    %rsi,%rdi
+  803c95:	48 b8 1d 3c 80 00 00 	movabs $0x803c1d,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803ca1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803ca8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803cac:	c9                   	leave
+  803cad:	c3                   	ret
+
+0000000000803cae <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803cae:	55                   	push   %rbp
+  803caf:	48 89 e5             	mov    %rsp,%rbp
+  803cb2:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803cb9:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803cbc:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803cc2:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803cc9:	00 00 00 
+    state.result = 0;
+  803ccc:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803cd3:	00 00 00 00 
+    state.error = 1;
+  803cd7:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803cde:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ce1:	48 89 f2             	mov    %rsi,%rdx
+  803ce4:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803ceb:	48 bf 6d 3c 80 00 00 	movabs $0x803c6d,%rdi
+  803cf2:	00 00 00 
+  803cf5:	48 b8 8e 18 80 00 00 	movabs $0x80188e,%rax
+  803cfc:	00 00 00 
+  803cff:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803d01:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803d08:	7f 14                	jg     803d1e <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803d0a:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803d11:	48 85 c0             	test   %rax,%rax
+  803d14:	75 06                	jne    803d1c <vfprintf+0x6e>
+  803d16:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803d1c:	c9                   	leave
+  803d1d:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803d1e:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803d25:	48 b8 1d 3c 80 00 00 	movabs $0x803c1d,%rax
+  803d2c:	00 00 00 
+  803d2f:	ff d0                	call   *%rax
+  803d31:	eb d7                	jmp    803d0a <vfprintf+0x5c>
+
+0000000000803d33 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803d33:	55                   	push   %rbp
+  803d34:	48 89 e5             	mov    %rsp,%rbp
+  803d37:	48 83 ec 50          	sub    $0x50,%rsp
+  803d3b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d3f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d43:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d47:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d4b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803d52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d5a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d5e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803d62:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d66:	48 b8 ae 3c 80 00 00 	movabs $0x803cae,%rax
+  803d6d:	00 00 00 
+  803d70:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d72:	c9                   	leave
+  803d73:	c3                   	ret
+
+0000000000803d74 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803d74:	55                   	push   %rbp
+  803d75:	48 89 e5             	mov    %rsp,%rbp
+  803d78:	48 83 ec 50          	sub    $0x50,%rsp
+  803d7c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803d80:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803d84:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d88:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d8c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803d90:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d97:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d9f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803da3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803da7:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803dab:	48 89 fe             	mov    %rdi,%rsi
+  803dae:	bf 01 00 00 00       	mov    $0x1,%edi
+  803db3:	48 b8 ae 3c 80 00 00 	movabs $0x803cae,%rax
+  803dba:	00 00 00 
+  803dbd:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803dbf:	c9                   	leave
+  803dc0:	c3                   	ret
+
+0000000000803dc1 <devpipe_stat>:
+
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803dc1:	55                   	push   %rbp
+  803dc2:	48 89 e5             	mov    %rsp,%rbp
+  803dc5:	41 54                	push   %r12
+  803dc7:	53                   	push   %rbx
+  803dc8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dcb:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  803dd2:	00 00 00 
+  803dd5:	ff d0                	call   *%rax
+  803dd7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803dda:	48 be b0 63 80 00 00 	movabs $0x8063b0,%rsi
+  803de1:	00 00 00 
+  803de4:	48 89 df             	mov    %rbx,%rdi
+  803de7:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  803dee:	00 00 00 
+  803df1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803df3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803df8:	41 2b 04 24          	sub    (%r12),%eax
+  803dfc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803e02:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803e09:	00 00 00 
+    stat->st_dev = &devpipe;
+  803e0c:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  803e13:	00 00 00 
+  803e16:	48 89 83 98 00 00 00 	mov    %rax,0x98(%rbx)
+    return 0;
+}
+  803e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e22:	5b                   	pop    %rbx
+  803e23:	41 5c                	pop    %r12
+  803e25:	5d                   	pop    %rbp
+  803e26:	c3                   	ret
+
+0000000000803e27 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803e27:	55                   	push   %rbp
+  803e28:	48 89 e5             	mov    %rsp,%rbp
+  803e2b:	41 54                	push   %r12
+  803e2d:	53                   	push   %rbx
+  803e2e:	48 89 fb             	mov    %rdi,%rbx
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803e31:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e36:	48 89 fe             	mov    %rdi,%rsi
+  803e39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e3e:	49 bc b2 28 80 00 00 	movabs $0x8028b2,%r12
+  803e45:	00 00 00 
+  803e48:	41 ff d4             	call   *%r12
+    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+  803e4b:	48 89 df             	mov    %rbx,%rdi
+  803e4e:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  803e55:	00 00 00 
+  803e58:	ff d0                	call   *%rax
+  803e5a:	48 89 c6             	mov    %rax,%rsi
+  803e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e67:	41 ff d4             	call   *%r12
+}
+  803e6a:	5b                   	pop    %rbx
+  803e6b:	41 5c                	pop    %r12
+  803e6d:	5d                   	pop    %rbp
+  803e6e:	c3                   	ret
+
+0000000000803e6f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e6f:	55                   	push   %rbp
+  803e70:	48 89 e5             	mov    %rsp,%rbp
+  803e73:	41 57                	push   %r15
+  803e75:	41 56                	push   %r14
+  803e77:	41 55                	push   %r13
+  803e79:	41 54                	push   %r12
+  803e7b:	53                   	push   %rbx
+  803e7c:	48 83 ec 18          	sub    $0x18,%rsp
+  803e80:	49 89 fc             	mov    %rdi,%r12
+  803e83:	49 89 f5             	mov    %rsi,%r13
+  803e86:	49 89 d7             	mov    %rdx,%r15
+  803e89:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e8d:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++) {
+  803e99:	4d 85 ff             	test   %r15,%r15
+  803e9c:	0f 84 af 00 00 00    	je     803f51 <devpipe_write+0xe2>
+  803ea2:	48 89 c3             	mov    %rax,%rbx
+  803ea5:	4c 89 f8             	mov    %r15,%rax
+  803ea8:	4d 89 ef             	mov    %r13,%r15
+  803eab:	4c 01 e8             	add    %r13,%rax
+  803eae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803eb2:	49 bd a8 27 80 00 00 	movabs $0x8027a8,%r13
+  803eb9:	00 00 00 
+            sys_yield();
+  803ebc:	49 be 39 27 80 00 00 	movabs $0x802739,%r14
+  803ec3:	00 00 00 
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ec6:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ec9:	48 63 ce             	movslq %esi,%rcx
+  803ecc:	48 63 03             	movslq (%rbx),%rax
+  803ecf:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803ed5:	48 39 c1             	cmp    %rax,%rcx
+  803ed8:	72 2e                	jb     803f08 <devpipe_write+0x99>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803eda:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803edf:	48 89 da             	mov    %rbx,%rdx
+  803ee2:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ee7:	4c 89 e7             	mov    %r12,%rdi
+  803eea:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803eed:	85 c0                	test   %eax,%eax
+  803eef:	74 66                	je     803f57 <devpipe_write+0xe8>
+            sys_yield();
+  803ef1:	41 ff d6             	call   *%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ef4:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ef7:	48 63 ce             	movslq %esi,%rcx
+  803efa:	48 63 03             	movslq (%rbx),%rax
+  803efd:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+  803f03:	48 39 c1             	cmp    %rax,%rcx
+  803f06:	73 d2                	jae    803eda <devpipe_write+0x6b>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803f08:	41 0f b6 3f          	movzbl (%r15),%edi
+  803f0c:	48 89 ca             	mov    %rcx,%rdx
+  803f0f:	48 c1 ea 03          	shr    $0x3,%rdx
+  803f13:	48 b8 81 00 01 02 04 	movabs $0x2010080402010081,%rax
+  803f1a:	08 10 20 
+  803f1d:	48 f7 e2             	mul    %rdx
+  803f20:	48 c1 ea 06          	shr    $0x6,%rdx
+  803f24:	48 89 d0             	mov    %rdx,%rax
+  803f27:	48 c1 e0 09          	shl    $0x9,%rax
+  803f2b:	48 29 d0             	sub    %rdx,%rax
+  803f2e:	48 c1 e0 03          	shl    $0x3,%rax
+  803f32:	48 29 c1             	sub    %rax,%rcx
+  803f35:	40 88 7c 0b 08       	mov    %dil,0x8(%rbx,%rcx,1)
+        p->p_wpos++;
+  803f3a:	83 c6 01             	add    $0x1,%esi
+  803f3d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f40:	49 83 c7 01          	add    $0x1,%r15
+  803f44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f48:	49 39 c7             	cmp    %rax,%r15
+  803f4b:	0f 85 75 ff ff ff    	jne    803ec6 <devpipe_write+0x57>
+    return n;
+  803f51:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f55:	eb 05                	jmp    803f5c <devpipe_write+0xed>
+            if (_pipeisclosed(fd, p)) return 0;
+  803f57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f5c:	48 83 c4 18          	add    $0x18,%rsp
+  803f60:	5b                   	pop    %rbx
+  803f61:	41 5c                	pop    %r12
+  803f63:	41 5d                	pop    %r13
+  803f65:	41 5e                	pop    %r14
+  803f67:	41 5f                	pop    %r15
+  803f69:	5d                   	pop    %rbp
+  803f6a:	c3                   	ret
+
+0000000000803f6b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f6b:	55                   	push   %rbp
+  803f6c:	48 89 e5             	mov    %rsp,%rbp
+  803f6f:	41 57                	push   %r15
+  803f71:	41 56                	push   %r14
+  803f73:	41 55                	push   %r13
+  803f75:	41 54                	push   %r12
+  803f77:	53                   	push   %rbx
+  803f78:	48 83 ec 18          	sub    $0x18,%rsp
+  803f7c:	49 89 fc             	mov    %rdi,%r12
+  803f7f:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803f83:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f87:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+  803f93:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803f96:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803f9c:	49 bd a8 27 80 00 00 	movabs $0x8027a8,%r13
+  803fa3:	00 00 00 
+            sys_yield();
+  803fa6:	49 be 39 27 80 00 00 	movabs $0x802739,%r14
+  803fad:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803fb0:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803fb5:	74 7d                	je     804034 <devpipe_read+0xc9>
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fb7:	8b 03                	mov    (%rbx),%eax
+  803fb9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fbc:	75 26                	jne    803fe4 <devpipe_read+0x79>
+            if (i > 0) return i;
+  803fbe:	4d 85 ff             	test   %r15,%r15
+  803fc1:	75 77                	jne    80403a <devpipe_read+0xcf>
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fc3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803fc8:	48 89 da             	mov    %rbx,%rdx
+  803fcb:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fd0:	4c 89 e7             	mov    %r12,%rdi
+  803fd3:	41 ff d5             	call   *%r13
+            if (_pipeisclosed(fd, p)) return 0;
+  803fd6:	85 c0                	test   %eax,%eax
+  803fd8:	74 72                	je     80404c <devpipe_read+0xe1>
+            sys_yield();
+  803fda:	41 ff d6             	call   *%r14
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fdd:	8b 03                	mov    (%rbx),%eax
+  803fdf:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fe2:	74 df                	je     803fc3 <devpipe_read+0x58>
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803fe4:	48 63 c8             	movslq %eax,%rcx
+  803fe7:	48 89 ca             	mov    %rcx,%rdx
+  803fea:	48 c1 ea 03          	shr    $0x3,%rdx
+  803fee:	48 be 81 00 01 02 04 	movabs $0x2010080402010081,%rsi
+  803ff5:	08 10 20 
+  803ff8:	48 89 d0             	mov    %rdx,%rax
+  803ffb:	48 f7 e6             	mul    %rsi
+  803ffe:	48 c1 ea 06          	shr    $0x6,%rdx
+  804002:	48 89 d0             	mov    %rdx,%rax
+  804005:	48 c1 e0 09          	shl    $0x9,%rax
+  804009:	48 29 d0             	sub    %rdx,%rax
+  80400c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804013:	00 
+  804014:	48 89 c8             	mov    %rcx,%rax
+  804017:	48 29 d0             	sub    %rdx,%rax
+  80401a:	0f b6 44 03 08       	movzbl 0x8(%rbx,%rax,1),%eax
+  80401f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804023:	42 88 04 39          	mov    %al,(%rcx,%r15,1)
+        p->p_rpos++;
+  804027:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80402a:	49 83 c7 01          	add    $0x1,%r15
+  80402e:	4c 39 7d c8          	cmp    %r15,-0x38(%rbp)
+  804032:	75 83                	jne    803fb7 <devpipe_read+0x4c>
+    return n;
+  804034:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804038:	eb 03                	jmp    80403d <devpipe_read+0xd2>
+            if (i > 0) return i;
+  80403a:	4c 89 f8             	mov    %r15,%rax
+}
+  80403d:	48 83 c4 18          	add    $0x18,%rsp
+  804041:	5b                   	pop    %rbx
+  804042:	41 5c                	pop    %r12
+  804044:	41 5d                	pop    %r13
+  804046:	41 5e                	pop    %r14
+  804048:	41 5f                	pop    %r15
+  80404a:	5d                   	pop    %rbp
+  80404b:	c3                   	ret
+            if (_pipeisclosed(fd, p)) return 0;
+  80404c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804051:	eb ea                	jmp    80403d <devpipe_read+0xd2>
+
+0000000000804053 <pipe>:
+pipe(int pfd[2]) {
+  804053:	55                   	push   %rbp
+  804054:	48 89 e5             	mov    %rsp,%rbp
+  804057:	41 55                	push   %r13
+  804059:	41 54                	push   %r12
+  80405b:	53                   	push   %rbx
+  80405c:	48 83 ec 18          	sub    $0x18,%rsp
+  804060:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804063:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804067:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+  804073:	89 c3                	mov    %eax,%ebx
+  804075:	85 c0                	test   %eax,%eax
+  804077:	0f 88 a0 01 00 00    	js     80421d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80407d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804082:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804087:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80408b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804090:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  804097:	00 00 00 
+  80409a:	ff d0                	call   *%rax
+  80409c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80409e:	85 c0                	test   %eax,%eax
+  8040a0:	0f 88 77 01 00 00    	js     80421d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8040a6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8040aa:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  8040b1:	00 00 00 
+  8040b4:	ff d0                	call   *%rax
+  8040b6:	89 c3                	mov    %eax,%ebx
+  8040b8:	85 c0                	test   %eax,%eax
+  8040ba:	0f 88 43 01 00 00    	js     804203 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8040c0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040ca:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8040ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d3:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  8040da:	00 00 00 
+  8040dd:	ff d0                	call   *%rax
+  8040df:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8040e1:	85 c0                	test   %eax,%eax
+  8040e3:	0f 88 1a 01 00 00    	js     804203 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8040e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040ed:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+  8040f9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8040fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804101:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804106:	48 89 c6             	mov    %rax,%rsi
+  804109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80410e:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  804115:	00 00 00 
+  804118:	ff d0                	call   *%rax
+  80411a:	89 c3                	mov    %eax,%ebx
+  80411c:	85 c0                	test   %eax,%eax
+  80411e:	0f 88 c5 00 00 00    	js     8041e9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804124:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804128:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  80412f:	00 00 00 
+  804132:	ff d0                	call   *%rax
+  804134:	48 89 c1             	mov    %rax,%rcx
+  804137:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80413d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804143:	ba 00 00 00 00       	mov    $0x0,%edx
+  804148:	4c 89 ee             	mov    %r13,%rsi
+  80414b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804150:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  804157:	00 00 00 
+  80415a:	ff d0                	call   *%rax
+  80415c:	89 c3                	mov    %eax,%ebx
+  80415e:	85 c0                	test   %eax,%eax
+  804160:	78 6e                	js     8041d0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804162:	be 00 10 00 00       	mov    $0x1000,%esi
+  804167:	4c 89 ef             	mov    %r13,%rdi
+  80416a:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  804171:	00 00 00 
+  804174:	ff d0                	call   *%rax
+  804176:	83 f8 02             	cmp    $0x2,%eax
+  804179:	0f 85 ab 00 00 00    	jne    80422a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80417f:	a1 80 70 80 00 00 00 	movabs 0x807080,%eax
+  804186:	00 00 
+  804188:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80418c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80418e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804192:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804199:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80419d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80419f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8041a3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8041aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8041ae:	48 bb 38 2e 80 00 00 	movabs $0x802e38,%rbx
+  8041b5:	00 00 00 
+  8041b8:	ff d3                	call   *%rbx
+  8041ba:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8041be:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8041c2:	ff d3                	call   *%rbx
+  8041c4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8041c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041ce:	eb 4d                	jmp    80421d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8041d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041d5:	4c 89 ee             	mov    %r13,%rsi
+  8041d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041dd:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8041e4:	00 00 00 
+  8041e7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8041e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041ee:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8041f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041f7:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804203:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804208:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80420c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804211:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  804218:	00 00 00 
+  80421b:	ff d0                	call   *%rax
+}
+  80421d:	89 d8                	mov    %ebx,%eax
+  80421f:	48 83 c4 18          	add    $0x18,%rsp
+  804223:	5b                   	pop    %rbx
+  804224:	41 5c                	pop    %r12
+  804226:	41 5d                	pop    %r13
+  804228:	5d                   	pop    %rbp
+  804229:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80422a:	48 b9 c8 63 80 00 00 	movabs $0x8063c8,%rcx
+  804231:	00 00 00 
+  804234:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  80423b:	00 00 00 
+  80423e:	be 2e 00 00 00       	mov    $0x2e,%esi
+  804243:	48 bf b7 63 80 00 00 	movabs $0x8063b7,%rdi
+  80424a:	00 00 00 
+  80424d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804252:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  804259:	00 00 00 
+  80425c:	41 ff d0             	call   *%r8
+
+000000000080425f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80425f:	55                   	push   %rbp
+  804260:	48 89 e5             	mov    %rsp,%rbp
+  804263:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804267:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80426b:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  804272:	00 00 00 
+  804275:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804277:	85 c0                	test   %eax,%eax
+  804279:	78 35                	js     8042b0 <pipeisclosed+0x51>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80427b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80427f:	48 b8 4a 2e 80 00 00 	movabs $0x802e4a,%rax
+  804286:	00 00 00 
+  804289:	ff d0                	call   *%rax
+  80428b:	48 89 c2             	mov    %rax,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80428e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804293:	be 00 10 00 00       	mov    $0x1000,%esi
+  804298:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80429c:	48 b8 a8 27 80 00 00 	movabs $0x8027a8,%rax
+  8042a3:	00 00 00 
+  8042a6:	ff d0                	call   *%rax
+  8042a8:	85 c0                	test   %eax,%eax
+  8042aa:	0f 94 c0             	sete   %al
+  8042ad:	0f b6 c0             	movzbl %al,%eax
+}
+  8042b0:	c9                   	leave
+  8042b1:	c3                   	ret
+
+00000000008042b2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042b2:	48 89 f8             	mov    %rdi,%rax
+  8042b5:	48 c1 e8 27          	shr    $0x27,%rax
+  8042b9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042c0:	01 00 00 
+  8042c3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042c7:	f6 c2 01             	test   $0x1,%dl
+  8042ca:	74 6d                	je     804339 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042cc:	48 89 f8             	mov    %rdi,%rax
+  8042cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042d3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042da:	01 00 00 
+  8042dd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042e1:	f6 c2 01             	test   $0x1,%dl
+  8042e4:	74 62                	je     804348 <get_uvpt_entry+0x96>
+  8042e6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042ed:	01 00 00 
+  8042f0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042f4:	f6 c2 80             	test   $0x80,%dl
+  8042f7:	75 4f                	jne    804348 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042f9:	48 89 f8             	mov    %rdi,%rax
+  8042fc:	48 c1 e8 15          	shr    $0x15,%rax
+  804300:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804307:	01 00 00 
+  80430a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80430e:	f6 c2 01             	test   $0x1,%dl
+  804311:	74 44                	je     804357 <get_uvpt_entry+0xa5>
+  804313:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80431a:	01 00 00 
+  80431d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804321:	f6 c2 80             	test   $0x80,%dl
+  804324:	75 31                	jne    804357 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804326:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80432a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804331:	01 00 00 
+  804334:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804338:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804339:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804340:	01 00 00 
+  804343:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804347:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804348:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80434f:	01 00 00 
+  804352:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804356:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804357:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80435e:	01 00 00 
+  804361:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804365:	c3                   	ret
+
+0000000000804366 <get_prot>:
+
+int
+get_prot(void *va) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80436a:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  804371:	00 00 00 
+  804374:	ff d0                	call   *%rax
+  804376:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804379:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80437e:	89 c1                	mov    %eax,%ecx
+  804380:	83 c9 04             	or     $0x4,%ecx
+  804383:	f6 c2 01             	test   $0x1,%dl
+  804386:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804389:	89 c1                	mov    %eax,%ecx
+  80438b:	83 c9 02             	or     $0x2,%ecx
+  80438e:	f6 c2 02             	test   $0x2,%dl
+  804391:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804394:	89 c1                	mov    %eax,%ecx
+  804396:	83 c9 01             	or     $0x1,%ecx
+  804399:	48 85 d2             	test   %rdx,%rdx
+  80439c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80439f:	89 c1                	mov    %eax,%ecx
+  8043a1:	83 c9 40             	or     $0x40,%ecx
+  8043a4:	f6 c6 04             	test   $0x4,%dh
+  8043a7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8043aa:	5d                   	pop    %rbp
+  8043ab:	c3                   	ret
+
+00000000008043ac <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8043ac:	55                   	push   %rbp
+  8043ad:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8043b0:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8043bc:	48 c1 e8 06          	shr    $0x6,%rax
+  8043c0:	83 e0 01             	and    $0x1,%eax
+}
+  8043c3:	5d                   	pop    %rbp
+  8043c4:	c3                   	ret
+
+00000000008043c5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8043c5:	55                   	push   %rbp
+  8043c6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8043c9:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  8043d0:	00 00 00 
+  8043d3:	ff d0                	call   *%rax
+  8043d5:	83 e0 01             	and    $0x1,%eax
+}
+  8043d8:	5d                   	pop    %rbp
+  8043d9:	c3                   	ret
+
+00000000008043da <foreach_shared_region>:
+
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8043da:	55                   	push   %rbp
+  8043db:	48 89 e5             	mov    %rsp,%rbp
+  8043de:	41 57                	push   %r15
+  8043e0:	41 56                	push   %r14
+  8043e2:	41 55                	push   %r13
+  8043e4:	41 54                	push   %r12
+  8043e6:	53                   	push   %rbx
+  8043e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8043eb:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here DONE
+    assert(fun);
+  8043ef:	48 85 ff             	test   %rdi,%rdi
+  8043f2:	74 1e                	je     804412 <foreach_shared_region+0x38>
+  8043f4:	49 89 ff             	mov    %rdi,%r15
+  8043f7:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+
+    uint64_t addr = 0;
+  8043fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+                                                                                \
+            ADDR_INC_(LEVEL);                                                   \
+        }
+
+    pte_t pte = 0;
+    LOOP_(4, uvpml4, VPML4,
+  804403:	49 be 00 00 00 00 00 	movabs $0x10000000000,%r14
+  80440a:	01 00 00 
+  80440d:	e9 72 02 00 00       	jmp    804684 <foreach_shared_region+0x2aa>
+    assert(fun);
+  804412:	48 b9 ec 63 80 00 00 	movabs $0x8063ec,%rcx
+  804419:	00 00 00 
+  80441c:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  804423:	00 00 00 
+  804426:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80442b:	48 bf f0 63 80 00 00 	movabs $0x8063f0,%rdi
+  804432:	00 00 00 
+  804435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443a:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  804441:	00 00 00 
+  804444:	41 ff d0             	call   *%r8
+  804447:	c7 45 c0 00 02 00 00 	movl   $0x200,-0x40(%rbp)
+  80444e:	eb 6c                	jmp    8044bc <foreach_shared_region+0xe2>
+    LOOP_(4, uvpml4, VPML4,
+  804450:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804457:	ff ff ff 
+  80445a:	4c 21 e2             	and    %r12,%rdx
+  80445d:	48 89 d8             	mov    %rbx,%rax
+  804460:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804465:	48 83 c0 01          	add    $0x1,%rax
+  804469:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80446d:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  804474:	00 00 00 
+  804477:	48 21 c8             	and    %rcx,%rax
+  80447a:	48 09 d0             	or     %rdx,%rax
+  80447d:	49 89 c4             	mov    %rax,%r12
+  804480:	eb 30                	jmp    8044b2 <foreach_shared_region+0xd8>
+  804482:	48 ba ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rdx
+  804489:	ff ff ff 
+  80448c:	4c 21 e2             	and    %r12,%rdx
+  80448f:	48 89 d8             	mov    %rbx,%rax
+  804492:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804497:	48 83 c0 01          	add    $0x1,%rax
+  80449b:	48 c1 e0 1e          	shl    $0x1e,%rax
+  80449f:	48 b9 00 00 00 c0 7f 	movabs $0x7fc0000000,%rcx
+  8044a6:	00 00 00 
+  8044a9:	48 21 c8             	and    %rcx,%rax
+  8044ac:	48 09 d0             	or     %rdx,%rax
+  8044af:	49 89 c4             	mov    %rax,%r12
+  8044b2:	83 6d c0 01          	subl   $0x1,-0x40(%rbp)
+  8044b6:	0f 84 99 01 00 00    	je     804655 <foreach_shared_region+0x27b>
+  8044bc:	4c 89 e3             	mov    %r12,%rbx
+  8044bf:	48 c1 eb 1e          	shr    $0x1e,%rbx
+  8044c3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8044ca:	01 00 00 
+  8044cd:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  8044d1:	a8 01                	test   $0x1,%al
+  8044d3:	0f 84 77 ff ff ff    	je     804450 <foreach_shared_region+0x76>
+  8044d9:	a8 80                	test   $0x80,%al
+  8044db:	74 19                	je     8044f6 <foreach_shared_region+0x11c>
+  8044dd:	f6 c4 04             	test   $0x4,%ah
+  8044e0:	74 a0                	je     804482 <foreach_shared_region+0xa8>
+  8044e2:	49 8d b4 24 00 00 00 	lea    0x40000000(%r12),%rsi
+  8044e9:	40 
+  8044ea:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8044ee:	4c 89 e7             	mov    %r12,%rdi
+  8044f1:	41 ff d7             	call   *%r15
+  8044f4:	eb 8c                	jmp    804482 <foreach_shared_region+0xa8>
+  8044f6:	c7 45 c4 00 02 00 00 	movl   $0x200,-0x3c(%rbp)
+  8044fd:	44 89 6d bc          	mov    %r13d,-0x44(%rbp)
+  804501:	eb 46                	jmp    804549 <foreach_shared_region+0x16f>
+  804503:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  80450a:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  804510:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804514:	48 c1 e0 15          	shl    $0x15,%rax
+  804518:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80451d:	49 09 c4             	or     %rax,%r12
+  804520:	eb 1d                	jmp    80453f <foreach_shared_region+0x165>
+  804522:	49 81 e4 ff ff 1f c0 	and    $0xffffffffc01fffff,%r12
+  804529:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  80452f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  804533:	48 c1 e0 15          	shl    $0x15,%rax
+  804537:	25 00 00 e0 3f       	and    $0x3fe00000,%eax
+  80453c:	49 09 c4             	or     %rax,%r12
+  80453f:	83 6d c4 01          	subl   $0x1,-0x3c(%rbp)
+  804543:	0f 84 d3 00 00 00    	je     80461c <foreach_shared_region+0x242>
+  804549:	4c 89 e3             	mov    %r12,%rbx
+  80454c:	48 c1 eb 15          	shr    $0x15,%rbx
+  804550:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804557:	01 00 00 
+  80455a:	48 8b 04 d8          	mov    (%rax,%rbx,8),%rax
+  80455e:	a8 01                	test   $0x1,%al
+  804560:	74 a1                	je     804503 <foreach_shared_region+0x129>
+  804562:	a8 80                	test   $0x80,%al
+  804564:	74 19                	je     80457f <foreach_shared_region+0x1a5>
+  804566:	f6 c4 04             	test   $0x4,%ah
+  804569:	74 b7                	je     804522 <foreach_shared_region+0x148>
+  80456b:	49 8d b4 24 00 00 20 	lea    0x200000(%r12),%rsi
+  804572:	00 
+  804573:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804577:	4c 89 e7             	mov    %r12,%rdi
+  80457a:	41 ff d7             	call   *%r15
+  80457d:	eb a3                	jmp    804522 <foreach_shared_region+0x148>
+  80457f:	41 bd 00 02 00 00    	mov    $0x200,%r13d
+  804585:	eb 3b                	jmp    8045c2 <foreach_shared_region+0x1e8>
+  804587:	f6 c4 04             	test   $0x4,%ah
+  80458a:	74 12                	je     80459e <foreach_shared_region+0x1c4>
+  80458c:	49 8d b4 24 00 10 00 	lea    0x1000(%r12),%rsi
+  804593:	00 
+  804594:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804598:	4c 89 e7             	mov    %r12,%rdi
+  80459b:	41 ff d7             	call   *%r15
+  80459e:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8045a5:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8045ab:	48 83 c3 01          	add    $0x1,%rbx
+  8045af:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8045b3:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8045b9:	49 09 dc             	or     %rbx,%r12
+  8045bc:	41 83 ed 01          	sub    $0x1,%r13d
+  8045c0:	74 2f                	je     8045f1 <foreach_shared_region+0x217>
+  8045c2:	4c 89 e3             	mov    %r12,%rbx
+  8045c5:	48 c1 eb 0c          	shr    $0xc,%rbx
+  8045c9:	49 8b 04 de          	mov    (%r14,%rbx,8),%rax
+  8045cd:	a8 01                	test   $0x1,%al
+  8045cf:	75 b6                	jne    804587 <foreach_shared_region+0x1ad>
+  8045d1:	49 81 e4 ff 0f e0 ff 	and    $0xffffffffffe00fff,%r12
+  8045d8:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  8045de:	48 83 c3 01          	add    $0x1,%rbx
+  8045e2:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8045e6:	81 e3 00 f0 1f 00    	and    $0x1ff000,%ebx
+  8045ec:	49 09 dc             	or     %rbx,%r12
+  8045ef:	eb cb                	jmp    8045bc <foreach_shared_region+0x1e2>
+  8045f1:	4c 89 e0             	mov    %r12,%rax
+  8045f4:	48 25 ff ff 1f c0    	and    $0xffffffffc01fffff,%rax
+  8045fa:	49 c1 ec 15          	shr    $0x15,%r12
+  8045fe:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804605:	49 83 c4 01          	add    $0x1,%r12
+  804609:	49 c1 e4 15          	shl    $0x15,%r12
+  80460d:	41 81 e4 00 00 e0 3f 	and    $0x3fe00000,%r12d
+  804614:	49 09 c4             	or     %rax,%r12
+  804617:	e9 23 ff ff ff       	jmp    80453f <foreach_shared_region+0x165>
+  80461c:	44 8b 6d bc          	mov    -0x44(%rbp),%r13d
+  804620:	48 b8 ff ff ff 3f 80 	movabs $0xffffff803fffffff,%rax
+  804627:	ff ff ff 
+  80462a:	4c 21 e0             	and    %r12,%rax
+  80462d:	49 c1 ec 1e          	shr    $0x1e,%r12
+  804631:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  804638:	49 83 c4 01          	add    $0x1,%r12
+  80463c:	49 c1 e4 1e          	shl    $0x1e,%r12
+  804640:	48 ba 00 00 00 c0 7f 	movabs $0x7fc0000000,%rdx
+  804647:	00 00 00 
+  80464a:	49 21 d4             	and    %rdx,%r12
+  80464d:	49 09 c4             	or     %rax,%r12
+  804650:	e9 5d fe ff ff       	jmp    8044b2 <foreach_shared_region+0xd8>
+  804655:	48 b8 ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rax
+  80465c:	00 ff ff 
+  80465f:	4c 21 e0             	and    %r12,%rax
+  804662:	49 c1 ec 27          	shr    $0x27,%r12
+  804666:	49 83 c4 01          	add    $0x1,%r12
+  80466a:	49 c1 e4 27          	shl    $0x27,%r12
+  80466e:	48 ba 00 00 00 00 80 	movabs $0xff8000000000,%rdx
+  804675:	ff 00 00 
+  804678:	49 21 d4             	and    %rdx,%r12
+  80467b:	49 09 c4             	or     %rax,%r12
+  80467e:	41 83 ed 01          	sub    $0x1,%r13d
+  804682:	74 48                	je     8046cc <foreach_shared_region+0x2f2>
+  804684:	4c 89 e0             	mov    %r12,%rax
+  804687:	48 c1 e8 27          	shr    $0x27,%rax
+  80468b:	48 b9 00 20 40 80 00 	movabs $0x10080402000,%rcx
+  804692:	01 00 00 
+  804695:	48 8b 14 c1          	mov    (%rcx,%rax,8),%rdx
+  804699:	f6 c2 01             	test   $0x1,%dl
+  80469c:	0f 85 a5 fd ff ff    	jne    804447 <foreach_shared_region+0x6d>
+  8046a2:	48 ba ff ff ff ff 7f 	movabs $0xffff007fffffffff,%rdx
+  8046a9:	00 ff ff 
+  8046ac:	4c 21 e2             	and    %r12,%rdx
+  8046af:	48 83 c0 01          	add    $0x1,%rax
+  8046b3:	48 c1 e0 27          	shl    $0x27,%rax
+  8046b7:	48 b9 00 00 00 00 80 	movabs $0xff8000000000,%rcx
+  8046be:	ff 00 00 
+  8046c1:	48 21 c8             	and    %rcx,%rax
+  8046c4:	48 09 d0             	or     %rdx,%rax
+  8046c7:	49 89 c4             	mov    %rax,%r12
+  8046ca:	eb b2                	jmp    80467e <foreach_shared_region+0x2a4>
+        );
+    );
+
+    #undef LOOP_
+
+    assert(addr == 0);
+  8046cc:	4d 85 e4             	test   %r12,%r12
+  8046cf:	75 14                	jne    8046e5 <foreach_shared_region+0x30b>
+    #undef ADDR_GET_
+    #undef LEVEL_MASK_
+    #undef LEVEL_OFFS_
+
+    return 0;
+}
+  8046d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d6:	48 83 c4 28          	add    $0x28,%rsp
+  8046da:	5b                   	pop    %rbx
+  8046db:	41 5c                	pop    %r12
+  8046dd:	41 5d                	pop    %r13
+  8046df:	41 5e                	pop    %r14
+  8046e1:	41 5f                	pop    %r15
+  8046e3:	5d                   	pop    %rbp
+  8046e4:	c3                   	ret
+    assert(addr == 0);
+  8046e5:	48 b9 fb 63 80 00 00 	movabs $0x8063fb,%rcx
+  8046ec:	00 00 00 
+  8046ef:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8046f6:	00 00 00 
+  8046f9:	be 67 00 00 00       	mov    $0x67,%esi
+  8046fe:	48 bf f0 63 80 00 00 	movabs $0x8063f0,%rdi
+  804705:	00 00 00 
+  804708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470d:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  804714:	00 00 00 
+  804717:	41 ff d0             	call   *%r8
+
+000000000080471a <mmap_place>:
+    return NULL;
+}
+
+/* Lowest free address range of given size in the mmap area, 0 if none */
+static uintptr_t
+mmap_place(uintptr_t addr, size_t size) {
+  80471a:	49 b8 20 a4 80 01 00 	movabs $0x180a420,%r8
+  804721:	00 00 00 
+    do {
+        moved = 0;
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+            struct MmapRegion *reg = &mmap_regions[i];
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+                addr = reg->start + reg->size;
+  804724:	41 bb 01 00 00 00    	mov    $0x1,%r11d
+  80472a:	eb 33                	jmp    80475f <mmap_place+0x45>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80472c:	48 83 c0 20          	add    $0x20,%rax
+  804730:	4c 39 c0             	cmp    %r8,%rax
+  804733:	74 25                	je     80475a <mmap_place+0x40>
+            if (reg->start && addr < reg->start + reg->size && reg->start < addr + size) {
+  804735:	48 8b 10             	mov    (%rax),%rdx
+  804738:	48 85 d2             	test   %rdx,%rdx
+  80473b:	74 ef                	je     80472c <mmap_place+0x12>
+  80473d:	48 89 d1             	mov    %rdx,%rcx
+  804740:	48 03 48 08          	add    0x8(%rax),%rcx
+  804744:	48 39 cf             	cmp    %rcx,%rdi
+  804747:	73 e3                	jae    80472c <mmap_place+0x12>
+  804749:	4c 8d 0c 3e          	lea    (%rsi,%rdi,1),%r9
+                addr = reg->start + reg->size;
+  80474d:	4c 39 ca             	cmp    %r9,%rdx
+  804750:	48 0f 42 f9          	cmovb  %rcx,%rdi
+  804754:	45 0f 42 d3          	cmovb  %r11d,%r10d
+  804758:	eb d2                	jmp    80472c <mmap_place+0x12>
+                moved = 1;
+            }
+        }
+    } while (moved);
+  80475a:	45 84 d2             	test   %r10b,%r10b
+  80475d:	74 12                	je     804771 <mmap_place+0x57>
+        for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  80475f:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804766:	00 00 00 
+        moved = 0;
+  804769:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+  80476f:	eb c4                	jmp    804735 <mmap_place+0x1b>
+    return addr + size <= MMAP_SCRATCH ? addr : 0;
+  804771:	48 01 fe             	add    %rdi,%rsi
+  804774:	48 b8 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rax
+  80477b:	00 00 00 
+  80477e:	48 39 f0             	cmp    %rsi,%rax
+  804781:	b8 00 00 00 00       	mov    $0x0,%eax
+  804786:	48 0f 43 c7          	cmovae %rdi,%rax
+}
+  80478a:	c3                   	ret
+
+000000000080478b <mmap_pgfault>:
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+    return res >= 0;
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+  80478b:	55                   	push   %rbp
+  80478c:	48 89 e5             	mov    %rsp,%rbp
+  80478f:	41 57                	push   %r15
+  804791:	41 56                	push   %r14
+  804793:	41 55                	push   %r13
+  804795:	41 54                	push   %r12
+  804797:	53                   	push   %rbx
+  804798:	48 83 ec 18          	sub    $0x18,%rsp
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80479c:	48 8b 1f             	mov    (%rdi),%rbx
+  80479f:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  8047a6:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8047ad:	00 00 00 
+  8047b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047b5:	eb 12                	jmp    8047c9 <mmap_pgfault+0x3e>
+  8047b7:	48 83 c2 01          	add    $0x1,%rdx
+  8047bb:	48 83 c0 20          	add    $0x20,%rax
+  8047bf:	48 83 fa 20          	cmp    $0x20,%rdx
+  8047c3:	0f 84 04 01 00 00    	je     8048cd <mmap_pgfault+0x142>
+        if (reg->start && va >= reg->start && va < reg->start + reg->size) return reg;
+  8047c9:	48 8b 08             	mov    (%rax),%rcx
+  8047cc:	48 8d 71 ff          	lea    -0x1(%rcx),%rsi
+  8047d0:	48 39 de             	cmp    %rbx,%rsi
+  8047d3:	73 e2                	jae    8047b7 <mmap_pgfault+0x2c>
+  8047d5:	48 03 48 08          	add    0x8(%rax),%rcx
+  8047d9:	48 39 cb             	cmp    %rcx,%rbx
+  8047dc:	73 d9                	jae    8047b7 <mmap_pgfault+0x2c>
+        struct MmapRegion *reg = &mmap_regions[i];
+  8047de:	48 c1 e2 05          	shl    $0x5,%rdx
+  8047e2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  8047e9:	00 00 00 
+  8047ec:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8047f0:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    struct MmapRegion *reg = mmap_find(va);
+    if (!reg) return 0;
+
+    /* Only writes to private pages fault on present pages */
+    if (utf->utf_err & FEC_P) {
+  8047f4:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8047f8:	f6 c2 01             	test   $0x1,%dl
+  8047fb:	0f 84 e0 00 00 00    	je     8048e1 <mmap_pgfault+0x156>
+        if (!(utf->utf_err & FEC_W) || !(reg->prot & PROT_W) || reg->flags != MAP_PRIVATE) return 0;
+  804801:	b8 00 00 00 00       	mov    $0x0,%eax
+  804806:	f6 c2 02             	test   $0x2,%dl
+  804809:	0f 84 c3 00 00 00    	je     8048d2 <mmap_pgfault+0x147>
+  80480f:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804816:	ff ff ff 
+  804819:	48 23 56 10          	and    0x10(%rsi),%rdx
+  80481d:	48 b9 02 00 00 00 02 	movabs $0x200000002,%rcx
+  804824:	00 00 00 
+  804827:	48 39 ca             	cmp    %rcx,%rdx
+  80482a:	0f 85 a2 00 00 00    	jne    8048d2 <mmap_pgfault+0x147>
+    int res = sys_alloc_region(CURENVID, tmp, PAGE_SIZE, PROT_RW);
+  804830:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804835:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80483a:	48 be 00 f0 ff ff 3f 	movabs $0x3ffffff000,%rsi
+  804841:	00 00 00 
+  804844:	bf 00 00 00 00       	mov    $0x0,%edi
+  804849:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  804850:	00 00 00 
+  804853:	ff d0                	call   *%rax
+  804855:	89 c2                	mov    %eax,%edx
+    if (res < 0) return 0;
+  804857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80485c:	85 d2                	test   %edx,%edx
+  80485e:	78 72                	js     8048d2 <mmap_pgfault+0x147>
+    memcpy(tmp, (void *)va, PAGE_SIZE);
+  804860:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804865:	48 89 de             	mov    %rbx,%rsi
+  804868:	49 bc 00 f0 ff ff 3f 	movabs $0x3ffffff000,%r12
+  80486f:	00 00 00 
+  804872:	4c 89 e7             	mov    %r12,%rdi
+  804875:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  80487c:	00 00 00 
+  80487f:	ff d0                	call   *%rax
+    res = sys_map_region(CURENVID, tmp, CURENVID, (void *)va, PAGE_SIZE, PROT_RW);
+  804881:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804887:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80488d:	48 89 d9             	mov    %rbx,%rcx
+  804890:	ba 00 00 00 00       	mov    $0x0,%edx
+  804895:	4c 89 e6             	mov    %r12,%rsi
+  804898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80489d:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  8048a4:	00 00 00 
+  8048a7:	ff d0                	call   *%rax
+  8048a9:	89 c3                	mov    %eax,%ebx
+    sys_unmap_region(CURENVID, tmp, PAGE_SIZE);
+  8048ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048b0:	4c 89 e6             	mov    %r12,%rsi
+  8048b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b8:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  8048bf:	00 00 00 
+  8048c2:	ff d0                	call   *%rax
+    return res >= 0;
+  8048c4:	89 d8                	mov    %ebx,%eax
+  8048c6:	f7 d0                	not    %eax
+  8048c8:	c1 e8 1f             	shr    $0x1f,%eax
+  8048cb:	eb 05                	jmp    8048d2 <mmap_pgfault+0x147>
+    if (!reg) return 0;
+  8048cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+
+    /* Access beyond the end of file is fatal */
+    return res > 0;
+}
+  8048d2:	48 83 c4 18          	add    $0x18,%rsp
+  8048d6:	5b                   	pop    %rbx
+  8048d7:	41 5c                	pop    %r12
+  8048d9:	41 5d                	pop    %r13
+  8048db:	41 5e                	pop    %r14
+  8048dd:	41 5f                	pop    %r15
+  8048df:	5d                   	pop    %rbp
+  8048e0:	c3                   	ret
+    uintptr_t end = MIN(reg->start + reg->size, va + MMAP_FAULT_PAGES * PAGE_SIZE);
+  8048e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048e5:	4c 8b 70 08          	mov    0x8(%rax),%r14
+  8048e9:	4c 03 30             	add    (%rax),%r14
+  8048ec:	48 8d 83 00 00 01 00 	lea    0x10000(%rbx),%rax
+  8048f3:	49 39 c6             	cmp    %rax,%r14
+  8048f6:	4c 0f 47 f0          	cmova  %rax,%r14
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  8048fa:	4c 8d a3 00 10 00 00 	lea    0x1000(%rbx),%r12
+    size_t size = PAGE_SIZE;
+  804901:	41 bd 00 10 00 00    	mov    $0x1000,%r13d
+    while (va + size < end && !is_page_present((void *)(va + size))) size += PAGE_SIZE;
+  804907:	49 bf c5 43 80 00 00 	movabs $0x8043c5,%r15
+  80490e:	00 00 00 
+  804911:	4d 39 f4             	cmp    %r14,%r12
+  804914:	73 1d                	jae    804933 <mmap_pgfault+0x1a8>
+  804916:	4c 89 e7             	mov    %r12,%rdi
+  804919:	41 ff d7             	call   *%r15
+  80491c:	84 c0                	test   %al,%al
+  80491e:	75 13                	jne    804933 <mmap_pgfault+0x1a8>
+  804920:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804927:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  80492e:	4d 39 f4             	cmp    %r14,%r12
+  804931:	72 e3                	jb     804916 <mmap_pgfault+0x18b>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  804933:	41 b8 04 00 00 00    	mov    $0x4,%r8d
+  804939:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80493d:	83 78 14 01          	cmpl   $0x1,0x14(%rax)
+  804941:	74 2a                	je     80496d <mmap_pgfault+0x1e2>
+    int res = file_map(reg->fdnum, reg->offset + (off_t)(va - reg->start), (void *)va, size, prot);
+  804943:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804947:	89 de                	mov    %ebx,%esi
+  804949:	2b 30                	sub    (%rax),%esi
+  80494b:	03 70 1c             	add    0x1c(%rax),%esi
+  80494e:	8b 78 18             	mov    0x18(%rax),%edi
+  804951:	4c 89 e9             	mov    %r13,%rcx
+  804954:	48 89 da             	mov    %rbx,%rdx
+  804957:	48 b8 23 3b 80 00 00 	movabs $0x803b23,%rax
+  80495e:	00 00 00 
+  804961:	ff d0                	call   *%rax
+    return res > 0;
+  804963:	85 c0                	test   %eax,%eax
+  804965:	0f 9f c0             	setg   %al
+  804968:	e9 65 ff ff ff       	jmp    8048d2 <mmap_pgfault+0x147>
+    int prot = reg->flags == MAP_SHARED ? reg->prot : PROT_R;
+  80496d:	44 8b 40 10          	mov    0x10(%rax),%r8d
+  804971:	eb d0                	jmp    804943 <mmap_pgfault+0x1b8>
+
+0000000000804973 <mmap_writeback>:
+    return (void *)start;
+}
+
+/* Write back dirty pages of shared region in [start, end) */
+static int
+mmap_writeback(struct MmapRegion *reg, uintptr_t start, uintptr_t end) {
+  804973:	55                   	push   %rbp
+  804974:	48 89 e5             	mov    %rsp,%rbp
+  804977:	41 57                	push   %r15
+  804979:	41 56                	push   %r14
+  80497b:	41 55                	push   %r13
+  80497d:	41 54                	push   %r12
+  80497f:	53                   	push   %rbx
+  804980:	48 83 ec 28          	sub    $0x28,%rsp
+  804984:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  804988:	49 89 d5             	mov    %rdx,%r13
+    if (reg->flags != MAP_SHARED || !(reg->prot & PROT_W)) return 0;
+  80498b:	48 ba 02 00 00 00 ff 	movabs $0xffffffff00000002,%rdx
+  804992:	ff ff ff 
+  804995:	48 23 57 10          	and    0x10(%rdi),%rdx
+  804999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80499e:	48 b9 02 00 00 00 01 	movabs $0x100000002,%rcx
+  8049a5:	00 00 00 
+  8049a8:	48 39 ca             	cmp    %rcx,%rdx
+  8049ab:	0f 85 e5 00 00 00    	jne    804a96 <mmap_writeback+0x123>
+  8049b1:	49 89 f4             	mov    %rsi,%r12
+
+    for (uintptr_t va = start; va < end;) {
+  8049b4:	4c 39 ee             	cmp    %r13,%rsi
+  8049b7:	0f 83 e8 00 00 00    	jae    804aa5 <mmap_writeback+0x132>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8049bd:	49 be c5 43 80 00 00 	movabs $0x8043c5,%r14
+  8049c4:	00 00 00 
+  8049c7:	49 bf ac 43 80 00 00 	movabs $0x8043ac,%r15
+  8049ce:	00 00 00 
+  8049d1:	eb 10                	jmp    8049e3 <mmap_writeback+0x70>
+            va += PAGE_SIZE;
+  8049d3:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+    for (uintptr_t va = start; va < end;) {
+  8049da:	4d 39 ec             	cmp    %r13,%r12
+  8049dd:	0f 83 ae 00 00 00    	jae    804a91 <mmap_writeback+0x11e>
+        if (!is_page_present((void *)va) || !is_page_dirty((void *)va)) {
+  8049e3:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8049e7:	4c 89 e7             	mov    %r12,%rdi
+  8049ea:	41 ff d6             	call   *%r14
+  8049ed:	84 c0                	test   %al,%al
+  8049ef:	74 e2                	je     8049d3 <mmap_writeback+0x60>
+  8049f1:	4c 89 e7             	mov    %r12,%rdi
+  8049f4:	41 ff d7             	call   *%r15
+  8049f7:	84 c0                	test   %al,%al
+  8049f9:	74 d8                	je     8049d3 <mmap_writeback+0x60>
+            continue;
+        }
+
+        uintptr_t run = va;
+        while (va < end && is_page_present((void *)va) && is_page_dirty((void *)va)) va += PAGE_SIZE;
+  8049fb:	4c 89 e3             	mov    %r12,%rbx
+  8049fe:	4d 39 ec             	cmp    %r13,%r12
+  804a01:	73 20                	jae    804a23 <mmap_writeback+0xb0>
+  804a03:	48 89 df             	mov    %rbx,%rdi
+  804a06:	41 ff d6             	call   *%r14
+  804a09:	84 c0                	test   %al,%al
+  804a0b:	74 16                	je     804a23 <mmap_writeback+0xb0>
+  804a0d:	48 89 df             	mov    %rbx,%rdi
+  804a10:	41 ff d7             	call   *%r15
+  804a13:	84 c0                	test   %al,%al
+  804a15:	74 0c                	je     804a23 <mmap_writeback+0xb0>
+  804a17:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804a1e:	4c 39 eb             	cmp    %r13,%rbx
+  804a21:	72 e0                	jb     804a03 <mmap_writeback+0x90>
+
+        int res = file_msync(reg->fdnum, reg->offset + (off_t)(run - reg->start), va - run);
+  804a23:	48 89 d9             	mov    %rbx,%rcx
+  804a26:	4c 29 e1             	sub    %r12,%rcx
+  804a29:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804a2d:	44 89 e6             	mov    %r12d,%esi
+  804a30:	2b 30                	sub    (%rax),%esi
+  804a32:	49 89 c4             	mov    %rax,%r12
+  804a35:	03 70 1c             	add    0x1c(%rax),%esi
+  804a38:	8b 78 18             	mov    0x18(%rax),%edi
+  804a3b:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  804a3f:	48 89 ca             	mov    %rcx,%rdx
+  804a42:	48 b8 ac 3b 80 00 00 	movabs $0x803bac,%rax
+  804a49:	00 00 00 
+  804a4c:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804a4e:	85 c0                	test   %eax,%eax
+  804a50:	78 44                	js     804a96 <mmap_writeback+0x123>
+
+        /* Clear dirty bits */
+        res = sys_map_region(CURENVID, (void *)run, CURENVID, (void *)run, va - run,
+  804a52:	41 8b 44 24 10       	mov    0x10(%r12),%eax
+  804a57:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  804a5a:	41 89 c1             	mov    %eax,%r9d
+  804a5d:	41 81 c9 40 01 00 00 	or     $0x140,%r9d
+  804a64:	4c 8b 45 c0          	mov    -0x40(%rbp),%r8
+  804a68:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  804a6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a71:	48 89 ce             	mov    %rcx,%rsi
+  804a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a79:	48 b8 47 28 80 00 00 	movabs $0x802847,%rax
+  804a80:	00 00 00 
+  804a83:	ff d0                	call   *%rax
+                             reg->prot | PROT_SHARE | PROT_COMBINE);
+        if (res < 0) return res;
+  804a85:	85 c0                	test   %eax,%eax
+  804a87:	78 0d                	js     804a96 <mmap_writeback+0x123>
+  804a89:	49 89 dc             	mov    %rbx,%r12
+  804a8c:	e9 49 ff ff ff       	jmp    8049da <mmap_writeback+0x67>
+    }
+
+    return 0;
+  804a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a96:	48 83 c4 28          	add    $0x28,%rsp
+  804a9a:	5b                   	pop    %rbx
+  804a9b:	41 5c                	pop    %r12
+  804a9d:	41 5d                	pop    %r13
+  804a9f:	41 5e                	pop    %r14
+  804aa1:	41 5f                	pop    %r15
+  804aa3:	5d                   	pop    %rbp
+  804aa4:	c3                   	ret
+    return 0;
+  804aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aaa:	eb ea                	jmp    804a96 <mmap_writeback+0x123>
+
+0000000000804aac <mmap>:
+mmap(void *addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804aac:	55                   	push   %rbp
+  804aad:	48 89 e5             	mov    %rsp,%rbp
+  804ab0:	41 57                	push   %r15
+  804ab2:	41 56                	push   %r14
+  804ab4:	41 55                	push   %r13
+  804ab6:	41 54                	push   %r12
+  804ab8:	53                   	push   %rbx
+  804ab9:	48 83 ec 38          	sub    $0x38,%rsp
+  804abd:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804ac1:	48 85 f6             	test   %rsi,%rsi
+  804ac4:	0f 84 0c 02 00 00    	je     804cd6 <mmap+0x22a>
+  804aca:	49 89 ff             	mov    %rdi,%r15
+  804acd:	49 89 f4             	mov    %rsi,%r12
+  804ad0:	41 89 d5             	mov    %edx,%r13d
+  804ad3:	41 89 ce             	mov    %ecx,%r14d
+  804ad6:	44 89 cb             	mov    %r9d,%ebx
+  804ad9:	45 85 c9             	test   %r9d,%r9d
+  804adc:	0f 88 f4 01 00 00    	js     804cd6 <mmap+0x22a>
+  804ae2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804ae9:	41 f7 c1 ff 0f 00 00 	test   $0xfff,%r9d
+  804af0:	0f 85 e7 01 00 00    	jne    804cdd <mmap+0x231>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return MAP_FAILED;
+  804af6:	83 e2 fd             	and    $0xfffffffd,%edx
+  804af9:	83 fa 04             	cmp    $0x4,%edx
+  804afc:	0f 85 db 01 00 00    	jne    804cdd <mmap+0x231>
+    if (flags != MAP_SHARED && flags != MAP_PRIVATE) return MAP_FAILED;
+  804b02:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804b05:	83 fa 01             	cmp    $0x1,%edx
+  804b08:	0f 87 cf 01 00 00    	ja     804cdd <mmap+0x231>
+    if (fd_lookup(fdnum, &fd) < 0 || fd->fd_dev_id != devfile.dev_id) return MAP_FAILED;
+  804b0e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804b12:	44 89 c7             	mov    %r8d,%edi
+  804b15:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  804b21:	89 c2                	mov    %eax,%edx
+  804b23:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b2a:	85 d2                	test   %edx,%edx
+  804b2c:	0f 88 ab 01 00 00    	js     804cdd <mmap+0x231>
+  804b32:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804b36:	48 b9 40 70 80 00 00 	movabs $0x807040,%rcx
+  804b3d:	00 00 00 
+  804b40:	8b 09                	mov    (%rcx),%ecx
+  804b42:	39 0a                	cmp    %ecx,(%rdx)
+  804b44:	0f 85 93 01 00 00    	jne    804cdd <mmap+0x231>
+    int omode = fd->fd_omode & O_ACCMODE;
+  804b4a:	8b 52 08             	mov    0x8(%rdx),%edx
+  804b4d:	83 e2 03             	and    $0x3,%edx
+    if (omode == O_WRONLY) return MAP_FAILED;
+  804b50:	83 fa 01             	cmp    $0x1,%edx
+  804b53:	0f 84 84 01 00 00    	je     804cdd <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804b59:	41 83 fe 01          	cmp    $0x1,%r14d
+  804b5d:	74 42                	je     804ba1 <mmap+0xf5>
+    len = ROUNDUP(len, PAGE_SIZE);
+  804b5f:	49 81 c4 ff 0f 00 00 	add    $0xfff,%r12
+  804b66:	4c 89 e6             	mov    %r12,%rsi
+  804b69:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804b70:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+    uintptr_t start = (uintptr_t)addr;
+  804b74:	4c 89 7d b0          	mov    %r15,-0x50(%rbp)
+    if (start) {
+  804b78:	4d 85 ff             	test   %r15,%r15
+  804b7b:	74 67                	je     804be4 <mmap+0x138>
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804b7d:	41 f7 c7 ff 0f 00 00 	test   $0xfff,%r15d
+  804b84:	75 0f                	jne    804b95 <mmap+0xe9>
+  804b86:	48 b8 ff ff ff ff 2f 	movabs $0x2fffffffff,%rax
+  804b8d:	00 00 00 
+  804b90:	49 39 c7             	cmp    %rax,%r15
+  804b93:	77 1b                	ja     804bb0 <mmap+0x104>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804b95:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804b9c:	e9 3c 01 00 00       	jmp    804cdd <mmap+0x231>
+    if (flags == MAP_SHARED && prot & PROT_W && omode == O_RDONLY) return MAP_FAILED;
+  804ba1:	41 f6 c5 02          	test   $0x2,%r13b
+  804ba5:	74 b8                	je     804b5f <mmap+0xb3>
+  804ba7:	85 d2                	test   %edx,%edx
+  804ba9:	75 b4                	jne    804b5f <mmap+0xb3>
+  804bab:	e9 2d 01 00 00       	jmp    804cdd <mmap+0x231>
+            mmap_place(start, len) != start) return MAP_FAILED;
+  804bb0:	4c 89 ff             	mov    %r15,%rdi
+  804bb3:	48 b8 1a 47 80 00 00 	movabs $0x80471a,%rax
+  804bba:	00 00 00 
+  804bbd:	ff d0                	call   *%rax
+  804bbf:	48 89 c2             	mov    %rax,%rdx
+  804bc2:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+        if (start & (PAGE_SIZE - 1) || start < UMMAP_BASE ||
+  804bc9:	49 39 d7             	cmp    %rdx,%r15
+  804bcc:	0f 85 0b 01 00 00    	jne    804cdd <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804bd2:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804bd9:	00 00 00 
+  804bdc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804be2:	eb 44                	jmp    804c28 <mmap+0x17c>
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804be4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  804be8:	48 bf 00 00 00 00 30 	movabs $0x3000000000,%rdi
+  804bef:	00 00 00 
+  804bf2:	48 b8 1a 47 80 00 00 	movabs $0x80471a,%rax
+  804bf9:	00 00 00 
+  804bfc:	ff d0                	call   *%rax
+  804bfe:	48 89 c7             	mov    %rax,%rdi
+  804c01:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+        return MAP_FAILED;
+  804c05:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+    } else if (!(start = mmap_place(UMMAP_BASE, len))) {
+  804c0c:	48 85 ff             	test   %rdi,%rdi
+  804c0f:	75 c1                	jne    804bd2 <mmap+0x126>
+  804c11:	e9 c7 00 00 00       	jmp    804cdd <mmap+0x231>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS && !reg; i++)
+  804c16:	49 83 c4 01          	add    $0x1,%r12
+  804c1a:	48 83 c0 20          	add    $0x20,%rax
+  804c1e:	49 83 fc 20          	cmp    $0x20,%r12
+  804c22:	0f 84 a5 00 00 00    	je     804ccd <mmap+0x221>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c28:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804c2c:	75 e8                	jne    804c16 <mmap+0x16a>
+    if (fd_alloc(&dupfd) < 0) return MAP_FAILED;
+  804c2e:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+  804c32:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  804c39:	00 00 00 
+  804c3c:	ff d0                	call   *%rax
+  804c3e:	89 c2                	mov    %eax,%edx
+  804c40:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c47:	85 d2                	test   %edx,%edx
+  804c49:	0f 88 8e 00 00 00    	js     804cdd <mmap+0x231>
+    int dupnum = dup(fdnum, fd2num(dupfd));
+  804c4f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  804c53:	48 b8 38 2e 80 00 00 	movabs $0x802e38,%rax
+  804c5a:	00 00 00 
+  804c5d:	ff d0                	call   *%rax
+  804c5f:	89 c6                	mov    %eax,%esi
+  804c61:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  804c64:	48 b8 86 30 80 00 00 	movabs $0x803086,%rax
+  804c6b:	00 00 00 
+  804c6e:	ff d0                	call   *%rax
+  804c70:	41 89 c7             	mov    %eax,%r15d
+    if (dupnum < 0) return MAP_FAILED;
+  804c73:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804c7a:	45 85 ff             	test   %r15d,%r15d
+  804c7d:	78 5e                	js     804cdd <mmap+0x231>
+        if (!mmap_regions[i].start) reg = &mmap_regions[i];
+  804c7f:	49 c1 e4 05          	shl    $0x5,%r12
+  804c83:	48 b8 20 a0 80 01 00 	movabs $0x180a020,%rax
+  804c8a:	00 00 00 
+  804c8d:	49 01 c4             	add    %rax,%r12
+    add_pgfault_handler(mmap_pgfault);
+  804c90:	48 bf 8b 47 80 00 00 	movabs $0x80478b,%rdi
+  804c97:	00 00 00 
+  804c9a:	48 b8 59 52 80 00 00 	movabs $0x805259,%rax
+  804ca1:	00 00 00 
+  804ca4:	ff d0                	call   *%rax
+    *reg = (struct MmapRegion){
+  804ca6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804caa:	49 89 04 24          	mov    %rax,(%r12)
+  804cae:	48 8b 7d a8          	mov    -0x58(%rbp),%rdi
+  804cb2:	49 89 7c 24 08       	mov    %rdi,0x8(%r12)
+  804cb7:	45 89 6c 24 10       	mov    %r13d,0x10(%r12)
+  804cbc:	45 89 74 24 14       	mov    %r14d,0x14(%r12)
+  804cc1:	45 89 7c 24 18       	mov    %r15d,0x18(%r12)
+  804cc6:	41 89 5c 24 1c       	mov    %ebx,0x1c(%r12)
+    return (void *)start;
+  804ccb:	eb 10                	jmp    804cdd <mmap+0x231>
+    if (!reg) return MAP_FAILED;
+  804ccd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804cd4:	eb 07                	jmp    804cdd <mmap+0x231>
+    if (!len || offset < 0 || offset & (PAGE_SIZE - 1)) return MAP_FAILED;
+  804cd6:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+}
+  804cdd:	48 83 c4 38          	add    $0x38,%rsp
+  804ce1:	5b                   	pop    %rbx
+  804ce2:	41 5c                	pop    %r12
+  804ce4:	41 5d                	pop    %r13
+  804ce6:	41 5e                	pop    %r14
+  804ce8:	41 5f                	pop    %r15
+  804cea:	5d                   	pop    %rbp
+  804ceb:	c3                   	ret
+
+0000000000804cec <msync>:
+
+/* Write modified pages of shared mappings in [addr, addr + len) to disk */
+int
+msync(void *addr, size_t len) {
+  804cec:	55                   	push   %rbp
+  804ced:	48 89 e5             	mov    %rsp,%rbp
+  804cf0:	41 57                	push   %r15
+  804cf2:	41 56                	push   %r14
+  804cf4:	41 55                	push   %r13
+  804cf6:	41 54                	push   %r12
+  804cf8:	53                   	push   %rbx
+  804cf9:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804cfd:	49 89 fe             	mov    %rdi,%r14
+  804d00:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d07:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804d0e:	00 
+  804d0f:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d16:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804d1d:	00 00 00 
+  804d20:	4c 8d ab 00 04 00 00 	lea    0x400(%rbx),%r13
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d27:	49 bf 73 49 80 00 00 	movabs $0x804973,%r15
+  804d2e:	00 00 00 
+  804d31:	eb 09                	jmp    804d3c <msync+0x50>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804d33:	48 83 c3 20          	add    $0x20,%rbx
+  804d37:	4c 39 eb             	cmp    %r13,%rbx
+  804d3a:	74 33                	je     804d6f <msync+0x83>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804d3c:	48 89 df             	mov    %rbx,%rdi
+  804d3f:	48 8b 33             	mov    (%rbx),%rsi
+  804d42:	4c 39 e6             	cmp    %r12,%rsi
+  804d45:	73 ec                	jae    804d33 <msync+0x47>
+  804d47:	48 85 f6             	test   %rsi,%rsi
+  804d4a:	74 e7                	je     804d33 <msync+0x47>
+  804d4c:	48 89 f2             	mov    %rsi,%rdx
+  804d4f:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804d53:	49 39 d6             	cmp    %rdx,%r14
+  804d56:	73 db                	jae    804d33 <msync+0x47>
+        int res = mmap_writeback(reg, MAX(start, reg->start), MIN(end, reg->start + reg->size));
+  804d58:	4c 39 e2             	cmp    %r12,%rdx
+  804d5b:	49 0f 47 d4          	cmova  %r12,%rdx
+  804d5f:	4c 39 f6             	cmp    %r14,%rsi
+  804d62:	49 0f 42 f6          	cmovb  %r14,%rsi
+  804d66:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804d69:	85 c0                	test   %eax,%eax
+  804d6b:	79 c6                	jns    804d33 <msync+0x47>
+  804d6d:	eb 05                	jmp    804d74 <msync+0x88>
+    }
+
+    return 0;
+  804d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d74:	48 83 c4 08          	add    $0x8,%rsp
+  804d78:	5b                   	pop    %rbx
+  804d79:	41 5c                	pop    %r12
+  804d7b:	41 5d                	pop    %r13
+  804d7d:	41 5e                	pop    %r14
+  804d7f:	41 5f                	pop    %r15
+  804d81:	5d                   	pop    %rbp
+  804d82:	c3                   	ret
+
+0000000000804d83 <munmap>:
+
+/* Remove mappings in [addr, addr + len), which must not
+ * cover mappings partially.  Shared mappings are synced first. */
+int
+munmap(void *addr, size_t len) {
+  804d83:	55                   	push   %rbp
+  804d84:	48 89 e5             	mov    %rsp,%rbp
+  804d87:	41 57                	push   %r15
+  804d89:	41 56                	push   %r14
+  804d8b:	41 55                	push   %r13
+  804d8d:	41 54                	push   %r12
+  804d8f:	53                   	push   %rbx
+  804d90:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = ROUNDDOWN((uintptr_t)addr, PAGE_SIZE);
+  804d94:	49 89 ff             	mov    %rdi,%r15
+  804d97:	49 81 e7 00 f0 ff ff 	and    $0xfffffffffffff000,%r15
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804d9e:	4c 8d a4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r12
+  804da5:	00 
+  804da6:	49 81 e4 00 f0 ff ff 	and    $0xfffffffffffff000,%r12
+
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804dad:	48 bb 20 a0 80 01 00 	movabs $0x180a020,%rbx
+  804db4:	00 00 00 
+  804db7:	4c 8d b3 00 04 00 00 	lea    0x400(%rbx),%r14
+    uintptr_t end = ROUNDUP((uintptr_t)addr + len, PAGE_SIZE);
+  804dbe:	48 89 d8             	mov    %rbx,%rax
+  804dc1:	eb 09                	jmp    804dcc <munmap+0x49>
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804dc3:	48 83 c0 20          	add    $0x20,%rax
+  804dc7:	4c 39 f0             	cmp    %r14,%rax
+  804dca:	74 40                	je     804e0c <munmap+0x89>
+        struct MmapRegion *reg = &mmap_regions[i];
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804dcc:	48 8b 10             	mov    (%rax),%rdx
+  804dcf:	4c 39 e2             	cmp    %r12,%rdx
+  804dd2:	73 ef                	jae    804dc3 <munmap+0x40>
+  804dd4:	48 85 d2             	test   %rdx,%rdx
+  804dd7:	74 ea                	je     804dc3 <munmap+0x40>
+  804dd9:	48 89 d7             	mov    %rdx,%rdi
+  804ddc:	48 03 78 08          	add    0x8(%rax),%rdi
+  804de0:	49 39 ff             	cmp    %rdi,%r15
+  804de3:	73 de                	jae    804dc3 <munmap+0x40>
+        if (reg->start < start || reg->start + reg->size > end) return -E_INVAL;
+  804de5:	49 39 fc             	cmp    %rdi,%r12
+  804de8:	72 05                	jb     804def <munmap+0x6c>
+  804dea:	4c 39 fa             	cmp    %r15,%rdx
+  804ded:	73 d4                	jae    804dc3 <munmap+0x40>
+  804def:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+        close(reg->fdnum);
+        reg->start = 0;
+    }
+
+    return 0;
+}
+  804df4:	48 83 c4 08          	add    $0x8,%rsp
+  804df8:	5b                   	pop    %rbx
+  804df9:	41 5c                	pop    %r12
+  804dfb:	41 5d                	pop    %r13
+  804dfd:	41 5e                	pop    %r14
+  804dff:	41 5f                	pop    %r15
+  804e01:	5d                   	pop    %rbp
+  804e02:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX_REGIONS; i++) {
+  804e03:	48 83 c3 20          	add    $0x20,%rbx
+  804e07:	4c 39 f3             	cmp    %r14,%rbx
+  804e0a:	74 5c                	je     804e68 <munmap+0xe5>
+        if (!reg->start || reg->start >= end || reg->start + reg->size <= start) continue;
+  804e0c:	48 8b 33             	mov    (%rbx),%rsi
+  804e0f:	4c 39 e6             	cmp    %r12,%rsi
+  804e12:	73 ef                	jae    804e03 <munmap+0x80>
+  804e14:	48 85 f6             	test   %rsi,%rsi
+  804e17:	74 ea                	je     804e03 <munmap+0x80>
+  804e19:	48 89 f2             	mov    %rsi,%rdx
+  804e1c:	48 03 53 08          	add    0x8(%rbx),%rdx
+  804e20:	49 39 d7             	cmp    %rdx,%r15
+  804e23:	73 de                	jae    804e03 <munmap+0x80>
+        int res = mmap_writeback(reg, reg->start, reg->start + reg->size);
+  804e25:	48 89 df             	mov    %rbx,%rdi
+  804e28:	48 b8 73 49 80 00 00 	movabs $0x804973,%rax
+  804e2f:	00 00 00 
+  804e32:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  804e34:	85 c0                	test   %eax,%eax
+  804e36:	78 bc                	js     804df4 <munmap+0x71>
+        sys_unmap_region(CURENVID, (void *)reg->start, reg->size);
+  804e38:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804e3c:	48 8b 33             	mov    (%rbx),%rsi
+  804e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e44:	48 b8 b2 28 80 00 00 	movabs $0x8028b2,%rax
+  804e4b:	00 00 00 
+  804e4e:	ff d0                	call   *%rax
+        close(reg->fdnum);
+  804e50:	8b 7b 18             	mov    0x18(%rbx),%edi
+  804e53:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  804e5a:	00 00 00 
+  804e5d:	ff d0                	call   *%rax
+        reg->start = 0;
+  804e5f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804e66:	eb 9b                	jmp    804e03 <munmap+0x80>
+    return 0;
+  804e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e6d:	eb 85                	jmp    804df4 <munmap+0x71>
+
+0000000000804e6f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e74:	c3                   	ret
+
+0000000000804e75 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804e75:	55                   	push   %rbp
+  804e76:	48 89 e5             	mov    %rsp,%rbp
+  804e79:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804e7c:	48 be 05 64 80 00 00 	movabs $0x806405,%rsi
+  804e83:	00 00 00 
+  804e86:	48 b8 75 20 80 00 00 	movabs $0x802075,%rax
+  804e8d:	00 00 00 
+  804e90:	ff d0                	call   *%rax
+    return 0;
+}
+  804e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e97:	5d                   	pop    %rbp
+  804e98:	c3                   	ret
+
+0000000000804e99 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e99:	55                   	push   %rbp
+  804e9a:	48 89 e5             	mov    %rsp,%rbp
+  804e9d:	41 57                	push   %r15
+  804e9f:	41 56                	push   %r14
+  804ea1:	41 55                	push   %r13
+  804ea3:	41 54                	push   %r12
+  804ea5:	53                   	push   %rbx
+  804ea6:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804ead:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    char buf[WRITEBUFSZ] = {};
+  804eb4:	48 c7 85 50 ff ff ff 	movq   $0x0,-0xb0(%rbp)
+  804ebb:	00 00 00 00 
+  804ebf:	48 c7 85 58 ff ff ff 	movq   $0x0,-0xa8(%rbp)
+  804ec6:	00 00 00 00 
+  804eca:	48 c7 85 60 ff ff ff 	movq   $0x0,-0xa0(%rbp)
+  804ed1:	00 00 00 00 
+  804ed5:	48 c7 85 68 ff ff ff 	movq   $0x0,-0x98(%rbp)
+  804edc:	00 00 00 00 
+  804ee0:	48 c7 85 70 ff ff ff 	movq   $0x0,-0x90(%rbp)
+  804ee7:	00 00 00 00 
+  804eeb:	48 c7 85 78 ff ff ff 	movq   $0x0,-0x88(%rbp)
+  804ef2:	00 00 00 00 
+  804ef6:	48 c7 45 80 00 00 00 	movq   $0x0,-0x80(%rbp)
+  804efd:	00 
+  804efe:	48 c7 45 88 00 00 00 	movq   $0x0,-0x78(%rbp)
+  804f05:	00 
+  804f06:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  804f0d:	00 
+  804f0e:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  804f15:	00 
+  804f16:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  804f1d:	00 
+  804f1e:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  804f25:	00 
+  804f26:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  804f2d:	00 
+  804f2e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804f35:	00 
+  804f36:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  804f3d:	00 
+  804f3e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  804f45:	00 
+    for (res = 0; res < n; res += inc) {
+  804f46:	48 85 d2             	test   %rdx,%rdx
+  804f49:	74 7a                	je     804fc5 <devcons_write+0x12c>
+  804f4b:	49 89 d6             	mov    %rdx,%r14
+  804f4e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f54:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804f59:	49 bf c5 23 80 00 00 	movabs $0x8023c5,%r15
+  804f60:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804f63:	4c 89 f3             	mov    %r14,%rbx
+  804f66:	48 29 f3             	sub    %rsi,%rbx
+  804f69:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804f6e:	48 39 c3             	cmp    %rax,%rbx
+  804f71:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804f75:	4c 63 eb             	movslq %ebx,%r13
+  804f78:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804f7f:	48 01 c6             	add    %rax,%rsi
+  804f82:	4c 89 ea             	mov    %r13,%rdx
+  804f85:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f8c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804f8f:	4c 89 ee             	mov    %r13,%rsi
+  804f92:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804f99:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  804fa0:	00 00 00 
+  804fa3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804fa5:	41 01 dc             	add    %ebx,%r12d
+  804fa8:	49 63 f4             	movslq %r12d,%rsi
+  804fab:	4c 39 f6             	cmp    %r14,%rsi
+  804fae:	72 b3                	jb     804f63 <devcons_write+0xca>
+    return res;
+  804fb0:	49 63 c4             	movslq %r12d,%rax
+}
+  804fb3:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804fba:	5b                   	pop    %rbx
+  804fbb:	41 5c                	pop    %r12
+  804fbd:	41 5d                	pop    %r13
+  804fbf:	41 5e                	pop    %r14
+  804fc1:	41 5f                	pop    %r15
+  804fc3:	5d                   	pop    %rbp
+  804fc4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804fc5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fcb:	eb e3                	jmp    804fb0 <devcons_write+0x117>
+
+0000000000804fcd <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fcd:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fd5:	48 85 c0             	test   %rax,%rax
+  804fd8:	74 55                	je     80502f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fda:	55                   	push   %rbp
+  804fdb:	48 89 e5             	mov    %rsp,%rbp
+  804fde:	41 55                	push   %r13
+  804fe0:	41 54                	push   %r12
+  804fe2:	53                   	push   %rbx
+  804fe3:	48 83 ec 08          	sub    $0x8,%rsp
+  804fe7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804fea:	48 bb 25 26 80 00 00 	movabs $0x802625,%rbx
+  804ff1:	00 00 00 
+  804ff4:	49 bc 39 27 80 00 00 	movabs $0x802739,%r12
+  804ffb:	00 00 00 
+  804ffe:	eb 03                	jmp    805003 <devcons_read+0x36>
+  805000:	41 ff d4             	call   *%r12
+  805003:	ff d3                	call   *%rbx
+  805005:	85 c0                	test   %eax,%eax
+  805007:	74 f7                	je     805000 <devcons_read+0x33>
+    if (c < 0) return c;
+  805009:	48 63 d0             	movslq %eax,%rdx
+  80500c:	78 13                	js     805021 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80500e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805013:	83 f8 04             	cmp    $0x4,%eax
+  805016:	74 09                	je     805021 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805018:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80501c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805021:	48 89 d0             	mov    %rdx,%rax
+  805024:	48 83 c4 08          	add    $0x8,%rsp
+  805028:	5b                   	pop    %rbx
+  805029:	41 5c                	pop    %r12
+  80502b:	41 5d                	pop    %r13
+  80502d:	5d                   	pop    %rbp
+  80502e:	c3                   	ret
+  80502f:	48 89 d0             	mov    %rdx,%rax
+  805032:	c3                   	ret
+
+0000000000805033 <cputchar>:
+cputchar(int ch) {
+  805033:	55                   	push   %rbp
+  805034:	48 89 e5             	mov    %rsp,%rbp
+  805037:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80503b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80503f:	be 01 00 00 00       	mov    $0x1,%esi
+  805044:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  805048:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  80504f:	00 00 00 
+  805052:	ff d0                	call   *%rax
+}
+  805054:	c9                   	leave
+  805055:	c3                   	ret
+
+0000000000805056 <getchar>:
+getchar(void) {
+  805056:	55                   	push   %rbp
+  805057:	48 89 e5             	mov    %rsp,%rbp
+  80505a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80505e:	ba 01 00 00 00       	mov    $0x1,%edx
+  805063:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805067:	bf 00 00 00 00       	mov    $0x0,%edi
+  80506c:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  805073:	00 00 00 
+  805076:	ff d0                	call   *%rax
+  805078:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80507a:	85 c0                	test   %eax,%eax
+  80507c:	78 06                	js     805084 <getchar+0x2e>
+  80507e:	74 08                	je     805088 <getchar+0x32>
+  805080:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805084:	89 d0                	mov    %edx,%eax
+  805086:	c9                   	leave
+  805087:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805088:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80508d:	eb f5                	jmp    805084 <getchar+0x2e>
+
+000000000080508f <iscons>:
+iscons(int fdnum) {
+  80508f:	55                   	push   %rbp
+  805090:	48 89 e5             	mov    %rsp,%rbp
+  805093:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805097:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80509b:	48 b8 c6 2e 80 00 00 	movabs $0x802ec6,%rax
+  8050a2:	00 00 00 
+  8050a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8050a7:	85 c0                	test   %eax,%eax
+  8050a9:	78 18                	js     8050c3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8050ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050af:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8050b6:	00 00 00 
+  8050b9:	8b 00                	mov    (%rax),%eax
+  8050bb:	39 02                	cmp    %eax,(%rdx)
+  8050bd:	0f 94 c0             	sete   %al
+  8050c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8050c3:	c9                   	leave
+  8050c4:	c3                   	ret
+
+00000000008050c5 <opencons>:
+opencons(void) {
+  8050c5:	55                   	push   %rbp
+  8050c6:	48 89 e5             	mov    %rsp,%rbp
+  8050c9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8050cd:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8050d1:	48 b8 66 2e 80 00 00 	movabs $0x802e66,%rax
+  8050d8:	00 00 00 
+  8050db:	ff d0                	call   *%rax
+  8050dd:	85 c0                	test   %eax,%eax
+  8050df:	78 49                	js     80512a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8050e1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8050e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050eb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8050ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050f4:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  8050fb:	00 00 00 
+  8050fe:	ff d0                	call   *%rax
+  805100:	85 c0                	test   %eax,%eax
+  805102:	78 26                	js     80512a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  805104:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805108:	a1 c0 70 80 00 00 00 	movabs 0x8070c0,%eax
+  80510f:	00 00 
+  805111:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805113:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805117:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80511e:	48 b8 38 2e 80 00 00 	movabs $0x802e38,%rax
+  805125:	00 00 00 
+  805128:	ff d0                	call   *%rax
+}
+  80512a:	c9                   	leave
+  80512b:	c3                   	ret
+
+000000000080512c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80512c:	55                   	push   %rbp
+  80512d:	48 89 e5             	mov    %rsp,%rbp
+  805130:	41 56                	push   %r14
+  805132:	41 55                	push   %r13
+  805134:	41 54                	push   %r12
+  805136:	53                   	push   %rbx
+  805137:	48 83 ec 50          	sub    $0x50,%rsp
+  80513b:	49 89 fc             	mov    %rdi,%r12
+  80513e:	41 89 f5             	mov    %esi,%r13d
+  805141:	48 89 d3             	mov    %rdx,%rbx
+  805144:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805148:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80514c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  805150:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  805157:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80515b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80515f:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  805163:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  805167:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  80516e:	00 00 00 
+  805171:	4c 8b 30             	mov    (%rax),%r14
+  805174:	48 b8 02 27 80 00 00 	movabs $0x802702,%rax
+  80517b:	00 00 00 
+  80517e:	ff d0                	call   *%rax
+  805180:	89 c6                	mov    %eax,%esi
+  805182:	45 89 e8             	mov    %r13d,%r8d
+  805185:	4c 89 e1             	mov    %r12,%rcx
+  805188:	4c 89 f2             	mov    %r14,%rdx
+  80518b:	48 bf 18 64 80 00 00 	movabs $0x806418,%rdi
+  805192:	00 00 00 
+  805195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80519a:	49 bc 3e 17 80 00 00 	movabs $0x80173e,%r12
+  8051a1:	00 00 00 
+  8051a4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8051a7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8051ab:	48 89 df             	mov    %rbx,%rdi
+  8051ae:	48 b8 da 16 80 00 00 	movabs $0x8016da,%rax
+  8051b5:	00 00 00 
+  8051b8:	ff d0                	call   *%rax
+    cprintf("\n");
+  8051ba:	48 bf f3 62 80 00 00 	movabs $0x8062f3,%rdi
+  8051c1:	00 00 00 
+  8051c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c9:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8051cc:	cc                   	int3
+  8051cd:	eb fd                	jmp    8051cc <_panic+0xa0>
+
+00000000008051cf <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8051cf:	55                   	push   %rbp
+  8051d0:	48 89 e5             	mov    %rsp,%rbp
+  8051d3:	41 56                	push   %r14
+  8051d5:	41 55                	push   %r13
+  8051d7:	41 54                	push   %r12
+  8051d9:	53                   	push   %rbx
+  8051da:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051dd:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  8051e4:	00 00 00 
+  8051e7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051eb:	74 27                	je     805214 <_handle_vectored_pagefault+0x45>
+  8051ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8051f2:	49 bd 20 a4 80 01 00 	movabs $0x180a420,%r13
+  8051f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051fc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8051ff:	4c 89 e7             	mov    %r12,%rdi
+  805202:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805207:	84 c0                	test   %al,%al
+  805209:	75 45                	jne    805250 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520b:	48 83 c3 01          	add    $0x1,%rbx
+  80520f:	49 3b 1e             	cmp    (%r14),%rbx
+  805212:	72 eb                	jb     8051ff <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805214:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80521b:	00 
+  80521c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805221:	4d 8b 04 24          	mov    (%r12),%r8
+  805225:	48 ba 40 64 80 00 00 	movabs $0x806440,%rdx
+  80522c:	00 00 00 
+  80522f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805234:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  80523b:	00 00 00 
+  80523e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805243:	49 ba 2c 51 80 00 00 	movabs $0x80512c,%r10
+  80524a:	00 00 00 
+  80524d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805250:	5b                   	pop    %rbx
+  805251:	41 5c                	pop    %r12
+  805253:	41 5d                	pop    %r13
+  805255:	41 5e                	pop    %r14
+  805257:	5d                   	pop    %rbp
+  805258:	c3                   	ret
+
+0000000000805259 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805259:	55                   	push   %rbp
+  80525a:	48 89 e5             	mov    %rsp,%rbp
+  80525d:	53                   	push   %rbx
+  80525e:	48 83 ec 08          	sub    $0x8,%rsp
+  805262:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+  805265:	be 00 00 00 00       	mov    $0x0,%esi
+    if (!_pfhandler_inititiallized) {
+  80526a:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805271:	00 00 00 
+  805274:	80 38 00             	cmpb   $0x0,(%rax)
+  805277:	74 68                	je     8052e1 <add_pgfault_handler+0x88>
+            goto end;
+
+        _pfhandler_inititiallized = 1;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805279:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805280:	00 00 00 
+  805283:	48 8b 08             	mov    (%rax),%rcx
+  805286:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (handler == _pfhandler_vec[i]) return 0;
+  80528b:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  805292:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805295:	48 85 c9             	test   %rcx,%rcx
+  805298:	0f 84 e0 00 00 00    	je     80537e <add_pgfault_handler+0x125>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80529e:	48 39 1c d0          	cmp    %rbx,(%rax,%rdx,8)
+  8052a2:	0f 84 c9 00 00 00    	je     805371 <add_pgfault_handler+0x118>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8052a8:	48 83 c2 01          	add    $0x1,%rdx
+  8052ac:	48 39 ca             	cmp    %rcx,%rdx
+  8052af:	75 ed                	jne    80529e <add_pgfault_handler+0x45>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8052b1:	48 83 f9 08          	cmp    $0x8,%rcx
+  8052b5:	0f 84 84 00 00 00    	je     80533f <add_pgfault_handler+0xe6>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052bb:	48 8d 41 01          	lea    0x1(%rcx),%rax
+  8052bf:	48 a3 68 a4 80 01 00 	movabs %rax,0x180a468
+  8052c6:	00 00 00 
+  8052c9:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  8052d0:	00 00 00 
+  8052d3:	48 89 1c c8          	mov    %rbx,(%rax,%rcx,8)
+
+end:
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052d7:	85 f6                	test   %esi,%esi
+  8052d9:	0f 89 97 00 00 00    	jns    805376 <add_pgfault_handler+0x11d>
+  8052df:	eb 63                	jmp    805344 <add_pgfault_handler+0xeb>
+        res = sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - USER_EXCEPTION_STACK_SIZE),
+  8052e1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052e6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8052eb:	48 be 00 80 ff ff 7f 	movabs $0x7fffff8000,%rsi
+  8052f2:	00 00 00 
+  8052f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052fa:	48 b8 da 27 80 00 00 	movabs $0x8027da,%rax
+  805301:	00 00 00 
+  805304:	ff d0                	call   *%rax
+  805306:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805308:	85 c0                	test   %eax,%eax
+  80530a:	78 38                	js     805344 <add_pgfault_handler+0xeb>
+        res = sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80530c:	48 be 5a 54 80 00 00 	movabs $0x80545a,%rsi
+  805313:	00 00 00 
+  805316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80531b:	48 b8 fd 29 80 00 00 	movabs $0x8029fd,%rax
+  805322:	00 00 00 
+  805325:	ff d0                	call   *%rax
+  805327:	89 c6                	mov    %eax,%esi
+        if (res < 0)
+  805329:	85 c0                	test   %eax,%eax
+  80532b:	78 17                	js     805344 <add_pgfault_handler+0xeb>
+        _pfhandler_inititiallized = 1;
+  80532d:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  805334:	00 00 00 
+  805337:	c6 00 01             	movb   $0x1,(%rax)
+  80533a:	e9 3a ff ff ff       	jmp    805279 <add_pgfault_handler+0x20>
+        res = -E_INVAL;
+  80533f:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805344:	89 f1                	mov    %esi,%ecx
+  805346:	48 ba 7e 64 80 00 00 	movabs $0x80647e,%rdx
+  80534d:	00 00 00 
+  805350:	be 42 00 00 00       	mov    $0x42,%esi
+  805355:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  80535c:	00 00 00 
+  80535f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805364:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  80536b:	00 00 00 
+  80536e:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805371:	be 00 00 00 00       	mov    $0x0,%esi
+    return res;
+}
+  805376:	89 f0                	mov    %esi,%eax
+  805378:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80537c:	c9                   	leave
+  80537d:	c3                   	ret
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80537e:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805385:	00 00 00 
+  805388:	48 c7 00 01 00 00 00 	movq   $0x1,(%rax)
+  80538f:	48 89 d8             	mov    %rbx,%rax
+  805392:	48 a3 20 a4 80 01 00 	movabs %rax,0x180a420
+  805399:	00 00 00 
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80539c:	eb d8                	jmp    805376 <add_pgfault_handler+0x11d>
+
+000000000080539e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80539e:	55                   	push   %rbp
+  80539f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8053a2:	48 b8 60 a4 80 01 00 	movabs $0x180a460,%rax
+  8053a9:	00 00 00 
+  8053ac:	80 38 00             	cmpb   $0x0,(%rax)
+  8053af:	74 33                	je     8053e4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053b1:	48 a1 68 a4 80 01 00 	movabs 0x180a468,%rax
+  8053b8:	00 00 00 
+  8053bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8053c0:	48 ba 20 a4 80 01 00 	movabs $0x180a420,%rdx
+  8053c7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053ca:	48 85 c0             	test   %rax,%rax
+  8053cd:	0f 84 85 00 00 00    	je     805458 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8053d3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8053d7:	74 40                	je     805419 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053d9:	48 83 c1 01          	add    $0x1,%rcx
+  8053dd:	48 39 c1             	cmp    %rax,%rcx
+  8053e0:	75 f1                	jne    8053d3 <remove_pgfault_handler+0x35>
+  8053e2:	eb 74                	jmp    805458 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8053e4:	48 b9 96 64 80 00 00 	movabs $0x806496,%rcx
+  8053eb:	00 00 00 
+  8053ee:	48 ba 56 63 80 00 00 	movabs $0x806356,%rdx
+  8053f5:	00 00 00 
+  8053f8:	be 48 00 00 00       	mov    $0x48,%esi
+  8053fd:	48 bf 70 64 80 00 00 	movabs $0x806470,%rdi
+  805404:	00 00 00 
+  805407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80540c:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  805413:	00 00 00 
+  805416:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805419:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805420:	00 
+  805421:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805425:	48 29 ca             	sub    %rcx,%rdx
+  805428:	48 b8 20 a4 80 01 00 	movabs $0x180a420,%rax
+  80542f:	00 00 00 
+  805432:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805436:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80543b:	48 89 ce             	mov    %rcx,%rsi
+  80543e:	48 b8 c5 23 80 00 00 	movabs $0x8023c5,%rax
+  805445:	00 00 00 
+  805448:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80544a:	48 b8 68 a4 80 01 00 	movabs $0x180a468,%rax
+  805451:	00 00 00 
+  805454:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805458:	5d                   	pop    %rbp
+  805459:	c3                   	ret
+
+000000000080545a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80545a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80545d:	48 b8 cf 51 80 00 00 	movabs $0x8051cf,%rax
+  805464:	00 00 00 
+    call *%rax
+  805467:	ff d0                	call   *%rax
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here DONE
+    // rcx = trap_rsp,
+    // rdx = trap_rip
+    movq UTRAP_RSP(%rsp), %rcx
+  805469:	48 8b 8c 24 98 00 00 	mov    0x98(%rsp),%rcx
+  805470:	00 
+    movq UTRAP_RIP(%rsp), %rdx
+  805471:	48 8b 94 24 88 00 00 	mov    0x88(%rsp),%rdx
+  805478:	00 
+    subq $8, %rcx
+  805479:	48 83 e9 08          	sub    $0x8,%rcx
+    movq %rdx, (%rcx)
+  80547d:	48 89 11             	mov    %rdx,(%rcx)
+    movq %rcx, UTRAP_RSP(%rsp)
+  805480:	48 89 8c 24 98 00 00 	mov    %rcx,0x98(%rsp)
+  805487:	00 
+
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here DONE
+    addq $16, %rsp
+  805488:	48 83 c4 10          	add    $0x10,%rsp
+    POPA
+  80548c:	4c 8b 3c 24          	mov    (%rsp),%r15
+  805490:	4c 8b 74 24 08       	mov    0x8(%rsp),%r14
+  805495:	4c 8b 6c 24 10       	mov    0x10(%rsp),%r13
+  80549a:	4c 8b 64 24 18       	mov    0x18(%rsp),%r12
+  80549f:	4c 8b 5c 24 20       	mov    0x20(%rsp),%r11
+  8054a4:	4c 8b 54 24 28       	mov    0x28(%rsp),%r10
+  8054a9:	4c 8b 4c 24 30       	mov    0x30(%rsp),%r9
+  8054ae:	4c 8b 44 24 38       	mov    0x38(%rsp),%r8
+  8054b3:	48 8b 74 24 40       	mov    0x40(%rsp),%rsi
+  8054b8:	48 8b 7c 24 48       	mov    0x48(%rsp),%rdi
+  8054bd:	48 8b 6c 24 50       	mov    0x50(%rsp),%rbp
+  8054c2:	48 8b 54 24 58       	mov    0x58(%rsp),%rdx
+  8054c7:	48 8b 4c 24 60       	mov    0x60(%rsp),%rcx
+  8054cc:	48 8b 5c 24 68       	mov    0x68(%rsp),%rbx
+  8054d1:	48 8b 44 24 70       	mov    0x70(%rsp),%rax
+  8054d6:	48 83 c4 78          	add    $0x78,%rsp
+
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here DONE
+    addq $8, %rsp
+  8054da:	48 83 c4 08          	add    $0x8,%rsp
+    popf
+  8054de:	9d                   	popf
+
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here DONE
+    popq %rsp
+  8054df:	5c                   	pop    %rsp
+
+    # Return to re-execute the instruction that faulted.
+    ret
+  8054e0:	c3                   	ret
+
+00000000008054e1 <ipc_result>:
+#include <inc/lib.h>
+
+/* Store results of a receiving system call like ipc_recv() does */
+static int32_t
+ipc_result(int res, envid_t *from_env_store, size_t *size, int *perm_store) {
+    if (res < 0) {
+  8054e1:	85 ff                	test   %edi,%edi
+  8054e3:	78 58                	js     80553d <ipc_result+0x5c>
+        }
+
+        return res;
+    }
+
+    if (from_env_store) {
+  8054e5:	48 85 f6             	test   %rsi,%rsi
+  8054e8:	74 12                	je     8054fc <ipc_result+0x1b>
+        *from_env_store = thisenv->env_ipc_from;
+  8054ea:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  8054f1:	00 00 00 
+  8054f4:	8b 80 94 01 00 00    	mov    0x194(%rax),%eax
+  8054fa:	89 06                	mov    %eax,(%rsi)
+    }
+
+    if (perm_store) {
+  8054fc:	48 85 c9             	test   %rcx,%rcx
+  8054ff:	74 12                	je     805513 <ipc_result+0x32>
+        *perm_store = thisenv->env_ipc_perm;
+  805501:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805508:	00 00 00 
+  80550b:	8b 80 98 01 00 00    	mov    0x198(%rax),%eax
+  805511:	89 01                	mov    %eax,(%rcx)
+    }
+
+    if (size) {
+  805513:	48 85 d2             	test   %rdx,%rdx
+  805516:	74 14                	je     80552c <ipc_result+0x4b>
+        *size = thisenv->env_ipc_maxsz;
+  805518:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  80551f:	00 00 00 
+  805522:	48 8b 80 88 01 00 00 	mov    0x188(%rax),%rax
+  805529:	48 89 02             	mov    %rax,(%rdx)
+    }
+
+    return thisenv->env_ipc_value;
+  80552c:	48 a1 20 80 80 01 00 	movabs 0x1808020,%rax
+  805533:	00 00 00 
+  805536:	8b 80 90 01 00 00    	mov    0x190(%rax),%eax
+}
+  80553c:	c3                   	ret
+        if (from_env_store) {
+  80553d:	48 85 f6             	test   %rsi,%rsi
+  805540:	74 06                	je     805548 <ipc_result+0x67>
+            *from_env_store = 0;
+  805542:	c7 06 00 00 00 00    	movl   $0x0,(%rsi)
+        return res;
+  805548:	89 f8                	mov    %edi,%eax
+        if (perm_store) {
+  80554a:	48 85 c9             	test   %rcx,%rcx
+  80554d:	74 ed                	je     80553c <ipc_result+0x5b>
+            *perm_store = 0;
+  80554f:	c7 01 00 00 00 00    	movl   $0x0,(%rcx)
+  805555:	c3                   	ret
+
+0000000000805556 <ipc_recv>:
+ *   Use 'thisenv' to discover the value and who sent it.
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value, since that's
+ *   a perfectly valid place to map a page.) */
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805556:	55                   	push   %rbp
+  805557:	48 89 e5             	mov    %rsp,%rbp
+  80555a:	41 55                	push   %r13
+  80555c:	41 54                	push   %r12
+  80555e:	53                   	push   %rbx
+  80555f:	48 83 ec 08          	sub    $0x8,%rsp
+  805563:	49 89 fc             	mov    %rdi,%r12
+  805566:	48 89 f7             	mov    %rsi,%rdi
+  805569:	48 89 d3             	mov    %rdx,%rbx
+  80556c:	49 89 cd             	mov    %rcx,%r13
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80556f:	48 85 f6             	test   %rsi,%rsi
+  805572:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805579:	00 00 00 
+  80557c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+
+    int res = sys_ipc_recv(pg, size ? *size : 0);
+  805580:	be 00 00 00 00       	mov    $0x0,%esi
+  805585:	48 85 d2             	test   %rdx,%rdx
+  805588:	74 03                	je     80558d <ipc_recv+0x37>
+  80558a:	48 8b 32             	mov    (%rdx),%rsi
+  80558d:	48 b8 26 2d 80 00 00 	movabs $0x802d26,%rax
+  805594:	00 00 00 
+  805597:	ff d0                	call   *%rax
+  805599:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, size, perm_store);
+  80559b:	4c 89 e9             	mov    %r13,%rcx
+  80559e:	48 89 da             	mov    %rbx,%rdx
+  8055a1:	4c 89 e6             	mov    %r12,%rsi
+  8055a4:	48 b8 e1 54 80 00 00 	movabs $0x8054e1,%rax
+  8055ab:	00 00 00 
+  8055ae:	ff d0                	call   *%rax
+}
+  8055b0:	48 83 c4 08          	add    $0x8,%rsp
+  8055b4:	5b                   	pop    %rbx
+  8055b5:	41 5c                	pop    %r12
+  8055b7:	41 5d                	pop    %r13
+  8055b9:	5d                   	pop    %rbp
+  8055ba:	c3                   	ret
+
+00000000008055bb <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_send a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8055bb:	55                   	push   %rbp
+  8055bc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here DONE
+    if (!pg) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8055bf:	48 85 d2             	test   %rdx,%rdx
+  8055c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8055c9:	00 00 00 
+  8055cc:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8055d0:	89 f6                	mov    %esi,%esi
+  8055d2:	48 b8 b2 2b 80 00 00 	movabs $0x802bb2,%rax
+  8055d9:	00 00 00 
+  8055dc:	ff d0                	call   *%rax
+    if (res < 0) {
+  8055de:	85 c0                	test   %eax,%eax
+  8055e0:	78 02                	js     8055e4 <ipc_send+0x29>
+        panic("ipc_send: %i", res);
+    }
+}
+  8055e2:	5d                   	pop    %rbp
+  8055e3:	c3                   	ret
+        panic("ipc_send: %i", res);
+  8055e4:	89 c1                	mov    %eax,%ecx
+  8055e6:	48 ba b0 64 80 00 00 	movabs $0x8064b0,%rdx
+  8055ed:	00 00 00 
+  8055f0:	be 4f 00 00 00       	mov    $0x4f,%esi
+  8055f5:	48 bf bd 64 80 00 00 	movabs $0x8064bd,%rdi
+  8055fc:	00 00 00 
+  8055ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  805604:	49 b8 2c 51 80 00 00 	movabs $0x80512c,%r8
+  80560b:	00 00 00 
+  80560e:	41 ff d0             	call   *%r8
+
+0000000000805611 <ipc_call>:
+ * and receive the reply from 'to_env' like ipc_recv() (at 'rcv_pg'
+ * of at most *rcv_size bytes) in a single system call.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+         void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  805611:	55                   	push   %rbp
+  805612:	48 89 e5             	mov    %rsp,%rbp
+  805615:	53                   	push   %rbx
+  805616:	48 83 ec 08          	sub    $0x8,%rsp
+  80561a:	48 8b 5d 10          	mov    0x10(%rbp),%rbx
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  80561e:	48 85 d2             	test   %rdx,%rdx
+  805621:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805628:	00 00 00 
+  80562b:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  80562f:	4d 85 c9             	test   %r9,%r9
+  805632:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_call(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  805636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80563b:	48 85 db             	test   %rbx,%rbx
+  80563e:	74 03                	je     805643 <ipc_call+0x32>
+  805640:	48 8b 03             	mov    (%rbx),%rax
+  805643:	89 f6                	mov    %esi,%esi
+  805645:	48 83 ec 08          	sub    $0x8,%rsp
+  805649:	50                   	push   %rax
+  80564a:	48 b8 e4 2b 80 00 00 	movabs $0x802be4,%rax
+  805651:	00 00 00 
+  805654:	ff d0                	call   *%rax
+  805656:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, rcv_size, perm_store);
+  805658:	48 8b 4d 18          	mov    0x18(%rbp),%rcx
+  80565c:	48 89 da             	mov    %rbx,%rdx
+  80565f:	be 00 00 00 00       	mov    $0x0,%esi
+  805664:	48 b8 e1 54 80 00 00 	movabs $0x8054e1,%rax
+  80566b:	00 00 00 
+  80566e:	ff d0                	call   *%rax
+}
+  805670:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805674:	c9                   	leave
+  805675:	c3                   	ret
+
+0000000000805676 <ipc_call_short>:
+/* Like ipc_call(), but the request carries IPC_NWORDS words
+ * in registers instead of a region, so no memory is mapped.
+ * The receiver finds them in thisenv->env_ipc_words.
+ * Returns the reply value or the error. */
+int32_t
+ipc_call_short(envid_t to_env, uint32_t val, const uint64_t words[IPC_NWORDS]) {
+  805676:	55                   	push   %rbp
+  805677:	48 89 e5             	mov    %rsp,%rbp
+    int res = sys_ipc_call_short(to_env, val, words);
+  80567a:	89 f6                	mov    %esi,%esi
+  80567c:	48 b8 50 2c 80 00 00 	movabs $0x802c50,%rax
+  805683:	00 00 00 
+  805686:	ff d0                	call   *%rax
+  805688:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, NULL, NULL, NULL);
+  80568a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80568f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805694:	be 00 00 00 00       	mov    $0x0,%esi
+  805699:	48 b8 e1 54 80 00 00 	movabs $0x8054e1,%rax
+  8056a0:	00 00 00 
+  8056a3:	ff d0                	call   *%rax
+}
+  8056a5:	5d                   	pop    %rbp
+  8056a6:	c3                   	ret
+
+00000000008056a7 <ipc_reply_wait>:
+ * If 'to_env' is not receiving yet, the caller blocks until it does,
+ * so a client that sends a request and never receives the reply
+ * stalls a single-threaded server such as the file server. */
+int32_t
+ipc_reply_wait(envid_t to_env, uint32_t val, void *pg, size_t size, int perm,
+               envid_t *from_env_store, void *rcv_pg, size_t *rcv_size, int *perm_store) {
+  8056a7:	55                   	push   %rbp
+  8056a8:	48 89 e5             	mov    %rsp,%rbp
+  8056ab:	41 54                	push   %r12
+  8056ad:	53                   	push   %rbx
+  8056ae:	4c 89 cb             	mov    %r9,%rbx
+  8056b1:	4c 8b 4d 10          	mov    0x10(%rbp),%r9
+  8056b5:	4c 8b 65 18          	mov    0x18(%rbp),%r12
+    if (!pg) pg = (void *)MAX_USER_ADDRESS;
+  8056b9:	48 85 d2             	test   %rdx,%rdx
+  8056bc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8056c3:	00 00 00 
+  8056c6:	48 0f 44 d0          	cmove  %rax,%rdx
+    if (!rcv_pg) rcv_pg = (void *)MAX_USER_ADDRESS;
+  8056ca:	4d 85 c9             	test   %r9,%r9
+  8056cd:	4c 0f 44 c8          	cmove  %rax,%r9
+
+    int res = sys_ipc_reply_wait(to_env, val, pg, size, perm, rcv_pg, rcv_size ? *rcv_size : 0);
+  8056d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056d6:	4d 85 e4             	test   %r12,%r12
+  8056d9:	74 04                	je     8056df <ipc_reply_wait+0x38>
+  8056db:	49 8b 04 24          	mov    (%r12),%rax
+  8056df:	89 f6                	mov    %esi,%esi
+  8056e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8056e5:	50                   	push   %rax
+  8056e6:	48 b8 ba 2c 80 00 00 	movabs $0x802cba,%rax
+  8056ed:	00 00 00 
+  8056f0:	ff d0                	call   *%rax
+  8056f2:	89 c7                	mov    %eax,%edi
+    return ipc_result(res, from_env_store, rcv_size, perm_store);
+  8056f4:	48 8b 4d 20          	mov    0x20(%rbp),%rcx
+  8056f8:	4c 89 e2             	mov    %r12,%rdx
+  8056fb:	48 89 de             	mov    %rbx,%rsi
+  8056fe:	48 b8 e1 54 80 00 00 	movabs $0x8054e1,%rax
+  805705:	00 00 00 
+  805708:	ff d0                	call   *%rax
+}
+  80570a:	48 8d 65 f0          	lea    -0x10(%rbp),%rsp
+  80570e:	5b                   	pop    %rbx
+  80570f:	41 5c                	pop    %r12
+  805711:	5d                   	pop    %rbp
+  805712:	c3                   	ret
+
+0000000000805713 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805713:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (envs[i].env_type == type)
+  805718:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80571f:	00 00 00 
+  805722:	48 69 d0 38 02 00 00 	imul   $0x238,%rax,%rdx
+  805729:	48 01 ca             	add    %rcx,%rdx
+  80572c:	8b 92 d4 00 00 00    	mov    0xd4(%rdx),%edx
+  805732:	39 fa                	cmp    %edi,%edx
+  805734:	74 12                	je     805748 <ipc_find_env+0x35>
+    for (size_t i = 0; i < NENV; i++)
+  805736:	48 83 c0 01          	add    $0x1,%rax
+  80573a:	48 3d 00 04 00 00    	cmp    $0x400,%rax
+  805740:	75 e0                	jne    805722 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805742:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805747:	c3                   	ret
+            return envs[i].env_id;
+  805748:	48 69 c0 38 02 00 00 	imul   $0x238,%rax,%rax
+  80574f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805756:	00 00 00 
+  805759:	48 01 d0             	add    %rdx,%rax
+  80575c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805762:	c3                   	ret
+  805763:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805768 <__rodata_start>:
+  805768:	77 00                	ja     80576a <__rodata_start+0x2>
+  80576a:	72 62                	jb     8057ce <__rodata_start+0x66>
+  80576c:	00 77 62             	add    %dh,0x62(%rdi)
+  80576f:	00 66 2e             	add    %ah,0x2e(%rsi)
+  805772:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805779:	00 
+  80577a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  805780:	b3 09                	mov    $0x9,%bl
+  805782:	80 00 00             	addb   $0x0,(%rax)
+  805785:	00 00                	add    %al,(%rax)
+  805787:	00 ed                	add    %ch,%ch
+  805789:	0d 80 00 00 00       	or     $0x80,%eax
+  80578e:	00 00                	add    %al,(%rax)
+  805790:	ed                   	in     (%dx),%eax
+  805791:	0d 80 00 00 00       	or     $0x80,%eax
+  805796:	00 00                	add    %al,(%rax)
+  805798:	ed                   	in     (%dx),%eax
+  805799:	0d 80 00 00 00       	or     $0x80,%eax
+  80579e:	00 00                	add    %al,(%rax)
+  8057a0:	ed                   	in     (%dx),%eax
+  8057a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057a6:	00 00                	add    %al,(%rax)
+  8057a8:	2d 0a 80 00 00       	sub    $0x800a,%eax
+  8057ad:	00 00                	add    %al,(%rax)
+  8057af:	00 ed                	add    %ch,%ch
+  8057b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057b6:	00 00                	add    %al,(%rax)
+  8057b8:	ed                   	in     (%dx),%eax
+  8057b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057be:	00 00                	add    %al,(%rax)
+  8057c0:	ed                   	in     (%dx),%eax
+  8057c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057c6:	00 00                	add    %al,(%rax)
+  8057c8:	ed                   	in     (%dx),%eax
+  8057c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8057ce:	00 00                	add    %al,(%rax)
+  8057d0:	ed                   	in     (%dx),%eax
+  8057d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8057d6:	00 00                	add    %al,(%rax)
+  8057d8:	8c 0a                	mov    %cs,(%rdx)
+  8057da:	80 00 00             	addb   $0x0,(%rax)
+  8057dd:	00 00                	add    %al,(%rax)
+  8057df:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057e6:	00 00                	add    %al,(%rax)
+  8057e8:	8c 0a                	mov    %cs,(%rdx)
+  8057ea:	80 00 00             	addb   $0x0,(%rax)
+  8057ed:	00 00                	add    %al,(%rax)
+  8057ef:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  8057f6:	00 00                	add    %al,(%rax)
+  8057f8:	8c 0a                	mov    %cs,(%rdx)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805806:	00 00                	add    %al,(%rax)
+  805808:	8c 0a                	mov    %cs,(%rdx)
+  80580a:	80 00 00             	addb   $0x0,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805816:	00 00                	add    %al,(%rax)
+  805818:	8c 0a                	mov    %cs,(%rdx)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 8c 0a 80 00 00 00 	add    %cl,0x80(%rdx,%rcx,1)
+  805826:	00 00                	add    %al,(%rax)
+  805828:	ed                   	in     (%dx),%eax
+  805829:	0d 80 00 00 00       	or     $0x80,%eax
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	ed                   	in     (%dx),%eax
+  805831:	0d 80 00 00 00       	or     $0x80,%eax
+  805836:	00 00                	add    %al,(%rax)
+  805838:	ed                   	in     (%dx),%eax
+  805839:	0d 80 00 00 00       	or     $0x80,%eax
+  80583e:	00 00                	add    %al,(%rax)
+  805840:	ed                   	in     (%dx),%eax
+  805841:	0d 80 00 00 00       	or     $0x80,%eax
+  805846:	00 00                	add    %al,(%rax)
+  805848:	ed                   	in     (%dx),%eax
+  805849:	0d 80 00 00 00       	or     $0x80,%eax
+  80584e:	00 00                	add    %al,(%rax)
+  805850:	ed                   	in     (%dx),%eax
+  805851:	0d 80 00 00 00       	or     $0x80,%eax
+  805856:	00 00                	add    %al,(%rax)
+  805858:	ed                   	in     (%dx),%eax
+  805859:	0d 80 00 00 00       	or     $0x80,%eax
+  80585e:	00 00                	add    %al,(%rax)
+  805860:	ed                   	in     (%dx),%eax
+  805861:	0d 80 00 00 00       	or     $0x80,%eax
+  805866:	00 00                	add    %al,(%rax)
+  805868:	ed                   	in     (%dx),%eax
+  805869:	0d 80 00 00 00       	or     $0x80,%eax
+  80586e:	00 00                	add    %al,(%rax)
+  805870:	ed                   	in     (%dx),%eax
+  805871:	0d 80 00 00 00       	or     $0x80,%eax
+  805876:	00 00                	add    %al,(%rax)
+  805878:	ed                   	in     (%dx),%eax
+  805879:	0d 80 00 00 00       	or     $0x80,%eax
+  80587e:	00 00                	add    %al,(%rax)
+  805880:	ed                   	in     (%dx),%eax
+  805881:	0d 80 00 00 00       	or     $0x80,%eax
+  805886:	00 00                	add    %al,(%rax)
+  805888:	ed                   	in     (%dx),%eax
+  805889:	0d 80 00 00 00       	or     $0x80,%eax
+  80588e:	00 00                	add    %al,(%rax)
+  805890:	ed                   	in     (%dx),%eax
+  805891:	0d 80 00 00 00       	or     $0x80,%eax
+  805896:	00 00                	add    %al,(%rax)
+  805898:	ed                   	in     (%dx),%eax
+  805899:	0d 80 00 00 00       	or     $0x80,%eax
+  80589e:	00 00                	add    %al,(%rax)
+  8058a0:	ed                   	in     (%dx),%eax
+  8058a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058a6:	00 00                	add    %al,(%rax)
+  8058a8:	ed                   	in     (%dx),%eax
+  8058a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	ed                   	in     (%dx),%eax
+  8058b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058b6:	00 00                	add    %al,(%rax)
+  8058b8:	ed                   	in     (%dx),%eax
+  8058b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058be:	00 00                	add    %al,(%rax)
+  8058c0:	ed                   	in     (%dx),%eax
+  8058c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	ed                   	in     (%dx),%eax
+  8058c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	ed                   	in     (%dx),%eax
+  8058d1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058d6:	00 00                	add    %al,(%rax)
+  8058d8:	ed                   	in     (%dx),%eax
+  8058d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058de:	00 00                	add    %al,(%rax)
+  8058e0:	ed                   	in     (%dx),%eax
+  8058e1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058e6:	00 00                	add    %al,(%rax)
+  8058e8:	ed                   	in     (%dx),%eax
+  8058e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058ee:	00 00                	add    %al,(%rax)
+  8058f0:	ed                   	in     (%dx),%eax
+  8058f1:	0d 80 00 00 00       	or     $0x80,%eax
+  8058f6:	00 00                	add    %al,(%rax)
+  8058f8:	ed                   	in     (%dx),%eax
+  8058f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8058fe:	00 00                	add    %al,(%rax)
+  805900:	ed                   	in     (%dx),%eax
+  805901:	0d 80 00 00 00       	or     $0x80,%eax
+  805906:	00 00                	add    %al,(%rax)
+  805908:	ed                   	in     (%dx),%eax
+  805909:	0d 80 00 00 00       	or     $0x80,%eax
+  80590e:	00 00                	add    %al,(%rax)
+  805910:	ed                   	in     (%dx),%eax
+  805911:	0d 80 00 00 00       	or     $0x80,%eax
+  805916:	00 00                	add    %al,(%rax)
+  805918:	f4                   	hlt
+  805919:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80591f:	00 ed                	add    %ch,%ch
+  805921:	0d 80 00 00 00       	or     $0x80,%eax
+  805926:	00 00                	add    %al,(%rax)
+  805928:	ed                   	in     (%dx),%eax
+  805929:	0d 80 00 00 00       	or     $0x80,%eax
+  80592e:	00 00                	add    %al,(%rax)
+  805930:	2c 0b                	sub    $0xb,%al
+  805932:	80 00 00             	addb   $0x0,(%rax)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 ed                	add    %ch,%ch
+  805939:	0d 80 00 00 00       	or     $0x80,%eax
+  80593e:	00 00                	add    %al,(%rax)
+  805940:	ed                   	in     (%dx),%eax
+  805941:	0d 80 00 00 00       	or     $0x80,%eax
+  805946:	00 00                	add    %al,(%rax)
+  805948:	ed                   	in     (%dx),%eax
+  805949:	0d 80 00 00 00       	or     $0x80,%eax
+  80594e:	00 00                	add    %al,(%rax)
+  805950:	ed                   	in     (%dx),%eax
+  805951:	0d 80 00 00 00       	or     $0x80,%eax
+  805956:	00 00                	add    %al,(%rax)
+  805958:	ed                   	in     (%dx),%eax
+  805959:	0d 80 00 00 00       	or     $0x80,%eax
+  80595e:	00 00                	add    %al,(%rax)
+  805960:	ed                   	in     (%dx),%eax
+  805961:	0d 80 00 00 00       	or     $0x80,%eax
+  805966:	00 00                	add    %al,(%rax)
+  805968:	ed                   	in     (%dx),%eax
+  805969:	0d 80 00 00 00       	or     $0x80,%eax
+  80596e:	00 00                	add    %al,(%rax)
+  805970:	10 0c 80             	adc    %cl,(%rax,%rax,4)
+  805973:	00 00                	add    %al,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 cb                	add    %cl,%bl
+  805979:	0d 80 00 00 00       	or     $0x80,%eax
+  80597e:	00 00                	add    %al,(%rax)
+  805980:	ed                   	in     (%dx),%eax
+  805981:	0d 80 00 00 00       	or     $0x80,%eax
+  805986:	00 00                	add    %al,(%rax)
+  805988:	ed                   	in     (%dx),%eax
+  805989:	0d 80 00 00 00       	or     $0x80,%eax
+  80598e:	00 00                	add    %al,(%rax)
+  805990:	ed                   	in     (%dx),%eax
+  805991:	0d 80 00 00 00       	or     $0x80,%eax
+  805996:	00 00                	add    %al,(%rax)
+  805998:	6a 0a                	push   $0xa
+  80599a:	80 00 00             	addb   $0x0,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 ed                	add    %ch,%ch
+  8059a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ae:	00 00                	add    %al,(%rax)
+  8059b0:	ed                   	in     (%dx),%eax
+  8059b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059b6:	00 00                	add    %al,(%rax)
+  8059b8:	3c 0a                	cmp    $0xa,%al
+  8059ba:	80 00 00             	addb   $0x0,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 ed                	add    %ch,%ch
+  8059c1:	0d 80 00 00 00       	or     $0x80,%eax
+  8059c6:	00 00                	add    %al,(%rax)
+  8059c8:	4f 0c 80             	rex.WRXB or $0x80,%al
+  8059cb:	00 00                	add    %al,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 a8 0a 80 00 00    	add    %ch,0x800a(%rax)
+  8059d5:	00 00                	add    %al,(%rax)
+  8059d7:	00 29                	add    %ch,(%rcx)
+  8059d9:	0c 80                	or     $0x80,%al
+  8059db:	00 00                	add    %al,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 5e 0a             	add    %bl,0xa(%rsi)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 ed                	add    %ch,%ch
+  8059e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059ee:	00 00                	add    %al,(%rax)
+  8059f0:	1a 0b                	sbb    (%rbx),%cl
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 ed                	add    %ch,%ch
+  8059f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8059fe:	00 00                	add    %al,(%rax)
+  805a00:	ce                   	(bad)
+  805a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a07:	00 ed                	add    %ch,%ch
+  805a09:	0d 80 00 00 00       	or     $0x80,%eax
+  805a0e:	00 00                	add    %al,(%rax)
+  805a10:	ed                   	in     (%dx),%eax
+  805a11:	0d 80 00 00 00       	or     $0x80,%eax
+  805a16:	00 00                	add    %al,(%rax)
+  805a18:	f4                   	hlt
+  805a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805a1f:	00 37                	add    %dh,(%rdi)
+  805a21:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a2a:	80 00 00             	addb   $0x0,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 37                	add    %dh,(%rdi)
+  805a31:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805a37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 64 11 80          	add    %ah,-0x80(%rcx,%rdx,1)
+  805a4b:	00 00                	add    %al,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 d2                	add    %dl,%dl
+  805a51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a57:	00 d2                	add    %dl,%dl
+  805a59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a5f:	00 d2                	add    %dl,%dl
+  805a61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a67:	00 d2                	add    %dl,%dl
+  805a69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a6f:	00 d2                	add    %dl,%dl
+  805a71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a77:	00 d2                	add    %dl,%dl
+  805a79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a7f:	00 d2                	add    %dl,%dl
+  805a81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a87:	00 f6                	add    %dh,%dh
+  805a89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a8f:	00 f6                	add    %dh,%dh
+  805a91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805a97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 22                	add    %ah,(%rdx)
+  805ad1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ad7:	00 22                	add    %ah,(%rdx)
+  805ad9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805adf:	00 22                	add    %ah,(%rdx)
+  805ae1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805ae7:	00 22                	add    %ah,(%rdx)
+  805ae9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805aef:	00 22                	add    %ah,(%rdx)
+  805af1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805af7:	00 22                	add    %ah,(%rdx)
+  805af9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805aff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 46 12             	add    %al,0x12(%rsi)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 5f 12             	add    %bl,0x12(%rdi)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 5f 12             	add    %bl,0x12(%rdi)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 22                	add    %ah,(%rdx)
+  805bd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bd7:	00 22                	add    %ah,(%rdx)
+  805bd9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bdf:	00 22                	add    %ah,(%rdx)
+  805be1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805be7:	00 22                	add    %ah,(%rdx)
+  805be9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bef:	00 22                	add    %ah,(%rdx)
+  805bf1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bf7:	00 22                	add    %ah,(%rdx)
+  805bf9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805bff:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 5f 12             	add    %bl,0x12(%rdi)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 46 12             	add    %al,0x12(%rsi)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+	...
+
+0000000000805ca0 <basefix.0>:
+  805ca0:	0a 00 01 00 02 00 03 00 04 00 05 00 06 00 07 00     ................
+  805cb0:	08 00 09 00 0a 00 0b 00 0c 00 0d 00 0e 00 0f 00     ................
+  805cc0:	10 00 66 0f 1f 44 00 00 48 65 6c 6c 6f 2c 20 49     ..f..D..Hello, I
+  805cd0:	20 61 6d 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 20      am environment 
+  805ce0:	25 30 38 78 2e 0a 00 00 42 61 63 6b 20 69 6e 20     %08x....Back in 
+  805cf0:	65 6e 76 69 72 6f 6e 6d 65 6e 74 20 25 30 38 78     environment %08x
+  805d00:	2c 20 69 74 65 72 61 74 69 6f 6e 20 25 64 2e 0a     , iteration %d..
+	...
+  805d18:	41 6c 6c 20 64 6f 6e 65 20 69 6e 20 65 6e 76 69     All done in envi
+  805d28:	72 6f 6e 6d 65 6e 74 20 25 30 38 78 2e 0a 00 3c     ronment %08x...<
+  805d38:	75 6e 6b 6e 6f 77 6e 3e 00 30 31 32 33 34 35 36     unknown>.0123456
+  805d48:	37 38 39 41 42 43 44 45 46 00 30 31 32 33 34 35     789ABCDEF.012345
+  805d58:	36 37 38 39 61 62 63 64 65 66 00 28 6e 75 6c 6c     6789abcdef.(null
+  805d68:	29 00 65 72 72 6f 72 20 25 64 00 75 6e 73 70 65     ).error %d.unspe
+  805d78:	63 69 66 69 65 64 20 65 72 72 6f 72 00 62 61 64     cified error.bad
+  805d88:	20 65 6e 76 69 72 6f 6e 6d 65 6e 74 00 69 6e 76      environment.inv
+  805d98:	61 6c 69 64 20 70 61 72 61 6d 65 74 65 72 00 6f     alid parameter.o
+  805da8:	75 74 20 6f 66 20 6d 65 6d 6f 72 79 00 6f 75 74     ut of memory.out
+  805db8:	20 6f 66 20 65 6e 76 69 72 6f 6e 6d 65 6e 74 73      of environments
+  805dc8:	00 63 6f 72 72 75 70 74 65 64 20 64 65 62 75 67     .corrupted debug
+  805dd8:	20 69 6e 66 6f 00 73 65 67 6d 65 6e 74 61 74 69      info.segmentati
+  805de8:	6f 6e 20 66 61 75 6c 74 00 69 6e 76 61 6c 69 64     on fault.invalid
+  805df8:	20 45 4c 46 20 69 6d 61 67 65 00 6e 6f 20 73 75      ELF image.no su
+  805e08:	63 68 20 73 79 73 74 65 6d 20 63 61 6c 6c 00 65     ch system call.e
+  805e18:	6e 74 72 79 20 6e 6f 74 20 66 6f 75 6e 64 00 65     ntry not found.e
+  805e28:	6e 76 20 69 73 20 6e 6f 74 20 72 65 63 76 69 6e     nv is not recvin
+  805e38:	67 00 75 6e 65 78 70 65 63 74 65 64 20 65 6e 64     g.unexpected end
+  805e48:	20 6f 66 20 66 69 6c 65 00 6e 6f 20 66 72 65 65      of file.no free
+  805e58:	20 73 70 61 63 65 20 6f 6e 20 64 69 73 6b 00 74      space on disk.t
+  805e68:	6f 6f 20 6d 61 6e 79 20 66 69 6c 65 73 20 61 72     oo many files ar
+  805e78:	65 20 6f 70 65 6e 00 66 69 6c 65 20 6f 72 20 62     e open.file or b
+  805e88:	6c 6f 63 6b 20 6e 6f 74 20 66 6f 75 6e 64 00 69     lock not found.i
+  805e98:	6e 76 61 6c 69 64 20 70 61 74 68 00 66 69 6c 65     nvalid path.file
+  805ea8:	20 61 6c 72 65 61 64 79 20 65 78 69 73 74 73 00      already exists.
+  805eb8:	6f 70 65 72 61 74 69 6f 6e 20 6e 6f 74 20 73 75     operation not su
+  805ec8:	70 70 6f 72 74 65 64 00 66 2e 0f 1f 84 00 00 00     pported.f.......
+  805ed8:	00 00 66 0f 1f 44 00 00 36 19 80 00 00 00 00 00     ..f..D..6.......
+  805ee8:	8d 1f 80 00 00 00 00 00 7d 1f 80 00 00 00 00 00     ........}.......
+  805ef8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805f08:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805f18:	55 19 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     U...............
+  805f28:	8d 1f 80 00 00 00 00 00 49 19 80 00 00 00 00 00     ........I.......
+  805f38:	c3 19 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805f48:	49 19 80 00 00 00 00 00 8f 19 80 00 00 00 00 00     I...............
+  805f58:	8f 19 80 00 00 00 00 00 8f 19 80 00 00 00 00 00     ................
+  805f68:	8f 19 80 00 00 00 00 00 8f 19 80 00 00 00 00 00     ................
+  805f78:	8f 19 80 00 00 00 00 00 8f 19 80 00 00 00 00 00     ................
+  805f88:	8f 19 80 00 00 00 00 00 8f 19 80 00 00 00 00 00     ................
+  805f98:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805fa8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805fb8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805fc8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805fd8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805fe8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  805ff8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806008:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806018:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806028:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806038:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806048:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806058:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806068:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806078:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806088:	ab 1e 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806098:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  8060a8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  8060b8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  8060c8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  8060d8:	8d 1f 80 00 00 00 00 00 f1 19 80 00 00 00 00 00     ................
+  8060e8:	c0 1b 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  8060f8:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806108:	e6 19 80 00 00 00 00 00 20 1a 80 00 00 00 00 00     ........ .......
+  806118:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806128:	db 19 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806138:	8d 1f 80 00 00 00 00 00 69 1d 80 00 00 00 00 00     ........i.......
+  806148:	38 1e 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     8...............
+  806158:	8d 1f 80 00 00 00 00 00 b7 1a 80 00 00 00 00 00     ................
+  806168:	8d 1f 80 00 00 00 00 00 94 1c 80 00 00 00 00 00     ................
+  806178:	8d 1f 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806188:	ab 1e 80 00 00 00 00 00 8d 1f 80 00 00 00 00 00     ................
+  806198:	3f 19 80 00 00 00 00 00                             ?.......
+
+00000000008061a0 <error_string>:
+	...
+  8061a8:	73 5d 80 00 00 00 00 00 85 5d 80 00 00 00 00 00     s].......]......
+  8061b8:	95 5d 80 00 00 00 00 00 a7 5d 80 00 00 00 00 00     .].......]......
+  8061c8:	b5 5d 80 00 00 00 00 00 c9 5d 80 00 00 00 00 00     .].......]......
+  8061d8:	de 5d 80 00 00 00 00 00 f1 5d 80 00 00 00 00 00     .].......]......
+  8061e8:	03 5e 80 00 00 00 00 00 17 5e 80 00 00 00 00 00     .^.......^......
+  8061f8:	27 5e 80 00 00 00 00 00 3a 5e 80 00 00 00 00 00     '^......:^......
+  806208:	51 5e 80 00 00 00 00 00 67 5e 80 00 00 00 00 00     Q^......g^......
+  806218:	7f 5e 80 00 00 00 00 00 97 5e 80 00 00 00 00 00     .^.......^......
+  806228:	a4 5e 80 00 00 00 00 00 40 62 80 00 00 00 00 00     .^......@b......
+  806238:	b8 5e 80 00 00 00 00 00 66 69 6c 65 20 69 73 20     .^......file is 
+  806248:	6e 6f 74 20 61 20 76 61 6c 69 64 20 65 78 65 63     not a valid exec
+  806258:	75 74 61 62 6c 65 00 2e 3b 21 3f 2e 2e 2e 00 90     utable..;!?.....
+  806268:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806278:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806288:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  806298:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8062a8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8062b8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8062c8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8062d8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8062e8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8062f8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806308:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806318:	00 00 00 00 0f 1f 40 00                             ......@.
+
+0000000000806320 <devtab>:
+  806320:	40 70 80 00 00 00 00 00 80 70 80 00 00 00 00 00     @p.......p......
+  806330:	c0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806340:	73 69 7a 65 20 3c 3d 20 73 69 7a 65 6f 66 28 77     size <= sizeof(w
+  806350:	6f 72 64 73 29 00 61 73 73 65 72 74 69 6f 6e 20     ords).assertion 
+  806360:	66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f 66     failed: %s.lib/f
+  806370:	69 6c 65 2e 63 00 66 64 00 62 75 66 00 72 65 73     ile.c.fd.buf.res
+  806380:	20 3c 3d 20 6e 00 66 90 72 65 73 20 3c 3d 20 73      <= n.f.res <= s
+  806390:	69 7a 65 6f 66 28 66 73 69 70 63 62 75 66 2e 72     izeof(fsipcbuf.r
+  8063a0:	65 61 64 52 65 74 2e 72 65 74 5f 62 75 66 29 00     eadRet.ret_buf).
+  8063b0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  8063c0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  8063d0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8063e0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 66 75 6e 00     _SIZE) == 2.fun.
+  8063f0:	6c 69 62 2f 75 76 70 74 2e 63 00 61 64 64 72 20     lib/uvpt.c.addr 
+  806400:	3d 3d 20 30 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73     == 0.<cons>.cons
+  806410:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  806420:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  806430:	61 74 20 25 73 3a 25 64 3a 20 00 0f 1f 44 00 00     at %s:%d: ...D..
+  806440:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806450:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806460:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806470:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806480:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806490:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8064a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8064b0:	69 70 63 5f 73 65 6e 64 3a 20 25 69 00 6c 69 62     ipc_send: %i.lib
+  8064c0:	2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00     /ipc.c.f........
+  8064d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8064e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8064f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806500:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806510:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806520:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806530:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806540:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806550:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806560:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806570:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806580:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806590:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065a0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8065b0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8065c0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8065d0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8065e0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8065f0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806600:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806610:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806620:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806630:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806640:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806650:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806660:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806670:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806680:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806690:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066a0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8066b0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8066c0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8066d0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8066e0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8066f0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806700:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806710:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806720:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806730:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806740:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806750:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806760:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806770:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806780:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806790:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067a0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8067b0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8067c0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8067d0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8067e0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8067f0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806800:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806810:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806820:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806830:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806840:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806850:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806860:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806870:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806880:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806890:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068a0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8068b0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8068c0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8068d0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8068e0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8068f0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806900:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806910:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806920:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806930:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806940:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806950:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806960:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806970:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806980:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806990:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069a0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  8069b0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  8069c0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  8069d0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  8069e0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  8069f0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806a50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806a60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806a70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806a80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806a90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806aa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ab0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ac0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ad0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ae0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806af0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b00:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b10:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b20:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b30:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b40:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806b50:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806b60:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806b70:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806b80:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806b90:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ba0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806bb0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806bc0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806bd0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806be0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806bf0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c00:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c10:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c20:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c30:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c40:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806c50:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806c60:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806c70:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806c80:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806c90:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ca0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806cb0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806cc0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806cd0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ce0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806cf0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d00:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d10:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d20:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d30:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d40:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806d50:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806d60:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806d70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806d80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806d90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806da0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806db0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806dc0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806dd0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806de0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806df0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806e50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806e60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806e70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806e80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806e90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ea0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806eb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806ec0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806ed0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806ee0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806ef0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f00:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f10:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f20:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f30:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f40:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806f50:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806f60:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806f70:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806f80:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806f90:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806fa0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  806fb0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  806fc0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  806fd0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  806fe0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  806ff0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 00     ...f............
@@ -0,0 +1,32 @@
+/* Physical page allocator benchmark:
+ * allocates and frees pages of mixed classes */
+
+#include <inc/lib.h>
+
+#define BENCH_VA        ((uint8_t *)0x10000000)
+#define BENCH_ITERS     (1 << 20)
+#define BENCH_MAX_CLASS 4
+
+void
+umain(int argc, char **argv) {
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+    int res;
+
+    uint32_t start = vsys_gettimems();
+    for (long i = 0; i < iters; i++) {
+        size_t size = PAGE_SIZE << (i % (BENCH_MAX_CLASS + 1));
+
+        if ((res = sys_alloc_region(CURENVID, BENCH_VA, size, PROT_RW)) < 0)
+            panic("sys_alloc_region: %i", res);
+
+        /* Memory is allocated lazily, so write
+         * to it to make kernel allocate the page */
+        BENCH_VA[0] = 1;
+
+        if ((res = sys_unmap_region(CURENVID, BENCH_VA, size)) < 0)
+            panic("sys_unmap_region: %i", res);
+    }
+    uint32_t elapsed = vsys_gettimems() - start;
+
+    cprintf("allocbench: %ld alloc/free pairs in %u ms\n", iters, elapsed);
+}
@@ -0,0 +1,68 @@
+/* Physical page allocator stress test:
+ * several environments allocate, fill, check and free
+ * 4KB and 2MB pages at the same time */
+
+#include <inc/lib.h>
+
+#define STRESS_VA    ((uint8_t *)0x10000000)
+#define STRESS_ENVS  4
+#define STRESS_ITERS 2000
+#define STRESS_SLOTS 8
+
+static void
+stress(int id) {
+    uint8_t *slots[STRESS_SLOTS] = {0};
+    size_t sizes[STRESS_SLOTS];
+    uint8_t tags[STRESS_SLOTS];
+    int res;
+
+    for (int i = 0; i < STRESS_ITERS; i++) {
+        int slot = (i * 7 + id) % STRESS_SLOTS;
+        uint8_t *va = STRESS_VA + slot * HUGE_PAGE_SIZE;
+        uint8_t tag = (uint8_t)(id * STRESS_ITERS + i);
+
+        if (slots[slot]) {
+            /* Check that nobody else touched our memory */
+            size_t size = sizes[slot];
+            uint8_t expect = tags[slot];
+            if (va[0] != expect || va[size / 2] != expect || va[size - 1] != expect)
+                panic("allocstress: env %d slot %d corrupted", id, slot);
+            if ((res = sys_unmap_region(CURENVID, va, size)) < 0)
+                panic("sys_unmap_region: %i", res);
+            slots[slot] = NULL;
+            continue;
+        }
+
+        size_t size = i % 5 ? PAGE_SIZE : HUGE_PAGE_SIZE;
+        if ((res = sys_alloc_region(CURENVID, va, size, PROT_RW)) < 0)
+            panic("sys_alloc_region: %i", res);
+        va[0] = va[size / 2] = va[size - 1] = tag;
+        slots[slot] = va;
+        sizes[slot] = size;
+        tags[slot] = tag;
+
+        if (!(i % 64)) sys_yield();
+    }
+
+    for (int slot = 0; slot < STRESS_SLOTS; slot++)
+        if (slots[slot]) sys_unmap_region(CURENVID, slots[slot], sizes[slot]);
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t children[STRESS_ENVS];
+
+    for (int i = 0; i < STRESS_ENVS; i++) {
+        if ((children[i] = fork()) < 0)
+            panic("fork: %i", children[i]);
+        if (!children[i]) {
+            stress(i);
+            return;
+        }
+    }
+
+    for (int i = 0; i < STRESS_ENVS; i++)
+        wait(children[i]);
+
+    cprintf("allocstress: OK\n");
+}
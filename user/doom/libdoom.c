@@ -359,6 +359,15 @@ libc_FILE *libc_fopen(const char *filename, const char *mode) {
     return buffer;
 }
 
+void *libc_mmap(libc_FILE *file, size_t length) {
+    void *addr = mmap(NULL, length, PROT_RW, MAP_PRIVATE, *((int*)file), 0);
+    return addr == MAP_FAILED ? NULL : addr;
+}
+
+void libc_munmap(void *addr, size_t length) {
+    munmap(addr, length);
+}
+
 void libc_fclose(libc_FILE *file) {
     close(*((int*)file));
 }
@@ -46,10 +46,14 @@ static wad_file_t *W_StdC_OpenFile(char *path)
 
     result = Z_Malloc(sizeof(stdc_wad_file_t), PU_STATIC, 0);
     result->wad.file_class = &stdc_wad_file;
-    result->wad.mapped = NULL;
     result->wad.length = M_FileLength(fstream);
     result->fstream = fstream;
 
+    // Lumps are read directly from the block cache when the
+    // libc_FILE can be mapped.
+
+    result->wad.mapped = libc_mmap(fstream, result->wad.length);
+
     return &result->wad;
 }
 
@@ -59,6 +63,11 @@ static void W_StdC_CloseFile(wad_file_t *wad)
 
     stdc_wad = (stdc_wad_file_t *) wad;
 
+    if (wad->mapped != NULL)
+    {
+        libc_munmap(wad->mapped, wad->length);
+    }
+
     libc_fclose(stdc_wad->fstream);
     Z_Free(stdc_wad);
 }
@@ -0,0 +1,69 @@
+/* Fair share scheduling test: CPU hogs of equal nice levels
+ * should get equal CPU time, and ones with higher nice levels
+ * proportionally less of it (see sys_env_set_nice) */
+
+#include <inc/lib.h>
+
+#define SHARED  ((struct Shared *)0xA000000)
+#define NHOGS   3
+#define TEST_MS 3000
+
+struct Shared {
+    volatile bool go, stop;
+    volatile uint64_t count[NHOGS];
+};
+
+/* Nice levels of hogs, 0 and 5 have weights 1024 and 335 */
+static const int nice[NHOGS] = {0, 0, 5};
+
+static void
+hog(int i) {
+    while (!SHARED->go) sys_yield();
+    while (!SHARED->stop) SHARED->count[i]++;
+}
+
+/* Checks that a / b is within [lo, hi] percents */
+static void
+check_ratio(const char *what, uint64_t a, uint64_t b, uint64_t lo, uint64_t hi) {
+    uint64_t ratio = b ? a * 100 / b : ~0ULL;
+    cprintf("%s: %llu%%\n", what, (unsigned long long)ratio);
+    if (ratio < lo || ratio > hi)
+        panic("%s is out of [%llu%%, %llu%%]", what,
+              (unsigned long long)lo, (unsigned long long)hi);
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t hogs[NHOGS];
+    int res;
+
+    if ((res = sys_alloc_region(0, SHARED, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+        panic("sys_alloc_region: %i", res);
+
+    for (int i = 0; i < NHOGS; i++) {
+        if ((hogs[i] = fork()) < 0) panic("fork: %i", hogs[i]);
+        if (!hogs[i]) {
+            hog(i);
+            return;
+        }
+        if ((res = sys_env_set_nice(hogs[i], nice[i])) < 0)
+            panic("sys_env_set_nice: %i", res);
+    }
+    if (sys_env_set_nice(0, NICE_MAX + 1) != -E_INVAL)
+        panic("sys_env_set_nice accepted invalid level");
+    if (sys_env_set_nice(0, NICE_MIN) != -E_BAD_ENV)
+        panic("sys_env_set_nice allowed lowering nice level");
+
+    uint32_t start = vsys_gettimems();
+    SHARED->go = 1;
+    while (vsys_gettimems() - start < TEST_MS) sys_yield();
+    SHARED->stop = 1;
+
+    for (int i = 0; i < NHOGS; i++) wait(hogs[i]);
+
+    check_ratio("nice 0 / nice 0", SHARED->count[0], SHARED->count[1], 80, 125);
+    check_ratio("nice 0 / nice 5", SHARED->count[0] + SHARED->count[1],
+                2 * SHARED->count[2], 230, 400);
+
+    cprintf("fairshare: OK\n");
+}
@@ -0,0 +1,76 @@
+/* IPC round trip benchmark: ping-pongs a counter between
+ * two environments using sys_ipc_try_send retried with sys_yield,
+ * blocking sys_ipc_send, and sys_ipc_call with sys_ipc_reply_wait */
+
+#include <inc/lib.h>
+
+#define BENCH_ROUNDS 10000
+
+static void
+spin_send(envid_t to, uint32_t val) {
+    int res;
+    while ((res = sys_ipc_try_send(to, val, (void *)MAX_USER_ADDRESS, 0, 0)) == -E_IPC_NOT_RECV)
+        sys_yield();
+    if (res < 0) panic("sys_ipc_try_send: %i", res);
+}
+
+enum Mode {
+    MODE_TRY_SEND,
+    MODE_SEND,
+    MODE_CALL,
+};
+
+static void
+send(envid_t to, uint32_t val, enum Mode mode) {
+    if (mode == MODE_TRY_SEND)
+        spin_send(to, val);
+    else
+        ipc_send(to, val, NULL, 0, 0);
+}
+
+static void
+bench(const char *name, long rounds, enum Mode mode) {
+    envid_t who = fork();
+    if (who < 0) panic("fork: %i", who);
+
+    if (!who) {
+        /* Echo values back until the last one */
+        uint32_t val = ipc_recv(&who, NULL, NULL, NULL);
+        while (val + 1 < rounds) {
+            if (mode == MODE_CALL) {
+                val = ipc_reply_wait(who, val, NULL, 0, 0, &who, NULL, NULL, NULL);
+            } else {
+                send(who, val, mode);
+                val = ipc_recv(&who, NULL, NULL, NULL);
+            }
+        }
+        send(who, val, mode);
+        exit();
+    }
+
+    uint32_t start = vsys_gettimems();
+    for (long i = 0; i < rounds; i++) {
+        int32_t val;
+        if (mode == MODE_CALL) {
+            val = ipc_call(who, i, NULL, 0, 0, NULL, NULL, NULL);
+        } else {
+            send(who, i, mode);
+            val = ipc_recv(NULL, NULL, NULL, NULL);
+        }
+        if (val != i) panic("round trip %ld is lost", i);
+    }
+    uint32_t elapsed = vsys_gettimems() - start;
+    wait(who);
+
+    cprintf("ipcbench: %-10s %ld round trips in %u ms (%ld/s)\n",
+            name, rounds, elapsed, elapsed ? rounds * 1000 / elapsed : 0);
+}
+
+void
+umain(int argc, char **argv) {
+    long rounds = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ROUNDS;
+
+    bench("try_send", rounds, MODE_TRY_SEND);
+    bench("send", rounds, MODE_SEND);
+    bench("call", rounds, MODE_CALL);
+}
@@ -0,0 +1,74 @@
+/* File mapping test: checks that mapped pages show file contents,
+ * that shared mappings write back and private ones don't */
+
+#include <inc/lib.h>
+
+#define TEST_FILE  "/mmaptest"
+#define TEST_PAGES 40
+
+static char buf[PAGE_SIZE];
+
+static void
+fill(int fd, char tag) {
+    seek(fd, 0);
+    for (int i = 0; i < TEST_PAGES; i++) {
+        memset(buf, tag + i, PAGE_SIZE);
+        if (write(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("write failed");
+    }
+}
+
+static void
+check_file(int fd, int page, char expect) {
+    seek(fd, page * PAGE_SIZE);
+    if (readn(fd, buf, PAGE_SIZE) != PAGE_SIZE) panic("read failed");
+    if (buf[0] != expect || buf[PAGE_SIZE - 1] != expect)
+        panic("page %d of file is %02x, expected %02x", page, buf[0], expect);
+}
+
+void
+umain(int argc, char **argv) {
+    int fd, res;
+
+    if ((fd = open(TEST_FILE, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open %s: %i", TEST_FILE, fd);
+    fill(fd, 'A');
+
+    /* Private mapping */
+    char *p = mmap(NULL, TEST_PAGES * PAGE_SIZE, PROT_RW, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) panic("mmap private failed");
+    for (int i = 0; i < TEST_PAGES; i++)
+        if (p[i * PAGE_SIZE] != 'A' + i) panic("private page %d is %02x", i, p[i * PAGE_SIZE]);
+    p[3 * PAGE_SIZE] = 'z';
+    if ((res = munmap(p, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+    check_file(fd, 3, 'A' + 3);
+
+    /* Shared mapping, file can be closed while it is mapped */
+    char *s = mmap(NULL, TEST_PAGES * PAGE_SIZE, PROT_RW, MAP_SHARED, fd, PAGE_SIZE);
+    if (s == MAP_FAILED) panic("mmap shared failed");
+    close(fd);
+    if (s[0] != 'A' + 1) panic("shared page 0 is %02x", s[0]);
+
+    /* Changes are visible to children sharing the mapping */
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        memset(s + 2 * PAGE_SIZE, 'x', PAGE_SIZE);
+        /* Only the writer knows its pages are dirty */
+        if ((res = msync(s + 2 * PAGE_SIZE, PAGE_SIZE)) < 0) panic("msync: %i", res);
+        return;
+    }
+    wait(child);
+    if (s[2 * PAGE_SIZE] != 'x') panic("shared write is not visible");
+    s[5 * PAGE_SIZE] = 'y';
+    if ((res = munmap(s, TEST_PAGES * PAGE_SIZE)) < 0) panic("munmap: %i", res);
+
+    /* Changes reach the file (mapping started at page 1) */
+    if ((fd = open(TEST_FILE, O_RDONLY)) < 0) panic("open %s: %i", TEST_FILE, fd);
+    check_file(fd, 3, 'x');
+    check_file(fd, 4, 'A' + 4);
+    seek(fd, 6 * PAGE_SIZE);
+    if (readn(fd, buf, 1) != 1 || buf[0] != 'y') panic("shared write is lost");
+    close(fd);
+
+    cprintf("mmaptest: OK\n");
+}
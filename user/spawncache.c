@@ -0,0 +1,65 @@
+/* Spawned image cache test: an image cached by spawn() in one fork
+ * of a program must be used by other forks of it, like the
+ * children a shell forks for every command line */
+
+#include <inc/lib.h>
+
+#define PROG "/hello"
+
+/* Spawn PROG from the image cache only, without reading the file */
+static int
+spawn_cached(void) {
+    struct Stat st;
+    int res;
+
+    if ((res = stat(PROG, &st)) < 0) panic("stat %s: %i", PROG, res);
+    if ((res = sys_alloc_region(0, USPAWN_STAGING, USER_STACK_SIZE, PROT_RW)) < 0)
+        panic("sys_alloc_region: %i", res);
+
+    /* Child starts without arguments when rsp is at the stack top */
+    struct SpawnImage img = {
+            .key = {st.st_ino, st.st_size, st.st_version},
+            .stack = (uintptr_t)USPAWN_STAGING,
+            .rsp = USER_STACK_TOP};
+
+    res = sys_spawn(&img);
+    if (res < 0) sys_unmap_region(0, USPAWN_STAGING, USER_STACK_SIZE);
+    return res;
+}
+
+/* Run fn in a forked child and wait for it */
+static void
+run_forked(void (*fn)(void)) {
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        fn();
+        exit();
+    }
+    wait(child);
+}
+
+static void
+spawn_loaded(void) {
+    int res = spawnl(PROG, "hello", 0);
+    if (res < 0) panic("spawn %s: %i", PROG, res);
+    wait(res);
+}
+
+static void
+spawn_sibling(void) {
+    int res = spawn_cached();
+    if (res < 0) panic("%s is not cached for a sibling fork: %i", PROG, res);
+    wait(res);
+}
+
+void
+umain(int argc, char **argv) {
+    int res = spawn_cached();
+    if (res != -E_NOT_FOUND) panic("%s is cached before it was spawned: %i", PROG, res);
+
+    run_forked(spawn_loaded);
+    run_forked(spawn_sibling);
+
+    cprintf("spawncache: OK\n");
+}
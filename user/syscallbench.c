@@ -0,0 +1,41 @@
+/* System call overhead benchmark: compares a syscall without
+ * arguments in user memory with ones copying them in and out */
+
+#include <inc/lib.h>
+
+#define BENCH_ITERS (1 << 18)
+
+static void
+report(const char *name, long iters, uint32_t elapsed) {
+    cprintf("syscallbench: %-20s %ld calls in %u ms (%ld ns/call)\n",
+            name, iters, elapsed, (long)elapsed * 1000000 / iters);
+}
+
+void
+umain(int argc, char **argv) {
+    long iters = argc > 1 ? strtol(argv[1], NULL, 0) : BENCH_ITERS;
+    uint32_t start;
+    int res;
+
+    start = vsys_gettimems();
+    for (long i = 0; i < iters; i++) sys_getenvid();
+    report("getenvid", iters, vsys_gettimems() - start);
+
+    /* Child is never run, it only provides a trapframe to set */
+    envid_t child = sys_exofork();
+    if (child < 0) panic("sys_exofork: %i", child);
+    if (!child) exit();
+    struct Trapframe tf = envs[ENVX(child)].env_tf;
+
+    start = vsys_gettimems();
+    for (long i = 0; i < iters; i++)
+        if ((res = sys_env_set_trapframe(child, &tf)) < 0)
+            panic("sys_env_set_trapframe: %i", res);
+    report("env_set_trapframe", iters, vsys_gettimems() - start);
+
+    sys_env_destroy(child);
+
+    start = vsys_gettimems();
+    for (long i = 0; i < iters; i++) sys_cputs("", 0);
+    report("cputs (empty)", iters, vsys_gettimems() - start);
+}